@@ -36,9 +36,15 @@ public:
 
     void SetCallAuthenticationContext(UPlayFabAuthenticationContext* InAuthenticationContext);
 
-    /** Set the Request Json object */
+    /** Set the Request Json object, in place of any request body set before */
     void SetRequestObject(UPlayFabJsonObject* JsonObject);
 
+    /** Set the serialized request body, in place of any Request Json object set before */
+    void SetRequestBody(TArray<uint8>&& Body);
+
+    /** Get the Request Json object, parsed from the request body when the request was only serialized */
+    UPlayFabJsonObject* GetRequestObject();
+
     /** Get the Response Json object */
     UPlayFabJsonObject* GetResponseObject();
 
@@ -48,6 +54,9 @@ public:
     /** Reset saved response data */
     void ResetResponseData();
 
+    /** Clear the state of the completed call, and return this proxy to FPlayFabObjectPool */
+    void ReleaseToPool();
+
     /** UOnlineBlueprintCallProxyBase interface */
     virtual void Activate() override;
 
@@ -190,6 +199,9 @@ protected:
     UPROPERTY()
         UPlayFabJsonObject* RequestJsonObj;
 
+    /** Request body as condensed UTF-8 json */
+    TArray<uint8> RequestBody;
+
     /** Response data stored as JSON */
     UPROPERTY()
         UPlayFabJsonObject* ResponseJsonObj;
@@ -16,6 +16,12 @@
 #include "PlayFabEnums.h"
 #include "PlayFabCommon/Public/PlayFabAuthenticationContext.h"
 #include "PlayFabCommon/Public/PlayFabCommonUtils.h"
+#include "PlayFabCommon/Public/PlayFabCallCounters.h"
+#include "PlayFabCommon/Public/PlayFabTrace.h"
+#include "PlayFabCommon/Public/PlayFabRequestLog.h"
+#include "PlayFabObjectPool.h"
+#include "PlayFabRequestWriter.h"
+#include "Misc/ScopeExit.h"
 
 UPlayFabClientAPI::UPlayFabClientAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -30,7 +36,26 @@ void UPlayFabClientAPI::SetCallAuthenticationContext(UPlayFabAuthenticationConte
 
 void UPlayFabClientAPI::SetRequestObject(UPlayFabJsonObject* JsonObject)
 {
+    // The object replaces any body serialized before, and is serialized in Activate
     RequestJsonObj = JsonObject;
+    RequestBody.Reset();
+}
+
+void UPlayFabClientAPI::SetRequestBody(TArray<uint8>&& Body)
+{
+    RequestBody = MoveTemp(Body);
+    RequestJsonObj = nullptr;
+}
+
+UPlayFabJsonObject* UPlayFabClientAPI::GetRequestObject()
+{
+    if (RequestJsonObj == nullptr && RequestBody.Num() > 0)
+    {
+        // Only the few results that hand the request back to Blueprint pay for parsing it
+        RequestJsonObj = NewObject<UPlayFabJsonObject>();
+        RequestJsonObj->DecodeJson(FPlayFabRequestWriter::ToString(RequestBody));
+    }
+    return RequestJsonObj;
 }
 
 UPlayFabJsonObject* UPlayFabClientAPI::GetResponseObject()
@@ -40,31 +65,7 @@ UPlayFabJsonObject* UPlayFabClientAPI::GetResponseObject()
 
 FString UPlayFabClientAPI::PercentEncode(const FString& Text)
 {
-    FString OutText = Text;
-
-    OutText = OutText.Replace(TEXT("!"), TEXT("%21"));
-    OutText = OutText.Replace(TEXT("\""), TEXT("%22"));
-    OutText = OutText.Replace(TEXT("#"), TEXT("%23"));
-    OutText = OutText.Replace(TEXT("$"), TEXT("%24"));
-    //OutText = OutText.Replace(TEXT("&"), TEXT("%26"));
-    OutText = OutText.Replace(TEXT("'"), TEXT("%27"));
-    OutText = OutText.Replace(TEXT("("), TEXT("%28"));
-    OutText = OutText.Replace(TEXT(")"), TEXT("%29"));
-    OutText = OutText.Replace(TEXT("*"), TEXT("%2A"));
-    OutText = OutText.Replace(TEXT("+"), TEXT("%2B"));
-    OutText = OutText.Replace(TEXT(","), TEXT("%2C"));
-    //OutText = OutText.Replace(TEXT("/"), TEXT("%2F"));
-    OutText = OutText.Replace(TEXT(":"), TEXT("%3A"));
-    OutText = OutText.Replace(TEXT(";"), TEXT("%3B"));
-    OutText = OutText.Replace(TEXT("="), TEXT("%3D"));
-    //OutText = OutText.Replace(TEXT("?"), TEXT("%3F"));
-    OutText = OutText.Replace(TEXT("@"), TEXT("%40"));
-    OutText = OutText.Replace(TEXT("["), TEXT("%5B"));
-    OutText = OutText.Replace(TEXT("]"), TEXT("%5D"));
-    OutText = OutText.Replace(TEXT("{"), TEXT("%7B"));
-    OutText = OutText.Replace(TEXT("}"), TEXT("%7D"));
-
-    return OutText;
+    return PlayFabCommon::PlayFabCommonUtils::PercentEncode(Text);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -82,9 +83,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddGenericID(FClientAddGenericIDRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -98,11 +97,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddGenericID(FClientAddGenericIDRequest re
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.GenericId != nullptr) OutRestJsonObj->SetObjectField(TEXT("GenericId"), request.GenericId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("GenericId"), request.GenericId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -120,7 +120,7 @@ void UPlayFabClientAPI::HelperAddGenericID(FPlayFabBaseModel response, UObject*
         FClientAddGenericIDResult ResultStruct = UPlayFabClientModelDecoder::decodeAddGenericIDResultResponse(response.responseData);
         OnSuccessAddGenericID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddGenericID.Unbind();
 }
 
 /** Adds or updates a contact email to the player's profile. */
@@ -130,9 +130,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddOrUpdateContactEmail(FClientAddOrUpdate
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -146,16 +144,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddOrUpdateContactEmail(FClientAddOrUpdate
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EmailAddress.IsEmpty() || request.EmailAddress == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EmailAddress"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EmailAddress"), request.EmailAddress);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EmailAddress"), request.EmailAddress);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -173,7 +168,7 @@ void UPlayFabClientAPI::HelperAddOrUpdateContactEmail(FPlayFabBaseModel response
         FClientAddOrUpdateContactEmailResult ResultStruct = UPlayFabClientModelDecoder::decodeAddOrUpdateContactEmailResultResponse(response.responseData);
         OnSuccessAddOrUpdateContactEmail.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddOrUpdateContactEmail.Unbind();
 }
 
 /** Adds playfab username/password auth to an existing account created via an anonymous auth method, e.g. automatic device ID login. */
@@ -183,9 +178,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddUsernamePassword(FClientAddUsernamePass
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -199,26 +192,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddUsernamePassword(FClientAddUsernamePass
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    if (request.Password.IsEmpty() || request.Password == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Password"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Password"), request.Password);
-    }
-    if (request.Username.IsEmpty() || request.Username == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Username"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Username"), request.Username);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Email"), request.Email);
+    RequestWriter.WriteStringOrNull(TEXT("Password"), request.Password);
+    RequestWriter.WriteStringOrNull(TEXT("Username"), request.Username);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -236,7 +218,7 @@ void UPlayFabClientAPI::HelperAddUsernamePassword(FPlayFabBaseModel response, UO
         FClientAddUsernamePasswordResult ResultStruct = UPlayFabClientModelDecoder::decodeAddUsernamePasswordResultResponse(response.responseData);
         OnSuccessAddUsernamePassword.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddUsernamePassword.Unbind();
 }
 
 /** Retrieves the user's PlayFab account details */
@@ -246,9 +228,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetAccountInfo(FClientGetAccountInfoReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -262,30 +242,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetAccountInfo(FClientGetAccountInfoReques
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.TitleDisplayName.IsEmpty() || request.TitleDisplayName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TitleDisplayName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TitleDisplayName"), request.TitleDisplayName);
-    }
-    if (request.Username.IsEmpty() || request.Username == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Username"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Username"), request.Username);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Email"), request.Email);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("TitleDisplayName"), request.TitleDisplayName);
+    RequestWriter.WriteStringOrNull(TEXT("Username"), request.Username);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -303,7 +268,7 @@ void UPlayFabClientAPI::HelperGetAccountInfo(FPlayFabBaseModel response, UObject
         FClientGetAccountInfoResult ResultStruct = UPlayFabClientModelDecoder::decodeGetAccountInfoResultResponse(response.responseData);
         OnSuccessGetAccountInfo.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetAccountInfo.Unbind();
 }
 
 /** Retrieves all of the user's different kinds of info. */
@@ -313,9 +278,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerCombinedInfo(FClientGetPlayerComb
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -329,17 +292,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerCombinedInfo(FClientGetPlayerComb
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -357,7 +317,7 @@ void UPlayFabClientAPI::HelperGetPlayerCombinedInfo(FPlayFabBaseModel response,
         FClientGetPlayerCombinedInfoResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayerCombinedInfoResultResponse(response.responseData);
         OnSuccessGetPlayerCombinedInfo.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerCombinedInfo.Unbind();
 }
 
 /** Retrieves the player's profile */
@@ -367,9 +327,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerProfile(FClientGetPlayerProfileRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -383,17 +341,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerProfile(FClientGetPlayerProfileRe
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteObject(TEXT("ProfileConstraints"), request.ProfileConstraints);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -411,7 +366,7 @@ void UPlayFabClientAPI::HelperGetPlayerProfile(FPlayFabBaseModel response, UObje
         FClientGetPlayerProfileResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayerProfileResultResponse(response.responseData);
         OnSuccessGetPlayerProfile.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerProfile.Unbind();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Facebook identifiers. */
@@ -421,9 +376,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromFacebookIDs(FClientGetPla
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -437,18 +390,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromFacebookIDs(FClientGetPla
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.FacebookIDs.IsEmpty() || request.FacebookIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FacebookIDs"));
-    } else {
-        TArray<FString> FacebookIDsArray;
-        FString(request.FacebookIDs).ParseIntoArray(FacebookIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("FacebookIDs"), FacebookIDsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("FacebookIDs"), request.FacebookIDs);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -466,7 +413,7 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromFacebookIDs(FPlayFabBaseModel res
         FClientGetPlayFabIDsFromFacebookIDsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromFacebookIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromFacebookIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayFabIDsFromFacebookIDs.Unbind();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Facebook Instant Game identifiers. */
@@ -476,9 +423,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromFacebookInstantGamesIds(F
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -492,18 +437,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromFacebookInstantGamesIds(F
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.FacebookInstantGamesIds.IsEmpty() || request.FacebookInstantGamesIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FacebookInstantGamesIds"));
-    } else {
-        TArray<FString> FacebookInstantGamesIdsArray;
-        FString(request.FacebookInstantGamesIds).ParseIntoArray(FacebookInstantGamesIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("FacebookInstantGamesIds"), FacebookInstantGamesIdsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("FacebookInstantGamesIds"), request.FacebookInstantGamesIds);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -521,7 +460,7 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromFacebookInstantGamesIds(FPlayFabB
         FClientGetPlayFabIDsFromFacebookInstantGamesIdsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromFacebookInstantGamesIdsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromFacebookInstantGamesIds.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayFabIDsFromFacebookInstantGamesIds.Unbind();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Game Center identifiers (referenced in the Game Center Programming Guide as the Player Identifier). */
@@ -531,9 +470,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromGameCenterIDs(FClientGetP
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -547,18 +484,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromGameCenterIDs(FClientGetP
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.GameCenterIDs.IsEmpty() || request.GameCenterIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameCenterIDs"));
-    } else {
-        TArray<FString> GameCenterIDsArray;
-        FString(request.GameCenterIDs).ParseIntoArray(GameCenterIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("GameCenterIDs"), GameCenterIDsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("GameCenterIDs"), request.GameCenterIDs);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -576,7 +507,7 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromGameCenterIDs(FPlayFabBaseModel r
         FClientGetPlayFabIDsFromGameCenterIDsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromGameCenterIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromGameCenterIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayFabIDsFromGameCenterIDs.Unbind();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of generic service identifiers. A generic identifier is the service name plus the service-specific ID for the player, as specified by the title when the generic identifier was added to the player account. */
@@ -586,9 +517,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromGenericIDs(FClientGetPlay
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -602,15 +531,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromGenericIDs(FClientGetPlay
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.GenericIDs.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("GenericIDs"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("GenericIDs"), request.GenericIDs);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObjectArray(TEXT("GenericIDs"), request.GenericIDs);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -628,7 +554,7 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromGenericIDs(FPlayFabBaseModel resp
         FClientGetPlayFabIDsFromGenericIDsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromGenericIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromGenericIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayFabIDsFromGenericIDs.Unbind();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Google identifiers. The Google identifiers are the IDs for the user accounts, available as "id" in the Google+ People API calls. */
@@ -638,9 +564,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromGoogleIDs(FClientGetPlayF
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -654,18 +578,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromGoogleIDs(FClientGetPlayF
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.GoogleIDs.IsEmpty() || request.GoogleIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GoogleIDs"));
-    } else {
-        TArray<FString> GoogleIDsArray;
-        FString(request.GoogleIDs).ParseIntoArray(GoogleIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("GoogleIDs"), GoogleIDsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("GoogleIDs"), request.GoogleIDs);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -683,7 +601,7 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromGoogleIDs(FPlayFabBaseModel respo
         FClientGetPlayFabIDsFromGoogleIDsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromGoogleIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromGoogleIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayFabIDsFromGoogleIDs.Unbind();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Kongregate identifiers. The Kongregate identifiers are the IDs for the user accounts, available as "user_id" from the Kongregate API methods(ex: http://developers.kongregate.com/docs/client/getUserId). */
@@ -693,9 +611,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromKongregateIDs(FClientGetP
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -709,18 +625,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromKongregateIDs(FClientGetP
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.KongregateIDs.IsEmpty() || request.KongregateIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KongregateIDs"));
-    } else {
-        TArray<FString> KongregateIDsArray;
-        FString(request.KongregateIDs).ParseIntoArray(KongregateIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KongregateIDs"), KongregateIDsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("KongregateIDs"), request.KongregateIDs);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -738,7 +648,7 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromKongregateIDs(FPlayFabBaseModel r
         FClientGetPlayFabIDsFromKongregateIDsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromKongregateIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromKongregateIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayFabIDsFromKongregateIDs.Unbind();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Nintendo Switch identifiers. */
@@ -748,9 +658,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(F
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -764,18 +672,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(F
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.NintendoSwitchDeviceIds.IsEmpty() || request.NintendoSwitchDeviceIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("NintendoSwitchDeviceIds"));
-    } else {
-        TArray<FString> NintendoSwitchDeviceIdsArray;
-        FString(request.NintendoSwitchDeviceIds).ParseIntoArray(NintendoSwitchDeviceIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("NintendoSwitchDeviceIds"), NintendoSwitchDeviceIdsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("NintendoSwitchDeviceIds"), request.NintendoSwitchDeviceIds);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -793,7 +695,7 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromNintendoSwitchDeviceIds(FPlayFabB
         FClientGetPlayFabIDsFromNintendoSwitchDeviceIdsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromNintendoSwitchDeviceIdsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromNintendoSwitchDeviceIds.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayFabIDsFromNintendoSwitchDeviceIds.Unbind();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of PlayStation Network identifiers. */
@@ -803,9 +705,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromPSNAccountIDs(FClientGetP
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -819,19 +719,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromPSNAccountIDs(FClientGetP
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("IssuerId"), request.IssuerId);
-    // Check to see if string is empty
-    if (request.PSNAccountIDs.IsEmpty() || request.PSNAccountIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PSNAccountIDs"));
-    } else {
-        TArray<FString> PSNAccountIDsArray;
-        FString(request.PSNAccountIDs).ParseIntoArray(PSNAccountIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("PSNAccountIDs"), PSNAccountIDsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("IssuerId"), request.IssuerId);
+    RequestWriter.WriteStringArray(TEXT("PSNAccountIDs"), request.PSNAccountIDs);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -849,7 +743,7 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromPSNAccountIDs(FPlayFabBaseModel r
         FClientGetPlayFabIDsFromPSNAccountIDsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromPSNAccountIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromPSNAccountIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayFabIDsFromPSNAccountIDs.Unbind();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Steam identifiers. The Steam identifiers are the profile IDs for the user accounts, available as SteamId in the Steamworks Community API calls. */
@@ -859,9 +753,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromSteamIDs(FClientGetPlayFa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -875,18 +767,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromSteamIDs(FClientGetPlayFa
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.SteamStringIDs.IsEmpty() || request.SteamStringIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SteamStringIDs"));
-    } else {
-        TArray<FString> SteamStringIDsArray;
-        FString(request.SteamStringIDs).ParseIntoArray(SteamStringIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("SteamStringIDs"), SteamStringIDsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("SteamStringIDs"), request.SteamStringIDs);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -904,7 +790,7 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromSteamIDs(FPlayFabBaseModel respon
         FClientGetPlayFabIDsFromSteamIDsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromSteamIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromSteamIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayFabIDsFromSteamIDs.Unbind();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Twitch identifiers. The Twitch identifiers are the IDs for the user accounts, available as "_id" from the Twitch API methods (ex: https://github.com/justintv/Twitch-API/blob/master/v3_resources/users.md#get-usersuser). */
@@ -914,9 +800,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromTwitchIDs(FClientGetPlayF
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -930,18 +814,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromTwitchIDs(FClientGetPlayF
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.TwitchIds.IsEmpty() || request.TwitchIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TwitchIds"));
-    } else {
-        TArray<FString> TwitchIdsArray;
-        FString(request.TwitchIds).ParseIntoArray(TwitchIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("TwitchIds"), TwitchIdsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("TwitchIds"), request.TwitchIds);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -959,7 +837,7 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromTwitchIDs(FPlayFabBaseModel respo
         FClientGetPlayFabIDsFromTwitchIDsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromTwitchIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromTwitchIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayFabIDsFromTwitchIDs.Unbind();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of XboxLive identifiers. */
@@ -969,9 +847,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromXboxLiveIDs(FClientGetPla
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -985,23 +861,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromXboxLiveIDs(FClientGetPla
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Sandbox.IsEmpty() || request.Sandbox == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Sandbox"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Sandbox"), request.Sandbox);
-    }
-    // Check to see if string is empty
-    if (request.XboxLiveAccountIDs.IsEmpty() || request.XboxLiveAccountIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("XboxLiveAccountIDs"));
-    } else {
-        TArray<FString> XboxLiveAccountIDsArray;
-        FString(request.XboxLiveAccountIDs).ParseIntoArray(XboxLiveAccountIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("XboxLiveAccountIDs"), XboxLiveAccountIDsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Sandbox"), request.Sandbox);
+    RequestWriter.WriteStringArray(TEXT("XboxLiveAccountIDs"), request.XboxLiveAccountIDs);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1019,7 +885,7 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromXboxLiveIDs(FPlayFabBaseModel res
         FClientGetPlayFabIDsFromXboxLiveIDsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromXboxLiveIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromXboxLiveIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayFabIDsFromXboxLiveIDs.Unbind();
 }
 
 /** Links the Android device identifier to the user's PlayFab account */
@@ -1029,9 +895,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkAndroidDeviceID(FClientLinkAndroidDevi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1045,27 +909,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkAndroidDeviceID(FClientLinkAndroidDevi
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AndroidDevice.IsEmpty() || request.AndroidDevice == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AndroidDevice"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AndroidDevice"), request.AndroidDevice);
-    }
-    if (request.AndroidDeviceId.IsEmpty() || request.AndroidDeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AndroidDeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AndroidDeviceId"), request.AndroidDeviceId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-    if (request.OS.IsEmpty() || request.OS == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OS"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OS"), request.OS);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AndroidDevice"), request.AndroidDevice);
+    RequestWriter.WriteStringOrNull(TEXT("AndroidDeviceId"), request.AndroidDeviceId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
+    RequestWriter.WriteStringOrNull(TEXT("OS"), request.OS);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1083,7 +936,7 @@ void UPlayFabClientAPI::HelperLinkAndroidDeviceID(FPlayFabBaseModel response, UO
         FClientLinkAndroidDeviceIDResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkAndroidDeviceIDResultResponse(response.responseData);
         OnSuccessLinkAndroidDeviceID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkAndroidDeviceID.Unbind();
 }
 
 /** Links the Apple account associated with the token to the user's PlayFab account. */
@@ -1093,9 +946,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkApple(FClientLinkAppleRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1109,17 +960,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkApple(FClientLinkAppleRequest request,
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-    if (request.IdentityToken.IsEmpty() || request.IdentityToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("IdentityToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("IdentityToken"), request.IdentityToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
+    RequestWriter.WriteStringOrNull(TEXT("IdentityToken"), request.IdentityToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1137,7 +985,7 @@ void UPlayFabClientAPI::HelperLinkApple(FPlayFabBaseModel response, UObject* cus
         FClientEmptyResult ResultStruct = UPlayFabClientModelDecoder::decodeEmptyResultResponse(response.responseData);
         OnSuccessLinkApple.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkApple.Unbind();
 }
 
 /** Links the custom identifier, generated by the title, to the user's PlayFab account */
@@ -1147,9 +995,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkCustomID(FClientLinkCustomIDRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1163,17 +1009,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkCustomID(FClientLinkCustomIDRequest re
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomId.IsEmpty() || request.CustomId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CustomId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CustomId"), request.CustomId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CustomId"), request.CustomId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1191,7 +1034,7 @@ void UPlayFabClientAPI::HelperLinkCustomID(FPlayFabBaseModel response, UObject*
         FClientLinkCustomIDResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkCustomIDResultResponse(response.responseData);
         OnSuccessLinkCustomID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkCustomID.Unbind();
 }
 
 /** Links the Facebook account associated with the provided Facebook access token to the user's PlayFab account */
@@ -1201,9 +1044,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkFacebookAccount(FClientLinkFacebookAcc
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1217,17 +1058,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkFacebookAccount(FClientLinkFacebookAcc
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AccessToken.IsEmpty() || request.AccessToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AccessToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AccessToken"), request.AccessToken);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AccessToken"), request.AccessToken);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1245,7 +1083,7 @@ void UPlayFabClientAPI::HelperLinkFacebookAccount(FPlayFabBaseModel response, UO
         FClientLinkFacebookAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkFacebookAccountResultResponse(response.responseData);
         OnSuccessLinkFacebookAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkFacebookAccount.Unbind();
 }
 
 /** Links the Facebook Instant Games Id to the user's PlayFab account */
@@ -1255,9 +1093,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkFacebookInstantGamesId(FClientLinkFace
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1271,17 +1107,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkFacebookInstantGamesId(FClientLinkFace
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.FacebookInstantGamesSignature.IsEmpty() || request.FacebookInstantGamesSignature == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FacebookInstantGamesSignature"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FacebookInstantGamesSignature"), request.FacebookInstantGamesSignature);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("FacebookInstantGamesSignature"), request.FacebookInstantGamesSignature);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1299,7 +1132,7 @@ void UPlayFabClientAPI::HelperLinkFacebookInstantGamesId(FPlayFabBaseModel respo
         FClientLinkFacebookInstantGamesIdResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkFacebookInstantGamesIdResultResponse(response.responseData);
         OnSuccessLinkFacebookInstantGamesId.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkFacebookInstantGamesId.Unbind();
 }
 
 /** Links the Game Center account associated with the provided Game Center ID to the user's PlayFab account. Logging in with a Game Center ID is insecure if you do not include the optional PublicKeyUrl, Salt, Signature, and Timestamp parameters in this request. It is recommended you require these parameters on all Game Center calls by going to the Apple Add-ons page in the PlayFab Game Manager and enabling the 'Require secure authentication only for this app' option. */
@@ -1309,9 +1142,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkGameCenterAccount(FClientLinkGameCente
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1325,37 +1156,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkGameCenterAccount(FClientLinkGameCente
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-    if (request.GameCenterId.IsEmpty() || request.GameCenterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameCenterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameCenterId"), request.GameCenterId);
-    }
-    if (request.PublicKeyUrl.IsEmpty() || request.PublicKeyUrl == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PublicKeyUrl"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PublicKeyUrl"), request.PublicKeyUrl);
-    }
-    if (request.Salt.IsEmpty() || request.Salt == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Salt"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Salt"), request.Salt);
-    }
-    if (request.Signature.IsEmpty() || request.Signature == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Signature"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Signature"), request.Signature);
-    }
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
+    RequestWriter.WriteStringOrNull(TEXT("GameCenterId"), request.GameCenterId);
+    RequestWriter.WriteStringOrNull(TEXT("PublicKeyUrl"), request.PublicKeyUrl);
+    RequestWriter.WriteStringOrNull(TEXT("Salt"), request.Salt);
+    RequestWriter.WriteStringOrNull(TEXT("Signature"), request.Signature);
+    RequestWriter.WriteStringOrNull(TEXT("Timestamp"), request.Timestamp);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1373,7 +1185,7 @@ void UPlayFabClientAPI::HelperLinkGameCenterAccount(FPlayFabBaseModel response,
         FClientLinkGameCenterAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkGameCenterAccountResultResponse(response.responseData);
         OnSuccessLinkGameCenterAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkGameCenterAccount.Unbind();
 }
 
 /** Links the currently signed-in user account to their Google account, using their Google account credentials */
@@ -1383,9 +1195,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkGoogleAccount(FClientLinkGoogleAccount
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1399,17 +1209,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkGoogleAccount(FClientLinkGoogleAccount
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-    if (request.ServerAuthCode.IsEmpty() || request.ServerAuthCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ServerAuthCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ServerAuthCode"), request.ServerAuthCode);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
+    RequestWriter.WriteStringOrNull(TEXT("ServerAuthCode"), request.ServerAuthCode);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1427,7 +1234,7 @@ void UPlayFabClientAPI::HelperLinkGoogleAccount(FPlayFabBaseModel response, UObj
         FClientLinkGoogleAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkGoogleAccountResultResponse(response.responseData);
         OnSuccessLinkGoogleAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkGoogleAccount.Unbind();
 }
 
 /** Links the vendor-specific iOS device identifier to the user's PlayFab account */
@@ -1437,9 +1244,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkIOSDeviceID(FClientLinkIOSDeviceIDRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1453,27 +1258,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkIOSDeviceID(FClientLinkIOSDeviceIDRequ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.DeviceId.IsEmpty() || request.DeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceId"), request.DeviceId);
-    }
-    if (request.DeviceModel.IsEmpty() || request.DeviceModel == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceModel"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceModel"), request.DeviceModel);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-    if (request.OS.IsEmpty() || request.OS == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OS"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OS"), request.OS);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("DeviceId"), request.DeviceId);
+    RequestWriter.WriteStringOrNull(TEXT("DeviceModel"), request.DeviceModel);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
+    RequestWriter.WriteStringOrNull(TEXT("OS"), request.OS);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1491,7 +1285,7 @@ void UPlayFabClientAPI::HelperLinkIOSDeviceID(FPlayFabBaseModel response, UObjec
         FClientLinkIOSDeviceIDResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkIOSDeviceIDResultResponse(response.responseData);
         OnSuccessLinkIOSDeviceID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkIOSDeviceID.Unbind();
 }
 
 /** Links the Kongregate identifier to the user's PlayFab account */
@@ -1501,9 +1295,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkKongregate(FClientLinkKongregateAccoun
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1517,22 +1309,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkKongregate(FClientLinkKongregateAccoun
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AuthTicket.IsEmpty() || request.AuthTicket == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AuthTicket"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AuthTicket"), request.AuthTicket);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-    if (request.KongregateId.IsEmpty() || request.KongregateId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KongregateId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("KongregateId"), request.KongregateId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AuthTicket"), request.AuthTicket);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
+    RequestWriter.WriteStringOrNull(TEXT("KongregateId"), request.KongregateId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1550,7 +1335,7 @@ void UPlayFabClientAPI::HelperLinkKongregate(FPlayFabBaseModel response, UObject
         FClientLinkKongregateAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkKongregateAccountResultResponse(response.responseData);
         OnSuccessLinkKongregate.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkKongregate.Unbind();
 }
 
 /** Links the Nintendo account associated with the token to the user's PlayFab account. */
@@ -1560,9 +1345,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkNintendoServiceAccount(FClientLinkNint
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1576,17 +1359,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkNintendoServiceAccount(FClientLinkNint
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-    if (request.IdentityToken.IsEmpty() || request.IdentityToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("IdentityToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("IdentityToken"), request.IdentityToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
+    RequestWriter.WriteStringOrNull(TEXT("IdentityToken"), request.IdentityToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1602,10 +1382,10 @@ void UPlayFabClientAPI::HelperLinkNintendoServiceAccount(FPlayFabBaseModel respo
     else if (!error.hasError && OnSuccessLinkNintendoServiceAccount.IsBound())
     {
         FClientEmptyResult ResultStruct = UPlayFabClientModelDecoder::decodeEmptyResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessLinkNintendoServiceAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkNintendoServiceAccount.Unbind();
 }
 
 /** Links the NintendoSwitchDeviceId to the user's PlayFab account */
@@ -1615,9 +1395,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkNintendoSwitchDeviceId(FClientLinkNint
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1631,17 +1409,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkNintendoSwitchDeviceId(FClientLinkNint
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-    if (request.NintendoSwitchDeviceId.IsEmpty() || request.NintendoSwitchDeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("NintendoSwitchDeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("NintendoSwitchDeviceId"), request.NintendoSwitchDeviceId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
+    RequestWriter.WriteStringOrNull(TEXT("NintendoSwitchDeviceId"), request.NintendoSwitchDeviceId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1659,7 +1434,7 @@ void UPlayFabClientAPI::HelperLinkNintendoSwitchDeviceId(FPlayFabBaseModel respo
         FClientLinkNintendoSwitchDeviceIdResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkNintendoSwitchDeviceIdResultResponse(response.responseData);
         OnSuccessLinkNintendoSwitchDeviceId.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkNintendoSwitchDeviceId.Unbind();
 }
 
 /** Links an OpenID Connect account to a user's PlayFab account, based on an existing relationship between a title and an Open ID Connect provider and the OpenId Connect JWT from that provider. */
@@ -1669,9 +1444,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkOpenIdConnect(FClientLinkOpenIdConnect
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1685,22 +1458,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkOpenIdConnect(FClientLinkOpenIdConnect
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.ConnectionId.IsEmpty() || request.ConnectionId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ConnectionId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ConnectionId"), request.ConnectionId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-    if (request.IdToken.IsEmpty() || request.IdToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("IdToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("IdToken"), request.IdToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("ConnectionId"), request.ConnectionId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
+    RequestWriter.WriteStringOrNull(TEXT("IdToken"), request.IdToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1716,10 +1482,10 @@ void UPlayFabClientAPI::HelperLinkOpenIdConnect(FPlayFabBaseModel response, UObj
     else if (!error.hasError && OnSuccessLinkOpenIdConnect.IsBound())
     {
         FClientEmptyResult ResultStruct = UPlayFabClientModelDecoder::decodeEmptyResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessLinkOpenIdConnect.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkOpenIdConnect.Unbind();
 }
 
 /** Links the PlayStation Network account associated with the provided access code to the user's PlayFab account */
@@ -1729,9 +1495,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkPSNAccount(FClientLinkPSNAccountReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1745,23 +1509,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkPSNAccount(FClientLinkPSNAccountReques
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AuthCode.IsEmpty() || request.AuthCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AuthCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AuthCode"), request.AuthCode);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-    OutRestJsonObj->SetNumberField(TEXT("IssuerId"), request.IssuerId);
-    if (request.RedirectUri.IsEmpty() || request.RedirectUri == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RedirectUri"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("RedirectUri"), request.RedirectUri);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AuthCode"), request.AuthCode);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
+    RequestWriter.WriteNumber(TEXT("IssuerId"), request.IssuerId);
+    RequestWriter.WriteStringOrNull(TEXT("RedirectUri"), request.RedirectUri);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1779,7 +1536,7 @@ void UPlayFabClientAPI::HelperLinkPSNAccount(FPlayFabBaseModel response, UObject
         FClientLinkPSNAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkPSNAccountResultResponse(response.responseData);
         OnSuccessLinkPSNAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkPSNAccount.Unbind();
 }
 
 /** Links the Steam account associated with the provided Steam authentication ticket to the user's PlayFab account */
@@ -1789,9 +1546,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkSteamAccount(FClientLinkSteamAccountRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1805,17 +1560,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkSteamAccount(FClientLinkSteamAccountRe
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-    if (request.SteamTicket.IsEmpty() || request.SteamTicket == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SteamTicket"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SteamTicket"), request.SteamTicket);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
+    RequestWriter.WriteStringOrNull(TEXT("SteamTicket"), request.SteamTicket);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1833,7 +1585,7 @@ void UPlayFabClientAPI::HelperLinkSteamAccount(FPlayFabBaseModel response, UObje
         FClientLinkSteamAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkSteamAccountResultResponse(response.responseData);
         OnSuccessLinkSteamAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkSteamAccount.Unbind();
 }
 
 /** Links the Twitch account associated with the token to the user's PlayFab account. */
@@ -1843,9 +1595,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkTwitch(FClientLinkTwitchAccountRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1859,17 +1609,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkTwitch(FClientLinkTwitchAccountRequest
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AccessToken.IsEmpty() || request.AccessToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AccessToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AccessToken"), request.AccessToken);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AccessToken"), request.AccessToken);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1887,7 +1634,7 @@ void UPlayFabClientAPI::HelperLinkTwitch(FPlayFabBaseModel response, UObject* cu
         FClientLinkTwitchAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkTwitchAccountResultResponse(response.responseData);
         OnSuccessLinkTwitch.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkTwitch.Unbind();
 }
 
 /** Link Windows Hello authentication to the current PlayFab Account */
@@ -1897,9 +1644,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkWindowsHello(FClientLinkWindowsHelloAc
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1913,27 +1658,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkWindowsHello(FClientLinkWindowsHelloAc
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.DeviceName.IsEmpty() || request.DeviceName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceName"), request.DeviceName);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-    if (request.PublicKey.IsEmpty() || request.PublicKey == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PublicKey"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PublicKey"), request.PublicKey);
-    }
-    if (request.UserName.IsEmpty() || request.UserName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("UserName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("UserName"), request.UserName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("DeviceName"), request.DeviceName);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
+    RequestWriter.WriteStringOrNull(TEXT("PublicKey"), request.PublicKey);
+    RequestWriter.WriteStringOrNull(TEXT("UserName"), request.UserName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1951,7 +1685,7 @@ void UPlayFabClientAPI::HelperLinkWindowsHello(FPlayFabBaseModel response, UObje
         FClientLinkWindowsHelloAccountResponse ResultStruct = UPlayFabClientModelDecoder::decodeLinkWindowsHelloAccountResponseResponse(response.responseData);
         OnSuccessLinkWindowsHello.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkWindowsHello.Unbind();
 }
 
 /** Links the Xbox Live account associated with the provided access code to the user's PlayFab account */
@@ -1961,9 +1695,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkXboxAccount(FClientLinkXboxAccountRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1977,17 +1709,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkXboxAccount(FClientLinkXboxAccountRequ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-    if (request.XboxToken.IsEmpty() || request.XboxToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("XboxToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("XboxToken"), request.XboxToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
+    RequestWriter.WriteStringOrNull(TEXT("XboxToken"), request.XboxToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2005,7 +1734,7 @@ void UPlayFabClientAPI::HelperLinkXboxAccount(FPlayFabBaseModel response, UObjec
         FClientLinkXboxAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeLinkXboxAccountResultResponse(response.responseData);
         OnSuccessLinkXboxAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkXboxAccount.Unbind();
 }
 
 /** Removes a contact email from the player's profile. */
@@ -2015,9 +1744,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveContactEmail(FClientRemoveContactEma
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2031,11 +1758,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveContactEmail(FClientRemoveContactEma
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2053,7 +1781,7 @@ void UPlayFabClientAPI::HelperRemoveContactEmail(FPlayFabBaseModel response, UOb
         FClientRemoveContactEmailResult ResultStruct = UPlayFabClientModelDecoder::decodeRemoveContactEmailResultResponse(response.responseData);
         OnSuccessRemoveContactEmail.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRemoveContactEmail.Unbind();
 }
 
 /** Removes the specified generic service identifier from the player's PlayFab account. */
@@ -2063,9 +1791,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveGenericID(FClientRemoveGenericIDRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2079,11 +1805,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveGenericID(FClientRemoveGenericIDRequ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.GenericId != nullptr) OutRestJsonObj->SetObjectField(TEXT("GenericId"), request.GenericId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("GenericId"), request.GenericId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2101,7 +1828,7 @@ void UPlayFabClientAPI::HelperRemoveGenericID(FPlayFabBaseModel response, UObjec
         FClientRemoveGenericIDResult ResultStruct = UPlayFabClientModelDecoder::decodeRemoveGenericIDResultResponse(response.responseData);
         OnSuccessRemoveGenericID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRemoveGenericID.Unbind();
 }
 
 /** Submit a report for another player (due to bad bahavior, etc.), so that customer service representatives for the title can take action concerning potentially toxic players. */
@@ -2111,9 +1838,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::ReportPlayer(FClientReportPlayerClientRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2127,21 +1852,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::ReportPlayer(FClientReportPlayerClientRequ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Comment.IsEmpty() || request.Comment == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Comment"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Comment"), request.Comment);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ReporteeId.IsEmpty() || request.ReporteeId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReporteeId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReporteeId"), request.ReporteeId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Comment"), request.Comment);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ReporteeId"), request.ReporteeId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2159,7 +1877,7 @@ void UPlayFabClientAPI::HelperReportPlayer(FPlayFabBaseModel response, UObject*
         FClientReportPlayerClientResult ResultStruct = UPlayFabClientModelDecoder::decodeReportPlayerClientResultResponse(response.responseData);
         OnSuccessReportPlayer.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessReportPlayer.Unbind();
 }
 
 /** Forces an email to be sent to the registered email address for the user's account, with a link allowing the user to change the password.If an account recovery email template ID is provided, an email using the custom email template will be used. */
@@ -2169,9 +1887,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::SendAccountRecoveryEmail(FClientSendAccoun
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2184,22 +1900,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::SendAccountRecoveryEmail(FClientSendAccoun
     manager->PlayFabRequestURL = "/Client/SendAccountRecoveryEmail";
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    if (request.EmailTemplateId.IsEmpty() || request.EmailTemplateId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EmailTemplateId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EmailTemplateId"), request.EmailTemplateId);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Email"), request.Email);
+    RequestWriter.WriteStringOrNull(TEXT("EmailTemplateId"), request.EmailTemplateId);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2217,7 +1926,7 @@ void UPlayFabClientAPI::HelperSendAccountRecoveryEmail(FPlayFabBaseModel respons
         FClientSendAccountRecoveryEmailResult ResultStruct = UPlayFabClientModelDecoder::decodeSendAccountRecoveryEmailResultResponse(response.responseData);
         OnSuccessSendAccountRecoveryEmail.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSendAccountRecoveryEmail.Unbind();
 }
 
 /** Unlinks the related Android device identifier from the user's PlayFab account */
@@ -2227,9 +1936,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkAndroidDeviceID(FClientUnlinkAndroid
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2243,16 +1950,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkAndroidDeviceID(FClientUnlinkAndroid
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AndroidDeviceId.IsEmpty() || request.AndroidDeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AndroidDeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AndroidDeviceId"), request.AndroidDeviceId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AndroidDeviceId"), request.AndroidDeviceId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2270,7 +1974,7 @@ void UPlayFabClientAPI::HelperUnlinkAndroidDeviceID(FPlayFabBaseModel response,
         FClientUnlinkAndroidDeviceIDResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkAndroidDeviceIDResultResponse(response.responseData);
         OnSuccessUnlinkAndroidDeviceID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkAndroidDeviceID.Unbind();
 }
 
 /** Unlinks the related Apple account from the user's PlayFab account. */
@@ -2280,9 +1984,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkApple(FClientUnlinkAppleRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2296,11 +1998,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkApple(FClientUnlinkAppleRequest requ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2318,7 +2021,7 @@ void UPlayFabClientAPI::HelperUnlinkApple(FPlayFabBaseModel response, UObject* c
         FClientEmptyResponse ResultStruct = UPlayFabClientModelDecoder::decodeEmptyResponseResponse(response.responseData);
         OnSuccessUnlinkApple.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkApple.Unbind();
 }
 
 /** Unlinks the related custom identifier from the user's PlayFab account */
@@ -2328,9 +2031,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkCustomID(FClientUnlinkCustomIDReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2344,16 +2045,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkCustomID(FClientUnlinkCustomIDReques
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomId.IsEmpty() || request.CustomId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CustomId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CustomId"), request.CustomId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CustomId"), request.CustomId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2371,7 +2069,7 @@ void UPlayFabClientAPI::HelperUnlinkCustomID(FPlayFabBaseModel response, UObject
         FClientUnlinkCustomIDResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkCustomIDResultResponse(response.responseData);
         OnSuccessUnlinkCustomID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkCustomID.Unbind();
 }
 
 /** Unlinks the related Facebook account from the user's PlayFab account */
@@ -2381,9 +2079,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkFacebookAccount(FClientUnlinkFaceboo
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2397,11 +2093,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkFacebookAccount(FClientUnlinkFaceboo
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2419,7 +2116,7 @@ void UPlayFabClientAPI::HelperUnlinkFacebookAccount(FPlayFabBaseModel response,
         FClientUnlinkFacebookAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkFacebookAccountResultResponse(response.responseData);
         OnSuccessUnlinkFacebookAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkFacebookAccount.Unbind();
 }
 
 /** Unlinks the related Facebook Instant Game Ids from the user's PlayFab account */
@@ -2429,9 +2126,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkFacebookInstantGamesId(FClientUnlink
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2445,16 +2140,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkFacebookInstantGamesId(FClientUnlink
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.FacebookInstantGamesId.IsEmpty() || request.FacebookInstantGamesId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FacebookInstantGamesId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FacebookInstantGamesId"), request.FacebookInstantGamesId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("FacebookInstantGamesId"), request.FacebookInstantGamesId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2472,7 +2164,7 @@ void UPlayFabClientAPI::HelperUnlinkFacebookInstantGamesId(FPlayFabBaseModel res
         FClientUnlinkFacebookInstantGamesIdResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkFacebookInstantGamesIdResultResponse(response.responseData);
         OnSuccessUnlinkFacebookInstantGamesId.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkFacebookInstantGamesId.Unbind();
 }
 
 /** Unlinks the related Game Center account from the user's PlayFab account */
@@ -2482,9 +2174,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkGameCenterAccount(FClientUnlinkGameC
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2498,11 +2188,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkGameCenterAccount(FClientUnlinkGameC
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2520,7 +2211,7 @@ void UPlayFabClientAPI::HelperUnlinkGameCenterAccount(FPlayFabBaseModel response
         FClientUnlinkGameCenterAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkGameCenterAccountResultResponse(response.responseData);
         OnSuccessUnlinkGameCenterAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkGameCenterAccount.Unbind();
 }
 
 /** Unlinks the related Google account from the user's PlayFab account (https://developers.google.com/android/reference/com/google/android/gms/auth/GoogleAuthUtil#public-methods). */
@@ -2530,9 +2221,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkGoogleAccount(FClientUnlinkGoogleAcc
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2546,11 +2235,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkGoogleAccount(FClientUnlinkGoogleAcc
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2568,7 +2258,7 @@ void UPlayFabClientAPI::HelperUnlinkGoogleAccount(FPlayFabBaseModel response, UO
         FClientUnlinkGoogleAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkGoogleAccountResultResponse(response.responseData);
         OnSuccessUnlinkGoogleAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkGoogleAccount.Unbind();
 }
 
 /** Unlinks the related iOS device identifier from the user's PlayFab account */
@@ -2578,9 +2268,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkIOSDeviceID(FClientUnlinkIOSDeviceID
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2594,16 +2282,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkIOSDeviceID(FClientUnlinkIOSDeviceID
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.DeviceId.IsEmpty() || request.DeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceId"), request.DeviceId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("DeviceId"), request.DeviceId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2621,7 +2306,7 @@ void UPlayFabClientAPI::HelperUnlinkIOSDeviceID(FPlayFabBaseModel response, UObj
         FClientUnlinkIOSDeviceIDResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkIOSDeviceIDResultResponse(response.responseData);
         OnSuccessUnlinkIOSDeviceID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkIOSDeviceID.Unbind();
 }
 
 /** Unlinks the related Kongregate identifier from the user's PlayFab account */
@@ -2631,9 +2316,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkKongregate(FClientUnlinkKongregateAc
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2647,11 +2330,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkKongregate(FClientUnlinkKongregateAc
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2669,7 +2353,7 @@ void UPlayFabClientAPI::HelperUnlinkKongregate(FPlayFabBaseModel response, UObje
         FClientUnlinkKongregateAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkKongregateAccountResultResponse(response.responseData);
         OnSuccessUnlinkKongregate.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkKongregate.Unbind();
 }
 
 /** Unlinks the related Nintendo account from the user's PlayFab account. */
@@ -2679,9 +2363,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkNintendoServiceAccount(FClientUnlink
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2695,11 +2377,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkNintendoServiceAccount(FClientUnlink
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2715,10 +2398,10 @@ void UPlayFabClientAPI::HelperUnlinkNintendoServiceAccount(FPlayFabBaseModel res
     else if (!error.hasError && OnSuccessUnlinkNintendoServiceAccount.IsBound())
     {
         FClientEmptyResponse ResultStruct = UPlayFabClientModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUnlinkNintendoServiceAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkNintendoServiceAccount.Unbind();
 }
 
 /** Unlinks the related NintendoSwitchDeviceId from the user's PlayFab account */
@@ -2728,9 +2411,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkNintendoSwitchDeviceId(FClientUnlink
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2744,16 +2425,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkNintendoSwitchDeviceId(FClientUnlink
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.NintendoSwitchDeviceId.IsEmpty() || request.NintendoSwitchDeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("NintendoSwitchDeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("NintendoSwitchDeviceId"), request.NintendoSwitchDeviceId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("NintendoSwitchDeviceId"), request.NintendoSwitchDeviceId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2771,7 +2449,7 @@ void UPlayFabClientAPI::HelperUnlinkNintendoSwitchDeviceId(FPlayFabBaseModel res
         FClientUnlinkNintendoSwitchDeviceIdResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkNintendoSwitchDeviceIdResultResponse(response.responseData);
         OnSuccessUnlinkNintendoSwitchDeviceId.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkNintendoSwitchDeviceId.Unbind();
 }
 
 /** Unlinks an OpenID Connect account from a user's PlayFab account, based on the connection ID of an existing relationship between a title and an Open ID Connect provider. */
@@ -2781,9 +2459,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkOpenIdConnect(FClientUnlinkOpenIdCon
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2797,16 +2473,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkOpenIdConnect(FClientUnlinkOpenIdCon
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.ConnectionId.IsEmpty() || request.ConnectionId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ConnectionId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ConnectionId"), request.ConnectionId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("ConnectionId"), request.ConnectionId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2822,10 +2495,10 @@ void UPlayFabClientAPI::HelperUnlinkOpenIdConnect(FPlayFabBaseModel response, UO
     else if (!error.hasError && OnSuccessUnlinkOpenIdConnect.IsBound())
     {
         FClientEmptyResponse ResultStruct = UPlayFabClientModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUnlinkOpenIdConnect.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkOpenIdConnect.Unbind();
 }
 
 /** Unlinks the related PSN account from the user's PlayFab account */
@@ -2835,9 +2508,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkPSNAccount(FClientUnlinkPSNAccountRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2851,11 +2522,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkPSNAccount(FClientUnlinkPSNAccountRe
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2873,7 +2545,7 @@ void UPlayFabClientAPI::HelperUnlinkPSNAccount(FPlayFabBaseModel response, UObje
         FClientUnlinkPSNAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkPSNAccountResultResponse(response.responseData);
         OnSuccessUnlinkPSNAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkPSNAccount.Unbind();
 }
 
 /** Unlinks the related Steam account from the user's PlayFab account */
@@ -2883,9 +2555,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkSteamAccount(FClientUnlinkSteamAccou
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2899,11 +2569,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkSteamAccount(FClientUnlinkSteamAccou
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2921,7 +2592,7 @@ void UPlayFabClientAPI::HelperUnlinkSteamAccount(FPlayFabBaseModel response, UOb
         FClientUnlinkSteamAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkSteamAccountResultResponse(response.responseData);
         OnSuccessUnlinkSteamAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkSteamAccount.Unbind();
 }
 
 /** Unlinks the related Twitch account from the user's PlayFab account. */
@@ -2931,9 +2602,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkTwitch(FClientUnlinkTwitchAccountReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2947,16 +2616,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkTwitch(FClientUnlinkTwitchAccountReq
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AccessToken.IsEmpty() || request.AccessToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AccessToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AccessToken"), request.AccessToken);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AccessToken"), request.AccessToken);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2974,7 +2640,7 @@ void UPlayFabClientAPI::HelperUnlinkTwitch(FPlayFabBaseModel response, UObject*
         FClientUnlinkTwitchAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkTwitchAccountResultResponse(response.responseData);
         OnSuccessUnlinkTwitch.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkTwitch.Unbind();
 }
 
 /** Unlink Windows Hello authentication from the current PlayFab Account */
@@ -2984,9 +2650,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkWindowsHello(FClientUnlinkWindowsHel
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3000,16 +2664,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkWindowsHello(FClientUnlinkWindowsHel
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PublicKeyHint.IsEmpty() || request.PublicKeyHint == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PublicKeyHint"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PublicKeyHint"), request.PublicKeyHint);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PublicKeyHint"), request.PublicKeyHint);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3027,7 +2688,7 @@ void UPlayFabClientAPI::HelperUnlinkWindowsHello(FPlayFabBaseModel response, UOb
         FClientUnlinkWindowsHelloAccountResponse ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkWindowsHelloAccountResponseResponse(response.responseData);
         OnSuccessUnlinkWindowsHello.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkWindowsHello.Unbind();
 }
 
 /** Unlinks the related Xbox Live account from the user's PlayFab account */
@@ -3037,9 +2698,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkXboxAccount(FClientUnlinkXboxAccount
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3053,11 +2712,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkXboxAccount(FClientUnlinkXboxAccount
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3075,7 +2735,7 @@ void UPlayFabClientAPI::HelperUnlinkXboxAccount(FPlayFabBaseModel response, UObj
         FClientUnlinkXboxAccountResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlinkXboxAccountResultResponse(response.responseData);
         OnSuccessUnlinkXboxAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkXboxAccount.Unbind();
 }
 
 /** Update the avatar URL of the player */
@@ -3085,9 +2745,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateAvatarUrl(FClientUpdateAvatarUrlRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3101,15 +2759,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateAvatarUrl(FClientUpdateAvatarUrlRequ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.ImageUrl.IsEmpty() || request.ImageUrl == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ImageUrl"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ImageUrl"), request.ImageUrl);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("ImageUrl"), request.ImageUrl);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3125,10 +2780,10 @@ void UPlayFabClientAPI::HelperUpdateAvatarUrl(FPlayFabBaseModel response, UObjec
     else if (!error.hasError && OnSuccessUpdateAvatarUrl.IsBound())
     {
         FClientEmptyResponse ResultStruct = UPlayFabClientModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateAvatarUrl.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateAvatarUrl.Unbind();
 }
 
 /** Updates the title specific display name for the user */
@@ -3138,9 +2793,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateUserTitleDisplayName(FClientUpdateUs
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3154,16 +2807,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateUserTitleDisplayName(FClientUpdateUs
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.DisplayName.IsEmpty() || request.DisplayName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DisplayName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DisplayName"), request.DisplayName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("DisplayName"), request.DisplayName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3181,7 +2831,7 @@ void UPlayFabClientAPI::HelperUpdateUserTitleDisplayName(FPlayFabBaseModel respo
         FClientUpdateUserTitleDisplayNameResult ResultStruct = UPlayFabClientModelDecoder::decodeUpdateUserTitleDisplayNameResultResponse(response.responseData);
         OnSuccessUpdateUserTitleDisplayName.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateUserTitleDisplayName.Unbind();
 }
 
 
@@ -3196,9 +2846,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetAdPlacements(FClientGetAdPlacementsRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3212,16 +2860,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetAdPlacements(FClientGetAdPlacementsRequ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AppId.IsEmpty() || request.AppId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AppId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AppId"), request.AppId);
-    }
-    if (request.Identifier != nullptr) OutRestJsonObj->SetObjectField(TEXT("Identifier"), request.Identifier);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AppId"), request.AppId);
+    RequestWriter.WriteObject(TEXT("Identifier"), request.Identifier);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3239,7 +2884,7 @@ void UPlayFabClientAPI::HelperGetAdPlacements(FPlayFabBaseModel response, UObjec
         FClientGetAdPlacementsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetAdPlacementsResultResponse(response.responseData);
         OnSuccessGetAdPlacements.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetAdPlacements.Unbind();
 }
 
 /** Report player's ad activity */
@@ -3249,9 +2894,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::ReportAdActivity(FClientReportAdActivityRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3265,24 +2908,17 @@ UPlayFabClientAPI* UPlayFabClientAPI::ReportAdActivity(FClientReportAdActivityRe
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
     FString temp_Activity;
     if (GetEnumValueToString<EAdActivity>(TEXT("EAdActivity"), request.Activity, temp_Activity))
-        OutRestJsonObj->SetStringField(TEXT("Activity"), temp_Activity);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlacementId.IsEmpty() || request.PlacementId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlacementId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlacementId"), request.PlacementId);
-    }
-    if (request.RewardId.IsEmpty() || request.RewardId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RewardId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("RewardId"), request.RewardId);
-    }
+        RequestWriter.WriteString(TEXT("Activity"), temp_Activity);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlacementId"), request.PlacementId);
+    RequestWriter.WriteStringOrNull(TEXT("RewardId"), request.RewardId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3300,7 +2936,7 @@ void UPlayFabClientAPI::HelperReportAdActivity(FPlayFabBaseModel response, UObje
         FClientReportAdActivityResult ResultStruct = UPlayFabClientModelDecoder::decodeReportAdActivityResultResponse(response.responseData);
         OnSuccessReportAdActivity.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessReportAdActivity.Unbind();
 }
 
 /** Reward player's ad activity */
@@ -3310,9 +2946,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::RewardAdActivity(FClientRewardAdActivityRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3326,21 +2960,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::RewardAdActivity(FClientRewardAdActivityRe
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlacementId.IsEmpty() || request.PlacementId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlacementId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlacementId"), request.PlacementId);
-    }
-    if (request.RewardId.IsEmpty() || request.RewardId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RewardId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("RewardId"), request.RewardId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlacementId"), request.PlacementId);
+    RequestWriter.WriteStringOrNull(TEXT("RewardId"), request.RewardId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3358,7 +2985,7 @@ void UPlayFabClientAPI::HelperRewardAdActivity(FPlayFabBaseModel response, UObje
         FClientRewardAdActivityResult ResultStruct = UPlayFabClientModelDecoder::decodeRewardAdActivityResultResponse(response.responseData);
         OnSuccessRewardAdActivity.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRewardAdActivity.Unbind();
 }
 
 
@@ -3372,9 +2999,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::ReportDeviceInfo(FClientDeviceInfoRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3388,11 +3013,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::ReportDeviceInfo(FClientDeviceInfoRequest
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Info != nullptr) OutRestJsonObj->SetObjectField(TEXT("Info"), request.Info);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("Info"), request.Info);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3408,10 +3034,10 @@ void UPlayFabClientAPI::HelperReportDeviceInfo(FPlayFabBaseModel response, UObje
     else if (!error.hasError && OnSuccessReportDeviceInfo.IsBound())
     {
         FClientEmptyResponse ResultStruct = UPlayFabClientModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessReportDeviceInfo.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessReportDeviceInfo.Unbind();
 }
 
 /** Writes a character-based event into PlayStream. */
@@ -3421,9 +3047,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::WriteCharacterEvent(FClientWriteClientChar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3437,27 +3061,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::WriteCharacterEvent(FClientWriteClientChar
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Body != nullptr) OutRestJsonObj->SetObjectField(TEXT("Body"), request.Body);
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EventName.IsEmpty() || request.EventName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EventName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EventName"), request.EventName);
-    }
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("Body"), request.Body);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EventName"), request.EventName);
+    RequestWriter.WriteStringOrNull(TEXT("Timestamp"), request.Timestamp);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3475,7 +3088,7 @@ void UPlayFabClientAPI::HelperWriteCharacterEvent(FPlayFabBaseModel response, UO
         FClientWriteEventResponse ResultStruct = UPlayFabClientModelDecoder::decodeWriteEventResponseResponse(response.responseData);
         OnSuccessWriteCharacterEvent.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessWriteCharacterEvent.Unbind();
 }
 
 /** Writes a player-based event into PlayStream. */
@@ -3485,9 +3098,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::WritePlayerEvent(FClientWriteClientPlayerE
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3501,22 +3112,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::WritePlayerEvent(FClientWriteClientPlayerE
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Body != nullptr) OutRestJsonObj->SetObjectField(TEXT("Body"), request.Body);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EventName.IsEmpty() || request.EventName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EventName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EventName"), request.EventName);
-    }
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("Body"), request.Body);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EventName"), request.EventName);
+    RequestWriter.WriteStringOrNull(TEXT("Timestamp"), request.Timestamp);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3532,10 +3136,10 @@ void UPlayFabClientAPI::HelperWritePlayerEvent(FPlayFabBaseModel response, UObje
     else if (!error.hasError && OnSuccessWritePlayerEvent.IsBound())
     {
         FClientWriteEventResponse ResultStruct = UPlayFabClientModelDecoder::decodeWriteEventResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessWritePlayerEvent.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessWritePlayerEvent.Unbind();
 }
 
 /** Writes a title-based event into PlayStream. */
@@ -3545,9 +3149,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::WriteTitleEvent(FClientWriteTitleEventRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3561,22 +3163,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::WriteTitleEvent(FClientWriteTitleEventRequ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Body != nullptr) OutRestJsonObj->SetObjectField(TEXT("Body"), request.Body);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EventName.IsEmpty() || request.EventName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EventName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EventName"), request.EventName);
-    }
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("Body"), request.Body);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EventName"), request.EventName);
+    RequestWriter.WriteStringOrNull(TEXT("Timestamp"), request.Timestamp);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3592,10 +3187,10 @@ void UPlayFabClientAPI::HelperWriteTitleEvent(FPlayFabBaseModel response, UObjec
     else if (!error.hasError && OnSuccessWriteTitleEvent.IsBound())
     {
         FClientWriteEventResponse ResultStruct = UPlayFabClientModelDecoder::decodeWriteEventResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessWriteTitleEvent.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessWriteTitleEvent.Unbind();
 }
 
 
@@ -3609,9 +3204,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPhotonAuthenticationToken(FClientGetPho
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3625,15 +3218,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPhotonAuthenticationToken(FClientGetPho
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.PhotonApplicationId.IsEmpty() || request.PhotonApplicationId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PhotonApplicationId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PhotonApplicationId"), request.PhotonApplicationId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("PhotonApplicationId"), request.PhotonApplicationId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3651,7 +3241,7 @@ void UPlayFabClientAPI::HelperGetPhotonAuthenticationToken(FPlayFabBaseModel res
         FClientGetPhotonAuthenticationTokenResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPhotonAuthenticationTokenResultResponse(response.responseData);
         OnSuccessGetPhotonAuthenticationToken.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPhotonAuthenticationToken.Unbind();
 }
 
 /** Returns the title's base 64 encoded RSA CSP blob. */
@@ -3661,9 +3251,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTitlePublicKey(FClientGetTitlePublicKey
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3676,16 +3264,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTitlePublicKey(FClientGetTitlePublicKey
     manager->PlayFabRequestURL = "/Client/GetTitlePublicKey";
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
-    if (request.TitleSharedSecret.IsEmpty() || request.TitleSharedSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TitleSharedSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TitleSharedSecret"), request.TitleSharedSecret);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    RequestWriter.WriteStringOrNull(TEXT("TitleSharedSecret"), request.TitleSharedSecret);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3703,7 +3288,7 @@ void UPlayFabClientAPI::HelperGetTitlePublicKey(FPlayFabBaseModel response, UObj
         FClientGetTitlePublicKeyResult ResultStruct = UPlayFabClientModelDecoder::decodeGetTitlePublicKeyResultResponse(response.responseData);
         OnSuccessGetTitlePublicKey.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetTitlePublicKey.Unbind();
 }
 
 /** Requests a challenge from the server to be signed by Windows Hello Passport service to authenticate. */
@@ -3713,9 +3298,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetWindowsHelloChallenge(FClientGetWindows
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3728,16 +3311,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetWindowsHelloChallenge(FClientGetWindows
     manager->PlayFabRequestURL = "/Client/GetWindowsHelloChallenge";
 
 
-    // Serialize all the request properties to json
-    if (request.PublicKeyHint.IsEmpty() || request.PublicKeyHint == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PublicKeyHint"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PublicKeyHint"), request.PublicKeyHint);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("PublicKeyHint"), request.PublicKeyHint);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3755,7 +3335,7 @@ void UPlayFabClientAPI::HelperGetWindowsHelloChallenge(FPlayFabBaseModel respons
         FClientGetWindowsHelloChallengeResponse ResultStruct = UPlayFabClientModelDecoder::decodeGetWindowsHelloChallengeResponseResponse(response.responseData);
         OnSuccessGetWindowsHelloChallenge.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetWindowsHelloChallenge.Unbind();
 }
 
 /** Signs the user in using the Android device identifier, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -3765,9 +3345,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithAndroidDeviceID(FClientLoginWithA
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3781,39 +3359,20 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithAndroidDeviceID(FClientLoginWithA
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AndroidDevice.IsEmpty() || request.AndroidDevice == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AndroidDevice"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AndroidDevice"), request.AndroidDevice);
-    }
-    if (request.AndroidDeviceId.IsEmpty() || request.AndroidDeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AndroidDeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AndroidDeviceId"), request.AndroidDeviceId);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.OS.IsEmpty() || request.OS == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OS"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OS"), request.OS);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AndroidDevice"), request.AndroidDevice);
+    RequestWriter.WriteStringOrNull(TEXT("AndroidDeviceId"), request.AndroidDeviceId);
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("OS"), request.OS);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3831,7 +3390,7 @@ void UPlayFabClientAPI::HelperLoginWithAndroidDeviceID(FPlayFabBaseModel respons
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
         OnSuccessLoginWithAndroidDeviceID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithAndroidDeviceID.Unbind();
 }
 
 /** Signs in the user with a Sign in with Apple identity token. */
@@ -3841,9 +3400,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithApple(FClientLoginWithAppleReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3857,29 +3414,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithApple(FClientLoginWithAppleReques
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.IdentityToken.IsEmpty() || request.IdentityToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("IdentityToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("IdentityToken"), request.IdentityToken);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteStringOrNull(TEXT("IdentityToken"), request.IdentityToken);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3895,12 +3441,12 @@ void UPlayFabClientAPI::HelperLoginWithApple(FPlayFabBaseModel response, UObject
     else if (!error.hasError && OnSuccessLoginWithApple.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithApple.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithApple.Unbind();
 }
 
 /** Signs the user in using a custom unique identifier generated by the title, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -3910,9 +3456,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithCustomID(FClientLoginWithCustomID
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3926,29 +3470,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithCustomID(FClientLoginWithCustomID
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomId.IsEmpty() || request.CustomId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CustomId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CustomId"), request.CustomId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteStringOrNull(TEXT("CustomId"), request.CustomId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3964,12 +3497,12 @@ void UPlayFabClientAPI::HelperLoginWithCustomID(FPlayFabBaseModel response, UObj
     else if (!error.hasError && OnSuccessLoginWithCustomID.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithCustomID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithCustomID.Unbind();
 }
 
 /** Signs the user into the PlayFab account, returning a session identifier that can subsequently be used for API calls which require an authenticated user. Unlike most other login API calls, LoginWithEmailAddress does not permit the creation of new accounts via the CreateAccountFlag. Email addresses may be used to create accounts via RegisterPlayFabUser. */
@@ -3979,9 +3512,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithEmailAddress(FClientLoginWithEmai
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3995,23 +3526,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithEmailAddress(FClientLoginWithEmai
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.Password.IsEmpty() || request.Password == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Password"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Password"), request.Password);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Email"), request.Email);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("Password"), request.Password);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4027,12 +3551,12 @@ void UPlayFabClientAPI::HelperLoginWithEmailAddress(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessLoginWithEmailAddress.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithEmailAddress.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithEmailAddress.Unbind();
 }
 
 /** Signs the user in using a Facebook access token, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -4042,9 +3566,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithFacebook(FClientLoginWithFacebook
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4058,29 +3580,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithFacebook(FClientLoginWithFacebook
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AccessToken.IsEmpty() || request.AccessToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AccessToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AccessToken"), request.AccessToken);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AccessToken"), request.AccessToken);
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4096,12 +3607,12 @@ void UPlayFabClientAPI::HelperLoginWithFacebook(FPlayFabBaseModel response, UObj
     else if (!error.hasError && OnSuccessLoginWithFacebook.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithFacebook.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithFacebook.Unbind();
 }
 
 /** Signs the user in using a Facebook Instant Games ID, returning a session identifier that can subsequently be used for API calls which require an authenticated user. Requires Facebook Instant Games to be configured. */
@@ -4111,9 +3622,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithFacebookInstantGamesId(FClientLog
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4127,29 +3636,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithFacebookInstantGamesId(FClientLog
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.FacebookInstantGamesSignature.IsEmpty() || request.FacebookInstantGamesSignature == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FacebookInstantGamesSignature"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FacebookInstantGamesSignature"), request.FacebookInstantGamesSignature);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteStringOrNull(TEXT("FacebookInstantGamesSignature"), request.FacebookInstantGamesSignature);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4165,12 +3663,12 @@ void UPlayFabClientAPI::HelperLoginWithFacebookInstantGamesId(FPlayFabBaseModel
     else if (!error.hasError && OnSuccessLoginWithFacebookInstantGamesId.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithFacebookInstantGamesId.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithFacebookInstantGamesId.Unbind();
 }
 
 /** Signs the user in using an iOS Game Center player identifier, returning a session identifier that can subsequently be used for API calls which require an authenticated user. Logging in with a Game Center ID is insecure if you do not include the optional PublicKeyUrl, Salt, Signature, and Timestamp parameters in this request. It is recommended you require these parameters on all Game Center calls by going to the Apple Add-ons page in the PlayFab Game Manager and enabling the 'Require secure authentication only for this app' option. */
@@ -4180,9 +3678,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithGameCenter(FClientLoginWithGameCe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4196,49 +3692,22 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithGameCenter(FClientLoginWithGameCe
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.PlayerId.IsEmpty() || request.PlayerId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerId"), request.PlayerId);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.PublicKeyUrl.IsEmpty() || request.PublicKeyUrl == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PublicKeyUrl"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PublicKeyUrl"), request.PublicKeyUrl);
-    }
-    if (request.Salt.IsEmpty() || request.Salt == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Salt"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Salt"), request.Salt);
-    }
-    if (request.Signature.IsEmpty() || request.Signature == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Signature"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Signature"), request.Signature);
-    }
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerId"), request.PlayerId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteStringOrNull(TEXT("PublicKeyUrl"), request.PublicKeyUrl);
+    RequestWriter.WriteStringOrNull(TEXT("Salt"), request.Salt);
+    RequestWriter.WriteStringOrNull(TEXT("Signature"), request.Signature);
+    RequestWriter.WriteStringOrNull(TEXT("Timestamp"), request.Timestamp);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4254,12 +3723,12 @@ void UPlayFabClientAPI::HelperLoginWithGameCenter(FPlayFabBaseModel response, UO
     else if (!error.hasError && OnSuccessLoginWithGameCenter.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithGameCenter.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithGameCenter.Unbind();
 }
 
 /** Signs the user in using their Google account credentials */
@@ -4269,9 +3738,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithGoogleAccount(FClientLoginWithGoo
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4285,29 +3752,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithGoogleAccount(FClientLoginWithGoo
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.ServerAuthCode.IsEmpty() || request.ServerAuthCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ServerAuthCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ServerAuthCode"), request.ServerAuthCode);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteStringOrNull(TEXT("ServerAuthCode"), request.ServerAuthCode);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4323,12 +3779,12 @@ void UPlayFabClientAPI::HelperLoginWithGoogleAccount(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessLoginWithGoogleAccount.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithGoogleAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithGoogleAccount.Unbind();
 }
 
 /** Signs the user in using the vendor-specific iOS device identifier, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -4338,9 +3794,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithIOSDeviceID(FClientLoginWithIOSDe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4354,39 +3808,20 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithIOSDeviceID(FClientLoginWithIOSDe
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.DeviceId.IsEmpty() || request.DeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceId"), request.DeviceId);
-    }
-    if (request.DeviceModel.IsEmpty() || request.DeviceModel == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceModel"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceModel"), request.DeviceModel);
-    }
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.OS.IsEmpty() || request.OS == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OS"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OS"), request.OS);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("DeviceId"), request.DeviceId);
+    RequestWriter.WriteStringOrNull(TEXT("DeviceModel"), request.DeviceModel);
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("OS"), request.OS);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4402,12 +3837,12 @@ void UPlayFabClientAPI::HelperLoginWithIOSDeviceID(FPlayFabBaseModel response, U
     else if (!error.hasError && OnSuccessLoginWithIOSDeviceID.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithIOSDeviceID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithIOSDeviceID.Unbind();
 }
 
 /** Signs the user in using a Kongregate player account. */
@@ -4417,9 +3852,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithKongregate(FClientLoginWithKongre
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4433,34 +3866,19 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithKongregate(FClientLoginWithKongre
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AuthTicket.IsEmpty() || request.AuthTicket == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AuthTicket"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AuthTicket"), request.AuthTicket);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.KongregateId.IsEmpty() || request.KongregateId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KongregateId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("KongregateId"), request.KongregateId);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AuthTicket"), request.AuthTicket);
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("KongregateId"), request.KongregateId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4476,12 +3894,12 @@ void UPlayFabClientAPI::HelperLoginWithKongregate(FPlayFabBaseModel response, UO
     else if (!error.hasError && OnSuccessLoginWithKongregate.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithKongregate.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithKongregate.Unbind();
 }
 
 /** Signs in the user with a Nintendo service account token. */
@@ -4491,9 +3909,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithNintendoServiceAccount(FClientLog
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4507,29 +3923,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithNintendoServiceAccount(FClientLog
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.IdentityToken.IsEmpty() || request.IdentityToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("IdentityToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("IdentityToken"), request.IdentityToken);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteStringOrNull(TEXT("IdentityToken"), request.IdentityToken);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4545,12 +3950,12 @@ void UPlayFabClientAPI::HelperLoginWithNintendoServiceAccount(FPlayFabBaseModel
     else if (!error.hasError && OnSuccessLoginWithNintendoServiceAccount.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithNintendoServiceAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithNintendoServiceAccount.Unbind();
 }
 
 /** Signs the user in using a Nintendo Switch Device ID, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -4560,9 +3965,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithNintendoSwitchDeviceId(FClientLog
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4576,29 +3979,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithNintendoSwitchDeviceId(FClientLog
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.NintendoSwitchDeviceId.IsEmpty() || request.NintendoSwitchDeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("NintendoSwitchDeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("NintendoSwitchDeviceId"), request.NintendoSwitchDeviceId);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("NintendoSwitchDeviceId"), request.NintendoSwitchDeviceId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4614,12 +4006,12 @@ void UPlayFabClientAPI::HelperLoginWithNintendoSwitchDeviceId(FPlayFabBaseModel
     else if (!error.hasError && OnSuccessLoginWithNintendoSwitchDeviceId.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithNintendoSwitchDeviceId.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithNintendoSwitchDeviceId.Unbind();
 }
 
 /** Logs in a user with an Open ID Connect JWT created by an existing relationship between a title and an Open ID Connect provider. */
@@ -4629,9 +4021,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithOpenIdConnect(FClientLoginWithOpe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4645,34 +4035,19 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithOpenIdConnect(FClientLoginWithOpe
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.ConnectionId.IsEmpty() || request.ConnectionId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ConnectionId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ConnectionId"), request.ConnectionId);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.IdToken.IsEmpty() || request.IdToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("IdToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("IdToken"), request.IdToken);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("ConnectionId"), request.ConnectionId);
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteStringOrNull(TEXT("IdToken"), request.IdToken);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4688,12 +4063,12 @@ void UPlayFabClientAPI::HelperLoginWithOpenIdConnect(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessLoginWithOpenIdConnect.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithOpenIdConnect.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithOpenIdConnect.Unbind();
 }
 
 /** Signs the user into the PlayFab account, returning a session identifier that can subsequently be used for API calls which require an authenticated user. Unlike most other login API calls, LoginWithPlayFab does not permit the creation of new accounts via the CreateAccountFlag. Username/Password credentials may be used to create accounts via RegisterPlayFabUser, or added to existing accounts using AddUsernamePassword. */
@@ -4703,9 +4078,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithPlayFab(FClientLoginWithPlayFabRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4719,23 +4092,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithPlayFab(FClientLoginWithPlayFabRe
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.Password.IsEmpty() || request.Password == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Password"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Password"), request.Password);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
-    if (request.Username.IsEmpty() || request.Username == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Username"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Username"), request.Username);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("Password"), request.Password);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    RequestWriter.WriteStringOrNull(TEXT("Username"), request.Username);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4751,12 +4117,12 @@ void UPlayFabClientAPI::HelperLoginWithPlayFab(FPlayFabBaseModel response, UObje
     else if (!error.hasError && OnSuccessLoginWithPlayFab.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithPlayFab.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithPlayFab.Unbind();
 }
 
 /** Signs the user in using a PlayStation Network authentication code, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -4766,9 +4132,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithPSN(FClientLoginWithPSNRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4782,35 +4146,20 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithPSN(FClientLoginWithPSNRequest re
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AuthCode.IsEmpty() || request.AuthCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AuthCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AuthCode"), request.AuthCode);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    OutRestJsonObj->SetNumberField(TEXT("IssuerId"), request.IssuerId);
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.RedirectUri.IsEmpty() || request.RedirectUri == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RedirectUri"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("RedirectUri"), request.RedirectUri);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AuthCode"), request.AuthCode);
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteNumber(TEXT("IssuerId"), request.IssuerId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteStringOrNull(TEXT("RedirectUri"), request.RedirectUri);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4826,12 +4175,12 @@ void UPlayFabClientAPI::HelperLoginWithPSN(FPlayFabBaseModel response, UObject*
     else if (!error.hasError && OnSuccessLoginWithPSN.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithPSN.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithPSN.Unbind();
 }
 
 /** Signs the user in using a Steam authentication ticket, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -4841,9 +4190,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithSteam(FClientLoginWithSteamReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4857,29 +4204,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithSteam(FClientLoginWithSteamReques
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.SteamTicket.IsEmpty() || request.SteamTicket == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SteamTicket"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SteamTicket"), request.SteamTicket);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteStringOrNull(TEXT("SteamTicket"), request.SteamTicket);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4895,12 +4231,12 @@ void UPlayFabClientAPI::HelperLoginWithSteam(FPlayFabBaseModel response, UObject
     else if (!error.hasError && OnSuccessLoginWithSteam.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithSteam.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithSteam.Unbind();
 }
 
 /** Signs the user in using a Twitch access token. */
@@ -4910,9 +4246,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithTwitch(FClientLoginWithTwitchRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4926,29 +4260,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithTwitch(FClientLoginWithTwitchRequ
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AccessToken.IsEmpty() || request.AccessToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AccessToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AccessToken"), request.AccessToken);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AccessToken"), request.AccessToken);
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4964,12 +4287,12 @@ void UPlayFabClientAPI::HelperLoginWithTwitch(FPlayFabBaseModel response, UObjec
     else if (!error.hasError && OnSuccessLoginWithTwitch.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithTwitch.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithTwitch.Unbind();
 }
 
 /** Completes the Windows Hello login flow by returning the signed value of the challange from GetWindowsHelloChallenge. Windows Hello has a 2 step client to server authentication scheme. Step one is to request from the server a challenge string. Step two is to request the user sign the string via Windows Hello and then send the signed value back to the server.  */
@@ -4979,9 +4302,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithWindowsHello(FClientLoginWithWind
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4995,23 +4316,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithWindowsHello(FClientLoginWithWind
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.ChallengeSignature.IsEmpty() || request.ChallengeSignature == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ChallengeSignature"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ChallengeSignature"), request.ChallengeSignature);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.PublicKeyHint.IsEmpty() || request.PublicKeyHint == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PublicKeyHint"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PublicKeyHint"), request.PublicKeyHint);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("ChallengeSignature"), request.ChallengeSignature);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("PublicKeyHint"), request.PublicKeyHint);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5027,12 +4341,12 @@ void UPlayFabClientAPI::HelperLoginWithWindowsHello(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessLoginWithWindowsHello.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithWindowsHello.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithWindowsHello.Unbind();
 }
 
 /** Signs the user in using a Xbox Live Token, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -5042,9 +4356,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithXbox(FClientLoginWithXboxRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5058,29 +4370,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithXbox(FClientLoginWithXboxRequest
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
-    if (request.XboxToken.IsEmpty() || request.XboxToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("XboxToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("XboxToken"), request.XboxToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    RequestWriter.WriteStringOrNull(TEXT("XboxToken"), request.XboxToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5096,12 +4397,12 @@ void UPlayFabClientAPI::HelperLoginWithXbox(FPlayFabBaseModel response, UObject*
     else if (!error.hasError && OnSuccessLoginWithXbox.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessLoginWithXbox.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithXbox.Unbind();
 }
 
 /** Registers a new Playfab user account, returning a session identifier that can subsequently be used for API calls which require an authenticated user. You must supply either a username or an email address. */
@@ -5111,9 +4412,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::RegisterPlayFabUser(FClientRegisterPlayFab
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5127,44 +4426,21 @@ UPlayFabClientAPI* UPlayFabClientAPI::RegisterPlayFabUser(FClientRegisterPlayFab
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.DisplayName.IsEmpty() || request.DisplayName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DisplayName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DisplayName"), request.DisplayName);
-    }
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.Password.IsEmpty() || request.Password == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Password"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Password"), request.Password);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("RequireBothUsernameAndEmail"), request.RequireBothUsernameAndEmail);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
-    if (request.Username.IsEmpty() || request.Username == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Username"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Username"), request.Username);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("DisplayName"), request.DisplayName);
+    RequestWriter.WriteStringOrNull(TEXT("Email"), request.Email);
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("Password"), request.Password);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteBool(TEXT("RequireBothUsernameAndEmail"), request.RequireBothUsernameAndEmail);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    RequestWriter.WriteStringOrNull(TEXT("Username"), request.Username);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5182,7 +4458,7 @@ void UPlayFabClientAPI::HelperRegisterPlayFabUser(FPlayFabBaseModel response, UO
         FClientRegisterPlayFabUserResult ResultStruct = UPlayFabClientModelDecoder::decodeRegisterPlayFabUserResultResponse(response.responseData);
         OnSuccessRegisterPlayFabUser.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRegisterPlayFabUser.Unbind();
 }
 
 /** Registers a new PlayFab user account using Windows Hello authentication, returning a session ticket that can subsequently be used for API calls which require an authenticated user */
@@ -5192,9 +4468,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::RegisterWithWindowsHello(FClientRegisterWi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5208,38 +4482,19 @@ UPlayFabClientAPI* UPlayFabClientAPI::RegisterWithWindowsHello(FClientRegisterWi
     manager->returnsSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.DeviceName.IsEmpty() || request.DeviceName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceName"), request.DeviceName);
-    }
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.PublicKey.IsEmpty() || request.PublicKey == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PublicKey"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PublicKey"), request.PublicKey);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
-    if (request.UserName.IsEmpty() || request.UserName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("UserName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("UserName"), request.UserName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("DeviceName"), request.DeviceName);
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteStringOrNull(TEXT("PublicKey"), request.PublicKey);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    RequestWriter.WriteStringOrNull(TEXT("UserName"), request.UserName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5255,12 +4510,12 @@ void UPlayFabClientAPI::HelperRegisterWithWindowsHello(FPlayFabBaseModel respons
     else if (!error.hasError && OnSuccessRegisterWithWindowsHello.IsBound())
     {
         FClientLoginResult ResultStruct = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         // CallAuthenticationContext was set in OnProcessRequestComplete
         ResultStruct.AuthenticationContext = CallAuthenticationContext;
         OnSuccessRegisterWithWindowsHello.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRegisterWithWindowsHello.Unbind();
 }
 
 /** Sets the player's secret if it is not already set. Player secrets are used to sign API requests. To reset a player's secret use the Admin or Server API method SetPlayerSecret. */
@@ -5270,9 +4525,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::SetPlayerSecret(FClientSetPlayerSecretRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5286,20 +4539,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::SetPlayerSecret(FClientSetPlayerSecretRequ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("EncryptedRequest"), request.EncryptedRequest);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5317,7 +4563,7 @@ void UPlayFabClientAPI::HelperSetPlayerSecret(FPlayFabBaseModel response, UObjec
         FClientSetPlayerSecretResult ResultStruct = UPlayFabClientModelDecoder::decodeSetPlayerSecretResultResponse(response.responseData);
         OnSuccessSetPlayerSecret.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetPlayerSecret.Unbind();
 }
 
 
@@ -5331,9 +4577,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterData(FClientGetCharacterDataRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5347,29 +4591,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterData(FClientGetCharacterDataRe
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5387,7 +4617,7 @@ void UPlayFabClientAPI::HelperGetCharacterData(FPlayFabBaseModel response, UObje
         FClientGetCharacterDataResult ResultStruct = UPlayFabClientModelDecoder::decodeGetCharacterDataResultResponse(response.responseData);
         OnSuccessGetCharacterData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetCharacterData.Unbind();
 }
 
 /** Retrieves the title-specific custom data for the character which can only be read by the client */
@@ -5397,9 +4627,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterReadOnlyData(FClientGetCharact
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5413,29 +4641,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterReadOnlyData(FClientGetCharact
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5451,10 +4665,10 @@ void UPlayFabClientAPI::HelperGetCharacterReadOnlyData(FPlayFabBaseModel respons
     else if (!error.hasError && OnSuccessGetCharacterReadOnlyData.IsBound())
     {
         FClientGetCharacterDataResult ResultStruct = UPlayFabClientModelDecoder::decodeGetCharacterDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetCharacterReadOnlyData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetCharacterReadOnlyData.Unbind();
 }
 
 /** Creates and updates the title-specific custom data for the user's character which is readable and writable by the client */
@@ -5464,9 +4678,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateCharacterData(FClientUpdateCharacter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5480,28 +4692,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateCharacterData(FClientUpdateCharacter
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
     FString temp_Permission;
     if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
+        RequestWriter.WriteString(TEXT("Permission"), temp_Permission);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5519,7 +4721,7 @@ void UPlayFabClientAPI::HelperUpdateCharacterData(FPlayFabBaseModel response, UO
         FClientUpdateCharacterDataResult ResultStruct = UPlayFabClientModelDecoder::decodeUpdateCharacterDataResultResponse(response.responseData);
         OnSuccessUpdateCharacterData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateCharacterData.Unbind();
 }
 
 
@@ -5533,9 +4735,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetAllUsersCharacters(FClientListUsersChar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5549,15 +4749,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetAllUsersCharacters(FClientListUsersChar
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5575,7 +4772,7 @@ void UPlayFabClientAPI::HelperGetAllUsersCharacters(FPlayFabBaseModel response,
         FClientListUsersCharactersResult ResultStruct = UPlayFabClientModelDecoder::decodeListUsersCharactersResultResponse(response.responseData);
         OnSuccessGetAllUsersCharacters.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetAllUsersCharacters.Unbind();
 }
 
 /** Retrieves a list of ranked characters for the given statistic, starting from the indicated point in the leaderboard */
@@ -5585,9 +4782,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterLeaderboard(FClientGetCharacte
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5601,22 +4796,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterLeaderboard(FClientGetCharacte
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterType.IsEmpty() || request.CharacterType == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterType"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterType"), request.CharacterType);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    OutRestJsonObj->SetNumberField(TEXT("StartPosition"), request.StartPosition);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterType"), request.CharacterType);
+    RequestWriter.WriteNumber(TEXT("MaxResultsCount"), request.MaxResultsCount);
+    RequestWriter.WriteNumber(TEXT("StartPosition"), request.StartPosition);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5634,7 +4822,7 @@ void UPlayFabClientAPI::HelperGetCharacterLeaderboard(FPlayFabBaseModel response
         FClientGetCharacterLeaderboardResult ResultStruct = UPlayFabClientModelDecoder::decodeGetCharacterLeaderboardResultResponse(response.responseData);
         OnSuccessGetCharacterLeaderboard.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetCharacterLeaderboard.Unbind();
 }
 
 /** Retrieves the details of all title-specific statistics for the user */
@@ -5644,9 +4832,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterStatistics(FClientGetCharacter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5660,15 +4846,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterStatistics(FClientGetCharacter
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5686,7 +4869,7 @@ void UPlayFabClientAPI::HelperGetCharacterStatistics(FPlayFabBaseModel response,
         FClientGetCharacterStatisticsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetCharacterStatisticsResultResponse(response.responseData);
         OnSuccessGetCharacterStatistics.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetCharacterStatistics.Unbind();
 }
 
 /** Retrieves a list of ranked characters for the given statistic, centered on the requested Character ID */
@@ -5696,9 +4879,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboardAroundCharacter(FClientGetLe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5712,26 +4893,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboardAroundCharacter(FClientGetLe
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CharacterType.IsEmpty() || request.CharacterType == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterType"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterType"), request.CharacterType);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterType"), request.CharacterType);
+    RequestWriter.WriteNumber(TEXT("MaxResultsCount"), request.MaxResultsCount);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5749,7 +4919,7 @@ void UPlayFabClientAPI::HelperGetLeaderboardAroundCharacter(FPlayFabBaseModel re
         FClientGetLeaderboardAroundCharacterResult ResultStruct = UPlayFabClientModelDecoder::decodeGetLeaderboardAroundCharacterResultResponse(response.responseData);
         OnSuccessGetLeaderboardAroundCharacter.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetLeaderboardAroundCharacter.Unbind();
 }
 
 /** Retrieves a list of all of the user's characters for the given statistic. */
@@ -5759,9 +4929,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboardForUserCharacters(FClientGet
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5775,16 +4943,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboardForUserCharacters(FClientGet
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("MaxResultsCount"), request.MaxResultsCount);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5802,7 +4967,7 @@ void UPlayFabClientAPI::HelperGetLeaderboardForUserCharacters(FPlayFabBaseModel
         FClientGetLeaderboardForUsersCharactersResult ResultStruct = UPlayFabClientModelDecoder::decodeGetLeaderboardForUsersCharactersResultResponse(response.responseData);
         OnSuccessGetLeaderboardForUserCharacters.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetLeaderboardForUserCharacters.Unbind();
 }
 
 /** Grants the specified character type to the user. CharacterIds are not globally unique; characterId must be evaluated with the parent PlayFabId to guarantee uniqueness. */
@@ -5812,9 +4977,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GrantCharacterToUser(FClientGrantCharacter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5828,26 +4991,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GrantCharacterToUser(FClientGrantCharacter
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CharacterName.IsEmpty() || request.CharacterName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterName"), request.CharacterName);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ItemId.IsEmpty() || request.ItemId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemId"), request.ItemId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterName"), request.CharacterName);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ItemId"), request.ItemId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5865,7 +5017,7 @@ void UPlayFabClientAPI::HelperGrantCharacterToUser(FPlayFabBaseModel response, U
         FClientGrantCharacterToUserResult ResultStruct = UPlayFabClientModelDecoder::decodeGrantCharacterToUserResultResponse(response.responseData);
         OnSuccessGrantCharacterToUser.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGrantCharacterToUser.Unbind();
 }
 
 /** Updates the values of the specified title-specific statistics for the specific character. By default, clients are not permitted to update statistics. Developers may override this setting in the Game Manager > Settings > API Features. */
@@ -5875,9 +5027,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateCharacterStatistics(FClientUpdateCha
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5891,17 +5041,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateCharacterStatistics(FClientUpdateCha
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CharacterStatistics != nullptr) OutRestJsonObj->SetObjectField(TEXT("CharacterStatistics"), request.CharacterStatistics);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteObject(TEXT("CharacterStatistics"), request.CharacterStatistics);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5919,7 +5066,7 @@ void UPlayFabClientAPI::HelperUpdateCharacterStatistics(FPlayFabBaseModel respon
         FClientUpdateCharacterStatisticsResult ResultStruct = UPlayFabClientModelDecoder::decodeUpdateCharacterStatisticsResultResponse(response.responseData);
         OnSuccessUpdateCharacterStatistics.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateCharacterStatistics.Unbind();
 }
 
 
@@ -5933,9 +5080,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetContentDownloadUrl(FClientGetContentDow
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5949,21 +5094,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetContentDownloadUrl(FClientGetContentDow
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.HttpMethod.IsEmpty() || request.HttpMethod == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("HttpMethod"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("HttpMethod"), request.HttpMethod);
-    }
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ThruCDN"), request.ThruCDN);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("HttpMethod"), request.HttpMethod);
+    RequestWriter.WriteStringOrNull(TEXT("Key"), request.Key);
+    RequestWriter.WriteBool(TEXT("ThruCDN"), request.ThruCDN);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5981,7 +5119,7 @@ void UPlayFabClientAPI::HelperGetContentDownloadUrl(FPlayFabBaseModel response,
         FClientGetContentDownloadUrlResult ResultStruct = UPlayFabClientModelDecoder::decodeGetContentDownloadUrlResultResponse(response.responseData);
         OnSuccessGetContentDownloadUrl.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetContentDownloadUrl.Unbind();
 }
 
 
@@ -5995,9 +5133,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddFriend(FClientAddFriendRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6011,30 +5147,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddFriend(FClientAddFriendRequest request,
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.FriendEmail.IsEmpty() || request.FriendEmail == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendEmail"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendEmail"), request.FriendEmail);
-    }
-    if (request.FriendPlayFabId.IsEmpty() || request.FriendPlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendPlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
-    }
-    if (request.FriendTitleDisplayName.IsEmpty() || request.FriendTitleDisplayName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendTitleDisplayName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendTitleDisplayName"), request.FriendTitleDisplayName);
-    }
-    if (request.FriendUsername.IsEmpty() || request.FriendUsername == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendUsername"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendUsername"), request.FriendUsername);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("FriendEmail"), request.FriendEmail);
+    RequestWriter.WriteStringOrNull(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("FriendTitleDisplayName"), request.FriendTitleDisplayName);
+    RequestWriter.WriteStringOrNull(TEXT("FriendUsername"), request.FriendUsername);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6052,7 +5173,7 @@ void UPlayFabClientAPI::HelperAddFriend(FPlayFabBaseModel response, UObject* cus
         FClientAddFriendResult ResultStruct = UPlayFabClientModelDecoder::decodeAddFriendResultResponse(response.responseData);
         OnSuccessAddFriend.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddFriend.Unbind();
 }
 
 /** Retrieves the current friend list for the local user, constrained to users who have PlayFab accounts. Friends from linked accounts (Facebook, Steam) are also included. You may optionally exclude some linked services' friends. */
@@ -6062,9 +5183,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetFriendsList(FClientGetFriendsListReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6078,19 +5197,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetFriendsList(FClientGetFriendsListReques
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeFacebookFriends"), request.IncludeFacebookFriends);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeSteamFriends"), request.IncludeSteamFriends);
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-    if (request.XboxToken.IsEmpty() || request.XboxToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("XboxToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("XboxToken"), request.XboxToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("IncludeFacebookFriends"), request.IncludeFacebookFriends);
+    RequestWriter.WriteBool(TEXT("IncludeSteamFriends"), request.IncludeSteamFriends);
+    RequestWriter.WriteObject(TEXT("ProfileConstraints"), request.ProfileConstraints);
+    RequestWriter.WriteStringOrNull(TEXT("XboxToken"), request.XboxToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6108,7 +5224,7 @@ void UPlayFabClientAPI::HelperGetFriendsList(FPlayFabBaseModel response, UObject
         FClientGetFriendsListResult ResultStruct = UPlayFabClientModelDecoder::decodeGetFriendsListResultResponse(response.responseData);
         OnSuccessGetFriendsList.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetFriendsList.Unbind();
 }
 
 /** Removes a specified user from the friend list of the local user */
@@ -6118,9 +5234,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveFriend(FClientRemoveFriendRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6134,15 +5248,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveFriend(FClientRemoveFriendRequest re
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.FriendPlayFabId.IsEmpty() || request.FriendPlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendPlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6160,7 +5271,7 @@ void UPlayFabClientAPI::HelperRemoveFriend(FPlayFabBaseModel response, UObject*
         FClientRemoveFriendResult ResultStruct = UPlayFabClientModelDecoder::decodeRemoveFriendResultResponse(response.responseData);
         OnSuccessRemoveFriend.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRemoveFriend.Unbind();
 }
 
 /** Updates the tag list for a specified user in the friend list of the local user */
@@ -6170,9 +5281,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::SetFriendTags(FClientSetFriendTagsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6186,23 +5295,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::SetFriendTags(FClientSetFriendTagsRequest
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.FriendPlayFabId.IsEmpty() || request.FriendPlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendPlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.Tags.IsEmpty() || request.Tags == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Tags"));
-    } else {
-        TArray<FString> TagsArray;
-        FString(request.Tags).ParseIntoArray(TagsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Tags"), TagsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
+    RequestWriter.WriteStringArray(TEXT("Tags"), request.Tags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6220,7 +5319,7 @@ void UPlayFabClientAPI::HelperSetFriendTags(FPlayFabBaseModel response, UObject*
         FClientSetFriendTagsResult ResultStruct = UPlayFabClientModelDecoder::decodeSetFriendTagsResultResponse(response.responseData);
         OnSuccessSetFriendTags.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetFriendTags.Unbind();
 }
 
 
@@ -6234,9 +5333,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCurrentGames(FClientCurrentGamesRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6250,29 +5347,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCurrentGames(FClientCurrentGamesRequest
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildVersion.IsEmpty() || request.BuildVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildVersion"), request.BuildVersion);
-    }
-    if (request.GameMode.IsEmpty() || request.GameMode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameMode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameMode"), request.GameMode);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildVersion"), request.BuildVersion);
+    RequestWriter.WriteStringOrNull(TEXT("GameMode"), request.GameMode);
     FString temp_Region;
     if (GetEnumValueToString<ERegion>(TEXT("ERegion"), request.Region, temp_Region))
-        OutRestJsonObj->SetStringField(TEXT("Region"), temp_Region);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    if (request.TagFilter != nullptr) OutRestJsonObj->SetObjectField(TEXT("TagFilter"), request.TagFilter);
+        RequestWriter.WriteString(TEXT("Region"), temp_Region);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
+    RequestWriter.WriteObject(TEXT("TagFilter"), request.TagFilter);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6290,7 +5376,7 @@ void UPlayFabClientAPI::HelperGetCurrentGames(FPlayFabBaseModel response, UObjec
         FClientCurrentGamesResult ResultStruct = UPlayFabClientModelDecoder::decodeCurrentGamesResultResponse(response.responseData);
         OnSuccessGetCurrentGames.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetCurrentGames.Unbind();
 }
 
 /**  Get details about the regions hosting game servers matching the given parameters. */
@@ -6300,9 +5386,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetGameServerRegions(FClientGameServerRegi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6316,16 +5400,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetGameServerRegions(FClientGameServerRegi
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildVersion.IsEmpty() || request.BuildVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildVersion"), request.BuildVersion);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildVersion"), request.BuildVersion);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6343,7 +5424,7 @@ void UPlayFabClientAPI::HelperGetGameServerRegions(FPlayFabBaseModel response, U
         FClientGameServerRegionsResult ResultStruct = UPlayFabClientModelDecoder::decodeGameServerRegionsResultResponse(response.responseData);
         OnSuccessGetGameServerRegions.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetGameServerRegions.Unbind();
 }
 
 /** Attempts to locate a game session matching the given parameters. If the goal is to match the player into a specific active session, only the LobbyId is required. Otherwise, the BuildVersion, GameMode, and Region are all required parameters. Note that parameters specified in the search are required (they are not weighting factors). If a slot is found in a server instance matching the parameters, the slot will be assigned to that player, removing it from the availabe set. In that case, the information on the game session will be returned, otherwise the Status returned will be GameNotFound. */
@@ -6353,9 +5434,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::Matchmake(FClientMatchmakeRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6369,41 +5448,22 @@ UPlayFabClientAPI* UPlayFabClientAPI::Matchmake(FClientMatchmakeRequest request,
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildVersion.IsEmpty() || request.BuildVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildVersion"), request.BuildVersion);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.GameMode.IsEmpty() || request.GameMode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameMode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameMode"), request.GameMode);
-    }
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildVersion"), request.BuildVersion);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("GameMode"), request.GameMode);
+    RequestWriter.WriteStringOrNull(TEXT("LobbyId"), request.LobbyId);
     FString temp_Region;
     if (GetEnumValueToString<ERegion>(TEXT("ERegion"), request.Region, temp_Region))
-        OutRestJsonObj->SetStringField(TEXT("Region"), temp_Region);
-    OutRestJsonObj->SetBoolField(TEXT("StartNewIfNoneFound"), request.StartNewIfNoneFound);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    if (request.TagFilter != nullptr) OutRestJsonObj->SetObjectField(TEXT("TagFilter"), request.TagFilter);
+        RequestWriter.WriteString(TEXT("Region"), temp_Region);
+    RequestWriter.WriteBool(TEXT("StartNewIfNoneFound"), request.StartNewIfNoneFound);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
+    RequestWriter.WriteObject(TEXT("TagFilter"), request.TagFilter);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6421,7 +5481,7 @@ void UPlayFabClientAPI::HelperMatchmake(FPlayFabBaseModel response, UObject* cus
         FClientMatchmakeResult ResultStruct = UPlayFabClientModelDecoder::decodeMatchmakeResultResponse(response.responseData);
         OnSuccessMatchmake.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessMatchmake.Unbind();
 }
 
 /** Start a new game server with a given configuration, add the current player and return the connection information. */
@@ -6431,9 +5491,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::StartGame(FClientStartGameRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6447,39 +5505,20 @@ UPlayFabClientAPI* UPlayFabClientAPI::StartGame(FClientStartGameRequest request,
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildVersion.IsEmpty() || request.BuildVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildVersion"), request.BuildVersion);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomCommandLineData.IsEmpty() || request.CustomCommandLineData == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CustomCommandLineData"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CustomCommandLineData"), request.CustomCommandLineData);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.GameMode.IsEmpty() || request.GameMode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameMode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameMode"), request.GameMode);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildVersion"), request.BuildVersion);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteStringOrNull(TEXT("CustomCommandLineData"), request.CustomCommandLineData);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("GameMode"), request.GameMode);
     FString temp_Region;
     if (GetEnumValueToString<ERegion>(TEXT("ERegion"), request.Region, temp_Region))
-        OutRestJsonObj->SetStringField(TEXT("Region"), temp_Region);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
+        RequestWriter.WriteString(TEXT("Region"), temp_Region);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6497,7 +5536,7 @@ void UPlayFabClientAPI::HelperStartGame(FPlayFabBaseModel response, UObject* cus
         FClientStartGameResult ResultStruct = UPlayFabClientModelDecoder::decodeStartGameResultResponse(response.responseData);
         OnSuccessStartGame.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessStartGame.Unbind();
 }
 
 
@@ -6511,9 +5550,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::AndroidDevicePushNotificationRegistration(
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6527,21 +5564,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::AndroidDevicePushNotificationRegistration(
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.ConfirmationMessage.IsEmpty() || request.ConfirmationMessage == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ConfirmationMessage"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ConfirmationMessage"), request.ConfirmationMessage);
-    }
-    if (request.DeviceToken.IsEmpty() || request.DeviceToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceToken"), request.DeviceToken);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("SendPushNotificationConfirmation"), request.SendPushNotificationConfirmation);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("ConfirmationMessage"), request.ConfirmationMessage);
+    RequestWriter.WriteStringOrNull(TEXT("DeviceToken"), request.DeviceToken);
+    RequestWriter.WriteBool(TEXT("SendPushNotificationConfirmation"), request.SendPushNotificationConfirmation);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6559,7 +5589,7 @@ void UPlayFabClientAPI::HelperAndroidDevicePushNotificationRegistration(FPlayFab
         FClientAndroidDevicePushNotificationRegistrationResult ResultStruct = UPlayFabClientModelDecoder::decodeAndroidDevicePushNotificationRegistrationResultResponse(response.responseData);
         OnSuccessAndroidDevicePushNotificationRegistration.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAndroidDevicePushNotificationRegistration.Unbind();
 }
 
 /** Grants the player's current entitlements from Microsoft Store's Collection API */
@@ -6569,9 +5599,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConsumeMicrosoftStoreEntitlements(FClientC
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6585,17 +5613,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConsumeMicrosoftStoreEntitlements(FClientC
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.MarketplaceSpecificData != nullptr) OutRestJsonObj->SetObjectField(TEXT("MarketplaceSpecificData"), request.MarketplaceSpecificData);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("MarketplaceSpecificData"), request.MarketplaceSpecificData);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6613,7 +5638,7 @@ void UPlayFabClientAPI::HelperConsumeMicrosoftStoreEntitlements(FPlayFabBaseMode
         FClientConsumeMicrosoftStoreEntitlementsResponse ResultStruct = UPlayFabClientModelDecoder::decodeConsumeMicrosoftStoreEntitlementsResponseResponse(response.responseData);
         OnSuccessConsumeMicrosoftStoreEntitlements.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessConsumeMicrosoftStoreEntitlements.Unbind();
 }
 
 /** Checks for any new PS5 entitlements. If any are found, they are consumed (if they're consumables) and added as PlayFab items */
@@ -6623,9 +5648,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConsumePS5Entitlements(FClientConsumePS5En
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6639,17 +5662,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConsumePS5Entitlements(FClientConsumePS5En
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.MarketplaceSpecificData != nullptr) OutRestJsonObj->SetObjectField(TEXT("MarketplaceSpecificData"), request.MarketplaceSpecificData);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("MarketplaceSpecificData"), request.MarketplaceSpecificData);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6667,7 +5687,7 @@ void UPlayFabClientAPI::HelperConsumePS5Entitlements(FPlayFabBaseModel response,
         FClientConsumePS5EntitlementsResult ResultStruct = UPlayFabClientModelDecoder::decodeConsumePS5EntitlementsResultResponse(response.responseData);
         OnSuccessConsumePS5Entitlements.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessConsumePS5Entitlements.Unbind();
 }
 
 /** Checks for any new consumable entitlements. If any are found, they are consumed and added as PlayFab items */
@@ -6677,9 +5697,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConsumePSNEntitlements(FClientConsumePSNEn
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6693,17 +5711,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConsumePSNEntitlements(FClientConsumePSNEn
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("ServiceLabel"), request.ServiceLabel);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("ServiceLabel"), request.ServiceLabel);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6721,7 +5736,7 @@ void UPlayFabClientAPI::HelperConsumePSNEntitlements(FPlayFabBaseModel response,
         FClientConsumePSNEntitlementsResult ResultStruct = UPlayFabClientModelDecoder::decodeConsumePSNEntitlementsResultResponse(response.responseData);
         OnSuccessConsumePSNEntitlements.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessConsumePSNEntitlements.Unbind();
 }
 
 /** Grants the player's current entitlements from Xbox Live, consuming all availble items in Xbox and granting them to the player's PlayFab inventory. This call is idempotent and will not grant previously granted items to the player. */
@@ -6731,9 +5746,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConsumeXboxEntitlements(FClientConsumeXbox
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6747,21 +5760,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConsumeXboxEntitlements(FClientConsumeXbox
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.XboxToken.IsEmpty() || request.XboxToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("XboxToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("XboxToken"), request.XboxToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("XboxToken"), request.XboxToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6779,7 +5785,7 @@ void UPlayFabClientAPI::HelperConsumeXboxEntitlements(FPlayFabBaseModel response
         FClientConsumeXboxEntitlementsResult ResultStruct = UPlayFabClientModelDecoder::decodeConsumeXboxEntitlementsResultResponse(response.responseData);
         OnSuccessConsumeXboxEntitlements.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessConsumeXboxEntitlements.Unbind();
 }
 
 /** Uses the supplied OAuth code to refresh the internally cached player PSN auth token */
@@ -6789,9 +5795,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::RefreshPSNAuthToken(FClientRefreshPSNAuthT
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6805,21 +5809,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::RefreshPSNAuthToken(FClientRefreshPSNAuthT
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AuthCode.IsEmpty() || request.AuthCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AuthCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AuthCode"), request.AuthCode);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IssuerId"), request.IssuerId);
-    if (request.RedirectUri.IsEmpty() || request.RedirectUri == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RedirectUri"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("RedirectUri"), request.RedirectUri);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AuthCode"), request.AuthCode);
+    RequestWriter.WriteNumber(TEXT("IssuerId"), request.IssuerId);
+    RequestWriter.WriteStringOrNull(TEXT("RedirectUri"), request.RedirectUri);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6835,10 +5832,10 @@ void UPlayFabClientAPI::HelperRefreshPSNAuthToken(FPlayFabBaseModel response, UO
     else if (!error.hasError && OnSuccessRefreshPSNAuthToken.IsBound())
     {
         FClientEmptyResponse ResultStruct = UPlayFabClientModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessRefreshPSNAuthToken.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRefreshPSNAuthToken.Unbind();
 }
 
 /** Registers the iOS device to receive push notifications */
@@ -6848,9 +5845,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::RegisterForIOSPushNotification(FClientRegi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6864,21 +5859,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::RegisterForIOSPushNotification(FClientRegi
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.ConfirmationMessage.IsEmpty() || request.ConfirmationMessage == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ConfirmationMessage"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ConfirmationMessage"), request.ConfirmationMessage);
-    }
-    if (request.DeviceToken.IsEmpty() || request.DeviceToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceToken"), request.DeviceToken);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("SendPushNotificationConfirmation"), request.SendPushNotificationConfirmation);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("ConfirmationMessage"), request.ConfirmationMessage);
+    RequestWriter.WriteStringOrNull(TEXT("DeviceToken"), request.DeviceToken);
+    RequestWriter.WriteBool(TEXT("SendPushNotificationConfirmation"), request.SendPushNotificationConfirmation);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6896,7 +5884,7 @@ void UPlayFabClientAPI::HelperRegisterForIOSPushNotification(FPlayFabBaseModel r
         FClientRegisterForIOSPushNotificationResult ResultStruct = UPlayFabClientModelDecoder::decodeRegisterForIOSPushNotificationResultResponse(response.responseData);
         OnSuccessRegisterForIOSPushNotification.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRegisterForIOSPushNotification.Unbind();
 }
 
 /** Restores all in-app purchases based on the given restore receipt */
@@ -6906,9 +5894,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::RestoreIOSPurchases(FClientRestoreIOSPurch
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6922,21 +5908,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::RestoreIOSPurchases(FClientRestoreIOSPurch
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ReceiptData.IsEmpty() || request.ReceiptData == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReceiptData"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReceiptData"), request.ReceiptData);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ReceiptData"), request.ReceiptData);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6954,7 +5933,7 @@ void UPlayFabClientAPI::HelperRestoreIOSPurchases(FPlayFabBaseModel response, UO
         FClientRestoreIOSPurchasesResult ResultStruct = UPlayFabClientModelDecoder::decodeRestoreIOSPurchasesResultResponse(response.responseData);
         OnSuccessRestoreIOSPurchases.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRestoreIOSPurchases.Unbind();
 }
 
 /** Validates with Amazon that the receipt for an Amazon App Store in-app purchase is valid and that it matches the purchased catalog item */
@@ -6964,9 +5943,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateAmazonIAPReceipt(FClientValidateAm
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6980,32 +5957,17 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateAmazonIAPReceipt(FClientValidateAm
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CurrencyCode.IsEmpty() || request.CurrencyCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CurrencyCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CurrencyCode"), request.CurrencyCode);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("PurchasePrice"), request.PurchasePrice);
-    if (request.ReceiptId.IsEmpty() || request.ReceiptId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReceiptId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReceiptId"), request.ReceiptId);
-    }
-    if (request.UserId.IsEmpty() || request.UserId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("UserId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("UserId"), request.UserId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("CurrencyCode"), request.CurrencyCode);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("PurchasePrice"), request.PurchasePrice);
+    RequestWriter.WriteStringOrNull(TEXT("ReceiptId"), request.ReceiptId);
+    RequestWriter.WriteStringOrNull(TEXT("UserId"), request.UserId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7023,7 +5985,7 @@ void UPlayFabClientAPI::HelperValidateAmazonIAPReceipt(FPlayFabBaseModel respons
         FClientValidateAmazonReceiptResult ResultStruct = UPlayFabClientModelDecoder::decodeValidateAmazonReceiptResultResponse(response.responseData);
         OnSuccessValidateAmazonIAPReceipt.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessValidateAmazonIAPReceipt.Unbind();
 }
 
 /** Validates a Google Play purchase and gives the corresponding item to the player. */
@@ -7033,9 +5995,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateGooglePlayPurchase(FClientValidate
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7049,32 +6009,17 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateGooglePlayPurchase(FClientValidate
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CurrencyCode.IsEmpty() || request.CurrencyCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CurrencyCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CurrencyCode"), request.CurrencyCode);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("PurchasePrice"), request.PurchasePrice);
-    if (request.ReceiptJson.IsEmpty() || request.ReceiptJson == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReceiptJson"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReceiptJson"), request.ReceiptJson);
-    }
-    if (request.Signature.IsEmpty() || request.Signature == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Signature"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Signature"), request.Signature);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("CurrencyCode"), request.CurrencyCode);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("PurchasePrice"), request.PurchasePrice);
+    RequestWriter.WriteStringOrNull(TEXT("ReceiptJson"), request.ReceiptJson);
+    RequestWriter.WriteStringOrNull(TEXT("Signature"), request.Signature);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7092,7 +6037,7 @@ void UPlayFabClientAPI::HelperValidateGooglePlayPurchase(FPlayFabBaseModel respo
         FClientValidateGooglePlayPurchaseResult ResultStruct = UPlayFabClientModelDecoder::decodeValidateGooglePlayPurchaseResultResponse(response.responseData);
         OnSuccessValidateGooglePlayPurchase.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessValidateGooglePlayPurchase.Unbind();
 }
 
 /** Validates with the Apple store that the receipt for an iOS in-app purchase is valid and that it matches the purchased catalog item */
@@ -7102,9 +6047,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateIOSReceipt(FClientValidateIOSRecei
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7118,27 +6061,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateIOSReceipt(FClientValidateIOSRecei
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CurrencyCode.IsEmpty() || request.CurrencyCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CurrencyCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CurrencyCode"), request.CurrencyCode);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("PurchasePrice"), request.PurchasePrice);
-    if (request.ReceiptData.IsEmpty() || request.ReceiptData == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReceiptData"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReceiptData"), request.ReceiptData);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("CurrencyCode"), request.CurrencyCode);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("PurchasePrice"), request.PurchasePrice);
+    RequestWriter.WriteStringOrNull(TEXT("ReceiptData"), request.ReceiptData);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7156,7 +6088,7 @@ void UPlayFabClientAPI::HelperValidateIOSReceipt(FPlayFabBaseModel response, UOb
         FClientValidateIOSReceiptResult ResultStruct = UPlayFabClientModelDecoder::decodeValidateIOSReceiptResultResponse(response.responseData);
         OnSuccessValidateIOSReceipt.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessValidateIOSReceipt.Unbind();
 }
 
 /** Validates with Windows that the receipt for an Windows App Store in-app purchase is valid and that it matches the purchased catalog item */
@@ -7166,9 +6098,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateWindowsStoreReceipt(FClientValidat
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7182,27 +6112,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateWindowsStoreReceipt(FClientValidat
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CurrencyCode.IsEmpty() || request.CurrencyCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CurrencyCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CurrencyCode"), request.CurrencyCode);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("PurchasePrice"), request.PurchasePrice);
-    if (request.Receipt.IsEmpty() || request.Receipt == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Receipt"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Receipt"), request.Receipt);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("CurrencyCode"), request.CurrencyCode);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("PurchasePrice"), request.PurchasePrice);
+    RequestWriter.WriteStringOrNull(TEXT("Receipt"), request.Receipt);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7220,7 +6139,7 @@ void UPlayFabClientAPI::HelperValidateWindowsStoreReceipt(FPlayFabBaseModel resp
         FClientValidateWindowsReceiptResult ResultStruct = UPlayFabClientModelDecoder::decodeValidateWindowsReceiptResultResponse(response.responseData);
         OnSuccessValidateWindowsStoreReceipt.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessValidateWindowsStoreReceipt.Unbind();
 }
 
 
@@ -7234,9 +6153,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetFriendLeaderboard(FClientGetFriendLeade
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7250,28 +6167,21 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetFriendLeaderboard(FClientGetFriendLeade
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeFacebookFriends"), request.IncludeFacebookFriends);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeSteamFriends"), request.IncludeSteamFriends);
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-    OutRestJsonObj->SetNumberField(TEXT("StartPosition"), request.StartPosition);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
-    if (request.XboxToken.IsEmpty() || request.XboxToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("XboxToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("XboxToken"), request.XboxToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("IncludeFacebookFriends"), request.IncludeFacebookFriends);
+    RequestWriter.WriteBool(TEXT("IncludeSteamFriends"), request.IncludeSteamFriends);
+    RequestWriter.WriteNumber(TEXT("MaxResultsCount"), request.MaxResultsCount);
+    RequestWriter.WriteObject(TEXT("ProfileConstraints"), request.ProfileConstraints);
+    RequestWriter.WriteNumber(TEXT("StartPosition"), request.StartPosition);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
+    RequestWriter.WriteBool(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
+    RequestWriter.WriteNumber(TEXT("Version"), request.Version);
+    RequestWriter.WriteStringOrNull(TEXT("XboxToken"), request.XboxToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7289,7 +6199,7 @@ void UPlayFabClientAPI::HelperGetFriendLeaderboard(FPlayFabBaseModel response, U
         FClientGetLeaderboardResult ResultStruct = UPlayFabClientModelDecoder::decodeGetLeaderboardResultResponse(response.responseData);
         OnSuccessGetFriendLeaderboard.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetFriendLeaderboard.Unbind();
 }
 
 /** Retrieves a list of ranked friends of the current player for the given statistic, centered on the requested PlayFab user. If PlayFabId is empty or null will return currently logged in user. */
@@ -7299,9 +6209,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetFriendLeaderboardAroundPlayer(FClientGe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7315,32 +6223,21 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetFriendLeaderboardAroundPlayer(FClientGe
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeFacebookFriends"), request.IncludeFacebookFriends);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeSteamFriends"), request.IncludeSteamFriends);
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
-    if (request.XboxToken.IsEmpty() || request.XboxToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("XboxToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("XboxToken"), request.XboxToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("IncludeFacebookFriends"), request.IncludeFacebookFriends);
+    RequestWriter.WriteBool(TEXT("IncludeSteamFriends"), request.IncludeSteamFriends);
+    RequestWriter.WriteNumber(TEXT("MaxResultsCount"), request.MaxResultsCount);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteObject(TEXT("ProfileConstraints"), request.ProfileConstraints);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
+    RequestWriter.WriteBool(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
+    RequestWriter.WriteNumber(TEXT("Version"), request.Version);
+    RequestWriter.WriteStringOrNull(TEXT("XboxToken"), request.XboxToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7358,7 +6255,7 @@ void UPlayFabClientAPI::HelperGetFriendLeaderboardAroundPlayer(FPlayFabBaseModel
         FClientGetFriendLeaderboardAroundPlayerResult ResultStruct = UPlayFabClientModelDecoder::decodeGetFriendLeaderboardAroundPlayerResultResponse(response.responseData);
         OnSuccessGetFriendLeaderboardAroundPlayer.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetFriendLeaderboardAroundPlayer.Unbind();
 }
 
 /** Retrieves a list of ranked users for the given statistic, starting from the indicated point in the leaderboard */
@@ -7368,9 +6265,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboard(FClientGetLeaderboardReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7384,21 +6279,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboard(FClientGetLeaderboardReques
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-    OutRestJsonObj->SetNumberField(TEXT("StartPosition"), request.StartPosition);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("MaxResultsCount"), request.MaxResultsCount);
+    RequestWriter.WriteObject(TEXT("ProfileConstraints"), request.ProfileConstraints);
+    RequestWriter.WriteNumber(TEXT("StartPosition"), request.StartPosition);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
+    RequestWriter.WriteBool(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
+    RequestWriter.WriteNumber(TEXT("Version"), request.Version);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7414,10 +6306,10 @@ void UPlayFabClientAPI::HelperGetLeaderboard(FPlayFabBaseModel response, UObject
     else if (!error.hasError && OnSuccessGetLeaderboard.IsBound())
     {
         FClientGetLeaderboardResult ResultStruct = UPlayFabClientModelDecoder::decodeGetLeaderboardResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetLeaderboard.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetLeaderboard.Unbind();
 }
 
 /** Retrieves a list of ranked users for the given statistic, centered on the requested player. If PlayFabId is empty or null will return currently logged in user. */
@@ -7427,9 +6319,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboardAroundPlayer(FClientGetLeade
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7443,25 +6333,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboardAroundPlayer(FClientGetLeade
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("MaxResultsCount"), request.MaxResultsCount);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteObject(TEXT("ProfileConstraints"), request.ProfileConstraints);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
+    RequestWriter.WriteBool(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
+    RequestWriter.WriteNumber(TEXT("Version"), request.Version);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7479,7 +6362,7 @@ void UPlayFabClientAPI::HelperGetLeaderboardAroundPlayer(FPlayFabBaseModel respo
         FClientGetLeaderboardAroundPlayerResult ResultStruct = UPlayFabClientModelDecoder::decodeGetLeaderboardAroundPlayerResultResponse(response.responseData);
         OnSuccessGetLeaderboardAroundPlayer.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetLeaderboardAroundPlayer.Unbind();
 }
 
 /** Retrieves the indicated statistics (current version and values for all statistics, if none are specified), for the local player. */
@@ -7489,9 +6372,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerStatistics(FClientGetPlayerStatis
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7505,24 +6386,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerStatistics(FClientGetPlayerStatis
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    // Check to see if string is empty
-    if (request.StatisticNames.IsEmpty() || request.StatisticNames == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticNames"));
-    } else {
-        TArray<FString> StatisticNamesArray;
-        FString(request.StatisticNames).ParseIntoArray(StatisticNamesArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("StatisticNames"), StatisticNamesArray);
-    }
-    if (request.StatisticNameVersions.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticNameVersions"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("StatisticNameVersions"), request.StatisticNameVersions);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringArray(TEXT("StatisticNames"), request.StatisticNames);
+    RequestWriter.WriteObjectArray(TEXT("StatisticNameVersions"), request.StatisticNameVersions);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7540,7 +6411,7 @@ void UPlayFabClientAPI::HelperGetPlayerStatistics(FPlayFabBaseModel response, UO
         FClientGetPlayerStatisticsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayerStatisticsResultResponse(response.responseData);
         OnSuccessGetPlayerStatistics.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerStatistics.Unbind();
 }
 
 /** Retrieves the information on the available versions of the specified statistic. */
@@ -7550,9 +6421,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerStatisticVersions(FClientGetPlaye
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7566,16 +6435,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerStatisticVersions(FClientGetPlaye
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7593,7 +6459,7 @@ void UPlayFabClientAPI::HelperGetPlayerStatisticVersions(FPlayFabBaseModel respo
         FClientGetPlayerStatisticVersionsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayerStatisticVersionsResultResponse(response.responseData);
         OnSuccessGetPlayerStatisticVersions.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerStatisticVersions.Unbind();
 }
 
 /** Retrieves the title-specific custom data for the user which is readable and writable by the client */
@@ -7603,9 +6469,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserData(FClientGetUserDataRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7619,24 +6483,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserData(FClientGetUserDataRequest requ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7654,7 +6508,7 @@ void UPlayFabClientAPI::HelperGetUserData(FPlayFabBaseModel response, UObject* c
         FClientGetUserDataResult ResultStruct = UPlayFabClientModelDecoder::decodeGetUserDataResultResponse(response.responseData);
         OnSuccessGetUserData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserData.Unbind();
 }
 
 /** Retrieves the publisher-specific custom data for the user which is readable and writable by the client */
@@ -7664,9 +6518,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserPublisherData(FClientGetUserDataReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7680,24 +6532,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserPublisherData(FClientGetUserDataReq
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7713,10 +6555,10 @@ void UPlayFabClientAPI::HelperGetUserPublisherData(FPlayFabBaseModel response, U
     else if (!error.hasError && OnSuccessGetUserPublisherData.IsBound())
     {
         FClientGetUserDataResult ResultStruct = UPlayFabClientModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetUserPublisherData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserPublisherData.Unbind();
 }
 
 /** Retrieves the publisher-specific custom data for the user which can only be read by the client */
@@ -7726,9 +6568,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserPublisherReadOnlyData(FClientGetUse
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7742,24 +6582,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserPublisherReadOnlyData(FClientGetUse
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7775,10 +6605,10 @@ void UPlayFabClientAPI::HelperGetUserPublisherReadOnlyData(FPlayFabBaseModel res
     else if (!error.hasError && OnSuccessGetUserPublisherReadOnlyData.IsBound())
     {
         FClientGetUserDataResult ResultStruct = UPlayFabClientModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetUserPublisherReadOnlyData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserPublisherReadOnlyData.Unbind();
 }
 
 /** Retrieves the title-specific custom data for the user which can only be read by the client */
@@ -7788,9 +6618,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserReadOnlyData(FClientGetUserDataRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7804,24 +6632,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserReadOnlyData(FClientGetUserDataRequ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7837,10 +6655,10 @@ void UPlayFabClientAPI::HelperGetUserReadOnlyData(FPlayFabBaseModel response, UO
     else if (!error.hasError && OnSuccessGetUserReadOnlyData.IsBound())
     {
         FClientGetUserDataResult ResultStruct = UPlayFabClientModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetUserReadOnlyData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserReadOnlyData.Unbind();
 }
 
 /** Updates the values of the specified title-specific statistics for the user. By default, clients are not permitted to update statistics. Developers may override this setting in the Game Manager > Settings > API Features. */
@@ -7850,9 +6668,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdatePlayerStatistics(FClientUpdatePlayer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7866,16 +6682,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdatePlayerStatistics(FClientUpdatePlayer
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Statistics.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Statistics"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Statistics"), request.Statistics);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObjectArray(TEXT("Statistics"), request.Statistics);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7893,7 +6706,7 @@ void UPlayFabClientAPI::HelperUpdatePlayerStatistics(FPlayFabBaseModel response,
         FClientUpdatePlayerStatisticsResult ResultStruct = UPlayFabClientModelDecoder::decodeUpdatePlayerStatisticsResultResponse(response.responseData);
         OnSuccessUpdatePlayerStatistics.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdatePlayerStatistics.Unbind();
 }
 
 /** Creates and updates the title-specific custom data for the user which is readable and writable by the client */
@@ -7903,9 +6716,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateUserData(FClientUpdateUserDataReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7919,23 +6730,17 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateUserData(FClientUpdateUserDataReques
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
     FString temp_Permission;
     if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
+        RequestWriter.WriteString(TEXT("Permission"), temp_Permission);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7953,7 +6758,7 @@ void UPlayFabClientAPI::HelperUpdateUserData(FPlayFabBaseModel response, UObject
         FClientUpdateUserDataResult ResultStruct = UPlayFabClientModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
         OnSuccessUpdateUserData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateUserData.Unbind();
 }
 
 /** Creates and updates the publisher-specific custom data for the user which is readable and writable by the client */
@@ -7963,9 +6768,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateUserPublisherData(FClientUpdateUserD
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7979,23 +6782,17 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateUserPublisherData(FClientUpdateUserD
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
     FString temp_Permission;
     if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
+        RequestWriter.WriteString(TEXT("Permission"), temp_Permission);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8011,10 +6808,10 @@ void UPlayFabClientAPI::HelperUpdateUserPublisherData(FPlayFabBaseModel response
     else if (!error.hasError && OnSuccessUpdateUserPublisherData.IsBound())
     {
         FClientUpdateUserDataResult ResultStruct = UPlayFabClientModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateUserPublisherData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateUserPublisherData.Unbind();
 }
 
 
@@ -8028,9 +6825,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddUserVirtualCurrency(FClientAddUserVirtu
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8044,17 +6839,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddUserVirtualCurrency(FClientAddUserVirtu
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("Amount"), request.Amount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("VirtualCurrency"), request.VirtualCurrency);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8072,7 +6864,7 @@ void UPlayFabClientAPI::HelperAddUserVirtualCurrency(FPlayFabBaseModel response,
         FClientModifyUserVirtualCurrencyResult ResultStruct = UPlayFabClientModelDecoder::decodeModifyUserVirtualCurrencyResultResponse(response.responseData);
         OnSuccessAddUserVirtualCurrency.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddUserVirtualCurrency.Unbind();
 }
 
 /** Confirms with the payment provider that the purchase was approved (if applicable) and adjusts inventory and virtual currency balances as appropriate */
@@ -8082,9 +6874,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConfirmPurchase(FClientConfirmPurchaseRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8098,16 +6888,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConfirmPurchase(FClientConfirmPurchaseRequ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.OrderId.IsEmpty() || request.OrderId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OrderId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OrderId"), request.OrderId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("OrderId"), request.OrderId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8125,7 +6912,7 @@ void UPlayFabClientAPI::HelperConfirmPurchase(FPlayFabBaseModel response, UObjec
         FClientConfirmPurchaseResult ResultStruct = UPlayFabClientModelDecoder::decodeConfirmPurchaseResultResponse(response.responseData);
         OnSuccessConfirmPurchase.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessConfirmPurchase.Unbind();
 }
 
 /** Consume uses of a consumable item. When all uses are consumed, it will be removed from the player's inventory. */
@@ -8135,9 +6922,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConsumeItem(FClientConsumeItemRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8151,22 +6936,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConsumeItem(FClientConsumeItemRequest requ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("ConsumeCount"), request.ConsumeCount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteNumber(TEXT("ConsumeCount"), request.ConsumeCount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ItemInstanceId"), request.ItemInstanceId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8184,7 +6962,7 @@ void UPlayFabClientAPI::HelperConsumeItem(FPlayFabBaseModel response, UObject* c
         FClientConsumeItemResult ResultStruct = UPlayFabClientModelDecoder::decodeConsumeItemResultResponse(response.responseData);
         OnSuccessConsumeItem.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessConsumeItem.Unbind();
 }
 
 /** Retrieves the specified character's current inventory of virtual goods */
@@ -8194,9 +6972,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterInventory(FClientGetCharacterI
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8210,21 +6986,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterInventory(FClientGetCharacterI
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8242,7 +7011,7 @@ void UPlayFabClientAPI::HelperGetCharacterInventory(FPlayFabBaseModel response,
         FClientGetCharacterInventoryResult ResultStruct = UPlayFabClientModelDecoder::decodeGetCharacterInventoryResultResponse(response.responseData);
         OnSuccessGetCharacterInventory.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetCharacterInventory.Unbind();
 }
 
 /** For payments flows where the provider requires playfab (the fulfiller) to initiate the transaction, but the client completes the rest of the flow. In the Xsolla case, the token returned here will be passed to Xsolla by the client to create a cart. Poll GetPurchase using the returned OrderId once you've completed the payment. */
@@ -8252,9 +7021,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPaymentToken(FClientGetPaymentTokenRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8268,15 +7035,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPaymentToken(FClientGetPaymentTokenRequ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.TokenProvider.IsEmpty() || request.TokenProvider == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TokenProvider"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TokenProvider"), request.TokenProvider);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("TokenProvider"), request.TokenProvider);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8294,7 +7058,7 @@ void UPlayFabClientAPI::HelperGetPaymentToken(FPlayFabBaseModel response, UObjec
         FClientGetPaymentTokenResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPaymentTokenResultResponse(response.responseData);
         OnSuccessGetPaymentToken.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPaymentToken.Unbind();
 }
 
 /** Retrieves a purchase along with its current PlayFab status. Returns inventory items from the purchase that are still active. */
@@ -8304,9 +7068,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPurchase(FClientGetPurchaseRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8320,15 +7082,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPurchase(FClientGetPurchaseRequest requ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.OrderId.IsEmpty() || request.OrderId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OrderId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OrderId"), request.OrderId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("OrderId"), request.OrderId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8346,7 +7105,7 @@ void UPlayFabClientAPI::HelperGetPurchase(FPlayFabBaseModel response, UObject* c
         FClientGetPurchaseResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPurchaseResultResponse(response.responseData);
         OnSuccessGetPurchase.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPurchase.Unbind();
 }
 
 /** Retrieves the user's current inventory of virtual goods */
@@ -8356,9 +7115,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserInventory(FClientGetUserInventoryRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8372,11 +7129,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserInventory(FClientGetUserInventoryRe
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8394,7 +7152,7 @@ void UPlayFabClientAPI::HelperGetUserInventory(FPlayFabBaseModel response, UObje
         FClientGetUserInventoryResult ResultStruct = UPlayFabClientModelDecoder::decodeGetUserInventoryResultResponse(response.responseData);
         OnSuccessGetUserInventory.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserInventory.Unbind();
 }
 
 /** Selects a payment option for purchase order created via StartPurchase */
@@ -8404,9 +7162,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::PayForPurchase(FClientPayForPurchaseReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8420,31 +7176,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::PayForPurchase(FClientPayForPurchaseReques
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Currency.IsEmpty() || request.Currency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Currency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Currency"), request.Currency);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.OrderId.IsEmpty() || request.OrderId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OrderId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OrderId"), request.OrderId);
-    }
-    if (request.ProviderName.IsEmpty() || request.ProviderName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ProviderName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ProviderName"), request.ProviderName);
-    }
-    if (request.ProviderTransactionId.IsEmpty() || request.ProviderTransactionId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ProviderTransactionId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ProviderTransactionId"), request.ProviderTransactionId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Currency"), request.Currency);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("OrderId"), request.OrderId);
+    RequestWriter.WriteStringOrNull(TEXT("ProviderName"), request.ProviderName);
+    RequestWriter.WriteStringOrNull(TEXT("ProviderTransactionId"), request.ProviderTransactionId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8462,7 +7203,7 @@ void UPlayFabClientAPI::HelperPayForPurchase(FPlayFabBaseModel response, UObject
         FClientPayForPurchaseResult ResultStruct = UPlayFabClientModelDecoder::decodePayForPurchaseResultResponse(response.responseData);
         OnSuccessPayForPurchase.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessPayForPurchase.Unbind();
 }
 
 /** Buys a single item with virtual currency. You must specify both the virtual currency to use to purchase, as well as what the client believes the price to be. This lets the server fail the purchase if the price has changed. */
@@ -8472,9 +7213,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::PurchaseItem(FClientPurchaseItemRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8488,37 +7227,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::PurchaseItem(FClientPurchaseItemRequest re
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ItemId.IsEmpty() || request.ItemId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemId"), request.ItemId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("Price"), request.Price);
-    if (request.StoreId.IsEmpty() || request.StoreId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StoreId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StoreId"), request.StoreId);
-    }
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ItemId"), request.ItemId);
+    RequestWriter.WriteNumber(TEXT("Price"), request.Price);
+    RequestWriter.WriteStringOrNull(TEXT("StoreId"), request.StoreId);
+    RequestWriter.WriteStringOrNull(TEXT("VirtualCurrency"), request.VirtualCurrency);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8536,7 +7256,7 @@ void UPlayFabClientAPI::HelperPurchaseItem(FPlayFabBaseModel response, UObject*
         FClientPurchaseItemResult ResultStruct = UPlayFabClientModelDecoder::decodePurchaseItemResultResponse(response.responseData);
         OnSuccessPurchaseItem.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessPurchaseItem.Unbind();
 }
 
 /** Adds the virtual goods associated with the coupon to the user's inventory. Coupons can be generated via the Economy->Catalogs tab in the PlayFab Game Manager. */
@@ -8546,9 +7266,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::RedeemCoupon(FClientRedeemCouponRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8562,26 +7280,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::RedeemCoupon(FClientRedeemCouponRequest re
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CouponCode.IsEmpty() || request.CouponCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CouponCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CouponCode"), request.CouponCode);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteStringOrNull(TEXT("CouponCode"), request.CouponCode);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8599,7 +7306,7 @@ void UPlayFabClientAPI::HelperRedeemCoupon(FPlayFabBaseModel response, UObject*
         FClientRedeemCouponResult ResultStruct = UPlayFabClientModelDecoder::decodeRedeemCouponResultResponse(response.responseData);
         OnSuccessRedeemCoupon.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRedeemCoupon.Unbind();
 }
 
 /** Creates an order for a list of items from the title catalog */
@@ -8609,9 +7316,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::StartPurchase(FClientStartPurchaseRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8625,26 +7330,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::StartPurchase(FClientStartPurchaseRequest
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Items.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Items"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Items"), request.Items);
-    }
-    if (request.StoreId.IsEmpty() || request.StoreId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StoreId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StoreId"), request.StoreId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObjectArray(TEXT("Items"), request.Items);
+    RequestWriter.WriteStringOrNull(TEXT("StoreId"), request.StoreId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8662,7 +7356,7 @@ void UPlayFabClientAPI::HelperStartPurchase(FPlayFabBaseModel response, UObject*
         FClientStartPurchaseResult ResultStruct = UPlayFabClientModelDecoder::decodeStartPurchaseResultResponse(response.responseData);
         OnSuccessStartPurchase.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessStartPurchase.Unbind();
 }
 
 /** Decrements the user's balance of the specified virtual currency by the stated amount. It is possible to make a VC balance negative with this API. */
@@ -8672,9 +7366,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::SubtractUserVirtualCurrency(FClientSubtrac
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8688,17 +7380,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::SubtractUserVirtualCurrency(FClientSubtrac
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("Amount"), request.Amount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("VirtualCurrency"), request.VirtualCurrency);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8714,10 +7403,10 @@ void UPlayFabClientAPI::HelperSubtractUserVirtualCurrency(FPlayFabBaseModel resp
     else if (!error.hasError && OnSuccessSubtractUserVirtualCurrency.IsBound())
     {
         FClientModifyUserVirtualCurrencyResult ResultStruct = UPlayFabClientModelDecoder::decodeModifyUserVirtualCurrencyResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessSubtractUserVirtualCurrency.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSubtractUserVirtualCurrency.Unbind();
 }
 
 /** Opens the specified container, with the specified key (when required), and returns the contents of the opened container. If the container (and key when relevant) are consumable (RemainingUses > 0), their RemainingUses will be decremented, consistent with the operation of ConsumeItem. */
@@ -8727,9 +7416,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlockContainerInstance(FClientUnlockConta
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8743,31 +7430,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlockContainerInstance(FClientUnlockConta
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.ContainerItemInstanceId.IsEmpty() || request.ContainerItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ContainerItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ContainerItemInstanceId"), request.ContainerItemInstanceId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.KeyItemInstanceId.IsEmpty() || request.KeyItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeyItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("KeyItemInstanceId"), request.KeyItemInstanceId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteStringOrNull(TEXT("ContainerItemInstanceId"), request.ContainerItemInstanceId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("KeyItemInstanceId"), request.KeyItemInstanceId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8785,7 +7457,7 @@ void UPlayFabClientAPI::HelperUnlockContainerInstance(FPlayFabBaseModel response
         FClientUnlockContainerItemResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlockContainerItemResultResponse(response.responseData);
         OnSuccessUnlockContainerInstance.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlockContainerInstance.Unbind();
 }
 
 /** Searches target inventory for an ItemInstance matching the given CatalogItemId, if necessary unlocks it using an appropriate key, and returns the contents of the opened container. If the container (and key when relevant) are consumable (RemainingUses > 0), their RemainingUses will be decremented, consistent with the operation of ConsumeItem. */
@@ -8795,9 +7467,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlockContainerItem(FClientUnlockContainer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8811,26 +7481,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlockContainerItem(FClientUnlockContainer
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.ContainerItemId.IsEmpty() || request.ContainerItemId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ContainerItemId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ContainerItemId"), request.ContainerItemId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteStringOrNull(TEXT("ContainerItemId"), request.ContainerItemId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8846,10 +7505,10 @@ void UPlayFabClientAPI::HelperUnlockContainerItem(FPlayFabBaseModel response, UO
     else if (!error.hasError && OnSuccessUnlockContainerItem.IsBound())
     {
         FClientUnlockContainerItemResult ResultStruct = UPlayFabClientModelDecoder::decodeUnlockContainerItemResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUnlockContainerItem.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlockContainerItem.Unbind();
 }
 
 
@@ -8863,9 +7522,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerSegments(FClientGetPlayerSegments
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8879,10 +7536,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerSegments(FClientGetPlayerSegments
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8900,7 +7558,7 @@ void UPlayFabClientAPI::HelperGetPlayerSegments(FPlayFabBaseModel response, UObj
         FClientGetPlayerSegmentsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayerSegmentsResultResponse(response.responseData);
         OnSuccessGetPlayerSegments.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerSegments.Unbind();
 }
 
 /** Get all tags with a given Namespace (optional) from a player profile. */
@@ -8910,9 +7568,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerTags(FClientGetPlayerTagsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8926,21 +7582,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerTags(FClientGetPlayerTagsRequest
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Namespace.IsEmpty() || request.Namespace == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Namespace"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Namespace"), request.Namespace);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Namespace"), request.Namespace);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8958,7 +7607,7 @@ void UPlayFabClientAPI::HelperGetPlayerTags(FPlayFabBaseModel response, UObject*
         FClientGetPlayerTagsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayerTagsResultResponse(response.responseData);
         OnSuccessGetPlayerTags.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerTags.Unbind();
 }
 
 
@@ -8972,9 +7621,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::ExecuteCloudScript(FClientExecuteCloudScri
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8988,22 +7635,19 @@ UPlayFabClientAPI* UPlayFabClientAPI::ExecuteCloudScript(FClientExecuteCloudScri
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.FunctionName.IsEmpty() || request.FunctionName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FunctionName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FunctionName"), request.FunctionName);
-    }
-    if (request.FunctionParameter != nullptr) OutRestJsonObj->SetObjectField(TEXT("FunctionParameter"), request.FunctionParameter);
-    OutRestJsonObj->SetBoolField(TEXT("GeneratePlayStreamEvent"), request.GeneratePlayStreamEvent);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("FunctionName"), request.FunctionName);
+    RequestWriter.WriteObject(TEXT("FunctionParameter"), request.FunctionParameter);
+    RequestWriter.WriteBool(TEXT("GeneratePlayStreamEvent"), request.GeneratePlayStreamEvent);
     FString temp_RevisionSelection;
     if (GetEnumValueToString<ECloudScriptRevisionOption>(TEXT("ECloudScriptRevisionOption"), request.RevisionSelection, temp_RevisionSelection))
-        OutRestJsonObj->SetStringField(TEXT("RevisionSelection"), temp_RevisionSelection);
-    OutRestJsonObj->SetNumberField(TEXT("SpecificRevision"), request.SpecificRevision);
+        RequestWriter.WriteString(TEXT("RevisionSelection"), temp_RevisionSelection);
+    RequestWriter.WriteNumber(TEXT("SpecificRevision"), request.SpecificRevision);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -9021,7 +7665,7 @@ void UPlayFabClientAPI::HelperExecuteCloudScript(FPlayFabBaseModel response, UOb
         FClientExecuteCloudScriptResult ResultStruct = UPlayFabClientModelDecoder::decodeExecuteCloudScriptResultResponse(response.responseData);
         OnSuccessExecuteCloudScript.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessExecuteCloudScript.Unbind();
 }
 
 
@@ -9035,9 +7679,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddSharedGroupMembers(FClientAddSharedGrou
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9051,23 +7693,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddSharedGroupMembers(FClientAddSharedGrou
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.PlayFabIds.IsEmpty() || request.PlayFabIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabIds"));
-    } else {
-        TArray<FString> PlayFabIdsArray;
-        FString(request.PlayFabIds).ParseIntoArray(PlayFabIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("PlayFabIds"), PlayFabIdsArray);
-    }
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("PlayFabIds"), request.PlayFabIds);
+    RequestWriter.WriteStringOrNull(TEXT("SharedGroupId"), request.SharedGroupId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -9085,7 +7717,7 @@ void UPlayFabClientAPI::HelperAddSharedGroupMembers(FPlayFabBaseModel response,
         FClientAddSharedGroupMembersResult ResultStruct = UPlayFabClientModelDecoder::decodeAddSharedGroupMembersResultResponse(response.responseData);
         OnSuccessAddSharedGroupMembers.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddSharedGroupMembers.Unbind();
 }
 
 /** Requests the creation of a shared group object, containing key/value pairs which may be updated by all members of the group. Upon creation, the current user will be the only member of the group. Shared Groups are designed for sharing data between a very small number of players, please see our guide: https://docs.microsoft.com/gaming/playfab/features/social/groups/using-shared-group-data */
@@ -9095,9 +7727,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::CreateSharedGroup(FClientCreateSharedGroup
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9111,15 +7741,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::CreateSharedGroup(FClientCreateSharedGroup
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("SharedGroupId"), request.SharedGroupId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -9137,7 +7764,7 @@ void UPlayFabClientAPI::HelperCreateSharedGroup(FPlayFabBaseModel response, UObj
         FClientCreateSharedGroupResult ResultStruct = UPlayFabClientModelDecoder::decodeCreateSharedGroupResultResponse(response.responseData);
         OnSuccessCreateSharedGroup.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateSharedGroup.Unbind();
 }
 
 /** Retrieves data stored in a shared group object, as well as the list of members in the group. Non-members of the group may use this to retrieve group data, including membership, but they will not receive data for keys marked as private. Shared Groups are designed for sharing data between a very small number of players, please see our guide: https://docs.microsoft.com/gaming/playfab/features/social/groups/using-shared-group-data */
@@ -9147,9 +7774,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetSharedGroupData(FClientGetSharedGroupDa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9163,24 +7788,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetSharedGroupData(FClientGetSharedGroupDa
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("GetMembers"), request.GetMembers);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("GetMembers"), request.GetMembers);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("SharedGroupId"), request.SharedGroupId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -9198,7 +7813,7 @@ void UPlayFabClientAPI::HelperGetSharedGroupData(FPlayFabBaseModel response, UOb
         FClientGetSharedGroupDataResult ResultStruct = UPlayFabClientModelDecoder::decodeGetSharedGroupDataResultResponse(response.responseData);
         OnSuccessGetSharedGroupData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetSharedGroupData.Unbind();
 }
 
 /** Removes users from the set of those able to update the shared data and the set of users in the group. Only users in the group can remove members. If as a result of the call, zero users remain with access, the group and its associated data will be deleted. Shared Groups are designed for sharing data between a very small number of players, please see our guide: https://docs.microsoft.com/gaming/playfab/features/social/groups/using-shared-group-data */
@@ -9208,9 +7823,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveSharedGroupMembers(FClientRemoveShar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9224,23 +7837,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveSharedGroupMembers(FClientRemoveShar
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.PlayFabIds.IsEmpty() || request.PlayFabIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabIds"));
-    } else {
-        TArray<FString> PlayFabIdsArray;
-        FString(request.PlayFabIds).ParseIntoArray(PlayFabIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("PlayFabIds"), PlayFabIdsArray);
-    }
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("PlayFabIds"), request.PlayFabIds);
+    RequestWriter.WriteStringOrNull(TEXT("SharedGroupId"), request.SharedGroupId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -9258,7 +7861,7 @@ void UPlayFabClientAPI::HelperRemoveSharedGroupMembers(FPlayFabBaseModel respons
         FClientRemoveSharedGroupMembersResult ResultStruct = UPlayFabClientModelDecoder::decodeRemoveSharedGroupMembersResultResponse(response.responseData);
         OnSuccessRemoveSharedGroupMembers.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRemoveSharedGroupMembers.Unbind();
 }
 
 /** Adds, updates, and removes data keys for a shared group object. If the permission is set to Public, all fields updated or added in this call will be readable by users not in the group. By default, data permissions are set to Private. Regardless of the permission setting, only members of the group can update the data. Shared Groups are designed for sharing data between a very small number of players, please see our guide: https://docs.microsoft.com/gaming/playfab/features/social/groups/using-shared-group-data */
@@ -9268,9 +7871,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateSharedGroupData(FClientUpdateSharedG
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9284,28 +7885,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateSharedGroupData(FClientUpdateSharedG
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
     FString temp_Permission;
     if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
+        RequestWriter.WriteString(TEXT("Permission"), temp_Permission);
+    RequestWriter.WriteStringOrNull(TEXT("SharedGroupId"), request.SharedGroupId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -9323,7 +7914,7 @@ void UPlayFabClientAPI::HelperUpdateSharedGroupData(FPlayFabBaseModel response,
         FClientUpdateSharedGroupDataResult ResultStruct = UPlayFabClientModelDecoder::decodeUpdateSharedGroupDataResultResponse(response.responseData);
         OnSuccessUpdateSharedGroupData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateSharedGroupData.Unbind();
 }
 
 
@@ -9337,9 +7928,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCatalogItems(FClientGetCatalogItemsRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9353,15 +7942,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCatalogItems(FClientGetCatalogItemsRequ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -9379,7 +7965,7 @@ void UPlayFabClientAPI::HelperGetCatalogItems(FPlayFabBaseModel response, UObjec
         FClientGetCatalogItemsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetCatalogItemsResultResponse(response.responseData);
         OnSuccessGetCatalogItems.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetCatalogItems.Unbind();
 }
 
 /** Retrieves the key-value store of custom publisher settings */
@@ -9389,9 +7975,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPublisherData(FClientGetPublisherDataRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9405,18 +7989,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPublisherData(FClientGetPublisherDataRe
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -9434,7 +8012,7 @@ void UPlayFabClientAPI::HelperGetPublisherData(FPlayFabBaseModel response, UObje
         FClientGetPublisherDataResult ResultStruct = UPlayFabClientModelDecoder::decodeGetPublisherDataResultResponse(response.responseData);
         OnSuccessGetPublisherData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPublisherData.Unbind();
 }
 
 /** Retrieves the set of items defined for the specified store, including all prices defined */
@@ -9444,9 +8022,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetStoreItems(FClientGetStoreItemsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9460,20 +8036,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetStoreItems(FClientGetStoreItemsRequest
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.StoreId.IsEmpty() || request.StoreId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StoreId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StoreId"), request.StoreId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("StoreId"), request.StoreId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -9491,7 +8060,7 @@ void UPlayFabClientAPI::HelperGetStoreItems(FPlayFabBaseModel response, UObject*
         FClientGetStoreItemsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetStoreItemsResultResponse(response.responseData);
         OnSuccessGetStoreItems.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetStoreItems.Unbind();
 }
 
 /** Retrieves the current server time */
@@ -9501,9 +8070,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTime(FClientGetTimeRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9517,10 +8084,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTime(FClientGetTimeRequest request,
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -9538,7 +8106,7 @@ void UPlayFabClientAPI::HelperGetTime(FPlayFabBaseModel response, UObject* custo
         FClientGetTimeResult ResultStruct = UPlayFabClientModelDecoder::decodeGetTimeResultResponse(response.responseData);
         OnSuccessGetTime.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetTime.Unbind();
 }
 
 /** Retrieves the key-value store of custom title settings */
@@ -9548,9 +8116,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTitleData(FClientGetTitleDataRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9564,23 +8130,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTitleData(FClientGetTitleDataRequest re
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.OverrideLabel.IsEmpty() || request.OverrideLabel == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OverrideLabel"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OverrideLabel"), request.OverrideLabel);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("OverrideLabel"), request.OverrideLabel);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -9598,7 +8154,7 @@ void UPlayFabClientAPI::HelperGetTitleData(FPlayFabBaseModel response, UObject*
         FClientGetTitleDataResult ResultStruct = UPlayFabClientModelDecoder::decodeGetTitleDataResultResponse(response.responseData);
         OnSuccessGetTitleData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetTitleData.Unbind();
 }
 
 /** Retrieves the title news feed, as configured in the developer portal */
@@ -9608,9 +8164,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTitleNews(FClientGetTitleNewsRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9624,11 +8178,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTitleNews(FClientGetTitleNewsRequest re
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("Count"), request.Count);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("Count"), request.Count);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -9646,7 +8201,7 @@ void UPlayFabClientAPI::HelperGetTitleNews(FPlayFabBaseModel response, UObject*
         FClientGetTitleNewsResult ResultStruct = UPlayFabClientModelDecoder::decodeGetTitleNewsResultResponse(response.responseData);
         OnSuccessGetTitleNews.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetTitleNews.Unbind();
 }
 
 
@@ -9660,9 +8215,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::AcceptTrade(FClientAcceptTradeRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9676,28 +8229,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::AcceptTrade(FClientAcceptTradeRequest requ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.AcceptedInventoryInstanceIds.IsEmpty() || request.AcceptedInventoryInstanceIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AcceptedInventoryInstanceIds"));
-    } else {
-        TArray<FString> AcceptedInventoryInstanceIdsArray;
-        FString(request.AcceptedInventoryInstanceIds).ParseIntoArray(AcceptedInventoryInstanceIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("AcceptedInventoryInstanceIds"), AcceptedInventoryInstanceIdsArray);
-    }
-    if (request.OfferingPlayerId.IsEmpty() || request.OfferingPlayerId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OfferingPlayerId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OfferingPlayerId"), request.OfferingPlayerId);
-    }
-    if (request.TradeId.IsEmpty() || request.TradeId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TradeId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TradeId"), request.TradeId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("AcceptedInventoryInstanceIds"), request.AcceptedInventoryInstanceIds);
+    RequestWriter.WriteStringOrNull(TEXT("OfferingPlayerId"), request.OfferingPlayerId);
+    RequestWriter.WriteStringOrNull(TEXT("TradeId"), request.TradeId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -9715,7 +8254,7 @@ void UPlayFabClientAPI::HelperAcceptTrade(FPlayFabBaseModel response, UObject* c
         FClientAcceptTradeResponse ResultStruct = UPlayFabClientModelDecoder::decodeAcceptTradeResponseResponse(response.responseData);
         OnSuccessAcceptTrade.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAcceptTrade.Unbind();
 }
 
 /** Cancels an open trade (one that has not yet been accepted or cancelled). Note that only the player who created the trade can cancel it via this API call, to prevent griefing of the trade system (cancelling trades in order to prevent other players from accepting them, for trades that can be claimed by more than one player). */
@@ -9725,9 +8264,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::CancelTrade(FClientCancelTradeRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9741,15 +8278,12 @@ UPlayFabClientAPI* UPlayFabClientAPI::CancelTrade(FClientCancelTradeRequest requ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.TradeId.IsEmpty() || request.TradeId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TradeId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TradeId"), request.TradeId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("TradeId"), request.TradeId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -9767,7 +8301,7 @@ void UPlayFabClientAPI::HelperCancelTrade(FPlayFabBaseModel response, UObject* c
         FClientCancelTradeResponse ResultStruct = UPlayFabClientModelDecoder::decodeCancelTradeResponseResponse(response.responseData);
         OnSuccessCancelTrade.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCancelTrade.Unbind();
 }
 
 /** Gets all trades the player has either opened or accepted, optionally filtered by trade status. */
@@ -9777,9 +8311,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerTrades(FClientGetPlayerTradesRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9793,13 +8325,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerTrades(FClientGetPlayerTradesRequ
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
     FString temp_StatusFilter;
     if (GetEnumValueToString<ETradeStatus>(TEXT("ETradeStatus"), request.StatusFilter, temp_StatusFilter))
-        OutRestJsonObj->SetStringField(TEXT("StatusFilter"), temp_StatusFilter);
+        RequestWriter.WriteString(TEXT("StatusFilter"), temp_StatusFilter);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -9817,7 +8350,7 @@ void UPlayFabClientAPI::HelperGetPlayerTrades(FPlayFabBaseModel response, UObjec
         FClientGetPlayerTradesResponse ResultStruct = UPlayFabClientModelDecoder::decodeGetPlayerTradesResponseResponse(response.responseData);
         OnSuccessGetPlayerTrades.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerTrades.Unbind();
 }
 
 /** Gets the current status of an existing trade. */
@@ -9827,9 +8360,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTradeStatus(FClientGetTradeStatusReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9843,20 +8374,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTradeStatus(FClientGetTradeStatusReques
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    if (request.OfferingPlayerId.IsEmpty() || request.OfferingPlayerId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OfferingPlayerId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OfferingPlayerId"), request.OfferingPlayerId);
-    }
-    if (request.TradeId.IsEmpty() || request.TradeId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TradeId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TradeId"), request.TradeId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("OfferingPlayerId"), request.OfferingPlayerId);
+    RequestWriter.WriteStringOrNull(TEXT("TradeId"), request.TradeId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -9874,7 +8398,7 @@ void UPlayFabClientAPI::HelperGetTradeStatus(FPlayFabBaseModel response, UObject
         FClientGetTradeStatusResponse ResultStruct = UPlayFabClientModelDecoder::decodeGetTradeStatusResponseResponse(response.responseData);
         OnSuccessGetTradeStatus.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetTradeStatus.Unbind();
 }
 
 /** Opens a new outstanding trade. Note that a given item instance may only be in one open trade at a time. */
@@ -9884,9 +8408,7 @@ UPlayFabClientAPI* UPlayFabClientAPI::OpenTrade(FClientOpenTradeRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -9900,34 +8422,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::OpenTrade(FClientOpenTradeRequest request,
     manager->useSessionTicket = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.AllowedPlayerIds.IsEmpty() || request.AllowedPlayerIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AllowedPlayerIds"));
-    } else {
-        TArray<FString> AllowedPlayerIdsArray;
-        FString(request.AllowedPlayerIds).ParseIntoArray(AllowedPlayerIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("AllowedPlayerIds"), AllowedPlayerIdsArray);
-    }
-    // Check to see if string is empty
-    if (request.OfferedInventoryInstanceIds.IsEmpty() || request.OfferedInventoryInstanceIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OfferedInventoryInstanceIds"));
-    } else {
-        TArray<FString> OfferedInventoryInstanceIdsArray;
-        FString(request.OfferedInventoryInstanceIds).ParseIntoArray(OfferedInventoryInstanceIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("OfferedInventoryInstanceIds"), OfferedInventoryInstanceIdsArray);
-    }
-    // Check to see if string is empty
-    if (request.RequestedCatalogItemIds.IsEmpty() || request.RequestedCatalogItemIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RequestedCatalogItemIds"));
-    } else {
-        TArray<FString> RequestedCatalogItemIdsArray;
-        FString(request.RequestedCatalogItemIds).ParseIntoArray(RequestedCatalogItemIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("RequestedCatalogItemIds"), RequestedCatalogItemIdsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("AllowedPlayerIds"), request.AllowedPlayerIds);
+    RequestWriter.WriteStringArray(TEXT("OfferedInventoryInstanceIds"), request.OfferedInventoryInstanceIds);
+    RequestWriter.WriteStringArray(TEXT("RequestedCatalogItemIds"), request.RequestedCatalogItemIds);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -9945,13 +8447,16 @@ void UPlayFabClientAPI::HelperOpenTrade(FPlayFabBaseModel response, UObject* cus
         FClientOpenTradeResponse ResultStruct = UPlayFabClientModelDecoder::decodeOpenTradeResponseResponse(response.responseData);
         OnSuccessOpenTrade.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessOpenTrade.Unbind();
 }
 
 
 
 void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
+    PlayFabCommon::FPlayFabCallCounters::EndCall(Request->GetURL());
+    PLAYFAB_TRACE_END(Wait, Request);
+
     // Be sure that we have no data from previous response
     ResetResponseData();
 
@@ -9960,6 +8465,14 @@ void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         UE_LOG(LogPlayFab, Error, TEXT("The request object is invalid during OnProcessRequestComplete."));
         return;
     }
+
+    // The call is over however this returns; the result helpers run during the broadcast, before the proxy is cleared
+    // Only set up once the object is known to be valid, as an invalid one can't be trusted to go back to the pool
+    ON_SCOPE_EXIT
+    {
+        ReleaseToPool();
+    };
+
     if (!OnPlayFabResponse.IsBound())
     {
         UE_LOG(LogPlayFab, Error, TEXT("OnPlayFabResponse has come un-bound during OnProcessRequestComplete."));
@@ -9979,20 +8492,25 @@ void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         myResponse.responseError.ErrorName = "Unable to contact server";
         myResponse.responseError.ErrorMessage = "Unable to contact server";
 
+        PLAYFAB_TRACE_SCOPE(Dispatch, Request);
         OnPlayFabResponse.Broadcast(myResponse, mCustomData, false);
 
         return;
     }
 
-    // Save response data as a string
-    ResponseContent = Response->GetContentAsString();
+    {
+        PLAYFAB_TRACE_SCOPE(Decode, Request);
 
-    // Save response code as int32
-    ResponseCode = Response->GetResponseCode();
+        // Save response data as a string
+        ResponseContent = Response->GetContentAsString();
 
-    // Try to deserialize data to JSON
-    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-    FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+        // Save response code as int32
+        ResponseCode = Response->GetResponseCode();
+
+        // Try to deserialize data to JSON
+        TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
+        FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+    }
 
     // Decide whether the request was successful
     bIsValidJsonResponse = bWasSuccessful && ResponseJsonObj->GetRootObject().IsValid();
@@ -10002,7 +8520,7 @@ void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
 
     // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
+    PlayFabCommon::FPlayFabRequestLog::LogResponse(Request, ResponseCode, Response->GetContent());
 
     myResponse.responseError.decodeError(ResponseJsonObj);
     myResponse.responseData = ResponseJsonObj;
@@ -10039,8 +8557,8 @@ void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
     }
 
     // Broadcast the result event
+    PLAYFAB_TRACE_SCOPE(Dispatch, Request);
     OnPlayFabResponse.Broadcast(myResponse, mCustomData, !myResponse.responseError.hasError);
-    pfSettings->ModifyPendingCallCount(-1);
 }
 
 void UPlayFabClientAPI::Activate()
@@ -10098,24 +8616,55 @@ void UPlayFabClientAPI::Activate()
     for (TMap<FString, FString>::TConstIterator It(RequestHeaders); It; ++It)
         HttpRequest->SetHeader(It.Key(), It.Value());
 
-    // Serialize data to json string
-    FString OutputString;
-    TSharedRef< TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    // Requests made by the generated functions are already serialized; one set with SetRequestObject is serialized here
+    if (RequestJsonObj != nullptr && RequestBody.Num() == 0)
+    {
+        PLAYFAB_TRACE_SCOPE(Serialize, HttpRequest);
+        FMemoryWriter BodyStream(RequestBody);
+        PlayFab::JsonUtf8Writer Writer = TJsonWriterFactory<TCHAR, PlayFab::FPlayFabCondensedUtf8PrintPolicy>::Create(&BodyStream);
+        FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    }
 
     // Set Json content
-    HttpRequest->SetContentAsString(OutputString);
+    HttpRequest->SetContent(RequestBody);
 
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
+    PlayFabCommon::FPlayFabRequestLog::LogRequest(HttpRequest, RequestBody);
 
     // Bind event
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabClientAPI::OnProcessRequestComplete);
 
     // Execute the request
-    pfSettings->ModifyPendingCallCount(1);
+    PlayFabCommon::FPlayFabCallCounters::BeginCall(RequestUrl);
+    PLAYFAB_TRACE_BEGIN(Wait, HttpRequest);
+    PLAYFAB_TRACE_SCOPE(Send, HttpRequest);
     HttpRequest->ProcessRequest();
 }
 
+void UPlayFabClientAPI::ReleaseToPool()
+{
+    // Clear everything the next call through this proxy would otherwise inherit
+    OnPlayFabResponse.Clear();
+    OnFailure.Unbind();
+    mCustomData = nullptr;
+    CallAuthenticationContext = nullptr;
+    PlayFabRequestURL.Reset();
+    useEntityToken = false;
+    useSecretKey = false;
+    useSessionTicket = false;
+    returnsSessionTicket = false;
+    returnsEntityToken = false;
+    RequestHeaders.Reset();
+    ResponseContent.Reset();
+    ResponseCode = 0;
+    bIsValidJsonResponse = false;
+
+    // The request object is the caller's, or was handed to the caller with the result, so it isn't recycled
+    RequestBody.Reset();
+    RequestJsonObj = nullptr;
+    // The response object is kept with the proxy, and cleared when its next response arrives
+    FPlayFabObjectPool::Release(this);
+}
+
 void UPlayFabClientAPI::ResetResponseData()
 {
     if (ResponseJsonObj != nullptr)
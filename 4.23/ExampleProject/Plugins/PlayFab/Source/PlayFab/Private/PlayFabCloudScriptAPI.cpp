@@ -16,6 +16,12 @@
 #include "PlayFabEnums.h"
 #include "PlayFabCommon/Public/PlayFabAuthenticationContext.h"
 #include "PlayFabCommon/Public/PlayFabCommonUtils.h"
+#include "PlayFabCommon/Public/PlayFabCallCounters.h"
+#include "PlayFabCommon/Public/PlayFabTrace.h"
+#include "PlayFabCommon/Public/PlayFabRequestLog.h"
+#include "PlayFabObjectPool.h"
+#include "PlayFabRequestWriter.h"
+#include "Misc/ScopeExit.h"
 
 UPlayFabCloudScriptAPI::UPlayFabCloudScriptAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -30,7 +36,26 @@ void UPlayFabCloudScriptAPI::SetCallAuthenticationContext(UPlayFabAuthentication
 
 void UPlayFabCloudScriptAPI::SetRequestObject(UPlayFabJsonObject* JsonObject)
 {
+    // The object replaces any body serialized before, and is serialized in Activate
     RequestJsonObj = JsonObject;
+    RequestBody.Reset();
+}
+
+void UPlayFabCloudScriptAPI::SetRequestBody(TArray<uint8>&& Body)
+{
+    RequestBody = MoveTemp(Body);
+    RequestJsonObj = nullptr;
+}
+
+UPlayFabJsonObject* UPlayFabCloudScriptAPI::GetRequestObject()
+{
+    if (RequestJsonObj == nullptr && RequestBody.Num() > 0)
+    {
+        // Only the few results that hand the request back to Blueprint pay for parsing it
+        RequestJsonObj = NewObject<UPlayFabJsonObject>();
+        RequestJsonObj->DecodeJson(FPlayFabRequestWriter::ToString(RequestBody));
+    }
+    return RequestJsonObj;
 }
 
 UPlayFabJsonObject* UPlayFabCloudScriptAPI::GetResponseObject()
@@ -40,31 +65,7 @@ UPlayFabJsonObject* UPlayFabCloudScriptAPI::GetResponseObject()
 
 FString UPlayFabCloudScriptAPI::PercentEncode(const FString& Text)
 {
-    FString OutText = Text;
-
-    OutText = OutText.Replace(TEXT("!"), TEXT("%21"));
-    OutText = OutText.Replace(TEXT("\""), TEXT("%22"));
-    OutText = OutText.Replace(TEXT("#"), TEXT("%23"));
-    OutText = OutText.Replace(TEXT("$"), TEXT("%24"));
-    //OutText = OutText.Replace(TEXT("&"), TEXT("%26"));
-    OutText = OutText.Replace(TEXT("'"), TEXT("%27"));
-    OutText = OutText.Replace(TEXT("("), TEXT("%28"));
-    OutText = OutText.Replace(TEXT(")"), TEXT("%29"));
-    OutText = OutText.Replace(TEXT("*"), TEXT("%2A"));
-    OutText = OutText.Replace(TEXT("+"), TEXT("%2B"));
-    OutText = OutText.Replace(TEXT(","), TEXT("%2C"));
-    //OutText = OutText.Replace(TEXT("/"), TEXT("%2F"));
-    OutText = OutText.Replace(TEXT(":"), TEXT("%3A"));
-    OutText = OutText.Replace(TEXT(";"), TEXT("%3B"));
-    OutText = OutText.Replace(TEXT("="), TEXT("%3D"));
-    //OutText = OutText.Replace(TEXT("?"), TEXT("%3F"));
-    OutText = OutText.Replace(TEXT("@"), TEXT("%40"));
-    OutText = OutText.Replace(TEXT("["), TEXT("%5B"));
-    OutText = OutText.Replace(TEXT("]"), TEXT("%5D"));
-    OutText = OutText.Replace(TEXT("{"), TEXT("%7B"));
-    OutText = OutText.Replace(TEXT("}"), TEXT("%7D"));
-
-    return OutText;
+    return PlayFabCommon::PlayFabCommonUtils::PercentEncode(Text);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -82,9 +83,7 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::ExecuteEntityCloudScript(FCloudS
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabCloudScriptAPI* manager = NewObject<UPlayFabCloudScriptAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabCloudScriptAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabCloudScriptAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -98,23 +97,20 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::ExecuteEntityCloudScript(FCloudS
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.FunctionName.IsEmpty() || request.FunctionName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FunctionName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FunctionName"), request.FunctionName);
-    }
-    if (request.FunctionParameter != nullptr) OutRestJsonObj->SetObjectField(TEXT("FunctionParameter"), request.FunctionParameter);
-    OutRestJsonObj->SetBoolField(TEXT("GeneratePlayStreamEvent"), request.GeneratePlayStreamEvent);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteStringOrNull(TEXT("FunctionName"), request.FunctionName);
+    RequestWriter.WriteObject(TEXT("FunctionParameter"), request.FunctionParameter);
+    RequestWriter.WriteBool(TEXT("GeneratePlayStreamEvent"), request.GeneratePlayStreamEvent);
     FString temp_RevisionSelection;
     if (GetEnumValueToString<ECloudScriptRevisionOption>(TEXT("ECloudScriptRevisionOption"), request.RevisionSelection, temp_RevisionSelection))
-        OutRestJsonObj->SetStringField(TEXT("RevisionSelection"), temp_RevisionSelection);
-    OutRestJsonObj->SetNumberField(TEXT("SpecificRevision"), request.SpecificRevision);
+        RequestWriter.WriteString(TEXT("RevisionSelection"), temp_RevisionSelection);
+    RequestWriter.WriteNumber(TEXT("SpecificRevision"), request.SpecificRevision);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -132,7 +128,7 @@ void UPlayFabCloudScriptAPI::HelperExecuteEntityCloudScript(FPlayFabBaseModel re
         FCloudScriptExecuteCloudScriptResult ResultStruct = UPlayFabCloudScriptModelDecoder::decodeExecuteCloudScriptResultResponse(response.responseData);
         OnSuccessExecuteEntityCloudScript.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessExecuteEntityCloudScript.Unbind();
 }
 
 /** Cloud Script is one of PlayFab's most versatile features. It allows client code to request execution of any kind of custom server-side functionality you can implement, and it can be used in conjunction with virtually anything. */
@@ -142,9 +138,7 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::ExecuteFunction(FCloudScriptExec
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabCloudScriptAPI* manager = NewObject<UPlayFabCloudScriptAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabCloudScriptAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabCloudScriptAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -167,19 +161,16 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::ExecuteFunction(FCloudScriptExec
         manager->PlayFabRequestFullURL = url;
     }
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.FunctionName.IsEmpty() || request.FunctionName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FunctionName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FunctionName"), request.FunctionName);
-    }
-    if (request.FunctionParameter != nullptr) OutRestJsonObj->SetObjectField(TEXT("FunctionParameter"), request.FunctionParameter);
-    OutRestJsonObj->SetBoolField(TEXT("GeneratePlayStreamEvent"), request.GeneratePlayStreamEvent);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteStringOrNull(TEXT("FunctionName"), request.FunctionName);
+    RequestWriter.WriteObject(TEXT("FunctionParameter"), request.FunctionParameter);
+    RequestWriter.WriteBool(TEXT("GeneratePlayStreamEvent"), request.GeneratePlayStreamEvent);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -197,7 +188,7 @@ void UPlayFabCloudScriptAPI::HelperExecuteFunction(FPlayFabBaseModel response, U
         FCloudScriptExecuteFunctionResult ResultStruct = UPlayFabCloudScriptModelDecoder::decodeExecuteFunctionResultResponse(response.responseData);
         OnSuccessExecuteFunction.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessExecuteFunction.Unbind();
 }
 
 /** Lists all currently registered Azure Functions for a given title. */
@@ -207,9 +198,7 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::ListFunctions(FCloudScriptListFu
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabCloudScriptAPI* manager = NewObject<UPlayFabCloudScriptAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabCloudScriptAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabCloudScriptAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -223,11 +212,12 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::ListFunctions(FCloudScriptListFu
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -245,7 +235,7 @@ void UPlayFabCloudScriptAPI::HelperListFunctions(FPlayFabBaseModel response, UOb
         FCloudScriptListFunctionsResult ResultStruct = UPlayFabCloudScriptModelDecoder::decodeListFunctionsResultResponse(response.responseData);
         OnSuccessListFunctions.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListFunctions.Unbind();
 }
 
 /** Lists all currently registered HTTP triggered Azure Functions for a given title. */
@@ -255,9 +245,7 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::ListHttpFunctions(FCloudScriptLi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabCloudScriptAPI* manager = NewObject<UPlayFabCloudScriptAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabCloudScriptAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabCloudScriptAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -271,11 +259,12 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::ListHttpFunctions(FCloudScriptLi
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -293,7 +282,7 @@ void UPlayFabCloudScriptAPI::HelperListHttpFunctions(FPlayFabBaseModel response,
         FCloudScriptListHttpFunctionsResult ResultStruct = UPlayFabCloudScriptModelDecoder::decodeListHttpFunctionsResultResponse(response.responseData);
         OnSuccessListHttpFunctions.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListHttpFunctions.Unbind();
 }
 
 /** Lists all currently registered Queue triggered Azure Functions for a given title. */
@@ -303,9 +292,7 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::ListQueuedFunctions(FCloudScript
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabCloudScriptAPI* manager = NewObject<UPlayFabCloudScriptAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabCloudScriptAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabCloudScriptAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -319,11 +306,12 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::ListQueuedFunctions(FCloudScript
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -341,7 +329,7 @@ void UPlayFabCloudScriptAPI::HelperListQueuedFunctions(FPlayFabBaseModel respons
         FCloudScriptListQueuedFunctionsResult ResultStruct = UPlayFabCloudScriptModelDecoder::decodeListQueuedFunctionsResultResponse(response.responseData);
         OnSuccessListQueuedFunctions.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListQueuedFunctions.Unbind();
 }
 
 /** Generate an entity PlayStream event for the provided function result. */
@@ -351,9 +339,7 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::PostFunctionResultForEntityTrigg
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabCloudScriptAPI* manager = NewObject<UPlayFabCloudScriptAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabCloudScriptAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabCloudScriptAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -367,13 +353,14 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::PostFunctionResultForEntityTrigg
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.FunctionResult != nullptr) OutRestJsonObj->SetObjectField(TEXT("FunctionResult"), request.FunctionResult);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteObject(TEXT("FunctionResult"), request.FunctionResult);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -391,7 +378,7 @@ void UPlayFabCloudScriptAPI::HelperPostFunctionResultForEntityTriggeredAction(FP
         FCloudScriptEmptyResult ResultStruct = UPlayFabCloudScriptModelDecoder::decodeEmptyResultResponse(response.responseData);
         OnSuccessPostFunctionResultForEntityTriggeredAction.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessPostFunctionResultForEntityTriggeredAction.Unbind();
 }
 
 /** Generate an entity PlayStream event for the provided function result. */
@@ -401,9 +388,7 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::PostFunctionResultForFunctionExe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabCloudScriptAPI* manager = NewObject<UPlayFabCloudScriptAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabCloudScriptAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabCloudScriptAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -417,13 +402,14 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::PostFunctionResultForFunctionExe
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.FunctionResult != nullptr) OutRestJsonObj->SetObjectField(TEXT("FunctionResult"), request.FunctionResult);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteObject(TEXT("FunctionResult"), request.FunctionResult);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -439,10 +425,10 @@ void UPlayFabCloudScriptAPI::HelperPostFunctionResultForFunctionExecution(FPlayF
     else if (!error.hasError && OnSuccessPostFunctionResultForFunctionExecution.IsBound())
     {
         FCloudScriptEmptyResult ResultStruct = UPlayFabCloudScriptModelDecoder::decodeEmptyResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessPostFunctionResultForFunctionExecution.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessPostFunctionResultForFunctionExecution.Unbind();
 }
 
 /** Generate a player PlayStream event for the provided function result. */
@@ -452,9 +438,7 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::PostFunctionResultForPlayerTrigg
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabCloudScriptAPI* manager = NewObject<UPlayFabCloudScriptAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabCloudScriptAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabCloudScriptAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -468,15 +452,16 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::PostFunctionResultForPlayerTrigg
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.FunctionResult != nullptr) OutRestJsonObj->SetObjectField(TEXT("FunctionResult"), request.FunctionResult);
-    if (request.PlayerProfile != nullptr) OutRestJsonObj->SetObjectField(TEXT("PlayerProfile"), request.PlayerProfile);
-    if (request.PlayStreamEventEnvelope != nullptr) OutRestJsonObj->SetObjectField(TEXT("PlayStreamEventEnvelope"), request.PlayStreamEventEnvelope);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteObject(TEXT("FunctionResult"), request.FunctionResult);
+    RequestWriter.WriteObject(TEXT("PlayerProfile"), request.PlayerProfile);
+    RequestWriter.WriteObject(TEXT("PlayStreamEventEnvelope"), request.PlayStreamEventEnvelope);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -492,10 +477,10 @@ void UPlayFabCloudScriptAPI::HelperPostFunctionResultForPlayerTriggeredAction(FP
     else if (!error.hasError && OnSuccessPostFunctionResultForPlayerTriggeredAction.IsBound())
     {
         FCloudScriptEmptyResult ResultStruct = UPlayFabCloudScriptModelDecoder::decodeEmptyResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessPostFunctionResultForPlayerTriggeredAction.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessPostFunctionResultForPlayerTriggeredAction.Unbind();
 }
 
 /** Generate a PlayStream event for the provided function result. */
@@ -505,9 +490,7 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::PostFunctionResultForScheduledTa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabCloudScriptAPI* manager = NewObject<UPlayFabCloudScriptAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabCloudScriptAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabCloudScriptAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -521,14 +504,15 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::PostFunctionResultForScheduledTa
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.FunctionResult != nullptr) OutRestJsonObj->SetObjectField(TEXT("FunctionResult"), request.FunctionResult);
-    if (request.ScheduledTaskId != nullptr) OutRestJsonObj->SetObjectField(TEXT("ScheduledTaskId"), request.ScheduledTaskId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteObject(TEXT("FunctionResult"), request.FunctionResult);
+    RequestWriter.WriteObject(TEXT("ScheduledTaskId"), request.ScheduledTaskId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -544,10 +528,10 @@ void UPlayFabCloudScriptAPI::HelperPostFunctionResultForScheduledTask(FPlayFabBa
     else if (!error.hasError && OnSuccessPostFunctionResultForScheduledTask.IsBound())
     {
         FCloudScriptEmptyResult ResultStruct = UPlayFabCloudScriptModelDecoder::decodeEmptyResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessPostFunctionResultForScheduledTask.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessPostFunctionResultForScheduledTask.Unbind();
 }
 
 /** Registers an HTTP triggered Azure function with a title. */
@@ -557,9 +541,7 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::RegisterHttpFunction(FCloudScrip
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabCloudScriptAPI* manager = NewObject<UPlayFabCloudScriptAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabCloudScriptAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabCloudScriptAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -573,21 +555,14 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::RegisterHttpFunction(FCloudScrip
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.FunctionName.IsEmpty() || request.FunctionName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FunctionName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FunctionName"), request.FunctionName);
-    }
-    if (request.FunctionUrl.IsEmpty() || request.FunctionUrl == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FunctionUrl"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FunctionUrl"), request.FunctionUrl);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("FunctionName"), request.FunctionName);
+    RequestWriter.WriteStringOrNull(TEXT("FunctionUrl"), request.FunctionUrl);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -603,10 +578,10 @@ void UPlayFabCloudScriptAPI::HelperRegisterHttpFunction(FPlayFabBaseModel respon
     else if (!error.hasError && OnSuccessRegisterHttpFunction.IsBound())
     {
         FCloudScriptEmptyResult ResultStruct = UPlayFabCloudScriptModelDecoder::decodeEmptyResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessRegisterHttpFunction.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRegisterHttpFunction.Unbind();
 }
 
 /** Registers a queue triggered Azure Function with a title. */
@@ -616,9 +591,7 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::RegisterQueuedFunction(FCloudScr
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabCloudScriptAPI* manager = NewObject<UPlayFabCloudScriptAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabCloudScriptAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabCloudScriptAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -632,26 +605,15 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::RegisterQueuedFunction(FCloudScr
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.ConnectionString.IsEmpty() || request.ConnectionString == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ConnectionString"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ConnectionString"), request.ConnectionString);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.FunctionName.IsEmpty() || request.FunctionName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FunctionName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FunctionName"), request.FunctionName);
-    }
-    if (request.QueueName.IsEmpty() || request.QueueName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("QueueName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("QueueName"), request.QueueName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("ConnectionString"), request.ConnectionString);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("FunctionName"), request.FunctionName);
+    RequestWriter.WriteStringOrNull(TEXT("QueueName"), request.QueueName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -667,10 +629,10 @@ void UPlayFabCloudScriptAPI::HelperRegisterQueuedFunction(FPlayFabBaseModel resp
     else if (!error.hasError && OnSuccessRegisterQueuedFunction.IsBound())
     {
         FCloudScriptEmptyResult ResultStruct = UPlayFabCloudScriptModelDecoder::decodeEmptyResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessRegisterQueuedFunction.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRegisterQueuedFunction.Unbind();
 }
 
 /** Unregisters an Azure Function with a title. */
@@ -680,9 +642,7 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::UnregisterFunction(FCloudScriptU
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabCloudScriptAPI* manager = NewObject<UPlayFabCloudScriptAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabCloudScriptAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabCloudScriptAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -696,16 +656,13 @@ UPlayFabCloudScriptAPI* UPlayFabCloudScriptAPI::UnregisterFunction(FCloudScriptU
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.FunctionName.IsEmpty() || request.FunctionName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FunctionName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FunctionName"), request.FunctionName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("FunctionName"), request.FunctionName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -721,16 +678,19 @@ void UPlayFabCloudScriptAPI::HelperUnregisterFunction(FPlayFabBaseModel response
     else if (!error.hasError && OnSuccessUnregisterFunction.IsBound())
     {
         FCloudScriptEmptyResult ResultStruct = UPlayFabCloudScriptModelDecoder::decodeEmptyResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUnregisterFunction.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnregisterFunction.Unbind();
 }
 
 
 
 void UPlayFabCloudScriptAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
+    PlayFabCommon::FPlayFabCallCounters::EndCall(Request->GetURL());
+    PLAYFAB_TRACE_END(Wait, Request);
+
     // Be sure that we have no data from previous response
     ResetResponseData();
 
@@ -739,6 +699,14 @@ void UPlayFabCloudScriptAPI::OnProcessRequestComplete(FHttpRequestPtr Request, F
         UE_LOG(LogPlayFab, Error, TEXT("The request object is invalid during OnProcessRequestComplete."));
         return;
     }
+
+    // The call is over however this returns; the result helpers run during the broadcast, before the proxy is cleared
+    // Only set up once the object is known to be valid, as an invalid one can't be trusted to go back to the pool
+    ON_SCOPE_EXIT
+    {
+        ReleaseToPool();
+    };
+
     if (!OnPlayFabResponse.IsBound())
     {
         UE_LOG(LogPlayFab, Error, TEXT("OnPlayFabResponse has come un-bound during OnProcessRequestComplete."));
@@ -758,20 +726,25 @@ void UPlayFabCloudScriptAPI::OnProcessRequestComplete(FHttpRequestPtr Request, F
         myResponse.responseError.ErrorName = "Unable to contact server";
         myResponse.responseError.ErrorMessage = "Unable to contact server";
 
+        PLAYFAB_TRACE_SCOPE(Dispatch, Request);
         OnPlayFabResponse.Broadcast(myResponse, mCustomData, false);
 
         return;
     }
 
-    // Save response data as a string
-    ResponseContent = Response->GetContentAsString();
+    {
+        PLAYFAB_TRACE_SCOPE(Decode, Request);
+
+        // Save response data as a string
+        ResponseContent = Response->GetContentAsString();
 
-    // Save response code as int32
-    ResponseCode = Response->GetResponseCode();
+        // Save response code as int32
+        ResponseCode = Response->GetResponseCode();
 
-    // Try to deserialize data to JSON
-    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-    FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+        // Try to deserialize data to JSON
+        TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
+        FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+    }
 
     // Decide whether the request was successful
     bIsValidJsonResponse = bWasSuccessful && ResponseJsonObj->GetRootObject().IsValid();
@@ -781,7 +754,7 @@ void UPlayFabCloudScriptAPI::OnProcessRequestComplete(FHttpRequestPtr Request, F
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
 
     // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
+    PlayFabCommon::FPlayFabRequestLog::LogResponse(Request, ResponseCode, Response->GetContent());
 
     myResponse.responseError.decodeError(ResponseJsonObj);
     myResponse.responseData = ResponseJsonObj;
@@ -796,8 +769,8 @@ void UPlayFabCloudScriptAPI::OnProcessRequestComplete(FHttpRequestPtr Request, F
     }
 
     // Broadcast the result event
+    PLAYFAB_TRACE_SCOPE(Dispatch, Request);
     OnPlayFabResponse.Broadcast(myResponse, mCustomData, !myResponse.responseError.hasError);
-    pfSettings->ModifyPendingCallCount(-1);
 }
 
 void UPlayFabCloudScriptAPI::Activate()
@@ -855,24 +828,56 @@ void UPlayFabCloudScriptAPI::Activate()
     for (TMap<FString, FString>::TConstIterator It(RequestHeaders); It; ++It)
         HttpRequest->SetHeader(It.Key(), It.Value());
 
-    // Serialize data to json string
-    FString OutputString;
-    TSharedRef< TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    // Requests made by the generated functions are already serialized; one set with SetRequestObject is serialized here
+    if (RequestJsonObj != nullptr && RequestBody.Num() == 0)
+    {
+        PLAYFAB_TRACE_SCOPE(Serialize, HttpRequest);
+        FMemoryWriter BodyStream(RequestBody);
+        PlayFab::JsonUtf8Writer Writer = TJsonWriterFactory<TCHAR, PlayFab::FPlayFabCondensedUtf8PrintPolicy>::Create(&BodyStream);
+        FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    }
 
     // Set Json content
-    HttpRequest->SetContentAsString(OutputString);
+    HttpRequest->SetContent(RequestBody);
 
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
+    PlayFabCommon::FPlayFabRequestLog::LogRequest(HttpRequest, RequestBody);
 
     // Bind event
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabCloudScriptAPI::OnProcessRequestComplete);
 
     // Execute the request
-    pfSettings->ModifyPendingCallCount(1);
+    PlayFabCommon::FPlayFabCallCounters::BeginCall(RequestUrl);
+    PLAYFAB_TRACE_BEGIN(Wait, HttpRequest);
+    PLAYFAB_TRACE_SCOPE(Send, HttpRequest);
     HttpRequest->ProcessRequest();
 }
 
+void UPlayFabCloudScriptAPI::ReleaseToPool()
+{
+    // Clear everything the next call through this proxy would otherwise inherit
+    OnPlayFabResponse.Clear();
+    OnFailure.Unbind();
+    mCustomData = nullptr;
+    CallAuthenticationContext = nullptr;
+    PlayFabRequestURL.Reset();
+    PlayFabRequestFullURL.Reset();
+    useEntityToken = false;
+    useSecretKey = false;
+    useSessionTicket = false;
+    returnsSessionTicket = false;
+    returnsEntityToken = false;
+    RequestHeaders.Reset();
+    ResponseContent.Reset();
+    ResponseCode = 0;
+    bIsValidJsonResponse = false;
+
+    // The request object is the caller's, or was handed to the caller with the result, so it isn't recycled
+    RequestBody.Reset();
+    RequestJsonObj = nullptr;
+    // The response object is kept with the proxy, and cleared when its next response arrives
+    FPlayFabObjectPool::Release(this);
+}
+
 void UPlayFabCloudScriptAPI::ResetResponseData()
 {
     if (ResponseJsonObj != nullptr)
@@ -16,6 +16,12 @@
 #include "PlayFabEnums.h"
 #include "PlayFabCommon/Public/PlayFabAuthenticationContext.h"
 #include "PlayFabCommon/Public/PlayFabCommonUtils.h"
+#include "PlayFabCommon/Public/PlayFabCallCounters.h"
+#include "PlayFabCommon/Public/PlayFabTrace.h"
+#include "PlayFabCommon/Public/PlayFabRequestLog.h"
+#include "PlayFabObjectPool.h"
+#include "PlayFabRequestWriter.h"
+#include "Misc/ScopeExit.h"
 
 UPlayFabEventsAPI::UPlayFabEventsAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -30,7 +36,26 @@ void UPlayFabEventsAPI::SetCallAuthenticationContext(UPlayFabAuthenticationConte
 
 void UPlayFabEventsAPI::SetRequestObject(UPlayFabJsonObject* JsonObject)
 {
+    // The object replaces any body serialized before, and is serialized in Activate
     RequestJsonObj = JsonObject;
+    RequestBody.Reset();
+}
+
+void UPlayFabEventsAPI::SetRequestBody(TArray<uint8>&& Body)
+{
+    RequestBody = MoveTemp(Body);
+    RequestJsonObj = nullptr;
+}
+
+UPlayFabJsonObject* UPlayFabEventsAPI::GetRequestObject()
+{
+    if (RequestJsonObj == nullptr && RequestBody.Num() > 0)
+    {
+        // Only the few results that hand the request back to Blueprint pay for parsing it
+        RequestJsonObj = NewObject<UPlayFabJsonObject>();
+        RequestJsonObj->DecodeJson(FPlayFabRequestWriter::ToString(RequestBody));
+    }
+    return RequestJsonObj;
 }
 
 UPlayFabJsonObject* UPlayFabEventsAPI::GetResponseObject()
@@ -40,31 +65,7 @@ UPlayFabJsonObject* UPlayFabEventsAPI::GetResponseObject()
 
 FString UPlayFabEventsAPI::PercentEncode(const FString& Text)
 {
-    FString OutText = Text;
-
-    OutText = OutText.Replace(TEXT("!"), TEXT("%21"));
-    OutText = OutText.Replace(TEXT("\""), TEXT("%22"));
-    OutText = OutText.Replace(TEXT("#"), TEXT("%23"));
-    OutText = OutText.Replace(TEXT("$"), TEXT("%24"));
-    //OutText = OutText.Replace(TEXT("&"), TEXT("%26"));
-    OutText = OutText.Replace(TEXT("'"), TEXT("%27"));
-    OutText = OutText.Replace(TEXT("("), TEXT("%28"));
-    OutText = OutText.Replace(TEXT(")"), TEXT("%29"));
-    OutText = OutText.Replace(TEXT("*"), TEXT("%2A"));
-    OutText = OutText.Replace(TEXT("+"), TEXT("%2B"));
-    OutText = OutText.Replace(TEXT(","), TEXT("%2C"));
-    //OutText = OutText.Replace(TEXT("/"), TEXT("%2F"));
-    OutText = OutText.Replace(TEXT(":"), TEXT("%3A"));
-    OutText = OutText.Replace(TEXT(";"), TEXT("%3B"));
-    OutText = OutText.Replace(TEXT("="), TEXT("%3D"));
-    //OutText = OutText.Replace(TEXT("?"), TEXT("%3F"));
-    OutText = OutText.Replace(TEXT("@"), TEXT("%40"));
-    OutText = OutText.Replace(TEXT("["), TEXT("%5B"));
-    OutText = OutText.Replace(TEXT("]"), TEXT("%5D"));
-    OutText = OutText.Replace(TEXT("{"), TEXT("%7B"));
-    OutText = OutText.Replace(TEXT("}"), TEXT("%7D"));
-
-    return OutText;
+    return PlayFabCommon::PlayFabCommonUtils::PercentEncode(Text);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -82,9 +83,7 @@ UPlayFabEventsAPI* UPlayFabEventsAPI::WriteEvents(FEventsWriteEventsRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabEventsAPI* manager = NewObject<UPlayFabEventsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabEventsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabEventsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -98,16 +97,13 @@ UPlayFabEventsAPI* UPlayFabEventsAPI::WriteEvents(FEventsWriteEventsRequest requ
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Events.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Events"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Events"), request.Events);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObjectArray(TEXT("Events"), request.Events);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -125,7 +121,7 @@ void UPlayFabEventsAPI::HelperWriteEvents(FPlayFabBaseModel response, UObject* c
         FEventsWriteEventsResponse ResultStruct = UPlayFabEventsModelDecoder::decodeWriteEventsResponseResponse(response.responseData);
         OnSuccessWriteEvents.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessWriteEvents.Unbind();
 }
 
 /** Write batches of entity based events to as Telemetry events (bypass PlayStream). The namespace must be 'custom' or start with 'custom.' */
@@ -135,9 +131,7 @@ UPlayFabEventsAPI* UPlayFabEventsAPI::WriteTelemetryEvents(FEventsWriteEventsReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabEventsAPI* manager = NewObject<UPlayFabEventsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabEventsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabEventsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -151,16 +145,13 @@ UPlayFabEventsAPI* UPlayFabEventsAPI::WriteTelemetryEvents(FEventsWriteEventsReq
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Events.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Events"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Events"), request.Events);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObjectArray(TEXT("Events"), request.Events);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -176,16 +167,19 @@ void UPlayFabEventsAPI::HelperWriteTelemetryEvents(FPlayFabBaseModel response, U
     else if (!error.hasError && OnSuccessWriteTelemetryEvents.IsBound())
     {
         FEventsWriteEventsResponse ResultStruct = UPlayFabEventsModelDecoder::decodeWriteEventsResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessWriteTelemetryEvents.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessWriteTelemetryEvents.Unbind();
 }
 
 
 
 void UPlayFabEventsAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
+    PlayFabCommon::FPlayFabCallCounters::EndCall(Request->GetURL());
+    PLAYFAB_TRACE_END(Wait, Request);
+
     // Be sure that we have no data from previous response
     ResetResponseData();
 
@@ -194,6 +188,14 @@ void UPlayFabEventsAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         UE_LOG(LogPlayFab, Error, TEXT("The request object is invalid during OnProcessRequestComplete."));
         return;
     }
+
+    // The call is over however this returns; the result helpers run during the broadcast, before the proxy is cleared
+    // Only set up once the object is known to be valid, as an invalid one can't be trusted to go back to the pool
+    ON_SCOPE_EXIT
+    {
+        ReleaseToPool();
+    };
+
     if (!OnPlayFabResponse.IsBound())
     {
         UE_LOG(LogPlayFab, Error, TEXT("OnPlayFabResponse has come un-bound during OnProcessRequestComplete."));
@@ -213,20 +215,25 @@ void UPlayFabEventsAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         myResponse.responseError.ErrorName = "Unable to contact server";
         myResponse.responseError.ErrorMessage = "Unable to contact server";
 
+        PLAYFAB_TRACE_SCOPE(Dispatch, Request);
         OnPlayFabResponse.Broadcast(myResponse, mCustomData, false);
 
         return;
     }
 
-    // Save response data as a string
-    ResponseContent = Response->GetContentAsString();
+    {
+        PLAYFAB_TRACE_SCOPE(Decode, Request);
+
+        // Save response data as a string
+        ResponseContent = Response->GetContentAsString();
 
-    // Save response code as int32
-    ResponseCode = Response->GetResponseCode();
+        // Save response code as int32
+        ResponseCode = Response->GetResponseCode();
 
-    // Try to deserialize data to JSON
-    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-    FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+        // Try to deserialize data to JSON
+        TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
+        FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+    }
 
     // Decide whether the request was successful
     bIsValidJsonResponse = bWasSuccessful && ResponseJsonObj->GetRootObject().IsValid();
@@ -236,7 +243,7 @@ void UPlayFabEventsAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
 
     // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
+    PlayFabCommon::FPlayFabRequestLog::LogResponse(Request, ResponseCode, Response->GetContent());
 
     myResponse.responseError.decodeError(ResponseJsonObj);
     myResponse.responseData = ResponseJsonObj;
@@ -251,8 +258,8 @@ void UPlayFabEventsAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
     }
 
     // Broadcast the result event
+    PLAYFAB_TRACE_SCOPE(Dispatch, Request);
     OnPlayFabResponse.Broadcast(myResponse, mCustomData, !myResponse.responseError.hasError);
-    pfSettings->ModifyPendingCallCount(-1);
 }
 
 void UPlayFabEventsAPI::Activate()
@@ -310,24 +317,55 @@ void UPlayFabEventsAPI::Activate()
     for (TMap<FString, FString>::TConstIterator It(RequestHeaders); It; ++It)
         HttpRequest->SetHeader(It.Key(), It.Value());
 
-    // Serialize data to json string
-    FString OutputString;
-    TSharedRef< TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    // Requests made by the generated functions are already serialized; one set with SetRequestObject is serialized here
+    if (RequestJsonObj != nullptr && RequestBody.Num() == 0)
+    {
+        PLAYFAB_TRACE_SCOPE(Serialize, HttpRequest);
+        FMemoryWriter BodyStream(RequestBody);
+        PlayFab::JsonUtf8Writer Writer = TJsonWriterFactory<TCHAR, PlayFab::FPlayFabCondensedUtf8PrintPolicy>::Create(&BodyStream);
+        FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    }
 
     // Set Json content
-    HttpRequest->SetContentAsString(OutputString);
+    HttpRequest->SetContent(RequestBody);
 
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
+    PlayFabCommon::FPlayFabRequestLog::LogRequest(HttpRequest, RequestBody);
 
     // Bind event
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabEventsAPI::OnProcessRequestComplete);
 
     // Execute the request
-    pfSettings->ModifyPendingCallCount(1);
+    PlayFabCommon::FPlayFabCallCounters::BeginCall(RequestUrl);
+    PLAYFAB_TRACE_BEGIN(Wait, HttpRequest);
+    PLAYFAB_TRACE_SCOPE(Send, HttpRequest);
     HttpRequest->ProcessRequest();
 }
 
+void UPlayFabEventsAPI::ReleaseToPool()
+{
+    // Clear everything the next call through this proxy would otherwise inherit
+    OnPlayFabResponse.Clear();
+    OnFailure.Unbind();
+    mCustomData = nullptr;
+    CallAuthenticationContext = nullptr;
+    PlayFabRequestURL.Reset();
+    useEntityToken = false;
+    useSecretKey = false;
+    useSessionTicket = false;
+    returnsSessionTicket = false;
+    returnsEntityToken = false;
+    RequestHeaders.Reset();
+    ResponseContent.Reset();
+    ResponseCode = 0;
+    bIsValidJsonResponse = false;
+
+    // The request object is the caller's, or was handed to the caller with the result, so it isn't recycled
+    RequestBody.Reset();
+    RequestJsonObj = nullptr;
+    // The response object is kept with the proxy, and cleared when its next response arrives
+    FPlayFabObjectPool::Release(this);
+}
+
 void UPlayFabEventsAPI::ResetResponseData()
 {
     if (ResponseJsonObj != nullptr)
@@ -16,6 +16,12 @@
 #include "PlayFabEnums.h"
 #include "PlayFabCommon/Public/PlayFabAuthenticationContext.h"
 #include "PlayFabCommon/Public/PlayFabCommonUtils.h"
+#include "PlayFabCommon/Public/PlayFabCallCounters.h"
+#include "PlayFabCommon/Public/PlayFabTrace.h"
+#include "PlayFabCommon/Public/PlayFabRequestLog.h"
+#include "PlayFabObjectPool.h"
+#include "PlayFabRequestWriter.h"
+#include "Misc/ScopeExit.h"
 
 UPlayFabGroupsAPI::UPlayFabGroupsAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -30,7 +36,26 @@ void UPlayFabGroupsAPI::SetCallAuthenticationContext(UPlayFabAuthenticationConte
 
 void UPlayFabGroupsAPI::SetRequestObject(UPlayFabJsonObject* JsonObject)
 {
+    // The object replaces any body serialized before, and is serialized in Activate
     RequestJsonObj = JsonObject;
+    RequestBody.Reset();
+}
+
+void UPlayFabGroupsAPI::SetRequestBody(TArray<uint8>&& Body)
+{
+    RequestBody = MoveTemp(Body);
+    RequestJsonObj = nullptr;
+}
+
+UPlayFabJsonObject* UPlayFabGroupsAPI::GetRequestObject()
+{
+    if (RequestJsonObj == nullptr && RequestBody.Num() > 0)
+    {
+        // Only the few results that hand the request back to Blueprint pay for parsing it
+        RequestJsonObj = NewObject<UPlayFabJsonObject>();
+        RequestJsonObj->DecodeJson(FPlayFabRequestWriter::ToString(RequestBody));
+    }
+    return RequestJsonObj;
 }
 
 UPlayFabJsonObject* UPlayFabGroupsAPI::GetResponseObject()
@@ -40,31 +65,7 @@ UPlayFabJsonObject* UPlayFabGroupsAPI::GetResponseObject()
 
 FString UPlayFabGroupsAPI::PercentEncode(const FString& Text)
 {
-    FString OutText = Text;
-
-    OutText = OutText.Replace(TEXT("!"), TEXT("%21"));
-    OutText = OutText.Replace(TEXT("\""), TEXT("%22"));
-    OutText = OutText.Replace(TEXT("#"), TEXT("%23"));
-    OutText = OutText.Replace(TEXT("$"), TEXT("%24"));
-    //OutText = OutText.Replace(TEXT("&"), TEXT("%26"));
-    OutText = OutText.Replace(TEXT("'"), TEXT("%27"));
-    OutText = OutText.Replace(TEXT("("), TEXT("%28"));
-    OutText = OutText.Replace(TEXT(")"), TEXT("%29"));
-    OutText = OutText.Replace(TEXT("*"), TEXT("%2A"));
-    OutText = OutText.Replace(TEXT("+"), TEXT("%2B"));
-    OutText = OutText.Replace(TEXT(","), TEXT("%2C"));
-    //OutText = OutText.Replace(TEXT("/"), TEXT("%2F"));
-    OutText = OutText.Replace(TEXT(":"), TEXT("%3A"));
-    OutText = OutText.Replace(TEXT(";"), TEXT("%3B"));
-    OutText = OutText.Replace(TEXT("="), TEXT("%3D"));
-    //OutText = OutText.Replace(TEXT("?"), TEXT("%3F"));
-    OutText = OutText.Replace(TEXT("@"), TEXT("%40"));
-    OutText = OutText.Replace(TEXT("["), TEXT("%5B"));
-    OutText = OutText.Replace(TEXT("]"), TEXT("%5D"));
-    OutText = OutText.Replace(TEXT("{"), TEXT("%7B"));
-    OutText = OutText.Replace(TEXT("}"), TEXT("%7D"));
-
-    return OutText;
+    return PlayFabCommon::PlayFabCommonUtils::PercentEncode(Text);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -82,9 +83,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::AcceptGroupApplication(FGroupsAcceptGroupA
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -98,13 +97,14 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::AcceptGroupApplication(FGroupsAcceptGroupA
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -122,7 +122,7 @@ void UPlayFabGroupsAPI::HelperAcceptGroupApplication(FPlayFabBaseModel response,
         FGroupsEmptyResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeEmptyResponseResponse(response.responseData);
         OnSuccessAcceptGroupApplication.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAcceptGroupApplication.Unbind();
 }
 
 /** Accepts an invitation to join a group */
@@ -132,9 +132,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::AcceptGroupInvitation(FGroupsAcceptGroupIn
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -148,13 +146,14 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::AcceptGroupInvitation(FGroupsAcceptGroupIn
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -170,10 +169,10 @@ void UPlayFabGroupsAPI::HelperAcceptGroupInvitation(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessAcceptGroupInvitation.IsBound())
     {
         FGroupsEmptyResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessAcceptGroupInvitation.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAcceptGroupInvitation.Unbind();
 }
 
 /** Adds members to a group or role. */
@@ -183,9 +182,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::AddMembers(FGroupsAddMembersRequest reques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -199,22 +196,15 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::AddMembers(FGroupsAddMembersRequest reques
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
-    if (request.Members.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Members"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Members"), request.Members);
-    }
-    if (request.RoleId.IsEmpty() || request.RoleId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RoleId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("RoleId"), request.RoleId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
+    RequestWriter.WriteObjectArray(TEXT("Members"), request.Members);
+    RequestWriter.WriteStringOrNull(TEXT("RoleId"), request.RoleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -230,10 +220,10 @@ void UPlayFabGroupsAPI::HelperAddMembers(FPlayFabBaseModel response, UObject* cu
     else if (!error.hasError && OnSuccessAddMembers.IsBound())
     {
         FGroupsEmptyResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessAddMembers.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddMembers.Unbind();
 }
 
 /** Applies to join a group */
@@ -243,9 +233,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::ApplyToGroup(FGroupsApplyToGroupRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -259,14 +247,15 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::ApplyToGroup(FGroupsApplyToGroupRequest re
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("AutoAcceptOutstandingInvite"), request.AutoAcceptOutstandingInvite);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("AutoAcceptOutstandingInvite"), request.AutoAcceptOutstandingInvite);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -284,7 +273,7 @@ void UPlayFabGroupsAPI::HelperApplyToGroup(FPlayFabBaseModel response, UObject*
         FGroupsApplyToGroupResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeApplyToGroupResponseResponse(response.responseData);
         OnSuccessApplyToGroup.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessApplyToGroup.Unbind();
 }
 
 /** Blocks a list of entities from joining a group. */
@@ -294,9 +283,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::BlockEntity(FGroupsBlockEntityRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -310,13 +297,14 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::BlockEntity(FGroupsBlockEntityRequest requ
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -332,10 +320,10 @@ void UPlayFabGroupsAPI::HelperBlockEntity(FPlayFabBaseModel response, UObject* c
     else if (!error.hasError && OnSuccessBlockEntity.IsBound())
     {
         FGroupsEmptyResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessBlockEntity.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessBlockEntity.Unbind();
 }
 
 /** Changes the role membership of a list of entities from one role to another. */
@@ -345,9 +333,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::ChangeMemberRole(FGroupsChangeMemberRoleRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -361,27 +347,16 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::ChangeMemberRole(FGroupsChangeMemberRoleRe
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.DestinationRoleId.IsEmpty() || request.DestinationRoleId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DestinationRoleId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DestinationRoleId"), request.DestinationRoleId);
-    }
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
-    if (request.Members.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Members"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Members"), request.Members);
-    }
-    if (request.OriginRoleId.IsEmpty() || request.OriginRoleId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OriginRoleId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OriginRoleId"), request.OriginRoleId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("DestinationRoleId"), request.DestinationRoleId);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
+    RequestWriter.WriteObjectArray(TEXT("Members"), request.Members);
+    RequestWriter.WriteStringOrNull(TEXT("OriginRoleId"), request.OriginRoleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -397,10 +372,10 @@ void UPlayFabGroupsAPI::HelperChangeMemberRole(FPlayFabBaseModel response, UObje
     else if (!error.hasError && OnSuccessChangeMemberRole.IsBound())
     {
         FGroupsEmptyResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessChangeMemberRole.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessChangeMemberRole.Unbind();
 }
 
 /** Creates a new group. */
@@ -410,9 +385,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::CreateGroup(FGroupsCreateGroupRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -426,17 +399,14 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::CreateGroup(FGroupsCreateGroupRequest requ
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.GroupName.IsEmpty() || request.GroupName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GroupName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GroupName"), request.GroupName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteStringOrNull(TEXT("GroupName"), request.GroupName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -454,7 +424,7 @@ void UPlayFabGroupsAPI::HelperCreateGroup(FPlayFabBaseModel response, UObject* c
         FGroupsCreateGroupResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeCreateGroupResponseResponse(response.responseData);
         OnSuccessCreateGroup.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateGroup.Unbind();
 }
 
 /** Creates a new group role. */
@@ -464,9 +434,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::CreateRole(FGroupsCreateGroupRoleRequest r
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -480,22 +448,15 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::CreateRole(FGroupsCreateGroupRoleRequest r
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
-    if (request.RoleId.IsEmpty() || request.RoleId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RoleId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("RoleId"), request.RoleId);
-    }
-    if (request.RoleName.IsEmpty() || request.RoleName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RoleName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("RoleName"), request.RoleName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
+    RequestWriter.WriteStringOrNull(TEXT("RoleId"), request.RoleId);
+    RequestWriter.WriteStringOrNull(TEXT("RoleName"), request.RoleName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -513,7 +474,7 @@ void UPlayFabGroupsAPI::HelperCreateRole(FPlayFabBaseModel response, UObject* cu
         FGroupsCreateGroupRoleResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeCreateGroupRoleResponseResponse(response.responseData);
         OnSuccessCreateRole.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateRole.Unbind();
 }
 
 /** Deletes a group and all roles, invitations, join requests, and blocks associated with it. */
@@ -523,9 +484,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::DeleteGroup(FGroupsDeleteGroupRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -539,12 +498,13 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::DeleteGroup(FGroupsDeleteGroupRequest requ
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -560,10 +520,10 @@ void UPlayFabGroupsAPI::HelperDeleteGroup(FPlayFabBaseModel response, UObject* c
     else if (!error.hasError && OnSuccessDeleteGroup.IsBound())
     {
         FGroupsEmptyResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessDeleteGroup.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteGroup.Unbind();
 }
 
 /** Deletes an existing role in a group. */
@@ -573,9 +533,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::DeleteRole(FGroupsDeleteRoleRequest reques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -589,17 +547,14 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::DeleteRole(FGroupsDeleteRoleRequest reques
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
-    if (request.RoleId.IsEmpty() || request.RoleId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RoleId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("RoleId"), request.RoleId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
+    RequestWriter.WriteStringOrNull(TEXT("RoleId"), request.RoleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -615,10 +570,10 @@ void UPlayFabGroupsAPI::HelperDeleteRole(FPlayFabBaseModel response, UObject* cu
     else if (!error.hasError && OnSuccessDeleteRole.IsBound())
     {
         FGroupsEmptyResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessDeleteRole.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteRole.Unbind();
 }
 
 /** Gets information about a group and its roles */
@@ -628,9 +583,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::GetGroup(FGroupsGetGroupRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -644,17 +597,14 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::GetGroup(FGroupsGetGroupRequest request,
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
-    if (request.GroupName.IsEmpty() || request.GroupName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GroupName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GroupName"), request.GroupName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
+    RequestWriter.WriteStringOrNull(TEXT("GroupName"), request.GroupName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -672,7 +622,7 @@ void UPlayFabGroupsAPI::HelperGetGroup(FPlayFabBaseModel response, UObject* cust
         FGroupsGetGroupResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeGetGroupResponseResponse(response.responseData);
         OnSuccessGetGroup.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetGroup.Unbind();
 }
 
 /** Invites a player to join a group */
@@ -682,9 +632,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::InviteToGroup(FGroupsInviteToGroupRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -698,19 +646,16 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::InviteToGroup(FGroupsInviteToGroupRequest
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("AutoAcceptOutstandingApplication"), request.AutoAcceptOutstandingApplication);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
-    if (request.RoleId.IsEmpty() || request.RoleId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RoleId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("RoleId"), request.RoleId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("AutoAcceptOutstandingApplication"), request.AutoAcceptOutstandingApplication);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
+    RequestWriter.WriteStringOrNull(TEXT("RoleId"), request.RoleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -728,7 +673,7 @@ void UPlayFabGroupsAPI::HelperInviteToGroup(FPlayFabBaseModel response, UObject*
         FGroupsInviteToGroupResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeInviteToGroupResponseResponse(response.responseData);
         OnSuccessInviteToGroup.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessInviteToGroup.Unbind();
 }
 
 /** Checks to see if an entity is a member of a group or role within the group */
@@ -738,9 +683,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::IsMember(FGroupsIsMemberRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -754,18 +697,15 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::IsMember(FGroupsIsMemberRequest request,
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
-    if (request.RoleId.IsEmpty() || request.RoleId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RoleId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("RoleId"), request.RoleId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
+    RequestWriter.WriteStringOrNull(TEXT("RoleId"), request.RoleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -783,7 +723,7 @@ void UPlayFabGroupsAPI::HelperIsMember(FPlayFabBaseModel response, UObject* cust
         FGroupsIsMemberResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeIsMemberResponseResponse(response.responseData);
         OnSuccessIsMember.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessIsMember.Unbind();
 }
 
 /** Lists all outstanding requests to join a group */
@@ -793,9 +733,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::ListGroupApplications(FGroupsListGroupAppl
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -809,12 +747,13 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::ListGroupApplications(FGroupsListGroupAppl
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -832,7 +771,7 @@ void UPlayFabGroupsAPI::HelperListGroupApplications(FPlayFabBaseModel response,
         FGroupsListGroupApplicationsResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeListGroupApplicationsResponseResponse(response.responseData);
         OnSuccessListGroupApplications.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListGroupApplications.Unbind();
 }
 
 /** Lists all entities blocked from joining a group */
@@ -842,9 +781,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::ListGroupBlocks(FGroupsListGroupBlocksRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -858,12 +795,13 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::ListGroupBlocks(FGroupsListGroupBlocksRequ
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -881,7 +819,7 @@ void UPlayFabGroupsAPI::HelperListGroupBlocks(FPlayFabBaseModel response, UObjec
         FGroupsListGroupBlocksResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeListGroupBlocksResponseResponse(response.responseData);
         OnSuccessListGroupBlocks.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListGroupBlocks.Unbind();
 }
 
 /** Lists all outstanding invitations for a group */
@@ -891,9 +829,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::ListGroupInvitations(FGroupsListGroupInvit
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -907,12 +843,13 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::ListGroupInvitations(FGroupsListGroupInvit
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -930,7 +867,7 @@ void UPlayFabGroupsAPI::HelperListGroupInvitations(FPlayFabBaseModel response, U
         FGroupsListGroupInvitationsResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeListGroupInvitationsResponseResponse(response.responseData);
         OnSuccessListGroupInvitations.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListGroupInvitations.Unbind();
 }
 
 /** Lists all members for a group */
@@ -940,9 +877,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::ListGroupMembers(FGroupsListGroupMembersRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -956,12 +891,13 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::ListGroupMembers(FGroupsListGroupMembersRe
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -979,7 +915,7 @@ void UPlayFabGroupsAPI::HelperListGroupMembers(FPlayFabBaseModel response, UObje
         FGroupsListGroupMembersResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeListGroupMembersResponseResponse(response.responseData);
         OnSuccessListGroupMembers.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListGroupMembers.Unbind();
 }
 
 /** Lists all groups and roles for an entity */
@@ -989,9 +925,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::ListMembership(FGroupsListMembershipReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1005,12 +939,13 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::ListMembership(FGroupsListMembershipReques
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1028,7 +963,7 @@ void UPlayFabGroupsAPI::HelperListMembership(FPlayFabBaseModel response, UObject
         FGroupsListMembershipResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeListMembershipResponseResponse(response.responseData);
         OnSuccessListMembership.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListMembership.Unbind();
 }
 
 /** Lists all outstanding invitations and group applications for an entity */
@@ -1038,9 +973,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::ListMembershipOpportunities(FGroupsListMem
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1054,12 +987,13 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::ListMembershipOpportunities(FGroupsListMem
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1077,7 +1011,7 @@ void UPlayFabGroupsAPI::HelperListMembershipOpportunities(FPlayFabBaseModel resp
         FGroupsListMembershipOpportunitiesResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeListMembershipOpportunitiesResponseResponse(response.responseData);
         OnSuccessListMembershipOpportunities.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListMembershipOpportunities.Unbind();
 }
 
 /** Removes an application to join a group */
@@ -1087,9 +1021,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::RemoveGroupApplication(FGroupsRemoveGroupA
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1103,13 +1035,14 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::RemoveGroupApplication(FGroupsRemoveGroupA
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1125,10 +1058,10 @@ void UPlayFabGroupsAPI::HelperRemoveGroupApplication(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessRemoveGroupApplication.IsBound())
     {
         FGroupsEmptyResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessRemoveGroupApplication.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRemoveGroupApplication.Unbind();
 }
 
 /** Removes an invitation join a group */
@@ -1138,9 +1071,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::RemoveGroupInvitation(FGroupsRemoveGroupIn
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1154,13 +1085,14 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::RemoveGroupInvitation(FGroupsRemoveGroupIn
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1176,10 +1108,10 @@ void UPlayFabGroupsAPI::HelperRemoveGroupInvitation(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessRemoveGroupInvitation.IsBound())
     {
         FGroupsEmptyResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessRemoveGroupInvitation.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRemoveGroupInvitation.Unbind();
 }
 
 /** Removes members from a group. */
@@ -1189,9 +1121,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::RemoveMembers(FGroupsRemoveMembersRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1205,22 +1135,15 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::RemoveMembers(FGroupsRemoveMembersRequest
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
-    if (request.Members.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Members"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Members"), request.Members);
-    }
-    if (request.RoleId.IsEmpty() || request.RoleId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RoleId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("RoleId"), request.RoleId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
+    RequestWriter.WriteObjectArray(TEXT("Members"), request.Members);
+    RequestWriter.WriteStringOrNull(TEXT("RoleId"), request.RoleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1236,10 +1159,10 @@ void UPlayFabGroupsAPI::HelperRemoveMembers(FPlayFabBaseModel response, UObject*
     else if (!error.hasError && OnSuccessRemoveMembers.IsBound())
     {
         FGroupsEmptyResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessRemoveMembers.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRemoveMembers.Unbind();
 }
 
 /** Unblocks a list of entities from joining a group */
@@ -1249,9 +1172,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::UnblockEntity(FGroupsUnblockEntityRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1265,13 +1186,14 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::UnblockEntity(FGroupsUnblockEntityRequest
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1287,10 +1209,10 @@ void UPlayFabGroupsAPI::HelperUnblockEntity(FPlayFabBaseModel response, UObject*
     else if (!error.hasError && OnSuccessUnblockEntity.IsBound())
     {
         FGroupsEmptyResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUnblockEntity.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnblockEntity.Unbind();
 }
 
 /** Updates non-membership data about a group. */
@@ -1300,9 +1222,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::UpdateGroup(FGroupsUpdateGroupRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1316,28 +1236,17 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::UpdateGroup(FGroupsUpdateGroupRequest requ
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AdminRoleId.IsEmpty() || request.AdminRoleId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AdminRoleId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AdminRoleId"), request.AdminRoleId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("ExpectedProfileVersion"), request.ExpectedProfileVersion);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
-    if (request.GroupName.IsEmpty() || request.GroupName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GroupName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GroupName"), request.GroupName);
-    }
-    if (request.MemberRoleId.IsEmpty() || request.MemberRoleId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("MemberRoleId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("MemberRoleId"), request.MemberRoleId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AdminRoleId"), request.AdminRoleId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("ExpectedProfileVersion"), request.ExpectedProfileVersion);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
+    RequestWriter.WriteStringOrNull(TEXT("GroupName"), request.GroupName);
+    RequestWriter.WriteStringOrNull(TEXT("MemberRoleId"), request.MemberRoleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1355,7 +1264,7 @@ void UPlayFabGroupsAPI::HelperUpdateGroup(FPlayFabBaseModel response, UObject* c
         FGroupsUpdateGroupResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeUpdateGroupResponseResponse(response.responseData);
         OnSuccessUpdateGroup.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateGroup.Unbind();
 }
 
 /** Updates metadata about a role. */
@@ -1365,9 +1274,7 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::UpdateRole(FGroupsUpdateGroupRoleRequest r
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabGroupsAPI* manager = NewObject<UPlayFabGroupsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabGroupsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabGroupsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1381,23 +1288,16 @@ UPlayFabGroupsAPI* UPlayFabGroupsAPI::UpdateRole(FGroupsUpdateGroupRoleRequest r
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("ExpectedProfileVersion"), request.ExpectedProfileVersion);
-    if (request.Group != nullptr) OutRestJsonObj->SetObjectField(TEXT("Group"), request.Group);
-    if (request.RoleId.IsEmpty() || request.RoleId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RoleId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("RoleId"), request.RoleId);
-    }
-    if (request.RoleName.IsEmpty() || request.RoleName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RoleName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("RoleName"), request.RoleName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("ExpectedProfileVersion"), request.ExpectedProfileVersion);
+    RequestWriter.WriteObject(TEXT("Group"), request.Group);
+    RequestWriter.WriteStringOrNull(TEXT("RoleId"), request.RoleId);
+    RequestWriter.WriteStringOrNull(TEXT("RoleName"), request.RoleName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1415,13 +1315,16 @@ void UPlayFabGroupsAPI::HelperUpdateRole(FPlayFabBaseModel response, UObject* cu
         FGroupsUpdateGroupRoleResponse ResultStruct = UPlayFabGroupsModelDecoder::decodeUpdateGroupRoleResponseResponse(response.responseData);
         OnSuccessUpdateRole.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateRole.Unbind();
 }
 
 
 
 void UPlayFabGroupsAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
+    PlayFabCommon::FPlayFabCallCounters::EndCall(Request->GetURL());
+    PLAYFAB_TRACE_END(Wait, Request);
+
     // Be sure that we have no data from previous response
     ResetResponseData();
 
@@ -1430,6 +1333,14 @@ void UPlayFabGroupsAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         UE_LOG(LogPlayFab, Error, TEXT("The request object is invalid during OnProcessRequestComplete."));
         return;
     }
+
+    // The call is over however this returns; the result helpers run during the broadcast, before the proxy is cleared
+    // Only set up once the object is known to be valid, as an invalid one can't be trusted to go back to the pool
+    ON_SCOPE_EXIT
+    {
+        ReleaseToPool();
+    };
+
     if (!OnPlayFabResponse.IsBound())
     {
         UE_LOG(LogPlayFab, Error, TEXT("OnPlayFabResponse has come un-bound during OnProcessRequestComplete."));
@@ -1449,20 +1360,25 @@ void UPlayFabGroupsAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         myResponse.responseError.ErrorName = "Unable to contact server";
         myResponse.responseError.ErrorMessage = "Unable to contact server";
 
+        PLAYFAB_TRACE_SCOPE(Dispatch, Request);
         OnPlayFabResponse.Broadcast(myResponse, mCustomData, false);
 
         return;
     }
 
-    // Save response data as a string
-    ResponseContent = Response->GetContentAsString();
+    {
+        PLAYFAB_TRACE_SCOPE(Decode, Request);
+
+        // Save response data as a string
+        ResponseContent = Response->GetContentAsString();
 
-    // Save response code as int32
-    ResponseCode = Response->GetResponseCode();
+        // Save response code as int32
+        ResponseCode = Response->GetResponseCode();
 
-    // Try to deserialize data to JSON
-    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-    FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+        // Try to deserialize data to JSON
+        TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
+        FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+    }
 
     // Decide whether the request was successful
     bIsValidJsonResponse = bWasSuccessful && ResponseJsonObj->GetRootObject().IsValid();
@@ -1472,7 +1388,7 @@ void UPlayFabGroupsAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
 
     // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
+    PlayFabCommon::FPlayFabRequestLog::LogResponse(Request, ResponseCode, Response->GetContent());
 
     myResponse.responseError.decodeError(ResponseJsonObj);
     myResponse.responseData = ResponseJsonObj;
@@ -1487,8 +1403,8 @@ void UPlayFabGroupsAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
     }
 
     // Broadcast the result event
+    PLAYFAB_TRACE_SCOPE(Dispatch, Request);
     OnPlayFabResponse.Broadcast(myResponse, mCustomData, !myResponse.responseError.hasError);
-    pfSettings->ModifyPendingCallCount(-1);
 }
 
 void UPlayFabGroupsAPI::Activate()
@@ -1546,24 +1462,55 @@ void UPlayFabGroupsAPI::Activate()
     for (TMap<FString, FString>::TConstIterator It(RequestHeaders); It; ++It)
         HttpRequest->SetHeader(It.Key(), It.Value());
 
-    // Serialize data to json string
-    FString OutputString;
-    TSharedRef< TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    // Requests made by the generated functions are already serialized; one set with SetRequestObject is serialized here
+    if (RequestJsonObj != nullptr && RequestBody.Num() == 0)
+    {
+        PLAYFAB_TRACE_SCOPE(Serialize, HttpRequest);
+        FMemoryWriter BodyStream(RequestBody);
+        PlayFab::JsonUtf8Writer Writer = TJsonWriterFactory<TCHAR, PlayFab::FPlayFabCondensedUtf8PrintPolicy>::Create(&BodyStream);
+        FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    }
 
     // Set Json content
-    HttpRequest->SetContentAsString(OutputString);
+    HttpRequest->SetContent(RequestBody);
 
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
+    PlayFabCommon::FPlayFabRequestLog::LogRequest(HttpRequest, RequestBody);
 
     // Bind event
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabGroupsAPI::OnProcessRequestComplete);
 
     // Execute the request
-    pfSettings->ModifyPendingCallCount(1);
+    PlayFabCommon::FPlayFabCallCounters::BeginCall(RequestUrl);
+    PLAYFAB_TRACE_BEGIN(Wait, HttpRequest);
+    PLAYFAB_TRACE_SCOPE(Send, HttpRequest);
     HttpRequest->ProcessRequest();
 }
 
+void UPlayFabGroupsAPI::ReleaseToPool()
+{
+    // Clear everything the next call through this proxy would otherwise inherit
+    OnPlayFabResponse.Clear();
+    OnFailure.Unbind();
+    mCustomData = nullptr;
+    CallAuthenticationContext = nullptr;
+    PlayFabRequestURL.Reset();
+    useEntityToken = false;
+    useSecretKey = false;
+    useSessionTicket = false;
+    returnsSessionTicket = false;
+    returnsEntityToken = false;
+    RequestHeaders.Reset();
+    ResponseContent.Reset();
+    ResponseCode = 0;
+    bIsValidJsonResponse = false;
+
+    // The request object is the caller's, or was handed to the caller with the result, so it isn't recycled
+    RequestBody.Reset();
+    RequestJsonObj = nullptr;
+    // The response object is kept with the proxy, and cleared when its next response arrives
+    FPlayFabObjectPool::Release(this);
+}
+
 void UPlayFabGroupsAPI::ResetResponseData()
 {
     if (ResponseJsonObj != nullptr)
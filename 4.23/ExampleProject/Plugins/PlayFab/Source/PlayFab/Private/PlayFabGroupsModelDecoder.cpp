@@ -11,6 +11,7 @@
 
 #include "PlayFabGroupsModelDecoder.h"
 #include "PlayFabPrivate.h"
+#include "PlayFabJsonDecoder.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Groups API Functions
@@ -34,11 +35,11 @@ FGroupsApplyToGroupResponse UPlayFabGroupsModelDecoder::decodeApplyToGroupRespon
 {
     // Temp ustruct
     FGroupsApplyToGroupResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Entity = !(dataObj->HasField("Entity")) ? nullptr : dataObj->GetObjectField("Entity");
-    tempStruct.Expires = !(dataObj->HasField("Expires")) ? TEXT("") : dataObj->GetStringField("Expires");
-    tempStruct.Group = !(dataObj->HasField("Group")) ? nullptr : dataObj->GetObjectField("Group");
+    tempStruct.Entity = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Entity"));
+    tempStruct.Expires = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Expires"));
+    tempStruct.Group = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Group"));
 
     return tempStruct;
 }
@@ -47,15 +48,15 @@ FGroupsCreateGroupResponse UPlayFabGroupsModelDecoder::decodeCreateGroupResponse
 {
     // Temp ustruct
     FGroupsCreateGroupResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.AdminRoleId = !(dataObj->HasField("AdminRoleId")) ? TEXT("") : dataObj->GetStringField("AdminRoleId");
-    tempStruct.Created = !(dataObj->HasField("Created")) ? TEXT("") : dataObj->GetStringField("Created");
-    tempStruct.Group = !(dataObj->HasField("Group")) ? nullptr : dataObj->GetObjectField("Group");
-    tempStruct.GroupName = !(dataObj->HasField("GroupName")) ? TEXT("") : dataObj->GetStringField("GroupName");
-    tempStruct.MemberRoleId = !(dataObj->HasField("MemberRoleId")) ? TEXT("") : dataObj->GetStringField("MemberRoleId");
-    tempStruct.ProfileVersion = !(dataObj->HasField("ProfileVersion")) ? 0 : int(dataObj->GetNumberField("ProfileVersion"));
-    tempStruct.Roles = !(dataObj->HasField("Roles")) ? nullptr : dataObj->GetObjectField("Roles");
+    tempStruct.AdminRoleId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("AdminRoleId"));
+    tempStruct.Created = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Created"));
+    tempStruct.Group = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Group"));
+    tempStruct.GroupName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("GroupName"));
+    tempStruct.MemberRoleId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("MemberRoleId"));
+    tempStruct.ProfileVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ProfileVersion"));
+    tempStruct.Roles = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Roles"));
 
     return tempStruct;
 }
@@ -64,11 +65,11 @@ FGroupsCreateGroupRoleResponse UPlayFabGroupsModelDecoder::decodeCreateGroupRole
 {
     // Temp ustruct
     FGroupsCreateGroupRoleResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ProfileVersion = !(dataObj->HasField("ProfileVersion")) ? 0 : int(dataObj->GetNumberField("ProfileVersion"));
-    tempStruct.RoleId = !(dataObj->HasField("RoleId")) ? TEXT("") : dataObj->GetStringField("RoleId");
-    tempStruct.RoleName = !(dataObj->HasField("RoleName")) ? TEXT("") : dataObj->GetStringField("RoleName");
+    tempStruct.ProfileVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ProfileVersion"));
+    tempStruct.RoleId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("RoleId"));
+    tempStruct.RoleName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("RoleName"));
 
     return tempStruct;
 }
@@ -77,15 +78,15 @@ FGroupsGetGroupResponse UPlayFabGroupsModelDecoder::decodeGetGroupResponseRespon
 {
     // Temp ustruct
     FGroupsGetGroupResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.AdminRoleId = !(dataObj->HasField("AdminRoleId")) ? TEXT("") : dataObj->GetStringField("AdminRoleId");
-    tempStruct.Created = !(dataObj->HasField("Created")) ? TEXT("") : dataObj->GetStringField("Created");
-    tempStruct.Group = !(dataObj->HasField("Group")) ? nullptr : dataObj->GetObjectField("Group");
-    tempStruct.GroupName = !(dataObj->HasField("GroupName")) ? TEXT("") : dataObj->GetStringField("GroupName");
-    tempStruct.MemberRoleId = !(dataObj->HasField("MemberRoleId")) ? TEXT("") : dataObj->GetStringField("MemberRoleId");
-    tempStruct.ProfileVersion = !(dataObj->HasField("ProfileVersion")) ? 0 : int(dataObj->GetNumberField("ProfileVersion"));
-    tempStruct.Roles = !(dataObj->HasField("Roles")) ? nullptr : dataObj->GetObjectField("Roles");
+    tempStruct.AdminRoleId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("AdminRoleId"));
+    tempStruct.Created = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Created"));
+    tempStruct.Group = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Group"));
+    tempStruct.GroupName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("GroupName"));
+    tempStruct.MemberRoleId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("MemberRoleId"));
+    tempStruct.ProfileVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ProfileVersion"));
+    tempStruct.Roles = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Roles"));
 
     return tempStruct;
 }
@@ -94,13 +95,13 @@ FGroupsInviteToGroupResponse UPlayFabGroupsModelDecoder::decodeInviteToGroupResp
 {
     // Temp ustruct
     FGroupsInviteToGroupResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Expires = !(dataObj->HasField("Expires")) ? TEXT("") : dataObj->GetStringField("Expires");
-    tempStruct.Group = !(dataObj->HasField("Group")) ? nullptr : dataObj->GetObjectField("Group");
-    tempStruct.InvitedByEntity = !(dataObj->HasField("InvitedByEntity")) ? nullptr : dataObj->GetObjectField("InvitedByEntity");
-    tempStruct.InvitedEntity = !(dataObj->HasField("InvitedEntity")) ? nullptr : dataObj->GetObjectField("InvitedEntity");
-    tempStruct.RoleId = !(dataObj->HasField("RoleId")) ? TEXT("") : dataObj->GetStringField("RoleId");
+    tempStruct.Expires = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Expires"));
+    tempStruct.Group = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Group"));
+    tempStruct.InvitedByEntity = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("InvitedByEntity"));
+    tempStruct.InvitedEntity = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("InvitedEntity"));
+    tempStruct.RoleId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("RoleId"));
 
     return tempStruct;
 }
@@ -109,9 +110,9 @@ FGroupsIsMemberResponse UPlayFabGroupsModelDecoder::decodeIsMemberResponseRespon
 {
     // Temp ustruct
     FGroupsIsMemberResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.IsMember = !(dataObj->HasField("IsMember")) ? false : dataObj->GetBoolField("IsMember");
+    tempStruct.IsMember = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("IsMember"));
 
     return tempStruct;
 }
@@ -120,9 +121,9 @@ FGroupsListGroupApplicationsResponse UPlayFabGroupsModelDecoder::decodeListGroup
 {
     // Temp ustruct
     FGroupsListGroupApplicationsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Applications = !(dataObj->HasField("Applications")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Applications");
+    tempStruct.Applications = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Applications"));
 
     return tempStruct;
 }
@@ -131,9 +132,9 @@ FGroupsListGroupBlocksResponse UPlayFabGroupsModelDecoder::decodeListGroupBlocks
 {
     // Temp ustruct
     FGroupsListGroupBlocksResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.BlockedEntities = !(dataObj->HasField("BlockedEntities")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BlockedEntities");
+    tempStruct.BlockedEntities = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("BlockedEntities"));
 
     return tempStruct;
 }
@@ -142,9 +143,9 @@ FGroupsListGroupInvitationsResponse UPlayFabGroupsModelDecoder::decodeListGroupI
 {
     // Temp ustruct
     FGroupsListGroupInvitationsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Invitations = !(dataObj->HasField("Invitations")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Invitations");
+    tempStruct.Invitations = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Invitations"));
 
     return tempStruct;
 }
@@ -153,9 +154,9 @@ FGroupsListGroupMembersResponse UPlayFabGroupsModelDecoder::decodeListGroupMembe
 {
     // Temp ustruct
     FGroupsListGroupMembersResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Members = !(dataObj->HasField("Members")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Members");
+    tempStruct.Members = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Members"));
 
     return tempStruct;
 }
@@ -164,9 +165,9 @@ FGroupsListMembershipResponse UPlayFabGroupsModelDecoder::decodeListMembershipRe
 {
     // Temp ustruct
     FGroupsListMembershipResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Groups = !(dataObj->HasField("Groups")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Groups");
+    tempStruct.Groups = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Groups"));
 
     return tempStruct;
 }
@@ -175,10 +176,10 @@ FGroupsListMembershipOpportunitiesResponse UPlayFabGroupsModelDecoder::decodeLis
 {
     // Temp ustruct
     FGroupsListMembershipOpportunitiesResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Applications = !(dataObj->HasField("Applications")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Applications");
-    tempStruct.Invitations = !(dataObj->HasField("Invitations")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Invitations");
+    tempStruct.Applications = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Applications"));
+    tempStruct.Invitations = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Invitations"));
 
     return tempStruct;
 }
@@ -187,11 +188,11 @@ FGroupsUpdateGroupResponse UPlayFabGroupsModelDecoder::decodeUpdateGroupResponse
 {
     // Temp ustruct
     FGroupsUpdateGroupResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.OperationReason = !(dataObj->HasField("OperationReason")) ? TEXT("") : dataObj->GetStringField("OperationReason");
-    tempStruct.ProfileVersion = !(dataObj->HasField("ProfileVersion")) ? 0 : int(dataObj->GetNumberField("ProfileVersion"));
-    GetEnumValueFromString<EOperationTypes>(TEXT("EOperationTypes"), dataObj->GetStringField("SetResult"), tempStruct.SetResult);
+    tempStruct.OperationReason = FPlayFabJsonDecoder::GetString(dataObj, TEXT("OperationReason"));
+    tempStruct.ProfileVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ProfileVersion"));
+    GetEnumValueFromString<EOperationTypes>(TEXT("EOperationTypes"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("SetResult")), tempStruct.SetResult);
 
     return tempStruct;
 }
@@ -200,11 +201,11 @@ FGroupsUpdateGroupRoleResponse UPlayFabGroupsModelDecoder::decodeUpdateGroupRole
 {
     // Temp ustruct
     FGroupsUpdateGroupRoleResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.OperationReason = !(dataObj->HasField("OperationReason")) ? TEXT("") : dataObj->GetStringField("OperationReason");
-    tempStruct.ProfileVersion = !(dataObj->HasField("ProfileVersion")) ? 0 : int(dataObj->GetNumberField("ProfileVersion"));
-    GetEnumValueFromString<EOperationTypes>(TEXT("EOperationTypes"), dataObj->GetStringField("SetResult"), tempStruct.SetResult);
+    tempStruct.OperationReason = FPlayFabJsonDecoder::GetString(dataObj, TEXT("OperationReason"));
+    tempStruct.ProfileVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ProfileVersion"));
+    GetEnumValueFromString<EOperationTypes>(TEXT("EOperationTypes"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("SetResult")), tempStruct.SetResult);
 
     return tempStruct;
 }
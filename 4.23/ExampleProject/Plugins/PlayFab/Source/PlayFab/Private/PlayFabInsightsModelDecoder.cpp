@@ -11,6 +11,7 @@
 
 #include "PlayFabInsightsModelDecoder.h"
 #include "PlayFabPrivate.h"
+#include "PlayFabJsonDecoder.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Insights API Functions
@@ -25,14 +26,14 @@ FInsightsInsightsGetDetailsResponse UPlayFabInsightsModelDecoder::decodeInsights
 {
     // Temp ustruct
     FInsightsInsightsGetDetailsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.DataUsageMb = !(dataObj->HasField("DataUsageMb")) ? 0 : int(dataObj->GetNumberField("DataUsageMb"));
-    tempStruct.ErrorMessage = !(dataObj->HasField("ErrorMessage")) ? TEXT("") : dataObj->GetStringField("ErrorMessage");
-    tempStruct.Limits = !(dataObj->HasField("Limits")) ? nullptr : dataObj->GetObjectField("Limits");
-    tempStruct.PendingOperations = !(dataObj->HasField("PendingOperations")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("PendingOperations");
-    tempStruct.PerformanceLevel = !(dataObj->HasField("PerformanceLevel")) ? 0 : int(dataObj->GetNumberField("PerformanceLevel"));
-    tempStruct.RetentionDays = !(dataObj->HasField("RetentionDays")) ? 0 : int(dataObj->GetNumberField("RetentionDays"));
+    tempStruct.DataUsageMb = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("DataUsageMb"));
+    tempStruct.ErrorMessage = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ErrorMessage"));
+    tempStruct.Limits = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Limits"));
+    tempStruct.PendingOperations = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("PendingOperations"));
+    tempStruct.PerformanceLevel = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("PerformanceLevel"));
+    tempStruct.RetentionDays = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("RetentionDays"));
 
     return tempStruct;
 }
@@ -41,13 +42,13 @@ FInsightsInsightsGetLimitsResponse UPlayFabInsightsModelDecoder::decodeInsightsG
 {
     // Temp ustruct
     FInsightsInsightsGetLimitsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.DefaultPerformanceLevel = !(dataObj->HasField("DefaultPerformanceLevel")) ? 0 : int(dataObj->GetNumberField("DefaultPerformanceLevel"));
-    tempStruct.DefaultStorageRetentionDays = !(dataObj->HasField("DefaultStorageRetentionDays")) ? 0 : int(dataObj->GetNumberField("DefaultStorageRetentionDays"));
-    tempStruct.StorageMaxRetentionDays = !(dataObj->HasField("StorageMaxRetentionDays")) ? 0 : int(dataObj->GetNumberField("StorageMaxRetentionDays"));
-    tempStruct.StorageMinRetentionDays = !(dataObj->HasField("StorageMinRetentionDays")) ? 0 : int(dataObj->GetNumberField("StorageMinRetentionDays"));
-    tempStruct.SubMeters = !(dataObj->HasField("SubMeters")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("SubMeters");
+    tempStruct.DefaultPerformanceLevel = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("DefaultPerformanceLevel"));
+    tempStruct.DefaultStorageRetentionDays = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("DefaultStorageRetentionDays"));
+    tempStruct.StorageMaxRetentionDays = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("StorageMaxRetentionDays"));
+    tempStruct.StorageMinRetentionDays = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("StorageMinRetentionDays"));
+    tempStruct.SubMeters = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("SubMeters"));
 
     return tempStruct;
 }
@@ -56,16 +57,16 @@ FInsightsInsightsGetOperationStatusResponse UPlayFabInsightsModelDecoder::decode
 {
     // Temp ustruct
     FInsightsInsightsGetOperationStatusResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Message = !(dataObj->HasField("Message")) ? TEXT("") : dataObj->GetStringField("Message");
-    tempStruct.OperationCompletedTime = !(dataObj->HasField("OperationCompletedTime")) ? TEXT("") : dataObj->GetStringField("OperationCompletedTime");
-    tempStruct.OperationId = !(dataObj->HasField("OperationId")) ? TEXT("") : dataObj->GetStringField("OperationId");
-    tempStruct.OperationLastUpdated = !(dataObj->HasField("OperationLastUpdated")) ? TEXT("") : dataObj->GetStringField("OperationLastUpdated");
-    tempStruct.OperationStartedTime = !(dataObj->HasField("OperationStartedTime")) ? TEXT("") : dataObj->GetStringField("OperationStartedTime");
-    tempStruct.OperationType = !(dataObj->HasField("OperationType")) ? TEXT("") : dataObj->GetStringField("OperationType");
-    tempStruct.OperationValue = !(dataObj->HasField("OperationValue")) ? 0 : int(dataObj->GetNumberField("OperationValue"));
-    tempStruct.Status = !(dataObj->HasField("Status")) ? TEXT("") : dataObj->GetStringField("Status");
+    tempStruct.Message = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Message"));
+    tempStruct.OperationCompletedTime = FPlayFabJsonDecoder::GetString(dataObj, TEXT("OperationCompletedTime"));
+    tempStruct.OperationId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("OperationId"));
+    tempStruct.OperationLastUpdated = FPlayFabJsonDecoder::GetString(dataObj, TEXT("OperationLastUpdated"));
+    tempStruct.OperationStartedTime = FPlayFabJsonDecoder::GetString(dataObj, TEXT("OperationStartedTime"));
+    tempStruct.OperationType = FPlayFabJsonDecoder::GetString(dataObj, TEXT("OperationType"));
+    tempStruct.OperationValue = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("OperationValue"));
+    tempStruct.Status = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Status"));
 
     return tempStruct;
 }
@@ -74,9 +75,9 @@ FInsightsInsightsGetPendingOperationsResponse UPlayFabInsightsModelDecoder::deco
 {
     // Temp ustruct
     FInsightsInsightsGetPendingOperationsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.PendingOperations = !(dataObj->HasField("PendingOperations")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("PendingOperations");
+    tempStruct.PendingOperations = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("PendingOperations"));
 
     return tempStruct;
 }
@@ -85,11 +86,11 @@ FInsightsInsightsOperationResponse UPlayFabInsightsModelDecoder::decodeInsightsO
 {
     // Temp ustruct
     FInsightsInsightsOperationResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Message = !(dataObj->HasField("Message")) ? TEXT("") : dataObj->GetStringField("Message");
-    tempStruct.OperationId = !(dataObj->HasField("OperationId")) ? TEXT("") : dataObj->GetStringField("OperationId");
-    tempStruct.OperationType = !(dataObj->HasField("OperationType")) ? TEXT("") : dataObj->GetStringField("OperationType");
+    tempStruct.Message = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Message"));
+    tempStruct.OperationId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("OperationId"));
+    tempStruct.OperationType = FPlayFabJsonDecoder::GetString(dataObj, TEXT("OperationType"));
 
     return tempStruct;
 }
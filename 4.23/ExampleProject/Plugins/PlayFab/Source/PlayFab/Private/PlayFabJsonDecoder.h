@@ -0,0 +1,37 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class UPlayFabJsonObject;
+
+/**
+ * Field reads for the generated model decoders, made on the parsed FJsonObject of a response rather than through UPlayFabJsonObject.
+ * Each read is a single lookup, and a field that is missing, null or of another type reads as the default value.
+ * Only object fields, which the result structs hold as UPlayFabJsonObject, allocate a wrapper.
+ */
+struct FPlayFabJsonDecoder
+{
+    // The "data" object of a response, or nullptr when it has none
+    static const FJsonObject* GetData(UPlayFabJsonObject* Response);
+
+    static FString GetString(const FJsonObject* Object, const TCHAR* FieldName);
+    // A string array, joined with commas the way the result structs hold it
+    static FString GetJoinedStringArray(const FJsonObject* Object, const TCHAR* FieldName);
+    static int32 GetNumber(const FJsonObject* Object, const TCHAR* FieldName);
+    static TArray<int32> GetNumberArray(const FJsonObject* Object, const TCHAR* FieldName);
+    static bool GetBool(const FJsonObject* Object, const TCHAR* FieldName);
+    static TArray<bool> GetBoolArray(const FJsonObject* Object, const TCHAR* FieldName);
+    static UPlayFabJsonObject* GetObject(const FJsonObject* Object, const TCHAR* FieldName);
+    static TArray<UPlayFabJsonObject*> GetObjectArray(const FJsonObject* Object, const TCHAR* FieldName);
+
+private:
+    static const FJsonValue* Find(const FJsonObject* Object, const TCHAR* FieldName);
+    static const TArray<TSharedPtr<FJsonValue>>* FindArray(const FJsonObject* Object, const TCHAR* FieldName);
+    static UPlayFabJsonObject* Wrap(const TSharedPtr<FJsonObject>& Object);
+};
@@ -16,6 +16,12 @@
 #include "PlayFabEnums.h"
 #include "PlayFabCommon/Public/PlayFabAuthenticationContext.h"
 #include "PlayFabCommon/Public/PlayFabCommonUtils.h"
+#include "PlayFabCommon/Public/PlayFabCallCounters.h"
+#include "PlayFabCommon/Public/PlayFabTrace.h"
+#include "PlayFabCommon/Public/PlayFabRequestLog.h"
+#include "PlayFabObjectPool.h"
+#include "PlayFabRequestWriter.h"
+#include "Misc/ScopeExit.h"
 
 UPlayFabMatchmakerAPI::UPlayFabMatchmakerAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -30,7 +36,26 @@ void UPlayFabMatchmakerAPI::SetCallAuthenticationContext(UPlayFabAuthenticationC
 
 void UPlayFabMatchmakerAPI::SetRequestObject(UPlayFabJsonObject* JsonObject)
 {
+    // The object replaces any body serialized before, and is serialized in Activate
     RequestJsonObj = JsonObject;
+    RequestBody.Reset();
+}
+
+void UPlayFabMatchmakerAPI::SetRequestBody(TArray<uint8>&& Body)
+{
+    RequestBody = MoveTemp(Body);
+    RequestJsonObj = nullptr;
+}
+
+UPlayFabJsonObject* UPlayFabMatchmakerAPI::GetRequestObject()
+{
+    if (RequestJsonObj == nullptr && RequestBody.Num() > 0)
+    {
+        // Only the few results that hand the request back to Blueprint pay for parsing it
+        RequestJsonObj = NewObject<UPlayFabJsonObject>();
+        RequestJsonObj->DecodeJson(FPlayFabRequestWriter::ToString(RequestBody));
+    }
+    return RequestJsonObj;
 }
 
 UPlayFabJsonObject* UPlayFabMatchmakerAPI::GetResponseObject()
@@ -40,31 +65,7 @@ UPlayFabJsonObject* UPlayFabMatchmakerAPI::GetResponseObject()
 
 FString UPlayFabMatchmakerAPI::PercentEncode(const FString& Text)
 {
-    FString OutText = Text;
-
-    OutText = OutText.Replace(TEXT("!"), TEXT("%21"));
-    OutText = OutText.Replace(TEXT("\""), TEXT("%22"));
-    OutText = OutText.Replace(TEXT("#"), TEXT("%23"));
-    OutText = OutText.Replace(TEXT("$"), TEXT("%24"));
-    //OutText = OutText.Replace(TEXT("&"), TEXT("%26"));
-    OutText = OutText.Replace(TEXT("'"), TEXT("%27"));
-    OutText = OutText.Replace(TEXT("("), TEXT("%28"));
-    OutText = OutText.Replace(TEXT(")"), TEXT("%29"));
-    OutText = OutText.Replace(TEXT("*"), TEXT("%2A"));
-    OutText = OutText.Replace(TEXT("+"), TEXT("%2B"));
-    OutText = OutText.Replace(TEXT(","), TEXT("%2C"));
-    //OutText = OutText.Replace(TEXT("/"), TEXT("%2F"));
-    OutText = OutText.Replace(TEXT(":"), TEXT("%3A"));
-    OutText = OutText.Replace(TEXT(";"), TEXT("%3B"));
-    OutText = OutText.Replace(TEXT("="), TEXT("%3D"));
-    //OutText = OutText.Replace(TEXT("?"), TEXT("%3F"));
-    OutText = OutText.Replace(TEXT("@"), TEXT("%40"));
-    OutText = OutText.Replace(TEXT("["), TEXT("%5B"));
-    OutText = OutText.Replace(TEXT("]"), TEXT("%5D"));
-    OutText = OutText.Replace(TEXT("{"), TEXT("%7B"));
-    OutText = OutText.Replace(TEXT("}"), TEXT("%7D"));
-
-    return OutText;
+    return PlayFabCommon::PlayFabCommonUtils::PercentEncode(Text);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -82,9 +83,7 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::AuthUser(FMatchmakerAuthUserReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMatchmakerAPI* manager = NewObject<UPlayFabMatchmakerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMatchmakerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMatchmakerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -98,15 +97,12 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::AuthUser(FMatchmakerAuthUserReques
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AuthorizationTicket.IsEmpty() || request.AuthorizationTicket == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AuthorizationTicket"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AuthorizationTicket"), request.AuthorizationTicket);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AuthorizationTicket"), request.AuthorizationTicket);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -124,7 +120,7 @@ void UPlayFabMatchmakerAPI::HelperAuthUser(FPlayFabBaseModel response, UObject*
         FMatchmakerAuthUserResponse ResultStruct = UPlayFabMatchmakerModelDecoder::decodeAuthUserResponseResponse(response.responseData);
         OnSuccessAuthUser.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAuthUser.Unbind();
 }
 
 /** Informs the PlayFab game server hosting service that the indicated user has joined the Game Server Instance specified */
@@ -134,9 +130,7 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::PlayerJoined(FMatchmakerPlayerJoin
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMatchmakerAPI* manager = NewObject<UPlayFabMatchmakerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMatchmakerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMatchmakerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -150,21 +144,14 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::PlayerJoined(FMatchmakerPlayerJoin
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("LobbyId"), request.LobbyId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -182,7 +169,7 @@ void UPlayFabMatchmakerAPI::HelperPlayerJoined(FPlayFabBaseModel response, UObje
         FMatchmakerPlayerJoinedResponse ResultStruct = UPlayFabMatchmakerModelDecoder::decodePlayerJoinedResponseResponse(response.responseData);
         OnSuccessPlayerJoined.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessPlayerJoined.Unbind();
 }
 
 /** Informs the PlayFab game server hosting service that the indicated user has left the Game Server Instance specified */
@@ -192,9 +179,7 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::PlayerLeft(FMatchmakerPlayerLeftRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMatchmakerAPI* manager = NewObject<UPlayFabMatchmakerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMatchmakerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMatchmakerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -208,21 +193,14 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::PlayerLeft(FMatchmakerPlayerLeftRe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("LobbyId"), request.LobbyId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -240,7 +218,7 @@ void UPlayFabMatchmakerAPI::HelperPlayerLeft(FPlayFabBaseModel response, UObject
         FMatchmakerPlayerLeftResponse ResultStruct = UPlayFabMatchmakerModelDecoder::decodePlayerLeftResponseResponse(response.responseData);
         OnSuccessPlayerLeft.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessPlayerLeft.Unbind();
 }
 
 /** Instructs the PlayFab game server hosting service to instantiate a new Game Server Instance */
@@ -250,9 +228,7 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::StartGame(FMatchmakerStartGameRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMatchmakerAPI* manager = NewObject<UPlayFabMatchmakerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMatchmakerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMatchmakerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -266,34 +242,19 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::StartGame(FMatchmakerStartGameRequ
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Build.IsEmpty() || request.Build == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Build"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Build"), request.Build);
-    }
-    if (request.CustomCommandLineData.IsEmpty() || request.CustomCommandLineData == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CustomCommandLineData"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CustomCommandLineData"), request.CustomCommandLineData);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ExternalMatchmakerEventEndpoint.IsEmpty() || request.ExternalMatchmakerEventEndpoint == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ExternalMatchmakerEventEndpoint"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ExternalMatchmakerEventEndpoint"), request.ExternalMatchmakerEventEndpoint);
-    }
-    if (request.GameMode.IsEmpty() || request.GameMode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameMode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameMode"), request.GameMode);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Build"), request.Build);
+    RequestWriter.WriteStringOrNull(TEXT("CustomCommandLineData"), request.CustomCommandLineData);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ExternalMatchmakerEventEndpoint"), request.ExternalMatchmakerEventEndpoint);
+    RequestWriter.WriteStringOrNull(TEXT("GameMode"), request.GameMode);
     FString temp_Region;
     if (GetEnumValueToString<ERegion>(TEXT("ERegion"), request.Region, temp_Region))
-        OutRestJsonObj->SetStringField(TEXT("Region"), temp_Region);
+        RequestWriter.WriteString(TEXT("Region"), temp_Region);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -311,7 +272,7 @@ void UPlayFabMatchmakerAPI::HelperStartGame(FPlayFabBaseModel response, UObject*
         FMatchmakerStartGameResponse ResultStruct = UPlayFabMatchmakerModelDecoder::decodeStartGameResponseResponse(response.responseData);
         OnSuccessStartGame.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessStartGame.Unbind();
 }
 
 /** Retrieves the relevant details for a specified user, which the external match-making service can then use to compute effective matches */
@@ -321,9 +282,7 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::UserInfo(FMatchmakerUserInfoReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMatchmakerAPI* manager = NewObject<UPlayFabMatchmakerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMatchmakerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMatchmakerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -337,17 +296,14 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::UserInfo(FMatchmakerUserInfoReques
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("MinCatalogVersion"), request.MinCatalogVersion);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("MinCatalogVersion"), request.MinCatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -365,13 +321,16 @@ void UPlayFabMatchmakerAPI::HelperUserInfo(FPlayFabBaseModel response, UObject*
         FMatchmakerUserInfoResponse ResultStruct = UPlayFabMatchmakerModelDecoder::decodeUserInfoResponseResponse(response.responseData);
         OnSuccessUserInfo.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUserInfo.Unbind();
 }
 
 
 
 void UPlayFabMatchmakerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
+    PlayFabCommon::FPlayFabCallCounters::EndCall(Request->GetURL());
+    PLAYFAB_TRACE_END(Wait, Request);
+
     // Be sure that we have no data from previous response
     ResetResponseData();
 
@@ -380,6 +339,14 @@ void UPlayFabMatchmakerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FH
         UE_LOG(LogPlayFab, Error, TEXT("The request object is invalid during OnProcessRequestComplete."));
         return;
     }
+
+    // The call is over however this returns; the result helpers run during the broadcast, before the proxy is cleared
+    // Only set up once the object is known to be valid, as an invalid one can't be trusted to go back to the pool
+    ON_SCOPE_EXIT
+    {
+        ReleaseToPool();
+    };
+
     if (!OnPlayFabResponse.IsBound())
     {
         UE_LOG(LogPlayFab, Error, TEXT("OnPlayFabResponse has come un-bound during OnProcessRequestComplete."));
@@ -399,20 +366,25 @@ void UPlayFabMatchmakerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FH
         myResponse.responseError.ErrorName = "Unable to contact server";
         myResponse.responseError.ErrorMessage = "Unable to contact server";
 
+        PLAYFAB_TRACE_SCOPE(Dispatch, Request);
         OnPlayFabResponse.Broadcast(myResponse, mCustomData, false);
 
         return;
     }
 
-    // Save response data as a string
-    ResponseContent = Response->GetContentAsString();
+    {
+        PLAYFAB_TRACE_SCOPE(Decode, Request);
+
+        // Save response data as a string
+        ResponseContent = Response->GetContentAsString();
 
-    // Save response code as int32
-    ResponseCode = Response->GetResponseCode();
+        // Save response code as int32
+        ResponseCode = Response->GetResponseCode();
 
-    // Try to deserialize data to JSON
-    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-    FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+        // Try to deserialize data to JSON
+        TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
+        FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+    }
 
     // Decide whether the request was successful
     bIsValidJsonResponse = bWasSuccessful && ResponseJsonObj->GetRootObject().IsValid();
@@ -422,7 +394,7 @@ void UPlayFabMatchmakerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FH
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
 
     // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
+    PlayFabCommon::FPlayFabRequestLog::LogResponse(Request, ResponseCode, Response->GetContent());
 
     myResponse.responseError.decodeError(ResponseJsonObj);
     myResponse.responseData = ResponseJsonObj;
@@ -437,8 +409,8 @@ void UPlayFabMatchmakerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FH
     }
 
     // Broadcast the result event
+    PLAYFAB_TRACE_SCOPE(Dispatch, Request);
     OnPlayFabResponse.Broadcast(myResponse, mCustomData, !myResponse.responseError.hasError);
-    pfSettings->ModifyPendingCallCount(-1);
 }
 
 void UPlayFabMatchmakerAPI::Activate()
@@ -496,24 +468,55 @@ void UPlayFabMatchmakerAPI::Activate()
     for (TMap<FString, FString>::TConstIterator It(RequestHeaders); It; ++It)
         HttpRequest->SetHeader(It.Key(), It.Value());
 
-    // Serialize data to json string
-    FString OutputString;
-    TSharedRef< TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    // Requests made by the generated functions are already serialized; one set with SetRequestObject is serialized here
+    if (RequestJsonObj != nullptr && RequestBody.Num() == 0)
+    {
+        PLAYFAB_TRACE_SCOPE(Serialize, HttpRequest);
+        FMemoryWriter BodyStream(RequestBody);
+        PlayFab::JsonUtf8Writer Writer = TJsonWriterFactory<TCHAR, PlayFab::FPlayFabCondensedUtf8PrintPolicy>::Create(&BodyStream);
+        FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    }
 
     // Set Json content
-    HttpRequest->SetContentAsString(OutputString);
+    HttpRequest->SetContent(RequestBody);
 
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
+    PlayFabCommon::FPlayFabRequestLog::LogRequest(HttpRequest, RequestBody);
 
     // Bind event
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabMatchmakerAPI::OnProcessRequestComplete);
 
     // Execute the request
-    pfSettings->ModifyPendingCallCount(1);
+    PlayFabCommon::FPlayFabCallCounters::BeginCall(RequestUrl);
+    PLAYFAB_TRACE_BEGIN(Wait, HttpRequest);
+    PLAYFAB_TRACE_SCOPE(Send, HttpRequest);
     HttpRequest->ProcessRequest();
 }
 
+void UPlayFabMatchmakerAPI::ReleaseToPool()
+{
+    // Clear everything the next call through this proxy would otherwise inherit
+    OnPlayFabResponse.Clear();
+    OnFailure.Unbind();
+    mCustomData = nullptr;
+    CallAuthenticationContext = nullptr;
+    PlayFabRequestURL.Reset();
+    useEntityToken = false;
+    useSecretKey = false;
+    useSessionTicket = false;
+    returnsSessionTicket = false;
+    returnsEntityToken = false;
+    RequestHeaders.Reset();
+    ResponseContent.Reset();
+    ResponseCode = 0;
+    bIsValidJsonResponse = false;
+
+    // The request object is the caller's, or was handed to the caller with the result, so it isn't recycled
+    RequestBody.Reset();
+    RequestJsonObj = nullptr;
+    // The response object is kept with the proxy, and cleared when its next response arrives
+    FPlayFabObjectPool::Release(this);
+}
+
 void UPlayFabMatchmakerAPI::ResetResponseData()
 {
     if (ResponseJsonObj != nullptr)
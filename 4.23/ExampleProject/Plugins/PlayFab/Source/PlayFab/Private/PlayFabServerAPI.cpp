@@ -16,6 +16,12 @@
 #include "PlayFabEnums.h"
 #include "PlayFabCommon/Public/PlayFabAuthenticationContext.h"
 #include "PlayFabCommon/Public/PlayFabCommonUtils.h"
+#include "PlayFabCommon/Public/PlayFabCallCounters.h"
+#include "PlayFabCommon/Public/PlayFabTrace.h"
+#include "PlayFabCommon/Public/PlayFabRequestLog.h"
+#include "PlayFabObjectPool.h"
+#include "PlayFabRequestWriter.h"
+#include "Misc/ScopeExit.h"
 
 UPlayFabServerAPI::UPlayFabServerAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -30,7 +36,26 @@ void UPlayFabServerAPI::SetCallAuthenticationContext(UPlayFabAuthenticationConte
 
 void UPlayFabServerAPI::SetRequestObject(UPlayFabJsonObject* JsonObject)
 {
+    // The object replaces any body serialized before, and is serialized in Activate
     RequestJsonObj = JsonObject;
+    RequestBody.Reset();
+}
+
+void UPlayFabServerAPI::SetRequestBody(TArray<uint8>&& Body)
+{
+    RequestBody = MoveTemp(Body);
+    RequestJsonObj = nullptr;
+}
+
+UPlayFabJsonObject* UPlayFabServerAPI::GetRequestObject()
+{
+    if (RequestJsonObj == nullptr && RequestBody.Num() > 0)
+    {
+        // Only the few results that hand the request back to Blueprint pay for parsing it
+        RequestJsonObj = NewObject<UPlayFabJsonObject>();
+        RequestJsonObj->DecodeJson(FPlayFabRequestWriter::ToString(RequestBody));
+    }
+    return RequestJsonObj;
 }
 
 UPlayFabJsonObject* UPlayFabServerAPI::GetResponseObject()
@@ -40,31 +65,7 @@ UPlayFabJsonObject* UPlayFabServerAPI::GetResponseObject()
 
 FString UPlayFabServerAPI::PercentEncode(const FString& Text)
 {
-    FString OutText = Text;
-
-    OutText = OutText.Replace(TEXT("!"), TEXT("%21"));
-    OutText = OutText.Replace(TEXT("\""), TEXT("%22"));
-    OutText = OutText.Replace(TEXT("#"), TEXT("%23"));
-    OutText = OutText.Replace(TEXT("$"), TEXT("%24"));
-    //OutText = OutText.Replace(TEXT("&"), TEXT("%26"));
-    OutText = OutText.Replace(TEXT("'"), TEXT("%27"));
-    OutText = OutText.Replace(TEXT("("), TEXT("%28"));
-    OutText = OutText.Replace(TEXT(")"), TEXT("%29"));
-    OutText = OutText.Replace(TEXT("*"), TEXT("%2A"));
-    OutText = OutText.Replace(TEXT("+"), TEXT("%2B"));
-    OutText = OutText.Replace(TEXT(","), TEXT("%2C"));
-    //OutText = OutText.Replace(TEXT("/"), TEXT("%2F"));
-    OutText = OutText.Replace(TEXT(":"), TEXT("%3A"));
-    OutText = OutText.Replace(TEXT(";"), TEXT("%3B"));
-    OutText = OutText.Replace(TEXT("="), TEXT("%3D"));
-    //OutText = OutText.Replace(TEXT("?"), TEXT("%3F"));
-    OutText = OutText.Replace(TEXT("@"), TEXT("%40"));
-    OutText = OutText.Replace(TEXT("["), TEXT("%5B"));
-    OutText = OutText.Replace(TEXT("]"), TEXT("%5D"));
-    OutText = OutText.Replace(TEXT("{"), TEXT("%7B"));
-    OutText = OutText.Replace(TEXT("}"), TEXT("%7D"));
-
-    return OutText;
+    return PlayFabCommon::PlayFabCommonUtils::PercentEncode(Text);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -82,9 +83,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddGenericID(FServerAddGenericIDRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -98,16 +97,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddGenericID(FServerAddGenericIDRequest re
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.GenericId != nullptr) OutRestJsonObj->SetObjectField(TEXT("GenericId"), request.GenericId);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("GenericId"), request.GenericId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -125,7 +121,7 @@ void UPlayFabServerAPI::HelperAddGenericID(FPlayFabBaseModel response, UObject*
         FServerEmptyResult ResultStruct = UPlayFabServerModelDecoder::decodeEmptyResultResponse(response.responseData);
         OnSuccessAddGenericID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddGenericID.Unbind();
 }
 
 /** Bans users by PlayFab ID with optional IP address, or MAC address for the provided game. */
@@ -135,9 +131,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::BanUsers(FServerBanUsersRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -151,16 +145,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::BanUsers(FServerBanUsersRequest request,
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Bans.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Bans"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Bans"), request.Bans);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObjectArray(TEXT("Bans"), request.Bans);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -178,7 +169,7 @@ void UPlayFabServerAPI::HelperBanUsers(FPlayFabBaseModel response, UObject* cust
         FServerBanUsersResult ResultStruct = UPlayFabServerModelDecoder::decodeBanUsersResultResponse(response.responseData);
         OnSuccessBanUsers.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessBanUsers.Unbind();
 }
 
 /** Removes a user's player account from a title and deletes all associated data */
@@ -188,9 +179,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::DeletePlayer(FServerDeletePlayerRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -204,15 +193,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::DeletePlayer(FServerDeletePlayerRequest re
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -230,7 +216,7 @@ void UPlayFabServerAPI::HelperDeletePlayer(FPlayFabBaseModel response, UObject*
         FServerDeletePlayerResult ResultStruct = UPlayFabServerModelDecoder::decodeDeletePlayerResultResponse(response.responseData);
         OnSuccessDeletePlayer.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeletePlayer.Unbind();
 }
 
 /** Deletes push notification template for title */
@@ -240,9 +226,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::DeletePushNotificationTemplate(FServerDele
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -256,15 +240,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::DeletePushNotificationTemplate(FServerDele
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.PushNotificationTemplateId.IsEmpty() || request.PushNotificationTemplateId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PushNotificationTemplateId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PushNotificationTemplateId"), request.PushNotificationTemplateId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("PushNotificationTemplateId"), request.PushNotificationTemplateId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -282,7 +263,7 @@ void UPlayFabServerAPI::HelperDeletePushNotificationTemplate(FPlayFabBaseModel r
         FServerDeletePushNotificationTemplateResult ResultStruct = UPlayFabServerModelDecoder::decodeDeletePushNotificationTemplateResultResponse(response.responseData);
         OnSuccessDeletePushNotificationTemplate.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeletePushNotificationTemplate.Unbind();
 }
 
 /** Retrieves the player's profile */
@@ -292,9 +273,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerProfile(FServerGetPlayerProfileRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -308,17 +287,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerProfile(FServerGetPlayerProfileRe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteObject(TEXT("ProfileConstraints"), request.ProfileConstraints);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -336,7 +312,7 @@ void UPlayFabServerAPI::HelperGetPlayerProfile(FPlayFabBaseModel response, UObje
         FServerGetPlayerProfileResult ResultStruct = UPlayFabServerModelDecoder::decodeGetPlayerProfileResultResponse(response.responseData);
         OnSuccessGetPlayerProfile.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerProfile.Unbind();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Facebook identifiers. */
@@ -346,9 +322,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayFabIDsFromFacebookIDs(FServerGetPla
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -362,18 +336,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayFabIDsFromFacebookIDs(FServerGetPla
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.FacebookIDs.IsEmpty() || request.FacebookIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FacebookIDs"));
-    } else {
-        TArray<FString> FacebookIDsArray;
-        FString(request.FacebookIDs).ParseIntoArray(FacebookIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("FacebookIDs"), FacebookIDsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("FacebookIDs"), request.FacebookIDs);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -391,7 +359,7 @@ void UPlayFabServerAPI::HelperGetPlayFabIDsFromFacebookIDs(FPlayFabBaseModel res
         FServerGetPlayFabIDsFromFacebookIDsResult ResultStruct = UPlayFabServerModelDecoder::decodeGetPlayFabIDsFromFacebookIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromFacebookIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayFabIDsFromFacebookIDs.Unbind();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Facebook Instant Games identifiers. */
@@ -401,9 +369,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayFabIDsFromFacebookInstantGamesIds(F
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -417,18 +383,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayFabIDsFromFacebookInstantGamesIds(F
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.FacebookInstantGamesIds.IsEmpty() || request.FacebookInstantGamesIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FacebookInstantGamesIds"));
-    } else {
-        TArray<FString> FacebookInstantGamesIdsArray;
-        FString(request.FacebookInstantGamesIds).ParseIntoArray(FacebookInstantGamesIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("FacebookInstantGamesIds"), FacebookInstantGamesIdsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("FacebookInstantGamesIds"), request.FacebookInstantGamesIds);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -446,7 +406,7 @@ void UPlayFabServerAPI::HelperGetPlayFabIDsFromFacebookInstantGamesIds(FPlayFabB
         FServerGetPlayFabIDsFromFacebookInstantGamesIdsResult ResultStruct = UPlayFabServerModelDecoder::decodeGetPlayFabIDsFromFacebookInstantGamesIdsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromFacebookInstantGamesIds.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayFabIDsFromFacebookInstantGamesIds.Unbind();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of generic service identifiers. A generic identifier is the service name plus the service-specific ID for the player, as specified by the title when the generic identifier was added to the player account. */
@@ -456,9 +416,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayFabIDsFromGenericIDs(FServerGetPlay
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -472,15 +430,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayFabIDsFromGenericIDs(FServerGetPlay
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.GenericIDs.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("GenericIDs"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("GenericIDs"), request.GenericIDs);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObjectArray(TEXT("GenericIDs"), request.GenericIDs);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -498,7 +453,7 @@ void UPlayFabServerAPI::HelperGetPlayFabIDsFromGenericIDs(FPlayFabBaseModel resp
         FServerGetPlayFabIDsFromGenericIDsResult ResultStruct = UPlayFabServerModelDecoder::decodeGetPlayFabIDsFromGenericIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromGenericIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayFabIDsFromGenericIDs.Unbind();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Nintendo Switch Device identifiers. */
@@ -508,9 +463,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(F
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -524,18 +477,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(F
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.NintendoSwitchDeviceIds.IsEmpty() || request.NintendoSwitchDeviceIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("NintendoSwitchDeviceIds"));
-    } else {
-        TArray<FString> NintendoSwitchDeviceIdsArray;
-        FString(request.NintendoSwitchDeviceIds).ParseIntoArray(NintendoSwitchDeviceIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("NintendoSwitchDeviceIds"), NintendoSwitchDeviceIdsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("NintendoSwitchDeviceIds"), request.NintendoSwitchDeviceIds);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -553,7 +500,7 @@ void UPlayFabServerAPI::HelperGetPlayFabIDsFromNintendoSwitchDeviceIds(FPlayFabB
         FServerGetPlayFabIDsFromNintendoSwitchDeviceIdsResult ResultStruct = UPlayFabServerModelDecoder::decodeGetPlayFabIDsFromNintendoSwitchDeviceIdsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromNintendoSwitchDeviceIds.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayFabIDsFromNintendoSwitchDeviceIds.Unbind();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of PlayStation Network identifiers. */
@@ -563,9 +510,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayFabIDsFromPSNAccountIDs(FServerGetP
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -579,19 +524,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayFabIDsFromPSNAccountIDs(FServerGetP
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("IssuerId"), request.IssuerId);
-    // Check to see if string is empty
-    if (request.PSNAccountIDs.IsEmpty() || request.PSNAccountIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PSNAccountIDs"));
-    } else {
-        TArray<FString> PSNAccountIDsArray;
-        FString(request.PSNAccountIDs).ParseIntoArray(PSNAccountIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("PSNAccountIDs"), PSNAccountIDsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("IssuerId"), request.IssuerId);
+    RequestWriter.WriteStringArray(TEXT("PSNAccountIDs"), request.PSNAccountIDs);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -609,7 +548,7 @@ void UPlayFabServerAPI::HelperGetPlayFabIDsFromPSNAccountIDs(FPlayFabBaseModel r
         FServerGetPlayFabIDsFromPSNAccountIDsResult ResultStruct = UPlayFabServerModelDecoder::decodeGetPlayFabIDsFromPSNAccountIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromPSNAccountIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayFabIDsFromPSNAccountIDs.Unbind();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of Steam identifiers. The Steam identifiers are the profile IDs for the user accounts, available as SteamId in the Steamworks Community API calls. */
@@ -619,9 +558,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayFabIDsFromSteamIDs(FServerGetPlayFa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -635,18 +572,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayFabIDsFromSteamIDs(FServerGetPlayFa
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.SteamStringIDs.IsEmpty() || request.SteamStringIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SteamStringIDs"));
-    } else {
-        TArray<FString> SteamStringIDsArray;
-        FString(request.SteamStringIDs).ParseIntoArray(SteamStringIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("SteamStringIDs"), SteamStringIDsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("SteamStringIDs"), request.SteamStringIDs);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -664,7 +595,7 @@ void UPlayFabServerAPI::HelperGetPlayFabIDsFromSteamIDs(FPlayFabBaseModel respon
         FServerGetPlayFabIDsFromSteamIDsResult ResultStruct = UPlayFabServerModelDecoder::decodeGetPlayFabIDsFromSteamIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromSteamIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayFabIDsFromSteamIDs.Unbind();
 }
 
 /** Retrieves the unique PlayFab identifiers for the given set of XboxLive identifiers. */
@@ -674,9 +605,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayFabIDsFromXboxLiveIDs(FServerGetPla
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -690,23 +619,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayFabIDsFromXboxLiveIDs(FServerGetPla
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Sandbox.IsEmpty() || request.Sandbox == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Sandbox"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Sandbox"), request.Sandbox);
-    }
-    // Check to see if string is empty
-    if (request.XboxLiveAccountIDs.IsEmpty() || request.XboxLiveAccountIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("XboxLiveAccountIDs"));
-    } else {
-        TArray<FString> XboxLiveAccountIDsArray;
-        FString(request.XboxLiveAccountIDs).ParseIntoArray(XboxLiveAccountIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("XboxLiveAccountIDs"), XboxLiveAccountIDsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Sandbox"), request.Sandbox);
+    RequestWriter.WriteStringArray(TEXT("XboxLiveAccountIDs"), request.XboxLiveAccountIDs);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -724,7 +643,7 @@ void UPlayFabServerAPI::HelperGetPlayFabIDsFromXboxLiveIDs(FPlayFabBaseModel res
         FServerGetPlayFabIDsFromXboxLiveIDsResult ResultStruct = UPlayFabServerModelDecoder::decodeGetPlayFabIDsFromXboxLiveIDsResultResponse(response.responseData);
         OnSuccessGetPlayFabIDsFromXboxLiveIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayFabIDsFromXboxLiveIDs.Unbind();
 }
 
 /** Retrieves the associated PlayFab account identifiers for the given set of server custom identifiers. */
@@ -734,9 +653,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetServerCustomIDsFromPlayFabIDs(FServerGe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -750,18 +667,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetServerCustomIDsFromPlayFabIDs(FServerGe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.PlayFabIDs.IsEmpty() || request.PlayFabIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabIDs"));
-    } else {
-        TArray<FString> PlayFabIDsArray;
-        FString(request.PlayFabIDs).ParseIntoArray(PlayFabIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("PlayFabIDs"), PlayFabIDsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("PlayFabIDs"), request.PlayFabIDs);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -779,7 +690,7 @@ void UPlayFabServerAPI::HelperGetServerCustomIDsFromPlayFabIDs(FPlayFabBaseModel
         FServerGetServerCustomIDsFromPlayFabIDsResult ResultStruct = UPlayFabServerModelDecoder::decodeGetServerCustomIDsFromPlayFabIDsResultResponse(response.responseData);
         OnSuccessGetServerCustomIDsFromPlayFabIDs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetServerCustomIDsFromPlayFabIDs.Unbind();
 }
 
 /** Retrieves the relevant details for a specified user */
@@ -789,9 +700,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserAccountInfo(FServerGetUserAccountIn
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -805,15 +714,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserAccountInfo(FServerGetUserAccountIn
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -831,7 +737,7 @@ void UPlayFabServerAPI::HelperGetUserAccountInfo(FPlayFabBaseModel response, UOb
         FServerGetUserAccountInfoResult ResultStruct = UPlayFabServerModelDecoder::decodeGetUserAccountInfoResultResponse(response.responseData);
         OnSuccessGetUserAccountInfo.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserAccountInfo.Unbind();
 }
 
 /** Gets all bans for a user. */
@@ -841,9 +747,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserBans(FServerGetUserBansRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -857,15 +761,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserBans(FServerGetUserBansRequest requ
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -883,7 +784,7 @@ void UPlayFabServerAPI::HelperGetUserBans(FPlayFabBaseModel response, UObject* c
         FServerGetUserBansResult ResultStruct = UPlayFabServerModelDecoder::decodeGetUserBansResultResponse(response.responseData);
         OnSuccessGetUserBans.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserBans.Unbind();
 }
 
 /** Links the PlayStation Network account associated with the provided access code to the user's PlayFab account */
@@ -893,9 +794,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::LinkPSNAccount(FServerLinkPSNAccountReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -909,28 +808,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::LinkPSNAccount(FServerLinkPSNAccountReques
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AuthCode.IsEmpty() || request.AuthCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AuthCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AuthCode"), request.AuthCode);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-    OutRestJsonObj->SetNumberField(TEXT("IssuerId"), request.IssuerId);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.RedirectUri.IsEmpty() || request.RedirectUri == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RedirectUri"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("RedirectUri"), request.RedirectUri);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AuthCode"), request.AuthCode);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
+    RequestWriter.WriteNumber(TEXT("IssuerId"), request.IssuerId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("RedirectUri"), request.RedirectUri);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -948,7 +836,7 @@ void UPlayFabServerAPI::HelperLinkPSNAccount(FPlayFabBaseModel response, UObject
         FServerLinkPSNAccountResult ResultStruct = UPlayFabServerModelDecoder::decodeLinkPSNAccountResultResponse(response.responseData);
         OnSuccessLinkPSNAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkPSNAccount.Unbind();
 }
 
 /** Links the custom server identifier, generated by the title, to the user's PlayFab account. */
@@ -958,9 +846,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::LinkServerCustomId(FServerLinkServerCustom
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -974,22 +860,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::LinkServerCustomId(FServerLinkServerCustom
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.ServerCustomId.IsEmpty() || request.ServerCustomId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ServerCustomId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ServerCustomId"), request.ServerCustomId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("ServerCustomId"), request.ServerCustomId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1007,7 +886,7 @@ void UPlayFabServerAPI::HelperLinkServerCustomId(FPlayFabBaseModel response, UOb
         FServerLinkServerCustomIdResult ResultStruct = UPlayFabServerModelDecoder::decodeLinkServerCustomIdResultResponse(response.responseData);
         OnSuccessLinkServerCustomId.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkServerCustomId.Unbind();
 }
 
 /** Links the Xbox Live account associated with the provided access code to the user's PlayFab account */
@@ -1017,9 +896,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::LinkXboxAccount(FServerLinkXboxAccountRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1033,22 +910,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::LinkXboxAccount(FServerLinkXboxAccountRequ
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.XboxToken.IsEmpty() || request.XboxToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("XboxToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("XboxToken"), request.XboxToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("ForceLink"), request.ForceLink);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("XboxToken"), request.XboxToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1066,7 +936,7 @@ void UPlayFabServerAPI::HelperLinkXboxAccount(FPlayFabBaseModel response, UObjec
         FServerLinkXboxAccountResult ResultStruct = UPlayFabServerModelDecoder::decodeLinkXboxAccountResultResponse(response.responseData);
         OnSuccessLinkXboxAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLinkXboxAccount.Unbind();
 }
 
 /** Removes the specified generic service identifier from the player's PlayFab account. */
@@ -1076,9 +946,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::RemoveGenericID(FServerRemoveGenericIDRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1092,16 +960,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::RemoveGenericID(FServerRemoveGenericIDRequ
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.GenericId != nullptr) OutRestJsonObj->SetObjectField(TEXT("GenericId"), request.GenericId);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("GenericId"), request.GenericId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1117,10 +982,10 @@ void UPlayFabServerAPI::HelperRemoveGenericID(FPlayFabBaseModel response, UObjec
     else if (!error.hasError && OnSuccessRemoveGenericID.IsBound())
     {
         FServerEmptyResult ResultStruct = UPlayFabServerModelDecoder::decodeEmptyResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessRemoveGenericID.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRemoveGenericID.Unbind();
 }
 
 /** Revoke all active bans for a user. */
@@ -1130,9 +995,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::RevokeAllBansForUser(FServerRevokeAllBansF
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1146,15 +1009,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::RevokeAllBansForUser(FServerRevokeAllBansF
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1172,7 +1032,7 @@ void UPlayFabServerAPI::HelperRevokeAllBansForUser(FPlayFabBaseModel response, U
         FServerRevokeAllBansForUserResult ResultStruct = UPlayFabServerModelDecoder::decodeRevokeAllBansForUserResultResponse(response.responseData);
         OnSuccessRevokeAllBansForUser.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRevokeAllBansForUser.Unbind();
 }
 
 /** Revoke all active bans specified with BanId. */
@@ -1182,9 +1042,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::RevokeBans(FServerRevokeBansRequest reques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1198,18 +1056,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::RevokeBans(FServerRevokeBansRequest reques
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.BanIds.IsEmpty() || request.BanIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BanIds"));
-    } else {
-        TArray<FString> BanIdsArray;
-        FString(request.BanIds).ParseIntoArray(BanIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("BanIds"), BanIdsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("BanIds"), request.BanIds);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1227,7 +1079,7 @@ void UPlayFabServerAPI::HelperRevokeBans(FPlayFabBaseModel response, UObject* cu
         FServerRevokeBansResult ResultStruct = UPlayFabServerModelDecoder::decodeRevokeBansResultResponse(response.responseData);
         OnSuccessRevokeBans.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRevokeBans.Unbind();
 }
 
 /** Saves push notification template for title */
@@ -1237,9 +1089,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::SavePushNotificationTemplate(FServerSavePu
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1253,31 +1103,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::SavePushNotificationTemplate(FServerSavePu
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AndroidPayload.IsEmpty() || request.AndroidPayload == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AndroidPayload"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AndroidPayload"), request.AndroidPayload);
-    }
-    if (request.Id.IsEmpty() || request.Id == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Id"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Id"), request.Id);
-    }
-    if (request.IOSPayload.IsEmpty() || request.IOSPayload == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("IOSPayload"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("IOSPayload"), request.IOSPayload);
-    }
-    if (request.LocalizedPushNotificationTemplates != nullptr) OutRestJsonObj->SetObjectField(TEXT("LocalizedPushNotificationTemplates"), request.LocalizedPushNotificationTemplates);
-    if (request.Name.IsEmpty() || request.Name == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Name"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Name"), request.Name);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AndroidPayload"), request.AndroidPayload);
+    RequestWriter.WriteStringOrNull(TEXT("Id"), request.Id);
+    RequestWriter.WriteStringOrNull(TEXT("IOSPayload"), request.IOSPayload);
+    RequestWriter.WriteObject(TEXT("LocalizedPushNotificationTemplates"), request.LocalizedPushNotificationTemplates);
+    RequestWriter.WriteStringOrNull(TEXT("Name"), request.Name);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1295,7 +1130,7 @@ void UPlayFabServerAPI::HelperSavePushNotificationTemplate(FPlayFabBaseModel res
         FServerSavePushNotificationTemplateResult ResultStruct = UPlayFabServerModelDecoder::decodeSavePushNotificationTemplateResultResponse(response.responseData);
         OnSuccessSavePushNotificationTemplate.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSavePushNotificationTemplate.Unbind();
 }
 
 /** Forces an email to be sent to the registered contact email address for the user's account based on an account recovery email template */
@@ -1305,9 +1140,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::SendCustomAccountRecoveryEmail(FServerSend
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1321,26 +1154,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::SendCustomAccountRecoveryEmail(FServerSend
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    if (request.EmailTemplateId.IsEmpty() || request.EmailTemplateId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EmailTemplateId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EmailTemplateId"), request.EmailTemplateId);
-    }
-    if (request.Username.IsEmpty() || request.Username == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Username"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Username"), request.Username);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Email"), request.Email);
+    RequestWriter.WriteStringOrNull(TEXT("EmailTemplateId"), request.EmailTemplateId);
+    RequestWriter.WriteStringOrNull(TEXT("Username"), request.Username);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1358,7 +1180,7 @@ void UPlayFabServerAPI::HelperSendCustomAccountRecoveryEmail(FPlayFabBaseModel r
         FServerSendCustomAccountRecoveryEmailResult ResultStruct = UPlayFabServerModelDecoder::decodeSendCustomAccountRecoveryEmailResultResponse(response.responseData);
         OnSuccessSendCustomAccountRecoveryEmail.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSendCustomAccountRecoveryEmail.Unbind();
 }
 
 /** Sends an email based on an email template to a player's contact email  */
@@ -1368,9 +1190,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::SendEmailFromTemplate(FServerSendEmailFrom
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1384,21 +1204,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::SendEmailFromTemplate(FServerSendEmailFrom
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EmailTemplateId.IsEmpty() || request.EmailTemplateId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EmailTemplateId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EmailTemplateId"), request.EmailTemplateId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EmailTemplateId"), request.EmailTemplateId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1416,7 +1229,7 @@ void UPlayFabServerAPI::HelperSendEmailFromTemplate(FPlayFabBaseModel response,
         FServerSendEmailFromTemplateResult ResultStruct = UPlayFabServerModelDecoder::decodeSendEmailFromTemplateResultResponse(response.responseData);
         OnSuccessSendEmailFromTemplate.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSendEmailFromTemplate.Unbind();
 }
 
 /** Sends an iOS/Android Push Notification to a specific user, if that user's device has been configured for Push Notifications in PlayFab. If a user has linked both Android and iOS devices, both will be notified. */
@@ -1426,9 +1239,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::SendPushNotification(FServerSendPushNotifi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1442,40 +1253,18 @@ UPlayFabServerAPI* UPlayFabServerAPI::SendPushNotification(FServerSendPushNotifi
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AdvancedPlatformDelivery.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("AdvancedPlatformDelivery"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("AdvancedPlatformDelivery"), request.AdvancedPlatformDelivery);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Message.IsEmpty() || request.Message == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Message"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Message"), request.Message);
-    }
-    if (request.Package != nullptr) OutRestJsonObj->SetObjectField(TEXT("Package"), request.Package);
-    if (request.Recipient.IsEmpty() || request.Recipient == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Recipient"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Recipient"), request.Recipient);
-    }
-    if (request.Subject.IsEmpty() || request.Subject == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Subject"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Subject"), request.Subject);
-    }
-    // Check to see if string is empty
-    if (request.TargetPlatforms.IsEmpty() || request.TargetPlatforms == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TargetPlatforms"));
-    } else {
-        TArray<FString> TargetPlatformsArray;
-        FString(request.TargetPlatforms).ParseIntoArray(TargetPlatformsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("TargetPlatforms"), TargetPlatformsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObjectArray(TEXT("AdvancedPlatformDelivery"), request.AdvancedPlatformDelivery);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Message"), request.Message);
+    RequestWriter.WriteObject(TEXT("Package"), request.Package);
+    RequestWriter.WriteStringOrNull(TEXT("Recipient"), request.Recipient);
+    RequestWriter.WriteStringOrNull(TEXT("Subject"), request.Subject);
+    RequestWriter.WriteStringArray(TEXT("TargetPlatforms"), request.TargetPlatforms);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1493,7 +1282,7 @@ void UPlayFabServerAPI::HelperSendPushNotification(FPlayFabBaseModel response, U
         FServerSendPushNotificationResult ResultStruct = UPlayFabServerModelDecoder::decodeSendPushNotificationResultResponse(response.responseData);
         OnSuccessSendPushNotification.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSendPushNotification.Unbind();
 }
 
 /** Sends an iOS/Android Push Notification template to a specific user, if that user's device has been configured for Push Notifications in PlayFab. If a user has linked both Android and iOS devices, both will be notified. */
@@ -1503,9 +1292,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::SendPushNotificationFromTemplate(FServerSe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1519,21 +1306,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::SendPushNotificationFromTemplate(FServerSe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PushNotificationTemplateId.IsEmpty() || request.PushNotificationTemplateId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PushNotificationTemplateId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PushNotificationTemplateId"), request.PushNotificationTemplateId);
-    }
-    if (request.Recipient.IsEmpty() || request.Recipient == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Recipient"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Recipient"), request.Recipient);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PushNotificationTemplateId"), request.PushNotificationTemplateId);
+    RequestWriter.WriteStringOrNull(TEXT("Recipient"), request.Recipient);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1549,10 +1329,10 @@ void UPlayFabServerAPI::HelperSendPushNotificationFromTemplate(FPlayFabBaseModel
     else if (!error.hasError && OnSuccessSendPushNotificationFromTemplate.IsBound())
     {
         FServerSendPushNotificationResult ResultStruct = UPlayFabServerModelDecoder::decodeSendPushNotificationResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessSendPushNotificationFromTemplate.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSendPushNotificationFromTemplate.Unbind();
 }
 
 /** Unlinks the related PSN account from the user's PlayFab account */
@@ -1562,9 +1342,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UnlinkPSNAccount(FServerUnlinkPSNAccountRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1578,16 +1356,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::UnlinkPSNAccount(FServerUnlinkPSNAccountRe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1605,7 +1380,7 @@ void UPlayFabServerAPI::HelperUnlinkPSNAccount(FPlayFabBaseModel response, UObje
         FServerUnlinkPSNAccountResult ResultStruct = UPlayFabServerModelDecoder::decodeUnlinkPSNAccountResultResponse(response.responseData);
         OnSuccessUnlinkPSNAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkPSNAccount.Unbind();
 }
 
 /** Unlinks the custom server identifier from the user's PlayFab account. */
@@ -1615,9 +1390,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UnlinkServerCustomId(FServerUnlinkServerCu
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1631,21 +1404,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::UnlinkServerCustomId(FServerUnlinkServerCu
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.ServerCustomId.IsEmpty() || request.ServerCustomId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ServerCustomId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ServerCustomId"), request.ServerCustomId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("ServerCustomId"), request.ServerCustomId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1663,7 +1429,7 @@ void UPlayFabServerAPI::HelperUnlinkServerCustomId(FPlayFabBaseModel response, U
         FServerUnlinkServerCustomIdResult ResultStruct = UPlayFabServerModelDecoder::decodeUnlinkServerCustomIdResultResponse(response.responseData);
         OnSuccessUnlinkServerCustomId.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkServerCustomId.Unbind();
 }
 
 /** Unlinks the related Xbox Live account from the user's PlayFab account */
@@ -1673,9 +1439,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UnlinkXboxAccount(FServerUnlinkXboxAccount
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1689,16 +1453,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::UnlinkXboxAccount(FServerUnlinkXboxAccount
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1716,7 +1477,7 @@ void UPlayFabServerAPI::HelperUnlinkXboxAccount(FPlayFabBaseModel response, UObj
         FServerUnlinkXboxAccountResult ResultStruct = UPlayFabServerModelDecoder::decodeUnlinkXboxAccountResultResponse(response.responseData);
         OnSuccessUnlinkXboxAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlinkXboxAccount.Unbind();
 }
 
 /** Update the avatar URL of the specified player */
@@ -1726,9 +1487,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateAvatarUrl(FServerUpdateAvatarUrlRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1742,20 +1501,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateAvatarUrl(FServerUpdateAvatarUrlRequ
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.ImageUrl.IsEmpty() || request.ImageUrl == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ImageUrl"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ImageUrl"), request.ImageUrl);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("ImageUrl"), request.ImageUrl);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1773,7 +1525,7 @@ void UPlayFabServerAPI::HelperUpdateAvatarUrl(FPlayFabBaseModel response, UObjec
         FServerEmptyResponse ResultStruct = UPlayFabServerModelDecoder::decodeEmptyResponseResponse(response.responseData);
         OnSuccessUpdateAvatarUrl.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateAvatarUrl.Unbind();
 }
 
 /** Updates information of a list of existing bans specified with Ban Ids. */
@@ -1783,9 +1535,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateBans(FServerUpdateBansRequest reques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1799,15 +1549,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateBans(FServerUpdateBansRequest reques
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Bans.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Bans"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Bans"), request.Bans);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObjectArray(TEXT("Bans"), request.Bans);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1825,7 +1572,7 @@ void UPlayFabServerAPI::HelperUpdateBans(FPlayFabBaseModel response, UObject* cu
         FServerUpdateBansResult ResultStruct = UPlayFabServerModelDecoder::decodeUpdateBansResultResponse(response.responseData);
         OnSuccessUpdateBans.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateBans.Unbind();
 }
 
 
@@ -1839,9 +1586,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::WriteCharacterEvent(FServerWriteServerChar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1855,32 +1600,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::WriteCharacterEvent(FServerWriteServerChar
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Body != nullptr) OutRestJsonObj->SetObjectField(TEXT("Body"), request.Body);
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EventName.IsEmpty() || request.EventName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EventName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EventName"), request.EventName);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("Body"), request.Body);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EventName"), request.EventName);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("Timestamp"), request.Timestamp);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1898,7 +1628,7 @@ void UPlayFabServerAPI::HelperWriteCharacterEvent(FPlayFabBaseModel response, UO
         FServerWriteEventResponse ResultStruct = UPlayFabServerModelDecoder::decodeWriteEventResponseResponse(response.responseData);
         OnSuccessWriteCharacterEvent.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessWriteCharacterEvent.Unbind();
 }
 
 /** Writes a player-based event into PlayStream. */
@@ -1908,9 +1638,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::WritePlayerEvent(FServerWriteServerPlayerE
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1924,27 +1652,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::WritePlayerEvent(FServerWriteServerPlayerE
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Body != nullptr) OutRestJsonObj->SetObjectField(TEXT("Body"), request.Body);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EventName.IsEmpty() || request.EventName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EventName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EventName"), request.EventName);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("Body"), request.Body);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EventName"), request.EventName);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("Timestamp"), request.Timestamp);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1960,10 +1677,10 @@ void UPlayFabServerAPI::HelperWritePlayerEvent(FPlayFabBaseModel response, UObje
     else if (!error.hasError && OnSuccessWritePlayerEvent.IsBound())
     {
         FServerWriteEventResponse ResultStruct = UPlayFabServerModelDecoder::decodeWriteEventResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessWritePlayerEvent.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessWritePlayerEvent.Unbind();
 }
 
 /** Writes a title-based event into PlayStream. */
@@ -1973,9 +1690,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::WriteTitleEvent(FServerWriteTitleEventRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1989,22 +1704,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::WriteTitleEvent(FServerWriteTitleEventRequ
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Body != nullptr) OutRestJsonObj->SetObjectField(TEXT("Body"), request.Body);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.EventName.IsEmpty() || request.EventName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EventName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EventName"), request.EventName);
-    }
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("Body"), request.Body);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("EventName"), request.EventName);
+    RequestWriter.WriteStringOrNull(TEXT("Timestamp"), request.Timestamp);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2020,10 +1728,10 @@ void UPlayFabServerAPI::HelperWriteTitleEvent(FPlayFabBaseModel response, UObjec
     else if (!error.hasError && OnSuccessWriteTitleEvent.IsBound())
     {
         FServerWriteEventResponse ResultStruct = UPlayFabServerModelDecoder::decodeWriteEventResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessWriteTitleEvent.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessWriteTitleEvent.Unbind();
 }
 
 
@@ -2037,9 +1745,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::AuthenticateSessionTicket(FServerAuthentic
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2053,15 +1759,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::AuthenticateSessionTicket(FServerAuthentic
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.SessionTicket.IsEmpty() || request.SessionTicket == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SessionTicket"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SessionTicket"), request.SessionTicket);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("SessionTicket"), request.SessionTicket);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2079,7 +1782,7 @@ void UPlayFabServerAPI::HelperAuthenticateSessionTicket(FPlayFabBaseModel respon
         FServerAuthenticateSessionTicketResult ResultStruct = UPlayFabServerModelDecoder::decodeAuthenticateSessionTicketResultResponse(response.responseData);
         OnSuccessAuthenticateSessionTicket.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAuthenticateSessionTicket.Unbind();
 }
 
 /** Securely login a game client from an external server backend using a custom identifier for that player. Server Custom ID and Client Custom ID are mutually exclusive and cannot be used to retrieve the same player account. */
@@ -2089,9 +1792,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::LoginWithServerCustomId(FServerLoginWithSe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2105,23 +1806,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::LoginWithServerCustomId(FServerLoginWithSe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.ServerCustomId.IsEmpty() || request.ServerCustomId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ServerCustomId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ServerCustomId"), request.ServerCustomId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteStringOrNull(TEXT("ServerCustomId"), request.ServerCustomId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2139,7 +1833,7 @@ void UPlayFabServerAPI::HelperLoginWithServerCustomId(FPlayFabBaseModel response
         FServerServerLoginResult ResultStruct = UPlayFabServerModelDecoder::decodeServerLoginResultResponse(response.responseData);
         OnSuccessLoginWithServerCustomId.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithServerCustomId.Unbind();
 }
 
 /** Signs the user in using an Steam ID, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -2149,9 +1843,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::LoginWithSteamId(FServerLoginWithSteamIdRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2165,18 +1857,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::LoginWithSteamId(FServerLoginWithSteamIdRe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.SteamId.IsEmpty() || request.SteamId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SteamId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SteamId"), request.SteamId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("SteamId"), request.SteamId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2192,10 +1881,10 @@ void UPlayFabServerAPI::HelperLoginWithSteamId(FPlayFabBaseModel response, UObje
     else if (!error.hasError && OnSuccessLoginWithSteamId.IsBound())
     {
         FServerServerLoginResult ResultStruct = UPlayFabServerModelDecoder::decodeServerLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessLoginWithSteamId.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithSteamId.Unbind();
 }
 
 /** Signs the user in using a Xbox Live Token from an external server backend, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -2205,9 +1894,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::LoginWithXbox(FServerLoginWithXboxRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2221,18 +1908,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::LoginWithXbox(FServerLoginWithXboxRequest
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.XboxToken.IsEmpty() || request.XboxToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("XboxToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("XboxToken"), request.XboxToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("XboxToken"), request.XboxToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2248,10 +1932,10 @@ void UPlayFabServerAPI::HelperLoginWithXbox(FPlayFabBaseModel response, UObject*
     else if (!error.hasError && OnSuccessLoginWithXbox.IsBound())
     {
         FServerServerLoginResult ResultStruct = UPlayFabServerModelDecoder::decodeServerLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessLoginWithXbox.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithXbox.Unbind();
 }
 
 /** Signs the user in using an Xbox ID and Sandbox ID, returning a session identifier that can subsequently be used for API calls which require an authenticated user */
@@ -2261,9 +1945,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::LoginWithXboxId(FServerLoginWithXboxIdRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2277,23 +1959,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::LoginWithXboxId(FServerLoginWithXboxIdRequ
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.Sandbox.IsEmpty() || request.Sandbox == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Sandbox"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Sandbox"), request.Sandbox);
-    }
-    if (request.XboxId.IsEmpty() || request.XboxId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("XboxId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("XboxId"), request.XboxId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("CreateAccount"), request.CreateAccount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("Sandbox"), request.Sandbox);
+    RequestWriter.WriteStringOrNull(TEXT("XboxId"), request.XboxId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2309,10 +1984,10 @@ void UPlayFabServerAPI::HelperLoginWithXboxId(FPlayFabBaseModel response, UObjec
     else if (!error.hasError && OnSuccessLoginWithXboxId.IsBound())
     {
         FServerServerLoginResult ResultStruct = UPlayFabServerModelDecoder::decodeServerLoginResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessLoginWithXboxId.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessLoginWithXboxId.Unbind();
 }
 
 /** Sets the player's secret if it is not already set. Player secrets are used to sign API requests. To reset a player's secret use the Admin or Server API method SetPlayerSecret. */
@@ -2322,9 +1997,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetPlayerSecret(FServerSetPlayerSecretRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2338,20 +2011,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetPlayerSecret(FServerSetPlayerSecretRequ
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2369,7 +2035,7 @@ void UPlayFabServerAPI::HelperSetPlayerSecret(FPlayFabBaseModel response, UObjec
         FServerSetPlayerSecretResult ResultStruct = UPlayFabServerModelDecoder::decodeSetPlayerSecretResultResponse(response.responseData);
         OnSuccessSetPlayerSecret.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetPlayerSecret.Unbind();
 }
 
 
@@ -2383,9 +2049,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterData(FServerGetCharacterDataRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2399,29 +2063,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterData(FServerGetCharacterDataRe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2439,7 +2089,7 @@ void UPlayFabServerAPI::HelperGetCharacterData(FPlayFabBaseModel response, UObje
         FServerGetCharacterDataResult ResultStruct = UPlayFabServerModelDecoder::decodeGetCharacterDataResultResponse(response.responseData);
         OnSuccessGetCharacterData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetCharacterData.Unbind();
 }
 
 /** Retrieves the title-specific custom data for the user's character which cannot be accessed by the client */
@@ -2449,9 +2099,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterInternalData(FServerGetCharact
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2465,29 +2113,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterInternalData(FServerGetCharact
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2503,10 +2137,10 @@ void UPlayFabServerAPI::HelperGetCharacterInternalData(FPlayFabBaseModel respons
     else if (!error.hasError && OnSuccessGetCharacterInternalData.IsBound())
     {
         FServerGetCharacterDataResult ResultStruct = UPlayFabServerModelDecoder::decodeGetCharacterDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetCharacterInternalData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetCharacterInternalData.Unbind();
 }
 
 /** Retrieves the title-specific custom data for the user's character which can only be read by the client */
@@ -2516,9 +2150,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterReadOnlyData(FServerGetCharact
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2532,29 +2164,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterReadOnlyData(FServerGetCharact
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2570,10 +2188,10 @@ void UPlayFabServerAPI::HelperGetCharacterReadOnlyData(FPlayFabBaseModel respons
     else if (!error.hasError && OnSuccessGetCharacterReadOnlyData.IsBound())
     {
         FServerGetCharacterDataResult ResultStruct = UPlayFabServerModelDecoder::decodeGetCharacterDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetCharacterReadOnlyData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetCharacterReadOnlyData.Unbind();
 }
 
 /** Updates the title-specific custom data for the user's character which is readable and writable by the client */
@@ -2583,9 +2201,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateCharacterData(FServerUpdateCharacter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2599,33 +2215,19 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateCharacterData(FServerUpdateCharacter
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
     FString temp_Permission;
     if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+        RequestWriter.WriteString(TEXT("Permission"), temp_Permission);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2643,7 +2245,7 @@ void UPlayFabServerAPI::HelperUpdateCharacterData(FPlayFabBaseModel response, UO
         FServerUpdateCharacterDataResult ResultStruct = UPlayFabServerModelDecoder::decodeUpdateCharacterDataResultResponse(response.responseData);
         OnSuccessUpdateCharacterData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateCharacterData.Unbind();
 }
 
 /** Updates the title-specific custom data for the user's character which cannot be accessed by the client */
@@ -2653,9 +2255,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateCharacterInternalData(FServerUpdateC
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2669,33 +2269,19 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateCharacterInternalData(FServerUpdateC
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
     FString temp_Permission;
     if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+        RequestWriter.WriteString(TEXT("Permission"), temp_Permission);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2711,10 +2297,10 @@ void UPlayFabServerAPI::HelperUpdateCharacterInternalData(FPlayFabBaseModel resp
     else if (!error.hasError && OnSuccessUpdateCharacterInternalData.IsBound())
     {
         FServerUpdateCharacterDataResult ResultStruct = UPlayFabServerModelDecoder::decodeUpdateCharacterDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateCharacterInternalData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateCharacterInternalData.Unbind();
 }
 
 /** Updates the title-specific custom data for the user's character which can only be read by the client */
@@ -2724,9 +2310,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateCharacterReadOnlyData(FServerUpdateC
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2740,33 +2324,19 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateCharacterReadOnlyData(FServerUpdateC
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
     FString temp_Permission;
     if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+        RequestWriter.WriteString(TEXT("Permission"), temp_Permission);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2782,10 +2352,10 @@ void UPlayFabServerAPI::HelperUpdateCharacterReadOnlyData(FPlayFabBaseModel resp
     else if (!error.hasError && OnSuccessUpdateCharacterReadOnlyData.IsBound())
     {
         FServerUpdateCharacterDataResult ResultStruct = UPlayFabServerModelDecoder::decodeUpdateCharacterDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateCharacterReadOnlyData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateCharacterReadOnlyData.Unbind();
 }
 
 
@@ -2799,9 +2369,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::DeleteCharacterFromUser(FServerDeleteChara
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2815,22 +2383,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::DeleteCharacterFromUser(FServerDeleteChara
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("SaveCharacterInventory"), request.SaveCharacterInventory);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteBool(TEXT("SaveCharacterInventory"), request.SaveCharacterInventory);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2848,7 +2409,7 @@ void UPlayFabServerAPI::HelperDeleteCharacterFromUser(FPlayFabBaseModel response
         FServerDeleteCharacterFromUserResult ResultStruct = UPlayFabServerModelDecoder::decodeDeleteCharacterFromUserResultResponse(response.responseData);
         OnSuccessDeleteCharacterFromUser.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteCharacterFromUser.Unbind();
 }
 
 /** Lists all of the characters that belong to a specific user. CharacterIds are not globally unique; characterId must be evaluated with the parent PlayFabId to guarantee uniqueness. */
@@ -2858,9 +2419,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetAllUsersCharacters(FServerListUsersChar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2874,15 +2433,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetAllUsersCharacters(FServerListUsersChar
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2900,7 +2456,7 @@ void UPlayFabServerAPI::HelperGetAllUsersCharacters(FPlayFabBaseModel response,
         FServerListUsersCharactersResult ResultStruct = UPlayFabServerModelDecoder::decodeListUsersCharactersResultResponse(response.responseData);
         OnSuccessGetAllUsersCharacters.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetAllUsersCharacters.Unbind();
 }
 
 /** Retrieves a list of ranked characters for the given statistic, starting from the indicated point in the leaderboard */
@@ -2910,9 +2466,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterLeaderboard(FServerGetCharacte
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2926,22 +2480,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterLeaderboard(FServerGetCharacte
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterType.IsEmpty() || request.CharacterType == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterType"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterType"), request.CharacterType);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    OutRestJsonObj->SetNumberField(TEXT("StartPosition"), request.StartPosition);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterType"), request.CharacterType);
+    RequestWriter.WriteNumber(TEXT("MaxResultsCount"), request.MaxResultsCount);
+    RequestWriter.WriteNumber(TEXT("StartPosition"), request.StartPosition);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2959,7 +2506,7 @@ void UPlayFabServerAPI::HelperGetCharacterLeaderboard(FPlayFabBaseModel response
         FServerGetCharacterLeaderboardResult ResultStruct = UPlayFabServerModelDecoder::decodeGetCharacterLeaderboardResultResponse(response.responseData);
         OnSuccessGetCharacterLeaderboard.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetCharacterLeaderboard.Unbind();
 }
 
 /** Retrieves the details of all title-specific statistics for the specific character */
@@ -2969,9 +2516,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterStatistics(FServerGetCharacter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2985,20 +2530,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterStatistics(FServerGetCharacter
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3016,7 +2554,7 @@ void UPlayFabServerAPI::HelperGetCharacterStatistics(FPlayFabBaseModel response,
         FServerGetCharacterStatisticsResult ResultStruct = UPlayFabServerModelDecoder::decodeGetCharacterStatisticsResultResponse(response.responseData);
         OnSuccessGetCharacterStatistics.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetCharacterStatistics.Unbind();
 }
 
 /** Retrieves a list of ranked characters for the given statistic, centered on the requested user */
@@ -3026,9 +2564,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetLeaderboardAroundCharacter(FServerGetLe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3042,31 +2578,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetLeaderboardAroundCharacter(FServerGetLe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CharacterType.IsEmpty() || request.CharacterType == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterType"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterType"), request.CharacterType);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterType"), request.CharacterType);
+    RequestWriter.WriteNumber(TEXT("MaxResultsCount"), request.MaxResultsCount);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3084,7 +2605,7 @@ void UPlayFabServerAPI::HelperGetLeaderboardAroundCharacter(FPlayFabBaseModel re
         FServerGetLeaderboardAroundCharacterResult ResultStruct = UPlayFabServerModelDecoder::decodeGetLeaderboardAroundCharacterResultResponse(response.responseData);
         OnSuccessGetLeaderboardAroundCharacter.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetLeaderboardAroundCharacter.Unbind();
 }
 
 /** Retrieves a list of all of the user's characters for the given statistic. */
@@ -3094,9 +2615,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetLeaderboardForUserCharacters(FServerGet
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3110,21 +2629,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetLeaderboardForUserCharacters(FServerGet
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("MaxResultsCount"), request.MaxResultsCount);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3142,7 +2654,7 @@ void UPlayFabServerAPI::HelperGetLeaderboardForUserCharacters(FPlayFabBaseModel
         FServerGetLeaderboardForUsersCharactersResult ResultStruct = UPlayFabServerModelDecoder::decodeGetLeaderboardForUsersCharactersResultResponse(response.responseData);
         OnSuccessGetLeaderboardForUserCharacters.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetLeaderboardForUserCharacters.Unbind();
 }
 
 /** Grants the specified character type to the user. CharacterIds are not globally unique; characterId must be evaluated with the parent PlayFabId to guarantee uniqueness. */
@@ -3152,9 +2664,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GrantCharacterToUser(FServerGrantCharacter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3168,26 +2678,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GrantCharacterToUser(FServerGrantCharacter
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterName.IsEmpty() || request.CharacterName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterName"), request.CharacterName);
-    }
-    if (request.CharacterType.IsEmpty() || request.CharacterType == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterType"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterType"), request.CharacterType);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterName"), request.CharacterName);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterType"), request.CharacterType);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3205,7 +2704,7 @@ void UPlayFabServerAPI::HelperGrantCharacterToUser(FPlayFabBaseModel response, U
         FServerGrantCharacterToUserResult ResultStruct = UPlayFabServerModelDecoder::decodeGrantCharacterToUserResultResponse(response.responseData);
         OnSuccessGrantCharacterToUser.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGrantCharacterToUser.Unbind();
 }
 
 /** Updates the values of the specified title-specific statistics for the specific character */
@@ -3215,9 +2714,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateCharacterStatistics(FServerUpdateCha
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3231,22 +2728,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateCharacterStatistics(FServerUpdateCha
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CharacterStatistics != nullptr) OutRestJsonObj->SetObjectField(TEXT("CharacterStatistics"), request.CharacterStatistics);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteObject(TEXT("CharacterStatistics"), request.CharacterStatistics);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3264,7 +2754,7 @@ void UPlayFabServerAPI::HelperUpdateCharacterStatistics(FPlayFabBaseModel respon
         FServerUpdateCharacterStatisticsResult ResultStruct = UPlayFabServerModelDecoder::decodeUpdateCharacterStatisticsResultResponse(response.responseData);
         OnSuccessUpdateCharacterStatistics.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateCharacterStatistics.Unbind();
 }
 
 
@@ -3278,9 +2768,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetContentDownloadUrl(FServerGetContentDow
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3294,21 +2782,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetContentDownloadUrl(FServerGetContentDow
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.HttpMethod.IsEmpty() || request.HttpMethod == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("HttpMethod"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("HttpMethod"), request.HttpMethod);
-    }
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ThruCDN"), request.ThruCDN);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("HttpMethod"), request.HttpMethod);
+    RequestWriter.WriteStringOrNull(TEXT("Key"), request.Key);
+    RequestWriter.WriteBool(TEXT("ThruCDN"), request.ThruCDN);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3326,7 +2807,7 @@ void UPlayFabServerAPI::HelperGetContentDownloadUrl(FPlayFabBaseModel response,
         FServerGetContentDownloadUrlResult ResultStruct = UPlayFabServerModelDecoder::decodeGetContentDownloadUrlResultResponse(response.responseData);
         OnSuccessGetContentDownloadUrl.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetContentDownloadUrl.Unbind();
 }
 
 
@@ -3340,9 +2821,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddFriend(FServerAddFriendRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3356,35 +2835,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddFriend(FServerAddFriendRequest request,
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.FriendEmail.IsEmpty() || request.FriendEmail == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendEmail"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendEmail"), request.FriendEmail);
-    }
-    if (request.FriendPlayFabId.IsEmpty() || request.FriendPlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendPlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
-    }
-    if (request.FriendTitleDisplayName.IsEmpty() || request.FriendTitleDisplayName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendTitleDisplayName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendTitleDisplayName"), request.FriendTitleDisplayName);
-    }
-    if (request.FriendUsername.IsEmpty() || request.FriendUsername == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendUsername"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendUsername"), request.FriendUsername);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("FriendEmail"), request.FriendEmail);
+    RequestWriter.WriteStringOrNull(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("FriendTitleDisplayName"), request.FriendTitleDisplayName);
+    RequestWriter.WriteStringOrNull(TEXT("FriendUsername"), request.FriendUsername);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3400,10 +2860,10 @@ void UPlayFabServerAPI::HelperAddFriend(FPlayFabBaseModel response, UObject* cus
     else if (!error.hasError && OnSuccessAddFriend.IsBound())
     {
         FServerEmptyResponse ResultStruct = UPlayFabServerModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessAddFriend.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddFriend.Unbind();
 }
 
 /** Retrieves the current friends for the user with PlayFabId, constrained to users who have PlayFab accounts. Friends from linked accounts (Facebook, Steam) are also included. You may optionally exclude some linked services' friends. */
@@ -3413,9 +2873,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetFriendsList(FServerGetFriendsListReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3429,24 +2887,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetFriendsList(FServerGetFriendsListReques
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeFacebookFriends"), request.IncludeFacebookFriends);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeSteamFriends"), request.IncludeSteamFriends);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-    if (request.XboxToken.IsEmpty() || request.XboxToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("XboxToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("XboxToken"), request.XboxToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("IncludeFacebookFriends"), request.IncludeFacebookFriends);
+    RequestWriter.WriteBool(TEXT("IncludeSteamFriends"), request.IncludeSteamFriends);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteObject(TEXT("ProfileConstraints"), request.ProfileConstraints);
+    RequestWriter.WriteStringOrNull(TEXT("XboxToken"), request.XboxToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3464,7 +2915,7 @@ void UPlayFabServerAPI::HelperGetFriendsList(FPlayFabBaseModel response, UObject
         FServerGetFriendsListResult ResultStruct = UPlayFabServerModelDecoder::decodeGetFriendsListResultResponse(response.responseData);
         OnSuccessGetFriendsList.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetFriendsList.Unbind();
 }
 
 /** Removes the specified friend from the the user's friend list */
@@ -3474,9 +2925,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::RemoveFriend(FServerRemoveFriendRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3490,20 +2939,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::RemoveFriend(FServerRemoveFriendRequest re
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.FriendPlayFabId.IsEmpty() || request.FriendPlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendPlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3519,10 +2961,10 @@ void UPlayFabServerAPI::HelperRemoveFriend(FPlayFabBaseModel response, UObject*
     else if (!error.hasError && OnSuccessRemoveFriend.IsBound())
     {
         FServerEmptyResponse ResultStruct = UPlayFabServerModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessRemoveFriend.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRemoveFriend.Unbind();
 }
 
 /** Updates the tag list for a specified user in the friend list of another user */
@@ -3532,9 +2974,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetFriendTags(FServerSetFriendTagsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3548,28 +2988,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetFriendTags(FServerSetFriendTagsRequest
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.FriendPlayFabId.IsEmpty() || request.FriendPlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendPlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.Tags.IsEmpty() || request.Tags == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Tags"));
-    } else {
-        TArray<FString> TagsArray;
-        FString(request.Tags).ParseIntoArray(TagsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Tags"), TagsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringArray(TEXT("Tags"), request.Tags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3585,10 +3011,10 @@ void UPlayFabServerAPI::HelperSetFriendTags(FPlayFabBaseModel response, UObject*
     else if (!error.hasError && OnSuccessSetFriendTags.IsBound())
     {
         FServerEmptyResponse ResultStruct = UPlayFabServerModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessSetFriendTags.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetFriendTags.Unbind();
 }
 
 
@@ -3602,9 +3028,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::DeregisterGame(FServerDeregisterGameReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3618,16 +3042,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::DeregisterGame(FServerDeregisterGameReques
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("LobbyId"), request.LobbyId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3645,7 +3066,7 @@ void UPlayFabServerAPI::HelperDeregisterGame(FPlayFabBaseModel response, UObject
         FServerDeregisterGameResponse ResultStruct = UPlayFabServerModelDecoder::decodeDeregisterGameResponseResponse(response.responseData);
         OnSuccessDeregisterGame.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeregisterGame.Unbind();
 }
 
 /** Informs the PlayFab match-making service that the user specified has left the Game Server Instance */
@@ -3655,9 +3076,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::NotifyMatchmakerPlayerLeft(FServerNotifyMa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3671,21 +3090,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::NotifyMatchmakerPlayerLeft(FServerNotifyMa
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("LobbyId"), request.LobbyId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3703,7 +3115,7 @@ void UPlayFabServerAPI::HelperNotifyMatchmakerPlayerLeft(FPlayFabBaseModel respo
         FServerNotifyMatchmakerPlayerLeftResult ResultStruct = UPlayFabServerModelDecoder::decodeNotifyMatchmakerPlayerLeftResultResponse(response.responseData);
         OnSuccessNotifyMatchmakerPlayerLeft.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessNotifyMatchmakerPlayerLeft.Unbind();
 }
 
 /** Validates a Game Server session ticket and returns details about the user */
@@ -3713,9 +3125,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::RedeemMatchmakerTicket(FServerRedeemMatchm
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3729,21 +3139,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::RedeemMatchmakerTicket(FServerRedeemMatchm
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
-    if (request.Ticket.IsEmpty() || request.Ticket == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Ticket"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Ticket"), request.Ticket);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("LobbyId"), request.LobbyId);
+    RequestWriter.WriteStringOrNull(TEXT("Ticket"), request.Ticket);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3761,7 +3164,7 @@ void UPlayFabServerAPI::HelperRedeemMatchmakerTicket(FPlayFabBaseModel response,
         FServerRedeemMatchmakerTicketResult ResultStruct = UPlayFabServerModelDecoder::decodeRedeemMatchmakerTicketResultResponse(response.responseData);
         OnSuccessRedeemMatchmakerTicket.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRedeemMatchmakerTicket.Unbind();
 }
 
 /** Set the state of the indicated Game Server Instance. Also update the heartbeat for the instance. */
@@ -3771,9 +3174,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::RefreshGameServerInstanceHeartbeat(FServer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3787,15 +3188,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::RefreshGameServerInstanceHeartbeat(FServer
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("LobbyId"), request.LobbyId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3813,7 +3211,7 @@ void UPlayFabServerAPI::HelperRefreshGameServerInstanceHeartbeat(FPlayFabBaseMod
         FServerRefreshGameServerInstanceHeartbeatResult ResultStruct = UPlayFabServerModelDecoder::decodeRefreshGameServerInstanceHeartbeatResultResponse(response.responseData);
         OnSuccessRefreshGameServerInstanceHeartbeat.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRefreshGameServerInstanceHeartbeat.Unbind();
 }
 
 /** Inform the matchmaker that a new Game Server Instance is added. */
@@ -3823,9 +3221,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::RegisterGame(FServerRegisterGameRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3839,50 +3235,23 @@ UPlayFabServerAPI* UPlayFabServerAPI::RegisterGame(FServerRegisterGameRequest re
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Build.IsEmpty() || request.Build == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Build"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Build"), request.Build);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.GameMode.IsEmpty() || request.GameMode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameMode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameMode"), request.GameMode);
-    }
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Build"), request.Build);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("GameMode"), request.GameMode);
+    RequestWriter.WriteStringOrNull(TEXT("LobbyId"), request.LobbyId);
     FString temp_Region;
     if (GetEnumValueToString<ERegion>(TEXT("ERegion"), request.Region, temp_Region))
-        OutRestJsonObj->SetStringField(TEXT("Region"), temp_Region);
-    if (request.ServerIPV4Address.IsEmpty() || request.ServerIPV4Address == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ServerIPV4Address"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ServerIPV4Address"), request.ServerIPV4Address);
-    }
-    if (request.ServerIPV6Address.IsEmpty() || request.ServerIPV6Address == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ServerIPV6Address"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ServerIPV6Address"), request.ServerIPV6Address);
-    }
-    if (request.ServerPort.IsEmpty() || request.ServerPort == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ServerPort"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ServerPort"), request.ServerPort);
-    }
-    if (request.ServerPublicDNSName.IsEmpty() || request.ServerPublicDNSName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ServerPublicDNSName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ServerPublicDNSName"), request.ServerPublicDNSName);
-    }
-    if (request.Tags != nullptr) OutRestJsonObj->SetObjectField(TEXT("Tags"), request.Tags);
+        RequestWriter.WriteString(TEXT("Region"), temp_Region);
+    RequestWriter.WriteStringOrNull(TEXT("ServerIPV4Address"), request.ServerIPV4Address);
+    RequestWriter.WriteStringOrNull(TEXT("ServerIPV6Address"), request.ServerIPV6Address);
+    RequestWriter.WriteStringOrNull(TEXT("ServerPort"), request.ServerPort);
+    RequestWriter.WriteStringOrNull(TEXT("ServerPublicDNSName"), request.ServerPublicDNSName);
+    RequestWriter.WriteObject(TEXT("Tags"), request.Tags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3900,7 +3269,7 @@ void UPlayFabServerAPI::HelperRegisterGame(FPlayFabBaseModel response, UObject*
         FServerRegisterGameResponse ResultStruct = UPlayFabServerModelDecoder::decodeRegisterGameResponseResponse(response.responseData);
         OnSuccessRegisterGame.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRegisterGame.Unbind();
 }
 
 /** Sets the custom data of the indicated Game Server Instance */
@@ -3910,9 +3279,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetGameServerInstanceData(FServerSetGameSe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3926,20 +3293,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetGameServerInstanceData(FServerSetGameSe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.GameServerData.IsEmpty() || request.GameServerData == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameServerData"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameServerData"), request.GameServerData);
-    }
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("GameServerData"), request.GameServerData);
+    RequestWriter.WriteStringOrNull(TEXT("LobbyId"), request.LobbyId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3957,7 +3317,7 @@ void UPlayFabServerAPI::HelperSetGameServerInstanceData(FPlayFabBaseModel respon
         FServerSetGameServerInstanceDataResult ResultStruct = UPlayFabServerModelDecoder::decodeSetGameServerInstanceDataResultResponse(response.responseData);
         OnSuccessSetGameServerInstanceData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetGameServerInstanceData.Unbind();
 }
 
 /** Set the state of the indicated Game Server Instance. */
@@ -3967,9 +3327,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetGameServerInstanceState(FServerSetGameS
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3983,18 +3341,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetGameServerInstanceState(FServerSetGameS
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("LobbyId"), request.LobbyId);
     FString temp_State;
     if (GetEnumValueToString<EGameInstanceState>(TEXT("EGameInstanceState"), request.State, temp_State))
-        OutRestJsonObj->SetStringField(TEXT("State"), temp_State);
+        RequestWriter.WriteString(TEXT("State"), temp_State);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4012,7 +3367,7 @@ void UPlayFabServerAPI::HelperSetGameServerInstanceState(FPlayFabBaseModel respo
         FServerSetGameServerInstanceStateResult ResultStruct = UPlayFabServerModelDecoder::decodeSetGameServerInstanceStateResultResponse(response.responseData);
         OnSuccessSetGameServerInstanceState.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetGameServerInstanceState.Unbind();
 }
 
 /** Set custom tags for the specified Game Server Instance */
@@ -4022,9 +3377,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetGameServerInstanceTags(FServerSetGameSe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4038,16 +3391,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetGameServerInstanceTags(FServerSetGameSe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
-    if (request.Tags != nullptr) OutRestJsonObj->SetObjectField(TEXT("Tags"), request.Tags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("LobbyId"), request.LobbyId);
+    RequestWriter.WriteObject(TEXT("Tags"), request.Tags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4065,7 +3415,7 @@ void UPlayFabServerAPI::HelperSetGameServerInstanceTags(FPlayFabBaseModel respon
         FServerSetGameServerInstanceTagsResult ResultStruct = UPlayFabServerModelDecoder::decodeSetGameServerInstanceTagsResultResponse(response.responseData);
         OnSuccessSetGameServerInstanceTags.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetGameServerInstanceTags.Unbind();
 }
 
 
@@ -4079,9 +3429,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::AwardSteamAchievement(FServerAwardSteamAch
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4095,15 +3443,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::AwardSteamAchievement(FServerAwardSteamAch
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Achievements.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Achievements"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Achievements"), request.Achievements);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObjectArray(TEXT("Achievements"), request.Achievements);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4121,7 +3466,7 @@ void UPlayFabServerAPI::HelperAwardSteamAchievement(FPlayFabBaseModel response,
         FServerAwardSteamAchievementResult ResultStruct = UPlayFabServerModelDecoder::decodeAwardSteamAchievementResultResponse(response.responseData);
         OnSuccessAwardSteamAchievement.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAwardSteamAchievement.Unbind();
 }
 
 
@@ -4135,9 +3480,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetFriendLeaderboard(FServerGetFriendLeade
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4151,33 +3494,22 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetFriendLeaderboard(FServerGetFriendLeade
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeFacebookFriends"), request.IncludeFacebookFriends);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeSteamFriends"), request.IncludeSteamFriends);
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-    OutRestJsonObj->SetNumberField(TEXT("StartPosition"), request.StartPosition);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
-    if (request.XboxToken.IsEmpty() || request.XboxToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("XboxToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("XboxToken"), request.XboxToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("IncludeFacebookFriends"), request.IncludeFacebookFriends);
+    RequestWriter.WriteBool(TEXT("IncludeSteamFriends"), request.IncludeSteamFriends);
+    RequestWriter.WriteNumber(TEXT("MaxResultsCount"), request.MaxResultsCount);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteObject(TEXT("ProfileConstraints"), request.ProfileConstraints);
+    RequestWriter.WriteNumber(TEXT("StartPosition"), request.StartPosition);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
+    RequestWriter.WriteBool(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
+    RequestWriter.WriteNumber(TEXT("Version"), request.Version);
+    RequestWriter.WriteStringOrNull(TEXT("XboxToken"), request.XboxToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4195,7 +3527,7 @@ void UPlayFabServerAPI::HelperGetFriendLeaderboard(FPlayFabBaseModel response, U
         FServerGetLeaderboardResult ResultStruct = UPlayFabServerModelDecoder::decodeGetLeaderboardResultResponse(response.responseData);
         OnSuccessGetFriendLeaderboard.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetFriendLeaderboard.Unbind();
 }
 
 /** Retrieves a list of ranked users for the given statistic, starting from the indicated point in the leaderboard */
@@ -4205,9 +3537,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetLeaderboard(FServerGetLeaderboardReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4221,21 +3551,18 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetLeaderboard(FServerGetLeaderboardReques
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-    OutRestJsonObj->SetNumberField(TEXT("StartPosition"), request.StartPosition);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("MaxResultsCount"), request.MaxResultsCount);
+    RequestWriter.WriteObject(TEXT("ProfileConstraints"), request.ProfileConstraints);
+    RequestWriter.WriteNumber(TEXT("StartPosition"), request.StartPosition);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
+    RequestWriter.WriteBool(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
+    RequestWriter.WriteNumber(TEXT("Version"), request.Version);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4251,10 +3578,10 @@ void UPlayFabServerAPI::HelperGetLeaderboard(FPlayFabBaseModel response, UObject
     else if (!error.hasError && OnSuccessGetLeaderboard.IsBound())
     {
         FServerGetLeaderboardResult ResultStruct = UPlayFabServerModelDecoder::decodeGetLeaderboardResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetLeaderboard.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetLeaderboard.Unbind();
 }
 
 /** Retrieves a list of ranked users for the given statistic, centered on the currently signed-in user */
@@ -4264,9 +3591,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetLeaderboardAroundUser(FServerGetLeaderb
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4280,25 +3605,18 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetLeaderboardAroundUser(FServerGetLeaderb
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("MaxResultsCount"), request.MaxResultsCount);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteObject(TEXT("ProfileConstraints"), request.ProfileConstraints);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
+    RequestWriter.WriteBool(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
+    RequestWriter.WriteNumber(TEXT("Version"), request.Version);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4316,7 +3634,7 @@ void UPlayFabServerAPI::HelperGetLeaderboardAroundUser(FPlayFabBaseModel respons
         FServerGetLeaderboardAroundUserResult ResultStruct = UPlayFabServerModelDecoder::decodeGetLeaderboardAroundUserResultResponse(response.responseData);
         OnSuccessGetLeaderboardAroundUser.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetLeaderboardAroundUser.Unbind();
 }
 
 /** Returns whatever info is requested in the response for the user. Note that PII (like email address, facebook id) may be returned. All parameters default to false. */
@@ -4326,9 +3644,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerCombinedInfo(FServerGetPlayerComb
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4342,17 +3658,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerCombinedInfo(FServerGetPlayerComb
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4370,7 +3683,7 @@ void UPlayFabServerAPI::HelperGetPlayerCombinedInfo(FPlayFabBaseModel response,
         FServerGetPlayerCombinedInfoResult ResultStruct = UPlayFabServerModelDecoder::decodeGetPlayerCombinedInfoResultResponse(response.responseData);
         OnSuccessGetPlayerCombinedInfo.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerCombinedInfo.Unbind();
 }
 
 /** Retrieves the current version and values for the indicated statistics, for the local player. */
@@ -4380,9 +3693,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerStatistics(FServerGetPlayerStatis
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4396,29 +3707,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerStatistics(FServerGetPlayerStatis
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.StatisticNames.IsEmpty() || request.StatisticNames == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticNames"));
-    } else {
-        TArray<FString> StatisticNamesArray;
-        FString(request.StatisticNames).ParseIntoArray(StatisticNamesArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("StatisticNames"), StatisticNamesArray);
-    }
-    if (request.StatisticNameVersions.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticNameVersions"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("StatisticNameVersions"), request.StatisticNameVersions);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringArray(TEXT("StatisticNames"), request.StatisticNames);
+    RequestWriter.WriteObjectArray(TEXT("StatisticNameVersions"), request.StatisticNameVersions);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4436,7 +3733,7 @@ void UPlayFabServerAPI::HelperGetPlayerStatistics(FPlayFabBaseModel response, UO
         FServerGetPlayerStatisticsResult ResultStruct = UPlayFabServerModelDecoder::decodeGetPlayerStatisticsResultResponse(response.responseData);
         OnSuccessGetPlayerStatistics.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerStatistics.Unbind();
 }
 
 /** Retrieves the information on the available versions of the specified statistic. */
@@ -4446,9 +3743,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerStatisticVersions(FServerGetPlaye
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4462,16 +3757,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerStatisticVersions(FServerGetPlaye
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4489,7 +3781,7 @@ void UPlayFabServerAPI::HelperGetPlayerStatisticVersions(FPlayFabBaseModel respo
         FServerGetPlayerStatisticVersionsResult ResultStruct = UPlayFabServerModelDecoder::decodeGetPlayerStatisticVersionsResultResponse(response.responseData);
         OnSuccessGetPlayerStatisticVersions.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerStatisticVersions.Unbind();
 }
 
 /** Retrieves the title-specific custom data for the user which is readable and writable by the client */
@@ -4499,9 +3791,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserData(FServerGetUserDataRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4515,24 +3805,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserData(FServerGetUserDataRequest requ
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4550,7 +3830,7 @@ void UPlayFabServerAPI::HelperGetUserData(FPlayFabBaseModel response, UObject* c
         FServerGetUserDataResult ResultStruct = UPlayFabServerModelDecoder::decodeGetUserDataResultResponse(response.responseData);
         OnSuccessGetUserData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserData.Unbind();
 }
 
 /** Retrieves the title-specific custom data for the user which cannot be accessed by the client */
@@ -4560,9 +3840,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserInternalData(FServerGetUserDataRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4576,24 +3854,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserInternalData(FServerGetUserDataRequ
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4609,10 +3877,10 @@ void UPlayFabServerAPI::HelperGetUserInternalData(FPlayFabBaseModel response, UO
     else if (!error.hasError && OnSuccessGetUserInternalData.IsBound())
     {
         FServerGetUserDataResult ResultStruct = UPlayFabServerModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetUserInternalData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserInternalData.Unbind();
 }
 
 /** Retrieves the publisher-specific custom data for the user which is readable and writable by the client */
@@ -4622,9 +3890,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserPublisherData(FServerGetUserDataReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4638,24 +3904,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserPublisherData(FServerGetUserDataReq
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4671,10 +3927,10 @@ void UPlayFabServerAPI::HelperGetUserPublisherData(FPlayFabBaseModel response, U
     else if (!error.hasError && OnSuccessGetUserPublisherData.IsBound())
     {
         FServerGetUserDataResult ResultStruct = UPlayFabServerModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetUserPublisherData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserPublisherData.Unbind();
 }
 
 /** Retrieves the publisher-specific custom data for the user which cannot be accessed by the client */
@@ -4684,9 +3940,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserPublisherInternalData(FServerGetUse
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4700,24 +3954,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserPublisherInternalData(FServerGetUse
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4733,10 +3977,10 @@ void UPlayFabServerAPI::HelperGetUserPublisherInternalData(FPlayFabBaseModel res
     else if (!error.hasError && OnSuccessGetUserPublisherInternalData.IsBound())
     {
         FServerGetUserDataResult ResultStruct = UPlayFabServerModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetUserPublisherInternalData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserPublisherInternalData.Unbind();
 }
 
 /** Retrieves the publisher-specific custom data for the user which can only be read by the client */
@@ -4746,9 +3990,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserPublisherReadOnlyData(FServerGetUse
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4762,24 +4004,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserPublisherReadOnlyData(FServerGetUse
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4795,10 +4027,10 @@ void UPlayFabServerAPI::HelperGetUserPublisherReadOnlyData(FPlayFabBaseModel res
     else if (!error.hasError && OnSuccessGetUserPublisherReadOnlyData.IsBound())
     {
         FServerGetUserDataResult ResultStruct = UPlayFabServerModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetUserPublisherReadOnlyData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserPublisherReadOnlyData.Unbind();
 }
 
 /** Retrieves the title-specific custom data for the user which can only be read by the client */
@@ -4808,9 +4040,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserReadOnlyData(FServerGetUserDataRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4824,24 +4054,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserReadOnlyData(FServerGetUserDataRequ
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4857,10 +4077,10 @@ void UPlayFabServerAPI::HelperGetUserReadOnlyData(FPlayFabBaseModel response, UO
     else if (!error.hasError && OnSuccessGetUserReadOnlyData.IsBound())
     {
         FServerGetUserDataResult ResultStruct = UPlayFabServerModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetUserReadOnlyData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserReadOnlyData.Unbind();
 }
 
 /** Updates the values of the specified title-specific statistics for the user */
@@ -4870,9 +4090,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdatePlayerStatistics(FServerUpdatePlayer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4886,22 +4104,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdatePlayerStatistics(FServerUpdatePlayer
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("ForceUpdate"), request.ForceUpdate);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Statistics.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Statistics"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Statistics"), request.Statistics);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("ForceUpdate"), request.ForceUpdate);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteObjectArray(TEXT("Statistics"), request.Statistics);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4919,7 +4130,7 @@ void UPlayFabServerAPI::HelperUpdatePlayerStatistics(FPlayFabBaseModel response,
         FServerUpdatePlayerStatisticsResult ResultStruct = UPlayFabServerModelDecoder::decodeUpdatePlayerStatisticsResultResponse(response.responseData);
         OnSuccessUpdatePlayerStatistics.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdatePlayerStatistics.Unbind();
 }
 
 /** Updates the title-specific custom data for the user which is readable and writable by the client */
@@ -4929,9 +4140,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserData(FServerUpdateUserDataReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4945,28 +4154,18 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserData(FServerUpdateUserDataReques
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
     FString temp_Permission;
     if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+        RequestWriter.WriteString(TEXT("Permission"), temp_Permission);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4984,7 +4183,7 @@ void UPlayFabServerAPI::HelperUpdateUserData(FPlayFabBaseModel response, UObject
         FServerUpdateUserDataResult ResultStruct = UPlayFabServerModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
         OnSuccessUpdateUserData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateUserData.Unbind();
 }
 
 /** Updates the title-specific custom data for the user which cannot be accessed by the client */
@@ -4994,9 +4193,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserInternalData(FServerUpdateUserIn
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5010,25 +4207,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserInternalData(FServerUpdateUserIn
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5044,10 +4231,10 @@ void UPlayFabServerAPI::HelperUpdateUserInternalData(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessUpdateUserInternalData.IsBound())
     {
         FServerUpdateUserDataResult ResultStruct = UPlayFabServerModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateUserInternalData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateUserInternalData.Unbind();
 }
 
 /** Updates the publisher-specific custom data for the user which is readable and writable by the client */
@@ -5057,9 +4244,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserPublisherData(FServerUpdateUserD
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5073,28 +4258,18 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserPublisherData(FServerUpdateUserD
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
     FString temp_Permission;
     if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+        RequestWriter.WriteString(TEXT("Permission"), temp_Permission);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5110,10 +4285,10 @@ void UPlayFabServerAPI::HelperUpdateUserPublisherData(FPlayFabBaseModel response
     else if (!error.hasError && OnSuccessUpdateUserPublisherData.IsBound())
     {
         FServerUpdateUserDataResult ResultStruct = UPlayFabServerModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateUserPublisherData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateUserPublisherData.Unbind();
 }
 
 /** Updates the publisher-specific custom data for the user which cannot be accessed by the client */
@@ -5123,9 +4298,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserPublisherInternalData(FServerUpd
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5139,25 +4312,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserPublisherInternalData(FServerUpd
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5173,10 +4336,10 @@ void UPlayFabServerAPI::HelperUpdateUserPublisherInternalData(FPlayFabBaseModel
     else if (!error.hasError && OnSuccessUpdateUserPublisherInternalData.IsBound())
     {
         FServerUpdateUserDataResult ResultStruct = UPlayFabServerModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateUserPublisherInternalData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateUserPublisherInternalData.Unbind();
 }
 
 /** Updates the publisher-specific custom data for the user which can only be read by the client */
@@ -5186,9 +4349,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserPublisherReadOnlyData(FServerUpd
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5202,28 +4363,18 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserPublisherReadOnlyData(FServerUpd
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
     FString temp_Permission;
     if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+        RequestWriter.WriteString(TEXT("Permission"), temp_Permission);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5239,10 +4390,10 @@ void UPlayFabServerAPI::HelperUpdateUserPublisherReadOnlyData(FPlayFabBaseModel
     else if (!error.hasError && OnSuccessUpdateUserPublisherReadOnlyData.IsBound())
     {
         FServerUpdateUserDataResult ResultStruct = UPlayFabServerModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateUserPublisherReadOnlyData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateUserPublisherReadOnlyData.Unbind();
 }
 
 /** Updates the title-specific custom data for the user which can only be read by the client */
@@ -5252,9 +4403,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserReadOnlyData(FServerUpdateUserDa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5268,28 +4417,18 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserReadOnlyData(FServerUpdateUserDa
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
     FString temp_Permission;
     if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+        RequestWriter.WriteString(TEXT("Permission"), temp_Permission);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5305,10 +4444,10 @@ void UPlayFabServerAPI::HelperUpdateUserReadOnlyData(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessUpdateUserReadOnlyData.IsBound())
     {
         FServerUpdateUserDataResult ResultStruct = UPlayFabServerModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateUserReadOnlyData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateUserReadOnlyData.Unbind();
 }
 
 
@@ -5322,9 +4461,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddCharacterVirtualCurrency(FServerAddChar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5338,27 +4475,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddCharacterVirtualCurrency(FServerAddChar
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("Amount"), request.Amount);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("VirtualCurrency"), request.VirtualCurrency);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5376,7 +4502,7 @@ void UPlayFabServerAPI::HelperAddCharacterVirtualCurrency(FPlayFabBaseModel resp
         FServerModifyCharacterVirtualCurrencyResult ResultStruct = UPlayFabServerModelDecoder::decodeModifyCharacterVirtualCurrencyResultResponse(response.responseData);
         OnSuccessAddCharacterVirtualCurrency.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddCharacterVirtualCurrency.Unbind();
 }
 
 /** Increments the user's balance of the specified virtual currency by the stated amount */
@@ -5386,9 +4512,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddUserVirtualCurrency(FServerAddUserVirtu
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5402,22 +4526,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddUserVirtualCurrency(FServerAddUserVirtu
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("Amount"), request.Amount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("VirtualCurrency"), request.VirtualCurrency);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5435,7 +4552,7 @@ void UPlayFabServerAPI::HelperAddUserVirtualCurrency(FPlayFabBaseModel response,
         FServerModifyUserVirtualCurrencyResult ResultStruct = UPlayFabServerModelDecoder::decodeModifyUserVirtualCurrencyResultResponse(response.responseData);
         OnSuccessAddUserVirtualCurrency.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddUserVirtualCurrency.Unbind();
 }
 
 /** Consume uses of a consumable item. When all uses are consumed, it will be removed from the player's inventory. */
@@ -5445,9 +4562,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::ConsumeItem(FServerConsumeItemRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5461,27 +4576,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::ConsumeItem(FServerConsumeItemRequest requ
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("ConsumeCount"), request.ConsumeCount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteNumber(TEXT("ConsumeCount"), request.ConsumeCount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ItemInstanceId"), request.ItemInstanceId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5499,7 +4603,7 @@ void UPlayFabServerAPI::HelperConsumeItem(FPlayFabBaseModel response, UObject* c
         FServerConsumeItemResult ResultStruct = UPlayFabServerModelDecoder::decodeConsumeItemResultResponse(response.responseData);
         OnSuccessConsumeItem.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessConsumeItem.Unbind();
 }
 
 /** Returns the result of an evaluation of a Random Result Table - the ItemId from the game Catalog which would have been added to the player inventory, if the Random Result Table were added via a Bundle or a call to UnlockContainer. */
@@ -5509,9 +4613,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::EvaluateRandomResultTable(FServerEvaluateR
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5525,20 +4627,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::EvaluateRandomResultTable(FServerEvaluateR
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.TableId.IsEmpty() || request.TableId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TableId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TableId"), request.TableId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("TableId"), request.TableId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5556,7 +4651,7 @@ void UPlayFabServerAPI::HelperEvaluateRandomResultTable(FPlayFabBaseModel respon
         FServerEvaluateRandomResultTableResult ResultStruct = UPlayFabServerModelDecoder::decodeEvaluateRandomResultTableResultResponse(response.responseData);
         OnSuccessEvaluateRandomResultTable.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessEvaluateRandomResultTable.Unbind();
 }
 
 /** Retrieves the specified character's current inventory of virtual goods */
@@ -5566,9 +4661,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterInventory(FServerGetCharacterI
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5582,26 +4675,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterInventory(FServerGetCharacterI
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5619,7 +4701,7 @@ void UPlayFabServerAPI::HelperGetCharacterInventory(FPlayFabBaseModel response,
         FServerGetCharacterInventoryResult ResultStruct = UPlayFabServerModelDecoder::decodeGetCharacterInventoryResultResponse(response.responseData);
         OnSuccessGetCharacterInventory.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetCharacterInventory.Unbind();
 }
 
 /** Retrieves the configuration information for the specified random results tables for the title, including all ItemId values and weights */
@@ -5629,9 +4711,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetRandomResultTables(FServerGetRandomResu
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5645,23 +4725,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetRandomResultTables(FServerGetRandomResu
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    // Check to see if string is empty
-    if (request.TableIDs.IsEmpty() || request.TableIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TableIDs"));
-    } else {
-        TArray<FString> TableIDsArray;
-        FString(request.TableIDs).ParseIntoArray(TableIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("TableIDs"), TableIDsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringArray(TEXT("TableIDs"), request.TableIDs);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5679,7 +4749,7 @@ void UPlayFabServerAPI::HelperGetRandomResultTables(FPlayFabBaseModel response,
         FServerGetRandomResultTablesResult ResultStruct = UPlayFabServerModelDecoder::decodeGetRandomResultTablesResultResponse(response.responseData);
         OnSuccessGetRandomResultTables.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetRandomResultTables.Unbind();
 }
 
 /** Retrieves the specified user's current inventory of virtual goods */
@@ -5689,9 +4759,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserInventory(FServerGetUserInventoryRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5705,16 +4773,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserInventory(FServerGetUserInventoryRe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5732,7 +4797,7 @@ void UPlayFabServerAPI::HelperGetUserInventory(FPlayFabBaseModel response, UObje
         FServerGetUserInventoryResult ResultStruct = UPlayFabServerModelDecoder::decodeGetUserInventoryResultResponse(response.responseData);
         OnSuccessGetUserInventory.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserInventory.Unbind();
 }
 
 /** Adds the specified items to the specified character's inventory */
@@ -5742,9 +4807,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GrantItemsToCharacter(FServerGrantItemsToC
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5758,39 +4821,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::GrantItemsToCharacter(FServerGrantItemsToC
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Annotation.IsEmpty() || request.Annotation == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Annotation"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Annotation"), request.Annotation);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    // Check to see if string is empty
-    if (request.ItemIds.IsEmpty() || request.ItemIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemIds"));
-    } else {
-        TArray<FString> ItemIdsArray;
-        FString(request.ItemIds).ParseIntoArray(ItemIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("ItemIds"), ItemIdsArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Annotation"), request.Annotation);
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringArray(TEXT("ItemIds"), request.ItemIds);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5808,7 +4849,7 @@ void UPlayFabServerAPI::HelperGrantItemsToCharacter(FPlayFabBaseModel response,
         FServerGrantItemsToCharacterResult ResultStruct = UPlayFabServerModelDecoder::decodeGrantItemsToCharacterResultResponse(response.responseData);
         OnSuccessGrantItemsToCharacter.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGrantItemsToCharacter.Unbind();
 }
 
 /** Adds the specified items to the specified user's inventory */
@@ -5818,9 +4859,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GrantItemsToUser(FServerGrantItemsToUserRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5834,34 +4873,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::GrantItemsToUser(FServerGrantItemsToUserRe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Annotation.IsEmpty() || request.Annotation == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Annotation"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Annotation"), request.Annotation);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    // Check to see if string is empty
-    if (request.ItemIds.IsEmpty() || request.ItemIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemIds"));
-    } else {
-        TArray<FString> ItemIdsArray;
-        FString(request.ItemIds).ParseIntoArray(ItemIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("ItemIds"), ItemIdsArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Annotation"), request.Annotation);
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringArray(TEXT("ItemIds"), request.ItemIds);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5879,7 +4900,7 @@ void UPlayFabServerAPI::HelperGrantItemsToUser(FPlayFabBaseModel response, UObje
         FServerGrantItemsToUserResult ResultStruct = UPlayFabServerModelDecoder::decodeGrantItemsToUserResultResponse(response.responseData);
         OnSuccessGrantItemsToUser.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGrantItemsToUser.Unbind();
 }
 
 /** Adds the specified items to the specified user inventories */
@@ -5889,9 +4910,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GrantItemsToUsers(FServerGrantItemsToUsers
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5905,21 +4924,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::GrantItemsToUsers(FServerGrantItemsToUsers
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ItemGrants.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemGrants"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("ItemGrants"), request.ItemGrants);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObjectArray(TEXT("ItemGrants"), request.ItemGrants);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5937,7 +4949,7 @@ void UPlayFabServerAPI::HelperGrantItemsToUsers(FPlayFabBaseModel response, UObj
         FServerGrantItemsToUsersResult ResultStruct = UPlayFabServerModelDecoder::decodeGrantItemsToUsersResultResponse(response.responseData);
         OnSuccessGrantItemsToUsers.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGrantItemsToUsers.Unbind();
 }
 
 /** Modifies the number of remaining uses of a player's inventory item */
@@ -5947,9 +4959,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::ModifyItemUses(FServerModifyItemUsesReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5963,22 +4973,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::ModifyItemUses(FServerModifyItemUsesReques
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("UsesToAdd"), request.UsesToAdd);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ItemInstanceId"), request.ItemInstanceId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteNumber(TEXT("UsesToAdd"), request.UsesToAdd);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5996,7 +4999,7 @@ void UPlayFabServerAPI::HelperModifyItemUses(FPlayFabBaseModel response, UObject
         FServerModifyItemUsesResult ResultStruct = UPlayFabServerModelDecoder::decodeModifyItemUsesResultResponse(response.responseData);
         OnSuccessModifyItemUses.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessModifyItemUses.Unbind();
 }
 
 /** Moves an item from a character's inventory into another of the users's character's inventory. */
@@ -6006,9 +5009,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::MoveItemToCharacterFromCharacter(FServerMo
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6022,30 +5023,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::MoveItemToCharacterFromCharacter(FServerMo
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.GivingCharacterId.IsEmpty() || request.GivingCharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GivingCharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GivingCharacterId"), request.GivingCharacterId);
-    }
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.ReceivingCharacterId.IsEmpty() || request.ReceivingCharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReceivingCharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReceivingCharacterId"), request.ReceivingCharacterId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("GivingCharacterId"), request.GivingCharacterId);
+    RequestWriter.WriteStringOrNull(TEXT("ItemInstanceId"), request.ItemInstanceId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("ReceivingCharacterId"), request.ReceivingCharacterId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6063,7 +5049,7 @@ void UPlayFabServerAPI::HelperMoveItemToCharacterFromCharacter(FPlayFabBaseModel
         FServerMoveItemToCharacterFromCharacterResult ResultStruct = UPlayFabServerModelDecoder::decodeMoveItemToCharacterFromCharacterResultResponse(response.responseData);
         OnSuccessMoveItemToCharacterFromCharacter.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessMoveItemToCharacterFromCharacter.Unbind();
 }
 
 /** Moves an item from a user's inventory into their character's inventory. */
@@ -6073,9 +5059,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::MoveItemToCharacterFromUser(FServerMoveIte
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6089,25 +5073,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::MoveItemToCharacterFromUser(FServerMoveIte
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteStringOrNull(TEXT("ItemInstanceId"), request.ItemInstanceId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6125,7 +5098,7 @@ void UPlayFabServerAPI::HelperMoveItemToCharacterFromUser(FPlayFabBaseModel resp
         FServerMoveItemToCharacterFromUserResult ResultStruct = UPlayFabServerModelDecoder::decodeMoveItemToCharacterFromUserResultResponse(response.responseData);
         OnSuccessMoveItemToCharacterFromUser.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessMoveItemToCharacterFromUser.Unbind();
 }
 
 /** Moves an item from a character's inventory into the owning user's inventory. */
@@ -6135,9 +5108,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::MoveItemToUserFromCharacter(FServerMoveIte
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6151,25 +5122,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::MoveItemToUserFromCharacter(FServerMoveIte
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteStringOrNull(TEXT("ItemInstanceId"), request.ItemInstanceId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6187,7 +5147,7 @@ void UPlayFabServerAPI::HelperMoveItemToUserFromCharacter(FPlayFabBaseModel resp
         FServerMoveItemToUserFromCharacterResult ResultStruct = UPlayFabServerModelDecoder::decodeMoveItemToUserFromCharacterResultResponse(response.responseData);
         OnSuccessMoveItemToUserFromCharacter.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessMoveItemToUserFromCharacter.Unbind();
 }
 
 /** Adds the virtual goods associated with the coupon to the user's inventory. Coupons can be generated via the Economy->Catalogs tab in the PlayFab Game Manager. */
@@ -6197,9 +5157,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::RedeemCoupon(FServerRedeemCouponRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6213,31 +5171,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::RedeemCoupon(FServerRedeemCouponRequest re
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CouponCode.IsEmpty() || request.CouponCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CouponCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CouponCode"), request.CouponCode);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteStringOrNull(TEXT("CouponCode"), request.CouponCode);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6255,7 +5198,7 @@ void UPlayFabServerAPI::HelperRedeemCoupon(FPlayFabBaseModel response, UObject*
         FServerRedeemCouponResult ResultStruct = UPlayFabServerModelDecoder::decodeRedeemCouponResultResponse(response.responseData);
         OnSuccessRedeemCoupon.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRedeemCoupon.Unbind();
 }
 
 /** Submit a report about a player (due to bad bahavior, etc.) on behalf of another player, so that customer service representatives for the title can take action concerning potentially toxic players. */
@@ -6265,9 +5208,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::ReportPlayer(FServerReportPlayerServerRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6281,26 +5222,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::ReportPlayer(FServerReportPlayerServerRequ
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Comment.IsEmpty() || request.Comment == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Comment"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Comment"), request.Comment);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ReporteeId.IsEmpty() || request.ReporteeId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReporteeId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReporteeId"), request.ReporteeId);
-    }
-    if (request.ReporterId.IsEmpty() || request.ReporterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReporterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReporterId"), request.ReporterId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Comment"), request.Comment);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ReporteeId"), request.ReporteeId);
+    RequestWriter.WriteStringOrNull(TEXT("ReporterId"), request.ReporterId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6318,7 +5248,7 @@ void UPlayFabServerAPI::HelperReportPlayer(FPlayFabBaseModel response, UObject*
         FServerReportPlayerServerResult ResultStruct = UPlayFabServerModelDecoder::decodeReportPlayerServerResultResponse(response.responseData);
         OnSuccessReportPlayer.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessReportPlayer.Unbind();
 }
 
 /** Revokes access to an item in a user's inventory */
@@ -6328,9 +5258,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::RevokeInventoryItem(FServerRevokeInventory
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6344,25 +5272,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::RevokeInventoryItem(FServerRevokeInventory
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteStringOrNull(TEXT("ItemInstanceId"), request.ItemInstanceId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6380,7 +5297,7 @@ void UPlayFabServerAPI::HelperRevokeInventoryItem(FPlayFabBaseModel response, UO
         FServerRevokeInventoryResult ResultStruct = UPlayFabServerModelDecoder::decodeRevokeInventoryResultResponse(response.responseData);
         OnSuccessRevokeInventoryItem.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRevokeInventoryItem.Unbind();
 }
 
 /** Revokes access for up to 25 items across multiple users and characters. */
@@ -6390,9 +5307,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::RevokeInventoryItems(FServerRevokeInventor
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6406,15 +5321,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::RevokeInventoryItems(FServerRevokeInventor
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Items.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Items"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Items"), request.Items);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObjectArray(TEXT("Items"), request.Items);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6432,7 +5344,7 @@ void UPlayFabServerAPI::HelperRevokeInventoryItems(FPlayFabBaseModel response, U
         FServerRevokeInventoryItemsResult ResultStruct = UPlayFabServerModelDecoder::decodeRevokeInventoryItemsResultResponse(response.responseData);
         OnSuccessRevokeInventoryItems.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRevokeInventoryItems.Unbind();
 }
 
 /** Decrements the character's balance of the specified virtual currency by the stated amount. It is possible to make a VC balance negative with this API. */
@@ -6442,9 +5354,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::SubtractCharacterVirtualCurrency(FServerSu
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6458,27 +5368,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::SubtractCharacterVirtualCurrency(FServerSu
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("Amount"), request.Amount);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("VirtualCurrency"), request.VirtualCurrency);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6494,10 +5393,10 @@ void UPlayFabServerAPI::HelperSubtractCharacterVirtualCurrency(FPlayFabBaseModel
     else if (!error.hasError && OnSuccessSubtractCharacterVirtualCurrency.IsBound())
     {
         FServerModifyCharacterVirtualCurrencyResult ResultStruct = UPlayFabServerModelDecoder::decodeModifyCharacterVirtualCurrencyResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessSubtractCharacterVirtualCurrency.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSubtractCharacterVirtualCurrency.Unbind();
 }
 
 /** Decrements the user's balance of the specified virtual currency by the stated amount. It is possible to make a VC balance negative with this API. */
@@ -6507,9 +5406,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::SubtractUserVirtualCurrency(FServerSubtrac
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6523,22 +5420,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::SubtractUserVirtualCurrency(FServerSubtrac
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("Amount"), request.Amount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("VirtualCurrency"), request.VirtualCurrency);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6554,10 +5444,10 @@ void UPlayFabServerAPI::HelperSubtractUserVirtualCurrency(FPlayFabBaseModel resp
     else if (!error.hasError && OnSuccessSubtractUserVirtualCurrency.IsBound())
     {
         FServerModifyUserVirtualCurrencyResult ResultStruct = UPlayFabServerModelDecoder::decodeModifyUserVirtualCurrencyResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessSubtractUserVirtualCurrency.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSubtractUserVirtualCurrency.Unbind();
 }
 
 /** Opens a specific container (ContainerItemInstanceId), with a specific key (KeyItemInstanceId, when required), and returns the contents of the opened container. If the container (and key when relevant) are consumable (RemainingUses > 0), their RemainingUses will be decremented, consistent with the operation of ConsumeItem. */
@@ -6567,9 +5457,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UnlockContainerInstance(FServerUnlockConta
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6583,36 +5471,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::UnlockContainerInstance(FServerUnlockConta
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.ContainerItemInstanceId.IsEmpty() || request.ContainerItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ContainerItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ContainerItemInstanceId"), request.ContainerItemInstanceId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.KeyItemInstanceId.IsEmpty() || request.KeyItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeyItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("KeyItemInstanceId"), request.KeyItemInstanceId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteStringOrNull(TEXT("ContainerItemInstanceId"), request.ContainerItemInstanceId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("KeyItemInstanceId"), request.KeyItemInstanceId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6630,7 +5499,7 @@ void UPlayFabServerAPI::HelperUnlockContainerInstance(FPlayFabBaseModel response
         FServerUnlockContainerItemResult ResultStruct = UPlayFabServerModelDecoder::decodeUnlockContainerItemResultResponse(response.responseData);
         OnSuccessUnlockContainerInstance.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlockContainerInstance.Unbind();
 }
 
 /** Searches Player or Character inventory for any ItemInstance matching the given CatalogItemId, if necessary unlocks it using any appropriate key, and returns the contents of the opened container. If the container (and key when relevant) are consumable (RemainingUses > 0), their RemainingUses will be decremented, consistent with the operation of ConsumeItem. */
@@ -6640,9 +5509,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UnlockContainerItem(FServerUnlockContainer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6656,31 +5523,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::UnlockContainerItem(FServerUnlockContainer
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.ContainerItemId.IsEmpty() || request.ContainerItemId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ContainerItemId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ContainerItemId"), request.ContainerItemId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteStringOrNull(TEXT("ContainerItemId"), request.ContainerItemId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6696,10 +5548,10 @@ void UPlayFabServerAPI::HelperUnlockContainerItem(FPlayFabBaseModel response, UO
     else if (!error.hasError && OnSuccessUnlockContainerItem.IsBound())
     {
         FServerUnlockContainerItemResult ResultStruct = UPlayFabServerModelDecoder::decodeUnlockContainerItemResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUnlockContainerItem.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUnlockContainerItem.Unbind();
 }
 
 /** Updates the key-value pair data tagged to the specified item, which is read-only from the client. */
@@ -6709,9 +5561,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserInventoryItemCustomData(FServerU
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6725,35 +5575,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserInventoryItemCustomData(FServerU
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringOrNull(TEXT("ItemInstanceId"), request.ItemInstanceId);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6769,10 +5601,10 @@ void UPlayFabServerAPI::HelperUpdateUserInventoryItemCustomData(FPlayFabBaseMode
     else if (!error.hasError && OnSuccessUpdateUserInventoryItemCustomData.IsBound())
     {
         FServerEmptyResponse ResultStruct = UPlayFabServerModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateUserInventoryItemCustomData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateUserInventoryItemCustomData.Unbind();
 }
 
 
@@ -6786,9 +5618,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddPlayerTag(FServerAddPlayerTagRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6802,21 +5632,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddPlayerTag(FServerAddPlayerTagRequest re
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.TagName.IsEmpty() || request.TagName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TagName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TagName"), request.TagName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("TagName"), request.TagName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6834,7 +5657,7 @@ void UPlayFabServerAPI::HelperAddPlayerTag(FPlayFabBaseModel response, UObject*
         FServerAddPlayerTagResult ResultStruct = UPlayFabServerModelDecoder::decodeAddPlayerTagResultResponse(response.responseData);
         OnSuccessAddPlayerTag.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddPlayerTag.Unbind();
 }
 
 /** Retrieves an array of player segment definitions. Results from this can be used in subsequent API calls such as GetPlayersInSegment which requires a Segment ID. While segment names can change the ID for that segment will not change. */
@@ -6844,9 +5667,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetAllSegments(FServerGetAllSegmentsReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6860,10 +5681,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetAllSegments(FServerGetAllSegmentsReques
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6881,7 +5703,7 @@ void UPlayFabServerAPI::HelperGetAllSegments(FPlayFabBaseModel response, UObject
         FServerGetAllSegmentsResult ResultStruct = UPlayFabServerModelDecoder::decodeGetAllSegmentsResultResponse(response.responseData);
         OnSuccessGetAllSegments.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetAllSegments.Unbind();
 }
 
 /** List all segments that a player currently belongs to at this moment in time. */
@@ -6891,9 +5713,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerSegments(FServerGetPlayersSegment
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6907,16 +5727,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerSegments(FServerGetPlayersSegment
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6934,7 +5751,7 @@ void UPlayFabServerAPI::HelperGetPlayerSegments(FPlayFabBaseModel response, UObj
         FServerGetPlayerSegmentsResult ResultStruct = UPlayFabServerModelDecoder::decodeGetPlayerSegmentsResultResponse(response.responseData);
         OnSuccessGetPlayerSegments.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerSegments.Unbind();
 }
 
 /** Allows for paging through all players in a given segment. This API creates a snapshot of all player profiles that match the segment definition at the time of its creation and lives through the Total Seconds to Live, refreshing its life span on each subsequent use of the Continuation Token. Profiles that change during the course of paging will not be reflected in the results. AB Test segments are currently not supported by this operation. NOTE: This API is limited to being called 30 times in one minute. You will be returned an error if you exceed this threshold. */
@@ -6944,9 +5761,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayersInSegment(FServerGetPlayersInSeg
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6960,23 +5775,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayersInSegment(FServerGetPlayersInSeg
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.ContinuationToken.IsEmpty() || request.ContinuationToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ContinuationToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ContinuationToken"), request.ContinuationToken);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("MaxBatchSize"), request.MaxBatchSize);
-    OutRestJsonObj->SetNumberField(TEXT("SecondsToLive"), request.SecondsToLive);
-    if (request.SegmentId.IsEmpty() || request.SegmentId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SegmentId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SegmentId"), request.SegmentId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("ContinuationToken"), request.ContinuationToken);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("MaxBatchSize"), request.MaxBatchSize);
+    RequestWriter.WriteNumber(TEXT("SecondsToLive"), request.SecondsToLive);
+    RequestWriter.WriteStringOrNull(TEXT("SegmentId"), request.SegmentId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6994,7 +5802,7 @@ void UPlayFabServerAPI::HelperGetPlayersInSegment(FPlayFabBaseModel response, UO
         FServerGetPlayersInSegmentResult ResultStruct = UPlayFabServerModelDecoder::decodeGetPlayersInSegmentResultResponse(response.responseData);
         OnSuccessGetPlayersInSegment.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayersInSegment.Unbind();
 }
 
 /** Get all tags with a given Namespace (optional) from a player profile. */
@@ -7004,9 +5812,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerTags(FServerGetPlayerTagsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7020,21 +5826,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerTags(FServerGetPlayerTagsRequest
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Namespace.IsEmpty() || request.Namespace == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Namespace"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Namespace"), request.Namespace);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Namespace"), request.Namespace);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7052,7 +5851,7 @@ void UPlayFabServerAPI::HelperGetPlayerTags(FPlayFabBaseModel response, UObject*
         FServerGetPlayerTagsResult ResultStruct = UPlayFabServerModelDecoder::decodeGetPlayerTagsResultResponse(response.responseData);
         OnSuccessGetPlayerTags.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerTags.Unbind();
 }
 
 /** Remove a given tag from a player profile. The tag's namespace is automatically generated based on the source of the tag. */
@@ -7062,9 +5861,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::RemovePlayerTag(FServerRemovePlayerTagRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7078,21 +5875,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::RemovePlayerTag(FServerRemovePlayerTagRequ
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.TagName.IsEmpty() || request.TagName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TagName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TagName"), request.TagName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("TagName"), request.TagName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7110,7 +5900,7 @@ void UPlayFabServerAPI::HelperRemovePlayerTag(FPlayFabBaseModel response, UObjec
         FServerRemovePlayerTagResult ResultStruct = UPlayFabServerModelDecoder::decodeRemovePlayerTagResultResponse(response.responseData);
         OnSuccessRemovePlayerTag.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRemovePlayerTag.Unbind();
 }
 
 
@@ -7124,9 +5914,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::ExecuteCloudScript(FServerExecuteCloudScri
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7140,27 +5928,20 @@ UPlayFabServerAPI* UPlayFabServerAPI::ExecuteCloudScript(FServerExecuteCloudScri
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.FunctionName.IsEmpty() || request.FunctionName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FunctionName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FunctionName"), request.FunctionName);
-    }
-    if (request.FunctionParameter != nullptr) OutRestJsonObj->SetObjectField(TEXT("FunctionParameter"), request.FunctionParameter);
-    OutRestJsonObj->SetBoolField(TEXT("GeneratePlayStreamEvent"), request.GeneratePlayStreamEvent);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("FunctionName"), request.FunctionName);
+    RequestWriter.WriteObject(TEXT("FunctionParameter"), request.FunctionParameter);
+    RequestWriter.WriteBool(TEXT("GeneratePlayStreamEvent"), request.GeneratePlayStreamEvent);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
     FString temp_RevisionSelection;
     if (GetEnumValueToString<ECloudScriptRevisionOption>(TEXT("ECloudScriptRevisionOption"), request.RevisionSelection, temp_RevisionSelection))
-        OutRestJsonObj->SetStringField(TEXT("RevisionSelection"), temp_RevisionSelection);
-    OutRestJsonObj->SetNumberField(TEXT("SpecificRevision"), request.SpecificRevision);
+        RequestWriter.WriteString(TEXT("RevisionSelection"), temp_RevisionSelection);
+    RequestWriter.WriteNumber(TEXT("SpecificRevision"), request.SpecificRevision);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7178,7 +5959,7 @@ void UPlayFabServerAPI::HelperExecuteCloudScript(FPlayFabBaseModel response, UOb
         FServerExecuteCloudScriptResult ResultStruct = UPlayFabServerModelDecoder::decodeExecuteCloudScriptResultResponse(response.responseData);
         OnSuccessExecuteCloudScript.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessExecuteCloudScript.Unbind();
 }
 
 
@@ -7192,9 +5973,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddSharedGroupMembers(FServerAddSharedGrou
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7208,23 +5987,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddSharedGroupMembers(FServerAddSharedGrou
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.PlayFabIds.IsEmpty() || request.PlayFabIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabIds"));
-    } else {
-        TArray<FString> PlayFabIdsArray;
-        FString(request.PlayFabIds).ParseIntoArray(PlayFabIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("PlayFabIds"), PlayFabIdsArray);
-    }
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("PlayFabIds"), request.PlayFabIds);
+    RequestWriter.WriteStringOrNull(TEXT("SharedGroupId"), request.SharedGroupId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7242,7 +6011,7 @@ void UPlayFabServerAPI::HelperAddSharedGroupMembers(FPlayFabBaseModel response,
         FServerAddSharedGroupMembersResult ResultStruct = UPlayFabServerModelDecoder::decodeAddSharedGroupMembersResultResponse(response.responseData);
         OnSuccessAddSharedGroupMembers.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddSharedGroupMembers.Unbind();
 }
 
 /** Requests the creation of a shared group object, containing key/value pairs which may be updated by all members of the group. When created by a server, the group will initially have no members. Shared Groups are designed for sharing data between a very small number of players, please see our guide: https://docs.microsoft.com/gaming/playfab/features/social/groups/using-shared-group-data */
@@ -7252,9 +6021,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::CreateSharedGroup(FServerCreateSharedGroup
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7268,15 +6035,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::CreateSharedGroup(FServerCreateSharedGroup
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("SharedGroupId"), request.SharedGroupId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7294,7 +6058,7 @@ void UPlayFabServerAPI::HelperCreateSharedGroup(FPlayFabBaseModel response, UObj
         FServerCreateSharedGroupResult ResultStruct = UPlayFabServerModelDecoder::decodeCreateSharedGroupResultResponse(response.responseData);
         OnSuccessCreateSharedGroup.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateSharedGroup.Unbind();
 }
 
 /** Deletes a shared group, freeing up the shared group ID to be reused for a new group. Shared Groups are designed for sharing data between a very small number of players, please see our guide: https://docs.microsoft.com/gaming/playfab/features/social/groups/using-shared-group-data */
@@ -7304,9 +6068,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::DeleteSharedGroup(FServerDeleteSharedGroup
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7320,15 +6082,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::DeleteSharedGroup(FServerDeleteSharedGroup
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("SharedGroupId"), request.SharedGroupId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7344,10 +6103,10 @@ void UPlayFabServerAPI::HelperDeleteSharedGroup(FPlayFabBaseModel response, UObj
     else if (!error.hasError && OnSuccessDeleteSharedGroup.IsBound())
     {
         FServerEmptyResponse ResultStruct = UPlayFabServerModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessDeleteSharedGroup.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteSharedGroup.Unbind();
 }
 
 /** Retrieves data stored in a shared group object, as well as the list of members in the group. The server can access all public and private group data. Shared Groups are designed for sharing data between a very small number of players, please see our guide: https://docs.microsoft.com/gaming/playfab/features/social/groups/using-shared-group-data */
@@ -7357,9 +6116,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetSharedGroupData(FServerGetSharedGroupDa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7373,24 +6130,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetSharedGroupData(FServerGetSharedGroupDa
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("GetMembers"), request.GetMembers);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("GetMembers"), request.GetMembers);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("SharedGroupId"), request.SharedGroupId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7408,7 +6155,7 @@ void UPlayFabServerAPI::HelperGetSharedGroupData(FPlayFabBaseModel response, UOb
         FServerGetSharedGroupDataResult ResultStruct = UPlayFabServerModelDecoder::decodeGetSharedGroupDataResultResponse(response.responseData);
         OnSuccessGetSharedGroupData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetSharedGroupData.Unbind();
 }
 
 /** Removes users from the set of those able to update the shared data and the set of users in the group. Only users in the group can remove members. If as a result of the call, zero users remain with access, the group and its associated data will be deleted. Shared Groups are designed for sharing data between a very small number of players, please see our guide: https://docs.microsoft.com/gaming/playfab/features/social/groups/using-shared-group-data */
@@ -7418,9 +6165,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::RemoveSharedGroupMembers(FServerRemoveShar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7434,23 +6179,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::RemoveSharedGroupMembers(FServerRemoveShar
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.PlayFabIds.IsEmpty() || request.PlayFabIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabIds"));
-    } else {
-        TArray<FString> PlayFabIdsArray;
-        FString(request.PlayFabIds).ParseIntoArray(PlayFabIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("PlayFabIds"), PlayFabIdsArray);
-    }
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("PlayFabIds"), request.PlayFabIds);
+    RequestWriter.WriteStringOrNull(TEXT("SharedGroupId"), request.SharedGroupId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7468,7 +6203,7 @@ void UPlayFabServerAPI::HelperRemoveSharedGroupMembers(FPlayFabBaseModel respons
         FServerRemoveSharedGroupMembersResult ResultStruct = UPlayFabServerModelDecoder::decodeRemoveSharedGroupMembersResultResponse(response.responseData);
         OnSuccessRemoveSharedGroupMembers.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRemoveSharedGroupMembers.Unbind();
 }
 
 /** Adds, updates, and removes data keys for a shared group object. If the permission is set to Public, all fields updated or added in this call will be readable by users not in the group. By default, data permissions are set to Private. Regardless of the permission setting, only members of the group (and the server) can update the data. Shared Groups are designed for sharing data between a very small number of players, please see our guide: https://docs.microsoft.com/gaming/playfab/features/social/groups/using-shared-group-data */
@@ -7478,9 +6213,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateSharedGroupData(FServerUpdateSharedG
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7494,28 +6227,18 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateSharedGroupData(FServerUpdateSharedG
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
     FString temp_Permission;
     if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
+        RequestWriter.WriteString(TEXT("Permission"), temp_Permission);
+    RequestWriter.WriteStringOrNull(TEXT("SharedGroupId"), request.SharedGroupId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7533,7 +6256,7 @@ void UPlayFabServerAPI::HelperUpdateSharedGroupData(FPlayFabBaseModel response,
         FServerUpdateSharedGroupDataResult ResultStruct = UPlayFabServerModelDecoder::decodeUpdateSharedGroupDataResultResponse(response.responseData);
         OnSuccessUpdateSharedGroupData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateSharedGroupData.Unbind();
 }
 
 
@@ -7547,9 +6270,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCatalogItems(FServerGetCatalogItemsRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7563,15 +6284,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCatalogItems(FServerGetCatalogItemsRequ
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7589,7 +6307,7 @@ void UPlayFabServerAPI::HelperGetCatalogItems(FPlayFabBaseModel response, UObjec
         FServerGetCatalogItemsResult ResultStruct = UPlayFabServerModelDecoder::decodeGetCatalogItemsResultResponse(response.responseData);
         OnSuccessGetCatalogItems.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetCatalogItems.Unbind();
 }
 
 /** Retrieves the key-value store of custom publisher settings */
@@ -7599,9 +6317,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPublisherData(FServerGetPublisherDataRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7615,18 +6331,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPublisherData(FServerGetPublisherDataRe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7644,7 +6354,7 @@ void UPlayFabServerAPI::HelperGetPublisherData(FPlayFabBaseModel response, UObje
         FServerGetPublisherDataResult ResultStruct = UPlayFabServerModelDecoder::decodeGetPublisherDataResultResponse(response.responseData);
         OnSuccessGetPublisherData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPublisherData.Unbind();
 }
 
 /** Retrieves the set of items defined for the specified store, including all prices defined, for the specified player */
@@ -7654,9 +6364,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetStoreItems(FServerGetStoreItemsServerRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7670,26 +6378,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetStoreItems(FServerGetStoreItemsServerRe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.StoreId.IsEmpty() || request.StoreId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StoreId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StoreId"), request.StoreId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("StoreId"), request.StoreId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7707,7 +6404,7 @@ void UPlayFabServerAPI::HelperGetStoreItems(FPlayFabBaseModel response, UObject*
         FServerGetStoreItemsResult ResultStruct = UPlayFabServerModelDecoder::decodeGetStoreItemsResultResponse(response.responseData);
         OnSuccessGetStoreItems.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetStoreItems.Unbind();
 }
 
 /** Retrieves the current server time */
@@ -7717,9 +6414,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetTime(FServerGetTimeRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7733,10 +6428,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetTime(FServerGetTimeRequest request,
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7754,7 +6450,7 @@ void UPlayFabServerAPI::HelperGetTime(FPlayFabBaseModel response, UObject* custo
         FServerGetTimeResult ResultStruct = UPlayFabServerModelDecoder::decodeGetTimeResultResponse(response.responseData);
         OnSuccessGetTime.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetTime.Unbind();
 }
 
 /** Retrieves the key-value store of custom title settings */
@@ -7764,9 +6460,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetTitleData(FServerGetTitleDataRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7780,23 +6474,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetTitleData(FServerGetTitleDataRequest re
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.OverrideLabel.IsEmpty() || request.OverrideLabel == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OverrideLabel"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OverrideLabel"), request.OverrideLabel);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("OverrideLabel"), request.OverrideLabel);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7814,7 +6498,7 @@ void UPlayFabServerAPI::HelperGetTitleData(FPlayFabBaseModel response, UObject*
         FServerGetTitleDataResult ResultStruct = UPlayFabServerModelDecoder::decodeGetTitleDataResultResponse(response.responseData);
         OnSuccessGetTitleData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetTitleData.Unbind();
 }
 
 /** Retrieves the key-value store of custom internal title settings */
@@ -7824,9 +6508,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetTitleInternalData(FServerGetTitleDataRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7840,23 +6522,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetTitleInternalData(FServerGetTitleDataRe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.OverrideLabel.IsEmpty() || request.OverrideLabel == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OverrideLabel"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OverrideLabel"), request.OverrideLabel);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("OverrideLabel"), request.OverrideLabel);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7872,10 +6544,10 @@ void UPlayFabServerAPI::HelperGetTitleInternalData(FPlayFabBaseModel response, U
     else if (!error.hasError && OnSuccessGetTitleInternalData.IsBound())
     {
         FServerGetTitleDataResult ResultStruct = UPlayFabServerModelDecoder::decodeGetTitleDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetTitleInternalData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetTitleInternalData.Unbind();
 }
 
 /** Retrieves the title news feed, as configured in the developer portal */
@@ -7885,9 +6557,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetTitleNews(FServerGetTitleNewsRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7901,11 +6571,12 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetTitleNews(FServerGetTitleNewsRequest re
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("Count"), request.Count);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("Count"), request.Count);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7923,7 +6594,7 @@ void UPlayFabServerAPI::HelperGetTitleNews(FPlayFabBaseModel response, UObject*
         FServerGetTitleNewsResult ResultStruct = UPlayFabServerModelDecoder::decodeGetTitleNewsResultResponse(response.responseData);
         OnSuccessGetTitleNews.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetTitleNews.Unbind();
 }
 
 /** Updates the key-value store of custom publisher settings */
@@ -7933,9 +6604,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetPublisherData(FServerSetPublisherDataRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -7949,20 +6618,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetPublisherData(FServerSetPublisherDataRe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    if (request.Value.IsEmpty() || request.Value == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Value"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Value"), request.Value);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Key"), request.Key);
+    RequestWriter.WriteStringOrNull(TEXT("Value"), request.Value);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -7980,7 +6642,7 @@ void UPlayFabServerAPI::HelperSetPublisherData(FPlayFabBaseModel response, UObje
         FServerSetPublisherDataResult ResultStruct = UPlayFabServerModelDecoder::decodeSetPublisherDataResultResponse(response.responseData);
         OnSuccessSetPublisherData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetPublisherData.Unbind();
 }
 
 /** Updates the key-value store of custom title settings */
@@ -7990,9 +6652,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetTitleData(FServerSetTitleDataRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8006,20 +6666,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetTitleData(FServerSetTitleDataRequest re
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    if (request.Value.IsEmpty() || request.Value == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Value"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Value"), request.Value);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Key"), request.Key);
+    RequestWriter.WriteStringOrNull(TEXT("Value"), request.Value);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8037,7 +6690,7 @@ void UPlayFabServerAPI::HelperSetTitleData(FPlayFabBaseModel response, UObject*
         FServerSetTitleDataResult ResultStruct = UPlayFabServerModelDecoder::decodeSetTitleDataResultResponse(response.responseData);
         OnSuccessSetTitleData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetTitleData.Unbind();
 }
 
 /** Updates the key-value store of custom title settings */
@@ -8047,9 +6700,7 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetTitleInternalData(FServerSetTitleDataRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -8063,20 +6714,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetTitleInternalData(FServerSetTitleDataRe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    if (request.Value.IsEmpty() || request.Value == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Value"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Value"), request.Value);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Key"), request.Key);
+    RequestWriter.WriteStringOrNull(TEXT("Value"), request.Value);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -8092,16 +6736,19 @@ void UPlayFabServerAPI::HelperSetTitleInternalData(FPlayFabBaseModel response, U
     else if (!error.hasError && OnSuccessSetTitleInternalData.IsBound())
     {
         FServerSetTitleDataResult ResultStruct = UPlayFabServerModelDecoder::decodeSetTitleDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessSetTitleInternalData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetTitleInternalData.Unbind();
 }
 
 
 
 void UPlayFabServerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
+    PlayFabCommon::FPlayFabCallCounters::EndCall(Request->GetURL());
+    PLAYFAB_TRACE_END(Wait, Request);
+
     // Be sure that we have no data from previous response
     ResetResponseData();
 
@@ -8110,6 +6757,14 @@ void UPlayFabServerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         UE_LOG(LogPlayFab, Error, TEXT("The request object is invalid during OnProcessRequestComplete."));
         return;
     }
+
+    // The call is over however this returns; the result helpers run during the broadcast, before the proxy is cleared
+    // Only set up once the object is known to be valid, as an invalid one can't be trusted to go back to the pool
+    ON_SCOPE_EXIT
+    {
+        ReleaseToPool();
+    };
+
     if (!OnPlayFabResponse.IsBound())
     {
         UE_LOG(LogPlayFab, Error, TEXT("OnPlayFabResponse has come un-bound during OnProcessRequestComplete."));
@@ -8129,20 +6784,25 @@ void UPlayFabServerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         myResponse.responseError.ErrorName = "Unable to contact server";
         myResponse.responseError.ErrorMessage = "Unable to contact server";
 
+        PLAYFAB_TRACE_SCOPE(Dispatch, Request);
         OnPlayFabResponse.Broadcast(myResponse, mCustomData, false);
 
         return;
     }
 
-    // Save response data as a string
-    ResponseContent = Response->GetContentAsString();
+    {
+        PLAYFAB_TRACE_SCOPE(Decode, Request);
+
+        // Save response data as a string
+        ResponseContent = Response->GetContentAsString();
 
-    // Save response code as int32
-    ResponseCode = Response->GetResponseCode();
+        // Save response code as int32
+        ResponseCode = Response->GetResponseCode();
 
-    // Try to deserialize data to JSON
-    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-    FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+        // Try to deserialize data to JSON
+        TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
+        FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+    }
 
     // Decide whether the request was successful
     bIsValidJsonResponse = bWasSuccessful && ResponseJsonObj->GetRootObject().IsValid();
@@ -8152,7 +6812,7 @@ void UPlayFabServerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
 
     // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
+    PlayFabCommon::FPlayFabRequestLog::LogResponse(Request, ResponseCode, Response->GetContent());
 
     myResponse.responseError.decodeError(ResponseJsonObj);
     myResponse.responseData = ResponseJsonObj;
@@ -8167,8 +6827,8 @@ void UPlayFabServerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
     }
 
     // Broadcast the result event
+    PLAYFAB_TRACE_SCOPE(Dispatch, Request);
     OnPlayFabResponse.Broadcast(myResponse, mCustomData, !myResponse.responseError.hasError);
-    pfSettings->ModifyPendingCallCount(-1);
 }
 
 void UPlayFabServerAPI::Activate()
@@ -8226,24 +6886,55 @@ void UPlayFabServerAPI::Activate()
     for (TMap<FString, FString>::TConstIterator It(RequestHeaders); It; ++It)
         HttpRequest->SetHeader(It.Key(), It.Value());
 
-    // Serialize data to json string
-    FString OutputString;
-    TSharedRef< TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    // Requests made by the generated functions are already serialized; one set with SetRequestObject is serialized here
+    if (RequestJsonObj != nullptr && RequestBody.Num() == 0)
+    {
+        PLAYFAB_TRACE_SCOPE(Serialize, HttpRequest);
+        FMemoryWriter BodyStream(RequestBody);
+        PlayFab::JsonUtf8Writer Writer = TJsonWriterFactory<TCHAR, PlayFab::FPlayFabCondensedUtf8PrintPolicy>::Create(&BodyStream);
+        FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    }
 
     // Set Json content
-    HttpRequest->SetContentAsString(OutputString);
+    HttpRequest->SetContent(RequestBody);
 
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
+    PlayFabCommon::FPlayFabRequestLog::LogRequest(HttpRequest, RequestBody);
 
     // Bind event
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabServerAPI::OnProcessRequestComplete);
 
     // Execute the request
-    pfSettings->ModifyPendingCallCount(1);
+    PlayFabCommon::FPlayFabCallCounters::BeginCall(RequestUrl);
+    PLAYFAB_TRACE_BEGIN(Wait, HttpRequest);
+    PLAYFAB_TRACE_SCOPE(Send, HttpRequest);
     HttpRequest->ProcessRequest();
 }
 
+void UPlayFabServerAPI::ReleaseToPool()
+{
+    // Clear everything the next call through this proxy would otherwise inherit
+    OnPlayFabResponse.Clear();
+    OnFailure.Unbind();
+    mCustomData = nullptr;
+    CallAuthenticationContext = nullptr;
+    PlayFabRequestURL.Reset();
+    useEntityToken = false;
+    useSecretKey = false;
+    useSessionTicket = false;
+    returnsSessionTicket = false;
+    returnsEntityToken = false;
+    RequestHeaders.Reset();
+    ResponseContent.Reset();
+    ResponseCode = 0;
+    bIsValidJsonResponse = false;
+
+    // The request object is the caller's, or was handed to the caller with the result, so it isn't recycled
+    RequestBody.Reset();
+    RequestJsonObj = nullptr;
+    // The response object is kept with the proxy, and cleared when its next response arrives
+    FPlayFabObjectPool::Release(this);
+}
+
 void UPlayFabServerAPI::ResetResponseData()
 {
     if (ResponseJsonObj != nullptr)
@@ -0,0 +1,42 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+
+/**
+ * Recycles the proxy objects of Blueprint calls, instead of creating new ones for every call.
+ * Objects in use and objects waiting for reuse are both referenced by the pool, so they stay alive without the root set.
+ * Each class keeps up to UPlayFabRuntimeSettings::BlueprintObjectPoolSize free objects; objects released beyond that are left to the garbage collector.
+ * Game thread only, like the Blueprint calls themselves.
+ */
+class PLAYFAB_API FPlayFabObjectPool : public FGCObject
+{
+public:
+    static void Startup();
+    static void Shutdown();
+
+    template <typename ObjectType>
+    static ObjectType* Acquire()
+    {
+        return CastChecked<ObjectType>(Acquire(ObjectType::StaticClass()));
+    }
+    static UObject* Acquire(UClass* Class);
+    // The object must be reset by the caller; it may be handed out again by the next Acquire
+    static void Release(UObject* Object);
+
+    // Objects waiting for reuse, and objects handed out and not yet released
+    static int32 GetFreeCount();
+    static int32 GetInUseCount();
+
+    virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+
+private:
+    TMap<UClass*, TArray<UObject*>> FreeObjects;
+    // Few at a time, as many as there are Blueprint calls in flight
+    TArray<UObject*> ObjectsInUse;
+};
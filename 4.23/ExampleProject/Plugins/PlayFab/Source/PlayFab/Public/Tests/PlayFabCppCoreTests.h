@@ -0,0 +1,126 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "PlayFab.h"
+#include "PlayFabCommon.h"
+#include "Core/PlayFabRequestHandle.h"
+#include "TestFramework/PlayFabTestCase.h"
+#include "TestFramework/PlayFabTestContext.h"
+
+#include "PlayFabCppCoreTests.generated.h"
+
+namespace PlayFab
+{
+    namespace ClientModels
+    {
+        struct FLoginResult;
+        struct FGetTitlePublicKeyResult;
+    }
+
+    struct FPlayFabCppError;
+}
+
+/**
+ * Tests of the Cpp request pipeline that don't need a title: decoding, retries, throttling, compression and logging.
+ * Most of them drive the pipeline's building blocks directly, without sending anything.
+ */
+UCLASS()
+class PLAYFAB_API UPlayFabCppCoreTests : public UPlayFabTestCase
+{
+    GENERATED_BODY()
+
+public:
+    virtual void GetTests(TArray<UPlayFabTestContext*>& InOutTests) override
+    {
+        InOutTests.ADD_TEST(Json Pull Reader Round Trip (CPP), JsonPullReaderRoundTrip);
+        InOutTests.ADD_TEST(Json Pull Reader Malformed Input (CPP), JsonPullReaderMalformedInput);
+        InOutTests.ADD_TEST(Retry Policy (CPP), RetryPolicy);
+        InOutTests.ADD_TEST(Request Governor (CPP), RequestGovernor);
+        InOutTests.ADD_TEST(Request Coalescer (CPP), RequestCoalescer);
+        InOutTests.ADD_TEST(Gzip Size Cap (CPP), GzipSizeCap);
+        InOutTests.ADD_TEST(Circuit Breaker (CPP), CircuitBreaker);
+        InOutTests.ADD_TEST(Request Log Redaction (CPP), RequestLogRedaction);
+        InOutTests.ADD_TEST(Percent Encoding (CPP), PercentEncoding);
+
+        InOutTests.ADD_TEST(Cancelled Call (CPP), CancelledCall);
+        InOutTests.ADD_TEST(Reused Handle (CPP), ReusedHandle);
+
+    }
+
+    virtual void ClassSetUp() override;
+    virtual void SetUp(UPlayFabTestContext* testContext) override;
+    virtual void Tick(UPlayFabTestContext* testContext) override;
+
+private:
+    // Used to end tests.
+    class UPlayFabTestContext* CurrentTestContext = nullptr;
+    // Expectations of the current test that didn't hold
+    TArray<FString> FailedExpectations;
+
+    // Records a failed expectation of the current test, which then fails in FinishTest
+    void Expect(bool bCondition, const TCHAR* Description);
+    // Ends the current test, failed if any of its expectations didn't hold
+    void FinishTest();
+
+
+    PlayFabClientPtr ClientAPI;
+
+    // Platform time at which the cancelled call has had long enough to complete, or zero when no call is awaited
+    double CancelledCallDeadline = 0.0;
+    // Delegates run by the cancelled call, which should stay at zero
+    int32 CancelledCallDelegates = 0;
+
+    // The handle reused while the result of its first call is held back from its delegates
+    PlayFab::FPlayFabRequestHandle HeldResultHandle;
+    // Platform time by which the first call's result must have arrived, or zero when no result is awaited
+    double ReusedHandleDeadline = 0.0;
+    int32 ReusedHandleDelegates = 0;
+    // Results caught by the test's response dispatcher; the dispatcher may run on any thread
+    FCriticalSection HeldResultsLock;
+    TArray<TFunction<void()>> HeldResults;
+
+    UFUNCTION()
+    void JsonPullReaderRoundTrip();
+
+    UFUNCTION()
+    void JsonPullReaderMalformedInput();
+
+    UFUNCTION()
+    void RetryPolicy();
+
+    UFUNCTION()
+    void RequestGovernor();
+
+    UFUNCTION()
+    void RequestCoalescer();
+
+    UFUNCTION()
+    void GzipSizeCap();
+
+    UFUNCTION()
+    void CircuitBreaker();
+
+    UFUNCTION()
+    void RequestLogRedaction();
+
+    UFUNCTION()
+    void PercentEncoding();
+
+
+    UFUNCTION()
+    void CancelledCall();
+    void CancelledCall_Success(const PlayFab::ClientModels::FLoginResult& result);
+    void CancelledCall_Error(const PlayFab::FPlayFabCppError& InError);
+
+    UFUNCTION()
+    void ReusedHandle();
+    void ReusedHandle_Success(const PlayFab::ClientModels::FGetTitlePublicKeyResult& result);
+    void ReusedHandle_Error(const PlayFab::FPlayFabCppError& InError);
+    // Reuses the handle once its first call's result is held, then cancels it and releases the result
+    void ReusedHandle_Tick();
+
+};
@@ -0,0 +1,13 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabAPISettings.h"
+#include "PlayFabUrlCache.h"
+
+FString UPlayFabAPISettings::GeneratePfUrl(const FString& urlPath)
+{
+    static PlayFabCommon::FPlayFabUrlCache UrlCache;
+    return UrlCache.GetUrl(urlPath, PlayFab::PlayFabSettings::sdkVersion);
+}
@@ -30,7 +30,8 @@ FString UPlayFabAuthenticationAPI::GetBuildIdentifier() const
 bool UPlayFabAuthenticationAPI::GetEntityToken(
     AuthenticationModels::FGetEntityTokenRequest& request,
     const FGetEntityTokenDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString authKey; FString authValue;
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
@@ -46,31 +47,34 @@ bool UPlayFabAuthenticationAPI::GetEntityToken(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Authentication/GetEntityToken"), request.toJSONString(), authKey, authValue);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Authentication/GetEntityToken"), request.toJSONUtf8(), authKey, authValue);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAuthenticationAPI::OnGetEntityTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<AuthenticationModels::FGetEntityTokenResponse>> UPlayFabAuthenticationAPI::GetEntityTokenAsync(AuthenticationModels::FGetEntityTokenRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AuthenticationModels::FGetEntityTokenResponse, FGetEntityTokenDelegate>([this, &request, &Handle](const FGetEntityTokenDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAuthenticationAPI::GetEntityToken(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAuthenticationAPI::OnGetEntityTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetEntityTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AuthenticationModels::FGetEntityTokenResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AuthenticationModels::FGetEntityTokenResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AuthenticationModels::FGetEntityTokenResponse& outResult)
     {
         if (outResult.EntityToken.Len() > 0)
             PlayFabSettings::SetEntityToken(outResult.EntityToken);
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabAuthenticationAPI::ValidateEntityToken(
     AuthenticationModels::FValidateEntityTokenRequest& request,
     const FValidateEntityTokenDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -78,21 +82,23 @@ bool UPlayFabAuthenticationAPI::ValidateEntityToken(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Authentication/ValidateEntityToken"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Authentication/ValidateEntityToken"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAuthenticationAPI::OnValidateEntityTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AuthenticationModels::FValidateEntityTokenResponse>> UPlayFabAuthenticationAPI::ValidateEntityTokenAsync(AuthenticationModels::FValidateEntityTokenRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AuthenticationModels::FValidateEntityTokenResponse, FValidateEntityTokenDelegate>([this, &request, &Handle](const FValidateEntityTokenDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAuthenticationAPI::ValidateEntityToken(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAuthenticationAPI::OnValidateEntityTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateEntityTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AuthenticationModels::FValidateEntityTokenResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AuthenticationModels::FValidateEntityTokenResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AuthenticationModels::FValidateEntityTokenResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
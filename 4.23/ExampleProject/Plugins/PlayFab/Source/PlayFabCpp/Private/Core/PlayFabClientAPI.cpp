@@ -34,7 +34,8 @@ bool UPlayFabClientAPI::IsClientLoggedIn() const
 bool UPlayFabClientAPI::AcceptTrade(
     ClientModels::FAcceptTradeRequest& request,
     const FAcceptTradeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -43,29 +44,32 @@ bool UPlayFabClientAPI::AcceptTrade(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AcceptTrade"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AcceptTrade"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAcceptTradeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FAcceptTradeResponse>> UPlayFabClientAPI::AcceptTradeAsync(ClientModels::FAcceptTradeRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FAcceptTradeResponse, FAcceptTradeDelegate>([this, &request, &Handle](const FAcceptTradeDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::AcceptTrade(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnAcceptTradeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAcceptTradeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FAcceptTradeResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FAcceptTradeResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FAcceptTradeResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::AddFriend(
     ClientModels::FAddFriendRequest& request,
     const FAddFriendDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -74,29 +78,32 @@ bool UPlayFabClientAPI::AddFriend(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddFriend"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddFriend"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAddFriendResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FAddFriendResult>> UPlayFabClientAPI::AddFriendAsync(ClientModels::FAddFriendRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FAddFriendResult, FAddFriendDelegate>([this, &request, &Handle](const FAddFriendDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::AddFriend(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnAddFriendResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddFriendDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FAddFriendResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FAddFriendResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FAddFriendResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::AddGenericID(
     ClientModels::FAddGenericIDRequest& request,
     const FAddGenericIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -105,29 +112,32 @@ bool UPlayFabClientAPI::AddGenericID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddGenericID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddGenericID"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAddGenericIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FAddGenericIDResult>> UPlayFabClientAPI::AddGenericIDAsync(ClientModels::FAddGenericIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FAddGenericIDResult, FAddGenericIDDelegate>([this, &request, &Handle](const FAddGenericIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::AddGenericID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnAddGenericIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddGenericIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FAddGenericIDResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FAddGenericIDResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FAddGenericIDResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::AddOrUpdateContactEmail(
     ClientModels::FAddOrUpdateContactEmailRequest& request,
     const FAddOrUpdateContactEmailDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -136,29 +146,32 @@ bool UPlayFabClientAPI::AddOrUpdateContactEmail(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddOrUpdateContactEmail"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddOrUpdateContactEmail"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAddOrUpdateContactEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FAddOrUpdateContactEmailResult>> UPlayFabClientAPI::AddOrUpdateContactEmailAsync(ClientModels::FAddOrUpdateContactEmailRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FAddOrUpdateContactEmailResult, FAddOrUpdateContactEmailDelegate>([this, &request, &Handle](const FAddOrUpdateContactEmailDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::AddOrUpdateContactEmail(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnAddOrUpdateContactEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddOrUpdateContactEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FAddOrUpdateContactEmailResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FAddOrUpdateContactEmailResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FAddOrUpdateContactEmailResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::AddSharedGroupMembers(
     ClientModels::FAddSharedGroupMembersRequest& request,
     const FAddSharedGroupMembersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -167,29 +180,32 @@ bool UPlayFabClientAPI::AddSharedGroupMembers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddSharedGroupMembers"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddSharedGroupMembers"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAddSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FAddSharedGroupMembersResult>> UPlayFabClientAPI::AddSharedGroupMembersAsync(ClientModels::FAddSharedGroupMembersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FAddSharedGroupMembersResult, FAddSharedGroupMembersDelegate>([this, &request, &Handle](const FAddSharedGroupMembersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::AddSharedGroupMembers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnAddSharedGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddSharedGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FAddSharedGroupMembersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FAddSharedGroupMembersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FAddSharedGroupMembersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::AddUsernamePassword(
     ClientModels::FAddUsernamePasswordRequest& request,
     const FAddUsernamePasswordDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -198,29 +214,32 @@ bool UPlayFabClientAPI::AddUsernamePassword(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddUsernamePassword"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddUsernamePassword"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAddUsernamePasswordResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FAddUsernamePasswordResult>> UPlayFabClientAPI::AddUsernamePasswordAsync(ClientModels::FAddUsernamePasswordRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FAddUsernamePasswordResult, FAddUsernamePasswordDelegate>([this, &request, &Handle](const FAddUsernamePasswordDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::AddUsernamePassword(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnAddUsernamePasswordResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddUsernamePasswordDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FAddUsernamePasswordResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FAddUsernamePasswordResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FAddUsernamePasswordResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::AddUserVirtualCurrency(
     ClientModels::FAddUserVirtualCurrencyRequest& request,
     const FAddUserVirtualCurrencyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -229,29 +248,32 @@ bool UPlayFabClientAPI::AddUserVirtualCurrency(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddUserVirtualCurrency"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AddUserVirtualCurrency"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAddUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FModifyUserVirtualCurrencyResult>> UPlayFabClientAPI::AddUserVirtualCurrencyAsync(ClientModels::FAddUserVirtualCurrencyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FModifyUserVirtualCurrencyResult, FAddUserVirtualCurrencyDelegate>([this, &request, &Handle](const FAddUserVirtualCurrencyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::AddUserVirtualCurrency(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnAddUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FModifyUserVirtualCurrencyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FModifyUserVirtualCurrencyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FModifyUserVirtualCurrencyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::AndroidDevicePushNotificationRegistration(
     ClientModels::FAndroidDevicePushNotificationRegistrationRequest& request,
     const FAndroidDevicePushNotificationRegistrationDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -260,29 +282,32 @@ bool UPlayFabClientAPI::AndroidDevicePushNotificationRegistration(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AndroidDevicePushNotificationRegistration"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/AndroidDevicePushNotificationRegistration"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnAndroidDevicePushNotificationRegistrationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FAndroidDevicePushNotificationRegistrationResult>> UPlayFabClientAPI::AndroidDevicePushNotificationRegistrationAsync(ClientModels::FAndroidDevicePushNotificationRegistrationRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FAndroidDevicePushNotificationRegistrationResult, FAndroidDevicePushNotificationRegistrationDelegate>([this, &request, &Handle](const FAndroidDevicePushNotificationRegistrationDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::AndroidDevicePushNotificationRegistration(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnAndroidDevicePushNotificationRegistrationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAndroidDevicePushNotificationRegistrationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FAndroidDevicePushNotificationRegistrationResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FAndroidDevicePushNotificationRegistrationResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FAndroidDevicePushNotificationRegistrationResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::CancelTrade(
     ClientModels::FCancelTradeRequest& request,
     const FCancelTradeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -291,29 +316,32 @@ bool UPlayFabClientAPI::CancelTrade(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/CancelTrade"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/CancelTrade"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnCancelTradeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FCancelTradeResponse>> UPlayFabClientAPI::CancelTradeAsync(ClientModels::FCancelTradeRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FCancelTradeResponse, FCancelTradeDelegate>([this, &request, &Handle](const FCancelTradeDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::CancelTrade(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnCancelTradeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCancelTradeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FCancelTradeResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FCancelTradeResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FCancelTradeResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::ConfirmPurchase(
     ClientModels::FConfirmPurchaseRequest& request,
     const FConfirmPurchaseDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -322,29 +350,32 @@ bool UPlayFabClientAPI::ConfirmPurchase(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConfirmPurchase"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConfirmPurchase"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnConfirmPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FConfirmPurchaseResult>> UPlayFabClientAPI::ConfirmPurchaseAsync(ClientModels::FConfirmPurchaseRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FConfirmPurchaseResult, FConfirmPurchaseDelegate>([this, &request, &Handle](const FConfirmPurchaseDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::ConfirmPurchase(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnConfirmPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConfirmPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FConfirmPurchaseResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FConfirmPurchaseResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FConfirmPurchaseResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::ConsumeItem(
     ClientModels::FConsumeItemRequest& request,
     const FConsumeItemDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -353,29 +384,32 @@ bool UPlayFabClientAPI::ConsumeItem(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumeItem"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumeItem"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnConsumeItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FConsumeItemResult>> UPlayFabClientAPI::ConsumeItemAsync(ClientModels::FConsumeItemRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FConsumeItemResult, FConsumeItemDelegate>([this, &request, &Handle](const FConsumeItemDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::ConsumeItem(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnConsumeItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumeItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FConsumeItemResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FConsumeItemResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FConsumeItemResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::ConsumeMicrosoftStoreEntitlements(
     ClientModels::FConsumeMicrosoftStoreEntitlementsRequest& request,
     const FConsumeMicrosoftStoreEntitlementsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -384,29 +418,32 @@ bool UPlayFabClientAPI::ConsumeMicrosoftStoreEntitlements(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumeMicrosoftStoreEntitlements"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumeMicrosoftStoreEntitlements"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnConsumeMicrosoftStoreEntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FConsumeMicrosoftStoreEntitlementsResponse>> UPlayFabClientAPI::ConsumeMicrosoftStoreEntitlementsAsync(ClientModels::FConsumeMicrosoftStoreEntitlementsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FConsumeMicrosoftStoreEntitlementsResponse, FConsumeMicrosoftStoreEntitlementsDelegate>([this, &request, &Handle](const FConsumeMicrosoftStoreEntitlementsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::ConsumeMicrosoftStoreEntitlements(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnConsumeMicrosoftStoreEntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumeMicrosoftStoreEntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FConsumeMicrosoftStoreEntitlementsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FConsumeMicrosoftStoreEntitlementsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FConsumeMicrosoftStoreEntitlementsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::ConsumePS5Entitlements(
     ClientModels::FConsumePS5EntitlementsRequest& request,
     const FConsumePS5EntitlementsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -415,29 +452,32 @@ bool UPlayFabClientAPI::ConsumePS5Entitlements(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumePS5Entitlements"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumePS5Entitlements"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnConsumePS5EntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FConsumePS5EntitlementsResult>> UPlayFabClientAPI::ConsumePS5EntitlementsAsync(ClientModels::FConsumePS5EntitlementsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FConsumePS5EntitlementsResult, FConsumePS5EntitlementsDelegate>([this, &request, &Handle](const FConsumePS5EntitlementsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::ConsumePS5Entitlements(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnConsumePS5EntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumePS5EntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FConsumePS5EntitlementsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FConsumePS5EntitlementsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FConsumePS5EntitlementsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::ConsumePSNEntitlements(
     ClientModels::FConsumePSNEntitlementsRequest& request,
     const FConsumePSNEntitlementsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -446,29 +486,32 @@ bool UPlayFabClientAPI::ConsumePSNEntitlements(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumePSNEntitlements"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumePSNEntitlements"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnConsumePSNEntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FConsumePSNEntitlementsResult>> UPlayFabClientAPI::ConsumePSNEntitlementsAsync(ClientModels::FConsumePSNEntitlementsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FConsumePSNEntitlementsResult, FConsumePSNEntitlementsDelegate>([this, &request, &Handle](const FConsumePSNEntitlementsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::ConsumePSNEntitlements(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnConsumePSNEntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumePSNEntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FConsumePSNEntitlementsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FConsumePSNEntitlementsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FConsumePSNEntitlementsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::ConsumeXboxEntitlements(
     ClientModels::FConsumeXboxEntitlementsRequest& request,
     const FConsumeXboxEntitlementsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -477,29 +520,32 @@ bool UPlayFabClientAPI::ConsumeXboxEntitlements(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumeXboxEntitlements"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ConsumeXboxEntitlements"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnConsumeXboxEntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FConsumeXboxEntitlementsResult>> UPlayFabClientAPI::ConsumeXboxEntitlementsAsync(ClientModels::FConsumeXboxEntitlementsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FConsumeXboxEntitlementsResult, FConsumeXboxEntitlementsDelegate>([this, &request, &Handle](const FConsumeXboxEntitlementsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::ConsumeXboxEntitlements(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnConsumeXboxEntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumeXboxEntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FConsumeXboxEntitlementsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FConsumeXboxEntitlementsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FConsumeXboxEntitlementsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::CreateSharedGroup(
     ClientModels::FCreateSharedGroupRequest& request,
     const FCreateSharedGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -508,29 +554,32 @@ bool UPlayFabClientAPI::CreateSharedGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/CreateSharedGroup"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/CreateSharedGroup"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnCreateSharedGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FCreateSharedGroupResult>> UPlayFabClientAPI::CreateSharedGroupAsync(ClientModels::FCreateSharedGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FCreateSharedGroupResult, FCreateSharedGroupDelegate>([this, &request, &Handle](const FCreateSharedGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::CreateSharedGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnCreateSharedGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateSharedGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FCreateSharedGroupResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FCreateSharedGroupResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FCreateSharedGroupResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::ExecuteCloudScript(
     ClientModels::FExecuteCloudScriptRequest& request,
     const FExecuteCloudScriptDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -539,29 +588,32 @@ bool UPlayFabClientAPI::ExecuteCloudScript(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ExecuteCloudScript"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ExecuteCloudScript"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnExecuteCloudScriptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FExecuteCloudScriptResult>> UPlayFabClientAPI::ExecuteCloudScriptAsync(ClientModels::FExecuteCloudScriptRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FExecuteCloudScriptResult, FExecuteCloudScriptDelegate>([this, &request, &Handle](const FExecuteCloudScriptDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::ExecuteCloudScript(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnExecuteCloudScriptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExecuteCloudScriptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FExecuteCloudScriptResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FExecuteCloudScriptResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FExecuteCloudScriptResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetAccountInfo(
     ClientModels::FGetAccountInfoRequest& request,
     const FGetAccountInfoDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -570,29 +622,32 @@ bool UPlayFabClientAPI::GetAccountInfo(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetAccountInfo"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetAccountInfo"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetAccountInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetAccountInfoResult>> UPlayFabClientAPI::GetAccountInfoAsync(ClientModels::FGetAccountInfoRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetAccountInfoResult, FGetAccountInfoDelegate>([this, &request, &Handle](const FGetAccountInfoDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetAccountInfo(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetAccountInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAccountInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetAccountInfoResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetAccountInfoResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetAccountInfoResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetAdPlacements(
     ClientModels::FGetAdPlacementsRequest& request,
     const FGetAdPlacementsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -601,29 +656,32 @@ bool UPlayFabClientAPI::GetAdPlacements(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetAdPlacements"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetAdPlacements"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetAdPlacementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetAdPlacementsResult>> UPlayFabClientAPI::GetAdPlacementsAsync(ClientModels::FGetAdPlacementsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetAdPlacementsResult, FGetAdPlacementsDelegate>([this, &request, &Handle](const FGetAdPlacementsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetAdPlacements(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetAdPlacementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAdPlacementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetAdPlacementsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetAdPlacementsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetAdPlacementsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetAllUsersCharacters(
     ClientModels::FListUsersCharactersRequest& request,
     const FGetAllUsersCharactersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -632,29 +690,32 @@ bool UPlayFabClientAPI::GetAllUsersCharacters(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetAllUsersCharacters"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetAllUsersCharacters"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetAllUsersCharactersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FListUsersCharactersResult>> UPlayFabClientAPI::GetAllUsersCharactersAsync(ClientModels::FListUsersCharactersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FListUsersCharactersResult, FGetAllUsersCharactersDelegate>([this, &request, &Handle](const FGetAllUsersCharactersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetAllUsersCharacters(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetAllUsersCharactersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAllUsersCharactersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FListUsersCharactersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FListUsersCharactersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FListUsersCharactersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetCatalogItems(
     ClientModels::FGetCatalogItemsRequest& request,
     const FGetCatalogItemsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -663,29 +724,32 @@ bool UPlayFabClientAPI::GetCatalogItems(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCatalogItems"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCatalogItems"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetCatalogItemsResult>> UPlayFabClientAPI::GetCatalogItemsAsync(ClientModels::FGetCatalogItemsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetCatalogItemsResult, FGetCatalogItemsDelegate>([this, &request, &Handle](const FGetCatalogItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetCatalogItems(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetCatalogItemsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetCatalogItemsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetCatalogItemsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetCharacterData(
     ClientModels::FGetCharacterDataRequest& request,
     const FGetCharacterDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -694,29 +758,32 @@ bool UPlayFabClientAPI::GetCharacterData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterData"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCharacterDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetCharacterDataResult>> UPlayFabClientAPI::GetCharacterDataAsync(ClientModels::FGetCharacterDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetCharacterDataResult, FGetCharacterDataDelegate>([this, &request, &Handle](const FGetCharacterDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetCharacterData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetCharacterDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetCharacterDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetCharacterDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetCharacterDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetCharacterInventory(
     ClientModels::FGetCharacterInventoryRequest& request,
     const FGetCharacterInventoryDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -725,29 +792,32 @@ bool UPlayFabClientAPI::GetCharacterInventory(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterInventory"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterInventory"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCharacterInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetCharacterInventoryResult>> UPlayFabClientAPI::GetCharacterInventoryAsync(ClientModels::FGetCharacterInventoryRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetCharacterInventoryResult, FGetCharacterInventoryDelegate>([this, &request, &Handle](const FGetCharacterInventoryDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetCharacterInventory(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetCharacterInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetCharacterInventoryResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetCharacterInventoryResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetCharacterInventoryResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetCharacterLeaderboard(
     ClientModels::FGetCharacterLeaderboardRequest& request,
     const FGetCharacterLeaderboardDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -756,29 +826,32 @@ bool UPlayFabClientAPI::GetCharacterLeaderboard(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterLeaderboard"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterLeaderboard"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCharacterLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetCharacterLeaderboardResult>> UPlayFabClientAPI::GetCharacterLeaderboardAsync(ClientModels::FGetCharacterLeaderboardRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetCharacterLeaderboardResult, FGetCharacterLeaderboardDelegate>([this, &request, &Handle](const FGetCharacterLeaderboardDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetCharacterLeaderboard(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetCharacterLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetCharacterLeaderboardResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetCharacterLeaderboardResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetCharacterLeaderboardResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetCharacterReadOnlyData(
     ClientModels::FGetCharacterDataRequest& request,
     const FGetCharacterReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -787,29 +860,32 @@ bool UPlayFabClientAPI::GetCharacterReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterReadOnlyData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterReadOnlyData"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCharacterReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetCharacterDataResult>> UPlayFabClientAPI::GetCharacterReadOnlyDataAsync(ClientModels::FGetCharacterDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetCharacterDataResult, FGetCharacterReadOnlyDataDelegate>([this, &request, &Handle](const FGetCharacterReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetCharacterReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetCharacterReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetCharacterDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetCharacterDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetCharacterDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetCharacterStatistics(
     ClientModels::FGetCharacterStatisticsRequest& request,
     const FGetCharacterStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -818,29 +894,32 @@ bool UPlayFabClientAPI::GetCharacterStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterStatistics"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCharacterStatistics"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetCharacterStatisticsResult>> UPlayFabClientAPI::GetCharacterStatisticsAsync(ClientModels::FGetCharacterStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetCharacterStatisticsResult, FGetCharacterStatisticsDelegate>([this, &request, &Handle](const FGetCharacterStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetCharacterStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetCharacterStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetCharacterStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetCharacterStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetContentDownloadUrl(
     ClientModels::FGetContentDownloadUrlRequest& request,
     const FGetContentDownloadUrlDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -849,29 +928,32 @@ bool UPlayFabClientAPI::GetContentDownloadUrl(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetContentDownloadUrl"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetContentDownloadUrl"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetContentDownloadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetContentDownloadUrlResult>> UPlayFabClientAPI::GetContentDownloadUrlAsync(ClientModels::FGetContentDownloadUrlRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetContentDownloadUrlResult, FGetContentDownloadUrlDelegate>([this, &request, &Handle](const FGetContentDownloadUrlDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetContentDownloadUrl(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetContentDownloadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContentDownloadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetContentDownloadUrlResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetContentDownloadUrlResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetContentDownloadUrlResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetCurrentGames(
     ClientModels::FCurrentGamesRequest& request,
     const FGetCurrentGamesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -880,29 +962,32 @@ bool UPlayFabClientAPI::GetCurrentGames(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCurrentGames"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetCurrentGames"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetCurrentGamesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FCurrentGamesResult>> UPlayFabClientAPI::GetCurrentGamesAsync(ClientModels::FCurrentGamesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FCurrentGamesResult, FGetCurrentGamesDelegate>([this, &request, &Handle](const FGetCurrentGamesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetCurrentGames(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetCurrentGamesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCurrentGamesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FCurrentGamesResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FCurrentGamesResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FCurrentGamesResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetFriendLeaderboard(
     ClientModels::FGetFriendLeaderboardRequest& request,
     const FGetFriendLeaderboardDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -911,29 +996,32 @@ bool UPlayFabClientAPI::GetFriendLeaderboard(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetFriendLeaderboard"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetFriendLeaderboard"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetFriendLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetLeaderboardResult>> UPlayFabClientAPI::GetFriendLeaderboardAsync(ClientModels::FGetFriendLeaderboardRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetLeaderboardResult, FGetFriendLeaderboardDelegate>([this, &request, &Handle](const FGetFriendLeaderboardDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetFriendLeaderboard(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetFriendLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetLeaderboardResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetLeaderboardResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetLeaderboardResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetFriendLeaderboardAroundPlayer(
     ClientModels::FGetFriendLeaderboardAroundPlayerRequest& request,
     const FGetFriendLeaderboardAroundPlayerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -942,29 +1030,32 @@ bool UPlayFabClientAPI::GetFriendLeaderboardAroundPlayer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetFriendLeaderboardAroundPlayer"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetFriendLeaderboardAroundPlayer"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetFriendLeaderboardAroundPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetFriendLeaderboardAroundPlayerResult>> UPlayFabClientAPI::GetFriendLeaderboardAroundPlayerAsync(ClientModels::FGetFriendLeaderboardAroundPlayerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetFriendLeaderboardAroundPlayerResult, FGetFriendLeaderboardAroundPlayerDelegate>([this, &request, &Handle](const FGetFriendLeaderboardAroundPlayerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetFriendLeaderboardAroundPlayer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetFriendLeaderboardAroundPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendLeaderboardAroundPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetFriendLeaderboardAroundPlayerResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetFriendLeaderboardAroundPlayerResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetFriendLeaderboardAroundPlayerResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetFriendsList(
     ClientModels::FGetFriendsListRequest& request,
     const FGetFriendsListDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -973,29 +1064,32 @@ bool UPlayFabClientAPI::GetFriendsList(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetFriendsList"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetFriendsList"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetFriendsListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetFriendsListResult>> UPlayFabClientAPI::GetFriendsListAsync(ClientModels::FGetFriendsListRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetFriendsListResult, FGetFriendsListDelegate>([this, &request, &Handle](const FGetFriendsListDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetFriendsList(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetFriendsListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendsListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetFriendsListResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetFriendsListResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetFriendsListResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetGameServerRegions(
     ClientModels::FGameServerRegionsRequest& request,
     const FGetGameServerRegionsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1004,29 +1098,32 @@ bool UPlayFabClientAPI::GetGameServerRegions(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetGameServerRegions"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetGameServerRegions"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetGameServerRegionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGameServerRegionsResult>> UPlayFabClientAPI::GetGameServerRegionsAsync(ClientModels::FGameServerRegionsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGameServerRegionsResult, FGetGameServerRegionsDelegate>([this, &request, &Handle](const FGetGameServerRegionsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetGameServerRegions(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetGameServerRegionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetGameServerRegionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGameServerRegionsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGameServerRegionsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGameServerRegionsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetLeaderboard(
     ClientModels::FGetLeaderboardRequest& request,
     const FGetLeaderboardDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1035,29 +1132,32 @@ bool UPlayFabClientAPI::GetLeaderboard(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetLeaderboard"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetLeaderboard"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetLeaderboardResult>> UPlayFabClientAPI::GetLeaderboardAsync(ClientModels::FGetLeaderboardRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetLeaderboardResult, FGetLeaderboardDelegate>([this, &request, &Handle](const FGetLeaderboardDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetLeaderboard(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetLeaderboardResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetLeaderboardResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetLeaderboardResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetLeaderboardAroundCharacter(
     ClientModels::FGetLeaderboardAroundCharacterRequest& request,
     const FGetLeaderboardAroundCharacterDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1066,29 +1166,32 @@ bool UPlayFabClientAPI::GetLeaderboardAroundCharacter(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetLeaderboardAroundCharacter"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetLeaderboardAroundCharacter"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetLeaderboardAroundCharacterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetLeaderboardAroundCharacterResult>> UPlayFabClientAPI::GetLeaderboardAroundCharacterAsync(ClientModels::FGetLeaderboardAroundCharacterRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetLeaderboardAroundCharacterResult, FGetLeaderboardAroundCharacterDelegate>([this, &request, &Handle](const FGetLeaderboardAroundCharacterDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetLeaderboardAroundCharacter(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetLeaderboardAroundCharacterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardAroundCharacterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetLeaderboardAroundCharacterResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetLeaderboardAroundCharacterResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetLeaderboardAroundCharacterResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetLeaderboardAroundPlayer(
     ClientModels::FGetLeaderboardAroundPlayerRequest& request,
     const FGetLeaderboardAroundPlayerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1097,29 +1200,32 @@ bool UPlayFabClientAPI::GetLeaderboardAroundPlayer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetLeaderboardAroundPlayer"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetLeaderboardAroundPlayer"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetLeaderboardAroundPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetLeaderboardAroundPlayerResult>> UPlayFabClientAPI::GetLeaderboardAroundPlayerAsync(ClientModels::FGetLeaderboardAroundPlayerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetLeaderboardAroundPlayerResult, FGetLeaderboardAroundPlayerDelegate>([this, &request, &Handle](const FGetLeaderboardAroundPlayerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetLeaderboardAroundPlayer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetLeaderboardAroundPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardAroundPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetLeaderboardAroundPlayerResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetLeaderboardAroundPlayerResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetLeaderboardAroundPlayerResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetLeaderboardForUserCharacters(
     ClientModels::FGetLeaderboardForUsersCharactersRequest& request,
     const FGetLeaderboardForUserCharactersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1128,29 +1234,32 @@ bool UPlayFabClientAPI::GetLeaderboardForUserCharacters(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetLeaderboardForUserCharacters"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetLeaderboardForUserCharacters"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetLeaderboardForUserCharactersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetLeaderboardForUsersCharactersResult>> UPlayFabClientAPI::GetLeaderboardForUserCharactersAsync(ClientModels::FGetLeaderboardForUsersCharactersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetLeaderboardForUsersCharactersResult, FGetLeaderboardForUserCharactersDelegate>([this, &request, &Handle](const FGetLeaderboardForUserCharactersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetLeaderboardForUserCharacters(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetLeaderboardForUserCharactersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardForUserCharactersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetLeaderboardForUsersCharactersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetLeaderboardForUsersCharactersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetLeaderboardForUsersCharactersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPaymentToken(
     ClientModels::FGetPaymentTokenRequest& request,
     const FGetPaymentTokenDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1159,29 +1268,32 @@ bool UPlayFabClientAPI::GetPaymentToken(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPaymentToken"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPaymentToken"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPaymentTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPaymentTokenResult>> UPlayFabClientAPI::GetPaymentTokenAsync(ClientModels::FGetPaymentTokenRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPaymentTokenResult, FGetPaymentTokenDelegate>([this, &request, &Handle](const FGetPaymentTokenDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPaymentToken(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPaymentTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPaymentTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPaymentTokenResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPaymentTokenResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPaymentTokenResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPhotonAuthenticationToken(
     ClientModels::FGetPhotonAuthenticationTokenRequest& request,
     const FGetPhotonAuthenticationTokenDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1190,29 +1302,32 @@ bool UPlayFabClientAPI::GetPhotonAuthenticationToken(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPhotonAuthenticationToken"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPhotonAuthenticationToken"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPhotonAuthenticationTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPhotonAuthenticationTokenResult>> UPlayFabClientAPI::GetPhotonAuthenticationTokenAsync(ClientModels::FGetPhotonAuthenticationTokenRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPhotonAuthenticationTokenResult, FGetPhotonAuthenticationTokenDelegate>([this, &request, &Handle](const FGetPhotonAuthenticationTokenDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPhotonAuthenticationToken(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPhotonAuthenticationTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPhotonAuthenticationTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPhotonAuthenticationTokenResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPhotonAuthenticationTokenResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPhotonAuthenticationTokenResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPlayerCombinedInfo(
     ClientModels::FGetPlayerCombinedInfoRequest& request,
     const FGetPlayerCombinedInfoDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1221,29 +1336,32 @@ bool UPlayFabClientAPI::GetPlayerCombinedInfo(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerCombinedInfo"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerCombinedInfo"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerCombinedInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayerCombinedInfoResult>> UPlayFabClientAPI::GetPlayerCombinedInfoAsync(ClientModels::FGetPlayerCombinedInfoRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayerCombinedInfoResult, FGetPlayerCombinedInfoDelegate>([this, &request, &Handle](const FGetPlayerCombinedInfoDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPlayerCombinedInfo(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPlayerCombinedInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerCombinedInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayerCombinedInfoResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayerCombinedInfoResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayerCombinedInfoResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPlayerProfile(
     ClientModels::FGetPlayerProfileRequest& request,
     const FGetPlayerProfileDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1252,37 +1370,41 @@ bool UPlayFabClientAPI::GetPlayerProfile(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerProfile"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerProfile"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerProfileResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayerProfileResult>> UPlayFabClientAPI::GetPlayerProfileAsync(ClientModels::FGetPlayerProfileRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayerProfileResult, FGetPlayerProfileDelegate>([this, &request, &Handle](const FGetPlayerProfileDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPlayerProfile(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPlayerProfileResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerProfileDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayerProfileResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayerProfileResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayerProfileResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPlayerSegments(
     const FGetPlayerSegmentsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     ClientModels::FGetPlayerSegmentsRequest emptyRequest = ClientModels::FGetPlayerSegmentsRequest();
-    return UPlayFabClientAPI::GetPlayerSegments(emptyRequest, SuccessDelegate, ErrorDelegate);
+    return UPlayFabClientAPI::GetPlayerSegments(emptyRequest, SuccessDelegate, ErrorDelegate, Handle);
 }
 
 bool UPlayFabClientAPI::GetPlayerSegments(
     ClientModels::FGetPlayerSegmentsRequest& request,
     const FGetPlayerSegmentsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1291,29 +1413,38 @@ bool UPlayFabClientAPI::GetPlayerSegments(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerSegments"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerSegments"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayerSegmentsResult>> UPlayFabClientAPI::GetPlayerSegmentsAsync(const FPlayFabRequestHandle& Handle)
+{
+    ClientModels::FGetPlayerSegmentsRequest emptyRequest = ClientModels::FGetPlayerSegmentsRequest();
+    return UPlayFabClientAPI::GetPlayerSegmentsAsync(emptyRequest, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayerSegmentsResult>> UPlayFabClientAPI::GetPlayerSegmentsAsync(ClientModels::FGetPlayerSegmentsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayerSegmentsResult, FGetPlayerSegmentsDelegate>([this, &request, &Handle](const FGetPlayerSegmentsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPlayerSegments(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPlayerSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayerSegmentsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayerSegmentsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayerSegmentsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPlayerStatistics(
     ClientModels::FGetPlayerStatisticsRequest& request,
     const FGetPlayerStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1322,29 +1453,32 @@ bool UPlayFabClientAPI::GetPlayerStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerStatistics"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerStatistics"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayerStatisticsResult>> UPlayFabClientAPI::GetPlayerStatisticsAsync(ClientModels::FGetPlayerStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayerStatisticsResult, FGetPlayerStatisticsDelegate>([this, &request, &Handle](const FGetPlayerStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPlayerStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPlayerStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayerStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayerStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayerStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPlayerStatisticVersions(
     ClientModels::FGetPlayerStatisticVersionsRequest& request,
     const FGetPlayerStatisticVersionsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1353,29 +1487,32 @@ bool UPlayFabClientAPI::GetPlayerStatisticVersions(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerStatisticVersions"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerStatisticVersions"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerStatisticVersionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayerStatisticVersionsResult>> UPlayFabClientAPI::GetPlayerStatisticVersionsAsync(ClientModels::FGetPlayerStatisticVersionsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayerStatisticVersionsResult, FGetPlayerStatisticVersionsDelegate>([this, &request, &Handle](const FGetPlayerStatisticVersionsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPlayerStatisticVersions(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPlayerStatisticVersionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticVersionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayerStatisticVersionsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayerStatisticVersionsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayerStatisticVersionsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPlayerTags(
     ClientModels::FGetPlayerTagsRequest& request,
     const FGetPlayerTagsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1384,29 +1521,32 @@ bool UPlayFabClientAPI::GetPlayerTags(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerTags"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerTags"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayerTagsResult>> UPlayFabClientAPI::GetPlayerTagsAsync(ClientModels::FGetPlayerTagsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayerTagsResult, FGetPlayerTagsDelegate>([this, &request, &Handle](const FGetPlayerTagsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPlayerTags(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPlayerTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayerTagsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayerTagsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayerTagsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPlayerTrades(
     ClientModels::FGetPlayerTradesRequest& request,
     const FGetPlayerTradesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1415,29 +1555,32 @@ bool UPlayFabClientAPI::GetPlayerTrades(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerTrades"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayerTrades"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayerTradesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayerTradesResponse>> UPlayFabClientAPI::GetPlayerTradesAsync(ClientModels::FGetPlayerTradesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayerTradesResponse, FGetPlayerTradesDelegate>([this, &request, &Handle](const FGetPlayerTradesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPlayerTrades(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPlayerTradesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerTradesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayerTradesResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayerTradesResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayerTradesResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPlayFabIDsFromFacebookIDs(
     ClientModels::FGetPlayFabIDsFromFacebookIDsRequest& request,
     const FGetPlayFabIDsFromFacebookIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1446,29 +1589,32 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromFacebookIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromFacebookIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromFacebookIDs"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromFacebookIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromFacebookIDsResult>> UPlayFabClientAPI::GetPlayFabIDsFromFacebookIDsAsync(ClientModels::FGetPlayFabIDsFromFacebookIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromFacebookIDsResult, FGetPlayFabIDsFromFacebookIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromFacebookIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPlayFabIDsFromFacebookIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromFacebookIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromFacebookIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromFacebookIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromFacebookIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromFacebookIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
     ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& request,
     const FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1477,29 +1623,32 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromFacebookInstantGamesIds"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromFacebookInstantGamesIds"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult>> UPlayFabClientAPI::GetPlayFabIDsFromFacebookInstantGamesIdsAsync(ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult, FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPlayFabIDsFromFacebookInstantGamesIds(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPlayFabIDsFromGameCenterIDs(
     ClientModels::FGetPlayFabIDsFromGameCenterIDsRequest& request,
     const FGetPlayFabIDsFromGameCenterIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1508,29 +1657,32 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromGameCenterIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromGameCenterIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromGameCenterIDs"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromGameCenterIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromGameCenterIDsResult>> UPlayFabClientAPI::GetPlayFabIDsFromGameCenterIDsAsync(ClientModels::FGetPlayFabIDsFromGameCenterIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromGameCenterIDsResult, FGetPlayFabIDsFromGameCenterIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromGameCenterIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPlayFabIDsFromGameCenterIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromGameCenterIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGameCenterIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromGameCenterIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromGameCenterIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromGameCenterIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPlayFabIDsFromGenericIDs(
     ClientModels::FGetPlayFabIDsFromGenericIDsRequest& request,
     const FGetPlayFabIDsFromGenericIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1539,29 +1691,32 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromGenericIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromGenericIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromGenericIDs"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromGenericIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromGenericIDsResult>> UPlayFabClientAPI::GetPlayFabIDsFromGenericIDsAsync(ClientModels::FGetPlayFabIDsFromGenericIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromGenericIDsResult, FGetPlayFabIDsFromGenericIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromGenericIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPlayFabIDsFromGenericIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromGenericIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGenericIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromGenericIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromGenericIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromGenericIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPlayFabIDsFromGoogleIDs(
     ClientModels::FGetPlayFabIDsFromGoogleIDsRequest& request,
     const FGetPlayFabIDsFromGoogleIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1570,29 +1725,32 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromGoogleIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromGoogleIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromGoogleIDs"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromGoogleIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromGoogleIDsResult>> UPlayFabClientAPI::GetPlayFabIDsFromGoogleIDsAsync(ClientModels::FGetPlayFabIDsFromGoogleIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromGoogleIDsResult, FGetPlayFabIDsFromGoogleIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromGoogleIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPlayFabIDsFromGoogleIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromGoogleIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGoogleIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromGoogleIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromGoogleIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromGoogleIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPlayFabIDsFromKongregateIDs(
     ClientModels::FGetPlayFabIDsFromKongregateIDsRequest& request,
     const FGetPlayFabIDsFromKongregateIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1601,29 +1759,32 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromKongregateIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromKongregateIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromKongregateIDs"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromKongregateIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromKongregateIDsResult>> UPlayFabClientAPI::GetPlayFabIDsFromKongregateIDsAsync(ClientModels::FGetPlayFabIDsFromKongregateIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromKongregateIDsResult, FGetPlayFabIDsFromKongregateIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromKongregateIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPlayFabIDsFromKongregateIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromKongregateIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromKongregateIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromKongregateIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromKongregateIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromKongregateIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
     ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& request,
     const FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1632,29 +1793,32 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromNintendoSwitchDeviceIds"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromNintendoSwitchDeviceIds"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult>> UPlayFabClientAPI::GetPlayFabIDsFromNintendoSwitchDeviceIdsAsync(ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult, FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPlayFabIDsFromPSNAccountIDs(
     ClientModels::FGetPlayFabIDsFromPSNAccountIDsRequest& request,
     const FGetPlayFabIDsFromPSNAccountIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1663,29 +1827,32 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromPSNAccountIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromPSNAccountIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromPSNAccountIDs"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromPSNAccountIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult>> UPlayFabClientAPI::GetPlayFabIDsFromPSNAccountIDsAsync(ClientModels::FGetPlayFabIDsFromPSNAccountIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult, FGetPlayFabIDsFromPSNAccountIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromPSNAccountIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPlayFabIDsFromPSNAccountIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromPSNAccountIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromPSNAccountIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPlayFabIDsFromSteamIDs(
     ClientModels::FGetPlayFabIDsFromSteamIDsRequest& request,
     const FGetPlayFabIDsFromSteamIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1694,29 +1861,32 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromSteamIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromSteamIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromSteamIDs"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromSteamIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromSteamIDsResult>> UPlayFabClientAPI::GetPlayFabIDsFromSteamIDsAsync(ClientModels::FGetPlayFabIDsFromSteamIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromSteamIDsResult, FGetPlayFabIDsFromSteamIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromSteamIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPlayFabIDsFromSteamIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromSteamIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromSteamIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromSteamIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromSteamIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromSteamIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPlayFabIDsFromTwitchIDs(
     ClientModels::FGetPlayFabIDsFromTwitchIDsRequest& request,
     const FGetPlayFabIDsFromTwitchIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1725,29 +1895,32 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromTwitchIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromTwitchIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromTwitchIDs"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromTwitchIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromTwitchIDsResult>> UPlayFabClientAPI::GetPlayFabIDsFromTwitchIDsAsync(ClientModels::FGetPlayFabIDsFromTwitchIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromTwitchIDsResult, FGetPlayFabIDsFromTwitchIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromTwitchIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPlayFabIDsFromTwitchIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromTwitchIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromTwitchIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromTwitchIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromTwitchIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromTwitchIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPlayFabIDsFromXboxLiveIDs(
     ClientModels::FGetPlayFabIDsFromXboxLiveIDsRequest& request,
     const FGetPlayFabIDsFromXboxLiveIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1756,29 +1929,32 @@ bool UPlayFabClientAPI::GetPlayFabIDsFromXboxLiveIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromXboxLiveIDs"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPlayFabIDsFromXboxLiveIDs"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPlayFabIDsFromXboxLiveIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult>> UPlayFabClientAPI::GetPlayFabIDsFromXboxLiveIDsAsync(ClientModels::FGetPlayFabIDsFromXboxLiveIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult, FGetPlayFabIDsFromXboxLiveIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromXboxLiveIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPlayFabIDsFromXboxLiveIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPlayFabIDsFromXboxLiveIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromXboxLiveIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPublisherData(
     ClientModels::FGetPublisherDataRequest& request,
     const FGetPublisherDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1787,29 +1963,32 @@ bool UPlayFabClientAPI::GetPublisherData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPublisherData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPublisherData"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPublisherDataResult>> UPlayFabClientAPI::GetPublisherDataAsync(ClientModels::FGetPublisherDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPublisherDataResult, FGetPublisherDataDelegate>([this, &request, &Handle](const FGetPublisherDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPublisherData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPublisherDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPublisherDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPublisherDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetPurchase(
     ClientModels::FGetPurchaseRequest& request,
     const FGetPurchaseDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1818,29 +1997,32 @@ bool UPlayFabClientAPI::GetPurchase(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPurchase"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetPurchase"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
+    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetPurchaseResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPurchaseResult>> UPlayFabClientAPI::GetPurchaseAsync(ClientModels::FGetPurchaseRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPurchaseResult, FGetPurchaseDelegate>([this, &request, &Handle](const FGetPurchaseDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetPurchase(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPurchaseResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPurchaseResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPurchaseResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetSharedGroupData(
     ClientModels::FGetSharedGroupDataRequest& request,
     const FGetSharedGroupDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1849,29 +2031,32 @@ bool UPlayFabClientAPI::GetSharedGroupData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetSharedGroupData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetSharedGroupData"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetSharedGroupDataResult>> UPlayFabClientAPI::GetSharedGroupDataAsync(ClientModels::FGetSharedGroupDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetSharedGroupDataResult, FGetSharedGroupDataDelegate>([this, &request, &Handle](const FGetSharedGroupDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetSharedGroupData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetSharedGroupDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSharedGroupDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetSharedGroupDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetSharedGroupDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetSharedGroupDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetStoreItems(
     ClientModels::FGetStoreItemsRequest& request,
     const FGetStoreItemsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1880,37 +2065,41 @@ bool UPlayFabClientAPI::GetStoreItems(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetStoreItems"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetStoreItems"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetStoreItemsResult>> UPlayFabClientAPI::GetStoreItemsAsync(ClientModels::FGetStoreItemsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetStoreItemsResult, FGetStoreItemsDelegate>([this, &request, &Handle](const FGetStoreItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetStoreItems(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetStoreItemsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetStoreItemsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetStoreItemsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetTime(
     const FGetTimeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     ClientModels::FGetTimeRequest emptyRequest = ClientModels::FGetTimeRequest();
-    return UPlayFabClientAPI::GetTime(emptyRequest, SuccessDelegate, ErrorDelegate);
+    return UPlayFabClientAPI::GetTime(emptyRequest, SuccessDelegate, ErrorDelegate, Handle);
 }
 
 bool UPlayFabClientAPI::GetTime(
     ClientModels::FGetTimeRequest& request,
     const FGetTimeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1919,29 +2108,38 @@ bool UPlayFabClientAPI::GetTime(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTime"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTime"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetTimeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetTimeResult>> UPlayFabClientAPI::GetTimeAsync(const FPlayFabRequestHandle& Handle)
+{
+    ClientModels::FGetTimeRequest emptyRequest = ClientModels::FGetTimeRequest();
+    return UPlayFabClientAPI::GetTimeAsync(emptyRequest, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetTimeResult>> UPlayFabClientAPI::GetTimeAsync(ClientModels::FGetTimeRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetTimeResult, FGetTimeDelegate>([this, &request, &Handle](const FGetTimeDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetTime(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetTimeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTimeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetTimeResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetTimeResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetTimeResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetTitleData(
     ClientModels::FGetTitleDataRequest& request,
     const FGetTitleDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1950,29 +2148,32 @@ bool UPlayFabClientAPI::GetTitleData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTitleData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTitleData"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetTitleDataResult>> UPlayFabClientAPI::GetTitleDataAsync(ClientModels::FGetTitleDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetTitleDataResult, FGetTitleDataDelegate>([this, &request, &Handle](const FGetTitleDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetTitleData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetTitleDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetTitleDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetTitleDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetTitleNews(
     ClientModels::FGetTitleNewsRequest& request,
     const FGetTitleNewsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -1981,55 +2182,61 @@ bool UPlayFabClientAPI::GetTitleNews(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTitleNews"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTitleNews"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetTitleNewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetTitleNewsResult>> UPlayFabClientAPI::GetTitleNewsAsync(ClientModels::FGetTitleNewsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetTitleNewsResult, FGetTitleNewsDelegate>([this, &request, &Handle](const FGetTitleNewsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetTitleNews(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetTitleNewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleNewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetTitleNewsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetTitleNewsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetTitleNewsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetTitlePublicKey(
     ClientModels::FGetTitlePublicKeyRequest& request,
     const FGetTitlePublicKeyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTitlePublicKey"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTitlePublicKey"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetTitlePublicKeyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetTitlePublicKeyResult>> UPlayFabClientAPI::GetTitlePublicKeyAsync(ClientModels::FGetTitlePublicKeyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetTitlePublicKeyResult, FGetTitlePublicKeyDelegate>([this, &request, &Handle](const FGetTitlePublicKeyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetTitlePublicKey(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetTitlePublicKeyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitlePublicKeyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetTitlePublicKeyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetTitlePublicKeyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetTitlePublicKeyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetTradeStatus(
     ClientModels::FGetTradeStatusRequest& request,
     const FGetTradeStatusDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2038,29 +2245,32 @@ bool UPlayFabClientAPI::GetTradeStatus(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTradeStatus"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetTradeStatus"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetTradeStatusResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetTradeStatusResponse>> UPlayFabClientAPI::GetTradeStatusAsync(ClientModels::FGetTradeStatusRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetTradeStatusResponse, FGetTradeStatusDelegate>([this, &request, &Handle](const FGetTradeStatusDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetTradeStatus(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetTradeStatusResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTradeStatusDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetTradeStatusResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetTradeStatusResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetTradeStatusResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetUserData(
     ClientModels::FGetUserDataRequest& request,
     const FGetUserDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2069,29 +2279,32 @@ bool UPlayFabClientAPI::GetUserData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserData"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetUserDataResult>> UPlayFabClientAPI::GetUserDataAsync(ClientModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetUserDataResult, FGetUserDataDelegate>([this, &request, &Handle](const FGetUserDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetUserData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetUserInventory(
     ClientModels::FGetUserInventoryRequest& request,
     const FGetUserInventoryDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2100,29 +2313,32 @@ bool UPlayFabClientAPI::GetUserInventory(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserInventory"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserInventory"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetUserInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetUserInventoryResult>> UPlayFabClientAPI::GetUserInventoryAsync(ClientModels::FGetUserInventoryRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetUserInventoryResult, FGetUserInventoryDelegate>([this, &request, &Handle](const FGetUserInventoryDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetUserInventory(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetUserInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetUserInventoryResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetUserInventoryResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetUserInventoryResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetUserPublisherData(
     ClientModels::FGetUserDataRequest& request,
     const FGetUserPublisherDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2131,29 +2347,32 @@ bool UPlayFabClientAPI::GetUserPublisherData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserPublisherData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserPublisherData"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetUserDataResult>> UPlayFabClientAPI::GetUserPublisherDataAsync(ClientModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetUserDataResult, FGetUserPublisherDataDelegate>([this, &request, &Handle](const FGetUserPublisherDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetUserPublisherData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetUserPublisherReadOnlyData(
     ClientModels::FGetUserDataRequest& request,
     const FGetUserPublisherReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2162,29 +2381,32 @@ bool UPlayFabClientAPI::GetUserPublisherReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserPublisherReadOnlyData"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetUserDataResult>> UPlayFabClientAPI::GetUserPublisherReadOnlyDataAsync(ClientModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetUserDataResult, FGetUserPublisherReadOnlyDataDelegate>([this, &request, &Handle](const FGetUserPublisherReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetUserPublisherReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetUserReadOnlyData(
     ClientModels::FGetUserDataRequest& request,
     const FGetUserReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2193,55 +2415,61 @@ bool UPlayFabClientAPI::GetUserReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserReadOnlyData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetUserReadOnlyData"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetUserDataResult>> UPlayFabClientAPI::GetUserReadOnlyDataAsync(ClientModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetUserDataResult, FGetUserReadOnlyDataDelegate>([this, &request, &Handle](const FGetUserReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetUserReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GetWindowsHelloChallenge(
     ClientModels::FGetWindowsHelloChallengeRequest& request,
     const FGetWindowsHelloChallengeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetWindowsHelloChallenge"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GetWindowsHelloChallenge"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGetWindowsHelloChallengeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetWindowsHelloChallengeResponse>> UPlayFabClientAPI::GetWindowsHelloChallengeAsync(ClientModels::FGetWindowsHelloChallengeRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetWindowsHelloChallengeResponse, FGetWindowsHelloChallengeDelegate>([this, &request, &Handle](const FGetWindowsHelloChallengeDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GetWindowsHelloChallenge(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGetWindowsHelloChallengeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetWindowsHelloChallengeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetWindowsHelloChallengeResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetWindowsHelloChallengeResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetWindowsHelloChallengeResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::GrantCharacterToUser(
     ClientModels::FGrantCharacterToUserRequest& request,
     const FGrantCharacterToUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2250,29 +2478,32 @@ bool UPlayFabClientAPI::GrantCharacterToUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GrantCharacterToUser"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/GrantCharacterToUser"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnGrantCharacterToUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGrantCharacterToUserResult>> UPlayFabClientAPI::GrantCharacterToUserAsync(ClientModels::FGrantCharacterToUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGrantCharacterToUserResult, FGrantCharacterToUserDelegate>([this, &request, &Handle](const FGrantCharacterToUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::GrantCharacterToUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnGrantCharacterToUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantCharacterToUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGrantCharacterToUserResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGrantCharacterToUserResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGrantCharacterToUserResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::LinkAndroidDeviceID(
     ClientModels::FLinkAndroidDeviceIDRequest& request,
     const FLinkAndroidDeviceIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2281,29 +2512,32 @@ bool UPlayFabClientAPI::LinkAndroidDeviceID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkAndroidDeviceID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkAndroidDeviceID"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkAndroidDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkAndroidDeviceIDResult>> UPlayFabClientAPI::LinkAndroidDeviceIDAsync(ClientModels::FLinkAndroidDeviceIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkAndroidDeviceIDResult, FLinkAndroidDeviceIDDelegate>([this, &request, &Handle](const FLinkAndroidDeviceIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LinkAndroidDeviceID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLinkAndroidDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkAndroidDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkAndroidDeviceIDResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkAndroidDeviceIDResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkAndroidDeviceIDResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::LinkApple(
     ClientModels::FLinkAppleRequest& request,
     const FLinkAppleDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2312,29 +2546,32 @@ bool UPlayFabClientAPI::LinkApple(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkApple"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkApple"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FEmptyResult>> UPlayFabClientAPI::LinkAppleAsync(ClientModels::FLinkAppleRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FEmptyResult, FLinkAppleDelegate>([this, &request, &Handle](const FLinkAppleDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LinkApple(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLinkAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FEmptyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FEmptyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FEmptyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::LinkCustomID(
     ClientModels::FLinkCustomIDRequest& request,
     const FLinkCustomIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2343,29 +2580,32 @@ bool UPlayFabClientAPI::LinkCustomID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkCustomID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkCustomID"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkCustomIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkCustomIDResult>> UPlayFabClientAPI::LinkCustomIDAsync(ClientModels::FLinkCustomIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkCustomIDResult, FLinkCustomIDDelegate>([this, &request, &Handle](const FLinkCustomIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LinkCustomID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLinkCustomIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkCustomIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkCustomIDResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkCustomIDResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkCustomIDResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::LinkFacebookAccount(
     ClientModels::FLinkFacebookAccountRequest& request,
     const FLinkFacebookAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2374,29 +2614,32 @@ bool UPlayFabClientAPI::LinkFacebookAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkFacebookAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkFacebookAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkFacebookAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkFacebookAccountResult>> UPlayFabClientAPI::LinkFacebookAccountAsync(ClientModels::FLinkFacebookAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkFacebookAccountResult, FLinkFacebookAccountDelegate>([this, &request, &Handle](const FLinkFacebookAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LinkFacebookAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLinkFacebookAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkFacebookAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkFacebookAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkFacebookAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkFacebookAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::LinkFacebookInstantGamesId(
     ClientModels::FLinkFacebookInstantGamesIdRequest& request,
     const FLinkFacebookInstantGamesIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2405,29 +2648,32 @@ bool UPlayFabClientAPI::LinkFacebookInstantGamesId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkFacebookInstantGamesId"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkFacebookInstantGamesId"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkFacebookInstantGamesIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkFacebookInstantGamesIdResult>> UPlayFabClientAPI::LinkFacebookInstantGamesIdAsync(ClientModels::FLinkFacebookInstantGamesIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkFacebookInstantGamesIdResult, FLinkFacebookInstantGamesIdDelegate>([this, &request, &Handle](const FLinkFacebookInstantGamesIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LinkFacebookInstantGamesId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLinkFacebookInstantGamesIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkFacebookInstantGamesIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkFacebookInstantGamesIdResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkFacebookInstantGamesIdResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkFacebookInstantGamesIdResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::LinkGameCenterAccount(
     ClientModels::FLinkGameCenterAccountRequest& request,
     const FLinkGameCenterAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2436,29 +2682,32 @@ bool UPlayFabClientAPI::LinkGameCenterAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkGameCenterAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkGameCenterAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkGameCenterAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkGameCenterAccountResult>> UPlayFabClientAPI::LinkGameCenterAccountAsync(ClientModels::FLinkGameCenterAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkGameCenterAccountResult, FLinkGameCenterAccountDelegate>([this, &request, &Handle](const FLinkGameCenterAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LinkGameCenterAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLinkGameCenterAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkGameCenterAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkGameCenterAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkGameCenterAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkGameCenterAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::LinkGoogleAccount(
     ClientModels::FLinkGoogleAccountRequest& request,
     const FLinkGoogleAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2467,29 +2716,32 @@ bool UPlayFabClientAPI::LinkGoogleAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkGoogleAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkGoogleAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkGoogleAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkGoogleAccountResult>> UPlayFabClientAPI::LinkGoogleAccountAsync(ClientModels::FLinkGoogleAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkGoogleAccountResult, FLinkGoogleAccountDelegate>([this, &request, &Handle](const FLinkGoogleAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LinkGoogleAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLinkGoogleAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkGoogleAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkGoogleAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkGoogleAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkGoogleAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::LinkIOSDeviceID(
     ClientModels::FLinkIOSDeviceIDRequest& request,
     const FLinkIOSDeviceIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2498,29 +2750,32 @@ bool UPlayFabClientAPI::LinkIOSDeviceID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkIOSDeviceID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkIOSDeviceID"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkIOSDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkIOSDeviceIDResult>> UPlayFabClientAPI::LinkIOSDeviceIDAsync(ClientModels::FLinkIOSDeviceIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkIOSDeviceIDResult, FLinkIOSDeviceIDDelegate>([this, &request, &Handle](const FLinkIOSDeviceIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LinkIOSDeviceID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLinkIOSDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkIOSDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkIOSDeviceIDResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkIOSDeviceIDResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkIOSDeviceIDResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::LinkKongregate(
     ClientModels::FLinkKongregateAccountRequest& request,
     const FLinkKongregateDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2529,29 +2784,32 @@ bool UPlayFabClientAPI::LinkKongregate(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkKongregate"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkKongregate"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkKongregateAccountResult>> UPlayFabClientAPI::LinkKongregateAsync(ClientModels::FLinkKongregateAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkKongregateAccountResult, FLinkKongregateDelegate>([this, &request, &Handle](const FLinkKongregateDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LinkKongregate(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLinkKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkKongregateAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkKongregateAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkKongregateAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::LinkNintendoServiceAccount(
     ClientModels::FLinkNintendoServiceAccountRequest& request,
     const FLinkNintendoServiceAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2560,29 +2818,32 @@ bool UPlayFabClientAPI::LinkNintendoServiceAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkNintendoServiceAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkNintendoServiceAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FEmptyResult>> UPlayFabClientAPI::LinkNintendoServiceAccountAsync(ClientModels::FLinkNintendoServiceAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FEmptyResult, FLinkNintendoServiceAccountDelegate>([this, &request, &Handle](const FLinkNintendoServiceAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LinkNintendoServiceAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLinkNintendoServiceAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkNintendoServiceAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FEmptyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FEmptyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FEmptyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::LinkNintendoSwitchDeviceId(
     ClientModels::FLinkNintendoSwitchDeviceIdRequest& request,
     const FLinkNintendoSwitchDeviceIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2591,29 +2852,32 @@ bool UPlayFabClientAPI::LinkNintendoSwitchDeviceId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkNintendoSwitchDeviceId"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkNintendoSwitchDeviceId"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkNintendoSwitchDeviceIdResult>> UPlayFabClientAPI::LinkNintendoSwitchDeviceIdAsync(ClientModels::FLinkNintendoSwitchDeviceIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkNintendoSwitchDeviceIdResult, FLinkNintendoSwitchDeviceIdDelegate>([this, &request, &Handle](const FLinkNintendoSwitchDeviceIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LinkNintendoSwitchDeviceId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLinkNintendoSwitchDeviceIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkNintendoSwitchDeviceIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkNintendoSwitchDeviceIdResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkNintendoSwitchDeviceIdResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkNintendoSwitchDeviceIdResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::LinkOpenIdConnect(
     ClientModels::FLinkOpenIdConnectRequest& request,
     const FLinkOpenIdConnectDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2622,29 +2886,32 @@ bool UPlayFabClientAPI::LinkOpenIdConnect(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkOpenIdConnect"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkOpenIdConnect"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkOpenIdConnectResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FEmptyResult>> UPlayFabClientAPI::LinkOpenIdConnectAsync(ClientModels::FLinkOpenIdConnectRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FEmptyResult, FLinkOpenIdConnectDelegate>([this, &request, &Handle](const FLinkOpenIdConnectDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LinkOpenIdConnect(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLinkOpenIdConnectResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkOpenIdConnectDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FEmptyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FEmptyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FEmptyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::LinkPSNAccount(
     ClientModels::FLinkPSNAccountRequest& request,
     const FLinkPSNAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2653,29 +2920,32 @@ bool UPlayFabClientAPI::LinkPSNAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkPSNAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkPSNAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkPSNAccountResult>> UPlayFabClientAPI::LinkPSNAccountAsync(ClientModels::FLinkPSNAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkPSNAccountResult, FLinkPSNAccountDelegate>([this, &request, &Handle](const FLinkPSNAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LinkPSNAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLinkPSNAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkPSNAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkPSNAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkPSNAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkPSNAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::LinkSteamAccount(
     ClientModels::FLinkSteamAccountRequest& request,
     const FLinkSteamAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2684,29 +2954,32 @@ bool UPlayFabClientAPI::LinkSteamAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkSteamAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkSteamAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkSteamAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkSteamAccountResult>> UPlayFabClientAPI::LinkSteamAccountAsync(ClientModels::FLinkSteamAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkSteamAccountResult, FLinkSteamAccountDelegate>([this, &request, &Handle](const FLinkSteamAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LinkSteamAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLinkSteamAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkSteamAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkSteamAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkSteamAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkSteamAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::LinkTwitch(
     ClientModels::FLinkTwitchAccountRequest& request,
     const FLinkTwitchDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2715,29 +2988,32 @@ bool UPlayFabClientAPI::LinkTwitch(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkTwitch"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkTwitch"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkTwitchAccountResult>> UPlayFabClientAPI::LinkTwitchAsync(ClientModels::FLinkTwitchAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkTwitchAccountResult, FLinkTwitchDelegate>([this, &request, &Handle](const FLinkTwitchDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LinkTwitch(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLinkTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkTwitchAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkTwitchAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkTwitchAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::LinkWindowsHello(
     ClientModels::FLinkWindowsHelloAccountRequest& request,
     const FLinkWindowsHelloDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2746,29 +3022,32 @@ bool UPlayFabClientAPI::LinkWindowsHello(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkWindowsHello"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkWindowsHello"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkWindowsHelloResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkWindowsHelloAccountResponse>> UPlayFabClientAPI::LinkWindowsHelloAsync(ClientModels::FLinkWindowsHelloAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkWindowsHelloAccountResponse, FLinkWindowsHelloDelegate>([this, &request, &Handle](const FLinkWindowsHelloDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LinkWindowsHello(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLinkWindowsHelloResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkWindowsHelloDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkWindowsHelloAccountResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkWindowsHelloAccountResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkWindowsHelloAccountResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::LinkXboxAccount(
     ClientModels::FLinkXboxAccountRequest& request,
     const FLinkXboxAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -2777,44 +3056,53 @@ bool UPlayFabClientAPI::LinkXboxAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkXboxAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LinkXboxAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkXboxAccountResult>> UPlayFabClientAPI::LinkXboxAccountAsync(ClientModels::FLinkXboxAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkXboxAccountResult, FLinkXboxAccountDelegate>([this, &request, &Handle](const FLinkXboxAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LinkXboxAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLinkXboxAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkXboxAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkXboxAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkXboxAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkXboxAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::LoginWithAndroidDeviceID(
     ClientModels::FLoginWithAndroidDeviceIDRequest& request,
     const FLoginWithAndroidDeviceIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithAndroidDeviceID"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithAndroidDeviceID"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithAndroidDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithAndroidDeviceIDAsync(ClientModels::FLoginWithAndroidDeviceIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithAndroidDeviceIDDelegate>([this, &request, &Handle](const FLoginWithAndroidDeviceIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithAndroidDeviceID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithAndroidDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithAndroidDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -2830,32 +3118,35 @@ void UPlayFabClientAPI::OnLoginWithAndroidDeviceIDResult(FHttpRequestPtr HttpReq
         }
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::LoginWithApple(
     ClientModels::FLoginWithAppleRequest& request,
     const FLoginWithAppleDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithApple"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithApple"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithAppleAsync(ClientModels::FLoginWithAppleRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithAppleDelegate>([this, &request, &Handle](const FLoginWithAppleDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithApple(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -2871,32 +3162,35 @@ void UPlayFabClientAPI::OnLoginWithAppleResult(FHttpRequestPtr HttpRequest, FHtt
         }
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::LoginWithCustomID(
     ClientModels::FLoginWithCustomIDRequest& request,
     const FLoginWithCustomIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithCustomID"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithCustomID"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithCustomIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithCustomIDAsync(ClientModels::FLoginWithCustomIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithCustomIDDelegate>([this, &request, &Handle](const FLoginWithCustomIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithCustomID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithCustomIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithCustomIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -2912,32 +3206,35 @@ void UPlayFabClientAPI::OnLoginWithCustomIDResult(FHttpRequestPtr HttpRequest, F
         }
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::LoginWithEmailAddress(
     ClientModels::FLoginWithEmailAddressRequest& request,
     const FLoginWithEmailAddressDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithEmailAddress"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithEmailAddress"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithEmailAddressResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithEmailAddressAsync(ClientModels::FLoginWithEmailAddressRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithEmailAddressDelegate>([this, &request, &Handle](const FLoginWithEmailAddressDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithEmailAddress(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithEmailAddressResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithEmailAddressDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -2952,33 +3249,36 @@ void UPlayFabClientAPI::OnLoginWithEmailAddressResult(FHttpRequestPtr HttpReques
             outResult.AuthenticationContext->SetPlayFabId(outResult.PlayFabId);
         }
 
-        SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+        SuccessDelegate.ExecuteIfBound(outResult);
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::LoginWithFacebook(
     ClientModels::FLoginWithFacebookRequest& request,
     const FLoginWithFacebookDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithFacebook"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithFacebook"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithFacebookResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithFacebookAsync(ClientModels::FLoginWithFacebookRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithFacebookDelegate>([this, &request, &Handle](const FLoginWithFacebookDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithFacebook(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithFacebookResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithFacebookDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -2994,32 +3294,35 @@ void UPlayFabClientAPI::OnLoginWithFacebookResult(FHttpRequestPtr HttpRequest, F
         }
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::LoginWithFacebookInstantGamesId(
     ClientModels::FLoginWithFacebookInstantGamesIdRequest& request,
     const FLoginWithFacebookInstantGamesIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithFacebookInstantGamesId"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithFacebookInstantGamesId"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithFacebookInstantGamesIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithFacebookInstantGamesIdAsync(ClientModels::FLoginWithFacebookInstantGamesIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithFacebookInstantGamesIdDelegate>([this, &request, &Handle](const FLoginWithFacebookInstantGamesIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithFacebookInstantGamesId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithFacebookInstantGamesIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithFacebookInstantGamesIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3035,32 +3338,35 @@ void UPlayFabClientAPI::OnLoginWithFacebookInstantGamesIdResult(FHttpRequestPtr
         }
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::LoginWithGameCenter(
     ClientModels::FLoginWithGameCenterRequest& request,
     const FLoginWithGameCenterDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithGameCenter"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithGameCenter"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithGameCenterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithGameCenterAsync(ClientModels::FLoginWithGameCenterRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithGameCenterDelegate>([this, &request, &Handle](const FLoginWithGameCenterDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithGameCenter(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithGameCenterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithGameCenterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3077,32 +3383,35 @@ void UPlayFabClientAPI::OnLoginWithGameCenterResult(FHttpRequestPtr HttpRequest,
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::LoginWithGoogleAccount(
     ClientModels::FLoginWithGoogleAccountRequest& request,
     const FLoginWithGoogleAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithGoogleAccount"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithGoogleAccount"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithGoogleAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithGoogleAccountAsync(ClientModels::FLoginWithGoogleAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithGoogleAccountDelegate>([this, &request, &Handle](const FLoginWithGoogleAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithGoogleAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithGoogleAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithGoogleAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3119,32 +3428,35 @@ void UPlayFabClientAPI::OnLoginWithGoogleAccountResult(FHttpRequestPtr HttpReque
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::LoginWithIOSDeviceID(
     ClientModels::FLoginWithIOSDeviceIDRequest& request,
     const FLoginWithIOSDeviceIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithIOSDeviceID"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithIOSDeviceID"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithIOSDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithIOSDeviceIDAsync(ClientModels::FLoginWithIOSDeviceIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithIOSDeviceIDDelegate>([this, &request, &Handle](const FLoginWithIOSDeviceIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithIOSDeviceID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithIOSDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithIOSDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3161,32 +3473,35 @@ void UPlayFabClientAPI::OnLoginWithIOSDeviceIDResult(FHttpRequestPtr HttpRequest
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::LoginWithKongregate(
     ClientModels::FLoginWithKongregateRequest& request,
     const FLoginWithKongregateDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithKongregate"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithKongregate"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithKongregateAsync(ClientModels::FLoginWithKongregateRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithKongregateDelegate>([this, &request, &Handle](const FLoginWithKongregateDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithKongregate(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3203,32 +3518,35 @@ void UPlayFabClientAPI::OnLoginWithKongregateResult(FHttpRequestPtr HttpRequest,
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::LoginWithNintendoServiceAccount(
     ClientModels::FLoginWithNintendoServiceAccountRequest& request,
     const FLoginWithNintendoServiceAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithNintendoServiceAccount"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithNintendoServiceAccount"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithNintendoServiceAccountAsync(ClientModels::FLoginWithNintendoServiceAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithNintendoServiceAccountDelegate>([this, &request, &Handle](const FLoginWithNintendoServiceAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithNintendoServiceAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithNintendoServiceAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithNintendoServiceAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3245,32 +3563,35 @@ void UPlayFabClientAPI::OnLoginWithNintendoServiceAccountResult(FHttpRequestPtr
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::LoginWithNintendoSwitchDeviceId(
     ClientModels::FLoginWithNintendoSwitchDeviceIdRequest& request,
     const FLoginWithNintendoSwitchDeviceIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithNintendoSwitchDeviceId"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithNintendoSwitchDeviceId"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithNintendoSwitchDeviceIdAsync(ClientModels::FLoginWithNintendoSwitchDeviceIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithNintendoSwitchDeviceIdDelegate>([this, &request, &Handle](const FLoginWithNintendoSwitchDeviceIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithNintendoSwitchDeviceId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithNintendoSwitchDeviceIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithNintendoSwitchDeviceIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3287,32 +3608,35 @@ void UPlayFabClientAPI::OnLoginWithNintendoSwitchDeviceIdResult(FHttpRequestPtr
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::LoginWithOpenIdConnect(
     ClientModels::FLoginWithOpenIdConnectRequest& request,
     const FLoginWithOpenIdConnectDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithOpenIdConnect"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithOpenIdConnect"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithOpenIdConnectResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithOpenIdConnectAsync(ClientModels::FLoginWithOpenIdConnectRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithOpenIdConnectDelegate>([this, &request, &Handle](const FLoginWithOpenIdConnectDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithOpenIdConnect(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithOpenIdConnectResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithOpenIdConnectDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3329,32 +3653,35 @@ void UPlayFabClientAPI::OnLoginWithOpenIdConnectResult(FHttpRequestPtr HttpReque
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::LoginWithPlayFab(
     ClientModels::FLoginWithPlayFabRequest& request,
     const FLoginWithPlayFabDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithPlayFab"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithPlayFab"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithPlayFabResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithPlayFabAsync(ClientModels::FLoginWithPlayFabRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithPlayFabDelegate>([this, &request, &Handle](const FLoginWithPlayFabDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithPlayFab(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithPlayFabResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithPlayFabDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3371,32 +3698,35 @@ void UPlayFabClientAPI::OnLoginWithPlayFabResult(FHttpRequestPtr HttpRequest, FH
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::LoginWithPSN(
     ClientModels::FLoginWithPSNRequest& request,
     const FLoginWithPSNDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithPSN"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithPSN"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithPSNResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithPSNAsync(ClientModels::FLoginWithPSNRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithPSNDelegate>([this, &request, &Handle](const FLoginWithPSNDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithPSN(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithPSNResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithPSNDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3413,32 +3743,35 @@ void UPlayFabClientAPI::OnLoginWithPSNResult(FHttpRequestPtr HttpRequest, FHttpR
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::LoginWithSteam(
     ClientModels::FLoginWithSteamRequest& request,
     const FLoginWithSteamDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithSteam"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithSteam"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithSteamResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithSteamAsync(ClientModels::FLoginWithSteamRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithSteamDelegate>([this, &request, &Handle](const FLoginWithSteamDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithSteam(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithSteamResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithSteamDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3455,32 +3788,35 @@ void UPlayFabClientAPI::OnLoginWithSteamResult(FHttpRequestPtr HttpRequest, FHtt
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::LoginWithTwitch(
     ClientModels::FLoginWithTwitchRequest& request,
     const FLoginWithTwitchDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithTwitch"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithTwitch"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithTwitchAsync(ClientModels::FLoginWithTwitchRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithTwitchDelegate>([this, &request, &Handle](const FLoginWithTwitchDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithTwitch(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3497,32 +3833,35 @@ void UPlayFabClientAPI::OnLoginWithTwitchResult(FHttpRequestPtr HttpRequest, FHt
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::LoginWithWindowsHello(
     ClientModels::FLoginWithWindowsHelloRequest& request,
     const FLoginWithWindowsHelloDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithWindowsHello"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithWindowsHello"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithWindowsHelloResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithWindowsHelloAsync(ClientModels::FLoginWithWindowsHelloRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithWindowsHelloDelegate>([this, &request, &Handle](const FLoginWithWindowsHelloDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithWindowsHello(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithWindowsHelloResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithWindowsHelloDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3539,32 +3878,35 @@ void UPlayFabClientAPI::OnLoginWithWindowsHelloResult(FHttpRequestPtr HttpReques
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::LoginWithXbox(
     ClientModels::FLoginWithXboxRequest& request,
     const FLoginWithXboxDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithXbox"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/LoginWithXbox"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnLoginWithXboxResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::LoginWithXboxAsync(ClientModels::FLoginWithXboxRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithXboxDelegate>([this, &request, &Handle](const FLoginWithXboxDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::LoginWithXbox(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnLoginWithXboxResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithXboxDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3581,17 +3923,14 @@ void UPlayFabClientAPI::OnLoginWithXboxResult(FHttpRequestPtr HttpRequest, FHttp
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::Matchmake(
     ClientModels::FMatchmakeRequest& request,
     const FMatchmakeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -3600,29 +3939,32 @@ bool UPlayFabClientAPI::Matchmake(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/Matchmake"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/Matchmake"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnMatchmakeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FMatchmakeResult>> UPlayFabClientAPI::MatchmakeAsync(ClientModels::FMatchmakeRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FMatchmakeResult, FMatchmakeDelegate>([this, &request, &Handle](const FMatchmakeDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::Matchmake(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnMatchmakeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FMatchmakeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FMatchmakeResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FMatchmakeResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FMatchmakeResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::OpenTrade(
     ClientModels::FOpenTradeRequest& request,
     const FOpenTradeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -3631,29 +3973,32 @@ bool UPlayFabClientAPI::OpenTrade(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/OpenTrade"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/OpenTrade"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnOpenTradeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FOpenTradeResponse>> UPlayFabClientAPI::OpenTradeAsync(ClientModels::FOpenTradeRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FOpenTradeResponse, FOpenTradeDelegate>([this, &request, &Handle](const FOpenTradeDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::OpenTrade(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnOpenTradeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FOpenTradeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FOpenTradeResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FOpenTradeResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FOpenTradeResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::PayForPurchase(
     ClientModels::FPayForPurchaseRequest& request,
     const FPayForPurchaseDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -3662,29 +4007,32 @@ bool UPlayFabClientAPI::PayForPurchase(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/PayForPurchase"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/PayForPurchase"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnPayForPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FPayForPurchaseResult>> UPlayFabClientAPI::PayForPurchaseAsync(ClientModels::FPayForPurchaseRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FPayForPurchaseResult, FPayForPurchaseDelegate>([this, &request, &Handle](const FPayForPurchaseDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::PayForPurchase(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnPayForPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPayForPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FPayForPurchaseResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FPayForPurchaseResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FPayForPurchaseResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::PurchaseItem(
     ClientModels::FPurchaseItemRequest& request,
     const FPurchaseItemDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -3693,29 +4041,32 @@ bool UPlayFabClientAPI::PurchaseItem(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/PurchaseItem"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/PurchaseItem"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnPurchaseItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FPurchaseItemResult>> UPlayFabClientAPI::PurchaseItemAsync(ClientModels::FPurchaseItemRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FPurchaseItemResult, FPurchaseItemDelegate>([this, &request, &Handle](const FPurchaseItemDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::PurchaseItem(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnPurchaseItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPurchaseItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FPurchaseItemResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FPurchaseItemResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FPurchaseItemResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::RedeemCoupon(
     ClientModels::FRedeemCouponRequest& request,
     const FRedeemCouponDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -3724,29 +4075,32 @@ bool UPlayFabClientAPI::RedeemCoupon(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RedeemCoupon"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RedeemCoupon"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRedeemCouponResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FRedeemCouponResult>> UPlayFabClientAPI::RedeemCouponAsync(ClientModels::FRedeemCouponRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FRedeemCouponResult, FRedeemCouponDelegate>([this, &request, &Handle](const FRedeemCouponDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::RedeemCoupon(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnRedeemCouponResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemCouponDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FRedeemCouponResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FRedeemCouponResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FRedeemCouponResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::RefreshPSNAuthToken(
     ClientModels::FRefreshPSNAuthTokenRequest& request,
     const FRefreshPSNAuthTokenDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -3755,29 +4109,32 @@ bool UPlayFabClientAPI::RefreshPSNAuthToken(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RefreshPSNAuthToken"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RefreshPSNAuthToken"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRefreshPSNAuthTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FEmptyResponse>> UPlayFabClientAPI::RefreshPSNAuthTokenAsync(ClientModels::FRefreshPSNAuthTokenRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FEmptyResponse, FRefreshPSNAuthTokenDelegate>([this, &request, &Handle](const FRefreshPSNAuthTokenDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::RefreshPSNAuthToken(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnRefreshPSNAuthTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRefreshPSNAuthTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::RegisterForIOSPushNotification(
     ClientModels::FRegisterForIOSPushNotificationRequest& request,
     const FRegisterForIOSPushNotificationDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -3786,76 +4143,88 @@ bool UPlayFabClientAPI::RegisterForIOSPushNotification(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RegisterForIOSPushNotification"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RegisterForIOSPushNotification"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRegisterForIOSPushNotificationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FRegisterForIOSPushNotificationResult>> UPlayFabClientAPI::RegisterForIOSPushNotificationAsync(ClientModels::FRegisterForIOSPushNotificationRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FRegisterForIOSPushNotificationResult, FRegisterForIOSPushNotificationDelegate>([this, &request, &Handle](const FRegisterForIOSPushNotificationDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::RegisterForIOSPushNotification(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnRegisterForIOSPushNotificationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterForIOSPushNotificationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FRegisterForIOSPushNotificationResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FRegisterForIOSPushNotificationResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FRegisterForIOSPushNotificationResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::RegisterPlayFabUser(
     ClientModels::FRegisterPlayFabUserRequest& request,
     const FRegisterPlayFabUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RegisterPlayFabUser"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RegisterPlayFabUser"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRegisterPlayFabUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FRegisterPlayFabUserResult>> UPlayFabClientAPI::RegisterPlayFabUserAsync(ClientModels::FRegisterPlayFabUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FRegisterPlayFabUserResult, FRegisterPlayFabUserDelegate>([this, &request, &Handle](const FRegisterPlayFabUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::RegisterPlayFabUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnRegisterPlayFabUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterPlayFabUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FRegisterPlayFabUserResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FRegisterPlayFabUserResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FRegisterPlayFabUserResult& outResult)
     {
         if (outResult.SessionTicket.Len() > 0)
             PlayFabSettings::SetClientSessionTicket(outResult.SessionTicket);
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::RegisterWithWindowsHello(
     ClientModels::FRegisterWithWindowsHelloRequest& request,
     const FRegisterWithWindowsHelloDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RegisterWithWindowsHello"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RegisterWithWindowsHello"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRegisterWithWindowsHelloResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientAPI::RegisterWithWindowsHelloAsync(ClientModels::FRegisterWithWindowsHelloRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FRegisterWithWindowsHelloDelegate>([this, &request, &Handle](const FRegisterWithWindowsHelloDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::RegisterWithWindowsHello(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnRegisterWithWindowsHelloResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterWithWindowsHelloDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3872,17 +4241,14 @@ void UPlayFabClientAPI::OnRegisterWithWindowsHelloResult(FHttpRequestPtr HttpReq
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientAPI::RemoveContactEmail(
     ClientModels::FRemoveContactEmailRequest& request,
     const FRemoveContactEmailDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -3891,29 +4257,32 @@ bool UPlayFabClientAPI::RemoveContactEmail(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RemoveContactEmail"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RemoveContactEmail"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRemoveContactEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FRemoveContactEmailResult>> UPlayFabClientAPI::RemoveContactEmailAsync(ClientModels::FRemoveContactEmailRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FRemoveContactEmailResult, FRemoveContactEmailDelegate>([this, &request, &Handle](const FRemoveContactEmailDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::RemoveContactEmail(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnRemoveContactEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveContactEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FRemoveContactEmailResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FRemoveContactEmailResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FRemoveContactEmailResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::RemoveFriend(
     ClientModels::FRemoveFriendRequest& request,
     const FRemoveFriendDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -3922,29 +4291,32 @@ bool UPlayFabClientAPI::RemoveFriend(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RemoveFriend"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RemoveFriend"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRemoveFriendResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FRemoveFriendResult>> UPlayFabClientAPI::RemoveFriendAsync(ClientModels::FRemoveFriendRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FRemoveFriendResult, FRemoveFriendDelegate>([this, &request, &Handle](const FRemoveFriendDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::RemoveFriend(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnRemoveFriendResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveFriendDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FRemoveFriendResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FRemoveFriendResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FRemoveFriendResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::RemoveGenericID(
     ClientModels::FRemoveGenericIDRequest& request,
     const FRemoveGenericIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -3953,29 +4325,32 @@ bool UPlayFabClientAPI::RemoveGenericID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RemoveGenericID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RemoveGenericID"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRemoveGenericIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FRemoveGenericIDResult>> UPlayFabClientAPI::RemoveGenericIDAsync(ClientModels::FRemoveGenericIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FRemoveGenericIDResult, FRemoveGenericIDDelegate>([this, &request, &Handle](const FRemoveGenericIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::RemoveGenericID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnRemoveGenericIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveGenericIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FRemoveGenericIDResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FRemoveGenericIDResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FRemoveGenericIDResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::RemoveSharedGroupMembers(
     ClientModels::FRemoveSharedGroupMembersRequest& request,
     const FRemoveSharedGroupMembersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -3984,29 +4359,32 @@ bool UPlayFabClientAPI::RemoveSharedGroupMembers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RemoveSharedGroupMembers"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RemoveSharedGroupMembers"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRemoveSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FRemoveSharedGroupMembersResult>> UPlayFabClientAPI::RemoveSharedGroupMembersAsync(ClientModels::FRemoveSharedGroupMembersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FRemoveSharedGroupMembersResult, FRemoveSharedGroupMembersDelegate>([this, &request, &Handle](const FRemoveSharedGroupMembersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::RemoveSharedGroupMembers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnRemoveSharedGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveSharedGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FRemoveSharedGroupMembersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FRemoveSharedGroupMembersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FRemoveSharedGroupMembersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::ReportAdActivity(
     ClientModels::FReportAdActivityRequest& request,
     const FReportAdActivityDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4015,29 +4393,32 @@ bool UPlayFabClientAPI::ReportAdActivity(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ReportAdActivity"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ReportAdActivity"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnReportAdActivityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FReportAdActivityResult>> UPlayFabClientAPI::ReportAdActivityAsync(ClientModels::FReportAdActivityRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FReportAdActivityResult, FReportAdActivityDelegate>([this, &request, &Handle](const FReportAdActivityDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::ReportAdActivity(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnReportAdActivityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportAdActivityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FReportAdActivityResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FReportAdActivityResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FReportAdActivityResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::ReportDeviceInfo(
     ClientModels::FDeviceInfoRequest& request,
     const FReportDeviceInfoDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4046,29 +4427,32 @@ bool UPlayFabClientAPI::ReportDeviceInfo(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ReportDeviceInfo"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ReportDeviceInfo"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnReportDeviceInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FEmptyResponse>> UPlayFabClientAPI::ReportDeviceInfoAsync(ClientModels::FDeviceInfoRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FEmptyResponse, FReportDeviceInfoDelegate>([this, &request, &Handle](const FReportDeviceInfoDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::ReportDeviceInfo(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnReportDeviceInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportDeviceInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::ReportPlayer(
     ClientModels::FReportPlayerClientRequest& request,
     const FReportPlayerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4077,29 +4461,32 @@ bool UPlayFabClientAPI::ReportPlayer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ReportPlayer"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ReportPlayer"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnReportPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FReportPlayerClientResult>> UPlayFabClientAPI::ReportPlayerAsync(ClientModels::FReportPlayerClientRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FReportPlayerClientResult, FReportPlayerDelegate>([this, &request, &Handle](const FReportPlayerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::ReportPlayer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnReportPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FReportPlayerClientResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FReportPlayerClientResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FReportPlayerClientResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::RestoreIOSPurchases(
     ClientModels::FRestoreIOSPurchasesRequest& request,
     const FRestoreIOSPurchasesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4108,29 +4495,32 @@ bool UPlayFabClientAPI::RestoreIOSPurchases(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RestoreIOSPurchases"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RestoreIOSPurchases"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRestoreIOSPurchasesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FRestoreIOSPurchasesResult>> UPlayFabClientAPI::RestoreIOSPurchasesAsync(ClientModels::FRestoreIOSPurchasesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FRestoreIOSPurchasesResult, FRestoreIOSPurchasesDelegate>([this, &request, &Handle](const FRestoreIOSPurchasesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::RestoreIOSPurchases(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnRestoreIOSPurchasesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRestoreIOSPurchasesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FRestoreIOSPurchasesResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FRestoreIOSPurchasesResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FRestoreIOSPurchasesResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::RewardAdActivity(
     ClientModels::FRewardAdActivityRequest& request,
     const FRewardAdActivityDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4139,55 +4529,61 @@ bool UPlayFabClientAPI::RewardAdActivity(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RewardAdActivity"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/RewardAdActivity"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnRewardAdActivityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FRewardAdActivityResult>> UPlayFabClientAPI::RewardAdActivityAsync(ClientModels::FRewardAdActivityRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FRewardAdActivityResult, FRewardAdActivityDelegate>([this, &request, &Handle](const FRewardAdActivityDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::RewardAdActivity(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnRewardAdActivityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRewardAdActivityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FRewardAdActivityResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FRewardAdActivityResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FRewardAdActivityResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::SendAccountRecoveryEmail(
     ClientModels::FSendAccountRecoveryEmailRequest& request,
     const FSendAccountRecoveryEmailDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/SendAccountRecoveryEmail"), request.toJSONString(), TEXT(""), TEXT(""));
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/SendAccountRecoveryEmail"), request.toJSONUtf8(), TEXT(""), TEXT(""));
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnSendAccountRecoveryEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FSendAccountRecoveryEmailResult>> UPlayFabClientAPI::SendAccountRecoveryEmailAsync(ClientModels::FSendAccountRecoveryEmailRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FSendAccountRecoveryEmailResult, FSendAccountRecoveryEmailDelegate>([this, &request, &Handle](const FSendAccountRecoveryEmailDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::SendAccountRecoveryEmail(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnSendAccountRecoveryEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendAccountRecoveryEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FSendAccountRecoveryEmailResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FSendAccountRecoveryEmailResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FSendAccountRecoveryEmailResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::SetFriendTags(
     ClientModels::FSetFriendTagsRequest& request,
     const FSetFriendTagsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4196,29 +4592,32 @@ bool UPlayFabClientAPI::SetFriendTags(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/SetFriendTags"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/SetFriendTags"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnSetFriendTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FSetFriendTagsResult>> UPlayFabClientAPI::SetFriendTagsAsync(ClientModels::FSetFriendTagsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FSetFriendTagsResult, FSetFriendTagsDelegate>([this, &request, &Handle](const FSetFriendTagsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::SetFriendTags(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnSetFriendTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetFriendTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FSetFriendTagsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FSetFriendTagsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FSetFriendTagsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::SetPlayerSecret(
     ClientModels::FSetPlayerSecretRequest& request,
     const FSetPlayerSecretDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4227,29 +4626,32 @@ bool UPlayFabClientAPI::SetPlayerSecret(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/SetPlayerSecret"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/SetPlayerSecret"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnSetPlayerSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FSetPlayerSecretResult>> UPlayFabClientAPI::SetPlayerSecretAsync(ClientModels::FSetPlayerSecretRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FSetPlayerSecretResult, FSetPlayerSecretDelegate>([this, &request, &Handle](const FSetPlayerSecretDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::SetPlayerSecret(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnSetPlayerSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPlayerSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FSetPlayerSecretResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FSetPlayerSecretResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FSetPlayerSecretResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::StartGame(
     ClientModels::FStartGameRequest& request,
     const FStartGameDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4258,29 +4660,32 @@ bool UPlayFabClientAPI::StartGame(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/StartGame"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/StartGame"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnStartGameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FStartGameResult>> UPlayFabClientAPI::StartGameAsync(ClientModels::FStartGameRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FStartGameResult, FStartGameDelegate>([this, &request, &Handle](const FStartGameDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::StartGame(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnStartGameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FStartGameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FStartGameResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FStartGameResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FStartGameResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::StartPurchase(
     ClientModels::FStartPurchaseRequest& request,
     const FStartPurchaseDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4289,29 +4694,32 @@ bool UPlayFabClientAPI::StartPurchase(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/StartPurchase"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/StartPurchase"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnStartPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FStartPurchaseResult>> UPlayFabClientAPI::StartPurchaseAsync(ClientModels::FStartPurchaseRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FStartPurchaseResult, FStartPurchaseDelegate>([this, &request, &Handle](const FStartPurchaseDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::StartPurchase(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnStartPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FStartPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FStartPurchaseResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FStartPurchaseResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FStartPurchaseResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::SubtractUserVirtualCurrency(
     ClientModels::FSubtractUserVirtualCurrencyRequest& request,
     const FSubtractUserVirtualCurrencyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4320,29 +4728,32 @@ bool UPlayFabClientAPI::SubtractUserVirtualCurrency(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/SubtractUserVirtualCurrency"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/SubtractUserVirtualCurrency"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnSubtractUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FModifyUserVirtualCurrencyResult>> UPlayFabClientAPI::SubtractUserVirtualCurrencyAsync(ClientModels::FSubtractUserVirtualCurrencyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FModifyUserVirtualCurrencyResult, FSubtractUserVirtualCurrencyDelegate>([this, &request, &Handle](const FSubtractUserVirtualCurrencyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::SubtractUserVirtualCurrency(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnSubtractUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubtractUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FModifyUserVirtualCurrencyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FModifyUserVirtualCurrencyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FModifyUserVirtualCurrencyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlinkAndroidDeviceID(
     ClientModels::FUnlinkAndroidDeviceIDRequest& request,
     const FUnlinkAndroidDeviceIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4351,29 +4762,32 @@ bool UPlayFabClientAPI::UnlinkAndroidDeviceID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkAndroidDeviceID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkAndroidDeviceID"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkAndroidDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkAndroidDeviceIDResult>> UPlayFabClientAPI::UnlinkAndroidDeviceIDAsync(ClientModels::FUnlinkAndroidDeviceIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkAndroidDeviceIDResult, FUnlinkAndroidDeviceIDDelegate>([this, &request, &Handle](const FUnlinkAndroidDeviceIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlinkAndroidDeviceID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlinkAndroidDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkAndroidDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkAndroidDeviceIDResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkAndroidDeviceIDResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkAndroidDeviceIDResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlinkApple(
     ClientModels::FUnlinkAppleRequest& request,
     const FUnlinkAppleDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4382,29 +4796,32 @@ bool UPlayFabClientAPI::UnlinkApple(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkApple"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkApple"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FEmptyResponse>> UPlayFabClientAPI::UnlinkAppleAsync(ClientModels::FUnlinkAppleRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FEmptyResponse, FUnlinkAppleDelegate>([this, &request, &Handle](const FUnlinkAppleDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlinkApple(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlinkAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlinkCustomID(
     ClientModels::FUnlinkCustomIDRequest& request,
     const FUnlinkCustomIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4413,29 +4830,32 @@ bool UPlayFabClientAPI::UnlinkCustomID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkCustomID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkCustomID"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkCustomIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkCustomIDResult>> UPlayFabClientAPI::UnlinkCustomIDAsync(ClientModels::FUnlinkCustomIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkCustomIDResult, FUnlinkCustomIDDelegate>([this, &request, &Handle](const FUnlinkCustomIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlinkCustomID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlinkCustomIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkCustomIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkCustomIDResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkCustomIDResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkCustomIDResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlinkFacebookAccount(
     ClientModels::FUnlinkFacebookAccountRequest& request,
     const FUnlinkFacebookAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4444,29 +4864,32 @@ bool UPlayFabClientAPI::UnlinkFacebookAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkFacebookAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkFacebookAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkFacebookAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkFacebookAccountResult>> UPlayFabClientAPI::UnlinkFacebookAccountAsync(ClientModels::FUnlinkFacebookAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkFacebookAccountResult, FUnlinkFacebookAccountDelegate>([this, &request, &Handle](const FUnlinkFacebookAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlinkFacebookAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlinkFacebookAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkFacebookAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkFacebookAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkFacebookAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkFacebookAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlinkFacebookInstantGamesId(
     ClientModels::FUnlinkFacebookInstantGamesIdRequest& request,
     const FUnlinkFacebookInstantGamesIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4475,29 +4898,32 @@ bool UPlayFabClientAPI::UnlinkFacebookInstantGamesId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkFacebookInstantGamesId"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkFacebookInstantGamesId"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkFacebookInstantGamesIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkFacebookInstantGamesIdResult>> UPlayFabClientAPI::UnlinkFacebookInstantGamesIdAsync(ClientModels::FUnlinkFacebookInstantGamesIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkFacebookInstantGamesIdResult, FUnlinkFacebookInstantGamesIdDelegate>([this, &request, &Handle](const FUnlinkFacebookInstantGamesIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlinkFacebookInstantGamesId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlinkFacebookInstantGamesIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkFacebookInstantGamesIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkFacebookInstantGamesIdResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkFacebookInstantGamesIdResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkFacebookInstantGamesIdResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlinkGameCenterAccount(
     ClientModels::FUnlinkGameCenterAccountRequest& request,
     const FUnlinkGameCenterAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4506,29 +4932,32 @@ bool UPlayFabClientAPI::UnlinkGameCenterAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkGameCenterAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkGameCenterAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkGameCenterAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkGameCenterAccountResult>> UPlayFabClientAPI::UnlinkGameCenterAccountAsync(ClientModels::FUnlinkGameCenterAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkGameCenterAccountResult, FUnlinkGameCenterAccountDelegate>([this, &request, &Handle](const FUnlinkGameCenterAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlinkGameCenterAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlinkGameCenterAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkGameCenterAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkGameCenterAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkGameCenterAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkGameCenterAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlinkGoogleAccount(
     ClientModels::FUnlinkGoogleAccountRequest& request,
     const FUnlinkGoogleAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4537,29 +4966,32 @@ bool UPlayFabClientAPI::UnlinkGoogleAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkGoogleAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkGoogleAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkGoogleAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkGoogleAccountResult>> UPlayFabClientAPI::UnlinkGoogleAccountAsync(ClientModels::FUnlinkGoogleAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkGoogleAccountResult, FUnlinkGoogleAccountDelegate>([this, &request, &Handle](const FUnlinkGoogleAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlinkGoogleAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlinkGoogleAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkGoogleAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkGoogleAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkGoogleAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkGoogleAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlinkIOSDeviceID(
     ClientModels::FUnlinkIOSDeviceIDRequest& request,
     const FUnlinkIOSDeviceIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4568,29 +5000,32 @@ bool UPlayFabClientAPI::UnlinkIOSDeviceID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkIOSDeviceID"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkIOSDeviceID"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkIOSDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkIOSDeviceIDResult>> UPlayFabClientAPI::UnlinkIOSDeviceIDAsync(ClientModels::FUnlinkIOSDeviceIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkIOSDeviceIDResult, FUnlinkIOSDeviceIDDelegate>([this, &request, &Handle](const FUnlinkIOSDeviceIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlinkIOSDeviceID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlinkIOSDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkIOSDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkIOSDeviceIDResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkIOSDeviceIDResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkIOSDeviceIDResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlinkKongregate(
     ClientModels::FUnlinkKongregateAccountRequest& request,
     const FUnlinkKongregateDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4599,29 +5034,32 @@ bool UPlayFabClientAPI::UnlinkKongregate(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkKongregate"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkKongregate"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkKongregateAccountResult>> UPlayFabClientAPI::UnlinkKongregateAsync(ClientModels::FUnlinkKongregateAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkKongregateAccountResult, FUnlinkKongregateDelegate>([this, &request, &Handle](const FUnlinkKongregateDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlinkKongregate(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlinkKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkKongregateAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkKongregateAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkKongregateAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlinkNintendoServiceAccount(
     ClientModels::FUnlinkNintendoServiceAccountRequest& request,
     const FUnlinkNintendoServiceAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4630,29 +5068,32 @@ bool UPlayFabClientAPI::UnlinkNintendoServiceAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkNintendoServiceAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkNintendoServiceAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FEmptyResponse>> UPlayFabClientAPI::UnlinkNintendoServiceAccountAsync(ClientModels::FUnlinkNintendoServiceAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FEmptyResponse, FUnlinkNintendoServiceAccountDelegate>([this, &request, &Handle](const FUnlinkNintendoServiceAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlinkNintendoServiceAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlinkNintendoServiceAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkNintendoServiceAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlinkNintendoSwitchDeviceId(
     ClientModels::FUnlinkNintendoSwitchDeviceIdRequest& request,
     const FUnlinkNintendoSwitchDeviceIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4661,29 +5102,32 @@ bool UPlayFabClientAPI::UnlinkNintendoSwitchDeviceId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkNintendoSwitchDeviceId"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkNintendoSwitchDeviceId"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkNintendoSwitchDeviceIdResult>> UPlayFabClientAPI::UnlinkNintendoSwitchDeviceIdAsync(ClientModels::FUnlinkNintendoSwitchDeviceIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkNintendoSwitchDeviceIdResult, FUnlinkNintendoSwitchDeviceIdDelegate>([this, &request, &Handle](const FUnlinkNintendoSwitchDeviceIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlinkNintendoSwitchDeviceId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlinkNintendoSwitchDeviceIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkNintendoSwitchDeviceIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkNintendoSwitchDeviceIdResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkNintendoSwitchDeviceIdResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkNintendoSwitchDeviceIdResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlinkOpenIdConnect(
     ClientModels::FUnlinkOpenIdConnectRequest& request,
     const FUnlinkOpenIdConnectDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4692,29 +5136,32 @@ bool UPlayFabClientAPI::UnlinkOpenIdConnect(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkOpenIdConnect"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkOpenIdConnect"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkOpenIdConnectResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FEmptyResponse>> UPlayFabClientAPI::UnlinkOpenIdConnectAsync(ClientModels::FUnlinkOpenIdConnectRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FEmptyResponse, FUnlinkOpenIdConnectDelegate>([this, &request, &Handle](const FUnlinkOpenIdConnectDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlinkOpenIdConnect(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlinkOpenIdConnectResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkOpenIdConnectDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlinkPSNAccount(
     ClientModels::FUnlinkPSNAccountRequest& request,
     const FUnlinkPSNAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4723,29 +5170,32 @@ bool UPlayFabClientAPI::UnlinkPSNAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkPSNAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkPSNAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkPSNAccountResult>> UPlayFabClientAPI::UnlinkPSNAccountAsync(ClientModels::FUnlinkPSNAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkPSNAccountResult, FUnlinkPSNAccountDelegate>([this, &request, &Handle](const FUnlinkPSNAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlinkPSNAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlinkPSNAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkPSNAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkPSNAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkPSNAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkPSNAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlinkSteamAccount(
     ClientModels::FUnlinkSteamAccountRequest& request,
     const FUnlinkSteamAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4754,29 +5204,32 @@ bool UPlayFabClientAPI::UnlinkSteamAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkSteamAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkSteamAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkSteamAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkSteamAccountResult>> UPlayFabClientAPI::UnlinkSteamAccountAsync(ClientModels::FUnlinkSteamAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkSteamAccountResult, FUnlinkSteamAccountDelegate>([this, &request, &Handle](const FUnlinkSteamAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlinkSteamAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlinkSteamAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkSteamAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkSteamAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkSteamAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkSteamAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlinkTwitch(
     ClientModels::FUnlinkTwitchAccountRequest& request,
     const FUnlinkTwitchDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4785,29 +5238,32 @@ bool UPlayFabClientAPI::UnlinkTwitch(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkTwitch"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkTwitch"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkTwitchAccountResult>> UPlayFabClientAPI::UnlinkTwitchAsync(ClientModels::FUnlinkTwitchAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkTwitchAccountResult, FUnlinkTwitchDelegate>([this, &request, &Handle](const FUnlinkTwitchDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlinkTwitch(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlinkTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkTwitchAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkTwitchAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkTwitchAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlinkWindowsHello(
     ClientModels::FUnlinkWindowsHelloAccountRequest& request,
     const FUnlinkWindowsHelloDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4816,29 +5272,32 @@ bool UPlayFabClientAPI::UnlinkWindowsHello(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkWindowsHello"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkWindowsHello"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkWindowsHelloResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkWindowsHelloAccountResponse>> UPlayFabClientAPI::UnlinkWindowsHelloAsync(ClientModels::FUnlinkWindowsHelloAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkWindowsHelloAccountResponse, FUnlinkWindowsHelloDelegate>([this, &request, &Handle](const FUnlinkWindowsHelloDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlinkWindowsHello(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlinkWindowsHelloResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkWindowsHelloDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkWindowsHelloAccountResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkWindowsHelloAccountResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkWindowsHelloAccountResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlinkXboxAccount(
     ClientModels::FUnlinkXboxAccountRequest& request,
     const FUnlinkXboxAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4847,29 +5306,32 @@ bool UPlayFabClientAPI::UnlinkXboxAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkXboxAccount"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlinkXboxAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkXboxAccountResult>> UPlayFabClientAPI::UnlinkXboxAccountAsync(ClientModels::FUnlinkXboxAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkXboxAccountResult, FUnlinkXboxAccountDelegate>([this, &request, &Handle](const FUnlinkXboxAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlinkXboxAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlinkXboxAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkXboxAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkXboxAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkXboxAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkXboxAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlockContainerInstance(
     ClientModels::FUnlockContainerInstanceRequest& request,
     const FUnlockContainerInstanceDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4878,29 +5340,32 @@ bool UPlayFabClientAPI::UnlockContainerInstance(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlockContainerInstance"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlockContainerInstance"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlockContainerInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlockContainerItemResult>> UPlayFabClientAPI::UnlockContainerInstanceAsync(ClientModels::FUnlockContainerInstanceRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlockContainerItemResult, FUnlockContainerInstanceDelegate>([this, &request, &Handle](const FUnlockContainerInstanceDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlockContainerInstance(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlockContainerInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlockContainerInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlockContainerItemResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlockContainerItemResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlockContainerItemResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UnlockContainerItem(
     ClientModels::FUnlockContainerItemRequest& request,
     const FUnlockContainerItemDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4909,29 +5374,32 @@ bool UPlayFabClientAPI::UnlockContainerItem(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlockContainerItem"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UnlockContainerItem"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUnlockContainerItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlockContainerItemResult>> UPlayFabClientAPI::UnlockContainerItemAsync(ClientModels::FUnlockContainerItemRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlockContainerItemResult, FUnlockContainerItemDelegate>([this, &request, &Handle](const FUnlockContainerItemDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UnlockContainerItem(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUnlockContainerItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlockContainerItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlockContainerItemResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlockContainerItemResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlockContainerItemResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UpdateAvatarUrl(
     ClientModels::FUpdateAvatarUrlRequest& request,
     const FUpdateAvatarUrlDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4940,29 +5408,32 @@ bool UPlayFabClientAPI::UpdateAvatarUrl(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateAvatarUrl"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateAvatarUrl"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateAvatarUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FEmptyResponse>> UPlayFabClientAPI::UpdateAvatarUrlAsync(ClientModels::FUpdateAvatarUrlRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FEmptyResponse, FUpdateAvatarUrlDelegate>([this, &request, &Handle](const FUpdateAvatarUrlDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UpdateAvatarUrl(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUpdateAvatarUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateAvatarUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UpdateCharacterData(
     ClientModels::FUpdateCharacterDataRequest& request,
     const FUpdateCharacterDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -4971,29 +5442,32 @@ bool UPlayFabClientAPI::UpdateCharacterData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateCharacterData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateCharacterData"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateCharacterDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUpdateCharacterDataResult>> UPlayFabClientAPI::UpdateCharacterDataAsync(ClientModels::FUpdateCharacterDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUpdateCharacterDataResult, FUpdateCharacterDataDelegate>([this, &request, &Handle](const FUpdateCharacterDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UpdateCharacterData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUpdateCharacterDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUpdateCharacterDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUpdateCharacterDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUpdateCharacterDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UpdateCharacterStatistics(
     ClientModels::FUpdateCharacterStatisticsRequest& request,
     const FUpdateCharacterStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -5002,29 +5476,32 @@ bool UPlayFabClientAPI::UpdateCharacterStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateCharacterStatistics"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateCharacterStatistics"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUpdateCharacterStatisticsResult>> UPlayFabClientAPI::UpdateCharacterStatisticsAsync(ClientModels::FUpdateCharacterStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUpdateCharacterStatisticsResult, FUpdateCharacterStatisticsDelegate>([this, &request, &Handle](const FUpdateCharacterStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UpdateCharacterStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUpdateCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUpdateCharacterStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUpdateCharacterStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUpdateCharacterStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UpdatePlayerStatistics(
     ClientModels::FUpdatePlayerStatisticsRequest& request,
     const FUpdatePlayerStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -5033,29 +5510,32 @@ bool UPlayFabClientAPI::UpdatePlayerStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdatePlayerStatistics"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdatePlayerStatistics"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdatePlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUpdatePlayerStatisticsResult>> UPlayFabClientAPI::UpdatePlayerStatisticsAsync(ClientModels::FUpdatePlayerStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUpdatePlayerStatisticsResult, FUpdatePlayerStatisticsDelegate>([this, &request, &Handle](const FUpdatePlayerStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UpdatePlayerStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUpdatePlayerStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUpdatePlayerStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUpdatePlayerStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUpdatePlayerStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UpdateSharedGroupData(
     ClientModels::FUpdateSharedGroupDataRequest& request,
     const FUpdateSharedGroupDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -5064,29 +5544,32 @@ bool UPlayFabClientAPI::UpdateSharedGroupData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateSharedGroupData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateSharedGroupData"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUpdateSharedGroupDataResult>> UPlayFabClientAPI::UpdateSharedGroupDataAsync(ClientModels::FUpdateSharedGroupDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUpdateSharedGroupDataResult, FUpdateSharedGroupDataDelegate>([this, &request, &Handle](const FUpdateSharedGroupDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UpdateSharedGroupData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUpdateSharedGroupDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateSharedGroupDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUpdateSharedGroupDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUpdateSharedGroupDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUpdateSharedGroupDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UpdateUserData(
     ClientModels::FUpdateUserDataRequest& request,
     const FUpdateUserDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -5095,29 +5578,32 @@ bool UPlayFabClientAPI::UpdateUserData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateUserData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateUserData"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUpdateUserDataResult>> UPlayFabClientAPI::UpdateUserDataAsync(ClientModels::FUpdateUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUpdateUserDataResult, FUpdateUserDataDelegate>([this, &request, &Handle](const FUpdateUserDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UpdateUserData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUpdateUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UpdateUserPublisherData(
     ClientModels::FUpdateUserDataRequest& request,
     const FUpdateUserPublisherDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -5126,29 +5612,32 @@ bool UPlayFabClientAPI::UpdateUserPublisherData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateUserPublisherData"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateUserPublisherData"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUpdateUserDataResult>> UPlayFabClientAPI::UpdateUserPublisherDataAsync(ClientModels::FUpdateUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUpdateUserDataResult, FUpdateUserPublisherDataDelegate>([this, &request, &Handle](const FUpdateUserPublisherDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UpdateUserPublisherData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUpdateUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::UpdateUserTitleDisplayName(
     ClientModels::FUpdateUserTitleDisplayNameRequest& request,
     const FUpdateUserTitleDisplayNameDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -5157,29 +5646,32 @@ bool UPlayFabClientAPI::UpdateUserTitleDisplayName(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateUserTitleDisplayName"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/UpdateUserTitleDisplayName"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnUpdateUserTitleDisplayNameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUpdateUserTitleDisplayNameResult>> UPlayFabClientAPI::UpdateUserTitleDisplayNameAsync(ClientModels::FUpdateUserTitleDisplayNameRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUpdateUserTitleDisplayNameResult, FUpdateUserTitleDisplayNameDelegate>([this, &request, &Handle](const FUpdateUserTitleDisplayNameDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::UpdateUserTitleDisplayName(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnUpdateUserTitleDisplayNameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserTitleDisplayNameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUpdateUserTitleDisplayNameResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUpdateUserTitleDisplayNameResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUpdateUserTitleDisplayNameResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::ValidateAmazonIAPReceipt(
     ClientModels::FValidateAmazonReceiptRequest& request,
     const FValidateAmazonIAPReceiptDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -5188,29 +5680,32 @@ bool UPlayFabClientAPI::ValidateAmazonIAPReceipt(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ValidateAmazonIAPReceipt"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ValidateAmazonIAPReceipt"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnValidateAmazonIAPReceiptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FValidateAmazonReceiptResult>> UPlayFabClientAPI::ValidateAmazonIAPReceiptAsync(ClientModels::FValidateAmazonReceiptRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FValidateAmazonReceiptResult, FValidateAmazonIAPReceiptDelegate>([this, &request, &Handle](const FValidateAmazonIAPReceiptDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::ValidateAmazonIAPReceipt(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnValidateAmazonIAPReceiptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateAmazonIAPReceiptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FValidateAmazonReceiptResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FValidateAmazonReceiptResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FValidateAmazonReceiptResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::ValidateGooglePlayPurchase(
     ClientModels::FValidateGooglePlayPurchaseRequest& request,
     const FValidateGooglePlayPurchaseDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -5219,29 +5714,32 @@ bool UPlayFabClientAPI::ValidateGooglePlayPurchase(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ValidateGooglePlayPurchase"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ValidateGooglePlayPurchase"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnValidateGooglePlayPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FValidateGooglePlayPurchaseResult>> UPlayFabClientAPI::ValidateGooglePlayPurchaseAsync(ClientModels::FValidateGooglePlayPurchaseRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FValidateGooglePlayPurchaseResult, FValidateGooglePlayPurchaseDelegate>([this, &request, &Handle](const FValidateGooglePlayPurchaseDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::ValidateGooglePlayPurchase(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnValidateGooglePlayPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateGooglePlayPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FValidateGooglePlayPurchaseResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FValidateGooglePlayPurchaseResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FValidateGooglePlayPurchaseResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::ValidateIOSReceipt(
     ClientModels::FValidateIOSReceiptRequest& request,
     const FValidateIOSReceiptDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -5250,29 +5748,32 @@ bool UPlayFabClientAPI::ValidateIOSReceipt(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ValidateIOSReceipt"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ValidateIOSReceipt"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnValidateIOSReceiptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FValidateIOSReceiptResult>> UPlayFabClientAPI::ValidateIOSReceiptAsync(ClientModels::FValidateIOSReceiptRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FValidateIOSReceiptResult, FValidateIOSReceiptDelegate>([this, &request, &Handle](const FValidateIOSReceiptDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::ValidateIOSReceipt(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnValidateIOSReceiptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateIOSReceiptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FValidateIOSReceiptResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FValidateIOSReceiptResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FValidateIOSReceiptResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::ValidateWindowsStoreReceipt(
     ClientModels::FValidateWindowsReceiptRequest& request,
     const FValidateWindowsStoreReceiptDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -5281,29 +5782,32 @@ bool UPlayFabClientAPI::ValidateWindowsStoreReceipt(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ValidateWindowsStoreReceipt"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/ValidateWindowsStoreReceipt"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnValidateWindowsStoreReceiptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FValidateWindowsReceiptResult>> UPlayFabClientAPI::ValidateWindowsStoreReceiptAsync(ClientModels::FValidateWindowsReceiptRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FValidateWindowsReceiptResult, FValidateWindowsStoreReceiptDelegate>([this, &request, &Handle](const FValidateWindowsStoreReceiptDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::ValidateWindowsStoreReceipt(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnValidateWindowsStoreReceiptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateWindowsStoreReceiptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FValidateWindowsReceiptResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FValidateWindowsReceiptResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FValidateWindowsReceiptResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::WriteCharacterEvent(
     ClientModels::FWriteClientCharacterEventRequest& request,
     const FWriteCharacterEventDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -5312,29 +5816,32 @@ bool UPlayFabClientAPI::WriteCharacterEvent(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/WriteCharacterEvent"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/WriteCharacterEvent"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnWriteCharacterEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Low, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FWriteEventResponse>> UPlayFabClientAPI::WriteCharacterEventAsync(ClientModels::FWriteClientCharacterEventRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FWriteEventResponse, FWriteCharacterEventDelegate>([this, &request, &Handle](const FWriteCharacterEventDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::WriteCharacterEvent(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnWriteCharacterEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteCharacterEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FWriteEventResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FWriteEventResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FWriteEventResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::WritePlayerEvent(
     ClientModels::FWriteClientPlayerEventRequest& request,
     const FWritePlayerEventDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -5343,29 +5850,32 @@ bool UPlayFabClientAPI::WritePlayerEvent(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/WritePlayerEvent"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/WritePlayerEvent"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnWritePlayerEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Low, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FWriteEventResponse>> UPlayFabClientAPI::WritePlayerEventAsync(ClientModels::FWriteClientPlayerEventRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FWriteEventResponse, FWritePlayerEventDelegate>([this, &request, &Handle](const FWritePlayerEventDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::WritePlayerEvent(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnWritePlayerEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWritePlayerEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FWriteEventResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FWriteEventResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FWriteEventResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientAPI::WriteTitleEvent(
     ClientModels::FWriteTitleEventRequest& request,
     const FWriteTitleEventDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString clientTicket = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetClientSessionTicket() : PlayFabSettings::GetClientSessionTicket();
     if(clientTicket.Len() == 0) {
@@ -5374,21 +5884,23 @@ bool UPlayFabClientAPI::WriteTitleEvent(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/WriteTitleEvent"), request.toJSONString(), TEXT("X-Authorization"), clientTicket);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Client/WriteTitleEvent"), request.toJSONUtf8(), TEXT("X-Authorization"), clientTicket);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientAPI::OnWriteTitleEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Low, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FWriteEventResponse>> UPlayFabClientAPI::WriteTitleEventAsync(ClientModels::FWriteTitleEventRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FWriteEventResponse, FWriteTitleEventDelegate>([this, &request, &Handle](const FWriteTitleEventDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientAPI::WriteTitleEvent(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientAPI::OnWriteTitleEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteTitleEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FWriteEventResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FWriteEventResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FWriteEventResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
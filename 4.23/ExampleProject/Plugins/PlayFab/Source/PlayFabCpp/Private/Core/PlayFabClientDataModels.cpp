@@ -7,6 +7,7 @@
 
 #include "Core/PlayFabClientDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
+#include "Core/PlayFabJsonPullReader.h"
 
 using namespace PlayFab;
 using namespace PlayFab::ClientModels;
@@ -16,7 +17,8 @@ PlayFab::ClientModels::FAcceptTradeRequest::~FAcceptTradeRequest()
 
 }
 
-void PlayFab::ClientModels::FAcceptTradeRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FAcceptTradeRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -52,6 +54,16 @@ void PlayFab::ClientModels::FAcceptTradeRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FAcceptTradeRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAcceptTradeRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FAcceptTradeRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -75,7 +87,49 @@ bool PlayFab::ClientModels::FAcceptTradeRequest::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
-void PlayFab::ClientModels::writeTradeStatusEnumJSON(TradeStatus enumVal, JsonWriter& writer)
+bool PlayFab::ClientModels::FAcceptTradeRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AcceptedInventoryInstanceIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { AcceptedInventoryInstanceIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("OfferingPlayerId"))
+        {
+            reader.ReadValue(OfferingPlayerId);
+        }
+        else if (reader.IsField("TradeId"))
+        {
+            reader.ReadValue(TradeId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAcceptTradeRequest();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeTradeStatusEnumValue(ClientModels::TradeStatus enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -90,6 +144,16 @@ void PlayFab::ClientModels::writeTradeStatusEnumJSON(TradeStatus enumVal, JsonWr
     }
 }
 
+void PlayFab::ClientModels::writeTradeStatusEnumJSON(TradeStatus enumVal, JsonWriter& writer)
+{
+    writeTradeStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::ClientModels::writeTradeStatusEnumJSON(TradeStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeTradeStatusEnumValue(enumVal, writer);
+}
+
 ClientModels::TradeStatus PlayFab::ClientModels::readTradeStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readTradeStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -126,7 +190,8 @@ PlayFab::ClientModels::FTradeInfo::~FTradeInfo()
 
 }
 
-void PlayFab::ClientModels::FTradeInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FTradeInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -226,6 +291,16 @@ void PlayFab::ClientModels::FTradeInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FTradeInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FTradeInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FTradeInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -286,13 +361,124 @@ bool PlayFab::ClientModels::FTradeInfo::readFromValue(const TSharedPtr<FJsonObje
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FTradeInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AcceptedInventoryInstanceIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { AcceptedInventoryInstanceIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("AcceptedPlayerId"))
+        {
+            reader.ReadValue(AcceptedPlayerId);
+        }
+        else if (reader.IsField("AllowedPlayerIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { AllowedPlayerIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("CancelledAt"))
+        {
+            reader.ReadValue(CancelledAt);
+        }
+        else if (reader.IsField("FilledAt"))
+        {
+            reader.ReadValue(FilledAt);
+        }
+        else if (reader.IsField("InvalidatedAt"))
+        {
+            reader.ReadValue(InvalidatedAt);
+        }
+        else if (reader.IsField("OfferedCatalogItemIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { OfferedCatalogItemIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("OfferedInventoryInstanceIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { OfferedInventoryInstanceIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("OfferingPlayerId"))
+        {
+            reader.ReadValue(OfferingPlayerId);
+        }
+        else if (reader.IsField("OpenedAt"))
+        {
+            reader.ReadValue(OpenedAt);
+        }
+        else if (reader.IsField("RequestedCatalogItemIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { RequestedCatalogItemIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Status"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Status = readTradeStatusFromValue(TmpValue); }
+        }
+        else if (reader.IsField("TradeId"))
+        {
+            reader.ReadValue(TradeId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FTradeInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FAcceptTradeResponse::~FAcceptTradeResponse()
 {
     //if (Trade != nullptr) delete Trade;
 
 }
 
-void PlayFab::ClientModels::FAcceptTradeResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FAcceptTradeResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -305,6 +491,16 @@ void PlayFab::ClientModels::FAcceptTradeResponse::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FAcceptTradeResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAcceptTradeResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FAcceptTradeResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -312,13 +508,41 @@ bool PlayFab::ClientModels::FAcceptTradeResponse::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonValue> TradeValue = obj->TryGetField(TEXT("Trade"));
     if (TradeValue.IsValid() && !TradeValue->IsNull())
     {
-        Trade = MakeShareable(new FTradeInfo(TradeValue->AsObject()));
+        Trade = MakeShared<FTradeInfo>(TradeValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
-void PlayFab::ClientModels::writeAdActivityEnumJSON(AdActivity enumVal, JsonWriter& writer)
+bool PlayFab::ClientModels::FAcceptTradeResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Trade"))
+        {
+            Trade = MakeShared<FTradeInfo>();
+            Trade->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAcceptTradeResponse();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeAdActivityEnumValue(ClientModels::AdActivity enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -330,6 +554,16 @@ void PlayFab::ClientModels::writeAdActivityEnumJSON(AdActivity enumVal, JsonWrit
     }
 }
 
+void PlayFab::ClientModels::writeAdActivityEnumJSON(AdActivity enumVal, JsonWriter& writer)
+{
+    writeAdActivityEnumValue(enumVal, writer);
+}
+
+void PlayFab::ClientModels::writeAdActivityEnumJSON(AdActivity enumVal, JsonUtf8Writer& writer)
+{
+    writeAdActivityEnumValue(enumVal, writer);
+}
+
 ClientModels::AdActivity PlayFab::ClientModels::readAdActivityFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readAdActivityFromValue(value.IsValid() ? value->AsString() : "");
@@ -363,7 +597,8 @@ PlayFab::ClientModels::FAdCampaignAttributionModel::~FAdCampaignAttributionModel
 
 }
 
-void PlayFab::ClientModels::FAdCampaignAttributionModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FAdCampaignAttributionModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -385,6 +620,16 @@ void PlayFab::ClientModels::FAdCampaignAttributionModel::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FAdCampaignAttributionModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAdCampaignAttributionModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FAdCampaignAttributionModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -411,12 +656,47 @@ bool PlayFab::ClientModels::FAdCampaignAttributionModel::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FAdCampaignAttributionModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AttributedAt"))
+        {
+            reader.ReadValue(AttributedAt);
+        }
+        else if (reader.IsField("CampaignId"))
+        {
+            reader.ReadValue(CampaignId);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            reader.ReadValue(Platform);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAdCampaignAttributionModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FAddFriendRequest::~FAddFriendRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FAddFriendRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FAddFriendRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -447,6 +727,16 @@ void PlayFab::ClientModels::FAddFriendRequest::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FAddFriendRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAddFriendRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FAddFriendRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -482,12 +772,51 @@ bool PlayFab::ClientModels::FAddFriendRequest::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FAddFriendRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FriendEmail"))
+        {
+            reader.ReadValue(FriendEmail);
+        }
+        else if (reader.IsField("FriendPlayFabId"))
+        {
+            reader.ReadValue(FriendPlayFabId);
+        }
+        else if (reader.IsField("FriendTitleDisplayName"))
+        {
+            reader.ReadValue(FriendTitleDisplayName);
+        }
+        else if (reader.IsField("FriendUsername"))
+        {
+            reader.ReadValue(FriendUsername);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddFriendRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FAddFriendResult::~FAddFriendResult()
 {
 
 }
 
-void PlayFab::ClientModels::FAddFriendResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FAddFriendResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -497,6 +826,16 @@ void PlayFab::ClientModels::FAddFriendResult::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FAddFriendResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAddFriendResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FAddFriendResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -511,12 +850,39 @@ bool PlayFab::ClientModels::FAddFriendResult::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FAddFriendResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddFriendResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGenericServiceId::~FGenericServiceId()
 {
 
 }
 
-void PlayFab::ClientModels::FGenericServiceId::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGenericServiceId::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -543,6 +909,16 @@ void PlayFab::ClientModels::FGenericServiceId::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGenericServiceId::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGenericServiceId::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGenericServiceId::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -564,12 +940,43 @@ bool PlayFab::ClientModels::FGenericServiceId::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGenericServiceId::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ServiceName"))
+        {
+            reader.ReadValue(ServiceName);
+        }
+        else if (reader.IsField("UserId"))
+        {
+            reader.ReadValue(UserId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGenericServiceId();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FAddGenericIDRequest::~FAddGenericIDRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FAddGenericIDRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FAddGenericIDRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -579,6 +986,16 @@ void PlayFab::ClientModels::FAddGenericIDRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FAddGenericIDRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAddGenericIDRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FAddGenericIDRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -592,18 +1009,55 @@ bool PlayFab::ClientModels::FAddGenericIDRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FAddGenericIDRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GenericId"))
+        {
+            GenericId.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddGenericIDRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FAddGenericIDResult::~FAddGenericIDResult()
 {
 
 }
 
-void PlayFab::ClientModels::FAddGenericIDResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FAddGenericIDResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FAddGenericIDResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAddGenericIDResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FAddGenericIDResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -611,12 +1065,34 @@ bool PlayFab::ClientModels::FAddGenericIDResult::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FAddGenericIDResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddGenericIDResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FAddOrUpdateContactEmailRequest::~FAddOrUpdateContactEmailRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FAddOrUpdateContactEmailRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FAddOrUpdateContactEmailRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -644,6 +1120,16 @@ void PlayFab::ClientModels::FAddOrUpdateContactEmailRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FAddOrUpdateContactEmailRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAddOrUpdateContactEmailRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FAddOrUpdateContactEmailRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -653,7 +1139,7 @@ bool PlayFab::ClientModels::FAddOrUpdateContactEmailRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -667,16 +1153,64 @@ bool PlayFab::ClientModels::FAddOrUpdateContactEmailRequest::readFromValue(const
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FAddOrUpdateContactEmailResult::~FAddOrUpdateContactEmailResult()
+bool PlayFab::ClientModels::FAddOrUpdateContactEmailRequest::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::ClientModels::FAddOrUpdateContactEmailResult::writeJSON(JsonWriter& writer) const
-{
-    writer->WriteObjectStart();
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EmailAddress"))
+        {
+            reader.ReadValue(EmailAddress);
+        }
+        else
+            reader.SkipValue();
+    }
 
-    writer->WriteObjectEnd();
+    if (!reader.IsValid())
+    {
+        *this = FAddOrUpdateContactEmailRequest();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FAddOrUpdateContactEmailResult::~FAddOrUpdateContactEmailResult()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FAddOrUpdateContactEmailResult::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
+
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::ClientModels::FAddOrUpdateContactEmailResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAddOrUpdateContactEmailResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::ClientModels::FAddOrUpdateContactEmailResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -686,12 +1220,34 @@ bool PlayFab::ClientModels::FAddOrUpdateContactEmailResult::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FAddOrUpdateContactEmailResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddOrUpdateContactEmailResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FAddSharedGroupMembersRequest::~FAddSharedGroupMembersRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FAddSharedGroupMembersRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FAddSharedGroupMembersRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -714,6 +1270,16 @@ void PlayFab::ClientModels::FAddSharedGroupMembersRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FAddSharedGroupMembersRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAddSharedGroupMembersRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FAddSharedGroupMembersRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -730,18 +1296,66 @@ bool PlayFab::ClientModels::FAddSharedGroupMembersRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FAddSharedGroupMembersRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { PlayFabIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("SharedGroupId"))
+        {
+            reader.ReadValue(SharedGroupId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddSharedGroupMembersRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FAddSharedGroupMembersResult::~FAddSharedGroupMembersResult()
 {
 
 }
 
-void PlayFab::ClientModels::FAddSharedGroupMembersResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FAddSharedGroupMembersResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FAddSharedGroupMembersResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAddSharedGroupMembersResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FAddSharedGroupMembersResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -749,12 +1363,34 @@ bool PlayFab::ClientModels::FAddSharedGroupMembersResult::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FAddSharedGroupMembersResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddSharedGroupMembersResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FAddUsernamePasswordRequest::~FAddUsernamePasswordRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FAddUsernamePasswordRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FAddUsernamePasswordRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -802,6 +1438,16 @@ void PlayFab::ClientModels::FAddUsernamePasswordRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FAddUsernamePasswordRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAddUsernamePasswordRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FAddUsernamePasswordRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -811,7 +1457,7 @@ bool PlayFab::ClientModels::FAddUsernamePasswordRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -839,12 +1485,58 @@ bool PlayFab::ClientModels::FAddUsernamePasswordRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FAddUsernamePasswordRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Email"))
+        {
+            reader.ReadValue(Email);
+        }
+        else if (reader.IsField("Password"))
+        {
+            reader.ReadValue(Password);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddUsernamePasswordRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FAddUsernamePasswordResult::~FAddUsernamePasswordResult()
 {
 
 }
 
-void PlayFab::ClientModels::FAddUsernamePasswordResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FAddUsernamePasswordResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -857,6 +1549,16 @@ void PlayFab::ClientModels::FAddUsernamePasswordResult::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FAddUsernamePasswordResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAddUsernamePasswordResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FAddUsernamePasswordResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -871,12 +1573,39 @@ bool PlayFab::ClientModels::FAddUsernamePasswordResult::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FAddUsernamePasswordResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddUsernamePasswordResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FAddUserVirtualCurrencyRequest::~FAddUserVirtualCurrencyRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FAddUserVirtualCurrencyRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FAddUserVirtualCurrencyRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -907,6 +1636,16 @@ void PlayFab::ClientModels::FAddUserVirtualCurrencyRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FAddUserVirtualCurrencyRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAddUserVirtualCurrencyRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FAddUserVirtualCurrencyRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -923,7 +1662,7 @@ bool PlayFab::ClientModels::FAddUserVirtualCurrencyRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -937,12 +1676,54 @@ bool PlayFab::ClientModels::FAddUserVirtualCurrencyRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FAddUserVirtualCurrencyRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Amount"))
+        {
+            reader.ReadValue(Amount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            reader.ReadValue(VirtualCurrency);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddUserVirtualCurrencyRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FAdPlacementDetails::~FAdPlacementDetails()
 {
 
 }
 
-void PlayFab::ClientModels::FAdPlacementDetails::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FAdPlacementDetails::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -997,6 +1778,16 @@ void PlayFab::ClientModels::FAdPlacementDetails::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FAdPlacementDetails::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAdPlacementDetails::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FAdPlacementDetails::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1060,12 +1851,67 @@ bool PlayFab::ClientModels::FAdPlacementDetails::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FAdPlacementDetails::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlacementId"))
+        {
+            reader.ReadValue(PlacementId);
+        }
+        else if (reader.IsField("PlacementName"))
+        {
+            reader.ReadValue(PlacementName);
+        }
+        else if (reader.IsField("PlacementViewsRemaining"))
+        {
+            reader.ReadValue(PlacementViewsRemaining);
+        }
+        else if (reader.IsField("PlacementViewsResetMinutes"))
+        {
+            reader.ReadValue(PlacementViewsResetMinutes);
+        }
+        else if (reader.IsField("RewardAssetUrl"))
+        {
+            reader.ReadValue(RewardAssetUrl);
+        }
+        else if (reader.IsField("RewardDescription"))
+        {
+            reader.ReadValue(RewardDescription);
+        }
+        else if (reader.IsField("RewardId"))
+        {
+            reader.ReadValue(RewardId);
+        }
+        else if (reader.IsField("RewardName"))
+        {
+            reader.ReadValue(RewardName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAdPlacementDetails();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FAdRewardItemGranted::~FAdRewardItemGranted()
 {
 
 }
 
-void PlayFab::ClientModels::FAdRewardItemGranted::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FAdRewardItemGranted::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1096,6 +1942,16 @@ void PlayFab::ClientModels::FAdRewardItemGranted::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FAdRewardItemGranted::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAdRewardItemGranted::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FAdRewardItemGranted::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1131,12 +1987,51 @@ bool PlayFab::ClientModels::FAdRewardItemGranted::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FAdRewardItemGranted::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogId"))
+        {
+            reader.ReadValue(CatalogId);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("InstanceId"))
+        {
+            reader.ReadValue(InstanceId);
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAdRewardItemGranted();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FAdRewardResults::~FAdRewardResults()
 {
 
 }
 
-void PlayFab::ClientModels::FAdRewardResults::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FAdRewardResults::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1174,6 +2069,16 @@ void PlayFab::ClientModels::FAdRewardResults::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FAdRewardResults::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAdRewardResults::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FAdRewardResults::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1182,7 +2087,7 @@ bool PlayFab::ClientModels::FAdRewardResults::readFromValue(const TSharedPtr<FJs
     for (int32 Idx = 0; Idx < GrantedItemsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GrantedItemsArray[Idx];
-        GrantedItems.Add(FAdRewardItemGranted(CurrentItem->AsObject()));
+        GrantedItems.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -1192,7 +2097,7 @@ bool PlayFab::ClientModels::FAdRewardResults::readFromValue(const TSharedPtr<FJs
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*GrantedVirtualCurrenciesObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            GrantedVirtualCurrencies.Add(It.Key(), TmpValue);
+            GrantedVirtualCurrencies.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -1202,19 +2107,75 @@ bool PlayFab::ClientModels::FAdRewardResults::readFromValue(const TSharedPtr<FJs
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*IncrementedStatisticsObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            IncrementedStatistics.Add(It.Key(), TmpValue);
+            IncrementedStatistics.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FAdRewardResults::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GrantedItems"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GrantedItems[GrantedItems.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("GrantedVirtualCurrencies"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { GrantedVirtualCurrencies.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("IncrementedStatistics"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { IncrementedStatistics.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAdRewardResults();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FAndroidDevicePushNotificationRegistrationRequest::~FAndroidDevicePushNotificationRegistrationRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FAndroidDevicePushNotificationRegistrationRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FAndroidDevicePushNotificationRegistrationRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1243,6 +2204,16 @@ void PlayFab::ClientModels::FAndroidDevicePushNotificationRegistrationRequest::w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FAndroidDevicePushNotificationRegistrationRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAndroidDevicePushNotificationRegistrationRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FAndroidDevicePushNotificationRegistrationRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1271,18 +2242,63 @@ bool PlayFab::ClientModels::FAndroidDevicePushNotificationRegistrationRequest::r
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FAndroidDevicePushNotificationRegistrationRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ConfirmationMessage"))
+        {
+            reader.ReadValue(ConfirmationMessage);
+        }
+        else if (reader.IsField("DeviceToken"))
+        {
+            reader.ReadValue(DeviceToken);
+        }
+        else if (reader.IsField("SendPushNotificationConfirmation"))
+        {
+            reader.ReadValue(SendPushNotificationConfirmation);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAndroidDevicePushNotificationRegistrationRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FAndroidDevicePushNotificationRegistrationResult::~FAndroidDevicePushNotificationRegistrationResult()
 {
 
 }
 
-void PlayFab::ClientModels::FAndroidDevicePushNotificationRegistrationResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FAndroidDevicePushNotificationRegistrationResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FAndroidDevicePushNotificationRegistrationResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FAndroidDevicePushNotificationRegistrationResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FAndroidDevicePushNotificationRegistrationResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1290,12 +2306,34 @@ bool PlayFab::ClientModels::FAndroidDevicePushNotificationRegistrationResult::re
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FCancelTradeRequest::~FCancelTradeRequest()
+bool PlayFab::ClientModels::FAndroidDevicePushNotificationRegistrationResult::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::ClientModels::FCancelTradeRequest::writeJSON(JsonWriter& writer) const
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAndroidDevicePushNotificationRegistrationResult();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FCancelTradeRequest::~FCancelTradeRequest()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FCancelTradeRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1312,6 +2350,16 @@ void PlayFab::ClientModels::FCancelTradeRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FCancelTradeRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FCancelTradeRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FCancelTradeRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1326,13 +2374,40 @@ bool PlayFab::ClientModels::FCancelTradeRequest::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FCancelTradeRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TradeId"))
+        {
+            reader.ReadValue(TradeId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCancelTradeRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FCancelTradeResponse::~FCancelTradeResponse()
 {
     //if (Trade != nullptr) delete Trade;
 
 }
 
-void PlayFab::ClientModels::FCancelTradeResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FCancelTradeResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1345,6 +2420,16 @@ void PlayFab::ClientModels::FCancelTradeResponse::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FCancelTradeResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FCancelTradeResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FCancelTradeResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1352,18 +2437,46 @@ bool PlayFab::ClientModels::FCancelTradeResponse::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonValue> TradeValue = obj->TryGetField(TEXT("Trade"));
     if (TradeValue.IsValid() && !TradeValue->IsNull())
     {
-        Trade = MakeShareable(new FTradeInfo(TradeValue->AsObject()));
+        Trade = MakeShared<FTradeInfo>(TradeValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FCancelTradeResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Trade"))
+        {
+            Trade = MakeShared<FTradeInfo>();
+            Trade->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCancelTradeResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FCartItem::~FCartItem()
 {
 
 }
 
-void PlayFab::ClientModels::FCartItem::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FCartItem::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1433,6 +2546,16 @@ void PlayFab::ClientModels::FCartItem::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FCartItem::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FCartItem::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FCartItem::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1478,7 +2601,7 @@ bool PlayFab::ClientModels::FCartItem::readFromValue(const TSharedPtr<FJsonObjec
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*RealCurrencyPricesObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            RealCurrencyPrices.Add(It.Key(), TmpValue);
+            RealCurrencyPrices.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -1488,7 +2611,7 @@ bool PlayFab::ClientModels::FCartItem::readFromValue(const TSharedPtr<FJsonObjec
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VCAmountObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VCAmount.Add(It.Key(), TmpValue);
+            VCAmount.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -1498,19 +2621,95 @@ bool PlayFab::ClientModels::FCartItem::readFromValue(const TSharedPtr<FJsonObjec
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyPricesObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrencyPrices.Add(It.Key(), TmpValue);
+            VirtualCurrencyPrices.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FCartItem::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("ItemClass"))
+        {
+            reader.ReadValue(ItemClass);
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("RealCurrencyPrices"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { RealCurrencyPrices.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VCAmount"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VCAmount.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyPrices"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrencyPrices.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCartItem();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FCatalogItemBundleInfo::~FCatalogItemBundleInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FCatalogItemBundleInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FCatalogItemBundleInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1546,6 +2745,16 @@ void PlayFab::ClientModels::FCatalogItemBundleInfo::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FCatalogItemBundleInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FCatalogItemBundleInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FCatalogItemBundleInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1560,19 +2769,75 @@ bool PlayFab::ClientModels::FCatalogItemBundleInfo::readFromValue(const TSharedP
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*BundledVirtualCurrenciesObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            BundledVirtualCurrencies.Add(It.Key(), TmpValue);
+            BundledVirtualCurrencies.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FCatalogItemBundleInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BundledItems"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { BundledItems.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("BundledResultTables"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { BundledResultTables.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("BundledVirtualCurrencies"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { BundledVirtualCurrencies.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCatalogItemBundleInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FCatalogItemConsumableInfo::~FCatalogItemConsumableInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FCatalogItemConsumableInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FCatalogItemConsumableInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1597,6 +2862,16 @@ void PlayFab::ClientModels::FCatalogItemConsumableInfo::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FCatalogItemConsumableInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FCatalogItemConsumableInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FCatalogItemConsumableInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1625,12 +2900,47 @@ bool PlayFab::ClientModels::FCatalogItemConsumableInfo::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FCatalogItemConsumableInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("UsageCount"))
+        {
+            reader.ReadValue(UsageCount);
+        }
+        else if (reader.IsField("UsagePeriod"))
+        {
+            reader.ReadValue(UsagePeriod);
+        }
+        else if (reader.IsField("UsagePeriodGroup"))
+        {
+            reader.ReadValue(UsagePeriodGroup);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCatalogItemConsumableInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FCatalogItemContainerInfo::~FCatalogItemContainerInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FCatalogItemContainerInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FCatalogItemContainerInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1672,6 +2982,16 @@ void PlayFab::ClientModels::FCatalogItemContainerInfo::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FCatalogItemContainerInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FCatalogItemContainerInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FCatalogItemContainerInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1693,13 +3013,72 @@ bool PlayFab::ClientModels::FCatalogItemContainerInfo::readFromValue(const TShar
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyContentsObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrencyContents.Add(It.Key(), TmpValue);
+            VirtualCurrencyContents.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FCatalogItemContainerInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ItemContents"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ItemContents.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("KeyItemId"))
+        {
+            reader.ReadValue(KeyItemId);
+        }
+        else if (reader.IsField("ResultTableContents"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ResultTableContents.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyContents"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrencyContents.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCatalogItemContainerInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FCatalogItem::~FCatalogItem()
 {
     //if (Bundle != nullptr) delete Bundle;
@@ -1708,7 +3087,8 @@ PlayFab::ClientModels::FCatalogItem::~FCatalogItem()
 
 }
 
-void PlayFab::ClientModels::FCatalogItem::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FCatalogItem::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1825,6 +3205,16 @@ void PlayFab::ClientModels::FCatalogItem::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FCatalogItem::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FCatalogItem::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1832,7 +3222,7 @@ bool PlayFab::ClientModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonOb
     const TSharedPtr<FJsonValue> BundleValue = obj->TryGetField(TEXT("Bundle"));
     if (BundleValue.IsValid() && !BundleValue->IsNull())
     {
-        Bundle = MakeShareable(new FCatalogItemBundleInfo(BundleValue->AsObject()));
+        Bundle = MakeShared<FCatalogItemBundleInfo>(BundleValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> CanBecomeCharacterValue = obj->TryGetField(TEXT("CanBecomeCharacter"));
@@ -1852,13 +3242,13 @@ bool PlayFab::ClientModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonOb
     const TSharedPtr<FJsonValue> ConsumableValue = obj->TryGetField(TEXT("Consumable"));
     if (ConsumableValue.IsValid() && !ConsumableValue->IsNull())
     {
-        Consumable = MakeShareable(new FCatalogItemConsumableInfo(ConsumableValue->AsObject()));
+        Consumable = MakeShared<FCatalogItemConsumableInfo>(ConsumableValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ContainerValue = obj->TryGetField(TEXT("Container"));
     if (ContainerValue.IsValid() && !ContainerValue->IsNull())
     {
-        Container = MakeShareable(new FCatalogItemContainerInfo(ContainerValue->AsObject()));
+        Container = MakeShared<FCatalogItemContainerInfo>(ContainerValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> CustomDataValue = obj->TryGetField(TEXT("CustomData"));
@@ -1937,7 +3327,7 @@ bool PlayFab::ClientModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonOb
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*RealCurrencyPricesObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            RealCurrencyPrices.Add(It.Key(), TmpValue);
+            RealCurrencyPrices.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -1949,19 +3339,138 @@ bool PlayFab::ClientModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonOb
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyPricesObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrencyPrices.Add(It.Key(), TmpValue);
+            VirtualCurrencyPrices.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FCatalogItem::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Bundle"))
+        {
+            Bundle = MakeShared<FCatalogItemBundleInfo>();
+            Bundle->readFromReader(reader);
+        }
+        else if (reader.IsField("CanBecomeCharacter"))
+        {
+            reader.ReadValue(CanBecomeCharacter);
+        }
+        else if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("Consumable"))
+        {
+            Consumable = MakeShared<FCatalogItemConsumableInfo>();
+            Consumable->readFromReader(reader);
+        }
+        else if (reader.IsField("Container"))
+        {
+            Container = MakeShared<FCatalogItemContainerInfo>();
+            Container->readFromReader(reader);
+        }
+        else if (reader.IsField("CustomData"))
+        {
+            reader.ReadValue(CustomData);
+        }
+        else if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("InitialLimitedEditionCount"))
+        {
+            reader.ReadValue(InitialLimitedEditionCount);
+        }
+        else if (reader.IsField("IsLimitedEdition"))
+        {
+            reader.ReadValue(IsLimitedEdition);
+        }
+        else if (reader.IsField("IsStackable"))
+        {
+            reader.ReadValue(IsStackable);
+        }
+        else if (reader.IsField("IsTradable"))
+        {
+            reader.ReadValue(IsTradable);
+        }
+        else if (reader.IsField("ItemClass"))
+        {
+            reader.ReadValue(ItemClass);
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else if (reader.IsField("ItemImageUrl"))
+        {
+            reader.ReadValue(ItemImageUrl);
+        }
+        else if (reader.IsField("RealCurrencyPrices"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { RealCurrencyPrices.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Tags.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyPrices"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrencyPrices.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCatalogItem();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FItemInstance::~FItemInstance()
 {
 
 }
 
-void PlayFab::ClientModels::FItemInstance::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FItemInstance::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2063,6 +3572,16 @@ void PlayFab::ClientModels::FItemInstance::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FItemInstance::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FItemInstance::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FItemInstance::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2095,7 +3614,7 @@ bool PlayFab::ClientModels::FItemInstance::readFromValue(const TSharedPtr<FJsonO
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomDataObject)->Values); It; ++It)
         {
-            CustomData.Add(It.Key(), It.Value()->AsString());
+            CustomData.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2168,61 +3687,206 @@ bool PlayFab::ClientModels::FItemInstance::readFromValue(const TSharedPtr<FJsonO
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FCharacterInventory::~FCharacterInventory()
-{
-
-}
-
-void PlayFab::ClientModels::FCharacterInventory::writeJSON(JsonWriter& writer) const
-{
-    writer->WriteObjectStart();
-
-    if (CharacterId.IsEmpty() == false)
-    {
-        writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
-    }
-
-    if (Inventory.Num() != 0)
-    {
-        writer->WriteArrayStart(TEXT("Inventory"));
-        for (const FItemInstance& item : Inventory)
-            item.writeJSON(writer);
-        writer->WriteArrayEnd();
-    }
-
-
-    writer->WriteObjectEnd();
-}
-
-bool PlayFab::ClientModels::FCharacterInventory::readFromValue(const TSharedPtr<FJsonObject>& obj)
+bool PlayFab::ClientModels::FItemInstance::readFromReader(FPlayFabJsonPullReader& reader)
 {
-    bool HasSucceeded = true;
+    if (!reader.ReadObjectStart())
+        return false;
 
-    const TSharedPtr<FJsonValue> CharacterIdValue = obj->TryGetField(TEXT("CharacterId"));
-    if (CharacterIdValue.IsValid() && !CharacterIdValue->IsNull())
+    while (reader.NextField())
     {
-        FString TmpValue;
-        if (CharacterIdValue->TryGetString(TmpValue)) { CharacterId = TmpValue; }
-    }
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Annotation"))
+        {
+            reader.ReadValue(Annotation);
+        }
+        else if (reader.IsField("BundleContents"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { BundleContents.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("BundleParent"))
+        {
+            reader.ReadValue(BundleParent);
+        }
+        else if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomData"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomData.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("Expiration"))
+        {
+            reader.ReadValue(Expiration);
+        }
+        else if (reader.IsField("ItemClass"))
+        {
+            reader.ReadValue(ItemClass);
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("PurchaseDate"))
+        {
+            reader.ReadValue(PurchaseDate);
+        }
+        else if (reader.IsField("RemainingUses"))
+        {
+            reader.ReadValue(RemainingUses);
+        }
+        else if (reader.IsField("UnitCurrency"))
+        {
+            reader.ReadValue(UnitCurrency);
+        }
+        else if (reader.IsField("UnitPrice"))
+        {
+            reader.ReadValue(UnitPrice);
+        }
+        else if (reader.IsField("UsesIncrementedBy"))
+        {
+            reader.ReadValue(UsesIncrementedBy);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FItemInstance();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FCharacterInventory::~FCharacterInventory()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FCharacterInventory::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
+
+    if (CharacterId.IsEmpty() == false)
+    {
+        writer->WriteIdentifierPrefix(TEXT("CharacterId"));
+        writer->WriteValue(CharacterId);
+    }
+
+    if (Inventory.Num() != 0)
+    {
+        writer->WriteArrayStart(TEXT("Inventory"));
+        for (const FItemInstance& item : Inventory)
+            item.writeJSON(writer);
+        writer->WriteArrayEnd();
+    }
+
+
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::ClientModels::FCharacterInventory::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FCharacterInventory::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
+bool PlayFab::ClientModels::FCharacterInventory::readFromValue(const TSharedPtr<FJsonObject>& obj)
+{
+    bool HasSucceeded = true;
+
+    const TSharedPtr<FJsonValue> CharacterIdValue = obj->TryGetField(TEXT("CharacterId"));
+    if (CharacterIdValue.IsValid() && !CharacterIdValue->IsNull())
+    {
+        FString TmpValue;
+        if (CharacterIdValue->TryGetString(TmpValue)) { CharacterId = TmpValue; }
+    }
 
     const TArray<TSharedPtr<FJsonValue>>&InventoryArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Inventory"));
     for (int32 Idx = 0; Idx < InventoryArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = InventoryArray[Idx];
-        Inventory.Add(FItemInstance(CurrentItem->AsObject()));
+        Inventory.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FCharacterInventory::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("Inventory"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Inventory[Inventory.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCharacterInventory();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FCharacterLeaderboardEntry::~FCharacterLeaderboardEntry()
 {
 
 }
 
-void PlayFab::ClientModels::FCharacterLeaderboardEntry::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FCharacterLeaderboardEntry::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2265,6 +3929,16 @@ void PlayFab::ClientModels::FCharacterLeaderboardEntry::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FCharacterLeaderboardEntry::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FCharacterLeaderboardEntry::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FCharacterLeaderboardEntry::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2321,12 +3995,63 @@ bool PlayFab::ClientModels::FCharacterLeaderboardEntry::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FCharacterLeaderboardEntry::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CharacterName"))
+        {
+            reader.ReadValue(CharacterName);
+        }
+        else if (reader.IsField("CharacterType"))
+        {
+            reader.ReadValue(CharacterType);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Position"))
+        {
+            reader.ReadValue(Position);
+        }
+        else if (reader.IsField("StatValue"))
+        {
+            reader.ReadValue(StatValue);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCharacterLeaderboardEntry();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FCharacterResult::~FCharacterResult()
 {
 
 }
 
-void PlayFab::ClientModels::FCharacterResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FCharacterResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2351,6 +4076,16 @@ void PlayFab::ClientModels::FCharacterResult::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FCharacterResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FCharacterResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FCharacterResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2379,7 +4114,42 @@ bool PlayFab::ClientModels::FCharacterResult::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
-void PlayFab::ClientModels::writeCloudScriptRevisionOptionEnumJSON(CloudScriptRevisionOption enumVal, JsonWriter& writer)
+bool PlayFab::ClientModels::FCharacterResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CharacterName"))
+        {
+            reader.ReadValue(CharacterName);
+        }
+        else if (reader.IsField("CharacterType"))
+        {
+            reader.ReadValue(CharacterType);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCharacterResult();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeCloudScriptRevisionOptionEnumValue(ClientModels::CloudScriptRevisionOption enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -2390,6 +4160,16 @@ void PlayFab::ClientModels::writeCloudScriptRevisionOptionEnumJSON(CloudScriptRe
     }
 }
 
+void PlayFab::ClientModels::writeCloudScriptRevisionOptionEnumJSON(CloudScriptRevisionOption enumVal, JsonWriter& writer)
+{
+    writeCloudScriptRevisionOptionEnumValue(enumVal, writer);
+}
+
+void PlayFab::ClientModels::writeCloudScriptRevisionOptionEnumJSON(CloudScriptRevisionOption enumVal, JsonUtf8Writer& writer)
+{
+    writeCloudScriptRevisionOptionEnumValue(enumVal, writer);
+}
+
 ClientModels::CloudScriptRevisionOption PlayFab::ClientModels::readCloudScriptRevisionOptionFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readCloudScriptRevisionOptionFromValue(value.IsValid() ? value->AsString() : "");
@@ -2422,7 +4202,8 @@ PlayFab::ClientModels::FContainer_Dictionary_String_String::~FContainer_Dictiona
 
 }
 
-void PlayFab::ClientModels::FContainer_Dictionary_String_String::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FContainer_Dictionary_String_String::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2440,6 +4221,16 @@ void PlayFab::ClientModels::FContainer_Dictionary_String_String::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FContainer_Dictionary_String_String::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FContainer_Dictionary_String_String::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FContainer_Dictionary_String_String::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2449,19 +4240,53 @@ bool PlayFab::ClientModels::FContainer_Dictionary_String_String::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FContainer_Dictionary_String_String::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FContainer_Dictionary_String_String();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FCollectionFilter::~FCollectionFilter()
 {
 
 }
 
-void PlayFab::ClientModels::FCollectionFilter::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FCollectionFilter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2486,6 +4311,16 @@ void PlayFab::ClientModels::FCollectionFilter::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FCollectionFilter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FCollectionFilter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FCollectionFilter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2494,7 +4329,7 @@ bool PlayFab::ClientModels::FCollectionFilter::readFromValue(const TSharedPtr<FJ
     for (int32 Idx = 0; Idx < ExcludesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ExcludesArray[Idx];
-        Excludes.Add(FContainer_Dictionary_String_String(CurrentItem->AsObject()));
+        Excludes.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2502,19 +4337,64 @@ bool PlayFab::ClientModels::FCollectionFilter::readFromValue(const TSharedPtr<FJ
     for (int32 Idx = 0; Idx < IncludesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = IncludesArray[Idx];
-        Includes.Add(FContainer_Dictionary_String_String(CurrentItem->AsObject()));
+        Includes.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FCollectionFilter::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Excludes"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Excludes[Excludes.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Includes"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Includes[Includes.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCollectionFilter();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FConfirmPurchaseRequest::~FConfirmPurchaseRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FConfirmPurchaseRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FConfirmPurchaseRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2542,6 +4422,16 @@ void PlayFab::ClientModels::FConfirmPurchaseRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FConfirmPurchaseRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FConfirmPurchaseRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FConfirmPurchaseRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2551,7 +4441,7 @@ bool PlayFab::ClientModels::FConfirmPurchaseRequest::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2565,12 +4455,50 @@ bool PlayFab::ClientModels::FConfirmPurchaseRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FConfirmPurchaseRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("OrderId"))
+        {
+            reader.ReadValue(OrderId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FConfirmPurchaseRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FConfirmPurchaseResult::~FConfirmPurchaseResult()
 {
 
 }
 
-void PlayFab::ClientModels::FConfirmPurchaseResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FConfirmPurchaseResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2595,6 +4523,16 @@ void PlayFab::ClientModels::FConfirmPurchaseResult::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FConfirmPurchaseResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FConfirmPurchaseResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FConfirmPurchaseResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2603,7 +4541,7 @@ bool PlayFab::ClientModels::FConfirmPurchaseResult::readFromValue(const TSharedP
     for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FItemInstance(CurrentItem->AsObject()));
+        Items.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2622,12 +4560,54 @@ bool PlayFab::ClientModels::FConfirmPurchaseResult::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FConfirmPurchaseResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Items"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Items[Items.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("OrderId"))
+        {
+            reader.ReadValue(OrderId);
+        }
+        else if (reader.IsField("PurchaseDate"))
+        {
+            reader.ReadValue(PurchaseDate);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FConfirmPurchaseResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FConsumeItemRequest::~FConsumeItemRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FConsumeItemRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FConsumeItemRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2664,6 +4644,16 @@ void PlayFab::ClientModels::FConsumeItemRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FConsumeItemRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FConsumeItemRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FConsumeItemRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2687,7 +4677,7 @@ bool PlayFab::ClientModels::FConsumeItemRequest::readFromValue(const TSharedPtr<
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2701,12 +4691,58 @@ bool PlayFab::ClientModels::FConsumeItemRequest::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FConsumeItemResult::~FConsumeItemResult()
+bool PlayFab::ClientModels::FConsumeItemRequest::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::ClientModels::FConsumeItemResult::writeJSON(JsonWriter& writer) const
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("ConsumeCount"))
+        {
+            reader.ReadValue(ConsumeCount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FConsumeItemRequest();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FConsumeItemResult::~FConsumeItemResult()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FConsumeItemResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2722,6 +4758,16 @@ void PlayFab::ClientModels::FConsumeItemResult::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FConsumeItemResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FConsumeItemResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FConsumeItemResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2743,12 +4789,43 @@ bool PlayFab::ClientModels::FConsumeItemResult::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FConsumeItemResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("RemainingUses"))
+        {
+            reader.ReadValue(RemainingUses);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FConsumeItemResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FMicrosoftStorePayload::~FMicrosoftStorePayload()
 {
 
 }
 
-void PlayFab::ClientModels::FMicrosoftStorePayload::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FMicrosoftStorePayload::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2773,6 +4850,16 @@ void PlayFab::ClientModels::FMicrosoftStorePayload::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FMicrosoftStorePayload::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FMicrosoftStorePayload::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FMicrosoftStorePayload::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2801,12 +4888,47 @@ bool PlayFab::ClientModels::FMicrosoftStorePayload::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FMicrosoftStorePayload::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CollectionsMsIdKey"))
+        {
+            reader.ReadValue(CollectionsMsIdKey);
+        }
+        else if (reader.IsField("UserId"))
+        {
+            reader.ReadValue(UserId);
+        }
+        else if (reader.IsField("XboxToken"))
+        {
+            reader.ReadValue(XboxToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FMicrosoftStorePayload();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsRequest::~FConsumeMicrosoftStoreEntitlementsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2833,6 +4955,16 @@ void PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsRequest::writeJSON
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2849,7 +4981,7 @@ bool PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsRequest::readFromV
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2862,12 +4994,54 @@ bool PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsRequest::readFromV
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("MarketplaceSpecificData"))
+        {
+            MarketplaceSpecificData.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FConsumeMicrosoftStoreEntitlementsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsResponse::~FConsumeMicrosoftStoreEntitlementsResponse()
 {
 
 }
 
-void PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2883,6 +5057,16 @@ void PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsResponse::writeJSO
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2891,19 +5075,53 @@ bool PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsResponse::readFrom
     for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FItemInstance(CurrentItem->AsObject()));
+        Items.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FConsumeMicrosoftStoreEntitlementsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Items"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Items[Items.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FConsumeMicrosoftStoreEntitlementsResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FPlayStation5Payload::~FPlayStation5Payload()
 {
 
 }
 
-void PlayFab::ClientModels::FPlayStation5Payload::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FPlayStation5Payload::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2925,6 +5143,16 @@ void PlayFab::ClientModels::FPlayStation5Payload::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FPlayStation5Payload::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FPlayStation5Payload::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FPlayStation5Payload::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2941,12 +5169,50 @@ bool PlayFab::ClientModels::FPlayStation5Payload::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FPlayStation5Payload::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Ids"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Ids.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ServiceLabel"))
+        {
+            reader.ReadValue(ServiceLabel);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayStation5Payload();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FConsumePS5EntitlementsRequest::~FConsumePS5EntitlementsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FConsumePS5EntitlementsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FConsumePS5EntitlementsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2973,6 +5239,16 @@ void PlayFab::ClientModels::FConsumePS5EntitlementsRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FConsumePS5EntitlementsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FConsumePS5EntitlementsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FConsumePS5EntitlementsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2989,7 +5265,7 @@ bool PlayFab::ClientModels::FConsumePS5EntitlementsRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -3002,12 +5278,54 @@ bool PlayFab::ClientModels::FConsumePS5EntitlementsRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FConsumePS5EntitlementsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("MarketplaceSpecificData"))
+        {
+            MarketplaceSpecificData.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FConsumePS5EntitlementsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FConsumePS5EntitlementsResult::~FConsumePS5EntitlementsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FConsumePS5EntitlementsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FConsumePS5EntitlementsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3023,6 +5341,16 @@ void PlayFab::ClientModels::FConsumePS5EntitlementsResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FConsumePS5EntitlementsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FConsumePS5EntitlementsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FConsumePS5EntitlementsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3031,19 +5359,53 @@ bool PlayFab::ClientModels::FConsumePS5EntitlementsResult::readFromValue(const T
     for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FItemInstance(CurrentItem->AsObject()));
+        Items.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FConsumePS5EntitlementsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Items"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Items[Items.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FConsumePS5EntitlementsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FConsumePSNEntitlementsRequest::~FConsumePSNEntitlementsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FConsumePSNEntitlementsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FConsumePSNEntitlementsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3070,6 +5432,16 @@ void PlayFab::ClientModels::FConsumePSNEntitlementsRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FConsumePSNEntitlementsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FConsumePSNEntitlementsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FConsumePSNEntitlementsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3086,7 +5458,7 @@ bool PlayFab::ClientModels::FConsumePSNEntitlementsRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -3100,12 +5472,54 @@ bool PlayFab::ClientModels::FConsumePSNEntitlementsRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FConsumePSNEntitlementsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ServiceLabel"))
+        {
+            reader.ReadValue(ServiceLabel);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FConsumePSNEntitlementsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FConsumePSNEntitlementsResult::~FConsumePSNEntitlementsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FConsumePSNEntitlementsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FConsumePSNEntitlementsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3121,6 +5535,16 @@ void PlayFab::ClientModels::FConsumePSNEntitlementsResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FConsumePSNEntitlementsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FConsumePSNEntitlementsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FConsumePSNEntitlementsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3129,19 +5553,53 @@ bool PlayFab::ClientModels::FConsumePSNEntitlementsResult::readFromValue(const T
     for (int32 Idx = 0; Idx < ItemsGrantedArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ItemsGrantedArray[Idx];
-        ItemsGranted.Add(FItemInstance(CurrentItem->AsObject()));
+        ItemsGranted.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FConsumePSNEntitlementsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ItemsGranted"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ItemsGranted[ItemsGranted.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FConsumePSNEntitlementsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FConsumeXboxEntitlementsRequest::~FConsumeXboxEntitlementsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FConsumeXboxEntitlementsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FConsumeXboxEntitlementsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3175,6 +5633,16 @@ void PlayFab::ClientModels::FConsumeXboxEntitlementsRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FConsumeXboxEntitlementsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FConsumeXboxEntitlementsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FConsumeXboxEntitlementsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3191,7 +5659,7 @@ bool PlayFab::ClientModels::FConsumeXboxEntitlementsRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -3205,12 +5673,54 @@ bool PlayFab::ClientModels::FConsumeXboxEntitlementsRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FConsumeXboxEntitlementsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("XboxToken"))
+        {
+            reader.ReadValue(XboxToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FConsumeXboxEntitlementsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FConsumeXboxEntitlementsResult::~FConsumeXboxEntitlementsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FConsumeXboxEntitlementsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FConsumeXboxEntitlementsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3226,6 +5736,16 @@ void PlayFab::ClientModels::FConsumeXboxEntitlementsResult::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FConsumeXboxEntitlementsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FConsumeXboxEntitlementsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FConsumeXboxEntitlementsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3234,24 +5754,68 @@ bool PlayFab::ClientModels::FConsumeXboxEntitlementsResult::readFromValue(const
     for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FItemInstance(CurrentItem->AsObject()));
+        Items.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
-void PlayFab::ClientModels::writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonWriter& writer)
+bool PlayFab::ClientModels::FConsumeXboxEntitlementsResult::readFromReader(FPlayFabJsonPullReader& reader)
 {
-    switch (enumVal)
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
     {
+        if (reader.ReadNull())
+            continue;
 
-    case EmailVerificationStatusUnverified: writer->WriteValue(TEXT("Unverified")); break;
+        if (reader.IsField("Items"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Items[Items.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FConsumeXboxEntitlementsResult();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeEmailVerificationStatusEnumValue(ClientModels::EmailVerificationStatus enumVal, WriterType& writer)
+{
+    switch (enumVal)
+    {
+
+    case EmailVerificationStatusUnverified: writer->WriteValue(TEXT("Unverified")); break;
     case EmailVerificationStatusPending: writer->WriteValue(TEXT("Pending")); break;
     case EmailVerificationStatusConfirmed: writer->WriteValue(TEXT("Confirmed")); break;
     }
 }
 
+void PlayFab::ClientModels::writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonWriter& writer)
+{
+    writeEmailVerificationStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::ClientModels::writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeEmailVerificationStatusEnumValue(enumVal, writer);
+}
+
 ClientModels::EmailVerificationStatus PlayFab::ClientModels::readEmailVerificationStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readEmailVerificationStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -3284,7 +5848,8 @@ PlayFab::ClientModels::FContactEmailInfoModel::~FContactEmailInfoModel()
 
 }
 
-void PlayFab::ClientModels::FContactEmailInfoModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FContactEmailInfoModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3309,6 +5874,16 @@ void PlayFab::ClientModels::FContactEmailInfoModel::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FContactEmailInfoModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FContactEmailInfoModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FContactEmailInfoModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3332,7 +5907,43 @@ bool PlayFab::ClientModels::FContactEmailInfoModel::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
-void PlayFab::ClientModels::writeContinentCodeEnumJSON(ContinentCode enumVal, JsonWriter& writer)
+bool PlayFab::ClientModels::FContactEmailInfoModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("EmailAddress"))
+        {
+            reader.ReadValue(EmailAddress);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("VerificationStatus"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { VerificationStatus = readEmailVerificationStatusFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FContactEmailInfoModel();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeContinentCodeEnumValue(ClientModels::ContinentCode enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -3347,6 +5958,16 @@ void PlayFab::ClientModels::writeContinentCodeEnumJSON(ContinentCode enumVal, Js
     }
 }
 
+void PlayFab::ClientModels::writeContinentCodeEnumJSON(ContinentCode enumVal, JsonWriter& writer)
+{
+    writeContinentCodeEnumValue(enumVal, writer);
+}
+
+void PlayFab::ClientModels::writeContinentCodeEnumJSON(ContinentCode enumVal, JsonUtf8Writer& writer)
+{
+    writeContinentCodeEnumValue(enumVal, writer);
+}
+
 ClientModels::ContinentCode PlayFab::ClientModels::readContinentCodeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readContinentCodeFromValue(value.IsValid() ? value->AsString() : "");
@@ -3378,7 +5999,8 @@ ClientModels::ContinentCode PlayFab::ClientModels::readContinentCodeFromValue(co
     return ContinentCodeAF; // Basically critical fail
 }
 
-void PlayFab::ClientModels::writeCountryCodeEnumJSON(CountryCode enumVal, JsonWriter& writer)
+template <typename WriterType>
+static void writeCountryCodeEnumValue(ClientModels::CountryCode enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -3635,6 +6257,16 @@ void PlayFab::ClientModels::writeCountryCodeEnumJSON(CountryCode enumVal, JsonWr
     }
 }
 
+void PlayFab::ClientModels::writeCountryCodeEnumJSON(CountryCode enumVal, JsonWriter& writer)
+{
+    writeCountryCodeEnumValue(enumVal, writer);
+}
+
+void PlayFab::ClientModels::writeCountryCodeEnumJSON(CountryCode enumVal, JsonUtf8Writer& writer)
+{
+    writeCountryCodeEnumValue(enumVal, writer);
+}
+
 ClientModels::CountryCode PlayFab::ClientModels::readCountryCodeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readCountryCodeFromValue(value.IsValid() ? value->AsString() : "");
@@ -3913,7 +6545,8 @@ PlayFab::ClientModels::FCreateSharedGroupRequest::~FCreateSharedGroupRequest()
 
 }
 
-void PlayFab::ClientModels::FCreateSharedGroupRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FCreateSharedGroupRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3926,6 +6559,16 @@ void PlayFab::ClientModels::FCreateSharedGroupRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FCreateSharedGroupRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FCreateSharedGroupRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FCreateSharedGroupRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3940,12 +6583,39 @@ bool PlayFab::ClientModels::FCreateSharedGroupRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FCreateSharedGroupRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SharedGroupId"))
+        {
+            reader.ReadValue(SharedGroupId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateSharedGroupRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FCreateSharedGroupResult::~FCreateSharedGroupResult()
 {
 
 }
 
-void PlayFab::ClientModels::FCreateSharedGroupResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FCreateSharedGroupResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3958,6 +6628,16 @@ void PlayFab::ClientModels::FCreateSharedGroupResult::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FCreateSharedGroupResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FCreateSharedGroupResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FCreateSharedGroupResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3972,7 +6652,34 @@ bool PlayFab::ClientModels::FCreateSharedGroupResult::readFromValue(const TShare
     return HasSucceeded;
 }
 
-void PlayFab::ClientModels::writeCurrencyEnumJSON(Currency enumVal, JsonWriter& writer)
+bool PlayFab::ClientModels::FCreateSharedGroupResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SharedGroupId"))
+        {
+            reader.ReadValue(SharedGroupId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateSharedGroupResult();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeCurrencyEnumValue(ClientModels::Currency enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -4142,6 +6849,16 @@ void PlayFab::ClientModels::writeCurrencyEnumJSON(Currency enumVal, JsonWriter&
     }
 }
 
+void PlayFab::ClientModels::writeCurrencyEnumJSON(Currency enumVal, JsonWriter& writer)
+{
+    writeCurrencyEnumValue(enumVal, writer);
+}
+
+void PlayFab::ClientModels::writeCurrencyEnumJSON(Currency enumVal, JsonUtf8Writer& writer)
+{
+    writeCurrencyEnumValue(enumVal, writer);
+}
+
 ClientModels::Currency PlayFab::ClientModels::readCurrencyFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readCurrencyFromValue(value.IsValid() ? value->AsString() : "");
@@ -4328,7 +7045,8 @@ ClientModels::Currency PlayFab::ClientModels::readCurrencyFromValue(const FStrin
     return CurrencyAED; // Basically critical fail
 }
 
-void PlayFab::ClientModels::writeRegionEnumJSON(Region enumVal, JsonWriter& writer)
+template <typename WriterType>
+static void writeRegionEnumValue(ClientModels::Region enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -4343,6 +7061,16 @@ void PlayFab::ClientModels::writeRegionEnumJSON(Region enumVal, JsonWriter& writ
     }
 }
 
+void PlayFab::ClientModels::writeRegionEnumJSON(Region enumVal, JsonWriter& writer)
+{
+    writeRegionEnumValue(enumVal, writer);
+}
+
+void PlayFab::ClientModels::writeRegionEnumJSON(Region enumVal, JsonUtf8Writer& writer)
+{
+    writeRegionEnumValue(enumVal, writer);
+}
+
 ClientModels::Region PlayFab::ClientModels::readRegionFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readRegionFromValue(value.IsValid() ? value->AsString() : "");
@@ -4380,7 +7108,8 @@ PlayFab::ClientModels::FCurrentGamesRequest::~FCurrentGamesRequest()
 
 }
 
-void PlayFab::ClientModels::FCurrentGamesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FCurrentGamesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4417,6 +7146,16 @@ void PlayFab::ClientModels::FCurrentGamesRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FCurrentGamesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FCurrentGamesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FCurrentGamesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4447,13 +7186,58 @@ bool PlayFab::ClientModels::FCurrentGamesRequest::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonValue> TagFilterValue = obj->TryGetField(TEXT("TagFilter"));
     if (TagFilterValue.IsValid() && !TagFilterValue->IsNull())
     {
-        TagFilter = MakeShareable(new FCollectionFilter(TagFilterValue->AsObject()));
+        TagFilter = MakeShared<FCollectionFilter>(TagFilterValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
-void PlayFab::ClientModels::writeGameInstanceStateEnumJSON(GameInstanceState enumVal, JsonWriter& writer)
+bool PlayFab::ClientModels::FCurrentGamesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildVersion"))
+        {
+            reader.ReadValue(BuildVersion);
+        }
+        else if (reader.IsField("GameMode"))
+        {
+            reader.ReadValue(GameMode);
+        }
+        else if (reader.IsField("Region"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfRegion = readRegionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("TagFilter"))
+        {
+            TagFilter = MakeShared<FCollectionFilter>();
+            TagFilter->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCurrentGamesRequest();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeGameInstanceStateEnumValue(ClientModels::GameInstanceState enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -4463,6 +7247,16 @@ void PlayFab::ClientModels::writeGameInstanceStateEnumJSON(GameInstanceState enu
     }
 }
 
+void PlayFab::ClientModels::writeGameInstanceStateEnumJSON(GameInstanceState enumVal, JsonWriter& writer)
+{
+    writeGameInstanceStateEnumValue(enumVal, writer);
+}
+
+void PlayFab::ClientModels::writeGameInstanceStateEnumJSON(GameInstanceState enumVal, JsonUtf8Writer& writer)
+{
+    writeGameInstanceStateEnumValue(enumVal, writer);
+}
+
 ClientModels::GameInstanceState PlayFab::ClientModels::readGameInstanceStateFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readGameInstanceStateFromValue(value.IsValid() ? value->AsString() : "");
@@ -4494,7 +7288,8 @@ PlayFab::ClientModels::FGameInfo::~FGameInfo()
 
 }
 
-void PlayFab::ClientModels::FGameInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGameInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4602,6 +7397,16 @@ void PlayFab::ClientModels::FGameInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGameInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGameInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGameInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4699,19 +7504,122 @@ bool PlayFab::ClientModels::FGameInfo::readFromValue(const TSharedPtr<FJsonObjec
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*TagsObject)->Values); It; ++It)
         {
-            Tags.Add(It.Key(), It.Value()->AsString());
+            Tags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGameInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildVersion"))
+        {
+            reader.ReadValue(BuildVersion);
+        }
+        else if (reader.IsField("GameMode"))
+        {
+            reader.ReadValue(GameMode);
+        }
+        else if (reader.IsField("GameServerData"))
+        {
+            reader.ReadValue(GameServerData);
+        }
+        else if (reader.IsField("GameServerStateEnum"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { GameServerStateEnum = readGameInstanceStateFromValue(TmpValue); }
+        }
+        else if (reader.IsField("LastHeartbeat"))
+        {
+            reader.ReadValue(LastHeartbeat);
+        }
+        else if (reader.IsField("LobbyID"))
+        {
+            reader.ReadValue(LobbyID);
+        }
+        else if (reader.IsField("MaxPlayers"))
+        {
+            reader.ReadValue(MaxPlayers);
+        }
+        else if (reader.IsField("PlayerUserIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { PlayerUserIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Region"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfRegion = readRegionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("RunTime"))
+        {
+            reader.ReadValue(RunTime);
+        }
+        else if (reader.IsField("ServerIPV4Address"))
+        {
+            reader.ReadValue(ServerIPV4Address);
+        }
+        else if (reader.IsField("ServerIPV6Address"))
+        {
+            reader.ReadValue(ServerIPV6Address);
+        }
+        else if (reader.IsField("ServerPort"))
+        {
+            reader.ReadValue(ServerPort);
+        }
+        else if (reader.IsField("ServerPublicDNSName"))
+        {
+            reader.ReadValue(ServerPublicDNSName);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Tags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGameInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FCurrentGamesResult::~FCurrentGamesResult()
 {
 
 }
 
-void PlayFab::ClientModels::FCurrentGamesResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FCurrentGamesResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4733,6 +7641,16 @@ void PlayFab::ClientModels::FCurrentGamesResult::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FCurrentGamesResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FCurrentGamesResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FCurrentGamesResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4748,7 +7666,7 @@ bool PlayFab::ClientModels::FCurrentGamesResult::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < GamesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GamesArray[Idx];
-        Games.Add(FGameInfo(CurrentItem->AsObject()));
+        Games.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -4762,12 +7680,54 @@ bool PlayFab::ClientModels::FCurrentGamesResult::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FCurrentGamesResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GameCount"))
+        {
+            reader.ReadValue(GameCount);
+        }
+        else if (reader.IsField("Games"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Games[Games.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayerCount"))
+        {
+            reader.ReadValue(PlayerCount);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCurrentGamesResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FDeviceInfoRequest::~FDeviceInfoRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FDeviceInfoRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FDeviceInfoRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4785,6 +7745,16 @@ void PlayFab::ClientModels::FDeviceInfoRequest::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FDeviceInfoRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FDeviceInfoRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FDeviceInfoRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4794,25 +7764,68 @@ bool PlayFab::ClientModels::FDeviceInfoRequest::readFromValue(const TSharedPtr<F
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*InfoObject)->Values); It; ++It)
         {
-            Info.Add(It.Key(), FJsonKeeper(It.Value()));
+            Info.Emplace(It.Key(), It.Value());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FDeviceInfoRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Info"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    Info.Add(reader.GetFieldName()).readFromReader(reader);
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeviceInfoRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FEmptyResponse::~FEmptyResponse()
 {
 
 }
 
-void PlayFab::ClientModels::FEmptyResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FEmptyResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FEmptyResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FEmptyResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FEmptyResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4820,18 +7833,50 @@ bool PlayFab::ClientModels::FEmptyResponse::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FEmptyResult::~FEmptyResult()
+bool PlayFab::ClientModels::FEmptyResponse::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::ClientModels::FEmptyResult::writeJSON(JsonWriter& writer) const
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEmptyResponse();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FEmptyResult::~FEmptyResult()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FEmptyResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FEmptyResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FEmptyResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FEmptyResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4839,12 +7884,34 @@ bool PlayFab::ClientModels::FEmptyResult::readFromValue(const TSharedPtr<FJsonOb
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FEmptyResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEmptyResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FEntityKey::~FEntityKey()
 {
 
 }
 
-void PlayFab::ClientModels::FEntityKey::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FEntityKey::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4867,6 +7934,16 @@ void PlayFab::ClientModels::FEntityKey::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FEntityKey::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FEntityKey::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FEntityKey::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4888,13 +7965,44 @@ bool PlayFab::ClientModels::FEntityKey::readFromValue(const TSharedPtr<FJsonObje
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FEntityKey::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Type"))
+        {
+            reader.ReadValue(Type);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityKey();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FEntityTokenResponse::~FEntityTokenResponse()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::ClientModels::FEntityTokenResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FEntityTokenResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4919,6 +8027,16 @@ void PlayFab::ClientModels::FEntityTokenResponse::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FEntityTokenResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FEntityTokenResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FEntityTokenResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4926,7 +8044,7 @@ bool PlayFab::ClientModels::FEntityTokenResponse::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> EntityTokenValue = obj->TryGetField(TEXT("EntityToken"));
@@ -4944,12 +8062,48 @@ bool PlayFab::ClientModels::FEntityTokenResponse::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FEntityTokenResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("EntityToken"))
+        {
+            reader.ReadValue(EntityToken);
+        }
+        else if (reader.IsField("TokenExpiration"))
+        {
+            reader.ReadValue(TokenExpiration);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityTokenResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FExecuteCloudScriptRequest::~FExecuteCloudScriptRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FExecuteCloudScriptRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FExecuteCloudScriptRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5001,6 +8155,16 @@ void PlayFab::ClientModels::FExecuteCloudScriptRequest::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FExecuteCloudScriptRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FExecuteCloudScriptRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FExecuteCloudScriptRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5010,7 +8174,7 @@ bool PlayFab::ClientModels::FExecuteCloudScriptRequest::readFromValue(const TSha
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -5046,12 +8210,67 @@ bool PlayFab::ClientModels::FExecuteCloudScriptRequest::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FExecuteCloudScriptRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("FunctionName"))
+        {
+            reader.ReadValue(FunctionName);
+        }
+        else if (reader.IsField("FunctionParameter"))
+        {
+            FunctionParameter.readFromReader(reader);
+        }
+        else if (reader.IsField("GeneratePlayStreamEvent"))
+        {
+            reader.ReadValue(GeneratePlayStreamEvent);
+        }
+        else if (reader.IsField("RevisionSelection"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { RevisionSelection = readCloudScriptRevisionOptionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("SpecificRevision"))
+        {
+            reader.ReadValue(SpecificRevision);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FExecuteCloudScriptRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FScriptExecutionError::~FScriptExecutionError()
 {
 
 }
 
-void PlayFab::ClientModels::FScriptExecutionError::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FScriptExecutionError::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5076,6 +8295,16 @@ void PlayFab::ClientModels::FScriptExecutionError::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FScriptExecutionError::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FScriptExecutionError::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FScriptExecutionError::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5104,12 +8333,47 @@ bool PlayFab::ClientModels::FScriptExecutionError::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FScriptExecutionError::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Error"))
+        {
+            reader.ReadValue(Error);
+        }
+        else if (reader.IsField("Message"))
+        {
+            reader.ReadValue(Message);
+        }
+        else if (reader.IsField("StackTrace"))
+        {
+            reader.ReadValue(StackTrace);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FScriptExecutionError();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLogStatement::~FLogStatement()
 {
 
 }
 
-void PlayFab::ClientModels::FLogStatement::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLogStatement::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5134,6 +8398,16 @@ void PlayFab::ClientModels::FLogStatement::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLogStatement::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLogStatement::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLogStatement::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5161,13 +8435,48 @@ bool PlayFab::ClientModels::FLogStatement::readFromValue(const TSharedPtr<FJsonO
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLogStatement::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            Data.readFromReader(reader);
+        }
+        else if (reader.IsField("Level"))
+        {
+            reader.ReadValue(Level);
+        }
+        else if (reader.IsField("Message"))
+        {
+            reader.ReadValue(Message);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLogStatement();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FExecuteCloudScriptResult::~FExecuteCloudScriptResult()
 {
     //if (Error != nullptr) delete Error;
 
 }
 
-void PlayFab::ClientModels::FExecuteCloudScriptResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FExecuteCloudScriptResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5231,6 +8540,16 @@ void PlayFab::ClientModels::FExecuteCloudScriptResult::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FExecuteCloudScriptResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FExecuteCloudScriptResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FExecuteCloudScriptResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5245,7 +8564,7 @@ bool PlayFab::ClientModels::FExecuteCloudScriptResult::readFromValue(const TShar
     const TSharedPtr<FJsonValue> ErrorValue = obj->TryGetField(TEXT("Error"));
     if (ErrorValue.IsValid() && !ErrorValue->IsNull())
     {
-        Error = MakeShareable(new FScriptExecutionError(ErrorValue->AsObject()));
+        Error = MakeShared<FScriptExecutionError>(ErrorValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ExecutionTimeSecondsValue = obj->TryGetField(TEXT("ExecutionTimeSeconds"));
@@ -5286,7 +8605,7 @@ bool PlayFab::ClientModels::FExecuteCloudScriptResult::readFromValue(const TShar
     for (int32 Idx = 0; Idx < LogsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LogsArray[Idx];
-        Logs.Add(FLogStatement(CurrentItem->AsObject()));
+        Logs.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -5321,12 +8640,91 @@ bool PlayFab::ClientModels::FExecuteCloudScriptResult::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FExecuteCloudScriptResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("APIRequestsIssued"))
+        {
+            reader.ReadValue(APIRequestsIssued);
+        }
+        else if (reader.IsField("Error"))
+        {
+            Error = MakeShared<FScriptExecutionError>();
+            Error->readFromReader(reader);
+        }
+        else if (reader.IsField("ExecutionTimeSeconds"))
+        {
+            reader.ReadValue(ExecutionTimeSeconds);
+        }
+        else if (reader.IsField("FunctionName"))
+        {
+            reader.ReadValue(FunctionName);
+        }
+        else if (reader.IsField("FunctionResult"))
+        {
+            FunctionResult.readFromReader(reader);
+        }
+        else if (reader.IsField("FunctionResultTooLarge"))
+        {
+            reader.ReadValue(FunctionResultTooLarge);
+        }
+        else if (reader.IsField("HttpRequestsIssued"))
+        {
+            reader.ReadValue(HttpRequestsIssued);
+        }
+        else if (reader.IsField("Logs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Logs[Logs.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("LogsTooLarge"))
+        {
+            reader.ReadValue(LogsTooLarge);
+        }
+        else if (reader.IsField("MemoryConsumedBytes"))
+        {
+            reader.ReadValue(MemoryConsumedBytes);
+        }
+        else if (reader.IsField("ProcessorTimeSeconds"))
+        {
+            reader.ReadValue(ProcessorTimeSeconds);
+        }
+        else if (reader.IsField("Revision"))
+        {
+            reader.ReadValue(Revision);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FExecuteCloudScriptResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FFacebookInstantGamesPlayFabIdPair::~FFacebookInstantGamesPlayFabIdPair()
 {
 
 }
 
-void PlayFab::ClientModels::FFacebookInstantGamesPlayFabIdPair::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FFacebookInstantGamesPlayFabIdPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5345,6 +8743,16 @@ void PlayFab::ClientModels::FFacebookInstantGamesPlayFabIdPair::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FFacebookInstantGamesPlayFabIdPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FFacebookInstantGamesPlayFabIdPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FFacebookInstantGamesPlayFabIdPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5366,12 +8774,43 @@ bool PlayFab::ClientModels::FFacebookInstantGamesPlayFabIdPair::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FFacebookInstantGamesPlayFabIdPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FacebookInstantGamesId"))
+        {
+            reader.ReadValue(FacebookInstantGamesId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FFacebookInstantGamesPlayFabIdPair();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FFacebookPlayFabIdPair::~FFacebookPlayFabIdPair()
 {
 
 }
 
-void PlayFab::ClientModels::FFacebookPlayFabIdPair::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FFacebookPlayFabIdPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5390,6 +8829,16 @@ void PlayFab::ClientModels::FFacebookPlayFabIdPair::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FFacebookPlayFabIdPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FFacebookPlayFabIdPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FFacebookPlayFabIdPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5411,12 +8860,43 @@ bool PlayFab::ClientModels::FFacebookPlayFabIdPair::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FFacebookPlayFabIdPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FacebookId"))
+        {
+            reader.ReadValue(FacebookId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FFacebookPlayFabIdPair();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUserFacebookInfo::~FUserFacebookInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FUserFacebookInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserFacebookInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5435,6 +8915,16 @@ void PlayFab::ClientModels::FUserFacebookInfo::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserFacebookInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserFacebookInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserFacebookInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5456,16 +8946,47 @@ bool PlayFab::ClientModels::FUserFacebookInfo::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FUserGameCenterInfo::~FUserGameCenterInfo()
-{
-
-}
-
-void PlayFab::ClientModels::FUserGameCenterInfo::writeJSON(JsonWriter& writer) const
+bool PlayFab::ClientModels::FUserFacebookInfo::readFromReader(FPlayFabJsonPullReader& reader)
 {
-    writer->WriteObjectStart();
+    if (!reader.ReadObjectStart())
+        return false;
 
-    if (GameCenterId.IsEmpty() == false)
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FacebookId"))
+        {
+            reader.ReadValue(FacebookId);
+        }
+        else if (reader.IsField("FullName"))
+        {
+            reader.ReadValue(FullName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserFacebookInfo();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FUserGameCenterInfo::~FUserGameCenterInfo()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FUserGameCenterInfo::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
+
+    if (GameCenterId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("GameCenterId"));
         writer->WriteValue(GameCenterId);
@@ -5474,6 +8995,16 @@ void PlayFab::ClientModels::FUserGameCenterInfo::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserGameCenterInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserGameCenterInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserGameCenterInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5488,7 +9019,34 @@ bool PlayFab::ClientModels::FUserGameCenterInfo::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
-void PlayFab::ClientModels::writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonWriter& writer)
+bool PlayFab::ClientModels::FUserGameCenterInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GameCenterId"))
+        {
+            reader.ReadValue(GameCenterId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserGameCenterInfo();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeLoginIdentityProviderEnumValue(ClientModels::LoginIdentityProvider enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -5517,6 +9075,16 @@ void PlayFab::ClientModels::writeLoginIdentityProviderEnumJSON(LoginIdentityProv
     }
 }
 
+void PlayFab::ClientModels::writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonWriter& writer)
+{
+    writeLoginIdentityProviderEnumValue(enumVal, writer);
+}
+
+void PlayFab::ClientModels::writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonUtf8Writer& writer)
+{
+    writeLoginIdentityProviderEnumValue(enumVal, writer);
+}
+
 ClientModels::LoginIdentityProvider PlayFab::ClientModels::readLoginIdentityProviderFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readLoginIdentityProviderFromValue(value.IsValid() ? value->AsString() : "");
@@ -5567,7 +9135,8 @@ PlayFab::ClientModels::FLinkedPlatformAccountModel::~FLinkedPlatformAccountModel
 
 }
 
-void PlayFab::ClientModels::FLinkedPlatformAccountModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkedPlatformAccountModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5598,6 +9167,16 @@ void PlayFab::ClientModels::FLinkedPlatformAccountModel::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkedPlatformAccountModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkedPlatformAccountModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkedPlatformAccountModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5628,12 +9207,52 @@ bool PlayFab::ClientModels::FLinkedPlatformAccountModel::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkedPlatformAccountModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Email"))
+        {
+            reader.ReadValue(Email);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Platform = readLoginIdentityProviderFromValue(TmpValue); }
+        }
+        else if (reader.IsField("PlatformUserId"))
+        {
+            reader.ReadValue(PlatformUserId);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkedPlatformAccountModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLocationModel::~FLocationModel()
 {
 
 }
 
-void PlayFab::ClientModels::FLocationModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLocationModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5670,6 +9289,16 @@ void PlayFab::ClientModels::FLocationModel::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLocationModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLocationModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLocationModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5702,7 +9331,52 @@ bool PlayFab::ClientModels::FLocationModel::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
-void PlayFab::ClientModels::writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonWriter& writer)
+bool PlayFab::ClientModels::FLocationModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("City"))
+        {
+            reader.ReadValue(City);
+        }
+        else if (reader.IsField("ContinentCode"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfContinentCode = readContinentCodeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("CountryCode"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfCountryCode = readCountryCodeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Latitude"))
+        {
+            reader.ReadValue(Latitude);
+        }
+        else if (reader.IsField("Longitude"))
+        {
+            reader.ReadValue(Longitude);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLocationModel();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeSubscriptionProviderStatusEnumValue(ClientModels::SubscriptionProviderStatus enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -5718,6 +9392,16 @@ void PlayFab::ClientModels::writeSubscriptionProviderStatusEnumJSON(Subscription
     }
 }
 
+void PlayFab::ClientModels::writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonWriter& writer)
+{
+    writeSubscriptionProviderStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::ClientModels::writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeSubscriptionProviderStatusEnumValue(enumVal, writer);
+}
+
 ClientModels::SubscriptionProviderStatus PlayFab::ClientModels::readSubscriptionProviderStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readSubscriptionProviderStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -5755,7 +9439,8 @@ PlayFab::ClientModels::FSubscriptionModel::~FSubscriptionModel()
 
 }
 
-void PlayFab::ClientModels::FSubscriptionModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FSubscriptionModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5795,6 +9480,16 @@ void PlayFab::ClientModels::FSubscriptionModel::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FSubscriptionModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FSubscriptionModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FSubscriptionModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5842,12 +9537,64 @@ bool PlayFab::ClientModels::FSubscriptionModel::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FSubscriptionModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Expiration"))
+        {
+            reader.ReadValue(Expiration);
+        }
+        else if (reader.IsField("InitialSubscriptionTime"))
+        {
+            reader.ReadValue(InitialSubscriptionTime);
+        }
+        else if (reader.IsField("IsActive"))
+        {
+            reader.ReadValue(IsActive);
+        }
+        else if (reader.IsField("Status"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Status = readSubscriptionProviderStatusFromValue(TmpValue); }
+        }
+        else if (reader.IsField("SubscriptionId"))
+        {
+            reader.ReadValue(SubscriptionId);
+        }
+        else if (reader.IsField("SubscriptionItemId"))
+        {
+            reader.ReadValue(SubscriptionItemId);
+        }
+        else if (reader.IsField("SubscriptionProvider"))
+        {
+            reader.ReadValue(SubscriptionProvider);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSubscriptionModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FMembershipModel::~FMembershipModel()
 {
 
 }
 
-void PlayFab::ClientModels::FMembershipModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FMembershipModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5887,6 +9634,16 @@ void PlayFab::ClientModels::FMembershipModel::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FMembershipModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FMembershipModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FMembershipModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5926,14 +9683,68 @@ bool PlayFab::ClientModels::FMembershipModel::readFromValue(const TSharedPtr<FJs
     for (int32 Idx = 0; Idx < SubscriptionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = SubscriptionsArray[Idx];
-        Subscriptions.Add(FSubscriptionModel(CurrentItem->AsObject()));
+        Subscriptions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
-void PlayFab::ClientModels::writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonWriter& writer)
+bool PlayFab::ClientModels::FMembershipModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("IsActive"))
+        {
+            reader.ReadValue(IsActive);
+        }
+        else if (reader.IsField("MembershipExpiration"))
+        {
+            reader.ReadValue(MembershipExpiration);
+        }
+        else if (reader.IsField("MembershipId"))
+        {
+            reader.ReadValue(MembershipId);
+        }
+        else if (reader.IsField("OverrideExpiration"))
+        {
+            reader.ReadValue(OverrideExpiration);
+        }
+        else if (reader.IsField("OverrideIsSet"))
+        {
+            reader.ReadValue(OverrideIsSet);
+        }
+        else if (reader.IsField("Subscriptions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Subscriptions[Subscriptions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FMembershipModel();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writePushNotificationPlatformEnumValue(ClientModels::PushNotificationPlatform enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -5943,6 +9754,16 @@ void PlayFab::ClientModels::writePushNotificationPlatformEnumJSON(PushNotificati
     }
 }
 
+void PlayFab::ClientModels::writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonWriter& writer)
+{
+    writePushNotificationPlatformEnumValue(enumVal, writer);
+}
+
+void PlayFab::ClientModels::writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonUtf8Writer& writer)
+{
+    writePushNotificationPlatformEnumValue(enumVal, writer);
+}
+
 ClientModels::PushNotificationPlatform PlayFab::ClientModels::readPushNotificationPlatformFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readPushNotificationPlatformFromValue(value.IsValid() ? value->AsString() : "");
@@ -5974,7 +9795,8 @@ PlayFab::ClientModels::FPushNotificationRegistrationModel::~FPushNotificationReg
 
 }
 
-void PlayFab::ClientModels::FPushNotificationRegistrationModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FPushNotificationRegistrationModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5993,6 +9815,16 @@ void PlayFab::ClientModels::FPushNotificationRegistrationModel::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FPushNotificationRegistrationModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FPushNotificationRegistrationModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FPushNotificationRegistrationModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6009,12 +9841,44 @@ bool PlayFab::ClientModels::FPushNotificationRegistrationModel::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FPushNotificationRegistrationModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("NotificationEndpointARN"))
+        {
+            reader.ReadValue(NotificationEndpointARN);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Platform = readPushNotificationPlatformFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPushNotificationRegistrationModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FStatisticModel::~FStatisticModel()
 {
 
 }
 
-void PlayFab::ClientModels::FStatisticModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FStatisticModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6033,6 +9897,16 @@ void PlayFab::ClientModels::FStatisticModel::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FStatisticModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FStatisticModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FStatisticModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6061,12 +9935,47 @@ bool PlayFab::ClientModels::FStatisticModel::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FStatisticModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStatisticModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FTagModel::~FTagModel()
 {
 
 }
 
-void PlayFab::ClientModels::FTagModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FTagModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6079,6 +9988,16 @@ void PlayFab::ClientModels::FTagModel::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FTagModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FTagModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FTagModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6093,12 +10012,39 @@ bool PlayFab::ClientModels::FTagModel::readFromValue(const TSharedPtr<FJsonObjec
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FTagModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TagValue"))
+        {
+            reader.ReadValue(TagValue);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FTagModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FValueToDateModel::~FValueToDateModel()
 {
 
 }
 
-void PlayFab::ClientModels::FValueToDateModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FValueToDateModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6120,6 +10066,16 @@ void PlayFab::ClientModels::FValueToDateModel::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FValueToDateModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FValueToDateModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FValueToDateModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6148,12 +10104,47 @@ bool PlayFab::ClientModels::FValueToDateModel::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FPlayerProfileModel::~FPlayerProfileModel()
+bool PlayFab::ClientModels::FValueToDateModel::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::ClientModels::FPlayerProfileModel::writeJSON(JsonWriter& writer) const
+        if (reader.IsField("Currency"))
+        {
+            reader.ReadValue(Currency);
+        }
+        else if (reader.IsField("TotalValue"))
+        {
+            reader.ReadValue(TotalValue);
+        }
+        else if (reader.IsField("TotalValueAsDecimal"))
+        {
+            reader.ReadValue(TotalValueAsDecimal);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FValueToDateModel();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FPlayerProfileModel::~FPlayerProfileModel()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FPlayerProfileModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6310,6 +10301,16 @@ void PlayFab::ClientModels::FPlayerProfileModel::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FPlayerProfileModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FPlayerProfileModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FPlayerProfileModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6318,7 +10319,7 @@ bool PlayFab::ClientModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < AdCampaignAttributionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = AdCampaignAttributionsArray[Idx];
-        AdCampaignAttributions.Add(FAdCampaignAttributionModel(CurrentItem->AsObject()));
+        AdCampaignAttributions.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6338,7 +10339,7 @@ bool PlayFab::ClientModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < ContactEmailAddressesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ContactEmailAddressesArray[Idx];
-        ContactEmailAddresses.Add(FContactEmailInfoModel(CurrentItem->AsObject()));
+        ContactEmailAddresses.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6365,7 +10366,7 @@ bool PlayFab::ClientModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < LinkedAccountsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LinkedAccountsArray[Idx];
-        LinkedAccounts.Add(FLinkedPlatformAccountModel(CurrentItem->AsObject()));
+        LinkedAccounts.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6373,7 +10374,7 @@ bool PlayFab::ClientModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < LocationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LocationsArray[Idx];
-        Locations.Add(FLocationModel(CurrentItem->AsObject()));
+        Locations.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6381,7 +10382,7 @@ bool PlayFab::ClientModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < MembershipsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = MembershipsArray[Idx];
-        Memberships.Add(FMembershipModel(CurrentItem->AsObject()));
+        Memberships.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6405,7 +10406,7 @@ bool PlayFab::ClientModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < PushNotificationRegistrationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PushNotificationRegistrationsArray[Idx];
-        PushNotificationRegistrations.Add(FPushNotificationRegistrationModel(CurrentItem->AsObject()));
+        PushNotificationRegistrations.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6413,7 +10414,7 @@ bool PlayFab::ClientModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FStatisticModel(CurrentItem->AsObject()));
+        Statistics.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6421,7 +10422,7 @@ bool PlayFab::ClientModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < TagsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = TagsArray[Idx];
-        Tags.Add(FTagModel(CurrentItem->AsObject()));
+        Tags.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6443,19 +10444,193 @@ bool PlayFab::ClientModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < ValuesToDateArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ValuesToDateArray[Idx];
-        ValuesToDate.Add(FValueToDateModel(CurrentItem->AsObject()));
+        ValuesToDate.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FPlayerProfileModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AdCampaignAttributions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { AdCampaignAttributions[AdCampaignAttributions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("AvatarUrl"))
+        {
+            reader.ReadValue(AvatarUrl);
+        }
+        else if (reader.IsField("BannedUntil"))
+        {
+            reader.ReadValue(BannedUntil);
+        }
+        else if (reader.IsField("ContactEmailAddresses"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ContactEmailAddresses[ContactEmailAddresses.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("ExperimentVariants"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ExperimentVariants.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("LastLogin"))
+        {
+            reader.ReadValue(LastLogin);
+        }
+        else if (reader.IsField("LinkedAccounts"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { LinkedAccounts[LinkedAccounts.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Locations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Locations[Locations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Memberships"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Memberships[Memberships.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Origination"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Origination = readLoginIdentityProviderFromValue(TmpValue); }
+        }
+        else if (reader.IsField("PlayerId"))
+        {
+            reader.ReadValue(PlayerId);
+        }
+        else if (reader.IsField("PublisherId"))
+        {
+            reader.ReadValue(PublisherId);
+        }
+        else if (reader.IsField("PushNotificationRegistrations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { PushNotificationRegistrations[PushNotificationRegistrations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Statistics"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Statistics[Statistics.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Tags[Tags.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else if (reader.IsField("TotalValueToDateInUSD"))
+        {
+            reader.ReadValue(TotalValueToDateInUSD);
+        }
+        else if (reader.IsField("ValuesToDate"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ValuesToDate[ValuesToDate.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerProfileModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUserPsnInfo::~FUserPsnInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FUserPsnInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserPsnInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6474,6 +10649,16 @@ void PlayFab::ClientModels::FUserPsnInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserPsnInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserPsnInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserPsnInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6495,7 +10680,38 @@ bool PlayFab::ClientModels::FUserPsnInfo::readFromValue(const TSharedPtr<FJsonOb
     return HasSucceeded;
 }
 
-void PlayFab::ClientModels::writeTitleActivationStatusEnumJSON(TitleActivationStatus enumVal, JsonWriter& writer)
+bool PlayFab::ClientModels::FUserPsnInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PsnAccountId"))
+        {
+            reader.ReadValue(PsnAccountId);
+        }
+        else if (reader.IsField("PsnOnlineId"))
+        {
+            reader.ReadValue(PsnOnlineId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserPsnInfo();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeTitleActivationStatusEnumValue(ClientModels::TitleActivationStatus enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -6508,6 +10724,16 @@ void PlayFab::ClientModels::writeTitleActivationStatusEnumJSON(TitleActivationSt
     }
 }
 
+void PlayFab::ClientModels::writeTitleActivationStatusEnumJSON(TitleActivationStatus enumVal, JsonWriter& writer)
+{
+    writeTitleActivationStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::ClientModels::writeTitleActivationStatusEnumJSON(TitleActivationStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeTitleActivationStatusEnumValue(enumVal, writer);
+}
+
 ClientModels::TitleActivationStatus PlayFab::ClientModels::readTitleActivationStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readTitleActivationStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -6542,7 +10768,8 @@ PlayFab::ClientModels::FUserSteamInfo::~FUserSteamInfo()
 
 }
 
-void PlayFab::ClientModels::FUserSteamInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserSteamInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6579,6 +10806,16 @@ void PlayFab::ClientModels::FUserSteamInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserSteamInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserSteamInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserSteamInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6611,12 +10848,57 @@ bool PlayFab::ClientModels::FUserSteamInfo::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUserSteamInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SteamActivationStatus"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { SteamActivationStatus = readTitleActivationStatusFromValue(TmpValue); }
+        }
+        else if (reader.IsField("SteamCountry"))
+        {
+            reader.ReadValue(SteamCountry);
+        }
+        else if (reader.IsField("SteamCurrency"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { SteamCurrency = readCurrencyFromValue(TmpValue); }
+        }
+        else if (reader.IsField("SteamId"))
+        {
+            reader.ReadValue(SteamId);
+        }
+        else if (reader.IsField("SteamName"))
+        {
+            reader.ReadValue(SteamName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserSteamInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUserXboxInfo::~FUserXboxInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FUserXboxInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserXboxInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6629,6 +10911,16 @@ void PlayFab::ClientModels::FUserXboxInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserXboxInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserXboxInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserXboxInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6643,6 +10935,32 @@ bool PlayFab::ClientModels::FUserXboxInfo::readFromValue(const TSharedPtr<FJsonO
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUserXboxInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("XboxUserId"))
+        {
+            reader.ReadValue(XboxUserId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserXboxInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FFriendInfo::~FFriendInfo()
 {
     //if (FacebookInfo != nullptr) delete FacebookInfo;
@@ -6654,7 +10972,8 @@ PlayFab::ClientModels::FFriendInfo::~FFriendInfo()
 
 }
 
-void PlayFab::ClientModels::FFriendInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FFriendInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6724,6 +11043,16 @@ void PlayFab::ClientModels::FFriendInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FFriendInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FFriendInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FFriendInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6731,7 +11060,7 @@ bool PlayFab::ClientModels::FFriendInfo::readFromValue(const TSharedPtr<FJsonObj
     const TSharedPtr<FJsonValue> FacebookInfoValue = obj->TryGetField(TEXT("FacebookInfo"));
     if (FacebookInfoValue.IsValid() && !FacebookInfoValue->IsNull())
     {
-        FacebookInfo = MakeShareable(new FUserFacebookInfo(FacebookInfoValue->AsObject()));
+        FacebookInfo = MakeShared<FUserFacebookInfo>(FacebookInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> FriendPlayFabIdValue = obj->TryGetField(TEXT("FriendPlayFabId"));
@@ -6744,25 +11073,25 @@ bool PlayFab::ClientModels::FFriendInfo::readFromValue(const TSharedPtr<FJsonObj
     const TSharedPtr<FJsonValue> GameCenterInfoValue = obj->TryGetField(TEXT("GameCenterInfo"));
     if (GameCenterInfoValue.IsValid() && !GameCenterInfoValue->IsNull())
     {
-        GameCenterInfo = MakeShareable(new FUserGameCenterInfo(GameCenterInfoValue->AsObject()));
+        GameCenterInfo = MakeShared<FUserGameCenterInfo>(GameCenterInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ProfileValue = obj->TryGetField(TEXT("Profile"));
     if (ProfileValue.IsValid() && !ProfileValue->IsNull())
     {
-        Profile = MakeShareable(new FPlayerProfileModel(ProfileValue->AsObject()));
+        Profile = MakeShared<FPlayerProfileModel>(ProfileValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PSNInfoValue = obj->TryGetField(TEXT("PSNInfo"));
     if (PSNInfoValue.IsValid() && !PSNInfoValue->IsNull())
     {
-        PSNInfo = MakeShareable(new FUserPsnInfo(PSNInfoValue->AsObject()));
+        PSNInfo = MakeShared<FUserPsnInfo>(PSNInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> SteamInfoValue = obj->TryGetField(TEXT("SteamInfo"));
     if (SteamInfoValue.IsValid() && !SteamInfoValue->IsNull())
     {
-        SteamInfo = MakeShareable(new FUserSteamInfo(SteamInfoValue->AsObject()));
+        SteamInfo = MakeShared<FUserSteamInfo>(SteamInfoValue->AsObject());
     }
 
     obj->TryGetStringArrayField(TEXT("Tags"), Tags);
@@ -6784,18 +11113,94 @@ bool PlayFab::ClientModels::FFriendInfo::readFromValue(const TSharedPtr<FJsonObj
     const TSharedPtr<FJsonValue> XboxInfoValue = obj->TryGetField(TEXT("XboxInfo"));
     if (XboxInfoValue.IsValid() && !XboxInfoValue->IsNull())
     {
-        XboxInfo = MakeShareable(new FUserXboxInfo(XboxInfoValue->AsObject()));
+        XboxInfo = MakeShared<FUserXboxInfo>(XboxInfoValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FFriendInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FacebookInfo"))
+        {
+            FacebookInfo = MakeShared<FUserFacebookInfo>();
+            FacebookInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("FriendPlayFabId"))
+        {
+            reader.ReadValue(FriendPlayFabId);
+        }
+        else if (reader.IsField("GameCenterInfo"))
+        {
+            GameCenterInfo = MakeShared<FUserGameCenterInfo>();
+            GameCenterInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("Profile"))
+        {
+            Profile = MakeShared<FPlayerProfileModel>();
+            Profile->readFromReader(reader);
+        }
+        else if (reader.IsField("PSNInfo"))
+        {
+            PSNInfo = MakeShared<FUserPsnInfo>();
+            PSNInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("SteamInfo"))
+        {
+            SteamInfo = MakeShared<FUserSteamInfo>();
+            SteamInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Tags.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("TitleDisplayName"))
+        {
+            reader.ReadValue(TitleDisplayName);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else if (reader.IsField("XboxInfo"))
+        {
+            XboxInfo = MakeShared<FUserXboxInfo>();
+            XboxInfo->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FFriendInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGameCenterPlayFabIdPair::~FGameCenterPlayFabIdPair()
 {
 
 }
 
-void PlayFab::ClientModels::FGameCenterPlayFabIdPair::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGameCenterPlayFabIdPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6814,6 +11219,16 @@ void PlayFab::ClientModels::FGameCenterPlayFabIdPair::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGameCenterPlayFabIdPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGameCenterPlayFabIdPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGameCenterPlayFabIdPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6835,12 +11250,43 @@ bool PlayFab::ClientModels::FGameCenterPlayFabIdPair::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGameCenterPlayFabIdPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GameCenterId"))
+        {
+            reader.ReadValue(GameCenterId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGameCenterPlayFabIdPair();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGameServerRegionsRequest::~FGameServerRegionsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGameServerRegionsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGameServerRegionsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6863,6 +11309,16 @@ void PlayFab::ClientModels::FGameServerRegionsRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGameServerRegionsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGameServerRegionsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGameServerRegionsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6884,12 +11340,43 @@ bool PlayFab::ClientModels::FGameServerRegionsRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGameServerRegionsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildVersion"))
+        {
+            reader.ReadValue(BuildVersion);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGameServerRegionsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRegionInfo::~FRegionInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FRegionInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRegionInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6917,6 +11404,16 @@ void PlayFab::ClientModels::FRegionInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRegionInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRegionInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRegionInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6947,27 +11444,77 @@ bool PlayFab::ClientModels::FRegionInfo::readFromValue(const TSharedPtr<FJsonObj
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FGameServerRegionsResult::~FGameServerRegionsResult()
-{
-
-}
-
-void PlayFab::ClientModels::FGameServerRegionsResult::writeJSON(JsonWriter& writer) const
+bool PlayFab::ClientModels::FRegionInfo::readFromReader(FPlayFabJsonPullReader& reader)
 {
-    writer->WriteObjectStart();
+    if (!reader.ReadObjectStart())
+        return false;
 
-    if (Regions.Num() != 0)
+    while (reader.NextField())
     {
-        writer->WriteArrayStart(TEXT("Regions"));
-        for (const FRegionInfo& item : Regions)
-            item.writeJSON(writer);
-        writer->WriteArrayEnd();
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Available"))
+        {
+            reader.ReadValue(Available);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("PingUrl"))
+        {
+            reader.ReadValue(PingUrl);
+        }
+        else if (reader.IsField("Region"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfRegion = readRegionFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRegionInfo();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FGameServerRegionsResult::~FGameServerRegionsResult()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FGameServerRegionsResult::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
+
+    if (Regions.Num() != 0)
+    {
+        writer->WriteArrayStart(TEXT("Regions"));
+        for (const FRegionInfo& item : Regions)
+            item.writeJSON(writer);
+        writer->WriteArrayEnd();
     }
 
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGameServerRegionsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGameServerRegionsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGameServerRegionsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6976,20 +11523,54 @@ bool PlayFab::ClientModels::FGameServerRegionsResult::readFromValue(const TShare
     for (int32 Idx = 0; Idx < RegionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = RegionsArray[Idx];
-        Regions.Add(FRegionInfo(CurrentItem->AsObject()));
+        Regions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGameServerRegionsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Regions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Regions[Regions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGameServerRegionsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGenericPlayFabIdPair::~FGenericPlayFabIdPair()
 {
     //if (GenericId != nullptr) delete GenericId;
 
 }
 
-void PlayFab::ClientModels::FGenericPlayFabIdPair::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGenericPlayFabIdPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7008,6 +11589,16 @@ void PlayFab::ClientModels::FGenericPlayFabIdPair::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGenericPlayFabIdPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGenericPlayFabIdPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGenericPlayFabIdPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7015,7 +11606,7 @@ bool PlayFab::ClientModels::FGenericPlayFabIdPair::readFromValue(const TSharedPt
     const TSharedPtr<FJsonValue> GenericIdValue = obj->TryGetField(TEXT("GenericId"));
     if (GenericIdValue.IsValid() && !GenericIdValue->IsNull())
     {
-        GenericId = MakeShareable(new FGenericServiceId(GenericIdValue->AsObject()));
+        GenericId = MakeShared<FGenericServiceId>(GenericIdValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PlayFabIdValue = obj->TryGetField(TEXT("PlayFabId"));
@@ -7028,12 +11619,44 @@ bool PlayFab::ClientModels::FGenericPlayFabIdPair::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGenericPlayFabIdPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GenericId"))
+        {
+            GenericId = MakeShared<FGenericServiceId>();
+            GenericId->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGenericPlayFabIdPair();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetAccountInfoRequest::~FGetAccountInfoRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetAccountInfoRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetAccountInfoRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7064,6 +11687,16 @@ void PlayFab::ClientModels::FGetAccountInfoRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetAccountInfoRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetAccountInfoRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetAccountInfoRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7099,12 +11732,51 @@ bool PlayFab::ClientModels::FGetAccountInfoRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetAccountInfoRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Email"))
+        {
+            reader.ReadValue(Email);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("TitleDisplayName"))
+        {
+            reader.ReadValue(TitleDisplayName);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetAccountInfoRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUserAndroidDeviceInfo::~FUserAndroidDeviceInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FUserAndroidDeviceInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserAndroidDeviceInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7117,6 +11789,16 @@ void PlayFab::ClientModels::FUserAndroidDeviceInfo::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserAndroidDeviceInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserAndroidDeviceInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserAndroidDeviceInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7131,12 +11813,39 @@ bool PlayFab::ClientModels::FUserAndroidDeviceInfo::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUserAndroidDeviceInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AndroidDeviceId"))
+        {
+            reader.ReadValue(AndroidDeviceId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserAndroidDeviceInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUserAppleIdInfo::~FUserAppleIdInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FUserAppleIdInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserAppleIdInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7149,6 +11858,16 @@ void PlayFab::ClientModels::FUserAppleIdInfo::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserAppleIdInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserAppleIdInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserAppleIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7163,12 +11882,39 @@ bool PlayFab::ClientModels::FUserAppleIdInfo::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUserAppleIdInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AppleSubjectId"))
+        {
+            reader.ReadValue(AppleSubjectId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserAppleIdInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUserCustomIdInfo::~FUserCustomIdInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FUserCustomIdInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserCustomIdInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7181,6 +11927,16 @@ void PlayFab::ClientModels::FUserCustomIdInfo::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserCustomIdInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserCustomIdInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserCustomIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7195,12 +11951,39 @@ bool PlayFab::ClientModels::FUserCustomIdInfo::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUserCustomIdInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomId"))
+        {
+            reader.ReadValue(CustomId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserCustomIdInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUserFacebookInstantGamesIdInfo::~FUserFacebookInstantGamesIdInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FUserFacebookInstantGamesIdInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserFacebookInstantGamesIdInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7213,6 +11996,16 @@ void PlayFab::ClientModels::FUserFacebookInstantGamesIdInfo::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserFacebookInstantGamesIdInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserFacebookInstantGamesIdInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserFacebookInstantGamesIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7227,12 +12020,39 @@ bool PlayFab::ClientModels::FUserFacebookInstantGamesIdInfo::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUserFacebookInstantGamesIdInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FacebookInstantGamesId"))
+        {
+            reader.ReadValue(FacebookInstantGamesId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserFacebookInstantGamesIdInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUserGoogleInfo::~FUserGoogleInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FUserGoogleInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserGoogleInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7269,6 +12089,16 @@ void PlayFab::ClientModels::FUserGoogleInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserGoogleInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserGoogleInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserGoogleInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7311,12 +12141,55 @@ bool PlayFab::ClientModels::FUserGoogleInfo::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUserGoogleInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GoogleEmail"))
+        {
+            reader.ReadValue(GoogleEmail);
+        }
+        else if (reader.IsField("GoogleGender"))
+        {
+            reader.ReadValue(GoogleGender);
+        }
+        else if (reader.IsField("GoogleId"))
+        {
+            reader.ReadValue(GoogleId);
+        }
+        else if (reader.IsField("GoogleLocale"))
+        {
+            reader.ReadValue(GoogleLocale);
+        }
+        else if (reader.IsField("GoogleName"))
+        {
+            reader.ReadValue(GoogleName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserGoogleInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUserIosDeviceInfo::~FUserIosDeviceInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FUserIosDeviceInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserIosDeviceInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7329,6 +12202,16 @@ void PlayFab::ClientModels::FUserIosDeviceInfo::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserIosDeviceInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserIosDeviceInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserIosDeviceInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7343,12 +12226,39 @@ bool PlayFab::ClientModels::FUserIosDeviceInfo::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUserIosDeviceInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("IosDeviceId"))
+        {
+            reader.ReadValue(IosDeviceId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserIosDeviceInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUserKongregateInfo::~FUserKongregateInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FUserKongregateInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserKongregateInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7367,6 +12277,16 @@ void PlayFab::ClientModels::FUserKongregateInfo::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserKongregateInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserKongregateInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserKongregateInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7388,12 +12308,43 @@ bool PlayFab::ClientModels::FUserKongregateInfo::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUserKongregateInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("KongregateId"))
+        {
+            reader.ReadValue(KongregateId);
+        }
+        else if (reader.IsField("KongregateName"))
+        {
+            reader.ReadValue(KongregateName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserKongregateInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUserNintendoSwitchAccountIdInfo::~FUserNintendoSwitchAccountIdInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FUserNintendoSwitchAccountIdInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserNintendoSwitchAccountIdInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7406,6 +12357,16 @@ void PlayFab::ClientModels::FUserNintendoSwitchAccountIdInfo::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserNintendoSwitchAccountIdInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserNintendoSwitchAccountIdInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserNintendoSwitchAccountIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7420,12 +12381,39 @@ bool PlayFab::ClientModels::FUserNintendoSwitchAccountIdInfo::readFromValue(cons
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FUserNintendoSwitchDeviceIdInfo::~FUserNintendoSwitchDeviceIdInfo()
+bool PlayFab::ClientModels::FUserNintendoSwitchAccountIdInfo::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::ClientModels::FUserNintendoSwitchDeviceIdInfo::writeJSON(JsonWriter& writer) const
+        if (reader.IsField("NintendoSwitchAccountSubjectId"))
+        {
+            reader.ReadValue(NintendoSwitchAccountSubjectId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserNintendoSwitchAccountIdInfo();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FUserNintendoSwitchDeviceIdInfo::~FUserNintendoSwitchDeviceIdInfo()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FUserNintendoSwitchDeviceIdInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7438,6 +12426,16 @@ void PlayFab::ClientModels::FUserNintendoSwitchDeviceIdInfo::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserNintendoSwitchDeviceIdInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserNintendoSwitchDeviceIdInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserNintendoSwitchDeviceIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7452,12 +12450,39 @@ bool PlayFab::ClientModels::FUserNintendoSwitchDeviceIdInfo::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUserNintendoSwitchDeviceIdInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("NintendoSwitchDeviceId"))
+        {
+            reader.ReadValue(NintendoSwitchDeviceId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserNintendoSwitchDeviceIdInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUserOpenIdInfo::~FUserOpenIdInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FUserOpenIdInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserOpenIdInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7482,6 +12507,16 @@ void PlayFab::ClientModels::FUserOpenIdInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserOpenIdInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserOpenIdInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserOpenIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7510,12 +12545,47 @@ bool PlayFab::ClientModels::FUserOpenIdInfo::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUserOpenIdInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ConnectionId"))
+        {
+            reader.ReadValue(ConnectionId);
+        }
+        else if (reader.IsField("Issuer"))
+        {
+            reader.ReadValue(Issuer);
+        }
+        else if (reader.IsField("Subject"))
+        {
+            reader.ReadValue(Subject);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserOpenIdInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUserPrivateAccountInfo::~FUserPrivateAccountInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FUserPrivateAccountInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserPrivateAccountInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7528,6 +12598,16 @@ void PlayFab::ClientModels::FUserPrivateAccountInfo::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserPrivateAccountInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserPrivateAccountInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserPrivateAccountInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7542,7 +12622,34 @@ bool PlayFab::ClientModels::FUserPrivateAccountInfo::readFromValue(const TShared
     return HasSucceeded;
 }
 
-void PlayFab::ClientModels::writeUserOriginationEnumJSON(UserOrigination enumVal, JsonWriter& writer)
+bool PlayFab::ClientModels::FUserPrivateAccountInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Email"))
+        {
+            reader.ReadValue(Email);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserPrivateAccountInfo();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeUserOriginationEnumValue(ClientModels::UserOrigination enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -7574,6 +12681,16 @@ void PlayFab::ClientModels::writeUserOriginationEnumJSON(UserOrigination enumVal
     }
 }
 
+void PlayFab::ClientModels::writeUserOriginationEnumJSON(UserOrigination enumVal, JsonWriter& writer)
+{
+    writeUserOriginationEnumValue(enumVal, writer);
+}
+
+void PlayFab::ClientModels::writeUserOriginationEnumJSON(UserOrigination enumVal, JsonUtf8Writer& writer)
+{
+    writeUserOriginationEnumValue(enumVal, writer);
+}
+
 ClientModels::UserOrigination PlayFab::ClientModels::readUserOriginationFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readUserOriginationFromValue(value.IsValid() ? value->AsString() : "");
@@ -7628,7 +12745,8 @@ PlayFab::ClientModels::FUserTitleInfo::~FUserTitleInfo()
 
 }
 
-void PlayFab::ClientModels::FUserTitleInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserTitleInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7680,6 +12798,16 @@ void PlayFab::ClientModels::FUserTitleInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserTitleInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserTitleInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserTitleInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7725,18 +12853,75 @@ bool PlayFab::ClientModels::FUserTitleInfo::readFromValue(const TSharedPtr<FJson
     const TSharedPtr<FJsonValue> TitlePlayerAccountValue = obj->TryGetField(TEXT("TitlePlayerAccount"));
     if (TitlePlayerAccountValue.IsValid() && !TitlePlayerAccountValue->IsNull())
     {
-        TitlePlayerAccount = MakeShareable(new FEntityKey(TitlePlayerAccountValue->AsObject()));
+        TitlePlayerAccount = MakeShared<FEntityKey>(TitlePlayerAccountValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUserTitleInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AvatarUrl"))
+        {
+            reader.ReadValue(AvatarUrl);
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("FirstLogin"))
+        {
+            reader.ReadValue(FirstLogin);
+        }
+        else if (reader.IsField("isBanned"))
+        {
+            reader.ReadValue(isBanned);
+        }
+        else if (reader.IsField("LastLogin"))
+        {
+            reader.ReadValue(LastLogin);
+        }
+        else if (reader.IsField("Origination"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Origination = readUserOriginationFromValue(TmpValue); }
+        }
+        else if (reader.IsField("TitlePlayerAccount"))
+        {
+            TitlePlayerAccount = MakeShared<FEntityKey>();
+            TitlePlayerAccount->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserTitleInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUserTwitchInfo::~FUserTwitchInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FUserTwitchInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserTwitchInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7755,6 +12940,16 @@ void PlayFab::ClientModels::FUserTwitchInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserTwitchInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserTwitchInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserTwitchInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7776,12 +12971,43 @@ bool PlayFab::ClientModels::FUserTwitchInfo::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUserTwitchInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TwitchId"))
+        {
+            reader.ReadValue(TwitchId);
+        }
+        else if (reader.IsField("TwitchUserName"))
+        {
+            reader.ReadValue(TwitchUserName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserTwitchInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUserWindowsHelloInfo::~FUserWindowsHelloInfo()
 {
 
 }
 
-void PlayFab::ClientModels::FUserWindowsHelloInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserWindowsHelloInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7800,6 +13026,16 @@ void PlayFab::ClientModels::FUserWindowsHelloInfo::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserWindowsHelloInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserWindowsHelloInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserWindowsHelloInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7821,6 +13057,36 @@ bool PlayFab::ClientModels::FUserWindowsHelloInfo::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUserWindowsHelloInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("WindowsHelloDeviceName"))
+        {
+            reader.ReadValue(WindowsHelloDeviceName);
+        }
+        else if (reader.IsField("WindowsHelloPublicKeyHash"))
+        {
+            reader.ReadValue(WindowsHelloPublicKeyHash);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserWindowsHelloInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUserAccountInfo::~FUserAccountInfo()
 {
     //if (AndroidDeviceInfo != nullptr) delete AndroidDeviceInfo;
@@ -7844,7 +13110,8 @@ PlayFab::ClientModels::FUserAccountInfo::~FUserAccountInfo()
 
 }
 
-void PlayFab::ClientModels::FUserAccountInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserAccountInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7983,6 +13250,16 @@ void PlayFab::ClientModels::FUserAccountInfo::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserAccountInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserAccountInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserAccountInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7990,13 +13267,13 @@ bool PlayFab::ClientModels::FUserAccountInfo::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonValue> AndroidDeviceInfoValue = obj->TryGetField(TEXT("AndroidDeviceInfo"));
     if (AndroidDeviceInfoValue.IsValid() && !AndroidDeviceInfoValue->IsNull())
     {
-        AndroidDeviceInfo = MakeShareable(new FUserAndroidDeviceInfo(AndroidDeviceInfoValue->AsObject()));
+        AndroidDeviceInfo = MakeShared<FUserAndroidDeviceInfo>(AndroidDeviceInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> AppleAccountInfoValue = obj->TryGetField(TEXT("AppleAccountInfo"));
     if (AppleAccountInfoValue.IsValid() && !AppleAccountInfoValue->IsNull())
     {
-        AppleAccountInfo = MakeShareable(new FUserAppleIdInfo(AppleAccountInfoValue->AsObject()));
+        AppleAccountInfo = MakeShared<FUserAppleIdInfo>(AppleAccountInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> CreatedValue = obj->TryGetField(TEXT("Created"));
@@ -8007,62 +13284,62 @@ bool PlayFab::ClientModels::FUserAccountInfo::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonValue> CustomIdInfoValue = obj->TryGetField(TEXT("CustomIdInfo"));
     if (CustomIdInfoValue.IsValid() && !CustomIdInfoValue->IsNull())
     {
-        CustomIdInfo = MakeShareable(new FUserCustomIdInfo(CustomIdInfoValue->AsObject()));
+        CustomIdInfo = MakeShared<FUserCustomIdInfo>(CustomIdInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> FacebookInfoValue = obj->TryGetField(TEXT("FacebookInfo"));
     if (FacebookInfoValue.IsValid() && !FacebookInfoValue->IsNull())
     {
-        FacebookInfo = MakeShareable(new FUserFacebookInfo(FacebookInfoValue->AsObject()));
+        FacebookInfo = MakeShared<FUserFacebookInfo>(FacebookInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> FacebookInstantGamesIdInfoValue = obj->TryGetField(TEXT("FacebookInstantGamesIdInfo"));
     if (FacebookInstantGamesIdInfoValue.IsValid() && !FacebookInstantGamesIdInfoValue->IsNull())
     {
-        FacebookInstantGamesIdInfo = MakeShareable(new FUserFacebookInstantGamesIdInfo(FacebookInstantGamesIdInfoValue->AsObject()));
+        FacebookInstantGamesIdInfo = MakeShared<FUserFacebookInstantGamesIdInfo>(FacebookInstantGamesIdInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> GameCenterInfoValue = obj->TryGetField(TEXT("GameCenterInfo"));
     if (GameCenterInfoValue.IsValid() && !GameCenterInfoValue->IsNull())
     {
-        GameCenterInfo = MakeShareable(new FUserGameCenterInfo(GameCenterInfoValue->AsObject()));
+        GameCenterInfo = MakeShared<FUserGameCenterInfo>(GameCenterInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> GoogleInfoValue = obj->TryGetField(TEXT("GoogleInfo"));
     if (GoogleInfoValue.IsValid() && !GoogleInfoValue->IsNull())
     {
-        GoogleInfo = MakeShareable(new FUserGoogleInfo(GoogleInfoValue->AsObject()));
+        GoogleInfo = MakeShared<FUserGoogleInfo>(GoogleInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> IosDeviceInfoValue = obj->TryGetField(TEXT("IosDeviceInfo"));
     if (IosDeviceInfoValue.IsValid() && !IosDeviceInfoValue->IsNull())
     {
-        IosDeviceInfo = MakeShareable(new FUserIosDeviceInfo(IosDeviceInfoValue->AsObject()));
+        IosDeviceInfo = MakeShared<FUserIosDeviceInfo>(IosDeviceInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> KongregateInfoValue = obj->TryGetField(TEXT("KongregateInfo"));
     if (KongregateInfoValue.IsValid() && !KongregateInfoValue->IsNull())
     {
-        KongregateInfo = MakeShareable(new FUserKongregateInfo(KongregateInfoValue->AsObject()));
+        KongregateInfo = MakeShared<FUserKongregateInfo>(KongregateInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> NintendoSwitchAccountInfoValue = obj->TryGetField(TEXT("NintendoSwitchAccountInfo"));
     if (NintendoSwitchAccountInfoValue.IsValid() && !NintendoSwitchAccountInfoValue->IsNull())
     {
-        NintendoSwitchAccountInfo = MakeShareable(new FUserNintendoSwitchAccountIdInfo(NintendoSwitchAccountInfoValue->AsObject()));
+        NintendoSwitchAccountInfo = MakeShared<FUserNintendoSwitchAccountIdInfo>(NintendoSwitchAccountInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> NintendoSwitchDeviceIdInfoValue = obj->TryGetField(TEXT("NintendoSwitchDeviceIdInfo"));
     if (NintendoSwitchDeviceIdInfoValue.IsValid() && !NintendoSwitchDeviceIdInfoValue->IsNull())
     {
-        NintendoSwitchDeviceIdInfo = MakeShareable(new FUserNintendoSwitchDeviceIdInfo(NintendoSwitchDeviceIdInfoValue->AsObject()));
+        NintendoSwitchDeviceIdInfo = MakeShared<FUserNintendoSwitchDeviceIdInfo>(NintendoSwitchDeviceIdInfoValue->AsObject());
     }
 
     const TArray<TSharedPtr<FJsonValue>>&OpenIdInfoArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("OpenIdInfo"));
     for (int32 Idx = 0; Idx < OpenIdInfoArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = OpenIdInfoArray[Idx];
-        OpenIdInfo.Add(FUserOpenIdInfo(CurrentItem->AsObject()));
+        OpenIdInfo.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -8076,31 +13353,31 @@ bool PlayFab::ClientModels::FUserAccountInfo::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonValue> PrivateInfoValue = obj->TryGetField(TEXT("PrivateInfo"));
     if (PrivateInfoValue.IsValid() && !PrivateInfoValue->IsNull())
     {
-        PrivateInfo = MakeShareable(new FUserPrivateAccountInfo(PrivateInfoValue->AsObject()));
+        PrivateInfo = MakeShared<FUserPrivateAccountInfo>(PrivateInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PsnInfoValue = obj->TryGetField(TEXT("PsnInfo"));
     if (PsnInfoValue.IsValid() && !PsnInfoValue->IsNull())
     {
-        PsnInfo = MakeShareable(new FUserPsnInfo(PsnInfoValue->AsObject()));
+        PsnInfo = MakeShared<FUserPsnInfo>(PsnInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> SteamInfoValue = obj->TryGetField(TEXT("SteamInfo"));
     if (SteamInfoValue.IsValid() && !SteamInfoValue->IsNull())
     {
-        SteamInfo = MakeShareable(new FUserSteamInfo(SteamInfoValue->AsObject()));
+        SteamInfo = MakeShared<FUserSteamInfo>(SteamInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> TitleInfoValue = obj->TryGetField(TEXT("TitleInfo"));
     if (TitleInfoValue.IsValid() && !TitleInfoValue->IsNull())
     {
-        TitleInfo = MakeShareable(new FUserTitleInfo(TitleInfoValue->AsObject()));
+        TitleInfo = MakeShared<FUserTitleInfo>(TitleInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> TwitchInfoValue = obj->TryGetField(TEXT("TwitchInfo"));
     if (TwitchInfoValue.IsValid() && !TwitchInfoValue->IsNull())
     {
-        TwitchInfo = MakeShareable(new FUserTwitchInfo(TwitchInfoValue->AsObject()));
+        TwitchInfo = MakeShared<FUserTwitchInfo>(TwitchInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> UsernameValue = obj->TryGetField(TEXT("Username"));
@@ -8113,25 +13390,161 @@ bool PlayFab::ClientModels::FUserAccountInfo::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonValue> WindowsHelloInfoValue = obj->TryGetField(TEXT("WindowsHelloInfo"));
     if (WindowsHelloInfoValue.IsValid() && !WindowsHelloInfoValue->IsNull())
     {
-        WindowsHelloInfo = MakeShareable(new FUserWindowsHelloInfo(WindowsHelloInfoValue->AsObject()));
+        WindowsHelloInfo = MakeShared<FUserWindowsHelloInfo>(WindowsHelloInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> XboxInfoValue = obj->TryGetField(TEXT("XboxInfo"));
     if (XboxInfoValue.IsValid() && !XboxInfoValue->IsNull())
     {
-        XboxInfo = MakeShareable(new FUserXboxInfo(XboxInfoValue->AsObject()));
+        XboxInfo = MakeShared<FUserXboxInfo>(XboxInfoValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUserAccountInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AndroidDeviceInfo"))
+        {
+            AndroidDeviceInfo = MakeShared<FUserAndroidDeviceInfo>();
+            AndroidDeviceInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("AppleAccountInfo"))
+        {
+            AppleAccountInfo = MakeShared<FUserAppleIdInfo>();
+            AppleAccountInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("CustomIdInfo"))
+        {
+            CustomIdInfo = MakeShared<FUserCustomIdInfo>();
+            CustomIdInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("FacebookInfo"))
+        {
+            FacebookInfo = MakeShared<FUserFacebookInfo>();
+            FacebookInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("FacebookInstantGamesIdInfo"))
+        {
+            FacebookInstantGamesIdInfo = MakeShared<FUserFacebookInstantGamesIdInfo>();
+            FacebookInstantGamesIdInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("GameCenterInfo"))
+        {
+            GameCenterInfo = MakeShared<FUserGameCenterInfo>();
+            GameCenterInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("GoogleInfo"))
+        {
+            GoogleInfo = MakeShared<FUserGoogleInfo>();
+            GoogleInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("IosDeviceInfo"))
+        {
+            IosDeviceInfo = MakeShared<FUserIosDeviceInfo>();
+            IosDeviceInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("KongregateInfo"))
+        {
+            KongregateInfo = MakeShared<FUserKongregateInfo>();
+            KongregateInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("NintendoSwitchAccountInfo"))
+        {
+            NintendoSwitchAccountInfo = MakeShared<FUserNintendoSwitchAccountIdInfo>();
+            NintendoSwitchAccountInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("NintendoSwitchDeviceIdInfo"))
+        {
+            NintendoSwitchDeviceIdInfo = MakeShared<FUserNintendoSwitchDeviceIdInfo>();
+            NintendoSwitchDeviceIdInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("OpenIdInfo"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { OpenIdInfo[OpenIdInfo.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("PrivateInfo"))
+        {
+            PrivateInfo = MakeShared<FUserPrivateAccountInfo>();
+            PrivateInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("PsnInfo"))
+        {
+            PsnInfo = MakeShared<FUserPsnInfo>();
+            PsnInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("SteamInfo"))
+        {
+            SteamInfo = MakeShared<FUserSteamInfo>();
+            SteamInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("TitleInfo"))
+        {
+            TitleInfo = MakeShared<FUserTitleInfo>();
+            TitleInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("TwitchInfo"))
+        {
+            TwitchInfo = MakeShared<FUserTwitchInfo>();
+            TwitchInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else if (reader.IsField("WindowsHelloInfo"))
+        {
+            WindowsHelloInfo = MakeShared<FUserWindowsHelloInfo>();
+            WindowsHelloInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("XboxInfo"))
+        {
+            XboxInfo = MakeShared<FUserXboxInfo>();
+            XboxInfo->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserAccountInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetAccountInfoResult::~FGetAccountInfoResult()
 {
     //if (AccountInfo != nullptr) delete AccountInfo;
 
 }
 
-void PlayFab::ClientModels::FGetAccountInfoResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetAccountInfoResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8144,6 +13557,16 @@ void PlayFab::ClientModels::FGetAccountInfoResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetAccountInfoResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetAccountInfoResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetAccountInfoResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8151,18 +13574,46 @@ bool PlayFab::ClientModels::FGetAccountInfoResult::readFromValue(const TSharedPt
     const TSharedPtr<FJsonValue> AccountInfoValue = obj->TryGetField(TEXT("AccountInfo"));
     if (AccountInfoValue.IsValid() && !AccountInfoValue->IsNull())
     {
-        AccountInfo = MakeShareable(new FUserAccountInfo(AccountInfoValue->AsObject()));
+        AccountInfo = MakeShared<FUserAccountInfo>(AccountInfoValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetAccountInfoResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AccountInfo"))
+        {
+            AccountInfo = MakeShared<FUserAccountInfo>();
+            AccountInfo->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetAccountInfoResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FNameIdentifier::~FNameIdentifier()
 {
 
 }
 
-void PlayFab::ClientModels::FNameIdentifier::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FNameIdentifier::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8181,6 +13632,16 @@ void PlayFab::ClientModels::FNameIdentifier::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FNameIdentifier::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FNameIdentifier::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FNameIdentifier::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8202,13 +13663,44 @@ bool PlayFab::ClientModels::FNameIdentifier::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FGetAdPlacementsRequest::~FGetAdPlacementsRequest()
+bool PlayFab::ClientModels::FNameIdentifier::readFromReader(FPlayFabJsonPullReader& reader)
 {
-    //if (Identifier != nullptr) delete Identifier;
+    if (!reader.ReadObjectStart())
+        return false;
 
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FNameIdentifier();
+        return false;
+    }
+    return true;
 }
 
-void PlayFab::ClientModels::FGetAdPlacementsRequest::writeJSON(JsonWriter& writer) const
+PlayFab::ClientModels::FGetAdPlacementsRequest::~FGetAdPlacementsRequest()
+{
+    //if (Identifier != nullptr) delete Identifier;
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FGetAdPlacementsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8231,6 +13723,16 @@ void PlayFab::ClientModels::FGetAdPlacementsRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetAdPlacementsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetAdPlacementsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetAdPlacementsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8245,18 +13747,50 @@ bool PlayFab::ClientModels::FGetAdPlacementsRequest::readFromValue(const TShared
     const TSharedPtr<FJsonValue> IdentifierValue = obj->TryGetField(TEXT("Identifier"));
     if (IdentifierValue.IsValid() && !IdentifierValue->IsNull())
     {
-        Identifier = MakeShareable(new FNameIdentifier(IdentifierValue->AsObject()));
+        Identifier = MakeShared<FNameIdentifier>(IdentifierValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetAdPlacementsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AppId"))
+        {
+            reader.ReadValue(AppId);
+        }
+        else if (reader.IsField("Identifier"))
+        {
+            Identifier = MakeShared<FNameIdentifier>();
+            Identifier->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetAdPlacementsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetAdPlacementsResult::~FGetAdPlacementsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetAdPlacementsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetAdPlacementsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8272,6 +13806,16 @@ void PlayFab::ClientModels::FGetAdPlacementsResult::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetAdPlacementsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetAdPlacementsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetAdPlacementsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8280,19 +13824,53 @@ bool PlayFab::ClientModels::FGetAdPlacementsResult::readFromValue(const TSharedP
     for (int32 Idx = 0; Idx < AdPlacementsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = AdPlacementsArray[Idx];
-        AdPlacements.Add(FAdPlacementDetails(CurrentItem->AsObject()));
+        AdPlacements.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetAdPlacementsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AdPlacements"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { AdPlacements[AdPlacements.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetAdPlacementsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetCatalogItemsRequest::~FGetCatalogItemsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetCatalogItemsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetCatalogItemsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8305,6 +13883,16 @@ void PlayFab::ClientModels::FGetCatalogItemsRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetCatalogItemsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetCatalogItemsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetCatalogItemsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8319,12 +13907,39 @@ bool PlayFab::ClientModels::FGetCatalogItemsRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetCatalogItemsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCatalogItemsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetCatalogItemsResult::~FGetCatalogItemsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetCatalogItemsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetCatalogItemsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8340,6 +13955,16 @@ void PlayFab::ClientModels::FGetCatalogItemsResult::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetCatalogItemsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetCatalogItemsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetCatalogItemsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8348,19 +13973,53 @@ bool PlayFab::ClientModels::FGetCatalogItemsResult::readFromValue(const TSharedP
     for (int32 Idx = 0; Idx < CatalogArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = CatalogArray[Idx];
-        Catalog.Add(FCatalogItem(CurrentItem->AsObject()));
+        Catalog.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetCatalogItemsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Catalog"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Catalog[Catalog.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCatalogItemsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetCharacterDataRequest::~FGetCharacterDataRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetCharacterDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetCharacterDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8398,6 +14057,16 @@ void PlayFab::ClientModels::FGetCharacterDataRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetCharacterDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetCharacterDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetCharacterDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8428,7 +14097,53 @@ bool PlayFab::ClientModels::FGetCharacterDataRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
-void PlayFab::ClientModels::writeUserDataPermissionEnumJSON(UserDataPermission enumVal, JsonWriter& writer)
+bool PlayFab::ClientModels::FGetCharacterDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("IfChangedFromDataVersion"))
+        {
+            reader.ReadValue(IfChangedFromDataVersion);
+        }
+        else if (reader.IsField("Keys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Keys.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCharacterDataRequest();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeUserDataPermissionEnumValue(ClientModels::UserDataPermission enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -8438,6 +14153,16 @@ void PlayFab::ClientModels::writeUserDataPermissionEnumJSON(UserDataPermission e
     }
 }
 
+void PlayFab::ClientModels::writeUserDataPermissionEnumJSON(UserDataPermission enumVal, JsonWriter& writer)
+{
+    writeUserDataPermissionEnumValue(enumVal, writer);
+}
+
+void PlayFab::ClientModels::writeUserDataPermissionEnumJSON(UserDataPermission enumVal, JsonUtf8Writer& writer)
+{
+    writeUserDataPermissionEnumValue(enumVal, writer);
+}
+
 ClientModels::UserDataPermission PlayFab::ClientModels::readUserDataPermissionFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readUserDataPermissionFromValue(value.IsValid() ? value->AsString() : "");
@@ -8469,7 +14194,8 @@ PlayFab::ClientModels::FUserDataRecord::~FUserDataRecord()
 
 }
 
-void PlayFab::ClientModels::FUserDataRecord::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserDataRecord::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8491,6 +14217,16 @@ void PlayFab::ClientModels::FUserDataRecord::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserDataRecord::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserDataRecord::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserDataRecord::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8512,12 +14248,48 @@ bool PlayFab::ClientModels::FUserDataRecord::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUserDataRecord::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("LastUpdated"))
+        {
+            reader.ReadValue(LastUpdated);
+        }
+        else if (reader.IsField("Permission"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Permission = readUserDataPermissionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserDataRecord();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetCharacterDataResult::~FGetCharacterDataResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetCharacterDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetCharacterDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8544,6 +14316,16 @@ void PlayFab::ClientModels::FGetCharacterDataResult::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetCharacterDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetCharacterDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetCharacterDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8560,7 +14342,7 @@ bool PlayFab::ClientModels::FGetCharacterDataResult::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), FUserDataRecord(It.Value()->AsObject()));
+            Data.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -8574,12 +14356,54 @@ bool PlayFab::ClientModels::FGetCharacterDataResult::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetCharacterDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { Data.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("DataVersion"))
+        {
+            reader.ReadValue(DataVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCharacterDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetCharacterInventoryRequest::~FGetCharacterInventoryRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetCharacterInventoryRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetCharacterInventoryRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8613,6 +14437,16 @@ void PlayFab::ClientModels::FGetCharacterInventoryRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetCharacterInventoryRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetCharacterInventoryRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetCharacterInventoryRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8636,19 +14470,61 @@ bool PlayFab::ClientModels::FGetCharacterInventoryRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetCharacterInventoryRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCharacterInventoryRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FVirtualCurrencyRechargeTime::~FVirtualCurrencyRechargeTime()
 {
 
 }
 
-void PlayFab::ClientModels::FVirtualCurrencyRechargeTime::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FVirtualCurrencyRechargeTime::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8664,6 +14540,16 @@ void PlayFab::ClientModels::FVirtualCurrencyRechargeTime::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FVirtualCurrencyRechargeTime::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FVirtualCurrencyRechargeTime::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FVirtualCurrencyRechargeTime::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8690,12 +14576,47 @@ bool PlayFab::ClientModels::FVirtualCurrencyRechargeTime::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FVirtualCurrencyRechargeTime::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("RechargeMax"))
+        {
+            reader.ReadValue(RechargeMax);
+        }
+        else if (reader.IsField("RechargeTime"))
+        {
+            reader.ReadValue(RechargeTime);
+        }
+        else if (reader.IsField("SecondsToRecharge"))
+        {
+            reader.ReadValue(SecondsToRecharge);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FVirtualCurrencyRechargeTime();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetCharacterInventoryResult::~FGetCharacterInventoryResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetCharacterInventoryResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetCharacterInventoryResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8739,6 +14660,16 @@ void PlayFab::ClientModels::FGetCharacterInventoryResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetCharacterInventoryResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetCharacterInventoryResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetCharacterInventoryResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8754,7 +14685,7 @@ bool PlayFab::ClientModels::FGetCharacterInventoryResult::readFromValue(const TS
     for (int32 Idx = 0; Idx < InventoryArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = InventoryArray[Idx];
-        Inventory.Add(FItemInstance(CurrentItem->AsObject()));
+        Inventory.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -8764,7 +14695,7 @@ bool PlayFab::ClientModels::FGetCharacterInventoryResult::readFromValue(const TS
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrency.Add(It.Key(), TmpValue);
+            VirtualCurrency.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -8773,19 +14704,79 @@ bool PlayFab::ClientModels::FGetCharacterInventoryResult::readFromValue(const TS
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyRechargeTimesObject)->Values); It; ++It)
         {
-            VirtualCurrencyRechargeTimes.Add(It.Key(), FVirtualCurrencyRechargeTime(It.Value()->AsObject()));
+            VirtualCurrencyRechargeTimes.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetCharacterInventoryResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("Inventory"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Inventory[Inventory.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrency.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyRechargeTimes"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { VirtualCurrencyRechargeTimes.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCharacterInventoryResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetCharacterLeaderboardRequest::~FGetCharacterLeaderboardRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetCharacterLeaderboardRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetCharacterLeaderboardRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8817,7 +14808,17 @@ void PlayFab::ClientModels::FGetCharacterLeaderboardRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
-bool PlayFab::ClientModels::FGetCharacterLeaderboardRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
+void PlayFab::ClientModels::FGetCharacterLeaderboardRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetCharacterLeaderboardRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
+bool PlayFab::ClientModels::FGetCharacterLeaderboardRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
 
@@ -8852,12 +14853,51 @@ bool PlayFab::ClientModels::FGetCharacterLeaderboardRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetCharacterLeaderboardRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterType"))
+        {
+            reader.ReadValue(CharacterType);
+        }
+        else if (reader.IsField("MaxResultsCount"))
+        {
+            reader.ReadValue(MaxResultsCount);
+        }
+        else if (reader.IsField("StartPosition"))
+        {
+            reader.ReadValue(StartPosition);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCharacterLeaderboardRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetCharacterLeaderboardResult::~FGetCharacterLeaderboardResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetCharacterLeaderboardResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetCharacterLeaderboardResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8873,6 +14913,16 @@ void PlayFab::ClientModels::FGetCharacterLeaderboardResult::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetCharacterLeaderboardResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetCharacterLeaderboardResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetCharacterLeaderboardResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8881,19 +14931,53 @@ bool PlayFab::ClientModels::FGetCharacterLeaderboardResult::readFromValue(const
     for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FCharacterLeaderboardEntry(CurrentItem->AsObject()));
+        Leaderboard.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetCharacterLeaderboardResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Leaderboard"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Leaderboard[Leaderboard.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCharacterLeaderboardResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetCharacterStatisticsRequest::~FGetCharacterStatisticsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetCharacterStatisticsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetCharacterStatisticsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8910,6 +14994,16 @@ void PlayFab::ClientModels::FGetCharacterStatisticsRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetCharacterStatisticsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetCharacterStatisticsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetCharacterStatisticsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8924,12 +15018,39 @@ bool PlayFab::ClientModels::FGetCharacterStatisticsRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetCharacterStatisticsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCharacterStatisticsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetCharacterStatisticsResult::~FGetCharacterStatisticsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetCharacterStatisticsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetCharacterStatisticsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8947,6 +15068,16 @@ void PlayFab::ClientModels::FGetCharacterStatisticsResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetCharacterStatisticsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetCharacterStatisticsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetCharacterStatisticsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8957,19 +15088,53 @@ bool PlayFab::ClientModels::FGetCharacterStatisticsResult::readFromValue(const T
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CharacterStatisticsObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            CharacterStatistics.Add(It.Key(), TmpValue);
+            CharacterStatistics.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetCharacterStatisticsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterStatistics"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CharacterStatistics.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCharacterStatisticsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetContentDownloadUrlRequest::~FGetContentDownloadUrlRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetContentDownloadUrlRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetContentDownloadUrlRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8998,6 +15163,16 @@ void PlayFab::ClientModels::FGetContentDownloadUrlRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetContentDownloadUrlRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetContentDownloadUrlRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetContentDownloadUrlRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9026,12 +15201,47 @@ bool PlayFab::ClientModels::FGetContentDownloadUrlRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetContentDownloadUrlRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("HttpMethod"))
+        {
+            reader.ReadValue(HttpMethod);
+        }
+        else if (reader.IsField("Key"))
+        {
+            reader.ReadValue(Key);
+        }
+        else if (reader.IsField("ThruCDN"))
+        {
+            reader.ReadValue(ThruCDN);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetContentDownloadUrlRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetContentDownloadUrlResult::~FGetContentDownloadUrlResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetContentDownloadUrlResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetContentDownloadUrlResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9044,6 +15254,16 @@ void PlayFab::ClientModels::FGetContentDownloadUrlResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetContentDownloadUrlResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetContentDownloadUrlResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetContentDownloadUrlResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9058,12 +15278,39 @@ bool PlayFab::ClientModels::FGetContentDownloadUrlResult::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetContentDownloadUrlResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("URL"))
+        {
+            reader.ReadValue(URL);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetContentDownloadUrlResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FPlayerProfileViewConstraints::~FPlayerProfileViewConstraints()
 {
 
 }
 
-void PlayFab::ClientModels::FPlayerProfileViewConstraints::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FPlayerProfileViewConstraints::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9121,6 +15368,16 @@ void PlayFab::ClientModels::FPlayerProfileViewConstraints::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FPlayerProfileViewConstraints::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FPlayerProfileViewConstraints::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FPlayerProfileViewConstraints::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9247,13 +15504,104 @@ bool PlayFab::ClientModels::FPlayerProfileViewConstraints::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FPlayerProfileViewConstraints::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ShowAvatarUrl"))
+        {
+            reader.ReadValue(ShowAvatarUrl);
+        }
+        else if (reader.IsField("ShowBannedUntil"))
+        {
+            reader.ReadValue(ShowBannedUntil);
+        }
+        else if (reader.IsField("ShowCampaignAttributions"))
+        {
+            reader.ReadValue(ShowCampaignAttributions);
+        }
+        else if (reader.IsField("ShowContactEmailAddresses"))
+        {
+            reader.ReadValue(ShowContactEmailAddresses);
+        }
+        else if (reader.IsField("ShowCreated"))
+        {
+            reader.ReadValue(ShowCreated);
+        }
+        else if (reader.IsField("ShowDisplayName"))
+        {
+            reader.ReadValue(ShowDisplayName);
+        }
+        else if (reader.IsField("ShowExperimentVariants"))
+        {
+            reader.ReadValue(ShowExperimentVariants);
+        }
+        else if (reader.IsField("ShowLastLogin"))
+        {
+            reader.ReadValue(ShowLastLogin);
+        }
+        else if (reader.IsField("ShowLinkedAccounts"))
+        {
+            reader.ReadValue(ShowLinkedAccounts);
+        }
+        else if (reader.IsField("ShowLocations"))
+        {
+            reader.ReadValue(ShowLocations);
+        }
+        else if (reader.IsField("ShowMemberships"))
+        {
+            reader.ReadValue(ShowMemberships);
+        }
+        else if (reader.IsField("ShowOrigination"))
+        {
+            reader.ReadValue(ShowOrigination);
+        }
+        else if (reader.IsField("ShowPushNotificationRegistrations"))
+        {
+            reader.ReadValue(ShowPushNotificationRegistrations);
+        }
+        else if (reader.IsField("ShowStatistics"))
+        {
+            reader.ReadValue(ShowStatistics);
+        }
+        else if (reader.IsField("ShowTags"))
+        {
+            reader.ReadValue(ShowTags);
+        }
+        else if (reader.IsField("ShowTotalValueToDateInUsd"))
+        {
+            reader.ReadValue(ShowTotalValueToDateInUsd);
+        }
+        else if (reader.IsField("ShowValuesToDate"))
+        {
+            reader.ReadValue(ShowValuesToDate);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerProfileViewConstraints();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerRequest::~FGetFriendLeaderboardAroundPlayerRequest()
 {
     //if (ProfileConstraints != nullptr) delete ProfileConstraints;
 
 }
 
-void PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9329,6 +15677,16 @@ void PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerRequest::writeJSON(
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9338,7 +15696,7 @@ bool PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerRequest::readFromVa
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -9373,7 +15731,7 @@ bool PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerRequest::readFromVa
     const TSharedPtr<FJsonValue> ProfileConstraintsValue = obj->TryGetField(TEXT("ProfileConstraints"));
     if (ProfileConstraintsValue.IsValid() && !ProfileConstraintsValue->IsNull())
     {
-        ProfileConstraints = MakeShareable(new FPlayerProfileViewConstraints(ProfileConstraintsValue->AsObject()));
+        ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>(ProfileConstraintsValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> StatisticNameValue = obj->TryGetField(TEXT("StatisticName"));
@@ -9407,13 +15765,84 @@ bool PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerRequest::readFromVa
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("IncludeFacebookFriends"))
+        {
+            reader.ReadValue(IncludeFacebookFriends);
+        }
+        else if (reader.IsField("IncludeSteamFriends"))
+        {
+            reader.ReadValue(IncludeSteamFriends);
+        }
+        else if (reader.IsField("MaxResultsCount"))
+        {
+            reader.ReadValue(MaxResultsCount);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("ProfileConstraints"))
+        {
+            ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>();
+            ProfileConstraints->readFromReader(reader);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("UseSpecificVersion"))
+        {
+            reader.ReadValue(UseSpecificVersion);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else if (reader.IsField("XboxToken"))
+        {
+            reader.ReadValue(XboxToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetFriendLeaderboardAroundPlayerRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FPlayerLeaderboardEntry::~FPlayerLeaderboardEntry()
 {
     //if (Profile != nullptr) delete Profile;
 
 }
 
-void PlayFab::ClientModels::FPlayerLeaderboardEntry::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FPlayerLeaderboardEntry::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9444,6 +15873,16 @@ void PlayFab::ClientModels::FPlayerLeaderboardEntry::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FPlayerLeaderboardEntry::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FPlayerLeaderboardEntry::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FPlayerLeaderboardEntry::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9472,7 +15911,7 @@ bool PlayFab::ClientModels::FPlayerLeaderboardEntry::readFromValue(const TShared
     const TSharedPtr<FJsonValue> ProfileValue = obj->TryGetField(TEXT("Profile"));
     if (ProfileValue.IsValid() && !ProfileValue->IsNull())
     {
-        Profile = MakeShareable(new FPlayerProfileModel(ProfileValue->AsObject()));
+        Profile = MakeShared<FPlayerProfileModel>(ProfileValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> StatValueValue = obj->TryGetField(TEXT("StatValue"));
@@ -9485,12 +15924,56 @@ bool PlayFab::ClientModels::FPlayerLeaderboardEntry::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FPlayerLeaderboardEntry::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Position"))
+        {
+            reader.ReadValue(Position);
+        }
+        else if (reader.IsField("Profile"))
+        {
+            Profile = MakeShared<FPlayerProfileModel>();
+            Profile->readFromReader(reader);
+        }
+        else if (reader.IsField("StatValue"))
+        {
+            reader.ReadValue(StatValue);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerLeaderboardEntry();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerResult::~FGetFriendLeaderboardAroundPlayerResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9515,6 +15998,16 @@ void PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerResult::writeJSON(J
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9523,7 +16016,7 @@ bool PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerResult::readFromVal
     for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FPlayerLeaderboardEntry(CurrentItem->AsObject()));
+        Leaderboard.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -9542,13 +16035,55 @@ bool PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerResult::readFromVal
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetFriendLeaderboardAroundPlayerResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Leaderboard"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Leaderboard[Leaderboard.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("NextReset"))
+        {
+            reader.ReadValue(NextReset);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetFriendLeaderboardAroundPlayerResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetFriendLeaderboardRequest::~FGetFriendLeaderboardRequest()
 {
     //if (ProfileConstraints != nullptr) delete ProfileConstraints;
 
 }
 
-void PlayFab::ClientModels::FGetFriendLeaderboardRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetFriendLeaderboardRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9621,6 +16156,16 @@ void PlayFab::ClientModels::FGetFriendLeaderboardRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetFriendLeaderboardRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetFriendLeaderboardRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetFriendLeaderboardRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9630,7 +16175,7 @@ bool PlayFab::ClientModels::FGetFriendLeaderboardRequest::readFromValue(const TS
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -9658,7 +16203,7 @@ bool PlayFab::ClientModels::FGetFriendLeaderboardRequest::readFromValue(const TS
     const TSharedPtr<FJsonValue> ProfileConstraintsValue = obj->TryGetField(TEXT("ProfileConstraints"));
     if (ProfileConstraintsValue.IsValid() && !ProfileConstraintsValue->IsNull())
     {
-        ProfileConstraints = MakeShareable(new FPlayerProfileViewConstraints(ProfileConstraintsValue->AsObject()));
+        ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>(ProfileConstraintsValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> StartPositionValue = obj->TryGetField(TEXT("StartPosition"));
@@ -9699,13 +16244,84 @@ bool PlayFab::ClientModels::FGetFriendLeaderboardRequest::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetFriendLeaderboardRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("IncludeFacebookFriends"))
+        {
+            reader.ReadValue(IncludeFacebookFriends);
+        }
+        else if (reader.IsField("IncludeSteamFriends"))
+        {
+            reader.ReadValue(IncludeSteamFriends);
+        }
+        else if (reader.IsField("MaxResultsCount"))
+        {
+            reader.ReadValue(MaxResultsCount);
+        }
+        else if (reader.IsField("ProfileConstraints"))
+        {
+            ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>();
+            ProfileConstraints->readFromReader(reader);
+        }
+        else if (reader.IsField("StartPosition"))
+        {
+            reader.ReadValue(StartPosition);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("UseSpecificVersion"))
+        {
+            reader.ReadValue(UseSpecificVersion);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else if (reader.IsField("XboxToken"))
+        {
+            reader.ReadValue(XboxToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetFriendLeaderboardRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetFriendsListRequest::~FGetFriendsListRequest()
 {
     //if (ProfileConstraints != nullptr) delete ProfileConstraints;
 
 }
 
-void PlayFab::ClientModels::FGetFriendsListRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetFriendsListRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9747,6 +16363,16 @@ void PlayFab::ClientModels::FGetFriendsListRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetFriendsListRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetFriendsListRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetFriendsListRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9756,7 +16382,7 @@ bool PlayFab::ClientModels::FGetFriendsListRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -9777,7 +16403,7 @@ bool PlayFab::ClientModels::FGetFriendsListRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonValue> ProfileConstraintsValue = obj->TryGetField(TEXT("ProfileConstraints"));
     if (ProfileConstraintsValue.IsValid() && !ProfileConstraintsValue->IsNull())
     {
-        ProfileConstraints = MakeShareable(new FPlayerProfileViewConstraints(ProfileConstraintsValue->AsObject()));
+        ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>(ProfileConstraintsValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> XboxTokenValue = obj->TryGetField(TEXT("XboxToken"));
@@ -9790,12 +16416,63 @@ bool PlayFab::ClientModels::FGetFriendsListRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetFriendsListRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("IncludeFacebookFriends"))
+        {
+            reader.ReadValue(IncludeFacebookFriends);
+        }
+        else if (reader.IsField("IncludeSteamFriends"))
+        {
+            reader.ReadValue(IncludeSteamFriends);
+        }
+        else if (reader.IsField("ProfileConstraints"))
+        {
+            ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>();
+            ProfileConstraints->readFromReader(reader);
+        }
+        else if (reader.IsField("XboxToken"))
+        {
+            reader.ReadValue(XboxToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetFriendsListRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetFriendsListResult::~FGetFriendsListResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetFriendsListResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetFriendsListResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9811,6 +16488,16 @@ void PlayFab::ClientModels::FGetFriendsListResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetFriendsListResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetFriendsListResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetFriendsListResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9819,19 +16506,53 @@ bool PlayFab::ClientModels::FGetFriendsListResult::readFromValue(const TSharedPt
     for (int32 Idx = 0; Idx < FriendsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = FriendsArray[Idx];
-        Friends.Add(FFriendInfo(CurrentItem->AsObject()));
+        Friends.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetFriendsListResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Friends"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Friends[Friends.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetFriendsListResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetLeaderboardAroundCharacterRequest::~FGetLeaderboardAroundCharacterRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetLeaderboardAroundCharacterRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetLeaderboardAroundCharacterRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9870,6 +16591,16 @@ void PlayFab::ClientModels::FGetLeaderboardAroundCharacterRequest::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetLeaderboardAroundCharacterRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetLeaderboardAroundCharacterRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetLeaderboardAroundCharacterRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9905,12 +16636,51 @@ bool PlayFab::ClientModels::FGetLeaderboardAroundCharacterRequest::readFromValue
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetLeaderboardAroundCharacterRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CharacterType"))
+        {
+            reader.ReadValue(CharacterType);
+        }
+        else if (reader.IsField("MaxResultsCount"))
+        {
+            reader.ReadValue(MaxResultsCount);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLeaderboardAroundCharacterRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetLeaderboardAroundCharacterResult::~FGetLeaderboardAroundCharacterResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetLeaderboardAroundCharacterResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetLeaderboardAroundCharacterResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9926,6 +16696,16 @@ void PlayFab::ClientModels::FGetLeaderboardAroundCharacterResult::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetLeaderboardAroundCharacterResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetLeaderboardAroundCharacterResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetLeaderboardAroundCharacterResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9934,20 +16714,54 @@ bool PlayFab::ClientModels::FGetLeaderboardAroundCharacterResult::readFromValue(
     for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FCharacterLeaderboardEntry(CurrentItem->AsObject()));
+        Leaderboard.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetLeaderboardAroundCharacterResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Leaderboard"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Leaderboard[Leaderboard.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLeaderboardAroundCharacterResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetLeaderboardAroundPlayerRequest::~FGetLeaderboardAroundPlayerRequest()
 {
     //if (ProfileConstraints != nullptr) delete ProfileConstraints;
 
 }
 
-void PlayFab::ClientModels::FGetLeaderboardAroundPlayerRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetLeaderboardAroundPlayerRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10005,6 +16819,16 @@ void PlayFab::ClientModels::FGetLeaderboardAroundPlayerRequest::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetLeaderboardAroundPlayerRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetLeaderboardAroundPlayerRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetLeaderboardAroundPlayerRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10014,7 +16838,7 @@ bool PlayFab::ClientModels::FGetLeaderboardAroundPlayerRequest::readFromValue(co
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -10035,7 +16859,7 @@ bool PlayFab::ClientModels::FGetLeaderboardAroundPlayerRequest::readFromValue(co
     const TSharedPtr<FJsonValue> ProfileConstraintsValue = obj->TryGetField(TEXT("ProfileConstraints"));
     if (ProfileConstraintsValue.IsValid() && !ProfileConstraintsValue->IsNull())
     {
-        ProfileConstraints = MakeShareable(new FPlayerProfileViewConstraints(ProfileConstraintsValue->AsObject()));
+        ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>(ProfileConstraintsValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> StatisticNameValue = obj->TryGetField(TEXT("StatisticName"));
@@ -10062,12 +16886,71 @@ bool PlayFab::ClientModels::FGetLeaderboardAroundPlayerRequest::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetLeaderboardAroundPlayerRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("MaxResultsCount"))
+        {
+            reader.ReadValue(MaxResultsCount);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("ProfileConstraints"))
+        {
+            ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>();
+            ProfileConstraints->readFromReader(reader);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("UseSpecificVersion"))
+        {
+            reader.ReadValue(UseSpecificVersion);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLeaderboardAroundPlayerRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetLeaderboardAroundPlayerResult::~FGetLeaderboardAroundPlayerResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetLeaderboardAroundPlayerResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetLeaderboardAroundPlayerResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10092,6 +16975,16 @@ void PlayFab::ClientModels::FGetLeaderboardAroundPlayerResult::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetLeaderboardAroundPlayerResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetLeaderboardAroundPlayerResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetLeaderboardAroundPlayerResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10100,7 +16993,7 @@ bool PlayFab::ClientModels::FGetLeaderboardAroundPlayerResult::readFromValue(con
     for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FPlayerLeaderboardEntry(CurrentItem->AsObject()));
+        Leaderboard.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10119,12 +17012,54 @@ bool PlayFab::ClientModels::FGetLeaderboardAroundPlayerResult::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetLeaderboardAroundPlayerResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Leaderboard"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Leaderboard[Leaderboard.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("NextReset"))
+        {
+            reader.ReadValue(NextReset);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLeaderboardAroundPlayerResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetLeaderboardForUsersCharactersRequest::~FGetLeaderboardForUsersCharactersRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetLeaderboardForUsersCharactersRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetLeaderboardForUsersCharactersRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10144,6 +17079,16 @@ void PlayFab::ClientModels::FGetLeaderboardForUsersCharactersRequest::writeJSON(
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetLeaderboardForUsersCharactersRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetLeaderboardForUsersCharactersRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetLeaderboardForUsersCharactersRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10165,12 +17110,43 @@ bool PlayFab::ClientModels::FGetLeaderboardForUsersCharactersRequest::readFromVa
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetLeaderboardForUsersCharactersRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("MaxResultsCount"))
+        {
+            reader.ReadValue(MaxResultsCount);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLeaderboardForUsersCharactersRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetLeaderboardForUsersCharactersResult::~FGetLeaderboardForUsersCharactersResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetLeaderboardForUsersCharactersResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetLeaderboardForUsersCharactersResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10186,6 +17162,16 @@ void PlayFab::ClientModels::FGetLeaderboardForUsersCharactersResult::writeJSON(J
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetLeaderboardForUsersCharactersResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetLeaderboardForUsersCharactersResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetLeaderboardForUsersCharactersResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10194,20 +17180,54 @@ bool PlayFab::ClientModels::FGetLeaderboardForUsersCharactersResult::readFromVal
     for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FCharacterLeaderboardEntry(CurrentItem->AsObject()));
+        Leaderboard.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetLeaderboardForUsersCharactersResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Leaderboard"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Leaderboard[Leaderboard.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLeaderboardForUsersCharactersResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetLeaderboardRequest::~FGetLeaderboardRequest()
 {
     //if (ProfileConstraints != nullptr) delete ProfileConstraints;
 
 }
 
-void PlayFab::ClientModels::FGetLeaderboardRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetLeaderboardRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10262,6 +17282,16 @@ void PlayFab::ClientModels::FGetLeaderboardRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetLeaderboardRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetLeaderboardRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetLeaderboardRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10271,7 +17301,7 @@ bool PlayFab::ClientModels::FGetLeaderboardRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -10285,7 +17315,7 @@ bool PlayFab::ClientModels::FGetLeaderboardRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonValue> ProfileConstraintsValue = obj->TryGetField(TEXT("ProfileConstraints"));
     if (ProfileConstraintsValue.IsValid() && !ProfileConstraintsValue->IsNull())
     {
-        ProfileConstraints = MakeShareable(new FPlayerProfileViewConstraints(ProfileConstraintsValue->AsObject()));
+        ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>(ProfileConstraintsValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> StartPositionValue = obj->TryGetField(TEXT("StartPosition"));
@@ -10319,12 +17349,71 @@ bool PlayFab::ClientModels::FGetLeaderboardRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FGetLeaderboardResult::~FGetLeaderboardResult()
+bool PlayFab::ClientModels::FGetLeaderboardRequest::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::ClientModels::FGetLeaderboardResult::writeJSON(JsonWriter& writer) const
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("MaxResultsCount"))
+        {
+            reader.ReadValue(MaxResultsCount);
+        }
+        else if (reader.IsField("ProfileConstraints"))
+        {
+            ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>();
+            ProfileConstraints->readFromReader(reader);
+        }
+        else if (reader.IsField("StartPosition"))
+        {
+            reader.ReadValue(StartPosition);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("UseSpecificVersion"))
+        {
+            reader.ReadValue(UseSpecificVersion);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLeaderboardRequest();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FGetLeaderboardResult::~FGetLeaderboardResult()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FGetLeaderboardResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10349,6 +17438,16 @@ void PlayFab::ClientModels::FGetLeaderboardResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetLeaderboardResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetLeaderboardResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetLeaderboardResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10357,7 +17456,7 @@ bool PlayFab::ClientModels::FGetLeaderboardResult::readFromValue(const TSharedPt
     for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FPlayerLeaderboardEntry(CurrentItem->AsObject()));
+        Leaderboard.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10376,12 +17475,54 @@ bool PlayFab::ClientModels::FGetLeaderboardResult::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetLeaderboardResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Leaderboard"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Leaderboard[Leaderboard.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("NextReset"))
+        {
+            reader.ReadValue(NextReset);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLeaderboardResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPaymentTokenRequest::~FGetPaymentTokenRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPaymentTokenRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPaymentTokenRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10398,6 +17539,16 @@ void PlayFab::ClientModels::FGetPaymentTokenRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPaymentTokenRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPaymentTokenRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPaymentTokenRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10412,12 +17563,39 @@ bool PlayFab::ClientModels::FGetPaymentTokenRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPaymentTokenRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TokenProvider"))
+        {
+            reader.ReadValue(TokenProvider);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPaymentTokenRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPaymentTokenResult::~FGetPaymentTokenResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPaymentTokenResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPaymentTokenResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10436,6 +17614,16 @@ void PlayFab::ClientModels::FGetPaymentTokenResult::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPaymentTokenResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPaymentTokenResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPaymentTokenResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10457,12 +17645,43 @@ bool PlayFab::ClientModels::FGetPaymentTokenResult::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPaymentTokenResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("OrderId"))
+        {
+            reader.ReadValue(OrderId);
+        }
+        else if (reader.IsField("ProviderToken"))
+        {
+            reader.ReadValue(ProviderToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPaymentTokenResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPhotonAuthenticationTokenRequest::~FGetPhotonAuthenticationTokenRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPhotonAuthenticationTokenRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPhotonAuthenticationTokenRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10479,6 +17698,16 @@ void PlayFab::ClientModels::FGetPhotonAuthenticationTokenRequest::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPhotonAuthenticationTokenRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPhotonAuthenticationTokenRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPhotonAuthenticationTokenRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10493,12 +17722,39 @@ bool PlayFab::ClientModels::FGetPhotonAuthenticationTokenRequest::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPhotonAuthenticationTokenRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PhotonApplicationId"))
+        {
+            reader.ReadValue(PhotonApplicationId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPhotonAuthenticationTokenRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPhotonAuthenticationTokenResult::~FGetPhotonAuthenticationTokenResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPhotonAuthenticationTokenResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPhotonAuthenticationTokenResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10511,6 +17767,16 @@ void PlayFab::ClientModels::FGetPhotonAuthenticationTokenResult::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPhotonAuthenticationTokenResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPhotonAuthenticationTokenResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPhotonAuthenticationTokenResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10525,13 +17791,40 @@ bool PlayFab::ClientModels::FGetPhotonAuthenticationTokenResult::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPhotonAuthenticationTokenResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PhotonCustomAuthenticationToken"))
+        {
+            reader.ReadValue(PhotonCustomAuthenticationToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPhotonAuthenticationTokenResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayerCombinedInfoRequestParams::~FGetPlayerCombinedInfoRequestParams()
 {
     //if (ProfileConstraints != nullptr) delete ProfileConstraints;
 
 }
 
-void PlayFab::ClientModels::FGetPlayerCombinedInfoRequestParams::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayerCombinedInfoRequestParams::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10610,6 +17903,16 @@ void PlayFab::ClientModels::FGetPlayerCombinedInfoRequestParams::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayerCombinedInfoRequestParams::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayerCombinedInfoRequestParams::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayerCombinedInfoRequestParams::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10689,7 +17992,7 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoRequestParams::readFromValue(c
     const TSharedPtr<FJsonValue> ProfileConstraintsValue = obj->TryGetField(TEXT("ProfileConstraints"));
     if (ProfileConstraintsValue.IsValid() && !ProfileConstraintsValue->IsNull())
     {
-        ProfileConstraints = MakeShareable(new FPlayerProfileViewConstraints(ProfileConstraintsValue->AsObject()));
+        ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>(ProfileConstraintsValue->AsObject());
     }
 
     obj->TryGetStringArrayField(TEXT("TitleDataKeys"), TitleDataKeys);
@@ -10701,12 +18004,124 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoRequestParams::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayerCombinedInfoRequestParams::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GetCharacterInventories"))
+        {
+            reader.ReadValue(GetCharacterInventories);
+        }
+        else if (reader.IsField("GetCharacterList"))
+        {
+            reader.ReadValue(GetCharacterList);
+        }
+        else if (reader.IsField("GetPlayerProfile"))
+        {
+            reader.ReadValue(GetPlayerProfile);
+        }
+        else if (reader.IsField("GetPlayerStatistics"))
+        {
+            reader.ReadValue(GetPlayerStatistics);
+        }
+        else if (reader.IsField("GetTitleData"))
+        {
+            reader.ReadValue(GetTitleData);
+        }
+        else if (reader.IsField("GetUserAccountInfo"))
+        {
+            reader.ReadValue(GetUserAccountInfo);
+        }
+        else if (reader.IsField("GetUserData"))
+        {
+            reader.ReadValue(GetUserData);
+        }
+        else if (reader.IsField("GetUserInventory"))
+        {
+            reader.ReadValue(GetUserInventory);
+        }
+        else if (reader.IsField("GetUserReadOnlyData"))
+        {
+            reader.ReadValue(GetUserReadOnlyData);
+        }
+        else if (reader.IsField("GetUserVirtualCurrency"))
+        {
+            reader.ReadValue(GetUserVirtualCurrency);
+        }
+        else if (reader.IsField("PlayerStatisticNames"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { PlayerStatisticNames.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ProfileConstraints"))
+        {
+            ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>();
+            ProfileConstraints->readFromReader(reader);
+        }
+        else if (reader.IsField("TitleDataKeys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { TitleDataKeys.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("UserDataKeys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { UserDataKeys.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("UserReadOnlyDataKeys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { UserReadOnlyDataKeys.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerCombinedInfoRequestParams();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayerCombinedInfoRequest::~FGetPlayerCombinedInfoRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayerCombinedInfoRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayerCombinedInfoRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10733,6 +18148,16 @@ void PlayFab::ClientModels::FGetPlayerCombinedInfoRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayerCombinedInfoRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayerCombinedInfoRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayerCombinedInfoRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10742,7 +18167,7 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -10762,12 +18187,54 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayerCombinedInfoRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters.readFromReader(reader);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerCombinedInfoRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FStatisticValue::~FStatisticValue()
 {
 
 }
 
-void PlayFab::ClientModels::FStatisticValue::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FStatisticValue::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10786,6 +18253,16 @@ void PlayFab::ClientModels::FStatisticValue::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FStatisticValue::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FStatisticValue::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FStatisticValue::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10814,6 +18291,40 @@ bool PlayFab::ClientModels::FStatisticValue::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FStatisticValue::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStatisticValue();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::~FGetPlayerCombinedInfoResultPayload()
 {
     //if (AccountInfo != nullptr) delete AccountInfo;
@@ -10821,7 +18332,8 @@ PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::~FGetPlayerCombinedI
 
 }
 
-void PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10937,6 +18449,16 @@ void PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10944,14 +18466,14 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     const TSharedPtr<FJsonValue> AccountInfoValue = obj->TryGetField(TEXT("AccountInfo"));
     if (AccountInfoValue.IsValid() && !AccountInfoValue->IsNull())
     {
-        AccountInfo = MakeShareable(new FUserAccountInfo(AccountInfoValue->AsObject()));
+        AccountInfo = MakeShared<FUserAccountInfo>(AccountInfoValue->AsObject());
     }
 
     const TArray<TSharedPtr<FJsonValue>>&CharacterInventoriesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("CharacterInventories"));
     for (int32 Idx = 0; Idx < CharacterInventoriesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = CharacterInventoriesArray[Idx];
-        CharacterInventories.Add(FCharacterInventory(CurrentItem->AsObject()));
+        CharacterInventories.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10959,21 +18481,21 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     for (int32 Idx = 0; Idx < CharacterListArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = CharacterListArray[Idx];
-        CharacterList.Add(FCharacterResult(CurrentItem->AsObject()));
+        CharacterList.Emplace(CurrentItem->AsObject());
     }
 
 
     const TSharedPtr<FJsonValue> PlayerProfileValue = obj->TryGetField(TEXT("PlayerProfile"));
     if (PlayerProfileValue.IsValid() && !PlayerProfileValue->IsNull())
     {
-        PlayerProfile = MakeShareable(new FPlayerProfileModel(PlayerProfileValue->AsObject()));
+        PlayerProfile = MakeShared<FPlayerProfileModel>(PlayerProfileValue->AsObject());
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PlayerStatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PlayerStatistics"));
     for (int32 Idx = 0; Idx < PlayerStatisticsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PlayerStatisticsArray[Idx];
-        PlayerStatistics.Add(FStatisticValue(CurrentItem->AsObject()));
+        PlayerStatistics.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10982,7 +18504,7 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*TitleDataObject)->Values); It; ++It)
         {
-            TitleData.Add(It.Key(), It.Value()->AsString());
+            TitleData.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -10991,7 +18513,7 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*UserDataObject)->Values); It; ++It)
         {
-            UserData.Add(It.Key(), FUserDataRecord(It.Value()->AsObject()));
+            UserData.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -11006,7 +18528,7 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     for (int32 Idx = 0; Idx < UserInventoryArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = UserInventoryArray[Idx];
-        UserInventory.Add(FItemInstance(CurrentItem->AsObject()));
+        UserInventory.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -11015,7 +18537,7 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*UserReadOnlyDataObject)->Values); It; ++It)
         {
-            UserReadOnlyData.Add(It.Key(), FUserDataRecord(It.Value()->AsObject()));
+            UserReadOnlyData.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -11032,7 +18554,7 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*UserVirtualCurrencyObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            UserVirtualCurrency.Add(It.Key(), TmpValue);
+            UserVirtualCurrency.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -11041,37 +18563,187 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*UserVirtualCurrencyRechargeTimesObject)->Values); It; ++It)
         {
-            UserVirtualCurrencyRechargeTimes.Add(It.Key(), FVirtualCurrencyRechargeTime(It.Value()->AsObject()));
+            UserVirtualCurrencyRechargeTimes.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FGetPlayerCombinedInfoResult::~FGetPlayerCombinedInfoResult()
-{
-    //if (InfoResultPayload != nullptr) delete InfoResultPayload;
-
-}
-
-void PlayFab::ClientModels::FGetPlayerCombinedInfoResult::writeJSON(JsonWriter& writer) const
+bool PlayFab::ClientModels::FGetPlayerCombinedInfoResultPayload::readFromReader(FPlayFabJsonPullReader& reader)
 {
-    writer->WriteObjectStart();
-
-    if (InfoResultPayload.IsValid())
-    {
-        writer->WriteIdentifierPrefix(TEXT("InfoResultPayload"));
-        InfoResultPayload->writeJSON(writer);
-    }
+    if (!reader.ReadObjectStart())
+        return false;
 
-    if (PlayFabId.IsEmpty() == false)
+    while (reader.NextField())
     {
-        writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
-    }
+        if (reader.ReadNull())
+            continue;
 
-    writer->WriteObjectEnd();
-}
+        if (reader.IsField("AccountInfo"))
+        {
+            AccountInfo = MakeShared<FUserAccountInfo>();
+            AccountInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("CharacterInventories"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { CharacterInventories[CharacterInventories.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("CharacterList"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { CharacterList[CharacterList.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayerProfile"))
+        {
+            PlayerProfile = MakeShared<FPlayerProfileModel>();
+            PlayerProfile->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayerStatistics"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { PlayerStatistics[PlayerStatistics.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("TitleData"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { TitleData.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("UserData"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { UserData.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("UserDataVersion"))
+        {
+            reader.ReadValue(UserDataVersion);
+        }
+        else if (reader.IsField("UserInventory"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { UserInventory[UserInventory.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("UserReadOnlyData"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { UserReadOnlyData.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("UserReadOnlyDataVersion"))
+        {
+            reader.ReadValue(UserReadOnlyDataVersion);
+        }
+        else if (reader.IsField("UserVirtualCurrency"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { UserVirtualCurrency.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("UserVirtualCurrencyRechargeTimes"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { UserVirtualCurrencyRechargeTimes.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerCombinedInfoResultPayload();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FGetPlayerCombinedInfoResult::~FGetPlayerCombinedInfoResult()
+{
+    //if (InfoResultPayload != nullptr) delete InfoResultPayload;
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayerCombinedInfoResult::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
+
+    if (InfoResultPayload.IsValid())
+    {
+        writer->WriteIdentifierPrefix(TEXT("InfoResultPayload"));
+        InfoResultPayload->writeJSON(writer);
+    }
+
+    if (PlayFabId.IsEmpty() == false)
+    {
+        writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
+        writer->WriteValue(PlayFabId);
+    }
+
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::ClientModels::FGetPlayerCombinedInfoResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayerCombinedInfoResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
 
 bool PlayFab::ClientModels::FGetPlayerCombinedInfoResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
@@ -11080,7 +18752,7 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoResult::readFromValue(const TS
     const TSharedPtr<FJsonValue> InfoResultPayloadValue = obj->TryGetField(TEXT("InfoResultPayload"));
     if (InfoResultPayloadValue.IsValid() && !InfoResultPayloadValue->IsNull())
     {
-        InfoResultPayload = MakeShareable(new FGetPlayerCombinedInfoResultPayload(InfoResultPayloadValue->AsObject()));
+        InfoResultPayload = MakeShared<FGetPlayerCombinedInfoResultPayload>(InfoResultPayloadValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PlayFabIdValue = obj->TryGetField(TEXT("PlayFabId"));
@@ -11093,13 +18765,45 @@ bool PlayFab::ClientModels::FGetPlayerCombinedInfoResult::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayerCombinedInfoResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("InfoResultPayload"))
+        {
+            InfoResultPayload = MakeShared<FGetPlayerCombinedInfoResultPayload>();
+            InfoResultPayload->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerCombinedInfoResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayerProfileRequest::~FGetPlayerProfileRequest()
 {
     //if (ProfileConstraints != nullptr) delete ProfileConstraints;
 
 }
 
-void PlayFab::ClientModels::FGetPlayerProfileRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayerProfileRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11129,6 +18833,16 @@ void PlayFab::ClientModels::FGetPlayerProfileRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayerProfileRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayerProfileRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayerProfileRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11138,7 +18852,7 @@ bool PlayFab::ClientModels::FGetPlayerProfileRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -11152,19 +18866,62 @@ bool PlayFab::ClientModels::FGetPlayerProfileRequest::readFromValue(const TShare
     const TSharedPtr<FJsonValue> ProfileConstraintsValue = obj->TryGetField(TEXT("ProfileConstraints"));
     if (ProfileConstraintsValue.IsValid() && !ProfileConstraintsValue->IsNull())
     {
-        ProfileConstraints = MakeShareable(new FPlayerProfileViewConstraints(ProfileConstraintsValue->AsObject()));
+        ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>(ProfileConstraintsValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayerProfileRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("ProfileConstraints"))
+        {
+            ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>();
+            ProfileConstraints->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerProfileRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayerProfileResult::~FGetPlayerProfileResult()
 {
     //if (PlayerProfile != nullptr) delete PlayerProfile;
 
 }
 
-void PlayFab::ClientModels::FGetPlayerProfileResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayerProfileResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11177,6 +18934,16 @@ void PlayFab::ClientModels::FGetPlayerProfileResult::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayerProfileResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayerProfileResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayerProfileResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11184,24 +18951,62 @@ bool PlayFab::ClientModels::FGetPlayerProfileResult::readFromValue(const TShared
     const TSharedPtr<FJsonValue> PlayerProfileValue = obj->TryGetField(TEXT("PlayerProfile"));
     if (PlayerProfileValue.IsValid() && !PlayerProfileValue->IsNull())
     {
-        PlayerProfile = MakeShareable(new FPlayerProfileModel(PlayerProfileValue->AsObject()));
+        PlayerProfile = MakeShared<FPlayerProfileModel>(PlayerProfileValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayerProfileResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayerProfile"))
+        {
+            PlayerProfile = MakeShared<FPlayerProfileModel>();
+            PlayerProfile->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerProfileResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayerSegmentsRequest::~FGetPlayerSegmentsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayerSegmentsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayerSegmentsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayerSegmentsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayerSegmentsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayerSegmentsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11209,12 +19014,34 @@ bool PlayFab::ClientModels::FGetPlayerSegmentsRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayerSegmentsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerSegmentsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetSegmentResult::~FGetSegmentResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetSegmentResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetSegmentResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11243,6 +19070,16 @@ void PlayFab::ClientModels::FGetSegmentResult::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetSegmentResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetSegmentResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetSegmentResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11271,12 +19108,47 @@ bool PlayFab::ClientModels::FGetSegmentResult::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetSegmentResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ABTestParent"))
+        {
+            reader.ReadValue(ABTestParent);
+        }
+        else if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetSegmentResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayerSegmentsResult::~FGetPlayerSegmentsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayerSegmentsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayerSegmentsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11292,6 +19164,16 @@ void PlayFab::ClientModels::FGetPlayerSegmentsResult::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayerSegmentsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayerSegmentsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayerSegmentsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11300,19 +19182,53 @@ bool PlayFab::ClientModels::FGetPlayerSegmentsResult::readFromValue(const TShare
     for (int32 Idx = 0; Idx < SegmentsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = SegmentsArray[Idx];
-        Segments.Add(FGetSegmentResult(CurrentItem->AsObject()));
+        Segments.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayerSegmentsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Segments"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Segments[Segments.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerSegmentsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FStatisticNameVersion::~FStatisticNameVersion()
 {
 
 }
 
-void PlayFab::ClientModels::FStatisticNameVersion::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FStatisticNameVersion::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11332,6 +19248,16 @@ void PlayFab::ClientModels::FStatisticNameVersion::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FStatisticNameVersion::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FStatisticNameVersion::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FStatisticNameVersion::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11353,12 +19279,43 @@ bool PlayFab::ClientModels::FStatisticNameVersion::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FStatisticNameVersion::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStatisticNameVersion();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayerStatisticsRequest::~FGetPlayerStatisticsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayerStatisticsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayerStatisticsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11394,6 +19351,16 @@ void PlayFab::ClientModels::FGetPlayerStatisticsRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayerStatisticsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayerStatisticsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayerStatisticsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11403,7 +19370,7 @@ bool PlayFab::ClientModels::FGetPlayerStatisticsRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -11413,19 +19380,75 @@ bool PlayFab::ClientModels::FGetPlayerStatisticsRequest::readFromValue(const TSh
     for (int32 Idx = 0; Idx < StatisticNameVersionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StatisticNameVersionsArray[Idx];
-        StatisticNameVersions.Add(FStatisticNameVersion(CurrentItem->AsObject()));
+        StatisticNameVersions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayerStatisticsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("StatisticNames"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { StatisticNames.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("StatisticNameVersions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { StatisticNameVersions[StatisticNameVersions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerStatisticsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayerStatisticsResult::~FGetPlayerStatisticsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayerStatisticsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayerStatisticsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11441,6 +19464,16 @@ void PlayFab::ClientModels::FGetPlayerStatisticsResult::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayerStatisticsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayerStatisticsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayerStatisticsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11449,19 +19482,53 @@ bool PlayFab::ClientModels::FGetPlayerStatisticsResult::readFromValue(const TSha
     for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FStatisticValue(CurrentItem->AsObject()));
+        Statistics.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayerStatisticsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Statistics"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Statistics[Statistics.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerStatisticsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayerStatisticVersionsRequest::~FGetPlayerStatisticVersionsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayerStatisticVersionsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayerStatisticVersionsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11485,6 +19552,16 @@ void PlayFab::ClientModels::FGetPlayerStatisticVersionsRequest::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayerStatisticVersionsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayerStatisticVersionsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayerStatisticVersionsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11494,7 +19571,7 @@ bool PlayFab::ClientModels::FGetPlayerStatisticVersionsRequest::readFromValue(co
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -11508,12 +19585,50 @@ bool PlayFab::ClientModels::FGetPlayerStatisticVersionsRequest::readFromValue(co
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FPlayerStatisticVersion::~FPlayerStatisticVersion()
+bool PlayFab::ClientModels::FGetPlayerStatisticVersionsRequest::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::ClientModels::FPlayerStatisticVersion::writeJSON(JsonWriter& writer) const
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerStatisticVersionsRequest();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FPlayerStatisticVersion::~FPlayerStatisticVersion()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FPlayerStatisticVersion::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11550,6 +19665,16 @@ void PlayFab::ClientModels::FPlayerStatisticVersion::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FPlayerStatisticVersion::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FPlayerStatisticVersion::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FPlayerStatisticVersion::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11591,12 +19716,59 @@ bool PlayFab::ClientModels::FPlayerStatisticVersion::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FPlayerStatisticVersion::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ActivationTime"))
+        {
+            reader.ReadValue(ActivationTime);
+        }
+        else if (reader.IsField("DeactivationTime"))
+        {
+            reader.ReadValue(DeactivationTime);
+        }
+        else if (reader.IsField("ScheduledActivationTime"))
+        {
+            reader.ReadValue(ScheduledActivationTime);
+        }
+        else if (reader.IsField("ScheduledDeactivationTime"))
+        {
+            reader.ReadValue(ScheduledDeactivationTime);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerStatisticVersion();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayerStatisticVersionsResult::~FGetPlayerStatisticVersionsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayerStatisticVersionsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayerStatisticVersionsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11612,6 +19784,16 @@ void PlayFab::ClientModels::FGetPlayerStatisticVersionsResult::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayerStatisticVersionsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayerStatisticVersionsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayerStatisticVersionsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11620,19 +19802,53 @@ bool PlayFab::ClientModels::FGetPlayerStatisticVersionsResult::readFromValue(con
     for (int32 Idx = 0; Idx < StatisticVersionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StatisticVersionsArray[Idx];
-        StatisticVersions.Add(FPlayerStatisticVersion(CurrentItem->AsObject()));
+        StatisticVersions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayerStatisticVersionsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("StatisticVersions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { StatisticVersions[StatisticVersions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerStatisticVersionsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayerTagsRequest::~FGetPlayerTagsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayerTagsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayerTagsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11666,6 +19882,16 @@ void PlayFab::ClientModels::FGetPlayerTagsRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayerTagsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayerTagsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayerTagsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11675,7 +19901,7 @@ bool PlayFab::ClientModels::FGetPlayerTagsRequest::readFromValue(const TSharedPt
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -11696,12 +19922,54 @@ bool PlayFab::ClientModels::FGetPlayerTagsRequest::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayerTagsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Namespace"))
+        {
+            reader.ReadValue(Namespace);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerTagsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayerTagsResult::~FGetPlayerTagsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayerTagsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayerTagsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11724,6 +19992,16 @@ void PlayFab::ClientModels::FGetPlayerTagsResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayerTagsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayerTagsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayerTagsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11740,12 +20018,50 @@ bool PlayFab::ClientModels::FGetPlayerTagsResult::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayerTagsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Tags.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerTagsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayerTradesRequest::~FGetPlayerTradesRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayerTradesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayerTradesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11758,6 +20074,16 @@ void PlayFab::ClientModels::FGetPlayerTradesRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayerTradesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayerTradesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayerTradesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11767,12 +20093,40 @@ bool PlayFab::ClientModels::FGetPlayerTradesRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayerTradesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("StatusFilter"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { StatusFilter = readTradeStatusFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerTradesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayerTradesResponse::~FGetPlayerTradesResponse()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayerTradesResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayerTradesResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11797,6 +20151,16 @@ void PlayFab::ClientModels::FGetPlayerTradesResponse::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayerTradesResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayerTradesResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayerTradesResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11805,7 +20169,7 @@ bool PlayFab::ClientModels::FGetPlayerTradesResponse::readFromValue(const TShare
     for (int32 Idx = 0; Idx < AcceptedTradesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = AcceptedTradesArray[Idx];
-        AcceptedTrades.Add(FTradeInfo(CurrentItem->AsObject()));
+        AcceptedTrades.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -11813,19 +20177,64 @@ bool PlayFab::ClientModels::FGetPlayerTradesResponse::readFromValue(const TShare
     for (int32 Idx = 0; Idx < OpenedTradesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = OpenedTradesArray[Idx];
-        OpenedTrades.Add(FTradeInfo(CurrentItem->AsObject()));
+        OpenedTrades.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayerTradesResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AcceptedTrades"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { AcceptedTrades[AcceptedTrades.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("OpenedTrades"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { OpenedTrades[OpenedTrades.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerTradesResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsRequest::~FGetPlayFabIDsFromFacebookIDsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11838,6 +20247,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsRequest::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11847,12 +20266,46 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsRequest::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FacebookIDs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { FacebookIDs.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromFacebookIDsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsResult::~FGetPlayFabIDsFromFacebookIDsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11868,6 +20321,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsResult::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11876,19 +20339,53 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsResult::readFromValue(c
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FFacebookPlayFabIdPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromFacebookIDsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromFacebookIDsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest::~FGetPlayFabIDsFromFacebookInstantGamesIdsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11901,6 +20398,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest::wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11910,12 +20417,46 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest::re
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FacebookInstantGamesIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { FacebookInstantGamesIds.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromFacebookInstantGamesIdsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::~FGetPlayFabIDsFromFacebookInstantGamesIdsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11931,6 +20472,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11939,19 +20490,53 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::rea
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FFacebookInstantGamesPlayFabIdPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromFacebookInstantGamesIdsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsRequest::~FGetPlayFabIDsFromGameCenterIDsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11964,6 +20549,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsRequest::writeJSON(Js
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11973,12 +20568,46 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsRequest::readFromValu
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GameCenterIDs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { GameCenterIDs.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromGameCenterIDsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsResult::~FGetPlayFabIDsFromGameCenterIDsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11994,7 +20623,17 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsResult::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
-bool PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
+void PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
+bool PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
 
@@ -12002,19 +20641,53 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsResult::readFromValue
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FGameCenterPlayFabIdPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromGameCenterIDsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromGameCenterIDsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsRequest::~FGetPlayFabIDsFromGenericIDsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12027,6 +20700,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsRequest::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12035,19 +20718,53 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsRequest::readFromValue(c
     for (int32 Idx = 0; Idx < GenericIDsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GenericIDsArray[Idx];
-        GenericIDs.Add(FGenericServiceId(CurrentItem->AsObject()));
+        GenericIDs.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GenericIDs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GenericIDs[GenericIDs.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromGenericIDsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsResult::~FGetPlayFabIDsFromGenericIDsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12063,6 +20780,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsResult::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12071,19 +20798,53 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsResult::readFromValue(co
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FGenericPlayFabIdPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromGenericIDsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromGenericIDsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsRequest::~FGetPlayFabIDsFromGoogleIDsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12096,6 +20857,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsRequest::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12105,12 +20876,46 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsRequest::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GoogleIDs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { GoogleIDs.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromGoogleIDsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGooglePlayFabIdPair::~FGooglePlayFabIdPair()
 {
 
 }
 
-void PlayFab::ClientModels::FGooglePlayFabIdPair::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGooglePlayFabIdPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12129,6 +20934,16 @@ void PlayFab::ClientModels::FGooglePlayFabIdPair::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGooglePlayFabIdPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGooglePlayFabIdPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGooglePlayFabIdPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12150,12 +20965,43 @@ bool PlayFab::ClientModels::FGooglePlayFabIdPair::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGooglePlayFabIdPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GoogleId"))
+        {
+            reader.ReadValue(GoogleId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGooglePlayFabIdPair();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsResult::~FGetPlayFabIDsFromGoogleIDsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12171,6 +21017,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsResult::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12179,19 +21035,53 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsResult::readFromValue(con
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FGooglePlayFabIdPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromGoogleIDsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromGoogleIDsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsRequest::~FGetPlayFabIDsFromKongregateIDsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12204,6 +21094,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsRequest::writeJSON(Js
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12213,12 +21113,46 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsRequest::readFromValu
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("KongregateIDs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { KongregateIDs.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromKongregateIDsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FKongregatePlayFabIdPair::~FKongregatePlayFabIdPair()
 {
 
 }
 
-void PlayFab::ClientModels::FKongregatePlayFabIdPair::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FKongregatePlayFabIdPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12237,6 +21171,16 @@ void PlayFab::ClientModels::FKongregatePlayFabIdPair::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FKongregatePlayFabIdPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FKongregatePlayFabIdPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FKongregatePlayFabIdPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12258,12 +21202,43 @@ bool PlayFab::ClientModels::FKongregatePlayFabIdPair::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FKongregatePlayFabIdPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("KongregateId"))
+        {
+            reader.ReadValue(KongregateId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FKongregatePlayFabIdPair();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsResult::~FGetPlayFabIDsFromKongregateIDsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12279,6 +21254,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsResult::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12287,19 +21272,53 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsResult::readFromValue
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FKongregatePlayFabIdPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromKongregateIDsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromKongregateIDsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::~FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12312,6 +21331,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12321,12 +21350,46 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::re
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("NintendoSwitchDeviceIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { NintendoSwitchDeviceIds.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FNintendoSwitchPlayFabIdPair::~FNintendoSwitchPlayFabIdPair()
 {
 
 }
 
-void PlayFab::ClientModels::FNintendoSwitchPlayFabIdPair::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FNintendoSwitchPlayFabIdPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12345,6 +21408,16 @@ void PlayFab::ClientModels::FNintendoSwitchPlayFabIdPair::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FNintendoSwitchPlayFabIdPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FNintendoSwitchPlayFabIdPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FNintendoSwitchPlayFabIdPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12366,12 +21439,43 @@ bool PlayFab::ClientModels::FNintendoSwitchPlayFabIdPair::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FNintendoSwitchPlayFabIdPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("NintendoSwitchDeviceId"))
+        {
+            reader.ReadValue(NintendoSwitchDeviceId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FNintendoSwitchPlayFabIdPair();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::~FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12387,6 +21491,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12395,19 +21509,53 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::rea
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FNintendoSwitchPlayFabIdPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsRequest::~FGetPlayFabIDsFromPSNAccountIDsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12426,6 +21574,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsRequest::writeJSON(Js
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12442,12 +21600,50 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsRequest::readFromValu
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FPSNAccountPlayFabIdPair::~FPSNAccountPlayFabIdPair()
+bool PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsRequest::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::ClientModels::FPSNAccountPlayFabIdPair::writeJSON(JsonWriter& writer) const
+        if (reader.IsField("IssuerId"))
+        {
+            reader.ReadValue(IssuerId);
+        }
+        else if (reader.IsField("PSNAccountIDs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { PSNAccountIDs.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromPSNAccountIDsRequest();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FPSNAccountPlayFabIdPair::~FPSNAccountPlayFabIdPair()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FPSNAccountPlayFabIdPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12466,6 +21662,16 @@ void PlayFab::ClientModels::FPSNAccountPlayFabIdPair::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FPSNAccountPlayFabIdPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FPSNAccountPlayFabIdPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FPSNAccountPlayFabIdPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12487,12 +21693,43 @@ bool PlayFab::ClientModels::FPSNAccountPlayFabIdPair::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FPSNAccountPlayFabIdPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("PSNAccountId"))
+        {
+            reader.ReadValue(PSNAccountId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPSNAccountPlayFabIdPair();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult::~FGetPlayFabIDsFromPSNAccountIDsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12508,6 +21745,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12516,19 +21763,53 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult::readFromValue
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FPSNAccountPlayFabIdPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromPSNAccountIDsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsRequest::~FGetPlayFabIDsFromSteamIDsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12544,6 +21825,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12553,12 +21844,46 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsRequest::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SteamStringIDs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { SteamStringIDs.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromSteamIDsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FSteamPlayFabIdPair::~FSteamPlayFabIdPair()
 {
 
 }
 
-void PlayFab::ClientModels::FSteamPlayFabIdPair::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FSteamPlayFabIdPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12577,6 +21902,16 @@ void PlayFab::ClientModels::FSteamPlayFabIdPair::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FSteamPlayFabIdPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FSteamPlayFabIdPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FSteamPlayFabIdPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12598,12 +21933,43 @@ bool PlayFab::ClientModels::FSteamPlayFabIdPair::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FSteamPlayFabIdPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("SteamStringId"))
+        {
+            reader.ReadValue(SteamStringId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSteamPlayFabIdPair();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsResult::~FGetPlayFabIDsFromSteamIDsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12619,6 +21985,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsResult::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12627,19 +22003,53 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsResult::readFromValue(cons
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FSteamPlayFabIdPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromSteamIDsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromSteamIDsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsRequest::~FGetPlayFabIDsFromTwitchIDsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12652,6 +22062,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsRequest::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12661,12 +22081,46 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsRequest::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TwitchIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { TwitchIds.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromTwitchIDsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FTwitchPlayFabIdPair::~FTwitchPlayFabIdPair()
 {
 
 }
 
-void PlayFab::ClientModels::FTwitchPlayFabIdPair::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FTwitchPlayFabIdPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12685,6 +22139,16 @@ void PlayFab::ClientModels::FTwitchPlayFabIdPair::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FTwitchPlayFabIdPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FTwitchPlayFabIdPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FTwitchPlayFabIdPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12706,12 +22170,43 @@ bool PlayFab::ClientModels::FTwitchPlayFabIdPair::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FTwitchPlayFabIdPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("TwitchId"))
+        {
+            reader.ReadValue(TwitchId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FTwitchPlayFabIdPair();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsResult::~FGetPlayFabIDsFromTwitchIDsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12727,6 +22222,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsResult::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12735,19 +22240,53 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsResult::readFromValue(con
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FTwitchPlayFabIdPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromTwitchIDsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromTwitchIDsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsRequest::~FGetPlayFabIDsFromXboxLiveIDsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12766,6 +22305,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsRequest::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12782,12 +22331,50 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsRequest::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Sandbox"))
+        {
+            reader.ReadValue(Sandbox);
+        }
+        else if (reader.IsField("XboxLiveAccountIDs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { XboxLiveAccountIDs.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromXboxLiveIDsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FXboxLiveAccountPlayFabIdPair::~FXboxLiveAccountPlayFabIdPair()
 {
 
 }
 
-void PlayFab::ClientModels::FXboxLiveAccountPlayFabIdPair::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FXboxLiveAccountPlayFabIdPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12806,6 +22393,16 @@ void PlayFab::ClientModels::FXboxLiveAccountPlayFabIdPair::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FXboxLiveAccountPlayFabIdPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FXboxLiveAccountPlayFabIdPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FXboxLiveAccountPlayFabIdPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12827,12 +22424,43 @@ bool PlayFab::ClientModels::FXboxLiveAccountPlayFabIdPair::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FXboxLiveAccountPlayFabIdPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("XboxLiveAccountId"))
+        {
+            reader.ReadValue(XboxLiveAccountId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FXboxLiveAccountPlayFabIdPair();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult::~FGetPlayFabIDsFromXboxLiveIDsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12848,6 +22476,16 @@ void PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12856,19 +22494,53 @@ bool PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult::readFromValue(c
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FXboxLiveAccountPlayFabIdPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromXboxLiveIDsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPublisherDataRequest::~FGetPublisherDataRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPublisherDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPublisherDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12881,6 +22553,16 @@ void PlayFab::ClientModels::FGetPublisherDataRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPublisherDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPublisherDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPublisherDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12890,12 +22572,46 @@ bool PlayFab::ClientModels::FGetPublisherDataRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FGetPublisherDataResult::~FGetPublisherDataResult()
+bool PlayFab::ClientModels::FGetPublisherDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::ClientModels::FGetPublisherDataResult::writeJSON(JsonWriter& writer) const
+        if (reader.IsField("Keys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Keys.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPublisherDataRequest();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FGetPublisherDataResult::~FGetPublisherDataResult()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPublisherDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12913,6 +22629,16 @@ void PlayFab::ClientModels::FGetPublisherDataResult::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPublisherDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPublisherDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPublisherDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12922,19 +22648,53 @@ bool PlayFab::ClientModels::FGetPublisherDataResult::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPublisherDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPublisherDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPurchaseRequest::~FGetPurchaseRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPurchaseRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPurchaseRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12951,6 +22711,16 @@ void PlayFab::ClientModels::FGetPurchaseRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPurchaseRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPurchaseRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPurchaseRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12965,12 +22735,39 @@ bool PlayFab::ClientModels::FGetPurchaseRequest::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPurchaseRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("OrderId"))
+        {
+            reader.ReadValue(OrderId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPurchaseRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetPurchaseResult::~FGetPurchaseResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetPurchaseResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetPurchaseResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13004,6 +22801,16 @@ void PlayFab::ClientModels::FGetPurchaseResult::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetPurchaseResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetPurchaseResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetPurchaseResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13044,12 +22851,55 @@ bool PlayFab::ClientModels::FGetPurchaseResult::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetPurchaseResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("OrderId"))
+        {
+            reader.ReadValue(OrderId);
+        }
+        else if (reader.IsField("PaymentProvider"))
+        {
+            reader.ReadValue(PaymentProvider);
+        }
+        else if (reader.IsField("PurchaseDate"))
+        {
+            reader.ReadValue(PurchaseDate);
+        }
+        else if (reader.IsField("TransactionId"))
+        {
+            reader.ReadValue(TransactionId);
+        }
+        else if (reader.IsField("TransactionStatus"))
+        {
+            reader.ReadValue(TransactionStatus);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPurchaseResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetSharedGroupDataRequest::~FGetSharedGroupDataRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetSharedGroupDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetSharedGroupDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13081,6 +22931,16 @@ void PlayFab::ClientModels::FGetSharedGroupDataRequest::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetSharedGroupDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetSharedGroupDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetSharedGroupDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13104,12 +22964,54 @@ bool PlayFab::ClientModels::FGetSharedGroupDataRequest::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetSharedGroupDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GetMembers"))
+        {
+            reader.ReadValue(GetMembers);
+        }
+        else if (reader.IsField("Keys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Keys.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("SharedGroupId"))
+        {
+            reader.ReadValue(SharedGroupId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetSharedGroupDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FSharedGroupDataRecord::~FSharedGroupDataRecord()
 {
 
 }
 
-void PlayFab::ClientModels::FSharedGroupDataRecord::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FSharedGroupDataRecord::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13137,6 +23039,16 @@ void PlayFab::ClientModels::FSharedGroupDataRecord::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FSharedGroupDataRecord::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FSharedGroupDataRecord::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FSharedGroupDataRecord::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13165,12 +23077,52 @@ bool PlayFab::ClientModels::FSharedGroupDataRecord::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FSharedGroupDataRecord::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("LastUpdated"))
+        {
+            reader.ReadValue(LastUpdated);
+        }
+        else if (reader.IsField("LastUpdatedBy"))
+        {
+            reader.ReadValue(LastUpdatedBy);
+        }
+        else if (reader.IsField("Permission"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Permission = readUserDataPermissionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSharedGroupDataRecord();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetSharedGroupDataResult::~FGetSharedGroupDataResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetSharedGroupDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetSharedGroupDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13197,6 +23149,16 @@ void PlayFab::ClientModels::FGetSharedGroupDataResult::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetSharedGroupDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetSharedGroupDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetSharedGroupDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13206,7 +23168,7 @@ bool PlayFab::ClientModels::FGetSharedGroupDataResult::readFromValue(const TShar
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), FSharedGroupDataRecord(It.Value()->AsObject()));
+            Data.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -13215,12 +23177,57 @@ bool PlayFab::ClientModels::FGetSharedGroupDataResult::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetSharedGroupDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { Data.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Members"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Members.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetSharedGroupDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetStoreItemsRequest::~FGetStoreItemsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetStoreItemsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetStoreItemsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13243,6 +23250,16 @@ void PlayFab::ClientModels::FGetStoreItemsRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetStoreItemsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetStoreItemsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetStoreItemsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13264,12 +23281,43 @@ bool PlayFab::ClientModels::FGetStoreItemsRequest::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetStoreItemsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("StoreId"))
+        {
+            reader.ReadValue(StoreId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetStoreItemsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FStoreMarketingModel::~FStoreMarketingModel()
 {
 
 }
 
-void PlayFab::ClientModels::FStoreMarketingModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FStoreMarketingModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13294,6 +23342,16 @@ void PlayFab::ClientModels::FStoreMarketingModel::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FStoreMarketingModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FStoreMarketingModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FStoreMarketingModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13321,7 +23379,42 @@ bool PlayFab::ClientModels::FStoreMarketingModel::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
-void PlayFab::ClientModels::writeSourceTypeEnumJSON(SourceType enumVal, JsonWriter& writer)
+bool PlayFab::ClientModels::FStoreMarketingModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("Metadata"))
+        {
+            Metadata.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStoreMarketingModel();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeSourceTypeEnumValue(ClientModels::SourceType enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -13336,6 +23429,16 @@ void PlayFab::ClientModels::writeSourceTypeEnumJSON(SourceType enumVal, JsonWrit
     }
 }
 
+void PlayFab::ClientModels::writeSourceTypeEnumJSON(SourceType enumVal, JsonWriter& writer)
+{
+    writeSourceTypeEnumValue(enumVal, writer);
+}
+
+void PlayFab::ClientModels::writeSourceTypeEnumJSON(SourceType enumVal, JsonUtf8Writer& writer)
+{
+    writeSourceTypeEnumValue(enumVal, writer);
+}
+
 ClientModels::SourceType PlayFab::ClientModels::readSourceTypeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readSourceTypeFromValue(value.IsValid() ? value->AsString() : "");
@@ -13372,7 +23475,8 @@ PlayFab::ClientModels::FStoreItem::~FStoreItem()
 
 }
 
-void PlayFab::ClientModels::FStoreItem::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FStoreItem::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13423,6 +23527,16 @@ void PlayFab::ClientModels::FStoreItem::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FStoreItem::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FStoreItem::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FStoreItem::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13453,7 +23567,7 @@ bool PlayFab::ClientModels::FStoreItem::readFromValue(const TSharedPtr<FJsonObje
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*RealCurrencyPricesObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            RealCurrencyPrices.Add(It.Key(), TmpValue);
+            RealCurrencyPrices.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -13463,20 +23577,77 @@ bool PlayFab::ClientModels::FStoreItem::readFromValue(const TSharedPtr<FJsonObje
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyPricesObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrencyPrices.Add(It.Key(), TmpValue);
+            VirtualCurrencyPrices.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FStoreItem::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomData"))
+        {
+            CustomData.readFromReader(reader);
+        }
+        else if (reader.IsField("DisplayPosition"))
+        {
+            reader.ReadValue(DisplayPosition);
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else if (reader.IsField("RealCurrencyPrices"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { RealCurrencyPrices.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyPrices"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrencyPrices.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStoreItem();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetStoreItemsResult::~FGetStoreItemsResult()
 {
     //if (MarketingData != nullptr) delete MarketingData;
 
 }
 
-void PlayFab::ClientModels::FGetStoreItemsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetStoreItemsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13516,6 +23687,16 @@ void PlayFab::ClientModels::FGetStoreItemsResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetStoreItemsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetStoreItemsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetStoreItemsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13530,7 +23711,7 @@ bool PlayFab::ClientModels::FGetStoreItemsResult::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonValue> MarketingDataValue = obj->TryGetField(TEXT("MarketingData"));
     if (MarketingDataValue.IsValid() && !MarketingDataValue->IsNull())
     {
-        MarketingData = MakeShareable(new FStoreMarketingModel(MarketingDataValue->AsObject()));
+        MarketingData = MakeShared<FStoreMarketingModel>(MarketingDataValue->AsObject());
     }
 
     Source = readSourceTypeFromValue(obj->TryGetField(TEXT("Source")));
@@ -13539,7 +23720,7 @@ bool PlayFab::ClientModels::FGetStoreItemsResult::readFromValue(const TSharedPtr
     for (int32 Idx = 0; Idx < StoreArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StoreArray[Idx];
-        Store.Add(FStoreItem(CurrentItem->AsObject()));
+        Store.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -13553,31 +23734,115 @@ bool PlayFab::ClientModels::FGetStoreItemsResult::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FGetTimeRequest::~FGetTimeRequest()
-{
-
-}
-
-void PlayFab::ClientModels::FGetTimeRequest::writeJSON(JsonWriter& writer) const
+bool PlayFab::ClientModels::FGetStoreItemsResult::readFromReader(FPlayFabJsonPullReader& reader)
 {
-    writer->WriteObjectStart();
+    if (!reader.ReadObjectStart())
+        return false;
 
-    writer->WriteObjectEnd();
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-bool PlayFab::ClientModels::FGetTimeRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
-{
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("MarketingData"))
+        {
+            MarketingData = MakeShared<FStoreMarketingModel>();
+            MarketingData->readFromReader(reader);
+        }
+        else if (reader.IsField("Source"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Source = readSourceTypeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Store"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Store[Store.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("StoreId"))
+        {
+            reader.ReadValue(StoreId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetStoreItemsResult();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FGetTimeRequest::~FGetTimeRequest()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FGetTimeRequest::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
+
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::ClientModels::FGetTimeRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetTimeRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
+bool PlayFab::ClientModels::FGetTimeRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
+{
     bool HasSucceeded = true;
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetTimeRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTimeRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetTimeResult::~FGetTimeResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetTimeResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetTimeResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13587,6 +23852,16 @@ void PlayFab::ClientModels::FGetTimeResult::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetTimeResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetTimeResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetTimeResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13599,12 +23874,39 @@ bool PlayFab::ClientModels::FGetTimeResult::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetTimeResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Time"))
+        {
+            reader.ReadValue(Time);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTimeResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetTitleDataRequest::~FGetTitleDataRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetTitleDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetTitleDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13626,6 +23928,16 @@ void PlayFab::ClientModels::FGetTitleDataRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetTitleDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetTitleDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetTitleDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13642,12 +23954,50 @@ bool PlayFab::ClientModels::FGetTitleDataRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetTitleDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Keys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Keys.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("OverrideLabel"))
+        {
+            reader.ReadValue(OverrideLabel);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitleDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetTitleDataResult::~FGetTitleDataResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetTitleDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetTitleDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13665,6 +24015,16 @@ void PlayFab::ClientModels::FGetTitleDataResult::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetTitleDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetTitleDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetTitleDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13674,19 +24034,53 @@ bool PlayFab::ClientModels::FGetTitleDataResult::readFromValue(const TSharedPtr<
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetTitleDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitleDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetTitleNewsRequest::~FGetTitleNewsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetTitleNewsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetTitleNewsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13699,6 +24093,16 @@ void PlayFab::ClientModels::FGetTitleNewsRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetTitleNewsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetTitleNewsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetTitleNewsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13713,12 +24117,39 @@ bool PlayFab::ClientModels::FGetTitleNewsRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetTitleNewsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Count"))
+        {
+            reader.ReadValue(Count);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitleNewsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FTitleNewsItem::~FTitleNewsItem()
 {
 
 }
 
-void PlayFab::ClientModels::FTitleNewsItem::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FTitleNewsItem::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13746,6 +24177,16 @@ void PlayFab::ClientModels::FTitleNewsItem::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FTitleNewsItem::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FTitleNewsItem::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FTitleNewsItem::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13779,12 +24220,51 @@ bool PlayFab::ClientModels::FTitleNewsItem::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FTitleNewsItem::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Body"))
+        {
+            reader.ReadValue(Body);
+        }
+        else if (reader.IsField("NewsId"))
+        {
+            reader.ReadValue(NewsId);
+        }
+        else if (reader.IsField("Timestamp"))
+        {
+            reader.ReadValue(Timestamp);
+        }
+        else if (reader.IsField("Title"))
+        {
+            reader.ReadValue(Title);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FTitleNewsItem();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetTitleNewsResult::~FGetTitleNewsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetTitleNewsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetTitleNewsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13800,6 +24280,16 @@ void PlayFab::ClientModels::FGetTitleNewsResult::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetTitleNewsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetTitleNewsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetTitleNewsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13808,19 +24298,53 @@ bool PlayFab::ClientModels::FGetTitleNewsResult::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < NewsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = NewsArray[Idx];
-        News.Add(FTitleNewsItem(CurrentItem->AsObject()));
+        News.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetTitleNewsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("News"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { News[News.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitleNewsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetTitlePublicKeyRequest::~FGetTitlePublicKeyRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetTitlePublicKeyRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetTitlePublicKeyRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13847,6 +24371,16 @@ void PlayFab::ClientModels::FGetTitlePublicKeyRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetTitlePublicKeyRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetTitlePublicKeyRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetTitlePublicKeyRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13868,12 +24402,43 @@ bool PlayFab::ClientModels::FGetTitlePublicKeyRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetTitlePublicKeyRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else if (reader.IsField("TitleSharedSecret"))
+        {
+            reader.ReadValue(TitleSharedSecret);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitlePublicKeyRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetTitlePublicKeyResult::~FGetTitlePublicKeyResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetTitlePublicKeyResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetTitlePublicKeyResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13886,6 +24451,16 @@ void PlayFab::ClientModels::FGetTitlePublicKeyResult::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetTitlePublicKeyResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetTitlePublicKeyResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetTitlePublicKeyResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13900,12 +24475,39 @@ bool PlayFab::ClientModels::FGetTitlePublicKeyResult::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetTitlePublicKeyResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("RSAPublicKey"))
+        {
+            reader.ReadValue(RSAPublicKey);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitlePublicKeyResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetTradeStatusRequest::~FGetTradeStatusRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetTradeStatusRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetTradeStatusRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13932,6 +24534,16 @@ void PlayFab::ClientModels::FGetTradeStatusRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetTradeStatusRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetTradeStatusRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetTradeStatusRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13953,13 +24565,44 @@ bool PlayFab::ClientModels::FGetTradeStatusRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetTradeStatusRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("OfferingPlayerId"))
+        {
+            reader.ReadValue(OfferingPlayerId);
+        }
+        else if (reader.IsField("TradeId"))
+        {
+            reader.ReadValue(TradeId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTradeStatusRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetTradeStatusResponse::~FGetTradeStatusResponse()
 {
     //if (Trade != nullptr) delete Trade;
 
 }
 
-void PlayFab::ClientModels::FGetTradeStatusResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetTradeStatusResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13972,6 +24615,16 @@ void PlayFab::ClientModels::FGetTradeStatusResponse::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetTradeStatusResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetTradeStatusResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetTradeStatusResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13979,22 +24632,50 @@ bool PlayFab::ClientModels::FGetTradeStatusResponse::readFromValue(const TShared
     const TSharedPtr<FJsonValue> TradeValue = obj->TryGetField(TEXT("Trade"));
     if (TradeValue.IsValid() && !TradeValue->IsNull())
     {
-        Trade = MakeShareable(new FTradeInfo(TradeValue->AsObject()));
+        Trade = MakeShared<FTradeInfo>(TradeValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FGetUserDataRequest::~FGetUserDataRequest()
+bool PlayFab::ClientModels::FGetTradeStatusResponse::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::ClientModels::FGetUserDataRequest::writeJSON(JsonWriter& writer) const
-{
-    writer->WriteObjectStart();
+        if (reader.IsField("Trade"))
+        {
+            Trade = MakeShared<FTradeInfo>();
+            Trade->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
 
-    if (IfChangedFromDataVersion.notNull())
+    if (!reader.IsValid())
+    {
+        *this = FGetTradeStatusResponse();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FGetUserDataRequest::~FGetUserDataRequest()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FGetUserDataRequest::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
+
+    if (IfChangedFromDataVersion.notNull())
     {
         writer->WriteIdentifierPrefix(TEXT("IfChangedFromDataVersion"));
         writer->WriteValue(static_cast<int64>(IfChangedFromDataVersion));
@@ -14018,6 +24699,16 @@ void PlayFab::ClientModels::FGetUserDataRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetUserDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetUserDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetUserDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14041,12 +24732,54 @@ bool PlayFab::ClientModels::FGetUserDataRequest::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetUserDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("IfChangedFromDataVersion"))
+        {
+            reader.ReadValue(IfChangedFromDataVersion);
+        }
+        else if (reader.IsField("Keys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Keys.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetUserDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetUserDataResult::~FGetUserDataResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetUserDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetUserDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14067,6 +24800,16 @@ void PlayFab::ClientModels::FGetUserDataResult::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetUserDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetUserDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetUserDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14076,7 +24819,7 @@ bool PlayFab::ClientModels::FGetUserDataResult::readFromValue(const TSharedPtr<F
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), FUserDataRecord(It.Value()->AsObject()));
+            Data.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -14090,12 +24833,50 @@ bool PlayFab::ClientModels::FGetUserDataResult::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetUserDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { Data.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("DataVersion"))
+        {
+            reader.ReadValue(DataVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetUserDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetUserInventoryRequest::~FGetUserInventoryRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetUserInventoryRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetUserInventoryRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14113,6 +24894,16 @@ void PlayFab::ClientModels::FGetUserInventoryRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetUserInventoryRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetUserInventoryRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetUserInventoryRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14122,19 +24913,53 @@ bool PlayFab::ClientModels::FGetUserInventoryRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetUserInventoryRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetUserInventoryRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetUserInventoryResult::~FGetUserInventoryResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGetUserInventoryResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetUserInventoryResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14172,6 +24997,16 @@ void PlayFab::ClientModels::FGetUserInventoryResult::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetUserInventoryResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetUserInventoryResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetUserInventoryResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14180,7 +25015,7 @@ bool PlayFab::ClientModels::FGetUserInventoryResult::readFromValue(const TShared
     for (int32 Idx = 0; Idx < InventoryArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = InventoryArray[Idx];
-        Inventory.Add(FItemInstance(CurrentItem->AsObject()));
+        Inventory.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -14190,7 +25025,7 @@ bool PlayFab::ClientModels::FGetUserInventoryResult::readFromValue(const TShared
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrency.Add(It.Key(), TmpValue);
+            VirtualCurrency.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -14199,19 +25034,75 @@ bool PlayFab::ClientModels::FGetUserInventoryResult::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyRechargeTimesObject)->Values); It; ++It)
         {
-            VirtualCurrencyRechargeTimes.Add(It.Key(), FVirtualCurrencyRechargeTime(It.Value()->AsObject()));
+            VirtualCurrencyRechargeTimes.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetUserInventoryResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Inventory"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Inventory[Inventory.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrency.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyRechargeTimes"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { VirtualCurrencyRechargeTimes.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetUserInventoryResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetWindowsHelloChallengeRequest::~FGetWindowsHelloChallengeRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGetWindowsHelloChallengeRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetWindowsHelloChallengeRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14238,6 +25129,16 @@ void PlayFab::ClientModels::FGetWindowsHelloChallengeRequest::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetWindowsHelloChallengeRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetWindowsHelloChallengeRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetWindowsHelloChallengeRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14259,12 +25160,43 @@ bool PlayFab::ClientModels::FGetWindowsHelloChallengeRequest::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetWindowsHelloChallengeRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PublicKeyHint"))
+        {
+            reader.ReadValue(PublicKeyHint);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetWindowsHelloChallengeRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGetWindowsHelloChallengeResponse::~FGetWindowsHelloChallengeResponse()
 {
 
 }
 
-void PlayFab::ClientModels::FGetWindowsHelloChallengeResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGetWindowsHelloChallengeResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14277,6 +25209,16 @@ void PlayFab::ClientModels::FGetWindowsHelloChallengeResponse::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGetWindowsHelloChallengeResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGetWindowsHelloChallengeResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGetWindowsHelloChallengeResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14291,12 +25233,39 @@ bool PlayFab::ClientModels::FGetWindowsHelloChallengeResponse::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGetWindowsHelloChallengeResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Challenge"))
+        {
+            reader.ReadValue(Challenge);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetWindowsHelloChallengeResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGrantCharacterToUserRequest::~FGrantCharacterToUserRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FGrantCharacterToUserRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGrantCharacterToUserRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14340,6 +25309,16 @@ void PlayFab::ClientModels::FGrantCharacterToUserRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGrantCharacterToUserRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGrantCharacterToUserRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGrantCharacterToUserRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14363,7 +25342,7 @@ bool PlayFab::ClientModels::FGrantCharacterToUserRequest::readFromValue(const TS
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -14377,12 +25356,58 @@ bool PlayFab::ClientModels::FGrantCharacterToUserRequest::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGrantCharacterToUserRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CharacterName"))
+        {
+            reader.ReadValue(CharacterName);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGrantCharacterToUserRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FGrantCharacterToUserResult::~FGrantCharacterToUserResult()
 {
 
 }
 
-void PlayFab::ClientModels::FGrantCharacterToUserResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FGrantCharacterToUserResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14404,6 +25429,16 @@ void PlayFab::ClientModels::FGrantCharacterToUserResult::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FGrantCharacterToUserResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FGrantCharacterToUserResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FGrantCharacterToUserResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14432,12 +25467,47 @@ bool PlayFab::ClientModels::FGrantCharacterToUserResult::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FGrantCharacterToUserResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CharacterType"))
+        {
+            reader.ReadValue(CharacterType);
+        }
+        else if (reader.IsField("Result"))
+        {
+            reader.ReadValue(Result);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGrantCharacterToUserResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FItemPurchaseRequest::~FItemPurchaseRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FItemPurchaseRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FItemPurchaseRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14472,6 +25542,16 @@ void PlayFab::ClientModels::FItemPurchaseRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FItemPurchaseRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FItemPurchaseRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FItemPurchaseRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14502,12 +25582,58 @@ bool PlayFab::ClientModels::FItemPurchaseRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FItemPurchaseRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Annotation"))
+        {
+            reader.ReadValue(Annotation);
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else if (reader.IsField("Quantity"))
+        {
+            reader.ReadValue(Quantity);
+        }
+        else if (reader.IsField("UpgradeFromItems"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { UpgradeFromItems.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FItemPurchaseRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkAndroidDeviceIDRequest::~FLinkAndroidDeviceIDRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkAndroidDeviceIDRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkAndroidDeviceIDRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14553,6 +25679,16 @@ void PlayFab::ClientModels::FLinkAndroidDeviceIDRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkAndroidDeviceIDRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkAndroidDeviceIDRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkAndroidDeviceIDRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14576,7 +25712,7 @@ bool PlayFab::ClientModels::FLinkAndroidDeviceIDRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -14597,18 +25733,78 @@ bool PlayFab::ClientModels::FLinkAndroidDeviceIDRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkAndroidDeviceIDRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AndroidDevice"))
+        {
+            reader.ReadValue(AndroidDevice);
+        }
+        else if (reader.IsField("AndroidDeviceId"))
+        {
+            reader.ReadValue(AndroidDeviceId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else if (reader.IsField("OS"))
+        {
+            reader.ReadValue(OS);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkAndroidDeviceIDRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkAndroidDeviceIDResult::~FLinkAndroidDeviceIDResult()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkAndroidDeviceIDResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkAndroidDeviceIDResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkAndroidDeviceIDResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkAndroidDeviceIDResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkAndroidDeviceIDResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14616,12 +25812,34 @@ bool PlayFab::ClientModels::FLinkAndroidDeviceIDResult::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkAndroidDeviceIDResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkAndroidDeviceIDResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkAppleRequest::~FLinkAppleRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkAppleRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkAppleRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14655,6 +25873,16 @@ void PlayFab::ClientModels::FLinkAppleRequest::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkAppleRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkAppleRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkAppleRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14664,7 +25892,7 @@ bool PlayFab::ClientModels::FLinkAppleRequest::readFromValue(const TSharedPtr<FJ
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -14685,12 +25913,54 @@ bool PlayFab::ClientModels::FLinkAppleRequest::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkAppleRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else if (reader.IsField("IdentityToken"))
+        {
+            reader.ReadValue(IdentityToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkAppleRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkCustomIDRequest::~FLinkCustomIDRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkCustomIDRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkCustomIDRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14724,6 +25994,16 @@ void PlayFab::ClientModels::FLinkCustomIDRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkCustomIDRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkCustomIDRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkCustomIDRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14740,7 +26020,7 @@ bool PlayFab::ClientModels::FLinkCustomIDRequest::readFromValue(const TSharedPtr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -14754,18 +26034,70 @@ bool PlayFab::ClientModels::FLinkCustomIDRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkCustomIDRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomId"))
+        {
+            reader.ReadValue(CustomId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkCustomIDRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkCustomIDResult::~FLinkCustomIDResult()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkCustomIDResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkCustomIDResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkCustomIDResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkCustomIDResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkCustomIDResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14773,12 +26105,34 @@ bool PlayFab::ClientModels::FLinkCustomIDResult::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkCustomIDResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkCustomIDResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkFacebookAccountRequest::~FLinkFacebookAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkFacebookAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkFacebookAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14812,6 +26166,16 @@ void PlayFab::ClientModels::FLinkFacebookAccountRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkFacebookAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkFacebookAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkFacebookAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14828,7 +26192,7 @@ bool PlayFab::ClientModels::FLinkFacebookAccountRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -14842,18 +26206,70 @@ bool PlayFab::ClientModels::FLinkFacebookAccountRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkFacebookAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AccessToken"))
+        {
+            reader.ReadValue(AccessToken);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkFacebookAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkFacebookAccountResult::~FLinkFacebookAccountResult()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkFacebookAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkFacebookAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkFacebookAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkFacebookAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkFacebookAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14861,12 +26277,34 @@ bool PlayFab::ClientModels::FLinkFacebookAccountResult::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkFacebookAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkFacebookAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkFacebookInstantGamesIdRequest::~FLinkFacebookInstantGamesIdRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkFacebookInstantGamesIdRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkFacebookInstantGamesIdRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14900,6 +26338,16 @@ void PlayFab::ClientModels::FLinkFacebookInstantGamesIdRequest::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkFacebookInstantGamesIdRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkFacebookInstantGamesIdRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkFacebookInstantGamesIdRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14909,7 +26357,7 @@ bool PlayFab::ClientModels::FLinkFacebookInstantGamesIdRequest::readFromValue(co
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -14930,18 +26378,70 @@ bool PlayFab::ClientModels::FLinkFacebookInstantGamesIdRequest::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkFacebookInstantGamesIdRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("FacebookInstantGamesSignature"))
+        {
+            reader.ReadValue(FacebookInstantGamesSignature);
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkFacebookInstantGamesIdRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkFacebookInstantGamesIdResult::~FLinkFacebookInstantGamesIdResult()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkFacebookInstantGamesIdResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkFacebookInstantGamesIdResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkFacebookInstantGamesIdResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkFacebookInstantGamesIdResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkFacebookInstantGamesIdResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14949,12 +26449,34 @@ bool PlayFab::ClientModels::FLinkFacebookInstantGamesIdResult::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkFacebookInstantGamesIdResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkFacebookInstantGamesIdResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkGameCenterAccountRequest::~FLinkGameCenterAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkGameCenterAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkGameCenterAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15012,6 +26534,16 @@ void PlayFab::ClientModels::FLinkGameCenterAccountRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkGameCenterAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkGameCenterAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkGameCenterAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15021,7 +26553,7 @@ bool PlayFab::ClientModels::FLinkGameCenterAccountRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -15070,18 +26602,86 @@ bool PlayFab::ClientModels::FLinkGameCenterAccountRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkGameCenterAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else if (reader.IsField("GameCenterId"))
+        {
+            reader.ReadValue(GameCenterId);
+        }
+        else if (reader.IsField("PublicKeyUrl"))
+        {
+            reader.ReadValue(PublicKeyUrl);
+        }
+        else if (reader.IsField("Salt"))
+        {
+            reader.ReadValue(Salt);
+        }
+        else if (reader.IsField("Signature"))
+        {
+            reader.ReadValue(Signature);
+        }
+        else if (reader.IsField("Timestamp"))
+        {
+            reader.ReadValue(Timestamp);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkGameCenterAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkGameCenterAccountResult::~FLinkGameCenterAccountResult()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkGameCenterAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkGameCenterAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkGameCenterAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkGameCenterAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkGameCenterAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15089,12 +26689,34 @@ bool PlayFab::ClientModels::FLinkGameCenterAccountResult::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkGameCenterAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkGameCenterAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkGoogleAccountRequest::~FLinkGoogleAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkGoogleAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkGoogleAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15124,6 +26746,16 @@ void PlayFab::ClientModels::FLinkGoogleAccountRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkGoogleAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkGoogleAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkGoogleAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15133,7 +26765,7 @@ bool PlayFab::ClientModels::FLinkGoogleAccountRequest::readFromValue(const TShar
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -15154,18 +26786,70 @@ bool PlayFab::ClientModels::FLinkGoogleAccountRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkGoogleAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else if (reader.IsField("ServerAuthCode"))
+        {
+            reader.ReadValue(ServerAuthCode);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkGoogleAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkGoogleAccountResult::~FLinkGoogleAccountResult()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkGoogleAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkGoogleAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkGoogleAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkGoogleAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkGoogleAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15173,12 +26857,34 @@ bool PlayFab::ClientModels::FLinkGoogleAccountResult::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkGoogleAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkGoogleAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkIOSDeviceIDRequest::~FLinkIOSDeviceIDRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkIOSDeviceIDRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkIOSDeviceIDRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15224,16 +26930,26 @@ void PlayFab::ClientModels::FLinkIOSDeviceIDRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
-bool PlayFab::ClientModels::FLinkIOSDeviceIDRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
+void PlayFab::ClientModels::FLinkIOSDeviceIDRequest::writeJSON(JsonWriter& writer) const
 {
-    bool HasSucceeded = true;
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkIOSDeviceIDRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
+bool PlayFab::ClientModels::FLinkIOSDeviceIDRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
+{
+    bool HasSucceeded = true;
 
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -15268,18 +26984,78 @@ bool PlayFab::ClientModels::FLinkIOSDeviceIDRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkIOSDeviceIDRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("DeviceId"))
+        {
+            reader.ReadValue(DeviceId);
+        }
+        else if (reader.IsField("DeviceModel"))
+        {
+            reader.ReadValue(DeviceModel);
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else if (reader.IsField("OS"))
+        {
+            reader.ReadValue(OS);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkIOSDeviceIDRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkIOSDeviceIDResult::~FLinkIOSDeviceIDResult()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkIOSDeviceIDResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkIOSDeviceIDResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkIOSDeviceIDResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkIOSDeviceIDResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkIOSDeviceIDResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15287,12 +27063,34 @@ bool PlayFab::ClientModels::FLinkIOSDeviceIDResult::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkIOSDeviceIDResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkIOSDeviceIDResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkKongregateAccountRequest::~FLinkKongregateAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkKongregateAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkKongregateAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15336,6 +27134,16 @@ void PlayFab::ClientModels::FLinkKongregateAccountRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkKongregateAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkKongregateAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkKongregateAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15352,7 +27160,7 @@ bool PlayFab::ClientModels::FLinkKongregateAccountRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -15373,18 +27181,74 @@ bool PlayFab::ClientModels::FLinkKongregateAccountRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkKongregateAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AuthTicket"))
+        {
+            reader.ReadValue(AuthTicket);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else if (reader.IsField("KongregateId"))
+        {
+            reader.ReadValue(KongregateId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkKongregateAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkKongregateAccountResult::~FLinkKongregateAccountResult()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkKongregateAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkKongregateAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkKongregateAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkKongregateAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkKongregateAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15392,12 +27256,34 @@ bool PlayFab::ClientModels::FLinkKongregateAccountResult::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkKongregateAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkKongregateAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkNintendoServiceAccountRequest::~FLinkNintendoServiceAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkNintendoServiceAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkNintendoServiceAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15431,6 +27317,16 @@ void PlayFab::ClientModels::FLinkNintendoServiceAccountRequest::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkNintendoServiceAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkNintendoServiceAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkNintendoServiceAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15440,7 +27336,7 @@ bool PlayFab::ClientModels::FLinkNintendoServiceAccountRequest::readFromValue(co
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -15461,12 +27357,54 @@ bool PlayFab::ClientModels::FLinkNintendoServiceAccountRequest::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkNintendoServiceAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else if (reader.IsField("IdentityToken"))
+        {
+            reader.ReadValue(IdentityToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkNintendoServiceAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdRequest::~FLinkNintendoSwitchDeviceIdRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15500,6 +27438,16 @@ void PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdRequest::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15509,7 +27457,7 @@ bool PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdRequest::readFromValue(co
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -15530,18 +27478,70 @@ bool PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdRequest::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else if (reader.IsField("NintendoSwitchDeviceId"))
+        {
+            reader.ReadValue(NintendoSwitchDeviceId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkNintendoSwitchDeviceIdRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdResult::~FLinkNintendoSwitchDeviceIdResult()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15549,12 +27549,34 @@ bool PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdResult::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkNintendoSwitchDeviceIdResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkNintendoSwitchDeviceIdResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkOpenIdConnectRequest::~FLinkOpenIdConnectRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkOpenIdConnectRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkOpenIdConnectRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15598,6 +27620,16 @@ void PlayFab::ClientModels::FLinkOpenIdConnectRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkOpenIdConnectRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkOpenIdConnectRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkOpenIdConnectRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15614,7 +27646,7 @@ bool PlayFab::ClientModels::FLinkOpenIdConnectRequest::readFromValue(const TShar
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -15635,12 +27667,58 @@ bool PlayFab::ClientModels::FLinkOpenIdConnectRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkOpenIdConnectRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ConnectionId"))
+        {
+            reader.ReadValue(ConnectionId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else if (reader.IsField("IdToken"))
+        {
+            reader.ReadValue(IdToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkOpenIdConnectRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkPSNAccountRequest::~FLinkPSNAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkPSNAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkPSNAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15690,6 +27768,16 @@ void PlayFab::ClientModels::FLinkPSNAccountRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkPSNAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkPSNAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkPSNAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15706,7 +27794,7 @@ bool PlayFab::ClientModels::FLinkPSNAccountRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -15734,18 +27822,78 @@ bool PlayFab::ClientModels::FLinkPSNAccountRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkPSNAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AuthCode"))
+        {
+            reader.ReadValue(AuthCode);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else if (reader.IsField("IssuerId"))
+        {
+            reader.ReadValue(IssuerId);
+        }
+        else if (reader.IsField("RedirectUri"))
+        {
+            reader.ReadValue(RedirectUri);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkPSNAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkPSNAccountResult::~FLinkPSNAccountResult()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkPSNAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkPSNAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkPSNAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkPSNAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkPSNAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15753,12 +27901,34 @@ bool PlayFab::ClientModels::FLinkPSNAccountResult::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkPSNAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkPSNAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkSteamAccountRequest::~FLinkSteamAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkSteamAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkSteamAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15792,6 +27962,16 @@ void PlayFab::ClientModels::FLinkSteamAccountRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkSteamAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkSteamAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkSteamAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15801,7 +27981,7 @@ bool PlayFab::ClientModels::FLinkSteamAccountRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -15822,31 +28002,105 @@ bool PlayFab::ClientModels::FLinkSteamAccountRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkSteamAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else if (reader.IsField("SteamTicket"))
+        {
+            reader.ReadValue(SteamTicket);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkSteamAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkSteamAccountResult::~FLinkSteamAccountResult()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkSteamAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkSteamAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
-bool PlayFab::ClientModels::FLinkSteamAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
+void PlayFab::ClientModels::FLinkSteamAccountResult::writeJSON(JsonWriter& writer) const
 {
-    bool HasSucceeded = true;
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkSteamAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
+bool PlayFab::ClientModels::FLinkSteamAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
+{
+    bool HasSucceeded = true;
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkSteamAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkSteamAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkTwitchAccountRequest::~FLinkTwitchAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkTwitchAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkTwitchAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15880,6 +28134,16 @@ void PlayFab::ClientModels::FLinkTwitchAccountRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkTwitchAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkTwitchAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkTwitchAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15896,7 +28160,7 @@ bool PlayFab::ClientModels::FLinkTwitchAccountRequest::readFromValue(const TShar
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -15910,18 +28174,70 @@ bool PlayFab::ClientModels::FLinkTwitchAccountRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkTwitchAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AccessToken"))
+        {
+            reader.ReadValue(AccessToken);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkTwitchAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkTwitchAccountResult::~FLinkTwitchAccountResult()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkTwitchAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkTwitchAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkTwitchAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkTwitchAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkTwitchAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15929,12 +28245,34 @@ bool PlayFab::ClientModels::FLinkTwitchAccountResult::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkTwitchAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkTwitchAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkWindowsHelloAccountRequest::~FLinkWindowsHelloAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkWindowsHelloAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkWindowsHelloAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15984,6 +28322,16 @@ void PlayFab::ClientModels::FLinkWindowsHelloAccountRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkWindowsHelloAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkWindowsHelloAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkWindowsHelloAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15993,7 +28341,7 @@ bool PlayFab::ClientModels::FLinkWindowsHelloAccountRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -16028,18 +28376,78 @@ bool PlayFab::ClientModels::FLinkWindowsHelloAccountRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkWindowsHelloAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("DeviceName"))
+        {
+            reader.ReadValue(DeviceName);
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else if (reader.IsField("PublicKey"))
+        {
+            reader.ReadValue(PublicKey);
+        }
+        else if (reader.IsField("UserName"))
+        {
+            reader.ReadValue(UserName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkWindowsHelloAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkWindowsHelloAccountResponse::~FLinkWindowsHelloAccountResponse()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkWindowsHelloAccountResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkWindowsHelloAccountResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkWindowsHelloAccountResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkWindowsHelloAccountResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkWindowsHelloAccountResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16047,12 +28455,34 @@ bool PlayFab::ClientModels::FLinkWindowsHelloAccountResponse::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkWindowsHelloAccountResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkWindowsHelloAccountResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkXboxAccountRequest::~FLinkXboxAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkXboxAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkXboxAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16086,6 +28516,16 @@ void PlayFab::ClientModels::FLinkXboxAccountRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkXboxAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkXboxAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkXboxAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16095,7 +28535,7 @@ bool PlayFab::ClientModels::FLinkXboxAccountRequest::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -16116,18 +28556,70 @@ bool PlayFab::ClientModels::FLinkXboxAccountRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkXboxAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else if (reader.IsField("XboxToken"))
+        {
+            reader.ReadValue(XboxToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkXboxAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLinkXboxAccountResult::~FLinkXboxAccountResult()
 {
 
 }
 
-void PlayFab::ClientModels::FLinkXboxAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLinkXboxAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLinkXboxAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLinkXboxAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLinkXboxAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16135,12 +28627,34 @@ bool PlayFab::ClientModels::FLinkXboxAccountResult::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLinkXboxAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkXboxAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FListUsersCharactersRequest::~FListUsersCharactersRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FListUsersCharactersRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FListUsersCharactersRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16153,6 +28667,16 @@ void PlayFab::ClientModels::FListUsersCharactersRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FListUsersCharactersRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FListUsersCharactersRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FListUsersCharactersRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16167,12 +28691,39 @@ bool PlayFab::ClientModels::FListUsersCharactersRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FListUsersCharactersRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListUsersCharactersRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FListUsersCharactersResult::~FListUsersCharactersResult()
 {
 
 }
 
-void PlayFab::ClientModels::FListUsersCharactersResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FListUsersCharactersResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16188,6 +28739,16 @@ void PlayFab::ClientModels::FListUsersCharactersResult::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FListUsersCharactersResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FListUsersCharactersResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FListUsersCharactersResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16196,19 +28757,53 @@ bool PlayFab::ClientModels::FListUsersCharactersResult::readFromValue(const TSha
     for (int32 Idx = 0; Idx < CharactersArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = CharactersArray[Idx];
-        Characters.Add(FCharacterResult(CurrentItem->AsObject()));
+        Characters.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FListUsersCharactersResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Characters"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Characters[Characters.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListUsersCharactersResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUserSettings::~FUserSettings()
 {
 
 }
 
-void PlayFab::ClientModels::FUserSettings::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUserSettings::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16224,6 +28819,16 @@ void PlayFab::ClientModels::FUserSettings::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUserSettings::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUserSettings::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUserSettings::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16252,12 +28857,47 @@ bool PlayFab::ClientModels::FUserSettings::readFromValue(const TSharedPtr<FJsonO
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUserSettings::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GatherDeviceInfo"))
+        {
+            reader.ReadValue(GatherDeviceInfo);
+        }
+        else if (reader.IsField("GatherFocusInfo"))
+        {
+            reader.ReadValue(GatherFocusInfo);
+        }
+        else if (reader.IsField("NeedsAttribution"))
+        {
+            reader.ReadValue(NeedsAttribution);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserSettings();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FVariable::~FVariable()
 {
 
 }
 
-void PlayFab::ClientModels::FVariable::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FVariable::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16280,6 +28920,16 @@ void PlayFab::ClientModels::FVariable::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FVariable::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FVariable::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FVariable::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16301,12 +28951,43 @@ bool PlayFab::ClientModels::FVariable::readFromValue(const TSharedPtr<FJsonObjec
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FVariable::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FVariable();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FTreatmentAssignment::~FTreatmentAssignment()
 {
 
 }
 
-void PlayFab::ClientModels::FTreatmentAssignment::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FTreatmentAssignment::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16331,6 +29012,16 @@ void PlayFab::ClientModels::FTreatmentAssignment::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FTreatmentAssignment::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FTreatmentAssignment::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FTreatmentAssignment::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16339,7 +29030,7 @@ bool PlayFab::ClientModels::FTreatmentAssignment::readFromValue(const TSharedPtr
     for (int32 Idx = 0; Idx < VariablesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = VariablesArray[Idx];
-        Variables.Add(FVariable(CurrentItem->AsObject()));
+        Variables.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -16348,6 +29039,50 @@ bool PlayFab::ClientModels::FTreatmentAssignment::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FTreatmentAssignment::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Variables"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Variables[Variables.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Variants"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Variants.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FTreatmentAssignment();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginResult::~FLoginResult()
 {
     //if (EntityToken != nullptr) delete EntityToken;
@@ -16357,7 +29092,8 @@ PlayFab::ClientModels::FLoginResult::~FLoginResult()
 
 }
 
-void PlayFab::ClientModels::FLoginResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16409,6 +29145,16 @@ void PlayFab::ClientModels::FLoginResult::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16416,13 +29162,13 @@ bool PlayFab::ClientModels::FLoginResult::readFromValue(const TSharedPtr<FJsonOb
     const TSharedPtr<FJsonValue> EntityTokenValue = obj->TryGetField(TEXT("EntityToken"));
     if (EntityTokenValue.IsValid() && !EntityTokenValue->IsNull())
     {
-        EntityToken = MakeShareable(new FEntityTokenResponse(EntityTokenValue->AsObject()));
+        EntityToken = MakeShared<FEntityTokenResponse>(EntityTokenValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> InfoResultPayloadValue = obj->TryGetField(TEXT("InfoResultPayload"));
     if (InfoResultPayloadValue.IsValid() && !InfoResultPayloadValue->IsNull())
     {
-        InfoResultPayload = MakeShareable(new FGetPlayerCombinedInfoResultPayload(InfoResultPayloadValue->AsObject()));
+        InfoResultPayload = MakeShared<FGetPlayerCombinedInfoResultPayload>(InfoResultPayloadValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> LastLoginTimeValue = obj->TryGetField(TEXT("LastLoginTime"));
@@ -16454,25 +29200,84 @@ bool PlayFab::ClientModels::FLoginResult::readFromValue(const TSharedPtr<FJsonOb
     const TSharedPtr<FJsonValue> SettingsForUserValue = obj->TryGetField(TEXT("SettingsForUser"));
     if (SettingsForUserValue.IsValid() && !SettingsForUserValue->IsNull())
     {
-        SettingsForUser = MakeShareable(new FUserSettings(SettingsForUserValue->AsObject()));
+        SettingsForUser = MakeShared<FUserSettings>(SettingsForUserValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> TreatmentAssignmentValue = obj->TryGetField(TEXT("TreatmentAssignment"));
     if (TreatmentAssignmentValue.IsValid() && !TreatmentAssignmentValue->IsNull())
     {
-        pfTreatmentAssignment = MakeShareable(new FTreatmentAssignment(TreatmentAssignmentValue->AsObject()));
+        pfTreatmentAssignment = MakeShared<FTreatmentAssignment>(TreatmentAssignmentValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("EntityToken"))
+        {
+            EntityToken = MakeShared<FEntityTokenResponse>();
+            EntityToken->readFromReader(reader);
+        }
+        else if (reader.IsField("InfoResultPayload"))
+        {
+            InfoResultPayload = MakeShared<FGetPlayerCombinedInfoResultPayload>();
+            InfoResultPayload->readFromReader(reader);
+        }
+        else if (reader.IsField("LastLoginTime"))
+        {
+            reader.ReadValue(LastLoginTime);
+        }
+        else if (reader.IsField("NewlyCreated"))
+        {
+            reader.ReadValue(NewlyCreated);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("SessionTicket"))
+        {
+            reader.ReadValue(SessionTicket);
+        }
+        else if (reader.IsField("SettingsForUser"))
+        {
+            SettingsForUser = MakeShared<FUserSettings>();
+            SettingsForUser->readFromReader(reader);
+        }
+        else if (reader.IsField("TreatmentAssignment"))
+        {
+            pfTreatmentAssignment = MakeShared<FTreatmentAssignment>();
+            pfTreatmentAssignment->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginWithAndroidDeviceIDRequest::~FLoginWithAndroidDeviceIDRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FLoginWithAndroidDeviceIDRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithAndroidDeviceIDRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16542,6 +29347,16 @@ void PlayFab::ClientModels::FLoginWithAndroidDeviceIDRequest::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginWithAndroidDeviceIDRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithAndroidDeviceIDRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginWithAndroidDeviceIDRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16572,7 +29387,7 @@ bool PlayFab::ClientModels::FLoginWithAndroidDeviceIDRequest::readFromValue(cons
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -16586,7 +29401,7 @@ bool PlayFab::ClientModels::FLoginWithAndroidDeviceIDRequest::readFromValue(cons
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> OSValue = obj->TryGetField(TEXT("OS"));
@@ -16613,13 +29428,80 @@ bool PlayFab::ClientModels::FLoginWithAndroidDeviceIDRequest::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginWithAndroidDeviceIDRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AndroidDevice"))
+        {
+            reader.ReadValue(AndroidDevice);
+        }
+        else if (reader.IsField("AndroidDeviceId"))
+        {
+            reader.ReadValue(AndroidDeviceId);
+        }
+        else if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("OS"))
+        {
+            reader.ReadValue(OS);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithAndroidDeviceIDRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginWithAppleRequest::~FLoginWithAppleRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FLoginWithAppleRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithAppleRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16681,6 +29563,16 @@ void PlayFab::ClientModels::FLoginWithAppleRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginWithAppleRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithAppleRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginWithAppleRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16697,7 +29589,7 @@ bool PlayFab::ClientModels::FLoginWithAppleRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -16718,7 +29610,7 @@ bool PlayFab::ClientModels::FLoginWithAppleRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PlayerSecretValue = obj->TryGetField(TEXT("PlayerSecret"));
@@ -16738,13 +29630,72 @@ bool PlayFab::ClientModels::FLoginWithAppleRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginWithAppleRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("IdentityToken"))
+        {
+            reader.ReadValue(IdentityToken);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithAppleRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginWithCustomIDRequest::~FLoginWithCustomIDRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FLoginWithCustomIDRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithCustomIDRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16802,6 +29753,16 @@ void PlayFab::ClientModels::FLoginWithCustomIDRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginWithCustomIDRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithCustomIDRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginWithCustomIDRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16825,7 +29786,7 @@ bool PlayFab::ClientModels::FLoginWithCustomIDRequest::readFromValue(const TShar
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -16839,7 +29800,7 @@ bool PlayFab::ClientModels::FLoginWithCustomIDRequest::readFromValue(const TShar
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PlayerSecretValue = obj->TryGetField(TEXT("PlayerSecret"));
@@ -16859,13 +29820,72 @@ bool PlayFab::ClientModels::FLoginWithCustomIDRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginWithCustomIDRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomId"))
+        {
+            reader.ReadValue(CustomId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithCustomIDRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginWithEmailAddressRequest::~FLoginWithEmailAddressRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FLoginWithEmailAddressRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithEmailAddressRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16919,6 +29939,16 @@ void PlayFab::ClientModels::FLoginWithEmailAddressRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginWithEmailAddressRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithEmailAddressRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginWithEmailAddressRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16928,7 +29958,7 @@ bool PlayFab::ClientModels::FLoginWithEmailAddressRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -16942,7 +29972,7 @@ bool PlayFab::ClientModels::FLoginWithEmailAddressRequest::readFromValue(const T
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PasswordValue = obj->TryGetField(TEXT("Password"));
@@ -16962,13 +29992,64 @@ bool PlayFab::ClientModels::FLoginWithEmailAddressRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginWithEmailAddressRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Email"))
+        {
+            reader.ReadValue(Email);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("Password"))
+        {
+            reader.ReadValue(Password);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithEmailAddressRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginWithFacebookInstantGamesIdRequest::~FLoginWithFacebookInstantGamesIdRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FLoginWithFacebookInstantGamesIdRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithFacebookInstantGamesIdRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17030,6 +30111,16 @@ void PlayFab::ClientModels::FLoginWithFacebookInstantGamesIdRequest::writeJSON(J
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginWithFacebookInstantGamesIdRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithFacebookInstantGamesIdRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginWithFacebookInstantGamesIdRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17046,7 +30137,7 @@ bool PlayFab::ClientModels::FLoginWithFacebookInstantGamesIdRequest::readFromVal
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -17067,7 +30158,7 @@ bool PlayFab::ClientModels::FLoginWithFacebookInstantGamesIdRequest::readFromVal
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PlayerSecretValue = obj->TryGetField(TEXT("PlayerSecret"));
@@ -17087,13 +30178,72 @@ bool PlayFab::ClientModels::FLoginWithFacebookInstantGamesIdRequest::readFromVal
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginWithFacebookInstantGamesIdRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("FacebookInstantGamesSignature"))
+        {
+            reader.ReadValue(FacebookInstantGamesSignature);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithFacebookInstantGamesIdRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginWithFacebookRequest::~FLoginWithFacebookRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FLoginWithFacebookRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithFacebookRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17155,6 +30305,16 @@ void PlayFab::ClientModels::FLoginWithFacebookRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginWithFacebookRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithFacebookRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginWithFacebookRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17178,7 +30338,7 @@ bool PlayFab::ClientModels::FLoginWithFacebookRequest::readFromValue(const TShar
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -17192,7 +30352,7 @@ bool PlayFab::ClientModels::FLoginWithFacebookRequest::readFromValue(const TShar
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PlayerSecretValue = obj->TryGetField(TEXT("PlayerSecret"));
@@ -17212,13 +30372,72 @@ bool PlayFab::ClientModels::FLoginWithFacebookRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginWithFacebookRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AccessToken"))
+        {
+            reader.ReadValue(AccessToken);
+        }
+        else if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithFacebookRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginWithGameCenterRequest::~FLoginWithGameCenterRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FLoginWithGameCenterRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithGameCenterRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17300,6 +30519,16 @@ void PlayFab::ClientModels::FLoginWithGameCenterRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginWithGameCenterRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithGameCenterRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginWithGameCenterRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17316,7 +30545,7 @@ bool PlayFab::ClientModels::FLoginWithGameCenterRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -17330,7 +30559,7 @@ bool PlayFab::ClientModels::FLoginWithGameCenterRequest::readFromValue(const TSh
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PlayerIdValue = obj->TryGetField(TEXT("PlayerId"));
@@ -17385,34 +30614,109 @@ bool PlayFab::ClientModels::FLoginWithGameCenterRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FLoginWithGoogleAccountRequest::~FLoginWithGoogleAccountRequest()
-{
-    //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
-
-}
-
-void PlayFab::ClientModels::FLoginWithGoogleAccountRequest::writeJSON(JsonWriter& writer) const
+bool PlayFab::ClientModels::FLoginWithGameCenterRequest::readFromReader(FPlayFabJsonPullReader& reader)
 {
-    writer->WriteObjectStart();
+    if (!reader.ReadObjectStart())
+        return false;
 
-    if (CreateAccount.notNull())
+    while (reader.NextField())
     {
-        writer->WriteIdentifierPrefix(TEXT("CreateAccount"));
-        writer->WriteValue(CreateAccount);
-    }
+        if (reader.ReadNull())
+            continue;
 
-    if (CustomTags.Num() != 0)
-    {
-        writer->WriteObjectStart(TEXT("CustomTags"));
-        for (TMap<FString, FString>::TConstIterator It(CustomTags); It; ++It)
+        if (reader.IsField("CreateAccount"))
         {
-            writer->WriteIdentifierPrefix((*It).Key);
-            writer->WriteValue((*It).Value);
+            reader.ReadValue(CreateAccount);
         }
-        writer->WriteObjectEnd();
-    }
-
-    if (EncryptedRequest.IsEmpty() == false)
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayerId"))
+        {
+            reader.ReadValue(PlayerId);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("PublicKeyUrl"))
+        {
+            reader.ReadValue(PublicKeyUrl);
+        }
+        else if (reader.IsField("Salt"))
+        {
+            reader.ReadValue(Salt);
+        }
+        else if (reader.IsField("Signature"))
+        {
+            reader.ReadValue(Signature);
+        }
+        else if (reader.IsField("Timestamp"))
+        {
+            reader.ReadValue(Timestamp);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithGameCenterRequest();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FLoginWithGoogleAccountRequest::~FLoginWithGoogleAccountRequest()
+{
+    //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithGoogleAccountRequest::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
+
+    if (CreateAccount.notNull())
+    {
+        writer->WriteIdentifierPrefix(TEXT("CreateAccount"));
+        writer->WriteValue(CreateAccount);
+    }
+
+    if (CustomTags.Num() != 0)
+    {
+        writer->WriteObjectStart(TEXT("CustomTags"));
+        for (TMap<FString, FString>::TConstIterator It(CustomTags); It; ++It)
+        {
+            writer->WriteIdentifierPrefix((*It).Key);
+            writer->WriteValue((*It).Value);
+        }
+        writer->WriteObjectEnd();
+    }
+
+    if (EncryptedRequest.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("EncryptedRequest"));
         writer->WriteValue(EncryptedRequest);
@@ -17449,6 +30753,16 @@ void PlayFab::ClientModels::FLoginWithGoogleAccountRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginWithGoogleAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithGoogleAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginWithGoogleAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17465,7 +30779,7 @@ bool PlayFab::ClientModels::FLoginWithGoogleAccountRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -17479,7 +30793,7 @@ bool PlayFab::ClientModels::FLoginWithGoogleAccountRequest::readFromValue(const
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PlayerSecretValue = obj->TryGetField(TEXT("PlayerSecret"));
@@ -17506,13 +30820,72 @@ bool PlayFab::ClientModels::FLoginWithGoogleAccountRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginWithGoogleAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("ServerAuthCode"))
+        {
+            reader.ReadValue(ServerAuthCode);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithGoogleAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginWithIOSDeviceIDRequest::~FLoginWithIOSDeviceIDRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FLoginWithIOSDeviceIDRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithIOSDeviceIDRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17582,6 +30955,16 @@ void PlayFab::ClientModels::FLoginWithIOSDeviceIDRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginWithIOSDeviceIDRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithIOSDeviceIDRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginWithIOSDeviceIDRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17598,7 +30981,7 @@ bool PlayFab::ClientModels::FLoginWithIOSDeviceIDRequest::readFromValue(const TS
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -17626,7 +31009,7 @@ bool PlayFab::ClientModels::FLoginWithIOSDeviceIDRequest::readFromValue(const TS
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> OSValue = obj->TryGetField(TEXT("OS"));
@@ -17653,13 +31036,80 @@ bool PlayFab::ClientModels::FLoginWithIOSDeviceIDRequest::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginWithIOSDeviceIDRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("DeviceId"))
+        {
+            reader.ReadValue(DeviceId);
+        }
+        else if (reader.IsField("DeviceModel"))
+        {
+            reader.ReadValue(DeviceModel);
+        }
+        else if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("OS"))
+        {
+            reader.ReadValue(OS);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithIOSDeviceIDRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginWithKongregateRequest::~FLoginWithKongregateRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FLoginWithKongregateRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithKongregateRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17723,6 +31173,16 @@ void PlayFab::ClientModels::FLoginWithKongregateRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginWithKongregateRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithKongregateRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginWithKongregateRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17746,7 +31206,7 @@ bool PlayFab::ClientModels::FLoginWithKongregateRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -17760,7 +31220,7 @@ bool PlayFab::ClientModels::FLoginWithKongregateRequest::readFromValue(const TSh
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> KongregateIdValue = obj->TryGetField(TEXT("KongregateId"));
@@ -17787,13 +31247,76 @@ bool PlayFab::ClientModels::FLoginWithKongregateRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginWithKongregateRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AuthTicket"))
+        {
+            reader.ReadValue(AuthTicket);
+        }
+        else if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("KongregateId"))
+        {
+            reader.ReadValue(KongregateId);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithKongregateRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginWithNintendoServiceAccountRequest::~FLoginWithNintendoServiceAccountRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FLoginWithNintendoServiceAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithNintendoServiceAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17855,6 +31378,16 @@ void PlayFab::ClientModels::FLoginWithNintendoServiceAccountRequest::writeJSON(J
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginWithNintendoServiceAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithNintendoServiceAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginWithNintendoServiceAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17871,7 +31404,7 @@ bool PlayFab::ClientModels::FLoginWithNintendoServiceAccountRequest::readFromVal
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -17892,7 +31425,7 @@ bool PlayFab::ClientModels::FLoginWithNintendoServiceAccountRequest::readFromVal
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PlayerSecretValue = obj->TryGetField(TEXT("PlayerSecret"));
@@ -17912,13 +31445,72 @@ bool PlayFab::ClientModels::FLoginWithNintendoServiceAccountRequest::readFromVal
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginWithNintendoServiceAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("IdentityToken"))
+        {
+            reader.ReadValue(IdentityToken);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithNintendoServiceAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginWithNintendoSwitchDeviceIdRequest::~FLoginWithNintendoSwitchDeviceIdRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FLoginWithNintendoSwitchDeviceIdRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithNintendoSwitchDeviceIdRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17976,6 +31568,16 @@ void PlayFab::ClientModels::FLoginWithNintendoSwitchDeviceIdRequest::writeJSON(J
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginWithNintendoSwitchDeviceIdRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithNintendoSwitchDeviceIdRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginWithNintendoSwitchDeviceIdRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17992,7 +31594,7 @@ bool PlayFab::ClientModels::FLoginWithNintendoSwitchDeviceIdRequest::readFromVal
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -18006,7 +31608,7 @@ bool PlayFab::ClientModels::FLoginWithNintendoSwitchDeviceIdRequest::readFromVal
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> NintendoSwitchDeviceIdValue = obj->TryGetField(TEXT("NintendoSwitchDeviceId"));
@@ -18033,13 +31635,72 @@ bool PlayFab::ClientModels::FLoginWithNintendoSwitchDeviceIdRequest::readFromVal
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginWithNintendoSwitchDeviceIdRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("NintendoSwitchDeviceId"))
+        {
+            reader.ReadValue(NintendoSwitchDeviceId);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithNintendoSwitchDeviceIdRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginWithOpenIdConnectRequest::~FLoginWithOpenIdConnectRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FLoginWithOpenIdConnectRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithOpenIdConnectRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18111,6 +31772,16 @@ void PlayFab::ClientModels::FLoginWithOpenIdConnectRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginWithOpenIdConnectRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithOpenIdConnectRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginWithOpenIdConnectRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18134,7 +31805,7 @@ bool PlayFab::ClientModels::FLoginWithOpenIdConnectRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -18155,7 +31826,7 @@ bool PlayFab::ClientModels::FLoginWithOpenIdConnectRequest::readFromValue(const
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PlayerSecretValue = obj->TryGetField(TEXT("PlayerSecret"));
@@ -18175,13 +31846,76 @@ bool PlayFab::ClientModels::FLoginWithOpenIdConnectRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginWithOpenIdConnectRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ConnectionId"))
+        {
+            reader.ReadValue(ConnectionId);
+        }
+        else if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("IdToken"))
+        {
+            reader.ReadValue(IdToken);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithOpenIdConnectRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginWithPlayFabRequest::~FLoginWithPlayFabRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FLoginWithPlayFabRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithPlayFabRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18235,23 +31969,33 @@ void PlayFab::ClientModels::FLoginWithPlayFabRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
-bool PlayFab::ClientModels::FLoginWithPlayFabRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
+void PlayFab::ClientModels::FLoginWithPlayFabRequest::writeJSON(JsonWriter& writer) const
 {
-    bool HasSucceeded = true;
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithPlayFabRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
+bool PlayFab::ClientModels::FLoginWithPlayFabRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
+{
+    bool HasSucceeded = true;
 
     const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PasswordValue = obj->TryGetField(TEXT("Password"));
@@ -18278,13 +32022,64 @@ bool PlayFab::ClientModels::FLoginWithPlayFabRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginWithPlayFabRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("Password"))
+        {
+            reader.ReadValue(Password);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithPlayFabRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginWithPSNRequest::~FLoginWithPSNRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FLoginWithPSNRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithPSNRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18354,6 +32149,16 @@ void PlayFab::ClientModels::FLoginWithPSNRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginWithPSNRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithPSNRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginWithPSNRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18377,7 +32182,7 @@ bool PlayFab::ClientModels::FLoginWithPSNRequest::readFromValue(const TSharedPtr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -18391,7 +32196,7 @@ bool PlayFab::ClientModels::FLoginWithPSNRequest::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> IssuerIdValue = obj->TryGetField(TEXT("IssuerId"));
@@ -18425,13 +32230,80 @@ bool PlayFab::ClientModels::FLoginWithPSNRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginWithPSNRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AuthCode"))
+        {
+            reader.ReadValue(AuthCode);
+        }
+        else if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("IssuerId"))
+        {
+            reader.ReadValue(IssuerId);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("RedirectUri"))
+        {
+            reader.ReadValue(RedirectUri);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithPSNRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginWithSteamRequest::~FLoginWithSteamRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FLoginWithSteamRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithSteamRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18489,6 +32361,16 @@ void PlayFab::ClientModels::FLoginWithSteamRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginWithSteamRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithSteamRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginWithSteamRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18505,7 +32387,7 @@ bool PlayFab::ClientModels::FLoginWithSteamRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -18519,7 +32401,7 @@ bool PlayFab::ClientModels::FLoginWithSteamRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PlayerSecretValue = obj->TryGetField(TEXT("PlayerSecret"));
@@ -18546,13 +32428,72 @@ bool PlayFab::ClientModels::FLoginWithSteamRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginWithSteamRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("SteamTicket"))
+        {
+            reader.ReadValue(SteamTicket);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithSteamRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginWithTwitchRequest::~FLoginWithTwitchRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FLoginWithTwitchRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithTwitchRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18610,6 +32551,16 @@ void PlayFab::ClientModels::FLoginWithTwitchRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginWithTwitchRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithTwitchRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginWithTwitchRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18633,7 +32584,7 @@ bool PlayFab::ClientModels::FLoginWithTwitchRequest::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -18647,7 +32598,7 @@ bool PlayFab::ClientModels::FLoginWithTwitchRequest::readFromValue(const TShared
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PlayerSecretValue = obj->TryGetField(TEXT("PlayerSecret"));
@@ -18667,13 +32618,72 @@ bool PlayFab::ClientModels::FLoginWithTwitchRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginWithTwitchRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AccessToken"))
+        {
+            reader.ReadValue(AccessToken);
+        }
+        else if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithTwitchRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginWithWindowsHelloRequest::~FLoginWithWindowsHelloRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FLoginWithWindowsHelloRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithWindowsHelloRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18727,6 +32737,16 @@ void PlayFab::ClientModels::FLoginWithWindowsHelloRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginWithWindowsHelloRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithWindowsHelloRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginWithWindowsHelloRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18743,14 +32763,14 @@ bool PlayFab::ClientModels::FLoginWithWindowsHelloRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PublicKeyHintValue = obj->TryGetField(TEXT("PublicKeyHint"));
@@ -18770,13 +32790,64 @@ bool PlayFab::ClientModels::FLoginWithWindowsHelloRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginWithWindowsHelloRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ChallengeSignature"))
+        {
+            reader.ReadValue(ChallengeSignature);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("PublicKeyHint"))
+        {
+            reader.ReadValue(PublicKeyHint);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithWindowsHelloRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FLoginWithXboxRequest::~FLoginWithXboxRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FLoginWithXboxRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FLoginWithXboxRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18834,6 +32905,16 @@ void PlayFab::ClientModels::FLoginWithXboxRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FLoginWithXboxRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FLoginWithXboxRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FLoginWithXboxRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18850,7 +32931,7 @@ bool PlayFab::ClientModels::FLoginWithXboxRequest::readFromValue(const TSharedPt
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -18864,7 +32945,7 @@ bool PlayFab::ClientModels::FLoginWithXboxRequest::readFromValue(const TSharedPt
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PlayerSecretValue = obj->TryGetField(TEXT("PlayerSecret"));
@@ -18891,13 +32972,72 @@ bool PlayFab::ClientModels::FLoginWithXboxRequest::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FLoginWithXboxRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else if (reader.IsField("XboxToken"))
+        {
+            reader.ReadValue(XboxToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithXboxRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FMatchmakeRequest::~FMatchmakeRequest()
 {
     //if (TagFilter != nullptr) delete TagFilter;
 
 }
 
-void PlayFab::ClientModels::FMatchmakeRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FMatchmakeRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18963,6 +33103,16 @@ void PlayFab::ClientModels::FMatchmakeRequest::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FMatchmakeRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FMatchmakeRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FMatchmakeRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18986,7 +33136,7 @@ bool PlayFab::ClientModels::FMatchmakeRequest::readFromValue(const TSharedPtr<FJ
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -19023,13 +33173,81 @@ bool PlayFab::ClientModels::FMatchmakeRequest::readFromValue(const TSharedPtr<FJ
     const TSharedPtr<FJsonValue> TagFilterValue = obj->TryGetField(TEXT("TagFilter"));
     if (TagFilterValue.IsValid() && !TagFilterValue->IsNull())
     {
-        TagFilter = MakeShareable(new FCollectionFilter(TagFilterValue->AsObject()));
+        TagFilter = MakeShared<FCollectionFilter>(TagFilterValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
-void PlayFab::ClientModels::writeMatchmakeStatusEnumJSON(MatchmakeStatus enumVal, JsonWriter& writer)
+bool PlayFab::ClientModels::FMatchmakeRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildVersion"))
+        {
+            reader.ReadValue(BuildVersion);
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("GameMode"))
+        {
+            reader.ReadValue(GameMode);
+        }
+        else if (reader.IsField("LobbyId"))
+        {
+            reader.ReadValue(LobbyId);
+        }
+        else if (reader.IsField("Region"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfRegion = readRegionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("StartNewIfNoneFound"))
+        {
+            reader.ReadValue(StartNewIfNoneFound);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("TagFilter"))
+        {
+            TagFilter = MakeShared<FCollectionFilter>();
+            TagFilter->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FMatchmakeRequest();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeMatchmakeStatusEnumValue(ClientModels::MatchmakeStatus enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -19042,6 +33260,16 @@ void PlayFab::ClientModels::writeMatchmakeStatusEnumJSON(MatchmakeStatus enumVal
     }
 }
 
+void PlayFab::ClientModels::writeMatchmakeStatusEnumJSON(MatchmakeStatus enumVal, JsonWriter& writer)
+{
+    writeMatchmakeStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::ClientModels::writeMatchmakeStatusEnumJSON(MatchmakeStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeMatchmakeStatusEnumValue(enumVal, writer);
+}
+
 ClientModels::MatchmakeStatus PlayFab::ClientModels::readMatchmakeStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readMatchmakeStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -19076,7 +33304,8 @@ PlayFab::ClientModels::FMatchmakeResult::~FMatchmakeResult()
 
 }
 
-void PlayFab::ClientModels::FMatchmakeResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FMatchmakeResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19137,6 +33366,16 @@ void PlayFab::ClientModels::FMatchmakeResult::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FMatchmakeResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FMatchmakeResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FMatchmakeResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19202,25 +33441,85 @@ bool PlayFab::ClientModels::FMatchmakeResult::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FModifyUserVirtualCurrencyResult::~FModifyUserVirtualCurrencyResult()
-{
-
-}
-
-void PlayFab::ClientModels::FModifyUserVirtualCurrencyResult::writeJSON(JsonWriter& writer) const
+bool PlayFab::ClientModels::FMatchmakeResult::readFromReader(FPlayFabJsonPullReader& reader)
 {
-    writer->WriteObjectStart();
-
-    writer->WriteIdentifierPrefix(TEXT("Balance"));
-    writer->WriteValue(Balance);
-
-    writer->WriteIdentifierPrefix(TEXT("BalanceChange"));
-    writer->WriteValue(BalanceChange);
+    if (!reader.ReadObjectStart())
+        return false;
 
-    if (PlayFabId.IsEmpty() == false)
+    while (reader.NextField())
     {
-        writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
-        writer->WriteValue(PlayFabId);
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Expires"))
+        {
+            reader.ReadValue(Expires);
+        }
+        else if (reader.IsField("LobbyID"))
+        {
+            reader.ReadValue(LobbyID);
+        }
+        else if (reader.IsField("PollWaitTimeMS"))
+        {
+            reader.ReadValue(PollWaitTimeMS);
+        }
+        else if (reader.IsField("ServerIPV4Address"))
+        {
+            reader.ReadValue(ServerIPV4Address);
+        }
+        else if (reader.IsField("ServerIPV6Address"))
+        {
+            reader.ReadValue(ServerIPV6Address);
+        }
+        else if (reader.IsField("ServerPort"))
+        {
+            reader.ReadValue(ServerPort);
+        }
+        else if (reader.IsField("ServerPublicDNSName"))
+        {
+            reader.ReadValue(ServerPublicDNSName);
+        }
+        else if (reader.IsField("Status"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Status = readMatchmakeStatusFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Ticket"))
+        {
+            reader.ReadValue(Ticket);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FMatchmakeResult();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FModifyUserVirtualCurrencyResult::~FModifyUserVirtualCurrencyResult()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FModifyUserVirtualCurrencyResult::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
+
+    writer->WriteIdentifierPrefix(TEXT("Balance"));
+    writer->WriteValue(Balance);
+
+    writer->WriteIdentifierPrefix(TEXT("BalanceChange"));
+    writer->WriteValue(BalanceChange);
+
+    if (PlayFabId.IsEmpty() == false)
+    {
+        writer->WriteIdentifierPrefix(TEXT("PlayFabId"));
+        writer->WriteValue(PlayFabId);
     }
 
     if (VirtualCurrency.IsEmpty() == false)
@@ -19232,6 +33531,16 @@ void PlayFab::ClientModels::FModifyUserVirtualCurrencyResult::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FModifyUserVirtualCurrencyResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FModifyUserVirtualCurrencyResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FModifyUserVirtualCurrencyResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19267,12 +33576,51 @@ bool PlayFab::ClientModels::FModifyUserVirtualCurrencyResult::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FModifyUserVirtualCurrencyResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Balance"))
+        {
+            reader.ReadValue(Balance);
+        }
+        else if (reader.IsField("BalanceChange"))
+        {
+            reader.ReadValue(BalanceChange);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            reader.ReadValue(VirtualCurrency);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FModifyUserVirtualCurrencyResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FOpenTradeRequest::~FOpenTradeRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FOpenTradeRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FOpenTradeRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19306,6 +33654,16 @@ void PlayFab::ClientModels::FOpenTradeRequest::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FOpenTradeRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FOpenTradeRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FOpenTradeRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19319,13 +33677,69 @@ bool PlayFab::ClientModels::FOpenTradeRequest::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FOpenTradeRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AllowedPlayerIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { AllowedPlayerIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("OfferedInventoryInstanceIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { OfferedInventoryInstanceIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("RequestedCatalogItemIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { RequestedCatalogItemIds.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FOpenTradeRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FOpenTradeResponse::~FOpenTradeResponse()
 {
     //if (Trade != nullptr) delete Trade;
 
 }
 
-void PlayFab::ClientModels::FOpenTradeResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FOpenTradeResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19338,6 +33752,16 @@ void PlayFab::ClientModels::FOpenTradeResponse::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FOpenTradeResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FOpenTradeResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FOpenTradeResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19345,18 +33769,46 @@ bool PlayFab::ClientModels::FOpenTradeResponse::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonValue> TradeValue = obj->TryGetField(TEXT("Trade"));
     if (TradeValue.IsValid() && !TradeValue->IsNull())
     {
-        Trade = MakeShareable(new FTradeInfo(TradeValue->AsObject()));
+        Trade = MakeShared<FTradeInfo>(TradeValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FOpenTradeResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Trade"))
+        {
+            Trade = MakeShared<FTradeInfo>();
+            Trade->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FOpenTradeResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FPayForPurchaseRequest::~FPayForPurchaseRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FPayForPurchaseRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FPayForPurchaseRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19410,6 +33862,16 @@ void PlayFab::ClientModels::FPayForPurchaseRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FPayForPurchaseRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FPayForPurchaseRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FPayForPurchaseRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19426,7 +33888,7 @@ bool PlayFab::ClientModels::FPayForPurchaseRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -19454,7 +33916,57 @@ bool PlayFab::ClientModels::FPayForPurchaseRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
-void PlayFab::ClientModels::writeTransactionStatusEnumJSON(TransactionStatus enumVal, JsonWriter& writer)
+bool PlayFab::ClientModels::FPayForPurchaseRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Currency"))
+        {
+            reader.ReadValue(Currency);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("OrderId"))
+        {
+            reader.ReadValue(OrderId);
+        }
+        else if (reader.IsField("ProviderName"))
+        {
+            reader.ReadValue(ProviderName);
+        }
+        else if (reader.IsField("ProviderTransactionId"))
+        {
+            reader.ReadValue(ProviderTransactionId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPayForPurchaseRequest();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeTransactionStatusEnumValue(ClientModels::TransactionStatus enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -19482,6 +33994,16 @@ void PlayFab::ClientModels::writeTransactionStatusEnumJSON(TransactionStatus enu
     }
 }
 
+void PlayFab::ClientModels::writeTransactionStatusEnumJSON(TransactionStatus enumVal, JsonWriter& writer)
+{
+    writeTransactionStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::ClientModels::writeTransactionStatusEnumJSON(TransactionStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeTransactionStatusEnumValue(enumVal, writer);
+}
+
 ClientModels::TransactionStatus PlayFab::ClientModels::readTransactionStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readTransactionStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -19531,7 +34053,8 @@ PlayFab::ClientModels::FPayForPurchaseResult::~FPayForPurchaseResult()
 
 }
 
-void PlayFab::ClientModels::FPayForPurchaseResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FPayForPurchaseResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19602,6 +34125,16 @@ void PlayFab::ClientModels::FPayForPurchaseResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FPayForPurchaseResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FPayForPurchaseResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FPayForPurchaseResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19663,7 +34196,7 @@ bool PlayFab::ClientModels::FPayForPurchaseResult::readFromValue(const TSharedPt
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VCAmountObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VCAmount.Add(It.Key(), TmpValue);
+            VCAmount.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -19673,19 +34206,97 @@ bool PlayFab::ClientModels::FPayForPurchaseResult::readFromValue(const TSharedPt
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrency.Add(It.Key(), TmpValue);
+            VirtualCurrency.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FPayForPurchaseResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CreditApplied"))
+        {
+            reader.ReadValue(CreditApplied);
+        }
+        else if (reader.IsField("OrderId"))
+        {
+            reader.ReadValue(OrderId);
+        }
+        else if (reader.IsField("ProviderData"))
+        {
+            reader.ReadValue(ProviderData);
+        }
+        else if (reader.IsField("ProviderToken"))
+        {
+            reader.ReadValue(ProviderToken);
+        }
+        else if (reader.IsField("PurchaseConfirmationPageURL"))
+        {
+            reader.ReadValue(PurchaseConfirmationPageURL);
+        }
+        else if (reader.IsField("PurchaseCurrency"))
+        {
+            reader.ReadValue(PurchaseCurrency);
+        }
+        else if (reader.IsField("PurchasePrice"))
+        {
+            reader.ReadValue(PurchasePrice);
+        }
+        else if (reader.IsField("Status"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Status = readTransactionStatusFromValue(TmpValue); }
+        }
+        else if (reader.IsField("VCAmount"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VCAmount.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrency.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPayForPurchaseResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FPaymentOption::~FPaymentOption()
 {
 
 }
 
-void PlayFab::ClientModels::FPaymentOption::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FPaymentOption::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19710,6 +34321,16 @@ void PlayFab::ClientModels::FPaymentOption::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FPaymentOption::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FPaymentOption::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FPaymentOption::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19745,12 +34366,51 @@ bool PlayFab::ClientModels::FPaymentOption::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FPaymentOption::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Currency"))
+        {
+            reader.ReadValue(Currency);
+        }
+        else if (reader.IsField("Price"))
+        {
+            reader.ReadValue(Price);
+        }
+        else if (reader.IsField("ProviderName"))
+        {
+            reader.ReadValue(ProviderName);
+        }
+        else if (reader.IsField("StoreCredit"))
+        {
+            reader.ReadValue(StoreCredit);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPaymentOption();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FPurchaseItemRequest::~FPurchaseItemRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FPurchaseItemRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FPurchaseItemRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19809,6 +34469,16 @@ void PlayFab::ClientModels::FPurchaseItemRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FPurchaseItemRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FPurchaseItemRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FPurchaseItemRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19832,7 +34502,7 @@ bool PlayFab::ClientModels::FPurchaseItemRequest::readFromValue(const TSharedPtr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -19867,12 +34537,70 @@ bool PlayFab::ClientModels::FPurchaseItemRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FPurchaseItemRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else if (reader.IsField("Price"))
+        {
+            reader.ReadValue(Price);
+        }
+        else if (reader.IsField("StoreId"))
+        {
+            reader.ReadValue(StoreId);
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            reader.ReadValue(VirtualCurrency);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPurchaseItemRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FPurchaseItemResult::~FPurchaseItemResult()
 {
 
 }
 
-void PlayFab::ClientModels::FPurchaseItemResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FPurchaseItemResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19888,6 +34616,16 @@ void PlayFab::ClientModels::FPurchaseItemResult::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FPurchaseItemResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FPurchaseItemResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FPurchaseItemResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19896,19 +34634,53 @@ bool PlayFab::ClientModels::FPurchaseItemResult::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FItemInstance(CurrentItem->AsObject()));
+        Items.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FPurchaseReceiptFulfillment::~FPurchaseReceiptFulfillment()
+bool PlayFab::ClientModels::FPurchaseItemResult::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::ClientModels::FPurchaseReceiptFulfillment::writeJSON(JsonWriter& writer) const
+        if (reader.IsField("Items"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Items[Items.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPurchaseItemResult();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FPurchaseReceiptFulfillment::~FPurchaseReceiptFulfillment()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FPurchaseReceiptFulfillment::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19942,6 +34714,16 @@ void PlayFab::ClientModels::FPurchaseReceiptFulfillment::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FPurchaseReceiptFulfillment::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FPurchaseReceiptFulfillment::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FPurchaseReceiptFulfillment::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19950,7 +34732,7 @@ bool PlayFab::ClientModels::FPurchaseReceiptFulfillment::readFromValue(const TSh
     for (int32 Idx = 0; Idx < FulfilledItemsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = FulfilledItemsArray[Idx];
-        FulfilledItems.Add(FItemInstance(CurrentItem->AsObject()));
+        FulfilledItems.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -19978,12 +34760,58 @@ bool PlayFab::ClientModels::FPurchaseReceiptFulfillment::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FPurchaseReceiptFulfillment::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FulfilledItems"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { FulfilledItems[FulfilledItems.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("RecordedPriceSource"))
+        {
+            reader.ReadValue(RecordedPriceSource);
+        }
+        else if (reader.IsField("RecordedTransactionCurrency"))
+        {
+            reader.ReadValue(RecordedTransactionCurrency);
+        }
+        else if (reader.IsField("RecordedTransactionTotal"))
+        {
+            reader.ReadValue(RecordedTransactionTotal);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPurchaseReceiptFulfillment();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRedeemCouponRequest::~FRedeemCouponRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FRedeemCouponRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRedeemCouponRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20023,6 +34851,16 @@ void PlayFab::ClientModels::FRedeemCouponRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRedeemCouponRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRedeemCouponRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRedeemCouponRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20053,19 +34891,65 @@ bool PlayFab::ClientModels::FRedeemCouponRequest::readFromValue(const TSharedPtr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRedeemCouponRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CouponCode"))
+        {
+            reader.ReadValue(CouponCode);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRedeemCouponRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRedeemCouponResult::~FRedeemCouponResult()
 {
 
 }
 
-void PlayFab::ClientModels::FRedeemCouponResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRedeemCouponResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20081,6 +34965,16 @@ void PlayFab::ClientModels::FRedeemCouponResult::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRedeemCouponResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRedeemCouponResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRedeemCouponResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20089,19 +34983,53 @@ bool PlayFab::ClientModels::FRedeemCouponResult::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < GrantedItemsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GrantedItemsArray[Idx];
-        GrantedItems.Add(FItemInstance(CurrentItem->AsObject()));
+        GrantedItems.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRedeemCouponResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GrantedItems"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GrantedItems[GrantedItems.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRedeemCouponResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRefreshPSNAuthTokenRequest::~FRefreshPSNAuthTokenRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FRefreshPSNAuthTokenRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRefreshPSNAuthTokenRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20134,6 +35062,16 @@ void PlayFab::ClientModels::FRefreshPSNAuthTokenRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRefreshPSNAuthTokenRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRefreshPSNAuthTokenRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRefreshPSNAuthTokenRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20162,12 +35100,47 @@ bool PlayFab::ClientModels::FRefreshPSNAuthTokenRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRefreshPSNAuthTokenRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AuthCode"))
+        {
+            reader.ReadValue(AuthCode);
+        }
+        else if (reader.IsField("IssuerId"))
+        {
+            reader.ReadValue(IssuerId);
+        }
+        else if (reader.IsField("RedirectUri"))
+        {
+            reader.ReadValue(RedirectUri);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRefreshPSNAuthTokenRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRegisterForIOSPushNotificationRequest::~FRegisterForIOSPushNotificationRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FRegisterForIOSPushNotificationRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRegisterForIOSPushNotificationRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20196,6 +35169,16 @@ void PlayFab::ClientModels::FRegisterForIOSPushNotificationRequest::writeJSON(Js
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRegisterForIOSPushNotificationRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRegisterForIOSPushNotificationRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRegisterForIOSPushNotificationRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20224,18 +35207,63 @@ bool PlayFab::ClientModels::FRegisterForIOSPushNotificationRequest::readFromValu
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRegisterForIOSPushNotificationRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ConfirmationMessage"))
+        {
+            reader.ReadValue(ConfirmationMessage);
+        }
+        else if (reader.IsField("DeviceToken"))
+        {
+            reader.ReadValue(DeviceToken);
+        }
+        else if (reader.IsField("SendPushNotificationConfirmation"))
+        {
+            reader.ReadValue(SendPushNotificationConfirmation);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRegisterForIOSPushNotificationRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRegisterForIOSPushNotificationResult::~FRegisterForIOSPushNotificationResult()
 {
 
 }
 
-void PlayFab::ClientModels::FRegisterForIOSPushNotificationResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRegisterForIOSPushNotificationResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRegisterForIOSPushNotificationResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRegisterForIOSPushNotificationResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRegisterForIOSPushNotificationResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20243,13 +35271,35 @@ bool PlayFab::ClientModels::FRegisterForIOSPushNotificationResult::readFromValue
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRegisterForIOSPushNotificationResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRegisterForIOSPushNotificationResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRegisterPlayFabUserRequest::~FRegisterPlayFabUserRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FRegisterPlayFabUserRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRegisterPlayFabUserRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20325,6 +35375,16 @@ void PlayFab::ClientModels::FRegisterPlayFabUserRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRegisterPlayFabUserRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRegisterPlayFabUserRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRegisterPlayFabUserRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20334,7 +35394,7 @@ bool PlayFab::ClientModels::FRegisterPlayFabUserRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -20362,7 +35422,7 @@ bool PlayFab::ClientModels::FRegisterPlayFabUserRequest::readFromValue(const TSh
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PasswordValue = obj->TryGetField(TEXT("Password"));
@@ -20403,6 +35463,76 @@ bool PlayFab::ClientModels::FRegisterPlayFabUserRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRegisterPlayFabUserRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("Email"))
+        {
+            reader.ReadValue(Email);
+        }
+        else if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("Password"))
+        {
+            reader.ReadValue(Password);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("RequireBothUsernameAndEmail"))
+        {
+            reader.ReadValue(RequireBothUsernameAndEmail);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRegisterPlayFabUserRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRegisterPlayFabUserResult::~FRegisterPlayFabUserResult()
 {
     //if (EntityToken != nullptr) delete EntityToken;
@@ -20410,7 +35540,8 @@ PlayFab::ClientModels::FRegisterPlayFabUserResult::~FRegisterPlayFabUserResult()
 
 }
 
-void PlayFab::ClientModels::FRegisterPlayFabUserResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRegisterPlayFabUserResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20447,6 +35578,16 @@ void PlayFab::ClientModels::FRegisterPlayFabUserResult::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRegisterPlayFabUserResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRegisterPlayFabUserResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRegisterPlayFabUserResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20454,7 +35595,7 @@ bool PlayFab::ClientModels::FRegisterPlayFabUserResult::readFromValue(const TSha
     const TSharedPtr<FJsonValue> EntityTokenValue = obj->TryGetField(TEXT("EntityToken"));
     if (EntityTokenValue.IsValid() && !EntityTokenValue->IsNull())
     {
-        EntityToken = MakeShareable(new FEntityTokenResponse(EntityTokenValue->AsObject()));
+        EntityToken = MakeShared<FEntityTokenResponse>(EntityTokenValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PlayFabIdValue = obj->TryGetField(TEXT("PlayFabId"));
@@ -20474,7 +35615,7 @@ bool PlayFab::ClientModels::FRegisterPlayFabUserResult::readFromValue(const TSha
     const TSharedPtr<FJsonValue> SettingsForUserValue = obj->TryGetField(TEXT("SettingsForUser"));
     if (SettingsForUserValue.IsValid() && !SettingsForUserValue->IsNull())
     {
-        SettingsForUser = MakeShareable(new FUserSettings(SettingsForUserValue->AsObject()));
+        SettingsForUser = MakeShared<FUserSettings>(SettingsForUserValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> UsernameValue = obj->TryGetField(TEXT("Username"));
@@ -20487,13 +35628,58 @@ bool PlayFab::ClientModels::FRegisterPlayFabUserResult::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRegisterPlayFabUserResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("EntityToken"))
+        {
+            EntityToken = MakeShared<FEntityTokenResponse>();
+            EntityToken->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("SessionTicket"))
+        {
+            reader.ReadValue(SessionTicket);
+        }
+        else if (reader.IsField("SettingsForUser"))
+        {
+            SettingsForUser = MakeShared<FUserSettings>();
+            SettingsForUser->readFromReader(reader);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRegisterPlayFabUserResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRegisterWithWindowsHelloRequest::~FRegisterWithWindowsHelloRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ClientModels::FRegisterWithWindowsHelloRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRegisterWithWindowsHelloRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20557,6 +35743,16 @@ void PlayFab::ClientModels::FRegisterWithWindowsHelloRequest::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRegisterWithWindowsHelloRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRegisterWithWindowsHelloRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRegisterWithWindowsHelloRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20566,7 +35762,7 @@ bool PlayFab::ClientModels::FRegisterWithWindowsHelloRequest::readFromValue(cons
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -20587,7 +35783,7 @@ bool PlayFab::ClientModels::FRegisterWithWindowsHelloRequest::readFromValue(cons
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PlayerSecretValue = obj->TryGetField(TEXT("PlayerSecret"));
@@ -20621,12 +35817,75 @@ bool PlayFab::ClientModels::FRegisterWithWindowsHelloRequest::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRegisterWithWindowsHelloRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("DeviceName"))
+        {
+            reader.ReadValue(DeviceName);
+        }
+        else if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("PublicKey"))
+        {
+            reader.ReadValue(PublicKey);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else if (reader.IsField("UserName"))
+        {
+            reader.ReadValue(UserName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRegisterWithWindowsHelloRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRemoveContactEmailRequest::~FRemoveContactEmailRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FRemoveContactEmailRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRemoveContactEmailRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20644,34 +35903,88 @@ void PlayFab::ClientModels::FRemoveContactEmailRequest::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
-bool PlayFab::ClientModels::FRemoveContactEmailRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
+void PlayFab::ClientModels::FRemoveContactEmailRequest::writeJSON(JsonWriter& writer) const
 {
-    bool HasSucceeded = true;
+    writeJSONObject(writer);
+}
 
-    const TSharedPtr<FJsonObject>* CustomTagsObject;
+void PlayFab::ClientModels::FRemoveContactEmailRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
+bool PlayFab::ClientModels::FRemoveContactEmailRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
+{
+    bool HasSucceeded = true;
+
+    const TSharedPtr<FJsonObject>* CustomTagsObject;
     if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRemoveContactEmailRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemoveContactEmailRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRemoveContactEmailResult::~FRemoveContactEmailResult()
 {
 
 }
 
-void PlayFab::ClientModels::FRemoveContactEmailResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRemoveContactEmailResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRemoveContactEmailResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRemoveContactEmailResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRemoveContactEmailResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20679,12 +35992,34 @@ bool PlayFab::ClientModels::FRemoveContactEmailResult::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRemoveContactEmailResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemoveContactEmailResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRemoveFriendRequest::~FRemoveFriendRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FRemoveFriendRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRemoveFriendRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20701,6 +36036,16 @@ void PlayFab::ClientModels::FRemoveFriendRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRemoveFriendRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRemoveFriendRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRemoveFriendRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20715,18 +36060,55 @@ bool PlayFab::ClientModels::FRemoveFriendRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRemoveFriendRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FriendPlayFabId"))
+        {
+            reader.ReadValue(FriendPlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemoveFriendRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRemoveFriendResult::~FRemoveFriendResult()
 {
 
 }
 
-void PlayFab::ClientModels::FRemoveFriendResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRemoveFriendResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRemoveFriendResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRemoveFriendResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRemoveFriendResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20734,12 +36116,34 @@ bool PlayFab::ClientModels::FRemoveFriendResult::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRemoveFriendResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemoveFriendResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRemoveGenericIDRequest::~FRemoveGenericIDRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FRemoveGenericIDRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRemoveGenericIDRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20749,6 +36153,16 @@ void PlayFab::ClientModels::FRemoveGenericIDRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRemoveGenericIDRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRemoveGenericIDRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRemoveGenericIDRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20762,18 +36176,55 @@ bool PlayFab::ClientModels::FRemoveGenericIDRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRemoveGenericIDRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GenericId"))
+        {
+            GenericId.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemoveGenericIDRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRemoveGenericIDResult::~FRemoveGenericIDResult()
 {
 
 }
 
-void PlayFab::ClientModels::FRemoveGenericIDResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRemoveGenericIDResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRemoveGenericIDResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRemoveGenericIDResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRemoveGenericIDResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20781,12 +36232,34 @@ bool PlayFab::ClientModels::FRemoveGenericIDResult::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRemoveGenericIDResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemoveGenericIDResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRemoveSharedGroupMembersRequest::~FRemoveSharedGroupMembersRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FRemoveSharedGroupMembersRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRemoveSharedGroupMembersRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20809,6 +36282,16 @@ void PlayFab::ClientModels::FRemoveSharedGroupMembersRequest::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRemoveSharedGroupMembersRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRemoveSharedGroupMembersRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRemoveSharedGroupMembersRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20825,18 +36308,66 @@ bool PlayFab::ClientModels::FRemoveSharedGroupMembersRequest::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRemoveSharedGroupMembersRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { PlayFabIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("SharedGroupId"))
+        {
+            reader.ReadValue(SharedGroupId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemoveSharedGroupMembersRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRemoveSharedGroupMembersResult::~FRemoveSharedGroupMembersResult()
 {
 
 }
 
-void PlayFab::ClientModels::FRemoveSharedGroupMembersResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRemoveSharedGroupMembersResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRemoveSharedGroupMembersResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRemoveSharedGroupMembersResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRemoveSharedGroupMembersResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20844,12 +36375,34 @@ bool PlayFab::ClientModels::FRemoveSharedGroupMembersResult::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRemoveSharedGroupMembersResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemoveSharedGroupMembersResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FReportAdActivityRequest::~FReportAdActivityRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FReportAdActivityRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FReportAdActivityRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20890,6 +36443,16 @@ void PlayFab::ClientModels::FReportAdActivityRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FReportAdActivityRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FReportAdActivityRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FReportAdActivityRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20901,7 +36464,7 @@ bool PlayFab::ClientModels::FReportAdActivityRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -20922,18 +36485,75 @@ bool PlayFab::ClientModels::FReportAdActivityRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FReportAdActivityRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Activity"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Activity = readAdActivityFromValue(TmpValue); }
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlacementId"))
+        {
+            reader.ReadValue(PlacementId);
+        }
+        else if (reader.IsField("RewardId"))
+        {
+            reader.ReadValue(RewardId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FReportAdActivityRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FReportAdActivityResult::~FReportAdActivityResult()
 {
 
 }
 
-void PlayFab::ClientModels::FReportAdActivityResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FReportAdActivityResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FReportAdActivityResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FReportAdActivityResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FReportAdActivityResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20941,12 +36561,34 @@ bool PlayFab::ClientModels::FReportAdActivityResult::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FReportAdActivityResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FReportAdActivityResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FReportPlayerClientRequest::~FReportPlayerClientRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FReportPlayerClientRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FReportPlayerClientRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20980,6 +36622,16 @@ void PlayFab::ClientModels::FReportPlayerClientRequest::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FReportPlayerClientRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FReportPlayerClientRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FReportPlayerClientRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20996,7 +36648,7 @@ bool PlayFab::ClientModels::FReportPlayerClientRequest::readFromValue(const TSha
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -21010,12 +36662,54 @@ bool PlayFab::ClientModels::FReportPlayerClientRequest::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FReportPlayerClientRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Comment"))
+        {
+            reader.ReadValue(Comment);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ReporteeId"))
+        {
+            reader.ReadValue(ReporteeId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FReportPlayerClientRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FReportPlayerClientResult::~FReportPlayerClientResult()
 {
 
 }
 
-void PlayFab::ClientModels::FReportPlayerClientResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FReportPlayerClientResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -21025,6 +36719,16 @@ void PlayFab::ClientModels::FReportPlayerClientResult::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FReportPlayerClientResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FReportPlayerClientResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FReportPlayerClientResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -21039,12 +36743,39 @@ bool PlayFab::ClientModels::FReportPlayerClientResult::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FReportPlayerClientResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SubmissionsRemaining"))
+        {
+            reader.ReadValue(SubmissionsRemaining);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FReportPlayerClientResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRestoreIOSPurchasesRequest::~FRestoreIOSPurchasesRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FRestoreIOSPurchasesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRestoreIOSPurchasesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -21078,6 +36809,16 @@ void PlayFab::ClientModels::FRestoreIOSPurchasesRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRestoreIOSPurchasesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRestoreIOSPurchasesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRestoreIOSPurchasesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -21094,7 +36835,7 @@ bool PlayFab::ClientModels::FRestoreIOSPurchasesRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -21108,14 +36849,56 @@ bool PlayFab::ClientModels::FRestoreIOSPurchasesRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
-PlayFab::ClientModels::FRestoreIOSPurchasesResult::~FRestoreIOSPurchasesResult()
+bool PlayFab::ClientModels::FRestoreIOSPurchasesRequest::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::ClientModels::FRestoreIOSPurchasesResult::writeJSON(JsonWriter& writer) const
-{
-    writer->WriteObjectStart();
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ReceiptData"))
+        {
+            reader.ReadValue(ReceiptData);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRestoreIOSPurchasesRequest();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ClientModels::FRestoreIOSPurchasesResult::~FRestoreIOSPurchasesResult()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ClientModels::FRestoreIOSPurchasesResult::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
 
     if (Fulfillments.Num() != 0)
     {
@@ -21129,6 +36912,16 @@ void PlayFab::ClientModels::FRestoreIOSPurchasesResult::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRestoreIOSPurchasesResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRestoreIOSPurchasesResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRestoreIOSPurchasesResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -21137,19 +36930,53 @@ bool PlayFab::ClientModels::FRestoreIOSPurchasesResult::readFromValue(const TSha
     for (int32 Idx = 0; Idx < FulfillmentsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = FulfillmentsArray[Idx];
-        Fulfillments.Add(FPurchaseReceiptFulfillment(CurrentItem->AsObject()));
+        Fulfillments.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRestoreIOSPurchasesResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Fulfillments"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Fulfillments[Fulfillments.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRestoreIOSPurchasesResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRewardAdActivityRequest::~FRewardAdActivityRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FRewardAdActivityRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRewardAdActivityRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -21187,6 +37014,16 @@ void PlayFab::ClientModels::FRewardAdActivityRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRewardAdActivityRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRewardAdActivityRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRewardAdActivityRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -21196,7 +37033,7 @@ bool PlayFab::ClientModels::FRewardAdActivityRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -21217,13 +37054,55 @@ bool PlayFab::ClientModels::FRewardAdActivityRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRewardAdActivityRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlacementId"))
+        {
+            reader.ReadValue(PlacementId);
+        }
+        else if (reader.IsField("RewardId"))
+        {
+            reader.ReadValue(RewardId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRewardAdActivityRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FRewardAdActivityResult::~FRewardAdActivityResult()
 {
     //if (RewardResults != nullptr) delete RewardResults;
 
 }
 
-void PlayFab::ClientModels::FRewardAdActivityResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FRewardAdActivityResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -21275,6 +37154,16 @@ void PlayFab::ClientModels::FRewardAdActivityResult::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FRewardAdActivityResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FRewardAdActivityResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FRewardAdActivityResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -21319,18 +37208,77 @@ bool PlayFab::ClientModels::FRewardAdActivityResult::readFromValue(const TShared
     const TSharedPtr<FJsonValue> RewardResultsValue = obj->TryGetField(TEXT("RewardResults"));
     if (RewardResultsValue.IsValid() && !RewardResultsValue->IsNull())
     {
-        RewardResults = MakeShareable(new FAdRewardResults(RewardResultsValue->AsObject()));
+        RewardResults = MakeShared<FAdRewardResults>(RewardResultsValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FRewardAdActivityResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AdActivityEventId"))
+        {
+            reader.ReadValue(AdActivityEventId);
+        }
+        else if (reader.IsField("DebugResults"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { DebugResults.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlacementId"))
+        {
+            reader.ReadValue(PlacementId);
+        }
+        else if (reader.IsField("PlacementName"))
+        {
+            reader.ReadValue(PlacementName);
+        }
+        else if (reader.IsField("PlacementViewsRemaining"))
+        {
+            reader.ReadValue(PlacementViewsRemaining);
+        }
+        else if (reader.IsField("PlacementViewsResetMinutes"))
+        {
+            reader.ReadValue(PlacementViewsResetMinutes);
+        }
+        else if (reader.IsField("RewardResults"))
+        {
+            RewardResults = MakeShared<FAdRewardResults>();
+            RewardResults->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRewardAdActivityResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FSendAccountRecoveryEmailRequest::~FSendAccountRecoveryEmailRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FSendAccountRecoveryEmailRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FSendAccountRecoveryEmailRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -21374,6 +37322,16 @@ void PlayFab::ClientModels::FSendAccountRecoveryEmailRequest::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FSendAccountRecoveryEmailRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FSendAccountRecoveryEmailRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FSendAccountRecoveryEmailRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -21383,7 +37341,7 @@ bool PlayFab::ClientModels::FSendAccountRecoveryEmailRequest::readFromValue(cons
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -21411,18 +37369,74 @@ bool PlayFab::ClientModels::FSendAccountRecoveryEmailRequest::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FSendAccountRecoveryEmailRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Email"))
+        {
+            reader.ReadValue(Email);
+        }
+        else if (reader.IsField("EmailTemplateId"))
+        {
+            reader.ReadValue(EmailTemplateId);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSendAccountRecoveryEmailRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FSendAccountRecoveryEmailResult::~FSendAccountRecoveryEmailResult()
 {
 
 }
 
-void PlayFab::ClientModels::FSendAccountRecoveryEmailResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FSendAccountRecoveryEmailResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FSendAccountRecoveryEmailResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FSendAccountRecoveryEmailResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FSendAccountRecoveryEmailResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -21430,12 +37444,34 @@ bool PlayFab::ClientModels::FSendAccountRecoveryEmailResult::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FSendAccountRecoveryEmailResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSendAccountRecoveryEmailResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FSetFriendTagsRequest::~FSetFriendTagsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FSetFriendTagsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FSetFriendTagsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -21458,6 +37494,16 @@ void PlayFab::ClientModels::FSetFriendTagsRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FSetFriendTagsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FSetFriendTagsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FSetFriendTagsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -21474,18 +37520,66 @@ bool PlayFab::ClientModels::FSetFriendTagsRequest::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FSetFriendTagsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FriendPlayFabId"))
+        {
+            reader.ReadValue(FriendPlayFabId);
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Tags.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetFriendTagsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FSetFriendTagsResult::~FSetFriendTagsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FSetFriendTagsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FSetFriendTagsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FSetFriendTagsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FSetFriendTagsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FSetFriendTagsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -21493,12 +37587,34 @@ bool PlayFab::ClientModels::FSetFriendTagsResult::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FSetFriendTagsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetFriendTagsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FSetPlayerSecretRequest::~FSetPlayerSecretRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FSetPlayerSecretRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FSetPlayerSecretRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -21517,6 +37633,16 @@ void PlayFab::ClientModels::FSetPlayerSecretRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FSetPlayerSecretRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FSetPlayerSecretRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FSetPlayerSecretRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -21538,18 +37664,59 @@ bool PlayFab::ClientModels::FSetPlayerSecretRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FSetPlayerSecretRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("EncryptedRequest"))
+        {
+            reader.ReadValue(EncryptedRequest);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetPlayerSecretRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FSetPlayerSecretResult::~FSetPlayerSecretResult()
 {
 
 }
 
-void PlayFab::ClientModels::FSetPlayerSecretResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FSetPlayerSecretResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FSetPlayerSecretResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FSetPlayerSecretResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FSetPlayerSecretResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -21557,12 +37724,34 @@ bool PlayFab::ClientModels::FSetPlayerSecretResult::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FSetPlayerSecretResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetPlayerSecretResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FStartGameRequest::~FStartGameRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FStartGameRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FStartGameRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -21621,6 +37810,16 @@ void PlayFab::ClientModels::FStartGameRequest::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FStartGameRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FStartGameRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FStartGameRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -21651,7 +37850,7 @@ bool PlayFab::ClientModels::FStartGameRequest::readFromValue(const TSharedPtr<FJ
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -21674,12 +37873,71 @@ bool PlayFab::ClientModels::FStartGameRequest::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FStartGameRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildVersion"))
+        {
+            reader.ReadValue(BuildVersion);
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CustomCommandLineData"))
+        {
+            reader.ReadValue(CustomCommandLineData);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("GameMode"))
+        {
+            reader.ReadValue(GameMode);
+        }
+        else if (reader.IsField("Region"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfRegion = readRegionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStartGameRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FStartGameResult::~FStartGameResult()
 {
 
 }
 
-void PlayFab::ClientModels::FStartGameResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FStartGameResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -21734,11 +37992,21 @@ void PlayFab::ClientModels::FStartGameResult::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
-bool PlayFab::ClientModels::FStartGameResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
+void PlayFab::ClientModels::FStartGameResult::writeJSON(JsonWriter& writer) const
 {
-    bool HasSucceeded = true;
+    writeJSONObject(writer);
+}
 
-    const TSharedPtr<FJsonValue> ExpiresValue = obj->TryGetField(TEXT("Expires"));
+void PlayFab::ClientModels::FStartGameResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
+bool PlayFab::ClientModels::FStartGameResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
+{
+    bool HasSucceeded = true;
+
+    const TSharedPtr<FJsonValue> ExpiresValue = obj->TryGetField(TEXT("Expires"));
     if (ExpiresValue.IsValid() && !ExpiresValue->IsNull())
     {
         FString TmpValue;
@@ -21797,12 +38065,67 @@ bool PlayFab::ClientModels::FStartGameResult::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FStartGameResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Expires"))
+        {
+            reader.ReadValue(Expires);
+        }
+        else if (reader.IsField("LobbyID"))
+        {
+            reader.ReadValue(LobbyID);
+        }
+        else if (reader.IsField("Password"))
+        {
+            reader.ReadValue(Password);
+        }
+        else if (reader.IsField("ServerIPV4Address"))
+        {
+            reader.ReadValue(ServerIPV4Address);
+        }
+        else if (reader.IsField("ServerIPV6Address"))
+        {
+            reader.ReadValue(ServerIPV6Address);
+        }
+        else if (reader.IsField("ServerPort"))
+        {
+            reader.ReadValue(ServerPort);
+        }
+        else if (reader.IsField("ServerPublicDNSName"))
+        {
+            reader.ReadValue(ServerPublicDNSName);
+        }
+        else if (reader.IsField("Ticket"))
+        {
+            reader.ReadValue(Ticket);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStartGameResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FStartPurchaseRequest::~FStartPurchaseRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FStartPurchaseRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FStartPurchaseRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -21838,6 +38161,16 @@ void PlayFab::ClientModels::FStartPurchaseRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FStartPurchaseRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FStartPurchaseRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FStartPurchaseRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -21854,7 +38187,7 @@ bool PlayFab::ClientModels::FStartPurchaseRequest::readFromValue(const TSharedPt
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -21862,7 +38195,7 @@ bool PlayFab::ClientModels::FStartPurchaseRequest::readFromValue(const TSharedPt
     for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FItemPurchaseRequest(CurrentItem->AsObject()));
+        Items.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -21876,12 +38209,65 @@ bool PlayFab::ClientModels::FStartPurchaseRequest::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FStartPurchaseRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Items"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Items[Items.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("StoreId"))
+        {
+            reader.ReadValue(StoreId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStartPurchaseRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FStartPurchaseResult::~FStartPurchaseResult()
 {
 
 }
 
-void PlayFab::ClientModels::FStartPurchaseResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FStartPurchaseResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -21923,6 +38309,16 @@ void PlayFab::ClientModels::FStartPurchaseResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FStartPurchaseResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FStartPurchaseResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FStartPurchaseResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -21931,7 +38327,7 @@ bool PlayFab::ClientModels::FStartPurchaseResult::readFromValue(const TSharedPtr
     for (int32 Idx = 0; Idx < ContentsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ContentsArray[Idx];
-        Contents.Add(FCartItem(CurrentItem->AsObject()));
+        Contents.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -21946,7 +38342,7 @@ bool PlayFab::ClientModels::FStartPurchaseResult::readFromValue(const TSharedPtr
     for (int32 Idx = 0; Idx < PaymentOptionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PaymentOptionsArray[Idx];
-        PaymentOptions.Add(FPaymentOption(CurrentItem->AsObject()));
+        PaymentOptions.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -21956,19 +38352,79 @@ bool PlayFab::ClientModels::FStartPurchaseResult::readFromValue(const TSharedPtr
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyBalancesObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrencyBalances.Add(It.Key(), TmpValue);
+            VirtualCurrencyBalances.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FStartPurchaseResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Contents"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Contents[Contents.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("OrderId"))
+        {
+            reader.ReadValue(OrderId);
+        }
+        else if (reader.IsField("PaymentOptions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { PaymentOptions[PaymentOptions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyBalances"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrencyBalances.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStartPurchaseResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FStatisticUpdate::~FStatisticUpdate()
 {
 
 }
 
-void PlayFab::ClientModels::FStatisticUpdate::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FStatisticUpdate::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -21994,6 +38450,16 @@ void PlayFab::ClientModels::FStatisticUpdate::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FStatisticUpdate::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FStatisticUpdate::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FStatisticUpdate::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22022,12 +38488,47 @@ bool PlayFab::ClientModels::FStatisticUpdate::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FStatisticUpdate::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStatisticUpdate();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FSubtractUserVirtualCurrencyRequest::~FSubtractUserVirtualCurrencyRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FSubtractUserVirtualCurrencyRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FSubtractUserVirtualCurrencyRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -22058,6 +38559,16 @@ void PlayFab::ClientModels::FSubtractUserVirtualCurrencyRequest::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FSubtractUserVirtualCurrencyRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FSubtractUserVirtualCurrencyRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FSubtractUserVirtualCurrencyRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22074,7 +38585,7 @@ bool PlayFab::ClientModels::FSubtractUserVirtualCurrencyRequest::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -22088,12 +38599,54 @@ bool PlayFab::ClientModels::FSubtractUserVirtualCurrencyRequest::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FSubtractUserVirtualCurrencyRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Amount"))
+        {
+            reader.ReadValue(Amount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            reader.ReadValue(VirtualCurrency);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSubtractUserVirtualCurrencyRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkAndroidDeviceIDRequest::~FUnlinkAndroidDeviceIDRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkAndroidDeviceIDRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkAndroidDeviceIDRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -22117,6 +38670,16 @@ void PlayFab::ClientModels::FUnlinkAndroidDeviceIDRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkAndroidDeviceIDRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkAndroidDeviceIDRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkAndroidDeviceIDRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22133,25 +38696,73 @@ bool PlayFab::ClientModels::FUnlinkAndroidDeviceIDRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkAndroidDeviceIDRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AndroidDeviceId"))
+        {
+            reader.ReadValue(AndroidDeviceId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkAndroidDeviceIDRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkAndroidDeviceIDResult::~FUnlinkAndroidDeviceIDResult()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkAndroidDeviceIDResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkAndroidDeviceIDResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkAndroidDeviceIDResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkAndroidDeviceIDResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkAndroidDeviceIDResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22159,12 +38770,34 @@ bool PlayFab::ClientModels::FUnlinkAndroidDeviceIDResult::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkAndroidDeviceIDResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkAndroidDeviceIDResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkAppleRequest::~FUnlinkAppleRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkAppleRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkAppleRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -22182,6 +38815,16 @@ void PlayFab::ClientModels::FUnlinkAppleRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkAppleRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkAppleRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkAppleRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22191,19 +38834,53 @@ bool PlayFab::ClientModels::FUnlinkAppleRequest::readFromValue(const TSharedPtr<
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkAppleRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkAppleRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkCustomIDRequest::~FUnlinkCustomIDRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkCustomIDRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkCustomIDRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -22227,6 +38904,16 @@ void PlayFab::ClientModels::FUnlinkCustomIDRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkCustomIDRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkCustomIDRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkCustomIDRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22243,25 +38930,73 @@ bool PlayFab::ClientModels::FUnlinkCustomIDRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkCustomIDRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomId"))
+        {
+            reader.ReadValue(CustomId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkCustomIDRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkCustomIDResult::~FUnlinkCustomIDResult()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkCustomIDResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkCustomIDResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkCustomIDResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkCustomIDResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkCustomIDResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22269,12 +39004,34 @@ bool PlayFab::ClientModels::FUnlinkCustomIDResult::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkCustomIDResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkCustomIDResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkFacebookAccountRequest::~FUnlinkFacebookAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkFacebookAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkFacebookAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -22292,6 +39049,16 @@ void PlayFab::ClientModels::FUnlinkFacebookAccountRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkFacebookAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkFacebookAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkFacebookAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22301,25 +39068,69 @@ bool PlayFab::ClientModels::FUnlinkFacebookAccountRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkFacebookAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkFacebookAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkFacebookAccountResult::~FUnlinkFacebookAccountResult()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkFacebookAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkFacebookAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkFacebookAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkFacebookAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkFacebookAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22327,12 +39138,34 @@ bool PlayFab::ClientModels::FUnlinkFacebookAccountResult::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkFacebookAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkFacebookAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdRequest::~FUnlinkFacebookInstantGamesIdRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -22356,6 +39189,16 @@ void PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdRequest::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22365,7 +39208,7 @@ bool PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdRequest::readFromValue(
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -22379,18 +39222,66 @@ bool PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdRequest::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("FacebookInstantGamesId"))
+        {
+            reader.ReadValue(FacebookInstantGamesId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkFacebookInstantGamesIdRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdResult::~FUnlinkFacebookInstantGamesIdResult()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22398,12 +39289,34 @@ bool PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdResult::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkFacebookInstantGamesIdResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkFacebookInstantGamesIdResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkGameCenterAccountRequest::~FUnlinkGameCenterAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkGameCenterAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkGameCenterAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -22421,6 +39334,16 @@ void PlayFab::ClientModels::FUnlinkGameCenterAccountRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkGameCenterAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkGameCenterAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkGameCenterAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22430,25 +39353,69 @@ bool PlayFab::ClientModels::FUnlinkGameCenterAccountRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkGameCenterAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkGameCenterAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkGameCenterAccountResult::~FUnlinkGameCenterAccountResult()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkGameCenterAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkGameCenterAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkGameCenterAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkGameCenterAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkGameCenterAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22456,12 +39423,34 @@ bool PlayFab::ClientModels::FUnlinkGameCenterAccountResult::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkGameCenterAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkGameCenterAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkGoogleAccountRequest::~FUnlinkGoogleAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkGoogleAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkGoogleAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -22479,6 +39468,16 @@ void PlayFab::ClientModels::FUnlinkGoogleAccountRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkGoogleAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkGoogleAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkGoogleAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22488,25 +39487,69 @@ bool PlayFab::ClientModels::FUnlinkGoogleAccountRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkGoogleAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkGoogleAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkGoogleAccountResult::~FUnlinkGoogleAccountResult()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkGoogleAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkGoogleAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkGoogleAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkGoogleAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkGoogleAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22514,12 +39557,34 @@ bool PlayFab::ClientModels::FUnlinkGoogleAccountResult::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkGoogleAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkGoogleAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkIOSDeviceIDRequest::~FUnlinkIOSDeviceIDRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkIOSDeviceIDRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkIOSDeviceIDRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -22543,6 +39608,16 @@ void PlayFab::ClientModels::FUnlinkIOSDeviceIDRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkIOSDeviceIDRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkIOSDeviceIDRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkIOSDeviceIDRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22552,7 +39627,7 @@ bool PlayFab::ClientModels::FUnlinkIOSDeviceIDRequest::readFromValue(const TShar
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -22563,7 +39638,44 @@ bool PlayFab::ClientModels::FUnlinkIOSDeviceIDRequest::readFromValue(const TShar
         if (DeviceIdValue->TryGetString(TmpValue)) { DeviceId = TmpValue; }
     }
 
-    return HasSucceeded;
+    return HasSucceeded;
+}
+
+bool PlayFab::ClientModels::FUnlinkIOSDeviceIDRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("DeviceId"))
+        {
+            reader.ReadValue(DeviceId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkIOSDeviceIDRequest();
+        return false;
+    }
+    return true;
 }
 
 PlayFab::ClientModels::FUnlinkIOSDeviceIDResult::~FUnlinkIOSDeviceIDResult()
@@ -22571,13 +39683,24 @@ PlayFab::ClientModels::FUnlinkIOSDeviceIDResult::~FUnlinkIOSDeviceIDResult()
 
 }
 
-void PlayFab::ClientModels::FUnlinkIOSDeviceIDResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkIOSDeviceIDResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkIOSDeviceIDResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkIOSDeviceIDResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkIOSDeviceIDResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22585,12 +39708,34 @@ bool PlayFab::ClientModels::FUnlinkIOSDeviceIDResult::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkIOSDeviceIDResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkIOSDeviceIDResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkKongregateAccountRequest::~FUnlinkKongregateAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkKongregateAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkKongregateAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -22608,6 +39753,16 @@ void PlayFab::ClientModels::FUnlinkKongregateAccountRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkKongregateAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkKongregateAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkKongregateAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22617,25 +39772,69 @@ bool PlayFab::ClientModels::FUnlinkKongregateAccountRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkKongregateAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkKongregateAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkKongregateAccountResult::~FUnlinkKongregateAccountResult()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkKongregateAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkKongregateAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkKongregateAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkKongregateAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkKongregateAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22643,12 +39842,34 @@ bool PlayFab::ClientModels::FUnlinkKongregateAccountResult::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkKongregateAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkKongregateAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkNintendoServiceAccountRequest::~FUnlinkNintendoServiceAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkNintendoServiceAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkNintendoServiceAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -22666,6 +39887,16 @@ void PlayFab::ClientModels::FUnlinkNintendoServiceAccountRequest::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkNintendoServiceAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkNintendoServiceAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkNintendoServiceAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22675,19 +39906,53 @@ bool PlayFab::ClientModels::FUnlinkNintendoServiceAccountRequest::readFromValue(
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkNintendoServiceAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkNintendoServiceAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdRequest::~FUnlinkNintendoSwitchDeviceIdRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -22711,6 +39976,16 @@ void PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdRequest::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22720,7 +39995,7 @@ bool PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdRequest::readFromValue(
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -22734,18 +40009,66 @@ bool PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdRequest::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("NintendoSwitchDeviceId"))
+        {
+            reader.ReadValue(NintendoSwitchDeviceId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkNintendoSwitchDeviceIdRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdResult::~FUnlinkNintendoSwitchDeviceIdResult()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22753,12 +40076,34 @@ bool PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdResult::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkNintendoSwitchDeviceIdResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkNintendoSwitchDeviceIdResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkOpenIdConnectRequest::~FUnlinkOpenIdConnectRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkOpenIdConnectRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkOpenIdConnectRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -22786,6 +40131,16 @@ void PlayFab::ClientModels::FUnlinkOpenIdConnectRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkOpenIdConnectRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkOpenIdConnectRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkOpenIdConnectRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22802,19 +40157,57 @@ bool PlayFab::ClientModels::FUnlinkOpenIdConnectRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkOpenIdConnectRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ConnectionId"))
+        {
+            reader.ReadValue(ConnectionId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkOpenIdConnectRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkPSNAccountRequest::~FUnlinkPSNAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkPSNAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkPSNAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -22832,6 +40225,16 @@ void PlayFab::ClientModels::FUnlinkPSNAccountRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkPSNAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkPSNAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkPSNAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22841,25 +40244,69 @@ bool PlayFab::ClientModels::FUnlinkPSNAccountRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkPSNAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkPSNAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkPSNAccountResult::~FUnlinkPSNAccountResult()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkPSNAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkPSNAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkPSNAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkPSNAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkPSNAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22867,12 +40314,34 @@ bool PlayFab::ClientModels::FUnlinkPSNAccountResult::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkPSNAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkPSNAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkSteamAccountRequest::~FUnlinkSteamAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkSteamAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkSteamAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -22890,6 +40359,16 @@ void PlayFab::ClientModels::FUnlinkSteamAccountRequest::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkSteamAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkSteamAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkSteamAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22899,25 +40378,69 @@ bool PlayFab::ClientModels::FUnlinkSteamAccountRequest::readFromValue(const TSha
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkSteamAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkSteamAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkSteamAccountResult::~FUnlinkSteamAccountResult()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkSteamAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkSteamAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkSteamAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkSteamAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkSteamAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22925,12 +40448,34 @@ bool PlayFab::ClientModels::FUnlinkSteamAccountResult::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkSteamAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkSteamAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkTwitchAccountRequest::~FUnlinkTwitchAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkTwitchAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkTwitchAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -22954,6 +40499,16 @@ void PlayFab::ClientModels::FUnlinkTwitchAccountRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkTwitchAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkTwitchAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkTwitchAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22970,25 +40525,73 @@ bool PlayFab::ClientModels::FUnlinkTwitchAccountRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkTwitchAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AccessToken"))
+        {
+            reader.ReadValue(AccessToken);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkTwitchAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkTwitchAccountResult::~FUnlinkTwitchAccountResult()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkTwitchAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkTwitchAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkTwitchAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkTwitchAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkTwitchAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -22996,12 +40599,34 @@ bool PlayFab::ClientModels::FUnlinkTwitchAccountResult::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkTwitchAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkTwitchAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkWindowsHelloAccountRequest::~FUnlinkWindowsHelloAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkWindowsHelloAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkWindowsHelloAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -23029,6 +40654,16 @@ void PlayFab::ClientModels::FUnlinkWindowsHelloAccountRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkWindowsHelloAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkWindowsHelloAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkWindowsHelloAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23038,7 +40673,7 @@ bool PlayFab::ClientModels::FUnlinkWindowsHelloAccountRequest::readFromValue(con
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -23052,18 +40687,66 @@ bool PlayFab::ClientModels::FUnlinkWindowsHelloAccountRequest::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkWindowsHelloAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PublicKeyHint"))
+        {
+            reader.ReadValue(PublicKeyHint);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkWindowsHelloAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkWindowsHelloAccountResponse::~FUnlinkWindowsHelloAccountResponse()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkWindowsHelloAccountResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkWindowsHelloAccountResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkWindowsHelloAccountResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkWindowsHelloAccountResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkWindowsHelloAccountResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23071,12 +40754,34 @@ bool PlayFab::ClientModels::FUnlinkWindowsHelloAccountResponse::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkWindowsHelloAccountResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkWindowsHelloAccountResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkXboxAccountRequest::~FUnlinkXboxAccountRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkXboxAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkXboxAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -23094,6 +40799,16 @@ void PlayFab::ClientModels::FUnlinkXboxAccountRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkXboxAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkXboxAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkXboxAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23103,25 +40818,69 @@ bool PlayFab::ClientModels::FUnlinkXboxAccountRequest::readFromValue(const TShar
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkXboxAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkXboxAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlinkXboxAccountResult::~FUnlinkXboxAccountResult()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlinkXboxAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlinkXboxAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlinkXboxAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlinkXboxAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlinkXboxAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23129,12 +40888,34 @@ bool PlayFab::ClientModels::FUnlinkXboxAccountResult::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlinkXboxAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkXboxAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlockContainerInstanceRequest::~FUnlockContainerInstanceRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlockContainerInstanceRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlockContainerInstanceRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -23180,6 +40961,16 @@ void PlayFab::ClientModels::FUnlockContainerInstanceRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlockContainerInstanceRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlockContainerInstanceRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlockContainerInstanceRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23210,7 +41001,7 @@ bool PlayFab::ClientModels::FUnlockContainerInstanceRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -23224,12 +41015,62 @@ bool PlayFab::ClientModels::FUnlockContainerInstanceRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlockContainerInstanceRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("ContainerItemInstanceId"))
+        {
+            reader.ReadValue(ContainerItemInstanceId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("KeyItemInstanceId"))
+        {
+            reader.ReadValue(KeyItemInstanceId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlockContainerInstanceRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlockContainerItemRequest::~FUnlockContainerItemRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlockContainerItemRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlockContainerItemRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -23269,6 +41110,16 @@ void PlayFab::ClientModels::FUnlockContainerItemRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlockContainerItemRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlockContainerItemRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlockContainerItemRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23299,19 +41150,65 @@ bool PlayFab::ClientModels::FUnlockContainerItemRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlockContainerItemRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("ContainerItemId"))
+        {
+            reader.ReadValue(ContainerItemId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlockContainerItemRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUnlockContainerItemResult::~FUnlockContainerItemResult()
 {
 
 }
 
-void PlayFab::ClientModels::FUnlockContainerItemResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUnlockContainerItemResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -23350,6 +41247,16 @@ void PlayFab::ClientModels::FUnlockContainerItemResult::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUnlockContainerItemResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUnlockContainerItemResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUnlockContainerItemResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23358,7 +41265,7 @@ bool PlayFab::ClientModels::FUnlockContainerItemResult::readFromValue(const TSha
     for (int32 Idx = 0; Idx < GrantedItemsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GrantedItemsArray[Idx];
-        GrantedItems.Add(FItemInstance(CurrentItem->AsObject()));
+        GrantedItems.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -23382,19 +41289,72 @@ bool PlayFab::ClientModels::FUnlockContainerItemResult::readFromValue(const TSha
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrency.Add(It.Key(), TmpValue);
+            VirtualCurrency.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUnlockContainerItemResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GrantedItems"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GrantedItems[GrantedItems.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("UnlockedItemInstanceId"))
+        {
+            reader.ReadValue(UnlockedItemInstanceId);
+        }
+        else if (reader.IsField("UnlockedWithItemInstanceId"))
+        {
+            reader.ReadValue(UnlockedWithItemInstanceId);
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrency.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlockContainerItemResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUpdateAvatarUrlRequest::~FUpdateAvatarUrlRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUpdateAvatarUrlRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUpdateAvatarUrlRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -23411,6 +41371,16 @@ void PlayFab::ClientModels::FUpdateAvatarUrlRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUpdateAvatarUrlRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUpdateAvatarUrlRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUpdateAvatarUrlRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23425,12 +41395,39 @@ bool PlayFab::ClientModels::FUpdateAvatarUrlRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUpdateAvatarUrlRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ImageUrl"))
+        {
+            reader.ReadValue(ImageUrl);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateAvatarUrlRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUpdateCharacterDataRequest::~FUpdateCharacterDataRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUpdateCharacterDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUpdateCharacterDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -23484,6 +41481,16 @@ void PlayFab::ClientModels::FUpdateCharacterDataRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUpdateCharacterDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUpdateCharacterDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUpdateCharacterDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23500,7 +41507,7 @@ bool PlayFab::ClientModels::FUpdateCharacterDataRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -23509,7 +41516,7 @@ bool PlayFab::ClientModels::FUpdateCharacterDataRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -23520,12 +41527,77 @@ bool PlayFab::ClientModels::FUpdateCharacterDataRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUpdateCharacterDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("KeysToRemove"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { KeysToRemove.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Permission"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Permission = readUserDataPermissionFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateCharacterDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUpdateCharacterDataResult::~FUpdateCharacterDataResult()
 {
 
 }
 
-void PlayFab::ClientModels::FUpdateCharacterDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUpdateCharacterDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -23535,6 +41607,16 @@ void PlayFab::ClientModels::FUpdateCharacterDataResult::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUpdateCharacterDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUpdateCharacterDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUpdateCharacterDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23549,12 +41631,39 @@ bool PlayFab::ClientModels::FUpdateCharacterDataResult::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUpdateCharacterDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DataVersion"))
+        {
+            reader.ReadValue(DataVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateCharacterDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUpdateCharacterStatisticsRequest::~FUpdateCharacterStatisticsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUpdateCharacterStatisticsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUpdateCharacterStatisticsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -23593,6 +41702,16 @@ void PlayFab::ClientModels::FUpdateCharacterStatisticsRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUpdateCharacterStatisticsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUpdateCharacterStatisticsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUpdateCharacterStatisticsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23607,23 +41726,71 @@ bool PlayFab::ClientModels::FUpdateCharacterStatisticsRequest::readFromValue(con
     const TSharedPtr<FJsonObject>* CharacterStatisticsObject;
     if (obj->TryGetObjectField(TEXT("CharacterStatistics"), CharacterStatisticsObject))
     {
-        for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CharacterStatisticsObject)->Values); It; ++It)
+        for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CharacterStatisticsObject)->Values); It; ++It)
+        {
+            int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
+            CharacterStatistics.Emplace(It.Key(), TmpValue);
+        }
+    }
+
+    const TSharedPtr<FJsonObject>* CustomTagsObject;
+    if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
+    {
+        for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
+        {
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
+        }
+    }
+
+    return HasSucceeded;
+}
+
+bool PlayFab::ClientModels::FUpdateCharacterStatisticsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
         {
-            int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            CharacterStatistics.Add(It.Key(), TmpValue);
+            reader.ReadValue(CharacterId);
         }
-    }
-
-    const TSharedPtr<FJsonObject>* CustomTagsObject;
-    if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
-    {
-        for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
+        else if (reader.IsField("CharacterStatistics"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CharacterStatistics.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("CustomTags"))
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
         }
+        else
+            reader.SkipValue();
     }
 
-    return HasSucceeded;
+    if (!reader.IsValid())
+    {
+        *this = FUpdateCharacterStatisticsRequest();
+        return false;
+    }
+    return true;
 }
 
 PlayFab::ClientModels::FUpdateCharacterStatisticsResult::~FUpdateCharacterStatisticsResult()
@@ -23631,13 +41798,24 @@ PlayFab::ClientModels::FUpdateCharacterStatisticsResult::~FUpdateCharacterStatis
 
 }
 
-void PlayFab::ClientModels::FUpdateCharacterStatisticsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUpdateCharacterStatisticsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUpdateCharacterStatisticsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUpdateCharacterStatisticsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUpdateCharacterStatisticsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23645,12 +41823,34 @@ bool PlayFab::ClientModels::FUpdateCharacterStatisticsResult::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUpdateCharacterStatisticsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateCharacterStatisticsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUpdatePlayerStatisticsRequest::~FUpdatePlayerStatisticsRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUpdatePlayerStatisticsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUpdatePlayerStatisticsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -23674,6 +41874,16 @@ void PlayFab::ClientModels::FUpdatePlayerStatisticsRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUpdatePlayerStatisticsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUpdatePlayerStatisticsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUpdatePlayerStatisticsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23683,7 +41893,7 @@ bool PlayFab::ClientModels::FUpdatePlayerStatisticsRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -23691,25 +41901,80 @@ bool PlayFab::ClientModels::FUpdatePlayerStatisticsRequest::readFromValue(const
     for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FStatisticUpdate(CurrentItem->AsObject()));
+        Statistics.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUpdatePlayerStatisticsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Statistics"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Statistics[Statistics.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdatePlayerStatisticsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUpdatePlayerStatisticsResult::~FUpdatePlayerStatisticsResult()
 {
 
 }
 
-void PlayFab::ClientModels::FUpdatePlayerStatisticsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUpdatePlayerStatisticsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUpdatePlayerStatisticsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUpdatePlayerStatisticsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUpdatePlayerStatisticsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23717,12 +41982,34 @@ bool PlayFab::ClientModels::FUpdatePlayerStatisticsResult::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUpdatePlayerStatisticsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdatePlayerStatisticsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUpdateSharedGroupDataRequest::~FUpdateSharedGroupDataRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUpdateSharedGroupDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUpdateSharedGroupDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -23776,6 +42063,16 @@ void PlayFab::ClientModels::FUpdateSharedGroupDataRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUpdateSharedGroupDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUpdateSharedGroupDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUpdateSharedGroupDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23785,7 +42082,7 @@ bool PlayFab::ClientModels::FUpdateSharedGroupDataRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -23794,7 +42091,7 @@ bool PlayFab::ClientModels::FUpdateSharedGroupDataRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -23812,18 +42109,93 @@ bool PlayFab::ClientModels::FUpdateSharedGroupDataRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUpdateSharedGroupDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("KeysToRemove"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { KeysToRemove.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Permission"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Permission = readUserDataPermissionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("SharedGroupId"))
+        {
+            reader.ReadValue(SharedGroupId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateSharedGroupDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUpdateSharedGroupDataResult::~FUpdateSharedGroupDataResult()
 {
 
 }
 
-void PlayFab::ClientModels::FUpdateSharedGroupDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUpdateSharedGroupDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUpdateSharedGroupDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUpdateSharedGroupDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUpdateSharedGroupDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23831,12 +42203,34 @@ bool PlayFab::ClientModels::FUpdateSharedGroupDataResult::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUpdateSharedGroupDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateSharedGroupDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUpdateUserDataRequest::~FUpdateUserDataRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUpdateUserDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUpdateUserDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -23880,6 +42274,16 @@ void PlayFab::ClientModels::FUpdateUserDataRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUpdateUserDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUpdateUserDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUpdateUserDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23889,7 +42293,7 @@ bool PlayFab::ClientModels::FUpdateUserDataRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -23898,7 +42302,7 @@ bool PlayFab::ClientModels::FUpdateUserDataRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -23909,12 +42313,73 @@ bool PlayFab::ClientModels::FUpdateUserDataRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUpdateUserDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("KeysToRemove"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { KeysToRemove.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Permission"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Permission = readUserDataPermissionFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateUserDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUpdateUserDataResult::~FUpdateUserDataResult()
 {
 
 }
 
-void PlayFab::ClientModels::FUpdateUserDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUpdateUserDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -23924,6 +42389,16 @@ void PlayFab::ClientModels::FUpdateUserDataResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUpdateUserDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUpdateUserDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUpdateUserDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23938,12 +42413,39 @@ bool PlayFab::ClientModels::FUpdateUserDataResult::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUpdateUserDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DataVersion"))
+        {
+            reader.ReadValue(DataVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateUserDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUpdateUserTitleDisplayNameRequest::~FUpdateUserTitleDisplayNameRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FUpdateUserTitleDisplayNameRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUpdateUserTitleDisplayNameRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -23971,6 +42473,16 @@ void PlayFab::ClientModels::FUpdateUserTitleDisplayNameRequest::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUpdateUserTitleDisplayNameRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUpdateUserTitleDisplayNameRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUpdateUserTitleDisplayNameRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -23980,7 +42492,7 @@ bool PlayFab::ClientModels::FUpdateUserTitleDisplayNameRequest::readFromValue(co
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -23994,12 +42506,50 @@ bool PlayFab::ClientModels::FUpdateUserTitleDisplayNameRequest::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUpdateUserTitleDisplayNameRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateUserTitleDisplayNameRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FUpdateUserTitleDisplayNameResult::~FUpdateUserTitleDisplayNameResult()
 {
 
 }
 
-void PlayFab::ClientModels::FUpdateUserTitleDisplayNameResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FUpdateUserTitleDisplayNameResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -24012,6 +42562,16 @@ void PlayFab::ClientModels::FUpdateUserTitleDisplayNameResult::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FUpdateUserTitleDisplayNameResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FUpdateUserTitleDisplayNameResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FUpdateUserTitleDisplayNameResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -24026,12 +42586,39 @@ bool PlayFab::ClientModels::FUpdateUserTitleDisplayNameResult::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FUpdateUserTitleDisplayNameResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateUserTitleDisplayNameResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FValidateAmazonReceiptRequest::~FValidateAmazonReceiptRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FValidateAmazonReceiptRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FValidateAmazonReceiptRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -24084,6 +42671,16 @@ void PlayFab::ClientModels::FValidateAmazonReceiptRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FValidateAmazonReceiptRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FValidateAmazonReceiptRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FValidateAmazonReceiptRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -24107,7 +42704,7 @@ bool PlayFab::ClientModels::FValidateAmazonReceiptRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -24135,12 +42732,66 @@ bool PlayFab::ClientModels::FValidateAmazonReceiptRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FValidateAmazonReceiptRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CurrencyCode"))
+        {
+            reader.ReadValue(CurrencyCode);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PurchasePrice"))
+        {
+            reader.ReadValue(PurchasePrice);
+        }
+        else if (reader.IsField("ReceiptId"))
+        {
+            reader.ReadValue(ReceiptId);
+        }
+        else if (reader.IsField("UserId"))
+        {
+            reader.ReadValue(UserId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FValidateAmazonReceiptRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FValidateAmazonReceiptResult::~FValidateAmazonReceiptResult()
 {
 
 }
 
-void PlayFab::ClientModels::FValidateAmazonReceiptResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FValidateAmazonReceiptResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -24156,19 +42807,62 @@ void PlayFab::ClientModels::FValidateAmazonReceiptResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FValidateAmazonReceiptResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FValidateAmazonReceiptResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FValidateAmazonReceiptResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
 
-    const TArray<TSharedPtr<FJsonValue>>&FulfillmentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Fulfillments"));
-    for (int32 Idx = 0; Idx < FulfillmentsArray.Num(); Idx++)
+    const TArray<TSharedPtr<FJsonValue>>&FulfillmentsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Fulfillments"));
+    for (int32 Idx = 0; Idx < FulfillmentsArray.Num(); Idx++)
+    {
+        TSharedPtr<FJsonValue> CurrentItem = FulfillmentsArray[Idx];
+        Fulfillments.Emplace(CurrentItem->AsObject());
+    }
+
+
+    return HasSucceeded;
+}
+
+bool PlayFab::ClientModels::FValidateAmazonReceiptResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
     {
-        TSharedPtr<FJsonValue> CurrentItem = FulfillmentsArray[Idx];
-        Fulfillments.Add(FPurchaseReceiptFulfillment(CurrentItem->AsObject()));
-    }
+        if (reader.ReadNull())
+            continue;
 
+        if (reader.IsField("Fulfillments"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Fulfillments[Fulfillments.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
 
-    return HasSucceeded;
+    if (!reader.IsValid())
+    {
+        *this = FValidateAmazonReceiptResult();
+        return false;
+    }
+    return true;
 }
 
 PlayFab::ClientModels::FValidateGooglePlayPurchaseRequest::~FValidateGooglePlayPurchaseRequest()
@@ -24176,7 +42870,8 @@ PlayFab::ClientModels::FValidateGooglePlayPurchaseRequest::~FValidateGooglePlayP
 
 }
 
-void PlayFab::ClientModels::FValidateGooglePlayPurchaseRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FValidateGooglePlayPurchaseRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -24232,6 +42927,16 @@ void PlayFab::ClientModels::FValidateGooglePlayPurchaseRequest::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FValidateGooglePlayPurchaseRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FValidateGooglePlayPurchaseRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FValidateGooglePlayPurchaseRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -24255,7 +42960,7 @@ bool PlayFab::ClientModels::FValidateGooglePlayPurchaseRequest::readFromValue(co
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -24283,12 +42988,66 @@ bool PlayFab::ClientModels::FValidateGooglePlayPurchaseRequest::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FValidateGooglePlayPurchaseRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CurrencyCode"))
+        {
+            reader.ReadValue(CurrencyCode);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PurchasePrice"))
+        {
+            reader.ReadValue(PurchasePrice);
+        }
+        else if (reader.IsField("ReceiptJson"))
+        {
+            reader.ReadValue(ReceiptJson);
+        }
+        else if (reader.IsField("Signature"))
+        {
+            reader.ReadValue(Signature);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FValidateGooglePlayPurchaseRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FValidateGooglePlayPurchaseResult::~FValidateGooglePlayPurchaseResult()
 {
 
 }
 
-void PlayFab::ClientModels::FValidateGooglePlayPurchaseResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FValidateGooglePlayPurchaseResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -24304,6 +43063,16 @@ void PlayFab::ClientModels::FValidateGooglePlayPurchaseResult::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FValidateGooglePlayPurchaseResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FValidateGooglePlayPurchaseResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FValidateGooglePlayPurchaseResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -24312,19 +43081,53 @@ bool PlayFab::ClientModels::FValidateGooglePlayPurchaseResult::readFromValue(con
     for (int32 Idx = 0; Idx < FulfillmentsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = FulfillmentsArray[Idx];
-        Fulfillments.Add(FPurchaseReceiptFulfillment(CurrentItem->AsObject()));
+        Fulfillments.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FValidateGooglePlayPurchaseResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Fulfillments"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Fulfillments[Fulfillments.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FValidateGooglePlayPurchaseResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FValidateIOSReceiptRequest::~FValidateIOSReceiptRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FValidateIOSReceiptRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FValidateIOSReceiptRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -24367,6 +43170,16 @@ void PlayFab::ClientModels::FValidateIOSReceiptRequest::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FValidateIOSReceiptRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FValidateIOSReceiptRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FValidateIOSReceiptRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -24390,7 +43203,7 @@ bool PlayFab::ClientModels::FValidateIOSReceiptRequest::readFromValue(const TSha
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -24411,12 +43224,62 @@ bool PlayFab::ClientModels::FValidateIOSReceiptRequest::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FValidateIOSReceiptRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CurrencyCode"))
+        {
+            reader.ReadValue(CurrencyCode);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PurchasePrice"))
+        {
+            reader.ReadValue(PurchasePrice);
+        }
+        else if (reader.IsField("ReceiptData"))
+        {
+            reader.ReadValue(ReceiptData);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FValidateIOSReceiptRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FValidateIOSReceiptResult::~FValidateIOSReceiptResult()
 {
 
 }
 
-void PlayFab::ClientModels::FValidateIOSReceiptResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FValidateIOSReceiptResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -24432,6 +43295,16 @@ void PlayFab::ClientModels::FValidateIOSReceiptResult::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FValidateIOSReceiptResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FValidateIOSReceiptResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FValidateIOSReceiptResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -24440,19 +43313,53 @@ bool PlayFab::ClientModels::FValidateIOSReceiptResult::readFromValue(const TShar
     for (int32 Idx = 0; Idx < FulfillmentsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = FulfillmentsArray[Idx];
-        Fulfillments.Add(FPurchaseReceiptFulfillment(CurrentItem->AsObject()));
+        Fulfillments.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FValidateIOSReceiptResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Fulfillments"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Fulfillments[Fulfillments.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FValidateIOSReceiptResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FValidateWindowsReceiptRequest::~FValidateWindowsReceiptRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FValidateWindowsReceiptRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FValidateWindowsReceiptRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -24499,6 +43406,16 @@ void PlayFab::ClientModels::FValidateWindowsReceiptRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FValidateWindowsReceiptRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FValidateWindowsReceiptRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FValidateWindowsReceiptRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -24522,7 +43439,7 @@ bool PlayFab::ClientModels::FValidateWindowsReceiptRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -24543,12 +43460,62 @@ bool PlayFab::ClientModels::FValidateWindowsReceiptRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FValidateWindowsReceiptRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CurrencyCode"))
+        {
+            reader.ReadValue(CurrencyCode);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PurchasePrice"))
+        {
+            reader.ReadValue(PurchasePrice);
+        }
+        else if (reader.IsField("Receipt"))
+        {
+            reader.ReadValue(Receipt);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FValidateWindowsReceiptRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FValidateWindowsReceiptResult::~FValidateWindowsReceiptResult()
 {
 
 }
 
-void PlayFab::ClientModels::FValidateWindowsReceiptResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FValidateWindowsReceiptResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -24564,6 +43531,16 @@ void PlayFab::ClientModels::FValidateWindowsReceiptResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FValidateWindowsReceiptResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FValidateWindowsReceiptResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FValidateWindowsReceiptResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -24572,19 +43549,53 @@ bool PlayFab::ClientModels::FValidateWindowsReceiptResult::readFromValue(const T
     for (int32 Idx = 0; Idx < FulfillmentsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = FulfillmentsArray[Idx];
-        Fulfillments.Add(FPurchaseReceiptFulfillment(CurrentItem->AsObject()));
+        Fulfillments.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FValidateWindowsReceiptResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Fulfillments"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Fulfillments[Fulfillments.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FValidateWindowsReceiptResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FWriteClientCharacterEventRequest::~FWriteClientCharacterEventRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FWriteClientCharacterEventRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FWriteClientCharacterEventRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -24639,6 +43650,16 @@ void PlayFab::ClientModels::FWriteClientCharacterEventRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FWriteClientCharacterEventRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FWriteClientCharacterEventRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FWriteClientCharacterEventRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -24648,7 +43669,7 @@ bool PlayFab::ClientModels::FWriteClientCharacterEventRequest::readFromValue(con
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*BodyObject)->Values); It; ++It)
         {
-            Body.Add(It.Key(), FJsonKeeper(It.Value()));
+            Body.Emplace(It.Key(), It.Value());
         }
     }
 
@@ -24664,7 +43685,7 @@ bool PlayFab::ClientModels::FWriteClientCharacterEventRequest::readFromValue(con
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -24683,12 +43704,68 @@ bool PlayFab::ClientModels::FWriteClientCharacterEventRequest::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FWriteClientCharacterEventRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Body"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    Body.Add(reader.GetFieldName()).readFromReader(reader);
+                }
+            }
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EventName"))
+        {
+            reader.ReadValue(EventName);
+        }
+        else if (reader.IsField("Timestamp"))
+        {
+            reader.ReadValue(Timestamp);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FWriteClientCharacterEventRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FWriteClientPlayerEventRequest::~FWriteClientPlayerEventRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FWriteClientPlayerEventRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FWriteClientPlayerEventRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -24733,6 +43810,16 @@ void PlayFab::ClientModels::FWriteClientPlayerEventRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FWriteClientPlayerEventRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FWriteClientPlayerEventRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FWriteClientPlayerEventRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -24742,7 +43829,7 @@ bool PlayFab::ClientModels::FWriteClientPlayerEventRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*BodyObject)->Values); It; ++It)
         {
-            Body.Add(It.Key(), FJsonKeeper(It.Value()));
+            Body.Emplace(It.Key(), It.Value());
         }
     }
 
@@ -24751,7 +43838,7 @@ bool PlayFab::ClientModels::FWriteClientPlayerEventRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -24770,12 +43857,64 @@ bool PlayFab::ClientModels::FWriteClientPlayerEventRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FWriteClientPlayerEventRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Body"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    Body.Add(reader.GetFieldName()).readFromReader(reader);
+                }
+            }
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EventName"))
+        {
+            reader.ReadValue(EventName);
+        }
+        else if (reader.IsField("Timestamp"))
+        {
+            reader.ReadValue(Timestamp);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FWriteClientPlayerEventRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FWriteEventResponse::~FWriteEventResponse()
 {
 
 }
 
-void PlayFab::ClientModels::FWriteEventResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FWriteEventResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -24788,6 +43927,16 @@ void PlayFab::ClientModels::FWriteEventResponse::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FWriteEventResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FWriteEventResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FWriteEventResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -24802,12 +43951,39 @@ bool PlayFab::ClientModels::FWriteEventResponse::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FWriteEventResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("EventId"))
+        {
+            reader.ReadValue(EventId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FWriteEventResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ClientModels::FWriteTitleEventRequest::~FWriteTitleEventRequest()
 {
 
 }
 
-void PlayFab::ClientModels::FWriteTitleEventRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ClientModels::FWriteTitleEventRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -24852,6 +44028,16 @@ void PlayFab::ClientModels::FWriteTitleEventRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ClientModels::FWriteTitleEventRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ClientModels::FWriteTitleEventRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ClientModels::FWriteTitleEventRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -24861,7 +44047,7 @@ bool PlayFab::ClientModels::FWriteTitleEventRequest::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*BodyObject)->Values); It; ++It)
         {
-            Body.Add(It.Key(), FJsonKeeper(It.Value()));
+            Body.Emplace(It.Key(), It.Value());
         }
     }
 
@@ -24870,7 +44056,7 @@ bool PlayFab::ClientModels::FWriteTitleEventRequest::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -24889,3 +44075,54 @@ bool PlayFab::ClientModels::FWriteTitleEventRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ClientModels::FWriteTitleEventRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Body"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    Body.Add(reader.GetFieldName()).readFromReader(reader);
+                }
+            }
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EventName"))
+        {
+            reader.ReadValue(EventName);
+        }
+        else if (reader.IsField("Timestamp"))
+        {
+            reader.ReadValue(Timestamp);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FWriteTitleEventRequest();
+        return false;
+    }
+    return true;
+}
+
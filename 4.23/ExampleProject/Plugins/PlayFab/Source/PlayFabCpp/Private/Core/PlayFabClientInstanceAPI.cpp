@@ -85,7 +85,8 @@ bool UPlayFabClientInstanceAPI::IsClientLoggedIn()
 bool UPlayFabClientInstanceAPI::AcceptTrade(
     ClientModels::FAcceptTradeRequest& request,
     const FAcceptTradeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -94,29 +95,32 @@ bool UPlayFabClientInstanceAPI::AcceptTrade(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AcceptTrade"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnAcceptTradeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AcceptTrade"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnAcceptTradeResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FAcceptTradeResponse>> UPlayFabClientInstanceAPI::AcceptTradeAsync(ClientModels::FAcceptTradeRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FAcceptTradeResponse, FAcceptTradeDelegate>([this, &request, &Handle](const FAcceptTradeDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::AcceptTrade(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnAcceptTradeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAcceptTradeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FAcceptTradeResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FAcceptTradeResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FAcceptTradeResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::AddFriend(
     ClientModels::FAddFriendRequest& request,
     const FAddFriendDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -125,29 +129,32 @@ bool UPlayFabClientInstanceAPI::AddFriend(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AddFriend"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnAddFriendResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AddFriend"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnAddFriendResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FAddFriendResult>> UPlayFabClientInstanceAPI::AddFriendAsync(ClientModels::FAddFriendRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FAddFriendResult, FAddFriendDelegate>([this, &request, &Handle](const FAddFriendDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::AddFriend(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnAddFriendResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddFriendDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FAddFriendResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FAddFriendResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FAddFriendResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::AddGenericID(
     ClientModels::FAddGenericIDRequest& request,
     const FAddGenericIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -156,29 +163,32 @@ bool UPlayFabClientInstanceAPI::AddGenericID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AddGenericID"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnAddGenericIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AddGenericID"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnAddGenericIDResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FAddGenericIDResult>> UPlayFabClientInstanceAPI::AddGenericIDAsync(ClientModels::FAddGenericIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FAddGenericIDResult, FAddGenericIDDelegate>([this, &request, &Handle](const FAddGenericIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::AddGenericID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnAddGenericIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddGenericIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FAddGenericIDResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FAddGenericIDResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FAddGenericIDResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::AddOrUpdateContactEmail(
     ClientModels::FAddOrUpdateContactEmailRequest& request,
     const FAddOrUpdateContactEmailDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -187,29 +197,32 @@ bool UPlayFabClientInstanceAPI::AddOrUpdateContactEmail(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AddOrUpdateContactEmail"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnAddOrUpdateContactEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AddOrUpdateContactEmail"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnAddOrUpdateContactEmailResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FAddOrUpdateContactEmailResult>> UPlayFabClientInstanceAPI::AddOrUpdateContactEmailAsync(ClientModels::FAddOrUpdateContactEmailRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FAddOrUpdateContactEmailResult, FAddOrUpdateContactEmailDelegate>([this, &request, &Handle](const FAddOrUpdateContactEmailDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::AddOrUpdateContactEmail(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnAddOrUpdateContactEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddOrUpdateContactEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FAddOrUpdateContactEmailResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FAddOrUpdateContactEmailResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FAddOrUpdateContactEmailResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::AddSharedGroupMembers(
     ClientModels::FAddSharedGroupMembersRequest& request,
     const FAddSharedGroupMembersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -218,29 +231,32 @@ bool UPlayFabClientInstanceAPI::AddSharedGroupMembers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AddSharedGroupMembers"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnAddSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AddSharedGroupMembers"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnAddSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FAddSharedGroupMembersResult>> UPlayFabClientInstanceAPI::AddSharedGroupMembersAsync(ClientModels::FAddSharedGroupMembersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FAddSharedGroupMembersResult, FAddSharedGroupMembersDelegate>([this, &request, &Handle](const FAddSharedGroupMembersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::AddSharedGroupMembers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnAddSharedGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddSharedGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FAddSharedGroupMembersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FAddSharedGroupMembersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FAddSharedGroupMembersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::AddUsernamePassword(
     ClientModels::FAddUsernamePasswordRequest& request,
     const FAddUsernamePasswordDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -249,29 +265,32 @@ bool UPlayFabClientInstanceAPI::AddUsernamePassword(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AddUsernamePassword"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnAddUsernamePasswordResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AddUsernamePassword"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnAddUsernamePasswordResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FAddUsernamePasswordResult>> UPlayFabClientInstanceAPI::AddUsernamePasswordAsync(ClientModels::FAddUsernamePasswordRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FAddUsernamePasswordResult, FAddUsernamePasswordDelegate>([this, &request, &Handle](const FAddUsernamePasswordDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::AddUsernamePassword(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnAddUsernamePasswordResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddUsernamePasswordDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FAddUsernamePasswordResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FAddUsernamePasswordResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FAddUsernamePasswordResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::AddUserVirtualCurrency(
     ClientModels::FAddUserVirtualCurrencyRequest& request,
     const FAddUserVirtualCurrencyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -280,29 +299,32 @@ bool UPlayFabClientInstanceAPI::AddUserVirtualCurrency(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AddUserVirtualCurrency"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnAddUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AddUserVirtualCurrency"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnAddUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FModifyUserVirtualCurrencyResult>> UPlayFabClientInstanceAPI::AddUserVirtualCurrencyAsync(ClientModels::FAddUserVirtualCurrencyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FModifyUserVirtualCurrencyResult, FAddUserVirtualCurrencyDelegate>([this, &request, &Handle](const FAddUserVirtualCurrencyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::AddUserVirtualCurrency(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnAddUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FModifyUserVirtualCurrencyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FModifyUserVirtualCurrencyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FModifyUserVirtualCurrencyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::AndroidDevicePushNotificationRegistration(
     ClientModels::FAndroidDevicePushNotificationRegistrationRequest& request,
     const FAndroidDevicePushNotificationRegistrationDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -311,29 +333,32 @@ bool UPlayFabClientInstanceAPI::AndroidDevicePushNotificationRegistration(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AndroidDevicePushNotificationRegistration"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnAndroidDevicePushNotificationRegistrationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/AndroidDevicePushNotificationRegistration"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnAndroidDevicePushNotificationRegistrationResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FAndroidDevicePushNotificationRegistrationResult>> UPlayFabClientInstanceAPI::AndroidDevicePushNotificationRegistrationAsync(ClientModels::FAndroidDevicePushNotificationRegistrationRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FAndroidDevicePushNotificationRegistrationResult, FAndroidDevicePushNotificationRegistrationDelegate>([this, &request, &Handle](const FAndroidDevicePushNotificationRegistrationDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::AndroidDevicePushNotificationRegistration(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnAndroidDevicePushNotificationRegistrationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAndroidDevicePushNotificationRegistrationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FAndroidDevicePushNotificationRegistrationResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FAndroidDevicePushNotificationRegistrationResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FAndroidDevicePushNotificationRegistrationResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::CancelTrade(
     ClientModels::FCancelTradeRequest& request,
     const FCancelTradeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -342,29 +367,32 @@ bool UPlayFabClientInstanceAPI::CancelTrade(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/CancelTrade"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnCancelTradeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/CancelTrade"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnCancelTradeResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FCancelTradeResponse>> UPlayFabClientInstanceAPI::CancelTradeAsync(ClientModels::FCancelTradeRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FCancelTradeResponse, FCancelTradeDelegate>([this, &request, &Handle](const FCancelTradeDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::CancelTrade(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnCancelTradeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCancelTradeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FCancelTradeResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FCancelTradeResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FCancelTradeResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::ConfirmPurchase(
     ClientModels::FConfirmPurchaseRequest& request,
     const FConfirmPurchaseDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -373,29 +401,32 @@ bool UPlayFabClientInstanceAPI::ConfirmPurchase(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ConfirmPurchase"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnConfirmPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ConfirmPurchase"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnConfirmPurchaseResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FConfirmPurchaseResult>> UPlayFabClientInstanceAPI::ConfirmPurchaseAsync(ClientModels::FConfirmPurchaseRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FConfirmPurchaseResult, FConfirmPurchaseDelegate>([this, &request, &Handle](const FConfirmPurchaseDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::ConfirmPurchase(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnConfirmPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConfirmPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FConfirmPurchaseResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FConfirmPurchaseResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FConfirmPurchaseResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::ConsumeItem(
     ClientModels::FConsumeItemRequest& request,
     const FConsumeItemDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -404,29 +435,32 @@ bool UPlayFabClientInstanceAPI::ConsumeItem(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ConsumeItem"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnConsumeItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ConsumeItem"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnConsumeItemResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FConsumeItemResult>> UPlayFabClientInstanceAPI::ConsumeItemAsync(ClientModels::FConsumeItemRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FConsumeItemResult, FConsumeItemDelegate>([this, &request, &Handle](const FConsumeItemDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::ConsumeItem(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnConsumeItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumeItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FConsumeItemResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FConsumeItemResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FConsumeItemResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::ConsumeMicrosoftStoreEntitlements(
     ClientModels::FConsumeMicrosoftStoreEntitlementsRequest& request,
     const FConsumeMicrosoftStoreEntitlementsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -435,29 +469,32 @@ bool UPlayFabClientInstanceAPI::ConsumeMicrosoftStoreEntitlements(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ConsumeMicrosoftStoreEntitlements"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnConsumeMicrosoftStoreEntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ConsumeMicrosoftStoreEntitlements"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnConsumeMicrosoftStoreEntitlementsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FConsumeMicrosoftStoreEntitlementsResponse>> UPlayFabClientInstanceAPI::ConsumeMicrosoftStoreEntitlementsAsync(ClientModels::FConsumeMicrosoftStoreEntitlementsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FConsumeMicrosoftStoreEntitlementsResponse, FConsumeMicrosoftStoreEntitlementsDelegate>([this, &request, &Handle](const FConsumeMicrosoftStoreEntitlementsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::ConsumeMicrosoftStoreEntitlements(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnConsumeMicrosoftStoreEntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumeMicrosoftStoreEntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FConsumeMicrosoftStoreEntitlementsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FConsumeMicrosoftStoreEntitlementsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FConsumeMicrosoftStoreEntitlementsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::ConsumePS5Entitlements(
     ClientModels::FConsumePS5EntitlementsRequest& request,
     const FConsumePS5EntitlementsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -466,29 +503,32 @@ bool UPlayFabClientInstanceAPI::ConsumePS5Entitlements(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ConsumePS5Entitlements"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnConsumePS5EntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ConsumePS5Entitlements"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnConsumePS5EntitlementsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FConsumePS5EntitlementsResult>> UPlayFabClientInstanceAPI::ConsumePS5EntitlementsAsync(ClientModels::FConsumePS5EntitlementsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FConsumePS5EntitlementsResult, FConsumePS5EntitlementsDelegate>([this, &request, &Handle](const FConsumePS5EntitlementsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::ConsumePS5Entitlements(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnConsumePS5EntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumePS5EntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FConsumePS5EntitlementsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FConsumePS5EntitlementsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FConsumePS5EntitlementsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::ConsumePSNEntitlements(
     ClientModels::FConsumePSNEntitlementsRequest& request,
     const FConsumePSNEntitlementsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -497,29 +537,32 @@ bool UPlayFabClientInstanceAPI::ConsumePSNEntitlements(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ConsumePSNEntitlements"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnConsumePSNEntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ConsumePSNEntitlements"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnConsumePSNEntitlementsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FConsumePSNEntitlementsResult>> UPlayFabClientInstanceAPI::ConsumePSNEntitlementsAsync(ClientModels::FConsumePSNEntitlementsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FConsumePSNEntitlementsResult, FConsumePSNEntitlementsDelegate>([this, &request, &Handle](const FConsumePSNEntitlementsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::ConsumePSNEntitlements(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnConsumePSNEntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumePSNEntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FConsumePSNEntitlementsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FConsumePSNEntitlementsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FConsumePSNEntitlementsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::ConsumeXboxEntitlements(
     ClientModels::FConsumeXboxEntitlementsRequest& request,
     const FConsumeXboxEntitlementsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -528,29 +571,32 @@ bool UPlayFabClientInstanceAPI::ConsumeXboxEntitlements(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ConsumeXboxEntitlements"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnConsumeXboxEntitlementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ConsumeXboxEntitlements"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnConsumeXboxEntitlementsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FConsumeXboxEntitlementsResult>> UPlayFabClientInstanceAPI::ConsumeXboxEntitlementsAsync(ClientModels::FConsumeXboxEntitlementsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FConsumeXboxEntitlementsResult, FConsumeXboxEntitlementsDelegate>([this, &request, &Handle](const FConsumeXboxEntitlementsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::ConsumeXboxEntitlements(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnConsumeXboxEntitlementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumeXboxEntitlementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FConsumeXboxEntitlementsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FConsumeXboxEntitlementsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FConsumeXboxEntitlementsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::CreateSharedGroup(
     ClientModels::FCreateSharedGroupRequest& request,
     const FCreateSharedGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -559,29 +605,32 @@ bool UPlayFabClientInstanceAPI::CreateSharedGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/CreateSharedGroup"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnCreateSharedGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/CreateSharedGroup"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnCreateSharedGroupResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FCreateSharedGroupResult>> UPlayFabClientInstanceAPI::CreateSharedGroupAsync(ClientModels::FCreateSharedGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FCreateSharedGroupResult, FCreateSharedGroupDelegate>([this, &request, &Handle](const FCreateSharedGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::CreateSharedGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnCreateSharedGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateSharedGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FCreateSharedGroupResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FCreateSharedGroupResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FCreateSharedGroupResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::ExecuteCloudScript(
     ClientModels::FExecuteCloudScriptRequest& request,
     const FExecuteCloudScriptDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -590,29 +639,32 @@ bool UPlayFabClientInstanceAPI::ExecuteCloudScript(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ExecuteCloudScript"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnExecuteCloudScriptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ExecuteCloudScript"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnExecuteCloudScriptResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FExecuteCloudScriptResult>> UPlayFabClientInstanceAPI::ExecuteCloudScriptAsync(ClientModels::FExecuteCloudScriptRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FExecuteCloudScriptResult, FExecuteCloudScriptDelegate>([this, &request, &Handle](const FExecuteCloudScriptDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::ExecuteCloudScript(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnExecuteCloudScriptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExecuteCloudScriptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FExecuteCloudScriptResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FExecuteCloudScriptResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FExecuteCloudScriptResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetAccountInfo(
     ClientModels::FGetAccountInfoRequest& request,
     const FGetAccountInfoDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -621,29 +673,32 @@ bool UPlayFabClientInstanceAPI::GetAccountInfo(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetAccountInfo"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetAccountInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetAccountInfo"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetAccountInfoResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetAccountInfoResult>> UPlayFabClientInstanceAPI::GetAccountInfoAsync(ClientModels::FGetAccountInfoRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetAccountInfoResult, FGetAccountInfoDelegate>([this, &request, &Handle](const FGetAccountInfoDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetAccountInfo(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetAccountInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAccountInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetAccountInfoResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetAccountInfoResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetAccountInfoResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetAdPlacements(
     ClientModels::FGetAdPlacementsRequest& request,
     const FGetAdPlacementsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -652,29 +707,32 @@ bool UPlayFabClientInstanceAPI::GetAdPlacements(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetAdPlacements"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetAdPlacementsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetAdPlacements"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetAdPlacementsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetAdPlacementsResult>> UPlayFabClientInstanceAPI::GetAdPlacementsAsync(ClientModels::FGetAdPlacementsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetAdPlacementsResult, FGetAdPlacementsDelegate>([this, &request, &Handle](const FGetAdPlacementsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetAdPlacements(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetAdPlacementsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAdPlacementsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetAdPlacementsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetAdPlacementsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetAdPlacementsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetAllUsersCharacters(
     ClientModels::FListUsersCharactersRequest& request,
     const FGetAllUsersCharactersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -683,29 +741,32 @@ bool UPlayFabClientInstanceAPI::GetAllUsersCharacters(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetAllUsersCharacters"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetAllUsersCharactersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetAllUsersCharacters"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetAllUsersCharactersResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FListUsersCharactersResult>> UPlayFabClientInstanceAPI::GetAllUsersCharactersAsync(ClientModels::FListUsersCharactersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FListUsersCharactersResult, FGetAllUsersCharactersDelegate>([this, &request, &Handle](const FGetAllUsersCharactersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetAllUsersCharacters(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetAllUsersCharactersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAllUsersCharactersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FListUsersCharactersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FListUsersCharactersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FListUsersCharactersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetCatalogItems(
     ClientModels::FGetCatalogItemsRequest& request,
     const FGetCatalogItemsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -714,29 +775,32 @@ bool UPlayFabClientInstanceAPI::GetCatalogItems(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCatalogItems"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCatalogItems"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetCatalogItemsResult>> UPlayFabClientInstanceAPI::GetCatalogItemsAsync(ClientModels::FGetCatalogItemsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetCatalogItemsResult, FGetCatalogItemsDelegate>([this, &request, &Handle](const FGetCatalogItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetCatalogItems(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetCatalogItemsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetCatalogItemsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetCatalogItemsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetCharacterData(
     ClientModels::FGetCharacterDataRequest& request,
     const FGetCharacterDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -745,29 +809,32 @@ bool UPlayFabClientInstanceAPI::GetCharacterData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCharacterData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetCharacterDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCharacterData"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetCharacterDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetCharacterDataResult>> UPlayFabClientInstanceAPI::GetCharacterDataAsync(ClientModels::FGetCharacterDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetCharacterDataResult, FGetCharacterDataDelegate>([this, &request, &Handle](const FGetCharacterDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetCharacterData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetCharacterDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetCharacterDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetCharacterDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetCharacterDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetCharacterInventory(
     ClientModels::FGetCharacterInventoryRequest& request,
     const FGetCharacterInventoryDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -776,29 +843,32 @@ bool UPlayFabClientInstanceAPI::GetCharacterInventory(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCharacterInventory"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetCharacterInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCharacterInventory"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetCharacterInventoryResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetCharacterInventoryResult>> UPlayFabClientInstanceAPI::GetCharacterInventoryAsync(ClientModels::FGetCharacterInventoryRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetCharacterInventoryResult, FGetCharacterInventoryDelegate>([this, &request, &Handle](const FGetCharacterInventoryDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetCharacterInventory(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetCharacterInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetCharacterInventoryResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetCharacterInventoryResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetCharacterInventoryResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetCharacterLeaderboard(
     ClientModels::FGetCharacterLeaderboardRequest& request,
     const FGetCharacterLeaderboardDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -807,29 +877,32 @@ bool UPlayFabClientInstanceAPI::GetCharacterLeaderboard(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCharacterLeaderboard"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetCharacterLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCharacterLeaderboard"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetCharacterLeaderboardResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetCharacterLeaderboardResult>> UPlayFabClientInstanceAPI::GetCharacterLeaderboardAsync(ClientModels::FGetCharacterLeaderboardRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetCharacterLeaderboardResult, FGetCharacterLeaderboardDelegate>([this, &request, &Handle](const FGetCharacterLeaderboardDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetCharacterLeaderboard(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetCharacterLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetCharacterLeaderboardResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetCharacterLeaderboardResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetCharacterLeaderboardResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetCharacterReadOnlyData(
     ClientModels::FGetCharacterDataRequest& request,
     const FGetCharacterReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -838,29 +911,32 @@ bool UPlayFabClientInstanceAPI::GetCharacterReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCharacterReadOnlyData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetCharacterReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCharacterReadOnlyData"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetCharacterReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetCharacterDataResult>> UPlayFabClientInstanceAPI::GetCharacterReadOnlyDataAsync(ClientModels::FGetCharacterDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetCharacterDataResult, FGetCharacterReadOnlyDataDelegate>([this, &request, &Handle](const FGetCharacterReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetCharacterReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetCharacterReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetCharacterDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetCharacterDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetCharacterDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetCharacterStatistics(
     ClientModels::FGetCharacterStatisticsRequest& request,
     const FGetCharacterStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -869,29 +945,32 @@ bool UPlayFabClientInstanceAPI::GetCharacterStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCharacterStatistics"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCharacterStatistics"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetCharacterStatisticsResult>> UPlayFabClientInstanceAPI::GetCharacterStatisticsAsync(ClientModels::FGetCharacterStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetCharacterStatisticsResult, FGetCharacterStatisticsDelegate>([this, &request, &Handle](const FGetCharacterStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetCharacterStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetCharacterStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetCharacterStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetCharacterStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetContentDownloadUrl(
     ClientModels::FGetContentDownloadUrlRequest& request,
     const FGetContentDownloadUrlDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -900,29 +979,32 @@ bool UPlayFabClientInstanceAPI::GetContentDownloadUrl(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetContentDownloadUrl"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetContentDownloadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetContentDownloadUrl"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetContentDownloadUrlResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetContentDownloadUrlResult>> UPlayFabClientInstanceAPI::GetContentDownloadUrlAsync(ClientModels::FGetContentDownloadUrlRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetContentDownloadUrlResult, FGetContentDownloadUrlDelegate>([this, &request, &Handle](const FGetContentDownloadUrlDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetContentDownloadUrl(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetContentDownloadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContentDownloadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetContentDownloadUrlResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetContentDownloadUrlResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetContentDownloadUrlResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetCurrentGames(
     ClientModels::FCurrentGamesRequest& request,
     const FGetCurrentGamesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -931,29 +1013,32 @@ bool UPlayFabClientInstanceAPI::GetCurrentGames(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCurrentGames"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetCurrentGamesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetCurrentGames"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetCurrentGamesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FCurrentGamesResult>> UPlayFabClientInstanceAPI::GetCurrentGamesAsync(ClientModels::FCurrentGamesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FCurrentGamesResult, FGetCurrentGamesDelegate>([this, &request, &Handle](const FGetCurrentGamesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetCurrentGames(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetCurrentGamesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCurrentGamesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FCurrentGamesResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FCurrentGamesResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FCurrentGamesResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetFriendLeaderboard(
     ClientModels::FGetFriendLeaderboardRequest& request,
     const FGetFriendLeaderboardDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -962,29 +1047,32 @@ bool UPlayFabClientInstanceAPI::GetFriendLeaderboard(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetFriendLeaderboard"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetFriendLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetFriendLeaderboard"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetFriendLeaderboardResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetLeaderboardResult>> UPlayFabClientInstanceAPI::GetFriendLeaderboardAsync(ClientModels::FGetFriendLeaderboardRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetLeaderboardResult, FGetFriendLeaderboardDelegate>([this, &request, &Handle](const FGetFriendLeaderboardDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetFriendLeaderboard(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetFriendLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetLeaderboardResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetLeaderboardResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetLeaderboardResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetFriendLeaderboardAroundPlayer(
     ClientModels::FGetFriendLeaderboardAroundPlayerRequest& request,
     const FGetFriendLeaderboardAroundPlayerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -993,29 +1081,32 @@ bool UPlayFabClientInstanceAPI::GetFriendLeaderboardAroundPlayer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetFriendLeaderboardAroundPlayer"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetFriendLeaderboardAroundPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetFriendLeaderboardAroundPlayer"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetFriendLeaderboardAroundPlayerResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetFriendLeaderboardAroundPlayerResult>> UPlayFabClientInstanceAPI::GetFriendLeaderboardAroundPlayerAsync(ClientModels::FGetFriendLeaderboardAroundPlayerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetFriendLeaderboardAroundPlayerResult, FGetFriendLeaderboardAroundPlayerDelegate>([this, &request, &Handle](const FGetFriendLeaderboardAroundPlayerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetFriendLeaderboardAroundPlayer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetFriendLeaderboardAroundPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendLeaderboardAroundPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetFriendLeaderboardAroundPlayerResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetFriendLeaderboardAroundPlayerResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetFriendLeaderboardAroundPlayerResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetFriendsList(
     ClientModels::FGetFriendsListRequest& request,
     const FGetFriendsListDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1024,29 +1115,32 @@ bool UPlayFabClientInstanceAPI::GetFriendsList(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetFriendsList"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetFriendsListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetFriendsList"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetFriendsListResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetFriendsListResult>> UPlayFabClientInstanceAPI::GetFriendsListAsync(ClientModels::FGetFriendsListRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetFriendsListResult, FGetFriendsListDelegate>([this, &request, &Handle](const FGetFriendsListDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetFriendsList(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetFriendsListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendsListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetFriendsListResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetFriendsListResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetFriendsListResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetGameServerRegions(
     ClientModels::FGameServerRegionsRequest& request,
     const FGetGameServerRegionsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1055,29 +1149,32 @@ bool UPlayFabClientInstanceAPI::GetGameServerRegions(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetGameServerRegions"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetGameServerRegionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetGameServerRegions"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetGameServerRegionsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGameServerRegionsResult>> UPlayFabClientInstanceAPI::GetGameServerRegionsAsync(ClientModels::FGameServerRegionsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGameServerRegionsResult, FGetGameServerRegionsDelegate>([this, &request, &Handle](const FGetGameServerRegionsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetGameServerRegions(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetGameServerRegionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetGameServerRegionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGameServerRegionsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGameServerRegionsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGameServerRegionsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetLeaderboard(
     ClientModels::FGetLeaderboardRequest& request,
     const FGetLeaderboardDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1086,29 +1183,32 @@ bool UPlayFabClientInstanceAPI::GetLeaderboard(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetLeaderboard"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetLeaderboard"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetLeaderboardResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetLeaderboardResult>> UPlayFabClientInstanceAPI::GetLeaderboardAsync(ClientModels::FGetLeaderboardRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetLeaderboardResult, FGetLeaderboardDelegate>([this, &request, &Handle](const FGetLeaderboardDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetLeaderboard(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetLeaderboardResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetLeaderboardResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetLeaderboardResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetLeaderboardAroundCharacter(
     ClientModels::FGetLeaderboardAroundCharacterRequest& request,
     const FGetLeaderboardAroundCharacterDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1117,29 +1217,32 @@ bool UPlayFabClientInstanceAPI::GetLeaderboardAroundCharacter(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetLeaderboardAroundCharacter"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetLeaderboardAroundCharacterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetLeaderboardAroundCharacter"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetLeaderboardAroundCharacterResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetLeaderboardAroundCharacterResult>> UPlayFabClientInstanceAPI::GetLeaderboardAroundCharacterAsync(ClientModels::FGetLeaderboardAroundCharacterRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetLeaderboardAroundCharacterResult, FGetLeaderboardAroundCharacterDelegate>([this, &request, &Handle](const FGetLeaderboardAroundCharacterDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetLeaderboardAroundCharacter(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetLeaderboardAroundCharacterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardAroundCharacterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetLeaderboardAroundCharacterResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetLeaderboardAroundCharacterResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetLeaderboardAroundCharacterResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetLeaderboardAroundPlayer(
     ClientModels::FGetLeaderboardAroundPlayerRequest& request,
     const FGetLeaderboardAroundPlayerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1148,29 +1251,32 @@ bool UPlayFabClientInstanceAPI::GetLeaderboardAroundPlayer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetLeaderboardAroundPlayer"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetLeaderboardAroundPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetLeaderboardAroundPlayer"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetLeaderboardAroundPlayerResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetLeaderboardAroundPlayerResult>> UPlayFabClientInstanceAPI::GetLeaderboardAroundPlayerAsync(ClientModels::FGetLeaderboardAroundPlayerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetLeaderboardAroundPlayerResult, FGetLeaderboardAroundPlayerDelegate>([this, &request, &Handle](const FGetLeaderboardAroundPlayerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetLeaderboardAroundPlayer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetLeaderboardAroundPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardAroundPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetLeaderboardAroundPlayerResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetLeaderboardAroundPlayerResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetLeaderboardAroundPlayerResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetLeaderboardForUserCharacters(
     ClientModels::FGetLeaderboardForUsersCharactersRequest& request,
     const FGetLeaderboardForUserCharactersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1179,29 +1285,32 @@ bool UPlayFabClientInstanceAPI::GetLeaderboardForUserCharacters(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetLeaderboardForUserCharacters"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetLeaderboardForUserCharactersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetLeaderboardForUserCharacters"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetLeaderboardForUserCharactersResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetLeaderboardForUsersCharactersResult>> UPlayFabClientInstanceAPI::GetLeaderboardForUserCharactersAsync(ClientModels::FGetLeaderboardForUsersCharactersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetLeaderboardForUsersCharactersResult, FGetLeaderboardForUserCharactersDelegate>([this, &request, &Handle](const FGetLeaderboardForUserCharactersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetLeaderboardForUserCharacters(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetLeaderboardForUserCharactersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardForUserCharactersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetLeaderboardForUsersCharactersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetLeaderboardForUsersCharactersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetLeaderboardForUsersCharactersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPaymentToken(
     ClientModels::FGetPaymentTokenRequest& request,
     const FGetPaymentTokenDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1210,29 +1319,32 @@ bool UPlayFabClientInstanceAPI::GetPaymentToken(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPaymentToken"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPaymentTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPaymentToken"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPaymentTokenResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPaymentTokenResult>> UPlayFabClientInstanceAPI::GetPaymentTokenAsync(ClientModels::FGetPaymentTokenRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPaymentTokenResult, FGetPaymentTokenDelegate>([this, &request, &Handle](const FGetPaymentTokenDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPaymentToken(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPaymentTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPaymentTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPaymentTokenResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPaymentTokenResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPaymentTokenResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPhotonAuthenticationToken(
     ClientModels::FGetPhotonAuthenticationTokenRequest& request,
     const FGetPhotonAuthenticationTokenDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1241,29 +1353,32 @@ bool UPlayFabClientInstanceAPI::GetPhotonAuthenticationToken(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPhotonAuthenticationToken"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPhotonAuthenticationTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPhotonAuthenticationToken"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPhotonAuthenticationTokenResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPhotonAuthenticationTokenResult>> UPlayFabClientInstanceAPI::GetPhotonAuthenticationTokenAsync(ClientModels::FGetPhotonAuthenticationTokenRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPhotonAuthenticationTokenResult, FGetPhotonAuthenticationTokenDelegate>([this, &request, &Handle](const FGetPhotonAuthenticationTokenDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPhotonAuthenticationToken(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPhotonAuthenticationTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPhotonAuthenticationTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPhotonAuthenticationTokenResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPhotonAuthenticationTokenResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPhotonAuthenticationTokenResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayerCombinedInfo(
     ClientModels::FGetPlayerCombinedInfoRequest& request,
     const FGetPlayerCombinedInfoDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1272,29 +1387,32 @@ bool UPlayFabClientInstanceAPI::GetPlayerCombinedInfo(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerCombinedInfo"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayerCombinedInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerCombinedInfo"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPlayerCombinedInfoResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayerCombinedInfoResult>> UPlayFabClientInstanceAPI::GetPlayerCombinedInfoAsync(ClientModels::FGetPlayerCombinedInfoRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayerCombinedInfoResult, FGetPlayerCombinedInfoDelegate>([this, &request, &Handle](const FGetPlayerCombinedInfoDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPlayerCombinedInfo(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayerCombinedInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerCombinedInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayerCombinedInfoResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayerCombinedInfoResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayerCombinedInfoResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayerProfile(
     ClientModels::FGetPlayerProfileRequest& request,
     const FGetPlayerProfileDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1303,37 +1421,41 @@ bool UPlayFabClientInstanceAPI::GetPlayerProfile(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerProfile"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayerProfileResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerProfile"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPlayerProfileResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayerProfileResult>> UPlayFabClientInstanceAPI::GetPlayerProfileAsync(ClientModels::FGetPlayerProfileRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayerProfileResult, FGetPlayerProfileDelegate>([this, &request, &Handle](const FGetPlayerProfileDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPlayerProfile(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayerProfileResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerProfileDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayerProfileResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayerProfileResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayerProfileResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayerSegments(
     const FGetPlayerSegmentsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 { 
     ClientModels::FGetPlayerSegmentsRequest emptyRequest = ClientModels::FGetPlayerSegmentsRequest();
-    return UPlayFabClientInstanceAPI::GetPlayerSegments(emptyRequest, SuccessDelegate, ErrorDelegate);
+    return UPlayFabClientInstanceAPI::GetPlayerSegments(emptyRequest, SuccessDelegate, ErrorDelegate, Handle);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayerSegments(
     ClientModels::FGetPlayerSegmentsRequest& request,
     const FGetPlayerSegmentsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1342,29 +1464,38 @@ bool UPlayFabClientInstanceAPI::GetPlayerSegments(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerSegments"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayerSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerSegments"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPlayerSegmentsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayerSegmentsResult>> UPlayFabClientInstanceAPI::GetPlayerSegmentsAsync(const FPlayFabRequestHandle& Handle)
+{
+    ClientModels::FGetPlayerSegmentsRequest emptyRequest = ClientModels::FGetPlayerSegmentsRequest();
+    return UPlayFabClientInstanceAPI::GetPlayerSegmentsAsync(emptyRequest, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayerSegmentsResult>> UPlayFabClientInstanceAPI::GetPlayerSegmentsAsync(ClientModels::FGetPlayerSegmentsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayerSegmentsResult, FGetPlayerSegmentsDelegate>([this, &request, &Handle](const FGetPlayerSegmentsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPlayerSegments(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayerSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayerSegmentsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayerSegmentsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayerSegmentsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayerStatistics(
     ClientModels::FGetPlayerStatisticsRequest& request,
     const FGetPlayerStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1373,29 +1504,32 @@ bool UPlayFabClientInstanceAPI::GetPlayerStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerStatistics"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerStatistics"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayerStatisticsResult>> UPlayFabClientInstanceAPI::GetPlayerStatisticsAsync(ClientModels::FGetPlayerStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayerStatisticsResult, FGetPlayerStatisticsDelegate>([this, &request, &Handle](const FGetPlayerStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPlayerStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayerStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayerStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayerStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayerStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayerStatisticVersions(
     ClientModels::FGetPlayerStatisticVersionsRequest& request,
     const FGetPlayerStatisticVersionsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1404,29 +1538,32 @@ bool UPlayFabClientInstanceAPI::GetPlayerStatisticVersions(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerStatisticVersions"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayerStatisticVersionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerStatisticVersions"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPlayerStatisticVersionsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayerStatisticVersionsResult>> UPlayFabClientInstanceAPI::GetPlayerStatisticVersionsAsync(ClientModels::FGetPlayerStatisticVersionsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayerStatisticVersionsResult, FGetPlayerStatisticVersionsDelegate>([this, &request, &Handle](const FGetPlayerStatisticVersionsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPlayerStatisticVersions(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayerStatisticVersionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticVersionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayerStatisticVersionsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayerStatisticVersionsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayerStatisticVersionsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayerTags(
     ClientModels::FGetPlayerTagsRequest& request,
     const FGetPlayerTagsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1435,29 +1572,32 @@ bool UPlayFabClientInstanceAPI::GetPlayerTags(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerTags"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayerTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerTags"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPlayerTagsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayerTagsResult>> UPlayFabClientInstanceAPI::GetPlayerTagsAsync(ClientModels::FGetPlayerTagsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayerTagsResult, FGetPlayerTagsDelegate>([this, &request, &Handle](const FGetPlayerTagsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPlayerTags(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayerTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayerTagsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayerTagsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayerTagsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayerTrades(
     ClientModels::FGetPlayerTradesRequest& request,
     const FGetPlayerTradesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1466,29 +1606,32 @@ bool UPlayFabClientInstanceAPI::GetPlayerTrades(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerTrades"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayerTradesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayerTrades"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPlayerTradesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayerTradesResponse>> UPlayFabClientInstanceAPI::GetPlayerTradesAsync(ClientModels::FGetPlayerTradesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayerTradesResponse, FGetPlayerTradesDelegate>([this, &request, &Handle](const FGetPlayerTradesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPlayerTrades(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayerTradesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerTradesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayerTradesResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayerTradesResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayerTradesResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromFacebookIDs(
     ClientModels::FGetPlayFabIDsFromFacebookIDsRequest& request,
     const FGetPlayFabIDsFromFacebookIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1497,29 +1640,32 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromFacebookIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromFacebookIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromFacebookIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromFacebookIDs"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromFacebookIDsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromFacebookIDsResult>> UPlayFabClientInstanceAPI::GetPlayFabIDsFromFacebookIDsAsync(ClientModels::FGetPlayFabIDsFromFacebookIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromFacebookIDsResult, FGetPlayFabIDsFromFacebookIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromFacebookIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPlayFabIDsFromFacebookIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromFacebookIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromFacebookIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromFacebookIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromFacebookIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromFacebookIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
     ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& request,
     const FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1528,29 +1674,32 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromFacebookInstantGamesIds"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromFacebookInstantGamesIds"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult>> UPlayFabClientInstanceAPI::GetPlayFabIDsFromFacebookInstantGamesIdsAsync(ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult, FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPlayFabIDsFromFacebookInstantGamesIds(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromGameCenterIDs(
     ClientModels::FGetPlayFabIDsFromGameCenterIDsRequest& request,
     const FGetPlayFabIDsFromGameCenterIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1559,29 +1708,32 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromGameCenterIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromGameCenterIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGameCenterIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromGameCenterIDs"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGameCenterIDsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromGameCenterIDsResult>> UPlayFabClientInstanceAPI::GetPlayFabIDsFromGameCenterIDsAsync(ClientModels::FGetPlayFabIDsFromGameCenterIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromGameCenterIDsResult, FGetPlayFabIDsFromGameCenterIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromGameCenterIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPlayFabIDsFromGameCenterIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGameCenterIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGameCenterIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromGameCenterIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromGameCenterIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromGameCenterIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromGenericIDs(
     ClientModels::FGetPlayFabIDsFromGenericIDsRequest& request,
     const FGetPlayFabIDsFromGenericIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1590,29 +1742,32 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromGenericIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromGenericIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGenericIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromGenericIDs"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGenericIDsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromGenericIDsResult>> UPlayFabClientInstanceAPI::GetPlayFabIDsFromGenericIDsAsync(ClientModels::FGetPlayFabIDsFromGenericIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromGenericIDsResult, FGetPlayFabIDsFromGenericIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromGenericIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPlayFabIDsFromGenericIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGenericIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGenericIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromGenericIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromGenericIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromGenericIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromGoogleIDs(
     ClientModels::FGetPlayFabIDsFromGoogleIDsRequest& request,
     const FGetPlayFabIDsFromGoogleIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1621,29 +1776,32 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromGoogleIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromGoogleIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGoogleIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromGoogleIDs"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGoogleIDsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromGoogleIDsResult>> UPlayFabClientInstanceAPI::GetPlayFabIDsFromGoogleIDsAsync(ClientModels::FGetPlayFabIDsFromGoogleIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromGoogleIDsResult, FGetPlayFabIDsFromGoogleIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromGoogleIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPlayFabIDsFromGoogleIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromGoogleIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGoogleIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromGoogleIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromGoogleIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromGoogleIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromKongregateIDs(
     ClientModels::FGetPlayFabIDsFromKongregateIDsRequest& request,
     const FGetPlayFabIDsFromKongregateIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1652,29 +1810,32 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromKongregateIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromKongregateIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromKongregateIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromKongregateIDs"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromKongregateIDsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromKongregateIDsResult>> UPlayFabClientInstanceAPI::GetPlayFabIDsFromKongregateIDsAsync(ClientModels::FGetPlayFabIDsFromKongregateIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromKongregateIDsResult, FGetPlayFabIDsFromKongregateIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromKongregateIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPlayFabIDsFromKongregateIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromKongregateIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromKongregateIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromKongregateIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromKongregateIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromKongregateIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
     ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& request,
     const FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1683,29 +1844,32 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromNintendoSwitchDeviceIds"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromNintendoSwitchDeviceIds"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult>> UPlayFabClientInstanceAPI::GetPlayFabIDsFromNintendoSwitchDeviceIdsAsync(ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult, FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromPSNAccountIDs(
     ClientModels::FGetPlayFabIDsFromPSNAccountIDsRequest& request,
     const FGetPlayFabIDsFromPSNAccountIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1714,29 +1878,32 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromPSNAccountIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromPSNAccountIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromPSNAccountIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromPSNAccountIDs"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromPSNAccountIDsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult>> UPlayFabClientInstanceAPI::GetPlayFabIDsFromPSNAccountIDsAsync(ClientModels::FGetPlayFabIDsFromPSNAccountIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult, FGetPlayFabIDsFromPSNAccountIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromPSNAccountIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPlayFabIDsFromPSNAccountIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromPSNAccountIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromPSNAccountIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromPSNAccountIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromSteamIDs(
     ClientModels::FGetPlayFabIDsFromSteamIDsRequest& request,
     const FGetPlayFabIDsFromSteamIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1745,29 +1912,32 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromSteamIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromSteamIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromSteamIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromSteamIDs"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromSteamIDsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromSteamIDsResult>> UPlayFabClientInstanceAPI::GetPlayFabIDsFromSteamIDsAsync(ClientModels::FGetPlayFabIDsFromSteamIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromSteamIDsResult, FGetPlayFabIDsFromSteamIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromSteamIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPlayFabIDsFromSteamIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromSteamIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromSteamIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromSteamIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromSteamIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromSteamIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromTwitchIDs(
     ClientModels::FGetPlayFabIDsFromTwitchIDsRequest& request,
     const FGetPlayFabIDsFromTwitchIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1776,29 +1946,32 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromTwitchIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromTwitchIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromTwitchIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromTwitchIDs"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromTwitchIDsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromTwitchIDsResult>> UPlayFabClientInstanceAPI::GetPlayFabIDsFromTwitchIDsAsync(ClientModels::FGetPlayFabIDsFromTwitchIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromTwitchIDsResult, FGetPlayFabIDsFromTwitchIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromTwitchIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPlayFabIDsFromTwitchIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromTwitchIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromTwitchIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromTwitchIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromTwitchIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromTwitchIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromXboxLiveIDs(
     ClientModels::FGetPlayFabIDsFromXboxLiveIDsRequest& request,
     const FGetPlayFabIDsFromXboxLiveIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1807,29 +1980,32 @@ bool UPlayFabClientInstanceAPI::GetPlayFabIDsFromXboxLiveIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromXboxLiveIDs"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromXboxLiveIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPlayFabIDsFromXboxLiveIDs"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromXboxLiveIDsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult>> UPlayFabClientInstanceAPI::GetPlayFabIDsFromXboxLiveIDsAsync(ClientModels::FGetPlayFabIDsFromXboxLiveIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult, FGetPlayFabIDsFromXboxLiveIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromXboxLiveIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPlayFabIDsFromXboxLiveIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPlayFabIDsFromXboxLiveIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromXboxLiveIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPlayFabIDsFromXboxLiveIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPublisherData(
     ClientModels::FGetPublisherDataRequest& request,
     const FGetPublisherDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1838,29 +2014,32 @@ bool UPlayFabClientInstanceAPI::GetPublisherData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPublisherData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPublisherData"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPublisherDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPublisherDataResult>> UPlayFabClientInstanceAPI::GetPublisherDataAsync(ClientModels::FGetPublisherDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPublisherDataResult, FGetPublisherDataDelegate>([this, &request, &Handle](const FGetPublisherDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPublisherData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPublisherDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPublisherDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPublisherDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetPurchase(
     ClientModels::FGetPurchaseRequest& request,
     const FGetPurchaseDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1869,29 +2048,32 @@ bool UPlayFabClientInstanceAPI::GetPurchase(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPurchase"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetPurchase"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetPurchaseResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetPurchaseResult>> UPlayFabClientInstanceAPI::GetPurchaseAsync(ClientModels::FGetPurchaseRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetPurchaseResult, FGetPurchaseDelegate>([this, &request, &Handle](const FGetPurchaseDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetPurchase(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetPurchaseResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetPurchaseResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetPurchaseResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetSharedGroupData(
     ClientModels::FGetSharedGroupDataRequest& request,
     const FGetSharedGroupDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1900,29 +2082,32 @@ bool UPlayFabClientInstanceAPI::GetSharedGroupData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetSharedGroupData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetSharedGroupData"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetSharedGroupDataResult>> UPlayFabClientInstanceAPI::GetSharedGroupDataAsync(ClientModels::FGetSharedGroupDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetSharedGroupDataResult, FGetSharedGroupDataDelegate>([this, &request, &Handle](const FGetSharedGroupDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetSharedGroupData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetSharedGroupDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSharedGroupDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetSharedGroupDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetSharedGroupDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetSharedGroupDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetStoreItems(
     ClientModels::FGetStoreItemsRequest& request,
     const FGetStoreItemsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1931,37 +2116,41 @@ bool UPlayFabClientInstanceAPI::GetStoreItems(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetStoreItems"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetStoreItems"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetStoreItemsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetStoreItemsResult>> UPlayFabClientInstanceAPI::GetStoreItemsAsync(ClientModels::FGetStoreItemsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetStoreItemsResult, FGetStoreItemsDelegate>([this, &request, &Handle](const FGetStoreItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetStoreItems(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetStoreItemsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetStoreItemsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetStoreItemsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetTime(
     const FGetTimeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 { 
     ClientModels::FGetTimeRequest emptyRequest = ClientModels::FGetTimeRequest();
-    return UPlayFabClientInstanceAPI::GetTime(emptyRequest, SuccessDelegate, ErrorDelegate);
+    return UPlayFabClientInstanceAPI::GetTime(emptyRequest, SuccessDelegate, ErrorDelegate, Handle);
 }
 
 bool UPlayFabClientInstanceAPI::GetTime(
     ClientModels::FGetTimeRequest& request,
     const FGetTimeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -1970,29 +2159,38 @@ bool UPlayFabClientInstanceAPI::GetTime(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetTime"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetTimeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetTime"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetTimeResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetTimeResult>> UPlayFabClientInstanceAPI::GetTimeAsync(const FPlayFabRequestHandle& Handle)
+{
+    ClientModels::FGetTimeRequest emptyRequest = ClientModels::FGetTimeRequest();
+    return UPlayFabClientInstanceAPI::GetTimeAsync(emptyRequest, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetTimeResult>> UPlayFabClientInstanceAPI::GetTimeAsync(ClientModels::FGetTimeRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetTimeResult, FGetTimeDelegate>([this, &request, &Handle](const FGetTimeDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetTime(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetTimeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTimeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetTimeResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetTimeResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetTimeResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetTitleData(
     ClientModels::FGetTitleDataRequest& request,
     const FGetTitleDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2001,29 +2199,32 @@ bool UPlayFabClientInstanceAPI::GetTitleData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetTitleData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetTitleData"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetTitleDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetTitleDataResult>> UPlayFabClientInstanceAPI::GetTitleDataAsync(ClientModels::FGetTitleDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetTitleDataResult, FGetTitleDataDelegate>([this, &request, &Handle](const FGetTitleDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetTitleData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetTitleDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetTitleDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetTitleDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetTitleNews(
     ClientModels::FGetTitleNewsRequest& request,
     const FGetTitleNewsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2032,56 +2233,62 @@ bool UPlayFabClientInstanceAPI::GetTitleNews(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetTitleNews"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetTitleNewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetTitleNews"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetTitleNewsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetTitleNewsResult>> UPlayFabClientInstanceAPI::GetTitleNewsAsync(ClientModels::FGetTitleNewsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetTitleNewsResult, FGetTitleNewsDelegate>([this, &request, &Handle](const FGetTitleNewsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetTitleNews(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetTitleNewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleNewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetTitleNewsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetTitleNewsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetTitleNewsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetTitlePublicKey(
     ClientModels::FGetTitlePublicKeyRequest& request,
     const FGetTitlePublicKeyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetTitlePublicKey"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetTitlePublicKeyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetTitlePublicKey"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetTitlePublicKeyResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetTitlePublicKeyResult>> UPlayFabClientInstanceAPI::GetTitlePublicKeyAsync(ClientModels::FGetTitlePublicKeyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetTitlePublicKeyResult, FGetTitlePublicKeyDelegate>([this, &request, &Handle](const FGetTitlePublicKeyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetTitlePublicKey(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetTitlePublicKeyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitlePublicKeyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetTitlePublicKeyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetTitlePublicKeyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetTitlePublicKeyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetTradeStatus(
     ClientModels::FGetTradeStatusRequest& request,
     const FGetTradeStatusDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2090,29 +2297,32 @@ bool UPlayFabClientInstanceAPI::GetTradeStatus(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetTradeStatus"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetTradeStatusResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetTradeStatus"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetTradeStatusResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetTradeStatusResponse>> UPlayFabClientInstanceAPI::GetTradeStatusAsync(ClientModels::FGetTradeStatusRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetTradeStatusResponse, FGetTradeStatusDelegate>([this, &request, &Handle](const FGetTradeStatusDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetTradeStatus(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetTradeStatusResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTradeStatusDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetTradeStatusResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetTradeStatusResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetTradeStatusResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetUserData(
     ClientModels::FGetUserDataRequest& request,
     const FGetUserDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2121,29 +2331,32 @@ bool UPlayFabClientInstanceAPI::GetUserData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetUserData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetUserData"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetUserDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetUserDataResult>> UPlayFabClientInstanceAPI::GetUserDataAsync(ClientModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetUserDataResult, FGetUserDataDelegate>([this, &request, &Handle](const FGetUserDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetUserData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetUserInventory(
     ClientModels::FGetUserInventoryRequest& request,
     const FGetUserInventoryDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2152,29 +2365,32 @@ bool UPlayFabClientInstanceAPI::GetUserInventory(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetUserInventory"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetUserInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetUserInventory"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetUserInventoryResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetUserInventoryResult>> UPlayFabClientInstanceAPI::GetUserInventoryAsync(ClientModels::FGetUserInventoryRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetUserInventoryResult, FGetUserInventoryDelegate>([this, &request, &Handle](const FGetUserInventoryDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetUserInventory(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetUserInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetUserInventoryResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetUserInventoryResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetUserInventoryResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetUserPublisherData(
     ClientModels::FGetUserDataRequest& request,
     const FGetUserPublisherDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2183,29 +2399,32 @@ bool UPlayFabClientInstanceAPI::GetUserPublisherData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetUserPublisherData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetUserPublisherData"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetUserDataResult>> UPlayFabClientInstanceAPI::GetUserPublisherDataAsync(ClientModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetUserDataResult, FGetUserPublisherDataDelegate>([this, &request, &Handle](const FGetUserPublisherDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetUserPublisherData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetUserPublisherReadOnlyData(
     ClientModels::FGetUserDataRequest& request,
     const FGetUserPublisherReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2214,29 +2433,32 @@ bool UPlayFabClientInstanceAPI::GetUserPublisherReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetUserPublisherReadOnlyData"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetUserDataResult>> UPlayFabClientInstanceAPI::GetUserPublisherReadOnlyDataAsync(ClientModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetUserDataResult, FGetUserPublisherReadOnlyDataDelegate>([this, &request, &Handle](const FGetUserPublisherReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetUserPublisherReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetUserReadOnlyData(
     ClientModels::FGetUserDataRequest& request,
     const FGetUserReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2245,56 +2467,62 @@ bool UPlayFabClientInstanceAPI::GetUserReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetUserReadOnlyData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetUserReadOnlyData"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetUserDataResult>> UPlayFabClientInstanceAPI::GetUserReadOnlyDataAsync(ClientModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetUserDataResult, FGetUserReadOnlyDataDelegate>([this, &request, &Handle](const FGetUserReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetUserReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GetWindowsHelloChallenge(
     ClientModels::FGetWindowsHelloChallengeRequest& request,
     const FGetWindowsHelloChallengeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetWindowsHelloChallenge"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGetWindowsHelloChallengeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GetWindowsHelloChallenge"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGetWindowsHelloChallengeResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGetWindowsHelloChallengeResponse>> UPlayFabClientInstanceAPI::GetWindowsHelloChallengeAsync(ClientModels::FGetWindowsHelloChallengeRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGetWindowsHelloChallengeResponse, FGetWindowsHelloChallengeDelegate>([this, &request, &Handle](const FGetWindowsHelloChallengeDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GetWindowsHelloChallenge(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGetWindowsHelloChallengeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetWindowsHelloChallengeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGetWindowsHelloChallengeResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGetWindowsHelloChallengeResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGetWindowsHelloChallengeResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::GrantCharacterToUser(
     ClientModels::FGrantCharacterToUserRequest& request,
     const FGrantCharacterToUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2303,29 +2531,32 @@ bool UPlayFabClientInstanceAPI::GrantCharacterToUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GrantCharacterToUser"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnGrantCharacterToUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/GrantCharacterToUser"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnGrantCharacterToUserResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FGrantCharacterToUserResult>> UPlayFabClientInstanceAPI::GrantCharacterToUserAsync(ClientModels::FGrantCharacterToUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FGrantCharacterToUserResult, FGrantCharacterToUserDelegate>([this, &request, &Handle](const FGrantCharacterToUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::GrantCharacterToUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnGrantCharacterToUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantCharacterToUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FGrantCharacterToUserResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FGrantCharacterToUserResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FGrantCharacterToUserResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::LinkAndroidDeviceID(
     ClientModels::FLinkAndroidDeviceIDRequest& request,
     const FLinkAndroidDeviceIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2334,29 +2565,32 @@ bool UPlayFabClientInstanceAPI::LinkAndroidDeviceID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkAndroidDeviceID"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkAndroidDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkAndroidDeviceID"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLinkAndroidDeviceIDResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkAndroidDeviceIDResult>> UPlayFabClientInstanceAPI::LinkAndroidDeviceIDAsync(ClientModels::FLinkAndroidDeviceIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkAndroidDeviceIDResult, FLinkAndroidDeviceIDDelegate>([this, &request, &Handle](const FLinkAndroidDeviceIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LinkAndroidDeviceID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLinkAndroidDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkAndroidDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkAndroidDeviceIDResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkAndroidDeviceIDResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkAndroidDeviceIDResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::LinkApple(
     ClientModels::FLinkAppleRequest& request,
     const FLinkAppleDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2365,29 +2599,32 @@ bool UPlayFabClientInstanceAPI::LinkApple(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkApple"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkApple"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLinkAppleResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FEmptyResult>> UPlayFabClientInstanceAPI::LinkAppleAsync(ClientModels::FLinkAppleRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FEmptyResult, FLinkAppleDelegate>([this, &request, &Handle](const FLinkAppleDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LinkApple(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLinkAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FEmptyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FEmptyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FEmptyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::LinkCustomID(
     ClientModels::FLinkCustomIDRequest& request,
     const FLinkCustomIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2396,29 +2633,32 @@ bool UPlayFabClientInstanceAPI::LinkCustomID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkCustomID"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkCustomIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkCustomID"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLinkCustomIDResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkCustomIDResult>> UPlayFabClientInstanceAPI::LinkCustomIDAsync(ClientModels::FLinkCustomIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkCustomIDResult, FLinkCustomIDDelegate>([this, &request, &Handle](const FLinkCustomIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LinkCustomID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLinkCustomIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkCustomIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkCustomIDResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkCustomIDResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkCustomIDResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::LinkFacebookAccount(
     ClientModels::FLinkFacebookAccountRequest& request,
     const FLinkFacebookAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2427,29 +2667,32 @@ bool UPlayFabClientInstanceAPI::LinkFacebookAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkFacebookAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkFacebookAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkFacebookAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLinkFacebookAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkFacebookAccountResult>> UPlayFabClientInstanceAPI::LinkFacebookAccountAsync(ClientModels::FLinkFacebookAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkFacebookAccountResult, FLinkFacebookAccountDelegate>([this, &request, &Handle](const FLinkFacebookAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LinkFacebookAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLinkFacebookAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkFacebookAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkFacebookAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkFacebookAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkFacebookAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::LinkFacebookInstantGamesId(
     ClientModels::FLinkFacebookInstantGamesIdRequest& request,
     const FLinkFacebookInstantGamesIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2458,29 +2701,32 @@ bool UPlayFabClientInstanceAPI::LinkFacebookInstantGamesId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkFacebookInstantGamesId"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkFacebookInstantGamesIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkFacebookInstantGamesId"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLinkFacebookInstantGamesIdResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkFacebookInstantGamesIdResult>> UPlayFabClientInstanceAPI::LinkFacebookInstantGamesIdAsync(ClientModels::FLinkFacebookInstantGamesIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkFacebookInstantGamesIdResult, FLinkFacebookInstantGamesIdDelegate>([this, &request, &Handle](const FLinkFacebookInstantGamesIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LinkFacebookInstantGamesId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLinkFacebookInstantGamesIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkFacebookInstantGamesIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkFacebookInstantGamesIdResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkFacebookInstantGamesIdResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkFacebookInstantGamesIdResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::LinkGameCenterAccount(
     ClientModels::FLinkGameCenterAccountRequest& request,
     const FLinkGameCenterAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2489,29 +2735,32 @@ bool UPlayFabClientInstanceAPI::LinkGameCenterAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkGameCenterAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkGameCenterAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkGameCenterAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLinkGameCenterAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkGameCenterAccountResult>> UPlayFabClientInstanceAPI::LinkGameCenterAccountAsync(ClientModels::FLinkGameCenterAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkGameCenterAccountResult, FLinkGameCenterAccountDelegate>([this, &request, &Handle](const FLinkGameCenterAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LinkGameCenterAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLinkGameCenterAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkGameCenterAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkGameCenterAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkGameCenterAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkGameCenterAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::LinkGoogleAccount(
     ClientModels::FLinkGoogleAccountRequest& request,
     const FLinkGoogleAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2520,29 +2769,32 @@ bool UPlayFabClientInstanceAPI::LinkGoogleAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkGoogleAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkGoogleAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkGoogleAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLinkGoogleAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkGoogleAccountResult>> UPlayFabClientInstanceAPI::LinkGoogleAccountAsync(ClientModels::FLinkGoogleAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkGoogleAccountResult, FLinkGoogleAccountDelegate>([this, &request, &Handle](const FLinkGoogleAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LinkGoogleAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLinkGoogleAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkGoogleAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkGoogleAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkGoogleAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkGoogleAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::LinkIOSDeviceID(
     ClientModels::FLinkIOSDeviceIDRequest& request,
     const FLinkIOSDeviceIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2551,29 +2803,32 @@ bool UPlayFabClientInstanceAPI::LinkIOSDeviceID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkIOSDeviceID"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkIOSDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkIOSDeviceID"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLinkIOSDeviceIDResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkIOSDeviceIDResult>> UPlayFabClientInstanceAPI::LinkIOSDeviceIDAsync(ClientModels::FLinkIOSDeviceIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkIOSDeviceIDResult, FLinkIOSDeviceIDDelegate>([this, &request, &Handle](const FLinkIOSDeviceIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LinkIOSDeviceID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLinkIOSDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkIOSDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkIOSDeviceIDResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkIOSDeviceIDResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkIOSDeviceIDResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::LinkKongregate(
     ClientModels::FLinkKongregateAccountRequest& request,
     const FLinkKongregateDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2582,29 +2837,32 @@ bool UPlayFabClientInstanceAPI::LinkKongregate(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkKongregate"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkKongregate"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLinkKongregateResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkKongregateAccountResult>> UPlayFabClientInstanceAPI::LinkKongregateAsync(ClientModels::FLinkKongregateAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkKongregateAccountResult, FLinkKongregateDelegate>([this, &request, &Handle](const FLinkKongregateDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LinkKongregate(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLinkKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkKongregateAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkKongregateAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkKongregateAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::LinkNintendoServiceAccount(
     ClientModels::FLinkNintendoServiceAccountRequest& request,
     const FLinkNintendoServiceAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2613,29 +2871,32 @@ bool UPlayFabClientInstanceAPI::LinkNintendoServiceAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkNintendoServiceAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkNintendoServiceAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLinkNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FEmptyResult>> UPlayFabClientInstanceAPI::LinkNintendoServiceAccountAsync(ClientModels::FLinkNintendoServiceAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FEmptyResult, FLinkNintendoServiceAccountDelegate>([this, &request, &Handle](const FLinkNintendoServiceAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LinkNintendoServiceAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLinkNintendoServiceAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkNintendoServiceAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FEmptyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FEmptyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FEmptyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::LinkNintendoSwitchDeviceId(
     ClientModels::FLinkNintendoSwitchDeviceIdRequest& request,
     const FLinkNintendoSwitchDeviceIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2644,29 +2905,32 @@ bool UPlayFabClientInstanceAPI::LinkNintendoSwitchDeviceId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkNintendoSwitchDeviceId"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkNintendoSwitchDeviceId"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLinkNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkNintendoSwitchDeviceIdResult>> UPlayFabClientInstanceAPI::LinkNintendoSwitchDeviceIdAsync(ClientModels::FLinkNintendoSwitchDeviceIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkNintendoSwitchDeviceIdResult, FLinkNintendoSwitchDeviceIdDelegate>([this, &request, &Handle](const FLinkNintendoSwitchDeviceIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LinkNintendoSwitchDeviceId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLinkNintendoSwitchDeviceIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkNintendoSwitchDeviceIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkNintendoSwitchDeviceIdResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkNintendoSwitchDeviceIdResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkNintendoSwitchDeviceIdResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::LinkOpenIdConnect(
     ClientModels::FLinkOpenIdConnectRequest& request,
     const FLinkOpenIdConnectDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2675,29 +2939,32 @@ bool UPlayFabClientInstanceAPI::LinkOpenIdConnect(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkOpenIdConnect"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkOpenIdConnectResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkOpenIdConnect"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLinkOpenIdConnectResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FEmptyResult>> UPlayFabClientInstanceAPI::LinkOpenIdConnectAsync(ClientModels::FLinkOpenIdConnectRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FEmptyResult, FLinkOpenIdConnectDelegate>([this, &request, &Handle](const FLinkOpenIdConnectDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LinkOpenIdConnect(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLinkOpenIdConnectResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkOpenIdConnectDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FEmptyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FEmptyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FEmptyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::LinkPSNAccount(
     ClientModels::FLinkPSNAccountRequest& request,
     const FLinkPSNAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2706,29 +2973,32 @@ bool UPlayFabClientInstanceAPI::LinkPSNAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkPSNAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkPSNAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkPSNAccountResult>> UPlayFabClientInstanceAPI::LinkPSNAccountAsync(ClientModels::FLinkPSNAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkPSNAccountResult, FLinkPSNAccountDelegate>([this, &request, &Handle](const FLinkPSNAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LinkPSNAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLinkPSNAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkPSNAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkPSNAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkPSNAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkPSNAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::LinkSteamAccount(
     ClientModels::FLinkSteamAccountRequest& request,
     const FLinkSteamAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2737,29 +3007,32 @@ bool UPlayFabClientInstanceAPI::LinkSteamAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkSteamAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkSteamAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkSteamAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLinkSteamAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkSteamAccountResult>> UPlayFabClientInstanceAPI::LinkSteamAccountAsync(ClientModels::FLinkSteamAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkSteamAccountResult, FLinkSteamAccountDelegate>([this, &request, &Handle](const FLinkSteamAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LinkSteamAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLinkSteamAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkSteamAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkSteamAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkSteamAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkSteamAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::LinkTwitch(
     ClientModels::FLinkTwitchAccountRequest& request,
     const FLinkTwitchDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2768,29 +3041,32 @@ bool UPlayFabClientInstanceAPI::LinkTwitch(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkTwitch"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkTwitch"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLinkTwitchResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkTwitchAccountResult>> UPlayFabClientInstanceAPI::LinkTwitchAsync(ClientModels::FLinkTwitchAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkTwitchAccountResult, FLinkTwitchDelegate>([this, &request, &Handle](const FLinkTwitchDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LinkTwitch(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLinkTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkTwitchAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkTwitchAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkTwitchAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::LinkWindowsHello(
     ClientModels::FLinkWindowsHelloAccountRequest& request,
     const FLinkWindowsHelloDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2799,29 +3075,32 @@ bool UPlayFabClientInstanceAPI::LinkWindowsHello(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkWindowsHello"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkWindowsHelloResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkWindowsHello"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLinkWindowsHelloResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkWindowsHelloAccountResponse>> UPlayFabClientInstanceAPI::LinkWindowsHelloAsync(ClientModels::FLinkWindowsHelloAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkWindowsHelloAccountResponse, FLinkWindowsHelloDelegate>([this, &request, &Handle](const FLinkWindowsHelloDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LinkWindowsHello(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLinkWindowsHelloResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkWindowsHelloDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkWindowsHelloAccountResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkWindowsHelloAccountResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkWindowsHelloAccountResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::LinkXboxAccount(
     ClientModels::FLinkXboxAccountRequest& request,
     const FLinkXboxAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -2830,45 +3109,57 @@ bool UPlayFabClientInstanceAPI::LinkXboxAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkXboxAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LinkXboxAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLinkXboxAccountResult>> UPlayFabClientInstanceAPI::LinkXboxAccountAsync(ClientModels::FLinkXboxAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLinkXboxAccountResult, FLinkXboxAccountDelegate>([this, &request, &Handle](const FLinkXboxAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LinkXboxAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLinkXboxAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkXboxAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLinkXboxAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLinkXboxAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FLinkXboxAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithAndroidDeviceID(
     ClientModels::FLoginWithAndroidDeviceIDRequest& request,
     const FLoginWithAndroidDeviceIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithAndroidDeviceID"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithAndroidDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithAndroidDeviceID"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithAndroidDeviceIDResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithAndroidDeviceIDAsync(ClientModels::FLoginWithAndroidDeviceIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithAndroidDeviceIDDelegate>([this, &request, &Handle](const FLoginWithAndroidDeviceIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithAndroidDeviceID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithAndroidDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithAndroidDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -2885,33 +3176,39 @@ void UPlayFabClientInstanceAPI::OnLoginWithAndroidDeviceIDResult(FHttpRequestPtr
         }
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithApple(
     ClientModels::FLoginWithAppleRequest& request,
     const FLoginWithAppleDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithApple"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithApple"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithAppleResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithAppleAsync(ClientModels::FLoginWithAppleRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithAppleDelegate>([this, &request, &Handle](const FLoginWithAppleDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithApple(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -2929,33 +3226,39 @@ void UPlayFabClientInstanceAPI::OnLoginWithAppleResult(FHttpRequestPtr HttpReque
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithCustomID(
     ClientModels::FLoginWithCustomIDRequest& request,
     const FLoginWithCustomIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithCustomID"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithCustomIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithCustomID"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithCustomIDResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithCustomIDAsync(ClientModels::FLoginWithCustomIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithCustomIDDelegate>([this, &request, &Handle](const FLoginWithCustomIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithCustomID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithCustomIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithCustomIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -2973,33 +3276,39 @@ void UPlayFabClientInstanceAPI::OnLoginWithCustomIDResult(FHttpRequestPtr HttpRe
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithEmailAddress(
     ClientModels::FLoginWithEmailAddressRequest& request,
     const FLoginWithEmailAddressDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithEmailAddress"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithEmailAddressResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithEmailAddress"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithEmailAddressResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithEmailAddressAsync(ClientModels::FLoginWithEmailAddressRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithEmailAddressDelegate>([this, &request, &Handle](const FLoginWithEmailAddressDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithEmailAddress(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithEmailAddressResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithEmailAddressDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3016,34 +3325,40 @@ void UPlayFabClientInstanceAPI::OnLoginWithEmailAddressResult(FHttpRequestPtr Ht
         }
         
 
-        SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+        SuccessDelegate.ExecuteIfBound(outResult);
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithFacebook(
     ClientModels::FLoginWithFacebookRequest& request,
     const FLoginWithFacebookDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithFacebook"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithFacebookResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithFacebook"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithFacebookResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithFacebookAsync(ClientModels::FLoginWithFacebookRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithFacebookDelegate>([this, &request, &Handle](const FLoginWithFacebookDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithFacebook(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithFacebookResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithFacebookDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3061,33 +3376,39 @@ void UPlayFabClientInstanceAPI::OnLoginWithFacebookResult(FHttpRequestPtr HttpRe
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithFacebookInstantGamesId(
     ClientModels::FLoginWithFacebookInstantGamesIdRequest& request,
     const FLoginWithFacebookInstantGamesIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithFacebookInstantGamesId"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithFacebookInstantGamesIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithFacebookInstantGamesId"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithFacebookInstantGamesIdResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithFacebookInstantGamesIdAsync(ClientModels::FLoginWithFacebookInstantGamesIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithFacebookInstantGamesIdDelegate>([this, &request, &Handle](const FLoginWithFacebookInstantGamesIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithFacebookInstantGamesId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithFacebookInstantGamesIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithFacebookInstantGamesIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3105,33 +3426,39 @@ void UPlayFabClientInstanceAPI::OnLoginWithFacebookInstantGamesIdResult(FHttpReq
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithGameCenter(
     ClientModels::FLoginWithGameCenterRequest& request,
     const FLoginWithGameCenterDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithGameCenter"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithGameCenterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithGameCenter"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithGameCenterResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithGameCenterAsync(ClientModels::FLoginWithGameCenterRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithGameCenterDelegate>([this, &request, &Handle](const FLoginWithGameCenterDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithGameCenter(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithGameCenterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithGameCenterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3149,33 +3476,39 @@ void UPlayFabClientInstanceAPI::OnLoginWithGameCenterResult(FHttpRequestPtr Http
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithGoogleAccount(
     ClientModels::FLoginWithGoogleAccountRequest& request,
     const FLoginWithGoogleAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithGoogleAccount"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithGoogleAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithGoogleAccount"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithGoogleAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithGoogleAccountAsync(ClientModels::FLoginWithGoogleAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithGoogleAccountDelegate>([this, &request, &Handle](const FLoginWithGoogleAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithGoogleAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithGoogleAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithGoogleAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3193,33 +3526,39 @@ void UPlayFabClientInstanceAPI::OnLoginWithGoogleAccountResult(FHttpRequestPtr H
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithIOSDeviceID(
     ClientModels::FLoginWithIOSDeviceIDRequest& request,
     const FLoginWithIOSDeviceIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithIOSDeviceID"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithIOSDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithIOSDeviceID"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithIOSDeviceIDResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithIOSDeviceIDAsync(ClientModels::FLoginWithIOSDeviceIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithIOSDeviceIDDelegate>([this, &request, &Handle](const FLoginWithIOSDeviceIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithIOSDeviceID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithIOSDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithIOSDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3237,33 +3576,39 @@ void UPlayFabClientInstanceAPI::OnLoginWithIOSDeviceIDResult(FHttpRequestPtr Htt
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithKongregate(
     ClientModels::FLoginWithKongregateRequest& request,
     const FLoginWithKongregateDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithKongregate"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithKongregate"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithKongregateResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithKongregateAsync(ClientModels::FLoginWithKongregateRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithKongregateDelegate>([this, &request, &Handle](const FLoginWithKongregateDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithKongregate(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3281,33 +3626,39 @@ void UPlayFabClientInstanceAPI::OnLoginWithKongregateResult(FHttpRequestPtr Http
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithNintendoServiceAccount(
     ClientModels::FLoginWithNintendoServiceAccountRequest& request,
     const FLoginWithNintendoServiceAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithNintendoServiceAccount"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithNintendoServiceAccount"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithNintendoServiceAccountAsync(ClientModels::FLoginWithNintendoServiceAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithNintendoServiceAccountDelegate>([this, &request, &Handle](const FLoginWithNintendoServiceAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithNintendoServiceAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithNintendoServiceAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithNintendoServiceAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3325,33 +3676,39 @@ void UPlayFabClientInstanceAPI::OnLoginWithNintendoServiceAccountResult(FHttpReq
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithNintendoSwitchDeviceId(
     ClientModels::FLoginWithNintendoSwitchDeviceIdRequest& request,
     const FLoginWithNintendoSwitchDeviceIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithNintendoSwitchDeviceId"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithNintendoSwitchDeviceId"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithNintendoSwitchDeviceIdAsync(ClientModels::FLoginWithNintendoSwitchDeviceIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithNintendoSwitchDeviceIdDelegate>([this, &request, &Handle](const FLoginWithNintendoSwitchDeviceIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithNintendoSwitchDeviceId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithNintendoSwitchDeviceIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithNintendoSwitchDeviceIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3369,33 +3726,39 @@ void UPlayFabClientInstanceAPI::OnLoginWithNintendoSwitchDeviceIdResult(FHttpReq
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithOpenIdConnect(
     ClientModels::FLoginWithOpenIdConnectRequest& request,
     const FLoginWithOpenIdConnectDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithOpenIdConnect"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithOpenIdConnectResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithOpenIdConnect"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithOpenIdConnectResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithOpenIdConnectAsync(ClientModels::FLoginWithOpenIdConnectRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithOpenIdConnectDelegate>([this, &request, &Handle](const FLoginWithOpenIdConnectDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithOpenIdConnect(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithOpenIdConnectResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithOpenIdConnectDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3413,33 +3776,39 @@ void UPlayFabClientInstanceAPI::OnLoginWithOpenIdConnectResult(FHttpRequestPtr H
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithPlayFab(
     ClientModels::FLoginWithPlayFabRequest& request,
     const FLoginWithPlayFabDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithPlayFab"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithPlayFabResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithPlayFab"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithPlayFabResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithPlayFabAsync(ClientModels::FLoginWithPlayFabRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithPlayFabDelegate>([this, &request, &Handle](const FLoginWithPlayFabDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithPlayFab(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithPlayFabResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithPlayFabDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3457,33 +3826,39 @@ void UPlayFabClientInstanceAPI::OnLoginWithPlayFabResult(FHttpRequestPtr HttpReq
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithPSN(
     ClientModels::FLoginWithPSNRequest& request,
     const FLoginWithPSNDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithPSN"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithPSNResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithPSN"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithPSNResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithPSNAsync(ClientModels::FLoginWithPSNRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithPSNDelegate>([this, &request, &Handle](const FLoginWithPSNDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithPSN(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithPSNResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithPSNDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3501,33 +3876,39 @@ void UPlayFabClientInstanceAPI::OnLoginWithPSNResult(FHttpRequestPtr HttpRequest
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithSteam(
     ClientModels::FLoginWithSteamRequest& request,
     const FLoginWithSteamDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithSteam"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithSteamResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithSteam"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithSteamResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithSteamAsync(ClientModels::FLoginWithSteamRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithSteamDelegate>([this, &request, &Handle](const FLoginWithSteamDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithSteam(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithSteamResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithSteamDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3545,33 +3926,39 @@ void UPlayFabClientInstanceAPI::OnLoginWithSteamResult(FHttpRequestPtr HttpReque
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithTwitch(
     ClientModels::FLoginWithTwitchRequest& request,
     const FLoginWithTwitchDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithTwitch"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithTwitch"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithTwitchResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithTwitchAsync(ClientModels::FLoginWithTwitchRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithTwitchDelegate>([this, &request, &Handle](const FLoginWithTwitchDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithTwitch(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3589,33 +3976,39 @@ void UPlayFabClientInstanceAPI::OnLoginWithTwitchResult(FHttpRequestPtr HttpRequ
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithWindowsHello(
     ClientModels::FLoginWithWindowsHelloRequest& request,
     const FLoginWithWindowsHelloDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithWindowsHello"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithWindowsHelloResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithWindowsHello"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithWindowsHelloResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithWindowsHelloAsync(ClientModels::FLoginWithWindowsHelloRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithWindowsHelloDelegate>([this, &request, &Handle](const FLoginWithWindowsHelloDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithWindowsHello(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithWindowsHelloResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithWindowsHelloDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3633,33 +4026,39 @@ void UPlayFabClientInstanceAPI::OnLoginWithWindowsHelloResult(FHttpRequestPtr Ht
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::LoginWithXbox(
     ClientModels::FLoginWithXboxRequest& request,
     const FLoginWithXboxDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithXbox"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnLoginWithXboxResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/LoginWithXbox"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnLoginWithXboxResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::LoginWithXboxAsync(ClientModels::FLoginWithXboxRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FLoginWithXboxDelegate>([this, &request, &Handle](const FLoginWithXboxDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::LoginWithXbox(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnLoginWithXboxResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithXboxDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3677,17 +4076,14 @@ void UPlayFabClientInstanceAPI::OnLoginWithXboxResult(FHttpRequestPtr HttpReques
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::Matchmake(
     ClientModels::FMatchmakeRequest& request,
     const FMatchmakeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -3696,29 +4092,32 @@ bool UPlayFabClientInstanceAPI::Matchmake(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/Matchmake"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnMatchmakeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/Matchmake"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnMatchmakeResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FMatchmakeResult>> UPlayFabClientInstanceAPI::MatchmakeAsync(ClientModels::FMatchmakeRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FMatchmakeResult, FMatchmakeDelegate>([this, &request, &Handle](const FMatchmakeDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::Matchmake(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnMatchmakeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FMatchmakeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FMatchmakeResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FMatchmakeResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FMatchmakeResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::OpenTrade(
     ClientModels::FOpenTradeRequest& request,
     const FOpenTradeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -3727,29 +4126,32 @@ bool UPlayFabClientInstanceAPI::OpenTrade(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/OpenTrade"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnOpenTradeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/OpenTrade"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnOpenTradeResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FOpenTradeResponse>> UPlayFabClientInstanceAPI::OpenTradeAsync(ClientModels::FOpenTradeRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FOpenTradeResponse, FOpenTradeDelegate>([this, &request, &Handle](const FOpenTradeDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::OpenTrade(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnOpenTradeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FOpenTradeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FOpenTradeResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FOpenTradeResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FOpenTradeResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::PayForPurchase(
     ClientModels::FPayForPurchaseRequest& request,
     const FPayForPurchaseDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -3758,29 +4160,32 @@ bool UPlayFabClientInstanceAPI::PayForPurchase(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/PayForPurchase"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnPayForPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/PayForPurchase"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnPayForPurchaseResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FPayForPurchaseResult>> UPlayFabClientInstanceAPI::PayForPurchaseAsync(ClientModels::FPayForPurchaseRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FPayForPurchaseResult, FPayForPurchaseDelegate>([this, &request, &Handle](const FPayForPurchaseDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::PayForPurchase(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnPayForPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPayForPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FPayForPurchaseResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FPayForPurchaseResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FPayForPurchaseResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::PurchaseItem(
     ClientModels::FPurchaseItemRequest& request,
     const FPurchaseItemDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -3789,29 +4194,32 @@ bool UPlayFabClientInstanceAPI::PurchaseItem(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/PurchaseItem"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnPurchaseItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/PurchaseItem"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnPurchaseItemResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FPurchaseItemResult>> UPlayFabClientInstanceAPI::PurchaseItemAsync(ClientModels::FPurchaseItemRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FPurchaseItemResult, FPurchaseItemDelegate>([this, &request, &Handle](const FPurchaseItemDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::PurchaseItem(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnPurchaseItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPurchaseItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FPurchaseItemResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FPurchaseItemResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FPurchaseItemResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::RedeemCoupon(
     ClientModels::FRedeemCouponRequest& request,
     const FRedeemCouponDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -3820,29 +4228,32 @@ bool UPlayFabClientInstanceAPI::RedeemCoupon(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RedeemCoupon"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRedeemCouponResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RedeemCoupon"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnRedeemCouponResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FRedeemCouponResult>> UPlayFabClientInstanceAPI::RedeemCouponAsync(ClientModels::FRedeemCouponRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FRedeemCouponResult, FRedeemCouponDelegate>([this, &request, &Handle](const FRedeemCouponDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::RedeemCoupon(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnRedeemCouponResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemCouponDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FRedeemCouponResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FRedeemCouponResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FRedeemCouponResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::RefreshPSNAuthToken(
     ClientModels::FRefreshPSNAuthTokenRequest& request,
     const FRefreshPSNAuthTokenDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -3851,29 +4262,32 @@ bool UPlayFabClientInstanceAPI::RefreshPSNAuthToken(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RefreshPSNAuthToken"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRefreshPSNAuthTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RefreshPSNAuthToken"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnRefreshPSNAuthTokenResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FEmptyResponse>> UPlayFabClientInstanceAPI::RefreshPSNAuthTokenAsync(ClientModels::FRefreshPSNAuthTokenRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FEmptyResponse, FRefreshPSNAuthTokenDelegate>([this, &request, &Handle](const FRefreshPSNAuthTokenDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::RefreshPSNAuthToken(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnRefreshPSNAuthTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRefreshPSNAuthTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::RegisterForIOSPushNotification(
     ClientModels::FRegisterForIOSPushNotificationRequest& request,
     const FRegisterForIOSPushNotificationDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -3882,78 +4296,96 @@ bool UPlayFabClientInstanceAPI::RegisterForIOSPushNotification(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RegisterForIOSPushNotification"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRegisterForIOSPushNotificationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RegisterForIOSPushNotification"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnRegisterForIOSPushNotificationResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FRegisterForIOSPushNotificationResult>> UPlayFabClientInstanceAPI::RegisterForIOSPushNotificationAsync(ClientModels::FRegisterForIOSPushNotificationRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FRegisterForIOSPushNotificationResult, FRegisterForIOSPushNotificationDelegate>([this, &request, &Handle](const FRegisterForIOSPushNotificationDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::RegisterForIOSPushNotification(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnRegisterForIOSPushNotificationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterForIOSPushNotificationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FRegisterForIOSPushNotificationResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FRegisterForIOSPushNotificationResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FRegisterForIOSPushNotificationResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::RegisterPlayFabUser(
     ClientModels::FRegisterPlayFabUserRequest& request,
     const FRegisterPlayFabUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RegisterPlayFabUser"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRegisterPlayFabUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RegisterPlayFabUser"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnRegisterPlayFabUserResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FRegisterPlayFabUserResult>> UPlayFabClientInstanceAPI::RegisterPlayFabUserAsync(ClientModels::FRegisterPlayFabUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FRegisterPlayFabUserResult, FRegisterPlayFabUserDelegate>([this, &request, &Handle](const FRegisterPlayFabUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::RegisterPlayFabUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnRegisterPlayFabUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterPlayFabUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FRegisterPlayFabUserResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FRegisterPlayFabUserResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FRegisterPlayFabUserResult& outResult)
     {
         if (outResult.SessionTicket.Len() > 0)
             GetOrCreateAuthenticationContext()->SetClientSessionTicket(outResult.SessionTicket);
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::RegisterWithWindowsHello(
     ClientModels::FRegisterWithWindowsHelloRequest& request,
     const FRegisterWithWindowsHelloDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() > 0)
         request.TitleId = GetDefault<UPlayFabRuntimeSettings>()->TitleId;
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RegisterWithWindowsHello"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRegisterWithWindowsHelloResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RegisterWithWindowsHello"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnRegisterWithWindowsHelloResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FLoginResult>> UPlayFabClientInstanceAPI::RegisterWithWindowsHelloAsync(ClientModels::FRegisterWithWindowsHelloRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FLoginResult, FRegisterWithWindowsHelloDelegate>([this, &request, &Handle](const FRegisterWithWindowsHelloDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::RegisterWithWindowsHello(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnRegisterWithWindowsHelloResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterWithWindowsHelloDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabClientInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FLoginResult>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](ClientModels::FLoginResult& outResult)
     {
         outResult.AuthenticationContext = MakeSharedUObject<UPlayFabAuthenticationContext>();
         if (outResult.SessionTicket.Len() > 0) {
@@ -3971,17 +4403,14 @@ void UPlayFabClientInstanceAPI::OnRegisterWithWindowsHelloResult(FHttpRequestPtr
         
 
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabClientInstanceAPI::RemoveContactEmail(
     ClientModels::FRemoveContactEmailRequest& request,
     const FRemoveContactEmailDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -3990,29 +4419,32 @@ bool UPlayFabClientInstanceAPI::RemoveContactEmail(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RemoveContactEmail"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRemoveContactEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RemoveContactEmail"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnRemoveContactEmailResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FRemoveContactEmailResult>> UPlayFabClientInstanceAPI::RemoveContactEmailAsync(ClientModels::FRemoveContactEmailRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FRemoveContactEmailResult, FRemoveContactEmailDelegate>([this, &request, &Handle](const FRemoveContactEmailDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::RemoveContactEmail(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnRemoveContactEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveContactEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FRemoveContactEmailResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FRemoveContactEmailResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FRemoveContactEmailResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::RemoveFriend(
     ClientModels::FRemoveFriendRequest& request,
     const FRemoveFriendDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4021,29 +4453,32 @@ bool UPlayFabClientInstanceAPI::RemoveFriend(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RemoveFriend"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRemoveFriendResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RemoveFriend"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnRemoveFriendResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FRemoveFriendResult>> UPlayFabClientInstanceAPI::RemoveFriendAsync(ClientModels::FRemoveFriendRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FRemoveFriendResult, FRemoveFriendDelegate>([this, &request, &Handle](const FRemoveFriendDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::RemoveFriend(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnRemoveFriendResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveFriendDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FRemoveFriendResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FRemoveFriendResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FRemoveFriendResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::RemoveGenericID(
     ClientModels::FRemoveGenericIDRequest& request,
     const FRemoveGenericIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4052,29 +4487,32 @@ bool UPlayFabClientInstanceAPI::RemoveGenericID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RemoveGenericID"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRemoveGenericIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RemoveGenericID"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnRemoveGenericIDResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FRemoveGenericIDResult>> UPlayFabClientInstanceAPI::RemoveGenericIDAsync(ClientModels::FRemoveGenericIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FRemoveGenericIDResult, FRemoveGenericIDDelegate>([this, &request, &Handle](const FRemoveGenericIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::RemoveGenericID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnRemoveGenericIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveGenericIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FRemoveGenericIDResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FRemoveGenericIDResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FRemoveGenericIDResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::RemoveSharedGroupMembers(
     ClientModels::FRemoveSharedGroupMembersRequest& request,
     const FRemoveSharedGroupMembersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4083,29 +4521,32 @@ bool UPlayFabClientInstanceAPI::RemoveSharedGroupMembers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RemoveSharedGroupMembers"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRemoveSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RemoveSharedGroupMembers"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnRemoveSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FRemoveSharedGroupMembersResult>> UPlayFabClientInstanceAPI::RemoveSharedGroupMembersAsync(ClientModels::FRemoveSharedGroupMembersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FRemoveSharedGroupMembersResult, FRemoveSharedGroupMembersDelegate>([this, &request, &Handle](const FRemoveSharedGroupMembersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::RemoveSharedGroupMembers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnRemoveSharedGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveSharedGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FRemoveSharedGroupMembersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FRemoveSharedGroupMembersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FRemoveSharedGroupMembersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::ReportAdActivity(
     ClientModels::FReportAdActivityRequest& request,
     const FReportAdActivityDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4114,29 +4555,32 @@ bool UPlayFabClientInstanceAPI::ReportAdActivity(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ReportAdActivity"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnReportAdActivityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ReportAdActivity"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnReportAdActivityResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FReportAdActivityResult>> UPlayFabClientInstanceAPI::ReportAdActivityAsync(ClientModels::FReportAdActivityRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FReportAdActivityResult, FReportAdActivityDelegate>([this, &request, &Handle](const FReportAdActivityDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::ReportAdActivity(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnReportAdActivityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportAdActivityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FReportAdActivityResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FReportAdActivityResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FReportAdActivityResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::ReportDeviceInfo(
     ClientModels::FDeviceInfoRequest& request,
     const FReportDeviceInfoDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4145,29 +4589,32 @@ bool UPlayFabClientInstanceAPI::ReportDeviceInfo(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ReportDeviceInfo"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnReportDeviceInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ReportDeviceInfo"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnReportDeviceInfoResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FEmptyResponse>> UPlayFabClientInstanceAPI::ReportDeviceInfoAsync(ClientModels::FDeviceInfoRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FEmptyResponse, FReportDeviceInfoDelegate>([this, &request, &Handle](const FReportDeviceInfoDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::ReportDeviceInfo(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnReportDeviceInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportDeviceInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::ReportPlayer(
     ClientModels::FReportPlayerClientRequest& request,
     const FReportPlayerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4176,29 +4623,32 @@ bool UPlayFabClientInstanceAPI::ReportPlayer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ReportPlayer"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnReportPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ReportPlayer"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnReportPlayerResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FReportPlayerClientResult>> UPlayFabClientInstanceAPI::ReportPlayerAsync(ClientModels::FReportPlayerClientRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FReportPlayerClientResult, FReportPlayerDelegate>([this, &request, &Handle](const FReportPlayerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::ReportPlayer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnReportPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FReportPlayerClientResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FReportPlayerClientResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FReportPlayerClientResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::RestoreIOSPurchases(
     ClientModels::FRestoreIOSPurchasesRequest& request,
     const FRestoreIOSPurchasesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4207,29 +4657,32 @@ bool UPlayFabClientInstanceAPI::RestoreIOSPurchases(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RestoreIOSPurchases"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRestoreIOSPurchasesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RestoreIOSPurchases"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnRestoreIOSPurchasesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FRestoreIOSPurchasesResult>> UPlayFabClientInstanceAPI::RestoreIOSPurchasesAsync(ClientModels::FRestoreIOSPurchasesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FRestoreIOSPurchasesResult, FRestoreIOSPurchasesDelegate>([this, &request, &Handle](const FRestoreIOSPurchasesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::RestoreIOSPurchases(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnRestoreIOSPurchasesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRestoreIOSPurchasesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FRestoreIOSPurchasesResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FRestoreIOSPurchasesResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FRestoreIOSPurchasesResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::RewardAdActivity(
     ClientModels::FRewardAdActivityRequest& request,
     const FRewardAdActivityDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4238,56 +4691,62 @@ bool UPlayFabClientInstanceAPI::RewardAdActivity(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RewardAdActivity"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnRewardAdActivityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/RewardAdActivity"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnRewardAdActivityResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FRewardAdActivityResult>> UPlayFabClientInstanceAPI::RewardAdActivityAsync(ClientModels::FRewardAdActivityRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FRewardAdActivityResult, FRewardAdActivityDelegate>([this, &request, &Handle](const FRewardAdActivityDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::RewardAdActivity(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnRewardAdActivityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRewardAdActivityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FRewardAdActivityResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FRewardAdActivityResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FRewardAdActivityResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::SendAccountRecoveryEmail(
     ClientModels::FSendAccountRecoveryEmailRequest& request,
     const FSendAccountRecoveryEmailDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/SendAccountRecoveryEmail"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnSendAccountRecoveryEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/SendAccountRecoveryEmail"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnSendAccountRecoveryEmailResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FSendAccountRecoveryEmailResult>> UPlayFabClientInstanceAPI::SendAccountRecoveryEmailAsync(ClientModels::FSendAccountRecoveryEmailRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FSendAccountRecoveryEmailResult, FSendAccountRecoveryEmailDelegate>([this, &request, &Handle](const FSendAccountRecoveryEmailDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::SendAccountRecoveryEmail(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnSendAccountRecoveryEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendAccountRecoveryEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FSendAccountRecoveryEmailResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FSendAccountRecoveryEmailResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FSendAccountRecoveryEmailResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::SetFriendTags(
     ClientModels::FSetFriendTagsRequest& request,
     const FSetFriendTagsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4296,29 +4755,32 @@ bool UPlayFabClientInstanceAPI::SetFriendTags(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/SetFriendTags"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnSetFriendTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/SetFriendTags"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnSetFriendTagsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FSetFriendTagsResult>> UPlayFabClientInstanceAPI::SetFriendTagsAsync(ClientModels::FSetFriendTagsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FSetFriendTagsResult, FSetFriendTagsDelegate>([this, &request, &Handle](const FSetFriendTagsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::SetFriendTags(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnSetFriendTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetFriendTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FSetFriendTagsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FSetFriendTagsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FSetFriendTagsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::SetPlayerSecret(
     ClientModels::FSetPlayerSecretRequest& request,
     const FSetPlayerSecretDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4327,29 +4789,32 @@ bool UPlayFabClientInstanceAPI::SetPlayerSecret(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/SetPlayerSecret"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnSetPlayerSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/SetPlayerSecret"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnSetPlayerSecretResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FSetPlayerSecretResult>> UPlayFabClientInstanceAPI::SetPlayerSecretAsync(ClientModels::FSetPlayerSecretRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FSetPlayerSecretResult, FSetPlayerSecretDelegate>([this, &request, &Handle](const FSetPlayerSecretDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::SetPlayerSecret(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnSetPlayerSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPlayerSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FSetPlayerSecretResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FSetPlayerSecretResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FSetPlayerSecretResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::StartGame(
     ClientModels::FStartGameRequest& request,
     const FStartGameDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4358,29 +4823,32 @@ bool UPlayFabClientInstanceAPI::StartGame(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/StartGame"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnStartGameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/StartGame"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnStartGameResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FStartGameResult>> UPlayFabClientInstanceAPI::StartGameAsync(ClientModels::FStartGameRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FStartGameResult, FStartGameDelegate>([this, &request, &Handle](const FStartGameDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::StartGame(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnStartGameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FStartGameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FStartGameResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FStartGameResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FStartGameResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::StartPurchase(
     ClientModels::FStartPurchaseRequest& request,
     const FStartPurchaseDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4389,29 +4857,32 @@ bool UPlayFabClientInstanceAPI::StartPurchase(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/StartPurchase"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnStartPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/StartPurchase"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnStartPurchaseResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FStartPurchaseResult>> UPlayFabClientInstanceAPI::StartPurchaseAsync(ClientModels::FStartPurchaseRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FStartPurchaseResult, FStartPurchaseDelegate>([this, &request, &Handle](const FStartPurchaseDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::StartPurchase(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnStartPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FStartPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FStartPurchaseResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FStartPurchaseResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FStartPurchaseResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::SubtractUserVirtualCurrency(
     ClientModels::FSubtractUserVirtualCurrencyRequest& request,
     const FSubtractUserVirtualCurrencyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4420,29 +4891,32 @@ bool UPlayFabClientInstanceAPI::SubtractUserVirtualCurrency(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/SubtractUserVirtualCurrency"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnSubtractUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/SubtractUserVirtualCurrency"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnSubtractUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FModifyUserVirtualCurrencyResult>> UPlayFabClientInstanceAPI::SubtractUserVirtualCurrencyAsync(ClientModels::FSubtractUserVirtualCurrencyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FModifyUserVirtualCurrencyResult, FSubtractUserVirtualCurrencyDelegate>([this, &request, &Handle](const FSubtractUserVirtualCurrencyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::SubtractUserVirtualCurrency(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnSubtractUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubtractUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FModifyUserVirtualCurrencyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FModifyUserVirtualCurrencyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FModifyUserVirtualCurrencyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlinkAndroidDeviceID(
     ClientModels::FUnlinkAndroidDeviceIDRequest& request,
     const FUnlinkAndroidDeviceIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4451,29 +4925,32 @@ bool UPlayFabClientInstanceAPI::UnlinkAndroidDeviceID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkAndroidDeviceID"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkAndroidDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkAndroidDeviceID"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlinkAndroidDeviceIDResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkAndroidDeviceIDResult>> UPlayFabClientInstanceAPI::UnlinkAndroidDeviceIDAsync(ClientModels::FUnlinkAndroidDeviceIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkAndroidDeviceIDResult, FUnlinkAndroidDeviceIDDelegate>([this, &request, &Handle](const FUnlinkAndroidDeviceIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlinkAndroidDeviceID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkAndroidDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkAndroidDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkAndroidDeviceIDResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkAndroidDeviceIDResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkAndroidDeviceIDResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlinkApple(
     ClientModels::FUnlinkAppleRequest& request,
     const FUnlinkAppleDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4482,29 +4959,32 @@ bool UPlayFabClientInstanceAPI::UnlinkApple(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkApple"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkAppleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkApple"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlinkAppleResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FEmptyResponse>> UPlayFabClientInstanceAPI::UnlinkAppleAsync(ClientModels::FUnlinkAppleRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FEmptyResponse, FUnlinkAppleDelegate>([this, &request, &Handle](const FUnlinkAppleDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlinkApple(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkAppleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkAppleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlinkCustomID(
     ClientModels::FUnlinkCustomIDRequest& request,
     const FUnlinkCustomIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4513,29 +4993,32 @@ bool UPlayFabClientInstanceAPI::UnlinkCustomID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkCustomID"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkCustomIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkCustomID"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlinkCustomIDResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkCustomIDResult>> UPlayFabClientInstanceAPI::UnlinkCustomIDAsync(ClientModels::FUnlinkCustomIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkCustomIDResult, FUnlinkCustomIDDelegate>([this, &request, &Handle](const FUnlinkCustomIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlinkCustomID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkCustomIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkCustomIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkCustomIDResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkCustomIDResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkCustomIDResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlinkFacebookAccount(
     ClientModels::FUnlinkFacebookAccountRequest& request,
     const FUnlinkFacebookAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4544,29 +5027,32 @@ bool UPlayFabClientInstanceAPI::UnlinkFacebookAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkFacebookAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkFacebookAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkFacebookAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlinkFacebookAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkFacebookAccountResult>> UPlayFabClientInstanceAPI::UnlinkFacebookAccountAsync(ClientModels::FUnlinkFacebookAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkFacebookAccountResult, FUnlinkFacebookAccountDelegate>([this, &request, &Handle](const FUnlinkFacebookAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlinkFacebookAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkFacebookAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkFacebookAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkFacebookAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkFacebookAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkFacebookAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlinkFacebookInstantGamesId(
     ClientModels::FUnlinkFacebookInstantGamesIdRequest& request,
     const FUnlinkFacebookInstantGamesIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4575,29 +5061,32 @@ bool UPlayFabClientInstanceAPI::UnlinkFacebookInstantGamesId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkFacebookInstantGamesId"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkFacebookInstantGamesIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkFacebookInstantGamesId"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlinkFacebookInstantGamesIdResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkFacebookInstantGamesIdResult>> UPlayFabClientInstanceAPI::UnlinkFacebookInstantGamesIdAsync(ClientModels::FUnlinkFacebookInstantGamesIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkFacebookInstantGamesIdResult, FUnlinkFacebookInstantGamesIdDelegate>([this, &request, &Handle](const FUnlinkFacebookInstantGamesIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlinkFacebookInstantGamesId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkFacebookInstantGamesIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkFacebookInstantGamesIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkFacebookInstantGamesIdResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkFacebookInstantGamesIdResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkFacebookInstantGamesIdResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlinkGameCenterAccount(
     ClientModels::FUnlinkGameCenterAccountRequest& request,
     const FUnlinkGameCenterAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4606,29 +5095,32 @@ bool UPlayFabClientInstanceAPI::UnlinkGameCenterAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkGameCenterAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkGameCenterAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkGameCenterAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlinkGameCenterAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkGameCenterAccountResult>> UPlayFabClientInstanceAPI::UnlinkGameCenterAccountAsync(ClientModels::FUnlinkGameCenterAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkGameCenterAccountResult, FUnlinkGameCenterAccountDelegate>([this, &request, &Handle](const FUnlinkGameCenterAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlinkGameCenterAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkGameCenterAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkGameCenterAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkGameCenterAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkGameCenterAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkGameCenterAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlinkGoogleAccount(
     ClientModels::FUnlinkGoogleAccountRequest& request,
     const FUnlinkGoogleAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4637,29 +5129,32 @@ bool UPlayFabClientInstanceAPI::UnlinkGoogleAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkGoogleAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkGoogleAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkGoogleAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlinkGoogleAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkGoogleAccountResult>> UPlayFabClientInstanceAPI::UnlinkGoogleAccountAsync(ClientModels::FUnlinkGoogleAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkGoogleAccountResult, FUnlinkGoogleAccountDelegate>([this, &request, &Handle](const FUnlinkGoogleAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlinkGoogleAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkGoogleAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkGoogleAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkGoogleAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkGoogleAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkGoogleAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlinkIOSDeviceID(
     ClientModels::FUnlinkIOSDeviceIDRequest& request,
     const FUnlinkIOSDeviceIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4668,29 +5163,32 @@ bool UPlayFabClientInstanceAPI::UnlinkIOSDeviceID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkIOSDeviceID"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkIOSDeviceIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkIOSDeviceID"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlinkIOSDeviceIDResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkIOSDeviceIDResult>> UPlayFabClientInstanceAPI::UnlinkIOSDeviceIDAsync(ClientModels::FUnlinkIOSDeviceIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkIOSDeviceIDResult, FUnlinkIOSDeviceIDDelegate>([this, &request, &Handle](const FUnlinkIOSDeviceIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlinkIOSDeviceID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkIOSDeviceIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkIOSDeviceIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkIOSDeviceIDResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkIOSDeviceIDResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkIOSDeviceIDResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlinkKongregate(
     ClientModels::FUnlinkKongregateAccountRequest& request,
     const FUnlinkKongregateDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4699,29 +5197,32 @@ bool UPlayFabClientInstanceAPI::UnlinkKongregate(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkKongregate"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkKongregateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkKongregate"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlinkKongregateResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkKongregateAccountResult>> UPlayFabClientInstanceAPI::UnlinkKongregateAsync(ClientModels::FUnlinkKongregateAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkKongregateAccountResult, FUnlinkKongregateDelegate>([this, &request, &Handle](const FUnlinkKongregateDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlinkKongregate(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkKongregateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkKongregateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkKongregateAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkKongregateAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkKongregateAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlinkNintendoServiceAccount(
     ClientModels::FUnlinkNintendoServiceAccountRequest& request,
     const FUnlinkNintendoServiceAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4730,29 +5231,32 @@ bool UPlayFabClientInstanceAPI::UnlinkNintendoServiceAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkNintendoServiceAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkNintendoServiceAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlinkNintendoServiceAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FEmptyResponse>> UPlayFabClientInstanceAPI::UnlinkNintendoServiceAccountAsync(ClientModels::FUnlinkNintendoServiceAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FEmptyResponse, FUnlinkNintendoServiceAccountDelegate>([this, &request, &Handle](const FUnlinkNintendoServiceAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlinkNintendoServiceAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkNintendoServiceAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkNintendoServiceAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlinkNintendoSwitchDeviceId(
     ClientModels::FUnlinkNintendoSwitchDeviceIdRequest& request,
     const FUnlinkNintendoSwitchDeviceIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4761,29 +5265,32 @@ bool UPlayFabClientInstanceAPI::UnlinkNintendoSwitchDeviceId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkNintendoSwitchDeviceId"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkNintendoSwitchDeviceId"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlinkNintendoSwitchDeviceIdResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkNintendoSwitchDeviceIdResult>> UPlayFabClientInstanceAPI::UnlinkNintendoSwitchDeviceIdAsync(ClientModels::FUnlinkNintendoSwitchDeviceIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkNintendoSwitchDeviceIdResult, FUnlinkNintendoSwitchDeviceIdDelegate>([this, &request, &Handle](const FUnlinkNintendoSwitchDeviceIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlinkNintendoSwitchDeviceId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkNintendoSwitchDeviceIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkNintendoSwitchDeviceIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkNintendoSwitchDeviceIdResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkNintendoSwitchDeviceIdResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkNintendoSwitchDeviceIdResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlinkOpenIdConnect(
     ClientModels::FUnlinkOpenIdConnectRequest& request,
     const FUnlinkOpenIdConnectDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4792,29 +5299,32 @@ bool UPlayFabClientInstanceAPI::UnlinkOpenIdConnect(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkOpenIdConnect"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkOpenIdConnectResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkOpenIdConnect"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlinkOpenIdConnectResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FEmptyResponse>> UPlayFabClientInstanceAPI::UnlinkOpenIdConnectAsync(ClientModels::FUnlinkOpenIdConnectRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FEmptyResponse, FUnlinkOpenIdConnectDelegate>([this, &request, &Handle](const FUnlinkOpenIdConnectDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlinkOpenIdConnect(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkOpenIdConnectResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkOpenIdConnectDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlinkPSNAccount(
     ClientModels::FUnlinkPSNAccountRequest& request,
     const FUnlinkPSNAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4823,29 +5333,32 @@ bool UPlayFabClientInstanceAPI::UnlinkPSNAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkPSNAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkPSNAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkPSNAccountResult>> UPlayFabClientInstanceAPI::UnlinkPSNAccountAsync(ClientModels::FUnlinkPSNAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkPSNAccountResult, FUnlinkPSNAccountDelegate>([this, &request, &Handle](const FUnlinkPSNAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlinkPSNAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkPSNAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkPSNAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkPSNAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkPSNAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkPSNAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlinkSteamAccount(
     ClientModels::FUnlinkSteamAccountRequest& request,
     const FUnlinkSteamAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4854,29 +5367,32 @@ bool UPlayFabClientInstanceAPI::UnlinkSteamAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkSteamAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkSteamAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkSteamAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlinkSteamAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkSteamAccountResult>> UPlayFabClientInstanceAPI::UnlinkSteamAccountAsync(ClientModels::FUnlinkSteamAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkSteamAccountResult, FUnlinkSteamAccountDelegate>([this, &request, &Handle](const FUnlinkSteamAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlinkSteamAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkSteamAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkSteamAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkSteamAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkSteamAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkSteamAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlinkTwitch(
     ClientModels::FUnlinkTwitchAccountRequest& request,
     const FUnlinkTwitchDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4885,29 +5401,32 @@ bool UPlayFabClientInstanceAPI::UnlinkTwitch(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkTwitch"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkTwitchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkTwitch"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlinkTwitchResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkTwitchAccountResult>> UPlayFabClientInstanceAPI::UnlinkTwitchAsync(ClientModels::FUnlinkTwitchAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkTwitchAccountResult, FUnlinkTwitchDelegate>([this, &request, &Handle](const FUnlinkTwitchDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlinkTwitch(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkTwitchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkTwitchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkTwitchAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkTwitchAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkTwitchAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlinkWindowsHello(
     ClientModels::FUnlinkWindowsHelloAccountRequest& request,
     const FUnlinkWindowsHelloDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4916,29 +5435,32 @@ bool UPlayFabClientInstanceAPI::UnlinkWindowsHello(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkWindowsHello"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkWindowsHelloResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkWindowsHello"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlinkWindowsHelloResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkWindowsHelloAccountResponse>> UPlayFabClientInstanceAPI::UnlinkWindowsHelloAsync(ClientModels::FUnlinkWindowsHelloAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkWindowsHelloAccountResponse, FUnlinkWindowsHelloDelegate>([this, &request, &Handle](const FUnlinkWindowsHelloDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlinkWindowsHello(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkWindowsHelloResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkWindowsHelloDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkWindowsHelloAccountResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkWindowsHelloAccountResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkWindowsHelloAccountResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlinkXboxAccount(
     ClientModels::FUnlinkXboxAccountRequest& request,
     const FUnlinkXboxAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4947,29 +5469,32 @@ bool UPlayFabClientInstanceAPI::UnlinkXboxAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkXboxAccount"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlinkXboxAccount"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlinkXboxAccountResult>> UPlayFabClientInstanceAPI::UnlinkXboxAccountAsync(ClientModels::FUnlinkXboxAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlinkXboxAccountResult, FUnlinkXboxAccountDelegate>([this, &request, &Handle](const FUnlinkXboxAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlinkXboxAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlinkXboxAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkXboxAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlinkXboxAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlinkXboxAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlinkXboxAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlockContainerInstance(
     ClientModels::FUnlockContainerInstanceRequest& request,
     const FUnlockContainerInstanceDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -4978,29 +5503,32 @@ bool UPlayFabClientInstanceAPI::UnlockContainerInstance(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlockContainerInstance"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlockContainerInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlockContainerInstance"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlockContainerInstanceResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlockContainerItemResult>> UPlayFabClientInstanceAPI::UnlockContainerInstanceAsync(ClientModels::FUnlockContainerInstanceRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlockContainerItemResult, FUnlockContainerInstanceDelegate>([this, &request, &Handle](const FUnlockContainerInstanceDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlockContainerInstance(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlockContainerInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlockContainerInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlockContainerItemResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlockContainerItemResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlockContainerItemResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UnlockContainerItem(
     ClientModels::FUnlockContainerItemRequest& request,
     const FUnlockContainerItemDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -5009,29 +5537,32 @@ bool UPlayFabClientInstanceAPI::UnlockContainerItem(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlockContainerItem"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUnlockContainerItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UnlockContainerItem"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUnlockContainerItemResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUnlockContainerItemResult>> UPlayFabClientInstanceAPI::UnlockContainerItemAsync(ClientModels::FUnlockContainerItemRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUnlockContainerItemResult, FUnlockContainerItemDelegate>([this, &request, &Handle](const FUnlockContainerItemDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UnlockContainerItem(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUnlockContainerItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlockContainerItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUnlockContainerItemResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUnlockContainerItemResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUnlockContainerItemResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UpdateAvatarUrl(
     ClientModels::FUpdateAvatarUrlRequest& request,
     const FUpdateAvatarUrlDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -5040,29 +5571,32 @@ bool UPlayFabClientInstanceAPI::UpdateAvatarUrl(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateAvatarUrl"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUpdateAvatarUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateAvatarUrl"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUpdateAvatarUrlResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FEmptyResponse>> UPlayFabClientInstanceAPI::UpdateAvatarUrlAsync(ClientModels::FUpdateAvatarUrlRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FEmptyResponse, FUpdateAvatarUrlDelegate>([this, &request, &Handle](const FUpdateAvatarUrlDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UpdateAvatarUrl(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUpdateAvatarUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateAvatarUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UpdateCharacterData(
     ClientModels::FUpdateCharacterDataRequest& request,
     const FUpdateCharacterDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -5071,29 +5605,32 @@ bool UPlayFabClientInstanceAPI::UpdateCharacterData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateCharacterData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUpdateCharacterDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateCharacterData"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUpdateCharacterDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUpdateCharacterDataResult>> UPlayFabClientInstanceAPI::UpdateCharacterDataAsync(ClientModels::FUpdateCharacterDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUpdateCharacterDataResult, FUpdateCharacterDataDelegate>([this, &request, &Handle](const FUpdateCharacterDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UpdateCharacterData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUpdateCharacterDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUpdateCharacterDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUpdateCharacterDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUpdateCharacterDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UpdateCharacterStatistics(
     ClientModels::FUpdateCharacterStatisticsRequest& request,
     const FUpdateCharacterStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -5102,29 +5639,32 @@ bool UPlayFabClientInstanceAPI::UpdateCharacterStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateCharacterStatistics"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUpdateCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateCharacterStatistics"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUpdateCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUpdateCharacterStatisticsResult>> UPlayFabClientInstanceAPI::UpdateCharacterStatisticsAsync(ClientModels::FUpdateCharacterStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUpdateCharacterStatisticsResult, FUpdateCharacterStatisticsDelegate>([this, &request, &Handle](const FUpdateCharacterStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UpdateCharacterStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUpdateCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUpdateCharacterStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUpdateCharacterStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUpdateCharacterStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UpdatePlayerStatistics(
     ClientModels::FUpdatePlayerStatisticsRequest& request,
     const FUpdatePlayerStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -5133,29 +5673,32 @@ bool UPlayFabClientInstanceAPI::UpdatePlayerStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdatePlayerStatistics"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUpdatePlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdatePlayerStatistics"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUpdatePlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUpdatePlayerStatisticsResult>> UPlayFabClientInstanceAPI::UpdatePlayerStatisticsAsync(ClientModels::FUpdatePlayerStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUpdatePlayerStatisticsResult, FUpdatePlayerStatisticsDelegate>([this, &request, &Handle](const FUpdatePlayerStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UpdatePlayerStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUpdatePlayerStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUpdatePlayerStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUpdatePlayerStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUpdatePlayerStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UpdateSharedGroupData(
     ClientModels::FUpdateSharedGroupDataRequest& request,
     const FUpdateSharedGroupDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -5164,29 +5707,32 @@ bool UPlayFabClientInstanceAPI::UpdateSharedGroupData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateSharedGroupData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUpdateSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateSharedGroupData"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUpdateSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUpdateSharedGroupDataResult>> UPlayFabClientInstanceAPI::UpdateSharedGroupDataAsync(ClientModels::FUpdateSharedGroupDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUpdateSharedGroupDataResult, FUpdateSharedGroupDataDelegate>([this, &request, &Handle](const FUpdateSharedGroupDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UpdateSharedGroupData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUpdateSharedGroupDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateSharedGroupDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUpdateSharedGroupDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUpdateSharedGroupDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUpdateSharedGroupDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UpdateUserData(
     ClientModels::FUpdateUserDataRequest& request,
     const FUpdateUserDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -5195,29 +5741,32 @@ bool UPlayFabClientInstanceAPI::UpdateUserData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateUserData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUpdateUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateUserData"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUpdateUserDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUpdateUserDataResult>> UPlayFabClientInstanceAPI::UpdateUserDataAsync(ClientModels::FUpdateUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUpdateUserDataResult, FUpdateUserDataDelegate>([this, &request, &Handle](const FUpdateUserDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UpdateUserData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUpdateUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UpdateUserPublisherData(
     ClientModels::FUpdateUserDataRequest& request,
     const FUpdateUserPublisherDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -5226,29 +5775,32 @@ bool UPlayFabClientInstanceAPI::UpdateUserPublisherData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateUserPublisherData"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUpdateUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateUserPublisherData"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUpdateUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUpdateUserDataResult>> UPlayFabClientInstanceAPI::UpdateUserPublisherDataAsync(ClientModels::FUpdateUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUpdateUserDataResult, FUpdateUserPublisherDataDelegate>([this, &request, &Handle](const FUpdateUserPublisherDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UpdateUserPublisherData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUpdateUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::UpdateUserTitleDisplayName(
     ClientModels::FUpdateUserTitleDisplayNameRequest& request,
     const FUpdateUserTitleDisplayNameDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -5257,29 +5809,32 @@ bool UPlayFabClientInstanceAPI::UpdateUserTitleDisplayName(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateUserTitleDisplayName"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnUpdateUserTitleDisplayNameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/UpdateUserTitleDisplayName"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnUpdateUserTitleDisplayNameResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FUpdateUserTitleDisplayNameResult>> UPlayFabClientInstanceAPI::UpdateUserTitleDisplayNameAsync(ClientModels::FUpdateUserTitleDisplayNameRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FUpdateUserTitleDisplayNameResult, FUpdateUserTitleDisplayNameDelegate>([this, &request, &Handle](const FUpdateUserTitleDisplayNameDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::UpdateUserTitleDisplayName(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnUpdateUserTitleDisplayNameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserTitleDisplayNameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FUpdateUserTitleDisplayNameResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FUpdateUserTitleDisplayNameResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FUpdateUserTitleDisplayNameResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::ValidateAmazonIAPReceipt(
     ClientModels::FValidateAmazonReceiptRequest& request,
     const FValidateAmazonIAPReceiptDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -5288,29 +5843,32 @@ bool UPlayFabClientInstanceAPI::ValidateAmazonIAPReceipt(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ValidateAmazonIAPReceipt"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnValidateAmazonIAPReceiptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ValidateAmazonIAPReceipt"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnValidateAmazonIAPReceiptResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FValidateAmazonReceiptResult>> UPlayFabClientInstanceAPI::ValidateAmazonIAPReceiptAsync(ClientModels::FValidateAmazonReceiptRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FValidateAmazonReceiptResult, FValidateAmazonIAPReceiptDelegate>([this, &request, &Handle](const FValidateAmazonIAPReceiptDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::ValidateAmazonIAPReceipt(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnValidateAmazonIAPReceiptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateAmazonIAPReceiptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FValidateAmazonReceiptResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FValidateAmazonReceiptResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FValidateAmazonReceiptResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::ValidateGooglePlayPurchase(
     ClientModels::FValidateGooglePlayPurchaseRequest& request,
     const FValidateGooglePlayPurchaseDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -5319,29 +5877,32 @@ bool UPlayFabClientInstanceAPI::ValidateGooglePlayPurchase(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ValidateGooglePlayPurchase"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnValidateGooglePlayPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ValidateGooglePlayPurchase"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnValidateGooglePlayPurchaseResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FValidateGooglePlayPurchaseResult>> UPlayFabClientInstanceAPI::ValidateGooglePlayPurchaseAsync(ClientModels::FValidateGooglePlayPurchaseRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FValidateGooglePlayPurchaseResult, FValidateGooglePlayPurchaseDelegate>([this, &request, &Handle](const FValidateGooglePlayPurchaseDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::ValidateGooglePlayPurchase(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnValidateGooglePlayPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateGooglePlayPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FValidateGooglePlayPurchaseResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FValidateGooglePlayPurchaseResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FValidateGooglePlayPurchaseResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::ValidateIOSReceipt(
     ClientModels::FValidateIOSReceiptRequest& request,
     const FValidateIOSReceiptDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -5350,29 +5911,32 @@ bool UPlayFabClientInstanceAPI::ValidateIOSReceipt(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ValidateIOSReceipt"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnValidateIOSReceiptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ValidateIOSReceipt"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnValidateIOSReceiptResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FValidateIOSReceiptResult>> UPlayFabClientInstanceAPI::ValidateIOSReceiptAsync(ClientModels::FValidateIOSReceiptRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FValidateIOSReceiptResult, FValidateIOSReceiptDelegate>([this, &request, &Handle](const FValidateIOSReceiptDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::ValidateIOSReceipt(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnValidateIOSReceiptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateIOSReceiptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FValidateIOSReceiptResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FValidateIOSReceiptResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FValidateIOSReceiptResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::ValidateWindowsStoreReceipt(
     ClientModels::FValidateWindowsReceiptRequest& request,
     const FValidateWindowsStoreReceiptDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -5381,29 +5945,32 @@ bool UPlayFabClientInstanceAPI::ValidateWindowsStoreReceipt(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ValidateWindowsStoreReceipt"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnValidateWindowsStoreReceiptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/ValidateWindowsStoreReceipt"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnValidateWindowsStoreReceiptResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FValidateWindowsReceiptResult>> UPlayFabClientInstanceAPI::ValidateWindowsStoreReceiptAsync(ClientModels::FValidateWindowsReceiptRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FValidateWindowsReceiptResult, FValidateWindowsStoreReceiptDelegate>([this, &request, &Handle](const FValidateWindowsStoreReceiptDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::ValidateWindowsStoreReceipt(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnValidateWindowsStoreReceiptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateWindowsStoreReceiptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FValidateWindowsReceiptResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FValidateWindowsReceiptResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FValidateWindowsReceiptResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::WriteCharacterEvent(
     ClientModels::FWriteClientCharacterEventRequest& request,
     const FWriteCharacterEventDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -5412,29 +5979,32 @@ bool UPlayFabClientInstanceAPI::WriteCharacterEvent(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/WriteCharacterEvent"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnWriteCharacterEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/WriteCharacterEvent"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnWriteCharacterEventResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Low, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FWriteEventResponse>> UPlayFabClientInstanceAPI::WriteCharacterEventAsync(ClientModels::FWriteClientCharacterEventRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FWriteEventResponse, FWriteCharacterEventDelegate>([this, &request, &Handle](const FWriteCharacterEventDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::WriteCharacterEvent(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnWriteCharacterEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteCharacterEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FWriteEventResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FWriteEventResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FWriteEventResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::WritePlayerEvent(
     ClientModels::FWriteClientPlayerEventRequest& request,
     const FWritePlayerEventDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -5443,29 +6013,32 @@ bool UPlayFabClientInstanceAPI::WritePlayerEvent(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/WritePlayerEvent"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnWritePlayerEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/WritePlayerEvent"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnWritePlayerEventResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Low, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FWriteEventResponse>> UPlayFabClientInstanceAPI::WritePlayerEventAsync(ClientModels::FWriteClientPlayerEventRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FWriteEventResponse, FWritePlayerEventDelegate>([this, &request, &Handle](const FWritePlayerEventDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::WritePlayerEvent(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnWritePlayerEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWritePlayerEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FWriteEventResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FWriteEventResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FWriteEventResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabClientInstanceAPI::WriteTitleEvent(
     ClientModels::FWriteTitleEventRequest& request,
     const FWriteTitleEventDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetClientSessionTicket().Len() == 0) {
@@ -5474,21 +6047,23 @@ bool UPlayFabClientInstanceAPI::WriteTitleEvent(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/WriteTitleEvent"), request.toJSONString(), TEXT("X-Authorization"), context->GetClientSessionTicket());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabClientInstanceAPI::OnWriteTitleEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Client/WriteTitleEvent"), request.toJSONUtf8(), TEXT("X-Authorization"), context->GetClientSessionTicket());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabClientInstanceAPI::OnWriteTitleEventResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Low, Handle);
+}
+
+TFuture<TPlayFabResult<ClientModels::FWriteEventResponse>> UPlayFabClientInstanceAPI::WriteTitleEventAsync(ClientModels::FWriteTitleEventRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ClientModels::FWriteEventResponse, FWriteTitleEventDelegate>([this, &request, &Handle](const FWriteTitleEventDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabClientInstanceAPI::WriteTitleEvent(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabClientInstanceAPI::OnWriteTitleEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteTitleEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ClientModels::FWriteEventResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ClientModels::FWriteEventResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ClientModels::FWriteEventResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
@@ -7,6 +7,7 @@
 
 #include "Core/PlayFabCloudScriptDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
+#include "Core/PlayFabJsonPullReader.h"
 
 using namespace PlayFab;
 using namespace PlayFab::CloudScriptModels;
@@ -16,7 +17,8 @@ PlayFab::CloudScriptModels::FAdCampaignAttributionModel::~FAdCampaignAttribution
 
 }
 
-void PlayFab::CloudScriptModels::FAdCampaignAttributionModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FAdCampaignAttributionModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -38,6 +40,16 @@ void PlayFab::CloudScriptModels::FAdCampaignAttributionModel::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FAdCampaignAttributionModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FAdCampaignAttributionModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FAdCampaignAttributionModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -64,7 +76,42 @@ bool PlayFab::CloudScriptModels::FAdCampaignAttributionModel::readFromValue(cons
     return HasSucceeded;
 }
 
-void PlayFab::CloudScriptModels::writeCloudScriptRevisionOptionEnumJSON(CloudScriptRevisionOption enumVal, JsonWriter& writer)
+bool PlayFab::CloudScriptModels::FAdCampaignAttributionModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AttributedAt"))
+        {
+            reader.ReadValue(AttributedAt);
+        }
+        else if (reader.IsField("CampaignId"))
+        {
+            reader.ReadValue(CampaignId);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            reader.ReadValue(Platform);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAdCampaignAttributionModel();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeCloudScriptRevisionOptionEnumValue(CloudScriptModels::CloudScriptRevisionOption enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -75,6 +122,16 @@ void PlayFab::CloudScriptModels::writeCloudScriptRevisionOptionEnumJSON(CloudScr
     }
 }
 
+void PlayFab::CloudScriptModels::writeCloudScriptRevisionOptionEnumJSON(CloudScriptRevisionOption enumVal, JsonWriter& writer)
+{
+    writeCloudScriptRevisionOptionEnumValue(enumVal, writer);
+}
+
+void PlayFab::CloudScriptModels::writeCloudScriptRevisionOptionEnumJSON(CloudScriptRevisionOption enumVal, JsonUtf8Writer& writer)
+{
+    writeCloudScriptRevisionOptionEnumValue(enumVal, writer);
+}
+
 CloudScriptModels::CloudScriptRevisionOption PlayFab::CloudScriptModels::readCloudScriptRevisionOptionFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readCloudScriptRevisionOptionFromValue(value.IsValid() ? value->AsString() : "");
@@ -102,7 +159,8 @@ CloudScriptModels::CloudScriptRevisionOption PlayFab::CloudScriptModels::readClo
     return CloudScriptRevisionOptionLive; // Basically critical fail
 }
 
-void PlayFab::CloudScriptModels::writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonWriter& writer)
+template <typename WriterType>
+static void writeEmailVerificationStatusEnumValue(CloudScriptModels::EmailVerificationStatus enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -113,6 +171,16 @@ void PlayFab::CloudScriptModels::writeEmailVerificationStatusEnumJSON(EmailVerif
     }
 }
 
+void PlayFab::CloudScriptModels::writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonWriter& writer)
+{
+    writeEmailVerificationStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::CloudScriptModels::writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeEmailVerificationStatusEnumValue(enumVal, writer);
+}
+
 CloudScriptModels::EmailVerificationStatus PlayFab::CloudScriptModels::readEmailVerificationStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readEmailVerificationStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -145,7 +213,8 @@ PlayFab::CloudScriptModels::FContactEmailInfoModel::~FContactEmailInfoModel()
 
 }
 
-void PlayFab::CloudScriptModels::FContactEmailInfoModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FContactEmailInfoModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -170,6 +239,16 @@ void PlayFab::CloudScriptModels::FContactEmailInfoModel::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FContactEmailInfoModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FContactEmailInfoModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FContactEmailInfoModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -193,7 +272,43 @@ bool PlayFab::CloudScriptModels::FContactEmailInfoModel::readFromValue(const TSh
     return HasSucceeded;
 }
 
-void PlayFab::CloudScriptModels::writeContinentCodeEnumJSON(ContinentCode enumVal, JsonWriter& writer)
+bool PlayFab::CloudScriptModels::FContactEmailInfoModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("EmailAddress"))
+        {
+            reader.ReadValue(EmailAddress);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("VerificationStatus"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { VerificationStatus = readEmailVerificationStatusFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FContactEmailInfoModel();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeContinentCodeEnumValue(CloudScriptModels::ContinentCode enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -208,6 +323,16 @@ void PlayFab::CloudScriptModels::writeContinentCodeEnumJSON(ContinentCode enumVa
     }
 }
 
+void PlayFab::CloudScriptModels::writeContinentCodeEnumJSON(ContinentCode enumVal, JsonWriter& writer)
+{
+    writeContinentCodeEnumValue(enumVal, writer);
+}
+
+void PlayFab::CloudScriptModels::writeContinentCodeEnumJSON(ContinentCode enumVal, JsonUtf8Writer& writer)
+{
+    writeContinentCodeEnumValue(enumVal, writer);
+}
+
 CloudScriptModels::ContinentCode PlayFab::CloudScriptModels::readContinentCodeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readContinentCodeFromValue(value.IsValid() ? value->AsString() : "");
@@ -239,7 +364,8 @@ CloudScriptModels::ContinentCode PlayFab::CloudScriptModels::readContinentCodeFr
     return ContinentCodeAF; // Basically critical fail
 }
 
-void PlayFab::CloudScriptModels::writeCountryCodeEnumJSON(CountryCode enumVal, JsonWriter& writer)
+template <typename WriterType>
+static void writeCountryCodeEnumValue(CloudScriptModels::CountryCode enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -496,6 +622,16 @@ void PlayFab::CloudScriptModels::writeCountryCodeEnumJSON(CountryCode enumVal, J
     }
 }
 
+void PlayFab::CloudScriptModels::writeCountryCodeEnumJSON(CountryCode enumVal, JsonWriter& writer)
+{
+    writeCountryCodeEnumValue(enumVal, writer);
+}
+
+void PlayFab::CloudScriptModels::writeCountryCodeEnumJSON(CountryCode enumVal, JsonUtf8Writer& writer)
+{
+    writeCountryCodeEnumValue(enumVal, writer);
+}
+
 CloudScriptModels::CountryCode PlayFab::CloudScriptModels::readCountryCodeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readCountryCodeFromValue(value.IsValid() ? value->AsString() : "");
@@ -774,13 +910,24 @@ PlayFab::CloudScriptModels::FEmptyResult::~FEmptyResult()
 
 }
 
-void PlayFab::CloudScriptModels::FEmptyResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FEmptyResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FEmptyResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FEmptyResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FEmptyResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -788,12 +935,34 @@ bool PlayFab::CloudScriptModels::FEmptyResult::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FEmptyResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEmptyResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FEntityKey::~FEntityKey()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FEntityKey::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FEntityKey::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -816,6 +985,16 @@ void PlayFab::CloudScriptModels::FEntityKey::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FEntityKey::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FEntityKey::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FEntityKey::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -837,12 +1016,43 @@ bool PlayFab::CloudScriptModels::FEntityKey::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FEntityKey::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Type"))
+        {
+            reader.ReadValue(Type);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityKey();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FScriptExecutionError::~FScriptExecutionError()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FScriptExecutionError::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FScriptExecutionError::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -867,6 +1077,16 @@ void PlayFab::CloudScriptModels::FScriptExecutionError::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FScriptExecutionError::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FScriptExecutionError::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FScriptExecutionError::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -895,12 +1115,47 @@ bool PlayFab::CloudScriptModels::FScriptExecutionError::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FScriptExecutionError::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Error"))
+        {
+            reader.ReadValue(Error);
+        }
+        else if (reader.IsField("Message"))
+        {
+            reader.ReadValue(Message);
+        }
+        else if (reader.IsField("StackTrace"))
+        {
+            reader.ReadValue(StackTrace);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FScriptExecutionError();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FLogStatement::~FLogStatement()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FLogStatement::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FLogStatement::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -925,6 +1180,16 @@ void PlayFab::CloudScriptModels::FLogStatement::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FLogStatement::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FLogStatement::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FLogStatement::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -952,13 +1217,48 @@ bool PlayFab::CloudScriptModels::FLogStatement::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FLogStatement::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            Data.readFromReader(reader);
+        }
+        else if (reader.IsField("Level"))
+        {
+            reader.ReadValue(Level);
+        }
+        else if (reader.IsField("Message"))
+        {
+            reader.ReadValue(Message);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLogStatement();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FExecuteCloudScriptResult::~FExecuteCloudScriptResult()
 {
     //if (Error != nullptr) delete Error;
 
 }
 
-void PlayFab::CloudScriptModels::FExecuteCloudScriptResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FExecuteCloudScriptResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1022,6 +1322,16 @@ void PlayFab::CloudScriptModels::FExecuteCloudScriptResult::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FExecuteCloudScriptResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FExecuteCloudScriptResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FExecuteCloudScriptResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1036,7 +1346,7 @@ bool PlayFab::CloudScriptModels::FExecuteCloudScriptResult::readFromValue(const
     const TSharedPtr<FJsonValue> ErrorValue = obj->TryGetField(TEXT("Error"));
     if (ErrorValue.IsValid() && !ErrorValue->IsNull())
     {
-        Error = MakeShareable(new FScriptExecutionError(ErrorValue->AsObject()));
+        Error = MakeShared<FScriptExecutionError>(ErrorValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ExecutionTimeSecondsValue = obj->TryGetField(TEXT("ExecutionTimeSeconds"));
@@ -1077,7 +1387,7 @@ bool PlayFab::CloudScriptModels::FExecuteCloudScriptResult::readFromValue(const
     for (int32 Idx = 0; Idx < LogsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LogsArray[Idx];
-        Logs.Add(FLogStatement(CurrentItem->AsObject()));
+        Logs.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -1112,13 +1422,92 @@ bool PlayFab::CloudScriptModels::FExecuteCloudScriptResult::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FExecuteCloudScriptResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("APIRequestsIssued"))
+        {
+            reader.ReadValue(APIRequestsIssued);
+        }
+        else if (reader.IsField("Error"))
+        {
+            Error = MakeShared<FScriptExecutionError>();
+            Error->readFromReader(reader);
+        }
+        else if (reader.IsField("ExecutionTimeSeconds"))
+        {
+            reader.ReadValue(ExecutionTimeSeconds);
+        }
+        else if (reader.IsField("FunctionName"))
+        {
+            reader.ReadValue(FunctionName);
+        }
+        else if (reader.IsField("FunctionResult"))
+        {
+            FunctionResult.readFromReader(reader);
+        }
+        else if (reader.IsField("FunctionResultTooLarge"))
+        {
+            reader.ReadValue(FunctionResultTooLarge);
+        }
+        else if (reader.IsField("HttpRequestsIssued"))
+        {
+            reader.ReadValue(HttpRequestsIssued);
+        }
+        else if (reader.IsField("Logs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Logs[Logs.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("LogsTooLarge"))
+        {
+            reader.ReadValue(LogsTooLarge);
+        }
+        else if (reader.IsField("MemoryConsumedBytes"))
+        {
+            reader.ReadValue(MemoryConsumedBytes);
+        }
+        else if (reader.IsField("ProcessorTimeSeconds"))
+        {
+            reader.ReadValue(ProcessorTimeSeconds);
+        }
+        else if (reader.IsField("Revision"))
+        {
+            reader.ReadValue(Revision);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FExecuteCloudScriptResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FExecuteEntityCloudScriptRequest::~FExecuteEntityCloudScriptRequest()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::CloudScriptModels::FExecuteEntityCloudScriptRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FExecuteEntityCloudScriptRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1176,6 +1565,16 @@ void PlayFab::CloudScriptModels::FExecuteEntityCloudScriptRequest::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FExecuteEntityCloudScriptRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FExecuteEntityCloudScriptRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FExecuteEntityCloudScriptRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1185,14 +1584,14 @@ bool PlayFab::CloudScriptModels::FExecuteEntityCloudScriptRequest::readFromValue
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> FunctionNameValue = obj->TryGetField(TEXT("FunctionName"));
@@ -1227,13 +1626,73 @@ bool PlayFab::CloudScriptModels::FExecuteEntityCloudScriptRequest::readFromValue
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FExecuteEntityCloudScriptRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("FunctionName"))
+        {
+            reader.ReadValue(FunctionName);
+        }
+        else if (reader.IsField("FunctionParameter"))
+        {
+            FunctionParameter.readFromReader(reader);
+        }
+        else if (reader.IsField("GeneratePlayStreamEvent"))
+        {
+            reader.ReadValue(GeneratePlayStreamEvent);
+        }
+        else if (reader.IsField("RevisionSelection"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { RevisionSelection = readCloudScriptRevisionOptionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("SpecificRevision"))
+        {
+            reader.ReadValue(SpecificRevision);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FExecuteEntityCloudScriptRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FExecuteFunctionRequest::~FExecuteFunctionRequest()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::CloudScriptModels::FExecuteFunctionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FExecuteFunctionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1279,6 +1738,16 @@ void PlayFab::CloudScriptModels::FExecuteFunctionRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FExecuteFunctionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FExecuteFunctionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FExecuteFunctionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1288,14 +1757,14 @@ bool PlayFab::CloudScriptModels::FExecuteFunctionRequest::readFromValue(const TS
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> FunctionNameValue = obj->TryGetField(TEXT("FunctionName"));
@@ -1321,14 +1790,65 @@ bool PlayFab::CloudScriptModels::FExecuteFunctionRequest::readFromValue(const TS
     return HasSucceeded;
 }
 
-PlayFab::CloudScriptModels::FFunctionExecutionError::~FFunctionExecutionError()
+bool PlayFab::CloudScriptModels::FExecuteFunctionRequest::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::CloudScriptModels::FFunctionExecutionError::writeJSON(JsonWriter& writer) const
-{
-    writer->WriteObjectStart();
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("FunctionName"))
+        {
+            reader.ReadValue(FunctionName);
+        }
+        else if (reader.IsField("FunctionParameter"))
+        {
+            FunctionParameter.readFromReader(reader);
+        }
+        else if (reader.IsField("GeneratePlayStreamEvent"))
+        {
+            reader.ReadValue(GeneratePlayStreamEvent);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FExecuteFunctionRequest();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::CloudScriptModels::FFunctionExecutionError::~FFunctionExecutionError()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FFunctionExecutionError::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
 
     if (Error.IsEmpty() == false)
     {
@@ -1351,6 +1871,16 @@ void PlayFab::CloudScriptModels::FFunctionExecutionError::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FFunctionExecutionError::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FFunctionExecutionError::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FFunctionExecutionError::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1379,13 +1909,48 @@ bool PlayFab::CloudScriptModels::FFunctionExecutionError::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FFunctionExecutionError::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Error"))
+        {
+            reader.ReadValue(Error);
+        }
+        else if (reader.IsField("Message"))
+        {
+            reader.ReadValue(Message);
+        }
+        else if (reader.IsField("StackTrace"))
+        {
+            reader.ReadValue(StackTrace);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FFunctionExecutionError();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FExecuteFunctionResult::~FExecuteFunctionResult()
 {
     //if (Error != nullptr) delete Error;
 
 }
 
-void PlayFab::CloudScriptModels::FExecuteFunctionResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FExecuteFunctionResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1419,6 +1984,16 @@ void PlayFab::CloudScriptModels::FExecuteFunctionResult::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FExecuteFunctionResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FExecuteFunctionResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FExecuteFunctionResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1426,7 +2001,7 @@ bool PlayFab::CloudScriptModels::FExecuteFunctionResult::readFromValue(const TSh
     const TSharedPtr<FJsonValue> ErrorValue = obj->TryGetField(TEXT("Error"));
     if (ErrorValue.IsValid() && !ErrorValue->IsNull())
     {
-        Error = MakeShareable(new FFunctionExecutionError(ErrorValue->AsObject()));
+        Error = MakeShared<FFunctionExecutionError>(ErrorValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ExecutionTimeMillisecondsValue = obj->TryGetField(TEXT("ExecutionTimeMilliseconds"));
@@ -1459,12 +2034,56 @@ bool PlayFab::CloudScriptModels::FExecuteFunctionResult::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FExecuteFunctionResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Error"))
+        {
+            Error = MakeShared<FFunctionExecutionError>();
+            Error->readFromReader(reader);
+        }
+        else if (reader.IsField("ExecutionTimeMilliseconds"))
+        {
+            reader.ReadValue(ExecutionTimeMilliseconds);
+        }
+        else if (reader.IsField("FunctionName"))
+        {
+            reader.ReadValue(FunctionName);
+        }
+        else if (reader.IsField("FunctionResult"))
+        {
+            FunctionResult.readFromReader(reader);
+        }
+        else if (reader.IsField("FunctionResultTooLarge"))
+        {
+            reader.ReadValue(FunctionResultTooLarge);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FExecuteFunctionResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FFunctionModel::~FFunctionModel()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FFunctionModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FFunctionModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1489,6 +2108,16 @@ void PlayFab::CloudScriptModels::FFunctionModel::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FFunctionModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FFunctionModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FFunctionModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1517,12 +2146,47 @@ bool PlayFab::CloudScriptModels::FFunctionModel::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FFunctionModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FunctionAddress"))
+        {
+            reader.ReadValue(FunctionAddress);
+        }
+        else if (reader.IsField("FunctionName"))
+        {
+            reader.ReadValue(FunctionName);
+        }
+        else if (reader.IsField("TriggerType"))
+        {
+            reader.ReadValue(TriggerType);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FFunctionModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FHttpFunctionModel::~FHttpFunctionModel()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FHttpFunctionModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FHttpFunctionModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1541,6 +2205,16 @@ void PlayFab::CloudScriptModels::FHttpFunctionModel::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FHttpFunctionModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FHttpFunctionModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FHttpFunctionModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1562,7 +2236,38 @@ bool PlayFab::CloudScriptModels::FHttpFunctionModel::readFromValue(const TShared
     return HasSucceeded;
 }
 
-void PlayFab::CloudScriptModels::writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonWriter& writer)
+bool PlayFab::CloudScriptModels::FHttpFunctionModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FunctionName"))
+        {
+            reader.ReadValue(FunctionName);
+        }
+        else if (reader.IsField("FunctionUrl"))
+        {
+            reader.ReadValue(FunctionUrl);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FHttpFunctionModel();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeLoginIdentityProviderEnumValue(CloudScriptModels::LoginIdentityProvider enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -1591,6 +2296,16 @@ void PlayFab::CloudScriptModels::writeLoginIdentityProviderEnumJSON(LoginIdentit
     }
 }
 
+void PlayFab::CloudScriptModels::writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonWriter& writer)
+{
+    writeLoginIdentityProviderEnumValue(enumVal, writer);
+}
+
+void PlayFab::CloudScriptModels::writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonUtf8Writer& writer)
+{
+    writeLoginIdentityProviderEnumValue(enumVal, writer);
+}
+
 CloudScriptModels::LoginIdentityProvider PlayFab::CloudScriptModels::readLoginIdentityProviderFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readLoginIdentityProviderFromValue(value.IsValid() ? value->AsString() : "");
@@ -1641,7 +2356,8 @@ PlayFab::CloudScriptModels::FLinkedPlatformAccountModel::~FLinkedPlatformAccount
 
 }
 
-void PlayFab::CloudScriptModels::FLinkedPlatformAccountModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FLinkedPlatformAccountModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1672,6 +2388,16 @@ void PlayFab::CloudScriptModels::FLinkedPlatformAccountModel::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FLinkedPlatformAccountModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FLinkedPlatformAccountModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FLinkedPlatformAccountModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1702,12 +2428,52 @@ bool PlayFab::CloudScriptModels::FLinkedPlatformAccountModel::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FLinkedPlatformAccountModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Email"))
+        {
+            reader.ReadValue(Email);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Platform = readLoginIdentityProviderFromValue(TmpValue); }
+        }
+        else if (reader.IsField("PlatformUserId"))
+        {
+            reader.ReadValue(PlatformUserId);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkedPlatformAccountModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FListFunctionsRequest::~FListFunctionsRequest()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FListFunctionsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FListFunctionsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1725,6 +2491,16 @@ void PlayFab::CloudScriptModels::FListFunctionsRequest::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FListFunctionsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FListFunctionsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FListFunctionsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1734,19 +2510,53 @@ bool PlayFab::CloudScriptModels::FListFunctionsRequest::readFromValue(const TSha
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FListFunctionsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListFunctionsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FListFunctionsResult::~FListFunctionsResult()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FListFunctionsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FListFunctionsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1762,6 +2572,16 @@ void PlayFab::CloudScriptModels::FListFunctionsResult::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FListFunctionsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FListFunctionsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FListFunctionsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1770,19 +2590,53 @@ bool PlayFab::CloudScriptModels::FListFunctionsResult::readFromValue(const TShar
     for (int32 Idx = 0; Idx < FunctionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = FunctionsArray[Idx];
-        Functions.Add(FFunctionModel(CurrentItem->AsObject()));
+        Functions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FListFunctionsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Functions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Functions[Functions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListFunctionsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FListHttpFunctionsResult::~FListHttpFunctionsResult()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FListHttpFunctionsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FListHttpFunctionsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1798,6 +2652,16 @@ void PlayFab::CloudScriptModels::FListHttpFunctionsResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FListHttpFunctionsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FListHttpFunctionsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FListHttpFunctionsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1806,19 +2670,53 @@ bool PlayFab::CloudScriptModels::FListHttpFunctionsResult::readFromValue(const T
     for (int32 Idx = 0; Idx < FunctionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = FunctionsArray[Idx];
-        Functions.Add(FHttpFunctionModel(CurrentItem->AsObject()));
+        Functions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FListHttpFunctionsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Functions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Functions[Functions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListHttpFunctionsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FQueuedFunctionModel::~FQueuedFunctionModel()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FQueuedFunctionModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FQueuedFunctionModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1843,6 +2741,16 @@ void PlayFab::CloudScriptModels::FQueuedFunctionModel::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FQueuedFunctionModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FQueuedFunctionModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FQueuedFunctionModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1871,12 +2779,47 @@ bool PlayFab::CloudScriptModels::FQueuedFunctionModel::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FQueuedFunctionModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ConnectionString"))
+        {
+            reader.ReadValue(ConnectionString);
+        }
+        else if (reader.IsField("FunctionName"))
+        {
+            reader.ReadValue(FunctionName);
+        }
+        else if (reader.IsField("QueueName"))
+        {
+            reader.ReadValue(QueueName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FQueuedFunctionModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FListQueuedFunctionsResult::~FListQueuedFunctionsResult()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FListQueuedFunctionsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FListQueuedFunctionsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1892,6 +2835,16 @@ void PlayFab::CloudScriptModels::FListQueuedFunctionsResult::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FListQueuedFunctionsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FListQueuedFunctionsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FListQueuedFunctionsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1900,19 +2853,53 @@ bool PlayFab::CloudScriptModels::FListQueuedFunctionsResult::readFromValue(const
     for (int32 Idx = 0; Idx < FunctionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = FunctionsArray[Idx];
-        Functions.Add(FQueuedFunctionModel(CurrentItem->AsObject()));
+        Functions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FListQueuedFunctionsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Functions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Functions[Functions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListQueuedFunctionsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FLocationModel::~FLocationModel()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FLocationModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FLocationModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1949,6 +2936,16 @@ void PlayFab::CloudScriptModels::FLocationModel::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FLocationModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FLocationModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FLocationModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1981,7 +2978,52 @@ bool PlayFab::CloudScriptModels::FLocationModel::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
-void PlayFab::CloudScriptModels::writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonWriter& writer)
+bool PlayFab::CloudScriptModels::FLocationModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("City"))
+        {
+            reader.ReadValue(City);
+        }
+        else if (reader.IsField("ContinentCode"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfContinentCode = readContinentCodeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("CountryCode"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfCountryCode = readCountryCodeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Latitude"))
+        {
+            reader.ReadValue(Latitude);
+        }
+        else if (reader.IsField("Longitude"))
+        {
+            reader.ReadValue(Longitude);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLocationModel();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeSubscriptionProviderStatusEnumValue(CloudScriptModels::SubscriptionProviderStatus enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -1997,6 +3039,16 @@ void PlayFab::CloudScriptModels::writeSubscriptionProviderStatusEnumJSON(Subscri
     }
 }
 
+void PlayFab::CloudScriptModels::writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonWriter& writer)
+{
+    writeSubscriptionProviderStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::CloudScriptModels::writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeSubscriptionProviderStatusEnumValue(enumVal, writer);
+}
+
 CloudScriptModels::SubscriptionProviderStatus PlayFab::CloudScriptModels::readSubscriptionProviderStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readSubscriptionProviderStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -2034,7 +3086,8 @@ PlayFab::CloudScriptModels::FSubscriptionModel::~FSubscriptionModel()
 
 }
 
-void PlayFab::CloudScriptModels::FSubscriptionModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FSubscriptionModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2074,6 +3127,16 @@ void PlayFab::CloudScriptModels::FSubscriptionModel::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FSubscriptionModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FSubscriptionModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FSubscriptionModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2121,12 +3184,64 @@ bool PlayFab::CloudScriptModels::FSubscriptionModel::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FSubscriptionModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Expiration"))
+        {
+            reader.ReadValue(Expiration);
+        }
+        else if (reader.IsField("InitialSubscriptionTime"))
+        {
+            reader.ReadValue(InitialSubscriptionTime);
+        }
+        else if (reader.IsField("IsActive"))
+        {
+            reader.ReadValue(IsActive);
+        }
+        else if (reader.IsField("Status"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Status = readSubscriptionProviderStatusFromValue(TmpValue); }
+        }
+        else if (reader.IsField("SubscriptionId"))
+        {
+            reader.ReadValue(SubscriptionId);
+        }
+        else if (reader.IsField("SubscriptionItemId"))
+        {
+            reader.ReadValue(SubscriptionItemId);
+        }
+        else if (reader.IsField("SubscriptionProvider"))
+        {
+            reader.ReadValue(SubscriptionProvider);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSubscriptionModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FMembershipModel::~FMembershipModel()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FMembershipModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FMembershipModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2166,6 +3281,16 @@ void PlayFab::CloudScriptModels::FMembershipModel::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FMembershipModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FMembershipModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FMembershipModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2205,19 +3330,73 @@ bool PlayFab::CloudScriptModels::FMembershipModel::readFromValue(const TSharedPt
     for (int32 Idx = 0; Idx < SubscriptionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = SubscriptionsArray[Idx];
-        Subscriptions.Add(FSubscriptionModel(CurrentItem->AsObject()));
+        Subscriptions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FMembershipModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("IsActive"))
+        {
+            reader.ReadValue(IsActive);
+        }
+        else if (reader.IsField("MembershipExpiration"))
+        {
+            reader.ReadValue(MembershipExpiration);
+        }
+        else if (reader.IsField("MembershipId"))
+        {
+            reader.ReadValue(MembershipId);
+        }
+        else if (reader.IsField("OverrideExpiration"))
+        {
+            reader.ReadValue(OverrideExpiration);
+        }
+        else if (reader.IsField("OverrideIsSet"))
+        {
+            reader.ReadValue(OverrideIsSet);
+        }
+        else if (reader.IsField("Subscriptions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Subscriptions[Subscriptions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FMembershipModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FNameIdentifier::~FNameIdentifier()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FNameIdentifier::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FNameIdentifier::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2236,6 +3415,16 @@ void PlayFab::CloudScriptModels::FNameIdentifier::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FNameIdentifier::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FNameIdentifier::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FNameIdentifier::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2257,7 +3446,38 @@ bool PlayFab::CloudScriptModels::FNameIdentifier::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
-void PlayFab::CloudScriptModels::writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonWriter& writer)
+bool PlayFab::CloudScriptModels::FNameIdentifier::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FNameIdentifier();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writePushNotificationPlatformEnumValue(CloudScriptModels::PushNotificationPlatform enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -2267,6 +3487,16 @@ void PlayFab::CloudScriptModels::writePushNotificationPlatformEnumJSON(PushNotif
     }
 }
 
+void PlayFab::CloudScriptModels::writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonWriter& writer)
+{
+    writePushNotificationPlatformEnumValue(enumVal, writer);
+}
+
+void PlayFab::CloudScriptModels::writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonUtf8Writer& writer)
+{
+    writePushNotificationPlatformEnumValue(enumVal, writer);
+}
+
 CloudScriptModels::PushNotificationPlatform PlayFab::CloudScriptModels::readPushNotificationPlatformFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readPushNotificationPlatformFromValue(value.IsValid() ? value->AsString() : "");
@@ -2298,7 +3528,8 @@ PlayFab::CloudScriptModels::FPushNotificationRegistrationModel::~FPushNotificati
 
 }
 
-void PlayFab::CloudScriptModels::FPushNotificationRegistrationModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FPushNotificationRegistrationModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2317,6 +3548,16 @@ void PlayFab::CloudScriptModels::FPushNotificationRegistrationModel::writeJSON(J
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FPushNotificationRegistrationModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FPushNotificationRegistrationModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FPushNotificationRegistrationModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2333,12 +3574,44 @@ bool PlayFab::CloudScriptModels::FPushNotificationRegistrationModel::readFromVal
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FPushNotificationRegistrationModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("NotificationEndpointARN"))
+        {
+            reader.ReadValue(NotificationEndpointARN);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Platform = readPushNotificationPlatformFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPushNotificationRegistrationModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FStatisticModel::~FStatisticModel()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FStatisticModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FStatisticModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2357,6 +3630,16 @@ void PlayFab::CloudScriptModels::FStatisticModel::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FStatisticModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FStatisticModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FStatisticModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2385,12 +3668,47 @@ bool PlayFab::CloudScriptModels::FStatisticModel::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FStatisticModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStatisticModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FTagModel::~FTagModel()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FTagModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FTagModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2403,6 +3721,16 @@ void PlayFab::CloudScriptModels::FTagModel::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FTagModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FTagModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FTagModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2417,12 +3745,39 @@ bool PlayFab::CloudScriptModels::FTagModel::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FTagModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TagValue"))
+        {
+            reader.ReadValue(TagValue);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FTagModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FValueToDateModel::~FValueToDateModel()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FValueToDateModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FValueToDateModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2444,6 +3799,16 @@ void PlayFab::CloudScriptModels::FValueToDateModel::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FValueToDateModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FValueToDateModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FValueToDateModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2472,12 +3837,47 @@ bool PlayFab::CloudScriptModels::FValueToDateModel::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FValueToDateModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Currency"))
+        {
+            reader.ReadValue(Currency);
+        }
+        else if (reader.IsField("TotalValue"))
+        {
+            reader.ReadValue(TotalValue);
+        }
+        else if (reader.IsField("TotalValueAsDecimal"))
+        {
+            reader.ReadValue(TotalValueAsDecimal);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FValueToDateModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FPlayerProfileModel::~FPlayerProfileModel()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FPlayerProfileModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FPlayerProfileModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2634,6 +4034,16 @@ void PlayFab::CloudScriptModels::FPlayerProfileModel::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FPlayerProfileModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FPlayerProfileModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FPlayerProfileModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2642,7 +4052,7 @@ bool PlayFab::CloudScriptModels::FPlayerProfileModel::readFromValue(const TShare
     for (int32 Idx = 0; Idx < AdCampaignAttributionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = AdCampaignAttributionsArray[Idx];
-        AdCampaignAttributions.Add(FAdCampaignAttributionModel(CurrentItem->AsObject()));
+        AdCampaignAttributions.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2662,7 +4072,7 @@ bool PlayFab::CloudScriptModels::FPlayerProfileModel::readFromValue(const TShare
     for (int32 Idx = 0; Idx < ContactEmailAddressesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ContactEmailAddressesArray[Idx];
-        ContactEmailAddresses.Add(FContactEmailInfoModel(CurrentItem->AsObject()));
+        ContactEmailAddresses.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2689,7 +4099,7 @@ bool PlayFab::CloudScriptModels::FPlayerProfileModel::readFromValue(const TShare
     for (int32 Idx = 0; Idx < LinkedAccountsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LinkedAccountsArray[Idx];
-        LinkedAccounts.Add(FLinkedPlatformAccountModel(CurrentItem->AsObject()));
+        LinkedAccounts.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2697,7 +4107,7 @@ bool PlayFab::CloudScriptModels::FPlayerProfileModel::readFromValue(const TShare
     for (int32 Idx = 0; Idx < LocationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LocationsArray[Idx];
-        Locations.Add(FLocationModel(CurrentItem->AsObject()));
+        Locations.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2705,7 +4115,7 @@ bool PlayFab::CloudScriptModels::FPlayerProfileModel::readFromValue(const TShare
     for (int32 Idx = 0; Idx < MembershipsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = MembershipsArray[Idx];
-        Memberships.Add(FMembershipModel(CurrentItem->AsObject()));
+        Memberships.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2729,7 +4139,7 @@ bool PlayFab::CloudScriptModels::FPlayerProfileModel::readFromValue(const TShare
     for (int32 Idx = 0; Idx < PushNotificationRegistrationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PushNotificationRegistrationsArray[Idx];
-        PushNotificationRegistrations.Add(FPushNotificationRegistrationModel(CurrentItem->AsObject()));
+        PushNotificationRegistrations.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2737,7 +4147,7 @@ bool PlayFab::CloudScriptModels::FPlayerProfileModel::readFromValue(const TShare
     for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FStatisticModel(CurrentItem->AsObject()));
+        Statistics.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2745,7 +4155,7 @@ bool PlayFab::CloudScriptModels::FPlayerProfileModel::readFromValue(const TShare
     for (int32 Idx = 0; Idx < TagsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = TagsArray[Idx];
-        Tags.Add(FTagModel(CurrentItem->AsObject()));
+        Tags.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2763,15 +4173,188 @@ bool PlayFab::CloudScriptModels::FPlayerProfileModel::readFromValue(const TShare
         if (TotalValueToDateInUSDValue->TryGetNumber(TmpValue)) { TotalValueToDateInUSD = TmpValue; }
     }
 
-    const TArray<TSharedPtr<FJsonValue>>&ValuesToDateArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ValuesToDate"));
-    for (int32 Idx = 0; Idx < ValuesToDateArray.Num(); Idx++)
+    const TArray<TSharedPtr<FJsonValue>>&ValuesToDateArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("ValuesToDate"));
+    for (int32 Idx = 0; Idx < ValuesToDateArray.Num(); Idx++)
+    {
+        TSharedPtr<FJsonValue> CurrentItem = ValuesToDateArray[Idx];
+        ValuesToDate.Emplace(CurrentItem->AsObject());
+    }
+
+
+    return HasSucceeded;
+}
+
+bool PlayFab::CloudScriptModels::FPlayerProfileModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AdCampaignAttributions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { AdCampaignAttributions[AdCampaignAttributions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("AvatarUrl"))
+        {
+            reader.ReadValue(AvatarUrl);
+        }
+        else if (reader.IsField("BannedUntil"))
+        {
+            reader.ReadValue(BannedUntil);
+        }
+        else if (reader.IsField("ContactEmailAddresses"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ContactEmailAddresses[ContactEmailAddresses.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("ExperimentVariants"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ExperimentVariants.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("LastLogin"))
+        {
+            reader.ReadValue(LastLogin);
+        }
+        else if (reader.IsField("LinkedAccounts"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { LinkedAccounts[LinkedAccounts.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Locations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Locations[Locations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Memberships"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Memberships[Memberships.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Origination"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Origination = readLoginIdentityProviderFromValue(TmpValue); }
+        }
+        else if (reader.IsField("PlayerId"))
+        {
+            reader.ReadValue(PlayerId);
+        }
+        else if (reader.IsField("PublisherId"))
+        {
+            reader.ReadValue(PublisherId);
+        }
+        else if (reader.IsField("PushNotificationRegistrations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { PushNotificationRegistrations[PushNotificationRegistrations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Statistics"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Statistics[Statistics.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Tags[Tags.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else if (reader.IsField("TotalValueToDateInUSD"))
+        {
+            reader.ReadValue(TotalValueToDateInUSD);
+        }
+        else if (reader.IsField("ValuesToDate"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ValuesToDate[ValuesToDate.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
     {
-        TSharedPtr<FJsonValue> CurrentItem = ValuesToDateArray[Idx];
-        ValuesToDate.Add(FValueToDateModel(CurrentItem->AsObject()));
+        *this = FPlayerProfileModel();
+        return false;
     }
-
-
-    return HasSucceeded;
+    return true;
 }
 
 PlayFab::CloudScriptModels::FPlayStreamEventEnvelopeModel::~FPlayStreamEventEnvelopeModel()
@@ -2779,7 +4362,8 @@ PlayFab::CloudScriptModels::FPlayStreamEventEnvelopeModel::~FPlayStreamEventEnve
 
 }
 
-void PlayFab::CloudScriptModels::FPlayStreamEventEnvelopeModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FPlayStreamEventEnvelopeModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2822,6 +4406,16 @@ void PlayFab::CloudScriptModels::FPlayStreamEventEnvelopeModel::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FPlayStreamEventEnvelopeModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FPlayStreamEventEnvelopeModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FPlayStreamEventEnvelopeModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2871,12 +4465,59 @@ bool PlayFab::CloudScriptModels::FPlayStreamEventEnvelopeModel::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FPlayStreamEventEnvelopeModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("EntityId"))
+        {
+            reader.ReadValue(EntityId);
+        }
+        else if (reader.IsField("EntityType"))
+        {
+            reader.ReadValue(EntityType);
+        }
+        else if (reader.IsField("EventData"))
+        {
+            reader.ReadValue(EventData);
+        }
+        else if (reader.IsField("EventName"))
+        {
+            reader.ReadValue(EventName);
+        }
+        else if (reader.IsField("EventNamespace"))
+        {
+            reader.ReadValue(EventNamespace);
+        }
+        else if (reader.IsField("EventSettings"))
+        {
+            reader.ReadValue(EventSettings);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayStreamEventEnvelopeModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequest::~FPostFunctionResultForEntityTriggeredActionRequest()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2900,6 +4541,16 @@ void PlayFab::CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2909,7 +4560,7 @@ bool PlayFab::CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequ
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2928,12 +4579,54 @@ bool PlayFab::CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequ
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("FunctionResult"))
+        {
+            FunctionResult.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPostFunctionResultForEntityTriggeredActionRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest::~FPostFunctionResultForFunctionExecutionRequest()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2957,6 +4650,16 @@ void PlayFab::CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest:
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2966,7 +4669,7 @@ bool PlayFab::CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest:
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2985,6 +4688,47 @@ bool PlayFab::CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest:
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("FunctionResult"))
+        {
+            FunctionResult.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPostFunctionResultForFunctionExecutionRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequest::~FPostFunctionResultForPlayerTriggeredActionRequest()
 {
     //if (Entity != nullptr) delete Entity;
@@ -2992,7 +4736,8 @@ PlayFab::CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequest::
 
 }
 
-void PlayFab::CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3028,6 +4773,16 @@ void PlayFab::CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3037,14 +4792,14 @@ bool PlayFab::CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequ
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> FunctionResultValue = obj->TryGetField(TEXT("FunctionResult"));
@@ -3062,18 +4817,70 @@ bool PlayFab::CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequ
     const TSharedPtr<FJsonValue> PlayStreamEventEnvelopeValue = obj->TryGetField(TEXT("PlayStreamEventEnvelope"));
     if (PlayStreamEventEnvelopeValue.IsValid() && !PlayStreamEventEnvelopeValue->IsNull())
     {
-        PlayStreamEventEnvelope = MakeShareable(new FPlayStreamEventEnvelopeModel(PlayStreamEventEnvelopeValue->AsObject()));
+        PlayStreamEventEnvelope = MakeShared<FPlayStreamEventEnvelopeModel>(PlayStreamEventEnvelopeValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("FunctionResult"))
+        {
+            FunctionResult.readFromReader(reader);
+        }
+        else if (reader.IsField("PlayerProfile"))
+        {
+            PlayerProfile.readFromReader(reader);
+        }
+        else if (reader.IsField("PlayStreamEventEnvelope"))
+        {
+            PlayStreamEventEnvelope = MakeShared<FPlayStreamEventEnvelopeModel>();
+            PlayStreamEventEnvelope->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPostFunctionResultForPlayerTriggeredActionRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FPostFunctionResultForScheduledTaskRequest::~FPostFunctionResultForScheduledTaskRequest()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FPostFunctionResultForScheduledTaskRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FPostFunctionResultForScheduledTaskRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3100,6 +4907,16 @@ void PlayFab::CloudScriptModels::FPostFunctionResultForScheduledTaskRequest::wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FPostFunctionResultForScheduledTaskRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FPostFunctionResultForScheduledTaskRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FPostFunctionResultForScheduledTaskRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3109,7 +4926,7 @@ bool PlayFab::CloudScriptModels::FPostFunctionResultForScheduledTaskRequest::rea
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -3134,12 +4951,58 @@ bool PlayFab::CloudScriptModels::FPostFunctionResultForScheduledTaskRequest::rea
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FPostFunctionResultForScheduledTaskRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("FunctionResult"))
+        {
+            FunctionResult.readFromReader(reader);
+        }
+        else if (reader.IsField("ScheduledTaskId"))
+        {
+            ScheduledTaskId.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPostFunctionResultForScheduledTaskRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FRegisterHttpFunctionRequest::~FRegisterHttpFunctionRequest()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FRegisterHttpFunctionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FRegisterHttpFunctionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3177,6 +5040,16 @@ void PlayFab::CloudScriptModels::FRegisterHttpFunctionRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FRegisterHttpFunctionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FRegisterHttpFunctionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FRegisterHttpFunctionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3186,7 +5059,7 @@ bool PlayFab::CloudScriptModels::FRegisterHttpFunctionRequest::readFromValue(con
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -3207,12 +5080,54 @@ bool PlayFab::CloudScriptModels::FRegisterHttpFunctionRequest::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FRegisterHttpFunctionRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("FunctionName"))
+        {
+            reader.ReadValue(FunctionName);
+        }
+        else if (reader.IsField("FunctionUrl"))
+        {
+            reader.ReadValue(FunctionUrl);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRegisterHttpFunctionRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::CloudScriptModels::FRegisterQueuedFunctionRequest::~FRegisterQueuedFunctionRequest()
 {
 
 }
 
-void PlayFab::CloudScriptModels::FRegisterQueuedFunctionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FRegisterQueuedFunctionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3260,6 +5175,16 @@ void PlayFab::CloudScriptModels::FRegisterQueuedFunctionRequest::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FRegisterQueuedFunctionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FRegisterQueuedFunctionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FRegisterQueuedFunctionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3276,7 +5201,7 @@ bool PlayFab::CloudScriptModels::FRegisterQueuedFunctionRequest::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -3297,7 +5222,53 @@ bool PlayFab::CloudScriptModels::FRegisterQueuedFunctionRequest::readFromValue(c
     return HasSucceeded;
 }
 
-void PlayFab::CloudScriptModels::writeTriggerTypeEnumJSON(TriggerType enumVal, JsonWriter& writer)
+bool PlayFab::CloudScriptModels::FRegisterQueuedFunctionRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ConnectionString"))
+        {
+            reader.ReadValue(ConnectionString);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("FunctionName"))
+        {
+            reader.ReadValue(FunctionName);
+        }
+        else if (reader.IsField("QueueName"))
+        {
+            reader.ReadValue(QueueName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRegisterQueuedFunctionRequest();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeTriggerTypeEnumValue(CloudScriptModels::TriggerType enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -3307,6 +5278,16 @@ void PlayFab::CloudScriptModels::writeTriggerTypeEnumJSON(TriggerType enumVal, J
     }
 }
 
+void PlayFab::CloudScriptModels::writeTriggerTypeEnumJSON(TriggerType enumVal, JsonWriter& writer)
+{
+    writeTriggerTypeEnumValue(enumVal, writer);
+}
+
+void PlayFab::CloudScriptModels::writeTriggerTypeEnumJSON(TriggerType enumVal, JsonUtf8Writer& writer)
+{
+    writeTriggerTypeEnumValue(enumVal, writer);
+}
+
 CloudScriptModels::TriggerType PlayFab::CloudScriptModels::readTriggerTypeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readTriggerTypeFromValue(value.IsValid() ? value->AsString() : "");
@@ -3338,7 +5319,8 @@ PlayFab::CloudScriptModels::FUnregisterFunctionRequest::~FUnregisterFunctionRequ
 
 }
 
-void PlayFab::CloudScriptModels::FUnregisterFunctionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::CloudScriptModels::FUnregisterFunctionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3366,6 +5348,16 @@ void PlayFab::CloudScriptModels::FUnregisterFunctionRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::CloudScriptModels::FUnregisterFunctionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::CloudScriptModels::FUnregisterFunctionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::CloudScriptModels::FUnregisterFunctionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3375,7 +5367,7 @@ bool PlayFab::CloudScriptModels::FUnregisterFunctionRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -3389,3 +5381,40 @@ bool PlayFab::CloudScriptModels::FUnregisterFunctionRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::CloudScriptModels::FUnregisterFunctionRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("FunctionName"))
+        {
+            reader.ReadValue(FunctionName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnregisterFunctionRequest();
+        return false;
+    }
+    return true;
+}
+
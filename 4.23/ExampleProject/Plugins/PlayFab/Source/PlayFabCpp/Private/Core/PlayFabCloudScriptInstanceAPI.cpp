@@ -80,7 +80,8 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabCloudScriptInstanceAPI::GetOrC
 bool UPlayFabCloudScriptInstanceAPI::ExecuteEntityCloudScript(
     CloudScriptModels::FExecuteEntityCloudScriptRequest& request,
     const FExecuteEntityCloudScriptDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -88,29 +89,32 @@ bool UPlayFabCloudScriptInstanceAPI::ExecuteEntityCloudScript(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/ExecuteEntityCloudScript"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnExecuteEntityCloudScriptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/ExecuteEntityCloudScript"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabCloudScriptInstanceAPI::OnExecuteEntityCloudScriptResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<CloudScriptModels::FExecuteCloudScriptResult>> UPlayFabCloudScriptInstanceAPI::ExecuteEntityCloudScriptAsync(CloudScriptModels::FExecuteEntityCloudScriptRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<CloudScriptModels::FExecuteCloudScriptResult, FExecuteEntityCloudScriptDelegate>([this, &request, &Handle](const FExecuteEntityCloudScriptDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabCloudScriptInstanceAPI::ExecuteEntityCloudScript(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnExecuteEntityCloudScriptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExecuteEntityCloudScriptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    CloudScriptModels::FExecuteCloudScriptResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<CloudScriptModels::FExecuteCloudScriptResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](CloudScriptModels::FExecuteCloudScriptResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabCloudScriptInstanceAPI::ExecuteFunction(
     CloudScriptModels::FExecuteFunctionRequest& request,
     const FExecuteFunctionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -118,29 +122,32 @@ bool UPlayFabCloudScriptInstanceAPI::ExecuteFunction(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/ExecuteFunction"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnExecuteFunctionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/ExecuteFunction"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabCloudScriptInstanceAPI::OnExecuteFunctionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<CloudScriptModels::FExecuteFunctionResult>> UPlayFabCloudScriptInstanceAPI::ExecuteFunctionAsync(CloudScriptModels::FExecuteFunctionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<CloudScriptModels::FExecuteFunctionResult, FExecuteFunctionDelegate>([this, &request, &Handle](const FExecuteFunctionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabCloudScriptInstanceAPI::ExecuteFunction(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnExecuteFunctionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExecuteFunctionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    CloudScriptModels::FExecuteFunctionResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<CloudScriptModels::FExecuteFunctionResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](CloudScriptModels::FExecuteFunctionResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabCloudScriptInstanceAPI::ListFunctions(
     CloudScriptModels::FListFunctionsRequest& request,
     const FListFunctionsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -148,29 +155,32 @@ bool UPlayFabCloudScriptInstanceAPI::ListFunctions(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/ListFunctions"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnListFunctionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/ListFunctions"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabCloudScriptInstanceAPI::OnListFunctionsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<CloudScriptModels::FListFunctionsResult>> UPlayFabCloudScriptInstanceAPI::ListFunctionsAsync(CloudScriptModels::FListFunctionsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<CloudScriptModels::FListFunctionsResult, FListFunctionsDelegate>([this, &request, &Handle](const FListFunctionsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabCloudScriptInstanceAPI::ListFunctions(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnListFunctionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListFunctionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    CloudScriptModels::FListFunctionsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<CloudScriptModels::FListFunctionsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](CloudScriptModels::FListFunctionsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabCloudScriptInstanceAPI::ListHttpFunctions(
     CloudScriptModels::FListFunctionsRequest& request,
     const FListHttpFunctionsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -178,29 +188,32 @@ bool UPlayFabCloudScriptInstanceAPI::ListHttpFunctions(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/ListHttpFunctions"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnListHttpFunctionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/ListHttpFunctions"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabCloudScriptInstanceAPI::OnListHttpFunctionsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<CloudScriptModels::FListHttpFunctionsResult>> UPlayFabCloudScriptInstanceAPI::ListHttpFunctionsAsync(CloudScriptModels::FListFunctionsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<CloudScriptModels::FListHttpFunctionsResult, FListHttpFunctionsDelegate>([this, &request, &Handle](const FListHttpFunctionsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabCloudScriptInstanceAPI::ListHttpFunctions(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnListHttpFunctionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListHttpFunctionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    CloudScriptModels::FListHttpFunctionsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<CloudScriptModels::FListHttpFunctionsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](CloudScriptModels::FListHttpFunctionsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabCloudScriptInstanceAPI::ListQueuedFunctions(
     CloudScriptModels::FListFunctionsRequest& request,
     const FListQueuedFunctionsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -208,29 +221,32 @@ bool UPlayFabCloudScriptInstanceAPI::ListQueuedFunctions(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/ListQueuedFunctions"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnListQueuedFunctionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/ListQueuedFunctions"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabCloudScriptInstanceAPI::OnListQueuedFunctionsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<CloudScriptModels::FListQueuedFunctionsResult>> UPlayFabCloudScriptInstanceAPI::ListQueuedFunctionsAsync(CloudScriptModels::FListFunctionsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<CloudScriptModels::FListQueuedFunctionsResult, FListQueuedFunctionsDelegate>([this, &request, &Handle](const FListQueuedFunctionsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabCloudScriptInstanceAPI::ListQueuedFunctions(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnListQueuedFunctionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListQueuedFunctionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    CloudScriptModels::FListQueuedFunctionsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<CloudScriptModels::FListQueuedFunctionsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](CloudScriptModels::FListQueuedFunctionsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabCloudScriptInstanceAPI::PostFunctionResultForEntityTriggeredAction(
     CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequest& request,
     const FPostFunctionResultForEntityTriggeredActionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -238,29 +254,32 @@ bool UPlayFabCloudScriptInstanceAPI::PostFunctionResultForEntityTriggeredAction(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/PostFunctionResultForEntityTriggeredAction"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForEntityTriggeredActionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/PostFunctionResultForEntityTriggeredAction"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForEntityTriggeredActionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<CloudScriptModels::FEmptyResult>> UPlayFabCloudScriptInstanceAPI::PostFunctionResultForEntityTriggeredActionAsync(CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<CloudScriptModels::FEmptyResult, FPostFunctionResultForEntityTriggeredActionDelegate>([this, &request, &Handle](const FPostFunctionResultForEntityTriggeredActionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabCloudScriptInstanceAPI::PostFunctionResultForEntityTriggeredAction(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForEntityTriggeredActionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPostFunctionResultForEntityTriggeredActionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    CloudScriptModels::FEmptyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<CloudScriptModels::FEmptyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](CloudScriptModels::FEmptyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabCloudScriptInstanceAPI::PostFunctionResultForFunctionExecution(
     CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest& request,
     const FPostFunctionResultForFunctionExecutionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -268,29 +287,32 @@ bool UPlayFabCloudScriptInstanceAPI::PostFunctionResultForFunctionExecution(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/PostFunctionResultForFunctionExecution"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForFunctionExecutionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/PostFunctionResultForFunctionExecution"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForFunctionExecutionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<CloudScriptModels::FEmptyResult>> UPlayFabCloudScriptInstanceAPI::PostFunctionResultForFunctionExecutionAsync(CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<CloudScriptModels::FEmptyResult, FPostFunctionResultForFunctionExecutionDelegate>([this, &request, &Handle](const FPostFunctionResultForFunctionExecutionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabCloudScriptInstanceAPI::PostFunctionResultForFunctionExecution(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForFunctionExecutionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPostFunctionResultForFunctionExecutionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    CloudScriptModels::FEmptyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<CloudScriptModels::FEmptyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](CloudScriptModels::FEmptyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabCloudScriptInstanceAPI::PostFunctionResultForPlayerTriggeredAction(
     CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequest& request,
     const FPostFunctionResultForPlayerTriggeredActionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -298,29 +320,32 @@ bool UPlayFabCloudScriptInstanceAPI::PostFunctionResultForPlayerTriggeredAction(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/PostFunctionResultForPlayerTriggeredAction"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForPlayerTriggeredActionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/PostFunctionResultForPlayerTriggeredAction"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForPlayerTriggeredActionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<CloudScriptModels::FEmptyResult>> UPlayFabCloudScriptInstanceAPI::PostFunctionResultForPlayerTriggeredActionAsync(CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<CloudScriptModels::FEmptyResult, FPostFunctionResultForPlayerTriggeredActionDelegate>([this, &request, &Handle](const FPostFunctionResultForPlayerTriggeredActionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabCloudScriptInstanceAPI::PostFunctionResultForPlayerTriggeredAction(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForPlayerTriggeredActionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPostFunctionResultForPlayerTriggeredActionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    CloudScriptModels::FEmptyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<CloudScriptModels::FEmptyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](CloudScriptModels::FEmptyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabCloudScriptInstanceAPI::PostFunctionResultForScheduledTask(
     CloudScriptModels::FPostFunctionResultForScheduledTaskRequest& request,
     const FPostFunctionResultForScheduledTaskDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -328,29 +353,32 @@ bool UPlayFabCloudScriptInstanceAPI::PostFunctionResultForScheduledTask(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/PostFunctionResultForScheduledTask"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForScheduledTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/PostFunctionResultForScheduledTask"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForScheduledTaskResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<CloudScriptModels::FEmptyResult>> UPlayFabCloudScriptInstanceAPI::PostFunctionResultForScheduledTaskAsync(CloudScriptModels::FPostFunctionResultForScheduledTaskRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<CloudScriptModels::FEmptyResult, FPostFunctionResultForScheduledTaskDelegate>([this, &request, &Handle](const FPostFunctionResultForScheduledTaskDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabCloudScriptInstanceAPI::PostFunctionResultForScheduledTask(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnPostFunctionResultForScheduledTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPostFunctionResultForScheduledTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    CloudScriptModels::FEmptyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<CloudScriptModels::FEmptyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](CloudScriptModels::FEmptyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabCloudScriptInstanceAPI::RegisterHttpFunction(
     CloudScriptModels::FRegisterHttpFunctionRequest& request,
     const FRegisterHttpFunctionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -358,29 +386,32 @@ bool UPlayFabCloudScriptInstanceAPI::RegisterHttpFunction(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/RegisterHttpFunction"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnRegisterHttpFunctionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/RegisterHttpFunction"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabCloudScriptInstanceAPI::OnRegisterHttpFunctionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<CloudScriptModels::FEmptyResult>> UPlayFabCloudScriptInstanceAPI::RegisterHttpFunctionAsync(CloudScriptModels::FRegisterHttpFunctionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<CloudScriptModels::FEmptyResult, FRegisterHttpFunctionDelegate>([this, &request, &Handle](const FRegisterHttpFunctionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabCloudScriptInstanceAPI::RegisterHttpFunction(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnRegisterHttpFunctionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterHttpFunctionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    CloudScriptModels::FEmptyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<CloudScriptModels::FEmptyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](CloudScriptModels::FEmptyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabCloudScriptInstanceAPI::RegisterQueuedFunction(
     CloudScriptModels::FRegisterQueuedFunctionRequest& request,
     const FRegisterQueuedFunctionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -388,29 +419,32 @@ bool UPlayFabCloudScriptInstanceAPI::RegisterQueuedFunction(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/RegisterQueuedFunction"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnRegisterQueuedFunctionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/RegisterQueuedFunction"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabCloudScriptInstanceAPI::OnRegisterQueuedFunctionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<CloudScriptModels::FEmptyResult>> UPlayFabCloudScriptInstanceAPI::RegisterQueuedFunctionAsync(CloudScriptModels::FRegisterQueuedFunctionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<CloudScriptModels::FEmptyResult, FRegisterQueuedFunctionDelegate>([this, &request, &Handle](const FRegisterQueuedFunctionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabCloudScriptInstanceAPI::RegisterQueuedFunction(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnRegisterQueuedFunctionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterQueuedFunctionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    CloudScriptModels::FEmptyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<CloudScriptModels::FEmptyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](CloudScriptModels::FEmptyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabCloudScriptInstanceAPI::UnregisterFunction(
     CloudScriptModels::FUnregisterFunctionRequest& request,
     const FUnregisterFunctionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -418,21 +452,23 @@ bool UPlayFabCloudScriptInstanceAPI::UnregisterFunction(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/UnregisterFunction"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabCloudScriptInstanceAPI::OnUnregisterFunctionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/CloudScript/UnregisterFunction"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabCloudScriptInstanceAPI::OnUnregisterFunctionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<CloudScriptModels::FEmptyResult>> UPlayFabCloudScriptInstanceAPI::UnregisterFunctionAsync(CloudScriptModels::FUnregisterFunctionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<CloudScriptModels::FEmptyResult, FUnregisterFunctionDelegate>([this, &request, &Handle](const FUnregisterFunctionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabCloudScriptInstanceAPI::UnregisterFunction(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabCloudScriptInstanceAPI::OnUnregisterFunctionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnregisterFunctionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    CloudScriptModels::FEmptyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<CloudScriptModels::FEmptyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](CloudScriptModels::FEmptyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
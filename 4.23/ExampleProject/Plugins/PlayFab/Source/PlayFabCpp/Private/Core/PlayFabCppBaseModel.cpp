@@ -4,10 +4,58 @@
 
 
 #include "PlayFabCppBaseModel.h"
+#include "PlayFabJsonPullReader.h"
 #include "PlayFab.h"
+#include "PlayFabTrace.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/JsonSerializer.h"
 
 using namespace PlayFab;
 
+void FPlayFabCondensedUtf8PrintPolicy::WriteChar(FArchive* Stream, TCHAR Char)
+{
+    if (Char < 0x80)
+    {
+        ANSICHAR AnsiChar = static_cast<ANSICHAR>(Char);
+        Stream->Serialize(&AnsiChar, sizeof(ANSICHAR));
+    }
+    else
+    {
+        WriteString(Stream, FString(1, &Char));
+    }
+}
+
+void FPlayFabCondensedUtf8PrintPolicy::WriteString(FArchive* Stream, const FString& String)
+{
+    FTCHARToUTF8 Converter(*String, String.Len());
+    Stream->Serialize(const_cast<ANSICHAR*>(Converter.Get()), Converter.Length());
+}
+
+void FPlayFabCondensedUtf8PrintPolicy::WriteFloat(FArchive* Stream, float Value)
+{
+    WriteString(Stream, FString::Printf(TEXT("%g"), Value));
+}
+
+void FPlayFabCondensedUtf8PrintPolicy::WriteDouble(FArchive* Stream, double Value)
+{
+    // Same precision as TJsonPrintPolicy, 17 significant digits is the most a double can use
+    WriteString(Stream, FString::Printf(TEXT("%.17g"), Value));
+}
+
+void FPlayFabCppBaseModel::writeJSON(JsonUtf8Writer& Json) const
+{
+    TSharedPtr<FJsonValue> Value;
+    JsonReader Reader = TJsonReaderFactory<TCHAR>::Create(toJSONString());
+    if (FJsonSerializer::Deserialize(Reader, Value) && Value.IsValid())
+    {
+        FJsonKeeper(Value).writeJSON(Json);
+    }
+    else
+    {
+        Json->WriteNull();
+    }
+}
+
 FString FPlayFabCppBaseModel::toJSONString() const
 {
     FString JsonOutString;
@@ -17,7 +65,26 @@ FString FPlayFabCppBaseModel::toJSONString() const
     return JsonOutString;
 }
 
-void FJsonKeeper::writeJSON(JsonWriter& writer) const
+TArray<uint8> FPlayFabCppBaseModel::toJSONUtf8() const
+{
+    PLAYFAB_TRACE_CPU_SCOPE(Serialize);
+    TArray<uint8> JsonOutBytes;
+    FMemoryWriter JsonOutStream(JsonOutBytes);
+    JsonUtf8Writer Json = TJsonWriterFactory<TCHAR, FPlayFabCondensedUtf8PrintPolicy>::Create(&JsonOutStream);
+    writeJSON(Json);
+    Json->Close();
+    return JsonOutBytes;
+}
+
+bool FPlayFabCppBaseModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    const TSharedPtr<FJsonValue> Value = reader.ReadJsonValue();
+    const TSharedPtr<FJsonObject>* Object;
+    return Value->TryGetObject(Object) && readFromValue(*Object);
+}
+
+template <typename WriterType>
+void FJsonKeeper::writeJSONValue(WriterType& writer) const
 {
     switch (JsonValue->Type)
     {
@@ -73,6 +140,16 @@ void FJsonKeeper::writeJSON(JsonWriter& writer) const
     }
 }
 
+void FJsonKeeper::writeJSON(JsonWriter& writer) const
+{
+    writeJSONValue(writer);
+}
+
+void FJsonKeeper::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONValue(writer);
+}
+
 bool FJsonKeeper::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     return false;
@@ -87,11 +164,22 @@ bool FJsonKeeper::readFromValue(const TSharedPtr<FJsonValue>& value)
     return true;
 }
 
+bool FJsonKeeper::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    JsonValue = reader.ReadJsonValue().ToSharedRef();
+    return true;
+}
+
 void PlayFab::writeDatetime(FDateTime datetime, JsonWriter& writer)
 {
     writer->WriteValue(datetime.ToIso8601());
 }
 
+void PlayFab::writeDatetime(FDateTime datetime, JsonUtf8Writer& writer)
+{
+    writer->WriteValue(datetime.ToIso8601());
+}
+
 FDateTime PlayFab::readDatetime(const TSharedPtr<FJsonValue>& value)
 {
     FDateTime DateTimeOut;
@@ -30,7 +30,8 @@ FString UPlayFabDataAPI::GetBuildIdentifier() const
 bool UPlayFabDataAPI::AbortFileUploads(
     DataModels::FAbortFileUploadsRequest& request,
     const FAbortFileUploadsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -38,29 +39,32 @@ bool UPlayFabDataAPI::AbortFileUploads(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/File/AbortFileUploads"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/File/AbortFileUploads"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataAPI::OnAbortFileUploadsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<DataModels::FAbortFileUploadsResponse>> UPlayFabDataAPI::AbortFileUploadsAsync(DataModels::FAbortFileUploadsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<DataModels::FAbortFileUploadsResponse, FAbortFileUploadsDelegate>([this, &request, &Handle](const FAbortFileUploadsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabDataAPI::AbortFileUploads(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabDataAPI::OnAbortFileUploadsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAbortFileUploadsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    DataModels::FAbortFileUploadsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<DataModels::FAbortFileUploadsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](DataModels::FAbortFileUploadsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabDataAPI::DeleteFiles(
     DataModels::FDeleteFilesRequest& request,
     const FDeleteFilesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -68,29 +72,32 @@ bool UPlayFabDataAPI::DeleteFiles(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/File/DeleteFiles"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/File/DeleteFiles"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataAPI::OnDeleteFilesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<DataModels::FDeleteFilesResponse>> UPlayFabDataAPI::DeleteFilesAsync(DataModels::FDeleteFilesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<DataModels::FDeleteFilesResponse, FDeleteFilesDelegate>([this, &request, &Handle](const FDeleteFilesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabDataAPI::DeleteFiles(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabDataAPI::OnDeleteFilesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteFilesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    DataModels::FDeleteFilesResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<DataModels::FDeleteFilesResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](DataModels::FDeleteFilesResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabDataAPI::FinalizeFileUploads(
     DataModels::FFinalizeFileUploadsRequest& request,
     const FFinalizeFileUploadsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -98,29 +105,32 @@ bool UPlayFabDataAPI::FinalizeFileUploads(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/File/FinalizeFileUploads"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/File/FinalizeFileUploads"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataAPI::OnFinalizeFileUploadsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<DataModels::FFinalizeFileUploadsResponse>> UPlayFabDataAPI::FinalizeFileUploadsAsync(DataModels::FFinalizeFileUploadsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<DataModels::FFinalizeFileUploadsResponse, FFinalizeFileUploadsDelegate>([this, &request, &Handle](const FFinalizeFileUploadsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabDataAPI::FinalizeFileUploads(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabDataAPI::OnFinalizeFileUploadsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FFinalizeFileUploadsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    DataModels::FFinalizeFileUploadsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<DataModels::FFinalizeFileUploadsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](DataModels::FFinalizeFileUploadsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabDataAPI::GetFiles(
     DataModels::FGetFilesRequest& request,
     const FGetFilesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -128,29 +138,32 @@ bool UPlayFabDataAPI::GetFiles(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/File/GetFiles"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/File/GetFiles"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataAPI::OnGetFilesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<DataModels::FGetFilesResponse>> UPlayFabDataAPI::GetFilesAsync(DataModels::FGetFilesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<DataModels::FGetFilesResponse, FGetFilesDelegate>([this, &request, &Handle](const FGetFilesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabDataAPI::GetFiles(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabDataAPI::OnGetFilesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFilesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    DataModels::FGetFilesResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<DataModels::FGetFilesResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](DataModels::FGetFilesResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabDataAPI::GetObjects(
     DataModels::FGetObjectsRequest& request,
     const FGetObjectsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -158,29 +171,32 @@ bool UPlayFabDataAPI::GetObjects(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Object/GetObjects"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Object/GetObjects"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataAPI::OnGetObjectsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<DataModels::FGetObjectsResponse>> UPlayFabDataAPI::GetObjectsAsync(DataModels::FGetObjectsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<DataModels::FGetObjectsResponse, FGetObjectsDelegate>([this, &request, &Handle](const FGetObjectsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabDataAPI::GetObjects(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabDataAPI::OnGetObjectsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetObjectsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    DataModels::FGetObjectsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<DataModels::FGetObjectsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](DataModels::FGetObjectsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabDataAPI::InitiateFileUploads(
     DataModels::FInitiateFileUploadsRequest& request,
     const FInitiateFileUploadsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -188,29 +204,32 @@ bool UPlayFabDataAPI::InitiateFileUploads(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/File/InitiateFileUploads"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/File/InitiateFileUploads"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataAPI::OnInitiateFileUploadsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<DataModels::FInitiateFileUploadsResponse>> UPlayFabDataAPI::InitiateFileUploadsAsync(DataModels::FInitiateFileUploadsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<DataModels::FInitiateFileUploadsResponse, FInitiateFileUploadsDelegate>([this, &request, &Handle](const FInitiateFileUploadsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabDataAPI::InitiateFileUploads(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabDataAPI::OnInitiateFileUploadsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FInitiateFileUploadsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    DataModels::FInitiateFileUploadsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<DataModels::FInitiateFileUploadsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](DataModels::FInitiateFileUploadsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabDataAPI::SetObjects(
     DataModels::FSetObjectsRequest& request,
     const FSetObjectsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -218,21 +237,23 @@ bool UPlayFabDataAPI::SetObjects(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Object/SetObjects"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Object/SetObjects"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabDataAPI::OnSetObjectsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<DataModels::FSetObjectsResponse>> UPlayFabDataAPI::SetObjectsAsync(DataModels::FSetObjectsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<DataModels::FSetObjectsResponse, FSetObjectsDelegate>([this, &request, &Handle](const FSetObjectsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabDataAPI::SetObjects(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabDataAPI::OnSetObjectsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetObjectsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    DataModels::FSetObjectsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<DataModels::FSetObjectsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](DataModels::FSetObjectsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
@@ -80,7 +80,8 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabEventsInstanceAPI::GetOrCreate
 bool UPlayFabEventsInstanceAPI::WriteEvents(
     EventsModels::FWriteEventsRequest& request,
     const FWriteEventsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -88,29 +89,32 @@ bool UPlayFabEventsInstanceAPI::WriteEvents(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Event/WriteEvents"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsInstanceAPI::OnWriteEventsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Event/WriteEvents"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabEventsInstanceAPI::OnWriteEventsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Low, Handle);
+}
+
+TFuture<TPlayFabResult<EventsModels::FWriteEventsResponse>> UPlayFabEventsInstanceAPI::WriteEventsAsync(EventsModels::FWriteEventsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<EventsModels::FWriteEventsResponse, FWriteEventsDelegate>([this, &request, &Handle](const FWriteEventsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabEventsInstanceAPI::WriteEvents(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabEventsInstanceAPI::OnWriteEventsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteEventsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    EventsModels::FWriteEventsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<EventsModels::FWriteEventsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](EventsModels::FWriteEventsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabEventsInstanceAPI::WriteTelemetryEvents(
     EventsModels::FWriteEventsRequest& request,
     const FWriteTelemetryEventsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -118,21 +122,23 @@ bool UPlayFabEventsInstanceAPI::WriteTelemetryEvents(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Event/WriteTelemetryEvents"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsInstanceAPI::OnWriteTelemetryEventsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Event/WriteTelemetryEvents"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabEventsInstanceAPI::OnWriteTelemetryEventsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Low, Handle);
+}
+
+TFuture<TPlayFabResult<EventsModels::FWriteEventsResponse>> UPlayFabEventsInstanceAPI::WriteTelemetryEventsAsync(EventsModels::FWriteEventsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<EventsModels::FWriteEventsResponse, FWriteTelemetryEventsDelegate>([this, &request, &Handle](const FWriteTelemetryEventsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabEventsInstanceAPI::WriteTelemetryEvents(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabEventsInstanceAPI::OnWriteTelemetryEventsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteTelemetryEventsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    EventsModels::FWriteEventsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<EventsModels::FWriteEventsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](EventsModels::FWriteEventsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
@@ -30,7 +30,8 @@ FString UPlayFabExperimentationAPI::GetBuildIdentifier() const
 bool UPlayFabExperimentationAPI::CreateExclusionGroup(
     ExperimentationModels::FCreateExclusionGroupRequest& request,
     const FCreateExclusionGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -38,29 +39,32 @@ bool UPlayFabExperimentationAPI::CreateExclusionGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/CreateExclusionGroup"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/CreateExclusionGroup"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnCreateExclusionGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ExperimentationModels::FCreateExclusionGroupResult>> UPlayFabExperimentationAPI::CreateExclusionGroupAsync(ExperimentationModels::FCreateExclusionGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ExperimentationModels::FCreateExclusionGroupResult, FCreateExclusionGroupDelegate>([this, &request, &Handle](const FCreateExclusionGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabExperimentationAPI::CreateExclusionGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabExperimentationAPI::OnCreateExclusionGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateExclusionGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ExperimentationModels::FCreateExclusionGroupResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ExperimentationModels::FCreateExclusionGroupResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ExperimentationModels::FCreateExclusionGroupResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabExperimentationAPI::CreateExperiment(
     ExperimentationModels::FCreateExperimentRequest& request,
     const FCreateExperimentDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -68,29 +72,32 @@ bool UPlayFabExperimentationAPI::CreateExperiment(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/CreateExperiment"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/CreateExperiment"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnCreateExperimentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ExperimentationModels::FCreateExperimentResult>> UPlayFabExperimentationAPI::CreateExperimentAsync(ExperimentationModels::FCreateExperimentRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ExperimentationModels::FCreateExperimentResult, FCreateExperimentDelegate>([this, &request, &Handle](const FCreateExperimentDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabExperimentationAPI::CreateExperiment(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabExperimentationAPI::OnCreateExperimentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateExperimentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ExperimentationModels::FCreateExperimentResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ExperimentationModels::FCreateExperimentResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ExperimentationModels::FCreateExperimentResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabExperimentationAPI::DeleteExclusionGroup(
     ExperimentationModels::FDeleteExclusionGroupRequest& request,
     const FDeleteExclusionGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -98,29 +105,32 @@ bool UPlayFabExperimentationAPI::DeleteExclusionGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/DeleteExclusionGroup"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/DeleteExclusionGroup"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnDeleteExclusionGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ExperimentationModels::FEmptyResponse>> UPlayFabExperimentationAPI::DeleteExclusionGroupAsync(ExperimentationModels::FDeleteExclusionGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ExperimentationModels::FEmptyResponse, FDeleteExclusionGroupDelegate>([this, &request, &Handle](const FDeleteExclusionGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabExperimentationAPI::DeleteExclusionGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabExperimentationAPI::OnDeleteExclusionGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteExclusionGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ExperimentationModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ExperimentationModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ExperimentationModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabExperimentationAPI::DeleteExperiment(
     ExperimentationModels::FDeleteExperimentRequest& request,
     const FDeleteExperimentDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -128,29 +138,32 @@ bool UPlayFabExperimentationAPI::DeleteExperiment(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/DeleteExperiment"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/DeleteExperiment"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnDeleteExperimentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ExperimentationModels::FEmptyResponse>> UPlayFabExperimentationAPI::DeleteExperimentAsync(ExperimentationModels::FDeleteExperimentRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ExperimentationModels::FEmptyResponse, FDeleteExperimentDelegate>([this, &request, &Handle](const FDeleteExperimentDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabExperimentationAPI::DeleteExperiment(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabExperimentationAPI::OnDeleteExperimentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteExperimentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ExperimentationModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ExperimentationModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ExperimentationModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabExperimentationAPI::GetExclusionGroups(
     ExperimentationModels::FGetExclusionGroupsRequest& request,
     const FGetExclusionGroupsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -158,29 +171,32 @@ bool UPlayFabExperimentationAPI::GetExclusionGroups(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/GetExclusionGroups"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/GetExclusionGroups"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnGetExclusionGroupsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ExperimentationModels::FGetExclusionGroupsResult>> UPlayFabExperimentationAPI::GetExclusionGroupsAsync(ExperimentationModels::FGetExclusionGroupsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ExperimentationModels::FGetExclusionGroupsResult, FGetExclusionGroupsDelegate>([this, &request, &Handle](const FGetExclusionGroupsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabExperimentationAPI::GetExclusionGroups(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabExperimentationAPI::OnGetExclusionGroupsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetExclusionGroupsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ExperimentationModels::FGetExclusionGroupsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ExperimentationModels::FGetExclusionGroupsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ExperimentationModels::FGetExclusionGroupsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabExperimentationAPI::GetExclusionGroupTraffic(
     ExperimentationModels::FGetExclusionGroupTrafficRequest& request,
     const FGetExclusionGroupTrafficDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -188,29 +204,32 @@ bool UPlayFabExperimentationAPI::GetExclusionGroupTraffic(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/GetExclusionGroupTraffic"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/GetExclusionGroupTraffic"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnGetExclusionGroupTrafficResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ExperimentationModels::FGetExclusionGroupTrafficResult>> UPlayFabExperimentationAPI::GetExclusionGroupTrafficAsync(ExperimentationModels::FGetExclusionGroupTrafficRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ExperimentationModels::FGetExclusionGroupTrafficResult, FGetExclusionGroupTrafficDelegate>([this, &request, &Handle](const FGetExclusionGroupTrafficDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabExperimentationAPI::GetExclusionGroupTraffic(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabExperimentationAPI::OnGetExclusionGroupTrafficResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetExclusionGroupTrafficDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ExperimentationModels::FGetExclusionGroupTrafficResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ExperimentationModels::FGetExclusionGroupTrafficResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ExperimentationModels::FGetExclusionGroupTrafficResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabExperimentationAPI::GetExperiments(
     ExperimentationModels::FGetExperimentsRequest& request,
     const FGetExperimentsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -218,29 +237,32 @@ bool UPlayFabExperimentationAPI::GetExperiments(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/GetExperiments"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/GetExperiments"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnGetExperimentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ExperimentationModels::FGetExperimentsResult>> UPlayFabExperimentationAPI::GetExperimentsAsync(ExperimentationModels::FGetExperimentsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ExperimentationModels::FGetExperimentsResult, FGetExperimentsDelegate>([this, &request, &Handle](const FGetExperimentsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabExperimentationAPI::GetExperiments(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabExperimentationAPI::OnGetExperimentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetExperimentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ExperimentationModels::FGetExperimentsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ExperimentationModels::FGetExperimentsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ExperimentationModels::FGetExperimentsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabExperimentationAPI::GetLatestScorecard(
     ExperimentationModels::FGetLatestScorecardRequest& request,
     const FGetLatestScorecardDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -248,29 +270,32 @@ bool UPlayFabExperimentationAPI::GetLatestScorecard(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/GetLatestScorecard"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/GetLatestScorecard"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnGetLatestScorecardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ExperimentationModels::FGetLatestScorecardResult>> UPlayFabExperimentationAPI::GetLatestScorecardAsync(ExperimentationModels::FGetLatestScorecardRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ExperimentationModels::FGetLatestScorecardResult, FGetLatestScorecardDelegate>([this, &request, &Handle](const FGetLatestScorecardDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabExperimentationAPI::GetLatestScorecard(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabExperimentationAPI::OnGetLatestScorecardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLatestScorecardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ExperimentationModels::FGetLatestScorecardResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ExperimentationModels::FGetLatestScorecardResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ExperimentationModels::FGetLatestScorecardResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabExperimentationAPI::GetTreatmentAssignment(
     ExperimentationModels::FGetTreatmentAssignmentRequest& request,
     const FGetTreatmentAssignmentDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -278,29 +303,32 @@ bool UPlayFabExperimentationAPI::GetTreatmentAssignment(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/GetTreatmentAssignment"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/GetTreatmentAssignment"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnGetTreatmentAssignmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ExperimentationModels::FGetTreatmentAssignmentResult>> UPlayFabExperimentationAPI::GetTreatmentAssignmentAsync(ExperimentationModels::FGetTreatmentAssignmentRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ExperimentationModels::FGetTreatmentAssignmentResult, FGetTreatmentAssignmentDelegate>([this, &request, &Handle](const FGetTreatmentAssignmentDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabExperimentationAPI::GetTreatmentAssignment(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabExperimentationAPI::OnGetTreatmentAssignmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTreatmentAssignmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ExperimentationModels::FGetTreatmentAssignmentResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ExperimentationModels::FGetTreatmentAssignmentResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ExperimentationModels::FGetTreatmentAssignmentResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabExperimentationAPI::StartExperiment(
     ExperimentationModels::FStartExperimentRequest& request,
     const FStartExperimentDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -308,29 +336,32 @@ bool UPlayFabExperimentationAPI::StartExperiment(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/StartExperiment"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/StartExperiment"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnStartExperimentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ExperimentationModels::FEmptyResponse>> UPlayFabExperimentationAPI::StartExperimentAsync(ExperimentationModels::FStartExperimentRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ExperimentationModels::FEmptyResponse, FStartExperimentDelegate>([this, &request, &Handle](const FStartExperimentDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabExperimentationAPI::StartExperiment(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabExperimentationAPI::OnStartExperimentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FStartExperimentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ExperimentationModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ExperimentationModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ExperimentationModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabExperimentationAPI::StopExperiment(
     ExperimentationModels::FStopExperimentRequest& request,
     const FStopExperimentDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -338,29 +369,32 @@ bool UPlayFabExperimentationAPI::StopExperiment(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/StopExperiment"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/StopExperiment"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnStopExperimentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ExperimentationModels::FEmptyResponse>> UPlayFabExperimentationAPI::StopExperimentAsync(ExperimentationModels::FStopExperimentRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ExperimentationModels::FEmptyResponse, FStopExperimentDelegate>([this, &request, &Handle](const FStopExperimentDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabExperimentationAPI::StopExperiment(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabExperimentationAPI::OnStopExperimentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FStopExperimentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ExperimentationModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ExperimentationModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ExperimentationModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabExperimentationAPI::UpdateExclusionGroup(
     ExperimentationModels::FUpdateExclusionGroupRequest& request,
     const FUpdateExclusionGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -368,29 +402,32 @@ bool UPlayFabExperimentationAPI::UpdateExclusionGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/UpdateExclusionGroup"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/UpdateExclusionGroup"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnUpdateExclusionGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ExperimentationModels::FEmptyResponse>> UPlayFabExperimentationAPI::UpdateExclusionGroupAsync(ExperimentationModels::FUpdateExclusionGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ExperimentationModels::FEmptyResponse, FUpdateExclusionGroupDelegate>([this, &request, &Handle](const FUpdateExclusionGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabExperimentationAPI::UpdateExclusionGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabExperimentationAPI::OnUpdateExclusionGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateExclusionGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ExperimentationModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ExperimentationModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ExperimentationModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabExperimentationAPI::UpdateExperiment(
     ExperimentationModels::FUpdateExperimentRequest& request,
     const FUpdateExperimentDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -398,21 +435,23 @@ bool UPlayFabExperimentationAPI::UpdateExperiment(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/UpdateExperiment"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Experimentation/UpdateExperiment"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabExperimentationAPI::OnUpdateExperimentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ExperimentationModels::FEmptyResponse>> UPlayFabExperimentationAPI::UpdateExperimentAsync(ExperimentationModels::FUpdateExperimentRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ExperimentationModels::FEmptyResponse, FUpdateExperimentDelegate>([this, &request, &Handle](const FUpdateExperimentDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabExperimentationAPI::UpdateExperiment(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabExperimentationAPI::OnUpdateExperimentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateExperimentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ExperimentationModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ExperimentationModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ExperimentationModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
@@ -7,6 +7,7 @@
 
 #include "Core/PlayFabInsightsDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
+#include "Core/PlayFabJsonPullReader.h"
 
 using namespace PlayFab;
 using namespace PlayFab::InsightsModels;
@@ -16,7 +17,8 @@ PlayFab::InsightsModels::FInsightsEmptyRequest::~FInsightsEmptyRequest()
 
 }
 
-void PlayFab::InsightsModels::FInsightsEmptyRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::InsightsModels::FInsightsEmptyRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -34,6 +36,16 @@ void PlayFab::InsightsModels::FInsightsEmptyRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::InsightsModels::FInsightsEmptyRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::InsightsModels::FInsightsEmptyRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::InsightsModels::FInsightsEmptyRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -43,19 +55,53 @@ bool PlayFab::InsightsModels::FInsightsEmptyRequest::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::InsightsModels::FInsightsEmptyRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FInsightsEmptyRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::InsightsModels::FInsightsPerformanceLevel::~FInsightsPerformanceLevel()
 {
 
 }
 
-void PlayFab::InsightsModels::FInsightsPerformanceLevel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::InsightsModels::FInsightsPerformanceLevel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -86,6 +132,16 @@ void PlayFab::InsightsModels::FInsightsPerformanceLevel::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::InsightsModels::FInsightsPerformanceLevel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::InsightsModels::FInsightsPerformanceLevel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::InsightsModels::FInsightsPerformanceLevel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -149,12 +205,67 @@ bool PlayFab::InsightsModels::FInsightsPerformanceLevel::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::InsightsModels::FInsightsPerformanceLevel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ActiveEventExports"))
+        {
+            reader.ReadValue(ActiveEventExports);
+        }
+        else if (reader.IsField("CacheSizeMB"))
+        {
+            reader.ReadValue(CacheSizeMB);
+        }
+        else if (reader.IsField("Concurrency"))
+        {
+            reader.ReadValue(Concurrency);
+        }
+        else if (reader.IsField("CreditsPerMinute"))
+        {
+            reader.ReadValue(CreditsPerMinute);
+        }
+        else if (reader.IsField("EventsPerSecond"))
+        {
+            reader.ReadValue(EventsPerSecond);
+        }
+        else if (reader.IsField("Level"))
+        {
+            reader.ReadValue(Level);
+        }
+        else if (reader.IsField("MaxMemoryPerQueryMB"))
+        {
+            reader.ReadValue(MaxMemoryPerQueryMB);
+        }
+        else if (reader.IsField("VirtualCpuCores"))
+        {
+            reader.ReadValue(VirtualCpuCores);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FInsightsPerformanceLevel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::InsightsModels::FInsightsGetLimitsResponse::~FInsightsGetLimitsResponse()
 {
 
 }
 
-void PlayFab::InsightsModels::FInsightsGetLimitsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::InsightsModels::FInsightsGetLimitsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -182,6 +293,16 @@ void PlayFab::InsightsModels::FInsightsGetLimitsResponse::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::InsightsModels::FInsightsGetLimitsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::InsightsModels::FInsightsGetLimitsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::InsightsModels::FInsightsGetLimitsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -218,19 +339,69 @@ bool PlayFab::InsightsModels::FInsightsGetLimitsResponse::readFromValue(const TS
     for (int32 Idx = 0; Idx < SubMetersArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = SubMetersArray[Idx];
-        SubMeters.Add(FInsightsPerformanceLevel(CurrentItem->AsObject()));
+        SubMeters.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::InsightsModels::FInsightsGetLimitsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DefaultPerformanceLevel"))
+        {
+            reader.ReadValue(DefaultPerformanceLevel);
+        }
+        else if (reader.IsField("DefaultStorageRetentionDays"))
+        {
+            reader.ReadValue(DefaultStorageRetentionDays);
+        }
+        else if (reader.IsField("StorageMaxRetentionDays"))
+        {
+            reader.ReadValue(StorageMaxRetentionDays);
+        }
+        else if (reader.IsField("StorageMinRetentionDays"))
+        {
+            reader.ReadValue(StorageMinRetentionDays);
+        }
+        else if (reader.IsField("SubMeters"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { SubMeters[SubMeters.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FInsightsGetLimitsResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::InsightsModels::FInsightsGetOperationStatusResponse::~FInsightsGetOperationStatusResponse()
 {
 
 }
 
-void PlayFab::InsightsModels::FInsightsGetOperationStatusResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::InsightsModels::FInsightsGetOperationStatusResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -273,6 +444,16 @@ void PlayFab::InsightsModels::FInsightsGetOperationStatusResponse::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::InsightsModels::FInsightsGetOperationStatusResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::InsightsModels::FInsightsGetOperationStatusResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::InsightsModels::FInsightsGetOperationStatusResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -330,13 +511,68 @@ bool PlayFab::InsightsModels::FInsightsGetOperationStatusResponse::readFromValue
     return HasSucceeded;
 }
 
+bool PlayFab::InsightsModels::FInsightsGetOperationStatusResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Message"))
+        {
+            reader.ReadValue(Message);
+        }
+        else if (reader.IsField("OperationCompletedTime"))
+        {
+            reader.ReadValue(OperationCompletedTime);
+        }
+        else if (reader.IsField("OperationId"))
+        {
+            reader.ReadValue(OperationId);
+        }
+        else if (reader.IsField("OperationLastUpdated"))
+        {
+            reader.ReadValue(OperationLastUpdated);
+        }
+        else if (reader.IsField("OperationStartedTime"))
+        {
+            reader.ReadValue(OperationStartedTime);
+        }
+        else if (reader.IsField("OperationType"))
+        {
+            reader.ReadValue(OperationType);
+        }
+        else if (reader.IsField("OperationValue"))
+        {
+            reader.ReadValue(OperationValue);
+        }
+        else if (reader.IsField("Status"))
+        {
+            reader.ReadValue(Status);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FInsightsGetOperationStatusResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::InsightsModels::FInsightsGetDetailsResponse::~FInsightsGetDetailsResponse()
 {
     //if (Limits != nullptr) delete Limits;
 
 }
 
-void PlayFab::InsightsModels::FInsightsGetDetailsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::InsightsModels::FInsightsGetDetailsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -373,6 +609,16 @@ void PlayFab::InsightsModels::FInsightsGetDetailsResponse::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::InsightsModels::FInsightsGetDetailsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::InsightsModels::FInsightsGetDetailsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::InsightsModels::FInsightsGetDetailsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -394,14 +640,14 @@ bool PlayFab::InsightsModels::FInsightsGetDetailsResponse::readFromValue(const T
     const TSharedPtr<FJsonValue> LimitsValue = obj->TryGetField(TEXT("Limits"));
     if (LimitsValue.IsValid() && !LimitsValue->IsNull())
     {
-        Limits = MakeShareable(new FInsightsGetLimitsResponse(LimitsValue->AsObject()));
+        Limits = MakeShared<FInsightsGetLimitsResponse>(LimitsValue->AsObject());
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PendingOperationsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PendingOperations"));
     for (int32 Idx = 0; Idx < PendingOperationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PendingOperationsArray[Idx];
-        PendingOperations.Add(FInsightsGetOperationStatusResponse(CurrentItem->AsObject()));
+        PendingOperations.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -422,12 +668,67 @@ bool PlayFab::InsightsModels::FInsightsGetDetailsResponse::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::InsightsModels::FInsightsGetDetailsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DataUsageMb"))
+        {
+            reader.ReadValue(DataUsageMb);
+        }
+        else if (reader.IsField("ErrorMessage"))
+        {
+            reader.ReadValue(ErrorMessage);
+        }
+        else if (reader.IsField("Limits"))
+        {
+            Limits = MakeShared<FInsightsGetLimitsResponse>();
+            Limits->readFromReader(reader);
+        }
+        else if (reader.IsField("PendingOperations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { PendingOperations[PendingOperations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("PerformanceLevel"))
+        {
+            reader.ReadValue(PerformanceLevel);
+        }
+        else if (reader.IsField("RetentionDays"))
+        {
+            reader.ReadValue(RetentionDays);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FInsightsGetDetailsResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::InsightsModels::FInsightsGetOperationStatusRequest::~FInsightsGetOperationStatusRequest()
 {
 
 }
 
-void PlayFab::InsightsModels::FInsightsGetOperationStatusRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::InsightsModels::FInsightsGetOperationStatusRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -451,6 +752,16 @@ void PlayFab::InsightsModels::FInsightsGetOperationStatusRequest::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::InsightsModels::FInsightsGetOperationStatusRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::InsightsModels::FInsightsGetOperationStatusRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::InsightsModels::FInsightsGetOperationStatusRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -460,7 +771,7 @@ bool PlayFab::InsightsModels::FInsightsGetOperationStatusRequest::readFromValue(
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -474,12 +785,50 @@ bool PlayFab::InsightsModels::FInsightsGetOperationStatusRequest::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::InsightsModels::FInsightsGetOperationStatusRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("OperationId"))
+        {
+            reader.ReadValue(OperationId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FInsightsGetOperationStatusRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::InsightsModels::FInsightsGetPendingOperationsRequest::~FInsightsGetPendingOperationsRequest()
 {
 
 }
 
-void PlayFab::InsightsModels::FInsightsGetPendingOperationsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::InsightsModels::FInsightsGetPendingOperationsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -503,6 +852,16 @@ void PlayFab::InsightsModels::FInsightsGetPendingOperationsRequest::writeJSON(Js
     writer->WriteObjectEnd();
 }
 
+void PlayFab::InsightsModels::FInsightsGetPendingOperationsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::InsightsModels::FInsightsGetPendingOperationsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::InsightsModels::FInsightsGetPendingOperationsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -512,7 +871,7 @@ bool PlayFab::InsightsModels::FInsightsGetPendingOperationsRequest::readFromValu
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -526,12 +885,50 @@ bool PlayFab::InsightsModels::FInsightsGetPendingOperationsRequest::readFromValu
     return HasSucceeded;
 }
 
+bool PlayFab::InsightsModels::FInsightsGetPendingOperationsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("OperationType"))
+        {
+            reader.ReadValue(OperationType);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FInsightsGetPendingOperationsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::InsightsModels::FInsightsGetPendingOperationsResponse::~FInsightsGetPendingOperationsResponse()
 {
 
 }
 
-void PlayFab::InsightsModels::FInsightsGetPendingOperationsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::InsightsModels::FInsightsGetPendingOperationsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -547,6 +944,16 @@ void PlayFab::InsightsModels::FInsightsGetPendingOperationsResponse::writeJSON(J
     writer->WriteObjectEnd();
 }
 
+void PlayFab::InsightsModels::FInsightsGetPendingOperationsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::InsightsModels::FInsightsGetPendingOperationsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::InsightsModels::FInsightsGetPendingOperationsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -555,19 +962,53 @@ bool PlayFab::InsightsModels::FInsightsGetPendingOperationsResponse::readFromVal
     for (int32 Idx = 0; Idx < PendingOperationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PendingOperationsArray[Idx];
-        PendingOperations.Add(FInsightsGetOperationStatusResponse(CurrentItem->AsObject()));
+        PendingOperations.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::InsightsModels::FInsightsGetPendingOperationsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PendingOperations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { PendingOperations[PendingOperations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FInsightsGetPendingOperationsResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::InsightsModels::FInsightsOperationResponse::~FInsightsOperationResponse()
 {
 
 }
 
-void PlayFab::InsightsModels::FInsightsOperationResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::InsightsModels::FInsightsOperationResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -592,6 +1033,16 @@ void PlayFab::InsightsModels::FInsightsOperationResponse::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::InsightsModels::FInsightsOperationResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::InsightsModels::FInsightsOperationResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::InsightsModels::FInsightsOperationResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -620,12 +1071,47 @@ bool PlayFab::InsightsModels::FInsightsOperationResponse::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::InsightsModels::FInsightsOperationResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Message"))
+        {
+            reader.ReadValue(Message);
+        }
+        else if (reader.IsField("OperationId"))
+        {
+            reader.ReadValue(OperationId);
+        }
+        else if (reader.IsField("OperationType"))
+        {
+            reader.ReadValue(OperationType);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FInsightsOperationResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::InsightsModels::FInsightsSetPerformanceRequest::~FInsightsSetPerformanceRequest()
 {
 
 }
 
-void PlayFab::InsightsModels::FInsightsSetPerformanceRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::InsightsModels::FInsightsSetPerformanceRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -646,6 +1132,16 @@ void PlayFab::InsightsModels::FInsightsSetPerformanceRequest::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::InsightsModels::FInsightsSetPerformanceRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::InsightsModels::FInsightsSetPerformanceRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::InsightsModels::FInsightsSetPerformanceRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -655,7 +1151,7 @@ bool PlayFab::InsightsModels::FInsightsSetPerformanceRequest::readFromValue(cons
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -669,12 +1165,50 @@ bool PlayFab::InsightsModels::FInsightsSetPerformanceRequest::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::InsightsModels::FInsightsSetPerformanceRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PerformanceLevel"))
+        {
+            reader.ReadValue(PerformanceLevel);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FInsightsSetPerformanceRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::InsightsModels::FInsightsSetStorageRetentionRequest::~FInsightsSetStorageRetentionRequest()
 {
 
 }
 
-void PlayFab::InsightsModels::FInsightsSetStorageRetentionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::InsightsModels::FInsightsSetStorageRetentionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -695,6 +1229,16 @@ void PlayFab::InsightsModels::FInsightsSetStorageRetentionRequest::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::InsightsModels::FInsightsSetStorageRetentionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::InsightsModels::FInsightsSetStorageRetentionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::InsightsModels::FInsightsSetStorageRetentionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -704,7 +1248,7 @@ bool PlayFab::InsightsModels::FInsightsSetStorageRetentionRequest::readFromValue
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -718,3 +1262,40 @@ bool PlayFab::InsightsModels::FInsightsSetStorageRetentionRequest::readFromValue
     return HasSucceeded;
 }
 
+bool PlayFab::InsightsModels::FInsightsSetStorageRetentionRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("RetentionDays"))
+        {
+            reader.ReadValue(RetentionDays);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FInsightsSetStorageRetentionRequest();
+        return false;
+    }
+    return true;
+}
+
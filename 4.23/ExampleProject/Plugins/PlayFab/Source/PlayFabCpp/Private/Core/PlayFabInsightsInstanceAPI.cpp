@@ -80,7 +80,8 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabInsightsInstanceAPI::GetOrCrea
 bool UPlayFabInsightsInstanceAPI::GetDetails(
     InsightsModels::FInsightsEmptyRequest& request,
     const FGetDetailsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -88,29 +89,32 @@ bool UPlayFabInsightsInstanceAPI::GetDetails(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Insights/GetDetails"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsInstanceAPI::OnGetDetailsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Insights/GetDetails"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabInsightsInstanceAPI::OnGetDetailsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<InsightsModels::FInsightsGetDetailsResponse>> UPlayFabInsightsInstanceAPI::GetDetailsAsync(InsightsModels::FInsightsEmptyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<InsightsModels::FInsightsGetDetailsResponse, FGetDetailsDelegate>([this, &request, &Handle](const FGetDetailsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabInsightsInstanceAPI::GetDetails(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabInsightsInstanceAPI::OnGetDetailsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetDetailsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    InsightsModels::FInsightsGetDetailsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<InsightsModels::FInsightsGetDetailsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](InsightsModels::FInsightsGetDetailsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabInsightsInstanceAPI::GetLimits(
     InsightsModels::FInsightsEmptyRequest& request,
     const FGetLimitsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -118,29 +122,32 @@ bool UPlayFabInsightsInstanceAPI::GetLimits(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Insights/GetLimits"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsInstanceAPI::OnGetLimitsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Insights/GetLimits"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabInsightsInstanceAPI::OnGetLimitsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<InsightsModels::FInsightsGetLimitsResponse>> UPlayFabInsightsInstanceAPI::GetLimitsAsync(InsightsModels::FInsightsEmptyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<InsightsModels::FInsightsGetLimitsResponse, FGetLimitsDelegate>([this, &request, &Handle](const FGetLimitsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabInsightsInstanceAPI::GetLimits(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabInsightsInstanceAPI::OnGetLimitsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLimitsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    InsightsModels::FInsightsGetLimitsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<InsightsModels::FInsightsGetLimitsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](InsightsModels::FInsightsGetLimitsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabInsightsInstanceAPI::GetOperationStatus(
     InsightsModels::FInsightsGetOperationStatusRequest& request,
     const FGetOperationStatusDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -148,29 +155,32 @@ bool UPlayFabInsightsInstanceAPI::GetOperationStatus(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Insights/GetOperationStatus"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsInstanceAPI::OnGetOperationStatusResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Insights/GetOperationStatus"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabInsightsInstanceAPI::OnGetOperationStatusResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<InsightsModels::FInsightsGetOperationStatusResponse>> UPlayFabInsightsInstanceAPI::GetOperationStatusAsync(InsightsModels::FInsightsGetOperationStatusRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<InsightsModels::FInsightsGetOperationStatusResponse, FGetOperationStatusDelegate>([this, &request, &Handle](const FGetOperationStatusDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabInsightsInstanceAPI::GetOperationStatus(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabInsightsInstanceAPI::OnGetOperationStatusResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetOperationStatusDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    InsightsModels::FInsightsGetOperationStatusResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<InsightsModels::FInsightsGetOperationStatusResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](InsightsModels::FInsightsGetOperationStatusResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabInsightsInstanceAPI::GetPendingOperations(
     InsightsModels::FInsightsGetPendingOperationsRequest& request,
     const FGetPendingOperationsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -178,29 +188,32 @@ bool UPlayFabInsightsInstanceAPI::GetPendingOperations(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Insights/GetPendingOperations"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsInstanceAPI::OnGetPendingOperationsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Insights/GetPendingOperations"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabInsightsInstanceAPI::OnGetPendingOperationsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<InsightsModels::FInsightsGetPendingOperationsResponse>> UPlayFabInsightsInstanceAPI::GetPendingOperationsAsync(InsightsModels::FInsightsGetPendingOperationsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<InsightsModels::FInsightsGetPendingOperationsResponse, FGetPendingOperationsDelegate>([this, &request, &Handle](const FGetPendingOperationsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabInsightsInstanceAPI::GetPendingOperations(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabInsightsInstanceAPI::OnGetPendingOperationsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPendingOperationsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    InsightsModels::FInsightsGetPendingOperationsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<InsightsModels::FInsightsGetPendingOperationsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](InsightsModels::FInsightsGetPendingOperationsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabInsightsInstanceAPI::SetPerformance(
     InsightsModels::FInsightsSetPerformanceRequest& request,
     const FSetPerformanceDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -208,29 +221,32 @@ bool UPlayFabInsightsInstanceAPI::SetPerformance(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Insights/SetPerformance"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsInstanceAPI::OnSetPerformanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Insights/SetPerformance"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabInsightsInstanceAPI::OnSetPerformanceResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<InsightsModels::FInsightsOperationResponse>> UPlayFabInsightsInstanceAPI::SetPerformanceAsync(InsightsModels::FInsightsSetPerformanceRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<InsightsModels::FInsightsOperationResponse, FSetPerformanceDelegate>([this, &request, &Handle](const FSetPerformanceDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabInsightsInstanceAPI::SetPerformance(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabInsightsInstanceAPI::OnSetPerformanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPerformanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    InsightsModels::FInsightsOperationResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<InsightsModels::FInsightsOperationResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](InsightsModels::FInsightsOperationResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabInsightsInstanceAPI::SetStorageRetention(
     InsightsModels::FInsightsSetStorageRetentionRequest& request,
     const FSetStorageRetentionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -238,21 +254,23 @@ bool UPlayFabInsightsInstanceAPI::SetStorageRetention(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Insights/SetStorageRetention"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsInstanceAPI::OnSetStorageRetentionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Insights/SetStorageRetention"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabInsightsInstanceAPI::OnSetStorageRetentionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<InsightsModels::FInsightsOperationResponse>> UPlayFabInsightsInstanceAPI::SetStorageRetentionAsync(InsightsModels::FInsightsSetStorageRetentionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<InsightsModels::FInsightsOperationResponse, FSetStorageRetentionDelegate>([this, &request, &Handle](const FSetStorageRetentionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabInsightsInstanceAPI::SetStorageRetention(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabInsightsInstanceAPI::OnSetStorageRetentionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetStorageRetentionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    InsightsModels::FInsightsOperationResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<InsightsModels::FInsightsOperationResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](InsightsModels::FInsightsOperationResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
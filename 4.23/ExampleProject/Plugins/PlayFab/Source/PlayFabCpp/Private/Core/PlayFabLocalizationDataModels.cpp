@@ -7,6 +7,7 @@
 
 #include "Core/PlayFabLocalizationDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
+#include "Core/PlayFabJsonPullReader.h"
 
 using namespace PlayFab;
 using namespace PlayFab::LocalizationModels;
@@ -16,7 +17,8 @@ PlayFab::LocalizationModels::FGetLanguageListRequest::~FGetLanguageListRequest()
 
 }
 
-void PlayFab::LocalizationModels::FGetLanguageListRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::LocalizationModels::FGetLanguageListRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -34,6 +36,16 @@ void PlayFab::LocalizationModels::FGetLanguageListRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::LocalizationModels::FGetLanguageListRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::LocalizationModels::FGetLanguageListRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::LocalizationModels::FGetLanguageListRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -43,19 +55,53 @@ bool PlayFab::LocalizationModels::FGetLanguageListRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::LocalizationModels::FGetLanguageListRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLanguageListRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::LocalizationModels::FGetLanguageListResponse::~FGetLanguageListResponse()
 {
 
 }
 
-void PlayFab::LocalizationModels::FGetLanguageListResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::LocalizationModels::FGetLanguageListResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -71,6 +117,16 @@ void PlayFab::LocalizationModels::FGetLanguageListResponse::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::LocalizationModels::FGetLanguageListResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::LocalizationModels::FGetLanguageListResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::LocalizationModels::FGetLanguageListResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -80,3 +136,36 @@ bool PlayFab::LocalizationModels::FGetLanguageListResponse::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::LocalizationModels::FGetLanguageListResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("LanguageList"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { LanguageList.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLanguageListResponse();
+        return false;
+    }
+    return true;
+}
+
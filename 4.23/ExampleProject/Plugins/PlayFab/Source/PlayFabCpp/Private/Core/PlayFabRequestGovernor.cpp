@@ -0,0 +1,311 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabRequestGovernor.h"
+#include "PlayFabRuntimeSettings.h"
+#include "PlayFabCallCounters.h"
+#include "Containers/Ticker.h"
+#include "Async/Async.h"
+#include "Misc/ScopeLock.h"
+
+using namespace PlayFab;
+
+namespace
+{
+    // A throttled endpoint never drops below this fraction of its configured rate
+    const float MinRateFraction = 0.1f;
+    // Each successful call gives back this fraction of the configured rate
+    const float RateRecoveryFraction = 0.1f;
+
+    struct FQueuedRequest
+    {
+        FHttpRequestPtr HttpRequest;
+        EPlayFabRequestPriority Priority;
+        uint64 Sequence;
+    };
+
+    // Heap order: higher priority first, then first come first served
+    struct FQueuedRequestOrder
+    {
+        bool operator()(const FQueuedRequest& A, const FQueuedRequest& B) const
+        {
+            return A.Priority != B.Priority ? A.Priority > B.Priority : A.Sequence < B.Sequence;
+        }
+    };
+
+    struct FEndpointState
+    {
+        float ConfiguredRate = 0.0f;
+        float CurrentRate = 0.0f;
+        int32 BurstSize = 1;
+        int32 MaxInFlight = 0;
+        double Tokens = 0.0;
+        double LastRefillTime = 0.0;
+        // Requests that have taken a slot and haven't completed yet
+        TSet<FHttpRequestPtr> InFlight;
+        TArray<FQueuedRequest> Queue;
+
+        void Refill(double Now)
+        {
+            Tokens = FMath::Min<double>(BurstSize, Tokens + (Now - LastRefillTime) * CurrentRate);
+            LastRefillTime = Now;
+        }
+
+        bool CanSend() const
+        {
+            return (MaxInFlight <= 0 || InFlight.Num() < MaxInFlight) && (ConfiguredRate <= 0.0f || Tokens >= 1.0);
+        }
+
+        void OnSend(const FHttpRequestPtr& HttpRequest)
+        {
+            Tokens -= 1.0;
+            InFlight.Add(HttpRequest);
+        }
+
+        // A request that failed to start gives back its token as well as its slot
+        void OnSendFailed(const FHttpRequestPtr& HttpRequest)
+        {
+            if (InFlight.Remove(HttpRequest) > 0)
+            {
+                Tokens = FMath::Min<double>(BurstSize, Tokens + 1.0);
+            }
+        }
+
+        // Moves every queued request the limits allow into OutReady
+        void Drain(double Now, TArray<FHttpRequestPtr>& OutReady)
+        {
+            Refill(Now);
+            while (Queue.Num() > 0 && CanSend())
+            {
+                FQueuedRequest Next;
+                Queue.HeapPop(Next, FQueuedRequestOrder(), false);
+                OnSend(Next.HttpRequest);
+                OutReady.Add(MoveTemp(Next.HttpRequest));
+            }
+        }
+    };
+
+    FCriticalSection GovernorLock;
+    TMap<FString, FEndpointState> Endpoints;
+    uint64 NextSequence = 0;
+    // Set, under GovernorLock, from the moment a pump is requested until it finds every queue empty
+    bool bIsPumpScheduled = false;
+
+    // Call with GovernorLock held
+    FEndpointState& FindOrAddEndpoint(const FString& UrlPath, double Now)
+    {
+        if (FEndpointState* Existing = Endpoints.Find(UrlPath))
+        {
+            return *Existing;
+        }
+
+        const UPlayFabRuntimeSettings* Settings = GetDefault<UPlayFabRuntimeSettings>();
+        const FPlayFabEndpointLimit* Limit = Settings->EndpointLimits.Find(UrlPath);
+        if (Limit == nullptr)
+        {
+            Limit = &Settings->DefaultEndpointLimit;
+        }
+
+        FEndpointState& State = Endpoints.Add(UrlPath);
+        State.ConfiguredRate = State.CurrentRate = Limit->RequestsPerSecond;
+        State.BurstSize = FMath::Max(1, Limit->BurstSize);
+        State.MaxInFlight = Limit->MaxInFlight;
+        State.Tokens = State.BurstSize;
+        State.LastRefillTime = Now;
+        return State;
+    }
+
+    FString GetUrlPath(const FString& RequestUrl)
+    {
+        FString UrlPath, ApiName;
+        PlayFabCommon::FPlayFabCallCounters::ParseRequestUrl(RequestUrl, UrlPath, ApiName);
+        return UrlPath;
+    }
+
+    void OnSendFailed(const FHttpRequestPtr& HttpRequest)
+    {
+        const FString UrlPath = GetUrlPath(HttpRequest->GetURL());
+        FScopeLock Lock(&GovernorLock);
+        if (FEndpointState* State = Endpoints.Find(UrlPath))
+        {
+            State->OnSendFailed(HttpRequest);
+        }
+    }
+
+    void SendAll(const TArray<FHttpRequestPtr>& Requests)
+    {
+        for (const FHttpRequestPtr& HttpRequest : Requests)
+        {
+            if (!HttpRequest->ProcessRequest())
+            {
+                // Whoever submitted it was told it was queued, so it learns of the failure as it would of any other
+                OnSendFailed(HttpRequest);
+                HttpRequest->OnProcessRequestComplete().ExecuteIfBound(HttpRequest, nullptr, false);
+            }
+        }
+    }
+}
+
+bool FPlayFabRequestGovernor::Submit(const TSharedRef<IHttpRequest>& HttpRequest, EPlayFabRequestPriority Priority)
+{
+    if (!GetDefault<UPlayFabRuntimeSettings>()->bEnableRequestGovernor)
+    {
+        return HttpRequest->ProcessRequest();
+    }
+
+    const FString UrlPath = GetUrlPath(HttpRequest->GetURL());
+    bool bSendNow = false;
+    bool bSchedulePump = false;
+    {
+        FScopeLock Lock(&GovernorLock);
+        const double Now = FPlatformTime::Seconds();
+        FEndpointState& State = FindOrAddEndpoint(UrlPath, Now);
+        State.Refill(Now);
+        if (State.Queue.Num() > 0 || !State.CanSend())
+        {
+            FQueuedRequest Queued;
+            Queued.HttpRequest = HttpRequest;
+            Queued.Priority = Priority;
+            Queued.Sequence = NextSequence++;
+            State.Queue.HeapPush(MoveTemp(Queued), FQueuedRequestOrder());
+
+            bSchedulePump = !bIsPumpScheduled;
+            bIsPumpScheduled = true;
+        }
+        else
+        {
+            State.OnSend(HttpRequest);
+            bSendNow = true;
+        }
+    }
+
+    if (!bSendNow)
+    {
+        // The ticker is added outside the lock, as it may have to wait for the game thread
+        if (bSchedulePump)
+        {
+            SchedulePump();
+        }
+        return true;
+    }
+
+    if (!HttpRequest->ProcessRequest())
+    {
+        OnSendFailed(HttpRequest);
+        return false;
+    }
+    return true;
+}
+
+void FPlayFabRequestGovernor::OnRequestComplete(const FHttpRequestPtr& HttpRequest, bool bWasThrottled)
+{
+    const FString UrlPath = GetUrlPath(HttpRequest->GetURL());
+    TArray<FHttpRequestPtr> Ready;
+    {
+        FScopeLock Lock(&GovernorLock);
+        FEndpointState* State = Endpoints.Find(UrlPath);
+        if (State == nullptr || State->InFlight.Remove(HttpRequest) == 0)
+        {
+            return;
+        }
+
+        if (bWasThrottled)
+        {
+            // Back off hard, and drop any burst we had saved up
+            State->CurrentRate = FMath::Max(State->ConfiguredRate * MinRateFraction, State->CurrentRate * 0.5f);
+            State->Tokens = FMath::Min(State->Tokens, 0.0);
+        }
+        else
+        {
+            State->CurrentRate = FMath::Min(State->ConfiguredRate, State->CurrentRate + State->ConfiguredRate * RateRecoveryFraction);
+        }
+
+        State->Drain(FPlatformTime::Seconds(), Ready);
+    }
+
+    SendAll(Ready);
+}
+
+bool FPlayFabRequestGovernor::Withdraw(const FHttpRequestPtr& HttpRequest)
+{
+    const FString UrlPath = GetUrlPath(HttpRequest->GetURL());
+    FScopeLock Lock(&GovernorLock);
+    FEndpointState* State = Endpoints.Find(UrlPath);
+    if (State == nullptr)
+    {
+        return false;
+    }
+
+    const int32 Index = State->Queue.IndexOfByPredicate([&HttpRequest](const FQueuedRequest& Queued) { return Queued.HttpRequest == HttpRequest; });
+    if (Index == INDEX_NONE)
+    {
+        return false;
+    }
+    State->Queue.HeapRemoveAt(Index, FQueuedRequestOrder(), false);
+    return true;
+}
+
+int32 FPlayFabRequestGovernor::GetQueuedCount(const FString& UrlPath)
+{
+    FScopeLock Lock(&GovernorLock);
+    const FEndpointState* State = Endpoints.Find(UrlPath);
+    return State != nullptr ? State->Queue.Num() : 0;
+}
+
+int32 FPlayFabRequestGovernor::GetQueuedCount()
+{
+    FScopeLock Lock(&GovernorLock);
+    int32 Count = 0;
+    for (const auto& Pair : Endpoints)
+    {
+        Count += Pair.Value.Queue.Num();
+    }
+    return Count;
+}
+
+float FPlayFabRequestGovernor::GetCurrentRate(const FString& UrlPath)
+{
+    FScopeLock Lock(&GovernorLock);
+    const FEndpointState* State = Endpoints.Find(UrlPath);
+    return State != nullptr ? State->CurrentRate : GetDefault<UPlayFabRuntimeSettings>()->DefaultEndpointLimit.RequestsPerSecond;
+}
+
+void FPlayFabRequestGovernor::SchedulePump()
+{
+    // The core ticker isn't thread safe, and requests may be submitted from any thread
+    if (IsInGameThread())
+    {
+        FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FPlayFabRequestGovernor::PumpQueues));
+        return;
+    }
+    AsyncTask(ENamedThreads::GameThread, []()
+    {
+        FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FPlayFabRequestGovernor::PumpQueues));
+    });
+}
+
+bool FPlayFabRequestGovernor::PumpQueues(float DeltaTime)
+{
+    TArray<FHttpRequestPtr> Ready;
+    bool AnyQueued = false;
+    {
+        FScopeLock Lock(&GovernorLock);
+        const double Now = FPlatformTime::Seconds();
+        for (auto& Pair : Endpoints)
+        {
+            Pair.Value.Drain(Now, Ready);
+            AnyQueued |= Pair.Value.Queue.Num() > 0;
+        }
+
+        // The ticker is removed when this returns false
+        if (!AnyQueued)
+        {
+            bIsPumpScheduled = false;
+        }
+    }
+
+    SendAll(Ready);
+    return AnyQueued;
+}
@@ -0,0 +1,94 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabRequestHandle.h"
+#include "Misc/ScopeLock.h"
+
+using namespace PlayFab;
+
+FPlayFabRequestHandle FPlayFabRequestHandle::Create(float TimeoutSeconds)
+{
+    FPlayFabRequestHandle Handle;
+    Handle.State = MakeShared<FState, ESPMode::ThreadSafe>();
+    Handle.State->TimeoutSeconds = FMath::Max(0.0f, TimeoutSeconds);
+    return Handle;
+}
+
+void FPlayFabRequestHandle::Cancel() const
+{
+    if (!State.IsValid())
+    {
+        return;
+    }
+
+    TArray<TWeakPtr<IPlayFabCancellable, ESPMode::ThreadSafe>> Calls;
+    {
+        FScopeLock Lock(&State->Lock);
+        State->bIsCancelled = true;
+        Calls = MoveTemp(State->Calls);
+    }
+
+    // Outside the lock, since cancelling a call may complete HTTP requests synchronously
+    for (const TWeakPtr<IPlayFabCancellable, ESPMode::ThreadSafe>& Call : Calls)
+    {
+        if (TSharedPtr<IPlayFabCancellable, ESPMode::ThreadSafe> Pinned = Call.Pin())
+        {
+            Pinned->Cancel();
+        }
+    }
+}
+
+bool FPlayFabRequestHandle::IsCancelled() const
+{
+    if (!State.IsValid())
+    {
+        return false;
+    }
+
+    FScopeLock Lock(&State->Lock);
+    return State->bIsCancelled;
+}
+
+float FPlayFabRequestHandle::GetTimeout() const
+{
+    return State.IsValid() ? State->TimeoutSeconds : 0.0f;
+}
+
+int32 FPlayFabRequestHandle::GetPendingCount() const
+{
+    if (!State.IsValid())
+    {
+        return 0;
+    }
+
+    FScopeLock Lock(&State->Lock);
+    int32 Count = 0;
+    for (const TWeakPtr<IPlayFabCancellable, ESPMode::ThreadSafe>& Call : State->Calls)
+    {
+        TSharedPtr<IPlayFabCancellable, ESPMode::ThreadSafe> Pinned = Call.Pin();
+        Count += Pinned.IsValid() && !Pinned->IsDelivered() ? 1 : 0;
+    }
+    return Count;
+}
+
+bool FPlayFabRequestHandle::Attach(const TSharedRef<IPlayFabCancellable, ESPMode::ThreadSafe>& Call) const
+{
+    check(State.IsValid());
+    FScopeLock Lock(&State->Lock);
+    if (State->bIsCancelled)
+    {
+        return false;
+    }
+
+    // Long-lived handles see many calls; drop the ones that are done before adding another
+    // A finished call is kept until its result has been delivered, so that cancelling still drops a queued result
+    State->Calls.RemoveAll([](const TWeakPtr<IPlayFabCancellable, ESPMode::ThreadSafe>& Existing)
+    {
+        TSharedPtr<IPlayFabCancellable, ESPMode::ThreadSafe> Pinned = Existing.Pin();
+        return !Pinned.IsValid() || Pinned->IsDelivered() || Pinned->IsCancelled();
+    });
+    State->Calls.Add(Call);
+    return true;
+}
@@ -7,6 +7,7 @@
 
 #include "Core/PlayFabServerDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
+#include "Core/PlayFabJsonPullReader.h"
 
 using namespace PlayFab;
 using namespace PlayFab::ServerModels;
@@ -16,7 +17,8 @@ PlayFab::ServerModels::FAdCampaignAttribution::~FAdCampaignAttribution()
 
 }
 
-void PlayFab::ServerModels::FAdCampaignAttribution::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FAdCampaignAttribution::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -38,6 +40,16 @@ void PlayFab::ServerModels::FAdCampaignAttribution::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FAdCampaignAttribution::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FAdCampaignAttribution::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FAdCampaignAttribution::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -64,12 +76,47 @@ bool PlayFab::ServerModels::FAdCampaignAttribution::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FAdCampaignAttribution::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AttributedAt"))
+        {
+            reader.ReadValue(AttributedAt);
+        }
+        else if (reader.IsField("CampaignId"))
+        {
+            reader.ReadValue(CampaignId);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            reader.ReadValue(Platform);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAdCampaignAttribution();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FAdCampaignAttributionModel::~FAdCampaignAttributionModel()
 {
 
 }
 
-void PlayFab::ServerModels::FAdCampaignAttributionModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FAdCampaignAttributionModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -91,6 +138,16 @@ void PlayFab::ServerModels::FAdCampaignAttributionModel::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FAdCampaignAttributionModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FAdCampaignAttributionModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FAdCampaignAttributionModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -117,12 +174,47 @@ bool PlayFab::ServerModels::FAdCampaignAttributionModel::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FAdCampaignAttributionModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AttributedAt"))
+        {
+            reader.ReadValue(AttributedAt);
+        }
+        else if (reader.IsField("CampaignId"))
+        {
+            reader.ReadValue(CampaignId);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            reader.ReadValue(Platform);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAdCampaignAttributionModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FAddCharacterVirtualCurrencyRequest::~FAddCharacterVirtualCurrencyRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FAddCharacterVirtualCurrencyRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FAddCharacterVirtualCurrencyRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -173,6 +265,16 @@ void PlayFab::ServerModels::FAddCharacterVirtualCurrencyRequest::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FAddCharacterVirtualCurrencyRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FAddCharacterVirtualCurrencyRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FAddCharacterVirtualCurrencyRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -196,7 +298,7 @@ bool PlayFab::ServerModels::FAddCharacterVirtualCurrencyRequest::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -217,12 +319,62 @@ bool PlayFab::ServerModels::FAddCharacterVirtualCurrencyRequest::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FAddCharacterVirtualCurrencyRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Amount"))
+        {
+            reader.ReadValue(Amount);
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            reader.ReadValue(VirtualCurrency);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddCharacterVirtualCurrencyRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FAddFriendRequest::~FAddFriendRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FAddFriendRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FAddFriendRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -263,6 +415,16 @@ void PlayFab::ServerModels::FAddFriendRequest::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FAddFriendRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FAddFriendRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FAddFriendRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -305,12 +467,55 @@ bool PlayFab::ServerModels::FAddFriendRequest::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FAddFriendRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FriendEmail"))
+        {
+            reader.ReadValue(FriendEmail);
+        }
+        else if (reader.IsField("FriendPlayFabId"))
+        {
+            reader.ReadValue(FriendPlayFabId);
+        }
+        else if (reader.IsField("FriendTitleDisplayName"))
+        {
+            reader.ReadValue(FriendTitleDisplayName);
+        }
+        else if (reader.IsField("FriendUsername"))
+        {
+            reader.ReadValue(FriendUsername);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddFriendRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGenericServiceId::~FGenericServiceId()
 {
 
 }
 
-void PlayFab::ServerModels::FGenericServiceId::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGenericServiceId::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -337,6 +542,16 @@ void PlayFab::ServerModels::FGenericServiceId::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGenericServiceId::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGenericServiceId::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGenericServiceId::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -358,12 +573,43 @@ bool PlayFab::ServerModels::FGenericServiceId::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGenericServiceId::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ServiceName"))
+        {
+            reader.ReadValue(ServiceName);
+        }
+        else if (reader.IsField("UserId"))
+        {
+            reader.ReadValue(UserId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGenericServiceId();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FAddGenericIDRequest::~FAddGenericIDRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FAddGenericIDRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FAddGenericIDRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -383,6 +629,16 @@ void PlayFab::ServerModels::FAddGenericIDRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FAddGenericIDRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FAddGenericIDRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FAddGenericIDRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -403,12 +659,43 @@ bool PlayFab::ServerModels::FAddGenericIDRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FAddGenericIDRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GenericId"))
+        {
+            GenericId.readFromReader(reader);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddGenericIDRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FAddPlayerTagRequest::~FAddPlayerTagRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FAddPlayerTagRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FAddPlayerTagRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -446,6 +733,16 @@ void PlayFab::ServerModels::FAddPlayerTagRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FAddPlayerTagRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FAddPlayerTagRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FAddPlayerTagRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -455,7 +752,7 @@ bool PlayFab::ServerModels::FAddPlayerTagRequest::readFromValue(const TSharedPtr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -476,18 +773,70 @@ bool PlayFab::ServerModels::FAddPlayerTagRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FAddPlayerTagRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("TagName"))
+        {
+            reader.ReadValue(TagName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddPlayerTagRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FAddPlayerTagResult::~FAddPlayerTagResult()
 {
 
 }
 
-void PlayFab::ServerModels::FAddPlayerTagResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FAddPlayerTagResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FAddPlayerTagResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FAddPlayerTagResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FAddPlayerTagResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -495,12 +844,34 @@ bool PlayFab::ServerModels::FAddPlayerTagResult::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FAddPlayerTagResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddPlayerTagResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FAddSharedGroupMembersRequest::~FAddSharedGroupMembersRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FAddSharedGroupMembersRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FAddSharedGroupMembersRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -523,6 +894,16 @@ void PlayFab::ServerModels::FAddSharedGroupMembersRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FAddSharedGroupMembersRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FAddSharedGroupMembersRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FAddSharedGroupMembersRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -539,18 +920,66 @@ bool PlayFab::ServerModels::FAddSharedGroupMembersRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FAddSharedGroupMembersRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { PlayFabIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("SharedGroupId"))
+        {
+            reader.ReadValue(SharedGroupId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddSharedGroupMembersRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FAddSharedGroupMembersResult::~FAddSharedGroupMembersResult()
 {
 
 }
 
-void PlayFab::ServerModels::FAddSharedGroupMembersResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FAddSharedGroupMembersResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FAddSharedGroupMembersResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FAddSharedGroupMembersResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FAddSharedGroupMembersResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -558,12 +987,34 @@ bool PlayFab::ServerModels::FAddSharedGroupMembersResult::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FAddSharedGroupMembersResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddSharedGroupMembersResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FAddUserVirtualCurrencyRequest::~FAddUserVirtualCurrencyRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FAddUserVirtualCurrencyRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FAddUserVirtualCurrencyRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -604,6 +1055,16 @@ void PlayFab::ServerModels::FAddUserVirtualCurrencyRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FAddUserVirtualCurrencyRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FAddUserVirtualCurrencyRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FAddUserVirtualCurrencyRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -620,7 +1081,7 @@ bool PlayFab::ServerModels::FAddUserVirtualCurrencyRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -641,19 +1102,75 @@ bool PlayFab::ServerModels::FAddUserVirtualCurrencyRequest::readFromValue(const
     return HasSucceeded;
 }
 
-void PlayFab::ServerModels::writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonWriter& writer)
+bool PlayFab::ServerModels::FAddUserVirtualCurrencyRequest::readFromReader(FPlayFabJsonPullReader& reader)
 {
-    switch (enumVal)
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
     {
+        if (reader.ReadNull())
+            continue;
 
-    case PushNotificationPlatformApplePushNotificationService: writer->WriteValue(TEXT("ApplePushNotificationService")); break;
-    case PushNotificationPlatformGoogleCloudMessaging: writer->WriteValue(TEXT("GoogleCloudMessaging")); break;
+        if (reader.IsField("Amount"))
+        {
+            reader.ReadValue(Amount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            reader.ReadValue(VirtualCurrency);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddUserVirtualCurrencyRequest();
+        return false;
     }
+    return true;
 }
 
-ServerModels::PushNotificationPlatform PlayFab::ServerModels::readPushNotificationPlatformFromValue(const TSharedPtr<FJsonValue>& value)
+template <typename WriterType>
+static void writePushNotificationPlatformEnumValue(ServerModels::PushNotificationPlatform enumVal, WriterType& writer)
 {
-    return readPushNotificationPlatformFromValue(value.IsValid() ? value->AsString() : "");
+    switch (enumVal)
+    {
+
+    case PushNotificationPlatformApplePushNotificationService: writer->WriteValue(TEXT("ApplePushNotificationService")); break;
+    case PushNotificationPlatformGoogleCloudMessaging: writer->WriteValue(TEXT("GoogleCloudMessaging")); break;
+    }
+}
+
+void PlayFab::ServerModels::writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonWriter& writer)
+{
+    writePushNotificationPlatformEnumValue(enumVal, writer);
+}
+
+void PlayFab::ServerModels::writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonUtf8Writer& writer)
+{
+    writePushNotificationPlatformEnumValue(enumVal, writer);
+}
+
+ServerModels::PushNotificationPlatform PlayFab::ServerModels::readPushNotificationPlatformFromValue(const TSharedPtr<FJsonValue>& value)
+{
+    return readPushNotificationPlatformFromValue(value.IsValid() ? value->AsString() : "");
 }
 
 ServerModels::PushNotificationPlatform PlayFab::ServerModels::readPushNotificationPlatformFromValue(const FString& value)
@@ -682,7 +1199,8 @@ PlayFab::ServerModels::FAdvancedPushPlatformMsg::~FAdvancedPushPlatformMsg()
 
 }
 
-void PlayFab::ServerModels::FAdvancedPushPlatformMsg::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FAdvancedPushPlatformMsg::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -708,6 +1226,16 @@ void PlayFab::ServerModels::FAdvancedPushPlatformMsg::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FAdvancedPushPlatformMsg::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FAdvancedPushPlatformMsg::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FAdvancedPushPlatformMsg::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -731,12 +1259,48 @@ bool PlayFab::ServerModels::FAdvancedPushPlatformMsg::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FAdvancedPushPlatformMsg::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GCMDataOnly"))
+        {
+            reader.ReadValue(GCMDataOnly);
+        }
+        else if (reader.IsField("Json"))
+        {
+            reader.ReadValue(Json);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Platform = readPushNotificationPlatformFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAdvancedPushPlatformMsg();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FAuthenticateSessionTicketRequest::~FAuthenticateSessionTicketRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FAuthenticateSessionTicketRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FAuthenticateSessionTicketRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -753,6 +1317,16 @@ void PlayFab::ServerModels::FAuthenticateSessionTicketRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FAuthenticateSessionTicketRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FAuthenticateSessionTicketRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FAuthenticateSessionTicketRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -767,12 +1341,39 @@ bool PlayFab::ServerModels::FAuthenticateSessionTicketRequest::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FAuthenticateSessionTicketRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SessionTicket"))
+        {
+            reader.ReadValue(SessionTicket);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAuthenticateSessionTicketRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserAndroidDeviceInfo::~FUserAndroidDeviceInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FUserAndroidDeviceInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserAndroidDeviceInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -785,6 +1386,16 @@ void PlayFab::ServerModels::FUserAndroidDeviceInfo::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserAndroidDeviceInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserAndroidDeviceInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserAndroidDeviceInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -799,12 +1410,39 @@ bool PlayFab::ServerModels::FUserAndroidDeviceInfo::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserAndroidDeviceInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AndroidDeviceId"))
+        {
+            reader.ReadValue(AndroidDeviceId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserAndroidDeviceInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserAppleIdInfo::~FUserAppleIdInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FUserAppleIdInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserAppleIdInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -817,6 +1455,16 @@ void PlayFab::ServerModels::FUserAppleIdInfo::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserAppleIdInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserAppleIdInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserAppleIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -831,12 +1479,39 @@ bool PlayFab::ServerModels::FUserAppleIdInfo::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserAppleIdInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AppleSubjectId"))
+        {
+            reader.ReadValue(AppleSubjectId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserAppleIdInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserCustomIdInfo::~FUserCustomIdInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FUserCustomIdInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserCustomIdInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -849,6 +1524,16 @@ void PlayFab::ServerModels::FUserCustomIdInfo::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserCustomIdInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserCustomIdInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserCustomIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -863,12 +1548,39 @@ bool PlayFab::ServerModels::FUserCustomIdInfo::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserCustomIdInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomId"))
+        {
+            reader.ReadValue(CustomId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserCustomIdInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserFacebookInfo::~FUserFacebookInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FUserFacebookInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserFacebookInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -887,6 +1599,16 @@ void PlayFab::ServerModels::FUserFacebookInfo::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserFacebookInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserFacebookInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserFacebookInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -908,12 +1630,43 @@ bool PlayFab::ServerModels::FUserFacebookInfo::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserFacebookInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FacebookId"))
+        {
+            reader.ReadValue(FacebookId);
+        }
+        else if (reader.IsField("FullName"))
+        {
+            reader.ReadValue(FullName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserFacebookInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserFacebookInstantGamesIdInfo::~FUserFacebookInstantGamesIdInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FUserFacebookInstantGamesIdInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserFacebookInstantGamesIdInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -926,6 +1679,16 @@ void PlayFab::ServerModels::FUserFacebookInstantGamesIdInfo::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserFacebookInstantGamesIdInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserFacebookInstantGamesIdInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserFacebookInstantGamesIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -940,12 +1703,39 @@ bool PlayFab::ServerModels::FUserFacebookInstantGamesIdInfo::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserFacebookInstantGamesIdInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FacebookInstantGamesId"))
+        {
+            reader.ReadValue(FacebookInstantGamesId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserFacebookInstantGamesIdInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserGameCenterInfo::~FUserGameCenterInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FUserGameCenterInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserGameCenterInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -958,6 +1748,16 @@ void PlayFab::ServerModels::FUserGameCenterInfo::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserGameCenterInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserGameCenterInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserGameCenterInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -972,12 +1772,39 @@ bool PlayFab::ServerModels::FUserGameCenterInfo::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserGameCenterInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GameCenterId"))
+        {
+            reader.ReadValue(GameCenterId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserGameCenterInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserGoogleInfo::~FUserGoogleInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FUserGoogleInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserGoogleInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1014,6 +1841,16 @@ void PlayFab::ServerModels::FUserGoogleInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserGoogleInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserGoogleInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserGoogleInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1056,12 +1893,55 @@ bool PlayFab::ServerModels::FUserGoogleInfo::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserGoogleInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GoogleEmail"))
+        {
+            reader.ReadValue(GoogleEmail);
+        }
+        else if (reader.IsField("GoogleGender"))
+        {
+            reader.ReadValue(GoogleGender);
+        }
+        else if (reader.IsField("GoogleId"))
+        {
+            reader.ReadValue(GoogleId);
+        }
+        else if (reader.IsField("GoogleLocale"))
+        {
+            reader.ReadValue(GoogleLocale);
+        }
+        else if (reader.IsField("GoogleName"))
+        {
+            reader.ReadValue(GoogleName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserGoogleInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserIosDeviceInfo::~FUserIosDeviceInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FUserIosDeviceInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserIosDeviceInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1074,6 +1954,16 @@ void PlayFab::ServerModels::FUserIosDeviceInfo::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserIosDeviceInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserIosDeviceInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserIosDeviceInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1088,12 +1978,39 @@ bool PlayFab::ServerModels::FUserIosDeviceInfo::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserIosDeviceInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("IosDeviceId"))
+        {
+            reader.ReadValue(IosDeviceId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserIosDeviceInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserKongregateInfo::~FUserKongregateInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FUserKongregateInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserKongregateInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1112,6 +2029,16 @@ void PlayFab::ServerModels::FUserKongregateInfo::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserKongregateInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserKongregateInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserKongregateInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1133,12 +2060,43 @@ bool PlayFab::ServerModels::FUserKongregateInfo::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserKongregateInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("KongregateId"))
+        {
+            reader.ReadValue(KongregateId);
+        }
+        else if (reader.IsField("KongregateName"))
+        {
+            reader.ReadValue(KongregateName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserKongregateInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserNintendoSwitchAccountIdInfo::~FUserNintendoSwitchAccountIdInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FUserNintendoSwitchAccountIdInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserNintendoSwitchAccountIdInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1151,7 +2109,17 @@ void PlayFab::ServerModels::FUserNintendoSwitchAccountIdInfo::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
-bool PlayFab::ServerModels::FUserNintendoSwitchAccountIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
+void PlayFab::ServerModels::FUserNintendoSwitchAccountIdInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserNintendoSwitchAccountIdInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
+bool PlayFab::ServerModels::FUserNintendoSwitchAccountIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
 
@@ -1165,12 +2133,39 @@ bool PlayFab::ServerModels::FUserNintendoSwitchAccountIdInfo::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserNintendoSwitchAccountIdInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("NintendoSwitchAccountSubjectId"))
+        {
+            reader.ReadValue(NintendoSwitchAccountSubjectId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserNintendoSwitchAccountIdInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserNintendoSwitchDeviceIdInfo::~FUserNintendoSwitchDeviceIdInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FUserNintendoSwitchDeviceIdInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserNintendoSwitchDeviceIdInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1183,6 +2178,16 @@ void PlayFab::ServerModels::FUserNintendoSwitchDeviceIdInfo::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserNintendoSwitchDeviceIdInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserNintendoSwitchDeviceIdInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserNintendoSwitchDeviceIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1197,12 +2202,39 @@ bool PlayFab::ServerModels::FUserNintendoSwitchDeviceIdInfo::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserNintendoSwitchDeviceIdInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("NintendoSwitchDeviceId"))
+        {
+            reader.ReadValue(NintendoSwitchDeviceId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserNintendoSwitchDeviceIdInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserOpenIdInfo::~FUserOpenIdInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FUserOpenIdInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserOpenIdInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1227,6 +2259,16 @@ void PlayFab::ServerModels::FUserOpenIdInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserOpenIdInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserOpenIdInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserOpenIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1255,12 +2297,47 @@ bool PlayFab::ServerModels::FUserOpenIdInfo::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserOpenIdInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ConnectionId"))
+        {
+            reader.ReadValue(ConnectionId);
+        }
+        else if (reader.IsField("Issuer"))
+        {
+            reader.ReadValue(Issuer);
+        }
+        else if (reader.IsField("Subject"))
+        {
+            reader.ReadValue(Subject);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserOpenIdInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserPrivateAccountInfo::~FUserPrivateAccountInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FUserPrivateAccountInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserPrivateAccountInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1273,6 +2350,16 @@ void PlayFab::ServerModels::FUserPrivateAccountInfo::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserPrivateAccountInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserPrivateAccountInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserPrivateAccountInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1287,12 +2374,39 @@ bool PlayFab::ServerModels::FUserPrivateAccountInfo::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserPrivateAccountInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Email"))
+        {
+            reader.ReadValue(Email);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserPrivateAccountInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserPsnInfo::~FUserPsnInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FUserPsnInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserPsnInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1311,6 +2425,16 @@ void PlayFab::ServerModels::FUserPsnInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserPsnInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserPsnInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserPsnInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1332,7 +2456,38 @@ bool PlayFab::ServerModels::FUserPsnInfo::readFromValue(const TSharedPtr<FJsonOb
     return HasSucceeded;
 }
 
-void PlayFab::ServerModels::writeTitleActivationStatusEnumJSON(TitleActivationStatus enumVal, JsonWriter& writer)
+bool PlayFab::ServerModels::FUserPsnInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PsnAccountId"))
+        {
+            reader.ReadValue(PsnAccountId);
+        }
+        else if (reader.IsField("PsnOnlineId"))
+        {
+            reader.ReadValue(PsnOnlineId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserPsnInfo();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeTitleActivationStatusEnumValue(ServerModels::TitleActivationStatus enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -1345,6 +2500,16 @@ void PlayFab::ServerModels::writeTitleActivationStatusEnumJSON(TitleActivationSt
     }
 }
 
+void PlayFab::ServerModels::writeTitleActivationStatusEnumJSON(TitleActivationStatus enumVal, JsonWriter& writer)
+{
+    writeTitleActivationStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::ServerModels::writeTitleActivationStatusEnumJSON(TitleActivationStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeTitleActivationStatusEnumValue(enumVal, writer);
+}
+
 ServerModels::TitleActivationStatus PlayFab::ServerModels::readTitleActivationStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readTitleActivationStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -1374,7 +2539,8 @@ ServerModels::TitleActivationStatus PlayFab::ServerModels::readTitleActivationSt
     return TitleActivationStatusNone; // Basically critical fail
 }
 
-void PlayFab::ServerModels::writeCurrencyEnumJSON(Currency enumVal, JsonWriter& writer)
+template <typename WriterType>
+static void writeCurrencyEnumValue(ServerModels::Currency enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -1544,6 +2710,16 @@ void PlayFab::ServerModels::writeCurrencyEnumJSON(Currency enumVal, JsonWriter&
     }
 }
 
+void PlayFab::ServerModels::writeCurrencyEnumJSON(Currency enumVal, JsonWriter& writer)
+{
+    writeCurrencyEnumValue(enumVal, writer);
+}
+
+void PlayFab::ServerModels::writeCurrencyEnumJSON(Currency enumVal, JsonUtf8Writer& writer)
+{
+    writeCurrencyEnumValue(enumVal, writer);
+}
+
 ServerModels::Currency PlayFab::ServerModels::readCurrencyFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readCurrencyFromValue(value.IsValid() ? value->AsString() : "");
@@ -1735,7 +2911,8 @@ PlayFab::ServerModels::FUserSteamInfo::~FUserSteamInfo()
 
 }
 
-void PlayFab::ServerModels::FUserSteamInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserSteamInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1772,6 +2949,16 @@ void PlayFab::ServerModels::FUserSteamInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserSteamInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserSteamInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserSteamInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1804,7 +2991,52 @@ bool PlayFab::ServerModels::FUserSteamInfo::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
-void PlayFab::ServerModels::writeUserOriginationEnumJSON(UserOrigination enumVal, JsonWriter& writer)
+bool PlayFab::ServerModels::FUserSteamInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SteamActivationStatus"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { SteamActivationStatus = readTitleActivationStatusFromValue(TmpValue); }
+        }
+        else if (reader.IsField("SteamCountry"))
+        {
+            reader.ReadValue(SteamCountry);
+        }
+        else if (reader.IsField("SteamCurrency"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { SteamCurrency = readCurrencyFromValue(TmpValue); }
+        }
+        else if (reader.IsField("SteamId"))
+        {
+            reader.ReadValue(SteamId);
+        }
+        else if (reader.IsField("SteamName"))
+        {
+            reader.ReadValue(SteamName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserSteamInfo();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeUserOriginationEnumValue(ServerModels::UserOrigination enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -1836,6 +3068,16 @@ void PlayFab::ServerModels::writeUserOriginationEnumJSON(UserOrigination enumVal
     }
 }
 
+void PlayFab::ServerModels::writeUserOriginationEnumJSON(UserOrigination enumVal, JsonWriter& writer)
+{
+    writeUserOriginationEnumValue(enumVal, writer);
+}
+
+void PlayFab::ServerModels::writeUserOriginationEnumJSON(UserOrigination enumVal, JsonUtf8Writer& writer)
+{
+    writeUserOriginationEnumValue(enumVal, writer);
+}
+
 ServerModels::UserOrigination PlayFab::ServerModels::readUserOriginationFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readUserOriginationFromValue(value.IsValid() ? value->AsString() : "");
@@ -1889,7 +3131,8 @@ PlayFab::ServerModels::FEntityKey::~FEntityKey()
 
 }
 
-void PlayFab::ServerModels::FEntityKey::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FEntityKey::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1912,6 +3155,16 @@ void PlayFab::ServerModels::FEntityKey::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FEntityKey::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FEntityKey::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FEntityKey::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1933,13 +3186,44 @@ bool PlayFab::ServerModels::FEntityKey::readFromValue(const TSharedPtr<FJsonObje
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FEntityKey::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Type"))
+        {
+            reader.ReadValue(Type);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityKey();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserTitleInfo::~FUserTitleInfo()
 {
     //if (TitlePlayerAccount != nullptr) delete TitlePlayerAccount;
 
 }
 
-void PlayFab::ServerModels::FUserTitleInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserTitleInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1991,6 +3275,16 @@ void PlayFab::ServerModels::FUserTitleInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserTitleInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserTitleInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserTitleInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2036,18 +3330,75 @@ bool PlayFab::ServerModels::FUserTitleInfo::readFromValue(const TSharedPtr<FJson
     const TSharedPtr<FJsonValue> TitlePlayerAccountValue = obj->TryGetField(TEXT("TitlePlayerAccount"));
     if (TitlePlayerAccountValue.IsValid() && !TitlePlayerAccountValue->IsNull())
     {
-        TitlePlayerAccount = MakeShareable(new FEntityKey(TitlePlayerAccountValue->AsObject()));
+        TitlePlayerAccount = MakeShared<FEntityKey>(TitlePlayerAccountValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserTitleInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AvatarUrl"))
+        {
+            reader.ReadValue(AvatarUrl);
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("FirstLogin"))
+        {
+            reader.ReadValue(FirstLogin);
+        }
+        else if (reader.IsField("isBanned"))
+        {
+            reader.ReadValue(isBanned);
+        }
+        else if (reader.IsField("LastLogin"))
+        {
+            reader.ReadValue(LastLogin);
+        }
+        else if (reader.IsField("Origination"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Origination = readUserOriginationFromValue(TmpValue); }
+        }
+        else if (reader.IsField("TitlePlayerAccount"))
+        {
+            TitlePlayerAccount = MakeShared<FEntityKey>();
+            TitlePlayerAccount->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserTitleInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserTwitchInfo::~FUserTwitchInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FUserTwitchInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserTwitchInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2066,6 +3417,16 @@ void PlayFab::ServerModels::FUserTwitchInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserTwitchInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserTwitchInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserTwitchInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2087,12 +3448,43 @@ bool PlayFab::ServerModels::FUserTwitchInfo::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserTwitchInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TwitchId"))
+        {
+            reader.ReadValue(TwitchId);
+        }
+        else if (reader.IsField("TwitchUserName"))
+        {
+            reader.ReadValue(TwitchUserName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserTwitchInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserWindowsHelloInfo::~FUserWindowsHelloInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FUserWindowsHelloInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserWindowsHelloInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2111,6 +3503,16 @@ void PlayFab::ServerModels::FUserWindowsHelloInfo::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserWindowsHelloInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserWindowsHelloInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserWindowsHelloInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2132,16 +3534,47 @@ bool PlayFab::ServerModels::FUserWindowsHelloInfo::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
-PlayFab::ServerModels::FUserXboxInfo::~FUserXboxInfo()
+bool PlayFab::ServerModels::FUserWindowsHelloInfo::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::ServerModels::FUserXboxInfo::writeJSON(JsonWriter& writer) const
-{
-    writer->WriteObjectStart();
+        if (reader.IsField("WindowsHelloDeviceName"))
+        {
+            reader.ReadValue(WindowsHelloDeviceName);
+        }
+        else if (reader.IsField("WindowsHelloPublicKeyHash"))
+        {
+            reader.ReadValue(WindowsHelloPublicKeyHash);
+        }
+        else
+            reader.SkipValue();
+    }
 
-    if (XboxUserId.IsEmpty() == false)
+    if (!reader.IsValid())
+    {
+        *this = FUserWindowsHelloInfo();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ServerModels::FUserXboxInfo::~FUserXboxInfo()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ServerModels::FUserXboxInfo::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
+
+    if (XboxUserId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("XboxUserId"));
         writer->WriteValue(XboxUserId);
@@ -2150,6 +3583,16 @@ void PlayFab::ServerModels::FUserXboxInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserXboxInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserXboxInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserXboxInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2164,6 +3607,32 @@ bool PlayFab::ServerModels::FUserXboxInfo::readFromValue(const TSharedPtr<FJsonO
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserXboxInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("XboxUserId"))
+        {
+            reader.ReadValue(XboxUserId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserXboxInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserAccountInfo::~FUserAccountInfo()
 {
     //if (AndroidDeviceInfo != nullptr) delete AndroidDeviceInfo;
@@ -2187,7 +3656,8 @@ PlayFab::ServerModels::FUserAccountInfo::~FUserAccountInfo()
 
 }
 
-void PlayFab::ServerModels::FUserAccountInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserAccountInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2326,6 +3796,16 @@ void PlayFab::ServerModels::FUserAccountInfo::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserAccountInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserAccountInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserAccountInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2333,13 +3813,13 @@ bool PlayFab::ServerModels::FUserAccountInfo::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonValue> AndroidDeviceInfoValue = obj->TryGetField(TEXT("AndroidDeviceInfo"));
     if (AndroidDeviceInfoValue.IsValid() && !AndroidDeviceInfoValue->IsNull())
     {
-        AndroidDeviceInfo = MakeShareable(new FUserAndroidDeviceInfo(AndroidDeviceInfoValue->AsObject()));
+        AndroidDeviceInfo = MakeShared<FUserAndroidDeviceInfo>(AndroidDeviceInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> AppleAccountInfoValue = obj->TryGetField(TEXT("AppleAccountInfo"));
     if (AppleAccountInfoValue.IsValid() && !AppleAccountInfoValue->IsNull())
     {
-        AppleAccountInfo = MakeShareable(new FUserAppleIdInfo(AppleAccountInfoValue->AsObject()));
+        AppleAccountInfo = MakeShared<FUserAppleIdInfo>(AppleAccountInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> CreatedValue = obj->TryGetField(TEXT("Created"));
@@ -2350,62 +3830,62 @@ bool PlayFab::ServerModels::FUserAccountInfo::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonValue> CustomIdInfoValue = obj->TryGetField(TEXT("CustomIdInfo"));
     if (CustomIdInfoValue.IsValid() && !CustomIdInfoValue->IsNull())
     {
-        CustomIdInfo = MakeShareable(new FUserCustomIdInfo(CustomIdInfoValue->AsObject()));
+        CustomIdInfo = MakeShared<FUserCustomIdInfo>(CustomIdInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> FacebookInfoValue = obj->TryGetField(TEXT("FacebookInfo"));
     if (FacebookInfoValue.IsValid() && !FacebookInfoValue->IsNull())
     {
-        FacebookInfo = MakeShareable(new FUserFacebookInfo(FacebookInfoValue->AsObject()));
+        FacebookInfo = MakeShared<FUserFacebookInfo>(FacebookInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> FacebookInstantGamesIdInfoValue = obj->TryGetField(TEXT("FacebookInstantGamesIdInfo"));
     if (FacebookInstantGamesIdInfoValue.IsValid() && !FacebookInstantGamesIdInfoValue->IsNull())
     {
-        FacebookInstantGamesIdInfo = MakeShareable(new FUserFacebookInstantGamesIdInfo(FacebookInstantGamesIdInfoValue->AsObject()));
+        FacebookInstantGamesIdInfo = MakeShared<FUserFacebookInstantGamesIdInfo>(FacebookInstantGamesIdInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> GameCenterInfoValue = obj->TryGetField(TEXT("GameCenterInfo"));
     if (GameCenterInfoValue.IsValid() && !GameCenterInfoValue->IsNull())
     {
-        GameCenterInfo = MakeShareable(new FUserGameCenterInfo(GameCenterInfoValue->AsObject()));
+        GameCenterInfo = MakeShared<FUserGameCenterInfo>(GameCenterInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> GoogleInfoValue = obj->TryGetField(TEXT("GoogleInfo"));
     if (GoogleInfoValue.IsValid() && !GoogleInfoValue->IsNull())
     {
-        GoogleInfo = MakeShareable(new FUserGoogleInfo(GoogleInfoValue->AsObject()));
+        GoogleInfo = MakeShared<FUserGoogleInfo>(GoogleInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> IosDeviceInfoValue = obj->TryGetField(TEXT("IosDeviceInfo"));
     if (IosDeviceInfoValue.IsValid() && !IosDeviceInfoValue->IsNull())
     {
-        IosDeviceInfo = MakeShareable(new FUserIosDeviceInfo(IosDeviceInfoValue->AsObject()));
+        IosDeviceInfo = MakeShared<FUserIosDeviceInfo>(IosDeviceInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> KongregateInfoValue = obj->TryGetField(TEXT("KongregateInfo"));
     if (KongregateInfoValue.IsValid() && !KongregateInfoValue->IsNull())
     {
-        KongregateInfo = MakeShareable(new FUserKongregateInfo(KongregateInfoValue->AsObject()));
+        KongregateInfo = MakeShared<FUserKongregateInfo>(KongregateInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> NintendoSwitchAccountInfoValue = obj->TryGetField(TEXT("NintendoSwitchAccountInfo"));
     if (NintendoSwitchAccountInfoValue.IsValid() && !NintendoSwitchAccountInfoValue->IsNull())
     {
-        NintendoSwitchAccountInfo = MakeShareable(new FUserNintendoSwitchAccountIdInfo(NintendoSwitchAccountInfoValue->AsObject()));
+        NintendoSwitchAccountInfo = MakeShared<FUserNintendoSwitchAccountIdInfo>(NintendoSwitchAccountInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> NintendoSwitchDeviceIdInfoValue = obj->TryGetField(TEXT("NintendoSwitchDeviceIdInfo"));
     if (NintendoSwitchDeviceIdInfoValue.IsValid() && !NintendoSwitchDeviceIdInfoValue->IsNull())
     {
-        NintendoSwitchDeviceIdInfo = MakeShareable(new FUserNintendoSwitchDeviceIdInfo(NintendoSwitchDeviceIdInfoValue->AsObject()));
+        NintendoSwitchDeviceIdInfo = MakeShared<FUserNintendoSwitchDeviceIdInfo>(NintendoSwitchDeviceIdInfoValue->AsObject());
     }
 
     const TArray<TSharedPtr<FJsonValue>>&OpenIdInfoArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("OpenIdInfo"));
     for (int32 Idx = 0; Idx < OpenIdInfoArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = OpenIdInfoArray[Idx];
-        OpenIdInfo.Add(FUserOpenIdInfo(CurrentItem->AsObject()));
+        OpenIdInfo.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2419,31 +3899,31 @@ bool PlayFab::ServerModels::FUserAccountInfo::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonValue> PrivateInfoValue = obj->TryGetField(TEXT("PrivateInfo"));
     if (PrivateInfoValue.IsValid() && !PrivateInfoValue->IsNull())
     {
-        PrivateInfo = MakeShareable(new FUserPrivateAccountInfo(PrivateInfoValue->AsObject()));
+        PrivateInfo = MakeShared<FUserPrivateAccountInfo>(PrivateInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PsnInfoValue = obj->TryGetField(TEXT("PsnInfo"));
     if (PsnInfoValue.IsValid() && !PsnInfoValue->IsNull())
     {
-        PsnInfo = MakeShareable(new FUserPsnInfo(PsnInfoValue->AsObject()));
+        PsnInfo = MakeShared<FUserPsnInfo>(PsnInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> SteamInfoValue = obj->TryGetField(TEXT("SteamInfo"));
     if (SteamInfoValue.IsValid() && !SteamInfoValue->IsNull())
     {
-        SteamInfo = MakeShareable(new FUserSteamInfo(SteamInfoValue->AsObject()));
+        SteamInfo = MakeShared<FUserSteamInfo>(SteamInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> TitleInfoValue = obj->TryGetField(TEXT("TitleInfo"));
     if (TitleInfoValue.IsValid() && !TitleInfoValue->IsNull())
     {
-        TitleInfo = MakeShareable(new FUserTitleInfo(TitleInfoValue->AsObject()));
+        TitleInfo = MakeShared<FUserTitleInfo>(TitleInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> TwitchInfoValue = obj->TryGetField(TEXT("TwitchInfo"));
     if (TwitchInfoValue.IsValid() && !TwitchInfoValue->IsNull())
     {
-        TwitchInfo = MakeShareable(new FUserTwitchInfo(TwitchInfoValue->AsObject()));
+        TwitchInfo = MakeShared<FUserTwitchInfo>(TwitchInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> UsernameValue = obj->TryGetField(TEXT("Username"));
@@ -2456,25 +3936,161 @@ bool PlayFab::ServerModels::FUserAccountInfo::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonValue> WindowsHelloInfoValue = obj->TryGetField(TEXT("WindowsHelloInfo"));
     if (WindowsHelloInfoValue.IsValid() && !WindowsHelloInfoValue->IsNull())
     {
-        WindowsHelloInfo = MakeShareable(new FUserWindowsHelloInfo(WindowsHelloInfoValue->AsObject()));
+        WindowsHelloInfo = MakeShared<FUserWindowsHelloInfo>(WindowsHelloInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> XboxInfoValue = obj->TryGetField(TEXT("XboxInfo"));
     if (XboxInfoValue.IsValid() && !XboxInfoValue->IsNull())
     {
-        XboxInfo = MakeShareable(new FUserXboxInfo(XboxInfoValue->AsObject()));
+        XboxInfo = MakeShared<FUserXboxInfo>(XboxInfoValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserAccountInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AndroidDeviceInfo"))
+        {
+            AndroidDeviceInfo = MakeShared<FUserAndroidDeviceInfo>();
+            AndroidDeviceInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("AppleAccountInfo"))
+        {
+            AppleAccountInfo = MakeShared<FUserAppleIdInfo>();
+            AppleAccountInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("CustomIdInfo"))
+        {
+            CustomIdInfo = MakeShared<FUserCustomIdInfo>();
+            CustomIdInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("FacebookInfo"))
+        {
+            FacebookInfo = MakeShared<FUserFacebookInfo>();
+            FacebookInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("FacebookInstantGamesIdInfo"))
+        {
+            FacebookInstantGamesIdInfo = MakeShared<FUserFacebookInstantGamesIdInfo>();
+            FacebookInstantGamesIdInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("GameCenterInfo"))
+        {
+            GameCenterInfo = MakeShared<FUserGameCenterInfo>();
+            GameCenterInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("GoogleInfo"))
+        {
+            GoogleInfo = MakeShared<FUserGoogleInfo>();
+            GoogleInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("IosDeviceInfo"))
+        {
+            IosDeviceInfo = MakeShared<FUserIosDeviceInfo>();
+            IosDeviceInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("KongregateInfo"))
+        {
+            KongregateInfo = MakeShared<FUserKongregateInfo>();
+            KongregateInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("NintendoSwitchAccountInfo"))
+        {
+            NintendoSwitchAccountInfo = MakeShared<FUserNintendoSwitchAccountIdInfo>();
+            NintendoSwitchAccountInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("NintendoSwitchDeviceIdInfo"))
+        {
+            NintendoSwitchDeviceIdInfo = MakeShared<FUserNintendoSwitchDeviceIdInfo>();
+            NintendoSwitchDeviceIdInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("OpenIdInfo"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { OpenIdInfo[OpenIdInfo.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("PrivateInfo"))
+        {
+            PrivateInfo = MakeShared<FUserPrivateAccountInfo>();
+            PrivateInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("PsnInfo"))
+        {
+            PsnInfo = MakeShared<FUserPsnInfo>();
+            PsnInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("SteamInfo"))
+        {
+            SteamInfo = MakeShared<FUserSteamInfo>();
+            SteamInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("TitleInfo"))
+        {
+            TitleInfo = MakeShared<FUserTitleInfo>();
+            TitleInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("TwitchInfo"))
+        {
+            TwitchInfo = MakeShared<FUserTwitchInfo>();
+            TwitchInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else if (reader.IsField("WindowsHelloInfo"))
+        {
+            WindowsHelloInfo = MakeShared<FUserWindowsHelloInfo>();
+            WindowsHelloInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("XboxInfo"))
+        {
+            XboxInfo = MakeShared<FUserXboxInfo>();
+            XboxInfo->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserAccountInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FAuthenticateSessionTicketResult::~FAuthenticateSessionTicketResult()
 {
     //if (UserInfo != nullptr) delete UserInfo;
 
 }
 
-void PlayFab::ServerModels::FAuthenticateSessionTicketResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FAuthenticateSessionTicketResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2493,6 +4109,16 @@ void PlayFab::ServerModels::FAuthenticateSessionTicketResult::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FAuthenticateSessionTicketResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FAuthenticateSessionTicketResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FAuthenticateSessionTicketResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2507,18 +4133,50 @@ bool PlayFab::ServerModels::FAuthenticateSessionTicketResult::readFromValue(cons
     const TSharedPtr<FJsonValue> UserInfoValue = obj->TryGetField(TEXT("UserInfo"));
     if (UserInfoValue.IsValid() && !UserInfoValue->IsNull())
     {
-        UserInfo = MakeShareable(new FUserAccountInfo(UserInfoValue->AsObject()));
+        UserInfo = MakeShared<FUserAccountInfo>(UserInfoValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FAuthenticateSessionTicketResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("IsSessionTicketExpired"))
+        {
+            reader.ReadValue(IsSessionTicketExpired);
+        }
+        else if (reader.IsField("UserInfo"))
+        {
+            UserInfo = MakeShared<FUserAccountInfo>();
+            UserInfo->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAuthenticateSessionTicketResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FAwardSteamAchievementItem::~FAwardSteamAchievementItem()
 {
 
 }
 
-void PlayFab::ServerModels::FAwardSteamAchievementItem::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FAwardSteamAchievementItem::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2548,6 +4206,16 @@ void PlayFab::ServerModels::FAwardSteamAchievementItem::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FAwardSteamAchievementItem::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FAwardSteamAchievementItem::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FAwardSteamAchievementItem::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2576,12 +4244,47 @@ bool PlayFab::ServerModels::FAwardSteamAchievementItem::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FAwardSteamAchievementItem::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AchievementName"))
+        {
+            reader.ReadValue(AchievementName);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Result"))
+        {
+            reader.ReadValue(Result);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAwardSteamAchievementItem();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FAwardSteamAchievementRequest::~FAwardSteamAchievementRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FAwardSteamAchievementRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FAwardSteamAchievementRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2594,6 +4297,16 @@ void PlayFab::ServerModels::FAwardSteamAchievementRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FAwardSteamAchievementRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FAwardSteamAchievementRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FAwardSteamAchievementRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2602,19 +4315,53 @@ bool PlayFab::ServerModels::FAwardSteamAchievementRequest::readFromValue(const T
     for (int32 Idx = 0; Idx < AchievementsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = AchievementsArray[Idx];
-        Achievements.Add(FAwardSteamAchievementItem(CurrentItem->AsObject()));
+        Achievements.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FAwardSteamAchievementRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Achievements"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Achievements[Achievements.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAwardSteamAchievementRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FAwardSteamAchievementResult::~FAwardSteamAchievementResult()
 {
 
 }
 
-void PlayFab::ServerModels::FAwardSteamAchievementResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FAwardSteamAchievementResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2630,6 +4377,16 @@ void PlayFab::ServerModels::FAwardSteamAchievementResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FAwardSteamAchievementResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FAwardSteamAchievementResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FAwardSteamAchievementResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2638,19 +4395,53 @@ bool PlayFab::ServerModels::FAwardSteamAchievementResult::readFromValue(const TS
     for (int32 Idx = 0; Idx < AchievementResultsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = AchievementResultsArray[Idx];
-        AchievementResults.Add(FAwardSteamAchievementItem(CurrentItem->AsObject()));
+        AchievementResults.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FAwardSteamAchievementResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AchievementResults"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { AchievementResults[AchievementResults.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAwardSteamAchievementResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FBanInfo::~FBanInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FBanInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FBanInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2702,6 +4493,16 @@ void PlayFab::ServerModels::FBanInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FBanInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FBanInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FBanInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2761,12 +4562,67 @@ bool PlayFab::ServerModels::FBanInfo::readFromValue(const TSharedPtr<FJsonObject
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FBanInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Active"))
+        {
+            reader.ReadValue(Active);
+        }
+        else if (reader.IsField("BanId"))
+        {
+            reader.ReadValue(BanId);
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("Expires"))
+        {
+            reader.ReadValue(Expires);
+        }
+        else if (reader.IsField("IPAddress"))
+        {
+            reader.ReadValue(IPAddress);
+        }
+        else if (reader.IsField("MACAddress"))
+        {
+            reader.ReadValue(MACAddress);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Reason"))
+        {
+            reader.ReadValue(Reason);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FBanInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FBanRequest::~FBanRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FBanRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FBanRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2807,6 +4663,16 @@ void PlayFab::ServerModels::FBanRequest::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FBanRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FBanRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FBanRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2849,12 +4715,55 @@ bool PlayFab::ServerModels::FBanRequest::readFromValue(const TSharedPtr<FJsonObj
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FBanRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DurationInHours"))
+        {
+            reader.ReadValue(DurationInHours);
+        }
+        else if (reader.IsField("IPAddress"))
+        {
+            reader.ReadValue(IPAddress);
+        }
+        else if (reader.IsField("MACAddress"))
+        {
+            reader.ReadValue(MACAddress);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Reason"))
+        {
+            reader.ReadValue(Reason);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FBanRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FBanUsersRequest::~FBanUsersRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FBanUsersRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FBanUsersRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2878,6 +4787,16 @@ void PlayFab::ServerModels::FBanUsersRequest::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FBanUsersRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FBanUsersRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FBanUsersRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2886,7 +4805,7 @@ bool PlayFab::ServerModels::FBanUsersRequest::readFromValue(const TSharedPtr<FJs
     for (int32 Idx = 0; Idx < BansArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BansArray[Idx];
-        Bans.Add(FBanRequest(CurrentItem->AsObject()));
+        Bans.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2895,21 +4814,66 @@ bool PlayFab::ServerModels::FBanUsersRequest::readFromValue(const TSharedPtr<FJs
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
-PlayFab::ServerModels::FBanUsersResult::~FBanUsersResult()
+bool PlayFab::ServerModels::FBanUsersRequest::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::ServerModels::FBanUsersResult::writeJSON(JsonWriter& writer) const
-{
-    writer->WriteObjectStart();
+        if (reader.IsField("Bans"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Bans[Bans.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FBanUsersRequest();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ServerModels::FBanUsersResult::~FBanUsersResult()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ServerModels::FBanUsersResult::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
 
     if (BanData.Num() != 0)
     {
@@ -2923,6 +4887,16 @@ void PlayFab::ServerModels::FBanUsersResult::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FBanUsersResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FBanUsersResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FBanUsersResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2931,19 +4905,53 @@ bool PlayFab::ServerModels::FBanUsersResult::readFromValue(const TSharedPtr<FJso
     for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
+        BanData.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FBanUsersResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BanData"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { BanData[BanData.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FBanUsersResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FCatalogItemBundleInfo::~FCatalogItemBundleInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FCatalogItemBundleInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FCatalogItemBundleInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2979,6 +4987,16 @@ void PlayFab::ServerModels::FCatalogItemBundleInfo::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FCatalogItemBundleInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FCatalogItemBundleInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FCatalogItemBundleInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2993,19 +5011,75 @@ bool PlayFab::ServerModels::FCatalogItemBundleInfo::readFromValue(const TSharedP
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*BundledVirtualCurrenciesObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            BundledVirtualCurrencies.Add(It.Key(), TmpValue);
+            BundledVirtualCurrencies.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FCatalogItemBundleInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BundledItems"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { BundledItems.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("BundledResultTables"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { BundledResultTables.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("BundledVirtualCurrencies"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { BundledVirtualCurrencies.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCatalogItemBundleInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FCatalogItemConsumableInfo::~FCatalogItemConsumableInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FCatalogItemConsumableInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FCatalogItemConsumableInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3030,6 +5104,16 @@ void PlayFab::ServerModels::FCatalogItemConsumableInfo::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FCatalogItemConsumableInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FCatalogItemConsumableInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FCatalogItemConsumableInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3058,12 +5142,47 @@ bool PlayFab::ServerModels::FCatalogItemConsumableInfo::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FCatalogItemConsumableInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("UsageCount"))
+        {
+            reader.ReadValue(UsageCount);
+        }
+        else if (reader.IsField("UsagePeriod"))
+        {
+            reader.ReadValue(UsagePeriod);
+        }
+        else if (reader.IsField("UsagePeriodGroup"))
+        {
+            reader.ReadValue(UsagePeriodGroup);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCatalogItemConsumableInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FCatalogItemContainerInfo::~FCatalogItemContainerInfo()
 {
 
 }
 
-void PlayFab::ServerModels::FCatalogItemContainerInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FCatalogItemContainerInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3105,6 +5224,16 @@ void PlayFab::ServerModels::FCatalogItemContainerInfo::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FCatalogItemContainerInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FCatalogItemContainerInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FCatalogItemContainerInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3126,13 +5255,72 @@ bool PlayFab::ServerModels::FCatalogItemContainerInfo::readFromValue(const TShar
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyContentsObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrencyContents.Add(It.Key(), TmpValue);
+            VirtualCurrencyContents.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FCatalogItemContainerInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ItemContents"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ItemContents.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("KeyItemId"))
+        {
+            reader.ReadValue(KeyItemId);
+        }
+        else if (reader.IsField("ResultTableContents"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ResultTableContents.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyContents"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrencyContents.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCatalogItemContainerInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FCatalogItem::~FCatalogItem()
 {
     //if (Bundle != nullptr) delete Bundle;
@@ -3141,7 +5329,8 @@ PlayFab::ServerModels::FCatalogItem::~FCatalogItem()
 
 }
 
-void PlayFab::ServerModels::FCatalogItem::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FCatalogItem::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3258,6 +5447,16 @@ void PlayFab::ServerModels::FCatalogItem::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FCatalogItem::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FCatalogItem::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3265,7 +5464,7 @@ bool PlayFab::ServerModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonOb
     const TSharedPtr<FJsonValue> BundleValue = obj->TryGetField(TEXT("Bundle"));
     if (BundleValue.IsValid() && !BundleValue->IsNull())
     {
-        Bundle = MakeShareable(new FCatalogItemBundleInfo(BundleValue->AsObject()));
+        Bundle = MakeShared<FCatalogItemBundleInfo>(BundleValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> CanBecomeCharacterValue = obj->TryGetField(TEXT("CanBecomeCharacter"));
@@ -3285,13 +5484,13 @@ bool PlayFab::ServerModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonOb
     const TSharedPtr<FJsonValue> ConsumableValue = obj->TryGetField(TEXT("Consumable"));
     if (ConsumableValue.IsValid() && !ConsumableValue->IsNull())
     {
-        Consumable = MakeShareable(new FCatalogItemConsumableInfo(ConsumableValue->AsObject()));
+        Consumable = MakeShared<FCatalogItemConsumableInfo>(ConsumableValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ContainerValue = obj->TryGetField(TEXT("Container"));
     if (ContainerValue.IsValid() && !ContainerValue->IsNull())
     {
-        Container = MakeShareable(new FCatalogItemContainerInfo(ContainerValue->AsObject()));
+        Container = MakeShared<FCatalogItemContainerInfo>(ContainerValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> CustomDataValue = obj->TryGetField(TEXT("CustomData"));
@@ -3370,7 +5569,7 @@ bool PlayFab::ServerModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonOb
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*RealCurrencyPricesObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            RealCurrencyPrices.Add(It.Key(), TmpValue);
+            RealCurrencyPrices.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -3382,19 +5581,138 @@ bool PlayFab::ServerModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonOb
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyPricesObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrencyPrices.Add(It.Key(), TmpValue);
+            VirtualCurrencyPrices.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FCatalogItem::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Bundle"))
+        {
+            Bundle = MakeShared<FCatalogItemBundleInfo>();
+            Bundle->readFromReader(reader);
+        }
+        else if (reader.IsField("CanBecomeCharacter"))
+        {
+            reader.ReadValue(CanBecomeCharacter);
+        }
+        else if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("Consumable"))
+        {
+            Consumable = MakeShared<FCatalogItemConsumableInfo>();
+            Consumable->readFromReader(reader);
+        }
+        else if (reader.IsField("Container"))
+        {
+            Container = MakeShared<FCatalogItemContainerInfo>();
+            Container->readFromReader(reader);
+        }
+        else if (reader.IsField("CustomData"))
+        {
+            reader.ReadValue(CustomData);
+        }
+        else if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("InitialLimitedEditionCount"))
+        {
+            reader.ReadValue(InitialLimitedEditionCount);
+        }
+        else if (reader.IsField("IsLimitedEdition"))
+        {
+            reader.ReadValue(IsLimitedEdition);
+        }
+        else if (reader.IsField("IsStackable"))
+        {
+            reader.ReadValue(IsStackable);
+        }
+        else if (reader.IsField("IsTradable"))
+        {
+            reader.ReadValue(IsTradable);
+        }
+        else if (reader.IsField("ItemClass"))
+        {
+            reader.ReadValue(ItemClass);
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else if (reader.IsField("ItemImageUrl"))
+        {
+            reader.ReadValue(ItemImageUrl);
+        }
+        else if (reader.IsField("RealCurrencyPrices"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { RealCurrencyPrices.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Tags.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyPrices"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrencyPrices.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCatalogItem();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FItemInstance::~FItemInstance()
 {
 
 }
 
-void PlayFab::ServerModels::FItemInstance::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FItemInstance::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3496,6 +5814,16 @@ void PlayFab::ServerModels::FItemInstance::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FItemInstance::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FItemInstance::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FItemInstance::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3528,7 +5856,7 @@ bool PlayFab::ServerModels::FItemInstance::readFromValue(const TSharedPtr<FJsonO
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomDataObject)->Values); It; ++It)
         {
-            CustomData.Add(It.Key(), It.Value()->AsString());
+            CustomData.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -3601,12 +5929,109 @@ bool PlayFab::ServerModels::FItemInstance::readFromValue(const TSharedPtr<FJsonO
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FItemInstance::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Annotation"))
+        {
+            reader.ReadValue(Annotation);
+        }
+        else if (reader.IsField("BundleContents"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { BundleContents.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("BundleParent"))
+        {
+            reader.ReadValue(BundleParent);
+        }
+        else if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomData"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomData.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("Expiration"))
+        {
+            reader.ReadValue(Expiration);
+        }
+        else if (reader.IsField("ItemClass"))
+        {
+            reader.ReadValue(ItemClass);
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("PurchaseDate"))
+        {
+            reader.ReadValue(PurchaseDate);
+        }
+        else if (reader.IsField("RemainingUses"))
+        {
+            reader.ReadValue(RemainingUses);
+        }
+        else if (reader.IsField("UnitCurrency"))
+        {
+            reader.ReadValue(UnitCurrency);
+        }
+        else if (reader.IsField("UnitPrice"))
+        {
+            reader.ReadValue(UnitPrice);
+        }
+        else if (reader.IsField("UsesIncrementedBy"))
+        {
+            reader.ReadValue(UsesIncrementedBy);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FItemInstance();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FCharacterInventory::~FCharacterInventory()
 {
 
 }
 
-void PlayFab::ServerModels::FCharacterInventory::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FCharacterInventory::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3628,6 +6053,16 @@ void PlayFab::ServerModels::FCharacterInventory::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FCharacterInventory::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FCharacterInventory::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FCharacterInventory::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3643,19 +6078,57 @@ bool PlayFab::ServerModels::FCharacterInventory::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < InventoryArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = InventoryArray[Idx];
-        Inventory.Add(FItemInstance(CurrentItem->AsObject()));
+        Inventory.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FCharacterInventory::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("Inventory"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Inventory[Inventory.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCharacterInventory();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FCharacterLeaderboardEntry::~FCharacterLeaderboardEntry()
 {
 
 }
 
-void PlayFab::ServerModels::FCharacterLeaderboardEntry::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FCharacterLeaderboardEntry::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3698,6 +6171,16 @@ void PlayFab::ServerModels::FCharacterLeaderboardEntry::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FCharacterLeaderboardEntry::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FCharacterLeaderboardEntry::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FCharacterLeaderboardEntry::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3754,24 +6237,75 @@ bool PlayFab::ServerModels::FCharacterLeaderboardEntry::readFromValue(const TSha
     return HasSucceeded;
 }
 
-PlayFab::ServerModels::FCharacterResult::~FCharacterResult()
-{
-
-}
-
-void PlayFab::ServerModels::FCharacterResult::writeJSON(JsonWriter& writer) const
+bool PlayFab::ServerModels::FCharacterLeaderboardEntry::readFromReader(FPlayFabJsonPullReader& reader)
 {
-    writer->WriteObjectStart();
+    if (!reader.ReadObjectStart())
+        return false;
 
-    if (CharacterId.IsEmpty() == false)
+    while (reader.NextField())
     {
-        writer->WriteIdentifierPrefix(TEXT("CharacterId"));
-        writer->WriteValue(CharacterId);
-    }
+        if (reader.ReadNull())
+            continue;
 
-    if (CharacterName.IsEmpty() == false)
-    {
-        writer->WriteIdentifierPrefix(TEXT("CharacterName"));
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CharacterName"))
+        {
+            reader.ReadValue(CharacterName);
+        }
+        else if (reader.IsField("CharacterType"))
+        {
+            reader.ReadValue(CharacterType);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Position"))
+        {
+            reader.ReadValue(Position);
+        }
+        else if (reader.IsField("StatValue"))
+        {
+            reader.ReadValue(StatValue);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCharacterLeaderboardEntry();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ServerModels::FCharacterResult::~FCharacterResult()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ServerModels::FCharacterResult::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
+
+    if (CharacterId.IsEmpty() == false)
+    {
+        writer->WriteIdentifierPrefix(TEXT("CharacterId"));
+        writer->WriteValue(CharacterId);
+    }
+
+    if (CharacterName.IsEmpty() == false)
+    {
+        writer->WriteIdentifierPrefix(TEXT("CharacterName"));
         writer->WriteValue(CharacterName);
     }
 
@@ -3784,6 +6318,16 @@ void PlayFab::ServerModels::FCharacterResult::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FCharacterResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FCharacterResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FCharacterResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3812,7 +6356,42 @@ bool PlayFab::ServerModels::FCharacterResult::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
-void PlayFab::ServerModels::writeCloudScriptRevisionOptionEnumJSON(CloudScriptRevisionOption enumVal, JsonWriter& writer)
+bool PlayFab::ServerModels::FCharacterResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CharacterName"))
+        {
+            reader.ReadValue(CharacterName);
+        }
+        else if (reader.IsField("CharacterType"))
+        {
+            reader.ReadValue(CharacterType);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCharacterResult();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeCloudScriptRevisionOptionEnumValue(ServerModels::CloudScriptRevisionOption enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -3823,6 +6402,16 @@ void PlayFab::ServerModels::writeCloudScriptRevisionOptionEnumJSON(CloudScriptRe
     }
 }
 
+void PlayFab::ServerModels::writeCloudScriptRevisionOptionEnumJSON(CloudScriptRevisionOption enumVal, JsonWriter& writer)
+{
+    writeCloudScriptRevisionOptionEnumValue(enumVal, writer);
+}
+
+void PlayFab::ServerModels::writeCloudScriptRevisionOptionEnumJSON(CloudScriptRevisionOption enumVal, JsonUtf8Writer& writer)
+{
+    writeCloudScriptRevisionOptionEnumValue(enumVal, writer);
+}
+
 ServerModels::CloudScriptRevisionOption PlayFab::ServerModels::readCloudScriptRevisionOptionFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readCloudScriptRevisionOptionFromValue(value.IsValid() ? value->AsString() : "");
@@ -3855,7 +6444,8 @@ PlayFab::ServerModels::FConsumeItemRequest::~FConsumeItemRequest()
 
 }
 
-void PlayFab::ServerModels::FConsumeItemRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FConsumeItemRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3902,6 +6492,16 @@ void PlayFab::ServerModels::FConsumeItemRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FConsumeItemRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FConsumeItemRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FConsumeItemRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3925,7 +6525,7 @@ bool PlayFab::ServerModels::FConsumeItemRequest::readFromValue(const TSharedPtr<
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -3946,12 +6546,62 @@ bool PlayFab::ServerModels::FConsumeItemRequest::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FConsumeItemRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("ConsumeCount"))
+        {
+            reader.ReadValue(ConsumeCount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FConsumeItemRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FConsumeItemResult::~FConsumeItemResult()
 {
 
 }
 
-void PlayFab::ServerModels::FConsumeItemResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FConsumeItemResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3967,6 +6617,16 @@ void PlayFab::ServerModels::FConsumeItemResult::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FConsumeItemResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FConsumeItemResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FConsumeItemResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3988,7 +6648,38 @@ bool PlayFab::ServerModels::FConsumeItemResult::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
-void PlayFab::ServerModels::writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonWriter& writer)
+bool PlayFab::ServerModels::FConsumeItemResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("RemainingUses"))
+        {
+            reader.ReadValue(RemainingUses);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FConsumeItemResult();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeEmailVerificationStatusEnumValue(ServerModels::EmailVerificationStatus enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -3999,6 +6690,16 @@ void PlayFab::ServerModels::writeEmailVerificationStatusEnumJSON(EmailVerificati
     }
 }
 
+void PlayFab::ServerModels::writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonWriter& writer)
+{
+    writeEmailVerificationStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::ServerModels::writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeEmailVerificationStatusEnumValue(enumVal, writer);
+}
+
 ServerModels::EmailVerificationStatus PlayFab::ServerModels::readEmailVerificationStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readEmailVerificationStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -4031,7 +6732,8 @@ PlayFab::ServerModels::FContactEmailInfo::~FContactEmailInfo()
 
 }
 
-void PlayFab::ServerModels::FContactEmailInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FContactEmailInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4056,6 +6758,16 @@ void PlayFab::ServerModels::FContactEmailInfo::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FContactEmailInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FContactEmailInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FContactEmailInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4079,12 +6791,48 @@ bool PlayFab::ServerModels::FContactEmailInfo::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FContactEmailInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("EmailAddress"))
+        {
+            reader.ReadValue(EmailAddress);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("VerificationStatus"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { VerificationStatus = readEmailVerificationStatusFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FContactEmailInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FContactEmailInfoModel::~FContactEmailInfoModel()
 {
 
 }
 
-void PlayFab::ServerModels::FContactEmailInfoModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FContactEmailInfoModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4109,6 +6857,16 @@ void PlayFab::ServerModels::FContactEmailInfoModel::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FContactEmailInfoModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FContactEmailInfoModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FContactEmailInfoModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4132,7 +6890,43 @@ bool PlayFab::ServerModels::FContactEmailInfoModel::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
-void PlayFab::ServerModels::writeContinentCodeEnumJSON(ContinentCode enumVal, JsonWriter& writer)
+bool PlayFab::ServerModels::FContactEmailInfoModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("EmailAddress"))
+        {
+            reader.ReadValue(EmailAddress);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("VerificationStatus"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { VerificationStatus = readEmailVerificationStatusFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FContactEmailInfoModel();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeContinentCodeEnumValue(ServerModels::ContinentCode enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -4147,6 +6941,16 @@ void PlayFab::ServerModels::writeContinentCodeEnumJSON(ContinentCode enumVal, Js
     }
 }
 
+void PlayFab::ServerModels::writeContinentCodeEnumJSON(ContinentCode enumVal, JsonWriter& writer)
+{
+    writeContinentCodeEnumValue(enumVal, writer);
+}
+
+void PlayFab::ServerModels::writeContinentCodeEnumJSON(ContinentCode enumVal, JsonUtf8Writer& writer)
+{
+    writeContinentCodeEnumValue(enumVal, writer);
+}
+
 ServerModels::ContinentCode PlayFab::ServerModels::readContinentCodeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readContinentCodeFromValue(value.IsValid() ? value->AsString() : "");
@@ -4178,7 +6982,8 @@ ServerModels::ContinentCode PlayFab::ServerModels::readContinentCodeFromValue(co
     return ContinentCodeAF; // Basically critical fail
 }
 
-void PlayFab::ServerModels::writeCountryCodeEnumJSON(CountryCode enumVal, JsonWriter& writer)
+template <typename WriterType>
+static void writeCountryCodeEnumValue(ServerModels::CountryCode enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -4435,6 +7240,16 @@ void PlayFab::ServerModels::writeCountryCodeEnumJSON(CountryCode enumVal, JsonWr
     }
 }
 
+void PlayFab::ServerModels::writeCountryCodeEnumJSON(CountryCode enumVal, JsonWriter& writer)
+{
+    writeCountryCodeEnumValue(enumVal, writer);
+}
+
+void PlayFab::ServerModels::writeCountryCodeEnumJSON(CountryCode enumVal, JsonUtf8Writer& writer)
+{
+    writeCountryCodeEnumValue(enumVal, writer);
+}
+
 ServerModels::CountryCode PlayFab::ServerModels::readCountryCodeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readCountryCodeFromValue(value.IsValid() ? value->AsString() : "");
@@ -4713,7 +7528,8 @@ PlayFab::ServerModels::FCreateSharedGroupRequest::~FCreateSharedGroupRequest()
 
 }
 
-void PlayFab::ServerModels::FCreateSharedGroupRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FCreateSharedGroupRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4726,6 +7542,16 @@ void PlayFab::ServerModels::FCreateSharedGroupRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FCreateSharedGroupRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FCreateSharedGroupRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FCreateSharedGroupRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4740,12 +7566,39 @@ bool PlayFab::ServerModels::FCreateSharedGroupRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FCreateSharedGroupRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SharedGroupId"))
+        {
+            reader.ReadValue(SharedGroupId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateSharedGroupRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FCreateSharedGroupResult::~FCreateSharedGroupResult()
 {
 
 }
 
-void PlayFab::ServerModels::FCreateSharedGroupResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FCreateSharedGroupResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4758,6 +7611,16 @@ void PlayFab::ServerModels::FCreateSharedGroupResult::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FCreateSharedGroupResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FCreateSharedGroupResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FCreateSharedGroupResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4772,12 +7635,39 @@ bool PlayFab::ServerModels::FCreateSharedGroupResult::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FCreateSharedGroupResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SharedGroupId"))
+        {
+            reader.ReadValue(SharedGroupId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateSharedGroupResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FDeleteCharacterFromUserRequest::~FDeleteCharacterFromUserRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FDeleteCharacterFromUserRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FDeleteCharacterFromUserRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4818,6 +7708,16 @@ void PlayFab::ServerModels::FDeleteCharacterFromUserRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FDeleteCharacterFromUserRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FDeleteCharacterFromUserRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FDeleteCharacterFromUserRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4834,7 +7734,7 @@ bool PlayFab::ServerModels::FDeleteCharacterFromUserRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -4855,16 +7755,72 @@ bool PlayFab::ServerModels::FDeleteCharacterFromUserRequest::readFromValue(const
     return HasSucceeded;
 }
 
-PlayFab::ServerModels::FDeleteCharacterFromUserResult::~FDeleteCharacterFromUserResult()
+bool PlayFab::ServerModels::FDeleteCharacterFromUserRequest::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::ServerModels::FDeleteCharacterFromUserResult::writeJSON(JsonWriter& writer) const
-{
-    writer->WriteObjectStart();
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("SaveCharacterInventory"))
+        {
+            reader.ReadValue(SaveCharacterInventory);
+        }
+        else
+            reader.SkipValue();
+    }
 
-    writer->WriteObjectEnd();
+    if (!reader.IsValid())
+    {
+        *this = FDeleteCharacterFromUserRequest();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ServerModels::FDeleteCharacterFromUserResult::~FDeleteCharacterFromUserResult()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ServerModels::FDeleteCharacterFromUserResult::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
+
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::ServerModels::FDeleteCharacterFromUserResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FDeleteCharacterFromUserResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::ServerModels::FDeleteCharacterFromUserResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -4874,12 +7830,34 @@ bool PlayFab::ServerModels::FDeleteCharacterFromUserResult::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FDeleteCharacterFromUserResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteCharacterFromUserResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FDeletePlayerRequest::~FDeletePlayerRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FDeletePlayerRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FDeletePlayerRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4896,6 +7874,16 @@ void PlayFab::ServerModels::FDeletePlayerRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FDeletePlayerRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FDeletePlayerRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FDeletePlayerRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4910,18 +7898,55 @@ bool PlayFab::ServerModels::FDeletePlayerRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FDeletePlayerRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeletePlayerRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FDeletePlayerResult::~FDeletePlayerResult()
 {
 
 }
 
-void PlayFab::ServerModels::FDeletePlayerResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FDeletePlayerResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FDeletePlayerResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FDeletePlayerResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FDeletePlayerResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4929,12 +7954,34 @@ bool PlayFab::ServerModels::FDeletePlayerResult::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FDeletePlayerResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeletePlayerResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FDeletePushNotificationTemplateRequest::~FDeletePushNotificationTemplateRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FDeletePushNotificationTemplateRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FDeletePushNotificationTemplateRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4951,6 +7998,16 @@ void PlayFab::ServerModels::FDeletePushNotificationTemplateRequest::writeJSON(Js
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FDeletePushNotificationTemplateRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FDeletePushNotificationTemplateRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FDeletePushNotificationTemplateRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4965,18 +8022,55 @@ bool PlayFab::ServerModels::FDeletePushNotificationTemplateRequest::readFromValu
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FDeletePushNotificationTemplateRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PushNotificationTemplateId"))
+        {
+            reader.ReadValue(PushNotificationTemplateId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeletePushNotificationTemplateRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FDeletePushNotificationTemplateResult::~FDeletePushNotificationTemplateResult()
 {
 
 }
 
-void PlayFab::ServerModels::FDeletePushNotificationTemplateResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FDeletePushNotificationTemplateResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FDeletePushNotificationTemplateResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FDeletePushNotificationTemplateResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FDeletePushNotificationTemplateResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4984,12 +8078,34 @@ bool PlayFab::ServerModels::FDeletePushNotificationTemplateResult::readFromValue
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FDeletePushNotificationTemplateResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeletePushNotificationTemplateResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FDeleteSharedGroupRequest::~FDeleteSharedGroupRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FDeleteSharedGroupRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FDeleteSharedGroupRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5006,6 +8122,16 @@ void PlayFab::ServerModels::FDeleteSharedGroupRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FDeleteSharedGroupRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FDeleteSharedGroupRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FDeleteSharedGroupRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5020,12 +8146,39 @@ bool PlayFab::ServerModels::FDeleteSharedGroupRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FDeleteSharedGroupRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SharedGroupId"))
+        {
+            reader.ReadValue(SharedGroupId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteSharedGroupRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FDeregisterGameRequest::~FDeregisterGameRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FDeregisterGameRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FDeregisterGameRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5053,6 +8206,16 @@ void PlayFab::ServerModels::FDeregisterGameRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FDeregisterGameRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FDeregisterGameRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FDeregisterGameRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5062,7 +8225,7 @@ bool PlayFab::ServerModels::FDeregisterGameRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -5076,18 +8239,66 @@ bool PlayFab::ServerModels::FDeregisterGameRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FDeregisterGameRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("LobbyId"))
+        {
+            reader.ReadValue(LobbyId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeregisterGameRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FDeregisterGameResponse::~FDeregisterGameResponse()
 {
 
 }
 
-void PlayFab::ServerModels::FDeregisterGameResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FDeregisterGameResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FDeregisterGameResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FDeregisterGameResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FDeregisterGameResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5095,18 +8306,50 @@ bool PlayFab::ServerModels::FDeregisterGameResponse::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FDeregisterGameResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeregisterGameResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FEmptyResponse::~FEmptyResponse()
 {
 
 }
 
-void PlayFab::ServerModels::FEmptyResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FEmptyResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FEmptyResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FEmptyResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FEmptyResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5114,18 +8357,50 @@ bool PlayFab::ServerModels::FEmptyResponse::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FEmptyResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEmptyResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FEmptyResult::~FEmptyResult()
 {
 
 }
 
-void PlayFab::ServerModels::FEmptyResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FEmptyResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FEmptyResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FEmptyResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FEmptyResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5133,13 +8408,35 @@ bool PlayFab::ServerModels::FEmptyResult::readFromValue(const TSharedPtr<FJsonOb
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FEmptyResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEmptyResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FEntityTokenResponse::~FEntityTokenResponse()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::ServerModels::FEntityTokenResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FEntityTokenResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5164,6 +8461,16 @@ void PlayFab::ServerModels::FEntityTokenResponse::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FEntityTokenResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FEntityTokenResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FEntityTokenResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5171,7 +8478,7 @@ bool PlayFab::ServerModels::FEntityTokenResponse::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> EntityTokenValue = obj->TryGetField(TEXT("EntityToken"));
@@ -5189,12 +8496,48 @@ bool PlayFab::ServerModels::FEntityTokenResponse::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FEntityTokenResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("EntityToken"))
+        {
+            reader.ReadValue(EntityToken);
+        }
+        else if (reader.IsField("TokenExpiration"))
+        {
+            reader.ReadValue(TokenExpiration);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityTokenResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FEvaluateRandomResultTableRequest::~FEvaluateRandomResultTableRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FEvaluateRandomResultTableRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FEvaluateRandomResultTableRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5217,6 +8560,16 @@ void PlayFab::ServerModels::FEvaluateRandomResultTableRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FEvaluateRandomResultTableRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FEvaluateRandomResultTableRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FEvaluateRandomResultTableRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5238,12 +8591,43 @@ bool PlayFab::ServerModels::FEvaluateRandomResultTableRequest::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FEvaluateRandomResultTableRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("TableId"))
+        {
+            reader.ReadValue(TableId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEvaluateRandomResultTableRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FEvaluateRandomResultTableResult::~FEvaluateRandomResultTableResult()
 {
 
 }
 
-void PlayFab::ServerModels::FEvaluateRandomResultTableResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FEvaluateRandomResultTableResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5256,6 +8640,16 @@ void PlayFab::ServerModels::FEvaluateRandomResultTableResult::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FEvaluateRandomResultTableResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FEvaluateRandomResultTableResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FEvaluateRandomResultTableResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5270,12 +8664,39 @@ bool PlayFab::ServerModels::FEvaluateRandomResultTableResult::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FEvaluateRandomResultTableResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ResultItemId"))
+        {
+            reader.ReadValue(ResultItemId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEvaluateRandomResultTableResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FScriptExecutionError::~FScriptExecutionError()
 {
 
 }
 
-void PlayFab::ServerModels::FScriptExecutionError::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FScriptExecutionError::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5300,6 +8721,16 @@ void PlayFab::ServerModels::FScriptExecutionError::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FScriptExecutionError::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FScriptExecutionError::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FScriptExecutionError::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5325,7 +8756,41 @@ bool PlayFab::ServerModels::FScriptExecutionError::readFromValue(const TSharedPt
         if (StackTraceValue->TryGetString(TmpValue)) { StackTrace = TmpValue; }
     }
 
-    return HasSucceeded;
+    return HasSucceeded;
+}
+
+bool PlayFab::ServerModels::FScriptExecutionError::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Error"))
+        {
+            reader.ReadValue(Error);
+        }
+        else if (reader.IsField("Message"))
+        {
+            reader.ReadValue(Message);
+        }
+        else if (reader.IsField("StackTrace"))
+        {
+            reader.ReadValue(StackTrace);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FScriptExecutionError();
+        return false;
+    }
+    return true;
 }
 
 PlayFab::ServerModels::FLogStatement::~FLogStatement()
@@ -5333,7 +8798,8 @@ PlayFab::ServerModels::FLogStatement::~FLogStatement()
 
 }
 
-void PlayFab::ServerModels::FLogStatement::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FLogStatement::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5358,6 +8824,16 @@ void PlayFab::ServerModels::FLogStatement::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FLogStatement::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FLogStatement::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FLogStatement::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5385,13 +8861,48 @@ bool PlayFab::ServerModels::FLogStatement::readFromValue(const TSharedPtr<FJsonO
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FLogStatement::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            Data.readFromReader(reader);
+        }
+        else if (reader.IsField("Level"))
+        {
+            reader.ReadValue(Level);
+        }
+        else if (reader.IsField("Message"))
+        {
+            reader.ReadValue(Message);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLogStatement();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FExecuteCloudScriptResult::~FExecuteCloudScriptResult()
 {
     //if (Error != nullptr) delete Error;
 
 }
 
-void PlayFab::ServerModels::FExecuteCloudScriptResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FExecuteCloudScriptResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5455,6 +8966,16 @@ void PlayFab::ServerModels::FExecuteCloudScriptResult::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FExecuteCloudScriptResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FExecuteCloudScriptResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FExecuteCloudScriptResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5469,7 +8990,7 @@ bool PlayFab::ServerModels::FExecuteCloudScriptResult::readFromValue(const TShar
     const TSharedPtr<FJsonValue> ErrorValue = obj->TryGetField(TEXT("Error"));
     if (ErrorValue.IsValid() && !ErrorValue->IsNull())
     {
-        Error = MakeShareable(new FScriptExecutionError(ErrorValue->AsObject()));
+        Error = MakeShared<FScriptExecutionError>(ErrorValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ExecutionTimeSecondsValue = obj->TryGetField(TEXT("ExecutionTimeSeconds"));
@@ -5510,7 +9031,7 @@ bool PlayFab::ServerModels::FExecuteCloudScriptResult::readFromValue(const TShar
     for (int32 Idx = 0; Idx < LogsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LogsArray[Idx];
-        Logs.Add(FLogStatement(CurrentItem->AsObject()));
+        Logs.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -5545,12 +9066,91 @@ bool PlayFab::ServerModels::FExecuteCloudScriptResult::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FExecuteCloudScriptResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("APIRequestsIssued"))
+        {
+            reader.ReadValue(APIRequestsIssued);
+        }
+        else if (reader.IsField("Error"))
+        {
+            Error = MakeShared<FScriptExecutionError>();
+            Error->readFromReader(reader);
+        }
+        else if (reader.IsField("ExecutionTimeSeconds"))
+        {
+            reader.ReadValue(ExecutionTimeSeconds);
+        }
+        else if (reader.IsField("FunctionName"))
+        {
+            reader.ReadValue(FunctionName);
+        }
+        else if (reader.IsField("FunctionResult"))
+        {
+            FunctionResult.readFromReader(reader);
+        }
+        else if (reader.IsField("FunctionResultTooLarge"))
+        {
+            reader.ReadValue(FunctionResultTooLarge);
+        }
+        else if (reader.IsField("HttpRequestsIssued"))
+        {
+            reader.ReadValue(HttpRequestsIssued);
+        }
+        else if (reader.IsField("Logs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Logs[Logs.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("LogsTooLarge"))
+        {
+            reader.ReadValue(LogsTooLarge);
+        }
+        else if (reader.IsField("MemoryConsumedBytes"))
+        {
+            reader.ReadValue(MemoryConsumedBytes);
+        }
+        else if (reader.IsField("ProcessorTimeSeconds"))
+        {
+            reader.ReadValue(ProcessorTimeSeconds);
+        }
+        else if (reader.IsField("Revision"))
+        {
+            reader.ReadValue(Revision);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FExecuteCloudScriptResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FExecuteCloudScriptServerRequest::~FExecuteCloudScriptServerRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FExecuteCloudScriptServerRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FExecuteCloudScriptServerRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5612,6 +9212,16 @@ void PlayFab::ServerModels::FExecuteCloudScriptServerRequest::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FExecuteCloudScriptServerRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FExecuteCloudScriptServerRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FExecuteCloudScriptServerRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5621,7 +9231,7 @@ bool PlayFab::ServerModels::FExecuteCloudScriptServerRequest::readFromValue(cons
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -5664,12 +9274,71 @@ bool PlayFab::ServerModels::FExecuteCloudScriptServerRequest::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FExecuteCloudScriptServerRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("FunctionName"))
+        {
+            reader.ReadValue(FunctionName);
+        }
+        else if (reader.IsField("FunctionParameter"))
+        {
+            FunctionParameter.readFromReader(reader);
+        }
+        else if (reader.IsField("GeneratePlayStreamEvent"))
+        {
+            reader.ReadValue(GeneratePlayStreamEvent);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("RevisionSelection"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { RevisionSelection = readCloudScriptRevisionOptionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("SpecificRevision"))
+        {
+            reader.ReadValue(SpecificRevision);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FExecuteCloudScriptServerRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FFacebookInstantGamesPlayFabIdPair::~FFacebookInstantGamesPlayFabIdPair()
 {
 
 }
 
-void PlayFab::ServerModels::FFacebookInstantGamesPlayFabIdPair::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FFacebookInstantGamesPlayFabIdPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5688,6 +9357,16 @@ void PlayFab::ServerModels::FFacebookInstantGamesPlayFabIdPair::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FFacebookInstantGamesPlayFabIdPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FFacebookInstantGamesPlayFabIdPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FFacebookInstantGamesPlayFabIdPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5709,12 +9388,43 @@ bool PlayFab::ServerModels::FFacebookInstantGamesPlayFabIdPair::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FFacebookInstantGamesPlayFabIdPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FacebookInstantGamesId"))
+        {
+            reader.ReadValue(FacebookInstantGamesId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FFacebookInstantGamesPlayFabIdPair();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FFacebookPlayFabIdPair::~FFacebookPlayFabIdPair()
 {
 
 }
 
-void PlayFab::ServerModels::FFacebookPlayFabIdPair::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FFacebookPlayFabIdPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5733,6 +9443,16 @@ void PlayFab::ServerModels::FFacebookPlayFabIdPair::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FFacebookPlayFabIdPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FFacebookPlayFabIdPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FFacebookPlayFabIdPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5754,7 +9474,38 @@ bool PlayFab::ServerModels::FFacebookPlayFabIdPair::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
-void PlayFab::ServerModels::writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonWriter& writer)
+bool PlayFab::ServerModels::FFacebookPlayFabIdPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FacebookId"))
+        {
+            reader.ReadValue(FacebookId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FFacebookPlayFabIdPair();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeLoginIdentityProviderEnumValue(ServerModels::LoginIdentityProvider enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -5783,6 +9534,16 @@ void PlayFab::ServerModels::writeLoginIdentityProviderEnumJSON(LoginIdentityProv
     }
 }
 
+void PlayFab::ServerModels::writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonWriter& writer)
+{
+    writeLoginIdentityProviderEnumValue(enumVal, writer);
+}
+
+void PlayFab::ServerModels::writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonUtf8Writer& writer)
+{
+    writeLoginIdentityProviderEnumValue(enumVal, writer);
+}
+
 ServerModels::LoginIdentityProvider PlayFab::ServerModels::readLoginIdentityProviderFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readLoginIdentityProviderFromValue(value.IsValid() ? value->AsString() : "");
@@ -5833,7 +9594,8 @@ PlayFab::ServerModels::FLinkedPlatformAccountModel::~FLinkedPlatformAccountModel
 
 }
 
-void PlayFab::ServerModels::FLinkedPlatformAccountModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FLinkedPlatformAccountModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5864,6 +9626,16 @@ void PlayFab::ServerModels::FLinkedPlatformAccountModel::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FLinkedPlatformAccountModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FLinkedPlatformAccountModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FLinkedPlatformAccountModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5894,12 +9666,52 @@ bool PlayFab::ServerModels::FLinkedPlatformAccountModel::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FLinkedPlatformAccountModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Email"))
+        {
+            reader.ReadValue(Email);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Platform = readLoginIdentityProviderFromValue(TmpValue); }
+        }
+        else if (reader.IsField("PlatformUserId"))
+        {
+            reader.ReadValue(PlatformUserId);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkedPlatformAccountModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FLocationModel::~FLocationModel()
 {
 
 }
 
-void PlayFab::ServerModels::FLocationModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FLocationModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5936,6 +9748,16 @@ void PlayFab::ServerModels::FLocationModel::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FLocationModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FLocationModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FLocationModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5968,7 +9790,52 @@ bool PlayFab::ServerModels::FLocationModel::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
-void PlayFab::ServerModels::writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonWriter& writer)
+bool PlayFab::ServerModels::FLocationModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("City"))
+        {
+            reader.ReadValue(City);
+        }
+        else if (reader.IsField("ContinentCode"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfContinentCode = readContinentCodeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("CountryCode"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfCountryCode = readCountryCodeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Latitude"))
+        {
+            reader.ReadValue(Latitude);
+        }
+        else if (reader.IsField("Longitude"))
+        {
+            reader.ReadValue(Longitude);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLocationModel();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeSubscriptionProviderStatusEnumValue(ServerModels::SubscriptionProviderStatus enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -5984,6 +9851,16 @@ void PlayFab::ServerModels::writeSubscriptionProviderStatusEnumJSON(Subscription
     }
 }
 
+void PlayFab::ServerModels::writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonWriter& writer)
+{
+    writeSubscriptionProviderStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::ServerModels::writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeSubscriptionProviderStatusEnumValue(enumVal, writer);
+}
+
 ServerModels::SubscriptionProviderStatus PlayFab::ServerModels::readSubscriptionProviderStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readSubscriptionProviderStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -6021,7 +9898,8 @@ PlayFab::ServerModels::FSubscriptionModel::~FSubscriptionModel()
 
 }
 
-void PlayFab::ServerModels::FSubscriptionModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSubscriptionModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6061,6 +9939,16 @@ void PlayFab::ServerModels::FSubscriptionModel::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSubscriptionModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSubscriptionModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSubscriptionModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6108,12 +9996,64 @@ bool PlayFab::ServerModels::FSubscriptionModel::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSubscriptionModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Expiration"))
+        {
+            reader.ReadValue(Expiration);
+        }
+        else if (reader.IsField("InitialSubscriptionTime"))
+        {
+            reader.ReadValue(InitialSubscriptionTime);
+        }
+        else if (reader.IsField("IsActive"))
+        {
+            reader.ReadValue(IsActive);
+        }
+        else if (reader.IsField("Status"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Status = readSubscriptionProviderStatusFromValue(TmpValue); }
+        }
+        else if (reader.IsField("SubscriptionId"))
+        {
+            reader.ReadValue(SubscriptionId);
+        }
+        else if (reader.IsField("SubscriptionItemId"))
+        {
+            reader.ReadValue(SubscriptionItemId);
+        }
+        else if (reader.IsField("SubscriptionProvider"))
+        {
+            reader.ReadValue(SubscriptionProvider);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSubscriptionModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FMembershipModel::~FMembershipModel()
 {
 
 }
 
-void PlayFab::ServerModels::FMembershipModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FMembershipModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6150,7 +10090,17 @@ void PlayFab::ServerModels::FMembershipModel::writeJSON(JsonWriter& writer) cons
     }
 
 
-    writer->WriteObjectEnd();
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::ServerModels::FMembershipModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FMembershipModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::ServerModels::FMembershipModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -6192,19 +10142,73 @@ bool PlayFab::ServerModels::FMembershipModel::readFromValue(const TSharedPtr<FJs
     for (int32 Idx = 0; Idx < SubscriptionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = SubscriptionsArray[Idx];
-        Subscriptions.Add(FSubscriptionModel(CurrentItem->AsObject()));
+        Subscriptions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FMembershipModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("IsActive"))
+        {
+            reader.ReadValue(IsActive);
+        }
+        else if (reader.IsField("MembershipExpiration"))
+        {
+            reader.ReadValue(MembershipExpiration);
+        }
+        else if (reader.IsField("MembershipId"))
+        {
+            reader.ReadValue(MembershipId);
+        }
+        else if (reader.IsField("OverrideExpiration"))
+        {
+            reader.ReadValue(OverrideExpiration);
+        }
+        else if (reader.IsField("OverrideIsSet"))
+        {
+            reader.ReadValue(OverrideIsSet);
+        }
+        else if (reader.IsField("Subscriptions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Subscriptions[Subscriptions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FMembershipModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FPushNotificationRegistrationModel::~FPushNotificationRegistrationModel()
 {
 
 }
 
-void PlayFab::ServerModels::FPushNotificationRegistrationModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FPushNotificationRegistrationModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6223,6 +10227,16 @@ void PlayFab::ServerModels::FPushNotificationRegistrationModel::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FPushNotificationRegistrationModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FPushNotificationRegistrationModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FPushNotificationRegistrationModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6239,12 +10253,44 @@ bool PlayFab::ServerModels::FPushNotificationRegistrationModel::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FPushNotificationRegistrationModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("NotificationEndpointARN"))
+        {
+            reader.ReadValue(NotificationEndpointARN);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Platform = readPushNotificationPlatformFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPushNotificationRegistrationModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FStatisticModel::~FStatisticModel()
 {
 
 }
 
-void PlayFab::ServerModels::FStatisticModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FStatisticModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6263,6 +10309,16 @@ void PlayFab::ServerModels::FStatisticModel::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FStatisticModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FStatisticModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FStatisticModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6291,12 +10347,47 @@ bool PlayFab::ServerModels::FStatisticModel::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FStatisticModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStatisticModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FTagModel::~FTagModel()
 {
 
 }
 
-void PlayFab::ServerModels::FTagModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FTagModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6309,6 +10400,16 @@ void PlayFab::ServerModels::FTagModel::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FTagModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FTagModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FTagModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6323,12 +10424,39 @@ bool PlayFab::ServerModels::FTagModel::readFromValue(const TSharedPtr<FJsonObjec
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FTagModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TagValue"))
+        {
+            reader.ReadValue(TagValue);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FTagModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FValueToDateModel::~FValueToDateModel()
 {
 
 }
 
-void PlayFab::ServerModels::FValueToDateModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FValueToDateModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6350,6 +10478,16 @@ void PlayFab::ServerModels::FValueToDateModel::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FValueToDateModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FValueToDateModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FValueToDateModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6378,12 +10516,47 @@ bool PlayFab::ServerModels::FValueToDateModel::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FValueToDateModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Currency"))
+        {
+            reader.ReadValue(Currency);
+        }
+        else if (reader.IsField("TotalValue"))
+        {
+            reader.ReadValue(TotalValue);
+        }
+        else if (reader.IsField("TotalValueAsDecimal"))
+        {
+            reader.ReadValue(TotalValueAsDecimal);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FValueToDateModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FPlayerProfileModel::~FPlayerProfileModel()
 {
 
 }
 
-void PlayFab::ServerModels::FPlayerProfileModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FPlayerProfileModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6540,6 +10713,16 @@ void PlayFab::ServerModels::FPlayerProfileModel::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FPlayerProfileModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FPlayerProfileModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FPlayerProfileModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6548,7 +10731,7 @@ bool PlayFab::ServerModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < AdCampaignAttributionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = AdCampaignAttributionsArray[Idx];
-        AdCampaignAttributions.Add(FAdCampaignAttributionModel(CurrentItem->AsObject()));
+        AdCampaignAttributions.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6568,7 +10751,7 @@ bool PlayFab::ServerModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < ContactEmailAddressesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ContactEmailAddressesArray[Idx];
-        ContactEmailAddresses.Add(FContactEmailInfoModel(CurrentItem->AsObject()));
+        ContactEmailAddresses.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6595,7 +10778,7 @@ bool PlayFab::ServerModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < LinkedAccountsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LinkedAccountsArray[Idx];
-        LinkedAccounts.Add(FLinkedPlatformAccountModel(CurrentItem->AsObject()));
+        LinkedAccounts.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6603,7 +10786,7 @@ bool PlayFab::ServerModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < LocationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LocationsArray[Idx];
-        Locations.Add(FLocationModel(CurrentItem->AsObject()));
+        Locations.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6611,7 +10794,7 @@ bool PlayFab::ServerModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < MembershipsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = MembershipsArray[Idx];
-        Memberships.Add(FMembershipModel(CurrentItem->AsObject()));
+        Memberships.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6635,7 +10818,7 @@ bool PlayFab::ServerModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < PushNotificationRegistrationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PushNotificationRegistrationsArray[Idx];
-        PushNotificationRegistrations.Add(FPushNotificationRegistrationModel(CurrentItem->AsObject()));
+        PushNotificationRegistrations.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6643,7 +10826,7 @@ bool PlayFab::ServerModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FStatisticModel(CurrentItem->AsObject()));
+        Statistics.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6651,7 +10834,7 @@ bool PlayFab::ServerModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < TagsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = TagsArray[Idx];
-        Tags.Add(FTagModel(CurrentItem->AsObject()));
+        Tags.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6673,13 +10856,186 @@ bool PlayFab::ServerModels::FPlayerProfileModel::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < ValuesToDateArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ValuesToDateArray[Idx];
-        ValuesToDate.Add(FValueToDateModel(CurrentItem->AsObject()));
+        ValuesToDate.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FPlayerProfileModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AdCampaignAttributions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { AdCampaignAttributions[AdCampaignAttributions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("AvatarUrl"))
+        {
+            reader.ReadValue(AvatarUrl);
+        }
+        else if (reader.IsField("BannedUntil"))
+        {
+            reader.ReadValue(BannedUntil);
+        }
+        else if (reader.IsField("ContactEmailAddresses"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ContactEmailAddresses[ContactEmailAddresses.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("ExperimentVariants"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ExperimentVariants.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("LastLogin"))
+        {
+            reader.ReadValue(LastLogin);
+        }
+        else if (reader.IsField("LinkedAccounts"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { LinkedAccounts[LinkedAccounts.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Locations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Locations[Locations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Memberships"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Memberships[Memberships.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Origination"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Origination = readLoginIdentityProviderFromValue(TmpValue); }
+        }
+        else if (reader.IsField("PlayerId"))
+        {
+            reader.ReadValue(PlayerId);
+        }
+        else if (reader.IsField("PublisherId"))
+        {
+            reader.ReadValue(PublisherId);
+        }
+        else if (reader.IsField("PushNotificationRegistrations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { PushNotificationRegistrations[PushNotificationRegistrations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Statistics"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Statistics[Statistics.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Tags[Tags.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else if (reader.IsField("TotalValueToDateInUSD"))
+        {
+            reader.ReadValue(TotalValueToDateInUSD);
+        }
+        else if (reader.IsField("ValuesToDate"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ValuesToDate[ValuesToDate.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerProfileModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FFriendInfo::~FFriendInfo()
 {
     //if (FacebookInfo != nullptr) delete FacebookInfo;
@@ -6691,7 +11047,8 @@ PlayFab::ServerModels::FFriendInfo::~FFriendInfo()
 
 }
 
-void PlayFab::ServerModels::FFriendInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FFriendInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6761,6 +11118,16 @@ void PlayFab::ServerModels::FFriendInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FFriendInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FFriendInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FFriendInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6768,7 +11135,7 @@ bool PlayFab::ServerModels::FFriendInfo::readFromValue(const TSharedPtr<FJsonObj
     const TSharedPtr<FJsonValue> FacebookInfoValue = obj->TryGetField(TEXT("FacebookInfo"));
     if (FacebookInfoValue.IsValid() && !FacebookInfoValue->IsNull())
     {
-        FacebookInfo = MakeShareable(new FUserFacebookInfo(FacebookInfoValue->AsObject()));
+        FacebookInfo = MakeShared<FUserFacebookInfo>(FacebookInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> FriendPlayFabIdValue = obj->TryGetField(TEXT("FriendPlayFabId"));
@@ -6781,25 +11148,25 @@ bool PlayFab::ServerModels::FFriendInfo::readFromValue(const TSharedPtr<FJsonObj
     const TSharedPtr<FJsonValue> GameCenterInfoValue = obj->TryGetField(TEXT("GameCenterInfo"));
     if (GameCenterInfoValue.IsValid() && !GameCenterInfoValue->IsNull())
     {
-        GameCenterInfo = MakeShareable(new FUserGameCenterInfo(GameCenterInfoValue->AsObject()));
+        GameCenterInfo = MakeShared<FUserGameCenterInfo>(GameCenterInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ProfileValue = obj->TryGetField(TEXT("Profile"));
     if (ProfileValue.IsValid() && !ProfileValue->IsNull())
     {
-        Profile = MakeShareable(new FPlayerProfileModel(ProfileValue->AsObject()));
+        Profile = MakeShared<FPlayerProfileModel>(ProfileValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PSNInfoValue = obj->TryGetField(TEXT("PSNInfo"));
     if (PSNInfoValue.IsValid() && !PSNInfoValue->IsNull())
     {
-        PSNInfo = MakeShareable(new FUserPsnInfo(PSNInfoValue->AsObject()));
+        PSNInfo = MakeShared<FUserPsnInfo>(PSNInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> SteamInfoValue = obj->TryGetField(TEXT("SteamInfo"));
     if (SteamInfoValue.IsValid() && !SteamInfoValue->IsNull())
     {
-        SteamInfo = MakeShareable(new FUserSteamInfo(SteamInfoValue->AsObject()));
+        SteamInfo = MakeShared<FUserSteamInfo>(SteamInfoValue->AsObject());
     }
 
     obj->TryGetStringArrayField(TEXT("Tags"), Tags);
@@ -6821,13 +11188,89 @@ bool PlayFab::ServerModels::FFriendInfo::readFromValue(const TSharedPtr<FJsonObj
     const TSharedPtr<FJsonValue> XboxInfoValue = obj->TryGetField(TEXT("XboxInfo"));
     if (XboxInfoValue.IsValid() && !XboxInfoValue->IsNull())
     {
-        XboxInfo = MakeShareable(new FUserXboxInfo(XboxInfoValue->AsObject()));
+        XboxInfo = MakeShared<FUserXboxInfo>(XboxInfoValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
-void PlayFab::ServerModels::writeGameInstanceStateEnumJSON(GameInstanceState enumVal, JsonWriter& writer)
+bool PlayFab::ServerModels::FFriendInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FacebookInfo"))
+        {
+            FacebookInfo = MakeShared<FUserFacebookInfo>();
+            FacebookInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("FriendPlayFabId"))
+        {
+            reader.ReadValue(FriendPlayFabId);
+        }
+        else if (reader.IsField("GameCenterInfo"))
+        {
+            GameCenterInfo = MakeShared<FUserGameCenterInfo>();
+            GameCenterInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("Profile"))
+        {
+            Profile = MakeShared<FPlayerProfileModel>();
+            Profile->readFromReader(reader);
+        }
+        else if (reader.IsField("PSNInfo"))
+        {
+            PSNInfo = MakeShared<FUserPsnInfo>();
+            PSNInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("SteamInfo"))
+        {
+            SteamInfo = MakeShared<FUserSteamInfo>();
+            SteamInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Tags.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("TitleDisplayName"))
+        {
+            reader.ReadValue(TitleDisplayName);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else if (reader.IsField("XboxInfo"))
+        {
+            XboxInfo = MakeShared<FUserXboxInfo>();
+            XboxInfo->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FFriendInfo();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeGameInstanceStateEnumValue(ServerModels::GameInstanceState enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -6837,6 +11280,16 @@ void PlayFab::ServerModels::writeGameInstanceStateEnumJSON(GameInstanceState enu
     }
 }
 
+void PlayFab::ServerModels::writeGameInstanceStateEnumJSON(GameInstanceState enumVal, JsonWriter& writer)
+{
+    writeGameInstanceStateEnumValue(enumVal, writer);
+}
+
+void PlayFab::ServerModels::writeGameInstanceStateEnumJSON(GameInstanceState enumVal, JsonUtf8Writer& writer)
+{
+    writeGameInstanceStateEnumValue(enumVal, writer);
+}
+
 ServerModels::GameInstanceState PlayFab::ServerModels::readGameInstanceStateFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readGameInstanceStateFromValue(value.IsValid() ? value->AsString() : "");
@@ -6869,7 +11322,8 @@ PlayFab::ServerModels::FGenericPlayFabIdPair::~FGenericPlayFabIdPair()
 
 }
 
-void PlayFab::ServerModels::FGenericPlayFabIdPair::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGenericPlayFabIdPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6888,6 +11342,16 @@ void PlayFab::ServerModels::FGenericPlayFabIdPair::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGenericPlayFabIdPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGenericPlayFabIdPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGenericPlayFabIdPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6895,7 +11359,7 @@ bool PlayFab::ServerModels::FGenericPlayFabIdPair::readFromValue(const TSharedPt
     const TSharedPtr<FJsonValue> GenericIdValue = obj->TryGetField(TEXT("GenericId"));
     if (GenericIdValue.IsValid() && !GenericIdValue->IsNull())
     {
-        GenericId = MakeShareable(new FGenericServiceId(GenericIdValue->AsObject()));
+        GenericId = MakeShared<FGenericServiceId>(GenericIdValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PlayFabIdValue = obj->TryGetField(TEXT("PlayFabId"));
@@ -6908,18 +11372,60 @@ bool PlayFab::ServerModels::FGenericPlayFabIdPair::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGenericPlayFabIdPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GenericId"))
+        {
+            GenericId = MakeShared<FGenericServiceId>();
+            GenericId->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGenericPlayFabIdPair();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetAllSegmentsRequest::~FGetAllSegmentsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetAllSegmentsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetAllSegmentsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetAllSegmentsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetAllSegmentsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetAllSegmentsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6927,12 +11433,34 @@ bool PlayFab::ServerModels::FGetAllSegmentsRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetAllSegmentsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetAllSegmentsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetSegmentResult::~FGetSegmentResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetSegmentResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetSegmentResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6961,6 +11489,16 @@ void PlayFab::ServerModels::FGetSegmentResult::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetSegmentResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetSegmentResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetSegmentResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6989,12 +11527,47 @@ bool PlayFab::ServerModels::FGetSegmentResult::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetSegmentResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ABTestParent"))
+        {
+            reader.ReadValue(ABTestParent);
+        }
+        else if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetSegmentResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetAllSegmentsResult::~FGetAllSegmentsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetAllSegmentsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetAllSegmentsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7010,6 +11583,16 @@ void PlayFab::ServerModels::FGetAllSegmentsResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetAllSegmentsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetAllSegmentsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetAllSegmentsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7018,19 +11601,53 @@ bool PlayFab::ServerModels::FGetAllSegmentsResult::readFromValue(const TSharedPt
     for (int32 Idx = 0; Idx < SegmentsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = SegmentsArray[Idx];
-        Segments.Add(FGetSegmentResult(CurrentItem->AsObject()));
+        Segments.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetAllSegmentsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Segments"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Segments[Segments.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetAllSegmentsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetCatalogItemsRequest::~FGetCatalogItemsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetCatalogItemsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetCatalogItemsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7043,6 +11660,16 @@ void PlayFab::ServerModels::FGetCatalogItemsRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetCatalogItemsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetCatalogItemsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetCatalogItemsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7057,12 +11684,39 @@ bool PlayFab::ServerModels::FGetCatalogItemsRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetCatalogItemsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCatalogItemsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetCatalogItemsResult::~FGetCatalogItemsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetCatalogItemsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetCatalogItemsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7078,6 +11732,16 @@ void PlayFab::ServerModels::FGetCatalogItemsResult::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetCatalogItemsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetCatalogItemsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetCatalogItemsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7086,19 +11750,53 @@ bool PlayFab::ServerModels::FGetCatalogItemsResult::readFromValue(const TSharedP
     for (int32 Idx = 0; Idx < CatalogArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = CatalogArray[Idx];
-        Catalog.Add(FCatalogItem(CurrentItem->AsObject()));
+        Catalog.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetCatalogItemsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Catalog"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Catalog[Catalog.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCatalogItemsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetCharacterDataRequest::~FGetCharacterDataRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetCharacterDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetCharacterDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7140,6 +11838,16 @@ void PlayFab::ServerModels::FGetCharacterDataRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetCharacterDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetCharacterDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetCharacterDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7170,7 +11878,53 @@ bool PlayFab::ServerModels::FGetCharacterDataRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
-void PlayFab::ServerModels::writeUserDataPermissionEnumJSON(UserDataPermission enumVal, JsonWriter& writer)
+bool PlayFab::ServerModels::FGetCharacterDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("IfChangedFromDataVersion"))
+        {
+            reader.ReadValue(IfChangedFromDataVersion);
+        }
+        else if (reader.IsField("Keys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Keys.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCharacterDataRequest();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeUserDataPermissionEnumValue(ServerModels::UserDataPermission enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -7180,6 +11934,16 @@ void PlayFab::ServerModels::writeUserDataPermissionEnumJSON(UserDataPermission e
     }
 }
 
+void PlayFab::ServerModels::writeUserDataPermissionEnumJSON(UserDataPermission enumVal, JsonWriter& writer)
+{
+    writeUserDataPermissionEnumValue(enumVal, writer);
+}
+
+void PlayFab::ServerModels::writeUserDataPermissionEnumJSON(UserDataPermission enumVal, JsonUtf8Writer& writer)
+{
+    writeUserDataPermissionEnumValue(enumVal, writer);
+}
+
 ServerModels::UserDataPermission PlayFab::ServerModels::readUserDataPermissionFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readUserDataPermissionFromValue(value.IsValid() ? value->AsString() : "");
@@ -7211,7 +11975,8 @@ PlayFab::ServerModels::FUserDataRecord::~FUserDataRecord()
 
 }
 
-void PlayFab::ServerModels::FUserDataRecord::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserDataRecord::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7233,6 +11998,16 @@ void PlayFab::ServerModels::FUserDataRecord::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserDataRecord::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserDataRecord::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserDataRecord::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7254,12 +12029,48 @@ bool PlayFab::ServerModels::FUserDataRecord::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserDataRecord::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("LastUpdated"))
+        {
+            reader.ReadValue(LastUpdated);
+        }
+        else if (reader.IsField("Permission"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Permission = readUserDataPermissionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserDataRecord();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetCharacterDataResult::~FGetCharacterDataResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetCharacterDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetCharacterDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7292,6 +12103,16 @@ void PlayFab::ServerModels::FGetCharacterDataResult::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetCharacterDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetCharacterDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetCharacterDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7308,7 +12129,7 @@ bool PlayFab::ServerModels::FGetCharacterDataResult::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), FUserDataRecord(It.Value()->AsObject()));
+            Data.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -7329,12 +12150,58 @@ bool PlayFab::ServerModels::FGetCharacterDataResult::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetCharacterDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { Data.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("DataVersion"))
+        {
+            reader.ReadValue(DataVersion);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCharacterDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetCharacterInventoryRequest::~FGetCharacterInventoryRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetCharacterInventoryRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetCharacterInventoryRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7378,6 +12245,16 @@ void PlayFab::ServerModels::FGetCharacterInventoryRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetCharacterInventoryRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetCharacterInventoryRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetCharacterInventoryRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7401,7 +12278,7 @@ bool PlayFab::ServerModels::FGetCharacterInventoryRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -7415,12 +12292,58 @@ bool PlayFab::ServerModels::FGetCharacterInventoryRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetCharacterInventoryRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCharacterInventoryRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FVirtualCurrencyRechargeTime::~FVirtualCurrencyRechargeTime()
 {
 
 }
 
-void PlayFab::ServerModels::FVirtualCurrencyRechargeTime::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FVirtualCurrencyRechargeTime::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7436,6 +12359,16 @@ void PlayFab::ServerModels::FVirtualCurrencyRechargeTime::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FVirtualCurrencyRechargeTime::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FVirtualCurrencyRechargeTime::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FVirtualCurrencyRechargeTime::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7462,12 +12395,47 @@ bool PlayFab::ServerModels::FVirtualCurrencyRechargeTime::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FVirtualCurrencyRechargeTime::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("RechargeMax"))
+        {
+            reader.ReadValue(RechargeMax);
+        }
+        else if (reader.IsField("RechargeTime"))
+        {
+            reader.ReadValue(RechargeTime);
+        }
+        else if (reader.IsField("SecondsToRecharge"))
+        {
+            reader.ReadValue(SecondsToRecharge);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FVirtualCurrencyRechargeTime();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetCharacterInventoryResult::~FGetCharacterInventoryResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetCharacterInventoryResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetCharacterInventoryResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7517,6 +12485,16 @@ void PlayFab::ServerModels::FGetCharacterInventoryResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetCharacterInventoryResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetCharacterInventoryResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetCharacterInventoryResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7532,7 +12510,7 @@ bool PlayFab::ServerModels::FGetCharacterInventoryResult::readFromValue(const TS
     for (int32 Idx = 0; Idx < InventoryArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = InventoryArray[Idx];
-        Inventory.Add(FItemInstance(CurrentItem->AsObject()));
+        Inventory.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -7549,7 +12527,7 @@ bool PlayFab::ServerModels::FGetCharacterInventoryResult::readFromValue(const TS
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrency.Add(It.Key(), TmpValue);
+            VirtualCurrency.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -7558,19 +12536,83 @@ bool PlayFab::ServerModels::FGetCharacterInventoryResult::readFromValue(const TS
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyRechargeTimesObject)->Values); It; ++It)
         {
-            VirtualCurrencyRechargeTimes.Add(It.Key(), FVirtualCurrencyRechargeTime(It.Value()->AsObject()));
+            VirtualCurrencyRechargeTimes.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetCharacterInventoryResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("Inventory"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Inventory[Inventory.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrency.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyRechargeTimes"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { VirtualCurrencyRechargeTimes.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCharacterInventoryResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetCharacterLeaderboardRequest::~FGetCharacterLeaderboardRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetCharacterLeaderboardRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetCharacterLeaderboardRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7599,6 +12641,16 @@ void PlayFab::ServerModels::FGetCharacterLeaderboardRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetCharacterLeaderboardRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetCharacterLeaderboardRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetCharacterLeaderboardRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7634,12 +12686,51 @@ bool PlayFab::ServerModels::FGetCharacterLeaderboardRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetCharacterLeaderboardRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterType"))
+        {
+            reader.ReadValue(CharacterType);
+        }
+        else if (reader.IsField("MaxResultsCount"))
+        {
+            reader.ReadValue(MaxResultsCount);
+        }
+        else if (reader.IsField("StartPosition"))
+        {
+            reader.ReadValue(StartPosition);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCharacterLeaderboardRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetCharacterLeaderboardResult::~FGetCharacterLeaderboardResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetCharacterLeaderboardResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetCharacterLeaderboardResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7655,6 +12746,16 @@ void PlayFab::ServerModels::FGetCharacterLeaderboardResult::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetCharacterLeaderboardResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetCharacterLeaderboardResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetCharacterLeaderboardResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7663,19 +12764,53 @@ bool PlayFab::ServerModels::FGetCharacterLeaderboardResult::readFromValue(const
     for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FCharacterLeaderboardEntry(CurrentItem->AsObject()));
+        Leaderboard.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetCharacterLeaderboardResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Leaderboard"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Leaderboard[Leaderboard.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCharacterLeaderboardResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetCharacterStatisticsRequest::~FGetCharacterStatisticsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetCharacterStatisticsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetCharacterStatisticsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7702,6 +12837,16 @@ void PlayFab::ServerModels::FGetCharacterStatisticsRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetCharacterStatisticsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetCharacterStatisticsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetCharacterStatisticsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7723,12 +12868,43 @@ bool PlayFab::ServerModels::FGetCharacterStatisticsRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetCharacterStatisticsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCharacterStatisticsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetCharacterStatisticsResult::~FGetCharacterStatisticsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetCharacterStatisticsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetCharacterStatisticsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7758,6 +12934,16 @@ void PlayFab::ServerModels::FGetCharacterStatisticsResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetCharacterStatisticsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetCharacterStatisticsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetCharacterStatisticsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7775,7 +12961,7 @@ bool PlayFab::ServerModels::FGetCharacterStatisticsResult::readFromValue(const T
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CharacterStatisticsObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            CharacterStatistics.Add(It.Key(), TmpValue);
+            CharacterStatistics.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -7789,12 +12975,54 @@ bool PlayFab::ServerModels::FGetCharacterStatisticsResult::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetCharacterStatisticsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CharacterStatistics"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CharacterStatistics.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCharacterStatisticsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetContentDownloadUrlRequest::~FGetContentDownloadUrlRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetContentDownloadUrlRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetContentDownloadUrlRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7823,6 +13051,16 @@ void PlayFab::ServerModels::FGetContentDownloadUrlRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetContentDownloadUrlRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetContentDownloadUrlRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetContentDownloadUrlRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7851,12 +13089,47 @@ bool PlayFab::ServerModels::FGetContentDownloadUrlRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetContentDownloadUrlRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("HttpMethod"))
+        {
+            reader.ReadValue(HttpMethod);
+        }
+        else if (reader.IsField("Key"))
+        {
+            reader.ReadValue(Key);
+        }
+        else if (reader.IsField("ThruCDN"))
+        {
+            reader.ReadValue(ThruCDN);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetContentDownloadUrlRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetContentDownloadUrlResult::~FGetContentDownloadUrlResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetContentDownloadUrlResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetContentDownloadUrlResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7869,6 +13142,16 @@ void PlayFab::ServerModels::FGetContentDownloadUrlResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetContentDownloadUrlResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetContentDownloadUrlResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetContentDownloadUrlResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7883,12 +13166,39 @@ bool PlayFab::ServerModels::FGetContentDownloadUrlResult::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetContentDownloadUrlResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("URL"))
+        {
+            reader.ReadValue(URL);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetContentDownloadUrlResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FPlayerProfileViewConstraints::~FPlayerProfileViewConstraints()
 {
 
 }
 
-void PlayFab::ServerModels::FPlayerProfileViewConstraints::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FPlayerProfileViewConstraints::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7946,6 +13256,16 @@ void PlayFab::ServerModels::FPlayerProfileViewConstraints::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FPlayerProfileViewConstraints::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FPlayerProfileViewConstraints::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FPlayerProfileViewConstraints::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8072,13 +13392,104 @@ bool PlayFab::ServerModels::FPlayerProfileViewConstraints::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FPlayerProfileViewConstraints::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ShowAvatarUrl"))
+        {
+            reader.ReadValue(ShowAvatarUrl);
+        }
+        else if (reader.IsField("ShowBannedUntil"))
+        {
+            reader.ReadValue(ShowBannedUntil);
+        }
+        else if (reader.IsField("ShowCampaignAttributions"))
+        {
+            reader.ReadValue(ShowCampaignAttributions);
+        }
+        else if (reader.IsField("ShowContactEmailAddresses"))
+        {
+            reader.ReadValue(ShowContactEmailAddresses);
+        }
+        else if (reader.IsField("ShowCreated"))
+        {
+            reader.ReadValue(ShowCreated);
+        }
+        else if (reader.IsField("ShowDisplayName"))
+        {
+            reader.ReadValue(ShowDisplayName);
+        }
+        else if (reader.IsField("ShowExperimentVariants"))
+        {
+            reader.ReadValue(ShowExperimentVariants);
+        }
+        else if (reader.IsField("ShowLastLogin"))
+        {
+            reader.ReadValue(ShowLastLogin);
+        }
+        else if (reader.IsField("ShowLinkedAccounts"))
+        {
+            reader.ReadValue(ShowLinkedAccounts);
+        }
+        else if (reader.IsField("ShowLocations"))
+        {
+            reader.ReadValue(ShowLocations);
+        }
+        else if (reader.IsField("ShowMemberships"))
+        {
+            reader.ReadValue(ShowMemberships);
+        }
+        else if (reader.IsField("ShowOrigination"))
+        {
+            reader.ReadValue(ShowOrigination);
+        }
+        else if (reader.IsField("ShowPushNotificationRegistrations"))
+        {
+            reader.ReadValue(ShowPushNotificationRegistrations);
+        }
+        else if (reader.IsField("ShowStatistics"))
+        {
+            reader.ReadValue(ShowStatistics);
+        }
+        else if (reader.IsField("ShowTags"))
+        {
+            reader.ReadValue(ShowTags);
+        }
+        else if (reader.IsField("ShowTotalValueToDateInUsd"))
+        {
+            reader.ReadValue(ShowTotalValueToDateInUsd);
+        }
+        else if (reader.IsField("ShowValuesToDate"))
+        {
+            reader.ReadValue(ShowValuesToDate);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerProfileViewConstraints();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetFriendLeaderboardRequest::~FGetFriendLeaderboardRequest()
 {
     //if (ProfileConstraints != nullptr) delete ProfileConstraints;
 
 }
 
-void PlayFab::ServerModels::FGetFriendLeaderboardRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetFriendLeaderboardRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8158,6 +13569,16 @@ void PlayFab::ServerModels::FGetFriendLeaderboardRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetFriendLeaderboardRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetFriendLeaderboardRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetFriendLeaderboardRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8167,7 +13588,7 @@ bool PlayFab::ServerModels::FGetFriendLeaderboardRequest::readFromValue(const TS
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -8202,7 +13623,7 @@ bool PlayFab::ServerModels::FGetFriendLeaderboardRequest::readFromValue(const TS
     const TSharedPtr<FJsonValue> ProfileConstraintsValue = obj->TryGetField(TEXT("ProfileConstraints"));
     if (ProfileConstraintsValue.IsValid() && !ProfileConstraintsValue->IsNull())
     {
-        ProfileConstraints = MakeShareable(new FPlayerProfileViewConstraints(ProfileConstraintsValue->AsObject()));
+        ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>(ProfileConstraintsValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> StartPositionValue = obj->TryGetField(TEXT("StartPosition"));
@@ -8243,13 +13664,88 @@ bool PlayFab::ServerModels::FGetFriendLeaderboardRequest::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetFriendLeaderboardRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("IncludeFacebookFriends"))
+        {
+            reader.ReadValue(IncludeFacebookFriends);
+        }
+        else if (reader.IsField("IncludeSteamFriends"))
+        {
+            reader.ReadValue(IncludeSteamFriends);
+        }
+        else if (reader.IsField("MaxResultsCount"))
+        {
+            reader.ReadValue(MaxResultsCount);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("ProfileConstraints"))
+        {
+            ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>();
+            ProfileConstraints->readFromReader(reader);
+        }
+        else if (reader.IsField("StartPosition"))
+        {
+            reader.ReadValue(StartPosition);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("UseSpecificVersion"))
+        {
+            reader.ReadValue(UseSpecificVersion);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else if (reader.IsField("XboxToken"))
+        {
+            reader.ReadValue(XboxToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetFriendLeaderboardRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetFriendsListRequest::~FGetFriendsListRequest()
 {
     //if (ProfileConstraints != nullptr) delete ProfileConstraints;
 
 }
 
-void PlayFab::ServerModels::FGetFriendsListRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetFriendsListRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8301,6 +13797,16 @@ void PlayFab::ServerModels::FGetFriendsListRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetFriendsListRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetFriendsListRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetFriendsListRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8310,7 +13816,7 @@ bool PlayFab::ServerModels::FGetFriendsListRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -8338,7 +13844,7 @@ bool PlayFab::ServerModels::FGetFriendsListRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonValue> ProfileConstraintsValue = obj->TryGetField(TEXT("ProfileConstraints"));
     if (ProfileConstraintsValue.IsValid() && !ProfileConstraintsValue->IsNull())
     {
-        ProfileConstraints = MakeShareable(new FPlayerProfileViewConstraints(ProfileConstraintsValue->AsObject()));
+        ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>(ProfileConstraintsValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> XboxTokenValue = obj->TryGetField(TEXT("XboxToken"));
@@ -8351,12 +13857,67 @@ bool PlayFab::ServerModels::FGetFriendsListRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetFriendsListRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("IncludeFacebookFriends"))
+        {
+            reader.ReadValue(IncludeFacebookFriends);
+        }
+        else if (reader.IsField("IncludeSteamFriends"))
+        {
+            reader.ReadValue(IncludeSteamFriends);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("ProfileConstraints"))
+        {
+            ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>();
+            ProfileConstraints->readFromReader(reader);
+        }
+        else if (reader.IsField("XboxToken"))
+        {
+            reader.ReadValue(XboxToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetFriendsListRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetFriendsListResult::~FGetFriendsListResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetFriendsListResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetFriendsListResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8369,7 +13930,17 @@ void PlayFab::ServerModels::FGetFriendsListResult::writeJSON(JsonWriter& writer)
     }
 
 
-    writer->WriteObjectEnd();
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::ServerModels::FGetFriendsListResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetFriendsListResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::ServerModels::FGetFriendsListResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -8380,19 +13951,53 @@ bool PlayFab::ServerModels::FGetFriendsListResult::readFromValue(const TSharedPt
     for (int32 Idx = 0; Idx < FriendsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = FriendsArray[Idx];
-        Friends.Add(FFriendInfo(CurrentItem->AsObject()));
+        Friends.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetFriendsListResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Friends"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Friends[Friends.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetFriendsListResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetLeaderboardAroundCharacterRequest::~FGetLeaderboardAroundCharacterRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetLeaderboardAroundCharacterRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetLeaderboardAroundCharacterRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8438,6 +14043,16 @@ void PlayFab::ServerModels::FGetLeaderboardAroundCharacterRequest::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetLeaderboardAroundCharacterRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetLeaderboardAroundCharacterRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetLeaderboardAroundCharacterRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8480,12 +14095,55 @@ bool PlayFab::ServerModels::FGetLeaderboardAroundCharacterRequest::readFromValue
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetLeaderboardAroundCharacterRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CharacterType"))
+        {
+            reader.ReadValue(CharacterType);
+        }
+        else if (reader.IsField("MaxResultsCount"))
+        {
+            reader.ReadValue(MaxResultsCount);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLeaderboardAroundCharacterRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetLeaderboardAroundCharacterResult::~FGetLeaderboardAroundCharacterResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetLeaderboardAroundCharacterResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetLeaderboardAroundCharacterResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8501,6 +14159,16 @@ void PlayFab::ServerModels::FGetLeaderboardAroundCharacterResult::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetLeaderboardAroundCharacterResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetLeaderboardAroundCharacterResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetLeaderboardAroundCharacterResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8509,20 +14177,54 @@ bool PlayFab::ServerModels::FGetLeaderboardAroundCharacterResult::readFromValue(
     for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FCharacterLeaderboardEntry(CurrentItem->AsObject()));
+        Leaderboard.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetLeaderboardAroundCharacterResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Leaderboard"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Leaderboard[Leaderboard.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLeaderboardAroundCharacterResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetLeaderboardAroundUserRequest::~FGetLeaderboardAroundUserRequest()
 {
     //if (ProfileConstraints != nullptr) delete ProfileConstraints;
 
 }
 
-void PlayFab::ServerModels::FGetLeaderboardAroundUserRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetLeaderboardAroundUserRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8581,6 +14283,16 @@ void PlayFab::ServerModels::FGetLeaderboardAroundUserRequest::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetLeaderboardAroundUserRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetLeaderboardAroundUserRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetLeaderboardAroundUserRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8590,7 +14302,7 @@ bool PlayFab::ServerModels::FGetLeaderboardAroundUserRequest::readFromValue(cons
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -8611,7 +14323,7 @@ bool PlayFab::ServerModels::FGetLeaderboardAroundUserRequest::readFromValue(cons
     const TSharedPtr<FJsonValue> ProfileConstraintsValue = obj->TryGetField(TEXT("ProfileConstraints"));
     if (ProfileConstraintsValue.IsValid() && !ProfileConstraintsValue->IsNull())
     {
-        ProfileConstraints = MakeShareable(new FPlayerProfileViewConstraints(ProfileConstraintsValue->AsObject()));
+        ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>(ProfileConstraintsValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> StatisticNameValue = obj->TryGetField(TEXT("StatisticName"));
@@ -8638,13 +14350,72 @@ bool PlayFab::ServerModels::FGetLeaderboardAroundUserRequest::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetLeaderboardAroundUserRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("MaxResultsCount"))
+        {
+            reader.ReadValue(MaxResultsCount);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("ProfileConstraints"))
+        {
+            ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>();
+            ProfileConstraints->readFromReader(reader);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("UseSpecificVersion"))
+        {
+            reader.ReadValue(UseSpecificVersion);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLeaderboardAroundUserRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FPlayerLeaderboardEntry::~FPlayerLeaderboardEntry()
 {
     //if (Profile != nullptr) delete Profile;
 
 }
 
-void PlayFab::ServerModels::FPlayerLeaderboardEntry::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FPlayerLeaderboardEntry::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8675,6 +14446,16 @@ void PlayFab::ServerModels::FPlayerLeaderboardEntry::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FPlayerLeaderboardEntry::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FPlayerLeaderboardEntry::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FPlayerLeaderboardEntry::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8703,7 +14484,7 @@ bool PlayFab::ServerModels::FPlayerLeaderboardEntry::readFromValue(const TShared
     const TSharedPtr<FJsonValue> ProfileValue = obj->TryGetField(TEXT("Profile"));
     if (ProfileValue.IsValid() && !ProfileValue->IsNull())
     {
-        Profile = MakeShareable(new FPlayerProfileModel(ProfileValue->AsObject()));
+        Profile = MakeShared<FPlayerProfileModel>(ProfileValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> StatValueValue = obj->TryGetField(TEXT("StatValue"));
@@ -8716,12 +14497,56 @@ bool PlayFab::ServerModels::FPlayerLeaderboardEntry::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FPlayerLeaderboardEntry::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Position"))
+        {
+            reader.ReadValue(Position);
+        }
+        else if (reader.IsField("Profile"))
+        {
+            Profile = MakeShared<FPlayerProfileModel>();
+            Profile->readFromReader(reader);
+        }
+        else if (reader.IsField("StatValue"))
+        {
+            reader.ReadValue(StatValue);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerLeaderboardEntry();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetLeaderboardAroundUserResult::~FGetLeaderboardAroundUserResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetLeaderboardAroundUserResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetLeaderboardAroundUserResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8746,6 +14571,16 @@ void PlayFab::ServerModels::FGetLeaderboardAroundUserResult::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetLeaderboardAroundUserResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetLeaderboardAroundUserResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetLeaderboardAroundUserResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8754,7 +14589,7 @@ bool PlayFab::ServerModels::FGetLeaderboardAroundUserResult::readFromValue(const
     for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FPlayerLeaderboardEntry(CurrentItem->AsObject()));
+        Leaderboard.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -8773,12 +14608,54 @@ bool PlayFab::ServerModels::FGetLeaderboardAroundUserResult::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetLeaderboardAroundUserResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Leaderboard"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Leaderboard[Leaderboard.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("NextReset"))
+        {
+            reader.ReadValue(NextReset);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLeaderboardAroundUserResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetLeaderboardForUsersCharactersRequest::~FGetLeaderboardForUsersCharactersRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetLeaderboardForUsersCharactersRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetLeaderboardForUsersCharactersRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8808,6 +14685,16 @@ void PlayFab::ServerModels::FGetLeaderboardForUsersCharactersRequest::writeJSON(
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetLeaderboardForUsersCharactersRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetLeaderboardForUsersCharactersRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetLeaderboardForUsersCharactersRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8836,12 +14723,47 @@ bool PlayFab::ServerModels::FGetLeaderboardForUsersCharactersRequest::readFromVa
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetLeaderboardForUsersCharactersRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("MaxResultsCount"))
+        {
+            reader.ReadValue(MaxResultsCount);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLeaderboardForUsersCharactersRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetLeaderboardForUsersCharactersResult::~FGetLeaderboardForUsersCharactersResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetLeaderboardForUsersCharactersResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetLeaderboardForUsersCharactersResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8857,6 +14779,16 @@ void PlayFab::ServerModels::FGetLeaderboardForUsersCharactersResult::writeJSON(J
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetLeaderboardForUsersCharactersResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetLeaderboardForUsersCharactersResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetLeaderboardForUsersCharactersResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8865,20 +14797,54 @@ bool PlayFab::ServerModels::FGetLeaderboardForUsersCharactersResult::readFromVal
     for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FCharacterLeaderboardEntry(CurrentItem->AsObject()));
+        Leaderboard.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetLeaderboardForUsersCharactersResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Leaderboard"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Leaderboard[Leaderboard.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLeaderboardForUsersCharactersResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetLeaderboardRequest::~FGetLeaderboardRequest()
 {
     //if (ProfileConstraints != nullptr) delete ProfileConstraints;
 
 }
 
-void PlayFab::ServerModels::FGetLeaderboardRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetLeaderboardRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8930,6 +14896,16 @@ void PlayFab::ServerModels::FGetLeaderboardRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetLeaderboardRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetLeaderboardRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetLeaderboardRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8939,7 +14915,7 @@ bool PlayFab::ServerModels::FGetLeaderboardRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -8953,7 +14929,7 @@ bool PlayFab::ServerModels::FGetLeaderboardRequest::readFromValue(const TSharedP
     const TSharedPtr<FJsonValue> ProfileConstraintsValue = obj->TryGetField(TEXT("ProfileConstraints"));
     if (ProfileConstraintsValue.IsValid() && !ProfileConstraintsValue->IsNull())
     {
-        ProfileConstraints = MakeShareable(new FPlayerProfileViewConstraints(ProfileConstraintsValue->AsObject()));
+        ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>(ProfileConstraintsValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> StartPositionValue = obj->TryGetField(TEXT("StartPosition"));
@@ -8987,12 +14963,71 @@ bool PlayFab::ServerModels::FGetLeaderboardRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetLeaderboardRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("MaxResultsCount"))
+        {
+            reader.ReadValue(MaxResultsCount);
+        }
+        else if (reader.IsField("ProfileConstraints"))
+        {
+            ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>();
+            ProfileConstraints->readFromReader(reader);
+        }
+        else if (reader.IsField("StartPosition"))
+        {
+            reader.ReadValue(StartPosition);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("UseSpecificVersion"))
+        {
+            reader.ReadValue(UseSpecificVersion);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLeaderboardRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetLeaderboardResult::~FGetLeaderboardResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetLeaderboardResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetLeaderboardResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9017,6 +15052,16 @@ void PlayFab::ServerModels::FGetLeaderboardResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetLeaderboardResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetLeaderboardResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetLeaderboardResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9025,7 +15070,7 @@ bool PlayFab::ServerModels::FGetLeaderboardResult::readFromValue(const TSharedPt
     for (int32 Idx = 0; Idx < LeaderboardArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LeaderboardArray[Idx];
-        Leaderboard.Add(FPlayerLeaderboardEntry(CurrentItem->AsObject()));
+        Leaderboard.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -9044,13 +15089,55 @@ bool PlayFab::ServerModels::FGetLeaderboardResult::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetLeaderboardResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Leaderboard"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Leaderboard[Leaderboard.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("NextReset"))
+        {
+            reader.ReadValue(NextReset);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLeaderboardResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayerCombinedInfoRequestParams::~FGetPlayerCombinedInfoRequestParams()
 {
     //if (ProfileConstraints != nullptr) delete ProfileConstraints;
 
 }
 
-void PlayFab::ServerModels::FGetPlayerCombinedInfoRequestParams::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayerCombinedInfoRequestParams::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9126,7 +15213,17 @@ void PlayFab::ServerModels::FGetPlayerCombinedInfoRequestParams::writeJSON(JsonW
     }
 
 
-    writer->WriteObjectEnd();
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::ServerModels::FGetPlayerCombinedInfoRequestParams::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayerCombinedInfoRequestParams::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::ServerModels::FGetPlayerCombinedInfoRequestParams::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -9208,7 +15305,7 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoRequestParams::readFromValue(c
     const TSharedPtr<FJsonValue> ProfileConstraintsValue = obj->TryGetField(TEXT("ProfileConstraints"));
     if (ProfileConstraintsValue.IsValid() && !ProfileConstraintsValue->IsNull())
     {
-        ProfileConstraints = MakeShareable(new FPlayerProfileViewConstraints(ProfileConstraintsValue->AsObject()));
+        ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>(ProfileConstraintsValue->AsObject());
     }
 
     obj->TryGetStringArrayField(TEXT("TitleDataKeys"), TitleDataKeys);
@@ -9220,12 +15317,124 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoRequestParams::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayerCombinedInfoRequestParams::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GetCharacterInventories"))
+        {
+            reader.ReadValue(GetCharacterInventories);
+        }
+        else if (reader.IsField("GetCharacterList"))
+        {
+            reader.ReadValue(GetCharacterList);
+        }
+        else if (reader.IsField("GetPlayerProfile"))
+        {
+            reader.ReadValue(GetPlayerProfile);
+        }
+        else if (reader.IsField("GetPlayerStatistics"))
+        {
+            reader.ReadValue(GetPlayerStatistics);
+        }
+        else if (reader.IsField("GetTitleData"))
+        {
+            reader.ReadValue(GetTitleData);
+        }
+        else if (reader.IsField("GetUserAccountInfo"))
+        {
+            reader.ReadValue(GetUserAccountInfo);
+        }
+        else if (reader.IsField("GetUserData"))
+        {
+            reader.ReadValue(GetUserData);
+        }
+        else if (reader.IsField("GetUserInventory"))
+        {
+            reader.ReadValue(GetUserInventory);
+        }
+        else if (reader.IsField("GetUserReadOnlyData"))
+        {
+            reader.ReadValue(GetUserReadOnlyData);
+        }
+        else if (reader.IsField("GetUserVirtualCurrency"))
+        {
+            reader.ReadValue(GetUserVirtualCurrency);
+        }
+        else if (reader.IsField("PlayerStatisticNames"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { PlayerStatisticNames.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ProfileConstraints"))
+        {
+            ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>();
+            ProfileConstraints->readFromReader(reader);
+        }
+        else if (reader.IsField("TitleDataKeys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { TitleDataKeys.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("UserDataKeys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { UserDataKeys.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("UserReadOnlyDataKeys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { UserReadOnlyDataKeys.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerCombinedInfoRequestParams();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayerCombinedInfoRequest::~FGetPlayerCombinedInfoRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayerCombinedInfoRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayerCombinedInfoRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9256,6 +15465,16 @@ void PlayFab::ServerModels::FGetPlayerCombinedInfoRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayerCombinedInfoRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayerCombinedInfoRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayerCombinedInfoRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9265,7 +15484,7 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -9285,12 +15504,54 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayerCombinedInfoRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters.readFromReader(reader);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerCombinedInfoRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FStatisticValue::~FStatisticValue()
 {
 
 }
 
-void PlayFab::ServerModels::FStatisticValue::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FStatisticValue::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9309,6 +15570,16 @@ void PlayFab::ServerModels::FStatisticValue::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FStatisticValue::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FStatisticValue::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FStatisticValue::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9337,6 +15608,40 @@ bool PlayFab::ServerModels::FStatisticValue::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FStatisticValue::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStatisticValue();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::~FGetPlayerCombinedInfoResultPayload()
 {
     //if (AccountInfo != nullptr) delete AccountInfo;
@@ -9344,7 +15649,8 @@ PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::~FGetPlayerCombinedI
 
 }
 
-void PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9460,6 +15766,16 @@ void PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9467,14 +15783,14 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     const TSharedPtr<FJsonValue> AccountInfoValue = obj->TryGetField(TEXT("AccountInfo"));
     if (AccountInfoValue.IsValid() && !AccountInfoValue->IsNull())
     {
-        AccountInfo = MakeShareable(new FUserAccountInfo(AccountInfoValue->AsObject()));
+        AccountInfo = MakeShared<FUserAccountInfo>(AccountInfoValue->AsObject());
     }
 
     const TArray<TSharedPtr<FJsonValue>>&CharacterInventoriesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("CharacterInventories"));
     for (int32 Idx = 0; Idx < CharacterInventoriesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = CharacterInventoriesArray[Idx];
-        CharacterInventories.Add(FCharacterInventory(CurrentItem->AsObject()));
+        CharacterInventories.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -9482,21 +15798,21 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     for (int32 Idx = 0; Idx < CharacterListArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = CharacterListArray[Idx];
-        CharacterList.Add(FCharacterResult(CurrentItem->AsObject()));
+        CharacterList.Emplace(CurrentItem->AsObject());
     }
 
 
     const TSharedPtr<FJsonValue> PlayerProfileValue = obj->TryGetField(TEXT("PlayerProfile"));
     if (PlayerProfileValue.IsValid() && !PlayerProfileValue->IsNull())
     {
-        PlayerProfile = MakeShareable(new FPlayerProfileModel(PlayerProfileValue->AsObject()));
+        PlayerProfile = MakeShared<FPlayerProfileModel>(PlayerProfileValue->AsObject());
     }
 
     const TArray<TSharedPtr<FJsonValue>>&PlayerStatisticsArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("PlayerStatistics"));
     for (int32 Idx = 0; Idx < PlayerStatisticsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PlayerStatisticsArray[Idx];
-        PlayerStatistics.Add(FStatisticValue(CurrentItem->AsObject()));
+        PlayerStatistics.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -9505,7 +15821,7 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*TitleDataObject)->Values); It; ++It)
         {
-            TitleData.Add(It.Key(), It.Value()->AsString());
+            TitleData.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -9514,7 +15830,7 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*UserDataObject)->Values); It; ++It)
         {
-            UserData.Add(It.Key(), FUserDataRecord(It.Value()->AsObject()));
+            UserData.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -9529,7 +15845,7 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     for (int32 Idx = 0; Idx < UserInventoryArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = UserInventoryArray[Idx];
-        UserInventory.Add(FItemInstance(CurrentItem->AsObject()));
+        UserInventory.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -9538,7 +15854,7 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*UserReadOnlyDataObject)->Values); It; ++It)
         {
-            UserReadOnlyData.Add(It.Key(), FUserDataRecord(It.Value()->AsObject()));
+            UserReadOnlyData.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -9555,7 +15871,7 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*UserVirtualCurrencyObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            UserVirtualCurrency.Add(It.Key(), TmpValue);
+            UserVirtualCurrency.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -9564,20 +15880,160 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*UserVirtualCurrencyRechargeTimesObject)->Values); It; ++It)
         {
-            UserVirtualCurrencyRechargeTimes.Add(It.Key(), FVirtualCurrencyRechargeTime(It.Value()->AsObject()));
+            UserVirtualCurrencyRechargeTimes.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayerCombinedInfoResultPayload::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AccountInfo"))
+        {
+            AccountInfo = MakeShared<FUserAccountInfo>();
+            AccountInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("CharacterInventories"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { CharacterInventories[CharacterInventories.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("CharacterList"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { CharacterList[CharacterList.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayerProfile"))
+        {
+            PlayerProfile = MakeShared<FPlayerProfileModel>();
+            PlayerProfile->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayerStatistics"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { PlayerStatistics[PlayerStatistics.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("TitleData"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { TitleData.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("UserData"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { UserData.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("UserDataVersion"))
+        {
+            reader.ReadValue(UserDataVersion);
+        }
+        else if (reader.IsField("UserInventory"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { UserInventory[UserInventory.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("UserReadOnlyData"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { UserReadOnlyData.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("UserReadOnlyDataVersion"))
+        {
+            reader.ReadValue(UserReadOnlyDataVersion);
+        }
+        else if (reader.IsField("UserVirtualCurrency"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { UserVirtualCurrency.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("UserVirtualCurrencyRechargeTimes"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { UserVirtualCurrencyRechargeTimes.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerCombinedInfoResultPayload();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayerCombinedInfoResult::~FGetPlayerCombinedInfoResult()
 {
     //if (InfoResultPayload != nullptr) delete InfoResultPayload;
 
 }
 
-void PlayFab::ServerModels::FGetPlayerCombinedInfoResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayerCombinedInfoResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9596,6 +16052,16 @@ void PlayFab::ServerModels::FGetPlayerCombinedInfoResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayerCombinedInfoResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayerCombinedInfoResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayerCombinedInfoResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9603,7 +16069,7 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoResult::readFromValue(const TS
     const TSharedPtr<FJsonValue> InfoResultPayloadValue = obj->TryGetField(TEXT("InfoResultPayload"));
     if (InfoResultPayloadValue.IsValid() && !InfoResultPayloadValue->IsNull())
     {
-        InfoResultPayload = MakeShareable(new FGetPlayerCombinedInfoResultPayload(InfoResultPayloadValue->AsObject()));
+        InfoResultPayload = MakeShared<FGetPlayerCombinedInfoResultPayload>(InfoResultPayloadValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PlayFabIdValue = obj->TryGetField(TEXT("PlayFabId"));
@@ -9616,13 +16082,45 @@ bool PlayFab::ServerModels::FGetPlayerCombinedInfoResult::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayerCombinedInfoResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("InfoResultPayload"))
+        {
+            InfoResultPayload = MakeShared<FGetPlayerCombinedInfoResultPayload>();
+            InfoResultPayload->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerCombinedInfoResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayerProfileRequest::~FGetPlayerProfileRequest()
 {
     //if (ProfileConstraints != nullptr) delete ProfileConstraints;
 
 }
 
-void PlayFab::ServerModels::FGetPlayerProfileRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayerProfileRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9656,6 +16154,16 @@ void PlayFab::ServerModels::FGetPlayerProfileRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayerProfileRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayerProfileRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayerProfileRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9665,7 +16173,7 @@ bool PlayFab::ServerModels::FGetPlayerProfileRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -9679,19 +16187,62 @@ bool PlayFab::ServerModels::FGetPlayerProfileRequest::readFromValue(const TShare
     const TSharedPtr<FJsonValue> ProfileConstraintsValue = obj->TryGetField(TEXT("ProfileConstraints"));
     if (ProfileConstraintsValue.IsValid() && !ProfileConstraintsValue->IsNull())
     {
-        ProfileConstraints = MakeShareable(new FPlayerProfileViewConstraints(ProfileConstraintsValue->AsObject()));
+        ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>(ProfileConstraintsValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayerProfileRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("ProfileConstraints"))
+        {
+            ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>();
+            ProfileConstraints->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerProfileRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayerProfileResult::~FGetPlayerProfileResult()
 {
     //if (PlayerProfile != nullptr) delete PlayerProfile;
 
 }
 
-void PlayFab::ServerModels::FGetPlayerProfileResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayerProfileResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9704,6 +16255,16 @@ void PlayFab::ServerModels::FGetPlayerProfileResult::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayerProfileResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayerProfileResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayerProfileResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9711,18 +16272,46 @@ bool PlayFab::ServerModels::FGetPlayerProfileResult::readFromValue(const TShared
     const TSharedPtr<FJsonValue> PlayerProfileValue = obj->TryGetField(TEXT("PlayerProfile"));
     if (PlayerProfileValue.IsValid() && !PlayerProfileValue->IsNull())
     {
-        PlayerProfile = MakeShareable(new FPlayerProfileModel(PlayerProfileValue->AsObject()));
+        PlayerProfile = MakeShared<FPlayerProfileModel>(PlayerProfileValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayerProfileResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayerProfile"))
+        {
+            PlayerProfile = MakeShared<FPlayerProfileModel>();
+            PlayerProfile->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerProfileResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayerSegmentsResult::~FGetPlayerSegmentsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayerSegmentsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayerSegmentsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9738,6 +16327,16 @@ void PlayFab::ServerModels::FGetPlayerSegmentsResult::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayerSegmentsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayerSegmentsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayerSegmentsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9746,19 +16345,53 @@ bool PlayFab::ServerModels::FGetPlayerSegmentsResult::readFromValue(const TShare
     for (int32 Idx = 0; Idx < SegmentsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = SegmentsArray[Idx];
-        Segments.Add(FGetSegmentResult(CurrentItem->AsObject()));
+        Segments.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayerSegmentsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Segments"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Segments[Segments.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerSegmentsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayersInSegmentRequest::~FGetPlayersInSegmentRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayersInSegmentRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayersInSegmentRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9804,6 +16437,16 @@ void PlayFab::ServerModels::FGetPlayersInSegmentRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayersInSegmentRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayersInSegmentRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayersInSegmentRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9820,7 +16463,7 @@ bool PlayFab::ServerModels::FGetPlayersInSegmentRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -9848,12 +16491,62 @@ bool PlayFab::ServerModels::FGetPlayersInSegmentRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayersInSegmentRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ContinuationToken"))
+        {
+            reader.ReadValue(ContinuationToken);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("MaxBatchSize"))
+        {
+            reader.ReadValue(MaxBatchSize);
+        }
+        else if (reader.IsField("SecondsToLive"))
+        {
+            reader.ReadValue(SecondsToLive);
+        }
+        else if (reader.IsField("SegmentId"))
+        {
+            reader.ReadValue(SegmentId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayersInSegmentRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FPlayerLinkedAccount::~FPlayerLinkedAccount()
 {
 
 }
 
-void PlayFab::ServerModels::FPlayerLinkedAccount::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FPlayerLinkedAccount::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9881,7 +16574,17 @@ void PlayFab::ServerModels::FPlayerLinkedAccount::writeJSON(JsonWriter& writer)
         writer->WriteValue(Username);
     }
 
-    writer->WriteObjectEnd();
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::ServerModels::FPlayerLinkedAccount::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FPlayerLinkedAccount::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::ServerModels::FPlayerLinkedAccount::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -9914,12 +16617,52 @@ bool PlayFab::ServerModels::FPlayerLinkedAccount::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FPlayerLinkedAccount::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Email"))
+        {
+            reader.ReadValue(Email);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Platform = readLoginIdentityProviderFromValue(TmpValue); }
+        }
+        else if (reader.IsField("PlatformUserId"))
+        {
+            reader.ReadValue(PlatformUserId);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerLinkedAccount();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FPlayerLocation::~FPlayerLocation()
 {
 
 }
 
-void PlayFab::ServerModels::FPlayerLocation::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FPlayerLocation::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9950,6 +16693,16 @@ void PlayFab::ServerModels::FPlayerLocation::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FPlayerLocation::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FPlayerLocation::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FPlayerLocation::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9982,12 +16735,57 @@ bool PlayFab::ServerModels::FPlayerLocation::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FPlayerLocation::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("City"))
+        {
+            reader.ReadValue(City);
+        }
+        else if (reader.IsField("ContinentCode"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfContinentCode = readContinentCodeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("CountryCode"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfCountryCode = readCountryCodeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Latitude"))
+        {
+            reader.ReadValue(Latitude);
+        }
+        else if (reader.IsField("Longitude"))
+        {
+            reader.ReadValue(Longitude);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerLocation();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FPlayerStatistic::~FPlayerStatistic()
 {
 
 }
 
-void PlayFab::ServerModels::FPlayerStatistic::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FPlayerStatistic::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10012,6 +16810,16 @@ void PlayFab::ServerModels::FPlayerStatistic::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FPlayerStatistic::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FPlayerStatistic::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FPlayerStatistic::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10047,12 +16855,51 @@ bool PlayFab::ServerModels::FPlayerStatistic::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FPlayerStatistic::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("StatisticValue"))
+        {
+            reader.ReadValue(StatisticValue);
+        }
+        else if (reader.IsField("StatisticVersion"))
+        {
+            reader.ReadValue(StatisticVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerStatistic();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FPushNotificationRegistration::~FPushNotificationRegistration()
 {
 
 }
 
-void PlayFab::ServerModels::FPushNotificationRegistration::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FPushNotificationRegistration::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10071,6 +16918,16 @@ void PlayFab::ServerModels::FPushNotificationRegistration::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FPushNotificationRegistration::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FPushNotificationRegistration::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FPushNotificationRegistration::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10087,12 +16944,44 @@ bool PlayFab::ServerModels::FPushNotificationRegistration::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FPushNotificationRegistration::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("NotificationEndpointARN"))
+        {
+            reader.ReadValue(NotificationEndpointARN);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Platform = readPushNotificationPlatformFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPushNotificationRegistration();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FPlayerProfile::~FPlayerProfile()
 {
 
 }
 
-void PlayFab::ServerModels::FPlayerProfile::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FPlayerProfile::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10266,6 +17155,16 @@ void PlayFab::ServerModels::FPlayerProfile::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FPlayerProfile::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FPlayerProfile::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FPlayerProfile::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10274,7 +17173,7 @@ bool PlayFab::ServerModels::FPlayerProfile::readFromValue(const TSharedPtr<FJson
     for (int32 Idx = 0; Idx < AdCampaignAttributionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = AdCampaignAttributionsArray[Idx];
-        AdCampaignAttributions.Add(FAdCampaignAttribution(CurrentItem->AsObject()));
+        AdCampaignAttributions.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10294,7 +17193,7 @@ bool PlayFab::ServerModels::FPlayerProfile::readFromValue(const TSharedPtr<FJson
     for (int32 Idx = 0; Idx < ContactEmailAddressesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ContactEmailAddressesArray[Idx];
-        ContactEmailAddresses.Add(FContactEmailInfo(CurrentItem->AsObject()));
+        ContactEmailAddresses.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10319,7 +17218,7 @@ bool PlayFab::ServerModels::FPlayerProfile::readFromValue(const TSharedPtr<FJson
     for (int32 Idx = 0; Idx < LinkedAccountsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LinkedAccountsArray[Idx];
-        LinkedAccounts.Add(FPlayerLinkedAccount(CurrentItem->AsObject()));
+        LinkedAccounts.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10328,7 +17227,7 @@ bool PlayFab::ServerModels::FPlayerProfile::readFromValue(const TSharedPtr<FJson
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*LocationsObject)->Values); It; ++It)
         {
-            Locations.Add(It.Key(), FPlayerLocation(It.Value()->AsObject()));
+            Locations.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -10347,7 +17246,7 @@ bool PlayFab::ServerModels::FPlayerProfile::readFromValue(const TSharedPtr<FJson
     for (int32 Idx = 0; Idx < PlayerStatisticsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PlayerStatisticsArray[Idx];
-        PlayerStatistics.Add(FPlayerStatistic(CurrentItem->AsObject()));
+        PlayerStatistics.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10362,7 +17261,7 @@ bool PlayFab::ServerModels::FPlayerProfile::readFromValue(const TSharedPtr<FJson
     for (int32 Idx = 0; Idx < PushNotificationRegistrationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PushNotificationRegistrationsArray[Idx];
-        PushNotificationRegistrations.Add(FPushNotificationRegistration(CurrentItem->AsObject()));
+        PushNotificationRegistrations.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10372,7 +17271,7 @@ bool PlayFab::ServerModels::FPlayerProfile::readFromValue(const TSharedPtr<FJson
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*StatisticsObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            Statistics.Add(It.Key(), TmpValue);
+            Statistics.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -10398,7 +17297,7 @@ bool PlayFab::ServerModels::FPlayerProfile::readFromValue(const TSharedPtr<FJson
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*ValuesToDateObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            ValuesToDate.Add(It.Key(), TmpValue);
+            ValuesToDate.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -10408,19 +17307,204 @@ bool PlayFab::ServerModels::FPlayerProfile::readFromValue(const TSharedPtr<FJson
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyBalancesObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrencyBalances.Add(It.Key(), TmpValue);
+            VirtualCurrencyBalances.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FPlayerProfile::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AdCampaignAttributions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { AdCampaignAttributions[AdCampaignAttributions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("AvatarUrl"))
+        {
+            reader.ReadValue(AvatarUrl);
+        }
+        else if (reader.IsField("BannedUntil"))
+        {
+            reader.ReadValue(BannedUntil);
+        }
+        else if (reader.IsField("ContactEmailAddresses"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ContactEmailAddresses[ContactEmailAddresses.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("LastLogin"))
+        {
+            reader.ReadValue(LastLogin);
+        }
+        else if (reader.IsField("LinkedAccounts"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { LinkedAccounts[LinkedAccounts.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Locations"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { Locations.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Origination"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Origination = readLoginIdentityProviderFromValue(TmpValue); }
+        }
+        else if (reader.IsField("PlayerExperimentVariants"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { PlayerExperimentVariants.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayerId"))
+        {
+            reader.ReadValue(PlayerId);
+        }
+        else if (reader.IsField("PlayerStatistics"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { PlayerStatistics[PlayerStatistics.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("PublisherId"))
+        {
+            reader.ReadValue(PublisherId);
+        }
+        else if (reader.IsField("PushNotificationRegistrations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { PushNotificationRegistrations[PushNotificationRegistrations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Statistics"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Statistics.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Tags.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else if (reader.IsField("TotalValueToDateInUSD"))
+        {
+            reader.ReadValue(TotalValueToDateInUSD);
+        }
+        else if (reader.IsField("ValuesToDate"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ValuesToDate.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyBalances"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrencyBalances.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerProfile();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayersInSegmentResult::~FGetPlayersInSegmentResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayersInSegmentResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayersInSegmentResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10445,6 +17529,16 @@ void PlayFab::ServerModels::FGetPlayersInSegmentResult::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayersInSegmentResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayersInSegmentResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayersInSegmentResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10460,7 +17554,7 @@ bool PlayFab::ServerModels::FGetPlayersInSegmentResult::readFromValue(const TSha
     for (int32 Idx = 0; Idx < PlayerProfilesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PlayerProfilesArray[Idx];
-        PlayerProfiles.Add(FPlayerProfile(CurrentItem->AsObject()));
+        PlayerProfiles.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10474,12 +17568,54 @@ bool PlayFab::ServerModels::FGetPlayersInSegmentResult::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayersInSegmentResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ContinuationToken"))
+        {
+            reader.ReadValue(ContinuationToken);
+        }
+        else if (reader.IsField("PlayerProfiles"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { PlayerProfiles[PlayerProfiles.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("ProfilesInSegment"))
+        {
+            reader.ReadValue(ProfilesInSegment);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayersInSegmentResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayersSegmentsRequest::~FGetPlayersSegmentsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayersSegmentsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayersSegmentsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10507,6 +17643,16 @@ void PlayFab::ServerModels::FGetPlayersSegmentsRequest::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayersSegmentsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayersSegmentsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayersSegmentsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10516,7 +17662,7 @@ bool PlayFab::ServerModels::FGetPlayersSegmentsRequest::readFromValue(const TSha
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -10530,12 +17676,50 @@ bool PlayFab::ServerModels::FGetPlayersSegmentsRequest::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayersSegmentsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayersSegmentsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FStatisticNameVersion::~FStatisticNameVersion()
 {
 
 }
 
-void PlayFab::ServerModels::FStatisticNameVersion::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FStatisticNameVersion::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10555,6 +17739,16 @@ void PlayFab::ServerModels::FStatisticNameVersion::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FStatisticNameVersion::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FStatisticNameVersion::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FStatisticNameVersion::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10576,12 +17770,43 @@ bool PlayFab::ServerModels::FStatisticNameVersion::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FStatisticNameVersion::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStatisticNameVersion();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayerStatisticsRequest::~FGetPlayerStatisticsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayerStatisticsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayerStatisticsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10627,6 +17852,16 @@ void PlayFab::ServerModels::FGetPlayerStatisticsRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayerStatisticsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayerStatisticsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayerStatisticsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10636,7 +17871,7 @@ bool PlayFab::ServerModels::FGetPlayerStatisticsRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -10653,19 +17888,79 @@ bool PlayFab::ServerModels::FGetPlayerStatisticsRequest::readFromValue(const TSh
     for (int32 Idx = 0; Idx < StatisticNameVersionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StatisticNameVersionsArray[Idx];
-        StatisticNameVersions.Add(FStatisticNameVersion(CurrentItem->AsObject()));
+        StatisticNameVersions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayerStatisticsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("StatisticNames"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { StatisticNames.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("StatisticNameVersions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { StatisticNameVersions[StatisticNameVersions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerStatisticsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayerStatisticsResult::~FGetPlayerStatisticsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayerStatisticsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayerStatisticsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10684,7 +17979,17 @@ void PlayFab::ServerModels::FGetPlayerStatisticsResult::writeJSON(JsonWriter& wr
     }
 
 
-    writer->WriteObjectEnd();
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::ServerModels::FGetPlayerStatisticsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayerStatisticsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::ServerModels::FGetPlayerStatisticsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -10702,19 +18007,57 @@ bool PlayFab::ServerModels::FGetPlayerStatisticsResult::readFromValue(const TSha
     for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FStatisticValue(CurrentItem->AsObject()));
+        Statistics.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayerStatisticsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Statistics"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Statistics[Statistics.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerStatisticsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayerStatisticVersionsRequest::~FGetPlayerStatisticVersionsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayerStatisticVersionsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayerStatisticVersionsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10738,6 +18081,16 @@ void PlayFab::ServerModels::FGetPlayerStatisticVersionsRequest::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayerStatisticVersionsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayerStatisticVersionsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayerStatisticVersionsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10747,7 +18100,7 @@ bool PlayFab::ServerModels::FGetPlayerStatisticVersionsRequest::readFromValue(co
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -10761,12 +18114,50 @@ bool PlayFab::ServerModels::FGetPlayerStatisticVersionsRequest::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayerStatisticVersionsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerStatisticVersionsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FPlayerStatisticVersion::~FPlayerStatisticVersion()
 {
 
 }
 
-void PlayFab::ServerModels::FPlayerStatisticVersion::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FPlayerStatisticVersion::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10803,6 +18194,16 @@ void PlayFab::ServerModels::FPlayerStatisticVersion::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FPlayerStatisticVersion::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FPlayerStatisticVersion::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FPlayerStatisticVersion::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10844,12 +18245,59 @@ bool PlayFab::ServerModels::FPlayerStatisticVersion::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FPlayerStatisticVersion::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ActivationTime"))
+        {
+            reader.ReadValue(ActivationTime);
+        }
+        else if (reader.IsField("DeactivationTime"))
+        {
+            reader.ReadValue(DeactivationTime);
+        }
+        else if (reader.IsField("ScheduledActivationTime"))
+        {
+            reader.ReadValue(ScheduledActivationTime);
+        }
+        else if (reader.IsField("ScheduledDeactivationTime"))
+        {
+            reader.ReadValue(ScheduledDeactivationTime);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerStatisticVersion();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayerStatisticVersionsResult::~FGetPlayerStatisticVersionsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayerStatisticVersionsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayerStatisticVersionsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10865,6 +18313,16 @@ void PlayFab::ServerModels::FGetPlayerStatisticVersionsResult::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayerStatisticVersionsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayerStatisticVersionsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayerStatisticVersionsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10873,19 +18331,53 @@ bool PlayFab::ServerModels::FGetPlayerStatisticVersionsResult::readFromValue(con
     for (int32 Idx = 0; Idx < StatisticVersionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StatisticVersionsArray[Idx];
-        StatisticVersions.Add(FPlayerStatisticVersion(CurrentItem->AsObject()));
+        StatisticVersions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayerStatisticVersionsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("StatisticVersions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { StatisticVersions[StatisticVersions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerStatisticVersionsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayerTagsRequest::~FGetPlayerTagsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayerTagsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayerTagsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10919,6 +18411,16 @@ void PlayFab::ServerModels::FGetPlayerTagsRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayerTagsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayerTagsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayerTagsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10928,7 +18430,7 @@ bool PlayFab::ServerModels::FGetPlayerTagsRequest::readFromValue(const TSharedPt
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -10949,12 +18451,54 @@ bool PlayFab::ServerModels::FGetPlayerTagsRequest::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayerTagsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Namespace"))
+        {
+            reader.ReadValue(Namespace);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerTagsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayerTagsResult::~FGetPlayerTagsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayerTagsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayerTagsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10977,6 +18521,16 @@ void PlayFab::ServerModels::FGetPlayerTagsResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayerTagsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayerTagsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayerTagsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10993,12 +18547,50 @@ bool PlayFab::ServerModels::FGetPlayerTagsResult::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayerTagsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Tags.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerTagsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsRequest::~FGetPlayFabIDsFromFacebookIDsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11011,6 +18603,16 @@ void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsRequest::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11020,12 +18622,46 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsRequest::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FacebookIDs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { FacebookIDs.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromFacebookIDsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsResult::~FGetPlayFabIDsFromFacebookIDsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11041,6 +18677,16 @@ void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsResult::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11049,19 +18695,53 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsResult::readFromValue(c
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FFacebookPlayFabIdPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayFabIDsFromFacebookIDsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromFacebookIDsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest::~FGetPlayFabIDsFromFacebookInstantGamesIdsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11074,6 +18754,16 @@ void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest::wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11083,12 +18773,46 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest::re
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FacebookInstantGamesIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { FacebookInstantGamesIds.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromFacebookInstantGamesIdsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::~FGetPlayFabIDsFromFacebookInstantGamesIdsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11104,6 +18828,16 @@ void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11112,19 +18846,53 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::rea
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FFacebookInstantGamesPlayFabIdPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromFacebookInstantGamesIdsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsRequest::~FGetPlayFabIDsFromGenericIDsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11137,6 +18905,16 @@ void PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsRequest::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11145,19 +18923,53 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsRequest::readFromValue(c
     for (int32 Idx = 0; Idx < GenericIDsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GenericIDsArray[Idx];
-        GenericIDs.Add(FGenericServiceId(CurrentItem->AsObject()));
+        GenericIDs.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GenericIDs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GenericIDs[GenericIDs.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromGenericIDsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsResult::~FGetPlayFabIDsFromGenericIDsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11173,6 +18985,16 @@ void PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsResult::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11181,19 +19003,53 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsResult::readFromValue(co
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FGenericPlayFabIdPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayFabIDsFromGenericIDsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromGenericIDsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::~FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11206,6 +19062,16 @@ void PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11215,12 +19081,46 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::re
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("NintendoSwitchDeviceIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { NintendoSwitchDeviceIds.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FNintendoSwitchPlayFabIdPair::~FNintendoSwitchPlayFabIdPair()
 {
 
 }
 
-void PlayFab::ServerModels::FNintendoSwitchPlayFabIdPair::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FNintendoSwitchPlayFabIdPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11239,6 +19139,16 @@ void PlayFab::ServerModels::FNintendoSwitchPlayFabIdPair::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FNintendoSwitchPlayFabIdPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FNintendoSwitchPlayFabIdPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FNintendoSwitchPlayFabIdPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11260,12 +19170,43 @@ bool PlayFab::ServerModels::FNintendoSwitchPlayFabIdPair::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FNintendoSwitchPlayFabIdPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("NintendoSwitchDeviceId"))
+        {
+            reader.ReadValue(NintendoSwitchDeviceId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FNintendoSwitchPlayFabIdPair();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::~FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11281,6 +19222,16 @@ void PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11289,19 +19240,53 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::rea
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FNintendoSwitchPlayFabIdPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsRequest::~FGetPlayFabIDsFromPSNAccountIDsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11320,6 +19305,16 @@ void PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsRequest::writeJSON(Js
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11336,12 +19331,50 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsRequest::readFromValu
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("IssuerId"))
+        {
+            reader.ReadValue(IssuerId);
+        }
+        else if (reader.IsField("PSNAccountIDs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { PSNAccountIDs.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromPSNAccountIDsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FPSNAccountPlayFabIdPair::~FPSNAccountPlayFabIdPair()
 {
 
 }
 
-void PlayFab::ServerModels::FPSNAccountPlayFabIdPair::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FPSNAccountPlayFabIdPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11360,6 +19393,16 @@ void PlayFab::ServerModels::FPSNAccountPlayFabIdPair::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FPSNAccountPlayFabIdPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FPSNAccountPlayFabIdPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FPSNAccountPlayFabIdPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11381,12 +19424,43 @@ bool PlayFab::ServerModels::FPSNAccountPlayFabIdPair::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FPSNAccountPlayFabIdPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("PSNAccountId"))
+        {
+            reader.ReadValue(PSNAccountId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPSNAccountPlayFabIdPair();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult::~FGetPlayFabIDsFromPSNAccountIDsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11402,6 +19476,16 @@ void PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11410,19 +19494,53 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult::readFromValue
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FPSNAccountPlayFabIdPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromPSNAccountIDsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsRequest::~FGetPlayFabIDsFromSteamIDsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11438,6 +19556,16 @@ void PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11447,12 +19575,46 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsRequest::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SteamStringIDs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { SteamStringIDs.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromSteamIDsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSteamPlayFabIdPair::~FSteamPlayFabIdPair()
 {
 
 }
 
-void PlayFab::ServerModels::FSteamPlayFabIdPair::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSteamPlayFabIdPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11471,6 +19633,16 @@ void PlayFab::ServerModels::FSteamPlayFabIdPair::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSteamPlayFabIdPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSteamPlayFabIdPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSteamPlayFabIdPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11492,12 +19664,43 @@ bool PlayFab::ServerModels::FSteamPlayFabIdPair::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSteamPlayFabIdPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("SteamStringId"))
+        {
+            reader.ReadValue(SteamStringId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSteamPlayFabIdPair();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsResult::~FGetPlayFabIDsFromSteamIDsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11513,6 +19716,16 @@ void PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsResult::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11521,19 +19734,53 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsResult::readFromValue(cons
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FSteamPlayFabIdPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayFabIDsFromSteamIDsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromSteamIDsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsRequest::~FGetPlayFabIDsFromXboxLiveIDsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11552,6 +19799,16 @@ void PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsRequest::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11568,12 +19825,50 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsRequest::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Sandbox"))
+        {
+            reader.ReadValue(Sandbox);
+        }
+        else if (reader.IsField("XboxLiveAccountIDs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { XboxLiveAccountIDs.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromXboxLiveIDsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FXboxLiveAccountPlayFabIdPair::~FXboxLiveAccountPlayFabIdPair()
 {
 
 }
 
-void PlayFab::ServerModels::FXboxLiveAccountPlayFabIdPair::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FXboxLiveAccountPlayFabIdPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11592,6 +19887,16 @@ void PlayFab::ServerModels::FXboxLiveAccountPlayFabIdPair::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FXboxLiveAccountPlayFabIdPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FXboxLiveAccountPlayFabIdPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FXboxLiveAccountPlayFabIdPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11613,12 +19918,43 @@ bool PlayFab::ServerModels::FXboxLiveAccountPlayFabIdPair::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FXboxLiveAccountPlayFabIdPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("XboxLiveAccountId"))
+        {
+            reader.ReadValue(XboxLiveAccountId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FXboxLiveAccountPlayFabIdPair();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult::~FGetPlayFabIDsFromXboxLiveIDsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11634,6 +19970,16 @@ void PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11642,19 +19988,53 @@ bool PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult::readFromValue(c
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FXboxLiveAccountPlayFabIdPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayFabIDsFromXboxLiveIDsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPublisherDataRequest::~FGetPublisherDataRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPublisherDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPublisherDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11664,7 +20044,17 @@ void PlayFab::ServerModels::FGetPublisherDataRequest::writeJSON(JsonWriter& writ
     writer->WriteArrayEnd();
 
 
-    writer->WriteObjectEnd();
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::ServerModels::FGetPublisherDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPublisherDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::ServerModels::FGetPublisherDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -11676,12 +20066,46 @@ bool PlayFab::ServerModels::FGetPublisherDataRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPublisherDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Keys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Keys.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPublisherDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetPublisherDataResult::~FGetPublisherDataResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetPublisherDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetPublisherDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11699,6 +20123,16 @@ void PlayFab::ServerModels::FGetPublisherDataResult::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetPublisherDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetPublisherDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetPublisherDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11708,19 +20142,53 @@ bool PlayFab::ServerModels::FGetPublisherDataResult::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetPublisherDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPublisherDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetRandomResultTablesRequest::~FGetRandomResultTablesRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetRandomResultTablesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetRandomResultTablesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11739,6 +20207,16 @@ void PlayFab::ServerModels::FGetRandomResultTablesRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetRandomResultTablesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetRandomResultTablesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetRandomResultTablesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11755,7 +20233,45 @@ bool PlayFab::ServerModels::FGetRandomResultTablesRequest::readFromValue(const T
     return HasSucceeded;
 }
 
-void PlayFab::ServerModels::writeResultTableNodeTypeEnumJSON(ResultTableNodeType enumVal, JsonWriter& writer)
+bool PlayFab::ServerModels::FGetRandomResultTablesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("TableIDs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { TableIDs.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetRandomResultTablesRequest();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeResultTableNodeTypeEnumValue(ServerModels::ResultTableNodeType enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -11765,6 +20281,16 @@ void PlayFab::ServerModels::writeResultTableNodeTypeEnumJSON(ResultTableNodeType
     }
 }
 
+void PlayFab::ServerModels::writeResultTableNodeTypeEnumJSON(ResultTableNodeType enumVal, JsonWriter& writer)
+{
+    writeResultTableNodeTypeEnumValue(enumVal, writer);
+}
+
+void PlayFab::ServerModels::writeResultTableNodeTypeEnumJSON(ResultTableNodeType enumVal, JsonUtf8Writer& writer)
+{
+    writeResultTableNodeTypeEnumValue(enumVal, writer);
+}
+
 ServerModels::ResultTableNodeType PlayFab::ServerModels::readResultTableNodeTypeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readResultTableNodeTypeFromValue(value.IsValid() ? value->AsString() : "");
@@ -11796,7 +20322,8 @@ PlayFab::ServerModels::FResultTableNode::~FResultTableNode()
 
 }
 
-void PlayFab::ServerModels::FResultTableNode::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FResultTableNode::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11819,6 +20346,16 @@ void PlayFab::ServerModels::FResultTableNode::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FResultTableNode::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FResultTableNode::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FResultTableNode::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11842,12 +20379,48 @@ bool PlayFab::ServerModels::FResultTableNode::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FResultTableNode::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ResultItem"))
+        {
+            reader.ReadValue(ResultItem);
+        }
+        else if (reader.IsField("ResultItemType"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { ResultItemType = readResultTableNodeTypeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Weight"))
+        {
+            reader.ReadValue(Weight);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FResultTableNode();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRandomResultTableListing::~FRandomResultTableListing()
 {
 
 }
 
-void PlayFab::ServerModels::FRandomResultTableListing::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRandomResultTableListing::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11876,6 +20449,16 @@ void PlayFab::ServerModels::FRandomResultTableListing::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRandomResultTableListing::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRandomResultTableListing::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRandomResultTableListing::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11891,7 +20474,7 @@ bool PlayFab::ServerModels::FRandomResultTableListing::readFromValue(const TShar
     for (int32 Idx = 0; Idx < NodesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = NodesArray[Idx];
-        Nodes.Add(FResultTableNode(CurrentItem->AsObject()));
+        Nodes.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -11905,12 +20488,54 @@ bool PlayFab::ServerModels::FRandomResultTableListing::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRandomResultTableListing::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("Nodes"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Nodes[Nodes.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("TableId"))
+        {
+            reader.ReadValue(TableId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRandomResultTableListing();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetRandomResultTablesResult::~FGetRandomResultTablesResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetRandomResultTablesResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetRandomResultTablesResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11928,6 +20553,16 @@ void PlayFab::ServerModels::FGetRandomResultTablesResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetRandomResultTablesResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetRandomResultTablesResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetRandomResultTablesResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11937,19 +20572,53 @@ bool PlayFab::ServerModels::FGetRandomResultTablesResult::readFromValue(const TS
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*TablesObject)->Values); It; ++It)
         {
-            Tables.Add(It.Key(), FRandomResultTableListing(It.Value()->AsObject()));
+            Tables.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetRandomResultTablesResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Tables"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { Tables.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetRandomResultTablesResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsRequest::~FGetServerCustomIDsFromPlayFabIDsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11962,6 +20631,16 @@ void PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsRequest::writeJSON(
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11971,12 +20650,46 @@ bool PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsRequest::readFromVa
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabIDs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { PlayFabIDs.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetServerCustomIDsFromPlayFabIDsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FServerCustomIDPlayFabIDPair::~FServerCustomIDPlayFabIDPair()
 {
 
 }
 
-void PlayFab::ServerModels::FServerCustomIDPlayFabIDPair::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FServerCustomIDPlayFabIDPair::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11995,6 +20708,16 @@ void PlayFab::ServerModels::FServerCustomIDPlayFabIDPair::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FServerCustomIDPlayFabIDPair::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FServerCustomIDPlayFabIDPair::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FServerCustomIDPlayFabIDPair::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12016,12 +20739,43 @@ bool PlayFab::ServerModels::FServerCustomIDPlayFabIDPair::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FServerCustomIDPlayFabIDPair::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("ServerCustomId"))
+        {
+            reader.ReadValue(ServerCustomId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FServerCustomIDPlayFabIDPair();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsResult::~FGetServerCustomIDsFromPlayFabIDsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12037,6 +20791,16 @@ void PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsResult::writeJSON(J
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12045,19 +20809,53 @@ bool PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsResult::readFromVal
     for (int32 Idx = 0; Idx < DataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DataArray[Idx];
-        Data.Add(FServerCustomIDPlayFabIDPair(CurrentItem->AsObject()));
+        Data.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetServerCustomIDsFromPlayFabIDsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Data[Data.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetServerCustomIDsFromPlayFabIDsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetSharedGroupDataRequest::~FGetSharedGroupDataRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetSharedGroupDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetSharedGroupDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12089,6 +20887,16 @@ void PlayFab::ServerModels::FGetSharedGroupDataRequest::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetSharedGroupDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetSharedGroupDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetSharedGroupDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12112,12 +20920,54 @@ bool PlayFab::ServerModels::FGetSharedGroupDataRequest::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetSharedGroupDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GetMembers"))
+        {
+            reader.ReadValue(GetMembers);
+        }
+        else if (reader.IsField("Keys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Keys.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("SharedGroupId"))
+        {
+            reader.ReadValue(SharedGroupId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetSharedGroupDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSharedGroupDataRecord::~FSharedGroupDataRecord()
 {
 
 }
 
-void PlayFab::ServerModels::FSharedGroupDataRecord::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSharedGroupDataRecord::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12145,6 +20995,16 @@ void PlayFab::ServerModels::FSharedGroupDataRecord::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSharedGroupDataRecord::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSharedGroupDataRecord::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSharedGroupDataRecord::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12173,12 +21033,52 @@ bool PlayFab::ServerModels::FSharedGroupDataRecord::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSharedGroupDataRecord::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("LastUpdated"))
+        {
+            reader.ReadValue(LastUpdated);
+        }
+        else if (reader.IsField("LastUpdatedBy"))
+        {
+            reader.ReadValue(LastUpdatedBy);
+        }
+        else if (reader.IsField("Permission"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Permission = readUserDataPermissionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSharedGroupDataRecord();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetSharedGroupDataResult::~FGetSharedGroupDataResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetSharedGroupDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetSharedGroupDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12205,6 +21105,16 @@ void PlayFab::ServerModels::FGetSharedGroupDataResult::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetSharedGroupDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetSharedGroupDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetSharedGroupDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12214,7 +21124,7 @@ bool PlayFab::ServerModels::FGetSharedGroupDataResult::readFromValue(const TShar
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), FSharedGroupDataRecord(It.Value()->AsObject()));
+            Data.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -12223,12 +21133,57 @@ bool PlayFab::ServerModels::FGetSharedGroupDataResult::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetSharedGroupDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { Data.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Members"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Members.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetSharedGroupDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FStoreMarketingModel::~FStoreMarketingModel()
 {
 
 }
 
-void PlayFab::ServerModels::FStoreMarketingModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FStoreMarketingModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12253,6 +21208,16 @@ void PlayFab::ServerModels::FStoreMarketingModel::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FStoreMarketingModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FStoreMarketingModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FStoreMarketingModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12280,7 +21245,42 @@ bool PlayFab::ServerModels::FStoreMarketingModel::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
-void PlayFab::ServerModels::writeSourceTypeEnumJSON(SourceType enumVal, JsonWriter& writer)
+bool PlayFab::ServerModels::FStoreMarketingModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("Metadata"))
+        {
+            Metadata.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStoreMarketingModel();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeSourceTypeEnumValue(ServerModels::SourceType enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -12295,6 +21295,16 @@ void PlayFab::ServerModels::writeSourceTypeEnumJSON(SourceType enumVal, JsonWrit
     }
 }
 
+void PlayFab::ServerModels::writeSourceTypeEnumJSON(SourceType enumVal, JsonWriter& writer)
+{
+    writeSourceTypeEnumValue(enumVal, writer);
+}
+
+void PlayFab::ServerModels::writeSourceTypeEnumJSON(SourceType enumVal, JsonUtf8Writer& writer)
+{
+    writeSourceTypeEnumValue(enumVal, writer);
+}
+
 ServerModels::SourceType PlayFab::ServerModels::readSourceTypeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readSourceTypeFromValue(value.IsValid() ? value->AsString() : "");
@@ -12331,7 +21341,8 @@ PlayFab::ServerModels::FStoreItem::~FStoreItem()
 
 }
 
-void PlayFab::ServerModels::FStoreItem::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FStoreItem::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12382,6 +21393,16 @@ void PlayFab::ServerModels::FStoreItem::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FStoreItem::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FStoreItem::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FStoreItem::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12412,7 +21433,7 @@ bool PlayFab::ServerModels::FStoreItem::readFromValue(const TSharedPtr<FJsonObje
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*RealCurrencyPricesObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            RealCurrencyPrices.Add(It.Key(), TmpValue);
+            RealCurrencyPrices.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -12422,20 +21443,77 @@ bool PlayFab::ServerModels::FStoreItem::readFromValue(const TSharedPtr<FJsonObje
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyPricesObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrencyPrices.Add(It.Key(), TmpValue);
+            VirtualCurrencyPrices.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FStoreItem::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomData"))
+        {
+            CustomData.readFromReader(reader);
+        }
+        else if (reader.IsField("DisplayPosition"))
+        {
+            reader.ReadValue(DisplayPosition);
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else if (reader.IsField("RealCurrencyPrices"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { RealCurrencyPrices.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyPrices"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrencyPrices.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStoreItem();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetStoreItemsResult::~FGetStoreItemsResult()
 {
     //if (MarketingData != nullptr) delete MarketingData;
 
 }
 
-void PlayFab::ServerModels::FGetStoreItemsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetStoreItemsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12475,6 +21553,16 @@ void PlayFab::ServerModels::FGetStoreItemsResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetStoreItemsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetStoreItemsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetStoreItemsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12489,7 +21577,7 @@ bool PlayFab::ServerModels::FGetStoreItemsResult::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonValue> MarketingDataValue = obj->TryGetField(TEXT("MarketingData"));
     if (MarketingDataValue.IsValid() && !MarketingDataValue->IsNull())
     {
-        MarketingData = MakeShareable(new FStoreMarketingModel(MarketingDataValue->AsObject()));
+        MarketingData = MakeShared<FStoreMarketingModel>(MarketingDataValue->AsObject());
     }
 
     Source = readSourceTypeFromValue(obj->TryGetField(TEXT("Source")));
@@ -12498,7 +21586,7 @@ bool PlayFab::ServerModels::FGetStoreItemsResult::readFromValue(const TSharedPtr
     for (int32 Idx = 0; Idx < StoreArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StoreArray[Idx];
-        Store.Add(FStoreItem(CurrentItem->AsObject()));
+        Store.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -12512,12 +21600,64 @@ bool PlayFab::ServerModels::FGetStoreItemsResult::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetStoreItemsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("MarketingData"))
+        {
+            MarketingData = MakeShared<FStoreMarketingModel>();
+            MarketingData->readFromReader(reader);
+        }
+        else if (reader.IsField("Source"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Source = readSourceTypeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Store"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Store[Store.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("StoreId"))
+        {
+            reader.ReadValue(StoreId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetStoreItemsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetStoreItemsServerRequest::~FGetStoreItemsServerRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetStoreItemsServerRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetStoreItemsServerRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12557,6 +21697,16 @@ void PlayFab::ServerModels::FGetStoreItemsServerRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetStoreItemsServerRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetStoreItemsServerRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetStoreItemsServerRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12573,7 +21723,7 @@ bool PlayFab::ServerModels::FGetStoreItemsServerRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -12594,18 +21744,74 @@ bool PlayFab::ServerModels::FGetStoreItemsServerRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetStoreItemsServerRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("StoreId"))
+        {
+            reader.ReadValue(StoreId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetStoreItemsServerRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetTimeRequest::~FGetTimeRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetTimeRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetTimeRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetTimeRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetTimeRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetTimeRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12613,12 +21819,34 @@ bool PlayFab::ServerModels::FGetTimeRequest::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetTimeRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTimeRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetTimeResult::~FGetTimeResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetTimeResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetTimeResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12628,6 +21856,16 @@ void PlayFab::ServerModels::FGetTimeResult::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetTimeResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetTimeResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetTimeResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12640,12 +21878,39 @@ bool PlayFab::ServerModels::FGetTimeResult::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetTimeResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Time"))
+        {
+            reader.ReadValue(Time);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTimeResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetTitleDataRequest::~FGetTitleDataRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetTitleDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetTitleDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12667,6 +21932,16 @@ void PlayFab::ServerModels::FGetTitleDataRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetTitleDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetTitleDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetTitleDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12683,12 +21958,50 @@ bool PlayFab::ServerModels::FGetTitleDataRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetTitleDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Keys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Keys.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("OverrideLabel"))
+        {
+            reader.ReadValue(OverrideLabel);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitleDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetTitleDataResult::~FGetTitleDataResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetTitleDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetTitleDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12706,6 +22019,16 @@ void PlayFab::ServerModels::FGetTitleDataResult::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetTitleDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetTitleDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetTitleDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12715,19 +22038,53 @@ bool PlayFab::ServerModels::FGetTitleDataResult::readFromValue(const TSharedPtr<
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetTitleDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitleDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetTitleNewsRequest::~FGetTitleNewsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetTitleNewsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetTitleNewsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12740,6 +22097,16 @@ void PlayFab::ServerModels::FGetTitleNewsRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetTitleNewsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetTitleNewsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetTitleNewsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12754,12 +22121,39 @@ bool PlayFab::ServerModels::FGetTitleNewsRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetTitleNewsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Count"))
+        {
+            reader.ReadValue(Count);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitleNewsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FTitleNewsItem::~FTitleNewsItem()
 {
 
 }
 
-void PlayFab::ServerModels::FTitleNewsItem::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FTitleNewsItem::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12787,6 +22181,16 @@ void PlayFab::ServerModels::FTitleNewsItem::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FTitleNewsItem::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FTitleNewsItem::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FTitleNewsItem::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12810,14 +22214,52 @@ bool PlayFab::ServerModels::FTitleNewsItem::readFromValue(const TSharedPtr<FJson
         Timestamp = readDatetime(TimestampValue);
 
 
-    const TSharedPtr<FJsonValue> TitleValue = obj->TryGetField(TEXT("Title"));
-    if (TitleValue.IsValid() && !TitleValue->IsNull())
+    const TSharedPtr<FJsonValue> TitleValue = obj->TryGetField(TEXT("Title"));
+    if (TitleValue.IsValid() && !TitleValue->IsNull())
+    {
+        FString TmpValue;
+        if (TitleValue->TryGetString(TmpValue)) { Title = TmpValue; }
+    }
+
+    return HasSucceeded;
+}
+
+bool PlayFab::ServerModels::FTitleNewsItem::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Body"))
+        {
+            reader.ReadValue(Body);
+        }
+        else if (reader.IsField("NewsId"))
+        {
+            reader.ReadValue(NewsId);
+        }
+        else if (reader.IsField("Timestamp"))
+        {
+            reader.ReadValue(Timestamp);
+        }
+        else if (reader.IsField("Title"))
+        {
+            reader.ReadValue(Title);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
     {
-        FString TmpValue;
-        if (TitleValue->TryGetString(TmpValue)) { Title = TmpValue; }
+        *this = FTitleNewsItem();
+        return false;
     }
-
-    return HasSucceeded;
+    return true;
 }
 
 PlayFab::ServerModels::FGetTitleNewsResult::~FGetTitleNewsResult()
@@ -12825,7 +22267,8 @@ PlayFab::ServerModels::FGetTitleNewsResult::~FGetTitleNewsResult()
 
 }
 
-void PlayFab::ServerModels::FGetTitleNewsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetTitleNewsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12841,6 +22284,16 @@ void PlayFab::ServerModels::FGetTitleNewsResult::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetTitleNewsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetTitleNewsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetTitleNewsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12849,19 +22302,53 @@ bool PlayFab::ServerModels::FGetTitleNewsResult::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < NewsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = NewsArray[Idx];
-        News.Add(FTitleNewsItem(CurrentItem->AsObject()));
+        News.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetTitleNewsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("News"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { News[News.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitleNewsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetUserAccountInfoRequest::~FGetUserAccountInfoRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetUserAccountInfoRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetUserAccountInfoRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12878,6 +22365,16 @@ void PlayFab::ServerModels::FGetUserAccountInfoRequest::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetUserAccountInfoRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetUserAccountInfoRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetUserAccountInfoRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12892,13 +22389,40 @@ bool PlayFab::ServerModels::FGetUserAccountInfoRequest::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetUserAccountInfoRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetUserAccountInfoRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetUserAccountInfoResult::~FGetUserAccountInfoResult()
 {
     //if (UserInfo != nullptr) delete UserInfo;
 
 }
 
-void PlayFab::ServerModels::FGetUserAccountInfoResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetUserAccountInfoResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12911,6 +22435,16 @@ void PlayFab::ServerModels::FGetUserAccountInfoResult::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetUserAccountInfoResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetUserAccountInfoResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetUserAccountInfoResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12918,18 +22452,46 @@ bool PlayFab::ServerModels::FGetUserAccountInfoResult::readFromValue(const TShar
     const TSharedPtr<FJsonValue> UserInfoValue = obj->TryGetField(TEXT("UserInfo"));
     if (UserInfoValue.IsValid() && !UserInfoValue->IsNull())
     {
-        UserInfo = MakeShareable(new FUserAccountInfo(UserInfoValue->AsObject()));
+        UserInfo = MakeShared<FUserAccountInfo>(UserInfoValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetUserAccountInfoResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("UserInfo"))
+        {
+            UserInfo = MakeShared<FUserAccountInfo>();
+            UserInfo->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetUserAccountInfoResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetUserBansRequest::~FGetUserBansRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetUserBansRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetUserBansRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12946,6 +22508,16 @@ void PlayFab::ServerModels::FGetUserBansRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetUserBansRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetUserBansRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetUserBansRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12960,12 +22532,39 @@ bool PlayFab::ServerModels::FGetUserBansRequest::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetUserBansRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetUserBansRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetUserBansResult::~FGetUserBansResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetUserBansResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetUserBansResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12981,6 +22580,16 @@ void PlayFab::ServerModels::FGetUserBansResult::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetUserBansResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetUserBansResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetUserBansResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12989,19 +22598,53 @@ bool PlayFab::ServerModels::FGetUserBansResult::readFromValue(const TSharedPtr<F
     for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
+        BanData.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetUserBansResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BanData"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { BanData[BanData.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetUserBansResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetUserDataRequest::~FGetUserDataRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetUserDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetUserDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13033,6 +22676,16 @@ void PlayFab::ServerModels::FGetUserDataRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetUserDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetUserDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetUserDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13056,12 +22709,54 @@ bool PlayFab::ServerModels::FGetUserDataRequest::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetUserDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("IfChangedFromDataVersion"))
+        {
+            reader.ReadValue(IfChangedFromDataVersion);
+        }
+        else if (reader.IsField("Keys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Keys.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetUserDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetUserDataResult::~FGetUserDataResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetUserDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetUserDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13088,6 +22783,16 @@ void PlayFab::ServerModels::FGetUserDataResult::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetUserDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetUserDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetUserDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13097,7 +22802,7 @@ bool PlayFab::ServerModels::FGetUserDataResult::readFromValue(const TSharedPtr<F
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), FUserDataRecord(It.Value()->AsObject()));
+            Data.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -13118,12 +22823,54 @@ bool PlayFab::ServerModels::FGetUserDataResult::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetUserDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { Data.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("DataVersion"))
+        {
+            reader.ReadValue(DataVersion);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetUserDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetUserInventoryRequest::~FGetUserInventoryRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGetUserInventoryRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetUserInventoryRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13151,6 +22898,16 @@ void PlayFab::ServerModels::FGetUserInventoryRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetUserInventoryRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetUserInventoryRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetUserInventoryRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13160,7 +22917,7 @@ bool PlayFab::ServerModels::FGetUserInventoryRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -13174,12 +22931,50 @@ bool PlayFab::ServerModels::FGetUserInventoryRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetUserInventoryRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetUserInventoryRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGetUserInventoryResult::~FGetUserInventoryResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGetUserInventoryResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGetUserInventoryResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13223,6 +23018,16 @@ void PlayFab::ServerModels::FGetUserInventoryResult::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGetUserInventoryResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGetUserInventoryResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGetUserInventoryResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13231,7 +23036,7 @@ bool PlayFab::ServerModels::FGetUserInventoryResult::readFromValue(const TShared
     for (int32 Idx = 0; Idx < InventoryArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = InventoryArray[Idx];
-        Inventory.Add(FItemInstance(CurrentItem->AsObject()));
+        Inventory.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -13248,7 +23053,7 @@ bool PlayFab::ServerModels::FGetUserInventoryResult::readFromValue(const TShared
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrency.Add(It.Key(), TmpValue);
+            VirtualCurrency.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -13257,19 +23062,79 @@ bool PlayFab::ServerModels::FGetUserInventoryResult::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyRechargeTimesObject)->Values); It; ++It)
         {
-            VirtualCurrencyRechargeTimes.Add(It.Key(), FVirtualCurrencyRechargeTime(It.Value()->AsObject()));
+            VirtualCurrencyRechargeTimes.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGetUserInventoryResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Inventory"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Inventory[Inventory.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrency.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyRechargeTimes"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { VirtualCurrencyRechargeTimes.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetUserInventoryResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGrantCharacterToUserRequest::~FGrantCharacterToUserRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGrantCharacterToUserRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGrantCharacterToUserRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13317,6 +23182,16 @@ void PlayFab::ServerModels::FGrantCharacterToUserRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGrantCharacterToUserRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGrantCharacterToUserRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGrantCharacterToUserRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13340,7 +23215,7 @@ bool PlayFab::ServerModels::FGrantCharacterToUserRequest::readFromValue(const TS
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -13354,12 +23229,58 @@ bool PlayFab::ServerModels::FGrantCharacterToUserRequest::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGrantCharacterToUserRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterName"))
+        {
+            reader.ReadValue(CharacterName);
+        }
+        else if (reader.IsField("CharacterType"))
+        {
+            reader.ReadValue(CharacterType);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGrantCharacterToUserRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGrantCharacterToUserResult::~FGrantCharacterToUserResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGrantCharacterToUserResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGrantCharacterToUserResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13372,6 +23293,16 @@ void PlayFab::ServerModels::FGrantCharacterToUserResult::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGrantCharacterToUserResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGrantCharacterToUserResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGrantCharacterToUserResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13386,12 +23317,39 @@ bool PlayFab::ServerModels::FGrantCharacterToUserResult::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGrantCharacterToUserResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGrantCharacterToUserResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGrantedItemInstance::~FGrantedItemInstance()
 {
 
 }
 
-void PlayFab::ServerModels::FGrantedItemInstance::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGrantedItemInstance::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13505,7 +23463,17 @@ void PlayFab::ServerModels::FGrantedItemInstance::writeJSON(JsonWriter& writer)
         writer->WriteValue(UsesIncrementedBy);
     }
 
-    writer->WriteObjectEnd();
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::ServerModels::FGrantedItemInstance::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGrantedItemInstance::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::ServerModels::FGrantedItemInstance::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -13547,7 +23515,7 @@ bool PlayFab::ServerModels::FGrantedItemInstance::readFromValue(const TSharedPtr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomDataObject)->Values); It; ++It)
         {
-            CustomData.Add(It.Key(), It.Value()->AsString());
+            CustomData.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -13634,12 +23602,121 @@ bool PlayFab::ServerModels::FGrantedItemInstance::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGrantedItemInstance::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Annotation"))
+        {
+            reader.ReadValue(Annotation);
+        }
+        else if (reader.IsField("BundleContents"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { BundleContents.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("BundleParent"))
+        {
+            reader.ReadValue(BundleParent);
+        }
+        else if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CustomData"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomData.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("Expiration"))
+        {
+            reader.ReadValue(Expiration);
+        }
+        else if (reader.IsField("ItemClass"))
+        {
+            reader.ReadValue(ItemClass);
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("PurchaseDate"))
+        {
+            reader.ReadValue(PurchaseDate);
+        }
+        else if (reader.IsField("RemainingUses"))
+        {
+            reader.ReadValue(RemainingUses);
+        }
+        else if (reader.IsField("Result"))
+        {
+            reader.ReadValue(Result);
+        }
+        else if (reader.IsField("UnitCurrency"))
+        {
+            reader.ReadValue(UnitCurrency);
+        }
+        else if (reader.IsField("UnitPrice"))
+        {
+            reader.ReadValue(UnitPrice);
+        }
+        else if (reader.IsField("UsesIncrementedBy"))
+        {
+            reader.ReadValue(UsesIncrementedBy);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGrantedItemInstance();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGrantItemsToCharacterRequest::~FGrantItemsToCharacterRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGrantItemsToCharacterRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGrantItemsToCharacterRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13698,6 +23775,16 @@ void PlayFab::ServerModels::FGrantItemsToCharacterRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGrantItemsToCharacterRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGrantItemsToCharacterRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGrantItemsToCharacterRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13728,7 +23815,7 @@ bool PlayFab::ServerModels::FGrantItemsToCharacterRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -13744,12 +23831,73 @@ bool PlayFab::ServerModels::FGrantItemsToCharacterRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGrantItemsToCharacterRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Annotation"))
+        {
+            reader.ReadValue(Annotation);
+        }
+        else if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ItemIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ItemIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGrantItemsToCharacterRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGrantItemsToCharacterResult::~FGrantItemsToCharacterResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGrantItemsToCharacterResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGrantItemsToCharacterResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13765,6 +23913,16 @@ void PlayFab::ServerModels::FGrantItemsToCharacterResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGrantItemsToCharacterResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGrantItemsToCharacterResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGrantItemsToCharacterResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13773,19 +23931,53 @@ bool PlayFab::ServerModels::FGrantItemsToCharacterResult::readFromValue(const TS
     for (int32 Idx = 0; Idx < ItemGrantResultsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ItemGrantResultsArray[Idx];
-        ItemGrantResults.Add(FGrantedItemInstance(CurrentItem->AsObject()));
+        ItemGrantResults.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGrantItemsToCharacterResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ItemGrantResults"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ItemGrantResults[ItemGrantResults.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGrantItemsToCharacterResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGrantItemsToUserRequest::~FGrantItemsToUserRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGrantItemsToUserRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGrantItemsToUserRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13831,6 +24023,16 @@ void PlayFab::ServerModels::FGrantItemsToUserRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGrantItemsToUserRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGrantItemsToUserRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGrantItemsToUserRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13854,7 +24056,7 @@ bool PlayFab::ServerModels::FGrantItemsToUserRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -13870,12 +24072,69 @@ bool PlayFab::ServerModels::FGrantItemsToUserRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGrantItemsToUserRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Annotation"))
+        {
+            reader.ReadValue(Annotation);
+        }
+        else if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ItemIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ItemIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGrantItemsToUserRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGrantItemsToUserResult::~FGrantItemsToUserResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGrantItemsToUserResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGrantItemsToUserResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13891,6 +24150,16 @@ void PlayFab::ServerModels::FGrantItemsToUserResult::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGrantItemsToUserResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGrantItemsToUserResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGrantItemsToUserResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13899,19 +24168,53 @@ bool PlayFab::ServerModels::FGrantItemsToUserResult::readFromValue(const TShared
     for (int32 Idx = 0; Idx < ItemGrantResultsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ItemGrantResultsArray[Idx];
-        ItemGrantResults.Add(FGrantedItemInstance(CurrentItem->AsObject()));
+        ItemGrantResults.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGrantItemsToUserResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ItemGrantResults"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ItemGrantResults[ItemGrantResults.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGrantItemsToUserResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FItemGrant::~FItemGrant()
 {
 
 }
 
-void PlayFab::ServerModels::FItemGrant::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FItemGrant::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13970,6 +24273,16 @@ void PlayFab::ServerModels::FItemGrant::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FItemGrant::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FItemGrant::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FItemGrant::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13993,7 +24306,7 @@ bool PlayFab::ServerModels::FItemGrant::readFromValue(const TSharedPtr<FJsonObje
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -14016,12 +24329,73 @@ bool PlayFab::ServerModels::FItemGrant::readFromValue(const TSharedPtr<FJsonObje
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FItemGrant::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Annotation"))
+        {
+            reader.ReadValue(Annotation);
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else if (reader.IsField("KeysToRemove"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { KeysToRemove.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FItemGrant();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGrantItemsToUsersRequest::~FGrantItemsToUsersRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FGrantItemsToUsersRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGrantItemsToUsersRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14051,6 +24425,16 @@ void PlayFab::ServerModels::FGrantItemsToUsersRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGrantItemsToUsersRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGrantItemsToUsersRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGrantItemsToUsersRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14067,7 +24451,7 @@ bool PlayFab::ServerModels::FGrantItemsToUsersRequest::readFromValue(const TShar
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -14075,19 +24459,68 @@ bool PlayFab::ServerModels::FGrantItemsToUsersRequest::readFromValue(const TShar
     for (int32 Idx = 0; Idx < ItemGrantsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ItemGrantsArray[Idx];
-        ItemGrants.Add(FItemGrant(CurrentItem->AsObject()));
+        ItemGrants.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGrantItemsToUsersRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ItemGrants"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ItemGrants[ItemGrants.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGrantItemsToUsersRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FGrantItemsToUsersResult::~FGrantItemsToUsersResult()
 {
 
 }
 
-void PlayFab::ServerModels::FGrantItemsToUsersResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FGrantItemsToUsersResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14103,6 +24536,16 @@ void PlayFab::ServerModels::FGrantItemsToUsersResult::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FGrantItemsToUsersResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FGrantItemsToUsersResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FGrantItemsToUsersResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14111,19 +24554,53 @@ bool PlayFab::ServerModels::FGrantItemsToUsersResult::readFromValue(const TShare
     for (int32 Idx = 0; Idx < ItemGrantResultsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ItemGrantResultsArray[Idx];
-        ItemGrantResults.Add(FGrantedItemInstance(CurrentItem->AsObject()));
+        ItemGrantResults.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FGrantItemsToUsersResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ItemGrantResults"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ItemGrantResults[ItemGrantResults.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGrantItemsToUsersResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FLinkPSNAccountRequest::~FLinkPSNAccountRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FLinkPSNAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FLinkPSNAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14183,6 +24660,16 @@ void PlayFab::ServerModels::FLinkPSNAccountRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FLinkPSNAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FLinkPSNAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FLinkPSNAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14199,7 +24686,7 @@ bool PlayFab::ServerModels::FLinkPSNAccountRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -14224,14 +24711,67 @@ bool PlayFab::ServerModels::FLinkPSNAccountRequest::readFromValue(const TSharedP
         if (PlayFabIdValue->TryGetString(TmpValue)) { PlayFabId = TmpValue; }
     }
 
-    const TSharedPtr<FJsonValue> RedirectUriValue = obj->TryGetField(TEXT("RedirectUri"));
-    if (RedirectUriValue.IsValid() && !RedirectUriValue->IsNull())
+    const TSharedPtr<FJsonValue> RedirectUriValue = obj->TryGetField(TEXT("RedirectUri"));
+    if (RedirectUriValue.IsValid() && !RedirectUriValue->IsNull())
+    {
+        FString TmpValue;
+        if (RedirectUriValue->TryGetString(TmpValue)) { RedirectUri = TmpValue; }
+    }
+
+    return HasSucceeded;
+}
+
+bool PlayFab::ServerModels::FLinkPSNAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AuthCode"))
+        {
+            reader.ReadValue(AuthCode);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else if (reader.IsField("IssuerId"))
+        {
+            reader.ReadValue(IssuerId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("RedirectUri"))
+        {
+            reader.ReadValue(RedirectUri);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
     {
-        FString TmpValue;
-        if (RedirectUriValue->TryGetString(TmpValue)) { RedirectUri = TmpValue; }
+        *this = FLinkPSNAccountRequest();
+        return false;
     }
-
-    return HasSucceeded;
+    return true;
 }
 
 PlayFab::ServerModels::FLinkPSNAccountResult::~FLinkPSNAccountResult()
@@ -14239,13 +24779,24 @@ PlayFab::ServerModels::FLinkPSNAccountResult::~FLinkPSNAccountResult()
 
 }
 
-void PlayFab::ServerModels::FLinkPSNAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FLinkPSNAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FLinkPSNAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FLinkPSNAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FLinkPSNAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14253,12 +24804,34 @@ bool PlayFab::ServerModels::FLinkPSNAccountResult::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FLinkPSNAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkPSNAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FLinkServerCustomIdRequest::~FLinkServerCustomIdRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FLinkServerCustomIdRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FLinkServerCustomIdRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14302,6 +24875,16 @@ void PlayFab::ServerModels::FLinkServerCustomIdRequest::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FLinkServerCustomIdRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FLinkServerCustomIdRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FLinkServerCustomIdRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14311,7 +24894,7 @@ bool PlayFab::ServerModels::FLinkServerCustomIdRequest::readFromValue(const TSha
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -14339,18 +24922,74 @@ bool PlayFab::ServerModels::FLinkServerCustomIdRequest::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FLinkServerCustomIdRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("ServerCustomId"))
+        {
+            reader.ReadValue(ServerCustomId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkServerCustomIdRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FLinkServerCustomIdResult::~FLinkServerCustomIdResult()
 {
 
 }
 
-void PlayFab::ServerModels::FLinkServerCustomIdResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FLinkServerCustomIdResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FLinkServerCustomIdResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FLinkServerCustomIdResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FLinkServerCustomIdResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14358,12 +24997,34 @@ bool PlayFab::ServerModels::FLinkServerCustomIdResult::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FLinkServerCustomIdResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkServerCustomIdResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FLinkXboxAccountRequest::~FLinkXboxAccountRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FLinkXboxAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FLinkXboxAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14407,6 +25068,16 @@ void PlayFab::ServerModels::FLinkXboxAccountRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FLinkXboxAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FLinkXboxAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FLinkXboxAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14416,7 +25087,7 @@ bool PlayFab::ServerModels::FLinkXboxAccountRequest::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -14444,18 +25115,74 @@ bool PlayFab::ServerModels::FLinkXboxAccountRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FLinkXboxAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ForceLink"))
+        {
+            reader.ReadValue(ForceLink);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("XboxToken"))
+        {
+            reader.ReadValue(XboxToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkXboxAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FLinkXboxAccountResult::~FLinkXboxAccountResult()
 {
 
 }
 
-void PlayFab::ServerModels::FLinkXboxAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FLinkXboxAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FLinkXboxAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FLinkXboxAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FLinkXboxAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14463,12 +25190,34 @@ bool PlayFab::ServerModels::FLinkXboxAccountResult::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FLinkXboxAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkXboxAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FListUsersCharactersRequest::~FListUsersCharactersRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FListUsersCharactersRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FListUsersCharactersRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14485,6 +25234,16 @@ void PlayFab::ServerModels::FListUsersCharactersRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FListUsersCharactersRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FListUsersCharactersRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FListUsersCharactersRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14499,12 +25258,39 @@ bool PlayFab::ServerModels::FListUsersCharactersRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FListUsersCharactersRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListUsersCharactersRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FListUsersCharactersResult::~FListUsersCharactersResult()
 {
 
 }
 
-void PlayFab::ServerModels::FListUsersCharactersResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FListUsersCharactersResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14520,6 +25306,16 @@ void PlayFab::ServerModels::FListUsersCharactersResult::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FListUsersCharactersResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FListUsersCharactersResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FListUsersCharactersResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14528,19 +25324,53 @@ bool PlayFab::ServerModels::FListUsersCharactersResult::readFromValue(const TSha
     for (int32 Idx = 0; Idx < CharactersArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = CharactersArray[Idx];
-        Characters.Add(FCharacterResult(CurrentItem->AsObject()));
+        Characters.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FListUsersCharactersResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Characters"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Characters[Characters.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListUsersCharactersResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FLocalizedPushNotificationProperties::~FLocalizedPushNotificationProperties()
 {
 
 }
 
-void PlayFab::ServerModels::FLocalizedPushNotificationProperties::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FLocalizedPushNotificationProperties::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14559,6 +25389,16 @@ void PlayFab::ServerModels::FLocalizedPushNotificationProperties::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FLocalizedPushNotificationProperties::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FLocalizedPushNotificationProperties::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FLocalizedPushNotificationProperties::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14580,13 +25420,44 @@ bool PlayFab::ServerModels::FLocalizedPushNotificationProperties::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FLocalizedPushNotificationProperties::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Message"))
+        {
+            reader.ReadValue(Message);
+        }
+        else if (reader.IsField("Subject"))
+        {
+            reader.ReadValue(Subject);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLocalizedPushNotificationProperties();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FLoginWithServerCustomIdRequest::~FLoginWithServerCustomIdRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ServerModels::FLoginWithServerCustomIdRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FLoginWithServerCustomIdRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14628,6 +25499,16 @@ void PlayFab::ServerModels::FLoginWithServerCustomIdRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FLoginWithServerCustomIdRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FLoginWithServerCustomIdRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FLoginWithServerCustomIdRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14644,14 +25525,14 @@ bool PlayFab::ServerModels::FLoginWithServerCustomIdRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PlayerSecretValue = obj->TryGetField(TEXT("PlayerSecret"));
@@ -14671,13 +25552,64 @@ bool PlayFab::ServerModels::FLoginWithServerCustomIdRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FLoginWithServerCustomIdRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("ServerCustomId"))
+        {
+            reader.ReadValue(ServerCustomId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithServerCustomIdRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FLoginWithSteamIdRequest::~FLoginWithSteamIdRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ServerModels::FLoginWithSteamIdRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FLoginWithSteamIdRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14717,6 +25649,16 @@ void PlayFab::ServerModels::FLoginWithSteamIdRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FLoginWithSteamIdRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FLoginWithSteamIdRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FLoginWithSteamIdRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14733,14 +25675,14 @@ bool PlayFab::ServerModels::FLoginWithSteamIdRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> SteamIdValue = obj->TryGetField(TEXT("SteamId"));
@@ -14753,13 +25695,60 @@ bool PlayFab::ServerModels::FLoginWithSteamIdRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FLoginWithSteamIdRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("SteamId"))
+        {
+            reader.ReadValue(SteamId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithSteamIdRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FLoginWithXboxIdRequest::~FLoginWithXboxIdRequest()
 {
     //if (InfoRequestParameters != nullptr) delete InfoRequestParameters;
 
 }
 
-void PlayFab::ServerModels::FLoginWithXboxIdRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FLoginWithXboxIdRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14809,6 +25798,16 @@ void PlayFab::ServerModels::FLoginWithXboxIdRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FLoginWithXboxIdRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FLoginWithXboxIdRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FLoginWithXboxIdRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14825,14 +25824,14 @@ bool PlayFab::ServerModels::FLoginWithXboxIdRequest::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> SandboxValue = obj->TryGetField(TEXT("Sandbox"));
@@ -14842,14 +25841,64 @@ bool PlayFab::ServerModels::FLoginWithXboxIdRequest::readFromValue(const TShared
         if (SandboxValue->TryGetString(TmpValue)) { Sandbox = TmpValue; }
     }
 
-    const TSharedPtr<FJsonValue> XboxIdValue = obj->TryGetField(TEXT("XboxId"));
-    if (XboxIdValue.IsValid() && !XboxIdValue->IsNull())
+    const TSharedPtr<FJsonValue> XboxIdValue = obj->TryGetField(TEXT("XboxId"));
+    if (XboxIdValue.IsValid() && !XboxIdValue->IsNull())
+    {
+        FString TmpValue;
+        if (XboxIdValue->TryGetString(TmpValue)) { XboxId = TmpValue; }
+    }
+
+    return HasSucceeded;
+}
+
+bool PlayFab::ServerModels::FLoginWithXboxIdRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("Sandbox"))
+        {
+            reader.ReadValue(Sandbox);
+        }
+        else if (reader.IsField("XboxId"))
+        {
+            reader.ReadValue(XboxId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
     {
-        FString TmpValue;
-        if (XboxIdValue->TryGetString(TmpValue)) { XboxId = TmpValue; }
+        *this = FLoginWithXboxIdRequest();
+        return false;
     }
-
-    return HasSucceeded;
+    return true;
 }
 
 PlayFab::ServerModels::FLoginWithXboxRequest::~FLoginWithXboxRequest()
@@ -14858,7 +25907,8 @@ PlayFab::ServerModels::FLoginWithXboxRequest::~FLoginWithXboxRequest()
 
 }
 
-void PlayFab::ServerModels::FLoginWithXboxRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FLoginWithXboxRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14898,6 +25948,16 @@ void PlayFab::ServerModels::FLoginWithXboxRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FLoginWithXboxRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FLoginWithXboxRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FLoginWithXboxRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14914,14 +25974,14 @@ bool PlayFab::ServerModels::FLoginWithXboxRequest::readFromValue(const TSharedPt
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> InfoRequestParametersValue = obj->TryGetField(TEXT("InfoRequestParameters"));
     if (InfoRequestParametersValue.IsValid() && !InfoRequestParametersValue->IsNull())
     {
-        InfoRequestParameters = MakeShareable(new FGetPlayerCombinedInfoRequestParams(InfoRequestParametersValue->AsObject()));
+        InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>(InfoRequestParametersValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> XboxTokenValue = obj->TryGetField(TEXT("XboxToken"));
@@ -14934,12 +25994,59 @@ bool PlayFab::ServerModels::FLoginWithXboxRequest::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FLoginWithXboxRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CreateAccount"))
+        {
+            reader.ReadValue(CreateAccount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("InfoRequestParameters"))
+        {
+            InfoRequestParameters = MakeShared<FGetPlayerCombinedInfoRequestParams>();
+            InfoRequestParameters->readFromReader(reader);
+        }
+        else if (reader.IsField("XboxToken"))
+        {
+            reader.ReadValue(XboxToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLoginWithXboxRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FModifyCharacterVirtualCurrencyResult::~FModifyCharacterVirtualCurrencyResult()
 {
 
 }
 
-void PlayFab::ServerModels::FModifyCharacterVirtualCurrencyResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FModifyCharacterVirtualCurrencyResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14955,6 +26062,16 @@ void PlayFab::ServerModels::FModifyCharacterVirtualCurrencyResult::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FModifyCharacterVirtualCurrencyResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FModifyCharacterVirtualCurrencyResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FModifyCharacterVirtualCurrencyResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14976,12 +26093,43 @@ bool PlayFab::ServerModels::FModifyCharacterVirtualCurrencyResult::readFromValue
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FModifyCharacterVirtualCurrencyResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Balance"))
+        {
+            reader.ReadValue(Balance);
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            reader.ReadValue(VirtualCurrency);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FModifyCharacterVirtualCurrencyResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FModifyItemUsesRequest::~FModifyItemUsesRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FModifyItemUsesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FModifyItemUsesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15022,6 +26170,16 @@ void PlayFab::ServerModels::FModifyItemUsesRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FModifyItemUsesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FModifyItemUsesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FModifyItemUsesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15031,7 +26189,7 @@ bool PlayFab::ServerModels::FModifyItemUsesRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -15059,12 +26217,58 @@ bool PlayFab::ServerModels::FModifyItemUsesRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FModifyItemUsesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("UsesToAdd"))
+        {
+            reader.ReadValue(UsesToAdd);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FModifyItemUsesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FModifyItemUsesResult::~FModifyItemUsesResult()
 {
 
 }
 
-void PlayFab::ServerModels::FModifyItemUsesResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FModifyItemUsesResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15080,6 +26284,16 @@ void PlayFab::ServerModels::FModifyItemUsesResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FModifyItemUsesResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FModifyItemUsesResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FModifyItemUsesResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15101,12 +26315,43 @@ bool PlayFab::ServerModels::FModifyItemUsesResult::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FModifyItemUsesResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("RemainingUses"))
+        {
+            reader.ReadValue(RemainingUses);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FModifyItemUsesResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FModifyUserVirtualCurrencyResult::~FModifyUserVirtualCurrencyResult()
 {
 
 }
 
-void PlayFab::ServerModels::FModifyUserVirtualCurrencyResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FModifyUserVirtualCurrencyResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15131,6 +26376,16 @@ void PlayFab::ServerModels::FModifyUserVirtualCurrencyResult::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FModifyUserVirtualCurrencyResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FModifyUserVirtualCurrencyResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FModifyUserVirtualCurrencyResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15166,12 +26421,51 @@ bool PlayFab::ServerModels::FModifyUserVirtualCurrencyResult::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FModifyUserVirtualCurrencyResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Balance"))
+        {
+            reader.ReadValue(Balance);
+        }
+        else if (reader.IsField("BalanceChange"))
+        {
+            reader.ReadValue(BalanceChange);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            reader.ReadValue(VirtualCurrency);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FModifyUserVirtualCurrencyResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FMoveItemToCharacterFromCharacterRequest::~FMoveItemToCharacterFromCharacterRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FMoveItemToCharacterFromCharacterRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FMoveItemToCharacterFromCharacterRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15218,6 +26512,16 @@ void PlayFab::ServerModels::FMoveItemToCharacterFromCharacterRequest::writeJSON(
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FMoveItemToCharacterFromCharacterRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FMoveItemToCharacterFromCharacterRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FMoveItemToCharacterFromCharacterRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15253,18 +26557,67 @@ bool PlayFab::ServerModels::FMoveItemToCharacterFromCharacterRequest::readFromVa
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FMoveItemToCharacterFromCharacterRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GivingCharacterId"))
+        {
+            reader.ReadValue(GivingCharacterId);
+        }
+        else if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("ReceivingCharacterId"))
+        {
+            reader.ReadValue(ReceivingCharacterId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FMoveItemToCharacterFromCharacterRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FMoveItemToCharacterFromCharacterResult::~FMoveItemToCharacterFromCharacterResult()
 {
 
 }
 
-void PlayFab::ServerModels::FMoveItemToCharacterFromCharacterResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FMoveItemToCharacterFromCharacterResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FMoveItemToCharacterFromCharacterResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FMoveItemToCharacterFromCharacterResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FMoveItemToCharacterFromCharacterResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15272,12 +26625,34 @@ bool PlayFab::ServerModels::FMoveItemToCharacterFromCharacterResult::readFromVal
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FMoveItemToCharacterFromCharacterResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FMoveItemToCharacterFromCharacterResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FMoveItemToCharacterFromUserRequest::~FMoveItemToCharacterFromUserRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FMoveItemToCharacterFromUserRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FMoveItemToCharacterFromUserRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15314,6 +26689,16 @@ void PlayFab::ServerModels::FMoveItemToCharacterFromUserRequest::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FMoveItemToCharacterFromUserRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FMoveItemToCharacterFromUserRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FMoveItemToCharacterFromUserRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15342,18 +26727,63 @@ bool PlayFab::ServerModels::FMoveItemToCharacterFromUserRequest::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FMoveItemToCharacterFromUserRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FMoveItemToCharacterFromUserRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FMoveItemToCharacterFromUserResult::~FMoveItemToCharacterFromUserResult()
 {
 
 }
 
-void PlayFab::ServerModels::FMoveItemToCharacterFromUserResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FMoveItemToCharacterFromUserResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FMoveItemToCharacterFromUserResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FMoveItemToCharacterFromUserResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FMoveItemToCharacterFromUserResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15361,12 +26791,34 @@ bool PlayFab::ServerModels::FMoveItemToCharacterFromUserResult::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FMoveItemToCharacterFromUserResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FMoveItemToCharacterFromUserResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FMoveItemToUserFromCharacterRequest::~FMoveItemToUserFromCharacterRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FMoveItemToUserFromCharacterRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FMoveItemToUserFromCharacterRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15403,6 +26855,16 @@ void PlayFab::ServerModels::FMoveItemToUserFromCharacterRequest::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FMoveItemToUserFromCharacterRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FMoveItemToUserFromCharacterRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FMoveItemToUserFromCharacterRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15431,18 +26893,63 @@ bool PlayFab::ServerModels::FMoveItemToUserFromCharacterRequest::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FMoveItemToUserFromCharacterRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FMoveItemToUserFromCharacterRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FMoveItemToUserFromCharacterResult::~FMoveItemToUserFromCharacterResult()
 {
 
 }
 
-void PlayFab::ServerModels::FMoveItemToUserFromCharacterResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FMoveItemToUserFromCharacterResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FMoveItemToUserFromCharacterResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FMoveItemToUserFromCharacterResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FMoveItemToUserFromCharacterResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15450,12 +26957,34 @@ bool PlayFab::ServerModels::FMoveItemToUserFromCharacterResult::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FMoveItemToUserFromCharacterResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FMoveItemToUserFromCharacterResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftRequest::~FNotifyMatchmakerPlayerLeftRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15493,6 +27022,16 @@ void PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftRequest::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15502,7 +27041,7 @@ bool PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftRequest::readFromValue(co
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -15523,7 +27062,49 @@ bool PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftRequest::readFromValue(co
     return HasSucceeded;
 }
 
-void PlayFab::ServerModels::writePlayerConnectionStateEnumJSON(PlayerConnectionState enumVal, JsonWriter& writer)
+bool PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("LobbyId"))
+        {
+            reader.ReadValue(LobbyId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FNotifyMatchmakerPlayerLeftRequest();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writePlayerConnectionStateEnumValue(ServerModels::PlayerConnectionState enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -15535,6 +27116,16 @@ void PlayFab::ServerModels::writePlayerConnectionStateEnumJSON(PlayerConnectionS
     }
 }
 
+void PlayFab::ServerModels::writePlayerConnectionStateEnumJSON(PlayerConnectionState enumVal, JsonWriter& writer)
+{
+    writePlayerConnectionStateEnumValue(enumVal, writer);
+}
+
+void PlayFab::ServerModels::writePlayerConnectionStateEnumJSON(PlayerConnectionState enumVal, JsonUtf8Writer& writer)
+{
+    writePlayerConnectionStateEnumValue(enumVal, writer);
+}
+
 ServerModels::PlayerConnectionState PlayFab::ServerModels::readPlayerConnectionStateFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readPlayerConnectionStateFromValue(value.IsValid() ? value->AsString() : "");
@@ -15568,7 +27159,8 @@ PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftResult::~FNotifyMatchmakerPlay
 
 }
 
-void PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15581,6 +27173,16 @@ void PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftResult::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15590,12 +27192,40 @@ bool PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftResult::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FNotifyMatchmakerPlayerLeftResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayerState"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { PlayerState = readPlayerConnectionStateFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FNotifyMatchmakerPlayerLeftResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FPushNotificationPackage::~FPushNotificationPackage()
 {
 
 }
 
-void PlayFab::ServerModels::FPushNotificationPackage::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FPushNotificationPackage::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15643,6 +27273,16 @@ void PlayFab::ServerModels::FPushNotificationPackage::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FPushNotificationPackage::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FPushNotificationPackage::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FPushNotificationPackage::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15692,12 +27332,59 @@ bool PlayFab::ServerModels::FPushNotificationPackage::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FPushNotificationPackage::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Badge"))
+        {
+            reader.ReadValue(Badge);
+        }
+        else if (reader.IsField("CustomData"))
+        {
+            reader.ReadValue(CustomData);
+        }
+        else if (reader.IsField("Icon"))
+        {
+            reader.ReadValue(Icon);
+        }
+        else if (reader.IsField("Message"))
+        {
+            reader.ReadValue(Message);
+        }
+        else if (reader.IsField("Sound"))
+        {
+            reader.ReadValue(Sound);
+        }
+        else if (reader.IsField("Title"))
+        {
+            reader.ReadValue(Title);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPushNotificationPackage();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRedeemCouponRequest::~FRedeemCouponRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FRedeemCouponRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRedeemCouponRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15747,6 +27434,16 @@ void PlayFab::ServerModels::FRedeemCouponRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRedeemCouponRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRedeemCouponRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRedeemCouponRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15777,7 +27474,7 @@ bool PlayFab::ServerModels::FRedeemCouponRequest::readFromValue(const TSharedPtr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -15791,12 +27488,62 @@ bool PlayFab::ServerModels::FRedeemCouponRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRedeemCouponRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CouponCode"))
+        {
+            reader.ReadValue(CouponCode);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRedeemCouponRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRedeemCouponResult::~FRedeemCouponResult()
 {
 
 }
 
-void PlayFab::ServerModels::FRedeemCouponResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRedeemCouponResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15812,6 +27559,16 @@ void PlayFab::ServerModels::FRedeemCouponResult::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRedeemCouponResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRedeemCouponResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRedeemCouponResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15820,19 +27577,53 @@ bool PlayFab::ServerModels::FRedeemCouponResult::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < GrantedItemsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GrantedItemsArray[Idx];
-        GrantedItems.Add(FItemInstance(CurrentItem->AsObject()));
+        GrantedItems.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRedeemCouponResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GrantedItems"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GrantedItems[GrantedItems.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRedeemCouponResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRedeemMatchmakerTicketRequest::~FRedeemMatchmakerTicketRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FRedeemMatchmakerTicketRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRedeemMatchmakerTicketRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15870,6 +27661,16 @@ void PlayFab::ServerModels::FRedeemMatchmakerTicketRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRedeemMatchmakerTicketRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRedeemMatchmakerTicketRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRedeemMatchmakerTicketRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15879,7 +27680,7 @@ bool PlayFab::ServerModels::FRedeemMatchmakerTicketRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -15900,13 +27701,55 @@ bool PlayFab::ServerModels::FRedeemMatchmakerTicketRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRedeemMatchmakerTicketRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("LobbyId"))
+        {
+            reader.ReadValue(LobbyId);
+        }
+        else if (reader.IsField("Ticket"))
+        {
+            reader.ReadValue(Ticket);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRedeemMatchmakerTicketRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRedeemMatchmakerTicketResult::~FRedeemMatchmakerTicketResult()
 {
     //if (UserInfo != nullptr) delete UserInfo;
 
 }
 
-void PlayFab::ServerModels::FRedeemMatchmakerTicketResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRedeemMatchmakerTicketResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15928,6 +27771,16 @@ void PlayFab::ServerModels::FRedeemMatchmakerTicketResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRedeemMatchmakerTicketResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRedeemMatchmakerTicketResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRedeemMatchmakerTicketResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15949,18 +27802,54 @@ bool PlayFab::ServerModels::FRedeemMatchmakerTicketResult::readFromValue(const T
     const TSharedPtr<FJsonValue> UserInfoValue = obj->TryGetField(TEXT("UserInfo"));
     if (UserInfoValue.IsValid() && !UserInfoValue->IsNull())
     {
-        UserInfo = MakeShareable(new FUserAccountInfo(UserInfoValue->AsObject()));
+        UserInfo = MakeShared<FUserAccountInfo>(UserInfoValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRedeemMatchmakerTicketResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Error"))
+        {
+            reader.ReadValue(Error);
+        }
+        else if (reader.IsField("TicketIsValid"))
+        {
+            reader.ReadValue(TicketIsValid);
+        }
+        else if (reader.IsField("UserInfo"))
+        {
+            UserInfo = MakeShared<FUserAccountInfo>();
+            UserInfo->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRedeemMatchmakerTicketResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRefreshGameServerInstanceHeartbeatRequest::~FRefreshGameServerInstanceHeartbeatRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FRefreshGameServerInstanceHeartbeatRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRefreshGameServerInstanceHeartbeatRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15977,6 +27866,16 @@ void PlayFab::ServerModels::FRefreshGameServerInstanceHeartbeatRequest::writeJSO
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRefreshGameServerInstanceHeartbeatRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRefreshGameServerInstanceHeartbeatRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRefreshGameServerInstanceHeartbeatRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15991,18 +27890,55 @@ bool PlayFab::ServerModels::FRefreshGameServerInstanceHeartbeatRequest::readFrom
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRefreshGameServerInstanceHeartbeatRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("LobbyId"))
+        {
+            reader.ReadValue(LobbyId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRefreshGameServerInstanceHeartbeatRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRefreshGameServerInstanceHeartbeatResult::~FRefreshGameServerInstanceHeartbeatResult()
 {
 
 }
 
-void PlayFab::ServerModels::FRefreshGameServerInstanceHeartbeatResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRefreshGameServerInstanceHeartbeatResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRefreshGameServerInstanceHeartbeatResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRefreshGameServerInstanceHeartbeatResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRefreshGameServerInstanceHeartbeatResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16010,7 +27946,29 @@ bool PlayFab::ServerModels::FRefreshGameServerInstanceHeartbeatResult::readFromV
     return HasSucceeded;
 }
 
-void PlayFab::ServerModels::writeRegionEnumJSON(Region enumVal, JsonWriter& writer)
+bool PlayFab::ServerModels::FRefreshGameServerInstanceHeartbeatResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRefreshGameServerInstanceHeartbeatResult();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeRegionEnumValue(ServerModels::Region enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -16025,6 +27983,16 @@ void PlayFab::ServerModels::writeRegionEnumJSON(Region enumVal, JsonWriter& writ
     }
 }
 
+void PlayFab::ServerModels::writeRegionEnumJSON(Region enumVal, JsonWriter& writer)
+{
+    writeRegionEnumValue(enumVal, writer);
+}
+
+void PlayFab::ServerModels::writeRegionEnumJSON(Region enumVal, JsonUtf8Writer& writer)
+{
+    writeRegionEnumValue(enumVal, writer);
+}
+
 ServerModels::Region PlayFab::ServerModels::readRegionFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readRegionFromValue(value.IsValid() ? value->AsString() : "");
@@ -16061,7 +28029,8 @@ PlayFab::ServerModels::FRegisterGameRequest::~FRegisterGameRequest()
 
 }
 
-void PlayFab::ServerModels::FRegisterGameRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRegisterGameRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16147,6 +28116,16 @@ void PlayFab::ServerModels::FRegisterGameRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRegisterGameRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRegisterGameRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRegisterGameRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16163,7 +28142,7 @@ bool PlayFab::ServerModels::FRegisterGameRequest::readFromValue(const TSharedPtr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -16216,11 +28195,88 @@ bool PlayFab::ServerModels::FRegisterGameRequest::readFromValue(const TSharedPtr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*TagsObject)->Values); It; ++It)
         {
-            Tags.Add(It.Key(), It.Value()->AsString());
+            Tags.Emplace(It.Key(), It.Value()->AsString());
+        }
+    }
+
+    return HasSucceeded;
+}
+
+bool PlayFab::ServerModels::FRegisterGameRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Build"))
+        {
+            reader.ReadValue(Build);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("GameMode"))
+        {
+            reader.ReadValue(GameMode);
+        }
+        else if (reader.IsField("LobbyId"))
+        {
+            reader.ReadValue(LobbyId);
+        }
+        else if (reader.IsField("Region"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfRegion = readRegionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("ServerIPV4Address"))
+        {
+            reader.ReadValue(ServerIPV4Address);
+        }
+        else if (reader.IsField("ServerIPV6Address"))
+        {
+            reader.ReadValue(ServerIPV6Address);
+        }
+        else if (reader.IsField("ServerPort"))
+        {
+            reader.ReadValue(ServerPort);
+        }
+        else if (reader.IsField("ServerPublicDNSName"))
+        {
+            reader.ReadValue(ServerPublicDNSName);
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Tags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
         }
+        else
+            reader.SkipValue();
     }
 
-    return HasSucceeded;
+    if (!reader.IsValid())
+    {
+        *this = FRegisterGameRequest();
+        return false;
+    }
+    return true;
 }
 
 PlayFab::ServerModels::FRegisterGameResponse::~FRegisterGameResponse()
@@ -16228,7 +28284,8 @@ PlayFab::ServerModels::FRegisterGameResponse::~FRegisterGameResponse()
 
 }
 
-void PlayFab::ServerModels::FRegisterGameResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRegisterGameResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16241,6 +28298,16 @@ void PlayFab::ServerModels::FRegisterGameResponse::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRegisterGameResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRegisterGameResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRegisterGameResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16255,12 +28322,39 @@ bool PlayFab::ServerModels::FRegisterGameResponse::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRegisterGameResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("LobbyId"))
+        {
+            reader.ReadValue(LobbyId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRegisterGameResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRemoveFriendRequest::~FRemoveFriendRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FRemoveFriendRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRemoveFriendRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16287,6 +28381,16 @@ void PlayFab::ServerModels::FRemoveFriendRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRemoveFriendRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRemoveFriendRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRemoveFriendRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16308,12 +28412,43 @@ bool PlayFab::ServerModels::FRemoveFriendRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRemoveFriendRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FriendPlayFabId"))
+        {
+            reader.ReadValue(FriendPlayFabId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemoveFriendRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRemoveGenericIDRequest::~FRemoveGenericIDRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FRemoveGenericIDRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRemoveGenericIDRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16333,6 +28468,16 @@ void PlayFab::ServerModels::FRemoveGenericIDRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRemoveGenericIDRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRemoveGenericIDRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRemoveGenericIDRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16353,12 +28498,43 @@ bool PlayFab::ServerModels::FRemoveGenericIDRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRemoveGenericIDRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GenericId"))
+        {
+            GenericId.readFromReader(reader);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemoveGenericIDRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRemovePlayerTagRequest::~FRemovePlayerTagRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FRemovePlayerTagRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRemovePlayerTagRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16396,6 +28572,16 @@ void PlayFab::ServerModels::FRemovePlayerTagRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRemovePlayerTagRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRemovePlayerTagRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRemovePlayerTagRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16405,7 +28591,7 @@ bool PlayFab::ServerModels::FRemovePlayerTagRequest::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -16426,18 +28612,70 @@ bool PlayFab::ServerModels::FRemovePlayerTagRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRemovePlayerTagRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("TagName"))
+        {
+            reader.ReadValue(TagName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemovePlayerTagRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRemovePlayerTagResult::~FRemovePlayerTagResult()
 {
 
 }
 
-void PlayFab::ServerModels::FRemovePlayerTagResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRemovePlayerTagResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRemovePlayerTagResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRemovePlayerTagResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRemovePlayerTagResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16445,12 +28683,34 @@ bool PlayFab::ServerModels::FRemovePlayerTagResult::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRemovePlayerTagResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemovePlayerTagResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRemoveSharedGroupMembersRequest::~FRemoveSharedGroupMembersRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FRemoveSharedGroupMembersRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRemoveSharedGroupMembersRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16473,6 +28733,16 @@ void PlayFab::ServerModels::FRemoveSharedGroupMembersRequest::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRemoveSharedGroupMembersRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRemoveSharedGroupMembersRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRemoveSharedGroupMembersRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16489,18 +28759,66 @@ bool PlayFab::ServerModels::FRemoveSharedGroupMembersRequest::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRemoveSharedGroupMembersRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { PlayFabIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("SharedGroupId"))
+        {
+            reader.ReadValue(SharedGroupId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemoveSharedGroupMembersRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRemoveSharedGroupMembersResult::~FRemoveSharedGroupMembersResult()
 {
 
 }
 
-void PlayFab::ServerModels::FRemoveSharedGroupMembersResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRemoveSharedGroupMembersResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRemoveSharedGroupMembersResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRemoveSharedGroupMembersResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRemoveSharedGroupMembersResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16508,12 +28826,34 @@ bool PlayFab::ServerModels::FRemoveSharedGroupMembersResult::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRemoveSharedGroupMembersResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemoveSharedGroupMembersResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FReportPlayerServerRequest::~FReportPlayerServerRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FReportPlayerServerRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FReportPlayerServerRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16557,6 +28897,16 @@ void PlayFab::ServerModels::FReportPlayerServerRequest::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FReportPlayerServerRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FReportPlayerServerRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FReportPlayerServerRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16573,7 +28923,7 @@ bool PlayFab::ServerModels::FReportPlayerServerRequest::readFromValue(const TSha
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -16594,12 +28944,58 @@ bool PlayFab::ServerModels::FReportPlayerServerRequest::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FReportPlayerServerRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Comment"))
+        {
+            reader.ReadValue(Comment);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ReporteeId"))
+        {
+            reader.ReadValue(ReporteeId);
+        }
+        else if (reader.IsField("ReporterId"))
+        {
+            reader.ReadValue(ReporterId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FReportPlayerServerRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FReportPlayerServerResult::~FReportPlayerServerResult()
 {
 
 }
 
-void PlayFab::ServerModels::FReportPlayerServerResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FReportPlayerServerResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16609,6 +29005,16 @@ void PlayFab::ServerModels::FReportPlayerServerResult::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FReportPlayerServerResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FReportPlayerServerResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FReportPlayerServerResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16623,12 +29029,39 @@ bool PlayFab::ServerModels::FReportPlayerServerResult::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FReportPlayerServerResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SubmissionsRemaining"))
+        {
+            reader.ReadValue(SubmissionsRemaining);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FReportPlayerServerResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRevokeAllBansForUserRequest::~FRevokeAllBansForUserRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FRevokeAllBansForUserRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRevokeAllBansForUserRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16645,6 +29078,16 @@ void PlayFab::ServerModels::FRevokeAllBansForUserRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRevokeAllBansForUserRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRevokeAllBansForUserRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRevokeAllBansForUserRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16659,12 +29102,39 @@ bool PlayFab::ServerModels::FRevokeAllBansForUserRequest::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRevokeAllBansForUserRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRevokeAllBansForUserRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRevokeAllBansForUserResult::~FRevokeAllBansForUserResult()
 {
 
 }
 
-void PlayFab::ServerModels::FRevokeAllBansForUserResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRevokeAllBansForUserResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16680,19 +29150,62 @@ void PlayFab::ServerModels::FRevokeAllBansForUserResult::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRevokeAllBansForUserResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRevokeAllBansForUserResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRevokeAllBansForUserResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
 
-    const TArray<TSharedPtr<FJsonValue>>&BanDataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BanData"));
-    for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
+    const TArray<TSharedPtr<FJsonValue>>&BanDataArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("BanData"));
+    for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
+    {
+        TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
+        BanData.Emplace(CurrentItem->AsObject());
+    }
+
+
+    return HasSucceeded;
+}
+
+bool PlayFab::ServerModels::FRevokeAllBansForUserResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BanData"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { BanData[BanData.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
     {
-        TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
+        *this = FRevokeAllBansForUserResult();
+        return false;
     }
-
-
-    return HasSucceeded;
+    return true;
 }
 
 PlayFab::ServerModels::FRevokeBansRequest::~FRevokeBansRequest()
@@ -16700,7 +29213,8 @@ PlayFab::ServerModels::FRevokeBansRequest::~FRevokeBansRequest()
 
 }
 
-void PlayFab::ServerModels::FRevokeBansRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRevokeBansRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16713,6 +29227,16 @@ void PlayFab::ServerModels::FRevokeBansRequest::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRevokeBansRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRevokeBansRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRevokeBansRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16722,12 +29246,46 @@ bool PlayFab::ServerModels::FRevokeBansRequest::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRevokeBansRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BanIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { BanIds.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRevokeBansRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRevokeBansResult::~FRevokeBansResult()
 {
 
 }
 
-void PlayFab::ServerModels::FRevokeBansResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRevokeBansResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16743,6 +29301,16 @@ void PlayFab::ServerModels::FRevokeBansResult::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRevokeBansResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRevokeBansResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRevokeBansResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16751,19 +29319,53 @@ bool PlayFab::ServerModels::FRevokeBansResult::readFromValue(const TSharedPtr<FJ
     for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
+        BanData.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRevokeBansResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BanData"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { BanData[BanData.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRevokeBansResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRevokeInventoryItem::~FRevokeInventoryItem()
 {
 
 }
 
-void PlayFab::ServerModels::FRevokeInventoryItem::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRevokeInventoryItem::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16796,6 +29398,16 @@ void PlayFab::ServerModels::FRevokeInventoryItem::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRevokeInventoryItem::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRevokeInventoryItem::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRevokeInventoryItem::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16824,12 +29436,47 @@ bool PlayFab::ServerModels::FRevokeInventoryItem::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRevokeInventoryItem::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRevokeInventoryItem();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRevokeInventoryItemRequest::~FRevokeInventoryItemRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FRevokeInventoryItemRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRevokeInventoryItemRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16862,6 +29509,16 @@ void PlayFab::ServerModels::FRevokeInventoryItemRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRevokeInventoryItemRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRevokeInventoryItemRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRevokeInventoryItemRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16890,12 +29547,47 @@ bool PlayFab::ServerModels::FRevokeInventoryItemRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRevokeInventoryItemRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRevokeInventoryItemRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRevokeInventoryItemsRequest::~FRevokeInventoryItemsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FRevokeInventoryItemsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRevokeInventoryItemsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16908,6 +29600,16 @@ void PlayFab::ServerModels::FRevokeInventoryItemsRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRevokeInventoryItemsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRevokeInventoryItemsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRevokeInventoryItemsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16916,20 +29618,54 @@ bool PlayFab::ServerModels::FRevokeInventoryItemsRequest::readFromValue(const TS
     for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FRevokeInventoryItem(CurrentItem->AsObject()));
+        Items.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRevokeInventoryItemsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Items"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Items[Items.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRevokeInventoryItemsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRevokeItemError::~FRevokeItemError()
 {
     //if (Item != nullptr) delete Item;
 
 }
 
-void PlayFab::ServerModels::FRevokeItemError::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRevokeItemError::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16948,6 +29684,16 @@ void PlayFab::ServerModels::FRevokeItemError::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRevokeItemError::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRevokeItemError::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRevokeItemError::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16962,18 +29708,50 @@ bool PlayFab::ServerModels::FRevokeItemError::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonValue> ItemValue = obj->TryGetField(TEXT("Item"));
     if (ItemValue.IsValid() && !ItemValue->IsNull())
     {
-        Item = MakeShareable(new FRevokeInventoryItem(ItemValue->AsObject()));
+        Item = MakeShared<FRevokeInventoryItem>(ItemValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRevokeItemError::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Error"))
+        {
+            reader.ReadValue(Error);
+        }
+        else if (reader.IsField("Item"))
+        {
+            Item = MakeShared<FRevokeInventoryItem>();
+            Item->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRevokeItemError();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRevokeInventoryItemsResult::~FRevokeInventoryItemsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FRevokeInventoryItemsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRevokeInventoryItemsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16989,6 +29767,16 @@ void PlayFab::ServerModels::FRevokeInventoryItemsResult::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRevokeInventoryItemsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRevokeInventoryItemsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRevokeInventoryItemsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16997,25 +29785,69 @@ bool PlayFab::ServerModels::FRevokeInventoryItemsResult::readFromValue(const TSh
     for (int32 Idx = 0; Idx < ErrorsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ErrorsArray[Idx];
-        Errors.Add(FRevokeItemError(CurrentItem->AsObject()));
+        Errors.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRevokeInventoryItemsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Errors"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Errors[Errors.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRevokeInventoryItemsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FRevokeInventoryResult::~FRevokeInventoryResult()
 {
 
 }
 
-void PlayFab::ServerModels::FRevokeInventoryResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FRevokeInventoryResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FRevokeInventoryResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FRevokeInventoryResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FRevokeInventoryResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17023,12 +29855,34 @@ bool PlayFab::ServerModels::FRevokeInventoryResult::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FRevokeInventoryResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRevokeInventoryResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSavePushNotificationTemplateRequest::~FSavePushNotificationTemplateRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FSavePushNotificationTemplateRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSavePushNotificationTemplateRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17074,6 +29928,16 @@ void PlayFab::ServerModels::FSavePushNotificationTemplateRequest::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSavePushNotificationTemplateRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSavePushNotificationTemplateRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSavePushNotificationTemplateRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17104,7 +29968,7 @@ bool PlayFab::ServerModels::FSavePushNotificationTemplateRequest::readFromValue(
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*LocalizedPushNotificationTemplatesObject)->Values); It; ++It)
         {
-            LocalizedPushNotificationTemplates.Add(It.Key(), FLocalizedPushNotificationProperties(It.Value()->AsObject()));
+            LocalizedPushNotificationTemplates.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -17118,12 +29982,62 @@ bool PlayFab::ServerModels::FSavePushNotificationTemplateRequest::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSavePushNotificationTemplateRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AndroidPayload"))
+        {
+            reader.ReadValue(AndroidPayload);
+        }
+        else if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("IOSPayload"))
+        {
+            reader.ReadValue(IOSPayload);
+        }
+        else if (reader.IsField("LocalizedPushNotificationTemplates"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { LocalizedPushNotificationTemplates.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSavePushNotificationTemplateRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSavePushNotificationTemplateResult::~FSavePushNotificationTemplateResult()
 {
 
 }
 
-void PlayFab::ServerModels::FSavePushNotificationTemplateResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSavePushNotificationTemplateResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17136,6 +30050,16 @@ void PlayFab::ServerModels::FSavePushNotificationTemplateResult::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSavePushNotificationTemplateResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSavePushNotificationTemplateResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSavePushNotificationTemplateResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17150,12 +30074,39 @@ bool PlayFab::ServerModels::FSavePushNotificationTemplateResult::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSavePushNotificationTemplateResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PushNotificationTemplateId"))
+        {
+            reader.ReadValue(PushNotificationTemplateId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSavePushNotificationTemplateResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSendCustomAccountRecoveryEmailRequest::~FSendCustomAccountRecoveryEmailRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FSendCustomAccountRecoveryEmailRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSendCustomAccountRecoveryEmailRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17195,6 +30146,16 @@ void PlayFab::ServerModels::FSendCustomAccountRecoveryEmailRequest::writeJSON(Js
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSendCustomAccountRecoveryEmailRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSendCustomAccountRecoveryEmailRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSendCustomAccountRecoveryEmailRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17204,7 +30165,7 @@ bool PlayFab::ServerModels::FSendCustomAccountRecoveryEmailRequest::readFromValu
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -17232,18 +30193,74 @@ bool PlayFab::ServerModels::FSendCustomAccountRecoveryEmailRequest::readFromValu
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSendCustomAccountRecoveryEmailRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Email"))
+        {
+            reader.ReadValue(Email);
+        }
+        else if (reader.IsField("EmailTemplateId"))
+        {
+            reader.ReadValue(EmailTemplateId);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSendCustomAccountRecoveryEmailRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSendCustomAccountRecoveryEmailResult::~FSendCustomAccountRecoveryEmailResult()
 {
 
 }
 
-void PlayFab::ServerModels::FSendCustomAccountRecoveryEmailResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSendCustomAccountRecoveryEmailResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSendCustomAccountRecoveryEmailResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSendCustomAccountRecoveryEmailResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSendCustomAccountRecoveryEmailResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17251,12 +30268,34 @@ bool PlayFab::ServerModels::FSendCustomAccountRecoveryEmailResult::readFromValue
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSendCustomAccountRecoveryEmailResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSendCustomAccountRecoveryEmailResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSendEmailFromTemplateRequest::~FSendEmailFromTemplateRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FSendEmailFromTemplateRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSendEmailFromTemplateRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17294,6 +30333,16 @@ void PlayFab::ServerModels::FSendEmailFromTemplateRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSendEmailFromTemplateRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSendEmailFromTemplateRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSendEmailFromTemplateRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17303,7 +30352,7 @@ bool PlayFab::ServerModels::FSendEmailFromTemplateRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -17324,18 +30373,70 @@ bool PlayFab::ServerModels::FSendEmailFromTemplateRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSendEmailFromTemplateRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EmailTemplateId"))
+        {
+            reader.ReadValue(EmailTemplateId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSendEmailFromTemplateRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSendEmailFromTemplateResult::~FSendEmailFromTemplateResult()
 {
 
 }
 
-void PlayFab::ServerModels::FSendEmailFromTemplateResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSendEmailFromTemplateResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSendEmailFromTemplateResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSendEmailFromTemplateResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSendEmailFromTemplateResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17343,12 +30444,34 @@ bool PlayFab::ServerModels::FSendEmailFromTemplateResult::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSendEmailFromTemplateResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSendEmailFromTemplateResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSendPushNotificationFromTemplateRequest::~FSendPushNotificationFromTemplateRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FSendPushNotificationFromTemplateRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSendPushNotificationFromTemplateRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17386,6 +30509,16 @@ void PlayFab::ServerModels::FSendPushNotificationFromTemplateRequest::writeJSON(
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSendPushNotificationFromTemplateRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSendPushNotificationFromTemplateRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSendPushNotificationFromTemplateRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17395,7 +30528,7 @@ bool PlayFab::ServerModels::FSendPushNotificationFromTemplateRequest::readFromVa
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -17416,13 +30549,55 @@ bool PlayFab::ServerModels::FSendPushNotificationFromTemplateRequest::readFromVa
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSendPushNotificationFromTemplateRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PushNotificationTemplateId"))
+        {
+            reader.ReadValue(PushNotificationTemplateId);
+        }
+        else if (reader.IsField("Recipient"))
+        {
+            reader.ReadValue(Recipient);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSendPushNotificationFromTemplateRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSendPushNotificationRequest::~FSendPushNotificationRequest()
 {
     //if (Package != nullptr) delete Package;
 
 }
 
-void PlayFab::ServerModels::FSendPushNotificationRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSendPushNotificationRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17486,6 +30661,16 @@ void PlayFab::ServerModels::FSendPushNotificationRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSendPushNotificationRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSendPushNotificationRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSendPushNotificationRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17494,7 +30679,7 @@ bool PlayFab::ServerModels::FSendPushNotificationRequest::readFromValue(const TS
     for (int32 Idx = 0; Idx < AdvancedPlatformDeliveryArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = AdvancedPlatformDeliveryArray[Idx];
-        AdvancedPlatformDelivery.Add(FAdvancedPushPlatformMsg(CurrentItem->AsObject()));
+        AdvancedPlatformDelivery.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -17503,7 +30688,7 @@ bool PlayFab::ServerModels::FSendPushNotificationRequest::readFromValue(const TS
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -17517,7 +30702,7 @@ bool PlayFab::ServerModels::FSendPushNotificationRequest::readFromValue(const TS
     const TSharedPtr<FJsonValue> PackageValue = obj->TryGetField(TEXT("Package"));
     if (PackageValue.IsValid() && !PackageValue->IsNull())
     {
-        Package = MakeShareable(new FPushNotificationPackage(PackageValue->AsObject()));
+        Package = MakeShared<FPushNotificationPackage>(PackageValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> RecipientValue = obj->TryGetField(TEXT("Recipient"));
@@ -17545,18 +30730,101 @@ bool PlayFab::ServerModels::FSendPushNotificationRequest::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSendPushNotificationRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AdvancedPlatformDelivery"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { AdvancedPlatformDelivery[AdvancedPlatformDelivery.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Message"))
+        {
+            reader.ReadValue(Message);
+        }
+        else if (reader.IsField("Package"))
+        {
+            Package = MakeShared<FPushNotificationPackage>();
+            Package->readFromReader(reader);
+        }
+        else if (reader.IsField("Recipient"))
+        {
+            reader.ReadValue(Recipient);
+        }
+        else if (reader.IsField("Subject"))
+        {
+            reader.ReadValue(Subject);
+        }
+        else if (reader.IsField("TargetPlatforms"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { TargetPlatforms.Add(readPushNotificationPlatformFromValue(TmpValue)); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSendPushNotificationRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSendPushNotificationResult::~FSendPushNotificationResult()
 {
 
 }
 
-void PlayFab::ServerModels::FSendPushNotificationResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSendPushNotificationResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSendPushNotificationResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSendPushNotificationResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSendPushNotificationResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17564,12 +30832,34 @@ bool PlayFab::ServerModels::FSendPushNotificationResult::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSendPushNotificationResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSendPushNotificationResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUserSettings::~FUserSettings()
 {
 
 }
 
-void PlayFab::ServerModels::FUserSettings::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUserSettings::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17585,6 +30875,16 @@ void PlayFab::ServerModels::FUserSettings::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUserSettings::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUserSettings::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUserSettings::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17613,12 +30913,47 @@ bool PlayFab::ServerModels::FUserSettings::readFromValue(const TSharedPtr<FJsonO
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUserSettings::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GatherDeviceInfo"))
+        {
+            reader.ReadValue(GatherDeviceInfo);
+        }
+        else if (reader.IsField("GatherFocusInfo"))
+        {
+            reader.ReadValue(GatherFocusInfo);
+        }
+        else if (reader.IsField("NeedsAttribution"))
+        {
+            reader.ReadValue(NeedsAttribution);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserSettings();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FVariable::~FVariable()
 {
 
 }
 
-void PlayFab::ServerModels::FVariable::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FVariable::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17641,6 +30976,16 @@ void PlayFab::ServerModels::FVariable::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FVariable::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FVariable::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FVariable::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17662,12 +31007,43 @@ bool PlayFab::ServerModels::FVariable::readFromValue(const TSharedPtr<FJsonObjec
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FVariable::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FVariable();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FTreatmentAssignment::~FTreatmentAssignment()
 {
 
 }
 
-void PlayFab::ServerModels::FTreatmentAssignment::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FTreatmentAssignment::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17692,6 +31068,16 @@ void PlayFab::ServerModels::FTreatmentAssignment::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FTreatmentAssignment::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FTreatmentAssignment::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FTreatmentAssignment::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17700,7 +31086,7 @@ bool PlayFab::ServerModels::FTreatmentAssignment::readFromValue(const TSharedPtr
     for (int32 Idx = 0; Idx < VariablesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = VariablesArray[Idx];
-        Variables.Add(FVariable(CurrentItem->AsObject()));
+        Variables.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -17709,6 +31095,50 @@ bool PlayFab::ServerModels::FTreatmentAssignment::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FTreatmentAssignment::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Variables"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Variables[Variables.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Variants"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Variants.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FTreatmentAssignment();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FServerLoginResult::~FServerLoginResult()
 {
     //if (EntityToken != nullptr) delete EntityToken;
@@ -17718,7 +31148,8 @@ PlayFab::ServerModels::FServerLoginResult::~FServerLoginResult()
 
 }
 
-void PlayFab::ServerModels::FServerLoginResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FServerLoginResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17770,6 +31201,16 @@ void PlayFab::ServerModels::FServerLoginResult::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FServerLoginResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FServerLoginResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FServerLoginResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17777,13 +31218,13 @@ bool PlayFab::ServerModels::FServerLoginResult::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonValue> EntityTokenValue = obj->TryGetField(TEXT("EntityToken"));
     if (EntityTokenValue.IsValid() && !EntityTokenValue->IsNull())
     {
-        EntityToken = MakeShareable(new FEntityTokenResponse(EntityTokenValue->AsObject()));
+        EntityToken = MakeShared<FEntityTokenResponse>(EntityTokenValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> InfoResultPayloadValue = obj->TryGetField(TEXT("InfoResultPayload"));
     if (InfoResultPayloadValue.IsValid() && !InfoResultPayloadValue->IsNull())
     {
-        InfoResultPayload = MakeShareable(new FGetPlayerCombinedInfoResultPayload(InfoResultPayloadValue->AsObject()));
+        InfoResultPayload = MakeShared<FGetPlayerCombinedInfoResultPayload>(InfoResultPayloadValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> LastLoginTimeValue = obj->TryGetField(TEXT("LastLoginTime"));
@@ -17815,24 +31256,83 @@ bool PlayFab::ServerModels::FServerLoginResult::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonValue> SettingsForUserValue = obj->TryGetField(TEXT("SettingsForUser"));
     if (SettingsForUserValue.IsValid() && !SettingsForUserValue->IsNull())
     {
-        SettingsForUser = MakeShareable(new FUserSettings(SettingsForUserValue->AsObject()));
+        SettingsForUser = MakeShared<FUserSettings>(SettingsForUserValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> TreatmentAssignmentValue = obj->TryGetField(TEXT("TreatmentAssignment"));
     if (TreatmentAssignmentValue.IsValid() && !TreatmentAssignmentValue->IsNull())
     {
-        pfTreatmentAssignment = MakeShareable(new FTreatmentAssignment(TreatmentAssignmentValue->AsObject()));
+        pfTreatmentAssignment = MakeShared<FTreatmentAssignment>(TreatmentAssignmentValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FServerLoginResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("EntityToken"))
+        {
+            EntityToken = MakeShared<FEntityTokenResponse>();
+            EntityToken->readFromReader(reader);
+        }
+        else if (reader.IsField("InfoResultPayload"))
+        {
+            InfoResultPayload = MakeShared<FGetPlayerCombinedInfoResultPayload>();
+            InfoResultPayload->readFromReader(reader);
+        }
+        else if (reader.IsField("LastLoginTime"))
+        {
+            reader.ReadValue(LastLoginTime);
+        }
+        else if (reader.IsField("NewlyCreated"))
+        {
+            reader.ReadValue(NewlyCreated);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("SessionTicket"))
+        {
+            reader.ReadValue(SessionTicket);
+        }
+        else if (reader.IsField("SettingsForUser"))
+        {
+            SettingsForUser = MakeShared<FUserSettings>();
+            SettingsForUser->readFromReader(reader);
+        }
+        else if (reader.IsField("TreatmentAssignment"))
+        {
+            pfTreatmentAssignment = MakeShared<FTreatmentAssignment>();
+            pfTreatmentAssignment->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FServerLoginResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSetFriendTagsRequest::~FSetFriendTagsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FSetFriendTagsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSetFriendTagsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17865,6 +31365,16 @@ void PlayFab::ServerModels::FSetFriendTagsRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSetFriendTagsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSetFriendTagsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSetFriendTagsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17876,16 +31386,57 @@ bool PlayFab::ServerModels::FSetFriendTagsRequest::readFromValue(const TSharedPt
         if (FriendPlayFabIdValue->TryGetString(TmpValue)) { FriendPlayFabId = TmpValue; }
     }
 
-    const TSharedPtr<FJsonValue> PlayFabIdValue = obj->TryGetField(TEXT("PlayFabId"));
-    if (PlayFabIdValue.IsValid() && !PlayFabIdValue->IsNull())
+    const TSharedPtr<FJsonValue> PlayFabIdValue = obj->TryGetField(TEXT("PlayFabId"));
+    if (PlayFabIdValue.IsValid() && !PlayFabIdValue->IsNull())
+    {
+        FString TmpValue;
+        if (PlayFabIdValue->TryGetString(TmpValue)) { PlayFabId = TmpValue; }
+    }
+
+    HasSucceeded &= obj->TryGetStringArrayField(TEXT("Tags"), Tags);
+
+    return HasSucceeded;
+}
+
+bool PlayFab::ServerModels::FSetFriendTagsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FriendPlayFabId"))
+        {
+            reader.ReadValue(FriendPlayFabId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Tags.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
     {
-        FString TmpValue;
-        if (PlayFabIdValue->TryGetString(TmpValue)) { PlayFabId = TmpValue; }
+        *this = FSetFriendTagsRequest();
+        return false;
     }
-
-    HasSucceeded &= obj->TryGetStringArrayField(TEXT("Tags"), Tags);
-
-    return HasSucceeded;
+    return true;
 }
 
 PlayFab::ServerModels::FSetGameServerInstanceDataRequest::~FSetGameServerInstanceDataRequest()
@@ -17893,7 +31444,8 @@ PlayFab::ServerModels::FSetGameServerInstanceDataRequest::~FSetGameServerInstanc
 
 }
 
-void PlayFab::ServerModels::FSetGameServerInstanceDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSetGameServerInstanceDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17920,6 +31472,16 @@ void PlayFab::ServerModels::FSetGameServerInstanceDataRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSetGameServerInstanceDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSetGameServerInstanceDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSetGameServerInstanceDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17941,18 +31503,59 @@ bool PlayFab::ServerModels::FSetGameServerInstanceDataRequest::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSetGameServerInstanceDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GameServerData"))
+        {
+            reader.ReadValue(GameServerData);
+        }
+        else if (reader.IsField("LobbyId"))
+        {
+            reader.ReadValue(LobbyId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetGameServerInstanceDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSetGameServerInstanceDataResult::~FSetGameServerInstanceDataResult()
 {
 
 }
 
-void PlayFab::ServerModels::FSetGameServerInstanceDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSetGameServerInstanceDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSetGameServerInstanceDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSetGameServerInstanceDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSetGameServerInstanceDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17960,12 +31563,34 @@ bool PlayFab::ServerModels::FSetGameServerInstanceDataResult::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSetGameServerInstanceDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetGameServerInstanceDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSetGameServerInstanceStateRequest::~FSetGameServerInstanceStateRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FSetGameServerInstanceStateRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSetGameServerInstanceStateRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17985,6 +31610,16 @@ void PlayFab::ServerModels::FSetGameServerInstanceStateRequest::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSetGameServerInstanceStateRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSetGameServerInstanceStateRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSetGameServerInstanceStateRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18001,18 +31636,60 @@ bool PlayFab::ServerModels::FSetGameServerInstanceStateRequest::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSetGameServerInstanceStateRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("LobbyId"))
+        {
+            reader.ReadValue(LobbyId);
+        }
+        else if (reader.IsField("State"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { State = readGameInstanceStateFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetGameServerInstanceStateRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSetGameServerInstanceStateResult::~FSetGameServerInstanceStateResult()
 {
 
 }
 
-void PlayFab::ServerModels::FSetGameServerInstanceStateResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSetGameServerInstanceStateResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSetGameServerInstanceStateResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSetGameServerInstanceStateResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSetGameServerInstanceStateResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18020,12 +31697,34 @@ bool PlayFab::ServerModels::FSetGameServerInstanceStateResult::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSetGameServerInstanceStateResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetGameServerInstanceStateResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSetGameServerInstanceTagsRequest::~FSetGameServerInstanceTagsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FSetGameServerInstanceTagsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSetGameServerInstanceTagsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18051,6 +31750,16 @@ void PlayFab::ServerModels::FSetGameServerInstanceTagsRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSetGameServerInstanceTagsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSetGameServerInstanceTagsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSetGameServerInstanceTagsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18067,25 +31776,73 @@ bool PlayFab::ServerModels::FSetGameServerInstanceTagsRequest::readFromValue(con
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*TagsObject)->Values); It; ++It)
         {
-            Tags.Add(It.Key(), It.Value()->AsString());
+            Tags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSetGameServerInstanceTagsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("LobbyId"))
+        {
+            reader.ReadValue(LobbyId);
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Tags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetGameServerInstanceTagsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSetGameServerInstanceTagsResult::~FSetGameServerInstanceTagsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FSetGameServerInstanceTagsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSetGameServerInstanceTagsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSetGameServerInstanceTagsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSetGameServerInstanceTagsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSetGameServerInstanceTagsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18093,12 +31850,34 @@ bool PlayFab::ServerModels::FSetGameServerInstanceTagsResult::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSetGameServerInstanceTagsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetGameServerInstanceTagsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSetPlayerSecretRequest::~FSetPlayerSecretRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FSetPlayerSecretRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSetPlayerSecretRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18121,6 +31900,16 @@ void PlayFab::ServerModels::FSetPlayerSecretRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSetPlayerSecretRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSetPlayerSecretRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSetPlayerSecretRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18142,18 +31931,59 @@ bool PlayFab::ServerModels::FSetPlayerSecretRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSetPlayerSecretRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetPlayerSecretRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSetPlayerSecretResult::~FSetPlayerSecretResult()
 {
 
 }
 
-void PlayFab::ServerModels::FSetPlayerSecretResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSetPlayerSecretResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSetPlayerSecretResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSetPlayerSecretResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSetPlayerSecretResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18161,12 +31991,34 @@ bool PlayFab::ServerModels::FSetPlayerSecretResult::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSetPlayerSecretResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetPlayerSecretResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSetPublisherDataRequest::~FSetPublisherDataRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FSetPublisherDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSetPublisherDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18189,6 +32041,16 @@ void PlayFab::ServerModels::FSetPublisherDataRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSetPublisherDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSetPublisherDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSetPublisherDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18210,18 +32072,59 @@ bool PlayFab::ServerModels::FSetPublisherDataRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSetPublisherDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Key"))
+        {
+            reader.ReadValue(Key);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetPublisherDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSetPublisherDataResult::~FSetPublisherDataResult()
 {
 
 }
 
-void PlayFab::ServerModels::FSetPublisherDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSetPublisherDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSetPublisherDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSetPublisherDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSetPublisherDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18229,12 +32132,34 @@ bool PlayFab::ServerModels::FSetPublisherDataResult::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSetPublisherDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetPublisherDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSetTitleDataRequest::~FSetTitleDataRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FSetTitleDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSetTitleDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18257,6 +32182,16 @@ void PlayFab::ServerModels::FSetTitleDataRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSetTitleDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSetTitleDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSetTitleDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18278,18 +32213,59 @@ bool PlayFab::ServerModels::FSetTitleDataRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSetTitleDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Key"))
+        {
+            reader.ReadValue(Key);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetTitleDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSetTitleDataResult::~FSetTitleDataResult()
 {
 
 }
 
-void PlayFab::ServerModels::FSetTitleDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSetTitleDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSetTitleDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSetTitleDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSetTitleDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18297,12 +32273,34 @@ bool PlayFab::ServerModels::FSetTitleDataResult::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSetTitleDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetTitleDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FStatisticUpdate::~FStatisticUpdate()
 {
 
 }
 
-void PlayFab::ServerModels::FStatisticUpdate::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FStatisticUpdate::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18325,7 +32323,17 @@ void PlayFab::ServerModels::FStatisticUpdate::writeJSON(JsonWriter& writer) cons
         writer->WriteValue(static_cast<int64>(Version));
     }
 
-    writer->WriteObjectEnd();
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::ServerModels::FStatisticUpdate::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FStatisticUpdate::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::ServerModels::FStatisticUpdate::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -18356,12 +32364,47 @@ bool PlayFab::ServerModels::FStatisticUpdate::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FStatisticUpdate::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStatisticUpdate();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSubtractCharacterVirtualCurrencyRequest::~FSubtractCharacterVirtualCurrencyRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FSubtractCharacterVirtualCurrencyRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSubtractCharacterVirtualCurrencyRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18412,6 +32455,16 @@ void PlayFab::ServerModels::FSubtractCharacterVirtualCurrencyRequest::writeJSON(
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSubtractCharacterVirtualCurrencyRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSubtractCharacterVirtualCurrencyRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSubtractCharacterVirtualCurrencyRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18435,7 +32488,7 @@ bool PlayFab::ServerModels::FSubtractCharacterVirtualCurrencyRequest::readFromVa
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -18456,12 +32509,62 @@ bool PlayFab::ServerModels::FSubtractCharacterVirtualCurrencyRequest::readFromVa
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSubtractCharacterVirtualCurrencyRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Amount"))
+        {
+            reader.ReadValue(Amount);
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            reader.ReadValue(VirtualCurrency);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSubtractCharacterVirtualCurrencyRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FSubtractUserVirtualCurrencyRequest::~FSubtractUserVirtualCurrencyRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FSubtractUserVirtualCurrencyRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FSubtractUserVirtualCurrencyRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18502,6 +32605,16 @@ void PlayFab::ServerModels::FSubtractUserVirtualCurrencyRequest::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FSubtractUserVirtualCurrencyRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FSubtractUserVirtualCurrencyRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FSubtractUserVirtualCurrencyRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18518,7 +32631,7 @@ bool PlayFab::ServerModels::FSubtractUserVirtualCurrencyRequest::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -18539,12 +32652,58 @@ bool PlayFab::ServerModels::FSubtractUserVirtualCurrencyRequest::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FSubtractUserVirtualCurrencyRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Amount"))
+        {
+            reader.ReadValue(Amount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            reader.ReadValue(VirtualCurrency);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSubtractUserVirtualCurrencyRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUnlinkPSNAccountRequest::~FUnlinkPSNAccountRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FUnlinkPSNAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUnlinkPSNAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18572,6 +32731,16 @@ void PlayFab::ServerModels::FUnlinkPSNAccountRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUnlinkPSNAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUnlinkPSNAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUnlinkPSNAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18581,7 +32750,7 @@ bool PlayFab::ServerModels::FUnlinkPSNAccountRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -18595,18 +32764,66 @@ bool PlayFab::ServerModels::FUnlinkPSNAccountRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUnlinkPSNAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkPSNAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUnlinkPSNAccountResult::~FUnlinkPSNAccountResult()
 {
 
 }
 
-void PlayFab::ServerModels::FUnlinkPSNAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUnlinkPSNAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUnlinkPSNAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUnlinkPSNAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUnlinkPSNAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18614,12 +32831,34 @@ bool PlayFab::ServerModels::FUnlinkPSNAccountResult::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUnlinkPSNAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkPSNAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUnlinkServerCustomIdRequest::~FUnlinkServerCustomIdRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FUnlinkServerCustomIdRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUnlinkServerCustomIdRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18657,6 +32896,16 @@ void PlayFab::ServerModels::FUnlinkServerCustomIdRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUnlinkServerCustomIdRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUnlinkServerCustomIdRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUnlinkServerCustomIdRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18666,7 +32915,7 @@ bool PlayFab::ServerModels::FUnlinkServerCustomIdRequest::readFromValue(const TS
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -18687,18 +32936,70 @@ bool PlayFab::ServerModels::FUnlinkServerCustomIdRequest::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUnlinkServerCustomIdRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("ServerCustomId"))
+        {
+            reader.ReadValue(ServerCustomId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkServerCustomIdRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUnlinkServerCustomIdResult::~FUnlinkServerCustomIdResult()
 {
 
 }
 
-void PlayFab::ServerModels::FUnlinkServerCustomIdResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUnlinkServerCustomIdResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUnlinkServerCustomIdResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUnlinkServerCustomIdResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUnlinkServerCustomIdResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18706,12 +33007,34 @@ bool PlayFab::ServerModels::FUnlinkServerCustomIdResult::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUnlinkServerCustomIdResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkServerCustomIdResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUnlinkXboxAccountRequest::~FUnlinkXboxAccountRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FUnlinkXboxAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUnlinkXboxAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18739,6 +33062,16 @@ void PlayFab::ServerModels::FUnlinkXboxAccountRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUnlinkXboxAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUnlinkXboxAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUnlinkXboxAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18748,7 +33081,7 @@ bool PlayFab::ServerModels::FUnlinkXboxAccountRequest::readFromValue(const TShar
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -18762,18 +33095,66 @@ bool PlayFab::ServerModels::FUnlinkXboxAccountRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUnlinkXboxAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkXboxAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUnlinkXboxAccountResult::~FUnlinkXboxAccountResult()
 {
 
 }
 
-void PlayFab::ServerModels::FUnlinkXboxAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUnlinkXboxAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUnlinkXboxAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUnlinkXboxAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUnlinkXboxAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18781,12 +33162,34 @@ bool PlayFab::ServerModels::FUnlinkXboxAccountResult::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUnlinkXboxAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlinkXboxAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUnlockContainerInstanceRequest::~FUnlockContainerInstanceRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FUnlockContainerInstanceRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUnlockContainerInstanceRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18842,6 +33245,16 @@ void PlayFab::ServerModels::FUnlockContainerInstanceRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUnlockContainerInstanceRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUnlockContainerInstanceRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUnlockContainerInstanceRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18872,7 +33285,7 @@ bool PlayFab::ServerModels::FUnlockContainerInstanceRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -18893,12 +33306,66 @@ bool PlayFab::ServerModels::FUnlockContainerInstanceRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUnlockContainerInstanceRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("ContainerItemInstanceId"))
+        {
+            reader.ReadValue(ContainerItemInstanceId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("KeyItemInstanceId"))
+        {
+            reader.ReadValue(KeyItemInstanceId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlockContainerInstanceRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUnlockContainerItemRequest::~FUnlockContainerItemRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FUnlockContainerItemRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUnlockContainerItemRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18948,6 +33415,16 @@ void PlayFab::ServerModels::FUnlockContainerItemRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUnlockContainerItemRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUnlockContainerItemRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUnlockContainerItemRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18978,7 +33455,7 @@ bool PlayFab::ServerModels::FUnlockContainerItemRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -18992,12 +33469,62 @@ bool PlayFab::ServerModels::FUnlockContainerItemRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUnlockContainerItemRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("ContainerItemId"))
+        {
+            reader.ReadValue(ContainerItemId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlockContainerItemRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUnlockContainerItemResult::~FUnlockContainerItemResult()
 {
 
 }
 
-void PlayFab::ServerModels::FUnlockContainerItemResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUnlockContainerItemResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19036,6 +33563,16 @@ void PlayFab::ServerModels::FUnlockContainerItemResult::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUnlockContainerItemResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUnlockContainerItemResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUnlockContainerItemResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19044,7 +33581,7 @@ bool PlayFab::ServerModels::FUnlockContainerItemResult::readFromValue(const TSha
     for (int32 Idx = 0; Idx < GrantedItemsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GrantedItemsArray[Idx];
-        GrantedItems.Add(FItemInstance(CurrentItem->AsObject()));
+        GrantedItems.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -19068,19 +33605,72 @@ bool PlayFab::ServerModels::FUnlockContainerItemResult::readFromValue(const TSha
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrency.Add(It.Key(), TmpValue);
+            VirtualCurrency.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUnlockContainerItemResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GrantedItems"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GrantedItems[GrantedItems.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("UnlockedItemInstanceId"))
+        {
+            reader.ReadValue(UnlockedItemInstanceId);
+        }
+        else if (reader.IsField("UnlockedWithItemInstanceId"))
+        {
+            reader.ReadValue(UnlockedWithItemInstanceId);
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrency.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnlockContainerItemResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUpdateAvatarUrlRequest::~FUpdateAvatarUrlRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FUpdateAvatarUrlRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUpdateAvatarUrlRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19107,6 +33697,16 @@ void PlayFab::ServerModels::FUpdateAvatarUrlRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUpdateAvatarUrlRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUpdateAvatarUrlRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUpdateAvatarUrlRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19128,12 +33728,43 @@ bool PlayFab::ServerModels::FUpdateAvatarUrlRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUpdateAvatarUrlRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ImageUrl"))
+        {
+            reader.ReadValue(ImageUrl);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateAvatarUrlRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUpdateBanRequest::~FUpdateBanRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FUpdateBanRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUpdateBanRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19186,6 +33817,16 @@ void PlayFab::ServerModels::FUpdateBanRequest::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUpdateBanRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUpdateBanRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUpdateBanRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19240,12 +33881,63 @@ bool PlayFab::ServerModels::FUpdateBanRequest::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUpdateBanRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Active"))
+        {
+            reader.ReadValue(Active);
+        }
+        else if (reader.IsField("BanId"))
+        {
+            reader.ReadValue(BanId);
+        }
+        else if (reader.IsField("Expires"))
+        {
+            reader.ReadValue(Expires);
+        }
+        else if (reader.IsField("IPAddress"))
+        {
+            reader.ReadValue(IPAddress);
+        }
+        else if (reader.IsField("MACAddress"))
+        {
+            reader.ReadValue(MACAddress);
+        }
+        else if (reader.IsField("Permanent"))
+        {
+            reader.ReadValue(Permanent);
+        }
+        else if (reader.IsField("Reason"))
+        {
+            reader.ReadValue(Reason);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateBanRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUpdateBansRequest::~FUpdateBansRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FUpdateBansRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUpdateBansRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19258,6 +33950,16 @@ void PlayFab::ServerModels::FUpdateBansRequest::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUpdateBansRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUpdateBansRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUpdateBansRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19266,19 +33968,53 @@ bool PlayFab::ServerModels::FUpdateBansRequest::readFromValue(const TSharedPtr<F
     for (int32 Idx = 0; Idx < BansArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BansArray[Idx];
-        Bans.Add(FUpdateBanRequest(CurrentItem->AsObject()));
+        Bans.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUpdateBansRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Bans"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Bans[Bans.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateBansRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUpdateBansResult::~FUpdateBansResult()
 {
 
 }
 
-void PlayFab::ServerModels::FUpdateBansResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUpdateBansResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19294,6 +34030,16 @@ void PlayFab::ServerModels::FUpdateBansResult::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUpdateBansResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUpdateBansResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUpdateBansResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19302,19 +34048,53 @@ bool PlayFab::ServerModels::FUpdateBansResult::readFromValue(const TSharedPtr<FJ
     for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
+        BanData.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUpdateBansResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BanData"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { BanData[BanData.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateBansResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUpdateCharacterDataRequest::~FUpdateCharacterDataRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FUpdateCharacterDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUpdateCharacterDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19378,6 +34158,16 @@ void PlayFab::ServerModels::FUpdateCharacterDataRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUpdateCharacterDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUpdateCharacterDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUpdateCharacterDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19394,7 +34184,7 @@ bool PlayFab::ServerModels::FUpdateCharacterDataRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -19403,7 +34193,7 @@ bool PlayFab::ServerModels::FUpdateCharacterDataRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -19421,12 +34211,81 @@ bool PlayFab::ServerModels::FUpdateCharacterDataRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUpdateCharacterDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("KeysToRemove"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { KeysToRemove.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Permission"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Permission = readUserDataPermissionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateCharacterDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUpdateCharacterDataResult::~FUpdateCharacterDataResult()
 {
 
 }
 
-void PlayFab::ServerModels::FUpdateCharacterDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUpdateCharacterDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19436,6 +34295,16 @@ void PlayFab::ServerModels::FUpdateCharacterDataResult::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUpdateCharacterDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUpdateCharacterDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUpdateCharacterDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19450,12 +34319,39 @@ bool PlayFab::ServerModels::FUpdateCharacterDataResult::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUpdateCharacterDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DataVersion"))
+        {
+            reader.ReadValue(DataVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateCharacterDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUpdateCharacterStatisticsRequest::~FUpdateCharacterStatisticsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FUpdateCharacterStatisticsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUpdateCharacterStatisticsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19504,6 +34400,16 @@ void PlayFab::ServerModels::FUpdateCharacterStatisticsRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUpdateCharacterStatisticsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUpdateCharacterStatisticsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUpdateCharacterStatisticsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19521,7 +34427,7 @@ bool PlayFab::ServerModels::FUpdateCharacterStatisticsRequest::readFromValue(con
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CharacterStatisticsObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            CharacterStatistics.Add(It.Key(), TmpValue);
+            CharacterStatistics.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -19530,7 +34436,7 @@ bool PlayFab::ServerModels::FUpdateCharacterStatisticsRequest::readFromValue(con
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -19544,18 +34450,81 @@ bool PlayFab::ServerModels::FUpdateCharacterStatisticsRequest::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUpdateCharacterStatisticsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CharacterStatistics"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CharacterStatistics.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateCharacterStatisticsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUpdateCharacterStatisticsResult::~FUpdateCharacterStatisticsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FUpdateCharacterStatisticsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUpdateCharacterStatisticsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUpdateCharacterStatisticsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUpdateCharacterStatisticsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUpdateCharacterStatisticsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19563,12 +34532,34 @@ bool PlayFab::ServerModels::FUpdateCharacterStatisticsResult::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUpdateCharacterStatisticsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateCharacterStatisticsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUpdatePlayerStatisticsRequest::~FUpdatePlayerStatisticsRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FUpdatePlayerStatisticsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUpdatePlayerStatisticsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19608,6 +34599,16 @@ void PlayFab::ServerModels::FUpdatePlayerStatisticsRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUpdatePlayerStatisticsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUpdatePlayerStatisticsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUpdatePlayerStatisticsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19617,7 +34618,7 @@ bool PlayFab::ServerModels::FUpdatePlayerStatisticsRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -19639,25 +34640,88 @@ bool PlayFab::ServerModels::FUpdatePlayerStatisticsRequest::readFromValue(const
     for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FStatisticUpdate(CurrentItem->AsObject()));
+        Statistics.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUpdatePlayerStatisticsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ForceUpdate"))
+        {
+            reader.ReadValue(ForceUpdate);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Statistics"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Statistics[Statistics.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdatePlayerStatisticsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUpdatePlayerStatisticsResult::~FUpdatePlayerStatisticsResult()
 {
 
 }
 
-void PlayFab::ServerModels::FUpdatePlayerStatisticsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUpdatePlayerStatisticsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUpdatePlayerStatisticsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUpdatePlayerStatisticsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUpdatePlayerStatisticsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19665,12 +34729,34 @@ bool PlayFab::ServerModels::FUpdatePlayerStatisticsResult::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUpdatePlayerStatisticsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdatePlayerStatisticsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUpdateSharedGroupDataRequest::~FUpdateSharedGroupDataRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FUpdateSharedGroupDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUpdateSharedGroupDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19724,6 +34810,16 @@ void PlayFab::ServerModels::FUpdateSharedGroupDataRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUpdateSharedGroupDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUpdateSharedGroupDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUpdateSharedGroupDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19733,7 +34829,7 @@ bool PlayFab::ServerModels::FUpdateSharedGroupDataRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -19742,7 +34838,7 @@ bool PlayFab::ServerModels::FUpdateSharedGroupDataRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -19760,18 +34856,93 @@ bool PlayFab::ServerModels::FUpdateSharedGroupDataRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUpdateSharedGroupDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("KeysToRemove"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { KeysToRemove.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Permission"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Permission = readUserDataPermissionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("SharedGroupId"))
+        {
+            reader.ReadValue(SharedGroupId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateSharedGroupDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUpdateSharedGroupDataResult::~FUpdateSharedGroupDataResult()
 {
 
 }
 
-void PlayFab::ServerModels::FUpdateSharedGroupDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUpdateSharedGroupDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUpdateSharedGroupDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUpdateSharedGroupDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUpdateSharedGroupDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19779,12 +34950,34 @@ bool PlayFab::ServerModels::FUpdateSharedGroupDataResult::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUpdateSharedGroupDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateSharedGroupDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUpdateUserDataRequest::~FUpdateUserDataRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FUpdateUserDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUpdateUserDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19838,6 +35031,16 @@ void PlayFab::ServerModels::FUpdateUserDataRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUpdateUserDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUpdateUserDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUpdateUserDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19847,7 +35050,7 @@ bool PlayFab::ServerModels::FUpdateUserDataRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -19856,7 +35059,7 @@ bool PlayFab::ServerModels::FUpdateUserDataRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -19874,12 +35077,77 @@ bool PlayFab::ServerModels::FUpdateUserDataRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUpdateUserDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("KeysToRemove"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { KeysToRemove.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Permission"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Permission = readUserDataPermissionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateUserDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUpdateUserDataResult::~FUpdateUserDataResult()
 {
 
 }
 
-void PlayFab::ServerModels::FUpdateUserDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUpdateUserDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19889,6 +35157,16 @@ void PlayFab::ServerModels::FUpdateUserDataResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUpdateUserDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUpdateUserDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUpdateUserDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19903,12 +35181,39 @@ bool PlayFab::ServerModels::FUpdateUserDataResult::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUpdateUserDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DataVersion"))
+        {
+            reader.ReadValue(DataVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateUserDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUpdateUserInternalDataRequest::~FUpdateUserInternalDataRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FUpdateUserInternalDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUpdateUserInternalDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19956,6 +35261,16 @@ void PlayFab::ServerModels::FUpdateUserInternalDataRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUpdateUserInternalDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUpdateUserInternalDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUpdateUserInternalDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19965,7 +35280,7 @@ bool PlayFab::ServerModels::FUpdateUserInternalDataRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -19974,7 +35289,7 @@ bool PlayFab::ServerModels::FUpdateUserInternalDataRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -19990,12 +35305,72 @@ bool PlayFab::ServerModels::FUpdateUserInternalDataRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUpdateUserInternalDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("KeysToRemove"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { KeysToRemove.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateUserInternalDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FUpdateUserInventoryItemDataRequest::~FUpdateUserInventoryItemDataRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FUpdateUserInventoryItemDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FUpdateUserInventoryItemDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20059,6 +35434,16 @@ void PlayFab::ServerModels::FUpdateUserInventoryItemDataRequest::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FUpdateUserInventoryItemDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FUpdateUserInventoryItemDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FUpdateUserInventoryItemDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20075,7 +35460,7 @@ bool PlayFab::ServerModels::FUpdateUserInventoryItemDataRequest::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -20084,7 +35469,7 @@ bool PlayFab::ServerModels::FUpdateUserInventoryItemDataRequest::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -20107,12 +35492,80 @@ bool PlayFab::ServerModels::FUpdateUserInventoryItemDataRequest::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FUpdateUserInventoryItemDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("KeysToRemove"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { KeysToRemove.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateUserInventoryItemDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FWriteEventResponse::~FWriteEventResponse()
 {
 
 }
 
-void PlayFab::ServerModels::FWriteEventResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FWriteEventResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20125,6 +35578,16 @@ void PlayFab::ServerModels::FWriteEventResponse::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FWriteEventResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FWriteEventResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FWriteEventResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20139,12 +35602,39 @@ bool PlayFab::ServerModels::FWriteEventResponse::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FWriteEventResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("EventId"))
+        {
+            reader.ReadValue(EventId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FWriteEventResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FWriteServerCharacterEventRequest::~FWriteServerCharacterEventRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FWriteServerCharacterEventRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FWriteServerCharacterEventRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20209,6 +35699,16 @@ void PlayFab::ServerModels::FWriteServerCharacterEventRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FWriteServerCharacterEventRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FWriteServerCharacterEventRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FWriteServerCharacterEventRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20218,7 +35718,7 @@ bool PlayFab::ServerModels::FWriteServerCharacterEventRequest::readFromValue(con
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*BodyObject)->Values); It; ++It)
         {
-            Body.Add(It.Key(), FJsonKeeper(It.Value()));
+            Body.Emplace(It.Key(), It.Value());
         }
     }
 
@@ -20234,7 +35734,7 @@ bool PlayFab::ServerModels::FWriteServerCharacterEventRequest::readFromValue(con
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -20260,12 +35760,72 @@ bool PlayFab::ServerModels::FWriteServerCharacterEventRequest::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FWriteServerCharacterEventRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Body"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    Body.Add(reader.GetFieldName()).readFromReader(reader);
+                }
+            }
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EventName"))
+        {
+            reader.ReadValue(EventName);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Timestamp"))
+        {
+            reader.ReadValue(Timestamp);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FWriteServerCharacterEventRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FWriteServerPlayerEventRequest::~FWriteServerPlayerEventRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FWriteServerPlayerEventRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FWriteServerPlayerEventRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20320,6 +35880,16 @@ void PlayFab::ServerModels::FWriteServerPlayerEventRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FWriteServerPlayerEventRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FWriteServerPlayerEventRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FWriteServerPlayerEventRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20329,7 +35899,7 @@ bool PlayFab::ServerModels::FWriteServerPlayerEventRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*BodyObject)->Values); It; ++It)
         {
-            Body.Add(It.Key(), FJsonKeeper(It.Value()));
+            Body.Emplace(It.Key(), It.Value());
         }
     }
 
@@ -20338,7 +35908,7 @@ bool PlayFab::ServerModels::FWriteServerPlayerEventRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -20364,12 +35934,68 @@ bool PlayFab::ServerModels::FWriteServerPlayerEventRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FWriteServerPlayerEventRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Body"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    Body.Add(reader.GetFieldName()).readFromReader(reader);
+                }
+            }
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EventName"))
+        {
+            reader.ReadValue(EventName);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Timestamp"))
+        {
+            reader.ReadValue(Timestamp);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FWriteServerPlayerEventRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ServerModels::FWriteTitleEventRequest::~FWriteTitleEventRequest()
 {
 
 }
 
-void PlayFab::ServerModels::FWriteTitleEventRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ServerModels::FWriteTitleEventRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20414,6 +36040,16 @@ void PlayFab::ServerModels::FWriteTitleEventRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ServerModels::FWriteTitleEventRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ServerModels::FWriteTitleEventRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ServerModels::FWriteTitleEventRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20423,7 +36059,7 @@ bool PlayFab::ServerModels::FWriteTitleEventRequest::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*BodyObject)->Values); It; ++It)
         {
-            Body.Add(It.Key(), FJsonKeeper(It.Value()));
+            Body.Emplace(It.Key(), It.Value());
         }
     }
 
@@ -20432,7 +36068,7 @@ bool PlayFab::ServerModels::FWriteTitleEventRequest::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -20451,3 +36087,54 @@ bool PlayFab::ServerModels::FWriteTitleEventRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ServerModels::FWriteTitleEventRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Body"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    Body.Add(reader.GetFieldName()).readFromReader(reader);
+                }
+            }
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EventName"))
+        {
+            reader.ReadValue(EventName);
+        }
+        else if (reader.IsField("Timestamp"))
+        {
+            reader.ReadValue(Timestamp);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FWriteTitleEventRequest();
+        return false;
+    }
+    return true;
+}
+
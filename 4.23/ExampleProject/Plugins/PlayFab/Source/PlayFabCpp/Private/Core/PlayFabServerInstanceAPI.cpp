@@ -80,7 +80,8 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabServerInstanceAPI::GetOrCreate
 bool UPlayFabServerInstanceAPI::AddCharacterVirtualCurrency(
     ServerModels::FAddCharacterVirtualCurrencyRequest& request,
     const FAddCharacterVirtualCurrencyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -88,29 +89,32 @@ bool UPlayFabServerInstanceAPI::AddCharacterVirtualCurrency(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AddCharacterVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnAddCharacterVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AddCharacterVirtualCurrency"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnAddCharacterVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FModifyCharacterVirtualCurrencyResult>> UPlayFabServerInstanceAPI::AddCharacterVirtualCurrencyAsync(ServerModels::FAddCharacterVirtualCurrencyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FModifyCharacterVirtualCurrencyResult, FAddCharacterVirtualCurrencyDelegate>([this, &request, &Handle](const FAddCharacterVirtualCurrencyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::AddCharacterVirtualCurrency(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnAddCharacterVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddCharacterVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FModifyCharacterVirtualCurrencyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FModifyCharacterVirtualCurrencyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FModifyCharacterVirtualCurrencyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::AddFriend(
     ServerModels::FAddFriendRequest& request,
     const FAddFriendDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -118,29 +122,32 @@ bool UPlayFabServerInstanceAPI::AddFriend(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AddFriend"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnAddFriendResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AddFriend"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnAddFriendResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FEmptyResponse>> UPlayFabServerInstanceAPI::AddFriendAsync(ServerModels::FAddFriendRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FEmptyResponse, FAddFriendDelegate>([this, &request, &Handle](const FAddFriendDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::AddFriend(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnAddFriendResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddFriendDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::AddGenericID(
     ServerModels::FAddGenericIDRequest& request,
     const FAddGenericIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -148,29 +155,32 @@ bool UPlayFabServerInstanceAPI::AddGenericID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AddGenericID"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnAddGenericIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AddGenericID"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnAddGenericIDResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FEmptyResult>> UPlayFabServerInstanceAPI::AddGenericIDAsync(ServerModels::FAddGenericIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FEmptyResult, FAddGenericIDDelegate>([this, &request, &Handle](const FAddGenericIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::AddGenericID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnAddGenericIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddGenericIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FEmptyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FEmptyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FEmptyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::AddPlayerTag(
     ServerModels::FAddPlayerTagRequest& request,
     const FAddPlayerTagDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -178,29 +188,32 @@ bool UPlayFabServerInstanceAPI::AddPlayerTag(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AddPlayerTag"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnAddPlayerTagResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AddPlayerTag"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnAddPlayerTagResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FAddPlayerTagResult>> UPlayFabServerInstanceAPI::AddPlayerTagAsync(ServerModels::FAddPlayerTagRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FAddPlayerTagResult, FAddPlayerTagDelegate>([this, &request, &Handle](const FAddPlayerTagDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::AddPlayerTag(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnAddPlayerTagResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddPlayerTagDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FAddPlayerTagResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FAddPlayerTagResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FAddPlayerTagResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::AddSharedGroupMembers(
     ServerModels::FAddSharedGroupMembersRequest& request,
     const FAddSharedGroupMembersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -208,29 +221,32 @@ bool UPlayFabServerInstanceAPI::AddSharedGroupMembers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AddSharedGroupMembers"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnAddSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AddSharedGroupMembers"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnAddSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FAddSharedGroupMembersResult>> UPlayFabServerInstanceAPI::AddSharedGroupMembersAsync(ServerModels::FAddSharedGroupMembersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FAddSharedGroupMembersResult, FAddSharedGroupMembersDelegate>([this, &request, &Handle](const FAddSharedGroupMembersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::AddSharedGroupMembers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnAddSharedGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddSharedGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FAddSharedGroupMembersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FAddSharedGroupMembersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FAddSharedGroupMembersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::AddUserVirtualCurrency(
     ServerModels::FAddUserVirtualCurrencyRequest& request,
     const FAddUserVirtualCurrencyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -238,29 +254,32 @@ bool UPlayFabServerInstanceAPI::AddUserVirtualCurrency(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AddUserVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnAddUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AddUserVirtualCurrency"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnAddUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FModifyUserVirtualCurrencyResult>> UPlayFabServerInstanceAPI::AddUserVirtualCurrencyAsync(ServerModels::FAddUserVirtualCurrencyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FModifyUserVirtualCurrencyResult, FAddUserVirtualCurrencyDelegate>([this, &request, &Handle](const FAddUserVirtualCurrencyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::AddUserVirtualCurrency(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnAddUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FModifyUserVirtualCurrencyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FModifyUserVirtualCurrencyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FModifyUserVirtualCurrencyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::AuthenticateSessionTicket(
     ServerModels::FAuthenticateSessionTicketRequest& request,
     const FAuthenticateSessionTicketDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -268,29 +287,32 @@ bool UPlayFabServerInstanceAPI::AuthenticateSessionTicket(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AuthenticateSessionTicket"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnAuthenticateSessionTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AuthenticateSessionTicket"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnAuthenticateSessionTicketResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FAuthenticateSessionTicketResult>> UPlayFabServerInstanceAPI::AuthenticateSessionTicketAsync(ServerModels::FAuthenticateSessionTicketRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FAuthenticateSessionTicketResult, FAuthenticateSessionTicketDelegate>([this, &request, &Handle](const FAuthenticateSessionTicketDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::AuthenticateSessionTicket(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnAuthenticateSessionTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAuthenticateSessionTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FAuthenticateSessionTicketResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FAuthenticateSessionTicketResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FAuthenticateSessionTicketResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::AwardSteamAchievement(
     ServerModels::FAwardSteamAchievementRequest& request,
     const FAwardSteamAchievementDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -298,29 +320,32 @@ bool UPlayFabServerInstanceAPI::AwardSteamAchievement(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AwardSteamAchievement"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnAwardSteamAchievementResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/AwardSteamAchievement"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnAwardSteamAchievementResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FAwardSteamAchievementResult>> UPlayFabServerInstanceAPI::AwardSteamAchievementAsync(ServerModels::FAwardSteamAchievementRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FAwardSteamAchievementResult, FAwardSteamAchievementDelegate>([this, &request, &Handle](const FAwardSteamAchievementDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::AwardSteamAchievement(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnAwardSteamAchievementResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAwardSteamAchievementDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FAwardSteamAchievementResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FAwardSteamAchievementResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FAwardSteamAchievementResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::BanUsers(
     ServerModels::FBanUsersRequest& request,
     const FBanUsersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -328,29 +353,32 @@ bool UPlayFabServerInstanceAPI::BanUsers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/BanUsers"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnBanUsersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/BanUsers"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnBanUsersResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FBanUsersResult>> UPlayFabServerInstanceAPI::BanUsersAsync(ServerModels::FBanUsersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FBanUsersResult, FBanUsersDelegate>([this, &request, &Handle](const FBanUsersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::BanUsers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnBanUsersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FBanUsersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FBanUsersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FBanUsersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FBanUsersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::ConsumeItem(
     ServerModels::FConsumeItemRequest& request,
     const FConsumeItemDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -358,29 +386,32 @@ bool UPlayFabServerInstanceAPI::ConsumeItem(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/ConsumeItem"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnConsumeItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/ConsumeItem"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnConsumeItemResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FConsumeItemResult>> UPlayFabServerInstanceAPI::ConsumeItemAsync(ServerModels::FConsumeItemRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FConsumeItemResult, FConsumeItemDelegate>([this, &request, &Handle](const FConsumeItemDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::ConsumeItem(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnConsumeItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumeItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FConsumeItemResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FConsumeItemResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FConsumeItemResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::CreateSharedGroup(
     ServerModels::FCreateSharedGroupRequest& request,
     const FCreateSharedGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -388,29 +419,32 @@ bool UPlayFabServerInstanceAPI::CreateSharedGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/CreateSharedGroup"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnCreateSharedGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/CreateSharedGroup"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnCreateSharedGroupResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FCreateSharedGroupResult>> UPlayFabServerInstanceAPI::CreateSharedGroupAsync(ServerModels::FCreateSharedGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FCreateSharedGroupResult, FCreateSharedGroupDelegate>([this, &request, &Handle](const FCreateSharedGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::CreateSharedGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnCreateSharedGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateSharedGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FCreateSharedGroupResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FCreateSharedGroupResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FCreateSharedGroupResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::DeleteCharacterFromUser(
     ServerModels::FDeleteCharacterFromUserRequest& request,
     const FDeleteCharacterFromUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -418,29 +452,32 @@ bool UPlayFabServerInstanceAPI::DeleteCharacterFromUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/DeleteCharacterFromUser"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnDeleteCharacterFromUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/DeleteCharacterFromUser"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnDeleteCharacterFromUserResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FDeleteCharacterFromUserResult>> UPlayFabServerInstanceAPI::DeleteCharacterFromUserAsync(ServerModels::FDeleteCharacterFromUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FDeleteCharacterFromUserResult, FDeleteCharacterFromUserDelegate>([this, &request, &Handle](const FDeleteCharacterFromUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::DeleteCharacterFromUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnDeleteCharacterFromUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteCharacterFromUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FDeleteCharacterFromUserResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FDeleteCharacterFromUserResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FDeleteCharacterFromUserResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::DeletePlayer(
     ServerModels::FDeletePlayerRequest& request,
     const FDeletePlayerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -448,29 +485,32 @@ bool UPlayFabServerInstanceAPI::DeletePlayer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/DeletePlayer"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnDeletePlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/DeletePlayer"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnDeletePlayerResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FDeletePlayerResult>> UPlayFabServerInstanceAPI::DeletePlayerAsync(ServerModels::FDeletePlayerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FDeletePlayerResult, FDeletePlayerDelegate>([this, &request, &Handle](const FDeletePlayerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::DeletePlayer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnDeletePlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FDeletePlayerResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FDeletePlayerResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FDeletePlayerResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::DeletePushNotificationTemplate(
     ServerModels::FDeletePushNotificationTemplateRequest& request,
     const FDeletePushNotificationTemplateDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -478,29 +518,32 @@ bool UPlayFabServerInstanceAPI::DeletePushNotificationTemplate(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/DeletePushNotificationTemplate"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnDeletePushNotificationTemplateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/DeletePushNotificationTemplate"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnDeletePushNotificationTemplateResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FDeletePushNotificationTemplateResult>> UPlayFabServerInstanceAPI::DeletePushNotificationTemplateAsync(ServerModels::FDeletePushNotificationTemplateRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FDeletePushNotificationTemplateResult, FDeletePushNotificationTemplateDelegate>([this, &request, &Handle](const FDeletePushNotificationTemplateDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::DeletePushNotificationTemplate(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnDeletePushNotificationTemplateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePushNotificationTemplateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FDeletePushNotificationTemplateResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FDeletePushNotificationTemplateResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FDeletePushNotificationTemplateResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::DeleteSharedGroup(
     ServerModels::FDeleteSharedGroupRequest& request,
     const FDeleteSharedGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -508,29 +551,32 @@ bool UPlayFabServerInstanceAPI::DeleteSharedGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/DeleteSharedGroup"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnDeleteSharedGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/DeleteSharedGroup"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnDeleteSharedGroupResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FEmptyResponse>> UPlayFabServerInstanceAPI::DeleteSharedGroupAsync(ServerModels::FDeleteSharedGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FEmptyResponse, FDeleteSharedGroupDelegate>([this, &request, &Handle](const FDeleteSharedGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::DeleteSharedGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnDeleteSharedGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteSharedGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::DeregisterGame(
     ServerModels::FDeregisterGameRequest& request,
     const FDeregisterGameDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -538,29 +584,32 @@ bool UPlayFabServerInstanceAPI::DeregisterGame(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/DeregisterGame"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnDeregisterGameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/DeregisterGame"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnDeregisterGameResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FDeregisterGameResponse>> UPlayFabServerInstanceAPI::DeregisterGameAsync(ServerModels::FDeregisterGameRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FDeregisterGameResponse, FDeregisterGameDelegate>([this, &request, &Handle](const FDeregisterGameDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::DeregisterGame(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnDeregisterGameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeregisterGameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FDeregisterGameResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FDeregisterGameResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FDeregisterGameResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::EvaluateRandomResultTable(
     ServerModels::FEvaluateRandomResultTableRequest& request,
     const FEvaluateRandomResultTableDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -568,29 +617,32 @@ bool UPlayFabServerInstanceAPI::EvaluateRandomResultTable(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/EvaluateRandomResultTable"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnEvaluateRandomResultTableResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/EvaluateRandomResultTable"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnEvaluateRandomResultTableResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FEvaluateRandomResultTableResult>> UPlayFabServerInstanceAPI::EvaluateRandomResultTableAsync(ServerModels::FEvaluateRandomResultTableRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FEvaluateRandomResultTableResult, FEvaluateRandomResultTableDelegate>([this, &request, &Handle](const FEvaluateRandomResultTableDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::EvaluateRandomResultTable(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnEvaluateRandomResultTableResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FEvaluateRandomResultTableDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FEvaluateRandomResultTableResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FEvaluateRandomResultTableResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FEvaluateRandomResultTableResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::ExecuteCloudScript(
     ServerModels::FExecuteCloudScriptServerRequest& request,
     const FExecuteCloudScriptDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -598,37 +650,41 @@ bool UPlayFabServerInstanceAPI::ExecuteCloudScript(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/ExecuteCloudScript"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnExecuteCloudScriptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/ExecuteCloudScript"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnExecuteCloudScriptResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FExecuteCloudScriptResult>> UPlayFabServerInstanceAPI::ExecuteCloudScriptAsync(ServerModels::FExecuteCloudScriptServerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FExecuteCloudScriptResult, FExecuteCloudScriptDelegate>([this, &request, &Handle](const FExecuteCloudScriptDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::ExecuteCloudScript(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnExecuteCloudScriptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExecuteCloudScriptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FExecuteCloudScriptResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FExecuteCloudScriptResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FExecuteCloudScriptResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetAllSegments(
     const FGetAllSegmentsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 { 
     ServerModels::FGetAllSegmentsRequest emptyRequest = ServerModels::FGetAllSegmentsRequest();
-    return UPlayFabServerInstanceAPI::GetAllSegments(emptyRequest, SuccessDelegate, ErrorDelegate);
+    return UPlayFabServerInstanceAPI::GetAllSegments(emptyRequest, SuccessDelegate, ErrorDelegate, Handle);
 }
 
 bool UPlayFabServerInstanceAPI::GetAllSegments(
     ServerModels::FGetAllSegmentsRequest& request,
     const FGetAllSegmentsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -636,29 +692,38 @@ bool UPlayFabServerInstanceAPI::GetAllSegments(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetAllSegments"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetAllSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetAllSegments"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetAllSegmentsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetAllSegmentsResult>> UPlayFabServerInstanceAPI::GetAllSegmentsAsync(const FPlayFabRequestHandle& Handle)
+{
+    ServerModels::FGetAllSegmentsRequest emptyRequest = ServerModels::FGetAllSegmentsRequest();
+    return UPlayFabServerInstanceAPI::GetAllSegmentsAsync(emptyRequest, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetAllSegmentsResult>> UPlayFabServerInstanceAPI::GetAllSegmentsAsync(ServerModels::FGetAllSegmentsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetAllSegmentsResult, FGetAllSegmentsDelegate>([this, &request, &Handle](const FGetAllSegmentsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetAllSegments(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetAllSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAllSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetAllSegmentsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetAllSegmentsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetAllSegmentsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetAllUsersCharacters(
     ServerModels::FListUsersCharactersRequest& request,
     const FGetAllUsersCharactersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -666,29 +731,32 @@ bool UPlayFabServerInstanceAPI::GetAllUsersCharacters(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetAllUsersCharacters"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetAllUsersCharactersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetAllUsersCharacters"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetAllUsersCharactersResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FListUsersCharactersResult>> UPlayFabServerInstanceAPI::GetAllUsersCharactersAsync(ServerModels::FListUsersCharactersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FListUsersCharactersResult, FGetAllUsersCharactersDelegate>([this, &request, &Handle](const FGetAllUsersCharactersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetAllUsersCharacters(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetAllUsersCharactersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAllUsersCharactersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FListUsersCharactersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FListUsersCharactersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FListUsersCharactersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetCatalogItems(
     ServerModels::FGetCatalogItemsRequest& request,
     const FGetCatalogItemsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -696,29 +764,32 @@ bool UPlayFabServerInstanceAPI::GetCatalogItems(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCatalogItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCatalogItems"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetCatalogItemsResult>> UPlayFabServerInstanceAPI::GetCatalogItemsAsync(ServerModels::FGetCatalogItemsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetCatalogItemsResult, FGetCatalogItemsDelegate>([this, &request, &Handle](const FGetCatalogItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetCatalogItems(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetCatalogItemsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetCatalogItemsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetCatalogItemsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetCharacterData(
     ServerModels::FGetCharacterDataRequest& request,
     const FGetCharacterDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -726,29 +797,32 @@ bool UPlayFabServerInstanceAPI::GetCharacterData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCharacterData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetCharacterDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCharacterData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetCharacterDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetCharacterDataResult>> UPlayFabServerInstanceAPI::GetCharacterDataAsync(ServerModels::FGetCharacterDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetCharacterDataResult, FGetCharacterDataDelegate>([this, &request, &Handle](const FGetCharacterDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetCharacterData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetCharacterDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetCharacterDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetCharacterDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetCharacterDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetCharacterInternalData(
     ServerModels::FGetCharacterDataRequest& request,
     const FGetCharacterInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -756,29 +830,32 @@ bool UPlayFabServerInstanceAPI::GetCharacterInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCharacterInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetCharacterInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCharacterInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetCharacterInternalDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetCharacterDataResult>> UPlayFabServerInstanceAPI::GetCharacterInternalDataAsync(ServerModels::FGetCharacterDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetCharacterDataResult, FGetCharacterInternalDataDelegate>([this, &request, &Handle](const FGetCharacterInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetCharacterInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetCharacterInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetCharacterDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetCharacterDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetCharacterDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetCharacterInventory(
     ServerModels::FGetCharacterInventoryRequest& request,
     const FGetCharacterInventoryDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -786,29 +863,32 @@ bool UPlayFabServerInstanceAPI::GetCharacterInventory(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCharacterInventory"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetCharacterInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCharacterInventory"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetCharacterInventoryResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetCharacterInventoryResult>> UPlayFabServerInstanceAPI::GetCharacterInventoryAsync(ServerModels::FGetCharacterInventoryRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetCharacterInventoryResult, FGetCharacterInventoryDelegate>([this, &request, &Handle](const FGetCharacterInventoryDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetCharacterInventory(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetCharacterInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetCharacterInventoryResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetCharacterInventoryResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetCharacterInventoryResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetCharacterLeaderboard(
     ServerModels::FGetCharacterLeaderboardRequest& request,
     const FGetCharacterLeaderboardDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -816,29 +896,32 @@ bool UPlayFabServerInstanceAPI::GetCharacterLeaderboard(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCharacterLeaderboard"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetCharacterLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCharacterLeaderboard"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetCharacterLeaderboardResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetCharacterLeaderboardResult>> UPlayFabServerInstanceAPI::GetCharacterLeaderboardAsync(ServerModels::FGetCharacterLeaderboardRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetCharacterLeaderboardResult, FGetCharacterLeaderboardDelegate>([this, &request, &Handle](const FGetCharacterLeaderboardDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetCharacterLeaderboard(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetCharacterLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetCharacterLeaderboardResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetCharacterLeaderboardResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetCharacterLeaderboardResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetCharacterReadOnlyData(
     ServerModels::FGetCharacterDataRequest& request,
     const FGetCharacterReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -846,29 +929,32 @@ bool UPlayFabServerInstanceAPI::GetCharacterReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCharacterReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetCharacterReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCharacterReadOnlyData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetCharacterReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetCharacterDataResult>> UPlayFabServerInstanceAPI::GetCharacterReadOnlyDataAsync(ServerModels::FGetCharacterDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetCharacterDataResult, FGetCharacterReadOnlyDataDelegate>([this, &request, &Handle](const FGetCharacterReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetCharacterReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetCharacterReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetCharacterDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetCharacterDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetCharacterDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetCharacterStatistics(
     ServerModels::FGetCharacterStatisticsRequest& request,
     const FGetCharacterStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -876,29 +962,32 @@ bool UPlayFabServerInstanceAPI::GetCharacterStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCharacterStatistics"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetCharacterStatistics"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetCharacterStatisticsResult>> UPlayFabServerInstanceAPI::GetCharacterStatisticsAsync(ServerModels::FGetCharacterStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetCharacterStatisticsResult, FGetCharacterStatisticsDelegate>([this, &request, &Handle](const FGetCharacterStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetCharacterStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetCharacterStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetCharacterStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetCharacterStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetContentDownloadUrl(
     ServerModels::FGetContentDownloadUrlRequest& request,
     const FGetContentDownloadUrlDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -906,29 +995,32 @@ bool UPlayFabServerInstanceAPI::GetContentDownloadUrl(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetContentDownloadUrl"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetContentDownloadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetContentDownloadUrl"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetContentDownloadUrlResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetContentDownloadUrlResult>> UPlayFabServerInstanceAPI::GetContentDownloadUrlAsync(ServerModels::FGetContentDownloadUrlRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetContentDownloadUrlResult, FGetContentDownloadUrlDelegate>([this, &request, &Handle](const FGetContentDownloadUrlDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetContentDownloadUrl(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetContentDownloadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContentDownloadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetContentDownloadUrlResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetContentDownloadUrlResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetContentDownloadUrlResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetFriendLeaderboard(
     ServerModels::FGetFriendLeaderboardRequest& request,
     const FGetFriendLeaderboardDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -936,29 +1028,32 @@ bool UPlayFabServerInstanceAPI::GetFriendLeaderboard(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetFriendLeaderboard"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetFriendLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetFriendLeaderboard"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetFriendLeaderboardResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetLeaderboardResult>> UPlayFabServerInstanceAPI::GetFriendLeaderboardAsync(ServerModels::FGetFriendLeaderboardRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetLeaderboardResult, FGetFriendLeaderboardDelegate>([this, &request, &Handle](const FGetFriendLeaderboardDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetFriendLeaderboard(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetFriendLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetLeaderboardResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetLeaderboardResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetLeaderboardResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetFriendsList(
     ServerModels::FGetFriendsListRequest& request,
     const FGetFriendsListDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -966,29 +1061,32 @@ bool UPlayFabServerInstanceAPI::GetFriendsList(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetFriendsList"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetFriendsListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetFriendsList"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetFriendsListResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetFriendsListResult>> UPlayFabServerInstanceAPI::GetFriendsListAsync(ServerModels::FGetFriendsListRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetFriendsListResult, FGetFriendsListDelegate>([this, &request, &Handle](const FGetFriendsListDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetFriendsList(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetFriendsListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendsListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetFriendsListResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetFriendsListResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetFriendsListResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetLeaderboard(
     ServerModels::FGetLeaderboardRequest& request,
     const FGetLeaderboardDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -996,29 +1094,32 @@ bool UPlayFabServerInstanceAPI::GetLeaderboard(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetLeaderboard"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetLeaderboard"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetLeaderboardResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetLeaderboardResult>> UPlayFabServerInstanceAPI::GetLeaderboardAsync(ServerModels::FGetLeaderboardRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetLeaderboardResult, FGetLeaderboardDelegate>([this, &request, &Handle](const FGetLeaderboardDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetLeaderboard(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetLeaderboardResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetLeaderboardResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetLeaderboardResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetLeaderboardAroundCharacter(
     ServerModels::FGetLeaderboardAroundCharacterRequest& request,
     const FGetLeaderboardAroundCharacterDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1026,29 +1127,32 @@ bool UPlayFabServerInstanceAPI::GetLeaderboardAroundCharacter(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetLeaderboardAroundCharacter"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetLeaderboardAroundCharacterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetLeaderboardAroundCharacter"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetLeaderboardAroundCharacterResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetLeaderboardAroundCharacterResult>> UPlayFabServerInstanceAPI::GetLeaderboardAroundCharacterAsync(ServerModels::FGetLeaderboardAroundCharacterRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetLeaderboardAroundCharacterResult, FGetLeaderboardAroundCharacterDelegate>([this, &request, &Handle](const FGetLeaderboardAroundCharacterDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetLeaderboardAroundCharacter(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetLeaderboardAroundCharacterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardAroundCharacterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetLeaderboardAroundCharacterResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetLeaderboardAroundCharacterResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetLeaderboardAroundCharacterResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetLeaderboardAroundUser(
     ServerModels::FGetLeaderboardAroundUserRequest& request,
     const FGetLeaderboardAroundUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1056,29 +1160,32 @@ bool UPlayFabServerInstanceAPI::GetLeaderboardAroundUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetLeaderboardAroundUser"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetLeaderboardAroundUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetLeaderboardAroundUser"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetLeaderboardAroundUserResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetLeaderboardAroundUserResult>> UPlayFabServerInstanceAPI::GetLeaderboardAroundUserAsync(ServerModels::FGetLeaderboardAroundUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetLeaderboardAroundUserResult, FGetLeaderboardAroundUserDelegate>([this, &request, &Handle](const FGetLeaderboardAroundUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetLeaderboardAroundUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetLeaderboardAroundUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardAroundUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetLeaderboardAroundUserResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetLeaderboardAroundUserResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetLeaderboardAroundUserResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetLeaderboardForUserCharacters(
     ServerModels::FGetLeaderboardForUsersCharactersRequest& request,
     const FGetLeaderboardForUserCharactersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1086,29 +1193,32 @@ bool UPlayFabServerInstanceAPI::GetLeaderboardForUserCharacters(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetLeaderboardForUserCharacters"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetLeaderboardForUserCharactersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetLeaderboardForUserCharacters"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetLeaderboardForUserCharactersResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetLeaderboardForUsersCharactersResult>> UPlayFabServerInstanceAPI::GetLeaderboardForUserCharactersAsync(ServerModels::FGetLeaderboardForUsersCharactersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetLeaderboardForUsersCharactersResult, FGetLeaderboardForUserCharactersDelegate>([this, &request, &Handle](const FGetLeaderboardForUserCharactersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetLeaderboardForUserCharacters(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetLeaderboardForUserCharactersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardForUserCharactersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetLeaderboardForUsersCharactersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetLeaderboardForUsersCharactersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetLeaderboardForUsersCharactersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetPlayerCombinedInfo(
     ServerModels::FGetPlayerCombinedInfoRequest& request,
     const FGetPlayerCombinedInfoDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1116,29 +1226,32 @@ bool UPlayFabServerInstanceAPI::GetPlayerCombinedInfo(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerCombinedInfo"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayerCombinedInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerCombinedInfo"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetPlayerCombinedInfoResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayerCombinedInfoResult>> UPlayFabServerInstanceAPI::GetPlayerCombinedInfoAsync(ServerModels::FGetPlayerCombinedInfoRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayerCombinedInfoResult, FGetPlayerCombinedInfoDelegate>([this, &request, &Handle](const FGetPlayerCombinedInfoDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetPlayerCombinedInfo(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayerCombinedInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerCombinedInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayerCombinedInfoResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayerCombinedInfoResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayerCombinedInfoResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetPlayerProfile(
     ServerModels::FGetPlayerProfileRequest& request,
     const FGetPlayerProfileDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1146,29 +1259,32 @@ bool UPlayFabServerInstanceAPI::GetPlayerProfile(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerProfile"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayerProfileResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerProfile"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetPlayerProfileResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayerProfileResult>> UPlayFabServerInstanceAPI::GetPlayerProfileAsync(ServerModels::FGetPlayerProfileRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayerProfileResult, FGetPlayerProfileDelegate>([this, &request, &Handle](const FGetPlayerProfileDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetPlayerProfile(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayerProfileResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerProfileDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayerProfileResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayerProfileResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayerProfileResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetPlayerSegments(
     ServerModels::FGetPlayersSegmentsRequest& request,
     const FGetPlayerSegmentsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1176,29 +1292,32 @@ bool UPlayFabServerInstanceAPI::GetPlayerSegments(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerSegments"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayerSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerSegments"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetPlayerSegmentsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayerSegmentsResult>> UPlayFabServerInstanceAPI::GetPlayerSegmentsAsync(ServerModels::FGetPlayersSegmentsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayerSegmentsResult, FGetPlayerSegmentsDelegate>([this, &request, &Handle](const FGetPlayerSegmentsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetPlayerSegments(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayerSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayerSegmentsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayerSegmentsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayerSegmentsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetPlayersInSegment(
     ServerModels::FGetPlayersInSegmentRequest& request,
     const FGetPlayersInSegmentDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1206,29 +1325,32 @@ bool UPlayFabServerInstanceAPI::GetPlayersInSegment(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayersInSegment"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayersInSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayersInSegment"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetPlayersInSegmentResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayersInSegmentResult>> UPlayFabServerInstanceAPI::GetPlayersInSegmentAsync(ServerModels::FGetPlayersInSegmentRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayersInSegmentResult, FGetPlayersInSegmentDelegate>([this, &request, &Handle](const FGetPlayersInSegmentDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetPlayersInSegment(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayersInSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayersInSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayersInSegmentResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayersInSegmentResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayersInSegmentResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetPlayerStatistics(
     ServerModels::FGetPlayerStatisticsRequest& request,
     const FGetPlayerStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1236,29 +1358,32 @@ bool UPlayFabServerInstanceAPI::GetPlayerStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerStatistics"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerStatistics"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetPlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayerStatisticsResult>> UPlayFabServerInstanceAPI::GetPlayerStatisticsAsync(ServerModels::FGetPlayerStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayerStatisticsResult, FGetPlayerStatisticsDelegate>([this, &request, &Handle](const FGetPlayerStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetPlayerStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayerStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayerStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayerStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayerStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetPlayerStatisticVersions(
     ServerModels::FGetPlayerStatisticVersionsRequest& request,
     const FGetPlayerStatisticVersionsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1266,29 +1391,32 @@ bool UPlayFabServerInstanceAPI::GetPlayerStatisticVersions(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerStatisticVersions"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayerStatisticVersionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerStatisticVersions"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetPlayerStatisticVersionsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayerStatisticVersionsResult>> UPlayFabServerInstanceAPI::GetPlayerStatisticVersionsAsync(ServerModels::FGetPlayerStatisticVersionsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayerStatisticVersionsResult, FGetPlayerStatisticVersionsDelegate>([this, &request, &Handle](const FGetPlayerStatisticVersionsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetPlayerStatisticVersions(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayerStatisticVersionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticVersionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayerStatisticVersionsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayerStatisticVersionsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayerStatisticVersionsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetPlayerTags(
     ServerModels::FGetPlayerTagsRequest& request,
     const FGetPlayerTagsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1296,29 +1424,32 @@ bool UPlayFabServerInstanceAPI::GetPlayerTags(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerTags"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayerTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayerTags"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetPlayerTagsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayerTagsResult>> UPlayFabServerInstanceAPI::GetPlayerTagsAsync(ServerModels::FGetPlayerTagsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayerTagsResult, FGetPlayerTagsDelegate>([this, &request, &Handle](const FGetPlayerTagsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetPlayerTags(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayerTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayerTagsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayerTagsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayerTagsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromFacebookIDs(
     ServerModels::FGetPlayFabIDsFromFacebookIDsRequest& request,
     const FGetPlayFabIDsFromFacebookIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1326,29 +1457,32 @@ bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromFacebookIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromFacebookIDs"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromFacebookIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromFacebookIDs"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromFacebookIDsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayFabIDsFromFacebookIDsResult>> UPlayFabServerInstanceAPI::GetPlayFabIDsFromFacebookIDsAsync(ServerModels::FGetPlayFabIDsFromFacebookIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayFabIDsFromFacebookIDsResult, FGetPlayFabIDsFromFacebookIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromFacebookIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetPlayFabIDsFromFacebookIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromFacebookIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromFacebookIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayFabIDsFromFacebookIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayFabIDsFromFacebookIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayFabIDsFromFacebookIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
     ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& request,
     const FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1356,29 +1490,32 @@ bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromFacebookInstantGamesIds"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromFacebookInstantGamesIds"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult>> UPlayFabServerInstanceAPI::GetPlayFabIDsFromFacebookInstantGamesIdsAsync(ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult, FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetPlayFabIDsFromFacebookInstantGamesIds(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromGenericIDs(
     ServerModels::FGetPlayFabIDsFromGenericIDsRequest& request,
     const FGetPlayFabIDsFromGenericIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1386,29 +1523,32 @@ bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromGenericIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromGenericIDs"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromGenericIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromGenericIDs"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromGenericIDsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayFabIDsFromGenericIDsResult>> UPlayFabServerInstanceAPI::GetPlayFabIDsFromGenericIDsAsync(ServerModels::FGetPlayFabIDsFromGenericIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayFabIDsFromGenericIDsResult, FGetPlayFabIDsFromGenericIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromGenericIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetPlayFabIDsFromGenericIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromGenericIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGenericIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayFabIDsFromGenericIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayFabIDsFromGenericIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayFabIDsFromGenericIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
     ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& request,
     const FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1416,29 +1556,32 @@ bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromNintendoSwitchDeviceIds"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromNintendoSwitchDeviceIds"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult>> UPlayFabServerInstanceAPI::GetPlayFabIDsFromNintendoSwitchDeviceIdsAsync(ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult, FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromPSNAccountIDs(
     ServerModels::FGetPlayFabIDsFromPSNAccountIDsRequest& request,
     const FGetPlayFabIDsFromPSNAccountIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1446,29 +1589,32 @@ bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromPSNAccountIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromPSNAccountIDs"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromPSNAccountIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromPSNAccountIDs"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromPSNAccountIDsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult>> UPlayFabServerInstanceAPI::GetPlayFabIDsFromPSNAccountIDsAsync(ServerModels::FGetPlayFabIDsFromPSNAccountIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult, FGetPlayFabIDsFromPSNAccountIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromPSNAccountIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetPlayFabIDsFromPSNAccountIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromPSNAccountIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromPSNAccountIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromSteamIDs(
     ServerModels::FGetPlayFabIDsFromSteamIDsRequest& request,
     const FGetPlayFabIDsFromSteamIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1476,29 +1622,32 @@ bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromSteamIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromSteamIDs"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromSteamIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromSteamIDs"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromSteamIDsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayFabIDsFromSteamIDsResult>> UPlayFabServerInstanceAPI::GetPlayFabIDsFromSteamIDsAsync(ServerModels::FGetPlayFabIDsFromSteamIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayFabIDsFromSteamIDsResult, FGetPlayFabIDsFromSteamIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromSteamIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetPlayFabIDsFromSteamIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromSteamIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromSteamIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayFabIDsFromSteamIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayFabIDsFromSteamIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayFabIDsFromSteamIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromXboxLiveIDs(
     ServerModels::FGetPlayFabIDsFromXboxLiveIDsRequest& request,
     const FGetPlayFabIDsFromXboxLiveIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1506,29 +1655,32 @@ bool UPlayFabServerInstanceAPI::GetPlayFabIDsFromXboxLiveIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromXboxLiveIDs"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromXboxLiveIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPlayFabIDsFromXboxLiveIDs"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromXboxLiveIDsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult>> UPlayFabServerInstanceAPI::GetPlayFabIDsFromXboxLiveIDsAsync(ServerModels::FGetPlayFabIDsFromXboxLiveIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult, FGetPlayFabIDsFromXboxLiveIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromXboxLiveIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetPlayFabIDsFromXboxLiveIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetPlayFabIDsFromXboxLiveIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromXboxLiveIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetPublisherData(
     ServerModels::FGetPublisherDataRequest& request,
     const FGetPublisherDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1536,29 +1688,32 @@ bool UPlayFabServerInstanceAPI::GetPublisherData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetPublisherData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetPublisherDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPublisherDataResult>> UPlayFabServerInstanceAPI::GetPublisherDataAsync(ServerModels::FGetPublisherDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPublisherDataResult, FGetPublisherDataDelegate>([this, &request, &Handle](const FGetPublisherDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetPublisherData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPublisherDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPublisherDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPublisherDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetRandomResultTables(
     ServerModels::FGetRandomResultTablesRequest& request,
     const FGetRandomResultTablesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1566,29 +1721,32 @@ bool UPlayFabServerInstanceAPI::GetRandomResultTables(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetRandomResultTables"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetRandomResultTablesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetRandomResultTables"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetRandomResultTablesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetRandomResultTablesResult>> UPlayFabServerInstanceAPI::GetRandomResultTablesAsync(ServerModels::FGetRandomResultTablesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetRandomResultTablesResult, FGetRandomResultTablesDelegate>([this, &request, &Handle](const FGetRandomResultTablesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetRandomResultTables(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetRandomResultTablesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetRandomResultTablesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetRandomResultTablesResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetRandomResultTablesResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetRandomResultTablesResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetServerCustomIDsFromPlayFabIDs(
     ServerModels::FGetServerCustomIDsFromPlayFabIDsRequest& request,
     const FGetServerCustomIDsFromPlayFabIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1596,29 +1754,32 @@ bool UPlayFabServerInstanceAPI::GetServerCustomIDsFromPlayFabIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetServerCustomIDsFromPlayFabIDs"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetServerCustomIDsFromPlayFabIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetServerCustomIDsFromPlayFabIDs"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetServerCustomIDsFromPlayFabIDsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetServerCustomIDsFromPlayFabIDsResult>> UPlayFabServerInstanceAPI::GetServerCustomIDsFromPlayFabIDsAsync(ServerModels::FGetServerCustomIDsFromPlayFabIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetServerCustomIDsFromPlayFabIDsResult, FGetServerCustomIDsFromPlayFabIDsDelegate>([this, &request, &Handle](const FGetServerCustomIDsFromPlayFabIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetServerCustomIDsFromPlayFabIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetServerCustomIDsFromPlayFabIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetServerCustomIDsFromPlayFabIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetServerCustomIDsFromPlayFabIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetServerCustomIDsFromPlayFabIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetServerCustomIDsFromPlayFabIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetSharedGroupData(
     ServerModels::FGetSharedGroupDataRequest& request,
     const FGetSharedGroupDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1626,29 +1787,32 @@ bool UPlayFabServerInstanceAPI::GetSharedGroupData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetSharedGroupData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetSharedGroupData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetSharedGroupDataResult>> UPlayFabServerInstanceAPI::GetSharedGroupDataAsync(ServerModels::FGetSharedGroupDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetSharedGroupDataResult, FGetSharedGroupDataDelegate>([this, &request, &Handle](const FGetSharedGroupDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetSharedGroupData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetSharedGroupDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSharedGroupDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetSharedGroupDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetSharedGroupDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetSharedGroupDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetStoreItems(
     ServerModels::FGetStoreItemsServerRequest& request,
     const FGetStoreItemsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1656,37 +1820,41 @@ bool UPlayFabServerInstanceAPI::GetStoreItems(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetStoreItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetStoreItems"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetStoreItemsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetStoreItemsResult>> UPlayFabServerInstanceAPI::GetStoreItemsAsync(ServerModels::FGetStoreItemsServerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetStoreItemsResult, FGetStoreItemsDelegate>([this, &request, &Handle](const FGetStoreItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetStoreItems(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetStoreItemsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetStoreItemsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetStoreItemsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetTime(
     const FGetTimeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 { 
     ServerModels::FGetTimeRequest emptyRequest = ServerModels::FGetTimeRequest();
-    return UPlayFabServerInstanceAPI::GetTime(emptyRequest, SuccessDelegate, ErrorDelegate);
+    return UPlayFabServerInstanceAPI::GetTime(emptyRequest, SuccessDelegate, ErrorDelegate, Handle);
 }
 
 bool UPlayFabServerInstanceAPI::GetTime(
     ServerModels::FGetTimeRequest& request,
     const FGetTimeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1694,29 +1862,38 @@ bool UPlayFabServerInstanceAPI::GetTime(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetTime"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetTimeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetTime"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetTimeResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetTimeResult>> UPlayFabServerInstanceAPI::GetTimeAsync(const FPlayFabRequestHandle& Handle)
+{
+    ServerModels::FGetTimeRequest emptyRequest = ServerModels::FGetTimeRequest();
+    return UPlayFabServerInstanceAPI::GetTimeAsync(emptyRequest, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetTimeResult>> UPlayFabServerInstanceAPI::GetTimeAsync(ServerModels::FGetTimeRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetTimeResult, FGetTimeDelegate>([this, &request, &Handle](const FGetTimeDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetTime(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetTimeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTimeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetTimeResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetTimeResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetTimeResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetTitleData(
     ServerModels::FGetTitleDataRequest& request,
     const FGetTitleDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1724,29 +1901,32 @@ bool UPlayFabServerInstanceAPI::GetTitleData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetTitleData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetTitleData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetTitleDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetTitleDataResult>> UPlayFabServerInstanceAPI::GetTitleDataAsync(ServerModels::FGetTitleDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetTitleDataResult, FGetTitleDataDelegate>([this, &request, &Handle](const FGetTitleDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetTitleData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetTitleDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetTitleDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetTitleDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetTitleInternalData(
     ServerModels::FGetTitleDataRequest& request,
     const FGetTitleInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1754,29 +1934,32 @@ bool UPlayFabServerInstanceAPI::GetTitleInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetTitleInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetTitleInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetTitleDataResult>> UPlayFabServerInstanceAPI::GetTitleInternalDataAsync(ServerModels::FGetTitleDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetTitleDataResult, FGetTitleInternalDataDelegate>([this, &request, &Handle](const FGetTitleInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetTitleInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetTitleInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetTitleDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetTitleDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetTitleDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetTitleNews(
     ServerModels::FGetTitleNewsRequest& request,
     const FGetTitleNewsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1784,29 +1967,32 @@ bool UPlayFabServerInstanceAPI::GetTitleNews(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetTitleNews"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetTitleNewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetTitleNews"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetTitleNewsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetTitleNewsResult>> UPlayFabServerInstanceAPI::GetTitleNewsAsync(ServerModels::FGetTitleNewsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetTitleNewsResult, FGetTitleNewsDelegate>([this, &request, &Handle](const FGetTitleNewsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetTitleNews(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetTitleNewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleNewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetTitleNewsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetTitleNewsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetTitleNewsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetUserAccountInfo(
     ServerModels::FGetUserAccountInfoRequest& request,
     const FGetUserAccountInfoDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1814,29 +2000,32 @@ bool UPlayFabServerInstanceAPI::GetUserAccountInfo(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserAccountInfo"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetUserAccountInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserAccountInfo"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetUserAccountInfoResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetUserAccountInfoResult>> UPlayFabServerInstanceAPI::GetUserAccountInfoAsync(ServerModels::FGetUserAccountInfoRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetUserAccountInfoResult, FGetUserAccountInfoDelegate>([this, &request, &Handle](const FGetUserAccountInfoDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetUserAccountInfo(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetUserAccountInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserAccountInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetUserAccountInfoResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetUserAccountInfoResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetUserAccountInfoResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetUserBans(
     ServerModels::FGetUserBansRequest& request,
     const FGetUserBansDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1844,29 +2033,32 @@ bool UPlayFabServerInstanceAPI::GetUserBans(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserBans"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetUserBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserBans"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetUserBansResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetUserBansResult>> UPlayFabServerInstanceAPI::GetUserBansAsync(ServerModels::FGetUserBansRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetUserBansResult, FGetUserBansDelegate>([this, &request, &Handle](const FGetUserBansDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetUserBans(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetUserBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetUserBansResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetUserBansResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetUserBansResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetUserData(
     ServerModels::FGetUserDataRequest& request,
     const FGetUserDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1874,29 +2066,32 @@ bool UPlayFabServerInstanceAPI::GetUserData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetUserDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
 }
 
-void UPlayFabServerInstanceAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
+TFuture<TPlayFabResult<ServerModels::FGetUserDataResult>> UPlayFabServerInstanceAPI::GetUserDataAsync(ServerModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
 {
-    ServerModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    return MakePlayFabFuture<ServerModels::FGetUserDataResult, FGetUserDataDelegate>([this, &request, &Handle](const FGetUserDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
     {
-        SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
+        return UPlayFabServerInstanceAPI::GetUserData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
+}
+
+void UPlayFabServerInstanceAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
+{
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetUserDataResult& outResult)
     {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+        SuccessDelegate.ExecuteIfBound(outResult);
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetUserInternalData(
     ServerModels::FGetUserDataRequest& request,
     const FGetUserInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1904,29 +2099,32 @@ bool UPlayFabServerInstanceAPI::GetUserInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetUserInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetUserInternalDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetUserDataResult>> UPlayFabServerInstanceAPI::GetUserInternalDataAsync(ServerModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetUserDataResult, FGetUserInternalDataDelegate>([this, &request, &Handle](const FGetUserInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetUserInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetUserInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetUserInventory(
     ServerModels::FGetUserInventoryRequest& request,
     const FGetUserInventoryDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1934,29 +2132,32 @@ bool UPlayFabServerInstanceAPI::GetUserInventory(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserInventory"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetUserInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserInventory"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetUserInventoryResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetUserInventoryResult>> UPlayFabServerInstanceAPI::GetUserInventoryAsync(ServerModels::FGetUserInventoryRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetUserInventoryResult, FGetUserInventoryDelegate>([this, &request, &Handle](const FGetUserInventoryDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetUserInventory(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetUserInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetUserInventoryResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetUserInventoryResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetUserInventoryResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetUserPublisherData(
     ServerModels::FGetUserDataRequest& request,
     const FGetUserPublisherDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1964,29 +2165,32 @@ bool UPlayFabServerInstanceAPI::GetUserPublisherData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserPublisherData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetUserDataResult>> UPlayFabServerInstanceAPI::GetUserPublisherDataAsync(ServerModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetUserDataResult, FGetUserPublisherDataDelegate>([this, &request, &Handle](const FGetUserPublisherDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetUserPublisherData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetUserPublisherInternalData(
     ServerModels::FGetUserDataRequest& request,
     const FGetUserPublisherInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1994,29 +2198,32 @@ bool UPlayFabServerInstanceAPI::GetUserPublisherInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserPublisherInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserPublisherInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetUserDataResult>> UPlayFabServerInstanceAPI::GetUserPublisherInternalDataAsync(ServerModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetUserDataResult, FGetUserPublisherInternalDataDelegate>([this, &request, &Handle](const FGetUserPublisherInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetUserPublisherInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetUserPublisherInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetUserPublisherReadOnlyData(
     ServerModels::FGetUserDataRequest& request,
     const FGetUserPublisherReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2024,29 +2231,32 @@ bool UPlayFabServerInstanceAPI::GetUserPublisherReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserPublisherReadOnlyData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetUserDataResult>> UPlayFabServerInstanceAPI::GetUserPublisherReadOnlyDataAsync(ServerModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetUserDataResult, FGetUserPublisherReadOnlyDataDelegate>([this, &request, &Handle](const FGetUserPublisherReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetUserPublisherReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GetUserReadOnlyData(
     ServerModels::FGetUserDataRequest& request,
     const FGetUserReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2054,29 +2264,32 @@ bool UPlayFabServerInstanceAPI::GetUserReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGetUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GetUserReadOnlyData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGetUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetUserDataResult>> UPlayFabServerInstanceAPI::GetUserReadOnlyDataAsync(ServerModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetUserDataResult, FGetUserReadOnlyDataDelegate>([this, &request, &Handle](const FGetUserReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GetUserReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGetUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GrantCharacterToUser(
     ServerModels::FGrantCharacterToUserRequest& request,
     const FGrantCharacterToUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2084,29 +2297,32 @@ bool UPlayFabServerInstanceAPI::GrantCharacterToUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GrantCharacterToUser"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGrantCharacterToUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GrantCharacterToUser"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGrantCharacterToUserResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGrantCharacterToUserResult>> UPlayFabServerInstanceAPI::GrantCharacterToUserAsync(ServerModels::FGrantCharacterToUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGrantCharacterToUserResult, FGrantCharacterToUserDelegate>([this, &request, &Handle](const FGrantCharacterToUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GrantCharacterToUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGrantCharacterToUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantCharacterToUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGrantCharacterToUserResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGrantCharacterToUserResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGrantCharacterToUserResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GrantItemsToCharacter(
     ServerModels::FGrantItemsToCharacterRequest& request,
     const FGrantItemsToCharacterDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2114,29 +2330,32 @@ bool UPlayFabServerInstanceAPI::GrantItemsToCharacter(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GrantItemsToCharacter"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGrantItemsToCharacterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GrantItemsToCharacter"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGrantItemsToCharacterResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGrantItemsToCharacterResult>> UPlayFabServerInstanceAPI::GrantItemsToCharacterAsync(ServerModels::FGrantItemsToCharacterRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGrantItemsToCharacterResult, FGrantItemsToCharacterDelegate>([this, &request, &Handle](const FGrantItemsToCharacterDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GrantItemsToCharacter(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGrantItemsToCharacterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantItemsToCharacterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGrantItemsToCharacterResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGrantItemsToCharacterResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGrantItemsToCharacterResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GrantItemsToUser(
     ServerModels::FGrantItemsToUserRequest& request,
     const FGrantItemsToUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2144,29 +2363,32 @@ bool UPlayFabServerInstanceAPI::GrantItemsToUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GrantItemsToUser"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGrantItemsToUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GrantItemsToUser"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGrantItemsToUserResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGrantItemsToUserResult>> UPlayFabServerInstanceAPI::GrantItemsToUserAsync(ServerModels::FGrantItemsToUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGrantItemsToUserResult, FGrantItemsToUserDelegate>([this, &request, &Handle](const FGrantItemsToUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GrantItemsToUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGrantItemsToUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantItemsToUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGrantItemsToUserResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGrantItemsToUserResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGrantItemsToUserResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::GrantItemsToUsers(
     ServerModels::FGrantItemsToUsersRequest& request,
     const FGrantItemsToUsersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2174,29 +2396,32 @@ bool UPlayFabServerInstanceAPI::GrantItemsToUsers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GrantItemsToUsers"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnGrantItemsToUsersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/GrantItemsToUsers"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnGrantItemsToUsersResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGrantItemsToUsersResult>> UPlayFabServerInstanceAPI::GrantItemsToUsersAsync(ServerModels::FGrantItemsToUsersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGrantItemsToUsersResult, FGrantItemsToUsersDelegate>([this, &request, &Handle](const FGrantItemsToUsersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::GrantItemsToUsers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnGrantItemsToUsersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantItemsToUsersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGrantItemsToUsersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGrantItemsToUsersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGrantItemsToUsersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::LinkPSNAccount(
     ServerModels::FLinkPSNAccountRequest& request,
     const FLinkPSNAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2204,29 +2429,32 @@ bool UPlayFabServerInstanceAPI::LinkPSNAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LinkPSNAccount"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LinkPSNAccount"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnLinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FLinkPSNAccountResult>> UPlayFabServerInstanceAPI::LinkPSNAccountAsync(ServerModels::FLinkPSNAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FLinkPSNAccountResult, FLinkPSNAccountDelegate>([this, &request, &Handle](const FLinkPSNAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::LinkPSNAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnLinkPSNAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkPSNAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FLinkPSNAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FLinkPSNAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FLinkPSNAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::LinkServerCustomId(
     ServerModels::FLinkServerCustomIdRequest& request,
     const FLinkServerCustomIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2234,29 +2462,32 @@ bool UPlayFabServerInstanceAPI::LinkServerCustomId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LinkServerCustomId"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLinkServerCustomIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LinkServerCustomId"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnLinkServerCustomIdResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FLinkServerCustomIdResult>> UPlayFabServerInstanceAPI::LinkServerCustomIdAsync(ServerModels::FLinkServerCustomIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FLinkServerCustomIdResult, FLinkServerCustomIdDelegate>([this, &request, &Handle](const FLinkServerCustomIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::LinkServerCustomId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnLinkServerCustomIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkServerCustomIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FLinkServerCustomIdResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FLinkServerCustomIdResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FLinkServerCustomIdResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::LinkXboxAccount(
     ServerModels::FLinkXboxAccountRequest& request,
     const FLinkXboxAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2264,29 +2495,32 @@ bool UPlayFabServerInstanceAPI::LinkXboxAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LinkXboxAccount"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LinkXboxAccount"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnLinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FLinkXboxAccountResult>> UPlayFabServerInstanceAPI::LinkXboxAccountAsync(ServerModels::FLinkXboxAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FLinkXboxAccountResult, FLinkXboxAccountDelegate>([this, &request, &Handle](const FLinkXboxAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::LinkXboxAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnLinkXboxAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkXboxAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FLinkXboxAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FLinkXboxAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FLinkXboxAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::LoginWithServerCustomId(
     ServerModels::FLoginWithServerCustomIdRequest& request,
     const FLoginWithServerCustomIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2294,29 +2528,32 @@ bool UPlayFabServerInstanceAPI::LoginWithServerCustomId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LoginWithServerCustomId"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLoginWithServerCustomIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LoginWithServerCustomId"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnLoginWithServerCustomIdResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FServerLoginResult>> UPlayFabServerInstanceAPI::LoginWithServerCustomIdAsync(ServerModels::FLoginWithServerCustomIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FServerLoginResult, FLoginWithServerCustomIdDelegate>([this, &request, &Handle](const FLoginWithServerCustomIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::LoginWithServerCustomId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnLoginWithServerCustomIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithServerCustomIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FServerLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FServerLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FServerLoginResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::LoginWithSteamId(
     ServerModels::FLoginWithSteamIdRequest& request,
     const FLoginWithSteamIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2324,29 +2561,32 @@ bool UPlayFabServerInstanceAPI::LoginWithSteamId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LoginWithSteamId"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLoginWithSteamIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LoginWithSteamId"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnLoginWithSteamIdResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FServerLoginResult>> UPlayFabServerInstanceAPI::LoginWithSteamIdAsync(ServerModels::FLoginWithSteamIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FServerLoginResult, FLoginWithSteamIdDelegate>([this, &request, &Handle](const FLoginWithSteamIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::LoginWithSteamId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnLoginWithSteamIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithSteamIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FServerLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FServerLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FServerLoginResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::LoginWithXbox(
     ServerModels::FLoginWithXboxRequest& request,
     const FLoginWithXboxDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2354,29 +2594,32 @@ bool UPlayFabServerInstanceAPI::LoginWithXbox(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LoginWithXbox"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLoginWithXboxResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LoginWithXbox"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnLoginWithXboxResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FServerLoginResult>> UPlayFabServerInstanceAPI::LoginWithXboxAsync(ServerModels::FLoginWithXboxRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FServerLoginResult, FLoginWithXboxDelegate>([this, &request, &Handle](const FLoginWithXboxDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::LoginWithXbox(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnLoginWithXboxResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithXboxDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FServerLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FServerLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FServerLoginResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::LoginWithXboxId(
     ServerModels::FLoginWithXboxIdRequest& request,
     const FLoginWithXboxIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2384,29 +2627,32 @@ bool UPlayFabServerInstanceAPI::LoginWithXboxId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LoginWithXboxId"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnLoginWithXboxIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/LoginWithXboxId"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnLoginWithXboxIdResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FServerLoginResult>> UPlayFabServerInstanceAPI::LoginWithXboxIdAsync(ServerModels::FLoginWithXboxIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FServerLoginResult, FLoginWithXboxIdDelegate>([this, &request, &Handle](const FLoginWithXboxIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::LoginWithXboxId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnLoginWithXboxIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithXboxIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FServerLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FServerLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FServerLoginResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::ModifyItemUses(
     ServerModels::FModifyItemUsesRequest& request,
     const FModifyItemUsesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2414,29 +2660,32 @@ bool UPlayFabServerInstanceAPI::ModifyItemUses(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/ModifyItemUses"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnModifyItemUsesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/ModifyItemUses"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnModifyItemUsesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FModifyItemUsesResult>> UPlayFabServerInstanceAPI::ModifyItemUsesAsync(ServerModels::FModifyItemUsesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FModifyItemUsesResult, FModifyItemUsesDelegate>([this, &request, &Handle](const FModifyItemUsesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::ModifyItemUses(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnModifyItemUsesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FModifyItemUsesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FModifyItemUsesResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FModifyItemUsesResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FModifyItemUsesResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::MoveItemToCharacterFromCharacter(
     ServerModels::FMoveItemToCharacterFromCharacterRequest& request,
     const FMoveItemToCharacterFromCharacterDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2444,29 +2693,32 @@ bool UPlayFabServerInstanceAPI::MoveItemToCharacterFromCharacter(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/MoveItemToCharacterFromCharacter"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnMoveItemToCharacterFromCharacterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/MoveItemToCharacterFromCharacter"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnMoveItemToCharacterFromCharacterResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FMoveItemToCharacterFromCharacterResult>> UPlayFabServerInstanceAPI::MoveItemToCharacterFromCharacterAsync(ServerModels::FMoveItemToCharacterFromCharacterRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FMoveItemToCharacterFromCharacterResult, FMoveItemToCharacterFromCharacterDelegate>([this, &request, &Handle](const FMoveItemToCharacterFromCharacterDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::MoveItemToCharacterFromCharacter(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnMoveItemToCharacterFromCharacterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FMoveItemToCharacterFromCharacterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FMoveItemToCharacterFromCharacterResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FMoveItemToCharacterFromCharacterResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FMoveItemToCharacterFromCharacterResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::MoveItemToCharacterFromUser(
     ServerModels::FMoveItemToCharacterFromUserRequest& request,
     const FMoveItemToCharacterFromUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2474,29 +2726,32 @@ bool UPlayFabServerInstanceAPI::MoveItemToCharacterFromUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/MoveItemToCharacterFromUser"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnMoveItemToCharacterFromUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/MoveItemToCharacterFromUser"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnMoveItemToCharacterFromUserResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FMoveItemToCharacterFromUserResult>> UPlayFabServerInstanceAPI::MoveItemToCharacterFromUserAsync(ServerModels::FMoveItemToCharacterFromUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FMoveItemToCharacterFromUserResult, FMoveItemToCharacterFromUserDelegate>([this, &request, &Handle](const FMoveItemToCharacterFromUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::MoveItemToCharacterFromUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnMoveItemToCharacterFromUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FMoveItemToCharacterFromUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FMoveItemToCharacterFromUserResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FMoveItemToCharacterFromUserResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FMoveItemToCharacterFromUserResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::MoveItemToUserFromCharacter(
     ServerModels::FMoveItemToUserFromCharacterRequest& request,
     const FMoveItemToUserFromCharacterDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2504,29 +2759,32 @@ bool UPlayFabServerInstanceAPI::MoveItemToUserFromCharacter(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/MoveItemToUserFromCharacter"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnMoveItemToUserFromCharacterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/MoveItemToUserFromCharacter"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnMoveItemToUserFromCharacterResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FMoveItemToUserFromCharacterResult>> UPlayFabServerInstanceAPI::MoveItemToUserFromCharacterAsync(ServerModels::FMoveItemToUserFromCharacterRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FMoveItemToUserFromCharacterResult, FMoveItemToUserFromCharacterDelegate>([this, &request, &Handle](const FMoveItemToUserFromCharacterDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::MoveItemToUserFromCharacter(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnMoveItemToUserFromCharacterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FMoveItemToUserFromCharacterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FMoveItemToUserFromCharacterResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FMoveItemToUserFromCharacterResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FMoveItemToUserFromCharacterResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::NotifyMatchmakerPlayerLeft(
     ServerModels::FNotifyMatchmakerPlayerLeftRequest& request,
     const FNotifyMatchmakerPlayerLeftDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2534,29 +2792,32 @@ bool UPlayFabServerInstanceAPI::NotifyMatchmakerPlayerLeft(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/NotifyMatchmakerPlayerLeft"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnNotifyMatchmakerPlayerLeftResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/NotifyMatchmakerPlayerLeft"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnNotifyMatchmakerPlayerLeftResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FNotifyMatchmakerPlayerLeftResult>> UPlayFabServerInstanceAPI::NotifyMatchmakerPlayerLeftAsync(ServerModels::FNotifyMatchmakerPlayerLeftRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FNotifyMatchmakerPlayerLeftResult, FNotifyMatchmakerPlayerLeftDelegate>([this, &request, &Handle](const FNotifyMatchmakerPlayerLeftDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::NotifyMatchmakerPlayerLeft(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnNotifyMatchmakerPlayerLeftResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FNotifyMatchmakerPlayerLeftDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FNotifyMatchmakerPlayerLeftResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FNotifyMatchmakerPlayerLeftResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FNotifyMatchmakerPlayerLeftResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::RedeemCoupon(
     ServerModels::FRedeemCouponRequest& request,
     const FRedeemCouponDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2564,29 +2825,32 @@ bool UPlayFabServerInstanceAPI::RedeemCoupon(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RedeemCoupon"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRedeemCouponResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RedeemCoupon"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnRedeemCouponResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRedeemCouponResult>> UPlayFabServerInstanceAPI::RedeemCouponAsync(ServerModels::FRedeemCouponRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRedeemCouponResult, FRedeemCouponDelegate>([this, &request, &Handle](const FRedeemCouponDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::RedeemCoupon(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnRedeemCouponResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemCouponDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRedeemCouponResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRedeemCouponResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRedeemCouponResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::RedeemMatchmakerTicket(
     ServerModels::FRedeemMatchmakerTicketRequest& request,
     const FRedeemMatchmakerTicketDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2594,29 +2858,32 @@ bool UPlayFabServerInstanceAPI::RedeemMatchmakerTicket(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RedeemMatchmakerTicket"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRedeemMatchmakerTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RedeemMatchmakerTicket"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnRedeemMatchmakerTicketResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRedeemMatchmakerTicketResult>> UPlayFabServerInstanceAPI::RedeemMatchmakerTicketAsync(ServerModels::FRedeemMatchmakerTicketRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRedeemMatchmakerTicketResult, FRedeemMatchmakerTicketDelegate>([this, &request, &Handle](const FRedeemMatchmakerTicketDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::RedeemMatchmakerTicket(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnRedeemMatchmakerTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemMatchmakerTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRedeemMatchmakerTicketResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRedeemMatchmakerTicketResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRedeemMatchmakerTicketResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::RefreshGameServerInstanceHeartbeat(
     ServerModels::FRefreshGameServerInstanceHeartbeatRequest& request,
     const FRefreshGameServerInstanceHeartbeatDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2624,29 +2891,32 @@ bool UPlayFabServerInstanceAPI::RefreshGameServerInstanceHeartbeat(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RefreshGameServerInstanceHeartbeat"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRefreshGameServerInstanceHeartbeatResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RefreshGameServerInstanceHeartbeat"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnRefreshGameServerInstanceHeartbeatResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRefreshGameServerInstanceHeartbeatResult>> UPlayFabServerInstanceAPI::RefreshGameServerInstanceHeartbeatAsync(ServerModels::FRefreshGameServerInstanceHeartbeatRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRefreshGameServerInstanceHeartbeatResult, FRefreshGameServerInstanceHeartbeatDelegate>([this, &request, &Handle](const FRefreshGameServerInstanceHeartbeatDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::RefreshGameServerInstanceHeartbeat(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnRefreshGameServerInstanceHeartbeatResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRefreshGameServerInstanceHeartbeatDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRefreshGameServerInstanceHeartbeatResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRefreshGameServerInstanceHeartbeatResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRefreshGameServerInstanceHeartbeatResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::RegisterGame(
     ServerModels::FRegisterGameRequest& request,
     const FRegisterGameDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2654,29 +2924,32 @@ bool UPlayFabServerInstanceAPI::RegisterGame(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RegisterGame"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRegisterGameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RegisterGame"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnRegisterGameResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRegisterGameResponse>> UPlayFabServerInstanceAPI::RegisterGameAsync(ServerModels::FRegisterGameRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRegisterGameResponse, FRegisterGameDelegate>([this, &request, &Handle](const FRegisterGameDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::RegisterGame(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnRegisterGameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterGameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRegisterGameResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRegisterGameResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRegisterGameResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::RemoveFriend(
     ServerModels::FRemoveFriendRequest& request,
     const FRemoveFriendDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2684,29 +2957,32 @@ bool UPlayFabServerInstanceAPI::RemoveFriend(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RemoveFriend"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRemoveFriendResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RemoveFriend"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnRemoveFriendResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FEmptyResponse>> UPlayFabServerInstanceAPI::RemoveFriendAsync(ServerModels::FRemoveFriendRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FEmptyResponse, FRemoveFriendDelegate>([this, &request, &Handle](const FRemoveFriendDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::RemoveFriend(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnRemoveFriendResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveFriendDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::RemoveGenericID(
     ServerModels::FRemoveGenericIDRequest& request,
     const FRemoveGenericIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2714,29 +2990,32 @@ bool UPlayFabServerInstanceAPI::RemoveGenericID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RemoveGenericID"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRemoveGenericIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RemoveGenericID"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnRemoveGenericIDResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FEmptyResult>> UPlayFabServerInstanceAPI::RemoveGenericIDAsync(ServerModels::FRemoveGenericIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FEmptyResult, FRemoveGenericIDDelegate>([this, &request, &Handle](const FRemoveGenericIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::RemoveGenericID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnRemoveGenericIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveGenericIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FEmptyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FEmptyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FEmptyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::RemovePlayerTag(
     ServerModels::FRemovePlayerTagRequest& request,
     const FRemovePlayerTagDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2744,29 +3023,32 @@ bool UPlayFabServerInstanceAPI::RemovePlayerTag(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RemovePlayerTag"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRemovePlayerTagResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RemovePlayerTag"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnRemovePlayerTagResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRemovePlayerTagResult>> UPlayFabServerInstanceAPI::RemovePlayerTagAsync(ServerModels::FRemovePlayerTagRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRemovePlayerTagResult, FRemovePlayerTagDelegate>([this, &request, &Handle](const FRemovePlayerTagDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::RemovePlayerTag(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnRemovePlayerTagResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemovePlayerTagDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRemovePlayerTagResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRemovePlayerTagResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRemovePlayerTagResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::RemoveSharedGroupMembers(
     ServerModels::FRemoveSharedGroupMembersRequest& request,
     const FRemoveSharedGroupMembersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2774,29 +3056,32 @@ bool UPlayFabServerInstanceAPI::RemoveSharedGroupMembers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RemoveSharedGroupMembers"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRemoveSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RemoveSharedGroupMembers"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnRemoveSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRemoveSharedGroupMembersResult>> UPlayFabServerInstanceAPI::RemoveSharedGroupMembersAsync(ServerModels::FRemoveSharedGroupMembersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRemoveSharedGroupMembersResult, FRemoveSharedGroupMembersDelegate>([this, &request, &Handle](const FRemoveSharedGroupMembersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::RemoveSharedGroupMembers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnRemoveSharedGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveSharedGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRemoveSharedGroupMembersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRemoveSharedGroupMembersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRemoveSharedGroupMembersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::ReportPlayer(
     ServerModels::FReportPlayerServerRequest& request,
     const FReportPlayerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2804,29 +3089,32 @@ bool UPlayFabServerInstanceAPI::ReportPlayer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/ReportPlayer"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnReportPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/ReportPlayer"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnReportPlayerResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FReportPlayerServerResult>> UPlayFabServerInstanceAPI::ReportPlayerAsync(ServerModels::FReportPlayerServerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FReportPlayerServerResult, FReportPlayerDelegate>([this, &request, &Handle](const FReportPlayerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::ReportPlayer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnReportPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FReportPlayerServerResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FReportPlayerServerResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FReportPlayerServerResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::RevokeAllBansForUser(
     ServerModels::FRevokeAllBansForUserRequest& request,
     const FRevokeAllBansForUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2834,29 +3122,32 @@ bool UPlayFabServerInstanceAPI::RevokeAllBansForUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RevokeAllBansForUser"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRevokeAllBansForUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RevokeAllBansForUser"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnRevokeAllBansForUserResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRevokeAllBansForUserResult>> UPlayFabServerInstanceAPI::RevokeAllBansForUserAsync(ServerModels::FRevokeAllBansForUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRevokeAllBansForUserResult, FRevokeAllBansForUserDelegate>([this, &request, &Handle](const FRevokeAllBansForUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::RevokeAllBansForUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnRevokeAllBansForUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeAllBansForUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRevokeAllBansForUserResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRevokeAllBansForUserResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRevokeAllBansForUserResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::RevokeBans(
     ServerModels::FRevokeBansRequest& request,
     const FRevokeBansDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2864,29 +3155,32 @@ bool UPlayFabServerInstanceAPI::RevokeBans(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RevokeBans"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRevokeBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RevokeBans"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnRevokeBansResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRevokeBansResult>> UPlayFabServerInstanceAPI::RevokeBansAsync(ServerModels::FRevokeBansRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRevokeBansResult, FRevokeBansDelegate>([this, &request, &Handle](const FRevokeBansDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::RevokeBans(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnRevokeBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRevokeBansResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRevokeBansResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRevokeBansResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::RevokeInventoryItem(
     ServerModels::FRevokeInventoryItemRequest& request,
     const FRevokeInventoryItemDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2894,29 +3188,32 @@ bool UPlayFabServerInstanceAPI::RevokeInventoryItem(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RevokeInventoryItem"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRevokeInventoryItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RevokeInventoryItem"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnRevokeInventoryItemResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRevokeInventoryResult>> UPlayFabServerInstanceAPI::RevokeInventoryItemAsync(ServerModels::FRevokeInventoryItemRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRevokeInventoryResult, FRevokeInventoryItemDelegate>([this, &request, &Handle](const FRevokeInventoryItemDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::RevokeInventoryItem(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnRevokeInventoryItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeInventoryItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRevokeInventoryResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRevokeInventoryResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRevokeInventoryResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::RevokeInventoryItems(
     ServerModels::FRevokeInventoryItemsRequest& request,
     const FRevokeInventoryItemsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2924,29 +3221,32 @@ bool UPlayFabServerInstanceAPI::RevokeInventoryItems(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RevokeInventoryItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnRevokeInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/RevokeInventoryItems"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnRevokeInventoryItemsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRevokeInventoryItemsResult>> UPlayFabServerInstanceAPI::RevokeInventoryItemsAsync(ServerModels::FRevokeInventoryItemsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRevokeInventoryItemsResult, FRevokeInventoryItemsDelegate>([this, &request, &Handle](const FRevokeInventoryItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::RevokeInventoryItems(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnRevokeInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRevokeInventoryItemsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRevokeInventoryItemsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRevokeInventoryItemsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::SavePushNotificationTemplate(
     ServerModels::FSavePushNotificationTemplateRequest& request,
     const FSavePushNotificationTemplateDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2954,29 +3254,32 @@ bool UPlayFabServerInstanceAPI::SavePushNotificationTemplate(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SavePushNotificationTemplate"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSavePushNotificationTemplateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SavePushNotificationTemplate"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnSavePushNotificationTemplateResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSavePushNotificationTemplateResult>> UPlayFabServerInstanceAPI::SavePushNotificationTemplateAsync(ServerModels::FSavePushNotificationTemplateRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSavePushNotificationTemplateResult, FSavePushNotificationTemplateDelegate>([this, &request, &Handle](const FSavePushNotificationTemplateDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::SavePushNotificationTemplate(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnSavePushNotificationTemplateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSavePushNotificationTemplateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSavePushNotificationTemplateResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSavePushNotificationTemplateResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSavePushNotificationTemplateResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::SendCustomAccountRecoveryEmail(
     ServerModels::FSendCustomAccountRecoveryEmailRequest& request,
     const FSendCustomAccountRecoveryEmailDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2984,29 +3287,32 @@ bool UPlayFabServerInstanceAPI::SendCustomAccountRecoveryEmail(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SendCustomAccountRecoveryEmail"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSendCustomAccountRecoveryEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SendCustomAccountRecoveryEmail"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnSendCustomAccountRecoveryEmailResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSendCustomAccountRecoveryEmailResult>> UPlayFabServerInstanceAPI::SendCustomAccountRecoveryEmailAsync(ServerModels::FSendCustomAccountRecoveryEmailRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSendCustomAccountRecoveryEmailResult, FSendCustomAccountRecoveryEmailDelegate>([this, &request, &Handle](const FSendCustomAccountRecoveryEmailDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::SendCustomAccountRecoveryEmail(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnSendCustomAccountRecoveryEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendCustomAccountRecoveryEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSendCustomAccountRecoveryEmailResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSendCustomAccountRecoveryEmailResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSendCustomAccountRecoveryEmailResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::SendEmailFromTemplate(
     ServerModels::FSendEmailFromTemplateRequest& request,
     const FSendEmailFromTemplateDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3014,29 +3320,32 @@ bool UPlayFabServerInstanceAPI::SendEmailFromTemplate(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SendEmailFromTemplate"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSendEmailFromTemplateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SendEmailFromTemplate"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnSendEmailFromTemplateResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSendEmailFromTemplateResult>> UPlayFabServerInstanceAPI::SendEmailFromTemplateAsync(ServerModels::FSendEmailFromTemplateRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSendEmailFromTemplateResult, FSendEmailFromTemplateDelegate>([this, &request, &Handle](const FSendEmailFromTemplateDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::SendEmailFromTemplate(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnSendEmailFromTemplateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendEmailFromTemplateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSendEmailFromTemplateResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSendEmailFromTemplateResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSendEmailFromTemplateResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::SendPushNotification(
     ServerModels::FSendPushNotificationRequest& request,
     const FSendPushNotificationDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3044,29 +3353,32 @@ bool UPlayFabServerInstanceAPI::SendPushNotification(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SendPushNotification"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSendPushNotificationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SendPushNotification"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnSendPushNotificationResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSendPushNotificationResult>> UPlayFabServerInstanceAPI::SendPushNotificationAsync(ServerModels::FSendPushNotificationRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSendPushNotificationResult, FSendPushNotificationDelegate>([this, &request, &Handle](const FSendPushNotificationDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::SendPushNotification(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnSendPushNotificationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendPushNotificationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSendPushNotificationResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSendPushNotificationResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSendPushNotificationResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::SendPushNotificationFromTemplate(
     ServerModels::FSendPushNotificationFromTemplateRequest& request,
     const FSendPushNotificationFromTemplateDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3074,29 +3386,32 @@ bool UPlayFabServerInstanceAPI::SendPushNotificationFromTemplate(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SendPushNotificationFromTemplate"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSendPushNotificationFromTemplateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SendPushNotificationFromTemplate"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnSendPushNotificationFromTemplateResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSendPushNotificationResult>> UPlayFabServerInstanceAPI::SendPushNotificationFromTemplateAsync(ServerModels::FSendPushNotificationFromTemplateRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSendPushNotificationResult, FSendPushNotificationFromTemplateDelegate>([this, &request, &Handle](const FSendPushNotificationFromTemplateDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::SendPushNotificationFromTemplate(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnSendPushNotificationFromTemplateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendPushNotificationFromTemplateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSendPushNotificationResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSendPushNotificationResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSendPushNotificationResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::SetFriendTags(
     ServerModels::FSetFriendTagsRequest& request,
     const FSetFriendTagsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3104,29 +3419,32 @@ bool UPlayFabServerInstanceAPI::SetFriendTags(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetFriendTags"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSetFriendTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetFriendTags"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnSetFriendTagsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FEmptyResponse>> UPlayFabServerInstanceAPI::SetFriendTagsAsync(ServerModels::FSetFriendTagsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FEmptyResponse, FSetFriendTagsDelegate>([this, &request, &Handle](const FSetFriendTagsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::SetFriendTags(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnSetFriendTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetFriendTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::SetGameServerInstanceData(
     ServerModels::FSetGameServerInstanceDataRequest& request,
     const FSetGameServerInstanceDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3134,29 +3452,32 @@ bool UPlayFabServerInstanceAPI::SetGameServerInstanceData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetGameServerInstanceData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSetGameServerInstanceDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetGameServerInstanceData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnSetGameServerInstanceDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSetGameServerInstanceDataResult>> UPlayFabServerInstanceAPI::SetGameServerInstanceDataAsync(ServerModels::FSetGameServerInstanceDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSetGameServerInstanceDataResult, FSetGameServerInstanceDataDelegate>([this, &request, &Handle](const FSetGameServerInstanceDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::SetGameServerInstanceData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnSetGameServerInstanceDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetGameServerInstanceDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSetGameServerInstanceDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSetGameServerInstanceDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSetGameServerInstanceDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::SetGameServerInstanceState(
     ServerModels::FSetGameServerInstanceStateRequest& request,
     const FSetGameServerInstanceStateDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3164,29 +3485,32 @@ bool UPlayFabServerInstanceAPI::SetGameServerInstanceState(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetGameServerInstanceState"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSetGameServerInstanceStateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetGameServerInstanceState"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnSetGameServerInstanceStateResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSetGameServerInstanceStateResult>> UPlayFabServerInstanceAPI::SetGameServerInstanceStateAsync(ServerModels::FSetGameServerInstanceStateRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSetGameServerInstanceStateResult, FSetGameServerInstanceStateDelegate>([this, &request, &Handle](const FSetGameServerInstanceStateDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::SetGameServerInstanceState(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnSetGameServerInstanceStateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetGameServerInstanceStateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSetGameServerInstanceStateResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSetGameServerInstanceStateResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSetGameServerInstanceStateResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::SetGameServerInstanceTags(
     ServerModels::FSetGameServerInstanceTagsRequest& request,
     const FSetGameServerInstanceTagsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3194,29 +3518,32 @@ bool UPlayFabServerInstanceAPI::SetGameServerInstanceTags(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetGameServerInstanceTags"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSetGameServerInstanceTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetGameServerInstanceTags"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnSetGameServerInstanceTagsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSetGameServerInstanceTagsResult>> UPlayFabServerInstanceAPI::SetGameServerInstanceTagsAsync(ServerModels::FSetGameServerInstanceTagsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSetGameServerInstanceTagsResult, FSetGameServerInstanceTagsDelegate>([this, &request, &Handle](const FSetGameServerInstanceTagsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::SetGameServerInstanceTags(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnSetGameServerInstanceTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetGameServerInstanceTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSetGameServerInstanceTagsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSetGameServerInstanceTagsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSetGameServerInstanceTagsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::SetPlayerSecret(
     ServerModels::FSetPlayerSecretRequest& request,
     const FSetPlayerSecretDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3224,29 +3551,32 @@ bool UPlayFabServerInstanceAPI::SetPlayerSecret(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetPlayerSecret"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSetPlayerSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetPlayerSecret"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnSetPlayerSecretResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSetPlayerSecretResult>> UPlayFabServerInstanceAPI::SetPlayerSecretAsync(ServerModels::FSetPlayerSecretRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSetPlayerSecretResult, FSetPlayerSecretDelegate>([this, &request, &Handle](const FSetPlayerSecretDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::SetPlayerSecret(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnSetPlayerSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPlayerSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSetPlayerSecretResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSetPlayerSecretResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSetPlayerSecretResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::SetPublisherData(
     ServerModels::FSetPublisherDataRequest& request,
     const FSetPublisherDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3254,29 +3584,32 @@ bool UPlayFabServerInstanceAPI::SetPublisherData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetPublisherData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnSetPublisherDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSetPublisherDataResult>> UPlayFabServerInstanceAPI::SetPublisherDataAsync(ServerModels::FSetPublisherDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSetPublisherDataResult, FSetPublisherDataDelegate>([this, &request, &Handle](const FSetPublisherDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::SetPublisherData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnSetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSetPublisherDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSetPublisherDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSetPublisherDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::SetTitleData(
     ServerModels::FSetTitleDataRequest& request,
     const FSetTitleDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3284,29 +3617,32 @@ bool UPlayFabServerInstanceAPI::SetTitleData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetTitleData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetTitleData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnSetTitleDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSetTitleDataResult>> UPlayFabServerInstanceAPI::SetTitleDataAsync(ServerModels::FSetTitleDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSetTitleDataResult, FSetTitleDataDelegate>([this, &request, &Handle](const FSetTitleDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::SetTitleData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnSetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSetTitleDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSetTitleDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSetTitleDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::SetTitleInternalData(
     ServerModels::FSetTitleDataRequest& request,
     const FSetTitleInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3314,29 +3650,32 @@ bool UPlayFabServerInstanceAPI::SetTitleInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetTitleInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SetTitleInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnSetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSetTitleDataResult>> UPlayFabServerInstanceAPI::SetTitleInternalDataAsync(ServerModels::FSetTitleDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSetTitleDataResult, FSetTitleInternalDataDelegate>([this, &request, &Handle](const FSetTitleInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::SetTitleInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnSetTitleInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSetTitleDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSetTitleDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSetTitleDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::SubtractCharacterVirtualCurrency(
     ServerModels::FSubtractCharacterVirtualCurrencyRequest& request,
     const FSubtractCharacterVirtualCurrencyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3344,29 +3683,32 @@ bool UPlayFabServerInstanceAPI::SubtractCharacterVirtualCurrency(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SubtractCharacterVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSubtractCharacterVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SubtractCharacterVirtualCurrency"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnSubtractCharacterVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FModifyCharacterVirtualCurrencyResult>> UPlayFabServerInstanceAPI::SubtractCharacterVirtualCurrencyAsync(ServerModels::FSubtractCharacterVirtualCurrencyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FModifyCharacterVirtualCurrencyResult, FSubtractCharacterVirtualCurrencyDelegate>([this, &request, &Handle](const FSubtractCharacterVirtualCurrencyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::SubtractCharacterVirtualCurrency(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnSubtractCharacterVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubtractCharacterVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FModifyCharacterVirtualCurrencyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FModifyCharacterVirtualCurrencyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FModifyCharacterVirtualCurrencyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::SubtractUserVirtualCurrency(
     ServerModels::FSubtractUserVirtualCurrencyRequest& request,
     const FSubtractUserVirtualCurrencyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3374,29 +3716,32 @@ bool UPlayFabServerInstanceAPI::SubtractUserVirtualCurrency(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SubtractUserVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnSubtractUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/SubtractUserVirtualCurrency"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnSubtractUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FModifyUserVirtualCurrencyResult>> UPlayFabServerInstanceAPI::SubtractUserVirtualCurrencyAsync(ServerModels::FSubtractUserVirtualCurrencyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FModifyUserVirtualCurrencyResult, FSubtractUserVirtualCurrencyDelegate>([this, &request, &Handle](const FSubtractUserVirtualCurrencyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::SubtractUserVirtualCurrency(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnSubtractUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubtractUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FModifyUserVirtualCurrencyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FModifyUserVirtualCurrencyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FModifyUserVirtualCurrencyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UnlinkPSNAccount(
     ServerModels::FUnlinkPSNAccountRequest& request,
     const FUnlinkPSNAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3404,29 +3749,32 @@ bool UPlayFabServerInstanceAPI::UnlinkPSNAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UnlinkPSNAccount"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUnlinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UnlinkPSNAccount"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUnlinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUnlinkPSNAccountResult>> UPlayFabServerInstanceAPI::UnlinkPSNAccountAsync(ServerModels::FUnlinkPSNAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUnlinkPSNAccountResult, FUnlinkPSNAccountDelegate>([this, &request, &Handle](const FUnlinkPSNAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UnlinkPSNAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUnlinkPSNAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkPSNAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUnlinkPSNAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUnlinkPSNAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUnlinkPSNAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UnlinkServerCustomId(
     ServerModels::FUnlinkServerCustomIdRequest& request,
     const FUnlinkServerCustomIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3434,29 +3782,32 @@ bool UPlayFabServerInstanceAPI::UnlinkServerCustomId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UnlinkServerCustomId"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUnlinkServerCustomIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UnlinkServerCustomId"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUnlinkServerCustomIdResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUnlinkServerCustomIdResult>> UPlayFabServerInstanceAPI::UnlinkServerCustomIdAsync(ServerModels::FUnlinkServerCustomIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUnlinkServerCustomIdResult, FUnlinkServerCustomIdDelegate>([this, &request, &Handle](const FUnlinkServerCustomIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UnlinkServerCustomId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUnlinkServerCustomIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkServerCustomIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUnlinkServerCustomIdResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUnlinkServerCustomIdResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUnlinkServerCustomIdResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UnlinkXboxAccount(
     ServerModels::FUnlinkXboxAccountRequest& request,
     const FUnlinkXboxAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3464,29 +3815,32 @@ bool UPlayFabServerInstanceAPI::UnlinkXboxAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UnlinkXboxAccount"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUnlinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UnlinkXboxAccount"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUnlinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUnlinkXboxAccountResult>> UPlayFabServerInstanceAPI::UnlinkXboxAccountAsync(ServerModels::FUnlinkXboxAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUnlinkXboxAccountResult, FUnlinkXboxAccountDelegate>([this, &request, &Handle](const FUnlinkXboxAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UnlinkXboxAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUnlinkXboxAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkXboxAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUnlinkXboxAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUnlinkXboxAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUnlinkXboxAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UnlockContainerInstance(
     ServerModels::FUnlockContainerInstanceRequest& request,
     const FUnlockContainerInstanceDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3494,29 +3848,32 @@ bool UPlayFabServerInstanceAPI::UnlockContainerInstance(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UnlockContainerInstance"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUnlockContainerInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UnlockContainerInstance"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUnlockContainerInstanceResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUnlockContainerItemResult>> UPlayFabServerInstanceAPI::UnlockContainerInstanceAsync(ServerModels::FUnlockContainerInstanceRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUnlockContainerItemResult, FUnlockContainerInstanceDelegate>([this, &request, &Handle](const FUnlockContainerInstanceDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UnlockContainerInstance(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUnlockContainerInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlockContainerInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUnlockContainerItemResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUnlockContainerItemResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUnlockContainerItemResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UnlockContainerItem(
     ServerModels::FUnlockContainerItemRequest& request,
     const FUnlockContainerItemDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3524,29 +3881,32 @@ bool UPlayFabServerInstanceAPI::UnlockContainerItem(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UnlockContainerItem"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUnlockContainerItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UnlockContainerItem"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUnlockContainerItemResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUnlockContainerItemResult>> UPlayFabServerInstanceAPI::UnlockContainerItemAsync(ServerModels::FUnlockContainerItemRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUnlockContainerItemResult, FUnlockContainerItemDelegate>([this, &request, &Handle](const FUnlockContainerItemDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UnlockContainerItem(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUnlockContainerItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlockContainerItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUnlockContainerItemResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUnlockContainerItemResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUnlockContainerItemResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UpdateAvatarUrl(
     ServerModels::FUpdateAvatarUrlRequest& request,
     const FUpdateAvatarUrlDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3554,29 +3914,32 @@ bool UPlayFabServerInstanceAPI::UpdateAvatarUrl(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateAvatarUrl"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateAvatarUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateAvatarUrl"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUpdateAvatarUrlResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FEmptyResponse>> UPlayFabServerInstanceAPI::UpdateAvatarUrlAsync(ServerModels::FUpdateAvatarUrlRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FEmptyResponse, FUpdateAvatarUrlDelegate>([this, &request, &Handle](const FUpdateAvatarUrlDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UpdateAvatarUrl(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateAvatarUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateAvatarUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UpdateBans(
     ServerModels::FUpdateBansRequest& request,
     const FUpdateBansDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3584,29 +3947,32 @@ bool UPlayFabServerInstanceAPI::UpdateBans(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateBans"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateBans"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUpdateBansResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateBansResult>> UPlayFabServerInstanceAPI::UpdateBansAsync(ServerModels::FUpdateBansRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateBansResult, FUpdateBansDelegate>([this, &request, &Handle](const FUpdateBansDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UpdateBans(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateBansResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateBansResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateBansResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UpdateCharacterData(
     ServerModels::FUpdateCharacterDataRequest& request,
     const FUpdateCharacterDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3614,29 +3980,32 @@ bool UPlayFabServerInstanceAPI::UpdateCharacterData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateCharacterData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateCharacterDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateCharacterData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUpdateCharacterDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateCharacterDataResult>> UPlayFabServerInstanceAPI::UpdateCharacterDataAsync(ServerModels::FUpdateCharacterDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateCharacterDataResult, FUpdateCharacterDataDelegate>([this, &request, &Handle](const FUpdateCharacterDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UpdateCharacterData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateCharacterDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateCharacterDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateCharacterDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateCharacterDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UpdateCharacterInternalData(
     ServerModels::FUpdateCharacterDataRequest& request,
     const FUpdateCharacterInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3644,29 +4013,32 @@ bool UPlayFabServerInstanceAPI::UpdateCharacterInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateCharacterInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateCharacterInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateCharacterInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUpdateCharacterInternalDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateCharacterDataResult>> UPlayFabServerInstanceAPI::UpdateCharacterInternalDataAsync(ServerModels::FUpdateCharacterDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateCharacterDataResult, FUpdateCharacterInternalDataDelegate>([this, &request, &Handle](const FUpdateCharacterInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UpdateCharacterInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateCharacterInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateCharacterDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateCharacterDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateCharacterDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UpdateCharacterReadOnlyData(
     ServerModels::FUpdateCharacterDataRequest& request,
     const FUpdateCharacterReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3674,29 +4046,32 @@ bool UPlayFabServerInstanceAPI::UpdateCharacterReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateCharacterReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateCharacterReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateCharacterReadOnlyData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUpdateCharacterReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateCharacterDataResult>> UPlayFabServerInstanceAPI::UpdateCharacterReadOnlyDataAsync(ServerModels::FUpdateCharacterDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateCharacterDataResult, FUpdateCharacterReadOnlyDataDelegate>([this, &request, &Handle](const FUpdateCharacterReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UpdateCharacterReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateCharacterReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateCharacterDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateCharacterDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateCharacterDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UpdateCharacterStatistics(
     ServerModels::FUpdateCharacterStatisticsRequest& request,
     const FUpdateCharacterStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3704,29 +4079,32 @@ bool UPlayFabServerInstanceAPI::UpdateCharacterStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateCharacterStatistics"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateCharacterStatistics"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUpdateCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateCharacterStatisticsResult>> UPlayFabServerInstanceAPI::UpdateCharacterStatisticsAsync(ServerModels::FUpdateCharacterStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateCharacterStatisticsResult, FUpdateCharacterStatisticsDelegate>([this, &request, &Handle](const FUpdateCharacterStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UpdateCharacterStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateCharacterStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateCharacterStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateCharacterStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UpdatePlayerStatistics(
     ServerModels::FUpdatePlayerStatisticsRequest& request,
     const FUpdatePlayerStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3734,29 +4112,32 @@ bool UPlayFabServerInstanceAPI::UpdatePlayerStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdatePlayerStatistics"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdatePlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdatePlayerStatistics"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUpdatePlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdatePlayerStatisticsResult>> UPlayFabServerInstanceAPI::UpdatePlayerStatisticsAsync(ServerModels::FUpdatePlayerStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdatePlayerStatisticsResult, FUpdatePlayerStatisticsDelegate>([this, &request, &Handle](const FUpdatePlayerStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UpdatePlayerStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUpdatePlayerStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdatePlayerStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdatePlayerStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdatePlayerStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UpdateSharedGroupData(
     ServerModels::FUpdateSharedGroupDataRequest& request,
     const FUpdateSharedGroupDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3764,29 +4145,32 @@ bool UPlayFabServerInstanceAPI::UpdateSharedGroupData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateSharedGroupData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateSharedGroupData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUpdateSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateSharedGroupDataResult>> UPlayFabServerInstanceAPI::UpdateSharedGroupDataAsync(ServerModels::FUpdateSharedGroupDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateSharedGroupDataResult, FUpdateSharedGroupDataDelegate>([this, &request, &Handle](const FUpdateSharedGroupDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UpdateSharedGroupData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateSharedGroupDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateSharedGroupDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateSharedGroupDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateSharedGroupDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateSharedGroupDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UpdateUserData(
     ServerModels::FUpdateUserDataRequest& request,
     const FUpdateUserDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3794,29 +4178,32 @@ bool UPlayFabServerInstanceAPI::UpdateUserData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUpdateUserDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateUserDataResult>> UPlayFabServerInstanceAPI::UpdateUserDataAsync(ServerModels::FUpdateUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateUserDataResult, FUpdateUserDataDelegate>([this, &request, &Handle](const FUpdateUserDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UpdateUserData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UpdateUserInternalData(
     ServerModels::FUpdateUserInternalDataRequest& request,
     const FUpdateUserInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3824,29 +4211,32 @@ bool UPlayFabServerInstanceAPI::UpdateUserInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateUserInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUpdateUserInternalDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateUserDataResult>> UPlayFabServerInstanceAPI::UpdateUserInternalDataAsync(ServerModels::FUpdateUserInternalDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateUserDataResult, FUpdateUserInternalDataDelegate>([this, &request, &Handle](const FUpdateUserInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UpdateUserInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateUserInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UpdateUserInventoryItemCustomData(
     ServerModels::FUpdateUserInventoryItemDataRequest& request,
     const FUpdateUserInventoryItemCustomDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3854,29 +4244,32 @@ bool UPlayFabServerInstanceAPI::UpdateUserInventoryItemCustomData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserInventoryItemCustomData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateUserInventoryItemCustomDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserInventoryItemCustomData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUpdateUserInventoryItemCustomDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FEmptyResponse>> UPlayFabServerInstanceAPI::UpdateUserInventoryItemCustomDataAsync(ServerModels::FUpdateUserInventoryItemDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FEmptyResponse, FUpdateUserInventoryItemCustomDataDelegate>([this, &request, &Handle](const FUpdateUserInventoryItemCustomDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UpdateUserInventoryItemCustomData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateUserInventoryItemCustomDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserInventoryItemCustomDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UpdateUserPublisherData(
     ServerModels::FUpdateUserDataRequest& request,
     const FUpdateUserPublisherDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3884,29 +4277,32 @@ bool UPlayFabServerInstanceAPI::UpdateUserPublisherData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserPublisherData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUpdateUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateUserDataResult>> UPlayFabServerInstanceAPI::UpdateUserPublisherDataAsync(ServerModels::FUpdateUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateUserDataResult, FUpdateUserPublisherDataDelegate>([this, &request, &Handle](const FUpdateUserPublisherDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UpdateUserPublisherData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UpdateUserPublisherInternalData(
     ServerModels::FUpdateUserInternalDataRequest& request,
     const FUpdateUserPublisherInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3914,29 +4310,32 @@ bool UPlayFabServerInstanceAPI::UpdateUserPublisherInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserPublisherInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserPublisherInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUpdateUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateUserDataResult>> UPlayFabServerInstanceAPI::UpdateUserPublisherInternalDataAsync(ServerModels::FUpdateUserInternalDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateUserDataResult, FUpdateUserPublisherInternalDataDelegate>([this, &request, &Handle](const FUpdateUserPublisherInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UpdateUserPublisherInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateUserPublisherInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UpdateUserPublisherReadOnlyData(
     ServerModels::FUpdateUserDataRequest& request,
     const FUpdateUserPublisherReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3944,29 +4343,32 @@ bool UPlayFabServerInstanceAPI::UpdateUserPublisherReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserPublisherReadOnlyData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUpdateUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateUserDataResult>> UPlayFabServerInstanceAPI::UpdateUserPublisherReadOnlyDataAsync(ServerModels::FUpdateUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateUserDataResult, FUpdateUserPublisherReadOnlyDataDelegate>([this, &request, &Handle](const FUpdateUserPublisherReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UpdateUserPublisherReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::UpdateUserReadOnlyData(
     ServerModels::FUpdateUserDataRequest& request,
     const FUpdateUserReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3974,29 +4376,32 @@ bool UPlayFabServerInstanceAPI::UpdateUserReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnUpdateUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/UpdateUserReadOnlyData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnUpdateUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateUserDataResult>> UPlayFabServerInstanceAPI::UpdateUserReadOnlyDataAsync(ServerModels::FUpdateUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateUserDataResult, FUpdateUserReadOnlyDataDelegate>([this, &request, &Handle](const FUpdateUserReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::UpdateUserReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnUpdateUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::WriteCharacterEvent(
     ServerModels::FWriteServerCharacterEventRequest& request,
     const FWriteCharacterEventDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -4004,29 +4409,32 @@ bool UPlayFabServerInstanceAPI::WriteCharacterEvent(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/WriteCharacterEvent"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnWriteCharacterEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/WriteCharacterEvent"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnWriteCharacterEventResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Low, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FWriteEventResponse>> UPlayFabServerInstanceAPI::WriteCharacterEventAsync(ServerModels::FWriteServerCharacterEventRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FWriteEventResponse, FWriteCharacterEventDelegate>([this, &request, &Handle](const FWriteCharacterEventDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::WriteCharacterEvent(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnWriteCharacterEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteCharacterEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FWriteEventResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FWriteEventResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FWriteEventResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::WritePlayerEvent(
     ServerModels::FWriteServerPlayerEventRequest& request,
     const FWritePlayerEventDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -4034,29 +4442,32 @@ bool UPlayFabServerInstanceAPI::WritePlayerEvent(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/WritePlayerEvent"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnWritePlayerEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/WritePlayerEvent"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnWritePlayerEventResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Low, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FWriteEventResponse>> UPlayFabServerInstanceAPI::WritePlayerEventAsync(ServerModels::FWriteServerPlayerEventRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FWriteEventResponse, FWritePlayerEventDelegate>([this, &request, &Handle](const FWritePlayerEventDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::WritePlayerEvent(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnWritePlayerEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWritePlayerEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FWriteEventResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FWriteEventResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FWriteEventResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerInstanceAPI::WriteTitleEvent(
     ServerModels::FWriteTitleEventRequest& request,
     const FWriteTitleEventDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -4064,21 +4475,23 @@ bool UPlayFabServerInstanceAPI::WriteTitleEvent(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/WriteTitleEvent"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerInstanceAPI::OnWriteTitleEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Server/WriteTitleEvent"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabServerInstanceAPI::OnWriteTitleEventResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Low, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FWriteEventResponse>> UPlayFabServerInstanceAPI::WriteTitleEventAsync(ServerModels::FWriteTitleEventRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FWriteEventResponse, FWriteTitleEventDelegate>([this, &request, &Handle](const FWriteTitleEventDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerInstanceAPI::WriteTitleEvent(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerInstanceAPI::OnWriteTitleEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteTitleEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FWriteEventResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FWriteEventResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FWriteEventResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
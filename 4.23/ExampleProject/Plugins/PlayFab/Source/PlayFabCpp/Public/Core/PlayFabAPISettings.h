@@ -19,18 +19,6 @@ public:
     {
     }
 
-    FString GeneratePfUrl(const FString& urlPath)
-    {
-        const UPlayFabRuntimeSettings* rSettings = GetDefault<UPlayFabRuntimeSettings>();
-        if (rSettings->ProductionEnvironmentURL.StartsWith(TEXT("https://")))
-        {
-            return rSettings->ProductionEnvironmentURL
-                + urlPath + TEXT("?sdk=") + PlayFab::PlayFabSettings::sdkVersion;
-        }
-        else
-        {
-            return TEXT("https://") + rSettings->TitleId + rSettings->ProductionEnvironmentURL
-                + urlPath + TEXT("?sdk=") + PlayFab::PlayFabSettings::sdkVersion;
-        }
-    }
+    // Built once per url path, see PlayFabCommon::FPlayFabUrlCache
+    FString GeneratePfUrl(const FString& urlPath);
 };
@@ -8,6 +8,8 @@
 
 #include "CoreMinimal.h"
 #include "Core/PlayFabError.h"
+#include "Core/PlayFabFuture.h"
+#include "Core/PlayFabRequestHandle.h"
 #include "Core/PlayFabAuthenticationDataModels.h"
 #include "Core/PlayFabSettings.h"
 #include "PlayFabAPISettings.h"
@@ -18,8 +20,9 @@ namespace PlayFab
 {
     /**
      * Main interface for PlayFab Sdk, specifically all Authentication APIs
+     * When the instance is owned by a shared pointer, it can be destroyed with calls in flight; their responses are dropped.
      */
-    class PLAYFABCPP_API UPlayFabAuthenticationInstanceAPI
+    class PLAYFABCPP_API UPlayFabAuthenticationInstanceAPI : public TSharedFromThis<UPlayFabAuthenticationInstanceAPI>
     {
     public:
         DECLARE_DELEGATE_OneParam(FGetEntityTokenDelegate, const AuthenticationModels::FGetEntityTokenResponse&);
@@ -60,12 +63,16 @@ namespace PlayFab
          * Entity Token.
          * This API must be called with X-SecretKey, X-Authentication or X-EntityToken headers. An optional EntityKey may be included to attempt to set the resulting EntityToken to a specific entity, however the entity must be a relation of the caller, such as the master_player_account of a character. If sending X-EntityToken the account will be marked as freshly logged in and will issue a new token. If using X-Authentication or X-EntityToken the header must still be valid and cannot be expired or revoked.
          */
-        bool GetEntityToken(AuthenticationModels::FGetEntityTokenRequest& request, const FGetEntityTokenDelegate& SuccessDelegate = FGetEntityTokenDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool GetEntityToken(AuthenticationModels::FGetEntityTokenRequest& request, const FGetEntityTokenDelegate& SuccessDelegate = FGetEntityTokenDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         /**
          * Method for a server to validate a client provided EntityToken. Only callable by the title entity.
          * Given an entity token, validates that it hasn't expired or been revoked and will return details of the owner.
          */
-        bool ValidateEntityToken(AuthenticationModels::FValidateEntityTokenRequest& request, const FValidateEntityTokenDelegate& SuccessDelegate = FValidateEntityTokenDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool ValidateEntityToken(AuthenticationModels::FValidateEntityTokenRequest& request, const FValidateEntityTokenDelegate& SuccessDelegate = FValidateEntityTokenDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+
+        // ------------ Generated async API calls, resolving a future instead of running delegates
+        TFuture<TPlayFabResult<AuthenticationModels::FGetEntityTokenResponse>> GetEntityTokenAsync(AuthenticationModels::FGetEntityTokenRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<AuthenticationModels::FValidateEntityTokenResponse>> ValidateEntityTokenAsync(AuthenticationModels::FValidateEntityTokenRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
 
     private:
         // ------------ Generated result handlers
@@ -41,6 +41,16 @@ namespace ClientModels
             TradeId(src.TradeId)
             {}
 
+        FAcceptTradeRequest(FAcceptTradeRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AcceptedInventoryInstanceIds(MoveTemp(src.AcceptedInventoryInstanceIds)),
+            OfferingPlayerId(MoveTemp(src.OfferingPlayerId)),
+            TradeId(MoveTemp(src.TradeId))
+            {}
+
+        FAcceptTradeRequest& operator=(const FAcceptTradeRequest& src) = default;
+        FAcceptTradeRequest& operator=(FAcceptTradeRequest&& src) = default;
+
         FAcceptTradeRequest(const TSharedPtr<FJsonObject>& obj) : FAcceptTradeRequest()
         {
             readFromValue(obj);
@@ -49,7 +59,13 @@ namespace ClientModels
         ~FAcceptTradeRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum TradeStatus
@@ -64,6 +80,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeTradeStatusEnumJSON(TradeStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeTradeStatusEnumJSON(TradeStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API TradeStatus readTradeStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API TradeStatus readTradeStatusFromValue(const FString& value);
 
@@ -137,6 +154,26 @@ namespace ClientModels
             TradeId(src.TradeId)
             {}
 
+        FTradeInfo(FTradeInfo&& src) :
+            FPlayFabCppBaseModel(),
+            AcceptedInventoryInstanceIds(MoveTemp(src.AcceptedInventoryInstanceIds)),
+            AcceptedPlayerId(MoveTemp(src.AcceptedPlayerId)),
+            AllowedPlayerIds(MoveTemp(src.AllowedPlayerIds)),
+            CancelledAt(MoveTemp(src.CancelledAt)),
+            FilledAt(MoveTemp(src.FilledAt)),
+            InvalidatedAt(MoveTemp(src.InvalidatedAt)),
+            OfferedCatalogItemIds(MoveTemp(src.OfferedCatalogItemIds)),
+            OfferedInventoryInstanceIds(MoveTemp(src.OfferedInventoryInstanceIds)),
+            OfferingPlayerId(MoveTemp(src.OfferingPlayerId)),
+            OpenedAt(MoveTemp(src.OpenedAt)),
+            RequestedCatalogItemIds(MoveTemp(src.RequestedCatalogItemIds)),
+            Status(MoveTemp(src.Status)),
+            TradeId(MoveTemp(src.TradeId))
+            {}
+
+        FTradeInfo& operator=(const FTradeInfo& src) = default;
+        FTradeInfo& operator=(FTradeInfo&& src) = default;
+
         FTradeInfo(const TSharedPtr<FJsonObject>& obj) : FTradeInfo()
         {
             readFromValue(obj);
@@ -145,7 +182,13 @@ namespace ClientModels
         ~FTradeInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAcceptTradeResponse : public PlayFab::FPlayFabCppResultCommon
@@ -160,9 +203,17 @@ namespace ClientModels
 
         FAcceptTradeResponse(const FAcceptTradeResponse& src) :
             FPlayFabCppResultCommon(),
-            Trade(src.Trade.IsValid() ? MakeShareable(new FTradeInfo(*src.Trade)) : nullptr)
+            Trade(src.Trade.IsValid() ? TSharedPtr<FTradeInfo>(MakeShared<FTradeInfo>(*src.Trade)) : nullptr)
             {}
 
+        FAcceptTradeResponse(FAcceptTradeResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Trade(MoveTemp(src.Trade))
+            {}
+
+        FAcceptTradeResponse& operator=(const FAcceptTradeResponse& src) = default;
+        FAcceptTradeResponse& operator=(FAcceptTradeResponse&& src) = default;
+
         FAcceptTradeResponse(const TSharedPtr<FJsonObject>& obj) : FAcceptTradeResponse()
         {
             readFromValue(obj);
@@ -171,7 +222,13 @@ namespace ClientModels
         ~FAcceptTradeResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum AdActivity
@@ -183,6 +240,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeAdActivityEnumJSON(AdActivity enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeAdActivityEnumJSON(AdActivity enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API AdActivity readAdActivityFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API AdActivity readAdActivityFromValue(const FString& value);
 
@@ -211,6 +269,16 @@ namespace ClientModels
             Platform(src.Platform)
             {}
 
+        FAdCampaignAttributionModel(FAdCampaignAttributionModel&& src) :
+            FPlayFabCppBaseModel(),
+            AttributedAt(MoveTemp(src.AttributedAt)),
+            CampaignId(MoveTemp(src.CampaignId)),
+            Platform(MoveTemp(src.Platform))
+            {}
+
+        FAdCampaignAttributionModel& operator=(const FAdCampaignAttributionModel& src) = default;
+        FAdCampaignAttributionModel& operator=(FAdCampaignAttributionModel&& src) = default;
+
         FAdCampaignAttributionModel(const TSharedPtr<FJsonObject>& obj) : FAdCampaignAttributionModel()
         {
             readFromValue(obj);
@@ -219,7 +287,13 @@ namespace ClientModels
         ~FAdCampaignAttributionModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddFriendRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -252,6 +326,17 @@ namespace ClientModels
             FriendUsername(src.FriendUsername)
             {}
 
+        FAddFriendRequest(FAddFriendRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            FriendEmail(MoveTemp(src.FriendEmail)),
+            FriendPlayFabId(MoveTemp(src.FriendPlayFabId)),
+            FriendTitleDisplayName(MoveTemp(src.FriendTitleDisplayName)),
+            FriendUsername(MoveTemp(src.FriendUsername))
+            {}
+
+        FAddFriendRequest& operator=(const FAddFriendRequest& src) = default;
+        FAddFriendRequest& operator=(FAddFriendRequest&& src) = default;
+
         FAddFriendRequest(const TSharedPtr<FJsonObject>& obj) : FAddFriendRequest()
         {
             readFromValue(obj);
@@ -260,7 +345,13 @@ namespace ClientModels
         ~FAddFriendRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddFriendResult : public PlayFab::FPlayFabCppResultCommon
@@ -278,6 +369,14 @@ namespace ClientModels
             Created(src.Created)
             {}
 
+        FAddFriendResult(FAddFriendResult&& src) :
+            FPlayFabCppResultCommon(),
+            Created(MoveTemp(src.Created))
+            {}
+
+        FAddFriendResult& operator=(const FAddFriendResult& src) = default;
+        FAddFriendResult& operator=(FAddFriendResult&& src) = default;
+
         FAddFriendResult(const TSharedPtr<FJsonObject>& obj) : FAddFriendResult()
         {
             readFromValue(obj);
@@ -286,7 +385,13 @@ namespace ClientModels
         ~FAddFriendResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGenericServiceId : public PlayFab::FPlayFabCppBaseModel
@@ -309,6 +414,15 @@ namespace ClientModels
             UserId(src.UserId)
             {}
 
+        FGenericServiceId(FGenericServiceId&& src) :
+            FPlayFabCppBaseModel(),
+            ServiceName(MoveTemp(src.ServiceName)),
+            UserId(MoveTemp(src.UserId))
+            {}
+
+        FGenericServiceId& operator=(const FGenericServiceId& src) = default;
+        FGenericServiceId& operator=(FGenericServiceId&& src) = default;
+
         FGenericServiceId(const TSharedPtr<FJsonObject>& obj) : FGenericServiceId()
         {
             readFromValue(obj);
@@ -317,7 +431,13 @@ namespace ClientModels
         ~FGenericServiceId();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddGenericIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -335,6 +455,14 @@ namespace ClientModels
             GenericId(src.GenericId)
             {}
 
+        FAddGenericIDRequest(FAddGenericIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            GenericId(MoveTemp(src.GenericId))
+            {}
+
+        FAddGenericIDRequest& operator=(const FAddGenericIDRequest& src) = default;
+        FAddGenericIDRequest& operator=(FAddGenericIDRequest&& src) = default;
+
         FAddGenericIDRequest(const TSharedPtr<FJsonObject>& obj) : FAddGenericIDRequest()
         {
             readFromValue(obj);
@@ -343,7 +471,13 @@ namespace ClientModels
         ~FAddGenericIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddGenericIDResult : public PlayFab::FPlayFabCppResultCommon
@@ -356,6 +490,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FAddGenericIDResult(FAddGenericIDResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FAddGenericIDResult& operator=(const FAddGenericIDResult& src) = default;
+        FAddGenericIDResult& operator=(FAddGenericIDResult&& src) = default;
+
         FAddGenericIDResult(const TSharedPtr<FJsonObject>& obj) : FAddGenericIDResult()
         {
             readFromValue(obj);
@@ -364,7 +505,13 @@ namespace ClientModels
         ~FAddGenericIDResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddOrUpdateContactEmailRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -386,6 +533,15 @@ namespace ClientModels
             EmailAddress(src.EmailAddress)
             {}
 
+        FAddOrUpdateContactEmailRequest(FAddOrUpdateContactEmailRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EmailAddress(MoveTemp(src.EmailAddress))
+            {}
+
+        FAddOrUpdateContactEmailRequest& operator=(const FAddOrUpdateContactEmailRequest& src) = default;
+        FAddOrUpdateContactEmailRequest& operator=(FAddOrUpdateContactEmailRequest&& src) = default;
+
         FAddOrUpdateContactEmailRequest(const TSharedPtr<FJsonObject>& obj) : FAddOrUpdateContactEmailRequest()
         {
             readFromValue(obj);
@@ -394,7 +550,13 @@ namespace ClientModels
         ~FAddOrUpdateContactEmailRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddOrUpdateContactEmailResult : public PlayFab::FPlayFabCppResultCommon
@@ -407,6 +569,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FAddOrUpdateContactEmailResult(FAddOrUpdateContactEmailResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FAddOrUpdateContactEmailResult& operator=(const FAddOrUpdateContactEmailResult& src) = default;
+        FAddOrUpdateContactEmailResult& operator=(FAddOrUpdateContactEmailResult&& src) = default;
+
         FAddOrUpdateContactEmailResult(const TSharedPtr<FJsonObject>& obj) : FAddOrUpdateContactEmailResult()
         {
             readFromValue(obj);
@@ -415,7 +584,13 @@ namespace ClientModels
         ~FAddOrUpdateContactEmailResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddSharedGroupMembersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -437,6 +612,15 @@ namespace ClientModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FAddSharedGroupMembersRequest(FAddSharedGroupMembersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabIds(MoveTemp(src.PlayFabIds)),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FAddSharedGroupMembersRequest& operator=(const FAddSharedGroupMembersRequest& src) = default;
+        FAddSharedGroupMembersRequest& operator=(FAddSharedGroupMembersRequest&& src) = default;
+
         FAddSharedGroupMembersRequest(const TSharedPtr<FJsonObject>& obj) : FAddSharedGroupMembersRequest()
         {
             readFromValue(obj);
@@ -445,7 +629,13 @@ namespace ClientModels
         ~FAddSharedGroupMembersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddSharedGroupMembersResult : public PlayFab::FPlayFabCppResultCommon
@@ -458,6 +648,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FAddSharedGroupMembersResult(FAddSharedGroupMembersResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FAddSharedGroupMembersResult& operator=(const FAddSharedGroupMembersResult& src) = default;
+        FAddSharedGroupMembersResult& operator=(FAddSharedGroupMembersResult&& src) = default;
+
         FAddSharedGroupMembersResult(const TSharedPtr<FJsonObject>& obj) : FAddSharedGroupMembersResult()
         {
             readFromValue(obj);
@@ -466,7 +663,13 @@ namespace ClientModels
         ~FAddSharedGroupMembersResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddUsernamePasswordRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -498,6 +701,17 @@ namespace ClientModels
             Username(src.Username)
             {}
 
+        FAddUsernamePasswordRequest(FAddUsernamePasswordRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Email(MoveTemp(src.Email)),
+            Password(MoveTemp(src.Password)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FAddUsernamePasswordRequest& operator=(const FAddUsernamePasswordRequest& src) = default;
+        FAddUsernamePasswordRequest& operator=(FAddUsernamePasswordRequest&& src) = default;
+
         FAddUsernamePasswordRequest(const TSharedPtr<FJsonObject>& obj) : FAddUsernamePasswordRequest()
         {
             readFromValue(obj);
@@ -506,7 +720,13 @@ namespace ClientModels
         ~FAddUsernamePasswordRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddUsernamePasswordResult : public PlayFab::FPlayFabCppResultCommon
@@ -524,6 +744,14 @@ namespace ClientModels
             Username(src.Username)
             {}
 
+        FAddUsernamePasswordResult(FAddUsernamePasswordResult&& src) :
+            FPlayFabCppResultCommon(),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FAddUsernamePasswordResult& operator=(const FAddUsernamePasswordResult& src) = default;
+        FAddUsernamePasswordResult& operator=(FAddUsernamePasswordResult&& src) = default;
+
         FAddUsernamePasswordResult(const TSharedPtr<FJsonObject>& obj) : FAddUsernamePasswordResult()
         {
             readFromValue(obj);
@@ -532,7 +760,13 @@ namespace ClientModels
         ~FAddUsernamePasswordResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddUserVirtualCurrencyRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -559,6 +793,16 @@ namespace ClientModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FAddUserVirtualCurrencyRequest(FAddUserVirtualCurrencyRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Amount(MoveTemp(src.Amount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FAddUserVirtualCurrencyRequest& operator=(const FAddUserVirtualCurrencyRequest& src) = default;
+        FAddUserVirtualCurrencyRequest& operator=(FAddUserVirtualCurrencyRequest&& src) = default;
+
         FAddUserVirtualCurrencyRequest(const TSharedPtr<FJsonObject>& obj) : FAddUserVirtualCurrencyRequest()
         {
             readFromValue(obj);
@@ -567,7 +811,13 @@ namespace ClientModels
         ~FAddUserVirtualCurrencyRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAdPlacementDetails : public PlayFab::FPlayFabCppBaseModel
@@ -620,6 +870,21 @@ namespace ClientModels
             RewardName(src.RewardName)
             {}
 
+        FAdPlacementDetails(FAdPlacementDetails&& src) :
+            FPlayFabCppBaseModel(),
+            PlacementId(MoveTemp(src.PlacementId)),
+            PlacementName(MoveTemp(src.PlacementName)),
+            PlacementViewsRemaining(MoveTemp(src.PlacementViewsRemaining)),
+            PlacementViewsResetMinutes(MoveTemp(src.PlacementViewsResetMinutes)),
+            RewardAssetUrl(MoveTemp(src.RewardAssetUrl)),
+            RewardDescription(MoveTemp(src.RewardDescription)),
+            RewardId(MoveTemp(src.RewardId)),
+            RewardName(MoveTemp(src.RewardName))
+            {}
+
+        FAdPlacementDetails& operator=(const FAdPlacementDetails& src) = default;
+        FAdPlacementDetails& operator=(FAdPlacementDetails&& src) = default;
+
         FAdPlacementDetails(const TSharedPtr<FJsonObject>& obj) : FAdPlacementDetails()
         {
             readFromValue(obj);
@@ -628,7 +893,13 @@ namespace ClientModels
         ~FAdPlacementDetails();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAdRewardItemGranted : public PlayFab::FPlayFabCppBaseModel
@@ -661,6 +932,17 @@ namespace ClientModels
             ItemId(src.ItemId)
             {}
 
+        FAdRewardItemGranted(FAdRewardItemGranted&& src) :
+            FPlayFabCppBaseModel(),
+            CatalogId(MoveTemp(src.CatalogId)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            InstanceId(MoveTemp(src.InstanceId)),
+            ItemId(MoveTemp(src.ItemId))
+            {}
+
+        FAdRewardItemGranted& operator=(const FAdRewardItemGranted& src) = default;
+        FAdRewardItemGranted& operator=(FAdRewardItemGranted&& src) = default;
+
         FAdRewardItemGranted(const TSharedPtr<FJsonObject>& obj) : FAdRewardItemGranted()
         {
             readFromValue(obj);
@@ -669,7 +951,13 @@ namespace ClientModels
         ~FAdRewardItemGranted();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAdRewardResults : public PlayFab::FPlayFabCppBaseModel
@@ -694,6 +982,16 @@ namespace ClientModels
             IncrementedStatistics(src.IncrementedStatistics)
             {}
 
+        FAdRewardResults(FAdRewardResults&& src) :
+            FPlayFabCppBaseModel(),
+            GrantedItems(MoveTemp(src.GrantedItems)),
+            GrantedVirtualCurrencies(MoveTemp(src.GrantedVirtualCurrencies)),
+            IncrementedStatistics(MoveTemp(src.IncrementedStatistics))
+            {}
+
+        FAdRewardResults& operator=(const FAdRewardResults& src) = default;
+        FAdRewardResults& operator=(FAdRewardResults&& src) = default;
+
         FAdRewardResults(const TSharedPtr<FJsonObject>& obj) : FAdRewardResults()
         {
             readFromValue(obj);
@@ -702,7 +1000,13 @@ namespace ClientModels
         ~FAdRewardResults();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAndroidDevicePushNotificationRegistrationRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -733,6 +1037,16 @@ namespace ClientModels
             SendPushNotificationConfirmation(src.SendPushNotificationConfirmation)
             {}
 
+        FAndroidDevicePushNotificationRegistrationRequest(FAndroidDevicePushNotificationRegistrationRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ConfirmationMessage(MoveTemp(src.ConfirmationMessage)),
+            DeviceToken(MoveTemp(src.DeviceToken)),
+            SendPushNotificationConfirmation(MoveTemp(src.SendPushNotificationConfirmation))
+            {}
+
+        FAndroidDevicePushNotificationRegistrationRequest& operator=(const FAndroidDevicePushNotificationRegistrationRequest& src) = default;
+        FAndroidDevicePushNotificationRegistrationRequest& operator=(FAndroidDevicePushNotificationRegistrationRequest&& src) = default;
+
         FAndroidDevicePushNotificationRegistrationRequest(const TSharedPtr<FJsonObject>& obj) : FAndroidDevicePushNotificationRegistrationRequest()
         {
             readFromValue(obj);
@@ -741,7 +1055,13 @@ namespace ClientModels
         ~FAndroidDevicePushNotificationRegistrationRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAndroidDevicePushNotificationRegistrationResult : public PlayFab::FPlayFabCppResultCommon
@@ -754,6 +1074,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FAndroidDevicePushNotificationRegistrationResult(FAndroidDevicePushNotificationRegistrationResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FAndroidDevicePushNotificationRegistrationResult& operator=(const FAndroidDevicePushNotificationRegistrationResult& src) = default;
+        FAndroidDevicePushNotificationRegistrationResult& operator=(FAndroidDevicePushNotificationRegistrationResult&& src) = default;
+
         FAndroidDevicePushNotificationRegistrationResult(const TSharedPtr<FJsonObject>& obj) : FAndroidDevicePushNotificationRegistrationResult()
         {
             readFromValue(obj);
@@ -766,7 +1093,13 @@ namespace ClientModels
     };
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCancelTradeRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -784,6 +1117,14 @@ namespace ClientModels
             TradeId(src.TradeId)
             {}
 
+        FCancelTradeRequest(FCancelTradeRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            TradeId(MoveTemp(src.TradeId))
+            {}
+
+        FCancelTradeRequest& operator=(const FCancelTradeRequest& src) = default;
+        FCancelTradeRequest& operator=(FCancelTradeRequest&& src) = default;
+
         FCancelTradeRequest(const TSharedPtr<FJsonObject>& obj) : FCancelTradeRequest()
         {
             readFromValue(obj);
@@ -792,7 +1133,13 @@ namespace ClientModels
         ~FCancelTradeRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCancelTradeResponse : public PlayFab::FPlayFabCppResultCommon
@@ -807,9 +1154,17 @@ namespace ClientModels
 
         FCancelTradeResponse(const FCancelTradeResponse& src) :
             FPlayFabCppResultCommon(),
-            Trade(src.Trade.IsValid() ? MakeShareable(new FTradeInfo(*src.Trade)) : nullptr)
+            Trade(src.Trade.IsValid() ? TSharedPtr<FTradeInfo>(MakeShared<FTradeInfo>(*src.Trade)) : nullptr)
             {}
 
+        FCancelTradeResponse(FCancelTradeResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Trade(MoveTemp(src.Trade))
+            {}
+
+        FCancelTradeResponse& operator=(const FCancelTradeResponse& src) = default;
+        FCancelTradeResponse& operator=(FCancelTradeResponse&& src) = default;
+
         FCancelTradeResponse(const TSharedPtr<FJsonObject>& obj) : FCancelTradeResponse()
         {
             readFromValue(obj);
@@ -818,7 +1173,13 @@ namespace ClientModels
         ~FCancelTradeResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCartItem : public PlayFab::FPlayFabCppBaseModel
@@ -868,6 +1229,21 @@ namespace ClientModels
             VirtualCurrencyPrices(src.VirtualCurrencyPrices)
             {}
 
+        FCartItem(FCartItem&& src) :
+            FPlayFabCppBaseModel(),
+            Description(MoveTemp(src.Description)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            ItemClass(MoveTemp(src.ItemClass)),
+            ItemId(MoveTemp(src.ItemId)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            RealCurrencyPrices(MoveTemp(src.RealCurrencyPrices)),
+            VCAmount(MoveTemp(src.VCAmount)),
+            VirtualCurrencyPrices(MoveTemp(src.VirtualCurrencyPrices))
+            {}
+
+        FCartItem& operator=(const FCartItem& src) = default;
+        FCartItem& operator=(FCartItem&& src) = default;
+
         FCartItem(const TSharedPtr<FJsonObject>& obj) : FCartItem()
         {
             readFromValue(obj);
@@ -876,7 +1252,13 @@ namespace ClientModels
         ~FCartItem();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCatalogItemBundleInfo : public PlayFab::FPlayFabCppBaseModel
@@ -904,6 +1286,16 @@ namespace ClientModels
             BundledVirtualCurrencies(src.BundledVirtualCurrencies)
             {}
 
+        FCatalogItemBundleInfo(FCatalogItemBundleInfo&& src) :
+            FPlayFabCppBaseModel(),
+            BundledItems(MoveTemp(src.BundledItems)),
+            BundledResultTables(MoveTemp(src.BundledResultTables)),
+            BundledVirtualCurrencies(MoveTemp(src.BundledVirtualCurrencies))
+            {}
+
+        FCatalogItemBundleInfo& operator=(const FCatalogItemBundleInfo& src) = default;
+        FCatalogItemBundleInfo& operator=(FCatalogItemBundleInfo&& src) = default;
+
         FCatalogItemBundleInfo(const TSharedPtr<FJsonObject>& obj) : FCatalogItemBundleInfo()
         {
             readFromValue(obj);
@@ -912,7 +1304,13 @@ namespace ClientModels
         ~FCatalogItemBundleInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCatalogItemConsumableInfo : public PlayFab::FPlayFabCppBaseModel
@@ -947,6 +1345,16 @@ namespace ClientModels
             UsagePeriodGroup(src.UsagePeriodGroup)
             {}
 
+        FCatalogItemConsumableInfo(FCatalogItemConsumableInfo&& src) :
+            FPlayFabCppBaseModel(),
+            UsageCount(MoveTemp(src.UsageCount)),
+            UsagePeriod(MoveTemp(src.UsagePeriod)),
+            UsagePeriodGroup(MoveTemp(src.UsagePeriodGroup))
+            {}
+
+        FCatalogItemConsumableInfo& operator=(const FCatalogItemConsumableInfo& src) = default;
+        FCatalogItemConsumableInfo& operator=(FCatalogItemConsumableInfo&& src) = default;
+
         FCatalogItemConsumableInfo(const TSharedPtr<FJsonObject>& obj) : FCatalogItemConsumableInfo()
         {
             readFromValue(obj);
@@ -955,7 +1363,13 @@ namespace ClientModels
         ~FCatalogItemConsumableInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCatalogItemContainerInfo : public PlayFab::FPlayFabCppBaseModel
@@ -991,6 +1405,17 @@ namespace ClientModels
             VirtualCurrencyContents(src.VirtualCurrencyContents)
             {}
 
+        FCatalogItemContainerInfo(FCatalogItemContainerInfo&& src) :
+            FPlayFabCppBaseModel(),
+            ItemContents(MoveTemp(src.ItemContents)),
+            KeyItemId(MoveTemp(src.KeyItemId)),
+            ResultTableContents(MoveTemp(src.ResultTableContents)),
+            VirtualCurrencyContents(MoveTemp(src.VirtualCurrencyContents))
+            {}
+
+        FCatalogItemContainerInfo& operator=(const FCatalogItemContainerInfo& src) = default;
+        FCatalogItemContainerInfo& operator=(FCatalogItemContainerInfo&& src) = default;
+
         FCatalogItemContainerInfo(const TSharedPtr<FJsonObject>& obj) : FCatalogItemContainerInfo()
         {
             readFromValue(obj);
@@ -999,7 +1424,13 @@ namespace ClientModels
         ~FCatalogItemContainerInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCatalogItem : public PlayFab::FPlayFabCppBaseModel
@@ -1097,11 +1528,11 @@ namespace ClientModels
 
         FCatalogItem(const FCatalogItem& src) :
             FPlayFabCppBaseModel(),
-            Bundle(src.Bundle.IsValid() ? MakeShareable(new FCatalogItemBundleInfo(*src.Bundle)) : nullptr),
+            Bundle(src.Bundle.IsValid() ? TSharedPtr<FCatalogItemBundleInfo>(MakeShared<FCatalogItemBundleInfo>(*src.Bundle)) : nullptr),
             CanBecomeCharacter(src.CanBecomeCharacter),
             CatalogVersion(src.CatalogVersion),
-            Consumable(src.Consumable.IsValid() ? MakeShareable(new FCatalogItemConsumableInfo(*src.Consumable)) : nullptr),
-            Container(src.Container.IsValid() ? MakeShareable(new FCatalogItemContainerInfo(*src.Container)) : nullptr),
+            Consumable(src.Consumable.IsValid() ? TSharedPtr<FCatalogItemConsumableInfo>(MakeShared<FCatalogItemConsumableInfo>(*src.Consumable)) : nullptr),
+            Container(src.Container.IsValid() ? TSharedPtr<FCatalogItemContainerInfo>(MakeShared<FCatalogItemContainerInfo>(*src.Container)) : nullptr),
             CustomData(src.CustomData),
             Description(src.Description),
             DisplayName(src.DisplayName),
@@ -1117,6 +1548,31 @@ namespace ClientModels
             VirtualCurrencyPrices(src.VirtualCurrencyPrices)
             {}
 
+        FCatalogItem(FCatalogItem&& src) :
+            FPlayFabCppBaseModel(),
+            Bundle(MoveTemp(src.Bundle)),
+            CanBecomeCharacter(MoveTemp(src.CanBecomeCharacter)),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            Consumable(MoveTemp(src.Consumable)),
+            Container(MoveTemp(src.Container)),
+            CustomData(MoveTemp(src.CustomData)),
+            Description(MoveTemp(src.Description)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            InitialLimitedEditionCount(MoveTemp(src.InitialLimitedEditionCount)),
+            IsLimitedEdition(MoveTemp(src.IsLimitedEdition)),
+            IsStackable(MoveTemp(src.IsStackable)),
+            IsTradable(MoveTemp(src.IsTradable)),
+            ItemClass(MoveTemp(src.ItemClass)),
+            ItemId(MoveTemp(src.ItemId)),
+            ItemImageUrl(MoveTemp(src.ItemImageUrl)),
+            RealCurrencyPrices(MoveTemp(src.RealCurrencyPrices)),
+            Tags(MoveTemp(src.Tags)),
+            VirtualCurrencyPrices(MoveTemp(src.VirtualCurrencyPrices))
+            {}
+
+        FCatalogItem& operator=(const FCatalogItem& src) = default;
+        FCatalogItem& operator=(FCatalogItem&& src) = default;
+
         FCatalogItem(const TSharedPtr<FJsonObject>& obj) : FCatalogItem()
         {
             readFromValue(obj);
@@ -1125,7 +1581,13 @@ namespace ClientModels
         ~FCatalogItem();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FItemInstance : public PlayFab::FPlayFabCppBaseModel
@@ -1217,6 +1679,28 @@ namespace ClientModels
             UsesIncrementedBy(src.UsesIncrementedBy)
             {}
 
+        FItemInstance(FItemInstance&& src) :
+            FPlayFabCppBaseModel(),
+            Annotation(MoveTemp(src.Annotation)),
+            BundleContents(MoveTemp(src.BundleContents)),
+            BundleParent(MoveTemp(src.BundleParent)),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomData(MoveTemp(src.CustomData)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            Expiration(MoveTemp(src.Expiration)),
+            ItemClass(MoveTemp(src.ItemClass)),
+            ItemId(MoveTemp(src.ItemId)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            PurchaseDate(MoveTemp(src.PurchaseDate)),
+            RemainingUses(MoveTemp(src.RemainingUses)),
+            UnitCurrency(MoveTemp(src.UnitCurrency)),
+            UnitPrice(MoveTemp(src.UnitPrice)),
+            UsesIncrementedBy(MoveTemp(src.UsesIncrementedBy))
+            {}
+
+        FItemInstance& operator=(const FItemInstance& src) = default;
+        FItemInstance& operator=(FItemInstance&& src) = default;
+
         FItemInstance(const TSharedPtr<FJsonObject>& obj) : FItemInstance()
         {
             readFromValue(obj);
@@ -1225,7 +1709,13 @@ namespace ClientModels
         ~FItemInstance();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCharacterInventory : public PlayFab::FPlayFabCppBaseModel
@@ -1247,6 +1737,15 @@ namespace ClientModels
             Inventory(src.Inventory)
             {}
 
+        FCharacterInventory(FCharacterInventory&& src) :
+            FPlayFabCppBaseModel(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            Inventory(MoveTemp(src.Inventory))
+            {}
+
+        FCharacterInventory& operator=(const FCharacterInventory& src) = default;
+        FCharacterInventory& operator=(FCharacterInventory&& src) = default;
+
         FCharacterInventory(const TSharedPtr<FJsonObject>& obj) : FCharacterInventory()
         {
             readFromValue(obj);
@@ -1255,7 +1754,13 @@ namespace ClientModels
         ~FCharacterInventory();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCharacterLeaderboardEntry : public PlayFab::FPlayFabCppBaseModel
@@ -1303,6 +1808,20 @@ namespace ClientModels
             StatValue(src.StatValue)
             {}
 
+        FCharacterLeaderboardEntry(FCharacterLeaderboardEntry&& src) :
+            FPlayFabCppBaseModel(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CharacterName(MoveTemp(src.CharacterName)),
+            CharacterType(MoveTemp(src.CharacterType)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Position(MoveTemp(src.Position)),
+            StatValue(MoveTemp(src.StatValue))
+            {}
+
+        FCharacterLeaderboardEntry& operator=(const FCharacterLeaderboardEntry& src) = default;
+        FCharacterLeaderboardEntry& operator=(FCharacterLeaderboardEntry&& src) = default;
+
         FCharacterLeaderboardEntry(const TSharedPtr<FJsonObject>& obj) : FCharacterLeaderboardEntry()
         {
             readFromValue(obj);
@@ -1311,7 +1830,13 @@ namespace ClientModels
         ~FCharacterLeaderboardEntry();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCharacterResult : public PlayFab::FPlayFabCppBaseModel
@@ -1339,6 +1864,16 @@ namespace ClientModels
             CharacterType(src.CharacterType)
             {}
 
+        FCharacterResult(FCharacterResult&& src) :
+            FPlayFabCppBaseModel(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CharacterName(MoveTemp(src.CharacterName)),
+            CharacterType(MoveTemp(src.CharacterType))
+            {}
+
+        FCharacterResult& operator=(const FCharacterResult& src) = default;
+        FCharacterResult& operator=(FCharacterResult&& src) = default;
+
         FCharacterResult(const TSharedPtr<FJsonObject>& obj) : FCharacterResult()
         {
             readFromValue(obj);
@@ -1347,7 +1882,13 @@ namespace ClientModels
         ~FCharacterResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum CloudScriptRevisionOption
@@ -1358,6 +1899,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeCloudScriptRevisionOptionEnumJSON(CloudScriptRevisionOption enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeCloudScriptRevisionOptionEnumJSON(CloudScriptRevisionOption enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API CloudScriptRevisionOption readCloudScriptRevisionOptionFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API CloudScriptRevisionOption readCloudScriptRevisionOptionFromValue(const FString& value);
 
@@ -1375,6 +1917,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FContainer_Dictionary_String_String(FContainer_Dictionary_String_String&& src) :
+            FPlayFabCppBaseModel(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FContainer_Dictionary_String_String& operator=(const FContainer_Dictionary_String_String& src) = default;
+        FContainer_Dictionary_String_String& operator=(FContainer_Dictionary_String_String&& src) = default;
+
         FContainer_Dictionary_String_String(const TSharedPtr<FJsonObject>& obj) : FContainer_Dictionary_String_String()
         {
             readFromValue(obj);
@@ -1383,7 +1933,13 @@ namespace ClientModels
         ~FContainer_Dictionary_String_String();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCollectionFilter : public PlayFab::FPlayFabCppBaseModel
@@ -1407,6 +1963,15 @@ namespace ClientModels
             Includes(src.Includes)
             {}
 
+        FCollectionFilter(FCollectionFilter&& src) :
+            FPlayFabCppBaseModel(),
+            Excludes(MoveTemp(src.Excludes)),
+            Includes(MoveTemp(src.Includes))
+            {}
+
+        FCollectionFilter& operator=(const FCollectionFilter& src) = default;
+        FCollectionFilter& operator=(FCollectionFilter&& src) = default;
+
         FCollectionFilter(const TSharedPtr<FJsonObject>& obj) : FCollectionFilter()
         {
             readFromValue(obj);
@@ -1415,7 +1980,13 @@ namespace ClientModels
         ~FCollectionFilter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConfirmPurchaseRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1437,6 +2008,15 @@ namespace ClientModels
             OrderId(src.OrderId)
             {}
 
+        FConfirmPurchaseRequest(FConfirmPurchaseRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            OrderId(MoveTemp(src.OrderId))
+            {}
+
+        FConfirmPurchaseRequest& operator=(const FConfirmPurchaseRequest& src) = default;
+        FConfirmPurchaseRequest& operator=(FConfirmPurchaseRequest&& src) = default;
+
         FConfirmPurchaseRequest(const TSharedPtr<FJsonObject>& obj) : FConfirmPurchaseRequest()
         {
             readFromValue(obj);
@@ -1445,7 +2025,13 @@ namespace ClientModels
         ~FConfirmPurchaseRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConfirmPurchaseResult : public PlayFab::FPlayFabCppResultCommon
@@ -1472,6 +2058,16 @@ namespace ClientModels
             PurchaseDate(src.PurchaseDate)
             {}
 
+        FConfirmPurchaseResult(FConfirmPurchaseResult&& src) :
+            FPlayFabCppResultCommon(),
+            Items(MoveTemp(src.Items)),
+            OrderId(MoveTemp(src.OrderId)),
+            PurchaseDate(MoveTemp(src.PurchaseDate))
+            {}
+
+        FConfirmPurchaseResult& operator=(const FConfirmPurchaseResult& src) = default;
+        FConfirmPurchaseResult& operator=(FConfirmPurchaseResult&& src) = default;
+
         FConfirmPurchaseResult(const TSharedPtr<FJsonObject>& obj) : FConfirmPurchaseResult()
         {
             readFromValue(obj);
@@ -1480,7 +2076,13 @@ namespace ClientModels
         ~FConfirmPurchaseResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumeItemRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1512,6 +2114,17 @@ namespace ClientModels
             ItemInstanceId(src.ItemInstanceId)
             {}
 
+        FConsumeItemRequest(FConsumeItemRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            ConsumeCount(MoveTemp(src.ConsumeCount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId))
+            {}
+
+        FConsumeItemRequest& operator=(const FConsumeItemRequest& src) = default;
+        FConsumeItemRequest& operator=(FConsumeItemRequest&& src) = default;
+
         FConsumeItemRequest(const TSharedPtr<FJsonObject>& obj) : FConsumeItemRequest()
         {
             readFromValue(obj);
@@ -1520,7 +2133,13 @@ namespace ClientModels
         ~FConsumeItemRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumeItemResult : public PlayFab::FPlayFabCppResultCommon
@@ -1543,6 +2162,15 @@ namespace ClientModels
             RemainingUses(src.RemainingUses)
             {}
 
+        FConsumeItemResult(FConsumeItemResult&& src) :
+            FPlayFabCppResultCommon(),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            RemainingUses(MoveTemp(src.RemainingUses))
+            {}
+
+        FConsumeItemResult& operator=(const FConsumeItemResult& src) = default;
+        FConsumeItemResult& operator=(FConsumeItemResult&& src) = default;
+
         FConsumeItemResult(const TSharedPtr<FJsonObject>& obj) : FConsumeItemResult()
         {
             readFromValue(obj);
@@ -1551,7 +2179,13 @@ namespace ClientModels
         ~FConsumeItemResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMicrosoftStorePayload : public PlayFab::FPlayFabCppBaseModel
@@ -1582,6 +2216,16 @@ namespace ClientModels
             XboxToken(src.XboxToken)
             {}
 
+        FMicrosoftStorePayload(FMicrosoftStorePayload&& src) :
+            FPlayFabCppBaseModel(),
+            CollectionsMsIdKey(MoveTemp(src.CollectionsMsIdKey)),
+            UserId(MoveTemp(src.UserId)),
+            XboxToken(MoveTemp(src.XboxToken))
+            {}
+
+        FMicrosoftStorePayload& operator=(const FMicrosoftStorePayload& src) = default;
+        FMicrosoftStorePayload& operator=(FMicrosoftStorePayload&& src) = default;
+
         FMicrosoftStorePayload(const TSharedPtr<FJsonObject>& obj) : FMicrosoftStorePayload()
         {
             readFromValue(obj);
@@ -1590,7 +2234,13 @@ namespace ClientModels
         ~FMicrosoftStorePayload();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumeMicrosoftStoreEntitlementsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1617,6 +2267,16 @@ namespace ClientModels
             MarketplaceSpecificData(src.MarketplaceSpecificData)
             {}
 
+        FConsumeMicrosoftStoreEntitlementsRequest(FConsumeMicrosoftStoreEntitlementsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            MarketplaceSpecificData(MoveTemp(src.MarketplaceSpecificData))
+            {}
+
+        FConsumeMicrosoftStoreEntitlementsRequest& operator=(const FConsumeMicrosoftStoreEntitlementsRequest& src) = default;
+        FConsumeMicrosoftStoreEntitlementsRequest& operator=(FConsumeMicrosoftStoreEntitlementsRequest&& src) = default;
+
         FConsumeMicrosoftStoreEntitlementsRequest(const TSharedPtr<FJsonObject>& obj) : FConsumeMicrosoftStoreEntitlementsRequest()
         {
             readFromValue(obj);
@@ -1625,7 +2285,13 @@ namespace ClientModels
         ~FConsumeMicrosoftStoreEntitlementsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumeMicrosoftStoreEntitlementsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -1642,6 +2308,14 @@ namespace ClientModels
             Items(src.Items)
             {}
 
+        FConsumeMicrosoftStoreEntitlementsResponse(FConsumeMicrosoftStoreEntitlementsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Items(MoveTemp(src.Items))
+            {}
+
+        FConsumeMicrosoftStoreEntitlementsResponse& operator=(const FConsumeMicrosoftStoreEntitlementsResponse& src) = default;
+        FConsumeMicrosoftStoreEntitlementsResponse& operator=(FConsumeMicrosoftStoreEntitlementsResponse&& src) = default;
+
         FConsumeMicrosoftStoreEntitlementsResponse(const TSharedPtr<FJsonObject>& obj) : FConsumeMicrosoftStoreEntitlementsResponse()
         {
             readFromValue(obj);
@@ -1650,7 +2324,13 @@ namespace ClientModels
         ~FConsumeMicrosoftStoreEntitlementsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayStation5Payload : public PlayFab::FPlayFabCppBaseModel
@@ -1672,6 +2352,15 @@ namespace ClientModels
             ServiceLabel(src.ServiceLabel)
             {}
 
+        FPlayStation5Payload(FPlayStation5Payload&& src) :
+            FPlayFabCppBaseModel(),
+            Ids(MoveTemp(src.Ids)),
+            ServiceLabel(MoveTemp(src.ServiceLabel))
+            {}
+
+        FPlayStation5Payload& operator=(const FPlayStation5Payload& src) = default;
+        FPlayStation5Payload& operator=(FPlayStation5Payload&& src) = default;
+
         FPlayStation5Payload(const TSharedPtr<FJsonObject>& obj) : FPlayStation5Payload()
         {
             readFromValue(obj);
@@ -1680,7 +2369,13 @@ namespace ClientModels
         ~FPlayStation5Payload();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumePS5EntitlementsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1707,6 +2402,16 @@ namespace ClientModels
             MarketplaceSpecificData(src.MarketplaceSpecificData)
             {}
 
+        FConsumePS5EntitlementsRequest(FConsumePS5EntitlementsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            MarketplaceSpecificData(MoveTemp(src.MarketplaceSpecificData))
+            {}
+
+        FConsumePS5EntitlementsRequest& operator=(const FConsumePS5EntitlementsRequest& src) = default;
+        FConsumePS5EntitlementsRequest& operator=(FConsumePS5EntitlementsRequest&& src) = default;
+
         FConsumePS5EntitlementsRequest(const TSharedPtr<FJsonObject>& obj) : FConsumePS5EntitlementsRequest()
         {
             readFromValue(obj);
@@ -1715,7 +2420,13 @@ namespace ClientModels
         ~FConsumePS5EntitlementsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumePS5EntitlementsResult : public PlayFab::FPlayFabCppResultCommon
@@ -1732,6 +2443,14 @@ namespace ClientModels
             Items(src.Items)
             {}
 
+        FConsumePS5EntitlementsResult(FConsumePS5EntitlementsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Items(MoveTemp(src.Items))
+            {}
+
+        FConsumePS5EntitlementsResult& operator=(const FConsumePS5EntitlementsResult& src) = default;
+        FConsumePS5EntitlementsResult& operator=(FConsumePS5EntitlementsResult&& src) = default;
+
         FConsumePS5EntitlementsResult(const TSharedPtr<FJsonObject>& obj) : FConsumePS5EntitlementsResult()
         {
             readFromValue(obj);
@@ -1740,7 +2459,13 @@ namespace ClientModels
         ~FConsumePS5EntitlementsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumePSNEntitlementsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1767,6 +2492,16 @@ namespace ClientModels
             ServiceLabel(src.ServiceLabel)
             {}
 
+        FConsumePSNEntitlementsRequest(FConsumePSNEntitlementsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ServiceLabel(MoveTemp(src.ServiceLabel))
+            {}
+
+        FConsumePSNEntitlementsRequest& operator=(const FConsumePSNEntitlementsRequest& src) = default;
+        FConsumePSNEntitlementsRequest& operator=(FConsumePSNEntitlementsRequest&& src) = default;
+
         FConsumePSNEntitlementsRequest(const TSharedPtr<FJsonObject>& obj) : FConsumePSNEntitlementsRequest()
         {
             readFromValue(obj);
@@ -1775,7 +2510,13 @@ namespace ClientModels
         ~FConsumePSNEntitlementsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumePSNEntitlementsResult : public PlayFab::FPlayFabCppResultCommon
@@ -1792,6 +2533,14 @@ namespace ClientModels
             ItemsGranted(src.ItemsGranted)
             {}
 
+        FConsumePSNEntitlementsResult(FConsumePSNEntitlementsResult&& src) :
+            FPlayFabCppResultCommon(),
+            ItemsGranted(MoveTemp(src.ItemsGranted))
+            {}
+
+        FConsumePSNEntitlementsResult& operator=(const FConsumePSNEntitlementsResult& src) = default;
+        FConsumePSNEntitlementsResult& operator=(FConsumePSNEntitlementsResult&& src) = default;
+
         FConsumePSNEntitlementsResult(const TSharedPtr<FJsonObject>& obj) : FConsumePSNEntitlementsResult()
         {
             readFromValue(obj);
@@ -1800,7 +2549,13 @@ namespace ClientModels
         ~FConsumePSNEntitlementsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumeXboxEntitlementsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1827,6 +2582,16 @@ namespace ClientModels
             XboxToken(src.XboxToken)
             {}
 
+        FConsumeXboxEntitlementsRequest(FConsumeXboxEntitlementsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            XboxToken(MoveTemp(src.XboxToken))
+            {}
+
+        FConsumeXboxEntitlementsRequest& operator=(const FConsumeXboxEntitlementsRequest& src) = default;
+        FConsumeXboxEntitlementsRequest& operator=(FConsumeXboxEntitlementsRequest&& src) = default;
+
         FConsumeXboxEntitlementsRequest(const TSharedPtr<FJsonObject>& obj) : FConsumeXboxEntitlementsRequest()
         {
             readFromValue(obj);
@@ -1835,7 +2600,13 @@ namespace ClientModels
         ~FConsumeXboxEntitlementsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumeXboxEntitlementsResult : public PlayFab::FPlayFabCppResultCommon
@@ -1852,6 +2623,14 @@ namespace ClientModels
             Items(src.Items)
             {}
 
+        FConsumeXboxEntitlementsResult(FConsumeXboxEntitlementsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Items(MoveTemp(src.Items))
+            {}
+
+        FConsumeXboxEntitlementsResult& operator=(const FConsumeXboxEntitlementsResult& src) = default;
+        FConsumeXboxEntitlementsResult& operator=(FConsumeXboxEntitlementsResult&& src) = default;
+
         FConsumeXboxEntitlementsResult(const TSharedPtr<FJsonObject>& obj) : FConsumeXboxEntitlementsResult()
         {
             readFromValue(obj);
@@ -1860,7 +2639,13 @@ namespace ClientModels
         ~FConsumeXboxEntitlementsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum EmailVerificationStatus
@@ -1871,6 +2656,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API EmailVerificationStatus readEmailVerificationStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API EmailVerificationStatus readEmailVerificationStatusFromValue(const FString& value);
 
@@ -1899,6 +2685,16 @@ namespace ClientModels
             VerificationStatus(src.VerificationStatus)
             {}
 
+        FContactEmailInfoModel(FContactEmailInfoModel&& src) :
+            FPlayFabCppBaseModel(),
+            EmailAddress(MoveTemp(src.EmailAddress)),
+            Name(MoveTemp(src.Name)),
+            VerificationStatus(MoveTemp(src.VerificationStatus))
+            {}
+
+        FContactEmailInfoModel& operator=(const FContactEmailInfoModel& src) = default;
+        FContactEmailInfoModel& operator=(FContactEmailInfoModel&& src) = default;
+
         FContactEmailInfoModel(const TSharedPtr<FJsonObject>& obj) : FContactEmailInfoModel()
         {
             readFromValue(obj);
@@ -1907,7 +2703,13 @@ namespace ClientModels
         ~FContactEmailInfoModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum ContinentCode
@@ -1922,6 +2724,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeContinentCodeEnumJSON(ContinentCode enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeContinentCodeEnumJSON(ContinentCode enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API ContinentCode readContinentCodeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API ContinentCode readContinentCodeFromValue(const FString& value);
 
@@ -2179,6 +2982,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeCountryCodeEnumJSON(CountryCode enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeCountryCodeEnumJSON(CountryCode enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API CountryCode readCountryCodeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API CountryCode readCountryCodeFromValue(const FString& value);
 
@@ -2197,6 +3001,14 @@ namespace ClientModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FCreateSharedGroupRequest(FCreateSharedGroupRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FCreateSharedGroupRequest& operator=(const FCreateSharedGroupRequest& src) = default;
+        FCreateSharedGroupRequest& operator=(FCreateSharedGroupRequest&& src) = default;
+
         FCreateSharedGroupRequest(const TSharedPtr<FJsonObject>& obj) : FCreateSharedGroupRequest()
         {
             readFromValue(obj);
@@ -2205,7 +3017,13 @@ namespace ClientModels
         ~FCreateSharedGroupRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateSharedGroupResult : public PlayFab::FPlayFabCppResultCommon
@@ -2223,6 +3041,14 @@ namespace ClientModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FCreateSharedGroupResult(FCreateSharedGroupResult&& src) :
+            FPlayFabCppResultCommon(),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FCreateSharedGroupResult& operator=(const FCreateSharedGroupResult& src) = default;
+        FCreateSharedGroupResult& operator=(FCreateSharedGroupResult&& src) = default;
+
         FCreateSharedGroupResult(const TSharedPtr<FJsonObject>& obj) : FCreateSharedGroupResult()
         {
             readFromValue(obj);
@@ -2231,7 +3057,13 @@ namespace ClientModels
         ~FCreateSharedGroupResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum Currency
@@ -2401,6 +3233,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeCurrencyEnumJSON(Currency enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeCurrencyEnumJSON(Currency enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API Currency readCurrencyFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API Currency readCurrencyFromValue(const FString& value);
 
@@ -2416,6 +3249,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeRegionEnumJSON(Region enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeRegionEnumJSON(Region enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API Region readRegionFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API Region readRegionFromValue(const FString& value);
 
@@ -2451,9 +3285,21 @@ namespace ClientModels
             GameMode(src.GameMode),
             pfRegion(src.pfRegion),
             StatisticName(src.StatisticName),
-            TagFilter(src.TagFilter.IsValid() ? MakeShareable(new FCollectionFilter(*src.TagFilter)) : nullptr)
+            TagFilter(src.TagFilter.IsValid() ? TSharedPtr<FCollectionFilter>(MakeShared<FCollectionFilter>(*src.TagFilter)) : nullptr)
+            {}
+
+        FCurrentGamesRequest(FCurrentGamesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildVersion(MoveTemp(src.BuildVersion)),
+            GameMode(MoveTemp(src.GameMode)),
+            pfRegion(MoveTemp(src.pfRegion)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            TagFilter(MoveTemp(src.TagFilter))
             {}
 
+        FCurrentGamesRequest& operator=(const FCurrentGamesRequest& src) = default;
+        FCurrentGamesRequest& operator=(FCurrentGamesRequest&& src) = default;
+
         FCurrentGamesRequest(const TSharedPtr<FJsonObject>& obj) : FCurrentGamesRequest()
         {
             readFromValue(obj);
@@ -2462,7 +3308,13 @@ namespace ClientModels
         ~FCurrentGamesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum GameInstanceState
@@ -2472,6 +3324,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeGameInstanceStateEnumJSON(GameInstanceState enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeGameInstanceStateEnumJSON(GameInstanceState enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API GameInstanceState readGameInstanceStateFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API GameInstanceState readGameInstanceStateFromValue(const FString& value);
 
@@ -2563,6 +3416,29 @@ namespace ClientModels
             Tags(src.Tags)
             {}
 
+        FGameInfo(FGameInfo&& src) :
+            FPlayFabCppBaseModel(),
+            BuildVersion(MoveTemp(src.BuildVersion)),
+            GameMode(MoveTemp(src.GameMode)),
+            GameServerData(MoveTemp(src.GameServerData)),
+            GameServerStateEnum(MoveTemp(src.GameServerStateEnum)),
+            LastHeartbeat(MoveTemp(src.LastHeartbeat)),
+            LobbyID(MoveTemp(src.LobbyID)),
+            MaxPlayers(MoveTemp(src.MaxPlayers)),
+            PlayerUserIds(MoveTemp(src.PlayerUserIds)),
+            pfRegion(MoveTemp(src.pfRegion)),
+            RunTime(MoveTemp(src.RunTime)),
+            ServerIPV4Address(MoveTemp(src.ServerIPV4Address)),
+            ServerIPV6Address(MoveTemp(src.ServerIPV6Address)),
+            ServerPort(MoveTemp(src.ServerPort)),
+            ServerPublicDNSName(MoveTemp(src.ServerPublicDNSName)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            Tags(MoveTemp(src.Tags))
+            {}
+
+        FGameInfo& operator=(const FGameInfo& src) = default;
+        FGameInfo& operator=(FGameInfo&& src) = default;
+
         FGameInfo(const TSharedPtr<FJsonObject>& obj) : FGameInfo()
         {
             readFromValue(obj);
@@ -2571,7 +3447,13 @@ namespace ClientModels
         ~FGameInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCurrentGamesResult : public PlayFab::FPlayFabCppResultCommon
@@ -2598,6 +3480,16 @@ namespace ClientModels
             PlayerCount(src.PlayerCount)
             {}
 
+        FCurrentGamesResult(FCurrentGamesResult&& src) :
+            FPlayFabCppResultCommon(),
+            GameCount(MoveTemp(src.GameCount)),
+            Games(MoveTemp(src.Games)),
+            PlayerCount(MoveTemp(src.PlayerCount))
+            {}
+
+        FCurrentGamesResult& operator=(const FCurrentGamesResult& src) = default;
+        FCurrentGamesResult& operator=(FCurrentGamesResult&& src) = default;
+
         FCurrentGamesResult(const TSharedPtr<FJsonObject>& obj) : FCurrentGamesResult()
         {
             readFromValue(obj);
@@ -2606,7 +3498,13 @@ namespace ClientModels
         ~FCurrentGamesResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeviceInfoRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2623,6 +3521,14 @@ namespace ClientModels
             Info(src.Info)
             {}
 
+        FDeviceInfoRequest(FDeviceInfoRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Info(MoveTemp(src.Info))
+            {}
+
+        FDeviceInfoRequest& operator=(const FDeviceInfoRequest& src) = default;
+        FDeviceInfoRequest& operator=(FDeviceInfoRequest&& src) = default;
+
         FDeviceInfoRequest(const TSharedPtr<FJsonObject>& obj) : FDeviceInfoRequest()
         {
             readFromValue(obj);
@@ -2631,7 +3537,13 @@ namespace ClientModels
         ~FDeviceInfoRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEmptyResponse : public PlayFab::FPlayFabCppResultCommon
@@ -2644,6 +3556,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FEmptyResponse(FEmptyResponse&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FEmptyResponse& operator=(const FEmptyResponse& src) = default;
+        FEmptyResponse& operator=(FEmptyResponse&& src) = default;
+
         FEmptyResponse(const TSharedPtr<FJsonObject>& obj) : FEmptyResponse()
         {
             readFromValue(obj);
@@ -2652,7 +3571,13 @@ namespace ClientModels
         ~FEmptyResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEmptyResult : public PlayFab::FPlayFabCppResultCommon
@@ -2665,6 +3590,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FEmptyResult(FEmptyResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FEmptyResult& operator=(const FEmptyResult& src) = default;
+        FEmptyResult& operator=(FEmptyResult&& src) = default;
+
         FEmptyResult(const TSharedPtr<FJsonObject>& obj) : FEmptyResult()
         {
             readFromValue(obj);
@@ -2673,7 +3605,13 @@ namespace ClientModels
         ~FEmptyResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityKey : public PlayFab::FPlayFabCppBaseModel
@@ -2696,6 +3634,15 @@ namespace ClientModels
             Type(src.Type)
             {}
 
+        FEntityKey(FEntityKey&& src) :
+            FPlayFabCppBaseModel(),
+            Id(MoveTemp(src.Id)),
+            Type(MoveTemp(src.Type))
+            {}
+
+        FEntityKey& operator=(const FEntityKey& src) = default;
+        FEntityKey& operator=(FEntityKey&& src) = default;
+
         FEntityKey(const TSharedPtr<FJsonObject>& obj) : FEntityKey()
         {
             readFromValue(obj);
@@ -2704,7 +3651,13 @@ namespace ClientModels
         ~FEntityKey();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityTokenResponse : public PlayFab::FPlayFabCppBaseModel
@@ -2727,11 +3680,21 @@ namespace ClientModels
 
         FEntityTokenResponse(const FEntityTokenResponse& src) :
             FPlayFabCppBaseModel(),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             EntityToken(src.EntityToken),
             TokenExpiration(src.TokenExpiration)
             {}
 
+        FEntityTokenResponse(FEntityTokenResponse&& src) :
+            FPlayFabCppBaseModel(),
+            Entity(MoveTemp(src.Entity)),
+            EntityToken(MoveTemp(src.EntityToken)),
+            TokenExpiration(MoveTemp(src.TokenExpiration))
+            {}
+
+        FEntityTokenResponse& operator=(const FEntityTokenResponse& src) = default;
+        FEntityTokenResponse& operator=(FEntityTokenResponse&& src) = default;
+
         FEntityTokenResponse(const TSharedPtr<FJsonObject>& obj) : FEntityTokenResponse()
         {
             readFromValue(obj);
@@ -2740,7 +3703,13 @@ namespace ClientModels
         ~FEntityTokenResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FExecuteCloudScriptRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2789,6 +3758,19 @@ namespace ClientModels
             SpecificRevision(src.SpecificRevision)
             {}
 
+        FExecuteCloudScriptRequest(FExecuteCloudScriptRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            FunctionName(MoveTemp(src.FunctionName)),
+            FunctionParameter(MoveTemp(src.FunctionParameter)),
+            GeneratePlayStreamEvent(MoveTemp(src.GeneratePlayStreamEvent)),
+            RevisionSelection(MoveTemp(src.RevisionSelection)),
+            SpecificRevision(MoveTemp(src.SpecificRevision))
+            {}
+
+        FExecuteCloudScriptRequest& operator=(const FExecuteCloudScriptRequest& src) = default;
+        FExecuteCloudScriptRequest& operator=(FExecuteCloudScriptRequest&& src) = default;
+
         FExecuteCloudScriptRequest(const TSharedPtr<FJsonObject>& obj) : FExecuteCloudScriptRequest()
         {
             readFromValue(obj);
@@ -2797,7 +3779,13 @@ namespace ClientModels
         ~FExecuteCloudScriptRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FScriptExecutionError : public PlayFab::FPlayFabCppBaseModel
@@ -2828,6 +3816,16 @@ namespace ClientModels
             StackTrace(src.StackTrace)
             {}
 
+        FScriptExecutionError(FScriptExecutionError&& src) :
+            FPlayFabCppBaseModel(),
+            Error(MoveTemp(src.Error)),
+            Message(MoveTemp(src.Message)),
+            StackTrace(MoveTemp(src.StackTrace))
+            {}
+
+        FScriptExecutionError& operator=(const FScriptExecutionError& src) = default;
+        FScriptExecutionError& operator=(FScriptExecutionError&& src) = default;
+
         FScriptExecutionError(const TSharedPtr<FJsonObject>& obj) : FScriptExecutionError()
         {
             readFromValue(obj);
@@ -2836,7 +3834,13 @@ namespace ClientModels
         ~FScriptExecutionError();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLogStatement : public PlayFab::FPlayFabCppBaseModel
@@ -2864,6 +3868,16 @@ namespace ClientModels
             Message(src.Message)
             {}
 
+        FLogStatement(FLogStatement&& src) :
+            FPlayFabCppBaseModel(),
+            Data(MoveTemp(src.Data)),
+            Level(MoveTemp(src.Level)),
+            Message(MoveTemp(src.Message))
+            {}
+
+        FLogStatement& operator=(const FLogStatement& src) = default;
+        FLogStatement& operator=(FLogStatement&& src) = default;
+
         FLogStatement(const TSharedPtr<FJsonObject>& obj) : FLogStatement()
         {
             readFromValue(obj);
@@ -2872,7 +3886,13 @@ namespace ClientModels
         ~FLogStatement();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FExecuteCloudScriptResult : public PlayFab::FPlayFabCppResultCommon
@@ -2941,7 +3961,7 @@ namespace ClientModels
         FExecuteCloudScriptResult(const FExecuteCloudScriptResult& src) :
             FPlayFabCppResultCommon(),
             APIRequestsIssued(src.APIRequestsIssued),
-            Error(src.Error.IsValid() ? MakeShareable(new FScriptExecutionError(*src.Error)) : nullptr),
+            Error(src.Error.IsValid() ? TSharedPtr<FScriptExecutionError>(MakeShared<FScriptExecutionError>(*src.Error)) : nullptr),
             ExecutionTimeSeconds(src.ExecutionTimeSeconds),
             FunctionName(src.FunctionName),
             FunctionResult(src.FunctionResult),
@@ -2954,6 +3974,25 @@ namespace ClientModels
             Revision(src.Revision)
             {}
 
+        FExecuteCloudScriptResult(FExecuteCloudScriptResult&& src) :
+            FPlayFabCppResultCommon(),
+            APIRequestsIssued(MoveTemp(src.APIRequestsIssued)),
+            Error(MoveTemp(src.Error)),
+            ExecutionTimeSeconds(MoveTemp(src.ExecutionTimeSeconds)),
+            FunctionName(MoveTemp(src.FunctionName)),
+            FunctionResult(MoveTemp(src.FunctionResult)),
+            FunctionResultTooLarge(MoveTemp(src.FunctionResultTooLarge)),
+            HttpRequestsIssued(MoveTemp(src.HttpRequestsIssued)),
+            Logs(MoveTemp(src.Logs)),
+            LogsTooLarge(MoveTemp(src.LogsTooLarge)),
+            MemoryConsumedBytes(MoveTemp(src.MemoryConsumedBytes)),
+            ProcessorTimeSeconds(MoveTemp(src.ProcessorTimeSeconds)),
+            Revision(MoveTemp(src.Revision))
+            {}
+
+        FExecuteCloudScriptResult& operator=(const FExecuteCloudScriptResult& src) = default;
+        FExecuteCloudScriptResult& operator=(FExecuteCloudScriptResult&& src) = default;
+
         FExecuteCloudScriptResult(const TSharedPtr<FJsonObject>& obj) : FExecuteCloudScriptResult()
         {
             readFromValue(obj);
@@ -2962,7 +4001,13 @@ namespace ClientModels
         ~FExecuteCloudScriptResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FFacebookInstantGamesPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -2985,6 +4030,15 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FFacebookInstantGamesPlayFabIdPair(FFacebookInstantGamesPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            FacebookInstantGamesId(MoveTemp(src.FacebookInstantGamesId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FFacebookInstantGamesPlayFabIdPair& operator=(const FFacebookInstantGamesPlayFabIdPair& src) = default;
+        FFacebookInstantGamesPlayFabIdPair& operator=(FFacebookInstantGamesPlayFabIdPair&& src) = default;
+
         FFacebookInstantGamesPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FFacebookInstantGamesPlayFabIdPair()
         {
             readFromValue(obj);
@@ -2993,7 +4047,13 @@ namespace ClientModels
         ~FFacebookInstantGamesPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FFacebookPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -3016,6 +4076,15 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FFacebookPlayFabIdPair(FFacebookPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            FacebookId(MoveTemp(src.FacebookId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FFacebookPlayFabIdPair& operator=(const FFacebookPlayFabIdPair& src) = default;
+        FFacebookPlayFabIdPair& operator=(FFacebookPlayFabIdPair&& src) = default;
+
         FFacebookPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FFacebookPlayFabIdPair()
         {
             readFromValue(obj);
@@ -3024,7 +4093,13 @@ namespace ClientModels
         ~FFacebookPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserFacebookInfo : public PlayFab::FPlayFabCppBaseModel
@@ -3047,6 +4122,15 @@ namespace ClientModels
             FullName(src.FullName)
             {}
 
+        FUserFacebookInfo(FUserFacebookInfo&& src) :
+            FPlayFabCppBaseModel(),
+            FacebookId(MoveTemp(src.FacebookId)),
+            FullName(MoveTemp(src.FullName))
+            {}
+
+        FUserFacebookInfo& operator=(const FUserFacebookInfo& src) = default;
+        FUserFacebookInfo& operator=(FUserFacebookInfo&& src) = default;
+
         FUserFacebookInfo(const TSharedPtr<FJsonObject>& obj) : FUserFacebookInfo()
         {
             readFromValue(obj);
@@ -3055,7 +4139,13 @@ namespace ClientModels
         ~FUserFacebookInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserGameCenterInfo : public PlayFab::FPlayFabCppBaseModel
@@ -3073,6 +4163,14 @@ namespace ClientModels
             GameCenterId(src.GameCenterId)
             {}
 
+        FUserGameCenterInfo(FUserGameCenterInfo&& src) :
+            FPlayFabCppBaseModel(),
+            GameCenterId(MoveTemp(src.GameCenterId))
+            {}
+
+        FUserGameCenterInfo& operator=(const FUserGameCenterInfo& src) = default;
+        FUserGameCenterInfo& operator=(FUserGameCenterInfo&& src) = default;
+
         FUserGameCenterInfo(const TSharedPtr<FJsonObject>& obj) : FUserGameCenterInfo()
         {
             readFromValue(obj);
@@ -3081,7 +4179,13 @@ namespace ClientModels
         ~FUserGameCenterInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum LoginIdentityProvider
@@ -3110,6 +4214,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API LoginIdentityProvider readLoginIdentityProviderFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API LoginIdentityProvider readLoginIdentityProviderFromValue(const FString& value);
 
@@ -3143,6 +4248,17 @@ namespace ClientModels
             Username(src.Username)
             {}
 
+        FLinkedPlatformAccountModel(FLinkedPlatformAccountModel&& src) :
+            FPlayFabCppBaseModel(),
+            Email(MoveTemp(src.Email)),
+            Platform(MoveTemp(src.Platform)),
+            PlatformUserId(MoveTemp(src.PlatformUserId)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FLinkedPlatformAccountModel& operator=(const FLinkedPlatformAccountModel& src) = default;
+        FLinkedPlatformAccountModel& operator=(FLinkedPlatformAccountModel&& src) = default;
+
         FLinkedPlatformAccountModel(const TSharedPtr<FJsonObject>& obj) : FLinkedPlatformAccountModel()
         {
             readFromValue(obj);
@@ -3151,7 +4267,13 @@ namespace ClientModels
         ~FLinkedPlatformAccountModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLocationModel : public PlayFab::FPlayFabCppBaseModel
@@ -3189,6 +4311,18 @@ namespace ClientModels
             Longitude(src.Longitude)
             {}
 
+        FLocationModel(FLocationModel&& src) :
+            FPlayFabCppBaseModel(),
+            City(MoveTemp(src.City)),
+            pfContinentCode(MoveTemp(src.pfContinentCode)),
+            pfCountryCode(MoveTemp(src.pfCountryCode)),
+            Latitude(MoveTemp(src.Latitude)),
+            Longitude(MoveTemp(src.Longitude))
+            {}
+
+        FLocationModel& operator=(const FLocationModel& src) = default;
+        FLocationModel& operator=(FLocationModel&& src) = default;
+
         FLocationModel(const TSharedPtr<FJsonObject>& obj) : FLocationModel()
         {
             readFromValue(obj);
@@ -3197,7 +4331,13 @@ namespace ClientModels
         ~FLocationModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum SubscriptionProviderStatus
@@ -3213,6 +4353,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API SubscriptionProviderStatus readSubscriptionProviderStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API SubscriptionProviderStatus readSubscriptionProviderStatusFromValue(const FString& value);
 
@@ -3261,6 +4402,20 @@ namespace ClientModels
             SubscriptionProvider(src.SubscriptionProvider)
             {}
 
+        FSubscriptionModel(FSubscriptionModel&& src) :
+            FPlayFabCppBaseModel(),
+            Expiration(MoveTemp(src.Expiration)),
+            InitialSubscriptionTime(MoveTemp(src.InitialSubscriptionTime)),
+            IsActive(MoveTemp(src.IsActive)),
+            Status(MoveTemp(src.Status)),
+            SubscriptionId(MoveTemp(src.SubscriptionId)),
+            SubscriptionItemId(MoveTemp(src.SubscriptionItemId)),
+            SubscriptionProvider(MoveTemp(src.SubscriptionProvider))
+            {}
+
+        FSubscriptionModel& operator=(const FSubscriptionModel& src) = default;
+        FSubscriptionModel& operator=(FSubscriptionModel&& src) = default;
+
         FSubscriptionModel(const TSharedPtr<FJsonObject>& obj) : FSubscriptionModel()
         {
             readFromValue(obj);
@@ -3269,7 +4424,13 @@ namespace ClientModels
         ~FSubscriptionModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMembershipModel : public PlayFab::FPlayFabCppBaseModel
@@ -3314,6 +4475,19 @@ namespace ClientModels
             Subscriptions(src.Subscriptions)
             {}
 
+        FMembershipModel(FMembershipModel&& src) :
+            FPlayFabCppBaseModel(),
+            IsActive(MoveTemp(src.IsActive)),
+            MembershipExpiration(MoveTemp(src.MembershipExpiration)),
+            MembershipId(MoveTemp(src.MembershipId)),
+            OverrideExpiration(MoveTemp(src.OverrideExpiration)),
+            OverrideIsSet(MoveTemp(src.OverrideIsSet)),
+            Subscriptions(MoveTemp(src.Subscriptions))
+            {}
+
+        FMembershipModel& operator=(const FMembershipModel& src) = default;
+        FMembershipModel& operator=(FMembershipModel&& src) = default;
+
         FMembershipModel(const TSharedPtr<FJsonObject>& obj) : FMembershipModel()
         {
             readFromValue(obj);
@@ -3322,7 +4496,13 @@ namespace ClientModels
         ~FMembershipModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum PushNotificationPlatform
@@ -3332,6 +4512,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API PushNotificationPlatform readPushNotificationPlatformFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API PushNotificationPlatform readPushNotificationPlatformFromValue(const FString& value);
 
@@ -3355,6 +4536,15 @@ namespace ClientModels
             Platform(src.Platform)
             {}
 
+        FPushNotificationRegistrationModel(FPushNotificationRegistrationModel&& src) :
+            FPlayFabCppBaseModel(),
+            NotificationEndpointARN(MoveTemp(src.NotificationEndpointARN)),
+            Platform(MoveTemp(src.Platform))
+            {}
+
+        FPushNotificationRegistrationModel& operator=(const FPushNotificationRegistrationModel& src) = default;
+        FPushNotificationRegistrationModel& operator=(FPushNotificationRegistrationModel&& src) = default;
+
         FPushNotificationRegistrationModel(const TSharedPtr<FJsonObject>& obj) : FPushNotificationRegistrationModel()
         {
             readFromValue(obj);
@@ -3363,7 +4553,13 @@ namespace ClientModels
         ~FPushNotificationRegistrationModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStatisticModel : public PlayFab::FPlayFabCppBaseModel
@@ -3391,6 +4587,16 @@ namespace ClientModels
             Version(src.Version)
             {}
 
+        FStatisticModel(FStatisticModel&& src) :
+            FPlayFabCppBaseModel(),
+            Name(MoveTemp(src.Name)),
+            Value(MoveTemp(src.Value)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FStatisticModel& operator=(const FStatisticModel& src) = default;
+        FStatisticModel& operator=(FStatisticModel&& src) = default;
+
         FStatisticModel(const TSharedPtr<FJsonObject>& obj) : FStatisticModel()
         {
             readFromValue(obj);
@@ -3399,7 +4605,13 @@ namespace ClientModels
         ~FStatisticModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FTagModel : public PlayFab::FPlayFabCppBaseModel
@@ -3417,6 +4629,14 @@ namespace ClientModels
             TagValue(src.TagValue)
             {}
 
+        FTagModel(FTagModel&& src) :
+            FPlayFabCppBaseModel(),
+            TagValue(MoveTemp(src.TagValue))
+            {}
+
+        FTagModel& operator=(const FTagModel& src) = default;
+        FTagModel& operator=(FTagModel&& src) = default;
+
         FTagModel(const TSharedPtr<FJsonObject>& obj) : FTagModel()
         {
             readFromValue(obj);
@@ -3425,7 +4645,13 @@ namespace ClientModels
         ~FTagModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValueToDateModel : public PlayFab::FPlayFabCppBaseModel
@@ -3459,6 +4685,16 @@ namespace ClientModels
             TotalValueAsDecimal(src.TotalValueAsDecimal)
             {}
 
+        FValueToDateModel(FValueToDateModel&& src) :
+            FPlayFabCppBaseModel(),
+            Currency(MoveTemp(src.Currency)),
+            TotalValue(MoveTemp(src.TotalValue)),
+            TotalValueAsDecimal(MoveTemp(src.TotalValueAsDecimal))
+            {}
+
+        FValueToDateModel& operator=(const FValueToDateModel& src) = default;
+        FValueToDateModel& operator=(FValueToDateModel&& src) = default;
+
         FValueToDateModel(const TSharedPtr<FJsonObject>& obj) : FValueToDateModel()
         {
             readFromValue(obj);
@@ -3467,7 +4703,13 @@ namespace ClientModels
         ~FValueToDateModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerProfileModel : public PlayFab::FPlayFabCppBaseModel
@@ -3573,6 +4815,33 @@ namespace ClientModels
             ValuesToDate(src.ValuesToDate)
             {}
 
+        FPlayerProfileModel(FPlayerProfileModel&& src) :
+            FPlayFabCppBaseModel(),
+            AdCampaignAttributions(MoveTemp(src.AdCampaignAttributions)),
+            AvatarUrl(MoveTemp(src.AvatarUrl)),
+            BannedUntil(MoveTemp(src.BannedUntil)),
+            ContactEmailAddresses(MoveTemp(src.ContactEmailAddresses)),
+            Created(MoveTemp(src.Created)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            ExperimentVariants(MoveTemp(src.ExperimentVariants)),
+            LastLogin(MoveTemp(src.LastLogin)),
+            LinkedAccounts(MoveTemp(src.LinkedAccounts)),
+            Locations(MoveTemp(src.Locations)),
+            Memberships(MoveTemp(src.Memberships)),
+            Origination(MoveTemp(src.Origination)),
+            PlayerId(MoveTemp(src.PlayerId)),
+            PublisherId(MoveTemp(src.PublisherId)),
+            PushNotificationRegistrations(MoveTemp(src.PushNotificationRegistrations)),
+            Statistics(MoveTemp(src.Statistics)),
+            Tags(MoveTemp(src.Tags)),
+            TitleId(MoveTemp(src.TitleId)),
+            TotalValueToDateInUSD(MoveTemp(src.TotalValueToDateInUSD)),
+            ValuesToDate(MoveTemp(src.ValuesToDate))
+            {}
+
+        FPlayerProfileModel& operator=(const FPlayerProfileModel& src) = default;
+        FPlayerProfileModel& operator=(FPlayerProfileModel&& src) = default;
+
         FPlayerProfileModel(const TSharedPtr<FJsonObject>& obj) : FPlayerProfileModel()
         {
             readFromValue(obj);
@@ -3581,7 +4850,13 @@ namespace ClientModels
         ~FPlayerProfileModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserPsnInfo : public PlayFab::FPlayFabCppBaseModel
@@ -3604,6 +4879,15 @@ namespace ClientModels
             PsnOnlineId(src.PsnOnlineId)
             {}
 
+        FUserPsnInfo(FUserPsnInfo&& src) :
+            FPlayFabCppBaseModel(),
+            PsnAccountId(MoveTemp(src.PsnAccountId)),
+            PsnOnlineId(MoveTemp(src.PsnOnlineId))
+            {}
+
+        FUserPsnInfo& operator=(const FUserPsnInfo& src) = default;
+        FUserPsnInfo& operator=(FUserPsnInfo&& src) = default;
+
         FUserPsnInfo(const TSharedPtr<FJsonObject>& obj) : FUserPsnInfo()
         {
             readFromValue(obj);
@@ -3612,7 +4896,13 @@ namespace ClientModels
         ~FUserPsnInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum TitleActivationStatus
@@ -3625,6 +4915,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeTitleActivationStatusEnumJSON(TitleActivationStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeTitleActivationStatusEnumJSON(TitleActivationStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API TitleActivationStatus readTitleActivationStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API TitleActivationStatus readTitleActivationStatusFromValue(const FString& value);
 
@@ -3663,6 +4954,18 @@ namespace ClientModels
             SteamName(src.SteamName)
             {}
 
+        FUserSteamInfo(FUserSteamInfo&& src) :
+            FPlayFabCppBaseModel(),
+            SteamActivationStatus(MoveTemp(src.SteamActivationStatus)),
+            SteamCountry(MoveTemp(src.SteamCountry)),
+            SteamCurrency(MoveTemp(src.SteamCurrency)),
+            SteamId(MoveTemp(src.SteamId)),
+            SteamName(MoveTemp(src.SteamName))
+            {}
+
+        FUserSteamInfo& operator=(const FUserSteamInfo& src) = default;
+        FUserSteamInfo& operator=(FUserSteamInfo&& src) = default;
+
         FUserSteamInfo(const TSharedPtr<FJsonObject>& obj) : FUserSteamInfo()
         {
             readFromValue(obj);
@@ -3671,7 +4974,13 @@ namespace ClientModels
         ~FUserSteamInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserXboxInfo : public PlayFab::FPlayFabCppBaseModel
@@ -3689,6 +4998,14 @@ namespace ClientModels
             XboxUserId(src.XboxUserId)
             {}
 
+        FUserXboxInfo(FUserXboxInfo&& src) :
+            FPlayFabCppBaseModel(),
+            XboxUserId(MoveTemp(src.XboxUserId))
+            {}
+
+        FUserXboxInfo& operator=(const FUserXboxInfo& src) = default;
+        FUserXboxInfo& operator=(FUserXboxInfo&& src) = default;
+
         FUserXboxInfo(const TSharedPtr<FJsonObject>& obj) : FUserXboxInfo()
         {
             readFromValue(obj);
@@ -3697,7 +5014,13 @@ namespace ClientModels
         ~FUserXboxInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FFriendInfo : public PlayFab::FPlayFabCppBaseModel
@@ -3747,18 +5070,35 @@ namespace ClientModels
 
         FFriendInfo(const FFriendInfo& src) :
             FPlayFabCppBaseModel(),
-            FacebookInfo(src.FacebookInfo.IsValid() ? MakeShareable(new FUserFacebookInfo(*src.FacebookInfo)) : nullptr),
+            FacebookInfo(src.FacebookInfo.IsValid() ? TSharedPtr<FUserFacebookInfo>(MakeShared<FUserFacebookInfo>(*src.FacebookInfo)) : nullptr),
             FriendPlayFabId(src.FriendPlayFabId),
-            GameCenterInfo(src.GameCenterInfo.IsValid() ? MakeShareable(new FUserGameCenterInfo(*src.GameCenterInfo)) : nullptr),
-            Profile(src.Profile.IsValid() ? MakeShareable(new FPlayerProfileModel(*src.Profile)) : nullptr),
-            PSNInfo(src.PSNInfo.IsValid() ? MakeShareable(new FUserPsnInfo(*src.PSNInfo)) : nullptr),
-            SteamInfo(src.SteamInfo.IsValid() ? MakeShareable(new FUserSteamInfo(*src.SteamInfo)) : nullptr),
+            GameCenterInfo(src.GameCenterInfo.IsValid() ? TSharedPtr<FUserGameCenterInfo>(MakeShared<FUserGameCenterInfo>(*src.GameCenterInfo)) : nullptr),
+            Profile(src.Profile.IsValid() ? TSharedPtr<FPlayerProfileModel>(MakeShared<FPlayerProfileModel>(*src.Profile)) : nullptr),
+            PSNInfo(src.PSNInfo.IsValid() ? TSharedPtr<FUserPsnInfo>(MakeShared<FUserPsnInfo>(*src.PSNInfo)) : nullptr),
+            SteamInfo(src.SteamInfo.IsValid() ? TSharedPtr<FUserSteamInfo>(MakeShared<FUserSteamInfo>(*src.SteamInfo)) : nullptr),
             Tags(src.Tags),
             TitleDisplayName(src.TitleDisplayName),
             Username(src.Username),
-            XboxInfo(src.XboxInfo.IsValid() ? MakeShareable(new FUserXboxInfo(*src.XboxInfo)) : nullptr)
+            XboxInfo(src.XboxInfo.IsValid() ? TSharedPtr<FUserXboxInfo>(MakeShared<FUserXboxInfo>(*src.XboxInfo)) : nullptr)
+            {}
+
+        FFriendInfo(FFriendInfo&& src) :
+            FPlayFabCppBaseModel(),
+            FacebookInfo(MoveTemp(src.FacebookInfo)),
+            FriendPlayFabId(MoveTemp(src.FriendPlayFabId)),
+            GameCenterInfo(MoveTemp(src.GameCenterInfo)),
+            Profile(MoveTemp(src.Profile)),
+            PSNInfo(MoveTemp(src.PSNInfo)),
+            SteamInfo(MoveTemp(src.SteamInfo)),
+            Tags(MoveTemp(src.Tags)),
+            TitleDisplayName(MoveTemp(src.TitleDisplayName)),
+            Username(MoveTemp(src.Username)),
+            XboxInfo(MoveTemp(src.XboxInfo))
             {}
 
+        FFriendInfo& operator=(const FFriendInfo& src) = default;
+        FFriendInfo& operator=(FFriendInfo&& src) = default;
+
         FFriendInfo(const TSharedPtr<FJsonObject>& obj) : FFriendInfo()
         {
             readFromValue(obj);
@@ -3767,7 +5107,13 @@ namespace ClientModels
         ~FFriendInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGameCenterPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -3790,6 +5136,15 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGameCenterPlayFabIdPair(FGameCenterPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            GameCenterId(MoveTemp(src.GameCenterId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGameCenterPlayFabIdPair& operator=(const FGameCenterPlayFabIdPair& src) = default;
+        FGameCenterPlayFabIdPair& operator=(FGameCenterPlayFabIdPair&& src) = default;
+
         FGameCenterPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FGameCenterPlayFabIdPair()
         {
             readFromValue(obj);
@@ -3798,7 +5153,13 @@ namespace ClientModels
         ~FGameCenterPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGameServerRegionsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3824,6 +5185,15 @@ namespace ClientModels
             TitleId(src.TitleId)
             {}
 
+        FGameServerRegionsRequest(FGameServerRegionsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildVersion(MoveTemp(src.BuildVersion)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FGameServerRegionsRequest& operator=(const FGameServerRegionsRequest& src) = default;
+        FGameServerRegionsRequest& operator=(FGameServerRegionsRequest&& src) = default;
+
         FGameServerRegionsRequest(const TSharedPtr<FJsonObject>& obj) : FGameServerRegionsRequest()
         {
             readFromValue(obj);
@@ -3832,7 +5202,13 @@ namespace ClientModels
         ~FGameServerRegionsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRegionInfo : public PlayFab::FPlayFabCppBaseModel
@@ -3865,6 +5241,17 @@ namespace ClientModels
             pfRegion(src.pfRegion)
             {}
 
+        FRegionInfo(FRegionInfo&& src) :
+            FPlayFabCppBaseModel(),
+            Available(MoveTemp(src.Available)),
+            Name(MoveTemp(src.Name)),
+            PingUrl(MoveTemp(src.PingUrl)),
+            pfRegion(MoveTemp(src.pfRegion))
+            {}
+
+        FRegionInfo& operator=(const FRegionInfo& src) = default;
+        FRegionInfo& operator=(FRegionInfo&& src) = default;
+
         FRegionInfo(const TSharedPtr<FJsonObject>& obj) : FRegionInfo()
         {
             readFromValue(obj);
@@ -3873,7 +5260,13 @@ namespace ClientModels
         ~FRegionInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGameServerRegionsResult : public PlayFab::FPlayFabCppResultCommon
@@ -3890,6 +5283,14 @@ namespace ClientModels
             Regions(src.Regions)
             {}
 
+        FGameServerRegionsResult(FGameServerRegionsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Regions(MoveTemp(src.Regions))
+            {}
+
+        FGameServerRegionsResult& operator=(const FGameServerRegionsResult& src) = default;
+        FGameServerRegionsResult& operator=(FGameServerRegionsResult&& src) = default;
+
         FGameServerRegionsResult(const TSharedPtr<FJsonObject>& obj) : FGameServerRegionsResult()
         {
             readFromValue(obj);
@@ -3898,7 +5299,13 @@ namespace ClientModels
         ~FGameServerRegionsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGenericPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -3917,10 +5324,19 @@ namespace ClientModels
 
         FGenericPlayFabIdPair(const FGenericPlayFabIdPair& src) :
             FPlayFabCppBaseModel(),
-            GenericId(src.GenericId.IsValid() ? MakeShareable(new FGenericServiceId(*src.GenericId)) : nullptr),
+            GenericId(src.GenericId.IsValid() ? TSharedPtr<FGenericServiceId>(MakeShared<FGenericServiceId>(*src.GenericId)) : nullptr),
             PlayFabId(src.PlayFabId)
             {}
 
+        FGenericPlayFabIdPair(FGenericPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            GenericId(MoveTemp(src.GenericId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGenericPlayFabIdPair& operator=(const FGenericPlayFabIdPair& src) = default;
+        FGenericPlayFabIdPair& operator=(FGenericPlayFabIdPair&& src) = default;
+
         FGenericPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FGenericPlayFabIdPair()
         {
             readFromValue(obj);
@@ -3929,7 +5345,13 @@ namespace ClientModels
         ~FGenericPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetAccountInfoRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3968,6 +5390,17 @@ namespace ClientModels
             Username(src.Username)
             {}
 
+        FGetAccountInfoRequest(FGetAccountInfoRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Email(MoveTemp(src.Email)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            TitleDisplayName(MoveTemp(src.TitleDisplayName)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FGetAccountInfoRequest& operator=(const FGetAccountInfoRequest& src) = default;
+        FGetAccountInfoRequest& operator=(FGetAccountInfoRequest&& src) = default;
+
         FGetAccountInfoRequest(const TSharedPtr<FJsonObject>& obj) : FGetAccountInfoRequest()
         {
             readFromValue(obj);
@@ -3976,7 +5409,13 @@ namespace ClientModels
         ~FGetAccountInfoRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserAndroidDeviceInfo : public PlayFab::FPlayFabCppBaseModel
@@ -3994,6 +5433,14 @@ namespace ClientModels
             AndroidDeviceId(src.AndroidDeviceId)
             {}
 
+        FUserAndroidDeviceInfo(FUserAndroidDeviceInfo&& src) :
+            FPlayFabCppBaseModel(),
+            AndroidDeviceId(MoveTemp(src.AndroidDeviceId))
+            {}
+
+        FUserAndroidDeviceInfo& operator=(const FUserAndroidDeviceInfo& src) = default;
+        FUserAndroidDeviceInfo& operator=(FUserAndroidDeviceInfo&& src) = default;
+
         FUserAndroidDeviceInfo(const TSharedPtr<FJsonObject>& obj) : FUserAndroidDeviceInfo()
         {
             readFromValue(obj);
@@ -4002,7 +5449,13 @@ namespace ClientModels
         ~FUserAndroidDeviceInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserAppleIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4020,6 +5473,14 @@ namespace ClientModels
             AppleSubjectId(src.AppleSubjectId)
             {}
 
+        FUserAppleIdInfo(FUserAppleIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            AppleSubjectId(MoveTemp(src.AppleSubjectId))
+            {}
+
+        FUserAppleIdInfo& operator=(const FUserAppleIdInfo& src) = default;
+        FUserAppleIdInfo& operator=(FUserAppleIdInfo&& src) = default;
+
         FUserAppleIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserAppleIdInfo()
         {
             readFromValue(obj);
@@ -4028,7 +5489,13 @@ namespace ClientModels
         ~FUserAppleIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserCustomIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4046,6 +5513,14 @@ namespace ClientModels
             CustomId(src.CustomId)
             {}
 
+        FUserCustomIdInfo(FUserCustomIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            CustomId(MoveTemp(src.CustomId))
+            {}
+
+        FUserCustomIdInfo& operator=(const FUserCustomIdInfo& src) = default;
+        FUserCustomIdInfo& operator=(FUserCustomIdInfo&& src) = default;
+
         FUserCustomIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserCustomIdInfo()
         {
             readFromValue(obj);
@@ -4054,7 +5529,13 @@ namespace ClientModels
         ~FUserCustomIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserFacebookInstantGamesIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4072,6 +5553,14 @@ namespace ClientModels
             FacebookInstantGamesId(src.FacebookInstantGamesId)
             {}
 
+        FUserFacebookInstantGamesIdInfo(FUserFacebookInstantGamesIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            FacebookInstantGamesId(MoveTemp(src.FacebookInstantGamesId))
+            {}
+
+        FUserFacebookInstantGamesIdInfo& operator=(const FUserFacebookInstantGamesIdInfo& src) = default;
+        FUserFacebookInstantGamesIdInfo& operator=(FUserFacebookInstantGamesIdInfo&& src) = default;
+
         FUserFacebookInstantGamesIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserFacebookInstantGamesIdInfo()
         {
             readFromValue(obj);
@@ -4080,7 +5569,13 @@ namespace ClientModels
         ~FUserFacebookInstantGamesIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserGoogleInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4118,6 +5613,18 @@ namespace ClientModels
             GoogleName(src.GoogleName)
             {}
 
+        FUserGoogleInfo(FUserGoogleInfo&& src) :
+            FPlayFabCppBaseModel(),
+            GoogleEmail(MoveTemp(src.GoogleEmail)),
+            GoogleGender(MoveTemp(src.GoogleGender)),
+            GoogleId(MoveTemp(src.GoogleId)),
+            GoogleLocale(MoveTemp(src.GoogleLocale)),
+            GoogleName(MoveTemp(src.GoogleName))
+            {}
+
+        FUserGoogleInfo& operator=(const FUserGoogleInfo& src) = default;
+        FUserGoogleInfo& operator=(FUserGoogleInfo&& src) = default;
+
         FUserGoogleInfo(const TSharedPtr<FJsonObject>& obj) : FUserGoogleInfo()
         {
             readFromValue(obj);
@@ -4126,7 +5633,13 @@ namespace ClientModels
         ~FUserGoogleInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserIosDeviceInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4144,6 +5657,14 @@ namespace ClientModels
             IosDeviceId(src.IosDeviceId)
             {}
 
+        FUserIosDeviceInfo(FUserIosDeviceInfo&& src) :
+            FPlayFabCppBaseModel(),
+            IosDeviceId(MoveTemp(src.IosDeviceId))
+            {}
+
+        FUserIosDeviceInfo& operator=(const FUserIosDeviceInfo& src) = default;
+        FUserIosDeviceInfo& operator=(FUserIosDeviceInfo&& src) = default;
+
         FUserIosDeviceInfo(const TSharedPtr<FJsonObject>& obj) : FUserIosDeviceInfo()
         {
             readFromValue(obj);
@@ -4152,7 +5673,13 @@ namespace ClientModels
         ~FUserIosDeviceInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserKongregateInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4175,6 +5702,15 @@ namespace ClientModels
             KongregateName(src.KongregateName)
             {}
 
+        FUserKongregateInfo(FUserKongregateInfo&& src) :
+            FPlayFabCppBaseModel(),
+            KongregateId(MoveTemp(src.KongregateId)),
+            KongregateName(MoveTemp(src.KongregateName))
+            {}
+
+        FUserKongregateInfo& operator=(const FUserKongregateInfo& src) = default;
+        FUserKongregateInfo& operator=(FUserKongregateInfo&& src) = default;
+
         FUserKongregateInfo(const TSharedPtr<FJsonObject>& obj) : FUserKongregateInfo()
         {
             readFromValue(obj);
@@ -4183,7 +5719,13 @@ namespace ClientModels
         ~FUserKongregateInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserNintendoSwitchAccountIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4201,6 +5743,14 @@ namespace ClientModels
             NintendoSwitchAccountSubjectId(src.NintendoSwitchAccountSubjectId)
             {}
 
+        FUserNintendoSwitchAccountIdInfo(FUserNintendoSwitchAccountIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            NintendoSwitchAccountSubjectId(MoveTemp(src.NintendoSwitchAccountSubjectId))
+            {}
+
+        FUserNintendoSwitchAccountIdInfo& operator=(const FUserNintendoSwitchAccountIdInfo& src) = default;
+        FUserNintendoSwitchAccountIdInfo& operator=(FUserNintendoSwitchAccountIdInfo&& src) = default;
+
         FUserNintendoSwitchAccountIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserNintendoSwitchAccountIdInfo()
         {
             readFromValue(obj);
@@ -4209,7 +5759,13 @@ namespace ClientModels
         ~FUserNintendoSwitchAccountIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserNintendoSwitchDeviceIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4227,6 +5783,14 @@ namespace ClientModels
             NintendoSwitchDeviceId(src.NintendoSwitchDeviceId)
             {}
 
+        FUserNintendoSwitchDeviceIdInfo(FUserNintendoSwitchDeviceIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            NintendoSwitchDeviceId(MoveTemp(src.NintendoSwitchDeviceId))
+            {}
+
+        FUserNintendoSwitchDeviceIdInfo& operator=(const FUserNintendoSwitchDeviceIdInfo& src) = default;
+        FUserNintendoSwitchDeviceIdInfo& operator=(FUserNintendoSwitchDeviceIdInfo&& src) = default;
+
         FUserNintendoSwitchDeviceIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserNintendoSwitchDeviceIdInfo()
         {
             readFromValue(obj);
@@ -4235,7 +5799,13 @@ namespace ClientModels
         ~FUserNintendoSwitchDeviceIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserOpenIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4263,6 +5833,16 @@ namespace ClientModels
             Subject(src.Subject)
             {}
 
+        FUserOpenIdInfo(FUserOpenIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            ConnectionId(MoveTemp(src.ConnectionId)),
+            Issuer(MoveTemp(src.Issuer)),
+            Subject(MoveTemp(src.Subject))
+            {}
+
+        FUserOpenIdInfo& operator=(const FUserOpenIdInfo& src) = default;
+        FUserOpenIdInfo& operator=(FUserOpenIdInfo&& src) = default;
+
         FUserOpenIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserOpenIdInfo()
         {
             readFromValue(obj);
@@ -4271,7 +5851,13 @@ namespace ClientModels
         ~FUserOpenIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserPrivateAccountInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4289,6 +5875,14 @@ namespace ClientModels
             Email(src.Email)
             {}
 
+        FUserPrivateAccountInfo(FUserPrivateAccountInfo&& src) :
+            FPlayFabCppBaseModel(),
+            Email(MoveTemp(src.Email))
+            {}
+
+        FUserPrivateAccountInfo& operator=(const FUserPrivateAccountInfo& src) = default;
+        FUserPrivateAccountInfo& operator=(FUserPrivateAccountInfo&& src) = default;
+
         FUserPrivateAccountInfo(const TSharedPtr<FJsonObject>& obj) : FUserPrivateAccountInfo()
         {
             readFromValue(obj);
@@ -4297,7 +5891,13 @@ namespace ClientModels
         ~FUserPrivateAccountInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum UserOrigination
@@ -4329,6 +5929,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeUserOriginationEnumJSON(UserOrigination enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeUserOriginationEnumJSON(UserOrigination enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API UserOrigination readUserOriginationFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API UserOrigination readUserOriginationFromValue(const FString& value);
 
@@ -4385,9 +5986,24 @@ namespace ClientModels
             isBanned(src.isBanned),
             LastLogin(src.LastLogin),
             Origination(src.Origination),
-            TitlePlayerAccount(src.TitlePlayerAccount.IsValid() ? MakeShareable(new FEntityKey(*src.TitlePlayerAccount)) : nullptr)
+            TitlePlayerAccount(src.TitlePlayerAccount.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.TitlePlayerAccount)) : nullptr)
+            {}
+
+        FUserTitleInfo(FUserTitleInfo&& src) :
+            FPlayFabCppBaseModel(),
+            AvatarUrl(MoveTemp(src.AvatarUrl)),
+            Created(MoveTemp(src.Created)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            FirstLogin(MoveTemp(src.FirstLogin)),
+            isBanned(MoveTemp(src.isBanned)),
+            LastLogin(MoveTemp(src.LastLogin)),
+            Origination(MoveTemp(src.Origination)),
+            TitlePlayerAccount(MoveTemp(src.TitlePlayerAccount))
             {}
 
+        FUserTitleInfo& operator=(const FUserTitleInfo& src) = default;
+        FUserTitleInfo& operator=(FUserTitleInfo&& src) = default;
+
         FUserTitleInfo(const TSharedPtr<FJsonObject>& obj) : FUserTitleInfo()
         {
             readFromValue(obj);
@@ -4396,7 +6012,13 @@ namespace ClientModels
         ~FUserTitleInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserTwitchInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4419,6 +6041,15 @@ namespace ClientModels
             TwitchUserName(src.TwitchUserName)
             {}
 
+        FUserTwitchInfo(FUserTwitchInfo&& src) :
+            FPlayFabCppBaseModel(),
+            TwitchId(MoveTemp(src.TwitchId)),
+            TwitchUserName(MoveTemp(src.TwitchUserName))
+            {}
+
+        FUserTwitchInfo& operator=(const FUserTwitchInfo& src) = default;
+        FUserTwitchInfo& operator=(FUserTwitchInfo&& src) = default;
+
         FUserTwitchInfo(const TSharedPtr<FJsonObject>& obj) : FUserTwitchInfo()
         {
             readFromValue(obj);
@@ -4427,7 +6058,13 @@ namespace ClientModels
         ~FUserTwitchInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserWindowsHelloInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4450,6 +6087,15 @@ namespace ClientModels
             WindowsHelloPublicKeyHash(src.WindowsHelloPublicKeyHash)
             {}
 
+        FUserWindowsHelloInfo(FUserWindowsHelloInfo&& src) :
+            FPlayFabCppBaseModel(),
+            WindowsHelloDeviceName(MoveTemp(src.WindowsHelloDeviceName)),
+            WindowsHelloPublicKeyHash(MoveTemp(src.WindowsHelloPublicKeyHash))
+            {}
+
+        FUserWindowsHelloInfo& operator=(const FUserWindowsHelloInfo& src) = default;
+        FUserWindowsHelloInfo& operator=(FUserWindowsHelloInfo&& src) = default;
+
         FUserWindowsHelloInfo(const TSharedPtr<FJsonObject>& obj) : FUserWindowsHelloInfo()
         {
             readFromValue(obj);
@@ -4458,7 +6104,13 @@ namespace ClientModels
         ~FUserWindowsHelloInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserAccountInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4556,30 +6208,59 @@ namespace ClientModels
 
         FUserAccountInfo(const FUserAccountInfo& src) :
             FPlayFabCppBaseModel(),
-            AndroidDeviceInfo(src.AndroidDeviceInfo.IsValid() ? MakeShareable(new FUserAndroidDeviceInfo(*src.AndroidDeviceInfo)) : nullptr),
-            AppleAccountInfo(src.AppleAccountInfo.IsValid() ? MakeShareable(new FUserAppleIdInfo(*src.AppleAccountInfo)) : nullptr),
+            AndroidDeviceInfo(src.AndroidDeviceInfo.IsValid() ? TSharedPtr<FUserAndroidDeviceInfo>(MakeShared<FUserAndroidDeviceInfo>(*src.AndroidDeviceInfo)) : nullptr),
+            AppleAccountInfo(src.AppleAccountInfo.IsValid() ? TSharedPtr<FUserAppleIdInfo>(MakeShared<FUserAppleIdInfo>(*src.AppleAccountInfo)) : nullptr),
             Created(src.Created),
-            CustomIdInfo(src.CustomIdInfo.IsValid() ? MakeShareable(new FUserCustomIdInfo(*src.CustomIdInfo)) : nullptr),
-            FacebookInfo(src.FacebookInfo.IsValid() ? MakeShareable(new FUserFacebookInfo(*src.FacebookInfo)) : nullptr),
-            FacebookInstantGamesIdInfo(src.FacebookInstantGamesIdInfo.IsValid() ? MakeShareable(new FUserFacebookInstantGamesIdInfo(*src.FacebookInstantGamesIdInfo)) : nullptr),
-            GameCenterInfo(src.GameCenterInfo.IsValid() ? MakeShareable(new FUserGameCenterInfo(*src.GameCenterInfo)) : nullptr),
-            GoogleInfo(src.GoogleInfo.IsValid() ? MakeShareable(new FUserGoogleInfo(*src.GoogleInfo)) : nullptr),
-            IosDeviceInfo(src.IosDeviceInfo.IsValid() ? MakeShareable(new FUserIosDeviceInfo(*src.IosDeviceInfo)) : nullptr),
-            KongregateInfo(src.KongregateInfo.IsValid() ? MakeShareable(new FUserKongregateInfo(*src.KongregateInfo)) : nullptr),
-            NintendoSwitchAccountInfo(src.NintendoSwitchAccountInfo.IsValid() ? MakeShareable(new FUserNintendoSwitchAccountIdInfo(*src.NintendoSwitchAccountInfo)) : nullptr),
-            NintendoSwitchDeviceIdInfo(src.NintendoSwitchDeviceIdInfo.IsValid() ? MakeShareable(new FUserNintendoSwitchDeviceIdInfo(*src.NintendoSwitchDeviceIdInfo)) : nullptr),
+            CustomIdInfo(src.CustomIdInfo.IsValid() ? TSharedPtr<FUserCustomIdInfo>(MakeShared<FUserCustomIdInfo>(*src.CustomIdInfo)) : nullptr),
+            FacebookInfo(src.FacebookInfo.IsValid() ? TSharedPtr<FUserFacebookInfo>(MakeShared<FUserFacebookInfo>(*src.FacebookInfo)) : nullptr),
+            FacebookInstantGamesIdInfo(src.FacebookInstantGamesIdInfo.IsValid() ? TSharedPtr<FUserFacebookInstantGamesIdInfo>(MakeShared<FUserFacebookInstantGamesIdInfo>(*src.FacebookInstantGamesIdInfo)) : nullptr),
+            GameCenterInfo(src.GameCenterInfo.IsValid() ? TSharedPtr<FUserGameCenterInfo>(MakeShared<FUserGameCenterInfo>(*src.GameCenterInfo)) : nullptr),
+            GoogleInfo(src.GoogleInfo.IsValid() ? TSharedPtr<FUserGoogleInfo>(MakeShared<FUserGoogleInfo>(*src.GoogleInfo)) : nullptr),
+            IosDeviceInfo(src.IosDeviceInfo.IsValid() ? TSharedPtr<FUserIosDeviceInfo>(MakeShared<FUserIosDeviceInfo>(*src.IosDeviceInfo)) : nullptr),
+            KongregateInfo(src.KongregateInfo.IsValid() ? TSharedPtr<FUserKongregateInfo>(MakeShared<FUserKongregateInfo>(*src.KongregateInfo)) : nullptr),
+            NintendoSwitchAccountInfo(src.NintendoSwitchAccountInfo.IsValid() ? TSharedPtr<FUserNintendoSwitchAccountIdInfo>(MakeShared<FUserNintendoSwitchAccountIdInfo>(*src.NintendoSwitchAccountInfo)) : nullptr),
+            NintendoSwitchDeviceIdInfo(src.NintendoSwitchDeviceIdInfo.IsValid() ? TSharedPtr<FUserNintendoSwitchDeviceIdInfo>(MakeShared<FUserNintendoSwitchDeviceIdInfo>(*src.NintendoSwitchDeviceIdInfo)) : nullptr),
             OpenIdInfo(src.OpenIdInfo),
             PlayFabId(src.PlayFabId),
-            PrivateInfo(src.PrivateInfo.IsValid() ? MakeShareable(new FUserPrivateAccountInfo(*src.PrivateInfo)) : nullptr),
-            PsnInfo(src.PsnInfo.IsValid() ? MakeShareable(new FUserPsnInfo(*src.PsnInfo)) : nullptr),
-            SteamInfo(src.SteamInfo.IsValid() ? MakeShareable(new FUserSteamInfo(*src.SteamInfo)) : nullptr),
-            TitleInfo(src.TitleInfo.IsValid() ? MakeShareable(new FUserTitleInfo(*src.TitleInfo)) : nullptr),
-            TwitchInfo(src.TwitchInfo.IsValid() ? MakeShareable(new FUserTwitchInfo(*src.TwitchInfo)) : nullptr),
+            PrivateInfo(src.PrivateInfo.IsValid() ? TSharedPtr<FUserPrivateAccountInfo>(MakeShared<FUserPrivateAccountInfo>(*src.PrivateInfo)) : nullptr),
+            PsnInfo(src.PsnInfo.IsValid() ? TSharedPtr<FUserPsnInfo>(MakeShared<FUserPsnInfo>(*src.PsnInfo)) : nullptr),
+            SteamInfo(src.SteamInfo.IsValid() ? TSharedPtr<FUserSteamInfo>(MakeShared<FUserSteamInfo>(*src.SteamInfo)) : nullptr),
+            TitleInfo(src.TitleInfo.IsValid() ? TSharedPtr<FUserTitleInfo>(MakeShared<FUserTitleInfo>(*src.TitleInfo)) : nullptr),
+            TwitchInfo(src.TwitchInfo.IsValid() ? TSharedPtr<FUserTwitchInfo>(MakeShared<FUserTwitchInfo>(*src.TwitchInfo)) : nullptr),
             Username(src.Username),
-            WindowsHelloInfo(src.WindowsHelloInfo.IsValid() ? MakeShareable(new FUserWindowsHelloInfo(*src.WindowsHelloInfo)) : nullptr),
-            XboxInfo(src.XboxInfo.IsValid() ? MakeShareable(new FUserXboxInfo(*src.XboxInfo)) : nullptr)
+            WindowsHelloInfo(src.WindowsHelloInfo.IsValid() ? TSharedPtr<FUserWindowsHelloInfo>(MakeShared<FUserWindowsHelloInfo>(*src.WindowsHelloInfo)) : nullptr),
+            XboxInfo(src.XboxInfo.IsValid() ? TSharedPtr<FUserXboxInfo>(MakeShared<FUserXboxInfo>(*src.XboxInfo)) : nullptr)
             {}
 
+        FUserAccountInfo(FUserAccountInfo&& src) :
+            FPlayFabCppBaseModel(),
+            AndroidDeviceInfo(MoveTemp(src.AndroidDeviceInfo)),
+            AppleAccountInfo(MoveTemp(src.AppleAccountInfo)),
+            Created(MoveTemp(src.Created)),
+            CustomIdInfo(MoveTemp(src.CustomIdInfo)),
+            FacebookInfo(MoveTemp(src.FacebookInfo)),
+            FacebookInstantGamesIdInfo(MoveTemp(src.FacebookInstantGamesIdInfo)),
+            GameCenterInfo(MoveTemp(src.GameCenterInfo)),
+            GoogleInfo(MoveTemp(src.GoogleInfo)),
+            IosDeviceInfo(MoveTemp(src.IosDeviceInfo)),
+            KongregateInfo(MoveTemp(src.KongregateInfo)),
+            NintendoSwitchAccountInfo(MoveTemp(src.NintendoSwitchAccountInfo)),
+            NintendoSwitchDeviceIdInfo(MoveTemp(src.NintendoSwitchDeviceIdInfo)),
+            OpenIdInfo(MoveTemp(src.OpenIdInfo)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            PrivateInfo(MoveTemp(src.PrivateInfo)),
+            PsnInfo(MoveTemp(src.PsnInfo)),
+            SteamInfo(MoveTemp(src.SteamInfo)),
+            TitleInfo(MoveTemp(src.TitleInfo)),
+            TwitchInfo(MoveTemp(src.TwitchInfo)),
+            Username(MoveTemp(src.Username)),
+            WindowsHelloInfo(MoveTemp(src.WindowsHelloInfo)),
+            XboxInfo(MoveTemp(src.XboxInfo))
+            {}
+
+        FUserAccountInfo& operator=(const FUserAccountInfo& src) = default;
+        FUserAccountInfo& operator=(FUserAccountInfo&& src) = default;
+
         FUserAccountInfo(const TSharedPtr<FJsonObject>& obj) : FUserAccountInfo()
         {
             readFromValue(obj);
@@ -4588,7 +6269,13 @@ namespace ClientModels
         ~FUserAccountInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetAccountInfoResult : public PlayFab::FPlayFabCppResultCommon
@@ -4603,9 +6290,17 @@ namespace ClientModels
 
         FGetAccountInfoResult(const FGetAccountInfoResult& src) :
             FPlayFabCppResultCommon(),
-            AccountInfo(src.AccountInfo.IsValid() ? MakeShareable(new FUserAccountInfo(*src.AccountInfo)) : nullptr)
+            AccountInfo(src.AccountInfo.IsValid() ? TSharedPtr<FUserAccountInfo>(MakeShared<FUserAccountInfo>(*src.AccountInfo)) : nullptr)
+            {}
+
+        FGetAccountInfoResult(FGetAccountInfoResult&& src) :
+            FPlayFabCppResultCommon(),
+            AccountInfo(MoveTemp(src.AccountInfo))
             {}
 
+        FGetAccountInfoResult& operator=(const FGetAccountInfoResult& src) = default;
+        FGetAccountInfoResult& operator=(FGetAccountInfoResult&& src) = default;
+
         FGetAccountInfoResult(const TSharedPtr<FJsonObject>& obj) : FGetAccountInfoResult()
         {
             readFromValue(obj);
@@ -4614,7 +6309,13 @@ namespace ClientModels
         ~FGetAccountInfoResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FNameIdentifier : public PlayFab::FPlayFabCppBaseModel
@@ -4637,6 +6338,15 @@ namespace ClientModels
             Name(src.Name)
             {}
 
+        FNameIdentifier(FNameIdentifier&& src) :
+            FPlayFabCppBaseModel(),
+            Id(MoveTemp(src.Id)),
+            Name(MoveTemp(src.Name))
+            {}
+
+        FNameIdentifier& operator=(const FNameIdentifier& src) = default;
+        FNameIdentifier& operator=(FNameIdentifier&& src) = default;
+
         FNameIdentifier(const TSharedPtr<FJsonObject>& obj) : FNameIdentifier()
         {
             readFromValue(obj);
@@ -4645,7 +6355,13 @@ namespace ClientModels
         ~FNameIdentifier();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetAdPlacementsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4665,9 +6381,18 @@ namespace ClientModels
         FGetAdPlacementsRequest(const FGetAdPlacementsRequest& src) :
             FPlayFabCppRequestCommon(),
             AppId(src.AppId),
-            Identifier(src.Identifier.IsValid() ? MakeShareable(new FNameIdentifier(*src.Identifier)) : nullptr)
+            Identifier(src.Identifier.IsValid() ? TSharedPtr<FNameIdentifier>(MakeShared<FNameIdentifier>(*src.Identifier)) : nullptr)
+            {}
+
+        FGetAdPlacementsRequest(FGetAdPlacementsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AppId(MoveTemp(src.AppId)),
+            Identifier(MoveTemp(src.Identifier))
             {}
 
+        FGetAdPlacementsRequest& operator=(const FGetAdPlacementsRequest& src) = default;
+        FGetAdPlacementsRequest& operator=(FGetAdPlacementsRequest&& src) = default;
+
         FGetAdPlacementsRequest(const TSharedPtr<FJsonObject>& obj) : FGetAdPlacementsRequest()
         {
             readFromValue(obj);
@@ -4676,7 +6401,13 @@ namespace ClientModels
         ~FGetAdPlacementsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetAdPlacementsResult : public PlayFab::FPlayFabCppResultCommon
@@ -4693,6 +6424,14 @@ namespace ClientModels
             AdPlacements(src.AdPlacements)
             {}
 
+        FGetAdPlacementsResult(FGetAdPlacementsResult&& src) :
+            FPlayFabCppResultCommon(),
+            AdPlacements(MoveTemp(src.AdPlacements))
+            {}
+
+        FGetAdPlacementsResult& operator=(const FGetAdPlacementsResult& src) = default;
+        FGetAdPlacementsResult& operator=(FGetAdPlacementsResult&& src) = default;
+
         FGetAdPlacementsResult(const TSharedPtr<FJsonObject>& obj) : FGetAdPlacementsResult()
         {
             readFromValue(obj);
@@ -4701,7 +6440,13 @@ namespace ClientModels
         ~FGetAdPlacementsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCatalogItemsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4719,7 +6464,15 @@ namespace ClientModels
             CatalogVersion(src.CatalogVersion)
             {}
 
-        FGetCatalogItemsRequest(const TSharedPtr<FJsonObject>& obj) : FGetCatalogItemsRequest()
+        FGetCatalogItemsRequest(FGetCatalogItemsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion))
+            {}
+
+        FGetCatalogItemsRequest& operator=(const FGetCatalogItemsRequest& src) = default;
+        FGetCatalogItemsRequest& operator=(FGetCatalogItemsRequest&& src) = default;
+
+        FGetCatalogItemsRequest(const TSharedPtr<FJsonObject>& obj) : FGetCatalogItemsRequest()
         {
             readFromValue(obj);
         }
@@ -4727,7 +6480,13 @@ namespace ClientModels
         ~FGetCatalogItemsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCatalogItemsResult : public PlayFab::FPlayFabCppResultCommon
@@ -4744,6 +6503,14 @@ namespace ClientModels
             Catalog(src.Catalog)
             {}
 
+        FGetCatalogItemsResult(FGetCatalogItemsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Catalog(MoveTemp(src.Catalog))
+            {}
+
+        FGetCatalogItemsResult& operator=(const FGetCatalogItemsResult& src) = default;
+        FGetCatalogItemsResult& operator=(FGetCatalogItemsResult&& src) = default;
+
         FGetCatalogItemsResult(const TSharedPtr<FJsonObject>& obj) : FGetCatalogItemsResult()
         {
             readFromValue(obj);
@@ -4752,7 +6519,13 @@ namespace ClientModels
         ~FGetCatalogItemsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4787,6 +6560,17 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetCharacterDataRequest(FGetCharacterDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            IfChangedFromDataVersion(MoveTemp(src.IfChangedFromDataVersion)),
+            Keys(MoveTemp(src.Keys)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetCharacterDataRequest& operator=(const FGetCharacterDataRequest& src) = default;
+        FGetCharacterDataRequest& operator=(FGetCharacterDataRequest&& src) = default;
+
         FGetCharacterDataRequest(const TSharedPtr<FJsonObject>& obj) : FGetCharacterDataRequest()
         {
             readFromValue(obj);
@@ -4795,7 +6579,13 @@ namespace ClientModels
         ~FGetCharacterDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum UserDataPermission
@@ -4805,6 +6595,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeUserDataPermissionEnumJSON(UserDataPermission enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeUserDataPermissionEnumJSON(UserDataPermission enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API UserDataPermission readUserDataPermissionFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API UserDataPermission readUserDataPermissionFromValue(const FString& value);
 
@@ -4836,6 +6627,16 @@ namespace ClientModels
             Value(src.Value)
             {}
 
+        FUserDataRecord(FUserDataRecord&& src) :
+            FPlayFabCppBaseModel(),
+            LastUpdated(MoveTemp(src.LastUpdated)),
+            Permission(MoveTemp(src.Permission)),
+            Value(MoveTemp(src.Value))
+            {}
+
+        FUserDataRecord& operator=(const FUserDataRecord& src) = default;
+        FUserDataRecord& operator=(FUserDataRecord&& src) = default;
+
         FUserDataRecord(const TSharedPtr<FJsonObject>& obj) : FUserDataRecord()
         {
             readFromValue(obj);
@@ -4844,7 +6645,13 @@ namespace ClientModels
         ~FUserDataRecord();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -4874,6 +6681,16 @@ namespace ClientModels
             DataVersion(src.DataVersion)
             {}
 
+        FGetCharacterDataResult(FGetCharacterDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            Data(MoveTemp(src.Data)),
+            DataVersion(MoveTemp(src.DataVersion))
+            {}
+
+        FGetCharacterDataResult& operator=(const FGetCharacterDataResult& src) = default;
+        FGetCharacterDataResult& operator=(FGetCharacterDataResult&& src) = default;
+
         FGetCharacterDataResult(const TSharedPtr<FJsonObject>& obj) : FGetCharacterDataResult()
         {
             readFromValue(obj);
@@ -4882,7 +6699,13 @@ namespace ClientModels
         ~FGetCharacterDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterInventoryRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4909,6 +6732,16 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FGetCharacterInventoryRequest(FGetCharacterInventoryRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FGetCharacterInventoryRequest& operator=(const FGetCharacterInventoryRequest& src) = default;
+        FGetCharacterInventoryRequest& operator=(FGetCharacterInventoryRequest&& src) = default;
+
         FGetCharacterInventoryRequest(const TSharedPtr<FJsonObject>& obj) : FGetCharacterInventoryRequest()
         {
             readFromValue(obj);
@@ -4917,7 +6750,13 @@ namespace ClientModels
         ~FGetCharacterInventoryRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FVirtualCurrencyRechargeTime : public PlayFab::FPlayFabCppBaseModel
@@ -4949,6 +6788,16 @@ namespace ClientModels
             SecondsToRecharge(src.SecondsToRecharge)
             {}
 
+        FVirtualCurrencyRechargeTime(FVirtualCurrencyRechargeTime&& src) :
+            FPlayFabCppBaseModel(),
+            RechargeMax(MoveTemp(src.RechargeMax)),
+            RechargeTime(MoveTemp(src.RechargeTime)),
+            SecondsToRecharge(MoveTemp(src.SecondsToRecharge))
+            {}
+
+        FVirtualCurrencyRechargeTime& operator=(const FVirtualCurrencyRechargeTime& src) = default;
+        FVirtualCurrencyRechargeTime& operator=(FVirtualCurrencyRechargeTime&& src) = default;
+
         FVirtualCurrencyRechargeTime(const TSharedPtr<FJsonObject>& obj) : FVirtualCurrencyRechargeTime()
         {
             readFromValue(obj);
@@ -4957,7 +6806,13 @@ namespace ClientModels
         ~FVirtualCurrencyRechargeTime();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterInventoryResult : public PlayFab::FPlayFabCppResultCommon
@@ -4987,6 +6842,17 @@ namespace ClientModels
             VirtualCurrencyRechargeTimes(src.VirtualCurrencyRechargeTimes)
             {}
 
+        FGetCharacterInventoryResult(FGetCharacterInventoryResult&& src) :
+            FPlayFabCppResultCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            Inventory(MoveTemp(src.Inventory)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency)),
+            VirtualCurrencyRechargeTimes(MoveTemp(src.VirtualCurrencyRechargeTimes))
+            {}
+
+        FGetCharacterInventoryResult& operator=(const FGetCharacterInventoryResult& src) = default;
+        FGetCharacterInventoryResult& operator=(FGetCharacterInventoryResult&& src) = default;
+
         FGetCharacterInventoryResult(const TSharedPtr<FJsonObject>& obj) : FGetCharacterInventoryResult()
         {
             readFromValue(obj);
@@ -4995,7 +6861,13 @@ namespace ClientModels
         ~FGetCharacterInventoryResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterLeaderboardRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5028,6 +6900,17 @@ namespace ClientModels
             StatisticName(src.StatisticName)
             {}
 
+        FGetCharacterLeaderboardRequest(FGetCharacterLeaderboardRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterType(MoveTemp(src.CharacterType)),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            StartPosition(MoveTemp(src.StartPosition)),
+            StatisticName(MoveTemp(src.StatisticName))
+            {}
+
+        FGetCharacterLeaderboardRequest& operator=(const FGetCharacterLeaderboardRequest& src) = default;
+        FGetCharacterLeaderboardRequest& operator=(FGetCharacterLeaderboardRequest&& src) = default;
+
         FGetCharacterLeaderboardRequest(const TSharedPtr<FJsonObject>& obj) : FGetCharacterLeaderboardRequest()
         {
             readFromValue(obj);
@@ -5036,7 +6919,13 @@ namespace ClientModels
         ~FGetCharacterLeaderboardRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterLeaderboardResult : public PlayFab::FPlayFabCppResultCommon
@@ -5053,6 +6942,14 @@ namespace ClientModels
             Leaderboard(src.Leaderboard)
             {}
 
+        FGetCharacterLeaderboardResult(FGetCharacterLeaderboardResult&& src) :
+            FPlayFabCppResultCommon(),
+            Leaderboard(MoveTemp(src.Leaderboard))
+            {}
+
+        FGetCharacterLeaderboardResult& operator=(const FGetCharacterLeaderboardResult& src) = default;
+        FGetCharacterLeaderboardResult& operator=(FGetCharacterLeaderboardResult&& src) = default;
+
         FGetCharacterLeaderboardResult(const TSharedPtr<FJsonObject>& obj) : FGetCharacterLeaderboardResult()
         {
             readFromValue(obj);
@@ -5061,7 +6958,13 @@ namespace ClientModels
         ~FGetCharacterLeaderboardResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5079,6 +6982,14 @@ namespace ClientModels
             CharacterId(src.CharacterId)
             {}
 
+        FGetCharacterStatisticsRequest(FGetCharacterStatisticsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId))
+            {}
+
+        FGetCharacterStatisticsRequest& operator=(const FGetCharacterStatisticsRequest& src) = default;
+        FGetCharacterStatisticsRequest& operator=(FGetCharacterStatisticsRequest&& src) = default;
+
         FGetCharacterStatisticsRequest(const TSharedPtr<FJsonObject>& obj) : FGetCharacterStatisticsRequest()
         {
             readFromValue(obj);
@@ -5087,7 +6998,13 @@ namespace ClientModels
         ~FGetCharacterStatisticsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterStatisticsResult : public PlayFab::FPlayFabCppResultCommon
@@ -5104,6 +7021,14 @@ namespace ClientModels
             CharacterStatistics(src.CharacterStatistics)
             {}
 
+        FGetCharacterStatisticsResult(FGetCharacterStatisticsResult&& src) :
+            FPlayFabCppResultCommon(),
+            CharacterStatistics(MoveTemp(src.CharacterStatistics))
+            {}
+
+        FGetCharacterStatisticsResult& operator=(const FGetCharacterStatisticsResult& src) = default;
+        FGetCharacterStatisticsResult& operator=(FGetCharacterStatisticsResult&& src) = default;
+
         FGetCharacterStatisticsResult(const TSharedPtr<FJsonObject>& obj) : FGetCharacterStatisticsResult()
         {
             readFromValue(obj);
@@ -5112,7 +7037,13 @@ namespace ClientModels
         ~FGetCharacterStatisticsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetContentDownloadUrlRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5143,6 +7074,16 @@ namespace ClientModels
             ThruCDN(src.ThruCDN)
             {}
 
+        FGetContentDownloadUrlRequest(FGetContentDownloadUrlRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            HttpMethod(MoveTemp(src.HttpMethod)),
+            Key(MoveTemp(src.Key)),
+            ThruCDN(MoveTemp(src.ThruCDN))
+            {}
+
+        FGetContentDownloadUrlRequest& operator=(const FGetContentDownloadUrlRequest& src) = default;
+        FGetContentDownloadUrlRequest& operator=(FGetContentDownloadUrlRequest&& src) = default;
+
         FGetContentDownloadUrlRequest(const TSharedPtr<FJsonObject>& obj) : FGetContentDownloadUrlRequest()
         {
             readFromValue(obj);
@@ -5151,7 +7092,13 @@ namespace ClientModels
         ~FGetContentDownloadUrlRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetContentDownloadUrlResult : public PlayFab::FPlayFabCppResultCommon
@@ -5169,6 +7116,14 @@ namespace ClientModels
             URL(src.URL)
             {}
 
+        FGetContentDownloadUrlResult(FGetContentDownloadUrlResult&& src) :
+            FPlayFabCppResultCommon(),
+            URL(MoveTemp(src.URL))
+            {}
+
+        FGetContentDownloadUrlResult& operator=(const FGetContentDownloadUrlResult& src) = default;
+        FGetContentDownloadUrlResult& operator=(FGetContentDownloadUrlResult&& src) = default;
+
         FGetContentDownloadUrlResult(const TSharedPtr<FJsonObject>& obj) : FGetContentDownloadUrlResult()
         {
             readFromValue(obj);
@@ -5177,7 +7132,13 @@ namespace ClientModels
         ~FGetContentDownloadUrlResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerProfileViewConstraints : public PlayFab::FPlayFabCppBaseModel
@@ -5275,6 +7236,30 @@ namespace ClientModels
             ShowValuesToDate(src.ShowValuesToDate)
             {}
 
+        FPlayerProfileViewConstraints(FPlayerProfileViewConstraints&& src) :
+            FPlayFabCppBaseModel(),
+            ShowAvatarUrl(MoveTemp(src.ShowAvatarUrl)),
+            ShowBannedUntil(MoveTemp(src.ShowBannedUntil)),
+            ShowCampaignAttributions(MoveTemp(src.ShowCampaignAttributions)),
+            ShowContactEmailAddresses(MoveTemp(src.ShowContactEmailAddresses)),
+            ShowCreated(MoveTemp(src.ShowCreated)),
+            ShowDisplayName(MoveTemp(src.ShowDisplayName)),
+            ShowExperimentVariants(MoveTemp(src.ShowExperimentVariants)),
+            ShowLastLogin(MoveTemp(src.ShowLastLogin)),
+            ShowLinkedAccounts(MoveTemp(src.ShowLinkedAccounts)),
+            ShowLocations(MoveTemp(src.ShowLocations)),
+            ShowMemberships(MoveTemp(src.ShowMemberships)),
+            ShowOrigination(MoveTemp(src.ShowOrigination)),
+            ShowPushNotificationRegistrations(MoveTemp(src.ShowPushNotificationRegistrations)),
+            ShowStatistics(MoveTemp(src.ShowStatistics)),
+            ShowTags(MoveTemp(src.ShowTags)),
+            ShowTotalValueToDateInUsd(MoveTemp(src.ShowTotalValueToDateInUsd)),
+            ShowValuesToDate(MoveTemp(src.ShowValuesToDate))
+            {}
+
+        FPlayerProfileViewConstraints& operator=(const FPlayerProfileViewConstraints& src) = default;
+        FPlayerProfileViewConstraints& operator=(FPlayerProfileViewConstraints&& src) = default;
+
         FPlayerProfileViewConstraints(const TSharedPtr<FJsonObject>& obj) : FPlayerProfileViewConstraints()
         {
             readFromValue(obj);
@@ -5283,7 +7268,13 @@ namespace ClientModels
         ~FPlayerProfileViewConstraints();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetFriendLeaderboardAroundPlayerRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5342,13 +7333,30 @@ namespace ClientModels
             IncludeSteamFriends(src.IncludeSteamFriends),
             MaxResultsCount(src.MaxResultsCount),
             PlayFabId(src.PlayFabId),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr),
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr),
             StatisticName(src.StatisticName),
             UseSpecificVersion(src.UseSpecificVersion),
             Version(src.Version),
             XboxToken(src.XboxToken)
             {}
 
+        FGetFriendLeaderboardAroundPlayerRequest(FGetFriendLeaderboardAroundPlayerRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            IncludeFacebookFriends(MoveTemp(src.IncludeFacebookFriends)),
+            IncludeSteamFriends(MoveTemp(src.IncludeSteamFriends)),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            UseSpecificVersion(MoveTemp(src.UseSpecificVersion)),
+            Version(MoveTemp(src.Version)),
+            XboxToken(MoveTemp(src.XboxToken))
+            {}
+
+        FGetFriendLeaderboardAroundPlayerRequest& operator=(const FGetFriendLeaderboardAroundPlayerRequest& src) = default;
+        FGetFriendLeaderboardAroundPlayerRequest& operator=(FGetFriendLeaderboardAroundPlayerRequest&& src) = default;
+
         FGetFriendLeaderboardAroundPlayerRequest(const TSharedPtr<FJsonObject>& obj) : FGetFriendLeaderboardAroundPlayerRequest()
         {
             readFromValue(obj);
@@ -5357,7 +7365,13 @@ namespace ClientModels
         ~FGetFriendLeaderboardAroundPlayerRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerLeaderboardEntry : public PlayFab::FPlayFabCppBaseModel
@@ -5391,10 +7405,22 @@ namespace ClientModels
             DisplayName(src.DisplayName),
             PlayFabId(src.PlayFabId),
             Position(src.Position),
-            Profile(src.Profile.IsValid() ? MakeShareable(new FPlayerProfileModel(*src.Profile)) : nullptr),
+            Profile(src.Profile.IsValid() ? TSharedPtr<FPlayerProfileModel>(MakeShared<FPlayerProfileModel>(*src.Profile)) : nullptr),
             StatValue(src.StatValue)
             {}
 
+        FPlayerLeaderboardEntry(FPlayerLeaderboardEntry&& src) :
+            FPlayFabCppBaseModel(),
+            DisplayName(MoveTemp(src.DisplayName)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Position(MoveTemp(src.Position)),
+            Profile(MoveTemp(src.Profile)),
+            StatValue(MoveTemp(src.StatValue))
+            {}
+
+        FPlayerLeaderboardEntry& operator=(const FPlayerLeaderboardEntry& src) = default;
+        FPlayerLeaderboardEntry& operator=(FPlayerLeaderboardEntry&& src) = default;
+
         FPlayerLeaderboardEntry(const TSharedPtr<FJsonObject>& obj) : FPlayerLeaderboardEntry()
         {
             readFromValue(obj);
@@ -5403,7 +7429,13 @@ namespace ClientModels
         ~FPlayerLeaderboardEntry();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetFriendLeaderboardAroundPlayerResult : public PlayFab::FPlayFabCppResultCommon
@@ -5430,6 +7462,16 @@ namespace ClientModels
             Version(src.Version)
             {}
 
+        FGetFriendLeaderboardAroundPlayerResult(FGetFriendLeaderboardAroundPlayerResult&& src) :
+            FPlayFabCppResultCommon(),
+            Leaderboard(MoveTemp(src.Leaderboard)),
+            NextReset(MoveTemp(src.NextReset)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FGetFriendLeaderboardAroundPlayerResult& operator=(const FGetFriendLeaderboardAroundPlayerResult& src) = default;
+        FGetFriendLeaderboardAroundPlayerResult& operator=(FGetFriendLeaderboardAroundPlayerResult&& src) = default;
+
         FGetFriendLeaderboardAroundPlayerResult(const TSharedPtr<FJsonObject>& obj) : FGetFriendLeaderboardAroundPlayerResult()
         {
             readFromValue(obj);
@@ -5438,7 +7480,13 @@ namespace ClientModels
         ~FGetFriendLeaderboardAroundPlayerResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetFriendLeaderboardRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5496,7 +7544,7 @@ namespace ClientModels
             IncludeFacebookFriends(src.IncludeFacebookFriends),
             IncludeSteamFriends(src.IncludeSteamFriends),
             MaxResultsCount(src.MaxResultsCount),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr),
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr),
             StartPosition(src.StartPosition),
             StatisticName(src.StatisticName),
             UseSpecificVersion(src.UseSpecificVersion),
@@ -5504,6 +7552,23 @@ namespace ClientModels
             XboxToken(src.XboxToken)
             {}
 
+        FGetFriendLeaderboardRequest(FGetFriendLeaderboardRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            IncludeFacebookFriends(MoveTemp(src.IncludeFacebookFriends)),
+            IncludeSteamFriends(MoveTemp(src.IncludeSteamFriends)),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints)),
+            StartPosition(MoveTemp(src.StartPosition)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            UseSpecificVersion(MoveTemp(src.UseSpecificVersion)),
+            Version(MoveTemp(src.Version)),
+            XboxToken(MoveTemp(src.XboxToken))
+            {}
+
+        FGetFriendLeaderboardRequest& operator=(const FGetFriendLeaderboardRequest& src) = default;
+        FGetFriendLeaderboardRequest& operator=(FGetFriendLeaderboardRequest&& src) = default;
+
         FGetFriendLeaderboardRequest(const TSharedPtr<FJsonObject>& obj) : FGetFriendLeaderboardRequest()
         {
             readFromValue(obj);
@@ -5512,7 +7577,13 @@ namespace ClientModels
         ~FGetFriendLeaderboardRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetFriendsListRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5549,10 +7620,22 @@ namespace ClientModels
             CustomTags(src.CustomTags),
             IncludeFacebookFriends(src.IncludeFacebookFriends),
             IncludeSteamFriends(src.IncludeSteamFriends),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr),
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr),
             XboxToken(src.XboxToken)
             {}
 
+        FGetFriendsListRequest(FGetFriendsListRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            IncludeFacebookFriends(MoveTemp(src.IncludeFacebookFriends)),
+            IncludeSteamFriends(MoveTemp(src.IncludeSteamFriends)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints)),
+            XboxToken(MoveTemp(src.XboxToken))
+            {}
+
+        FGetFriendsListRequest& operator=(const FGetFriendsListRequest& src) = default;
+        FGetFriendsListRequest& operator=(FGetFriendsListRequest&& src) = default;
+
         FGetFriendsListRequest(const TSharedPtr<FJsonObject>& obj) : FGetFriendsListRequest()
         {
             readFromValue(obj);
@@ -5561,7 +7644,13 @@ namespace ClientModels
         ~FGetFriendsListRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetFriendsListResult : public PlayFab::FPlayFabCppResultCommon
@@ -5578,6 +7667,14 @@ namespace ClientModels
             Friends(src.Friends)
             {}
 
+        FGetFriendsListResult(FGetFriendsListResult&& src) :
+            FPlayFabCppResultCommon(),
+            Friends(MoveTemp(src.Friends))
+            {}
+
+        FGetFriendsListResult& operator=(const FGetFriendsListResult& src) = default;
+        FGetFriendsListResult& operator=(FGetFriendsListResult&& src) = default;
+
         FGetFriendsListResult(const TSharedPtr<FJsonObject>& obj) : FGetFriendsListResult()
         {
             readFromValue(obj);
@@ -5586,7 +7683,13 @@ namespace ClientModels
         ~FGetFriendsListResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardAroundCharacterRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5619,6 +7722,17 @@ namespace ClientModels
             StatisticName(src.StatisticName)
             {}
 
+        FGetLeaderboardAroundCharacterRequest(FGetLeaderboardAroundCharacterRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CharacterType(MoveTemp(src.CharacterType)),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            StatisticName(MoveTemp(src.StatisticName))
+            {}
+
+        FGetLeaderboardAroundCharacterRequest& operator=(const FGetLeaderboardAroundCharacterRequest& src) = default;
+        FGetLeaderboardAroundCharacterRequest& operator=(FGetLeaderboardAroundCharacterRequest&& src) = default;
+
         FGetLeaderboardAroundCharacterRequest(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardAroundCharacterRequest()
         {
             readFromValue(obj);
@@ -5627,7 +7741,13 @@ namespace ClientModels
         ~FGetLeaderboardAroundCharacterRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardAroundCharacterResult : public PlayFab::FPlayFabCppResultCommon
@@ -5644,6 +7764,14 @@ namespace ClientModels
             Leaderboard(src.Leaderboard)
             {}
 
+        FGetLeaderboardAroundCharacterResult(FGetLeaderboardAroundCharacterResult&& src) :
+            FPlayFabCppResultCommon(),
+            Leaderboard(MoveTemp(src.Leaderboard))
+            {}
+
+        FGetLeaderboardAroundCharacterResult& operator=(const FGetLeaderboardAroundCharacterResult& src) = default;
+        FGetLeaderboardAroundCharacterResult& operator=(FGetLeaderboardAroundCharacterResult&& src) = default;
+
         FGetLeaderboardAroundCharacterResult(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardAroundCharacterResult()
         {
             readFromValue(obj);
@@ -5652,7 +7780,13 @@ namespace ClientModels
         ~FGetLeaderboardAroundCharacterResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardAroundPlayerRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5697,12 +7831,26 @@ namespace ClientModels
             CustomTags(src.CustomTags),
             MaxResultsCount(src.MaxResultsCount),
             PlayFabId(src.PlayFabId),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr),
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr),
             StatisticName(src.StatisticName),
             UseSpecificVersion(src.UseSpecificVersion),
             Version(src.Version)
             {}
 
+        FGetLeaderboardAroundPlayerRequest(FGetLeaderboardAroundPlayerRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            UseSpecificVersion(MoveTemp(src.UseSpecificVersion)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FGetLeaderboardAroundPlayerRequest& operator=(const FGetLeaderboardAroundPlayerRequest& src) = default;
+        FGetLeaderboardAroundPlayerRequest& operator=(FGetLeaderboardAroundPlayerRequest&& src) = default;
+
         FGetLeaderboardAroundPlayerRequest(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardAroundPlayerRequest()
         {
             readFromValue(obj);
@@ -5711,7 +7859,13 @@ namespace ClientModels
         ~FGetLeaderboardAroundPlayerRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardAroundPlayerResult : public PlayFab::FPlayFabCppResultCommon
@@ -5738,6 +7892,16 @@ namespace ClientModels
             Version(src.Version)
             {}
 
+        FGetLeaderboardAroundPlayerResult(FGetLeaderboardAroundPlayerResult&& src) :
+            FPlayFabCppResultCommon(),
+            Leaderboard(MoveTemp(src.Leaderboard)),
+            NextReset(MoveTemp(src.NextReset)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FGetLeaderboardAroundPlayerResult& operator=(const FGetLeaderboardAroundPlayerResult& src) = default;
+        FGetLeaderboardAroundPlayerResult& operator=(FGetLeaderboardAroundPlayerResult&& src) = default;
+
         FGetLeaderboardAroundPlayerResult(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardAroundPlayerResult()
         {
             readFromValue(obj);
@@ -5746,7 +7910,13 @@ namespace ClientModels
         ~FGetLeaderboardAroundPlayerResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardForUsersCharactersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5769,6 +7939,15 @@ namespace ClientModels
             StatisticName(src.StatisticName)
             {}
 
+        FGetLeaderboardForUsersCharactersRequest(FGetLeaderboardForUsersCharactersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            StatisticName(MoveTemp(src.StatisticName))
+            {}
+
+        FGetLeaderboardForUsersCharactersRequest& operator=(const FGetLeaderboardForUsersCharactersRequest& src) = default;
+        FGetLeaderboardForUsersCharactersRequest& operator=(FGetLeaderboardForUsersCharactersRequest&& src) = default;
+
         FGetLeaderboardForUsersCharactersRequest(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardForUsersCharactersRequest()
         {
             readFromValue(obj);
@@ -5777,7 +7956,13 @@ namespace ClientModels
         ~FGetLeaderboardForUsersCharactersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardForUsersCharactersResult : public PlayFab::FPlayFabCppResultCommon
@@ -5794,6 +7979,14 @@ namespace ClientModels
             Leaderboard(src.Leaderboard)
             {}
 
+        FGetLeaderboardForUsersCharactersResult(FGetLeaderboardForUsersCharactersResult&& src) :
+            FPlayFabCppResultCommon(),
+            Leaderboard(MoveTemp(src.Leaderboard))
+            {}
+
+        FGetLeaderboardForUsersCharactersResult& operator=(const FGetLeaderboardForUsersCharactersResult& src) = default;
+        FGetLeaderboardForUsersCharactersResult& operator=(FGetLeaderboardForUsersCharactersResult&& src) = default;
+
         FGetLeaderboardForUsersCharactersResult(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardForUsersCharactersResult()
         {
             readFromValue(obj);
@@ -5802,7 +7995,13 @@ namespace ClientModels
         ~FGetLeaderboardForUsersCharactersResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5846,13 +8045,27 @@ namespace ClientModels
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
             MaxResultsCount(src.MaxResultsCount),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr),
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr),
             StartPosition(src.StartPosition),
             StatisticName(src.StatisticName),
             UseSpecificVersion(src.UseSpecificVersion),
             Version(src.Version)
             {}
 
+        FGetLeaderboardRequest(FGetLeaderboardRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints)),
+            StartPosition(MoveTemp(src.StartPosition)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            UseSpecificVersion(MoveTemp(src.UseSpecificVersion)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FGetLeaderboardRequest& operator=(const FGetLeaderboardRequest& src) = default;
+        FGetLeaderboardRequest& operator=(FGetLeaderboardRequest&& src) = default;
+
         FGetLeaderboardRequest(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardRequest()
         {
             readFromValue(obj);
@@ -5861,7 +8074,13 @@ namespace ClientModels
         ~FGetLeaderboardRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardResult : public PlayFab::FPlayFabCppResultCommon
@@ -5888,6 +8107,16 @@ namespace ClientModels
             Version(src.Version)
             {}
 
+        FGetLeaderboardResult(FGetLeaderboardResult&& src) :
+            FPlayFabCppResultCommon(),
+            Leaderboard(MoveTemp(src.Leaderboard)),
+            NextReset(MoveTemp(src.NextReset)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FGetLeaderboardResult& operator=(const FGetLeaderboardResult& src) = default;
+        FGetLeaderboardResult& operator=(FGetLeaderboardResult&& src) = default;
+
         FGetLeaderboardResult(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardResult()
         {
             readFromValue(obj);
@@ -5896,7 +8125,13 @@ namespace ClientModels
         ~FGetLeaderboardResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPaymentTokenRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5914,6 +8149,14 @@ namespace ClientModels
             TokenProvider(src.TokenProvider)
             {}
 
+        FGetPaymentTokenRequest(FGetPaymentTokenRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            TokenProvider(MoveTemp(src.TokenProvider))
+            {}
+
+        FGetPaymentTokenRequest& operator=(const FGetPaymentTokenRequest& src) = default;
+        FGetPaymentTokenRequest& operator=(FGetPaymentTokenRequest&& src) = default;
+
         FGetPaymentTokenRequest(const TSharedPtr<FJsonObject>& obj) : FGetPaymentTokenRequest()
         {
             readFromValue(obj);
@@ -5922,7 +8165,13 @@ namespace ClientModels
         ~FGetPaymentTokenRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPaymentTokenResult : public PlayFab::FPlayFabCppResultCommon
@@ -5945,6 +8194,15 @@ namespace ClientModels
             ProviderToken(src.ProviderToken)
             {}
 
+        FGetPaymentTokenResult(FGetPaymentTokenResult&& src) :
+            FPlayFabCppResultCommon(),
+            OrderId(MoveTemp(src.OrderId)),
+            ProviderToken(MoveTemp(src.ProviderToken))
+            {}
+
+        FGetPaymentTokenResult& operator=(const FGetPaymentTokenResult& src) = default;
+        FGetPaymentTokenResult& operator=(FGetPaymentTokenResult&& src) = default;
+
         FGetPaymentTokenResult(const TSharedPtr<FJsonObject>& obj) : FGetPaymentTokenResult()
         {
             readFromValue(obj);
@@ -5953,7 +8211,13 @@ namespace ClientModels
         ~FGetPaymentTokenResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPhotonAuthenticationTokenRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5971,6 +8235,14 @@ namespace ClientModels
             PhotonApplicationId(src.PhotonApplicationId)
             {}
 
+        FGetPhotonAuthenticationTokenRequest(FGetPhotonAuthenticationTokenRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PhotonApplicationId(MoveTemp(src.PhotonApplicationId))
+            {}
+
+        FGetPhotonAuthenticationTokenRequest& operator=(const FGetPhotonAuthenticationTokenRequest& src) = default;
+        FGetPhotonAuthenticationTokenRequest& operator=(FGetPhotonAuthenticationTokenRequest&& src) = default;
+
         FGetPhotonAuthenticationTokenRequest(const TSharedPtr<FJsonObject>& obj) : FGetPhotonAuthenticationTokenRequest()
         {
             readFromValue(obj);
@@ -5979,7 +8251,13 @@ namespace ClientModels
         ~FGetPhotonAuthenticationTokenRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPhotonAuthenticationTokenResult : public PlayFab::FPlayFabCppResultCommon
@@ -5997,6 +8275,14 @@ namespace ClientModels
             PhotonCustomAuthenticationToken(src.PhotonCustomAuthenticationToken)
             {}
 
+        FGetPhotonAuthenticationTokenResult(FGetPhotonAuthenticationTokenResult&& src) :
+            FPlayFabCppResultCommon(),
+            PhotonCustomAuthenticationToken(MoveTemp(src.PhotonCustomAuthenticationToken))
+            {}
+
+        FGetPhotonAuthenticationTokenResult& operator=(const FGetPhotonAuthenticationTokenResult& src) = default;
+        FGetPhotonAuthenticationTokenResult& operator=(FGetPhotonAuthenticationTokenResult&& src) = default;
+
         FGetPhotonAuthenticationTokenResult(const TSharedPtr<FJsonObject>& obj) : FGetPhotonAuthenticationTokenResult()
         {
             readFromValue(obj);
@@ -6005,7 +8291,13 @@ namespace ClientModels
         ~FGetPhotonAuthenticationTokenResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerCombinedInfoRequestParams : public PlayFab::FPlayFabCppBaseModel
@@ -6086,12 +8378,34 @@ namespace ClientModels
             GetUserReadOnlyData(src.GetUserReadOnlyData),
             GetUserVirtualCurrency(src.GetUserVirtualCurrency),
             PlayerStatisticNames(src.PlayerStatisticNames),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr),
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr),
             TitleDataKeys(src.TitleDataKeys),
             UserDataKeys(src.UserDataKeys),
             UserReadOnlyDataKeys(src.UserReadOnlyDataKeys)
             {}
 
+        FGetPlayerCombinedInfoRequestParams(FGetPlayerCombinedInfoRequestParams&& src) :
+            FPlayFabCppBaseModel(),
+            GetCharacterInventories(MoveTemp(src.GetCharacterInventories)),
+            GetCharacterList(MoveTemp(src.GetCharacterList)),
+            GetPlayerProfile(MoveTemp(src.GetPlayerProfile)),
+            GetPlayerStatistics(MoveTemp(src.GetPlayerStatistics)),
+            GetTitleData(MoveTemp(src.GetTitleData)),
+            GetUserAccountInfo(MoveTemp(src.GetUserAccountInfo)),
+            GetUserData(MoveTemp(src.GetUserData)),
+            GetUserInventory(MoveTemp(src.GetUserInventory)),
+            GetUserReadOnlyData(MoveTemp(src.GetUserReadOnlyData)),
+            GetUserVirtualCurrency(MoveTemp(src.GetUserVirtualCurrency)),
+            PlayerStatisticNames(MoveTemp(src.PlayerStatisticNames)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints)),
+            TitleDataKeys(MoveTemp(src.TitleDataKeys)),
+            UserDataKeys(MoveTemp(src.UserDataKeys)),
+            UserReadOnlyDataKeys(MoveTemp(src.UserReadOnlyDataKeys))
+            {}
+
+        FGetPlayerCombinedInfoRequestParams& operator=(const FGetPlayerCombinedInfoRequestParams& src) = default;
+        FGetPlayerCombinedInfoRequestParams& operator=(FGetPlayerCombinedInfoRequestParams&& src) = default;
+
         FGetPlayerCombinedInfoRequestParams(const TSharedPtr<FJsonObject>& obj) : FGetPlayerCombinedInfoRequestParams()
         {
             readFromValue(obj);
@@ -6100,7 +8414,13 @@ namespace ClientModels
         ~FGetPlayerCombinedInfoRequestParams();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerCombinedInfoRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6127,6 +8447,16 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetPlayerCombinedInfoRequest(FGetPlayerCombinedInfoRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetPlayerCombinedInfoRequest& operator=(const FGetPlayerCombinedInfoRequest& src) = default;
+        FGetPlayerCombinedInfoRequest& operator=(FGetPlayerCombinedInfoRequest&& src) = default;
+
         FGetPlayerCombinedInfoRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerCombinedInfoRequest()
         {
             readFromValue(obj);
@@ -6135,7 +8465,13 @@ namespace ClientModels
         ~FGetPlayerCombinedInfoRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStatisticValue : public PlayFab::FPlayFabCppBaseModel
@@ -6163,6 +8499,16 @@ namespace ClientModels
             Version(src.Version)
             {}
 
+        FStatisticValue(FStatisticValue&& src) :
+            FPlayFabCppBaseModel(),
+            StatisticName(MoveTemp(src.StatisticName)),
+            Value(MoveTemp(src.Value)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FStatisticValue& operator=(const FStatisticValue& src) = default;
+        FStatisticValue& operator=(FStatisticValue&& src) = default;
+
         FStatisticValue(const TSharedPtr<FJsonObject>& obj) : FStatisticValue()
         {
             readFromValue(obj);
@@ -6171,7 +8517,13 @@ namespace ClientModels
         ~FStatisticValue();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerCombinedInfoResultPayload : public PlayFab::FPlayFabCppBaseModel
@@ -6228,10 +8580,10 @@ namespace ClientModels
 
         FGetPlayerCombinedInfoResultPayload(const FGetPlayerCombinedInfoResultPayload& src) :
             FPlayFabCppBaseModel(),
-            AccountInfo(src.AccountInfo.IsValid() ? MakeShareable(new FUserAccountInfo(*src.AccountInfo)) : nullptr),
+            AccountInfo(src.AccountInfo.IsValid() ? TSharedPtr<FUserAccountInfo>(MakeShared<FUserAccountInfo>(*src.AccountInfo)) : nullptr),
             CharacterInventories(src.CharacterInventories),
             CharacterList(src.CharacterList),
-            PlayerProfile(src.PlayerProfile.IsValid() ? MakeShareable(new FPlayerProfileModel(*src.PlayerProfile)) : nullptr),
+            PlayerProfile(src.PlayerProfile.IsValid() ? TSharedPtr<FPlayerProfileModel>(MakeShared<FPlayerProfileModel>(*src.PlayerProfile)) : nullptr),
             PlayerStatistics(src.PlayerStatistics),
             TitleData(src.TitleData),
             UserData(src.UserData),
@@ -6243,6 +8595,26 @@ namespace ClientModels
             UserVirtualCurrencyRechargeTimes(src.UserVirtualCurrencyRechargeTimes)
             {}
 
+        FGetPlayerCombinedInfoResultPayload(FGetPlayerCombinedInfoResultPayload&& src) :
+            FPlayFabCppBaseModel(),
+            AccountInfo(MoveTemp(src.AccountInfo)),
+            CharacterInventories(MoveTemp(src.CharacterInventories)),
+            CharacterList(MoveTemp(src.CharacterList)),
+            PlayerProfile(MoveTemp(src.PlayerProfile)),
+            PlayerStatistics(MoveTemp(src.PlayerStatistics)),
+            TitleData(MoveTemp(src.TitleData)),
+            UserData(MoveTemp(src.UserData)),
+            UserDataVersion(MoveTemp(src.UserDataVersion)),
+            UserInventory(MoveTemp(src.UserInventory)),
+            UserReadOnlyData(MoveTemp(src.UserReadOnlyData)),
+            UserReadOnlyDataVersion(MoveTemp(src.UserReadOnlyDataVersion)),
+            UserVirtualCurrency(MoveTemp(src.UserVirtualCurrency)),
+            UserVirtualCurrencyRechargeTimes(MoveTemp(src.UserVirtualCurrencyRechargeTimes))
+            {}
+
+        FGetPlayerCombinedInfoResultPayload& operator=(const FGetPlayerCombinedInfoResultPayload& src) = default;
+        FGetPlayerCombinedInfoResultPayload& operator=(FGetPlayerCombinedInfoResultPayload&& src) = default;
+
         FGetPlayerCombinedInfoResultPayload(const TSharedPtr<FJsonObject>& obj) : FGetPlayerCombinedInfoResultPayload()
         {
             readFromValue(obj);
@@ -6251,7 +8623,13 @@ namespace ClientModels
         ~FGetPlayerCombinedInfoResultPayload();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerCombinedInfoResult : public PlayFab::FPlayFabCppResultCommon
@@ -6270,10 +8648,19 @@ namespace ClientModels
 
         FGetPlayerCombinedInfoResult(const FGetPlayerCombinedInfoResult& src) :
             FPlayFabCppResultCommon(),
-            InfoResultPayload(src.InfoResultPayload.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoResultPayload(*src.InfoResultPayload)) : nullptr),
+            InfoResultPayload(src.InfoResultPayload.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoResultPayload>(MakeShared<FGetPlayerCombinedInfoResultPayload>(*src.InfoResultPayload)) : nullptr),
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetPlayerCombinedInfoResult(FGetPlayerCombinedInfoResult&& src) :
+            FPlayFabCppResultCommon(),
+            InfoResultPayload(MoveTemp(src.InfoResultPayload)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetPlayerCombinedInfoResult& operator=(const FGetPlayerCombinedInfoResult& src) = default;
+        FGetPlayerCombinedInfoResult& operator=(FGetPlayerCombinedInfoResult&& src) = default;
+
         FGetPlayerCombinedInfoResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerCombinedInfoResult()
         {
             readFromValue(obj);
@@ -6282,7 +8669,13 @@ namespace ClientModels
         ~FGetPlayerCombinedInfoResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerProfileRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6310,9 +8703,19 @@ namespace ClientModels
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
             PlayFabId(src.PlayFabId),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr)
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr)
+            {}
+
+        FGetPlayerProfileRequest(FGetPlayerProfileRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints))
             {}
 
+        FGetPlayerProfileRequest& operator=(const FGetPlayerProfileRequest& src) = default;
+        FGetPlayerProfileRequest& operator=(FGetPlayerProfileRequest&& src) = default;
+
         FGetPlayerProfileRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerProfileRequest()
         {
             readFromValue(obj);
@@ -6321,7 +8724,13 @@ namespace ClientModels
         ~FGetPlayerProfileRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerProfileResult : public PlayFab::FPlayFabCppResultCommon
@@ -6339,9 +8748,17 @@ namespace ClientModels
 
         FGetPlayerProfileResult(const FGetPlayerProfileResult& src) :
             FPlayFabCppResultCommon(),
-            PlayerProfile(src.PlayerProfile.IsValid() ? MakeShareable(new FPlayerProfileModel(*src.PlayerProfile)) : nullptr)
+            PlayerProfile(src.PlayerProfile.IsValid() ? TSharedPtr<FPlayerProfileModel>(MakeShared<FPlayerProfileModel>(*src.PlayerProfile)) : nullptr)
+            {}
+
+        FGetPlayerProfileResult(FGetPlayerProfileResult&& src) :
+            FPlayFabCppResultCommon(),
+            PlayerProfile(MoveTemp(src.PlayerProfile))
             {}
 
+        FGetPlayerProfileResult& operator=(const FGetPlayerProfileResult& src) = default;
+        FGetPlayerProfileResult& operator=(FGetPlayerProfileResult&& src) = default;
+
         FGetPlayerProfileResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerProfileResult()
         {
             readFromValue(obj);
@@ -6350,7 +8767,13 @@ namespace ClientModels
         ~FGetPlayerProfileResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerSegmentsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6363,6 +8786,13 @@ namespace ClientModels
             FPlayFabCppRequestCommon()
             {}
 
+        FGetPlayerSegmentsRequest(FGetPlayerSegmentsRequest&& src) :
+            FPlayFabCppRequestCommon()
+            {}
+
+        FGetPlayerSegmentsRequest& operator=(const FGetPlayerSegmentsRequest& src) = default;
+        FGetPlayerSegmentsRequest& operator=(FGetPlayerSegmentsRequest&& src) = default;
+
         FGetPlayerSegmentsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerSegmentsRequest()
         {
             readFromValue(obj);
@@ -6371,7 +8801,13 @@ namespace ClientModels
         ~FGetPlayerSegmentsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetSegmentResult : public PlayFab::FPlayFabCppBaseModel
@@ -6399,6 +8835,16 @@ namespace ClientModels
             Name(src.Name)
             {}
 
+        FGetSegmentResult(FGetSegmentResult&& src) :
+            FPlayFabCppBaseModel(),
+            ABTestParent(MoveTemp(src.ABTestParent)),
+            Id(MoveTemp(src.Id)),
+            Name(MoveTemp(src.Name))
+            {}
+
+        FGetSegmentResult& operator=(const FGetSegmentResult& src) = default;
+        FGetSegmentResult& operator=(FGetSegmentResult&& src) = default;
+
         FGetSegmentResult(const TSharedPtr<FJsonObject>& obj) : FGetSegmentResult()
         {
             readFromValue(obj);
@@ -6407,7 +8853,13 @@ namespace ClientModels
         ~FGetSegmentResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerSegmentsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6424,6 +8876,14 @@ namespace ClientModels
             Segments(src.Segments)
             {}
 
+        FGetPlayerSegmentsResult(FGetPlayerSegmentsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Segments(MoveTemp(src.Segments))
+            {}
+
+        FGetPlayerSegmentsResult& operator=(const FGetPlayerSegmentsResult& src) = default;
+        FGetPlayerSegmentsResult& operator=(FGetPlayerSegmentsResult&& src) = default;
+
         FGetPlayerSegmentsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerSegmentsResult()
         {
             readFromValue(obj);
@@ -6432,7 +8892,13 @@ namespace ClientModels
         ~FGetPlayerSegmentsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStatisticNameVersion : public PlayFab::FPlayFabCppBaseModel
@@ -6455,6 +8921,15 @@ namespace ClientModels
             Version(src.Version)
             {}
 
+        FStatisticNameVersion(FStatisticNameVersion&& src) :
+            FPlayFabCppBaseModel(),
+            StatisticName(MoveTemp(src.StatisticName)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FStatisticNameVersion& operator=(const FStatisticNameVersion& src) = default;
+        FStatisticNameVersion& operator=(FStatisticNameVersion&& src) = default;
+
         FStatisticNameVersion(const TSharedPtr<FJsonObject>& obj) : FStatisticNameVersion()
         {
             readFromValue(obj);
@@ -6463,7 +8938,13 @@ namespace ClientModels
         ~FStatisticNameVersion();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6491,6 +8972,16 @@ namespace ClientModels
             StatisticNameVersions(src.StatisticNameVersions)
             {}
 
+        FGetPlayerStatisticsRequest(FGetPlayerStatisticsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            StatisticNames(MoveTemp(src.StatisticNames)),
+            StatisticNameVersions(MoveTemp(src.StatisticNameVersions))
+            {}
+
+        FGetPlayerStatisticsRequest& operator=(const FGetPlayerStatisticsRequest& src) = default;
+        FGetPlayerStatisticsRequest& operator=(FGetPlayerStatisticsRequest&& src) = default;
+
         FGetPlayerStatisticsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerStatisticsRequest()
         {
             readFromValue(obj);
@@ -6499,7 +8990,13 @@ namespace ClientModels
         ~FGetPlayerStatisticsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerStatisticsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6516,6 +9013,14 @@ namespace ClientModels
             Statistics(src.Statistics)
             {}
 
+        FGetPlayerStatisticsResult(FGetPlayerStatisticsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Statistics(MoveTemp(src.Statistics))
+            {}
+
+        FGetPlayerStatisticsResult& operator=(const FGetPlayerStatisticsResult& src) = default;
+        FGetPlayerStatisticsResult& operator=(FGetPlayerStatisticsResult&& src) = default;
+
         FGetPlayerStatisticsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerStatisticsResult()
         {
             readFromValue(obj);
@@ -6524,7 +9029,13 @@ namespace ClientModels
         ~FGetPlayerStatisticsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerStatisticVersionsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6546,6 +9057,15 @@ namespace ClientModels
             StatisticName(src.StatisticName)
             {}
 
+        FGetPlayerStatisticVersionsRequest(FGetPlayerStatisticVersionsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            StatisticName(MoveTemp(src.StatisticName))
+            {}
+
+        FGetPlayerStatisticVersionsRequest& operator=(const FGetPlayerStatisticVersionsRequest& src) = default;
+        FGetPlayerStatisticVersionsRequest& operator=(FGetPlayerStatisticVersionsRequest&& src) = default;
+
         FGetPlayerStatisticVersionsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerStatisticVersionsRequest()
         {
             readFromValue(obj);
@@ -6554,7 +9074,13 @@ namespace ClientModels
         ~FGetPlayerStatisticVersionsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerStatisticVersion : public PlayFab::FPlayFabCppBaseModel
@@ -6597,6 +9123,19 @@ namespace ClientModels
             Version(src.Version)
             {}
 
+        FPlayerStatisticVersion(FPlayerStatisticVersion&& src) :
+            FPlayFabCppBaseModel(),
+            ActivationTime(MoveTemp(src.ActivationTime)),
+            DeactivationTime(MoveTemp(src.DeactivationTime)),
+            ScheduledActivationTime(MoveTemp(src.ScheduledActivationTime)),
+            ScheduledDeactivationTime(MoveTemp(src.ScheduledDeactivationTime)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FPlayerStatisticVersion& operator=(const FPlayerStatisticVersion& src) = default;
+        FPlayerStatisticVersion& operator=(FPlayerStatisticVersion&& src) = default;
+
         FPlayerStatisticVersion(const TSharedPtr<FJsonObject>& obj) : FPlayerStatisticVersion()
         {
             readFromValue(obj);
@@ -6605,7 +9144,13 @@ namespace ClientModels
         ~FPlayerStatisticVersion();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerStatisticVersionsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6622,6 +9167,14 @@ namespace ClientModels
             StatisticVersions(src.StatisticVersions)
             {}
 
+        FGetPlayerStatisticVersionsResult(FGetPlayerStatisticVersionsResult&& src) :
+            FPlayFabCppResultCommon(),
+            StatisticVersions(MoveTemp(src.StatisticVersions))
+            {}
+
+        FGetPlayerStatisticVersionsResult& operator=(const FGetPlayerStatisticVersionsResult& src) = default;
+        FGetPlayerStatisticVersionsResult& operator=(FGetPlayerStatisticVersionsResult&& src) = default;
+
         FGetPlayerStatisticVersionsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerStatisticVersionsResult()
         {
             readFromValue(obj);
@@ -6630,7 +9183,13 @@ namespace ClientModels
         ~FGetPlayerStatisticVersionsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerTagsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6657,6 +9216,16 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetPlayerTagsRequest(FGetPlayerTagsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Namespace(MoveTemp(src.Namespace)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetPlayerTagsRequest& operator=(const FGetPlayerTagsRequest& src) = default;
+        FGetPlayerTagsRequest& operator=(FGetPlayerTagsRequest&& src) = default;
+
         FGetPlayerTagsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerTagsRequest()
         {
             readFromValue(obj);
@@ -6665,7 +9234,13 @@ namespace ClientModels
         ~FGetPlayerTagsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerTagsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6687,6 +9262,15 @@ namespace ClientModels
             Tags(src.Tags)
             {}
 
+        FGetPlayerTagsResult(FGetPlayerTagsResult&& src) :
+            FPlayFabCppResultCommon(),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Tags(MoveTemp(src.Tags))
+            {}
+
+        FGetPlayerTagsResult& operator=(const FGetPlayerTagsResult& src) = default;
+        FGetPlayerTagsResult& operator=(FGetPlayerTagsResult&& src) = default;
+
         FGetPlayerTagsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerTagsResult()
         {
             readFromValue(obj);
@@ -6695,7 +9279,13 @@ namespace ClientModels
         ~FGetPlayerTagsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerTradesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6713,6 +9303,14 @@ namespace ClientModels
             StatusFilter(src.StatusFilter)
             {}
 
+        FGetPlayerTradesRequest(FGetPlayerTradesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            StatusFilter(MoveTemp(src.StatusFilter))
+            {}
+
+        FGetPlayerTradesRequest& operator=(const FGetPlayerTradesRequest& src) = default;
+        FGetPlayerTradesRequest& operator=(FGetPlayerTradesRequest&& src) = default;
+
         FGetPlayerTradesRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerTradesRequest()
         {
             readFromValue(obj);
@@ -6721,7 +9319,13 @@ namespace ClientModels
         ~FGetPlayerTradesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerTradesResponse : public PlayFab::FPlayFabCppResultCommon
@@ -6742,7 +9346,16 @@ namespace ClientModels
             OpenedTrades(src.OpenedTrades)
             {}
 
-        FGetPlayerTradesResponse(const TSharedPtr<FJsonObject>& obj) : FGetPlayerTradesResponse()
+        FGetPlayerTradesResponse(FGetPlayerTradesResponse&& src) :
+            FPlayFabCppResultCommon(),
+            AcceptedTrades(MoveTemp(src.AcceptedTrades)),
+            OpenedTrades(MoveTemp(src.OpenedTrades))
+            {}
+
+        FGetPlayerTradesResponse& operator=(const FGetPlayerTradesResponse& src) = default;
+        FGetPlayerTradesResponse& operator=(FGetPlayerTradesResponse&& src) = default;
+
+        FGetPlayerTradesResponse(const TSharedPtr<FJsonObject>& obj) : FGetPlayerTradesResponse()
         {
             readFromValue(obj);
         }
@@ -6750,7 +9363,13 @@ namespace ClientModels
         ~FGetPlayerTradesResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromFacebookIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6767,6 +9386,14 @@ namespace ClientModels
             FacebookIDs(src.FacebookIDs)
             {}
 
+        FGetPlayFabIDsFromFacebookIDsRequest(FGetPlayFabIDsFromFacebookIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            FacebookIDs(MoveTemp(src.FacebookIDs))
+            {}
+
+        FGetPlayFabIDsFromFacebookIDsRequest& operator=(const FGetPlayFabIDsFromFacebookIDsRequest& src) = default;
+        FGetPlayFabIDsFromFacebookIDsRequest& operator=(FGetPlayFabIDsFromFacebookIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromFacebookIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromFacebookIDsRequest()
         {
             readFromValue(obj);
@@ -6775,7 +9402,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromFacebookIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromFacebookIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6792,6 +9425,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromFacebookIDsResult(FGetPlayFabIDsFromFacebookIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromFacebookIDsResult& operator=(const FGetPlayFabIDsFromFacebookIDsResult& src) = default;
+        FGetPlayFabIDsFromFacebookIDsResult& operator=(FGetPlayFabIDsFromFacebookIDsResult&& src) = default;
+
         FGetPlayFabIDsFromFacebookIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromFacebookIDsResult()
         {
             readFromValue(obj);
@@ -6800,7 +9441,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromFacebookIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromFacebookInstantGamesIdsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6817,6 +9464,14 @@ namespace ClientModels
             FacebookInstantGamesIds(src.FacebookInstantGamesIds)
             {}
 
+        FGetPlayFabIDsFromFacebookInstantGamesIdsRequest(FGetPlayFabIDsFromFacebookInstantGamesIdsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            FacebookInstantGamesIds(MoveTemp(src.FacebookInstantGamesIds))
+            {}
+
+        FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& operator=(const FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& src) = default;
+        FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& operator=(FGetPlayFabIDsFromFacebookInstantGamesIdsRequest&& src) = default;
+
         FGetPlayFabIDsFromFacebookInstantGamesIdsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromFacebookInstantGamesIdsRequest()
         {
             readFromValue(obj);
@@ -6825,7 +9480,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromFacebookInstantGamesIdsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromFacebookInstantGamesIdsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6842,6 +9503,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromFacebookInstantGamesIdsResult(FGetPlayFabIDsFromFacebookInstantGamesIdsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromFacebookInstantGamesIdsResult& operator=(const FGetPlayFabIDsFromFacebookInstantGamesIdsResult& src) = default;
+        FGetPlayFabIDsFromFacebookInstantGamesIdsResult& operator=(FGetPlayFabIDsFromFacebookInstantGamesIdsResult&& src) = default;
+
         FGetPlayFabIDsFromFacebookInstantGamesIdsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromFacebookInstantGamesIdsResult()
         {
             readFromValue(obj);
@@ -6850,7 +9519,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromFacebookInstantGamesIdsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromGameCenterIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6867,6 +9542,14 @@ namespace ClientModels
             GameCenterIDs(src.GameCenterIDs)
             {}
 
+        FGetPlayFabIDsFromGameCenterIDsRequest(FGetPlayFabIDsFromGameCenterIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            GameCenterIDs(MoveTemp(src.GameCenterIDs))
+            {}
+
+        FGetPlayFabIDsFromGameCenterIDsRequest& operator=(const FGetPlayFabIDsFromGameCenterIDsRequest& src) = default;
+        FGetPlayFabIDsFromGameCenterIDsRequest& operator=(FGetPlayFabIDsFromGameCenterIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromGameCenterIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromGameCenterIDsRequest()
         {
             readFromValue(obj);
@@ -6875,7 +9558,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromGameCenterIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromGameCenterIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6892,6 +9581,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromGameCenterIDsResult(FGetPlayFabIDsFromGameCenterIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromGameCenterIDsResult& operator=(const FGetPlayFabIDsFromGameCenterIDsResult& src) = default;
+        FGetPlayFabIDsFromGameCenterIDsResult& operator=(FGetPlayFabIDsFromGameCenterIDsResult&& src) = default;
+
         FGetPlayFabIDsFromGameCenterIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromGameCenterIDsResult()
         {
             readFromValue(obj);
@@ -6900,7 +9597,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromGameCenterIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromGenericIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6920,6 +9623,14 @@ namespace ClientModels
             GenericIDs(src.GenericIDs)
             {}
 
+        FGetPlayFabIDsFromGenericIDsRequest(FGetPlayFabIDsFromGenericIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            GenericIDs(MoveTemp(src.GenericIDs))
+            {}
+
+        FGetPlayFabIDsFromGenericIDsRequest& operator=(const FGetPlayFabIDsFromGenericIDsRequest& src) = default;
+        FGetPlayFabIDsFromGenericIDsRequest& operator=(FGetPlayFabIDsFromGenericIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromGenericIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromGenericIDsRequest()
         {
             readFromValue(obj);
@@ -6928,7 +9639,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromGenericIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromGenericIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6945,6 +9662,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromGenericIDsResult(FGetPlayFabIDsFromGenericIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromGenericIDsResult& operator=(const FGetPlayFabIDsFromGenericIDsResult& src) = default;
+        FGetPlayFabIDsFromGenericIDsResult& operator=(FGetPlayFabIDsFromGenericIDsResult&& src) = default;
+
         FGetPlayFabIDsFromGenericIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromGenericIDsResult()
         {
             readFromValue(obj);
@@ -6953,7 +9678,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromGenericIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromGoogleIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6970,6 +9701,14 @@ namespace ClientModels
             GoogleIDs(src.GoogleIDs)
             {}
 
+        FGetPlayFabIDsFromGoogleIDsRequest(FGetPlayFabIDsFromGoogleIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            GoogleIDs(MoveTemp(src.GoogleIDs))
+            {}
+
+        FGetPlayFabIDsFromGoogleIDsRequest& operator=(const FGetPlayFabIDsFromGoogleIDsRequest& src) = default;
+        FGetPlayFabIDsFromGoogleIDsRequest& operator=(FGetPlayFabIDsFromGoogleIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromGoogleIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromGoogleIDsRequest()
         {
             readFromValue(obj);
@@ -6978,7 +9717,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromGoogleIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGooglePlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -7001,6 +9746,15 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGooglePlayFabIdPair(FGooglePlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            GoogleId(MoveTemp(src.GoogleId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGooglePlayFabIdPair& operator=(const FGooglePlayFabIdPair& src) = default;
+        FGooglePlayFabIdPair& operator=(FGooglePlayFabIdPair&& src) = default;
+
         FGooglePlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FGooglePlayFabIdPair()
         {
             readFromValue(obj);
@@ -7009,7 +9763,13 @@ namespace ClientModels
         ~FGooglePlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromGoogleIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7026,6 +9786,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromGoogleIDsResult(FGetPlayFabIDsFromGoogleIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromGoogleIDsResult& operator=(const FGetPlayFabIDsFromGoogleIDsResult& src) = default;
+        FGetPlayFabIDsFromGoogleIDsResult& operator=(FGetPlayFabIDsFromGoogleIDsResult&& src) = default;
+
         FGetPlayFabIDsFromGoogleIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromGoogleIDsResult()
         {
             readFromValue(obj);
@@ -7034,7 +9802,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromGoogleIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromKongregateIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7051,6 +9825,14 @@ namespace ClientModels
             KongregateIDs(src.KongregateIDs)
             {}
 
+        FGetPlayFabIDsFromKongregateIDsRequest(FGetPlayFabIDsFromKongregateIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            KongregateIDs(MoveTemp(src.KongregateIDs))
+            {}
+
+        FGetPlayFabIDsFromKongregateIDsRequest& operator=(const FGetPlayFabIDsFromKongregateIDsRequest& src) = default;
+        FGetPlayFabIDsFromKongregateIDsRequest& operator=(FGetPlayFabIDsFromKongregateIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromKongregateIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromKongregateIDsRequest()
         {
             readFromValue(obj);
@@ -7059,7 +9841,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromKongregateIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FKongregatePlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -7082,6 +9870,15 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FKongregatePlayFabIdPair(FKongregatePlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            KongregateId(MoveTemp(src.KongregateId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FKongregatePlayFabIdPair& operator=(const FKongregatePlayFabIdPair& src) = default;
+        FKongregatePlayFabIdPair& operator=(FKongregatePlayFabIdPair&& src) = default;
+
         FKongregatePlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FKongregatePlayFabIdPair()
         {
             readFromValue(obj);
@@ -7090,7 +9887,13 @@ namespace ClientModels
         ~FKongregatePlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromKongregateIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7107,6 +9910,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromKongregateIDsResult(FGetPlayFabIDsFromKongregateIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromKongregateIDsResult& operator=(const FGetPlayFabIDsFromKongregateIDsResult& src) = default;
+        FGetPlayFabIDsFromKongregateIDsResult& operator=(FGetPlayFabIDsFromKongregateIDsResult&& src) = default;
+
         FGetPlayFabIDsFromKongregateIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromKongregateIDsResult()
         {
             readFromValue(obj);
@@ -7115,7 +9926,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromKongregateIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7132,6 +9949,14 @@ namespace ClientModels
             NintendoSwitchDeviceIds(src.NintendoSwitchDeviceIds)
             {}
 
+        FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest(FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            NintendoSwitchDeviceIds(MoveTemp(src.NintendoSwitchDeviceIds))
+            {}
+
+        FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& operator=(const FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& src) = default;
+        FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& operator=(FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest&& src) = default;
+
         FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest()
         {
             readFromValue(obj);
@@ -7140,7 +9965,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FNintendoSwitchPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -7163,6 +9994,15 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FNintendoSwitchPlayFabIdPair(FNintendoSwitchPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            NintendoSwitchDeviceId(MoveTemp(src.NintendoSwitchDeviceId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FNintendoSwitchPlayFabIdPair& operator=(const FNintendoSwitchPlayFabIdPair& src) = default;
+        FNintendoSwitchPlayFabIdPair& operator=(FNintendoSwitchPlayFabIdPair&& src) = default;
+
         FNintendoSwitchPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FNintendoSwitchPlayFabIdPair()
         {
             readFromValue(obj);
@@ -7171,7 +10011,13 @@ namespace ClientModels
         ~FNintendoSwitchPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7188,6 +10034,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult(FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult& operator=(const FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult& src) = default;
+        FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult& operator=(FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult&& src) = default;
+
         FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult()
         {
             readFromValue(obj);
@@ -7196,7 +10050,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromPSNAccountIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7218,6 +10078,15 @@ namespace ClientModels
             PSNAccountIDs(src.PSNAccountIDs)
             {}
 
+        FGetPlayFabIDsFromPSNAccountIDsRequest(FGetPlayFabIDsFromPSNAccountIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            IssuerId(MoveTemp(src.IssuerId)),
+            PSNAccountIDs(MoveTemp(src.PSNAccountIDs))
+            {}
+
+        FGetPlayFabIDsFromPSNAccountIDsRequest& operator=(const FGetPlayFabIDsFromPSNAccountIDsRequest& src) = default;
+        FGetPlayFabIDsFromPSNAccountIDsRequest& operator=(FGetPlayFabIDsFromPSNAccountIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromPSNAccountIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromPSNAccountIDsRequest()
         {
             readFromValue(obj);
@@ -7226,7 +10095,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromPSNAccountIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPSNAccountPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -7249,6 +10124,15 @@ namespace ClientModels
             PSNAccountId(src.PSNAccountId)
             {}
 
+        FPSNAccountPlayFabIdPair(FPSNAccountPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            PSNAccountId(MoveTemp(src.PSNAccountId))
+            {}
+
+        FPSNAccountPlayFabIdPair& operator=(const FPSNAccountPlayFabIdPair& src) = default;
+        FPSNAccountPlayFabIdPair& operator=(FPSNAccountPlayFabIdPair&& src) = default;
+
         FPSNAccountPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FPSNAccountPlayFabIdPair()
         {
             readFromValue(obj);
@@ -7257,7 +10141,13 @@ namespace ClientModels
         ~FPSNAccountPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromPSNAccountIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7274,6 +10164,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromPSNAccountIDsResult(FGetPlayFabIDsFromPSNAccountIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromPSNAccountIDsResult& operator=(const FGetPlayFabIDsFromPSNAccountIDsResult& src) = default;
+        FGetPlayFabIDsFromPSNAccountIDsResult& operator=(FGetPlayFabIDsFromPSNAccountIDsResult&& src) = default;
+
         FGetPlayFabIDsFromPSNAccountIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromPSNAccountIDsResult()
         {
             readFromValue(obj);
@@ -7282,7 +10180,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromPSNAccountIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromSteamIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7299,6 +10203,14 @@ namespace ClientModels
             SteamStringIDs(src.SteamStringIDs)
             {}
 
+        FGetPlayFabIDsFromSteamIDsRequest(FGetPlayFabIDsFromSteamIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            SteamStringIDs(MoveTemp(src.SteamStringIDs))
+            {}
+
+        FGetPlayFabIDsFromSteamIDsRequest& operator=(const FGetPlayFabIDsFromSteamIDsRequest& src) = default;
+        FGetPlayFabIDsFromSteamIDsRequest& operator=(FGetPlayFabIDsFromSteamIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromSteamIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromSteamIDsRequest()
         {
             readFromValue(obj);
@@ -7307,7 +10219,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromSteamIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSteamPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -7330,6 +10248,15 @@ namespace ClientModels
             SteamStringId(src.SteamStringId)
             {}
 
+        FSteamPlayFabIdPair(FSteamPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            SteamStringId(MoveTemp(src.SteamStringId))
+            {}
+
+        FSteamPlayFabIdPair& operator=(const FSteamPlayFabIdPair& src) = default;
+        FSteamPlayFabIdPair& operator=(FSteamPlayFabIdPair&& src) = default;
+
         FSteamPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FSteamPlayFabIdPair()
         {
             readFromValue(obj);
@@ -7338,7 +10265,13 @@ namespace ClientModels
         ~FSteamPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromSteamIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7355,6 +10288,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromSteamIDsResult(FGetPlayFabIDsFromSteamIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromSteamIDsResult& operator=(const FGetPlayFabIDsFromSteamIDsResult& src) = default;
+        FGetPlayFabIDsFromSteamIDsResult& operator=(FGetPlayFabIDsFromSteamIDsResult&& src) = default;
+
         FGetPlayFabIDsFromSteamIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromSteamIDsResult()
         {
             readFromValue(obj);
@@ -7363,7 +10304,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromSteamIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromTwitchIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7380,6 +10327,14 @@ namespace ClientModels
             TwitchIds(src.TwitchIds)
             {}
 
+        FGetPlayFabIDsFromTwitchIDsRequest(FGetPlayFabIDsFromTwitchIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            TwitchIds(MoveTemp(src.TwitchIds))
+            {}
+
+        FGetPlayFabIDsFromTwitchIDsRequest& operator=(const FGetPlayFabIDsFromTwitchIDsRequest& src) = default;
+        FGetPlayFabIDsFromTwitchIDsRequest& operator=(FGetPlayFabIDsFromTwitchIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromTwitchIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromTwitchIDsRequest()
         {
             readFromValue(obj);
@@ -7388,7 +10343,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromTwitchIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FTwitchPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -7411,6 +10372,15 @@ namespace ClientModels
             TwitchId(src.TwitchId)
             {}
 
+        FTwitchPlayFabIdPair(FTwitchPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            TwitchId(MoveTemp(src.TwitchId))
+            {}
+
+        FTwitchPlayFabIdPair& operator=(const FTwitchPlayFabIdPair& src) = default;
+        FTwitchPlayFabIdPair& operator=(FTwitchPlayFabIdPair&& src) = default;
+
         FTwitchPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FTwitchPlayFabIdPair()
         {
             readFromValue(obj);
@@ -7419,7 +10389,13 @@ namespace ClientModels
         ~FTwitchPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromTwitchIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7436,6 +10412,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromTwitchIDsResult(FGetPlayFabIDsFromTwitchIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromTwitchIDsResult& operator=(const FGetPlayFabIDsFromTwitchIDsResult& src) = default;
+        FGetPlayFabIDsFromTwitchIDsResult& operator=(FGetPlayFabIDsFromTwitchIDsResult&& src) = default;
+
         FGetPlayFabIDsFromTwitchIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromTwitchIDsResult()
         {
             readFromValue(obj);
@@ -7444,7 +10428,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromTwitchIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromXboxLiveIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7466,6 +10456,15 @@ namespace ClientModels
             XboxLiveAccountIDs(src.XboxLiveAccountIDs)
             {}
 
+        FGetPlayFabIDsFromXboxLiveIDsRequest(FGetPlayFabIDsFromXboxLiveIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Sandbox(MoveTemp(src.Sandbox)),
+            XboxLiveAccountIDs(MoveTemp(src.XboxLiveAccountIDs))
+            {}
+
+        FGetPlayFabIDsFromXboxLiveIDsRequest& operator=(const FGetPlayFabIDsFromXboxLiveIDsRequest& src) = default;
+        FGetPlayFabIDsFromXboxLiveIDsRequest& operator=(FGetPlayFabIDsFromXboxLiveIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromXboxLiveIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromXboxLiveIDsRequest()
         {
             readFromValue(obj);
@@ -7474,7 +10473,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromXboxLiveIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FXboxLiveAccountPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -7497,6 +10502,15 @@ namespace ClientModels
             XboxLiveAccountId(src.XboxLiveAccountId)
             {}
 
+        FXboxLiveAccountPlayFabIdPair(FXboxLiveAccountPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            XboxLiveAccountId(MoveTemp(src.XboxLiveAccountId))
+            {}
+
+        FXboxLiveAccountPlayFabIdPair& operator=(const FXboxLiveAccountPlayFabIdPair& src) = default;
+        FXboxLiveAccountPlayFabIdPair& operator=(FXboxLiveAccountPlayFabIdPair&& src) = default;
+
         FXboxLiveAccountPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FXboxLiveAccountPlayFabIdPair()
         {
             readFromValue(obj);
@@ -7505,7 +10519,13 @@ namespace ClientModels
         ~FXboxLiveAccountPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromXboxLiveIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7522,6 +10542,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromXboxLiveIDsResult(FGetPlayFabIDsFromXboxLiveIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromXboxLiveIDsResult& operator=(const FGetPlayFabIDsFromXboxLiveIDsResult& src) = default;
+        FGetPlayFabIDsFromXboxLiveIDsResult& operator=(FGetPlayFabIDsFromXboxLiveIDsResult&& src) = default;
+
         FGetPlayFabIDsFromXboxLiveIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromXboxLiveIDsResult()
         {
             readFromValue(obj);
@@ -7530,7 +10558,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromXboxLiveIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPublisherDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7547,6 +10581,14 @@ namespace ClientModels
             Keys(src.Keys)
             {}
 
+        FGetPublisherDataRequest(FGetPublisherDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Keys(MoveTemp(src.Keys))
+            {}
+
+        FGetPublisherDataRequest& operator=(const FGetPublisherDataRequest& src) = default;
+        FGetPublisherDataRequest& operator=(FGetPublisherDataRequest&& src) = default;
+
         FGetPublisherDataRequest(const TSharedPtr<FJsonObject>& obj) : FGetPublisherDataRequest()
         {
             readFromValue(obj);
@@ -7555,7 +10597,13 @@ namespace ClientModels
         ~FGetPublisherDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPublisherDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -7572,6 +10620,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPublisherDataResult(FGetPublisherDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPublisherDataResult& operator=(const FGetPublisherDataResult& src) = default;
+        FGetPublisherDataResult& operator=(FGetPublisherDataResult&& src) = default;
+
         FGetPublisherDataResult(const TSharedPtr<FJsonObject>& obj) : FGetPublisherDataResult()
         {
             readFromValue(obj);
@@ -7580,7 +10636,13 @@ namespace ClientModels
         ~FGetPublisherDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPurchaseRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7598,6 +10660,14 @@ namespace ClientModels
             OrderId(src.OrderId)
             {}
 
+        FGetPurchaseRequest(FGetPurchaseRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            OrderId(MoveTemp(src.OrderId))
+            {}
+
+        FGetPurchaseRequest& operator=(const FGetPurchaseRequest& src) = default;
+        FGetPurchaseRequest& operator=(FGetPurchaseRequest&& src) = default;
+
         FGetPurchaseRequest(const TSharedPtr<FJsonObject>& obj) : FGetPurchaseRequest()
         {
             readFromValue(obj);
@@ -7606,7 +10676,13 @@ namespace ClientModels
         ~FGetPurchaseRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPurchaseResult : public PlayFab::FPlayFabCppResultCommon
@@ -7644,6 +10720,18 @@ namespace ClientModels
             TransactionStatus(src.TransactionStatus)
             {}
 
+        FGetPurchaseResult(FGetPurchaseResult&& src) :
+            FPlayFabCppResultCommon(),
+            OrderId(MoveTemp(src.OrderId)),
+            PaymentProvider(MoveTemp(src.PaymentProvider)),
+            PurchaseDate(MoveTemp(src.PurchaseDate)),
+            TransactionId(MoveTemp(src.TransactionId)),
+            TransactionStatus(MoveTemp(src.TransactionStatus))
+            {}
+
+        FGetPurchaseResult& operator=(const FGetPurchaseResult& src) = default;
+        FGetPurchaseResult& operator=(FGetPurchaseResult&& src) = default;
+
         FGetPurchaseResult(const TSharedPtr<FJsonObject>& obj) : FGetPurchaseResult()
         {
             readFromValue(obj);
@@ -7652,7 +10740,13 @@ namespace ClientModels
         ~FGetPurchaseResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetSharedGroupDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7682,6 +10776,16 @@ namespace ClientModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FGetSharedGroupDataRequest(FGetSharedGroupDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            GetMembers(MoveTemp(src.GetMembers)),
+            Keys(MoveTemp(src.Keys)),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FGetSharedGroupDataRequest& operator=(const FGetSharedGroupDataRequest& src) = default;
+        FGetSharedGroupDataRequest& operator=(FGetSharedGroupDataRequest&& src) = default;
+
         FGetSharedGroupDataRequest(const TSharedPtr<FJsonObject>& obj) : FGetSharedGroupDataRequest()
         {
             readFromValue(obj);
@@ -7690,7 +10794,13 @@ namespace ClientModels
         ~FGetSharedGroupDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSharedGroupDataRecord : public PlayFab::FPlayFabCppBaseModel
@@ -7723,6 +10833,17 @@ namespace ClientModels
             Value(src.Value)
             {}
 
+        FSharedGroupDataRecord(FSharedGroupDataRecord&& src) :
+            FPlayFabCppBaseModel(),
+            LastUpdated(MoveTemp(src.LastUpdated)),
+            LastUpdatedBy(MoveTemp(src.LastUpdatedBy)),
+            Permission(MoveTemp(src.Permission)),
+            Value(MoveTemp(src.Value))
+            {}
+
+        FSharedGroupDataRecord& operator=(const FSharedGroupDataRecord& src) = default;
+        FSharedGroupDataRecord& operator=(FSharedGroupDataRecord&& src) = default;
+
         FSharedGroupDataRecord(const TSharedPtr<FJsonObject>& obj) : FSharedGroupDataRecord()
         {
             readFromValue(obj);
@@ -7731,7 +10852,13 @@ namespace ClientModels
         ~FSharedGroupDataRecord();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetSharedGroupDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -7752,6 +10879,15 @@ namespace ClientModels
             Members(src.Members)
             {}
 
+        FGetSharedGroupDataResult(FGetSharedGroupDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data)),
+            Members(MoveTemp(src.Members))
+            {}
+
+        FGetSharedGroupDataResult& operator=(const FGetSharedGroupDataResult& src) = default;
+        FGetSharedGroupDataResult& operator=(FGetSharedGroupDataResult&& src) = default;
+
         FGetSharedGroupDataResult(const TSharedPtr<FJsonObject>& obj) : FGetSharedGroupDataResult()
         {
             readFromValue(obj);
@@ -7760,7 +10896,13 @@ namespace ClientModels
         ~FGetSharedGroupDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetStoreItemsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7783,6 +10925,15 @@ namespace ClientModels
             StoreId(src.StoreId)
             {}
 
+        FGetStoreItemsRequest(FGetStoreItemsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            StoreId(MoveTemp(src.StoreId))
+            {}
+
+        FGetStoreItemsRequest& operator=(const FGetStoreItemsRequest& src) = default;
+        FGetStoreItemsRequest& operator=(FGetStoreItemsRequest&& src) = default;
+
         FGetStoreItemsRequest(const TSharedPtr<FJsonObject>& obj) : FGetStoreItemsRequest()
         {
             readFromValue(obj);
@@ -7791,7 +10942,13 @@ namespace ClientModels
         ~FGetStoreItemsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStoreMarketingModel : public PlayFab::FPlayFabCppBaseModel
@@ -7819,6 +10976,16 @@ namespace ClientModels
             Metadata(src.Metadata)
             {}
 
+        FStoreMarketingModel(FStoreMarketingModel&& src) :
+            FPlayFabCppBaseModel(),
+            Description(MoveTemp(src.Description)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            Metadata(MoveTemp(src.Metadata))
+            {}
+
+        FStoreMarketingModel& operator=(const FStoreMarketingModel& src) = default;
+        FStoreMarketingModel& operator=(FStoreMarketingModel&& src) = default;
+
         FStoreMarketingModel(const TSharedPtr<FJsonObject>& obj) : FStoreMarketingModel()
         {
             readFromValue(obj);
@@ -7827,7 +10994,13 @@ namespace ClientModels
         ~FStoreMarketingModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum SourceType
@@ -7842,6 +11015,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeSourceTypeEnumJSON(SourceType enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeSourceTypeEnumJSON(SourceType enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API SourceType readSourceTypeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API SourceType readSourceTypeFromValue(const FString& value);
 
@@ -7881,6 +11055,18 @@ namespace ClientModels
             VirtualCurrencyPrices(src.VirtualCurrencyPrices)
             {}
 
+        FStoreItem(FStoreItem&& src) :
+            FPlayFabCppBaseModel(),
+            CustomData(MoveTemp(src.CustomData)),
+            DisplayPosition(MoveTemp(src.DisplayPosition)),
+            ItemId(MoveTemp(src.ItemId)),
+            RealCurrencyPrices(MoveTemp(src.RealCurrencyPrices)),
+            VirtualCurrencyPrices(MoveTemp(src.VirtualCurrencyPrices))
+            {}
+
+        FStoreItem& operator=(const FStoreItem& src) = default;
+        FStoreItem& operator=(FStoreItem&& src) = default;
+
         FStoreItem(const TSharedPtr<FJsonObject>& obj) : FStoreItem()
         {
             readFromValue(obj);
@@ -7889,7 +11075,13 @@ namespace ClientModels
         ~FStoreItem();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetStoreItemsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7920,12 +11112,24 @@ namespace ClientModels
         FGetStoreItemsResult(const FGetStoreItemsResult& src) :
             FPlayFabCppResultCommon(),
             CatalogVersion(src.CatalogVersion),
-            MarketingData(src.MarketingData.IsValid() ? MakeShareable(new FStoreMarketingModel(*src.MarketingData)) : nullptr),
+            MarketingData(src.MarketingData.IsValid() ? TSharedPtr<FStoreMarketingModel>(MakeShared<FStoreMarketingModel>(*src.MarketingData)) : nullptr),
             Source(src.Source),
             Store(src.Store),
             StoreId(src.StoreId)
             {}
 
+        FGetStoreItemsResult(FGetStoreItemsResult&& src) :
+            FPlayFabCppResultCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            MarketingData(MoveTemp(src.MarketingData)),
+            Source(MoveTemp(src.Source)),
+            Store(MoveTemp(src.Store)),
+            StoreId(MoveTemp(src.StoreId))
+            {}
+
+        FGetStoreItemsResult& operator=(const FGetStoreItemsResult& src) = default;
+        FGetStoreItemsResult& operator=(FGetStoreItemsResult&& src) = default;
+
         FGetStoreItemsResult(const TSharedPtr<FJsonObject>& obj) : FGetStoreItemsResult()
         {
             readFromValue(obj);
@@ -7934,7 +11138,13 @@ namespace ClientModels
         ~FGetStoreItemsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTimeRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7947,6 +11157,13 @@ namespace ClientModels
             FPlayFabCppRequestCommon()
             {}
 
+        FGetTimeRequest(FGetTimeRequest&& src) :
+            FPlayFabCppRequestCommon()
+            {}
+
+        FGetTimeRequest& operator=(const FGetTimeRequest& src) = default;
+        FGetTimeRequest& operator=(FGetTimeRequest&& src) = default;
+
         FGetTimeRequest(const TSharedPtr<FJsonObject>& obj) : FGetTimeRequest()
         {
             readFromValue(obj);
@@ -7955,7 +11172,13 @@ namespace ClientModels
         ~FGetTimeRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTimeResult : public PlayFab::FPlayFabCppResultCommon
@@ -7973,6 +11196,14 @@ namespace ClientModels
             Time(src.Time)
             {}
 
+        FGetTimeResult(FGetTimeResult&& src) :
+            FPlayFabCppResultCommon(),
+            Time(MoveTemp(src.Time))
+            {}
+
+        FGetTimeResult& operator=(const FGetTimeResult& src) = default;
+        FGetTimeResult& operator=(FGetTimeResult&& src) = default;
+
         FGetTimeResult(const TSharedPtr<FJsonObject>& obj) : FGetTimeResult()
         {
             readFromValue(obj);
@@ -7981,7 +11212,13 @@ namespace ClientModels
         ~FGetTimeResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8006,6 +11243,15 @@ namespace ClientModels
             OverrideLabel(src.OverrideLabel)
             {}
 
+        FGetTitleDataRequest(FGetTitleDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Keys(MoveTemp(src.Keys)),
+            OverrideLabel(MoveTemp(src.OverrideLabel))
+            {}
+
+        FGetTitleDataRequest& operator=(const FGetTitleDataRequest& src) = default;
+        FGetTitleDataRequest& operator=(FGetTitleDataRequest&& src) = default;
+
         FGetTitleDataRequest(const TSharedPtr<FJsonObject>& obj) : FGetTitleDataRequest()
         {
             readFromValue(obj);
@@ -8014,7 +11260,13 @@ namespace ClientModels
         ~FGetTitleDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -8031,6 +11283,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetTitleDataResult(FGetTitleDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetTitleDataResult& operator=(const FGetTitleDataResult& src) = default;
+        FGetTitleDataResult& operator=(FGetTitleDataResult&& src) = default;
+
         FGetTitleDataResult(const TSharedPtr<FJsonObject>& obj) : FGetTitleDataResult()
         {
             readFromValue(obj);
@@ -8039,7 +11299,13 @@ namespace ClientModels
         ~FGetTitleDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleNewsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8057,6 +11323,14 @@ namespace ClientModels
             Count(src.Count)
             {}
 
+        FGetTitleNewsRequest(FGetTitleNewsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Count(MoveTemp(src.Count))
+            {}
+
+        FGetTitleNewsRequest& operator=(const FGetTitleNewsRequest& src) = default;
+        FGetTitleNewsRequest& operator=(FGetTitleNewsRequest&& src) = default;
+
         FGetTitleNewsRequest(const TSharedPtr<FJsonObject>& obj) : FGetTitleNewsRequest()
         {
             readFromValue(obj);
@@ -8065,7 +11339,13 @@ namespace ClientModels
         ~FGetTitleNewsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FTitleNewsItem : public PlayFab::FPlayFabCppBaseModel
@@ -8098,6 +11378,17 @@ namespace ClientModels
             Title(src.Title)
             {}
 
+        FTitleNewsItem(FTitleNewsItem&& src) :
+            FPlayFabCppBaseModel(),
+            Body(MoveTemp(src.Body)),
+            NewsId(MoveTemp(src.NewsId)),
+            Timestamp(MoveTemp(src.Timestamp)),
+            Title(MoveTemp(src.Title))
+            {}
+
+        FTitleNewsItem& operator=(const FTitleNewsItem& src) = default;
+        FTitleNewsItem& operator=(FTitleNewsItem&& src) = default;
+
         FTitleNewsItem(const TSharedPtr<FJsonObject>& obj) : FTitleNewsItem()
         {
             readFromValue(obj);
@@ -8106,7 +11397,13 @@ namespace ClientModels
         ~FTitleNewsItem();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleNewsResult : public PlayFab::FPlayFabCppResultCommon
@@ -8123,6 +11420,14 @@ namespace ClientModels
             News(src.News)
             {}
 
+        FGetTitleNewsResult(FGetTitleNewsResult&& src) :
+            FPlayFabCppResultCommon(),
+            News(MoveTemp(src.News))
+            {}
+
+        FGetTitleNewsResult& operator=(const FGetTitleNewsResult& src) = default;
+        FGetTitleNewsResult& operator=(FGetTitleNewsResult&& src) = default;
+
         FGetTitleNewsResult(const TSharedPtr<FJsonObject>& obj) : FGetTitleNewsResult()
         {
             readFromValue(obj);
@@ -8131,7 +11436,13 @@ namespace ClientModels
         ~FGetTitleNewsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitlePublicKeyRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8157,6 +11468,15 @@ namespace ClientModels
             TitleSharedSecret(src.TitleSharedSecret)
             {}
 
+        FGetTitlePublicKeyRequest(FGetTitlePublicKeyRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            TitleId(MoveTemp(src.TitleId)),
+            TitleSharedSecret(MoveTemp(src.TitleSharedSecret))
+            {}
+
+        FGetTitlePublicKeyRequest& operator=(const FGetTitlePublicKeyRequest& src) = default;
+        FGetTitlePublicKeyRequest& operator=(FGetTitlePublicKeyRequest&& src) = default;
+
         FGetTitlePublicKeyRequest(const TSharedPtr<FJsonObject>& obj) : FGetTitlePublicKeyRequest()
         {
             readFromValue(obj);
@@ -8165,7 +11485,13 @@ namespace ClientModels
         ~FGetTitlePublicKeyRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitlePublicKeyResult : public PlayFab::FPlayFabCppResultCommon
@@ -8183,6 +11509,14 @@ namespace ClientModels
             RSAPublicKey(src.RSAPublicKey)
             {}
 
+        FGetTitlePublicKeyResult(FGetTitlePublicKeyResult&& src) :
+            FPlayFabCppResultCommon(),
+            RSAPublicKey(MoveTemp(src.RSAPublicKey))
+            {}
+
+        FGetTitlePublicKeyResult& operator=(const FGetTitlePublicKeyResult& src) = default;
+        FGetTitlePublicKeyResult& operator=(FGetTitlePublicKeyResult&& src) = default;
+
         FGetTitlePublicKeyResult(const TSharedPtr<FJsonObject>& obj) : FGetTitlePublicKeyResult()
         {
             readFromValue(obj);
@@ -8191,7 +11525,13 @@ namespace ClientModels
         ~FGetTitlePublicKeyResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTradeStatusRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8214,6 +11554,15 @@ namespace ClientModels
             TradeId(src.TradeId)
             {}
 
+        FGetTradeStatusRequest(FGetTradeStatusRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            OfferingPlayerId(MoveTemp(src.OfferingPlayerId)),
+            TradeId(MoveTemp(src.TradeId))
+            {}
+
+        FGetTradeStatusRequest& operator=(const FGetTradeStatusRequest& src) = default;
+        FGetTradeStatusRequest& operator=(FGetTradeStatusRequest&& src) = default;
+
         FGetTradeStatusRequest(const TSharedPtr<FJsonObject>& obj) : FGetTradeStatusRequest()
         {
             readFromValue(obj);
@@ -8222,7 +11571,13 @@ namespace ClientModels
         ~FGetTradeStatusRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTradeStatusResponse : public PlayFab::FPlayFabCppResultCommon
@@ -8237,9 +11592,17 @@ namespace ClientModels
 
         FGetTradeStatusResponse(const FGetTradeStatusResponse& src) :
             FPlayFabCppResultCommon(),
-            Trade(src.Trade.IsValid() ? MakeShareable(new FTradeInfo(*src.Trade)) : nullptr)
+            Trade(src.Trade.IsValid() ? TSharedPtr<FTradeInfo>(MakeShared<FTradeInfo>(*src.Trade)) : nullptr)
             {}
 
+        FGetTradeStatusResponse(FGetTradeStatusResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Trade(MoveTemp(src.Trade))
+            {}
+
+        FGetTradeStatusResponse& operator=(const FGetTradeStatusResponse& src) = default;
+        FGetTradeStatusResponse& operator=(FGetTradeStatusResponse&& src) = default;
+
         FGetTradeStatusResponse(const TSharedPtr<FJsonObject>& obj) : FGetTradeStatusResponse()
         {
             readFromValue(obj);
@@ -8248,7 +11611,13 @@ namespace ClientModels
         ~FGetTradeStatusResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8281,6 +11650,16 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetUserDataRequest(FGetUserDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            IfChangedFromDataVersion(MoveTemp(src.IfChangedFromDataVersion)),
+            Keys(MoveTemp(src.Keys)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetUserDataRequest& operator=(const FGetUserDataRequest& src) = default;
+        FGetUserDataRequest& operator=(FGetUserDataRequest&& src) = default;
+
         FGetUserDataRequest(const TSharedPtr<FJsonObject>& obj) : FGetUserDataRequest()
         {
             readFromValue(obj);
@@ -8289,7 +11668,13 @@ namespace ClientModels
         ~FGetUserDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -8314,6 +11699,15 @@ namespace ClientModels
             DataVersion(src.DataVersion)
             {}
 
+        FGetUserDataResult(FGetUserDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data)),
+            DataVersion(MoveTemp(src.DataVersion))
+            {}
+
+        FGetUserDataResult& operator=(const FGetUserDataResult& src) = default;
+        FGetUserDataResult& operator=(FGetUserDataResult&& src) = default;
+
         FGetUserDataResult(const TSharedPtr<FJsonObject>& obj) : FGetUserDataResult()
         {
             readFromValue(obj);
@@ -8322,7 +11716,13 @@ namespace ClientModels
         ~FGetUserDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserInventoryRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8339,6 +11739,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FGetUserInventoryRequest(FGetUserInventoryRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FGetUserInventoryRequest& operator=(const FGetUserInventoryRequest& src) = default;
+        FGetUserInventoryRequest& operator=(FGetUserInventoryRequest&& src) = default;
+
         FGetUserInventoryRequest(const TSharedPtr<FJsonObject>& obj) : FGetUserInventoryRequest()
         {
             readFromValue(obj);
@@ -8347,7 +11755,13 @@ namespace ClientModels
         ~FGetUserInventoryRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserInventoryResult : public PlayFab::FPlayFabCppResultCommon
@@ -8372,6 +11786,16 @@ namespace ClientModels
             VirtualCurrencyRechargeTimes(src.VirtualCurrencyRechargeTimes)
             {}
 
+        FGetUserInventoryResult(FGetUserInventoryResult&& src) :
+            FPlayFabCppResultCommon(),
+            Inventory(MoveTemp(src.Inventory)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency)),
+            VirtualCurrencyRechargeTimes(MoveTemp(src.VirtualCurrencyRechargeTimes))
+            {}
+
+        FGetUserInventoryResult& operator=(const FGetUserInventoryResult& src) = default;
+        FGetUserInventoryResult& operator=(FGetUserInventoryResult&& src) = default;
+
         FGetUserInventoryResult(const TSharedPtr<FJsonObject>& obj) : FGetUserInventoryResult()
         {
             readFromValue(obj);
@@ -8380,7 +11804,13 @@ namespace ClientModels
         ~FGetUserInventoryResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetWindowsHelloChallengeRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8406,6 +11836,15 @@ namespace ClientModels
             TitleId(src.TitleId)
             {}
 
+        FGetWindowsHelloChallengeRequest(FGetWindowsHelloChallengeRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PublicKeyHint(MoveTemp(src.PublicKeyHint)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FGetWindowsHelloChallengeRequest& operator=(const FGetWindowsHelloChallengeRequest& src) = default;
+        FGetWindowsHelloChallengeRequest& operator=(FGetWindowsHelloChallengeRequest&& src) = default;
+
         FGetWindowsHelloChallengeRequest(const TSharedPtr<FJsonObject>& obj) : FGetWindowsHelloChallengeRequest()
         {
             readFromValue(obj);
@@ -8414,7 +11853,13 @@ namespace ClientModels
         ~FGetWindowsHelloChallengeRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetWindowsHelloChallengeResponse : public PlayFab::FPlayFabCppResultCommon
@@ -8432,6 +11877,14 @@ namespace ClientModels
             Challenge(src.Challenge)
             {}
 
+        FGetWindowsHelloChallengeResponse(FGetWindowsHelloChallengeResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Challenge(MoveTemp(src.Challenge))
+            {}
+
+        FGetWindowsHelloChallengeResponse& operator=(const FGetWindowsHelloChallengeResponse& src) = default;
+        FGetWindowsHelloChallengeResponse& operator=(FGetWindowsHelloChallengeResponse&& src) = default;
+
         FGetWindowsHelloChallengeResponse(const TSharedPtr<FJsonObject>& obj) : FGetWindowsHelloChallengeResponse()
         {
             readFromValue(obj);
@@ -8440,7 +11893,13 @@ namespace ClientModels
         ~FGetWindowsHelloChallengeResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGrantCharacterToUserRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8475,6 +11934,17 @@ namespace ClientModels
             ItemId(src.ItemId)
             {}
 
+        FGrantCharacterToUserRequest(FGrantCharacterToUserRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterName(MoveTemp(src.CharacterName)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ItemId(MoveTemp(src.ItemId))
+            {}
+
+        FGrantCharacterToUserRequest& operator=(const FGrantCharacterToUserRequest& src) = default;
+        FGrantCharacterToUserRequest& operator=(FGrantCharacterToUserRequest&& src) = default;
+
         FGrantCharacterToUserRequest(const TSharedPtr<FJsonObject>& obj) : FGrantCharacterToUserRequest()
         {
             readFromValue(obj);
@@ -8483,7 +11953,13 @@ namespace ClientModels
         ~FGrantCharacterToUserRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGrantCharacterToUserResult : public PlayFab::FPlayFabCppResultCommon
@@ -8511,6 +11987,16 @@ namespace ClientModels
             Result(src.Result)
             {}
 
+        FGrantCharacterToUserResult(FGrantCharacterToUserResult&& src) :
+            FPlayFabCppResultCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CharacterType(MoveTemp(src.CharacterType)),
+            Result(MoveTemp(src.Result))
+            {}
+
+        FGrantCharacterToUserResult& operator=(const FGrantCharacterToUserResult& src) = default;
+        FGrantCharacterToUserResult& operator=(FGrantCharacterToUserResult&& src) = default;
+
         FGrantCharacterToUserResult(const TSharedPtr<FJsonObject>& obj) : FGrantCharacterToUserResult()
         {
             readFromValue(obj);
@@ -8519,7 +12005,13 @@ namespace ClientModels
         ~FGrantCharacterToUserResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FItemPurchaseRequest : public PlayFab::FPlayFabCppBaseModel
@@ -8551,6 +12043,17 @@ namespace ClientModels
             UpgradeFromItems(src.UpgradeFromItems)
             {}
 
+        FItemPurchaseRequest(FItemPurchaseRequest&& src) :
+            FPlayFabCppBaseModel(),
+            Annotation(MoveTemp(src.Annotation)),
+            ItemId(MoveTemp(src.ItemId)),
+            Quantity(MoveTemp(src.Quantity)),
+            UpgradeFromItems(MoveTemp(src.UpgradeFromItems))
+            {}
+
+        FItemPurchaseRequest& operator=(const FItemPurchaseRequest& src) = default;
+        FItemPurchaseRequest& operator=(FItemPurchaseRequest&& src) = default;
+
         FItemPurchaseRequest(const TSharedPtr<FJsonObject>& obj) : FItemPurchaseRequest()
         {
             readFromValue(obj);
@@ -8559,7 +12062,13 @@ namespace ClientModels
         ~FItemPurchaseRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkAndroidDeviceIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8596,6 +12105,18 @@ namespace ClientModels
             OS(src.OS)
             {}
 
+        FLinkAndroidDeviceIDRequest(FLinkAndroidDeviceIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AndroidDevice(MoveTemp(src.AndroidDevice)),
+            AndroidDeviceId(MoveTemp(src.AndroidDeviceId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            OS(MoveTemp(src.OS))
+            {}
+
+        FLinkAndroidDeviceIDRequest& operator=(const FLinkAndroidDeviceIDRequest& src) = default;
+        FLinkAndroidDeviceIDRequest& operator=(FLinkAndroidDeviceIDRequest&& src) = default;
+
         FLinkAndroidDeviceIDRequest(const TSharedPtr<FJsonObject>& obj) : FLinkAndroidDeviceIDRequest()
         {
             readFromValue(obj);
@@ -8604,7 +12125,13 @@ namespace ClientModels
         ~FLinkAndroidDeviceIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkAndroidDeviceIDResult : public PlayFab::FPlayFabCppResultCommon
@@ -8617,6 +12144,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkAndroidDeviceIDResult(FLinkAndroidDeviceIDResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkAndroidDeviceIDResult& operator=(const FLinkAndroidDeviceIDResult& src) = default;
+        FLinkAndroidDeviceIDResult& operator=(FLinkAndroidDeviceIDResult&& src) = default;
+
         FLinkAndroidDeviceIDResult(const TSharedPtr<FJsonObject>& obj) : FLinkAndroidDeviceIDResult()
         {
             readFromValue(obj);
@@ -8625,7 +12159,13 @@ namespace ClientModels
         ~FLinkAndroidDeviceIDResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkAppleRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8655,6 +12195,16 @@ namespace ClientModels
             IdentityToken(src.IdentityToken)
             {}
 
+        FLinkAppleRequest(FLinkAppleRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            IdentityToken(MoveTemp(src.IdentityToken))
+            {}
+
+        FLinkAppleRequest& operator=(const FLinkAppleRequest& src) = default;
+        FLinkAppleRequest& operator=(FLinkAppleRequest&& src) = default;
+
         FLinkAppleRequest(const TSharedPtr<FJsonObject>& obj) : FLinkAppleRequest()
         {
             readFromValue(obj);
@@ -8663,7 +12213,13 @@ namespace ClientModels
         ~FLinkAppleRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkCustomIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8690,6 +12246,16 @@ namespace ClientModels
             ForceLink(src.ForceLink)
             {}
 
+        FLinkCustomIDRequest(FLinkCustomIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomId(MoveTemp(src.CustomId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink))
+            {}
+
+        FLinkCustomIDRequest& operator=(const FLinkCustomIDRequest& src) = default;
+        FLinkCustomIDRequest& operator=(FLinkCustomIDRequest&& src) = default;
+
         FLinkCustomIDRequest(const TSharedPtr<FJsonObject>& obj) : FLinkCustomIDRequest()
         {
             readFromValue(obj);
@@ -8698,7 +12264,13 @@ namespace ClientModels
         ~FLinkCustomIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkCustomIDResult : public PlayFab::FPlayFabCppResultCommon
@@ -8711,6 +12283,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkCustomIDResult(FLinkCustomIDResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkCustomIDResult& operator=(const FLinkCustomIDResult& src) = default;
+        FLinkCustomIDResult& operator=(FLinkCustomIDResult&& src) = default;
+
         FLinkCustomIDResult(const TSharedPtr<FJsonObject>& obj) : FLinkCustomIDResult()
         {
             readFromValue(obj);
@@ -8719,7 +12298,13 @@ namespace ClientModels
         ~FLinkCustomIDResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkFacebookAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8746,6 +12331,16 @@ namespace ClientModels
             ForceLink(src.ForceLink)
             {}
 
+        FLinkFacebookAccountRequest(FLinkFacebookAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AccessToken(MoveTemp(src.AccessToken)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink))
+            {}
+
+        FLinkFacebookAccountRequest& operator=(const FLinkFacebookAccountRequest& src) = default;
+        FLinkFacebookAccountRequest& operator=(FLinkFacebookAccountRequest&& src) = default;
+
         FLinkFacebookAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkFacebookAccountRequest()
         {
             readFromValue(obj);
@@ -8754,7 +12349,13 @@ namespace ClientModels
         ~FLinkFacebookAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkFacebookAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -8767,6 +12368,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkFacebookAccountResult(FLinkFacebookAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkFacebookAccountResult& operator=(const FLinkFacebookAccountResult& src) = default;
+        FLinkFacebookAccountResult& operator=(FLinkFacebookAccountResult&& src) = default;
+
         FLinkFacebookAccountResult(const TSharedPtr<FJsonObject>& obj) : FLinkFacebookAccountResult()
         {
             readFromValue(obj);
@@ -8775,7 +12383,13 @@ namespace ClientModels
         ~FLinkFacebookAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkFacebookInstantGamesIdRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8802,6 +12416,16 @@ namespace ClientModels
             ForceLink(src.ForceLink)
             {}
 
+        FLinkFacebookInstantGamesIdRequest(FLinkFacebookInstantGamesIdRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            FacebookInstantGamesSignature(MoveTemp(src.FacebookInstantGamesSignature)),
+            ForceLink(MoveTemp(src.ForceLink))
+            {}
+
+        FLinkFacebookInstantGamesIdRequest& operator=(const FLinkFacebookInstantGamesIdRequest& src) = default;
+        FLinkFacebookInstantGamesIdRequest& operator=(FLinkFacebookInstantGamesIdRequest&& src) = default;
+
         FLinkFacebookInstantGamesIdRequest(const TSharedPtr<FJsonObject>& obj) : FLinkFacebookInstantGamesIdRequest()
         {
             readFromValue(obj);
@@ -8810,7 +12434,13 @@ namespace ClientModels
         ~FLinkFacebookInstantGamesIdRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkFacebookInstantGamesIdResult : public PlayFab::FPlayFabCppResultCommon
@@ -8819,10 +12449,17 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
-        FLinkFacebookInstantGamesIdResult(const FLinkFacebookInstantGamesIdResult& src) :
+        FLinkFacebookInstantGamesIdResult(const FLinkFacebookInstantGamesIdResult& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkFacebookInstantGamesIdResult(FLinkFacebookInstantGamesIdResult&& src) :
             FPlayFabCppResultCommon()
             {}
 
+        FLinkFacebookInstantGamesIdResult& operator=(const FLinkFacebookInstantGamesIdResult& src) = default;
+        FLinkFacebookInstantGamesIdResult& operator=(FLinkFacebookInstantGamesIdResult&& src) = default;
+
         FLinkFacebookInstantGamesIdResult(const TSharedPtr<FJsonObject>& obj) : FLinkFacebookInstantGamesIdResult()
         {
             readFromValue(obj);
@@ -8831,7 +12468,13 @@ namespace ClientModels
         ~FLinkFacebookInstantGamesIdResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkGameCenterAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8881,6 +12524,20 @@ namespace ClientModels
             Timestamp(src.Timestamp)
             {}
 
+        FLinkGameCenterAccountRequest(FLinkGameCenterAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            GameCenterId(MoveTemp(src.GameCenterId)),
+            PublicKeyUrl(MoveTemp(src.PublicKeyUrl)),
+            Salt(MoveTemp(src.Salt)),
+            Signature(MoveTemp(src.Signature)),
+            Timestamp(MoveTemp(src.Timestamp))
+            {}
+
+        FLinkGameCenterAccountRequest& operator=(const FLinkGameCenterAccountRequest& src) = default;
+        FLinkGameCenterAccountRequest& operator=(FLinkGameCenterAccountRequest&& src) = default;
+
         FLinkGameCenterAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkGameCenterAccountRequest()
         {
             readFromValue(obj);
@@ -8889,7 +12546,13 @@ namespace ClientModels
         ~FLinkGameCenterAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkGameCenterAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -8902,6 +12565,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkGameCenterAccountResult(FLinkGameCenterAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkGameCenterAccountResult& operator=(const FLinkGameCenterAccountResult& src) = default;
+        FLinkGameCenterAccountResult& operator=(FLinkGameCenterAccountResult&& src) = default;
+
         FLinkGameCenterAccountResult(const TSharedPtr<FJsonObject>& obj) : FLinkGameCenterAccountResult()
         {
             readFromValue(obj);
@@ -8910,7 +12580,13 @@ namespace ClientModels
         ~FLinkGameCenterAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkGoogleAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8940,6 +12616,16 @@ namespace ClientModels
             ServerAuthCode(src.ServerAuthCode)
             {}
 
+        FLinkGoogleAccountRequest(FLinkGoogleAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            ServerAuthCode(MoveTemp(src.ServerAuthCode))
+            {}
+
+        FLinkGoogleAccountRequest& operator=(const FLinkGoogleAccountRequest& src) = default;
+        FLinkGoogleAccountRequest& operator=(FLinkGoogleAccountRequest&& src) = default;
+
         FLinkGoogleAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkGoogleAccountRequest()
         {
             readFromValue(obj);
@@ -8948,7 +12634,13 @@ namespace ClientModels
         ~FLinkGoogleAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkGoogleAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -8961,6 +12653,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkGoogleAccountResult(FLinkGoogleAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkGoogleAccountResult& operator=(const FLinkGoogleAccountResult& src) = default;
+        FLinkGoogleAccountResult& operator=(FLinkGoogleAccountResult&& src) = default;
+
         FLinkGoogleAccountResult(const TSharedPtr<FJsonObject>& obj) : FLinkGoogleAccountResult()
         {
             readFromValue(obj);
@@ -8969,7 +12668,13 @@ namespace ClientModels
         ~FLinkGoogleAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkIOSDeviceIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9006,6 +12711,18 @@ namespace ClientModels
             OS(src.OS)
             {}
 
+        FLinkIOSDeviceIDRequest(FLinkIOSDeviceIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DeviceId(MoveTemp(src.DeviceId)),
+            DeviceModel(MoveTemp(src.DeviceModel)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            OS(MoveTemp(src.OS))
+            {}
+
+        FLinkIOSDeviceIDRequest& operator=(const FLinkIOSDeviceIDRequest& src) = default;
+        FLinkIOSDeviceIDRequest& operator=(FLinkIOSDeviceIDRequest&& src) = default;
+
         FLinkIOSDeviceIDRequest(const TSharedPtr<FJsonObject>& obj) : FLinkIOSDeviceIDRequest()
         {
             readFromValue(obj);
@@ -9014,7 +12731,13 @@ namespace ClientModels
         ~FLinkIOSDeviceIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkIOSDeviceIDResult : public PlayFab::FPlayFabCppResultCommon
@@ -9027,6 +12750,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkIOSDeviceIDResult(FLinkIOSDeviceIDResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkIOSDeviceIDResult& operator=(const FLinkIOSDeviceIDResult& src) = default;
+        FLinkIOSDeviceIDResult& operator=(FLinkIOSDeviceIDResult&& src) = default;
+
         FLinkIOSDeviceIDResult(const TSharedPtr<FJsonObject>& obj) : FLinkIOSDeviceIDResult()
         {
             readFromValue(obj);
@@ -9035,7 +12765,13 @@ namespace ClientModels
         ~FLinkIOSDeviceIDResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkKongregateAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9067,6 +12803,17 @@ namespace ClientModels
             KongregateId(src.KongregateId)
             {}
 
+        FLinkKongregateAccountRequest(FLinkKongregateAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AuthTicket(MoveTemp(src.AuthTicket)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            KongregateId(MoveTemp(src.KongregateId))
+            {}
+
+        FLinkKongregateAccountRequest& operator=(const FLinkKongregateAccountRequest& src) = default;
+        FLinkKongregateAccountRequest& operator=(FLinkKongregateAccountRequest&& src) = default;
+
         FLinkKongregateAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkKongregateAccountRequest()
         {
             readFromValue(obj);
@@ -9075,7 +12822,13 @@ namespace ClientModels
         ~FLinkKongregateAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkKongregateAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -9088,6 +12841,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkKongregateAccountResult(FLinkKongregateAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkKongregateAccountResult& operator=(const FLinkKongregateAccountResult& src) = default;
+        FLinkKongregateAccountResult& operator=(FLinkKongregateAccountResult&& src) = default;
+
         FLinkKongregateAccountResult(const TSharedPtr<FJsonObject>& obj) : FLinkKongregateAccountResult()
         {
             readFromValue(obj);
@@ -9096,7 +12856,13 @@ namespace ClientModels
         ~FLinkKongregateAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkNintendoServiceAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9126,6 +12892,16 @@ namespace ClientModels
             IdentityToken(src.IdentityToken)
             {}
 
+        FLinkNintendoServiceAccountRequest(FLinkNintendoServiceAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            IdentityToken(MoveTemp(src.IdentityToken))
+            {}
+
+        FLinkNintendoServiceAccountRequest& operator=(const FLinkNintendoServiceAccountRequest& src) = default;
+        FLinkNintendoServiceAccountRequest& operator=(FLinkNintendoServiceAccountRequest&& src) = default;
+
         FLinkNintendoServiceAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkNintendoServiceAccountRequest()
         {
             readFromValue(obj);
@@ -9134,7 +12910,13 @@ namespace ClientModels
         ~FLinkNintendoServiceAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkNintendoSwitchDeviceIdRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9161,6 +12943,16 @@ namespace ClientModels
             NintendoSwitchDeviceId(src.NintendoSwitchDeviceId)
             {}
 
+        FLinkNintendoSwitchDeviceIdRequest(FLinkNintendoSwitchDeviceIdRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            NintendoSwitchDeviceId(MoveTemp(src.NintendoSwitchDeviceId))
+            {}
+
+        FLinkNintendoSwitchDeviceIdRequest& operator=(const FLinkNintendoSwitchDeviceIdRequest& src) = default;
+        FLinkNintendoSwitchDeviceIdRequest& operator=(FLinkNintendoSwitchDeviceIdRequest&& src) = default;
+
         FLinkNintendoSwitchDeviceIdRequest(const TSharedPtr<FJsonObject>& obj) : FLinkNintendoSwitchDeviceIdRequest()
         {
             readFromValue(obj);
@@ -9169,7 +12961,13 @@ namespace ClientModels
         ~FLinkNintendoSwitchDeviceIdRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkNintendoSwitchDeviceIdResult : public PlayFab::FPlayFabCppResultCommon
@@ -9182,6 +12980,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkNintendoSwitchDeviceIdResult(FLinkNintendoSwitchDeviceIdResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkNintendoSwitchDeviceIdResult& operator=(const FLinkNintendoSwitchDeviceIdResult& src) = default;
+        FLinkNintendoSwitchDeviceIdResult& operator=(FLinkNintendoSwitchDeviceIdResult&& src) = default;
+
         FLinkNintendoSwitchDeviceIdResult(const TSharedPtr<FJsonObject>& obj) : FLinkNintendoSwitchDeviceIdResult()
         {
             readFromValue(obj);
@@ -9190,7 +12995,13 @@ namespace ClientModels
         ~FLinkNintendoSwitchDeviceIdResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkOpenIdConnectRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9225,6 +13036,17 @@ namespace ClientModels
             IdToken(src.IdToken)
             {}
 
+        FLinkOpenIdConnectRequest(FLinkOpenIdConnectRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ConnectionId(MoveTemp(src.ConnectionId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            IdToken(MoveTemp(src.IdToken))
+            {}
+
+        FLinkOpenIdConnectRequest& operator=(const FLinkOpenIdConnectRequest& src) = default;
+        FLinkOpenIdConnectRequest& operator=(FLinkOpenIdConnectRequest&& src) = default;
+
         FLinkOpenIdConnectRequest(const TSharedPtr<FJsonObject>& obj) : FLinkOpenIdConnectRequest()
         {
             readFromValue(obj);
@@ -9233,7 +13055,13 @@ namespace ClientModels
         ~FLinkOpenIdConnectRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkPSNAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9270,6 +13098,18 @@ namespace ClientModels
             RedirectUri(src.RedirectUri)
             {}
 
+        FLinkPSNAccountRequest(FLinkPSNAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AuthCode(MoveTemp(src.AuthCode)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            IssuerId(MoveTemp(src.IssuerId)),
+            RedirectUri(MoveTemp(src.RedirectUri))
+            {}
+
+        FLinkPSNAccountRequest& operator=(const FLinkPSNAccountRequest& src) = default;
+        FLinkPSNAccountRequest& operator=(FLinkPSNAccountRequest&& src) = default;
+
         FLinkPSNAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkPSNAccountRequest()
         {
             readFromValue(obj);
@@ -9278,7 +13118,13 @@ namespace ClientModels
         ~FLinkPSNAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkPSNAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -9291,6 +13137,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkPSNAccountResult(FLinkPSNAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkPSNAccountResult& operator=(const FLinkPSNAccountResult& src) = default;
+        FLinkPSNAccountResult& operator=(FLinkPSNAccountResult&& src) = default;
+
         FLinkPSNAccountResult(const TSharedPtr<FJsonObject>& obj) : FLinkPSNAccountResult()
         {
             readFromValue(obj);
@@ -9299,7 +13152,13 @@ namespace ClientModels
         ~FLinkPSNAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkSteamAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9329,6 +13188,16 @@ namespace ClientModels
             SteamTicket(src.SteamTicket)
             {}
 
+        FLinkSteamAccountRequest(FLinkSteamAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            SteamTicket(MoveTemp(src.SteamTicket))
+            {}
+
+        FLinkSteamAccountRequest& operator=(const FLinkSteamAccountRequest& src) = default;
+        FLinkSteamAccountRequest& operator=(FLinkSteamAccountRequest&& src) = default;
+
         FLinkSteamAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkSteamAccountRequest()
         {
             readFromValue(obj);
@@ -9337,7 +13206,13 @@ namespace ClientModels
         ~FLinkSteamAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkSteamAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -9350,6 +13225,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkSteamAccountResult(FLinkSteamAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkSteamAccountResult& operator=(const FLinkSteamAccountResult& src) = default;
+        FLinkSteamAccountResult& operator=(FLinkSteamAccountResult&& src) = default;
+
         FLinkSteamAccountResult(const TSharedPtr<FJsonObject>& obj) : FLinkSteamAccountResult()
         {
             readFromValue(obj);
@@ -9358,7 +13240,13 @@ namespace ClientModels
         ~FLinkSteamAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkTwitchAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9385,6 +13273,16 @@ namespace ClientModels
             ForceLink(src.ForceLink)
             {}
 
+        FLinkTwitchAccountRequest(FLinkTwitchAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AccessToken(MoveTemp(src.AccessToken)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink))
+            {}
+
+        FLinkTwitchAccountRequest& operator=(const FLinkTwitchAccountRequest& src) = default;
+        FLinkTwitchAccountRequest& operator=(FLinkTwitchAccountRequest&& src) = default;
+
         FLinkTwitchAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkTwitchAccountRequest()
         {
             readFromValue(obj);
@@ -9393,7 +13291,13 @@ namespace ClientModels
         ~FLinkTwitchAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkTwitchAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -9406,6 +13310,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkTwitchAccountResult(FLinkTwitchAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkTwitchAccountResult& operator=(const FLinkTwitchAccountResult& src) = default;
+        FLinkTwitchAccountResult& operator=(FLinkTwitchAccountResult&& src) = default;
+
         FLinkTwitchAccountResult(const TSharedPtr<FJsonObject>& obj) : FLinkTwitchAccountResult()
         {
             readFromValue(obj);
@@ -9414,7 +13325,13 @@ namespace ClientModels
         ~FLinkTwitchAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkWindowsHelloAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9451,6 +13368,18 @@ namespace ClientModels
             UserName(src.UserName)
             {}
 
+        FLinkWindowsHelloAccountRequest(FLinkWindowsHelloAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DeviceName(MoveTemp(src.DeviceName)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            PublicKey(MoveTemp(src.PublicKey)),
+            UserName(MoveTemp(src.UserName))
+            {}
+
+        FLinkWindowsHelloAccountRequest& operator=(const FLinkWindowsHelloAccountRequest& src) = default;
+        FLinkWindowsHelloAccountRequest& operator=(FLinkWindowsHelloAccountRequest&& src) = default;
+
         FLinkWindowsHelloAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkWindowsHelloAccountRequest()
         {
             readFromValue(obj);
@@ -9459,7 +13388,13 @@ namespace ClientModels
         ~FLinkWindowsHelloAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkWindowsHelloAccountResponse : public PlayFab::FPlayFabCppResultCommon
@@ -9472,6 +13407,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkWindowsHelloAccountResponse(FLinkWindowsHelloAccountResponse&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkWindowsHelloAccountResponse& operator=(const FLinkWindowsHelloAccountResponse& src) = default;
+        FLinkWindowsHelloAccountResponse& operator=(FLinkWindowsHelloAccountResponse&& src) = default;
+
         FLinkWindowsHelloAccountResponse(const TSharedPtr<FJsonObject>& obj) : FLinkWindowsHelloAccountResponse()
         {
             readFromValue(obj);
@@ -9480,7 +13422,13 @@ namespace ClientModels
         ~FLinkWindowsHelloAccountResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkXboxAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9507,6 +13455,16 @@ namespace ClientModels
             XboxToken(src.XboxToken)
             {}
 
+        FLinkXboxAccountRequest(FLinkXboxAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            XboxToken(MoveTemp(src.XboxToken))
+            {}
+
+        FLinkXboxAccountRequest& operator=(const FLinkXboxAccountRequest& src) = default;
+        FLinkXboxAccountRequest& operator=(FLinkXboxAccountRequest&& src) = default;
+
         FLinkXboxAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkXboxAccountRequest()
         {
             readFromValue(obj);
@@ -9515,7 +13473,13 @@ namespace ClientModels
         ~FLinkXboxAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkXboxAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -9528,6 +13492,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkXboxAccountResult(FLinkXboxAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkXboxAccountResult& operator=(const FLinkXboxAccountResult& src) = default;
+        FLinkXboxAccountResult& operator=(FLinkXboxAccountResult&& src) = default;
+
         FLinkXboxAccountResult(const TSharedPtr<FJsonObject>& obj) : FLinkXboxAccountResult()
         {
             readFromValue(obj);
@@ -9536,7 +13507,13 @@ namespace ClientModels
         ~FLinkXboxAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListUsersCharactersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9554,6 +13531,14 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FListUsersCharactersRequest(FListUsersCharactersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FListUsersCharactersRequest& operator=(const FListUsersCharactersRequest& src) = default;
+        FListUsersCharactersRequest& operator=(FListUsersCharactersRequest&& src) = default;
+
         FListUsersCharactersRequest(const TSharedPtr<FJsonObject>& obj) : FListUsersCharactersRequest()
         {
             readFromValue(obj);
@@ -9562,7 +13547,13 @@ namespace ClientModels
         ~FListUsersCharactersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListUsersCharactersResult : public PlayFab::FPlayFabCppResultCommon
@@ -9579,6 +13570,14 @@ namespace ClientModels
             Characters(src.Characters)
             {}
 
+        FListUsersCharactersResult(FListUsersCharactersResult&& src) :
+            FPlayFabCppResultCommon(),
+            Characters(MoveTemp(src.Characters))
+            {}
+
+        FListUsersCharactersResult& operator=(const FListUsersCharactersResult& src) = default;
+        FListUsersCharactersResult& operator=(FListUsersCharactersResult&& src) = default;
+
         FListUsersCharactersResult(const TSharedPtr<FJsonObject>& obj) : FListUsersCharactersResult()
         {
             readFromValue(obj);
@@ -9587,7 +13586,13 @@ namespace ClientModels
         ~FListUsersCharactersResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserSettings : public PlayFab::FPlayFabCppBaseModel
@@ -9615,6 +13620,16 @@ namespace ClientModels
             NeedsAttribution(src.NeedsAttribution)
             {}
 
+        FUserSettings(FUserSettings&& src) :
+            FPlayFabCppBaseModel(),
+            GatherDeviceInfo(MoveTemp(src.GatherDeviceInfo)),
+            GatherFocusInfo(MoveTemp(src.GatherFocusInfo)),
+            NeedsAttribution(MoveTemp(src.NeedsAttribution))
+            {}
+
+        FUserSettings& operator=(const FUserSettings& src) = default;
+        FUserSettings& operator=(FUserSettings&& src) = default;
+
         FUserSettings(const TSharedPtr<FJsonObject>& obj) : FUserSettings()
         {
             readFromValue(obj);
@@ -9623,7 +13638,13 @@ namespace ClientModels
         ~FUserSettings();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FVariable : public PlayFab::FPlayFabCppBaseModel
@@ -9646,6 +13667,15 @@ namespace ClientModels
             Value(src.Value)
             {}
 
+        FVariable(FVariable&& src) :
+            FPlayFabCppBaseModel(),
+            Name(MoveTemp(src.Name)),
+            Value(MoveTemp(src.Value))
+            {}
+
+        FVariable& operator=(const FVariable& src) = default;
+        FVariable& operator=(FVariable&& src) = default;
+
         FVariable(const TSharedPtr<FJsonObject>& obj) : FVariable()
         {
             readFromValue(obj);
@@ -9654,7 +13684,13 @@ namespace ClientModels
         ~FVariable();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FTreatmentAssignment : public PlayFab::FPlayFabCppBaseModel
@@ -9675,6 +13711,15 @@ namespace ClientModels
             Variants(src.Variants)
             {}
 
+        FTreatmentAssignment(FTreatmentAssignment&& src) :
+            FPlayFabCppBaseModel(),
+            Variables(MoveTemp(src.Variables)),
+            Variants(MoveTemp(src.Variants))
+            {}
+
+        FTreatmentAssignment& operator=(const FTreatmentAssignment& src) = default;
+        FTreatmentAssignment& operator=(FTreatmentAssignment&& src) = default;
+
         FTreatmentAssignment(const TSharedPtr<FJsonObject>& obj) : FTreatmentAssignment()
         {
             readFromValue(obj);
@@ -9683,7 +13728,13 @@ namespace ClientModels
         ~FTreatmentAssignment();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginResult : public PlayFab::FPlayFabLoginResultCommon
@@ -9729,16 +13780,31 @@ namespace ClientModels
 
         FLoginResult(const FLoginResult& src) :
             FPlayFabLoginResultCommon(),
-            EntityToken(src.EntityToken.IsValid() ? MakeShareable(new FEntityTokenResponse(*src.EntityToken)) : nullptr),
-            InfoResultPayload(src.InfoResultPayload.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoResultPayload(*src.InfoResultPayload)) : nullptr),
+            EntityToken(src.EntityToken.IsValid() ? TSharedPtr<FEntityTokenResponse>(MakeShared<FEntityTokenResponse>(*src.EntityToken)) : nullptr),
+            InfoResultPayload(src.InfoResultPayload.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoResultPayload>(MakeShared<FGetPlayerCombinedInfoResultPayload>(*src.InfoResultPayload)) : nullptr),
             LastLoginTime(src.LastLoginTime),
             NewlyCreated(src.NewlyCreated),
             PlayFabId(src.PlayFabId),
             SessionTicket(src.SessionTicket),
-            SettingsForUser(src.SettingsForUser.IsValid() ? MakeShareable(new FUserSettings(*src.SettingsForUser)) : nullptr),
-            pfTreatmentAssignment(src.pfTreatmentAssignment.IsValid() ? MakeShareable(new FTreatmentAssignment(*src.pfTreatmentAssignment)) : nullptr)
+            SettingsForUser(src.SettingsForUser.IsValid() ? TSharedPtr<FUserSettings>(MakeShared<FUserSettings>(*src.SettingsForUser)) : nullptr),
+            pfTreatmentAssignment(src.pfTreatmentAssignment.IsValid() ? TSharedPtr<FTreatmentAssignment>(MakeShared<FTreatmentAssignment>(*src.pfTreatmentAssignment)) : nullptr)
+            {}
+
+        FLoginResult(FLoginResult&& src) :
+            FPlayFabLoginResultCommon(),
+            EntityToken(MoveTemp(src.EntityToken)),
+            InfoResultPayload(MoveTemp(src.InfoResultPayload)),
+            LastLoginTime(MoveTemp(src.LastLoginTime)),
+            NewlyCreated(MoveTemp(src.NewlyCreated)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            SessionTicket(MoveTemp(src.SessionTicket)),
+            SettingsForUser(MoveTemp(src.SettingsForUser)),
+            pfTreatmentAssignment(MoveTemp(src.pfTreatmentAssignment))
             {}
 
+        FLoginResult& operator=(const FLoginResult& src) = default;
+        FLoginResult& operator=(FLoginResult&& src) = default;
+
         FLoginResult(const TSharedPtr<FJsonObject>& obj) : FLoginResult()
         {
             readFromValue(obj);
@@ -9747,7 +13813,13 @@ namespace ClientModels
         ~FLoginResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithAndroidDeviceIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9801,12 +13873,28 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             OS(src.OS),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithAndroidDeviceIDRequest(FLoginWithAndroidDeviceIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AndroidDevice(MoveTemp(src.AndroidDevice)),
+            AndroidDeviceId(MoveTemp(src.AndroidDeviceId)),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            OS(MoveTemp(src.OS)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithAndroidDeviceIDRequest& operator=(const FLoginWithAndroidDeviceIDRequest& src) = default;
+        FLoginWithAndroidDeviceIDRequest& operator=(FLoginWithAndroidDeviceIDRequest&& src) = default;
+
         FLoginWithAndroidDeviceIDRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithAndroidDeviceIDRequest()
         {
             readFromValue(obj);
@@ -9815,7 +13903,13 @@ namespace ClientModels
         ~FLoginWithAndroidDeviceIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithAppleRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9863,11 +13957,25 @@ namespace ClientModels
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
             IdentityToken(src.IdentityToken),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithAppleRequest(FLoginWithAppleRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            IdentityToken(MoveTemp(src.IdentityToken)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithAppleRequest& operator=(const FLoginWithAppleRequest& src) = default;
+        FLoginWithAppleRequest& operator=(FLoginWithAppleRequest&& src) = default;
+
         FLoginWithAppleRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithAppleRequest()
         {
             readFromValue(obj);
@@ -9876,7 +13984,13 @@ namespace ClientModels
         ~FLoginWithAppleRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithCustomIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9921,11 +14035,25 @@ namespace ClientModels
             CustomId(src.CustomId),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithCustomIDRequest(FLoginWithCustomIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomId(MoveTemp(src.CustomId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithCustomIDRequest& operator=(const FLoginWithCustomIDRequest& src) = default;
+        FLoginWithCustomIDRequest& operator=(FLoginWithCustomIDRequest&& src) = default;
+
         FLoginWithCustomIDRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithCustomIDRequest()
         {
             readFromValue(obj);
@@ -9934,7 +14062,13 @@ namespace ClientModels
         ~FLoginWithCustomIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithEmailAddressRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9969,11 +14103,23 @@ namespace ClientModels
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
             Email(src.Email),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             Password(src.Password),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithEmailAddressRequest(FLoginWithEmailAddressRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Email(MoveTemp(src.Email)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            Password(MoveTemp(src.Password)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithEmailAddressRequest& operator=(const FLoginWithEmailAddressRequest& src) = default;
+        FLoginWithEmailAddressRequest& operator=(FLoginWithEmailAddressRequest&& src) = default;
+
         FLoginWithEmailAddressRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithEmailAddressRequest()
         {
             readFromValue(obj);
@@ -9982,7 +14128,13 @@ namespace ClientModels
         ~FLoginWithEmailAddressRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithFacebookInstantGamesIdRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10027,11 +14179,25 @@ namespace ClientModels
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
             FacebookInstantGamesSignature(src.FacebookInstantGamesSignature),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithFacebookInstantGamesIdRequest(FLoginWithFacebookInstantGamesIdRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            FacebookInstantGamesSignature(MoveTemp(src.FacebookInstantGamesSignature)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithFacebookInstantGamesIdRequest& operator=(const FLoginWithFacebookInstantGamesIdRequest& src) = default;
+        FLoginWithFacebookInstantGamesIdRequest& operator=(FLoginWithFacebookInstantGamesIdRequest&& src) = default;
+
         FLoginWithFacebookInstantGamesIdRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithFacebookInstantGamesIdRequest()
         {
             readFromValue(obj);
@@ -10040,7 +14206,13 @@ namespace ClientModels
         ~FLoginWithFacebookInstantGamesIdRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithFacebookRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10085,11 +14257,25 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithFacebookRequest(FLoginWithFacebookRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AccessToken(MoveTemp(src.AccessToken)),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithFacebookRequest& operator=(const FLoginWithFacebookRequest& src) = default;
+        FLoginWithFacebookRequest& operator=(FLoginWithFacebookRequest&& src) = default;
+
         FLoginWithFacebookRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithFacebookRequest()
         {
             readFromValue(obj);
@@ -10098,7 +14284,13 @@ namespace ClientModels
         ~FLoginWithFacebookRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithGameCenterRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10161,7 +14353,7 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerId(src.PlayerId),
             PlayerSecret(src.PlayerSecret),
             PublicKeyUrl(src.PublicKeyUrl),
@@ -10171,6 +14363,24 @@ namespace ClientModels
             TitleId(src.TitleId)
             {}
 
+        FLoginWithGameCenterRequest(FLoginWithGameCenterRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerId(MoveTemp(src.PlayerId)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            PublicKeyUrl(MoveTemp(src.PublicKeyUrl)),
+            Salt(MoveTemp(src.Salt)),
+            Signature(MoveTemp(src.Signature)),
+            Timestamp(MoveTemp(src.Timestamp)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithGameCenterRequest& operator=(const FLoginWithGameCenterRequest& src) = default;
+        FLoginWithGameCenterRequest& operator=(FLoginWithGameCenterRequest&& src) = default;
+
         FLoginWithGameCenterRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithGameCenterRequest()
         {
             readFromValue(obj);
@@ -10179,7 +14389,13 @@ namespace ClientModels
         ~FLoginWithGameCenterRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithGoogleAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10226,12 +14442,26 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             ServerAuthCode(src.ServerAuthCode),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithGoogleAccountRequest(FLoginWithGoogleAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            ServerAuthCode(MoveTemp(src.ServerAuthCode)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithGoogleAccountRequest& operator=(const FLoginWithGoogleAccountRequest& src) = default;
+        FLoginWithGoogleAccountRequest& operator=(FLoginWithGoogleAccountRequest&& src) = default;
+
         FLoginWithGoogleAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithGoogleAccountRequest()
         {
             readFromValue(obj);
@@ -10240,7 +14470,13 @@ namespace ClientModels
         ~FLoginWithGoogleAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithIOSDeviceIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10294,12 +14530,28 @@ namespace ClientModels
             DeviceId(src.DeviceId),
             DeviceModel(src.DeviceModel),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             OS(src.OS),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithIOSDeviceIDRequest(FLoginWithIOSDeviceIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DeviceId(MoveTemp(src.DeviceId)),
+            DeviceModel(MoveTemp(src.DeviceModel)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            OS(MoveTemp(src.OS)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithIOSDeviceIDRequest& operator=(const FLoginWithIOSDeviceIDRequest& src) = default;
+        FLoginWithIOSDeviceIDRequest& operator=(FLoginWithIOSDeviceIDRequest&& src) = default;
+
         FLoginWithIOSDeviceIDRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithIOSDeviceIDRequest()
         {
             readFromValue(obj);
@@ -10308,7 +14560,13 @@ namespace ClientModels
         ~FLoginWithIOSDeviceIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithKongregateRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10357,12 +14615,27 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             KongregateId(src.KongregateId),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithKongregateRequest(FLoginWithKongregateRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AuthTicket(MoveTemp(src.AuthTicket)),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            KongregateId(MoveTemp(src.KongregateId)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithKongregateRequest& operator=(const FLoginWithKongregateRequest& src) = default;
+        FLoginWithKongregateRequest& operator=(FLoginWithKongregateRequest&& src) = default;
+
         FLoginWithKongregateRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithKongregateRequest()
         {
             readFromValue(obj);
@@ -10371,7 +14644,13 @@ namespace ClientModels
         ~FLoginWithKongregateRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithNintendoServiceAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10416,11 +14695,25 @@ namespace ClientModels
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
             IdentityToken(src.IdentityToken),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithNintendoServiceAccountRequest(FLoginWithNintendoServiceAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            IdentityToken(MoveTemp(src.IdentityToken)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithNintendoServiceAccountRequest& operator=(const FLoginWithNintendoServiceAccountRequest& src) = default;
+        FLoginWithNintendoServiceAccountRequest& operator=(FLoginWithNintendoServiceAccountRequest&& src) = default;
+
         FLoginWithNintendoServiceAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithNintendoServiceAccountRequest()
         {
             readFromValue(obj);
@@ -10429,7 +14722,13 @@ namespace ClientModels
         ~FLoginWithNintendoServiceAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithNintendoSwitchDeviceIdRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10473,12 +14772,26 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             NintendoSwitchDeviceId(src.NintendoSwitchDeviceId),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithNintendoSwitchDeviceIdRequest(FLoginWithNintendoSwitchDeviceIdRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            NintendoSwitchDeviceId(MoveTemp(src.NintendoSwitchDeviceId)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithNintendoSwitchDeviceIdRequest& operator=(const FLoginWithNintendoSwitchDeviceIdRequest& src) = default;
+        FLoginWithNintendoSwitchDeviceIdRequest& operator=(FLoginWithNintendoSwitchDeviceIdRequest&& src) = default;
+
         FLoginWithNintendoSwitchDeviceIdRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithNintendoSwitchDeviceIdRequest()
         {
             readFromValue(obj);
@@ -10487,7 +14800,13 @@ namespace ClientModels
         ~FLoginWithNintendoSwitchDeviceIdRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithOpenIdConnectRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10540,11 +14859,26 @@ namespace ClientModels
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
             IdToken(src.IdToken),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithOpenIdConnectRequest(FLoginWithOpenIdConnectRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ConnectionId(MoveTemp(src.ConnectionId)),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            IdToken(MoveTemp(src.IdToken)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithOpenIdConnectRequest& operator=(const FLoginWithOpenIdConnectRequest& src) = default;
+        FLoginWithOpenIdConnectRequest& operator=(FLoginWithOpenIdConnectRequest&& src) = default;
+
         FLoginWithOpenIdConnectRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithOpenIdConnectRequest()
         {
             readFromValue(obj);
@@ -10553,7 +14887,13 @@ namespace ClientModels
         ~FLoginWithOpenIdConnectRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithPlayFabRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10587,12 +14927,24 @@ namespace ClientModels
         FLoginWithPlayFabRequest(const FLoginWithPlayFabRequest& src) :
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             Password(src.Password),
             TitleId(src.TitleId),
             Username(src.Username)
             {}
 
+        FLoginWithPlayFabRequest(FLoginWithPlayFabRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            Password(MoveTemp(src.Password)),
+            TitleId(MoveTemp(src.TitleId)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FLoginWithPlayFabRequest& operator=(const FLoginWithPlayFabRequest& src) = default;
+        FLoginWithPlayFabRequest& operator=(FLoginWithPlayFabRequest&& src) = default;
+
         FLoginWithPlayFabRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithPlayFabRequest()
         {
             readFromValue(obj);
@@ -10601,7 +14953,13 @@ namespace ClientModels
         ~FLoginWithPlayFabRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithPSNRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10654,13 +15012,29 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             IssuerId(src.IssuerId),
             PlayerSecret(src.PlayerSecret),
             RedirectUri(src.RedirectUri),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithPSNRequest(FLoginWithPSNRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AuthCode(MoveTemp(src.AuthCode)),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            IssuerId(MoveTemp(src.IssuerId)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            RedirectUri(MoveTemp(src.RedirectUri)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithPSNRequest& operator=(const FLoginWithPSNRequest& src) = default;
+        FLoginWithPSNRequest& operator=(FLoginWithPSNRequest&& src) = default;
+
         FLoginWithPSNRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithPSNRequest()
         {
             readFromValue(obj);
@@ -10669,7 +15043,13 @@ namespace ClientModels
         ~FLoginWithPSNRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithSteamRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10716,12 +15096,26 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             SteamTicket(src.SteamTicket),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithSteamRequest(FLoginWithSteamRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            SteamTicket(MoveTemp(src.SteamTicket)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithSteamRequest& operator=(const FLoginWithSteamRequest& src) = default;
+        FLoginWithSteamRequest& operator=(FLoginWithSteamRequest&& src) = default;
+
         FLoginWithSteamRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithSteamRequest()
         {
             readFromValue(obj);
@@ -10730,7 +15124,13 @@ namespace ClientModels
         ~FLoginWithSteamRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithTwitchRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10775,11 +15175,25 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithTwitchRequest(FLoginWithTwitchRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AccessToken(MoveTemp(src.AccessToken)),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithTwitchRequest& operator=(const FLoginWithTwitchRequest& src) = default;
+        FLoginWithTwitchRequest& operator=(FLoginWithTwitchRequest&& src) = default;
+
         FLoginWithTwitchRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithTwitchRequest()
         {
             readFromValue(obj);
@@ -10788,7 +15202,13 @@ namespace ClientModels
         ~FLoginWithTwitchRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithWindowsHelloRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10823,11 +15243,23 @@ namespace ClientModels
             FPlayFabCppRequestCommon(),
             ChallengeSignature(src.ChallengeSignature),
             CustomTags(src.CustomTags),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PublicKeyHint(src.PublicKeyHint),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithWindowsHelloRequest(FLoginWithWindowsHelloRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ChallengeSignature(MoveTemp(src.ChallengeSignature)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PublicKeyHint(MoveTemp(src.PublicKeyHint)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithWindowsHelloRequest& operator=(const FLoginWithWindowsHelloRequest& src) = default;
+        FLoginWithWindowsHelloRequest& operator=(FLoginWithWindowsHelloRequest&& src) = default;
+
         FLoginWithWindowsHelloRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithWindowsHelloRequest()
         {
             readFromValue(obj);
@@ -10836,7 +15268,13 @@ namespace ClientModels
         ~FLoginWithWindowsHelloRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithXboxRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10880,12 +15318,26 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId),
             XboxToken(src.XboxToken)
             {}
 
+        FLoginWithXboxRequest(FLoginWithXboxRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId)),
+            XboxToken(MoveTemp(src.XboxToken))
+            {}
+
+        FLoginWithXboxRequest& operator=(const FLoginWithXboxRequest& src) = default;
+        FLoginWithXboxRequest& operator=(FLoginWithXboxRequest&& src) = default;
+
         FLoginWithXboxRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithXboxRequest()
         {
             readFromValue(obj);
@@ -10894,7 +15346,13 @@ namespace ClientModels
         ~FLoginWithXboxRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMatchmakeRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10948,9 +15406,25 @@ namespace ClientModels
             pfRegion(src.pfRegion),
             StartNewIfNoneFound(src.StartNewIfNoneFound),
             StatisticName(src.StatisticName),
-            TagFilter(src.TagFilter.IsValid() ? MakeShareable(new FCollectionFilter(*src.TagFilter)) : nullptr)
+            TagFilter(src.TagFilter.IsValid() ? TSharedPtr<FCollectionFilter>(MakeShared<FCollectionFilter>(*src.TagFilter)) : nullptr)
+            {}
+
+        FMatchmakeRequest(FMatchmakeRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildVersion(MoveTemp(src.BuildVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            GameMode(MoveTemp(src.GameMode)),
+            LobbyId(MoveTemp(src.LobbyId)),
+            pfRegion(MoveTemp(src.pfRegion)),
+            StartNewIfNoneFound(MoveTemp(src.StartNewIfNoneFound)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            TagFilter(MoveTemp(src.TagFilter))
             {}
 
+        FMatchmakeRequest& operator=(const FMatchmakeRequest& src) = default;
+        FMatchmakeRequest& operator=(FMatchmakeRequest&& src) = default;
+
         FMatchmakeRequest(const TSharedPtr<FJsonObject>& obj) : FMatchmakeRequest()
         {
             readFromValue(obj);
@@ -10959,7 +15433,13 @@ namespace ClientModels
         ~FMatchmakeRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum MatchmakeStatus
@@ -10972,6 +15452,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeMatchmakeStatusEnumJSON(MatchmakeStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeMatchmakeStatusEnumJSON(MatchmakeStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API MatchmakeStatus readMatchmakeStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API MatchmakeStatus readMatchmakeStatusFromValue(const FString& value);
 
@@ -11030,6 +15511,22 @@ namespace ClientModels
             Ticket(src.Ticket)
             {}
 
+        FMatchmakeResult(FMatchmakeResult&& src) :
+            FPlayFabCppResultCommon(),
+            Expires(MoveTemp(src.Expires)),
+            LobbyID(MoveTemp(src.LobbyID)),
+            PollWaitTimeMS(MoveTemp(src.PollWaitTimeMS)),
+            ServerIPV4Address(MoveTemp(src.ServerIPV4Address)),
+            ServerIPV6Address(MoveTemp(src.ServerIPV6Address)),
+            ServerPort(MoveTemp(src.ServerPort)),
+            ServerPublicDNSName(MoveTemp(src.ServerPublicDNSName)),
+            Status(MoveTemp(src.Status)),
+            Ticket(MoveTemp(src.Ticket))
+            {}
+
+        FMatchmakeResult& operator=(const FMatchmakeResult& src) = default;
+        FMatchmakeResult& operator=(FMatchmakeResult&& src) = default;
+
         FMatchmakeResult(const TSharedPtr<FJsonObject>& obj) : FMatchmakeResult()
         {
             readFromValue(obj);
@@ -11038,7 +15535,13 @@ namespace ClientModels
         ~FMatchmakeResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FModifyUserVirtualCurrencyResult : public PlayFab::FPlayFabCppResultCommon
@@ -11074,6 +15577,17 @@ namespace ClientModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FModifyUserVirtualCurrencyResult(FModifyUserVirtualCurrencyResult&& src) :
+            FPlayFabCppResultCommon(),
+            Balance(MoveTemp(src.Balance)),
+            BalanceChange(MoveTemp(src.BalanceChange)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FModifyUserVirtualCurrencyResult& operator=(const FModifyUserVirtualCurrencyResult& src) = default;
+        FModifyUserVirtualCurrencyResult& operator=(FModifyUserVirtualCurrencyResult&& src) = default;
+
         FModifyUserVirtualCurrencyResult(const TSharedPtr<FJsonObject>& obj) : FModifyUserVirtualCurrencyResult()
         {
             readFromValue(obj);
@@ -11082,7 +15596,13 @@ namespace ClientModels
         ~FModifyUserVirtualCurrencyResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FOpenTradeRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11110,6 +15630,16 @@ namespace ClientModels
             RequestedCatalogItemIds(src.RequestedCatalogItemIds)
             {}
 
+        FOpenTradeRequest(FOpenTradeRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AllowedPlayerIds(MoveTemp(src.AllowedPlayerIds)),
+            OfferedInventoryInstanceIds(MoveTemp(src.OfferedInventoryInstanceIds)),
+            RequestedCatalogItemIds(MoveTemp(src.RequestedCatalogItemIds))
+            {}
+
+        FOpenTradeRequest& operator=(const FOpenTradeRequest& src) = default;
+        FOpenTradeRequest& operator=(FOpenTradeRequest&& src) = default;
+
         FOpenTradeRequest(const TSharedPtr<FJsonObject>& obj) : FOpenTradeRequest()
         {
             readFromValue(obj);
@@ -11118,7 +15648,13 @@ namespace ClientModels
         ~FOpenTradeRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FOpenTradeResponse : public PlayFab::FPlayFabCppResultCommon
@@ -11133,9 +15669,17 @@ namespace ClientModels
 
         FOpenTradeResponse(const FOpenTradeResponse& src) :
             FPlayFabCppResultCommon(),
-            Trade(src.Trade.IsValid() ? MakeShareable(new FTradeInfo(*src.Trade)) : nullptr)
+            Trade(src.Trade.IsValid() ? TSharedPtr<FTradeInfo>(MakeShared<FTradeInfo>(*src.Trade)) : nullptr)
+            {}
+
+        FOpenTradeResponse(FOpenTradeResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Trade(MoveTemp(src.Trade))
             {}
 
+        FOpenTradeResponse& operator=(const FOpenTradeResponse& src) = default;
+        FOpenTradeResponse& operator=(FOpenTradeResponse&& src) = default;
+
         FOpenTradeResponse(const TSharedPtr<FJsonObject>& obj) : FOpenTradeResponse()
         {
             readFromValue(obj);
@@ -11144,7 +15688,13 @@ namespace ClientModels
         ~FOpenTradeResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPayForPurchaseRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11181,6 +15731,18 @@ namespace ClientModels
             ProviderTransactionId(src.ProviderTransactionId)
             {}
 
+        FPayForPurchaseRequest(FPayForPurchaseRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Currency(MoveTemp(src.Currency)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            OrderId(MoveTemp(src.OrderId)),
+            ProviderName(MoveTemp(src.ProviderName)),
+            ProviderTransactionId(MoveTemp(src.ProviderTransactionId))
+            {}
+
+        FPayForPurchaseRequest& operator=(const FPayForPurchaseRequest& src) = default;
+        FPayForPurchaseRequest& operator=(FPayForPurchaseRequest&& src) = default;
+
         FPayForPurchaseRequest(const TSharedPtr<FJsonObject>& obj) : FPayForPurchaseRequest()
         {
             readFromValue(obj);
@@ -11189,7 +15751,13 @@ namespace ClientModels
         ~FPayForPurchaseRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum TransactionStatus
@@ -11217,6 +15785,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeTransactionStatusEnumJSON(TransactionStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeTransactionStatusEnumJSON(TransactionStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API TransactionStatus readTransactionStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API TransactionStatus readTransactionStatusFromValue(const FString& value);
 
@@ -11278,6 +15847,23 @@ namespace ClientModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FPayForPurchaseResult(FPayForPurchaseResult&& src) :
+            FPlayFabCppResultCommon(),
+            CreditApplied(MoveTemp(src.CreditApplied)),
+            OrderId(MoveTemp(src.OrderId)),
+            ProviderData(MoveTemp(src.ProviderData)),
+            ProviderToken(MoveTemp(src.ProviderToken)),
+            PurchaseConfirmationPageURL(MoveTemp(src.PurchaseConfirmationPageURL)),
+            PurchaseCurrency(MoveTemp(src.PurchaseCurrency)),
+            PurchasePrice(MoveTemp(src.PurchasePrice)),
+            Status(MoveTemp(src.Status)),
+            VCAmount(MoveTemp(src.VCAmount)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FPayForPurchaseResult& operator=(const FPayForPurchaseResult& src) = default;
+        FPayForPurchaseResult& operator=(FPayForPurchaseResult&& src) = default;
+
         FPayForPurchaseResult(const TSharedPtr<FJsonObject>& obj) : FPayForPurchaseResult()
         {
             readFromValue(obj);
@@ -11286,7 +15872,13 @@ namespace ClientModels
         ~FPayForPurchaseResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPaymentOption : public PlayFab::FPlayFabCppBaseModel
@@ -11319,6 +15911,17 @@ namespace ClientModels
             StoreCredit(src.StoreCredit)
             {}
 
+        FPaymentOption(FPaymentOption&& src) :
+            FPlayFabCppBaseModel(),
+            Currency(MoveTemp(src.Currency)),
+            Price(MoveTemp(src.Price)),
+            ProviderName(MoveTemp(src.ProviderName)),
+            StoreCredit(MoveTemp(src.StoreCredit))
+            {}
+
+        FPaymentOption& operator=(const FPaymentOption& src) = default;
+        FPaymentOption& operator=(FPaymentOption&& src) = default;
+
         FPaymentOption(const TSharedPtr<FJsonObject>& obj) : FPaymentOption()
         {
             readFromValue(obj);
@@ -11327,7 +15930,13 @@ namespace ClientModels
         ~FPaymentOption();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPurchaseItemRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11374,6 +15983,20 @@ namespace ClientModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FPurchaseItemRequest(FPurchaseItemRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ItemId(MoveTemp(src.ItemId)),
+            Price(MoveTemp(src.Price)),
+            StoreId(MoveTemp(src.StoreId)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FPurchaseItemRequest& operator=(const FPurchaseItemRequest& src) = default;
+        FPurchaseItemRequest& operator=(FPurchaseItemRequest&& src) = default;
+
         FPurchaseItemRequest(const TSharedPtr<FJsonObject>& obj) : FPurchaseItemRequest()
         {
             readFromValue(obj);
@@ -11382,7 +16005,13 @@ namespace ClientModels
         ~FPurchaseItemRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPurchaseItemResult : public PlayFab::FPlayFabCppResultCommon
@@ -11399,6 +16028,14 @@ namespace ClientModels
             Items(src.Items)
             {}
 
+        FPurchaseItemResult(FPurchaseItemResult&& src) :
+            FPlayFabCppResultCommon(),
+            Items(MoveTemp(src.Items))
+            {}
+
+        FPurchaseItemResult& operator=(const FPurchaseItemResult& src) = default;
+        FPurchaseItemResult& operator=(FPurchaseItemResult&& src) = default;
+
         FPurchaseItemResult(const TSharedPtr<FJsonObject>& obj) : FPurchaseItemResult()
         {
             readFromValue(obj);
@@ -11407,7 +16044,13 @@ namespace ClientModels
         ~FPurchaseItemResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPurchaseReceiptFulfillment : public PlayFab::FPlayFabCppBaseModel
@@ -11444,6 +16087,17 @@ namespace ClientModels
             RecordedTransactionTotal(src.RecordedTransactionTotal)
             {}
 
+        FPurchaseReceiptFulfillment(FPurchaseReceiptFulfillment&& src) :
+            FPlayFabCppBaseModel(),
+            FulfilledItems(MoveTemp(src.FulfilledItems)),
+            RecordedPriceSource(MoveTemp(src.RecordedPriceSource)),
+            RecordedTransactionCurrency(MoveTemp(src.RecordedTransactionCurrency)),
+            RecordedTransactionTotal(MoveTemp(src.RecordedTransactionTotal))
+            {}
+
+        FPurchaseReceiptFulfillment& operator=(const FPurchaseReceiptFulfillment& src) = default;
+        FPurchaseReceiptFulfillment& operator=(FPurchaseReceiptFulfillment&& src) = default;
+
         FPurchaseReceiptFulfillment(const TSharedPtr<FJsonObject>& obj) : FPurchaseReceiptFulfillment()
         {
             readFromValue(obj);
@@ -11452,7 +16106,13 @@ namespace ClientModels
         ~FPurchaseReceiptFulfillment();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRedeemCouponRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11484,6 +16144,17 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FRedeemCouponRequest(FRedeemCouponRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CouponCode(MoveTemp(src.CouponCode)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FRedeemCouponRequest& operator=(const FRedeemCouponRequest& src) = default;
+        FRedeemCouponRequest& operator=(FRedeemCouponRequest&& src) = default;
+
         FRedeemCouponRequest(const TSharedPtr<FJsonObject>& obj) : FRedeemCouponRequest()
         {
             readFromValue(obj);
@@ -11492,7 +16163,13 @@ namespace ClientModels
         ~FRedeemCouponRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRedeemCouponResult : public PlayFab::FPlayFabCppResultCommon
@@ -11509,6 +16186,14 @@ namespace ClientModels
             GrantedItems(src.GrantedItems)
             {}
 
+        FRedeemCouponResult(FRedeemCouponResult&& src) :
+            FPlayFabCppResultCommon(),
+            GrantedItems(MoveTemp(src.GrantedItems))
+            {}
+
+        FRedeemCouponResult& operator=(const FRedeemCouponResult& src) = default;
+        FRedeemCouponResult& operator=(FRedeemCouponResult&& src) = default;
+
         FRedeemCouponResult(const TSharedPtr<FJsonObject>& obj) : FRedeemCouponResult()
         {
             readFromValue(obj);
@@ -11517,7 +16202,13 @@ namespace ClientModels
         ~FRedeemCouponResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRefreshPSNAuthTokenRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11545,6 +16236,16 @@ namespace ClientModels
             RedirectUri(src.RedirectUri)
             {}
 
+        FRefreshPSNAuthTokenRequest(FRefreshPSNAuthTokenRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AuthCode(MoveTemp(src.AuthCode)),
+            IssuerId(MoveTemp(src.IssuerId)),
+            RedirectUri(MoveTemp(src.RedirectUri))
+            {}
+
+        FRefreshPSNAuthTokenRequest& operator=(const FRefreshPSNAuthTokenRequest& src) = default;
+        FRefreshPSNAuthTokenRequest& operator=(FRefreshPSNAuthTokenRequest&& src) = default;
+
         FRefreshPSNAuthTokenRequest(const TSharedPtr<FJsonObject>& obj) : FRefreshPSNAuthTokenRequest()
         {
             readFromValue(obj);
@@ -11553,7 +16254,13 @@ namespace ClientModels
         ~FRefreshPSNAuthTokenRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRegisterForIOSPushNotificationRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11581,6 +16288,16 @@ namespace ClientModels
             SendPushNotificationConfirmation(src.SendPushNotificationConfirmation)
             {}
 
+        FRegisterForIOSPushNotificationRequest(FRegisterForIOSPushNotificationRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ConfirmationMessage(MoveTemp(src.ConfirmationMessage)),
+            DeviceToken(MoveTemp(src.DeviceToken)),
+            SendPushNotificationConfirmation(MoveTemp(src.SendPushNotificationConfirmation))
+            {}
+
+        FRegisterForIOSPushNotificationRequest& operator=(const FRegisterForIOSPushNotificationRequest& src) = default;
+        FRegisterForIOSPushNotificationRequest& operator=(FRegisterForIOSPushNotificationRequest&& src) = default;
+
         FRegisterForIOSPushNotificationRequest(const TSharedPtr<FJsonObject>& obj) : FRegisterForIOSPushNotificationRequest()
         {
             readFromValue(obj);
@@ -11589,7 +16306,13 @@ namespace ClientModels
         ~FRegisterForIOSPushNotificationRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRegisterForIOSPushNotificationResult : public PlayFab::FPlayFabCppResultCommon
@@ -11602,6 +16325,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FRegisterForIOSPushNotificationResult(FRegisterForIOSPushNotificationResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FRegisterForIOSPushNotificationResult& operator=(const FRegisterForIOSPushNotificationResult& src) = default;
+        FRegisterForIOSPushNotificationResult& operator=(FRegisterForIOSPushNotificationResult&& src) = default;
+
         FRegisterForIOSPushNotificationResult(const TSharedPtr<FJsonObject>& obj) : FRegisterForIOSPushNotificationResult()
         {
             readFromValue(obj);
@@ -11610,7 +16340,13 @@ namespace ClientModels
         ~FRegisterForIOSPushNotificationResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRegisterPlayFabUserRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11671,7 +16407,7 @@ namespace ClientModels
             DisplayName(src.DisplayName),
             Email(src.Email),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             Password(src.Password),
             PlayerSecret(src.PlayerSecret),
             RequireBothUsernameAndEmail(src.RequireBothUsernameAndEmail),
@@ -11679,6 +16415,23 @@ namespace ClientModels
             Username(src.Username)
             {}
 
+        FRegisterPlayFabUserRequest(FRegisterPlayFabUserRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            Email(MoveTemp(src.Email)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            Password(MoveTemp(src.Password)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            RequireBothUsernameAndEmail(MoveTemp(src.RequireBothUsernameAndEmail)),
+            TitleId(MoveTemp(src.TitleId)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FRegisterPlayFabUserRequest& operator=(const FRegisterPlayFabUserRequest& src) = default;
+        FRegisterPlayFabUserRequest& operator=(FRegisterPlayFabUserRequest&& src) = default;
+
         FRegisterPlayFabUserRequest(const TSharedPtr<FJsonObject>& obj) : FRegisterPlayFabUserRequest()
         {
             readFromValue(obj);
@@ -11687,7 +16440,13 @@ namespace ClientModels
         ~FRegisterPlayFabUserRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRegisterPlayFabUserResult : public PlayFab::FPlayFabCppResultCommon
@@ -11721,13 +16480,25 @@ namespace ClientModels
 
         FRegisterPlayFabUserResult(const FRegisterPlayFabUserResult& src) :
             FPlayFabCppResultCommon(),
-            EntityToken(src.EntityToken.IsValid() ? MakeShareable(new FEntityTokenResponse(*src.EntityToken)) : nullptr),
+            EntityToken(src.EntityToken.IsValid() ? TSharedPtr<FEntityTokenResponse>(MakeShared<FEntityTokenResponse>(*src.EntityToken)) : nullptr),
             PlayFabId(src.PlayFabId),
             SessionTicket(src.SessionTicket),
-            SettingsForUser(src.SettingsForUser.IsValid() ? MakeShareable(new FUserSettings(*src.SettingsForUser)) : nullptr),
+            SettingsForUser(src.SettingsForUser.IsValid() ? TSharedPtr<FUserSettings>(MakeShared<FUserSettings>(*src.SettingsForUser)) : nullptr),
             Username(src.Username)
             {}
 
+        FRegisterPlayFabUserResult(FRegisterPlayFabUserResult&& src) :
+            FPlayFabCppResultCommon(),
+            EntityToken(MoveTemp(src.EntityToken)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            SessionTicket(MoveTemp(src.SessionTicket)),
+            SettingsForUser(MoveTemp(src.SettingsForUser)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FRegisterPlayFabUserResult& operator=(const FRegisterPlayFabUserResult& src) = default;
+        FRegisterPlayFabUserResult& operator=(FRegisterPlayFabUserResult&& src) = default;
+
         FRegisterPlayFabUserResult(const TSharedPtr<FJsonObject>& obj) : FRegisterPlayFabUserResult()
         {
             readFromValue(obj);
@@ -11736,7 +16507,13 @@ namespace ClientModels
         ~FRegisterPlayFabUserResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRegisterWithWindowsHelloRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11784,13 +16561,28 @@ namespace ClientModels
             CustomTags(src.CustomTags),
             DeviceName(src.DeviceName),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             PublicKey(src.PublicKey),
             TitleId(src.TitleId),
             UserName(src.UserName)
             {}
 
+        FRegisterWithWindowsHelloRequest(FRegisterWithWindowsHelloRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DeviceName(MoveTemp(src.DeviceName)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            PublicKey(MoveTemp(src.PublicKey)),
+            TitleId(MoveTemp(src.TitleId)),
+            UserName(MoveTemp(src.UserName))
+            {}
+
+        FRegisterWithWindowsHelloRequest& operator=(const FRegisterWithWindowsHelloRequest& src) = default;
+        FRegisterWithWindowsHelloRequest& operator=(FRegisterWithWindowsHelloRequest&& src) = default;
+
         FRegisterWithWindowsHelloRequest(const TSharedPtr<FJsonObject>& obj) : FRegisterWithWindowsHelloRequest()
         {
             readFromValue(obj);
@@ -11799,7 +16591,13 @@ namespace ClientModels
         ~FRegisterWithWindowsHelloRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveContactEmailRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11816,6 +16614,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FRemoveContactEmailRequest(FRemoveContactEmailRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FRemoveContactEmailRequest& operator=(const FRemoveContactEmailRequest& src) = default;
+        FRemoveContactEmailRequest& operator=(FRemoveContactEmailRequest&& src) = default;
+
         FRemoveContactEmailRequest(const TSharedPtr<FJsonObject>& obj) : FRemoveContactEmailRequest()
         {
             readFromValue(obj);
@@ -11824,7 +16630,13 @@ namespace ClientModels
         ~FRemoveContactEmailRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveContactEmailResult : public PlayFab::FPlayFabCppResultCommon
@@ -11837,6 +16649,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FRemoveContactEmailResult(FRemoveContactEmailResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FRemoveContactEmailResult& operator=(const FRemoveContactEmailResult& src) = default;
+        FRemoveContactEmailResult& operator=(FRemoveContactEmailResult&& src) = default;
+
         FRemoveContactEmailResult(const TSharedPtr<FJsonObject>& obj) : FRemoveContactEmailResult()
         {
             readFromValue(obj);
@@ -11845,7 +16664,13 @@ namespace ClientModels
         ~FRemoveContactEmailResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveFriendRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11863,6 +16688,14 @@ namespace ClientModels
             FriendPlayFabId(src.FriendPlayFabId)
             {}
 
+        FRemoveFriendRequest(FRemoveFriendRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            FriendPlayFabId(MoveTemp(src.FriendPlayFabId))
+            {}
+
+        FRemoveFriendRequest& operator=(const FRemoveFriendRequest& src) = default;
+        FRemoveFriendRequest& operator=(FRemoveFriendRequest&& src) = default;
+
         FRemoveFriendRequest(const TSharedPtr<FJsonObject>& obj) : FRemoveFriendRequest()
         {
             readFromValue(obj);
@@ -11871,7 +16704,13 @@ namespace ClientModels
         ~FRemoveFriendRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveFriendResult : public PlayFab::FPlayFabCppResultCommon
@@ -11884,6 +16723,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FRemoveFriendResult(FRemoveFriendResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FRemoveFriendResult& operator=(const FRemoveFriendResult& src) = default;
+        FRemoveFriendResult& operator=(FRemoveFriendResult&& src) = default;
+
         FRemoveFriendResult(const TSharedPtr<FJsonObject>& obj) : FRemoveFriendResult()
         {
             readFromValue(obj);
@@ -11892,7 +16738,13 @@ namespace ClientModels
         ~FRemoveFriendResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveGenericIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11910,6 +16762,14 @@ namespace ClientModels
             GenericId(src.GenericId)
             {}
 
+        FRemoveGenericIDRequest(FRemoveGenericIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            GenericId(MoveTemp(src.GenericId))
+            {}
+
+        FRemoveGenericIDRequest& operator=(const FRemoveGenericIDRequest& src) = default;
+        FRemoveGenericIDRequest& operator=(FRemoveGenericIDRequest&& src) = default;
+
         FRemoveGenericIDRequest(const TSharedPtr<FJsonObject>& obj) : FRemoveGenericIDRequest()
         {
             readFromValue(obj);
@@ -11918,7 +16778,13 @@ namespace ClientModels
         ~FRemoveGenericIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveGenericIDResult : public PlayFab::FPlayFabCppResultCommon
@@ -11931,6 +16797,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FRemoveGenericIDResult(FRemoveGenericIDResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FRemoveGenericIDResult& operator=(const FRemoveGenericIDResult& src) = default;
+        FRemoveGenericIDResult& operator=(FRemoveGenericIDResult&& src) = default;
+
         FRemoveGenericIDResult(const TSharedPtr<FJsonObject>& obj) : FRemoveGenericIDResult()
         {
             readFromValue(obj);
@@ -11939,7 +16812,13 @@ namespace ClientModels
         ~FRemoveGenericIDResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveSharedGroupMembersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11961,6 +16840,15 @@ namespace ClientModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FRemoveSharedGroupMembersRequest(FRemoveSharedGroupMembersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabIds(MoveTemp(src.PlayFabIds)),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FRemoveSharedGroupMembersRequest& operator=(const FRemoveSharedGroupMembersRequest& src) = default;
+        FRemoveSharedGroupMembersRequest& operator=(FRemoveSharedGroupMembersRequest&& src) = default;
+
         FRemoveSharedGroupMembersRequest(const TSharedPtr<FJsonObject>& obj) : FRemoveSharedGroupMembersRequest()
         {
             readFromValue(obj);
@@ -11969,7 +16857,13 @@ namespace ClientModels
         ~FRemoveSharedGroupMembersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveSharedGroupMembersResult : public PlayFab::FPlayFabCppResultCommon
@@ -11982,6 +16876,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FRemoveSharedGroupMembersResult(FRemoveSharedGroupMembersResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FRemoveSharedGroupMembersResult& operator=(const FRemoveSharedGroupMembersResult& src) = default;
+        FRemoveSharedGroupMembersResult& operator=(FRemoveSharedGroupMembersResult&& src) = default;
+
         FRemoveSharedGroupMembersResult(const TSharedPtr<FJsonObject>& obj) : FRemoveSharedGroupMembersResult()
         {
             readFromValue(obj);
@@ -11990,7 +16891,13 @@ namespace ClientModels
         ~FRemoveSharedGroupMembersResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FReportAdActivityRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12022,6 +16929,17 @@ namespace ClientModels
             RewardId(src.RewardId)
             {}
 
+        FReportAdActivityRequest(FReportAdActivityRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Activity(MoveTemp(src.Activity)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlacementId(MoveTemp(src.PlacementId)),
+            RewardId(MoveTemp(src.RewardId))
+            {}
+
+        FReportAdActivityRequest& operator=(const FReportAdActivityRequest& src) = default;
+        FReportAdActivityRequest& operator=(FReportAdActivityRequest&& src) = default;
+
         FReportAdActivityRequest(const TSharedPtr<FJsonObject>& obj) : FReportAdActivityRequest()
         {
             readFromValue(obj);
@@ -12030,7 +16948,13 @@ namespace ClientModels
         ~FReportAdActivityRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FReportAdActivityResult : public PlayFab::FPlayFabCppResultCommon
@@ -12043,6 +16967,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FReportAdActivityResult(FReportAdActivityResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FReportAdActivityResult& operator=(const FReportAdActivityResult& src) = default;
+        FReportAdActivityResult& operator=(FReportAdActivityResult&& src) = default;
+
         FReportAdActivityResult(const TSharedPtr<FJsonObject>& obj) : FReportAdActivityResult()
         {
             readFromValue(obj);
@@ -12051,7 +16982,13 @@ namespace ClientModels
         ~FReportAdActivityResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FReportPlayerClientRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12078,6 +17015,16 @@ namespace ClientModels
             ReporteeId(src.ReporteeId)
             {}
 
+        FReportPlayerClientRequest(FReportPlayerClientRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Comment(MoveTemp(src.Comment)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ReporteeId(MoveTemp(src.ReporteeId))
+            {}
+
+        FReportPlayerClientRequest& operator=(const FReportPlayerClientRequest& src) = default;
+        FReportPlayerClientRequest& operator=(FReportPlayerClientRequest&& src) = default;
+
         FReportPlayerClientRequest(const TSharedPtr<FJsonObject>& obj) : FReportPlayerClientRequest()
         {
             readFromValue(obj);
@@ -12086,7 +17033,13 @@ namespace ClientModels
         ~FReportPlayerClientRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FReportPlayerClientResult : public PlayFab::FPlayFabCppResultCommon
@@ -12104,6 +17057,14 @@ namespace ClientModels
             SubmissionsRemaining(src.SubmissionsRemaining)
             {}
 
+        FReportPlayerClientResult(FReportPlayerClientResult&& src) :
+            FPlayFabCppResultCommon(),
+            SubmissionsRemaining(MoveTemp(src.SubmissionsRemaining))
+            {}
+
+        FReportPlayerClientResult& operator=(const FReportPlayerClientResult& src) = default;
+        FReportPlayerClientResult& operator=(FReportPlayerClientResult&& src) = default;
+
         FReportPlayerClientResult(const TSharedPtr<FJsonObject>& obj) : FReportPlayerClientResult()
         {
             readFromValue(obj);
@@ -12112,7 +17073,13 @@ namespace ClientModels
         ~FReportPlayerClientResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRestoreIOSPurchasesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12139,6 +17106,16 @@ namespace ClientModels
             ReceiptData(src.ReceiptData)
             {}
 
+        FRestoreIOSPurchasesRequest(FRestoreIOSPurchasesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ReceiptData(MoveTemp(src.ReceiptData))
+            {}
+
+        FRestoreIOSPurchasesRequest& operator=(const FRestoreIOSPurchasesRequest& src) = default;
+        FRestoreIOSPurchasesRequest& operator=(FRestoreIOSPurchasesRequest&& src) = default;
+
         FRestoreIOSPurchasesRequest(const TSharedPtr<FJsonObject>& obj) : FRestoreIOSPurchasesRequest()
         {
             readFromValue(obj);
@@ -12147,7 +17124,13 @@ namespace ClientModels
         ~FRestoreIOSPurchasesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRestoreIOSPurchasesResult : public PlayFab::FPlayFabCppResultCommon
@@ -12164,6 +17147,14 @@ namespace ClientModels
             Fulfillments(src.Fulfillments)
             {}
 
+        FRestoreIOSPurchasesResult(FRestoreIOSPurchasesResult&& src) :
+            FPlayFabCppResultCommon(),
+            Fulfillments(MoveTemp(src.Fulfillments))
+            {}
+
+        FRestoreIOSPurchasesResult& operator=(const FRestoreIOSPurchasesResult& src) = default;
+        FRestoreIOSPurchasesResult& operator=(FRestoreIOSPurchasesResult&& src) = default;
+
         FRestoreIOSPurchasesResult(const TSharedPtr<FJsonObject>& obj) : FRestoreIOSPurchasesResult()
         {
             readFromValue(obj);
@@ -12172,7 +17163,13 @@ namespace ClientModels
         ~FRestoreIOSPurchasesResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRewardAdActivityRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12199,6 +17196,16 @@ namespace ClientModels
             RewardId(src.RewardId)
             {}
 
+        FRewardAdActivityRequest(FRewardAdActivityRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlacementId(MoveTemp(src.PlacementId)),
+            RewardId(MoveTemp(src.RewardId))
+            {}
+
+        FRewardAdActivityRequest& operator=(const FRewardAdActivityRequest& src) = default;
+        FRewardAdActivityRequest& operator=(FRewardAdActivityRequest&& src) = default;
+
         FRewardAdActivityRequest(const TSharedPtr<FJsonObject>& obj) : FRewardAdActivityRequest()
         {
             readFromValue(obj);
@@ -12207,7 +17214,13 @@ namespace ClientModels
         ~FRewardAdActivityRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRewardAdActivityResult : public PlayFab::FPlayFabCppResultCommon
@@ -12251,9 +17264,23 @@ namespace ClientModels
             PlacementName(src.PlacementName),
             PlacementViewsRemaining(src.PlacementViewsRemaining),
             PlacementViewsResetMinutes(src.PlacementViewsResetMinutes),
-            RewardResults(src.RewardResults.IsValid() ? MakeShareable(new FAdRewardResults(*src.RewardResults)) : nullptr)
+            RewardResults(src.RewardResults.IsValid() ? TSharedPtr<FAdRewardResults>(MakeShared<FAdRewardResults>(*src.RewardResults)) : nullptr)
             {}
 
+        FRewardAdActivityResult(FRewardAdActivityResult&& src) :
+            FPlayFabCppResultCommon(),
+            AdActivityEventId(MoveTemp(src.AdActivityEventId)),
+            DebugResults(MoveTemp(src.DebugResults)),
+            PlacementId(MoveTemp(src.PlacementId)),
+            PlacementName(MoveTemp(src.PlacementName)),
+            PlacementViewsRemaining(MoveTemp(src.PlacementViewsRemaining)),
+            PlacementViewsResetMinutes(MoveTemp(src.PlacementViewsResetMinutes)),
+            RewardResults(MoveTemp(src.RewardResults))
+            {}
+
+        FRewardAdActivityResult& operator=(const FRewardAdActivityResult& src) = default;
+        FRewardAdActivityResult& operator=(FRewardAdActivityResult&& src) = default;
+
         FRewardAdActivityResult(const TSharedPtr<FJsonObject>& obj) : FRewardAdActivityResult()
         {
             readFromValue(obj);
@@ -12262,7 +17289,13 @@ namespace ClientModels
         ~FRewardAdActivityResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSendAccountRecoveryEmailRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12297,6 +17330,17 @@ namespace ClientModels
             TitleId(src.TitleId)
             {}
 
+        FSendAccountRecoveryEmailRequest(FSendAccountRecoveryEmailRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Email(MoveTemp(src.Email)),
+            EmailTemplateId(MoveTemp(src.EmailTemplateId)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FSendAccountRecoveryEmailRequest& operator=(const FSendAccountRecoveryEmailRequest& src) = default;
+        FSendAccountRecoveryEmailRequest& operator=(FSendAccountRecoveryEmailRequest&& src) = default;
+
         FSendAccountRecoveryEmailRequest(const TSharedPtr<FJsonObject>& obj) : FSendAccountRecoveryEmailRequest()
         {
             readFromValue(obj);
@@ -12305,7 +17349,13 @@ namespace ClientModels
         ~FSendAccountRecoveryEmailRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSendAccountRecoveryEmailResult : public PlayFab::FPlayFabCppResultCommon
@@ -12318,6 +17368,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FSendAccountRecoveryEmailResult(FSendAccountRecoveryEmailResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSendAccountRecoveryEmailResult& operator=(const FSendAccountRecoveryEmailResult& src) = default;
+        FSendAccountRecoveryEmailResult& operator=(FSendAccountRecoveryEmailResult&& src) = default;
+
         FSendAccountRecoveryEmailResult(const TSharedPtr<FJsonObject>& obj) : FSendAccountRecoveryEmailResult()
         {
             readFromValue(obj);
@@ -12326,7 +17383,13 @@ namespace ClientModels
         ~FSendAccountRecoveryEmailResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetFriendTagsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12348,6 +17411,15 @@ namespace ClientModels
             Tags(src.Tags)
             {}
 
+        FSetFriendTagsRequest(FSetFriendTagsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            FriendPlayFabId(MoveTemp(src.FriendPlayFabId)),
+            Tags(MoveTemp(src.Tags))
+            {}
+
+        FSetFriendTagsRequest& operator=(const FSetFriendTagsRequest& src) = default;
+        FSetFriendTagsRequest& operator=(FSetFriendTagsRequest&& src) = default;
+
         FSetFriendTagsRequest(const TSharedPtr<FJsonObject>& obj) : FSetFriendTagsRequest()
         {
             readFromValue(obj);
@@ -12356,7 +17428,13 @@ namespace ClientModels
         ~FSetFriendTagsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetFriendTagsResult : public PlayFab::FPlayFabCppResultCommon
@@ -12369,6 +17447,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FSetFriendTagsResult(FSetFriendTagsResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSetFriendTagsResult& operator=(const FSetFriendTagsResult& src) = default;
+        FSetFriendTagsResult& operator=(FSetFriendTagsResult&& src) = default;
+
         FSetFriendTagsResult(const TSharedPtr<FJsonObject>& obj) : FSetFriendTagsResult()
         {
             readFromValue(obj);
@@ -12377,7 +17462,13 @@ namespace ClientModels
         ~FSetFriendTagsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetPlayerSecretRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12400,6 +17491,15 @@ namespace ClientModels
             PlayerSecret(src.PlayerSecret)
             {}
 
+        FSetPlayerSecretRequest(FSetPlayerSecretRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            PlayerSecret(MoveTemp(src.PlayerSecret))
+            {}
+
+        FSetPlayerSecretRequest& operator=(const FSetPlayerSecretRequest& src) = default;
+        FSetPlayerSecretRequest& operator=(FSetPlayerSecretRequest&& src) = default;
+
         FSetPlayerSecretRequest(const TSharedPtr<FJsonObject>& obj) : FSetPlayerSecretRequest()
         {
             readFromValue(obj);
@@ -12408,7 +17508,13 @@ namespace ClientModels
         ~FSetPlayerSecretRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetPlayerSecretResult : public PlayFab::FPlayFabCppResultCommon
@@ -12421,6 +17527,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FSetPlayerSecretResult(FSetPlayerSecretResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSetPlayerSecretResult& operator=(const FSetPlayerSecretResult& src) = default;
+        FSetPlayerSecretResult& operator=(FSetPlayerSecretResult&& src) = default;
+
         FSetPlayerSecretResult(const TSharedPtr<FJsonObject>& obj) : FSetPlayerSecretResult()
         {
             readFromValue(obj);
@@ -12429,7 +17542,13 @@ namespace ClientModels
         ~FSetPlayerSecretResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStartGameRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12476,6 +17595,20 @@ namespace ClientModels
             StatisticName(src.StatisticName)
             {}
 
+        FStartGameRequest(FStartGameRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildVersion(MoveTemp(src.BuildVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomCommandLineData(MoveTemp(src.CustomCommandLineData)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            GameMode(MoveTemp(src.GameMode)),
+            pfRegion(MoveTemp(src.pfRegion)),
+            StatisticName(MoveTemp(src.StatisticName))
+            {}
+
+        FStartGameRequest& operator=(const FStartGameRequest& src) = default;
+        FStartGameRequest& operator=(FStartGameRequest&& src) = default;
+
         FStartGameRequest(const TSharedPtr<FJsonObject>& obj) : FStartGameRequest()
         {
             readFromValue(obj);
@@ -12484,7 +17617,13 @@ namespace ClientModels
         ~FStartGameRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStartGameResult : public PlayFab::FPlayFabCppResultCommon
@@ -12537,6 +17676,21 @@ namespace ClientModels
             Ticket(src.Ticket)
             {}
 
+        FStartGameResult(FStartGameResult&& src) :
+            FPlayFabCppResultCommon(),
+            Expires(MoveTemp(src.Expires)),
+            LobbyID(MoveTemp(src.LobbyID)),
+            Password(MoveTemp(src.Password)),
+            ServerIPV4Address(MoveTemp(src.ServerIPV4Address)),
+            ServerIPV6Address(MoveTemp(src.ServerIPV6Address)),
+            ServerPort(MoveTemp(src.ServerPort)),
+            ServerPublicDNSName(MoveTemp(src.ServerPublicDNSName)),
+            Ticket(MoveTemp(src.Ticket))
+            {}
+
+        FStartGameResult& operator=(const FStartGameResult& src) = default;
+        FStartGameResult& operator=(FStartGameResult&& src) = default;
+
         FStartGameResult(const TSharedPtr<FJsonObject>& obj) : FStartGameResult()
         {
             readFromValue(obj);
@@ -12545,7 +17699,13 @@ namespace ClientModels
         ~FStartGameResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStartPurchaseRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12576,6 +17736,17 @@ namespace ClientModels
             StoreId(src.StoreId)
             {}
 
+        FStartPurchaseRequest(FStartPurchaseRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Items(MoveTemp(src.Items)),
+            StoreId(MoveTemp(src.StoreId))
+            {}
+
+        FStartPurchaseRequest& operator=(const FStartPurchaseRequest& src) = default;
+        FStartPurchaseRequest& operator=(FStartPurchaseRequest&& src) = default;
+
         FStartPurchaseRequest(const TSharedPtr<FJsonObject>& obj) : FStartPurchaseRequest()
         {
             readFromValue(obj);
@@ -12584,7 +17755,13 @@ namespace ClientModels
         ~FStartPurchaseRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStartPurchaseResult : public PlayFab::FPlayFabCppResultCommon
@@ -12614,6 +17791,17 @@ namespace ClientModels
             VirtualCurrencyBalances(src.VirtualCurrencyBalances)
             {}
 
+        FStartPurchaseResult(FStartPurchaseResult&& src) :
+            FPlayFabCppResultCommon(),
+            Contents(MoveTemp(src.Contents)),
+            OrderId(MoveTemp(src.OrderId)),
+            PaymentOptions(MoveTemp(src.PaymentOptions)),
+            VirtualCurrencyBalances(MoveTemp(src.VirtualCurrencyBalances))
+            {}
+
+        FStartPurchaseResult& operator=(const FStartPurchaseResult& src) = default;
+        FStartPurchaseResult& operator=(FStartPurchaseResult&& src) = default;
+
         FStartPurchaseResult(const TSharedPtr<FJsonObject>& obj) : FStartPurchaseResult()
         {
             readFromValue(obj);
@@ -12622,7 +17810,13 @@ namespace ClientModels
         ~FStartPurchaseResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStatisticUpdate : public PlayFab::FPlayFabCppBaseModel
@@ -12653,6 +17847,16 @@ namespace ClientModels
             Version(src.Version)
             {}
 
+        FStatisticUpdate(FStatisticUpdate&& src) :
+            FPlayFabCppBaseModel(),
+            StatisticName(MoveTemp(src.StatisticName)),
+            Value(MoveTemp(src.Value)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FStatisticUpdate& operator=(const FStatisticUpdate& src) = default;
+        FStatisticUpdate& operator=(FStatisticUpdate&& src) = default;
+
         FStatisticUpdate(const TSharedPtr<FJsonObject>& obj) : FStatisticUpdate()
         {
             readFromValue(obj);
@@ -12661,7 +17865,13 @@ namespace ClientModels
         ~FStatisticUpdate();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSubtractUserVirtualCurrencyRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12688,6 +17898,16 @@ namespace ClientModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FSubtractUserVirtualCurrencyRequest(FSubtractUserVirtualCurrencyRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Amount(MoveTemp(src.Amount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FSubtractUserVirtualCurrencyRequest& operator=(const FSubtractUserVirtualCurrencyRequest& src) = default;
+        FSubtractUserVirtualCurrencyRequest& operator=(FSubtractUserVirtualCurrencyRequest&& src) = default;
+
         FSubtractUserVirtualCurrencyRequest(const TSharedPtr<FJsonObject>& obj) : FSubtractUserVirtualCurrencyRequest()
         {
             readFromValue(obj);
@@ -12696,7 +17916,13 @@ namespace ClientModels
         ~FSubtractUserVirtualCurrencyRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkAndroidDeviceIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12721,6 +17947,15 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkAndroidDeviceIDRequest(FUnlinkAndroidDeviceIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AndroidDeviceId(MoveTemp(src.AndroidDeviceId)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkAndroidDeviceIDRequest& operator=(const FUnlinkAndroidDeviceIDRequest& src) = default;
+        FUnlinkAndroidDeviceIDRequest& operator=(FUnlinkAndroidDeviceIDRequest&& src) = default;
+
         FUnlinkAndroidDeviceIDRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkAndroidDeviceIDRequest()
         {
             readFromValue(obj);
@@ -12729,7 +17964,13 @@ namespace ClientModels
         ~FUnlinkAndroidDeviceIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkAndroidDeviceIDResult : public PlayFab::FPlayFabCppResultCommon
@@ -12742,6 +17983,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkAndroidDeviceIDResult(FUnlinkAndroidDeviceIDResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkAndroidDeviceIDResult& operator=(const FUnlinkAndroidDeviceIDResult& src) = default;
+        FUnlinkAndroidDeviceIDResult& operator=(FUnlinkAndroidDeviceIDResult&& src) = default;
+
         FUnlinkAndroidDeviceIDResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkAndroidDeviceIDResult()
         {
             readFromValue(obj);
@@ -12750,7 +17998,13 @@ namespace ClientModels
         ~FUnlinkAndroidDeviceIDResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkAppleRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12767,6 +18021,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkAppleRequest(FUnlinkAppleRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkAppleRequest& operator=(const FUnlinkAppleRequest& src) = default;
+        FUnlinkAppleRequest& operator=(FUnlinkAppleRequest&& src) = default;
+
         FUnlinkAppleRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkAppleRequest()
         {
             readFromValue(obj);
@@ -12775,7 +18037,13 @@ namespace ClientModels
         ~FUnlinkAppleRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkCustomIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12800,6 +18068,15 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkCustomIDRequest(FUnlinkCustomIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomId(MoveTemp(src.CustomId)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkCustomIDRequest& operator=(const FUnlinkCustomIDRequest& src) = default;
+        FUnlinkCustomIDRequest& operator=(FUnlinkCustomIDRequest&& src) = default;
+
         FUnlinkCustomIDRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkCustomIDRequest()
         {
             readFromValue(obj);
@@ -12808,7 +18085,13 @@ namespace ClientModels
         ~FUnlinkCustomIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkCustomIDResult : public PlayFab::FPlayFabCppResultCommon
@@ -12821,6 +18104,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkCustomIDResult(FUnlinkCustomIDResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkCustomIDResult& operator=(const FUnlinkCustomIDResult& src) = default;
+        FUnlinkCustomIDResult& operator=(FUnlinkCustomIDResult&& src) = default;
+
         FUnlinkCustomIDResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkCustomIDResult()
         {
             readFromValue(obj);
@@ -12829,7 +18119,13 @@ namespace ClientModels
         ~FUnlinkCustomIDResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkFacebookAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12846,6 +18142,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkFacebookAccountRequest(FUnlinkFacebookAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkFacebookAccountRequest& operator=(const FUnlinkFacebookAccountRequest& src) = default;
+        FUnlinkFacebookAccountRequest& operator=(FUnlinkFacebookAccountRequest&& src) = default;
+
         FUnlinkFacebookAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkFacebookAccountRequest()
         {
             readFromValue(obj);
@@ -12854,7 +18158,13 @@ namespace ClientModels
         ~FUnlinkFacebookAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkFacebookAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -12867,6 +18177,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkFacebookAccountResult(FUnlinkFacebookAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkFacebookAccountResult& operator=(const FUnlinkFacebookAccountResult& src) = default;
+        FUnlinkFacebookAccountResult& operator=(FUnlinkFacebookAccountResult&& src) = default;
+
         FUnlinkFacebookAccountResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkFacebookAccountResult()
         {
             readFromValue(obj);
@@ -12875,7 +18192,13 @@ namespace ClientModels
         ~FUnlinkFacebookAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkFacebookInstantGamesIdRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12897,6 +18220,15 @@ namespace ClientModels
             FacebookInstantGamesId(src.FacebookInstantGamesId)
             {}
 
+        FUnlinkFacebookInstantGamesIdRequest(FUnlinkFacebookInstantGamesIdRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            FacebookInstantGamesId(MoveTemp(src.FacebookInstantGamesId))
+            {}
+
+        FUnlinkFacebookInstantGamesIdRequest& operator=(const FUnlinkFacebookInstantGamesIdRequest& src) = default;
+        FUnlinkFacebookInstantGamesIdRequest& operator=(FUnlinkFacebookInstantGamesIdRequest&& src) = default;
+
         FUnlinkFacebookInstantGamesIdRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkFacebookInstantGamesIdRequest()
         {
             readFromValue(obj);
@@ -12905,7 +18237,13 @@ namespace ClientModels
         ~FUnlinkFacebookInstantGamesIdRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkFacebookInstantGamesIdResult : public PlayFab::FPlayFabCppResultCommon
@@ -12918,6 +18256,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkFacebookInstantGamesIdResult(FUnlinkFacebookInstantGamesIdResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkFacebookInstantGamesIdResult& operator=(const FUnlinkFacebookInstantGamesIdResult& src) = default;
+        FUnlinkFacebookInstantGamesIdResult& operator=(FUnlinkFacebookInstantGamesIdResult&& src) = default;
+
         FUnlinkFacebookInstantGamesIdResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkFacebookInstantGamesIdResult()
         {
             readFromValue(obj);
@@ -12926,7 +18271,13 @@ namespace ClientModels
         ~FUnlinkFacebookInstantGamesIdResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkGameCenterAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12943,6 +18294,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkGameCenterAccountRequest(FUnlinkGameCenterAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkGameCenterAccountRequest& operator=(const FUnlinkGameCenterAccountRequest& src) = default;
+        FUnlinkGameCenterAccountRequest& operator=(FUnlinkGameCenterAccountRequest&& src) = default;
+
         FUnlinkGameCenterAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkGameCenterAccountRequest()
         {
             readFromValue(obj);
@@ -12951,7 +18310,13 @@ namespace ClientModels
         ~FUnlinkGameCenterAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkGameCenterAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -12964,6 +18329,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkGameCenterAccountResult(FUnlinkGameCenterAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkGameCenterAccountResult& operator=(const FUnlinkGameCenterAccountResult& src) = default;
+        FUnlinkGameCenterAccountResult& operator=(FUnlinkGameCenterAccountResult&& src) = default;
+
         FUnlinkGameCenterAccountResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkGameCenterAccountResult()
         {
             readFromValue(obj);
@@ -12972,7 +18344,13 @@ namespace ClientModels
         ~FUnlinkGameCenterAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkGoogleAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12989,6 +18367,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkGoogleAccountRequest(FUnlinkGoogleAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkGoogleAccountRequest& operator=(const FUnlinkGoogleAccountRequest& src) = default;
+        FUnlinkGoogleAccountRequest& operator=(FUnlinkGoogleAccountRequest&& src) = default;
+
         FUnlinkGoogleAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkGoogleAccountRequest()
         {
             readFromValue(obj);
@@ -12997,7 +18383,13 @@ namespace ClientModels
         ~FUnlinkGoogleAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkGoogleAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -13010,6 +18402,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkGoogleAccountResult(FUnlinkGoogleAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkGoogleAccountResult& operator=(const FUnlinkGoogleAccountResult& src) = default;
+        FUnlinkGoogleAccountResult& operator=(FUnlinkGoogleAccountResult&& src) = default;
+
         FUnlinkGoogleAccountResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkGoogleAccountResult()
         {
             readFromValue(obj);
@@ -13018,7 +18417,13 @@ namespace ClientModels
         ~FUnlinkGoogleAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkIOSDeviceIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13043,6 +18448,15 @@ namespace ClientModels
             DeviceId(src.DeviceId)
             {}
 
+        FUnlinkIOSDeviceIDRequest(FUnlinkIOSDeviceIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DeviceId(MoveTemp(src.DeviceId))
+            {}
+
+        FUnlinkIOSDeviceIDRequest& operator=(const FUnlinkIOSDeviceIDRequest& src) = default;
+        FUnlinkIOSDeviceIDRequest& operator=(FUnlinkIOSDeviceIDRequest&& src) = default;
+
         FUnlinkIOSDeviceIDRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkIOSDeviceIDRequest()
         {
             readFromValue(obj);
@@ -13051,7 +18465,13 @@ namespace ClientModels
         ~FUnlinkIOSDeviceIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkIOSDeviceIDResult : public PlayFab::FPlayFabCppResultCommon
@@ -13064,6 +18484,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkIOSDeviceIDResult(FUnlinkIOSDeviceIDResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkIOSDeviceIDResult& operator=(const FUnlinkIOSDeviceIDResult& src) = default;
+        FUnlinkIOSDeviceIDResult& operator=(FUnlinkIOSDeviceIDResult&& src) = default;
+
         FUnlinkIOSDeviceIDResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkIOSDeviceIDResult()
         {
             readFromValue(obj);
@@ -13072,7 +18499,13 @@ namespace ClientModels
         ~FUnlinkIOSDeviceIDResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkKongregateAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13089,6 +18522,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkKongregateAccountRequest(FUnlinkKongregateAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkKongregateAccountRequest& operator=(const FUnlinkKongregateAccountRequest& src) = default;
+        FUnlinkKongregateAccountRequest& operator=(FUnlinkKongregateAccountRequest&& src) = default;
+
         FUnlinkKongregateAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkKongregateAccountRequest()
         {
             readFromValue(obj);
@@ -13097,7 +18538,13 @@ namespace ClientModels
         ~FUnlinkKongregateAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkKongregateAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -13110,6 +18557,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkKongregateAccountResult(FUnlinkKongregateAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkKongregateAccountResult& operator=(const FUnlinkKongregateAccountResult& src) = default;
+        FUnlinkKongregateAccountResult& operator=(FUnlinkKongregateAccountResult&& src) = default;
+
         FUnlinkKongregateAccountResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkKongregateAccountResult()
         {
             readFromValue(obj);
@@ -13118,7 +18572,13 @@ namespace ClientModels
         ~FUnlinkKongregateAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkNintendoServiceAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13135,6 +18595,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkNintendoServiceAccountRequest(FUnlinkNintendoServiceAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkNintendoServiceAccountRequest& operator=(const FUnlinkNintendoServiceAccountRequest& src) = default;
+        FUnlinkNintendoServiceAccountRequest& operator=(FUnlinkNintendoServiceAccountRequest&& src) = default;
+
         FUnlinkNintendoServiceAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkNintendoServiceAccountRequest()
         {
             readFromValue(obj);
@@ -13143,7 +18611,13 @@ namespace ClientModels
         ~FUnlinkNintendoServiceAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkNintendoSwitchDeviceIdRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13165,6 +18639,15 @@ namespace ClientModels
             NintendoSwitchDeviceId(src.NintendoSwitchDeviceId)
             {}
 
+        FUnlinkNintendoSwitchDeviceIdRequest(FUnlinkNintendoSwitchDeviceIdRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            NintendoSwitchDeviceId(MoveTemp(src.NintendoSwitchDeviceId))
+            {}
+
+        FUnlinkNintendoSwitchDeviceIdRequest& operator=(const FUnlinkNintendoSwitchDeviceIdRequest& src) = default;
+        FUnlinkNintendoSwitchDeviceIdRequest& operator=(FUnlinkNintendoSwitchDeviceIdRequest&& src) = default;
+
         FUnlinkNintendoSwitchDeviceIdRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkNintendoSwitchDeviceIdRequest()
         {
             readFromValue(obj);
@@ -13173,7 +18656,13 @@ namespace ClientModels
         ~FUnlinkNintendoSwitchDeviceIdRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkNintendoSwitchDeviceIdResult : public PlayFab::FPlayFabCppResultCommon
@@ -13186,6 +18675,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkNintendoSwitchDeviceIdResult(FUnlinkNintendoSwitchDeviceIdResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkNintendoSwitchDeviceIdResult& operator=(const FUnlinkNintendoSwitchDeviceIdResult& src) = default;
+        FUnlinkNintendoSwitchDeviceIdResult& operator=(FUnlinkNintendoSwitchDeviceIdResult&& src) = default;
+
         FUnlinkNintendoSwitchDeviceIdResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkNintendoSwitchDeviceIdResult()
         {
             readFromValue(obj);
@@ -13194,7 +18690,13 @@ namespace ClientModels
         ~FUnlinkNintendoSwitchDeviceIdResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkOpenIdConnectRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13216,6 +18718,15 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkOpenIdConnectRequest(FUnlinkOpenIdConnectRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ConnectionId(MoveTemp(src.ConnectionId)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkOpenIdConnectRequest& operator=(const FUnlinkOpenIdConnectRequest& src) = default;
+        FUnlinkOpenIdConnectRequest& operator=(FUnlinkOpenIdConnectRequest&& src) = default;
+
         FUnlinkOpenIdConnectRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkOpenIdConnectRequest()
         {
             readFromValue(obj);
@@ -13224,7 +18735,13 @@ namespace ClientModels
         ~FUnlinkOpenIdConnectRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkPSNAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13241,6 +18758,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkPSNAccountRequest(FUnlinkPSNAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkPSNAccountRequest& operator=(const FUnlinkPSNAccountRequest& src) = default;
+        FUnlinkPSNAccountRequest& operator=(FUnlinkPSNAccountRequest&& src) = default;
+
         FUnlinkPSNAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkPSNAccountRequest()
         {
             readFromValue(obj);
@@ -13249,7 +18774,13 @@ namespace ClientModels
         ~FUnlinkPSNAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkPSNAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -13262,6 +18793,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkPSNAccountResult(FUnlinkPSNAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkPSNAccountResult& operator=(const FUnlinkPSNAccountResult& src) = default;
+        FUnlinkPSNAccountResult& operator=(FUnlinkPSNAccountResult&& src) = default;
+
         FUnlinkPSNAccountResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkPSNAccountResult()
         {
             readFromValue(obj);
@@ -13270,7 +18808,13 @@ namespace ClientModels
         ~FUnlinkPSNAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkSteamAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13287,6 +18831,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkSteamAccountRequest(FUnlinkSteamAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkSteamAccountRequest& operator=(const FUnlinkSteamAccountRequest& src) = default;
+        FUnlinkSteamAccountRequest& operator=(FUnlinkSteamAccountRequest&& src) = default;
+
         FUnlinkSteamAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkSteamAccountRequest()
         {
             readFromValue(obj);
@@ -13295,7 +18847,13 @@ namespace ClientModels
         ~FUnlinkSteamAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkSteamAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -13308,6 +18866,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkSteamAccountResult(FUnlinkSteamAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkSteamAccountResult& operator=(const FUnlinkSteamAccountResult& src) = default;
+        FUnlinkSteamAccountResult& operator=(FUnlinkSteamAccountResult&& src) = default;
+
         FUnlinkSteamAccountResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkSteamAccountResult()
         {
             readFromValue(obj);
@@ -13316,7 +18881,13 @@ namespace ClientModels
         ~FUnlinkSteamAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkTwitchAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13341,6 +18912,15 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkTwitchAccountRequest(FUnlinkTwitchAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AccessToken(MoveTemp(src.AccessToken)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkTwitchAccountRequest& operator=(const FUnlinkTwitchAccountRequest& src) = default;
+        FUnlinkTwitchAccountRequest& operator=(FUnlinkTwitchAccountRequest&& src) = default;
+
         FUnlinkTwitchAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkTwitchAccountRequest()
         {
             readFromValue(obj);
@@ -13349,7 +18929,13 @@ namespace ClientModels
         ~FUnlinkTwitchAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkTwitchAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -13362,6 +18948,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkTwitchAccountResult(FUnlinkTwitchAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkTwitchAccountResult& operator=(const FUnlinkTwitchAccountResult& src) = default;
+        FUnlinkTwitchAccountResult& operator=(FUnlinkTwitchAccountResult&& src) = default;
+
         FUnlinkTwitchAccountResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkTwitchAccountResult()
         {
             readFromValue(obj);
@@ -13370,7 +18963,13 @@ namespace ClientModels
         ~FUnlinkTwitchAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkWindowsHelloAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13392,6 +18991,15 @@ namespace ClientModels
             PublicKeyHint(src.PublicKeyHint)
             {}
 
+        FUnlinkWindowsHelloAccountRequest(FUnlinkWindowsHelloAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PublicKeyHint(MoveTemp(src.PublicKeyHint))
+            {}
+
+        FUnlinkWindowsHelloAccountRequest& operator=(const FUnlinkWindowsHelloAccountRequest& src) = default;
+        FUnlinkWindowsHelloAccountRequest& operator=(FUnlinkWindowsHelloAccountRequest&& src) = default;
+
         FUnlinkWindowsHelloAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkWindowsHelloAccountRequest()
         {
             readFromValue(obj);
@@ -13400,7 +19008,13 @@ namespace ClientModels
         ~FUnlinkWindowsHelloAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkWindowsHelloAccountResponse : public PlayFab::FPlayFabCppResultCommon
@@ -13413,6 +19027,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkWindowsHelloAccountResponse(FUnlinkWindowsHelloAccountResponse&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkWindowsHelloAccountResponse& operator=(const FUnlinkWindowsHelloAccountResponse& src) = default;
+        FUnlinkWindowsHelloAccountResponse& operator=(FUnlinkWindowsHelloAccountResponse&& src) = default;
+
         FUnlinkWindowsHelloAccountResponse(const TSharedPtr<FJsonObject>& obj) : FUnlinkWindowsHelloAccountResponse()
         {
             readFromValue(obj);
@@ -13421,7 +19042,13 @@ namespace ClientModels
         ~FUnlinkWindowsHelloAccountResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkXboxAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13438,6 +19065,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkXboxAccountRequest(FUnlinkXboxAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkXboxAccountRequest& operator=(const FUnlinkXboxAccountRequest& src) = default;
+        FUnlinkXboxAccountRequest& operator=(FUnlinkXboxAccountRequest&& src) = default;
+
         FUnlinkXboxAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkXboxAccountRequest()
         {
             readFromValue(obj);
@@ -13446,7 +19081,13 @@ namespace ClientModels
         ~FUnlinkXboxAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkXboxAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -13459,6 +19100,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkXboxAccountResult(FUnlinkXboxAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkXboxAccountResult& operator=(const FUnlinkXboxAccountResult& src) = default;
+        FUnlinkXboxAccountResult& operator=(FUnlinkXboxAccountResult&& src) = default;
+
         FUnlinkXboxAccountResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkXboxAccountResult()
         {
             readFromValue(obj);
@@ -13467,7 +19115,13 @@ namespace ClientModels
         ~FUnlinkXboxAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlockContainerInstanceRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13510,6 +19164,18 @@ namespace ClientModels
             KeyItemInstanceId(src.KeyItemInstanceId)
             {}
 
+        FUnlockContainerInstanceRequest(FUnlockContainerInstanceRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            ContainerItemInstanceId(MoveTemp(src.ContainerItemInstanceId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            KeyItemInstanceId(MoveTemp(src.KeyItemInstanceId))
+            {}
+
+        FUnlockContainerInstanceRequest& operator=(const FUnlockContainerInstanceRequest& src) = default;
+        FUnlockContainerInstanceRequest& operator=(FUnlockContainerInstanceRequest&& src) = default;
+
         FUnlockContainerInstanceRequest(const TSharedPtr<FJsonObject>& obj) : FUnlockContainerInstanceRequest()
         {
             readFromValue(obj);
@@ -13518,7 +19184,13 @@ namespace ClientModels
         ~FUnlockContainerInstanceRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlockContainerItemRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13553,6 +19225,17 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlockContainerItemRequest(FUnlockContainerItemRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            ContainerItemId(MoveTemp(src.ContainerItemId)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlockContainerItemRequest& operator=(const FUnlockContainerItemRequest& src) = default;
+        FUnlockContainerItemRequest& operator=(FUnlockContainerItemRequest&& src) = default;
+
         FUnlockContainerItemRequest(const TSharedPtr<FJsonObject>& obj) : FUnlockContainerItemRequest()
         {
             readFromValue(obj);
@@ -13561,7 +19244,13 @@ namespace ClientModels
         ~FUnlockContainerItemRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlockContainerItemResult : public PlayFab::FPlayFabCppResultCommon
@@ -13592,6 +19281,17 @@ namespace ClientModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FUnlockContainerItemResult(FUnlockContainerItemResult&& src) :
+            FPlayFabCppResultCommon(),
+            GrantedItems(MoveTemp(src.GrantedItems)),
+            UnlockedItemInstanceId(MoveTemp(src.UnlockedItemInstanceId)),
+            UnlockedWithItemInstanceId(MoveTemp(src.UnlockedWithItemInstanceId)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FUnlockContainerItemResult& operator=(const FUnlockContainerItemResult& src) = default;
+        FUnlockContainerItemResult& operator=(FUnlockContainerItemResult&& src) = default;
+
         FUnlockContainerItemResult(const TSharedPtr<FJsonObject>& obj) : FUnlockContainerItemResult()
         {
             readFromValue(obj);
@@ -13600,7 +19300,13 @@ namespace ClientModels
         ~FUnlockContainerItemResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateAvatarUrlRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13618,6 +19324,14 @@ namespace ClientModels
             ImageUrl(src.ImageUrl)
             {}
 
+        FUpdateAvatarUrlRequest(FUpdateAvatarUrlRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ImageUrl(MoveTemp(src.ImageUrl))
+            {}
+
+        FUpdateAvatarUrlRequest& operator=(const FUpdateAvatarUrlRequest& src) = default;
+        FUpdateAvatarUrlRequest& operator=(FUpdateAvatarUrlRequest&& src) = default;
+
         FUpdateAvatarUrlRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateAvatarUrlRequest()
         {
             readFromValue(obj);
@@ -13626,7 +19340,13 @@ namespace ClientModels
         ~FUpdateAvatarUrlRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateCharacterDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13667,6 +19387,18 @@ namespace ClientModels
             Permission(src.Permission)
             {}
 
+        FUpdateCharacterDataRequest(FUpdateCharacterDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Data(MoveTemp(src.Data)),
+            KeysToRemove(MoveTemp(src.KeysToRemove)),
+            Permission(MoveTemp(src.Permission))
+            {}
+
+        FUpdateCharacterDataRequest& operator=(const FUpdateCharacterDataRequest& src) = default;
+        FUpdateCharacterDataRequest& operator=(FUpdateCharacterDataRequest&& src) = default;
+
         FUpdateCharacterDataRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateCharacterDataRequest()
         {
             readFromValue(obj);
@@ -13675,7 +19407,13 @@ namespace ClientModels
         ~FUpdateCharacterDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateCharacterDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -13696,6 +19434,14 @@ namespace ClientModels
             DataVersion(src.DataVersion)
             {}
 
+        FUpdateCharacterDataResult(FUpdateCharacterDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            DataVersion(MoveTemp(src.DataVersion))
+            {}
+
+        FUpdateCharacterDataResult& operator=(const FUpdateCharacterDataResult& src) = default;
+        FUpdateCharacterDataResult& operator=(FUpdateCharacterDataResult&& src) = default;
+
         FUpdateCharacterDataResult(const TSharedPtr<FJsonObject>& obj) : FUpdateCharacterDataResult()
         {
             readFromValue(obj);
@@ -13704,7 +19450,13 @@ namespace ClientModels
         ~FUpdateCharacterDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateCharacterStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13730,6 +19482,16 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUpdateCharacterStatisticsRequest(FUpdateCharacterStatisticsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CharacterStatistics(MoveTemp(src.CharacterStatistics)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUpdateCharacterStatisticsRequest& operator=(const FUpdateCharacterStatisticsRequest& src) = default;
+        FUpdateCharacterStatisticsRequest& operator=(FUpdateCharacterStatisticsRequest&& src) = default;
+
         FUpdateCharacterStatisticsRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateCharacterStatisticsRequest()
         {
             readFromValue(obj);
@@ -13738,7 +19500,13 @@ namespace ClientModels
         ~FUpdateCharacterStatisticsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateCharacterStatisticsResult : public PlayFab::FPlayFabCppResultCommon
@@ -13751,6 +19519,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUpdateCharacterStatisticsResult(FUpdateCharacterStatisticsResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUpdateCharacterStatisticsResult& operator=(const FUpdateCharacterStatisticsResult& src) = default;
+        FUpdateCharacterStatisticsResult& operator=(FUpdateCharacterStatisticsResult&& src) = default;
+
         FUpdateCharacterStatisticsResult(const TSharedPtr<FJsonObject>& obj) : FUpdateCharacterStatisticsResult()
         {
             readFromValue(obj);
@@ -13759,7 +19534,13 @@ namespace ClientModels
         ~FUpdateCharacterStatisticsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdatePlayerStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13780,6 +19561,15 @@ namespace ClientModels
             Statistics(src.Statistics)
             {}
 
+        FUpdatePlayerStatisticsRequest(FUpdatePlayerStatisticsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Statistics(MoveTemp(src.Statistics))
+            {}
+
+        FUpdatePlayerStatisticsRequest& operator=(const FUpdatePlayerStatisticsRequest& src) = default;
+        FUpdatePlayerStatisticsRequest& operator=(FUpdatePlayerStatisticsRequest&& src) = default;
+
         FUpdatePlayerStatisticsRequest(const TSharedPtr<FJsonObject>& obj) : FUpdatePlayerStatisticsRequest()
         {
             readFromValue(obj);
@@ -13788,7 +19578,13 @@ namespace ClientModels
         ~FUpdatePlayerStatisticsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdatePlayerStatisticsResult : public PlayFab::FPlayFabCppResultCommon
@@ -13801,6 +19597,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUpdatePlayerStatisticsResult(FUpdatePlayerStatisticsResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUpdatePlayerStatisticsResult& operator=(const FUpdatePlayerStatisticsResult& src) = default;
+        FUpdatePlayerStatisticsResult& operator=(FUpdatePlayerStatisticsResult&& src) = default;
+
         FUpdatePlayerStatisticsResult(const TSharedPtr<FJsonObject>& obj) : FUpdatePlayerStatisticsResult()
         {
             readFromValue(obj);
@@ -13809,7 +19612,13 @@ namespace ClientModels
         ~FUpdatePlayerStatisticsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateSharedGroupDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13850,6 +19659,18 @@ namespace ClientModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FUpdateSharedGroupDataRequest(FUpdateSharedGroupDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Data(MoveTemp(src.Data)),
+            KeysToRemove(MoveTemp(src.KeysToRemove)),
+            Permission(MoveTemp(src.Permission)),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FUpdateSharedGroupDataRequest& operator=(const FUpdateSharedGroupDataRequest& src) = default;
+        FUpdateSharedGroupDataRequest& operator=(FUpdateSharedGroupDataRequest&& src) = default;
+
         FUpdateSharedGroupDataRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateSharedGroupDataRequest()
         {
             readFromValue(obj);
@@ -13858,7 +19679,13 @@ namespace ClientModels
         ~FUpdateSharedGroupDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateSharedGroupDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -13871,6 +19698,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUpdateSharedGroupDataResult(FUpdateSharedGroupDataResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUpdateSharedGroupDataResult& operator=(const FUpdateSharedGroupDataResult& src) = default;
+        FUpdateSharedGroupDataResult& operator=(FUpdateSharedGroupDataResult&& src) = default;
+
         FUpdateSharedGroupDataResult(const TSharedPtr<FJsonObject>& obj) : FUpdateSharedGroupDataResult()
         {
             readFromValue(obj);
@@ -13879,7 +19713,13 @@ namespace ClientModels
         ~FUpdateSharedGroupDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateUserDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13918,6 +19758,17 @@ namespace ClientModels
             Permission(src.Permission)
             {}
 
+        FUpdateUserDataRequest(FUpdateUserDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Data(MoveTemp(src.Data)),
+            KeysToRemove(MoveTemp(src.KeysToRemove)),
+            Permission(MoveTemp(src.Permission))
+            {}
+
+        FUpdateUserDataRequest& operator=(const FUpdateUserDataRequest& src) = default;
+        FUpdateUserDataRequest& operator=(FUpdateUserDataRequest&& src) = default;
+
         FUpdateUserDataRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateUserDataRequest()
         {
             readFromValue(obj);
@@ -13926,7 +19777,13 @@ namespace ClientModels
         ~FUpdateUserDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateUserDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -13947,6 +19804,14 @@ namespace ClientModels
             DataVersion(src.DataVersion)
             {}
 
+        FUpdateUserDataResult(FUpdateUserDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            DataVersion(MoveTemp(src.DataVersion))
+            {}
+
+        FUpdateUserDataResult& operator=(const FUpdateUserDataResult& src) = default;
+        FUpdateUserDataResult& operator=(FUpdateUserDataResult&& src) = default;
+
         FUpdateUserDataResult(const TSharedPtr<FJsonObject>& obj) : FUpdateUserDataResult()
         {
             readFromValue(obj);
@@ -13955,7 +19820,13 @@ namespace ClientModels
         ~FUpdateUserDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateUserTitleDisplayNameRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13977,6 +19848,15 @@ namespace ClientModels
             DisplayName(src.DisplayName)
             {}
 
+        FUpdateUserTitleDisplayNameRequest(FUpdateUserTitleDisplayNameRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DisplayName(MoveTemp(src.DisplayName))
+            {}
+
+        FUpdateUserTitleDisplayNameRequest& operator=(const FUpdateUserTitleDisplayNameRequest& src) = default;
+        FUpdateUserTitleDisplayNameRequest& operator=(FUpdateUserTitleDisplayNameRequest&& src) = default;
+
         FUpdateUserTitleDisplayNameRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateUserTitleDisplayNameRequest()
         {
             readFromValue(obj);
@@ -13985,7 +19865,13 @@ namespace ClientModels
         ~FUpdateUserTitleDisplayNameRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateUserTitleDisplayNameResult : public PlayFab::FPlayFabCppResultCommon
@@ -14003,6 +19889,14 @@ namespace ClientModels
             DisplayName(src.DisplayName)
             {}
 
+        FUpdateUserTitleDisplayNameResult(FUpdateUserTitleDisplayNameResult&& src) :
+            FPlayFabCppResultCommon(),
+            DisplayName(MoveTemp(src.DisplayName))
+            {}
+
+        FUpdateUserTitleDisplayNameResult& operator=(const FUpdateUserTitleDisplayNameResult& src) = default;
+        FUpdateUserTitleDisplayNameResult& operator=(FUpdateUserTitleDisplayNameResult&& src) = default;
+
         FUpdateUserTitleDisplayNameResult(const TSharedPtr<FJsonObject>& obj) : FUpdateUserTitleDisplayNameResult()
         {
             readFromValue(obj);
@@ -14011,7 +19905,13 @@ namespace ClientModels
         ~FUpdateUserTitleDisplayNameResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValidateAmazonReceiptRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -14053,6 +19953,19 @@ namespace ClientModels
             UserId(src.UserId)
             {}
 
+        FValidateAmazonReceiptRequest(FValidateAmazonReceiptRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CurrencyCode(MoveTemp(src.CurrencyCode)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PurchasePrice(MoveTemp(src.PurchasePrice)),
+            ReceiptId(MoveTemp(src.ReceiptId)),
+            UserId(MoveTemp(src.UserId))
+            {}
+
+        FValidateAmazonReceiptRequest& operator=(const FValidateAmazonReceiptRequest& src) = default;
+        FValidateAmazonReceiptRequest& operator=(FValidateAmazonReceiptRequest&& src) = default;
+
         FValidateAmazonReceiptRequest(const TSharedPtr<FJsonObject>& obj) : FValidateAmazonReceiptRequest()
         {
             readFromValue(obj);
@@ -14061,7 +19974,13 @@ namespace ClientModels
         ~FValidateAmazonReceiptRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValidateAmazonReceiptResult : public PlayFab::FPlayFabCppResultCommon
@@ -14078,6 +19997,14 @@ namespace ClientModels
             Fulfillments(src.Fulfillments)
             {}
 
+        FValidateAmazonReceiptResult(FValidateAmazonReceiptResult&& src) :
+            FPlayFabCppResultCommon(),
+            Fulfillments(MoveTemp(src.Fulfillments))
+            {}
+
+        FValidateAmazonReceiptResult& operator=(const FValidateAmazonReceiptResult& src) = default;
+        FValidateAmazonReceiptResult& operator=(FValidateAmazonReceiptResult&& src) = default;
+
         FValidateAmazonReceiptResult(const TSharedPtr<FJsonObject>& obj) : FValidateAmazonReceiptResult()
         {
             readFromValue(obj);
@@ -14086,7 +20013,13 @@ namespace ClientModels
         ~FValidateAmazonReceiptResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValidateGooglePlayPurchaseRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -14128,6 +20061,19 @@ namespace ClientModels
             Signature(src.Signature)
             {}
 
+        FValidateGooglePlayPurchaseRequest(FValidateGooglePlayPurchaseRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CurrencyCode(MoveTemp(src.CurrencyCode)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PurchasePrice(MoveTemp(src.PurchasePrice)),
+            ReceiptJson(MoveTemp(src.ReceiptJson)),
+            Signature(MoveTemp(src.Signature))
+            {}
+
+        FValidateGooglePlayPurchaseRequest& operator=(const FValidateGooglePlayPurchaseRequest& src) = default;
+        FValidateGooglePlayPurchaseRequest& operator=(FValidateGooglePlayPurchaseRequest&& src) = default;
+
         FValidateGooglePlayPurchaseRequest(const TSharedPtr<FJsonObject>& obj) : FValidateGooglePlayPurchaseRequest()
         {
             readFromValue(obj);
@@ -14136,7 +20082,13 @@ namespace ClientModels
         ~FValidateGooglePlayPurchaseRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValidateGooglePlayPurchaseResult : public PlayFab::FPlayFabCppResultCommon
@@ -14153,6 +20105,14 @@ namespace ClientModels
             Fulfillments(src.Fulfillments)
             {}
 
+        FValidateGooglePlayPurchaseResult(FValidateGooglePlayPurchaseResult&& src) :
+            FPlayFabCppResultCommon(),
+            Fulfillments(MoveTemp(src.Fulfillments))
+            {}
+
+        FValidateGooglePlayPurchaseResult& operator=(const FValidateGooglePlayPurchaseResult& src) = default;
+        FValidateGooglePlayPurchaseResult& operator=(FValidateGooglePlayPurchaseResult&& src) = default;
+
         FValidateGooglePlayPurchaseResult(const TSharedPtr<FJsonObject>& obj) : FValidateGooglePlayPurchaseResult()
         {
             readFromValue(obj);
@@ -14161,7 +20121,13 @@ namespace ClientModels
         ~FValidateGooglePlayPurchaseResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValidateIOSReceiptRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -14198,6 +20164,18 @@ namespace ClientModels
             ReceiptData(src.ReceiptData)
             {}
 
+        FValidateIOSReceiptRequest(FValidateIOSReceiptRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CurrencyCode(MoveTemp(src.CurrencyCode)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PurchasePrice(MoveTemp(src.PurchasePrice)),
+            ReceiptData(MoveTemp(src.ReceiptData))
+            {}
+
+        FValidateIOSReceiptRequest& operator=(const FValidateIOSReceiptRequest& src) = default;
+        FValidateIOSReceiptRequest& operator=(FValidateIOSReceiptRequest&& src) = default;
+
         FValidateIOSReceiptRequest(const TSharedPtr<FJsonObject>& obj) : FValidateIOSReceiptRequest()
         {
             readFromValue(obj);
@@ -14206,7 +20184,13 @@ namespace ClientModels
         ~FValidateIOSReceiptRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValidateIOSReceiptResult : public PlayFab::FPlayFabCppResultCommon
@@ -14223,6 +20207,14 @@ namespace ClientModels
             Fulfillments(src.Fulfillments)
             {}
 
+        FValidateIOSReceiptResult(FValidateIOSReceiptResult&& src) :
+            FPlayFabCppResultCommon(),
+            Fulfillments(MoveTemp(src.Fulfillments))
+            {}
+
+        FValidateIOSReceiptResult& operator=(const FValidateIOSReceiptResult& src) = default;
+        FValidateIOSReceiptResult& operator=(FValidateIOSReceiptResult&& src) = default;
+
         FValidateIOSReceiptResult(const TSharedPtr<FJsonObject>& obj) : FValidateIOSReceiptResult()
         {
             readFromValue(obj);
@@ -14231,7 +20223,13 @@ namespace ClientModels
         ~FValidateIOSReceiptResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValidateWindowsReceiptRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -14268,6 +20266,18 @@ namespace ClientModels
             Receipt(src.Receipt)
             {}
 
+        FValidateWindowsReceiptRequest(FValidateWindowsReceiptRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CurrencyCode(MoveTemp(src.CurrencyCode)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PurchasePrice(MoveTemp(src.PurchasePrice)),
+            Receipt(MoveTemp(src.Receipt))
+            {}
+
+        FValidateWindowsReceiptRequest& operator=(const FValidateWindowsReceiptRequest& src) = default;
+        FValidateWindowsReceiptRequest& operator=(FValidateWindowsReceiptRequest&& src) = default;
+
         FValidateWindowsReceiptRequest(const TSharedPtr<FJsonObject>& obj) : FValidateWindowsReceiptRequest()
         {
             readFromValue(obj);
@@ -14276,7 +20286,13 @@ namespace ClientModels
         ~FValidateWindowsReceiptRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValidateWindowsReceiptResult : public PlayFab::FPlayFabCppResultCommon
@@ -14293,6 +20309,14 @@ namespace ClientModels
             Fulfillments(src.Fulfillments)
             {}
 
+        FValidateWindowsReceiptResult(FValidateWindowsReceiptResult&& src) :
+            FPlayFabCppResultCommon(),
+            Fulfillments(MoveTemp(src.Fulfillments))
+            {}
+
+        FValidateWindowsReceiptResult& operator=(const FValidateWindowsReceiptResult& src) = default;
+        FValidateWindowsReceiptResult& operator=(FValidateWindowsReceiptResult&& src) = default;
+
         FValidateWindowsReceiptResult(const TSharedPtr<FJsonObject>& obj) : FValidateWindowsReceiptResult()
         {
             readFromValue(obj);
@@ -14301,7 +20325,13 @@ namespace ClientModels
         ~FValidateWindowsReceiptResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FWriteClientCharacterEventRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -14340,6 +20370,18 @@ namespace ClientModels
             Timestamp(src.Timestamp)
             {}
 
+        FWriteClientCharacterEventRequest(FWriteClientCharacterEventRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Body(MoveTemp(src.Body)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EventName(MoveTemp(src.EventName)),
+            Timestamp(MoveTemp(src.Timestamp))
+            {}
+
+        FWriteClientCharacterEventRequest& operator=(const FWriteClientCharacterEventRequest& src) = default;
+        FWriteClientCharacterEventRequest& operator=(FWriteClientCharacterEventRequest&& src) = default;
+
         FWriteClientCharacterEventRequest(const TSharedPtr<FJsonObject>& obj) : FWriteClientCharacterEventRequest()
         {
             readFromValue(obj);
@@ -14348,7 +20390,13 @@ namespace ClientModels
         ~FWriteClientCharacterEventRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FWriteClientPlayerEventRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -14382,6 +20430,17 @@ namespace ClientModels
             Timestamp(src.Timestamp)
             {}
 
+        FWriteClientPlayerEventRequest(FWriteClientPlayerEventRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Body(MoveTemp(src.Body)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EventName(MoveTemp(src.EventName)),
+            Timestamp(MoveTemp(src.Timestamp))
+            {}
+
+        FWriteClientPlayerEventRequest& operator=(const FWriteClientPlayerEventRequest& src) = default;
+        FWriteClientPlayerEventRequest& operator=(FWriteClientPlayerEventRequest&& src) = default;
+
         FWriteClientPlayerEventRequest(const TSharedPtr<FJsonObject>& obj) : FWriteClientPlayerEventRequest()
         {
             readFromValue(obj);
@@ -14390,7 +20449,13 @@ namespace ClientModels
         ~FWriteClientPlayerEventRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FWriteEventResponse : public PlayFab::FPlayFabCppResultCommon
@@ -14411,6 +20476,14 @@ namespace ClientModels
             EventId(src.EventId)
             {}
 
+        FWriteEventResponse(FWriteEventResponse&& src) :
+            FPlayFabCppResultCommon(),
+            EventId(MoveTemp(src.EventId))
+            {}
+
+        FWriteEventResponse& operator=(const FWriteEventResponse& src) = default;
+        FWriteEventResponse& operator=(FWriteEventResponse&& src) = default;
+
         FWriteEventResponse(const TSharedPtr<FJsonObject>& obj) : FWriteEventResponse()
         {
             readFromValue(obj);
@@ -14419,7 +20492,13 @@ namespace ClientModels
         ~FWriteEventResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FWriteTitleEventRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -14453,6 +20532,17 @@ namespace ClientModels
             Timestamp(src.Timestamp)
             {}
 
+        FWriteTitleEventRequest(FWriteTitleEventRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Body(MoveTemp(src.Body)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EventName(MoveTemp(src.EventName)),
+            Timestamp(MoveTemp(src.Timestamp))
+            {}
+
+        FWriteTitleEventRequest& operator=(const FWriteTitleEventRequest& src) = default;
+        FWriteTitleEventRequest& operator=(FWriteTitleEventRequest&& src) = default;
+
         FWriteTitleEventRequest(const TSharedPtr<FJsonObject>& obj) : FWriteTitleEventRequest()
         {
             readFromValue(obj);
@@ -14461,7 +20551,13 @@ namespace ClientModels
         ~FWriteTitleEventRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
 }
@@ -0,0 +1,48 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PlayFab
+{
+    struct FPlayFabCompletionQueueStats
+    {
+        // Result delegates waiting to run
+        int32 Depth = 0;
+        // Highest Depth seen since startup
+        int32 MaxDepth = 0;
+        // Time the oldest waiting delegate has been queued for
+        float OldestWaitSeconds = 0.0f;
+        // Delegates run by the last frame's drain, and whether it stopped because the budget ran out
+        int32 DeliveredLastFrame = 0;
+        bool bBudgetExceededLastFrame = false;
+    };
+
+    /**
+     * Game thread queue of result delegates, drained each frame within UPlayFabRuntimeSettings::DelegateBudgetMsPerFrame.
+     * When many responses complete at once, e.g. after a reconnect, the delegates over budget are carried over to the next frame.
+     * At least one delegate runs each frame, and they always run in the order their responses were decoded.
+     * Started and stopped by the PlayFabCpp module.
+     */
+    class PLAYFABCPP_API FPlayFabCompletionQueue
+    {
+    public:
+        static void Startup();
+        // Drops anything still queued
+        static void Shutdown();
+
+        // Whether result delegates should go through the queue: it is running and a budget is set
+        static bool IsEnabled();
+        // Can be called from any thread
+        static void Enqueue(TFunction<void()>&& Deliver);
+
+        static FPlayFabCompletionQueueStats GetStats();
+
+    private:
+        static bool Drain(float DeltaTime);
+    };
+}
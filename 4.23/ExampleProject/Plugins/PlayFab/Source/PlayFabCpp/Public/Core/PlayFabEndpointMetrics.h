@@ -0,0 +1,124 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Http.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+// "stat PlayFab" shows where PlayFab time goes each frame; the CSV profiler records the same under the PlayFab category
+DECLARE_STATS_GROUP(TEXT("PlayFab"), STATGROUP_PlayFab, STATCAT_Advanced);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Decode responses"), STAT_PlayFabDecode, STATGROUP_PlayFab, PLAYFABCPP_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Run result delegates"), STAT_PlayFabDelegates, STATGROUP_PlayFab, PLAYFABCPP_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Requests completed"), STAT_PlayFabRequestsCompleted, STATGROUP_PlayFab, PLAYFABCPP_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Bytes sent"), STAT_PlayFabBytesSent, STATGROUP_PlayFab, PLAYFABCPP_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Bytes received"), STAT_PlayFabBytesReceived, STATGROUP_PlayFab, PLAYFABCPP_API);
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(PLAYFABCPP_API, PlayFab);
+
+namespace PlayFab
+{
+    /**
+     * Log-linear histogram of durations, in the style of an HDR histogram.
+     * Each power of two of microseconds is split into 16 buckets, so percentiles are within about 6% of the true value, up to about two minutes.
+     */
+    class PLAYFABCPP_API FPlayFabLatencyHistogram
+    {
+    public:
+        void Add(double Seconds);
+
+        int64 GetCount() const { return Count; }
+        double GetMeanSeconds() const { return Count > 0 ? SumSeconds / Count : 0.0; }
+        double GetMaxSeconds() const { return MaxSeconds; }
+        // Upper bound of the bucket that holds the given percentile, in [0, 1]; zero if the histogram is empty
+        double GetPercentileSeconds(double Percentile) const;
+
+    private:
+        static int32 GetBucketIndex(uint64 Microseconds);
+        static uint64 GetBucketUpperBound(int32 Index);
+
+        // Empty until the first sample
+        TArray<uint32> Buckets;
+        int64 Count = 0;
+        double SumSeconds = 0.0;
+        double MaxSeconds = 0.0;
+    };
+
+    /** Everything measured for one endpoint ("/Client/GetTitleData") since startup, or since the last reset */
+    struct FPlayFabEndpointMetrics
+    {
+        // Every attempt that completed, first attempts, retries and hedges alike, and those of them that got no response or an error status
+        int64 Attempts = 0;
+        int64 FailedAttempts = 0;
+        // Bytes on the wire, so compressed when compression is on
+        int64 RequestBytes = 0;
+        int64 ResponseBytes = 0;
+
+        // Time spent waiting in the request governor's queue
+        FPlayFabLatencyHistogram QueueTime;
+        // From sending to the first bytes of the response, measured to within a frame
+        FPlayFabLatencyHistogram TimeToFirstByte;
+        // From sending to the complete response
+        FPlayFabLatencyHistogram TotalLatency;
+        FPlayFabLatencyHistogram DecodeTime;
+        FPlayFabLatencyHistogram DelegateTime;
+    };
+
+    enum class EPlayFabMetricStage : uint8
+    {
+        Decode,
+        Delegates
+    };
+
+    /**
+     * Per-endpoint request metrics, recorded by PlayFabRequestHandler when UPlayFabRuntimeSettings::bCollectEndpointMetrics is set.
+     * The STAT_PlayFab stats and the CSV profiler category are updated whatever the setting.
+     */
+    class PLAYFABCPP_API FPlayFabMetrics
+    {
+    public:
+        static bool IsEnabled();
+
+        // Called for every attempt as it is handed to the request governor, and once it completes or is dropped unsent
+        static void OnAttemptSubmitted(const FHttpRequestPtr& HttpRequest);
+        static void OnAttemptComplete(const FHttpRequestPtr& HttpRequest, const FHttpResponsePtr& HttpResponse, bool bSucceeded);
+        static void OnAttemptDropped(const FHttpRequestPtr& HttpRequest);
+
+        // Endpoint a request's decode and delegate times are recorded under; empty if metrics are off
+        static FString GetMetricsPath(const FHttpRequestPtr& HttpRequest);
+        static void RecordStage(const FString& UrlPath, EPlayFabMetricStage Stage, double Seconds);
+
+        static bool GetEndpointMetrics(const FString& UrlPath, FPlayFabEndpointMetrics& OutMetrics);
+        static TMap<FString, FPlayFabEndpointMetrics> GetAllEndpointMetrics();
+        static void Reset();
+
+    private:
+        static void OnAttemptProgress(FHttpRequestPtr HttpRequest, int32 BytesSent, int32 BytesReceived, FHttpRequestProgressDelegate CallerProgress);
+    };
+
+    /** Records the time until the end of the scope as a stage of a call, unless UrlPath is empty */
+    class FPlayFabMetricScope
+    {
+    public:
+        FPlayFabMetricScope(const FString& InUrlPath, EPlayFabMetricStage InStage)
+            : UrlPath(InUrlPath), Stage(InStage), StartTime(InUrlPath.IsEmpty() ? 0.0 : FPlatformTime::Seconds())
+        {
+        }
+
+        ~FPlayFabMetricScope()
+        {
+            if (!UrlPath.IsEmpty())
+            {
+                FPlayFabMetrics::RecordStage(UrlPath, Stage, FPlatformTime::Seconds() - StartTime);
+            }
+        }
+
+    private:
+        const FString& UrlPath;
+        EPlayFabMetricStage Stage;
+        double StartTime;
+    };
+}
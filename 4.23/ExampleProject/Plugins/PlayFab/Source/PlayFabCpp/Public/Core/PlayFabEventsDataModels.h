@@ -34,6 +34,15 @@ namespace EventsModels
             Type(src.Type)
             {}
 
+        FEntityKey(FEntityKey&& src) :
+            FPlayFabCppBaseModel(),
+            Id(MoveTemp(src.Id)),
+            Type(MoveTemp(src.Type))
+            {}
+
+        FEntityKey& operator=(const FEntityKey& src) = default;
+        FEntityKey& operator=(FEntityKey&& src) = default;
+
         FEntityKey(const TSharedPtr<FJsonObject>& obj) : FEntityKey()
         {
             readFromValue(obj);
@@ -42,7 +51,13 @@ namespace EventsModels
         ~FEntityKey();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEventContents : public PlayFab::FPlayFabCppBaseModel
@@ -98,7 +113,7 @@ namespace EventsModels
         FEventContents(const FEventContents& src) :
             FPlayFabCppBaseModel(),
             CustomTags(src.CustomTags),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             EventNamespace(src.EventNamespace),
             Name(src.Name),
             OriginalId(src.OriginalId),
@@ -107,6 +122,21 @@ namespace EventsModels
             PayloadJSON(src.PayloadJSON)
             {}
 
+        FEventContents(FEventContents&& src) :
+            FPlayFabCppBaseModel(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            EventNamespace(MoveTemp(src.EventNamespace)),
+            Name(MoveTemp(src.Name)),
+            OriginalId(MoveTemp(src.OriginalId)),
+            OriginalTimestamp(MoveTemp(src.OriginalTimestamp)),
+            Payload(MoveTemp(src.Payload)),
+            PayloadJSON(MoveTemp(src.PayloadJSON))
+            {}
+
+        FEventContents& operator=(const FEventContents& src) = default;
+        FEventContents& operator=(FEventContents&& src) = default;
+
         FEventContents(const TSharedPtr<FJsonObject>& obj) : FEventContents()
         {
             readFromValue(obj);
@@ -115,7 +145,13 @@ namespace EventsModels
         ~FEventContents();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FWriteEventsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -136,6 +172,15 @@ namespace EventsModels
             Events(src.Events)
             {}
 
+        FWriteEventsRequest(FWriteEventsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Events(MoveTemp(src.Events))
+            {}
+
+        FWriteEventsRequest& operator=(const FWriteEventsRequest& src) = default;
+        FWriteEventsRequest& operator=(FWriteEventsRequest&& src) = default;
+
         FWriteEventsRequest(const TSharedPtr<FJsonObject>& obj) : FWriteEventsRequest()
         {
             readFromValue(obj);
@@ -144,7 +189,13 @@ namespace EventsModels
         ~FWriteEventsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FWriteEventsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -164,6 +215,14 @@ namespace EventsModels
             AssignedEventIds(src.AssignedEventIds)
             {}
 
+        FWriteEventsResponse(FWriteEventsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            AssignedEventIds(MoveTemp(src.AssignedEventIds))
+            {}
+
+        FWriteEventsResponse& operator=(const FWriteEventsResponse& src) = default;
+        FWriteEventsResponse& operator=(FWriteEventsResponse&& src) = default;
+
         FWriteEventsResponse(const TSharedPtr<FJsonObject>& obj) : FWriteEventsResponse()
         {
             readFromValue(obj);
@@ -172,7 +231,13 @@ namespace EventsModels
         ~FWriteEventsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
 }
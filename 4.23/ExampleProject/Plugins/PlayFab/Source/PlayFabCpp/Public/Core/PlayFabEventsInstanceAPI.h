@@ -8,6 +8,8 @@
 
 #include "CoreMinimal.h"
 #include "Core/PlayFabError.h"
+#include "Core/PlayFabFuture.h"
+#include "Core/PlayFabRequestHandle.h"
 #include "Core/PlayFabEventsDataModels.h"
 #include "Core/PlayFabSettings.h"
 #include "PlayFabAPISettings.h"
@@ -18,8 +20,9 @@ namespace PlayFab
 {
     /**
      * Main interface for PlayFab Sdk, specifically all Events APIs
+     * When the instance is owned by a shared pointer, it can be destroyed with calls in flight; their responses are dropped.
      */
-    class PLAYFABCPP_API UPlayFabEventsInstanceAPI
+    class PLAYFABCPP_API UPlayFabEventsInstanceAPI : public TSharedFromThis<UPlayFabEventsInstanceAPI>
     {
     public:
         DECLARE_DELEGATE_OneParam(FWriteEventsDelegate, const EventsModels::FWriteEventsResponse&);
@@ -56,12 +59,16 @@ namespace PlayFab
 
         // ------------ Generated API calls
         // Write batches of entity based events to PlayStream. The namespace of the Event must be 'custom' or start with 'custom.'.
-        bool WriteEvents(EventsModels::FWriteEventsRequest& request, const FWriteEventsDelegate& SuccessDelegate = FWriteEventsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool WriteEvents(EventsModels::FWriteEventsRequest& request, const FWriteEventsDelegate& SuccessDelegate = FWriteEventsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         /**
          * Write batches of entity based events to as Telemetry events (bypass PlayStream). The namespace must be 'custom' or start
          * with 'custom.'
          */
-        bool WriteTelemetryEvents(EventsModels::FWriteEventsRequest& request, const FWriteTelemetryEventsDelegate& SuccessDelegate = FWriteTelemetryEventsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool WriteTelemetryEvents(EventsModels::FWriteEventsRequest& request, const FWriteTelemetryEventsDelegate& SuccessDelegate = FWriteTelemetryEventsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+
+        // ------------ Generated async API calls, resolving a future instead of running delegates
+        TFuture<TPlayFabResult<EventsModels::FWriteEventsResponse>> WriteEventsAsync(EventsModels::FWriteEventsRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<EventsModels::FWriteEventsResponse>> WriteTelemetryEventsAsync(EventsModels::FWriteEventsRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
 
     private:
         // ------------ Generated result handlers
@@ -8,6 +8,8 @@
 
 #include "CoreMinimal.h"
 #include "Core/PlayFabError.h"
+#include "Core/PlayFabFuture.h"
+#include "Core/PlayFabRequestHandle.h"
 #include "Core/PlayFabInsightsDataModels.h"
 #include "Core/PlayFabSettings.h"
 #include "PlayFabAPISettings.h"
@@ -18,8 +20,9 @@ namespace PlayFab
 {
     /**
      * Main interface for PlayFab Sdk, specifically all Insights APIs
+     * When the instance is owned by a shared pointer, it can be destroyed with calls in flight; their responses are dropped.
      */
-    class PLAYFABCPP_API UPlayFabInsightsInstanceAPI
+    class PLAYFABCPP_API UPlayFabInsightsInstanceAPI : public TSharedFromThis<UPlayFabInsightsInstanceAPI>
     {
     public:
         DECLARE_DELEGATE_OneParam(FGetDetailsDelegate, const InsightsModels::FInsightsGetDetailsResponse&);
@@ -63,20 +66,28 @@ namespace PlayFab
          * Gets the current values for the Insights performance and data storage retention, list of pending operations, and the
          * performance and data storage retention limits.
          */
-        bool GetDetails(InsightsModels::FInsightsEmptyRequest& request, const FGetDetailsDelegate& SuccessDelegate = FGetDetailsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool GetDetails(InsightsModels::FInsightsEmptyRequest& request, const FGetDetailsDelegate& SuccessDelegate = FGetDetailsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         /**
          * Retrieves the range of allowed values for performance and data storage retention values as well as the submeter details
          * for each performance level.
          */
-        bool GetLimits(InsightsModels::FInsightsEmptyRequest& request, const FGetLimitsDelegate& SuccessDelegate = FGetLimitsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool GetLimits(InsightsModels::FInsightsEmptyRequest& request, const FGetLimitsDelegate& SuccessDelegate = FGetLimitsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Gets the status of a SetPerformance or SetStorageRetention operation.
-        bool GetOperationStatus(InsightsModels::FInsightsGetOperationStatusRequest& request, const FGetOperationStatusDelegate& SuccessDelegate = FGetOperationStatusDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool GetOperationStatus(InsightsModels::FInsightsGetOperationStatusRequest& request, const FGetOperationStatusDelegate& SuccessDelegate = FGetOperationStatusDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Gets a list of pending SetPerformance and/or SetStorageRetention operations for the title.
-        bool GetPendingOperations(InsightsModels::FInsightsGetPendingOperationsRequest& request, const FGetPendingOperationsDelegate& SuccessDelegate = FGetPendingOperationsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool GetPendingOperations(InsightsModels::FInsightsGetPendingOperationsRequest& request, const FGetPendingOperationsDelegate& SuccessDelegate = FGetPendingOperationsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Sets the Insights performance level value for the title.
-        bool SetPerformance(InsightsModels::FInsightsSetPerformanceRequest& request, const FSetPerformanceDelegate& SuccessDelegate = FSetPerformanceDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool SetPerformance(InsightsModels::FInsightsSetPerformanceRequest& request, const FSetPerformanceDelegate& SuccessDelegate = FSetPerformanceDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Sets the Insights data storage retention days value for the title.
-        bool SetStorageRetention(InsightsModels::FInsightsSetStorageRetentionRequest& request, const FSetStorageRetentionDelegate& SuccessDelegate = FSetStorageRetentionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool SetStorageRetention(InsightsModels::FInsightsSetStorageRetentionRequest& request, const FSetStorageRetentionDelegate& SuccessDelegate = FSetStorageRetentionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+
+        // ------------ Generated async API calls, resolving a future instead of running delegates
+        TFuture<TPlayFabResult<InsightsModels::FInsightsGetDetailsResponse>> GetDetailsAsync(InsightsModels::FInsightsEmptyRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<InsightsModels::FInsightsGetLimitsResponse>> GetLimitsAsync(InsightsModels::FInsightsEmptyRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<InsightsModels::FInsightsGetOperationStatusResponse>> GetOperationStatusAsync(InsightsModels::FInsightsGetOperationStatusRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<InsightsModels::FInsightsGetPendingOperationsResponse>> GetPendingOperationsAsync(InsightsModels::FInsightsGetPendingOperationsRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<InsightsModels::FInsightsOperationResponse>> SetPerformanceAsync(InsightsModels::FInsightsSetPerformanceRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<InsightsModels::FInsightsOperationResponse>> SetStorageRetentionAsync(InsightsModels::FInsightsSetStorageRetentionRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
 
     private:
         // ------------ Generated result handlers
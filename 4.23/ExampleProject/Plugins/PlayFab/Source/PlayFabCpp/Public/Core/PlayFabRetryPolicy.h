@@ -0,0 +1,36 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PlayFabError.h"
+
+namespace PlayFab
+{
+    /**
+     * Decides whether a failed call is sent again, and after how long.
+     * Only idempotent calls are ever retried, on throttling errors, timeouts and server errors; any other call may already have run.
+     * Every retry is paid for from a budget per title, which refills at UPlayFabRuntimeSettings::RetryBudgetPerMinute.
+     */
+    class PLAYFABCPP_API FPlayFabRetryPolicy
+    {
+    public:
+        // The service turned the call away because of load or rate limits
+        static bool IsThrottlingError(const FPlayFabCppError& Error);
+        // The call failed in transit or on the server, and might succeed if sent again
+        static bool IsTransientError(const FPlayFabCppError& Error);
+
+        /**
+         * Returns the delay before retry number RetryAttempt (starting at 1), or a negative value if the call must not be retried.
+         * RetryAfterSeconds is the wait requested by the service, or zero if none was given.
+         * A retry that is granted has already been taken from the budget of TitleKey.
+         */
+        static float GetRetryDelay(const FPlayFabCppError& Error, bool bIsIdempotent, int32 RetryAttempt, float RetryAfterSeconds, const FString& TitleKey);
+
+    private:
+        static bool ConsumeRetryBudget(const FString& TitleKey, int32 BudgetPerMinute);
+    };
+}
@@ -5,6 +5,7 @@
 
 #include "PfTestActor.h"
 
+#include "Tests/PlayFabCppCoreTests.h"
 #include "Tests/PlayFabCppTests.h"
 #include "Tests/PlayFabBlueprintTests.h"
 
@@ -48,9 +49,11 @@ void APfTestActor::BeginPlay()
 {
     Super::BeginPlay();
 
+    pCppCoreTests = NewObject<UPlayFabCppCoreTests>();
     pCppTests = NewObject<UPlayFabCppTests>();
     pBpTests = NewObject<UPlayFabBlueprintTests>();
 
+    AddTestCase(pCppCoreTests);
     AddTestCase(pCppTests);
     AddTestCase(pBpTests);
 
@@ -6,6 +6,7 @@
 #include "RunTestsCommandlet.h"
 #include "ExampleProject.h"
 
+#include "Tests/PlayFabCppCoreTests.h"
 #include "Tests/PlayFabCppTests.h"
 #include "Tests/PlayFabBlueprintTests.h"
 
@@ -66,9 +67,11 @@ int32 URunTestsCommandlet::Main(const FString& Params)
         return 1;
     }
 
+    pCppCoreTests = NewObject<UPlayFabCppCoreTests>();
     pCppTests = NewObject<UPlayFabCppTests>();
     pBpTests = NewObject<UPlayFabBlueprintTests>();
 
+    AddTestCase(pCppCoreTests);
     AddTestCase(pCppTests);
     AddTestCase(pBpTests);
 
@@ -25,6 +25,7 @@ namespace PlayFab
     }
 }
 
+class UPlayFabCppCoreTests;
 class UPlayFabCppTests;
 class UPlayFabBlueprintTests;
 class UTestTitleDataLoader;
@@ -46,6 +47,8 @@ private:
     UPROPERTY()
     ACloudScriptTestResultUploader* pUploader;
     UPROPERTY()
+    UPlayFabCppCoreTests* pCppCoreTests;
+    UPROPERTY()
     UPlayFabCppTests* pCppTests;
     UPROPERTY()
     UPlayFabBlueprintTests* pBpTests;
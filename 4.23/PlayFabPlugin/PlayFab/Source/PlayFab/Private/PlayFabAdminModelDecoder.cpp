@@ -11,6 +11,7 @@
 
 #include "PlayFabAdminModelDecoder.h"
 #include "PlayFabPrivate.h"
+#include "PlayFabJsonDecoder.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Admin API Functions
@@ -25,9 +26,9 @@ FAdminBanUsersResult UPlayFabAdminModelDecoder::decodeBanUsersResultResponse(UPl
 {
     // Temp ustruct
     FAdminBanUsersResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    tempStruct.BanData = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("BanData"));
 
     return tempStruct;
 }
@@ -36,10 +37,10 @@ FAdminDeleteMasterPlayerAccountResult UPlayFabAdminModelDecoder::decodeDeleteMas
 {
     // Temp ustruct
     FAdminDeleteMasterPlayerAccountResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.JobReceiptId = !(dataObj->HasField("JobReceiptId")) ? TEXT("") : dataObj->GetStringField("JobReceiptId");
-    tempStruct.TitleIds = !(dataObj->HasField("TitleIds")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("TitleIds"), TEXT(","));
+    tempStruct.JobReceiptId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("JobReceiptId"));
+    tempStruct.TitleIds = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("TitleIds"));
 
     return tempStruct;
 }
@@ -66,9 +67,9 @@ FAdminExportMasterPlayerDataResult UPlayFabAdminModelDecoder::decodeExportMaster
 {
     // Temp ustruct
     FAdminExportMasterPlayerDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.JobReceiptId = !(dataObj->HasField("JobReceiptId")) ? TEXT("") : dataObj->GetStringField("JobReceiptId");
+    tempStruct.JobReceiptId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("JobReceiptId"));
 
     return tempStruct;
 }
@@ -77,9 +78,9 @@ FAdminGetPlayedTitleListResult UPlayFabAdminModelDecoder::decodeGetPlayedTitleLi
 {
     // Temp ustruct
     FAdminGetPlayedTitleListResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.TitleIds = !(dataObj->HasField("TitleIds")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("TitleIds"), TEXT(","));
+    tempStruct.TitleIds = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("TitleIds"));
 
     return tempStruct;
 }
@@ -88,9 +89,9 @@ FAdminGetPlayerIdFromAuthTokenResult UPlayFabAdminModelDecoder::decodeGetPlayerI
 {
     // Temp ustruct
     FAdminGetPlayerIdFromAuthTokenResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
 
     return tempStruct;
 }
@@ -99,9 +100,9 @@ FAdminGetPlayerProfileResult UPlayFabAdminModelDecoder::decodeGetPlayerProfileRe
 {
     // Temp ustruct
     FAdminGetPlayerProfileResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.PlayerProfile = !(dataObj->HasField("PlayerProfile")) ? nullptr : dataObj->GetObjectField("PlayerProfile");
+    tempStruct.PlayerProfile = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("PlayerProfile"));
 
     return tempStruct;
 }
@@ -110,9 +111,9 @@ FAdminLookupUserAccountInfoResult UPlayFabAdminModelDecoder::decodeLookupUserAcc
 {
     // Temp ustruct
     FAdminLookupUserAccountInfoResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.UserInfo = !(dataObj->HasField("UserInfo")) ? nullptr : dataObj->GetObjectField("UserInfo");
+    tempStruct.UserInfo = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("UserInfo"));
 
     return tempStruct;
 }
@@ -121,9 +122,9 @@ FAdminGetUserBansResult UPlayFabAdminModelDecoder::decodeGetUserBansResultRespon
 {
     // Temp ustruct
     FAdminGetUserBansResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    tempStruct.BanData = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("BanData"));
 
     return tempStruct;
 }
@@ -141,9 +142,9 @@ FAdminRevokeAllBansForUserResult UPlayFabAdminModelDecoder::decodeRevokeAllBansF
 {
     // Temp ustruct
     FAdminRevokeAllBansForUserResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    tempStruct.BanData = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("BanData"));
 
     return tempStruct;
 }
@@ -152,9 +153,9 @@ FAdminRevokeBansResult UPlayFabAdminModelDecoder::decodeRevokeBansResultResponse
 {
     // Temp ustruct
     FAdminRevokeBansResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    tempStruct.BanData = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("BanData"));
 
     return tempStruct;
 }
@@ -172,9 +173,9 @@ FAdminUpdateBansResult UPlayFabAdminModelDecoder::decodeUpdateBansResultResponse
 {
     // Temp ustruct
     FAdminUpdateBansResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    tempStruct.BanData = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("BanData"));
 
     return tempStruct;
 }
@@ -183,9 +184,9 @@ FAdminUpdateUserTitleDisplayNameResult UPlayFabAdminModelDecoder::decodeUpdateUs
 {
     // Temp ustruct
     FAdminUpdateUserTitleDisplayNameResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.DisplayName = !(dataObj->HasField("DisplayName")) ? TEXT("") : dataObj->GetStringField("DisplayName");
+    tempStruct.DisplayName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("DisplayName"));
 
     return tempStruct;
 }
@@ -209,9 +210,9 @@ FAdminCreatePlayerSharedSecretResult UPlayFabAdminModelDecoder::decodeCreatePlay
 {
     // Temp ustruct
     FAdminCreatePlayerSharedSecretResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.SecretKey = !(dataObj->HasField("SecretKey")) ? TEXT("") : dataObj->GetStringField("SecretKey");
+    tempStruct.SecretKey = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SecretKey"));
 
     return tempStruct;
 }
@@ -229,9 +230,9 @@ FAdminGetPlayerSharedSecretsResult UPlayFabAdminModelDecoder::decodeGetPlayerSha
 {
     // Temp ustruct
     FAdminGetPlayerSharedSecretsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.SharedSecrets = !(dataObj->HasField("SharedSecrets")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("SharedSecrets");
+    tempStruct.SharedSecrets = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("SharedSecrets"));
 
     return tempStruct;
 }
@@ -240,11 +241,11 @@ FAdminGetPolicyResponse UPlayFabAdminModelDecoder::decodeGetPolicyResponseRespon
 {
     // Temp ustruct
     FAdminGetPolicyResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.PolicyName = !(dataObj->HasField("PolicyName")) ? TEXT("") : dataObj->GetStringField("PolicyName");
-    tempStruct.PolicyVersion = !(dataObj->HasField("PolicyVersion")) ? 0 : int(dataObj->GetNumberField("PolicyVersion"));
-    tempStruct.Statements = !(dataObj->HasField("Statements")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Statements");
+    tempStruct.PolicyName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PolicyName"));
+    tempStruct.PolicyVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("PolicyVersion"));
+    tempStruct.Statements = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Statements"));
 
     return tempStruct;
 }
@@ -253,9 +254,9 @@ FAdminListOpenIdConnectionResponse UPlayFabAdminModelDecoder::decodeListOpenIdCo
 {
     // Temp ustruct
     FAdminListOpenIdConnectionResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Connections = !(dataObj->HasField("Connections")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Connections");
+    tempStruct.Connections = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Connections"));
 
     return tempStruct;
 }
@@ -282,10 +283,10 @@ FAdminUpdatePolicyResponse UPlayFabAdminModelDecoder::decodeUpdatePolicyResponse
 {
     // Temp ustruct
     FAdminUpdatePolicyResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.PolicyName = !(dataObj->HasField("PolicyName")) ? TEXT("") : dataObj->GetStringField("PolicyName");
-    tempStruct.Statements = !(dataObj->HasField("Statements")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Statements");
+    tempStruct.PolicyName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PolicyName"));
+    tempStruct.Statements = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Statements"));
 
     return tempStruct;
 }
@@ -324,11 +325,11 @@ FAdminGetContentListResult UPlayFabAdminModelDecoder::decodeGetContentListResult
 {
     // Temp ustruct
     FAdminGetContentListResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Contents = !(dataObj->HasField("Contents")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Contents");
-    tempStruct.ItemCount = !(dataObj->HasField("ItemCount")) ? 0 : int(dataObj->GetNumberField("ItemCount"));
-    tempStruct.TotalSize = !(dataObj->HasField("TotalSize")) ? 0 : int(dataObj->GetNumberField("TotalSize"));
+    tempStruct.Contents = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Contents"));
+    tempStruct.ItemCount = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ItemCount"));
+    tempStruct.TotalSize = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("TotalSize"));
 
     return tempStruct;
 }
@@ -337,9 +338,9 @@ FAdminGetContentUploadUrlResult UPlayFabAdminModelDecoder::decodeGetContentUploa
 {
     // Temp ustruct
     FAdminGetContentUploadUrlResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.URL = !(dataObj->HasField("URL")) ? TEXT("") : dataObj->GetStringField("URL");
+    tempStruct.URL = FPlayFabJsonDecoder::GetString(dataObj, TEXT("URL"));
 
     return tempStruct;
 }
@@ -354,18 +355,18 @@ FAdminAddServerBuildResult UPlayFabAdminModelDecoder::decodeAddServerBuildResult
 {
     // Temp ustruct
     FAdminAddServerBuildResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ActiveRegions = !(dataObj->HasField("ActiveRegions")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("ActiveRegions"), TEXT(","));
-    tempStruct.BuildId = !(dataObj->HasField("BuildId")) ? TEXT("") : dataObj->GetStringField("BuildId");
-    tempStruct.CommandLineTemplate = !(dataObj->HasField("CommandLineTemplate")) ? TEXT("") : dataObj->GetStringField("CommandLineTemplate");
-    tempStruct.Comment = !(dataObj->HasField("Comment")) ? TEXT("") : dataObj->GetStringField("Comment");
-    tempStruct.ExecutablePath = !(dataObj->HasField("ExecutablePath")) ? TEXT("") : dataObj->GetStringField("ExecutablePath");
-    tempStruct.MaxGamesPerHost = !(dataObj->HasField("MaxGamesPerHost")) ? 0 : int(dataObj->GetNumberField("MaxGamesPerHost"));
-    tempStruct.MinFreeGameSlots = !(dataObj->HasField("MinFreeGameSlots")) ? 0 : int(dataObj->GetNumberField("MinFreeGameSlots"));
-    GetEnumValueFromString<EGameBuildStatus>(TEXT("EGameBuildStatus"), dataObj->GetStringField("Status"), tempStruct.Status);
-    tempStruct.Timestamp = !(dataObj->HasField("Timestamp")) ? TEXT("") : dataObj->GetStringField("Timestamp");
-    tempStruct.TitleId = !(dataObj->HasField("TitleId")) ? TEXT("") : dataObj->GetStringField("TitleId");
+    tempStruct.ActiveRegions = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("ActiveRegions"));
+    tempStruct.BuildId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("BuildId"));
+    tempStruct.CommandLineTemplate = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CommandLineTemplate"));
+    tempStruct.Comment = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Comment"));
+    tempStruct.ExecutablePath = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ExecutablePath"));
+    tempStruct.MaxGamesPerHost = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("MaxGamesPerHost"));
+    tempStruct.MinFreeGameSlots = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("MinFreeGameSlots"));
+    GetEnumValueFromString<EGameBuildStatus>(TEXT("EGameBuildStatus"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("Status")), tempStruct.Status);
+    tempStruct.Timestamp = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Timestamp"));
+    tempStruct.TitleId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("TitleId"));
 
     return tempStruct;
 }
@@ -374,17 +375,17 @@ FAdminGetServerBuildInfoResult UPlayFabAdminModelDecoder::decodeGetServerBuildIn
 {
     // Temp ustruct
     FAdminGetServerBuildInfoResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ActiveRegions = !(dataObj->HasField("ActiveRegions")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("ActiveRegions"), TEXT(","));
-    tempStruct.BuildId = !(dataObj->HasField("BuildId")) ? TEXT("") : dataObj->GetStringField("BuildId");
-    tempStruct.Comment = !(dataObj->HasField("Comment")) ? TEXT("") : dataObj->GetStringField("Comment");
-    tempStruct.ErrorMessage = !(dataObj->HasField("ErrorMessage")) ? TEXT("") : dataObj->GetStringField("ErrorMessage");
-    tempStruct.MaxGamesPerHost = !(dataObj->HasField("MaxGamesPerHost")) ? 0 : int(dataObj->GetNumberField("MaxGamesPerHost"));
-    tempStruct.MinFreeGameSlots = !(dataObj->HasField("MinFreeGameSlots")) ? 0 : int(dataObj->GetNumberField("MinFreeGameSlots"));
-    GetEnumValueFromString<EGameBuildStatus>(TEXT("EGameBuildStatus"), dataObj->GetStringField("Status"), tempStruct.Status);
-    tempStruct.Timestamp = !(dataObj->HasField("Timestamp")) ? TEXT("") : dataObj->GetStringField("Timestamp");
-    tempStruct.TitleId = !(dataObj->HasField("TitleId")) ? TEXT("") : dataObj->GetStringField("TitleId");
+    tempStruct.ActiveRegions = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("ActiveRegions"));
+    tempStruct.BuildId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("BuildId"));
+    tempStruct.Comment = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Comment"));
+    tempStruct.ErrorMessage = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ErrorMessage"));
+    tempStruct.MaxGamesPerHost = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("MaxGamesPerHost"));
+    tempStruct.MinFreeGameSlots = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("MinFreeGameSlots"));
+    GetEnumValueFromString<EGameBuildStatus>(TEXT("EGameBuildStatus"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("Status")), tempStruct.Status);
+    tempStruct.Timestamp = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Timestamp"));
+    tempStruct.TitleId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("TitleId"));
 
     return tempStruct;
 }
@@ -393,9 +394,9 @@ FAdminGetServerBuildUploadURLResult UPlayFabAdminModelDecoder::decodeGetServerBu
 {
     // Temp ustruct
     FAdminGetServerBuildUploadURLResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.URL = !(dataObj->HasField("URL")) ? TEXT("") : dataObj->GetStringField("URL");
+    tempStruct.URL = FPlayFabJsonDecoder::GetString(dataObj, TEXT("URL"));
 
     return tempStruct;
 }
@@ -404,9 +405,9 @@ FAdminListBuildsResult UPlayFabAdminModelDecoder::decodeListBuildsResultResponse
 {
     // Temp ustruct
     FAdminListBuildsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Builds = !(dataObj->HasField("Builds")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Builds");
+    tempStruct.Builds = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Builds"));
 
     return tempStruct;
 }
@@ -415,18 +416,18 @@ FAdminModifyServerBuildResult UPlayFabAdminModelDecoder::decodeModifyServerBuild
 {
     // Temp ustruct
     FAdminModifyServerBuildResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ActiveRegions = !(dataObj->HasField("ActiveRegions")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("ActiveRegions"), TEXT(","));
-    tempStruct.BuildId = !(dataObj->HasField("BuildId")) ? TEXT("") : dataObj->GetStringField("BuildId");
-    tempStruct.CommandLineTemplate = !(dataObj->HasField("CommandLineTemplate")) ? TEXT("") : dataObj->GetStringField("CommandLineTemplate");
-    tempStruct.Comment = !(dataObj->HasField("Comment")) ? TEXT("") : dataObj->GetStringField("Comment");
-    tempStruct.ExecutablePath = !(dataObj->HasField("ExecutablePath")) ? TEXT("") : dataObj->GetStringField("ExecutablePath");
-    tempStruct.MaxGamesPerHost = !(dataObj->HasField("MaxGamesPerHost")) ? 0 : int(dataObj->GetNumberField("MaxGamesPerHost"));
-    tempStruct.MinFreeGameSlots = !(dataObj->HasField("MinFreeGameSlots")) ? 0 : int(dataObj->GetNumberField("MinFreeGameSlots"));
-    GetEnumValueFromString<EGameBuildStatus>(TEXT("EGameBuildStatus"), dataObj->GetStringField("Status"), tempStruct.Status);
-    tempStruct.Timestamp = !(dataObj->HasField("Timestamp")) ? TEXT("") : dataObj->GetStringField("Timestamp");
-    tempStruct.TitleId = !(dataObj->HasField("TitleId")) ? TEXT("") : dataObj->GetStringField("TitleId");
+    tempStruct.ActiveRegions = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("ActiveRegions"));
+    tempStruct.BuildId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("BuildId"));
+    tempStruct.CommandLineTemplate = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CommandLineTemplate"));
+    tempStruct.Comment = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Comment"));
+    tempStruct.ExecutablePath = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ExecutablePath"));
+    tempStruct.MaxGamesPerHost = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("MaxGamesPerHost"));
+    tempStruct.MinFreeGameSlots = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("MinFreeGameSlots"));
+    GetEnumValueFromString<EGameBuildStatus>(TEXT("EGameBuildStatus"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("Status")), tempStruct.Status);
+    tempStruct.Timestamp = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Timestamp"));
+    tempStruct.TitleId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("TitleId"));
 
     return tempStruct;
 }
@@ -450,20 +451,20 @@ FAdminGetMatchmakerGameInfoResult UPlayFabAdminModelDecoder::decodeGetMatchmaker
 {
     // Temp ustruct
     FAdminGetMatchmakerGameInfoResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.BuildVersion = !(dataObj->HasField("BuildVersion")) ? TEXT("") : dataObj->GetStringField("BuildVersion");
-    tempStruct.EndTime = !(dataObj->HasField("EndTime")) ? TEXT("") : dataObj->GetStringField("EndTime");
-    tempStruct.LobbyId = !(dataObj->HasField("LobbyId")) ? TEXT("") : dataObj->GetStringField("LobbyId");
-    tempStruct.Mode = !(dataObj->HasField("Mode")) ? TEXT("") : dataObj->GetStringField("Mode");
-    tempStruct.Players = !(dataObj->HasField("Players")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("Players"), TEXT(","));
-    GetEnumValueFromString<ERegion>(TEXT("ERegion"), dataObj->GetStringField("Region"), tempStruct.Region);
-    tempStruct.ServerIPV4Address = !(dataObj->HasField("ServerIPV4Address")) ? TEXT("") : dataObj->GetStringField("ServerIPV4Address");
-    tempStruct.ServerIPV6Address = !(dataObj->HasField("ServerIPV6Address")) ? TEXT("") : dataObj->GetStringField("ServerIPV6Address");
-    tempStruct.ServerPort = !(dataObj->HasField("ServerPort")) ? 0 : int(dataObj->GetNumberField("ServerPort"));
-    tempStruct.ServerPublicDNSName = !(dataObj->HasField("ServerPublicDNSName")) ? TEXT("") : dataObj->GetStringField("ServerPublicDNSName");
-    tempStruct.StartTime = !(dataObj->HasField("StartTime")) ? TEXT("") : dataObj->GetStringField("StartTime");
-    tempStruct.TitleId = !(dataObj->HasField("TitleId")) ? TEXT("") : dataObj->GetStringField("TitleId");
+    tempStruct.BuildVersion = FPlayFabJsonDecoder::GetString(dataObj, TEXT("BuildVersion"));
+    tempStruct.EndTime = FPlayFabJsonDecoder::GetString(dataObj, TEXT("EndTime"));
+    tempStruct.LobbyId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("LobbyId"));
+    tempStruct.Mode = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Mode"));
+    tempStruct.Players = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("Players"));
+    GetEnumValueFromString<ERegion>(TEXT("ERegion"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("Region")), tempStruct.Region);
+    tempStruct.ServerIPV4Address = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ServerIPV4Address"));
+    tempStruct.ServerIPV6Address = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ServerIPV6Address"));
+    tempStruct.ServerPort = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ServerPort"));
+    tempStruct.ServerPublicDNSName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ServerPublicDNSName"));
+    tempStruct.StartTime = FPlayFabJsonDecoder::GetString(dataObj, TEXT("StartTime"));
+    tempStruct.TitleId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("TitleId"));
 
     return tempStruct;
 }
@@ -472,9 +473,9 @@ FAdminGetMatchmakerGameModesResult UPlayFabAdminModelDecoder::decodeGetMatchmake
 {
     // Temp ustruct
     FAdminGetMatchmakerGameModesResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.GameModes = !(dataObj->HasField("GameModes")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("GameModes");
+    tempStruct.GameModes = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("GameModes"));
 
     return tempStruct;
 }
@@ -498,9 +499,9 @@ FAdminCreatePlayerStatisticDefinitionResult UPlayFabAdminModelDecoder::decodeCre
 {
     // Temp ustruct
     FAdminCreatePlayerStatisticDefinitionResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Statistic = !(dataObj->HasField("Statistic")) ? nullptr : dataObj->GetObjectField("Statistic");
+    tempStruct.Statistic = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Statistic"));
 
     return tempStruct;
 }
@@ -509,9 +510,9 @@ FAdminGetDataReportResult UPlayFabAdminModelDecoder::decodeGetDataReportResultRe
 {
     // Temp ustruct
     FAdminGetDataReportResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.DownloadUrl = !(dataObj->HasField("DownloadUrl")) ? TEXT("") : dataObj->GetStringField("DownloadUrl");
+    tempStruct.DownloadUrl = FPlayFabJsonDecoder::GetString(dataObj, TEXT("DownloadUrl"));
 
     return tempStruct;
 }
@@ -520,9 +521,9 @@ FAdminGetPlayerStatisticDefinitionsResult UPlayFabAdminModelDecoder::decodeGetPl
 {
     // Temp ustruct
     FAdminGetPlayerStatisticDefinitionsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Statistics = !(dataObj->HasField("Statistics")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Statistics");
+    tempStruct.Statistics = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Statistics"));
 
     return tempStruct;
 }
@@ -531,9 +532,9 @@ FAdminGetPlayerStatisticVersionsResult UPlayFabAdminModelDecoder::decodeGetPlaye
 {
     // Temp ustruct
     FAdminGetPlayerStatisticVersionsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.StatisticVersions = !(dataObj->HasField("StatisticVersions")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("StatisticVersions");
+    tempStruct.StatisticVersions = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("StatisticVersions"));
 
     return tempStruct;
 }
@@ -542,11 +543,11 @@ FAdminGetUserDataResult UPlayFabAdminModelDecoder::decodeGetUserDataResultRespon
 {
     // Temp ustruct
     FAdminGetUserDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Data"));
+    tempStruct.DataVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("DataVersion"));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
 
     return tempStruct;
 }
@@ -555,9 +556,9 @@ FAdminIncrementPlayerStatisticVersionResult UPlayFabAdminModelDecoder::decodeInc
 {
     // Temp ustruct
     FAdminIncrementPlayerStatisticVersionResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.StatisticVersion = !(dataObj->HasField("StatisticVersion")) ? nullptr : dataObj->GetObjectField("StatisticVersion");
+    tempStruct.StatisticVersion = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("StatisticVersion"));
 
     return tempStruct;
 }
@@ -566,9 +567,9 @@ FAdminRefundPurchaseResponse UPlayFabAdminModelDecoder::decodeRefundPurchaseResp
 {
     // Temp ustruct
     FAdminRefundPurchaseResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.PurchaseStatus = !(dataObj->HasField("PurchaseStatus")) ? TEXT("") : dataObj->GetStringField("PurchaseStatus");
+    tempStruct.PurchaseStatus = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PurchaseStatus"));
 
     return tempStruct;
 }
@@ -586,9 +587,9 @@ FAdminResolvePurchaseDisputeResponse UPlayFabAdminModelDecoder::decodeResolvePur
 {
     // Temp ustruct
     FAdminResolvePurchaseDisputeResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.PurchaseStatus = !(dataObj->HasField("PurchaseStatus")) ? TEXT("") : dataObj->GetStringField("PurchaseStatus");
+    tempStruct.PurchaseStatus = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PurchaseStatus"));
 
     return tempStruct;
 }
@@ -597,9 +598,9 @@ FAdminUpdatePlayerStatisticDefinitionResult UPlayFabAdminModelDecoder::decodeUpd
 {
     // Temp ustruct
     FAdminUpdatePlayerStatisticDefinitionResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Statistic = !(dataObj->HasField("Statistic")) ? nullptr : dataObj->GetObjectField("Statistic");
+    tempStruct.Statistic = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Statistic"));
 
     return tempStruct;
 }
@@ -608,9 +609,9 @@ FAdminUpdateUserDataResult UPlayFabAdminModelDecoder::decodeUpdateUserDataResult
 {
     // Temp ustruct
     FAdminUpdateUserDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
+    tempStruct.DataVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("DataVersion"));
 
     return tempStruct;
 }
@@ -625,12 +626,12 @@ FAdminModifyUserVirtualCurrencyResult UPlayFabAdminModelDecoder::decodeModifyUse
 {
     // Temp ustruct
     FAdminModifyUserVirtualCurrencyResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Balance = !(dataObj->HasField("Balance")) ? 0 : int(dataObj->GetNumberField("Balance"));
-    tempStruct.BalanceChange = !(dataObj->HasField("BalanceChange")) ? 0 : int(dataObj->GetNumberField("BalanceChange"));
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? TEXT("") : dataObj->GetStringField("VirtualCurrency");
+    tempStruct.Balance = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("Balance"));
+    tempStruct.BalanceChange = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("BalanceChange"));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
+    tempStruct.VirtualCurrency = FPlayFabJsonDecoder::GetString(dataObj, TEXT("VirtualCurrency"));
 
     return tempStruct;
 }
@@ -639,9 +640,9 @@ FAdminCheckLimitedEditionItemAvailabilityResult UPlayFabAdminModelDecoder::decod
 {
     // Temp ustruct
     FAdminCheckLimitedEditionItemAvailabilityResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Amount = !(dataObj->HasField("Amount")) ? 0 : int(dataObj->GetNumberField("Amount"));
+    tempStruct.Amount = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("Amount"));
 
     return tempStruct;
 }
@@ -650,12 +651,12 @@ FAdminGetUserInventoryResult UPlayFabAdminModelDecoder::decodeGetUserInventoryRe
 {
     // Temp ustruct
     FAdminGetUserInventoryResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Inventory = !(dataObj->HasField("Inventory")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Inventory");
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? nullptr : dataObj->GetObjectField("VirtualCurrency");
-    tempStruct.VirtualCurrencyRechargeTimes = !(dataObj->HasField("VirtualCurrencyRechargeTimes")) ? nullptr : dataObj->GetObjectField("VirtualCurrencyRechargeTimes");
+    tempStruct.Inventory = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Inventory"));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
+    tempStruct.VirtualCurrency = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("VirtualCurrency"));
+    tempStruct.VirtualCurrencyRechargeTimes = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("VirtualCurrencyRechargeTimes"));
 
     return tempStruct;
 }
@@ -664,9 +665,9 @@ FAdminGrantItemsToUsersResult UPlayFabAdminModelDecoder::decodeGrantItemsToUsers
 {
     // Temp ustruct
     FAdminGrantItemsToUsersResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ItemGrantResults = !(dataObj->HasField("ItemGrantResults")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("ItemGrantResults");
+    tempStruct.ItemGrantResults = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("ItemGrantResults"));
 
     return tempStruct;
 }
@@ -693,9 +694,9 @@ FAdminRevokeInventoryItemsResult UPlayFabAdminModelDecoder::decodeRevokeInventor
 {
     // Temp ustruct
     FAdminRevokeInventoryItemsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Errors = !(dataObj->HasField("Errors")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Errors");
+    tempStruct.Errors = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Errors"));
 
     return tempStruct;
 }
@@ -719,9 +720,9 @@ FAdminGetAllSegmentsResult UPlayFabAdminModelDecoder::decodeGetAllSegmentsResult
 {
     // Temp ustruct
     FAdminGetAllSegmentsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Segments = !(dataObj->HasField("Segments")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Segments");
+    tempStruct.Segments = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Segments"));
 
     return tempStruct;
 }
@@ -730,9 +731,9 @@ FAdminGetPlayerSegmentsResult UPlayFabAdminModelDecoder::decodeGetPlayerSegments
 {
     // Temp ustruct
     FAdminGetPlayerSegmentsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Segments = !(dataObj->HasField("Segments")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Segments");
+    tempStruct.Segments = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Segments"));
 
     return tempStruct;
 }
@@ -741,11 +742,11 @@ FAdminGetPlayersInSegmentResult UPlayFabAdminModelDecoder::decodeGetPlayersInSeg
 {
     // Temp ustruct
     FAdminGetPlayersInSegmentResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ContinuationToken = !(dataObj->HasField("ContinuationToken")) ? TEXT("") : dataObj->GetStringField("ContinuationToken");
-    tempStruct.PlayerProfiles = !(dataObj->HasField("PlayerProfiles")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("PlayerProfiles");
-    tempStruct.ProfilesInSegment = !(dataObj->HasField("ProfilesInSegment")) ? 0 : int(dataObj->GetNumberField("ProfilesInSegment"));
+    tempStruct.ContinuationToken = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ContinuationToken"));
+    tempStruct.PlayerProfiles = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("PlayerProfiles"));
+    tempStruct.ProfilesInSegment = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ProfilesInSegment"));
 
     return tempStruct;
 }
@@ -754,10 +755,10 @@ FAdminGetPlayerTagsResult UPlayFabAdminModelDecoder::decodeGetPlayerTagsResultRe
 {
     // Temp ustruct
     FAdminGetPlayerTagsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.Tags = !(dataObj->HasField("Tags")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("Tags"), TEXT(","));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
+    tempStruct.Tags = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("Tags"));
 
     return tempStruct;
 }
@@ -781,9 +782,9 @@ FAdminCreateTaskResult UPlayFabAdminModelDecoder::decodeCreateTaskResultResponse
 {
     // Temp ustruct
     FAdminCreateTaskResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.TaskId = !(dataObj->HasField("TaskId")) ? TEXT("") : dataObj->GetStringField("TaskId");
+    tempStruct.TaskId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("TaskId"));
 
     return tempStruct;
 }
@@ -792,10 +793,10 @@ FAdminGetActionsOnPlayersInSegmentTaskInstanceResult UPlayFabAdminModelDecoder::
 {
     // Temp ustruct
     FAdminGetActionsOnPlayersInSegmentTaskInstanceResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Parameter = !(dataObj->HasField("Parameter")) ? nullptr : dataObj->GetObjectField("Parameter");
-    tempStruct.Summary = !(dataObj->HasField("Summary")) ? nullptr : dataObj->GetObjectField("Summary");
+    tempStruct.Parameter = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Parameter"));
+    tempStruct.Summary = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Summary"));
 
     return tempStruct;
 }
@@ -804,10 +805,10 @@ FAdminGetCloudScriptTaskInstanceResult UPlayFabAdminModelDecoder::decodeGetCloud
 {
     // Temp ustruct
     FAdminGetCloudScriptTaskInstanceResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Parameter = !(dataObj->HasField("Parameter")) ? nullptr : dataObj->GetObjectField("Parameter");
-    tempStruct.Summary = !(dataObj->HasField("Summary")) ? nullptr : dataObj->GetObjectField("Summary");
+    tempStruct.Parameter = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Parameter"));
+    tempStruct.Summary = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Summary"));
 
     return tempStruct;
 }
@@ -816,9 +817,9 @@ FAdminGetTaskInstancesResult UPlayFabAdminModelDecoder::decodeGetTaskInstancesRe
 {
     // Temp ustruct
     FAdminGetTaskInstancesResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Summaries = !(dataObj->HasField("Summaries")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Summaries");
+    tempStruct.Summaries = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Summaries"));
 
     return tempStruct;
 }
@@ -827,9 +828,9 @@ FAdminGetTasksResult UPlayFabAdminModelDecoder::decodeGetTasksResultResponse(UPl
 {
     // Temp ustruct
     FAdminGetTasksResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Tasks = !(dataObj->HasField("Tasks")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Tasks");
+    tempStruct.Tasks = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Tasks"));
 
     return tempStruct;
 }
@@ -838,9 +839,9 @@ FAdminRunTaskResult UPlayFabAdminModelDecoder::decodeRunTaskResultResponse(UPlay
 {
     // Temp ustruct
     FAdminRunTaskResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.TaskInstanceId = !(dataObj->HasField("TaskInstanceId")) ? TEXT("") : dataObj->GetStringField("TaskInstanceId");
+    tempStruct.TaskInstanceId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("TaskInstanceId"));
 
     return tempStruct;
 }
@@ -855,10 +856,10 @@ FAdminCreateSegmentResponse UPlayFabAdminModelDecoder::decodeCreateSegmentRespon
 {
     // Temp ustruct
     FAdminCreateSegmentResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ErrorMessage = !(dataObj->HasField("ErrorMessage")) ? TEXT("") : dataObj->GetStringField("ErrorMessage");
-    tempStruct.SegmentId = !(dataObj->HasField("SegmentId")) ? TEXT("") : dataObj->GetStringField("SegmentId");
+    tempStruct.ErrorMessage = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ErrorMessage"));
+    tempStruct.SegmentId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SegmentId"));
 
     return tempStruct;
 }
@@ -867,9 +868,9 @@ FAdminDeleteSegmentsResponse UPlayFabAdminModelDecoder::decodeDeleteSegmentsResp
 {
     // Temp ustruct
     FAdminDeleteSegmentsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ErrorMessage = !(dataObj->HasField("ErrorMessage")) ? TEXT("") : dataObj->GetStringField("ErrorMessage");
+    tempStruct.ErrorMessage = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ErrorMessage"));
 
     return tempStruct;
 }
@@ -878,10 +879,10 @@ FAdminGetSegmentsResponse UPlayFabAdminModelDecoder::decodeGetSegmentsResponseRe
 {
     // Temp ustruct
     FAdminGetSegmentsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ErrorMessage = !(dataObj->HasField("ErrorMessage")) ? TEXT("") : dataObj->GetStringField("ErrorMessage");
-    tempStruct.Segments = !(dataObj->HasField("Segments")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Segments");
+    tempStruct.ErrorMessage = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ErrorMessage"));
+    tempStruct.Segments = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Segments"));
 
     return tempStruct;
 }
@@ -890,10 +891,10 @@ FAdminUpdateSegmentResponse UPlayFabAdminModelDecoder::decodeUpdateSegmentRespon
 {
     // Temp ustruct
     FAdminUpdateSegmentResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ErrorMessage = !(dataObj->HasField("ErrorMessage")) ? TEXT("") : dataObj->GetStringField("ErrorMessage");
-    tempStruct.SegmentId = !(dataObj->HasField("SegmentId")) ? TEXT("") : dataObj->GetStringField("SegmentId");
+    tempStruct.ErrorMessage = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ErrorMessage"));
+    tempStruct.SegmentId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SegmentId"));
 
     return tempStruct;
 }
@@ -908,13 +909,13 @@ FAdminGetCloudScriptRevisionResult UPlayFabAdminModelDecoder::decodeGetCloudScri
 {
     // Temp ustruct
     FAdminGetCloudScriptRevisionResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.CreatedAt = !(dataObj->HasField("CreatedAt")) ? TEXT("") : dataObj->GetStringField("CreatedAt");
-    tempStruct.Files = !(dataObj->HasField("Files")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Files");
-    tempStruct.IsPublished = !(dataObj->HasField("IsPublished")) ? false : dataObj->GetBoolField("IsPublished");
-    tempStruct.Revision = !(dataObj->HasField("Revision")) ? 0 : int(dataObj->GetNumberField("Revision"));
-    tempStruct.Version = !(dataObj->HasField("Version")) ? 0 : int(dataObj->GetNumberField("Version"));
+    tempStruct.CreatedAt = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CreatedAt"));
+    tempStruct.Files = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Files"));
+    tempStruct.IsPublished = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("IsPublished"));
+    tempStruct.Revision = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("Revision"));
+    tempStruct.Version = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("Version"));
 
     return tempStruct;
 }
@@ -923,9 +924,9 @@ FAdminGetCloudScriptVersionsResult UPlayFabAdminModelDecoder::decodeGetCloudScri
 {
     // Temp ustruct
     FAdminGetCloudScriptVersionsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Versions = !(dataObj->HasField("Versions")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Versions");
+    tempStruct.Versions = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Versions"));
 
     return tempStruct;
 }
@@ -943,10 +944,10 @@ FAdminUpdateCloudScriptResult UPlayFabAdminModelDecoder::decodeUpdateCloudScript
 {
     // Temp ustruct
     FAdminUpdateCloudScriptResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Revision = !(dataObj->HasField("Revision")) ? 0 : int(dataObj->GetNumberField("Revision"));
-    tempStruct.Version = !(dataObj->HasField("Version")) ? 0 : int(dataObj->GetNumberField("Version"));
+    tempStruct.Revision = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("Revision"));
+    tempStruct.Version = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("Version"));
 
     return tempStruct;
 }
@@ -985,9 +986,9 @@ FAdminAddNewsResult UPlayFabAdminModelDecoder::decodeAddNewsResultResponse(UPlay
 {
     // Temp ustruct
     FAdminAddNewsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.NewsId = !(dataObj->HasField("NewsId")) ? TEXT("") : dataObj->GetStringField("NewsId");
+    tempStruct.NewsId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("NewsId"));
 
     return tempStruct;
 }
@@ -1014,9 +1015,9 @@ FAdminGetCatalogItemsResult UPlayFabAdminModelDecoder::decodeGetCatalogItemsResu
 {
     // Temp ustruct
     FAdminGetCatalogItemsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Catalog = !(dataObj->HasField("Catalog")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Catalog");
+    tempStruct.Catalog = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Catalog"));
 
     return tempStruct;
 }
@@ -1025,9 +1026,9 @@ FAdminGetPublisherDataResult UPlayFabAdminModelDecoder::decodeGetPublisherDataRe
 {
     // Temp ustruct
     FAdminGetPublisherDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -1036,9 +1037,9 @@ FAdminGetRandomResultTablesResult UPlayFabAdminModelDecoder::decodeGetRandomResu
 {
     // Temp ustruct
     FAdminGetRandomResultTablesResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Tables = !(dataObj->HasField("Tables")) ? nullptr : dataObj->GetObjectField("Tables");
+    tempStruct.Tables = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Tables"));
 
     return tempStruct;
 }
@@ -1047,13 +1048,13 @@ FAdminGetStoreItemsResult UPlayFabAdminModelDecoder::decodeGetStoreItemsResultRe
 {
     // Temp ustruct
     FAdminGetStoreItemsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.CatalogVersion = !(dataObj->HasField("CatalogVersion")) ? TEXT("") : dataObj->GetStringField("CatalogVersion");
-    tempStruct.MarketingData = !(dataObj->HasField("MarketingData")) ? nullptr : dataObj->GetObjectField("MarketingData");
-    GetEnumValueFromString<EPfSourceType>(TEXT("EPfSourceType"), dataObj->GetStringField("Source"), tempStruct.Source);
-    tempStruct.Store = !(dataObj->HasField("Store")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Store");
-    tempStruct.StoreId = !(dataObj->HasField("StoreId")) ? TEXT("") : dataObj->GetStringField("StoreId");
+    tempStruct.CatalogVersion = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CatalogVersion"));
+    tempStruct.MarketingData = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("MarketingData"));
+    GetEnumValueFromString<EPfSourceType>(TEXT("EPfSourceType"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("Source")), tempStruct.Source);
+    tempStruct.Store = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Store"));
+    tempStruct.StoreId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("StoreId"));
 
     return tempStruct;
 }
@@ -1062,9 +1063,9 @@ FAdminGetTitleDataResult UPlayFabAdminModelDecoder::decodeGetTitleDataResultResp
 {
     // Temp ustruct
     FAdminGetTitleDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -1073,9 +1074,9 @@ FAdminListVirtualCurrencyTypesResult UPlayFabAdminModelDecoder::decodeListVirtua
 {
     // Temp ustruct
     FAdminListVirtualCurrencyTypesResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.VirtualCurrencies = !(dataObj->HasField("VirtualCurrencies")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("VirtualCurrencies");
+    tempStruct.VirtualCurrencies = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("VirtualCurrencies"));
 
     return tempStruct;
 }
@@ -1120,9 +1121,9 @@ FAdminSetupPushNotificationResult UPlayFabAdminModelDecoder::decodeSetupPushNoti
 {
     // Temp ustruct
     FAdminSetupPushNotificationResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ARN = !(dataObj->HasField("ARN")) ? TEXT("") : dataObj->GetStringField("ARN");
+    tempStruct.ARN = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ARN"));
 
     return tempStruct;
 }
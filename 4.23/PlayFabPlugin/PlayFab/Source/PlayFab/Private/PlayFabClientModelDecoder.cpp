@@ -11,6 +11,7 @@
 
 #include "PlayFabClientModelDecoder.h"
 #include "PlayFabPrivate.h"
+#include "PlayFabJsonDecoder.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Client API Functions
@@ -43,9 +44,9 @@ FClientAddUsernamePasswordResult UPlayFabClientModelDecoder::decodeAddUsernamePa
 {
     // Temp ustruct
     FClientAddUsernamePasswordResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Username = !(dataObj->HasField("Username")) ? TEXT("") : dataObj->GetStringField("Username");
+    tempStruct.Username = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Username"));
 
     return tempStruct;
 }
@@ -54,9 +55,9 @@ FClientGetAccountInfoResult UPlayFabClientModelDecoder::decodeGetAccountInfoResu
 {
     // Temp ustruct
     FClientGetAccountInfoResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.AccountInfo = !(dataObj->HasField("AccountInfo")) ? nullptr : dataObj->GetObjectField("AccountInfo");
+    tempStruct.AccountInfo = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("AccountInfo"));
 
     return tempStruct;
 }
@@ -65,10 +66,10 @@ FClientGetPlayerCombinedInfoResult UPlayFabClientModelDecoder::decodeGetPlayerCo
 {
     // Temp ustruct
     FClientGetPlayerCombinedInfoResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.InfoResultPayload = !(dataObj->HasField("InfoResultPayload")) ? nullptr : dataObj->GetObjectField("InfoResultPayload");
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
+    tempStruct.InfoResultPayload = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("InfoResultPayload"));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
 
     return tempStruct;
 }
@@ -77,9 +78,9 @@ FClientGetPlayerProfileResult UPlayFabClientModelDecoder::decodeGetPlayerProfile
 {
     // Temp ustruct
     FClientGetPlayerProfileResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.PlayerProfile = !(dataObj->HasField("PlayerProfile")) ? nullptr : dataObj->GetObjectField("PlayerProfile");
+    tempStruct.PlayerProfile = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("PlayerProfile"));
 
     return tempStruct;
 }
@@ -88,9 +89,9 @@ FClientGetPlayFabIDsFromFacebookIDsResult UPlayFabClientModelDecoder::decodeGetP
 {
     // Temp ustruct
     FClientGetPlayFabIDsFromFacebookIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -99,9 +100,9 @@ FClientGetPlayFabIDsFromFacebookInstantGamesIdsResult UPlayFabClientModelDecoder
 {
     // Temp ustruct
     FClientGetPlayFabIDsFromFacebookInstantGamesIdsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -110,9 +111,9 @@ FClientGetPlayFabIDsFromGameCenterIDsResult UPlayFabClientModelDecoder::decodeGe
 {
     // Temp ustruct
     FClientGetPlayFabIDsFromGameCenterIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -121,9 +122,9 @@ FClientGetPlayFabIDsFromGenericIDsResult UPlayFabClientModelDecoder::decodeGetPl
 {
     // Temp ustruct
     FClientGetPlayFabIDsFromGenericIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -132,9 +133,9 @@ FClientGetPlayFabIDsFromGoogleIDsResult UPlayFabClientModelDecoder::decodeGetPla
 {
     // Temp ustruct
     FClientGetPlayFabIDsFromGoogleIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -143,9 +144,9 @@ FClientGetPlayFabIDsFromKongregateIDsResult UPlayFabClientModelDecoder::decodeGe
 {
     // Temp ustruct
     FClientGetPlayFabIDsFromKongregateIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -154,9 +155,9 @@ FClientGetPlayFabIDsFromNintendoSwitchDeviceIdsResult UPlayFabClientModelDecoder
 {
     // Temp ustruct
     FClientGetPlayFabIDsFromNintendoSwitchDeviceIdsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -165,9 +166,9 @@ FClientGetPlayFabIDsFromPSNAccountIDsResult UPlayFabClientModelDecoder::decodeGe
 {
     // Temp ustruct
     FClientGetPlayFabIDsFromPSNAccountIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -176,9 +177,9 @@ FClientGetPlayFabIDsFromSteamIDsResult UPlayFabClientModelDecoder::decodeGetPlay
 {
     // Temp ustruct
     FClientGetPlayFabIDsFromSteamIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -187,9 +188,9 @@ FClientGetPlayFabIDsFromTwitchIDsResult UPlayFabClientModelDecoder::decodeGetPla
 {
     // Temp ustruct
     FClientGetPlayFabIDsFromTwitchIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -198,9 +199,9 @@ FClientGetPlayFabIDsFromXboxLiveIDsResult UPlayFabClientModelDecoder::decodeGetP
 {
     // Temp ustruct
     FClientGetPlayFabIDsFromXboxLiveIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -362,9 +363,9 @@ FClientReportPlayerClientResult UPlayFabClientModelDecoder::decodeReportPlayerCl
 {
     // Temp ustruct
     FClientReportPlayerClientResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.SubmissionsRemaining = !(dataObj->HasField("SubmissionsRemaining")) ? 0 : int(dataObj->GetNumberField("SubmissionsRemaining"));
+    tempStruct.SubmissionsRemaining = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("SubmissionsRemaining"));
 
     return tempStruct;
 }
@@ -517,9 +518,9 @@ FClientUpdateUserTitleDisplayNameResult UPlayFabClientModelDecoder::decodeUpdate
 {
     // Temp ustruct
     FClientUpdateUserTitleDisplayNameResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.DisplayName = !(dataObj->HasField("DisplayName")) ? TEXT("") : dataObj->GetStringField("DisplayName");
+    tempStruct.DisplayName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("DisplayName"));
 
     return tempStruct;
 }
@@ -534,9 +535,9 @@ FClientGetAdPlacementsResult UPlayFabClientModelDecoder::decodeGetAdPlacementsRe
 {
     // Temp ustruct
     FClientGetAdPlacementsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.AdPlacements = !(dataObj->HasField("AdPlacements")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("AdPlacements");
+    tempStruct.AdPlacements = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("AdPlacements"));
 
     return tempStruct;
 }
@@ -554,15 +555,15 @@ FClientRewardAdActivityResult UPlayFabClientModelDecoder::decodeRewardAdActivity
 {
     // Temp ustruct
     FClientRewardAdActivityResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.AdActivityEventId = !(dataObj->HasField("AdActivityEventId")) ? TEXT("") : dataObj->GetStringField("AdActivityEventId");
-    tempStruct.DebugResults = !(dataObj->HasField("DebugResults")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("DebugResults"), TEXT(","));
-    tempStruct.PlacementId = !(dataObj->HasField("PlacementId")) ? TEXT("") : dataObj->GetStringField("PlacementId");
-    tempStruct.PlacementName = !(dataObj->HasField("PlacementName")) ? TEXT("") : dataObj->GetStringField("PlacementName");
-    tempStruct.PlacementViewsRemaining = !(dataObj->HasField("PlacementViewsRemaining")) ? 0 : int(dataObj->GetNumberField("PlacementViewsRemaining"));
-    tempStruct.PlacementViewsResetMinutes = !(dataObj->HasField("PlacementViewsResetMinutes")) ? 0 : int(dataObj->GetNumberField("PlacementViewsResetMinutes"));
-    tempStruct.RewardResults = !(dataObj->HasField("RewardResults")) ? nullptr : dataObj->GetObjectField("RewardResults");
+    tempStruct.AdActivityEventId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("AdActivityEventId"));
+    tempStruct.DebugResults = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("DebugResults"));
+    tempStruct.PlacementId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlacementId"));
+    tempStruct.PlacementName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlacementName"));
+    tempStruct.PlacementViewsRemaining = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("PlacementViewsRemaining"));
+    tempStruct.PlacementViewsResetMinutes = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("PlacementViewsResetMinutes"));
+    tempStruct.RewardResults = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("RewardResults"));
 
     return tempStruct;
 }
@@ -577,9 +578,9 @@ FClientWriteEventResponse UPlayFabClientModelDecoder::decodeWriteEventResponseRe
 {
     // Temp ustruct
     FClientWriteEventResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.EventId = !(dataObj->HasField("EventId")) ? TEXT("") : dataObj->GetStringField("EventId");
+    tempStruct.EventId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("EventId"));
 
     return tempStruct;
 }
@@ -594,9 +595,9 @@ FClientGetPhotonAuthenticationTokenResult UPlayFabClientModelDecoder::decodeGetP
 {
     // Temp ustruct
     FClientGetPhotonAuthenticationTokenResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.PhotonCustomAuthenticationToken = !(dataObj->HasField("PhotonCustomAuthenticationToken")) ? TEXT("") : dataObj->GetStringField("PhotonCustomAuthenticationToken");
+    tempStruct.PhotonCustomAuthenticationToken = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PhotonCustomAuthenticationToken"));
 
     return tempStruct;
 }
@@ -605,9 +606,9 @@ FClientGetTitlePublicKeyResult UPlayFabClientModelDecoder::decodeGetTitlePublicK
 {
     // Temp ustruct
     FClientGetTitlePublicKeyResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.RSAPublicKey = !(dataObj->HasField("RSAPublicKey")) ? TEXT("") : dataObj->GetStringField("RSAPublicKey");
+    tempStruct.RSAPublicKey = FPlayFabJsonDecoder::GetString(dataObj, TEXT("RSAPublicKey"));
 
     return tempStruct;
 }
@@ -616,9 +617,9 @@ FClientGetWindowsHelloChallengeResponse UPlayFabClientModelDecoder::decodeGetWin
 {
     // Temp ustruct
     FClientGetWindowsHelloChallengeResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Challenge = !(dataObj->HasField("Challenge")) ? TEXT("") : dataObj->GetStringField("Challenge");
+    tempStruct.Challenge = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Challenge"));
 
     return tempStruct;
 }
@@ -627,16 +628,16 @@ FClientLoginResult UPlayFabClientModelDecoder::decodeLoginResultResponse(UPlayFa
 {
     // Temp ustruct
     FClientLoginResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.EntityToken = !(dataObj->HasField("EntityToken")) ? nullptr : dataObj->GetObjectField("EntityToken");
-    tempStruct.InfoResultPayload = !(dataObj->HasField("InfoResultPayload")) ? nullptr : dataObj->GetObjectField("InfoResultPayload");
-    tempStruct.LastLoginTime = !(dataObj->HasField("LastLoginTime")) ? TEXT("") : dataObj->GetStringField("LastLoginTime");
-    tempStruct.NewlyCreated = !(dataObj->HasField("NewlyCreated")) ? false : dataObj->GetBoolField("NewlyCreated");
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.SessionTicket = !(dataObj->HasField("SessionTicket")) ? TEXT("") : dataObj->GetStringField("SessionTicket");
-    tempStruct.SettingsForUser = !(dataObj->HasField("SettingsForUser")) ? nullptr : dataObj->GetObjectField("SettingsForUser");
-    tempStruct.TreatmentAssignment = !(dataObj->HasField("TreatmentAssignment")) ? nullptr : dataObj->GetObjectField("TreatmentAssignment");
+    tempStruct.EntityToken = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("EntityToken"));
+    tempStruct.InfoResultPayload = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("InfoResultPayload"));
+    tempStruct.LastLoginTime = FPlayFabJsonDecoder::GetString(dataObj, TEXT("LastLoginTime"));
+    tempStruct.NewlyCreated = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("NewlyCreated"));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
+    tempStruct.SessionTicket = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SessionTicket"));
+    tempStruct.SettingsForUser = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("SettingsForUser"));
+    tempStruct.TreatmentAssignment = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("TreatmentAssignment"));
 
     return tempStruct;
 }
@@ -645,13 +646,13 @@ FClientRegisterPlayFabUserResult UPlayFabClientModelDecoder::decodeRegisterPlayF
 {
     // Temp ustruct
     FClientRegisterPlayFabUserResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.EntityToken = !(dataObj->HasField("EntityToken")) ? nullptr : dataObj->GetObjectField("EntityToken");
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.SessionTicket = !(dataObj->HasField("SessionTicket")) ? TEXT("") : dataObj->GetStringField("SessionTicket");
-    tempStruct.SettingsForUser = !(dataObj->HasField("SettingsForUser")) ? nullptr : dataObj->GetObjectField("SettingsForUser");
-    tempStruct.Username = !(dataObj->HasField("Username")) ? TEXT("") : dataObj->GetStringField("Username");
+    tempStruct.EntityToken = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("EntityToken"));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
+    tempStruct.SessionTicket = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SessionTicket"));
+    tempStruct.SettingsForUser = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("SettingsForUser"));
+    tempStruct.Username = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Username"));
 
     return tempStruct;
 }
@@ -675,11 +676,11 @@ FClientGetCharacterDataResult UPlayFabClientModelDecoder::decodeGetCharacterData
 {
     // Temp ustruct
     FClientGetCharacterDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.CharacterId = !(dataObj->HasField("CharacterId")) ? TEXT("") : dataObj->GetStringField("CharacterId");
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
+    tempStruct.CharacterId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CharacterId"));
+    tempStruct.Data = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Data"));
+    tempStruct.DataVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("DataVersion"));
 
     return tempStruct;
 }
@@ -688,9 +689,9 @@ FClientUpdateCharacterDataResult UPlayFabClientModelDecoder::decodeUpdateCharact
 {
     // Temp ustruct
     FClientUpdateCharacterDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
+    tempStruct.DataVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("DataVersion"));
 
     return tempStruct;
 }
@@ -705,9 +706,9 @@ FClientListUsersCharactersResult UPlayFabClientModelDecoder::decodeListUsersChar
 {
     // Temp ustruct
     FClientListUsersCharactersResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Characters = !(dataObj->HasField("Characters")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Characters");
+    tempStruct.Characters = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Characters"));
 
     return tempStruct;
 }
@@ -716,9 +717,9 @@ FClientGetCharacterLeaderboardResult UPlayFabClientModelDecoder::decodeGetCharac
 {
     // Temp ustruct
     FClientGetCharacterLeaderboardResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
+    tempStruct.Leaderboard = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Leaderboard"));
 
     return tempStruct;
 }
@@ -727,9 +728,9 @@ FClientGetCharacterStatisticsResult UPlayFabClientModelDecoder::decodeGetCharact
 {
     // Temp ustruct
     FClientGetCharacterStatisticsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.CharacterStatistics = !(dataObj->HasField("CharacterStatistics")) ? nullptr : dataObj->GetObjectField("CharacterStatistics");
+    tempStruct.CharacterStatistics = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("CharacterStatistics"));
 
     return tempStruct;
 }
@@ -738,9 +739,9 @@ FClientGetLeaderboardAroundCharacterResult UPlayFabClientModelDecoder::decodeGet
 {
     // Temp ustruct
     FClientGetLeaderboardAroundCharacterResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
+    tempStruct.Leaderboard = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Leaderboard"));
 
     return tempStruct;
 }
@@ -749,9 +750,9 @@ FClientGetLeaderboardForUsersCharactersResult UPlayFabClientModelDecoder::decode
 {
     // Temp ustruct
     FClientGetLeaderboardForUsersCharactersResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
+    tempStruct.Leaderboard = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Leaderboard"));
 
     return tempStruct;
 }
@@ -760,11 +761,11 @@ FClientGrantCharacterToUserResult UPlayFabClientModelDecoder::decodeGrantCharact
 {
     // Temp ustruct
     FClientGrantCharacterToUserResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.CharacterId = !(dataObj->HasField("CharacterId")) ? TEXT("") : dataObj->GetStringField("CharacterId");
-    tempStruct.CharacterType = !(dataObj->HasField("CharacterType")) ? TEXT("") : dataObj->GetStringField("CharacterType");
-    tempStruct.Result = !(dataObj->HasField("Result")) ? false : dataObj->GetBoolField("Result");
+    tempStruct.CharacterId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CharacterId"));
+    tempStruct.CharacterType = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CharacterType"));
+    tempStruct.Result = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("Result"));
 
     return tempStruct;
 }
@@ -788,9 +789,9 @@ FClientGetContentDownloadUrlResult UPlayFabClientModelDecoder::decodeGetContentD
 {
     // Temp ustruct
     FClientGetContentDownloadUrlResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.URL = !(dataObj->HasField("URL")) ? TEXT("") : dataObj->GetStringField("URL");
+    tempStruct.URL = FPlayFabJsonDecoder::GetString(dataObj, TEXT("URL"));
 
     return tempStruct;
 }
@@ -805,9 +806,9 @@ FClientAddFriendResult UPlayFabClientModelDecoder::decodeAddFriendResultResponse
 {
     // Temp ustruct
     FClientAddFriendResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Created = !(dataObj->HasField("Created")) ? false : dataObj->GetBoolField("Created");
+    tempStruct.Created = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("Created"));
 
     return tempStruct;
 }
@@ -816,9 +817,9 @@ FClientGetFriendsListResult UPlayFabClientModelDecoder::decodeGetFriendsListResu
 {
     // Temp ustruct
     FClientGetFriendsListResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Friends = !(dataObj->HasField("Friends")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Friends");
+    tempStruct.Friends = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Friends"));
 
     return tempStruct;
 }
@@ -851,11 +852,11 @@ FClientCurrentGamesResult UPlayFabClientModelDecoder::decodeCurrentGamesResultRe
 {
     // Temp ustruct
     FClientCurrentGamesResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.GameCount = !(dataObj->HasField("GameCount")) ? 0 : int(dataObj->GetNumberField("GameCount"));
-    tempStruct.Games = !(dataObj->HasField("Games")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Games");
-    tempStruct.PlayerCount = !(dataObj->HasField("PlayerCount")) ? 0 : int(dataObj->GetNumberField("PlayerCount"));
+    tempStruct.GameCount = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("GameCount"));
+    tempStruct.Games = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Games"));
+    tempStruct.PlayerCount = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("PlayerCount"));
 
     return tempStruct;
 }
@@ -864,9 +865,9 @@ FClientGameServerRegionsResult UPlayFabClientModelDecoder::decodeGameServerRegio
 {
     // Temp ustruct
     FClientGameServerRegionsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Regions = !(dataObj->HasField("Regions")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Regions");
+    tempStruct.Regions = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Regions"));
 
     return tempStruct;
 }
@@ -875,17 +876,17 @@ FClientMatchmakeResult UPlayFabClientModelDecoder::decodeMatchmakeResultResponse
 {
     // Temp ustruct
     FClientMatchmakeResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Expires = !(dataObj->HasField("Expires")) ? TEXT("") : dataObj->GetStringField("Expires");
-    tempStruct.LobbyID = !(dataObj->HasField("LobbyID")) ? TEXT("") : dataObj->GetStringField("LobbyID");
-    tempStruct.PollWaitTimeMS = !(dataObj->HasField("PollWaitTimeMS")) ? 0 : int(dataObj->GetNumberField("PollWaitTimeMS"));
-    tempStruct.ServerIPV4Address = !(dataObj->HasField("ServerIPV4Address")) ? TEXT("") : dataObj->GetStringField("ServerIPV4Address");
-    tempStruct.ServerIPV6Address = !(dataObj->HasField("ServerIPV6Address")) ? TEXT("") : dataObj->GetStringField("ServerIPV6Address");
-    tempStruct.ServerPort = !(dataObj->HasField("ServerPort")) ? 0 : int(dataObj->GetNumberField("ServerPort"));
-    tempStruct.ServerPublicDNSName = !(dataObj->HasField("ServerPublicDNSName")) ? TEXT("") : dataObj->GetStringField("ServerPublicDNSName");
-    GetEnumValueFromString<EMatchmakeStatus>(TEXT("EMatchmakeStatus"), dataObj->GetStringField("Status"), tempStruct.Status);
-    tempStruct.Ticket = !(dataObj->HasField("Ticket")) ? TEXT("") : dataObj->GetStringField("Ticket");
+    tempStruct.Expires = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Expires"));
+    tempStruct.LobbyID = FPlayFabJsonDecoder::GetString(dataObj, TEXT("LobbyID"));
+    tempStruct.PollWaitTimeMS = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("PollWaitTimeMS"));
+    tempStruct.ServerIPV4Address = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ServerIPV4Address"));
+    tempStruct.ServerIPV6Address = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ServerIPV6Address"));
+    tempStruct.ServerPort = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ServerPort"));
+    tempStruct.ServerPublicDNSName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ServerPublicDNSName"));
+    GetEnumValueFromString<EMatchmakeStatus>(TEXT("EMatchmakeStatus"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("Status")), tempStruct.Status);
+    tempStruct.Ticket = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Ticket"));
 
     return tempStruct;
 }
@@ -894,16 +895,16 @@ FClientStartGameResult UPlayFabClientModelDecoder::decodeStartGameResultResponse
 {
     // Temp ustruct
     FClientStartGameResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Expires = !(dataObj->HasField("Expires")) ? TEXT("") : dataObj->GetStringField("Expires");
-    tempStruct.LobbyID = !(dataObj->HasField("LobbyID")) ? TEXT("") : dataObj->GetStringField("LobbyID");
-    tempStruct.Password = !(dataObj->HasField("Password")) ? TEXT("") : dataObj->GetStringField("Password");
-    tempStruct.ServerIPV4Address = !(dataObj->HasField("ServerIPV4Address")) ? TEXT("") : dataObj->GetStringField("ServerIPV4Address");
-    tempStruct.ServerIPV6Address = !(dataObj->HasField("ServerIPV6Address")) ? TEXT("") : dataObj->GetStringField("ServerIPV6Address");
-    tempStruct.ServerPort = !(dataObj->HasField("ServerPort")) ? 0 : int(dataObj->GetNumberField("ServerPort"));
-    tempStruct.ServerPublicDNSName = !(dataObj->HasField("ServerPublicDNSName")) ? TEXT("") : dataObj->GetStringField("ServerPublicDNSName");
-    tempStruct.Ticket = !(dataObj->HasField("Ticket")) ? TEXT("") : dataObj->GetStringField("Ticket");
+    tempStruct.Expires = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Expires"));
+    tempStruct.LobbyID = FPlayFabJsonDecoder::GetString(dataObj, TEXT("LobbyID"));
+    tempStruct.Password = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Password"));
+    tempStruct.ServerIPV4Address = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ServerIPV4Address"));
+    tempStruct.ServerIPV6Address = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ServerIPV6Address"));
+    tempStruct.ServerPort = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ServerPort"));
+    tempStruct.ServerPublicDNSName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ServerPublicDNSName"));
+    tempStruct.Ticket = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Ticket"));
 
     return tempStruct;
 }
@@ -927,9 +928,9 @@ FClientConsumeMicrosoftStoreEntitlementsResponse UPlayFabClientModelDecoder::dec
 {
     // Temp ustruct
     FClientConsumeMicrosoftStoreEntitlementsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Items = !(dataObj->HasField("Items")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Items");
+    tempStruct.Items = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Items"));
 
     return tempStruct;
 }
@@ -938,9 +939,9 @@ FClientConsumePS5EntitlementsResult UPlayFabClientModelDecoder::decodeConsumePS5
 {
     // Temp ustruct
     FClientConsumePS5EntitlementsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Items = !(dataObj->HasField("Items")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Items");
+    tempStruct.Items = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Items"));
 
     return tempStruct;
 }
@@ -949,9 +950,9 @@ FClientConsumePSNEntitlementsResult UPlayFabClientModelDecoder::decodeConsumePSN
 {
     // Temp ustruct
     FClientConsumePSNEntitlementsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ItemsGranted = !(dataObj->HasField("ItemsGranted")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("ItemsGranted");
+    tempStruct.ItemsGranted = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("ItemsGranted"));
 
     return tempStruct;
 }
@@ -960,9 +961,9 @@ FClientConsumeXboxEntitlementsResult UPlayFabClientModelDecoder::decodeConsumeXb
 {
     // Temp ustruct
     FClientConsumeXboxEntitlementsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Items = !(dataObj->HasField("Items")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Items");
+    tempStruct.Items = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Items"));
 
     return tempStruct;
 }
@@ -980,9 +981,9 @@ FClientRestoreIOSPurchasesResult UPlayFabClientModelDecoder::decodeRestoreIOSPur
 {
     // Temp ustruct
     FClientRestoreIOSPurchasesResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Fulfillments = !(dataObj->HasField("Fulfillments")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Fulfillments");
+    tempStruct.Fulfillments = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Fulfillments"));
 
     return tempStruct;
 }
@@ -991,9 +992,9 @@ FClientValidateAmazonReceiptResult UPlayFabClientModelDecoder::decodeValidateAma
 {
     // Temp ustruct
     FClientValidateAmazonReceiptResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Fulfillments = !(dataObj->HasField("Fulfillments")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Fulfillments");
+    tempStruct.Fulfillments = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Fulfillments"));
 
     return tempStruct;
 }
@@ -1002,9 +1003,9 @@ FClientValidateGooglePlayPurchaseResult UPlayFabClientModelDecoder::decodeValida
 {
     // Temp ustruct
     FClientValidateGooglePlayPurchaseResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Fulfillments = !(dataObj->HasField("Fulfillments")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Fulfillments");
+    tempStruct.Fulfillments = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Fulfillments"));
 
     return tempStruct;
 }
@@ -1013,9 +1014,9 @@ FClientValidateIOSReceiptResult UPlayFabClientModelDecoder::decodeValidateIOSRec
 {
     // Temp ustruct
     FClientValidateIOSReceiptResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Fulfillments = !(dataObj->HasField("Fulfillments")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Fulfillments");
+    tempStruct.Fulfillments = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Fulfillments"));
 
     return tempStruct;
 }
@@ -1024,9 +1025,9 @@ FClientValidateWindowsReceiptResult UPlayFabClientModelDecoder::decodeValidateWi
 {
     // Temp ustruct
     FClientValidateWindowsReceiptResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Fulfillments = !(dataObj->HasField("Fulfillments")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Fulfillments");
+    tempStruct.Fulfillments = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Fulfillments"));
 
     return tempStruct;
 }
@@ -1041,11 +1042,11 @@ FClientGetLeaderboardResult UPlayFabClientModelDecoder::decodeGetLeaderboardResu
 {
     // Temp ustruct
     FClientGetLeaderboardResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
-    tempStruct.NextReset = !(dataObj->HasField("NextReset")) ? TEXT("") : dataObj->GetStringField("NextReset");
-    tempStruct.Version = !(dataObj->HasField("Version")) ? 0 : int(dataObj->GetNumberField("Version"));
+    tempStruct.Leaderboard = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Leaderboard"));
+    tempStruct.NextReset = FPlayFabJsonDecoder::GetString(dataObj, TEXT("NextReset"));
+    tempStruct.Version = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("Version"));
 
     return tempStruct;
 }
@@ -1054,11 +1055,11 @@ FClientGetFriendLeaderboardAroundPlayerResult UPlayFabClientModelDecoder::decode
 {
     // Temp ustruct
     FClientGetFriendLeaderboardAroundPlayerResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
-    tempStruct.NextReset = !(dataObj->HasField("NextReset")) ? TEXT("") : dataObj->GetStringField("NextReset");
-    tempStruct.Version = !(dataObj->HasField("Version")) ? 0 : int(dataObj->GetNumberField("Version"));
+    tempStruct.Leaderboard = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Leaderboard"));
+    tempStruct.NextReset = FPlayFabJsonDecoder::GetString(dataObj, TEXT("NextReset"));
+    tempStruct.Version = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("Version"));
 
     return tempStruct;
 }
@@ -1067,11 +1068,11 @@ FClientGetLeaderboardAroundPlayerResult UPlayFabClientModelDecoder::decodeGetLea
 {
     // Temp ustruct
     FClientGetLeaderboardAroundPlayerResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
-    tempStruct.NextReset = !(dataObj->HasField("NextReset")) ? TEXT("") : dataObj->GetStringField("NextReset");
-    tempStruct.Version = !(dataObj->HasField("Version")) ? 0 : int(dataObj->GetNumberField("Version"));
+    tempStruct.Leaderboard = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Leaderboard"));
+    tempStruct.NextReset = FPlayFabJsonDecoder::GetString(dataObj, TEXT("NextReset"));
+    tempStruct.Version = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("Version"));
 
     return tempStruct;
 }
@@ -1080,9 +1081,9 @@ FClientGetPlayerStatisticsResult UPlayFabClientModelDecoder::decodeGetPlayerStat
 {
     // Temp ustruct
     FClientGetPlayerStatisticsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Statistics = !(dataObj->HasField("Statistics")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Statistics");
+    tempStruct.Statistics = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Statistics"));
 
     return tempStruct;
 }
@@ -1091,9 +1092,9 @@ FClientGetPlayerStatisticVersionsResult UPlayFabClientModelDecoder::decodeGetPla
 {
     // Temp ustruct
     FClientGetPlayerStatisticVersionsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.StatisticVersions = !(dataObj->HasField("StatisticVersions")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("StatisticVersions");
+    tempStruct.StatisticVersions = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("StatisticVersions"));
 
     return tempStruct;
 }
@@ -1102,10 +1103,10 @@ FClientGetUserDataResult UPlayFabClientModelDecoder::decodeGetUserDataResultResp
 {
     // Temp ustruct
     FClientGetUserDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
+    tempStruct.Data = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Data"));
+    tempStruct.DataVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("DataVersion"));
 
     return tempStruct;
 }
@@ -1123,9 +1124,9 @@ FClientUpdateUserDataResult UPlayFabClientModelDecoder::decodeUpdateUserDataResu
 {
     // Temp ustruct
     FClientUpdateUserDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
+    tempStruct.DataVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("DataVersion"));
 
     return tempStruct;
 }
@@ -1140,12 +1141,12 @@ FClientModifyUserVirtualCurrencyResult UPlayFabClientModelDecoder::decodeModifyU
 {
     // Temp ustruct
     FClientModifyUserVirtualCurrencyResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Balance = !(dataObj->HasField("Balance")) ? 0 : int(dataObj->GetNumberField("Balance"));
-    tempStruct.BalanceChange = !(dataObj->HasField("BalanceChange")) ? 0 : int(dataObj->GetNumberField("BalanceChange"));
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? TEXT("") : dataObj->GetStringField("VirtualCurrency");
+    tempStruct.Balance = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("Balance"));
+    tempStruct.BalanceChange = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("BalanceChange"));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
+    tempStruct.VirtualCurrency = FPlayFabJsonDecoder::GetString(dataObj, TEXT("VirtualCurrency"));
 
     return tempStruct;
 }
@@ -1154,11 +1155,11 @@ FClientConfirmPurchaseResult UPlayFabClientModelDecoder::decodeConfirmPurchaseRe
 {
     // Temp ustruct
     FClientConfirmPurchaseResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Items = !(dataObj->HasField("Items")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Items");
-    tempStruct.OrderId = !(dataObj->HasField("OrderId")) ? TEXT("") : dataObj->GetStringField("OrderId");
-    tempStruct.PurchaseDate = !(dataObj->HasField("PurchaseDate")) ? TEXT("") : dataObj->GetStringField("PurchaseDate");
+    tempStruct.Items = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Items"));
+    tempStruct.OrderId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("OrderId"));
+    tempStruct.PurchaseDate = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PurchaseDate"));
 
     return tempStruct;
 }
@@ -1167,10 +1168,10 @@ FClientConsumeItemResult UPlayFabClientModelDecoder::decodeConsumeItemResultResp
 {
     // Temp ustruct
     FClientConsumeItemResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ItemInstanceId = !(dataObj->HasField("ItemInstanceId")) ? TEXT("") : dataObj->GetStringField("ItemInstanceId");
-    tempStruct.RemainingUses = !(dataObj->HasField("RemainingUses")) ? 0 : int(dataObj->GetNumberField("RemainingUses"));
+    tempStruct.ItemInstanceId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ItemInstanceId"));
+    tempStruct.RemainingUses = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("RemainingUses"));
 
     return tempStruct;
 }
@@ -1179,12 +1180,12 @@ FClientGetCharacterInventoryResult UPlayFabClientModelDecoder::decodeGetCharacte
 {
     // Temp ustruct
     FClientGetCharacterInventoryResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.CharacterId = !(dataObj->HasField("CharacterId")) ? TEXT("") : dataObj->GetStringField("CharacterId");
-    tempStruct.Inventory = !(dataObj->HasField("Inventory")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Inventory");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? nullptr : dataObj->GetObjectField("VirtualCurrency");
-    tempStruct.VirtualCurrencyRechargeTimes = !(dataObj->HasField("VirtualCurrencyRechargeTimes")) ? nullptr : dataObj->GetObjectField("VirtualCurrencyRechargeTimes");
+    tempStruct.CharacterId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CharacterId"));
+    tempStruct.Inventory = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Inventory"));
+    tempStruct.VirtualCurrency = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("VirtualCurrency"));
+    tempStruct.VirtualCurrencyRechargeTimes = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("VirtualCurrencyRechargeTimes"));
 
     return tempStruct;
 }
@@ -1193,10 +1194,10 @@ FClientGetPaymentTokenResult UPlayFabClientModelDecoder::decodeGetPaymentTokenRe
 {
     // Temp ustruct
     FClientGetPaymentTokenResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.OrderId = !(dataObj->HasField("OrderId")) ? TEXT("") : dataObj->GetStringField("OrderId");
-    tempStruct.ProviderToken = !(dataObj->HasField("ProviderToken")) ? TEXT("") : dataObj->GetStringField("ProviderToken");
+    tempStruct.OrderId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("OrderId"));
+    tempStruct.ProviderToken = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ProviderToken"));
 
     return tempStruct;
 }
@@ -1205,13 +1206,13 @@ FClientGetPurchaseResult UPlayFabClientModelDecoder::decodeGetPurchaseResultResp
 {
     // Temp ustruct
     FClientGetPurchaseResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.OrderId = !(dataObj->HasField("OrderId")) ? TEXT("") : dataObj->GetStringField("OrderId");
-    tempStruct.PaymentProvider = !(dataObj->HasField("PaymentProvider")) ? TEXT("") : dataObj->GetStringField("PaymentProvider");
-    tempStruct.PurchaseDate = !(dataObj->HasField("PurchaseDate")) ? TEXT("") : dataObj->GetStringField("PurchaseDate");
-    tempStruct.TransactionId = !(dataObj->HasField("TransactionId")) ? TEXT("") : dataObj->GetStringField("TransactionId");
-    tempStruct.TransactionStatus = !(dataObj->HasField("TransactionStatus")) ? TEXT("") : dataObj->GetStringField("TransactionStatus");
+    tempStruct.OrderId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("OrderId"));
+    tempStruct.PaymentProvider = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PaymentProvider"));
+    tempStruct.PurchaseDate = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PurchaseDate"));
+    tempStruct.TransactionId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("TransactionId"));
+    tempStruct.TransactionStatus = FPlayFabJsonDecoder::GetString(dataObj, TEXT("TransactionStatus"));
 
     return tempStruct;
 }
@@ -1220,11 +1221,11 @@ FClientGetUserInventoryResult UPlayFabClientModelDecoder::decodeGetUserInventory
 {
     // Temp ustruct
     FClientGetUserInventoryResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Inventory = !(dataObj->HasField("Inventory")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Inventory");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? nullptr : dataObj->GetObjectField("VirtualCurrency");
-    tempStruct.VirtualCurrencyRechargeTimes = !(dataObj->HasField("VirtualCurrencyRechargeTimes")) ? nullptr : dataObj->GetObjectField("VirtualCurrencyRechargeTimes");
+    tempStruct.Inventory = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Inventory"));
+    tempStruct.VirtualCurrency = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("VirtualCurrency"));
+    tempStruct.VirtualCurrencyRechargeTimes = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("VirtualCurrencyRechargeTimes"));
 
     return tempStruct;
 }
@@ -1233,18 +1234,18 @@ FClientPayForPurchaseResult UPlayFabClientModelDecoder::decodePayForPurchaseResu
 {
     // Temp ustruct
     FClientPayForPurchaseResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.CreditApplied = !(dataObj->HasField("CreditApplied")) ? 0 : int(dataObj->GetNumberField("CreditApplied"));
-    tempStruct.OrderId = !(dataObj->HasField("OrderId")) ? TEXT("") : dataObj->GetStringField("OrderId");
-    tempStruct.ProviderData = !(dataObj->HasField("ProviderData")) ? TEXT("") : dataObj->GetStringField("ProviderData");
-    tempStruct.ProviderToken = !(dataObj->HasField("ProviderToken")) ? TEXT("") : dataObj->GetStringField("ProviderToken");
-    tempStruct.PurchaseConfirmationPageURL = !(dataObj->HasField("PurchaseConfirmationPageURL")) ? TEXT("") : dataObj->GetStringField("PurchaseConfirmationPageURL");
-    tempStruct.PurchaseCurrency = !(dataObj->HasField("PurchaseCurrency")) ? TEXT("") : dataObj->GetStringField("PurchaseCurrency");
-    tempStruct.PurchasePrice = !(dataObj->HasField("PurchasePrice")) ? 0 : int(dataObj->GetNumberField("PurchasePrice"));
-    GetEnumValueFromString<ETransactionStatus>(TEXT("ETransactionStatus"), dataObj->GetStringField("Status"), tempStruct.Status);
-    tempStruct.VCAmount = !(dataObj->HasField("VCAmount")) ? nullptr : dataObj->GetObjectField("VCAmount");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? nullptr : dataObj->GetObjectField("VirtualCurrency");
+    tempStruct.CreditApplied = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("CreditApplied"));
+    tempStruct.OrderId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("OrderId"));
+    tempStruct.ProviderData = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ProviderData"));
+    tempStruct.ProviderToken = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ProviderToken"));
+    tempStruct.PurchaseConfirmationPageURL = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PurchaseConfirmationPageURL"));
+    tempStruct.PurchaseCurrency = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PurchaseCurrency"));
+    tempStruct.PurchasePrice = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("PurchasePrice"));
+    GetEnumValueFromString<ETransactionStatus>(TEXT("ETransactionStatus"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("Status")), tempStruct.Status);
+    tempStruct.VCAmount = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("VCAmount"));
+    tempStruct.VirtualCurrency = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("VirtualCurrency"));
 
     return tempStruct;
 }
@@ -1253,9 +1254,9 @@ FClientPurchaseItemResult UPlayFabClientModelDecoder::decodePurchaseItemResultRe
 {
     // Temp ustruct
     FClientPurchaseItemResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Items = !(dataObj->HasField("Items")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Items");
+    tempStruct.Items = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Items"));
 
     return tempStruct;
 }
@@ -1264,9 +1265,9 @@ FClientRedeemCouponResult UPlayFabClientModelDecoder::decodeRedeemCouponResultRe
 {
     // Temp ustruct
     FClientRedeemCouponResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.GrantedItems = !(dataObj->HasField("GrantedItems")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("GrantedItems");
+    tempStruct.GrantedItems = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("GrantedItems"));
 
     return tempStruct;
 }
@@ -1275,12 +1276,12 @@ FClientStartPurchaseResult UPlayFabClientModelDecoder::decodeStartPurchaseResult
 {
     // Temp ustruct
     FClientStartPurchaseResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Contents = !(dataObj->HasField("Contents")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Contents");
-    tempStruct.OrderId = !(dataObj->HasField("OrderId")) ? TEXT("") : dataObj->GetStringField("OrderId");
-    tempStruct.PaymentOptions = !(dataObj->HasField("PaymentOptions")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("PaymentOptions");
-    tempStruct.VirtualCurrencyBalances = !(dataObj->HasField("VirtualCurrencyBalances")) ? nullptr : dataObj->GetObjectField("VirtualCurrencyBalances");
+    tempStruct.Contents = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Contents"));
+    tempStruct.OrderId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("OrderId"));
+    tempStruct.PaymentOptions = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("PaymentOptions"));
+    tempStruct.VirtualCurrencyBalances = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("VirtualCurrencyBalances"));
 
     return tempStruct;
 }
@@ -1289,12 +1290,12 @@ FClientUnlockContainerItemResult UPlayFabClientModelDecoder::decodeUnlockContain
 {
     // Temp ustruct
     FClientUnlockContainerItemResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.GrantedItems = !(dataObj->HasField("GrantedItems")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("GrantedItems");
-    tempStruct.UnlockedItemInstanceId = !(dataObj->HasField("UnlockedItemInstanceId")) ? TEXT("") : dataObj->GetStringField("UnlockedItemInstanceId");
-    tempStruct.UnlockedWithItemInstanceId = !(dataObj->HasField("UnlockedWithItemInstanceId")) ? TEXT("") : dataObj->GetStringField("UnlockedWithItemInstanceId");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? nullptr : dataObj->GetObjectField("VirtualCurrency");
+    tempStruct.GrantedItems = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("GrantedItems"));
+    tempStruct.UnlockedItemInstanceId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("UnlockedItemInstanceId"));
+    tempStruct.UnlockedWithItemInstanceId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("UnlockedWithItemInstanceId"));
+    tempStruct.VirtualCurrency = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("VirtualCurrency"));
 
     return tempStruct;
 }
@@ -1309,9 +1310,9 @@ FClientGetPlayerSegmentsResult UPlayFabClientModelDecoder::decodeGetPlayerSegmen
 {
     // Temp ustruct
     FClientGetPlayerSegmentsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Segments = !(dataObj->HasField("Segments")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Segments");
+    tempStruct.Segments = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Segments"));
 
     return tempStruct;
 }
@@ -1320,10 +1321,10 @@ FClientGetPlayerTagsResult UPlayFabClientModelDecoder::decodeGetPlayerTagsResult
 {
     // Temp ustruct
     FClientGetPlayerTagsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.Tags = !(dataObj->HasField("Tags")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("Tags"), TEXT(","));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
+    tempStruct.Tags = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("Tags"));
 
     return tempStruct;
 }
@@ -1338,20 +1339,20 @@ FClientExecuteCloudScriptResult UPlayFabClientModelDecoder::decodeExecuteCloudSc
 {
     // Temp ustruct
     FClientExecuteCloudScriptResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.APIRequestsIssued = !(dataObj->HasField("APIRequestsIssued")) ? 0 : int(dataObj->GetNumberField("APIRequestsIssued"));
-    tempStruct.Error = !(dataObj->HasField("Error")) ? nullptr : dataObj->GetObjectField("Error");
-    tempStruct.ExecutionTimeSeconds = !(dataObj->HasField("ExecutionTimeSeconds")) ? 0 : int(dataObj->GetNumberField("ExecutionTimeSeconds"));
-    tempStruct.FunctionName = !(dataObj->HasField("FunctionName")) ? TEXT("") : dataObj->GetStringField("FunctionName");
-    tempStruct.FunctionResult = !(dataObj->HasField("FunctionResult")) ? nullptr : dataObj->GetObjectField("FunctionResult");
-    tempStruct.FunctionResultTooLarge = !(dataObj->HasField("FunctionResultTooLarge")) ? false : dataObj->GetBoolField("FunctionResultTooLarge");
-    tempStruct.HttpRequestsIssued = !(dataObj->HasField("HttpRequestsIssued")) ? 0 : int(dataObj->GetNumberField("HttpRequestsIssued"));
-    tempStruct.Logs = !(dataObj->HasField("Logs")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Logs");
-    tempStruct.LogsTooLarge = !(dataObj->HasField("LogsTooLarge")) ? false : dataObj->GetBoolField("LogsTooLarge");
-    tempStruct.MemoryConsumedBytes = !(dataObj->HasField("MemoryConsumedBytes")) ? 0 : int(dataObj->GetNumberField("MemoryConsumedBytes"));
-    tempStruct.ProcessorTimeSeconds = !(dataObj->HasField("ProcessorTimeSeconds")) ? 0 : int(dataObj->GetNumberField("ProcessorTimeSeconds"));
-    tempStruct.Revision = !(dataObj->HasField("Revision")) ? 0 : int(dataObj->GetNumberField("Revision"));
+    tempStruct.APIRequestsIssued = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("APIRequestsIssued"));
+    tempStruct.Error = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Error"));
+    tempStruct.ExecutionTimeSeconds = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ExecutionTimeSeconds"));
+    tempStruct.FunctionName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("FunctionName"));
+    tempStruct.FunctionResult = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("FunctionResult"));
+    tempStruct.FunctionResultTooLarge = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("FunctionResultTooLarge"));
+    tempStruct.HttpRequestsIssued = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("HttpRequestsIssued"));
+    tempStruct.Logs = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Logs"));
+    tempStruct.LogsTooLarge = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("LogsTooLarge"));
+    tempStruct.MemoryConsumedBytes = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("MemoryConsumedBytes"));
+    tempStruct.ProcessorTimeSeconds = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ProcessorTimeSeconds"));
+    tempStruct.Revision = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("Revision"));
 
     return tempStruct;
 }
@@ -1375,9 +1376,9 @@ FClientCreateSharedGroupResult UPlayFabClientModelDecoder::decodeCreateSharedGro
 {
     // Temp ustruct
     FClientCreateSharedGroupResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.SharedGroupId = !(dataObj->HasField("SharedGroupId")) ? TEXT("") : dataObj->GetStringField("SharedGroupId");
+    tempStruct.SharedGroupId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SharedGroupId"));
 
     return tempStruct;
 }
@@ -1386,10 +1387,10 @@ FClientGetSharedGroupDataResult UPlayFabClientModelDecoder::decodeGetSharedGroup
 {
     // Temp ustruct
     FClientGetSharedGroupDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
-    tempStruct.Members = !(dataObj->HasField("Members")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("Members"), TEXT(","));
+    tempStruct.Data = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Data"));
+    tempStruct.Members = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("Members"));
 
     return tempStruct;
 }
@@ -1422,9 +1423,9 @@ FClientGetCatalogItemsResult UPlayFabClientModelDecoder::decodeGetCatalogItemsRe
 {
     // Temp ustruct
     FClientGetCatalogItemsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Catalog = !(dataObj->HasField("Catalog")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Catalog");
+    tempStruct.Catalog = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Catalog"));
 
     return tempStruct;
 }
@@ -1433,9 +1434,9 @@ FClientGetPublisherDataResult UPlayFabClientModelDecoder::decodeGetPublisherData
 {
     // Temp ustruct
     FClientGetPublisherDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -1444,13 +1445,13 @@ FClientGetStoreItemsResult UPlayFabClientModelDecoder::decodeGetStoreItemsResult
 {
     // Temp ustruct
     FClientGetStoreItemsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.CatalogVersion = !(dataObj->HasField("CatalogVersion")) ? TEXT("") : dataObj->GetStringField("CatalogVersion");
-    tempStruct.MarketingData = !(dataObj->HasField("MarketingData")) ? nullptr : dataObj->GetObjectField("MarketingData");
-    GetEnumValueFromString<EPfSourceType>(TEXT("EPfSourceType"), dataObj->GetStringField("Source"), tempStruct.Source);
-    tempStruct.Store = !(dataObj->HasField("Store")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Store");
-    tempStruct.StoreId = !(dataObj->HasField("StoreId")) ? TEXT("") : dataObj->GetStringField("StoreId");
+    tempStruct.CatalogVersion = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CatalogVersion"));
+    tempStruct.MarketingData = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("MarketingData"));
+    GetEnumValueFromString<EPfSourceType>(TEXT("EPfSourceType"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("Source")), tempStruct.Source);
+    tempStruct.Store = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Store"));
+    tempStruct.StoreId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("StoreId"));
 
     return tempStruct;
 }
@@ -1459,9 +1460,9 @@ FClientGetTimeResult UPlayFabClientModelDecoder::decodeGetTimeResultResponse(UPl
 {
     // Temp ustruct
     FClientGetTimeResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Time = !(dataObj->HasField("Time")) ? TEXT("") : dataObj->GetStringField("Time");
+    tempStruct.Time = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Time"));
 
     return tempStruct;
 }
@@ -1470,9 +1471,9 @@ FClientGetTitleDataResult UPlayFabClientModelDecoder::decodeGetTitleDataResultRe
 {
     // Temp ustruct
     FClientGetTitleDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -1481,9 +1482,9 @@ FClientGetTitleNewsResult UPlayFabClientModelDecoder::decodeGetTitleNewsResultRe
 {
     // Temp ustruct
     FClientGetTitleNewsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.News = !(dataObj->HasField("News")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("News");
+    tempStruct.News = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("News"));
 
     return tempStruct;
 }
@@ -1498,9 +1499,9 @@ FClientAcceptTradeResponse UPlayFabClientModelDecoder::decodeAcceptTradeResponse
 {
     // Temp ustruct
     FClientAcceptTradeResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Trade = !(dataObj->HasField("Trade")) ? nullptr : dataObj->GetObjectField("Trade");
+    tempStruct.Trade = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Trade"));
 
     return tempStruct;
 }
@@ -1509,9 +1510,9 @@ FClientCancelTradeResponse UPlayFabClientModelDecoder::decodeCancelTradeResponse
 {
     // Temp ustruct
     FClientCancelTradeResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Trade = !(dataObj->HasField("Trade")) ? nullptr : dataObj->GetObjectField("Trade");
+    tempStruct.Trade = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Trade"));
 
     return tempStruct;
 }
@@ -1520,10 +1521,10 @@ FClientGetPlayerTradesResponse UPlayFabClientModelDecoder::decodeGetPlayerTrades
 {
     // Temp ustruct
     FClientGetPlayerTradesResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.AcceptedTrades = !(dataObj->HasField("AcceptedTrades")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("AcceptedTrades");
-    tempStruct.OpenedTrades = !(dataObj->HasField("OpenedTrades")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("OpenedTrades");
+    tempStruct.AcceptedTrades = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("AcceptedTrades"));
+    tempStruct.OpenedTrades = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("OpenedTrades"));
 
     return tempStruct;
 }
@@ -1532,9 +1533,9 @@ FClientGetTradeStatusResponse UPlayFabClientModelDecoder::decodeGetTradeStatusRe
 {
     // Temp ustruct
     FClientGetTradeStatusResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Trade = !(dataObj->HasField("Trade")) ? nullptr : dataObj->GetObjectField("Trade");
+    tempStruct.Trade = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Trade"));
 
     return tempStruct;
 }
@@ -1543,9 +1544,9 @@ FClientOpenTradeResponse UPlayFabClientModelDecoder::decodeOpenTradeResponseResp
 {
     // Temp ustruct
     FClientOpenTradeResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Trade = !(dataObj->HasField("Trade")) ? nullptr : dataObj->GetObjectField("Trade");
+    tempStruct.Trade = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Trade"));
 
     return tempStruct;
 }
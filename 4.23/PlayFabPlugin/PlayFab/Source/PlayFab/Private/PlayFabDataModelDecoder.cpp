@@ -11,6 +11,7 @@
 
 #include "PlayFabDataModelDecoder.h"
 #include "PlayFabPrivate.h"
+#include "PlayFabJsonDecoder.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Data API Functions
@@ -25,10 +26,10 @@ FDataAbortFileUploadsResponse UPlayFabDataModelDecoder::decodeAbortFileUploadsRe
 {
     // Temp ustruct
     FDataAbortFileUploadsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Entity = !(dataObj->HasField("Entity")) ? nullptr : dataObj->GetObjectField("Entity");
-    tempStruct.ProfileVersion = !(dataObj->HasField("ProfileVersion")) ? 0 : int(dataObj->GetNumberField("ProfileVersion"));
+    tempStruct.Entity = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Entity"));
+    tempStruct.ProfileVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ProfileVersion"));
 
     return tempStruct;
 }
@@ -37,10 +38,10 @@ FDataDeleteFilesResponse UPlayFabDataModelDecoder::decodeDeleteFilesResponseResp
 {
     // Temp ustruct
     FDataDeleteFilesResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Entity = !(dataObj->HasField("Entity")) ? nullptr : dataObj->GetObjectField("Entity");
-    tempStruct.ProfileVersion = !(dataObj->HasField("ProfileVersion")) ? 0 : int(dataObj->GetNumberField("ProfileVersion"));
+    tempStruct.Entity = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Entity"));
+    tempStruct.ProfileVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ProfileVersion"));
 
     return tempStruct;
 }
@@ -49,11 +50,11 @@ FDataFinalizeFileUploadsResponse UPlayFabDataModelDecoder::decodeFinalizeFileUpl
 {
     // Temp ustruct
     FDataFinalizeFileUploadsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Entity = !(dataObj->HasField("Entity")) ? nullptr : dataObj->GetObjectField("Entity");
-    tempStruct.Metadata = !(dataObj->HasField("Metadata")) ? nullptr : dataObj->GetObjectField("Metadata");
-    tempStruct.ProfileVersion = !(dataObj->HasField("ProfileVersion")) ? 0 : int(dataObj->GetNumberField("ProfileVersion"));
+    tempStruct.Entity = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Entity"));
+    tempStruct.Metadata = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Metadata"));
+    tempStruct.ProfileVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ProfileVersion"));
 
     return tempStruct;
 }
@@ -62,11 +63,11 @@ FDataGetFilesResponse UPlayFabDataModelDecoder::decodeGetFilesResponseResponse(U
 {
     // Temp ustruct
     FDataGetFilesResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Entity = !(dataObj->HasField("Entity")) ? nullptr : dataObj->GetObjectField("Entity");
-    tempStruct.Metadata = !(dataObj->HasField("Metadata")) ? nullptr : dataObj->GetObjectField("Metadata");
-    tempStruct.ProfileVersion = !(dataObj->HasField("ProfileVersion")) ? 0 : int(dataObj->GetNumberField("ProfileVersion"));
+    tempStruct.Entity = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Entity"));
+    tempStruct.Metadata = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Metadata"));
+    tempStruct.ProfileVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ProfileVersion"));
 
     return tempStruct;
 }
@@ -75,11 +76,11 @@ FDataInitiateFileUploadsResponse UPlayFabDataModelDecoder::decodeInitiateFileUpl
 {
     // Temp ustruct
     FDataInitiateFileUploadsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Entity = !(dataObj->HasField("Entity")) ? nullptr : dataObj->GetObjectField("Entity");
-    tempStruct.ProfileVersion = !(dataObj->HasField("ProfileVersion")) ? 0 : int(dataObj->GetNumberField("ProfileVersion"));
-    tempStruct.UploadDetails = !(dataObj->HasField("UploadDetails")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("UploadDetails");
+    tempStruct.Entity = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Entity"));
+    tempStruct.ProfileVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ProfileVersion"));
+    tempStruct.UploadDetails = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("UploadDetails"));
 
     return tempStruct;
 }
@@ -94,11 +95,11 @@ FDataGetObjectsResponse UPlayFabDataModelDecoder::decodeGetObjectsResponseRespon
 {
     // Temp ustruct
     FDataGetObjectsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Entity = !(dataObj->HasField("Entity")) ? nullptr : dataObj->GetObjectField("Entity");
-    tempStruct.Objects = !(dataObj->HasField("Objects")) ? nullptr : dataObj->GetObjectField("Objects");
-    tempStruct.ProfileVersion = !(dataObj->HasField("ProfileVersion")) ? 0 : int(dataObj->GetNumberField("ProfileVersion"));
+    tempStruct.Entity = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Entity"));
+    tempStruct.Objects = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Objects"));
+    tempStruct.ProfileVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ProfileVersion"));
 
     return tempStruct;
 }
@@ -107,10 +108,10 @@ FDataSetObjectsResponse UPlayFabDataModelDecoder::decodeSetObjectsResponseRespon
 {
     // Temp ustruct
     FDataSetObjectsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ProfileVersion = !(dataObj->HasField("ProfileVersion")) ? 0 : int(dataObj->GetNumberField("ProfileVersion"));
-    tempStruct.SetResults = !(dataObj->HasField("SetResults")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("SetResults");
+    tempStruct.ProfileVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ProfileVersion"));
+    tempStruct.SetResults = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("SetResults"));
 
     return tempStruct;
 }
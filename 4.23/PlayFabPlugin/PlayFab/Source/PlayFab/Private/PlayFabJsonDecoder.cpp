@@ -0,0 +1,155 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabJsonDecoder.h"
+#include "PlayFabJsonObject.h"
+
+const FJsonObject* FPlayFabJsonDecoder::GetData(UPlayFabJsonObject* Response)
+{
+    if (Response == nullptr || !Response->GetRootObject().IsValid())
+    {
+        return nullptr;
+    }
+    const FJsonValue* Value = Find(Response->GetRootObject().Get(), TEXT("data"));
+    return Value != nullptr && Value->Type == EJson::Object ? Value->AsObject().Get() : nullptr;
+}
+
+FString FPlayFabJsonDecoder::GetString(const FJsonObject* Object, const TCHAR* FieldName)
+{
+    FString Result;
+    if (const FJsonValue* Value = Find(Object, FieldName))
+    {
+        Value->TryGetString(Result);
+    }
+    return Result;
+}
+
+FString FPlayFabJsonDecoder::GetJoinedStringArray(const FJsonObject* Object, const TCHAR* FieldName)
+{
+    FString Result;
+    if (const TArray<TSharedPtr<FJsonValue>>* Values = FindArray(Object, FieldName))
+    {
+        FString Entry;
+        for (const TSharedPtr<FJsonValue>& Value : *Values)
+        {
+            if (!Result.IsEmpty())
+            {
+                Result += TEXT(",");
+            }
+            if (Value.IsValid() && Value->TryGetString(Entry))
+            {
+                Result += Entry;
+            }
+        }
+    }
+    return Result;
+}
+
+int32 FPlayFabJsonDecoder::GetNumber(const FJsonObject* Object, const TCHAR* FieldName)
+{
+    double Result = 0.0;
+    if (const FJsonValue* Value = Find(Object, FieldName))
+    {
+        Value->TryGetNumber(Result);
+    }
+    return int32(Result);
+}
+
+TArray<int32> FPlayFabJsonDecoder::GetNumberArray(const FJsonObject* Object, const TCHAR* FieldName)
+{
+    TArray<int32> Result;
+    if (const TArray<TSharedPtr<FJsonValue>>* Values = FindArray(Object, FieldName))
+    {
+        Result.Reserve(Values->Num());
+        for (const TSharedPtr<FJsonValue>& Value : *Values)
+        {
+            double Number = 0.0;
+            if (Value.IsValid())
+            {
+                Value->TryGetNumber(Number);
+            }
+            Result.Add(int32(Number));
+        }
+    }
+    return Result;
+}
+
+bool FPlayFabJsonDecoder::GetBool(const FJsonObject* Object, const TCHAR* FieldName)
+{
+    bool Result = false;
+    if (const FJsonValue* Value = Find(Object, FieldName))
+    {
+        Value->TryGetBool(Result);
+    }
+    return Result;
+}
+
+TArray<bool> FPlayFabJsonDecoder::GetBoolArray(const FJsonObject* Object, const TCHAR* FieldName)
+{
+    TArray<bool> Result;
+    if (const TArray<TSharedPtr<FJsonValue>>* Values = FindArray(Object, FieldName))
+    {
+        Result.Reserve(Values->Num());
+        for (const TSharedPtr<FJsonValue>& Value : *Values)
+        {
+            bool Boolean = false;
+            if (Value.IsValid())
+            {
+                Value->TryGetBool(Boolean);
+            }
+            Result.Add(Boolean);
+        }
+    }
+    return Result;
+}
+
+UPlayFabJsonObject* FPlayFabJsonDecoder::GetObject(const FJsonObject* Object, const TCHAR* FieldName)
+{
+    const FJsonValue* Value = Find(Object, FieldName);
+    return Value != nullptr && Value->Type == EJson::Object ? Wrap(Value->AsObject()) : nullptr;
+}
+
+TArray<UPlayFabJsonObject*> FPlayFabJsonDecoder::GetObjectArray(const FJsonObject* Object, const TCHAR* FieldName)
+{
+    TArray<UPlayFabJsonObject*> Result;
+    if (const TArray<TSharedPtr<FJsonValue>>* Values = FindArray(Object, FieldName))
+    {
+        Result.Reserve(Values->Num());
+        for (const TSharedPtr<FJsonValue>& Value : *Values)
+        {
+            if (Value.IsValid() && Value->Type == EJson::Object)
+            {
+                Result.Add(Wrap(Value->AsObject()));
+            }
+        }
+    }
+    return Result;
+}
+
+const FJsonValue* FPlayFabJsonDecoder::Find(const FJsonObject* Object, const TCHAR* FieldName)
+{
+    if (Object == nullptr)
+    {
+        return nullptr;
+    }
+    const TSharedPtr<FJsonValue>* Value = Object->Values.Find(FieldName);
+    return Value != nullptr && Value->IsValid() && !(*Value)->IsNull() ? Value->Get() : nullptr;
+}
+
+const TArray<TSharedPtr<FJsonValue>>* FPlayFabJsonDecoder::FindArray(const FJsonObject* Object, const TCHAR* FieldName)
+{
+    const FJsonValue* Value = Find(Object, FieldName);
+    const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+    return Value != nullptr && Value->TryGetArray(Values) ? Values : nullptr;
+}
+
+UPlayFabJsonObject* FPlayFabJsonDecoder::Wrap(const TSharedPtr<FJsonObject>& Object)
+{
+    // The wrapper shares the parsed object, so nested fields are only read when Blueprint asks for them
+    TSharedPtr<FJsonObject> Root = Object;
+    UPlayFabJsonObject* Result = NewObject<UPlayFabJsonObject>();
+    Result->SetRootObject(Root);
+    return Result;
+}
@@ -11,6 +11,7 @@
 
 #include "PlayFabMultiplayerModelDecoder.h"
 #include "PlayFabPrivate.h"
+#include "PlayFabJsonDecoder.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Multiplayer API Functions
@@ -61,9 +62,9 @@ FMultiplayerCreateMatchmakingTicketResult UPlayFabMultiplayerModelDecoder::decod
 {
     // Temp ustruct
     FMultiplayerCreateMatchmakingTicketResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.TicketId = !(dataObj->HasField("TicketId")) ? TEXT("") : dataObj->GetStringField("TicketId");
+    tempStruct.TicketId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("TicketId"));
 
     return tempStruct;
 }
@@ -72,9 +73,9 @@ FMultiplayerCreateServerBackfillTicketResult UPlayFabMultiplayerModelDecoder::de
 {
     // Temp ustruct
     FMultiplayerCreateServerBackfillTicketResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.TicketId = !(dataObj->HasField("TicketId")) ? TEXT("") : dataObj->GetStringField("TicketId");
+    tempStruct.TicketId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("TicketId"));
 
     return tempStruct;
 }
@@ -83,12 +84,12 @@ FMultiplayerGetMatchResult UPlayFabMultiplayerModelDecoder::decodeGetMatchResult
 {
     // Temp ustruct
     FMultiplayerGetMatchResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.MatchId = !(dataObj->HasField("MatchId")) ? TEXT("") : dataObj->GetStringField("MatchId");
-    tempStruct.Members = !(dataObj->HasField("Members")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Members");
-    tempStruct.RegionPreferences = !(dataObj->HasField("RegionPreferences")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("RegionPreferences"), TEXT(","));
-    tempStruct.ServerDetails = !(dataObj->HasField("ServerDetails")) ? nullptr : dataObj->GetObjectField("ServerDetails");
+    tempStruct.MatchId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("MatchId"));
+    tempStruct.Members = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Members"));
+    tempStruct.RegionPreferences = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("RegionPreferences"));
+    tempStruct.ServerDetails = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("ServerDetails"));
 
     return tempStruct;
 }
@@ -97,18 +98,18 @@ FMultiplayerGetMatchmakingTicketResult UPlayFabMultiplayerModelDecoder::decodeGe
 {
     // Temp ustruct
     FMultiplayerGetMatchmakingTicketResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.CancellationReasonString = !(dataObj->HasField("CancellationReasonString")) ? TEXT("") : dataObj->GetStringField("CancellationReasonString");
-    tempStruct.Created = !(dataObj->HasField("Created")) ? TEXT("") : dataObj->GetStringField("Created");
-    tempStruct.Creator = !(dataObj->HasField("Creator")) ? nullptr : dataObj->GetObjectField("Creator");
-    tempStruct.GiveUpAfterSeconds = !(dataObj->HasField("GiveUpAfterSeconds")) ? 0 : int(dataObj->GetNumberField("GiveUpAfterSeconds"));
-    tempStruct.MatchId = !(dataObj->HasField("MatchId")) ? TEXT("") : dataObj->GetStringField("MatchId");
-    tempStruct.Members = !(dataObj->HasField("Members")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Members");
-    tempStruct.MembersToMatchWith = !(dataObj->HasField("MembersToMatchWith")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("MembersToMatchWith");
-    tempStruct.QueueName = !(dataObj->HasField("QueueName")) ? TEXT("") : dataObj->GetStringField("QueueName");
-    tempStruct.Status = !(dataObj->HasField("Status")) ? TEXT("") : dataObj->GetStringField("Status");
-    tempStruct.TicketId = !(dataObj->HasField("TicketId")) ? TEXT("") : dataObj->GetStringField("TicketId");
+    tempStruct.CancellationReasonString = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CancellationReasonString"));
+    tempStruct.Created = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Created"));
+    tempStruct.Creator = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Creator"));
+    tempStruct.GiveUpAfterSeconds = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("GiveUpAfterSeconds"));
+    tempStruct.MatchId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("MatchId"));
+    tempStruct.Members = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Members"));
+    tempStruct.MembersToMatchWith = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("MembersToMatchWith"));
+    tempStruct.QueueName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("QueueName"));
+    tempStruct.Status = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Status"));
+    tempStruct.TicketId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("TicketId"));
 
     return tempStruct;
 }
@@ -117,10 +118,10 @@ FMultiplayerGetQueueStatisticsResult UPlayFabMultiplayerModelDecoder::decodeGetQ
 {
     // Temp ustruct
     FMultiplayerGetQueueStatisticsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.NumberOfPlayersMatching = !(dataObj->HasField("NumberOfPlayersMatching")) ? 0 : int(dataObj->GetNumberField("NumberOfPlayersMatching"));
-    tempStruct.TimeToMatchStatisticsInSeconds = !(dataObj->HasField("TimeToMatchStatisticsInSeconds")) ? nullptr : dataObj->GetObjectField("TimeToMatchStatisticsInSeconds");
+    tempStruct.NumberOfPlayersMatching = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("NumberOfPlayersMatching"));
+    tempStruct.TimeToMatchStatisticsInSeconds = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("TimeToMatchStatisticsInSeconds"));
 
     return tempStruct;
 }
@@ -129,17 +130,17 @@ FMultiplayerGetServerBackfillTicketResult UPlayFabMultiplayerModelDecoder::decod
 {
     // Temp ustruct
     FMultiplayerGetServerBackfillTicketResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.CancellationReasonString = !(dataObj->HasField("CancellationReasonString")) ? TEXT("") : dataObj->GetStringField("CancellationReasonString");
-    tempStruct.Created = !(dataObj->HasField("Created")) ? TEXT("") : dataObj->GetStringField("Created");
-    tempStruct.GiveUpAfterSeconds = !(dataObj->HasField("GiveUpAfterSeconds")) ? 0 : int(dataObj->GetNumberField("GiveUpAfterSeconds"));
-    tempStruct.MatchId = !(dataObj->HasField("MatchId")) ? TEXT("") : dataObj->GetStringField("MatchId");
-    tempStruct.Members = !(dataObj->HasField("Members")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Members");
-    tempStruct.QueueName = !(dataObj->HasField("QueueName")) ? TEXT("") : dataObj->GetStringField("QueueName");
-    tempStruct.ServerDetails = !(dataObj->HasField("ServerDetails")) ? nullptr : dataObj->GetObjectField("ServerDetails");
-    tempStruct.Status = !(dataObj->HasField("Status")) ? TEXT("") : dataObj->GetStringField("Status");
-    tempStruct.TicketId = !(dataObj->HasField("TicketId")) ? TEXT("") : dataObj->GetStringField("TicketId");
+    tempStruct.CancellationReasonString = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CancellationReasonString"));
+    tempStruct.Created = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Created"));
+    tempStruct.GiveUpAfterSeconds = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("GiveUpAfterSeconds"));
+    tempStruct.MatchId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("MatchId"));
+    tempStruct.Members = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Members"));
+    tempStruct.QueueName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("QueueName"));
+    tempStruct.ServerDetails = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("ServerDetails"));
+    tempStruct.Status = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Status"));
+    tempStruct.TicketId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("TicketId"));
 
     return tempStruct;
 }
@@ -157,9 +158,9 @@ FMultiplayerListMatchmakingTicketsForPlayerResult UPlayFabMultiplayerModelDecode
 {
     // Temp ustruct
     FMultiplayerListMatchmakingTicketsForPlayerResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.TicketIds = !(dataObj->HasField("TicketIds")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("TicketIds"), TEXT(","));
+    tempStruct.TicketIds = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("TicketIds"));
 
     return tempStruct;
 }
@@ -168,9 +169,9 @@ FMultiplayerListServerBackfillTicketsForPlayerResult UPlayFabMultiplayerModelDec
 {
     // Temp ustruct
     FMultiplayerListServerBackfillTicketsForPlayerResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.TicketIds = !(dataObj->HasField("TicketIds")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("TicketIds"), TEXT(","));
+    tempStruct.TicketIds = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("TicketIds"));
 
     return tempStruct;
 }
@@ -191,11 +192,11 @@ FMultiplayerBuildAliasDetailsResponse UPlayFabMultiplayerModelDecoder::decodeBui
 {
     // Temp ustruct
     FMultiplayerBuildAliasDetailsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.AliasId = !(dataObj->HasField("AliasId")) ? TEXT("") : dataObj->GetStringField("AliasId");
-    tempStruct.AliasName = !(dataObj->HasField("AliasName")) ? TEXT("") : dataObj->GetStringField("AliasName");
-    tempStruct.BuildSelectionCriteria = !(dataObj->HasField("BuildSelectionCriteria")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BuildSelectionCriteria");
+    tempStruct.AliasId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("AliasId"));
+    tempStruct.AliasName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("AliasName"));
+    tempStruct.BuildSelectionCriteria = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("BuildSelectionCriteria"));
 
     return tempStruct;
 }
@@ -204,26 +205,26 @@ FMultiplayerCreateBuildWithCustomContainerResponse UPlayFabMultiplayerModelDecod
 {
     // Temp ustruct
     FMultiplayerCreateBuildWithCustomContainerResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
-
-    tempStruct.AreAssetsReadonly = !(dataObj->HasField("AreAssetsReadonly")) ? false : dataObj->GetBoolField("AreAssetsReadonly");
-    tempStruct.BuildId = !(dataObj->HasField("BuildId")) ? TEXT("") : dataObj->GetStringField("BuildId");
-    tempStruct.BuildName = !(dataObj->HasField("BuildName")) ? TEXT("") : dataObj->GetStringField("BuildName");
-    GetEnumValueFromString<EContainerFlavor>(TEXT("EContainerFlavor"), dataObj->GetStringField("ContainerFlavor"), tempStruct.ContainerFlavor);
-    tempStruct.ContainerRunCommand = !(dataObj->HasField("ContainerRunCommand")) ? TEXT("") : dataObj->GetStringField("ContainerRunCommand");
-    tempStruct.CreationTime = !(dataObj->HasField("CreationTime")) ? TEXT("") : dataObj->GetStringField("CreationTime");
-    tempStruct.CustomGameContainerImage = !(dataObj->HasField("CustomGameContainerImage")) ? nullptr : dataObj->GetObjectField("CustomGameContainerImage");
-    tempStruct.GameAssetReferences = !(dataObj->HasField("GameAssetReferences")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("GameAssetReferences");
-    tempStruct.GameCertificateReferences = !(dataObj->HasField("GameCertificateReferences")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("GameCertificateReferences");
-    tempStruct.LinuxInstrumentationConfiguration = !(dataObj->HasField("LinuxInstrumentationConfiguration")) ? nullptr : dataObj->GetObjectField("LinuxInstrumentationConfiguration");
-    tempStruct.Metadata = !(dataObj->HasField("Metadata")) ? nullptr : dataObj->GetObjectField("Metadata");
-    tempStruct.MultiplayerServerCountPerVm = !(dataObj->HasField("MultiplayerServerCountPerVm")) ? 0 : int(dataObj->GetNumberField("MultiplayerServerCountPerVm"));
-    tempStruct.OsPlatform = !(dataObj->HasField("OsPlatform")) ? TEXT("") : dataObj->GetStringField("OsPlatform");
-    tempStruct.Ports = !(dataObj->HasField("Ports")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Ports");
-    tempStruct.RegionConfigurations = !(dataObj->HasField("RegionConfigurations")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("RegionConfigurations");
-    tempStruct.ServerType = !(dataObj->HasField("ServerType")) ? TEXT("") : dataObj->GetStringField("ServerType");
-    tempStruct.UseStreamingForAssetDownloads = !(dataObj->HasField("UseStreamingForAssetDownloads")) ? false : dataObj->GetBoolField("UseStreamingForAssetDownloads");
-    GetEnumValueFromString<EAzureVmSize>(TEXT("EAzureVmSize"), dataObj->GetStringField("VmSize"), tempStruct.VmSize);
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
+
+    tempStruct.AreAssetsReadonly = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("AreAssetsReadonly"));
+    tempStruct.BuildId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("BuildId"));
+    tempStruct.BuildName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("BuildName"));
+    GetEnumValueFromString<EContainerFlavor>(TEXT("EContainerFlavor"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("ContainerFlavor")), tempStruct.ContainerFlavor);
+    tempStruct.ContainerRunCommand = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ContainerRunCommand"));
+    tempStruct.CreationTime = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CreationTime"));
+    tempStruct.CustomGameContainerImage = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("CustomGameContainerImage"));
+    tempStruct.GameAssetReferences = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("GameAssetReferences"));
+    tempStruct.GameCertificateReferences = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("GameCertificateReferences"));
+    tempStruct.LinuxInstrumentationConfiguration = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("LinuxInstrumentationConfiguration"));
+    tempStruct.Metadata = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Metadata"));
+    tempStruct.MultiplayerServerCountPerVm = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("MultiplayerServerCountPerVm"));
+    tempStruct.OsPlatform = FPlayFabJsonDecoder::GetString(dataObj, TEXT("OsPlatform"));
+    tempStruct.Ports = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Ports"));
+    tempStruct.RegionConfigurations = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("RegionConfigurations"));
+    tempStruct.ServerType = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ServerType"));
+    tempStruct.UseStreamingForAssetDownloads = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("UseStreamingForAssetDownloads"));
+    GetEnumValueFromString<EAzureVmSize>(TEXT("EAzureVmSize"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("VmSize")), tempStruct.VmSize);
 
     return tempStruct;
 }
@@ -232,26 +233,26 @@ FMultiplayerCreateBuildWithManagedContainerResponse UPlayFabMultiplayerModelDeco
 {
     // Temp ustruct
     FMultiplayerCreateBuildWithManagedContainerResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
-
-    tempStruct.AreAssetsReadonly = !(dataObj->HasField("AreAssetsReadonly")) ? false : dataObj->GetBoolField("AreAssetsReadonly");
-    tempStruct.BuildId = !(dataObj->HasField("BuildId")) ? TEXT("") : dataObj->GetStringField("BuildId");
-    tempStruct.BuildName = !(dataObj->HasField("BuildName")) ? TEXT("") : dataObj->GetStringField("BuildName");
-    GetEnumValueFromString<EContainerFlavor>(TEXT("EContainerFlavor"), dataObj->GetStringField("ContainerFlavor"), tempStruct.ContainerFlavor);
-    tempStruct.CreationTime = !(dataObj->HasField("CreationTime")) ? TEXT("") : dataObj->GetStringField("CreationTime");
-    tempStruct.GameAssetReferences = !(dataObj->HasField("GameAssetReferences")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("GameAssetReferences");
-    tempStruct.GameCertificateReferences = !(dataObj->HasField("GameCertificateReferences")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("GameCertificateReferences");
-    tempStruct.GameWorkingDirectory = !(dataObj->HasField("GameWorkingDirectory")) ? TEXT("") : dataObj->GetStringField("GameWorkingDirectory");
-    tempStruct.InstrumentationConfiguration = !(dataObj->HasField("InstrumentationConfiguration")) ? nullptr : dataObj->GetObjectField("InstrumentationConfiguration");
-    tempStruct.Metadata = !(dataObj->HasField("Metadata")) ? nullptr : dataObj->GetObjectField("Metadata");
-    tempStruct.MultiplayerServerCountPerVm = !(dataObj->HasField("MultiplayerServerCountPerVm")) ? 0 : int(dataObj->GetNumberField("MultiplayerServerCountPerVm"));
-    tempStruct.OsPlatform = !(dataObj->HasField("OsPlatform")) ? TEXT("") : dataObj->GetStringField("OsPlatform");
-    tempStruct.Ports = !(dataObj->HasField("Ports")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Ports");
-    tempStruct.RegionConfigurations = !(dataObj->HasField("RegionConfigurations")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("RegionConfigurations");
-    tempStruct.ServerType = !(dataObj->HasField("ServerType")) ? TEXT("") : dataObj->GetStringField("ServerType");
-    tempStruct.StartMultiplayerServerCommand = !(dataObj->HasField("StartMultiplayerServerCommand")) ? TEXT("") : dataObj->GetStringField("StartMultiplayerServerCommand");
-    tempStruct.UseStreamingForAssetDownloads = !(dataObj->HasField("UseStreamingForAssetDownloads")) ? false : dataObj->GetBoolField("UseStreamingForAssetDownloads");
-    GetEnumValueFromString<EAzureVmSize>(TEXT("EAzureVmSize"), dataObj->GetStringField("VmSize"), tempStruct.VmSize);
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
+
+    tempStruct.AreAssetsReadonly = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("AreAssetsReadonly"));
+    tempStruct.BuildId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("BuildId"));
+    tempStruct.BuildName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("BuildName"));
+    GetEnumValueFromString<EContainerFlavor>(TEXT("EContainerFlavor"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("ContainerFlavor")), tempStruct.ContainerFlavor);
+    tempStruct.CreationTime = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CreationTime"));
+    tempStruct.GameAssetReferences = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("GameAssetReferences"));
+    tempStruct.GameCertificateReferences = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("GameCertificateReferences"));
+    tempStruct.GameWorkingDirectory = FPlayFabJsonDecoder::GetString(dataObj, TEXT("GameWorkingDirectory"));
+    tempStruct.InstrumentationConfiguration = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("InstrumentationConfiguration"));
+    tempStruct.Metadata = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Metadata"));
+    tempStruct.MultiplayerServerCountPerVm = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("MultiplayerServerCountPerVm"));
+    tempStruct.OsPlatform = FPlayFabJsonDecoder::GetString(dataObj, TEXT("OsPlatform"));
+    tempStruct.Ports = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Ports"));
+    tempStruct.RegionConfigurations = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("RegionConfigurations"));
+    tempStruct.ServerType = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ServerType"));
+    tempStruct.StartMultiplayerServerCommand = FPlayFabJsonDecoder::GetString(dataObj, TEXT("StartMultiplayerServerCommand"));
+    tempStruct.UseStreamingForAssetDownloads = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("UseStreamingForAssetDownloads"));
+    GetEnumValueFromString<EAzureVmSize>(TEXT("EAzureVmSize"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("VmSize")), tempStruct.VmSize);
 
     return tempStruct;
 }
@@ -260,27 +261,27 @@ FMultiplayerCreateBuildWithProcessBasedServerResponse UPlayFabMultiplayerModelDe
 {
     // Temp ustruct
     FMultiplayerCreateBuildWithProcessBasedServerResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
-
-    tempStruct.AreAssetsReadonly = !(dataObj->HasField("AreAssetsReadonly")) ? false : dataObj->GetBoolField("AreAssetsReadonly");
-    tempStruct.BuildId = !(dataObj->HasField("BuildId")) ? TEXT("") : dataObj->GetStringField("BuildId");
-    tempStruct.BuildName = !(dataObj->HasField("BuildName")) ? TEXT("") : dataObj->GetStringField("BuildName");
-    GetEnumValueFromString<EContainerFlavor>(TEXT("EContainerFlavor"), dataObj->GetStringField("ContainerFlavor"), tempStruct.ContainerFlavor);
-    tempStruct.CreationTime = !(dataObj->HasField("CreationTime")) ? TEXT("") : dataObj->GetStringField("CreationTime");
-    tempStruct.GameAssetReferences = !(dataObj->HasField("GameAssetReferences")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("GameAssetReferences");
-    tempStruct.GameCertificateReferences = !(dataObj->HasField("GameCertificateReferences")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("GameCertificateReferences");
-    tempStruct.GameWorkingDirectory = !(dataObj->HasField("GameWorkingDirectory")) ? TEXT("") : dataObj->GetStringField("GameWorkingDirectory");
-    tempStruct.InstrumentationConfiguration = !(dataObj->HasField("InstrumentationConfiguration")) ? nullptr : dataObj->GetObjectField("InstrumentationConfiguration");
-    tempStruct.IsOSPreview = !(dataObj->HasField("IsOSPreview")) ? false : dataObj->GetBoolField("IsOSPreview");
-    tempStruct.Metadata = !(dataObj->HasField("Metadata")) ? nullptr : dataObj->GetObjectField("Metadata");
-    tempStruct.MultiplayerServerCountPerVm = !(dataObj->HasField("MultiplayerServerCountPerVm")) ? 0 : int(dataObj->GetNumberField("MultiplayerServerCountPerVm"));
-    tempStruct.OsPlatform = !(dataObj->HasField("OsPlatform")) ? TEXT("") : dataObj->GetStringField("OsPlatform");
-    tempStruct.Ports = !(dataObj->HasField("Ports")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Ports");
-    tempStruct.RegionConfigurations = !(dataObj->HasField("RegionConfigurations")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("RegionConfigurations");
-    tempStruct.ServerType = !(dataObj->HasField("ServerType")) ? TEXT("") : dataObj->GetStringField("ServerType");
-    tempStruct.StartMultiplayerServerCommand = !(dataObj->HasField("StartMultiplayerServerCommand")) ? TEXT("") : dataObj->GetStringField("StartMultiplayerServerCommand");
-    tempStruct.UseStreamingForAssetDownloads = !(dataObj->HasField("UseStreamingForAssetDownloads")) ? false : dataObj->GetBoolField("UseStreamingForAssetDownloads");
-    GetEnumValueFromString<EAzureVmSize>(TEXT("EAzureVmSize"), dataObj->GetStringField("VmSize"), tempStruct.VmSize);
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
+
+    tempStruct.AreAssetsReadonly = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("AreAssetsReadonly"));
+    tempStruct.BuildId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("BuildId"));
+    tempStruct.BuildName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("BuildName"));
+    GetEnumValueFromString<EContainerFlavor>(TEXT("EContainerFlavor"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("ContainerFlavor")), tempStruct.ContainerFlavor);
+    tempStruct.CreationTime = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CreationTime"));
+    tempStruct.GameAssetReferences = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("GameAssetReferences"));
+    tempStruct.GameCertificateReferences = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("GameCertificateReferences"));
+    tempStruct.GameWorkingDirectory = FPlayFabJsonDecoder::GetString(dataObj, TEXT("GameWorkingDirectory"));
+    tempStruct.InstrumentationConfiguration = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("InstrumentationConfiguration"));
+    tempStruct.IsOSPreview = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("IsOSPreview"));
+    tempStruct.Metadata = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Metadata"));
+    tempStruct.MultiplayerServerCountPerVm = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("MultiplayerServerCountPerVm"));
+    tempStruct.OsPlatform = FPlayFabJsonDecoder::GetString(dataObj, TEXT("OsPlatform"));
+    tempStruct.Ports = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Ports"));
+    tempStruct.RegionConfigurations = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("RegionConfigurations"));
+    tempStruct.ServerType = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ServerType"));
+    tempStruct.StartMultiplayerServerCommand = FPlayFabJsonDecoder::GetString(dataObj, TEXT("StartMultiplayerServerCommand"));
+    tempStruct.UseStreamingForAssetDownloads = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("UseStreamingForAssetDownloads"));
+    GetEnumValueFromString<EAzureVmSize>(TEXT("EAzureVmSize"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("VmSize")), tempStruct.VmSize);
 
     return tempStruct;
 }
@@ -289,11 +290,11 @@ FMultiplayerCreateRemoteUserResponse UPlayFabMultiplayerModelDecoder::decodeCrea
 {
     // Temp ustruct
     FMultiplayerCreateRemoteUserResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ExpirationTime = !(dataObj->HasField("ExpirationTime")) ? TEXT("") : dataObj->GetStringField("ExpirationTime");
-    tempStruct.Password = !(dataObj->HasField("Password")) ? TEXT("") : dataObj->GetStringField("Password");
-    tempStruct.Username = !(dataObj->HasField("Username")) ? TEXT("") : dataObj->GetStringField("Username");
+    tempStruct.ExpirationTime = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ExpirationTime"));
+    tempStruct.Password = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Password"));
+    tempStruct.Username = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Username"));
 
     return tempStruct;
 }
@@ -302,10 +303,10 @@ FMultiplayerCreateTitleMultiplayerServersQuotaChangeResponse UPlayFabMultiplayer
 {
     // Temp ustruct
     FMultiplayerCreateTitleMultiplayerServersQuotaChangeResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.RequestId = !(dataObj->HasField("RequestId")) ? TEXT("") : dataObj->GetStringField("RequestId");
-    tempStruct.WasApproved = !(dataObj->HasField("WasApproved")) ? false : dataObj->GetBoolField("WasApproved");
+    tempStruct.RequestId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("RequestId"));
+    tempStruct.WasApproved = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("WasApproved"));
 
     return tempStruct;
 }
@@ -323,9 +324,9 @@ FMultiplayerEnableMultiplayerServersForTitleResponse UPlayFabMultiplayerModelDec
 {
     // Temp ustruct
     FMultiplayerEnableMultiplayerServersForTitleResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    GetEnumValueFromString<ETitleMultiplayerServerEnabledStatus>(TEXT("ETitleMultiplayerServerEnabledStatus"), dataObj->GetStringField("Status"), tempStruct.Status);
+    GetEnumValueFromString<ETitleMultiplayerServerEnabledStatus>(TEXT("ETitleMultiplayerServerEnabledStatus"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("Status")), tempStruct.Status);
 
     return tempStruct;
 }
@@ -334,10 +335,10 @@ FMultiplayerGetAssetUploadUrlResponse UPlayFabMultiplayerModelDecoder::decodeGet
 {
     // Temp ustruct
     FMultiplayerGetAssetUploadUrlResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.AssetUploadUrl = !(dataObj->HasField("AssetUploadUrl")) ? TEXT("") : dataObj->GetStringField("AssetUploadUrl");
-    tempStruct.FileName = !(dataObj->HasField("FileName")) ? TEXT("") : dataObj->GetStringField("FileName");
+    tempStruct.AssetUploadUrl = FPlayFabJsonDecoder::GetString(dataObj, TEXT("AssetUploadUrl"));
+    tempStruct.FileName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("FileName"));
 
     return tempStruct;
 }
@@ -346,28 +347,28 @@ FMultiplayerGetBuildResponse UPlayFabMultiplayerModelDecoder::decodeGetBuildResp
 {
     // Temp ustruct
     FMultiplayerGetBuildResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
-
-    tempStruct.AreAssetsReadonly = !(dataObj->HasField("AreAssetsReadonly")) ? false : dataObj->GetBoolField("AreAssetsReadonly");
-    tempStruct.BuildId = !(dataObj->HasField("BuildId")) ? TEXT("") : dataObj->GetStringField("BuildId");
-    tempStruct.BuildName = !(dataObj->HasField("BuildName")) ? TEXT("") : dataObj->GetStringField("BuildName");
-    tempStruct.BuildStatus = !(dataObj->HasField("BuildStatus")) ? TEXT("") : dataObj->GetStringField("BuildStatus");
-    GetEnumValueFromString<EContainerFlavor>(TEXT("EContainerFlavor"), dataObj->GetStringField("ContainerFlavor"), tempStruct.ContainerFlavor);
-    tempStruct.ContainerRunCommand = !(dataObj->HasField("ContainerRunCommand")) ? TEXT("") : dataObj->GetStringField("ContainerRunCommand");
-    tempStruct.CreationTime = !(dataObj->HasField("CreationTime")) ? TEXT("") : dataObj->GetStringField("CreationTime");
-    tempStruct.CustomGameContainerImage = !(dataObj->HasField("CustomGameContainerImage")) ? nullptr : dataObj->GetObjectField("CustomGameContainerImage");
-    tempStruct.GameAssetReferences = !(dataObj->HasField("GameAssetReferences")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("GameAssetReferences");
-    tempStruct.GameCertificateReferences = !(dataObj->HasField("GameCertificateReferences")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("GameCertificateReferences");
-    tempStruct.InstrumentationConfiguration = !(dataObj->HasField("InstrumentationConfiguration")) ? nullptr : dataObj->GetObjectField("InstrumentationConfiguration");
-    tempStruct.Metadata = !(dataObj->HasField("Metadata")) ? nullptr : dataObj->GetObjectField("Metadata");
-    tempStruct.MultiplayerServerCountPerVm = !(dataObj->HasField("MultiplayerServerCountPerVm")) ? 0 : int(dataObj->GetNumberField("MultiplayerServerCountPerVm"));
-    tempStruct.OsPlatform = !(dataObj->HasField("OsPlatform")) ? TEXT("") : dataObj->GetStringField("OsPlatform");
-    tempStruct.Ports = !(dataObj->HasField("Ports")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Ports");
-    tempStruct.RegionConfigurations = !(dataObj->HasField("RegionConfigurations")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("RegionConfigurations");
-    tempStruct.ServerType = !(dataObj->HasField("ServerType")) ? TEXT("") : dataObj->GetStringField("ServerType");
-    tempStruct.StartMultiplayerServerCommand = !(dataObj->HasField("StartMultiplayerServerCommand")) ? TEXT("") : dataObj->GetStringField("StartMultiplayerServerCommand");
-    tempStruct.UseStreamingForAssetDownloads = !(dataObj->HasField("UseStreamingForAssetDownloads")) ? false : dataObj->GetBoolField("UseStreamingForAssetDownloads");
-    GetEnumValueFromString<EAzureVmSize>(TEXT("EAzureVmSize"), dataObj->GetStringField("VmSize"), tempStruct.VmSize);
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
+
+    tempStruct.AreAssetsReadonly = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("AreAssetsReadonly"));
+    tempStruct.BuildId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("BuildId"));
+    tempStruct.BuildName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("BuildName"));
+    tempStruct.BuildStatus = FPlayFabJsonDecoder::GetString(dataObj, TEXT("BuildStatus"));
+    GetEnumValueFromString<EContainerFlavor>(TEXT("EContainerFlavor"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("ContainerFlavor")), tempStruct.ContainerFlavor);
+    tempStruct.ContainerRunCommand = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ContainerRunCommand"));
+    tempStruct.CreationTime = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CreationTime"));
+    tempStruct.CustomGameContainerImage = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("CustomGameContainerImage"));
+    tempStruct.GameAssetReferences = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("GameAssetReferences"));
+    tempStruct.GameCertificateReferences = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("GameCertificateReferences"));
+    tempStruct.InstrumentationConfiguration = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("InstrumentationConfiguration"));
+    tempStruct.Metadata = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Metadata"));
+    tempStruct.MultiplayerServerCountPerVm = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("MultiplayerServerCountPerVm"));
+    tempStruct.OsPlatform = FPlayFabJsonDecoder::GetString(dataObj, TEXT("OsPlatform"));
+    tempStruct.Ports = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Ports"));
+    tempStruct.RegionConfigurations = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("RegionConfigurations"));
+    tempStruct.ServerType = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ServerType"));
+    tempStruct.StartMultiplayerServerCommand = FPlayFabJsonDecoder::GetString(dataObj, TEXT("StartMultiplayerServerCommand"));
+    tempStruct.UseStreamingForAssetDownloads = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("UseStreamingForAssetDownloads"));
+    GetEnumValueFromString<EAzureVmSize>(TEXT("EAzureVmSize"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("VmSize")), tempStruct.VmSize);
 
     return tempStruct;
 }
@@ -376,11 +377,11 @@ FMultiplayerGetContainerRegistryCredentialsResponse UPlayFabMultiplayerModelDeco
 {
     // Temp ustruct
     FMultiplayerGetContainerRegistryCredentialsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.DnsName = !(dataObj->HasField("DnsName")) ? TEXT("") : dataObj->GetStringField("DnsName");
-    tempStruct.Password = !(dataObj->HasField("Password")) ? TEXT("") : dataObj->GetStringField("Password");
-    tempStruct.Username = !(dataObj->HasField("Username")) ? TEXT("") : dataObj->GetStringField("Username");
+    tempStruct.DnsName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("DnsName"));
+    tempStruct.Password = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Password"));
+    tempStruct.Username = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Username"));
 
     return tempStruct;
 }
@@ -389,19 +390,19 @@ FMultiplayerGetMultiplayerServerDetailsResponse UPlayFabMultiplayerModelDecoder:
 {
     // Temp ustruct
     FMultiplayerGetMultiplayerServerDetailsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.BuildId = !(dataObj->HasField("BuildId")) ? TEXT("") : dataObj->GetStringField("BuildId");
-    tempStruct.ConnectedPlayers = !(dataObj->HasField("ConnectedPlayers")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("ConnectedPlayers");
-    tempStruct.FQDN = !(dataObj->HasField("FQDN")) ? TEXT("") : dataObj->GetStringField("FQDN");
-    tempStruct.IPV4Address = !(dataObj->HasField("IPV4Address")) ? TEXT("") : dataObj->GetStringField("IPV4Address");
-    tempStruct.LastStateTransitionTime = !(dataObj->HasField("LastStateTransitionTime")) ? TEXT("") : dataObj->GetStringField("LastStateTransitionTime");
-    tempStruct.Ports = !(dataObj->HasField("Ports")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Ports");
-    tempStruct.Region = !(dataObj->HasField("Region")) ? TEXT("") : dataObj->GetStringField("Region");
-    tempStruct.ServerId = !(dataObj->HasField("ServerId")) ? TEXT("") : dataObj->GetStringField("ServerId");
-    tempStruct.SessionId = !(dataObj->HasField("SessionId")) ? TEXT("") : dataObj->GetStringField("SessionId");
-    tempStruct.State = !(dataObj->HasField("State")) ? TEXT("") : dataObj->GetStringField("State");
-    tempStruct.VmId = !(dataObj->HasField("VmId")) ? TEXT("") : dataObj->GetStringField("VmId");
+    tempStruct.BuildId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("BuildId"));
+    tempStruct.ConnectedPlayers = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("ConnectedPlayers"));
+    tempStruct.FQDN = FPlayFabJsonDecoder::GetString(dataObj, TEXT("FQDN"));
+    tempStruct.IPV4Address = FPlayFabJsonDecoder::GetString(dataObj, TEXT("IPV4Address"));
+    tempStruct.LastStateTransitionTime = FPlayFabJsonDecoder::GetString(dataObj, TEXT("LastStateTransitionTime"));
+    tempStruct.Ports = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Ports"));
+    tempStruct.Region = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Region"));
+    tempStruct.ServerId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ServerId"));
+    tempStruct.SessionId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SessionId"));
+    tempStruct.State = FPlayFabJsonDecoder::GetString(dataObj, TEXT("State"));
+    tempStruct.VmId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("VmId"));
 
     return tempStruct;
 }
@@ -410,9 +411,9 @@ FMultiplayerGetMultiplayerServerLogsResponse UPlayFabMultiplayerModelDecoder::de
 {
     // Temp ustruct
     FMultiplayerGetMultiplayerServerLogsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.LogDownloadUrl = !(dataObj->HasField("LogDownloadUrl")) ? TEXT("") : dataObj->GetStringField("LogDownloadUrl");
+    tempStruct.LogDownloadUrl = FPlayFabJsonDecoder::GetString(dataObj, TEXT("LogDownloadUrl"));
 
     return tempStruct;
 }
@@ -421,10 +422,10 @@ FMultiplayerGetRemoteLoginEndpointResponse UPlayFabMultiplayerModelDecoder::deco
 {
     // Temp ustruct
     FMultiplayerGetRemoteLoginEndpointResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.IPV4Address = !(dataObj->HasField("IPV4Address")) ? TEXT("") : dataObj->GetStringField("IPV4Address");
-    tempStruct.Port = !(dataObj->HasField("Port")) ? 0 : int(dataObj->GetNumberField("Port"));
+    tempStruct.IPV4Address = FPlayFabJsonDecoder::GetString(dataObj, TEXT("IPV4Address"));
+    tempStruct.Port = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("Port"));
 
     return tempStruct;
 }
@@ -433,9 +434,9 @@ FMultiplayerGetTitleEnabledForMultiplayerServersStatusResponse UPlayFabMultiplay
 {
     // Temp ustruct
     FMultiplayerGetTitleEnabledForMultiplayerServersStatusResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    GetEnumValueFromString<ETitleMultiplayerServerEnabledStatus>(TEXT("ETitleMultiplayerServerEnabledStatus"), dataObj->GetStringField("Status"), tempStruct.Status);
+    GetEnumValueFromString<ETitleMultiplayerServerEnabledStatus>(TEXT("ETitleMultiplayerServerEnabledStatus"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("Status")), tempStruct.Status);
 
     return tempStruct;
 }
@@ -444,9 +445,9 @@ FMultiplayerGetTitleMultiplayerServersQuotaChangeResponse UPlayFabMultiplayerMod
 {
     // Temp ustruct
     FMultiplayerGetTitleMultiplayerServersQuotaChangeResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Change = !(dataObj->HasField("Change")) ? nullptr : dataObj->GetObjectField("Change");
+    tempStruct.Change = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Change"));
 
     return tempStruct;
 }
@@ -455,9 +456,9 @@ FMultiplayerGetTitleMultiplayerServersQuotasResponse UPlayFabMultiplayerModelDec
 {
     // Temp ustruct
     FMultiplayerGetTitleMultiplayerServersQuotasResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Quotas = !(dataObj->HasField("Quotas")) ? nullptr : dataObj->GetObjectField("Quotas");
+    tempStruct.Quotas = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Quotas"));
 
     return tempStruct;
 }
@@ -466,11 +467,11 @@ FMultiplayerListMultiplayerServersResponse UPlayFabMultiplayerModelDecoder::deco
 {
     // Temp ustruct
     FMultiplayerListMultiplayerServersResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.MultiplayerServerSummaries = !(dataObj->HasField("MultiplayerServerSummaries")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("MultiplayerServerSummaries");
-    tempStruct.PageSize = !(dataObj->HasField("PageSize")) ? 0 : int(dataObj->GetNumberField("PageSize"));
-    tempStruct.SkipToken = !(dataObj->HasField("SkipToken")) ? TEXT("") : dataObj->GetStringField("SkipToken");
+    tempStruct.MultiplayerServerSummaries = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("MultiplayerServerSummaries"));
+    tempStruct.PageSize = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("PageSize"));
+    tempStruct.SkipToken = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SkipToken"));
 
     return tempStruct;
 }
@@ -479,11 +480,11 @@ FMultiplayerListAssetSummariesResponse UPlayFabMultiplayerModelDecoder::decodeLi
 {
     // Temp ustruct
     FMultiplayerListAssetSummariesResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.AssetSummaries = !(dataObj->HasField("AssetSummaries")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("AssetSummaries");
-    tempStruct.PageSize = !(dataObj->HasField("PageSize")) ? 0 : int(dataObj->GetNumberField("PageSize"));
-    tempStruct.SkipToken = !(dataObj->HasField("SkipToken")) ? TEXT("") : dataObj->GetStringField("SkipToken");
+    tempStruct.AssetSummaries = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("AssetSummaries"));
+    tempStruct.PageSize = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("PageSize"));
+    tempStruct.SkipToken = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SkipToken"));
 
     return tempStruct;
 }
@@ -492,11 +493,11 @@ FMultiplayerListBuildAliasesResponse UPlayFabMultiplayerModelDecoder::decodeList
 {
     // Temp ustruct
     FMultiplayerListBuildAliasesResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.BuildAliases = !(dataObj->HasField("BuildAliases")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BuildAliases");
-    tempStruct.PageSize = !(dataObj->HasField("PageSize")) ? 0 : int(dataObj->GetNumberField("PageSize"));
-    tempStruct.SkipToken = !(dataObj->HasField("SkipToken")) ? TEXT("") : dataObj->GetStringField("SkipToken");
+    tempStruct.BuildAliases = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("BuildAliases"));
+    tempStruct.PageSize = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("PageSize"));
+    tempStruct.SkipToken = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SkipToken"));
 
     return tempStruct;
 }
@@ -505,11 +506,11 @@ FMultiplayerListBuildSummariesResponse UPlayFabMultiplayerModelDecoder::decodeLi
 {
     // Temp ustruct
     FMultiplayerListBuildSummariesResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.BuildSummaries = !(dataObj->HasField("BuildSummaries")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BuildSummaries");
-    tempStruct.PageSize = !(dataObj->HasField("PageSize")) ? 0 : int(dataObj->GetNumberField("PageSize"));
-    tempStruct.SkipToken = !(dataObj->HasField("SkipToken")) ? TEXT("") : dataObj->GetStringField("SkipToken");
+    tempStruct.BuildSummaries = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("BuildSummaries"));
+    tempStruct.PageSize = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("PageSize"));
+    tempStruct.SkipToken = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SkipToken"));
 
     return tempStruct;
 }
@@ -518,11 +519,11 @@ FMultiplayerListCertificateSummariesResponse UPlayFabMultiplayerModelDecoder::de
 {
     // Temp ustruct
     FMultiplayerListCertificateSummariesResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.CertificateSummaries = !(dataObj->HasField("CertificateSummaries")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("CertificateSummaries");
-    tempStruct.PageSize = !(dataObj->HasField("PageSize")) ? 0 : int(dataObj->GetNumberField("PageSize"));
-    tempStruct.SkipToken = !(dataObj->HasField("SkipToken")) ? TEXT("") : dataObj->GetStringField("SkipToken");
+    tempStruct.CertificateSummaries = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("CertificateSummaries"));
+    tempStruct.PageSize = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("PageSize"));
+    tempStruct.SkipToken = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SkipToken"));
 
     return tempStruct;
 }
@@ -531,11 +532,11 @@ FMultiplayerListContainerImagesResponse UPlayFabMultiplayerModelDecoder::decodeL
 {
     // Temp ustruct
     FMultiplayerListContainerImagesResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Images = !(dataObj->HasField("Images")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("Images"), TEXT(","));
-    tempStruct.PageSize = !(dataObj->HasField("PageSize")) ? 0 : int(dataObj->GetNumberField("PageSize"));
-    tempStruct.SkipToken = !(dataObj->HasField("SkipToken")) ? TEXT("") : dataObj->GetStringField("SkipToken");
+    tempStruct.Images = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("Images"));
+    tempStruct.PageSize = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("PageSize"));
+    tempStruct.SkipToken = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SkipToken"));
 
     return tempStruct;
 }
@@ -544,9 +545,9 @@ FMultiplayerListContainerImageTagsResponse UPlayFabMultiplayerModelDecoder::deco
 {
     // Temp ustruct
     FMultiplayerListContainerImageTagsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Tags = !(dataObj->HasField("Tags")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("Tags"), TEXT(","));
+    tempStruct.Tags = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("Tags"));
 
     return tempStruct;
 }
@@ -555,11 +556,11 @@ FMultiplayerListPartyQosServersResponse UPlayFabMultiplayerModelDecoder::decodeL
 {
     // Temp ustruct
     FMultiplayerListPartyQosServersResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.PageSize = !(dataObj->HasField("PageSize")) ? 0 : int(dataObj->GetNumberField("PageSize"));
-    tempStruct.QosServers = !(dataObj->HasField("QosServers")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("QosServers");
-    tempStruct.SkipToken = !(dataObj->HasField("SkipToken")) ? TEXT("") : dataObj->GetStringField("SkipToken");
+    tempStruct.PageSize = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("PageSize"));
+    tempStruct.QosServers = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("QosServers"));
+    tempStruct.SkipToken = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SkipToken"));
 
     return tempStruct;
 }
@@ -568,11 +569,11 @@ FMultiplayerListQosServersForTitleResponse UPlayFabMultiplayerModelDecoder::deco
 {
     // Temp ustruct
     FMultiplayerListQosServersForTitleResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.PageSize = !(dataObj->HasField("PageSize")) ? 0 : int(dataObj->GetNumberField("PageSize"));
-    tempStruct.QosServers = !(dataObj->HasField("QosServers")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("QosServers");
-    tempStruct.SkipToken = !(dataObj->HasField("SkipToken")) ? TEXT("") : dataObj->GetStringField("SkipToken");
+    tempStruct.PageSize = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("PageSize"));
+    tempStruct.QosServers = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("QosServers"));
+    tempStruct.SkipToken = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SkipToken"));
 
     return tempStruct;
 }
@@ -581,9 +582,9 @@ FMultiplayerListTitleMultiplayerServersQuotaChangesResponse UPlayFabMultiplayerM
 {
     // Temp ustruct
     FMultiplayerListTitleMultiplayerServersQuotaChangesResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Changes = !(dataObj->HasField("Changes")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Changes");
+    tempStruct.Changes = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Changes"));
 
     return tempStruct;
 }
@@ -592,11 +593,11 @@ FMultiplayerListVirtualMachineSummariesResponse UPlayFabMultiplayerModelDecoder:
 {
     // Temp ustruct
     FMultiplayerListVirtualMachineSummariesResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.PageSize = !(dataObj->HasField("PageSize")) ? 0 : int(dataObj->GetNumberField("PageSize"));
-    tempStruct.SkipToken = !(dataObj->HasField("SkipToken")) ? TEXT("") : dataObj->GetStringField("SkipToken");
-    tempStruct.VirtualMachines = !(dataObj->HasField("VirtualMachines")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("VirtualMachines");
+    tempStruct.PageSize = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("PageSize"));
+    tempStruct.SkipToken = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SkipToken"));
+    tempStruct.VirtualMachines = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("VirtualMachines"));
 
     return tempStruct;
 }
@@ -605,19 +606,19 @@ FMultiplayerRequestMultiplayerServerResponse UPlayFabMultiplayerModelDecoder::de
 {
     // Temp ustruct
     FMultiplayerRequestMultiplayerServerResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.BuildId = !(dataObj->HasField("BuildId")) ? TEXT("") : dataObj->GetStringField("BuildId");
-    tempStruct.ConnectedPlayers = !(dataObj->HasField("ConnectedPlayers")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("ConnectedPlayers");
-    tempStruct.FQDN = !(dataObj->HasField("FQDN")) ? TEXT("") : dataObj->GetStringField("FQDN");
-    tempStruct.IPV4Address = !(dataObj->HasField("IPV4Address")) ? TEXT("") : dataObj->GetStringField("IPV4Address");
-    tempStruct.LastStateTransitionTime = !(dataObj->HasField("LastStateTransitionTime")) ? TEXT("") : dataObj->GetStringField("LastStateTransitionTime");
-    tempStruct.Ports = !(dataObj->HasField("Ports")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Ports");
-    tempStruct.Region = !(dataObj->HasField("Region")) ? TEXT("") : dataObj->GetStringField("Region");
-    tempStruct.ServerId = !(dataObj->HasField("ServerId")) ? TEXT("") : dataObj->GetStringField("ServerId");
-    tempStruct.SessionId = !(dataObj->HasField("SessionId")) ? TEXT("") : dataObj->GetStringField("SessionId");
-    tempStruct.State = !(dataObj->HasField("State")) ? TEXT("") : dataObj->GetStringField("State");
-    tempStruct.VmId = !(dataObj->HasField("VmId")) ? TEXT("") : dataObj->GetStringField("VmId");
+    tempStruct.BuildId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("BuildId"));
+    tempStruct.ConnectedPlayers = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("ConnectedPlayers"));
+    tempStruct.FQDN = FPlayFabJsonDecoder::GetString(dataObj, TEXT("FQDN"));
+    tempStruct.IPV4Address = FPlayFabJsonDecoder::GetString(dataObj, TEXT("IPV4Address"));
+    tempStruct.LastStateTransitionTime = FPlayFabJsonDecoder::GetString(dataObj, TEXT("LastStateTransitionTime"));
+    tempStruct.Ports = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Ports"));
+    tempStruct.Region = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Region"));
+    tempStruct.ServerId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ServerId"));
+    tempStruct.SessionId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SessionId"));
+    tempStruct.State = FPlayFabJsonDecoder::GetString(dataObj, TEXT("State"));
+    tempStruct.VmId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("VmId"));
 
     return tempStruct;
 }
@@ -626,11 +627,11 @@ FMultiplayerRolloverContainerRegistryCredentialsResponse UPlayFabMultiplayerMode
 {
     // Temp ustruct
     FMultiplayerRolloverContainerRegistryCredentialsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.DnsName = !(dataObj->HasField("DnsName")) ? TEXT("") : dataObj->GetStringField("DnsName");
-    tempStruct.Password = !(dataObj->HasField("Password")) ? TEXT("") : dataObj->GetStringField("Password");
-    tempStruct.Username = !(dataObj->HasField("Username")) ? TEXT("") : dataObj->GetStringField("Username");
+    tempStruct.DnsName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("DnsName"));
+    tempStruct.Password = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Password"));
+    tempStruct.Username = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Username"));
 
     return tempStruct;
 }
@@ -0,0 +1,45 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/MemoryWriter.h"
+#include "PlayFabCpp/Public/Core/PlayFabCppBaseModel.h"
+
+class UPlayFabJsonObject;
+
+/**
+ * Streams the fields of a Blueprint request struct into a condensed UTF-8 json body, for the generated API functions.
+ * Empty strings and arrays are written as null, and null objects are left out, the same as building the request in a UPlayFabJsonObject did.
+ */
+class FPlayFabRequestWriter
+{
+public:
+    FPlayFabRequestWriter();
+
+    void WriteString(const TCHAR* FieldName, const FString& Value);
+    void WriteStringOrNull(const TCHAR* FieldName, const FString& Value);
+    // Values are separated by commas in the request structs
+    void WriteStringArray(const TCHAR* FieldName, const FString& Values);
+    void WriteNumber(const TCHAR* FieldName, int32 Value);
+    void WriteNumberArray(const TCHAR* FieldName, const TArray<int32>& Values);
+    void WriteBool(const TCHAR* FieldName, bool Value);
+    void WriteBoolArray(const TCHAR* FieldName, const TArray<bool>& Values);
+    void WriteObject(const TCHAR* FieldName, UPlayFabJsonObject* Value);
+    void WriteObjectArray(const TCHAR* FieldName, const TArray<UPlayFabJsonObject*>& Values);
+
+    // Closes the json object and hands over the body; the writer can't be used afterwards
+    TArray<uint8> Finish();
+
+    static FString ToString(const TArray<uint8>& Body);
+
+private:
+    void WriteJsonObject(UPlayFabJsonObject* Value);
+
+    TArray<uint8> Body;
+    FMemoryWriter Stream;
+    PlayFab::JsonUtf8Writer Writer;
+};
@@ -11,6 +11,7 @@
 
 #include "PlayFabServerModelDecoder.h"
 #include "PlayFabPrivate.h"
+#include "PlayFabJsonDecoder.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Server API Functions
@@ -34,9 +35,9 @@ FServerBanUsersResult UPlayFabServerModelDecoder::decodeBanUsersResultResponse(U
 {
     // Temp ustruct
     FServerBanUsersResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    tempStruct.BanData = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("BanData"));
 
     return tempStruct;
 }
@@ -63,9 +64,9 @@ FServerGetPlayerProfileResult UPlayFabServerModelDecoder::decodeGetPlayerProfile
 {
     // Temp ustruct
     FServerGetPlayerProfileResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.PlayerProfile = !(dataObj->HasField("PlayerProfile")) ? nullptr : dataObj->GetObjectField("PlayerProfile");
+    tempStruct.PlayerProfile = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("PlayerProfile"));
 
     return tempStruct;
 }
@@ -74,9 +75,9 @@ FServerGetPlayFabIDsFromFacebookIDsResult UPlayFabServerModelDecoder::decodeGetP
 {
     // Temp ustruct
     FServerGetPlayFabIDsFromFacebookIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -85,9 +86,9 @@ FServerGetPlayFabIDsFromFacebookInstantGamesIdsResult UPlayFabServerModelDecoder
 {
     // Temp ustruct
     FServerGetPlayFabIDsFromFacebookInstantGamesIdsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -96,9 +97,9 @@ FServerGetPlayFabIDsFromGenericIDsResult UPlayFabServerModelDecoder::decodeGetPl
 {
     // Temp ustruct
     FServerGetPlayFabIDsFromGenericIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -107,9 +108,9 @@ FServerGetPlayFabIDsFromNintendoSwitchDeviceIdsResult UPlayFabServerModelDecoder
 {
     // Temp ustruct
     FServerGetPlayFabIDsFromNintendoSwitchDeviceIdsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -118,9 +119,9 @@ FServerGetPlayFabIDsFromPSNAccountIDsResult UPlayFabServerModelDecoder::decodeGe
 {
     // Temp ustruct
     FServerGetPlayFabIDsFromPSNAccountIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -129,9 +130,9 @@ FServerGetPlayFabIDsFromSteamIDsResult UPlayFabServerModelDecoder::decodeGetPlay
 {
     // Temp ustruct
     FServerGetPlayFabIDsFromSteamIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -140,9 +141,9 @@ FServerGetPlayFabIDsFromXboxLiveIDsResult UPlayFabServerModelDecoder::decodeGetP
 {
     // Temp ustruct
     FServerGetPlayFabIDsFromXboxLiveIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -151,9 +152,9 @@ FServerGetServerCustomIDsFromPlayFabIDsResult UPlayFabServerModelDecoder::decode
 {
     // Temp ustruct
     FServerGetServerCustomIDsFromPlayFabIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -162,9 +163,9 @@ FServerGetUserAccountInfoResult UPlayFabServerModelDecoder::decodeGetUserAccount
 {
     // Temp ustruct
     FServerGetUserAccountInfoResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.UserInfo = !(dataObj->HasField("UserInfo")) ? nullptr : dataObj->GetObjectField("UserInfo");
+    tempStruct.UserInfo = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("UserInfo"));
 
     return tempStruct;
 }
@@ -173,9 +174,9 @@ FServerGetUserBansResult UPlayFabServerModelDecoder::decodeGetUserBansResultResp
 {
     // Temp ustruct
     FServerGetUserBansResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    tempStruct.BanData = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("BanData"));
 
     return tempStruct;
 }
@@ -211,9 +212,9 @@ FServerRevokeAllBansForUserResult UPlayFabServerModelDecoder::decodeRevokeAllBan
 {
     // Temp ustruct
     FServerRevokeAllBansForUserResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    tempStruct.BanData = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("BanData"));
 
     return tempStruct;
 }
@@ -222,9 +223,9 @@ FServerRevokeBansResult UPlayFabServerModelDecoder::decodeRevokeBansResultRespon
 {
     // Temp ustruct
     FServerRevokeBansResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    tempStruct.BanData = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("BanData"));
 
     return tempStruct;
 }
@@ -233,9 +234,9 @@ FServerSavePushNotificationTemplateResult UPlayFabServerModelDecoder::decodeSave
 {
     // Temp ustruct
     FServerSavePushNotificationTemplateResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.PushNotificationTemplateId = !(dataObj->HasField("PushNotificationTemplateId")) ? TEXT("") : dataObj->GetStringField("PushNotificationTemplateId");
+    tempStruct.PushNotificationTemplateId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PushNotificationTemplateId"));
 
     return tempStruct;
 }
@@ -307,9 +308,9 @@ FServerUpdateBansResult UPlayFabServerModelDecoder::decodeUpdateBansResultRespon
 {
     // Temp ustruct
     FServerUpdateBansResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    tempStruct.BanData = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("BanData"));
 
     return tempStruct;
 }
@@ -324,9 +325,9 @@ FServerWriteEventResponse UPlayFabServerModelDecoder::decodeWriteEventResponseRe
 {
     // Temp ustruct
     FServerWriteEventResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.EventId = !(dataObj->HasField("EventId")) ? TEXT("") : dataObj->GetStringField("EventId");
+    tempStruct.EventId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("EventId"));
 
     return tempStruct;
 }
@@ -341,10 +342,10 @@ FServerAuthenticateSessionTicketResult UPlayFabServerModelDecoder::decodeAuthent
 {
     // Temp ustruct
     FServerAuthenticateSessionTicketResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.IsSessionTicketExpired = !(dataObj->HasField("IsSessionTicketExpired")) ? false : dataObj->GetBoolField("IsSessionTicketExpired");
-    tempStruct.UserInfo = !(dataObj->HasField("UserInfo")) ? nullptr : dataObj->GetObjectField("UserInfo");
+    tempStruct.IsSessionTicketExpired = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("IsSessionTicketExpired"));
+    tempStruct.UserInfo = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("UserInfo"));
 
     return tempStruct;
 }
@@ -353,16 +354,16 @@ FServerServerLoginResult UPlayFabServerModelDecoder::decodeServerLoginResultResp
 {
     // Temp ustruct
     FServerServerLoginResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.EntityToken = !(dataObj->HasField("EntityToken")) ? nullptr : dataObj->GetObjectField("EntityToken");
-    tempStruct.InfoResultPayload = !(dataObj->HasField("InfoResultPayload")) ? nullptr : dataObj->GetObjectField("InfoResultPayload");
-    tempStruct.LastLoginTime = !(dataObj->HasField("LastLoginTime")) ? TEXT("") : dataObj->GetStringField("LastLoginTime");
-    tempStruct.NewlyCreated = !(dataObj->HasField("NewlyCreated")) ? false : dataObj->GetBoolField("NewlyCreated");
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.SessionTicket = !(dataObj->HasField("SessionTicket")) ? TEXT("") : dataObj->GetStringField("SessionTicket");
-    tempStruct.SettingsForUser = !(dataObj->HasField("SettingsForUser")) ? nullptr : dataObj->GetObjectField("SettingsForUser");
-    tempStruct.TreatmentAssignment = !(dataObj->HasField("TreatmentAssignment")) ? nullptr : dataObj->GetObjectField("TreatmentAssignment");
+    tempStruct.EntityToken = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("EntityToken"));
+    tempStruct.InfoResultPayload = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("InfoResultPayload"));
+    tempStruct.LastLoginTime = FPlayFabJsonDecoder::GetString(dataObj, TEXT("LastLoginTime"));
+    tempStruct.NewlyCreated = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("NewlyCreated"));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
+    tempStruct.SessionTicket = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SessionTicket"));
+    tempStruct.SettingsForUser = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("SettingsForUser"));
+    tempStruct.TreatmentAssignment = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("TreatmentAssignment"));
 
     return tempStruct;
 }
@@ -386,12 +387,12 @@ FServerGetCharacterDataResult UPlayFabServerModelDecoder::decodeGetCharacterData
 {
     // Temp ustruct
     FServerGetCharacterDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.CharacterId = !(dataObj->HasField("CharacterId")) ? TEXT("") : dataObj->GetStringField("CharacterId");
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
+    tempStruct.CharacterId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CharacterId"));
+    tempStruct.Data = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Data"));
+    tempStruct.DataVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("DataVersion"));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
 
     return tempStruct;
 }
@@ -400,9 +401,9 @@ FServerUpdateCharacterDataResult UPlayFabServerModelDecoder::decodeUpdateCharact
 {
     // Temp ustruct
     FServerUpdateCharacterDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
+    tempStruct.DataVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("DataVersion"));
 
     return tempStruct;
 }
@@ -426,9 +427,9 @@ FServerListUsersCharactersResult UPlayFabServerModelDecoder::decodeListUsersChar
 {
     // Temp ustruct
     FServerListUsersCharactersResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Characters = !(dataObj->HasField("Characters")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Characters");
+    tempStruct.Characters = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Characters"));
 
     return tempStruct;
 }
@@ -437,9 +438,9 @@ FServerGetCharacterLeaderboardResult UPlayFabServerModelDecoder::decodeGetCharac
 {
     // Temp ustruct
     FServerGetCharacterLeaderboardResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
+    tempStruct.Leaderboard = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Leaderboard"));
 
     return tempStruct;
 }
@@ -448,11 +449,11 @@ FServerGetCharacterStatisticsResult UPlayFabServerModelDecoder::decodeGetCharact
 {
     // Temp ustruct
     FServerGetCharacterStatisticsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.CharacterId = !(dataObj->HasField("CharacterId")) ? TEXT("") : dataObj->GetStringField("CharacterId");
-    tempStruct.CharacterStatistics = !(dataObj->HasField("CharacterStatistics")) ? nullptr : dataObj->GetObjectField("CharacterStatistics");
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
+    tempStruct.CharacterId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CharacterId"));
+    tempStruct.CharacterStatistics = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("CharacterStatistics"));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
 
     return tempStruct;
 }
@@ -461,9 +462,9 @@ FServerGetLeaderboardAroundCharacterResult UPlayFabServerModelDecoder::decodeGet
 {
     // Temp ustruct
     FServerGetLeaderboardAroundCharacterResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
+    tempStruct.Leaderboard = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Leaderboard"));
 
     return tempStruct;
 }
@@ -472,9 +473,9 @@ FServerGetLeaderboardForUsersCharactersResult UPlayFabServerModelDecoder::decode
 {
     // Temp ustruct
     FServerGetLeaderboardForUsersCharactersResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
+    tempStruct.Leaderboard = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Leaderboard"));
 
     return tempStruct;
 }
@@ -483,9 +484,9 @@ FServerGrantCharacterToUserResult UPlayFabServerModelDecoder::decodeGrantCharact
 {
     // Temp ustruct
     FServerGrantCharacterToUserResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.CharacterId = !(dataObj->HasField("CharacterId")) ? TEXT("") : dataObj->GetStringField("CharacterId");
+    tempStruct.CharacterId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CharacterId"));
 
     return tempStruct;
 }
@@ -509,9 +510,9 @@ FServerGetContentDownloadUrlResult UPlayFabServerModelDecoder::decodeGetContentD
 {
     // Temp ustruct
     FServerGetContentDownloadUrlResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.URL = !(dataObj->HasField("URL")) ? TEXT("") : dataObj->GetStringField("URL");
+    tempStruct.URL = FPlayFabJsonDecoder::GetString(dataObj, TEXT("URL"));
 
     return tempStruct;
 }
@@ -526,9 +527,9 @@ FServerGetFriendsListResult UPlayFabServerModelDecoder::decodeGetFriendsListResu
 {
     // Temp ustruct
     FServerGetFriendsListResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Friends = !(dataObj->HasField("Friends")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Friends");
+    tempStruct.Friends = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Friends"));
 
     return tempStruct;
 }
@@ -552,9 +553,9 @@ FServerNotifyMatchmakerPlayerLeftResult UPlayFabServerModelDecoder::decodeNotify
 {
     // Temp ustruct
     FServerNotifyMatchmakerPlayerLeftResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    GetEnumValueFromString<EPlayerConnectionState>(TEXT("EPlayerConnectionState"), dataObj->GetStringField("PlayerState"), tempStruct.PlayerState);
+    GetEnumValueFromString<EPlayerConnectionState>(TEXT("EPlayerConnectionState"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayerState")), tempStruct.PlayerState);
 
     return tempStruct;
 }
@@ -563,11 +564,11 @@ FServerRedeemMatchmakerTicketResult UPlayFabServerModelDecoder::decodeRedeemMatc
 {
     // Temp ustruct
     FServerRedeemMatchmakerTicketResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Error = !(dataObj->HasField("Error")) ? TEXT("") : dataObj->GetStringField("Error");
-    tempStruct.TicketIsValid = !(dataObj->HasField("TicketIsValid")) ? false : dataObj->GetBoolField("TicketIsValid");
-    tempStruct.UserInfo = !(dataObj->HasField("UserInfo")) ? nullptr : dataObj->GetObjectField("UserInfo");
+    tempStruct.Error = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Error"));
+    tempStruct.TicketIsValid = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("TicketIsValid"));
+    tempStruct.UserInfo = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("UserInfo"));
 
     return tempStruct;
 }
@@ -585,9 +586,9 @@ FServerRegisterGameResponse UPlayFabServerModelDecoder::decodeRegisterGameRespon
 {
     // Temp ustruct
     FServerRegisterGameResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.LobbyId = !(dataObj->HasField("LobbyId")) ? TEXT("") : dataObj->GetStringField("LobbyId");
+    tempStruct.LobbyId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("LobbyId"));
 
     return tempStruct;
 }
@@ -629,9 +630,9 @@ FServerAwardSteamAchievementResult UPlayFabServerModelDecoder::decodeAwardSteamA
 {
     // Temp ustruct
     FServerAwardSteamAchievementResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.AchievementResults = !(dataObj->HasField("AchievementResults")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("AchievementResults");
+    tempStruct.AchievementResults = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("AchievementResults"));
 
     return tempStruct;
 }
@@ -646,11 +647,11 @@ FServerGetLeaderboardResult UPlayFabServerModelDecoder::decodeGetLeaderboardResu
 {
     // Temp ustruct
     FServerGetLeaderboardResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
-    tempStruct.NextReset = !(dataObj->HasField("NextReset")) ? TEXT("") : dataObj->GetStringField("NextReset");
-    tempStruct.Version = !(dataObj->HasField("Version")) ? 0 : int(dataObj->GetNumberField("Version"));
+    tempStruct.Leaderboard = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Leaderboard"));
+    tempStruct.NextReset = FPlayFabJsonDecoder::GetString(dataObj, TEXT("NextReset"));
+    tempStruct.Version = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("Version"));
 
     return tempStruct;
 }
@@ -659,11 +660,11 @@ FServerGetLeaderboardAroundUserResult UPlayFabServerModelDecoder::decodeGetLeade
 {
     // Temp ustruct
     FServerGetLeaderboardAroundUserResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
-    tempStruct.NextReset = !(dataObj->HasField("NextReset")) ? TEXT("") : dataObj->GetStringField("NextReset");
-    tempStruct.Version = !(dataObj->HasField("Version")) ? 0 : int(dataObj->GetNumberField("Version"));
+    tempStruct.Leaderboard = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Leaderboard"));
+    tempStruct.NextReset = FPlayFabJsonDecoder::GetString(dataObj, TEXT("NextReset"));
+    tempStruct.Version = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("Version"));
 
     return tempStruct;
 }
@@ -672,10 +673,10 @@ FServerGetPlayerCombinedInfoResult UPlayFabServerModelDecoder::decodeGetPlayerCo
 {
     // Temp ustruct
     FServerGetPlayerCombinedInfoResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.InfoResultPayload = !(dataObj->HasField("InfoResultPayload")) ? nullptr : dataObj->GetObjectField("InfoResultPayload");
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
+    tempStruct.InfoResultPayload = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("InfoResultPayload"));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
 
     return tempStruct;
 }
@@ -684,10 +685,10 @@ FServerGetPlayerStatisticsResult UPlayFabServerModelDecoder::decodeGetPlayerStat
 {
     // Temp ustruct
     FServerGetPlayerStatisticsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.Statistics = !(dataObj->HasField("Statistics")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Statistics");
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
+    tempStruct.Statistics = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Statistics"));
 
     return tempStruct;
 }
@@ -696,9 +697,9 @@ FServerGetPlayerStatisticVersionsResult UPlayFabServerModelDecoder::decodeGetPla
 {
     // Temp ustruct
     FServerGetPlayerStatisticVersionsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.StatisticVersions = !(dataObj->HasField("StatisticVersions")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("StatisticVersions");
+    tempStruct.StatisticVersions = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("StatisticVersions"));
 
     return tempStruct;
 }
@@ -707,11 +708,11 @@ FServerGetUserDataResult UPlayFabServerModelDecoder::decodeGetUserDataResultResp
 {
     // Temp ustruct
     FServerGetUserDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Data"));
+    tempStruct.DataVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("DataVersion"));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
 
     return tempStruct;
 }
@@ -729,9 +730,9 @@ FServerUpdateUserDataResult UPlayFabServerModelDecoder::decodeUpdateUserDataResu
 {
     // Temp ustruct
     FServerUpdateUserDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
+    tempStruct.DataVersion = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("DataVersion"));
 
     return tempStruct;
 }
@@ -746,10 +747,10 @@ FServerModifyCharacterVirtualCurrencyResult UPlayFabServerModelDecoder::decodeMo
 {
     // Temp ustruct
     FServerModifyCharacterVirtualCurrencyResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Balance = !(dataObj->HasField("Balance")) ? 0 : int(dataObj->GetNumberField("Balance"));
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? TEXT("") : dataObj->GetStringField("VirtualCurrency");
+    tempStruct.Balance = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("Balance"));
+    tempStruct.VirtualCurrency = FPlayFabJsonDecoder::GetString(dataObj, TEXT("VirtualCurrency"));
 
     return tempStruct;
 }
@@ -758,12 +759,12 @@ FServerModifyUserVirtualCurrencyResult UPlayFabServerModelDecoder::decodeModifyU
 {
     // Temp ustruct
     FServerModifyUserVirtualCurrencyResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Balance = !(dataObj->HasField("Balance")) ? 0 : int(dataObj->GetNumberField("Balance"));
-    tempStruct.BalanceChange = !(dataObj->HasField("BalanceChange")) ? 0 : int(dataObj->GetNumberField("BalanceChange"));
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? TEXT("") : dataObj->GetStringField("VirtualCurrency");
+    tempStruct.Balance = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("Balance"));
+    tempStruct.BalanceChange = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("BalanceChange"));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
+    tempStruct.VirtualCurrency = FPlayFabJsonDecoder::GetString(dataObj, TEXT("VirtualCurrency"));
 
     return tempStruct;
 }
@@ -772,10 +773,10 @@ FServerConsumeItemResult UPlayFabServerModelDecoder::decodeConsumeItemResultResp
 {
     // Temp ustruct
     FServerConsumeItemResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ItemInstanceId = !(dataObj->HasField("ItemInstanceId")) ? TEXT("") : dataObj->GetStringField("ItemInstanceId");
-    tempStruct.RemainingUses = !(dataObj->HasField("RemainingUses")) ? 0 : int(dataObj->GetNumberField("RemainingUses"));
+    tempStruct.ItemInstanceId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ItemInstanceId"));
+    tempStruct.RemainingUses = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("RemainingUses"));
 
     return tempStruct;
 }
@@ -784,9 +785,9 @@ FServerEvaluateRandomResultTableResult UPlayFabServerModelDecoder::decodeEvaluat
 {
     // Temp ustruct
     FServerEvaluateRandomResultTableResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ResultItemId = !(dataObj->HasField("ResultItemId")) ? TEXT("") : dataObj->GetStringField("ResultItemId");
+    tempStruct.ResultItemId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ResultItemId"));
 
     return tempStruct;
 }
@@ -795,13 +796,13 @@ FServerGetCharacterInventoryResult UPlayFabServerModelDecoder::decodeGetCharacte
 {
     // Temp ustruct
     FServerGetCharacterInventoryResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.CharacterId = !(dataObj->HasField("CharacterId")) ? TEXT("") : dataObj->GetStringField("CharacterId");
-    tempStruct.Inventory = !(dataObj->HasField("Inventory")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Inventory");
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? nullptr : dataObj->GetObjectField("VirtualCurrency");
-    tempStruct.VirtualCurrencyRechargeTimes = !(dataObj->HasField("VirtualCurrencyRechargeTimes")) ? nullptr : dataObj->GetObjectField("VirtualCurrencyRechargeTimes");
+    tempStruct.CharacterId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CharacterId"));
+    tempStruct.Inventory = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Inventory"));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
+    tempStruct.VirtualCurrency = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("VirtualCurrency"));
+    tempStruct.VirtualCurrencyRechargeTimes = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("VirtualCurrencyRechargeTimes"));
 
     return tempStruct;
 }
@@ -810,9 +811,9 @@ FServerGetRandomResultTablesResult UPlayFabServerModelDecoder::decodeGetRandomRe
 {
     // Temp ustruct
     FServerGetRandomResultTablesResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Tables = !(dataObj->HasField("Tables")) ? nullptr : dataObj->GetObjectField("Tables");
+    tempStruct.Tables = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Tables"));
 
     return tempStruct;
 }
@@ -821,12 +822,12 @@ FServerGetUserInventoryResult UPlayFabServerModelDecoder::decodeGetUserInventory
 {
     // Temp ustruct
     FServerGetUserInventoryResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Inventory = !(dataObj->HasField("Inventory")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Inventory");
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? nullptr : dataObj->GetObjectField("VirtualCurrency");
-    tempStruct.VirtualCurrencyRechargeTimes = !(dataObj->HasField("VirtualCurrencyRechargeTimes")) ? nullptr : dataObj->GetObjectField("VirtualCurrencyRechargeTimes");
+    tempStruct.Inventory = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Inventory"));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
+    tempStruct.VirtualCurrency = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("VirtualCurrency"));
+    tempStruct.VirtualCurrencyRechargeTimes = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("VirtualCurrencyRechargeTimes"));
 
     return tempStruct;
 }
@@ -835,9 +836,9 @@ FServerGrantItemsToCharacterResult UPlayFabServerModelDecoder::decodeGrantItemsT
 {
     // Temp ustruct
     FServerGrantItemsToCharacterResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ItemGrantResults = !(dataObj->HasField("ItemGrantResults")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("ItemGrantResults");
+    tempStruct.ItemGrantResults = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("ItemGrantResults"));
 
     return tempStruct;
 }
@@ -846,9 +847,9 @@ FServerGrantItemsToUserResult UPlayFabServerModelDecoder::decodeGrantItemsToUser
 {
     // Temp ustruct
     FServerGrantItemsToUserResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ItemGrantResults = !(dataObj->HasField("ItemGrantResults")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("ItemGrantResults");
+    tempStruct.ItemGrantResults = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("ItemGrantResults"));
 
     return tempStruct;
 }
@@ -857,9 +858,9 @@ FServerGrantItemsToUsersResult UPlayFabServerModelDecoder::decodeGrantItemsToUse
 {
     // Temp ustruct
     FServerGrantItemsToUsersResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ItemGrantResults = !(dataObj->HasField("ItemGrantResults")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("ItemGrantResults");
+    tempStruct.ItemGrantResults = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("ItemGrantResults"));
 
     return tempStruct;
 }
@@ -868,10 +869,10 @@ FServerModifyItemUsesResult UPlayFabServerModelDecoder::decodeModifyItemUsesResu
 {
     // Temp ustruct
     FServerModifyItemUsesResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ItemInstanceId = !(dataObj->HasField("ItemInstanceId")) ? TEXT("") : dataObj->GetStringField("ItemInstanceId");
-    tempStruct.RemainingUses = !(dataObj->HasField("RemainingUses")) ? 0 : int(dataObj->GetNumberField("RemainingUses"));
+    tempStruct.ItemInstanceId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ItemInstanceId"));
+    tempStruct.RemainingUses = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("RemainingUses"));
 
     return tempStruct;
 }
@@ -907,9 +908,9 @@ FServerRedeemCouponResult UPlayFabServerModelDecoder::decodeRedeemCouponResultRe
 {
     // Temp ustruct
     FServerRedeemCouponResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.GrantedItems = !(dataObj->HasField("GrantedItems")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("GrantedItems");
+    tempStruct.GrantedItems = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("GrantedItems"));
 
     return tempStruct;
 }
@@ -918,9 +919,9 @@ FServerReportPlayerServerResult UPlayFabServerModelDecoder::decodeReportPlayerSe
 {
     // Temp ustruct
     FServerReportPlayerServerResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.SubmissionsRemaining = !(dataObj->HasField("SubmissionsRemaining")) ? 0 : int(dataObj->GetNumberField("SubmissionsRemaining"));
+    tempStruct.SubmissionsRemaining = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("SubmissionsRemaining"));
 
     return tempStruct;
 }
@@ -938,9 +939,9 @@ FServerRevokeInventoryItemsResult UPlayFabServerModelDecoder::decodeRevokeInvent
 {
     // Temp ustruct
     FServerRevokeInventoryItemsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Errors = !(dataObj->HasField("Errors")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Errors");
+    tempStruct.Errors = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Errors"));
 
     return tempStruct;
 }
@@ -949,12 +950,12 @@ FServerUnlockContainerItemResult UPlayFabServerModelDecoder::decodeUnlockContain
 {
     // Temp ustruct
     FServerUnlockContainerItemResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.GrantedItems = !(dataObj->HasField("GrantedItems")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("GrantedItems");
-    tempStruct.UnlockedItemInstanceId = !(dataObj->HasField("UnlockedItemInstanceId")) ? TEXT("") : dataObj->GetStringField("UnlockedItemInstanceId");
-    tempStruct.UnlockedWithItemInstanceId = !(dataObj->HasField("UnlockedWithItemInstanceId")) ? TEXT("") : dataObj->GetStringField("UnlockedWithItemInstanceId");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? nullptr : dataObj->GetObjectField("VirtualCurrency");
+    tempStruct.GrantedItems = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("GrantedItems"));
+    tempStruct.UnlockedItemInstanceId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("UnlockedItemInstanceId"));
+    tempStruct.UnlockedWithItemInstanceId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("UnlockedWithItemInstanceId"));
+    tempStruct.VirtualCurrency = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("VirtualCurrency"));
 
     return tempStruct;
 }
@@ -978,9 +979,9 @@ FServerGetAllSegmentsResult UPlayFabServerModelDecoder::decodeGetAllSegmentsResu
 {
     // Temp ustruct
     FServerGetAllSegmentsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Segments = !(dataObj->HasField("Segments")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Segments");
+    tempStruct.Segments = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Segments"));
 
     return tempStruct;
 }
@@ -989,9 +990,9 @@ FServerGetPlayerSegmentsResult UPlayFabServerModelDecoder::decodeGetPlayerSegmen
 {
     // Temp ustruct
     FServerGetPlayerSegmentsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Segments = !(dataObj->HasField("Segments")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Segments");
+    tempStruct.Segments = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Segments"));
 
     return tempStruct;
 }
@@ -1000,11 +1001,11 @@ FServerGetPlayersInSegmentResult UPlayFabServerModelDecoder::decodeGetPlayersInS
 {
     // Temp ustruct
     FServerGetPlayersInSegmentResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ContinuationToken = !(dataObj->HasField("ContinuationToken")) ? TEXT("") : dataObj->GetStringField("ContinuationToken");
-    tempStruct.PlayerProfiles = !(dataObj->HasField("PlayerProfiles")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("PlayerProfiles");
-    tempStruct.ProfilesInSegment = !(dataObj->HasField("ProfilesInSegment")) ? 0 : int(dataObj->GetNumberField("ProfilesInSegment"));
+    tempStruct.ContinuationToken = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ContinuationToken"));
+    tempStruct.PlayerProfiles = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("PlayerProfiles"));
+    tempStruct.ProfilesInSegment = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ProfilesInSegment"));
 
     return tempStruct;
 }
@@ -1013,10 +1014,10 @@ FServerGetPlayerTagsResult UPlayFabServerModelDecoder::decodeGetPlayerTagsResult
 {
     // Temp ustruct
     FServerGetPlayerTagsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.Tags = !(dataObj->HasField("Tags")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("Tags"), TEXT(","));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
+    tempStruct.Tags = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("Tags"));
 
     return tempStruct;
 }
@@ -1040,20 +1041,20 @@ FServerExecuteCloudScriptResult UPlayFabServerModelDecoder::decodeExecuteCloudSc
 {
     // Temp ustruct
     FServerExecuteCloudScriptResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.APIRequestsIssued = !(dataObj->HasField("APIRequestsIssued")) ? 0 : int(dataObj->GetNumberField("APIRequestsIssued"));
-    tempStruct.Error = !(dataObj->HasField("Error")) ? nullptr : dataObj->GetObjectField("Error");
-    tempStruct.ExecutionTimeSeconds = !(dataObj->HasField("ExecutionTimeSeconds")) ? 0 : int(dataObj->GetNumberField("ExecutionTimeSeconds"));
-    tempStruct.FunctionName = !(dataObj->HasField("FunctionName")) ? TEXT("") : dataObj->GetStringField("FunctionName");
-    tempStruct.FunctionResult = !(dataObj->HasField("FunctionResult")) ? nullptr : dataObj->GetObjectField("FunctionResult");
-    tempStruct.FunctionResultTooLarge = !(dataObj->HasField("FunctionResultTooLarge")) ? false : dataObj->GetBoolField("FunctionResultTooLarge");
-    tempStruct.HttpRequestsIssued = !(dataObj->HasField("HttpRequestsIssued")) ? 0 : int(dataObj->GetNumberField("HttpRequestsIssued"));
-    tempStruct.Logs = !(dataObj->HasField("Logs")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Logs");
-    tempStruct.LogsTooLarge = !(dataObj->HasField("LogsTooLarge")) ? false : dataObj->GetBoolField("LogsTooLarge");
-    tempStruct.MemoryConsumedBytes = !(dataObj->HasField("MemoryConsumedBytes")) ? 0 : int(dataObj->GetNumberField("MemoryConsumedBytes"));
-    tempStruct.ProcessorTimeSeconds = !(dataObj->HasField("ProcessorTimeSeconds")) ? 0 : int(dataObj->GetNumberField("ProcessorTimeSeconds"));
-    tempStruct.Revision = !(dataObj->HasField("Revision")) ? 0 : int(dataObj->GetNumberField("Revision"));
+    tempStruct.APIRequestsIssued = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("APIRequestsIssued"));
+    tempStruct.Error = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Error"));
+    tempStruct.ExecutionTimeSeconds = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ExecutionTimeSeconds"));
+    tempStruct.FunctionName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("FunctionName"));
+    tempStruct.FunctionResult = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("FunctionResult"));
+    tempStruct.FunctionResultTooLarge = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("FunctionResultTooLarge"));
+    tempStruct.HttpRequestsIssued = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("HttpRequestsIssued"));
+    tempStruct.Logs = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Logs"));
+    tempStruct.LogsTooLarge = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("LogsTooLarge"));
+    tempStruct.MemoryConsumedBytes = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("MemoryConsumedBytes"));
+    tempStruct.ProcessorTimeSeconds = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ProcessorTimeSeconds"));
+    tempStruct.Revision = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("Revision"));
 
     return tempStruct;
 }
@@ -1077,9 +1078,9 @@ FServerCreateSharedGroupResult UPlayFabServerModelDecoder::decodeCreateSharedGro
 {
     // Temp ustruct
     FServerCreateSharedGroupResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.SharedGroupId = !(dataObj->HasField("SharedGroupId")) ? TEXT("") : dataObj->GetStringField("SharedGroupId");
+    tempStruct.SharedGroupId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SharedGroupId"));
 
     return tempStruct;
 }
@@ -1088,10 +1089,10 @@ FServerGetSharedGroupDataResult UPlayFabServerModelDecoder::decodeGetSharedGroup
 {
     // Temp ustruct
     FServerGetSharedGroupDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
-    tempStruct.Members = !(dataObj->HasField("Members")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("Members"), TEXT(","));
+    tempStruct.Data = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Data"));
+    tempStruct.Members = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("Members"));
 
     return tempStruct;
 }
@@ -1124,9 +1125,9 @@ FServerGetCatalogItemsResult UPlayFabServerModelDecoder::decodeGetCatalogItemsRe
 {
     // Temp ustruct
     FServerGetCatalogItemsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Catalog = !(dataObj->HasField("Catalog")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Catalog");
+    tempStruct.Catalog = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Catalog"));
 
     return tempStruct;
 }
@@ -1135,9 +1136,9 @@ FServerGetPublisherDataResult UPlayFabServerModelDecoder::decodeGetPublisherData
 {
     // Temp ustruct
     FServerGetPublisherDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -1146,13 +1147,13 @@ FServerGetStoreItemsResult UPlayFabServerModelDecoder::decodeGetStoreItemsResult
 {
     // Temp ustruct
     FServerGetStoreItemsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.CatalogVersion = !(dataObj->HasField("CatalogVersion")) ? TEXT("") : dataObj->GetStringField("CatalogVersion");
-    tempStruct.MarketingData = !(dataObj->HasField("MarketingData")) ? nullptr : dataObj->GetObjectField("MarketingData");
-    GetEnumValueFromString<EPfSourceType>(TEXT("EPfSourceType"), dataObj->GetStringField("Source"), tempStruct.Source);
-    tempStruct.Store = !(dataObj->HasField("Store")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Store");
-    tempStruct.StoreId = !(dataObj->HasField("StoreId")) ? TEXT("") : dataObj->GetStringField("StoreId");
+    tempStruct.CatalogVersion = FPlayFabJsonDecoder::GetString(dataObj, TEXT("CatalogVersion"));
+    tempStruct.MarketingData = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("MarketingData"));
+    GetEnumValueFromString<EPfSourceType>(TEXT("EPfSourceType"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("Source")), tempStruct.Source);
+    tempStruct.Store = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Store"));
+    tempStruct.StoreId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("StoreId"));
 
     return tempStruct;
 }
@@ -1161,9 +1162,9 @@ FServerGetTimeResult UPlayFabServerModelDecoder::decodeGetTimeResultResponse(UPl
 {
     // Temp ustruct
     FServerGetTimeResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Time = !(dataObj->HasField("Time")) ? TEXT("") : dataObj->GetStringField("Time");
+    tempStruct.Time = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Time"));
 
     return tempStruct;
 }
@@ -1172,9 +1173,9 @@ FServerGetTitleDataResult UPlayFabServerModelDecoder::decodeGetTitleDataResultRe
 {
     // Temp ustruct
     FServerGetTitleDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
+    tempStruct.Data = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Data"));
 
     return tempStruct;
 }
@@ -1183,9 +1184,9 @@ FServerGetTitleNewsResult UPlayFabServerModelDecoder::decodeGetTitleNewsResultRe
 {
     // Temp ustruct
     FServerGetTitleNewsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.News = !(dataObj->HasField("News")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("News");
+    tempStruct.News = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("News"));
 
     return tempStruct;
 }
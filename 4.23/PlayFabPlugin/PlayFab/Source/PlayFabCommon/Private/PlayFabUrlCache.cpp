@@ -0,0 +1,54 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabUrlCache.h"
+#include "PlayFabCommon/Public/PlayFabRuntimeSettings.h"
+#include "PlayFabCommon/Public/PlayFabCommonUtils.h"
+#include "Misc/ScopeRWLock.h"
+
+using namespace PlayFabCommon;
+
+FString FPlayFabUrlCache::GetUrl(const FString& urlPath, const FString& sdkVersion)
+{
+    const UPlayFabRuntimeSettings* rSettings = GetDefault<UPlayFabRuntimeSettings>();
+    {
+        FRWScopeLock ReadLock(Lock, SLT_ReadOnly);
+        if (IsCurrent(rSettings->TitleId, rSettings->ProductionEnvironmentURL, sdkVersion))
+        {
+            if (const FString* Url = Urls.Find(urlPath))
+            {
+                return *Url;
+            }
+        }
+    }
+
+    FRWScopeLock WriteLock(Lock, SLT_Write);
+    if (!IsCurrent(rSettings->TitleId, rSettings->ProductionEnvironmentURL, sdkVersion))
+    {
+        CachedTitleId = rSettings->TitleId;
+        CachedProductionEnvironmentURL = rSettings->ProductionEnvironmentURL;
+        CachedSdkVersion = sdkVersion;
+        Prefix = CachedProductionEnvironmentURL.StartsWith(TEXT("https://"))
+            ? CachedProductionEnvironmentURL
+            : TEXT("https://") + CachedTitleId + CachedProductionEnvironmentURL;
+        Suffix = TEXT("?sdk=") + PlayFabCommonUtils::PercentEncodeQueryValue(CachedSdkVersion);
+        Urls.Reset();
+    }
+
+    if (const FString* Url = Urls.Find(urlPath))
+    {
+        return *Url;
+    }
+    return Urls.Add(urlPath, Prefix + urlPath + Suffix);
+}
+
+bool FPlayFabUrlCache::IsCurrent(const FString& TitleId, const FString& ProductionEnvironmentURL, const FString& sdkVersion) const
+{
+    // Case sensitive comparisons check the length first, so an unchanged setting costs a few character compares
+    return !Prefix.IsEmpty()
+        && CachedTitleId.Equals(TitleId, ESearchCase::CaseSensitive)
+        && CachedProductionEnvironmentURL.Equals(ProductionEnvironmentURL, ESearchCase::CaseSensitive)
+        && CachedSdkVersion.Equals(sdkVersion, ESearchCase::CaseSensitive);
+}
@@ -25,19 +25,6 @@ namespace PlayFabCommon
         static FString photonTurnbasedAppId;
         static FString photonChatAppId;
 
-        static FString GeneratePfUrl(const FString& urlPath)
-        {
-            const UPlayFabRuntimeSettings* rSettings = GetDefault<UPlayFabRuntimeSettings>();
-            if (rSettings->ProductionEnvironmentURL.StartsWith(TEXT("https://")))
-            {
-                return rSettings->ProductionEnvironmentURL
-                    + urlPath + TEXT("?sdk=") + versionString;
-            }
-            else
-            {
-                return TEXT("https://") + rSettings->TitleId + rSettings->ProductionEnvironmentURL
-                    + urlPath + TEXT("?sdk=") + versionString;
-            }
-        }
+        static FString GeneratePfUrl(const FString& urlPath);
     };
 }
@@ -7,6 +7,7 @@
 
 #include "Core/PlayFabAuthenticationDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
+#include "Core/PlayFabJsonPullReader.h"
 
 using namespace PlayFab;
 using namespace PlayFab::AuthenticationModels;
@@ -16,7 +17,8 @@ PlayFab::AuthenticationModels::FEntityKey::~FEntityKey()
 
 }
 
-void PlayFab::AuthenticationModels::FEntityKey::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AuthenticationModels::FEntityKey::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -39,6 +41,16 @@ void PlayFab::AuthenticationModels::FEntityKey::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AuthenticationModels::FEntityKey::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AuthenticationModels::FEntityKey::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AuthenticationModels::FEntityKey::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -60,12 +72,43 @@ bool PlayFab::AuthenticationModels::FEntityKey::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::AuthenticationModels::FEntityKey::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Type"))
+        {
+            reader.ReadValue(Type);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityKey();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AuthenticationModels::FEntityLineage::~FEntityLineage()
 {
 
 }
 
-void PlayFab::AuthenticationModels::FEntityLineage::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AuthenticationModels::FEntityLineage::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -108,6 +151,16 @@ void PlayFab::AuthenticationModels::FEntityLineage::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AuthenticationModels::FEntityLineage::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AuthenticationModels::FEntityLineage::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AuthenticationModels::FEntityLineage::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -157,13 +210,60 @@ bool PlayFab::AuthenticationModels::FEntityLineage::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::AuthenticationModels::FEntityLineage::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("GroupId"))
+        {
+            reader.ReadValue(GroupId);
+        }
+        else if (reader.IsField("MasterPlayerAccountId"))
+        {
+            reader.ReadValue(MasterPlayerAccountId);
+        }
+        else if (reader.IsField("NamespaceId"))
+        {
+            reader.ReadValue(NamespaceId);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else if (reader.IsField("TitlePlayerAccountId"))
+        {
+            reader.ReadValue(TitlePlayerAccountId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityLineage();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AuthenticationModels::FGetEntityTokenRequest::~FGetEntityTokenRequest()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::AuthenticationModels::FGetEntityTokenRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AuthenticationModels::FGetEntityTokenRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -187,6 +287,16 @@ void PlayFab::AuthenticationModels::FGetEntityTokenRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AuthenticationModels::FGetEntityTokenRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AuthenticationModels::FGetEntityTokenRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AuthenticationModels::FGetEntityTokenRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -196,26 +306,65 @@ bool PlayFab::AuthenticationModels::FGetEntityTokenRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AuthenticationModels::FGetEntityTokenRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetEntityTokenRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AuthenticationModels::FGetEntityTokenResponse::~FGetEntityTokenResponse()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::AuthenticationModels::FGetEntityTokenResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AuthenticationModels::FGetEntityTokenResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -240,6 +389,16 @@ void PlayFab::AuthenticationModels::FGetEntityTokenResponse::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AuthenticationModels::FGetEntityTokenResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AuthenticationModels::FGetEntityTokenResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AuthenticationModels::FGetEntityTokenResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -247,7 +406,7 @@ bool PlayFab::AuthenticationModels::FGetEntityTokenResponse::readFromValue(const
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> EntityTokenValue = obj->TryGetField(TEXT("EntityToken"));
@@ -265,7 +424,43 @@ bool PlayFab::AuthenticationModels::FGetEntityTokenResponse::readFromValue(const
     return HasSucceeded;
 }
 
-void PlayFab::AuthenticationModels::writeIdentifiedDeviceTypeEnumJSON(IdentifiedDeviceType enumVal, JsonWriter& writer)
+bool PlayFab::AuthenticationModels::FGetEntityTokenResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("EntityToken"))
+        {
+            reader.ReadValue(EntityToken);
+        }
+        else if (reader.IsField("TokenExpiration"))
+        {
+            reader.ReadValue(TokenExpiration);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetEntityTokenResponse();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeIdentifiedDeviceTypeEnumValue(AuthenticationModels::IdentifiedDeviceType enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -276,6 +471,16 @@ void PlayFab::AuthenticationModels::writeIdentifiedDeviceTypeEnumJSON(Identified
     }
 }
 
+void PlayFab::AuthenticationModels::writeIdentifiedDeviceTypeEnumJSON(IdentifiedDeviceType enumVal, JsonWriter& writer)
+{
+    writeIdentifiedDeviceTypeEnumValue(enumVal, writer);
+}
+
+void PlayFab::AuthenticationModels::writeIdentifiedDeviceTypeEnumJSON(IdentifiedDeviceType enumVal, JsonUtf8Writer& writer)
+{
+    writeIdentifiedDeviceTypeEnumValue(enumVal, writer);
+}
+
 AuthenticationModels::IdentifiedDeviceType PlayFab::AuthenticationModels::readIdentifiedDeviceTypeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readIdentifiedDeviceTypeFromValue(value.IsValid() ? value->AsString() : "");
@@ -303,7 +508,8 @@ AuthenticationModels::IdentifiedDeviceType PlayFab::AuthenticationModels::readId
     return IdentifiedDeviceTypeUnknown; // Basically critical fail
 }
 
-void PlayFab::AuthenticationModels::writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonWriter& writer)
+template <typename WriterType>
+static void writeLoginIdentityProviderEnumValue(AuthenticationModels::LoginIdentityProvider enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -332,6 +538,16 @@ void PlayFab::AuthenticationModels::writeLoginIdentityProviderEnumJSON(LoginIden
     }
 }
 
+void PlayFab::AuthenticationModels::writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonWriter& writer)
+{
+    writeLoginIdentityProviderEnumValue(enumVal, writer);
+}
+
+void PlayFab::AuthenticationModels::writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonUtf8Writer& writer)
+{
+    writeLoginIdentityProviderEnumValue(enumVal, writer);
+}
+
 AuthenticationModels::LoginIdentityProvider PlayFab::AuthenticationModels::readLoginIdentityProviderFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readLoginIdentityProviderFromValue(value.IsValid() ? value->AsString() : "");
@@ -382,7 +598,8 @@ PlayFab::AuthenticationModels::FValidateEntityTokenRequest::~FValidateEntityToke
 
 }
 
-void PlayFab::AuthenticationModels::FValidateEntityTokenRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AuthenticationModels::FValidateEntityTokenRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -410,6 +627,16 @@ void PlayFab::AuthenticationModels::FValidateEntityTokenRequest::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AuthenticationModels::FValidateEntityTokenRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AuthenticationModels::FValidateEntityTokenRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AuthenticationModels::FValidateEntityTokenRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -419,7 +646,7 @@ bool PlayFab::AuthenticationModels::FValidateEntityTokenRequest::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -433,6 +660,43 @@ bool PlayFab::AuthenticationModels::FValidateEntityTokenRequest::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::AuthenticationModels::FValidateEntityTokenRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EntityToken"))
+        {
+            reader.ReadValue(EntityToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FValidateEntityTokenRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AuthenticationModels::FValidateEntityTokenResponse::~FValidateEntityTokenResponse()
 {
     //if (Entity != nullptr) delete Entity;
@@ -440,7 +704,8 @@ PlayFab::AuthenticationModels::FValidateEntityTokenResponse::~FValidateEntityTok
 
 }
 
-void PlayFab::AuthenticationModels::FValidateEntityTokenResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AuthenticationModels::FValidateEntityTokenResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -471,6 +736,16 @@ void PlayFab::AuthenticationModels::FValidateEntityTokenResponse::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AuthenticationModels::FValidateEntityTokenResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AuthenticationModels::FValidateEntityTokenResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AuthenticationModels::FValidateEntityTokenResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -478,7 +753,7 @@ bool PlayFab::AuthenticationModels::FValidateEntityTokenResponse::readFromValue(
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     pfIdentifiedDeviceType = readIdentifiedDeviceTypeFromValue(obj->TryGetField(TEXT("IdentifiedDeviceType")));
@@ -488,9 +763,51 @@ bool PlayFab::AuthenticationModels::FValidateEntityTokenResponse::readFromValue(
     const TSharedPtr<FJsonValue> LineageValue = obj->TryGetField(TEXT("Lineage"));
     if (LineageValue.IsValid() && !LineageValue->IsNull())
     {
-        Lineage = MakeShareable(new FEntityLineage(LineageValue->AsObject()));
+        Lineage = MakeShared<FEntityLineage>(LineageValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AuthenticationModels::FValidateEntityTokenResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("IdentifiedDeviceType"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfIdentifiedDeviceType = readIdentifiedDeviceTypeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("IdentityProvider"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { IdentityProvider = readLoginIdentityProviderFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Lineage"))
+        {
+            Lineage = MakeShared<FEntityLineage>();
+            Lineage->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FValidateEntityTokenResponse();
+        return false;
+    }
+    return true;
+}
+
@@ -0,0 +1,112 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabCompression.h"
+#include "PlayFabRuntimeSettings.h"
+#include "PlayFab.h"
+#include "Misc/Compression.h"
+#include "Misc/ScopeLock.h"
+
+using namespace PlayFab;
+
+namespace
+{
+    FCriticalSection StatsLock;
+    FPlayFabCompressionStats Stats;
+
+    // Deflate can't expand data by more than this, so a larger claimed size is bogus whatever the settings allow
+    const int64 MaxDeflateRatio = 1032;
+
+    void CountRequest(int32 UncompressedSize, int32 SentSize)
+    {
+        FScopeLock Lock(&StatsLock);
+        Stats.RequestBytesUncompressed += UncompressedSize;
+        Stats.RequestBytesSent += SentSize;
+    }
+
+    bool IsGzip(const TArray<uint8>& Body)
+    {
+        // Magic number, then the 8 byte trailer holding the CRC and the uncompressed size
+        return Body.Num() >= 18 && Body[0] == 0x1f && Body[1] == 0x8b;
+    }
+}
+
+bool FPlayFabCompression::IsEnabled()
+{
+    return GetDefault<UPlayFabRuntimeSettings>()->bCompressApiData;
+}
+
+void FPlayFabCompression::SetRequestBody(const TSharedRef<IHttpRequest>& HttpRequest, const TArray<uint8>& Body)
+{
+    const UPlayFabRuntimeSettings* Settings = GetDefault<UPlayFabRuntimeSettings>();
+    if (!Settings->bCompressApiData || Body.Num() < Settings->CompressionThresholdBytes)
+    {
+        HttpRequest->SetContent(Body);
+        CountRequest(Body.Num(), Body.Num());
+        return;
+    }
+
+    TArray<uint8> Compressed;
+    int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Gzip, Body.Num());
+    Compressed.SetNumUninitialized(CompressedSize);
+    if (!FCompression::CompressMemory(NAME_Gzip, Compressed.GetData(), CompressedSize, Body.GetData(), Body.Num()) || CompressedSize >= Body.Num())
+    {
+        HttpRequest->SetContent(Body);
+        CountRequest(Body.Num(), Body.Num());
+        return;
+    }
+    Compressed.SetNum(CompressedSize, false);
+
+    HttpRequest->SetHeader(TEXT("Content-Encoding"), TEXT("gzip"));
+    HttpRequest->SetContent(Compressed);
+    CountRequest(Body.Num(), CompressedSize);
+}
+
+const TArray<uint8>& FPlayFabCompression::GetResponseBody(const FHttpResponsePtr& HttpResponse, TArray<uint8>& Scratch)
+{
+    return GetResponseBody(HttpResponse->GetContent(), HttpResponse->GetHeader(TEXT("Content-Encoding")), Scratch);
+}
+
+const TArray<uint8>& FPlayFabCompression::GetResponseBody(const TArray<uint8>& Body, const FString& ContentEncoding, TArray<uint8>& Scratch)
+{
+    if (!IsGzip(Body) || !ContentEncoding.Contains(TEXT("gzip")))
+    {
+        return Body;
+    }
+
+    // ISIZE, the last four bytes, is the uncompressed size modulo 2^32; it comes from the server, so it is only trusted within limits
+    const int32 Trailer = Body.Num() - 4;
+    const uint32 UncompressedSize = Body[Trailer] | (Body[Trailer + 1] << 8) | (Body[Trailer + 2] << 16) | ((uint32)Body[Trailer + 3] << 24);
+    const int64 MaxSize = FMath::Min<int64>(GetDefault<UPlayFabRuntimeSettings>()->MaxDecompressedResponseBytes, (int64)Body.Num() * MaxDeflateRatio);
+    if (UncompressedSize == 0 || UncompressedSize > MaxSize)
+    {
+        UE_LOG(LogPlayFabCpp, Warning, TEXT("Rejected a gzip response of %d bytes that claims to decompress to %u bytes"), Body.Num(), UncompressedSize);
+        Scratch.Reset();
+        return Scratch;
+    }
+
+    Scratch.SetNumUninitialized(UncompressedSize);
+    if (!FCompression::UncompressMemory(NAME_Gzip, Scratch.GetData(), UncompressedSize, Body.GetData(), Body.Num()))
+    {
+        UE_LOG(LogPlayFabCpp, Warning, TEXT("Could not decompress a gzip response of %d bytes"), Body.Num());
+        Scratch.Reset();
+        return Scratch;
+    }
+
+    return Scratch;
+}
+
+void FPlayFabCompression::CountResponse(int32 ReceivedSize, int32 UncompressedSize)
+{
+    FScopeLock Lock(&StatsLock);
+    Stats.ResponseBytesReceived += ReceivedSize;
+    Stats.ResponseBytesUncompressed += UncompressedSize;
+}
+
+FPlayFabCompressionStats FPlayFabCompression::GetStats()
+{
+    FScopeLock Lock(&StatsLock);
+    return Stats;
+}
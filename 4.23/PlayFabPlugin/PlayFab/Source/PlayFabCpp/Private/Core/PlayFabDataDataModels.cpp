@@ -7,6 +7,7 @@
 
 #include "Core/PlayFabDataDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
+#include "Core/PlayFabJsonPullReader.h"
 
 using namespace PlayFab;
 using namespace PlayFab::DataModels;
@@ -16,7 +17,8 @@ PlayFab::DataModels::FEntityKey::~FEntityKey()
 
 }
 
-void PlayFab::DataModels::FEntityKey::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FEntityKey::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -39,6 +41,16 @@ void PlayFab::DataModels::FEntityKey::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FEntityKey::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FEntityKey::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FEntityKey::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -60,12 +72,43 @@ bool PlayFab::DataModels::FEntityKey::readFromValue(const TSharedPtr<FJsonObject
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FEntityKey::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Type"))
+        {
+            reader.ReadValue(Type);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityKey();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::DataModels::FAbortFileUploadsRequest::~FAbortFileUploadsRequest()
 {
 
 }
 
-void PlayFab::DataModels::FAbortFileUploadsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FAbortFileUploadsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -98,6 +141,16 @@ void PlayFab::DataModels::FAbortFileUploadsRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FAbortFileUploadsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FAbortFileUploadsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FAbortFileUploadsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -107,7 +160,7 @@ bool PlayFab::DataModels::FAbortFileUploadsRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -129,13 +182,66 @@ bool PlayFab::DataModels::FAbortFileUploadsRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FAbortFileUploadsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("FileNames"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { FileNames.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ProfileVersion"))
+        {
+            reader.ReadValue(ProfileVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAbortFileUploadsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::DataModels::FAbortFileUploadsResponse::~FAbortFileUploadsResponse()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::DataModels::FAbortFileUploadsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FAbortFileUploadsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -151,6 +257,16 @@ void PlayFab::DataModels::FAbortFileUploadsResponse::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FAbortFileUploadsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FAbortFileUploadsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FAbortFileUploadsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -158,7 +274,7 @@ bool PlayFab::DataModels::FAbortFileUploadsResponse::readFromValue(const TShared
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ProfileVersionValue = obj->TryGetField(TEXT("ProfileVersion"));
@@ -171,12 +287,44 @@ bool PlayFab::DataModels::FAbortFileUploadsResponse::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FAbortFileUploadsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("ProfileVersion"))
+        {
+            reader.ReadValue(ProfileVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAbortFileUploadsResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::DataModels::FDeleteFilesRequest::~FDeleteFilesRequest()
 {
 
 }
 
-void PlayFab::DataModels::FDeleteFilesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FDeleteFilesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -209,6 +357,16 @@ void PlayFab::DataModels::FDeleteFilesRequest::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FDeleteFilesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FDeleteFilesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FDeleteFilesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -218,7 +376,7 @@ bool PlayFab::DataModels::FDeleteFilesRequest::readFromValue(const TSharedPtr<FJ
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -240,13 +398,66 @@ bool PlayFab::DataModels::FDeleteFilesRequest::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FDeleteFilesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("FileNames"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { FileNames.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ProfileVersion"))
+        {
+            reader.ReadValue(ProfileVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteFilesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::DataModels::FDeleteFilesResponse::~FDeleteFilesResponse()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::DataModels::FDeleteFilesResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FDeleteFilesResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -262,6 +473,16 @@ void PlayFab::DataModels::FDeleteFilesResponse::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FDeleteFilesResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FDeleteFilesResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FDeleteFilesResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -269,7 +490,7 @@ bool PlayFab::DataModels::FDeleteFilesResponse::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ProfileVersionValue = obj->TryGetField(TEXT("ProfileVersion"));
@@ -282,12 +503,44 @@ bool PlayFab::DataModels::FDeleteFilesResponse::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FDeleteFilesResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("ProfileVersion"))
+        {
+            reader.ReadValue(ProfileVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteFilesResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::DataModels::FFinalizeFileUploadsRequest::~FFinalizeFileUploadsRequest()
 {
 
 }
 
-void PlayFab::DataModels::FFinalizeFileUploadsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FFinalizeFileUploadsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -317,6 +570,16 @@ void PlayFab::DataModels::FFinalizeFileUploadsRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FFinalizeFileUploadsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FFinalizeFileUploadsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FFinalizeFileUploadsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -326,7 +589,7 @@ bool PlayFab::DataModels::FFinalizeFileUploadsRequest::readFromValue(const TShar
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -348,12 +611,65 @@ bool PlayFab::DataModels::FFinalizeFileUploadsRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FFinalizeFileUploadsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("FileNames"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { FileNames.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ProfileVersion"))
+        {
+            reader.ReadValue(ProfileVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FFinalizeFileUploadsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::DataModels::FGetFileMetadata::~FGetFileMetadata()
 {
 
 }
 
-void PlayFab::DataModels::FGetFileMetadata::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FGetFileMetadata::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -384,6 +700,16 @@ void PlayFab::DataModels::FGetFileMetadata::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FGetFileMetadata::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FGetFileMetadata::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FGetFileMetadata::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -424,13 +750,56 @@ bool PlayFab::DataModels::FGetFileMetadata::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FGetFileMetadata::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Checksum"))
+        {
+            reader.ReadValue(Checksum);
+        }
+        else if (reader.IsField("DownloadUrl"))
+        {
+            reader.ReadValue(DownloadUrl);
+        }
+        else if (reader.IsField("FileName"))
+        {
+            reader.ReadValue(FileName);
+        }
+        else if (reader.IsField("LastModified"))
+        {
+            reader.ReadValue(LastModified);
+        }
+        else if (reader.IsField("Size"))
+        {
+            reader.ReadValue(Size);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetFileMetadata();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::DataModels::FFinalizeFileUploadsResponse::~FFinalizeFileUploadsResponse()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::DataModels::FFinalizeFileUploadsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FFinalizeFileUploadsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -457,6 +826,16 @@ void PlayFab::DataModels::FFinalizeFileUploadsResponse::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FFinalizeFileUploadsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FFinalizeFileUploadsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FFinalizeFileUploadsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -464,7 +843,7 @@ bool PlayFab::DataModels::FFinalizeFileUploadsResponse::readFromValue(const TSha
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonObject>* MetadataObject;
@@ -472,7 +851,7 @@ bool PlayFab::DataModels::FFinalizeFileUploadsResponse::readFromValue(const TSha
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
-            Metadata.Add(It.Key(), FGetFileMetadata(It.Value()->AsObject()));
+            Metadata.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -486,12 +865,55 @@ bool PlayFab::DataModels::FFinalizeFileUploadsResponse::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FFinalizeFileUploadsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("Metadata"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { Metadata.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("ProfileVersion"))
+        {
+            reader.ReadValue(ProfileVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FFinalizeFileUploadsResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::DataModels::FGetFilesRequest::~FGetFilesRequest()
 {
 
 }
 
-void PlayFab::DataModels::FGetFilesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FGetFilesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -512,6 +934,16 @@ void PlayFab::DataModels::FGetFilesRequest::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FGetFilesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FGetFilesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FGetFilesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -521,7 +953,7 @@ bool PlayFab::DataModels::FGetFilesRequest::readFromValue(const TSharedPtr<FJson
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -534,13 +966,51 @@ bool PlayFab::DataModels::FGetFilesRequest::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FGetFilesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetFilesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::DataModels::FGetFilesResponse::~FGetFilesResponse()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::DataModels::FGetFilesResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FGetFilesResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -567,6 +1037,16 @@ void PlayFab::DataModels::FGetFilesResponse::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FGetFilesResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FGetFilesResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FGetFilesResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -574,7 +1054,7 @@ bool PlayFab::DataModels::FGetFilesResponse::readFromValue(const TSharedPtr<FJso
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonObject>* MetadataObject;
@@ -582,7 +1062,7 @@ bool PlayFab::DataModels::FGetFilesResponse::readFromValue(const TSharedPtr<FJso
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
-            Metadata.Add(It.Key(), FGetFileMetadata(It.Value()->AsObject()));
+            Metadata.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -596,12 +1076,55 @@ bool PlayFab::DataModels::FGetFilesResponse::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FGetFilesResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("Metadata"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { Metadata.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("ProfileVersion"))
+        {
+            reader.ReadValue(ProfileVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetFilesResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::DataModels::FGetObjectsRequest::~FGetObjectsRequest()
 {
 
 }
 
-void PlayFab::DataModels::FGetObjectsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FGetObjectsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -628,6 +1151,16 @@ void PlayFab::DataModels::FGetObjectsRequest::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FGetObjectsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FGetObjectsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FGetObjectsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -637,7 +1170,7 @@ bool PlayFab::DataModels::FGetObjectsRequest::readFromValue(const TSharedPtr<FJs
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -657,12 +1190,54 @@ bool PlayFab::DataModels::FGetObjectsRequest::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FGetObjectsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("EscapeObject"))
+        {
+            reader.ReadValue(EscapeObject);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetObjectsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::DataModels::FObjectResult::~FObjectResult()
 {
 
 }
 
-void PlayFab::DataModels::FObjectResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FObjectResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -687,6 +1262,16 @@ void PlayFab::DataModels::FObjectResult::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FObjectResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FObjectResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FObjectResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -714,13 +1299,48 @@ bool PlayFab::DataModels::FObjectResult::readFromValue(const TSharedPtr<FJsonObj
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FObjectResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DataObject"))
+        {
+            DataObject.readFromReader(reader);
+        }
+        else if (reader.IsField("EscapedDataObject"))
+        {
+            reader.ReadValue(EscapedDataObject);
+        }
+        else if (reader.IsField("ObjectName"))
+        {
+            reader.ReadValue(ObjectName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FObjectResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::DataModels::FGetObjectsResponse::~FGetObjectsResponse()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::DataModels::FGetObjectsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FGetObjectsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -747,6 +1367,16 @@ void PlayFab::DataModels::FGetObjectsResponse::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FGetObjectsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FGetObjectsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FGetObjectsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -754,7 +1384,7 @@ bool PlayFab::DataModels::FGetObjectsResponse::readFromValue(const TSharedPtr<FJ
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonObject>* ObjectsObject;
@@ -762,7 +1392,7 @@ bool PlayFab::DataModels::FGetObjectsResponse::readFromValue(const TSharedPtr<FJ
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*ObjectsObject)->Values); It; ++It)
         {
-            Objects.Add(It.Key(), FObjectResult(It.Value()->AsObject()));
+            Objects.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -776,12 +1406,55 @@ bool PlayFab::DataModels::FGetObjectsResponse::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FGetObjectsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("Objects"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { Objects.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("ProfileVersion"))
+        {
+            reader.ReadValue(ProfileVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetObjectsResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::DataModels::FInitiateFileUploadMetadata::~FInitiateFileUploadMetadata()
 {
 
 }
 
-void PlayFab::DataModels::FInitiateFileUploadMetadata::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FInitiateFileUploadMetadata::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -800,6 +1473,16 @@ void PlayFab::DataModels::FInitiateFileUploadMetadata::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FInitiateFileUploadMetadata::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FInitiateFileUploadMetadata::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FInitiateFileUploadMetadata::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -821,12 +1504,43 @@ bool PlayFab::DataModels::FInitiateFileUploadMetadata::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FInitiateFileUploadMetadata::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FileName"))
+        {
+            reader.ReadValue(FileName);
+        }
+        else if (reader.IsField("UploadUrl"))
+        {
+            reader.ReadValue(UploadUrl);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FInitiateFileUploadMetadata();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::DataModels::FInitiateFileUploadsRequest::~FInitiateFileUploadsRequest()
 {
 
 }
 
-void PlayFab::DataModels::FInitiateFileUploadsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FInitiateFileUploadsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -859,6 +1573,16 @@ void PlayFab::DataModels::FInitiateFileUploadsRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FInitiateFileUploadsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FInitiateFileUploadsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FInitiateFileUploadsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -868,7 +1592,7 @@ bool PlayFab::DataModels::FInitiateFileUploadsRequest::readFromValue(const TShar
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -890,13 +1614,66 @@ bool PlayFab::DataModels::FInitiateFileUploadsRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FInitiateFileUploadsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("FileNames"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { FileNames.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ProfileVersion"))
+        {
+            reader.ReadValue(ProfileVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FInitiateFileUploadsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::DataModels::FInitiateFileUploadsResponse::~FInitiateFileUploadsResponse()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::DataModels::FInitiateFileUploadsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FInitiateFileUploadsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -921,6 +1698,16 @@ void PlayFab::DataModels::FInitiateFileUploadsResponse::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FInitiateFileUploadsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FInitiateFileUploadsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FInitiateFileUploadsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -928,7 +1715,7 @@ bool PlayFab::DataModels::FInitiateFileUploadsResponse::readFromValue(const TSha
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ProfileVersionValue = obj->TryGetField(TEXT("ProfileVersion"));
@@ -942,14 +1729,57 @@ bool PlayFab::DataModels::FInitiateFileUploadsResponse::readFromValue(const TSha
     for (int32 Idx = 0; Idx < UploadDetailsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = UploadDetailsArray[Idx];
-        UploadDetails.Add(FInitiateFileUploadMetadata(CurrentItem->AsObject()));
+        UploadDetails.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
-void PlayFab::DataModels::writeOperationTypesEnumJSON(OperationTypes enumVal, JsonWriter& writer)
+bool PlayFab::DataModels::FInitiateFileUploadsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("ProfileVersion"))
+        {
+            reader.ReadValue(ProfileVersion);
+        }
+        else if (reader.IsField("UploadDetails"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { UploadDetails[UploadDetails.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FInitiateFileUploadsResponse();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeOperationTypesEnumValue(DataModels::OperationTypes enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -961,6 +1791,16 @@ void PlayFab::DataModels::writeOperationTypesEnumJSON(OperationTypes enumVal, Js
     }
 }
 
+void PlayFab::DataModels::writeOperationTypesEnumJSON(OperationTypes enumVal, JsonWriter& writer)
+{
+    writeOperationTypesEnumValue(enumVal, writer);
+}
+
+void PlayFab::DataModels::writeOperationTypesEnumJSON(OperationTypes enumVal, JsonUtf8Writer& writer)
+{
+    writeOperationTypesEnumValue(enumVal, writer);
+}
+
 DataModels::OperationTypes PlayFab::DataModels::readOperationTypesFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readOperationTypesFromValue(value.IsValid() ? value->AsString() : "");
@@ -994,7 +1834,8 @@ PlayFab::DataModels::FSetObject::~FSetObject()
 
 }
 
-void PlayFab::DataModels::FSetObject::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FSetObject::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1029,6 +1870,16 @@ void PlayFab::DataModels::FSetObject::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FSetObject::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FSetObject::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FSetObject::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1063,12 +1914,51 @@ bool PlayFab::DataModels::FSetObject::readFromValue(const TSharedPtr<FJsonObject
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FSetObject::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DataObject"))
+        {
+            DataObject.readFromReader(reader);
+        }
+        else if (reader.IsField("DeleteObject"))
+        {
+            reader.ReadValue(DeleteObject);
+        }
+        else if (reader.IsField("EscapedDataObject"))
+        {
+            reader.ReadValue(EscapedDataObject);
+        }
+        else if (reader.IsField("ObjectName"))
+        {
+            reader.ReadValue(ObjectName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetObject();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::DataModels::FSetObjectInfo::~FSetObjectInfo()
 {
 
 }
 
-void PlayFab::DataModels::FSetObjectInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FSetObjectInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1093,6 +1983,16 @@ void PlayFab::DataModels::FSetObjectInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FSetObjectInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FSetObjectInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FSetObjectInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1116,12 +2016,48 @@ bool PlayFab::DataModels::FSetObjectInfo::readFromValue(const TSharedPtr<FJsonOb
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FSetObjectInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ObjectName"))
+        {
+            reader.ReadValue(ObjectName);
+        }
+        else if (reader.IsField("OperationReason"))
+        {
+            reader.ReadValue(OperationReason);
+        }
+        else if (reader.IsField("SetResult"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { SetResult = readOperationTypesFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetObjectInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::DataModels::FSetObjectsRequest::~FSetObjectsRequest()
 {
 
 }
 
-void PlayFab::DataModels::FSetObjectsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FSetObjectsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1154,6 +2090,16 @@ void PlayFab::DataModels::FSetObjectsRequest::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FSetObjectsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FSetObjectsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FSetObjectsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1163,7 +2109,7 @@ bool PlayFab::DataModels::FSetObjectsRequest::readFromValue(const TSharedPtr<FJs
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1184,19 +2130,72 @@ bool PlayFab::DataModels::FSetObjectsRequest::readFromValue(const TSharedPtr<FJs
     for (int32 Idx = 0; Idx < ObjectsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ObjectsArray[Idx];
-        Objects.Add(FSetObject(CurrentItem->AsObject()));
+        Objects.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FSetObjectsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("ExpectedProfileVersion"))
+        {
+            reader.ReadValue(ExpectedProfileVersion);
+        }
+        else if (reader.IsField("Objects"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Objects[Objects.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetObjectsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::DataModels::FSetObjectsResponse::~FSetObjectsResponse()
 {
 
 }
 
-void PlayFab::DataModels::FSetObjectsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::DataModels::FSetObjectsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1215,6 +2214,16 @@ void PlayFab::DataModels::FSetObjectsResponse::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::DataModels::FSetObjectsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::DataModels::FSetObjectsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::DataModels::FSetObjectsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1230,10 +2239,47 @@ bool PlayFab::DataModels::FSetObjectsResponse::readFromValue(const TSharedPtr<FJ
     for (int32 Idx = 0; Idx < SetResultsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = SetResultsArray[Idx];
-        SetResults.Add(FSetObjectInfo(CurrentItem->AsObject()));
+        SetResults.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::DataModels::FSetObjectsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ProfileVersion"))
+        {
+            reader.ReadValue(ProfileVersion);
+        }
+        else if (reader.IsField("SetResults"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { SetResults[SetResults.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetObjectsResponse();
+        return false;
+    }
+    return true;
+}
+
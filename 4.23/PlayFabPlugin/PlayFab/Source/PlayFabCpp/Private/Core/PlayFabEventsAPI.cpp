@@ -30,7 +30,8 @@ FString UPlayFabEventsAPI::GetBuildIdentifier() const
 bool UPlayFabEventsAPI::WriteEvents(
     EventsModels::FWriteEventsRequest& request,
     const FWriteEventsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -38,29 +39,32 @@ bool UPlayFabEventsAPI::WriteEvents(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Event/WriteEvents"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Event/WriteEvents"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsAPI::OnWriteEventsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Low, Handle);
+}
+
+TFuture<TPlayFabResult<EventsModels::FWriteEventsResponse>> UPlayFabEventsAPI::WriteEventsAsync(EventsModels::FWriteEventsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<EventsModels::FWriteEventsResponse, FWriteEventsDelegate>([this, &request, &Handle](const FWriteEventsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabEventsAPI::WriteEvents(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabEventsAPI::OnWriteEventsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteEventsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    EventsModels::FWriteEventsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<EventsModels::FWriteEventsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](EventsModels::FWriteEventsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabEventsAPI::WriteTelemetryEvents(
     EventsModels::FWriteEventsRequest& request,
     const FWriteTelemetryEventsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -68,21 +72,23 @@ bool UPlayFabEventsAPI::WriteTelemetryEvents(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Event/WriteTelemetryEvents"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Event/WriteTelemetryEvents"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabEventsAPI::OnWriteTelemetryEventsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Low, Handle);
+}
+
+TFuture<TPlayFabResult<EventsModels::FWriteEventsResponse>> UPlayFabEventsAPI::WriteTelemetryEventsAsync(EventsModels::FWriteEventsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<EventsModels::FWriteEventsResponse, FWriteTelemetryEventsDelegate>([this, &request, &Handle](const FWriteTelemetryEventsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabEventsAPI::WriteTelemetryEvents(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabEventsAPI::OnWriteTelemetryEventsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteTelemetryEventsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    EventsModels::FWriteEventsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<EventsModels::FWriteEventsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](EventsModels::FWriteEventsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
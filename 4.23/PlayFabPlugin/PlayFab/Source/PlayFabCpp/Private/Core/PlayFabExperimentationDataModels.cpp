@@ -7,11 +7,13 @@
 
 #include "Core/PlayFabExperimentationDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
+#include "Core/PlayFabJsonPullReader.h"
 
 using namespace PlayFab;
 using namespace PlayFab::ExperimentationModels;
 
-void PlayFab::ExperimentationModels::writeAnalysisTaskStateEnumJSON(AnalysisTaskState enumVal, JsonWriter& writer)
+template <typename WriterType>
+static void writeAnalysisTaskStateEnumValue(ExperimentationModels::AnalysisTaskState enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -26,6 +28,16 @@ void PlayFab::ExperimentationModels::writeAnalysisTaskStateEnumJSON(AnalysisTask
     }
 }
 
+void PlayFab::ExperimentationModels::writeAnalysisTaskStateEnumJSON(AnalysisTaskState enumVal, JsonWriter& writer)
+{
+    writeAnalysisTaskStateEnumValue(enumVal, writer);
+}
+
+void PlayFab::ExperimentationModels::writeAnalysisTaskStateEnumJSON(AnalysisTaskState enumVal, JsonUtf8Writer& writer)
+{
+    writeAnalysisTaskStateEnumValue(enumVal, writer);
+}
+
 ExperimentationModels::AnalysisTaskState PlayFab::ExperimentationModels::readAnalysisTaskStateFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readAnalysisTaskStateFromValue(value.IsValid() ? value->AsString() : "");
@@ -62,7 +74,8 @@ PlayFab::ExperimentationModels::FCreateExclusionGroupRequest::~FCreateExclusionG
 
 }
 
-void PlayFab::ExperimentationModels::FCreateExclusionGroupRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FCreateExclusionGroupRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -96,6 +109,16 @@ void PlayFab::ExperimentationModels::FCreateExclusionGroupRequest::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FCreateExclusionGroupRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FCreateExclusionGroupRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FCreateExclusionGroupRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -105,7 +128,7 @@ bool PlayFab::ExperimentationModels::FCreateExclusionGroupRequest::readFromValue
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -126,12 +149,54 @@ bool PlayFab::ExperimentationModels::FCreateExclusionGroupRequest::readFromValue
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FCreateExclusionGroupRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateExclusionGroupRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FCreateExclusionGroupResult::~FCreateExclusionGroupResult()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FCreateExclusionGroupResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FCreateExclusionGroupResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -144,6 +209,16 @@ void PlayFab::ExperimentationModels::FCreateExclusionGroupResult::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FCreateExclusionGroupResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FCreateExclusionGroupResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FCreateExclusionGroupResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -158,7 +233,34 @@ bool PlayFab::ExperimentationModels::FCreateExclusionGroupResult::readFromValue(
     return HasSucceeded;
 }
 
-void PlayFab::ExperimentationModels::writeExperimentTypeEnumJSON(ExperimentType enumVal, JsonWriter& writer)
+bool PlayFab::ExperimentationModels::FCreateExclusionGroupResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ExclusionGroupId"))
+        {
+            reader.ReadValue(ExclusionGroupId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateExclusionGroupResult();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeExperimentTypeEnumValue(ExperimentationModels::ExperimentType enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -168,6 +270,16 @@ void PlayFab::ExperimentationModels::writeExperimentTypeEnumJSON(ExperimentType
     }
 }
 
+void PlayFab::ExperimentationModels::writeExperimentTypeEnumJSON(ExperimentType enumVal, JsonWriter& writer)
+{
+    writeExperimentTypeEnumValue(enumVal, writer);
+}
+
+void PlayFab::ExperimentationModels::writeExperimentTypeEnumJSON(ExperimentType enumVal, JsonUtf8Writer& writer)
+{
+    writeExperimentTypeEnumValue(enumVal, writer);
+}
+
 ExperimentationModels::ExperimentType PlayFab::ExperimentationModels::readExperimentTypeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readExperimentTypeFromValue(value.IsValid() ? value->AsString() : "");
@@ -199,7 +311,8 @@ PlayFab::ExperimentationModels::FVariable::~FVariable()
 
 }
 
-void PlayFab::ExperimentationModels::FVariable::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FVariable::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -222,6 +335,16 @@ void PlayFab::ExperimentationModels::FVariable::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FVariable::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FVariable::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FVariable::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -243,12 +366,43 @@ bool PlayFab::ExperimentationModels::FVariable::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FVariable::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FVariable();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FVariant::~FVariant()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FVariant::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FVariant::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -298,6 +452,16 @@ void PlayFab::ExperimentationModels::FVariant::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FVariant::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FVariant::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FVariant::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -348,19 +512,77 @@ bool PlayFab::ExperimentationModels::FVariant::readFromValue(const TSharedPtr<FJ
     for (int32 Idx = 0; Idx < VariablesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = VariablesArray[Idx];
-        Variables.Add(FVariable(CurrentItem->AsObject()));
+        Variables.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FVariant::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("IsControl"))
+        {
+            reader.ReadValue(IsControl);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("TitleDataOverrideLabel"))
+        {
+            reader.ReadValue(TitleDataOverrideLabel);
+        }
+        else if (reader.IsField("TrafficPercentage"))
+        {
+            reader.ReadValue(TrafficPercentage);
+        }
+        else if (reader.IsField("Variables"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Variables[Variables.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FVariant();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FCreateExperimentRequest::~FCreateExperimentRequest()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FCreateExperimentRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FCreateExperimentRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -442,6 +664,16 @@ void PlayFab::ExperimentationModels::FCreateExperimentRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FCreateExperimentRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FCreateExperimentRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FCreateExperimentRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -451,7 +683,7 @@ bool PlayFab::ExperimentationModels::FCreateExperimentRequest::readFromValue(con
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -508,19 +740,108 @@ bool PlayFab::ExperimentationModels::FCreateExperimentRequest::readFromValue(con
     for (int32 Idx = 0; Idx < VariantsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = VariantsArray[Idx];
-        Variants.Add(FVariant(CurrentItem->AsObject()));
+        Variants.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FCreateExperimentRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("EndDate"))
+        {
+            reader.ReadValue(EndDate);
+        }
+        else if (reader.IsField("ExclusionGroupId"))
+        {
+            reader.ReadValue(ExclusionGroupId);
+        }
+        else if (reader.IsField("ExclusionGroupTrafficAllocation"))
+        {
+            reader.ReadValue(ExclusionGroupTrafficAllocation);
+        }
+        else if (reader.IsField("ExperimentType"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfExperimentType = readExperimentTypeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("SegmentId"))
+        {
+            reader.ReadValue(SegmentId);
+        }
+        else if (reader.IsField("StartDate"))
+        {
+            reader.ReadValue(StartDate);
+        }
+        else if (reader.IsField("TitlePlayerAccountTestIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { TitlePlayerAccountTestIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Variants"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Variants[Variants.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateExperimentRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FCreateExperimentResult::~FCreateExperimentResult()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FCreateExperimentResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FCreateExperimentResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -533,6 +854,16 @@ void PlayFab::ExperimentationModels::FCreateExperimentResult::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FCreateExperimentResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FCreateExperimentResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FCreateExperimentResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -547,12 +878,39 @@ bool PlayFab::ExperimentationModels::FCreateExperimentResult::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FCreateExperimentResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ExperimentId"))
+        {
+            reader.ReadValue(ExperimentId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateExperimentResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FDeleteExclusionGroupRequest::~FDeleteExclusionGroupRequest()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FDeleteExclusionGroupRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FDeleteExclusionGroupRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -580,6 +938,16 @@ void PlayFab::ExperimentationModels::FDeleteExclusionGroupRequest::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FDeleteExclusionGroupRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FDeleteExclusionGroupRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FDeleteExclusionGroupRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -589,7 +957,7 @@ bool PlayFab::ExperimentationModels::FDeleteExclusionGroupRequest::readFromValue
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -603,12 +971,50 @@ bool PlayFab::ExperimentationModels::FDeleteExclusionGroupRequest::readFromValue
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FDeleteExclusionGroupRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ExclusionGroupId"))
+        {
+            reader.ReadValue(ExclusionGroupId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteExclusionGroupRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FDeleteExperimentRequest::~FDeleteExperimentRequest()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FDeleteExperimentRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FDeleteExperimentRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -636,6 +1042,16 @@ void PlayFab::ExperimentationModels::FDeleteExperimentRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FDeleteExperimentRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FDeleteExperimentRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FDeleteExperimentRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -645,7 +1061,7 @@ bool PlayFab::ExperimentationModels::FDeleteExperimentRequest::readFromValue(con
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -659,18 +1075,66 @@ bool PlayFab::ExperimentationModels::FDeleteExperimentRequest::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FDeleteExperimentRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ExperimentId"))
+        {
+            reader.ReadValue(ExperimentId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteExperimentRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FEmptyResponse::~FEmptyResponse()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FEmptyResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FEmptyResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FEmptyResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FEmptyResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FEmptyResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -678,12 +1142,34 @@ bool PlayFab::ExperimentationModels::FEmptyResponse::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FEmptyResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEmptyResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FEntityKey::~FEntityKey()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FEntityKey::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FEntityKey::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -706,6 +1192,16 @@ void PlayFab::ExperimentationModels::FEntityKey::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FEntityKey::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FEntityKey::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FEntityKey::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -727,16 +1223,47 @@ bool PlayFab::ExperimentationModels::FEntityKey::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
-PlayFab::ExperimentationModels::FExclusionGroupTrafficAllocation::~FExclusionGroupTrafficAllocation()
+bool PlayFab::ExperimentationModels::FEntityKey::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::ExperimentationModels::FExclusionGroupTrafficAllocation::writeJSON(JsonWriter& writer) const
-{
-    writer->WriteObjectStart();
+        if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Type"))
+        {
+            reader.ReadValue(Type);
+        }
+        else
+            reader.SkipValue();
+    }
 
-    if (ExperimentId.IsEmpty() == false)
+    if (!reader.IsValid())
+    {
+        *this = FEntityKey();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ExperimentationModels::FExclusionGroupTrafficAllocation::~FExclusionGroupTrafficAllocation()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FExclusionGroupTrafficAllocation::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
+
+    if (ExperimentId.IsEmpty() == false)
     {
         writer->WriteIdentifierPrefix(TEXT("ExperimentId"));
         writer->WriteValue(ExperimentId);
@@ -748,6 +1275,16 @@ void PlayFab::ExperimentationModels::FExclusionGroupTrafficAllocation::writeJSON
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FExclusionGroupTrafficAllocation::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FExclusionGroupTrafficAllocation::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FExclusionGroupTrafficAllocation::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -769,7 +1306,38 @@ bool PlayFab::ExperimentationModels::FExclusionGroupTrafficAllocation::readFromV
     return HasSucceeded;
 }
 
-void PlayFab::ExperimentationModels::writeExperimentStateEnumJSON(ExperimentState enumVal, JsonWriter& writer)
+bool PlayFab::ExperimentationModels::FExclusionGroupTrafficAllocation::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ExperimentId"))
+        {
+            reader.ReadValue(ExperimentId);
+        }
+        else if (reader.IsField("TrafficAllocation"))
+        {
+            reader.ReadValue(TrafficAllocation);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FExclusionGroupTrafficAllocation();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeExperimentStateEnumValue(ExperimentationModels::ExperimentState enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -781,6 +1349,16 @@ void PlayFab::ExperimentationModels::writeExperimentStateEnumJSON(ExperimentStat
     }
 }
 
+void PlayFab::ExperimentationModels::writeExperimentStateEnumJSON(ExperimentState enumVal, JsonWriter& writer)
+{
+    writeExperimentStateEnumValue(enumVal, writer);
+}
+
+void PlayFab::ExperimentationModels::writeExperimentStateEnumJSON(ExperimentState enumVal, JsonUtf8Writer& writer)
+{
+    writeExperimentStateEnumValue(enumVal, writer);
+}
+
 ExperimentationModels::ExperimentState PlayFab::ExperimentationModels::readExperimentStateFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readExperimentStateFromValue(value.IsValid() ? value->AsString() : "");
@@ -814,7 +1392,8 @@ PlayFab::ExperimentationModels::FExperiment::~FExperiment()
 
 }
 
-void PlayFab::ExperimentationModels::FExperiment::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FExperiment::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -896,6 +1475,16 @@ void PlayFab::ExperimentationModels::FExperiment::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FExperiment::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FExperiment::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FExperiment::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -962,19 +1551,106 @@ bool PlayFab::ExperimentationModels::FExperiment::readFromValue(const TSharedPtr
     for (int32 Idx = 0; Idx < VariantsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = VariantsArray[Idx];
-        Variants.Add(FVariant(CurrentItem->AsObject()));
+        Variants.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FExperiment::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("EndDate"))
+        {
+            reader.ReadValue(EndDate);
+        }
+        else if (reader.IsField("ExclusionGroupId"))
+        {
+            reader.ReadValue(ExclusionGroupId);
+        }
+        else if (reader.IsField("ExclusionGroupTrafficAllocation"))
+        {
+            reader.ReadValue(ExclusionGroupTrafficAllocation);
+        }
+        else if (reader.IsField("ExperimentType"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfExperimentType = readExperimentTypeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("SegmentId"))
+        {
+            reader.ReadValue(SegmentId);
+        }
+        else if (reader.IsField("StartDate"))
+        {
+            reader.ReadValue(StartDate);
+        }
+        else if (reader.IsField("State"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { State = readExperimentStateFromValue(TmpValue); }
+        }
+        else if (reader.IsField("TitlePlayerAccountTestIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { TitlePlayerAccountTestIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Variants"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Variants[Variants.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FExperiment();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FExperimentExclusionGroup::~FExperimentExclusionGroup()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FExperimentExclusionGroup::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FExperimentExclusionGroup::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -999,6 +1675,16 @@ void PlayFab::ExperimentationModels::FExperimentExclusionGroup::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FExperimentExclusionGroup::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FExperimentExclusionGroup::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FExperimentExclusionGroup::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1027,12 +1713,47 @@ bool PlayFab::ExperimentationModels::FExperimentExclusionGroup::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FExperimentExclusionGroup::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("ExclusionGroupId"))
+        {
+            reader.ReadValue(ExclusionGroupId);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FExperimentExclusionGroup();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FGetExclusionGroupsRequest::~FGetExclusionGroupsRequest()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FGetExclusionGroupsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FGetExclusionGroupsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1050,6 +1771,16 @@ void PlayFab::ExperimentationModels::FGetExclusionGroupsRequest::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FGetExclusionGroupsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FGetExclusionGroupsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FGetExclusionGroupsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1059,19 +1790,53 @@ bool PlayFab::ExperimentationModels::FGetExclusionGroupsRequest::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FGetExclusionGroupsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetExclusionGroupsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FGetExclusionGroupsResult::~FGetExclusionGroupsResult()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FGetExclusionGroupsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FGetExclusionGroupsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1087,6 +1852,16 @@ void PlayFab::ExperimentationModels::FGetExclusionGroupsResult::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FGetExclusionGroupsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FGetExclusionGroupsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FGetExclusionGroupsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1095,19 +1870,53 @@ bool PlayFab::ExperimentationModels::FGetExclusionGroupsResult::readFromValue(co
     for (int32 Idx = 0; Idx < ExclusionGroupsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ExclusionGroupsArray[Idx];
-        ExclusionGroups.Add(FExperimentExclusionGroup(CurrentItem->AsObject()));
+        ExclusionGroups.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FGetExclusionGroupsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ExclusionGroups"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ExclusionGroups[ExclusionGroups.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetExclusionGroupsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FGetExclusionGroupTrafficRequest::~FGetExclusionGroupTrafficRequest()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FGetExclusionGroupTrafficRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FGetExclusionGroupTrafficRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1135,6 +1944,16 @@ void PlayFab::ExperimentationModels::FGetExclusionGroupTrafficRequest::writeJSON
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FGetExclusionGroupTrafficRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FGetExclusionGroupTrafficRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FGetExclusionGroupTrafficRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1144,7 +1963,7 @@ bool PlayFab::ExperimentationModels::FGetExclusionGroupTrafficRequest::readFromV
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1158,12 +1977,50 @@ bool PlayFab::ExperimentationModels::FGetExclusionGroupTrafficRequest::readFromV
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FGetExclusionGroupTrafficRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ExclusionGroupId"))
+        {
+            reader.ReadValue(ExclusionGroupId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetExclusionGroupTrafficRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FGetExclusionGroupTrafficResult::~FGetExclusionGroupTrafficResult()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FGetExclusionGroupTrafficResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FGetExclusionGroupTrafficResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1179,6 +2036,16 @@ void PlayFab::ExperimentationModels::FGetExclusionGroupTrafficResult::writeJSON(
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FGetExclusionGroupTrafficResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FGetExclusionGroupTrafficResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FGetExclusionGroupTrafficResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1187,19 +2054,53 @@ bool PlayFab::ExperimentationModels::FGetExclusionGroupTrafficResult::readFromVa
     for (int32 Idx = 0; Idx < TrafficAllocationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = TrafficAllocationsArray[Idx];
-        TrafficAllocations.Add(FExclusionGroupTrafficAllocation(CurrentItem->AsObject()));
+        TrafficAllocations.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FGetExclusionGroupTrafficResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TrafficAllocations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { TrafficAllocations[TrafficAllocations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetExclusionGroupTrafficResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FGetExperimentsRequest::~FGetExperimentsRequest()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FGetExperimentsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FGetExperimentsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1217,6 +2118,16 @@ void PlayFab::ExperimentationModels::FGetExperimentsRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FGetExperimentsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FGetExperimentsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FGetExperimentsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1226,19 +2137,53 @@ bool PlayFab::ExperimentationModels::FGetExperimentsRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FGetExperimentsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetExperimentsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FGetExperimentsResult::~FGetExperimentsResult()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FGetExperimentsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FGetExperimentsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1254,6 +2199,16 @@ void PlayFab::ExperimentationModels::FGetExperimentsResult::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FGetExperimentsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FGetExperimentsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FGetExperimentsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1262,19 +2217,53 @@ bool PlayFab::ExperimentationModels::FGetExperimentsResult::readFromValue(const
     for (int32 Idx = 0; Idx < ExperimentsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ExperimentsArray[Idx];
-        Experiments.Add(FExperiment(CurrentItem->AsObject()));
+        Experiments.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FGetExperimentsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Experiments"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Experiments[Experiments.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetExperimentsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FGetLatestScorecardRequest::~FGetLatestScorecardRequest()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FGetLatestScorecardRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FGetLatestScorecardRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1298,6 +2287,16 @@ void PlayFab::ExperimentationModels::FGetLatestScorecardRequest::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FGetLatestScorecardRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FGetLatestScorecardRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FGetLatestScorecardRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1307,7 +2306,7 @@ bool PlayFab::ExperimentationModels::FGetLatestScorecardRequest::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1321,12 +2320,50 @@ bool PlayFab::ExperimentationModels::FGetLatestScorecardRequest::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FGetLatestScorecardRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ExperimentId"))
+        {
+            reader.ReadValue(ExperimentId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLatestScorecardRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FMetricData::~FMetricData()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FMetricData::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FMetricData::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1384,6 +2421,16 @@ void PlayFab::ExperimentationModels::FMetricData::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FMetricData::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FMetricData::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FMetricData::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1482,12 +2529,87 @@ bool PlayFab::ExperimentationModels::FMetricData::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FMetricData::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ConfidenceIntervalEnd"))
+        {
+            reader.ReadValue(ConfidenceIntervalEnd);
+        }
+        else if (reader.IsField("ConfidenceIntervalStart"))
+        {
+            reader.ReadValue(ConfidenceIntervalStart);
+        }
+        else if (reader.IsField("DeltaAbsoluteChange"))
+        {
+            reader.ReadValue(DeltaAbsoluteChange);
+        }
+        else if (reader.IsField("DeltaRelativeChange"))
+        {
+            reader.ReadValue(DeltaRelativeChange);
+        }
+        else if (reader.IsField("InternalName"))
+        {
+            reader.ReadValue(InternalName);
+        }
+        else if (reader.IsField("Movement"))
+        {
+            reader.ReadValue(Movement);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("PMove"))
+        {
+            reader.ReadValue(PMove);
+        }
+        else if (reader.IsField("PValue"))
+        {
+            reader.ReadValue(PValue);
+        }
+        else if (reader.IsField("PValueThreshold"))
+        {
+            reader.ReadValue(PValueThreshold);
+        }
+        else if (reader.IsField("StatSigLevel"))
+        {
+            reader.ReadValue(StatSigLevel);
+        }
+        else if (reader.IsField("StdDev"))
+        {
+            reader.ReadValue(StdDev);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FMetricData();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FScorecardDataRow::~FScorecardDataRow()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FScorecardDataRow::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FScorecardDataRow::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1517,6 +2639,16 @@ void PlayFab::ExperimentationModels::FScorecardDataRow::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FScorecardDataRow::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FScorecardDataRow::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FScorecardDataRow::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1533,7 +2665,7 @@ bool PlayFab::ExperimentationModels::FScorecardDataRow::readFromValue(const TSha
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetricDataRowsObject)->Values); It; ++It)
         {
-            MetricDataRows.Add(It.Key(), FMetricData(It.Value()->AsObject()));
+            MetricDataRows.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -1554,12 +2686,58 @@ bool PlayFab::ExperimentationModels::FScorecardDataRow::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FScorecardDataRow::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("IsControl"))
+        {
+            reader.ReadValue(IsControl);
+        }
+        else if (reader.IsField("MetricDataRows"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { MetricDataRows.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayerCount"))
+        {
+            reader.ReadValue(PlayerCount);
+        }
+        else if (reader.IsField("VariantName"))
+        {
+            reader.ReadValue(VariantName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FScorecardDataRow();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FScorecard::~FScorecard()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FScorecard::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FScorecard::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1611,6 +2789,16 @@ void PlayFab::ExperimentationModels::FScorecard::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FScorecard::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FScorecard::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FScorecard::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1663,20 +2851,83 @@ bool PlayFab::ExperimentationModels::FScorecard::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < ScorecardDataRowsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ScorecardDataRowsArray[Idx];
-        ScorecardDataRows.Add(FScorecardDataRow(CurrentItem->AsObject()));
+        ScorecardDataRows.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FScorecard::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DateGenerated"))
+        {
+            reader.ReadValue(DateGenerated);
+        }
+        else if (reader.IsField("Duration"))
+        {
+            reader.ReadValue(Duration);
+        }
+        else if (reader.IsField("EventsProcessed"))
+        {
+            reader.ReadValue(EventsProcessed);
+        }
+        else if (reader.IsField("ExperimentId"))
+        {
+            reader.ReadValue(ExperimentId);
+        }
+        else if (reader.IsField("ExperimentName"))
+        {
+            reader.ReadValue(ExperimentName);
+        }
+        else if (reader.IsField("LatestJobStatus"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { LatestJobStatus = readAnalysisTaskStateFromValue(TmpValue); }
+        }
+        else if (reader.IsField("SampleRatioMismatch"))
+        {
+            reader.ReadValue(SampleRatioMismatch);
+        }
+        else if (reader.IsField("ScorecardDataRows"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ScorecardDataRows[ScorecardDataRows.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FScorecard();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FGetLatestScorecardResult::~FGetLatestScorecardResult()
 {
     //if (Scorecard != nullptr) delete Scorecard;
 
 }
 
-void PlayFab::ExperimentationModels::FGetLatestScorecardResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FGetLatestScorecardResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1689,6 +2940,16 @@ void PlayFab::ExperimentationModels::FGetLatestScorecardResult::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FGetLatestScorecardResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FGetLatestScorecardResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FGetLatestScorecardResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1696,19 +2957,47 @@ bool PlayFab::ExperimentationModels::FGetLatestScorecardResult::readFromValue(co
     const TSharedPtr<FJsonValue> ScorecardValue = obj->TryGetField(TEXT("Scorecard"));
     if (ScorecardValue.IsValid() && !ScorecardValue->IsNull())
     {
-        pfScorecard = MakeShareable(new FScorecard(ScorecardValue->AsObject()));
+        pfScorecard = MakeShared<FScorecard>(ScorecardValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FGetLatestScorecardResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Scorecard"))
+        {
+            pfScorecard = MakeShared<FScorecard>();
+            pfScorecard->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetLatestScorecardResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FGetTreatmentAssignmentRequest::~FGetTreatmentAssignmentRequest()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::ExperimentationModels::FGetTreatmentAssignmentRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FGetTreatmentAssignmentRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1732,6 +3021,16 @@ void PlayFab::ExperimentationModels::FGetTreatmentAssignmentRequest::writeJSON(J
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FGetTreatmentAssignmentRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FGetTreatmentAssignmentRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FGetTreatmentAssignmentRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1741,25 +3040,64 @@ bool PlayFab::ExperimentationModels::FGetTreatmentAssignmentRequest::readFromVal
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FGetTreatmentAssignmentRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTreatmentAssignmentRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FTreatmentAssignment::~FTreatmentAssignment()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FTreatmentAssignment::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FTreatmentAssignment::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1784,6 +3122,16 @@ void PlayFab::ExperimentationModels::FTreatmentAssignment::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FTreatmentAssignment::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FTreatmentAssignment::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FTreatmentAssignment::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1792,7 +3140,7 @@ bool PlayFab::ExperimentationModels::FTreatmentAssignment::readFromValue(const T
     for (int32 Idx = 0; Idx < VariablesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = VariablesArray[Idx];
-        Variables.Add(FVariable(CurrentItem->AsObject()));
+        Variables.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -1801,13 +3149,58 @@ bool PlayFab::ExperimentationModels::FTreatmentAssignment::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FTreatmentAssignment::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Variables"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Variables[Variables.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Variants"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Variants.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FTreatmentAssignment();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FGetTreatmentAssignmentResult::~FGetTreatmentAssignmentResult()
 {
     //if (TreatmentAssignment != nullptr) delete TreatmentAssignment;
 
 }
 
-void PlayFab::ExperimentationModels::FGetTreatmentAssignmentResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FGetTreatmentAssignmentResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1820,6 +3213,16 @@ void PlayFab::ExperimentationModels::FGetTreatmentAssignmentResult::writeJSON(Js
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FGetTreatmentAssignmentResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FGetTreatmentAssignmentResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FGetTreatmentAssignmentResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1827,18 +3230,46 @@ bool PlayFab::ExperimentationModels::FGetTreatmentAssignmentResult::readFromValu
     const TSharedPtr<FJsonValue> TreatmentAssignmentValue = obj->TryGetField(TEXT("TreatmentAssignment"));
     if (TreatmentAssignmentValue.IsValid() && !TreatmentAssignmentValue->IsNull())
     {
-        pfTreatmentAssignment = MakeShareable(new FTreatmentAssignment(TreatmentAssignmentValue->AsObject()));
+        pfTreatmentAssignment = MakeShared<FTreatmentAssignment>(TreatmentAssignmentValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FGetTreatmentAssignmentResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TreatmentAssignment"))
+        {
+            pfTreatmentAssignment = MakeShared<FTreatmentAssignment>();
+            pfTreatmentAssignment->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTreatmentAssignmentResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FStartExperimentRequest::~FStartExperimentRequest()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FStartExperimentRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FStartExperimentRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1866,6 +3297,16 @@ void PlayFab::ExperimentationModels::FStartExperimentRequest::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FStartExperimentRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FStartExperimentRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FStartExperimentRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1875,7 +3316,7 @@ bool PlayFab::ExperimentationModels::FStartExperimentRequest::readFromValue(cons
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1889,12 +3330,50 @@ bool PlayFab::ExperimentationModels::FStartExperimentRequest::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FStartExperimentRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ExperimentId"))
+        {
+            reader.ReadValue(ExperimentId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStartExperimentRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FStopExperimentRequest::~FStopExperimentRequest()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FStopExperimentRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FStopExperimentRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1922,6 +3401,16 @@ void PlayFab::ExperimentationModels::FStopExperimentRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FStopExperimentRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FStopExperimentRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FStopExperimentRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1931,7 +3420,7 @@ bool PlayFab::ExperimentationModels::FStopExperimentRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1945,12 +3434,50 @@ bool PlayFab::ExperimentationModels::FStopExperimentRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FStopExperimentRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ExperimentId"))
+        {
+            reader.ReadValue(ExperimentId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStopExperimentRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FUpdateExclusionGroupRequest::~FUpdateExclusionGroupRequest()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FUpdateExclusionGroupRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FUpdateExclusionGroupRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1994,6 +3521,16 @@ void PlayFab::ExperimentationModels::FUpdateExclusionGroupRequest::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FUpdateExclusionGroupRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FUpdateExclusionGroupRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FUpdateExclusionGroupRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2003,7 +3540,7 @@ bool PlayFab::ExperimentationModels::FUpdateExclusionGroupRequest::readFromValue
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2031,12 +3568,58 @@ bool PlayFab::ExperimentationModels::FUpdateExclusionGroupRequest::readFromValue
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FUpdateExclusionGroupRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("ExclusionGroupId"))
+        {
+            reader.ReadValue(ExclusionGroupId);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateExclusionGroupRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ExperimentationModels::FUpdateExperimentRequest::~FUpdateExperimentRequest()
 {
 
 }
 
-void PlayFab::ExperimentationModels::FUpdateExperimentRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ExperimentationModels::FUpdateExperimentRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2128,6 +3711,16 @@ void PlayFab::ExperimentationModels::FUpdateExperimentRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ExperimentationModels::FUpdateExperimentRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ExperimentationModels::FUpdateExperimentRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ExperimentationModels::FUpdateExperimentRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2137,7 +3730,7 @@ bool PlayFab::ExperimentationModels::FUpdateExperimentRequest::readFromValue(con
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2201,10 +3794,102 @@ bool PlayFab::ExperimentationModels::FUpdateExperimentRequest::readFromValue(con
     for (int32 Idx = 0; Idx < VariantsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = VariantsArray[Idx];
-        Variants.Add(FVariant(CurrentItem->AsObject()));
+        Variants.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ExperimentationModels::FUpdateExperimentRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("EndDate"))
+        {
+            reader.ReadValue(EndDate);
+        }
+        else if (reader.IsField("ExclusionGroupId"))
+        {
+            reader.ReadValue(ExclusionGroupId);
+        }
+        else if (reader.IsField("ExclusionGroupTrafficAllocation"))
+        {
+            reader.ReadValue(ExclusionGroupTrafficAllocation);
+        }
+        else if (reader.IsField("ExperimentType"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfExperimentType = readExperimentTypeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("SegmentId"))
+        {
+            reader.ReadValue(SegmentId);
+        }
+        else if (reader.IsField("StartDate"))
+        {
+            reader.ReadValue(StartDate);
+        }
+        else if (reader.IsField("TitlePlayerAccountTestIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { TitlePlayerAccountTestIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Variants"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Variants[Variants.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateExperimentRequest();
+        return false;
+    }
+    return true;
+}
+
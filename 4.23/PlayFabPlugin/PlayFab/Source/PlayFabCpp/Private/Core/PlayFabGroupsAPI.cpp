@@ -30,7 +30,8 @@ FString UPlayFabGroupsAPI::GetBuildIdentifier() const
 bool UPlayFabGroupsAPI::AcceptGroupApplication(
     GroupsModels::FAcceptGroupApplicationRequest& request,
     const FAcceptGroupApplicationDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -38,29 +39,32 @@ bool UPlayFabGroupsAPI::AcceptGroupApplication(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/AcceptGroupApplication"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/AcceptGroupApplication"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnAcceptGroupApplicationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsAPI::AcceptGroupApplicationAsync(GroupsModels::FAcceptGroupApplicationRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FAcceptGroupApplicationDelegate>([this, &request, &Handle](const FAcceptGroupApplicationDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::AcceptGroupApplication(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnAcceptGroupApplicationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAcceptGroupApplicationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::AcceptGroupInvitation(
     GroupsModels::FAcceptGroupInvitationRequest& request,
     const FAcceptGroupInvitationDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -68,29 +72,32 @@ bool UPlayFabGroupsAPI::AcceptGroupInvitation(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/AcceptGroupInvitation"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/AcceptGroupInvitation"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnAcceptGroupInvitationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsAPI::AcceptGroupInvitationAsync(GroupsModels::FAcceptGroupInvitationRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FAcceptGroupInvitationDelegate>([this, &request, &Handle](const FAcceptGroupInvitationDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::AcceptGroupInvitation(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnAcceptGroupInvitationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAcceptGroupInvitationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::AddMembers(
     GroupsModels::FAddMembersRequest& request,
     const FAddMembersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -98,29 +105,32 @@ bool UPlayFabGroupsAPI::AddMembers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/AddMembers"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/AddMembers"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnAddMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsAPI::AddMembersAsync(GroupsModels::FAddMembersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FAddMembersDelegate>([this, &request, &Handle](const FAddMembersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::AddMembers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnAddMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::ApplyToGroup(
     GroupsModels::FApplyToGroupRequest& request,
     const FApplyToGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -128,29 +138,32 @@ bool UPlayFabGroupsAPI::ApplyToGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ApplyToGroup"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ApplyToGroup"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnApplyToGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FApplyToGroupResponse>> UPlayFabGroupsAPI::ApplyToGroupAsync(GroupsModels::FApplyToGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FApplyToGroupResponse, FApplyToGroupDelegate>([this, &request, &Handle](const FApplyToGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::ApplyToGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnApplyToGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FApplyToGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FApplyToGroupResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FApplyToGroupResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FApplyToGroupResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::BlockEntity(
     GroupsModels::FBlockEntityRequest& request,
     const FBlockEntityDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -158,29 +171,32 @@ bool UPlayFabGroupsAPI::BlockEntity(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/BlockEntity"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/BlockEntity"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnBlockEntityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsAPI::BlockEntityAsync(GroupsModels::FBlockEntityRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FBlockEntityDelegate>([this, &request, &Handle](const FBlockEntityDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::BlockEntity(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnBlockEntityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FBlockEntityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::ChangeMemberRole(
     GroupsModels::FChangeMemberRoleRequest& request,
     const FChangeMemberRoleDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -188,29 +204,32 @@ bool UPlayFabGroupsAPI::ChangeMemberRole(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ChangeMemberRole"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ChangeMemberRole"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnChangeMemberRoleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsAPI::ChangeMemberRoleAsync(GroupsModels::FChangeMemberRoleRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FChangeMemberRoleDelegate>([this, &request, &Handle](const FChangeMemberRoleDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::ChangeMemberRole(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnChangeMemberRoleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FChangeMemberRoleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::CreateGroup(
     GroupsModels::FCreateGroupRequest& request,
     const FCreateGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -218,29 +237,32 @@ bool UPlayFabGroupsAPI::CreateGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/CreateGroup"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/CreateGroup"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnCreateGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FCreateGroupResponse>> UPlayFabGroupsAPI::CreateGroupAsync(GroupsModels::FCreateGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FCreateGroupResponse, FCreateGroupDelegate>([this, &request, &Handle](const FCreateGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::CreateGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnCreateGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FCreateGroupResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FCreateGroupResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FCreateGroupResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::CreateRole(
     GroupsModels::FCreateGroupRoleRequest& request,
     const FCreateRoleDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -248,29 +270,32 @@ bool UPlayFabGroupsAPI::CreateRole(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/CreateRole"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/CreateRole"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnCreateRoleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FCreateGroupRoleResponse>> UPlayFabGroupsAPI::CreateRoleAsync(GroupsModels::FCreateGroupRoleRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FCreateGroupRoleResponse, FCreateRoleDelegate>([this, &request, &Handle](const FCreateRoleDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::CreateRole(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnCreateRoleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateRoleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FCreateGroupRoleResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FCreateGroupRoleResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FCreateGroupRoleResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::DeleteGroup(
     GroupsModels::FDeleteGroupRequest& request,
     const FDeleteGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -278,29 +303,32 @@ bool UPlayFabGroupsAPI::DeleteGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/DeleteGroup"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/DeleteGroup"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnDeleteGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsAPI::DeleteGroupAsync(GroupsModels::FDeleteGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FDeleteGroupDelegate>([this, &request, &Handle](const FDeleteGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::DeleteGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnDeleteGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::DeleteRole(
     GroupsModels::FDeleteRoleRequest& request,
     const FDeleteRoleDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -308,29 +336,32 @@ bool UPlayFabGroupsAPI::DeleteRole(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/DeleteRole"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/DeleteRole"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnDeleteRoleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsAPI::DeleteRoleAsync(GroupsModels::FDeleteRoleRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FDeleteRoleDelegate>([this, &request, &Handle](const FDeleteRoleDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::DeleteRole(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnDeleteRoleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteRoleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::GetGroup(
     GroupsModels::FGetGroupRequest& request,
     const FGetGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -338,29 +369,32 @@ bool UPlayFabGroupsAPI::GetGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/GetGroup"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/GetGroup"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnGetGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FGetGroupResponse>> UPlayFabGroupsAPI::GetGroupAsync(GroupsModels::FGetGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FGetGroupResponse, FGetGroupDelegate>([this, &request, &Handle](const FGetGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::GetGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnGetGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FGetGroupResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FGetGroupResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FGetGroupResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::InviteToGroup(
     GroupsModels::FInviteToGroupRequest& request,
     const FInviteToGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -368,29 +402,32 @@ bool UPlayFabGroupsAPI::InviteToGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/InviteToGroup"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/InviteToGroup"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnInviteToGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FInviteToGroupResponse>> UPlayFabGroupsAPI::InviteToGroupAsync(GroupsModels::FInviteToGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FInviteToGroupResponse, FInviteToGroupDelegate>([this, &request, &Handle](const FInviteToGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::InviteToGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnInviteToGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FInviteToGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FInviteToGroupResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FInviteToGroupResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FInviteToGroupResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::IsMember(
     GroupsModels::FIsMemberRequest& request,
     const FIsMemberDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -398,29 +435,32 @@ bool UPlayFabGroupsAPI::IsMember(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/IsMember"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/IsMember"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnIsMemberResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FIsMemberResponse>> UPlayFabGroupsAPI::IsMemberAsync(GroupsModels::FIsMemberRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FIsMemberResponse, FIsMemberDelegate>([this, &request, &Handle](const FIsMemberDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::IsMember(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnIsMemberResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FIsMemberDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FIsMemberResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FIsMemberResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FIsMemberResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::ListGroupApplications(
     GroupsModels::FListGroupApplicationsRequest& request,
     const FListGroupApplicationsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -428,29 +468,32 @@ bool UPlayFabGroupsAPI::ListGroupApplications(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ListGroupApplications"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ListGroupApplications"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnListGroupApplicationsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FListGroupApplicationsResponse>> UPlayFabGroupsAPI::ListGroupApplicationsAsync(GroupsModels::FListGroupApplicationsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FListGroupApplicationsResponse, FListGroupApplicationsDelegate>([this, &request, &Handle](const FListGroupApplicationsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::ListGroupApplications(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnListGroupApplicationsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListGroupApplicationsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FListGroupApplicationsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FListGroupApplicationsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FListGroupApplicationsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::ListGroupBlocks(
     GroupsModels::FListGroupBlocksRequest& request,
     const FListGroupBlocksDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -458,29 +501,32 @@ bool UPlayFabGroupsAPI::ListGroupBlocks(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ListGroupBlocks"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ListGroupBlocks"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnListGroupBlocksResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FListGroupBlocksResponse>> UPlayFabGroupsAPI::ListGroupBlocksAsync(GroupsModels::FListGroupBlocksRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FListGroupBlocksResponse, FListGroupBlocksDelegate>([this, &request, &Handle](const FListGroupBlocksDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::ListGroupBlocks(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnListGroupBlocksResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListGroupBlocksDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FListGroupBlocksResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FListGroupBlocksResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FListGroupBlocksResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::ListGroupInvitations(
     GroupsModels::FListGroupInvitationsRequest& request,
     const FListGroupInvitationsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -488,29 +534,32 @@ bool UPlayFabGroupsAPI::ListGroupInvitations(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ListGroupInvitations"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ListGroupInvitations"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnListGroupInvitationsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FListGroupInvitationsResponse>> UPlayFabGroupsAPI::ListGroupInvitationsAsync(GroupsModels::FListGroupInvitationsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FListGroupInvitationsResponse, FListGroupInvitationsDelegate>([this, &request, &Handle](const FListGroupInvitationsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::ListGroupInvitations(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnListGroupInvitationsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListGroupInvitationsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FListGroupInvitationsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FListGroupInvitationsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FListGroupInvitationsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::ListGroupMembers(
     GroupsModels::FListGroupMembersRequest& request,
     const FListGroupMembersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -518,29 +567,32 @@ bool UPlayFabGroupsAPI::ListGroupMembers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ListGroupMembers"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ListGroupMembers"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnListGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FListGroupMembersResponse>> UPlayFabGroupsAPI::ListGroupMembersAsync(GroupsModels::FListGroupMembersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FListGroupMembersResponse, FListGroupMembersDelegate>([this, &request, &Handle](const FListGroupMembersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::ListGroupMembers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnListGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FListGroupMembersResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FListGroupMembersResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FListGroupMembersResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::ListMembership(
     GroupsModels::FListMembershipRequest& request,
     const FListMembershipDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -548,29 +600,32 @@ bool UPlayFabGroupsAPI::ListMembership(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ListMembership"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ListMembership"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnListMembershipResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FListMembershipResponse>> UPlayFabGroupsAPI::ListMembershipAsync(GroupsModels::FListMembershipRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FListMembershipResponse, FListMembershipDelegate>([this, &request, &Handle](const FListMembershipDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::ListMembership(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnListMembershipResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListMembershipDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FListMembershipResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FListMembershipResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FListMembershipResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::ListMembershipOpportunities(
     GroupsModels::FListMembershipOpportunitiesRequest& request,
     const FListMembershipOpportunitiesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -578,29 +633,32 @@ bool UPlayFabGroupsAPI::ListMembershipOpportunities(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ListMembershipOpportunities"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/ListMembershipOpportunities"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnListMembershipOpportunitiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FListMembershipOpportunitiesResponse>> UPlayFabGroupsAPI::ListMembershipOpportunitiesAsync(GroupsModels::FListMembershipOpportunitiesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FListMembershipOpportunitiesResponse, FListMembershipOpportunitiesDelegate>([this, &request, &Handle](const FListMembershipOpportunitiesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::ListMembershipOpportunities(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnListMembershipOpportunitiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListMembershipOpportunitiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FListMembershipOpportunitiesResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FListMembershipOpportunitiesResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FListMembershipOpportunitiesResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::RemoveGroupApplication(
     GroupsModels::FRemoveGroupApplicationRequest& request,
     const FRemoveGroupApplicationDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -608,29 +666,32 @@ bool UPlayFabGroupsAPI::RemoveGroupApplication(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/RemoveGroupApplication"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/RemoveGroupApplication"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnRemoveGroupApplicationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsAPI::RemoveGroupApplicationAsync(GroupsModels::FRemoveGroupApplicationRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FRemoveGroupApplicationDelegate>([this, &request, &Handle](const FRemoveGroupApplicationDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::RemoveGroupApplication(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnRemoveGroupApplicationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveGroupApplicationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::RemoveGroupInvitation(
     GroupsModels::FRemoveGroupInvitationRequest& request,
     const FRemoveGroupInvitationDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -638,29 +699,32 @@ bool UPlayFabGroupsAPI::RemoveGroupInvitation(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/RemoveGroupInvitation"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/RemoveGroupInvitation"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnRemoveGroupInvitationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsAPI::RemoveGroupInvitationAsync(GroupsModels::FRemoveGroupInvitationRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FRemoveGroupInvitationDelegate>([this, &request, &Handle](const FRemoveGroupInvitationDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::RemoveGroupInvitation(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnRemoveGroupInvitationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveGroupInvitationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::RemoveMembers(
     GroupsModels::FRemoveMembersRequest& request,
     const FRemoveMembersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -668,29 +732,32 @@ bool UPlayFabGroupsAPI::RemoveMembers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/RemoveMembers"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/RemoveMembers"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnRemoveMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsAPI::RemoveMembersAsync(GroupsModels::FRemoveMembersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FRemoveMembersDelegate>([this, &request, &Handle](const FRemoveMembersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::RemoveMembers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnRemoveMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::UnblockEntity(
     GroupsModels::FUnblockEntityRequest& request,
     const FUnblockEntityDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -698,29 +765,32 @@ bool UPlayFabGroupsAPI::UnblockEntity(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/UnblockEntity"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/UnblockEntity"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnUnblockEntityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsAPI::UnblockEntityAsync(GroupsModels::FUnblockEntityRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FUnblockEntityDelegate>([this, &request, &Handle](const FUnblockEntityDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::UnblockEntity(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnUnblockEntityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnblockEntityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::UpdateGroup(
     GroupsModels::FUpdateGroupRequest& request,
     const FUpdateGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -728,29 +798,32 @@ bool UPlayFabGroupsAPI::UpdateGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/UpdateGroup"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/UpdateGroup"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnUpdateGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FUpdateGroupResponse>> UPlayFabGroupsAPI::UpdateGroupAsync(GroupsModels::FUpdateGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FUpdateGroupResponse, FUpdateGroupDelegate>([this, &request, &Handle](const FUpdateGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::UpdateGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnUpdateGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FUpdateGroupResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FUpdateGroupResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FUpdateGroupResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsAPI::UpdateRole(
     GroupsModels::FUpdateGroupRoleRequest& request,
     const FUpdateRoleDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -758,21 +831,23 @@ bool UPlayFabGroupsAPI::UpdateRole(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/UpdateRole"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Group/UpdateRole"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsAPI::OnUpdateRoleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FUpdateGroupRoleResponse>> UPlayFabGroupsAPI::UpdateRoleAsync(GroupsModels::FUpdateGroupRoleRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FUpdateGroupRoleResponse, FUpdateRoleDelegate>([this, &request, &Handle](const FUpdateRoleDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsAPI::UpdateRole(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsAPI::OnUpdateRoleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateRoleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FUpdateGroupRoleResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FUpdateGroupRoleResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FUpdateGroupRoleResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
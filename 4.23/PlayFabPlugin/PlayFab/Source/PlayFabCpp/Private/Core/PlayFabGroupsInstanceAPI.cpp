@@ -80,7 +80,8 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabGroupsInstanceAPI::GetOrCreate
 bool UPlayFabGroupsInstanceAPI::AcceptGroupApplication(
     GroupsModels::FAcceptGroupApplicationRequest& request,
     const FAcceptGroupApplicationDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -88,29 +89,32 @@ bool UPlayFabGroupsInstanceAPI::AcceptGroupApplication(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/AcceptGroupApplication"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnAcceptGroupApplicationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/AcceptGroupApplication"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnAcceptGroupApplicationResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsInstanceAPI::AcceptGroupApplicationAsync(GroupsModels::FAcceptGroupApplicationRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FAcceptGroupApplicationDelegate>([this, &request, &Handle](const FAcceptGroupApplicationDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::AcceptGroupApplication(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnAcceptGroupApplicationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAcceptGroupApplicationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::AcceptGroupInvitation(
     GroupsModels::FAcceptGroupInvitationRequest& request,
     const FAcceptGroupInvitationDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -118,29 +122,32 @@ bool UPlayFabGroupsInstanceAPI::AcceptGroupInvitation(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/AcceptGroupInvitation"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnAcceptGroupInvitationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/AcceptGroupInvitation"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnAcceptGroupInvitationResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsInstanceAPI::AcceptGroupInvitationAsync(GroupsModels::FAcceptGroupInvitationRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FAcceptGroupInvitationDelegate>([this, &request, &Handle](const FAcceptGroupInvitationDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::AcceptGroupInvitation(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnAcceptGroupInvitationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAcceptGroupInvitationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::AddMembers(
     GroupsModels::FAddMembersRequest& request,
     const FAddMembersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -148,29 +155,32 @@ bool UPlayFabGroupsInstanceAPI::AddMembers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/AddMembers"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnAddMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/AddMembers"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnAddMembersResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsInstanceAPI::AddMembersAsync(GroupsModels::FAddMembersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FAddMembersDelegate>([this, &request, &Handle](const FAddMembersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::AddMembers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnAddMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::ApplyToGroup(
     GroupsModels::FApplyToGroupRequest& request,
     const FApplyToGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -178,29 +188,32 @@ bool UPlayFabGroupsInstanceAPI::ApplyToGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ApplyToGroup"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnApplyToGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ApplyToGroup"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnApplyToGroupResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FApplyToGroupResponse>> UPlayFabGroupsInstanceAPI::ApplyToGroupAsync(GroupsModels::FApplyToGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FApplyToGroupResponse, FApplyToGroupDelegate>([this, &request, &Handle](const FApplyToGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::ApplyToGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnApplyToGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FApplyToGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FApplyToGroupResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FApplyToGroupResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FApplyToGroupResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::BlockEntity(
     GroupsModels::FBlockEntityRequest& request,
     const FBlockEntityDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -208,29 +221,32 @@ bool UPlayFabGroupsInstanceAPI::BlockEntity(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/BlockEntity"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnBlockEntityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/BlockEntity"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnBlockEntityResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsInstanceAPI::BlockEntityAsync(GroupsModels::FBlockEntityRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FBlockEntityDelegate>([this, &request, &Handle](const FBlockEntityDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::BlockEntity(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnBlockEntityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FBlockEntityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::ChangeMemberRole(
     GroupsModels::FChangeMemberRoleRequest& request,
     const FChangeMemberRoleDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -238,29 +254,32 @@ bool UPlayFabGroupsInstanceAPI::ChangeMemberRole(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ChangeMemberRole"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnChangeMemberRoleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ChangeMemberRole"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnChangeMemberRoleResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsInstanceAPI::ChangeMemberRoleAsync(GroupsModels::FChangeMemberRoleRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FChangeMemberRoleDelegate>([this, &request, &Handle](const FChangeMemberRoleDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::ChangeMemberRole(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnChangeMemberRoleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FChangeMemberRoleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::CreateGroup(
     GroupsModels::FCreateGroupRequest& request,
     const FCreateGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -268,29 +287,32 @@ bool UPlayFabGroupsInstanceAPI::CreateGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/CreateGroup"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnCreateGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/CreateGroup"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnCreateGroupResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FCreateGroupResponse>> UPlayFabGroupsInstanceAPI::CreateGroupAsync(GroupsModels::FCreateGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FCreateGroupResponse, FCreateGroupDelegate>([this, &request, &Handle](const FCreateGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::CreateGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnCreateGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FCreateGroupResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FCreateGroupResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FCreateGroupResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::CreateRole(
     GroupsModels::FCreateGroupRoleRequest& request,
     const FCreateRoleDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -298,29 +320,32 @@ bool UPlayFabGroupsInstanceAPI::CreateRole(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/CreateRole"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnCreateRoleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/CreateRole"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnCreateRoleResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FCreateGroupRoleResponse>> UPlayFabGroupsInstanceAPI::CreateRoleAsync(GroupsModels::FCreateGroupRoleRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FCreateGroupRoleResponse, FCreateRoleDelegate>([this, &request, &Handle](const FCreateRoleDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::CreateRole(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnCreateRoleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateRoleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FCreateGroupRoleResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FCreateGroupRoleResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FCreateGroupRoleResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::DeleteGroup(
     GroupsModels::FDeleteGroupRequest& request,
     const FDeleteGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -328,29 +353,32 @@ bool UPlayFabGroupsInstanceAPI::DeleteGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/DeleteGroup"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnDeleteGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/DeleteGroup"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnDeleteGroupResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsInstanceAPI::DeleteGroupAsync(GroupsModels::FDeleteGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FDeleteGroupDelegate>([this, &request, &Handle](const FDeleteGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::DeleteGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnDeleteGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::DeleteRole(
     GroupsModels::FDeleteRoleRequest& request,
     const FDeleteRoleDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -358,29 +386,32 @@ bool UPlayFabGroupsInstanceAPI::DeleteRole(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/DeleteRole"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnDeleteRoleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/DeleteRole"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnDeleteRoleResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsInstanceAPI::DeleteRoleAsync(GroupsModels::FDeleteRoleRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FDeleteRoleDelegate>([this, &request, &Handle](const FDeleteRoleDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::DeleteRole(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnDeleteRoleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteRoleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::GetGroup(
     GroupsModels::FGetGroupRequest& request,
     const FGetGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -388,29 +419,32 @@ bool UPlayFabGroupsInstanceAPI::GetGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/GetGroup"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnGetGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/GetGroup"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnGetGroupResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FGetGroupResponse>> UPlayFabGroupsInstanceAPI::GetGroupAsync(GroupsModels::FGetGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FGetGroupResponse, FGetGroupDelegate>([this, &request, &Handle](const FGetGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::GetGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnGetGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FGetGroupResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FGetGroupResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FGetGroupResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::InviteToGroup(
     GroupsModels::FInviteToGroupRequest& request,
     const FInviteToGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -418,29 +452,32 @@ bool UPlayFabGroupsInstanceAPI::InviteToGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/InviteToGroup"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnInviteToGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/InviteToGroup"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnInviteToGroupResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FInviteToGroupResponse>> UPlayFabGroupsInstanceAPI::InviteToGroupAsync(GroupsModels::FInviteToGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FInviteToGroupResponse, FInviteToGroupDelegate>([this, &request, &Handle](const FInviteToGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::InviteToGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnInviteToGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FInviteToGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FInviteToGroupResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FInviteToGroupResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FInviteToGroupResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::IsMember(
     GroupsModels::FIsMemberRequest& request,
     const FIsMemberDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -448,29 +485,32 @@ bool UPlayFabGroupsInstanceAPI::IsMember(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/IsMember"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnIsMemberResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/IsMember"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnIsMemberResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FIsMemberResponse>> UPlayFabGroupsInstanceAPI::IsMemberAsync(GroupsModels::FIsMemberRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FIsMemberResponse, FIsMemberDelegate>([this, &request, &Handle](const FIsMemberDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::IsMember(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnIsMemberResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FIsMemberDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FIsMemberResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FIsMemberResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FIsMemberResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::ListGroupApplications(
     GroupsModels::FListGroupApplicationsRequest& request,
     const FListGroupApplicationsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -478,29 +518,32 @@ bool UPlayFabGroupsInstanceAPI::ListGroupApplications(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ListGroupApplications"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnListGroupApplicationsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ListGroupApplications"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnListGroupApplicationsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FListGroupApplicationsResponse>> UPlayFabGroupsInstanceAPI::ListGroupApplicationsAsync(GroupsModels::FListGroupApplicationsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FListGroupApplicationsResponse, FListGroupApplicationsDelegate>([this, &request, &Handle](const FListGroupApplicationsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::ListGroupApplications(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnListGroupApplicationsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListGroupApplicationsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FListGroupApplicationsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FListGroupApplicationsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FListGroupApplicationsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::ListGroupBlocks(
     GroupsModels::FListGroupBlocksRequest& request,
     const FListGroupBlocksDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -508,29 +551,32 @@ bool UPlayFabGroupsInstanceAPI::ListGroupBlocks(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ListGroupBlocks"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnListGroupBlocksResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ListGroupBlocks"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnListGroupBlocksResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FListGroupBlocksResponse>> UPlayFabGroupsInstanceAPI::ListGroupBlocksAsync(GroupsModels::FListGroupBlocksRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FListGroupBlocksResponse, FListGroupBlocksDelegate>([this, &request, &Handle](const FListGroupBlocksDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::ListGroupBlocks(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnListGroupBlocksResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListGroupBlocksDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FListGroupBlocksResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FListGroupBlocksResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FListGroupBlocksResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::ListGroupInvitations(
     GroupsModels::FListGroupInvitationsRequest& request,
     const FListGroupInvitationsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -538,29 +584,32 @@ bool UPlayFabGroupsInstanceAPI::ListGroupInvitations(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ListGroupInvitations"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnListGroupInvitationsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ListGroupInvitations"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnListGroupInvitationsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FListGroupInvitationsResponse>> UPlayFabGroupsInstanceAPI::ListGroupInvitationsAsync(GroupsModels::FListGroupInvitationsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FListGroupInvitationsResponse, FListGroupInvitationsDelegate>([this, &request, &Handle](const FListGroupInvitationsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::ListGroupInvitations(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnListGroupInvitationsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListGroupInvitationsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FListGroupInvitationsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FListGroupInvitationsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FListGroupInvitationsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::ListGroupMembers(
     GroupsModels::FListGroupMembersRequest& request,
     const FListGroupMembersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -568,29 +617,32 @@ bool UPlayFabGroupsInstanceAPI::ListGroupMembers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ListGroupMembers"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnListGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ListGroupMembers"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnListGroupMembersResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FListGroupMembersResponse>> UPlayFabGroupsInstanceAPI::ListGroupMembersAsync(GroupsModels::FListGroupMembersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FListGroupMembersResponse, FListGroupMembersDelegate>([this, &request, &Handle](const FListGroupMembersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::ListGroupMembers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnListGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FListGroupMembersResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FListGroupMembersResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FListGroupMembersResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::ListMembership(
     GroupsModels::FListMembershipRequest& request,
     const FListMembershipDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -598,29 +650,32 @@ bool UPlayFabGroupsInstanceAPI::ListMembership(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ListMembership"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnListMembershipResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ListMembership"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnListMembershipResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FListMembershipResponse>> UPlayFabGroupsInstanceAPI::ListMembershipAsync(GroupsModels::FListMembershipRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FListMembershipResponse, FListMembershipDelegate>([this, &request, &Handle](const FListMembershipDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::ListMembership(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnListMembershipResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListMembershipDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FListMembershipResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FListMembershipResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FListMembershipResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::ListMembershipOpportunities(
     GroupsModels::FListMembershipOpportunitiesRequest& request,
     const FListMembershipOpportunitiesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -628,29 +683,32 @@ bool UPlayFabGroupsInstanceAPI::ListMembershipOpportunities(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ListMembershipOpportunities"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnListMembershipOpportunitiesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/ListMembershipOpportunities"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnListMembershipOpportunitiesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FListMembershipOpportunitiesResponse>> UPlayFabGroupsInstanceAPI::ListMembershipOpportunitiesAsync(GroupsModels::FListMembershipOpportunitiesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FListMembershipOpportunitiesResponse, FListMembershipOpportunitiesDelegate>([this, &request, &Handle](const FListMembershipOpportunitiesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::ListMembershipOpportunities(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnListMembershipOpportunitiesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListMembershipOpportunitiesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FListMembershipOpportunitiesResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FListMembershipOpportunitiesResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FListMembershipOpportunitiesResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::RemoveGroupApplication(
     GroupsModels::FRemoveGroupApplicationRequest& request,
     const FRemoveGroupApplicationDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -658,29 +716,32 @@ bool UPlayFabGroupsInstanceAPI::RemoveGroupApplication(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/RemoveGroupApplication"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnRemoveGroupApplicationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/RemoveGroupApplication"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnRemoveGroupApplicationResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsInstanceAPI::RemoveGroupApplicationAsync(GroupsModels::FRemoveGroupApplicationRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FRemoveGroupApplicationDelegate>([this, &request, &Handle](const FRemoveGroupApplicationDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::RemoveGroupApplication(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnRemoveGroupApplicationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveGroupApplicationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::RemoveGroupInvitation(
     GroupsModels::FRemoveGroupInvitationRequest& request,
     const FRemoveGroupInvitationDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -688,29 +749,32 @@ bool UPlayFabGroupsInstanceAPI::RemoveGroupInvitation(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/RemoveGroupInvitation"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnRemoveGroupInvitationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/RemoveGroupInvitation"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnRemoveGroupInvitationResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsInstanceAPI::RemoveGroupInvitationAsync(GroupsModels::FRemoveGroupInvitationRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FRemoveGroupInvitationDelegate>([this, &request, &Handle](const FRemoveGroupInvitationDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::RemoveGroupInvitation(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnRemoveGroupInvitationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveGroupInvitationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::RemoveMembers(
     GroupsModels::FRemoveMembersRequest& request,
     const FRemoveMembersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -718,29 +782,32 @@ bool UPlayFabGroupsInstanceAPI::RemoveMembers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/RemoveMembers"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnRemoveMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/RemoveMembers"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnRemoveMembersResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsInstanceAPI::RemoveMembersAsync(GroupsModels::FRemoveMembersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FRemoveMembersDelegate>([this, &request, &Handle](const FRemoveMembersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::RemoveMembers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnRemoveMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::UnblockEntity(
     GroupsModels::FUnblockEntityRequest& request,
     const FUnblockEntityDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -748,29 +815,32 @@ bool UPlayFabGroupsInstanceAPI::UnblockEntity(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/UnblockEntity"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnUnblockEntityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/UnblockEntity"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnUnblockEntityResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FEmptyResponse>> UPlayFabGroupsInstanceAPI::UnblockEntityAsync(GroupsModels::FUnblockEntityRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FEmptyResponse, FUnblockEntityDelegate>([this, &request, &Handle](const FUnblockEntityDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::UnblockEntity(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnUnblockEntityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnblockEntityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::UpdateGroup(
     GroupsModels::FUpdateGroupRequest& request,
     const FUpdateGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -778,29 +848,32 @@ bool UPlayFabGroupsInstanceAPI::UpdateGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/UpdateGroup"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnUpdateGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/UpdateGroup"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnUpdateGroupResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FUpdateGroupResponse>> UPlayFabGroupsInstanceAPI::UpdateGroupAsync(GroupsModels::FUpdateGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FUpdateGroupResponse, FUpdateGroupDelegate>([this, &request, &Handle](const FUpdateGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::UpdateGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnUpdateGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FUpdateGroupResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FUpdateGroupResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FUpdateGroupResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabGroupsInstanceAPI::UpdateRole(
     GroupsModels::FUpdateGroupRoleRequest& request,
     const FUpdateRoleDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -808,21 +881,23 @@ bool UPlayFabGroupsInstanceAPI::UpdateRole(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/UpdateRole"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabGroupsInstanceAPI::OnUpdateRoleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Group/UpdateRole"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabGroupsInstanceAPI::OnUpdateRoleResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<GroupsModels::FUpdateGroupRoleResponse>> UPlayFabGroupsInstanceAPI::UpdateRoleAsync(GroupsModels::FUpdateGroupRoleRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<GroupsModels::FUpdateGroupRoleResponse, FUpdateRoleDelegate>([this, &request, &Handle](const FUpdateRoleDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabGroupsInstanceAPI::UpdateRole(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabGroupsInstanceAPI::OnUpdateRoleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateRoleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    GroupsModels::FUpdateGroupRoleResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<GroupsModels::FUpdateGroupRoleResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](GroupsModels::FUpdateGroupRoleResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
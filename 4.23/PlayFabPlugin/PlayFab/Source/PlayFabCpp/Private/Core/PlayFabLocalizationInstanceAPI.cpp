@@ -80,7 +80,8 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabLocalizationInstanceAPI::GetOr
 bool UPlayFabLocalizationInstanceAPI::GetLanguageList(
     LocalizationModels::FGetLanguageListRequest& request,
     const FGetLanguageListDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -88,21 +89,23 @@ bool UPlayFabLocalizationInstanceAPI::GetLanguageList(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Locale/GetLanguageList"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabLocalizationInstanceAPI::OnGetLanguageListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Locale/GetLanguageList"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabLocalizationInstanceAPI::OnGetLanguageListResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<LocalizationModels::FGetLanguageListResponse>> UPlayFabLocalizationInstanceAPI::GetLanguageListAsync(LocalizationModels::FGetLanguageListRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<LocalizationModels::FGetLanguageListResponse, FGetLanguageListDelegate>([this, &request, &Handle](const FGetLanguageListDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabLocalizationInstanceAPI::GetLanguageList(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabLocalizationInstanceAPI::OnGetLanguageListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLanguageListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    LocalizationModels::FGetLanguageListResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<LocalizationModels::FGetLanguageListResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](LocalizationModels::FGetLanguageListResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
@@ -80,7 +80,8 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabMultiplayerInstanceAPI::GetOrC
 bool UPlayFabMultiplayerInstanceAPI::CancelAllMatchmakingTicketsForPlayer(
     MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerRequest& request,
     const FCancelAllMatchmakingTicketsForPlayerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -88,29 +89,32 @@ bool UPlayFabMultiplayerInstanceAPI::CancelAllMatchmakingTicketsForPlayer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CancelAllMatchmakingTicketsForPlayer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCancelAllMatchmakingTicketsForPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CancelAllMatchmakingTicketsForPlayer"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnCancelAllMatchmakingTicketsForPlayerResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerResult>> UPlayFabMultiplayerInstanceAPI::CancelAllMatchmakingTicketsForPlayerAsync(MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerResult, FCancelAllMatchmakingTicketsForPlayerDelegate>([this, &request, &Handle](const FCancelAllMatchmakingTicketsForPlayerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::CancelAllMatchmakingTicketsForPlayer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCancelAllMatchmakingTicketsForPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCancelAllMatchmakingTicketsForPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::CancelAllServerBackfillTicketsForPlayer(
     MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerRequest& request,
     const FCancelAllServerBackfillTicketsForPlayerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -118,29 +122,32 @@ bool UPlayFabMultiplayerInstanceAPI::CancelAllServerBackfillTicketsForPlayer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CancelAllServerBackfillTicketsForPlayer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCancelAllServerBackfillTicketsForPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CancelAllServerBackfillTicketsForPlayer"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnCancelAllServerBackfillTicketsForPlayerResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerResult>> UPlayFabMultiplayerInstanceAPI::CancelAllServerBackfillTicketsForPlayerAsync(MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerResult, FCancelAllServerBackfillTicketsForPlayerDelegate>([this, &request, &Handle](const FCancelAllServerBackfillTicketsForPlayerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::CancelAllServerBackfillTicketsForPlayer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCancelAllServerBackfillTicketsForPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCancelAllServerBackfillTicketsForPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::CancelMatchmakingTicket(
     MultiplayerModels::FCancelMatchmakingTicketRequest& request,
     const FCancelMatchmakingTicketDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -148,29 +155,32 @@ bool UPlayFabMultiplayerInstanceAPI::CancelMatchmakingTicket(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CancelMatchmakingTicket"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCancelMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CancelMatchmakingTicket"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnCancelMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FCancelMatchmakingTicketResult>> UPlayFabMultiplayerInstanceAPI::CancelMatchmakingTicketAsync(MultiplayerModels::FCancelMatchmakingTicketRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FCancelMatchmakingTicketResult, FCancelMatchmakingTicketDelegate>([this, &request, &Handle](const FCancelMatchmakingTicketDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::CancelMatchmakingTicket(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCancelMatchmakingTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCancelMatchmakingTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FCancelMatchmakingTicketResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FCancelMatchmakingTicketResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FCancelMatchmakingTicketResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::CancelServerBackfillTicket(
     MultiplayerModels::FCancelServerBackfillTicketRequest& request,
     const FCancelServerBackfillTicketDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -178,29 +188,32 @@ bool UPlayFabMultiplayerInstanceAPI::CancelServerBackfillTicket(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CancelServerBackfillTicket"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCancelServerBackfillTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CancelServerBackfillTicket"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnCancelServerBackfillTicketResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FCancelServerBackfillTicketResult>> UPlayFabMultiplayerInstanceAPI::CancelServerBackfillTicketAsync(MultiplayerModels::FCancelServerBackfillTicketRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FCancelServerBackfillTicketResult, FCancelServerBackfillTicketDelegate>([this, &request, &Handle](const FCancelServerBackfillTicketDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::CancelServerBackfillTicket(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCancelServerBackfillTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCancelServerBackfillTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FCancelServerBackfillTicketResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FCancelServerBackfillTicketResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FCancelServerBackfillTicketResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::CreateBuildAlias(
     MultiplayerModels::FCreateBuildAliasRequest& request,
     const FCreateBuildAliasDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -208,29 +221,32 @@ bool UPlayFabMultiplayerInstanceAPI::CreateBuildAlias(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/CreateBuildAlias"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateBuildAliasResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/CreateBuildAlias"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnCreateBuildAliasResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FBuildAliasDetailsResponse>> UPlayFabMultiplayerInstanceAPI::CreateBuildAliasAsync(MultiplayerModels::FCreateBuildAliasRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FBuildAliasDetailsResponse, FCreateBuildAliasDelegate>([this, &request, &Handle](const FCreateBuildAliasDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::CreateBuildAlias(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateBuildAliasResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateBuildAliasDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FBuildAliasDetailsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FBuildAliasDetailsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FBuildAliasDetailsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::CreateBuildWithCustomContainer(
     MultiplayerModels::FCreateBuildWithCustomContainerRequest& request,
     const FCreateBuildWithCustomContainerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -238,29 +254,32 @@ bool UPlayFabMultiplayerInstanceAPI::CreateBuildWithCustomContainer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/CreateBuildWithCustomContainer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateBuildWithCustomContainerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/CreateBuildWithCustomContainer"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnCreateBuildWithCustomContainerResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FCreateBuildWithCustomContainerResponse>> UPlayFabMultiplayerInstanceAPI::CreateBuildWithCustomContainerAsync(MultiplayerModels::FCreateBuildWithCustomContainerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FCreateBuildWithCustomContainerResponse, FCreateBuildWithCustomContainerDelegate>([this, &request, &Handle](const FCreateBuildWithCustomContainerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::CreateBuildWithCustomContainer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateBuildWithCustomContainerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateBuildWithCustomContainerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FCreateBuildWithCustomContainerResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FCreateBuildWithCustomContainerResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FCreateBuildWithCustomContainerResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::CreateBuildWithManagedContainer(
     MultiplayerModels::FCreateBuildWithManagedContainerRequest& request,
     const FCreateBuildWithManagedContainerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -268,29 +287,32 @@ bool UPlayFabMultiplayerInstanceAPI::CreateBuildWithManagedContainer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/CreateBuildWithManagedContainer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateBuildWithManagedContainerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/CreateBuildWithManagedContainer"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnCreateBuildWithManagedContainerResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FCreateBuildWithManagedContainerResponse>> UPlayFabMultiplayerInstanceAPI::CreateBuildWithManagedContainerAsync(MultiplayerModels::FCreateBuildWithManagedContainerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FCreateBuildWithManagedContainerResponse, FCreateBuildWithManagedContainerDelegate>([this, &request, &Handle](const FCreateBuildWithManagedContainerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::CreateBuildWithManagedContainer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateBuildWithManagedContainerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateBuildWithManagedContainerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FCreateBuildWithManagedContainerResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FCreateBuildWithManagedContainerResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FCreateBuildWithManagedContainerResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::CreateBuildWithProcessBasedServer(
     MultiplayerModels::FCreateBuildWithProcessBasedServerRequest& request,
     const FCreateBuildWithProcessBasedServerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -298,29 +320,32 @@ bool UPlayFabMultiplayerInstanceAPI::CreateBuildWithProcessBasedServer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/CreateBuildWithProcessBasedServer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateBuildWithProcessBasedServerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/CreateBuildWithProcessBasedServer"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnCreateBuildWithProcessBasedServerResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FCreateBuildWithProcessBasedServerResponse>> UPlayFabMultiplayerInstanceAPI::CreateBuildWithProcessBasedServerAsync(MultiplayerModels::FCreateBuildWithProcessBasedServerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FCreateBuildWithProcessBasedServerResponse, FCreateBuildWithProcessBasedServerDelegate>([this, &request, &Handle](const FCreateBuildWithProcessBasedServerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::CreateBuildWithProcessBasedServer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateBuildWithProcessBasedServerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateBuildWithProcessBasedServerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FCreateBuildWithProcessBasedServerResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FCreateBuildWithProcessBasedServerResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FCreateBuildWithProcessBasedServerResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::CreateMatchmakingTicket(
     MultiplayerModels::FCreateMatchmakingTicketRequest& request,
     const FCreateMatchmakingTicketDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -328,29 +353,32 @@ bool UPlayFabMultiplayerInstanceAPI::CreateMatchmakingTicket(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CreateMatchmakingTicket"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CreateMatchmakingTicket"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnCreateMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FCreateMatchmakingTicketResult>> UPlayFabMultiplayerInstanceAPI::CreateMatchmakingTicketAsync(MultiplayerModels::FCreateMatchmakingTicketRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FCreateMatchmakingTicketResult, FCreateMatchmakingTicketDelegate>([this, &request, &Handle](const FCreateMatchmakingTicketDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::CreateMatchmakingTicket(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateMatchmakingTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateMatchmakingTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FCreateMatchmakingTicketResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FCreateMatchmakingTicketResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FCreateMatchmakingTicketResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::CreateRemoteUser(
     MultiplayerModels::FCreateRemoteUserRequest& request,
     const FCreateRemoteUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -358,29 +386,32 @@ bool UPlayFabMultiplayerInstanceAPI::CreateRemoteUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/CreateRemoteUser"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateRemoteUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/CreateRemoteUser"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnCreateRemoteUserResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FCreateRemoteUserResponse>> UPlayFabMultiplayerInstanceAPI::CreateRemoteUserAsync(MultiplayerModels::FCreateRemoteUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FCreateRemoteUserResponse, FCreateRemoteUserDelegate>([this, &request, &Handle](const FCreateRemoteUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::CreateRemoteUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateRemoteUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateRemoteUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FCreateRemoteUserResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FCreateRemoteUserResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FCreateRemoteUserResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::CreateServerBackfillTicket(
     MultiplayerModels::FCreateServerBackfillTicketRequest& request,
     const FCreateServerBackfillTicketDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -388,29 +419,32 @@ bool UPlayFabMultiplayerInstanceAPI::CreateServerBackfillTicket(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CreateServerBackfillTicket"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateServerBackfillTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CreateServerBackfillTicket"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnCreateServerBackfillTicketResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FCreateServerBackfillTicketResult>> UPlayFabMultiplayerInstanceAPI::CreateServerBackfillTicketAsync(MultiplayerModels::FCreateServerBackfillTicketRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FCreateServerBackfillTicketResult, FCreateServerBackfillTicketDelegate>([this, &request, &Handle](const FCreateServerBackfillTicketDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::CreateServerBackfillTicket(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateServerBackfillTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateServerBackfillTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FCreateServerBackfillTicketResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FCreateServerBackfillTicketResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FCreateServerBackfillTicketResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::CreateServerMatchmakingTicket(
     MultiplayerModels::FCreateServerMatchmakingTicketRequest& request,
     const FCreateServerMatchmakingTicketDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -418,29 +452,32 @@ bool UPlayFabMultiplayerInstanceAPI::CreateServerMatchmakingTicket(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CreateServerMatchmakingTicket"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateServerMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/CreateServerMatchmakingTicket"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnCreateServerMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FCreateMatchmakingTicketResult>> UPlayFabMultiplayerInstanceAPI::CreateServerMatchmakingTicketAsync(MultiplayerModels::FCreateServerMatchmakingTicketRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FCreateMatchmakingTicketResult, FCreateServerMatchmakingTicketDelegate>([this, &request, &Handle](const FCreateServerMatchmakingTicketDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::CreateServerMatchmakingTicket(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateServerMatchmakingTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateServerMatchmakingTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FCreateMatchmakingTicketResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FCreateMatchmakingTicketResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FCreateMatchmakingTicketResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::CreateTitleMultiplayerServersQuotaChange(
     MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeRequest& request,
     const FCreateTitleMultiplayerServersQuotaChangeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -448,29 +485,32 @@ bool UPlayFabMultiplayerInstanceAPI::CreateTitleMultiplayerServersQuotaChange(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/CreateTitleMultiplayerServersQuotaChange"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnCreateTitleMultiplayerServersQuotaChangeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/CreateTitleMultiplayerServersQuotaChange"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnCreateTitleMultiplayerServersQuotaChangeResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeResponse>> UPlayFabMultiplayerInstanceAPI::CreateTitleMultiplayerServersQuotaChangeAsync(MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeResponse, FCreateTitleMultiplayerServersQuotaChangeDelegate>([this, &request, &Handle](const FCreateTitleMultiplayerServersQuotaChangeDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::CreateTitleMultiplayerServersQuotaChange(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnCreateTitleMultiplayerServersQuotaChangeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateTitleMultiplayerServersQuotaChangeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::DeleteAsset(
     MultiplayerModels::FDeleteAssetRequest& request,
     const FDeleteAssetDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -478,29 +518,32 @@ bool UPlayFabMultiplayerInstanceAPI::DeleteAsset(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteAsset"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnDeleteAssetResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteAsset"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnDeleteAssetResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FEmptyResponse>> UPlayFabMultiplayerInstanceAPI::DeleteAssetAsync(MultiplayerModels::FDeleteAssetRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FEmptyResponse, FDeleteAssetDelegate>([this, &request, &Handle](const FDeleteAssetDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::DeleteAsset(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnDeleteAssetResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteAssetDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::DeleteBuild(
     MultiplayerModels::FDeleteBuildRequest& request,
     const FDeleteBuildDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -508,29 +551,32 @@ bool UPlayFabMultiplayerInstanceAPI::DeleteBuild(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteBuild"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnDeleteBuildResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteBuild"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnDeleteBuildResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FEmptyResponse>> UPlayFabMultiplayerInstanceAPI::DeleteBuildAsync(MultiplayerModels::FDeleteBuildRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FEmptyResponse, FDeleteBuildDelegate>([this, &request, &Handle](const FDeleteBuildDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::DeleteBuild(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnDeleteBuildResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteBuildDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::DeleteBuildAlias(
     MultiplayerModels::FDeleteBuildAliasRequest& request,
     const FDeleteBuildAliasDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -538,29 +584,32 @@ bool UPlayFabMultiplayerInstanceAPI::DeleteBuildAlias(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteBuildAlias"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnDeleteBuildAliasResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteBuildAlias"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnDeleteBuildAliasResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FEmptyResponse>> UPlayFabMultiplayerInstanceAPI::DeleteBuildAliasAsync(MultiplayerModels::FDeleteBuildAliasRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FEmptyResponse, FDeleteBuildAliasDelegate>([this, &request, &Handle](const FDeleteBuildAliasDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::DeleteBuildAlias(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnDeleteBuildAliasResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteBuildAliasDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::DeleteBuildRegion(
     MultiplayerModels::FDeleteBuildRegionRequest& request,
     const FDeleteBuildRegionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -568,29 +617,32 @@ bool UPlayFabMultiplayerInstanceAPI::DeleteBuildRegion(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteBuildRegion"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnDeleteBuildRegionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteBuildRegion"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnDeleteBuildRegionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FEmptyResponse>> UPlayFabMultiplayerInstanceAPI::DeleteBuildRegionAsync(MultiplayerModels::FDeleteBuildRegionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FEmptyResponse, FDeleteBuildRegionDelegate>([this, &request, &Handle](const FDeleteBuildRegionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::DeleteBuildRegion(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnDeleteBuildRegionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteBuildRegionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::DeleteCertificate(
     MultiplayerModels::FDeleteCertificateRequest& request,
     const FDeleteCertificateDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -598,29 +650,32 @@ bool UPlayFabMultiplayerInstanceAPI::DeleteCertificate(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteCertificate"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnDeleteCertificateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteCertificate"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnDeleteCertificateResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FEmptyResponse>> UPlayFabMultiplayerInstanceAPI::DeleteCertificateAsync(MultiplayerModels::FDeleteCertificateRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FEmptyResponse, FDeleteCertificateDelegate>([this, &request, &Handle](const FDeleteCertificateDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::DeleteCertificate(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnDeleteCertificateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteCertificateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::DeleteContainerImageRepository(
     MultiplayerModels::FDeleteContainerImageRequest& request,
     const FDeleteContainerImageRepositoryDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -628,29 +683,32 @@ bool UPlayFabMultiplayerInstanceAPI::DeleteContainerImageRepository(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteContainerImageRepository"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnDeleteContainerImageRepositoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteContainerImageRepository"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnDeleteContainerImageRepositoryResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FEmptyResponse>> UPlayFabMultiplayerInstanceAPI::DeleteContainerImageRepositoryAsync(MultiplayerModels::FDeleteContainerImageRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FEmptyResponse, FDeleteContainerImageRepositoryDelegate>([this, &request, &Handle](const FDeleteContainerImageRepositoryDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::DeleteContainerImageRepository(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnDeleteContainerImageRepositoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteContainerImageRepositoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::DeleteRemoteUser(
     MultiplayerModels::FDeleteRemoteUserRequest& request,
     const FDeleteRemoteUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -658,29 +716,32 @@ bool UPlayFabMultiplayerInstanceAPI::DeleteRemoteUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteRemoteUser"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnDeleteRemoteUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/DeleteRemoteUser"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnDeleteRemoteUserResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FEmptyResponse>> UPlayFabMultiplayerInstanceAPI::DeleteRemoteUserAsync(MultiplayerModels::FDeleteRemoteUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FEmptyResponse, FDeleteRemoteUserDelegate>([this, &request, &Handle](const FDeleteRemoteUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::DeleteRemoteUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnDeleteRemoteUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteRemoteUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::EnableMultiplayerServersForTitle(
     MultiplayerModels::FEnableMultiplayerServersForTitleRequest& request,
     const FEnableMultiplayerServersForTitleDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -688,29 +749,32 @@ bool UPlayFabMultiplayerInstanceAPI::EnableMultiplayerServersForTitle(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/EnableMultiplayerServersForTitle"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnEnableMultiplayerServersForTitleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/EnableMultiplayerServersForTitle"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnEnableMultiplayerServersForTitleResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FEnableMultiplayerServersForTitleResponse>> UPlayFabMultiplayerInstanceAPI::EnableMultiplayerServersForTitleAsync(MultiplayerModels::FEnableMultiplayerServersForTitleRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FEnableMultiplayerServersForTitleResponse, FEnableMultiplayerServersForTitleDelegate>([this, &request, &Handle](const FEnableMultiplayerServersForTitleDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::EnableMultiplayerServersForTitle(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnEnableMultiplayerServersForTitleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FEnableMultiplayerServersForTitleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FEnableMultiplayerServersForTitleResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FEnableMultiplayerServersForTitleResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FEnableMultiplayerServersForTitleResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::GetAssetUploadUrl(
     MultiplayerModels::FGetAssetUploadUrlRequest& request,
     const FGetAssetUploadUrlDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -718,29 +782,32 @@ bool UPlayFabMultiplayerInstanceAPI::GetAssetUploadUrl(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetAssetUploadUrl"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetAssetUploadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetAssetUploadUrl"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnGetAssetUploadUrlResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FGetAssetUploadUrlResponse>> UPlayFabMultiplayerInstanceAPI::GetAssetUploadUrlAsync(MultiplayerModels::FGetAssetUploadUrlRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FGetAssetUploadUrlResponse, FGetAssetUploadUrlDelegate>([this, &request, &Handle](const FGetAssetUploadUrlDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::GetAssetUploadUrl(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetAssetUploadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAssetUploadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FGetAssetUploadUrlResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FGetAssetUploadUrlResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FGetAssetUploadUrlResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::GetBuild(
     MultiplayerModels::FGetBuildRequest& request,
     const FGetBuildDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -748,29 +815,32 @@ bool UPlayFabMultiplayerInstanceAPI::GetBuild(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetBuild"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetBuildResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetBuild"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnGetBuildResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FGetBuildResponse>> UPlayFabMultiplayerInstanceAPI::GetBuildAsync(MultiplayerModels::FGetBuildRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FGetBuildResponse, FGetBuildDelegate>([this, &request, &Handle](const FGetBuildDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::GetBuild(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetBuildResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetBuildDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FGetBuildResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FGetBuildResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FGetBuildResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::GetBuildAlias(
     MultiplayerModels::FGetBuildAliasRequest& request,
     const FGetBuildAliasDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -778,29 +848,32 @@ bool UPlayFabMultiplayerInstanceAPI::GetBuildAlias(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetBuildAlias"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetBuildAliasResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetBuildAlias"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnGetBuildAliasResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FBuildAliasDetailsResponse>> UPlayFabMultiplayerInstanceAPI::GetBuildAliasAsync(MultiplayerModels::FGetBuildAliasRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FBuildAliasDetailsResponse, FGetBuildAliasDelegate>([this, &request, &Handle](const FGetBuildAliasDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::GetBuildAlias(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetBuildAliasResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetBuildAliasDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FBuildAliasDetailsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FBuildAliasDetailsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FBuildAliasDetailsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::GetContainerRegistryCredentials(
     MultiplayerModels::FGetContainerRegistryCredentialsRequest& request,
     const FGetContainerRegistryCredentialsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -808,29 +881,32 @@ bool UPlayFabMultiplayerInstanceAPI::GetContainerRegistryCredentials(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetContainerRegistryCredentials"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetContainerRegistryCredentialsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetContainerRegistryCredentials"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnGetContainerRegistryCredentialsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FGetContainerRegistryCredentialsResponse>> UPlayFabMultiplayerInstanceAPI::GetContainerRegistryCredentialsAsync(MultiplayerModels::FGetContainerRegistryCredentialsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FGetContainerRegistryCredentialsResponse, FGetContainerRegistryCredentialsDelegate>([this, &request, &Handle](const FGetContainerRegistryCredentialsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::GetContainerRegistryCredentials(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetContainerRegistryCredentialsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContainerRegistryCredentialsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FGetContainerRegistryCredentialsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FGetContainerRegistryCredentialsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FGetContainerRegistryCredentialsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::GetMatch(
     MultiplayerModels::FGetMatchRequest& request,
     const FGetMatchDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -838,29 +914,32 @@ bool UPlayFabMultiplayerInstanceAPI::GetMatch(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/GetMatch"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetMatchResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/GetMatch"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnGetMatchResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FGetMatchResult>> UPlayFabMultiplayerInstanceAPI::GetMatchAsync(MultiplayerModels::FGetMatchRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FGetMatchResult, FGetMatchDelegate>([this, &request, &Handle](const FGetMatchDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::GetMatch(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetMatchResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMatchDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FGetMatchResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FGetMatchResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FGetMatchResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::GetMatchmakingTicket(
     MultiplayerModels::FGetMatchmakingTicketRequest& request,
     const FGetMatchmakingTicketDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -868,29 +947,32 @@ bool UPlayFabMultiplayerInstanceAPI::GetMatchmakingTicket(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/GetMatchmakingTicket"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/GetMatchmakingTicket"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnGetMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FGetMatchmakingTicketResult>> UPlayFabMultiplayerInstanceAPI::GetMatchmakingTicketAsync(MultiplayerModels::FGetMatchmakingTicketRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FGetMatchmakingTicketResult, FGetMatchmakingTicketDelegate>([this, &request, &Handle](const FGetMatchmakingTicketDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::GetMatchmakingTicket(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetMatchmakingTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMatchmakingTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FGetMatchmakingTicketResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FGetMatchmakingTicketResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FGetMatchmakingTicketResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::GetMultiplayerServerDetails(
     MultiplayerModels::FGetMultiplayerServerDetailsRequest& request,
     const FGetMultiplayerServerDetailsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -898,29 +980,32 @@ bool UPlayFabMultiplayerInstanceAPI::GetMultiplayerServerDetails(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetMultiplayerServerDetails"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetMultiplayerServerDetailsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetMultiplayerServerDetails"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnGetMultiplayerServerDetailsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FGetMultiplayerServerDetailsResponse>> UPlayFabMultiplayerInstanceAPI::GetMultiplayerServerDetailsAsync(MultiplayerModels::FGetMultiplayerServerDetailsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FGetMultiplayerServerDetailsResponse, FGetMultiplayerServerDetailsDelegate>([this, &request, &Handle](const FGetMultiplayerServerDetailsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::GetMultiplayerServerDetails(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetMultiplayerServerDetailsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMultiplayerServerDetailsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FGetMultiplayerServerDetailsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FGetMultiplayerServerDetailsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FGetMultiplayerServerDetailsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::GetMultiplayerServerLogs(
     MultiplayerModels::FGetMultiplayerServerLogsRequest& request,
     const FGetMultiplayerServerLogsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -928,29 +1013,32 @@ bool UPlayFabMultiplayerInstanceAPI::GetMultiplayerServerLogs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetMultiplayerServerLogs"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetMultiplayerServerLogsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetMultiplayerServerLogs"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnGetMultiplayerServerLogsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FGetMultiplayerServerLogsResponse>> UPlayFabMultiplayerInstanceAPI::GetMultiplayerServerLogsAsync(MultiplayerModels::FGetMultiplayerServerLogsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FGetMultiplayerServerLogsResponse, FGetMultiplayerServerLogsDelegate>([this, &request, &Handle](const FGetMultiplayerServerLogsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::GetMultiplayerServerLogs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetMultiplayerServerLogsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMultiplayerServerLogsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FGetMultiplayerServerLogsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FGetMultiplayerServerLogsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FGetMultiplayerServerLogsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::GetMultiplayerSessionLogsBySessionId(
     MultiplayerModels::FGetMultiplayerSessionLogsBySessionIdRequest& request,
     const FGetMultiplayerSessionLogsBySessionIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -958,29 +1046,32 @@ bool UPlayFabMultiplayerInstanceAPI::GetMultiplayerSessionLogsBySessionId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetMultiplayerSessionLogsBySessionId"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetMultiplayerSessionLogsBySessionIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetMultiplayerSessionLogsBySessionId"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnGetMultiplayerSessionLogsBySessionIdResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FGetMultiplayerServerLogsResponse>> UPlayFabMultiplayerInstanceAPI::GetMultiplayerSessionLogsBySessionIdAsync(MultiplayerModels::FGetMultiplayerSessionLogsBySessionIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FGetMultiplayerServerLogsResponse, FGetMultiplayerSessionLogsBySessionIdDelegate>([this, &request, &Handle](const FGetMultiplayerSessionLogsBySessionIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::GetMultiplayerSessionLogsBySessionId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetMultiplayerSessionLogsBySessionIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMultiplayerSessionLogsBySessionIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FGetMultiplayerServerLogsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FGetMultiplayerServerLogsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FGetMultiplayerServerLogsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::GetQueueStatistics(
     MultiplayerModels::FGetQueueStatisticsRequest& request,
     const FGetQueueStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -988,29 +1079,32 @@ bool UPlayFabMultiplayerInstanceAPI::GetQueueStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/GetQueueStatistics"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetQueueStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/GetQueueStatistics"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnGetQueueStatisticsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FGetQueueStatisticsResult>> UPlayFabMultiplayerInstanceAPI::GetQueueStatisticsAsync(MultiplayerModels::FGetQueueStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FGetQueueStatisticsResult, FGetQueueStatisticsDelegate>([this, &request, &Handle](const FGetQueueStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::GetQueueStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetQueueStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetQueueStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FGetQueueStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FGetQueueStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FGetQueueStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::GetRemoteLoginEndpoint(
     MultiplayerModels::FGetRemoteLoginEndpointRequest& request,
     const FGetRemoteLoginEndpointDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1018,29 +1112,32 @@ bool UPlayFabMultiplayerInstanceAPI::GetRemoteLoginEndpoint(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetRemoteLoginEndpoint"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetRemoteLoginEndpointResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetRemoteLoginEndpoint"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnGetRemoteLoginEndpointResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FGetRemoteLoginEndpointResponse>> UPlayFabMultiplayerInstanceAPI::GetRemoteLoginEndpointAsync(MultiplayerModels::FGetRemoteLoginEndpointRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FGetRemoteLoginEndpointResponse, FGetRemoteLoginEndpointDelegate>([this, &request, &Handle](const FGetRemoteLoginEndpointDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::GetRemoteLoginEndpoint(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetRemoteLoginEndpointResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetRemoteLoginEndpointDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FGetRemoteLoginEndpointResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FGetRemoteLoginEndpointResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FGetRemoteLoginEndpointResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::GetServerBackfillTicket(
     MultiplayerModels::FGetServerBackfillTicketRequest& request,
     const FGetServerBackfillTicketDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1048,29 +1145,32 @@ bool UPlayFabMultiplayerInstanceAPI::GetServerBackfillTicket(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/GetServerBackfillTicket"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetServerBackfillTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/GetServerBackfillTicket"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnGetServerBackfillTicketResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FGetServerBackfillTicketResult>> UPlayFabMultiplayerInstanceAPI::GetServerBackfillTicketAsync(MultiplayerModels::FGetServerBackfillTicketRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FGetServerBackfillTicketResult, FGetServerBackfillTicketDelegate>([this, &request, &Handle](const FGetServerBackfillTicketDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::GetServerBackfillTicket(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetServerBackfillTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetServerBackfillTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FGetServerBackfillTicketResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FGetServerBackfillTicketResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FGetServerBackfillTicketResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::GetTitleEnabledForMultiplayerServersStatus(
     MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusRequest& request,
     const FGetTitleEnabledForMultiplayerServersStatusDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1078,29 +1178,32 @@ bool UPlayFabMultiplayerInstanceAPI::GetTitleEnabledForMultiplayerServersStatus(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetTitleEnabledForMultiplayerServersStatus"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetTitleEnabledForMultiplayerServersStatusResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetTitleEnabledForMultiplayerServersStatus"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnGetTitleEnabledForMultiplayerServersStatusResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusResponse>> UPlayFabMultiplayerInstanceAPI::GetTitleEnabledForMultiplayerServersStatusAsync(MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusResponse, FGetTitleEnabledForMultiplayerServersStatusDelegate>([this, &request, &Handle](const FGetTitleEnabledForMultiplayerServersStatusDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::GetTitleEnabledForMultiplayerServersStatus(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetTitleEnabledForMultiplayerServersStatusResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleEnabledForMultiplayerServersStatusDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::GetTitleMultiplayerServersQuotaChange(
     MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeRequest& request,
     const FGetTitleMultiplayerServersQuotaChangeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1108,29 +1211,32 @@ bool UPlayFabMultiplayerInstanceAPI::GetTitleMultiplayerServersQuotaChange(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetTitleMultiplayerServersQuotaChange"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetTitleMultiplayerServersQuotaChangeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetTitleMultiplayerServersQuotaChange"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnGetTitleMultiplayerServersQuotaChangeResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeResponse>> UPlayFabMultiplayerInstanceAPI::GetTitleMultiplayerServersQuotaChangeAsync(MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeResponse, FGetTitleMultiplayerServersQuotaChangeDelegate>([this, &request, &Handle](const FGetTitleMultiplayerServersQuotaChangeDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::GetTitleMultiplayerServersQuotaChange(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetTitleMultiplayerServersQuotaChangeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleMultiplayerServersQuotaChangeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::GetTitleMultiplayerServersQuotas(
     MultiplayerModels::FGetTitleMultiplayerServersQuotasRequest& request,
     const FGetTitleMultiplayerServersQuotasDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1138,29 +1244,32 @@ bool UPlayFabMultiplayerInstanceAPI::GetTitleMultiplayerServersQuotas(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetTitleMultiplayerServersQuotas"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnGetTitleMultiplayerServersQuotasResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/GetTitleMultiplayerServersQuotas"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnGetTitleMultiplayerServersQuotasResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FGetTitleMultiplayerServersQuotasResponse>> UPlayFabMultiplayerInstanceAPI::GetTitleMultiplayerServersQuotasAsync(MultiplayerModels::FGetTitleMultiplayerServersQuotasRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FGetTitleMultiplayerServersQuotasResponse, FGetTitleMultiplayerServersQuotasDelegate>([this, &request, &Handle](const FGetTitleMultiplayerServersQuotasDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::GetTitleMultiplayerServersQuotas(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnGetTitleMultiplayerServersQuotasResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleMultiplayerServersQuotasDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FGetTitleMultiplayerServersQuotasResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FGetTitleMultiplayerServersQuotasResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FGetTitleMultiplayerServersQuotasResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::JoinMatchmakingTicket(
     MultiplayerModels::FJoinMatchmakingTicketRequest& request,
     const FJoinMatchmakingTicketDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1168,29 +1277,32 @@ bool UPlayFabMultiplayerInstanceAPI::JoinMatchmakingTicket(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/JoinMatchmakingTicket"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnJoinMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/JoinMatchmakingTicket"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnJoinMatchmakingTicketResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FJoinMatchmakingTicketResult>> UPlayFabMultiplayerInstanceAPI::JoinMatchmakingTicketAsync(MultiplayerModels::FJoinMatchmakingTicketRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FJoinMatchmakingTicketResult, FJoinMatchmakingTicketDelegate>([this, &request, &Handle](const FJoinMatchmakingTicketDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::JoinMatchmakingTicket(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnJoinMatchmakingTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FJoinMatchmakingTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FJoinMatchmakingTicketResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FJoinMatchmakingTicketResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FJoinMatchmakingTicketResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::ListArchivedMultiplayerServers(
     MultiplayerModels::FListMultiplayerServersRequest& request,
     const FListArchivedMultiplayerServersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1198,29 +1310,32 @@ bool UPlayFabMultiplayerInstanceAPI::ListArchivedMultiplayerServers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListArchivedMultiplayerServers"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListArchivedMultiplayerServersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListArchivedMultiplayerServers"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnListArchivedMultiplayerServersResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FListMultiplayerServersResponse>> UPlayFabMultiplayerInstanceAPI::ListArchivedMultiplayerServersAsync(MultiplayerModels::FListMultiplayerServersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FListMultiplayerServersResponse, FListArchivedMultiplayerServersDelegate>([this, &request, &Handle](const FListArchivedMultiplayerServersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::ListArchivedMultiplayerServers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListArchivedMultiplayerServersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListArchivedMultiplayerServersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FListMultiplayerServersResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FListMultiplayerServersResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FListMultiplayerServersResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::ListAssetSummaries(
     MultiplayerModels::FListAssetSummariesRequest& request,
     const FListAssetSummariesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1228,29 +1343,32 @@ bool UPlayFabMultiplayerInstanceAPI::ListAssetSummaries(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListAssetSummaries"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListAssetSummariesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListAssetSummaries"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnListAssetSummariesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FListAssetSummariesResponse>> UPlayFabMultiplayerInstanceAPI::ListAssetSummariesAsync(MultiplayerModels::FListAssetSummariesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FListAssetSummariesResponse, FListAssetSummariesDelegate>([this, &request, &Handle](const FListAssetSummariesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::ListAssetSummaries(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListAssetSummariesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListAssetSummariesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FListAssetSummariesResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FListAssetSummariesResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FListAssetSummariesResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::ListBuildAliases(
     MultiplayerModels::FListBuildAliasesRequest& request,
     const FListBuildAliasesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1258,29 +1376,32 @@ bool UPlayFabMultiplayerInstanceAPI::ListBuildAliases(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListBuildAliases"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListBuildAliasesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListBuildAliases"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnListBuildAliasesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FListBuildAliasesResponse>> UPlayFabMultiplayerInstanceAPI::ListBuildAliasesAsync(MultiplayerModels::FListBuildAliasesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FListBuildAliasesResponse, FListBuildAliasesDelegate>([this, &request, &Handle](const FListBuildAliasesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::ListBuildAliases(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListBuildAliasesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListBuildAliasesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FListBuildAliasesResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FListBuildAliasesResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FListBuildAliasesResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::ListBuildSummariesV2(
     MultiplayerModels::FListBuildSummariesRequest& request,
     const FListBuildSummariesV2Delegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1288,29 +1409,32 @@ bool UPlayFabMultiplayerInstanceAPI::ListBuildSummariesV2(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListBuildSummariesV2"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListBuildSummariesV2Result, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListBuildSummariesV2"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnListBuildSummariesV2Result, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FListBuildSummariesResponse>> UPlayFabMultiplayerInstanceAPI::ListBuildSummariesV2Async(MultiplayerModels::FListBuildSummariesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FListBuildSummariesResponse, FListBuildSummariesV2Delegate>([this, &request, &Handle](const FListBuildSummariesV2Delegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::ListBuildSummariesV2(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListBuildSummariesV2Result(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListBuildSummariesV2Delegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FListBuildSummariesResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FListBuildSummariesResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FListBuildSummariesResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::ListCertificateSummaries(
     MultiplayerModels::FListCertificateSummariesRequest& request,
     const FListCertificateSummariesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1318,29 +1442,32 @@ bool UPlayFabMultiplayerInstanceAPI::ListCertificateSummaries(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListCertificateSummaries"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListCertificateSummariesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListCertificateSummaries"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnListCertificateSummariesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FListCertificateSummariesResponse>> UPlayFabMultiplayerInstanceAPI::ListCertificateSummariesAsync(MultiplayerModels::FListCertificateSummariesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FListCertificateSummariesResponse, FListCertificateSummariesDelegate>([this, &request, &Handle](const FListCertificateSummariesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::ListCertificateSummaries(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListCertificateSummariesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListCertificateSummariesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FListCertificateSummariesResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FListCertificateSummariesResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FListCertificateSummariesResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::ListContainerImages(
     MultiplayerModels::FListContainerImagesRequest& request,
     const FListContainerImagesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1348,29 +1475,32 @@ bool UPlayFabMultiplayerInstanceAPI::ListContainerImages(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListContainerImages"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListContainerImagesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListContainerImages"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnListContainerImagesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FListContainerImagesResponse>> UPlayFabMultiplayerInstanceAPI::ListContainerImagesAsync(MultiplayerModels::FListContainerImagesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FListContainerImagesResponse, FListContainerImagesDelegate>([this, &request, &Handle](const FListContainerImagesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::ListContainerImages(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListContainerImagesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListContainerImagesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FListContainerImagesResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FListContainerImagesResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FListContainerImagesResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::ListContainerImageTags(
     MultiplayerModels::FListContainerImageTagsRequest& request,
     const FListContainerImageTagsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1378,29 +1508,32 @@ bool UPlayFabMultiplayerInstanceAPI::ListContainerImageTags(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListContainerImageTags"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListContainerImageTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListContainerImageTags"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnListContainerImageTagsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FListContainerImageTagsResponse>> UPlayFabMultiplayerInstanceAPI::ListContainerImageTagsAsync(MultiplayerModels::FListContainerImageTagsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FListContainerImageTagsResponse, FListContainerImageTagsDelegate>([this, &request, &Handle](const FListContainerImageTagsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::ListContainerImageTags(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListContainerImageTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListContainerImageTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FListContainerImageTagsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FListContainerImageTagsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FListContainerImageTagsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::ListMatchmakingTicketsForPlayer(
     MultiplayerModels::FListMatchmakingTicketsForPlayerRequest& request,
     const FListMatchmakingTicketsForPlayerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1408,29 +1541,32 @@ bool UPlayFabMultiplayerInstanceAPI::ListMatchmakingTicketsForPlayer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/ListMatchmakingTicketsForPlayer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListMatchmakingTicketsForPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/ListMatchmakingTicketsForPlayer"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnListMatchmakingTicketsForPlayerResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FListMatchmakingTicketsForPlayerResult>> UPlayFabMultiplayerInstanceAPI::ListMatchmakingTicketsForPlayerAsync(MultiplayerModels::FListMatchmakingTicketsForPlayerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FListMatchmakingTicketsForPlayerResult, FListMatchmakingTicketsForPlayerDelegate>([this, &request, &Handle](const FListMatchmakingTicketsForPlayerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::ListMatchmakingTicketsForPlayer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListMatchmakingTicketsForPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListMatchmakingTicketsForPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FListMatchmakingTicketsForPlayerResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FListMatchmakingTicketsForPlayerResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FListMatchmakingTicketsForPlayerResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::ListMultiplayerServers(
     MultiplayerModels::FListMultiplayerServersRequest& request,
     const FListMultiplayerServersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1438,56 +1574,62 @@ bool UPlayFabMultiplayerInstanceAPI::ListMultiplayerServers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListMultiplayerServers"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListMultiplayerServersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListMultiplayerServers"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnListMultiplayerServersResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FListMultiplayerServersResponse>> UPlayFabMultiplayerInstanceAPI::ListMultiplayerServersAsync(MultiplayerModels::FListMultiplayerServersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FListMultiplayerServersResponse, FListMultiplayerServersDelegate>([this, &request, &Handle](const FListMultiplayerServersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::ListMultiplayerServers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListMultiplayerServersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListMultiplayerServersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FListMultiplayerServersResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FListMultiplayerServersResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FListMultiplayerServersResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::ListPartyQosServers(
     MultiplayerModels::FListPartyQosServersRequest& request,
     const FListPartyQosServersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListPartyQosServers"), request.toJSONString(), TEXT(""), TEXT(""));
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListPartyQosServersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListPartyQosServers"), request.toJSONUtf8(), TEXT(""), TEXT(""));
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnListPartyQosServersResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FListPartyQosServersResponse>> UPlayFabMultiplayerInstanceAPI::ListPartyQosServersAsync(MultiplayerModels::FListPartyQosServersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FListPartyQosServersResponse, FListPartyQosServersDelegate>([this, &request, &Handle](const FListPartyQosServersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::ListPartyQosServers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListPartyQosServersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListPartyQosServersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FListPartyQosServersResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FListPartyQosServersResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FListPartyQosServersResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::ListQosServersForTitle(
     MultiplayerModels::FListQosServersForTitleRequest& request,
     const FListQosServersForTitleDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1495,29 +1637,32 @@ bool UPlayFabMultiplayerInstanceAPI::ListQosServersForTitle(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListQosServersForTitle"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListQosServersForTitleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListQosServersForTitle"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnListQosServersForTitleResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FListQosServersForTitleResponse>> UPlayFabMultiplayerInstanceAPI::ListQosServersForTitleAsync(MultiplayerModels::FListQosServersForTitleRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FListQosServersForTitleResponse, FListQosServersForTitleDelegate>([this, &request, &Handle](const FListQosServersForTitleDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::ListQosServersForTitle(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListQosServersForTitleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListQosServersForTitleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FListQosServersForTitleResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FListQosServersForTitleResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FListQosServersForTitleResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::ListServerBackfillTicketsForPlayer(
     MultiplayerModels::FListServerBackfillTicketsForPlayerRequest& request,
     const FListServerBackfillTicketsForPlayerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1525,29 +1670,32 @@ bool UPlayFabMultiplayerInstanceAPI::ListServerBackfillTicketsForPlayer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/ListServerBackfillTicketsForPlayer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListServerBackfillTicketsForPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Match/ListServerBackfillTicketsForPlayer"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnListServerBackfillTicketsForPlayerResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FListServerBackfillTicketsForPlayerResult>> UPlayFabMultiplayerInstanceAPI::ListServerBackfillTicketsForPlayerAsync(MultiplayerModels::FListServerBackfillTicketsForPlayerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FListServerBackfillTicketsForPlayerResult, FListServerBackfillTicketsForPlayerDelegate>([this, &request, &Handle](const FListServerBackfillTicketsForPlayerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::ListServerBackfillTicketsForPlayer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListServerBackfillTicketsForPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListServerBackfillTicketsForPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FListServerBackfillTicketsForPlayerResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FListServerBackfillTicketsForPlayerResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FListServerBackfillTicketsForPlayerResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::ListTitleMultiplayerServersQuotaChanges(
     MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRequest& request,
     const FListTitleMultiplayerServersQuotaChangesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1555,29 +1703,32 @@ bool UPlayFabMultiplayerInstanceAPI::ListTitleMultiplayerServersQuotaChanges(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListTitleMultiplayerServersQuotaChanges"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListTitleMultiplayerServersQuotaChangesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListTitleMultiplayerServersQuotaChanges"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnListTitleMultiplayerServersQuotaChangesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FListTitleMultiplayerServersQuotaChangesResponse>> UPlayFabMultiplayerInstanceAPI::ListTitleMultiplayerServersQuotaChangesAsync(MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FListTitleMultiplayerServersQuotaChangesResponse, FListTitleMultiplayerServersQuotaChangesDelegate>([this, &request, &Handle](const FListTitleMultiplayerServersQuotaChangesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::ListTitleMultiplayerServersQuotaChanges(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListTitleMultiplayerServersQuotaChangesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListTitleMultiplayerServersQuotaChangesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FListTitleMultiplayerServersQuotaChangesResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FListTitleMultiplayerServersQuotaChangesResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FListTitleMultiplayerServersQuotaChangesResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::ListVirtualMachineSummaries(
     MultiplayerModels::FListVirtualMachineSummariesRequest& request,
     const FListVirtualMachineSummariesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1585,29 +1736,32 @@ bool UPlayFabMultiplayerInstanceAPI::ListVirtualMachineSummaries(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListVirtualMachineSummaries"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnListVirtualMachineSummariesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ListVirtualMachineSummaries"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnListVirtualMachineSummariesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FListVirtualMachineSummariesResponse>> UPlayFabMultiplayerInstanceAPI::ListVirtualMachineSummariesAsync(MultiplayerModels::FListVirtualMachineSummariesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FListVirtualMachineSummariesResponse, FListVirtualMachineSummariesDelegate>([this, &request, &Handle](const FListVirtualMachineSummariesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::ListVirtualMachineSummaries(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnListVirtualMachineSummariesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListVirtualMachineSummariesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FListVirtualMachineSummariesResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FListVirtualMachineSummariesResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FListVirtualMachineSummariesResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::RequestMultiplayerServer(
     MultiplayerModels::FRequestMultiplayerServerRequest& request,
     const FRequestMultiplayerServerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1615,29 +1769,32 @@ bool UPlayFabMultiplayerInstanceAPI::RequestMultiplayerServer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/RequestMultiplayerServer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnRequestMultiplayerServerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/RequestMultiplayerServer"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnRequestMultiplayerServerResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FRequestMultiplayerServerResponse>> UPlayFabMultiplayerInstanceAPI::RequestMultiplayerServerAsync(MultiplayerModels::FRequestMultiplayerServerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FRequestMultiplayerServerResponse, FRequestMultiplayerServerDelegate>([this, &request, &Handle](const FRequestMultiplayerServerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::RequestMultiplayerServer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnRequestMultiplayerServerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRequestMultiplayerServerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FRequestMultiplayerServerResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FRequestMultiplayerServerResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FRequestMultiplayerServerResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::RolloverContainerRegistryCredentials(
     MultiplayerModels::FRolloverContainerRegistryCredentialsRequest& request,
     const FRolloverContainerRegistryCredentialsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1645,29 +1802,32 @@ bool UPlayFabMultiplayerInstanceAPI::RolloverContainerRegistryCredentials(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/RolloverContainerRegistryCredentials"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnRolloverContainerRegistryCredentialsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/RolloverContainerRegistryCredentials"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnRolloverContainerRegistryCredentialsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FRolloverContainerRegistryCredentialsResponse>> UPlayFabMultiplayerInstanceAPI::RolloverContainerRegistryCredentialsAsync(MultiplayerModels::FRolloverContainerRegistryCredentialsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FRolloverContainerRegistryCredentialsResponse, FRolloverContainerRegistryCredentialsDelegate>([this, &request, &Handle](const FRolloverContainerRegistryCredentialsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::RolloverContainerRegistryCredentials(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnRolloverContainerRegistryCredentialsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRolloverContainerRegistryCredentialsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FRolloverContainerRegistryCredentialsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FRolloverContainerRegistryCredentialsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FRolloverContainerRegistryCredentialsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::ShutdownMultiplayerServer(
     MultiplayerModels::FShutdownMultiplayerServerRequest& request,
     const FShutdownMultiplayerServerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1675,29 +1835,32 @@ bool UPlayFabMultiplayerInstanceAPI::ShutdownMultiplayerServer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ShutdownMultiplayerServer"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnShutdownMultiplayerServerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/ShutdownMultiplayerServer"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnShutdownMultiplayerServerResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FEmptyResponse>> UPlayFabMultiplayerInstanceAPI::ShutdownMultiplayerServerAsync(MultiplayerModels::FShutdownMultiplayerServerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FEmptyResponse, FShutdownMultiplayerServerDelegate>([this, &request, &Handle](const FShutdownMultiplayerServerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::ShutdownMultiplayerServer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnShutdownMultiplayerServerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FShutdownMultiplayerServerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::UntagContainerImage(
     MultiplayerModels::FUntagContainerImageRequest& request,
     const FUntagContainerImageDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1705,29 +1868,32 @@ bool UPlayFabMultiplayerInstanceAPI::UntagContainerImage(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UntagContainerImage"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnUntagContainerImageResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UntagContainerImage"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnUntagContainerImageResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FEmptyResponse>> UPlayFabMultiplayerInstanceAPI::UntagContainerImageAsync(MultiplayerModels::FUntagContainerImageRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FEmptyResponse, FUntagContainerImageDelegate>([this, &request, &Handle](const FUntagContainerImageDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::UntagContainerImage(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnUntagContainerImageResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUntagContainerImageDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::UpdateBuildAlias(
     MultiplayerModels::FUpdateBuildAliasRequest& request,
     const FUpdateBuildAliasDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1735,29 +1901,32 @@ bool UPlayFabMultiplayerInstanceAPI::UpdateBuildAlias(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UpdateBuildAlias"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnUpdateBuildAliasResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UpdateBuildAlias"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnUpdateBuildAliasResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FBuildAliasDetailsResponse>> UPlayFabMultiplayerInstanceAPI::UpdateBuildAliasAsync(MultiplayerModels::FUpdateBuildAliasRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FBuildAliasDetailsResponse, FUpdateBuildAliasDelegate>([this, &request, &Handle](const FUpdateBuildAliasDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::UpdateBuildAlias(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnUpdateBuildAliasResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBuildAliasDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FBuildAliasDetailsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FBuildAliasDetailsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FBuildAliasDetailsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::UpdateBuildName(
     MultiplayerModels::FUpdateBuildNameRequest& request,
     const FUpdateBuildNameDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1765,29 +1934,32 @@ bool UPlayFabMultiplayerInstanceAPI::UpdateBuildName(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UpdateBuildName"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnUpdateBuildNameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UpdateBuildName"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnUpdateBuildNameResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FEmptyResponse>> UPlayFabMultiplayerInstanceAPI::UpdateBuildNameAsync(MultiplayerModels::FUpdateBuildNameRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FEmptyResponse, FUpdateBuildNameDelegate>([this, &request, &Handle](const FUpdateBuildNameDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::UpdateBuildName(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnUpdateBuildNameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBuildNameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::UpdateBuildRegion(
     MultiplayerModels::FUpdateBuildRegionRequest& request,
     const FUpdateBuildRegionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1795,29 +1967,32 @@ bool UPlayFabMultiplayerInstanceAPI::UpdateBuildRegion(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UpdateBuildRegion"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnUpdateBuildRegionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UpdateBuildRegion"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnUpdateBuildRegionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FEmptyResponse>> UPlayFabMultiplayerInstanceAPI::UpdateBuildRegionAsync(MultiplayerModels::FUpdateBuildRegionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FEmptyResponse, FUpdateBuildRegionDelegate>([this, &request, &Handle](const FUpdateBuildRegionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::UpdateBuildRegion(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnUpdateBuildRegionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBuildRegionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::UpdateBuildRegions(
     MultiplayerModels::FUpdateBuildRegionsRequest& request,
     const FUpdateBuildRegionsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1825,29 +2000,32 @@ bool UPlayFabMultiplayerInstanceAPI::UpdateBuildRegions(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UpdateBuildRegions"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnUpdateBuildRegionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UpdateBuildRegions"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnUpdateBuildRegionsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FEmptyResponse>> UPlayFabMultiplayerInstanceAPI::UpdateBuildRegionsAsync(MultiplayerModels::FUpdateBuildRegionsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FEmptyResponse, FUpdateBuildRegionsDelegate>([this, &request, &Handle](const FUpdateBuildRegionsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::UpdateBuildRegions(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnUpdateBuildRegionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBuildRegionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMultiplayerInstanceAPI::UploadCertificate(
     MultiplayerModels::FUploadCertificateRequest& request,
     const FUploadCertificateDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -1855,21 +2033,23 @@ bool UPlayFabMultiplayerInstanceAPI::UploadCertificate(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UploadCertificate"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMultiplayerInstanceAPI::OnUploadCertificateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/MultiplayerServer/UploadCertificate"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMultiplayerInstanceAPI::OnUploadCertificateResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MultiplayerModels::FEmptyResponse>> UPlayFabMultiplayerInstanceAPI::UploadCertificateAsync(MultiplayerModels::FUploadCertificateRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MultiplayerModels::FEmptyResponse, FUploadCertificateDelegate>([this, &request, &Handle](const FUploadCertificateDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMultiplayerInstanceAPI::UploadCertificate(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMultiplayerInstanceAPI::OnUploadCertificateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUploadCertificateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MultiplayerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MultiplayerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MultiplayerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
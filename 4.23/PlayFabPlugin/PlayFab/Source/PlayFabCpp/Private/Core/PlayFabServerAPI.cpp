@@ -30,7 +30,8 @@ FString UPlayFabServerAPI::GetBuildIdentifier() const
 bool UPlayFabServerAPI::AddCharacterVirtualCurrency(
     ServerModels::FAddCharacterVirtualCurrencyRequest& request,
     const FAddCharacterVirtualCurrencyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -38,29 +39,32 @@ bool UPlayFabServerAPI::AddCharacterVirtualCurrency(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/AddCharacterVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/AddCharacterVirtualCurrency"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnAddCharacterVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FModifyCharacterVirtualCurrencyResult>> UPlayFabServerAPI::AddCharacterVirtualCurrencyAsync(ServerModels::FAddCharacterVirtualCurrencyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FModifyCharacterVirtualCurrencyResult, FAddCharacterVirtualCurrencyDelegate>([this, &request, &Handle](const FAddCharacterVirtualCurrencyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::AddCharacterVirtualCurrency(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnAddCharacterVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddCharacterVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FModifyCharacterVirtualCurrencyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FModifyCharacterVirtualCurrencyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FModifyCharacterVirtualCurrencyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::AddFriend(
     ServerModels::FAddFriendRequest& request,
     const FAddFriendDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -68,29 +72,32 @@ bool UPlayFabServerAPI::AddFriend(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/AddFriend"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/AddFriend"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnAddFriendResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FEmptyResponse>> UPlayFabServerAPI::AddFriendAsync(ServerModels::FAddFriendRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FEmptyResponse, FAddFriendDelegate>([this, &request, &Handle](const FAddFriendDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::AddFriend(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnAddFriendResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddFriendDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::AddGenericID(
     ServerModels::FAddGenericIDRequest& request,
     const FAddGenericIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -98,29 +105,32 @@ bool UPlayFabServerAPI::AddGenericID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/AddGenericID"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/AddGenericID"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnAddGenericIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FEmptyResult>> UPlayFabServerAPI::AddGenericIDAsync(ServerModels::FAddGenericIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FEmptyResult, FAddGenericIDDelegate>([this, &request, &Handle](const FAddGenericIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::AddGenericID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnAddGenericIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddGenericIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FEmptyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FEmptyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FEmptyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::AddPlayerTag(
     ServerModels::FAddPlayerTagRequest& request,
     const FAddPlayerTagDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -128,29 +138,32 @@ bool UPlayFabServerAPI::AddPlayerTag(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/AddPlayerTag"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/AddPlayerTag"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnAddPlayerTagResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FAddPlayerTagResult>> UPlayFabServerAPI::AddPlayerTagAsync(ServerModels::FAddPlayerTagRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FAddPlayerTagResult, FAddPlayerTagDelegate>([this, &request, &Handle](const FAddPlayerTagDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::AddPlayerTag(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnAddPlayerTagResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddPlayerTagDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FAddPlayerTagResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FAddPlayerTagResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FAddPlayerTagResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::AddSharedGroupMembers(
     ServerModels::FAddSharedGroupMembersRequest& request,
     const FAddSharedGroupMembersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -158,29 +171,32 @@ bool UPlayFabServerAPI::AddSharedGroupMembers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/AddSharedGroupMembers"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/AddSharedGroupMembers"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnAddSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FAddSharedGroupMembersResult>> UPlayFabServerAPI::AddSharedGroupMembersAsync(ServerModels::FAddSharedGroupMembersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FAddSharedGroupMembersResult, FAddSharedGroupMembersDelegate>([this, &request, &Handle](const FAddSharedGroupMembersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::AddSharedGroupMembers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnAddSharedGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddSharedGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FAddSharedGroupMembersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FAddSharedGroupMembersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FAddSharedGroupMembersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::AddUserVirtualCurrency(
     ServerModels::FAddUserVirtualCurrencyRequest& request,
     const FAddUserVirtualCurrencyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -188,29 +204,32 @@ bool UPlayFabServerAPI::AddUserVirtualCurrency(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/AddUserVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/AddUserVirtualCurrency"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnAddUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FModifyUserVirtualCurrencyResult>> UPlayFabServerAPI::AddUserVirtualCurrencyAsync(ServerModels::FAddUserVirtualCurrencyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FModifyUserVirtualCurrencyResult, FAddUserVirtualCurrencyDelegate>([this, &request, &Handle](const FAddUserVirtualCurrencyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::AddUserVirtualCurrency(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnAddUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FModifyUserVirtualCurrencyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FModifyUserVirtualCurrencyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FModifyUserVirtualCurrencyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::AuthenticateSessionTicket(
     ServerModels::FAuthenticateSessionTicketRequest& request,
     const FAuthenticateSessionTicketDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -218,29 +237,32 @@ bool UPlayFabServerAPI::AuthenticateSessionTicket(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/AuthenticateSessionTicket"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/AuthenticateSessionTicket"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnAuthenticateSessionTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FAuthenticateSessionTicketResult>> UPlayFabServerAPI::AuthenticateSessionTicketAsync(ServerModels::FAuthenticateSessionTicketRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FAuthenticateSessionTicketResult, FAuthenticateSessionTicketDelegate>([this, &request, &Handle](const FAuthenticateSessionTicketDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::AuthenticateSessionTicket(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnAuthenticateSessionTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAuthenticateSessionTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FAuthenticateSessionTicketResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FAuthenticateSessionTicketResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FAuthenticateSessionTicketResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::AwardSteamAchievement(
     ServerModels::FAwardSteamAchievementRequest& request,
     const FAwardSteamAchievementDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -248,29 +270,32 @@ bool UPlayFabServerAPI::AwardSteamAchievement(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/AwardSteamAchievement"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/AwardSteamAchievement"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnAwardSteamAchievementResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FAwardSteamAchievementResult>> UPlayFabServerAPI::AwardSteamAchievementAsync(ServerModels::FAwardSteamAchievementRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FAwardSteamAchievementResult, FAwardSteamAchievementDelegate>([this, &request, &Handle](const FAwardSteamAchievementDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::AwardSteamAchievement(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnAwardSteamAchievementResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAwardSteamAchievementDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FAwardSteamAchievementResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FAwardSteamAchievementResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FAwardSteamAchievementResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::BanUsers(
     ServerModels::FBanUsersRequest& request,
     const FBanUsersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -278,29 +303,32 @@ bool UPlayFabServerAPI::BanUsers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/BanUsers"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/BanUsers"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnBanUsersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FBanUsersResult>> UPlayFabServerAPI::BanUsersAsync(ServerModels::FBanUsersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FBanUsersResult, FBanUsersDelegate>([this, &request, &Handle](const FBanUsersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::BanUsers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnBanUsersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FBanUsersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FBanUsersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FBanUsersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FBanUsersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::ConsumeItem(
     ServerModels::FConsumeItemRequest& request,
     const FConsumeItemDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -308,29 +336,32 @@ bool UPlayFabServerAPI::ConsumeItem(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/ConsumeItem"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/ConsumeItem"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnConsumeItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FConsumeItemResult>> UPlayFabServerAPI::ConsumeItemAsync(ServerModels::FConsumeItemRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FConsumeItemResult, FConsumeItemDelegate>([this, &request, &Handle](const FConsumeItemDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::ConsumeItem(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnConsumeItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FConsumeItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FConsumeItemResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FConsumeItemResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FConsumeItemResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::CreateSharedGroup(
     ServerModels::FCreateSharedGroupRequest& request,
     const FCreateSharedGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -338,29 +369,32 @@ bool UPlayFabServerAPI::CreateSharedGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/CreateSharedGroup"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/CreateSharedGroup"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnCreateSharedGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FCreateSharedGroupResult>> UPlayFabServerAPI::CreateSharedGroupAsync(ServerModels::FCreateSharedGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FCreateSharedGroupResult, FCreateSharedGroupDelegate>([this, &request, &Handle](const FCreateSharedGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::CreateSharedGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnCreateSharedGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateSharedGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FCreateSharedGroupResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FCreateSharedGroupResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FCreateSharedGroupResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::DeleteCharacterFromUser(
     ServerModels::FDeleteCharacterFromUserRequest& request,
     const FDeleteCharacterFromUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -368,29 +402,32 @@ bool UPlayFabServerAPI::DeleteCharacterFromUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/DeleteCharacterFromUser"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/DeleteCharacterFromUser"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnDeleteCharacterFromUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FDeleteCharacterFromUserResult>> UPlayFabServerAPI::DeleteCharacterFromUserAsync(ServerModels::FDeleteCharacterFromUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FDeleteCharacterFromUserResult, FDeleteCharacterFromUserDelegate>([this, &request, &Handle](const FDeleteCharacterFromUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::DeleteCharacterFromUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnDeleteCharacterFromUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteCharacterFromUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FDeleteCharacterFromUserResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FDeleteCharacterFromUserResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FDeleteCharacterFromUserResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::DeletePlayer(
     ServerModels::FDeletePlayerRequest& request,
     const FDeletePlayerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -398,29 +435,32 @@ bool UPlayFabServerAPI::DeletePlayer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/DeletePlayer"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/DeletePlayer"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnDeletePlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FDeletePlayerResult>> UPlayFabServerAPI::DeletePlayerAsync(ServerModels::FDeletePlayerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FDeletePlayerResult, FDeletePlayerDelegate>([this, &request, &Handle](const FDeletePlayerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::DeletePlayer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnDeletePlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FDeletePlayerResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FDeletePlayerResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FDeletePlayerResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::DeletePushNotificationTemplate(
     ServerModels::FDeletePushNotificationTemplateRequest& request,
     const FDeletePushNotificationTemplateDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -428,29 +468,32 @@ bool UPlayFabServerAPI::DeletePushNotificationTemplate(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/DeletePushNotificationTemplate"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/DeletePushNotificationTemplate"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnDeletePushNotificationTemplateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FDeletePushNotificationTemplateResult>> UPlayFabServerAPI::DeletePushNotificationTemplateAsync(ServerModels::FDeletePushNotificationTemplateRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FDeletePushNotificationTemplateResult, FDeletePushNotificationTemplateDelegate>([this, &request, &Handle](const FDeletePushNotificationTemplateDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::DeletePushNotificationTemplate(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnDeletePushNotificationTemplateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePushNotificationTemplateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FDeletePushNotificationTemplateResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FDeletePushNotificationTemplateResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FDeletePushNotificationTemplateResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::DeleteSharedGroup(
     ServerModels::FDeleteSharedGroupRequest& request,
     const FDeleteSharedGroupDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -458,29 +501,32 @@ bool UPlayFabServerAPI::DeleteSharedGroup(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/DeleteSharedGroup"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/DeleteSharedGroup"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnDeleteSharedGroupResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FEmptyResponse>> UPlayFabServerAPI::DeleteSharedGroupAsync(ServerModels::FDeleteSharedGroupRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FEmptyResponse, FDeleteSharedGroupDelegate>([this, &request, &Handle](const FDeleteSharedGroupDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::DeleteSharedGroup(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnDeleteSharedGroupResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteSharedGroupDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::DeregisterGame(
     ServerModels::FDeregisterGameRequest& request,
     const FDeregisterGameDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -488,29 +534,32 @@ bool UPlayFabServerAPI::DeregisterGame(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/DeregisterGame"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/DeregisterGame"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnDeregisterGameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FDeregisterGameResponse>> UPlayFabServerAPI::DeregisterGameAsync(ServerModels::FDeregisterGameRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FDeregisterGameResponse, FDeregisterGameDelegate>([this, &request, &Handle](const FDeregisterGameDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::DeregisterGame(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnDeregisterGameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeregisterGameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FDeregisterGameResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FDeregisterGameResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FDeregisterGameResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::EvaluateRandomResultTable(
     ServerModels::FEvaluateRandomResultTableRequest& request,
     const FEvaluateRandomResultTableDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -518,29 +567,32 @@ bool UPlayFabServerAPI::EvaluateRandomResultTable(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/EvaluateRandomResultTable"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/EvaluateRandomResultTable"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnEvaluateRandomResultTableResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FEvaluateRandomResultTableResult>> UPlayFabServerAPI::EvaluateRandomResultTableAsync(ServerModels::FEvaluateRandomResultTableRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FEvaluateRandomResultTableResult, FEvaluateRandomResultTableDelegate>([this, &request, &Handle](const FEvaluateRandomResultTableDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::EvaluateRandomResultTable(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnEvaluateRandomResultTableResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FEvaluateRandomResultTableDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FEvaluateRandomResultTableResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FEvaluateRandomResultTableResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FEvaluateRandomResultTableResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::ExecuteCloudScript(
     ServerModels::FExecuteCloudScriptServerRequest& request,
     const FExecuteCloudScriptDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -548,37 +600,41 @@ bool UPlayFabServerAPI::ExecuteCloudScript(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/ExecuteCloudScript"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/ExecuteCloudScript"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnExecuteCloudScriptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FExecuteCloudScriptResult>> UPlayFabServerAPI::ExecuteCloudScriptAsync(ServerModels::FExecuteCloudScriptServerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FExecuteCloudScriptResult, FExecuteCloudScriptDelegate>([this, &request, &Handle](const FExecuteCloudScriptDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::ExecuteCloudScript(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnExecuteCloudScriptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExecuteCloudScriptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FExecuteCloudScriptResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FExecuteCloudScriptResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FExecuteCloudScriptResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetAllSegments(
     const FGetAllSegmentsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     ServerModels::FGetAllSegmentsRequest emptyRequest = ServerModels::FGetAllSegmentsRequest();
-    return UPlayFabServerAPI::GetAllSegments(emptyRequest, SuccessDelegate, ErrorDelegate);
+    return UPlayFabServerAPI::GetAllSegments(emptyRequest, SuccessDelegate, ErrorDelegate, Handle);
 }
 
 bool UPlayFabServerAPI::GetAllSegments(
     ServerModels::FGetAllSegmentsRequest& request,
     const FGetAllSegmentsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -586,29 +642,38 @@ bool UPlayFabServerAPI::GetAllSegments(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetAllSegments"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetAllSegments"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetAllSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetAllSegmentsResult>> UPlayFabServerAPI::GetAllSegmentsAsync(const FPlayFabRequestHandle& Handle)
+{
+    ServerModels::FGetAllSegmentsRequest emptyRequest = ServerModels::FGetAllSegmentsRequest();
+    return UPlayFabServerAPI::GetAllSegmentsAsync(emptyRequest, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetAllSegmentsResult>> UPlayFabServerAPI::GetAllSegmentsAsync(ServerModels::FGetAllSegmentsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetAllSegmentsResult, FGetAllSegmentsDelegate>([this, &request, &Handle](const FGetAllSegmentsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetAllSegments(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetAllSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAllSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetAllSegmentsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetAllSegmentsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetAllSegmentsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetAllUsersCharacters(
     ServerModels::FListUsersCharactersRequest& request,
     const FGetAllUsersCharactersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -616,29 +681,32 @@ bool UPlayFabServerAPI::GetAllUsersCharacters(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetAllUsersCharacters"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetAllUsersCharacters"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetAllUsersCharactersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FListUsersCharactersResult>> UPlayFabServerAPI::GetAllUsersCharactersAsync(ServerModels::FListUsersCharactersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FListUsersCharactersResult, FGetAllUsersCharactersDelegate>([this, &request, &Handle](const FGetAllUsersCharactersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetAllUsersCharacters(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetAllUsersCharactersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAllUsersCharactersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FListUsersCharactersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FListUsersCharactersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FListUsersCharactersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetCatalogItems(
     ServerModels::FGetCatalogItemsRequest& request,
     const FGetCatalogItemsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -646,29 +714,32 @@ bool UPlayFabServerAPI::GetCatalogItems(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetCatalogItems"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetCatalogItems"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetCatalogItemsResult>> UPlayFabServerAPI::GetCatalogItemsAsync(ServerModels::FGetCatalogItemsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetCatalogItemsResult, FGetCatalogItemsDelegate>([this, &request, &Handle](const FGetCatalogItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetCatalogItems(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetCatalogItemsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetCatalogItemsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetCatalogItemsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetCharacterData(
     ServerModels::FGetCharacterDataRequest& request,
     const FGetCharacterDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -676,29 +747,32 @@ bool UPlayFabServerAPI::GetCharacterData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetCharacterData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetCharacterData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetCharacterDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetCharacterDataResult>> UPlayFabServerAPI::GetCharacterDataAsync(ServerModels::FGetCharacterDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetCharacterDataResult, FGetCharacterDataDelegate>([this, &request, &Handle](const FGetCharacterDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetCharacterData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetCharacterDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetCharacterDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetCharacterDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetCharacterDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetCharacterInternalData(
     ServerModels::FGetCharacterDataRequest& request,
     const FGetCharacterInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -706,29 +780,32 @@ bool UPlayFabServerAPI::GetCharacterInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetCharacterInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetCharacterInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetCharacterInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetCharacterDataResult>> UPlayFabServerAPI::GetCharacterInternalDataAsync(ServerModels::FGetCharacterDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetCharacterDataResult, FGetCharacterInternalDataDelegate>([this, &request, &Handle](const FGetCharacterInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetCharacterInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetCharacterInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetCharacterDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetCharacterDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetCharacterDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetCharacterInventory(
     ServerModels::FGetCharacterInventoryRequest& request,
     const FGetCharacterInventoryDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -736,29 +813,32 @@ bool UPlayFabServerAPI::GetCharacterInventory(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetCharacterInventory"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetCharacterInventory"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetCharacterInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetCharacterInventoryResult>> UPlayFabServerAPI::GetCharacterInventoryAsync(ServerModels::FGetCharacterInventoryRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetCharacterInventoryResult, FGetCharacterInventoryDelegate>([this, &request, &Handle](const FGetCharacterInventoryDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetCharacterInventory(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetCharacterInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetCharacterInventoryResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetCharacterInventoryResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetCharacterInventoryResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetCharacterLeaderboard(
     ServerModels::FGetCharacterLeaderboardRequest& request,
     const FGetCharacterLeaderboardDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -766,29 +846,32 @@ bool UPlayFabServerAPI::GetCharacterLeaderboard(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetCharacterLeaderboard"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetCharacterLeaderboard"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetCharacterLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetCharacterLeaderboardResult>> UPlayFabServerAPI::GetCharacterLeaderboardAsync(ServerModels::FGetCharacterLeaderboardRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetCharacterLeaderboardResult, FGetCharacterLeaderboardDelegate>([this, &request, &Handle](const FGetCharacterLeaderboardDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetCharacterLeaderboard(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetCharacterLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetCharacterLeaderboardResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetCharacterLeaderboardResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetCharacterLeaderboardResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetCharacterReadOnlyData(
     ServerModels::FGetCharacterDataRequest& request,
     const FGetCharacterReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -796,29 +879,32 @@ bool UPlayFabServerAPI::GetCharacterReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetCharacterReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetCharacterReadOnlyData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetCharacterReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetCharacterDataResult>> UPlayFabServerAPI::GetCharacterReadOnlyDataAsync(ServerModels::FGetCharacterDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetCharacterDataResult, FGetCharacterReadOnlyDataDelegate>([this, &request, &Handle](const FGetCharacterReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetCharacterReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetCharacterReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetCharacterDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetCharacterDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetCharacterDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetCharacterStatistics(
     ServerModels::FGetCharacterStatisticsRequest& request,
     const FGetCharacterStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -826,29 +912,32 @@ bool UPlayFabServerAPI::GetCharacterStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetCharacterStatistics"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetCharacterStatistics"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetCharacterStatisticsResult>> UPlayFabServerAPI::GetCharacterStatisticsAsync(ServerModels::FGetCharacterStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetCharacterStatisticsResult, FGetCharacterStatisticsDelegate>([this, &request, &Handle](const FGetCharacterStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetCharacterStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetCharacterStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetCharacterStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetCharacterStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetContentDownloadUrl(
     ServerModels::FGetContentDownloadUrlRequest& request,
     const FGetContentDownloadUrlDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -856,29 +945,32 @@ bool UPlayFabServerAPI::GetContentDownloadUrl(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetContentDownloadUrl"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetContentDownloadUrl"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetContentDownloadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetContentDownloadUrlResult>> UPlayFabServerAPI::GetContentDownloadUrlAsync(ServerModels::FGetContentDownloadUrlRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetContentDownloadUrlResult, FGetContentDownloadUrlDelegate>([this, &request, &Handle](const FGetContentDownloadUrlDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetContentDownloadUrl(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetContentDownloadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContentDownloadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetContentDownloadUrlResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetContentDownloadUrlResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetContentDownloadUrlResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetFriendLeaderboard(
     ServerModels::FGetFriendLeaderboardRequest& request,
     const FGetFriendLeaderboardDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -886,29 +978,32 @@ bool UPlayFabServerAPI::GetFriendLeaderboard(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetFriendLeaderboard"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetFriendLeaderboard"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetFriendLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetLeaderboardResult>> UPlayFabServerAPI::GetFriendLeaderboardAsync(ServerModels::FGetFriendLeaderboardRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetLeaderboardResult, FGetFriendLeaderboardDelegate>([this, &request, &Handle](const FGetFriendLeaderboardDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetFriendLeaderboard(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetFriendLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetLeaderboardResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetLeaderboardResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetLeaderboardResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetFriendsList(
     ServerModels::FGetFriendsListRequest& request,
     const FGetFriendsListDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -916,29 +1011,32 @@ bool UPlayFabServerAPI::GetFriendsList(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetFriendsList"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetFriendsList"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetFriendsListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetFriendsListResult>> UPlayFabServerAPI::GetFriendsListAsync(ServerModels::FGetFriendsListRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetFriendsListResult, FGetFriendsListDelegate>([this, &request, &Handle](const FGetFriendsListDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetFriendsList(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetFriendsListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetFriendsListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetFriendsListResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetFriendsListResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetFriendsListResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetLeaderboard(
     ServerModels::FGetLeaderboardRequest& request,
     const FGetLeaderboardDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -946,29 +1044,32 @@ bool UPlayFabServerAPI::GetLeaderboard(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetLeaderboard"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetLeaderboard"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetLeaderboardResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetLeaderboardResult>> UPlayFabServerAPI::GetLeaderboardAsync(ServerModels::FGetLeaderboardRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetLeaderboardResult, FGetLeaderboardDelegate>([this, &request, &Handle](const FGetLeaderboardDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetLeaderboard(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetLeaderboardResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetLeaderboardResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetLeaderboardResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetLeaderboardResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetLeaderboardAroundCharacter(
     ServerModels::FGetLeaderboardAroundCharacterRequest& request,
     const FGetLeaderboardAroundCharacterDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -976,29 +1077,32 @@ bool UPlayFabServerAPI::GetLeaderboardAroundCharacter(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetLeaderboardAroundCharacter"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetLeaderboardAroundCharacter"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetLeaderboardAroundCharacterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetLeaderboardAroundCharacterResult>> UPlayFabServerAPI::GetLeaderboardAroundCharacterAsync(ServerModels::FGetLeaderboardAroundCharacterRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetLeaderboardAroundCharacterResult, FGetLeaderboardAroundCharacterDelegate>([this, &request, &Handle](const FGetLeaderboardAroundCharacterDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetLeaderboardAroundCharacter(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetLeaderboardAroundCharacterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardAroundCharacterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetLeaderboardAroundCharacterResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetLeaderboardAroundCharacterResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetLeaderboardAroundCharacterResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetLeaderboardAroundUser(
     ServerModels::FGetLeaderboardAroundUserRequest& request,
     const FGetLeaderboardAroundUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1006,29 +1110,32 @@ bool UPlayFabServerAPI::GetLeaderboardAroundUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetLeaderboardAroundUser"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetLeaderboardAroundUser"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetLeaderboardAroundUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetLeaderboardAroundUserResult>> UPlayFabServerAPI::GetLeaderboardAroundUserAsync(ServerModels::FGetLeaderboardAroundUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetLeaderboardAroundUserResult, FGetLeaderboardAroundUserDelegate>([this, &request, &Handle](const FGetLeaderboardAroundUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetLeaderboardAroundUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetLeaderboardAroundUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardAroundUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetLeaderboardAroundUserResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetLeaderboardAroundUserResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetLeaderboardAroundUserResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetLeaderboardForUserCharacters(
     ServerModels::FGetLeaderboardForUsersCharactersRequest& request,
     const FGetLeaderboardForUserCharactersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1036,29 +1143,32 @@ bool UPlayFabServerAPI::GetLeaderboardForUserCharacters(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetLeaderboardForUserCharacters"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetLeaderboardForUserCharacters"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetLeaderboardForUserCharactersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetLeaderboardForUsersCharactersResult>> UPlayFabServerAPI::GetLeaderboardForUserCharactersAsync(ServerModels::FGetLeaderboardForUsersCharactersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetLeaderboardForUsersCharactersResult, FGetLeaderboardForUserCharactersDelegate>([this, &request, &Handle](const FGetLeaderboardForUserCharactersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetLeaderboardForUserCharacters(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetLeaderboardForUserCharactersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLeaderboardForUserCharactersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetLeaderboardForUsersCharactersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetLeaderboardForUsersCharactersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetLeaderboardForUsersCharactersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetPlayerCombinedInfo(
     ServerModels::FGetPlayerCombinedInfoRequest& request,
     const FGetPlayerCombinedInfoDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1066,29 +1176,32 @@ bool UPlayFabServerAPI::GetPlayerCombinedInfo(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayerCombinedInfo"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayerCombinedInfo"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetPlayerCombinedInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayerCombinedInfoResult>> UPlayFabServerAPI::GetPlayerCombinedInfoAsync(ServerModels::FGetPlayerCombinedInfoRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayerCombinedInfoResult, FGetPlayerCombinedInfoDelegate>([this, &request, &Handle](const FGetPlayerCombinedInfoDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetPlayerCombinedInfo(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetPlayerCombinedInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerCombinedInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayerCombinedInfoResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayerCombinedInfoResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayerCombinedInfoResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetPlayerProfile(
     ServerModels::FGetPlayerProfileRequest& request,
     const FGetPlayerProfileDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1096,29 +1209,32 @@ bool UPlayFabServerAPI::GetPlayerProfile(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayerProfile"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayerProfile"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetPlayerProfileResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayerProfileResult>> UPlayFabServerAPI::GetPlayerProfileAsync(ServerModels::FGetPlayerProfileRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayerProfileResult, FGetPlayerProfileDelegate>([this, &request, &Handle](const FGetPlayerProfileDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetPlayerProfile(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetPlayerProfileResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerProfileDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayerProfileResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayerProfileResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayerProfileResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetPlayerSegments(
     ServerModels::FGetPlayersSegmentsRequest& request,
     const FGetPlayerSegmentsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1126,29 +1242,32 @@ bool UPlayFabServerAPI::GetPlayerSegments(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayerSegments"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayerSegments"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetPlayerSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayerSegmentsResult>> UPlayFabServerAPI::GetPlayerSegmentsAsync(ServerModels::FGetPlayersSegmentsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayerSegmentsResult, FGetPlayerSegmentsDelegate>([this, &request, &Handle](const FGetPlayerSegmentsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetPlayerSegments(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetPlayerSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayerSegmentsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayerSegmentsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayerSegmentsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetPlayersInSegment(
     ServerModels::FGetPlayersInSegmentRequest& request,
     const FGetPlayersInSegmentDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1156,29 +1275,32 @@ bool UPlayFabServerAPI::GetPlayersInSegment(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayersInSegment"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayersInSegment"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetPlayersInSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayersInSegmentResult>> UPlayFabServerAPI::GetPlayersInSegmentAsync(ServerModels::FGetPlayersInSegmentRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayersInSegmentResult, FGetPlayersInSegmentDelegate>([this, &request, &Handle](const FGetPlayersInSegmentDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetPlayersInSegment(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetPlayersInSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayersInSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayersInSegmentResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayersInSegmentResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayersInSegmentResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetPlayerStatistics(
     ServerModels::FGetPlayerStatisticsRequest& request,
     const FGetPlayerStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1186,29 +1308,32 @@ bool UPlayFabServerAPI::GetPlayerStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayerStatistics"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayerStatistics"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetPlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayerStatisticsResult>> UPlayFabServerAPI::GetPlayerStatisticsAsync(ServerModels::FGetPlayerStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayerStatisticsResult, FGetPlayerStatisticsDelegate>([this, &request, &Handle](const FGetPlayerStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetPlayerStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetPlayerStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayerStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayerStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayerStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetPlayerStatisticVersions(
     ServerModels::FGetPlayerStatisticVersionsRequest& request,
     const FGetPlayerStatisticVersionsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1216,29 +1341,32 @@ bool UPlayFabServerAPI::GetPlayerStatisticVersions(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayerStatisticVersions"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayerStatisticVersions"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetPlayerStatisticVersionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayerStatisticVersionsResult>> UPlayFabServerAPI::GetPlayerStatisticVersionsAsync(ServerModels::FGetPlayerStatisticVersionsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayerStatisticVersionsResult, FGetPlayerStatisticVersionsDelegate>([this, &request, &Handle](const FGetPlayerStatisticVersionsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetPlayerStatisticVersions(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetPlayerStatisticVersionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticVersionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayerStatisticVersionsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayerStatisticVersionsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayerStatisticVersionsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetPlayerTags(
     ServerModels::FGetPlayerTagsRequest& request,
     const FGetPlayerTagsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1246,29 +1374,32 @@ bool UPlayFabServerAPI::GetPlayerTags(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayerTags"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayerTags"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetPlayerTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayerTagsResult>> UPlayFabServerAPI::GetPlayerTagsAsync(ServerModels::FGetPlayerTagsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayerTagsResult, FGetPlayerTagsDelegate>([this, &request, &Handle](const FGetPlayerTagsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetPlayerTags(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetPlayerTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayerTagsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayerTagsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayerTagsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetPlayFabIDsFromFacebookIDs(
     ServerModels::FGetPlayFabIDsFromFacebookIDsRequest& request,
     const FGetPlayFabIDsFromFacebookIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1276,29 +1407,32 @@ bool UPlayFabServerAPI::GetPlayFabIDsFromFacebookIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayFabIDsFromFacebookIDs"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayFabIDsFromFacebookIDs"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetPlayFabIDsFromFacebookIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayFabIDsFromFacebookIDsResult>> UPlayFabServerAPI::GetPlayFabIDsFromFacebookIDsAsync(ServerModels::FGetPlayFabIDsFromFacebookIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayFabIDsFromFacebookIDsResult, FGetPlayFabIDsFromFacebookIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromFacebookIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetPlayFabIDsFromFacebookIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetPlayFabIDsFromFacebookIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromFacebookIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayFabIDsFromFacebookIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayFabIDsFromFacebookIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayFabIDsFromFacebookIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
     ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& request,
     const FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1306,29 +1440,32 @@ bool UPlayFabServerAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayFabIDsFromFacebookInstantGamesIds"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayFabIDsFromFacebookInstantGamesIds"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult>> UPlayFabServerAPI::GetPlayFabIDsFromFacebookInstantGamesIdsAsync(ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult, FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetPlayFabIDsFromFacebookInstantGamesIds(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromFacebookInstantGamesIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayFabIDsFromFacebookInstantGamesIdsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetPlayFabIDsFromGenericIDs(
     ServerModels::FGetPlayFabIDsFromGenericIDsRequest& request,
     const FGetPlayFabIDsFromGenericIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1336,29 +1473,32 @@ bool UPlayFabServerAPI::GetPlayFabIDsFromGenericIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayFabIDsFromGenericIDs"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayFabIDsFromGenericIDs"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetPlayFabIDsFromGenericIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayFabIDsFromGenericIDsResult>> UPlayFabServerAPI::GetPlayFabIDsFromGenericIDsAsync(ServerModels::FGetPlayFabIDsFromGenericIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayFabIDsFromGenericIDsResult, FGetPlayFabIDsFromGenericIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromGenericIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetPlayFabIDsFromGenericIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetPlayFabIDsFromGenericIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromGenericIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayFabIDsFromGenericIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayFabIDsFromGenericIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayFabIDsFromGenericIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
     ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& request,
     const FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1366,29 +1506,32 @@ bool UPlayFabServerAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayFabIDsFromNintendoSwitchDeviceIds"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayFabIDsFromNintendoSwitchDeviceIds"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult>> UPlayFabServerAPI::GetPlayFabIDsFromNintendoSwitchDeviceIdsAsync(ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult, FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromNintendoSwitchDeviceIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetPlayFabIDsFromPSNAccountIDs(
     ServerModels::FGetPlayFabIDsFromPSNAccountIDsRequest& request,
     const FGetPlayFabIDsFromPSNAccountIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1396,29 +1539,32 @@ bool UPlayFabServerAPI::GetPlayFabIDsFromPSNAccountIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayFabIDsFromPSNAccountIDs"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayFabIDsFromPSNAccountIDs"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetPlayFabIDsFromPSNAccountIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult>> UPlayFabServerAPI::GetPlayFabIDsFromPSNAccountIDsAsync(ServerModels::FGetPlayFabIDsFromPSNAccountIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult, FGetPlayFabIDsFromPSNAccountIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromPSNAccountIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetPlayFabIDsFromPSNAccountIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetPlayFabIDsFromPSNAccountIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromPSNAccountIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayFabIDsFromPSNAccountIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetPlayFabIDsFromSteamIDs(
     ServerModels::FGetPlayFabIDsFromSteamIDsRequest& request,
     const FGetPlayFabIDsFromSteamIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1426,29 +1572,32 @@ bool UPlayFabServerAPI::GetPlayFabIDsFromSteamIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayFabIDsFromSteamIDs"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayFabIDsFromSteamIDs"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetPlayFabIDsFromSteamIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayFabIDsFromSteamIDsResult>> UPlayFabServerAPI::GetPlayFabIDsFromSteamIDsAsync(ServerModels::FGetPlayFabIDsFromSteamIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayFabIDsFromSteamIDsResult, FGetPlayFabIDsFromSteamIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromSteamIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetPlayFabIDsFromSteamIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetPlayFabIDsFromSteamIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromSteamIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayFabIDsFromSteamIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayFabIDsFromSteamIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayFabIDsFromSteamIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetPlayFabIDsFromXboxLiveIDs(
     ServerModels::FGetPlayFabIDsFromXboxLiveIDsRequest& request,
     const FGetPlayFabIDsFromXboxLiveIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1456,29 +1605,32 @@ bool UPlayFabServerAPI::GetPlayFabIDsFromXboxLiveIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayFabIDsFromXboxLiveIDs"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPlayFabIDsFromXboxLiveIDs"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetPlayFabIDsFromXboxLiveIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult>> UPlayFabServerAPI::GetPlayFabIDsFromXboxLiveIDsAsync(ServerModels::FGetPlayFabIDsFromXboxLiveIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult, FGetPlayFabIDsFromXboxLiveIDsDelegate>([this, &request, &Handle](const FGetPlayFabIDsFromXboxLiveIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetPlayFabIDsFromXboxLiveIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetPlayFabIDsFromXboxLiveIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayFabIDsFromXboxLiveIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPlayFabIDsFromXboxLiveIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetPublisherData(
     ServerModels::FGetPublisherDataRequest& request,
     const FGetPublisherDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1486,29 +1638,32 @@ bool UPlayFabServerAPI::GetPublisherData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetPublisherData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetPublisherDataResult>> UPlayFabServerAPI::GetPublisherDataAsync(ServerModels::FGetPublisherDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetPublisherDataResult, FGetPublisherDataDelegate>([this, &request, &Handle](const FGetPublisherDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetPublisherData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetPublisherDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetPublisherDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetPublisherDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetRandomResultTables(
     ServerModels::FGetRandomResultTablesRequest& request,
     const FGetRandomResultTablesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1516,29 +1671,32 @@ bool UPlayFabServerAPI::GetRandomResultTables(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetRandomResultTables"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetRandomResultTables"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetRandomResultTablesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetRandomResultTablesResult>> UPlayFabServerAPI::GetRandomResultTablesAsync(ServerModels::FGetRandomResultTablesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetRandomResultTablesResult, FGetRandomResultTablesDelegate>([this, &request, &Handle](const FGetRandomResultTablesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetRandomResultTables(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetRandomResultTablesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetRandomResultTablesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetRandomResultTablesResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetRandomResultTablesResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetRandomResultTablesResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetServerCustomIDsFromPlayFabIDs(
     ServerModels::FGetServerCustomIDsFromPlayFabIDsRequest& request,
     const FGetServerCustomIDsFromPlayFabIDsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1546,29 +1704,32 @@ bool UPlayFabServerAPI::GetServerCustomIDsFromPlayFabIDs(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetServerCustomIDsFromPlayFabIDs"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetServerCustomIDsFromPlayFabIDs"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetServerCustomIDsFromPlayFabIDsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetServerCustomIDsFromPlayFabIDsResult>> UPlayFabServerAPI::GetServerCustomIDsFromPlayFabIDsAsync(ServerModels::FGetServerCustomIDsFromPlayFabIDsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetServerCustomIDsFromPlayFabIDsResult, FGetServerCustomIDsFromPlayFabIDsDelegate>([this, &request, &Handle](const FGetServerCustomIDsFromPlayFabIDsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetServerCustomIDsFromPlayFabIDs(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetServerCustomIDsFromPlayFabIDsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetServerCustomIDsFromPlayFabIDsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetServerCustomIDsFromPlayFabIDsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetServerCustomIDsFromPlayFabIDsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetServerCustomIDsFromPlayFabIDsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetSharedGroupData(
     ServerModels::FGetSharedGroupDataRequest& request,
     const FGetSharedGroupDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1576,29 +1737,32 @@ bool UPlayFabServerAPI::GetSharedGroupData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetSharedGroupData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetSharedGroupData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetSharedGroupDataResult>> UPlayFabServerAPI::GetSharedGroupDataAsync(ServerModels::FGetSharedGroupDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetSharedGroupDataResult, FGetSharedGroupDataDelegate>([this, &request, &Handle](const FGetSharedGroupDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetSharedGroupData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetSharedGroupDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSharedGroupDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetSharedGroupDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetSharedGroupDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetSharedGroupDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetStoreItems(
     ServerModels::FGetStoreItemsServerRequest& request,
     const FGetStoreItemsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1606,37 +1770,41 @@ bool UPlayFabServerAPI::GetStoreItems(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetStoreItems"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetStoreItems"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetStoreItemsResult>> UPlayFabServerAPI::GetStoreItemsAsync(ServerModels::FGetStoreItemsServerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetStoreItemsResult, FGetStoreItemsDelegate>([this, &request, &Handle](const FGetStoreItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetStoreItems(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetStoreItemsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetStoreItemsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetStoreItemsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetTime(
     const FGetTimeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     ServerModels::FGetTimeRequest emptyRequest = ServerModels::FGetTimeRequest();
-    return UPlayFabServerAPI::GetTime(emptyRequest, SuccessDelegate, ErrorDelegate);
+    return UPlayFabServerAPI::GetTime(emptyRequest, SuccessDelegate, ErrorDelegate, Handle);
 }
 
 bool UPlayFabServerAPI::GetTime(
     ServerModels::FGetTimeRequest& request,
     const FGetTimeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1644,29 +1812,38 @@ bool UPlayFabServerAPI::GetTime(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetTime"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetTime"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetTimeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetTimeResult>> UPlayFabServerAPI::GetTimeAsync(const FPlayFabRequestHandle& Handle)
+{
+    ServerModels::FGetTimeRequest emptyRequest = ServerModels::FGetTimeRequest();
+    return UPlayFabServerAPI::GetTimeAsync(emptyRequest, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetTimeResult>> UPlayFabServerAPI::GetTimeAsync(ServerModels::FGetTimeRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetTimeResult, FGetTimeDelegate>([this, &request, &Handle](const FGetTimeDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetTime(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetTimeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTimeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetTimeResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetTimeResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetTimeResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetTitleData(
     ServerModels::FGetTitleDataRequest& request,
     const FGetTitleDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1674,29 +1851,32 @@ bool UPlayFabServerAPI::GetTitleData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetTitleData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetTitleData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetTitleDataResult>> UPlayFabServerAPI::GetTitleDataAsync(ServerModels::FGetTitleDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetTitleDataResult, FGetTitleDataDelegate>([this, &request, &Handle](const FGetTitleDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetTitleData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetTitleDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetTitleDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetTitleDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetTitleInternalData(
     ServerModels::FGetTitleDataRequest& request,
     const FGetTitleInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1704,29 +1884,32 @@ bool UPlayFabServerAPI::GetTitleInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetTitleInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetTitleInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetTitleDataResult>> UPlayFabServerAPI::GetTitleInternalDataAsync(ServerModels::FGetTitleDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetTitleDataResult, FGetTitleInternalDataDelegate>([this, &request, &Handle](const FGetTitleInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetTitleInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetTitleInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetTitleDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetTitleDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetTitleDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetTitleNews(
     ServerModels::FGetTitleNewsRequest& request,
     const FGetTitleNewsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1734,29 +1917,32 @@ bool UPlayFabServerAPI::GetTitleNews(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetTitleNews"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetTitleNews"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetTitleNewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetTitleNewsResult>> UPlayFabServerAPI::GetTitleNewsAsync(ServerModels::FGetTitleNewsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetTitleNewsResult, FGetTitleNewsDelegate>([this, &request, &Handle](const FGetTitleNewsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetTitleNews(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetTitleNewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleNewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetTitleNewsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetTitleNewsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetTitleNewsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetUserAccountInfo(
     ServerModels::FGetUserAccountInfoRequest& request,
     const FGetUserAccountInfoDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1764,29 +1950,32 @@ bool UPlayFabServerAPI::GetUserAccountInfo(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetUserAccountInfo"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetUserAccountInfo"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetUserAccountInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetUserAccountInfoResult>> UPlayFabServerAPI::GetUserAccountInfoAsync(ServerModels::FGetUserAccountInfoRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetUserAccountInfoResult, FGetUserAccountInfoDelegate>([this, &request, &Handle](const FGetUserAccountInfoDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetUserAccountInfo(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetUserAccountInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserAccountInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetUserAccountInfoResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetUserAccountInfoResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetUserAccountInfoResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetUserBans(
     ServerModels::FGetUserBansRequest& request,
     const FGetUserBansDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1794,29 +1983,32 @@ bool UPlayFabServerAPI::GetUserBans(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetUserBans"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetUserBans"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetUserBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetUserBansResult>> UPlayFabServerAPI::GetUserBansAsync(ServerModels::FGetUserBansRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetUserBansResult, FGetUserBansDelegate>([this, &request, &Handle](const FGetUserBansDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetUserBans(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetUserBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetUserBansResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetUserBansResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetUserBansResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetUserData(
     ServerModels::FGetUserDataRequest& request,
     const FGetUserDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1824,29 +2016,32 @@ bool UPlayFabServerAPI::GetUserData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetUserData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetUserData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
 }
 
-void UPlayFabServerAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
+TFuture<TPlayFabResult<ServerModels::FGetUserDataResult>> UPlayFabServerAPI::GetUserDataAsync(ServerModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
 {
-    ServerModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    return MakePlayFabFuture<ServerModels::FGetUserDataResult, FGetUserDataDelegate>([this, &request, &Handle](const FGetUserDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
     {
-        SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
+        return UPlayFabServerAPI::GetUserData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
+}
+
+void UPlayFabServerAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
+{
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetUserDataResult& outResult)
     {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+        SuccessDelegate.ExecuteIfBound(outResult);
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetUserInternalData(
     ServerModels::FGetUserDataRequest& request,
     const FGetUserInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1854,29 +2049,32 @@ bool UPlayFabServerAPI::GetUserInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetUserInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetUserInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetUserInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetUserDataResult>> UPlayFabServerAPI::GetUserInternalDataAsync(ServerModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetUserDataResult, FGetUserInternalDataDelegate>([this, &request, &Handle](const FGetUserInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetUserInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetUserInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetUserInventory(
     ServerModels::FGetUserInventoryRequest& request,
     const FGetUserInventoryDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1884,29 +2082,32 @@ bool UPlayFabServerAPI::GetUserInventory(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetUserInventory"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetUserInventory"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetUserInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetUserInventoryResult>> UPlayFabServerAPI::GetUserInventoryAsync(ServerModels::FGetUserInventoryRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetUserInventoryResult, FGetUserInventoryDelegate>([this, &request, &Handle](const FGetUserInventoryDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetUserInventory(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetUserInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetUserInventoryResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetUserInventoryResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetUserInventoryResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetUserPublisherData(
     ServerModels::FGetUserDataRequest& request,
     const FGetUserPublisherDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1914,29 +2115,32 @@ bool UPlayFabServerAPI::GetUserPublisherData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetUserPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetUserPublisherData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetUserDataResult>> UPlayFabServerAPI::GetUserPublisherDataAsync(ServerModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetUserDataResult, FGetUserPublisherDataDelegate>([this, &request, &Handle](const FGetUserPublisherDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetUserPublisherData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetUserPublisherInternalData(
     ServerModels::FGetUserDataRequest& request,
     const FGetUserPublisherInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1944,29 +2148,32 @@ bool UPlayFabServerAPI::GetUserPublisherInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetUserPublisherInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetUserPublisherInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetUserDataResult>> UPlayFabServerAPI::GetUserPublisherInternalDataAsync(ServerModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetUserDataResult, FGetUserPublisherInternalDataDelegate>([this, &request, &Handle](const FGetUserPublisherInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetUserPublisherInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetUserPublisherInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetUserPublisherReadOnlyData(
     ServerModels::FGetUserDataRequest& request,
     const FGetUserPublisherReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -1974,29 +2181,32 @@ bool UPlayFabServerAPI::GetUserPublisherReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetUserPublisherReadOnlyData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetUserDataResult>> UPlayFabServerAPI::GetUserPublisherReadOnlyDataAsync(ServerModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetUserDataResult, FGetUserPublisherReadOnlyDataDelegate>([this, &request, &Handle](const FGetUserPublisherReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetUserPublisherReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GetUserReadOnlyData(
     ServerModels::FGetUserDataRequest& request,
     const FGetUserReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2004,29 +2214,32 @@ bool UPlayFabServerAPI::GetUserReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetUserReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GetUserReadOnlyData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGetUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGetUserDataResult>> UPlayFabServerAPI::GetUserReadOnlyDataAsync(ServerModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGetUserDataResult, FGetUserReadOnlyDataDelegate>([this, &request, &Handle](const FGetUserReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GetUserReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGetUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GrantCharacterToUser(
     ServerModels::FGrantCharacterToUserRequest& request,
     const FGrantCharacterToUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2034,29 +2247,32 @@ bool UPlayFabServerAPI::GrantCharacterToUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GrantCharacterToUser"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GrantCharacterToUser"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGrantCharacterToUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGrantCharacterToUserResult>> UPlayFabServerAPI::GrantCharacterToUserAsync(ServerModels::FGrantCharacterToUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGrantCharacterToUserResult, FGrantCharacterToUserDelegate>([this, &request, &Handle](const FGrantCharacterToUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GrantCharacterToUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGrantCharacterToUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantCharacterToUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGrantCharacterToUserResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGrantCharacterToUserResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGrantCharacterToUserResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GrantItemsToCharacter(
     ServerModels::FGrantItemsToCharacterRequest& request,
     const FGrantItemsToCharacterDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2064,29 +2280,32 @@ bool UPlayFabServerAPI::GrantItemsToCharacter(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GrantItemsToCharacter"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GrantItemsToCharacter"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGrantItemsToCharacterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGrantItemsToCharacterResult>> UPlayFabServerAPI::GrantItemsToCharacterAsync(ServerModels::FGrantItemsToCharacterRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGrantItemsToCharacterResult, FGrantItemsToCharacterDelegate>([this, &request, &Handle](const FGrantItemsToCharacterDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GrantItemsToCharacter(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGrantItemsToCharacterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantItemsToCharacterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGrantItemsToCharacterResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGrantItemsToCharacterResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGrantItemsToCharacterResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GrantItemsToUser(
     ServerModels::FGrantItemsToUserRequest& request,
     const FGrantItemsToUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2094,29 +2313,32 @@ bool UPlayFabServerAPI::GrantItemsToUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GrantItemsToUser"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GrantItemsToUser"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGrantItemsToUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGrantItemsToUserResult>> UPlayFabServerAPI::GrantItemsToUserAsync(ServerModels::FGrantItemsToUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGrantItemsToUserResult, FGrantItemsToUserDelegate>([this, &request, &Handle](const FGrantItemsToUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GrantItemsToUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGrantItemsToUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantItemsToUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGrantItemsToUserResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGrantItemsToUserResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGrantItemsToUserResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::GrantItemsToUsers(
     ServerModels::FGrantItemsToUsersRequest& request,
     const FGrantItemsToUsersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2124,29 +2346,32 @@ bool UPlayFabServerAPI::GrantItemsToUsers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GrantItemsToUsers"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/GrantItemsToUsers"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnGrantItemsToUsersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FGrantItemsToUsersResult>> UPlayFabServerAPI::GrantItemsToUsersAsync(ServerModels::FGrantItemsToUsersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FGrantItemsToUsersResult, FGrantItemsToUsersDelegate>([this, &request, &Handle](const FGrantItemsToUsersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::GrantItemsToUsers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnGrantItemsToUsersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantItemsToUsersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FGrantItemsToUsersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FGrantItemsToUsersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FGrantItemsToUsersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::LinkPSNAccount(
     ServerModels::FLinkPSNAccountRequest& request,
     const FLinkPSNAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2154,29 +2379,32 @@ bool UPlayFabServerAPI::LinkPSNAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/LinkPSNAccount"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/LinkPSNAccount"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnLinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FLinkPSNAccountResult>> UPlayFabServerAPI::LinkPSNAccountAsync(ServerModels::FLinkPSNAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FLinkPSNAccountResult, FLinkPSNAccountDelegate>([this, &request, &Handle](const FLinkPSNAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::LinkPSNAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnLinkPSNAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkPSNAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FLinkPSNAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FLinkPSNAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FLinkPSNAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::LinkServerCustomId(
     ServerModels::FLinkServerCustomIdRequest& request,
     const FLinkServerCustomIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2184,29 +2412,32 @@ bool UPlayFabServerAPI::LinkServerCustomId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/LinkServerCustomId"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/LinkServerCustomId"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnLinkServerCustomIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FLinkServerCustomIdResult>> UPlayFabServerAPI::LinkServerCustomIdAsync(ServerModels::FLinkServerCustomIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FLinkServerCustomIdResult, FLinkServerCustomIdDelegate>([this, &request, &Handle](const FLinkServerCustomIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::LinkServerCustomId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnLinkServerCustomIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkServerCustomIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FLinkServerCustomIdResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FLinkServerCustomIdResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FLinkServerCustomIdResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::LinkXboxAccount(
     ServerModels::FLinkXboxAccountRequest& request,
     const FLinkXboxAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2214,29 +2445,32 @@ bool UPlayFabServerAPI::LinkXboxAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/LinkXboxAccount"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/LinkXboxAccount"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnLinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FLinkXboxAccountResult>> UPlayFabServerAPI::LinkXboxAccountAsync(ServerModels::FLinkXboxAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FLinkXboxAccountResult, FLinkXboxAccountDelegate>([this, &request, &Handle](const FLinkXboxAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::LinkXboxAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnLinkXboxAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLinkXboxAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FLinkXboxAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FLinkXboxAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FLinkXboxAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::LoginWithServerCustomId(
     ServerModels::FLoginWithServerCustomIdRequest& request,
     const FLoginWithServerCustomIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2244,29 +2478,32 @@ bool UPlayFabServerAPI::LoginWithServerCustomId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/LoginWithServerCustomId"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/LoginWithServerCustomId"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnLoginWithServerCustomIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FServerLoginResult>> UPlayFabServerAPI::LoginWithServerCustomIdAsync(ServerModels::FLoginWithServerCustomIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FServerLoginResult, FLoginWithServerCustomIdDelegate>([this, &request, &Handle](const FLoginWithServerCustomIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::LoginWithServerCustomId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnLoginWithServerCustomIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithServerCustomIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FServerLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FServerLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FServerLoginResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::LoginWithSteamId(
     ServerModels::FLoginWithSteamIdRequest& request,
     const FLoginWithSteamIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2274,29 +2511,32 @@ bool UPlayFabServerAPI::LoginWithSteamId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/LoginWithSteamId"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/LoginWithSteamId"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnLoginWithSteamIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FServerLoginResult>> UPlayFabServerAPI::LoginWithSteamIdAsync(ServerModels::FLoginWithSteamIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FServerLoginResult, FLoginWithSteamIdDelegate>([this, &request, &Handle](const FLoginWithSteamIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::LoginWithSteamId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnLoginWithSteamIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithSteamIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FServerLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FServerLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FServerLoginResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::LoginWithXbox(
     ServerModels::FLoginWithXboxRequest& request,
     const FLoginWithXboxDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2304,29 +2544,32 @@ bool UPlayFabServerAPI::LoginWithXbox(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/LoginWithXbox"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/LoginWithXbox"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnLoginWithXboxResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FServerLoginResult>> UPlayFabServerAPI::LoginWithXboxAsync(ServerModels::FLoginWithXboxRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FServerLoginResult, FLoginWithXboxDelegate>([this, &request, &Handle](const FLoginWithXboxDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::LoginWithXbox(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnLoginWithXboxResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithXboxDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FServerLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FServerLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FServerLoginResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::LoginWithXboxId(
     ServerModels::FLoginWithXboxIdRequest& request,
     const FLoginWithXboxIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2334,29 +2577,32 @@ bool UPlayFabServerAPI::LoginWithXboxId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/LoginWithXboxId"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/LoginWithXboxId"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnLoginWithXboxIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FServerLoginResult>> UPlayFabServerAPI::LoginWithXboxIdAsync(ServerModels::FLoginWithXboxIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FServerLoginResult, FLoginWithXboxIdDelegate>([this, &request, &Handle](const FLoginWithXboxIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::LoginWithXboxId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnLoginWithXboxIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FLoginWithXboxIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FServerLoginResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FServerLoginResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FServerLoginResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::ModifyItemUses(
     ServerModels::FModifyItemUsesRequest& request,
     const FModifyItemUsesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2364,29 +2610,32 @@ bool UPlayFabServerAPI::ModifyItemUses(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/ModifyItemUses"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/ModifyItemUses"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnModifyItemUsesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FModifyItemUsesResult>> UPlayFabServerAPI::ModifyItemUsesAsync(ServerModels::FModifyItemUsesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FModifyItemUsesResult, FModifyItemUsesDelegate>([this, &request, &Handle](const FModifyItemUsesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::ModifyItemUses(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnModifyItemUsesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FModifyItemUsesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FModifyItemUsesResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FModifyItemUsesResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FModifyItemUsesResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::MoveItemToCharacterFromCharacter(
     ServerModels::FMoveItemToCharacterFromCharacterRequest& request,
     const FMoveItemToCharacterFromCharacterDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2394,29 +2643,32 @@ bool UPlayFabServerAPI::MoveItemToCharacterFromCharacter(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/MoveItemToCharacterFromCharacter"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/MoveItemToCharacterFromCharacter"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnMoveItemToCharacterFromCharacterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FMoveItemToCharacterFromCharacterResult>> UPlayFabServerAPI::MoveItemToCharacterFromCharacterAsync(ServerModels::FMoveItemToCharacterFromCharacterRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FMoveItemToCharacterFromCharacterResult, FMoveItemToCharacterFromCharacterDelegate>([this, &request, &Handle](const FMoveItemToCharacterFromCharacterDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::MoveItemToCharacterFromCharacter(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnMoveItemToCharacterFromCharacterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FMoveItemToCharacterFromCharacterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FMoveItemToCharacterFromCharacterResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FMoveItemToCharacterFromCharacterResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FMoveItemToCharacterFromCharacterResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::MoveItemToCharacterFromUser(
     ServerModels::FMoveItemToCharacterFromUserRequest& request,
     const FMoveItemToCharacterFromUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2424,29 +2676,32 @@ bool UPlayFabServerAPI::MoveItemToCharacterFromUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/MoveItemToCharacterFromUser"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/MoveItemToCharacterFromUser"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnMoveItemToCharacterFromUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FMoveItemToCharacterFromUserResult>> UPlayFabServerAPI::MoveItemToCharacterFromUserAsync(ServerModels::FMoveItemToCharacterFromUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FMoveItemToCharacterFromUserResult, FMoveItemToCharacterFromUserDelegate>([this, &request, &Handle](const FMoveItemToCharacterFromUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::MoveItemToCharacterFromUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnMoveItemToCharacterFromUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FMoveItemToCharacterFromUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FMoveItemToCharacterFromUserResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FMoveItemToCharacterFromUserResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FMoveItemToCharacterFromUserResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::MoveItemToUserFromCharacter(
     ServerModels::FMoveItemToUserFromCharacterRequest& request,
     const FMoveItemToUserFromCharacterDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2454,29 +2709,32 @@ bool UPlayFabServerAPI::MoveItemToUserFromCharacter(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/MoveItemToUserFromCharacter"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/MoveItemToUserFromCharacter"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnMoveItemToUserFromCharacterResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FMoveItemToUserFromCharacterResult>> UPlayFabServerAPI::MoveItemToUserFromCharacterAsync(ServerModels::FMoveItemToUserFromCharacterRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FMoveItemToUserFromCharacterResult, FMoveItemToUserFromCharacterDelegate>([this, &request, &Handle](const FMoveItemToUserFromCharacterDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::MoveItemToUserFromCharacter(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnMoveItemToUserFromCharacterResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FMoveItemToUserFromCharacterDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FMoveItemToUserFromCharacterResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FMoveItemToUserFromCharacterResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FMoveItemToUserFromCharacterResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::NotifyMatchmakerPlayerLeft(
     ServerModels::FNotifyMatchmakerPlayerLeftRequest& request,
     const FNotifyMatchmakerPlayerLeftDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2484,29 +2742,32 @@ bool UPlayFabServerAPI::NotifyMatchmakerPlayerLeft(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/NotifyMatchmakerPlayerLeft"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/NotifyMatchmakerPlayerLeft"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnNotifyMatchmakerPlayerLeftResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FNotifyMatchmakerPlayerLeftResult>> UPlayFabServerAPI::NotifyMatchmakerPlayerLeftAsync(ServerModels::FNotifyMatchmakerPlayerLeftRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FNotifyMatchmakerPlayerLeftResult, FNotifyMatchmakerPlayerLeftDelegate>([this, &request, &Handle](const FNotifyMatchmakerPlayerLeftDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::NotifyMatchmakerPlayerLeft(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnNotifyMatchmakerPlayerLeftResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FNotifyMatchmakerPlayerLeftDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FNotifyMatchmakerPlayerLeftResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FNotifyMatchmakerPlayerLeftResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FNotifyMatchmakerPlayerLeftResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::RedeemCoupon(
     ServerModels::FRedeemCouponRequest& request,
     const FRedeemCouponDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2514,29 +2775,32 @@ bool UPlayFabServerAPI::RedeemCoupon(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RedeemCoupon"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RedeemCoupon"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnRedeemCouponResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRedeemCouponResult>> UPlayFabServerAPI::RedeemCouponAsync(ServerModels::FRedeemCouponRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRedeemCouponResult, FRedeemCouponDelegate>([this, &request, &Handle](const FRedeemCouponDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::RedeemCoupon(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnRedeemCouponResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemCouponDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRedeemCouponResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRedeemCouponResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRedeemCouponResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::RedeemMatchmakerTicket(
     ServerModels::FRedeemMatchmakerTicketRequest& request,
     const FRedeemMatchmakerTicketDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2544,29 +2808,32 @@ bool UPlayFabServerAPI::RedeemMatchmakerTicket(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RedeemMatchmakerTicket"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RedeemMatchmakerTicket"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnRedeemMatchmakerTicketResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRedeemMatchmakerTicketResult>> UPlayFabServerAPI::RedeemMatchmakerTicketAsync(ServerModels::FRedeemMatchmakerTicketRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRedeemMatchmakerTicketResult, FRedeemMatchmakerTicketDelegate>([this, &request, &Handle](const FRedeemMatchmakerTicketDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::RedeemMatchmakerTicket(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnRedeemMatchmakerTicketResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRedeemMatchmakerTicketDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRedeemMatchmakerTicketResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRedeemMatchmakerTicketResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRedeemMatchmakerTicketResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::RefreshGameServerInstanceHeartbeat(
     ServerModels::FRefreshGameServerInstanceHeartbeatRequest& request,
     const FRefreshGameServerInstanceHeartbeatDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2574,29 +2841,32 @@ bool UPlayFabServerAPI::RefreshGameServerInstanceHeartbeat(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RefreshGameServerInstanceHeartbeat"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RefreshGameServerInstanceHeartbeat"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnRefreshGameServerInstanceHeartbeatResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRefreshGameServerInstanceHeartbeatResult>> UPlayFabServerAPI::RefreshGameServerInstanceHeartbeatAsync(ServerModels::FRefreshGameServerInstanceHeartbeatRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRefreshGameServerInstanceHeartbeatResult, FRefreshGameServerInstanceHeartbeatDelegate>([this, &request, &Handle](const FRefreshGameServerInstanceHeartbeatDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::RefreshGameServerInstanceHeartbeat(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnRefreshGameServerInstanceHeartbeatResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRefreshGameServerInstanceHeartbeatDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRefreshGameServerInstanceHeartbeatResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRefreshGameServerInstanceHeartbeatResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRefreshGameServerInstanceHeartbeatResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::RegisterGame(
     ServerModels::FRegisterGameRequest& request,
     const FRegisterGameDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2604,29 +2874,32 @@ bool UPlayFabServerAPI::RegisterGame(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RegisterGame"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RegisterGame"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnRegisterGameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRegisterGameResponse>> UPlayFabServerAPI::RegisterGameAsync(ServerModels::FRegisterGameRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRegisterGameResponse, FRegisterGameDelegate>([this, &request, &Handle](const FRegisterGameDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::RegisterGame(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnRegisterGameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRegisterGameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRegisterGameResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRegisterGameResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRegisterGameResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::RemoveFriend(
     ServerModels::FRemoveFriendRequest& request,
     const FRemoveFriendDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2634,29 +2907,32 @@ bool UPlayFabServerAPI::RemoveFriend(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RemoveFriend"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RemoveFriend"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnRemoveFriendResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FEmptyResponse>> UPlayFabServerAPI::RemoveFriendAsync(ServerModels::FRemoveFriendRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FEmptyResponse, FRemoveFriendDelegate>([this, &request, &Handle](const FRemoveFriendDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::RemoveFriend(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnRemoveFriendResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveFriendDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::RemoveGenericID(
     ServerModels::FRemoveGenericIDRequest& request,
     const FRemoveGenericIDDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2664,29 +2940,32 @@ bool UPlayFabServerAPI::RemoveGenericID(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RemoveGenericID"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RemoveGenericID"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnRemoveGenericIDResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FEmptyResult>> UPlayFabServerAPI::RemoveGenericIDAsync(ServerModels::FRemoveGenericIDRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FEmptyResult, FRemoveGenericIDDelegate>([this, &request, &Handle](const FRemoveGenericIDDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::RemoveGenericID(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnRemoveGenericIDResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveGenericIDDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FEmptyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FEmptyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FEmptyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::RemovePlayerTag(
     ServerModels::FRemovePlayerTagRequest& request,
     const FRemovePlayerTagDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2694,29 +2973,32 @@ bool UPlayFabServerAPI::RemovePlayerTag(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RemovePlayerTag"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RemovePlayerTag"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnRemovePlayerTagResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRemovePlayerTagResult>> UPlayFabServerAPI::RemovePlayerTagAsync(ServerModels::FRemovePlayerTagRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRemovePlayerTagResult, FRemovePlayerTagDelegate>([this, &request, &Handle](const FRemovePlayerTagDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::RemovePlayerTag(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnRemovePlayerTagResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemovePlayerTagDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRemovePlayerTagResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRemovePlayerTagResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRemovePlayerTagResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::RemoveSharedGroupMembers(
     ServerModels::FRemoveSharedGroupMembersRequest& request,
     const FRemoveSharedGroupMembersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2724,29 +3006,32 @@ bool UPlayFabServerAPI::RemoveSharedGroupMembers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RemoveSharedGroupMembers"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RemoveSharedGroupMembers"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnRemoveSharedGroupMembersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRemoveSharedGroupMembersResult>> UPlayFabServerAPI::RemoveSharedGroupMembersAsync(ServerModels::FRemoveSharedGroupMembersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRemoveSharedGroupMembersResult, FRemoveSharedGroupMembersDelegate>([this, &request, &Handle](const FRemoveSharedGroupMembersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::RemoveSharedGroupMembers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnRemoveSharedGroupMembersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveSharedGroupMembersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRemoveSharedGroupMembersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRemoveSharedGroupMembersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRemoveSharedGroupMembersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::ReportPlayer(
     ServerModels::FReportPlayerServerRequest& request,
     const FReportPlayerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2754,29 +3039,32 @@ bool UPlayFabServerAPI::ReportPlayer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/ReportPlayer"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/ReportPlayer"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnReportPlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FReportPlayerServerResult>> UPlayFabServerAPI::ReportPlayerAsync(ServerModels::FReportPlayerServerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FReportPlayerServerResult, FReportPlayerDelegate>([this, &request, &Handle](const FReportPlayerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::ReportPlayer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnReportPlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FReportPlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FReportPlayerServerResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FReportPlayerServerResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FReportPlayerServerResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::RevokeAllBansForUser(
     ServerModels::FRevokeAllBansForUserRequest& request,
     const FRevokeAllBansForUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2784,29 +3072,32 @@ bool UPlayFabServerAPI::RevokeAllBansForUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RevokeAllBansForUser"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RevokeAllBansForUser"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnRevokeAllBansForUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRevokeAllBansForUserResult>> UPlayFabServerAPI::RevokeAllBansForUserAsync(ServerModels::FRevokeAllBansForUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRevokeAllBansForUserResult, FRevokeAllBansForUserDelegate>([this, &request, &Handle](const FRevokeAllBansForUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::RevokeAllBansForUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnRevokeAllBansForUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeAllBansForUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRevokeAllBansForUserResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRevokeAllBansForUserResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRevokeAllBansForUserResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::RevokeBans(
     ServerModels::FRevokeBansRequest& request,
     const FRevokeBansDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2814,29 +3105,32 @@ bool UPlayFabServerAPI::RevokeBans(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RevokeBans"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RevokeBans"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnRevokeBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRevokeBansResult>> UPlayFabServerAPI::RevokeBansAsync(ServerModels::FRevokeBansRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRevokeBansResult, FRevokeBansDelegate>([this, &request, &Handle](const FRevokeBansDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::RevokeBans(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnRevokeBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRevokeBansResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRevokeBansResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRevokeBansResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::RevokeInventoryItem(
     ServerModels::FRevokeInventoryItemRequest& request,
     const FRevokeInventoryItemDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2844,29 +3138,32 @@ bool UPlayFabServerAPI::RevokeInventoryItem(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RevokeInventoryItem"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RevokeInventoryItem"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnRevokeInventoryItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRevokeInventoryResult>> UPlayFabServerAPI::RevokeInventoryItemAsync(ServerModels::FRevokeInventoryItemRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRevokeInventoryResult, FRevokeInventoryItemDelegate>([this, &request, &Handle](const FRevokeInventoryItemDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::RevokeInventoryItem(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnRevokeInventoryItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeInventoryItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRevokeInventoryResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRevokeInventoryResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRevokeInventoryResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::RevokeInventoryItems(
     ServerModels::FRevokeInventoryItemsRequest& request,
     const FRevokeInventoryItemsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2874,29 +3171,32 @@ bool UPlayFabServerAPI::RevokeInventoryItems(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RevokeInventoryItems"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/RevokeInventoryItems"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnRevokeInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FRevokeInventoryItemsResult>> UPlayFabServerAPI::RevokeInventoryItemsAsync(ServerModels::FRevokeInventoryItemsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FRevokeInventoryItemsResult, FRevokeInventoryItemsDelegate>([this, &request, &Handle](const FRevokeInventoryItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::RevokeInventoryItems(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnRevokeInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FRevokeInventoryItemsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FRevokeInventoryItemsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FRevokeInventoryItemsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::SavePushNotificationTemplate(
     ServerModels::FSavePushNotificationTemplateRequest& request,
     const FSavePushNotificationTemplateDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2904,29 +3204,32 @@ bool UPlayFabServerAPI::SavePushNotificationTemplate(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SavePushNotificationTemplate"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SavePushNotificationTemplate"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnSavePushNotificationTemplateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSavePushNotificationTemplateResult>> UPlayFabServerAPI::SavePushNotificationTemplateAsync(ServerModels::FSavePushNotificationTemplateRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSavePushNotificationTemplateResult, FSavePushNotificationTemplateDelegate>([this, &request, &Handle](const FSavePushNotificationTemplateDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::SavePushNotificationTemplate(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnSavePushNotificationTemplateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSavePushNotificationTemplateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSavePushNotificationTemplateResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSavePushNotificationTemplateResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSavePushNotificationTemplateResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::SendCustomAccountRecoveryEmail(
     ServerModels::FSendCustomAccountRecoveryEmailRequest& request,
     const FSendCustomAccountRecoveryEmailDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2934,29 +3237,32 @@ bool UPlayFabServerAPI::SendCustomAccountRecoveryEmail(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SendCustomAccountRecoveryEmail"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SendCustomAccountRecoveryEmail"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnSendCustomAccountRecoveryEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSendCustomAccountRecoveryEmailResult>> UPlayFabServerAPI::SendCustomAccountRecoveryEmailAsync(ServerModels::FSendCustomAccountRecoveryEmailRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSendCustomAccountRecoveryEmailResult, FSendCustomAccountRecoveryEmailDelegate>([this, &request, &Handle](const FSendCustomAccountRecoveryEmailDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::SendCustomAccountRecoveryEmail(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnSendCustomAccountRecoveryEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendCustomAccountRecoveryEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSendCustomAccountRecoveryEmailResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSendCustomAccountRecoveryEmailResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSendCustomAccountRecoveryEmailResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::SendEmailFromTemplate(
     ServerModels::FSendEmailFromTemplateRequest& request,
     const FSendEmailFromTemplateDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2964,29 +3270,32 @@ bool UPlayFabServerAPI::SendEmailFromTemplate(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SendEmailFromTemplate"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SendEmailFromTemplate"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnSendEmailFromTemplateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSendEmailFromTemplateResult>> UPlayFabServerAPI::SendEmailFromTemplateAsync(ServerModels::FSendEmailFromTemplateRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSendEmailFromTemplateResult, FSendEmailFromTemplateDelegate>([this, &request, &Handle](const FSendEmailFromTemplateDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::SendEmailFromTemplate(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnSendEmailFromTemplateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendEmailFromTemplateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSendEmailFromTemplateResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSendEmailFromTemplateResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSendEmailFromTemplateResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::SendPushNotification(
     ServerModels::FSendPushNotificationRequest& request,
     const FSendPushNotificationDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -2994,29 +3303,32 @@ bool UPlayFabServerAPI::SendPushNotification(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SendPushNotification"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SendPushNotification"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnSendPushNotificationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSendPushNotificationResult>> UPlayFabServerAPI::SendPushNotificationAsync(ServerModels::FSendPushNotificationRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSendPushNotificationResult, FSendPushNotificationDelegate>([this, &request, &Handle](const FSendPushNotificationDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::SendPushNotification(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnSendPushNotificationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendPushNotificationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSendPushNotificationResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSendPushNotificationResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSendPushNotificationResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::SendPushNotificationFromTemplate(
     ServerModels::FSendPushNotificationFromTemplateRequest& request,
     const FSendPushNotificationFromTemplateDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3024,29 +3336,32 @@ bool UPlayFabServerAPI::SendPushNotificationFromTemplate(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SendPushNotificationFromTemplate"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SendPushNotificationFromTemplate"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnSendPushNotificationFromTemplateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSendPushNotificationResult>> UPlayFabServerAPI::SendPushNotificationFromTemplateAsync(ServerModels::FSendPushNotificationFromTemplateRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSendPushNotificationResult, FSendPushNotificationFromTemplateDelegate>([this, &request, &Handle](const FSendPushNotificationFromTemplateDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::SendPushNotificationFromTemplate(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnSendPushNotificationFromTemplateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendPushNotificationFromTemplateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSendPushNotificationResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSendPushNotificationResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSendPushNotificationResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::SetFriendTags(
     ServerModels::FSetFriendTagsRequest& request,
     const FSetFriendTagsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3054,29 +3369,32 @@ bool UPlayFabServerAPI::SetFriendTags(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SetFriendTags"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SetFriendTags"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnSetFriendTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FEmptyResponse>> UPlayFabServerAPI::SetFriendTagsAsync(ServerModels::FSetFriendTagsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FEmptyResponse, FSetFriendTagsDelegate>([this, &request, &Handle](const FSetFriendTagsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::SetFriendTags(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnSetFriendTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetFriendTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::SetGameServerInstanceData(
     ServerModels::FSetGameServerInstanceDataRequest& request,
     const FSetGameServerInstanceDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3084,29 +3402,32 @@ bool UPlayFabServerAPI::SetGameServerInstanceData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SetGameServerInstanceData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SetGameServerInstanceData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnSetGameServerInstanceDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSetGameServerInstanceDataResult>> UPlayFabServerAPI::SetGameServerInstanceDataAsync(ServerModels::FSetGameServerInstanceDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSetGameServerInstanceDataResult, FSetGameServerInstanceDataDelegate>([this, &request, &Handle](const FSetGameServerInstanceDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::SetGameServerInstanceData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnSetGameServerInstanceDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetGameServerInstanceDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSetGameServerInstanceDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSetGameServerInstanceDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSetGameServerInstanceDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::SetGameServerInstanceState(
     ServerModels::FSetGameServerInstanceStateRequest& request,
     const FSetGameServerInstanceStateDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3114,29 +3435,32 @@ bool UPlayFabServerAPI::SetGameServerInstanceState(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SetGameServerInstanceState"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SetGameServerInstanceState"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnSetGameServerInstanceStateResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSetGameServerInstanceStateResult>> UPlayFabServerAPI::SetGameServerInstanceStateAsync(ServerModels::FSetGameServerInstanceStateRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSetGameServerInstanceStateResult, FSetGameServerInstanceStateDelegate>([this, &request, &Handle](const FSetGameServerInstanceStateDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::SetGameServerInstanceState(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnSetGameServerInstanceStateResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetGameServerInstanceStateDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSetGameServerInstanceStateResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSetGameServerInstanceStateResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSetGameServerInstanceStateResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::SetGameServerInstanceTags(
     ServerModels::FSetGameServerInstanceTagsRequest& request,
     const FSetGameServerInstanceTagsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3144,29 +3468,32 @@ bool UPlayFabServerAPI::SetGameServerInstanceTags(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SetGameServerInstanceTags"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SetGameServerInstanceTags"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnSetGameServerInstanceTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSetGameServerInstanceTagsResult>> UPlayFabServerAPI::SetGameServerInstanceTagsAsync(ServerModels::FSetGameServerInstanceTagsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSetGameServerInstanceTagsResult, FSetGameServerInstanceTagsDelegate>([this, &request, &Handle](const FSetGameServerInstanceTagsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::SetGameServerInstanceTags(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnSetGameServerInstanceTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetGameServerInstanceTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSetGameServerInstanceTagsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSetGameServerInstanceTagsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSetGameServerInstanceTagsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::SetPlayerSecret(
     ServerModels::FSetPlayerSecretRequest& request,
     const FSetPlayerSecretDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3174,29 +3501,32 @@ bool UPlayFabServerAPI::SetPlayerSecret(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SetPlayerSecret"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SetPlayerSecret"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnSetPlayerSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSetPlayerSecretResult>> UPlayFabServerAPI::SetPlayerSecretAsync(ServerModels::FSetPlayerSecretRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSetPlayerSecretResult, FSetPlayerSecretDelegate>([this, &request, &Handle](const FSetPlayerSecretDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::SetPlayerSecret(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnSetPlayerSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPlayerSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSetPlayerSecretResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSetPlayerSecretResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSetPlayerSecretResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::SetPublisherData(
     ServerModels::FSetPublisherDataRequest& request,
     const FSetPublisherDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3204,29 +3534,32 @@ bool UPlayFabServerAPI::SetPublisherData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SetPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SetPublisherData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnSetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSetPublisherDataResult>> UPlayFabServerAPI::SetPublisherDataAsync(ServerModels::FSetPublisherDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSetPublisherDataResult, FSetPublisherDataDelegate>([this, &request, &Handle](const FSetPublisherDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::SetPublisherData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnSetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSetPublisherDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSetPublisherDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSetPublisherDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::SetTitleData(
     ServerModels::FSetTitleDataRequest& request,
     const FSetTitleDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3234,29 +3567,32 @@ bool UPlayFabServerAPI::SetTitleData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SetTitleData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SetTitleData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnSetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSetTitleDataResult>> UPlayFabServerAPI::SetTitleDataAsync(ServerModels::FSetTitleDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSetTitleDataResult, FSetTitleDataDelegate>([this, &request, &Handle](const FSetTitleDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::SetTitleData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnSetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSetTitleDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSetTitleDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSetTitleDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::SetTitleInternalData(
     ServerModels::FSetTitleDataRequest& request,
     const FSetTitleInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3264,29 +3600,32 @@ bool UPlayFabServerAPI::SetTitleInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SetTitleInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SetTitleInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnSetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FSetTitleDataResult>> UPlayFabServerAPI::SetTitleInternalDataAsync(ServerModels::FSetTitleDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FSetTitleDataResult, FSetTitleInternalDataDelegate>([this, &request, &Handle](const FSetTitleInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::SetTitleInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnSetTitleInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FSetTitleDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FSetTitleDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FSetTitleDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::SubtractCharacterVirtualCurrency(
     ServerModels::FSubtractCharacterVirtualCurrencyRequest& request,
     const FSubtractCharacterVirtualCurrencyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3294,29 +3633,32 @@ bool UPlayFabServerAPI::SubtractCharacterVirtualCurrency(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SubtractCharacterVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SubtractCharacterVirtualCurrency"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnSubtractCharacterVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FModifyCharacterVirtualCurrencyResult>> UPlayFabServerAPI::SubtractCharacterVirtualCurrencyAsync(ServerModels::FSubtractCharacterVirtualCurrencyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FModifyCharacterVirtualCurrencyResult, FSubtractCharacterVirtualCurrencyDelegate>([this, &request, &Handle](const FSubtractCharacterVirtualCurrencyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::SubtractCharacterVirtualCurrency(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnSubtractCharacterVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubtractCharacterVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FModifyCharacterVirtualCurrencyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FModifyCharacterVirtualCurrencyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FModifyCharacterVirtualCurrencyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::SubtractUserVirtualCurrency(
     ServerModels::FSubtractUserVirtualCurrencyRequest& request,
     const FSubtractUserVirtualCurrencyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3324,29 +3666,32 @@ bool UPlayFabServerAPI::SubtractUserVirtualCurrency(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SubtractUserVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/SubtractUserVirtualCurrency"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnSubtractUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FModifyUserVirtualCurrencyResult>> UPlayFabServerAPI::SubtractUserVirtualCurrencyAsync(ServerModels::FSubtractUserVirtualCurrencyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FModifyUserVirtualCurrencyResult, FSubtractUserVirtualCurrencyDelegate>([this, &request, &Handle](const FSubtractUserVirtualCurrencyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::SubtractUserVirtualCurrency(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnSubtractUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubtractUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FModifyUserVirtualCurrencyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FModifyUserVirtualCurrencyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FModifyUserVirtualCurrencyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UnlinkPSNAccount(
     ServerModels::FUnlinkPSNAccountRequest& request,
     const FUnlinkPSNAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3354,29 +3699,32 @@ bool UPlayFabServerAPI::UnlinkPSNAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UnlinkPSNAccount"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UnlinkPSNAccount"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUnlinkPSNAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUnlinkPSNAccountResult>> UPlayFabServerAPI::UnlinkPSNAccountAsync(ServerModels::FUnlinkPSNAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUnlinkPSNAccountResult, FUnlinkPSNAccountDelegate>([this, &request, &Handle](const FUnlinkPSNAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UnlinkPSNAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUnlinkPSNAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkPSNAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUnlinkPSNAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUnlinkPSNAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUnlinkPSNAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UnlinkServerCustomId(
     ServerModels::FUnlinkServerCustomIdRequest& request,
     const FUnlinkServerCustomIdDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3384,29 +3732,32 @@ bool UPlayFabServerAPI::UnlinkServerCustomId(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UnlinkServerCustomId"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UnlinkServerCustomId"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUnlinkServerCustomIdResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUnlinkServerCustomIdResult>> UPlayFabServerAPI::UnlinkServerCustomIdAsync(ServerModels::FUnlinkServerCustomIdRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUnlinkServerCustomIdResult, FUnlinkServerCustomIdDelegate>([this, &request, &Handle](const FUnlinkServerCustomIdDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UnlinkServerCustomId(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUnlinkServerCustomIdResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkServerCustomIdDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUnlinkServerCustomIdResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUnlinkServerCustomIdResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUnlinkServerCustomIdResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UnlinkXboxAccount(
     ServerModels::FUnlinkXboxAccountRequest& request,
     const FUnlinkXboxAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3414,29 +3765,32 @@ bool UPlayFabServerAPI::UnlinkXboxAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UnlinkXboxAccount"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UnlinkXboxAccount"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUnlinkXboxAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUnlinkXboxAccountResult>> UPlayFabServerAPI::UnlinkXboxAccountAsync(ServerModels::FUnlinkXboxAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUnlinkXboxAccountResult, FUnlinkXboxAccountDelegate>([this, &request, &Handle](const FUnlinkXboxAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UnlinkXboxAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUnlinkXboxAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlinkXboxAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUnlinkXboxAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUnlinkXboxAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUnlinkXboxAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UnlockContainerInstance(
     ServerModels::FUnlockContainerInstanceRequest& request,
     const FUnlockContainerInstanceDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3444,29 +3798,32 @@ bool UPlayFabServerAPI::UnlockContainerInstance(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UnlockContainerInstance"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UnlockContainerInstance"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUnlockContainerInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUnlockContainerItemResult>> UPlayFabServerAPI::UnlockContainerInstanceAsync(ServerModels::FUnlockContainerInstanceRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUnlockContainerItemResult, FUnlockContainerInstanceDelegate>([this, &request, &Handle](const FUnlockContainerInstanceDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UnlockContainerInstance(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUnlockContainerInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlockContainerInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUnlockContainerItemResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUnlockContainerItemResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUnlockContainerItemResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UnlockContainerItem(
     ServerModels::FUnlockContainerItemRequest& request,
     const FUnlockContainerItemDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3474,29 +3831,32 @@ bool UPlayFabServerAPI::UnlockContainerItem(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UnlockContainerItem"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UnlockContainerItem"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUnlockContainerItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUnlockContainerItemResult>> UPlayFabServerAPI::UnlockContainerItemAsync(ServerModels::FUnlockContainerItemRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUnlockContainerItemResult, FUnlockContainerItemDelegate>([this, &request, &Handle](const FUnlockContainerItemDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UnlockContainerItem(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUnlockContainerItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUnlockContainerItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUnlockContainerItemResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUnlockContainerItemResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUnlockContainerItemResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UpdateAvatarUrl(
     ServerModels::FUpdateAvatarUrlRequest& request,
     const FUpdateAvatarUrlDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3504,29 +3864,32 @@ bool UPlayFabServerAPI::UpdateAvatarUrl(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateAvatarUrl"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateAvatarUrl"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUpdateAvatarUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FEmptyResponse>> UPlayFabServerAPI::UpdateAvatarUrlAsync(ServerModels::FUpdateAvatarUrlRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FEmptyResponse, FUpdateAvatarUrlDelegate>([this, &request, &Handle](const FUpdateAvatarUrlDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UpdateAvatarUrl(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUpdateAvatarUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateAvatarUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UpdateBans(
     ServerModels::FUpdateBansRequest& request,
     const FUpdateBansDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3534,29 +3897,32 @@ bool UPlayFabServerAPI::UpdateBans(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateBans"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateBans"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUpdateBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateBansResult>> UPlayFabServerAPI::UpdateBansAsync(ServerModels::FUpdateBansRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateBansResult, FUpdateBansDelegate>([this, &request, &Handle](const FUpdateBansDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UpdateBans(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUpdateBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateBansResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateBansResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateBansResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UpdateCharacterData(
     ServerModels::FUpdateCharacterDataRequest& request,
     const FUpdateCharacterDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3564,29 +3930,32 @@ bool UPlayFabServerAPI::UpdateCharacterData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateCharacterData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateCharacterData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUpdateCharacterDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateCharacterDataResult>> UPlayFabServerAPI::UpdateCharacterDataAsync(ServerModels::FUpdateCharacterDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateCharacterDataResult, FUpdateCharacterDataDelegate>([this, &request, &Handle](const FUpdateCharacterDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UpdateCharacterData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUpdateCharacterDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateCharacterDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateCharacterDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateCharacterDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UpdateCharacterInternalData(
     ServerModels::FUpdateCharacterDataRequest& request,
     const FUpdateCharacterInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3594,29 +3963,32 @@ bool UPlayFabServerAPI::UpdateCharacterInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateCharacterInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateCharacterInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUpdateCharacterInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateCharacterDataResult>> UPlayFabServerAPI::UpdateCharacterInternalDataAsync(ServerModels::FUpdateCharacterDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateCharacterDataResult, FUpdateCharacterInternalDataDelegate>([this, &request, &Handle](const FUpdateCharacterInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UpdateCharacterInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUpdateCharacterInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateCharacterDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateCharacterDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateCharacterDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UpdateCharacterReadOnlyData(
     ServerModels::FUpdateCharacterDataRequest& request,
     const FUpdateCharacterReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3624,29 +3996,32 @@ bool UPlayFabServerAPI::UpdateCharacterReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateCharacterReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateCharacterReadOnlyData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUpdateCharacterReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateCharacterDataResult>> UPlayFabServerAPI::UpdateCharacterReadOnlyDataAsync(ServerModels::FUpdateCharacterDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateCharacterDataResult, FUpdateCharacterReadOnlyDataDelegate>([this, &request, &Handle](const FUpdateCharacterReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UpdateCharacterReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUpdateCharacterReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateCharacterDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateCharacterDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateCharacterDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UpdateCharacterStatistics(
     ServerModels::FUpdateCharacterStatisticsRequest& request,
     const FUpdateCharacterStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3654,29 +4029,32 @@ bool UPlayFabServerAPI::UpdateCharacterStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateCharacterStatistics"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateCharacterStatistics"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUpdateCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateCharacterStatisticsResult>> UPlayFabServerAPI::UpdateCharacterStatisticsAsync(ServerModels::FUpdateCharacterStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateCharacterStatisticsResult, FUpdateCharacterStatisticsDelegate>([this, &request, &Handle](const FUpdateCharacterStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UpdateCharacterStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUpdateCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateCharacterStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateCharacterStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateCharacterStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UpdatePlayerStatistics(
     ServerModels::FUpdatePlayerStatisticsRequest& request,
     const FUpdatePlayerStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3684,29 +4062,32 @@ bool UPlayFabServerAPI::UpdatePlayerStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdatePlayerStatistics"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdatePlayerStatistics"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUpdatePlayerStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdatePlayerStatisticsResult>> UPlayFabServerAPI::UpdatePlayerStatisticsAsync(ServerModels::FUpdatePlayerStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdatePlayerStatisticsResult, FUpdatePlayerStatisticsDelegate>([this, &request, &Handle](const FUpdatePlayerStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UpdatePlayerStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUpdatePlayerStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdatePlayerStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdatePlayerStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdatePlayerStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UpdateSharedGroupData(
     ServerModels::FUpdateSharedGroupDataRequest& request,
     const FUpdateSharedGroupDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3714,29 +4095,32 @@ bool UPlayFabServerAPI::UpdateSharedGroupData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateSharedGroupData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateSharedGroupData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUpdateSharedGroupDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateSharedGroupDataResult>> UPlayFabServerAPI::UpdateSharedGroupDataAsync(ServerModels::FUpdateSharedGroupDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateSharedGroupDataResult, FUpdateSharedGroupDataDelegate>([this, &request, &Handle](const FUpdateSharedGroupDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UpdateSharedGroupData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUpdateSharedGroupDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateSharedGroupDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateSharedGroupDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateSharedGroupDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateSharedGroupDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UpdateUserData(
     ServerModels::FUpdateUserDataRequest& request,
     const FUpdateUserDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3744,29 +4128,32 @@ bool UPlayFabServerAPI::UpdateUserData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateUserData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateUserData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUpdateUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateUserDataResult>> UPlayFabServerAPI::UpdateUserDataAsync(ServerModels::FUpdateUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateUserDataResult, FUpdateUserDataDelegate>([this, &request, &Handle](const FUpdateUserDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UpdateUserData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUpdateUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UpdateUserInternalData(
     ServerModels::FUpdateUserInternalDataRequest& request,
     const FUpdateUserInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3774,29 +4161,32 @@ bool UPlayFabServerAPI::UpdateUserInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateUserInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateUserInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUpdateUserInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateUserDataResult>> UPlayFabServerAPI::UpdateUserInternalDataAsync(ServerModels::FUpdateUserInternalDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateUserDataResult, FUpdateUserInternalDataDelegate>([this, &request, &Handle](const FUpdateUserInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UpdateUserInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUpdateUserInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UpdateUserInventoryItemCustomData(
     ServerModels::FUpdateUserInventoryItemDataRequest& request,
     const FUpdateUserInventoryItemCustomDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3804,29 +4194,32 @@ bool UPlayFabServerAPI::UpdateUserInventoryItemCustomData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateUserInventoryItemCustomData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateUserInventoryItemCustomData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUpdateUserInventoryItemCustomDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FEmptyResponse>> UPlayFabServerAPI::UpdateUserInventoryItemCustomDataAsync(ServerModels::FUpdateUserInventoryItemDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FEmptyResponse, FUpdateUserInventoryItemCustomDataDelegate>([this, &request, &Handle](const FUpdateUserInventoryItemCustomDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UpdateUserInventoryItemCustomData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUpdateUserInventoryItemCustomDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserInventoryItemCustomDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UpdateUserPublisherData(
     ServerModels::FUpdateUserDataRequest& request,
     const FUpdateUserPublisherDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3834,29 +4227,32 @@ bool UPlayFabServerAPI::UpdateUserPublisherData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateUserPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateUserPublisherData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUpdateUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateUserDataResult>> UPlayFabServerAPI::UpdateUserPublisherDataAsync(ServerModels::FUpdateUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateUserDataResult, FUpdateUserPublisherDataDelegate>([this, &request, &Handle](const FUpdateUserPublisherDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UpdateUserPublisherData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUpdateUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UpdateUserPublisherInternalData(
     ServerModels::FUpdateUserInternalDataRequest& request,
     const FUpdateUserPublisherInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3864,29 +4260,32 @@ bool UPlayFabServerAPI::UpdateUserPublisherInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateUserPublisherInternalData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateUserPublisherInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUpdateUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateUserDataResult>> UPlayFabServerAPI::UpdateUserPublisherInternalDataAsync(ServerModels::FUpdateUserInternalDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateUserDataResult, FUpdateUserPublisherInternalDataDelegate>([this, &request, &Handle](const FUpdateUserPublisherInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UpdateUserPublisherInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUpdateUserPublisherInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UpdateUserPublisherReadOnlyData(
     ServerModels::FUpdateUserDataRequest& request,
     const FUpdateUserPublisherReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3894,29 +4293,32 @@ bool UPlayFabServerAPI::UpdateUserPublisherReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateUserPublisherReadOnlyData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUpdateUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateUserDataResult>> UPlayFabServerAPI::UpdateUserPublisherReadOnlyDataAsync(ServerModels::FUpdateUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateUserDataResult, FUpdateUserPublisherReadOnlyDataDelegate>([this, &request, &Handle](const FUpdateUserPublisherReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UpdateUserPublisherReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUpdateUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::UpdateUserReadOnlyData(
     ServerModels::FUpdateUserDataRequest& request,
     const FUpdateUserReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3924,29 +4326,32 @@ bool UPlayFabServerAPI::UpdateUserReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateUserReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/UpdateUserReadOnlyData"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnUpdateUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FUpdateUserDataResult>> UPlayFabServerAPI::UpdateUserReadOnlyDataAsync(ServerModels::FUpdateUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FUpdateUserDataResult, FUpdateUserReadOnlyDataDelegate>([this, &request, &Handle](const FUpdateUserReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::UpdateUserReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnUpdateUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::WriteCharacterEvent(
     ServerModels::FWriteServerCharacterEventRequest& request,
     const FWriteCharacterEventDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3954,29 +4359,32 @@ bool UPlayFabServerAPI::WriteCharacterEvent(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/WriteCharacterEvent"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/WriteCharacterEvent"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnWriteCharacterEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Low, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FWriteEventResponse>> UPlayFabServerAPI::WriteCharacterEventAsync(ServerModels::FWriteServerCharacterEventRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FWriteEventResponse, FWriteCharacterEventDelegate>([this, &request, &Handle](const FWriteCharacterEventDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::WriteCharacterEvent(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnWriteCharacterEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteCharacterEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FWriteEventResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FWriteEventResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FWriteEventResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::WritePlayerEvent(
     ServerModels::FWriteServerPlayerEventRequest& request,
     const FWritePlayerEventDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -3984,29 +4392,32 @@ bool UPlayFabServerAPI::WritePlayerEvent(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/WritePlayerEvent"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/WritePlayerEvent"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnWritePlayerEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Low, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FWriteEventResponse>> UPlayFabServerAPI::WritePlayerEventAsync(ServerModels::FWriteServerPlayerEventRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FWriteEventResponse, FWritePlayerEventDelegate>([this, &request, &Handle](const FWritePlayerEventDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::WritePlayerEvent(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnWritePlayerEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWritePlayerEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FWriteEventResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FWriteEventResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FWriteEventResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabServerAPI::WriteTitleEvent(
     ServerModels::FWriteTitleEventRequest& request,
     const FWriteTitleEventDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -4014,21 +4425,23 @@ bool UPlayFabServerAPI::WriteTitleEvent(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/WriteTitleEvent"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Server/WriteTitleEvent"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabServerAPI::OnWriteTitleEventResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Low, Handle);
+}
+
+TFuture<TPlayFabResult<ServerModels::FWriteEventResponse>> UPlayFabServerAPI::WriteTitleEventAsync(ServerModels::FWriteTitleEventRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ServerModels::FWriteEventResponse, FWriteTitleEventDelegate>([this, &request, &Handle](const FWriteTitleEventDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabServerAPI::WriteTitleEvent(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabServerAPI::OnWriteTitleEventResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FWriteTitleEventDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ServerModels::FWriteEventResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ServerModels::FWriteEventResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ServerModels::FWriteEventResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
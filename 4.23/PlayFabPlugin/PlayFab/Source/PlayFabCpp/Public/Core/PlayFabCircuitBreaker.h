@@ -0,0 +1,41 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PlayFab
+{
+    enum class EPlayFabCircuitState : uint8
+    {
+        // Calls are sent, and their outcomes counted
+        Closed,
+        // Calls fail at once with PlayFabErrorCircuitOpen
+        Open,
+        // One probe call is sent; its outcome closes or reopens the circuit
+        HalfOpen
+    };
+
+    /**
+     * Fails calls fast while an API family ("Client", "Server", "Multiplayer", ...) is failing, instead of letting every call wait for its timeout.
+     * A family's circuit opens once enough of its recent calls timed out or hit a server error, see UPlayFabRuntimeSettings::CircuitBreakerFailureRate.
+     * After CircuitBreakerOpenSeconds it lets a single probe through, and closes again if the probe succeeds.
+     */
+    class PLAYFABCPP_API FPlayFabCircuitBreaker
+    {
+    public:
+        // False if the call must fail fast; true lets it be sent, as the probe if the circuit is half-open
+        // OutProbeId identifies the probe, to be passed back to OnResult with its outcome; it is 0 for any other call
+        static bool TryAcquire(const FString& RequestUrl, uint64& OutProbeId);
+        // Outcome of every attempt that got an answer or timed out; throttling isn't a failure, the request governor deals with it
+        // Only the probe's outcome closes or reopens a half-open circuit; late outcomes of calls sent before it opened are only counted
+        static void OnResult(const FString& RequestUrl, bool bFailed, uint64 ProbeId = 0);
+
+        static EPlayFabCircuitState GetState(const FString& ApiName);
+        // Calls that failed fast since startup
+        static int32 GetRejectedCount();
+    };
+}
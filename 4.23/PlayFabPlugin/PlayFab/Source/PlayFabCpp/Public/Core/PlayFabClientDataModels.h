@@ -41,6 +41,16 @@ namespace ClientModels
             TradeId(src.TradeId)
             {}
 
+        FAcceptTradeRequest(FAcceptTradeRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AcceptedInventoryInstanceIds(MoveTemp(src.AcceptedInventoryInstanceIds)),
+            OfferingPlayerId(MoveTemp(src.OfferingPlayerId)),
+            TradeId(MoveTemp(src.TradeId))
+            {}
+
+        FAcceptTradeRequest& operator=(const FAcceptTradeRequest& src) = default;
+        FAcceptTradeRequest& operator=(FAcceptTradeRequest&& src) = default;
+
         FAcceptTradeRequest(const TSharedPtr<FJsonObject>& obj) : FAcceptTradeRequest()
         {
             readFromValue(obj);
@@ -49,7 +59,13 @@ namespace ClientModels
         ~FAcceptTradeRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum TradeStatus
@@ -64,6 +80,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeTradeStatusEnumJSON(TradeStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeTradeStatusEnumJSON(TradeStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API TradeStatus readTradeStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API TradeStatus readTradeStatusFromValue(const FString& value);
 
@@ -137,6 +154,26 @@ namespace ClientModels
             TradeId(src.TradeId)
             {}
 
+        FTradeInfo(FTradeInfo&& src) :
+            FPlayFabCppBaseModel(),
+            AcceptedInventoryInstanceIds(MoveTemp(src.AcceptedInventoryInstanceIds)),
+            AcceptedPlayerId(MoveTemp(src.AcceptedPlayerId)),
+            AllowedPlayerIds(MoveTemp(src.AllowedPlayerIds)),
+            CancelledAt(MoveTemp(src.CancelledAt)),
+            FilledAt(MoveTemp(src.FilledAt)),
+            InvalidatedAt(MoveTemp(src.InvalidatedAt)),
+            OfferedCatalogItemIds(MoveTemp(src.OfferedCatalogItemIds)),
+            OfferedInventoryInstanceIds(MoveTemp(src.OfferedInventoryInstanceIds)),
+            OfferingPlayerId(MoveTemp(src.OfferingPlayerId)),
+            OpenedAt(MoveTemp(src.OpenedAt)),
+            RequestedCatalogItemIds(MoveTemp(src.RequestedCatalogItemIds)),
+            Status(MoveTemp(src.Status)),
+            TradeId(MoveTemp(src.TradeId))
+            {}
+
+        FTradeInfo& operator=(const FTradeInfo& src) = default;
+        FTradeInfo& operator=(FTradeInfo&& src) = default;
+
         FTradeInfo(const TSharedPtr<FJsonObject>& obj) : FTradeInfo()
         {
             readFromValue(obj);
@@ -145,7 +182,13 @@ namespace ClientModels
         ~FTradeInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAcceptTradeResponse : public PlayFab::FPlayFabCppResultCommon
@@ -160,9 +203,17 @@ namespace ClientModels
 
         FAcceptTradeResponse(const FAcceptTradeResponse& src) :
             FPlayFabCppResultCommon(),
-            Trade(src.Trade.IsValid() ? MakeShareable(new FTradeInfo(*src.Trade)) : nullptr)
+            Trade(src.Trade.IsValid() ? TSharedPtr<FTradeInfo>(MakeShared<FTradeInfo>(*src.Trade)) : nullptr)
             {}
 
+        FAcceptTradeResponse(FAcceptTradeResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Trade(MoveTemp(src.Trade))
+            {}
+
+        FAcceptTradeResponse& operator=(const FAcceptTradeResponse& src) = default;
+        FAcceptTradeResponse& operator=(FAcceptTradeResponse&& src) = default;
+
         FAcceptTradeResponse(const TSharedPtr<FJsonObject>& obj) : FAcceptTradeResponse()
         {
             readFromValue(obj);
@@ -171,7 +222,13 @@ namespace ClientModels
         ~FAcceptTradeResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum AdActivity
@@ -183,6 +240,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeAdActivityEnumJSON(AdActivity enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeAdActivityEnumJSON(AdActivity enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API AdActivity readAdActivityFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API AdActivity readAdActivityFromValue(const FString& value);
 
@@ -211,6 +269,16 @@ namespace ClientModels
             Platform(src.Platform)
             {}
 
+        FAdCampaignAttributionModel(FAdCampaignAttributionModel&& src) :
+            FPlayFabCppBaseModel(),
+            AttributedAt(MoveTemp(src.AttributedAt)),
+            CampaignId(MoveTemp(src.CampaignId)),
+            Platform(MoveTemp(src.Platform))
+            {}
+
+        FAdCampaignAttributionModel& operator=(const FAdCampaignAttributionModel& src) = default;
+        FAdCampaignAttributionModel& operator=(FAdCampaignAttributionModel&& src) = default;
+
         FAdCampaignAttributionModel(const TSharedPtr<FJsonObject>& obj) : FAdCampaignAttributionModel()
         {
             readFromValue(obj);
@@ -219,7 +287,13 @@ namespace ClientModels
         ~FAdCampaignAttributionModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddFriendRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -252,6 +326,17 @@ namespace ClientModels
             FriendUsername(src.FriendUsername)
             {}
 
+        FAddFriendRequest(FAddFriendRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            FriendEmail(MoveTemp(src.FriendEmail)),
+            FriendPlayFabId(MoveTemp(src.FriendPlayFabId)),
+            FriendTitleDisplayName(MoveTemp(src.FriendTitleDisplayName)),
+            FriendUsername(MoveTemp(src.FriendUsername))
+            {}
+
+        FAddFriendRequest& operator=(const FAddFriendRequest& src) = default;
+        FAddFriendRequest& operator=(FAddFriendRequest&& src) = default;
+
         FAddFriendRequest(const TSharedPtr<FJsonObject>& obj) : FAddFriendRequest()
         {
             readFromValue(obj);
@@ -260,7 +345,13 @@ namespace ClientModels
         ~FAddFriendRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddFriendResult : public PlayFab::FPlayFabCppResultCommon
@@ -278,6 +369,14 @@ namespace ClientModels
             Created(src.Created)
             {}
 
+        FAddFriendResult(FAddFriendResult&& src) :
+            FPlayFabCppResultCommon(),
+            Created(MoveTemp(src.Created))
+            {}
+
+        FAddFriendResult& operator=(const FAddFriendResult& src) = default;
+        FAddFriendResult& operator=(FAddFriendResult&& src) = default;
+
         FAddFriendResult(const TSharedPtr<FJsonObject>& obj) : FAddFriendResult()
         {
             readFromValue(obj);
@@ -286,7 +385,13 @@ namespace ClientModels
         ~FAddFriendResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGenericServiceId : public PlayFab::FPlayFabCppBaseModel
@@ -309,6 +414,15 @@ namespace ClientModels
             UserId(src.UserId)
             {}
 
+        FGenericServiceId(FGenericServiceId&& src) :
+            FPlayFabCppBaseModel(),
+            ServiceName(MoveTemp(src.ServiceName)),
+            UserId(MoveTemp(src.UserId))
+            {}
+
+        FGenericServiceId& operator=(const FGenericServiceId& src) = default;
+        FGenericServiceId& operator=(FGenericServiceId&& src) = default;
+
         FGenericServiceId(const TSharedPtr<FJsonObject>& obj) : FGenericServiceId()
         {
             readFromValue(obj);
@@ -317,7 +431,13 @@ namespace ClientModels
         ~FGenericServiceId();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddGenericIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -335,6 +455,14 @@ namespace ClientModels
             GenericId(src.GenericId)
             {}
 
+        FAddGenericIDRequest(FAddGenericIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            GenericId(MoveTemp(src.GenericId))
+            {}
+
+        FAddGenericIDRequest& operator=(const FAddGenericIDRequest& src) = default;
+        FAddGenericIDRequest& operator=(FAddGenericIDRequest&& src) = default;
+
         FAddGenericIDRequest(const TSharedPtr<FJsonObject>& obj) : FAddGenericIDRequest()
         {
             readFromValue(obj);
@@ -343,7 +471,13 @@ namespace ClientModels
         ~FAddGenericIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddGenericIDResult : public PlayFab::FPlayFabCppResultCommon
@@ -356,6 +490,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FAddGenericIDResult(FAddGenericIDResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FAddGenericIDResult& operator=(const FAddGenericIDResult& src) = default;
+        FAddGenericIDResult& operator=(FAddGenericIDResult&& src) = default;
+
         FAddGenericIDResult(const TSharedPtr<FJsonObject>& obj) : FAddGenericIDResult()
         {
             readFromValue(obj);
@@ -364,7 +505,13 @@ namespace ClientModels
         ~FAddGenericIDResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddOrUpdateContactEmailRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -386,6 +533,15 @@ namespace ClientModels
             EmailAddress(src.EmailAddress)
             {}
 
+        FAddOrUpdateContactEmailRequest(FAddOrUpdateContactEmailRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EmailAddress(MoveTemp(src.EmailAddress))
+            {}
+
+        FAddOrUpdateContactEmailRequest& operator=(const FAddOrUpdateContactEmailRequest& src) = default;
+        FAddOrUpdateContactEmailRequest& operator=(FAddOrUpdateContactEmailRequest&& src) = default;
+
         FAddOrUpdateContactEmailRequest(const TSharedPtr<FJsonObject>& obj) : FAddOrUpdateContactEmailRequest()
         {
             readFromValue(obj);
@@ -394,7 +550,13 @@ namespace ClientModels
         ~FAddOrUpdateContactEmailRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddOrUpdateContactEmailResult : public PlayFab::FPlayFabCppResultCommon
@@ -407,6 +569,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FAddOrUpdateContactEmailResult(FAddOrUpdateContactEmailResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FAddOrUpdateContactEmailResult& operator=(const FAddOrUpdateContactEmailResult& src) = default;
+        FAddOrUpdateContactEmailResult& operator=(FAddOrUpdateContactEmailResult&& src) = default;
+
         FAddOrUpdateContactEmailResult(const TSharedPtr<FJsonObject>& obj) : FAddOrUpdateContactEmailResult()
         {
             readFromValue(obj);
@@ -415,7 +584,13 @@ namespace ClientModels
         ~FAddOrUpdateContactEmailResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddSharedGroupMembersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -437,6 +612,15 @@ namespace ClientModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FAddSharedGroupMembersRequest(FAddSharedGroupMembersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabIds(MoveTemp(src.PlayFabIds)),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FAddSharedGroupMembersRequest& operator=(const FAddSharedGroupMembersRequest& src) = default;
+        FAddSharedGroupMembersRequest& operator=(FAddSharedGroupMembersRequest&& src) = default;
+
         FAddSharedGroupMembersRequest(const TSharedPtr<FJsonObject>& obj) : FAddSharedGroupMembersRequest()
         {
             readFromValue(obj);
@@ -445,7 +629,13 @@ namespace ClientModels
         ~FAddSharedGroupMembersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddSharedGroupMembersResult : public PlayFab::FPlayFabCppResultCommon
@@ -458,6 +648,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FAddSharedGroupMembersResult(FAddSharedGroupMembersResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FAddSharedGroupMembersResult& operator=(const FAddSharedGroupMembersResult& src) = default;
+        FAddSharedGroupMembersResult& operator=(FAddSharedGroupMembersResult&& src) = default;
+
         FAddSharedGroupMembersResult(const TSharedPtr<FJsonObject>& obj) : FAddSharedGroupMembersResult()
         {
             readFromValue(obj);
@@ -466,7 +663,13 @@ namespace ClientModels
         ~FAddSharedGroupMembersResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddUsernamePasswordRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -498,6 +701,17 @@ namespace ClientModels
             Username(src.Username)
             {}
 
+        FAddUsernamePasswordRequest(FAddUsernamePasswordRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Email(MoveTemp(src.Email)),
+            Password(MoveTemp(src.Password)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FAddUsernamePasswordRequest& operator=(const FAddUsernamePasswordRequest& src) = default;
+        FAddUsernamePasswordRequest& operator=(FAddUsernamePasswordRequest&& src) = default;
+
         FAddUsernamePasswordRequest(const TSharedPtr<FJsonObject>& obj) : FAddUsernamePasswordRequest()
         {
             readFromValue(obj);
@@ -506,7 +720,13 @@ namespace ClientModels
         ~FAddUsernamePasswordRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddUsernamePasswordResult : public PlayFab::FPlayFabCppResultCommon
@@ -524,6 +744,14 @@ namespace ClientModels
             Username(src.Username)
             {}
 
+        FAddUsernamePasswordResult(FAddUsernamePasswordResult&& src) :
+            FPlayFabCppResultCommon(),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FAddUsernamePasswordResult& operator=(const FAddUsernamePasswordResult& src) = default;
+        FAddUsernamePasswordResult& operator=(FAddUsernamePasswordResult&& src) = default;
+
         FAddUsernamePasswordResult(const TSharedPtr<FJsonObject>& obj) : FAddUsernamePasswordResult()
         {
             readFromValue(obj);
@@ -532,7 +760,13 @@ namespace ClientModels
         ~FAddUsernamePasswordResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddUserVirtualCurrencyRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -559,6 +793,16 @@ namespace ClientModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FAddUserVirtualCurrencyRequest(FAddUserVirtualCurrencyRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Amount(MoveTemp(src.Amount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FAddUserVirtualCurrencyRequest& operator=(const FAddUserVirtualCurrencyRequest& src) = default;
+        FAddUserVirtualCurrencyRequest& operator=(FAddUserVirtualCurrencyRequest&& src) = default;
+
         FAddUserVirtualCurrencyRequest(const TSharedPtr<FJsonObject>& obj) : FAddUserVirtualCurrencyRequest()
         {
             readFromValue(obj);
@@ -567,7 +811,13 @@ namespace ClientModels
         ~FAddUserVirtualCurrencyRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAdPlacementDetails : public PlayFab::FPlayFabCppBaseModel
@@ -620,6 +870,21 @@ namespace ClientModels
             RewardName(src.RewardName)
             {}
 
+        FAdPlacementDetails(FAdPlacementDetails&& src) :
+            FPlayFabCppBaseModel(),
+            PlacementId(MoveTemp(src.PlacementId)),
+            PlacementName(MoveTemp(src.PlacementName)),
+            PlacementViewsRemaining(MoveTemp(src.PlacementViewsRemaining)),
+            PlacementViewsResetMinutes(MoveTemp(src.PlacementViewsResetMinutes)),
+            RewardAssetUrl(MoveTemp(src.RewardAssetUrl)),
+            RewardDescription(MoveTemp(src.RewardDescription)),
+            RewardId(MoveTemp(src.RewardId)),
+            RewardName(MoveTemp(src.RewardName))
+            {}
+
+        FAdPlacementDetails& operator=(const FAdPlacementDetails& src) = default;
+        FAdPlacementDetails& operator=(FAdPlacementDetails&& src) = default;
+
         FAdPlacementDetails(const TSharedPtr<FJsonObject>& obj) : FAdPlacementDetails()
         {
             readFromValue(obj);
@@ -628,7 +893,13 @@ namespace ClientModels
         ~FAdPlacementDetails();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAdRewardItemGranted : public PlayFab::FPlayFabCppBaseModel
@@ -661,6 +932,17 @@ namespace ClientModels
             ItemId(src.ItemId)
             {}
 
+        FAdRewardItemGranted(FAdRewardItemGranted&& src) :
+            FPlayFabCppBaseModel(),
+            CatalogId(MoveTemp(src.CatalogId)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            InstanceId(MoveTemp(src.InstanceId)),
+            ItemId(MoveTemp(src.ItemId))
+            {}
+
+        FAdRewardItemGranted& operator=(const FAdRewardItemGranted& src) = default;
+        FAdRewardItemGranted& operator=(FAdRewardItemGranted&& src) = default;
+
         FAdRewardItemGranted(const TSharedPtr<FJsonObject>& obj) : FAdRewardItemGranted()
         {
             readFromValue(obj);
@@ -669,7 +951,13 @@ namespace ClientModels
         ~FAdRewardItemGranted();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAdRewardResults : public PlayFab::FPlayFabCppBaseModel
@@ -694,6 +982,16 @@ namespace ClientModels
             IncrementedStatistics(src.IncrementedStatistics)
             {}
 
+        FAdRewardResults(FAdRewardResults&& src) :
+            FPlayFabCppBaseModel(),
+            GrantedItems(MoveTemp(src.GrantedItems)),
+            GrantedVirtualCurrencies(MoveTemp(src.GrantedVirtualCurrencies)),
+            IncrementedStatistics(MoveTemp(src.IncrementedStatistics))
+            {}
+
+        FAdRewardResults& operator=(const FAdRewardResults& src) = default;
+        FAdRewardResults& operator=(FAdRewardResults&& src) = default;
+
         FAdRewardResults(const TSharedPtr<FJsonObject>& obj) : FAdRewardResults()
         {
             readFromValue(obj);
@@ -702,7 +1000,13 @@ namespace ClientModels
         ~FAdRewardResults();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAndroidDevicePushNotificationRegistrationRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -733,6 +1037,16 @@ namespace ClientModels
             SendPushNotificationConfirmation(src.SendPushNotificationConfirmation)
             {}
 
+        FAndroidDevicePushNotificationRegistrationRequest(FAndroidDevicePushNotificationRegistrationRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ConfirmationMessage(MoveTemp(src.ConfirmationMessage)),
+            DeviceToken(MoveTemp(src.DeviceToken)),
+            SendPushNotificationConfirmation(MoveTemp(src.SendPushNotificationConfirmation))
+            {}
+
+        FAndroidDevicePushNotificationRegistrationRequest& operator=(const FAndroidDevicePushNotificationRegistrationRequest& src) = default;
+        FAndroidDevicePushNotificationRegistrationRequest& operator=(FAndroidDevicePushNotificationRegistrationRequest&& src) = default;
+
         FAndroidDevicePushNotificationRegistrationRequest(const TSharedPtr<FJsonObject>& obj) : FAndroidDevicePushNotificationRegistrationRequest()
         {
             readFromValue(obj);
@@ -741,7 +1055,13 @@ namespace ClientModels
         ~FAndroidDevicePushNotificationRegistrationRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAndroidDevicePushNotificationRegistrationResult : public PlayFab::FPlayFabCppResultCommon
@@ -754,6 +1074,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FAndroidDevicePushNotificationRegistrationResult(FAndroidDevicePushNotificationRegistrationResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FAndroidDevicePushNotificationRegistrationResult& operator=(const FAndroidDevicePushNotificationRegistrationResult& src) = default;
+        FAndroidDevicePushNotificationRegistrationResult& operator=(FAndroidDevicePushNotificationRegistrationResult&& src) = default;
+
         FAndroidDevicePushNotificationRegistrationResult(const TSharedPtr<FJsonObject>& obj) : FAndroidDevicePushNotificationRegistrationResult()
         {
             readFromValue(obj);
@@ -762,7 +1089,13 @@ namespace ClientModels
         ~FAndroidDevicePushNotificationRegistrationResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCancelTradeRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -780,6 +1113,14 @@ namespace ClientModels
             TradeId(src.TradeId)
             {}
 
+        FCancelTradeRequest(FCancelTradeRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            TradeId(MoveTemp(src.TradeId))
+            {}
+
+        FCancelTradeRequest& operator=(const FCancelTradeRequest& src) = default;
+        FCancelTradeRequest& operator=(FCancelTradeRequest&& src) = default;
+
         FCancelTradeRequest(const TSharedPtr<FJsonObject>& obj) : FCancelTradeRequest()
         {
             readFromValue(obj);
@@ -788,7 +1129,13 @@ namespace ClientModels
         ~FCancelTradeRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCancelTradeResponse : public PlayFab::FPlayFabCppResultCommon
@@ -803,9 +1150,17 @@ namespace ClientModels
 
         FCancelTradeResponse(const FCancelTradeResponse& src) :
             FPlayFabCppResultCommon(),
-            Trade(src.Trade.IsValid() ? MakeShareable(new FTradeInfo(*src.Trade)) : nullptr)
+            Trade(src.Trade.IsValid() ? TSharedPtr<FTradeInfo>(MakeShared<FTradeInfo>(*src.Trade)) : nullptr)
             {}
 
+        FCancelTradeResponse(FCancelTradeResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Trade(MoveTemp(src.Trade))
+            {}
+
+        FCancelTradeResponse& operator=(const FCancelTradeResponse& src) = default;
+        FCancelTradeResponse& operator=(FCancelTradeResponse&& src) = default;
+
         FCancelTradeResponse(const TSharedPtr<FJsonObject>& obj) : FCancelTradeResponse()
         {
             readFromValue(obj);
@@ -814,7 +1169,13 @@ namespace ClientModels
         ~FCancelTradeResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCartItem : public PlayFab::FPlayFabCppBaseModel
@@ -864,6 +1225,21 @@ namespace ClientModels
             VirtualCurrencyPrices(src.VirtualCurrencyPrices)
             {}
 
+        FCartItem(FCartItem&& src) :
+            FPlayFabCppBaseModel(),
+            Description(MoveTemp(src.Description)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            ItemClass(MoveTemp(src.ItemClass)),
+            ItemId(MoveTemp(src.ItemId)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            RealCurrencyPrices(MoveTemp(src.RealCurrencyPrices)),
+            VCAmount(MoveTemp(src.VCAmount)),
+            VirtualCurrencyPrices(MoveTemp(src.VirtualCurrencyPrices))
+            {}
+
+        FCartItem& operator=(const FCartItem& src) = default;
+        FCartItem& operator=(FCartItem&& src) = default;
+
         FCartItem(const TSharedPtr<FJsonObject>& obj) : FCartItem()
         {
             readFromValue(obj);
@@ -872,7 +1248,13 @@ namespace ClientModels
         ~FCartItem();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCatalogItemBundleInfo : public PlayFab::FPlayFabCppBaseModel
@@ -900,6 +1282,16 @@ namespace ClientModels
             BundledVirtualCurrencies(src.BundledVirtualCurrencies)
             {}
 
+        FCatalogItemBundleInfo(FCatalogItemBundleInfo&& src) :
+            FPlayFabCppBaseModel(),
+            BundledItems(MoveTemp(src.BundledItems)),
+            BundledResultTables(MoveTemp(src.BundledResultTables)),
+            BundledVirtualCurrencies(MoveTemp(src.BundledVirtualCurrencies))
+            {}
+
+        FCatalogItemBundleInfo& operator=(const FCatalogItemBundleInfo& src) = default;
+        FCatalogItemBundleInfo& operator=(FCatalogItemBundleInfo&& src) = default;
+
         FCatalogItemBundleInfo(const TSharedPtr<FJsonObject>& obj) : FCatalogItemBundleInfo()
         {
             readFromValue(obj);
@@ -908,7 +1300,13 @@ namespace ClientModels
         ~FCatalogItemBundleInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCatalogItemConsumableInfo : public PlayFab::FPlayFabCppBaseModel
@@ -943,6 +1341,16 @@ namespace ClientModels
             UsagePeriodGroup(src.UsagePeriodGroup)
             {}
 
+        FCatalogItemConsumableInfo(FCatalogItemConsumableInfo&& src) :
+            FPlayFabCppBaseModel(),
+            UsageCount(MoveTemp(src.UsageCount)),
+            UsagePeriod(MoveTemp(src.UsagePeriod)),
+            UsagePeriodGroup(MoveTemp(src.UsagePeriodGroup))
+            {}
+
+        FCatalogItemConsumableInfo& operator=(const FCatalogItemConsumableInfo& src) = default;
+        FCatalogItemConsumableInfo& operator=(FCatalogItemConsumableInfo&& src) = default;
+
         FCatalogItemConsumableInfo(const TSharedPtr<FJsonObject>& obj) : FCatalogItemConsumableInfo()
         {
             readFromValue(obj);
@@ -951,7 +1359,13 @@ namespace ClientModels
         ~FCatalogItemConsumableInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCatalogItemContainerInfo : public PlayFab::FPlayFabCppBaseModel
@@ -987,6 +1401,17 @@ namespace ClientModels
             VirtualCurrencyContents(src.VirtualCurrencyContents)
             {}
 
+        FCatalogItemContainerInfo(FCatalogItemContainerInfo&& src) :
+            FPlayFabCppBaseModel(),
+            ItemContents(MoveTemp(src.ItemContents)),
+            KeyItemId(MoveTemp(src.KeyItemId)),
+            ResultTableContents(MoveTemp(src.ResultTableContents)),
+            VirtualCurrencyContents(MoveTemp(src.VirtualCurrencyContents))
+            {}
+
+        FCatalogItemContainerInfo& operator=(const FCatalogItemContainerInfo& src) = default;
+        FCatalogItemContainerInfo& operator=(FCatalogItemContainerInfo&& src) = default;
+
         FCatalogItemContainerInfo(const TSharedPtr<FJsonObject>& obj) : FCatalogItemContainerInfo()
         {
             readFromValue(obj);
@@ -995,7 +1420,13 @@ namespace ClientModels
         ~FCatalogItemContainerInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCatalogItem : public PlayFab::FPlayFabCppBaseModel
@@ -1093,11 +1524,11 @@ namespace ClientModels
 
         FCatalogItem(const FCatalogItem& src) :
             FPlayFabCppBaseModel(),
-            Bundle(src.Bundle.IsValid() ? MakeShareable(new FCatalogItemBundleInfo(*src.Bundle)) : nullptr),
+            Bundle(src.Bundle.IsValid() ? TSharedPtr<FCatalogItemBundleInfo>(MakeShared<FCatalogItemBundleInfo>(*src.Bundle)) : nullptr),
             CanBecomeCharacter(src.CanBecomeCharacter),
             CatalogVersion(src.CatalogVersion),
-            Consumable(src.Consumable.IsValid() ? MakeShareable(new FCatalogItemConsumableInfo(*src.Consumable)) : nullptr),
-            Container(src.Container.IsValid() ? MakeShareable(new FCatalogItemContainerInfo(*src.Container)) : nullptr),
+            Consumable(src.Consumable.IsValid() ? TSharedPtr<FCatalogItemConsumableInfo>(MakeShared<FCatalogItemConsumableInfo>(*src.Consumable)) : nullptr),
+            Container(src.Container.IsValid() ? TSharedPtr<FCatalogItemContainerInfo>(MakeShared<FCatalogItemContainerInfo>(*src.Container)) : nullptr),
             CustomData(src.CustomData),
             Description(src.Description),
             DisplayName(src.DisplayName),
@@ -1113,6 +1544,31 @@ namespace ClientModels
             VirtualCurrencyPrices(src.VirtualCurrencyPrices)
             {}
 
+        FCatalogItem(FCatalogItem&& src) :
+            FPlayFabCppBaseModel(),
+            Bundle(MoveTemp(src.Bundle)),
+            CanBecomeCharacter(MoveTemp(src.CanBecomeCharacter)),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            Consumable(MoveTemp(src.Consumable)),
+            Container(MoveTemp(src.Container)),
+            CustomData(MoveTemp(src.CustomData)),
+            Description(MoveTemp(src.Description)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            InitialLimitedEditionCount(MoveTemp(src.InitialLimitedEditionCount)),
+            IsLimitedEdition(MoveTemp(src.IsLimitedEdition)),
+            IsStackable(MoveTemp(src.IsStackable)),
+            IsTradable(MoveTemp(src.IsTradable)),
+            ItemClass(MoveTemp(src.ItemClass)),
+            ItemId(MoveTemp(src.ItemId)),
+            ItemImageUrl(MoveTemp(src.ItemImageUrl)),
+            RealCurrencyPrices(MoveTemp(src.RealCurrencyPrices)),
+            Tags(MoveTemp(src.Tags)),
+            VirtualCurrencyPrices(MoveTemp(src.VirtualCurrencyPrices))
+            {}
+
+        FCatalogItem& operator=(const FCatalogItem& src) = default;
+        FCatalogItem& operator=(FCatalogItem&& src) = default;
+
         FCatalogItem(const TSharedPtr<FJsonObject>& obj) : FCatalogItem()
         {
             readFromValue(obj);
@@ -1121,7 +1577,13 @@ namespace ClientModels
         ~FCatalogItem();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FItemInstance : public PlayFab::FPlayFabCppBaseModel
@@ -1213,6 +1675,28 @@ namespace ClientModels
             UsesIncrementedBy(src.UsesIncrementedBy)
             {}
 
+        FItemInstance(FItemInstance&& src) :
+            FPlayFabCppBaseModel(),
+            Annotation(MoveTemp(src.Annotation)),
+            BundleContents(MoveTemp(src.BundleContents)),
+            BundleParent(MoveTemp(src.BundleParent)),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomData(MoveTemp(src.CustomData)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            Expiration(MoveTemp(src.Expiration)),
+            ItemClass(MoveTemp(src.ItemClass)),
+            ItemId(MoveTemp(src.ItemId)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            PurchaseDate(MoveTemp(src.PurchaseDate)),
+            RemainingUses(MoveTemp(src.RemainingUses)),
+            UnitCurrency(MoveTemp(src.UnitCurrency)),
+            UnitPrice(MoveTemp(src.UnitPrice)),
+            UsesIncrementedBy(MoveTemp(src.UsesIncrementedBy))
+            {}
+
+        FItemInstance& operator=(const FItemInstance& src) = default;
+        FItemInstance& operator=(FItemInstance&& src) = default;
+
         FItemInstance(const TSharedPtr<FJsonObject>& obj) : FItemInstance()
         {
             readFromValue(obj);
@@ -1221,7 +1705,13 @@ namespace ClientModels
         ~FItemInstance();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCharacterInventory : public PlayFab::FPlayFabCppBaseModel
@@ -1243,6 +1733,15 @@ namespace ClientModels
             Inventory(src.Inventory)
             {}
 
+        FCharacterInventory(FCharacterInventory&& src) :
+            FPlayFabCppBaseModel(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            Inventory(MoveTemp(src.Inventory))
+            {}
+
+        FCharacterInventory& operator=(const FCharacterInventory& src) = default;
+        FCharacterInventory& operator=(FCharacterInventory&& src) = default;
+
         FCharacterInventory(const TSharedPtr<FJsonObject>& obj) : FCharacterInventory()
         {
             readFromValue(obj);
@@ -1251,7 +1750,13 @@ namespace ClientModels
         ~FCharacterInventory();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCharacterLeaderboardEntry : public PlayFab::FPlayFabCppBaseModel
@@ -1299,6 +1804,20 @@ namespace ClientModels
             StatValue(src.StatValue)
             {}
 
+        FCharacterLeaderboardEntry(FCharacterLeaderboardEntry&& src) :
+            FPlayFabCppBaseModel(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CharacterName(MoveTemp(src.CharacterName)),
+            CharacterType(MoveTemp(src.CharacterType)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Position(MoveTemp(src.Position)),
+            StatValue(MoveTemp(src.StatValue))
+            {}
+
+        FCharacterLeaderboardEntry& operator=(const FCharacterLeaderboardEntry& src) = default;
+        FCharacterLeaderboardEntry& operator=(FCharacterLeaderboardEntry&& src) = default;
+
         FCharacterLeaderboardEntry(const TSharedPtr<FJsonObject>& obj) : FCharacterLeaderboardEntry()
         {
             readFromValue(obj);
@@ -1307,7 +1826,13 @@ namespace ClientModels
         ~FCharacterLeaderboardEntry();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCharacterResult : public PlayFab::FPlayFabCppBaseModel
@@ -1335,6 +1860,16 @@ namespace ClientModels
             CharacterType(src.CharacterType)
             {}
 
+        FCharacterResult(FCharacterResult&& src) :
+            FPlayFabCppBaseModel(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CharacterName(MoveTemp(src.CharacterName)),
+            CharacterType(MoveTemp(src.CharacterType))
+            {}
+
+        FCharacterResult& operator=(const FCharacterResult& src) = default;
+        FCharacterResult& operator=(FCharacterResult&& src) = default;
+
         FCharacterResult(const TSharedPtr<FJsonObject>& obj) : FCharacterResult()
         {
             readFromValue(obj);
@@ -1343,7 +1878,13 @@ namespace ClientModels
         ~FCharacterResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum CloudScriptRevisionOption
@@ -1354,6 +1895,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeCloudScriptRevisionOptionEnumJSON(CloudScriptRevisionOption enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeCloudScriptRevisionOptionEnumJSON(CloudScriptRevisionOption enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API CloudScriptRevisionOption readCloudScriptRevisionOptionFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API CloudScriptRevisionOption readCloudScriptRevisionOptionFromValue(const FString& value);
 
@@ -1371,6 +1913,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FContainer_Dictionary_String_String(FContainer_Dictionary_String_String&& src) :
+            FPlayFabCppBaseModel(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FContainer_Dictionary_String_String& operator=(const FContainer_Dictionary_String_String& src) = default;
+        FContainer_Dictionary_String_String& operator=(FContainer_Dictionary_String_String&& src) = default;
+
         FContainer_Dictionary_String_String(const TSharedPtr<FJsonObject>& obj) : FContainer_Dictionary_String_String()
         {
             readFromValue(obj);
@@ -1379,7 +1929,13 @@ namespace ClientModels
         ~FContainer_Dictionary_String_String();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCollectionFilter : public PlayFab::FPlayFabCppBaseModel
@@ -1403,6 +1959,15 @@ namespace ClientModels
             Includes(src.Includes)
             {}
 
+        FCollectionFilter(FCollectionFilter&& src) :
+            FPlayFabCppBaseModel(),
+            Excludes(MoveTemp(src.Excludes)),
+            Includes(MoveTemp(src.Includes))
+            {}
+
+        FCollectionFilter& operator=(const FCollectionFilter& src) = default;
+        FCollectionFilter& operator=(FCollectionFilter&& src) = default;
+
         FCollectionFilter(const TSharedPtr<FJsonObject>& obj) : FCollectionFilter()
         {
             readFromValue(obj);
@@ -1411,7 +1976,13 @@ namespace ClientModels
         ~FCollectionFilter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConfirmPurchaseRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1433,6 +2004,15 @@ namespace ClientModels
             OrderId(src.OrderId)
             {}
 
+        FConfirmPurchaseRequest(FConfirmPurchaseRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            OrderId(MoveTemp(src.OrderId))
+            {}
+
+        FConfirmPurchaseRequest& operator=(const FConfirmPurchaseRequest& src) = default;
+        FConfirmPurchaseRequest& operator=(FConfirmPurchaseRequest&& src) = default;
+
         FConfirmPurchaseRequest(const TSharedPtr<FJsonObject>& obj) : FConfirmPurchaseRequest()
         {
             readFromValue(obj);
@@ -1441,7 +2021,13 @@ namespace ClientModels
         ~FConfirmPurchaseRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConfirmPurchaseResult : public PlayFab::FPlayFabCppResultCommon
@@ -1468,6 +2054,16 @@ namespace ClientModels
             PurchaseDate(src.PurchaseDate)
             {}
 
+        FConfirmPurchaseResult(FConfirmPurchaseResult&& src) :
+            FPlayFabCppResultCommon(),
+            Items(MoveTemp(src.Items)),
+            OrderId(MoveTemp(src.OrderId)),
+            PurchaseDate(MoveTemp(src.PurchaseDate))
+            {}
+
+        FConfirmPurchaseResult& operator=(const FConfirmPurchaseResult& src) = default;
+        FConfirmPurchaseResult& operator=(FConfirmPurchaseResult&& src) = default;
+
         FConfirmPurchaseResult(const TSharedPtr<FJsonObject>& obj) : FConfirmPurchaseResult()
         {
             readFromValue(obj);
@@ -1476,7 +2072,13 @@ namespace ClientModels
         ~FConfirmPurchaseResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumeItemRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1508,6 +2110,17 @@ namespace ClientModels
             ItemInstanceId(src.ItemInstanceId)
             {}
 
+        FConsumeItemRequest(FConsumeItemRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            ConsumeCount(MoveTemp(src.ConsumeCount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId))
+            {}
+
+        FConsumeItemRequest& operator=(const FConsumeItemRequest& src) = default;
+        FConsumeItemRequest& operator=(FConsumeItemRequest&& src) = default;
+
         FConsumeItemRequest(const TSharedPtr<FJsonObject>& obj) : FConsumeItemRequest()
         {
             readFromValue(obj);
@@ -1516,7 +2129,13 @@ namespace ClientModels
         ~FConsumeItemRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumeItemResult : public PlayFab::FPlayFabCppResultCommon
@@ -1539,6 +2158,15 @@ namespace ClientModels
             RemainingUses(src.RemainingUses)
             {}
 
+        FConsumeItemResult(FConsumeItemResult&& src) :
+            FPlayFabCppResultCommon(),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            RemainingUses(MoveTemp(src.RemainingUses))
+            {}
+
+        FConsumeItemResult& operator=(const FConsumeItemResult& src) = default;
+        FConsumeItemResult& operator=(FConsumeItemResult&& src) = default;
+
         FConsumeItemResult(const TSharedPtr<FJsonObject>& obj) : FConsumeItemResult()
         {
             readFromValue(obj);
@@ -1547,7 +2175,13 @@ namespace ClientModels
         ~FConsumeItemResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMicrosoftStorePayload : public PlayFab::FPlayFabCppBaseModel
@@ -1578,6 +2212,16 @@ namespace ClientModels
             XboxToken(src.XboxToken)
             {}
 
+        FMicrosoftStorePayload(FMicrosoftStorePayload&& src) :
+            FPlayFabCppBaseModel(),
+            CollectionsMsIdKey(MoveTemp(src.CollectionsMsIdKey)),
+            UserId(MoveTemp(src.UserId)),
+            XboxToken(MoveTemp(src.XboxToken))
+            {}
+
+        FMicrosoftStorePayload& operator=(const FMicrosoftStorePayload& src) = default;
+        FMicrosoftStorePayload& operator=(FMicrosoftStorePayload&& src) = default;
+
         FMicrosoftStorePayload(const TSharedPtr<FJsonObject>& obj) : FMicrosoftStorePayload()
         {
             readFromValue(obj);
@@ -1586,7 +2230,13 @@ namespace ClientModels
         ~FMicrosoftStorePayload();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumeMicrosoftStoreEntitlementsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1613,6 +2263,16 @@ namespace ClientModels
             MarketplaceSpecificData(src.MarketplaceSpecificData)
             {}
 
+        FConsumeMicrosoftStoreEntitlementsRequest(FConsumeMicrosoftStoreEntitlementsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            MarketplaceSpecificData(MoveTemp(src.MarketplaceSpecificData))
+            {}
+
+        FConsumeMicrosoftStoreEntitlementsRequest& operator=(const FConsumeMicrosoftStoreEntitlementsRequest& src) = default;
+        FConsumeMicrosoftStoreEntitlementsRequest& operator=(FConsumeMicrosoftStoreEntitlementsRequest&& src) = default;
+
         FConsumeMicrosoftStoreEntitlementsRequest(const TSharedPtr<FJsonObject>& obj) : FConsumeMicrosoftStoreEntitlementsRequest()
         {
             readFromValue(obj);
@@ -1621,7 +2281,13 @@ namespace ClientModels
         ~FConsumeMicrosoftStoreEntitlementsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumeMicrosoftStoreEntitlementsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -1638,6 +2304,14 @@ namespace ClientModels
             Items(src.Items)
             {}
 
+        FConsumeMicrosoftStoreEntitlementsResponse(FConsumeMicrosoftStoreEntitlementsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Items(MoveTemp(src.Items))
+            {}
+
+        FConsumeMicrosoftStoreEntitlementsResponse& operator=(const FConsumeMicrosoftStoreEntitlementsResponse& src) = default;
+        FConsumeMicrosoftStoreEntitlementsResponse& operator=(FConsumeMicrosoftStoreEntitlementsResponse&& src) = default;
+
         FConsumeMicrosoftStoreEntitlementsResponse(const TSharedPtr<FJsonObject>& obj) : FConsumeMicrosoftStoreEntitlementsResponse()
         {
             readFromValue(obj);
@@ -1646,7 +2320,13 @@ namespace ClientModels
         ~FConsumeMicrosoftStoreEntitlementsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayStation5Payload : public PlayFab::FPlayFabCppBaseModel
@@ -1668,6 +2348,15 @@ namespace ClientModels
             ServiceLabel(src.ServiceLabel)
             {}
 
+        FPlayStation5Payload(FPlayStation5Payload&& src) :
+            FPlayFabCppBaseModel(),
+            Ids(MoveTemp(src.Ids)),
+            ServiceLabel(MoveTemp(src.ServiceLabel))
+            {}
+
+        FPlayStation5Payload& operator=(const FPlayStation5Payload& src) = default;
+        FPlayStation5Payload& operator=(FPlayStation5Payload&& src) = default;
+
         FPlayStation5Payload(const TSharedPtr<FJsonObject>& obj) : FPlayStation5Payload()
         {
             readFromValue(obj);
@@ -1676,7 +2365,13 @@ namespace ClientModels
         ~FPlayStation5Payload();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumePS5EntitlementsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1703,6 +2398,16 @@ namespace ClientModels
             MarketplaceSpecificData(src.MarketplaceSpecificData)
             {}
 
+        FConsumePS5EntitlementsRequest(FConsumePS5EntitlementsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            MarketplaceSpecificData(MoveTemp(src.MarketplaceSpecificData))
+            {}
+
+        FConsumePS5EntitlementsRequest& operator=(const FConsumePS5EntitlementsRequest& src) = default;
+        FConsumePS5EntitlementsRequest& operator=(FConsumePS5EntitlementsRequest&& src) = default;
+
         FConsumePS5EntitlementsRequest(const TSharedPtr<FJsonObject>& obj) : FConsumePS5EntitlementsRequest()
         {
             readFromValue(obj);
@@ -1711,7 +2416,13 @@ namespace ClientModels
         ~FConsumePS5EntitlementsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumePS5EntitlementsResult : public PlayFab::FPlayFabCppResultCommon
@@ -1728,6 +2439,14 @@ namespace ClientModels
             Items(src.Items)
             {}
 
+        FConsumePS5EntitlementsResult(FConsumePS5EntitlementsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Items(MoveTemp(src.Items))
+            {}
+
+        FConsumePS5EntitlementsResult& operator=(const FConsumePS5EntitlementsResult& src) = default;
+        FConsumePS5EntitlementsResult& operator=(FConsumePS5EntitlementsResult&& src) = default;
+
         FConsumePS5EntitlementsResult(const TSharedPtr<FJsonObject>& obj) : FConsumePS5EntitlementsResult()
         {
             readFromValue(obj);
@@ -1736,7 +2455,13 @@ namespace ClientModels
         ~FConsumePS5EntitlementsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumePSNEntitlementsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1763,6 +2488,16 @@ namespace ClientModels
             ServiceLabel(src.ServiceLabel)
             {}
 
+        FConsumePSNEntitlementsRequest(FConsumePSNEntitlementsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ServiceLabel(MoveTemp(src.ServiceLabel))
+            {}
+
+        FConsumePSNEntitlementsRequest& operator=(const FConsumePSNEntitlementsRequest& src) = default;
+        FConsumePSNEntitlementsRequest& operator=(FConsumePSNEntitlementsRequest&& src) = default;
+
         FConsumePSNEntitlementsRequest(const TSharedPtr<FJsonObject>& obj) : FConsumePSNEntitlementsRequest()
         {
             readFromValue(obj);
@@ -1771,7 +2506,13 @@ namespace ClientModels
         ~FConsumePSNEntitlementsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumePSNEntitlementsResult : public PlayFab::FPlayFabCppResultCommon
@@ -1788,6 +2529,14 @@ namespace ClientModels
             ItemsGranted(src.ItemsGranted)
             {}
 
+        FConsumePSNEntitlementsResult(FConsumePSNEntitlementsResult&& src) :
+            FPlayFabCppResultCommon(),
+            ItemsGranted(MoveTemp(src.ItemsGranted))
+            {}
+
+        FConsumePSNEntitlementsResult& operator=(const FConsumePSNEntitlementsResult& src) = default;
+        FConsumePSNEntitlementsResult& operator=(FConsumePSNEntitlementsResult&& src) = default;
+
         FConsumePSNEntitlementsResult(const TSharedPtr<FJsonObject>& obj) : FConsumePSNEntitlementsResult()
         {
             readFromValue(obj);
@@ -1796,7 +2545,13 @@ namespace ClientModels
         ~FConsumePSNEntitlementsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumeXboxEntitlementsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1823,6 +2578,16 @@ namespace ClientModels
             XboxToken(src.XboxToken)
             {}
 
+        FConsumeXboxEntitlementsRequest(FConsumeXboxEntitlementsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            XboxToken(MoveTemp(src.XboxToken))
+            {}
+
+        FConsumeXboxEntitlementsRequest& operator=(const FConsumeXboxEntitlementsRequest& src) = default;
+        FConsumeXboxEntitlementsRequest& operator=(FConsumeXboxEntitlementsRequest&& src) = default;
+
         FConsumeXboxEntitlementsRequest(const TSharedPtr<FJsonObject>& obj) : FConsumeXboxEntitlementsRequest()
         {
             readFromValue(obj);
@@ -1831,7 +2596,13 @@ namespace ClientModels
         ~FConsumeXboxEntitlementsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumeXboxEntitlementsResult : public PlayFab::FPlayFabCppResultCommon
@@ -1848,6 +2619,14 @@ namespace ClientModels
             Items(src.Items)
             {}
 
+        FConsumeXboxEntitlementsResult(FConsumeXboxEntitlementsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Items(MoveTemp(src.Items))
+            {}
+
+        FConsumeXboxEntitlementsResult& operator=(const FConsumeXboxEntitlementsResult& src) = default;
+        FConsumeXboxEntitlementsResult& operator=(FConsumeXboxEntitlementsResult&& src) = default;
+
         FConsumeXboxEntitlementsResult(const TSharedPtr<FJsonObject>& obj) : FConsumeXboxEntitlementsResult()
         {
             readFromValue(obj);
@@ -1856,7 +2635,13 @@ namespace ClientModels
         ~FConsumeXboxEntitlementsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum EmailVerificationStatus
@@ -1867,6 +2652,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API EmailVerificationStatus readEmailVerificationStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API EmailVerificationStatus readEmailVerificationStatusFromValue(const FString& value);
 
@@ -1895,6 +2681,16 @@ namespace ClientModels
             VerificationStatus(src.VerificationStatus)
             {}
 
+        FContactEmailInfoModel(FContactEmailInfoModel&& src) :
+            FPlayFabCppBaseModel(),
+            EmailAddress(MoveTemp(src.EmailAddress)),
+            Name(MoveTemp(src.Name)),
+            VerificationStatus(MoveTemp(src.VerificationStatus))
+            {}
+
+        FContactEmailInfoModel& operator=(const FContactEmailInfoModel& src) = default;
+        FContactEmailInfoModel& operator=(FContactEmailInfoModel&& src) = default;
+
         FContactEmailInfoModel(const TSharedPtr<FJsonObject>& obj) : FContactEmailInfoModel()
         {
             readFromValue(obj);
@@ -1903,7 +2699,13 @@ namespace ClientModels
         ~FContactEmailInfoModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum ContinentCode
@@ -1918,6 +2720,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeContinentCodeEnumJSON(ContinentCode enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeContinentCodeEnumJSON(ContinentCode enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API ContinentCode readContinentCodeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API ContinentCode readContinentCodeFromValue(const FString& value);
 
@@ -2175,6 +2978,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeCountryCodeEnumJSON(CountryCode enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeCountryCodeEnumJSON(CountryCode enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API CountryCode readCountryCodeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API CountryCode readCountryCodeFromValue(const FString& value);
 
@@ -2193,6 +2997,14 @@ namespace ClientModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FCreateSharedGroupRequest(FCreateSharedGroupRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FCreateSharedGroupRequest& operator=(const FCreateSharedGroupRequest& src) = default;
+        FCreateSharedGroupRequest& operator=(FCreateSharedGroupRequest&& src) = default;
+
         FCreateSharedGroupRequest(const TSharedPtr<FJsonObject>& obj) : FCreateSharedGroupRequest()
         {
             readFromValue(obj);
@@ -2201,7 +3013,13 @@ namespace ClientModels
         ~FCreateSharedGroupRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateSharedGroupResult : public PlayFab::FPlayFabCppResultCommon
@@ -2219,6 +3037,14 @@ namespace ClientModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FCreateSharedGroupResult(FCreateSharedGroupResult&& src) :
+            FPlayFabCppResultCommon(),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FCreateSharedGroupResult& operator=(const FCreateSharedGroupResult& src) = default;
+        FCreateSharedGroupResult& operator=(FCreateSharedGroupResult&& src) = default;
+
         FCreateSharedGroupResult(const TSharedPtr<FJsonObject>& obj) : FCreateSharedGroupResult()
         {
             readFromValue(obj);
@@ -2227,7 +3053,13 @@ namespace ClientModels
         ~FCreateSharedGroupResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum Currency
@@ -2397,6 +3229,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeCurrencyEnumJSON(Currency enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeCurrencyEnumJSON(Currency enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API Currency readCurrencyFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API Currency readCurrencyFromValue(const FString& value);
 
@@ -2412,6 +3245,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeRegionEnumJSON(Region enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeRegionEnumJSON(Region enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API Region readRegionFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API Region readRegionFromValue(const FString& value);
 
@@ -2447,9 +3281,21 @@ namespace ClientModels
             GameMode(src.GameMode),
             pfRegion(src.pfRegion),
             StatisticName(src.StatisticName),
-            TagFilter(src.TagFilter.IsValid() ? MakeShareable(new FCollectionFilter(*src.TagFilter)) : nullptr)
+            TagFilter(src.TagFilter.IsValid() ? TSharedPtr<FCollectionFilter>(MakeShared<FCollectionFilter>(*src.TagFilter)) : nullptr)
+            {}
+
+        FCurrentGamesRequest(FCurrentGamesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildVersion(MoveTemp(src.BuildVersion)),
+            GameMode(MoveTemp(src.GameMode)),
+            pfRegion(MoveTemp(src.pfRegion)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            TagFilter(MoveTemp(src.TagFilter))
             {}
 
+        FCurrentGamesRequest& operator=(const FCurrentGamesRequest& src) = default;
+        FCurrentGamesRequest& operator=(FCurrentGamesRequest&& src) = default;
+
         FCurrentGamesRequest(const TSharedPtr<FJsonObject>& obj) : FCurrentGamesRequest()
         {
             readFromValue(obj);
@@ -2458,7 +3304,13 @@ namespace ClientModels
         ~FCurrentGamesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum GameInstanceState
@@ -2468,6 +3320,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeGameInstanceStateEnumJSON(GameInstanceState enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeGameInstanceStateEnumJSON(GameInstanceState enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API GameInstanceState readGameInstanceStateFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API GameInstanceState readGameInstanceStateFromValue(const FString& value);
 
@@ -2559,6 +3412,29 @@ namespace ClientModels
             Tags(src.Tags)
             {}
 
+        FGameInfo(FGameInfo&& src) :
+            FPlayFabCppBaseModel(),
+            BuildVersion(MoveTemp(src.BuildVersion)),
+            GameMode(MoveTemp(src.GameMode)),
+            GameServerData(MoveTemp(src.GameServerData)),
+            GameServerStateEnum(MoveTemp(src.GameServerStateEnum)),
+            LastHeartbeat(MoveTemp(src.LastHeartbeat)),
+            LobbyID(MoveTemp(src.LobbyID)),
+            MaxPlayers(MoveTemp(src.MaxPlayers)),
+            PlayerUserIds(MoveTemp(src.PlayerUserIds)),
+            pfRegion(MoveTemp(src.pfRegion)),
+            RunTime(MoveTemp(src.RunTime)),
+            ServerIPV4Address(MoveTemp(src.ServerIPV4Address)),
+            ServerIPV6Address(MoveTemp(src.ServerIPV6Address)),
+            ServerPort(MoveTemp(src.ServerPort)),
+            ServerPublicDNSName(MoveTemp(src.ServerPublicDNSName)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            Tags(MoveTemp(src.Tags))
+            {}
+
+        FGameInfo& operator=(const FGameInfo& src) = default;
+        FGameInfo& operator=(FGameInfo&& src) = default;
+
         FGameInfo(const TSharedPtr<FJsonObject>& obj) : FGameInfo()
         {
             readFromValue(obj);
@@ -2567,7 +3443,13 @@ namespace ClientModels
         ~FGameInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCurrentGamesResult : public PlayFab::FPlayFabCppResultCommon
@@ -2594,6 +3476,16 @@ namespace ClientModels
             PlayerCount(src.PlayerCount)
             {}
 
+        FCurrentGamesResult(FCurrentGamesResult&& src) :
+            FPlayFabCppResultCommon(),
+            GameCount(MoveTemp(src.GameCount)),
+            Games(MoveTemp(src.Games)),
+            PlayerCount(MoveTemp(src.PlayerCount))
+            {}
+
+        FCurrentGamesResult& operator=(const FCurrentGamesResult& src) = default;
+        FCurrentGamesResult& operator=(FCurrentGamesResult&& src) = default;
+
         FCurrentGamesResult(const TSharedPtr<FJsonObject>& obj) : FCurrentGamesResult()
         {
             readFromValue(obj);
@@ -2602,7 +3494,13 @@ namespace ClientModels
         ~FCurrentGamesResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeviceInfoRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2619,6 +3517,14 @@ namespace ClientModels
             Info(src.Info)
             {}
 
+        FDeviceInfoRequest(FDeviceInfoRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Info(MoveTemp(src.Info))
+            {}
+
+        FDeviceInfoRequest& operator=(const FDeviceInfoRequest& src) = default;
+        FDeviceInfoRequest& operator=(FDeviceInfoRequest&& src) = default;
+
         FDeviceInfoRequest(const TSharedPtr<FJsonObject>& obj) : FDeviceInfoRequest()
         {
             readFromValue(obj);
@@ -2627,7 +3533,13 @@ namespace ClientModels
         ~FDeviceInfoRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEmptyResponse : public PlayFab::FPlayFabCppResultCommon
@@ -2640,6 +3552,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FEmptyResponse(FEmptyResponse&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FEmptyResponse& operator=(const FEmptyResponse& src) = default;
+        FEmptyResponse& operator=(FEmptyResponse&& src) = default;
+
         FEmptyResponse(const TSharedPtr<FJsonObject>& obj) : FEmptyResponse()
         {
             readFromValue(obj);
@@ -2648,7 +3567,13 @@ namespace ClientModels
         ~FEmptyResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEmptyResult : public PlayFab::FPlayFabCppResultCommon
@@ -2661,6 +3586,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FEmptyResult(FEmptyResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FEmptyResult& operator=(const FEmptyResult& src) = default;
+        FEmptyResult& operator=(FEmptyResult&& src) = default;
+
         FEmptyResult(const TSharedPtr<FJsonObject>& obj) : FEmptyResult()
         {
             readFromValue(obj);
@@ -2669,7 +3601,13 @@ namespace ClientModels
         ~FEmptyResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityKey : public PlayFab::FPlayFabCppBaseModel
@@ -2692,6 +3630,15 @@ namespace ClientModels
             Type(src.Type)
             {}
 
+        FEntityKey(FEntityKey&& src) :
+            FPlayFabCppBaseModel(),
+            Id(MoveTemp(src.Id)),
+            Type(MoveTemp(src.Type))
+            {}
+
+        FEntityKey& operator=(const FEntityKey& src) = default;
+        FEntityKey& operator=(FEntityKey&& src) = default;
+
         FEntityKey(const TSharedPtr<FJsonObject>& obj) : FEntityKey()
         {
             readFromValue(obj);
@@ -2700,7 +3647,13 @@ namespace ClientModels
         ~FEntityKey();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityTokenResponse : public PlayFab::FPlayFabCppBaseModel
@@ -2723,11 +3676,21 @@ namespace ClientModels
 
         FEntityTokenResponse(const FEntityTokenResponse& src) :
             FPlayFabCppBaseModel(),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             EntityToken(src.EntityToken),
             TokenExpiration(src.TokenExpiration)
             {}
 
+        FEntityTokenResponse(FEntityTokenResponse&& src) :
+            FPlayFabCppBaseModel(),
+            Entity(MoveTemp(src.Entity)),
+            EntityToken(MoveTemp(src.EntityToken)),
+            TokenExpiration(MoveTemp(src.TokenExpiration))
+            {}
+
+        FEntityTokenResponse& operator=(const FEntityTokenResponse& src) = default;
+        FEntityTokenResponse& operator=(FEntityTokenResponse&& src) = default;
+
         FEntityTokenResponse(const TSharedPtr<FJsonObject>& obj) : FEntityTokenResponse()
         {
             readFromValue(obj);
@@ -2736,7 +3699,13 @@ namespace ClientModels
         ~FEntityTokenResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FExecuteCloudScriptRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2785,6 +3754,19 @@ namespace ClientModels
             SpecificRevision(src.SpecificRevision)
             {}
 
+        FExecuteCloudScriptRequest(FExecuteCloudScriptRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            FunctionName(MoveTemp(src.FunctionName)),
+            FunctionParameter(MoveTemp(src.FunctionParameter)),
+            GeneratePlayStreamEvent(MoveTemp(src.GeneratePlayStreamEvent)),
+            RevisionSelection(MoveTemp(src.RevisionSelection)),
+            SpecificRevision(MoveTemp(src.SpecificRevision))
+            {}
+
+        FExecuteCloudScriptRequest& operator=(const FExecuteCloudScriptRequest& src) = default;
+        FExecuteCloudScriptRequest& operator=(FExecuteCloudScriptRequest&& src) = default;
+
         FExecuteCloudScriptRequest(const TSharedPtr<FJsonObject>& obj) : FExecuteCloudScriptRequest()
         {
             readFromValue(obj);
@@ -2793,7 +3775,13 @@ namespace ClientModels
         ~FExecuteCloudScriptRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FScriptExecutionError : public PlayFab::FPlayFabCppBaseModel
@@ -2824,6 +3812,16 @@ namespace ClientModels
             StackTrace(src.StackTrace)
             {}
 
+        FScriptExecutionError(FScriptExecutionError&& src) :
+            FPlayFabCppBaseModel(),
+            Error(MoveTemp(src.Error)),
+            Message(MoveTemp(src.Message)),
+            StackTrace(MoveTemp(src.StackTrace))
+            {}
+
+        FScriptExecutionError& operator=(const FScriptExecutionError& src) = default;
+        FScriptExecutionError& operator=(FScriptExecutionError&& src) = default;
+
         FScriptExecutionError(const TSharedPtr<FJsonObject>& obj) : FScriptExecutionError()
         {
             readFromValue(obj);
@@ -2832,7 +3830,13 @@ namespace ClientModels
         ~FScriptExecutionError();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLogStatement : public PlayFab::FPlayFabCppBaseModel
@@ -2860,6 +3864,16 @@ namespace ClientModels
             Message(src.Message)
             {}
 
+        FLogStatement(FLogStatement&& src) :
+            FPlayFabCppBaseModel(),
+            Data(MoveTemp(src.Data)),
+            Level(MoveTemp(src.Level)),
+            Message(MoveTemp(src.Message))
+            {}
+
+        FLogStatement& operator=(const FLogStatement& src) = default;
+        FLogStatement& operator=(FLogStatement&& src) = default;
+
         FLogStatement(const TSharedPtr<FJsonObject>& obj) : FLogStatement()
         {
             readFromValue(obj);
@@ -2868,7 +3882,13 @@ namespace ClientModels
         ~FLogStatement();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FExecuteCloudScriptResult : public PlayFab::FPlayFabCppResultCommon
@@ -2937,7 +3957,7 @@ namespace ClientModels
         FExecuteCloudScriptResult(const FExecuteCloudScriptResult& src) :
             FPlayFabCppResultCommon(),
             APIRequestsIssued(src.APIRequestsIssued),
-            Error(src.Error.IsValid() ? MakeShareable(new FScriptExecutionError(*src.Error)) : nullptr),
+            Error(src.Error.IsValid() ? TSharedPtr<FScriptExecutionError>(MakeShared<FScriptExecutionError>(*src.Error)) : nullptr),
             ExecutionTimeSeconds(src.ExecutionTimeSeconds),
             FunctionName(src.FunctionName),
             FunctionResult(src.FunctionResult),
@@ -2950,6 +3970,25 @@ namespace ClientModels
             Revision(src.Revision)
             {}
 
+        FExecuteCloudScriptResult(FExecuteCloudScriptResult&& src) :
+            FPlayFabCppResultCommon(),
+            APIRequestsIssued(MoveTemp(src.APIRequestsIssued)),
+            Error(MoveTemp(src.Error)),
+            ExecutionTimeSeconds(MoveTemp(src.ExecutionTimeSeconds)),
+            FunctionName(MoveTemp(src.FunctionName)),
+            FunctionResult(MoveTemp(src.FunctionResult)),
+            FunctionResultTooLarge(MoveTemp(src.FunctionResultTooLarge)),
+            HttpRequestsIssued(MoveTemp(src.HttpRequestsIssued)),
+            Logs(MoveTemp(src.Logs)),
+            LogsTooLarge(MoveTemp(src.LogsTooLarge)),
+            MemoryConsumedBytes(MoveTemp(src.MemoryConsumedBytes)),
+            ProcessorTimeSeconds(MoveTemp(src.ProcessorTimeSeconds)),
+            Revision(MoveTemp(src.Revision))
+            {}
+
+        FExecuteCloudScriptResult& operator=(const FExecuteCloudScriptResult& src) = default;
+        FExecuteCloudScriptResult& operator=(FExecuteCloudScriptResult&& src) = default;
+
         FExecuteCloudScriptResult(const TSharedPtr<FJsonObject>& obj) : FExecuteCloudScriptResult()
         {
             readFromValue(obj);
@@ -2958,7 +3997,13 @@ namespace ClientModels
         ~FExecuteCloudScriptResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FFacebookInstantGamesPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -2981,6 +4026,15 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FFacebookInstantGamesPlayFabIdPair(FFacebookInstantGamesPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            FacebookInstantGamesId(MoveTemp(src.FacebookInstantGamesId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FFacebookInstantGamesPlayFabIdPair& operator=(const FFacebookInstantGamesPlayFabIdPair& src) = default;
+        FFacebookInstantGamesPlayFabIdPair& operator=(FFacebookInstantGamesPlayFabIdPair&& src) = default;
+
         FFacebookInstantGamesPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FFacebookInstantGamesPlayFabIdPair()
         {
             readFromValue(obj);
@@ -2989,7 +4043,13 @@ namespace ClientModels
         ~FFacebookInstantGamesPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FFacebookPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -3012,6 +4072,15 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FFacebookPlayFabIdPair(FFacebookPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            FacebookId(MoveTemp(src.FacebookId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FFacebookPlayFabIdPair& operator=(const FFacebookPlayFabIdPair& src) = default;
+        FFacebookPlayFabIdPair& operator=(FFacebookPlayFabIdPair&& src) = default;
+
         FFacebookPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FFacebookPlayFabIdPair()
         {
             readFromValue(obj);
@@ -3020,7 +4089,13 @@ namespace ClientModels
         ~FFacebookPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserFacebookInfo : public PlayFab::FPlayFabCppBaseModel
@@ -3043,6 +4118,15 @@ namespace ClientModels
             FullName(src.FullName)
             {}
 
+        FUserFacebookInfo(FUserFacebookInfo&& src) :
+            FPlayFabCppBaseModel(),
+            FacebookId(MoveTemp(src.FacebookId)),
+            FullName(MoveTemp(src.FullName))
+            {}
+
+        FUserFacebookInfo& operator=(const FUserFacebookInfo& src) = default;
+        FUserFacebookInfo& operator=(FUserFacebookInfo&& src) = default;
+
         FUserFacebookInfo(const TSharedPtr<FJsonObject>& obj) : FUserFacebookInfo()
         {
             readFromValue(obj);
@@ -3051,7 +4135,13 @@ namespace ClientModels
         ~FUserFacebookInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserGameCenterInfo : public PlayFab::FPlayFabCppBaseModel
@@ -3069,6 +4159,14 @@ namespace ClientModels
             GameCenterId(src.GameCenterId)
             {}
 
+        FUserGameCenterInfo(FUserGameCenterInfo&& src) :
+            FPlayFabCppBaseModel(),
+            GameCenterId(MoveTemp(src.GameCenterId))
+            {}
+
+        FUserGameCenterInfo& operator=(const FUserGameCenterInfo& src) = default;
+        FUserGameCenterInfo& operator=(FUserGameCenterInfo&& src) = default;
+
         FUserGameCenterInfo(const TSharedPtr<FJsonObject>& obj) : FUserGameCenterInfo()
         {
             readFromValue(obj);
@@ -3077,7 +4175,13 @@ namespace ClientModels
         ~FUserGameCenterInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum LoginIdentityProvider
@@ -3106,6 +4210,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API LoginIdentityProvider readLoginIdentityProviderFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API LoginIdentityProvider readLoginIdentityProviderFromValue(const FString& value);
 
@@ -3139,6 +4244,17 @@ namespace ClientModels
             Username(src.Username)
             {}
 
+        FLinkedPlatformAccountModel(FLinkedPlatformAccountModel&& src) :
+            FPlayFabCppBaseModel(),
+            Email(MoveTemp(src.Email)),
+            Platform(MoveTemp(src.Platform)),
+            PlatformUserId(MoveTemp(src.PlatformUserId)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FLinkedPlatformAccountModel& operator=(const FLinkedPlatformAccountModel& src) = default;
+        FLinkedPlatformAccountModel& operator=(FLinkedPlatformAccountModel&& src) = default;
+
         FLinkedPlatformAccountModel(const TSharedPtr<FJsonObject>& obj) : FLinkedPlatformAccountModel()
         {
             readFromValue(obj);
@@ -3147,7 +4263,13 @@ namespace ClientModels
         ~FLinkedPlatformAccountModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLocationModel : public PlayFab::FPlayFabCppBaseModel
@@ -3185,6 +4307,18 @@ namespace ClientModels
             Longitude(src.Longitude)
             {}
 
+        FLocationModel(FLocationModel&& src) :
+            FPlayFabCppBaseModel(),
+            City(MoveTemp(src.City)),
+            pfContinentCode(MoveTemp(src.pfContinentCode)),
+            pfCountryCode(MoveTemp(src.pfCountryCode)),
+            Latitude(MoveTemp(src.Latitude)),
+            Longitude(MoveTemp(src.Longitude))
+            {}
+
+        FLocationModel& operator=(const FLocationModel& src) = default;
+        FLocationModel& operator=(FLocationModel&& src) = default;
+
         FLocationModel(const TSharedPtr<FJsonObject>& obj) : FLocationModel()
         {
             readFromValue(obj);
@@ -3193,7 +4327,13 @@ namespace ClientModels
         ~FLocationModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum SubscriptionProviderStatus
@@ -3209,6 +4349,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API SubscriptionProviderStatus readSubscriptionProviderStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API SubscriptionProviderStatus readSubscriptionProviderStatusFromValue(const FString& value);
 
@@ -3257,6 +4398,20 @@ namespace ClientModels
             SubscriptionProvider(src.SubscriptionProvider)
             {}
 
+        FSubscriptionModel(FSubscriptionModel&& src) :
+            FPlayFabCppBaseModel(),
+            Expiration(MoveTemp(src.Expiration)),
+            InitialSubscriptionTime(MoveTemp(src.InitialSubscriptionTime)),
+            IsActive(MoveTemp(src.IsActive)),
+            Status(MoveTemp(src.Status)),
+            SubscriptionId(MoveTemp(src.SubscriptionId)),
+            SubscriptionItemId(MoveTemp(src.SubscriptionItemId)),
+            SubscriptionProvider(MoveTemp(src.SubscriptionProvider))
+            {}
+
+        FSubscriptionModel& operator=(const FSubscriptionModel& src) = default;
+        FSubscriptionModel& operator=(FSubscriptionModel&& src) = default;
+
         FSubscriptionModel(const TSharedPtr<FJsonObject>& obj) : FSubscriptionModel()
         {
             readFromValue(obj);
@@ -3265,7 +4420,13 @@ namespace ClientModels
         ~FSubscriptionModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMembershipModel : public PlayFab::FPlayFabCppBaseModel
@@ -3310,6 +4471,19 @@ namespace ClientModels
             Subscriptions(src.Subscriptions)
             {}
 
+        FMembershipModel(FMembershipModel&& src) :
+            FPlayFabCppBaseModel(),
+            IsActive(MoveTemp(src.IsActive)),
+            MembershipExpiration(MoveTemp(src.MembershipExpiration)),
+            MembershipId(MoveTemp(src.MembershipId)),
+            OverrideExpiration(MoveTemp(src.OverrideExpiration)),
+            OverrideIsSet(MoveTemp(src.OverrideIsSet)),
+            Subscriptions(MoveTemp(src.Subscriptions))
+            {}
+
+        FMembershipModel& operator=(const FMembershipModel& src) = default;
+        FMembershipModel& operator=(FMembershipModel&& src) = default;
+
         FMembershipModel(const TSharedPtr<FJsonObject>& obj) : FMembershipModel()
         {
             readFromValue(obj);
@@ -3318,7 +4492,13 @@ namespace ClientModels
         ~FMembershipModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum PushNotificationPlatform
@@ -3328,6 +4508,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API PushNotificationPlatform readPushNotificationPlatformFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API PushNotificationPlatform readPushNotificationPlatformFromValue(const FString& value);
 
@@ -3351,6 +4532,15 @@ namespace ClientModels
             Platform(src.Platform)
             {}
 
+        FPushNotificationRegistrationModel(FPushNotificationRegistrationModel&& src) :
+            FPlayFabCppBaseModel(),
+            NotificationEndpointARN(MoveTemp(src.NotificationEndpointARN)),
+            Platform(MoveTemp(src.Platform))
+            {}
+
+        FPushNotificationRegistrationModel& operator=(const FPushNotificationRegistrationModel& src) = default;
+        FPushNotificationRegistrationModel& operator=(FPushNotificationRegistrationModel&& src) = default;
+
         FPushNotificationRegistrationModel(const TSharedPtr<FJsonObject>& obj) : FPushNotificationRegistrationModel()
         {
             readFromValue(obj);
@@ -3359,7 +4549,13 @@ namespace ClientModels
         ~FPushNotificationRegistrationModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStatisticModel : public PlayFab::FPlayFabCppBaseModel
@@ -3387,6 +4583,16 @@ namespace ClientModels
             Version(src.Version)
             {}
 
+        FStatisticModel(FStatisticModel&& src) :
+            FPlayFabCppBaseModel(),
+            Name(MoveTemp(src.Name)),
+            Value(MoveTemp(src.Value)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FStatisticModel& operator=(const FStatisticModel& src) = default;
+        FStatisticModel& operator=(FStatisticModel&& src) = default;
+
         FStatisticModel(const TSharedPtr<FJsonObject>& obj) : FStatisticModel()
         {
             readFromValue(obj);
@@ -3395,7 +4601,13 @@ namespace ClientModels
         ~FStatisticModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FTagModel : public PlayFab::FPlayFabCppBaseModel
@@ -3413,6 +4625,14 @@ namespace ClientModels
             TagValue(src.TagValue)
             {}
 
+        FTagModel(FTagModel&& src) :
+            FPlayFabCppBaseModel(),
+            TagValue(MoveTemp(src.TagValue))
+            {}
+
+        FTagModel& operator=(const FTagModel& src) = default;
+        FTagModel& operator=(FTagModel&& src) = default;
+
         FTagModel(const TSharedPtr<FJsonObject>& obj) : FTagModel()
         {
             readFromValue(obj);
@@ -3421,7 +4641,13 @@ namespace ClientModels
         ~FTagModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValueToDateModel : public PlayFab::FPlayFabCppBaseModel
@@ -3455,6 +4681,16 @@ namespace ClientModels
             TotalValueAsDecimal(src.TotalValueAsDecimal)
             {}
 
+        FValueToDateModel(FValueToDateModel&& src) :
+            FPlayFabCppBaseModel(),
+            Currency(MoveTemp(src.Currency)),
+            TotalValue(MoveTemp(src.TotalValue)),
+            TotalValueAsDecimal(MoveTemp(src.TotalValueAsDecimal))
+            {}
+
+        FValueToDateModel& operator=(const FValueToDateModel& src) = default;
+        FValueToDateModel& operator=(FValueToDateModel&& src) = default;
+
         FValueToDateModel(const TSharedPtr<FJsonObject>& obj) : FValueToDateModel()
         {
             readFromValue(obj);
@@ -3463,7 +4699,13 @@ namespace ClientModels
         ~FValueToDateModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerProfileModel : public PlayFab::FPlayFabCppBaseModel
@@ -3569,6 +4811,33 @@ namespace ClientModels
             ValuesToDate(src.ValuesToDate)
             {}
 
+        FPlayerProfileModel(FPlayerProfileModel&& src) :
+            FPlayFabCppBaseModel(),
+            AdCampaignAttributions(MoveTemp(src.AdCampaignAttributions)),
+            AvatarUrl(MoveTemp(src.AvatarUrl)),
+            BannedUntil(MoveTemp(src.BannedUntil)),
+            ContactEmailAddresses(MoveTemp(src.ContactEmailAddresses)),
+            Created(MoveTemp(src.Created)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            ExperimentVariants(MoveTemp(src.ExperimentVariants)),
+            LastLogin(MoveTemp(src.LastLogin)),
+            LinkedAccounts(MoveTemp(src.LinkedAccounts)),
+            Locations(MoveTemp(src.Locations)),
+            Memberships(MoveTemp(src.Memberships)),
+            Origination(MoveTemp(src.Origination)),
+            PlayerId(MoveTemp(src.PlayerId)),
+            PublisherId(MoveTemp(src.PublisherId)),
+            PushNotificationRegistrations(MoveTemp(src.PushNotificationRegistrations)),
+            Statistics(MoveTemp(src.Statistics)),
+            Tags(MoveTemp(src.Tags)),
+            TitleId(MoveTemp(src.TitleId)),
+            TotalValueToDateInUSD(MoveTemp(src.TotalValueToDateInUSD)),
+            ValuesToDate(MoveTemp(src.ValuesToDate))
+            {}
+
+        FPlayerProfileModel& operator=(const FPlayerProfileModel& src) = default;
+        FPlayerProfileModel& operator=(FPlayerProfileModel&& src) = default;
+
         FPlayerProfileModel(const TSharedPtr<FJsonObject>& obj) : FPlayerProfileModel()
         {
             readFromValue(obj);
@@ -3577,7 +4846,13 @@ namespace ClientModels
         ~FPlayerProfileModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserPsnInfo : public PlayFab::FPlayFabCppBaseModel
@@ -3600,6 +4875,15 @@ namespace ClientModels
             PsnOnlineId(src.PsnOnlineId)
             {}
 
+        FUserPsnInfo(FUserPsnInfo&& src) :
+            FPlayFabCppBaseModel(),
+            PsnAccountId(MoveTemp(src.PsnAccountId)),
+            PsnOnlineId(MoveTemp(src.PsnOnlineId))
+            {}
+
+        FUserPsnInfo& operator=(const FUserPsnInfo& src) = default;
+        FUserPsnInfo& operator=(FUserPsnInfo&& src) = default;
+
         FUserPsnInfo(const TSharedPtr<FJsonObject>& obj) : FUserPsnInfo()
         {
             readFromValue(obj);
@@ -3608,7 +4892,13 @@ namespace ClientModels
         ~FUserPsnInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum TitleActivationStatus
@@ -3621,6 +4911,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeTitleActivationStatusEnumJSON(TitleActivationStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeTitleActivationStatusEnumJSON(TitleActivationStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API TitleActivationStatus readTitleActivationStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API TitleActivationStatus readTitleActivationStatusFromValue(const FString& value);
 
@@ -3659,6 +4950,18 @@ namespace ClientModels
             SteamName(src.SteamName)
             {}
 
+        FUserSteamInfo(FUserSteamInfo&& src) :
+            FPlayFabCppBaseModel(),
+            SteamActivationStatus(MoveTemp(src.SteamActivationStatus)),
+            SteamCountry(MoveTemp(src.SteamCountry)),
+            SteamCurrency(MoveTemp(src.SteamCurrency)),
+            SteamId(MoveTemp(src.SteamId)),
+            SteamName(MoveTemp(src.SteamName))
+            {}
+
+        FUserSteamInfo& operator=(const FUserSteamInfo& src) = default;
+        FUserSteamInfo& operator=(FUserSteamInfo&& src) = default;
+
         FUserSteamInfo(const TSharedPtr<FJsonObject>& obj) : FUserSteamInfo()
         {
             readFromValue(obj);
@@ -3667,7 +4970,13 @@ namespace ClientModels
         ~FUserSteamInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserXboxInfo : public PlayFab::FPlayFabCppBaseModel
@@ -3685,6 +4994,14 @@ namespace ClientModels
             XboxUserId(src.XboxUserId)
             {}
 
+        FUserXboxInfo(FUserXboxInfo&& src) :
+            FPlayFabCppBaseModel(),
+            XboxUserId(MoveTemp(src.XboxUserId))
+            {}
+
+        FUserXboxInfo& operator=(const FUserXboxInfo& src) = default;
+        FUserXboxInfo& operator=(FUserXboxInfo&& src) = default;
+
         FUserXboxInfo(const TSharedPtr<FJsonObject>& obj) : FUserXboxInfo()
         {
             readFromValue(obj);
@@ -3693,7 +5010,13 @@ namespace ClientModels
         ~FUserXboxInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FFriendInfo : public PlayFab::FPlayFabCppBaseModel
@@ -3743,18 +5066,35 @@ namespace ClientModels
 
         FFriendInfo(const FFriendInfo& src) :
             FPlayFabCppBaseModel(),
-            FacebookInfo(src.FacebookInfo.IsValid() ? MakeShareable(new FUserFacebookInfo(*src.FacebookInfo)) : nullptr),
+            FacebookInfo(src.FacebookInfo.IsValid() ? TSharedPtr<FUserFacebookInfo>(MakeShared<FUserFacebookInfo>(*src.FacebookInfo)) : nullptr),
             FriendPlayFabId(src.FriendPlayFabId),
-            GameCenterInfo(src.GameCenterInfo.IsValid() ? MakeShareable(new FUserGameCenterInfo(*src.GameCenterInfo)) : nullptr),
-            Profile(src.Profile.IsValid() ? MakeShareable(new FPlayerProfileModel(*src.Profile)) : nullptr),
-            PSNInfo(src.PSNInfo.IsValid() ? MakeShareable(new FUserPsnInfo(*src.PSNInfo)) : nullptr),
-            SteamInfo(src.SteamInfo.IsValid() ? MakeShareable(new FUserSteamInfo(*src.SteamInfo)) : nullptr),
+            GameCenterInfo(src.GameCenterInfo.IsValid() ? TSharedPtr<FUserGameCenterInfo>(MakeShared<FUserGameCenterInfo>(*src.GameCenterInfo)) : nullptr),
+            Profile(src.Profile.IsValid() ? TSharedPtr<FPlayerProfileModel>(MakeShared<FPlayerProfileModel>(*src.Profile)) : nullptr),
+            PSNInfo(src.PSNInfo.IsValid() ? TSharedPtr<FUserPsnInfo>(MakeShared<FUserPsnInfo>(*src.PSNInfo)) : nullptr),
+            SteamInfo(src.SteamInfo.IsValid() ? TSharedPtr<FUserSteamInfo>(MakeShared<FUserSteamInfo>(*src.SteamInfo)) : nullptr),
             Tags(src.Tags),
             TitleDisplayName(src.TitleDisplayName),
             Username(src.Username),
-            XboxInfo(src.XboxInfo.IsValid() ? MakeShareable(new FUserXboxInfo(*src.XboxInfo)) : nullptr)
+            XboxInfo(src.XboxInfo.IsValid() ? TSharedPtr<FUserXboxInfo>(MakeShared<FUserXboxInfo>(*src.XboxInfo)) : nullptr)
+            {}
+
+        FFriendInfo(FFriendInfo&& src) :
+            FPlayFabCppBaseModel(),
+            FacebookInfo(MoveTemp(src.FacebookInfo)),
+            FriendPlayFabId(MoveTemp(src.FriendPlayFabId)),
+            GameCenterInfo(MoveTemp(src.GameCenterInfo)),
+            Profile(MoveTemp(src.Profile)),
+            PSNInfo(MoveTemp(src.PSNInfo)),
+            SteamInfo(MoveTemp(src.SteamInfo)),
+            Tags(MoveTemp(src.Tags)),
+            TitleDisplayName(MoveTemp(src.TitleDisplayName)),
+            Username(MoveTemp(src.Username)),
+            XboxInfo(MoveTemp(src.XboxInfo))
             {}
 
+        FFriendInfo& operator=(const FFriendInfo& src) = default;
+        FFriendInfo& operator=(FFriendInfo&& src) = default;
+
         FFriendInfo(const TSharedPtr<FJsonObject>& obj) : FFriendInfo()
         {
             readFromValue(obj);
@@ -3763,7 +5103,13 @@ namespace ClientModels
         ~FFriendInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGameCenterPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -3786,6 +5132,15 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGameCenterPlayFabIdPair(FGameCenterPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            GameCenterId(MoveTemp(src.GameCenterId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGameCenterPlayFabIdPair& operator=(const FGameCenterPlayFabIdPair& src) = default;
+        FGameCenterPlayFabIdPair& operator=(FGameCenterPlayFabIdPair&& src) = default;
+
         FGameCenterPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FGameCenterPlayFabIdPair()
         {
             readFromValue(obj);
@@ -3794,7 +5149,13 @@ namespace ClientModels
         ~FGameCenterPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGameServerRegionsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3820,6 +5181,15 @@ namespace ClientModels
             TitleId(src.TitleId)
             {}
 
+        FGameServerRegionsRequest(FGameServerRegionsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildVersion(MoveTemp(src.BuildVersion)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FGameServerRegionsRequest& operator=(const FGameServerRegionsRequest& src) = default;
+        FGameServerRegionsRequest& operator=(FGameServerRegionsRequest&& src) = default;
+
         FGameServerRegionsRequest(const TSharedPtr<FJsonObject>& obj) : FGameServerRegionsRequest()
         {
             readFromValue(obj);
@@ -3828,7 +5198,13 @@ namespace ClientModels
         ~FGameServerRegionsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRegionInfo : public PlayFab::FPlayFabCppBaseModel
@@ -3861,6 +5237,17 @@ namespace ClientModels
             pfRegion(src.pfRegion)
             {}
 
+        FRegionInfo(FRegionInfo&& src) :
+            FPlayFabCppBaseModel(),
+            Available(MoveTemp(src.Available)),
+            Name(MoveTemp(src.Name)),
+            PingUrl(MoveTemp(src.PingUrl)),
+            pfRegion(MoveTemp(src.pfRegion))
+            {}
+
+        FRegionInfo& operator=(const FRegionInfo& src) = default;
+        FRegionInfo& operator=(FRegionInfo&& src) = default;
+
         FRegionInfo(const TSharedPtr<FJsonObject>& obj) : FRegionInfo()
         {
             readFromValue(obj);
@@ -3869,7 +5256,13 @@ namespace ClientModels
         ~FRegionInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGameServerRegionsResult : public PlayFab::FPlayFabCppResultCommon
@@ -3886,6 +5279,14 @@ namespace ClientModels
             Regions(src.Regions)
             {}
 
+        FGameServerRegionsResult(FGameServerRegionsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Regions(MoveTemp(src.Regions))
+            {}
+
+        FGameServerRegionsResult& operator=(const FGameServerRegionsResult& src) = default;
+        FGameServerRegionsResult& operator=(FGameServerRegionsResult&& src) = default;
+
         FGameServerRegionsResult(const TSharedPtr<FJsonObject>& obj) : FGameServerRegionsResult()
         {
             readFromValue(obj);
@@ -3894,7 +5295,13 @@ namespace ClientModels
         ~FGameServerRegionsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGenericPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -3913,10 +5320,19 @@ namespace ClientModels
 
         FGenericPlayFabIdPair(const FGenericPlayFabIdPair& src) :
             FPlayFabCppBaseModel(),
-            GenericId(src.GenericId.IsValid() ? MakeShareable(new FGenericServiceId(*src.GenericId)) : nullptr),
+            GenericId(src.GenericId.IsValid() ? TSharedPtr<FGenericServiceId>(MakeShared<FGenericServiceId>(*src.GenericId)) : nullptr),
             PlayFabId(src.PlayFabId)
             {}
 
+        FGenericPlayFabIdPair(FGenericPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            GenericId(MoveTemp(src.GenericId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGenericPlayFabIdPair& operator=(const FGenericPlayFabIdPair& src) = default;
+        FGenericPlayFabIdPair& operator=(FGenericPlayFabIdPair&& src) = default;
+
         FGenericPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FGenericPlayFabIdPair()
         {
             readFromValue(obj);
@@ -3925,7 +5341,13 @@ namespace ClientModels
         ~FGenericPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetAccountInfoRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3964,6 +5386,17 @@ namespace ClientModels
             Username(src.Username)
             {}
 
+        FGetAccountInfoRequest(FGetAccountInfoRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Email(MoveTemp(src.Email)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            TitleDisplayName(MoveTemp(src.TitleDisplayName)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FGetAccountInfoRequest& operator=(const FGetAccountInfoRequest& src) = default;
+        FGetAccountInfoRequest& operator=(FGetAccountInfoRequest&& src) = default;
+
         FGetAccountInfoRequest(const TSharedPtr<FJsonObject>& obj) : FGetAccountInfoRequest()
         {
             readFromValue(obj);
@@ -3972,7 +5405,13 @@ namespace ClientModels
         ~FGetAccountInfoRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserAndroidDeviceInfo : public PlayFab::FPlayFabCppBaseModel
@@ -3990,6 +5429,14 @@ namespace ClientModels
             AndroidDeviceId(src.AndroidDeviceId)
             {}
 
+        FUserAndroidDeviceInfo(FUserAndroidDeviceInfo&& src) :
+            FPlayFabCppBaseModel(),
+            AndroidDeviceId(MoveTemp(src.AndroidDeviceId))
+            {}
+
+        FUserAndroidDeviceInfo& operator=(const FUserAndroidDeviceInfo& src) = default;
+        FUserAndroidDeviceInfo& operator=(FUserAndroidDeviceInfo&& src) = default;
+
         FUserAndroidDeviceInfo(const TSharedPtr<FJsonObject>& obj) : FUserAndroidDeviceInfo()
         {
             readFromValue(obj);
@@ -3998,7 +5445,13 @@ namespace ClientModels
         ~FUserAndroidDeviceInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserAppleIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4016,6 +5469,14 @@ namespace ClientModels
             AppleSubjectId(src.AppleSubjectId)
             {}
 
+        FUserAppleIdInfo(FUserAppleIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            AppleSubjectId(MoveTemp(src.AppleSubjectId))
+            {}
+
+        FUserAppleIdInfo& operator=(const FUserAppleIdInfo& src) = default;
+        FUserAppleIdInfo& operator=(FUserAppleIdInfo&& src) = default;
+
         FUserAppleIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserAppleIdInfo()
         {
             readFromValue(obj);
@@ -4024,7 +5485,13 @@ namespace ClientModels
         ~FUserAppleIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserCustomIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4042,6 +5509,14 @@ namespace ClientModels
             CustomId(src.CustomId)
             {}
 
+        FUserCustomIdInfo(FUserCustomIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            CustomId(MoveTemp(src.CustomId))
+            {}
+
+        FUserCustomIdInfo& operator=(const FUserCustomIdInfo& src) = default;
+        FUserCustomIdInfo& operator=(FUserCustomIdInfo&& src) = default;
+
         FUserCustomIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserCustomIdInfo()
         {
             readFromValue(obj);
@@ -4050,7 +5525,13 @@ namespace ClientModels
         ~FUserCustomIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserFacebookInstantGamesIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4068,6 +5549,14 @@ namespace ClientModels
             FacebookInstantGamesId(src.FacebookInstantGamesId)
             {}
 
+        FUserFacebookInstantGamesIdInfo(FUserFacebookInstantGamesIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            FacebookInstantGamesId(MoveTemp(src.FacebookInstantGamesId))
+            {}
+
+        FUserFacebookInstantGamesIdInfo& operator=(const FUserFacebookInstantGamesIdInfo& src) = default;
+        FUserFacebookInstantGamesIdInfo& operator=(FUserFacebookInstantGamesIdInfo&& src) = default;
+
         FUserFacebookInstantGamesIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserFacebookInstantGamesIdInfo()
         {
             readFromValue(obj);
@@ -4076,7 +5565,13 @@ namespace ClientModels
         ~FUserFacebookInstantGamesIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserGoogleInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4114,6 +5609,18 @@ namespace ClientModels
             GoogleName(src.GoogleName)
             {}
 
+        FUserGoogleInfo(FUserGoogleInfo&& src) :
+            FPlayFabCppBaseModel(),
+            GoogleEmail(MoveTemp(src.GoogleEmail)),
+            GoogleGender(MoveTemp(src.GoogleGender)),
+            GoogleId(MoveTemp(src.GoogleId)),
+            GoogleLocale(MoveTemp(src.GoogleLocale)),
+            GoogleName(MoveTemp(src.GoogleName))
+            {}
+
+        FUserGoogleInfo& operator=(const FUserGoogleInfo& src) = default;
+        FUserGoogleInfo& operator=(FUserGoogleInfo&& src) = default;
+
         FUserGoogleInfo(const TSharedPtr<FJsonObject>& obj) : FUserGoogleInfo()
         {
             readFromValue(obj);
@@ -4122,7 +5629,13 @@ namespace ClientModels
         ~FUserGoogleInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserIosDeviceInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4140,6 +5653,14 @@ namespace ClientModels
             IosDeviceId(src.IosDeviceId)
             {}
 
+        FUserIosDeviceInfo(FUserIosDeviceInfo&& src) :
+            FPlayFabCppBaseModel(),
+            IosDeviceId(MoveTemp(src.IosDeviceId))
+            {}
+
+        FUserIosDeviceInfo& operator=(const FUserIosDeviceInfo& src) = default;
+        FUserIosDeviceInfo& operator=(FUserIosDeviceInfo&& src) = default;
+
         FUserIosDeviceInfo(const TSharedPtr<FJsonObject>& obj) : FUserIosDeviceInfo()
         {
             readFromValue(obj);
@@ -4148,7 +5669,13 @@ namespace ClientModels
         ~FUserIosDeviceInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserKongregateInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4171,6 +5698,15 @@ namespace ClientModels
             KongregateName(src.KongregateName)
             {}
 
+        FUserKongregateInfo(FUserKongregateInfo&& src) :
+            FPlayFabCppBaseModel(),
+            KongregateId(MoveTemp(src.KongregateId)),
+            KongregateName(MoveTemp(src.KongregateName))
+            {}
+
+        FUserKongregateInfo& operator=(const FUserKongregateInfo& src) = default;
+        FUserKongregateInfo& operator=(FUserKongregateInfo&& src) = default;
+
         FUserKongregateInfo(const TSharedPtr<FJsonObject>& obj) : FUserKongregateInfo()
         {
             readFromValue(obj);
@@ -4179,7 +5715,13 @@ namespace ClientModels
         ~FUserKongregateInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserNintendoSwitchAccountIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4197,6 +5739,14 @@ namespace ClientModels
             NintendoSwitchAccountSubjectId(src.NintendoSwitchAccountSubjectId)
             {}
 
+        FUserNintendoSwitchAccountIdInfo(FUserNintendoSwitchAccountIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            NintendoSwitchAccountSubjectId(MoveTemp(src.NintendoSwitchAccountSubjectId))
+            {}
+
+        FUserNintendoSwitchAccountIdInfo& operator=(const FUserNintendoSwitchAccountIdInfo& src) = default;
+        FUserNintendoSwitchAccountIdInfo& operator=(FUserNintendoSwitchAccountIdInfo&& src) = default;
+
         FUserNintendoSwitchAccountIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserNintendoSwitchAccountIdInfo()
         {
             readFromValue(obj);
@@ -4205,7 +5755,13 @@ namespace ClientModels
         ~FUserNintendoSwitchAccountIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserNintendoSwitchDeviceIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4223,6 +5779,14 @@ namespace ClientModels
             NintendoSwitchDeviceId(src.NintendoSwitchDeviceId)
             {}
 
+        FUserNintendoSwitchDeviceIdInfo(FUserNintendoSwitchDeviceIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            NintendoSwitchDeviceId(MoveTemp(src.NintendoSwitchDeviceId))
+            {}
+
+        FUserNintendoSwitchDeviceIdInfo& operator=(const FUserNintendoSwitchDeviceIdInfo& src) = default;
+        FUserNintendoSwitchDeviceIdInfo& operator=(FUserNintendoSwitchDeviceIdInfo&& src) = default;
+
         FUserNintendoSwitchDeviceIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserNintendoSwitchDeviceIdInfo()
         {
             readFromValue(obj);
@@ -4231,7 +5795,13 @@ namespace ClientModels
         ~FUserNintendoSwitchDeviceIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserOpenIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4259,6 +5829,16 @@ namespace ClientModels
             Subject(src.Subject)
             {}
 
+        FUserOpenIdInfo(FUserOpenIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            ConnectionId(MoveTemp(src.ConnectionId)),
+            Issuer(MoveTemp(src.Issuer)),
+            Subject(MoveTemp(src.Subject))
+            {}
+
+        FUserOpenIdInfo& operator=(const FUserOpenIdInfo& src) = default;
+        FUserOpenIdInfo& operator=(FUserOpenIdInfo&& src) = default;
+
         FUserOpenIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserOpenIdInfo()
         {
             readFromValue(obj);
@@ -4267,7 +5847,13 @@ namespace ClientModels
         ~FUserOpenIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserPrivateAccountInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4285,6 +5871,14 @@ namespace ClientModels
             Email(src.Email)
             {}
 
+        FUserPrivateAccountInfo(FUserPrivateAccountInfo&& src) :
+            FPlayFabCppBaseModel(),
+            Email(MoveTemp(src.Email))
+            {}
+
+        FUserPrivateAccountInfo& operator=(const FUserPrivateAccountInfo& src) = default;
+        FUserPrivateAccountInfo& operator=(FUserPrivateAccountInfo&& src) = default;
+
         FUserPrivateAccountInfo(const TSharedPtr<FJsonObject>& obj) : FUserPrivateAccountInfo()
         {
             readFromValue(obj);
@@ -4293,7 +5887,13 @@ namespace ClientModels
         ~FUserPrivateAccountInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum UserOrigination
@@ -4325,6 +5925,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeUserOriginationEnumJSON(UserOrigination enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeUserOriginationEnumJSON(UserOrigination enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API UserOrigination readUserOriginationFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API UserOrigination readUserOriginationFromValue(const FString& value);
 
@@ -4381,9 +5982,24 @@ namespace ClientModels
             isBanned(src.isBanned),
             LastLogin(src.LastLogin),
             Origination(src.Origination),
-            TitlePlayerAccount(src.TitlePlayerAccount.IsValid() ? MakeShareable(new FEntityKey(*src.TitlePlayerAccount)) : nullptr)
+            TitlePlayerAccount(src.TitlePlayerAccount.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.TitlePlayerAccount)) : nullptr)
+            {}
+
+        FUserTitleInfo(FUserTitleInfo&& src) :
+            FPlayFabCppBaseModel(),
+            AvatarUrl(MoveTemp(src.AvatarUrl)),
+            Created(MoveTemp(src.Created)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            FirstLogin(MoveTemp(src.FirstLogin)),
+            isBanned(MoveTemp(src.isBanned)),
+            LastLogin(MoveTemp(src.LastLogin)),
+            Origination(MoveTemp(src.Origination)),
+            TitlePlayerAccount(MoveTemp(src.TitlePlayerAccount))
             {}
 
+        FUserTitleInfo& operator=(const FUserTitleInfo& src) = default;
+        FUserTitleInfo& operator=(FUserTitleInfo&& src) = default;
+
         FUserTitleInfo(const TSharedPtr<FJsonObject>& obj) : FUserTitleInfo()
         {
             readFromValue(obj);
@@ -4392,7 +6008,13 @@ namespace ClientModels
         ~FUserTitleInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserTwitchInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4415,6 +6037,15 @@ namespace ClientModels
             TwitchUserName(src.TwitchUserName)
             {}
 
+        FUserTwitchInfo(FUserTwitchInfo&& src) :
+            FPlayFabCppBaseModel(),
+            TwitchId(MoveTemp(src.TwitchId)),
+            TwitchUserName(MoveTemp(src.TwitchUserName))
+            {}
+
+        FUserTwitchInfo& operator=(const FUserTwitchInfo& src) = default;
+        FUserTwitchInfo& operator=(FUserTwitchInfo&& src) = default;
+
         FUserTwitchInfo(const TSharedPtr<FJsonObject>& obj) : FUserTwitchInfo()
         {
             readFromValue(obj);
@@ -4423,7 +6054,13 @@ namespace ClientModels
         ~FUserTwitchInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserWindowsHelloInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4446,6 +6083,15 @@ namespace ClientModels
             WindowsHelloPublicKeyHash(src.WindowsHelloPublicKeyHash)
             {}
 
+        FUserWindowsHelloInfo(FUserWindowsHelloInfo&& src) :
+            FPlayFabCppBaseModel(),
+            WindowsHelloDeviceName(MoveTemp(src.WindowsHelloDeviceName)),
+            WindowsHelloPublicKeyHash(MoveTemp(src.WindowsHelloPublicKeyHash))
+            {}
+
+        FUserWindowsHelloInfo& operator=(const FUserWindowsHelloInfo& src) = default;
+        FUserWindowsHelloInfo& operator=(FUserWindowsHelloInfo&& src) = default;
+
         FUserWindowsHelloInfo(const TSharedPtr<FJsonObject>& obj) : FUserWindowsHelloInfo()
         {
             readFromValue(obj);
@@ -4454,7 +6100,13 @@ namespace ClientModels
         ~FUserWindowsHelloInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserAccountInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4552,30 +6204,59 @@ namespace ClientModels
 
         FUserAccountInfo(const FUserAccountInfo& src) :
             FPlayFabCppBaseModel(),
-            AndroidDeviceInfo(src.AndroidDeviceInfo.IsValid() ? MakeShareable(new FUserAndroidDeviceInfo(*src.AndroidDeviceInfo)) : nullptr),
-            AppleAccountInfo(src.AppleAccountInfo.IsValid() ? MakeShareable(new FUserAppleIdInfo(*src.AppleAccountInfo)) : nullptr),
+            AndroidDeviceInfo(src.AndroidDeviceInfo.IsValid() ? TSharedPtr<FUserAndroidDeviceInfo>(MakeShared<FUserAndroidDeviceInfo>(*src.AndroidDeviceInfo)) : nullptr),
+            AppleAccountInfo(src.AppleAccountInfo.IsValid() ? TSharedPtr<FUserAppleIdInfo>(MakeShared<FUserAppleIdInfo>(*src.AppleAccountInfo)) : nullptr),
             Created(src.Created),
-            CustomIdInfo(src.CustomIdInfo.IsValid() ? MakeShareable(new FUserCustomIdInfo(*src.CustomIdInfo)) : nullptr),
-            FacebookInfo(src.FacebookInfo.IsValid() ? MakeShareable(new FUserFacebookInfo(*src.FacebookInfo)) : nullptr),
-            FacebookInstantGamesIdInfo(src.FacebookInstantGamesIdInfo.IsValid() ? MakeShareable(new FUserFacebookInstantGamesIdInfo(*src.FacebookInstantGamesIdInfo)) : nullptr),
-            GameCenterInfo(src.GameCenterInfo.IsValid() ? MakeShareable(new FUserGameCenterInfo(*src.GameCenterInfo)) : nullptr),
-            GoogleInfo(src.GoogleInfo.IsValid() ? MakeShareable(new FUserGoogleInfo(*src.GoogleInfo)) : nullptr),
-            IosDeviceInfo(src.IosDeviceInfo.IsValid() ? MakeShareable(new FUserIosDeviceInfo(*src.IosDeviceInfo)) : nullptr),
-            KongregateInfo(src.KongregateInfo.IsValid() ? MakeShareable(new FUserKongregateInfo(*src.KongregateInfo)) : nullptr),
-            NintendoSwitchAccountInfo(src.NintendoSwitchAccountInfo.IsValid() ? MakeShareable(new FUserNintendoSwitchAccountIdInfo(*src.NintendoSwitchAccountInfo)) : nullptr),
-            NintendoSwitchDeviceIdInfo(src.NintendoSwitchDeviceIdInfo.IsValid() ? MakeShareable(new FUserNintendoSwitchDeviceIdInfo(*src.NintendoSwitchDeviceIdInfo)) : nullptr),
+            CustomIdInfo(src.CustomIdInfo.IsValid() ? TSharedPtr<FUserCustomIdInfo>(MakeShared<FUserCustomIdInfo>(*src.CustomIdInfo)) : nullptr),
+            FacebookInfo(src.FacebookInfo.IsValid() ? TSharedPtr<FUserFacebookInfo>(MakeShared<FUserFacebookInfo>(*src.FacebookInfo)) : nullptr),
+            FacebookInstantGamesIdInfo(src.FacebookInstantGamesIdInfo.IsValid() ? TSharedPtr<FUserFacebookInstantGamesIdInfo>(MakeShared<FUserFacebookInstantGamesIdInfo>(*src.FacebookInstantGamesIdInfo)) : nullptr),
+            GameCenterInfo(src.GameCenterInfo.IsValid() ? TSharedPtr<FUserGameCenterInfo>(MakeShared<FUserGameCenterInfo>(*src.GameCenterInfo)) : nullptr),
+            GoogleInfo(src.GoogleInfo.IsValid() ? TSharedPtr<FUserGoogleInfo>(MakeShared<FUserGoogleInfo>(*src.GoogleInfo)) : nullptr),
+            IosDeviceInfo(src.IosDeviceInfo.IsValid() ? TSharedPtr<FUserIosDeviceInfo>(MakeShared<FUserIosDeviceInfo>(*src.IosDeviceInfo)) : nullptr),
+            KongregateInfo(src.KongregateInfo.IsValid() ? TSharedPtr<FUserKongregateInfo>(MakeShared<FUserKongregateInfo>(*src.KongregateInfo)) : nullptr),
+            NintendoSwitchAccountInfo(src.NintendoSwitchAccountInfo.IsValid() ? TSharedPtr<FUserNintendoSwitchAccountIdInfo>(MakeShared<FUserNintendoSwitchAccountIdInfo>(*src.NintendoSwitchAccountInfo)) : nullptr),
+            NintendoSwitchDeviceIdInfo(src.NintendoSwitchDeviceIdInfo.IsValid() ? TSharedPtr<FUserNintendoSwitchDeviceIdInfo>(MakeShared<FUserNintendoSwitchDeviceIdInfo>(*src.NintendoSwitchDeviceIdInfo)) : nullptr),
             OpenIdInfo(src.OpenIdInfo),
             PlayFabId(src.PlayFabId),
-            PrivateInfo(src.PrivateInfo.IsValid() ? MakeShareable(new FUserPrivateAccountInfo(*src.PrivateInfo)) : nullptr),
-            PsnInfo(src.PsnInfo.IsValid() ? MakeShareable(new FUserPsnInfo(*src.PsnInfo)) : nullptr),
-            SteamInfo(src.SteamInfo.IsValid() ? MakeShareable(new FUserSteamInfo(*src.SteamInfo)) : nullptr),
-            TitleInfo(src.TitleInfo.IsValid() ? MakeShareable(new FUserTitleInfo(*src.TitleInfo)) : nullptr),
-            TwitchInfo(src.TwitchInfo.IsValid() ? MakeShareable(new FUserTwitchInfo(*src.TwitchInfo)) : nullptr),
+            PrivateInfo(src.PrivateInfo.IsValid() ? TSharedPtr<FUserPrivateAccountInfo>(MakeShared<FUserPrivateAccountInfo>(*src.PrivateInfo)) : nullptr),
+            PsnInfo(src.PsnInfo.IsValid() ? TSharedPtr<FUserPsnInfo>(MakeShared<FUserPsnInfo>(*src.PsnInfo)) : nullptr),
+            SteamInfo(src.SteamInfo.IsValid() ? TSharedPtr<FUserSteamInfo>(MakeShared<FUserSteamInfo>(*src.SteamInfo)) : nullptr),
+            TitleInfo(src.TitleInfo.IsValid() ? TSharedPtr<FUserTitleInfo>(MakeShared<FUserTitleInfo>(*src.TitleInfo)) : nullptr),
+            TwitchInfo(src.TwitchInfo.IsValid() ? TSharedPtr<FUserTwitchInfo>(MakeShared<FUserTwitchInfo>(*src.TwitchInfo)) : nullptr),
             Username(src.Username),
-            WindowsHelloInfo(src.WindowsHelloInfo.IsValid() ? MakeShareable(new FUserWindowsHelloInfo(*src.WindowsHelloInfo)) : nullptr),
-            XboxInfo(src.XboxInfo.IsValid() ? MakeShareable(new FUserXboxInfo(*src.XboxInfo)) : nullptr)
+            WindowsHelloInfo(src.WindowsHelloInfo.IsValid() ? TSharedPtr<FUserWindowsHelloInfo>(MakeShared<FUserWindowsHelloInfo>(*src.WindowsHelloInfo)) : nullptr),
+            XboxInfo(src.XboxInfo.IsValid() ? TSharedPtr<FUserXboxInfo>(MakeShared<FUserXboxInfo>(*src.XboxInfo)) : nullptr)
             {}
 
+        FUserAccountInfo(FUserAccountInfo&& src) :
+            FPlayFabCppBaseModel(),
+            AndroidDeviceInfo(MoveTemp(src.AndroidDeviceInfo)),
+            AppleAccountInfo(MoveTemp(src.AppleAccountInfo)),
+            Created(MoveTemp(src.Created)),
+            CustomIdInfo(MoveTemp(src.CustomIdInfo)),
+            FacebookInfo(MoveTemp(src.FacebookInfo)),
+            FacebookInstantGamesIdInfo(MoveTemp(src.FacebookInstantGamesIdInfo)),
+            GameCenterInfo(MoveTemp(src.GameCenterInfo)),
+            GoogleInfo(MoveTemp(src.GoogleInfo)),
+            IosDeviceInfo(MoveTemp(src.IosDeviceInfo)),
+            KongregateInfo(MoveTemp(src.KongregateInfo)),
+            NintendoSwitchAccountInfo(MoveTemp(src.NintendoSwitchAccountInfo)),
+            NintendoSwitchDeviceIdInfo(MoveTemp(src.NintendoSwitchDeviceIdInfo)),
+            OpenIdInfo(MoveTemp(src.OpenIdInfo)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            PrivateInfo(MoveTemp(src.PrivateInfo)),
+            PsnInfo(MoveTemp(src.PsnInfo)),
+            SteamInfo(MoveTemp(src.SteamInfo)),
+            TitleInfo(MoveTemp(src.TitleInfo)),
+            TwitchInfo(MoveTemp(src.TwitchInfo)),
+            Username(MoveTemp(src.Username)),
+            WindowsHelloInfo(MoveTemp(src.WindowsHelloInfo)),
+            XboxInfo(MoveTemp(src.XboxInfo))
+            {}
+
+        FUserAccountInfo& operator=(const FUserAccountInfo& src) = default;
+        FUserAccountInfo& operator=(FUserAccountInfo&& src) = default;
+
         FUserAccountInfo(const TSharedPtr<FJsonObject>& obj) : FUserAccountInfo()
         {
             readFromValue(obj);
@@ -4584,7 +6265,13 @@ namespace ClientModels
         ~FUserAccountInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetAccountInfoResult : public PlayFab::FPlayFabCppResultCommon
@@ -4599,9 +6286,17 @@ namespace ClientModels
 
         FGetAccountInfoResult(const FGetAccountInfoResult& src) :
             FPlayFabCppResultCommon(),
-            AccountInfo(src.AccountInfo.IsValid() ? MakeShareable(new FUserAccountInfo(*src.AccountInfo)) : nullptr)
+            AccountInfo(src.AccountInfo.IsValid() ? TSharedPtr<FUserAccountInfo>(MakeShared<FUserAccountInfo>(*src.AccountInfo)) : nullptr)
+            {}
+
+        FGetAccountInfoResult(FGetAccountInfoResult&& src) :
+            FPlayFabCppResultCommon(),
+            AccountInfo(MoveTemp(src.AccountInfo))
             {}
 
+        FGetAccountInfoResult& operator=(const FGetAccountInfoResult& src) = default;
+        FGetAccountInfoResult& operator=(FGetAccountInfoResult&& src) = default;
+
         FGetAccountInfoResult(const TSharedPtr<FJsonObject>& obj) : FGetAccountInfoResult()
         {
             readFromValue(obj);
@@ -4610,7 +6305,13 @@ namespace ClientModels
         ~FGetAccountInfoResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FNameIdentifier : public PlayFab::FPlayFabCppBaseModel
@@ -4633,6 +6334,15 @@ namespace ClientModels
             Name(src.Name)
             {}
 
+        FNameIdentifier(FNameIdentifier&& src) :
+            FPlayFabCppBaseModel(),
+            Id(MoveTemp(src.Id)),
+            Name(MoveTemp(src.Name))
+            {}
+
+        FNameIdentifier& operator=(const FNameIdentifier& src) = default;
+        FNameIdentifier& operator=(FNameIdentifier&& src) = default;
+
         FNameIdentifier(const TSharedPtr<FJsonObject>& obj) : FNameIdentifier()
         {
             readFromValue(obj);
@@ -4641,7 +6351,13 @@ namespace ClientModels
         ~FNameIdentifier();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetAdPlacementsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4661,9 +6377,18 @@ namespace ClientModels
         FGetAdPlacementsRequest(const FGetAdPlacementsRequest& src) :
             FPlayFabCppRequestCommon(),
             AppId(src.AppId),
-            Identifier(src.Identifier.IsValid() ? MakeShareable(new FNameIdentifier(*src.Identifier)) : nullptr)
+            Identifier(src.Identifier.IsValid() ? TSharedPtr<FNameIdentifier>(MakeShared<FNameIdentifier>(*src.Identifier)) : nullptr)
+            {}
+
+        FGetAdPlacementsRequest(FGetAdPlacementsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AppId(MoveTemp(src.AppId)),
+            Identifier(MoveTemp(src.Identifier))
             {}
 
+        FGetAdPlacementsRequest& operator=(const FGetAdPlacementsRequest& src) = default;
+        FGetAdPlacementsRequest& operator=(FGetAdPlacementsRequest&& src) = default;
+
         FGetAdPlacementsRequest(const TSharedPtr<FJsonObject>& obj) : FGetAdPlacementsRequest()
         {
             readFromValue(obj);
@@ -4672,7 +6397,13 @@ namespace ClientModels
         ~FGetAdPlacementsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetAdPlacementsResult : public PlayFab::FPlayFabCppResultCommon
@@ -4689,6 +6420,14 @@ namespace ClientModels
             AdPlacements(src.AdPlacements)
             {}
 
+        FGetAdPlacementsResult(FGetAdPlacementsResult&& src) :
+            FPlayFabCppResultCommon(),
+            AdPlacements(MoveTemp(src.AdPlacements))
+            {}
+
+        FGetAdPlacementsResult& operator=(const FGetAdPlacementsResult& src) = default;
+        FGetAdPlacementsResult& operator=(FGetAdPlacementsResult&& src) = default;
+
         FGetAdPlacementsResult(const TSharedPtr<FJsonObject>& obj) : FGetAdPlacementsResult()
         {
             readFromValue(obj);
@@ -4697,7 +6436,13 @@ namespace ClientModels
         ~FGetAdPlacementsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCatalogItemsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4715,7 +6460,15 @@ namespace ClientModels
             CatalogVersion(src.CatalogVersion)
             {}
 
-        FGetCatalogItemsRequest(const TSharedPtr<FJsonObject>& obj) : FGetCatalogItemsRequest()
+        FGetCatalogItemsRequest(FGetCatalogItemsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion))
+            {}
+
+        FGetCatalogItemsRequest& operator=(const FGetCatalogItemsRequest& src) = default;
+        FGetCatalogItemsRequest& operator=(FGetCatalogItemsRequest&& src) = default;
+
+        FGetCatalogItemsRequest(const TSharedPtr<FJsonObject>& obj) : FGetCatalogItemsRequest()
         {
             readFromValue(obj);
         }
@@ -4723,7 +6476,13 @@ namespace ClientModels
         ~FGetCatalogItemsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCatalogItemsResult : public PlayFab::FPlayFabCppResultCommon
@@ -4740,6 +6499,14 @@ namespace ClientModels
             Catalog(src.Catalog)
             {}
 
+        FGetCatalogItemsResult(FGetCatalogItemsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Catalog(MoveTemp(src.Catalog))
+            {}
+
+        FGetCatalogItemsResult& operator=(const FGetCatalogItemsResult& src) = default;
+        FGetCatalogItemsResult& operator=(FGetCatalogItemsResult&& src) = default;
+
         FGetCatalogItemsResult(const TSharedPtr<FJsonObject>& obj) : FGetCatalogItemsResult()
         {
             readFromValue(obj);
@@ -4748,7 +6515,13 @@ namespace ClientModels
         ~FGetCatalogItemsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4783,6 +6556,17 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetCharacterDataRequest(FGetCharacterDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            IfChangedFromDataVersion(MoveTemp(src.IfChangedFromDataVersion)),
+            Keys(MoveTemp(src.Keys)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetCharacterDataRequest& operator=(const FGetCharacterDataRequest& src) = default;
+        FGetCharacterDataRequest& operator=(FGetCharacterDataRequest&& src) = default;
+
         FGetCharacterDataRequest(const TSharedPtr<FJsonObject>& obj) : FGetCharacterDataRequest()
         {
             readFromValue(obj);
@@ -4791,7 +6575,13 @@ namespace ClientModels
         ~FGetCharacterDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum UserDataPermission
@@ -4801,6 +6591,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeUserDataPermissionEnumJSON(UserDataPermission enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeUserDataPermissionEnumJSON(UserDataPermission enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API UserDataPermission readUserDataPermissionFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API UserDataPermission readUserDataPermissionFromValue(const FString& value);
 
@@ -4832,6 +6623,16 @@ namespace ClientModels
             Value(src.Value)
             {}
 
+        FUserDataRecord(FUserDataRecord&& src) :
+            FPlayFabCppBaseModel(),
+            LastUpdated(MoveTemp(src.LastUpdated)),
+            Permission(MoveTemp(src.Permission)),
+            Value(MoveTemp(src.Value))
+            {}
+
+        FUserDataRecord& operator=(const FUserDataRecord& src) = default;
+        FUserDataRecord& operator=(FUserDataRecord&& src) = default;
+
         FUserDataRecord(const TSharedPtr<FJsonObject>& obj) : FUserDataRecord()
         {
             readFromValue(obj);
@@ -4840,7 +6641,13 @@ namespace ClientModels
         ~FUserDataRecord();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -4870,6 +6677,16 @@ namespace ClientModels
             DataVersion(src.DataVersion)
             {}
 
+        FGetCharacterDataResult(FGetCharacterDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            Data(MoveTemp(src.Data)),
+            DataVersion(MoveTemp(src.DataVersion))
+            {}
+
+        FGetCharacterDataResult& operator=(const FGetCharacterDataResult& src) = default;
+        FGetCharacterDataResult& operator=(FGetCharacterDataResult&& src) = default;
+
         FGetCharacterDataResult(const TSharedPtr<FJsonObject>& obj) : FGetCharacterDataResult()
         {
             readFromValue(obj);
@@ -4878,7 +6695,13 @@ namespace ClientModels
         ~FGetCharacterDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterInventoryRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4905,6 +6728,16 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FGetCharacterInventoryRequest(FGetCharacterInventoryRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FGetCharacterInventoryRequest& operator=(const FGetCharacterInventoryRequest& src) = default;
+        FGetCharacterInventoryRequest& operator=(FGetCharacterInventoryRequest&& src) = default;
+
         FGetCharacterInventoryRequest(const TSharedPtr<FJsonObject>& obj) : FGetCharacterInventoryRequest()
         {
             readFromValue(obj);
@@ -4913,7 +6746,13 @@ namespace ClientModels
         ~FGetCharacterInventoryRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FVirtualCurrencyRechargeTime : public PlayFab::FPlayFabCppBaseModel
@@ -4945,6 +6784,16 @@ namespace ClientModels
             SecondsToRecharge(src.SecondsToRecharge)
             {}
 
+        FVirtualCurrencyRechargeTime(FVirtualCurrencyRechargeTime&& src) :
+            FPlayFabCppBaseModel(),
+            RechargeMax(MoveTemp(src.RechargeMax)),
+            RechargeTime(MoveTemp(src.RechargeTime)),
+            SecondsToRecharge(MoveTemp(src.SecondsToRecharge))
+            {}
+
+        FVirtualCurrencyRechargeTime& operator=(const FVirtualCurrencyRechargeTime& src) = default;
+        FVirtualCurrencyRechargeTime& operator=(FVirtualCurrencyRechargeTime&& src) = default;
+
         FVirtualCurrencyRechargeTime(const TSharedPtr<FJsonObject>& obj) : FVirtualCurrencyRechargeTime()
         {
             readFromValue(obj);
@@ -4953,7 +6802,13 @@ namespace ClientModels
         ~FVirtualCurrencyRechargeTime();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterInventoryResult : public PlayFab::FPlayFabCppResultCommon
@@ -4983,6 +6838,17 @@ namespace ClientModels
             VirtualCurrencyRechargeTimes(src.VirtualCurrencyRechargeTimes)
             {}
 
+        FGetCharacterInventoryResult(FGetCharacterInventoryResult&& src) :
+            FPlayFabCppResultCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            Inventory(MoveTemp(src.Inventory)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency)),
+            VirtualCurrencyRechargeTimes(MoveTemp(src.VirtualCurrencyRechargeTimes))
+            {}
+
+        FGetCharacterInventoryResult& operator=(const FGetCharacterInventoryResult& src) = default;
+        FGetCharacterInventoryResult& operator=(FGetCharacterInventoryResult&& src) = default;
+
         FGetCharacterInventoryResult(const TSharedPtr<FJsonObject>& obj) : FGetCharacterInventoryResult()
         {
             readFromValue(obj);
@@ -4991,7 +6857,13 @@ namespace ClientModels
         ~FGetCharacterInventoryResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterLeaderboardRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5024,6 +6896,17 @@ namespace ClientModels
             StatisticName(src.StatisticName)
             {}
 
+        FGetCharacterLeaderboardRequest(FGetCharacterLeaderboardRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterType(MoveTemp(src.CharacterType)),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            StartPosition(MoveTemp(src.StartPosition)),
+            StatisticName(MoveTemp(src.StatisticName))
+            {}
+
+        FGetCharacterLeaderboardRequest& operator=(const FGetCharacterLeaderboardRequest& src) = default;
+        FGetCharacterLeaderboardRequest& operator=(FGetCharacterLeaderboardRequest&& src) = default;
+
         FGetCharacterLeaderboardRequest(const TSharedPtr<FJsonObject>& obj) : FGetCharacterLeaderboardRequest()
         {
             readFromValue(obj);
@@ -5032,7 +6915,13 @@ namespace ClientModels
         ~FGetCharacterLeaderboardRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterLeaderboardResult : public PlayFab::FPlayFabCppResultCommon
@@ -5049,6 +6938,14 @@ namespace ClientModels
             Leaderboard(src.Leaderboard)
             {}
 
+        FGetCharacterLeaderboardResult(FGetCharacterLeaderboardResult&& src) :
+            FPlayFabCppResultCommon(),
+            Leaderboard(MoveTemp(src.Leaderboard))
+            {}
+
+        FGetCharacterLeaderboardResult& operator=(const FGetCharacterLeaderboardResult& src) = default;
+        FGetCharacterLeaderboardResult& operator=(FGetCharacterLeaderboardResult&& src) = default;
+
         FGetCharacterLeaderboardResult(const TSharedPtr<FJsonObject>& obj) : FGetCharacterLeaderboardResult()
         {
             readFromValue(obj);
@@ -5057,7 +6954,13 @@ namespace ClientModels
         ~FGetCharacterLeaderboardResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5075,6 +6978,14 @@ namespace ClientModels
             CharacterId(src.CharacterId)
             {}
 
+        FGetCharacterStatisticsRequest(FGetCharacterStatisticsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId))
+            {}
+
+        FGetCharacterStatisticsRequest& operator=(const FGetCharacterStatisticsRequest& src) = default;
+        FGetCharacterStatisticsRequest& operator=(FGetCharacterStatisticsRequest&& src) = default;
+
         FGetCharacterStatisticsRequest(const TSharedPtr<FJsonObject>& obj) : FGetCharacterStatisticsRequest()
         {
             readFromValue(obj);
@@ -5083,7 +6994,13 @@ namespace ClientModels
         ~FGetCharacterStatisticsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterStatisticsResult : public PlayFab::FPlayFabCppResultCommon
@@ -5100,6 +7017,14 @@ namespace ClientModels
             CharacterStatistics(src.CharacterStatistics)
             {}
 
+        FGetCharacterStatisticsResult(FGetCharacterStatisticsResult&& src) :
+            FPlayFabCppResultCommon(),
+            CharacterStatistics(MoveTemp(src.CharacterStatistics))
+            {}
+
+        FGetCharacterStatisticsResult& operator=(const FGetCharacterStatisticsResult& src) = default;
+        FGetCharacterStatisticsResult& operator=(FGetCharacterStatisticsResult&& src) = default;
+
         FGetCharacterStatisticsResult(const TSharedPtr<FJsonObject>& obj) : FGetCharacterStatisticsResult()
         {
             readFromValue(obj);
@@ -5108,7 +7033,13 @@ namespace ClientModels
         ~FGetCharacterStatisticsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetContentDownloadUrlRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5139,6 +7070,16 @@ namespace ClientModels
             ThruCDN(src.ThruCDN)
             {}
 
+        FGetContentDownloadUrlRequest(FGetContentDownloadUrlRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            HttpMethod(MoveTemp(src.HttpMethod)),
+            Key(MoveTemp(src.Key)),
+            ThruCDN(MoveTemp(src.ThruCDN))
+            {}
+
+        FGetContentDownloadUrlRequest& operator=(const FGetContentDownloadUrlRequest& src) = default;
+        FGetContentDownloadUrlRequest& operator=(FGetContentDownloadUrlRequest&& src) = default;
+
         FGetContentDownloadUrlRequest(const TSharedPtr<FJsonObject>& obj) : FGetContentDownloadUrlRequest()
         {
             readFromValue(obj);
@@ -5147,7 +7088,13 @@ namespace ClientModels
         ~FGetContentDownloadUrlRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetContentDownloadUrlResult : public PlayFab::FPlayFabCppResultCommon
@@ -5165,6 +7112,14 @@ namespace ClientModels
             URL(src.URL)
             {}
 
+        FGetContentDownloadUrlResult(FGetContentDownloadUrlResult&& src) :
+            FPlayFabCppResultCommon(),
+            URL(MoveTemp(src.URL))
+            {}
+
+        FGetContentDownloadUrlResult& operator=(const FGetContentDownloadUrlResult& src) = default;
+        FGetContentDownloadUrlResult& operator=(FGetContentDownloadUrlResult&& src) = default;
+
         FGetContentDownloadUrlResult(const TSharedPtr<FJsonObject>& obj) : FGetContentDownloadUrlResult()
         {
             readFromValue(obj);
@@ -5173,7 +7128,13 @@ namespace ClientModels
         ~FGetContentDownloadUrlResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerProfileViewConstraints : public PlayFab::FPlayFabCppBaseModel
@@ -5271,6 +7232,30 @@ namespace ClientModels
             ShowValuesToDate(src.ShowValuesToDate)
             {}
 
+        FPlayerProfileViewConstraints(FPlayerProfileViewConstraints&& src) :
+            FPlayFabCppBaseModel(),
+            ShowAvatarUrl(MoveTemp(src.ShowAvatarUrl)),
+            ShowBannedUntil(MoveTemp(src.ShowBannedUntil)),
+            ShowCampaignAttributions(MoveTemp(src.ShowCampaignAttributions)),
+            ShowContactEmailAddresses(MoveTemp(src.ShowContactEmailAddresses)),
+            ShowCreated(MoveTemp(src.ShowCreated)),
+            ShowDisplayName(MoveTemp(src.ShowDisplayName)),
+            ShowExperimentVariants(MoveTemp(src.ShowExperimentVariants)),
+            ShowLastLogin(MoveTemp(src.ShowLastLogin)),
+            ShowLinkedAccounts(MoveTemp(src.ShowLinkedAccounts)),
+            ShowLocations(MoveTemp(src.ShowLocations)),
+            ShowMemberships(MoveTemp(src.ShowMemberships)),
+            ShowOrigination(MoveTemp(src.ShowOrigination)),
+            ShowPushNotificationRegistrations(MoveTemp(src.ShowPushNotificationRegistrations)),
+            ShowStatistics(MoveTemp(src.ShowStatistics)),
+            ShowTags(MoveTemp(src.ShowTags)),
+            ShowTotalValueToDateInUsd(MoveTemp(src.ShowTotalValueToDateInUsd)),
+            ShowValuesToDate(MoveTemp(src.ShowValuesToDate))
+            {}
+
+        FPlayerProfileViewConstraints& operator=(const FPlayerProfileViewConstraints& src) = default;
+        FPlayerProfileViewConstraints& operator=(FPlayerProfileViewConstraints&& src) = default;
+
         FPlayerProfileViewConstraints(const TSharedPtr<FJsonObject>& obj) : FPlayerProfileViewConstraints()
         {
             readFromValue(obj);
@@ -5279,7 +7264,13 @@ namespace ClientModels
         ~FPlayerProfileViewConstraints();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetFriendLeaderboardAroundPlayerRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5338,13 +7329,30 @@ namespace ClientModels
             IncludeSteamFriends(src.IncludeSteamFriends),
             MaxResultsCount(src.MaxResultsCount),
             PlayFabId(src.PlayFabId),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr),
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr),
             StatisticName(src.StatisticName),
             UseSpecificVersion(src.UseSpecificVersion),
             Version(src.Version),
             XboxToken(src.XboxToken)
             {}
 
+        FGetFriendLeaderboardAroundPlayerRequest(FGetFriendLeaderboardAroundPlayerRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            IncludeFacebookFriends(MoveTemp(src.IncludeFacebookFriends)),
+            IncludeSteamFriends(MoveTemp(src.IncludeSteamFriends)),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            UseSpecificVersion(MoveTemp(src.UseSpecificVersion)),
+            Version(MoveTemp(src.Version)),
+            XboxToken(MoveTemp(src.XboxToken))
+            {}
+
+        FGetFriendLeaderboardAroundPlayerRequest& operator=(const FGetFriendLeaderboardAroundPlayerRequest& src) = default;
+        FGetFriendLeaderboardAroundPlayerRequest& operator=(FGetFriendLeaderboardAroundPlayerRequest&& src) = default;
+
         FGetFriendLeaderboardAroundPlayerRequest(const TSharedPtr<FJsonObject>& obj) : FGetFriendLeaderboardAroundPlayerRequest()
         {
             readFromValue(obj);
@@ -5353,7 +7361,13 @@ namespace ClientModels
         ~FGetFriendLeaderboardAroundPlayerRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerLeaderboardEntry : public PlayFab::FPlayFabCppBaseModel
@@ -5387,10 +7401,22 @@ namespace ClientModels
             DisplayName(src.DisplayName),
             PlayFabId(src.PlayFabId),
             Position(src.Position),
-            Profile(src.Profile.IsValid() ? MakeShareable(new FPlayerProfileModel(*src.Profile)) : nullptr),
+            Profile(src.Profile.IsValid() ? TSharedPtr<FPlayerProfileModel>(MakeShared<FPlayerProfileModel>(*src.Profile)) : nullptr),
             StatValue(src.StatValue)
             {}
 
+        FPlayerLeaderboardEntry(FPlayerLeaderboardEntry&& src) :
+            FPlayFabCppBaseModel(),
+            DisplayName(MoveTemp(src.DisplayName)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Position(MoveTemp(src.Position)),
+            Profile(MoveTemp(src.Profile)),
+            StatValue(MoveTemp(src.StatValue))
+            {}
+
+        FPlayerLeaderboardEntry& operator=(const FPlayerLeaderboardEntry& src) = default;
+        FPlayerLeaderboardEntry& operator=(FPlayerLeaderboardEntry&& src) = default;
+
         FPlayerLeaderboardEntry(const TSharedPtr<FJsonObject>& obj) : FPlayerLeaderboardEntry()
         {
             readFromValue(obj);
@@ -5399,7 +7425,13 @@ namespace ClientModels
         ~FPlayerLeaderboardEntry();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetFriendLeaderboardAroundPlayerResult : public PlayFab::FPlayFabCppResultCommon
@@ -5426,6 +7458,16 @@ namespace ClientModels
             Version(src.Version)
             {}
 
+        FGetFriendLeaderboardAroundPlayerResult(FGetFriendLeaderboardAroundPlayerResult&& src) :
+            FPlayFabCppResultCommon(),
+            Leaderboard(MoveTemp(src.Leaderboard)),
+            NextReset(MoveTemp(src.NextReset)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FGetFriendLeaderboardAroundPlayerResult& operator=(const FGetFriendLeaderboardAroundPlayerResult& src) = default;
+        FGetFriendLeaderboardAroundPlayerResult& operator=(FGetFriendLeaderboardAroundPlayerResult&& src) = default;
+
         FGetFriendLeaderboardAroundPlayerResult(const TSharedPtr<FJsonObject>& obj) : FGetFriendLeaderboardAroundPlayerResult()
         {
             readFromValue(obj);
@@ -5434,7 +7476,13 @@ namespace ClientModels
         ~FGetFriendLeaderboardAroundPlayerResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetFriendLeaderboardRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5492,7 +7540,7 @@ namespace ClientModels
             IncludeFacebookFriends(src.IncludeFacebookFriends),
             IncludeSteamFriends(src.IncludeSteamFriends),
             MaxResultsCount(src.MaxResultsCount),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr),
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr),
             StartPosition(src.StartPosition),
             StatisticName(src.StatisticName),
             UseSpecificVersion(src.UseSpecificVersion),
@@ -5500,6 +7548,23 @@ namespace ClientModels
             XboxToken(src.XboxToken)
             {}
 
+        FGetFriendLeaderboardRequest(FGetFriendLeaderboardRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            IncludeFacebookFriends(MoveTemp(src.IncludeFacebookFriends)),
+            IncludeSteamFriends(MoveTemp(src.IncludeSteamFriends)),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints)),
+            StartPosition(MoveTemp(src.StartPosition)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            UseSpecificVersion(MoveTemp(src.UseSpecificVersion)),
+            Version(MoveTemp(src.Version)),
+            XboxToken(MoveTemp(src.XboxToken))
+            {}
+
+        FGetFriendLeaderboardRequest& operator=(const FGetFriendLeaderboardRequest& src) = default;
+        FGetFriendLeaderboardRequest& operator=(FGetFriendLeaderboardRequest&& src) = default;
+
         FGetFriendLeaderboardRequest(const TSharedPtr<FJsonObject>& obj) : FGetFriendLeaderboardRequest()
         {
             readFromValue(obj);
@@ -5508,7 +7573,13 @@ namespace ClientModels
         ~FGetFriendLeaderboardRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetFriendsListRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5545,10 +7616,22 @@ namespace ClientModels
             CustomTags(src.CustomTags),
             IncludeFacebookFriends(src.IncludeFacebookFriends),
             IncludeSteamFriends(src.IncludeSteamFriends),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr),
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr),
             XboxToken(src.XboxToken)
             {}
 
+        FGetFriendsListRequest(FGetFriendsListRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            IncludeFacebookFriends(MoveTemp(src.IncludeFacebookFriends)),
+            IncludeSteamFriends(MoveTemp(src.IncludeSteamFriends)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints)),
+            XboxToken(MoveTemp(src.XboxToken))
+            {}
+
+        FGetFriendsListRequest& operator=(const FGetFriendsListRequest& src) = default;
+        FGetFriendsListRequest& operator=(FGetFriendsListRequest&& src) = default;
+
         FGetFriendsListRequest(const TSharedPtr<FJsonObject>& obj) : FGetFriendsListRequest()
         {
             readFromValue(obj);
@@ -5557,7 +7640,13 @@ namespace ClientModels
         ~FGetFriendsListRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetFriendsListResult : public PlayFab::FPlayFabCppResultCommon
@@ -5574,6 +7663,14 @@ namespace ClientModels
             Friends(src.Friends)
             {}
 
+        FGetFriendsListResult(FGetFriendsListResult&& src) :
+            FPlayFabCppResultCommon(),
+            Friends(MoveTemp(src.Friends))
+            {}
+
+        FGetFriendsListResult& operator=(const FGetFriendsListResult& src) = default;
+        FGetFriendsListResult& operator=(FGetFriendsListResult&& src) = default;
+
         FGetFriendsListResult(const TSharedPtr<FJsonObject>& obj) : FGetFriendsListResult()
         {
             readFromValue(obj);
@@ -5582,7 +7679,13 @@ namespace ClientModels
         ~FGetFriendsListResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardAroundCharacterRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5615,6 +7718,17 @@ namespace ClientModels
             StatisticName(src.StatisticName)
             {}
 
+        FGetLeaderboardAroundCharacterRequest(FGetLeaderboardAroundCharacterRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CharacterType(MoveTemp(src.CharacterType)),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            StatisticName(MoveTemp(src.StatisticName))
+            {}
+
+        FGetLeaderboardAroundCharacterRequest& operator=(const FGetLeaderboardAroundCharacterRequest& src) = default;
+        FGetLeaderboardAroundCharacterRequest& operator=(FGetLeaderboardAroundCharacterRequest&& src) = default;
+
         FGetLeaderboardAroundCharacterRequest(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardAroundCharacterRequest()
         {
             readFromValue(obj);
@@ -5623,7 +7737,13 @@ namespace ClientModels
         ~FGetLeaderboardAroundCharacterRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardAroundCharacterResult : public PlayFab::FPlayFabCppResultCommon
@@ -5640,6 +7760,14 @@ namespace ClientModels
             Leaderboard(src.Leaderboard)
             {}
 
+        FGetLeaderboardAroundCharacterResult(FGetLeaderboardAroundCharacterResult&& src) :
+            FPlayFabCppResultCommon(),
+            Leaderboard(MoveTemp(src.Leaderboard))
+            {}
+
+        FGetLeaderboardAroundCharacterResult& operator=(const FGetLeaderboardAroundCharacterResult& src) = default;
+        FGetLeaderboardAroundCharacterResult& operator=(FGetLeaderboardAroundCharacterResult&& src) = default;
+
         FGetLeaderboardAroundCharacterResult(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardAroundCharacterResult()
         {
             readFromValue(obj);
@@ -5648,7 +7776,13 @@ namespace ClientModels
         ~FGetLeaderboardAroundCharacterResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardAroundPlayerRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5693,12 +7827,26 @@ namespace ClientModels
             CustomTags(src.CustomTags),
             MaxResultsCount(src.MaxResultsCount),
             PlayFabId(src.PlayFabId),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr),
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr),
             StatisticName(src.StatisticName),
             UseSpecificVersion(src.UseSpecificVersion),
             Version(src.Version)
             {}
 
+        FGetLeaderboardAroundPlayerRequest(FGetLeaderboardAroundPlayerRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            UseSpecificVersion(MoveTemp(src.UseSpecificVersion)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FGetLeaderboardAroundPlayerRequest& operator=(const FGetLeaderboardAroundPlayerRequest& src) = default;
+        FGetLeaderboardAroundPlayerRequest& operator=(FGetLeaderboardAroundPlayerRequest&& src) = default;
+
         FGetLeaderboardAroundPlayerRequest(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardAroundPlayerRequest()
         {
             readFromValue(obj);
@@ -5707,7 +7855,13 @@ namespace ClientModels
         ~FGetLeaderboardAroundPlayerRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardAroundPlayerResult : public PlayFab::FPlayFabCppResultCommon
@@ -5734,6 +7888,16 @@ namespace ClientModels
             Version(src.Version)
             {}
 
+        FGetLeaderboardAroundPlayerResult(FGetLeaderboardAroundPlayerResult&& src) :
+            FPlayFabCppResultCommon(),
+            Leaderboard(MoveTemp(src.Leaderboard)),
+            NextReset(MoveTemp(src.NextReset)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FGetLeaderboardAroundPlayerResult& operator=(const FGetLeaderboardAroundPlayerResult& src) = default;
+        FGetLeaderboardAroundPlayerResult& operator=(FGetLeaderboardAroundPlayerResult&& src) = default;
+
         FGetLeaderboardAroundPlayerResult(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardAroundPlayerResult()
         {
             readFromValue(obj);
@@ -5742,7 +7906,13 @@ namespace ClientModels
         ~FGetLeaderboardAroundPlayerResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardForUsersCharactersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5765,6 +7935,15 @@ namespace ClientModels
             StatisticName(src.StatisticName)
             {}
 
+        FGetLeaderboardForUsersCharactersRequest(FGetLeaderboardForUsersCharactersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            StatisticName(MoveTemp(src.StatisticName))
+            {}
+
+        FGetLeaderboardForUsersCharactersRequest& operator=(const FGetLeaderboardForUsersCharactersRequest& src) = default;
+        FGetLeaderboardForUsersCharactersRequest& operator=(FGetLeaderboardForUsersCharactersRequest&& src) = default;
+
         FGetLeaderboardForUsersCharactersRequest(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardForUsersCharactersRequest()
         {
             readFromValue(obj);
@@ -5773,7 +7952,13 @@ namespace ClientModels
         ~FGetLeaderboardForUsersCharactersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardForUsersCharactersResult : public PlayFab::FPlayFabCppResultCommon
@@ -5790,6 +7975,14 @@ namespace ClientModels
             Leaderboard(src.Leaderboard)
             {}
 
+        FGetLeaderboardForUsersCharactersResult(FGetLeaderboardForUsersCharactersResult&& src) :
+            FPlayFabCppResultCommon(),
+            Leaderboard(MoveTemp(src.Leaderboard))
+            {}
+
+        FGetLeaderboardForUsersCharactersResult& operator=(const FGetLeaderboardForUsersCharactersResult& src) = default;
+        FGetLeaderboardForUsersCharactersResult& operator=(FGetLeaderboardForUsersCharactersResult&& src) = default;
+
         FGetLeaderboardForUsersCharactersResult(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardForUsersCharactersResult()
         {
             readFromValue(obj);
@@ -5798,7 +7991,13 @@ namespace ClientModels
         ~FGetLeaderboardForUsersCharactersResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5842,13 +8041,27 @@ namespace ClientModels
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
             MaxResultsCount(src.MaxResultsCount),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr),
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr),
             StartPosition(src.StartPosition),
             StatisticName(src.StatisticName),
             UseSpecificVersion(src.UseSpecificVersion),
             Version(src.Version)
             {}
 
+        FGetLeaderboardRequest(FGetLeaderboardRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints)),
+            StartPosition(MoveTemp(src.StartPosition)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            UseSpecificVersion(MoveTemp(src.UseSpecificVersion)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FGetLeaderboardRequest& operator=(const FGetLeaderboardRequest& src) = default;
+        FGetLeaderboardRequest& operator=(FGetLeaderboardRequest&& src) = default;
+
         FGetLeaderboardRequest(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardRequest()
         {
             readFromValue(obj);
@@ -5857,7 +8070,13 @@ namespace ClientModels
         ~FGetLeaderboardRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardResult : public PlayFab::FPlayFabCppResultCommon
@@ -5884,6 +8103,16 @@ namespace ClientModels
             Version(src.Version)
             {}
 
+        FGetLeaderboardResult(FGetLeaderboardResult&& src) :
+            FPlayFabCppResultCommon(),
+            Leaderboard(MoveTemp(src.Leaderboard)),
+            NextReset(MoveTemp(src.NextReset)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FGetLeaderboardResult& operator=(const FGetLeaderboardResult& src) = default;
+        FGetLeaderboardResult& operator=(FGetLeaderboardResult&& src) = default;
+
         FGetLeaderboardResult(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardResult()
         {
             readFromValue(obj);
@@ -5892,7 +8121,13 @@ namespace ClientModels
         ~FGetLeaderboardResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPaymentTokenRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5910,6 +8145,14 @@ namespace ClientModels
             TokenProvider(src.TokenProvider)
             {}
 
+        FGetPaymentTokenRequest(FGetPaymentTokenRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            TokenProvider(MoveTemp(src.TokenProvider))
+            {}
+
+        FGetPaymentTokenRequest& operator=(const FGetPaymentTokenRequest& src) = default;
+        FGetPaymentTokenRequest& operator=(FGetPaymentTokenRequest&& src) = default;
+
         FGetPaymentTokenRequest(const TSharedPtr<FJsonObject>& obj) : FGetPaymentTokenRequest()
         {
             readFromValue(obj);
@@ -5918,7 +8161,13 @@ namespace ClientModels
         ~FGetPaymentTokenRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPaymentTokenResult : public PlayFab::FPlayFabCppResultCommon
@@ -5941,6 +8190,15 @@ namespace ClientModels
             ProviderToken(src.ProviderToken)
             {}
 
+        FGetPaymentTokenResult(FGetPaymentTokenResult&& src) :
+            FPlayFabCppResultCommon(),
+            OrderId(MoveTemp(src.OrderId)),
+            ProviderToken(MoveTemp(src.ProviderToken))
+            {}
+
+        FGetPaymentTokenResult& operator=(const FGetPaymentTokenResult& src) = default;
+        FGetPaymentTokenResult& operator=(FGetPaymentTokenResult&& src) = default;
+
         FGetPaymentTokenResult(const TSharedPtr<FJsonObject>& obj) : FGetPaymentTokenResult()
         {
             readFromValue(obj);
@@ -5949,7 +8207,13 @@ namespace ClientModels
         ~FGetPaymentTokenResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPhotonAuthenticationTokenRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5967,6 +8231,14 @@ namespace ClientModels
             PhotonApplicationId(src.PhotonApplicationId)
             {}
 
+        FGetPhotonAuthenticationTokenRequest(FGetPhotonAuthenticationTokenRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PhotonApplicationId(MoveTemp(src.PhotonApplicationId))
+            {}
+
+        FGetPhotonAuthenticationTokenRequest& operator=(const FGetPhotonAuthenticationTokenRequest& src) = default;
+        FGetPhotonAuthenticationTokenRequest& operator=(FGetPhotonAuthenticationTokenRequest&& src) = default;
+
         FGetPhotonAuthenticationTokenRequest(const TSharedPtr<FJsonObject>& obj) : FGetPhotonAuthenticationTokenRequest()
         {
             readFromValue(obj);
@@ -5975,7 +8247,13 @@ namespace ClientModels
         ~FGetPhotonAuthenticationTokenRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPhotonAuthenticationTokenResult : public PlayFab::FPlayFabCppResultCommon
@@ -5993,6 +8271,14 @@ namespace ClientModels
             PhotonCustomAuthenticationToken(src.PhotonCustomAuthenticationToken)
             {}
 
+        FGetPhotonAuthenticationTokenResult(FGetPhotonAuthenticationTokenResult&& src) :
+            FPlayFabCppResultCommon(),
+            PhotonCustomAuthenticationToken(MoveTemp(src.PhotonCustomAuthenticationToken))
+            {}
+
+        FGetPhotonAuthenticationTokenResult& operator=(const FGetPhotonAuthenticationTokenResult& src) = default;
+        FGetPhotonAuthenticationTokenResult& operator=(FGetPhotonAuthenticationTokenResult&& src) = default;
+
         FGetPhotonAuthenticationTokenResult(const TSharedPtr<FJsonObject>& obj) : FGetPhotonAuthenticationTokenResult()
         {
             readFromValue(obj);
@@ -6001,7 +8287,13 @@ namespace ClientModels
         ~FGetPhotonAuthenticationTokenResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerCombinedInfoRequestParams : public PlayFab::FPlayFabCppBaseModel
@@ -6082,12 +8374,34 @@ namespace ClientModels
             GetUserReadOnlyData(src.GetUserReadOnlyData),
             GetUserVirtualCurrency(src.GetUserVirtualCurrency),
             PlayerStatisticNames(src.PlayerStatisticNames),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr),
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr),
             TitleDataKeys(src.TitleDataKeys),
             UserDataKeys(src.UserDataKeys),
             UserReadOnlyDataKeys(src.UserReadOnlyDataKeys)
             {}
 
+        FGetPlayerCombinedInfoRequestParams(FGetPlayerCombinedInfoRequestParams&& src) :
+            FPlayFabCppBaseModel(),
+            GetCharacterInventories(MoveTemp(src.GetCharacterInventories)),
+            GetCharacterList(MoveTemp(src.GetCharacterList)),
+            GetPlayerProfile(MoveTemp(src.GetPlayerProfile)),
+            GetPlayerStatistics(MoveTemp(src.GetPlayerStatistics)),
+            GetTitleData(MoveTemp(src.GetTitleData)),
+            GetUserAccountInfo(MoveTemp(src.GetUserAccountInfo)),
+            GetUserData(MoveTemp(src.GetUserData)),
+            GetUserInventory(MoveTemp(src.GetUserInventory)),
+            GetUserReadOnlyData(MoveTemp(src.GetUserReadOnlyData)),
+            GetUserVirtualCurrency(MoveTemp(src.GetUserVirtualCurrency)),
+            PlayerStatisticNames(MoveTemp(src.PlayerStatisticNames)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints)),
+            TitleDataKeys(MoveTemp(src.TitleDataKeys)),
+            UserDataKeys(MoveTemp(src.UserDataKeys)),
+            UserReadOnlyDataKeys(MoveTemp(src.UserReadOnlyDataKeys))
+            {}
+
+        FGetPlayerCombinedInfoRequestParams& operator=(const FGetPlayerCombinedInfoRequestParams& src) = default;
+        FGetPlayerCombinedInfoRequestParams& operator=(FGetPlayerCombinedInfoRequestParams&& src) = default;
+
         FGetPlayerCombinedInfoRequestParams(const TSharedPtr<FJsonObject>& obj) : FGetPlayerCombinedInfoRequestParams()
         {
             readFromValue(obj);
@@ -6096,7 +8410,13 @@ namespace ClientModels
         ~FGetPlayerCombinedInfoRequestParams();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerCombinedInfoRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6123,6 +8443,16 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetPlayerCombinedInfoRequest(FGetPlayerCombinedInfoRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetPlayerCombinedInfoRequest& operator=(const FGetPlayerCombinedInfoRequest& src) = default;
+        FGetPlayerCombinedInfoRequest& operator=(FGetPlayerCombinedInfoRequest&& src) = default;
+
         FGetPlayerCombinedInfoRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerCombinedInfoRequest()
         {
             readFromValue(obj);
@@ -6131,7 +8461,13 @@ namespace ClientModels
         ~FGetPlayerCombinedInfoRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStatisticValue : public PlayFab::FPlayFabCppBaseModel
@@ -6159,6 +8495,16 @@ namespace ClientModels
             Version(src.Version)
             {}
 
+        FStatisticValue(FStatisticValue&& src) :
+            FPlayFabCppBaseModel(),
+            StatisticName(MoveTemp(src.StatisticName)),
+            Value(MoveTemp(src.Value)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FStatisticValue& operator=(const FStatisticValue& src) = default;
+        FStatisticValue& operator=(FStatisticValue&& src) = default;
+
         FStatisticValue(const TSharedPtr<FJsonObject>& obj) : FStatisticValue()
         {
             readFromValue(obj);
@@ -6167,7 +8513,13 @@ namespace ClientModels
         ~FStatisticValue();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerCombinedInfoResultPayload : public PlayFab::FPlayFabCppBaseModel
@@ -6224,10 +8576,10 @@ namespace ClientModels
 
         FGetPlayerCombinedInfoResultPayload(const FGetPlayerCombinedInfoResultPayload& src) :
             FPlayFabCppBaseModel(),
-            AccountInfo(src.AccountInfo.IsValid() ? MakeShareable(new FUserAccountInfo(*src.AccountInfo)) : nullptr),
+            AccountInfo(src.AccountInfo.IsValid() ? TSharedPtr<FUserAccountInfo>(MakeShared<FUserAccountInfo>(*src.AccountInfo)) : nullptr),
             CharacterInventories(src.CharacterInventories),
             CharacterList(src.CharacterList),
-            PlayerProfile(src.PlayerProfile.IsValid() ? MakeShareable(new FPlayerProfileModel(*src.PlayerProfile)) : nullptr),
+            PlayerProfile(src.PlayerProfile.IsValid() ? TSharedPtr<FPlayerProfileModel>(MakeShared<FPlayerProfileModel>(*src.PlayerProfile)) : nullptr),
             PlayerStatistics(src.PlayerStatistics),
             TitleData(src.TitleData),
             UserData(src.UserData),
@@ -6239,6 +8591,26 @@ namespace ClientModels
             UserVirtualCurrencyRechargeTimes(src.UserVirtualCurrencyRechargeTimes)
             {}
 
+        FGetPlayerCombinedInfoResultPayload(FGetPlayerCombinedInfoResultPayload&& src) :
+            FPlayFabCppBaseModel(),
+            AccountInfo(MoveTemp(src.AccountInfo)),
+            CharacterInventories(MoveTemp(src.CharacterInventories)),
+            CharacterList(MoveTemp(src.CharacterList)),
+            PlayerProfile(MoveTemp(src.PlayerProfile)),
+            PlayerStatistics(MoveTemp(src.PlayerStatistics)),
+            TitleData(MoveTemp(src.TitleData)),
+            UserData(MoveTemp(src.UserData)),
+            UserDataVersion(MoveTemp(src.UserDataVersion)),
+            UserInventory(MoveTemp(src.UserInventory)),
+            UserReadOnlyData(MoveTemp(src.UserReadOnlyData)),
+            UserReadOnlyDataVersion(MoveTemp(src.UserReadOnlyDataVersion)),
+            UserVirtualCurrency(MoveTemp(src.UserVirtualCurrency)),
+            UserVirtualCurrencyRechargeTimes(MoveTemp(src.UserVirtualCurrencyRechargeTimes))
+            {}
+
+        FGetPlayerCombinedInfoResultPayload& operator=(const FGetPlayerCombinedInfoResultPayload& src) = default;
+        FGetPlayerCombinedInfoResultPayload& operator=(FGetPlayerCombinedInfoResultPayload&& src) = default;
+
         FGetPlayerCombinedInfoResultPayload(const TSharedPtr<FJsonObject>& obj) : FGetPlayerCombinedInfoResultPayload()
         {
             readFromValue(obj);
@@ -6247,7 +8619,13 @@ namespace ClientModels
         ~FGetPlayerCombinedInfoResultPayload();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerCombinedInfoResult : public PlayFab::FPlayFabCppResultCommon
@@ -6266,10 +8644,19 @@ namespace ClientModels
 
         FGetPlayerCombinedInfoResult(const FGetPlayerCombinedInfoResult& src) :
             FPlayFabCppResultCommon(),
-            InfoResultPayload(src.InfoResultPayload.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoResultPayload(*src.InfoResultPayload)) : nullptr),
+            InfoResultPayload(src.InfoResultPayload.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoResultPayload>(MakeShared<FGetPlayerCombinedInfoResultPayload>(*src.InfoResultPayload)) : nullptr),
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetPlayerCombinedInfoResult(FGetPlayerCombinedInfoResult&& src) :
+            FPlayFabCppResultCommon(),
+            InfoResultPayload(MoveTemp(src.InfoResultPayload)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetPlayerCombinedInfoResult& operator=(const FGetPlayerCombinedInfoResult& src) = default;
+        FGetPlayerCombinedInfoResult& operator=(FGetPlayerCombinedInfoResult&& src) = default;
+
         FGetPlayerCombinedInfoResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerCombinedInfoResult()
         {
             readFromValue(obj);
@@ -6278,7 +8665,13 @@ namespace ClientModels
         ~FGetPlayerCombinedInfoResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerProfileRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6306,9 +8699,19 @@ namespace ClientModels
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
             PlayFabId(src.PlayFabId),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr)
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr)
+            {}
+
+        FGetPlayerProfileRequest(FGetPlayerProfileRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints))
             {}
 
+        FGetPlayerProfileRequest& operator=(const FGetPlayerProfileRequest& src) = default;
+        FGetPlayerProfileRequest& operator=(FGetPlayerProfileRequest&& src) = default;
+
         FGetPlayerProfileRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerProfileRequest()
         {
             readFromValue(obj);
@@ -6317,7 +8720,13 @@ namespace ClientModels
         ~FGetPlayerProfileRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerProfileResult : public PlayFab::FPlayFabCppResultCommon
@@ -6335,9 +8744,17 @@ namespace ClientModels
 
         FGetPlayerProfileResult(const FGetPlayerProfileResult& src) :
             FPlayFabCppResultCommon(),
-            PlayerProfile(src.PlayerProfile.IsValid() ? MakeShareable(new FPlayerProfileModel(*src.PlayerProfile)) : nullptr)
+            PlayerProfile(src.PlayerProfile.IsValid() ? TSharedPtr<FPlayerProfileModel>(MakeShared<FPlayerProfileModel>(*src.PlayerProfile)) : nullptr)
+            {}
+
+        FGetPlayerProfileResult(FGetPlayerProfileResult&& src) :
+            FPlayFabCppResultCommon(),
+            PlayerProfile(MoveTemp(src.PlayerProfile))
             {}
 
+        FGetPlayerProfileResult& operator=(const FGetPlayerProfileResult& src) = default;
+        FGetPlayerProfileResult& operator=(FGetPlayerProfileResult&& src) = default;
+
         FGetPlayerProfileResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerProfileResult()
         {
             readFromValue(obj);
@@ -6346,7 +8763,13 @@ namespace ClientModels
         ~FGetPlayerProfileResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerSegmentsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6359,6 +8782,13 @@ namespace ClientModels
             FPlayFabCppRequestCommon()
             {}
 
+        FGetPlayerSegmentsRequest(FGetPlayerSegmentsRequest&& src) :
+            FPlayFabCppRequestCommon()
+            {}
+
+        FGetPlayerSegmentsRequest& operator=(const FGetPlayerSegmentsRequest& src) = default;
+        FGetPlayerSegmentsRequest& operator=(FGetPlayerSegmentsRequest&& src) = default;
+
         FGetPlayerSegmentsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerSegmentsRequest()
         {
             readFromValue(obj);
@@ -6367,7 +8797,13 @@ namespace ClientModels
         ~FGetPlayerSegmentsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetSegmentResult : public PlayFab::FPlayFabCppBaseModel
@@ -6395,6 +8831,16 @@ namespace ClientModels
             Name(src.Name)
             {}
 
+        FGetSegmentResult(FGetSegmentResult&& src) :
+            FPlayFabCppBaseModel(),
+            ABTestParent(MoveTemp(src.ABTestParent)),
+            Id(MoveTemp(src.Id)),
+            Name(MoveTemp(src.Name))
+            {}
+
+        FGetSegmentResult& operator=(const FGetSegmentResult& src) = default;
+        FGetSegmentResult& operator=(FGetSegmentResult&& src) = default;
+
         FGetSegmentResult(const TSharedPtr<FJsonObject>& obj) : FGetSegmentResult()
         {
             readFromValue(obj);
@@ -6403,7 +8849,13 @@ namespace ClientModels
         ~FGetSegmentResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerSegmentsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6420,6 +8872,14 @@ namespace ClientModels
             Segments(src.Segments)
             {}
 
+        FGetPlayerSegmentsResult(FGetPlayerSegmentsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Segments(MoveTemp(src.Segments))
+            {}
+
+        FGetPlayerSegmentsResult& operator=(const FGetPlayerSegmentsResult& src) = default;
+        FGetPlayerSegmentsResult& operator=(FGetPlayerSegmentsResult&& src) = default;
+
         FGetPlayerSegmentsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerSegmentsResult()
         {
             readFromValue(obj);
@@ -6428,7 +8888,13 @@ namespace ClientModels
         ~FGetPlayerSegmentsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStatisticNameVersion : public PlayFab::FPlayFabCppBaseModel
@@ -6451,6 +8917,15 @@ namespace ClientModels
             Version(src.Version)
             {}
 
+        FStatisticNameVersion(FStatisticNameVersion&& src) :
+            FPlayFabCppBaseModel(),
+            StatisticName(MoveTemp(src.StatisticName)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FStatisticNameVersion& operator=(const FStatisticNameVersion& src) = default;
+        FStatisticNameVersion& operator=(FStatisticNameVersion&& src) = default;
+
         FStatisticNameVersion(const TSharedPtr<FJsonObject>& obj) : FStatisticNameVersion()
         {
             readFromValue(obj);
@@ -6459,7 +8934,13 @@ namespace ClientModels
         ~FStatisticNameVersion();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6487,6 +8968,16 @@ namespace ClientModels
             StatisticNameVersions(src.StatisticNameVersions)
             {}
 
+        FGetPlayerStatisticsRequest(FGetPlayerStatisticsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            StatisticNames(MoveTemp(src.StatisticNames)),
+            StatisticNameVersions(MoveTemp(src.StatisticNameVersions))
+            {}
+
+        FGetPlayerStatisticsRequest& operator=(const FGetPlayerStatisticsRequest& src) = default;
+        FGetPlayerStatisticsRequest& operator=(FGetPlayerStatisticsRequest&& src) = default;
+
         FGetPlayerStatisticsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerStatisticsRequest()
         {
             readFromValue(obj);
@@ -6495,7 +8986,13 @@ namespace ClientModels
         ~FGetPlayerStatisticsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerStatisticsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6512,6 +9009,14 @@ namespace ClientModels
             Statistics(src.Statistics)
             {}
 
+        FGetPlayerStatisticsResult(FGetPlayerStatisticsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Statistics(MoveTemp(src.Statistics))
+            {}
+
+        FGetPlayerStatisticsResult& operator=(const FGetPlayerStatisticsResult& src) = default;
+        FGetPlayerStatisticsResult& operator=(FGetPlayerStatisticsResult&& src) = default;
+
         FGetPlayerStatisticsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerStatisticsResult()
         {
             readFromValue(obj);
@@ -6520,7 +9025,13 @@ namespace ClientModels
         ~FGetPlayerStatisticsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerStatisticVersionsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6542,6 +9053,15 @@ namespace ClientModels
             StatisticName(src.StatisticName)
             {}
 
+        FGetPlayerStatisticVersionsRequest(FGetPlayerStatisticVersionsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            StatisticName(MoveTemp(src.StatisticName))
+            {}
+
+        FGetPlayerStatisticVersionsRequest& operator=(const FGetPlayerStatisticVersionsRequest& src) = default;
+        FGetPlayerStatisticVersionsRequest& operator=(FGetPlayerStatisticVersionsRequest&& src) = default;
+
         FGetPlayerStatisticVersionsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerStatisticVersionsRequest()
         {
             readFromValue(obj);
@@ -6550,7 +9070,13 @@ namespace ClientModels
         ~FGetPlayerStatisticVersionsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerStatisticVersion : public PlayFab::FPlayFabCppBaseModel
@@ -6593,6 +9119,19 @@ namespace ClientModels
             Version(src.Version)
             {}
 
+        FPlayerStatisticVersion(FPlayerStatisticVersion&& src) :
+            FPlayFabCppBaseModel(),
+            ActivationTime(MoveTemp(src.ActivationTime)),
+            DeactivationTime(MoveTemp(src.DeactivationTime)),
+            ScheduledActivationTime(MoveTemp(src.ScheduledActivationTime)),
+            ScheduledDeactivationTime(MoveTemp(src.ScheduledDeactivationTime)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FPlayerStatisticVersion& operator=(const FPlayerStatisticVersion& src) = default;
+        FPlayerStatisticVersion& operator=(FPlayerStatisticVersion&& src) = default;
+
         FPlayerStatisticVersion(const TSharedPtr<FJsonObject>& obj) : FPlayerStatisticVersion()
         {
             readFromValue(obj);
@@ -6601,7 +9140,13 @@ namespace ClientModels
         ~FPlayerStatisticVersion();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerStatisticVersionsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6618,6 +9163,14 @@ namespace ClientModels
             StatisticVersions(src.StatisticVersions)
             {}
 
+        FGetPlayerStatisticVersionsResult(FGetPlayerStatisticVersionsResult&& src) :
+            FPlayFabCppResultCommon(),
+            StatisticVersions(MoveTemp(src.StatisticVersions))
+            {}
+
+        FGetPlayerStatisticVersionsResult& operator=(const FGetPlayerStatisticVersionsResult& src) = default;
+        FGetPlayerStatisticVersionsResult& operator=(FGetPlayerStatisticVersionsResult&& src) = default;
+
         FGetPlayerStatisticVersionsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerStatisticVersionsResult()
         {
             readFromValue(obj);
@@ -6626,7 +9179,13 @@ namespace ClientModels
         ~FGetPlayerStatisticVersionsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerTagsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6653,6 +9212,16 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetPlayerTagsRequest(FGetPlayerTagsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Namespace(MoveTemp(src.Namespace)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetPlayerTagsRequest& operator=(const FGetPlayerTagsRequest& src) = default;
+        FGetPlayerTagsRequest& operator=(FGetPlayerTagsRequest&& src) = default;
+
         FGetPlayerTagsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerTagsRequest()
         {
             readFromValue(obj);
@@ -6661,7 +9230,13 @@ namespace ClientModels
         ~FGetPlayerTagsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerTagsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6683,6 +9258,15 @@ namespace ClientModels
             Tags(src.Tags)
             {}
 
+        FGetPlayerTagsResult(FGetPlayerTagsResult&& src) :
+            FPlayFabCppResultCommon(),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Tags(MoveTemp(src.Tags))
+            {}
+
+        FGetPlayerTagsResult& operator=(const FGetPlayerTagsResult& src) = default;
+        FGetPlayerTagsResult& operator=(FGetPlayerTagsResult&& src) = default;
+
         FGetPlayerTagsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerTagsResult()
         {
             readFromValue(obj);
@@ -6691,7 +9275,13 @@ namespace ClientModels
         ~FGetPlayerTagsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerTradesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6709,6 +9299,14 @@ namespace ClientModels
             StatusFilter(src.StatusFilter)
             {}
 
+        FGetPlayerTradesRequest(FGetPlayerTradesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            StatusFilter(MoveTemp(src.StatusFilter))
+            {}
+
+        FGetPlayerTradesRequest& operator=(const FGetPlayerTradesRequest& src) = default;
+        FGetPlayerTradesRequest& operator=(FGetPlayerTradesRequest&& src) = default;
+
         FGetPlayerTradesRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerTradesRequest()
         {
             readFromValue(obj);
@@ -6717,7 +9315,13 @@ namespace ClientModels
         ~FGetPlayerTradesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerTradesResponse : public PlayFab::FPlayFabCppResultCommon
@@ -6738,7 +9342,16 @@ namespace ClientModels
             OpenedTrades(src.OpenedTrades)
             {}
 
-        FGetPlayerTradesResponse(const TSharedPtr<FJsonObject>& obj) : FGetPlayerTradesResponse()
+        FGetPlayerTradesResponse(FGetPlayerTradesResponse&& src) :
+            FPlayFabCppResultCommon(),
+            AcceptedTrades(MoveTemp(src.AcceptedTrades)),
+            OpenedTrades(MoveTemp(src.OpenedTrades))
+            {}
+
+        FGetPlayerTradesResponse& operator=(const FGetPlayerTradesResponse& src) = default;
+        FGetPlayerTradesResponse& operator=(FGetPlayerTradesResponse&& src) = default;
+
+        FGetPlayerTradesResponse(const TSharedPtr<FJsonObject>& obj) : FGetPlayerTradesResponse()
         {
             readFromValue(obj);
         }
@@ -6746,7 +9359,13 @@ namespace ClientModels
         ~FGetPlayerTradesResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromFacebookIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6763,6 +9382,14 @@ namespace ClientModels
             FacebookIDs(src.FacebookIDs)
             {}
 
+        FGetPlayFabIDsFromFacebookIDsRequest(FGetPlayFabIDsFromFacebookIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            FacebookIDs(MoveTemp(src.FacebookIDs))
+            {}
+
+        FGetPlayFabIDsFromFacebookIDsRequest& operator=(const FGetPlayFabIDsFromFacebookIDsRequest& src) = default;
+        FGetPlayFabIDsFromFacebookIDsRequest& operator=(FGetPlayFabIDsFromFacebookIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromFacebookIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromFacebookIDsRequest()
         {
             readFromValue(obj);
@@ -6771,7 +9398,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromFacebookIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromFacebookIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6788,6 +9421,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromFacebookIDsResult(FGetPlayFabIDsFromFacebookIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromFacebookIDsResult& operator=(const FGetPlayFabIDsFromFacebookIDsResult& src) = default;
+        FGetPlayFabIDsFromFacebookIDsResult& operator=(FGetPlayFabIDsFromFacebookIDsResult&& src) = default;
+
         FGetPlayFabIDsFromFacebookIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromFacebookIDsResult()
         {
             readFromValue(obj);
@@ -6796,7 +9437,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromFacebookIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromFacebookInstantGamesIdsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6813,6 +9460,14 @@ namespace ClientModels
             FacebookInstantGamesIds(src.FacebookInstantGamesIds)
             {}
 
+        FGetPlayFabIDsFromFacebookInstantGamesIdsRequest(FGetPlayFabIDsFromFacebookInstantGamesIdsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            FacebookInstantGamesIds(MoveTemp(src.FacebookInstantGamesIds))
+            {}
+
+        FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& operator=(const FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& src) = default;
+        FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& operator=(FGetPlayFabIDsFromFacebookInstantGamesIdsRequest&& src) = default;
+
         FGetPlayFabIDsFromFacebookInstantGamesIdsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromFacebookInstantGamesIdsRequest()
         {
             readFromValue(obj);
@@ -6821,7 +9476,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromFacebookInstantGamesIdsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromFacebookInstantGamesIdsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6838,6 +9499,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromFacebookInstantGamesIdsResult(FGetPlayFabIDsFromFacebookInstantGamesIdsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromFacebookInstantGamesIdsResult& operator=(const FGetPlayFabIDsFromFacebookInstantGamesIdsResult& src) = default;
+        FGetPlayFabIDsFromFacebookInstantGamesIdsResult& operator=(FGetPlayFabIDsFromFacebookInstantGamesIdsResult&& src) = default;
+
         FGetPlayFabIDsFromFacebookInstantGamesIdsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromFacebookInstantGamesIdsResult()
         {
             readFromValue(obj);
@@ -6846,7 +9515,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromFacebookInstantGamesIdsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromGameCenterIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6863,6 +9538,14 @@ namespace ClientModels
             GameCenterIDs(src.GameCenterIDs)
             {}
 
+        FGetPlayFabIDsFromGameCenterIDsRequest(FGetPlayFabIDsFromGameCenterIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            GameCenterIDs(MoveTemp(src.GameCenterIDs))
+            {}
+
+        FGetPlayFabIDsFromGameCenterIDsRequest& operator=(const FGetPlayFabIDsFromGameCenterIDsRequest& src) = default;
+        FGetPlayFabIDsFromGameCenterIDsRequest& operator=(FGetPlayFabIDsFromGameCenterIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromGameCenterIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromGameCenterIDsRequest()
         {
             readFromValue(obj);
@@ -6871,7 +9554,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromGameCenterIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromGameCenterIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6888,6 +9577,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromGameCenterIDsResult(FGetPlayFabIDsFromGameCenterIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromGameCenterIDsResult& operator=(const FGetPlayFabIDsFromGameCenterIDsResult& src) = default;
+        FGetPlayFabIDsFromGameCenterIDsResult& operator=(FGetPlayFabIDsFromGameCenterIDsResult&& src) = default;
+
         FGetPlayFabIDsFromGameCenterIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromGameCenterIDsResult()
         {
             readFromValue(obj);
@@ -6896,7 +9593,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromGameCenterIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromGenericIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6916,6 +9619,14 @@ namespace ClientModels
             GenericIDs(src.GenericIDs)
             {}
 
+        FGetPlayFabIDsFromGenericIDsRequest(FGetPlayFabIDsFromGenericIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            GenericIDs(MoveTemp(src.GenericIDs))
+            {}
+
+        FGetPlayFabIDsFromGenericIDsRequest& operator=(const FGetPlayFabIDsFromGenericIDsRequest& src) = default;
+        FGetPlayFabIDsFromGenericIDsRequest& operator=(FGetPlayFabIDsFromGenericIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromGenericIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromGenericIDsRequest()
         {
             readFromValue(obj);
@@ -6924,7 +9635,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromGenericIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromGenericIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6941,6 +9658,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromGenericIDsResult(FGetPlayFabIDsFromGenericIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromGenericIDsResult& operator=(const FGetPlayFabIDsFromGenericIDsResult& src) = default;
+        FGetPlayFabIDsFromGenericIDsResult& operator=(FGetPlayFabIDsFromGenericIDsResult&& src) = default;
+
         FGetPlayFabIDsFromGenericIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromGenericIDsResult()
         {
             readFromValue(obj);
@@ -6949,7 +9674,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromGenericIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromGoogleIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6966,6 +9697,14 @@ namespace ClientModels
             GoogleIDs(src.GoogleIDs)
             {}
 
+        FGetPlayFabIDsFromGoogleIDsRequest(FGetPlayFabIDsFromGoogleIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            GoogleIDs(MoveTemp(src.GoogleIDs))
+            {}
+
+        FGetPlayFabIDsFromGoogleIDsRequest& operator=(const FGetPlayFabIDsFromGoogleIDsRequest& src) = default;
+        FGetPlayFabIDsFromGoogleIDsRequest& operator=(FGetPlayFabIDsFromGoogleIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromGoogleIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromGoogleIDsRequest()
         {
             readFromValue(obj);
@@ -6974,7 +9713,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromGoogleIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGooglePlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -6997,6 +9742,15 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGooglePlayFabIdPair(FGooglePlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            GoogleId(MoveTemp(src.GoogleId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGooglePlayFabIdPair& operator=(const FGooglePlayFabIdPair& src) = default;
+        FGooglePlayFabIdPair& operator=(FGooglePlayFabIdPair&& src) = default;
+
         FGooglePlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FGooglePlayFabIdPair()
         {
             readFromValue(obj);
@@ -7005,7 +9759,13 @@ namespace ClientModels
         ~FGooglePlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromGoogleIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7022,6 +9782,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromGoogleIDsResult(FGetPlayFabIDsFromGoogleIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromGoogleIDsResult& operator=(const FGetPlayFabIDsFromGoogleIDsResult& src) = default;
+        FGetPlayFabIDsFromGoogleIDsResult& operator=(FGetPlayFabIDsFromGoogleIDsResult&& src) = default;
+
         FGetPlayFabIDsFromGoogleIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromGoogleIDsResult()
         {
             readFromValue(obj);
@@ -7030,7 +9798,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromGoogleIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromKongregateIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7047,6 +9821,14 @@ namespace ClientModels
             KongregateIDs(src.KongregateIDs)
             {}
 
+        FGetPlayFabIDsFromKongregateIDsRequest(FGetPlayFabIDsFromKongregateIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            KongregateIDs(MoveTemp(src.KongregateIDs))
+            {}
+
+        FGetPlayFabIDsFromKongregateIDsRequest& operator=(const FGetPlayFabIDsFromKongregateIDsRequest& src) = default;
+        FGetPlayFabIDsFromKongregateIDsRequest& operator=(FGetPlayFabIDsFromKongregateIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromKongregateIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromKongregateIDsRequest()
         {
             readFromValue(obj);
@@ -7055,7 +9837,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromKongregateIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FKongregatePlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -7078,6 +9866,15 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FKongregatePlayFabIdPair(FKongregatePlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            KongregateId(MoveTemp(src.KongregateId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FKongregatePlayFabIdPair& operator=(const FKongregatePlayFabIdPair& src) = default;
+        FKongregatePlayFabIdPair& operator=(FKongregatePlayFabIdPair&& src) = default;
+
         FKongregatePlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FKongregatePlayFabIdPair()
         {
             readFromValue(obj);
@@ -7086,7 +9883,13 @@ namespace ClientModels
         ~FKongregatePlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromKongregateIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7103,6 +9906,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromKongregateIDsResult(FGetPlayFabIDsFromKongregateIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromKongregateIDsResult& operator=(const FGetPlayFabIDsFromKongregateIDsResult& src) = default;
+        FGetPlayFabIDsFromKongregateIDsResult& operator=(FGetPlayFabIDsFromKongregateIDsResult&& src) = default;
+
         FGetPlayFabIDsFromKongregateIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromKongregateIDsResult()
         {
             readFromValue(obj);
@@ -7111,7 +9922,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromKongregateIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7128,6 +9945,14 @@ namespace ClientModels
             NintendoSwitchDeviceIds(src.NintendoSwitchDeviceIds)
             {}
 
+        FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest(FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            NintendoSwitchDeviceIds(MoveTemp(src.NintendoSwitchDeviceIds))
+            {}
+
+        FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& operator=(const FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& src) = default;
+        FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& operator=(FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest&& src) = default;
+
         FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest()
         {
             readFromValue(obj);
@@ -7136,7 +9961,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FNintendoSwitchPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -7159,6 +9990,15 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FNintendoSwitchPlayFabIdPair(FNintendoSwitchPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            NintendoSwitchDeviceId(MoveTemp(src.NintendoSwitchDeviceId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FNintendoSwitchPlayFabIdPair& operator=(const FNintendoSwitchPlayFabIdPair& src) = default;
+        FNintendoSwitchPlayFabIdPair& operator=(FNintendoSwitchPlayFabIdPair&& src) = default;
+
         FNintendoSwitchPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FNintendoSwitchPlayFabIdPair()
         {
             readFromValue(obj);
@@ -7167,7 +10007,13 @@ namespace ClientModels
         ~FNintendoSwitchPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7184,6 +10030,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult(FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult& operator=(const FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult& src) = default;
+        FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult& operator=(FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult&& src) = default;
+
         FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult()
         {
             readFromValue(obj);
@@ -7192,7 +10046,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromPSNAccountIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7214,6 +10074,15 @@ namespace ClientModels
             PSNAccountIDs(src.PSNAccountIDs)
             {}
 
+        FGetPlayFabIDsFromPSNAccountIDsRequest(FGetPlayFabIDsFromPSNAccountIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            IssuerId(MoveTemp(src.IssuerId)),
+            PSNAccountIDs(MoveTemp(src.PSNAccountIDs))
+            {}
+
+        FGetPlayFabIDsFromPSNAccountIDsRequest& operator=(const FGetPlayFabIDsFromPSNAccountIDsRequest& src) = default;
+        FGetPlayFabIDsFromPSNAccountIDsRequest& operator=(FGetPlayFabIDsFromPSNAccountIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromPSNAccountIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromPSNAccountIDsRequest()
         {
             readFromValue(obj);
@@ -7222,7 +10091,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromPSNAccountIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPSNAccountPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -7245,6 +10120,15 @@ namespace ClientModels
             PSNAccountId(src.PSNAccountId)
             {}
 
+        FPSNAccountPlayFabIdPair(FPSNAccountPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            PSNAccountId(MoveTemp(src.PSNAccountId))
+            {}
+
+        FPSNAccountPlayFabIdPair& operator=(const FPSNAccountPlayFabIdPair& src) = default;
+        FPSNAccountPlayFabIdPair& operator=(FPSNAccountPlayFabIdPair&& src) = default;
+
         FPSNAccountPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FPSNAccountPlayFabIdPair()
         {
             readFromValue(obj);
@@ -7253,7 +10137,13 @@ namespace ClientModels
         ~FPSNAccountPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromPSNAccountIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7270,6 +10160,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromPSNAccountIDsResult(FGetPlayFabIDsFromPSNAccountIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromPSNAccountIDsResult& operator=(const FGetPlayFabIDsFromPSNAccountIDsResult& src) = default;
+        FGetPlayFabIDsFromPSNAccountIDsResult& operator=(FGetPlayFabIDsFromPSNAccountIDsResult&& src) = default;
+
         FGetPlayFabIDsFromPSNAccountIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromPSNAccountIDsResult()
         {
             readFromValue(obj);
@@ -7278,7 +10176,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromPSNAccountIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromSteamIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7295,6 +10199,14 @@ namespace ClientModels
             SteamStringIDs(src.SteamStringIDs)
             {}
 
+        FGetPlayFabIDsFromSteamIDsRequest(FGetPlayFabIDsFromSteamIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            SteamStringIDs(MoveTemp(src.SteamStringIDs))
+            {}
+
+        FGetPlayFabIDsFromSteamIDsRequest& operator=(const FGetPlayFabIDsFromSteamIDsRequest& src) = default;
+        FGetPlayFabIDsFromSteamIDsRequest& operator=(FGetPlayFabIDsFromSteamIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromSteamIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromSteamIDsRequest()
         {
             readFromValue(obj);
@@ -7303,7 +10215,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromSteamIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSteamPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -7326,6 +10244,15 @@ namespace ClientModels
             SteamStringId(src.SteamStringId)
             {}
 
+        FSteamPlayFabIdPair(FSteamPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            SteamStringId(MoveTemp(src.SteamStringId))
+            {}
+
+        FSteamPlayFabIdPair& operator=(const FSteamPlayFabIdPair& src) = default;
+        FSteamPlayFabIdPair& operator=(FSteamPlayFabIdPair&& src) = default;
+
         FSteamPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FSteamPlayFabIdPair()
         {
             readFromValue(obj);
@@ -7334,7 +10261,13 @@ namespace ClientModels
         ~FSteamPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromSteamIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7351,6 +10284,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromSteamIDsResult(FGetPlayFabIDsFromSteamIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromSteamIDsResult& operator=(const FGetPlayFabIDsFromSteamIDsResult& src) = default;
+        FGetPlayFabIDsFromSteamIDsResult& operator=(FGetPlayFabIDsFromSteamIDsResult&& src) = default;
+
         FGetPlayFabIDsFromSteamIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromSteamIDsResult()
         {
             readFromValue(obj);
@@ -7359,7 +10300,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromSteamIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromTwitchIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7376,6 +10323,14 @@ namespace ClientModels
             TwitchIds(src.TwitchIds)
             {}
 
+        FGetPlayFabIDsFromTwitchIDsRequest(FGetPlayFabIDsFromTwitchIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            TwitchIds(MoveTemp(src.TwitchIds))
+            {}
+
+        FGetPlayFabIDsFromTwitchIDsRequest& operator=(const FGetPlayFabIDsFromTwitchIDsRequest& src) = default;
+        FGetPlayFabIDsFromTwitchIDsRequest& operator=(FGetPlayFabIDsFromTwitchIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromTwitchIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromTwitchIDsRequest()
         {
             readFromValue(obj);
@@ -7384,7 +10339,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromTwitchIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FTwitchPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -7407,6 +10368,15 @@ namespace ClientModels
             TwitchId(src.TwitchId)
             {}
 
+        FTwitchPlayFabIdPair(FTwitchPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            TwitchId(MoveTemp(src.TwitchId))
+            {}
+
+        FTwitchPlayFabIdPair& operator=(const FTwitchPlayFabIdPair& src) = default;
+        FTwitchPlayFabIdPair& operator=(FTwitchPlayFabIdPair&& src) = default;
+
         FTwitchPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FTwitchPlayFabIdPair()
         {
             readFromValue(obj);
@@ -7415,7 +10385,13 @@ namespace ClientModels
         ~FTwitchPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromTwitchIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7432,6 +10408,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromTwitchIDsResult(FGetPlayFabIDsFromTwitchIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromTwitchIDsResult& operator=(const FGetPlayFabIDsFromTwitchIDsResult& src) = default;
+        FGetPlayFabIDsFromTwitchIDsResult& operator=(FGetPlayFabIDsFromTwitchIDsResult&& src) = default;
+
         FGetPlayFabIDsFromTwitchIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromTwitchIDsResult()
         {
             readFromValue(obj);
@@ -7440,7 +10424,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromTwitchIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromXboxLiveIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7462,6 +10452,15 @@ namespace ClientModels
             XboxLiveAccountIDs(src.XboxLiveAccountIDs)
             {}
 
+        FGetPlayFabIDsFromXboxLiveIDsRequest(FGetPlayFabIDsFromXboxLiveIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Sandbox(MoveTemp(src.Sandbox)),
+            XboxLiveAccountIDs(MoveTemp(src.XboxLiveAccountIDs))
+            {}
+
+        FGetPlayFabIDsFromXboxLiveIDsRequest& operator=(const FGetPlayFabIDsFromXboxLiveIDsRequest& src) = default;
+        FGetPlayFabIDsFromXboxLiveIDsRequest& operator=(FGetPlayFabIDsFromXboxLiveIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromXboxLiveIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromXboxLiveIDsRequest()
         {
             readFromValue(obj);
@@ -7470,7 +10469,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromXboxLiveIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FXboxLiveAccountPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -7493,6 +10498,15 @@ namespace ClientModels
             XboxLiveAccountId(src.XboxLiveAccountId)
             {}
 
+        FXboxLiveAccountPlayFabIdPair(FXboxLiveAccountPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            XboxLiveAccountId(MoveTemp(src.XboxLiveAccountId))
+            {}
+
+        FXboxLiveAccountPlayFabIdPair& operator=(const FXboxLiveAccountPlayFabIdPair& src) = default;
+        FXboxLiveAccountPlayFabIdPair& operator=(FXboxLiveAccountPlayFabIdPair&& src) = default;
+
         FXboxLiveAccountPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FXboxLiveAccountPlayFabIdPair()
         {
             readFromValue(obj);
@@ -7501,7 +10515,13 @@ namespace ClientModels
         ~FXboxLiveAccountPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromXboxLiveIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7518,6 +10538,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromXboxLiveIDsResult(FGetPlayFabIDsFromXboxLiveIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromXboxLiveIDsResult& operator=(const FGetPlayFabIDsFromXboxLiveIDsResult& src) = default;
+        FGetPlayFabIDsFromXboxLiveIDsResult& operator=(FGetPlayFabIDsFromXboxLiveIDsResult&& src) = default;
+
         FGetPlayFabIDsFromXboxLiveIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromXboxLiveIDsResult()
         {
             readFromValue(obj);
@@ -7526,7 +10554,13 @@ namespace ClientModels
         ~FGetPlayFabIDsFromXboxLiveIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPublisherDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7543,6 +10577,14 @@ namespace ClientModels
             Keys(src.Keys)
             {}
 
+        FGetPublisherDataRequest(FGetPublisherDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Keys(MoveTemp(src.Keys))
+            {}
+
+        FGetPublisherDataRequest& operator=(const FGetPublisherDataRequest& src) = default;
+        FGetPublisherDataRequest& operator=(FGetPublisherDataRequest&& src) = default;
+
         FGetPublisherDataRequest(const TSharedPtr<FJsonObject>& obj) : FGetPublisherDataRequest()
         {
             readFromValue(obj);
@@ -7551,7 +10593,13 @@ namespace ClientModels
         ~FGetPublisherDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPublisherDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -7568,6 +10616,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetPublisherDataResult(FGetPublisherDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPublisherDataResult& operator=(const FGetPublisherDataResult& src) = default;
+        FGetPublisherDataResult& operator=(FGetPublisherDataResult&& src) = default;
+
         FGetPublisherDataResult(const TSharedPtr<FJsonObject>& obj) : FGetPublisherDataResult()
         {
             readFromValue(obj);
@@ -7576,7 +10632,13 @@ namespace ClientModels
         ~FGetPublisherDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPurchaseRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7594,6 +10656,14 @@ namespace ClientModels
             OrderId(src.OrderId)
             {}
 
+        FGetPurchaseRequest(FGetPurchaseRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            OrderId(MoveTemp(src.OrderId))
+            {}
+
+        FGetPurchaseRequest& operator=(const FGetPurchaseRequest& src) = default;
+        FGetPurchaseRequest& operator=(FGetPurchaseRequest&& src) = default;
+
         FGetPurchaseRequest(const TSharedPtr<FJsonObject>& obj) : FGetPurchaseRequest()
         {
             readFromValue(obj);
@@ -7602,7 +10672,13 @@ namespace ClientModels
         ~FGetPurchaseRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPurchaseResult : public PlayFab::FPlayFabCppResultCommon
@@ -7640,6 +10716,18 @@ namespace ClientModels
             TransactionStatus(src.TransactionStatus)
             {}
 
+        FGetPurchaseResult(FGetPurchaseResult&& src) :
+            FPlayFabCppResultCommon(),
+            OrderId(MoveTemp(src.OrderId)),
+            PaymentProvider(MoveTemp(src.PaymentProvider)),
+            PurchaseDate(MoveTemp(src.PurchaseDate)),
+            TransactionId(MoveTemp(src.TransactionId)),
+            TransactionStatus(MoveTemp(src.TransactionStatus))
+            {}
+
+        FGetPurchaseResult& operator=(const FGetPurchaseResult& src) = default;
+        FGetPurchaseResult& operator=(FGetPurchaseResult&& src) = default;
+
         FGetPurchaseResult(const TSharedPtr<FJsonObject>& obj) : FGetPurchaseResult()
         {
             readFromValue(obj);
@@ -7648,7 +10736,13 @@ namespace ClientModels
         ~FGetPurchaseResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetSharedGroupDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7678,6 +10772,16 @@ namespace ClientModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FGetSharedGroupDataRequest(FGetSharedGroupDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            GetMembers(MoveTemp(src.GetMembers)),
+            Keys(MoveTemp(src.Keys)),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FGetSharedGroupDataRequest& operator=(const FGetSharedGroupDataRequest& src) = default;
+        FGetSharedGroupDataRequest& operator=(FGetSharedGroupDataRequest&& src) = default;
+
         FGetSharedGroupDataRequest(const TSharedPtr<FJsonObject>& obj) : FGetSharedGroupDataRequest()
         {
             readFromValue(obj);
@@ -7686,7 +10790,13 @@ namespace ClientModels
         ~FGetSharedGroupDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSharedGroupDataRecord : public PlayFab::FPlayFabCppBaseModel
@@ -7719,6 +10829,17 @@ namespace ClientModels
             Value(src.Value)
             {}
 
+        FSharedGroupDataRecord(FSharedGroupDataRecord&& src) :
+            FPlayFabCppBaseModel(),
+            LastUpdated(MoveTemp(src.LastUpdated)),
+            LastUpdatedBy(MoveTemp(src.LastUpdatedBy)),
+            Permission(MoveTemp(src.Permission)),
+            Value(MoveTemp(src.Value))
+            {}
+
+        FSharedGroupDataRecord& operator=(const FSharedGroupDataRecord& src) = default;
+        FSharedGroupDataRecord& operator=(FSharedGroupDataRecord&& src) = default;
+
         FSharedGroupDataRecord(const TSharedPtr<FJsonObject>& obj) : FSharedGroupDataRecord()
         {
             readFromValue(obj);
@@ -7727,7 +10848,13 @@ namespace ClientModels
         ~FSharedGroupDataRecord();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetSharedGroupDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -7748,6 +10875,15 @@ namespace ClientModels
             Members(src.Members)
             {}
 
+        FGetSharedGroupDataResult(FGetSharedGroupDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data)),
+            Members(MoveTemp(src.Members))
+            {}
+
+        FGetSharedGroupDataResult& operator=(const FGetSharedGroupDataResult& src) = default;
+        FGetSharedGroupDataResult& operator=(FGetSharedGroupDataResult&& src) = default;
+
         FGetSharedGroupDataResult(const TSharedPtr<FJsonObject>& obj) : FGetSharedGroupDataResult()
         {
             readFromValue(obj);
@@ -7756,7 +10892,13 @@ namespace ClientModels
         ~FGetSharedGroupDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetStoreItemsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7779,6 +10921,15 @@ namespace ClientModels
             StoreId(src.StoreId)
             {}
 
+        FGetStoreItemsRequest(FGetStoreItemsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            StoreId(MoveTemp(src.StoreId))
+            {}
+
+        FGetStoreItemsRequest& operator=(const FGetStoreItemsRequest& src) = default;
+        FGetStoreItemsRequest& operator=(FGetStoreItemsRequest&& src) = default;
+
         FGetStoreItemsRequest(const TSharedPtr<FJsonObject>& obj) : FGetStoreItemsRequest()
         {
             readFromValue(obj);
@@ -7787,7 +10938,13 @@ namespace ClientModels
         ~FGetStoreItemsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStoreMarketingModel : public PlayFab::FPlayFabCppBaseModel
@@ -7815,6 +10972,16 @@ namespace ClientModels
             Metadata(src.Metadata)
             {}
 
+        FStoreMarketingModel(FStoreMarketingModel&& src) :
+            FPlayFabCppBaseModel(),
+            Description(MoveTemp(src.Description)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            Metadata(MoveTemp(src.Metadata))
+            {}
+
+        FStoreMarketingModel& operator=(const FStoreMarketingModel& src) = default;
+        FStoreMarketingModel& operator=(FStoreMarketingModel&& src) = default;
+
         FStoreMarketingModel(const TSharedPtr<FJsonObject>& obj) : FStoreMarketingModel()
         {
             readFromValue(obj);
@@ -7823,7 +10990,13 @@ namespace ClientModels
         ~FStoreMarketingModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum SourceType
@@ -7838,6 +11011,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeSourceTypeEnumJSON(SourceType enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeSourceTypeEnumJSON(SourceType enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API SourceType readSourceTypeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API SourceType readSourceTypeFromValue(const FString& value);
 
@@ -7877,6 +11051,18 @@ namespace ClientModels
             VirtualCurrencyPrices(src.VirtualCurrencyPrices)
             {}
 
+        FStoreItem(FStoreItem&& src) :
+            FPlayFabCppBaseModel(),
+            CustomData(MoveTemp(src.CustomData)),
+            DisplayPosition(MoveTemp(src.DisplayPosition)),
+            ItemId(MoveTemp(src.ItemId)),
+            RealCurrencyPrices(MoveTemp(src.RealCurrencyPrices)),
+            VirtualCurrencyPrices(MoveTemp(src.VirtualCurrencyPrices))
+            {}
+
+        FStoreItem& operator=(const FStoreItem& src) = default;
+        FStoreItem& operator=(FStoreItem&& src) = default;
+
         FStoreItem(const TSharedPtr<FJsonObject>& obj) : FStoreItem()
         {
             readFromValue(obj);
@@ -7885,7 +11071,13 @@ namespace ClientModels
         ~FStoreItem();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetStoreItemsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7916,12 +11108,24 @@ namespace ClientModels
         FGetStoreItemsResult(const FGetStoreItemsResult& src) :
             FPlayFabCppResultCommon(),
             CatalogVersion(src.CatalogVersion),
-            MarketingData(src.MarketingData.IsValid() ? MakeShareable(new FStoreMarketingModel(*src.MarketingData)) : nullptr),
+            MarketingData(src.MarketingData.IsValid() ? TSharedPtr<FStoreMarketingModel>(MakeShared<FStoreMarketingModel>(*src.MarketingData)) : nullptr),
             Source(src.Source),
             Store(src.Store),
             StoreId(src.StoreId)
             {}
 
+        FGetStoreItemsResult(FGetStoreItemsResult&& src) :
+            FPlayFabCppResultCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            MarketingData(MoveTemp(src.MarketingData)),
+            Source(MoveTemp(src.Source)),
+            Store(MoveTemp(src.Store)),
+            StoreId(MoveTemp(src.StoreId))
+            {}
+
+        FGetStoreItemsResult& operator=(const FGetStoreItemsResult& src) = default;
+        FGetStoreItemsResult& operator=(FGetStoreItemsResult&& src) = default;
+
         FGetStoreItemsResult(const TSharedPtr<FJsonObject>& obj) : FGetStoreItemsResult()
         {
             readFromValue(obj);
@@ -7930,7 +11134,13 @@ namespace ClientModels
         ~FGetStoreItemsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTimeRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7943,6 +11153,13 @@ namespace ClientModels
             FPlayFabCppRequestCommon()
             {}
 
+        FGetTimeRequest(FGetTimeRequest&& src) :
+            FPlayFabCppRequestCommon()
+            {}
+
+        FGetTimeRequest& operator=(const FGetTimeRequest& src) = default;
+        FGetTimeRequest& operator=(FGetTimeRequest&& src) = default;
+
         FGetTimeRequest(const TSharedPtr<FJsonObject>& obj) : FGetTimeRequest()
         {
             readFromValue(obj);
@@ -7951,7 +11168,13 @@ namespace ClientModels
         ~FGetTimeRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTimeResult : public PlayFab::FPlayFabCppResultCommon
@@ -7969,6 +11192,14 @@ namespace ClientModels
             Time(src.Time)
             {}
 
+        FGetTimeResult(FGetTimeResult&& src) :
+            FPlayFabCppResultCommon(),
+            Time(MoveTemp(src.Time))
+            {}
+
+        FGetTimeResult& operator=(const FGetTimeResult& src) = default;
+        FGetTimeResult& operator=(FGetTimeResult&& src) = default;
+
         FGetTimeResult(const TSharedPtr<FJsonObject>& obj) : FGetTimeResult()
         {
             readFromValue(obj);
@@ -7977,7 +11208,13 @@ namespace ClientModels
         ~FGetTimeResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8002,6 +11239,15 @@ namespace ClientModels
             OverrideLabel(src.OverrideLabel)
             {}
 
+        FGetTitleDataRequest(FGetTitleDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Keys(MoveTemp(src.Keys)),
+            OverrideLabel(MoveTemp(src.OverrideLabel))
+            {}
+
+        FGetTitleDataRequest& operator=(const FGetTitleDataRequest& src) = default;
+        FGetTitleDataRequest& operator=(FGetTitleDataRequest&& src) = default;
+
         FGetTitleDataRequest(const TSharedPtr<FJsonObject>& obj) : FGetTitleDataRequest()
         {
             readFromValue(obj);
@@ -8010,7 +11256,13 @@ namespace ClientModels
         ~FGetTitleDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -8027,6 +11279,14 @@ namespace ClientModels
             Data(src.Data)
             {}
 
+        FGetTitleDataResult(FGetTitleDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetTitleDataResult& operator=(const FGetTitleDataResult& src) = default;
+        FGetTitleDataResult& operator=(FGetTitleDataResult&& src) = default;
+
         FGetTitleDataResult(const TSharedPtr<FJsonObject>& obj) : FGetTitleDataResult()
         {
             readFromValue(obj);
@@ -8035,7 +11295,13 @@ namespace ClientModels
         ~FGetTitleDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleNewsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8053,6 +11319,14 @@ namespace ClientModels
             Count(src.Count)
             {}
 
+        FGetTitleNewsRequest(FGetTitleNewsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Count(MoveTemp(src.Count))
+            {}
+
+        FGetTitleNewsRequest& operator=(const FGetTitleNewsRequest& src) = default;
+        FGetTitleNewsRequest& operator=(FGetTitleNewsRequest&& src) = default;
+
         FGetTitleNewsRequest(const TSharedPtr<FJsonObject>& obj) : FGetTitleNewsRequest()
         {
             readFromValue(obj);
@@ -8061,7 +11335,13 @@ namespace ClientModels
         ~FGetTitleNewsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FTitleNewsItem : public PlayFab::FPlayFabCppBaseModel
@@ -8094,6 +11374,17 @@ namespace ClientModels
             Title(src.Title)
             {}
 
+        FTitleNewsItem(FTitleNewsItem&& src) :
+            FPlayFabCppBaseModel(),
+            Body(MoveTemp(src.Body)),
+            NewsId(MoveTemp(src.NewsId)),
+            Timestamp(MoveTemp(src.Timestamp)),
+            Title(MoveTemp(src.Title))
+            {}
+
+        FTitleNewsItem& operator=(const FTitleNewsItem& src) = default;
+        FTitleNewsItem& operator=(FTitleNewsItem&& src) = default;
+
         FTitleNewsItem(const TSharedPtr<FJsonObject>& obj) : FTitleNewsItem()
         {
             readFromValue(obj);
@@ -8102,7 +11393,13 @@ namespace ClientModels
         ~FTitleNewsItem();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleNewsResult : public PlayFab::FPlayFabCppResultCommon
@@ -8119,6 +11416,14 @@ namespace ClientModels
             News(src.News)
             {}
 
+        FGetTitleNewsResult(FGetTitleNewsResult&& src) :
+            FPlayFabCppResultCommon(),
+            News(MoveTemp(src.News))
+            {}
+
+        FGetTitleNewsResult& operator=(const FGetTitleNewsResult& src) = default;
+        FGetTitleNewsResult& operator=(FGetTitleNewsResult&& src) = default;
+
         FGetTitleNewsResult(const TSharedPtr<FJsonObject>& obj) : FGetTitleNewsResult()
         {
             readFromValue(obj);
@@ -8127,7 +11432,13 @@ namespace ClientModels
         ~FGetTitleNewsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitlePublicKeyRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8153,6 +11464,15 @@ namespace ClientModels
             TitleSharedSecret(src.TitleSharedSecret)
             {}
 
+        FGetTitlePublicKeyRequest(FGetTitlePublicKeyRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            TitleId(MoveTemp(src.TitleId)),
+            TitleSharedSecret(MoveTemp(src.TitleSharedSecret))
+            {}
+
+        FGetTitlePublicKeyRequest& operator=(const FGetTitlePublicKeyRequest& src) = default;
+        FGetTitlePublicKeyRequest& operator=(FGetTitlePublicKeyRequest&& src) = default;
+
         FGetTitlePublicKeyRequest(const TSharedPtr<FJsonObject>& obj) : FGetTitlePublicKeyRequest()
         {
             readFromValue(obj);
@@ -8161,7 +11481,13 @@ namespace ClientModels
         ~FGetTitlePublicKeyRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitlePublicKeyResult : public PlayFab::FPlayFabCppResultCommon
@@ -8179,6 +11505,14 @@ namespace ClientModels
             RSAPublicKey(src.RSAPublicKey)
             {}
 
+        FGetTitlePublicKeyResult(FGetTitlePublicKeyResult&& src) :
+            FPlayFabCppResultCommon(),
+            RSAPublicKey(MoveTemp(src.RSAPublicKey))
+            {}
+
+        FGetTitlePublicKeyResult& operator=(const FGetTitlePublicKeyResult& src) = default;
+        FGetTitlePublicKeyResult& operator=(FGetTitlePublicKeyResult&& src) = default;
+
         FGetTitlePublicKeyResult(const TSharedPtr<FJsonObject>& obj) : FGetTitlePublicKeyResult()
         {
             readFromValue(obj);
@@ -8187,7 +11521,13 @@ namespace ClientModels
         ~FGetTitlePublicKeyResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTradeStatusRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8210,6 +11550,15 @@ namespace ClientModels
             TradeId(src.TradeId)
             {}
 
+        FGetTradeStatusRequest(FGetTradeStatusRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            OfferingPlayerId(MoveTemp(src.OfferingPlayerId)),
+            TradeId(MoveTemp(src.TradeId))
+            {}
+
+        FGetTradeStatusRequest& operator=(const FGetTradeStatusRequest& src) = default;
+        FGetTradeStatusRequest& operator=(FGetTradeStatusRequest&& src) = default;
+
         FGetTradeStatusRequest(const TSharedPtr<FJsonObject>& obj) : FGetTradeStatusRequest()
         {
             readFromValue(obj);
@@ -8218,7 +11567,13 @@ namespace ClientModels
         ~FGetTradeStatusRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTradeStatusResponse : public PlayFab::FPlayFabCppResultCommon
@@ -8233,9 +11588,17 @@ namespace ClientModels
 
         FGetTradeStatusResponse(const FGetTradeStatusResponse& src) :
             FPlayFabCppResultCommon(),
-            Trade(src.Trade.IsValid() ? MakeShareable(new FTradeInfo(*src.Trade)) : nullptr)
+            Trade(src.Trade.IsValid() ? TSharedPtr<FTradeInfo>(MakeShared<FTradeInfo>(*src.Trade)) : nullptr)
             {}
 
+        FGetTradeStatusResponse(FGetTradeStatusResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Trade(MoveTemp(src.Trade))
+            {}
+
+        FGetTradeStatusResponse& operator=(const FGetTradeStatusResponse& src) = default;
+        FGetTradeStatusResponse& operator=(FGetTradeStatusResponse&& src) = default;
+
         FGetTradeStatusResponse(const TSharedPtr<FJsonObject>& obj) : FGetTradeStatusResponse()
         {
             readFromValue(obj);
@@ -8244,7 +11607,13 @@ namespace ClientModels
         ~FGetTradeStatusResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8277,6 +11646,16 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetUserDataRequest(FGetUserDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            IfChangedFromDataVersion(MoveTemp(src.IfChangedFromDataVersion)),
+            Keys(MoveTemp(src.Keys)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetUserDataRequest& operator=(const FGetUserDataRequest& src) = default;
+        FGetUserDataRequest& operator=(FGetUserDataRequest&& src) = default;
+
         FGetUserDataRequest(const TSharedPtr<FJsonObject>& obj) : FGetUserDataRequest()
         {
             readFromValue(obj);
@@ -8285,7 +11664,13 @@ namespace ClientModels
         ~FGetUserDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -8310,6 +11695,15 @@ namespace ClientModels
             DataVersion(src.DataVersion)
             {}
 
+        FGetUserDataResult(FGetUserDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data)),
+            DataVersion(MoveTemp(src.DataVersion))
+            {}
+
+        FGetUserDataResult& operator=(const FGetUserDataResult& src) = default;
+        FGetUserDataResult& operator=(FGetUserDataResult&& src) = default;
+
         FGetUserDataResult(const TSharedPtr<FJsonObject>& obj) : FGetUserDataResult()
         {
             readFromValue(obj);
@@ -8318,7 +11712,13 @@ namespace ClientModels
         ~FGetUserDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserInventoryRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8335,6 +11735,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FGetUserInventoryRequest(FGetUserInventoryRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FGetUserInventoryRequest& operator=(const FGetUserInventoryRequest& src) = default;
+        FGetUserInventoryRequest& operator=(FGetUserInventoryRequest&& src) = default;
+
         FGetUserInventoryRequest(const TSharedPtr<FJsonObject>& obj) : FGetUserInventoryRequest()
         {
             readFromValue(obj);
@@ -8343,7 +11751,13 @@ namespace ClientModels
         ~FGetUserInventoryRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserInventoryResult : public PlayFab::FPlayFabCppResultCommon
@@ -8368,6 +11782,16 @@ namespace ClientModels
             VirtualCurrencyRechargeTimes(src.VirtualCurrencyRechargeTimes)
             {}
 
+        FGetUserInventoryResult(FGetUserInventoryResult&& src) :
+            FPlayFabCppResultCommon(),
+            Inventory(MoveTemp(src.Inventory)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency)),
+            VirtualCurrencyRechargeTimes(MoveTemp(src.VirtualCurrencyRechargeTimes))
+            {}
+
+        FGetUserInventoryResult& operator=(const FGetUserInventoryResult& src) = default;
+        FGetUserInventoryResult& operator=(FGetUserInventoryResult&& src) = default;
+
         FGetUserInventoryResult(const TSharedPtr<FJsonObject>& obj) : FGetUserInventoryResult()
         {
             readFromValue(obj);
@@ -8376,7 +11800,13 @@ namespace ClientModels
         ~FGetUserInventoryResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetWindowsHelloChallengeRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8402,6 +11832,15 @@ namespace ClientModels
             TitleId(src.TitleId)
             {}
 
+        FGetWindowsHelloChallengeRequest(FGetWindowsHelloChallengeRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PublicKeyHint(MoveTemp(src.PublicKeyHint)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FGetWindowsHelloChallengeRequest& operator=(const FGetWindowsHelloChallengeRequest& src) = default;
+        FGetWindowsHelloChallengeRequest& operator=(FGetWindowsHelloChallengeRequest&& src) = default;
+
         FGetWindowsHelloChallengeRequest(const TSharedPtr<FJsonObject>& obj) : FGetWindowsHelloChallengeRequest()
         {
             readFromValue(obj);
@@ -8410,7 +11849,13 @@ namespace ClientModels
         ~FGetWindowsHelloChallengeRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetWindowsHelloChallengeResponse : public PlayFab::FPlayFabCppResultCommon
@@ -8428,6 +11873,14 @@ namespace ClientModels
             Challenge(src.Challenge)
             {}
 
+        FGetWindowsHelloChallengeResponse(FGetWindowsHelloChallengeResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Challenge(MoveTemp(src.Challenge))
+            {}
+
+        FGetWindowsHelloChallengeResponse& operator=(const FGetWindowsHelloChallengeResponse& src) = default;
+        FGetWindowsHelloChallengeResponse& operator=(FGetWindowsHelloChallengeResponse&& src) = default;
+
         FGetWindowsHelloChallengeResponse(const TSharedPtr<FJsonObject>& obj) : FGetWindowsHelloChallengeResponse()
         {
             readFromValue(obj);
@@ -8436,7 +11889,13 @@ namespace ClientModels
         ~FGetWindowsHelloChallengeResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGrantCharacterToUserRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8471,6 +11930,17 @@ namespace ClientModels
             ItemId(src.ItemId)
             {}
 
+        FGrantCharacterToUserRequest(FGrantCharacterToUserRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterName(MoveTemp(src.CharacterName)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ItemId(MoveTemp(src.ItemId))
+            {}
+
+        FGrantCharacterToUserRequest& operator=(const FGrantCharacterToUserRequest& src) = default;
+        FGrantCharacterToUserRequest& operator=(FGrantCharacterToUserRequest&& src) = default;
+
         FGrantCharacterToUserRequest(const TSharedPtr<FJsonObject>& obj) : FGrantCharacterToUserRequest()
         {
             readFromValue(obj);
@@ -8479,7 +11949,13 @@ namespace ClientModels
         ~FGrantCharacterToUserRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGrantCharacterToUserResult : public PlayFab::FPlayFabCppResultCommon
@@ -8507,6 +11983,16 @@ namespace ClientModels
             Result(src.Result)
             {}
 
+        FGrantCharacterToUserResult(FGrantCharacterToUserResult&& src) :
+            FPlayFabCppResultCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CharacterType(MoveTemp(src.CharacterType)),
+            Result(MoveTemp(src.Result))
+            {}
+
+        FGrantCharacterToUserResult& operator=(const FGrantCharacterToUserResult& src) = default;
+        FGrantCharacterToUserResult& operator=(FGrantCharacterToUserResult&& src) = default;
+
         FGrantCharacterToUserResult(const TSharedPtr<FJsonObject>& obj) : FGrantCharacterToUserResult()
         {
             readFromValue(obj);
@@ -8515,7 +12001,13 @@ namespace ClientModels
         ~FGrantCharacterToUserResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FItemPurchaseRequest : public PlayFab::FPlayFabCppBaseModel
@@ -8547,6 +12039,17 @@ namespace ClientModels
             UpgradeFromItems(src.UpgradeFromItems)
             {}
 
+        FItemPurchaseRequest(FItemPurchaseRequest&& src) :
+            FPlayFabCppBaseModel(),
+            Annotation(MoveTemp(src.Annotation)),
+            ItemId(MoveTemp(src.ItemId)),
+            Quantity(MoveTemp(src.Quantity)),
+            UpgradeFromItems(MoveTemp(src.UpgradeFromItems))
+            {}
+
+        FItemPurchaseRequest& operator=(const FItemPurchaseRequest& src) = default;
+        FItemPurchaseRequest& operator=(FItemPurchaseRequest&& src) = default;
+
         FItemPurchaseRequest(const TSharedPtr<FJsonObject>& obj) : FItemPurchaseRequest()
         {
             readFromValue(obj);
@@ -8555,7 +12058,13 @@ namespace ClientModels
         ~FItemPurchaseRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkAndroidDeviceIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8592,6 +12101,18 @@ namespace ClientModels
             OS(src.OS)
             {}
 
+        FLinkAndroidDeviceIDRequest(FLinkAndroidDeviceIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AndroidDevice(MoveTemp(src.AndroidDevice)),
+            AndroidDeviceId(MoveTemp(src.AndroidDeviceId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            OS(MoveTemp(src.OS))
+            {}
+
+        FLinkAndroidDeviceIDRequest& operator=(const FLinkAndroidDeviceIDRequest& src) = default;
+        FLinkAndroidDeviceIDRequest& operator=(FLinkAndroidDeviceIDRequest&& src) = default;
+
         FLinkAndroidDeviceIDRequest(const TSharedPtr<FJsonObject>& obj) : FLinkAndroidDeviceIDRequest()
         {
             readFromValue(obj);
@@ -8600,7 +12121,13 @@ namespace ClientModels
         ~FLinkAndroidDeviceIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkAndroidDeviceIDResult : public PlayFab::FPlayFabCppResultCommon
@@ -8613,6 +12140,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkAndroidDeviceIDResult(FLinkAndroidDeviceIDResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkAndroidDeviceIDResult& operator=(const FLinkAndroidDeviceIDResult& src) = default;
+        FLinkAndroidDeviceIDResult& operator=(FLinkAndroidDeviceIDResult&& src) = default;
+
         FLinkAndroidDeviceIDResult(const TSharedPtr<FJsonObject>& obj) : FLinkAndroidDeviceIDResult()
         {
             readFromValue(obj);
@@ -8621,7 +12155,13 @@ namespace ClientModels
         ~FLinkAndroidDeviceIDResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkAppleRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8651,6 +12191,16 @@ namespace ClientModels
             IdentityToken(src.IdentityToken)
             {}
 
+        FLinkAppleRequest(FLinkAppleRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            IdentityToken(MoveTemp(src.IdentityToken))
+            {}
+
+        FLinkAppleRequest& operator=(const FLinkAppleRequest& src) = default;
+        FLinkAppleRequest& operator=(FLinkAppleRequest&& src) = default;
+
         FLinkAppleRequest(const TSharedPtr<FJsonObject>& obj) : FLinkAppleRequest()
         {
             readFromValue(obj);
@@ -8659,7 +12209,13 @@ namespace ClientModels
         ~FLinkAppleRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkCustomIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8686,6 +12242,16 @@ namespace ClientModels
             ForceLink(src.ForceLink)
             {}
 
+        FLinkCustomIDRequest(FLinkCustomIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomId(MoveTemp(src.CustomId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink))
+            {}
+
+        FLinkCustomIDRequest& operator=(const FLinkCustomIDRequest& src) = default;
+        FLinkCustomIDRequest& operator=(FLinkCustomIDRequest&& src) = default;
+
         FLinkCustomIDRequest(const TSharedPtr<FJsonObject>& obj) : FLinkCustomIDRequest()
         {
             readFromValue(obj);
@@ -8694,7 +12260,13 @@ namespace ClientModels
         ~FLinkCustomIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkCustomIDResult : public PlayFab::FPlayFabCppResultCommon
@@ -8707,6 +12279,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkCustomIDResult(FLinkCustomIDResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkCustomIDResult& operator=(const FLinkCustomIDResult& src) = default;
+        FLinkCustomIDResult& operator=(FLinkCustomIDResult&& src) = default;
+
         FLinkCustomIDResult(const TSharedPtr<FJsonObject>& obj) : FLinkCustomIDResult()
         {
             readFromValue(obj);
@@ -8715,7 +12294,13 @@ namespace ClientModels
         ~FLinkCustomIDResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkFacebookAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8742,6 +12327,16 @@ namespace ClientModels
             ForceLink(src.ForceLink)
             {}
 
+        FLinkFacebookAccountRequest(FLinkFacebookAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AccessToken(MoveTemp(src.AccessToken)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink))
+            {}
+
+        FLinkFacebookAccountRequest& operator=(const FLinkFacebookAccountRequest& src) = default;
+        FLinkFacebookAccountRequest& operator=(FLinkFacebookAccountRequest&& src) = default;
+
         FLinkFacebookAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkFacebookAccountRequest()
         {
             readFromValue(obj);
@@ -8750,7 +12345,13 @@ namespace ClientModels
         ~FLinkFacebookAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkFacebookAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -8763,6 +12364,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkFacebookAccountResult(FLinkFacebookAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkFacebookAccountResult& operator=(const FLinkFacebookAccountResult& src) = default;
+        FLinkFacebookAccountResult& operator=(FLinkFacebookAccountResult&& src) = default;
+
         FLinkFacebookAccountResult(const TSharedPtr<FJsonObject>& obj) : FLinkFacebookAccountResult()
         {
             readFromValue(obj);
@@ -8771,7 +12379,13 @@ namespace ClientModels
         ~FLinkFacebookAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkFacebookInstantGamesIdRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8798,6 +12412,16 @@ namespace ClientModels
             ForceLink(src.ForceLink)
             {}
 
+        FLinkFacebookInstantGamesIdRequest(FLinkFacebookInstantGamesIdRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            FacebookInstantGamesSignature(MoveTemp(src.FacebookInstantGamesSignature)),
+            ForceLink(MoveTemp(src.ForceLink))
+            {}
+
+        FLinkFacebookInstantGamesIdRequest& operator=(const FLinkFacebookInstantGamesIdRequest& src) = default;
+        FLinkFacebookInstantGamesIdRequest& operator=(FLinkFacebookInstantGamesIdRequest&& src) = default;
+
         FLinkFacebookInstantGamesIdRequest(const TSharedPtr<FJsonObject>& obj) : FLinkFacebookInstantGamesIdRequest()
         {
             readFromValue(obj);
@@ -8806,7 +12430,13 @@ namespace ClientModels
         ~FLinkFacebookInstantGamesIdRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkFacebookInstantGamesIdResult : public PlayFab::FPlayFabCppResultCommon
@@ -8815,10 +12445,17 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
-        FLinkFacebookInstantGamesIdResult(const FLinkFacebookInstantGamesIdResult& src) :
+        FLinkFacebookInstantGamesIdResult(const FLinkFacebookInstantGamesIdResult& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkFacebookInstantGamesIdResult(FLinkFacebookInstantGamesIdResult&& src) :
             FPlayFabCppResultCommon()
             {}
 
+        FLinkFacebookInstantGamesIdResult& operator=(const FLinkFacebookInstantGamesIdResult& src) = default;
+        FLinkFacebookInstantGamesIdResult& operator=(FLinkFacebookInstantGamesIdResult&& src) = default;
+
         FLinkFacebookInstantGamesIdResult(const TSharedPtr<FJsonObject>& obj) : FLinkFacebookInstantGamesIdResult()
         {
             readFromValue(obj);
@@ -8827,7 +12464,13 @@ namespace ClientModels
         ~FLinkFacebookInstantGamesIdResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkGameCenterAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8877,6 +12520,20 @@ namespace ClientModels
             Timestamp(src.Timestamp)
             {}
 
+        FLinkGameCenterAccountRequest(FLinkGameCenterAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            GameCenterId(MoveTemp(src.GameCenterId)),
+            PublicKeyUrl(MoveTemp(src.PublicKeyUrl)),
+            Salt(MoveTemp(src.Salt)),
+            Signature(MoveTemp(src.Signature)),
+            Timestamp(MoveTemp(src.Timestamp))
+            {}
+
+        FLinkGameCenterAccountRequest& operator=(const FLinkGameCenterAccountRequest& src) = default;
+        FLinkGameCenterAccountRequest& operator=(FLinkGameCenterAccountRequest&& src) = default;
+
         FLinkGameCenterAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkGameCenterAccountRequest()
         {
             readFromValue(obj);
@@ -8885,7 +12542,13 @@ namespace ClientModels
         ~FLinkGameCenterAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkGameCenterAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -8898,6 +12561,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkGameCenterAccountResult(FLinkGameCenterAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkGameCenterAccountResult& operator=(const FLinkGameCenterAccountResult& src) = default;
+        FLinkGameCenterAccountResult& operator=(FLinkGameCenterAccountResult&& src) = default;
+
         FLinkGameCenterAccountResult(const TSharedPtr<FJsonObject>& obj) : FLinkGameCenterAccountResult()
         {
             readFromValue(obj);
@@ -8906,7 +12576,13 @@ namespace ClientModels
         ~FLinkGameCenterAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkGoogleAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8936,6 +12612,16 @@ namespace ClientModels
             ServerAuthCode(src.ServerAuthCode)
             {}
 
+        FLinkGoogleAccountRequest(FLinkGoogleAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            ServerAuthCode(MoveTemp(src.ServerAuthCode))
+            {}
+
+        FLinkGoogleAccountRequest& operator=(const FLinkGoogleAccountRequest& src) = default;
+        FLinkGoogleAccountRequest& operator=(FLinkGoogleAccountRequest&& src) = default;
+
         FLinkGoogleAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkGoogleAccountRequest()
         {
             readFromValue(obj);
@@ -8944,7 +12630,13 @@ namespace ClientModels
         ~FLinkGoogleAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkGoogleAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -8957,6 +12649,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkGoogleAccountResult(FLinkGoogleAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkGoogleAccountResult& operator=(const FLinkGoogleAccountResult& src) = default;
+        FLinkGoogleAccountResult& operator=(FLinkGoogleAccountResult&& src) = default;
+
         FLinkGoogleAccountResult(const TSharedPtr<FJsonObject>& obj) : FLinkGoogleAccountResult()
         {
             readFromValue(obj);
@@ -8965,7 +12664,13 @@ namespace ClientModels
         ~FLinkGoogleAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkIOSDeviceIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9002,6 +12707,18 @@ namespace ClientModels
             OS(src.OS)
             {}
 
+        FLinkIOSDeviceIDRequest(FLinkIOSDeviceIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DeviceId(MoveTemp(src.DeviceId)),
+            DeviceModel(MoveTemp(src.DeviceModel)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            OS(MoveTemp(src.OS))
+            {}
+
+        FLinkIOSDeviceIDRequest& operator=(const FLinkIOSDeviceIDRequest& src) = default;
+        FLinkIOSDeviceIDRequest& operator=(FLinkIOSDeviceIDRequest&& src) = default;
+
         FLinkIOSDeviceIDRequest(const TSharedPtr<FJsonObject>& obj) : FLinkIOSDeviceIDRequest()
         {
             readFromValue(obj);
@@ -9010,7 +12727,13 @@ namespace ClientModels
         ~FLinkIOSDeviceIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkIOSDeviceIDResult : public PlayFab::FPlayFabCppResultCommon
@@ -9023,6 +12746,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkIOSDeviceIDResult(FLinkIOSDeviceIDResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkIOSDeviceIDResult& operator=(const FLinkIOSDeviceIDResult& src) = default;
+        FLinkIOSDeviceIDResult& operator=(FLinkIOSDeviceIDResult&& src) = default;
+
         FLinkIOSDeviceIDResult(const TSharedPtr<FJsonObject>& obj) : FLinkIOSDeviceIDResult()
         {
             readFromValue(obj);
@@ -9031,7 +12761,13 @@ namespace ClientModels
         ~FLinkIOSDeviceIDResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkKongregateAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9063,6 +12799,17 @@ namespace ClientModels
             KongregateId(src.KongregateId)
             {}
 
+        FLinkKongregateAccountRequest(FLinkKongregateAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AuthTicket(MoveTemp(src.AuthTicket)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            KongregateId(MoveTemp(src.KongregateId))
+            {}
+
+        FLinkKongregateAccountRequest& operator=(const FLinkKongregateAccountRequest& src) = default;
+        FLinkKongregateAccountRequest& operator=(FLinkKongregateAccountRequest&& src) = default;
+
         FLinkKongregateAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkKongregateAccountRequest()
         {
             readFromValue(obj);
@@ -9071,7 +12818,13 @@ namespace ClientModels
         ~FLinkKongregateAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkKongregateAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -9084,6 +12837,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkKongregateAccountResult(FLinkKongregateAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkKongregateAccountResult& operator=(const FLinkKongregateAccountResult& src) = default;
+        FLinkKongregateAccountResult& operator=(FLinkKongregateAccountResult&& src) = default;
+
         FLinkKongregateAccountResult(const TSharedPtr<FJsonObject>& obj) : FLinkKongregateAccountResult()
         {
             readFromValue(obj);
@@ -9092,7 +12852,13 @@ namespace ClientModels
         ~FLinkKongregateAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkNintendoServiceAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9122,6 +12888,16 @@ namespace ClientModels
             IdentityToken(src.IdentityToken)
             {}
 
+        FLinkNintendoServiceAccountRequest(FLinkNintendoServiceAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            IdentityToken(MoveTemp(src.IdentityToken))
+            {}
+
+        FLinkNintendoServiceAccountRequest& operator=(const FLinkNintendoServiceAccountRequest& src) = default;
+        FLinkNintendoServiceAccountRequest& operator=(FLinkNintendoServiceAccountRequest&& src) = default;
+
         FLinkNintendoServiceAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkNintendoServiceAccountRequest()
         {
             readFromValue(obj);
@@ -9130,7 +12906,13 @@ namespace ClientModels
         ~FLinkNintendoServiceAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkNintendoSwitchDeviceIdRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9157,6 +12939,16 @@ namespace ClientModels
             NintendoSwitchDeviceId(src.NintendoSwitchDeviceId)
             {}
 
+        FLinkNintendoSwitchDeviceIdRequest(FLinkNintendoSwitchDeviceIdRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            NintendoSwitchDeviceId(MoveTemp(src.NintendoSwitchDeviceId))
+            {}
+
+        FLinkNintendoSwitchDeviceIdRequest& operator=(const FLinkNintendoSwitchDeviceIdRequest& src) = default;
+        FLinkNintendoSwitchDeviceIdRequest& operator=(FLinkNintendoSwitchDeviceIdRequest&& src) = default;
+
         FLinkNintendoSwitchDeviceIdRequest(const TSharedPtr<FJsonObject>& obj) : FLinkNintendoSwitchDeviceIdRequest()
         {
             readFromValue(obj);
@@ -9165,7 +12957,13 @@ namespace ClientModels
         ~FLinkNintendoSwitchDeviceIdRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkNintendoSwitchDeviceIdResult : public PlayFab::FPlayFabCppResultCommon
@@ -9178,6 +12976,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkNintendoSwitchDeviceIdResult(FLinkNintendoSwitchDeviceIdResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkNintendoSwitchDeviceIdResult& operator=(const FLinkNintendoSwitchDeviceIdResult& src) = default;
+        FLinkNintendoSwitchDeviceIdResult& operator=(FLinkNintendoSwitchDeviceIdResult&& src) = default;
+
         FLinkNintendoSwitchDeviceIdResult(const TSharedPtr<FJsonObject>& obj) : FLinkNintendoSwitchDeviceIdResult()
         {
             readFromValue(obj);
@@ -9186,7 +12991,13 @@ namespace ClientModels
         ~FLinkNintendoSwitchDeviceIdResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkOpenIdConnectRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9221,6 +13032,17 @@ namespace ClientModels
             IdToken(src.IdToken)
             {}
 
+        FLinkOpenIdConnectRequest(FLinkOpenIdConnectRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ConnectionId(MoveTemp(src.ConnectionId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            IdToken(MoveTemp(src.IdToken))
+            {}
+
+        FLinkOpenIdConnectRequest& operator=(const FLinkOpenIdConnectRequest& src) = default;
+        FLinkOpenIdConnectRequest& operator=(FLinkOpenIdConnectRequest&& src) = default;
+
         FLinkOpenIdConnectRequest(const TSharedPtr<FJsonObject>& obj) : FLinkOpenIdConnectRequest()
         {
             readFromValue(obj);
@@ -9229,7 +13051,13 @@ namespace ClientModels
         ~FLinkOpenIdConnectRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkPSNAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9266,6 +13094,18 @@ namespace ClientModels
             RedirectUri(src.RedirectUri)
             {}
 
+        FLinkPSNAccountRequest(FLinkPSNAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AuthCode(MoveTemp(src.AuthCode)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            IssuerId(MoveTemp(src.IssuerId)),
+            RedirectUri(MoveTemp(src.RedirectUri))
+            {}
+
+        FLinkPSNAccountRequest& operator=(const FLinkPSNAccountRequest& src) = default;
+        FLinkPSNAccountRequest& operator=(FLinkPSNAccountRequest&& src) = default;
+
         FLinkPSNAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkPSNAccountRequest()
         {
             readFromValue(obj);
@@ -9274,7 +13114,13 @@ namespace ClientModels
         ~FLinkPSNAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkPSNAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -9287,6 +13133,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkPSNAccountResult(FLinkPSNAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkPSNAccountResult& operator=(const FLinkPSNAccountResult& src) = default;
+        FLinkPSNAccountResult& operator=(FLinkPSNAccountResult&& src) = default;
+
         FLinkPSNAccountResult(const TSharedPtr<FJsonObject>& obj) : FLinkPSNAccountResult()
         {
             readFromValue(obj);
@@ -9295,7 +13148,13 @@ namespace ClientModels
         ~FLinkPSNAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkSteamAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9325,6 +13184,16 @@ namespace ClientModels
             SteamTicket(src.SteamTicket)
             {}
 
+        FLinkSteamAccountRequest(FLinkSteamAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            SteamTicket(MoveTemp(src.SteamTicket))
+            {}
+
+        FLinkSteamAccountRequest& operator=(const FLinkSteamAccountRequest& src) = default;
+        FLinkSteamAccountRequest& operator=(FLinkSteamAccountRequest&& src) = default;
+
         FLinkSteamAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkSteamAccountRequest()
         {
             readFromValue(obj);
@@ -9333,7 +13202,13 @@ namespace ClientModels
         ~FLinkSteamAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkSteamAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -9346,6 +13221,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkSteamAccountResult(FLinkSteamAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkSteamAccountResult& operator=(const FLinkSteamAccountResult& src) = default;
+        FLinkSteamAccountResult& operator=(FLinkSteamAccountResult&& src) = default;
+
         FLinkSteamAccountResult(const TSharedPtr<FJsonObject>& obj) : FLinkSteamAccountResult()
         {
             readFromValue(obj);
@@ -9354,7 +13236,13 @@ namespace ClientModels
         ~FLinkSteamAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkTwitchAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9381,6 +13269,16 @@ namespace ClientModels
             ForceLink(src.ForceLink)
             {}
 
+        FLinkTwitchAccountRequest(FLinkTwitchAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AccessToken(MoveTemp(src.AccessToken)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink))
+            {}
+
+        FLinkTwitchAccountRequest& operator=(const FLinkTwitchAccountRequest& src) = default;
+        FLinkTwitchAccountRequest& operator=(FLinkTwitchAccountRequest&& src) = default;
+
         FLinkTwitchAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkTwitchAccountRequest()
         {
             readFromValue(obj);
@@ -9389,7 +13287,13 @@ namespace ClientModels
         ~FLinkTwitchAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkTwitchAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -9402,6 +13306,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkTwitchAccountResult(FLinkTwitchAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkTwitchAccountResult& operator=(const FLinkTwitchAccountResult& src) = default;
+        FLinkTwitchAccountResult& operator=(FLinkTwitchAccountResult&& src) = default;
+
         FLinkTwitchAccountResult(const TSharedPtr<FJsonObject>& obj) : FLinkTwitchAccountResult()
         {
             readFromValue(obj);
@@ -9410,7 +13321,13 @@ namespace ClientModels
         ~FLinkTwitchAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkWindowsHelloAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9447,6 +13364,18 @@ namespace ClientModels
             UserName(src.UserName)
             {}
 
+        FLinkWindowsHelloAccountRequest(FLinkWindowsHelloAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DeviceName(MoveTemp(src.DeviceName)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            PublicKey(MoveTemp(src.PublicKey)),
+            UserName(MoveTemp(src.UserName))
+            {}
+
+        FLinkWindowsHelloAccountRequest& operator=(const FLinkWindowsHelloAccountRequest& src) = default;
+        FLinkWindowsHelloAccountRequest& operator=(FLinkWindowsHelloAccountRequest&& src) = default;
+
         FLinkWindowsHelloAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkWindowsHelloAccountRequest()
         {
             readFromValue(obj);
@@ -9455,7 +13384,13 @@ namespace ClientModels
         ~FLinkWindowsHelloAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkWindowsHelloAccountResponse : public PlayFab::FPlayFabCppResultCommon
@@ -9468,6 +13403,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkWindowsHelloAccountResponse(FLinkWindowsHelloAccountResponse&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkWindowsHelloAccountResponse& operator=(const FLinkWindowsHelloAccountResponse& src) = default;
+        FLinkWindowsHelloAccountResponse& operator=(FLinkWindowsHelloAccountResponse&& src) = default;
+
         FLinkWindowsHelloAccountResponse(const TSharedPtr<FJsonObject>& obj) : FLinkWindowsHelloAccountResponse()
         {
             readFromValue(obj);
@@ -9476,7 +13418,13 @@ namespace ClientModels
         ~FLinkWindowsHelloAccountResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkXboxAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9503,6 +13451,16 @@ namespace ClientModels
             XboxToken(src.XboxToken)
             {}
 
+        FLinkXboxAccountRequest(FLinkXboxAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            XboxToken(MoveTemp(src.XboxToken))
+            {}
+
+        FLinkXboxAccountRequest& operator=(const FLinkXboxAccountRequest& src) = default;
+        FLinkXboxAccountRequest& operator=(FLinkXboxAccountRequest&& src) = default;
+
         FLinkXboxAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkXboxAccountRequest()
         {
             readFromValue(obj);
@@ -9511,7 +13469,13 @@ namespace ClientModels
         ~FLinkXboxAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkXboxAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -9524,6 +13488,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkXboxAccountResult(FLinkXboxAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkXboxAccountResult& operator=(const FLinkXboxAccountResult& src) = default;
+        FLinkXboxAccountResult& operator=(FLinkXboxAccountResult&& src) = default;
+
         FLinkXboxAccountResult(const TSharedPtr<FJsonObject>& obj) : FLinkXboxAccountResult()
         {
             readFromValue(obj);
@@ -9532,7 +13503,13 @@ namespace ClientModels
         ~FLinkXboxAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListUsersCharactersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9550,6 +13527,14 @@ namespace ClientModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FListUsersCharactersRequest(FListUsersCharactersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FListUsersCharactersRequest& operator=(const FListUsersCharactersRequest& src) = default;
+        FListUsersCharactersRequest& operator=(FListUsersCharactersRequest&& src) = default;
+
         FListUsersCharactersRequest(const TSharedPtr<FJsonObject>& obj) : FListUsersCharactersRequest()
         {
             readFromValue(obj);
@@ -9558,7 +13543,13 @@ namespace ClientModels
         ~FListUsersCharactersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListUsersCharactersResult : public PlayFab::FPlayFabCppResultCommon
@@ -9575,6 +13566,14 @@ namespace ClientModels
             Characters(src.Characters)
             {}
 
+        FListUsersCharactersResult(FListUsersCharactersResult&& src) :
+            FPlayFabCppResultCommon(),
+            Characters(MoveTemp(src.Characters))
+            {}
+
+        FListUsersCharactersResult& operator=(const FListUsersCharactersResult& src) = default;
+        FListUsersCharactersResult& operator=(FListUsersCharactersResult&& src) = default;
+
         FListUsersCharactersResult(const TSharedPtr<FJsonObject>& obj) : FListUsersCharactersResult()
         {
             readFromValue(obj);
@@ -9583,7 +13582,13 @@ namespace ClientModels
         ~FListUsersCharactersResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserSettings : public PlayFab::FPlayFabCppBaseModel
@@ -9611,6 +13616,16 @@ namespace ClientModels
             NeedsAttribution(src.NeedsAttribution)
             {}
 
+        FUserSettings(FUserSettings&& src) :
+            FPlayFabCppBaseModel(),
+            GatherDeviceInfo(MoveTemp(src.GatherDeviceInfo)),
+            GatherFocusInfo(MoveTemp(src.GatherFocusInfo)),
+            NeedsAttribution(MoveTemp(src.NeedsAttribution))
+            {}
+
+        FUserSettings& operator=(const FUserSettings& src) = default;
+        FUserSettings& operator=(FUserSettings&& src) = default;
+
         FUserSettings(const TSharedPtr<FJsonObject>& obj) : FUserSettings()
         {
             readFromValue(obj);
@@ -9619,7 +13634,13 @@ namespace ClientModels
         ~FUserSettings();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FVariable : public PlayFab::FPlayFabCppBaseModel
@@ -9642,6 +13663,15 @@ namespace ClientModels
             Value(src.Value)
             {}
 
+        FVariable(FVariable&& src) :
+            FPlayFabCppBaseModel(),
+            Name(MoveTemp(src.Name)),
+            Value(MoveTemp(src.Value))
+            {}
+
+        FVariable& operator=(const FVariable& src) = default;
+        FVariable& operator=(FVariable&& src) = default;
+
         FVariable(const TSharedPtr<FJsonObject>& obj) : FVariable()
         {
             readFromValue(obj);
@@ -9650,7 +13680,13 @@ namespace ClientModels
         ~FVariable();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FTreatmentAssignment : public PlayFab::FPlayFabCppBaseModel
@@ -9671,6 +13707,15 @@ namespace ClientModels
             Variants(src.Variants)
             {}
 
+        FTreatmentAssignment(FTreatmentAssignment&& src) :
+            FPlayFabCppBaseModel(),
+            Variables(MoveTemp(src.Variables)),
+            Variants(MoveTemp(src.Variants))
+            {}
+
+        FTreatmentAssignment& operator=(const FTreatmentAssignment& src) = default;
+        FTreatmentAssignment& operator=(FTreatmentAssignment&& src) = default;
+
         FTreatmentAssignment(const TSharedPtr<FJsonObject>& obj) : FTreatmentAssignment()
         {
             readFromValue(obj);
@@ -9679,7 +13724,13 @@ namespace ClientModels
         ~FTreatmentAssignment();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginResult : public PlayFab::FPlayFabLoginResultCommon
@@ -9725,16 +13776,31 @@ namespace ClientModels
 
         FLoginResult(const FLoginResult& src) :
             FPlayFabLoginResultCommon(),
-            EntityToken(src.EntityToken.IsValid() ? MakeShareable(new FEntityTokenResponse(*src.EntityToken)) : nullptr),
-            InfoResultPayload(src.InfoResultPayload.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoResultPayload(*src.InfoResultPayload)) : nullptr),
+            EntityToken(src.EntityToken.IsValid() ? TSharedPtr<FEntityTokenResponse>(MakeShared<FEntityTokenResponse>(*src.EntityToken)) : nullptr),
+            InfoResultPayload(src.InfoResultPayload.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoResultPayload>(MakeShared<FGetPlayerCombinedInfoResultPayload>(*src.InfoResultPayload)) : nullptr),
             LastLoginTime(src.LastLoginTime),
             NewlyCreated(src.NewlyCreated),
             PlayFabId(src.PlayFabId),
             SessionTicket(src.SessionTicket),
-            SettingsForUser(src.SettingsForUser.IsValid() ? MakeShareable(new FUserSettings(*src.SettingsForUser)) : nullptr),
-            pfTreatmentAssignment(src.pfTreatmentAssignment.IsValid() ? MakeShareable(new FTreatmentAssignment(*src.pfTreatmentAssignment)) : nullptr)
+            SettingsForUser(src.SettingsForUser.IsValid() ? TSharedPtr<FUserSettings>(MakeShared<FUserSettings>(*src.SettingsForUser)) : nullptr),
+            pfTreatmentAssignment(src.pfTreatmentAssignment.IsValid() ? TSharedPtr<FTreatmentAssignment>(MakeShared<FTreatmentAssignment>(*src.pfTreatmentAssignment)) : nullptr)
+            {}
+
+        FLoginResult(FLoginResult&& src) :
+            FPlayFabLoginResultCommon(),
+            EntityToken(MoveTemp(src.EntityToken)),
+            InfoResultPayload(MoveTemp(src.InfoResultPayload)),
+            LastLoginTime(MoveTemp(src.LastLoginTime)),
+            NewlyCreated(MoveTemp(src.NewlyCreated)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            SessionTicket(MoveTemp(src.SessionTicket)),
+            SettingsForUser(MoveTemp(src.SettingsForUser)),
+            pfTreatmentAssignment(MoveTemp(src.pfTreatmentAssignment))
             {}
 
+        FLoginResult& operator=(const FLoginResult& src) = default;
+        FLoginResult& operator=(FLoginResult&& src) = default;
+
         FLoginResult(const TSharedPtr<FJsonObject>& obj) : FLoginResult()
         {
             readFromValue(obj);
@@ -9743,7 +13809,13 @@ namespace ClientModels
         ~FLoginResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithAndroidDeviceIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9797,12 +13869,28 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             OS(src.OS),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithAndroidDeviceIDRequest(FLoginWithAndroidDeviceIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AndroidDevice(MoveTemp(src.AndroidDevice)),
+            AndroidDeviceId(MoveTemp(src.AndroidDeviceId)),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            OS(MoveTemp(src.OS)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithAndroidDeviceIDRequest& operator=(const FLoginWithAndroidDeviceIDRequest& src) = default;
+        FLoginWithAndroidDeviceIDRequest& operator=(FLoginWithAndroidDeviceIDRequest&& src) = default;
+
         FLoginWithAndroidDeviceIDRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithAndroidDeviceIDRequest()
         {
             readFromValue(obj);
@@ -9811,7 +13899,13 @@ namespace ClientModels
         ~FLoginWithAndroidDeviceIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithAppleRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9859,11 +13953,25 @@ namespace ClientModels
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
             IdentityToken(src.IdentityToken),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithAppleRequest(FLoginWithAppleRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            IdentityToken(MoveTemp(src.IdentityToken)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithAppleRequest& operator=(const FLoginWithAppleRequest& src) = default;
+        FLoginWithAppleRequest& operator=(FLoginWithAppleRequest&& src) = default;
+
         FLoginWithAppleRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithAppleRequest()
         {
             readFromValue(obj);
@@ -9872,7 +13980,13 @@ namespace ClientModels
         ~FLoginWithAppleRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithCustomIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9917,11 +14031,25 @@ namespace ClientModels
             CustomId(src.CustomId),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithCustomIDRequest(FLoginWithCustomIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomId(MoveTemp(src.CustomId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithCustomIDRequest& operator=(const FLoginWithCustomIDRequest& src) = default;
+        FLoginWithCustomIDRequest& operator=(FLoginWithCustomIDRequest&& src) = default;
+
         FLoginWithCustomIDRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithCustomIDRequest()
         {
             readFromValue(obj);
@@ -9930,7 +14058,13 @@ namespace ClientModels
         ~FLoginWithCustomIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithEmailAddressRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9965,11 +14099,23 @@ namespace ClientModels
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
             Email(src.Email),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             Password(src.Password),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithEmailAddressRequest(FLoginWithEmailAddressRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Email(MoveTemp(src.Email)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            Password(MoveTemp(src.Password)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithEmailAddressRequest& operator=(const FLoginWithEmailAddressRequest& src) = default;
+        FLoginWithEmailAddressRequest& operator=(FLoginWithEmailAddressRequest&& src) = default;
+
         FLoginWithEmailAddressRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithEmailAddressRequest()
         {
             readFromValue(obj);
@@ -9978,7 +14124,13 @@ namespace ClientModels
         ~FLoginWithEmailAddressRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithFacebookInstantGamesIdRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10023,11 +14175,25 @@ namespace ClientModels
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
             FacebookInstantGamesSignature(src.FacebookInstantGamesSignature),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithFacebookInstantGamesIdRequest(FLoginWithFacebookInstantGamesIdRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            FacebookInstantGamesSignature(MoveTemp(src.FacebookInstantGamesSignature)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithFacebookInstantGamesIdRequest& operator=(const FLoginWithFacebookInstantGamesIdRequest& src) = default;
+        FLoginWithFacebookInstantGamesIdRequest& operator=(FLoginWithFacebookInstantGamesIdRequest&& src) = default;
+
         FLoginWithFacebookInstantGamesIdRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithFacebookInstantGamesIdRequest()
         {
             readFromValue(obj);
@@ -10036,7 +14202,13 @@ namespace ClientModels
         ~FLoginWithFacebookInstantGamesIdRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithFacebookRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10081,11 +14253,25 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithFacebookRequest(FLoginWithFacebookRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AccessToken(MoveTemp(src.AccessToken)),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithFacebookRequest& operator=(const FLoginWithFacebookRequest& src) = default;
+        FLoginWithFacebookRequest& operator=(FLoginWithFacebookRequest&& src) = default;
+
         FLoginWithFacebookRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithFacebookRequest()
         {
             readFromValue(obj);
@@ -10094,7 +14280,13 @@ namespace ClientModels
         ~FLoginWithFacebookRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithGameCenterRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10157,7 +14349,7 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerId(src.PlayerId),
             PlayerSecret(src.PlayerSecret),
             PublicKeyUrl(src.PublicKeyUrl),
@@ -10167,6 +14359,24 @@ namespace ClientModels
             TitleId(src.TitleId)
             {}
 
+        FLoginWithGameCenterRequest(FLoginWithGameCenterRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerId(MoveTemp(src.PlayerId)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            PublicKeyUrl(MoveTemp(src.PublicKeyUrl)),
+            Salt(MoveTemp(src.Salt)),
+            Signature(MoveTemp(src.Signature)),
+            Timestamp(MoveTemp(src.Timestamp)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithGameCenterRequest& operator=(const FLoginWithGameCenterRequest& src) = default;
+        FLoginWithGameCenterRequest& operator=(FLoginWithGameCenterRequest&& src) = default;
+
         FLoginWithGameCenterRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithGameCenterRequest()
         {
             readFromValue(obj);
@@ -10175,7 +14385,13 @@ namespace ClientModels
         ~FLoginWithGameCenterRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithGoogleAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10222,12 +14438,26 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             ServerAuthCode(src.ServerAuthCode),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithGoogleAccountRequest(FLoginWithGoogleAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            ServerAuthCode(MoveTemp(src.ServerAuthCode)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithGoogleAccountRequest& operator=(const FLoginWithGoogleAccountRequest& src) = default;
+        FLoginWithGoogleAccountRequest& operator=(FLoginWithGoogleAccountRequest&& src) = default;
+
         FLoginWithGoogleAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithGoogleAccountRequest()
         {
             readFromValue(obj);
@@ -10236,7 +14466,13 @@ namespace ClientModels
         ~FLoginWithGoogleAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithIOSDeviceIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10290,12 +14526,28 @@ namespace ClientModels
             DeviceId(src.DeviceId),
             DeviceModel(src.DeviceModel),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             OS(src.OS),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithIOSDeviceIDRequest(FLoginWithIOSDeviceIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DeviceId(MoveTemp(src.DeviceId)),
+            DeviceModel(MoveTemp(src.DeviceModel)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            OS(MoveTemp(src.OS)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithIOSDeviceIDRequest& operator=(const FLoginWithIOSDeviceIDRequest& src) = default;
+        FLoginWithIOSDeviceIDRequest& operator=(FLoginWithIOSDeviceIDRequest&& src) = default;
+
         FLoginWithIOSDeviceIDRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithIOSDeviceIDRequest()
         {
             readFromValue(obj);
@@ -10304,7 +14556,13 @@ namespace ClientModels
         ~FLoginWithIOSDeviceIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithKongregateRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10353,12 +14611,27 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             KongregateId(src.KongregateId),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithKongregateRequest(FLoginWithKongregateRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AuthTicket(MoveTemp(src.AuthTicket)),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            KongregateId(MoveTemp(src.KongregateId)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithKongregateRequest& operator=(const FLoginWithKongregateRequest& src) = default;
+        FLoginWithKongregateRequest& operator=(FLoginWithKongregateRequest&& src) = default;
+
         FLoginWithKongregateRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithKongregateRequest()
         {
             readFromValue(obj);
@@ -10367,7 +14640,13 @@ namespace ClientModels
         ~FLoginWithKongregateRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithNintendoServiceAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10412,11 +14691,25 @@ namespace ClientModels
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
             IdentityToken(src.IdentityToken),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithNintendoServiceAccountRequest(FLoginWithNintendoServiceAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            IdentityToken(MoveTemp(src.IdentityToken)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithNintendoServiceAccountRequest& operator=(const FLoginWithNintendoServiceAccountRequest& src) = default;
+        FLoginWithNintendoServiceAccountRequest& operator=(FLoginWithNintendoServiceAccountRequest&& src) = default;
+
         FLoginWithNintendoServiceAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithNintendoServiceAccountRequest()
         {
             readFromValue(obj);
@@ -10425,7 +14718,13 @@ namespace ClientModels
         ~FLoginWithNintendoServiceAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithNintendoSwitchDeviceIdRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10469,12 +14768,26 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             NintendoSwitchDeviceId(src.NintendoSwitchDeviceId),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithNintendoSwitchDeviceIdRequest(FLoginWithNintendoSwitchDeviceIdRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            NintendoSwitchDeviceId(MoveTemp(src.NintendoSwitchDeviceId)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithNintendoSwitchDeviceIdRequest& operator=(const FLoginWithNintendoSwitchDeviceIdRequest& src) = default;
+        FLoginWithNintendoSwitchDeviceIdRequest& operator=(FLoginWithNintendoSwitchDeviceIdRequest&& src) = default;
+
         FLoginWithNintendoSwitchDeviceIdRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithNintendoSwitchDeviceIdRequest()
         {
             readFromValue(obj);
@@ -10483,7 +14796,13 @@ namespace ClientModels
         ~FLoginWithNintendoSwitchDeviceIdRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithOpenIdConnectRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10536,11 +14855,26 @@ namespace ClientModels
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
             IdToken(src.IdToken),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithOpenIdConnectRequest(FLoginWithOpenIdConnectRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ConnectionId(MoveTemp(src.ConnectionId)),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            IdToken(MoveTemp(src.IdToken)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithOpenIdConnectRequest& operator=(const FLoginWithOpenIdConnectRequest& src) = default;
+        FLoginWithOpenIdConnectRequest& operator=(FLoginWithOpenIdConnectRequest&& src) = default;
+
         FLoginWithOpenIdConnectRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithOpenIdConnectRequest()
         {
             readFromValue(obj);
@@ -10549,7 +14883,13 @@ namespace ClientModels
         ~FLoginWithOpenIdConnectRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithPlayFabRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10583,12 +14923,24 @@ namespace ClientModels
         FLoginWithPlayFabRequest(const FLoginWithPlayFabRequest& src) :
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             Password(src.Password),
             TitleId(src.TitleId),
             Username(src.Username)
             {}
 
+        FLoginWithPlayFabRequest(FLoginWithPlayFabRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            Password(MoveTemp(src.Password)),
+            TitleId(MoveTemp(src.TitleId)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FLoginWithPlayFabRequest& operator=(const FLoginWithPlayFabRequest& src) = default;
+        FLoginWithPlayFabRequest& operator=(FLoginWithPlayFabRequest&& src) = default;
+
         FLoginWithPlayFabRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithPlayFabRequest()
         {
             readFromValue(obj);
@@ -10597,7 +14949,13 @@ namespace ClientModels
         ~FLoginWithPlayFabRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithPSNRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10650,13 +15008,29 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             IssuerId(src.IssuerId),
             PlayerSecret(src.PlayerSecret),
             RedirectUri(src.RedirectUri),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithPSNRequest(FLoginWithPSNRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AuthCode(MoveTemp(src.AuthCode)),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            IssuerId(MoveTemp(src.IssuerId)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            RedirectUri(MoveTemp(src.RedirectUri)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithPSNRequest& operator=(const FLoginWithPSNRequest& src) = default;
+        FLoginWithPSNRequest& operator=(FLoginWithPSNRequest&& src) = default;
+
         FLoginWithPSNRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithPSNRequest()
         {
             readFromValue(obj);
@@ -10665,7 +15039,13 @@ namespace ClientModels
         ~FLoginWithPSNRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithSteamRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10712,12 +15092,26 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             SteamTicket(src.SteamTicket),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithSteamRequest(FLoginWithSteamRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            SteamTicket(MoveTemp(src.SteamTicket)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithSteamRequest& operator=(const FLoginWithSteamRequest& src) = default;
+        FLoginWithSteamRequest& operator=(FLoginWithSteamRequest&& src) = default;
+
         FLoginWithSteamRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithSteamRequest()
         {
             readFromValue(obj);
@@ -10726,7 +15120,13 @@ namespace ClientModels
         ~FLoginWithSteamRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithTwitchRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10771,11 +15171,25 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithTwitchRequest(FLoginWithTwitchRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AccessToken(MoveTemp(src.AccessToken)),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithTwitchRequest& operator=(const FLoginWithTwitchRequest& src) = default;
+        FLoginWithTwitchRequest& operator=(FLoginWithTwitchRequest&& src) = default;
+
         FLoginWithTwitchRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithTwitchRequest()
         {
             readFromValue(obj);
@@ -10784,7 +15198,13 @@ namespace ClientModels
         ~FLoginWithTwitchRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithWindowsHelloRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10819,11 +15239,23 @@ namespace ClientModels
             FPlayFabCppRequestCommon(),
             ChallengeSignature(src.ChallengeSignature),
             CustomTags(src.CustomTags),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PublicKeyHint(src.PublicKeyHint),
             TitleId(src.TitleId)
             {}
 
+        FLoginWithWindowsHelloRequest(FLoginWithWindowsHelloRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ChallengeSignature(MoveTemp(src.ChallengeSignature)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PublicKeyHint(MoveTemp(src.PublicKeyHint)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FLoginWithWindowsHelloRequest& operator=(const FLoginWithWindowsHelloRequest& src) = default;
+        FLoginWithWindowsHelloRequest& operator=(FLoginWithWindowsHelloRequest&& src) = default;
+
         FLoginWithWindowsHelloRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithWindowsHelloRequest()
         {
             readFromValue(obj);
@@ -10832,7 +15264,13 @@ namespace ClientModels
         ~FLoginWithWindowsHelloRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithXboxRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10876,12 +15314,26 @@ namespace ClientModels
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             TitleId(src.TitleId),
             XboxToken(src.XboxToken)
             {}
 
+        FLoginWithXboxRequest(FLoginWithXboxRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            TitleId(MoveTemp(src.TitleId)),
+            XboxToken(MoveTemp(src.XboxToken))
+            {}
+
+        FLoginWithXboxRequest& operator=(const FLoginWithXboxRequest& src) = default;
+        FLoginWithXboxRequest& operator=(FLoginWithXboxRequest&& src) = default;
+
         FLoginWithXboxRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithXboxRequest()
         {
             readFromValue(obj);
@@ -10890,7 +15342,13 @@ namespace ClientModels
         ~FLoginWithXboxRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMatchmakeRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10944,9 +15402,25 @@ namespace ClientModels
             pfRegion(src.pfRegion),
             StartNewIfNoneFound(src.StartNewIfNoneFound),
             StatisticName(src.StatisticName),
-            TagFilter(src.TagFilter.IsValid() ? MakeShareable(new FCollectionFilter(*src.TagFilter)) : nullptr)
+            TagFilter(src.TagFilter.IsValid() ? TSharedPtr<FCollectionFilter>(MakeShared<FCollectionFilter>(*src.TagFilter)) : nullptr)
+            {}
+
+        FMatchmakeRequest(FMatchmakeRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildVersion(MoveTemp(src.BuildVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            GameMode(MoveTemp(src.GameMode)),
+            LobbyId(MoveTemp(src.LobbyId)),
+            pfRegion(MoveTemp(src.pfRegion)),
+            StartNewIfNoneFound(MoveTemp(src.StartNewIfNoneFound)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            TagFilter(MoveTemp(src.TagFilter))
             {}
 
+        FMatchmakeRequest& operator=(const FMatchmakeRequest& src) = default;
+        FMatchmakeRequest& operator=(FMatchmakeRequest&& src) = default;
+
         FMatchmakeRequest(const TSharedPtr<FJsonObject>& obj) : FMatchmakeRequest()
         {
             readFromValue(obj);
@@ -10955,7 +15429,13 @@ namespace ClientModels
         ~FMatchmakeRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum MatchmakeStatus
@@ -10968,6 +15448,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeMatchmakeStatusEnumJSON(MatchmakeStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeMatchmakeStatusEnumJSON(MatchmakeStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API MatchmakeStatus readMatchmakeStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API MatchmakeStatus readMatchmakeStatusFromValue(const FString& value);
 
@@ -11026,6 +15507,22 @@ namespace ClientModels
             Ticket(src.Ticket)
             {}
 
+        FMatchmakeResult(FMatchmakeResult&& src) :
+            FPlayFabCppResultCommon(),
+            Expires(MoveTemp(src.Expires)),
+            LobbyID(MoveTemp(src.LobbyID)),
+            PollWaitTimeMS(MoveTemp(src.PollWaitTimeMS)),
+            ServerIPV4Address(MoveTemp(src.ServerIPV4Address)),
+            ServerIPV6Address(MoveTemp(src.ServerIPV6Address)),
+            ServerPort(MoveTemp(src.ServerPort)),
+            ServerPublicDNSName(MoveTemp(src.ServerPublicDNSName)),
+            Status(MoveTemp(src.Status)),
+            Ticket(MoveTemp(src.Ticket))
+            {}
+
+        FMatchmakeResult& operator=(const FMatchmakeResult& src) = default;
+        FMatchmakeResult& operator=(FMatchmakeResult&& src) = default;
+
         FMatchmakeResult(const TSharedPtr<FJsonObject>& obj) : FMatchmakeResult()
         {
             readFromValue(obj);
@@ -11034,7 +15531,13 @@ namespace ClientModels
         ~FMatchmakeResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FModifyUserVirtualCurrencyResult : public PlayFab::FPlayFabCppResultCommon
@@ -11070,6 +15573,17 @@ namespace ClientModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FModifyUserVirtualCurrencyResult(FModifyUserVirtualCurrencyResult&& src) :
+            FPlayFabCppResultCommon(),
+            Balance(MoveTemp(src.Balance)),
+            BalanceChange(MoveTemp(src.BalanceChange)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FModifyUserVirtualCurrencyResult& operator=(const FModifyUserVirtualCurrencyResult& src) = default;
+        FModifyUserVirtualCurrencyResult& operator=(FModifyUserVirtualCurrencyResult&& src) = default;
+
         FModifyUserVirtualCurrencyResult(const TSharedPtr<FJsonObject>& obj) : FModifyUserVirtualCurrencyResult()
         {
             readFromValue(obj);
@@ -11078,7 +15592,13 @@ namespace ClientModels
         ~FModifyUserVirtualCurrencyResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FOpenTradeRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11106,6 +15626,16 @@ namespace ClientModels
             RequestedCatalogItemIds(src.RequestedCatalogItemIds)
             {}
 
+        FOpenTradeRequest(FOpenTradeRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AllowedPlayerIds(MoveTemp(src.AllowedPlayerIds)),
+            OfferedInventoryInstanceIds(MoveTemp(src.OfferedInventoryInstanceIds)),
+            RequestedCatalogItemIds(MoveTemp(src.RequestedCatalogItemIds))
+            {}
+
+        FOpenTradeRequest& operator=(const FOpenTradeRequest& src) = default;
+        FOpenTradeRequest& operator=(FOpenTradeRequest&& src) = default;
+
         FOpenTradeRequest(const TSharedPtr<FJsonObject>& obj) : FOpenTradeRequest()
         {
             readFromValue(obj);
@@ -11114,7 +15644,13 @@ namespace ClientModels
         ~FOpenTradeRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FOpenTradeResponse : public PlayFab::FPlayFabCppResultCommon
@@ -11129,9 +15665,17 @@ namespace ClientModels
 
         FOpenTradeResponse(const FOpenTradeResponse& src) :
             FPlayFabCppResultCommon(),
-            Trade(src.Trade.IsValid() ? MakeShareable(new FTradeInfo(*src.Trade)) : nullptr)
+            Trade(src.Trade.IsValid() ? TSharedPtr<FTradeInfo>(MakeShared<FTradeInfo>(*src.Trade)) : nullptr)
+            {}
+
+        FOpenTradeResponse(FOpenTradeResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Trade(MoveTemp(src.Trade))
             {}
 
+        FOpenTradeResponse& operator=(const FOpenTradeResponse& src) = default;
+        FOpenTradeResponse& operator=(FOpenTradeResponse&& src) = default;
+
         FOpenTradeResponse(const TSharedPtr<FJsonObject>& obj) : FOpenTradeResponse()
         {
             readFromValue(obj);
@@ -11140,7 +15684,13 @@ namespace ClientModels
         ~FOpenTradeResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPayForPurchaseRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11177,6 +15727,18 @@ namespace ClientModels
             ProviderTransactionId(src.ProviderTransactionId)
             {}
 
+        FPayForPurchaseRequest(FPayForPurchaseRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Currency(MoveTemp(src.Currency)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            OrderId(MoveTemp(src.OrderId)),
+            ProviderName(MoveTemp(src.ProviderName)),
+            ProviderTransactionId(MoveTemp(src.ProviderTransactionId))
+            {}
+
+        FPayForPurchaseRequest& operator=(const FPayForPurchaseRequest& src) = default;
+        FPayForPurchaseRequest& operator=(FPayForPurchaseRequest&& src) = default;
+
         FPayForPurchaseRequest(const TSharedPtr<FJsonObject>& obj) : FPayForPurchaseRequest()
         {
             readFromValue(obj);
@@ -11185,7 +15747,13 @@ namespace ClientModels
         ~FPayForPurchaseRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum TransactionStatus
@@ -11213,6 +15781,7 @@ namespace ClientModels
     };
 
     PLAYFABCPP_API void writeTransactionStatusEnumJSON(TransactionStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeTransactionStatusEnumJSON(TransactionStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API TransactionStatus readTransactionStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API TransactionStatus readTransactionStatusFromValue(const FString& value);
 
@@ -11274,6 +15843,23 @@ namespace ClientModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FPayForPurchaseResult(FPayForPurchaseResult&& src) :
+            FPlayFabCppResultCommon(),
+            CreditApplied(MoveTemp(src.CreditApplied)),
+            OrderId(MoveTemp(src.OrderId)),
+            ProviderData(MoveTemp(src.ProviderData)),
+            ProviderToken(MoveTemp(src.ProviderToken)),
+            PurchaseConfirmationPageURL(MoveTemp(src.PurchaseConfirmationPageURL)),
+            PurchaseCurrency(MoveTemp(src.PurchaseCurrency)),
+            PurchasePrice(MoveTemp(src.PurchasePrice)),
+            Status(MoveTemp(src.Status)),
+            VCAmount(MoveTemp(src.VCAmount)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FPayForPurchaseResult& operator=(const FPayForPurchaseResult& src) = default;
+        FPayForPurchaseResult& operator=(FPayForPurchaseResult&& src) = default;
+
         FPayForPurchaseResult(const TSharedPtr<FJsonObject>& obj) : FPayForPurchaseResult()
         {
             readFromValue(obj);
@@ -11282,7 +15868,13 @@ namespace ClientModels
         ~FPayForPurchaseResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPaymentOption : public PlayFab::FPlayFabCppBaseModel
@@ -11315,6 +15907,17 @@ namespace ClientModels
             StoreCredit(src.StoreCredit)
             {}
 
+        FPaymentOption(FPaymentOption&& src) :
+            FPlayFabCppBaseModel(),
+            Currency(MoveTemp(src.Currency)),
+            Price(MoveTemp(src.Price)),
+            ProviderName(MoveTemp(src.ProviderName)),
+            StoreCredit(MoveTemp(src.StoreCredit))
+            {}
+
+        FPaymentOption& operator=(const FPaymentOption& src) = default;
+        FPaymentOption& operator=(FPaymentOption&& src) = default;
+
         FPaymentOption(const TSharedPtr<FJsonObject>& obj) : FPaymentOption()
         {
             readFromValue(obj);
@@ -11323,7 +15926,13 @@ namespace ClientModels
         ~FPaymentOption();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPurchaseItemRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11370,6 +15979,20 @@ namespace ClientModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FPurchaseItemRequest(FPurchaseItemRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ItemId(MoveTemp(src.ItemId)),
+            Price(MoveTemp(src.Price)),
+            StoreId(MoveTemp(src.StoreId)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FPurchaseItemRequest& operator=(const FPurchaseItemRequest& src) = default;
+        FPurchaseItemRequest& operator=(FPurchaseItemRequest&& src) = default;
+
         FPurchaseItemRequest(const TSharedPtr<FJsonObject>& obj) : FPurchaseItemRequest()
         {
             readFromValue(obj);
@@ -11378,7 +16001,13 @@ namespace ClientModels
         ~FPurchaseItemRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPurchaseItemResult : public PlayFab::FPlayFabCppResultCommon
@@ -11395,6 +16024,14 @@ namespace ClientModels
             Items(src.Items)
             {}
 
+        FPurchaseItemResult(FPurchaseItemResult&& src) :
+            FPlayFabCppResultCommon(),
+            Items(MoveTemp(src.Items))
+            {}
+
+        FPurchaseItemResult& operator=(const FPurchaseItemResult& src) = default;
+        FPurchaseItemResult& operator=(FPurchaseItemResult&& src) = default;
+
         FPurchaseItemResult(const TSharedPtr<FJsonObject>& obj) : FPurchaseItemResult()
         {
             readFromValue(obj);
@@ -11403,7 +16040,13 @@ namespace ClientModels
         ~FPurchaseItemResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPurchaseReceiptFulfillment : public PlayFab::FPlayFabCppBaseModel
@@ -11440,6 +16083,17 @@ namespace ClientModels
             RecordedTransactionTotal(src.RecordedTransactionTotal)
             {}
 
+        FPurchaseReceiptFulfillment(FPurchaseReceiptFulfillment&& src) :
+            FPlayFabCppBaseModel(),
+            FulfilledItems(MoveTemp(src.FulfilledItems)),
+            RecordedPriceSource(MoveTemp(src.RecordedPriceSource)),
+            RecordedTransactionCurrency(MoveTemp(src.RecordedTransactionCurrency)),
+            RecordedTransactionTotal(MoveTemp(src.RecordedTransactionTotal))
+            {}
+
+        FPurchaseReceiptFulfillment& operator=(const FPurchaseReceiptFulfillment& src) = default;
+        FPurchaseReceiptFulfillment& operator=(FPurchaseReceiptFulfillment&& src) = default;
+
         FPurchaseReceiptFulfillment(const TSharedPtr<FJsonObject>& obj) : FPurchaseReceiptFulfillment()
         {
             readFromValue(obj);
@@ -11448,7 +16102,13 @@ namespace ClientModels
         ~FPurchaseReceiptFulfillment();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRedeemCouponRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11480,6 +16140,17 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FRedeemCouponRequest(FRedeemCouponRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CouponCode(MoveTemp(src.CouponCode)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FRedeemCouponRequest& operator=(const FRedeemCouponRequest& src) = default;
+        FRedeemCouponRequest& operator=(FRedeemCouponRequest&& src) = default;
+
         FRedeemCouponRequest(const TSharedPtr<FJsonObject>& obj) : FRedeemCouponRequest()
         {
             readFromValue(obj);
@@ -11488,7 +16159,13 @@ namespace ClientModels
         ~FRedeemCouponRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRedeemCouponResult : public PlayFab::FPlayFabCppResultCommon
@@ -11505,6 +16182,14 @@ namespace ClientModels
             GrantedItems(src.GrantedItems)
             {}
 
+        FRedeemCouponResult(FRedeemCouponResult&& src) :
+            FPlayFabCppResultCommon(),
+            GrantedItems(MoveTemp(src.GrantedItems))
+            {}
+
+        FRedeemCouponResult& operator=(const FRedeemCouponResult& src) = default;
+        FRedeemCouponResult& operator=(FRedeemCouponResult&& src) = default;
+
         FRedeemCouponResult(const TSharedPtr<FJsonObject>& obj) : FRedeemCouponResult()
         {
             readFromValue(obj);
@@ -11513,7 +16198,13 @@ namespace ClientModels
         ~FRedeemCouponResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRefreshPSNAuthTokenRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11541,6 +16232,16 @@ namespace ClientModels
             RedirectUri(src.RedirectUri)
             {}
 
+        FRefreshPSNAuthTokenRequest(FRefreshPSNAuthTokenRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AuthCode(MoveTemp(src.AuthCode)),
+            IssuerId(MoveTemp(src.IssuerId)),
+            RedirectUri(MoveTemp(src.RedirectUri))
+            {}
+
+        FRefreshPSNAuthTokenRequest& operator=(const FRefreshPSNAuthTokenRequest& src) = default;
+        FRefreshPSNAuthTokenRequest& operator=(FRefreshPSNAuthTokenRequest&& src) = default;
+
         FRefreshPSNAuthTokenRequest(const TSharedPtr<FJsonObject>& obj) : FRefreshPSNAuthTokenRequest()
         {
             readFromValue(obj);
@@ -11549,7 +16250,13 @@ namespace ClientModels
         ~FRefreshPSNAuthTokenRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRegisterForIOSPushNotificationRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11577,6 +16284,16 @@ namespace ClientModels
             SendPushNotificationConfirmation(src.SendPushNotificationConfirmation)
             {}
 
+        FRegisterForIOSPushNotificationRequest(FRegisterForIOSPushNotificationRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ConfirmationMessage(MoveTemp(src.ConfirmationMessage)),
+            DeviceToken(MoveTemp(src.DeviceToken)),
+            SendPushNotificationConfirmation(MoveTemp(src.SendPushNotificationConfirmation))
+            {}
+
+        FRegisterForIOSPushNotificationRequest& operator=(const FRegisterForIOSPushNotificationRequest& src) = default;
+        FRegisterForIOSPushNotificationRequest& operator=(FRegisterForIOSPushNotificationRequest&& src) = default;
+
         FRegisterForIOSPushNotificationRequest(const TSharedPtr<FJsonObject>& obj) : FRegisterForIOSPushNotificationRequest()
         {
             readFromValue(obj);
@@ -11585,7 +16302,13 @@ namespace ClientModels
         ~FRegisterForIOSPushNotificationRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRegisterForIOSPushNotificationResult : public PlayFab::FPlayFabCppResultCommon
@@ -11598,6 +16321,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FRegisterForIOSPushNotificationResult(FRegisterForIOSPushNotificationResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FRegisterForIOSPushNotificationResult& operator=(const FRegisterForIOSPushNotificationResult& src) = default;
+        FRegisterForIOSPushNotificationResult& operator=(FRegisterForIOSPushNotificationResult&& src) = default;
+
         FRegisterForIOSPushNotificationResult(const TSharedPtr<FJsonObject>& obj) : FRegisterForIOSPushNotificationResult()
         {
             readFromValue(obj);
@@ -11606,7 +16336,13 @@ namespace ClientModels
         ~FRegisterForIOSPushNotificationResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRegisterPlayFabUserRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11667,7 +16403,7 @@ namespace ClientModels
             DisplayName(src.DisplayName),
             Email(src.Email),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             Password(src.Password),
             PlayerSecret(src.PlayerSecret),
             RequireBothUsernameAndEmail(src.RequireBothUsernameAndEmail),
@@ -11675,6 +16411,23 @@ namespace ClientModels
             Username(src.Username)
             {}
 
+        FRegisterPlayFabUserRequest(FRegisterPlayFabUserRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            Email(MoveTemp(src.Email)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            Password(MoveTemp(src.Password)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            RequireBothUsernameAndEmail(MoveTemp(src.RequireBothUsernameAndEmail)),
+            TitleId(MoveTemp(src.TitleId)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FRegisterPlayFabUserRequest& operator=(const FRegisterPlayFabUserRequest& src) = default;
+        FRegisterPlayFabUserRequest& operator=(FRegisterPlayFabUserRequest&& src) = default;
+
         FRegisterPlayFabUserRequest(const TSharedPtr<FJsonObject>& obj) : FRegisterPlayFabUserRequest()
         {
             readFromValue(obj);
@@ -11683,7 +16436,13 @@ namespace ClientModels
         ~FRegisterPlayFabUserRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRegisterPlayFabUserResult : public PlayFab::FPlayFabCppResultCommon
@@ -11717,13 +16476,25 @@ namespace ClientModels
 
         FRegisterPlayFabUserResult(const FRegisterPlayFabUserResult& src) :
             FPlayFabCppResultCommon(),
-            EntityToken(src.EntityToken.IsValid() ? MakeShareable(new FEntityTokenResponse(*src.EntityToken)) : nullptr),
+            EntityToken(src.EntityToken.IsValid() ? TSharedPtr<FEntityTokenResponse>(MakeShared<FEntityTokenResponse>(*src.EntityToken)) : nullptr),
             PlayFabId(src.PlayFabId),
             SessionTicket(src.SessionTicket),
-            SettingsForUser(src.SettingsForUser.IsValid() ? MakeShareable(new FUserSettings(*src.SettingsForUser)) : nullptr),
+            SettingsForUser(src.SettingsForUser.IsValid() ? TSharedPtr<FUserSettings>(MakeShared<FUserSettings>(*src.SettingsForUser)) : nullptr),
             Username(src.Username)
             {}
 
+        FRegisterPlayFabUserResult(FRegisterPlayFabUserResult&& src) :
+            FPlayFabCppResultCommon(),
+            EntityToken(MoveTemp(src.EntityToken)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            SessionTicket(MoveTemp(src.SessionTicket)),
+            SettingsForUser(MoveTemp(src.SettingsForUser)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FRegisterPlayFabUserResult& operator=(const FRegisterPlayFabUserResult& src) = default;
+        FRegisterPlayFabUserResult& operator=(FRegisterPlayFabUserResult&& src) = default;
+
         FRegisterPlayFabUserResult(const TSharedPtr<FJsonObject>& obj) : FRegisterPlayFabUserResult()
         {
             readFromValue(obj);
@@ -11732,7 +16503,13 @@ namespace ClientModels
         ~FRegisterPlayFabUserResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRegisterWithWindowsHelloRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11780,13 +16557,28 @@ namespace ClientModels
             CustomTags(src.CustomTags),
             DeviceName(src.DeviceName),
             EncryptedRequest(src.EncryptedRequest),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             PublicKey(src.PublicKey),
             TitleId(src.TitleId),
             UserName(src.UserName)
             {}
 
+        FRegisterWithWindowsHelloRequest(FRegisterWithWindowsHelloRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DeviceName(MoveTemp(src.DeviceName)),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            PublicKey(MoveTemp(src.PublicKey)),
+            TitleId(MoveTemp(src.TitleId)),
+            UserName(MoveTemp(src.UserName))
+            {}
+
+        FRegisterWithWindowsHelloRequest& operator=(const FRegisterWithWindowsHelloRequest& src) = default;
+        FRegisterWithWindowsHelloRequest& operator=(FRegisterWithWindowsHelloRequest&& src) = default;
+
         FRegisterWithWindowsHelloRequest(const TSharedPtr<FJsonObject>& obj) : FRegisterWithWindowsHelloRequest()
         {
             readFromValue(obj);
@@ -11795,7 +16587,13 @@ namespace ClientModels
         ~FRegisterWithWindowsHelloRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveContactEmailRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11812,6 +16610,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FRemoveContactEmailRequest(FRemoveContactEmailRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FRemoveContactEmailRequest& operator=(const FRemoveContactEmailRequest& src) = default;
+        FRemoveContactEmailRequest& operator=(FRemoveContactEmailRequest&& src) = default;
+
         FRemoveContactEmailRequest(const TSharedPtr<FJsonObject>& obj) : FRemoveContactEmailRequest()
         {
             readFromValue(obj);
@@ -11820,7 +16626,13 @@ namespace ClientModels
         ~FRemoveContactEmailRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveContactEmailResult : public PlayFab::FPlayFabCppResultCommon
@@ -11833,6 +16645,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FRemoveContactEmailResult(FRemoveContactEmailResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FRemoveContactEmailResult& operator=(const FRemoveContactEmailResult& src) = default;
+        FRemoveContactEmailResult& operator=(FRemoveContactEmailResult&& src) = default;
+
         FRemoveContactEmailResult(const TSharedPtr<FJsonObject>& obj) : FRemoveContactEmailResult()
         {
             readFromValue(obj);
@@ -11841,7 +16660,13 @@ namespace ClientModels
         ~FRemoveContactEmailResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveFriendRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11859,6 +16684,14 @@ namespace ClientModels
             FriendPlayFabId(src.FriendPlayFabId)
             {}
 
+        FRemoveFriendRequest(FRemoveFriendRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            FriendPlayFabId(MoveTemp(src.FriendPlayFabId))
+            {}
+
+        FRemoveFriendRequest& operator=(const FRemoveFriendRequest& src) = default;
+        FRemoveFriendRequest& operator=(FRemoveFriendRequest&& src) = default;
+
         FRemoveFriendRequest(const TSharedPtr<FJsonObject>& obj) : FRemoveFriendRequest()
         {
             readFromValue(obj);
@@ -11867,7 +16700,13 @@ namespace ClientModels
         ~FRemoveFriendRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveFriendResult : public PlayFab::FPlayFabCppResultCommon
@@ -11880,6 +16719,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FRemoveFriendResult(FRemoveFriendResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FRemoveFriendResult& operator=(const FRemoveFriendResult& src) = default;
+        FRemoveFriendResult& operator=(FRemoveFriendResult&& src) = default;
+
         FRemoveFriendResult(const TSharedPtr<FJsonObject>& obj) : FRemoveFriendResult()
         {
             readFromValue(obj);
@@ -11888,7 +16734,13 @@ namespace ClientModels
         ~FRemoveFriendResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveGenericIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11906,6 +16758,14 @@ namespace ClientModels
             GenericId(src.GenericId)
             {}
 
+        FRemoveGenericIDRequest(FRemoveGenericIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            GenericId(MoveTemp(src.GenericId))
+            {}
+
+        FRemoveGenericIDRequest& operator=(const FRemoveGenericIDRequest& src) = default;
+        FRemoveGenericIDRequest& operator=(FRemoveGenericIDRequest&& src) = default;
+
         FRemoveGenericIDRequest(const TSharedPtr<FJsonObject>& obj) : FRemoveGenericIDRequest()
         {
             readFromValue(obj);
@@ -11914,7 +16774,13 @@ namespace ClientModels
         ~FRemoveGenericIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveGenericIDResult : public PlayFab::FPlayFabCppResultCommon
@@ -11927,6 +16793,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FRemoveGenericIDResult(FRemoveGenericIDResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FRemoveGenericIDResult& operator=(const FRemoveGenericIDResult& src) = default;
+        FRemoveGenericIDResult& operator=(FRemoveGenericIDResult&& src) = default;
+
         FRemoveGenericIDResult(const TSharedPtr<FJsonObject>& obj) : FRemoveGenericIDResult()
         {
             readFromValue(obj);
@@ -11935,7 +16808,13 @@ namespace ClientModels
         ~FRemoveGenericIDResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveSharedGroupMembersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11957,6 +16836,15 @@ namespace ClientModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FRemoveSharedGroupMembersRequest(FRemoveSharedGroupMembersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabIds(MoveTemp(src.PlayFabIds)),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FRemoveSharedGroupMembersRequest& operator=(const FRemoveSharedGroupMembersRequest& src) = default;
+        FRemoveSharedGroupMembersRequest& operator=(FRemoveSharedGroupMembersRequest&& src) = default;
+
         FRemoveSharedGroupMembersRequest(const TSharedPtr<FJsonObject>& obj) : FRemoveSharedGroupMembersRequest()
         {
             readFromValue(obj);
@@ -11965,7 +16853,13 @@ namespace ClientModels
         ~FRemoveSharedGroupMembersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveSharedGroupMembersResult : public PlayFab::FPlayFabCppResultCommon
@@ -11978,6 +16872,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FRemoveSharedGroupMembersResult(FRemoveSharedGroupMembersResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FRemoveSharedGroupMembersResult& operator=(const FRemoveSharedGroupMembersResult& src) = default;
+        FRemoveSharedGroupMembersResult& operator=(FRemoveSharedGroupMembersResult&& src) = default;
+
         FRemoveSharedGroupMembersResult(const TSharedPtr<FJsonObject>& obj) : FRemoveSharedGroupMembersResult()
         {
             readFromValue(obj);
@@ -11986,7 +16887,13 @@ namespace ClientModels
         ~FRemoveSharedGroupMembersResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FReportAdActivityRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12018,6 +16925,17 @@ namespace ClientModels
             RewardId(src.RewardId)
             {}
 
+        FReportAdActivityRequest(FReportAdActivityRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Activity(MoveTemp(src.Activity)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlacementId(MoveTemp(src.PlacementId)),
+            RewardId(MoveTemp(src.RewardId))
+            {}
+
+        FReportAdActivityRequest& operator=(const FReportAdActivityRequest& src) = default;
+        FReportAdActivityRequest& operator=(FReportAdActivityRequest&& src) = default;
+
         FReportAdActivityRequest(const TSharedPtr<FJsonObject>& obj) : FReportAdActivityRequest()
         {
             readFromValue(obj);
@@ -12026,7 +16944,13 @@ namespace ClientModels
         ~FReportAdActivityRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FReportAdActivityResult : public PlayFab::FPlayFabCppResultCommon
@@ -12039,6 +16963,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FReportAdActivityResult(FReportAdActivityResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FReportAdActivityResult& operator=(const FReportAdActivityResult& src) = default;
+        FReportAdActivityResult& operator=(FReportAdActivityResult&& src) = default;
+
         FReportAdActivityResult(const TSharedPtr<FJsonObject>& obj) : FReportAdActivityResult()
         {
             readFromValue(obj);
@@ -12047,7 +16978,13 @@ namespace ClientModels
         ~FReportAdActivityResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FReportPlayerClientRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12074,6 +17011,16 @@ namespace ClientModels
             ReporteeId(src.ReporteeId)
             {}
 
+        FReportPlayerClientRequest(FReportPlayerClientRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Comment(MoveTemp(src.Comment)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ReporteeId(MoveTemp(src.ReporteeId))
+            {}
+
+        FReportPlayerClientRequest& operator=(const FReportPlayerClientRequest& src) = default;
+        FReportPlayerClientRequest& operator=(FReportPlayerClientRequest&& src) = default;
+
         FReportPlayerClientRequest(const TSharedPtr<FJsonObject>& obj) : FReportPlayerClientRequest()
         {
             readFromValue(obj);
@@ -12082,7 +17029,13 @@ namespace ClientModels
         ~FReportPlayerClientRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FReportPlayerClientResult : public PlayFab::FPlayFabCppResultCommon
@@ -12100,6 +17053,14 @@ namespace ClientModels
             SubmissionsRemaining(src.SubmissionsRemaining)
             {}
 
+        FReportPlayerClientResult(FReportPlayerClientResult&& src) :
+            FPlayFabCppResultCommon(),
+            SubmissionsRemaining(MoveTemp(src.SubmissionsRemaining))
+            {}
+
+        FReportPlayerClientResult& operator=(const FReportPlayerClientResult& src) = default;
+        FReportPlayerClientResult& operator=(FReportPlayerClientResult&& src) = default;
+
         FReportPlayerClientResult(const TSharedPtr<FJsonObject>& obj) : FReportPlayerClientResult()
         {
             readFromValue(obj);
@@ -12108,7 +17069,13 @@ namespace ClientModels
         ~FReportPlayerClientResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRestoreIOSPurchasesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12135,6 +17102,16 @@ namespace ClientModels
             ReceiptData(src.ReceiptData)
             {}
 
+        FRestoreIOSPurchasesRequest(FRestoreIOSPurchasesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ReceiptData(MoveTemp(src.ReceiptData))
+            {}
+
+        FRestoreIOSPurchasesRequest& operator=(const FRestoreIOSPurchasesRequest& src) = default;
+        FRestoreIOSPurchasesRequest& operator=(FRestoreIOSPurchasesRequest&& src) = default;
+
         FRestoreIOSPurchasesRequest(const TSharedPtr<FJsonObject>& obj) : FRestoreIOSPurchasesRequest()
         {
             readFromValue(obj);
@@ -12143,7 +17120,13 @@ namespace ClientModels
         ~FRestoreIOSPurchasesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRestoreIOSPurchasesResult : public PlayFab::FPlayFabCppResultCommon
@@ -12160,6 +17143,14 @@ namespace ClientModels
             Fulfillments(src.Fulfillments)
             {}
 
+        FRestoreIOSPurchasesResult(FRestoreIOSPurchasesResult&& src) :
+            FPlayFabCppResultCommon(),
+            Fulfillments(MoveTemp(src.Fulfillments))
+            {}
+
+        FRestoreIOSPurchasesResult& operator=(const FRestoreIOSPurchasesResult& src) = default;
+        FRestoreIOSPurchasesResult& operator=(FRestoreIOSPurchasesResult&& src) = default;
+
         FRestoreIOSPurchasesResult(const TSharedPtr<FJsonObject>& obj) : FRestoreIOSPurchasesResult()
         {
             readFromValue(obj);
@@ -12168,7 +17159,13 @@ namespace ClientModels
         ~FRestoreIOSPurchasesResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRewardAdActivityRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12195,6 +17192,16 @@ namespace ClientModels
             RewardId(src.RewardId)
             {}
 
+        FRewardAdActivityRequest(FRewardAdActivityRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlacementId(MoveTemp(src.PlacementId)),
+            RewardId(MoveTemp(src.RewardId))
+            {}
+
+        FRewardAdActivityRequest& operator=(const FRewardAdActivityRequest& src) = default;
+        FRewardAdActivityRequest& operator=(FRewardAdActivityRequest&& src) = default;
+
         FRewardAdActivityRequest(const TSharedPtr<FJsonObject>& obj) : FRewardAdActivityRequest()
         {
             readFromValue(obj);
@@ -12203,7 +17210,13 @@ namespace ClientModels
         ~FRewardAdActivityRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRewardAdActivityResult : public PlayFab::FPlayFabCppResultCommon
@@ -12247,9 +17260,23 @@ namespace ClientModels
             PlacementName(src.PlacementName),
             PlacementViewsRemaining(src.PlacementViewsRemaining),
             PlacementViewsResetMinutes(src.PlacementViewsResetMinutes),
-            RewardResults(src.RewardResults.IsValid() ? MakeShareable(new FAdRewardResults(*src.RewardResults)) : nullptr)
+            RewardResults(src.RewardResults.IsValid() ? TSharedPtr<FAdRewardResults>(MakeShared<FAdRewardResults>(*src.RewardResults)) : nullptr)
             {}
 
+        FRewardAdActivityResult(FRewardAdActivityResult&& src) :
+            FPlayFabCppResultCommon(),
+            AdActivityEventId(MoveTemp(src.AdActivityEventId)),
+            DebugResults(MoveTemp(src.DebugResults)),
+            PlacementId(MoveTemp(src.PlacementId)),
+            PlacementName(MoveTemp(src.PlacementName)),
+            PlacementViewsRemaining(MoveTemp(src.PlacementViewsRemaining)),
+            PlacementViewsResetMinutes(MoveTemp(src.PlacementViewsResetMinutes)),
+            RewardResults(MoveTemp(src.RewardResults))
+            {}
+
+        FRewardAdActivityResult& operator=(const FRewardAdActivityResult& src) = default;
+        FRewardAdActivityResult& operator=(FRewardAdActivityResult&& src) = default;
+
         FRewardAdActivityResult(const TSharedPtr<FJsonObject>& obj) : FRewardAdActivityResult()
         {
             readFromValue(obj);
@@ -12258,7 +17285,13 @@ namespace ClientModels
         ~FRewardAdActivityResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSendAccountRecoveryEmailRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12293,6 +17326,17 @@ namespace ClientModels
             TitleId(src.TitleId)
             {}
 
+        FSendAccountRecoveryEmailRequest(FSendAccountRecoveryEmailRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Email(MoveTemp(src.Email)),
+            EmailTemplateId(MoveTemp(src.EmailTemplateId)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FSendAccountRecoveryEmailRequest& operator=(const FSendAccountRecoveryEmailRequest& src) = default;
+        FSendAccountRecoveryEmailRequest& operator=(FSendAccountRecoveryEmailRequest&& src) = default;
+
         FSendAccountRecoveryEmailRequest(const TSharedPtr<FJsonObject>& obj) : FSendAccountRecoveryEmailRequest()
         {
             readFromValue(obj);
@@ -12301,7 +17345,13 @@ namespace ClientModels
         ~FSendAccountRecoveryEmailRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSendAccountRecoveryEmailResult : public PlayFab::FPlayFabCppResultCommon
@@ -12314,6 +17364,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FSendAccountRecoveryEmailResult(FSendAccountRecoveryEmailResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSendAccountRecoveryEmailResult& operator=(const FSendAccountRecoveryEmailResult& src) = default;
+        FSendAccountRecoveryEmailResult& operator=(FSendAccountRecoveryEmailResult&& src) = default;
+
         FSendAccountRecoveryEmailResult(const TSharedPtr<FJsonObject>& obj) : FSendAccountRecoveryEmailResult()
         {
             readFromValue(obj);
@@ -12322,7 +17379,13 @@ namespace ClientModels
         ~FSendAccountRecoveryEmailResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetFriendTagsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12344,6 +17407,15 @@ namespace ClientModels
             Tags(src.Tags)
             {}
 
+        FSetFriendTagsRequest(FSetFriendTagsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            FriendPlayFabId(MoveTemp(src.FriendPlayFabId)),
+            Tags(MoveTemp(src.Tags))
+            {}
+
+        FSetFriendTagsRequest& operator=(const FSetFriendTagsRequest& src) = default;
+        FSetFriendTagsRequest& operator=(FSetFriendTagsRequest&& src) = default;
+
         FSetFriendTagsRequest(const TSharedPtr<FJsonObject>& obj) : FSetFriendTagsRequest()
         {
             readFromValue(obj);
@@ -12352,7 +17424,13 @@ namespace ClientModels
         ~FSetFriendTagsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetFriendTagsResult : public PlayFab::FPlayFabCppResultCommon
@@ -12365,6 +17443,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FSetFriendTagsResult(FSetFriendTagsResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSetFriendTagsResult& operator=(const FSetFriendTagsResult& src) = default;
+        FSetFriendTagsResult& operator=(FSetFriendTagsResult&& src) = default;
+
         FSetFriendTagsResult(const TSharedPtr<FJsonObject>& obj) : FSetFriendTagsResult()
         {
             readFromValue(obj);
@@ -12373,7 +17458,13 @@ namespace ClientModels
         ~FSetFriendTagsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetPlayerSecretRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12396,6 +17487,15 @@ namespace ClientModels
             PlayerSecret(src.PlayerSecret)
             {}
 
+        FSetPlayerSecretRequest(FSetPlayerSecretRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            EncryptedRequest(MoveTemp(src.EncryptedRequest)),
+            PlayerSecret(MoveTemp(src.PlayerSecret))
+            {}
+
+        FSetPlayerSecretRequest& operator=(const FSetPlayerSecretRequest& src) = default;
+        FSetPlayerSecretRequest& operator=(FSetPlayerSecretRequest&& src) = default;
+
         FSetPlayerSecretRequest(const TSharedPtr<FJsonObject>& obj) : FSetPlayerSecretRequest()
         {
             readFromValue(obj);
@@ -12404,7 +17504,13 @@ namespace ClientModels
         ~FSetPlayerSecretRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetPlayerSecretResult : public PlayFab::FPlayFabCppResultCommon
@@ -12417,6 +17523,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FSetPlayerSecretResult(FSetPlayerSecretResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSetPlayerSecretResult& operator=(const FSetPlayerSecretResult& src) = default;
+        FSetPlayerSecretResult& operator=(FSetPlayerSecretResult&& src) = default;
+
         FSetPlayerSecretResult(const TSharedPtr<FJsonObject>& obj) : FSetPlayerSecretResult()
         {
             readFromValue(obj);
@@ -12425,7 +17538,13 @@ namespace ClientModels
         ~FSetPlayerSecretResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStartGameRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12472,6 +17591,20 @@ namespace ClientModels
             StatisticName(src.StatisticName)
             {}
 
+        FStartGameRequest(FStartGameRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildVersion(MoveTemp(src.BuildVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomCommandLineData(MoveTemp(src.CustomCommandLineData)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            GameMode(MoveTemp(src.GameMode)),
+            pfRegion(MoveTemp(src.pfRegion)),
+            StatisticName(MoveTemp(src.StatisticName))
+            {}
+
+        FStartGameRequest& operator=(const FStartGameRequest& src) = default;
+        FStartGameRequest& operator=(FStartGameRequest&& src) = default;
+
         FStartGameRequest(const TSharedPtr<FJsonObject>& obj) : FStartGameRequest()
         {
             readFromValue(obj);
@@ -12480,7 +17613,13 @@ namespace ClientModels
         ~FStartGameRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStartGameResult : public PlayFab::FPlayFabCppResultCommon
@@ -12533,6 +17672,21 @@ namespace ClientModels
             Ticket(src.Ticket)
             {}
 
+        FStartGameResult(FStartGameResult&& src) :
+            FPlayFabCppResultCommon(),
+            Expires(MoveTemp(src.Expires)),
+            LobbyID(MoveTemp(src.LobbyID)),
+            Password(MoveTemp(src.Password)),
+            ServerIPV4Address(MoveTemp(src.ServerIPV4Address)),
+            ServerIPV6Address(MoveTemp(src.ServerIPV6Address)),
+            ServerPort(MoveTemp(src.ServerPort)),
+            ServerPublicDNSName(MoveTemp(src.ServerPublicDNSName)),
+            Ticket(MoveTemp(src.Ticket))
+            {}
+
+        FStartGameResult& operator=(const FStartGameResult& src) = default;
+        FStartGameResult& operator=(FStartGameResult&& src) = default;
+
         FStartGameResult(const TSharedPtr<FJsonObject>& obj) : FStartGameResult()
         {
             readFromValue(obj);
@@ -12541,7 +17695,13 @@ namespace ClientModels
         ~FStartGameResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStartPurchaseRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12572,6 +17732,17 @@ namespace ClientModels
             StoreId(src.StoreId)
             {}
 
+        FStartPurchaseRequest(FStartPurchaseRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Items(MoveTemp(src.Items)),
+            StoreId(MoveTemp(src.StoreId))
+            {}
+
+        FStartPurchaseRequest& operator=(const FStartPurchaseRequest& src) = default;
+        FStartPurchaseRequest& operator=(FStartPurchaseRequest&& src) = default;
+
         FStartPurchaseRequest(const TSharedPtr<FJsonObject>& obj) : FStartPurchaseRequest()
         {
             readFromValue(obj);
@@ -12580,7 +17751,13 @@ namespace ClientModels
         ~FStartPurchaseRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStartPurchaseResult : public PlayFab::FPlayFabCppResultCommon
@@ -12610,6 +17787,17 @@ namespace ClientModels
             VirtualCurrencyBalances(src.VirtualCurrencyBalances)
             {}
 
+        FStartPurchaseResult(FStartPurchaseResult&& src) :
+            FPlayFabCppResultCommon(),
+            Contents(MoveTemp(src.Contents)),
+            OrderId(MoveTemp(src.OrderId)),
+            PaymentOptions(MoveTemp(src.PaymentOptions)),
+            VirtualCurrencyBalances(MoveTemp(src.VirtualCurrencyBalances))
+            {}
+
+        FStartPurchaseResult& operator=(const FStartPurchaseResult& src) = default;
+        FStartPurchaseResult& operator=(FStartPurchaseResult&& src) = default;
+
         FStartPurchaseResult(const TSharedPtr<FJsonObject>& obj) : FStartPurchaseResult()
         {
             readFromValue(obj);
@@ -12618,7 +17806,13 @@ namespace ClientModels
         ~FStartPurchaseResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStatisticUpdate : public PlayFab::FPlayFabCppBaseModel
@@ -12649,6 +17843,16 @@ namespace ClientModels
             Version(src.Version)
             {}
 
+        FStatisticUpdate(FStatisticUpdate&& src) :
+            FPlayFabCppBaseModel(),
+            StatisticName(MoveTemp(src.StatisticName)),
+            Value(MoveTemp(src.Value)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FStatisticUpdate& operator=(const FStatisticUpdate& src) = default;
+        FStatisticUpdate& operator=(FStatisticUpdate&& src) = default;
+
         FStatisticUpdate(const TSharedPtr<FJsonObject>& obj) : FStatisticUpdate()
         {
             readFromValue(obj);
@@ -12657,7 +17861,13 @@ namespace ClientModels
         ~FStatisticUpdate();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSubtractUserVirtualCurrencyRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12684,6 +17894,16 @@ namespace ClientModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FSubtractUserVirtualCurrencyRequest(FSubtractUserVirtualCurrencyRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Amount(MoveTemp(src.Amount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FSubtractUserVirtualCurrencyRequest& operator=(const FSubtractUserVirtualCurrencyRequest& src) = default;
+        FSubtractUserVirtualCurrencyRequest& operator=(FSubtractUserVirtualCurrencyRequest&& src) = default;
+
         FSubtractUserVirtualCurrencyRequest(const TSharedPtr<FJsonObject>& obj) : FSubtractUserVirtualCurrencyRequest()
         {
             readFromValue(obj);
@@ -12692,7 +17912,13 @@ namespace ClientModels
         ~FSubtractUserVirtualCurrencyRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkAndroidDeviceIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12717,6 +17943,15 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkAndroidDeviceIDRequest(FUnlinkAndroidDeviceIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AndroidDeviceId(MoveTemp(src.AndroidDeviceId)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkAndroidDeviceIDRequest& operator=(const FUnlinkAndroidDeviceIDRequest& src) = default;
+        FUnlinkAndroidDeviceIDRequest& operator=(FUnlinkAndroidDeviceIDRequest&& src) = default;
+
         FUnlinkAndroidDeviceIDRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkAndroidDeviceIDRequest()
         {
             readFromValue(obj);
@@ -12725,7 +17960,13 @@ namespace ClientModels
         ~FUnlinkAndroidDeviceIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkAndroidDeviceIDResult : public PlayFab::FPlayFabCppResultCommon
@@ -12738,6 +17979,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkAndroidDeviceIDResult(FUnlinkAndroidDeviceIDResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkAndroidDeviceIDResult& operator=(const FUnlinkAndroidDeviceIDResult& src) = default;
+        FUnlinkAndroidDeviceIDResult& operator=(FUnlinkAndroidDeviceIDResult&& src) = default;
+
         FUnlinkAndroidDeviceIDResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkAndroidDeviceIDResult()
         {
             readFromValue(obj);
@@ -12746,7 +17994,13 @@ namespace ClientModels
         ~FUnlinkAndroidDeviceIDResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkAppleRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12763,6 +18017,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkAppleRequest(FUnlinkAppleRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkAppleRequest& operator=(const FUnlinkAppleRequest& src) = default;
+        FUnlinkAppleRequest& operator=(FUnlinkAppleRequest&& src) = default;
+
         FUnlinkAppleRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkAppleRequest()
         {
             readFromValue(obj);
@@ -12771,7 +18033,13 @@ namespace ClientModels
         ~FUnlinkAppleRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkCustomIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12796,6 +18064,15 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkCustomIDRequest(FUnlinkCustomIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomId(MoveTemp(src.CustomId)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkCustomIDRequest& operator=(const FUnlinkCustomIDRequest& src) = default;
+        FUnlinkCustomIDRequest& operator=(FUnlinkCustomIDRequest&& src) = default;
+
         FUnlinkCustomIDRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkCustomIDRequest()
         {
             readFromValue(obj);
@@ -12804,7 +18081,13 @@ namespace ClientModels
         ~FUnlinkCustomIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkCustomIDResult : public PlayFab::FPlayFabCppResultCommon
@@ -12817,6 +18100,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkCustomIDResult(FUnlinkCustomIDResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkCustomIDResult& operator=(const FUnlinkCustomIDResult& src) = default;
+        FUnlinkCustomIDResult& operator=(FUnlinkCustomIDResult&& src) = default;
+
         FUnlinkCustomIDResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkCustomIDResult()
         {
             readFromValue(obj);
@@ -12825,7 +18115,13 @@ namespace ClientModels
         ~FUnlinkCustomIDResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkFacebookAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12842,6 +18138,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkFacebookAccountRequest(FUnlinkFacebookAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkFacebookAccountRequest& operator=(const FUnlinkFacebookAccountRequest& src) = default;
+        FUnlinkFacebookAccountRequest& operator=(FUnlinkFacebookAccountRequest&& src) = default;
+
         FUnlinkFacebookAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkFacebookAccountRequest()
         {
             readFromValue(obj);
@@ -12850,7 +18154,13 @@ namespace ClientModels
         ~FUnlinkFacebookAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkFacebookAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -12863,6 +18173,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkFacebookAccountResult(FUnlinkFacebookAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkFacebookAccountResult& operator=(const FUnlinkFacebookAccountResult& src) = default;
+        FUnlinkFacebookAccountResult& operator=(FUnlinkFacebookAccountResult&& src) = default;
+
         FUnlinkFacebookAccountResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkFacebookAccountResult()
         {
             readFromValue(obj);
@@ -12871,7 +18188,13 @@ namespace ClientModels
         ~FUnlinkFacebookAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkFacebookInstantGamesIdRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12893,6 +18216,15 @@ namespace ClientModels
             FacebookInstantGamesId(src.FacebookInstantGamesId)
             {}
 
+        FUnlinkFacebookInstantGamesIdRequest(FUnlinkFacebookInstantGamesIdRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            FacebookInstantGamesId(MoveTemp(src.FacebookInstantGamesId))
+            {}
+
+        FUnlinkFacebookInstantGamesIdRequest& operator=(const FUnlinkFacebookInstantGamesIdRequest& src) = default;
+        FUnlinkFacebookInstantGamesIdRequest& operator=(FUnlinkFacebookInstantGamesIdRequest&& src) = default;
+
         FUnlinkFacebookInstantGamesIdRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkFacebookInstantGamesIdRequest()
         {
             readFromValue(obj);
@@ -12901,7 +18233,13 @@ namespace ClientModels
         ~FUnlinkFacebookInstantGamesIdRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkFacebookInstantGamesIdResult : public PlayFab::FPlayFabCppResultCommon
@@ -12914,6 +18252,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkFacebookInstantGamesIdResult(FUnlinkFacebookInstantGamesIdResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkFacebookInstantGamesIdResult& operator=(const FUnlinkFacebookInstantGamesIdResult& src) = default;
+        FUnlinkFacebookInstantGamesIdResult& operator=(FUnlinkFacebookInstantGamesIdResult&& src) = default;
+
         FUnlinkFacebookInstantGamesIdResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkFacebookInstantGamesIdResult()
         {
             readFromValue(obj);
@@ -12922,7 +18267,13 @@ namespace ClientModels
         ~FUnlinkFacebookInstantGamesIdResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkGameCenterAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12939,6 +18290,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkGameCenterAccountRequest(FUnlinkGameCenterAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkGameCenterAccountRequest& operator=(const FUnlinkGameCenterAccountRequest& src) = default;
+        FUnlinkGameCenterAccountRequest& operator=(FUnlinkGameCenterAccountRequest&& src) = default;
+
         FUnlinkGameCenterAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkGameCenterAccountRequest()
         {
             readFromValue(obj);
@@ -12947,7 +18306,13 @@ namespace ClientModels
         ~FUnlinkGameCenterAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkGameCenterAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -12960,6 +18325,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkGameCenterAccountResult(FUnlinkGameCenterAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkGameCenterAccountResult& operator=(const FUnlinkGameCenterAccountResult& src) = default;
+        FUnlinkGameCenterAccountResult& operator=(FUnlinkGameCenterAccountResult&& src) = default;
+
         FUnlinkGameCenterAccountResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkGameCenterAccountResult()
         {
             readFromValue(obj);
@@ -12968,7 +18340,13 @@ namespace ClientModels
         ~FUnlinkGameCenterAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkGoogleAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12985,6 +18363,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkGoogleAccountRequest(FUnlinkGoogleAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkGoogleAccountRequest& operator=(const FUnlinkGoogleAccountRequest& src) = default;
+        FUnlinkGoogleAccountRequest& operator=(FUnlinkGoogleAccountRequest&& src) = default;
+
         FUnlinkGoogleAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkGoogleAccountRequest()
         {
             readFromValue(obj);
@@ -12993,7 +18379,13 @@ namespace ClientModels
         ~FUnlinkGoogleAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkGoogleAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -13006,6 +18398,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkGoogleAccountResult(FUnlinkGoogleAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkGoogleAccountResult& operator=(const FUnlinkGoogleAccountResult& src) = default;
+        FUnlinkGoogleAccountResult& operator=(FUnlinkGoogleAccountResult&& src) = default;
+
         FUnlinkGoogleAccountResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkGoogleAccountResult()
         {
             readFromValue(obj);
@@ -13014,7 +18413,13 @@ namespace ClientModels
         ~FUnlinkGoogleAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkIOSDeviceIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13039,6 +18444,15 @@ namespace ClientModels
             DeviceId(src.DeviceId)
             {}
 
+        FUnlinkIOSDeviceIDRequest(FUnlinkIOSDeviceIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DeviceId(MoveTemp(src.DeviceId))
+            {}
+
+        FUnlinkIOSDeviceIDRequest& operator=(const FUnlinkIOSDeviceIDRequest& src) = default;
+        FUnlinkIOSDeviceIDRequest& operator=(FUnlinkIOSDeviceIDRequest&& src) = default;
+
         FUnlinkIOSDeviceIDRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkIOSDeviceIDRequest()
         {
             readFromValue(obj);
@@ -13047,7 +18461,13 @@ namespace ClientModels
         ~FUnlinkIOSDeviceIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkIOSDeviceIDResult : public PlayFab::FPlayFabCppResultCommon
@@ -13060,6 +18480,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkIOSDeviceIDResult(FUnlinkIOSDeviceIDResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkIOSDeviceIDResult& operator=(const FUnlinkIOSDeviceIDResult& src) = default;
+        FUnlinkIOSDeviceIDResult& operator=(FUnlinkIOSDeviceIDResult&& src) = default;
+
         FUnlinkIOSDeviceIDResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkIOSDeviceIDResult()
         {
             readFromValue(obj);
@@ -13068,7 +18495,13 @@ namespace ClientModels
         ~FUnlinkIOSDeviceIDResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkKongregateAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13085,6 +18518,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkKongregateAccountRequest(FUnlinkKongregateAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkKongregateAccountRequest& operator=(const FUnlinkKongregateAccountRequest& src) = default;
+        FUnlinkKongregateAccountRequest& operator=(FUnlinkKongregateAccountRequest&& src) = default;
+
         FUnlinkKongregateAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkKongregateAccountRequest()
         {
             readFromValue(obj);
@@ -13093,7 +18534,13 @@ namespace ClientModels
         ~FUnlinkKongregateAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkKongregateAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -13106,6 +18553,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkKongregateAccountResult(FUnlinkKongregateAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkKongregateAccountResult& operator=(const FUnlinkKongregateAccountResult& src) = default;
+        FUnlinkKongregateAccountResult& operator=(FUnlinkKongregateAccountResult&& src) = default;
+
         FUnlinkKongregateAccountResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkKongregateAccountResult()
         {
             readFromValue(obj);
@@ -13114,7 +18568,13 @@ namespace ClientModels
         ~FUnlinkKongregateAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkNintendoServiceAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13131,6 +18591,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkNintendoServiceAccountRequest(FUnlinkNintendoServiceAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkNintendoServiceAccountRequest& operator=(const FUnlinkNintendoServiceAccountRequest& src) = default;
+        FUnlinkNintendoServiceAccountRequest& operator=(FUnlinkNintendoServiceAccountRequest&& src) = default;
+
         FUnlinkNintendoServiceAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkNintendoServiceAccountRequest()
         {
             readFromValue(obj);
@@ -13139,7 +18607,13 @@ namespace ClientModels
         ~FUnlinkNintendoServiceAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkNintendoSwitchDeviceIdRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13161,6 +18635,15 @@ namespace ClientModels
             NintendoSwitchDeviceId(src.NintendoSwitchDeviceId)
             {}
 
+        FUnlinkNintendoSwitchDeviceIdRequest(FUnlinkNintendoSwitchDeviceIdRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            NintendoSwitchDeviceId(MoveTemp(src.NintendoSwitchDeviceId))
+            {}
+
+        FUnlinkNintendoSwitchDeviceIdRequest& operator=(const FUnlinkNintendoSwitchDeviceIdRequest& src) = default;
+        FUnlinkNintendoSwitchDeviceIdRequest& operator=(FUnlinkNintendoSwitchDeviceIdRequest&& src) = default;
+
         FUnlinkNintendoSwitchDeviceIdRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkNintendoSwitchDeviceIdRequest()
         {
             readFromValue(obj);
@@ -13169,7 +18652,13 @@ namespace ClientModels
         ~FUnlinkNintendoSwitchDeviceIdRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkNintendoSwitchDeviceIdResult : public PlayFab::FPlayFabCppResultCommon
@@ -13182,6 +18671,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkNintendoSwitchDeviceIdResult(FUnlinkNintendoSwitchDeviceIdResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkNintendoSwitchDeviceIdResult& operator=(const FUnlinkNintendoSwitchDeviceIdResult& src) = default;
+        FUnlinkNintendoSwitchDeviceIdResult& operator=(FUnlinkNintendoSwitchDeviceIdResult&& src) = default;
+
         FUnlinkNintendoSwitchDeviceIdResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkNintendoSwitchDeviceIdResult()
         {
             readFromValue(obj);
@@ -13190,7 +18686,13 @@ namespace ClientModels
         ~FUnlinkNintendoSwitchDeviceIdResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkOpenIdConnectRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13212,6 +18714,15 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkOpenIdConnectRequest(FUnlinkOpenIdConnectRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ConnectionId(MoveTemp(src.ConnectionId)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkOpenIdConnectRequest& operator=(const FUnlinkOpenIdConnectRequest& src) = default;
+        FUnlinkOpenIdConnectRequest& operator=(FUnlinkOpenIdConnectRequest&& src) = default;
+
         FUnlinkOpenIdConnectRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkOpenIdConnectRequest()
         {
             readFromValue(obj);
@@ -13220,7 +18731,13 @@ namespace ClientModels
         ~FUnlinkOpenIdConnectRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkPSNAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13237,6 +18754,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkPSNAccountRequest(FUnlinkPSNAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkPSNAccountRequest& operator=(const FUnlinkPSNAccountRequest& src) = default;
+        FUnlinkPSNAccountRequest& operator=(FUnlinkPSNAccountRequest&& src) = default;
+
         FUnlinkPSNAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkPSNAccountRequest()
         {
             readFromValue(obj);
@@ -13245,7 +18770,13 @@ namespace ClientModels
         ~FUnlinkPSNAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkPSNAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -13258,6 +18789,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkPSNAccountResult(FUnlinkPSNAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkPSNAccountResult& operator=(const FUnlinkPSNAccountResult& src) = default;
+        FUnlinkPSNAccountResult& operator=(FUnlinkPSNAccountResult&& src) = default;
+
         FUnlinkPSNAccountResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkPSNAccountResult()
         {
             readFromValue(obj);
@@ -13266,7 +18804,13 @@ namespace ClientModels
         ~FUnlinkPSNAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkSteamAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13283,6 +18827,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkSteamAccountRequest(FUnlinkSteamAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkSteamAccountRequest& operator=(const FUnlinkSteamAccountRequest& src) = default;
+        FUnlinkSteamAccountRequest& operator=(FUnlinkSteamAccountRequest&& src) = default;
+
         FUnlinkSteamAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkSteamAccountRequest()
         {
             readFromValue(obj);
@@ -13291,7 +18843,13 @@ namespace ClientModels
         ~FUnlinkSteamAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkSteamAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -13304,6 +18862,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkSteamAccountResult(FUnlinkSteamAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkSteamAccountResult& operator=(const FUnlinkSteamAccountResult& src) = default;
+        FUnlinkSteamAccountResult& operator=(FUnlinkSteamAccountResult&& src) = default;
+
         FUnlinkSteamAccountResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkSteamAccountResult()
         {
             readFromValue(obj);
@@ -13312,7 +18877,13 @@ namespace ClientModels
         ~FUnlinkSteamAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkTwitchAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13337,6 +18908,15 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkTwitchAccountRequest(FUnlinkTwitchAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AccessToken(MoveTemp(src.AccessToken)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkTwitchAccountRequest& operator=(const FUnlinkTwitchAccountRequest& src) = default;
+        FUnlinkTwitchAccountRequest& operator=(FUnlinkTwitchAccountRequest&& src) = default;
+
         FUnlinkTwitchAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkTwitchAccountRequest()
         {
             readFromValue(obj);
@@ -13345,7 +18925,13 @@ namespace ClientModels
         ~FUnlinkTwitchAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkTwitchAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -13358,6 +18944,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkTwitchAccountResult(FUnlinkTwitchAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkTwitchAccountResult& operator=(const FUnlinkTwitchAccountResult& src) = default;
+        FUnlinkTwitchAccountResult& operator=(FUnlinkTwitchAccountResult&& src) = default;
+
         FUnlinkTwitchAccountResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkTwitchAccountResult()
         {
             readFromValue(obj);
@@ -13366,7 +18959,13 @@ namespace ClientModels
         ~FUnlinkTwitchAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkWindowsHelloAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13388,6 +18987,15 @@ namespace ClientModels
             PublicKeyHint(src.PublicKeyHint)
             {}
 
+        FUnlinkWindowsHelloAccountRequest(FUnlinkWindowsHelloAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PublicKeyHint(MoveTemp(src.PublicKeyHint))
+            {}
+
+        FUnlinkWindowsHelloAccountRequest& operator=(const FUnlinkWindowsHelloAccountRequest& src) = default;
+        FUnlinkWindowsHelloAccountRequest& operator=(FUnlinkWindowsHelloAccountRequest&& src) = default;
+
         FUnlinkWindowsHelloAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkWindowsHelloAccountRequest()
         {
             readFromValue(obj);
@@ -13396,7 +19004,13 @@ namespace ClientModels
         ~FUnlinkWindowsHelloAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkWindowsHelloAccountResponse : public PlayFab::FPlayFabCppResultCommon
@@ -13409,6 +19023,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkWindowsHelloAccountResponse(FUnlinkWindowsHelloAccountResponse&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkWindowsHelloAccountResponse& operator=(const FUnlinkWindowsHelloAccountResponse& src) = default;
+        FUnlinkWindowsHelloAccountResponse& operator=(FUnlinkWindowsHelloAccountResponse&& src) = default;
+
         FUnlinkWindowsHelloAccountResponse(const TSharedPtr<FJsonObject>& obj) : FUnlinkWindowsHelloAccountResponse()
         {
             readFromValue(obj);
@@ -13417,7 +19038,13 @@ namespace ClientModels
         ~FUnlinkWindowsHelloAccountResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkXboxAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13434,6 +19061,14 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlinkXboxAccountRequest(FUnlinkXboxAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlinkXboxAccountRequest& operator=(const FUnlinkXboxAccountRequest& src) = default;
+        FUnlinkXboxAccountRequest& operator=(FUnlinkXboxAccountRequest&& src) = default;
+
         FUnlinkXboxAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkXboxAccountRequest()
         {
             readFromValue(obj);
@@ -13442,7 +19077,13 @@ namespace ClientModels
         ~FUnlinkXboxAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkXboxAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -13455,6 +19096,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkXboxAccountResult(FUnlinkXboxAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkXboxAccountResult& operator=(const FUnlinkXboxAccountResult& src) = default;
+        FUnlinkXboxAccountResult& operator=(FUnlinkXboxAccountResult&& src) = default;
+
         FUnlinkXboxAccountResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkXboxAccountResult()
         {
             readFromValue(obj);
@@ -13463,7 +19111,13 @@ namespace ClientModels
         ~FUnlinkXboxAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlockContainerInstanceRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13506,6 +19160,18 @@ namespace ClientModels
             KeyItemInstanceId(src.KeyItemInstanceId)
             {}
 
+        FUnlockContainerInstanceRequest(FUnlockContainerInstanceRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            ContainerItemInstanceId(MoveTemp(src.ContainerItemInstanceId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            KeyItemInstanceId(MoveTemp(src.KeyItemInstanceId))
+            {}
+
+        FUnlockContainerInstanceRequest& operator=(const FUnlockContainerInstanceRequest& src) = default;
+        FUnlockContainerInstanceRequest& operator=(FUnlockContainerInstanceRequest&& src) = default;
+
         FUnlockContainerInstanceRequest(const TSharedPtr<FJsonObject>& obj) : FUnlockContainerInstanceRequest()
         {
             readFromValue(obj);
@@ -13514,7 +19180,13 @@ namespace ClientModels
         ~FUnlockContainerInstanceRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlockContainerItemRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13549,6 +19221,17 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUnlockContainerItemRequest(FUnlockContainerItemRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            ContainerItemId(MoveTemp(src.ContainerItemId)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUnlockContainerItemRequest& operator=(const FUnlockContainerItemRequest& src) = default;
+        FUnlockContainerItemRequest& operator=(FUnlockContainerItemRequest&& src) = default;
+
         FUnlockContainerItemRequest(const TSharedPtr<FJsonObject>& obj) : FUnlockContainerItemRequest()
         {
             readFromValue(obj);
@@ -13557,7 +19240,13 @@ namespace ClientModels
         ~FUnlockContainerItemRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlockContainerItemResult : public PlayFab::FPlayFabCppResultCommon
@@ -13588,6 +19277,17 @@ namespace ClientModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FUnlockContainerItemResult(FUnlockContainerItemResult&& src) :
+            FPlayFabCppResultCommon(),
+            GrantedItems(MoveTemp(src.GrantedItems)),
+            UnlockedItemInstanceId(MoveTemp(src.UnlockedItemInstanceId)),
+            UnlockedWithItemInstanceId(MoveTemp(src.UnlockedWithItemInstanceId)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FUnlockContainerItemResult& operator=(const FUnlockContainerItemResult& src) = default;
+        FUnlockContainerItemResult& operator=(FUnlockContainerItemResult&& src) = default;
+
         FUnlockContainerItemResult(const TSharedPtr<FJsonObject>& obj) : FUnlockContainerItemResult()
         {
             readFromValue(obj);
@@ -13596,7 +19296,13 @@ namespace ClientModels
         ~FUnlockContainerItemResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateAvatarUrlRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13614,6 +19320,14 @@ namespace ClientModels
             ImageUrl(src.ImageUrl)
             {}
 
+        FUpdateAvatarUrlRequest(FUpdateAvatarUrlRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ImageUrl(MoveTemp(src.ImageUrl))
+            {}
+
+        FUpdateAvatarUrlRequest& operator=(const FUpdateAvatarUrlRequest& src) = default;
+        FUpdateAvatarUrlRequest& operator=(FUpdateAvatarUrlRequest&& src) = default;
+
         FUpdateAvatarUrlRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateAvatarUrlRequest()
         {
             readFromValue(obj);
@@ -13622,7 +19336,13 @@ namespace ClientModels
         ~FUpdateAvatarUrlRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateCharacterDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13663,6 +19383,18 @@ namespace ClientModels
             Permission(src.Permission)
             {}
 
+        FUpdateCharacterDataRequest(FUpdateCharacterDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Data(MoveTemp(src.Data)),
+            KeysToRemove(MoveTemp(src.KeysToRemove)),
+            Permission(MoveTemp(src.Permission))
+            {}
+
+        FUpdateCharacterDataRequest& operator=(const FUpdateCharacterDataRequest& src) = default;
+        FUpdateCharacterDataRequest& operator=(FUpdateCharacterDataRequest&& src) = default;
+
         FUpdateCharacterDataRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateCharacterDataRequest()
         {
             readFromValue(obj);
@@ -13671,7 +19403,13 @@ namespace ClientModels
         ~FUpdateCharacterDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateCharacterDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -13692,6 +19430,14 @@ namespace ClientModels
             DataVersion(src.DataVersion)
             {}
 
+        FUpdateCharacterDataResult(FUpdateCharacterDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            DataVersion(MoveTemp(src.DataVersion))
+            {}
+
+        FUpdateCharacterDataResult& operator=(const FUpdateCharacterDataResult& src) = default;
+        FUpdateCharacterDataResult& operator=(FUpdateCharacterDataResult&& src) = default;
+
         FUpdateCharacterDataResult(const TSharedPtr<FJsonObject>& obj) : FUpdateCharacterDataResult()
         {
             readFromValue(obj);
@@ -13700,7 +19446,13 @@ namespace ClientModels
         ~FUpdateCharacterDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateCharacterStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13726,6 +19478,16 @@ namespace ClientModels
             CustomTags(src.CustomTags)
             {}
 
+        FUpdateCharacterStatisticsRequest(FUpdateCharacterStatisticsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CharacterStatistics(MoveTemp(src.CharacterStatistics)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUpdateCharacterStatisticsRequest& operator=(const FUpdateCharacterStatisticsRequest& src) = default;
+        FUpdateCharacterStatisticsRequest& operator=(FUpdateCharacterStatisticsRequest&& src) = default;
+
         FUpdateCharacterStatisticsRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateCharacterStatisticsRequest()
         {
             readFromValue(obj);
@@ -13734,7 +19496,13 @@ namespace ClientModels
         ~FUpdateCharacterStatisticsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateCharacterStatisticsResult : public PlayFab::FPlayFabCppResultCommon
@@ -13747,6 +19515,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUpdateCharacterStatisticsResult(FUpdateCharacterStatisticsResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUpdateCharacterStatisticsResult& operator=(const FUpdateCharacterStatisticsResult& src) = default;
+        FUpdateCharacterStatisticsResult& operator=(FUpdateCharacterStatisticsResult&& src) = default;
+
         FUpdateCharacterStatisticsResult(const TSharedPtr<FJsonObject>& obj) : FUpdateCharacterStatisticsResult()
         {
             readFromValue(obj);
@@ -13755,7 +19530,13 @@ namespace ClientModels
         ~FUpdateCharacterStatisticsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdatePlayerStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13776,6 +19557,15 @@ namespace ClientModels
             Statistics(src.Statistics)
             {}
 
+        FUpdatePlayerStatisticsRequest(FUpdatePlayerStatisticsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Statistics(MoveTemp(src.Statistics))
+            {}
+
+        FUpdatePlayerStatisticsRequest& operator=(const FUpdatePlayerStatisticsRequest& src) = default;
+        FUpdatePlayerStatisticsRequest& operator=(FUpdatePlayerStatisticsRequest&& src) = default;
+
         FUpdatePlayerStatisticsRequest(const TSharedPtr<FJsonObject>& obj) : FUpdatePlayerStatisticsRequest()
         {
             readFromValue(obj);
@@ -13784,7 +19574,13 @@ namespace ClientModels
         ~FUpdatePlayerStatisticsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdatePlayerStatisticsResult : public PlayFab::FPlayFabCppResultCommon
@@ -13797,6 +19593,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUpdatePlayerStatisticsResult(FUpdatePlayerStatisticsResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUpdatePlayerStatisticsResult& operator=(const FUpdatePlayerStatisticsResult& src) = default;
+        FUpdatePlayerStatisticsResult& operator=(FUpdatePlayerStatisticsResult&& src) = default;
+
         FUpdatePlayerStatisticsResult(const TSharedPtr<FJsonObject>& obj) : FUpdatePlayerStatisticsResult()
         {
             readFromValue(obj);
@@ -13805,7 +19608,13 @@ namespace ClientModels
         ~FUpdatePlayerStatisticsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateSharedGroupDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13846,6 +19655,18 @@ namespace ClientModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FUpdateSharedGroupDataRequest(FUpdateSharedGroupDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Data(MoveTemp(src.Data)),
+            KeysToRemove(MoveTemp(src.KeysToRemove)),
+            Permission(MoveTemp(src.Permission)),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FUpdateSharedGroupDataRequest& operator=(const FUpdateSharedGroupDataRequest& src) = default;
+        FUpdateSharedGroupDataRequest& operator=(FUpdateSharedGroupDataRequest&& src) = default;
+
         FUpdateSharedGroupDataRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateSharedGroupDataRequest()
         {
             readFromValue(obj);
@@ -13854,7 +19675,13 @@ namespace ClientModels
         ~FUpdateSharedGroupDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateSharedGroupDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -13867,6 +19694,13 @@ namespace ClientModels
             FPlayFabCppResultCommon()
             {}
 
+        FUpdateSharedGroupDataResult(FUpdateSharedGroupDataResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUpdateSharedGroupDataResult& operator=(const FUpdateSharedGroupDataResult& src) = default;
+        FUpdateSharedGroupDataResult& operator=(FUpdateSharedGroupDataResult&& src) = default;
+
         FUpdateSharedGroupDataResult(const TSharedPtr<FJsonObject>& obj) : FUpdateSharedGroupDataResult()
         {
             readFromValue(obj);
@@ -13875,7 +19709,13 @@ namespace ClientModels
         ~FUpdateSharedGroupDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateUserDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13914,6 +19754,17 @@ namespace ClientModels
             Permission(src.Permission)
             {}
 
+        FUpdateUserDataRequest(FUpdateUserDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Data(MoveTemp(src.Data)),
+            KeysToRemove(MoveTemp(src.KeysToRemove)),
+            Permission(MoveTemp(src.Permission))
+            {}
+
+        FUpdateUserDataRequest& operator=(const FUpdateUserDataRequest& src) = default;
+        FUpdateUserDataRequest& operator=(FUpdateUserDataRequest&& src) = default;
+
         FUpdateUserDataRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateUserDataRequest()
         {
             readFromValue(obj);
@@ -13922,7 +19773,13 @@ namespace ClientModels
         ~FUpdateUserDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateUserDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -13943,6 +19800,14 @@ namespace ClientModels
             DataVersion(src.DataVersion)
             {}
 
+        FUpdateUserDataResult(FUpdateUserDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            DataVersion(MoveTemp(src.DataVersion))
+            {}
+
+        FUpdateUserDataResult& operator=(const FUpdateUserDataResult& src) = default;
+        FUpdateUserDataResult& operator=(FUpdateUserDataResult&& src) = default;
+
         FUpdateUserDataResult(const TSharedPtr<FJsonObject>& obj) : FUpdateUserDataResult()
         {
             readFromValue(obj);
@@ -13951,7 +19816,13 @@ namespace ClientModels
         ~FUpdateUserDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateUserTitleDisplayNameRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -13973,6 +19844,15 @@ namespace ClientModels
             DisplayName(src.DisplayName)
             {}
 
+        FUpdateUserTitleDisplayNameRequest(FUpdateUserTitleDisplayNameRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DisplayName(MoveTemp(src.DisplayName))
+            {}
+
+        FUpdateUserTitleDisplayNameRequest& operator=(const FUpdateUserTitleDisplayNameRequest& src) = default;
+        FUpdateUserTitleDisplayNameRequest& operator=(FUpdateUserTitleDisplayNameRequest&& src) = default;
+
         FUpdateUserTitleDisplayNameRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateUserTitleDisplayNameRequest()
         {
             readFromValue(obj);
@@ -13981,7 +19861,13 @@ namespace ClientModels
         ~FUpdateUserTitleDisplayNameRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateUserTitleDisplayNameResult : public PlayFab::FPlayFabCppResultCommon
@@ -13999,6 +19885,14 @@ namespace ClientModels
             DisplayName(src.DisplayName)
             {}
 
+        FUpdateUserTitleDisplayNameResult(FUpdateUserTitleDisplayNameResult&& src) :
+            FPlayFabCppResultCommon(),
+            DisplayName(MoveTemp(src.DisplayName))
+            {}
+
+        FUpdateUserTitleDisplayNameResult& operator=(const FUpdateUserTitleDisplayNameResult& src) = default;
+        FUpdateUserTitleDisplayNameResult& operator=(FUpdateUserTitleDisplayNameResult&& src) = default;
+
         FUpdateUserTitleDisplayNameResult(const TSharedPtr<FJsonObject>& obj) : FUpdateUserTitleDisplayNameResult()
         {
             readFromValue(obj);
@@ -14007,7 +19901,13 @@ namespace ClientModels
         ~FUpdateUserTitleDisplayNameResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValidateAmazonReceiptRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -14049,6 +19949,19 @@ namespace ClientModels
             UserId(src.UserId)
             {}
 
+        FValidateAmazonReceiptRequest(FValidateAmazonReceiptRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CurrencyCode(MoveTemp(src.CurrencyCode)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PurchasePrice(MoveTemp(src.PurchasePrice)),
+            ReceiptId(MoveTemp(src.ReceiptId)),
+            UserId(MoveTemp(src.UserId))
+            {}
+
+        FValidateAmazonReceiptRequest& operator=(const FValidateAmazonReceiptRequest& src) = default;
+        FValidateAmazonReceiptRequest& operator=(FValidateAmazonReceiptRequest&& src) = default;
+
         FValidateAmazonReceiptRequest(const TSharedPtr<FJsonObject>& obj) : FValidateAmazonReceiptRequest()
         {
             readFromValue(obj);
@@ -14057,7 +19970,13 @@ namespace ClientModels
         ~FValidateAmazonReceiptRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValidateAmazonReceiptResult : public PlayFab::FPlayFabCppResultCommon
@@ -14074,6 +19993,14 @@ namespace ClientModels
             Fulfillments(src.Fulfillments)
             {}
 
+        FValidateAmazonReceiptResult(FValidateAmazonReceiptResult&& src) :
+            FPlayFabCppResultCommon(),
+            Fulfillments(MoveTemp(src.Fulfillments))
+            {}
+
+        FValidateAmazonReceiptResult& operator=(const FValidateAmazonReceiptResult& src) = default;
+        FValidateAmazonReceiptResult& operator=(FValidateAmazonReceiptResult&& src) = default;
+
         FValidateAmazonReceiptResult(const TSharedPtr<FJsonObject>& obj) : FValidateAmazonReceiptResult()
         {
             readFromValue(obj);
@@ -14082,7 +20009,13 @@ namespace ClientModels
         ~FValidateAmazonReceiptResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValidateGooglePlayPurchaseRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -14124,6 +20057,19 @@ namespace ClientModels
             Signature(src.Signature)
             {}
 
+        FValidateGooglePlayPurchaseRequest(FValidateGooglePlayPurchaseRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CurrencyCode(MoveTemp(src.CurrencyCode)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PurchasePrice(MoveTemp(src.PurchasePrice)),
+            ReceiptJson(MoveTemp(src.ReceiptJson)),
+            Signature(MoveTemp(src.Signature))
+            {}
+
+        FValidateGooglePlayPurchaseRequest& operator=(const FValidateGooglePlayPurchaseRequest& src) = default;
+        FValidateGooglePlayPurchaseRequest& operator=(FValidateGooglePlayPurchaseRequest&& src) = default;
+
         FValidateGooglePlayPurchaseRequest(const TSharedPtr<FJsonObject>& obj) : FValidateGooglePlayPurchaseRequest()
         {
             readFromValue(obj);
@@ -14132,7 +20078,13 @@ namespace ClientModels
         ~FValidateGooglePlayPurchaseRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValidateGooglePlayPurchaseResult : public PlayFab::FPlayFabCppResultCommon
@@ -14149,6 +20101,14 @@ namespace ClientModels
             Fulfillments(src.Fulfillments)
             {}
 
+        FValidateGooglePlayPurchaseResult(FValidateGooglePlayPurchaseResult&& src) :
+            FPlayFabCppResultCommon(),
+            Fulfillments(MoveTemp(src.Fulfillments))
+            {}
+
+        FValidateGooglePlayPurchaseResult& operator=(const FValidateGooglePlayPurchaseResult& src) = default;
+        FValidateGooglePlayPurchaseResult& operator=(FValidateGooglePlayPurchaseResult&& src) = default;
+
         FValidateGooglePlayPurchaseResult(const TSharedPtr<FJsonObject>& obj) : FValidateGooglePlayPurchaseResult()
         {
             readFromValue(obj);
@@ -14157,7 +20117,13 @@ namespace ClientModels
         ~FValidateGooglePlayPurchaseResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValidateIOSReceiptRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -14194,6 +20160,18 @@ namespace ClientModels
             ReceiptData(src.ReceiptData)
             {}
 
+        FValidateIOSReceiptRequest(FValidateIOSReceiptRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CurrencyCode(MoveTemp(src.CurrencyCode)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PurchasePrice(MoveTemp(src.PurchasePrice)),
+            ReceiptData(MoveTemp(src.ReceiptData))
+            {}
+
+        FValidateIOSReceiptRequest& operator=(const FValidateIOSReceiptRequest& src) = default;
+        FValidateIOSReceiptRequest& operator=(FValidateIOSReceiptRequest&& src) = default;
+
         FValidateIOSReceiptRequest(const TSharedPtr<FJsonObject>& obj) : FValidateIOSReceiptRequest()
         {
             readFromValue(obj);
@@ -14202,7 +20180,13 @@ namespace ClientModels
         ~FValidateIOSReceiptRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValidateIOSReceiptResult : public PlayFab::FPlayFabCppResultCommon
@@ -14219,6 +20203,14 @@ namespace ClientModels
             Fulfillments(src.Fulfillments)
             {}
 
+        FValidateIOSReceiptResult(FValidateIOSReceiptResult&& src) :
+            FPlayFabCppResultCommon(),
+            Fulfillments(MoveTemp(src.Fulfillments))
+            {}
+
+        FValidateIOSReceiptResult& operator=(const FValidateIOSReceiptResult& src) = default;
+        FValidateIOSReceiptResult& operator=(FValidateIOSReceiptResult&& src) = default;
+
         FValidateIOSReceiptResult(const TSharedPtr<FJsonObject>& obj) : FValidateIOSReceiptResult()
         {
             readFromValue(obj);
@@ -14227,7 +20219,13 @@ namespace ClientModels
         ~FValidateIOSReceiptResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValidateWindowsReceiptRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -14264,6 +20262,18 @@ namespace ClientModels
             Receipt(src.Receipt)
             {}
 
+        FValidateWindowsReceiptRequest(FValidateWindowsReceiptRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CurrencyCode(MoveTemp(src.CurrencyCode)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PurchasePrice(MoveTemp(src.PurchasePrice)),
+            Receipt(MoveTemp(src.Receipt))
+            {}
+
+        FValidateWindowsReceiptRequest& operator=(const FValidateWindowsReceiptRequest& src) = default;
+        FValidateWindowsReceiptRequest& operator=(FValidateWindowsReceiptRequest&& src) = default;
+
         FValidateWindowsReceiptRequest(const TSharedPtr<FJsonObject>& obj) : FValidateWindowsReceiptRequest()
         {
             readFromValue(obj);
@@ -14272,7 +20282,13 @@ namespace ClientModels
         ~FValidateWindowsReceiptRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValidateWindowsReceiptResult : public PlayFab::FPlayFabCppResultCommon
@@ -14289,6 +20305,14 @@ namespace ClientModels
             Fulfillments(src.Fulfillments)
             {}
 
+        FValidateWindowsReceiptResult(FValidateWindowsReceiptResult&& src) :
+            FPlayFabCppResultCommon(),
+            Fulfillments(MoveTemp(src.Fulfillments))
+            {}
+
+        FValidateWindowsReceiptResult& operator=(const FValidateWindowsReceiptResult& src) = default;
+        FValidateWindowsReceiptResult& operator=(FValidateWindowsReceiptResult&& src) = default;
+
         FValidateWindowsReceiptResult(const TSharedPtr<FJsonObject>& obj) : FValidateWindowsReceiptResult()
         {
             readFromValue(obj);
@@ -14297,7 +20321,13 @@ namespace ClientModels
         ~FValidateWindowsReceiptResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FWriteClientCharacterEventRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -14336,6 +20366,18 @@ namespace ClientModels
             Timestamp(src.Timestamp)
             {}
 
+        FWriteClientCharacterEventRequest(FWriteClientCharacterEventRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Body(MoveTemp(src.Body)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EventName(MoveTemp(src.EventName)),
+            Timestamp(MoveTemp(src.Timestamp))
+            {}
+
+        FWriteClientCharacterEventRequest& operator=(const FWriteClientCharacterEventRequest& src) = default;
+        FWriteClientCharacterEventRequest& operator=(FWriteClientCharacterEventRequest&& src) = default;
+
         FWriteClientCharacterEventRequest(const TSharedPtr<FJsonObject>& obj) : FWriteClientCharacterEventRequest()
         {
             readFromValue(obj);
@@ -14344,7 +20386,13 @@ namespace ClientModels
         ~FWriteClientCharacterEventRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FWriteClientPlayerEventRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -14378,6 +20426,17 @@ namespace ClientModels
             Timestamp(src.Timestamp)
             {}
 
+        FWriteClientPlayerEventRequest(FWriteClientPlayerEventRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Body(MoveTemp(src.Body)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EventName(MoveTemp(src.EventName)),
+            Timestamp(MoveTemp(src.Timestamp))
+            {}
+
+        FWriteClientPlayerEventRequest& operator=(const FWriteClientPlayerEventRequest& src) = default;
+        FWriteClientPlayerEventRequest& operator=(FWriteClientPlayerEventRequest&& src) = default;
+
         FWriteClientPlayerEventRequest(const TSharedPtr<FJsonObject>& obj) : FWriteClientPlayerEventRequest()
         {
             readFromValue(obj);
@@ -14386,7 +20445,13 @@ namespace ClientModels
         ~FWriteClientPlayerEventRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FWriteEventResponse : public PlayFab::FPlayFabCppResultCommon
@@ -14407,6 +20472,14 @@ namespace ClientModels
             EventId(src.EventId)
             {}
 
+        FWriteEventResponse(FWriteEventResponse&& src) :
+            FPlayFabCppResultCommon(),
+            EventId(MoveTemp(src.EventId))
+            {}
+
+        FWriteEventResponse& operator=(const FWriteEventResponse& src) = default;
+        FWriteEventResponse& operator=(FWriteEventResponse&& src) = default;
+
         FWriteEventResponse(const TSharedPtr<FJsonObject>& obj) : FWriteEventResponse()
         {
             readFromValue(obj);
@@ -14415,7 +20488,13 @@ namespace ClientModels
         ~FWriteEventResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FWriteTitleEventRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -14449,6 +20528,17 @@ namespace ClientModels
             Timestamp(src.Timestamp)
             {}
 
+        FWriteTitleEventRequest(FWriteTitleEventRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Body(MoveTemp(src.Body)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EventName(MoveTemp(src.EventName)),
+            Timestamp(MoveTemp(src.Timestamp))
+            {}
+
+        FWriteTitleEventRequest& operator=(const FWriteTitleEventRequest& src) = default;
+        FWriteTitleEventRequest& operator=(FWriteTitleEventRequest&& src) = default;
+
         FWriteTitleEventRequest(const TSharedPtr<FJsonObject>& obj) : FWriteTitleEventRequest()
         {
             readFromValue(obj);
@@ -14457,7 +20547,13 @@ namespace ClientModels
         ~FWriteTitleEventRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
 }
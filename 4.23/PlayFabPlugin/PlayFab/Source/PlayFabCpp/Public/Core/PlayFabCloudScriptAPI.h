@@ -8,6 +8,8 @@
 
 #include "CoreMinimal.h"
 #include "Core/PlayFabError.h"
+#include "Core/PlayFabFuture.h"
+#include "Core/PlayFabRequestHandle.h"
 #include "Core/PlayFabCloudScriptDataModels.h"
 #include "Core/PlayFabSettings.h"
 #include "Interfaces/IHttpRequest.h"
@@ -43,39 +45,53 @@ namespace PlayFab
          * custom server-side functionality you can implement, and it can be used in conjunction with virtually anything.
          * Executes CloudScript with the entity profile that is defined in the request.
          */
-        bool ExecuteEntityCloudScript(CloudScriptModels::FExecuteEntityCloudScriptRequest& request, const FExecuteEntityCloudScriptDelegate& SuccessDelegate = FExecuteEntityCloudScriptDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool ExecuteEntityCloudScript(CloudScriptModels::FExecuteEntityCloudScriptRequest& request, const FExecuteEntityCloudScriptDelegate& SuccessDelegate = FExecuteEntityCloudScriptDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         /**
          * Cloud Script is one of PlayFab's most versatile features. It allows client code to request execution of any kind of
          * custom server-side functionality you can implement, and it can be used in conjunction with virtually anything.
          * Executes an Azure Function with the profile of the entity that is defined in the request.
          */
-        bool ExecuteFunction(CloudScriptModels::FExecuteFunctionRequest& request, const FExecuteFunctionDelegate& SuccessDelegate = FExecuteFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool ExecuteFunction(CloudScriptModels::FExecuteFunctionRequest& request, const FExecuteFunctionDelegate& SuccessDelegate = FExecuteFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Lists all currently registered Azure Functions for a given title.
-        bool ListFunctions(CloudScriptModels::FListFunctionsRequest& request, const FListFunctionsDelegate& SuccessDelegate = FListFunctionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool ListFunctions(CloudScriptModels::FListFunctionsRequest& request, const FListFunctionsDelegate& SuccessDelegate = FListFunctionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         /**
          * Lists all currently registered HTTP triggered Azure Functions for a given title.
          * A title can have many functions, ListHttpFunctions will return a list of all the currently registered HTTP triggered functions for a given title.
          */
-        bool ListHttpFunctions(CloudScriptModels::FListFunctionsRequest& request, const FListHttpFunctionsDelegate& SuccessDelegate = FListHttpFunctionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool ListHttpFunctions(CloudScriptModels::FListFunctionsRequest& request, const FListHttpFunctionsDelegate& SuccessDelegate = FListHttpFunctionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Lists all currently registered Queue triggered Azure Functions for a given title.
-        bool ListQueuedFunctions(CloudScriptModels::FListFunctionsRequest& request, const FListQueuedFunctionsDelegate& SuccessDelegate = FListQueuedFunctionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool ListQueuedFunctions(CloudScriptModels::FListFunctionsRequest& request, const FListQueuedFunctionsDelegate& SuccessDelegate = FListQueuedFunctionsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Generate an entity PlayStream event for the provided function result.
-        bool PostFunctionResultForEntityTriggeredAction(CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequest& request, const FPostFunctionResultForEntityTriggeredActionDelegate& SuccessDelegate = FPostFunctionResultForEntityTriggeredActionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool PostFunctionResultForEntityTriggeredAction(CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequest& request, const FPostFunctionResultForEntityTriggeredActionDelegate& SuccessDelegate = FPostFunctionResultForEntityTriggeredActionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Generate an entity PlayStream event for the provided function result.
-        bool PostFunctionResultForFunctionExecution(CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest& request, const FPostFunctionResultForFunctionExecutionDelegate& SuccessDelegate = FPostFunctionResultForFunctionExecutionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool PostFunctionResultForFunctionExecution(CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest& request, const FPostFunctionResultForFunctionExecutionDelegate& SuccessDelegate = FPostFunctionResultForFunctionExecutionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Generate a player PlayStream event for the provided function result.
-        bool PostFunctionResultForPlayerTriggeredAction(CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequest& request, const FPostFunctionResultForPlayerTriggeredActionDelegate& SuccessDelegate = FPostFunctionResultForPlayerTriggeredActionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool PostFunctionResultForPlayerTriggeredAction(CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequest& request, const FPostFunctionResultForPlayerTriggeredActionDelegate& SuccessDelegate = FPostFunctionResultForPlayerTriggeredActionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Generate a PlayStream event for the provided function result.
-        bool PostFunctionResultForScheduledTask(CloudScriptModels::FPostFunctionResultForScheduledTaskRequest& request, const FPostFunctionResultForScheduledTaskDelegate& SuccessDelegate = FPostFunctionResultForScheduledTaskDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool PostFunctionResultForScheduledTask(CloudScriptModels::FPostFunctionResultForScheduledTaskRequest& request, const FPostFunctionResultForScheduledTaskDelegate& SuccessDelegate = FPostFunctionResultForScheduledTaskDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Registers an HTTP triggered Azure function with a title.
-        bool RegisterHttpFunction(CloudScriptModels::FRegisterHttpFunctionRequest& request, const FRegisterHttpFunctionDelegate& SuccessDelegate = FRegisterHttpFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool RegisterHttpFunction(CloudScriptModels::FRegisterHttpFunctionRequest& request, const FRegisterHttpFunctionDelegate& SuccessDelegate = FRegisterHttpFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         /**
          * Registers a queue triggered Azure Function with a title.
          * A title can have many functions, RegisterQueuedFunction associates a function name with a queue name and connection string.
          */
-        bool RegisterQueuedFunction(CloudScriptModels::FRegisterQueuedFunctionRequest& request, const FRegisterQueuedFunctionDelegate& SuccessDelegate = FRegisterQueuedFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool RegisterQueuedFunction(CloudScriptModels::FRegisterQueuedFunctionRequest& request, const FRegisterQueuedFunctionDelegate& SuccessDelegate = FRegisterQueuedFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Unregisters an Azure Function with a title.
-        bool UnregisterFunction(CloudScriptModels::FUnregisterFunctionRequest& request, const FUnregisterFunctionDelegate& SuccessDelegate = FUnregisterFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool UnregisterFunction(CloudScriptModels::FUnregisterFunctionRequest& request, const FUnregisterFunctionDelegate& SuccessDelegate = FUnregisterFunctionDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+
+        // ------------ Generated async API calls, resolving a future instead of running delegates
+        TFuture<TPlayFabResult<CloudScriptModels::FExecuteCloudScriptResult>> ExecuteEntityCloudScriptAsync(CloudScriptModels::FExecuteEntityCloudScriptRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<CloudScriptModels::FExecuteFunctionResult>> ExecuteFunctionAsync(CloudScriptModels::FExecuteFunctionRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<CloudScriptModels::FListFunctionsResult>> ListFunctionsAsync(CloudScriptModels::FListFunctionsRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<CloudScriptModels::FListHttpFunctionsResult>> ListHttpFunctionsAsync(CloudScriptModels::FListFunctionsRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<CloudScriptModels::FListQueuedFunctionsResult>> ListQueuedFunctionsAsync(CloudScriptModels::FListFunctionsRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<CloudScriptModels::FEmptyResult>> PostFunctionResultForEntityTriggeredActionAsync(CloudScriptModels::FPostFunctionResultForEntityTriggeredActionRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<CloudScriptModels::FEmptyResult>> PostFunctionResultForFunctionExecutionAsync(CloudScriptModels::FPostFunctionResultForFunctionExecutionRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<CloudScriptModels::FEmptyResult>> PostFunctionResultForPlayerTriggeredActionAsync(CloudScriptModels::FPostFunctionResultForPlayerTriggeredActionRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<CloudScriptModels::FEmptyResult>> PostFunctionResultForScheduledTaskAsync(CloudScriptModels::FPostFunctionResultForScheduledTaskRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<CloudScriptModels::FEmptyResult>> RegisterHttpFunctionAsync(CloudScriptModels::FRegisterHttpFunctionRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<CloudScriptModels::FEmptyResult>> RegisterQueuedFunctionAsync(CloudScriptModels::FRegisterQueuedFunctionRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<CloudScriptModels::FEmptyResult>> UnregisterFunctionAsync(CloudScriptModels::FUnregisterFunctionRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
 
     private:
         // ------------ Generated result handlers
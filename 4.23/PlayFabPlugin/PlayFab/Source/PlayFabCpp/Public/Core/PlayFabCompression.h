@@ -0,0 +1,47 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Http.h"
+
+namespace PlayFab
+{
+    /** Size of the call bodies sent and received since startup, before and after compression */
+    struct FPlayFabCompressionStats
+    {
+        int64 RequestBytesUncompressed = 0;
+        int64 RequestBytesSent = 0;
+        int64 ResponseBytesReceived = 0;
+        int64 ResponseBytesUncompressed = 0;
+
+        // Uncompressed size over size on the wire; 1 means nothing was saved
+        float GetRequestRatio() const { return RequestBytesSent > 0 ? (float)RequestBytesUncompressed / RequestBytesSent : 1.0f; }
+        float GetResponseRatio() const { return ResponseBytesReceived > 0 ? (float)ResponseBytesUncompressed / ResponseBytesReceived : 1.0f; }
+    };
+
+    /**
+     * Gzip compression of call bodies, enabled by UPlayFabRuntimeSettings::bCompressApiData.
+     * Request bodies above the configured threshold are compressed; responses are decompressed when the transport hasn't done so already.
+     */
+    class PLAYFABCPP_API FPlayFabCompression
+    {
+    public:
+        static bool IsEnabled();
+
+        // Sets the body of the request, compressed if it is large enough
+        static void SetRequestBody(const TSharedRef<IHttpRequest>& HttpRequest, const TArray<uint8>& Body);
+        // Returns the uncompressed body of the response; Scratch holds it if it had to be decompressed
+        // A gzip body that is malformed, or would decompress beyond UPlayFabRuntimeSettings::MaxDecompressedResponseBytes, comes back empty
+        static const TArray<uint8>& GetResponseBody(const FHttpResponsePtr& HttpResponse, TArray<uint8>& Scratch);
+        // Same, for a body copied out of its response along with its Content-Encoding header
+        static const TArray<uint8>& GetResponseBody(const TArray<uint8>& Body, const FString& ContentEncoding, TArray<uint8>& Scratch);
+        // Adds a decoded response to the stats; called once per response, however many times its body is read
+        static void CountResponse(int32 ReceivedSize, int32 UncompressedSize);
+
+        static FPlayFabCompressionStats GetStats();
+    };
+}
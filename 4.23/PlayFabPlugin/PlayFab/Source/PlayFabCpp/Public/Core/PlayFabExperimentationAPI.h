@@ -8,6 +8,8 @@
 
 #include "CoreMinimal.h"
 #include "Core/PlayFabError.h"
+#include "Core/PlayFabFuture.h"
+#include "Core/PlayFabRequestHandle.h"
 #include "Core/PlayFabExperimentationDataModels.h"
 #include "Core/PlayFabSettings.h"
 #include "Interfaces/IHttpRequest.h"
@@ -40,31 +42,46 @@ namespace PlayFab
 
         // ------------ Generated API calls
         // Creates a new experiment exclusion group for a title.
-        bool CreateExclusionGroup(ExperimentationModels::FCreateExclusionGroupRequest& request, const FCreateExclusionGroupDelegate& SuccessDelegate = FCreateExclusionGroupDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool CreateExclusionGroup(ExperimentationModels::FCreateExclusionGroupRequest& request, const FCreateExclusionGroupDelegate& SuccessDelegate = FCreateExclusionGroupDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Creates a new experiment for a title.
-        bool CreateExperiment(ExperimentationModels::FCreateExperimentRequest& request, const FCreateExperimentDelegate& SuccessDelegate = FCreateExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool CreateExperiment(ExperimentationModels::FCreateExperimentRequest& request, const FCreateExperimentDelegate& SuccessDelegate = FCreateExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Deletes an existing exclusion group for a title.
-        bool DeleteExclusionGroup(ExperimentationModels::FDeleteExclusionGroupRequest& request, const FDeleteExclusionGroupDelegate& SuccessDelegate = FDeleteExclusionGroupDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool DeleteExclusionGroup(ExperimentationModels::FDeleteExclusionGroupRequest& request, const FDeleteExclusionGroupDelegate& SuccessDelegate = FDeleteExclusionGroupDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Deletes an existing experiment for a title.
-        bool DeleteExperiment(ExperimentationModels::FDeleteExperimentRequest& request, const FDeleteExperimentDelegate& SuccessDelegate = FDeleteExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool DeleteExperiment(ExperimentationModels::FDeleteExperimentRequest& request, const FDeleteExperimentDelegate& SuccessDelegate = FDeleteExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Gets the details of all exclusion groups for a title.
-        bool GetExclusionGroups(ExperimentationModels::FGetExclusionGroupsRequest& request, const FGetExclusionGroupsDelegate& SuccessDelegate = FGetExclusionGroupsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool GetExclusionGroups(ExperimentationModels::FGetExclusionGroupsRequest& request, const FGetExclusionGroupsDelegate& SuccessDelegate = FGetExclusionGroupsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Gets the details of all exclusion groups for a title.
-        bool GetExclusionGroupTraffic(ExperimentationModels::FGetExclusionGroupTrafficRequest& request, const FGetExclusionGroupTrafficDelegate& SuccessDelegate = FGetExclusionGroupTrafficDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool GetExclusionGroupTraffic(ExperimentationModels::FGetExclusionGroupTrafficRequest& request, const FGetExclusionGroupTrafficDelegate& SuccessDelegate = FGetExclusionGroupTrafficDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Gets the details of all experiments for a title.
-        bool GetExperiments(ExperimentationModels::FGetExperimentsRequest& request, const FGetExperimentsDelegate& SuccessDelegate = FGetExperimentsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool GetExperiments(ExperimentationModels::FGetExperimentsRequest& request, const FGetExperimentsDelegate& SuccessDelegate = FGetExperimentsDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Gets the latest scorecard of the experiment for the title.
-        bool GetLatestScorecard(ExperimentationModels::FGetLatestScorecardRequest& request, const FGetLatestScorecardDelegate& SuccessDelegate = FGetLatestScorecardDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool GetLatestScorecard(ExperimentationModels::FGetLatestScorecardRequest& request, const FGetLatestScorecardDelegate& SuccessDelegate = FGetLatestScorecardDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Gets the treatment assignments for a player for every running experiment in the title.
-        bool GetTreatmentAssignment(ExperimentationModels::FGetTreatmentAssignmentRequest& request, const FGetTreatmentAssignmentDelegate& SuccessDelegate = FGetTreatmentAssignmentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool GetTreatmentAssignment(ExperimentationModels::FGetTreatmentAssignmentRequest& request, const FGetTreatmentAssignmentDelegate& SuccessDelegate = FGetTreatmentAssignmentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Starts an existing experiment for a title.
-        bool StartExperiment(ExperimentationModels::FStartExperimentRequest& request, const FStartExperimentDelegate& SuccessDelegate = FStartExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool StartExperiment(ExperimentationModels::FStartExperimentRequest& request, const FStartExperimentDelegate& SuccessDelegate = FStartExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Stops an existing experiment for a title.
-        bool StopExperiment(ExperimentationModels::FStopExperimentRequest& request, const FStopExperimentDelegate& SuccessDelegate = FStopExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool StopExperiment(ExperimentationModels::FStopExperimentRequest& request, const FStopExperimentDelegate& SuccessDelegate = FStopExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Updates an existing exclusion group for a title.
-        bool UpdateExclusionGroup(ExperimentationModels::FUpdateExclusionGroupRequest& request, const FUpdateExclusionGroupDelegate& SuccessDelegate = FUpdateExclusionGroupDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool UpdateExclusionGroup(ExperimentationModels::FUpdateExclusionGroupRequest& request, const FUpdateExclusionGroupDelegate& SuccessDelegate = FUpdateExclusionGroupDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Updates an existing experiment for a title.
-        bool UpdateExperiment(ExperimentationModels::FUpdateExperimentRequest& request, const FUpdateExperimentDelegate& SuccessDelegate = FUpdateExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool UpdateExperiment(ExperimentationModels::FUpdateExperimentRequest& request, const FUpdateExperimentDelegate& SuccessDelegate = FUpdateExperimentDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+
+        // ------------ Generated async API calls, resolving a future instead of running delegates
+        TFuture<TPlayFabResult<ExperimentationModels::FCreateExclusionGroupResult>> CreateExclusionGroupAsync(ExperimentationModels::FCreateExclusionGroupRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<ExperimentationModels::FCreateExperimentResult>> CreateExperimentAsync(ExperimentationModels::FCreateExperimentRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<ExperimentationModels::FEmptyResponse>> DeleteExclusionGroupAsync(ExperimentationModels::FDeleteExclusionGroupRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<ExperimentationModels::FEmptyResponse>> DeleteExperimentAsync(ExperimentationModels::FDeleteExperimentRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<ExperimentationModels::FGetExclusionGroupsResult>> GetExclusionGroupsAsync(ExperimentationModels::FGetExclusionGroupsRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<ExperimentationModels::FGetExclusionGroupTrafficResult>> GetExclusionGroupTrafficAsync(ExperimentationModels::FGetExclusionGroupTrafficRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<ExperimentationModels::FGetExperimentsResult>> GetExperimentsAsync(ExperimentationModels::FGetExperimentsRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<ExperimentationModels::FGetLatestScorecardResult>> GetLatestScorecardAsync(ExperimentationModels::FGetLatestScorecardRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<ExperimentationModels::FGetTreatmentAssignmentResult>> GetTreatmentAssignmentAsync(ExperimentationModels::FGetTreatmentAssignmentRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<ExperimentationModels::FEmptyResponse>> StartExperimentAsync(ExperimentationModels::FStartExperimentRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<ExperimentationModels::FEmptyResponse>> StopExperimentAsync(ExperimentationModels::FStopExperimentRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<ExperimentationModels::FEmptyResponse>> UpdateExclusionGroupAsync(ExperimentationModels::FUpdateExclusionGroupRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<ExperimentationModels::FEmptyResponse>> UpdateExperimentAsync(ExperimentationModels::FUpdateExperimentRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
 
     private:
         // ------------ Generated result handlers
@@ -28,6 +28,14 @@ namespace InsightsModels
             CustomTags(src.CustomTags)
             {}
 
+        FInsightsEmptyRequest(FInsightsEmptyRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FInsightsEmptyRequest& operator=(const FInsightsEmptyRequest& src) = default;
+        FInsightsEmptyRequest& operator=(FInsightsEmptyRequest&& src) = default;
+
         FInsightsEmptyRequest(const TSharedPtr<FJsonObject>& obj) : FInsightsEmptyRequest()
         {
             readFromValue(obj);
@@ -36,7 +44,13 @@ namespace InsightsModels
         ~FInsightsEmptyRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FInsightsPerformanceLevel : public PlayFab::FPlayFabCppBaseModel
@@ -89,6 +103,21 @@ namespace InsightsModels
             VirtualCpuCores(src.VirtualCpuCores)
             {}
 
+        FInsightsPerformanceLevel(FInsightsPerformanceLevel&& src) :
+            FPlayFabCppBaseModel(),
+            ActiveEventExports(MoveTemp(src.ActiveEventExports)),
+            CacheSizeMB(MoveTemp(src.CacheSizeMB)),
+            Concurrency(MoveTemp(src.Concurrency)),
+            CreditsPerMinute(MoveTemp(src.CreditsPerMinute)),
+            EventsPerSecond(MoveTemp(src.EventsPerSecond)),
+            Level(MoveTemp(src.Level)),
+            MaxMemoryPerQueryMB(MoveTemp(src.MaxMemoryPerQueryMB)),
+            VirtualCpuCores(MoveTemp(src.VirtualCpuCores))
+            {}
+
+        FInsightsPerformanceLevel& operator=(const FInsightsPerformanceLevel& src) = default;
+        FInsightsPerformanceLevel& operator=(FInsightsPerformanceLevel&& src) = default;
+
         FInsightsPerformanceLevel(const TSharedPtr<FJsonObject>& obj) : FInsightsPerformanceLevel()
         {
             readFromValue(obj);
@@ -97,7 +126,13 @@ namespace InsightsModels
         ~FInsightsPerformanceLevel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FInsightsGetLimitsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -134,6 +169,18 @@ namespace InsightsModels
             SubMeters(src.SubMeters)
             {}
 
+        FInsightsGetLimitsResponse(FInsightsGetLimitsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            DefaultPerformanceLevel(MoveTemp(src.DefaultPerformanceLevel)),
+            DefaultStorageRetentionDays(MoveTemp(src.DefaultStorageRetentionDays)),
+            StorageMaxRetentionDays(MoveTemp(src.StorageMaxRetentionDays)),
+            StorageMinRetentionDays(MoveTemp(src.StorageMinRetentionDays)),
+            SubMeters(MoveTemp(src.SubMeters))
+            {}
+
+        FInsightsGetLimitsResponse& operator=(const FInsightsGetLimitsResponse& src) = default;
+        FInsightsGetLimitsResponse& operator=(FInsightsGetLimitsResponse&& src) = default;
+
         FInsightsGetLimitsResponse(const TSharedPtr<FJsonObject>& obj) : FInsightsGetLimitsResponse()
         {
             readFromValue(obj);
@@ -142,7 +189,13 @@ namespace InsightsModels
         ~FInsightsGetLimitsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FInsightsGetOperationStatusResponse : public PlayFab::FPlayFabCppResultCommon
@@ -195,6 +248,21 @@ namespace InsightsModels
             Status(src.Status)
             {}
 
+        FInsightsGetOperationStatusResponse(FInsightsGetOperationStatusResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Message(MoveTemp(src.Message)),
+            OperationCompletedTime(MoveTemp(src.OperationCompletedTime)),
+            OperationId(MoveTemp(src.OperationId)),
+            OperationLastUpdated(MoveTemp(src.OperationLastUpdated)),
+            OperationStartedTime(MoveTemp(src.OperationStartedTime)),
+            OperationType(MoveTemp(src.OperationType)),
+            OperationValue(MoveTemp(src.OperationValue)),
+            Status(MoveTemp(src.Status))
+            {}
+
+        FInsightsGetOperationStatusResponse& operator=(const FInsightsGetOperationStatusResponse& src) = default;
+        FInsightsGetOperationStatusResponse& operator=(FInsightsGetOperationStatusResponse&& src) = default;
+
         FInsightsGetOperationStatusResponse(const TSharedPtr<FJsonObject>& obj) : FInsightsGetOperationStatusResponse()
         {
             readFromValue(obj);
@@ -203,7 +271,13 @@ namespace InsightsModels
         ~FInsightsGetOperationStatusResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FInsightsGetDetailsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -239,12 +313,25 @@ namespace InsightsModels
             FPlayFabCppResultCommon(),
             DataUsageMb(src.DataUsageMb),
             ErrorMessage(src.ErrorMessage),
-            Limits(src.Limits.IsValid() ? MakeShareable(new FInsightsGetLimitsResponse(*src.Limits)) : nullptr),
+            Limits(src.Limits.IsValid() ? TSharedPtr<FInsightsGetLimitsResponse>(MakeShared<FInsightsGetLimitsResponse>(*src.Limits)) : nullptr),
             PendingOperations(src.PendingOperations),
             PerformanceLevel(src.PerformanceLevel),
             RetentionDays(src.RetentionDays)
             {}
 
+        FInsightsGetDetailsResponse(FInsightsGetDetailsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            DataUsageMb(MoveTemp(src.DataUsageMb)),
+            ErrorMessage(MoveTemp(src.ErrorMessage)),
+            Limits(MoveTemp(src.Limits)),
+            PendingOperations(MoveTemp(src.PendingOperations)),
+            PerformanceLevel(MoveTemp(src.PerformanceLevel)),
+            RetentionDays(MoveTemp(src.RetentionDays))
+            {}
+
+        FInsightsGetDetailsResponse& operator=(const FInsightsGetDetailsResponse& src) = default;
+        FInsightsGetDetailsResponse& operator=(FInsightsGetDetailsResponse&& src) = default;
+
         FInsightsGetDetailsResponse(const TSharedPtr<FJsonObject>& obj) : FInsightsGetDetailsResponse()
         {
             readFromValue(obj);
@@ -253,7 +340,13 @@ namespace InsightsModels
         ~FInsightsGetDetailsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FInsightsGetOperationStatusRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -275,6 +368,15 @@ namespace InsightsModels
             OperationId(src.OperationId)
             {}
 
+        FInsightsGetOperationStatusRequest(FInsightsGetOperationStatusRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            OperationId(MoveTemp(src.OperationId))
+            {}
+
+        FInsightsGetOperationStatusRequest& operator=(const FInsightsGetOperationStatusRequest& src) = default;
+        FInsightsGetOperationStatusRequest& operator=(FInsightsGetOperationStatusRequest&& src) = default;
+
         FInsightsGetOperationStatusRequest(const TSharedPtr<FJsonObject>& obj) : FInsightsGetOperationStatusRequest()
         {
             readFromValue(obj);
@@ -283,7 +385,13 @@ namespace InsightsModels
         ~FInsightsGetOperationStatusRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FInsightsGetPendingOperationsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -305,6 +413,15 @@ namespace InsightsModels
             OperationType(src.OperationType)
             {}
 
+        FInsightsGetPendingOperationsRequest(FInsightsGetPendingOperationsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            OperationType(MoveTemp(src.OperationType))
+            {}
+
+        FInsightsGetPendingOperationsRequest& operator=(const FInsightsGetPendingOperationsRequest& src) = default;
+        FInsightsGetPendingOperationsRequest& operator=(FInsightsGetPendingOperationsRequest&& src) = default;
+
         FInsightsGetPendingOperationsRequest(const TSharedPtr<FJsonObject>& obj) : FInsightsGetPendingOperationsRequest()
         {
             readFromValue(obj);
@@ -313,7 +430,13 @@ namespace InsightsModels
         ~FInsightsGetPendingOperationsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FInsightsGetPendingOperationsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -330,6 +453,14 @@ namespace InsightsModels
             PendingOperations(src.PendingOperations)
             {}
 
+        FInsightsGetPendingOperationsResponse(FInsightsGetPendingOperationsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            PendingOperations(MoveTemp(src.PendingOperations))
+            {}
+
+        FInsightsGetPendingOperationsResponse& operator=(const FInsightsGetPendingOperationsResponse& src) = default;
+        FInsightsGetPendingOperationsResponse& operator=(FInsightsGetPendingOperationsResponse&& src) = default;
+
         FInsightsGetPendingOperationsResponse(const TSharedPtr<FJsonObject>& obj) : FInsightsGetPendingOperationsResponse()
         {
             readFromValue(obj);
@@ -338,7 +469,13 @@ namespace InsightsModels
         ~FInsightsGetPendingOperationsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FInsightsOperationResponse : public PlayFab::FPlayFabCppResultCommon
@@ -366,6 +503,16 @@ namespace InsightsModels
             OperationType(src.OperationType)
             {}
 
+        FInsightsOperationResponse(FInsightsOperationResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Message(MoveTemp(src.Message)),
+            OperationId(MoveTemp(src.OperationId)),
+            OperationType(MoveTemp(src.OperationType))
+            {}
+
+        FInsightsOperationResponse& operator=(const FInsightsOperationResponse& src) = default;
+        FInsightsOperationResponse& operator=(FInsightsOperationResponse&& src) = default;
+
         FInsightsOperationResponse(const TSharedPtr<FJsonObject>& obj) : FInsightsOperationResponse()
         {
             readFromValue(obj);
@@ -374,7 +521,13 @@ namespace InsightsModels
         ~FInsightsOperationResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FInsightsSetPerformanceRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -396,6 +549,15 @@ namespace InsightsModels
             PerformanceLevel(src.PerformanceLevel)
             {}
 
+        FInsightsSetPerformanceRequest(FInsightsSetPerformanceRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PerformanceLevel(MoveTemp(src.PerformanceLevel))
+            {}
+
+        FInsightsSetPerformanceRequest& operator=(const FInsightsSetPerformanceRequest& src) = default;
+        FInsightsSetPerformanceRequest& operator=(FInsightsSetPerformanceRequest&& src) = default;
+
         FInsightsSetPerformanceRequest(const TSharedPtr<FJsonObject>& obj) : FInsightsSetPerformanceRequest()
         {
             readFromValue(obj);
@@ -404,7 +566,13 @@ namespace InsightsModels
         ~FInsightsSetPerformanceRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FInsightsSetStorageRetentionRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -426,6 +594,15 @@ namespace InsightsModels
             RetentionDays(src.RetentionDays)
             {}
 
+        FInsightsSetStorageRetentionRequest(FInsightsSetStorageRetentionRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            RetentionDays(MoveTemp(src.RetentionDays))
+            {}
+
+        FInsightsSetStorageRetentionRequest& operator=(const FInsightsSetStorageRetentionRequest& src) = default;
+        FInsightsSetStorageRetentionRequest& operator=(FInsightsSetStorageRetentionRequest&& src) = default;
+
         FInsightsSetStorageRetentionRequest(const TSharedPtr<FJsonObject>& obj) : FInsightsSetStorageRetentionRequest()
         {
             readFromValue(obj);
@@ -434,7 +611,13 @@ namespace InsightsModels
         ~FInsightsSetStorageRetentionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
 }
@@ -0,0 +1,112 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PlayFabCppBaseModel.h"
+
+namespace PlayFab
+{
+    /**
+     * Forward-only JSON reader over a UTF-8 buffer.
+     * Generated models use it to fill themselves directly from the response bytes, without building an FJsonObject tree first.
+     * The buffer must outlive the reader. Malformed input puts the reader in an error state, after which every read fails.
+     */
+    class PLAYFABCPP_API FPlayFabJsonPullReader
+    {
+    public:
+        FPlayFabJsonPullReader(const uint8* InData, int32 InLength);
+        explicit FPlayFabJsonPullReader(const TArray<uint8>& InData);
+
+        // False once a syntax error has been encountered
+        bool IsValid() const { return !bHasError; }
+
+        // True if the next value is an object, nothing is consumed
+        bool PeekObjectStart();
+        // Consumes the opening brace of an object; any other value is skipped and false is returned
+        bool ReadObjectStart();
+        // Advances to the next field of the current object and consumes its name, returns false at the end of the object
+        bool NextField();
+        // Compares the name of the current field without converting it; the length of the literal is known at compile time
+        template <int32 NameSize>
+        bool IsField(const ANSICHAR (&Name)[NameSize]) const
+        {
+            return NameSize - 1 == FieldNameLength && FMemory::Memcmp(Name, FieldName, FieldNameLength) == 0;
+        }
+        FString GetFieldName() const;
+
+        // True if the next value is an array, nothing is consumed
+        bool PeekArrayStart();
+        // Consumes the opening bracket of an array; any other value is skipped and false is returned
+        bool ReadArrayStart();
+        // Advances to the next item of the current array, returns false at the end of the array
+        bool NextArrayItem();
+
+        // Consumes the next value if it is null
+        bool ReadNull();
+        // Consumes the next value, whatever its type
+        void SkipValue();
+
+        // Each of these consumes the next value, and returns false if it was not of the requested type
+        // Strings also accept numbers and booleans, converted the same way as FJsonValue::TryGetString
+        bool ReadValue(FString& OutValue);
+        bool ReadValue(bool& OutValue);
+        bool ReadValue(int16& OutValue);
+        bool ReadValue(uint16& OutValue);
+        bool ReadValue(int32& OutValue);
+        bool ReadValue(uint32& OutValue);
+        bool ReadValue(int64& OutValue);
+        bool ReadValue(uint64& OutValue);
+        bool ReadValue(float& OutValue);
+        bool ReadValue(double& OutValue);
+        bool ReadValue(FDateTime& OutValue);
+
+        template <typename BoxedType>
+        bool ReadValue(Boxed<BoxedType>& OutValue)
+        {
+            BoxedType TmpValue;
+            if (!ReadValue(TmpValue))
+                return false;
+            OutValue = TmpValue;
+            return true;
+        }
+
+        // Consumes the next value into a standalone FJsonValue, for fields without a fixed schema. Never returns nullptr.
+        // Values nested deeper than MaxJsonValueDepth put the reader in error rather than exhaust the stack
+        TSharedPtr<FJsonValue> ReadJsonValue();
+
+    private:
+        static constexpr int32 NumberBufferSize = 64;
+        static constexpr int32 MaxJsonValueDepth = 256;
+
+        const uint8* Data;
+        int32 Length;
+        int32 Pos;
+        bool bHasError;
+
+        // Name of the current field; points into Data unless the name contained escapes
+        const ANSICHAR* FieldName;
+        int32 FieldNameLength;
+
+        // Unescaped copies of the last string and field name that contained escape sequences
+        TArray<ANSICHAR> StringScratch;
+        TArray<ANSICHAR> FieldNameScratch;
+
+        bool SetError();
+        void SkipWhitespace();
+        bool PeekChar(uint8& OutChar);
+        bool ReadLiteral(const ANSICHAR* Literal, int32 LiteralLength);
+        bool ReadStringToken(const ANSICHAR*& OutChars, int32& OutLength);
+        bool ReadEscapedStringToken(int32 Start, const ANSICHAR*& OutChars, int32& OutLength);
+        bool ReadHex4(uint32& OutCodePoint);
+        void AppendUtf8(uint32 CodePoint);
+        bool ReadNumberToken(ANSICHAR (&OutBuffer)[NumberBufferSize], bool& bOutIsInteger);
+        bool ReadInteger(int64& OutValue);
+        TSharedPtr<FJsonValue> ReadJsonValue(int32 Depth);
+
+        static FString ToFString(const ANSICHAR* Chars, int32 Length);
+    };
+}
@@ -0,0 +1,38 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PlayFab
+{
+    struct FPlayFabHedgingStats
+    {
+        // Duplicate requests sent because the first one was slower than its endpoint's p95, and how many of them answered first
+        int32 HedgesSent = 0;
+        int32 HedgesWon = 0;
+    };
+
+    /**
+     * Response times of the most recent requests to each endpoint ("/Client/GetTitleData"), measured from when the request was sent.
+     * Percentiles are computed from a window of recent samples, and cached until the endpoint's next sample.
+     */
+    class PLAYFABCPP_API FPlayFabLatencyTracker
+    {
+    public:
+        // Samples kept per endpoint, and how many an endpoint needs before it reports percentiles
+        static constexpr int32 WindowSize = 128;
+        static constexpr int32 MinSamples = 20;
+
+        static void AddSample(const FString& UrlPath, float Seconds);
+        // Percentile in [0, 1] of the endpoint's recent response times; false if it doesn't have enough samples yet
+        static bool GetPercentile(const FString& UrlPath, float Percentile, float& OutSeconds);
+
+        static void OnHedgeSent();
+        static void OnHedgeWon();
+        static FPlayFabHedgingStats GetHedgingStats();
+    };
+}
@@ -8,6 +8,8 @@
 
 #include "CoreMinimal.h"
 #include "Core/PlayFabError.h"
+#include "Core/PlayFabFuture.h"
+#include "Core/PlayFabRequestHandle.h"
 #include "Core/PlayFabMatchmakerDataModels.h"
 #include "Core/PlayFabSettings.h"
 #include "PlayFabAPISettings.h"
@@ -18,8 +20,9 @@ namespace PlayFab
 {
     /**
      * Main interface for PlayFab Sdk, specifically all Matchmaker APIs
+     * When the instance is owned by a shared pointer, it can be destroyed with calls in flight; their responses are dropped.
      */
-    class PLAYFABCPP_API UPlayFabMatchmakerInstanceAPI
+    class PLAYFABCPP_API UPlayFabMatchmakerInstanceAPI : public TSharedFromThis<UPlayFabMatchmakerInstanceAPI>
     {
     public:
         DECLARE_DELEGATE_OneParam(FAuthUserDelegate, const MatchmakerModels::FAuthUserResponse&);
@@ -62,18 +65,25 @@ namespace PlayFab
          * Validates a user with the PlayFab service
          * This API allows the external match-making service to confirm that the user has a valid Session Ticket for the title, in order to securely enable match-making. The client passes the user's Session Ticket to the external match-making service, which then passes the Session Ticket in as the AuthorizationTicket in this call.
          */
-        bool AuthUser(MatchmakerModels::FAuthUserRequest& request, const FAuthUserDelegate& SuccessDelegate = FAuthUserDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool AuthUser(MatchmakerModels::FAuthUserRequest& request, const FAuthUserDelegate& SuccessDelegate = FAuthUserDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Informs the PlayFab game server hosting service that the indicated user has joined the Game Server Instance specified
-        bool PlayerJoined(MatchmakerModels::FPlayerJoinedRequest& request, const FPlayerJoinedDelegate& SuccessDelegate = FPlayerJoinedDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool PlayerJoined(MatchmakerModels::FPlayerJoinedRequest& request, const FPlayerJoinedDelegate& SuccessDelegate = FPlayerJoinedDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Informs the PlayFab game server hosting service that the indicated user has left the Game Server Instance specified
-        bool PlayerLeft(MatchmakerModels::FPlayerLeftRequest& request, const FPlayerLeftDelegate& SuccessDelegate = FPlayerLeftDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool PlayerLeft(MatchmakerModels::FPlayerLeftRequest& request, const FPlayerLeftDelegate& SuccessDelegate = FPlayerLeftDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         // Instructs the PlayFab game server hosting service to instantiate a new Game Server Instance
-        bool StartGame(MatchmakerModels::FStartGameRequest& request, const FStartGameDelegate& SuccessDelegate = FStartGameDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool StartGame(MatchmakerModels::FStartGameRequest& request, const FStartGameDelegate& SuccessDelegate = FStartGameDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
         /**
          * Retrieves the relevant details for a specified user, which the external match-making service can then use to compute
          * effective matches
          */
-        bool UserInfo(MatchmakerModels::FUserInfoRequest& request, const FUserInfoDelegate& SuccessDelegate = FUserInfoDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate());
+        bool UserInfo(MatchmakerModels::FUserInfoRequest& request, const FUserInfoDelegate& SuccessDelegate = FUserInfoDelegate(), const FPlayFabErrorDelegate& ErrorDelegate = FPlayFabErrorDelegate(), const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+
+        // ------------ Generated async API calls, resolving a future instead of running delegates
+        TFuture<TPlayFabResult<MatchmakerModels::FAuthUserResponse>> AuthUserAsync(MatchmakerModels::FAuthUserRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<MatchmakerModels::FPlayerJoinedResponse>> PlayerJoinedAsync(MatchmakerModels::FPlayerJoinedRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<MatchmakerModels::FPlayerLeftResponse>> PlayerLeftAsync(MatchmakerModels::FPlayerLeftRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<MatchmakerModels::FStartGameResponse>> StartGameAsync(MatchmakerModels::FStartGameRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        TFuture<TPlayFabResult<MatchmakerModels::FUserInfoResponse>> UserInfoAsync(MatchmakerModels::FUserInfoRequest& request, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
 
     private:
         // ------------ Generated result handlers
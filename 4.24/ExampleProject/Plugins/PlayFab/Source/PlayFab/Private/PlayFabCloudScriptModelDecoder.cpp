@@ -11,6 +11,7 @@
 
 #include "PlayFabCloudScriptModelDecoder.h"
 #include "PlayFabPrivate.h"
+#include "PlayFabJsonDecoder.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab CloudScript API Functions
@@ -25,20 +26,20 @@ FCloudScriptExecuteCloudScriptResult UPlayFabCloudScriptModelDecoder::decodeExec
 {
     // Temp ustruct
     FCloudScriptExecuteCloudScriptResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
-
-    tempStruct.APIRequestsIssued = !(dataObj->HasField("APIRequestsIssued")) ? 0 : int(dataObj->GetNumberField("APIRequestsIssued"));
-    tempStruct.Error = !(dataObj->HasField("Error")) ? nullptr : dataObj->GetObjectField("Error");
-    tempStruct.ExecutionTimeSeconds = !(dataObj->HasField("ExecutionTimeSeconds")) ? 0 : int(dataObj->GetNumberField("ExecutionTimeSeconds"));
-    tempStruct.FunctionName = !(dataObj->HasField("FunctionName")) ? TEXT("") : dataObj->GetStringField("FunctionName");
-    tempStruct.FunctionResult = !(dataObj->HasField("FunctionResult")) ? nullptr : dataObj->GetObjectField("FunctionResult");
-    tempStruct.FunctionResultTooLarge = !(dataObj->HasField("FunctionResultTooLarge")) ? false : dataObj->GetBoolField("FunctionResultTooLarge");
-    tempStruct.HttpRequestsIssued = !(dataObj->HasField("HttpRequestsIssued")) ? 0 : int(dataObj->GetNumberField("HttpRequestsIssued"));
-    tempStruct.Logs = !(dataObj->HasField("Logs")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Logs");
-    tempStruct.LogsTooLarge = !(dataObj->HasField("LogsTooLarge")) ? false : dataObj->GetBoolField("LogsTooLarge");
-    tempStruct.MemoryConsumedBytes = !(dataObj->HasField("MemoryConsumedBytes")) ? 0 : int(dataObj->GetNumberField("MemoryConsumedBytes"));
-    tempStruct.ProcessorTimeSeconds = !(dataObj->HasField("ProcessorTimeSeconds")) ? 0 : int(dataObj->GetNumberField("ProcessorTimeSeconds"));
-    tempStruct.Revision = !(dataObj->HasField("Revision")) ? 0 : int(dataObj->GetNumberField("Revision"));
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
+
+    tempStruct.APIRequestsIssued = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("APIRequestsIssued"));
+    tempStruct.Error = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Error"));
+    tempStruct.ExecutionTimeSeconds = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ExecutionTimeSeconds"));
+    tempStruct.FunctionName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("FunctionName"));
+    tempStruct.FunctionResult = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("FunctionResult"));
+    tempStruct.FunctionResultTooLarge = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("FunctionResultTooLarge"));
+    tempStruct.HttpRequestsIssued = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("HttpRequestsIssued"));
+    tempStruct.Logs = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Logs"));
+    tempStruct.LogsTooLarge = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("LogsTooLarge"));
+    tempStruct.MemoryConsumedBytes = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("MemoryConsumedBytes"));
+    tempStruct.ProcessorTimeSeconds = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ProcessorTimeSeconds"));
+    tempStruct.Revision = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("Revision"));
 
     return tempStruct;
 }
@@ -47,13 +48,13 @@ FCloudScriptExecuteFunctionResult UPlayFabCloudScriptModelDecoder::decodeExecute
 {
     // Temp ustruct
     FCloudScriptExecuteFunctionResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Error = !(dataObj->HasField("Error")) ? nullptr : dataObj->GetObjectField("Error");
-    tempStruct.ExecutionTimeMilliseconds = !(dataObj->HasField("ExecutionTimeMilliseconds")) ? 0 : int(dataObj->GetNumberField("ExecutionTimeMilliseconds"));
-    tempStruct.FunctionName = !(dataObj->HasField("FunctionName")) ? TEXT("") : dataObj->GetStringField("FunctionName");
-    tempStruct.FunctionResult = !(dataObj->HasField("FunctionResult")) ? nullptr : dataObj->GetObjectField("FunctionResult");
-    tempStruct.FunctionResultTooLarge = !(dataObj->HasField("FunctionResultTooLarge")) ? false : dataObj->GetBoolField("FunctionResultTooLarge");
+    tempStruct.Error = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Error"));
+    tempStruct.ExecutionTimeMilliseconds = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ExecutionTimeMilliseconds"));
+    tempStruct.FunctionName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("FunctionName"));
+    tempStruct.FunctionResult = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("FunctionResult"));
+    tempStruct.FunctionResultTooLarge = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("FunctionResultTooLarge"));
 
     return tempStruct;
 }
@@ -62,9 +63,9 @@ FCloudScriptListFunctionsResult UPlayFabCloudScriptModelDecoder::decodeListFunct
 {
     // Temp ustruct
     FCloudScriptListFunctionsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Functions = !(dataObj->HasField("Functions")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Functions");
+    tempStruct.Functions = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Functions"));
 
     return tempStruct;
 }
@@ -73,9 +74,9 @@ FCloudScriptListHttpFunctionsResult UPlayFabCloudScriptModelDecoder::decodeListH
 {
     // Temp ustruct
     FCloudScriptListHttpFunctionsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Functions = !(dataObj->HasField("Functions")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Functions");
+    tempStruct.Functions = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Functions"));
 
     return tempStruct;
 }
@@ -84,9 +85,9 @@ FCloudScriptListQueuedFunctionsResult UPlayFabCloudScriptModelDecoder::decodeLis
 {
     // Temp ustruct
     FCloudScriptListQueuedFunctionsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Functions = !(dataObj->HasField("Functions")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Functions");
+    tempStruct.Functions = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Functions"));
 
     return tempStruct;
 }
@@ -11,6 +11,7 @@
 
 #include "PlayFabLocalizationModelDecoder.h"
 #include "PlayFabPrivate.h"
+#include "PlayFabJsonDecoder.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Localization API Functions
@@ -25,9 +26,9 @@ FLocalizationGetLanguageListResponse UPlayFabLocalizationModelDecoder::decodeGet
 {
     // Temp ustruct
     FLocalizationGetLanguageListResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.LanguageList = !(dataObj->HasField("LanguageList")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("LanguageList"), TEXT(","));
+    tempStruct.LanguageList = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("LanguageList"));
 
     return tempStruct;
 }
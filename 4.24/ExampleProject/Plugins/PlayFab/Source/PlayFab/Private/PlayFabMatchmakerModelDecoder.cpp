@@ -11,6 +11,7 @@
 
 #include "PlayFabMatchmakerModelDecoder.h"
 #include "PlayFabPrivate.h"
+#include "PlayFabJsonDecoder.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Matchmaker API Functions
@@ -25,10 +26,10 @@ FMatchmakerAuthUserResponse UPlayFabMatchmakerModelDecoder::decodeAuthUserRespon
 {
     // Temp ustruct
     FMatchmakerAuthUserResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Authorized = !(dataObj->HasField("Authorized")) ? false : dataObj->GetBoolField("Authorized");
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
+    tempStruct.Authorized = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("Authorized"));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
 
     return tempStruct;
 }
@@ -55,13 +56,13 @@ FMatchmakerStartGameResponse UPlayFabMatchmakerModelDecoder::decodeStartGameResp
 {
     // Temp ustruct
     FMatchmakerStartGameResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.GameID = !(dataObj->HasField("GameID")) ? TEXT("") : dataObj->GetStringField("GameID");
-    tempStruct.ServerIPV4Address = !(dataObj->HasField("ServerIPV4Address")) ? TEXT("") : dataObj->GetStringField("ServerIPV4Address");
-    tempStruct.ServerIPV6Address = !(dataObj->HasField("ServerIPV6Address")) ? TEXT("") : dataObj->GetStringField("ServerIPV6Address");
-    tempStruct.ServerPort = !(dataObj->HasField("ServerPort")) ? 0 : int(dataObj->GetNumberField("ServerPort"));
-    tempStruct.ServerPublicDNSName = !(dataObj->HasField("ServerPublicDNSName")) ? TEXT("") : dataObj->GetStringField("ServerPublicDNSName");
+    tempStruct.GameID = FPlayFabJsonDecoder::GetString(dataObj, TEXT("GameID"));
+    tempStruct.ServerIPV4Address = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ServerIPV4Address"));
+    tempStruct.ServerIPV6Address = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ServerIPV6Address"));
+    tempStruct.ServerPort = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("ServerPort"));
+    tempStruct.ServerPublicDNSName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ServerPublicDNSName"));
 
     return tempStruct;
 }
@@ -70,16 +71,16 @@ FMatchmakerUserInfoResponse UPlayFabMatchmakerModelDecoder::decodeUserInfoRespon
 {
     // Temp ustruct
     FMatchmakerUserInfoResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
-
-    tempStruct.Inventory = !(dataObj->HasField("Inventory")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Inventory");
-    tempStruct.IsDeveloper = !(dataObj->HasField("IsDeveloper")) ? false : dataObj->GetBoolField("IsDeveloper");
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.SteamId = !(dataObj->HasField("SteamId")) ? TEXT("") : dataObj->GetStringField("SteamId");
-    tempStruct.TitleDisplayName = !(dataObj->HasField("TitleDisplayName")) ? TEXT("") : dataObj->GetStringField("TitleDisplayName");
-    tempStruct.Username = !(dataObj->HasField("Username")) ? TEXT("") : dataObj->GetStringField("Username");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? nullptr : dataObj->GetObjectField("VirtualCurrency");
-    tempStruct.VirtualCurrencyRechargeTimes = !(dataObj->HasField("VirtualCurrencyRechargeTimes")) ? nullptr : dataObj->GetObjectField("VirtualCurrencyRechargeTimes");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
+
+    tempStruct.Inventory = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Inventory"));
+    tempStruct.IsDeveloper = FPlayFabJsonDecoder::GetBool(dataObj, TEXT("IsDeveloper"));
+    tempStruct.PlayFabId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("PlayFabId"));
+    tempStruct.SteamId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("SteamId"));
+    tempStruct.TitleDisplayName = FPlayFabJsonDecoder::GetString(dataObj, TEXT("TitleDisplayName"));
+    tempStruct.Username = FPlayFabJsonDecoder::GetString(dataObj, TEXT("Username"));
+    tempStruct.VirtualCurrency = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("VirtualCurrency"));
+    tempStruct.VirtualCurrencyRechargeTimes = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("VirtualCurrencyRechargeTimes"));
 
     return tempStruct;
 }
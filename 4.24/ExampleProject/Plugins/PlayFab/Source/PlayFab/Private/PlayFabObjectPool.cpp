@@ -0,0 +1,99 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabObjectPool.h"
+#include "PlayFabCommon/Public/PlayFabRuntimeSettings.h"
+
+namespace
+{
+    FPlayFabObjectPool* Pool = nullptr;
+}
+
+void FPlayFabObjectPool::Startup()
+{
+    if (Pool == nullptr)
+    {
+        Pool = new FPlayFabObjectPool();
+    }
+}
+
+void FPlayFabObjectPool::Shutdown()
+{
+    delete Pool;
+    Pool = nullptr;
+}
+
+UObject* FPlayFabObjectPool::Acquire(UClass* Class)
+{
+    check(IsInGameThread());
+    if (Pool == nullptr)
+    {
+        // Outside the module's lifetime, fall back to rooting a new object, as Release will unroot it
+        UObject* Object = NewObject<UObject>(GetTransientPackage(), Class);
+        if (Object->IsSafeForRootSet()) Object->AddToRoot();
+        return Object;
+    }
+
+    // The garbage collector clears references to objects that were explicitly destroyed
+    UObject* Object = nullptr;
+    TArray<UObject*>* Free = Pool->FreeObjects.Find(Class);
+    while (Object == nullptr && Free != nullptr && Free->Num() > 0)
+    {
+        Object = Free->Pop(false);
+    }
+    if (Object == nullptr)
+    {
+        Object = NewObject<UObject>(GetTransientPackage(), Class);
+    }
+    Pool->ObjectsInUse.Add(Object);
+    return Object;
+}
+
+void FPlayFabObjectPool::Release(UObject* Object)
+{
+    check(IsInGameThread());
+    if (Object == nullptr)
+    {
+        return;
+    }
+    if (Pool == nullptr || Pool->ObjectsInUse.RemoveSingleSwap(Object, false) == 0)
+    {
+        Object->RemoveFromRoot();
+        return;
+    }
+
+    TArray<UObject*>& Free = Pool->FreeObjects.FindOrAdd(Object->GetClass());
+    if (Free.Num() < GetDefault<UPlayFabRuntimeSettings>()->BlueprintObjectPoolSize)
+    {
+        Free.Add(Object);
+    }
+}
+
+int32 FPlayFabObjectPool::GetFreeCount()
+{
+    int32 Count = 0;
+    if (Pool != nullptr)
+    {
+        for (const auto& Pair : Pool->FreeObjects)
+        {
+            Count += Pair.Value.Num();
+        }
+    }
+    return Count;
+}
+
+int32 FPlayFabObjectPool::GetInUseCount()
+{
+    return Pool != nullptr ? Pool->ObjectsInUse.Num() : 0;
+}
+
+void FPlayFabObjectPool::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    for (auto& Pair : FreeObjects)
+    {
+        Collector.AddReferencedObjects(Pair.Value);
+    }
+    Collector.AddReferencedObjects(ObjectsInUse);
+}
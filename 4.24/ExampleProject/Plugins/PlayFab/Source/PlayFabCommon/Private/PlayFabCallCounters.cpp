@@ -0,0 +1,295 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabCallCounters.h"
+#include "Misc/ScopeRWLock.h"
+#include "Misc/ScopeLock.h"
+
+using namespace PlayFabCommon;
+
+namespace
+{
+    // Counters are never removed, so references handed out by FindOrAdd stay valid for the lifetime of the module
+    class FPlayFabCallCounterTable
+    {
+    public:
+        FPlayFabCallCounter& FindOrAdd(const FString& Key)
+        {
+            {
+                FRWScopeLock ReadLock(Lock, SLT_ReadOnly);
+                if (const TUniquePtr<FPlayFabCallCounter>* Existing = Counters.Find(Key))
+                {
+                    return **Existing;
+                }
+            }
+
+            FRWScopeLock WriteLock(Lock, SLT_Write);
+            TUniquePtr<FPlayFabCallCounter>& Counter = Counters.FindOrAdd(Key);
+            if (!Counter.IsValid())
+            {
+                Counter = MakeUnique<FPlayFabCallCounter>();
+            }
+            return *Counter;
+        }
+
+        FPlayFabCallCountStats GetStats(const FString& Key)
+        {
+            FRWScopeLock ReadLock(Lock, SLT_ReadOnly);
+            const TUniquePtr<FPlayFabCallCounter>* Existing = Counters.Find(Key);
+            return Existing != nullptr ? (*Existing)->GetStats() : FPlayFabCallCountStats();
+        }
+
+        TMap<FString, FPlayFabCallCountStats> GetAllStats()
+        {
+            TMap<FString, FPlayFabCallCountStats> Output;
+            FRWScopeLock ReadLock(Lock, SLT_ReadOnly);
+            Output.Reserve(Counters.Num());
+            for (const auto& Pair : Counters)
+            {
+                Output.Add(Pair.Key, Pair.Value->GetStats());
+            }
+            return Output;
+        }
+
+        void ResetHighWaterMarks()
+        {
+            FRWScopeLock ReadLock(Lock, SLT_ReadOnly);
+            for (const auto& Pair : Counters)
+            {
+                Pair.Value->ResetHighWaterMark();
+            }
+        }
+
+    private:
+        FRWLock Lock;
+        TMap<FString, TUniquePtr<FPlayFabCallCounter>> Counters;
+    };
+
+    /**
+     * Counters of each request url, found without taking a lock.
+     * Entries live in an open-addressed table whose slots are only ever filled once, so a reader sees either nothing or a complete entry.
+     * Urls that don't fit in the table are kept in an overflow map behind a lock.
+     */
+    class FPlayFabRequestUrlTable
+    {
+    public:
+        struct FEntry
+        {
+            FString RequestUrl;
+            uint32 Hash = 0;
+            FPlayFabCallCounter* ApiCounter = nullptr;
+            FPlayFabCallCounter* EndpointCounter = nullptr;
+        };
+
+        FPlayFabRequestUrlTable()
+        {
+            for (TAtomic<const FEntry*>& Slot : Slots)
+            {
+                Slot = nullptr;
+            }
+        }
+
+        const FEntry& Find(const FString& RequestUrl)
+        {
+            const uint32 Hash = GetTypeHash(RequestUrl);
+            if (const FEntry* Entry = FindInSlots(RequestUrl, Hash))
+            {
+                return *Entry;
+            }
+            return Register(RequestUrl, Hash);
+        }
+
+    private:
+        static constexpr uint32 NumSlots = 1024;
+
+        const FEntry* FindInSlots(const FString& RequestUrl, uint32 Hash) const
+        {
+            for (uint32 Probe = 0; Probe < NumSlots; ++Probe)
+            {
+                const FEntry* Entry = Slots[(Hash + Probe) & (NumSlots - 1)].Load();
+                if (Entry == nullptr)
+                {
+                    return nullptr;
+                }
+                if (Entry->Hash == Hash && Entry->RequestUrl == RequestUrl)
+                {
+                    return Entry;
+                }
+            }
+            return nullptr;
+        }
+
+        const FEntry& Register(const FString& RequestUrl, uint32 Hash);
+
+        TAtomic<const FEntry*> Slots[NumSlots];
+        FCriticalSection RegisterLock;
+        TArray<TUniquePtr<FEntry>> Entries;
+        TMap<FString, const FEntry*> Overflow;
+    };
+
+    FPlayFabCallCounter& GetTotalCounter()
+    {
+        static FPlayFabCallCounter Counter;
+        return Counter;
+    }
+
+    FPlayFabCallCounterTable& GetApiCounters()
+    {
+        static FPlayFabCallCounterTable Table;
+        return Table;
+    }
+
+    FPlayFabCallCounterTable& GetEndpointCounters()
+    {
+        static FPlayFabCallCounterTable Table;
+        return Table;
+    }
+
+    FPlayFabRequestUrlTable& GetRequestUrls()
+    {
+        static FPlayFabRequestUrlTable Table;
+        return Table;
+    }
+
+    const FPlayFabRequestUrlTable::FEntry& FPlayFabRequestUrlTable::Register(const FString& RequestUrl, uint32 Hash)
+    {
+        FScopeLock Lock(&RegisterLock);
+
+        // Another thread may have registered the url since the lookup
+        if (const FEntry* Existing = FindInSlots(RequestUrl, Hash))
+        {
+            return *Existing;
+        }
+        if (const FEntry* const* Existing = Overflow.Find(RequestUrl))
+        {
+            return **Existing;
+        }
+
+        FString UrlPath, ApiName;
+        FPlayFabCallCounters::ParseRequestUrl(RequestUrl, UrlPath, ApiName);
+        TUniquePtr<FEntry>& Entry = Entries.Add_GetRef(MakeUnique<FEntry>());
+        Entry->RequestUrl = RequestUrl;
+        Entry->Hash = Hash;
+        Entry->ApiCounter = &GetApiCounters().FindOrAdd(ApiName);
+        Entry->EndpointCounter = &GetEndpointCounters().FindOrAdd(UrlPath);
+
+        for (uint32 Probe = 0; Probe < NumSlots; ++Probe)
+        {
+            TAtomic<const FEntry*>& Slot = Slots[(Hash + Probe) & (NumSlots - 1)];
+            if (Slot.Load() == nullptr)
+            {
+                // Published last, once the entry is complete
+                Slot = Entry.Get();
+                return *Entry;
+            }
+        }
+        Overflow.Add(RequestUrl, Entry.Get());
+        return *Entry;
+    }
+}
+
+void FPlayFabCallCounter::Add(int32 Delta)
+{
+    const int32 NewInFlight = InFlight.AddExchange(Delta) + Delta;
+    int32 CurrentHigh = HighWaterMark.Load(EMemoryOrder::Relaxed);
+    while (NewInFlight > CurrentHigh && !HighWaterMark.CompareExchange(CurrentHigh, NewInFlight))
+    {
+    }
+}
+
+void FPlayFabCallCounter::ResetHighWaterMark()
+{
+    HighWaterMark = InFlight.Load();
+}
+
+FPlayFabCallCountStats FPlayFabCallCounter::GetStats() const
+{
+    FPlayFabCallCountStats Stats;
+    Stats.InFlight = GetInFlight();
+    Stats.HighWaterMark = GetHighWaterMark();
+    return Stats;
+}
+
+void FPlayFabCallCounters::BeginCall(const FString& RequestUrl)
+{
+    const FPlayFabRequestUrlTable::FEntry& Entry = GetRequestUrls().Find(RequestUrl);
+    GetTotalCounter().Increment();
+    Entry.ApiCounter->Increment();
+    Entry.EndpointCounter->Increment();
+}
+
+void FPlayFabCallCounters::EndCall(const FString& RequestUrl)
+{
+    const FPlayFabRequestUrlTable::FEntry& Entry = GetRequestUrls().Find(RequestUrl);
+    GetTotalCounter().Decrement();
+    Entry.ApiCounter->Decrement();
+    Entry.EndpointCounter->Decrement();
+}
+
+void FPlayFabCallCounters::ModifyTotal(int32 Delta)
+{
+    GetTotalCounter().Add(Delta);
+}
+
+FPlayFabCallCountStats FPlayFabCallCounters::GetTotalStats()
+{
+    return GetTotalCounter().GetStats();
+}
+
+FPlayFabCallCountStats FPlayFabCallCounters::GetApiStats(const FString& ApiName)
+{
+    return GetApiCounters().GetStats(ApiName);
+}
+
+FPlayFabCallCountStats FPlayFabCallCounters::GetEndpointStats(const FString& UrlPath)
+{
+    return GetEndpointCounters().GetStats(UrlPath);
+}
+
+TMap<FString, FPlayFabCallCountStats> FPlayFabCallCounters::GetAllApiStats()
+{
+    return GetApiCounters().GetAllStats();
+}
+
+TMap<FString, FPlayFabCallCountStats> FPlayFabCallCounters::GetAllEndpointStats()
+{
+    return GetEndpointCounters().GetAllStats();
+}
+
+void FPlayFabCallCounters::ResetHighWaterMarks()
+{
+    GetTotalCounter().ResetHighWaterMark();
+    GetApiCounters().ResetHighWaterMarks();
+    GetEndpointCounters().ResetHighWaterMarks();
+}
+
+void FPlayFabCallCounters::ParseRequestUrl(const FString& RequestUrl, FString& OutUrlPath, FString& OutApiName)
+{
+    // https://titleId.playfabapi.com/Client/LoginWithCustomID?sdk=... -> /Client/LoginWithCustomID
+    int32 PathStart = 0;
+    const int32 SchemeEnd = RequestUrl.Find(TEXT("://"), ESearchCase::CaseSensitive);
+    if (SchemeEnd != INDEX_NONE)
+    {
+        PathStart = RequestUrl.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, SchemeEnd + 3);
+        if (PathStart == INDEX_NONE)
+        {
+            PathStart = RequestUrl.Len();
+        }
+    }
+
+    int32 PathEnd = RequestUrl.Find(TEXT("?"), ESearchCase::CaseSensitive, ESearchDir::FromStart, PathStart);
+    if (PathEnd == INDEX_NONE)
+    {
+        PathEnd = RequestUrl.Len();
+    }
+    OutUrlPath = RequestUrl.Mid(PathStart, PathEnd - PathStart);
+
+    int32 ApiEnd = OutUrlPath.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, 1);
+    if (ApiEnd == INDEX_NONE)
+    {
+        ApiEnd = OutUrlPath.Len();
+    }
+    OutApiName = ApiEnd > 1 ? OutUrlPath.Mid(1, ApiEnd - 1) : FString();
+}
@@ -0,0 +1,67 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Atomic.h"
+
+namespace PlayFabCommon
+{
+    /** Snapshot of one in-flight counter */
+    struct FPlayFabCallCountStats
+    {
+        int32 InFlight = 0;
+        int32 HighWaterMark = 0;
+    };
+
+    /** Lock-free count of calls in flight, with the highest value it has reached */
+    class PLAYFABCOMMON_API FPlayFabCallCounter
+    {
+    public:
+        FPlayFabCallCounter() : InFlight(0), HighWaterMark(0) {}
+
+        void Increment() { Add(1); }
+        void Decrement() { Add(-1); }
+        void Add(int32 Delta);
+        void ResetHighWaterMark();
+
+        int32 GetInFlight() const { return InFlight.Load(EMemoryOrder::Relaxed); }
+        int32 GetHighWaterMark() const { return HighWaterMark.Load(EMemoryOrder::Relaxed); }
+        FPlayFabCallCountStats GetStats() const;
+
+    private:
+        TAtomic<int32> InFlight;
+        TAtomic<int32> HighWaterMark;
+    };
+
+    /**
+     * In-flight call accounting shared by the Blueprint and C++ SDKs.
+     * Every call is counted in the SDK total, in its API ("Client", "Server", ...) and in its endpoint ("/Client/LoginWithCustomID").
+     * The counters of each request url are looked up in a table that is read without locks, so counting a call is only atomic updates.
+     * A lock is only taken to register a url that has never been seen before, and to read the stats.
+     */
+    class PLAYFABCOMMON_API FPlayFabCallCounters
+    {
+    public:
+        // Both take the full request url; the endpoint is the path of the url, and the API is its first segment
+        static void BeginCall(const FString& RequestUrl);
+        static void EndCall(const FString& RequestUrl);
+        // Adjusts the SDK total only, for callers that count their own calls
+        static void ModifyTotal(int32 Delta);
+
+        static FPlayFabCallCountStats GetTotalStats();
+        static FPlayFabCallCountStats GetApiStats(const FString& ApiName);
+        static FPlayFabCallCountStats GetEndpointStats(const FString& UrlPath);
+        static TMap<FString, FPlayFabCallCountStats> GetAllApiStats();
+        static TMap<FString, FPlayFabCallCountStats> GetAllEndpointStats();
+
+        // Lowers every high-water mark to the current in-flight count
+        static void ResetHighWaterMarks();
+
+        // Splits a request url into its endpoint ("/Client/LoginWithCustomID") and API ("Client")
+        static void ParseRequestUrl(const FString& RequestUrl, FString& OutUrlPath, FString& OutApiName);
+    };
+}
@@ -7,6 +7,7 @@
 
 #include "Core/PlayFabAdminDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
+#include "Core/PlayFabJsonPullReader.h"
 
 using namespace PlayFab;
 using namespace PlayFab::AdminModels;
@@ -16,7 +17,8 @@ PlayFab::AdminModels::FAbortTaskInstanceRequest::~FAbortTaskInstanceRequest()
 
 }
 
-void PlayFab::AdminModels::FAbortTaskInstanceRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FAbortTaskInstanceRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -44,6 +46,16 @@ void PlayFab::AdminModels::FAbortTaskInstanceRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FAbortTaskInstanceRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FAbortTaskInstanceRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FAbortTaskInstanceRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -53,7 +65,7 @@ bool PlayFab::AdminModels::FAbortTaskInstanceRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -67,12 +79,50 @@ bool PlayFab::AdminModels::FAbortTaskInstanceRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FAbortTaskInstanceRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("TaskInstanceId"))
+        {
+            reader.ReadValue(TaskInstanceId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAbortTaskInstanceRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskParameter::~FActionsOnPlayersInSegmentTaskParameter()
 {
 
 }
 
-void PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskParameter::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskParameter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -99,6 +149,16 @@ void PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskParameter::writeJSON(Js
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskParameter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskParameter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskParameter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -120,7 +180,38 @@ bool PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskParameter::readFromValu
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeTaskInstanceStatusEnumJSON(TaskInstanceStatus enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskParameter::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ActionId"))
+        {
+            reader.ReadValue(ActionId);
+        }
+        else if (reader.IsField("SegmentId"))
+        {
+            reader.ReadValue(SegmentId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FActionsOnPlayersInSegmentTaskParameter();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeTaskInstanceStatusEnumValue(AdminModels::TaskInstanceStatus enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -134,6 +225,16 @@ void PlayFab::AdminModels::writeTaskInstanceStatusEnumJSON(TaskInstanceStatus en
     }
 }
 
+void PlayFab::AdminModels::writeTaskInstanceStatusEnumJSON(TaskInstanceStatus enumVal, JsonWriter& writer)
+{
+    writeTaskInstanceStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeTaskInstanceStatusEnumJSON(TaskInstanceStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeTaskInstanceStatusEnumValue(enumVal, writer);
+}
+
 AdminModels::TaskInstanceStatus PlayFab::AdminModels::readTaskInstanceStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readTaskInstanceStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -169,7 +270,8 @@ PlayFab::AdminModels::FNameIdentifier::~FNameIdentifier()
 
 }
 
-void PlayFab::AdminModels::FNameIdentifier::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FNameIdentifier::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -188,6 +290,16 @@ void PlayFab::AdminModels::FNameIdentifier::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FNameIdentifier::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FNameIdentifier::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FNameIdentifier::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -209,13 +321,44 @@ bool PlayFab::AdminModels::FNameIdentifier::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FNameIdentifier::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FNameIdentifier();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskSummary::~FActionsOnPlayersInSegmentTaskSummary()
 {
     //if (TaskIdentifier != nullptr) delete TaskIdentifier;
 
 }
 
-void PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskSummary::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskSummary::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -291,6 +434,16 @@ void PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskSummary::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskSummary::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskSummary::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskSummary::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -345,7 +498,7 @@ bool PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskSummary::readFromValue(
     const TSharedPtr<FJsonValue> TaskIdentifierValue = obj->TryGetField(TEXT("TaskIdentifier"));
     if (TaskIdentifierValue.IsValid() && !TaskIdentifierValue->IsNull())
     {
-        TaskIdentifier = MakeShareable(new FNameIdentifier(TaskIdentifierValue->AsObject()));
+        TaskIdentifier = MakeShared<FNameIdentifier>(TaskIdentifierValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> TaskInstanceIdValue = obj->TryGetField(TEXT("TaskInstanceId"));
@@ -372,12 +525,85 @@ bool PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskSummary::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FActionsOnPlayersInSegmentTaskSummary::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CompletedAt"))
+        {
+            reader.ReadValue(CompletedAt);
+        }
+        else if (reader.IsField("ErrorMessage"))
+        {
+            reader.ReadValue(ErrorMessage);
+        }
+        else if (reader.IsField("ErrorWasFatal"))
+        {
+            reader.ReadValue(ErrorWasFatal);
+        }
+        else if (reader.IsField("EstimatedSecondsRemaining"))
+        {
+            reader.ReadValue(EstimatedSecondsRemaining);
+        }
+        else if (reader.IsField("PercentComplete"))
+        {
+            reader.ReadValue(PercentComplete);
+        }
+        else if (reader.IsField("ScheduledByUserId"))
+        {
+            reader.ReadValue(ScheduledByUserId);
+        }
+        else if (reader.IsField("StartedAt"))
+        {
+            reader.ReadValue(StartedAt);
+        }
+        else if (reader.IsField("Status"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Status = readTaskInstanceStatusFromValue(TmpValue); }
+        }
+        else if (reader.IsField("TaskIdentifier"))
+        {
+            TaskIdentifier = MakeShared<FNameIdentifier>();
+            TaskIdentifier->readFromReader(reader);
+        }
+        else if (reader.IsField("TaskInstanceId"))
+        {
+            reader.ReadValue(TaskInstanceId);
+        }
+        else if (reader.IsField("TotalPlayersInSegment"))
+        {
+            reader.ReadValue(TotalPlayersInSegment);
+        }
+        else if (reader.IsField("TotalPlayersProcessed"))
+        {
+            reader.ReadValue(TotalPlayersProcessed);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FActionsOnPlayersInSegmentTaskSummary();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FAdCampaignAttribution::~FAdCampaignAttribution()
 {
 
 }
 
-void PlayFab::AdminModels::FAdCampaignAttribution::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FAdCampaignAttribution::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -399,6 +625,16 @@ void PlayFab::AdminModels::FAdCampaignAttribution::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FAdCampaignAttribution::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FAdCampaignAttribution::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FAdCampaignAttribution::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -425,12 +661,47 @@ bool PlayFab::AdminModels::FAdCampaignAttribution::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FAdCampaignAttribution::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AttributedAt"))
+        {
+            reader.ReadValue(AttributedAt);
+        }
+        else if (reader.IsField("CampaignId"))
+        {
+            reader.ReadValue(CampaignId);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            reader.ReadValue(Platform);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAdCampaignAttribution();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FAdCampaignAttributionModel::~FAdCampaignAttributionModel()
 {
 
 }
 
-void PlayFab::AdminModels::FAdCampaignAttributionModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FAdCampaignAttributionModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -452,6 +723,16 @@ void PlayFab::AdminModels::FAdCampaignAttributionModel::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FAdCampaignAttributionModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FAdCampaignAttributionModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FAdCampaignAttributionModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -478,7 +759,42 @@ bool PlayFab::AdminModels::FAdCampaignAttributionModel::readFromValue(const TSha
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeSegmentFilterComparisonEnumJSON(SegmentFilterComparison enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FAdCampaignAttributionModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AttributedAt"))
+        {
+            reader.ReadValue(AttributedAt);
+        }
+        else if (reader.IsField("CampaignId"))
+        {
+            reader.ReadValue(CampaignId);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            reader.ReadValue(Platform);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAdCampaignAttributionModel();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeSegmentFilterComparisonEnumValue(AdminModels::SegmentFilterComparison enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -495,6 +811,16 @@ void PlayFab::AdminModels::writeSegmentFilterComparisonEnumJSON(SegmentFilterCom
     }
 }
 
+void PlayFab::AdminModels::writeSegmentFilterComparisonEnumJSON(SegmentFilterComparison enumVal, JsonWriter& writer)
+{
+    writeSegmentFilterComparisonEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeSegmentFilterComparisonEnumJSON(SegmentFilterComparison enumVal, JsonUtf8Writer& writer)
+{
+    writeSegmentFilterComparisonEnumValue(enumVal, writer);
+}
+
 AdminModels::SegmentFilterComparison PlayFab::AdminModels::readSegmentFilterComparisonFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readSegmentFilterComparisonFromValue(value.IsValid() ? value->AsString() : "");
@@ -533,7 +859,8 @@ PlayFab::AdminModels::FAdCampaignSegmentFilter::~FAdCampaignSegmentFilter()
 
 }
 
-void PlayFab::AdminModels::FAdCampaignSegmentFilter::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FAdCampaignSegmentFilter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -558,6 +885,16 @@ void PlayFab::AdminModels::FAdCampaignSegmentFilter::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FAdCampaignSegmentFilter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FAdCampaignSegmentFilter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FAdCampaignSegmentFilter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -581,12 +918,48 @@ bool PlayFab::AdminModels::FAdCampaignSegmentFilter::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FAdCampaignSegmentFilter::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CampaignId"))
+        {
+            reader.ReadValue(CampaignId);
+        }
+        else if (reader.IsField("CampaignSource"))
+        {
+            reader.ReadValue(CampaignSource);
+        }
+        else if (reader.IsField("Comparison"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Comparison = readSegmentFilterComparisonFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAdCampaignSegmentFilter();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FAddLocalizedNewsRequest::~FAddLocalizedNewsRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FAddLocalizedNewsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FAddLocalizedNewsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -644,6 +1017,16 @@ void PlayFab::AdminModels::FAddLocalizedNewsRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FAddLocalizedNewsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FAddLocalizedNewsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FAddLocalizedNewsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -660,7 +1043,7 @@ bool PlayFab::AdminModels::FAddLocalizedNewsRequest::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -688,18 +1071,78 @@ bool PlayFab::AdminModels::FAddLocalizedNewsRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FAddLocalizedNewsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Body"))
+        {
+            reader.ReadValue(Body);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Language"))
+        {
+            reader.ReadValue(Language);
+        }
+        else if (reader.IsField("NewsId"))
+        {
+            reader.ReadValue(NewsId);
+        }
+        else if (reader.IsField("Title"))
+        {
+            reader.ReadValue(Title);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddLocalizedNewsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FAddLocalizedNewsResult::~FAddLocalizedNewsResult()
 {
 
 }
 
-void PlayFab::AdminModels::FAddLocalizedNewsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FAddLocalizedNewsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FAddLocalizedNewsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FAddLocalizedNewsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FAddLocalizedNewsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -707,12 +1150,34 @@ bool PlayFab::AdminModels::FAddLocalizedNewsResult::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FAddLocalizedNewsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddLocalizedNewsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FAddNewsRequest::~FAddNewsRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FAddNewsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FAddNewsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -756,6 +1221,16 @@ void PlayFab::AdminModels::FAddNewsRequest::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FAddNewsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FAddNewsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FAddNewsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -772,7 +1247,7 @@ bool PlayFab::AdminModels::FAddNewsRequest::readFromValue(const TSharedPtr<FJson
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -791,14 +1266,60 @@ bool PlayFab::AdminModels::FAddNewsRequest::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
-PlayFab::AdminModels::FAddNewsResult::~FAddNewsResult()
+bool PlayFab::AdminModels::FAddNewsRequest::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::AdminModels::FAddNewsResult::writeJSON(JsonWriter& writer) const
-{
-    writer->WriteObjectStart();
+        if (reader.IsField("Body"))
+        {
+            reader.ReadValue(Body);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Timestamp"))
+        {
+            reader.ReadValue(Timestamp);
+        }
+        else if (reader.IsField("Title"))
+        {
+            reader.ReadValue(Title);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddNewsRequest();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::AdminModels::FAddNewsResult::~FAddNewsResult()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::AdminModels::FAddNewsResult::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
 
     if (NewsId.IsEmpty() == false)
     {
@@ -809,6 +1330,16 @@ void PlayFab::AdminModels::FAddNewsResult::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FAddNewsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FAddNewsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FAddNewsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -823,12 +1354,39 @@ bool PlayFab::AdminModels::FAddNewsResult::readFromValue(const TSharedPtr<FJsonO
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FAddNewsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("NewsId"))
+        {
+            reader.ReadValue(NewsId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddNewsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FAddPlayerTagRequest::~FAddPlayerTagRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FAddPlayerTagRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FAddPlayerTagRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -866,6 +1424,16 @@ void PlayFab::AdminModels::FAddPlayerTagRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FAddPlayerTagRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FAddPlayerTagRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FAddPlayerTagRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -875,7 +1443,7 @@ bool PlayFab::AdminModels::FAddPlayerTagRequest::readFromValue(const TSharedPtr<
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -896,18 +1464,70 @@ bool PlayFab::AdminModels::FAddPlayerTagRequest::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FAddPlayerTagRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("TagName"))
+        {
+            reader.ReadValue(TagName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddPlayerTagRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FAddPlayerTagResult::~FAddPlayerTagResult()
 {
 
 }
 
-void PlayFab::AdminModels::FAddPlayerTagResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FAddPlayerTagResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FAddPlayerTagResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FAddPlayerTagResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FAddPlayerTagResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -915,7 +1535,29 @@ bool PlayFab::AdminModels::FAddPlayerTagResult::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeRegionEnumJSON(Region enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FAddPlayerTagResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddPlayerTagResult();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeRegionEnumValue(AdminModels::Region enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -930,6 +1572,16 @@ void PlayFab::AdminModels::writeRegionEnumJSON(Region enumVal, JsonWriter& write
     }
 }
 
+void PlayFab::AdminModels::writeRegionEnumJSON(Region enumVal, JsonWriter& writer)
+{
+    writeRegionEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeRegionEnumJSON(Region enumVal, JsonUtf8Writer& writer)
+{
+    writeRegionEnumValue(enumVal, writer);
+}
+
 AdminModels::Region PlayFab::AdminModels::readRegionFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readRegionFromValue(value.IsValid() ? value->AsString() : "");
@@ -966,7 +1618,8 @@ PlayFab::AdminModels::FAddServerBuildRequest::~FAddServerBuildRequest()
 
 }
 
-void PlayFab::AdminModels::FAddServerBuildRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FAddServerBuildRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1027,6 +1680,16 @@ void PlayFab::AdminModels::FAddServerBuildRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FAddServerBuildRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FAddServerBuildRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FAddServerBuildRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1065,7 +1728,7 @@ bool PlayFab::AdminModels::FAddServerBuildRequest::readFromValue(const TSharedPt
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1093,7 +1756,76 @@ bool PlayFab::AdminModels::FAddServerBuildRequest::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeGameBuildStatusEnumJSON(GameBuildStatus enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FAddServerBuildRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ActiveRegions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ActiveRegions.Add(readRegionFromValue(TmpValue)); }
+                }
+            }
+        }
+        else if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("CommandLineTemplate"))
+        {
+            reader.ReadValue(CommandLineTemplate);
+        }
+        else if (reader.IsField("Comment"))
+        {
+            reader.ReadValue(Comment);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ExecutablePath"))
+        {
+            reader.ReadValue(ExecutablePath);
+        }
+        else if (reader.IsField("MaxGamesPerHost"))
+        {
+            reader.ReadValue(MaxGamesPerHost);
+        }
+        else if (reader.IsField("MinFreeGameSlots"))
+        {
+            reader.ReadValue(MinFreeGameSlots);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddServerBuildRequest();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeGameBuildStatusEnumValue(AdminModels::GameBuildStatus enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -1106,6 +1838,16 @@ void PlayFab::AdminModels::writeGameBuildStatusEnumJSON(GameBuildStatus enumVal,
     }
 }
 
+void PlayFab::AdminModels::writeGameBuildStatusEnumJSON(GameBuildStatus enumVal, JsonWriter& writer)
+{
+    writeGameBuildStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeGameBuildStatusEnumJSON(GameBuildStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeGameBuildStatusEnumValue(enumVal, writer);
+}
+
 AdminModels::GameBuildStatus PlayFab::AdminModels::readGameBuildStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readGameBuildStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -1140,7 +1882,8 @@ PlayFab::AdminModels::FAddServerBuildResult::~FAddServerBuildResult()
 
 }
 
-void PlayFab::AdminModels::FAddServerBuildResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FAddServerBuildResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1201,6 +1944,16 @@ void PlayFab::AdminModels::FAddServerBuildResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FAddServerBuildResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FAddServerBuildResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FAddServerBuildResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1272,12 +2025,83 @@ bool PlayFab::AdminModels::FAddServerBuildResult::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FAddServerBuildResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ActiveRegions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ActiveRegions.Add(readRegionFromValue(TmpValue)); }
+                }
+            }
+        }
+        else if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("CommandLineTemplate"))
+        {
+            reader.ReadValue(CommandLineTemplate);
+        }
+        else if (reader.IsField("Comment"))
+        {
+            reader.ReadValue(Comment);
+        }
+        else if (reader.IsField("ExecutablePath"))
+        {
+            reader.ReadValue(ExecutablePath);
+        }
+        else if (reader.IsField("MaxGamesPerHost"))
+        {
+            reader.ReadValue(MaxGamesPerHost);
+        }
+        else if (reader.IsField("MinFreeGameSlots"))
+        {
+            reader.ReadValue(MinFreeGameSlots);
+        }
+        else if (reader.IsField("Status"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Status = readGameBuildStatusFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Timestamp"))
+        {
+            reader.ReadValue(Timestamp);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddServerBuildResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FAddUserVirtualCurrencyRequest::~FAddUserVirtualCurrencyRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FAddUserVirtualCurrencyRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FAddUserVirtualCurrencyRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1318,6 +2142,16 @@ void PlayFab::AdminModels::FAddUserVirtualCurrencyRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FAddUserVirtualCurrencyRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FAddUserVirtualCurrencyRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FAddUserVirtualCurrencyRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1334,7 +2168,7 @@ bool PlayFab::AdminModels::FAddUserVirtualCurrencyRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1355,12 +2189,58 @@ bool PlayFab::AdminModels::FAddUserVirtualCurrencyRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FAddUserVirtualCurrencyRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Amount"))
+        {
+            reader.ReadValue(Amount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            reader.ReadValue(VirtualCurrency);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddUserVirtualCurrencyRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FVirtualCurrencyData::~FVirtualCurrencyData()
 {
 
 }
 
-void PlayFab::AdminModels::FVirtualCurrencyData::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FVirtualCurrencyData::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1401,6 +2281,16 @@ void PlayFab::AdminModels::FVirtualCurrencyData::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FVirtualCurrencyData::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FVirtualCurrencyData::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FVirtualCurrencyData::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1443,12 +2333,55 @@ bool PlayFab::AdminModels::FVirtualCurrencyData::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FVirtualCurrencyData::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CurrencyCode"))
+        {
+            reader.ReadValue(CurrencyCode);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("InitialDeposit"))
+        {
+            reader.ReadValue(InitialDeposit);
+        }
+        else if (reader.IsField("RechargeMax"))
+        {
+            reader.ReadValue(RechargeMax);
+        }
+        else if (reader.IsField("RechargeRate"))
+        {
+            reader.ReadValue(RechargeRate);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FVirtualCurrencyData();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FAddVirtualCurrencyTypesRequest::~FAddVirtualCurrencyTypesRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FAddVirtualCurrencyTypesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FAddVirtualCurrencyTypesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1461,6 +2394,16 @@ void PlayFab::AdminModels::FAddVirtualCurrencyTypesRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FAddVirtualCurrencyTypesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FAddVirtualCurrencyTypesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FAddVirtualCurrencyTypesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1469,25 +2412,69 @@ bool PlayFab::AdminModels::FAddVirtualCurrencyTypesRequest::readFromValue(const
     for (int32 Idx = 0; Idx < VirtualCurrenciesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = VirtualCurrenciesArray[Idx];
-        VirtualCurrencies.Add(FVirtualCurrencyData(CurrentItem->AsObject()));
+        VirtualCurrencies.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FAddVirtualCurrencyTypesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("VirtualCurrencies"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { VirtualCurrencies[VirtualCurrencies.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddVirtualCurrencyTypesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FAllPlayersSegmentFilter::~FAllPlayersSegmentFilter()
 {
 
 }
 
-void PlayFab::AdminModels::FAllPlayersSegmentFilter::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FAllPlayersSegmentFilter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FAllPlayersSegmentFilter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FAllPlayersSegmentFilter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FAllPlayersSegmentFilter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1495,17 +2482,49 @@ bool PlayFab::AdminModels::FAllPlayersSegmentFilter::readFromValue(const TShared
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeConditionalsEnumJSON(Conditionals enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FAllPlayersSegmentFilter::readFromReader(FPlayFabJsonPullReader& reader)
 {
-    switch (enumVal)
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
     {
+        if (reader.ReadNull())
+            continue;
 
-    case ConditionalsAny: writer->WriteValue(TEXT("Any")); break;
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAllPlayersSegmentFilter();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeConditionalsEnumValue(AdminModels::Conditionals enumVal, WriterType& writer)
+{
+    switch (enumVal)
+    {
+
+    case ConditionalsAny: writer->WriteValue(TEXT("Any")); break;
     case ConditionalsTrue: writer->WriteValue(TEXT("True")); break;
     case ConditionalsFalse: writer->WriteValue(TEXT("False")); break;
     }
 }
 
+void PlayFab::AdminModels::writeConditionalsEnumJSON(Conditionals enumVal, JsonWriter& writer)
+{
+    writeConditionalsEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeConditionalsEnumJSON(Conditionals enumVal, JsonUtf8Writer& writer)
+{
+    writeConditionalsEnumValue(enumVal, writer);
+}
+
 AdminModels::Conditionals PlayFab::AdminModels::readConditionalsFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readConditionalsFromValue(value.IsValid() ? value->AsString() : "");
@@ -1538,7 +2557,8 @@ PlayFab::AdminModels::FApiCondition::~FApiCondition()
 
 }
 
-void PlayFab::AdminModels::FApiCondition::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FApiCondition::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1551,6 +2571,16 @@ void PlayFab::AdminModels::FApiCondition::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FApiCondition::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FApiCondition::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FApiCondition::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1560,7 +2590,35 @@ bool PlayFab::AdminModels::FApiCondition::readFromValue(const TSharedPtr<FJsonOb
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeAuthTokenTypeEnumJSON(AuthTokenType enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FApiCondition::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("HasSignatureOrEncryption"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { HasSignatureOrEncryption = readConditionalsFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FApiCondition();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeAuthTokenTypeEnumValue(AdminModels::AuthTokenType enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -1569,6 +2627,16 @@ void PlayFab::AdminModels::writeAuthTokenTypeEnumJSON(AuthTokenType enumVal, Jso
     }
 }
 
+void PlayFab::AdminModels::writeAuthTokenTypeEnumJSON(AuthTokenType enumVal, JsonWriter& writer)
+{
+    writeAuthTokenTypeEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeAuthTokenTypeEnumJSON(AuthTokenType enumVal, JsonUtf8Writer& writer)
+{
+    writeAuthTokenTypeEnumValue(enumVal, writer);
+}
+
 AdminModels::AuthTokenType PlayFab::AdminModels::readAuthTokenTypeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readAuthTokenTypeFromValue(value.IsValid() ? value->AsString() : "");
@@ -1599,7 +2667,8 @@ PlayFab::AdminModels::FBanInfo::~FBanInfo()
 
 }
 
-void PlayFab::AdminModels::FBanInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FBanInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1651,6 +2720,16 @@ void PlayFab::AdminModels::FBanInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FBanInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FBanInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FBanInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1710,12 +2789,67 @@ bool PlayFab::AdminModels::FBanInfo::readFromValue(const TSharedPtr<FJsonObject>
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FBanInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Active"))
+        {
+            reader.ReadValue(Active);
+        }
+        else if (reader.IsField("BanId"))
+        {
+            reader.ReadValue(BanId);
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("Expires"))
+        {
+            reader.ReadValue(Expires);
+        }
+        else if (reader.IsField("IPAddress"))
+        {
+            reader.ReadValue(IPAddress);
+        }
+        else if (reader.IsField("MACAddress"))
+        {
+            reader.ReadValue(MACAddress);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Reason"))
+        {
+            reader.ReadValue(Reason);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FBanInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FBanPlayerSegmentAction::~FBanPlayerSegmentAction()
 {
 
 }
 
-void PlayFab::AdminModels::FBanPlayerSegmentAction::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FBanPlayerSegmentAction::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1734,6 +2868,16 @@ void PlayFab::AdminModels::FBanPlayerSegmentAction::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FBanPlayerSegmentAction::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FBanPlayerSegmentAction::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FBanPlayerSegmentAction::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1755,12 +2899,43 @@ bool PlayFab::AdminModels::FBanPlayerSegmentAction::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FBanPlayerSegmentAction::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BanHours"))
+        {
+            reader.ReadValue(BanHours);
+        }
+        else if (reader.IsField("ReasonForBan"))
+        {
+            reader.ReadValue(ReasonForBan);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FBanPlayerSegmentAction();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FBanRequest::~FBanRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FBanRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FBanRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1801,6 +2976,16 @@ void PlayFab::AdminModels::FBanRequest::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FBanRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FBanRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FBanRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1843,12 +3028,55 @@ bool PlayFab::AdminModels::FBanRequest::readFromValue(const TSharedPtr<FJsonObje
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FBanRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DurationInHours"))
+        {
+            reader.ReadValue(DurationInHours);
+        }
+        else if (reader.IsField("IPAddress"))
+        {
+            reader.ReadValue(IPAddress);
+        }
+        else if (reader.IsField("MACAddress"))
+        {
+            reader.ReadValue(MACAddress);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Reason"))
+        {
+            reader.ReadValue(Reason);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FBanRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FBanUsersRequest::~FBanUsersRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FBanUsersRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FBanUsersRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1872,6 +3100,16 @@ void PlayFab::AdminModels::FBanUsersRequest::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FBanUsersRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FBanUsersRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FBanUsersRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1880,7 +3118,7 @@ bool PlayFab::AdminModels::FBanUsersRequest::readFromValue(const TSharedPtr<FJso
     for (int32 Idx = 0; Idx < BansArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BansArray[Idx];
-        Bans.Add(FBanRequest(CurrentItem->AsObject()));
+        Bans.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -1889,19 +3127,64 @@ bool PlayFab::AdminModels::FBanUsersRequest::readFromValue(const TSharedPtr<FJso
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FBanUsersRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Bans"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Bans[Bans.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FBanUsersRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FBanUsersResult::~FBanUsersResult()
 {
 
 }
 
-void PlayFab::AdminModels::FBanUsersResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FBanUsersResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1917,6 +3200,16 @@ void PlayFab::AdminModels::FBanUsersResult::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FBanUsersResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FBanUsersResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FBanUsersResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1925,25 +3218,69 @@ bool PlayFab::AdminModels::FBanUsersResult::readFromValue(const TSharedPtr<FJson
     for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
+        BanData.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FBanUsersResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BanData"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { BanData[BanData.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FBanUsersResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FBlankResult::~FBlankResult()
 {
 
 }
 
-void PlayFab::AdminModels::FBlankResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FBlankResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FBlankResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FBlankResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FBlankResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1951,12 +3288,34 @@ bool PlayFab::AdminModels::FBlankResult::readFromValue(const TSharedPtr<FJsonObj
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FBlankResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FBlankResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FCatalogItemBundleInfo::~FCatalogItemBundleInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FCatalogItemBundleInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCatalogItemBundleInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1992,6 +3351,16 @@ void PlayFab::AdminModels::FCatalogItemBundleInfo::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCatalogItemBundleInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCatalogItemBundleInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCatalogItemBundleInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2006,19 +3375,75 @@ bool PlayFab::AdminModels::FCatalogItemBundleInfo::readFromValue(const TSharedPt
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*BundledVirtualCurrenciesObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            BundledVirtualCurrencies.Add(It.Key(), TmpValue);
+            BundledVirtualCurrencies.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FCatalogItemBundleInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BundledItems"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { BundledItems.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("BundledResultTables"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { BundledResultTables.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("BundledVirtualCurrencies"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { BundledVirtualCurrencies.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCatalogItemBundleInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FCatalogItemConsumableInfo::~FCatalogItemConsumableInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FCatalogItemConsumableInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCatalogItemConsumableInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2043,6 +3468,16 @@ void PlayFab::AdminModels::FCatalogItemConsumableInfo::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCatalogItemConsumableInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCatalogItemConsumableInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCatalogItemConsumableInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2071,12 +3506,47 @@ bool PlayFab::AdminModels::FCatalogItemConsumableInfo::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FCatalogItemConsumableInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("UsageCount"))
+        {
+            reader.ReadValue(UsageCount);
+        }
+        else if (reader.IsField("UsagePeriod"))
+        {
+            reader.ReadValue(UsagePeriod);
+        }
+        else if (reader.IsField("UsagePeriodGroup"))
+        {
+            reader.ReadValue(UsagePeriodGroup);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCatalogItemConsumableInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FCatalogItemContainerInfo::~FCatalogItemContainerInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FCatalogItemContainerInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCatalogItemContainerInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2118,6 +3588,16 @@ void PlayFab::AdminModels::FCatalogItemContainerInfo::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCatalogItemContainerInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCatalogItemContainerInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCatalogItemContainerInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2139,24 +3619,84 @@ bool PlayFab::AdminModels::FCatalogItemContainerInfo::readFromValue(const TShare
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyContentsObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrencyContents.Add(It.Key(), TmpValue);
+            VirtualCurrencyContents.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
-PlayFab::AdminModels::FCatalogItem::~FCatalogItem()
+bool PlayFab::AdminModels::FCatalogItemContainerInfo::readFromReader(FPlayFabJsonPullReader& reader)
 {
-    //if (Bundle != nullptr) delete Bundle;
-    //if (Consumable != nullptr) delete Consumable;
-    //if (Container != nullptr) delete Container;
-
-}
+    if (!reader.ReadObjectStart())
+        return false;
 
-void PlayFab::AdminModels::FCatalogItem::writeJSON(JsonWriter& writer) const
-{
-    writer->WriteObjectStart();
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ItemContents"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ItemContents.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("KeyItemId"))
+        {
+            reader.ReadValue(KeyItemId);
+        }
+        else if (reader.IsField("ResultTableContents"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ResultTableContents.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyContents"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrencyContents.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCatalogItemContainerInfo();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::AdminModels::FCatalogItem::~FCatalogItem()
+{
+    //if (Bundle != nullptr) delete Bundle;
+    //if (Consumable != nullptr) delete Consumable;
+    //if (Container != nullptr) delete Container;
+
+}
+
+template <typename WriterType>
+void PlayFab::AdminModels::FCatalogItem::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
 
     if (Bundle.IsValid())
     {
@@ -2271,6 +3811,16 @@ void PlayFab::AdminModels::FCatalogItem::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCatalogItem::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCatalogItem::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2278,7 +3828,7 @@ bool PlayFab::AdminModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonObj
     const TSharedPtr<FJsonValue> BundleValue = obj->TryGetField(TEXT("Bundle"));
     if (BundleValue.IsValid() && !BundleValue->IsNull())
     {
-        Bundle = MakeShareable(new FCatalogItemBundleInfo(BundleValue->AsObject()));
+        Bundle = MakeShared<FCatalogItemBundleInfo>(BundleValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> CanBecomeCharacterValue = obj->TryGetField(TEXT("CanBecomeCharacter"));
@@ -2298,13 +3848,13 @@ bool PlayFab::AdminModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonObj
     const TSharedPtr<FJsonValue> ConsumableValue = obj->TryGetField(TEXT("Consumable"));
     if (ConsumableValue.IsValid() && !ConsumableValue->IsNull())
     {
-        Consumable = MakeShareable(new FCatalogItemConsumableInfo(ConsumableValue->AsObject()));
+        Consumable = MakeShared<FCatalogItemConsumableInfo>(ConsumableValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ContainerValue = obj->TryGetField(TEXT("Container"));
     if (ContainerValue.IsValid() && !ContainerValue->IsNull())
     {
-        Container = MakeShareable(new FCatalogItemContainerInfo(ContainerValue->AsObject()));
+        Container = MakeShared<FCatalogItemContainerInfo>(ContainerValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> CustomDataValue = obj->TryGetField(TEXT("CustomData"));
@@ -2383,7 +3933,7 @@ bool PlayFab::AdminModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonObj
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*RealCurrencyPricesObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            RealCurrencyPrices.Add(It.Key(), TmpValue);
+            RealCurrencyPrices.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -2395,19 +3945,138 @@ bool PlayFab::AdminModels::FCatalogItem::readFromValue(const TSharedPtr<FJsonObj
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyPricesObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrencyPrices.Add(It.Key(), TmpValue);
+            VirtualCurrencyPrices.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FCatalogItem::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Bundle"))
+        {
+            Bundle = MakeShared<FCatalogItemBundleInfo>();
+            Bundle->readFromReader(reader);
+        }
+        else if (reader.IsField("CanBecomeCharacter"))
+        {
+            reader.ReadValue(CanBecomeCharacter);
+        }
+        else if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("Consumable"))
+        {
+            Consumable = MakeShared<FCatalogItemConsumableInfo>();
+            Consumable->readFromReader(reader);
+        }
+        else if (reader.IsField("Container"))
+        {
+            Container = MakeShared<FCatalogItemContainerInfo>();
+            Container->readFromReader(reader);
+        }
+        else if (reader.IsField("CustomData"))
+        {
+            reader.ReadValue(CustomData);
+        }
+        else if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("InitialLimitedEditionCount"))
+        {
+            reader.ReadValue(InitialLimitedEditionCount);
+        }
+        else if (reader.IsField("IsLimitedEdition"))
+        {
+            reader.ReadValue(IsLimitedEdition);
+        }
+        else if (reader.IsField("IsStackable"))
+        {
+            reader.ReadValue(IsStackable);
+        }
+        else if (reader.IsField("IsTradable"))
+        {
+            reader.ReadValue(IsTradable);
+        }
+        else if (reader.IsField("ItemClass"))
+        {
+            reader.ReadValue(ItemClass);
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else if (reader.IsField("ItemImageUrl"))
+        {
+            reader.ReadValue(ItemImageUrl);
+        }
+        else if (reader.IsField("RealCurrencyPrices"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { RealCurrencyPrices.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Tags.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyPrices"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrencyPrices.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCatalogItem();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FCheckLimitedEditionItemAvailabilityRequest::~FCheckLimitedEditionItemAvailabilityRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FCheckLimitedEditionItemAvailabilityRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCheckLimitedEditionItemAvailabilityRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2430,6 +4099,16 @@ void PlayFab::AdminModels::FCheckLimitedEditionItemAvailabilityRequest::writeJSO
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCheckLimitedEditionItemAvailabilityRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCheckLimitedEditionItemAvailabilityRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCheckLimitedEditionItemAvailabilityRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2451,12 +4130,43 @@ bool PlayFab::AdminModels::FCheckLimitedEditionItemAvailabilityRequest::readFrom
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FCheckLimitedEditionItemAvailabilityRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCheckLimitedEditionItemAvailabilityRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FCheckLimitedEditionItemAvailabilityResult::~FCheckLimitedEditionItemAvailabilityResult()
 {
 
 }
 
-void PlayFab::AdminModels::FCheckLimitedEditionItemAvailabilityResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCheckLimitedEditionItemAvailabilityResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2466,6 +4176,16 @@ void PlayFab::AdminModels::FCheckLimitedEditionItemAvailabilityResult::writeJSON
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCheckLimitedEditionItemAvailabilityResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCheckLimitedEditionItemAvailabilityResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCheckLimitedEditionItemAvailabilityResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2480,12 +4200,39 @@ bool PlayFab::AdminModels::FCheckLimitedEditionItemAvailabilityResult::readFromV
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FCheckLimitedEditionItemAvailabilityResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Amount"))
+        {
+            reader.ReadValue(Amount);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCheckLimitedEditionItemAvailabilityResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FCloudScriptFile::~FCloudScriptFile()
 {
 
 }
 
-void PlayFab::AdminModels::FCloudScriptFile::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCloudScriptFile::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2512,6 +4259,16 @@ void PlayFab::AdminModels::FCloudScriptFile::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCloudScriptFile::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCloudScriptFile::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCloudScriptFile::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2533,12 +4290,43 @@ bool PlayFab::AdminModels::FCloudScriptFile::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FCloudScriptFile::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FileContents"))
+        {
+            reader.ReadValue(FileContents);
+        }
+        else if (reader.IsField("Filename"))
+        {
+            reader.ReadValue(Filename);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCloudScriptFile();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FCloudScriptTaskParameter::~FCloudScriptTaskParameter()
 {
 
 }
 
-void PlayFab::AdminModels::FCloudScriptTaskParameter::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCloudScriptTaskParameter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2557,6 +4345,16 @@ void PlayFab::AdminModels::FCloudScriptTaskParameter::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCloudScriptTaskParameter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCloudScriptTaskParameter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCloudScriptTaskParameter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2577,12 +4375,43 @@ bool PlayFab::AdminModels::FCloudScriptTaskParameter::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FCloudScriptTaskParameter::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Argument"))
+        {
+            Argument.readFromReader(reader);
+        }
+        else if (reader.IsField("FunctionName"))
+        {
+            reader.ReadValue(FunctionName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCloudScriptTaskParameter();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FScriptExecutionError::~FScriptExecutionError()
 {
 
 }
 
-void PlayFab::AdminModels::FScriptExecutionError::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FScriptExecutionError::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2607,6 +4436,16 @@ void PlayFab::AdminModels::FScriptExecutionError::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FScriptExecutionError::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FScriptExecutionError::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FScriptExecutionError::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2635,12 +4474,47 @@ bool PlayFab::AdminModels::FScriptExecutionError::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FScriptExecutionError::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Error"))
+        {
+            reader.ReadValue(Error);
+        }
+        else if (reader.IsField("Message"))
+        {
+            reader.ReadValue(Message);
+        }
+        else if (reader.IsField("StackTrace"))
+        {
+            reader.ReadValue(StackTrace);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FScriptExecutionError();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FLogStatement::~FLogStatement()
 {
 
 }
 
-void PlayFab::AdminModels::FLogStatement::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FLogStatement::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2665,6 +4539,16 @@ void PlayFab::AdminModels::FLogStatement::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FLogStatement::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FLogStatement::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FLogStatement::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2692,13 +4576,48 @@ bool PlayFab::AdminModels::FLogStatement::readFromValue(const TSharedPtr<FJsonOb
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FLogStatement::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            Data.readFromReader(reader);
+        }
+        else if (reader.IsField("Level"))
+        {
+            reader.ReadValue(Level);
+        }
+        else if (reader.IsField("Message"))
+        {
+            reader.ReadValue(Message);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLogStatement();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FExecuteCloudScriptResult::~FExecuteCloudScriptResult()
 {
     //if (Error != nullptr) delete Error;
 
 }
 
-void PlayFab::AdminModels::FExecuteCloudScriptResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FExecuteCloudScriptResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2762,6 +4681,16 @@ void PlayFab::AdminModels::FExecuteCloudScriptResult::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FExecuteCloudScriptResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FExecuteCloudScriptResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FExecuteCloudScriptResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2776,7 +4705,7 @@ bool PlayFab::AdminModels::FExecuteCloudScriptResult::readFromValue(const TShare
     const TSharedPtr<FJsonValue> ErrorValue = obj->TryGetField(TEXT("Error"));
     if (ErrorValue.IsValid() && !ErrorValue->IsNull())
     {
-        Error = MakeShareable(new FScriptExecutionError(ErrorValue->AsObject()));
+        Error = MakeShared<FScriptExecutionError>(ErrorValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ExecutionTimeSecondsValue = obj->TryGetField(TEXT("ExecutionTimeSeconds"));
@@ -2817,7 +4746,7 @@ bool PlayFab::AdminModels::FExecuteCloudScriptResult::readFromValue(const TShare
     for (int32 Idx = 0; Idx < LogsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LogsArray[Idx];
-        Logs.Add(FLogStatement(CurrentItem->AsObject()));
+        Logs.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2852,6 +4781,84 @@ bool PlayFab::AdminModels::FExecuteCloudScriptResult::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FExecuteCloudScriptResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("APIRequestsIssued"))
+        {
+            reader.ReadValue(APIRequestsIssued);
+        }
+        else if (reader.IsField("Error"))
+        {
+            Error = MakeShared<FScriptExecutionError>();
+            Error->readFromReader(reader);
+        }
+        else if (reader.IsField("ExecutionTimeSeconds"))
+        {
+            reader.ReadValue(ExecutionTimeSeconds);
+        }
+        else if (reader.IsField("FunctionName"))
+        {
+            reader.ReadValue(FunctionName);
+        }
+        else if (reader.IsField("FunctionResult"))
+        {
+            FunctionResult.readFromReader(reader);
+        }
+        else if (reader.IsField("FunctionResultTooLarge"))
+        {
+            reader.ReadValue(FunctionResultTooLarge);
+        }
+        else if (reader.IsField("HttpRequestsIssued"))
+        {
+            reader.ReadValue(HttpRequestsIssued);
+        }
+        else if (reader.IsField("Logs"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Logs[Logs.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("LogsTooLarge"))
+        {
+            reader.ReadValue(LogsTooLarge);
+        }
+        else if (reader.IsField("MemoryConsumedBytes"))
+        {
+            reader.ReadValue(MemoryConsumedBytes);
+        }
+        else if (reader.IsField("ProcessorTimeSeconds"))
+        {
+            reader.ReadValue(ProcessorTimeSeconds);
+        }
+        else if (reader.IsField("Revision"))
+        {
+            reader.ReadValue(Revision);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FExecuteCloudScriptResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FCloudScriptTaskSummary::~FCloudScriptTaskSummary()
 {
     //if (Result != nullptr) delete Result;
@@ -2859,7 +4866,8 @@ PlayFab::AdminModels::FCloudScriptTaskSummary::~FCloudScriptTaskSummary()
 
 }
 
-void PlayFab::AdminModels::FCloudScriptTaskSummary::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCloudScriptTaskSummary::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2917,7 +4925,17 @@ void PlayFab::AdminModels::FCloudScriptTaskSummary::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
-bool PlayFab::AdminModels::FCloudScriptTaskSummary::readFromValue(const TSharedPtr<FJsonObject>& obj)
+void PlayFab::AdminModels::FCloudScriptTaskSummary::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCloudScriptTaskSummary::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
+bool PlayFab::AdminModels::FCloudScriptTaskSummary::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
 
@@ -2943,7 +4961,7 @@ bool PlayFab::AdminModels::FCloudScriptTaskSummary::readFromValue(const TSharedP
     const TSharedPtr<FJsonValue> ResultValue = obj->TryGetField(TEXT("Result"));
     if (ResultValue.IsValid() && !ResultValue->IsNull())
     {
-        Result = MakeShareable(new FExecuteCloudScriptResult(ResultValue->AsObject()));
+        Result = MakeShared<FExecuteCloudScriptResult>(ResultValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ScheduledByUserIdValue = obj->TryGetField(TEXT("ScheduledByUserId"));
@@ -2963,7 +4981,7 @@ bool PlayFab::AdminModels::FCloudScriptTaskSummary::readFromValue(const TSharedP
     const TSharedPtr<FJsonValue> TaskIdentifierValue = obj->TryGetField(TEXT("TaskIdentifier"));
     if (TaskIdentifierValue.IsValid() && !TaskIdentifierValue->IsNull())
     {
-        TaskIdentifier = MakeShareable(new FNameIdentifier(TaskIdentifierValue->AsObject()));
+        TaskIdentifier = MakeShared<FNameIdentifier>(TaskIdentifierValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> TaskInstanceIdValue = obj->TryGetField(TEXT("TaskInstanceId"));
@@ -2976,12 +4994,74 @@ bool PlayFab::AdminModels::FCloudScriptTaskSummary::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FCloudScriptTaskSummary::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CompletedAt"))
+        {
+            reader.ReadValue(CompletedAt);
+        }
+        else if (reader.IsField("EstimatedSecondsRemaining"))
+        {
+            reader.ReadValue(EstimatedSecondsRemaining);
+        }
+        else if (reader.IsField("PercentComplete"))
+        {
+            reader.ReadValue(PercentComplete);
+        }
+        else if (reader.IsField("Result"))
+        {
+            Result = MakeShared<FExecuteCloudScriptResult>();
+            Result->readFromReader(reader);
+        }
+        else if (reader.IsField("ScheduledByUserId"))
+        {
+            reader.ReadValue(ScheduledByUserId);
+        }
+        else if (reader.IsField("StartedAt"))
+        {
+            reader.ReadValue(StartedAt);
+        }
+        else if (reader.IsField("Status"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Status = readTaskInstanceStatusFromValue(TmpValue); }
+        }
+        else if (reader.IsField("TaskIdentifier"))
+        {
+            TaskIdentifier = MakeShared<FNameIdentifier>();
+            TaskIdentifier->readFromReader(reader);
+        }
+        else if (reader.IsField("TaskInstanceId"))
+        {
+            reader.ReadValue(TaskInstanceId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCloudScriptTaskSummary();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FCloudScriptVersionStatus::~FCloudScriptVersionStatus()
 {
 
 }
 
-void PlayFab::AdminModels::FCloudScriptVersionStatus::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCloudScriptVersionStatus::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2997,6 +5077,16 @@ void PlayFab::AdminModels::FCloudScriptVersionStatus::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCloudScriptVersionStatus::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCloudScriptVersionStatus::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCloudScriptVersionStatus::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3025,7 +5115,42 @@ bool PlayFab::AdminModels::FCloudScriptVersionStatus::readFromValue(const TShare
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FCloudScriptVersionStatus::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("LatestRevision"))
+        {
+            reader.ReadValue(LatestRevision);
+        }
+        else if (reader.IsField("PublishedRevision"))
+        {
+            reader.ReadValue(PublishedRevision);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCloudScriptVersionStatus();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeEmailVerificationStatusEnumValue(AdminModels::EmailVerificationStatus enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -3036,6 +5161,16 @@ void PlayFab::AdminModels::writeEmailVerificationStatusEnumJSON(EmailVerificatio
     }
 }
 
+void PlayFab::AdminModels::writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonWriter& writer)
+{
+    writeEmailVerificationStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeEmailVerificationStatusEnumValue(enumVal, writer);
+}
+
 AdminModels::EmailVerificationStatus PlayFab::AdminModels::readEmailVerificationStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readEmailVerificationStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -3068,7 +5203,8 @@ PlayFab::AdminModels::FContactEmailInfo::~FContactEmailInfo()
 
 }
 
-void PlayFab::AdminModels::FContactEmailInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FContactEmailInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3093,6 +5229,16 @@ void PlayFab::AdminModels::FContactEmailInfo::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FContactEmailInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FContactEmailInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FContactEmailInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3116,12 +5262,48 @@ bool PlayFab::AdminModels::FContactEmailInfo::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FContactEmailInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("EmailAddress"))
+        {
+            reader.ReadValue(EmailAddress);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("VerificationStatus"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { VerificationStatus = readEmailVerificationStatusFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FContactEmailInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FContactEmailInfoModel::~FContactEmailInfoModel()
 {
 
 }
 
-void PlayFab::AdminModels::FContactEmailInfoModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FContactEmailInfoModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3146,6 +5328,16 @@ void PlayFab::AdminModels::FContactEmailInfoModel::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FContactEmailInfoModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FContactEmailInfoModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FContactEmailInfoModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3169,12 +5361,48 @@ bool PlayFab::AdminModels::FContactEmailInfoModel::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FContactEmailInfoModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("EmailAddress"))
+        {
+            reader.ReadValue(EmailAddress);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("VerificationStatus"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { VerificationStatus = readEmailVerificationStatusFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FContactEmailInfoModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FContentInfo::~FContentInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FContentInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FContentInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3193,6 +5421,16 @@ void PlayFab::AdminModels::FContentInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FContentInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FContentInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FContentInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3219,7 +5457,42 @@ bool PlayFab::AdminModels::FContentInfo::readFromValue(const TSharedPtr<FJsonObj
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeContinentCodeEnumJSON(ContinentCode enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FContentInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Key"))
+        {
+            reader.ReadValue(Key);
+        }
+        else if (reader.IsField("LastModified"))
+        {
+            reader.ReadValue(LastModified);
+        }
+        else if (reader.IsField("Size"))
+        {
+            reader.ReadValue(Size);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FContentInfo();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeContinentCodeEnumValue(AdminModels::ContinentCode enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -3234,6 +5507,16 @@ void PlayFab::AdminModels::writeContinentCodeEnumJSON(ContinentCode enumVal, Jso
     }
 }
 
+void PlayFab::AdminModels::writeContinentCodeEnumJSON(ContinentCode enumVal, JsonWriter& writer)
+{
+    writeContinentCodeEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeContinentCodeEnumJSON(ContinentCode enumVal, JsonUtf8Writer& writer)
+{
+    writeContinentCodeEnumValue(enumVal, writer);
+}
+
 AdminModels::ContinentCode PlayFab::AdminModels::readContinentCodeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readContinentCodeFromValue(value.IsValid() ? value->AsString() : "");
@@ -3265,7 +5548,8 @@ AdminModels::ContinentCode PlayFab::AdminModels::readContinentCodeFromValue(cons
     return ContinentCodeAF; // Basically critical fail
 }
 
-void PlayFab::AdminModels::writeCountryCodeEnumJSON(CountryCode enumVal, JsonWriter& writer)
+template <typename WriterType>
+static void writeCountryCodeEnumValue(AdminModels::CountryCode enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -3522,6 +5806,16 @@ void PlayFab::AdminModels::writeCountryCodeEnumJSON(CountryCode enumVal, JsonWri
     }
 }
 
+void PlayFab::AdminModels::writeCountryCodeEnumJSON(CountryCode enumVal, JsonWriter& writer)
+{
+    writeCountryCodeEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeCountryCodeEnumJSON(CountryCode enumVal, JsonUtf8Writer& writer)
+{
+    writeCountryCodeEnumValue(enumVal, writer);
+}
+
 AdminModels::CountryCode PlayFab::AdminModels::readCountryCodeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readCountryCodeFromValue(value.IsValid() ? value->AsString() : "");
@@ -3800,7 +6094,8 @@ PlayFab::AdminModels::FCreateActionsOnPlayerSegmentTaskRequest::~FCreateActionsO
 
 }
 
-void PlayFab::AdminModels::FCreateActionsOnPlayerSegmentTaskRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCreateActionsOnPlayerSegmentTaskRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3846,6 +6141,16 @@ void PlayFab::AdminModels::FCreateActionsOnPlayerSegmentTaskRequest::writeJSON(J
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCreateActionsOnPlayerSegmentTaskRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCreateActionsOnPlayerSegmentTaskRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCreateActionsOnPlayerSegmentTaskRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3855,7 +6160,7 @@ bool PlayFab::AdminModels::FCreateActionsOnPlayerSegmentTaskRequest::readFromVal
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -3896,12 +6201,66 @@ bool PlayFab::AdminModels::FCreateActionsOnPlayerSegmentTaskRequest::readFromVal
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FCreateActionsOnPlayerSegmentTaskRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("IsActive"))
+        {
+            reader.ReadValue(IsActive);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("Parameter"))
+        {
+            Parameter.readFromReader(reader);
+        }
+        else if (reader.IsField("Schedule"))
+        {
+            reader.ReadValue(Schedule);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateActionsOnPlayerSegmentTaskRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FCreateCloudScriptTaskRequest::~FCreateCloudScriptTaskRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FCreateCloudScriptTaskRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCreateCloudScriptTaskRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3947,6 +6306,16 @@ void PlayFab::AdminModels::FCreateCloudScriptTaskRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCreateCloudScriptTaskRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCreateCloudScriptTaskRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCreateCloudScriptTaskRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3956,7 +6325,7 @@ bool PlayFab::AdminModels::FCreateCloudScriptTaskRequest::readFromValue(const TS
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -3997,12 +6366,66 @@ bool PlayFab::AdminModels::FCreateCloudScriptTaskRequest::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FCreateCloudScriptTaskRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("IsActive"))
+        {
+            reader.ReadValue(IsActive);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("Parameter"))
+        {
+            Parameter.readFromReader(reader);
+        }
+        else if (reader.IsField("Schedule"))
+        {
+            reader.ReadValue(Schedule);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateCloudScriptTaskRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FInsightsScalingTaskParameter::~FInsightsScalingTaskParameter()
 {
 
 }
 
-void PlayFab::AdminModels::FInsightsScalingTaskParameter::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FInsightsScalingTaskParameter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4012,6 +6435,16 @@ void PlayFab::AdminModels::FInsightsScalingTaskParameter::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FInsightsScalingTaskParameter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FInsightsScalingTaskParameter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FInsightsScalingTaskParameter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4026,12 +6459,39 @@ bool PlayFab::AdminModels::FInsightsScalingTaskParameter::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FInsightsScalingTaskParameter::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Level"))
+        {
+            reader.ReadValue(Level);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FInsightsScalingTaskParameter();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FCreateInsightsScheduledScalingTaskRequest::~FCreateInsightsScheduledScalingTaskRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FCreateInsightsScheduledScalingTaskRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCreateInsightsScheduledScalingTaskRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4077,6 +6537,16 @@ void PlayFab::AdminModels::FCreateInsightsScheduledScalingTaskRequest::writeJSON
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCreateInsightsScheduledScalingTaskRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCreateInsightsScheduledScalingTaskRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCreateInsightsScheduledScalingTaskRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4086,7 +6556,7 @@ bool PlayFab::AdminModels::FCreateInsightsScheduledScalingTaskRequest::readFromV
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -4127,20 +6597,74 @@ bool PlayFab::AdminModels::FCreateInsightsScheduledScalingTaskRequest::readFromV
     return HasSucceeded;
 }
 
-PlayFab::AdminModels::FOpenIdIssuerInformation::~FOpenIdIssuerInformation()
-{
-
-}
-
-void PlayFab::AdminModels::FOpenIdIssuerInformation::writeJSON(JsonWriter& writer) const
+bool PlayFab::AdminModels::FCreateInsightsScheduledScalingTaskRequest::readFromReader(FPlayFabJsonPullReader& reader)
 {
-    writer->WriteObjectStart();
+    if (!reader.ReadObjectStart())
+        return false;
 
-    if (!AuthorizationUrl.IsEmpty() == false)
-    {
-        UE_LOG(LogTemp, Error, TEXT("This field is required: OpenIdIssuerInformation::AuthorizationUrl, PlayFab calls may not work if it remains empty."));
-    }
-    else
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("IsActive"))
+        {
+            reader.ReadValue(IsActive);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("Parameter"))
+        {
+            Parameter.readFromReader(reader);
+        }
+        else if (reader.IsField("Schedule"))
+        {
+            reader.ReadValue(Schedule);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateInsightsScheduledScalingTaskRequest();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::AdminModels::FOpenIdIssuerInformation::~FOpenIdIssuerInformation()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::AdminModels::FOpenIdIssuerInformation::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
+
+    if (!AuthorizationUrl.IsEmpty() == false)
+    {
+        UE_LOG(LogTemp, Error, TEXT("This field is required: OpenIdIssuerInformation::AuthorizationUrl, PlayFab calls may not work if it remains empty."));
+    }
+    else
     {
         writer->WriteIdentifierPrefix(TEXT("AuthorizationUrl"));
         writer->WriteValue(AuthorizationUrl);
@@ -4172,6 +6696,16 @@ void PlayFab::AdminModels::FOpenIdIssuerInformation::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FOpenIdIssuerInformation::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FOpenIdIssuerInformation::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FOpenIdIssuerInformation::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4206,13 +6740,52 @@ bool PlayFab::AdminModels::FOpenIdIssuerInformation::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FOpenIdIssuerInformation::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AuthorizationUrl"))
+        {
+            reader.ReadValue(AuthorizationUrl);
+        }
+        else if (reader.IsField("Issuer"))
+        {
+            reader.ReadValue(Issuer);
+        }
+        else if (reader.IsField("JsonWebKeySet"))
+        {
+            JsonWebKeySet.readFromReader(reader);
+        }
+        else if (reader.IsField("TokenUrl"))
+        {
+            reader.ReadValue(TokenUrl);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FOpenIdIssuerInformation();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FCreateOpenIdConnectionRequest::~FCreateOpenIdConnectionRequest()
 {
     //if (IssuerInformation != nullptr) delete IssuerInformation;
 
 }
 
-void PlayFab::AdminModels::FCreateOpenIdConnectionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCreateOpenIdConnectionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4267,6 +6840,16 @@ void PlayFab::AdminModels::FCreateOpenIdConnectionRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCreateOpenIdConnectionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCreateOpenIdConnectionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCreateOpenIdConnectionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4309,18 +6892,66 @@ bool PlayFab::AdminModels::FCreateOpenIdConnectionRequest::readFromValue(const T
     const TSharedPtr<FJsonValue> IssuerInformationValue = obj->TryGetField(TEXT("IssuerInformation"));
     if (IssuerInformationValue.IsValid() && !IssuerInformationValue->IsNull())
     {
-        IssuerInformation = MakeShareable(new FOpenIdIssuerInformation(IssuerInformationValue->AsObject()));
+        IssuerInformation = MakeShared<FOpenIdIssuerInformation>(IssuerInformationValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FCreateOpenIdConnectionRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ClientId"))
+        {
+            reader.ReadValue(ClientId);
+        }
+        else if (reader.IsField("ClientSecret"))
+        {
+            reader.ReadValue(ClientSecret);
+        }
+        else if (reader.IsField("ConnectionId"))
+        {
+            reader.ReadValue(ConnectionId);
+        }
+        else if (reader.IsField("IgnoreNonce"))
+        {
+            reader.ReadValue(IgnoreNonce);
+        }
+        else if (reader.IsField("IssuerDiscoveryUrl"))
+        {
+            reader.ReadValue(IssuerDiscoveryUrl);
+        }
+        else if (reader.IsField("IssuerInformation"))
+        {
+            IssuerInformation = MakeShared<FOpenIdIssuerInformation>();
+            IssuerInformation->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateOpenIdConnectionRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FCreatePlayerSharedSecretRequest::~FCreatePlayerSharedSecretRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FCreatePlayerSharedSecretRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCreatePlayerSharedSecretRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4333,6 +6964,16 @@ void PlayFab::AdminModels::FCreatePlayerSharedSecretRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCreatePlayerSharedSecretRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCreatePlayerSharedSecretRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCreatePlayerSharedSecretRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4347,12 +6988,39 @@ bool PlayFab::AdminModels::FCreatePlayerSharedSecretRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FCreatePlayerSharedSecretRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FriendlyName"))
+        {
+            reader.ReadValue(FriendlyName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreatePlayerSharedSecretRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FCreatePlayerSharedSecretResult::~FCreatePlayerSharedSecretResult()
 {
 
 }
 
-void PlayFab::AdminModels::FCreatePlayerSharedSecretResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCreatePlayerSharedSecretResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4365,6 +7033,16 @@ void PlayFab::AdminModels::FCreatePlayerSharedSecretResult::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCreatePlayerSharedSecretResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCreatePlayerSharedSecretResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCreatePlayerSharedSecretResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4379,7 +7057,34 @@ bool PlayFab::AdminModels::FCreatePlayerSharedSecretResult::readFromValue(const
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeStatisticAggregationMethodEnumJSON(StatisticAggregationMethod enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FCreatePlayerSharedSecretResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SecretKey"))
+        {
+            reader.ReadValue(SecretKey);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreatePlayerSharedSecretResult();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeStatisticAggregationMethodEnumValue(AdminModels::StatisticAggregationMethod enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -4391,6 +7096,16 @@ void PlayFab::AdminModels::writeStatisticAggregationMethodEnumJSON(StatisticAggr
     }
 }
 
+void PlayFab::AdminModels::writeStatisticAggregationMethodEnumJSON(StatisticAggregationMethod enumVal, JsonWriter& writer)
+{
+    writeStatisticAggregationMethodEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeStatisticAggregationMethodEnumJSON(StatisticAggregationMethod enumVal, JsonUtf8Writer& writer)
+{
+    writeStatisticAggregationMethodEnumValue(enumVal, writer);
+}
+
 AdminModels::StatisticAggregationMethod PlayFab::AdminModels::readStatisticAggregationMethodFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readStatisticAggregationMethodFromValue(value.IsValid() ? value->AsString() : "");
@@ -4419,7 +7134,8 @@ AdminModels::StatisticAggregationMethod PlayFab::AdminModels::readStatisticAggre
     return StatisticAggregationMethodLast; // Basically critical fail
 }
 
-void PlayFab::AdminModels::writeStatisticResetIntervalOptionEnumJSON(StatisticResetIntervalOption enumVal, JsonWriter& writer)
+template <typename WriterType>
+static void writeStatisticResetIntervalOptionEnumValue(AdminModels::StatisticResetIntervalOption enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -4432,6 +7148,16 @@ void PlayFab::AdminModels::writeStatisticResetIntervalOptionEnumJSON(StatisticRe
     }
 }
 
+void PlayFab::AdminModels::writeStatisticResetIntervalOptionEnumJSON(StatisticResetIntervalOption enumVal, JsonWriter& writer)
+{
+    writeStatisticResetIntervalOptionEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeStatisticResetIntervalOptionEnumJSON(StatisticResetIntervalOption enumVal, JsonUtf8Writer& writer)
+{
+    writeStatisticResetIntervalOptionEnumValue(enumVal, writer);
+}
+
 AdminModels::StatisticResetIntervalOption PlayFab::AdminModels::readStatisticResetIntervalOptionFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readStatisticResetIntervalOptionFromValue(value.IsValid() ? value->AsString() : "");
@@ -4466,7 +7192,8 @@ PlayFab::AdminModels::FCreatePlayerStatisticDefinitionRequest::~FCreatePlayerSta
 
 }
 
-void PlayFab::AdminModels::FCreatePlayerStatisticDefinitionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCreatePlayerStatisticDefinitionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4506,6 +7233,16 @@ void PlayFab::AdminModels::FCreatePlayerStatisticDefinitionRequest::writeJSON(Js
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCreatePlayerStatisticDefinitionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCreatePlayerStatisticDefinitionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCreatePlayerStatisticDefinitionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4517,7 +7254,7 @@ bool PlayFab::AdminModels::FCreatePlayerStatisticDefinitionRequest::readFromValu
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -4533,12 +7270,60 @@ bool PlayFab::AdminModels::FCreatePlayerStatisticDefinitionRequest::readFromValu
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FCreatePlayerStatisticDefinitionRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AggregationMethod"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { AggregationMethod = readStatisticAggregationMethodFromValue(TmpValue); }
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("VersionChangeInterval"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { VersionChangeInterval = readStatisticResetIntervalOptionFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreatePlayerStatisticDefinitionRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FPlayerStatisticDefinition::~FPlayerStatisticDefinition()
 {
 
 }
 
-void PlayFab::AdminModels::FPlayerStatisticDefinition::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FPlayerStatisticDefinition::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4566,6 +7351,16 @@ void PlayFab::AdminModels::FPlayerStatisticDefinition::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FPlayerStatisticDefinition::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FPlayerStatisticDefinition::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FPlayerStatisticDefinition::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4591,13 +7386,54 @@ bool PlayFab::AdminModels::FPlayerStatisticDefinition::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FPlayerStatisticDefinition::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AggregationMethod"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { AggregationMethod = readStatisticAggregationMethodFromValue(TmpValue); }
+        }
+        else if (reader.IsField("CurrentVersion"))
+        {
+            reader.ReadValue(CurrentVersion);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("VersionChangeInterval"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { VersionChangeInterval = readStatisticResetIntervalOptionFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerStatisticDefinition();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FCreatePlayerStatisticDefinitionResult::~FCreatePlayerStatisticDefinitionResult()
 {
     //if (Statistic != nullptr) delete Statistic;
 
 }
 
-void PlayFab::AdminModels::FCreatePlayerStatisticDefinitionResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCreatePlayerStatisticDefinitionResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4610,6 +7446,16 @@ void PlayFab::AdminModels::FCreatePlayerStatisticDefinitionResult::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCreatePlayerStatisticDefinitionResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCreatePlayerStatisticDefinitionResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCreatePlayerStatisticDefinitionResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4617,24 +7463,62 @@ bool PlayFab::AdminModels::FCreatePlayerStatisticDefinitionResult::readFromValue
     const TSharedPtr<FJsonValue> StatisticValue = obj->TryGetField(TEXT("Statistic"));
     if (StatisticValue.IsValid() && !StatisticValue->IsNull())
     {
-        Statistic = MakeShareable(new FPlayerStatisticDefinition(StatisticValue->AsObject()));
+        Statistic = MakeShared<FPlayerStatisticDefinition>(StatisticValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FCreatePlayerStatisticDefinitionResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Statistic"))
+        {
+            Statistic = MakeShared<FPlayerStatisticDefinition>();
+            Statistic->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreatePlayerStatisticDefinitionResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FDeletePlayerSegmentAction::~FDeletePlayerSegmentAction()
 {
 
 }
 
-void PlayFab::AdminModels::FDeletePlayerSegmentAction::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeletePlayerSegmentAction::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FDeletePlayerSegmentAction::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeletePlayerSegmentAction::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FDeletePlayerSegmentAction::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4642,12 +7526,34 @@ bool PlayFab::AdminModels::FDeletePlayerSegmentAction::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FDeletePlayerSegmentAction::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeletePlayerSegmentAction();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FDeletePlayerStatisticSegmentAction::~FDeletePlayerStatisticSegmentAction()
 {
 
 }
 
-void PlayFab::AdminModels::FDeletePlayerStatisticSegmentAction::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeletePlayerStatisticSegmentAction::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4660,6 +7566,16 @@ void PlayFab::AdminModels::FDeletePlayerStatisticSegmentAction::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FDeletePlayerStatisticSegmentAction::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeletePlayerStatisticSegmentAction::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FDeletePlayerStatisticSegmentAction::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4674,12 +7590,39 @@ bool PlayFab::AdminModels::FDeletePlayerStatisticSegmentAction::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FDeletePlayerStatisticSegmentAction::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeletePlayerStatisticSegmentAction();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FEmailNotificationSegmentAction::~FEmailNotificationSegmentAction()
 {
 
 }
 
-void PlayFab::AdminModels::FEmailNotificationSegmentAction::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FEmailNotificationSegmentAction::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4698,7 +7641,17 @@ void PlayFab::AdminModels::FEmailNotificationSegmentAction::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
-bool PlayFab::AdminModels::FEmailNotificationSegmentAction::readFromValue(const TSharedPtr<FJsonObject>& obj)
+void PlayFab::AdminModels::FEmailNotificationSegmentAction::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FEmailNotificationSegmentAction::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
+bool PlayFab::AdminModels::FEmailNotificationSegmentAction::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
 
@@ -4719,12 +7672,43 @@ bool PlayFab::AdminModels::FEmailNotificationSegmentAction::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FEmailNotificationSegmentAction::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("EmailTemplateId"))
+        {
+            reader.ReadValue(EmailTemplateId);
+        }
+        else if (reader.IsField("EmailTemplateName"))
+        {
+            reader.ReadValue(EmailTemplateName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEmailNotificationSegmentAction();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FExecuteAzureFunctionSegmentAction::~FExecuteAzureFunctionSegmentAction()
 {
 
 }
 
-void PlayFab::AdminModels::FExecuteAzureFunctionSegmentAction::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FExecuteAzureFunctionSegmentAction::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4746,6 +7730,16 @@ void PlayFab::AdminModels::FExecuteAzureFunctionSegmentAction::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FExecuteAzureFunctionSegmentAction::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FExecuteAzureFunctionSegmentAction::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FExecuteAzureFunctionSegmentAction::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4773,12 +7767,47 @@ bool PlayFab::AdminModels::FExecuteAzureFunctionSegmentAction::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FExecuteAzureFunctionSegmentAction::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AzureFunction"))
+        {
+            reader.ReadValue(AzureFunction);
+        }
+        else if (reader.IsField("FunctionParameter"))
+        {
+            FunctionParameter.readFromReader(reader);
+        }
+        else if (reader.IsField("GenerateFunctionExecutedEvents"))
+        {
+            reader.ReadValue(GenerateFunctionExecutedEvents);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FExecuteAzureFunctionSegmentAction();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FExecuteCloudScriptSegmentAction::~FExecuteCloudScriptSegmentAction()
 {
 
 }
 
-void PlayFab::AdminModels::FExecuteCloudScriptSegmentAction::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FExecuteCloudScriptSegmentAction::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4806,6 +7835,16 @@ void PlayFab::AdminModels::FExecuteCloudScriptSegmentAction::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FExecuteCloudScriptSegmentAction::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FExecuteCloudScriptSegmentAction::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FExecuteCloudScriptSegmentAction::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4840,12 +7879,51 @@ bool PlayFab::AdminModels::FExecuteCloudScriptSegmentAction::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FExecuteCloudScriptSegmentAction::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CloudScriptFunction"))
+        {
+            reader.ReadValue(CloudScriptFunction);
+        }
+        else if (reader.IsField("CloudScriptPublishResultsToPlayStream"))
+        {
+            reader.ReadValue(CloudScriptPublishResultsToPlayStream);
+        }
+        else if (reader.IsField("FunctionParameter"))
+        {
+            FunctionParameter.readFromReader(reader);
+        }
+        else if (reader.IsField("FunctionParameterJson"))
+        {
+            reader.ReadValue(FunctionParameterJson);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FExecuteCloudScriptSegmentAction();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGrantItemSegmentAction::~FGrantItemSegmentAction()
 {
 
 }
 
-void PlayFab::AdminModels::FGrantItemSegmentAction::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGrantItemSegmentAction::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4867,6 +7945,16 @@ void PlayFab::AdminModels::FGrantItemSegmentAction::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGrantItemSegmentAction::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGrantItemSegmentAction::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGrantItemSegmentAction::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4895,12 +7983,47 @@ bool PlayFab::AdminModels::FGrantItemSegmentAction::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGrantItemSegmentAction::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatelogId"))
+        {
+            reader.ReadValue(CatelogId);
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else if (reader.IsField("Quantity"))
+        {
+            reader.ReadValue(Quantity);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGrantItemSegmentAction();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGrantVirtualCurrencySegmentAction::~FGrantVirtualCurrencySegmentAction()
 {
 
 }
 
-void PlayFab::AdminModels::FGrantVirtualCurrencySegmentAction::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGrantVirtualCurrencySegmentAction::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4916,6 +8039,16 @@ void PlayFab::AdminModels::FGrantVirtualCurrencySegmentAction::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGrantVirtualCurrencySegmentAction::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGrantVirtualCurrencySegmentAction::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGrantVirtualCurrencySegmentAction::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4937,12 +8070,43 @@ bool PlayFab::AdminModels::FGrantVirtualCurrencySegmentAction::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGrantVirtualCurrencySegmentAction::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Amount"))
+        {
+            reader.ReadValue(Amount);
+        }
+        else if (reader.IsField("CurrencyCode"))
+        {
+            reader.ReadValue(CurrencyCode);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGrantVirtualCurrencySegmentAction();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FIncrementPlayerStatisticSegmentAction::~FIncrementPlayerStatisticSegmentAction()
 {
 
 }
 
-void PlayFab::AdminModels::FIncrementPlayerStatisticSegmentAction::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FIncrementPlayerStatisticSegmentAction::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4958,6 +8122,16 @@ void PlayFab::AdminModels::FIncrementPlayerStatisticSegmentAction::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FIncrementPlayerStatisticSegmentAction::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FIncrementPlayerStatisticSegmentAction::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FIncrementPlayerStatisticSegmentAction::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4979,12 +8153,43 @@ bool PlayFab::AdminModels::FIncrementPlayerStatisticSegmentAction::readFromValue
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FIncrementPlayerStatisticSegmentAction::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("IncrementValue"))
+        {
+            reader.ReadValue(IncrementValue);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FIncrementPlayerStatisticSegmentAction();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FPushNotificationSegmentAction::~FPushNotificationSegmentAction()
 {
 
 }
 
-void PlayFab::AdminModels::FPushNotificationSegmentAction::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FPushNotificationSegmentAction::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4997,6 +8202,16 @@ void PlayFab::AdminModels::FPushNotificationSegmentAction::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FPushNotificationSegmentAction::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FPushNotificationSegmentAction::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FPushNotificationSegmentAction::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5011,6 +8226,32 @@ bool PlayFab::AdminModels::FPushNotificationSegmentAction::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FPushNotificationSegmentAction::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PushNotificationTemplateId"))
+        {
+            reader.ReadValue(PushNotificationTemplateId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPushNotificationSegmentAction();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSegmentTrigger::~FSegmentTrigger()
 {
     //if (BanPlayerAction != nullptr) delete BanPlayerAction;
@@ -5026,7 +8267,8 @@ PlayFab::AdminModels::FSegmentTrigger::~FSegmentTrigger()
 
 }
 
-void PlayFab::AdminModels::FSegmentTrigger::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSegmentTrigger::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5093,6 +8335,16 @@ void PlayFab::AdminModels::FSegmentTrigger::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSegmentTrigger::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSegmentTrigger::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSegmentTrigger::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5100,72 +8352,145 @@ bool PlayFab::AdminModels::FSegmentTrigger::readFromValue(const TSharedPtr<FJson
     const TSharedPtr<FJsonValue> BanPlayerActionValue = obj->TryGetField(TEXT("BanPlayerAction"));
     if (BanPlayerActionValue.IsValid() && !BanPlayerActionValue->IsNull())
     {
-        BanPlayerAction = MakeShareable(new FBanPlayerSegmentAction(BanPlayerActionValue->AsObject()));
+        BanPlayerAction = MakeShared<FBanPlayerSegmentAction>(BanPlayerActionValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> DeletePlayerActionValue = obj->TryGetField(TEXT("DeletePlayerAction"));
     if (DeletePlayerActionValue.IsValid() && !DeletePlayerActionValue->IsNull())
     {
-        DeletePlayerAction = MakeShareable(new FDeletePlayerSegmentAction(DeletePlayerActionValue->AsObject()));
+        DeletePlayerAction = MakeShared<FDeletePlayerSegmentAction>(DeletePlayerActionValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> DeletePlayerStatisticActionValue = obj->TryGetField(TEXT("DeletePlayerStatisticAction"));
     if (DeletePlayerStatisticActionValue.IsValid() && !DeletePlayerStatisticActionValue->IsNull())
     {
-        DeletePlayerStatisticAction = MakeShareable(new FDeletePlayerStatisticSegmentAction(DeletePlayerStatisticActionValue->AsObject()));
+        DeletePlayerStatisticAction = MakeShared<FDeletePlayerStatisticSegmentAction>(DeletePlayerStatisticActionValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> EmailNotificationActionValue = obj->TryGetField(TEXT("EmailNotificationAction"));
     if (EmailNotificationActionValue.IsValid() && !EmailNotificationActionValue->IsNull())
     {
-        EmailNotificationAction = MakeShareable(new FEmailNotificationSegmentAction(EmailNotificationActionValue->AsObject()));
+        EmailNotificationAction = MakeShared<FEmailNotificationSegmentAction>(EmailNotificationActionValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ExecuteAzureFunctionActionValue = obj->TryGetField(TEXT("ExecuteAzureFunctionAction"));
     if (ExecuteAzureFunctionActionValue.IsValid() && !ExecuteAzureFunctionActionValue->IsNull())
     {
-        ExecuteAzureFunctionAction = MakeShareable(new FExecuteAzureFunctionSegmentAction(ExecuteAzureFunctionActionValue->AsObject()));
+        ExecuteAzureFunctionAction = MakeShared<FExecuteAzureFunctionSegmentAction>(ExecuteAzureFunctionActionValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ExecuteCloudScriptActionValue = obj->TryGetField(TEXT("ExecuteCloudScriptAction"));
     if (ExecuteCloudScriptActionValue.IsValid() && !ExecuteCloudScriptActionValue->IsNull())
     {
-        ExecuteCloudScriptAction = MakeShareable(new FExecuteCloudScriptSegmentAction(ExecuteCloudScriptActionValue->AsObject()));
+        ExecuteCloudScriptAction = MakeShared<FExecuteCloudScriptSegmentAction>(ExecuteCloudScriptActionValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> GrantItemActionValue = obj->TryGetField(TEXT("GrantItemAction"));
     if (GrantItemActionValue.IsValid() && !GrantItemActionValue->IsNull())
     {
-        GrantItemAction = MakeShareable(new FGrantItemSegmentAction(GrantItemActionValue->AsObject()));
+        GrantItemAction = MakeShared<FGrantItemSegmentAction>(GrantItemActionValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> GrantVirtualCurrencyActionValue = obj->TryGetField(TEXT("GrantVirtualCurrencyAction"));
     if (GrantVirtualCurrencyActionValue.IsValid() && !GrantVirtualCurrencyActionValue->IsNull())
     {
-        GrantVirtualCurrencyAction = MakeShareable(new FGrantVirtualCurrencySegmentAction(GrantVirtualCurrencyActionValue->AsObject()));
+        GrantVirtualCurrencyAction = MakeShared<FGrantVirtualCurrencySegmentAction>(GrantVirtualCurrencyActionValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> IncrementPlayerStatisticActionValue = obj->TryGetField(TEXT("IncrementPlayerStatisticAction"));
     if (IncrementPlayerStatisticActionValue.IsValid() && !IncrementPlayerStatisticActionValue->IsNull())
     {
-        IncrementPlayerStatisticAction = MakeShareable(new FIncrementPlayerStatisticSegmentAction(IncrementPlayerStatisticActionValue->AsObject()));
+        IncrementPlayerStatisticAction = MakeShared<FIncrementPlayerStatisticSegmentAction>(IncrementPlayerStatisticActionValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PushNotificationActionValue = obj->TryGetField(TEXT("PushNotificationAction"));
     if (PushNotificationActionValue.IsValid() && !PushNotificationActionValue->IsNull())
     {
-        PushNotificationAction = MakeShareable(new FPushNotificationSegmentAction(PushNotificationActionValue->AsObject()));
+        PushNotificationAction = MakeShared<FPushNotificationSegmentAction>(PushNotificationActionValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSegmentTrigger::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BanPlayerAction"))
+        {
+            BanPlayerAction = MakeShared<FBanPlayerSegmentAction>();
+            BanPlayerAction->readFromReader(reader);
+        }
+        else if (reader.IsField("DeletePlayerAction"))
+        {
+            DeletePlayerAction = MakeShared<FDeletePlayerSegmentAction>();
+            DeletePlayerAction->readFromReader(reader);
+        }
+        else if (reader.IsField("DeletePlayerStatisticAction"))
+        {
+            DeletePlayerStatisticAction = MakeShared<FDeletePlayerStatisticSegmentAction>();
+            DeletePlayerStatisticAction->readFromReader(reader);
+        }
+        else if (reader.IsField("EmailNotificationAction"))
+        {
+            EmailNotificationAction = MakeShared<FEmailNotificationSegmentAction>();
+            EmailNotificationAction->readFromReader(reader);
+        }
+        else if (reader.IsField("ExecuteAzureFunctionAction"))
+        {
+            ExecuteAzureFunctionAction = MakeShared<FExecuteAzureFunctionSegmentAction>();
+            ExecuteAzureFunctionAction->readFromReader(reader);
+        }
+        else if (reader.IsField("ExecuteCloudScriptAction"))
+        {
+            ExecuteCloudScriptAction = MakeShared<FExecuteCloudScriptSegmentAction>();
+            ExecuteCloudScriptAction->readFromReader(reader);
+        }
+        else if (reader.IsField("GrantItemAction"))
+        {
+            GrantItemAction = MakeShared<FGrantItemSegmentAction>();
+            GrantItemAction->readFromReader(reader);
+        }
+        else if (reader.IsField("GrantVirtualCurrencyAction"))
+        {
+            GrantVirtualCurrencyAction = MakeShared<FGrantVirtualCurrencySegmentAction>();
+            GrantVirtualCurrencyAction->readFromReader(reader);
+        }
+        else if (reader.IsField("IncrementPlayerStatisticAction"))
+        {
+            IncrementPlayerStatisticAction = MakeShared<FIncrementPlayerStatisticSegmentAction>();
+            IncrementPlayerStatisticAction->readFromReader(reader);
+        }
+        else if (reader.IsField("PushNotificationAction"))
+        {
+            PushNotificationAction = MakeShared<FPushNotificationSegmentAction>();
+            PushNotificationAction->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSegmentTrigger();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FFirstLoginDateSegmentFilter::~FFirstLoginDateSegmentFilter()
 {
 
 }
 
-void PlayFab::AdminModels::FFirstLoginDateSegmentFilter::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FFirstLoginDateSegmentFilter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5181,6 +8506,16 @@ void PlayFab::AdminModels::FFirstLoginDateSegmentFilter::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FFirstLoginDateSegmentFilter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FFirstLoginDateSegmentFilter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FFirstLoginDateSegmentFilter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5195,12 +8530,44 @@ bool PlayFab::AdminModels::FFirstLoginDateSegmentFilter::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FFirstLoginDateSegmentFilter::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Comparison"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Comparison = readSegmentFilterComparisonFromValue(TmpValue); }
+        }
+        else if (reader.IsField("LogInDate"))
+        {
+            reader.ReadValue(LogInDate);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FFirstLoginDateSegmentFilter();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FFirstLoginTimespanSegmentFilter::~FFirstLoginTimespanSegmentFilter()
 {
 
 }
 
-void PlayFab::AdminModels::FFirstLoginTimespanSegmentFilter::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FFirstLoginTimespanSegmentFilter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5216,6 +8583,16 @@ void PlayFab::AdminModels::FFirstLoginTimespanSegmentFilter::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FFirstLoginTimespanSegmentFilter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FFirstLoginTimespanSegmentFilter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FFirstLoginTimespanSegmentFilter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5232,12 +8609,44 @@ bool PlayFab::AdminModels::FFirstLoginTimespanSegmentFilter::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FFirstLoginTimespanSegmentFilter::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Comparison"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Comparison = readSegmentFilterComparisonFromValue(TmpValue); }
+        }
+        else if (reader.IsField("DurationInMinutes"))
+        {
+            reader.ReadValue(DurationInMinutes);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FFirstLoginTimespanSegmentFilter();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FLastLoginDateSegmentFilter::~FLastLoginDateSegmentFilter()
 {
 
 }
 
-void PlayFab::AdminModels::FLastLoginDateSegmentFilter::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FLastLoginDateSegmentFilter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5253,6 +8662,16 @@ void PlayFab::AdminModels::FLastLoginDateSegmentFilter::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FLastLoginDateSegmentFilter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FLastLoginDateSegmentFilter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FLastLoginDateSegmentFilter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5267,14 +8686,46 @@ bool PlayFab::AdminModels::FLastLoginDateSegmentFilter::readFromValue(const TSha
     return HasSucceeded;
 }
 
-PlayFab::AdminModels::FLastLoginTimespanSegmentFilter::~FLastLoginTimespanSegmentFilter()
+bool PlayFab::AdminModels::FLastLoginDateSegmentFilter::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::AdminModels::FLastLoginTimespanSegmentFilter::writeJSON(JsonWriter& writer) const
-{
-    writer->WriteObjectStart();
+        if (reader.IsField("Comparison"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Comparison = readSegmentFilterComparisonFromValue(TmpValue); }
+        }
+        else if (reader.IsField("LogInDate"))
+        {
+            reader.ReadValue(LogInDate);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLastLoginDateSegmentFilter();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::AdminModels::FLastLoginTimespanSegmentFilter::~FLastLoginTimespanSegmentFilter()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::AdminModels::FLastLoginTimespanSegmentFilter::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
 
     if (Comparison.notNull())
     {
@@ -5288,6 +8739,16 @@ void PlayFab::AdminModels::FLastLoginTimespanSegmentFilter::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FLastLoginTimespanSegmentFilter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FLastLoginTimespanSegmentFilter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FLastLoginTimespanSegmentFilter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5304,7 +8765,39 @@ bool PlayFab::AdminModels::FLastLoginTimespanSegmentFilter::readFromValue(const
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeSegmentLoginIdentityProviderEnumJSON(SegmentLoginIdentityProvider enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FLastLoginTimespanSegmentFilter::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Comparison"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Comparison = readSegmentFilterComparisonFromValue(TmpValue); }
+        }
+        else if (reader.IsField("DurationInMinutes"))
+        {
+            reader.ReadValue(DurationInMinutes);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLastLoginTimespanSegmentFilter();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeSegmentLoginIdentityProviderEnumValue(AdminModels::SegmentLoginIdentityProvider enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -5333,6 +8826,16 @@ void PlayFab::AdminModels::writeSegmentLoginIdentityProviderEnumJSON(SegmentLogi
     }
 }
 
+void PlayFab::AdminModels::writeSegmentLoginIdentityProviderEnumJSON(SegmentLoginIdentityProvider enumVal, JsonWriter& writer)
+{
+    writeSegmentLoginIdentityProviderEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeSegmentLoginIdentityProviderEnumJSON(SegmentLoginIdentityProvider enumVal, JsonUtf8Writer& writer)
+{
+    writeSegmentLoginIdentityProviderEnumValue(enumVal, writer);
+}
+
 AdminModels::SegmentLoginIdentityProvider PlayFab::AdminModels::readSegmentLoginIdentityProviderFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readSegmentLoginIdentityProviderFromValue(value.IsValid() ? value->AsString() : "");
@@ -5383,7 +8886,8 @@ PlayFab::AdminModels::FLinkedUserAccountSegmentFilter::~FLinkedUserAccountSegmen
 
 }
 
-void PlayFab::AdminModels::FLinkedUserAccountSegmentFilter::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FLinkedUserAccountSegmentFilter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5396,6 +8900,16 @@ void PlayFab::AdminModels::FLinkedUserAccountSegmentFilter::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FLinkedUserAccountSegmentFilter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FLinkedUserAccountSegmentFilter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FLinkedUserAccountSegmentFilter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5405,12 +8919,40 @@ bool PlayFab::AdminModels::FLinkedUserAccountSegmentFilter::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FLinkedUserAccountSegmentFilter::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("LoginProvider"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { LoginProvider = readSegmentLoginIdentityProviderFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkedUserAccountSegmentFilter();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FLinkedUserAccountHasEmailSegmentFilter::~FLinkedUserAccountHasEmailSegmentFilter()
 {
 
 }
 
-void PlayFab::AdminModels::FLinkedUserAccountHasEmailSegmentFilter::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FLinkedUserAccountHasEmailSegmentFilter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5429,6 +8971,16 @@ void PlayFab::AdminModels::FLinkedUserAccountHasEmailSegmentFilter::writeJSON(Js
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FLinkedUserAccountHasEmailSegmentFilter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FLinkedUserAccountHasEmailSegmentFilter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FLinkedUserAccountHasEmailSegmentFilter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5440,7 +8992,40 @@ bool PlayFab::AdminModels::FLinkedUserAccountHasEmailSegmentFilter::readFromValu
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeSegmentCountryCodeEnumJSON(SegmentCountryCode enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FLinkedUserAccountHasEmailSegmentFilter::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Comparison"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Comparison = readSegmentFilterComparisonFromValue(TmpValue); }
+        }
+        else if (reader.IsField("LoginProvider"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { LoginProvider = readSegmentLoginIdentityProviderFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkedUserAccountHasEmailSegmentFilter();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeSegmentCountryCodeEnumValue(AdminModels::SegmentCountryCode enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -5697,6 +9282,16 @@ void PlayFab::AdminModels::writeSegmentCountryCodeEnumJSON(SegmentCountryCode en
     }
 }
 
+void PlayFab::AdminModels::writeSegmentCountryCodeEnumJSON(SegmentCountryCode enumVal, JsonWriter& writer)
+{
+    writeSegmentCountryCodeEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeSegmentCountryCodeEnumJSON(SegmentCountryCode enumVal, JsonUtf8Writer& writer)
+{
+    writeSegmentCountryCodeEnumValue(enumVal, writer);
+}
+
 AdminModels::SegmentCountryCode PlayFab::AdminModels::readSegmentCountryCodeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readSegmentCountryCodeFromValue(value.IsValid() ? value->AsString() : "");
@@ -5975,7 +9570,8 @@ PlayFab::AdminModels::FLocationSegmentFilter::~FLocationSegmentFilter()
 
 }
 
-void PlayFab::AdminModels::FLocationSegmentFilter::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FLocationSegmentFilter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5988,6 +9584,16 @@ void PlayFab::AdminModels::FLocationSegmentFilter::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FLocationSegmentFilter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FLocationSegmentFilter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FLocationSegmentFilter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5997,7 +9603,35 @@ bool PlayFab::AdminModels::FLocationSegmentFilter::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeSegmentPushNotificationDevicePlatformEnumJSON(SegmentPushNotificationDevicePlatform enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FLocationSegmentFilter::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CountryCode"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { CountryCode = readSegmentCountryCodeFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLocationSegmentFilter();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeSegmentPushNotificationDevicePlatformEnumValue(AdminModels::SegmentPushNotificationDevicePlatform enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -6007,6 +9641,16 @@ void PlayFab::AdminModels::writeSegmentPushNotificationDevicePlatformEnumJSON(Se
     }
 }
 
+void PlayFab::AdminModels::writeSegmentPushNotificationDevicePlatformEnumJSON(SegmentPushNotificationDevicePlatform enumVal, JsonWriter& writer)
+{
+    writeSegmentPushNotificationDevicePlatformEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeSegmentPushNotificationDevicePlatformEnumJSON(SegmentPushNotificationDevicePlatform enumVal, JsonUtf8Writer& writer)
+{
+    writeSegmentPushNotificationDevicePlatformEnumValue(enumVal, writer);
+}
+
 AdminModels::SegmentPushNotificationDevicePlatform PlayFab::AdminModels::readSegmentPushNotificationDevicePlatformFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readSegmentPushNotificationDevicePlatformFromValue(value.IsValid() ? value->AsString() : "");
@@ -6038,7 +9682,8 @@ PlayFab::AdminModels::FPushNotificationSegmentFilter::~FPushNotificationSegmentF
 
 }
 
-void PlayFab::AdminModels::FPushNotificationSegmentFilter::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FPushNotificationSegmentFilter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6051,6 +9696,16 @@ void PlayFab::AdminModels::FPushNotificationSegmentFilter::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FPushNotificationSegmentFilter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FPushNotificationSegmentFilter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FPushNotificationSegmentFilter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6060,12 +9715,40 @@ bool PlayFab::AdminModels::FPushNotificationSegmentFilter::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FPushNotificationSegmentFilter::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PushNotificationDevicePlatform"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { PushNotificationDevicePlatform = readSegmentPushNotificationDevicePlatformFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPushNotificationSegmentFilter();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FStatisticSegmentFilter::~FStatisticSegmentFilter()
 {
 
 }
 
-void PlayFab::AdminModels::FStatisticSegmentFilter::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FStatisticSegmentFilter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6102,6 +9785,16 @@ void PlayFab::AdminModels::FStatisticSegmentFilter::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FStatisticSegmentFilter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FStatisticSegmentFilter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FStatisticSegmentFilter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6139,12 +9832,56 @@ bool PlayFab::AdminModels::FStatisticSegmentFilter::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FStatisticSegmentFilter::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Comparison"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Comparison = readSegmentFilterComparisonFromValue(TmpValue); }
+        }
+        else if (reader.IsField("FilterValue"))
+        {
+            reader.ReadValue(FilterValue);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("UseCurrentVersion"))
+        {
+            reader.ReadValue(UseCurrentVersion);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStatisticSegmentFilter();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FTagSegmentFilter::~FTagSegmentFilter()
 {
 
 }
 
-void PlayFab::AdminModels::FTagSegmentFilter::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FTagSegmentFilter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6163,6 +9900,16 @@ void PlayFab::AdminModels::FTagSegmentFilter::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FTagSegmentFilter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FTagSegmentFilter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FTagSegmentFilter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6179,12 +9926,44 @@ bool PlayFab::AdminModels::FTagSegmentFilter::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FTagSegmentFilter::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Comparison"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Comparison = readSegmentFilterComparisonFromValue(TmpValue); }
+        }
+        else if (reader.IsField("TagValue"))
+        {
+            reader.ReadValue(TagValue);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FTagSegmentFilter();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FTotalValueToDateInUSDSegmentFilter::~FTotalValueToDateInUSDSegmentFilter()
 {
 
 }
 
-void PlayFab::AdminModels::FTotalValueToDateInUSDSegmentFilter::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FTotalValueToDateInUSDSegmentFilter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6203,6 +9982,16 @@ void PlayFab::AdminModels::FTotalValueToDateInUSDSegmentFilter::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FTotalValueToDateInUSDSegmentFilter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FTotalValueToDateInUSDSegmentFilter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FTotalValueToDateInUSDSegmentFilter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6219,12 +10008,44 @@ bool PlayFab::AdminModels::FTotalValueToDateInUSDSegmentFilter::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FTotalValueToDateInUSDSegmentFilter::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Amount"))
+        {
+            reader.ReadValue(Amount);
+        }
+        else if (reader.IsField("Comparison"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Comparison = readSegmentFilterComparisonFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FTotalValueToDateInUSDSegmentFilter();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUserOriginationSegmentFilter::~FUserOriginationSegmentFilter()
 {
 
 }
 
-void PlayFab::AdminModels::FUserOriginationSegmentFilter::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserOriginationSegmentFilter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6237,6 +10058,16 @@ void PlayFab::AdminModels::FUserOriginationSegmentFilter::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserOriginationSegmentFilter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserOriginationSegmentFilter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserOriginationSegmentFilter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6246,7 +10077,35 @@ bool PlayFab::AdminModels::FUserOriginationSegmentFilter::readFromValue(const TS
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeSegmentCurrencyEnumJSON(SegmentCurrency enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FUserOriginationSegmentFilter::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("LoginProvider"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { LoginProvider = readSegmentLoginIdentityProviderFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserOriginationSegmentFilter();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeSegmentCurrencyEnumValue(AdminModels::SegmentCurrency enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -6416,6 +10275,16 @@ void PlayFab::AdminModels::writeSegmentCurrencyEnumJSON(SegmentCurrency enumVal,
     }
 }
 
+void PlayFab::AdminModels::writeSegmentCurrencyEnumJSON(SegmentCurrency enumVal, JsonWriter& writer)
+{
+    writeSegmentCurrencyEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeSegmentCurrencyEnumJSON(SegmentCurrency enumVal, JsonUtf8Writer& writer)
+{
+    writeSegmentCurrencyEnumValue(enumVal, writer);
+}
+
 AdminModels::SegmentCurrency PlayFab::AdminModels::readSegmentCurrencyFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readSegmentCurrencyFromValue(value.IsValid() ? value->AsString() : "");
@@ -6607,7 +10476,8 @@ PlayFab::AdminModels::FValueToDateSegmentFilter::~FValueToDateSegmentFilter()
 
 }
 
-void PlayFab::AdminModels::FValueToDateSegmentFilter::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FValueToDateSegmentFilter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6632,6 +10502,16 @@ void PlayFab::AdminModels::FValueToDateSegmentFilter::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FValueToDateSegmentFilter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FValueToDateSegmentFilter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FValueToDateSegmentFilter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6650,12 +10530,49 @@ bool PlayFab::AdminModels::FValueToDateSegmentFilter::readFromValue(const TShare
     return HasSucceeded;
 }
 
-PlayFab::AdminModels::FVirtualCurrencyBalanceSegmentFilter::~FVirtualCurrencyBalanceSegmentFilter()
+bool PlayFab::AdminModels::FValueToDateSegmentFilter::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::AdminModels::FVirtualCurrencyBalanceSegmentFilter::writeJSON(JsonWriter& writer) const
+        if (reader.IsField("Amount"))
+        {
+            reader.ReadValue(Amount);
+        }
+        else if (reader.IsField("Comparison"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Comparison = readSegmentFilterComparisonFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Currency"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Currency = readSegmentCurrencyFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FValueToDateSegmentFilter();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::AdminModels::FVirtualCurrencyBalanceSegmentFilter::~FVirtualCurrencyBalanceSegmentFilter()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::AdminModels::FVirtualCurrencyBalanceSegmentFilter::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6677,6 +10594,16 @@ void PlayFab::AdminModels::FVirtualCurrencyBalanceSegmentFilter::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FVirtualCurrencyBalanceSegmentFilter::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FVirtualCurrencyBalanceSegmentFilter::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FVirtualCurrencyBalanceSegmentFilter::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6700,6 +10627,41 @@ bool PlayFab::AdminModels::FVirtualCurrencyBalanceSegmentFilter::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FVirtualCurrencyBalanceSegmentFilter::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Amount"))
+        {
+            reader.ReadValue(Amount);
+        }
+        else if (reader.IsField("Comparison"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Comparison = readSegmentFilterComparisonFromValue(TmpValue); }
+        }
+        else if (reader.IsField("CurrencyCode"))
+        {
+            reader.ReadValue(CurrencyCode);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FVirtualCurrencyBalanceSegmentFilter();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSegmentAndDefinition::~FSegmentAndDefinition()
 {
     //if (AdCampaignFilter != nullptr) delete AdCampaignFilter;
@@ -6721,7 +10683,8 @@ PlayFab::AdminModels::FSegmentAndDefinition::~FSegmentAndDefinition()
 
 }
 
-void PlayFab::AdminModels::FSegmentAndDefinition::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSegmentAndDefinition::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6824,6 +10787,16 @@ void PlayFab::AdminModels::FSegmentAndDefinition::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSegmentAndDefinition::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSegmentAndDefinition::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSegmentAndDefinition::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6831,108 +10804,211 @@ bool PlayFab::AdminModels::FSegmentAndDefinition::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonValue> AdCampaignFilterValue = obj->TryGetField(TEXT("AdCampaignFilter"));
     if (AdCampaignFilterValue.IsValid() && !AdCampaignFilterValue->IsNull())
     {
-        AdCampaignFilter = MakeShareable(new FAdCampaignSegmentFilter(AdCampaignFilterValue->AsObject()));
+        AdCampaignFilter = MakeShared<FAdCampaignSegmentFilter>(AdCampaignFilterValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> AllPlayersFilterValue = obj->TryGetField(TEXT("AllPlayersFilter"));
     if (AllPlayersFilterValue.IsValid() && !AllPlayersFilterValue->IsNull())
     {
-        AllPlayersFilter = MakeShareable(new FAllPlayersSegmentFilter(AllPlayersFilterValue->AsObject()));
+        AllPlayersFilter = MakeShared<FAllPlayersSegmentFilter>(AllPlayersFilterValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> FirstLoginDateFilterValue = obj->TryGetField(TEXT("FirstLoginDateFilter"));
     if (FirstLoginDateFilterValue.IsValid() && !FirstLoginDateFilterValue->IsNull())
     {
-        FirstLoginDateFilter = MakeShareable(new FFirstLoginDateSegmentFilter(FirstLoginDateFilterValue->AsObject()));
+        FirstLoginDateFilter = MakeShared<FFirstLoginDateSegmentFilter>(FirstLoginDateFilterValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> FirstLoginFilterValue = obj->TryGetField(TEXT("FirstLoginFilter"));
     if (FirstLoginFilterValue.IsValid() && !FirstLoginFilterValue->IsNull())
     {
-        FirstLoginFilter = MakeShareable(new FFirstLoginTimespanSegmentFilter(FirstLoginFilterValue->AsObject()));
+        FirstLoginFilter = MakeShared<FFirstLoginTimespanSegmentFilter>(FirstLoginFilterValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> LastLoginDateFilterValue = obj->TryGetField(TEXT("LastLoginDateFilter"));
     if (LastLoginDateFilterValue.IsValid() && !LastLoginDateFilterValue->IsNull())
     {
-        LastLoginDateFilter = MakeShareable(new FLastLoginDateSegmentFilter(LastLoginDateFilterValue->AsObject()));
+        LastLoginDateFilter = MakeShared<FLastLoginDateSegmentFilter>(LastLoginDateFilterValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> LastLoginFilterValue = obj->TryGetField(TEXT("LastLoginFilter"));
     if (LastLoginFilterValue.IsValid() && !LastLoginFilterValue->IsNull())
     {
-        LastLoginFilter = MakeShareable(new FLastLoginTimespanSegmentFilter(LastLoginFilterValue->AsObject()));
+        LastLoginFilter = MakeShared<FLastLoginTimespanSegmentFilter>(LastLoginFilterValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> LinkedUserAccountFilterValue = obj->TryGetField(TEXT("LinkedUserAccountFilter"));
     if (LinkedUserAccountFilterValue.IsValid() && !LinkedUserAccountFilterValue->IsNull())
     {
-        LinkedUserAccountFilter = MakeShareable(new FLinkedUserAccountSegmentFilter(LinkedUserAccountFilterValue->AsObject()));
+        LinkedUserAccountFilter = MakeShared<FLinkedUserAccountSegmentFilter>(LinkedUserAccountFilterValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> LinkedUserAccountHasEmailFilterValue = obj->TryGetField(TEXT("LinkedUserAccountHasEmailFilter"));
     if (LinkedUserAccountHasEmailFilterValue.IsValid() && !LinkedUserAccountHasEmailFilterValue->IsNull())
     {
-        LinkedUserAccountHasEmailFilter = MakeShareable(new FLinkedUserAccountHasEmailSegmentFilter(LinkedUserAccountHasEmailFilterValue->AsObject()));
+        LinkedUserAccountHasEmailFilter = MakeShared<FLinkedUserAccountHasEmailSegmentFilter>(LinkedUserAccountHasEmailFilterValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> LocationFilterValue = obj->TryGetField(TEXT("LocationFilter"));
     if (LocationFilterValue.IsValid() && !LocationFilterValue->IsNull())
     {
-        LocationFilter = MakeShareable(new FLocationSegmentFilter(LocationFilterValue->AsObject()));
+        LocationFilter = MakeShared<FLocationSegmentFilter>(LocationFilterValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PushNotificationFilterValue = obj->TryGetField(TEXT("PushNotificationFilter"));
     if (PushNotificationFilterValue.IsValid() && !PushNotificationFilterValue->IsNull())
     {
-        PushNotificationFilter = MakeShareable(new FPushNotificationSegmentFilter(PushNotificationFilterValue->AsObject()));
+        PushNotificationFilter = MakeShared<FPushNotificationSegmentFilter>(PushNotificationFilterValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> StatisticFilterValue = obj->TryGetField(TEXT("StatisticFilter"));
     if (StatisticFilterValue.IsValid() && !StatisticFilterValue->IsNull())
     {
-        StatisticFilter = MakeShareable(new FStatisticSegmentFilter(StatisticFilterValue->AsObject()));
+        StatisticFilter = MakeShared<FStatisticSegmentFilter>(StatisticFilterValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> TagFilterValue = obj->TryGetField(TEXT("TagFilter"));
     if (TagFilterValue.IsValid() && !TagFilterValue->IsNull())
     {
-        TagFilter = MakeShareable(new FTagSegmentFilter(TagFilterValue->AsObject()));
+        TagFilter = MakeShared<FTagSegmentFilter>(TagFilterValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> TotalValueToDateInUSDFilterValue = obj->TryGetField(TEXT("TotalValueToDateInUSDFilter"));
     if (TotalValueToDateInUSDFilterValue.IsValid() && !TotalValueToDateInUSDFilterValue->IsNull())
     {
-        TotalValueToDateInUSDFilter = MakeShareable(new FTotalValueToDateInUSDSegmentFilter(TotalValueToDateInUSDFilterValue->AsObject()));
+        TotalValueToDateInUSDFilter = MakeShared<FTotalValueToDateInUSDSegmentFilter>(TotalValueToDateInUSDFilterValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> UserOriginationFilterValue = obj->TryGetField(TEXT("UserOriginationFilter"));
     if (UserOriginationFilterValue.IsValid() && !UserOriginationFilterValue->IsNull())
     {
-        UserOriginationFilter = MakeShareable(new FUserOriginationSegmentFilter(UserOriginationFilterValue->AsObject()));
+        UserOriginationFilter = MakeShared<FUserOriginationSegmentFilter>(UserOriginationFilterValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ValueToDateFilterValue = obj->TryGetField(TEXT("ValueToDateFilter"));
     if (ValueToDateFilterValue.IsValid() && !ValueToDateFilterValue->IsNull())
     {
-        ValueToDateFilter = MakeShareable(new FValueToDateSegmentFilter(ValueToDateFilterValue->AsObject()));
+        ValueToDateFilter = MakeShared<FValueToDateSegmentFilter>(ValueToDateFilterValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> VirtualCurrencyBalanceFilterValue = obj->TryGetField(TEXT("VirtualCurrencyBalanceFilter"));
     if (VirtualCurrencyBalanceFilterValue.IsValid() && !VirtualCurrencyBalanceFilterValue->IsNull())
     {
-        VirtualCurrencyBalanceFilter = MakeShareable(new FVirtualCurrencyBalanceSegmentFilter(VirtualCurrencyBalanceFilterValue->AsObject()));
+        VirtualCurrencyBalanceFilter = MakeShared<FVirtualCurrencyBalanceSegmentFilter>(VirtualCurrencyBalanceFilterValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSegmentAndDefinition::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AdCampaignFilter"))
+        {
+            AdCampaignFilter = MakeShared<FAdCampaignSegmentFilter>();
+            AdCampaignFilter->readFromReader(reader);
+        }
+        else if (reader.IsField("AllPlayersFilter"))
+        {
+            AllPlayersFilter = MakeShared<FAllPlayersSegmentFilter>();
+            AllPlayersFilter->readFromReader(reader);
+        }
+        else if (reader.IsField("FirstLoginDateFilter"))
+        {
+            FirstLoginDateFilter = MakeShared<FFirstLoginDateSegmentFilter>();
+            FirstLoginDateFilter->readFromReader(reader);
+        }
+        else if (reader.IsField("FirstLoginFilter"))
+        {
+            FirstLoginFilter = MakeShared<FFirstLoginTimespanSegmentFilter>();
+            FirstLoginFilter->readFromReader(reader);
+        }
+        else if (reader.IsField("LastLoginDateFilter"))
+        {
+            LastLoginDateFilter = MakeShared<FLastLoginDateSegmentFilter>();
+            LastLoginDateFilter->readFromReader(reader);
+        }
+        else if (reader.IsField("LastLoginFilter"))
+        {
+            LastLoginFilter = MakeShared<FLastLoginTimespanSegmentFilter>();
+            LastLoginFilter->readFromReader(reader);
+        }
+        else if (reader.IsField("LinkedUserAccountFilter"))
+        {
+            LinkedUserAccountFilter = MakeShared<FLinkedUserAccountSegmentFilter>();
+            LinkedUserAccountFilter->readFromReader(reader);
+        }
+        else if (reader.IsField("LinkedUserAccountHasEmailFilter"))
+        {
+            LinkedUserAccountHasEmailFilter = MakeShared<FLinkedUserAccountHasEmailSegmentFilter>();
+            LinkedUserAccountHasEmailFilter->readFromReader(reader);
+        }
+        else if (reader.IsField("LocationFilter"))
+        {
+            LocationFilter = MakeShared<FLocationSegmentFilter>();
+            LocationFilter->readFromReader(reader);
+        }
+        else if (reader.IsField("PushNotificationFilter"))
+        {
+            PushNotificationFilter = MakeShared<FPushNotificationSegmentFilter>();
+            PushNotificationFilter->readFromReader(reader);
+        }
+        else if (reader.IsField("StatisticFilter"))
+        {
+            StatisticFilter = MakeShared<FStatisticSegmentFilter>();
+            StatisticFilter->readFromReader(reader);
+        }
+        else if (reader.IsField("TagFilter"))
+        {
+            TagFilter = MakeShared<FTagSegmentFilter>();
+            TagFilter->readFromReader(reader);
+        }
+        else if (reader.IsField("TotalValueToDateInUSDFilter"))
+        {
+            TotalValueToDateInUSDFilter = MakeShared<FTotalValueToDateInUSDSegmentFilter>();
+            TotalValueToDateInUSDFilter->readFromReader(reader);
+        }
+        else if (reader.IsField("UserOriginationFilter"))
+        {
+            UserOriginationFilter = MakeShared<FUserOriginationSegmentFilter>();
+            UserOriginationFilter->readFromReader(reader);
+        }
+        else if (reader.IsField("ValueToDateFilter"))
+        {
+            ValueToDateFilter = MakeShared<FValueToDateSegmentFilter>();
+            ValueToDateFilter->readFromReader(reader);
+        }
+        else if (reader.IsField("VirtualCurrencyBalanceFilter"))
+        {
+            VirtualCurrencyBalanceFilter = MakeShared<FVirtualCurrencyBalanceSegmentFilter>();
+            VirtualCurrencyBalanceFilter->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSegmentAndDefinition();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSegmentOrDefinition::~FSegmentOrDefinition()
 {
 
 }
 
-void PlayFab::AdminModels::FSegmentOrDefinition::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSegmentOrDefinition::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6948,6 +11024,16 @@ void PlayFab::AdminModels::FSegmentOrDefinition::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSegmentOrDefinition::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSegmentOrDefinition::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSegmentOrDefinition::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6956,19 +11042,53 @@ bool PlayFab::AdminModels::FSegmentOrDefinition::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < SegmentAndDefinitionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = SegmentAndDefinitionsArray[Idx];
-        SegmentAndDefinitions.Add(FSegmentAndDefinition(CurrentItem->AsObject()));
+        SegmentAndDefinitions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSegmentOrDefinition::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SegmentAndDefinitions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { SegmentAndDefinitions[SegmentAndDefinitions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSegmentOrDefinition();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSegmentModel::~FSegmentModel()
 {
 
 }
 
-void PlayFab::AdminModels::FSegmentModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSegmentModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7023,6 +11143,16 @@ void PlayFab::AdminModels::FSegmentModel::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSegmentModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSegmentModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSegmentModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7038,7 +11168,7 @@ bool PlayFab::AdminModels::FSegmentModel::readFromValue(const TSharedPtr<FJsonOb
     for (int32 Idx = 0; Idx < EnteredSegmentActionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = EnteredSegmentActionsArray[Idx];
-        EnteredSegmentActions.Add(FSegmentTrigger(CurrentItem->AsObject()));
+        EnteredSegmentActions.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -7051,7 +11181,7 @@ bool PlayFab::AdminModels::FSegmentModel::readFromValue(const TSharedPtr<FJsonOb
     for (int32 Idx = 0; Idx < LeftSegmentActionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LeftSegmentActionsArray[Idx];
-        LeftSegmentActions.Add(FSegmentTrigger(CurrentItem->AsObject()));
+        LeftSegmentActions.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -7073,19 +11203,91 @@ bool PlayFab::AdminModels::FSegmentModel::readFromValue(const TSharedPtr<FJsonOb
     for (int32 Idx = 0; Idx < SegmentOrDefinitionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = SegmentOrDefinitionsArray[Idx];
-        SegmentOrDefinitions.Add(FSegmentOrDefinition(CurrentItem->AsObject()));
+        SegmentOrDefinitions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSegmentModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("EnteredSegmentActions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { EnteredSegmentActions[EnteredSegmentActions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("LastUpdateTime"))
+        {
+            reader.ReadValue(LastUpdateTime);
+        }
+        else if (reader.IsField("LeftSegmentActions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { LeftSegmentActions[LeftSegmentActions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("SegmentId"))
+        {
+            reader.ReadValue(SegmentId);
+        }
+        else if (reader.IsField("SegmentOrDefinitions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { SegmentOrDefinitions[SegmentOrDefinitions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSegmentModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FCreateSegmentRequest::~FCreateSegmentRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FCreateSegmentRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCreateSegmentRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7095,6 +11297,16 @@ void PlayFab::AdminModels::FCreateSegmentRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCreateSegmentRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCreateSegmentRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCreateSegmentRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7108,12 +11320,39 @@ bool PlayFab::AdminModels::FCreateSegmentRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FCreateSegmentRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SegmentModel"))
+        {
+            pfSegmentModel.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateSegmentRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FCreateSegmentResponse::~FCreateSegmentResponse()
 {
 
 }
 
-void PlayFab::AdminModels::FCreateSegmentResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCreateSegmentResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7132,6 +11371,16 @@ void PlayFab::AdminModels::FCreateSegmentResponse::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCreateSegmentResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCreateSegmentResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCreateSegmentResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7153,12 +11402,43 @@ bool PlayFab::AdminModels::FCreateSegmentResponse::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FCreateSegmentResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ErrorMessage"))
+        {
+            reader.ReadValue(ErrorMessage);
+        }
+        else if (reader.IsField("SegmentId"))
+        {
+            reader.ReadValue(SegmentId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateSegmentResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FCreateTaskResult::~FCreateTaskResult()
 {
 
 }
 
-void PlayFab::AdminModels::FCreateTaskResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FCreateTaskResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7171,6 +11451,16 @@ void PlayFab::AdminModels::FCreateTaskResult::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FCreateTaskResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FCreateTaskResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FCreateTaskResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7185,7 +11475,34 @@ bool PlayFab::AdminModels::FCreateTaskResult::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeCurrencyEnumJSON(Currency enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FCreateTaskResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TaskId"))
+        {
+            reader.ReadValue(TaskId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateTaskResult();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeCurrencyEnumValue(AdminModels::Currency enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -7355,6 +11672,16 @@ void PlayFab::AdminModels::writeCurrencyEnumJSON(Currency enumVal, JsonWriter& w
     }
 }
 
+void PlayFab::AdminModels::writeCurrencyEnumJSON(Currency enumVal, JsonWriter& writer)
+{
+    writeCurrencyEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeCurrencyEnumJSON(Currency enumVal, JsonUtf8Writer& writer)
+{
+    writeCurrencyEnumValue(enumVal, writer);
+}
+
 AdminModels::Currency PlayFab::AdminModels::readCurrencyFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readCurrencyFromValue(value.IsValid() ? value->AsString() : "");
@@ -7546,7 +11873,8 @@ PlayFab::AdminModels::FDeleteContentRequest::~FDeleteContentRequest()
 
 }
 
-void PlayFab::AdminModels::FDeleteContentRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeleteContentRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7563,6 +11891,16 @@ void PlayFab::AdminModels::FDeleteContentRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FDeleteContentRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeleteContentRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FDeleteContentRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7577,12 +11915,39 @@ bool PlayFab::AdminModels::FDeleteContentRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FDeleteContentRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Key"))
+        {
+            reader.ReadValue(Key);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteContentRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FDeleteMasterPlayerAccountRequest::~FDeleteMasterPlayerAccountRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FDeleteMasterPlayerAccountRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeleteMasterPlayerAccountRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7605,6 +11970,16 @@ void PlayFab::AdminModels::FDeleteMasterPlayerAccountRequest::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FDeleteMasterPlayerAccountRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeleteMasterPlayerAccountRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FDeleteMasterPlayerAccountRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7626,12 +12001,43 @@ bool PlayFab::AdminModels::FDeleteMasterPlayerAccountRequest::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FDeleteMasterPlayerAccountRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("MetaData"))
+        {
+            reader.ReadValue(MetaData);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteMasterPlayerAccountRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FDeleteMasterPlayerAccountResult::~FDeleteMasterPlayerAccountResult()
 {
 
 }
 
-void PlayFab::AdminModels::FDeleteMasterPlayerAccountResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeleteMasterPlayerAccountResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7653,7 +12059,17 @@ void PlayFab::AdminModels::FDeleteMasterPlayerAccountResult::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
-bool PlayFab::AdminModels::FDeleteMasterPlayerAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
+void PlayFab::AdminModels::FDeleteMasterPlayerAccountResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeleteMasterPlayerAccountResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
+bool PlayFab::AdminModels::FDeleteMasterPlayerAccountResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
 
@@ -7669,12 +12085,50 @@ bool PlayFab::AdminModels::FDeleteMasterPlayerAccountResult::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FDeleteMasterPlayerAccountResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("JobReceiptId"))
+        {
+            reader.ReadValue(JobReceiptId);
+        }
+        else if (reader.IsField("TitleIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { TitleIds.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteMasterPlayerAccountResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FDeleteOpenIdConnectionRequest::~FDeleteOpenIdConnectionRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FDeleteOpenIdConnectionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeleteOpenIdConnectionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7691,6 +12145,16 @@ void PlayFab::AdminModels::FDeleteOpenIdConnectionRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FDeleteOpenIdConnectionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeleteOpenIdConnectionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FDeleteOpenIdConnectionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7705,12 +12169,39 @@ bool PlayFab::AdminModels::FDeleteOpenIdConnectionRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FDeleteOpenIdConnectionRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ConnectionId"))
+        {
+            reader.ReadValue(ConnectionId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteOpenIdConnectionRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FDeletePlayerRequest::~FDeletePlayerRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FDeletePlayerRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeletePlayerRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7727,6 +12218,16 @@ void PlayFab::AdminModels::FDeletePlayerRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FDeletePlayerRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeletePlayerRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FDeletePlayerRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7741,18 +12242,55 @@ bool PlayFab::AdminModels::FDeletePlayerRequest::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FDeletePlayerRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeletePlayerRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FDeletePlayerResult::~FDeletePlayerResult()
 {
 
 }
 
-void PlayFab::AdminModels::FDeletePlayerResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeletePlayerResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FDeletePlayerResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeletePlayerResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FDeletePlayerResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7760,12 +12298,34 @@ bool PlayFab::AdminModels::FDeletePlayerResult::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FDeletePlayerResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeletePlayerResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FDeletePlayerSharedSecretRequest::~FDeletePlayerSharedSecretRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FDeletePlayerSharedSecretRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeletePlayerSharedSecretRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7778,6 +12338,16 @@ void PlayFab::AdminModels::FDeletePlayerSharedSecretRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FDeletePlayerSharedSecretRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeletePlayerSharedSecretRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FDeletePlayerSharedSecretRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7792,18 +12362,55 @@ bool PlayFab::AdminModels::FDeletePlayerSharedSecretRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FDeletePlayerSharedSecretRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SecretKey"))
+        {
+            reader.ReadValue(SecretKey);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeletePlayerSharedSecretRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FDeletePlayerSharedSecretResult::~FDeletePlayerSharedSecretResult()
 {
 
 }
 
-void PlayFab::AdminModels::FDeletePlayerSharedSecretResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeletePlayerSharedSecretResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FDeletePlayerSharedSecretResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeletePlayerSharedSecretResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FDeletePlayerSharedSecretResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7811,12 +12418,34 @@ bool PlayFab::AdminModels::FDeletePlayerSharedSecretResult::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FDeletePlayerSharedSecretResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeletePlayerSharedSecretResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FDeleteSegmentRequest::~FDeleteSegmentRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FDeleteSegmentRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeleteSegmentRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7833,6 +12462,16 @@ void PlayFab::AdminModels::FDeleteSegmentRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FDeleteSegmentRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeleteSegmentRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FDeleteSegmentRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7847,12 +12486,39 @@ bool PlayFab::AdminModels::FDeleteSegmentRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FDeleteSegmentRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SegmentId"))
+        {
+            reader.ReadValue(SegmentId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteSegmentRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FDeleteSegmentsResponse::~FDeleteSegmentsResponse()
 {
 
 }
 
-void PlayFab::AdminModels::FDeleteSegmentsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeleteSegmentsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7865,6 +12531,16 @@ void PlayFab::AdminModels::FDeleteSegmentsResponse::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FDeleteSegmentsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeleteSegmentsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FDeleteSegmentsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7879,12 +12555,39 @@ bool PlayFab::AdminModels::FDeleteSegmentsResponse::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FDeleteSegmentsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ErrorMessage"))
+        {
+            reader.ReadValue(ErrorMessage);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteSegmentsResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FDeleteStoreRequest::~FDeleteStoreRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FDeleteStoreRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeleteStoreRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7918,6 +12621,16 @@ void PlayFab::AdminModels::FDeleteStoreRequest::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FDeleteStoreRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeleteStoreRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FDeleteStoreRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7934,7 +12647,7 @@ bool PlayFab::AdminModels::FDeleteStoreRequest::readFromValue(const TSharedPtr<F
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -7948,18 +12661,70 @@ bool PlayFab::AdminModels::FDeleteStoreRequest::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FDeleteStoreRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("StoreId"))
+        {
+            reader.ReadValue(StoreId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteStoreRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FDeleteStoreResult::~FDeleteStoreResult()
 {
 
 }
 
-void PlayFab::AdminModels::FDeleteStoreResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeleteStoreResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FDeleteStoreResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeleteStoreResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FDeleteStoreResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7967,13 +12732,35 @@ bool PlayFab::AdminModels::FDeleteStoreResult::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FDeleteStoreResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteStoreResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FDeleteTaskRequest::~FDeleteTaskRequest()
 {
     //if (Identifier != nullptr) delete Identifier;
 
 }
 
-void PlayFab::AdminModels::FDeleteTaskRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeleteTaskRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7986,6 +12773,16 @@ void PlayFab::AdminModels::FDeleteTaskRequest::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FDeleteTaskRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeleteTaskRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FDeleteTaskRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7993,18 +12790,46 @@ bool PlayFab::AdminModels::FDeleteTaskRequest::readFromValue(const TSharedPtr<FJ
     const TSharedPtr<FJsonValue> IdentifierValue = obj->TryGetField(TEXT("Identifier"));
     if (IdentifierValue.IsValid() && !IdentifierValue->IsNull())
     {
-        Identifier = MakeShareable(new FNameIdentifier(IdentifierValue->AsObject()));
+        Identifier = MakeShared<FNameIdentifier>(IdentifierValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FDeleteTaskRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Identifier"))
+        {
+            Identifier = MakeShared<FNameIdentifier>();
+            Identifier->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteTaskRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FDeleteTitleDataOverrideRequest::~FDeleteTitleDataOverrideRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FDeleteTitleDataOverrideRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeleteTitleDataOverrideRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8021,6 +12846,16 @@ void PlayFab::AdminModels::FDeleteTitleDataOverrideRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FDeleteTitleDataOverrideRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeleteTitleDataOverrideRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FDeleteTitleDataOverrideRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8035,18 +12870,55 @@ bool PlayFab::AdminModels::FDeleteTitleDataOverrideRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FDeleteTitleDataOverrideRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("OverrideLabel"))
+        {
+            reader.ReadValue(OverrideLabel);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteTitleDataOverrideRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FDeleteTitleDataOverrideResult::~FDeleteTitleDataOverrideResult()
 {
 
 }
 
-void PlayFab::AdminModels::FDeleteTitleDataOverrideResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeleteTitleDataOverrideResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FDeleteTitleDataOverrideResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeleteTitleDataOverrideResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FDeleteTitleDataOverrideResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8054,18 +12926,50 @@ bool PlayFab::AdminModels::FDeleteTitleDataOverrideResult::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FDeleteTitleDataOverrideResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteTitleDataOverrideResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FDeleteTitleRequest::~FDeleteTitleRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FDeleteTitleRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeleteTitleRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FDeleteTitleRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeleteTitleRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FDeleteTitleRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8073,18 +12977,50 @@ bool PlayFab::AdminModels::FDeleteTitleRequest::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FDeleteTitleRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteTitleRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FDeleteTitleResult::~FDeleteTitleResult()
 {
 
 }
 
-void PlayFab::AdminModels::FDeleteTitleResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FDeleteTitleResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FDeleteTitleResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FDeleteTitleResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FDeleteTitleResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8092,7 +13028,29 @@ bool PlayFab::AdminModels::FDeleteTitleResult::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeEffectTypeEnumJSON(EffectType enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FDeleteTitleResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteTitleResult();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeEffectTypeEnumValue(AdminModels::EffectType enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -8102,6 +13060,16 @@ void PlayFab::AdminModels::writeEffectTypeEnumJSON(EffectType enumVal, JsonWrite
     }
 }
 
+void PlayFab::AdminModels::writeEffectTypeEnumJSON(EffectType enumVal, JsonWriter& writer)
+{
+    writeEffectTypeEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeEffectTypeEnumJSON(EffectType enumVal, JsonUtf8Writer& writer)
+{
+    writeEffectTypeEnumValue(enumVal, writer);
+}
+
 AdminModels::EffectType PlayFab::AdminModels::readEffectTypeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readEffectTypeFromValue(value.IsValid() ? value->AsString() : "");
@@ -8133,13 +13101,24 @@ PlayFab::AdminModels::FEmptyResponse::~FEmptyResponse()
 
 }
 
-void PlayFab::AdminModels::FEmptyResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FEmptyResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FEmptyResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FEmptyResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FEmptyResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8147,12 +13126,34 @@ bool PlayFab::AdminModels::FEmptyResponse::readFromValue(const TSharedPtr<FJsonO
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FEmptyResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEmptyResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FEntityKey::~FEntityKey()
 {
 
 }
 
-void PlayFab::AdminModels::FEntityKey::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FEntityKey::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8175,6 +13176,16 @@ void PlayFab::AdminModels::FEntityKey::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FEntityKey::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FEntityKey::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FEntityKey::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8196,12 +13207,43 @@ bool PlayFab::AdminModels::FEntityKey::readFromValue(const TSharedPtr<FJsonObjec
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FEntityKey::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Type"))
+        {
+            reader.ReadValue(Type);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityKey();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FExportMasterPlayerDataRequest::~FExportMasterPlayerDataRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FExportMasterPlayerDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FExportMasterPlayerDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8218,6 +13260,16 @@ void PlayFab::AdminModels::FExportMasterPlayerDataRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FExportMasterPlayerDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FExportMasterPlayerDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FExportMasterPlayerDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8232,12 +13284,39 @@ bool PlayFab::AdminModels::FExportMasterPlayerDataRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FExportMasterPlayerDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FExportMasterPlayerDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FExportMasterPlayerDataResult::~FExportMasterPlayerDataResult()
 {
 
 }
 
-void PlayFab::AdminModels::FExportMasterPlayerDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FExportMasterPlayerDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8250,6 +13329,16 @@ void PlayFab::AdminModels::FExportMasterPlayerDataResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FExportMasterPlayerDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FExportMasterPlayerDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FExportMasterPlayerDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8264,12 +13353,39 @@ bool PlayFab::AdminModels::FExportMasterPlayerDataResult::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FExportMasterPlayerDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("JobReceiptId"))
+        {
+            reader.ReadValue(JobReceiptId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FExportMasterPlayerDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGameModeInfo::~FGameModeInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FGameModeInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGameModeInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8298,6 +13414,16 @@ void PlayFab::AdminModels::FGameModeInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGameModeInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGameModeInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGameModeInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8333,6 +13459,44 @@ bool PlayFab::AdminModels::FGameModeInfo::readFromValue(const TSharedPtr<FJsonOb
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGameModeInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Gamemode"))
+        {
+            reader.ReadValue(Gamemode);
+        }
+        else if (reader.IsField("MaxPlayerCount"))
+        {
+            reader.ReadValue(MaxPlayerCount);
+        }
+        else if (reader.IsField("MinPlayerCount"))
+        {
+            reader.ReadValue(MinPlayerCount);
+        }
+        else if (reader.IsField("StartOpen"))
+        {
+            reader.ReadValue(StartOpen);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGameModeInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetActionsOnPlayersInSegmentTaskInstanceResult::~FGetActionsOnPlayersInSegmentTaskInstanceResult()
 {
     //if (Parameter != nullptr) delete Parameter;
@@ -8340,7 +13504,8 @@ PlayFab::AdminModels::FGetActionsOnPlayersInSegmentTaskInstanceResult::~FGetActi
 
 }
 
-void PlayFab::AdminModels::FGetActionsOnPlayersInSegmentTaskInstanceResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetActionsOnPlayersInSegmentTaskInstanceResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8359,6 +13524,16 @@ void PlayFab::AdminModels::FGetActionsOnPlayersInSegmentTaskInstanceResult::writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetActionsOnPlayersInSegmentTaskInstanceResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetActionsOnPlayersInSegmentTaskInstanceResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetActionsOnPlayersInSegmentTaskInstanceResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8366,30 +13541,73 @@ bool PlayFab::AdminModels::FGetActionsOnPlayersInSegmentTaskInstanceResult::read
     const TSharedPtr<FJsonValue> ParameterValue = obj->TryGetField(TEXT("Parameter"));
     if (ParameterValue.IsValid() && !ParameterValue->IsNull())
     {
-        Parameter = MakeShareable(new FActionsOnPlayersInSegmentTaskParameter(ParameterValue->AsObject()));
+        Parameter = MakeShared<FActionsOnPlayersInSegmentTaskParameter>(ParameterValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> SummaryValue = obj->TryGetField(TEXT("Summary"));
     if (SummaryValue.IsValid() && !SummaryValue->IsNull())
     {
-        Summary = MakeShareable(new FActionsOnPlayersInSegmentTaskSummary(SummaryValue->AsObject()));
+        Summary = MakeShared<FActionsOnPlayersInSegmentTaskSummary>(SummaryValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetActionsOnPlayersInSegmentTaskInstanceResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Parameter"))
+        {
+            Parameter = MakeShared<FActionsOnPlayersInSegmentTaskParameter>();
+            Parameter->readFromReader(reader);
+        }
+        else if (reader.IsField("Summary"))
+        {
+            Summary = MakeShared<FActionsOnPlayersInSegmentTaskSummary>();
+            Summary->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetActionsOnPlayersInSegmentTaskInstanceResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetAllSegmentsRequest::~FGetAllSegmentsRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetAllSegmentsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetAllSegmentsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetAllSegmentsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetAllSegmentsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetAllSegmentsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8397,12 +13615,34 @@ bool PlayFab::AdminModels::FGetAllSegmentsRequest::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetAllSegmentsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetAllSegmentsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetSegmentResult::~FGetSegmentResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetSegmentResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetSegmentResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8431,6 +13671,16 @@ void PlayFab::AdminModels::FGetSegmentResult::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetSegmentResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetSegmentResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetSegmentResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8459,12 +13709,47 @@ bool PlayFab::AdminModels::FGetSegmentResult::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetSegmentResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ABTestParent"))
+        {
+            reader.ReadValue(ABTestParent);
+        }
+        else if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetSegmentResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetAllSegmentsResult::~FGetAllSegmentsResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetAllSegmentsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetAllSegmentsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8480,6 +13765,16 @@ void PlayFab::AdminModels::FGetAllSegmentsResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetAllSegmentsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetAllSegmentsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetAllSegmentsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8488,19 +13783,53 @@ bool PlayFab::AdminModels::FGetAllSegmentsResult::readFromValue(const TSharedPtr
     for (int32 Idx = 0; Idx < SegmentsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = SegmentsArray[Idx];
-        Segments.Add(FGetSegmentResult(CurrentItem->AsObject()));
+        Segments.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetAllSegmentsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Segments"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Segments[Segments.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetAllSegmentsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetCatalogItemsRequest::~FGetCatalogItemsRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetCatalogItemsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetCatalogItemsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8513,6 +13842,16 @@ void PlayFab::AdminModels::FGetCatalogItemsRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetCatalogItemsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetCatalogItemsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetCatalogItemsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8527,12 +13866,39 @@ bool PlayFab::AdminModels::FGetCatalogItemsRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetCatalogItemsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCatalogItemsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetCatalogItemsResult::~FGetCatalogItemsResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetCatalogItemsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetCatalogItemsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8548,6 +13914,16 @@ void PlayFab::AdminModels::FGetCatalogItemsResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetCatalogItemsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetCatalogItemsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetCatalogItemsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8556,19 +13932,53 @@ bool PlayFab::AdminModels::FGetCatalogItemsResult::readFromValue(const TSharedPt
     for (int32 Idx = 0; Idx < CatalogArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = CatalogArray[Idx];
-        Catalog.Add(FCatalogItem(CurrentItem->AsObject()));
+        Catalog.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetCatalogItemsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Catalog"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Catalog[Catalog.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCatalogItemsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetCloudScriptRevisionRequest::~FGetCloudScriptRevisionRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetCloudScriptRevisionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetCloudScriptRevisionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8587,6 +13997,16 @@ void PlayFab::AdminModels::FGetCloudScriptRevisionRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetCloudScriptRevisionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetCloudScriptRevisionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetCloudScriptRevisionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8608,12 +14028,43 @@ bool PlayFab::AdminModels::FGetCloudScriptRevisionRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetCloudScriptRevisionRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Revision"))
+        {
+            reader.ReadValue(Revision);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCloudScriptRevisionRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetCloudScriptRevisionResult::~FGetCloudScriptRevisionResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetCloudScriptRevisionResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetCloudScriptRevisionResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8641,6 +14092,16 @@ void PlayFab::AdminModels::FGetCloudScriptRevisionResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetCloudScriptRevisionResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetCloudScriptRevisionResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetCloudScriptRevisionResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8654,7 +14115,7 @@ bool PlayFab::AdminModels::FGetCloudScriptRevisionResult::readFromValue(const TS
     for (int32 Idx = 0; Idx < FilesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = FilesArray[Idx];
-        Files.Add(FCloudScriptFile(CurrentItem->AsObject()));
+        Files.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -8682,6 +14143,55 @@ bool PlayFab::AdminModels::FGetCloudScriptRevisionResult::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetCloudScriptRevisionResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CreatedAt"))
+        {
+            reader.ReadValue(CreatedAt);
+        }
+        else if (reader.IsField("Files"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Files[Files.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("IsPublished"))
+        {
+            reader.ReadValue(IsPublished);
+        }
+        else if (reader.IsField("Revision"))
+        {
+            reader.ReadValue(Revision);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCloudScriptRevisionResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetCloudScriptTaskInstanceResult::~FGetCloudScriptTaskInstanceResult()
 {
     //if (Parameter != nullptr) delete Parameter;
@@ -8689,7 +14199,8 @@ PlayFab::AdminModels::FGetCloudScriptTaskInstanceResult::~FGetCloudScriptTaskIns
 
 }
 
-void PlayFab::AdminModels::FGetCloudScriptTaskInstanceResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetCloudScriptTaskInstanceResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8708,6 +14219,16 @@ void PlayFab::AdminModels::FGetCloudScriptTaskInstanceResult::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetCloudScriptTaskInstanceResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetCloudScriptTaskInstanceResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetCloudScriptTaskInstanceResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8715,30 +14236,73 @@ bool PlayFab::AdminModels::FGetCloudScriptTaskInstanceResult::readFromValue(cons
     const TSharedPtr<FJsonValue> ParameterValue = obj->TryGetField(TEXT("Parameter"));
     if (ParameterValue.IsValid() && !ParameterValue->IsNull())
     {
-        Parameter = MakeShareable(new FCloudScriptTaskParameter(ParameterValue->AsObject()));
+        Parameter = MakeShared<FCloudScriptTaskParameter>(ParameterValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> SummaryValue = obj->TryGetField(TEXT("Summary"));
     if (SummaryValue.IsValid() && !SummaryValue->IsNull())
     {
-        Summary = MakeShareable(new FCloudScriptTaskSummary(SummaryValue->AsObject()));
+        Summary = MakeShared<FCloudScriptTaskSummary>(SummaryValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetCloudScriptTaskInstanceResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Parameter"))
+        {
+            Parameter = MakeShared<FCloudScriptTaskParameter>();
+            Parameter->readFromReader(reader);
+        }
+        else if (reader.IsField("Summary"))
+        {
+            Summary = MakeShared<FCloudScriptTaskSummary>();
+            Summary->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCloudScriptTaskInstanceResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetCloudScriptVersionsRequest::~FGetCloudScriptVersionsRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetCloudScriptVersionsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetCloudScriptVersionsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetCloudScriptVersionsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetCloudScriptVersionsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetCloudScriptVersionsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8746,12 +14310,34 @@ bool PlayFab::AdminModels::FGetCloudScriptVersionsRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetCloudScriptVersionsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCloudScriptVersionsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetCloudScriptVersionsResult::~FGetCloudScriptVersionsResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetCloudScriptVersionsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetCloudScriptVersionsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8764,7 +14350,17 @@ void PlayFab::AdminModels::FGetCloudScriptVersionsResult::writeJSON(JsonWriter&
     }
 
 
-    writer->WriteObjectEnd();
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::AdminModels::FGetCloudScriptVersionsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetCloudScriptVersionsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::AdminModels::FGetCloudScriptVersionsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -8775,19 +14371,53 @@ bool PlayFab::AdminModels::FGetCloudScriptVersionsResult::readFromValue(const TS
     for (int32 Idx = 0; Idx < VersionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = VersionsArray[Idx];
-        Versions.Add(FCloudScriptVersionStatus(CurrentItem->AsObject()));
+        Versions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetCloudScriptVersionsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Versions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Versions[Versions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetCloudScriptVersionsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetContentListRequest::~FGetContentListRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetContentListRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetContentListRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8800,6 +14430,16 @@ void PlayFab::AdminModels::FGetContentListRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetContentListRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetContentListRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetContentListRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8814,12 +14454,39 @@ bool PlayFab::AdminModels::FGetContentListRequest::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetContentListRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Prefix"))
+        {
+            reader.ReadValue(Prefix);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetContentListRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetContentListResult::~FGetContentListResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetContentListResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetContentListResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8841,6 +14508,16 @@ void PlayFab::AdminModels::FGetContentListResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetContentListResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetContentListResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetContentListResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8849,7 +14526,7 @@ bool PlayFab::AdminModels::FGetContentListResult::readFromValue(const TSharedPtr
     for (int32 Idx = 0; Idx < ContentsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ContentsArray[Idx];
-        Contents.Add(FContentInfo(CurrentItem->AsObject()));
+        Contents.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -8870,12 +14547,54 @@ bool PlayFab::AdminModels::FGetContentListResult::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetContentListResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Contents"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Contents[Contents.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("ItemCount"))
+        {
+            reader.ReadValue(ItemCount);
+        }
+        else if (reader.IsField("TotalSize"))
+        {
+            reader.ReadValue(TotalSize);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetContentListResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetContentUploadUrlRequest::~FGetContentUploadUrlRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetContentUploadUrlRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetContentUploadUrlRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8898,6 +14617,16 @@ void PlayFab::AdminModels::FGetContentUploadUrlRequest::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetContentUploadUrlRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetContentUploadUrlRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetContentUploadUrlRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8919,12 +14648,43 @@ bool PlayFab::AdminModels::FGetContentUploadUrlRequest::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetContentUploadUrlRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ContentType"))
+        {
+            reader.ReadValue(ContentType);
+        }
+        else if (reader.IsField("Key"))
+        {
+            reader.ReadValue(Key);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetContentUploadUrlRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetContentUploadUrlResult::~FGetContentUploadUrlResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetContentUploadUrlResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetContentUploadUrlResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8937,6 +14697,16 @@ void PlayFab::AdminModels::FGetContentUploadUrlResult::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetContentUploadUrlResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetContentUploadUrlResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetContentUploadUrlResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8951,12 +14721,39 @@ bool PlayFab::AdminModels::FGetContentUploadUrlResult::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetContentUploadUrlResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("URL"))
+        {
+            reader.ReadValue(URL);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetContentUploadUrlResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetDataReportRequest::~FGetDataReportRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetDataReportRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetDataReportRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8982,6 +14779,16 @@ void PlayFab::AdminModels::FGetDataReportRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetDataReportRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetDataReportRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetDataReportRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9017,12 +14824,51 @@ bool PlayFab::AdminModels::FGetDataReportRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetDataReportRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Day"))
+        {
+            reader.ReadValue(Day);
+        }
+        else if (reader.IsField("Month"))
+        {
+            reader.ReadValue(Month);
+        }
+        else if (reader.IsField("ReportName"))
+        {
+            reader.ReadValue(ReportName);
+        }
+        else if (reader.IsField("Year"))
+        {
+            reader.ReadValue(Year);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetDataReportRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetDataReportResult::~FGetDataReportResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetDataReportResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetDataReportResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9035,6 +14881,16 @@ void PlayFab::AdminModels::FGetDataReportResult::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetDataReportResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetDataReportResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetDataReportResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9049,12 +14905,39 @@ bool PlayFab::AdminModels::FGetDataReportResult::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetDataReportResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DownloadUrl"))
+        {
+            reader.ReadValue(DownloadUrl);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetDataReportResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetMatchmakerGameInfoRequest::~FGetMatchmakerGameInfoRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetMatchmakerGameInfoRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetMatchmakerGameInfoRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9071,6 +14954,16 @@ void PlayFab::AdminModels::FGetMatchmakerGameInfoRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetMatchmakerGameInfoRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetMatchmakerGameInfoRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetMatchmakerGameInfoRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9085,12 +14978,39 @@ bool PlayFab::AdminModels::FGetMatchmakerGameInfoRequest::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetMatchmakerGameInfoRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("LobbyId"))
+        {
+            reader.ReadValue(LobbyId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetMatchmakerGameInfoRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetMatchmakerGameInfoResult::~FGetMatchmakerGameInfoResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetMatchmakerGameInfoResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetMatchmakerGameInfoResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9166,6 +15086,16 @@ void PlayFab::AdminModels::FGetMatchmakerGameInfoResult::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetMatchmakerGameInfoResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetMatchmakerGameInfoResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetMatchmakerGameInfoResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9243,12 +15173,91 @@ bool PlayFab::AdminModels::FGetMatchmakerGameInfoResult::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetMatchmakerGameInfoResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildVersion"))
+        {
+            reader.ReadValue(BuildVersion);
+        }
+        else if (reader.IsField("EndTime"))
+        {
+            reader.ReadValue(EndTime);
+        }
+        else if (reader.IsField("LobbyId"))
+        {
+            reader.ReadValue(LobbyId);
+        }
+        else if (reader.IsField("Mode"))
+        {
+            reader.ReadValue(Mode);
+        }
+        else if (reader.IsField("Players"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Players.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Region"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfRegion = readRegionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("ServerIPV4Address"))
+        {
+            reader.ReadValue(ServerIPV4Address);
+        }
+        else if (reader.IsField("ServerIPV6Address"))
+        {
+            reader.ReadValue(ServerIPV6Address);
+        }
+        else if (reader.IsField("ServerPort"))
+        {
+            reader.ReadValue(ServerPort);
+        }
+        else if (reader.IsField("ServerPublicDNSName"))
+        {
+            reader.ReadValue(ServerPublicDNSName);
+        }
+        else if (reader.IsField("StartTime"))
+        {
+            reader.ReadValue(StartTime);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetMatchmakerGameInfoResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetMatchmakerGameModesRequest::~FGetMatchmakerGameModesRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetMatchmakerGameModesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetMatchmakerGameModesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9265,6 +15274,16 @@ void PlayFab::AdminModels::FGetMatchmakerGameModesRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetMatchmakerGameModesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetMatchmakerGameModesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetMatchmakerGameModesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9279,12 +15298,39 @@ bool PlayFab::AdminModels::FGetMatchmakerGameModesRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetMatchmakerGameModesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildVersion"))
+        {
+            reader.ReadValue(BuildVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetMatchmakerGameModesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetMatchmakerGameModesResult::~FGetMatchmakerGameModesResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetMatchmakerGameModesResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetMatchmakerGameModesResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9300,6 +15346,16 @@ void PlayFab::AdminModels::FGetMatchmakerGameModesResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetMatchmakerGameModesResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetMatchmakerGameModesResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetMatchmakerGameModesResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9308,19 +15364,53 @@ bool PlayFab::AdminModels::FGetMatchmakerGameModesResult::readFromValue(const TS
     for (int32 Idx = 0; Idx < GameModesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GameModesArray[Idx];
-        GameModes.Add(FGameModeInfo(CurrentItem->AsObject()));
+        GameModes.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetMatchmakerGameModesResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GameModes"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GameModes[GameModes.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetMatchmakerGameModesResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPlayedTitleListRequest::~FGetPlayedTitleListRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPlayedTitleListRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPlayedTitleListRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9334,7 +15424,17 @@ void PlayFab::AdminModels::FGetPlayedTitleListRequest::writeJSON(JsonWriter& wri
         writer->WriteValue(PlayFabId);
     }
 
-    writer->WriteObjectEnd();
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::AdminModels::FGetPlayedTitleListRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPlayedTitleListRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::AdminModels::FGetPlayedTitleListRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -9351,12 +15451,39 @@ bool PlayFab::AdminModels::FGetPlayedTitleListRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPlayedTitleListRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayedTitleListRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPlayedTitleListResult::~FGetPlayedTitleListResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPlayedTitleListResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPlayedTitleListResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9372,6 +15499,16 @@ void PlayFab::AdminModels::FGetPlayedTitleListResult::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPlayedTitleListResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPlayedTitleListResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPlayedTitleListResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9381,12 +15518,46 @@ bool PlayFab::AdminModels::FGetPlayedTitleListResult::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPlayedTitleListResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TitleIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { TitleIds.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayedTitleListResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPlayerIdFromAuthTokenRequest::~FGetPlayerIdFromAuthTokenRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPlayerIdFromAuthTokenRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPlayerIdFromAuthTokenRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9406,6 +15577,16 @@ void PlayFab::AdminModels::FGetPlayerIdFromAuthTokenRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPlayerIdFromAuthTokenRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPlayerIdFromAuthTokenRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPlayerIdFromAuthTokenRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9422,12 +15603,44 @@ bool PlayFab::AdminModels::FGetPlayerIdFromAuthTokenRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPlayerIdFromAuthTokenRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Token"))
+        {
+            reader.ReadValue(Token);
+        }
+        else if (reader.IsField("TokenType"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { TokenType = readAuthTokenTypeFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerIdFromAuthTokenRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPlayerIdFromAuthTokenResult::~FGetPlayerIdFromAuthTokenResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPlayerIdFromAuthTokenResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPlayerIdFromAuthTokenResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9440,6 +15653,16 @@ void PlayFab::AdminModels::FGetPlayerIdFromAuthTokenResult::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPlayerIdFromAuthTokenResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPlayerIdFromAuthTokenResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPlayerIdFromAuthTokenResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9454,12 +15677,39 @@ bool PlayFab::AdminModels::FGetPlayerIdFromAuthTokenResult::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPlayerIdFromAuthTokenResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerIdFromAuthTokenResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FPlayerProfileViewConstraints::~FPlayerProfileViewConstraints()
 {
 
 }
 
-void PlayFab::AdminModels::FPlayerProfileViewConstraints::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FPlayerProfileViewConstraints::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9517,6 +15767,16 @@ void PlayFab::AdminModels::FPlayerProfileViewConstraints::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FPlayerProfileViewConstraints::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FPlayerProfileViewConstraints::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FPlayerProfileViewConstraints::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9643,13 +15903,104 @@ bool PlayFab::AdminModels::FPlayerProfileViewConstraints::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FPlayerProfileViewConstraints::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ShowAvatarUrl"))
+        {
+            reader.ReadValue(ShowAvatarUrl);
+        }
+        else if (reader.IsField("ShowBannedUntil"))
+        {
+            reader.ReadValue(ShowBannedUntil);
+        }
+        else if (reader.IsField("ShowCampaignAttributions"))
+        {
+            reader.ReadValue(ShowCampaignAttributions);
+        }
+        else if (reader.IsField("ShowContactEmailAddresses"))
+        {
+            reader.ReadValue(ShowContactEmailAddresses);
+        }
+        else if (reader.IsField("ShowCreated"))
+        {
+            reader.ReadValue(ShowCreated);
+        }
+        else if (reader.IsField("ShowDisplayName"))
+        {
+            reader.ReadValue(ShowDisplayName);
+        }
+        else if (reader.IsField("ShowExperimentVariants"))
+        {
+            reader.ReadValue(ShowExperimentVariants);
+        }
+        else if (reader.IsField("ShowLastLogin"))
+        {
+            reader.ReadValue(ShowLastLogin);
+        }
+        else if (reader.IsField("ShowLinkedAccounts"))
+        {
+            reader.ReadValue(ShowLinkedAccounts);
+        }
+        else if (reader.IsField("ShowLocations"))
+        {
+            reader.ReadValue(ShowLocations);
+        }
+        else if (reader.IsField("ShowMemberships"))
+        {
+            reader.ReadValue(ShowMemberships);
+        }
+        else if (reader.IsField("ShowOrigination"))
+        {
+            reader.ReadValue(ShowOrigination);
+        }
+        else if (reader.IsField("ShowPushNotificationRegistrations"))
+        {
+            reader.ReadValue(ShowPushNotificationRegistrations);
+        }
+        else if (reader.IsField("ShowStatistics"))
+        {
+            reader.ReadValue(ShowStatistics);
+        }
+        else if (reader.IsField("ShowTags"))
+        {
+            reader.ReadValue(ShowTags);
+        }
+        else if (reader.IsField("ShowTotalValueToDateInUsd"))
+        {
+            reader.ReadValue(ShowTotalValueToDateInUsd);
+        }
+        else if (reader.IsField("ShowValuesToDate"))
+        {
+            reader.ReadValue(ShowValuesToDate);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerProfileViewConstraints();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPlayerProfileRequest::~FGetPlayerProfileRequest()
 {
     //if (ProfileConstraints != nullptr) delete ProfileConstraints;
 
 }
 
-void PlayFab::AdminModels::FGetPlayerProfileRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPlayerProfileRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9683,6 +16034,16 @@ void PlayFab::AdminModels::FGetPlayerProfileRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPlayerProfileRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPlayerProfileRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPlayerProfileRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9692,7 +16053,7 @@ bool PlayFab::AdminModels::FGetPlayerProfileRequest::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -9706,13 +16067,56 @@ bool PlayFab::AdminModels::FGetPlayerProfileRequest::readFromValue(const TShared
     const TSharedPtr<FJsonValue> ProfileConstraintsValue = obj->TryGetField(TEXT("ProfileConstraints"));
     if (ProfileConstraintsValue.IsValid() && !ProfileConstraintsValue->IsNull())
     {
-        ProfileConstraints = MakeShareable(new FPlayerProfileViewConstraints(ProfileConstraintsValue->AsObject()));
+        ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>(ProfileConstraintsValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FGetPlayerProfileRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("ProfileConstraints"))
+        {
+            ProfileConstraints = MakeShared<FPlayerProfileViewConstraints>();
+            ProfileConstraints->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerProfileRequest();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeLoginIdentityProviderEnumValue(AdminModels::LoginIdentityProvider enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -9741,6 +16145,16 @@ void PlayFab::AdminModels::writeLoginIdentityProviderEnumJSON(LoginIdentityProvi
     }
 }
 
+void PlayFab::AdminModels::writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonWriter& writer)
+{
+    writeLoginIdentityProviderEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonUtf8Writer& writer)
+{
+    writeLoginIdentityProviderEnumValue(enumVal, writer);
+}
+
 AdminModels::LoginIdentityProvider PlayFab::AdminModels::readLoginIdentityProviderFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readLoginIdentityProviderFromValue(value.IsValid() ? value->AsString() : "");
@@ -9791,7 +16205,8 @@ PlayFab::AdminModels::FLinkedPlatformAccountModel::~FLinkedPlatformAccountModel(
 
 }
 
-void PlayFab::AdminModels::FLinkedPlatformAccountModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FLinkedPlatformAccountModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9822,6 +16237,16 @@ void PlayFab::AdminModels::FLinkedPlatformAccountModel::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FLinkedPlatformAccountModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FLinkedPlatformAccountModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FLinkedPlatformAccountModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9852,12 +16277,52 @@ bool PlayFab::AdminModels::FLinkedPlatformAccountModel::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FLinkedPlatformAccountModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Email"))
+        {
+            reader.ReadValue(Email);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Platform = readLoginIdentityProviderFromValue(TmpValue); }
+        }
+        else if (reader.IsField("PlatformUserId"))
+        {
+            reader.ReadValue(PlatformUserId);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinkedPlatformAccountModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FLocationModel::~FLocationModel()
 {
 
 }
 
-void PlayFab::AdminModels::FLocationModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FLocationModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9894,6 +16359,16 @@ void PlayFab::AdminModels::FLocationModel::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FLocationModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FLocationModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FLocationModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9926,7 +16401,52 @@ bool PlayFab::AdminModels::FLocationModel::readFromValue(const TSharedPtr<FJsonO
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FLocationModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("City"))
+        {
+            reader.ReadValue(City);
+        }
+        else if (reader.IsField("ContinentCode"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfContinentCode = readContinentCodeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("CountryCode"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfCountryCode = readCountryCodeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Latitude"))
+        {
+            reader.ReadValue(Latitude);
+        }
+        else if (reader.IsField("Longitude"))
+        {
+            reader.ReadValue(Longitude);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLocationModel();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeSubscriptionProviderStatusEnumValue(AdminModels::SubscriptionProviderStatus enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -9942,6 +16462,16 @@ void PlayFab::AdminModels::writeSubscriptionProviderStatusEnumJSON(SubscriptionP
     }
 }
 
+void PlayFab::AdminModels::writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonWriter& writer)
+{
+    writeSubscriptionProviderStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeSubscriptionProviderStatusEnumValue(enumVal, writer);
+}
+
 AdminModels::SubscriptionProviderStatus PlayFab::AdminModels::readSubscriptionProviderStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readSubscriptionProviderStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -9979,7 +16509,8 @@ PlayFab::AdminModels::FSubscriptionModel::~FSubscriptionModel()
 
 }
 
-void PlayFab::AdminModels::FSubscriptionModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSubscriptionModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10019,6 +16550,16 @@ void PlayFab::AdminModels::FSubscriptionModel::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSubscriptionModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSubscriptionModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSubscriptionModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10063,7 +16604,58 @@ bool PlayFab::AdminModels::FSubscriptionModel::readFromValue(const TSharedPtr<FJ
         if (SubscriptionProviderValue->TryGetString(TmpValue)) { SubscriptionProvider = TmpValue; }
     }
 
-    return HasSucceeded;
+    return HasSucceeded;
+}
+
+bool PlayFab::AdminModels::FSubscriptionModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Expiration"))
+        {
+            reader.ReadValue(Expiration);
+        }
+        else if (reader.IsField("InitialSubscriptionTime"))
+        {
+            reader.ReadValue(InitialSubscriptionTime);
+        }
+        else if (reader.IsField("IsActive"))
+        {
+            reader.ReadValue(IsActive);
+        }
+        else if (reader.IsField("Status"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Status = readSubscriptionProviderStatusFromValue(TmpValue); }
+        }
+        else if (reader.IsField("SubscriptionId"))
+        {
+            reader.ReadValue(SubscriptionId);
+        }
+        else if (reader.IsField("SubscriptionItemId"))
+        {
+            reader.ReadValue(SubscriptionItemId);
+        }
+        else if (reader.IsField("SubscriptionProvider"))
+        {
+            reader.ReadValue(SubscriptionProvider);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSubscriptionModel();
+        return false;
+    }
+    return true;
 }
 
 PlayFab::AdminModels::FMembershipModel::~FMembershipModel()
@@ -10071,7 +16663,8 @@ PlayFab::AdminModels::FMembershipModel::~FMembershipModel()
 
 }
 
-void PlayFab::AdminModels::FMembershipModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FMembershipModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10111,6 +16704,16 @@ void PlayFab::AdminModels::FMembershipModel::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FMembershipModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FMembershipModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FMembershipModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10150,14 +16753,68 @@ bool PlayFab::AdminModels::FMembershipModel::readFromValue(const TSharedPtr<FJso
     for (int32 Idx = 0; Idx < SubscriptionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = SubscriptionsArray[Idx];
-        Subscriptions.Add(FSubscriptionModel(CurrentItem->AsObject()));
+        Subscriptions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FMembershipModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("IsActive"))
+        {
+            reader.ReadValue(IsActive);
+        }
+        else if (reader.IsField("MembershipExpiration"))
+        {
+            reader.ReadValue(MembershipExpiration);
+        }
+        else if (reader.IsField("MembershipId"))
+        {
+            reader.ReadValue(MembershipId);
+        }
+        else if (reader.IsField("OverrideExpiration"))
+        {
+            reader.ReadValue(OverrideExpiration);
+        }
+        else if (reader.IsField("OverrideIsSet"))
+        {
+            reader.ReadValue(OverrideIsSet);
+        }
+        else if (reader.IsField("Subscriptions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Subscriptions[Subscriptions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FMembershipModel();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writePushNotificationPlatformEnumValue(AdminModels::PushNotificationPlatform enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -10167,6 +16824,16 @@ void PlayFab::AdminModels::writePushNotificationPlatformEnumJSON(PushNotificatio
     }
 }
 
+void PlayFab::AdminModels::writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonWriter& writer)
+{
+    writePushNotificationPlatformEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonUtf8Writer& writer)
+{
+    writePushNotificationPlatformEnumValue(enumVal, writer);
+}
+
 AdminModels::PushNotificationPlatform PlayFab::AdminModels::readPushNotificationPlatformFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readPushNotificationPlatformFromValue(value.IsValid() ? value->AsString() : "");
@@ -10198,7 +16865,8 @@ PlayFab::AdminModels::FPushNotificationRegistrationModel::~FPushNotificationRegi
 
 }
 
-void PlayFab::AdminModels::FPushNotificationRegistrationModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FPushNotificationRegistrationModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10217,6 +16885,16 @@ void PlayFab::AdminModels::FPushNotificationRegistrationModel::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FPushNotificationRegistrationModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FPushNotificationRegistrationModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FPushNotificationRegistrationModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10233,12 +16911,44 @@ bool PlayFab::AdminModels::FPushNotificationRegistrationModel::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FPushNotificationRegistrationModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("NotificationEndpointARN"))
+        {
+            reader.ReadValue(NotificationEndpointARN);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Platform = readPushNotificationPlatformFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPushNotificationRegistrationModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FStatisticModel::~FStatisticModel()
 {
 
 }
 
-void PlayFab::AdminModels::FStatisticModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FStatisticModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10257,6 +16967,16 @@ void PlayFab::AdminModels::FStatisticModel::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FStatisticModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FStatisticModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FStatisticModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10285,12 +17005,47 @@ bool PlayFab::AdminModels::FStatisticModel::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FStatisticModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStatisticModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FTagModel::~FTagModel()
 {
 
 }
 
-void PlayFab::AdminModels::FTagModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FTagModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10303,6 +17058,16 @@ void PlayFab::AdminModels::FTagModel::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FTagModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FTagModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FTagModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10317,12 +17082,39 @@ bool PlayFab::AdminModels::FTagModel::readFromValue(const TSharedPtr<FJsonObject
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FTagModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TagValue"))
+        {
+            reader.ReadValue(TagValue);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FTagModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FValueToDateModel::~FValueToDateModel()
 {
 
 }
 
-void PlayFab::AdminModels::FValueToDateModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FValueToDateModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10344,6 +17136,16 @@ void PlayFab::AdminModels::FValueToDateModel::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FValueToDateModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FValueToDateModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FValueToDateModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10372,12 +17174,47 @@ bool PlayFab::AdminModels::FValueToDateModel::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FValueToDateModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Currency"))
+        {
+            reader.ReadValue(Currency);
+        }
+        else if (reader.IsField("TotalValue"))
+        {
+            reader.ReadValue(TotalValue);
+        }
+        else if (reader.IsField("TotalValueAsDecimal"))
+        {
+            reader.ReadValue(TotalValueAsDecimal);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FValueToDateModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FPlayerProfileModel::~FPlayerProfileModel()
 {
 
 }
 
-void PlayFab::AdminModels::FPlayerProfileModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FPlayerProfileModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10534,6 +17371,16 @@ void PlayFab::AdminModels::FPlayerProfileModel::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FPlayerProfileModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FPlayerProfileModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FPlayerProfileModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10542,7 +17389,7 @@ bool PlayFab::AdminModels::FPlayerProfileModel::readFromValue(const TSharedPtr<F
     for (int32 Idx = 0; Idx < AdCampaignAttributionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = AdCampaignAttributionsArray[Idx];
-        AdCampaignAttributions.Add(FAdCampaignAttributionModel(CurrentItem->AsObject()));
+        AdCampaignAttributions.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10562,7 +17409,7 @@ bool PlayFab::AdminModels::FPlayerProfileModel::readFromValue(const TSharedPtr<F
     for (int32 Idx = 0; Idx < ContactEmailAddressesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ContactEmailAddressesArray[Idx];
-        ContactEmailAddresses.Add(FContactEmailInfoModel(CurrentItem->AsObject()));
+        ContactEmailAddresses.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10589,7 +17436,7 @@ bool PlayFab::AdminModels::FPlayerProfileModel::readFromValue(const TSharedPtr<F
     for (int32 Idx = 0; Idx < LinkedAccountsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LinkedAccountsArray[Idx];
-        LinkedAccounts.Add(FLinkedPlatformAccountModel(CurrentItem->AsObject()));
+        LinkedAccounts.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10597,7 +17444,7 @@ bool PlayFab::AdminModels::FPlayerProfileModel::readFromValue(const TSharedPtr<F
     for (int32 Idx = 0; Idx < LocationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LocationsArray[Idx];
-        Locations.Add(FLocationModel(CurrentItem->AsObject()));
+        Locations.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10605,7 +17452,7 @@ bool PlayFab::AdminModels::FPlayerProfileModel::readFromValue(const TSharedPtr<F
     for (int32 Idx = 0; Idx < MembershipsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = MembershipsArray[Idx];
-        Memberships.Add(FMembershipModel(CurrentItem->AsObject()));
+        Memberships.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10629,7 +17476,7 @@ bool PlayFab::AdminModels::FPlayerProfileModel::readFromValue(const TSharedPtr<F
     for (int32 Idx = 0; Idx < PushNotificationRegistrationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PushNotificationRegistrationsArray[Idx];
-        PushNotificationRegistrations.Add(FPushNotificationRegistrationModel(CurrentItem->AsObject()));
+        PushNotificationRegistrations.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10637,7 +17484,7 @@ bool PlayFab::AdminModels::FPlayerProfileModel::readFromValue(const TSharedPtr<F
     for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FStatisticModel(CurrentItem->AsObject()));
+        Statistics.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10645,7 +17492,7 @@ bool PlayFab::AdminModels::FPlayerProfileModel::readFromValue(const TSharedPtr<F
     for (int32 Idx = 0; Idx < TagsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = TagsArray[Idx];
-        Tags.Add(FTagModel(CurrentItem->AsObject()));
+        Tags.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10667,20 +17514,194 @@ bool PlayFab::AdminModels::FPlayerProfileModel::readFromValue(const TSharedPtr<F
     for (int32 Idx = 0; Idx < ValuesToDateArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ValuesToDateArray[Idx];
-        ValuesToDate.Add(FValueToDateModel(CurrentItem->AsObject()));
+        ValuesToDate.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FPlayerProfileModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AdCampaignAttributions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { AdCampaignAttributions[AdCampaignAttributions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("AvatarUrl"))
+        {
+            reader.ReadValue(AvatarUrl);
+        }
+        else if (reader.IsField("BannedUntil"))
+        {
+            reader.ReadValue(BannedUntil);
+        }
+        else if (reader.IsField("ContactEmailAddresses"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ContactEmailAddresses[ContactEmailAddresses.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("ExperimentVariants"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ExperimentVariants.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("LastLogin"))
+        {
+            reader.ReadValue(LastLogin);
+        }
+        else if (reader.IsField("LinkedAccounts"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { LinkedAccounts[LinkedAccounts.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Locations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Locations[Locations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Memberships"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Memberships[Memberships.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Origination"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Origination = readLoginIdentityProviderFromValue(TmpValue); }
+        }
+        else if (reader.IsField("PlayerId"))
+        {
+            reader.ReadValue(PlayerId);
+        }
+        else if (reader.IsField("PublisherId"))
+        {
+            reader.ReadValue(PublisherId);
+        }
+        else if (reader.IsField("PushNotificationRegistrations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { PushNotificationRegistrations[PushNotificationRegistrations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Statistics"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Statistics[Statistics.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Tags[Tags.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else if (reader.IsField("TotalValueToDateInUSD"))
+        {
+            reader.ReadValue(TotalValueToDateInUSD);
+        }
+        else if (reader.IsField("ValuesToDate"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ValuesToDate[ValuesToDate.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerProfileModel();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPlayerProfileResult::~FGetPlayerProfileResult()
 {
     //if (PlayerProfile != nullptr) delete PlayerProfile;
 
 }
 
-void PlayFab::AdminModels::FGetPlayerProfileResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPlayerProfileResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10693,6 +17714,16 @@ void PlayFab::AdminModels::FGetPlayerProfileResult::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPlayerProfileResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPlayerProfileResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPlayerProfileResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10700,18 +17731,46 @@ bool PlayFab::AdminModels::FGetPlayerProfileResult::readFromValue(const TSharedP
     const TSharedPtr<FJsonValue> PlayerProfileValue = obj->TryGetField(TEXT("PlayerProfile"));
     if (PlayerProfileValue.IsValid() && !PlayerProfileValue->IsNull())
     {
-        PlayerProfile = MakeShareable(new FPlayerProfileModel(PlayerProfileValue->AsObject()));
+        PlayerProfile = MakeShared<FPlayerProfileModel>(PlayerProfileValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPlayerProfileResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayerProfile"))
+        {
+            PlayerProfile = MakeShared<FPlayerProfileModel>();
+            PlayerProfile->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerProfileResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPlayerSegmentsResult::~FGetPlayerSegmentsResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPlayerSegmentsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPlayerSegmentsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10727,6 +17786,16 @@ void PlayFab::AdminModels::FGetPlayerSegmentsResult::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPlayerSegmentsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPlayerSegmentsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPlayerSegmentsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10735,25 +17804,69 @@ bool PlayFab::AdminModels::FGetPlayerSegmentsResult::readFromValue(const TShared
     for (int32 Idx = 0; Idx < SegmentsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = SegmentsArray[Idx];
-        Segments.Add(FGetSegmentResult(CurrentItem->AsObject()));
+        Segments.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPlayerSegmentsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Segments"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Segments[Segments.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerSegmentsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPlayerSharedSecretsRequest::~FGetPlayerSharedSecretsRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPlayerSharedSecretsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPlayerSharedSecretsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPlayerSharedSecretsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPlayerSharedSecretsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPlayerSharedSecretsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10761,12 +17874,34 @@ bool PlayFab::AdminModels::FGetPlayerSharedSecretsRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPlayerSharedSecretsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerSharedSecretsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSharedSecret::~FSharedSecret()
 {
 
 }
 
-void PlayFab::AdminModels::FSharedSecret::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSharedSecret::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10785,7 +17920,17 @@ void PlayFab::AdminModels::FSharedSecret::writeJSON(JsonWriter& writer) const
         writer->WriteValue(SecretKey);
     }
 
-    writer->WriteObjectEnd();
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::AdminModels::FSharedSecret::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSharedSecret::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::AdminModels::FSharedSecret::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -10816,12 +17961,47 @@ bool PlayFab::AdminModels::FSharedSecret::readFromValue(const TSharedPtr<FJsonOb
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSharedSecret::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Disabled"))
+        {
+            reader.ReadValue(Disabled);
+        }
+        else if (reader.IsField("FriendlyName"))
+        {
+            reader.ReadValue(FriendlyName);
+        }
+        else if (reader.IsField("SecretKey"))
+        {
+            reader.ReadValue(SecretKey);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSharedSecret();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPlayerSharedSecretsResult::~FGetPlayerSharedSecretsResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPlayerSharedSecretsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPlayerSharedSecretsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10837,6 +18017,16 @@ void PlayFab::AdminModels::FGetPlayerSharedSecretsResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPlayerSharedSecretsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPlayerSharedSecretsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPlayerSharedSecretsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10845,19 +18035,53 @@ bool PlayFab::AdminModels::FGetPlayerSharedSecretsResult::readFromValue(const TS
     for (int32 Idx = 0; Idx < SharedSecretsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = SharedSecretsArray[Idx];
-        SharedSecrets.Add(FSharedSecret(CurrentItem->AsObject()));
+        SharedSecrets.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPlayerSharedSecretsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SharedSecrets"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { SharedSecrets[SharedSecrets.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerSharedSecretsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPlayersInSegmentRequest::~FGetPlayersInSegmentRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPlayersInSegmentRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPlayersInSegmentRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10903,6 +18127,16 @@ void PlayFab::AdminModels::FGetPlayersInSegmentRequest::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPlayersInSegmentRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPlayersInSegmentRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPlayersInSegmentRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10919,7 +18153,7 @@ bool PlayFab::AdminModels::FGetPlayersInSegmentRequest::readFromValue(const TSha
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -10947,12 +18181,62 @@ bool PlayFab::AdminModels::FGetPlayersInSegmentRequest::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPlayersInSegmentRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ContinuationToken"))
+        {
+            reader.ReadValue(ContinuationToken);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("MaxBatchSize"))
+        {
+            reader.ReadValue(MaxBatchSize);
+        }
+        else if (reader.IsField("SecondsToLive"))
+        {
+            reader.ReadValue(SecondsToLive);
+        }
+        else if (reader.IsField("SegmentId"))
+        {
+            reader.ReadValue(SegmentId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayersInSegmentRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FPlayerLinkedAccount::~FPlayerLinkedAccount()
 {
 
 }
 
-void PlayFab::AdminModels::FPlayerLinkedAccount::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FPlayerLinkedAccount::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10983,6 +18267,16 @@ void PlayFab::AdminModels::FPlayerLinkedAccount::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FPlayerLinkedAccount::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FPlayerLinkedAccount::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FPlayerLinkedAccount::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11013,12 +18307,52 @@ bool PlayFab::AdminModels::FPlayerLinkedAccount::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FPlayerLinkedAccount::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Email"))
+        {
+            reader.ReadValue(Email);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Platform = readLoginIdentityProviderFromValue(TmpValue); }
+        }
+        else if (reader.IsField("PlatformUserId"))
+        {
+            reader.ReadValue(PlatformUserId);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerLinkedAccount();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FPlayerLocation::~FPlayerLocation()
 {
 
 }
 
-void PlayFab::AdminModels::FPlayerLocation::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FPlayerLocation::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11049,6 +18383,16 @@ void PlayFab::AdminModels::FPlayerLocation::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FPlayerLocation::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FPlayerLocation::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FPlayerLocation::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11081,12 +18425,57 @@ bool PlayFab::AdminModels::FPlayerLocation::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FPlayerLocation::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("City"))
+        {
+            reader.ReadValue(City);
+        }
+        else if (reader.IsField("ContinentCode"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfContinentCode = readContinentCodeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("CountryCode"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfCountryCode = readCountryCodeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Latitude"))
+        {
+            reader.ReadValue(Latitude);
+        }
+        else if (reader.IsField("Longitude"))
+        {
+            reader.ReadValue(Longitude);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerLocation();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FPlayerStatistic::~FPlayerStatistic()
 {
 
 }
 
-void PlayFab::AdminModels::FPlayerStatistic::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FPlayerStatistic::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11111,6 +18500,16 @@ void PlayFab::AdminModels::FPlayerStatistic::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FPlayerStatistic::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FPlayerStatistic::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FPlayerStatistic::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11146,12 +18545,51 @@ bool PlayFab::AdminModels::FPlayerStatistic::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FPlayerStatistic::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("StatisticValue"))
+        {
+            reader.ReadValue(StatisticValue);
+        }
+        else if (reader.IsField("StatisticVersion"))
+        {
+            reader.ReadValue(StatisticVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerStatistic();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FPushNotificationRegistration::~FPushNotificationRegistration()
 {
 
 }
 
-void PlayFab::AdminModels::FPushNotificationRegistration::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FPushNotificationRegistration::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11170,6 +18608,16 @@ void PlayFab::AdminModels::FPushNotificationRegistration::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FPushNotificationRegistration::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FPushNotificationRegistration::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FPushNotificationRegistration::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11186,12 +18634,44 @@ bool PlayFab::AdminModels::FPushNotificationRegistration::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FPushNotificationRegistration::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("NotificationEndpointARN"))
+        {
+            reader.ReadValue(NotificationEndpointARN);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Platform = readPushNotificationPlatformFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPushNotificationRegistration();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FPlayerProfile::~FPlayerProfile()
 {
 
 }
 
-void PlayFab::AdminModels::FPlayerProfile::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FPlayerProfile::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11365,6 +18845,16 @@ void PlayFab::AdminModels::FPlayerProfile::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FPlayerProfile::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FPlayerProfile::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FPlayerProfile::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11373,7 +18863,7 @@ bool PlayFab::AdminModels::FPlayerProfile::readFromValue(const TSharedPtr<FJsonO
     for (int32 Idx = 0; Idx < AdCampaignAttributionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = AdCampaignAttributionsArray[Idx];
-        AdCampaignAttributions.Add(FAdCampaignAttribution(CurrentItem->AsObject()));
+        AdCampaignAttributions.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -11393,7 +18883,7 @@ bool PlayFab::AdminModels::FPlayerProfile::readFromValue(const TSharedPtr<FJsonO
     for (int32 Idx = 0; Idx < ContactEmailAddressesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ContactEmailAddressesArray[Idx];
-        ContactEmailAddresses.Add(FContactEmailInfo(CurrentItem->AsObject()));
+        ContactEmailAddresses.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -11418,7 +18908,7 @@ bool PlayFab::AdminModels::FPlayerProfile::readFromValue(const TSharedPtr<FJsonO
     for (int32 Idx = 0; Idx < LinkedAccountsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = LinkedAccountsArray[Idx];
-        LinkedAccounts.Add(FPlayerLinkedAccount(CurrentItem->AsObject()));
+        LinkedAccounts.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -11427,7 +18917,7 @@ bool PlayFab::AdminModels::FPlayerProfile::readFromValue(const TSharedPtr<FJsonO
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*LocationsObject)->Values); It; ++It)
         {
-            Locations.Add(It.Key(), FPlayerLocation(It.Value()->AsObject()));
+            Locations.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -11446,7 +18936,7 @@ bool PlayFab::AdminModels::FPlayerProfile::readFromValue(const TSharedPtr<FJsonO
     for (int32 Idx = 0; Idx < PlayerStatisticsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PlayerStatisticsArray[Idx];
-        PlayerStatistics.Add(FPlayerStatistic(CurrentItem->AsObject()));
+        PlayerStatistics.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -11461,7 +18951,7 @@ bool PlayFab::AdminModels::FPlayerProfile::readFromValue(const TSharedPtr<FJsonO
     for (int32 Idx = 0; Idx < PushNotificationRegistrationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PushNotificationRegistrationsArray[Idx];
-        PushNotificationRegistrations.Add(FPushNotificationRegistration(CurrentItem->AsObject()));
+        PushNotificationRegistrations.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -11471,7 +18961,7 @@ bool PlayFab::AdminModels::FPlayerProfile::readFromValue(const TSharedPtr<FJsonO
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*StatisticsObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            Statistics.Add(It.Key(), TmpValue);
+            Statistics.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -11497,7 +18987,7 @@ bool PlayFab::AdminModels::FPlayerProfile::readFromValue(const TSharedPtr<FJsonO
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*ValuesToDateObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            ValuesToDate.Add(It.Key(), TmpValue);
+            ValuesToDate.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -11507,19 +18997,204 @@ bool PlayFab::AdminModels::FPlayerProfile::readFromValue(const TSharedPtr<FJsonO
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyBalancesObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrencyBalances.Add(It.Key(), TmpValue);
+            VirtualCurrencyBalances.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FPlayerProfile::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AdCampaignAttributions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { AdCampaignAttributions[AdCampaignAttributions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("AvatarUrl"))
+        {
+            reader.ReadValue(AvatarUrl);
+        }
+        else if (reader.IsField("BannedUntil"))
+        {
+            reader.ReadValue(BannedUntil);
+        }
+        else if (reader.IsField("ContactEmailAddresses"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ContactEmailAddresses[ContactEmailAddresses.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("LastLogin"))
+        {
+            reader.ReadValue(LastLogin);
+        }
+        else if (reader.IsField("LinkedAccounts"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { LinkedAccounts[LinkedAccounts.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Locations"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { Locations.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Origination"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Origination = readLoginIdentityProviderFromValue(TmpValue); }
+        }
+        else if (reader.IsField("PlayerExperimentVariants"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { PlayerExperimentVariants.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayerId"))
+        {
+            reader.ReadValue(PlayerId);
+        }
+        else if (reader.IsField("PlayerStatistics"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { PlayerStatistics[PlayerStatistics.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("PublisherId"))
+        {
+            reader.ReadValue(PublisherId);
+        }
+        else if (reader.IsField("PushNotificationRegistrations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { PushNotificationRegistrations[PushNotificationRegistrations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Statistics"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Statistics.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Tags.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else if (reader.IsField("TotalValueToDateInUSD"))
+        {
+            reader.ReadValue(TotalValueToDateInUSD);
+        }
+        else if (reader.IsField("ValuesToDate"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ValuesToDate.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyBalances"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrencyBalances.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerProfile();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPlayersInSegmentResult::~FGetPlayersInSegmentResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPlayersInSegmentResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPlayersInSegmentResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11544,6 +19219,16 @@ void PlayFab::AdminModels::FGetPlayersInSegmentResult::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPlayersInSegmentResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPlayersInSegmentResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPlayersInSegmentResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11559,18 +19244,59 @@ bool PlayFab::AdminModels::FGetPlayersInSegmentResult::readFromValue(const TShar
     for (int32 Idx = 0; Idx < PlayerProfilesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PlayerProfilesArray[Idx];
-        PlayerProfiles.Add(FPlayerProfile(CurrentItem->AsObject()));
+        PlayerProfiles.Emplace(CurrentItem->AsObject());
+    }
+
+
+    const TSharedPtr<FJsonValue> ProfilesInSegmentValue = obj->TryGetField(TEXT("ProfilesInSegment"));
+    if (ProfilesInSegmentValue.IsValid() && !ProfilesInSegmentValue->IsNull())
+    {
+        int32 TmpValue;
+        if (ProfilesInSegmentValue->TryGetNumber(TmpValue)) { ProfilesInSegment = TmpValue; }
+    }
+
+    return HasSucceeded;
+}
+
+bool PlayFab::AdminModels::FGetPlayersInSegmentResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ContinuationToken"))
+        {
+            reader.ReadValue(ContinuationToken);
+        }
+        else if (reader.IsField("PlayerProfiles"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { PlayerProfiles[PlayerProfiles.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("ProfilesInSegment"))
+        {
+            reader.ReadValue(ProfilesInSegment);
+        }
+        else
+            reader.SkipValue();
     }
 
-
-    const TSharedPtr<FJsonValue> ProfilesInSegmentValue = obj->TryGetField(TEXT("ProfilesInSegment"));
-    if (ProfilesInSegmentValue.IsValid() && !ProfilesInSegmentValue->IsNull())
+    if (!reader.IsValid())
     {
-        int32 TmpValue;
-        if (ProfilesInSegmentValue->TryGetNumber(TmpValue)) { ProfilesInSegment = TmpValue; }
+        *this = FGetPlayersInSegmentResult();
+        return false;
     }
-
-    return HasSucceeded;
+    return true;
 }
 
 PlayFab::AdminModels::FGetPlayersSegmentsRequest::~FGetPlayersSegmentsRequest()
@@ -11578,7 +19304,8 @@ PlayFab::AdminModels::FGetPlayersSegmentsRequest::~FGetPlayersSegmentsRequest()
 
 }
 
-void PlayFab::AdminModels::FGetPlayersSegmentsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPlayersSegmentsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11606,6 +19333,16 @@ void PlayFab::AdminModels::FGetPlayersSegmentsRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPlayersSegmentsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPlayersSegmentsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPlayersSegmentsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11615,7 +19352,7 @@ bool PlayFab::AdminModels::FGetPlayersSegmentsRequest::readFromValue(const TShar
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -11629,18 +19366,66 @@ bool PlayFab::AdminModels::FGetPlayersSegmentsRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPlayersSegmentsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayersSegmentsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPlayerStatisticDefinitionsRequest::~FGetPlayerStatisticDefinitionsRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPlayerStatisticDefinitionsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPlayerStatisticDefinitionsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPlayerStatisticDefinitionsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPlayerStatisticDefinitionsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPlayerStatisticDefinitionsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11648,12 +19433,34 @@ bool PlayFab::AdminModels::FGetPlayerStatisticDefinitionsRequest::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPlayerStatisticDefinitionsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerStatisticDefinitionsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPlayerStatisticDefinitionsResult::~FGetPlayerStatisticDefinitionsResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPlayerStatisticDefinitionsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPlayerStatisticDefinitionsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11669,6 +19476,16 @@ void PlayFab::AdminModels::FGetPlayerStatisticDefinitionsResult::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPlayerStatisticDefinitionsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPlayerStatisticDefinitionsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPlayerStatisticDefinitionsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11677,19 +19494,53 @@ bool PlayFab::AdminModels::FGetPlayerStatisticDefinitionsResult::readFromValue(c
     for (int32 Idx = 0; Idx < StatisticsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StatisticsArray[Idx];
-        Statistics.Add(FPlayerStatisticDefinition(CurrentItem->AsObject()));
+        Statistics.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPlayerStatisticDefinitionsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Statistics"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Statistics[Statistics.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerStatisticDefinitionsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPlayerStatisticVersionsRequest::~FGetPlayerStatisticVersionsRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPlayerStatisticVersionsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPlayerStatisticVersionsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11713,6 +19564,16 @@ void PlayFab::AdminModels::FGetPlayerStatisticVersionsRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPlayerStatisticVersionsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPlayerStatisticVersionsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPlayerStatisticVersionsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11722,7 +19583,7 @@ bool PlayFab::AdminModels::FGetPlayerStatisticVersionsRequest::readFromValue(con
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -11736,7 +19597,45 @@ bool PlayFab::AdminModels::FGetPlayerStatisticVersionsRequest::readFromValue(con
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeStatisticVersionStatusEnumJSON(StatisticVersionStatus enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FGetPlayerStatisticVersionsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerStatisticVersionsRequest();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeStatisticVersionStatusEnumValue(AdminModels::StatisticVersionStatus enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -11749,6 +19648,16 @@ void PlayFab::AdminModels::writeStatisticVersionStatusEnumJSON(StatisticVersionS
     }
 }
 
+void PlayFab::AdminModels::writeStatisticVersionStatusEnumJSON(StatisticVersionStatus enumVal, JsonWriter& writer)
+{
+    writeStatisticVersionStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeStatisticVersionStatusEnumJSON(StatisticVersionStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeStatisticVersionStatusEnumValue(enumVal, writer);
+}
+
 AdminModels::StatisticVersionStatus PlayFab::AdminModels::readStatisticVersionStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readStatisticVersionStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -11783,7 +19692,8 @@ PlayFab::AdminModels::FPlayerStatisticVersion::~FPlayerStatisticVersion()
 
 }
 
-void PlayFab::AdminModels::FPlayerStatisticVersion::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FPlayerStatisticVersion::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11832,6 +19742,16 @@ void PlayFab::AdminModels::FPlayerStatisticVersion::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FPlayerStatisticVersion::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FPlayerStatisticVersion::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FPlayerStatisticVersion::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11882,12 +19802,68 @@ bool PlayFab::AdminModels::FPlayerStatisticVersion::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FPlayerStatisticVersion::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ActivationTime"))
+        {
+            reader.ReadValue(ActivationTime);
+        }
+        else if (reader.IsField("ArchiveDownloadUrl"))
+        {
+            reader.ReadValue(ArchiveDownloadUrl);
+        }
+        else if (reader.IsField("DeactivationTime"))
+        {
+            reader.ReadValue(DeactivationTime);
+        }
+        else if (reader.IsField("ScheduledActivationTime"))
+        {
+            reader.ReadValue(ScheduledActivationTime);
+        }
+        else if (reader.IsField("ScheduledDeactivationTime"))
+        {
+            reader.ReadValue(ScheduledDeactivationTime);
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("Status"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Status = readStatisticVersionStatusFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerStatisticVersion();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPlayerStatisticVersionsResult::~FGetPlayerStatisticVersionsResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPlayerStatisticVersionsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPlayerStatisticVersionsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11903,6 +19879,16 @@ void PlayFab::AdminModels::FGetPlayerStatisticVersionsResult::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPlayerStatisticVersionsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPlayerStatisticVersionsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPlayerStatisticVersionsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11911,19 +19897,53 @@ bool PlayFab::AdminModels::FGetPlayerStatisticVersionsResult::readFromValue(cons
     for (int32 Idx = 0; Idx < StatisticVersionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StatisticVersionsArray[Idx];
-        StatisticVersions.Add(FPlayerStatisticVersion(CurrentItem->AsObject()));
+        StatisticVersions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPlayerStatisticVersionsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("StatisticVersions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { StatisticVersions[StatisticVersions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerStatisticVersionsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPlayerTagsRequest::~FGetPlayerTagsRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPlayerTagsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPlayerTagsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -11957,6 +19977,16 @@ void PlayFab::AdminModels::FGetPlayerTagsRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPlayerTagsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPlayerTagsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPlayerTagsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -11966,7 +19996,7 @@ bool PlayFab::AdminModels::FGetPlayerTagsRequest::readFromValue(const TSharedPtr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -11987,12 +20017,54 @@ bool PlayFab::AdminModels::FGetPlayerTagsRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPlayerTagsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Namespace"))
+        {
+            reader.ReadValue(Namespace);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerTagsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPlayerTagsResult::~FGetPlayerTagsResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPlayerTagsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPlayerTagsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12015,6 +20087,16 @@ void PlayFab::AdminModels::FGetPlayerTagsResult::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPlayerTagsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPlayerTagsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPlayerTagsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12031,12 +20113,50 @@ bool PlayFab::AdminModels::FGetPlayerTagsResult::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPlayerTagsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Tags"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Tags.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPlayerTagsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPolicyRequest::~FGetPolicyRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPolicyRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPolicyRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12049,6 +20169,16 @@ void PlayFab::AdminModels::FGetPolicyRequest::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPolicyRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPolicyRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPolicyRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12063,13 +20193,40 @@ bool PlayFab::AdminModels::FGetPolicyRequest::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPolicyRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PolicyName"))
+        {
+            reader.ReadValue(PolicyName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPolicyRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FPermissionStatement::~FPermissionStatement()
 {
     //if (ApiConditions != nullptr) delete ApiConditions;
 
 }
 
-void PlayFab::AdminModels::FPermissionStatement::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FPermissionStatement::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12121,6 +20278,16 @@ void PlayFab::AdminModels::FPermissionStatement::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FPermissionStatement::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FPermissionStatement::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FPermissionStatement::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12135,7 +20302,7 @@ bool PlayFab::AdminModels::FPermissionStatement::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonValue> ApiConditionsValue = obj->TryGetField(TEXT("ApiConditions"));
     if (ApiConditionsValue.IsValid() && !ApiConditionsValue->IsNull())
     {
-        ApiConditions = MakeShareable(new FApiCondition(ApiConditionsValue->AsObject()));
+        ApiConditions = MakeShared<FApiCondition>(ApiConditionsValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> CommentValue = obj->TryGetField(TEXT("Comment"));
@@ -12164,12 +20331,61 @@ bool PlayFab::AdminModels::FPermissionStatement::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FPermissionStatement::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Action"))
+        {
+            reader.ReadValue(Action);
+        }
+        else if (reader.IsField("ApiConditions"))
+        {
+            ApiConditions = MakeShared<FApiCondition>();
+            ApiConditions->readFromReader(reader);
+        }
+        else if (reader.IsField("Comment"))
+        {
+            reader.ReadValue(Comment);
+        }
+        else if (reader.IsField("Effect"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Effect = readEffectTypeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Principal"))
+        {
+            reader.ReadValue(Principal);
+        }
+        else if (reader.IsField("Resource"))
+        {
+            reader.ReadValue(Resource);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPermissionStatement();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPolicyResponse::~FGetPolicyResponse()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPolicyResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPolicyResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12191,7 +20407,17 @@ void PlayFab::AdminModels::FGetPolicyResponse::writeJSON(JsonWriter& writer) con
     }
 
 
-    writer->WriteObjectEnd();
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::AdminModels::FGetPolicyResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPolicyResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::AdminModels::FGetPolicyResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -12216,19 +20442,61 @@ bool PlayFab::AdminModels::FGetPolicyResponse::readFromValue(const TSharedPtr<FJ
     for (int32 Idx = 0; Idx < StatementsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StatementsArray[Idx];
-        Statements.Add(FPermissionStatement(CurrentItem->AsObject()));
+        Statements.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPolicyResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PolicyName"))
+        {
+            reader.ReadValue(PolicyName);
+        }
+        else if (reader.IsField("PolicyVersion"))
+        {
+            reader.ReadValue(PolicyVersion);
+        }
+        else if (reader.IsField("Statements"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Statements[Statements.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPolicyResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPublisherDataRequest::~FGetPublisherDataRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPublisherDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPublisherDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12241,6 +20509,16 @@ void PlayFab::AdminModels::FGetPublisherDataRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPublisherDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPublisherDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPublisherDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12250,12 +20528,46 @@ bool PlayFab::AdminModels::FGetPublisherDataRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPublisherDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Keys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Keys.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPublisherDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetPublisherDataResult::~FGetPublisherDataResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetPublisherDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetPublisherDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12273,6 +20585,16 @@ void PlayFab::AdminModels::FGetPublisherDataResult::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetPublisherDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetPublisherDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetPublisherDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12282,19 +20604,53 @@ bool PlayFab::AdminModels::FGetPublisherDataResult::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetPublisherDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetPublisherDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetRandomResultTablesRequest::~FGetRandomResultTablesRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetRandomResultTablesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetRandomResultTablesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12307,6 +20663,16 @@ void PlayFab::AdminModels::FGetRandomResultTablesRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetRandomResultTablesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetRandomResultTablesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetRandomResultTablesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12321,7 +20687,34 @@ bool PlayFab::AdminModels::FGetRandomResultTablesRequest::readFromValue(const TS
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeResultTableNodeTypeEnumJSON(ResultTableNodeType enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FGetRandomResultTablesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetRandomResultTablesRequest();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeResultTableNodeTypeEnumValue(AdminModels::ResultTableNodeType enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -12331,6 +20724,16 @@ void PlayFab::AdminModels::writeResultTableNodeTypeEnumJSON(ResultTableNodeType
     }
 }
 
+void PlayFab::AdminModels::writeResultTableNodeTypeEnumJSON(ResultTableNodeType enumVal, JsonWriter& writer)
+{
+    writeResultTableNodeTypeEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeResultTableNodeTypeEnumJSON(ResultTableNodeType enumVal, JsonUtf8Writer& writer)
+{
+    writeResultTableNodeTypeEnumValue(enumVal, writer);
+}
+
 AdminModels::ResultTableNodeType PlayFab::AdminModels::readResultTableNodeTypeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readResultTableNodeTypeFromValue(value.IsValid() ? value->AsString() : "");
@@ -12362,7 +20765,8 @@ PlayFab::AdminModels::FResultTableNode::~FResultTableNode()
 
 }
 
-void PlayFab::AdminModels::FResultTableNode::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FResultTableNode::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12385,6 +20789,16 @@ void PlayFab::AdminModels::FResultTableNode::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FResultTableNode::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FResultTableNode::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FResultTableNode::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12408,12 +20822,48 @@ bool PlayFab::AdminModels::FResultTableNode::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FResultTableNode::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ResultItem"))
+        {
+            reader.ReadValue(ResultItem);
+        }
+        else if (reader.IsField("ResultItemType"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { ResultItemType = readResultTableNodeTypeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Weight"))
+        {
+            reader.ReadValue(Weight);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FResultTableNode();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRandomResultTableListing::~FRandomResultTableListing()
 {
 
 }
 
-void PlayFab::AdminModels::FRandomResultTableListing::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRandomResultTableListing::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12442,6 +20892,16 @@ void PlayFab::AdminModels::FRandomResultTableListing::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRandomResultTableListing::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRandomResultTableListing::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRandomResultTableListing::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12457,7 +20917,7 @@ bool PlayFab::AdminModels::FRandomResultTableListing::readFromValue(const TShare
     for (int32 Idx = 0; Idx < NodesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = NodesArray[Idx];
-        Nodes.Add(FResultTableNode(CurrentItem->AsObject()));
+        Nodes.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -12471,12 +20931,54 @@ bool PlayFab::AdminModels::FRandomResultTableListing::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRandomResultTableListing::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("Nodes"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Nodes[Nodes.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("TableId"))
+        {
+            reader.ReadValue(TableId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRandomResultTableListing();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetRandomResultTablesResult::~FGetRandomResultTablesResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetRandomResultTablesResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetRandomResultTablesResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12494,6 +20996,16 @@ void PlayFab::AdminModels::FGetRandomResultTablesResult::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetRandomResultTablesResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetRandomResultTablesResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetRandomResultTablesResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12503,19 +21015,53 @@ bool PlayFab::AdminModels::FGetRandomResultTablesResult::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*TablesObject)->Values); It; ++It)
         {
-            Tables.Add(It.Key(), FRandomResultTableListing(It.Value()->AsObject()));
+            Tables.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetRandomResultTablesResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Tables"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { Tables.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetRandomResultTablesResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetSegmentsRequest::~FGetSegmentsRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetSegmentsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetSegmentsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12528,6 +21074,16 @@ void PlayFab::AdminModels::FGetSegmentsRequest::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetSegmentsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetSegmentsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetSegmentsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12537,12 +21093,46 @@ bool PlayFab::AdminModels::FGetSegmentsRequest::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetSegmentsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SegmentIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { SegmentIds.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetSegmentsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetSegmentsResponse::~FGetSegmentsResponse()
 {
 
 }
 
-void PlayFab::AdminModels::FGetSegmentsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetSegmentsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12564,6 +21154,16 @@ void PlayFab::AdminModels::FGetSegmentsResponse::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetSegmentsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetSegmentsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetSegmentsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12579,19 +21179,57 @@ bool PlayFab::AdminModels::FGetSegmentsResponse::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < SegmentsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = SegmentsArray[Idx];
-        Segments.Add(FSegmentModel(CurrentItem->AsObject()));
+        Segments.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetSegmentsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ErrorMessage"))
+        {
+            reader.ReadValue(ErrorMessage);
+        }
+        else if (reader.IsField("Segments"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Segments[Segments.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetSegmentsResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetServerBuildInfoRequest::~FGetServerBuildInfoRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetServerBuildInfoRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetServerBuildInfoRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12608,6 +21246,16 @@ void PlayFab::AdminModels::FGetServerBuildInfoRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetServerBuildInfoRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetServerBuildInfoRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetServerBuildInfoRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12622,12 +21270,39 @@ bool PlayFab::AdminModels::FGetServerBuildInfoRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetServerBuildInfoRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetServerBuildInfoRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetServerBuildInfoResult::~FGetServerBuildInfoResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetServerBuildInfoResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetServerBuildInfoResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12682,6 +21357,16 @@ void PlayFab::AdminModels::FGetServerBuildInfoResult::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetServerBuildInfoResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetServerBuildInfoResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetServerBuildInfoResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12729,21 +21414,87 @@ bool PlayFab::AdminModels::FGetServerBuildInfoResult::readFromValue(const TShare
         if (MinFreeGameSlotsValue->TryGetNumber(TmpValue)) { MinFreeGameSlots = TmpValue; }
     }
 
-    Status = readGameBuildStatusFromValue(obj->TryGetField(TEXT("Status")));
-
-    const TSharedPtr<FJsonValue> TimestampValue = obj->TryGetField(TEXT("Timestamp"));
-    if (TimestampValue.IsValid())
-        Timestamp = readDatetime(TimestampValue);
-
-
-    const TSharedPtr<FJsonValue> TitleIdValue = obj->TryGetField(TEXT("TitleId"));
-    if (TitleIdValue.IsValid() && !TitleIdValue->IsNull())
+    Status = readGameBuildStatusFromValue(obj->TryGetField(TEXT("Status")));
+
+    const TSharedPtr<FJsonValue> TimestampValue = obj->TryGetField(TEXT("Timestamp"));
+    if (TimestampValue.IsValid())
+        Timestamp = readDatetime(TimestampValue);
+
+
+    const TSharedPtr<FJsonValue> TitleIdValue = obj->TryGetField(TEXT("TitleId"));
+    if (TitleIdValue.IsValid() && !TitleIdValue->IsNull())
+    {
+        FString TmpValue;
+        if (TitleIdValue->TryGetString(TmpValue)) { TitleId = TmpValue; }
+    }
+
+    return HasSucceeded;
+}
+
+bool PlayFab::AdminModels::FGetServerBuildInfoResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ActiveRegions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ActiveRegions.Add(readRegionFromValue(TmpValue)); }
+                }
+            }
+        }
+        else if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("Comment"))
+        {
+            reader.ReadValue(Comment);
+        }
+        else if (reader.IsField("ErrorMessage"))
+        {
+            reader.ReadValue(ErrorMessage);
+        }
+        else if (reader.IsField("MaxGamesPerHost"))
+        {
+            reader.ReadValue(MaxGamesPerHost);
+        }
+        else if (reader.IsField("MinFreeGameSlots"))
+        {
+            reader.ReadValue(MinFreeGameSlots);
+        }
+        else if (reader.IsField("Status"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Status = readGameBuildStatusFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Timestamp"))
+        {
+            reader.ReadValue(Timestamp);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
     {
-        FString TmpValue;
-        if (TitleIdValue->TryGetString(TmpValue)) { TitleId = TmpValue; }
+        *this = FGetServerBuildInfoResult();
+        return false;
     }
-
-    return HasSucceeded;
+    return true;
 }
 
 PlayFab::AdminModels::FGetServerBuildUploadURLRequest::~FGetServerBuildUploadURLRequest()
@@ -12751,7 +21502,8 @@ PlayFab::AdminModels::FGetServerBuildUploadURLRequest::~FGetServerBuildUploadURL
 
 }
 
-void PlayFab::AdminModels::FGetServerBuildUploadURLRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetServerBuildUploadURLRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12768,6 +21520,16 @@ void PlayFab::AdminModels::FGetServerBuildUploadURLRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetServerBuildUploadURLRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetServerBuildUploadURLRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetServerBuildUploadURLRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12782,12 +21544,39 @@ bool PlayFab::AdminModels::FGetServerBuildUploadURLRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetServerBuildUploadURLRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetServerBuildUploadURLRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetServerBuildUploadURLResult::~FGetServerBuildUploadURLResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetServerBuildUploadURLResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetServerBuildUploadURLResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12800,6 +21589,16 @@ void PlayFab::AdminModels::FGetServerBuildUploadURLResult::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetServerBuildUploadURLResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetServerBuildUploadURLResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetServerBuildUploadURLResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12814,12 +21613,39 @@ bool PlayFab::AdminModels::FGetServerBuildUploadURLResult::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetServerBuildUploadURLResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("URL"))
+        {
+            reader.ReadValue(URL);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetServerBuildUploadURLResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetStoreItemsRequest::~FGetStoreItemsRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetStoreItemsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetStoreItemsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12842,6 +21668,16 @@ void PlayFab::AdminModels::FGetStoreItemsRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetStoreItemsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetStoreItemsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetStoreItemsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12863,12 +21699,43 @@ bool PlayFab::AdminModels::FGetStoreItemsRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetStoreItemsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("StoreId"))
+        {
+            reader.ReadValue(StoreId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetStoreItemsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FStoreMarketingModel::~FStoreMarketingModel()
 {
 
 }
 
-void PlayFab::AdminModels::FStoreMarketingModel::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FStoreMarketingModel::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -12893,6 +21760,16 @@ void PlayFab::AdminModels::FStoreMarketingModel::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FStoreMarketingModel::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FStoreMarketingModel::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FStoreMarketingModel::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -12920,7 +21797,42 @@ bool PlayFab::AdminModels::FStoreMarketingModel::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeSourceTypeEnumJSON(SourceType enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FStoreMarketingModel::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("Metadata"))
+        {
+            Metadata.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStoreMarketingModel();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeSourceTypeEnumValue(AdminModels::SourceType enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -12935,6 +21847,16 @@ void PlayFab::AdminModels::writeSourceTypeEnumJSON(SourceType enumVal, JsonWrite
     }
 }
 
+void PlayFab::AdminModels::writeSourceTypeEnumJSON(SourceType enumVal, JsonWriter& writer)
+{
+    writeSourceTypeEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeSourceTypeEnumJSON(SourceType enumVal, JsonUtf8Writer& writer)
+{
+    writeSourceTypeEnumValue(enumVal, writer);
+}
+
 AdminModels::SourceType PlayFab::AdminModels::readSourceTypeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readSourceTypeFromValue(value.IsValid() ? value->AsString() : "");
@@ -12971,7 +21893,8 @@ PlayFab::AdminModels::FStoreItem::~FStoreItem()
 
 }
 
-void PlayFab::AdminModels::FStoreItem::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FStoreItem::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13022,6 +21945,16 @@ void PlayFab::AdminModels::FStoreItem::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FStoreItem::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FStoreItem::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FStoreItem::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13052,7 +21985,7 @@ bool PlayFab::AdminModels::FStoreItem::readFromValue(const TSharedPtr<FJsonObjec
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*RealCurrencyPricesObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            RealCurrencyPrices.Add(It.Key(), TmpValue);
+            RealCurrencyPrices.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -13062,20 +21995,77 @@ bool PlayFab::AdminModels::FStoreItem::readFromValue(const TSharedPtr<FJsonObjec
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyPricesObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrencyPrices.Add(It.Key(), TmpValue);
+            VirtualCurrencyPrices.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FStoreItem::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomData"))
+        {
+            CustomData.readFromReader(reader);
+        }
+        else if (reader.IsField("DisplayPosition"))
+        {
+            reader.ReadValue(DisplayPosition);
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else if (reader.IsField("RealCurrencyPrices"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { RealCurrencyPrices.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyPrices"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrencyPrices.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStoreItem();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetStoreItemsResult::~FGetStoreItemsResult()
 {
     //if (MarketingData != nullptr) delete MarketingData;
 
 }
 
-void PlayFab::AdminModels::FGetStoreItemsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetStoreItemsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13115,6 +22105,16 @@ void PlayFab::AdminModels::FGetStoreItemsResult::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetStoreItemsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetStoreItemsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetStoreItemsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13129,7 +22129,7 @@ bool PlayFab::AdminModels::FGetStoreItemsResult::readFromValue(const TSharedPtr<
     const TSharedPtr<FJsonValue> MarketingDataValue = obj->TryGetField(TEXT("MarketingData"));
     if (MarketingDataValue.IsValid() && !MarketingDataValue->IsNull())
     {
-        MarketingData = MakeShareable(new FStoreMarketingModel(MarketingDataValue->AsObject()));
+        MarketingData = MakeShared<FStoreMarketingModel>(MarketingDataValue->AsObject());
     }
 
     Source = readSourceTypeFromValue(obj->TryGetField(TEXT("Source")));
@@ -13138,7 +22138,7 @@ bool PlayFab::AdminModels::FGetStoreItemsResult::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < StoreArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StoreArray[Idx];
-        Store.Add(FStoreItem(CurrentItem->AsObject()));
+        Store.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -13152,12 +22152,64 @@ bool PlayFab::AdminModels::FGetStoreItemsResult::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetStoreItemsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("MarketingData"))
+        {
+            MarketingData = MakeShared<FStoreMarketingModel>();
+            MarketingData->readFromReader(reader);
+        }
+        else if (reader.IsField("Source"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Source = readSourceTypeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Store"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Store[Store.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("StoreId"))
+        {
+            reader.ReadValue(StoreId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetStoreItemsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetTaskInstanceRequest::~FGetTaskInstanceRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetTaskInstanceRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetTaskInstanceRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13174,6 +22226,16 @@ void PlayFab::AdminModels::FGetTaskInstanceRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetTaskInstanceRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetTaskInstanceRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetTaskInstanceRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13188,13 +22250,40 @@ bool PlayFab::AdminModels::FGetTaskInstanceRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetTaskInstanceRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TaskInstanceId"))
+        {
+            reader.ReadValue(TaskInstanceId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTaskInstanceRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetTaskInstancesRequest::~FGetTaskInstancesRequest()
 {
     //if (TaskIdentifier != nullptr) delete TaskIdentifier;
 
 }
 
-void PlayFab::AdminModels::FGetTaskInstancesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetTaskInstancesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13225,6 +22314,16 @@ void PlayFab::AdminModels::FGetTaskInstancesRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetTaskInstancesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetTaskInstancesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetTaskInstancesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13244,13 +22343,54 @@ bool PlayFab::AdminModels::FGetTaskInstancesRequest::readFromValue(const TShared
     const TSharedPtr<FJsonValue> TaskIdentifierValue = obj->TryGetField(TEXT("TaskIdentifier"));
     if (TaskIdentifierValue.IsValid() && !TaskIdentifierValue->IsNull())
     {
-        TaskIdentifier = MakeShareable(new FNameIdentifier(TaskIdentifierValue->AsObject()));
+        TaskIdentifier = MakeShared<FNameIdentifier>(TaskIdentifierValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeScheduledTaskTypeEnumJSON(ScheduledTaskType enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FGetTaskInstancesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("StartedAtRangeFrom"))
+        {
+            reader.ReadValue(StartedAtRangeFrom);
+        }
+        else if (reader.IsField("StartedAtRangeTo"))
+        {
+            reader.ReadValue(StartedAtRangeTo);
+        }
+        else if (reader.IsField("StatusFilter"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { StatusFilter = readTaskInstanceStatusFromValue(TmpValue); }
+        }
+        else if (reader.IsField("TaskIdentifier"))
+        {
+            TaskIdentifier = MakeShared<FNameIdentifier>();
+            TaskIdentifier->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTaskInstancesRequest();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeScheduledTaskTypeEnumValue(AdminModels::ScheduledTaskType enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -13262,6 +22402,16 @@ void PlayFab::AdminModels::writeScheduledTaskTypeEnumJSON(ScheduledTaskType enum
     }
 }
 
+void PlayFab::AdminModels::writeScheduledTaskTypeEnumJSON(ScheduledTaskType enumVal, JsonWriter& writer)
+{
+    writeScheduledTaskTypeEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeScheduledTaskTypeEnumJSON(ScheduledTaskType enumVal, JsonUtf8Writer& writer)
+{
+    writeScheduledTaskTypeEnumValue(enumVal, writer);
+}
+
 AdminModels::ScheduledTaskType PlayFab::AdminModels::readScheduledTaskTypeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readScheduledTaskTypeFromValue(value.IsValid() ? value->AsString() : "");
@@ -13296,7 +22446,8 @@ PlayFab::AdminModels::FTaskInstanceBasicSummary::~FTaskInstanceBasicSummary()
 
 }
 
-void PlayFab::AdminModels::FTaskInstanceBasicSummary::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FTaskInstanceBasicSummary::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13360,6 +22511,16 @@ void PlayFab::AdminModels::FTaskInstanceBasicSummary::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FTaskInstanceBasicSummary::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FTaskInstanceBasicSummary::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FTaskInstanceBasicSummary::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13407,19 +22568,84 @@ bool PlayFab::AdminModels::FTaskInstanceBasicSummary::readFromValue(const TShare
     const TSharedPtr<FJsonValue> TaskIdentifierValue = obj->TryGetField(TEXT("TaskIdentifier"));
     if (TaskIdentifierValue.IsValid() && !TaskIdentifierValue->IsNull())
     {
-        TaskIdentifier = MakeShareable(new FNameIdentifier(TaskIdentifierValue->AsObject()));
+        TaskIdentifier = MakeShared<FNameIdentifier>(TaskIdentifierValue->AsObject());
+    }
+
+    const TSharedPtr<FJsonValue> TaskInstanceIdValue = obj->TryGetField(TEXT("TaskInstanceId"));
+    if (TaskInstanceIdValue.IsValid() && !TaskInstanceIdValue->IsNull())
+    {
+        FString TmpValue;
+        if (TaskInstanceIdValue->TryGetString(TmpValue)) { TaskInstanceId = TmpValue; }
+    }
+
+    Type = readScheduledTaskTypeFromValue(obj->TryGetField(TEXT("Type")));
+
+    return HasSucceeded;
+}
+
+bool PlayFab::AdminModels::FTaskInstanceBasicSummary::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CompletedAt"))
+        {
+            reader.ReadValue(CompletedAt);
+        }
+        else if (reader.IsField("ErrorMessage"))
+        {
+            reader.ReadValue(ErrorMessage);
+        }
+        else if (reader.IsField("EstimatedSecondsRemaining"))
+        {
+            reader.ReadValue(EstimatedSecondsRemaining);
+        }
+        else if (reader.IsField("PercentComplete"))
+        {
+            reader.ReadValue(PercentComplete);
+        }
+        else if (reader.IsField("ScheduledByUserId"))
+        {
+            reader.ReadValue(ScheduledByUserId);
+        }
+        else if (reader.IsField("StartedAt"))
+        {
+            reader.ReadValue(StartedAt);
+        }
+        else if (reader.IsField("Status"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Status = readTaskInstanceStatusFromValue(TmpValue); }
+        }
+        else if (reader.IsField("TaskIdentifier"))
+        {
+            TaskIdentifier = MakeShared<FNameIdentifier>();
+            TaskIdentifier->readFromReader(reader);
+        }
+        else if (reader.IsField("TaskInstanceId"))
+        {
+            reader.ReadValue(TaskInstanceId);
+        }
+        else if (reader.IsField("Type"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Type = readScheduledTaskTypeFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
     }
 
-    const TSharedPtr<FJsonValue> TaskInstanceIdValue = obj->TryGetField(TEXT("TaskInstanceId"));
-    if (TaskInstanceIdValue.IsValid() && !TaskInstanceIdValue->IsNull())
+    if (!reader.IsValid())
     {
-        FString TmpValue;
-        if (TaskInstanceIdValue->TryGetString(TmpValue)) { TaskInstanceId = TmpValue; }
+        *this = FTaskInstanceBasicSummary();
+        return false;
     }
-
-    Type = readScheduledTaskTypeFromValue(obj->TryGetField(TEXT("Type")));
-
-    return HasSucceeded;
+    return true;
 }
 
 PlayFab::AdminModels::FGetTaskInstancesResult::~FGetTaskInstancesResult()
@@ -13427,7 +22653,8 @@ PlayFab::AdminModels::FGetTaskInstancesResult::~FGetTaskInstancesResult()
 
 }
 
-void PlayFab::AdminModels::FGetTaskInstancesResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetTaskInstancesResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13443,6 +22670,16 @@ void PlayFab::AdminModels::FGetTaskInstancesResult::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetTaskInstancesResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetTaskInstancesResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetTaskInstancesResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13451,20 +22688,54 @@ bool PlayFab::AdminModels::FGetTaskInstancesResult::readFromValue(const TSharedP
     for (int32 Idx = 0; Idx < SummariesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = SummariesArray[Idx];
-        Summaries.Add(FTaskInstanceBasicSummary(CurrentItem->AsObject()));
+        Summaries.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetTaskInstancesResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Summaries"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Summaries[Summaries.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTaskInstancesResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetTasksRequest::~FGetTasksRequest()
 {
     //if (Identifier != nullptr) delete Identifier;
 
 }
 
-void PlayFab::AdminModels::FGetTasksRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetTasksRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13477,6 +22748,16 @@ void PlayFab::AdminModels::FGetTasksRequest::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetTasksRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetTasksRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetTasksRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13484,18 +22765,46 @@ bool PlayFab::AdminModels::FGetTasksRequest::readFromValue(const TSharedPtr<FJso
     const TSharedPtr<FJsonValue> IdentifierValue = obj->TryGetField(TEXT("Identifier"));
     if (IdentifierValue.IsValid() && !IdentifierValue->IsNull())
     {
-        Identifier = MakeShareable(new FNameIdentifier(IdentifierValue->AsObject()));
+        Identifier = MakeShared<FNameIdentifier>(IdentifierValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetTasksRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Identifier"))
+        {
+            Identifier = MakeShared<FNameIdentifier>();
+            Identifier->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTasksRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FScheduledTask::~FScheduledTask()
 {
 
 }
 
-void PlayFab::AdminModels::FScheduledTask::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FScheduledTask::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13557,6 +22866,16 @@ void PlayFab::AdminModels::FScheduledTask::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FScheduledTask::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FScheduledTask::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FScheduledTask::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13617,12 +22936,72 @@ bool PlayFab::AdminModels::FScheduledTask::readFromValue(const TSharedPtr<FJsonO
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FScheduledTask::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("IsActive"))
+        {
+            reader.ReadValue(IsActive);
+        }
+        else if (reader.IsField("LastRunTime"))
+        {
+            reader.ReadValue(LastRunTime);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("NextRunTime"))
+        {
+            reader.ReadValue(NextRunTime);
+        }
+        else if (reader.IsField("Parameter"))
+        {
+            Parameter.readFromReader(reader);
+        }
+        else if (reader.IsField("Schedule"))
+        {
+            reader.ReadValue(Schedule);
+        }
+        else if (reader.IsField("TaskId"))
+        {
+            reader.ReadValue(TaskId);
+        }
+        else if (reader.IsField("Type"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Type = readScheduledTaskTypeFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FScheduledTask();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetTasksResult::~FGetTasksResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetTasksResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetTasksResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13638,6 +23017,16 @@ void PlayFab::AdminModels::FGetTasksResult::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetTasksResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetTasksResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetTasksResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13646,19 +23035,53 @@ bool PlayFab::AdminModels::FGetTasksResult::readFromValue(const TSharedPtr<FJson
     for (int32 Idx = 0; Idx < TasksArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = TasksArray[Idx];
-        Tasks.Add(FScheduledTask(CurrentItem->AsObject()));
+        Tasks.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetTasksResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Tasks"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Tasks[Tasks.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTasksResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetTitleDataRequest::~FGetTitleDataRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetTitleDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetTitleDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13680,6 +23103,16 @@ void PlayFab::AdminModels::FGetTitleDataRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetTitleDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetTitleDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetTitleDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13696,12 +23129,50 @@ bool PlayFab::AdminModels::FGetTitleDataRequest::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetTitleDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Keys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Keys.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("OverrideLabel"))
+        {
+            reader.ReadValue(OverrideLabel);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitleDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetTitleDataResult::~FGetTitleDataResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetTitleDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetTitleDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13719,6 +23190,16 @@ void PlayFab::AdminModels::FGetTitleDataResult::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetTitleDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetTitleDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetTitleDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13728,19 +23209,53 @@ bool PlayFab::AdminModels::FGetTitleDataResult::readFromValue(const TSharedPtr<F
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetTitleDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitleDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetUserBansRequest::~FGetUserBansRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetUserBansRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetUserBansRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13757,6 +23272,16 @@ void PlayFab::AdminModels::FGetUserBansRequest::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetUserBansRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetUserBansRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetUserBansRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13771,12 +23296,39 @@ bool PlayFab::AdminModels::FGetUserBansRequest::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetUserBansRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetUserBansRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetUserBansResult::~FGetUserBansResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetUserBansResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetUserBansResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13792,6 +23344,16 @@ void PlayFab::AdminModels::FGetUserBansResult::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetUserBansResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetUserBansResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetUserBansResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13800,19 +23362,53 @@ bool PlayFab::AdminModels::FGetUserBansResult::readFromValue(const TSharedPtr<FJ
     for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
+        BanData.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetUserBansResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BanData"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { BanData[BanData.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetUserBansResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetUserDataRequest::~FGetUserDataRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetUserDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetUserDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13844,6 +23440,16 @@ void PlayFab::AdminModels::FGetUserDataRequest::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetUserDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetUserDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetUserDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13867,7 +23473,49 @@ bool PlayFab::AdminModels::FGetUserDataRequest::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeUserDataPermissionEnumJSON(UserDataPermission enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FGetUserDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("IfChangedFromDataVersion"))
+        {
+            reader.ReadValue(IfChangedFromDataVersion);
+        }
+        else if (reader.IsField("Keys"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Keys.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetUserDataRequest();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeUserDataPermissionEnumValue(AdminModels::UserDataPermission enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -13877,6 +23525,16 @@ void PlayFab::AdminModels::writeUserDataPermissionEnumJSON(UserDataPermission en
     }
 }
 
+void PlayFab::AdminModels::writeUserDataPermissionEnumJSON(UserDataPermission enumVal, JsonWriter& writer)
+{
+    writeUserDataPermissionEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeUserDataPermissionEnumJSON(UserDataPermission enumVal, JsonUtf8Writer& writer)
+{
+    writeUserDataPermissionEnumValue(enumVal, writer);
+}
+
 AdminModels::UserDataPermission PlayFab::AdminModels::readUserDataPermissionFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readUserDataPermissionFromValue(value.IsValid() ? value->AsString() : "");
@@ -13908,7 +23566,8 @@ PlayFab::AdminModels::FUserDataRecord::~FUserDataRecord()
 
 }
 
-void PlayFab::AdminModels::FUserDataRecord::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserDataRecord::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13930,6 +23589,16 @@ void PlayFab::AdminModels::FUserDataRecord::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserDataRecord::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserDataRecord::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserDataRecord::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13941,14 +23610,49 @@ bool PlayFab::AdminModels::FUserDataRecord::readFromValue(const TSharedPtr<FJson
 
     Permission = readUserDataPermissionFromValue(obj->TryGetField(TEXT("Permission")));
 
-    const TSharedPtr<FJsonValue> ValueValue = obj->TryGetField(TEXT("Value"));
-    if (ValueValue.IsValid() && !ValueValue->IsNull())
+    const TSharedPtr<FJsonValue> ValueValue = obj->TryGetField(TEXT("Value"));
+    if (ValueValue.IsValid() && !ValueValue->IsNull())
+    {
+        FString TmpValue;
+        if (ValueValue->TryGetString(TmpValue)) { Value = TmpValue; }
+    }
+
+    return HasSucceeded;
+}
+
+bool PlayFab::AdminModels::FUserDataRecord::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
     {
-        FString TmpValue;
-        if (ValueValue->TryGetString(TmpValue)) { Value = TmpValue; }
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("LastUpdated"))
+        {
+            reader.ReadValue(LastUpdated);
+        }
+        else if (reader.IsField("Permission"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Permission = readUserDataPermissionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else
+            reader.SkipValue();
     }
 
-    return HasSucceeded;
+    if (!reader.IsValid())
+    {
+        *this = FUserDataRecord();
+        return false;
+    }
+    return true;
 }
 
 PlayFab::AdminModels::FGetUserDataResult::~FGetUserDataResult()
@@ -13956,7 +23660,8 @@ PlayFab::AdminModels::FGetUserDataResult::~FGetUserDataResult()
 
 }
 
-void PlayFab::AdminModels::FGetUserDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetUserDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -13983,6 +23688,16 @@ void PlayFab::AdminModels::FGetUserDataResult::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetUserDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetUserDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetUserDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -13992,7 +23707,7 @@ bool PlayFab::AdminModels::FGetUserDataResult::readFromValue(const TSharedPtr<FJ
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), FUserDataRecord(It.Value()->AsObject()));
+            Data.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -14013,12 +23728,54 @@ bool PlayFab::AdminModels::FGetUserDataResult::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetUserDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { Data.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("DataVersion"))
+        {
+            reader.ReadValue(DataVersion);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetUserDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetUserInventoryRequest::~FGetUserInventoryRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FGetUserInventoryRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetUserInventoryRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14046,6 +23803,16 @@ void PlayFab::AdminModels::FGetUserInventoryRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetUserInventoryRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetUserInventoryRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetUserInventoryRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14055,7 +23822,7 @@ bool PlayFab::AdminModels::FGetUserInventoryRequest::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -14069,12 +23836,50 @@ bool PlayFab::AdminModels::FGetUserInventoryRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetUserInventoryRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetUserInventoryRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FItemInstance::~FItemInstance()
 {
 
 }
 
-void PlayFab::AdminModels::FItemInstance::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FItemInstance::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14176,6 +23981,16 @@ void PlayFab::AdminModels::FItemInstance::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FItemInstance::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FItemInstance::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FItemInstance::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14208,7 +24023,7 @@ bool PlayFab::AdminModels::FItemInstance::readFromValue(const TSharedPtr<FJsonOb
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomDataObject)->Values); It; ++It)
         {
-            CustomData.Add(It.Key(), It.Value()->AsString());
+            CustomData.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -14281,12 +24096,109 @@ bool PlayFab::AdminModels::FItemInstance::readFromValue(const TSharedPtr<FJsonOb
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FItemInstance::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Annotation"))
+        {
+            reader.ReadValue(Annotation);
+        }
+        else if (reader.IsField("BundleContents"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { BundleContents.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("BundleParent"))
+        {
+            reader.ReadValue(BundleParent);
+        }
+        else if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomData"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomData.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("Expiration"))
+        {
+            reader.ReadValue(Expiration);
+        }
+        else if (reader.IsField("ItemClass"))
+        {
+            reader.ReadValue(ItemClass);
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("PurchaseDate"))
+        {
+            reader.ReadValue(PurchaseDate);
+        }
+        else if (reader.IsField("RemainingUses"))
+        {
+            reader.ReadValue(RemainingUses);
+        }
+        else if (reader.IsField("UnitCurrency"))
+        {
+            reader.ReadValue(UnitCurrency);
+        }
+        else if (reader.IsField("UnitPrice"))
+        {
+            reader.ReadValue(UnitPrice);
+        }
+        else if (reader.IsField("UsesIncrementedBy"))
+        {
+            reader.ReadValue(UsesIncrementedBy);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FItemInstance();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FVirtualCurrencyRechargeTime::~FVirtualCurrencyRechargeTime()
 {
 
 }
 
-void PlayFab::AdminModels::FVirtualCurrencyRechargeTime::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FVirtualCurrencyRechargeTime::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14302,6 +24214,16 @@ void PlayFab::AdminModels::FVirtualCurrencyRechargeTime::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FVirtualCurrencyRechargeTime::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FVirtualCurrencyRechargeTime::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FVirtualCurrencyRechargeTime::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14328,12 +24250,47 @@ bool PlayFab::AdminModels::FVirtualCurrencyRechargeTime::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FVirtualCurrencyRechargeTime::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("RechargeMax"))
+        {
+            reader.ReadValue(RechargeMax);
+        }
+        else if (reader.IsField("RechargeTime"))
+        {
+            reader.ReadValue(RechargeTime);
+        }
+        else if (reader.IsField("SecondsToRecharge"))
+        {
+            reader.ReadValue(SecondsToRecharge);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FVirtualCurrencyRechargeTime();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGetUserInventoryResult::~FGetUserInventoryResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGetUserInventoryResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGetUserInventoryResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14377,6 +24334,16 @@ void PlayFab::AdminModels::FGetUserInventoryResult::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGetUserInventoryResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGetUserInventoryResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGetUserInventoryResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14385,7 +24352,7 @@ bool PlayFab::AdminModels::FGetUserInventoryResult::readFromValue(const TSharedP
     for (int32 Idx = 0; Idx < InventoryArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = InventoryArray[Idx];
-        Inventory.Add(FItemInstance(CurrentItem->AsObject()));
+        Inventory.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -14402,7 +24369,7 @@ bool PlayFab::AdminModels::FGetUserInventoryResult::readFromValue(const TSharedP
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrency.Add(It.Key(), TmpValue);
+            VirtualCurrency.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -14411,19 +24378,79 @@ bool PlayFab::AdminModels::FGetUserInventoryResult::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyRechargeTimesObject)->Values); It; ++It)
         {
-            VirtualCurrencyRechargeTimes.Add(It.Key(), FVirtualCurrencyRechargeTime(It.Value()->AsObject()));
+            VirtualCurrencyRechargeTimes.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGetUserInventoryResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Inventory"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Inventory[Inventory.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrency.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyRechargeTimes"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { VirtualCurrencyRechargeTimes.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetUserInventoryResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGrantedItemInstance::~FGrantedItemInstance()
 {
 
 }
 
-void PlayFab::AdminModels::FGrantedItemInstance::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGrantedItemInstance::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14540,6 +24567,16 @@ void PlayFab::AdminModels::FGrantedItemInstance::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGrantedItemInstance::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGrantedItemInstance::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGrantedItemInstance::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14579,7 +24616,7 @@ bool PlayFab::AdminModels::FGrantedItemInstance::readFromValue(const TSharedPtr<
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomDataObject)->Values); It; ++It)
         {
-            CustomData.Add(It.Key(), It.Value()->AsString());
+            CustomData.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -14666,12 +24703,121 @@ bool PlayFab::AdminModels::FGrantedItemInstance::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGrantedItemInstance::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Annotation"))
+        {
+            reader.ReadValue(Annotation);
+        }
+        else if (reader.IsField("BundleContents"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { BundleContents.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("BundleParent"))
+        {
+            reader.ReadValue(BundleParent);
+        }
+        else if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CustomData"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomData.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("Expiration"))
+        {
+            reader.ReadValue(Expiration);
+        }
+        else if (reader.IsField("ItemClass"))
+        {
+            reader.ReadValue(ItemClass);
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("PurchaseDate"))
+        {
+            reader.ReadValue(PurchaseDate);
+        }
+        else if (reader.IsField("RemainingUses"))
+        {
+            reader.ReadValue(RemainingUses);
+        }
+        else if (reader.IsField("Result"))
+        {
+            reader.ReadValue(Result);
+        }
+        else if (reader.IsField("UnitCurrency"))
+        {
+            reader.ReadValue(UnitCurrency);
+        }
+        else if (reader.IsField("UnitPrice"))
+        {
+            reader.ReadValue(UnitPrice);
+        }
+        else if (reader.IsField("UsesIncrementedBy"))
+        {
+            reader.ReadValue(UsesIncrementedBy);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGrantedItemInstance();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FItemGrant::~FItemGrant()
 {
 
 }
 
-void PlayFab::AdminModels::FItemGrant::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FItemGrant::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14730,6 +24876,16 @@ void PlayFab::AdminModels::FItemGrant::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FItemGrant::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FItemGrant::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FItemGrant::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14753,27 +24909,87 @@ bool PlayFab::AdminModels::FItemGrant::readFromValue(const TSharedPtr<FJsonObjec
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
+        }
+    }
+
+    const TSharedPtr<FJsonValue> ItemIdValue = obj->TryGetField(TEXT("ItemId"));
+    if (ItemIdValue.IsValid() && !ItemIdValue->IsNull())
+    {
+        FString TmpValue;
+        if (ItemIdValue->TryGetString(TmpValue)) { ItemId = TmpValue; }
+    }
+
+    obj->TryGetStringArrayField(TEXT("KeysToRemove"), KeysToRemove);
+
+    const TSharedPtr<FJsonValue> PlayFabIdValue = obj->TryGetField(TEXT("PlayFabId"));
+    if (PlayFabIdValue.IsValid() && !PlayFabIdValue->IsNull())
+    {
+        FString TmpValue;
+        if (PlayFabIdValue->TryGetString(TmpValue)) { PlayFabId = TmpValue; }
+    }
+
+    return HasSucceeded;
+}
+
+bool PlayFab::AdminModels::FItemGrant::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Annotation"))
+        {
+            reader.ReadValue(Annotation);
+        }
+        else if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else if (reader.IsField("KeysToRemove"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { KeysToRemove.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
         }
+        else
+            reader.SkipValue();
     }
 
-    const TSharedPtr<FJsonValue> ItemIdValue = obj->TryGetField(TEXT("ItemId"));
-    if (ItemIdValue.IsValid() && !ItemIdValue->IsNull())
-    {
-        FString TmpValue;
-        if (ItemIdValue->TryGetString(TmpValue)) { ItemId = TmpValue; }
-    }
-
-    obj->TryGetStringArrayField(TEXT("KeysToRemove"), KeysToRemove);
-
-    const TSharedPtr<FJsonValue> PlayFabIdValue = obj->TryGetField(TEXT("PlayFabId"));
-    if (PlayFabIdValue.IsValid() && !PlayFabIdValue->IsNull())
+    if (!reader.IsValid())
     {
-        FString TmpValue;
-        if (PlayFabIdValue->TryGetString(TmpValue)) { PlayFabId = TmpValue; }
+        *this = FItemGrant();
+        return false;
     }
-
-    return HasSucceeded;
+    return true;
 }
 
 PlayFab::AdminModels::FGrantItemsToUsersRequest::~FGrantItemsToUsersRequest()
@@ -14781,7 +24997,8 @@ PlayFab::AdminModels::FGrantItemsToUsersRequest::~FGrantItemsToUsersRequest()
 
 }
 
-void PlayFab::AdminModels::FGrantItemsToUsersRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGrantItemsToUsersRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14811,6 +25028,16 @@ void PlayFab::AdminModels::FGrantItemsToUsersRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGrantItemsToUsersRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGrantItemsToUsersRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGrantItemsToUsersRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14827,7 +25054,7 @@ bool PlayFab::AdminModels::FGrantItemsToUsersRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -14835,19 +25062,68 @@ bool PlayFab::AdminModels::FGrantItemsToUsersRequest::readFromValue(const TShare
     for (int32 Idx = 0; Idx < ItemGrantsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ItemGrantsArray[Idx];
-        ItemGrants.Add(FItemGrant(CurrentItem->AsObject()));
+        ItemGrants.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGrantItemsToUsersRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ItemGrants"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ItemGrants[ItemGrants.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGrantItemsToUsersRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FGrantItemsToUsersResult::~FGrantItemsToUsersResult()
 {
 
 }
 
-void PlayFab::AdminModels::FGrantItemsToUsersResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FGrantItemsToUsersResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14863,6 +25139,16 @@ void PlayFab::AdminModels::FGrantItemsToUsersResult::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FGrantItemsToUsersResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FGrantItemsToUsersResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FGrantItemsToUsersResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14871,19 +25157,53 @@ bool PlayFab::AdminModels::FGrantItemsToUsersResult::readFromValue(const TShared
     for (int32 Idx = 0; Idx < ItemGrantResultsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ItemGrantResultsArray[Idx];
-        ItemGrantResults.Add(FGrantedItemInstance(CurrentItem->AsObject()));
+        ItemGrantResults.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FGrantItemsToUsersResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ItemGrantResults"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ItemGrantResults[ItemGrantResults.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGrantItemsToUsersResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityRequest::~FIncrementLimitedEditionItemAvailabilityRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -14920,6 +25240,16 @@ void PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityRequest::writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14943,7 +25273,7 @@ bool PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityRequest::read
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -14957,18 +25287,74 @@ bool PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityRequest::read
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Amount"))
+        {
+            reader.ReadValue(Amount);
+        }
+        else if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FIncrementLimitedEditionItemAvailabilityRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityResult::~FIncrementLimitedEditionItemAvailabilityResult()
 {
 
 }
 
-void PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -14976,12 +25362,34 @@ bool PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityResult::readF
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FIncrementLimitedEditionItemAvailabilityResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FIncrementLimitedEditionItemAvailabilityResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FIncrementPlayerStatisticVersionRequest::~FIncrementPlayerStatisticVersionRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FIncrementPlayerStatisticVersionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FIncrementPlayerStatisticVersionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15005,6 +25413,16 @@ void PlayFab::AdminModels::FIncrementPlayerStatisticVersionRequest::writeJSON(Js
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FIncrementPlayerStatisticVersionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FIncrementPlayerStatisticVersionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FIncrementPlayerStatisticVersionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15014,7 +25432,7 @@ bool PlayFab::AdminModels::FIncrementPlayerStatisticVersionRequest::readFromValu
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -15028,13 +25446,51 @@ bool PlayFab::AdminModels::FIncrementPlayerStatisticVersionRequest::readFromValu
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FIncrementPlayerStatisticVersionRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FIncrementPlayerStatisticVersionRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FIncrementPlayerStatisticVersionResult::~FIncrementPlayerStatisticVersionResult()
 {
     //if (StatisticVersion != nullptr) delete StatisticVersion;
 
 }
 
-void PlayFab::AdminModels::FIncrementPlayerStatisticVersionResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FIncrementPlayerStatisticVersionResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15047,6 +25503,16 @@ void PlayFab::AdminModels::FIncrementPlayerStatisticVersionResult::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FIncrementPlayerStatisticVersionResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FIncrementPlayerStatisticVersionResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FIncrementPlayerStatisticVersionResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15054,24 +25520,62 @@ bool PlayFab::AdminModels::FIncrementPlayerStatisticVersionResult::readFromValue
     const TSharedPtr<FJsonValue> StatisticVersionValue = obj->TryGetField(TEXT("StatisticVersion"));
     if (StatisticVersionValue.IsValid() && !StatisticVersionValue->IsNull())
     {
-        StatisticVersion = MakeShareable(new FPlayerStatisticVersion(StatisticVersionValue->AsObject()));
+        StatisticVersion = MakeShared<FPlayerStatisticVersion>(StatisticVersionValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FIncrementPlayerStatisticVersionResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("StatisticVersion"))
+        {
+            StatisticVersion = MakeShared<FPlayerStatisticVersion>();
+            StatisticVersion->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FIncrementPlayerStatisticVersionResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FListBuildsRequest::~FListBuildsRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FListBuildsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FListBuildsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FListBuildsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FListBuildsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FListBuildsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15079,12 +25583,34 @@ bool PlayFab::AdminModels::FListBuildsRequest::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FListBuildsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListBuildsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FListBuildsResult::~FListBuildsResult()
 {
 
 }
 
-void PlayFab::AdminModels::FListBuildsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FListBuildsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15100,6 +25626,16 @@ void PlayFab::AdminModels::FListBuildsResult::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FListBuildsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FListBuildsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FListBuildsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15108,25 +25644,69 @@ bool PlayFab::AdminModels::FListBuildsResult::readFromValue(const TSharedPtr<FJs
     for (int32 Idx = 0; Idx < BuildsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BuildsArray[Idx];
-        Builds.Add(FGetServerBuildInfoResult(CurrentItem->AsObject()));
+        Builds.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FListBuildsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Builds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Builds[Builds.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListBuildsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FListOpenIdConnectionRequest::~FListOpenIdConnectionRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FListOpenIdConnectionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FListOpenIdConnectionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FListOpenIdConnectionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FListOpenIdConnectionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FListOpenIdConnectionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15134,13 +25714,35 @@ bool PlayFab::AdminModels::FListOpenIdConnectionRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FListOpenIdConnectionRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListOpenIdConnectionRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FOpenIdConnection::~FOpenIdConnection()
 {
     //if (IssuerInformation != nullptr) delete IssuerInformation;
 
 }
 
-void PlayFab::AdminModels::FOpenIdConnection::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FOpenIdConnection::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15174,6 +25776,16 @@ void PlayFab::AdminModels::FOpenIdConnection::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FOpenIdConnection::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FOpenIdConnection::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FOpenIdConnection::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15209,18 +25821,62 @@ bool PlayFab::AdminModels::FOpenIdConnection::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonValue> IssuerInformationValue = obj->TryGetField(TEXT("IssuerInformation"));
     if (IssuerInformationValue.IsValid() && !IssuerInformationValue->IsNull())
     {
-        IssuerInformation = MakeShareable(new FOpenIdIssuerInformation(IssuerInformationValue->AsObject()));
+        IssuerInformation = MakeShared<FOpenIdIssuerInformation>(IssuerInformationValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FOpenIdConnection::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ClientId"))
+        {
+            reader.ReadValue(ClientId);
+        }
+        else if (reader.IsField("ClientSecret"))
+        {
+            reader.ReadValue(ClientSecret);
+        }
+        else if (reader.IsField("ConnectionId"))
+        {
+            reader.ReadValue(ConnectionId);
+        }
+        else if (reader.IsField("DiscoverConfiguration"))
+        {
+            reader.ReadValue(DiscoverConfiguration);
+        }
+        else if (reader.IsField("IssuerInformation"))
+        {
+            IssuerInformation = MakeShared<FOpenIdIssuerInformation>();
+            IssuerInformation->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FOpenIdConnection();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FListOpenIdConnectionResponse::~FListOpenIdConnectionResponse()
 {
 
 }
 
-void PlayFab::AdminModels::FListOpenIdConnectionResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FListOpenIdConnectionResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15236,6 +25892,16 @@ void PlayFab::AdminModels::FListOpenIdConnectionResponse::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FListOpenIdConnectionResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FListOpenIdConnectionResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FListOpenIdConnectionResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15244,23 +25910,67 @@ bool PlayFab::AdminModels::FListOpenIdConnectionResponse::readFromValue(const TS
     for (int32 Idx = 0; Idx < ConnectionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ConnectionsArray[Idx];
-        Connections.Add(FOpenIdConnection(CurrentItem->AsObject()));
+        Connections.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FListOpenIdConnectionResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Connections"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Connections[Connections.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListOpenIdConnectionResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FListVirtualCurrencyTypesRequest::~FListVirtualCurrencyTypesRequest()
 {
 
 }
 
+template <typename WriterType>
+void PlayFab::AdminModels::FListVirtualCurrencyTypesRequest::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
+
+    writer->WriteObjectEnd();
+}
+
 void PlayFab::AdminModels::FListVirtualCurrencyTypesRequest::writeJSON(JsonWriter& writer) const
 {
-    writer->WriteObjectStart();
+    writeJSONObject(writer);
+}
 
-    writer->WriteObjectEnd();
+void PlayFab::AdminModels::FListVirtualCurrencyTypesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::AdminModels::FListVirtualCurrencyTypesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -15270,12 +25980,34 @@ bool PlayFab::AdminModels::FListVirtualCurrencyTypesRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FListVirtualCurrencyTypesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListVirtualCurrencyTypesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FListVirtualCurrencyTypesResult::~FListVirtualCurrencyTypesResult()
 {
 
 }
 
-void PlayFab::AdminModels::FListVirtualCurrencyTypesResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FListVirtualCurrencyTypesResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15291,6 +26023,16 @@ void PlayFab::AdminModels::FListVirtualCurrencyTypesResult::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FListVirtualCurrencyTypesResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FListVirtualCurrencyTypesResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FListVirtualCurrencyTypesResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15299,19 +26041,53 @@ bool PlayFab::AdminModels::FListVirtualCurrencyTypesResult::readFromValue(const
     for (int32 Idx = 0; Idx < VirtualCurrenciesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = VirtualCurrenciesArray[Idx];
-        VirtualCurrencies.Add(FVirtualCurrencyData(CurrentItem->AsObject()));
+        VirtualCurrencies.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FListVirtualCurrencyTypesResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("VirtualCurrencies"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { VirtualCurrencies[VirtualCurrencies.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListVirtualCurrencyTypesResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FLookupUserAccountInfoRequest::~FLookupUserAccountInfoRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FLookupUserAccountInfoRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FLookupUserAccountInfoRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15342,6 +26118,16 @@ void PlayFab::AdminModels::FLookupUserAccountInfoRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FLookupUserAccountInfoRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FLookupUserAccountInfoRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FLookupUserAccountInfoRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15377,12 +26163,51 @@ bool PlayFab::AdminModels::FLookupUserAccountInfoRequest::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FLookupUserAccountInfoRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Email"))
+        {
+            reader.ReadValue(Email);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("TitleDisplayName"))
+        {
+            reader.ReadValue(TitleDisplayName);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLookupUserAccountInfoRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUserAndroidDeviceInfo::~FUserAndroidDeviceInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FUserAndroidDeviceInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserAndroidDeviceInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15395,6 +26220,16 @@ void PlayFab::AdminModels::FUserAndroidDeviceInfo::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserAndroidDeviceInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserAndroidDeviceInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserAndroidDeviceInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15409,12 +26244,39 @@ bool PlayFab::AdminModels::FUserAndroidDeviceInfo::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUserAndroidDeviceInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AndroidDeviceId"))
+        {
+            reader.ReadValue(AndroidDeviceId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserAndroidDeviceInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUserAppleIdInfo::~FUserAppleIdInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FUserAppleIdInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserAppleIdInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15427,6 +26289,16 @@ void PlayFab::AdminModels::FUserAppleIdInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserAppleIdInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserAppleIdInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserAppleIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15441,12 +26313,39 @@ bool PlayFab::AdminModels::FUserAppleIdInfo::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUserAppleIdInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AppleSubjectId"))
+        {
+            reader.ReadValue(AppleSubjectId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserAppleIdInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUserCustomIdInfo::~FUserCustomIdInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FUserCustomIdInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserCustomIdInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15459,6 +26358,16 @@ void PlayFab::AdminModels::FUserCustomIdInfo::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserCustomIdInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserCustomIdInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserCustomIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15473,12 +26382,39 @@ bool PlayFab::AdminModels::FUserCustomIdInfo::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUserCustomIdInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomId"))
+        {
+            reader.ReadValue(CustomId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserCustomIdInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUserFacebookInfo::~FUserFacebookInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FUserFacebookInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserFacebookInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15497,6 +26433,16 @@ void PlayFab::AdminModels::FUserFacebookInfo::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserFacebookInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserFacebookInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserFacebookInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15518,12 +26464,43 @@ bool PlayFab::AdminModels::FUserFacebookInfo::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUserFacebookInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FacebookId"))
+        {
+            reader.ReadValue(FacebookId);
+        }
+        else if (reader.IsField("FullName"))
+        {
+            reader.ReadValue(FullName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserFacebookInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUserFacebookInstantGamesIdInfo::~FUserFacebookInstantGamesIdInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FUserFacebookInstantGamesIdInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserFacebookInstantGamesIdInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15536,6 +26513,16 @@ void PlayFab::AdminModels::FUserFacebookInstantGamesIdInfo::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserFacebookInstantGamesIdInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserFacebookInstantGamesIdInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserFacebookInstantGamesIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15550,12 +26537,39 @@ bool PlayFab::AdminModels::FUserFacebookInstantGamesIdInfo::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUserFacebookInstantGamesIdInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FacebookInstantGamesId"))
+        {
+            reader.ReadValue(FacebookInstantGamesId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserFacebookInstantGamesIdInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUserGameCenterInfo::~FUserGameCenterInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FUserGameCenterInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserGameCenterInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15568,6 +26582,16 @@ void PlayFab::AdminModels::FUserGameCenterInfo::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserGameCenterInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserGameCenterInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserGameCenterInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15582,12 +26606,39 @@ bool PlayFab::AdminModels::FUserGameCenterInfo::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUserGameCenterInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GameCenterId"))
+        {
+            reader.ReadValue(GameCenterId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserGameCenterInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUserGoogleInfo::~FUserGoogleInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FUserGoogleInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserGoogleInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15624,6 +26675,16 @@ void PlayFab::AdminModels::FUserGoogleInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserGoogleInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserGoogleInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserGoogleInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15666,12 +26727,55 @@ bool PlayFab::AdminModels::FUserGoogleInfo::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUserGoogleInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GoogleEmail"))
+        {
+            reader.ReadValue(GoogleEmail);
+        }
+        else if (reader.IsField("GoogleGender"))
+        {
+            reader.ReadValue(GoogleGender);
+        }
+        else if (reader.IsField("GoogleId"))
+        {
+            reader.ReadValue(GoogleId);
+        }
+        else if (reader.IsField("GoogleLocale"))
+        {
+            reader.ReadValue(GoogleLocale);
+        }
+        else if (reader.IsField("GoogleName"))
+        {
+            reader.ReadValue(GoogleName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserGoogleInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUserIosDeviceInfo::~FUserIosDeviceInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FUserIosDeviceInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserIosDeviceInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15684,6 +26788,16 @@ void PlayFab::AdminModels::FUserIosDeviceInfo::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserIosDeviceInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserIosDeviceInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserIosDeviceInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15698,12 +26812,39 @@ bool PlayFab::AdminModels::FUserIosDeviceInfo::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUserIosDeviceInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("IosDeviceId"))
+        {
+            reader.ReadValue(IosDeviceId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserIosDeviceInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUserKongregateInfo::~FUserKongregateInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FUserKongregateInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserKongregateInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15722,6 +26863,16 @@ void PlayFab::AdminModels::FUserKongregateInfo::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserKongregateInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserKongregateInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserKongregateInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15733,14 +26884,44 @@ bool PlayFab::AdminModels::FUserKongregateInfo::readFromValue(const TSharedPtr<F
         if (KongregateIdValue->TryGetString(TmpValue)) { KongregateId = TmpValue; }
     }
 
-    const TSharedPtr<FJsonValue> KongregateNameValue = obj->TryGetField(TEXT("KongregateName"));
-    if (KongregateNameValue.IsValid() && !KongregateNameValue->IsNull())
+    const TSharedPtr<FJsonValue> KongregateNameValue = obj->TryGetField(TEXT("KongregateName"));
+    if (KongregateNameValue.IsValid() && !KongregateNameValue->IsNull())
+    {
+        FString TmpValue;
+        if (KongregateNameValue->TryGetString(TmpValue)) { KongregateName = TmpValue; }
+    }
+
+    return HasSucceeded;
+}
+
+bool PlayFab::AdminModels::FUserKongregateInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("KongregateId"))
+        {
+            reader.ReadValue(KongregateId);
+        }
+        else if (reader.IsField("KongregateName"))
+        {
+            reader.ReadValue(KongregateName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
     {
-        FString TmpValue;
-        if (KongregateNameValue->TryGetString(TmpValue)) { KongregateName = TmpValue; }
+        *this = FUserKongregateInfo();
+        return false;
     }
-
-    return HasSucceeded;
+    return true;
 }
 
 PlayFab::AdminModels::FUserNintendoSwitchAccountIdInfo::~FUserNintendoSwitchAccountIdInfo()
@@ -15748,7 +26929,8 @@ PlayFab::AdminModels::FUserNintendoSwitchAccountIdInfo::~FUserNintendoSwitchAcco
 
 }
 
-void PlayFab::AdminModels::FUserNintendoSwitchAccountIdInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserNintendoSwitchAccountIdInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15761,6 +26943,16 @@ void PlayFab::AdminModels::FUserNintendoSwitchAccountIdInfo::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserNintendoSwitchAccountIdInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserNintendoSwitchAccountIdInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserNintendoSwitchAccountIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15775,12 +26967,39 @@ bool PlayFab::AdminModels::FUserNintendoSwitchAccountIdInfo::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUserNintendoSwitchAccountIdInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("NintendoSwitchAccountSubjectId"))
+        {
+            reader.ReadValue(NintendoSwitchAccountSubjectId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserNintendoSwitchAccountIdInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUserNintendoSwitchDeviceIdInfo::~FUserNintendoSwitchDeviceIdInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FUserNintendoSwitchDeviceIdInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserNintendoSwitchDeviceIdInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15793,6 +27012,16 @@ void PlayFab::AdminModels::FUserNintendoSwitchDeviceIdInfo::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserNintendoSwitchDeviceIdInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserNintendoSwitchDeviceIdInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserNintendoSwitchDeviceIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15807,12 +27036,39 @@ bool PlayFab::AdminModels::FUserNintendoSwitchDeviceIdInfo::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUserNintendoSwitchDeviceIdInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("NintendoSwitchDeviceId"))
+        {
+            reader.ReadValue(NintendoSwitchDeviceId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserNintendoSwitchDeviceIdInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUserOpenIdInfo::~FUserOpenIdInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FUserOpenIdInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserOpenIdInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15837,6 +27093,16 @@ void PlayFab::AdminModels::FUserOpenIdInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserOpenIdInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserOpenIdInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserOpenIdInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15865,12 +27131,47 @@ bool PlayFab::AdminModels::FUserOpenIdInfo::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUserOpenIdInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ConnectionId"))
+        {
+            reader.ReadValue(ConnectionId);
+        }
+        else if (reader.IsField("Issuer"))
+        {
+            reader.ReadValue(Issuer);
+        }
+        else if (reader.IsField("Subject"))
+        {
+            reader.ReadValue(Subject);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserOpenIdInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUserPrivateAccountInfo::~FUserPrivateAccountInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FUserPrivateAccountInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserPrivateAccountInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15883,6 +27184,16 @@ void PlayFab::AdminModels::FUserPrivateAccountInfo::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserPrivateAccountInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserPrivateAccountInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserPrivateAccountInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15897,12 +27208,39 @@ bool PlayFab::AdminModels::FUserPrivateAccountInfo::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUserPrivateAccountInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Email"))
+        {
+            reader.ReadValue(Email);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserPrivateAccountInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUserPsnInfo::~FUserPsnInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FUserPsnInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserPsnInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -15921,6 +27259,16 @@ void PlayFab::AdminModels::FUserPsnInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserPsnInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserPsnInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserPsnInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -15942,7 +27290,38 @@ bool PlayFab::AdminModels::FUserPsnInfo::readFromValue(const TSharedPtr<FJsonObj
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeTitleActivationStatusEnumJSON(TitleActivationStatus enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FUserPsnInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PsnAccountId"))
+        {
+            reader.ReadValue(PsnAccountId);
+        }
+        else if (reader.IsField("PsnOnlineId"))
+        {
+            reader.ReadValue(PsnOnlineId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserPsnInfo();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeTitleActivationStatusEnumValue(AdminModels::TitleActivationStatus enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -15955,6 +27334,16 @@ void PlayFab::AdminModels::writeTitleActivationStatusEnumJSON(TitleActivationSta
     }
 }
 
+void PlayFab::AdminModels::writeTitleActivationStatusEnumJSON(TitleActivationStatus enumVal, JsonWriter& writer)
+{
+    writeTitleActivationStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeTitleActivationStatusEnumJSON(TitleActivationStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeTitleActivationStatusEnumValue(enumVal, writer);
+}
+
 AdminModels::TitleActivationStatus PlayFab::AdminModels::readTitleActivationStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readTitleActivationStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -15989,7 +27378,8 @@ PlayFab::AdminModels::FUserSteamInfo::~FUserSteamInfo()
 
 }
 
-void PlayFab::AdminModels::FUserSteamInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserSteamInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16026,6 +27416,16 @@ void PlayFab::AdminModels::FUserSteamInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserSteamInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserSteamInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserSteamInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16058,7 +27458,52 @@ bool PlayFab::AdminModels::FUserSteamInfo::readFromValue(const TSharedPtr<FJsonO
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeUserOriginationEnumJSON(UserOrigination enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FUserSteamInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SteamActivationStatus"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { SteamActivationStatus = readTitleActivationStatusFromValue(TmpValue); }
+        }
+        else if (reader.IsField("SteamCountry"))
+        {
+            reader.ReadValue(SteamCountry);
+        }
+        else if (reader.IsField("SteamCurrency"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { SteamCurrency = readCurrencyFromValue(TmpValue); }
+        }
+        else if (reader.IsField("SteamId"))
+        {
+            reader.ReadValue(SteamId);
+        }
+        else if (reader.IsField("SteamName"))
+        {
+            reader.ReadValue(SteamName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserSteamInfo();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeUserOriginationEnumValue(AdminModels::UserOrigination enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -16090,6 +27535,16 @@ void PlayFab::AdminModels::writeUserOriginationEnumJSON(UserOrigination enumVal,
     }
 }
 
+void PlayFab::AdminModels::writeUserOriginationEnumJSON(UserOrigination enumVal, JsonWriter& writer)
+{
+    writeUserOriginationEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeUserOriginationEnumJSON(UserOrigination enumVal, JsonUtf8Writer& writer)
+{
+    writeUserOriginationEnumValue(enumVal, writer);
+}
+
 AdminModels::UserOrigination PlayFab::AdminModels::readUserOriginationFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readUserOriginationFromValue(value.IsValid() ? value->AsString() : "");
@@ -16144,7 +27599,8 @@ PlayFab::AdminModels::FUserTitleInfo::~FUserTitleInfo()
 
 }
 
-void PlayFab::AdminModels::FUserTitleInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserTitleInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16196,6 +27652,16 @@ void PlayFab::AdminModels::FUserTitleInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserTitleInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserTitleInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserTitleInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16241,18 +27707,75 @@ bool PlayFab::AdminModels::FUserTitleInfo::readFromValue(const TSharedPtr<FJsonO
     const TSharedPtr<FJsonValue> TitlePlayerAccountValue = obj->TryGetField(TEXT("TitlePlayerAccount"));
     if (TitlePlayerAccountValue.IsValid() && !TitlePlayerAccountValue->IsNull())
     {
-        TitlePlayerAccount = MakeShareable(new FEntityKey(TitlePlayerAccountValue->AsObject()));
+        TitlePlayerAccount = MakeShared<FEntityKey>(TitlePlayerAccountValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUserTitleInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AvatarUrl"))
+        {
+            reader.ReadValue(AvatarUrl);
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("FirstLogin"))
+        {
+            reader.ReadValue(FirstLogin);
+        }
+        else if (reader.IsField("isBanned"))
+        {
+            reader.ReadValue(isBanned);
+        }
+        else if (reader.IsField("LastLogin"))
+        {
+            reader.ReadValue(LastLogin);
+        }
+        else if (reader.IsField("Origination"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Origination = readUserOriginationFromValue(TmpValue); }
+        }
+        else if (reader.IsField("TitlePlayerAccount"))
+        {
+            TitlePlayerAccount = MakeShared<FEntityKey>();
+            TitlePlayerAccount->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserTitleInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUserTwitchInfo::~FUserTwitchInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FUserTwitchInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserTwitchInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16271,6 +27794,16 @@ void PlayFab::AdminModels::FUserTwitchInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserTwitchInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserTwitchInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserTwitchInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16292,12 +27825,43 @@ bool PlayFab::AdminModels::FUserTwitchInfo::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUserTwitchInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TwitchId"))
+        {
+            reader.ReadValue(TwitchId);
+        }
+        else if (reader.IsField("TwitchUserName"))
+        {
+            reader.ReadValue(TwitchUserName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserTwitchInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUserWindowsHelloInfo::~FUserWindowsHelloInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FUserWindowsHelloInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserWindowsHelloInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16316,6 +27880,16 @@ void PlayFab::AdminModels::FUserWindowsHelloInfo::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserWindowsHelloInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserWindowsHelloInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserWindowsHelloInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16337,12 +27911,43 @@ bool PlayFab::AdminModels::FUserWindowsHelloInfo::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUserWindowsHelloInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("WindowsHelloDeviceName"))
+        {
+            reader.ReadValue(WindowsHelloDeviceName);
+        }
+        else if (reader.IsField("WindowsHelloPublicKeyHash"))
+        {
+            reader.ReadValue(WindowsHelloPublicKeyHash);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserWindowsHelloInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUserXboxInfo::~FUserXboxInfo()
 {
 
 }
 
-void PlayFab::AdminModels::FUserXboxInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserXboxInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16355,6 +27960,16 @@ void PlayFab::AdminModels::FUserXboxInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserXboxInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserXboxInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserXboxInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16369,6 +27984,32 @@ bool PlayFab::AdminModels::FUserXboxInfo::readFromValue(const TSharedPtr<FJsonOb
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUserXboxInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("XboxUserId"))
+        {
+            reader.ReadValue(XboxUserId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserXboxInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUserAccountInfo::~FUserAccountInfo()
 {
     //if (AndroidDeviceInfo != nullptr) delete AndroidDeviceInfo;
@@ -16392,7 +28033,8 @@ PlayFab::AdminModels::FUserAccountInfo::~FUserAccountInfo()
 
 }
 
-void PlayFab::AdminModels::FUserAccountInfo::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUserAccountInfo::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16531,6 +28173,16 @@ void PlayFab::AdminModels::FUserAccountInfo::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUserAccountInfo::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUserAccountInfo::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUserAccountInfo::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16538,13 +28190,13 @@ bool PlayFab::AdminModels::FUserAccountInfo::readFromValue(const TSharedPtr<FJso
     const TSharedPtr<FJsonValue> AndroidDeviceInfoValue = obj->TryGetField(TEXT("AndroidDeviceInfo"));
     if (AndroidDeviceInfoValue.IsValid() && !AndroidDeviceInfoValue->IsNull())
     {
-        AndroidDeviceInfo = MakeShareable(new FUserAndroidDeviceInfo(AndroidDeviceInfoValue->AsObject()));
+        AndroidDeviceInfo = MakeShared<FUserAndroidDeviceInfo>(AndroidDeviceInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> AppleAccountInfoValue = obj->TryGetField(TEXT("AppleAccountInfo"));
     if (AppleAccountInfoValue.IsValid() && !AppleAccountInfoValue->IsNull())
     {
-        AppleAccountInfo = MakeShareable(new FUserAppleIdInfo(AppleAccountInfoValue->AsObject()));
+        AppleAccountInfo = MakeShared<FUserAppleIdInfo>(AppleAccountInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> CreatedValue = obj->TryGetField(TEXT("Created"));
@@ -16555,62 +28207,62 @@ bool PlayFab::AdminModels::FUserAccountInfo::readFromValue(const TSharedPtr<FJso
     const TSharedPtr<FJsonValue> CustomIdInfoValue = obj->TryGetField(TEXT("CustomIdInfo"));
     if (CustomIdInfoValue.IsValid() && !CustomIdInfoValue->IsNull())
     {
-        CustomIdInfo = MakeShareable(new FUserCustomIdInfo(CustomIdInfoValue->AsObject()));
+        CustomIdInfo = MakeShared<FUserCustomIdInfo>(CustomIdInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> FacebookInfoValue = obj->TryGetField(TEXT("FacebookInfo"));
     if (FacebookInfoValue.IsValid() && !FacebookInfoValue->IsNull())
     {
-        FacebookInfo = MakeShareable(new FUserFacebookInfo(FacebookInfoValue->AsObject()));
+        FacebookInfo = MakeShared<FUserFacebookInfo>(FacebookInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> FacebookInstantGamesIdInfoValue = obj->TryGetField(TEXT("FacebookInstantGamesIdInfo"));
     if (FacebookInstantGamesIdInfoValue.IsValid() && !FacebookInstantGamesIdInfoValue->IsNull())
     {
-        FacebookInstantGamesIdInfo = MakeShareable(new FUserFacebookInstantGamesIdInfo(FacebookInstantGamesIdInfoValue->AsObject()));
+        FacebookInstantGamesIdInfo = MakeShared<FUserFacebookInstantGamesIdInfo>(FacebookInstantGamesIdInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> GameCenterInfoValue = obj->TryGetField(TEXT("GameCenterInfo"));
     if (GameCenterInfoValue.IsValid() && !GameCenterInfoValue->IsNull())
     {
-        GameCenterInfo = MakeShareable(new FUserGameCenterInfo(GameCenterInfoValue->AsObject()));
+        GameCenterInfo = MakeShared<FUserGameCenterInfo>(GameCenterInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> GoogleInfoValue = obj->TryGetField(TEXT("GoogleInfo"));
     if (GoogleInfoValue.IsValid() && !GoogleInfoValue->IsNull())
     {
-        GoogleInfo = MakeShareable(new FUserGoogleInfo(GoogleInfoValue->AsObject()));
+        GoogleInfo = MakeShared<FUserGoogleInfo>(GoogleInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> IosDeviceInfoValue = obj->TryGetField(TEXT("IosDeviceInfo"));
     if (IosDeviceInfoValue.IsValid() && !IosDeviceInfoValue->IsNull())
     {
-        IosDeviceInfo = MakeShareable(new FUserIosDeviceInfo(IosDeviceInfoValue->AsObject()));
+        IosDeviceInfo = MakeShared<FUserIosDeviceInfo>(IosDeviceInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> KongregateInfoValue = obj->TryGetField(TEXT("KongregateInfo"));
     if (KongregateInfoValue.IsValid() && !KongregateInfoValue->IsNull())
     {
-        KongregateInfo = MakeShareable(new FUserKongregateInfo(KongregateInfoValue->AsObject()));
+        KongregateInfo = MakeShared<FUserKongregateInfo>(KongregateInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> NintendoSwitchAccountInfoValue = obj->TryGetField(TEXT("NintendoSwitchAccountInfo"));
     if (NintendoSwitchAccountInfoValue.IsValid() && !NintendoSwitchAccountInfoValue->IsNull())
     {
-        NintendoSwitchAccountInfo = MakeShareable(new FUserNintendoSwitchAccountIdInfo(NintendoSwitchAccountInfoValue->AsObject()));
+        NintendoSwitchAccountInfo = MakeShared<FUserNintendoSwitchAccountIdInfo>(NintendoSwitchAccountInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> NintendoSwitchDeviceIdInfoValue = obj->TryGetField(TEXT("NintendoSwitchDeviceIdInfo"));
     if (NintendoSwitchDeviceIdInfoValue.IsValid() && !NintendoSwitchDeviceIdInfoValue->IsNull())
     {
-        NintendoSwitchDeviceIdInfo = MakeShareable(new FUserNintendoSwitchDeviceIdInfo(NintendoSwitchDeviceIdInfoValue->AsObject()));
+        NintendoSwitchDeviceIdInfo = MakeShared<FUserNintendoSwitchDeviceIdInfo>(NintendoSwitchDeviceIdInfoValue->AsObject());
     }
 
     const TArray<TSharedPtr<FJsonValue>>&OpenIdInfoArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("OpenIdInfo"));
     for (int32 Idx = 0; Idx < OpenIdInfoArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = OpenIdInfoArray[Idx];
-        OpenIdInfo.Add(FUserOpenIdInfo(CurrentItem->AsObject()));
+        OpenIdInfo.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -16624,31 +28276,31 @@ bool PlayFab::AdminModels::FUserAccountInfo::readFromValue(const TSharedPtr<FJso
     const TSharedPtr<FJsonValue> PrivateInfoValue = obj->TryGetField(TEXT("PrivateInfo"));
     if (PrivateInfoValue.IsValid() && !PrivateInfoValue->IsNull())
     {
-        PrivateInfo = MakeShareable(new FUserPrivateAccountInfo(PrivateInfoValue->AsObject()));
+        PrivateInfo = MakeShared<FUserPrivateAccountInfo>(PrivateInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> PsnInfoValue = obj->TryGetField(TEXT("PsnInfo"));
     if (PsnInfoValue.IsValid() && !PsnInfoValue->IsNull())
     {
-        PsnInfo = MakeShareable(new FUserPsnInfo(PsnInfoValue->AsObject()));
+        PsnInfo = MakeShared<FUserPsnInfo>(PsnInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> SteamInfoValue = obj->TryGetField(TEXT("SteamInfo"));
     if (SteamInfoValue.IsValid() && !SteamInfoValue->IsNull())
     {
-        SteamInfo = MakeShareable(new FUserSteamInfo(SteamInfoValue->AsObject()));
+        SteamInfo = MakeShared<FUserSteamInfo>(SteamInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> TitleInfoValue = obj->TryGetField(TEXT("TitleInfo"));
     if (TitleInfoValue.IsValid() && !TitleInfoValue->IsNull())
     {
-        TitleInfo = MakeShareable(new FUserTitleInfo(TitleInfoValue->AsObject()));
+        TitleInfo = MakeShared<FUserTitleInfo>(TitleInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> TwitchInfoValue = obj->TryGetField(TEXT("TwitchInfo"));
     if (TwitchInfoValue.IsValid() && !TwitchInfoValue->IsNull())
     {
-        TwitchInfo = MakeShareable(new FUserTwitchInfo(TwitchInfoValue->AsObject()));
+        TwitchInfo = MakeShared<FUserTwitchInfo>(TwitchInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> UsernameValue = obj->TryGetField(TEXT("Username"));
@@ -16661,25 +28313,161 @@ bool PlayFab::AdminModels::FUserAccountInfo::readFromValue(const TSharedPtr<FJso
     const TSharedPtr<FJsonValue> WindowsHelloInfoValue = obj->TryGetField(TEXT("WindowsHelloInfo"));
     if (WindowsHelloInfoValue.IsValid() && !WindowsHelloInfoValue->IsNull())
     {
-        WindowsHelloInfo = MakeShareable(new FUserWindowsHelloInfo(WindowsHelloInfoValue->AsObject()));
+        WindowsHelloInfo = MakeShared<FUserWindowsHelloInfo>(WindowsHelloInfoValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> XboxInfoValue = obj->TryGetField(TEXT("XboxInfo"));
     if (XboxInfoValue.IsValid() && !XboxInfoValue->IsNull())
     {
-        XboxInfo = MakeShareable(new FUserXboxInfo(XboxInfoValue->AsObject()));
+        XboxInfo = MakeShared<FUserXboxInfo>(XboxInfoValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUserAccountInfo::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AndroidDeviceInfo"))
+        {
+            AndroidDeviceInfo = MakeShared<FUserAndroidDeviceInfo>();
+            AndroidDeviceInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("AppleAccountInfo"))
+        {
+            AppleAccountInfo = MakeShared<FUserAppleIdInfo>();
+            AppleAccountInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("CustomIdInfo"))
+        {
+            CustomIdInfo = MakeShared<FUserCustomIdInfo>();
+            CustomIdInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("FacebookInfo"))
+        {
+            FacebookInfo = MakeShared<FUserFacebookInfo>();
+            FacebookInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("FacebookInstantGamesIdInfo"))
+        {
+            FacebookInstantGamesIdInfo = MakeShared<FUserFacebookInstantGamesIdInfo>();
+            FacebookInstantGamesIdInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("GameCenterInfo"))
+        {
+            GameCenterInfo = MakeShared<FUserGameCenterInfo>();
+            GameCenterInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("GoogleInfo"))
+        {
+            GoogleInfo = MakeShared<FUserGoogleInfo>();
+            GoogleInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("IosDeviceInfo"))
+        {
+            IosDeviceInfo = MakeShared<FUserIosDeviceInfo>();
+            IosDeviceInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("KongregateInfo"))
+        {
+            KongregateInfo = MakeShared<FUserKongregateInfo>();
+            KongregateInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("NintendoSwitchAccountInfo"))
+        {
+            NintendoSwitchAccountInfo = MakeShared<FUserNintendoSwitchAccountIdInfo>();
+            NintendoSwitchAccountInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("NintendoSwitchDeviceIdInfo"))
+        {
+            NintendoSwitchDeviceIdInfo = MakeShared<FUserNintendoSwitchDeviceIdInfo>();
+            NintendoSwitchDeviceIdInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("OpenIdInfo"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { OpenIdInfo[OpenIdInfo.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("PrivateInfo"))
+        {
+            PrivateInfo = MakeShared<FUserPrivateAccountInfo>();
+            PrivateInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("PsnInfo"))
+        {
+            PsnInfo = MakeShared<FUserPsnInfo>();
+            PsnInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("SteamInfo"))
+        {
+            SteamInfo = MakeShared<FUserSteamInfo>();
+            SteamInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("TitleInfo"))
+        {
+            TitleInfo = MakeShared<FUserTitleInfo>();
+            TitleInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("TwitchInfo"))
+        {
+            TwitchInfo = MakeShared<FUserTwitchInfo>();
+            TwitchInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else if (reader.IsField("WindowsHelloInfo"))
+        {
+            WindowsHelloInfo = MakeShared<FUserWindowsHelloInfo>();
+            WindowsHelloInfo->readFromReader(reader);
+        }
+        else if (reader.IsField("XboxInfo"))
+        {
+            XboxInfo = MakeShared<FUserXboxInfo>();
+            XboxInfo->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserAccountInfo();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FLookupUserAccountInfoResult::~FLookupUserAccountInfoResult()
 {
     //if (UserInfo != nullptr) delete UserInfo;
 
 }
 
-void PlayFab::AdminModels::FLookupUserAccountInfoResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FLookupUserAccountInfoResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16692,6 +28480,16 @@ void PlayFab::AdminModels::FLookupUserAccountInfoResult::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FLookupUserAccountInfoResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FLookupUserAccountInfoResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FLookupUserAccountInfoResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16699,18 +28497,46 @@ bool PlayFab::AdminModels::FLookupUserAccountInfoResult::readFromValue(const TSh
     const TSharedPtr<FJsonValue> UserInfoValue = obj->TryGetField(TEXT("UserInfo"));
     if (UserInfoValue.IsValid() && !UserInfoValue->IsNull())
     {
-        UserInfo = MakeShareable(new FUserAccountInfo(UserInfoValue->AsObject()));
+        UserInfo = MakeShared<FUserAccountInfo>(UserInfoValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FLookupUserAccountInfoResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("UserInfo"))
+        {
+            UserInfo = MakeShared<FUserAccountInfo>();
+            UserInfo->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLookupUserAccountInfoResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FModifyMatchmakerGameModesRequest::~FModifyMatchmakerGameModesRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FModifyMatchmakerGameModesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FModifyMatchmakerGameModesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16733,6 +28559,16 @@ void PlayFab::AdminModels::FModifyMatchmakerGameModesRequest::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FModifyMatchmakerGameModesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FModifyMatchmakerGameModesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FModifyMatchmakerGameModesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16748,25 +28584,73 @@ bool PlayFab::AdminModels::FModifyMatchmakerGameModesRequest::readFromValue(cons
     for (int32 Idx = 0; Idx < GameModesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GameModesArray[Idx];
-        GameModes.Add(FGameModeInfo(CurrentItem->AsObject()));
+        GameModes.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FModifyMatchmakerGameModesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildVersion"))
+        {
+            reader.ReadValue(BuildVersion);
+        }
+        else if (reader.IsField("GameModes"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GameModes[GameModes.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FModifyMatchmakerGameModesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FModifyMatchmakerGameModesResult::~FModifyMatchmakerGameModesResult()
 {
 
 }
 
-void PlayFab::AdminModels::FModifyMatchmakerGameModesResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FModifyMatchmakerGameModesResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FModifyMatchmakerGameModesResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FModifyMatchmakerGameModesResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FModifyMatchmakerGameModesResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16774,12 +28658,34 @@ bool PlayFab::AdminModels::FModifyMatchmakerGameModesResult::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FModifyMatchmakerGameModesResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FModifyMatchmakerGameModesResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FModifyServerBuildRequest::~FModifyServerBuildRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FModifyServerBuildRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FModifyServerBuildRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16846,6 +28752,16 @@ void PlayFab::AdminModels::FModifyServerBuildRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FModifyServerBuildRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FModifyServerBuildRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FModifyServerBuildRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -16884,7 +28800,7 @@ bool PlayFab::AdminModels::FModifyServerBuildRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -16917,12 +28833,85 @@ bool PlayFab::AdminModels::FModifyServerBuildRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FModifyServerBuildRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ActiveRegions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ActiveRegions.Add(readRegionFromValue(TmpValue)); }
+                }
+            }
+        }
+        else if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("CommandLineTemplate"))
+        {
+            reader.ReadValue(CommandLineTemplate);
+        }
+        else if (reader.IsField("Comment"))
+        {
+            reader.ReadValue(Comment);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ExecutablePath"))
+        {
+            reader.ReadValue(ExecutablePath);
+        }
+        else if (reader.IsField("MaxGamesPerHost"))
+        {
+            reader.ReadValue(MaxGamesPerHost);
+        }
+        else if (reader.IsField("MinFreeGameSlots"))
+        {
+            reader.ReadValue(MinFreeGameSlots);
+        }
+        else if (reader.IsField("Timestamp"))
+        {
+            reader.ReadValue(Timestamp);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FModifyServerBuildRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FModifyServerBuildResult::~FModifyServerBuildResult()
 {
 
 }
 
-void PlayFab::AdminModels::FModifyServerBuildResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FModifyServerBuildResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -16983,6 +28972,16 @@ void PlayFab::AdminModels::FModifyServerBuildResult::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FModifyServerBuildResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FModifyServerBuildResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FModifyServerBuildResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17054,12 +29053,83 @@ bool PlayFab::AdminModels::FModifyServerBuildResult::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FModifyServerBuildResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ActiveRegions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ActiveRegions.Add(readRegionFromValue(TmpValue)); }
+                }
+            }
+        }
+        else if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("CommandLineTemplate"))
+        {
+            reader.ReadValue(CommandLineTemplate);
+        }
+        else if (reader.IsField("Comment"))
+        {
+            reader.ReadValue(Comment);
+        }
+        else if (reader.IsField("ExecutablePath"))
+        {
+            reader.ReadValue(ExecutablePath);
+        }
+        else if (reader.IsField("MaxGamesPerHost"))
+        {
+            reader.ReadValue(MaxGamesPerHost);
+        }
+        else if (reader.IsField("MinFreeGameSlots"))
+        {
+            reader.ReadValue(MinFreeGameSlots);
+        }
+        else if (reader.IsField("Status"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Status = readGameBuildStatusFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Timestamp"))
+        {
+            reader.ReadValue(Timestamp);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FModifyServerBuildResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FModifyUserVirtualCurrencyResult::~FModifyUserVirtualCurrencyResult()
 {
 
 }
 
-void PlayFab::AdminModels::FModifyUserVirtualCurrencyResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FModifyUserVirtualCurrencyResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17084,6 +29154,16 @@ void PlayFab::AdminModels::FModifyUserVirtualCurrencyResult::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FModifyUserVirtualCurrencyResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FModifyUserVirtualCurrencyResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FModifyUserVirtualCurrencyResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17119,7 +29199,46 @@ bool PlayFab::AdminModels::FModifyUserVirtualCurrencyResult::readFromValue(const
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writePushSetupPlatformEnumJSON(PushSetupPlatform enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FModifyUserVirtualCurrencyResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Balance"))
+        {
+            reader.ReadValue(Balance);
+        }
+        else if (reader.IsField("BalanceChange"))
+        {
+            reader.ReadValue(BalanceChange);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            reader.ReadValue(VirtualCurrency);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FModifyUserVirtualCurrencyResult();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writePushSetupPlatformEnumValue(AdminModels::PushSetupPlatform enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -17130,6 +29249,16 @@ void PlayFab::AdminModels::writePushSetupPlatformEnumJSON(PushSetupPlatform enum
     }
 }
 
+void PlayFab::AdminModels::writePushSetupPlatformEnumJSON(PushSetupPlatform enumVal, JsonWriter& writer)
+{
+    writePushSetupPlatformEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writePushSetupPlatformEnumJSON(PushSetupPlatform enumVal, JsonUtf8Writer& writer)
+{
+    writePushSetupPlatformEnumValue(enumVal, writer);
+}
+
 AdminModels::PushSetupPlatform PlayFab::AdminModels::readPushSetupPlatformFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readPushSetupPlatformFromValue(value.IsValid() ? value->AsString() : "");
@@ -17162,7 +29291,8 @@ PlayFab::AdminModels::FRandomResultTable::~FRandomResultTable()
 
 }
 
-void PlayFab::AdminModels::FRandomResultTable::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRandomResultTable::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17185,6 +29315,16 @@ void PlayFab::AdminModels::FRandomResultTable::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRandomResultTable::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRandomResultTable::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRandomResultTable::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17193,7 +29333,7 @@ bool PlayFab::AdminModels::FRandomResultTable::readFromValue(const TSharedPtr<FJ
     for (int32 Idx = 0; Idx < NodesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = NodesArray[Idx];
-        Nodes.Add(FResultTableNode(CurrentItem->AsObject()));
+        Nodes.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -17207,12 +29347,50 @@ bool PlayFab::AdminModels::FRandomResultTable::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRandomResultTable::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Nodes"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Nodes[Nodes.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("TableId"))
+        {
+            reader.ReadValue(TableId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRandomResultTable();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRefundPurchaseRequest::~FRefundPurchaseRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FRefundPurchaseRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRefundPurchaseRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17242,7 +29420,17 @@ void PlayFab::AdminModels::FRefundPurchaseRequest::writeJSON(JsonWriter& writer)
         writer->WriteValue(Reason);
     }
 
-    writer->WriteObjectEnd();
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::AdminModels::FRefundPurchaseRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRefundPurchaseRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::AdminModels::FRefundPurchaseRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -17273,12 +29461,47 @@ bool PlayFab::AdminModels::FRefundPurchaseRequest::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRefundPurchaseRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("OrderId"))
+        {
+            reader.ReadValue(OrderId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Reason"))
+        {
+            reader.ReadValue(Reason);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRefundPurchaseRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRefundPurchaseResponse::~FRefundPurchaseResponse()
 {
 
 }
 
-void PlayFab::AdminModels::FRefundPurchaseResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRefundPurchaseResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17291,6 +29514,16 @@ void PlayFab::AdminModels::FRefundPurchaseResponse::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRefundPurchaseResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRefundPurchaseResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRefundPurchaseResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17305,12 +29538,39 @@ bool PlayFab::AdminModels::FRefundPurchaseResponse::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRefundPurchaseResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PurchaseStatus"))
+        {
+            reader.ReadValue(PurchaseStatus);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRefundPurchaseResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRemovePlayerTagRequest::~FRemovePlayerTagRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FRemovePlayerTagRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRemovePlayerTagRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17348,6 +29608,16 @@ void PlayFab::AdminModels::FRemovePlayerTagRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRemovePlayerTagRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRemovePlayerTagRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRemovePlayerTagRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17357,7 +29627,7 @@ bool PlayFab::AdminModels::FRemovePlayerTagRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -17378,18 +29648,70 @@ bool PlayFab::AdminModels::FRemovePlayerTagRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRemovePlayerTagRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("TagName"))
+        {
+            reader.ReadValue(TagName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemovePlayerTagRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRemovePlayerTagResult::~FRemovePlayerTagResult()
 {
 
 }
 
-void PlayFab::AdminModels::FRemovePlayerTagResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRemovePlayerTagResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRemovePlayerTagResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRemovePlayerTagResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRemovePlayerTagResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17397,12 +29719,34 @@ bool PlayFab::AdminModels::FRemovePlayerTagResult::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRemovePlayerTagResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemovePlayerTagResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRemoveServerBuildRequest::~FRemoveServerBuildRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FRemoveServerBuildRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRemoveServerBuildRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17419,6 +29763,16 @@ void PlayFab::AdminModels::FRemoveServerBuildRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRemoveServerBuildRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRemoveServerBuildRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRemoveServerBuildRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17433,18 +29787,55 @@ bool PlayFab::AdminModels::FRemoveServerBuildRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRemoveServerBuildRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemoveServerBuildRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRemoveServerBuildResult::~FRemoveServerBuildResult()
 {
 
 }
 
-void PlayFab::AdminModels::FRemoveServerBuildResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRemoveServerBuildResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRemoveServerBuildResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRemoveServerBuildResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRemoveServerBuildResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17452,12 +29843,34 @@ bool PlayFab::AdminModels::FRemoveServerBuildResult::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRemoveServerBuildResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemoveServerBuildResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRemoveVirtualCurrencyTypesRequest::~FRemoveVirtualCurrencyTypesRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FRemoveVirtualCurrencyTypesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRemoveVirtualCurrencyTypesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17470,6 +29883,16 @@ void PlayFab::AdminModels::FRemoveVirtualCurrencyTypesRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRemoveVirtualCurrencyTypesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRemoveVirtualCurrencyTypesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRemoveVirtualCurrencyTypesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17478,19 +29901,53 @@ bool PlayFab::AdminModels::FRemoveVirtualCurrencyTypesRequest::readFromValue(con
     for (int32 Idx = 0; Idx < VirtualCurrenciesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = VirtualCurrenciesArray[Idx];
-        VirtualCurrencies.Add(FVirtualCurrencyData(CurrentItem->AsObject()));
+        VirtualCurrencies.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRemoveVirtualCurrencyTypesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("VirtualCurrencies"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { VirtualCurrencies[VirtualCurrencies.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemoveVirtualCurrencyTypesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FResetCharacterStatisticsRequest::~FResetCharacterStatisticsRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FResetCharacterStatisticsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FResetCharacterStatisticsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17528,6 +29985,16 @@ void PlayFab::AdminModels::FResetCharacterStatisticsRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FResetCharacterStatisticsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FResetCharacterStatisticsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FResetCharacterStatisticsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17544,7 +30011,7 @@ bool PlayFab::AdminModels::FResetCharacterStatisticsRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -17558,18 +30025,70 @@ bool PlayFab::AdminModels::FResetCharacterStatisticsRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FResetCharacterStatisticsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FResetCharacterStatisticsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FResetCharacterStatisticsResult::~FResetCharacterStatisticsResult()
 {
 
 }
 
-void PlayFab::AdminModels::FResetCharacterStatisticsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FResetCharacterStatisticsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FResetCharacterStatisticsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FResetCharacterStatisticsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FResetCharacterStatisticsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17577,12 +30096,34 @@ bool PlayFab::AdminModels::FResetCharacterStatisticsResult::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FResetCharacterStatisticsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FResetCharacterStatisticsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FResetPasswordRequest::~FResetPasswordRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FResetPasswordRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FResetPasswordRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17620,6 +30161,16 @@ void PlayFab::AdminModels::FResetPasswordRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FResetPasswordRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FResetPasswordRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FResetPasswordRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17629,7 +30180,7 @@ bool PlayFab::AdminModels::FResetPasswordRequest::readFromValue(const TSharedPtr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -17650,18 +30201,70 @@ bool PlayFab::AdminModels::FResetPasswordRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FResetPasswordRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Password"))
+        {
+            reader.ReadValue(Password);
+        }
+        else if (reader.IsField("Token"))
+        {
+            reader.ReadValue(Token);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FResetPasswordRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FResetPasswordResult::~FResetPasswordResult()
 {
 
 }
 
-void PlayFab::AdminModels::FResetPasswordResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FResetPasswordResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FResetPasswordResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FResetPasswordResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FResetPasswordResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17669,12 +30272,34 @@ bool PlayFab::AdminModels::FResetPasswordResult::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FResetPasswordResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FResetPasswordResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FResetUserStatisticsRequest::~FResetUserStatisticsRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FResetUserStatisticsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FResetUserStatisticsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17702,6 +30327,16 @@ void PlayFab::AdminModels::FResetUserStatisticsRequest::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FResetUserStatisticsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FResetUserStatisticsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FResetUserStatisticsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17711,7 +30346,7 @@ bool PlayFab::AdminModels::FResetUserStatisticsRequest::readFromValue(const TSha
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -17725,16 +30360,64 @@ bool PlayFab::AdminModels::FResetUserStatisticsRequest::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FResetUserStatisticsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FResetUserStatisticsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FResetUserStatisticsResult::~FResetUserStatisticsResult()
 {
 
 }
 
-void PlayFab::AdminModels::FResetUserStatisticsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FResetUserStatisticsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
-    writer->WriteObjectEnd();
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::AdminModels::FResetUserStatisticsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FResetUserStatisticsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::AdminModels::FResetUserStatisticsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -17744,7 +30427,29 @@ bool PlayFab::AdminModels::FResetUserStatisticsResult::readFromValue(const TShar
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeResolutionOutcomeEnumJSON(ResolutionOutcome enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FResetUserStatisticsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FResetUserStatisticsResult();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeResolutionOutcomeEnumValue(AdminModels::ResolutionOutcome enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -17755,6 +30460,16 @@ void PlayFab::AdminModels::writeResolutionOutcomeEnumJSON(ResolutionOutcome enum
     }
 }
 
+void PlayFab::AdminModels::writeResolutionOutcomeEnumJSON(ResolutionOutcome enumVal, JsonWriter& writer)
+{
+    writeResolutionOutcomeEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeResolutionOutcomeEnumJSON(ResolutionOutcome enumVal, JsonUtf8Writer& writer)
+{
+    writeResolutionOutcomeEnumValue(enumVal, writer);
+}
+
 AdminModels::ResolutionOutcome PlayFab::AdminModels::readResolutionOutcomeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readResolutionOutcomeFromValue(value.IsValid() ? value->AsString() : "");
@@ -17787,7 +30502,8 @@ PlayFab::AdminModels::FResolvePurchaseDisputeRequest::~FResolvePurchaseDisputeRe
 
 }
 
-void PlayFab::AdminModels::FResolvePurchaseDisputeRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FResolvePurchaseDisputeRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17823,6 +30539,16 @@ void PlayFab::AdminModels::FResolvePurchaseDisputeRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FResolvePurchaseDisputeRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FResolvePurchaseDisputeRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FResolvePurchaseDisputeRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17853,12 +30579,52 @@ bool PlayFab::AdminModels::FResolvePurchaseDisputeRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FResolvePurchaseDisputeRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("OrderId"))
+        {
+            reader.ReadValue(OrderId);
+        }
+        else if (reader.IsField("Outcome"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Outcome = readResolutionOutcomeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("Reason"))
+        {
+            reader.ReadValue(Reason);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FResolvePurchaseDisputeRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FResolvePurchaseDisputeResponse::~FResolvePurchaseDisputeResponse()
 {
 
 }
 
-void PlayFab::AdminModels::FResolvePurchaseDisputeResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FResolvePurchaseDisputeResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17871,6 +30637,16 @@ void PlayFab::AdminModels::FResolvePurchaseDisputeResponse::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FResolvePurchaseDisputeResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FResolvePurchaseDisputeResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FResolvePurchaseDisputeResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17885,12 +30661,39 @@ bool PlayFab::AdminModels::FResolvePurchaseDisputeResponse::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FResolvePurchaseDisputeResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PurchaseStatus"))
+        {
+            reader.ReadValue(PurchaseStatus);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FResolvePurchaseDisputeResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRevokeAllBansForUserRequest::~FRevokeAllBansForUserRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FRevokeAllBansForUserRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRevokeAllBansForUserRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17907,6 +30710,16 @@ void PlayFab::AdminModels::FRevokeAllBansForUserRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRevokeAllBansForUserRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRevokeAllBansForUserRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRevokeAllBansForUserRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17921,12 +30734,39 @@ bool PlayFab::AdminModels::FRevokeAllBansForUserRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRevokeAllBansForUserRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRevokeAllBansForUserRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRevokeAllBansForUserResult::~FRevokeAllBansForUserResult()
 {
 
 }
 
-void PlayFab::AdminModels::FRevokeAllBansForUserResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRevokeAllBansForUserResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17942,6 +30782,16 @@ void PlayFab::AdminModels::FRevokeAllBansForUserResult::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRevokeAllBansForUserResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRevokeAllBansForUserResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRevokeAllBansForUserResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17950,19 +30800,53 @@ bool PlayFab::AdminModels::FRevokeAllBansForUserResult::readFromValue(const TSha
     for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
+        BanData.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRevokeAllBansForUserResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BanData"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { BanData[BanData.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRevokeAllBansForUserResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRevokeBansRequest::~FRevokeBansRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FRevokeBansRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRevokeBansRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -17975,6 +30859,16 @@ void PlayFab::AdminModels::FRevokeBansRequest::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRevokeBansRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRevokeBansRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRevokeBansRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -17984,12 +30878,46 @@ bool PlayFab::AdminModels::FRevokeBansRequest::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRevokeBansRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BanIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { BanIds.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRevokeBansRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRevokeBansResult::~FRevokeBansResult()
 {
 
 }
 
-void PlayFab::AdminModels::FRevokeBansResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRevokeBansResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18005,6 +30933,16 @@ void PlayFab::AdminModels::FRevokeBansResult::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRevokeBansResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRevokeBansResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRevokeBansResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18013,19 +30951,53 @@ bool PlayFab::AdminModels::FRevokeBansResult::readFromValue(const TSharedPtr<FJs
     for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
+        BanData.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRevokeBansResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BanData"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { BanData[BanData.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRevokeBansResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRevokeInventoryItem::~FRevokeInventoryItem()
 {
 
 }
 
-void PlayFab::AdminModels::FRevokeInventoryItem::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRevokeInventoryItem::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18058,6 +31030,16 @@ void PlayFab::AdminModels::FRevokeInventoryItem::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRevokeInventoryItem::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRevokeInventoryItem::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRevokeInventoryItem::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18086,12 +31068,47 @@ bool PlayFab::AdminModels::FRevokeInventoryItem::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRevokeInventoryItem::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRevokeInventoryItem();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRevokeInventoryItemRequest::~FRevokeInventoryItemRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FRevokeInventoryItemRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRevokeInventoryItemRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18124,6 +31141,16 @@ void PlayFab::AdminModels::FRevokeInventoryItemRequest::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRevokeInventoryItemRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRevokeInventoryItemRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRevokeInventoryItemRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18152,12 +31179,47 @@ bool PlayFab::AdminModels::FRevokeInventoryItemRequest::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRevokeInventoryItemRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRevokeInventoryItemRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRevokeInventoryItemsRequest::~FRevokeInventoryItemsRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FRevokeInventoryItemsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRevokeInventoryItemsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18170,6 +31232,16 @@ void PlayFab::AdminModels::FRevokeInventoryItemsRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRevokeInventoryItemsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRevokeInventoryItemsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRevokeInventoryItemsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18178,20 +31250,54 @@ bool PlayFab::AdminModels::FRevokeInventoryItemsRequest::readFromValue(const TSh
     for (int32 Idx = 0; Idx < ItemsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ItemsArray[Idx];
-        Items.Add(FRevokeInventoryItem(CurrentItem->AsObject()));
+        Items.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRevokeInventoryItemsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Items"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Items[Items.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRevokeInventoryItemsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRevokeItemError::~FRevokeItemError()
 {
     //if (Item != nullptr) delete Item;
 
 }
 
-void PlayFab::AdminModels::FRevokeItemError::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRevokeItemError::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18210,6 +31316,16 @@ void PlayFab::AdminModels::FRevokeItemError::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRevokeItemError::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRevokeItemError::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRevokeItemError::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18224,18 +31340,50 @@ bool PlayFab::AdminModels::FRevokeItemError::readFromValue(const TSharedPtr<FJso
     const TSharedPtr<FJsonValue> ItemValue = obj->TryGetField(TEXT("Item"));
     if (ItemValue.IsValid() && !ItemValue->IsNull())
     {
-        Item = MakeShareable(new FRevokeInventoryItem(ItemValue->AsObject()));
+        Item = MakeShared<FRevokeInventoryItem>(ItemValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRevokeItemError::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Error"))
+        {
+            reader.ReadValue(Error);
+        }
+        else if (reader.IsField("Item"))
+        {
+            Item = MakeShared<FRevokeInventoryItem>();
+            Item->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRevokeItemError();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRevokeInventoryItemsResult::~FRevokeInventoryItemsResult()
 {
 
 }
 
-void PlayFab::AdminModels::FRevokeInventoryItemsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRevokeInventoryItemsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18251,6 +31399,16 @@ void PlayFab::AdminModels::FRevokeInventoryItemsResult::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRevokeInventoryItemsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRevokeInventoryItemsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRevokeInventoryItemsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18259,11 +31417,44 @@ bool PlayFab::AdminModels::FRevokeInventoryItemsResult::readFromValue(const TSha
     for (int32 Idx = 0; Idx < ErrorsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ErrorsArray[Idx];
-        Errors.Add(FRevokeItemError(CurrentItem->AsObject()));
+        Errors.Emplace(CurrentItem->AsObject());
+    }
+
+
+    return HasSucceeded;
+}
+
+bool PlayFab::AdminModels::FRevokeInventoryItemsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Errors"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Errors[Errors.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
     }
 
-
-    return HasSucceeded;
+    if (!reader.IsValid())
+    {
+        *this = FRevokeInventoryItemsResult();
+        return false;
+    }
+    return true;
 }
 
 PlayFab::AdminModels::FRevokeInventoryResult::~FRevokeInventoryResult()
@@ -18271,13 +31462,24 @@ PlayFab::AdminModels::FRevokeInventoryResult::~FRevokeInventoryResult()
 
 }
 
-void PlayFab::AdminModels::FRevokeInventoryResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRevokeInventoryResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRevokeInventoryResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRevokeInventoryResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRevokeInventoryResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18285,13 +31487,35 @@ bool PlayFab::AdminModels::FRevokeInventoryResult::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRevokeInventoryResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRevokeInventoryResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRunTaskRequest::~FRunTaskRequest()
 {
     //if (Identifier != nullptr) delete Identifier;
 
 }
 
-void PlayFab::AdminModels::FRunTaskRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRunTaskRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18315,6 +31539,16 @@ void PlayFab::AdminModels::FRunTaskRequest::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRunTaskRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRunTaskRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRunTaskRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18324,25 +31558,64 @@ bool PlayFab::AdminModels::FRunTaskRequest::readFromValue(const TSharedPtr<FJson
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> IdentifierValue = obj->TryGetField(TEXT("Identifier"));
     if (IdentifierValue.IsValid() && !IdentifierValue->IsNull())
     {
-        Identifier = MakeShareable(new FNameIdentifier(IdentifierValue->AsObject()));
+        Identifier = MakeShared<FNameIdentifier>(IdentifierValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRunTaskRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Identifier"))
+        {
+            Identifier = MakeShared<FNameIdentifier>();
+            Identifier->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRunTaskRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FRunTaskResult::~FRunTaskResult()
 {
 
 }
 
-void PlayFab::AdminModels::FRunTaskResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FRunTaskResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18355,6 +31628,16 @@ void PlayFab::AdminModels::FRunTaskResult::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FRunTaskResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FRunTaskResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FRunTaskResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18369,12 +31652,39 @@ bool PlayFab::AdminModels::FRunTaskResult::readFromValue(const TSharedPtr<FJsonO
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FRunTaskResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TaskInstanceId"))
+        {
+            reader.ReadValue(TaskInstanceId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRunTaskResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSendAccountRecoveryEmailRequest::~FSendAccountRecoveryEmailRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FSendAccountRecoveryEmailRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSendAccountRecoveryEmailRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18408,6 +31718,16 @@ void PlayFab::AdminModels::FSendAccountRecoveryEmailRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSendAccountRecoveryEmailRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSendAccountRecoveryEmailRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSendAccountRecoveryEmailRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18417,7 +31737,7 @@ bool PlayFab::AdminModels::FSendAccountRecoveryEmailRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -18438,18 +31758,70 @@ bool PlayFab::AdminModels::FSendAccountRecoveryEmailRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSendAccountRecoveryEmailRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Email"))
+        {
+            reader.ReadValue(Email);
+        }
+        else if (reader.IsField("EmailTemplateId"))
+        {
+            reader.ReadValue(EmailTemplateId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSendAccountRecoveryEmailRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSendAccountRecoveryEmailResult::~FSendAccountRecoveryEmailResult()
 {
 
 }
 
-void PlayFab::AdminModels::FSendAccountRecoveryEmailResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSendAccountRecoveryEmailResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSendAccountRecoveryEmailResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSendAccountRecoveryEmailResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSendAccountRecoveryEmailResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18457,12 +31829,34 @@ bool PlayFab::AdminModels::FSendAccountRecoveryEmailResult::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSendAccountRecoveryEmailResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSendAccountRecoveryEmailResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSetPlayerSecretRequest::~FSetPlayerSecretRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FSetPlayerSecretRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSetPlayerSecretRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18485,6 +31879,16 @@ void PlayFab::AdminModels::FSetPlayerSecretRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSetPlayerSecretRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSetPlayerSecretRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSetPlayerSecretRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18506,18 +31910,59 @@ bool PlayFab::AdminModels::FSetPlayerSecretRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSetPlayerSecretRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayerSecret"))
+        {
+            reader.ReadValue(PlayerSecret);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetPlayerSecretRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSetPlayerSecretResult::~FSetPlayerSecretResult()
 {
 
 }
 
-void PlayFab::AdminModels::FSetPlayerSecretResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSetPlayerSecretResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSetPlayerSecretResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSetPlayerSecretResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSetPlayerSecretResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18525,12 +31970,34 @@ bool PlayFab::AdminModels::FSetPlayerSecretResult::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSetPlayerSecretResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetPlayerSecretResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSetPublishedRevisionRequest::~FSetPublishedRevisionRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FSetPublishedRevisionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSetPublishedRevisionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18554,6 +32021,16 @@ void PlayFab::AdminModels::FSetPublishedRevisionRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSetPublishedRevisionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSetPublishedRevisionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSetPublishedRevisionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18563,7 +32040,7 @@ bool PlayFab::AdminModels::FSetPublishedRevisionRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -18584,18 +32061,70 @@ bool PlayFab::AdminModels::FSetPublishedRevisionRequest::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSetPublishedRevisionRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Revision"))
+        {
+            reader.ReadValue(Revision);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetPublishedRevisionRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSetPublishedRevisionResult::~FSetPublishedRevisionResult()
 {
 
 }
 
-void PlayFab::AdminModels::FSetPublishedRevisionResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSetPublishedRevisionResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSetPublishedRevisionResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSetPublishedRevisionResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSetPublishedRevisionResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18603,12 +32132,34 @@ bool PlayFab::AdminModels::FSetPublishedRevisionResult::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSetPublishedRevisionResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetPublishedRevisionResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSetPublisherDataRequest::~FSetPublisherDataRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FSetPublisherDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSetPublisherDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18631,6 +32182,16 @@ void PlayFab::AdminModels::FSetPublisherDataRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSetPublisherDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSetPublisherDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSetPublisherDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18652,18 +32213,59 @@ bool PlayFab::AdminModels::FSetPublisherDataRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSetPublisherDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Key"))
+        {
+            reader.ReadValue(Key);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetPublisherDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSetPublisherDataResult::~FSetPublisherDataResult()
 {
 
 }
 
-void PlayFab::AdminModels::FSetPublisherDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSetPublisherDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSetPublisherDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSetPublisherDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSetPublisherDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18671,12 +32273,34 @@ bool PlayFab::AdminModels::FSetPublisherDataResult::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSetPublisherDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetPublisherDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FTitleDataKeyValue::~FTitleDataKeyValue()
 {
 
 }
 
-void PlayFab::AdminModels::FTitleDataKeyValue::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FTitleDataKeyValue::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18695,6 +32319,16 @@ void PlayFab::AdminModels::FTitleDataKeyValue::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FTitleDataKeyValue::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FTitleDataKeyValue::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FTitleDataKeyValue::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18716,12 +32350,43 @@ bool PlayFab::AdminModels::FTitleDataKeyValue::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FTitleDataKeyValue::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Key"))
+        {
+            reader.ReadValue(Key);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FTitleDataKeyValue();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSetTitleDataAndOverridesRequest::~FSetTitleDataAndOverridesRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FSetTitleDataAndOverridesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSetTitleDataAndOverridesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18737,7 +32402,17 @@ void PlayFab::AdminModels::FSetTitleDataAndOverridesRequest::writeJSON(JsonWrite
         writer->WriteValue(OverrideLabel);
     }
 
-    writer->WriteObjectEnd();
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::AdminModels::FSetTitleDataAndOverridesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSetTitleDataAndOverridesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::AdminModels::FSetTitleDataAndOverridesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -18748,7 +32423,7 @@ bool PlayFab::AdminModels::FSetTitleDataAndOverridesRequest::readFromValue(const
     for (int32 Idx = 0; Idx < KeyValuesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = KeyValuesArray[Idx];
-        KeyValues.Add(FTitleDataKeyValue(CurrentItem->AsObject()));
+        KeyValues.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -18762,18 +32437,66 @@ bool PlayFab::AdminModels::FSetTitleDataAndOverridesRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSetTitleDataAndOverridesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("KeyValues"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { KeyValues[KeyValues.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("OverrideLabel"))
+        {
+            reader.ReadValue(OverrideLabel);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetTitleDataAndOverridesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSetTitleDataAndOverridesResult::~FSetTitleDataAndOverridesResult()
 {
 
 }
 
-void PlayFab::AdminModels::FSetTitleDataAndOverridesResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSetTitleDataAndOverridesResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSetTitleDataAndOverridesResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSetTitleDataAndOverridesResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSetTitleDataAndOverridesResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18781,12 +32504,34 @@ bool PlayFab::AdminModels::FSetTitleDataAndOverridesResult::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSetTitleDataAndOverridesResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetTitleDataAndOverridesResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSetTitleDataRequest::~FSetTitleDataRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FSetTitleDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSetTitleDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18809,6 +32554,16 @@ void PlayFab::AdminModels::FSetTitleDataRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSetTitleDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSetTitleDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSetTitleDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18830,18 +32585,59 @@ bool PlayFab::AdminModels::FSetTitleDataRequest::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSetTitleDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Key"))
+        {
+            reader.ReadValue(Key);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetTitleDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSetTitleDataResult::~FSetTitleDataResult()
 {
 
 }
 
-void PlayFab::AdminModels::FSetTitleDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSetTitleDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSetTitleDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSetTitleDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSetTitleDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18849,12 +32645,34 @@ bool PlayFab::AdminModels::FSetTitleDataResult::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSetTitleDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetTitleDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSetupPushNotificationRequest::~FSetupPushNotificationRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FSetupPushNotificationRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSetupPushNotificationRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18893,6 +32711,16 @@ void PlayFab::AdminModels::FSetupPushNotificationRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSetupPushNotificationRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSetupPushNotificationRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSetupPushNotificationRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18930,12 +32758,56 @@ bool PlayFab::AdminModels::FSetupPushNotificationRequest::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSetupPushNotificationRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Credential"))
+        {
+            reader.ReadValue(Credential);
+        }
+        else if (reader.IsField("Key"))
+        {
+            reader.ReadValue(Key);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("OverwriteOldARN"))
+        {
+            reader.ReadValue(OverwriteOldARN);
+        }
+        else if (reader.IsField("Platform"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Platform = readPushSetupPlatformFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetupPushNotificationRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FSetupPushNotificationResult::~FSetupPushNotificationResult()
 {
 
 }
 
-void PlayFab::AdminModels::FSetupPushNotificationResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSetupPushNotificationResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -18948,6 +32820,16 @@ void PlayFab::AdminModels::FSetupPushNotificationResult::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSetupPushNotificationResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSetupPushNotificationResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSetupPushNotificationResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -18962,7 +32844,34 @@ bool PlayFab::AdminModels::FSetupPushNotificationResult::readFromValue(const TSh
     return HasSucceeded;
 }
 
-void PlayFab::AdminModels::writeStatisticVersionArchivalStatusEnumJSON(StatisticVersionArchivalStatus enumVal, JsonWriter& writer)
+bool PlayFab::AdminModels::FSetupPushNotificationResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ARN"))
+        {
+            reader.ReadValue(ARN);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetupPushNotificationResult();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeStatisticVersionArchivalStatusEnumValue(AdminModels::StatisticVersionArchivalStatus enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -18975,6 +32884,16 @@ void PlayFab::AdminModels::writeStatisticVersionArchivalStatusEnumJSON(Statistic
     }
 }
 
+void PlayFab::AdminModels::writeStatisticVersionArchivalStatusEnumJSON(StatisticVersionArchivalStatus enumVal, JsonWriter& writer)
+{
+    writeStatisticVersionArchivalStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::AdminModels::writeStatisticVersionArchivalStatusEnumJSON(StatisticVersionArchivalStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeStatisticVersionArchivalStatusEnumValue(enumVal, writer);
+}
+
 AdminModels::StatisticVersionArchivalStatus PlayFab::AdminModels::readStatisticVersionArchivalStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readStatisticVersionArchivalStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -19009,7 +32928,8 @@ PlayFab::AdminModels::FSubtractUserVirtualCurrencyRequest::~FSubtractUserVirtual
 
 }
 
-void PlayFab::AdminModels::FSubtractUserVirtualCurrencyRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FSubtractUserVirtualCurrencyRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19050,6 +32970,16 @@ void PlayFab::AdminModels::FSubtractUserVirtualCurrencyRequest::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FSubtractUserVirtualCurrencyRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FSubtractUserVirtualCurrencyRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FSubtractUserVirtualCurrencyRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19066,7 +32996,7 @@ bool PlayFab::AdminModels::FSubtractUserVirtualCurrencyRequest::readFromValue(co
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -19087,12 +33017,58 @@ bool PlayFab::AdminModels::FSubtractUserVirtualCurrencyRequest::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FSubtractUserVirtualCurrencyRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Amount"))
+        {
+            reader.ReadValue(Amount);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            reader.ReadValue(VirtualCurrency);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSubtractUserVirtualCurrencyRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateBanRequest::~FUpdateBanRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdateBanRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateBanRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19145,6 +33121,16 @@ void PlayFab::AdminModels::FUpdateBanRequest::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateBanRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateBanRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateBanRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19199,12 +33185,63 @@ bool PlayFab::AdminModels::FUpdateBanRequest::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateBanRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Active"))
+        {
+            reader.ReadValue(Active);
+        }
+        else if (reader.IsField("BanId"))
+        {
+            reader.ReadValue(BanId);
+        }
+        else if (reader.IsField("Expires"))
+        {
+            reader.ReadValue(Expires);
+        }
+        else if (reader.IsField("IPAddress"))
+        {
+            reader.ReadValue(IPAddress);
+        }
+        else if (reader.IsField("MACAddress"))
+        {
+            reader.ReadValue(MACAddress);
+        }
+        else if (reader.IsField("Permanent"))
+        {
+            reader.ReadValue(Permanent);
+        }
+        else if (reader.IsField("Reason"))
+        {
+            reader.ReadValue(Reason);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateBanRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateBansRequest::~FUpdateBansRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdateBansRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateBansRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19217,6 +33254,16 @@ void PlayFab::AdminModels::FUpdateBansRequest::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateBansRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateBansRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateBansRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19225,19 +33272,53 @@ bool PlayFab::AdminModels::FUpdateBansRequest::readFromValue(const TSharedPtr<FJ
     for (int32 Idx = 0; Idx < BansArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BansArray[Idx];
-        Bans.Add(FUpdateBanRequest(CurrentItem->AsObject()));
+        Bans.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateBansRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Bans"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Bans[Bans.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateBansRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateBansResult::~FUpdateBansResult()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdateBansResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateBansResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19253,6 +33334,16 @@ void PlayFab::AdminModels::FUpdateBansResult::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateBansResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateBansResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateBansResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19261,19 +33352,53 @@ bool PlayFab::AdminModels::FUpdateBansResult::readFromValue(const TSharedPtr<FJs
     for (int32 Idx = 0; Idx < BanDataArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BanDataArray[Idx];
-        BanData.Add(FBanInfo(CurrentItem->AsObject()));
+        BanData.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateBansResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BanData"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { BanData[BanData.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateBansResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateCatalogItemsRequest::~FUpdateCatalogItemsRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdateCatalogItemsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateCatalogItemsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19312,6 +33437,16 @@ void PlayFab::AdminModels::FUpdateCatalogItemsRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateCatalogItemsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateCatalogItemsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateCatalogItemsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19320,7 +33455,7 @@ bool PlayFab::AdminModels::FUpdateCatalogItemsRequest::readFromValue(const TShar
     for (int32 Idx = 0; Idx < CatalogArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = CatalogArray[Idx];
-        Catalog.Add(FCatalogItem(CurrentItem->AsObject()));
+        Catalog.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -19336,7 +33471,7 @@ bool PlayFab::AdminModels::FUpdateCatalogItemsRequest::readFromValue(const TShar
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -19350,18 +33485,81 @@ bool PlayFab::AdminModels::FUpdateCatalogItemsRequest::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateCatalogItemsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Catalog"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Catalog[Catalog.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("SetAsDefaultCatalog"))
+        {
+            reader.ReadValue(SetAsDefaultCatalog);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateCatalogItemsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateCatalogItemsResult::~FUpdateCatalogItemsResult()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdateCatalogItemsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateCatalogItemsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateCatalogItemsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateCatalogItemsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateCatalogItemsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19369,12 +33567,34 @@ bool PlayFab::AdminModels::FUpdateCatalogItemsResult::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateCatalogItemsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateCatalogItemsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateCloudScriptRequest::~FUpdateCloudScriptRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdateCloudScriptRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateCloudScriptRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19407,6 +33627,16 @@ void PlayFab::AdminModels::FUpdateCloudScriptRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateCloudScriptRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateCloudScriptRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateCloudScriptRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19416,7 +33646,7 @@ bool PlayFab::AdminModels::FUpdateCloudScriptRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -19431,7 +33661,7 @@ bool PlayFab::AdminModels::FUpdateCloudScriptRequest::readFromValue(const TShare
     for (int32 Idx = 0; Idx < FilesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = FilesArray[Idx];
-        Files.Add(FCloudScriptFile(CurrentItem->AsObject()));
+        Files.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -19445,12 +33675,65 @@ bool PlayFab::AdminModels::FUpdateCloudScriptRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateCloudScriptRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("DeveloperPlayFabId"))
+        {
+            reader.ReadValue(DeveloperPlayFabId);
+        }
+        else if (reader.IsField("Files"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Files[Files.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Publish"))
+        {
+            reader.ReadValue(Publish);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateCloudScriptRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateCloudScriptResult::~FUpdateCloudScriptResult()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdateCloudScriptResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateCloudScriptResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19463,6 +33746,16 @@ void PlayFab::AdminModels::FUpdateCloudScriptResult::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateCloudScriptResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateCloudScriptResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateCloudScriptResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19484,13 +33777,44 @@ bool PlayFab::AdminModels::FUpdateCloudScriptResult::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateCloudScriptResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Revision"))
+        {
+            reader.ReadValue(Revision);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateCloudScriptResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateOpenIdConnectionRequest::~FUpdateOpenIdConnectionRequest()
 {
     //if (IssuerInformation != nullptr) delete IssuerInformation;
 
 }
 
-void PlayFab::AdminModels::FUpdateOpenIdConnectionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateOpenIdConnectionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19531,6 +33855,16 @@ void PlayFab::AdminModels::FUpdateOpenIdConnectionRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateOpenIdConnectionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateOpenIdConnectionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateOpenIdConnectionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19566,18 +33900,62 @@ bool PlayFab::AdminModels::FUpdateOpenIdConnectionRequest::readFromValue(const T
     const TSharedPtr<FJsonValue> IssuerInformationValue = obj->TryGetField(TEXT("IssuerInformation"));
     if (IssuerInformationValue.IsValid() && !IssuerInformationValue->IsNull())
     {
-        IssuerInformation = MakeShareable(new FOpenIdIssuerInformation(IssuerInformationValue->AsObject()));
+        IssuerInformation = MakeShared<FOpenIdIssuerInformation>(IssuerInformationValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateOpenIdConnectionRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ClientId"))
+        {
+            reader.ReadValue(ClientId);
+        }
+        else if (reader.IsField("ClientSecret"))
+        {
+            reader.ReadValue(ClientSecret);
+        }
+        else if (reader.IsField("ConnectionId"))
+        {
+            reader.ReadValue(ConnectionId);
+        }
+        else if (reader.IsField("IssuerDiscoveryUrl"))
+        {
+            reader.ReadValue(IssuerDiscoveryUrl);
+        }
+        else if (reader.IsField("IssuerInformation"))
+        {
+            IssuerInformation = MakeShared<FOpenIdIssuerInformation>();
+            IssuerInformation->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateOpenIdConnectionRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdatePlayerSharedSecretRequest::~FUpdatePlayerSharedSecretRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdatePlayerSharedSecretRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdatePlayerSharedSecretRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19599,6 +33977,16 @@ void PlayFab::AdminModels::FUpdatePlayerSharedSecretRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdatePlayerSharedSecretRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdatePlayerSharedSecretRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdatePlayerSharedSecretRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19627,18 +34015,63 @@ bool PlayFab::AdminModels::FUpdatePlayerSharedSecretRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdatePlayerSharedSecretRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Disabled"))
+        {
+            reader.ReadValue(Disabled);
+        }
+        else if (reader.IsField("FriendlyName"))
+        {
+            reader.ReadValue(FriendlyName);
+        }
+        else if (reader.IsField("SecretKey"))
+        {
+            reader.ReadValue(SecretKey);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdatePlayerSharedSecretRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdatePlayerSharedSecretResult::~FUpdatePlayerSharedSecretResult()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdatePlayerSharedSecretResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdatePlayerSharedSecretResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdatePlayerSharedSecretResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdatePlayerSharedSecretResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdatePlayerSharedSecretResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19646,12 +34079,34 @@ bool PlayFab::AdminModels::FUpdatePlayerSharedSecretResult::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdatePlayerSharedSecretResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdatePlayerSharedSecretResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdatePlayerStatisticDefinitionRequest::~FUpdatePlayerStatisticDefinitionRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdatePlayerStatisticDefinitionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdatePlayerStatisticDefinitionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19680,6 +34135,16 @@ void PlayFab::AdminModels::FUpdatePlayerStatisticDefinitionRequest::writeJSON(Js
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdatePlayerStatisticDefinitionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdatePlayerStatisticDefinitionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdatePlayerStatisticDefinitionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19698,13 +34163,50 @@ bool PlayFab::AdminModels::FUpdatePlayerStatisticDefinitionRequest::readFromValu
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdatePlayerStatisticDefinitionRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AggregationMethod"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { AggregationMethod = readStatisticAggregationMethodFromValue(TmpValue); }
+        }
+        else if (reader.IsField("StatisticName"))
+        {
+            reader.ReadValue(StatisticName);
+        }
+        else if (reader.IsField("VersionChangeInterval"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { VersionChangeInterval = readStatisticResetIntervalOptionFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdatePlayerStatisticDefinitionRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdatePlayerStatisticDefinitionResult::~FUpdatePlayerStatisticDefinitionResult()
 {
     //if (Statistic != nullptr) delete Statistic;
 
 }
 
-void PlayFab::AdminModels::FUpdatePlayerStatisticDefinitionResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdatePlayerStatisticDefinitionResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19717,6 +34219,16 @@ void PlayFab::AdminModels::FUpdatePlayerStatisticDefinitionResult::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdatePlayerStatisticDefinitionResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdatePlayerStatisticDefinitionResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdatePlayerStatisticDefinitionResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19724,18 +34236,46 @@ bool PlayFab::AdminModels::FUpdatePlayerStatisticDefinitionResult::readFromValue
     const TSharedPtr<FJsonValue> StatisticValue = obj->TryGetField(TEXT("Statistic"));
     if (StatisticValue.IsValid() && !StatisticValue->IsNull())
     {
-        Statistic = MakeShareable(new FPlayerStatisticDefinition(StatisticValue->AsObject()));
+        Statistic = MakeShared<FPlayerStatisticDefinition>(StatisticValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdatePlayerStatisticDefinitionResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Statistic"))
+        {
+            Statistic = MakeShared<FPlayerStatisticDefinition>();
+            Statistic->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdatePlayerStatisticDefinitionResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdatePolicyRequest::~FUpdatePolicyRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdatePolicyRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdatePolicyRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19764,6 +34304,16 @@ void PlayFab::AdminModels::FUpdatePolicyRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdatePolicyRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdatePolicyRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdatePolicyRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19793,19 +34343,65 @@ bool PlayFab::AdminModels::FUpdatePolicyRequest::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < StatementsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StatementsArray[Idx];
-        Statements.Add(FPermissionStatement(CurrentItem->AsObject()));
+        Statements.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdatePolicyRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("OverwritePolicy"))
+        {
+            reader.ReadValue(OverwritePolicy);
+        }
+        else if (reader.IsField("PolicyName"))
+        {
+            reader.ReadValue(PolicyName);
+        }
+        else if (reader.IsField("PolicyVersion"))
+        {
+            reader.ReadValue(PolicyVersion);
+        }
+        else if (reader.IsField("Statements"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Statements[Statements.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdatePolicyRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdatePolicyResponse::~FUpdatePolicyResponse()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdatePolicyResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdatePolicyResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19827,6 +34423,16 @@ void PlayFab::AdminModels::FUpdatePolicyResponse::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdatePolicyResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdatePolicyResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdatePolicyResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19842,19 +34448,57 @@ bool PlayFab::AdminModels::FUpdatePolicyResponse::readFromValue(const TSharedPtr
     for (int32 Idx = 0; Idx < StatementsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StatementsArray[Idx];
-        Statements.Add(FPermissionStatement(CurrentItem->AsObject()));
+        Statements.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdatePolicyResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PolicyName"))
+        {
+            reader.ReadValue(PolicyName);
+        }
+        else if (reader.IsField("Statements"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Statements[Statements.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdatePolicyResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateRandomResultTablesRequest::~FUpdateRandomResultTablesRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdateRandomResultTablesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateRandomResultTablesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19887,6 +34531,16 @@ void PlayFab::AdminModels::FUpdateRandomResultTablesRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateRandomResultTablesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateRandomResultTablesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateRandomResultTablesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19903,7 +34557,7 @@ bool PlayFab::AdminModels::FUpdateRandomResultTablesRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -19911,23 +34565,82 @@ bool PlayFab::AdminModels::FUpdateRandomResultTablesRequest::readFromValue(const
     for (int32 Idx = 0; Idx < TablesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = TablesArray[Idx];
-        Tables.Add(FRandomResultTable(CurrentItem->AsObject()));
+        Tables.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateRandomResultTablesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Tables"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Tables[Tables.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateRandomResultTablesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateRandomResultTablesResult::~FUpdateRandomResultTablesResult()
 {
 
 }
 
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateRandomResultTablesResult::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
+
+    writer->WriteObjectEnd();
+}
+
 void PlayFab::AdminModels::FUpdateRandomResultTablesResult::writeJSON(JsonWriter& writer) const
 {
-    writer->WriteObjectStart();
+    writeJSONObject(writer);
+}
 
-    writer->WriteObjectEnd();
+void PlayFab::AdminModels::FUpdateRandomResultTablesResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::AdminModels::FUpdateRandomResultTablesResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -19937,12 +34650,34 @@ bool PlayFab::AdminModels::FUpdateRandomResultTablesResult::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateRandomResultTablesResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateRandomResultTablesResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateSegmentRequest::~FUpdateSegmentRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdateSegmentRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateSegmentRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19952,6 +34687,16 @@ void PlayFab::AdminModels::FUpdateSegmentRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateSegmentRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateSegmentRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateSegmentRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -19965,12 +34710,39 @@ bool PlayFab::AdminModels::FUpdateSegmentRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateSegmentRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("SegmentModel"))
+        {
+            pfSegmentModel.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateSegmentRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateSegmentResponse::~FUpdateSegmentResponse()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdateSegmentResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateSegmentResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -19989,6 +34761,16 @@ void PlayFab::AdminModels::FUpdateSegmentResponse::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateSegmentResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateSegmentResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateSegmentResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20010,13 +34792,44 @@ bool PlayFab::AdminModels::FUpdateSegmentResponse::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateSegmentResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ErrorMessage"))
+        {
+            reader.ReadValue(ErrorMessage);
+        }
+        else if (reader.IsField("SegmentId"))
+        {
+            reader.ReadValue(SegmentId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateSegmentResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateStoreItemsRequest::~FUpdateStoreItemsRequest()
 {
     //if (MarketingData != nullptr) delete MarketingData;
 
 }
 
-void PlayFab::AdminModels::FUpdateStoreItemsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateStoreItemsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20065,6 +34878,16 @@ void PlayFab::AdminModels::FUpdateStoreItemsRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateStoreItemsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateStoreItemsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateStoreItemsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20081,21 +34904,21 @@ bool PlayFab::AdminModels::FUpdateStoreItemsRequest::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> MarketingDataValue = obj->TryGetField(TEXT("MarketingData"));
     if (MarketingDataValue.IsValid() && !MarketingDataValue->IsNull())
     {
-        MarketingData = MakeShareable(new FStoreMarketingModel(MarketingDataValue->AsObject()));
+        MarketingData = MakeShared<FStoreMarketingModel>(MarketingDataValue->AsObject());
     }
 
     const TArray<TSharedPtr<FJsonValue>>&StoreArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("Store"));
     for (int32 Idx = 0; Idx < StoreArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StoreArray[Idx];
-        Store.Add(FStoreItem(CurrentItem->AsObject()));
+        Store.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -20109,18 +34932,86 @@ bool PlayFab::AdminModels::FUpdateStoreItemsRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateStoreItemsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("MarketingData"))
+        {
+            MarketingData = MakeShared<FStoreMarketingModel>();
+            MarketingData->readFromReader(reader);
+        }
+        else if (reader.IsField("Store"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Store[Store.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("StoreId"))
+        {
+            reader.ReadValue(StoreId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateStoreItemsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateStoreItemsResult::~FUpdateStoreItemsResult()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdateStoreItemsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateStoreItemsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateStoreItemsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateStoreItemsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateStoreItemsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20128,13 +35019,35 @@ bool PlayFab::AdminModels::FUpdateStoreItemsResult::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateStoreItemsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateStoreItemsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateTaskRequest::~FUpdateTaskRequest()
 {
     //if (Identifier != nullptr) delete Identifier;
 
 }
 
-void PlayFab::AdminModels::FUpdateTaskRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateTaskRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20192,6 +35105,16 @@ void PlayFab::AdminModels::FUpdateTaskRequest::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateTaskRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateTaskRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateTaskRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20201,7 +35124,7 @@ bool PlayFab::AdminModels::FUpdateTaskRequest::readFromValue(const TSharedPtr<FJ
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -20215,7 +35138,7 @@ bool PlayFab::AdminModels::FUpdateTaskRequest::readFromValue(const TSharedPtr<FJ
     const TSharedPtr<FJsonValue> IdentifierValue = obj->TryGetField(TEXT("Identifier"));
     if (IdentifierValue.IsValid() && !IdentifierValue->IsNull())
     {
-        Identifier = MakeShareable(new FNameIdentifier(IdentifierValue->AsObject()));
+        Identifier = MakeShared<FNameIdentifier>(IdentifierValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> IsActiveValue = obj->TryGetField(TEXT("IsActive"));
@@ -20250,12 +35173,76 @@ bool PlayFab::AdminModels::FUpdateTaskRequest::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateTaskRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("Identifier"))
+        {
+            Identifier = MakeShared<FNameIdentifier>();
+            Identifier->readFromReader(reader);
+        }
+        else if (reader.IsField("IsActive"))
+        {
+            reader.ReadValue(IsActive);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("Parameter"))
+        {
+            Parameter.readFromReader(reader);
+        }
+        else if (reader.IsField("Schedule"))
+        {
+            reader.ReadValue(Schedule);
+        }
+        else if (reader.IsField("Type"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Type = readScheduledTaskTypeFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateTaskRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateUserDataRequest::~FUpdateUserDataRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdateUserDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateUserDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20309,6 +35296,16 @@ void PlayFab::AdminModels::FUpdateUserDataRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateUserDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateUserDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateUserDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20318,7 +35315,7 @@ bool PlayFab::AdminModels::FUpdateUserDataRequest::readFromValue(const TSharedPt
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -20327,7 +35324,7 @@ bool PlayFab::AdminModels::FUpdateUserDataRequest::readFromValue(const TSharedPt
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -20345,12 +35342,77 @@ bool PlayFab::AdminModels::FUpdateUserDataRequest::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateUserDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("KeysToRemove"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { KeysToRemove.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Permission"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Permission = readUserDataPermissionFromValue(TmpValue); }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateUserDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateUserDataResult::~FUpdateUserDataResult()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdateUserDataResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateUserDataResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20360,6 +35422,16 @@ void PlayFab::AdminModels::FUpdateUserDataResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateUserDataResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateUserDataResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateUserDataResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20374,12 +35446,39 @@ bool PlayFab::AdminModels::FUpdateUserDataResult::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateUserDataResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DataVersion"))
+        {
+            reader.ReadValue(DataVersion);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateUserDataResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateUserInternalDataRequest::~FUpdateUserInternalDataRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdateUserInternalDataRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateUserInternalDataRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20427,6 +35526,16 @@ void PlayFab::AdminModels::FUpdateUserInternalDataRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateUserInternalDataRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateUserInternalDataRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateUserInternalDataRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20436,7 +35545,7 @@ bool PlayFab::AdminModels::FUpdateUserInternalDataRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -20445,7 +35554,7 @@ bool PlayFab::AdminModels::FUpdateUserInternalDataRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*DataObject)->Values); It; ++It)
         {
-            Data.Add(It.Key(), It.Value()->AsString());
+            Data.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -20461,12 +35570,72 @@ bool PlayFab::AdminModels::FUpdateUserInternalDataRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateUserInternalDataRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Data"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Data.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("KeysToRemove"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { KeysToRemove.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateUserInternalDataRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateUserTitleDisplayNameRequest::~FUpdateUserTitleDisplayNameRequest()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdateUserTitleDisplayNameRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateUserTitleDisplayNameRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20504,6 +35673,16 @@ void PlayFab::AdminModels::FUpdateUserTitleDisplayNameRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateUserTitleDisplayNameRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateUserTitleDisplayNameRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateUserTitleDisplayNameRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20513,7 +35692,7 @@ bool PlayFab::AdminModels::FUpdateUserTitleDisplayNameRequest::readFromValue(con
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -20534,12 +35713,54 @@ bool PlayFab::AdminModels::FUpdateUserTitleDisplayNameRequest::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateUserTitleDisplayNameRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateUserTitleDisplayNameRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::AdminModels::FUpdateUserTitleDisplayNameResult::~FUpdateUserTitleDisplayNameResult()
 {
 
 }
 
-void PlayFab::AdminModels::FUpdateUserTitleDisplayNameResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::AdminModels::FUpdateUserTitleDisplayNameResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -20552,6 +35773,16 @@ void PlayFab::AdminModels::FUpdateUserTitleDisplayNameResult::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::AdminModels::FUpdateUserTitleDisplayNameResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::AdminModels::FUpdateUserTitleDisplayNameResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::AdminModels::FUpdateUserTitleDisplayNameResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -20566,3 +35797,29 @@ bool PlayFab::AdminModels::FUpdateUserTitleDisplayNameResult::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::AdminModels::FUpdateUserTitleDisplayNameResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateUserTitleDisplayNameResult();
+        return false;
+    }
+    return true;
+}
+
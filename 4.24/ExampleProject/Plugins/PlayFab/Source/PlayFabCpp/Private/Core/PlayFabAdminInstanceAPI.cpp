@@ -80,7 +80,8 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabAdminInstanceAPI::GetOrCreateA
 bool UPlayFabAdminInstanceAPI::AbortTaskInstance(
     AdminModels::FAbortTaskInstanceRequest& request,
     const FAbortTaskInstanceDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -88,29 +89,32 @@ bool UPlayFabAdminInstanceAPI::AbortTaskInstance(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AbortTaskInstance"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAbortTaskInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AbortTaskInstance"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnAbortTaskInstanceResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FEmptyResponse>> UPlayFabAdminInstanceAPI::AbortTaskInstanceAsync(AdminModels::FAbortTaskInstanceRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FEmptyResponse, FAbortTaskInstanceDelegate>([this, &request, &Handle](const FAbortTaskInstanceDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::AbortTaskInstance(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnAbortTaskInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAbortTaskInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::AddLocalizedNews(
     AdminModels::FAddLocalizedNewsRequest& request,
     const FAddLocalizedNewsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -118,29 +122,32 @@ bool UPlayFabAdminInstanceAPI::AddLocalizedNews(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddLocalizedNews"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAddLocalizedNewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddLocalizedNews"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnAddLocalizedNewsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FAddLocalizedNewsResult>> UPlayFabAdminInstanceAPI::AddLocalizedNewsAsync(AdminModels::FAddLocalizedNewsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FAddLocalizedNewsResult, FAddLocalizedNewsDelegate>([this, &request, &Handle](const FAddLocalizedNewsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::AddLocalizedNews(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnAddLocalizedNewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddLocalizedNewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FAddLocalizedNewsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FAddLocalizedNewsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FAddLocalizedNewsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::AddNews(
     AdminModels::FAddNewsRequest& request,
     const FAddNewsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -148,29 +155,32 @@ bool UPlayFabAdminInstanceAPI::AddNews(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddNews"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAddNewsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddNews"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnAddNewsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FAddNewsResult>> UPlayFabAdminInstanceAPI::AddNewsAsync(AdminModels::FAddNewsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FAddNewsResult, FAddNewsDelegate>([this, &request, &Handle](const FAddNewsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::AddNews(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnAddNewsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddNewsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FAddNewsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FAddNewsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FAddNewsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::AddPlayerTag(
     AdminModels::FAddPlayerTagRequest& request,
     const FAddPlayerTagDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -178,29 +188,32 @@ bool UPlayFabAdminInstanceAPI::AddPlayerTag(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddPlayerTag"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAddPlayerTagResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddPlayerTag"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnAddPlayerTagResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FAddPlayerTagResult>> UPlayFabAdminInstanceAPI::AddPlayerTagAsync(AdminModels::FAddPlayerTagRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FAddPlayerTagResult, FAddPlayerTagDelegate>([this, &request, &Handle](const FAddPlayerTagDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::AddPlayerTag(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnAddPlayerTagResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddPlayerTagDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FAddPlayerTagResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FAddPlayerTagResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FAddPlayerTagResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::AddServerBuild(
     AdminModels::FAddServerBuildRequest& request,
     const FAddServerBuildDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -208,29 +221,32 @@ bool UPlayFabAdminInstanceAPI::AddServerBuild(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddServerBuild"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAddServerBuildResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddServerBuild"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnAddServerBuildResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FAddServerBuildResult>> UPlayFabAdminInstanceAPI::AddServerBuildAsync(AdminModels::FAddServerBuildRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FAddServerBuildResult, FAddServerBuildDelegate>([this, &request, &Handle](const FAddServerBuildDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::AddServerBuild(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnAddServerBuildResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddServerBuildDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FAddServerBuildResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FAddServerBuildResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FAddServerBuildResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::AddUserVirtualCurrency(
     AdminModels::FAddUserVirtualCurrencyRequest& request,
     const FAddUserVirtualCurrencyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -238,29 +254,32 @@ bool UPlayFabAdminInstanceAPI::AddUserVirtualCurrency(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddUserVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAddUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddUserVirtualCurrency"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnAddUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FModifyUserVirtualCurrencyResult>> UPlayFabAdminInstanceAPI::AddUserVirtualCurrencyAsync(AdminModels::FAddUserVirtualCurrencyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FModifyUserVirtualCurrencyResult, FAddUserVirtualCurrencyDelegate>([this, &request, &Handle](const FAddUserVirtualCurrencyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::AddUserVirtualCurrency(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnAddUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FModifyUserVirtualCurrencyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FModifyUserVirtualCurrencyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FModifyUserVirtualCurrencyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::AddVirtualCurrencyTypes(
     AdminModels::FAddVirtualCurrencyTypesRequest& request,
     const FAddVirtualCurrencyTypesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -268,29 +287,32 @@ bool UPlayFabAdminInstanceAPI::AddVirtualCurrencyTypes(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddVirtualCurrencyTypes"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnAddVirtualCurrencyTypesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/AddVirtualCurrencyTypes"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnAddVirtualCurrencyTypesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FBlankResult>> UPlayFabAdminInstanceAPI::AddVirtualCurrencyTypesAsync(AdminModels::FAddVirtualCurrencyTypesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FBlankResult, FAddVirtualCurrencyTypesDelegate>([this, &request, &Handle](const FAddVirtualCurrencyTypesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::AddVirtualCurrencyTypes(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnAddVirtualCurrencyTypesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAddVirtualCurrencyTypesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FBlankResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FBlankResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FBlankResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::BanUsers(
     AdminModels::FBanUsersRequest& request,
     const FBanUsersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -298,29 +320,32 @@ bool UPlayFabAdminInstanceAPI::BanUsers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/BanUsers"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnBanUsersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/BanUsers"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnBanUsersResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FBanUsersResult>> UPlayFabAdminInstanceAPI::BanUsersAsync(AdminModels::FBanUsersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FBanUsersResult, FBanUsersDelegate>([this, &request, &Handle](const FBanUsersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::BanUsers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnBanUsersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FBanUsersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FBanUsersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FBanUsersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FBanUsersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::CheckLimitedEditionItemAvailability(
     AdminModels::FCheckLimitedEditionItemAvailabilityRequest& request,
     const FCheckLimitedEditionItemAvailabilityDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -328,29 +353,32 @@ bool UPlayFabAdminInstanceAPI::CheckLimitedEditionItemAvailability(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CheckLimitedEditionItemAvailability"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCheckLimitedEditionItemAvailabilityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CheckLimitedEditionItemAvailability"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnCheckLimitedEditionItemAvailabilityResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FCheckLimitedEditionItemAvailabilityResult>> UPlayFabAdminInstanceAPI::CheckLimitedEditionItemAvailabilityAsync(AdminModels::FCheckLimitedEditionItemAvailabilityRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FCheckLimitedEditionItemAvailabilityResult, FCheckLimitedEditionItemAvailabilityDelegate>([this, &request, &Handle](const FCheckLimitedEditionItemAvailabilityDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::CheckLimitedEditionItemAvailability(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnCheckLimitedEditionItemAvailabilityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCheckLimitedEditionItemAvailabilityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FCheckLimitedEditionItemAvailabilityResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FCheckLimitedEditionItemAvailabilityResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FCheckLimitedEditionItemAvailabilityResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::CreateActionsOnPlayersInSegmentTask(
     AdminModels::FCreateActionsOnPlayerSegmentTaskRequest& request,
     const FCreateActionsOnPlayersInSegmentTaskDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -358,29 +386,32 @@ bool UPlayFabAdminInstanceAPI::CreateActionsOnPlayersInSegmentTask(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateActionsOnPlayersInSegmentTask"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreateActionsOnPlayersInSegmentTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateActionsOnPlayersInSegmentTask"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnCreateActionsOnPlayersInSegmentTaskResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FCreateTaskResult>> UPlayFabAdminInstanceAPI::CreateActionsOnPlayersInSegmentTaskAsync(AdminModels::FCreateActionsOnPlayerSegmentTaskRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FCreateTaskResult, FCreateActionsOnPlayersInSegmentTaskDelegate>([this, &request, &Handle](const FCreateActionsOnPlayersInSegmentTaskDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::CreateActionsOnPlayersInSegmentTask(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnCreateActionsOnPlayersInSegmentTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateActionsOnPlayersInSegmentTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FCreateTaskResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FCreateTaskResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FCreateTaskResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::CreateCloudScriptTask(
     AdminModels::FCreateCloudScriptTaskRequest& request,
     const FCreateCloudScriptTaskDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -388,29 +419,32 @@ bool UPlayFabAdminInstanceAPI::CreateCloudScriptTask(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateCloudScriptTask"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreateCloudScriptTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateCloudScriptTask"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnCreateCloudScriptTaskResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FCreateTaskResult>> UPlayFabAdminInstanceAPI::CreateCloudScriptTaskAsync(AdminModels::FCreateCloudScriptTaskRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FCreateTaskResult, FCreateCloudScriptTaskDelegate>([this, &request, &Handle](const FCreateCloudScriptTaskDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::CreateCloudScriptTask(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnCreateCloudScriptTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateCloudScriptTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FCreateTaskResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FCreateTaskResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FCreateTaskResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::CreateInsightsScheduledScalingTask(
     AdminModels::FCreateInsightsScheduledScalingTaskRequest& request,
     const FCreateInsightsScheduledScalingTaskDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -418,29 +452,32 @@ bool UPlayFabAdminInstanceAPI::CreateInsightsScheduledScalingTask(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateInsightsScheduledScalingTask"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreateInsightsScheduledScalingTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateInsightsScheduledScalingTask"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnCreateInsightsScheduledScalingTaskResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FCreateTaskResult>> UPlayFabAdminInstanceAPI::CreateInsightsScheduledScalingTaskAsync(AdminModels::FCreateInsightsScheduledScalingTaskRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FCreateTaskResult, FCreateInsightsScheduledScalingTaskDelegate>([this, &request, &Handle](const FCreateInsightsScheduledScalingTaskDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::CreateInsightsScheduledScalingTask(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnCreateInsightsScheduledScalingTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateInsightsScheduledScalingTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FCreateTaskResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FCreateTaskResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FCreateTaskResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::CreateOpenIdConnection(
     AdminModels::FCreateOpenIdConnectionRequest& request,
     const FCreateOpenIdConnectionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -448,29 +485,32 @@ bool UPlayFabAdminInstanceAPI::CreateOpenIdConnection(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreateOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateOpenIdConnection"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnCreateOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FEmptyResponse>> UPlayFabAdminInstanceAPI::CreateOpenIdConnectionAsync(AdminModels::FCreateOpenIdConnectionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FEmptyResponse, FCreateOpenIdConnectionDelegate>([this, &request, &Handle](const FCreateOpenIdConnectionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::CreateOpenIdConnection(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnCreateOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::CreatePlayerSharedSecret(
     AdminModels::FCreatePlayerSharedSecretRequest& request,
     const FCreatePlayerSharedSecretDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -478,29 +518,32 @@ bool UPlayFabAdminInstanceAPI::CreatePlayerSharedSecret(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreatePlayerSharedSecret"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreatePlayerSharedSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreatePlayerSharedSecret"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnCreatePlayerSharedSecretResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FCreatePlayerSharedSecretResult>> UPlayFabAdminInstanceAPI::CreatePlayerSharedSecretAsync(AdminModels::FCreatePlayerSharedSecretRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FCreatePlayerSharedSecretResult, FCreatePlayerSharedSecretDelegate>([this, &request, &Handle](const FCreatePlayerSharedSecretDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::CreatePlayerSharedSecret(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnCreatePlayerSharedSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreatePlayerSharedSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FCreatePlayerSharedSecretResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FCreatePlayerSharedSecretResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FCreatePlayerSharedSecretResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::CreatePlayerStatisticDefinition(
     AdminModels::FCreatePlayerStatisticDefinitionRequest& request,
     const FCreatePlayerStatisticDefinitionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -508,29 +551,32 @@ bool UPlayFabAdminInstanceAPI::CreatePlayerStatisticDefinition(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreatePlayerStatisticDefinition"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreatePlayerStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreatePlayerStatisticDefinition"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnCreatePlayerStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FCreatePlayerStatisticDefinitionResult>> UPlayFabAdminInstanceAPI::CreatePlayerStatisticDefinitionAsync(AdminModels::FCreatePlayerStatisticDefinitionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FCreatePlayerStatisticDefinitionResult, FCreatePlayerStatisticDefinitionDelegate>([this, &request, &Handle](const FCreatePlayerStatisticDefinitionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::CreatePlayerStatisticDefinition(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnCreatePlayerStatisticDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreatePlayerStatisticDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FCreatePlayerStatisticDefinitionResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FCreatePlayerStatisticDefinitionResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FCreatePlayerStatisticDefinitionResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::CreateSegment(
     AdminModels::FCreateSegmentRequest& request,
     const FCreateSegmentDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -538,29 +584,32 @@ bool UPlayFabAdminInstanceAPI::CreateSegment(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateSegment"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnCreateSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/CreateSegment"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnCreateSegmentResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FCreateSegmentResponse>> UPlayFabAdminInstanceAPI::CreateSegmentAsync(AdminModels::FCreateSegmentRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FCreateSegmentResponse, FCreateSegmentDelegate>([this, &request, &Handle](const FCreateSegmentDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::CreateSegment(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnCreateSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FCreateSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FCreateSegmentResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FCreateSegmentResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FCreateSegmentResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::DeleteContent(
     AdminModels::FDeleteContentRequest& request,
     const FDeleteContentDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -568,29 +617,32 @@ bool UPlayFabAdminInstanceAPI::DeleteContent(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteContent"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteContentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteContent"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnDeleteContentResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FBlankResult>> UPlayFabAdminInstanceAPI::DeleteContentAsync(AdminModels::FDeleteContentRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FBlankResult, FDeleteContentDelegate>([this, &request, &Handle](const FDeleteContentDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::DeleteContent(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteContentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteContentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FBlankResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FBlankResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FBlankResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::DeleteMasterPlayerAccount(
     AdminModels::FDeleteMasterPlayerAccountRequest& request,
     const FDeleteMasterPlayerAccountDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -598,29 +650,32 @@ bool UPlayFabAdminInstanceAPI::DeleteMasterPlayerAccount(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteMasterPlayerAccount"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteMasterPlayerAccountResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteMasterPlayerAccount"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnDeleteMasterPlayerAccountResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FDeleteMasterPlayerAccountResult>> UPlayFabAdminInstanceAPI::DeleteMasterPlayerAccountAsync(AdminModels::FDeleteMasterPlayerAccountRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FDeleteMasterPlayerAccountResult, FDeleteMasterPlayerAccountDelegate>([this, &request, &Handle](const FDeleteMasterPlayerAccountDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::DeleteMasterPlayerAccount(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteMasterPlayerAccountResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteMasterPlayerAccountDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FDeleteMasterPlayerAccountResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FDeleteMasterPlayerAccountResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FDeleteMasterPlayerAccountResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::DeleteOpenIdConnection(
     AdminModels::FDeleteOpenIdConnectionRequest& request,
     const FDeleteOpenIdConnectionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -628,29 +683,32 @@ bool UPlayFabAdminInstanceAPI::DeleteOpenIdConnection(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteOpenIdConnection"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnDeleteOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FEmptyResponse>> UPlayFabAdminInstanceAPI::DeleteOpenIdConnectionAsync(AdminModels::FDeleteOpenIdConnectionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FEmptyResponse, FDeleteOpenIdConnectionDelegate>([this, &request, &Handle](const FDeleteOpenIdConnectionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::DeleteOpenIdConnection(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::DeletePlayer(
     AdminModels::FDeletePlayerRequest& request,
     const FDeletePlayerDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -658,29 +716,32 @@ bool UPlayFabAdminInstanceAPI::DeletePlayer(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeletePlayer"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeletePlayerResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeletePlayer"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnDeletePlayerResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FDeletePlayerResult>> UPlayFabAdminInstanceAPI::DeletePlayerAsync(AdminModels::FDeletePlayerRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FDeletePlayerResult, FDeletePlayerDelegate>([this, &request, &Handle](const FDeletePlayerDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::DeletePlayer(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnDeletePlayerResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePlayerDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FDeletePlayerResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FDeletePlayerResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FDeletePlayerResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::DeletePlayerSharedSecret(
     AdminModels::FDeletePlayerSharedSecretRequest& request,
     const FDeletePlayerSharedSecretDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -688,29 +749,32 @@ bool UPlayFabAdminInstanceAPI::DeletePlayerSharedSecret(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeletePlayerSharedSecret"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeletePlayerSharedSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeletePlayerSharedSecret"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnDeletePlayerSharedSecretResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FDeletePlayerSharedSecretResult>> UPlayFabAdminInstanceAPI::DeletePlayerSharedSecretAsync(AdminModels::FDeletePlayerSharedSecretRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FDeletePlayerSharedSecretResult, FDeletePlayerSharedSecretDelegate>([this, &request, &Handle](const FDeletePlayerSharedSecretDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::DeletePlayerSharedSecret(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnDeletePlayerSharedSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeletePlayerSharedSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FDeletePlayerSharedSecretResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FDeletePlayerSharedSecretResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FDeletePlayerSharedSecretResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::DeleteSegment(
     AdminModels::FDeleteSegmentRequest& request,
     const FDeleteSegmentDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -718,29 +782,32 @@ bool UPlayFabAdminInstanceAPI::DeleteSegment(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteSegment"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteSegment"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnDeleteSegmentResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FDeleteSegmentsResponse>> UPlayFabAdminInstanceAPI::DeleteSegmentAsync(AdminModels::FDeleteSegmentRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FDeleteSegmentsResponse, FDeleteSegmentDelegate>([this, &request, &Handle](const FDeleteSegmentDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::DeleteSegment(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FDeleteSegmentsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FDeleteSegmentsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FDeleteSegmentsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::DeleteStore(
     AdminModels::FDeleteStoreRequest& request,
     const FDeleteStoreDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -748,29 +815,32 @@ bool UPlayFabAdminInstanceAPI::DeleteStore(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteStore"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteStoreResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteStore"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnDeleteStoreResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FDeleteStoreResult>> UPlayFabAdminInstanceAPI::DeleteStoreAsync(AdminModels::FDeleteStoreRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FDeleteStoreResult, FDeleteStoreDelegate>([this, &request, &Handle](const FDeleteStoreDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::DeleteStore(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteStoreResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteStoreDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FDeleteStoreResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FDeleteStoreResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FDeleteStoreResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::DeleteTask(
     AdminModels::FDeleteTaskRequest& request,
     const FDeleteTaskDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -778,37 +848,41 @@ bool UPlayFabAdminInstanceAPI::DeleteTask(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteTask"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteTask"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnDeleteTaskResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FEmptyResponse>> UPlayFabAdminInstanceAPI::DeleteTaskAsync(AdminModels::FDeleteTaskRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FEmptyResponse, FDeleteTaskDelegate>([this, &request, &Handle](const FDeleteTaskDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::DeleteTask(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::DeleteTitle(
     const FDeleteTitleDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 { 
     AdminModels::FDeleteTitleRequest emptyRequest = AdminModels::FDeleteTitleRequest();
-    return UPlayFabAdminInstanceAPI::DeleteTitle(emptyRequest, SuccessDelegate, ErrorDelegate);
+    return UPlayFabAdminInstanceAPI::DeleteTitle(emptyRequest, SuccessDelegate, ErrorDelegate, Handle);
 }
 
 bool UPlayFabAdminInstanceAPI::DeleteTitle(
     AdminModels::FDeleteTitleRequest& request,
     const FDeleteTitleDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -816,29 +890,38 @@ bool UPlayFabAdminInstanceAPI::DeleteTitle(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteTitle"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteTitleResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteTitle"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnDeleteTitleResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FDeleteTitleResult>> UPlayFabAdminInstanceAPI::DeleteTitleAsync(const FPlayFabRequestHandle& Handle)
+{
+    AdminModels::FDeleteTitleRequest emptyRequest = AdminModels::FDeleteTitleRequest();
+    return UPlayFabAdminInstanceAPI::DeleteTitleAsync(emptyRequest, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FDeleteTitleResult>> UPlayFabAdminInstanceAPI::DeleteTitleAsync(AdminModels::FDeleteTitleRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FDeleteTitleResult, FDeleteTitleDelegate>([this, &request, &Handle](const FDeleteTitleDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::DeleteTitle(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteTitleResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTitleDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FDeleteTitleResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FDeleteTitleResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FDeleteTitleResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::DeleteTitleDataOverride(
     AdminModels::FDeleteTitleDataOverrideRequest& request,
     const FDeleteTitleDataOverrideDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -846,29 +929,32 @@ bool UPlayFabAdminInstanceAPI::DeleteTitleDataOverride(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteTitleDataOverride"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnDeleteTitleDataOverrideResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/DeleteTitleDataOverride"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnDeleteTitleDataOverrideResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FDeleteTitleDataOverrideResult>> UPlayFabAdminInstanceAPI::DeleteTitleDataOverrideAsync(AdminModels::FDeleteTitleDataOverrideRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FDeleteTitleDataOverrideResult, FDeleteTitleDataOverrideDelegate>([this, &request, &Handle](const FDeleteTitleDataOverrideDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::DeleteTitleDataOverride(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnDeleteTitleDataOverrideResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FDeleteTitleDataOverrideDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FDeleteTitleDataOverrideResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FDeleteTitleDataOverrideResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FDeleteTitleDataOverrideResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::ExportMasterPlayerData(
     AdminModels::FExportMasterPlayerDataRequest& request,
     const FExportMasterPlayerDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -876,29 +962,32 @@ bool UPlayFabAdminInstanceAPI::ExportMasterPlayerData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ExportMasterPlayerData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnExportMasterPlayerDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ExportMasterPlayerData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnExportMasterPlayerDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FExportMasterPlayerDataResult>> UPlayFabAdminInstanceAPI::ExportMasterPlayerDataAsync(AdminModels::FExportMasterPlayerDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FExportMasterPlayerDataResult, FExportMasterPlayerDataDelegate>([this, &request, &Handle](const FExportMasterPlayerDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::ExportMasterPlayerData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnExportMasterPlayerDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FExportMasterPlayerDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FExportMasterPlayerDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FExportMasterPlayerDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FExportMasterPlayerDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetActionsOnPlayersInSegmentTaskInstance(
     AdminModels::FGetTaskInstanceRequest& request,
     const FGetActionsOnPlayersInSegmentTaskInstanceDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -906,37 +995,41 @@ bool UPlayFabAdminInstanceAPI::GetActionsOnPlayersInSegmentTaskInstance(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetActionsOnPlayersInSegmentTaskInstance"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetActionsOnPlayersInSegmentTaskInstance"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetActionsOnPlayersInSegmentTaskInstanceResult>> UPlayFabAdminInstanceAPI::GetActionsOnPlayersInSegmentTaskInstanceAsync(AdminModels::FGetTaskInstanceRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetActionsOnPlayersInSegmentTaskInstanceResult, FGetActionsOnPlayersInSegmentTaskInstanceDelegate>([this, &request, &Handle](const FGetActionsOnPlayersInSegmentTaskInstanceDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetActionsOnPlayersInSegmentTaskInstance(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetActionsOnPlayersInSegmentTaskInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetActionsOnPlayersInSegmentTaskInstanceResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetActionsOnPlayersInSegmentTaskInstanceResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetActionsOnPlayersInSegmentTaskInstanceResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetAllSegments(
     const FGetAllSegmentsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 { 
     AdminModels::FGetAllSegmentsRequest emptyRequest = AdminModels::FGetAllSegmentsRequest();
-    return UPlayFabAdminInstanceAPI::GetAllSegments(emptyRequest, SuccessDelegate, ErrorDelegate);
+    return UPlayFabAdminInstanceAPI::GetAllSegments(emptyRequest, SuccessDelegate, ErrorDelegate, Handle);
 }
 
 bool UPlayFabAdminInstanceAPI::GetAllSegments(
     AdminModels::FGetAllSegmentsRequest& request,
     const FGetAllSegmentsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -944,29 +1037,38 @@ bool UPlayFabAdminInstanceAPI::GetAllSegments(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetAllSegments"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetAllSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetAllSegments"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetAllSegmentsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetAllSegmentsResult>> UPlayFabAdminInstanceAPI::GetAllSegmentsAsync(const FPlayFabRequestHandle& Handle)
+{
+    AdminModels::FGetAllSegmentsRequest emptyRequest = AdminModels::FGetAllSegmentsRequest();
+    return UPlayFabAdminInstanceAPI::GetAllSegmentsAsync(emptyRequest, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetAllSegmentsResult>> UPlayFabAdminInstanceAPI::GetAllSegmentsAsync(AdminModels::FGetAllSegmentsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetAllSegmentsResult, FGetAllSegmentsDelegate>([this, &request, &Handle](const FGetAllSegmentsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetAllSegments(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetAllSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetAllSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetAllSegmentsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetAllSegmentsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetAllSegmentsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetCatalogItems(
     AdminModels::FGetCatalogItemsRequest& request,
     const FGetCatalogItemsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -974,29 +1076,32 @@ bool UPlayFabAdminInstanceAPI::GetCatalogItems(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetCatalogItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetCatalogItems"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetCatalogItemsResult>> UPlayFabAdminInstanceAPI::GetCatalogItemsAsync(AdminModels::FGetCatalogItemsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetCatalogItemsResult, FGetCatalogItemsDelegate>([this, &request, &Handle](const FGetCatalogItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetCatalogItems(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetCatalogItemsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetCatalogItemsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetCatalogItemsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetCloudScriptRevision(
     AdminModels::FGetCloudScriptRevisionRequest& request,
     const FGetCloudScriptRevisionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1004,29 +1109,32 @@ bool UPlayFabAdminInstanceAPI::GetCloudScriptRevision(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetCloudScriptRevision"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetCloudScriptRevisionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetCloudScriptRevision"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetCloudScriptRevisionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetCloudScriptRevisionResult>> UPlayFabAdminInstanceAPI::GetCloudScriptRevisionAsync(AdminModels::FGetCloudScriptRevisionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetCloudScriptRevisionResult, FGetCloudScriptRevisionDelegate>([this, &request, &Handle](const FGetCloudScriptRevisionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetCloudScriptRevision(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetCloudScriptRevisionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCloudScriptRevisionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetCloudScriptRevisionResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetCloudScriptRevisionResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetCloudScriptRevisionResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetCloudScriptTaskInstance(
     AdminModels::FGetTaskInstanceRequest& request,
     const FGetCloudScriptTaskInstanceDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1034,37 +1142,41 @@ bool UPlayFabAdminInstanceAPI::GetCloudScriptTaskInstance(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetCloudScriptTaskInstance"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetCloudScriptTaskInstanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetCloudScriptTaskInstance"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetCloudScriptTaskInstanceResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetCloudScriptTaskInstanceResult>> UPlayFabAdminInstanceAPI::GetCloudScriptTaskInstanceAsync(AdminModels::FGetTaskInstanceRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetCloudScriptTaskInstanceResult, FGetCloudScriptTaskInstanceDelegate>([this, &request, &Handle](const FGetCloudScriptTaskInstanceDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetCloudScriptTaskInstance(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetCloudScriptTaskInstanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCloudScriptTaskInstanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetCloudScriptTaskInstanceResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetCloudScriptTaskInstanceResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetCloudScriptTaskInstanceResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetCloudScriptVersions(
     const FGetCloudScriptVersionsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 { 
     AdminModels::FGetCloudScriptVersionsRequest emptyRequest = AdminModels::FGetCloudScriptVersionsRequest();
-    return UPlayFabAdminInstanceAPI::GetCloudScriptVersions(emptyRequest, SuccessDelegate, ErrorDelegate);
+    return UPlayFabAdminInstanceAPI::GetCloudScriptVersions(emptyRequest, SuccessDelegate, ErrorDelegate, Handle);
 }
 
 bool UPlayFabAdminInstanceAPI::GetCloudScriptVersions(
     AdminModels::FGetCloudScriptVersionsRequest& request,
     const FGetCloudScriptVersionsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1072,29 +1184,38 @@ bool UPlayFabAdminInstanceAPI::GetCloudScriptVersions(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetCloudScriptVersions"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetCloudScriptVersionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetCloudScriptVersions"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetCloudScriptVersionsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetCloudScriptVersionsResult>> UPlayFabAdminInstanceAPI::GetCloudScriptVersionsAsync(const FPlayFabRequestHandle& Handle)
+{
+    AdminModels::FGetCloudScriptVersionsRequest emptyRequest = AdminModels::FGetCloudScriptVersionsRequest();
+    return UPlayFabAdminInstanceAPI::GetCloudScriptVersionsAsync(emptyRequest, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetCloudScriptVersionsResult>> UPlayFabAdminInstanceAPI::GetCloudScriptVersionsAsync(AdminModels::FGetCloudScriptVersionsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetCloudScriptVersionsResult, FGetCloudScriptVersionsDelegate>([this, &request, &Handle](const FGetCloudScriptVersionsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetCloudScriptVersions(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetCloudScriptVersionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetCloudScriptVersionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetCloudScriptVersionsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetCloudScriptVersionsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetCloudScriptVersionsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetContentList(
     AdminModels::FGetContentListRequest& request,
     const FGetContentListDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1102,29 +1223,32 @@ bool UPlayFabAdminInstanceAPI::GetContentList(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetContentList"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetContentListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetContentList"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetContentListResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetContentListResult>> UPlayFabAdminInstanceAPI::GetContentListAsync(AdminModels::FGetContentListRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetContentListResult, FGetContentListDelegate>([this, &request, &Handle](const FGetContentListDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetContentList(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetContentListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContentListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetContentListResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetContentListResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetContentListResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetContentUploadUrl(
     AdminModels::FGetContentUploadUrlRequest& request,
     const FGetContentUploadUrlDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1132,29 +1256,32 @@ bool UPlayFabAdminInstanceAPI::GetContentUploadUrl(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetContentUploadUrl"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetContentUploadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetContentUploadUrl"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetContentUploadUrlResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetContentUploadUrlResult>> UPlayFabAdminInstanceAPI::GetContentUploadUrlAsync(AdminModels::FGetContentUploadUrlRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetContentUploadUrlResult, FGetContentUploadUrlDelegate>([this, &request, &Handle](const FGetContentUploadUrlDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetContentUploadUrl(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetContentUploadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetContentUploadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetContentUploadUrlResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetContentUploadUrlResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetContentUploadUrlResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetDataReport(
     AdminModels::FGetDataReportRequest& request,
     const FGetDataReportDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1162,29 +1289,32 @@ bool UPlayFabAdminInstanceAPI::GetDataReport(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetDataReport"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetDataReportResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetDataReport"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetDataReportResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetDataReportResult>> UPlayFabAdminInstanceAPI::GetDataReportAsync(AdminModels::FGetDataReportRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetDataReportResult, FGetDataReportDelegate>([this, &request, &Handle](const FGetDataReportDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetDataReport(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetDataReportResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetDataReportDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetDataReportResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetDataReportResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetDataReportResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetMatchmakerGameInfo(
     AdminModels::FGetMatchmakerGameInfoRequest& request,
     const FGetMatchmakerGameInfoDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1192,29 +1322,32 @@ bool UPlayFabAdminInstanceAPI::GetMatchmakerGameInfo(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetMatchmakerGameInfo"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetMatchmakerGameInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetMatchmakerGameInfo"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetMatchmakerGameInfoResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetMatchmakerGameInfoResult>> UPlayFabAdminInstanceAPI::GetMatchmakerGameInfoAsync(AdminModels::FGetMatchmakerGameInfoRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetMatchmakerGameInfoResult, FGetMatchmakerGameInfoDelegate>([this, &request, &Handle](const FGetMatchmakerGameInfoDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetMatchmakerGameInfo(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetMatchmakerGameInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMatchmakerGameInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetMatchmakerGameInfoResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetMatchmakerGameInfoResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetMatchmakerGameInfoResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetMatchmakerGameModes(
     AdminModels::FGetMatchmakerGameModesRequest& request,
     const FGetMatchmakerGameModesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1222,29 +1355,32 @@ bool UPlayFabAdminInstanceAPI::GetMatchmakerGameModes(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetMatchmakerGameModes"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetMatchmakerGameModesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetMatchmakerGameModes"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetMatchmakerGameModesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetMatchmakerGameModesResult>> UPlayFabAdminInstanceAPI::GetMatchmakerGameModesAsync(AdminModels::FGetMatchmakerGameModesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetMatchmakerGameModesResult, FGetMatchmakerGameModesDelegate>([this, &request, &Handle](const FGetMatchmakerGameModesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetMatchmakerGameModes(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetMatchmakerGameModesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetMatchmakerGameModesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetMatchmakerGameModesResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetMatchmakerGameModesResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetMatchmakerGameModesResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetPlayedTitleList(
     AdminModels::FGetPlayedTitleListRequest& request,
     const FGetPlayedTitleListDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1252,29 +1388,32 @@ bool UPlayFabAdminInstanceAPI::GetPlayedTitleList(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayedTitleList"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayedTitleListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayedTitleList"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetPlayedTitleListResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetPlayedTitleListResult>> UPlayFabAdminInstanceAPI::GetPlayedTitleListAsync(AdminModels::FGetPlayedTitleListRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetPlayedTitleListResult, FGetPlayedTitleListDelegate>([this, &request, &Handle](const FGetPlayedTitleListDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetPlayedTitleList(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayedTitleListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayedTitleListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetPlayedTitleListResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetPlayedTitleListResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetPlayedTitleListResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetPlayerIdFromAuthToken(
     AdminModels::FGetPlayerIdFromAuthTokenRequest& request,
     const FGetPlayerIdFromAuthTokenDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1282,29 +1421,32 @@ bool UPlayFabAdminInstanceAPI::GetPlayerIdFromAuthToken(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerIdFromAuthToken"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerIdFromAuthTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerIdFromAuthToken"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetPlayerIdFromAuthTokenResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetPlayerIdFromAuthTokenResult>> UPlayFabAdminInstanceAPI::GetPlayerIdFromAuthTokenAsync(AdminModels::FGetPlayerIdFromAuthTokenRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetPlayerIdFromAuthTokenResult, FGetPlayerIdFromAuthTokenDelegate>([this, &request, &Handle](const FGetPlayerIdFromAuthTokenDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetPlayerIdFromAuthToken(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerIdFromAuthTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerIdFromAuthTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetPlayerIdFromAuthTokenResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetPlayerIdFromAuthTokenResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetPlayerIdFromAuthTokenResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetPlayerProfile(
     AdminModels::FGetPlayerProfileRequest& request,
     const FGetPlayerProfileDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1312,29 +1454,32 @@ bool UPlayFabAdminInstanceAPI::GetPlayerProfile(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerProfile"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerProfileResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerProfile"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetPlayerProfileResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetPlayerProfileResult>> UPlayFabAdminInstanceAPI::GetPlayerProfileAsync(AdminModels::FGetPlayerProfileRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetPlayerProfileResult, FGetPlayerProfileDelegate>([this, &request, &Handle](const FGetPlayerProfileDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetPlayerProfile(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerProfileResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerProfileDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetPlayerProfileResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetPlayerProfileResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetPlayerProfileResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetPlayerSegments(
     AdminModels::FGetPlayersSegmentsRequest& request,
     const FGetPlayerSegmentsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1342,37 +1487,41 @@ bool UPlayFabAdminInstanceAPI::GetPlayerSegments(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerSegments"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerSegments"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetPlayerSegmentsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetPlayerSegmentsResult>> UPlayFabAdminInstanceAPI::GetPlayerSegmentsAsync(AdminModels::FGetPlayersSegmentsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetPlayerSegmentsResult, FGetPlayerSegmentsDelegate>([this, &request, &Handle](const FGetPlayerSegmentsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetPlayerSegments(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetPlayerSegmentsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetPlayerSegmentsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetPlayerSegmentsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetPlayerSharedSecrets(
     const FGetPlayerSharedSecretsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 { 
     AdminModels::FGetPlayerSharedSecretsRequest emptyRequest = AdminModels::FGetPlayerSharedSecretsRequest();
-    return UPlayFabAdminInstanceAPI::GetPlayerSharedSecrets(emptyRequest, SuccessDelegate, ErrorDelegate);
+    return UPlayFabAdminInstanceAPI::GetPlayerSharedSecrets(emptyRequest, SuccessDelegate, ErrorDelegate, Handle);
 }
 
 bool UPlayFabAdminInstanceAPI::GetPlayerSharedSecrets(
     AdminModels::FGetPlayerSharedSecretsRequest& request,
     const FGetPlayerSharedSecretsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1380,29 +1529,38 @@ bool UPlayFabAdminInstanceAPI::GetPlayerSharedSecrets(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerSharedSecrets"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerSharedSecretsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerSharedSecrets"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetPlayerSharedSecretsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetPlayerSharedSecretsResult>> UPlayFabAdminInstanceAPI::GetPlayerSharedSecretsAsync(const FPlayFabRequestHandle& Handle)
+{
+    AdminModels::FGetPlayerSharedSecretsRequest emptyRequest = AdminModels::FGetPlayerSharedSecretsRequest();
+    return UPlayFabAdminInstanceAPI::GetPlayerSharedSecretsAsync(emptyRequest, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetPlayerSharedSecretsResult>> UPlayFabAdminInstanceAPI::GetPlayerSharedSecretsAsync(AdminModels::FGetPlayerSharedSecretsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetPlayerSharedSecretsResult, FGetPlayerSharedSecretsDelegate>([this, &request, &Handle](const FGetPlayerSharedSecretsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetPlayerSharedSecrets(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerSharedSecretsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerSharedSecretsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetPlayerSharedSecretsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetPlayerSharedSecretsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetPlayerSharedSecretsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetPlayersInSegment(
     AdminModels::FGetPlayersInSegmentRequest& request,
     const FGetPlayersInSegmentDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1410,37 +1568,41 @@ bool UPlayFabAdminInstanceAPI::GetPlayersInSegment(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayersInSegment"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayersInSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayersInSegment"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetPlayersInSegmentResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetPlayersInSegmentResult>> UPlayFabAdminInstanceAPI::GetPlayersInSegmentAsync(AdminModels::FGetPlayersInSegmentRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetPlayersInSegmentResult, FGetPlayersInSegmentDelegate>([this, &request, &Handle](const FGetPlayersInSegmentDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetPlayersInSegment(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayersInSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayersInSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetPlayersInSegmentResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetPlayersInSegmentResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetPlayersInSegmentResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetPlayerStatisticDefinitions(
     const FGetPlayerStatisticDefinitionsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 { 
     AdminModels::FGetPlayerStatisticDefinitionsRequest emptyRequest = AdminModels::FGetPlayerStatisticDefinitionsRequest();
-    return UPlayFabAdminInstanceAPI::GetPlayerStatisticDefinitions(emptyRequest, SuccessDelegate, ErrorDelegate);
+    return UPlayFabAdminInstanceAPI::GetPlayerStatisticDefinitions(emptyRequest, SuccessDelegate, ErrorDelegate, Handle);
 }
 
 bool UPlayFabAdminInstanceAPI::GetPlayerStatisticDefinitions(
     AdminModels::FGetPlayerStatisticDefinitionsRequest& request,
     const FGetPlayerStatisticDefinitionsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1448,29 +1610,38 @@ bool UPlayFabAdminInstanceAPI::GetPlayerStatisticDefinitions(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerStatisticDefinitions"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerStatisticDefinitionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerStatisticDefinitions"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetPlayerStatisticDefinitionsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetPlayerStatisticDefinitionsResult>> UPlayFabAdminInstanceAPI::GetPlayerStatisticDefinitionsAsync(const FPlayFabRequestHandle& Handle)
+{
+    AdminModels::FGetPlayerStatisticDefinitionsRequest emptyRequest = AdminModels::FGetPlayerStatisticDefinitionsRequest();
+    return UPlayFabAdminInstanceAPI::GetPlayerStatisticDefinitionsAsync(emptyRequest, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetPlayerStatisticDefinitionsResult>> UPlayFabAdminInstanceAPI::GetPlayerStatisticDefinitionsAsync(AdminModels::FGetPlayerStatisticDefinitionsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetPlayerStatisticDefinitionsResult, FGetPlayerStatisticDefinitionsDelegate>([this, &request, &Handle](const FGetPlayerStatisticDefinitionsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetPlayerStatisticDefinitions(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerStatisticDefinitionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticDefinitionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetPlayerStatisticDefinitionsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetPlayerStatisticDefinitionsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetPlayerStatisticDefinitionsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetPlayerStatisticVersions(
     AdminModels::FGetPlayerStatisticVersionsRequest& request,
     const FGetPlayerStatisticVersionsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1478,29 +1649,32 @@ bool UPlayFabAdminInstanceAPI::GetPlayerStatisticVersions(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerStatisticVersions"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerStatisticVersionsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerStatisticVersions"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetPlayerStatisticVersionsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetPlayerStatisticVersionsResult>> UPlayFabAdminInstanceAPI::GetPlayerStatisticVersionsAsync(AdminModels::FGetPlayerStatisticVersionsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetPlayerStatisticVersionsResult, FGetPlayerStatisticVersionsDelegate>([this, &request, &Handle](const FGetPlayerStatisticVersionsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetPlayerStatisticVersions(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerStatisticVersionsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerStatisticVersionsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetPlayerStatisticVersionsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetPlayerStatisticVersionsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetPlayerStatisticVersionsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetPlayerTags(
     AdminModels::FGetPlayerTagsRequest& request,
     const FGetPlayerTagsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1508,29 +1682,32 @@ bool UPlayFabAdminInstanceAPI::GetPlayerTags(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerTags"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPlayerTagsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPlayerTags"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetPlayerTagsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetPlayerTagsResult>> UPlayFabAdminInstanceAPI::GetPlayerTagsAsync(AdminModels::FGetPlayerTagsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetPlayerTagsResult, FGetPlayerTagsDelegate>([this, &request, &Handle](const FGetPlayerTagsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetPlayerTags(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPlayerTagsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPlayerTagsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetPlayerTagsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetPlayerTagsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetPlayerTagsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetPolicy(
     AdminModels::FGetPolicyRequest& request,
     const FGetPolicyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1538,29 +1715,32 @@ bool UPlayFabAdminInstanceAPI::GetPolicy(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPolicy"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPolicy"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetPolicyResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetPolicyResponse>> UPlayFabAdminInstanceAPI::GetPolicyAsync(AdminModels::FGetPolicyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetPolicyResponse, FGetPolicyDelegate>([this, &request, &Handle](const FGetPolicyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetPolicy(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetPolicyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetPolicyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetPolicyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetPublisherData(
     AdminModels::FGetPublisherDataRequest& request,
     const FGetPublisherDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1568,29 +1748,32 @@ bool UPlayFabAdminInstanceAPI::GetPublisherData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetPublisherData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetPublisherDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetPublisherDataResult>> UPlayFabAdminInstanceAPI::GetPublisherDataAsync(AdminModels::FGetPublisherDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetPublisherDataResult, FGetPublisherDataDelegate>([this, &request, &Handle](const FGetPublisherDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetPublisherData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetPublisherDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetPublisherDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetPublisherDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetRandomResultTables(
     AdminModels::FGetRandomResultTablesRequest& request,
     const FGetRandomResultTablesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1598,29 +1781,32 @@ bool UPlayFabAdminInstanceAPI::GetRandomResultTables(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetRandomResultTables"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetRandomResultTablesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetRandomResultTables"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetRandomResultTablesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetRandomResultTablesResult>> UPlayFabAdminInstanceAPI::GetRandomResultTablesAsync(AdminModels::FGetRandomResultTablesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetRandomResultTablesResult, FGetRandomResultTablesDelegate>([this, &request, &Handle](const FGetRandomResultTablesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetRandomResultTables(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetRandomResultTablesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetRandomResultTablesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetRandomResultTablesResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetRandomResultTablesResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetRandomResultTablesResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetSegments(
     AdminModels::FGetSegmentsRequest& request,
     const FGetSegmentsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1628,29 +1814,32 @@ bool UPlayFabAdminInstanceAPI::GetSegments(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetSegments"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetSegmentsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetSegments"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetSegmentsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetSegmentsResponse>> UPlayFabAdminInstanceAPI::GetSegmentsAsync(AdminModels::FGetSegmentsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetSegmentsResponse, FGetSegmentsDelegate>([this, &request, &Handle](const FGetSegmentsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetSegments(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetSegmentsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetSegmentsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetSegmentsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetSegmentsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetSegmentsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetServerBuildInfo(
     AdminModels::FGetServerBuildInfoRequest& request,
     const FGetServerBuildInfoDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1658,29 +1847,32 @@ bool UPlayFabAdminInstanceAPI::GetServerBuildInfo(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetServerBuildInfo"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetServerBuildInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetServerBuildInfo"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetServerBuildInfoResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetServerBuildInfoResult>> UPlayFabAdminInstanceAPI::GetServerBuildInfoAsync(AdminModels::FGetServerBuildInfoRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetServerBuildInfoResult, FGetServerBuildInfoDelegate>([this, &request, &Handle](const FGetServerBuildInfoDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetServerBuildInfo(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetServerBuildInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetServerBuildInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetServerBuildInfoResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetServerBuildInfoResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetServerBuildInfoResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetServerBuildUploadUrl(
     AdminModels::FGetServerBuildUploadURLRequest& request,
     const FGetServerBuildUploadUrlDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1688,29 +1880,32 @@ bool UPlayFabAdminInstanceAPI::GetServerBuildUploadUrl(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetServerBuildUploadUrl"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetServerBuildUploadUrlResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetServerBuildUploadUrl"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetServerBuildUploadUrlResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetServerBuildUploadURLResult>> UPlayFabAdminInstanceAPI::GetServerBuildUploadUrlAsync(AdminModels::FGetServerBuildUploadURLRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetServerBuildUploadURLResult, FGetServerBuildUploadUrlDelegate>([this, &request, &Handle](const FGetServerBuildUploadUrlDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetServerBuildUploadUrl(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetServerBuildUploadUrlResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetServerBuildUploadUrlDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetServerBuildUploadURLResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetServerBuildUploadURLResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetServerBuildUploadURLResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetStoreItems(
     AdminModels::FGetStoreItemsRequest& request,
     const FGetStoreItemsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1718,29 +1913,32 @@ bool UPlayFabAdminInstanceAPI::GetStoreItems(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetStoreItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetStoreItems"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetStoreItemsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetStoreItemsResult>> UPlayFabAdminInstanceAPI::GetStoreItemsAsync(AdminModels::FGetStoreItemsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetStoreItemsResult, FGetStoreItemsDelegate>([this, &request, &Handle](const FGetStoreItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetStoreItems(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetStoreItemsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetStoreItemsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetStoreItemsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetTaskInstances(
     AdminModels::FGetTaskInstancesRequest& request,
     const FGetTaskInstancesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1748,29 +1946,32 @@ bool UPlayFabAdminInstanceAPI::GetTaskInstances(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetTaskInstances"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetTaskInstancesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetTaskInstances"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetTaskInstancesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetTaskInstancesResult>> UPlayFabAdminInstanceAPI::GetTaskInstancesAsync(AdminModels::FGetTaskInstancesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetTaskInstancesResult, FGetTaskInstancesDelegate>([this, &request, &Handle](const FGetTaskInstancesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetTaskInstances(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetTaskInstancesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTaskInstancesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetTaskInstancesResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetTaskInstancesResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetTaskInstancesResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetTasks(
     AdminModels::FGetTasksRequest& request,
     const FGetTasksDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1778,29 +1979,32 @@ bool UPlayFabAdminInstanceAPI::GetTasks(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetTasks"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetTasksResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetTasks"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetTasksResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetTasksResult>> UPlayFabAdminInstanceAPI::GetTasksAsync(AdminModels::FGetTasksRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetTasksResult, FGetTasksDelegate>([this, &request, &Handle](const FGetTasksDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetTasks(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetTasksResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTasksDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetTasksResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetTasksResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetTasksResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetTitleData(
     AdminModels::FGetTitleDataRequest& request,
     const FGetTitleDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1808,29 +2012,32 @@ bool UPlayFabAdminInstanceAPI::GetTitleData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetTitleData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetTitleData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetTitleDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetTitleDataResult>> UPlayFabAdminInstanceAPI::GetTitleDataAsync(AdminModels::FGetTitleDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetTitleDataResult, FGetTitleDataDelegate>([this, &request, &Handle](const FGetTitleDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetTitleData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetTitleDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetTitleDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetTitleDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetTitleInternalData(
     AdminModels::FGetTitleDataRequest& request,
     const FGetTitleInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1838,29 +2045,32 @@ bool UPlayFabAdminInstanceAPI::GetTitleInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetTitleInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetTitleInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetTitleDataResult>> UPlayFabAdminInstanceAPI::GetTitleInternalDataAsync(AdminModels::FGetTitleDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetTitleDataResult, FGetTitleInternalDataDelegate>([this, &request, &Handle](const FGetTitleInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetTitleInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetTitleInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitleInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetTitleDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetTitleDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetTitleDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetUserAccountInfo(
     AdminModels::FLookupUserAccountInfoRequest& request,
     const FGetUserAccountInfoDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1868,29 +2078,32 @@ bool UPlayFabAdminInstanceAPI::GetUserAccountInfo(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserAccountInfo"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserAccountInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserAccountInfo"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetUserAccountInfoResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FLookupUserAccountInfoResult>> UPlayFabAdminInstanceAPI::GetUserAccountInfoAsync(AdminModels::FLookupUserAccountInfoRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FLookupUserAccountInfoResult, FGetUserAccountInfoDelegate>([this, &request, &Handle](const FGetUserAccountInfoDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetUserAccountInfo(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserAccountInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserAccountInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FLookupUserAccountInfoResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FLookupUserAccountInfoResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FLookupUserAccountInfoResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetUserBans(
     AdminModels::FGetUserBansRequest& request,
     const FGetUserBansDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1898,29 +2111,32 @@ bool UPlayFabAdminInstanceAPI::GetUserBans(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserBans"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserBans"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetUserBansResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetUserBansResult>> UPlayFabAdminInstanceAPI::GetUserBansAsync(AdminModels::FGetUserBansRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetUserBansResult, FGetUserBansDelegate>([this, &request, &Handle](const FGetUserBansDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetUserBans(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetUserBansResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetUserBansResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetUserBansResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetUserData(
     AdminModels::FGetUserDataRequest& request,
     const FGetUserDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1928,29 +2144,32 @@ bool UPlayFabAdminInstanceAPI::GetUserData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetUserDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetUserDataResult>> UPlayFabAdminInstanceAPI::GetUserDataAsync(AdminModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetUserDataResult, FGetUserDataDelegate>([this, &request, &Handle](const FGetUserDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetUserData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetUserInternalData(
     AdminModels::FGetUserDataRequest& request,
     const FGetUserInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1958,29 +2177,32 @@ bool UPlayFabAdminInstanceAPI::GetUserInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetUserInternalDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetUserDataResult>> UPlayFabAdminInstanceAPI::GetUserInternalDataAsync(AdminModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetUserDataResult, FGetUserInternalDataDelegate>([this, &request, &Handle](const FGetUserInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetUserInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetUserInventory(
     AdminModels::FGetUserInventoryRequest& request,
     const FGetUserInventoryDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -1988,29 +2210,32 @@ bool UPlayFabAdminInstanceAPI::GetUserInventory(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserInventory"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserInventoryResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserInventory"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetUserInventoryResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetUserInventoryResult>> UPlayFabAdminInstanceAPI::GetUserInventoryAsync(AdminModels::FGetUserInventoryRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetUserInventoryResult, FGetUserInventoryDelegate>([this, &request, &Handle](const FGetUserInventoryDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetUserInventory(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserInventoryResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserInventoryDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetUserInventoryResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetUserInventoryResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetUserInventoryResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetUserPublisherData(
     AdminModels::FGetUserDataRequest& request,
     const FGetUserPublisherDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2018,29 +2243,32 @@ bool UPlayFabAdminInstanceAPI::GetUserPublisherData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserPublisherData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetUserDataResult>> UPlayFabAdminInstanceAPI::GetUserPublisherDataAsync(AdminModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetUserDataResult, FGetUserPublisherDataDelegate>([this, &request, &Handle](const FGetUserPublisherDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetUserPublisherData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetUserPublisherInternalData(
     AdminModels::FGetUserDataRequest& request,
     const FGetUserPublisherInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2048,29 +2276,32 @@ bool UPlayFabAdminInstanceAPI::GetUserPublisherInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserPublisherInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserPublisherInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetUserDataResult>> UPlayFabAdminInstanceAPI::GetUserPublisherInternalDataAsync(AdminModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetUserDataResult, FGetUserPublisherInternalDataDelegate>([this, &request, &Handle](const FGetUserPublisherInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetUserPublisherInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserPublisherInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetUserPublisherReadOnlyData(
     AdminModels::FGetUserDataRequest& request,
     const FGetUserPublisherReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2078,29 +2309,32 @@ bool UPlayFabAdminInstanceAPI::GetUserPublisherReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserPublisherReadOnlyData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetUserDataResult>> UPlayFabAdminInstanceAPI::GetUserPublisherReadOnlyDataAsync(AdminModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetUserDataResult, FGetUserPublisherReadOnlyDataDelegate>([this, &request, &Handle](const FGetUserPublisherReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetUserPublisherReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GetUserReadOnlyData(
     AdminModels::FGetUserDataRequest& request,
     const FGetUserReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2108,29 +2342,32 @@ bool UPlayFabAdminInstanceAPI::GetUserReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGetUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GetUserReadOnlyData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGetUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGetUserDataResult>> UPlayFabAdminInstanceAPI::GetUserReadOnlyDataAsync(AdminModels::FGetUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGetUserDataResult, FGetUserReadOnlyDataDelegate>([this, &request, &Handle](const FGetUserReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GetUserReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGetUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGetUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGetUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGetUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::GrantItemsToUsers(
     AdminModels::FGrantItemsToUsersRequest& request,
     const FGrantItemsToUsersDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2138,29 +2375,32 @@ bool UPlayFabAdminInstanceAPI::GrantItemsToUsers(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GrantItemsToUsers"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnGrantItemsToUsersResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/GrantItemsToUsers"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnGrantItemsToUsersResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FGrantItemsToUsersResult>> UPlayFabAdminInstanceAPI::GrantItemsToUsersAsync(AdminModels::FGrantItemsToUsersRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FGrantItemsToUsersResult, FGrantItemsToUsersDelegate>([this, &request, &Handle](const FGrantItemsToUsersDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::GrantItemsToUsers(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnGrantItemsToUsersResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGrantItemsToUsersDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FGrantItemsToUsersResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FGrantItemsToUsersResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FGrantItemsToUsersResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::IncrementLimitedEditionItemAvailability(
     AdminModels::FIncrementLimitedEditionItemAvailabilityRequest& request,
     const FIncrementLimitedEditionItemAvailabilityDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2168,29 +2408,32 @@ bool UPlayFabAdminInstanceAPI::IncrementLimitedEditionItemAvailability(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/IncrementLimitedEditionItemAvailability"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnIncrementLimitedEditionItemAvailabilityResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/IncrementLimitedEditionItemAvailability"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnIncrementLimitedEditionItemAvailabilityResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FIncrementLimitedEditionItemAvailabilityResult>> UPlayFabAdminInstanceAPI::IncrementLimitedEditionItemAvailabilityAsync(AdminModels::FIncrementLimitedEditionItemAvailabilityRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FIncrementLimitedEditionItemAvailabilityResult, FIncrementLimitedEditionItemAvailabilityDelegate>([this, &request, &Handle](const FIncrementLimitedEditionItemAvailabilityDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::IncrementLimitedEditionItemAvailability(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnIncrementLimitedEditionItemAvailabilityResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FIncrementLimitedEditionItemAvailabilityDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FIncrementLimitedEditionItemAvailabilityResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FIncrementLimitedEditionItemAvailabilityResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FIncrementLimitedEditionItemAvailabilityResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::IncrementPlayerStatisticVersion(
     AdminModels::FIncrementPlayerStatisticVersionRequest& request,
     const FIncrementPlayerStatisticVersionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2198,37 +2441,41 @@ bool UPlayFabAdminInstanceAPI::IncrementPlayerStatisticVersion(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/IncrementPlayerStatisticVersion"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnIncrementPlayerStatisticVersionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/IncrementPlayerStatisticVersion"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnIncrementPlayerStatisticVersionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FIncrementPlayerStatisticVersionResult>> UPlayFabAdminInstanceAPI::IncrementPlayerStatisticVersionAsync(AdminModels::FIncrementPlayerStatisticVersionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FIncrementPlayerStatisticVersionResult, FIncrementPlayerStatisticVersionDelegate>([this, &request, &Handle](const FIncrementPlayerStatisticVersionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::IncrementPlayerStatisticVersion(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnIncrementPlayerStatisticVersionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FIncrementPlayerStatisticVersionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FIncrementPlayerStatisticVersionResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FIncrementPlayerStatisticVersionResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FIncrementPlayerStatisticVersionResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::ListOpenIdConnection(
     const FListOpenIdConnectionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 { 
     AdminModels::FListOpenIdConnectionRequest emptyRequest = AdminModels::FListOpenIdConnectionRequest();
-    return UPlayFabAdminInstanceAPI::ListOpenIdConnection(emptyRequest, SuccessDelegate, ErrorDelegate);
+    return UPlayFabAdminInstanceAPI::ListOpenIdConnection(emptyRequest, SuccessDelegate, ErrorDelegate, Handle);
 }
 
 bool UPlayFabAdminInstanceAPI::ListOpenIdConnection(
     AdminModels::FListOpenIdConnectionRequest& request,
     const FListOpenIdConnectionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2236,37 +2483,47 @@ bool UPlayFabAdminInstanceAPI::ListOpenIdConnection(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ListOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnListOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ListOpenIdConnection"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnListOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FListOpenIdConnectionResponse>> UPlayFabAdminInstanceAPI::ListOpenIdConnectionAsync(const FPlayFabRequestHandle& Handle)
+{
+    AdminModels::FListOpenIdConnectionRequest emptyRequest = AdminModels::FListOpenIdConnectionRequest();
+    return UPlayFabAdminInstanceAPI::ListOpenIdConnectionAsync(emptyRequest, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FListOpenIdConnectionResponse>> UPlayFabAdminInstanceAPI::ListOpenIdConnectionAsync(AdminModels::FListOpenIdConnectionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FListOpenIdConnectionResponse, FListOpenIdConnectionDelegate>([this, &request, &Handle](const FListOpenIdConnectionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::ListOpenIdConnection(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnListOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FListOpenIdConnectionResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FListOpenIdConnectionResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FListOpenIdConnectionResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::ListServerBuilds(
     const FListServerBuildsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 { 
     AdminModels::FListBuildsRequest emptyRequest = AdminModels::FListBuildsRequest();
-    return UPlayFabAdminInstanceAPI::ListServerBuilds(emptyRequest, SuccessDelegate, ErrorDelegate);
+    return UPlayFabAdminInstanceAPI::ListServerBuilds(emptyRequest, SuccessDelegate, ErrorDelegate, Handle);
 }
 
 bool UPlayFabAdminInstanceAPI::ListServerBuilds(
     AdminModels::FListBuildsRequest& request,
     const FListServerBuildsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2274,37 +2531,47 @@ bool UPlayFabAdminInstanceAPI::ListServerBuilds(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ListServerBuilds"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnListServerBuildsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ListServerBuilds"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnListServerBuildsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FListBuildsResult>> UPlayFabAdminInstanceAPI::ListServerBuildsAsync(const FPlayFabRequestHandle& Handle)
+{
+    AdminModels::FListBuildsRequest emptyRequest = AdminModels::FListBuildsRequest();
+    return UPlayFabAdminInstanceAPI::ListServerBuildsAsync(emptyRequest, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FListBuildsResult>> UPlayFabAdminInstanceAPI::ListServerBuildsAsync(AdminModels::FListBuildsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FListBuildsResult, FListServerBuildsDelegate>([this, &request, &Handle](const FListServerBuildsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::ListServerBuilds(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnListServerBuildsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListServerBuildsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FListBuildsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FListBuildsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FListBuildsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::ListVirtualCurrencyTypes(
     const FListVirtualCurrencyTypesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 { 
     AdminModels::FListVirtualCurrencyTypesRequest emptyRequest = AdminModels::FListVirtualCurrencyTypesRequest();
-    return UPlayFabAdminInstanceAPI::ListVirtualCurrencyTypes(emptyRequest, SuccessDelegate, ErrorDelegate);
+    return UPlayFabAdminInstanceAPI::ListVirtualCurrencyTypes(emptyRequest, SuccessDelegate, ErrorDelegate, Handle);
 }
 
 bool UPlayFabAdminInstanceAPI::ListVirtualCurrencyTypes(
     AdminModels::FListVirtualCurrencyTypesRequest& request,
     const FListVirtualCurrencyTypesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2312,29 +2579,38 @@ bool UPlayFabAdminInstanceAPI::ListVirtualCurrencyTypes(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ListVirtualCurrencyTypes"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnListVirtualCurrencyTypesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ListVirtualCurrencyTypes"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnListVirtualCurrencyTypesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FListVirtualCurrencyTypesResult>> UPlayFabAdminInstanceAPI::ListVirtualCurrencyTypesAsync(const FPlayFabRequestHandle& Handle)
+{
+    AdminModels::FListVirtualCurrencyTypesRequest emptyRequest = AdminModels::FListVirtualCurrencyTypesRequest();
+    return UPlayFabAdminInstanceAPI::ListVirtualCurrencyTypesAsync(emptyRequest, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FListVirtualCurrencyTypesResult>> UPlayFabAdminInstanceAPI::ListVirtualCurrencyTypesAsync(AdminModels::FListVirtualCurrencyTypesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FListVirtualCurrencyTypesResult, FListVirtualCurrencyTypesDelegate>([this, &request, &Handle](const FListVirtualCurrencyTypesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::ListVirtualCurrencyTypes(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnListVirtualCurrencyTypesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FListVirtualCurrencyTypesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FListVirtualCurrencyTypesResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FListVirtualCurrencyTypesResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FListVirtualCurrencyTypesResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::ModifyMatchmakerGameModes(
     AdminModels::FModifyMatchmakerGameModesRequest& request,
     const FModifyMatchmakerGameModesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2342,29 +2618,32 @@ bool UPlayFabAdminInstanceAPI::ModifyMatchmakerGameModes(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ModifyMatchmakerGameModes"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnModifyMatchmakerGameModesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ModifyMatchmakerGameModes"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnModifyMatchmakerGameModesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FModifyMatchmakerGameModesResult>> UPlayFabAdminInstanceAPI::ModifyMatchmakerGameModesAsync(AdminModels::FModifyMatchmakerGameModesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FModifyMatchmakerGameModesResult, FModifyMatchmakerGameModesDelegate>([this, &request, &Handle](const FModifyMatchmakerGameModesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::ModifyMatchmakerGameModes(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnModifyMatchmakerGameModesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FModifyMatchmakerGameModesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FModifyMatchmakerGameModesResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FModifyMatchmakerGameModesResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FModifyMatchmakerGameModesResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::ModifyServerBuild(
     AdminModels::FModifyServerBuildRequest& request,
     const FModifyServerBuildDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2372,29 +2651,32 @@ bool UPlayFabAdminInstanceAPI::ModifyServerBuild(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ModifyServerBuild"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnModifyServerBuildResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ModifyServerBuild"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnModifyServerBuildResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FModifyServerBuildResult>> UPlayFabAdminInstanceAPI::ModifyServerBuildAsync(AdminModels::FModifyServerBuildRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FModifyServerBuildResult, FModifyServerBuildDelegate>([this, &request, &Handle](const FModifyServerBuildDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::ModifyServerBuild(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnModifyServerBuildResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FModifyServerBuildDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FModifyServerBuildResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FModifyServerBuildResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FModifyServerBuildResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::RefundPurchase(
     AdminModels::FRefundPurchaseRequest& request,
     const FRefundPurchaseDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2402,29 +2684,32 @@ bool UPlayFabAdminInstanceAPI::RefundPurchase(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RefundPurchase"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRefundPurchaseResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RefundPurchase"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnRefundPurchaseResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FRefundPurchaseResponse>> UPlayFabAdminInstanceAPI::RefundPurchaseAsync(AdminModels::FRefundPurchaseRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FRefundPurchaseResponse, FRefundPurchaseDelegate>([this, &request, &Handle](const FRefundPurchaseDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::RefundPurchase(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnRefundPurchaseResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRefundPurchaseDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FRefundPurchaseResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FRefundPurchaseResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FRefundPurchaseResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::RemovePlayerTag(
     AdminModels::FRemovePlayerTagRequest& request,
     const FRemovePlayerTagDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2432,29 +2717,32 @@ bool UPlayFabAdminInstanceAPI::RemovePlayerTag(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RemovePlayerTag"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRemovePlayerTagResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RemovePlayerTag"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnRemovePlayerTagResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FRemovePlayerTagResult>> UPlayFabAdminInstanceAPI::RemovePlayerTagAsync(AdminModels::FRemovePlayerTagRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FRemovePlayerTagResult, FRemovePlayerTagDelegate>([this, &request, &Handle](const FRemovePlayerTagDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::RemovePlayerTag(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnRemovePlayerTagResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemovePlayerTagDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FRemovePlayerTagResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FRemovePlayerTagResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FRemovePlayerTagResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::RemoveServerBuild(
     AdminModels::FRemoveServerBuildRequest& request,
     const FRemoveServerBuildDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2462,29 +2750,32 @@ bool UPlayFabAdminInstanceAPI::RemoveServerBuild(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RemoveServerBuild"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRemoveServerBuildResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RemoveServerBuild"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnRemoveServerBuildResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FRemoveServerBuildResult>> UPlayFabAdminInstanceAPI::RemoveServerBuildAsync(AdminModels::FRemoveServerBuildRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FRemoveServerBuildResult, FRemoveServerBuildDelegate>([this, &request, &Handle](const FRemoveServerBuildDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::RemoveServerBuild(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnRemoveServerBuildResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveServerBuildDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FRemoveServerBuildResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FRemoveServerBuildResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FRemoveServerBuildResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::RemoveVirtualCurrencyTypes(
     AdminModels::FRemoveVirtualCurrencyTypesRequest& request,
     const FRemoveVirtualCurrencyTypesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2492,29 +2783,32 @@ bool UPlayFabAdminInstanceAPI::RemoveVirtualCurrencyTypes(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RemoveVirtualCurrencyTypes"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRemoveVirtualCurrencyTypesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RemoveVirtualCurrencyTypes"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnRemoveVirtualCurrencyTypesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FBlankResult>> UPlayFabAdminInstanceAPI::RemoveVirtualCurrencyTypesAsync(AdminModels::FRemoveVirtualCurrencyTypesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FBlankResult, FRemoveVirtualCurrencyTypesDelegate>([this, &request, &Handle](const FRemoveVirtualCurrencyTypesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::RemoveVirtualCurrencyTypes(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnRemoveVirtualCurrencyTypesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRemoveVirtualCurrencyTypesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FBlankResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FBlankResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FBlankResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::ResetCharacterStatistics(
     AdminModels::FResetCharacterStatisticsRequest& request,
     const FResetCharacterStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2522,29 +2816,32 @@ bool UPlayFabAdminInstanceAPI::ResetCharacterStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ResetCharacterStatistics"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnResetCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ResetCharacterStatistics"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnResetCharacterStatisticsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FResetCharacterStatisticsResult>> UPlayFabAdminInstanceAPI::ResetCharacterStatisticsAsync(AdminModels::FResetCharacterStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FResetCharacterStatisticsResult, FResetCharacterStatisticsDelegate>([this, &request, &Handle](const FResetCharacterStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::ResetCharacterStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnResetCharacterStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResetCharacterStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FResetCharacterStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FResetCharacterStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FResetCharacterStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::ResetPassword(
     AdminModels::FResetPasswordRequest& request,
     const FResetPasswordDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2552,29 +2849,32 @@ bool UPlayFabAdminInstanceAPI::ResetPassword(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ResetPassword"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnResetPasswordResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ResetPassword"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnResetPasswordResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FResetPasswordResult>> UPlayFabAdminInstanceAPI::ResetPasswordAsync(AdminModels::FResetPasswordRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FResetPasswordResult, FResetPasswordDelegate>([this, &request, &Handle](const FResetPasswordDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::ResetPassword(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnResetPasswordResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResetPasswordDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FResetPasswordResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FResetPasswordResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FResetPasswordResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::ResetUserStatistics(
     AdminModels::FResetUserStatisticsRequest& request,
     const FResetUserStatisticsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2582,29 +2882,32 @@ bool UPlayFabAdminInstanceAPI::ResetUserStatistics(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ResetUserStatistics"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnResetUserStatisticsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ResetUserStatistics"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnResetUserStatisticsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FResetUserStatisticsResult>> UPlayFabAdminInstanceAPI::ResetUserStatisticsAsync(AdminModels::FResetUserStatisticsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FResetUserStatisticsResult, FResetUserStatisticsDelegate>([this, &request, &Handle](const FResetUserStatisticsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::ResetUserStatistics(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnResetUserStatisticsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResetUserStatisticsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FResetUserStatisticsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FResetUserStatisticsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FResetUserStatisticsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::ResolvePurchaseDispute(
     AdminModels::FResolvePurchaseDisputeRequest& request,
     const FResolvePurchaseDisputeDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2612,29 +2915,32 @@ bool UPlayFabAdminInstanceAPI::ResolvePurchaseDispute(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ResolvePurchaseDispute"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnResolvePurchaseDisputeResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/ResolvePurchaseDispute"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnResolvePurchaseDisputeResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FResolvePurchaseDisputeResponse>> UPlayFabAdminInstanceAPI::ResolvePurchaseDisputeAsync(AdminModels::FResolvePurchaseDisputeRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FResolvePurchaseDisputeResponse, FResolvePurchaseDisputeDelegate>([this, &request, &Handle](const FResolvePurchaseDisputeDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::ResolvePurchaseDispute(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnResolvePurchaseDisputeResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FResolvePurchaseDisputeDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FResolvePurchaseDisputeResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FResolvePurchaseDisputeResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FResolvePurchaseDisputeResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::RevokeAllBansForUser(
     AdminModels::FRevokeAllBansForUserRequest& request,
     const FRevokeAllBansForUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2642,29 +2948,32 @@ bool UPlayFabAdminInstanceAPI::RevokeAllBansForUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RevokeAllBansForUser"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRevokeAllBansForUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RevokeAllBansForUser"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnRevokeAllBansForUserResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FRevokeAllBansForUserResult>> UPlayFabAdminInstanceAPI::RevokeAllBansForUserAsync(AdminModels::FRevokeAllBansForUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FRevokeAllBansForUserResult, FRevokeAllBansForUserDelegate>([this, &request, &Handle](const FRevokeAllBansForUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::RevokeAllBansForUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnRevokeAllBansForUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeAllBansForUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FRevokeAllBansForUserResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FRevokeAllBansForUserResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FRevokeAllBansForUserResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::RevokeBans(
     AdminModels::FRevokeBansRequest& request,
     const FRevokeBansDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2672,29 +2981,32 @@ bool UPlayFabAdminInstanceAPI::RevokeBans(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RevokeBans"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRevokeBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RevokeBans"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnRevokeBansResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FRevokeBansResult>> UPlayFabAdminInstanceAPI::RevokeBansAsync(AdminModels::FRevokeBansRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FRevokeBansResult, FRevokeBansDelegate>([this, &request, &Handle](const FRevokeBansDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::RevokeBans(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnRevokeBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FRevokeBansResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FRevokeBansResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FRevokeBansResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::RevokeInventoryItem(
     AdminModels::FRevokeInventoryItemRequest& request,
     const FRevokeInventoryItemDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2702,29 +3014,32 @@ bool UPlayFabAdminInstanceAPI::RevokeInventoryItem(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RevokeInventoryItem"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRevokeInventoryItemResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RevokeInventoryItem"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnRevokeInventoryItemResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FRevokeInventoryResult>> UPlayFabAdminInstanceAPI::RevokeInventoryItemAsync(AdminModels::FRevokeInventoryItemRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FRevokeInventoryResult, FRevokeInventoryItemDelegate>([this, &request, &Handle](const FRevokeInventoryItemDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::RevokeInventoryItem(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnRevokeInventoryItemResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeInventoryItemDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FRevokeInventoryResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FRevokeInventoryResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FRevokeInventoryResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::RevokeInventoryItems(
     AdminModels::FRevokeInventoryItemsRequest& request,
     const FRevokeInventoryItemsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2732,29 +3047,32 @@ bool UPlayFabAdminInstanceAPI::RevokeInventoryItems(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RevokeInventoryItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRevokeInventoryItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RevokeInventoryItems"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnRevokeInventoryItemsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FRevokeInventoryItemsResult>> UPlayFabAdminInstanceAPI::RevokeInventoryItemsAsync(AdminModels::FRevokeInventoryItemsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FRevokeInventoryItemsResult, FRevokeInventoryItemsDelegate>([this, &request, &Handle](const FRevokeInventoryItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::RevokeInventoryItems(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnRevokeInventoryItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRevokeInventoryItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FRevokeInventoryItemsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FRevokeInventoryItemsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FRevokeInventoryItemsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::RunTask(
     AdminModels::FRunTaskRequest& request,
     const FRunTaskDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2762,29 +3080,32 @@ bool UPlayFabAdminInstanceAPI::RunTask(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RunTask"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnRunTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/RunTask"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnRunTaskResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FRunTaskResult>> UPlayFabAdminInstanceAPI::RunTaskAsync(AdminModels::FRunTaskRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FRunTaskResult, FRunTaskDelegate>([this, &request, &Handle](const FRunTaskDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::RunTask(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnRunTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FRunTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FRunTaskResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FRunTaskResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FRunTaskResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::SendAccountRecoveryEmail(
     AdminModels::FSendAccountRecoveryEmailRequest& request,
     const FSendAccountRecoveryEmailDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2792,29 +3113,32 @@ bool UPlayFabAdminInstanceAPI::SendAccountRecoveryEmail(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SendAccountRecoveryEmail"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSendAccountRecoveryEmailResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SendAccountRecoveryEmail"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnSendAccountRecoveryEmailResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FSendAccountRecoveryEmailResult>> UPlayFabAdminInstanceAPI::SendAccountRecoveryEmailAsync(AdminModels::FSendAccountRecoveryEmailRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FSendAccountRecoveryEmailResult, FSendAccountRecoveryEmailDelegate>([this, &request, &Handle](const FSendAccountRecoveryEmailDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::SendAccountRecoveryEmail(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnSendAccountRecoveryEmailResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSendAccountRecoveryEmailDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FSendAccountRecoveryEmailResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FSendAccountRecoveryEmailResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FSendAccountRecoveryEmailResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::SetCatalogItems(
     AdminModels::FUpdateCatalogItemsRequest& request,
     const FSetCatalogItemsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2822,29 +3146,32 @@ bool UPlayFabAdminInstanceAPI::SetCatalogItems(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetCatalogItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetCatalogItems"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnSetCatalogItemsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FUpdateCatalogItemsResult>> UPlayFabAdminInstanceAPI::SetCatalogItemsAsync(AdminModels::FUpdateCatalogItemsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FUpdateCatalogItemsResult, FSetCatalogItemsDelegate>([this, &request, &Handle](const FSetCatalogItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::SetCatalogItems(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnSetCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FUpdateCatalogItemsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FUpdateCatalogItemsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FUpdateCatalogItemsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::SetPlayerSecret(
     AdminModels::FSetPlayerSecretRequest& request,
     const FSetPlayerSecretDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2852,29 +3179,32 @@ bool UPlayFabAdminInstanceAPI::SetPlayerSecret(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetPlayerSecret"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetPlayerSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetPlayerSecret"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnSetPlayerSecretResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FSetPlayerSecretResult>> UPlayFabAdminInstanceAPI::SetPlayerSecretAsync(AdminModels::FSetPlayerSecretRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FSetPlayerSecretResult, FSetPlayerSecretDelegate>([this, &request, &Handle](const FSetPlayerSecretDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::SetPlayerSecret(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnSetPlayerSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPlayerSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FSetPlayerSecretResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FSetPlayerSecretResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FSetPlayerSecretResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::SetPublishedRevision(
     AdminModels::FSetPublishedRevisionRequest& request,
     const FSetPublishedRevisionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2882,29 +3212,32 @@ bool UPlayFabAdminInstanceAPI::SetPublishedRevision(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetPublishedRevision"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetPublishedRevisionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetPublishedRevision"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnSetPublishedRevisionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FSetPublishedRevisionResult>> UPlayFabAdminInstanceAPI::SetPublishedRevisionAsync(AdminModels::FSetPublishedRevisionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FSetPublishedRevisionResult, FSetPublishedRevisionDelegate>([this, &request, &Handle](const FSetPublishedRevisionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::SetPublishedRevision(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnSetPublishedRevisionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPublishedRevisionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FSetPublishedRevisionResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FSetPublishedRevisionResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FSetPublishedRevisionResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::SetPublisherData(
     AdminModels::FSetPublisherDataRequest& request,
     const FSetPublisherDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2912,29 +3245,32 @@ bool UPlayFabAdminInstanceAPI::SetPublisherData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetPublisherData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnSetPublisherDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FSetPublisherDataResult>> UPlayFabAdminInstanceAPI::SetPublisherDataAsync(AdminModels::FSetPublisherDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FSetPublisherDataResult, FSetPublisherDataDelegate>([this, &request, &Handle](const FSetPublisherDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::SetPublisherData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnSetPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FSetPublisherDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FSetPublisherDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FSetPublisherDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::SetStoreItems(
     AdminModels::FUpdateStoreItemsRequest& request,
     const FSetStoreItemsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2942,29 +3278,32 @@ bool UPlayFabAdminInstanceAPI::SetStoreItems(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetStoreItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetStoreItems"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnSetStoreItemsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FUpdateStoreItemsResult>> UPlayFabAdminInstanceAPI::SetStoreItemsAsync(AdminModels::FUpdateStoreItemsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FUpdateStoreItemsResult, FSetStoreItemsDelegate>([this, &request, &Handle](const FSetStoreItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::SetStoreItems(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnSetStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FUpdateStoreItemsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FUpdateStoreItemsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FUpdateStoreItemsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::SetTitleData(
     AdminModels::FSetTitleDataRequest& request,
     const FSetTitleDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -2972,29 +3311,32 @@ bool UPlayFabAdminInstanceAPI::SetTitleData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetTitleData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetTitleDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetTitleData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnSetTitleDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FSetTitleDataResult>> UPlayFabAdminInstanceAPI::SetTitleDataAsync(AdminModels::FSetTitleDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FSetTitleDataResult, FSetTitleDataDelegate>([this, &request, &Handle](const FSetTitleDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::SetTitleData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnSetTitleDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FSetTitleDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FSetTitleDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FSetTitleDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::SetTitleDataAndOverrides(
     AdminModels::FSetTitleDataAndOverridesRequest& request,
     const FSetTitleDataAndOverridesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3002,29 +3344,32 @@ bool UPlayFabAdminInstanceAPI::SetTitleDataAndOverrides(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetTitleDataAndOverrides"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetTitleDataAndOverridesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetTitleDataAndOverrides"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnSetTitleDataAndOverridesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FSetTitleDataAndOverridesResult>> UPlayFabAdminInstanceAPI::SetTitleDataAndOverridesAsync(AdminModels::FSetTitleDataAndOverridesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FSetTitleDataAndOverridesResult, FSetTitleDataAndOverridesDelegate>([this, &request, &Handle](const FSetTitleDataAndOverridesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::SetTitleDataAndOverrides(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnSetTitleDataAndOverridesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleDataAndOverridesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FSetTitleDataAndOverridesResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FSetTitleDataAndOverridesResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FSetTitleDataAndOverridesResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::SetTitleInternalData(
     AdminModels::FSetTitleDataRequest& request,
     const FSetTitleInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3032,29 +3377,32 @@ bool UPlayFabAdminInstanceAPI::SetTitleInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetTitleInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetTitleInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnSetTitleInternalDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FSetTitleDataResult>> UPlayFabAdminInstanceAPI::SetTitleInternalDataAsync(AdminModels::FSetTitleDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FSetTitleDataResult, FSetTitleInternalDataDelegate>([this, &request, &Handle](const FSetTitleInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::SetTitleInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnSetTitleInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetTitleInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FSetTitleDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FSetTitleDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FSetTitleDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::SetupPushNotification(
     AdminModels::FSetupPushNotificationRequest& request,
     const FSetupPushNotificationDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3062,29 +3410,32 @@ bool UPlayFabAdminInstanceAPI::SetupPushNotification(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetupPushNotification"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSetupPushNotificationResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SetupPushNotification"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnSetupPushNotificationResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FSetupPushNotificationResult>> UPlayFabAdminInstanceAPI::SetupPushNotificationAsync(AdminModels::FSetupPushNotificationRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FSetupPushNotificationResult, FSetupPushNotificationDelegate>([this, &request, &Handle](const FSetupPushNotificationDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::SetupPushNotification(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnSetupPushNotificationResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetupPushNotificationDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FSetupPushNotificationResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FSetupPushNotificationResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FSetupPushNotificationResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::SubtractUserVirtualCurrency(
     AdminModels::FSubtractUserVirtualCurrencyRequest& request,
     const FSubtractUserVirtualCurrencyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3092,29 +3443,32 @@ bool UPlayFabAdminInstanceAPI::SubtractUserVirtualCurrency(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SubtractUserVirtualCurrency"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnSubtractUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/SubtractUserVirtualCurrency"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnSubtractUserVirtualCurrencyResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FModifyUserVirtualCurrencyResult>> UPlayFabAdminInstanceAPI::SubtractUserVirtualCurrencyAsync(AdminModels::FSubtractUserVirtualCurrencyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FModifyUserVirtualCurrencyResult, FSubtractUserVirtualCurrencyDelegate>([this, &request, &Handle](const FSubtractUserVirtualCurrencyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::SubtractUserVirtualCurrency(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnSubtractUserVirtualCurrencyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSubtractUserVirtualCurrencyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FModifyUserVirtualCurrencyResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FModifyUserVirtualCurrencyResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FModifyUserVirtualCurrencyResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::UpdateBans(
     AdminModels::FUpdateBansRequest& request,
     const FUpdateBansDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3122,29 +3476,32 @@ bool UPlayFabAdminInstanceAPI::UpdateBans(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateBans"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateBansResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateBans"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnUpdateBansResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FUpdateBansResult>> UPlayFabAdminInstanceAPI::UpdateBansAsync(AdminModels::FUpdateBansRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FUpdateBansResult, FUpdateBansDelegate>([this, &request, &Handle](const FUpdateBansDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::UpdateBans(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateBansResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateBansDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FUpdateBansResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FUpdateBansResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FUpdateBansResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::UpdateCatalogItems(
     AdminModels::FUpdateCatalogItemsRequest& request,
     const FUpdateCatalogItemsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3152,29 +3509,32 @@ bool UPlayFabAdminInstanceAPI::UpdateCatalogItems(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateCatalogItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateCatalogItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateCatalogItems"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnUpdateCatalogItemsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FUpdateCatalogItemsResult>> UPlayFabAdminInstanceAPI::UpdateCatalogItemsAsync(AdminModels::FUpdateCatalogItemsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FUpdateCatalogItemsResult, FUpdateCatalogItemsDelegate>([this, &request, &Handle](const FUpdateCatalogItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::UpdateCatalogItems(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateCatalogItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCatalogItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FUpdateCatalogItemsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FUpdateCatalogItemsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FUpdateCatalogItemsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::UpdateCloudScript(
     AdminModels::FUpdateCloudScriptRequest& request,
     const FUpdateCloudScriptDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3182,29 +3542,32 @@ bool UPlayFabAdminInstanceAPI::UpdateCloudScript(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateCloudScript"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateCloudScriptResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateCloudScript"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnUpdateCloudScriptResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FUpdateCloudScriptResult>> UPlayFabAdminInstanceAPI::UpdateCloudScriptAsync(AdminModels::FUpdateCloudScriptRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FUpdateCloudScriptResult, FUpdateCloudScriptDelegate>([this, &request, &Handle](const FUpdateCloudScriptDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::UpdateCloudScript(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateCloudScriptResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateCloudScriptDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FUpdateCloudScriptResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FUpdateCloudScriptResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FUpdateCloudScriptResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::UpdateOpenIdConnection(
     AdminModels::FUpdateOpenIdConnectionRequest& request,
     const FUpdateOpenIdConnectionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3212,29 +3575,32 @@ bool UPlayFabAdminInstanceAPI::UpdateOpenIdConnection(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateOpenIdConnection"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateOpenIdConnection"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnUpdateOpenIdConnectionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FEmptyResponse>> UPlayFabAdminInstanceAPI::UpdateOpenIdConnectionAsync(AdminModels::FUpdateOpenIdConnectionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FEmptyResponse, FUpdateOpenIdConnectionDelegate>([this, &request, &Handle](const FUpdateOpenIdConnectionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::UpdateOpenIdConnection(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateOpenIdConnectionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateOpenIdConnectionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::UpdatePlayerSharedSecret(
     AdminModels::FUpdatePlayerSharedSecretRequest& request,
     const FUpdatePlayerSharedSecretDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3242,29 +3608,32 @@ bool UPlayFabAdminInstanceAPI::UpdatePlayerSharedSecret(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdatePlayerSharedSecret"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdatePlayerSharedSecretResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdatePlayerSharedSecret"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnUpdatePlayerSharedSecretResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FUpdatePlayerSharedSecretResult>> UPlayFabAdminInstanceAPI::UpdatePlayerSharedSecretAsync(AdminModels::FUpdatePlayerSharedSecretRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FUpdatePlayerSharedSecretResult, FUpdatePlayerSharedSecretDelegate>([this, &request, &Handle](const FUpdatePlayerSharedSecretDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::UpdatePlayerSharedSecret(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdatePlayerSharedSecretResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerSharedSecretDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FUpdatePlayerSharedSecretResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FUpdatePlayerSharedSecretResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FUpdatePlayerSharedSecretResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::UpdatePlayerStatisticDefinition(
     AdminModels::FUpdatePlayerStatisticDefinitionRequest& request,
     const FUpdatePlayerStatisticDefinitionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3272,29 +3641,32 @@ bool UPlayFabAdminInstanceAPI::UpdatePlayerStatisticDefinition(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdatePlayerStatisticDefinition"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdatePlayerStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdatePlayerStatisticDefinition"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnUpdatePlayerStatisticDefinitionResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FUpdatePlayerStatisticDefinitionResult>> UPlayFabAdminInstanceAPI::UpdatePlayerStatisticDefinitionAsync(AdminModels::FUpdatePlayerStatisticDefinitionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FUpdatePlayerStatisticDefinitionResult, FUpdatePlayerStatisticDefinitionDelegate>([this, &request, &Handle](const FUpdatePlayerStatisticDefinitionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::UpdatePlayerStatisticDefinition(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdatePlayerStatisticDefinitionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePlayerStatisticDefinitionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FUpdatePlayerStatisticDefinitionResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FUpdatePlayerStatisticDefinitionResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FUpdatePlayerStatisticDefinitionResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::UpdatePolicy(
     AdminModels::FUpdatePolicyRequest& request,
     const FUpdatePolicyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3302,29 +3674,32 @@ bool UPlayFabAdminInstanceAPI::UpdatePolicy(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdatePolicy"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdatePolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdatePolicy"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnUpdatePolicyResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FUpdatePolicyResponse>> UPlayFabAdminInstanceAPI::UpdatePolicyAsync(AdminModels::FUpdatePolicyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FUpdatePolicyResponse, FUpdatePolicyDelegate>([this, &request, &Handle](const FUpdatePolicyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::UpdatePolicy(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdatePolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdatePolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FUpdatePolicyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FUpdatePolicyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FUpdatePolicyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::UpdateRandomResultTables(
     AdminModels::FUpdateRandomResultTablesRequest& request,
     const FUpdateRandomResultTablesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3332,29 +3707,32 @@ bool UPlayFabAdminInstanceAPI::UpdateRandomResultTables(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateRandomResultTables"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateRandomResultTablesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateRandomResultTables"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnUpdateRandomResultTablesResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FUpdateRandomResultTablesResult>> UPlayFabAdminInstanceAPI::UpdateRandomResultTablesAsync(AdminModels::FUpdateRandomResultTablesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FUpdateRandomResultTablesResult, FUpdateRandomResultTablesDelegate>([this, &request, &Handle](const FUpdateRandomResultTablesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::UpdateRandomResultTables(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateRandomResultTablesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateRandomResultTablesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FUpdateRandomResultTablesResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FUpdateRandomResultTablesResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FUpdateRandomResultTablesResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::UpdateSegment(
     AdminModels::FUpdateSegmentRequest& request,
     const FUpdateSegmentDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3362,29 +3740,32 @@ bool UPlayFabAdminInstanceAPI::UpdateSegment(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateSegment"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateSegmentResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateSegment"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnUpdateSegmentResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FUpdateSegmentResponse>> UPlayFabAdminInstanceAPI::UpdateSegmentAsync(AdminModels::FUpdateSegmentRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FUpdateSegmentResponse, FUpdateSegmentDelegate>([this, &request, &Handle](const FUpdateSegmentDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::UpdateSegment(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateSegmentResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateSegmentDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FUpdateSegmentResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FUpdateSegmentResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FUpdateSegmentResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::UpdateStoreItems(
     AdminModels::FUpdateStoreItemsRequest& request,
     const FUpdateStoreItemsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3392,29 +3773,32 @@ bool UPlayFabAdminInstanceAPI::UpdateStoreItems(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateStoreItems"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateStoreItemsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateStoreItems"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnUpdateStoreItemsResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FUpdateStoreItemsResult>> UPlayFabAdminInstanceAPI::UpdateStoreItemsAsync(AdminModels::FUpdateStoreItemsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FUpdateStoreItemsResult, FUpdateStoreItemsDelegate>([this, &request, &Handle](const FUpdateStoreItemsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::UpdateStoreItems(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateStoreItemsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateStoreItemsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FUpdateStoreItemsResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FUpdateStoreItemsResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FUpdateStoreItemsResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::UpdateTask(
     AdminModels::FUpdateTaskRequest& request,
     const FUpdateTaskDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3422,29 +3806,32 @@ bool UPlayFabAdminInstanceAPI::UpdateTask(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateTask"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateTaskResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateTask"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnUpdateTaskResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FEmptyResponse>> UPlayFabAdminInstanceAPI::UpdateTaskAsync(AdminModels::FUpdateTaskRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FEmptyResponse, FUpdateTaskDelegate>([this, &request, &Handle](const FUpdateTaskDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::UpdateTask(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateTaskResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateTaskDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FEmptyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FEmptyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FEmptyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::UpdateUserData(
     AdminModels::FUpdateUserDataRequest& request,
     const FUpdateUserDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3452,29 +3839,32 @@ bool UPlayFabAdminInstanceAPI::UpdateUserData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnUpdateUserDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FUpdateUserDataResult>> UPlayFabAdminInstanceAPI::UpdateUserDataAsync(AdminModels::FUpdateUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FUpdateUserDataResult, FUpdateUserDataDelegate>([this, &request, &Handle](const FUpdateUserDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::UpdateUserData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::UpdateUserInternalData(
     AdminModels::FUpdateUserInternalDataRequest& request,
     const FUpdateUserInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3482,29 +3872,32 @@ bool UPlayFabAdminInstanceAPI::UpdateUserInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnUpdateUserInternalDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FUpdateUserDataResult>> UPlayFabAdminInstanceAPI::UpdateUserInternalDataAsync(AdminModels::FUpdateUserInternalDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FUpdateUserDataResult, FUpdateUserInternalDataDelegate>([this, &request, &Handle](const FUpdateUserInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::UpdateUserInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::UpdateUserPublisherData(
     AdminModels::FUpdateUserDataRequest& request,
     const FUpdateUserPublisherDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3512,29 +3905,32 @@ bool UPlayFabAdminInstanceAPI::UpdateUserPublisherData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserPublisherData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserPublisherData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnUpdateUserPublisherDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FUpdateUserDataResult>> UPlayFabAdminInstanceAPI::UpdateUserPublisherDataAsync(AdminModels::FUpdateUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FUpdateUserDataResult, FUpdateUserPublisherDataDelegate>([this, &request, &Handle](const FUpdateUserPublisherDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::UpdateUserPublisherData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserPublisherDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::UpdateUserPublisherInternalData(
     AdminModels::FUpdateUserInternalDataRequest& request,
     const FUpdateUserPublisherInternalDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3542,29 +3938,32 @@ bool UPlayFabAdminInstanceAPI::UpdateUserPublisherInternalData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserPublisherInternalData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserPublisherInternalData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnUpdateUserPublisherInternalDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FUpdateUserDataResult>> UPlayFabAdminInstanceAPI::UpdateUserPublisherInternalDataAsync(AdminModels::FUpdateUserInternalDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FUpdateUserDataResult, FUpdateUserPublisherInternalDataDelegate>([this, &request, &Handle](const FUpdateUserPublisherInternalDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::UpdateUserPublisherInternalData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserPublisherInternalDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherInternalDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::UpdateUserPublisherReadOnlyData(
     AdminModels::FUpdateUserDataRequest& request,
     const FUpdateUserPublisherReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3572,29 +3971,32 @@ bool UPlayFabAdminInstanceAPI::UpdateUserPublisherReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserPublisherReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserPublisherReadOnlyData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnUpdateUserPublisherReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FUpdateUserDataResult>> UPlayFabAdminInstanceAPI::UpdateUserPublisherReadOnlyDataAsync(AdminModels::FUpdateUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FUpdateUserDataResult, FUpdateUserPublisherReadOnlyDataDelegate>([this, &request, &Handle](const FUpdateUserPublisherReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::UpdateUserPublisherReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserPublisherReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserPublisherReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::UpdateUserReadOnlyData(
     AdminModels::FUpdateUserDataRequest& request,
     const FUpdateUserReadOnlyDataDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3602,29 +4004,32 @@ bool UPlayFabAdminInstanceAPI::UpdateUserReadOnlyData(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserReadOnlyData"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserReadOnlyData"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnUpdateUserReadOnlyDataResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FUpdateUserDataResult>> UPlayFabAdminInstanceAPI::UpdateUserReadOnlyDataAsync(AdminModels::FUpdateUserDataRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FUpdateUserDataResult, FUpdateUserReadOnlyDataDelegate>([this, &request, &Handle](const FUpdateUserReadOnlyDataDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::UpdateUserReadOnlyData(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserReadOnlyDataResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserReadOnlyDataDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FUpdateUserDataResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FUpdateUserDataResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FUpdateUserDataResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabAdminInstanceAPI::UpdateUserTitleDisplayName(
     AdminModels::FUpdateUserTitleDisplayNameRequest& request,
     const FUpdateUserTitleDisplayNameDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -3632,21 +4037,23 @@ bool UPlayFabAdminInstanceAPI::UpdateUserTitleDisplayName(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserTitleDisplayName"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAdminInstanceAPI::OnUpdateUserTitleDisplayNameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Admin/UpdateUserTitleDisplayName"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAdminInstanceAPI::OnUpdateUserTitleDisplayNameResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AdminModels::FUpdateUserTitleDisplayNameResult>> UPlayFabAdminInstanceAPI::UpdateUserTitleDisplayNameAsync(AdminModels::FUpdateUserTitleDisplayNameRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AdminModels::FUpdateUserTitleDisplayNameResult, FUpdateUserTitleDisplayNameDelegate>([this, &request, &Handle](const FUpdateUserTitleDisplayNameDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAdminInstanceAPI::UpdateUserTitleDisplayName(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAdminInstanceAPI::OnUpdateUserTitleDisplayNameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUpdateUserTitleDisplayNameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AdminModels::FUpdateUserTitleDisplayNameResult outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AdminModels::FUpdateUserTitleDisplayNameResult>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AdminModels::FUpdateUserTitleDisplayNameResult& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
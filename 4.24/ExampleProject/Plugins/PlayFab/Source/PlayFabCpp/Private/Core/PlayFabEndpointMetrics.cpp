@@ -0,0 +1,244 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabEndpointMetrics.h"
+#include "PlayFabCallCounters.h"
+#include "PlayFabRuntimeSettings.h"
+#include "Misc/ScopeLock.h"
+
+DEFINE_STAT(STAT_PlayFabDecode);
+DEFINE_STAT(STAT_PlayFabDelegates);
+DEFINE_STAT(STAT_PlayFabRequestsCompleted);
+DEFINE_STAT(STAT_PlayFabBytesSent);
+DEFINE_STAT(STAT_PlayFabBytesReceived);
+CSV_DEFINE_CATEGORY_MODULE(PLAYFABCPP_API, PlayFab, true);
+
+using namespace PlayFab;
+
+namespace
+{
+    // Values below 16 microseconds have a bucket each; every power of two above that is split into 16
+    constexpr int32 SubBucketBits = 4;
+    constexpr int32 SubBucketCount = 1 << SubBucketBits;
+    // Powers of two up to 2^27 microseconds, a little over two minutes; longer durations go in the last bucket
+    constexpr int32 MaxExponent = 26;
+    constexpr int32 BucketCount = SubBucketCount + (MaxExponent - SubBucketBits + 1) * SubBucketCount;
+
+    struct FAttemptTiming
+    {
+        double SubmitTime = 0.0;
+        double FirstByteTime = 0.0;
+    };
+
+    FCriticalSection MetricsLock;
+    TMap<FString, FPlayFabEndpointMetrics> Endpoints;
+    // Attempts in flight, by request
+    TMap<const IHttpRequest*, FAttemptTiming> Attempts;
+
+    FString GetUrlPath(const FString& RequestUrl)
+    {
+        FString UrlPath, ApiName;
+        PlayFabCommon::FPlayFabCallCounters::ParseRequestUrl(RequestUrl, UrlPath, ApiName);
+        return UrlPath;
+    }
+}
+
+void FPlayFabLatencyHistogram::Add(double Seconds)
+{
+    if (Buckets.Num() == 0)
+    {
+        Buckets.SetNumZeroed(BucketCount);
+    }
+
+    const uint64 Microseconds = (uint64)FMath::Max(0.0, Seconds * 1000000.0);
+    Buckets[GetBucketIndex(Microseconds)]++;
+    Count++;
+    SumSeconds += Seconds;
+    MaxSeconds = FMath::Max(MaxSeconds, Seconds);
+}
+
+double FPlayFabLatencyHistogram::GetPercentileSeconds(double Percentile) const
+{
+    if (Count == 0)
+    {
+        return 0.0;
+    }
+
+    const int64 Target = FMath::Max<int64>(1, (int64)FMath::CeilToDouble(FMath::Clamp(Percentile, 0.0, 1.0) * Count));
+    int64 Seen = 0;
+    for (int32 Index = 0; Index < Buckets.Num(); ++Index)
+    {
+        Seen += Buckets[Index];
+        if (Seen >= Target)
+        {
+            // The top bucket is open ended, and the largest sample is a better bound for it
+            return FMath::Min(GetBucketUpperBound(Index) / 1000000.0, MaxSeconds);
+        }
+    }
+    return MaxSeconds;
+}
+
+int32 FPlayFabLatencyHistogram::GetBucketIndex(uint64 Microseconds)
+{
+    if (Microseconds < SubBucketCount)
+    {
+        return (int32)Microseconds;
+    }
+
+    const int32 Exponent = (int32)FPlatformMath::FloorLog2_64(Microseconds);
+    if (Exponent > MaxExponent)
+    {
+        return BucketCount - 1;
+    }
+    const int32 SubBucket = (int32)(Microseconds >> (Exponent - SubBucketBits)) & (SubBucketCount - 1);
+    return SubBucketCount + (Exponent - SubBucketBits) * SubBucketCount + SubBucket;
+}
+
+uint64 FPlayFabLatencyHistogram::GetBucketUpperBound(int32 Index)
+{
+    if (Index < SubBucketCount)
+    {
+        return Index + 1;
+    }
+
+    const int32 Shift = (Index - SubBucketCount) / SubBucketCount;
+    const uint64 SubBucket = (Index - SubBucketCount) % SubBucketCount;
+    return (SubBucketCount + SubBucket + 1) << Shift;
+}
+
+bool FPlayFabMetrics::IsEnabled()
+{
+    return GetDefault<UPlayFabRuntimeSettings>()->bCollectEndpointMetrics;
+}
+
+void FPlayFabMetrics::OnAttemptSubmitted(const FHttpRequestPtr& HttpRequest)
+{
+    if (!IsEnabled() || !HttpRequest.IsValid())
+    {
+        return;
+    }
+
+    // The caller may be watching the request's progress too, so its delegate keeps running
+    const FHttpRequestProgressDelegate CallerProgress = HttpRequest->OnRequestProgress();
+    HttpRequest->OnRequestProgress().BindStatic(&FPlayFabMetrics::OnAttemptProgress, CallerProgress);
+    FScopeLock Lock(&MetricsLock);
+    Attempts.FindOrAdd(HttpRequest.Get()).SubmitTime = FPlatformTime::Seconds();
+}
+
+void FPlayFabMetrics::OnAttemptProgress(FHttpRequestPtr HttpRequest, int32 BytesSent, int32 BytesReceived, FHttpRequestProgressDelegate CallerProgress)
+{
+    CallerProgress.ExecuteIfBound(HttpRequest, BytesSent, BytesReceived);
+    if (BytesReceived <= 0 || !HttpRequest.IsValid())
+    {
+        return;
+    }
+
+    FScopeLock Lock(&MetricsLock);
+    FAttemptTiming* Timing = Attempts.Find(HttpRequest.Get());
+    if (Timing != nullptr && Timing->FirstByteTime == 0.0)
+    {
+        Timing->FirstByteTime = FPlatformTime::Seconds();
+    }
+}
+
+void FPlayFabMetrics::OnAttemptComplete(const FHttpRequestPtr& HttpRequest, const FHttpResponsePtr& HttpResponse, bool bSucceeded)
+{
+    if (!HttpRequest.IsValid())
+    {
+        return;
+    }
+
+    const bool HasResponse = bSucceeded && HttpResponse.IsValid();
+    const int32 RequestBytes = HttpRequest->GetContentLength();
+    const int32 ResponseBytes = HasResponse ? HttpResponse->GetContentLength() : 0;
+    const double Latency = HttpRequest->GetElapsedTime();
+
+    INC_DWORD_STAT(STAT_PlayFabRequestsCompleted);
+    INC_DWORD_STAT_BY(STAT_PlayFabBytesSent, RequestBytes);
+    INC_DWORD_STAT_BY(STAT_PlayFabBytesReceived, ResponseBytes);
+    CSV_CUSTOM_STAT(PlayFab, RequestsCompleted, 1, ECsvCustomStatOp::Accumulate);
+    CSV_CUSTOM_STAT(PlayFab, BytesSent, RequestBytes, ECsvCustomStatOp::Accumulate);
+    CSV_CUSTOM_STAT(PlayFab, BytesReceived, ResponseBytes, ECsvCustomStatOp::Accumulate);
+    CSV_CUSTOM_STAT(PlayFab, MaxLatencyMs, (float)(Latency * 1000.0), ECsvCustomStatOp::Max);
+
+    if (!IsEnabled())
+    {
+        OnAttemptDropped(HttpRequest);
+        return;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    const FString UrlPath = GetUrlPath(HttpRequest->GetURL());
+    FScopeLock Lock(&MetricsLock);
+    FAttemptTiming Timing;
+    Attempts.RemoveAndCopyValue(HttpRequest.Get(), Timing);
+
+    FPlayFabEndpointMetrics& Metrics = Endpoints.FindOrAdd(UrlPath);
+    Metrics.Attempts++;
+    Metrics.FailedAttempts += HasResponse && EHttpResponseCodes::IsOk(HttpResponse->GetResponseCode()) ? 0 : 1;
+    Metrics.RequestBytes += RequestBytes;
+    Metrics.ResponseBytes += ResponseBytes;
+    if (!HasResponse)
+    {
+        return;
+    }
+
+    // The request's elapsed time starts when the governor sends it; anything before that was spent queued
+    const double SendTime = Now - Latency;
+    Metrics.TotalLatency.Add(Latency);
+    if (Timing.SubmitTime > 0.0)
+    {
+        Metrics.QueueTime.Add(FMath::Max(0.0, SendTime - Timing.SubmitTime));
+    }
+    if (Timing.FirstByteTime > 0.0)
+    {
+        Metrics.TimeToFirstByte.Add(FMath::Max(0.0, Timing.FirstByteTime - SendTime));
+    }
+}
+
+void FPlayFabMetrics::OnAttemptDropped(const FHttpRequestPtr& HttpRequest)
+{
+    if (HttpRequest.IsValid())
+    {
+        FScopeLock Lock(&MetricsLock);
+        Attempts.Remove(HttpRequest.Get());
+    }
+}
+
+FString FPlayFabMetrics::GetMetricsPath(const FHttpRequestPtr& HttpRequest)
+{
+    return IsEnabled() && HttpRequest.IsValid() ? GetUrlPath(HttpRequest->GetURL()) : FString();
+}
+
+void FPlayFabMetrics::RecordStage(const FString& UrlPath, EPlayFabMetricStage Stage, double Seconds)
+{
+    FScopeLock Lock(&MetricsLock);
+    FPlayFabEndpointMetrics& Metrics = Endpoints.FindOrAdd(UrlPath);
+    (Stage == EPlayFabMetricStage::Decode ? Metrics.DecodeTime : Metrics.DelegateTime).Add(Seconds);
+}
+
+bool FPlayFabMetrics::GetEndpointMetrics(const FString& UrlPath, FPlayFabEndpointMetrics& OutMetrics)
+{
+    FScopeLock Lock(&MetricsLock);
+    const FPlayFabEndpointMetrics* Metrics = Endpoints.Find(UrlPath);
+    if (Metrics == nullptr)
+    {
+        return false;
+    }
+    OutMetrics = *Metrics;
+    return true;
+}
+
+TMap<FString, FPlayFabEndpointMetrics> FPlayFabMetrics::GetAllEndpointMetrics()
+{
+    FScopeLock Lock(&MetricsLock);
+    return Endpoints;
+}
+
+void FPlayFabMetrics::Reset()
+{
+    FScopeLock Lock(&MetricsLock);
+    Endpoints.Empty();
+}
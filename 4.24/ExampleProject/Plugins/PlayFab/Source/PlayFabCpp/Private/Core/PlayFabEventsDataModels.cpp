@@ -7,6 +7,7 @@
 
 #include "Core/PlayFabEventsDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
+#include "Core/PlayFabJsonPullReader.h"
 
 using namespace PlayFab;
 using namespace PlayFab::EventsModels;
@@ -16,7 +17,8 @@ PlayFab::EventsModels::FEntityKey::~FEntityKey()
 
 }
 
-void PlayFab::EventsModels::FEntityKey::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::EventsModels::FEntityKey::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -39,6 +41,16 @@ void PlayFab::EventsModels::FEntityKey::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::EventsModels::FEntityKey::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::EventsModels::FEntityKey::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::EventsModels::FEntityKey::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -60,13 +72,44 @@ bool PlayFab::EventsModels::FEntityKey::readFromValue(const TSharedPtr<FJsonObje
     return HasSucceeded;
 }
 
+bool PlayFab::EventsModels::FEntityKey::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Type"))
+        {
+            reader.ReadValue(Type);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityKey();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::EventsModels::FEventContents::~FEventContents()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::EventsModels::FEventContents::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::EventsModels::FEventContents::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -134,6 +177,16 @@ void PlayFab::EventsModels::FEventContents::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::EventsModels::FEventContents::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::EventsModels::FEventContents::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::EventsModels::FEventContents::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -143,14 +196,14 @@ bool PlayFab::EventsModels::FEventContents::readFromValue(const TSharedPtr<FJson
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> EventNamespaceValue = obj->TryGetField(TEXT("EventNamespace"));
@@ -195,12 +248,75 @@ bool PlayFab::EventsModels::FEventContents::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
+bool PlayFab::EventsModels::FEventContents::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("EventNamespace"))
+        {
+            reader.ReadValue(EventNamespace);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("OriginalId"))
+        {
+            reader.ReadValue(OriginalId);
+        }
+        else if (reader.IsField("OriginalTimestamp"))
+        {
+            reader.ReadValue(OriginalTimestamp);
+        }
+        else if (reader.IsField("Payload"))
+        {
+            Payload.readFromReader(reader);
+        }
+        else if (reader.IsField("PayloadJSON"))
+        {
+            reader.ReadValue(PayloadJSON);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEventContents();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::EventsModels::FWriteEventsRequest::~FWriteEventsRequest()
 {
 
 }
 
-void PlayFab::EventsModels::FWriteEventsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::EventsModels::FWriteEventsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -224,6 +340,16 @@ void PlayFab::EventsModels::FWriteEventsRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::EventsModels::FWriteEventsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::EventsModels::FWriteEventsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::EventsModels::FWriteEventsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -233,7 +359,7 @@ bool PlayFab::EventsModels::FWriteEventsRequest::readFromValue(const TSharedPtr<
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -241,19 +367,64 @@ bool PlayFab::EventsModels::FWriteEventsRequest::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < EventsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = EventsArray[Idx];
-        Events.Add(FEventContents(CurrentItem->AsObject()));
+        Events.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::EventsModels::FWriteEventsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Events"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Events[Events.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FWriteEventsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::EventsModels::FWriteEventsResponse::~FWriteEventsResponse()
 {
 
 }
 
-void PlayFab::EventsModels::FWriteEventsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::EventsModels::FWriteEventsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -269,6 +440,16 @@ void PlayFab::EventsModels::FWriteEventsResponse::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::EventsModels::FWriteEventsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::EventsModels::FWriteEventsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::EventsModels::FWriteEventsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -278,3 +459,36 @@ bool PlayFab::EventsModels::FWriteEventsResponse::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::EventsModels::FWriteEventsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AssignedEventIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { AssignedEventIds.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FWriteEventsResponse();
+        return false;
+    }
+    return true;
+}
+
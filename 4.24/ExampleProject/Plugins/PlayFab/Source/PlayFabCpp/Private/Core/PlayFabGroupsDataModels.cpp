@@ -7,6 +7,7 @@
 
 #include "Core/PlayFabGroupsDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
+#include "Core/PlayFabJsonPullReader.h"
 
 using namespace PlayFab;
 using namespace PlayFab::GroupsModels;
@@ -16,7 +17,8 @@ PlayFab::GroupsModels::FEntityKey::~FEntityKey()
 
 }
 
-void PlayFab::GroupsModels::FEntityKey::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FEntityKey::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -39,6 +41,16 @@ void PlayFab::GroupsModels::FEntityKey::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FEntityKey::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FEntityKey::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FEntityKey::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -60,12 +72,43 @@ bool PlayFab::GroupsModels::FEntityKey::readFromValue(const TSharedPtr<FJsonObje
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FEntityKey::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Type"))
+        {
+            reader.ReadValue(Type);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityKey();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FAcceptGroupApplicationRequest::~FAcceptGroupApplicationRequest()
 {
 
 }
 
-void PlayFab::GroupsModels::FAcceptGroupApplicationRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FAcceptGroupApplicationRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -89,6 +132,16 @@ void PlayFab::GroupsModels::FAcceptGroupApplicationRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FAcceptGroupApplicationRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FAcceptGroupApplicationRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FAcceptGroupApplicationRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -98,7 +151,7 @@ bool PlayFab::GroupsModels::FAcceptGroupApplicationRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -117,13 +170,55 @@ bool PlayFab::GroupsModels::FAcceptGroupApplicationRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FAcceptGroupApplicationRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAcceptGroupApplicationRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FAcceptGroupInvitationRequest::~FAcceptGroupInvitationRequest()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::GroupsModels::FAcceptGroupInvitationRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FAcceptGroupInvitationRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -150,6 +245,16 @@ void PlayFab::GroupsModels::FAcceptGroupInvitationRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FAcceptGroupInvitationRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FAcceptGroupInvitationRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FAcceptGroupInvitationRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -159,14 +264,14 @@ bool PlayFab::GroupsModels::FAcceptGroupInvitationRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> GroupValue = obj->TryGetField(TEXT("Group"));
@@ -178,12 +283,55 @@ bool PlayFab::GroupsModels::FAcceptGroupInvitationRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FAcceptGroupInvitationRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAcceptGroupInvitationRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FAddMembersRequest::~FAddMembersRequest()
 {
 
 }
 
-void PlayFab::GroupsModels::FAddMembersRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FAddMembersRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -216,6 +364,16 @@ void PlayFab::GroupsModels::FAddMembersRequest::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FAddMembersRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FAddMembersRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FAddMembersRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -225,7 +383,7 @@ bool PlayFab::GroupsModels::FAddMembersRequest::readFromValue(const TSharedPtr<F
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -239,7 +397,7 @@ bool PlayFab::GroupsModels::FAddMembersRequest::readFromValue(const TSharedPtr<F
     for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FEntityKey(CurrentItem->AsObject()));
+        Members.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -253,13 +411,66 @@ bool PlayFab::GroupsModels::FAddMembersRequest::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FAddMembersRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else if (reader.IsField("Members"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Members[Members.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("RoleId"))
+        {
+            reader.ReadValue(RoleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAddMembersRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FApplyToGroupRequest::~FApplyToGroupRequest()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::GroupsModels::FApplyToGroupRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FApplyToGroupRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -292,6 +503,16 @@ void PlayFab::GroupsModels::FApplyToGroupRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FApplyToGroupRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FApplyToGroupRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FApplyToGroupRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -308,14 +529,14 @@ bool PlayFab::GroupsModels::FApplyToGroupRequest::readFromValue(const TSharedPtr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> GroupValue = obj->TryGetField(TEXT("Group"));
@@ -327,13 +548,60 @@ bool PlayFab::GroupsModels::FApplyToGroupRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FApplyToGroupRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AutoAcceptOutstandingInvite"))
+        {
+            reader.ReadValue(AutoAcceptOutstandingInvite);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FApplyToGroupRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FEntityWithLineage::~FEntityWithLineage()
 {
     //if (Key != nullptr) delete Key;
 
 }
 
-void PlayFab::GroupsModels::FEntityWithLineage::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FEntityWithLineage::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -357,6 +625,16 @@ void PlayFab::GroupsModels::FEntityWithLineage::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FEntityWithLineage::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FEntityWithLineage::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FEntityWithLineage::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -364,7 +642,7 @@ bool PlayFab::GroupsModels::FEntityWithLineage::readFromValue(const TSharedPtr<F
     const TSharedPtr<FJsonValue> KeyValue = obj->TryGetField(TEXT("Key"));
     if (KeyValue.IsValid() && !KeyValue->IsNull())
     {
-        Key = MakeShareable(new FEntityKey(KeyValue->AsObject()));
+        Key = MakeShared<FEntityKey>(KeyValue->AsObject());
     }
 
     const TSharedPtr<FJsonObject>* LineageObject;
@@ -372,13 +650,51 @@ bool PlayFab::GroupsModels::FEntityWithLineage::readFromValue(const TSharedPtr<F
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*LineageObject)->Values); It; ++It)
         {
-            Lineage.Add(It.Key(), FEntityKey(It.Value()->AsObject()));
+            Lineage.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FEntityWithLineage::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Key"))
+        {
+            Key = MakeShared<FEntityKey>();
+            Key->readFromReader(reader);
+        }
+        else if (reader.IsField("Lineage"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { Lineage.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityWithLineage();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FApplyToGroupResponse::~FApplyToGroupResponse()
 {
     //if (Entity != nullptr) delete Entity;
@@ -386,7 +702,8 @@ PlayFab::GroupsModels::FApplyToGroupResponse::~FApplyToGroupResponse()
 
 }
 
-void PlayFab::GroupsModels::FApplyToGroupResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FApplyToGroupResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -408,6 +725,16 @@ void PlayFab::GroupsModels::FApplyToGroupResponse::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FApplyToGroupResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FApplyToGroupResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FApplyToGroupResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -415,7 +742,7 @@ bool PlayFab::GroupsModels::FApplyToGroupResponse::readFromValue(const TSharedPt
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityWithLineage(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityWithLineage>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ExpiresValue = obj->TryGetField(TEXT("Expires"));
@@ -426,18 +753,55 @@ bool PlayFab::GroupsModels::FApplyToGroupResponse::readFromValue(const TSharedPt
     const TSharedPtr<FJsonValue> GroupValue = obj->TryGetField(TEXT("Group"));
     if (GroupValue.IsValid() && !GroupValue->IsNull())
     {
-        Group = MakeShareable(new FEntityKey(GroupValue->AsObject()));
+        Group = MakeShared<FEntityKey>(GroupValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FApplyToGroupResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityWithLineage>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("Expires"))
+        {
+            reader.ReadValue(Expires);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group = MakeShared<FEntityKey>();
+            Group->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FApplyToGroupResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FBlockEntityRequest::~FBlockEntityRequest()
 {
 
 }
 
-void PlayFab::GroupsModels::FBlockEntityRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FBlockEntityRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -461,6 +825,16 @@ void PlayFab::GroupsModels::FBlockEntityRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FBlockEntityRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FBlockEntityRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FBlockEntityRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -470,7 +844,7 @@ bool PlayFab::GroupsModels::FBlockEntityRequest::readFromValue(const TSharedPtr<
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -489,12 +863,54 @@ bool PlayFab::GroupsModels::FBlockEntityRequest::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FBlockEntityRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FBlockEntityRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FChangeMemberRoleRequest::~FChangeMemberRoleRequest()
 {
 
 }
 
-void PlayFab::GroupsModels::FChangeMemberRoleRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FChangeMemberRoleRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -537,6 +953,16 @@ void PlayFab::GroupsModels::FChangeMemberRoleRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FChangeMemberRoleRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FChangeMemberRoleRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FChangeMemberRoleRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -546,7 +972,7 @@ bool PlayFab::GroupsModels::FChangeMemberRoleRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -567,7 +993,7 @@ bool PlayFab::GroupsModels::FChangeMemberRoleRequest::readFromValue(const TShare
     for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FEntityKey(CurrentItem->AsObject()));
+        Members.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -581,13 +1007,70 @@ bool PlayFab::GroupsModels::FChangeMemberRoleRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FChangeMemberRoleRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("DestinationRoleId"))
+        {
+            reader.ReadValue(DestinationRoleId);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else if (reader.IsField("Members"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Members[Members.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("OriginRoleId"))
+        {
+            reader.ReadValue(OriginRoleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FChangeMemberRoleRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FCreateGroupRequest::~FCreateGroupRequest()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::GroupsModels::FCreateGroupRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FCreateGroupRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -621,6 +1104,16 @@ void PlayFab::GroupsModels::FCreateGroupRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FCreateGroupRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FCreateGroupRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FCreateGroupRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -630,14 +1123,14 @@ bool PlayFab::GroupsModels::FCreateGroupRequest::readFromValue(const TSharedPtr<
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> GroupNameValue = obj->TryGetField(TEXT("GroupName"));
@@ -650,12 +1143,55 @@ bool PlayFab::GroupsModels::FCreateGroupRequest::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FCreateGroupRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("GroupName"))
+        {
+            reader.ReadValue(GroupName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateGroupRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FCreateGroupResponse::~FCreateGroupResponse()
 {
 
 }
 
-void PlayFab::GroupsModels::FCreateGroupResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FCreateGroupResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -700,6 +1236,16 @@ void PlayFab::GroupsModels::FCreateGroupResponse::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FCreateGroupResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FCreateGroupResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FCreateGroupResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -748,19 +1294,77 @@ bool PlayFab::GroupsModels::FCreateGroupResponse::readFromValue(const TSharedPtr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*RolesObject)->Values); It; ++It)
         {
-            Roles.Add(It.Key(), It.Value()->AsString());
+            Roles.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
-PlayFab::GroupsModels::FCreateGroupRoleRequest::~FCreateGroupRoleRequest()
+bool PlayFab::GroupsModels::FCreateGroupResponse::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::GroupsModels::FCreateGroupRoleRequest::writeJSON(JsonWriter& writer) const
+        if (reader.IsField("AdminRoleId"))
+        {
+            reader.ReadValue(AdminRoleId);
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else if (reader.IsField("GroupName"))
+        {
+            reader.ReadValue(GroupName);
+        }
+        else if (reader.IsField("MemberRoleId"))
+        {
+            reader.ReadValue(MemberRoleId);
+        }
+        else if (reader.IsField("ProfileVersion"))
+        {
+            reader.ReadValue(ProfileVersion);
+        }
+        else if (reader.IsField("Roles"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Roles.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateGroupResponse();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::GroupsModels::FCreateGroupRoleRequest::~FCreateGroupRoleRequest()
+{
+
+}
+
+template <typename WriterType>
+void PlayFab::GroupsModels::FCreateGroupRoleRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -801,6 +1405,16 @@ void PlayFab::GroupsModels::FCreateGroupRoleRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FCreateGroupRoleRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FCreateGroupRoleRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FCreateGroupRoleRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -810,7 +1424,7 @@ bool PlayFab::GroupsModels::FCreateGroupRoleRequest::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -837,12 +1451,58 @@ bool PlayFab::GroupsModels::FCreateGroupRoleRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FCreateGroupRoleRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else if (reader.IsField("RoleId"))
+        {
+            reader.ReadValue(RoleId);
+        }
+        else if (reader.IsField("RoleName"))
+        {
+            reader.ReadValue(RoleName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateGroupRoleRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FCreateGroupRoleResponse::~FCreateGroupRoleResponse()
 {
 
 }
 
-void PlayFab::GroupsModels::FCreateGroupRoleResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FCreateGroupRoleResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -864,6 +1524,16 @@ void PlayFab::GroupsModels::FCreateGroupRoleResponse::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FCreateGroupRoleResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FCreateGroupRoleResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FCreateGroupRoleResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -892,12 +1562,47 @@ bool PlayFab::GroupsModels::FCreateGroupRoleResponse::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FCreateGroupRoleResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ProfileVersion"))
+        {
+            reader.ReadValue(ProfileVersion);
+        }
+        else if (reader.IsField("RoleId"))
+        {
+            reader.ReadValue(RoleId);
+        }
+        else if (reader.IsField("RoleName"))
+        {
+            reader.ReadValue(RoleName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateGroupRoleResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FDeleteGroupRequest::~FDeleteGroupRequest()
 {
 
 }
 
-void PlayFab::GroupsModels::FDeleteGroupRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FDeleteGroupRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -918,6 +1623,16 @@ void PlayFab::GroupsModels::FDeleteGroupRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FDeleteGroupRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FDeleteGroupRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FDeleteGroupRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -927,7 +1642,7 @@ bool PlayFab::GroupsModels::FDeleteGroupRequest::readFromValue(const TSharedPtr<
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -940,12 +1655,50 @@ bool PlayFab::GroupsModels::FDeleteGroupRequest::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FDeleteGroupRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteGroupRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FDeleteRoleRequest::~FDeleteRoleRequest()
 {
 
 }
 
-void PlayFab::GroupsModels::FDeleteRoleRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FDeleteRoleRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -972,6 +1725,16 @@ void PlayFab::GroupsModels::FDeleteRoleRequest::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FDeleteRoleRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FDeleteRoleRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FDeleteRoleRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -981,7 +1744,7 @@ bool PlayFab::GroupsModels::FDeleteRoleRequest::readFromValue(const TSharedPtr<F
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1001,18 +1764,70 @@ bool PlayFab::GroupsModels::FDeleteRoleRequest::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FDeleteRoleRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else if (reader.IsField("RoleId"))
+        {
+            reader.ReadValue(RoleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteRoleRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FEmptyResponse::~FEmptyResponse()
 {
 
 }
 
-void PlayFab::GroupsModels::FEmptyResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FEmptyResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FEmptyResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FEmptyResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FEmptyResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1020,12 +1835,34 @@ bool PlayFab::GroupsModels::FEmptyResponse::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FEmptyResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEmptyResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FEntityMemberRole::~FEntityMemberRole()
 {
 
 }
 
-void PlayFab::GroupsModels::FEntityMemberRole::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FEntityMemberRole::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1053,6 +1890,16 @@ void PlayFab::GroupsModels::FEntityMemberRole::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FEntityMemberRole::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FEntityMemberRole::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FEntityMemberRole::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1061,7 +1908,7 @@ bool PlayFab::GroupsModels::FEntityMemberRole::readFromValue(const TSharedPtr<FJ
     for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FEntityWithLineage(CurrentItem->AsObject()));
+        Members.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -1082,13 +1929,55 @@ bool PlayFab::GroupsModels::FEntityMemberRole::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FEntityMemberRole::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Members"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Members[Members.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("RoleId"))
+        {
+            reader.ReadValue(RoleId);
+        }
+        else if (reader.IsField("RoleName"))
+        {
+            reader.ReadValue(RoleName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityMemberRole();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FGetGroupRequest::~FGetGroupRequest()
 {
     //if (Group != nullptr) delete Group;
 
 }
 
-void PlayFab::GroupsModels::FGetGroupRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FGetGroupRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1118,6 +2007,16 @@ void PlayFab::GroupsModels::FGetGroupRequest::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FGetGroupRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FGetGroupRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FGetGroupRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1127,14 +2026,14 @@ bool PlayFab::GroupsModels::FGetGroupRequest::readFromValue(const TSharedPtr<FJs
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> GroupValue = obj->TryGetField(TEXT("Group"));
     if (GroupValue.IsValid() && !GroupValue->IsNull())
     {
-        Group = MakeShareable(new FEntityKey(GroupValue->AsObject()));
+        Group = MakeShared<FEntityKey>(GroupValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> GroupNameValue = obj->TryGetField(TEXT("GroupName"));
@@ -1147,12 +2046,55 @@ bool PlayFab::GroupsModels::FGetGroupRequest::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FGetGroupRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group = MakeShared<FEntityKey>();
+            Group->readFromReader(reader);
+        }
+        else if (reader.IsField("GroupName"))
+        {
+            reader.ReadValue(GroupName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetGroupRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FGetGroupResponse::~FGetGroupResponse()
 {
 
 }
 
-void PlayFab::GroupsModels::FGetGroupResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FGetGroupResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1197,6 +2139,16 @@ void PlayFab::GroupsModels::FGetGroupResponse::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FGetGroupResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FGetGroupResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FGetGroupResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1245,13 +2197,70 @@ bool PlayFab::GroupsModels::FGetGroupResponse::readFromValue(const TSharedPtr<FJ
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*RolesObject)->Values); It; ++It)
         {
-            Roles.Add(It.Key(), It.Value()->AsString());
+            Roles.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FGetGroupResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AdminRoleId"))
+        {
+            reader.ReadValue(AdminRoleId);
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else if (reader.IsField("GroupName"))
+        {
+            reader.ReadValue(GroupName);
+        }
+        else if (reader.IsField("MemberRoleId"))
+        {
+            reader.ReadValue(MemberRoleId);
+        }
+        else if (reader.IsField("ProfileVersion"))
+        {
+            reader.ReadValue(ProfileVersion);
+        }
+        else if (reader.IsField("Roles"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Roles.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetGroupResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FGroupApplication::~FGroupApplication()
 {
     //if (Entity != nullptr) delete Entity;
@@ -1259,7 +2268,8 @@ PlayFab::GroupsModels::FGroupApplication::~FGroupApplication()
 
 }
 
-void PlayFab::GroupsModels::FGroupApplication::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FGroupApplication::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1281,6 +2291,16 @@ void PlayFab::GroupsModels::FGroupApplication::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FGroupApplication::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FGroupApplication::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FGroupApplication::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1288,7 +2308,7 @@ bool PlayFab::GroupsModels::FGroupApplication::readFromValue(const TSharedPtr<FJ
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityWithLineage(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityWithLineage>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ExpiresValue = obj->TryGetField(TEXT("Expires"));
@@ -1299,19 +2319,56 @@ bool PlayFab::GroupsModels::FGroupApplication::readFromValue(const TSharedPtr<FJ
     const TSharedPtr<FJsonValue> GroupValue = obj->TryGetField(TEXT("Group"));
     if (GroupValue.IsValid() && !GroupValue->IsNull())
     {
-        Group = MakeShareable(new FEntityKey(GroupValue->AsObject()));
+        Group = MakeShared<FEntityKey>(GroupValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FGroupApplication::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityWithLineage>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("Expires"))
+        {
+            reader.ReadValue(Expires);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group = MakeShared<FEntityKey>();
+            Group->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGroupApplication();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FGroupBlock::~FGroupBlock()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::GroupsModels::FGroupBlock::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FGroupBlock::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1327,6 +2384,16 @@ void PlayFab::GroupsModels::FGroupBlock::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FGroupBlock::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FGroupBlock::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FGroupBlock::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1334,7 +2401,7 @@ bool PlayFab::GroupsModels::FGroupBlock::readFromValue(const TSharedPtr<FJsonObj
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityWithLineage(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityWithLineage>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> GroupValue = obj->TryGetField(TEXT("Group"));
@@ -1346,15 +2413,47 @@ bool PlayFab::GroupsModels::FGroupBlock::readFromValue(const TSharedPtr<FJsonObj
     return HasSucceeded;
 }
 
-PlayFab::GroupsModels::FGroupInvitation::~FGroupInvitation()
+bool PlayFab::GroupsModels::FGroupBlock::readFromReader(FPlayFabJsonPullReader& reader)
 {
-    //if (Group != nullptr) delete Group;
-    //if (InvitedByEntity != nullptr) delete InvitedByEntity;
-    //if (InvitedEntity != nullptr) delete InvitedEntity;
+    if (!reader.ReadObjectStart())
+        return false;
 
-}
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
 
-void PlayFab::GroupsModels::FGroupInvitation::writeJSON(JsonWriter& writer) const
+        if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityWithLineage>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGroupBlock();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::GroupsModels::FGroupInvitation::~FGroupInvitation()
+{
+    //if (Group != nullptr) delete Group;
+    //if (InvitedByEntity != nullptr) delete InvitedByEntity;
+    //if (InvitedEntity != nullptr) delete InvitedEntity;
+
+}
+
+template <typename WriterType>
+void PlayFab::GroupsModels::FGroupInvitation::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1388,6 +2487,16 @@ void PlayFab::GroupsModels::FGroupInvitation::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FGroupInvitation::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FGroupInvitation::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FGroupInvitation::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1400,19 +2509,19 @@ bool PlayFab::GroupsModels::FGroupInvitation::readFromValue(const TSharedPtr<FJs
     const TSharedPtr<FJsonValue> GroupValue = obj->TryGetField(TEXT("Group"));
     if (GroupValue.IsValid() && !GroupValue->IsNull())
     {
-        Group = MakeShareable(new FEntityKey(GroupValue->AsObject()));
+        Group = MakeShared<FEntityKey>(GroupValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> InvitedByEntityValue = obj->TryGetField(TEXT("InvitedByEntity"));
     if (InvitedByEntityValue.IsValid() && !InvitedByEntityValue->IsNull())
     {
-        InvitedByEntity = MakeShareable(new FEntityWithLineage(InvitedByEntityValue->AsObject()));
+        InvitedByEntity = MakeShared<FEntityWithLineage>(InvitedByEntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> InvitedEntityValue = obj->TryGetField(TEXT("InvitedEntity"));
     if (InvitedEntityValue.IsValid() && !InvitedEntityValue->IsNull())
     {
-        InvitedEntity = MakeShareable(new FEntityWithLineage(InvitedEntityValue->AsObject()));
+        InvitedEntity = MakeShared<FEntityWithLineage>(InvitedEntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> RoleIdValue = obj->TryGetField(TEXT("RoleId"));
@@ -1425,12 +2534,58 @@ bool PlayFab::GroupsModels::FGroupInvitation::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FGroupInvitation::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Expires"))
+        {
+            reader.ReadValue(Expires);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group = MakeShared<FEntityKey>();
+            Group->readFromReader(reader);
+        }
+        else if (reader.IsField("InvitedByEntity"))
+        {
+            InvitedByEntity = MakeShared<FEntityWithLineage>();
+            InvitedByEntity->readFromReader(reader);
+        }
+        else if (reader.IsField("InvitedEntity"))
+        {
+            InvitedEntity = MakeShared<FEntityWithLineage>();
+            InvitedEntity->readFromReader(reader);
+        }
+        else if (reader.IsField("RoleId"))
+        {
+            reader.ReadValue(RoleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGroupInvitation();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FGroupRole::~FGroupRole()
 {
 
 }
 
-void PlayFab::GroupsModels::FGroupRole::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FGroupRole::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1449,6 +2604,16 @@ void PlayFab::GroupsModels::FGroupRole::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FGroupRole::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FGroupRole::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FGroupRole::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1470,13 +2635,44 @@ bool PlayFab::GroupsModels::FGroupRole::readFromValue(const TSharedPtr<FJsonObje
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FGroupRole::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("RoleId"))
+        {
+            reader.ReadValue(RoleId);
+        }
+        else if (reader.IsField("RoleName"))
+        {
+            reader.ReadValue(RoleName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGroupRole();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FGroupWithRoles::~FGroupWithRoles()
 {
     //if (Group != nullptr) delete Group;
 
 }
 
-void PlayFab::GroupsModels::FGroupWithRoles::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FGroupWithRoles::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1507,6 +2703,16 @@ void PlayFab::GroupsModels::FGroupWithRoles::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FGroupWithRoles::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FGroupWithRoles::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FGroupWithRoles::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1514,7 +2720,7 @@ bool PlayFab::GroupsModels::FGroupWithRoles::readFromValue(const TSharedPtr<FJso
     const TSharedPtr<FJsonValue> GroupValue = obj->TryGetField(TEXT("Group"));
     if (GroupValue.IsValid() && !GroupValue->IsNull())
     {
-        Group = MakeShareable(new FEntityKey(GroupValue->AsObject()));
+        Group = MakeShared<FEntityKey>(GroupValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> GroupNameValue = obj->TryGetField(TEXT("GroupName"));
@@ -1535,19 +2741,66 @@ bool PlayFab::GroupsModels::FGroupWithRoles::readFromValue(const TSharedPtr<FJso
     for (int32 Idx = 0; Idx < RolesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = RolesArray[Idx];
-        Roles.Add(FGroupRole(CurrentItem->AsObject()));
+        Roles.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FGroupWithRoles::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Group"))
+        {
+            Group = MakeShared<FEntityKey>();
+            Group->readFromReader(reader);
+        }
+        else if (reader.IsField("GroupName"))
+        {
+            reader.ReadValue(GroupName);
+        }
+        else if (reader.IsField("ProfileVersion"))
+        {
+            reader.ReadValue(ProfileVersion);
+        }
+        else if (reader.IsField("Roles"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Roles[Roles.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGroupWithRoles();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FInviteToGroupRequest::~FInviteToGroupRequest()
 {
 
 }
 
-void PlayFab::GroupsModels::FInviteToGroupRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FInviteToGroupRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1583,6 +2836,16 @@ void PlayFab::GroupsModels::FInviteToGroupRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FInviteToGroupRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FInviteToGroupRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FInviteToGroupRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1599,7 +2862,7 @@ bool PlayFab::GroupsModels::FInviteToGroupRequest::readFromValue(const TSharedPt
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1625,6 +2888,55 @@ bool PlayFab::GroupsModels::FInviteToGroupRequest::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FInviteToGroupRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AutoAcceptOutstandingApplication"))
+        {
+            reader.ReadValue(AutoAcceptOutstandingApplication);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else if (reader.IsField("RoleId"))
+        {
+            reader.ReadValue(RoleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FInviteToGroupRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FInviteToGroupResponse::~FInviteToGroupResponse()
 {
     //if (Group != nullptr) delete Group;
@@ -1633,7 +2945,8 @@ PlayFab::GroupsModels::FInviteToGroupResponse::~FInviteToGroupResponse()
 
 }
 
-void PlayFab::GroupsModels::FInviteToGroupResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FInviteToGroupResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1667,6 +2980,16 @@ void PlayFab::GroupsModels::FInviteToGroupResponse::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FInviteToGroupResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FInviteToGroupResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FInviteToGroupResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1679,19 +3002,19 @@ bool PlayFab::GroupsModels::FInviteToGroupResponse::readFromValue(const TSharedP
     const TSharedPtr<FJsonValue> GroupValue = obj->TryGetField(TEXT("Group"));
     if (GroupValue.IsValid() && !GroupValue->IsNull())
     {
-        Group = MakeShareable(new FEntityKey(GroupValue->AsObject()));
+        Group = MakeShared<FEntityKey>(GroupValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> InvitedByEntityValue = obj->TryGetField(TEXT("InvitedByEntity"));
     if (InvitedByEntityValue.IsValid() && !InvitedByEntityValue->IsNull())
     {
-        InvitedByEntity = MakeShareable(new FEntityWithLineage(InvitedByEntityValue->AsObject()));
+        InvitedByEntity = MakeShared<FEntityWithLineage>(InvitedByEntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> InvitedEntityValue = obj->TryGetField(TEXT("InvitedEntity"));
     if (InvitedEntityValue.IsValid() && !InvitedEntityValue->IsNull())
     {
-        InvitedEntity = MakeShareable(new FEntityWithLineage(InvitedEntityValue->AsObject()));
+        InvitedEntity = MakeShared<FEntityWithLineage>(InvitedEntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> RoleIdValue = obj->TryGetField(TEXT("RoleId"));
@@ -1704,12 +3027,58 @@ bool PlayFab::GroupsModels::FInviteToGroupResponse::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FInviteToGroupResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Expires"))
+        {
+            reader.ReadValue(Expires);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group = MakeShared<FEntityKey>();
+            Group->readFromReader(reader);
+        }
+        else if (reader.IsField("InvitedByEntity"))
+        {
+            InvitedByEntity = MakeShared<FEntityWithLineage>();
+            InvitedByEntity->readFromReader(reader);
+        }
+        else if (reader.IsField("InvitedEntity"))
+        {
+            InvitedEntity = MakeShared<FEntityWithLineage>();
+            InvitedEntity->readFromReader(reader);
+        }
+        else if (reader.IsField("RoleId"))
+        {
+            reader.ReadValue(RoleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FInviteToGroupResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FIsMemberRequest::~FIsMemberRequest()
 {
 
 }
 
-void PlayFab::GroupsModels::FIsMemberRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FIsMemberRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1739,6 +3108,16 @@ void PlayFab::GroupsModels::FIsMemberRequest::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FIsMemberRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FIsMemberRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FIsMemberRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1748,7 +3127,7 @@ bool PlayFab::GroupsModels::FIsMemberRequest::readFromValue(const TSharedPtr<FJs
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1774,12 +3153,58 @@ bool PlayFab::GroupsModels::FIsMemberRequest::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FIsMemberRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else if (reader.IsField("RoleId"))
+        {
+            reader.ReadValue(RoleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FIsMemberRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FIsMemberResponse::~FIsMemberResponse()
 {
 
 }
 
-void PlayFab::GroupsModels::FIsMemberResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FIsMemberResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1789,6 +3214,16 @@ void PlayFab::GroupsModels::FIsMemberResponse::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FIsMemberResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FIsMemberResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FIsMemberResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1803,12 +3238,39 @@ bool PlayFab::GroupsModels::FIsMemberResponse::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FIsMemberResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("IsMember"))
+        {
+            reader.ReadValue(IsMember);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FIsMemberResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FListGroupApplicationsRequest::~FListGroupApplicationsRequest()
 {
 
 }
 
-void PlayFab::GroupsModels::FListGroupApplicationsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FListGroupApplicationsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1829,6 +3291,16 @@ void PlayFab::GroupsModels::FListGroupApplicationsRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FListGroupApplicationsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FListGroupApplicationsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FListGroupApplicationsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1838,7 +3310,7 @@ bool PlayFab::GroupsModels::FListGroupApplicationsRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1851,12 +3323,50 @@ bool PlayFab::GroupsModels::FListGroupApplicationsRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FListGroupApplicationsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListGroupApplicationsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FListGroupApplicationsResponse::~FListGroupApplicationsResponse()
 {
 
 }
 
-void PlayFab::GroupsModels::FListGroupApplicationsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FListGroupApplicationsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1872,6 +3382,16 @@ void PlayFab::GroupsModels::FListGroupApplicationsResponse::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FListGroupApplicationsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FListGroupApplicationsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FListGroupApplicationsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1880,19 +3400,53 @@ bool PlayFab::GroupsModels::FListGroupApplicationsResponse::readFromValue(const
     for (int32 Idx = 0; Idx < ApplicationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ApplicationsArray[Idx];
-        Applications.Add(FGroupApplication(CurrentItem->AsObject()));
+        Applications.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FListGroupApplicationsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Applications"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Applications[Applications.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListGroupApplicationsResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FListGroupBlocksRequest::~FListGroupBlocksRequest()
 {
 
 }
 
-void PlayFab::GroupsModels::FListGroupBlocksRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FListGroupBlocksRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1913,6 +3467,16 @@ void PlayFab::GroupsModels::FListGroupBlocksRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FListGroupBlocksRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FListGroupBlocksRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FListGroupBlocksRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1922,7 +3486,7 @@ bool PlayFab::GroupsModels::FListGroupBlocksRequest::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1935,12 +3499,50 @@ bool PlayFab::GroupsModels::FListGroupBlocksRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FListGroupBlocksRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListGroupBlocksRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FListGroupBlocksResponse::~FListGroupBlocksResponse()
 {
 
 }
 
-void PlayFab::GroupsModels::FListGroupBlocksResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FListGroupBlocksResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1956,6 +3558,16 @@ void PlayFab::GroupsModels::FListGroupBlocksResponse::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FListGroupBlocksResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FListGroupBlocksResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FListGroupBlocksResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1964,19 +3576,53 @@ bool PlayFab::GroupsModels::FListGroupBlocksResponse::readFromValue(const TShare
     for (int32 Idx = 0; Idx < BlockedEntitiesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BlockedEntitiesArray[Idx];
-        BlockedEntities.Add(FGroupBlock(CurrentItem->AsObject()));
+        BlockedEntities.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FListGroupBlocksResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BlockedEntities"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { BlockedEntities[BlockedEntities.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListGroupBlocksResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FListGroupInvitationsRequest::~FListGroupInvitationsRequest()
 {
 
 }
 
-void PlayFab::GroupsModels::FListGroupInvitationsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FListGroupInvitationsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1997,6 +3643,16 @@ void PlayFab::GroupsModels::FListGroupInvitationsRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FListGroupInvitationsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FListGroupInvitationsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FListGroupInvitationsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2006,7 +3662,7 @@ bool PlayFab::GroupsModels::FListGroupInvitationsRequest::readFromValue(const TS
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2019,12 +3675,50 @@ bool PlayFab::GroupsModels::FListGroupInvitationsRequest::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FListGroupInvitationsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListGroupInvitationsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FListGroupInvitationsResponse::~FListGroupInvitationsResponse()
 {
 
 }
 
-void PlayFab::GroupsModels::FListGroupInvitationsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FListGroupInvitationsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2040,6 +3734,16 @@ void PlayFab::GroupsModels::FListGroupInvitationsResponse::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FListGroupInvitationsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FListGroupInvitationsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FListGroupInvitationsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2048,19 +3752,53 @@ bool PlayFab::GroupsModels::FListGroupInvitationsResponse::readFromValue(const T
     for (int32 Idx = 0; Idx < InvitationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = InvitationsArray[Idx];
-        Invitations.Add(FGroupInvitation(CurrentItem->AsObject()));
+        Invitations.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FListGroupInvitationsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Invitations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Invitations[Invitations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListGroupInvitationsResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FListGroupMembersRequest::~FListGroupMembersRequest()
 {
 
 }
 
-void PlayFab::GroupsModels::FListGroupMembersRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FListGroupMembersRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2081,6 +3819,16 @@ void PlayFab::GroupsModels::FListGroupMembersRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FListGroupMembersRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FListGroupMembersRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FListGroupMembersRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2090,7 +3838,7 @@ bool PlayFab::GroupsModels::FListGroupMembersRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2103,12 +3851,50 @@ bool PlayFab::GroupsModels::FListGroupMembersRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FListGroupMembersRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListGroupMembersRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FListGroupMembersResponse::~FListGroupMembersResponse()
 {
 
 }
 
-void PlayFab::GroupsModels::FListGroupMembersResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FListGroupMembersResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2124,6 +3910,16 @@ void PlayFab::GroupsModels::FListGroupMembersResponse::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FListGroupMembersResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FListGroupMembersResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FListGroupMembersResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2132,20 +3928,54 @@ bool PlayFab::GroupsModels::FListGroupMembersResponse::readFromValue(const TShar
     for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FEntityMemberRole(CurrentItem->AsObject()));
+        Members.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FListGroupMembersResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Members"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Members[Members.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListGroupMembersResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FListMembershipOpportunitiesRequest::~FListMembershipOpportunitiesRequest()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::GroupsModels::FListMembershipOpportunitiesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FListMembershipOpportunitiesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2169,6 +3999,16 @@ void PlayFab::GroupsModels::FListMembershipOpportunitiesRequest::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FListMembershipOpportunitiesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FListMembershipOpportunitiesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FListMembershipOpportunitiesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2178,25 +4018,64 @@ bool PlayFab::GroupsModels::FListMembershipOpportunitiesRequest::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FListMembershipOpportunitiesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListMembershipOpportunitiesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FListMembershipOpportunitiesResponse::~FListMembershipOpportunitiesResponse()
 {
 
 }
 
-void PlayFab::GroupsModels::FListMembershipOpportunitiesResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FListMembershipOpportunitiesResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2221,6 +4100,16 @@ void PlayFab::GroupsModels::FListMembershipOpportunitiesResponse::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FListMembershipOpportunitiesResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FListMembershipOpportunitiesResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FListMembershipOpportunitiesResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2229,7 +4118,7 @@ bool PlayFab::GroupsModels::FListMembershipOpportunitiesResponse::readFromValue(
     for (int32 Idx = 0; Idx < ApplicationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ApplicationsArray[Idx];
-        Applications.Add(FGroupApplication(CurrentItem->AsObject()));
+        Applications.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2237,20 +4126,65 @@ bool PlayFab::GroupsModels::FListMembershipOpportunitiesResponse::readFromValue(
     for (int32 Idx = 0; Idx < InvitationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = InvitationsArray[Idx];
-        Invitations.Add(FGroupInvitation(CurrentItem->AsObject()));
+        Invitations.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FListMembershipOpportunitiesResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Applications"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Applications[Applications.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Invitations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Invitations[Invitations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListMembershipOpportunitiesResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FListMembershipRequest::~FListMembershipRequest()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::GroupsModels::FListMembershipRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FListMembershipRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2274,6 +4208,16 @@ void PlayFab::GroupsModels::FListMembershipRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FListMembershipRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FListMembershipRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FListMembershipRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2283,25 +4227,64 @@ bool PlayFab::GroupsModels::FListMembershipRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FListMembershipRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListMembershipRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FListMembershipResponse::~FListMembershipResponse()
 {
 
 }
 
-void PlayFab::GroupsModels::FListMembershipResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FListMembershipResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2317,6 +4300,16 @@ void PlayFab::GroupsModels::FListMembershipResponse::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FListMembershipResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FListMembershipResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FListMembershipResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2325,14 +4318,48 @@ bool PlayFab::GroupsModels::FListMembershipResponse::readFromValue(const TShared
     for (int32 Idx = 0; Idx < GroupsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GroupsArray[Idx];
-        Groups.Add(FGroupWithRoles(CurrentItem->AsObject()));
+        Groups.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
-void PlayFab::GroupsModels::writeOperationTypesEnumJSON(OperationTypes enumVal, JsonWriter& writer)
+bool PlayFab::GroupsModels::FListMembershipResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Groups"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Groups[Groups.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListMembershipResponse();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeOperationTypesEnumValue(GroupsModels::OperationTypes enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -2344,6 +4371,16 @@ void PlayFab::GroupsModels::writeOperationTypesEnumJSON(OperationTypes enumVal,
     }
 }
 
+void PlayFab::GroupsModels::writeOperationTypesEnumJSON(OperationTypes enumVal, JsonWriter& writer)
+{
+    writeOperationTypesEnumValue(enumVal, writer);
+}
+
+void PlayFab::GroupsModels::writeOperationTypesEnumJSON(OperationTypes enumVal, JsonUtf8Writer& writer)
+{
+    writeOperationTypesEnumValue(enumVal, writer);
+}
+
 GroupsModels::OperationTypes PlayFab::GroupsModels::readOperationTypesFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readOperationTypesFromValue(value.IsValid() ? value->AsString() : "");
@@ -2377,7 +4414,8 @@ PlayFab::GroupsModels::FRemoveGroupApplicationRequest::~FRemoveGroupApplicationR
 
 }
 
-void PlayFab::GroupsModels::FRemoveGroupApplicationRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FRemoveGroupApplicationRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2401,6 +4439,16 @@ void PlayFab::GroupsModels::FRemoveGroupApplicationRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FRemoveGroupApplicationRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FRemoveGroupApplicationRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FRemoveGroupApplicationRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2410,7 +4458,7 @@ bool PlayFab::GroupsModels::FRemoveGroupApplicationRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2429,12 +4477,54 @@ bool PlayFab::GroupsModels::FRemoveGroupApplicationRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FRemoveGroupApplicationRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemoveGroupApplicationRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FRemoveGroupInvitationRequest::~FRemoveGroupInvitationRequest()
 {
 
 }
 
-void PlayFab::GroupsModels::FRemoveGroupInvitationRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FRemoveGroupInvitationRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2458,6 +4548,16 @@ void PlayFab::GroupsModels::FRemoveGroupInvitationRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FRemoveGroupInvitationRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FRemoveGroupInvitationRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FRemoveGroupInvitationRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2467,7 +4567,7 @@ bool PlayFab::GroupsModels::FRemoveGroupInvitationRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2486,12 +4586,54 @@ bool PlayFab::GroupsModels::FRemoveGroupInvitationRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FRemoveGroupInvitationRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemoveGroupInvitationRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FRemoveMembersRequest::~FRemoveMembersRequest()
 {
 
 }
 
-void PlayFab::GroupsModels::FRemoveMembersRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FRemoveMembersRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2524,6 +4666,16 @@ void PlayFab::GroupsModels::FRemoveMembersRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FRemoveMembersRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FRemoveMembersRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FRemoveMembersRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2533,7 +4685,7 @@ bool PlayFab::GroupsModels::FRemoveMembersRequest::readFromValue(const TSharedPt
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2547,7 +4699,7 @@ bool PlayFab::GroupsModels::FRemoveMembersRequest::readFromValue(const TSharedPt
     for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FEntityKey(CurrentItem->AsObject()));
+        Members.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2561,12 +4713,65 @@ bool PlayFab::GroupsModels::FRemoveMembersRequest::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FRemoveMembersRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else if (reader.IsField("Members"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Members[Members.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("RoleId"))
+        {
+            reader.ReadValue(RoleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRemoveMembersRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FUnblockEntityRequest::~FUnblockEntityRequest()
 {
 
 }
 
-void PlayFab::GroupsModels::FUnblockEntityRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FUnblockEntityRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2590,6 +4795,16 @@ void PlayFab::GroupsModels::FUnblockEntityRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FUnblockEntityRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FUnblockEntityRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FUnblockEntityRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2599,7 +4814,7 @@ bool PlayFab::GroupsModels::FUnblockEntityRequest::readFromValue(const TSharedPt
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2618,12 +4833,54 @@ bool PlayFab::GroupsModels::FUnblockEntityRequest::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FUnblockEntityRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUnblockEntityRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FUpdateGroupRequest::~FUpdateGroupRequest()
 {
 
 }
 
-void PlayFab::GroupsModels::FUpdateGroupRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FUpdateGroupRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2668,6 +4925,16 @@ void PlayFab::GroupsModels::FUpdateGroupRequest::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FUpdateGroupRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FUpdateGroupRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FUpdateGroupRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2684,7 +4951,7 @@ bool PlayFab::GroupsModels::FUpdateGroupRequest::readFromValue(const TSharedPtr<
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2718,12 +4985,66 @@ bool PlayFab::GroupsModels::FUpdateGroupRequest::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FUpdateGroupRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AdminRoleId"))
+        {
+            reader.ReadValue(AdminRoleId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ExpectedProfileVersion"))
+        {
+            reader.ReadValue(ExpectedProfileVersion);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else if (reader.IsField("GroupName"))
+        {
+            reader.ReadValue(GroupName);
+        }
+        else if (reader.IsField("MemberRoleId"))
+        {
+            reader.ReadValue(MemberRoleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateGroupRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FUpdateGroupResponse::~FUpdateGroupResponse()
 {
 
 }
 
-void PlayFab::GroupsModels::FUpdateGroupResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FUpdateGroupResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2745,6 +5066,16 @@ void PlayFab::GroupsModels::FUpdateGroupResponse::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FUpdateGroupResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FUpdateGroupResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FUpdateGroupResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2768,12 +5099,48 @@ bool PlayFab::GroupsModels::FUpdateGroupResponse::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FUpdateGroupResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("OperationReason"))
+        {
+            reader.ReadValue(OperationReason);
+        }
+        else if (reader.IsField("ProfileVersion"))
+        {
+            reader.ReadValue(ProfileVersion);
+        }
+        else if (reader.IsField("SetResult"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { SetResult = readOperationTypesFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateGroupResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FUpdateGroupRoleRequest::~FUpdateGroupRoleRequest()
 {
 
 }
 
-void PlayFab::GroupsModels::FUpdateGroupRoleRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FUpdateGroupRoleRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2816,6 +5183,16 @@ void PlayFab::GroupsModels::FUpdateGroupRoleRequest::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FUpdateGroupRoleRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FUpdateGroupRoleRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FUpdateGroupRoleRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2825,7 +5202,7 @@ bool PlayFab::GroupsModels::FUpdateGroupRoleRequest::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2859,12 +5236,62 @@ bool PlayFab::GroupsModels::FUpdateGroupRoleRequest::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FUpdateGroupRoleRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ExpectedProfileVersion"))
+        {
+            reader.ReadValue(ExpectedProfileVersion);
+        }
+        else if (reader.IsField("Group"))
+        {
+            Group.readFromReader(reader);
+        }
+        else if (reader.IsField("RoleId"))
+        {
+            reader.ReadValue(RoleId);
+        }
+        else if (reader.IsField("RoleName"))
+        {
+            reader.ReadValue(RoleName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateGroupRoleRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::GroupsModels::FUpdateGroupRoleResponse::~FUpdateGroupRoleResponse()
 {
 
 }
 
-void PlayFab::GroupsModels::FUpdateGroupRoleResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::GroupsModels::FUpdateGroupRoleResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2886,6 +5313,16 @@ void PlayFab::GroupsModels::FUpdateGroupRoleResponse::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::GroupsModels::FUpdateGroupRoleResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::GroupsModels::FUpdateGroupRoleResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::GroupsModels::FUpdateGroupRoleResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2909,3 +5346,38 @@ bool PlayFab::GroupsModels::FUpdateGroupRoleResponse::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::GroupsModels::FUpdateGroupRoleResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("OperationReason"))
+        {
+            reader.ReadValue(OperationReason);
+        }
+        else if (reader.IsField("ProfileVersion"))
+        {
+            reader.ReadValue(ProfileVersion);
+        }
+        else if (reader.IsField("SetResult"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { SetResult = readOperationTypesFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateGroupRoleResponse();
+        return false;
+    }
+    return true;
+}
+
@@ -0,0 +1,78 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabLatencyTracker.h"
+#include "Misc/ScopeLock.h"
+
+using namespace PlayFab;
+
+namespace
+{
+    struct FEndpointLatency
+    {
+        // Ring of the latest samples; Next is where the next one goes
+        TArray<float> Samples;
+        int32 Next = 0;
+        // Samples in ascending order, empty until a percentile is asked for after a new sample
+        TArray<float> Sorted;
+    };
+
+    FCriticalSection LatencyLock;
+    TMap<FString, FEndpointLatency> Endpoints;
+    FPlayFabHedgingStats HedgingStats;
+}
+
+void FPlayFabLatencyTracker::AddSample(const FString& UrlPath, float Seconds)
+{
+    FScopeLock Lock(&LatencyLock);
+    FEndpointLatency& Endpoint = Endpoints.FindOrAdd(UrlPath);
+    if (Endpoint.Samples.Num() < WindowSize)
+    {
+        Endpoint.Samples.Add(Seconds);
+    }
+    else
+    {
+        Endpoint.Samples[Endpoint.Next] = Seconds;
+    }
+    Endpoint.Next = (Endpoint.Next + 1) % WindowSize;
+    Endpoint.Sorted.Reset();
+}
+
+bool FPlayFabLatencyTracker::GetPercentile(const FString& UrlPath, float Percentile, float& OutSeconds)
+{
+    FScopeLock Lock(&LatencyLock);
+    FEndpointLatency* Endpoint = Endpoints.Find(UrlPath);
+    if (Endpoint == nullptr || Endpoint->Samples.Num() < MinSamples)
+    {
+        return false;
+    }
+
+    if (Endpoint->Sorted.Num() == 0)
+    {
+        Endpoint->Sorted = Endpoint->Samples;
+        Endpoint->Sorted.Sort();
+    }
+    const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile * Endpoint->Sorted.Num()) - 1, 0, Endpoint->Sorted.Num() - 1);
+    OutSeconds = Endpoint->Sorted[Index];
+    return true;
+}
+
+void FPlayFabLatencyTracker::OnHedgeSent()
+{
+    FScopeLock Lock(&LatencyLock);
+    HedgingStats.HedgesSent++;
+}
+
+void FPlayFabLatencyTracker::OnHedgeWon()
+{
+    FScopeLock Lock(&LatencyLock);
+    HedgingStats.HedgesWon++;
+}
+
+FPlayFabHedgingStats FPlayFabLatencyTracker::GetHedgingStats()
+{
+    FScopeLock Lock(&LatencyLock);
+    return HedgingStats;
+}
@@ -30,7 +30,8 @@ FString UPlayFabProfilesAPI::GetBuildIdentifier() const
 bool UPlayFabProfilesAPI::GetGlobalPolicy(
     ProfilesModels::FGetGlobalPolicyRequest& request,
     const FGetGlobalPolicyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -38,29 +39,32 @@ bool UPlayFabProfilesAPI::GetGlobalPolicy(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/GetGlobalPolicy"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/GetGlobalPolicy"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesAPI::OnGetGlobalPolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ProfilesModels::FGetGlobalPolicyResponse>> UPlayFabProfilesAPI::GetGlobalPolicyAsync(ProfilesModels::FGetGlobalPolicyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ProfilesModels::FGetGlobalPolicyResponse, FGetGlobalPolicyDelegate>([this, &request, &Handle](const FGetGlobalPolicyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabProfilesAPI::GetGlobalPolicy(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabProfilesAPI::OnGetGlobalPolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetGlobalPolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ProfilesModels::FGetGlobalPolicyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ProfilesModels::FGetGlobalPolicyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ProfilesModels::FGetGlobalPolicyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabProfilesAPI::GetProfile(
     ProfilesModels::FGetEntityProfileRequest& request,
     const FGetProfileDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -68,29 +72,32 @@ bool UPlayFabProfilesAPI::GetProfile(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/GetProfile"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/GetProfile"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesAPI::OnGetProfileResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ProfilesModels::FGetEntityProfileResponse>> UPlayFabProfilesAPI::GetProfileAsync(ProfilesModels::FGetEntityProfileRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ProfilesModels::FGetEntityProfileResponse, FGetProfileDelegate>([this, &request, &Handle](const FGetProfileDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabProfilesAPI::GetProfile(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabProfilesAPI::OnGetProfileResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetProfileDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ProfilesModels::FGetEntityProfileResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ProfilesModels::FGetEntityProfileResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ProfilesModels::FGetEntityProfileResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabProfilesAPI::GetProfiles(
     ProfilesModels::FGetEntityProfilesRequest& request,
     const FGetProfilesDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -98,29 +105,32 @@ bool UPlayFabProfilesAPI::GetProfiles(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/GetProfiles"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/GetProfiles"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesAPI::OnGetProfilesResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ProfilesModels::FGetEntityProfilesResponse>> UPlayFabProfilesAPI::GetProfilesAsync(ProfilesModels::FGetEntityProfilesRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ProfilesModels::FGetEntityProfilesResponse, FGetProfilesDelegate>([this, &request, &Handle](const FGetProfilesDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabProfilesAPI::GetProfiles(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabProfilesAPI::OnGetProfilesResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetProfilesDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ProfilesModels::FGetEntityProfilesResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ProfilesModels::FGetEntityProfilesResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ProfilesModels::FGetEntityProfilesResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabProfilesAPI::GetTitlePlayersFromMasterPlayerAccountIds(
     ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsRequest& request,
     const FGetTitlePlayersFromMasterPlayerAccountIdsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -128,29 +138,32 @@ bool UPlayFabProfilesAPI::GetTitlePlayersFromMasterPlayerAccountIds(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/GetTitlePlayersFromMasterPlayerAccountIds"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/GetTitlePlayersFromMasterPlayerAccountIds"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesAPI::OnGetTitlePlayersFromMasterPlayerAccountIdsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsResponse>> UPlayFabProfilesAPI::GetTitlePlayersFromMasterPlayerAccountIdsAsync(ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsResponse, FGetTitlePlayersFromMasterPlayerAccountIdsDelegate>([this, &request, &Handle](const FGetTitlePlayersFromMasterPlayerAccountIdsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabProfilesAPI::GetTitlePlayersFromMasterPlayerAccountIds(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabProfilesAPI::OnGetTitlePlayersFromMasterPlayerAccountIdsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetTitlePlayersFromMasterPlayerAccountIdsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabProfilesAPI::SetGlobalPolicy(
     ProfilesModels::FSetGlobalPolicyRequest& request,
     const FSetGlobalPolicyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -158,29 +171,32 @@ bool UPlayFabProfilesAPI::SetGlobalPolicy(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/SetGlobalPolicy"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/SetGlobalPolicy"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesAPI::OnSetGlobalPolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ProfilesModels::FSetGlobalPolicyResponse>> UPlayFabProfilesAPI::SetGlobalPolicyAsync(ProfilesModels::FSetGlobalPolicyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ProfilesModels::FSetGlobalPolicyResponse, FSetGlobalPolicyDelegate>([this, &request, &Handle](const FSetGlobalPolicyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabProfilesAPI::SetGlobalPolicy(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabProfilesAPI::OnSetGlobalPolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetGlobalPolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ProfilesModels::FSetGlobalPolicyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ProfilesModels::FSetGlobalPolicyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ProfilesModels::FSetGlobalPolicyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabProfilesAPI::SetProfileLanguage(
     ProfilesModels::FSetProfileLanguageRequest& request,
     const FSetProfileLanguageDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -188,29 +204,32 @@ bool UPlayFabProfilesAPI::SetProfileLanguage(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/SetProfileLanguage"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/SetProfileLanguage"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesAPI::OnSetProfileLanguageResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ProfilesModels::FSetProfileLanguageResponse>> UPlayFabProfilesAPI::SetProfileLanguageAsync(ProfilesModels::FSetProfileLanguageRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ProfilesModels::FSetProfileLanguageResponse, FSetProfileLanguageDelegate>([this, &request, &Handle](const FSetProfileLanguageDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabProfilesAPI::SetProfileLanguage(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabProfilesAPI::OnSetProfileLanguageResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetProfileLanguageDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ProfilesModels::FSetProfileLanguageResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ProfilesModels::FSetProfileLanguageResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ProfilesModels::FSetProfileLanguageResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabProfilesAPI::SetProfilePolicy(
     ProfilesModels::FSetEntityProfilePolicyRequest& request,
     const FSetProfilePolicyDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -218,21 +237,23 @@ bool UPlayFabProfilesAPI::SetProfilePolicy(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/SetProfilePolicy"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Profile/SetProfilePolicy"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabProfilesAPI::OnSetProfilePolicyResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<ProfilesModels::FSetEntityProfilePolicyResponse>> UPlayFabProfilesAPI::SetProfilePolicyAsync(ProfilesModels::FSetEntityProfilePolicyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<ProfilesModels::FSetEntityProfilePolicyResponse, FSetProfilePolicyDelegate>([this, &request, &Handle](const FSetProfilePolicyDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabProfilesAPI::SetProfilePolicy(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabProfilesAPI::OnSetProfilePolicyResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetProfilePolicyDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    ProfilesModels::FSetEntityProfilePolicyResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<ProfilesModels::FSetEntityProfilePolicyResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](ProfilesModels::FSetEntityProfilePolicyResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
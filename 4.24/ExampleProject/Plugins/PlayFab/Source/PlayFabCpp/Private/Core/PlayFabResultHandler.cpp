@@ -4,16 +4,116 @@
 
 
 #include "PlayFabResultHandler.h"
+#include "PlayFabJsonPullReader.h"
 #include "PlayFab.h"
-#include "Serialization/JsonSerializer.h"
+#include "PlayFabRetryPolicy.h"
+#include "PlayFabRequestCoalescer.h"
+#include "PlayFabCompression.h"
+#include "PlayFabCompletionQueue.h"
+#include "PlayFabCallCounters.h"
+#include "PlayFabConnectionWarmer.h"
+#include "PlayFabLatencyTracker.h"
+#include "PlayFabCircuitBreaker.h"
+#include "PlayFabEndpointMetrics.h"
+#include "PlayFabRequestLog.h"
+#include "Containers/Ticker.h"
+#include "Async/Async.h"
+#include "Misc/ScopeLock.h"
 
 using namespace PlayFab;
 
-int PlayFabRequestHandler::pendingCalls = 0;
+namespace
+{
+    FCriticalSection DispatcherLock;
+    PlayFabRequestHandler::FResponseDispatcher ResponseDispatcher;
+
+    // The call whose result DeliverToCaller is handing to its result handler on this thread, see DecodeAndDispatch
+    thread_local const TSharedPtr<IPlayFabCancellable, ESPMode::ThreadSafe>* DeliveringCall = nullptr;
+
+    // Set on requests the circuit breaker turned away, so that their result handler reports why they have no response; it is never sent
+    const TCHAR* CircuitOpenHeader = TEXT("X-PlayFabCircuitOpen");
+
+    bool WasFailedFast(const FHttpRequestPtr& HttpRequest)
+    {
+        return HttpRequest.IsValid() && !HttpRequest->GetHeader(CircuitOpenHeader).IsEmpty();
+    }
+
+    FString GetUrlPath(const FString& Url)
+    {
+        FString UrlPath, ApiName;
+        PlayFabCommon::FPlayFabCallCounters::ParseRequestUrl(Url, UrlPath, ApiName);
+        return UrlPath;
+    }
+
+    FString GetApiName(const FString& Url)
+    {
+        FString UrlPath, ApiName;
+        PlayFabCommon::FPlayFabCallCounters::ParseRequestUrl(Url, UrlPath, ApiName);
+        return ApiName;
+    }
+
+    // How long to wait for the first attempt of a read call before sending a duplicate; false if the call isn't hedged
+    bool GetHedgeDelay(const FString& UrlPath, float& OutDelay)
+    {
+        const UPlayFabRuntimeSettings* Settings = GetDefault<UPlayFabRuntimeSettings>();
+        if (!Settings->bEnableRequestHedging)
+        {
+            return false;
+        }
+
+        int32 NameStart = INDEX_NONE;
+        UrlPath.FindLastChar(TEXT('/'), NameStart);
+        const FString CallName = UrlPath.Mid(NameStart + 1);
+        if (!Settings->HedgedCalls.ContainsByPredicate([&CallName](const FString& Hedged) { return Hedged.Equals(CallName, ESearchCase::IgnoreCase); }))
+        {
+            return false;
+        }
+
+        float P95 = 0.0f;
+        if (!FPlayFabLatencyTracker::GetPercentile(UrlPath, 0.95f, P95))
+        {
+            return false;
+        }
+        OutDelay = FMath::Max(P95, Settings->MinHedgeDelaySeconds);
+        return true;
+    }
+}
+
+bool PlayFabRequestHandler::Prewarm()
+{
+    if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() == 0)
+    {
+        UE_LOG(LogPlayFabCpp, Warning, TEXT("PlayFab connections can't be warmed before the title id is set"));
+        return false;
+    }
+
+    FPlayFabConnectionWarmer::Prewarm(PlayFabSettings::GeneratePfUrl(TEXT("/")), GetDefault<UPlayFabRuntimeSettings>()->PrewarmConnectionCount);
+    return true;
+}
+
+FPlayFabConnectionStats PlayFabRequestHandler::GetConnectionStats()
+{
+    return FPlayFabConnectionWarmer::GetStats();
+}
+
+FPlayFabHedgingStats PlayFabRequestHandler::GetHedgingStats()
+{
+    return FPlayFabLatencyTracker::GetHedgingStats();
+}
+
+bool PlayFabRequestHandler::GetEndpointMetrics(const FString& UrlPath, FPlayFabEndpointMetrics& OutMetrics)
+{
+    return FPlayFabMetrics::GetEndpointMetrics(UrlPath, OutMetrics);
+}
+
+TMap<FString, FPlayFabEndpointMetrics> PlayFabRequestHandler::GetEndpointMetrics()
+{
+    return FPlayFabMetrics::GetAllEndpointMetrics();
+}
 
 int PlayFabRequestHandler::GetPendingCalls()
 {
-    return PlayFabRequestHandler::pendingCalls;
+    return PlayFabCommon::FPlayFabCallCounters::GetTotalStats().InFlight;
 }
 
 TSharedRef<IHttpRequest> PlayFabRequestHandler::SendRequest(TSharedPtr<UPlayFabAPISettings> settings, const FString& urlPath, const FString& callBody, const FString& authKey, const FString& authValue)
@@ -22,80 +122,764 @@ TSharedRef<IHttpRequest> PlayFabRequestHandler::SendRequest(TSharedPtr<UPlayFabA
     return SendFullUrlRequest(fullUrl, callBody, authKey, authValue);
 }
 
+TSharedRef<IHttpRequest> PlayFabRequestHandler::SendRequest(TSharedPtr<UPlayFabAPISettings> settings, const FString& urlPath, const TArray<uint8>& callBody, const FString& authKey, const FString& authValue)
+{
+    FString fullUrl = settings.IsValid() ? settings->GeneratePfUrl(urlPath) : PlayFabSettings::GeneratePfUrl(urlPath);
+    return SendFullUrlRequest(fullUrl, callBody, authKey, authValue);
+}
+
 TSharedRef<IHttpRequest> PlayFabRequestHandler::SendFullUrlRequest(const FString& fullUrl, const FString& callBody, const FString& authKey, const FString& authValue)
+{
+    TSharedRef<IHttpRequest> HttpRequest = CreateRequest(fullUrl, authKey, authValue);
+    PlayFabCommon::FPlayFabRequestLog::LogRequest(HttpRequest, callBody);
+    if (FPlayFabCompression::IsEnabled())
+    {
+        FTCHARToUTF8 Utf8Body(*callBody);
+        FPlayFabCompression::SetRequestBody(HttpRequest, TArray<uint8>((const uint8*)Utf8Body.Get(), Utf8Body.Length()));
+    }
+    else
+    {
+        HttpRequest->SetContentAsString(callBody);
+    }
+    return HttpRequest;
+}
+
+TSharedRef<IHttpRequest> PlayFabRequestHandler::SendFullUrlRequest(const FString& fullUrl, const TArray<uint8>& callBody, const FString& authKey, const FString& authValue)
+{
+    TSharedRef<IHttpRequest> HttpRequest = CreateRequest(fullUrl, authKey, authValue);
+    PlayFabCommon::FPlayFabRequestLog::LogRequest(HttpRequest, callBody);
+    FPlayFabCompression::SetRequestBody(HttpRequest, callBody);
+    return HttpRequest;
+}
+
+TSharedRef<IHttpRequest> PlayFabRequestHandler::CreateRequest(const FString& fullUrl, const FString& authKey, const FString& authValue)
 {
     if (GetDefault<UPlayFabRuntimeSettings>()->TitleId.Len() == 0) {
         UE_LOG(LogPlayFabCpp, Error, TEXT("You must define a titleID before making API Calls."));
     }
-    PlayFabRequestHandler::pendingCalls += 1;
 
     TSharedRef<IHttpRequest> HttpRequest = FHttpModule::Get().CreateRequest();
     HttpRequest->SetVerb(TEXT("POST"));
     HttpRequest->SetURL(fullUrl);
     HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json; charset=utf-8"));
     HttpRequest->SetHeader(TEXT("X-PlayFabSDK"), PlayFabSettings::versionString);
+    if (FPlayFabCompression::IsEnabled())
+        HttpRequest->SetHeader(TEXT("Accept-Encoding"), TEXT("gzip"));
 
     if (authKey != TEXT(""))
         HttpRequest->SetHeader(authKey, authValue);
 
-    HttpRequest->SetContentAsString(callBody);
     return HttpRequest;
 }
 
-bool PlayFabRequestHandler::DecodeRequest(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, PlayFab::FPlayFabCppBaseModel& OutResult, PlayFab::FPlayFabCppError& OutError)
+// Everything the attempts of one call share
+struct PlayFabRequestHandler::FCallState : public IPlayFabCancellable
 {
-    PlayFabRequestHandler::pendingCalls -= 1;
+    FHttpRequestCompleteDelegate OnComplete;
+    FString RequestUrl;
+    bool bIsIdempotent = false;
+    EPlayFabRequestPriority Priority = EPlayFabRequestPriority::Normal;
+    int32 RetryAttempt = 0;
+    // Set when other callers may join this call, see FPlayFabRequestCoalescer
+    FString CoalescingKey;
+    // The latest attempt, and whether it has been handed to the governor and hasn't completed yet
+    FHttpRequestPtr CurrentRequest;
+    bool bIsAttemptSubmitted = false;
+    // Duplicate of the first attempt, while both are in flight
+    FHttpRequestPtr HedgeRequest;
+    // Set when the first attempt or the hedge is a half-open circuit's probe, see FPlayFabCircuitBreaker::TryAcquire
+    uint64 CircuitProbeId = 0;
+    uint64 HedgeCircuitProbeId = 0;
+    // Platform time at which the call times out, 0 if it has no deadline
+    double Deadline = 0.0;
+    // Set once the caller's delegate has run, or once it is certain not to run
+    FThreadSafeBool bIsFinished;
+    // Set by Cancel even once the call is finished, so that a result already on its way to the caller is dropped
+    FThreadSafeBool bIsCancelled;
+    // Set once the delegates have run or are certain not to, which for a result that is decoded or queued is after bIsFinished
+    FThreadSafeBool bIsDelivered;
+    // Set when the result handler has left the delegates to run later, see DecodeAndDispatch
+    FThreadSafeBool bIsDeliveryDeferred;
 
-    FString ResponseStr, ErrorStr;
-    if (bSucceeded && HttpResponse.IsValid())
+    virtual void Cancel() override
     {
-        if (EHttpResponseCodes::IsOk(HttpResponse->GetResponseCode()))
+        bIsCancelled = true;
+        PlayFabRequestHandler::CancelCall(*this);
+    }
+    virtual bool IsFinished() const override { return bIsFinished; }
+    virtual bool IsCancelled() const override { return bIsCancelled; }
+    virtual bool IsDelivered() const override { return bIsDelivered; }
+    virtual void DeferDelivery() override { bIsDeliveryDeferred = true; }
+    virtual void MarkDelivered() override { bIsDelivered = true; }
+};
+
+bool PlayFabRequestHandler::ProcessRequest(const TSharedRef<IHttpRequest>& HttpRequest, bool bIsIdempotent, EPlayFabRequestPriority Priority, const FPlayFabRequestHandle& Handle)
+{
+    // Intercept completion so that failed attempts can be retried without the caller seeing them
+    TSharedRef<FCallState, ESPMode::ThreadSafe> CallState = MakeShared<FCallState, ESPMode::ThreadSafe>();
+    CallState->OnComplete = HttpRequest->OnProcessRequestComplete();
+    CallState->bIsIdempotent = bIsIdempotent;
+    CallState->Priority = Priority;
+    CallState->RequestUrl = HttpRequest->GetURL();
+
+    // Counted from here on; the result handler ends the call, or whichever path makes sure it won't run
+    PlayFabCommon::FPlayFabCallCounters::BeginCall(CallState->RequestUrl);
+    if (Handle.IsValid())
+    {
+        // A call that can be cancelled on its own doesn't share its request with other callers
+        if (!Handle.Attach(CallState))
         {
-            // Create the Json parser
-            ResponseStr = HttpResponse->GetContentAsString();
-            TSharedPtr<FJsonObject> JsonObject;
-            TSharedRef<TJsonReader<> > JsonReader = TJsonReaderFactory<>::Create(ResponseStr);
+            CallState->bIsFinished = true;
+            PlayFabCommon::FPlayFabCallCounters::EndCall(CallState->RequestUrl);
+            return false;
+        }
 
-            if (FJsonSerializer::Deserialize(JsonReader, JsonObject) && JsonObject.IsValid())
+        const float Timeout = Handle.GetTimeout();
+        if (Timeout > 0.0f)
+        {
+            CallState->Deadline = FPlatformTime::Seconds() + Timeout;
+            // The timer doesn't keep the call alive, and does nothing if the call has finished by then
+            TWeakPtr<FCallState, ESPMode::ThreadSafe> WeakCallState = CallState;
+            PlayFabRequestHandler::AddTickerOnGameThread(FTickerDelegate::CreateLambda([WeakCallState](float)
             {
-                if (PlayFabRequestHandler::DecodeError(JsonObject, OutError))
+                if (TSharedPtr<FCallState, ESPMode::ThreadSafe> PinnedCallState = WeakCallState.Pin())
                 {
-                    return false;
+                    PlayFabRequestHandler::TimeOutCall(PinnedCallState.ToSharedRef());
                 }
+                return false;
+            }), Timeout);
+        }
+    }
+    else if (bIsIdempotent && FPlayFabRequestCoalescer::TryJoin(HttpRequest, CallState->OnComplete, CallState->CoalescingKey))
+    {
+        return true;
+    }
 
-                const TSharedPtr<FJsonObject>* DataJsonObject;
-                if (JsonObject->TryGetObjectField(TEXT("data"), DataJsonObject))
-                {
-                    return OutResult.readFromValue(*DataJsonObject);
-                }
+    if (!FPlayFabCircuitBreaker::TryAcquire(HttpRequest->GetURL(), CallState->CircuitProbeId))
+    {
+        // The caller hears about it on the next tick, as it would about any other failure
+        PlayFabRequestHandler::FinishCall(*CallState, false);
+        HttpRequest->SetHeader(CircuitOpenHeader, TEXT("1"));
+        FHttpRequestPtr Rejected = HttpRequest;
+        AsyncTask(ENamedThreads::GameThread, [CallState, Rejected]()
+        {
+            if (!CallState->CoalescingKey.IsEmpty())
+            {
+                FPlayFabRequestCoalescer::Complete(CallState->CoalescingKey, CallState->OnComplete, Rejected, nullptr, false);
+                return;
             }
+            PlayFabRequestHandler::DeliverToCaller(CallState, Rejected, nullptr, false);
+        });
+        return true;
+    }
+
+    FPlayFabConnectionWarmer::OnCallSent(FPlayFabConnectionWarmer::GetHost(HttpRequest->GetURL()));
+    HttpRequest->OnProcessRequestComplete().BindStatic(&PlayFabRequestHandler::OnAttemptComplete, CallState);
+    CallState->CurrentRequest = HttpRequest;
+    CallState->bIsAttemptSubmitted = true;
+    FPlayFabMetrics::OnAttemptSubmitted(HttpRequest);
+    PLAYFAB_TRACE_BEGIN(Wait, HttpRequest);
+    {
+        PLAYFAB_TRACE_SCOPE(Send, HttpRequest);
+        if (!FPlayFabRequestGovernor::Submit(HttpRequest, Priority))
+        {
+            PlayFabRequestHandler::AbandonCall(*CallState, HttpRequest);
+            return false;
         }
-        else
+    }
+
+    // Only read calls can safely reach the server twice
+    float HedgeDelay = 0.0f;
+    if (bIsIdempotent && !CallState->bIsFinished && GetHedgeDelay(GetUrlPath(HttpRequest->GetURL()), HedgeDelay))
+    {
+        // Like the deadline timer, it doesn't keep the call alive, and SendHedge does nothing once the call has finished
+        TWeakPtr<FCallState, ESPMode::ThreadSafe> WeakCallState = CallState;
+        PlayFabRequestHandler::AddTickerOnGameThread(FTickerDelegate::CreateLambda([WeakCallState](float)
+        {
+            if (TSharedPtr<FCallState, ESPMode::ThreadSafe> PinnedCallState = WeakCallState.Pin())
+            {
+                PlayFabRequestHandler::SendHedge(PinnedCallState.ToSharedRef());
+            }
+            return false;
+        }), HedgeDelay);
+    }
+    return true;
+}
+
+void PlayFabRequestHandler::SendHedge(const TSharedRef<FCallState, ESPMode::ThreadSafe>& CallState)
+{
+    // Nothing to hedge once the first attempt has failed and is being retried, or while it is still queued by the governor
+    const FHttpRequestPtr& FirstAttempt = CallState->CurrentRequest;
+    if (CallState->bIsFinished || !CallState->bIsAttemptSubmitted || CallState->RetryAttempt > 0
+        || !FirstAttempt.IsValid() || FirstAttempt->GetStatus() != EHttpRequestStatus::Processing)
+    {
+        return;
+    }
+
+    // A duplicate counts against the circuit like any other call; while it is half-open, the first attempt is the only probe
+    uint64 ProbeId = 0;
+    if (!FPlayFabCircuitBreaker::TryAcquire(FirstAttempt->GetURL(), ProbeId))
+    {
+        return;
+    }
+
+    UE_LOG(LogPlayFabCpp, Verbose, TEXT("Hedging %s after %.2f seconds"), *FirstAttempt->GetURL(), FirstAttempt->GetElapsedTime());
+    TSharedRef<IHttpRequest> Hedge = PlayFabRequestHandler::CopyRequest(FirstAttempt);
+    Hedge->OnProcessRequestComplete().BindStatic(&PlayFabRequestHandler::OnAttemptComplete, CallState);
+    CallState->HedgeRequest = Hedge;
+    CallState->HedgeCircuitProbeId = ProbeId;
+    FPlayFabLatencyTracker::OnHedgeSent();
+    FPlayFabMetrics::OnAttemptSubmitted(Hedge);
+    PLAYFAB_TRACE_BEGIN(Wait, Hedge);
+    PLAYFAB_TRACE_SCOPE(Send, Hedge);
+    if (!FPlayFabRequestGovernor::Submit(Hedge, CallState->Priority) && CallState->HedgeRequest == Hedge)
+    {
+        // The first attempt carries on alone; a completion the engine reports for the hedge later is ignored
+        CallState->HedgeRequest.Reset();
+        FPlayFabMetrics::OnAttemptDropped(Hedge);
+        PLAYFAB_TRACE_END(Wait, Hedge);
+    }
+}
+
+void PlayFabRequestHandler::OnAttemptComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, TSharedRef<FCallState, ESPMode::ThreadSafe> CallState)
+{
+    FPlayFabMetrics::OnAttemptComplete(HttpRequest, HttpResponse, bSucceeded);
+    PLAYFAB_TRACE_END(Wait, HttpRequest);
+    // Every answer is a latency sample, including those of attempts that lost to another or whose call has finished
+    const bool HasResponse = bSucceeded && HttpResponse.IsValid();
+    if (HasResponse)
+    {
+        FPlayFabLatencyTracker::AddSample(GetUrlPath(HttpRequest->GetURL()), HttpRequest->GetElapsedTime());
+    }
+
+    // Cancelled or timed out, or an attempt that has already been dealt with, such as one the governor failed to start
+    // The response is dropped unread, only the endpoint's slot is given back
+    if (CallState->bIsFinished || (HttpRequest != CallState->CurrentRequest && HttpRequest != CallState->HedgeRequest))
+    {
+        if (HttpRequest.IsValid())
+        {
+            FPlayFabRequestGovernor::OnRequestComplete(HttpRequest, false);
+        }
+        return;
+    }
+    CallState->bIsAttemptSubmitted = false;
+
+    if (HasResponse)
+    {
+        FPlayFabConnectionWarmer::OnActivity(FPlayFabConnectionWarmer::GetHost(HttpRequest->GetURL()));
+        if (PlayFabCommon::FPlayFabRequestLog::ShouldLog(HttpRequest))
+        {
+            TArray<uint8> Uncompressed;
+            PlayFabCommon::FPlayFabRequestLog::LogResponse(HttpRequest, HttpResponse->GetResponseCode(), FPlayFabCompression::GetResponseBody(HttpResponse, Uncompressed));
+        }
+    }
+    const bool Failed = !(HasResponse && EHttpResponseCodes::IsOk(HttpResponse->GetResponseCode()));
+
+    FPlayFabCppError Error;
+    Error.ErrorCode = 0;
+    Error.HttpCode = 408;
+    float RetryAfterSeconds = 0.0f;
+    if (Failed && HasResponse)
+    {
+        Error.HttpCode = HttpResponse->GetResponseCode();
+        bool Decoded = false;
+        TArray<uint8> Uncompressed;
+        PlayFabRequestHandler::DecodeResponse(FPlayFabCompression::GetResponseBody(HttpResponse, Uncompressed), nullptr, Error, Decoded);
+
+        const FString RetryAfterHeader = HttpResponse->GetHeader(TEXT("Retry-After"));
+        RetryAfterSeconds = RetryAfterHeader.IsNumeric() ? FCString::Atof(*RetryAfterHeader) : (float)Error.RetryAfterSeconds;
+    }
+    else if (Failed)
+    {
+        Error.ErrorCode = PlayFabErrorConnectionTimeout;
+    }
+
+    // Only the attempt that was let through as the probe reports as one; retries of it aren't probes
+    const bool IsHedgeAttempt = CallState->HedgeRequest.IsValid() && HttpRequest == CallState->HedgeRequest;
+    const uint64 ProbeId = IsHedgeAttempt ? CallState->HedgeCircuitProbeId : CallState->CircuitProbeId;
+    if (IsHedgeAttempt)
+    {
+        CallState->HedgeCircuitProbeId = 0;
+    }
+    else
+    {
+        CallState->CircuitProbeId = 0;
+    }
+
+    // Throttling isn't held against the circuit, the governor deals with it
+    const bool CountsAgainstCircuit = Failed && FPlayFabRetryPolicy::IsTransientError(Error) && Error.HttpCode != 429;
+
+    // With a hedge in flight, the first successful attempt wins; a failed one leaves the call to the other attempt
+    // The failed attempt was let through by the circuit breaker like any other, so its outcome is reported all the same
+    FHttpRequestPtr OtherAttempt;
+    if (CallState->HedgeRequest.IsValid())
+    {
+        OtherAttempt = IsHedgeAttempt ? CallState->CurrentRequest : CallState->HedgeRequest;
+        CallState->HedgeRequest.Reset();
+        if (Failed)
         {
-            // Create the Json parser
-            ResponseStr = HttpResponse->GetContentAsString();
-            TSharedPtr<FJsonObject> JsonObject;
-            TSharedRef<TJsonReader<> > JsonReader = TJsonReaderFactory<>::Create(ResponseStr);
+            CallState->CurrentRequest = OtherAttempt;
+            CallState->bIsAttemptSubmitted = true;
+            FPlayFabRequestGovernor::OnRequestComplete(HttpRequest, FPlayFabRetryPolicy::IsThrottlingError(Error));
+            FPlayFabCircuitBreaker::OnResult(HttpRequest->GetURL(), CountsAgainstCircuit, ProbeId);
+            return;
+        }
 
-            if (FJsonSerializer::Deserialize(JsonReader, JsonObject) && JsonObject.IsValid())
+        CallState->CurrentRequest = HttpRequest;
+        if (IsHedgeAttempt)
+        {
+            FPlayFabLatencyTracker::OnHedgeWon();
+        }
+    }
+
+    if (HttpRequest.IsValid())
+    {
+        FPlayFabRequestGovernor::OnRequestComplete(HttpRequest, Failed && FPlayFabRetryPolicy::IsThrottlingError(Error));
+        FPlayFabCircuitBreaker::OnResult(HttpRequest->GetURL(), CountsAgainstCircuit, ProbeId);
+
+        // Retries would only be turned away while the circuit is open
+        if (Failed && FPlayFabCircuitBreaker::GetState(GetApiName(HttpRequest->GetURL())) == EPlayFabCircuitState::Closed)
+        {
+            // Retry budgets are kept per title, which is identified by the host the call goes to
+            const float Delay = FPlayFabRetryPolicy::GetRetryDelay(Error, CallState->bIsIdempotent, CallState->RetryAttempt + 1, RetryAfterSeconds, FPlayFabConnectionWarmer::GetHost(HttpRequest->GetURL()));
+            // A retry that can't complete before the deadline would only postpone the timeout error
+            const bool BeforeDeadline = CallState->Deadline == 0.0 || FPlatformTime::Seconds() + Delay < CallState->Deadline;
+            if (Delay >= 0.0f && BeforeDeadline)
             {
-                if (PlayFabRequestHandler::DecodeError(JsonObject, OutError))
-                {
-                    return false;
-                }
+                CallState->RetryAttempt += 1;
+                PlayFabRequestHandler::ScheduleRetry(HttpRequest, Delay, CallState);
+                return;
             }
         }
     }
 
+    PlayFabRequestHandler::FinishCall(*CallState, false);
+    if (OtherAttempt.IsValid())
+    {
+        // Its completion finds the call finished, and only frees its governor slot
+        PlayFabRequestHandler::StopAttempt(OtherAttempt);
+    }
+    if (!CallState->CoalescingKey.IsEmpty())
+    {
+        FPlayFabRequestCoalescer::Complete(CallState->CoalescingKey, CallState->OnComplete, HttpRequest, HttpResponse, bSucceeded);
+        return;
+    }
+    PlayFabRequestHandler::DeliverToCaller(CallState, HttpRequest, HttpResponse, bSucceeded);
+}
+
+void PlayFabRequestHandler::ScheduleRetry(FHttpRequestPtr FailedRequest, float Delay, TSharedRef<FCallState, ESPMode::ThreadSafe> CallState)
+{
+    UE_LOG(LogPlayFabCpp, Log, TEXT("Retrying %s in %.2f seconds (retry %d)"), *FailedRequest->GetURL(), Delay, CallState->RetryAttempt);
+
+    // A completed request can't be sent again, so the retry is a copy of it
+    TSharedRef<IHttpRequest> RetryRequest = PlayFabRequestHandler::CopyRequest(FailedRequest);
+    RetryRequest->OnProcessRequestComplete().BindStatic(&PlayFabRequestHandler::OnAttemptComplete, CallState);
+    CallState->CurrentRequest = RetryRequest;
+
+    // Retries go through the governor too, so that they respect the endpoint's lowered rate
+    PlayFabRequestHandler::AddTickerOnGameThread(FTickerDelegate::CreateLambda([RetryRequest, CallState](float)
+    {
+        if (!CallState->bIsFinished)
+        {
+            CallState->bIsAttemptSubmitted = true;
+            FPlayFabMetrics::OnAttemptSubmitted(RetryRequest);
+            PLAYFAB_TRACE_BEGIN(Wait, RetryRequest);
+            PLAYFAB_TRACE_SCOPE(Send, RetryRequest);
+            if (!FPlayFabRequestGovernor::Submit(RetryRequest, CallState->Priority))
+            {
+                // Handled like any other failed attempt, so the caller still hears back
+                PlayFabRequestHandler::OnAttemptComplete(RetryRequest, nullptr, false, CallState);
+            }
+        }
+        return false;
+    }), Delay);
+}
+
+void PlayFabRequestHandler::AddTickerOnGameThread(FTickerDelegate&& Delegate, float Delay)
+{
+    // The core ticker isn't thread safe, and completions may run on the HTTP thread
+    if (IsInGameThread())
+    {
+        FTicker::GetCoreTicker().AddTicker(MoveTemp(Delegate), Delay);
+        return;
+    }
+    AsyncTask(ENamedThreads::GameThread, [Delegate, Delay]()
+    {
+        FTicker::GetCoreTicker().AddTicker(Delegate, Delay);
+    });
+}
+
+TSharedRef<IHttpRequest> PlayFabRequestHandler::CopyRequest(const FHttpRequestPtr& Original)
+{
+    TSharedRef<IHttpRequest> Copy = FHttpModule::Get().CreateRequest();
+    Copy->SetVerb(Original->GetVerb());
+    Copy->SetURL(Original->GetURL());
+    for (const FString& Header : Original->GetAllHeaders())
+    {
+        FString Key, Value;
+        if (Header.Split(TEXT(": "), &Key, &Value))
+        {
+            Copy->SetHeader(Key, Value);
+        }
+    }
+    Copy->SetContent(Original->GetContent());
+    return Copy;
+}
+
+void PlayFabRequestHandler::StopAttempt(const FHttpRequestPtr& Attempt)
+{
+    // A queued attempt is simply dropped; one on the wire is cancelled, and its completion only frees its governor slot
+    if (FPlayFabRequestGovernor::Withdraw(Attempt))
+    {
+        FPlayFabMetrics::OnAttemptDropped(Attempt);
+        PLAYFAB_TRACE_END(Wait, Attempt);
+    }
+    else
+    {
+        Attempt->CancelRequest();
+    }
+}
+
+bool PlayFabRequestHandler::FinishCall(FCallState& CallState, bool bStopAttempt)
+{
+    if (CallState.bIsFinished.AtomicSet(true))
+    {
+        return false;
+    }
+
+    // The attempts' completion delegates hold the call state, so the state must let go of the attempts
+    FHttpRequestPtr Attempt = MoveTemp(CallState.CurrentRequest);
+    FHttpRequestPtr Hedge = MoveTemp(CallState.HedgeRequest);
+
+    if (bStopAttempt && CallState.bIsAttemptSubmitted && Attempt.IsValid())
+    {
+        PlayFabRequestHandler::StopAttempt(Attempt);
+    }
+    if (bStopAttempt && Hedge.IsValid())
+    {
+        PlayFabRequestHandler::StopAttempt(Hedge);
+    }
+    return true;
+}
+
+void PlayFabRequestHandler::AbandonCall(FCallState& CallState, const FHttpRequestPtr& HttpRequest)
+{
+    // The caller learns from ProcessRequest's return value; a completion the engine reports later finds the call finished
+    if (!PlayFabRequestHandler::FinishCall(CallState, false))
+    {
+        return;
+    }
+
+    CallState.bIsDelivered = true;
+    FPlayFabRequestGovernor::OnRequestComplete(HttpRequest, false);
+    if (!CallState.CoalescingKey.IsEmpty())
+    {
+        FPlayFabRequestCoalescer::Abandon(CallState.CoalescingKey, HttpRequest);
+    }
+    PlayFabCommon::FPlayFabCallCounters::EndCall(CallState.RequestUrl);
+}
+
+void PlayFabRequestHandler::CancelCall(FCallState& CallState)
+{
+    if (PlayFabRequestHandler::FinishCall(CallState, true))
+    {
+        // The result handler, which would have ended the call, won't run
+        PlayFabCommon::FPlayFabCallCounters::EndCall(CallState.RequestUrl);
+    }
+}
+
+void PlayFabRequestHandler::TimeOutCall(const TSharedRef<FCallState, ESPMode::ThreadSafe>& CallState)
+{
+    FHttpRequestPtr Attempt = CallState->CurrentRequest;
+    if (PlayFabRequestHandler::FinishCall(*CallState, true))
+    {
+        UE_LOG(LogPlayFabCpp, Warning, TEXT("%s reached the deadline of its request handle"), Attempt.IsValid() ? *Attempt->GetURL() : TEXT("A call"));
+        // Without a response, the result handler reports a timeout error
+        PlayFabRequestHandler::DeliverToCaller(CallState, Attempt, nullptr, false);
+    }
+}
+
+void PlayFabRequestHandler::DeliverToCaller(const FHttpRequestCompleteDelegate& OnComplete, FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded)
+{
+    // The result handler ends the call once it has decoded the response; one bound to a destroyed instance never runs
+    if (!OnComplete.ExecuteIfBound(HttpRequest, HttpResponse, bSucceeded) && HttpRequest.IsValid())
+    {
+        PlayFabCommon::FPlayFabCallCounters::EndCall(HttpRequest->GetURL());
+    }
+}
+
+void PlayFabRequestHandler::DeliverToCaller(const TSharedRef<FCallState, ESPMode::ThreadSafe>& CallState, FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded)
+{
+    // The call may have been cancelled on another thread after it finished
+    if (CallState->bIsCancelled)
+    {
+        CallState->bIsDelivered = true;
+        PlayFabCommon::FPlayFabCallCounters::EndCall(CallState->RequestUrl);
+        return;
+    }
+    {
+        const TSharedPtr<IPlayFabCancellable, ESPMode::ThreadSafe> Call = CallState;
+        TGuardValue<const TSharedPtr<IPlayFabCancellable, ESPMode::ThreadSafe>*> Guard(DeliveringCall, &Call);
+        PlayFabRequestHandler::DeliverToCaller(CallState->OnComplete, HttpRequest, HttpResponse, bSucceeded);
+    }
+    // A deferred result is delivered once its delegates run
+    if (!CallState->bIsDeliveryDeferred)
+    {
+        CallState->bIsDelivered = true;
+    }
+}
+
+TSharedPtr<IPlayFabCancellable, ESPMode::ThreadSafe> PlayFabRequestHandler::GetDeliveringCall()
+{
+    return DeliveringCall != nullptr ? *DeliveringCall : nullptr;
+}
+
+bool PlayFabRequestHandler::DecodeRequest(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, PlayFab::FPlayFabCppBaseModel& OutResult, PlayFab::FPlayFabCppError& OutError)
+{
+    if (HttpRequest.IsValid())
+    {
+        PlayFabCommon::FPlayFabCallCounters::EndCall(HttpRequest->GetURL());
+    }
+
+    bool Decoded = false;
+    if (bSucceeded && HttpResponse.IsValid() && PlayFabRequestHandler::DecodeBody(HttpResponse->GetResponseCode(), HttpResponse->GetContent(), HttpResponse->GetHeader(TEXT("Content-Encoding")), OutResult, OutError, Decoded))
+    {
+        return Decoded;
+    }
+
+    PlayFabRequestHandler::SetNoResponseError(OutError, WasFailedFast(HttpRequest));
+    return false;
+}
+
+bool PlayFabRequestHandler::DecodeBody(int32 ResponseCode, const TArray<uint8>& Content, const FString& ContentEncoding, PlayFab::FPlayFabCppBaseModel& OutResult, PlayFab::FPlayFabCppError& OutError, bool& OutDecoded)
+{
+    // Only successful responses carry a result, anything else can at best be decoded as an error
+    PlayFab::FPlayFabCppBaseModel* Result = EHttpResponseCodes::IsOk(ResponseCode) ? &OutResult : nullptr;
+    TArray<uint8> Uncompressed;
+    const TArray<uint8>& ResponseContent = FPlayFabCompression::GetResponseBody(Content, ContentEncoding, Uncompressed);
+    FPlayFabCompression::CountResponse(Content.Num(), ResponseContent.Num());
+    return PlayFabRequestHandler::DecodeResponse(ResponseContent, Result, OutError, OutDecoded);
+}
+
+void PlayFabRequestHandler::SetNoResponseError(PlayFab::FPlayFabCppError& OutError, bool bCircuitOpen)
+{
+    if (bCircuitOpen)
+    {
+        OutError.HttpCode = 503;
+        OutError.ErrorCode = PlayFabErrorCircuitOpen;
+        OutError.ErrorName = OutError.HttpStatus = TEXT("CircuitOpen");
+        OutError.ErrorMessage = TEXT("Not sent, because recent calls to this API have been failing");
+        return;
+    }
+
     // If we get here, we failed to connect meaningfully to the server - Assume a timeout
     OutError.HttpCode = 408;
     OutError.ErrorCode = PlayFabErrorConnectionTimeout;
     // For text returns, use the non-json response if possible, else default to no response
     OutError.ErrorName = OutError.ErrorMessage = OutError.HttpStatus = TEXT("Request Timeout or null response");
+}
+
+struct PlayFabRequestHandler::FResponseSnapshot
+{
+    bool bHasResponse = false;
+    bool bWasFailedFast = false;
+    int32 ResponseCode = 0;
+    FString ContentEncoding;
+    TArray<uint8> Content;
+};
+
+void PlayFabRequestHandler::SetResponseDispatcher(FResponseDispatcher Dispatcher)
+{
+    FScopeLock Lock(&DispatcherLock);
+    ResponseDispatcher = MoveTemp(Dispatcher);
+}
+
+bool PlayFabRequestHandler::IsDecodingInBackground()
+{
+    return GetDefault<UPlayFabRuntimeSettings>()->bDecodeResponsesInBackground && FPlatformProcess::SupportsMultithreading();
+}
+
+TSharedRef<PlayFabRequestHandler::FResponseSnapshot, ESPMode::ThreadSafe> PlayFabRequestHandler::TakeSnapshot(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded)
+{
+    if (HttpRequest.IsValid())
+    {
+        PlayFabCommon::FPlayFabCallCounters::EndCall(HttpRequest->GetURL());
+    }
+
+    // The engine's HTTP objects aren't safe to share with another thread, so the body is copied; that is cheap next to parsing it
+    TSharedRef<FResponseSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FResponseSnapshot, ESPMode::ThreadSafe>();
+    if (bSucceeded && HttpResponse.IsValid())
+    {
+        Snapshot->bHasResponse = true;
+        Snapshot->ResponseCode = HttpResponse->GetResponseCode();
+        Snapshot->ContentEncoding = HttpResponse->GetHeader(TEXT("Content-Encoding"));
+        Snapshot->Content = HttpResponse->GetContent();
+    }
+    Snapshot->bWasFailedFast = WasFailedFast(HttpRequest);
+    return Snapshot;
+}
+
+bool PlayFabRequestHandler::DecodeSnapshot(const FResponseSnapshot& Snapshot, PlayFab::FPlayFabCppBaseModel& OutResult, PlayFab::FPlayFabCppError& OutError)
+{
+    bool Decoded = false;
+    if (Snapshot.bHasResponse && PlayFabRequestHandler::DecodeBody(Snapshot.ResponseCode, Snapshot.Content, Snapshot.ContentEncoding, OutResult, OutError, Decoded))
+    {
+        return Decoded;
+    }
 
+    PlayFabRequestHandler::SetNoResponseError(OutError, Snapshot.bWasFailedFast);
     return false;
 }
 
+void PlayFabRequestHandler::DecodeInBackground(TFunction<void()>&& Work)
+{
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, MoveTemp(Work));
+}
+
+void PlayFabRequestHandler::DispatchResult(TFunction<void()>&& Deliver, bool bRequiresGameThread)
+{
+    if (bRequiresGameThread)
+    {
+        PlayFabRequestHandler::DispatchToGameThread(MoveTemp(Deliver));
+        return;
+    }
+
+    FResponseDispatcher Dispatcher;
+    {
+        FScopeLock Lock(&DispatcherLock);
+        Dispatcher = ResponseDispatcher;
+    }
+
+    if (Dispatcher)
+    {
+        Dispatcher(MoveTemp(Deliver));
+    }
+    else if (GetDefault<UPlayFabRuntimeSettings>()->ResponseDispatch == EPlayFabResponseDispatch::AnyThread)
+    {
+        Deliver();
+    }
+    else
+    {
+        PlayFabRequestHandler::DispatchToGameThread(MoveTemp(Deliver));
+    }
+}
+
+void PlayFabRequestHandler::DispatchToGameThread(TFunction<void()>&& Deliver)
+{
+    if (FPlayFabCompletionQueue::IsEnabled())
+    {
+        FPlayFabCompletionQueue::Enqueue(MoveTemp(Deliver));
+    }
+    else if (IsInGameThread())
+    {
+        Deliver();
+    }
+    else
+    {
+        AsyncTask(ENamedThreads::GameThread, MoveTemp(Deliver));
+    }
+}
+
+bool PlayFabRequestHandler::DecodeResponse(const TArray<uint8>& ResponseContent, PlayFab::FPlayFabCppBaseModel* OutResult, PlayFab::FPlayFabCppError& OutError, bool& OutDecoded)
+{
+    // The body is parsed in place from its UTF-8 bytes, without widening it to an FString first
+    FPlayFabJsonPullReader Reader(ResponseContent);
+    if (!Reader.ReadObjectStart())
+    {
+        return false;
+    }
+
+    bool HasData = false;
+    bool HasError = false;
+    while (Reader.NextField())
+    {
+        if (Reader.IsField("errorCode"))
+        {
+            HasError = true;
+            Reader.ReadValue(OutError.ErrorCode);
+        }
+        else if (Reader.IsField("code"))
+        {
+            Reader.ReadValue(OutError.HttpCode);
+        }
+        else if (Reader.IsField("status"))
+        {
+            Reader.ReadValue(OutError.HttpStatus);
+        }
+        else if (Reader.IsField("error"))
+        {
+            Reader.ReadValue(OutError.ErrorName);
+        }
+        else if (Reader.IsField("errorMessage"))
+        {
+            Reader.ReadValue(OutError.ErrorMessage);
+        }
+        else if (Reader.IsField("retryAfterSeconds"))
+        {
+            Reader.ReadValue(OutError.RetryAfterSeconds);
+        }
+        else if (Reader.IsField("errorDetails"))
+        {
+            PlayFabRequestHandler::DecodeErrorDetails(Reader, OutError);
+        }
+        else if (OutResult != nullptr && !HasData && Reader.IsField("data") && Reader.PeekObjectStart())
+        {
+            HasData = true;
+            OutDecoded = OutResult->readFromReader(Reader);
+        }
+        else
+        {
+            Reader.SkipValue();
+        }
+    }
+
+    if (!Reader.IsValid())
+    {
+        OutError.ErrorDetails.Empty();
+        return false;
+    }
+
+    if (HasError)
+    {
+        // TODO: handle global error delegate here
+        OutDecoded = false;
+        return true;
+    }
+
+    return HasData;
+}
+
+void PlayFabRequestHandler::DecodeErrorDetails(FPlayFabJsonPullReader& Reader, PlayFab::FPlayFabCppError& OutError)
+{
+    if (!Reader.ReadObjectStart())
+    {
+        return;
+    }
+
+    while (Reader.NextField())
+    {
+        const FString Key = Reader.GetFieldName();
+        FString Detail;
+        if (!Reader.PeekArrayStart())
+        {
+            if (Reader.ReadValue(Detail))
+            {
+                OutError.ErrorDetails.Add(Key, Detail);
+            }
+            continue;
+        }
+
+        Reader.ReadArrayStart();
+        while (Reader.NextArrayItem())
+        {
+            if (Reader.ReadValue(Detail))
+            {
+                OutError.ErrorDetails.Add(Key, Detail);
+            }
+        }
+    }
+}
+
 bool PlayFabRequestHandler::DecodeError(TSharedPtr<FJsonObject> JsonObject, PlayFab::FPlayFabCppError& OutError)
 {
     // check if returned json indicates an error
@@ -107,6 +891,7 @@ bool PlayFabRequestHandler::DecodeError(TSharedPtr<FJsonObject> JsonObject, Play
         JsonObject->TryGetStringField(TEXT("status"), OutError.HttpStatus);
         JsonObject->TryGetStringField(TEXT("error"), OutError.ErrorName);
         JsonObject->TryGetStringField(TEXT("errorMessage"), OutError.ErrorMessage);
+        JsonObject->TryGetNumberField(TEXT("retryAfterSeconds"), OutError.RetryAfterSeconds);
 
         const TSharedPtr<FJsonObject>* obj;
         if (JsonObject->TryGetObjectField(TEXT("errorDetails"), obj))
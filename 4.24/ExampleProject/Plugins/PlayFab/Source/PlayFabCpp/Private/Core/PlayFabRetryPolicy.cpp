@@ -0,0 +1,101 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabRetryPolicy.h"
+#include "PlayFabRuntimeSettings.h"
+#include "Misc/ScopeLock.h"
+
+using namespace PlayFab;
+
+namespace
+{
+    // Token bucket holding the retries a title may still spend
+    struct FRetryBudget
+    {
+        double Tokens = 0.0;
+        double LastRefillTime = 0.0;
+    };
+
+    FCriticalSection RetryBudgetLock;
+    TMap<FString, FRetryBudget> RetryBudgets;
+}
+
+bool FPlayFabRetryPolicy::IsThrottlingError(const FPlayFabCppError& Error)
+{
+    switch (Error.ErrorCode)
+    {
+    case PlayFabErrorAPIRequestLimitExceeded:
+    case PlayFabErrorAPIClientRequestRateLimitExceeded:
+    case PlayFabErrorAPIConcurrentRequestLimitExceeded:
+    case PlayFabErrorServiceUnavailable:
+    case PlayFabErrorDownstreamServiceUnavailable:
+        return true;
+    default:
+        return Error.HttpCode == 429 || Error.HttpCode == 503;
+    }
+}
+
+bool FPlayFabRetryPolicy::IsTransientError(const FPlayFabCppError& Error)
+{
+    return Error.ErrorCode == PlayFabErrorConnectionTimeout || Error.HttpCode == 408 || Error.HttpCode >= 500;
+}
+
+float FPlayFabRetryPolicy::GetRetryDelay(const FPlayFabCppError& Error, bool bIsIdempotent, int32 RetryAttempt, float RetryAfterSeconds, const FString& TitleKey)
+{
+    const UPlayFabRuntimeSettings* Settings = GetDefault<UPlayFabRuntimeSettings>();
+    if (!Settings->bEnableAutomaticRetries || !bIsIdempotent || RetryAttempt > Settings->MaxRetryAttempts)
+    {
+        return -1.0f;
+    }
+    if (!IsThrottlingError(Error) && !IsTransientError(Error))
+    {
+        return -1.0f;
+    }
+
+    // Full jitter: a random point below the exponential backoff, so that clients which failed together don't retry together
+    const float Backoff = FMath::Min(Settings->RetryMaxDelaySeconds, Settings->RetryBaseDelaySeconds * FMath::Pow(2.0f, (float)(RetryAttempt - 1)));
+    float Delay = FMath::FRandRange(0.0f, Backoff);
+
+    // The service knows best how long it needs; wait at least that long, and give up if it's longer than we're willing to wait
+    if (RetryAfterSeconds > 0.0f)
+    {
+        if (RetryAfterSeconds > Settings->RetryMaxDelaySeconds)
+        {
+            return -1.0f;
+        }
+        Delay = FMath::Min(RetryAfterSeconds + Delay, Settings->RetryMaxDelaySeconds);
+    }
+
+    return ConsumeRetryBudget(TitleKey, Settings->RetryBudgetPerMinute) ? Delay : -1.0f;
+}
+
+bool FPlayFabRetryPolicy::ConsumeRetryBudget(const FString& TitleKey, int32 BudgetPerMinute)
+{
+    if (BudgetPerMinute <= 0)
+    {
+        return false;
+    }
+
+    FScopeLock Lock(&RetryBudgetLock);
+    const double Now = FPlatformTime::Seconds();
+    FRetryBudget* Budget = RetryBudgets.Find(TitleKey);
+    if (Budget == nullptr)
+    {
+        Budget = &RetryBudgets.Add(TitleKey);
+        Budget->Tokens = BudgetPerMinute;
+    }
+    else
+    {
+        Budget->Tokens = FMath::Min<double>(BudgetPerMinute, Budget->Tokens + (Now - Budget->LastRefillTime) * BudgetPerMinute / 60.0);
+    }
+    Budget->LastRefillTime = Now;
+
+    if (Budget->Tokens < 1.0)
+    {
+        return false;
+    }
+    Budget->Tokens -= 1.0;
+    return true;
+}
@@ -7,6 +7,9 @@
 
 #include "PlayFabSettings.h"
 #include "PlayFabCommon.h"
+#include "Core/PlayFabCompletionQueue.h"
+#include "Core/PlayFabResultHandler.h"
+#include "PlayFabRuntimeSettings.h"
 
 // Api's
 #include "Core/PlayFabAdminAPI.h"
@@ -87,11 +90,21 @@ void FPlayFabModule::StartupModule()
         LocalizationAPI = MakeShareable(new PlayFab::UPlayFabLocalizationAPI());
         MultiplayerAPI = MakeShareable(new PlayFab::UPlayFabMultiplayerAPI());
         ProfilesAPI = MakeShareable(new PlayFab::UPlayFabProfilesAPI());
+
+    PlayFab::FPlayFabCompletionQueue::Startup();
+
+    // Title ids assigned at runtime are set too late for this; call PlayFabRequestHandler::Prewarm once they are
+    // The editor and commandlets make no calls at startup, so they would only open connections for nothing
+    if (GetDefault<UPlayFabRuntimeSettings>()->bPrewarmConnections && !GIsEditor && !IsRunningCommandlet())
+    {
+        PlayFab::PlayFabRequestHandler::Prewarm();
+    }
 }
 
 void FPlayFabModule::ShutdownModule()
 {
-    
+    PlayFab::FPlayFabConnectionWarmer::Shutdown();
+    PlayFab::FPlayFabCompletionQueue::Shutdown();
 }
 
 IMPLEMENT_MODULE(FPlayFabModule, PlayFabCpp)
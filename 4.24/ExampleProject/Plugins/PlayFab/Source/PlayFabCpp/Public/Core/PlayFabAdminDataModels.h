@@ -33,6 +33,15 @@ namespace AdminModels
             TaskInstanceId(src.TaskInstanceId)
             {}
 
+        FAbortTaskInstanceRequest(FAbortTaskInstanceRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            TaskInstanceId(MoveTemp(src.TaskInstanceId))
+            {}
+
+        FAbortTaskInstanceRequest& operator=(const FAbortTaskInstanceRequest& src) = default;
+        FAbortTaskInstanceRequest& operator=(FAbortTaskInstanceRequest&& src) = default;
+
         FAbortTaskInstanceRequest(const TSharedPtr<FJsonObject>& obj) : FAbortTaskInstanceRequest()
         {
             readFromValue(obj);
@@ -41,7 +50,13 @@ namespace AdminModels
         ~FAbortTaskInstanceRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FActionsOnPlayersInSegmentTaskParameter : public PlayFab::FPlayFabCppBaseModel
@@ -64,6 +79,15 @@ namespace AdminModels
             SegmentId(src.SegmentId)
             {}
 
+        FActionsOnPlayersInSegmentTaskParameter(FActionsOnPlayersInSegmentTaskParameter&& src) :
+            FPlayFabCppBaseModel(),
+            ActionId(MoveTemp(src.ActionId)),
+            SegmentId(MoveTemp(src.SegmentId))
+            {}
+
+        FActionsOnPlayersInSegmentTaskParameter& operator=(const FActionsOnPlayersInSegmentTaskParameter& src) = default;
+        FActionsOnPlayersInSegmentTaskParameter& operator=(FActionsOnPlayersInSegmentTaskParameter&& src) = default;
+
         FActionsOnPlayersInSegmentTaskParameter(const TSharedPtr<FJsonObject>& obj) : FActionsOnPlayersInSegmentTaskParameter()
         {
             readFromValue(obj);
@@ -72,7 +96,13 @@ namespace AdminModels
         ~FActionsOnPlayersInSegmentTaskParameter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum TaskInstanceStatus
@@ -86,6 +116,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeTaskInstanceStatusEnumJSON(TaskInstanceStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeTaskInstanceStatusEnumJSON(TaskInstanceStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API TaskInstanceStatus readTaskInstanceStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API TaskInstanceStatus readTaskInstanceStatusFromValue(const FString& value);
 
@@ -109,6 +140,15 @@ namespace AdminModels
             Name(src.Name)
             {}
 
+        FNameIdentifier(FNameIdentifier&& src) :
+            FPlayFabCppBaseModel(),
+            Id(MoveTemp(src.Id)),
+            Name(MoveTemp(src.Name))
+            {}
+
+        FNameIdentifier& operator=(const FNameIdentifier& src) = default;
+        FNameIdentifier& operator=(FNameIdentifier&& src) = default;
+
         FNameIdentifier(const TSharedPtr<FJsonObject>& obj) : FNameIdentifier()
         {
             readFromValue(obj);
@@ -117,7 +157,13 @@ namespace AdminModels
         ~FNameIdentifier();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FActionsOnPlayersInSegmentTaskSummary : public PlayFab::FPlayFabCppBaseModel
@@ -184,12 +230,31 @@ namespace AdminModels
             ScheduledByUserId(src.ScheduledByUserId),
             StartedAt(src.StartedAt),
             Status(src.Status),
-            TaskIdentifier(src.TaskIdentifier.IsValid() ? MakeShareable(new FNameIdentifier(*src.TaskIdentifier)) : nullptr),
+            TaskIdentifier(src.TaskIdentifier.IsValid() ? TSharedPtr<FNameIdentifier>(MakeShared<FNameIdentifier>(*src.TaskIdentifier)) : nullptr),
             TaskInstanceId(src.TaskInstanceId),
             TotalPlayersInSegment(src.TotalPlayersInSegment),
             TotalPlayersProcessed(src.TotalPlayersProcessed)
             {}
 
+        FActionsOnPlayersInSegmentTaskSummary(FActionsOnPlayersInSegmentTaskSummary&& src) :
+            FPlayFabCppBaseModel(),
+            CompletedAt(MoveTemp(src.CompletedAt)),
+            ErrorMessage(MoveTemp(src.ErrorMessage)),
+            ErrorWasFatal(MoveTemp(src.ErrorWasFatal)),
+            EstimatedSecondsRemaining(MoveTemp(src.EstimatedSecondsRemaining)),
+            PercentComplete(MoveTemp(src.PercentComplete)),
+            ScheduledByUserId(MoveTemp(src.ScheduledByUserId)),
+            StartedAt(MoveTemp(src.StartedAt)),
+            Status(MoveTemp(src.Status)),
+            TaskIdentifier(MoveTemp(src.TaskIdentifier)),
+            TaskInstanceId(MoveTemp(src.TaskInstanceId)),
+            TotalPlayersInSegment(MoveTemp(src.TotalPlayersInSegment)),
+            TotalPlayersProcessed(MoveTemp(src.TotalPlayersProcessed))
+            {}
+
+        FActionsOnPlayersInSegmentTaskSummary& operator=(const FActionsOnPlayersInSegmentTaskSummary& src) = default;
+        FActionsOnPlayersInSegmentTaskSummary& operator=(FActionsOnPlayersInSegmentTaskSummary&& src) = default;
+
         FActionsOnPlayersInSegmentTaskSummary(const TSharedPtr<FJsonObject>& obj) : FActionsOnPlayersInSegmentTaskSummary()
         {
             readFromValue(obj);
@@ -198,7 +263,13 @@ namespace AdminModels
         ~FActionsOnPlayersInSegmentTaskSummary();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAdCampaignAttribution : public PlayFab::FPlayFabCppBaseModel
@@ -226,6 +297,16 @@ namespace AdminModels
             Platform(src.Platform)
             {}
 
+        FAdCampaignAttribution(FAdCampaignAttribution&& src) :
+            FPlayFabCppBaseModel(),
+            AttributedAt(MoveTemp(src.AttributedAt)),
+            CampaignId(MoveTemp(src.CampaignId)),
+            Platform(MoveTemp(src.Platform))
+            {}
+
+        FAdCampaignAttribution& operator=(const FAdCampaignAttribution& src) = default;
+        FAdCampaignAttribution& operator=(FAdCampaignAttribution&& src) = default;
+
         FAdCampaignAttribution(const TSharedPtr<FJsonObject>& obj) : FAdCampaignAttribution()
         {
             readFromValue(obj);
@@ -234,7 +315,13 @@ namespace AdminModels
         ~FAdCampaignAttribution();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAdCampaignAttributionModel : public PlayFab::FPlayFabCppBaseModel
@@ -262,6 +349,16 @@ namespace AdminModels
             Platform(src.Platform)
             {}
 
+        FAdCampaignAttributionModel(FAdCampaignAttributionModel&& src) :
+            FPlayFabCppBaseModel(),
+            AttributedAt(MoveTemp(src.AttributedAt)),
+            CampaignId(MoveTemp(src.CampaignId)),
+            Platform(MoveTemp(src.Platform))
+            {}
+
+        FAdCampaignAttributionModel& operator=(const FAdCampaignAttributionModel& src) = default;
+        FAdCampaignAttributionModel& operator=(FAdCampaignAttributionModel&& src) = default;
+
         FAdCampaignAttributionModel(const TSharedPtr<FJsonObject>& obj) : FAdCampaignAttributionModel()
         {
             readFromValue(obj);
@@ -270,7 +367,13 @@ namespace AdminModels
         ~FAdCampaignAttributionModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum SegmentFilterComparison
@@ -287,6 +390,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeSegmentFilterComparisonEnumJSON(SegmentFilterComparison enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeSegmentFilterComparisonEnumJSON(SegmentFilterComparison enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API SegmentFilterComparison readSegmentFilterComparisonFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API SegmentFilterComparison readSegmentFilterComparisonFromValue(const FString& value);
 
@@ -315,6 +419,16 @@ namespace AdminModels
             Comparison(src.Comparison)
             {}
 
+        FAdCampaignSegmentFilter(FAdCampaignSegmentFilter&& src) :
+            FPlayFabCppBaseModel(),
+            CampaignId(MoveTemp(src.CampaignId)),
+            CampaignSource(MoveTemp(src.CampaignSource)),
+            Comparison(MoveTemp(src.Comparison))
+            {}
+
+        FAdCampaignSegmentFilter& operator=(const FAdCampaignSegmentFilter& src) = default;
+        FAdCampaignSegmentFilter& operator=(FAdCampaignSegmentFilter&& src) = default;
+
         FAdCampaignSegmentFilter(const TSharedPtr<FJsonObject>& obj) : FAdCampaignSegmentFilter()
         {
             readFromValue(obj);
@@ -323,7 +437,13 @@ namespace AdminModels
         ~FAdCampaignSegmentFilter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddLocalizedNewsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -360,6 +480,18 @@ namespace AdminModels
             Title(src.Title)
             {}
 
+        FAddLocalizedNewsRequest(FAddLocalizedNewsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Body(MoveTemp(src.Body)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Language(MoveTemp(src.Language)),
+            NewsId(MoveTemp(src.NewsId)),
+            Title(MoveTemp(src.Title))
+            {}
+
+        FAddLocalizedNewsRequest& operator=(const FAddLocalizedNewsRequest& src) = default;
+        FAddLocalizedNewsRequest& operator=(FAddLocalizedNewsRequest&& src) = default;
+
         FAddLocalizedNewsRequest(const TSharedPtr<FJsonObject>& obj) : FAddLocalizedNewsRequest()
         {
             readFromValue(obj);
@@ -368,7 +500,13 @@ namespace AdminModels
         ~FAddLocalizedNewsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddLocalizedNewsResult : public PlayFab::FPlayFabCppResultCommon
@@ -381,6 +519,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FAddLocalizedNewsResult(FAddLocalizedNewsResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FAddLocalizedNewsResult& operator=(const FAddLocalizedNewsResult& src) = default;
+        FAddLocalizedNewsResult& operator=(FAddLocalizedNewsResult&& src) = default;
+
         FAddLocalizedNewsResult(const TSharedPtr<FJsonObject>& obj) : FAddLocalizedNewsResult()
         {
             readFromValue(obj);
@@ -389,7 +534,13 @@ namespace AdminModels
         ~FAddLocalizedNewsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddNewsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -421,6 +572,17 @@ namespace AdminModels
             Title(src.Title)
             {}
 
+        FAddNewsRequest(FAddNewsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Body(MoveTemp(src.Body)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Timestamp(MoveTemp(src.Timestamp)),
+            Title(MoveTemp(src.Title))
+            {}
+
+        FAddNewsRequest& operator=(const FAddNewsRequest& src) = default;
+        FAddNewsRequest& operator=(FAddNewsRequest&& src) = default;
+
         FAddNewsRequest(const TSharedPtr<FJsonObject>& obj) : FAddNewsRequest()
         {
             readFromValue(obj);
@@ -429,7 +591,13 @@ namespace AdminModels
         ~FAddNewsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddNewsResult : public PlayFab::FPlayFabCppResultCommon
@@ -447,6 +615,14 @@ namespace AdminModels
             NewsId(src.NewsId)
             {}
 
+        FAddNewsResult(FAddNewsResult&& src) :
+            FPlayFabCppResultCommon(),
+            NewsId(MoveTemp(src.NewsId))
+            {}
+
+        FAddNewsResult& operator=(const FAddNewsResult& src) = default;
+        FAddNewsResult& operator=(FAddNewsResult&& src) = default;
+
         FAddNewsResult(const TSharedPtr<FJsonObject>& obj) : FAddNewsResult()
         {
             readFromValue(obj);
@@ -455,7 +631,13 @@ namespace AdminModels
         ~FAddNewsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddPlayerTagRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -482,6 +664,16 @@ namespace AdminModels
             TagName(src.TagName)
             {}
 
+        FAddPlayerTagRequest(FAddPlayerTagRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            TagName(MoveTemp(src.TagName))
+            {}
+
+        FAddPlayerTagRequest& operator=(const FAddPlayerTagRequest& src) = default;
+        FAddPlayerTagRequest& operator=(FAddPlayerTagRequest&& src) = default;
+
         FAddPlayerTagRequest(const TSharedPtr<FJsonObject>& obj) : FAddPlayerTagRequest()
         {
             readFromValue(obj);
@@ -490,7 +682,13 @@ namespace AdminModels
         ~FAddPlayerTagRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddPlayerTagResult : public PlayFab::FPlayFabCppResultCommon
@@ -503,6 +701,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FAddPlayerTagResult(FAddPlayerTagResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FAddPlayerTagResult& operator=(const FAddPlayerTagResult& src) = default;
+        FAddPlayerTagResult& operator=(FAddPlayerTagResult&& src) = default;
+
         FAddPlayerTagResult(const TSharedPtr<FJsonObject>& obj) : FAddPlayerTagResult()
         {
             readFromValue(obj);
@@ -511,7 +716,13 @@ namespace AdminModels
         ~FAddPlayerTagResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum Region
@@ -526,6 +737,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeRegionEnumJSON(Region enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeRegionEnumJSON(Region enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API Region readRegionFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API Region readRegionFromValue(const FString& value);
 
@@ -580,6 +792,21 @@ namespace AdminModels
             MinFreeGameSlots(src.MinFreeGameSlots)
             {}
 
+        FAddServerBuildRequest(FAddServerBuildRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ActiveRegions(MoveTemp(src.ActiveRegions)),
+            BuildId(MoveTemp(src.BuildId)),
+            CommandLineTemplate(MoveTemp(src.CommandLineTemplate)),
+            Comment(MoveTemp(src.Comment)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ExecutablePath(MoveTemp(src.ExecutablePath)),
+            MaxGamesPerHost(MoveTemp(src.MaxGamesPerHost)),
+            MinFreeGameSlots(MoveTemp(src.MinFreeGameSlots))
+            {}
+
+        FAddServerBuildRequest& operator=(const FAddServerBuildRequest& src) = default;
+        FAddServerBuildRequest& operator=(FAddServerBuildRequest&& src) = default;
+
         FAddServerBuildRequest(const TSharedPtr<FJsonObject>& obj) : FAddServerBuildRequest()
         {
             readFromValue(obj);
@@ -588,7 +815,13 @@ namespace AdminModels
         ~FAddServerBuildRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum GameBuildStatus
@@ -601,6 +834,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeGameBuildStatusEnumJSON(GameBuildStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeGameBuildStatusEnumJSON(GameBuildStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API GameBuildStatus readGameBuildStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API GameBuildStatus readGameBuildStatusFromValue(const FString& value);
 
@@ -669,6 +903,23 @@ namespace AdminModels
             TitleId(src.TitleId)
             {}
 
+        FAddServerBuildResult(FAddServerBuildResult&& src) :
+            FPlayFabCppResultCommon(),
+            ActiveRegions(MoveTemp(src.ActiveRegions)),
+            BuildId(MoveTemp(src.BuildId)),
+            CommandLineTemplate(MoveTemp(src.CommandLineTemplate)),
+            Comment(MoveTemp(src.Comment)),
+            ExecutablePath(MoveTemp(src.ExecutablePath)),
+            MaxGamesPerHost(MoveTemp(src.MaxGamesPerHost)),
+            MinFreeGameSlots(MoveTemp(src.MinFreeGameSlots)),
+            Status(MoveTemp(src.Status)),
+            Timestamp(MoveTemp(src.Timestamp)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FAddServerBuildResult& operator=(const FAddServerBuildResult& src) = default;
+        FAddServerBuildResult& operator=(FAddServerBuildResult&& src) = default;
+
         FAddServerBuildResult(const TSharedPtr<FJsonObject>& obj) : FAddServerBuildResult()
         {
             readFromValue(obj);
@@ -677,7 +928,13 @@ namespace AdminModels
         ~FAddServerBuildResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddUserVirtualCurrencyRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -712,6 +969,17 @@ namespace AdminModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FAddUserVirtualCurrencyRequest(FAddUserVirtualCurrencyRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Amount(MoveTemp(src.Amount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FAddUserVirtualCurrencyRequest& operator=(const FAddUserVirtualCurrencyRequest& src) = default;
+        FAddUserVirtualCurrencyRequest& operator=(FAddUserVirtualCurrencyRequest&& src) = default;
+
         FAddUserVirtualCurrencyRequest(const TSharedPtr<FJsonObject>& obj) : FAddUserVirtualCurrencyRequest()
         {
             readFromValue(obj);
@@ -720,7 +988,13 @@ namespace AdminModels
         ~FAddUserVirtualCurrencyRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FVirtualCurrencyData : public PlayFab::FPlayFabCppBaseModel
@@ -758,6 +1032,18 @@ namespace AdminModels
             RechargeRate(src.RechargeRate)
             {}
 
+        FVirtualCurrencyData(FVirtualCurrencyData&& src) :
+            FPlayFabCppBaseModel(),
+            CurrencyCode(MoveTemp(src.CurrencyCode)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            InitialDeposit(MoveTemp(src.InitialDeposit)),
+            RechargeMax(MoveTemp(src.RechargeMax)),
+            RechargeRate(MoveTemp(src.RechargeRate))
+            {}
+
+        FVirtualCurrencyData& operator=(const FVirtualCurrencyData& src) = default;
+        FVirtualCurrencyData& operator=(FVirtualCurrencyData&& src) = default;
+
         FVirtualCurrencyData(const TSharedPtr<FJsonObject>& obj) : FVirtualCurrencyData()
         {
             readFromValue(obj);
@@ -766,7 +1052,13 @@ namespace AdminModels
         ~FVirtualCurrencyData();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddVirtualCurrencyTypesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -786,6 +1078,14 @@ namespace AdminModels
             VirtualCurrencies(src.VirtualCurrencies)
             {}
 
+        FAddVirtualCurrencyTypesRequest(FAddVirtualCurrencyTypesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            VirtualCurrencies(MoveTemp(src.VirtualCurrencies))
+            {}
+
+        FAddVirtualCurrencyTypesRequest& operator=(const FAddVirtualCurrencyTypesRequest& src) = default;
+        FAddVirtualCurrencyTypesRequest& operator=(FAddVirtualCurrencyTypesRequest&& src) = default;
+
         FAddVirtualCurrencyTypesRequest(const TSharedPtr<FJsonObject>& obj) : FAddVirtualCurrencyTypesRequest()
         {
             readFromValue(obj);
@@ -794,7 +1094,13 @@ namespace AdminModels
         ~FAddVirtualCurrencyTypesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAllPlayersSegmentFilter : public PlayFab::FPlayFabCppBaseModel
@@ -807,6 +1113,13 @@ namespace AdminModels
             FPlayFabCppBaseModel()
             {}
 
+        FAllPlayersSegmentFilter(FAllPlayersSegmentFilter&& src) :
+            FPlayFabCppBaseModel()
+            {}
+
+        FAllPlayersSegmentFilter& operator=(const FAllPlayersSegmentFilter& src) = default;
+        FAllPlayersSegmentFilter& operator=(FAllPlayersSegmentFilter&& src) = default;
+
         FAllPlayersSegmentFilter(const TSharedPtr<FJsonObject>& obj) : FAllPlayersSegmentFilter()
         {
             readFromValue(obj);
@@ -815,7 +1128,13 @@ namespace AdminModels
         ~FAllPlayersSegmentFilter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum Conditionals
@@ -826,6 +1145,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeConditionalsEnumJSON(Conditionals enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeConditionalsEnumJSON(Conditionals enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API Conditionals readConditionalsFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API Conditionals readConditionalsFromValue(const FString& value);
 
@@ -844,6 +1164,14 @@ namespace AdminModels
             HasSignatureOrEncryption(src.HasSignatureOrEncryption)
             {}
 
+        FApiCondition(FApiCondition&& src) :
+            FPlayFabCppBaseModel(),
+            HasSignatureOrEncryption(MoveTemp(src.HasSignatureOrEncryption))
+            {}
+
+        FApiCondition& operator=(const FApiCondition& src) = default;
+        FApiCondition& operator=(FApiCondition&& src) = default;
+
         FApiCondition(const TSharedPtr<FJsonObject>& obj) : FApiCondition()
         {
             readFromValue(obj);
@@ -852,7 +1180,13 @@ namespace AdminModels
         ~FApiCondition();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum AuthTokenType
@@ -861,6 +1195,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeAuthTokenTypeEnumJSON(AuthTokenType enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeAuthTokenTypeEnumJSON(AuthTokenType enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API AuthTokenType readAuthTokenTypeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API AuthTokenType readAuthTokenTypeFromValue(const FString& value);
 
@@ -914,6 +1249,21 @@ namespace AdminModels
             Reason(src.Reason)
             {}
 
+        FBanInfo(FBanInfo&& src) :
+            FPlayFabCppBaseModel(),
+            Active(MoveTemp(src.Active)),
+            BanId(MoveTemp(src.BanId)),
+            Created(MoveTemp(src.Created)),
+            Expires(MoveTemp(src.Expires)),
+            IPAddress(MoveTemp(src.IPAddress)),
+            MACAddress(MoveTemp(src.MACAddress)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Reason(MoveTemp(src.Reason))
+            {}
+
+        FBanInfo& operator=(const FBanInfo& src) = default;
+        FBanInfo& operator=(FBanInfo&& src) = default;
+
         FBanInfo(const TSharedPtr<FJsonObject>& obj) : FBanInfo()
         {
             readFromValue(obj);
@@ -922,7 +1272,13 @@ namespace AdminModels
         ~FBanInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FBanPlayerSegmentAction : public PlayFab::FPlayFabCppBaseModel
@@ -945,6 +1301,15 @@ namespace AdminModels
             ReasonForBan(src.ReasonForBan)
             {}
 
+        FBanPlayerSegmentAction(FBanPlayerSegmentAction&& src) :
+            FPlayFabCppBaseModel(),
+            BanHours(MoveTemp(src.BanHours)),
+            ReasonForBan(MoveTemp(src.ReasonForBan))
+            {}
+
+        FBanPlayerSegmentAction& operator=(const FBanPlayerSegmentAction& src) = default;
+        FBanPlayerSegmentAction& operator=(FBanPlayerSegmentAction&& src) = default;
+
         FBanPlayerSegmentAction(const TSharedPtr<FJsonObject>& obj) : FBanPlayerSegmentAction()
         {
             readFromValue(obj);
@@ -953,7 +1318,13 @@ namespace AdminModels
         ~FBanPlayerSegmentAction();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FBanRequest : public PlayFab::FPlayFabCppBaseModel
@@ -991,6 +1362,18 @@ namespace AdminModels
             Reason(src.Reason)
             {}
 
+        FBanRequest(FBanRequest&& src) :
+            FPlayFabCppBaseModel(),
+            DurationInHours(MoveTemp(src.DurationInHours)),
+            IPAddress(MoveTemp(src.IPAddress)),
+            MACAddress(MoveTemp(src.MACAddress)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Reason(MoveTemp(src.Reason))
+            {}
+
+        FBanRequest& operator=(const FBanRequest& src) = default;
+        FBanRequest& operator=(FBanRequest&& src) = default;
+
         FBanRequest(const TSharedPtr<FJsonObject>& obj) : FBanRequest()
         {
             readFromValue(obj);
@@ -999,7 +1382,13 @@ namespace AdminModels
         ~FBanRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FBanUsersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1020,6 +1409,15 @@ namespace AdminModels
             CustomTags(src.CustomTags)
             {}
 
+        FBanUsersRequest(FBanUsersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Bans(MoveTemp(src.Bans)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FBanUsersRequest& operator=(const FBanUsersRequest& src) = default;
+        FBanUsersRequest& operator=(FBanUsersRequest&& src) = default;
+
         FBanUsersRequest(const TSharedPtr<FJsonObject>& obj) : FBanUsersRequest()
         {
             readFromValue(obj);
@@ -1028,7 +1426,13 @@ namespace AdminModels
         ~FBanUsersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FBanUsersResult : public PlayFab::FPlayFabCppResultCommon
@@ -1045,6 +1449,14 @@ namespace AdminModels
             BanData(src.BanData)
             {}
 
+        FBanUsersResult(FBanUsersResult&& src) :
+            FPlayFabCppResultCommon(),
+            BanData(MoveTemp(src.BanData))
+            {}
+
+        FBanUsersResult& operator=(const FBanUsersResult& src) = default;
+        FBanUsersResult& operator=(FBanUsersResult&& src) = default;
+
         FBanUsersResult(const TSharedPtr<FJsonObject>& obj) : FBanUsersResult()
         {
             readFromValue(obj);
@@ -1053,7 +1465,13 @@ namespace AdminModels
         ~FBanUsersResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FBlankResult : public PlayFab::FPlayFabCppResultCommon
@@ -1066,6 +1484,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FBlankResult(FBlankResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FBlankResult& operator=(const FBlankResult& src) = default;
+        FBlankResult& operator=(FBlankResult&& src) = default;
+
         FBlankResult(const TSharedPtr<FJsonObject>& obj) : FBlankResult()
         {
             readFromValue(obj);
@@ -1074,7 +1499,13 @@ namespace AdminModels
         ~FBlankResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCatalogItemBundleInfo : public PlayFab::FPlayFabCppBaseModel
@@ -1102,6 +1533,16 @@ namespace AdminModels
             BundledVirtualCurrencies(src.BundledVirtualCurrencies)
             {}
 
+        FCatalogItemBundleInfo(FCatalogItemBundleInfo&& src) :
+            FPlayFabCppBaseModel(),
+            BundledItems(MoveTemp(src.BundledItems)),
+            BundledResultTables(MoveTemp(src.BundledResultTables)),
+            BundledVirtualCurrencies(MoveTemp(src.BundledVirtualCurrencies))
+            {}
+
+        FCatalogItemBundleInfo& operator=(const FCatalogItemBundleInfo& src) = default;
+        FCatalogItemBundleInfo& operator=(FCatalogItemBundleInfo&& src) = default;
+
         FCatalogItemBundleInfo(const TSharedPtr<FJsonObject>& obj) : FCatalogItemBundleInfo()
         {
             readFromValue(obj);
@@ -1110,7 +1551,13 @@ namespace AdminModels
         ~FCatalogItemBundleInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCatalogItemConsumableInfo : public PlayFab::FPlayFabCppBaseModel
@@ -1145,6 +1592,16 @@ namespace AdminModels
             UsagePeriodGroup(src.UsagePeriodGroup)
             {}
 
+        FCatalogItemConsumableInfo(FCatalogItemConsumableInfo&& src) :
+            FPlayFabCppBaseModel(),
+            UsageCount(MoveTemp(src.UsageCount)),
+            UsagePeriod(MoveTemp(src.UsagePeriod)),
+            UsagePeriodGroup(MoveTemp(src.UsagePeriodGroup))
+            {}
+
+        FCatalogItemConsumableInfo& operator=(const FCatalogItemConsumableInfo& src) = default;
+        FCatalogItemConsumableInfo& operator=(FCatalogItemConsumableInfo&& src) = default;
+
         FCatalogItemConsumableInfo(const TSharedPtr<FJsonObject>& obj) : FCatalogItemConsumableInfo()
         {
             readFromValue(obj);
@@ -1153,7 +1610,13 @@ namespace AdminModels
         ~FCatalogItemConsumableInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCatalogItemContainerInfo : public PlayFab::FPlayFabCppBaseModel
@@ -1189,6 +1652,17 @@ namespace AdminModels
             VirtualCurrencyContents(src.VirtualCurrencyContents)
             {}
 
+        FCatalogItemContainerInfo(FCatalogItemContainerInfo&& src) :
+            FPlayFabCppBaseModel(),
+            ItemContents(MoveTemp(src.ItemContents)),
+            KeyItemId(MoveTemp(src.KeyItemId)),
+            ResultTableContents(MoveTemp(src.ResultTableContents)),
+            VirtualCurrencyContents(MoveTemp(src.VirtualCurrencyContents))
+            {}
+
+        FCatalogItemContainerInfo& operator=(const FCatalogItemContainerInfo& src) = default;
+        FCatalogItemContainerInfo& operator=(FCatalogItemContainerInfo&& src) = default;
+
         FCatalogItemContainerInfo(const TSharedPtr<FJsonObject>& obj) : FCatalogItemContainerInfo()
         {
             readFromValue(obj);
@@ -1197,7 +1671,13 @@ namespace AdminModels
         ~FCatalogItemContainerInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCatalogItem : public PlayFab::FPlayFabCppBaseModel
@@ -1295,11 +1775,11 @@ namespace AdminModels
 
         FCatalogItem(const FCatalogItem& src) :
             FPlayFabCppBaseModel(),
-            Bundle(src.Bundle.IsValid() ? MakeShareable(new FCatalogItemBundleInfo(*src.Bundle)) : nullptr),
+            Bundle(src.Bundle.IsValid() ? TSharedPtr<FCatalogItemBundleInfo>(MakeShared<FCatalogItemBundleInfo>(*src.Bundle)) : nullptr),
             CanBecomeCharacter(src.CanBecomeCharacter),
             CatalogVersion(src.CatalogVersion),
-            Consumable(src.Consumable.IsValid() ? MakeShareable(new FCatalogItemConsumableInfo(*src.Consumable)) : nullptr),
-            Container(src.Container.IsValid() ? MakeShareable(new FCatalogItemContainerInfo(*src.Container)) : nullptr),
+            Consumable(src.Consumable.IsValid() ? TSharedPtr<FCatalogItemConsumableInfo>(MakeShared<FCatalogItemConsumableInfo>(*src.Consumable)) : nullptr),
+            Container(src.Container.IsValid() ? TSharedPtr<FCatalogItemContainerInfo>(MakeShared<FCatalogItemContainerInfo>(*src.Container)) : nullptr),
             CustomData(src.CustomData),
             Description(src.Description),
             DisplayName(src.DisplayName),
@@ -1315,6 +1795,31 @@ namespace AdminModels
             VirtualCurrencyPrices(src.VirtualCurrencyPrices)
             {}
 
+        FCatalogItem(FCatalogItem&& src) :
+            FPlayFabCppBaseModel(),
+            Bundle(MoveTemp(src.Bundle)),
+            CanBecomeCharacter(MoveTemp(src.CanBecomeCharacter)),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            Consumable(MoveTemp(src.Consumable)),
+            Container(MoveTemp(src.Container)),
+            CustomData(MoveTemp(src.CustomData)),
+            Description(MoveTemp(src.Description)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            InitialLimitedEditionCount(MoveTemp(src.InitialLimitedEditionCount)),
+            IsLimitedEdition(MoveTemp(src.IsLimitedEdition)),
+            IsStackable(MoveTemp(src.IsStackable)),
+            IsTradable(MoveTemp(src.IsTradable)),
+            ItemClass(MoveTemp(src.ItemClass)),
+            ItemId(MoveTemp(src.ItemId)),
+            ItemImageUrl(MoveTemp(src.ItemImageUrl)),
+            RealCurrencyPrices(MoveTemp(src.RealCurrencyPrices)),
+            Tags(MoveTemp(src.Tags)),
+            VirtualCurrencyPrices(MoveTemp(src.VirtualCurrencyPrices))
+            {}
+
+        FCatalogItem& operator=(const FCatalogItem& src) = default;
+        FCatalogItem& operator=(FCatalogItem&& src) = default;
+
         FCatalogItem(const TSharedPtr<FJsonObject>& obj) : FCatalogItem()
         {
             readFromValue(obj);
@@ -1323,7 +1828,13 @@ namespace AdminModels
         ~FCatalogItem();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCheckLimitedEditionItemAvailabilityRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1346,6 +1857,15 @@ namespace AdminModels
             ItemId(src.ItemId)
             {}
 
+        FCheckLimitedEditionItemAvailabilityRequest(FCheckLimitedEditionItemAvailabilityRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            ItemId(MoveTemp(src.ItemId))
+            {}
+
+        FCheckLimitedEditionItemAvailabilityRequest& operator=(const FCheckLimitedEditionItemAvailabilityRequest& src) = default;
+        FCheckLimitedEditionItemAvailabilityRequest& operator=(FCheckLimitedEditionItemAvailabilityRequest&& src) = default;
+
         FCheckLimitedEditionItemAvailabilityRequest(const TSharedPtr<FJsonObject>& obj) : FCheckLimitedEditionItemAvailabilityRequest()
         {
             readFromValue(obj);
@@ -1354,7 +1874,13 @@ namespace AdminModels
         ~FCheckLimitedEditionItemAvailabilityRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCheckLimitedEditionItemAvailabilityResult : public PlayFab::FPlayFabCppResultCommon
@@ -1372,6 +1898,14 @@ namespace AdminModels
             Amount(src.Amount)
             {}
 
+        FCheckLimitedEditionItemAvailabilityResult(FCheckLimitedEditionItemAvailabilityResult&& src) :
+            FPlayFabCppResultCommon(),
+            Amount(MoveTemp(src.Amount))
+            {}
+
+        FCheckLimitedEditionItemAvailabilityResult& operator=(const FCheckLimitedEditionItemAvailabilityResult& src) = default;
+        FCheckLimitedEditionItemAvailabilityResult& operator=(FCheckLimitedEditionItemAvailabilityResult&& src) = default;
+
         FCheckLimitedEditionItemAvailabilityResult(const TSharedPtr<FJsonObject>& obj) : FCheckLimitedEditionItemAvailabilityResult()
         {
             readFromValue(obj);
@@ -1380,7 +1914,13 @@ namespace AdminModels
         ~FCheckLimitedEditionItemAvailabilityResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCloudScriptFile : public PlayFab::FPlayFabCppBaseModel
@@ -1406,6 +1946,15 @@ namespace AdminModels
             Filename(src.Filename)
             {}
 
+        FCloudScriptFile(FCloudScriptFile&& src) :
+            FPlayFabCppBaseModel(),
+            FileContents(MoveTemp(src.FileContents)),
+            Filename(MoveTemp(src.Filename))
+            {}
+
+        FCloudScriptFile& operator=(const FCloudScriptFile& src) = default;
+        FCloudScriptFile& operator=(FCloudScriptFile&& src) = default;
+
         FCloudScriptFile(const TSharedPtr<FJsonObject>& obj) : FCloudScriptFile()
         {
             readFromValue(obj);
@@ -1414,7 +1963,13 @@ namespace AdminModels
         ~FCloudScriptFile();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCloudScriptTaskParameter : public PlayFab::FPlayFabCppBaseModel
@@ -1437,6 +1992,15 @@ namespace AdminModels
             FunctionName(src.FunctionName)
             {}
 
+        FCloudScriptTaskParameter(FCloudScriptTaskParameter&& src) :
+            FPlayFabCppBaseModel(),
+            Argument(MoveTemp(src.Argument)),
+            FunctionName(MoveTemp(src.FunctionName))
+            {}
+
+        FCloudScriptTaskParameter& operator=(const FCloudScriptTaskParameter& src) = default;
+        FCloudScriptTaskParameter& operator=(FCloudScriptTaskParameter&& src) = default;
+
         FCloudScriptTaskParameter(const TSharedPtr<FJsonObject>& obj) : FCloudScriptTaskParameter()
         {
             readFromValue(obj);
@@ -1445,7 +2009,13 @@ namespace AdminModels
         ~FCloudScriptTaskParameter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FScriptExecutionError : public PlayFab::FPlayFabCppBaseModel
@@ -1476,6 +2046,16 @@ namespace AdminModels
             StackTrace(src.StackTrace)
             {}
 
+        FScriptExecutionError(FScriptExecutionError&& src) :
+            FPlayFabCppBaseModel(),
+            Error(MoveTemp(src.Error)),
+            Message(MoveTemp(src.Message)),
+            StackTrace(MoveTemp(src.StackTrace))
+            {}
+
+        FScriptExecutionError& operator=(const FScriptExecutionError& src) = default;
+        FScriptExecutionError& operator=(FScriptExecutionError&& src) = default;
+
         FScriptExecutionError(const TSharedPtr<FJsonObject>& obj) : FScriptExecutionError()
         {
             readFromValue(obj);
@@ -1484,7 +2064,13 @@ namespace AdminModels
         ~FScriptExecutionError();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLogStatement : public PlayFab::FPlayFabCppBaseModel
@@ -1512,6 +2098,16 @@ namespace AdminModels
             Message(src.Message)
             {}
 
+        FLogStatement(FLogStatement&& src) :
+            FPlayFabCppBaseModel(),
+            Data(MoveTemp(src.Data)),
+            Level(MoveTemp(src.Level)),
+            Message(MoveTemp(src.Message))
+            {}
+
+        FLogStatement& operator=(const FLogStatement& src) = default;
+        FLogStatement& operator=(FLogStatement&& src) = default;
+
         FLogStatement(const TSharedPtr<FJsonObject>& obj) : FLogStatement()
         {
             readFromValue(obj);
@@ -1520,7 +2116,13 @@ namespace AdminModels
         ~FLogStatement();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FExecuteCloudScriptResult : public PlayFab::FPlayFabCppBaseModel
@@ -1589,7 +2191,7 @@ namespace AdminModels
         FExecuteCloudScriptResult(const FExecuteCloudScriptResult& src) :
             FPlayFabCppBaseModel(),
             APIRequestsIssued(src.APIRequestsIssued),
-            Error(src.Error.IsValid() ? MakeShareable(new FScriptExecutionError(*src.Error)) : nullptr),
+            Error(src.Error.IsValid() ? TSharedPtr<FScriptExecutionError>(MakeShared<FScriptExecutionError>(*src.Error)) : nullptr),
             ExecutionTimeSeconds(src.ExecutionTimeSeconds),
             FunctionName(src.FunctionName),
             FunctionResult(src.FunctionResult),
@@ -1602,6 +2204,25 @@ namespace AdminModels
             Revision(src.Revision)
             {}
 
+        FExecuteCloudScriptResult(FExecuteCloudScriptResult&& src) :
+            FPlayFabCppBaseModel(),
+            APIRequestsIssued(MoveTemp(src.APIRequestsIssued)),
+            Error(MoveTemp(src.Error)),
+            ExecutionTimeSeconds(MoveTemp(src.ExecutionTimeSeconds)),
+            FunctionName(MoveTemp(src.FunctionName)),
+            FunctionResult(MoveTemp(src.FunctionResult)),
+            FunctionResultTooLarge(MoveTemp(src.FunctionResultTooLarge)),
+            HttpRequestsIssued(MoveTemp(src.HttpRequestsIssued)),
+            Logs(MoveTemp(src.Logs)),
+            LogsTooLarge(MoveTemp(src.LogsTooLarge)),
+            MemoryConsumedBytes(MoveTemp(src.MemoryConsumedBytes)),
+            ProcessorTimeSeconds(MoveTemp(src.ProcessorTimeSeconds)),
+            Revision(MoveTemp(src.Revision))
+            {}
+
+        FExecuteCloudScriptResult& operator=(const FExecuteCloudScriptResult& src) = default;
+        FExecuteCloudScriptResult& operator=(FExecuteCloudScriptResult&& src) = default;
+
         FExecuteCloudScriptResult(const TSharedPtr<FJsonObject>& obj) : FExecuteCloudScriptResult()
         {
             readFromValue(obj);
@@ -1610,7 +2231,13 @@ namespace AdminModels
         ~FExecuteCloudScriptResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCloudScriptTaskSummary : public PlayFab::FPlayFabCppBaseModel
@@ -1660,14 +2287,30 @@ namespace AdminModels
             CompletedAt(src.CompletedAt),
             EstimatedSecondsRemaining(src.EstimatedSecondsRemaining),
             PercentComplete(src.PercentComplete),
-            Result(src.Result.IsValid() ? MakeShareable(new FExecuteCloudScriptResult(*src.Result)) : nullptr),
+            Result(src.Result.IsValid() ? TSharedPtr<FExecuteCloudScriptResult>(MakeShared<FExecuteCloudScriptResult>(*src.Result)) : nullptr),
             ScheduledByUserId(src.ScheduledByUserId),
             StartedAt(src.StartedAt),
             Status(src.Status),
-            TaskIdentifier(src.TaskIdentifier.IsValid() ? MakeShareable(new FNameIdentifier(*src.TaskIdentifier)) : nullptr),
+            TaskIdentifier(src.TaskIdentifier.IsValid() ? TSharedPtr<FNameIdentifier>(MakeShared<FNameIdentifier>(*src.TaskIdentifier)) : nullptr),
             TaskInstanceId(src.TaskInstanceId)
             {}
 
+        FCloudScriptTaskSummary(FCloudScriptTaskSummary&& src) :
+            FPlayFabCppBaseModel(),
+            CompletedAt(MoveTemp(src.CompletedAt)),
+            EstimatedSecondsRemaining(MoveTemp(src.EstimatedSecondsRemaining)),
+            PercentComplete(MoveTemp(src.PercentComplete)),
+            Result(MoveTemp(src.Result)),
+            ScheduledByUserId(MoveTemp(src.ScheduledByUserId)),
+            StartedAt(MoveTemp(src.StartedAt)),
+            Status(MoveTemp(src.Status)),
+            TaskIdentifier(MoveTemp(src.TaskIdentifier)),
+            TaskInstanceId(MoveTemp(src.TaskInstanceId))
+            {}
+
+        FCloudScriptTaskSummary& operator=(const FCloudScriptTaskSummary& src) = default;
+        FCloudScriptTaskSummary& operator=(FCloudScriptTaskSummary&& src) = default;
+
         FCloudScriptTaskSummary(const TSharedPtr<FJsonObject>& obj) : FCloudScriptTaskSummary()
         {
             readFromValue(obj);
@@ -1676,7 +2319,13 @@ namespace AdminModels
         ~FCloudScriptTaskSummary();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCloudScriptVersionStatus : public PlayFab::FPlayFabCppBaseModel
@@ -1704,6 +2353,16 @@ namespace AdminModels
             Version(src.Version)
             {}
 
+        FCloudScriptVersionStatus(FCloudScriptVersionStatus&& src) :
+            FPlayFabCppBaseModel(),
+            LatestRevision(MoveTemp(src.LatestRevision)),
+            PublishedRevision(MoveTemp(src.PublishedRevision)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FCloudScriptVersionStatus& operator=(const FCloudScriptVersionStatus& src) = default;
+        FCloudScriptVersionStatus& operator=(FCloudScriptVersionStatus&& src) = default;
+
         FCloudScriptVersionStatus(const TSharedPtr<FJsonObject>& obj) : FCloudScriptVersionStatus()
         {
             readFromValue(obj);
@@ -1712,7 +2371,13 @@ namespace AdminModels
         ~FCloudScriptVersionStatus();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum EmailVerificationStatus
@@ -1723,6 +2388,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API EmailVerificationStatus readEmailVerificationStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API EmailVerificationStatus readEmailVerificationStatusFromValue(const FString& value);
 
@@ -1751,6 +2417,16 @@ namespace AdminModels
             VerificationStatus(src.VerificationStatus)
             {}
 
+        FContactEmailInfo(FContactEmailInfo&& src) :
+            FPlayFabCppBaseModel(),
+            EmailAddress(MoveTemp(src.EmailAddress)),
+            Name(MoveTemp(src.Name)),
+            VerificationStatus(MoveTemp(src.VerificationStatus))
+            {}
+
+        FContactEmailInfo& operator=(const FContactEmailInfo& src) = default;
+        FContactEmailInfo& operator=(FContactEmailInfo&& src) = default;
+
         FContactEmailInfo(const TSharedPtr<FJsonObject>& obj) : FContactEmailInfo()
         {
             readFromValue(obj);
@@ -1759,7 +2435,13 @@ namespace AdminModels
         ~FContactEmailInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FContactEmailInfoModel : public PlayFab::FPlayFabCppBaseModel
@@ -1787,6 +2469,16 @@ namespace AdminModels
             VerificationStatus(src.VerificationStatus)
             {}
 
+        FContactEmailInfoModel(FContactEmailInfoModel&& src) :
+            FPlayFabCppBaseModel(),
+            EmailAddress(MoveTemp(src.EmailAddress)),
+            Name(MoveTemp(src.Name)),
+            VerificationStatus(MoveTemp(src.VerificationStatus))
+            {}
+
+        FContactEmailInfoModel& operator=(const FContactEmailInfoModel& src) = default;
+        FContactEmailInfoModel& operator=(FContactEmailInfoModel&& src) = default;
+
         FContactEmailInfoModel(const TSharedPtr<FJsonObject>& obj) : FContactEmailInfoModel()
         {
             readFromValue(obj);
@@ -1795,7 +2487,13 @@ namespace AdminModels
         ~FContactEmailInfoModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FContentInfo : public PlayFab::FPlayFabCppBaseModel
@@ -1823,6 +2521,16 @@ namespace AdminModels
             Size(src.Size)
             {}
 
+        FContentInfo(FContentInfo&& src) :
+            FPlayFabCppBaseModel(),
+            Key(MoveTemp(src.Key)),
+            LastModified(MoveTemp(src.LastModified)),
+            Size(MoveTemp(src.Size))
+            {}
+
+        FContentInfo& operator=(const FContentInfo& src) = default;
+        FContentInfo& operator=(FContentInfo&& src) = default;
+
         FContentInfo(const TSharedPtr<FJsonObject>& obj) : FContentInfo()
         {
             readFromValue(obj);
@@ -1831,7 +2539,13 @@ namespace AdminModels
         ~FContentInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum ContinentCode
@@ -1846,6 +2560,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeContinentCodeEnumJSON(ContinentCode enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeContinentCodeEnumJSON(ContinentCode enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API ContinentCode readContinentCodeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API ContinentCode readContinentCodeFromValue(const FString& value);
 
@@ -2103,6 +2818,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeCountryCodeEnumJSON(CountryCode enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeCountryCodeEnumJSON(CountryCode enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API CountryCode readCountryCodeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API CountryCode readCountryCodeFromValue(const FString& value);
 
@@ -2145,6 +2861,19 @@ namespace AdminModels
             Schedule(src.Schedule)
             {}
 
+        FCreateActionsOnPlayerSegmentTaskRequest(FCreateActionsOnPlayerSegmentTaskRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Description(MoveTemp(src.Description)),
+            IsActive(MoveTemp(src.IsActive)),
+            Name(MoveTemp(src.Name)),
+            Parameter(MoveTemp(src.Parameter)),
+            Schedule(MoveTemp(src.Schedule))
+            {}
+
+        FCreateActionsOnPlayerSegmentTaskRequest& operator=(const FCreateActionsOnPlayerSegmentTaskRequest& src) = default;
+        FCreateActionsOnPlayerSegmentTaskRequest& operator=(FCreateActionsOnPlayerSegmentTaskRequest&& src) = default;
+
         FCreateActionsOnPlayerSegmentTaskRequest(const TSharedPtr<FJsonObject>& obj) : FCreateActionsOnPlayerSegmentTaskRequest()
         {
             readFromValue(obj);
@@ -2153,7 +2882,13 @@ namespace AdminModels
         ~FCreateActionsOnPlayerSegmentTaskRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateCloudScriptTaskRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2195,6 +2930,19 @@ namespace AdminModels
             Schedule(src.Schedule)
             {}
 
+        FCreateCloudScriptTaskRequest(FCreateCloudScriptTaskRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Description(MoveTemp(src.Description)),
+            IsActive(MoveTemp(src.IsActive)),
+            Name(MoveTemp(src.Name)),
+            Parameter(MoveTemp(src.Parameter)),
+            Schedule(MoveTemp(src.Schedule))
+            {}
+
+        FCreateCloudScriptTaskRequest& operator=(const FCreateCloudScriptTaskRequest& src) = default;
+        FCreateCloudScriptTaskRequest& operator=(FCreateCloudScriptTaskRequest&& src) = default;
+
         FCreateCloudScriptTaskRequest(const TSharedPtr<FJsonObject>& obj) : FCreateCloudScriptTaskRequest()
         {
             readFromValue(obj);
@@ -2203,7 +2951,13 @@ namespace AdminModels
         ~FCreateCloudScriptTaskRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FInsightsScalingTaskParameter : public PlayFab::FPlayFabCppBaseModel
@@ -2221,6 +2975,14 @@ namespace AdminModels
             Level(src.Level)
             {}
 
+        FInsightsScalingTaskParameter(FInsightsScalingTaskParameter&& src) :
+            FPlayFabCppBaseModel(),
+            Level(MoveTemp(src.Level))
+            {}
+
+        FInsightsScalingTaskParameter& operator=(const FInsightsScalingTaskParameter& src) = default;
+        FInsightsScalingTaskParameter& operator=(FInsightsScalingTaskParameter&& src) = default;
+
         FInsightsScalingTaskParameter(const TSharedPtr<FJsonObject>& obj) : FInsightsScalingTaskParameter()
         {
             readFromValue(obj);
@@ -2229,7 +2991,13 @@ namespace AdminModels
         ~FInsightsScalingTaskParameter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateInsightsScheduledScalingTaskRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2271,6 +3039,19 @@ namespace AdminModels
             Schedule(src.Schedule)
             {}
 
+        FCreateInsightsScheduledScalingTaskRequest(FCreateInsightsScheduledScalingTaskRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Description(MoveTemp(src.Description)),
+            IsActive(MoveTemp(src.IsActive)),
+            Name(MoveTemp(src.Name)),
+            Parameter(MoveTemp(src.Parameter)),
+            Schedule(MoveTemp(src.Schedule))
+            {}
+
+        FCreateInsightsScheduledScalingTaskRequest& operator=(const FCreateInsightsScheduledScalingTaskRequest& src) = default;
+        FCreateInsightsScheduledScalingTaskRequest& operator=(FCreateInsightsScheduledScalingTaskRequest&& src) = default;
+
         FCreateInsightsScheduledScalingTaskRequest(const TSharedPtr<FJsonObject>& obj) : FCreateInsightsScheduledScalingTaskRequest()
         {
             readFromValue(obj);
@@ -2279,7 +3060,13 @@ namespace AdminModels
         ~FCreateInsightsScheduledScalingTaskRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FOpenIdIssuerInformation : public PlayFab::FPlayFabCppBaseModel
@@ -2312,6 +3099,17 @@ namespace AdminModels
             TokenUrl(src.TokenUrl)
             {}
 
+        FOpenIdIssuerInformation(FOpenIdIssuerInformation&& src) :
+            FPlayFabCppBaseModel(),
+            AuthorizationUrl(MoveTemp(src.AuthorizationUrl)),
+            Issuer(MoveTemp(src.Issuer)),
+            JsonWebKeySet(MoveTemp(src.JsonWebKeySet)),
+            TokenUrl(MoveTemp(src.TokenUrl))
+            {}
+
+        FOpenIdIssuerInformation& operator=(const FOpenIdIssuerInformation& src) = default;
+        FOpenIdIssuerInformation& operator=(FOpenIdIssuerInformation&& src) = default;
+
         FOpenIdIssuerInformation(const TSharedPtr<FJsonObject>& obj) : FOpenIdIssuerInformation()
         {
             readFromValue(obj);
@@ -2320,7 +3118,13 @@ namespace AdminModels
         ~FOpenIdIssuerInformation();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateOpenIdConnectionRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2365,9 +3169,22 @@ namespace AdminModels
             ConnectionId(src.ConnectionId),
             IgnoreNonce(src.IgnoreNonce),
             IssuerDiscoveryUrl(src.IssuerDiscoveryUrl),
-            IssuerInformation(src.IssuerInformation.IsValid() ? MakeShareable(new FOpenIdIssuerInformation(*src.IssuerInformation)) : nullptr)
+            IssuerInformation(src.IssuerInformation.IsValid() ? TSharedPtr<FOpenIdIssuerInformation>(MakeShared<FOpenIdIssuerInformation>(*src.IssuerInformation)) : nullptr)
+            {}
+
+        FCreateOpenIdConnectionRequest(FCreateOpenIdConnectionRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ClientId(MoveTemp(src.ClientId)),
+            ClientSecret(MoveTemp(src.ClientSecret)),
+            ConnectionId(MoveTemp(src.ConnectionId)),
+            IgnoreNonce(MoveTemp(src.IgnoreNonce)),
+            IssuerDiscoveryUrl(MoveTemp(src.IssuerDiscoveryUrl)),
+            IssuerInformation(MoveTemp(src.IssuerInformation))
             {}
 
+        FCreateOpenIdConnectionRequest& operator=(const FCreateOpenIdConnectionRequest& src) = default;
+        FCreateOpenIdConnectionRequest& operator=(FCreateOpenIdConnectionRequest&& src) = default;
+
         FCreateOpenIdConnectionRequest(const TSharedPtr<FJsonObject>& obj) : FCreateOpenIdConnectionRequest()
         {
             readFromValue(obj);
@@ -2376,7 +3193,13 @@ namespace AdminModels
         ~FCreateOpenIdConnectionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreatePlayerSharedSecretRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2394,6 +3217,14 @@ namespace AdminModels
             FriendlyName(src.FriendlyName)
             {}
 
+        FCreatePlayerSharedSecretRequest(FCreatePlayerSharedSecretRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            FriendlyName(MoveTemp(src.FriendlyName))
+            {}
+
+        FCreatePlayerSharedSecretRequest& operator=(const FCreatePlayerSharedSecretRequest& src) = default;
+        FCreatePlayerSharedSecretRequest& operator=(FCreatePlayerSharedSecretRequest&& src) = default;
+
         FCreatePlayerSharedSecretRequest(const TSharedPtr<FJsonObject>& obj) : FCreatePlayerSharedSecretRequest()
         {
             readFromValue(obj);
@@ -2402,7 +3233,13 @@ namespace AdminModels
         ~FCreatePlayerSharedSecretRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreatePlayerSharedSecretResult : public PlayFab::FPlayFabCppResultCommon
@@ -2420,6 +3257,14 @@ namespace AdminModels
             SecretKey(src.SecretKey)
             {}
 
+        FCreatePlayerSharedSecretResult(FCreatePlayerSharedSecretResult&& src) :
+            FPlayFabCppResultCommon(),
+            SecretKey(MoveTemp(src.SecretKey))
+            {}
+
+        FCreatePlayerSharedSecretResult& operator=(const FCreatePlayerSharedSecretResult& src) = default;
+        FCreatePlayerSharedSecretResult& operator=(FCreatePlayerSharedSecretResult&& src) = default;
+
         FCreatePlayerSharedSecretResult(const TSharedPtr<FJsonObject>& obj) : FCreatePlayerSharedSecretResult()
         {
             readFromValue(obj);
@@ -2428,7 +3273,13 @@ namespace AdminModels
         ~FCreatePlayerSharedSecretResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum StatisticAggregationMethod
@@ -2440,6 +3291,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeStatisticAggregationMethodEnumJSON(StatisticAggregationMethod enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeStatisticAggregationMethodEnumJSON(StatisticAggregationMethod enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API StatisticAggregationMethod readStatisticAggregationMethodFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API StatisticAggregationMethod readStatisticAggregationMethodFromValue(const FString& value);
 
@@ -2453,6 +3305,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeStatisticResetIntervalOptionEnumJSON(StatisticResetIntervalOption enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeStatisticResetIntervalOptionEnumJSON(StatisticResetIntervalOption enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API StatisticResetIntervalOption readStatisticResetIntervalOptionFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API StatisticResetIntervalOption readStatisticResetIntervalOptionFromValue(const FString& value);
 
@@ -2485,6 +3338,17 @@ namespace AdminModels
             VersionChangeInterval(src.VersionChangeInterval)
             {}
 
+        FCreatePlayerStatisticDefinitionRequest(FCreatePlayerStatisticDefinitionRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AggregationMethod(MoveTemp(src.AggregationMethod)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            VersionChangeInterval(MoveTemp(src.VersionChangeInterval))
+            {}
+
+        FCreatePlayerStatisticDefinitionRequest& operator=(const FCreatePlayerStatisticDefinitionRequest& src) = default;
+        FCreatePlayerStatisticDefinitionRequest& operator=(FCreatePlayerStatisticDefinitionRequest&& src) = default;
+
         FCreatePlayerStatisticDefinitionRequest(const TSharedPtr<FJsonObject>& obj) : FCreatePlayerStatisticDefinitionRequest()
         {
             readFromValue(obj);
@@ -2493,7 +3357,13 @@ namespace AdminModels
         ~FCreatePlayerStatisticDefinitionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerStatisticDefinition : public PlayFab::FPlayFabCppBaseModel
@@ -2526,6 +3396,17 @@ namespace AdminModels
             VersionChangeInterval(src.VersionChangeInterval)
             {}
 
+        FPlayerStatisticDefinition(FPlayerStatisticDefinition&& src) :
+            FPlayFabCppBaseModel(),
+            AggregationMethod(MoveTemp(src.AggregationMethod)),
+            CurrentVersion(MoveTemp(src.CurrentVersion)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            VersionChangeInterval(MoveTemp(src.VersionChangeInterval))
+            {}
+
+        FPlayerStatisticDefinition& operator=(const FPlayerStatisticDefinition& src) = default;
+        FPlayerStatisticDefinition& operator=(FPlayerStatisticDefinition&& src) = default;
+
         FPlayerStatisticDefinition(const TSharedPtr<FJsonObject>& obj) : FPlayerStatisticDefinition()
         {
             readFromValue(obj);
@@ -2534,7 +3415,13 @@ namespace AdminModels
         ~FPlayerStatisticDefinition();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreatePlayerStatisticDefinitionResult : public PlayFab::FPlayFabCppResultCommon
@@ -2549,18 +3436,32 @@ namespace AdminModels
 
         FCreatePlayerStatisticDefinitionResult(const FCreatePlayerStatisticDefinitionResult& src) :
             FPlayFabCppResultCommon(),
-            Statistic(src.Statistic.IsValid() ? MakeShareable(new FPlayerStatisticDefinition(*src.Statistic)) : nullptr)
+            Statistic(src.Statistic.IsValid() ? TSharedPtr<FPlayerStatisticDefinition>(MakeShared<FPlayerStatisticDefinition>(*src.Statistic)) : nullptr)
             {}
 
-        FCreatePlayerStatisticDefinitionResult(const TSharedPtr<FJsonObject>& obj) : FCreatePlayerStatisticDefinitionResult()
-        {
+        FCreatePlayerStatisticDefinitionResult(FCreatePlayerStatisticDefinitionResult&& src) :
+            FPlayFabCppResultCommon(),
+            Statistic(MoveTemp(src.Statistic))
+            {}
+
+        FCreatePlayerStatisticDefinitionResult& operator=(const FCreatePlayerStatisticDefinitionResult& src) = default;
+        FCreatePlayerStatisticDefinitionResult& operator=(FCreatePlayerStatisticDefinitionResult&& src) = default;
+
+        FCreatePlayerStatisticDefinitionResult(const TSharedPtr<FJsonObject>& obj) : FCreatePlayerStatisticDefinitionResult()
+        {
             readFromValue(obj);
         }
 
         ~FCreatePlayerStatisticDefinitionResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeletePlayerSegmentAction : public PlayFab::FPlayFabCppBaseModel
@@ -2573,6 +3474,13 @@ namespace AdminModels
             FPlayFabCppBaseModel()
             {}
 
+        FDeletePlayerSegmentAction(FDeletePlayerSegmentAction&& src) :
+            FPlayFabCppBaseModel()
+            {}
+
+        FDeletePlayerSegmentAction& operator=(const FDeletePlayerSegmentAction& src) = default;
+        FDeletePlayerSegmentAction& operator=(FDeletePlayerSegmentAction&& src) = default;
+
         FDeletePlayerSegmentAction(const TSharedPtr<FJsonObject>& obj) : FDeletePlayerSegmentAction()
         {
             readFromValue(obj);
@@ -2581,7 +3489,13 @@ namespace AdminModels
         ~FDeletePlayerSegmentAction();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeletePlayerStatisticSegmentAction : public PlayFab::FPlayFabCppBaseModel
@@ -2599,6 +3513,14 @@ namespace AdminModels
             StatisticName(src.StatisticName)
             {}
 
+        FDeletePlayerStatisticSegmentAction(FDeletePlayerStatisticSegmentAction&& src) :
+            FPlayFabCppBaseModel(),
+            StatisticName(MoveTemp(src.StatisticName))
+            {}
+
+        FDeletePlayerStatisticSegmentAction& operator=(const FDeletePlayerStatisticSegmentAction& src) = default;
+        FDeletePlayerStatisticSegmentAction& operator=(FDeletePlayerStatisticSegmentAction&& src) = default;
+
         FDeletePlayerStatisticSegmentAction(const TSharedPtr<FJsonObject>& obj) : FDeletePlayerStatisticSegmentAction()
         {
             readFromValue(obj);
@@ -2607,7 +3529,13 @@ namespace AdminModels
         ~FDeletePlayerStatisticSegmentAction();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEmailNotificationSegmentAction : public PlayFab::FPlayFabCppBaseModel
@@ -2630,6 +3558,15 @@ namespace AdminModels
             EmailTemplateName(src.EmailTemplateName)
             {}
 
+        FEmailNotificationSegmentAction(FEmailNotificationSegmentAction&& src) :
+            FPlayFabCppBaseModel(),
+            EmailTemplateId(MoveTemp(src.EmailTemplateId)),
+            EmailTemplateName(MoveTemp(src.EmailTemplateName))
+            {}
+
+        FEmailNotificationSegmentAction& operator=(const FEmailNotificationSegmentAction& src) = default;
+        FEmailNotificationSegmentAction& operator=(FEmailNotificationSegmentAction&& src) = default;
+
         FEmailNotificationSegmentAction(const TSharedPtr<FJsonObject>& obj) : FEmailNotificationSegmentAction()
         {
             readFromValue(obj);
@@ -2638,7 +3575,13 @@ namespace AdminModels
         ~FEmailNotificationSegmentAction();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FExecuteAzureFunctionSegmentAction : public PlayFab::FPlayFabCppBaseModel
@@ -2666,6 +3609,16 @@ namespace AdminModels
             GenerateFunctionExecutedEvents(src.GenerateFunctionExecutedEvents)
             {}
 
+        FExecuteAzureFunctionSegmentAction(FExecuteAzureFunctionSegmentAction&& src) :
+            FPlayFabCppBaseModel(),
+            AzureFunction(MoveTemp(src.AzureFunction)),
+            FunctionParameter(MoveTemp(src.FunctionParameter)),
+            GenerateFunctionExecutedEvents(MoveTemp(src.GenerateFunctionExecutedEvents))
+            {}
+
+        FExecuteAzureFunctionSegmentAction& operator=(const FExecuteAzureFunctionSegmentAction& src) = default;
+        FExecuteAzureFunctionSegmentAction& operator=(FExecuteAzureFunctionSegmentAction&& src) = default;
+
         FExecuteAzureFunctionSegmentAction(const TSharedPtr<FJsonObject>& obj) : FExecuteAzureFunctionSegmentAction()
         {
             readFromValue(obj);
@@ -2674,7 +3627,13 @@ namespace AdminModels
         ~FExecuteAzureFunctionSegmentAction();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FExecuteCloudScriptSegmentAction : public PlayFab::FPlayFabCppBaseModel
@@ -2707,6 +3666,17 @@ namespace AdminModels
             FunctionParameterJson(src.FunctionParameterJson)
             {}
 
+        FExecuteCloudScriptSegmentAction(FExecuteCloudScriptSegmentAction&& src) :
+            FPlayFabCppBaseModel(),
+            CloudScriptFunction(MoveTemp(src.CloudScriptFunction)),
+            CloudScriptPublishResultsToPlayStream(MoveTemp(src.CloudScriptPublishResultsToPlayStream)),
+            FunctionParameter(MoveTemp(src.FunctionParameter)),
+            FunctionParameterJson(MoveTemp(src.FunctionParameterJson))
+            {}
+
+        FExecuteCloudScriptSegmentAction& operator=(const FExecuteCloudScriptSegmentAction& src) = default;
+        FExecuteCloudScriptSegmentAction& operator=(FExecuteCloudScriptSegmentAction&& src) = default;
+
         FExecuteCloudScriptSegmentAction(const TSharedPtr<FJsonObject>& obj) : FExecuteCloudScriptSegmentAction()
         {
             readFromValue(obj);
@@ -2715,7 +3685,13 @@ namespace AdminModels
         ~FExecuteCloudScriptSegmentAction();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGrantItemSegmentAction : public PlayFab::FPlayFabCppBaseModel
@@ -2743,6 +3719,16 @@ namespace AdminModels
             Quantity(src.Quantity)
             {}
 
+        FGrantItemSegmentAction(FGrantItemSegmentAction&& src) :
+            FPlayFabCppBaseModel(),
+            CatelogId(MoveTemp(src.CatelogId)),
+            ItemId(MoveTemp(src.ItemId)),
+            Quantity(MoveTemp(src.Quantity))
+            {}
+
+        FGrantItemSegmentAction& operator=(const FGrantItemSegmentAction& src) = default;
+        FGrantItemSegmentAction& operator=(FGrantItemSegmentAction&& src) = default;
+
         FGrantItemSegmentAction(const TSharedPtr<FJsonObject>& obj) : FGrantItemSegmentAction()
         {
             readFromValue(obj);
@@ -2751,7 +3737,13 @@ namespace AdminModels
         ~FGrantItemSegmentAction();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGrantVirtualCurrencySegmentAction : public PlayFab::FPlayFabCppBaseModel
@@ -2774,6 +3766,15 @@ namespace AdminModels
             CurrencyCode(src.CurrencyCode)
             {}
 
+        FGrantVirtualCurrencySegmentAction(FGrantVirtualCurrencySegmentAction&& src) :
+            FPlayFabCppBaseModel(),
+            Amount(MoveTemp(src.Amount)),
+            CurrencyCode(MoveTemp(src.CurrencyCode))
+            {}
+
+        FGrantVirtualCurrencySegmentAction& operator=(const FGrantVirtualCurrencySegmentAction& src) = default;
+        FGrantVirtualCurrencySegmentAction& operator=(FGrantVirtualCurrencySegmentAction&& src) = default;
+
         FGrantVirtualCurrencySegmentAction(const TSharedPtr<FJsonObject>& obj) : FGrantVirtualCurrencySegmentAction()
         {
             readFromValue(obj);
@@ -2782,7 +3783,13 @@ namespace AdminModels
         ~FGrantVirtualCurrencySegmentAction();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FIncrementPlayerStatisticSegmentAction : public PlayFab::FPlayFabCppBaseModel
@@ -2805,6 +3812,15 @@ namespace AdminModels
             StatisticName(src.StatisticName)
             {}
 
+        FIncrementPlayerStatisticSegmentAction(FIncrementPlayerStatisticSegmentAction&& src) :
+            FPlayFabCppBaseModel(),
+            IncrementValue(MoveTemp(src.IncrementValue)),
+            StatisticName(MoveTemp(src.StatisticName))
+            {}
+
+        FIncrementPlayerStatisticSegmentAction& operator=(const FIncrementPlayerStatisticSegmentAction& src) = default;
+        FIncrementPlayerStatisticSegmentAction& operator=(FIncrementPlayerStatisticSegmentAction&& src) = default;
+
         FIncrementPlayerStatisticSegmentAction(const TSharedPtr<FJsonObject>& obj) : FIncrementPlayerStatisticSegmentAction()
         {
             readFromValue(obj);
@@ -2813,7 +3829,13 @@ namespace AdminModels
         ~FIncrementPlayerStatisticSegmentAction();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPushNotificationSegmentAction : public PlayFab::FPlayFabCppBaseModel
@@ -2831,6 +3853,14 @@ namespace AdminModels
             PushNotificationTemplateId(src.PushNotificationTemplateId)
             {}
 
+        FPushNotificationSegmentAction(FPushNotificationSegmentAction&& src) :
+            FPlayFabCppBaseModel(),
+            PushNotificationTemplateId(MoveTemp(src.PushNotificationTemplateId))
+            {}
+
+        FPushNotificationSegmentAction& operator=(const FPushNotificationSegmentAction& src) = default;
+        FPushNotificationSegmentAction& operator=(FPushNotificationSegmentAction&& src) = default;
+
         FPushNotificationSegmentAction(const TSharedPtr<FJsonObject>& obj) : FPushNotificationSegmentAction()
         {
             readFromValue(obj);
@@ -2839,7 +3869,13 @@ namespace AdminModels
         ~FPushNotificationSegmentAction();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSegmentTrigger : public PlayFab::FPlayFabCppBaseModel
@@ -2890,18 +3926,35 @@ namespace AdminModels
 
         FSegmentTrigger(const FSegmentTrigger& src) :
             FPlayFabCppBaseModel(),
-            BanPlayerAction(src.BanPlayerAction.IsValid() ? MakeShareable(new FBanPlayerSegmentAction(*src.BanPlayerAction)) : nullptr),
-            DeletePlayerAction(src.DeletePlayerAction.IsValid() ? MakeShareable(new FDeletePlayerSegmentAction(*src.DeletePlayerAction)) : nullptr),
-            DeletePlayerStatisticAction(src.DeletePlayerStatisticAction.IsValid() ? MakeShareable(new FDeletePlayerStatisticSegmentAction(*src.DeletePlayerStatisticAction)) : nullptr),
-            EmailNotificationAction(src.EmailNotificationAction.IsValid() ? MakeShareable(new FEmailNotificationSegmentAction(*src.EmailNotificationAction)) : nullptr),
-            ExecuteAzureFunctionAction(src.ExecuteAzureFunctionAction.IsValid() ? MakeShareable(new FExecuteAzureFunctionSegmentAction(*src.ExecuteAzureFunctionAction)) : nullptr),
-            ExecuteCloudScriptAction(src.ExecuteCloudScriptAction.IsValid() ? MakeShareable(new FExecuteCloudScriptSegmentAction(*src.ExecuteCloudScriptAction)) : nullptr),
-            GrantItemAction(src.GrantItemAction.IsValid() ? MakeShareable(new FGrantItemSegmentAction(*src.GrantItemAction)) : nullptr),
-            GrantVirtualCurrencyAction(src.GrantVirtualCurrencyAction.IsValid() ? MakeShareable(new FGrantVirtualCurrencySegmentAction(*src.GrantVirtualCurrencyAction)) : nullptr),
-            IncrementPlayerStatisticAction(src.IncrementPlayerStatisticAction.IsValid() ? MakeShareable(new FIncrementPlayerStatisticSegmentAction(*src.IncrementPlayerStatisticAction)) : nullptr),
-            PushNotificationAction(src.PushNotificationAction.IsValid() ? MakeShareable(new FPushNotificationSegmentAction(*src.PushNotificationAction)) : nullptr)
+            BanPlayerAction(src.BanPlayerAction.IsValid() ? TSharedPtr<FBanPlayerSegmentAction>(MakeShared<FBanPlayerSegmentAction>(*src.BanPlayerAction)) : nullptr),
+            DeletePlayerAction(src.DeletePlayerAction.IsValid() ? TSharedPtr<FDeletePlayerSegmentAction>(MakeShared<FDeletePlayerSegmentAction>(*src.DeletePlayerAction)) : nullptr),
+            DeletePlayerStatisticAction(src.DeletePlayerStatisticAction.IsValid() ? TSharedPtr<FDeletePlayerStatisticSegmentAction>(MakeShared<FDeletePlayerStatisticSegmentAction>(*src.DeletePlayerStatisticAction)) : nullptr),
+            EmailNotificationAction(src.EmailNotificationAction.IsValid() ? TSharedPtr<FEmailNotificationSegmentAction>(MakeShared<FEmailNotificationSegmentAction>(*src.EmailNotificationAction)) : nullptr),
+            ExecuteAzureFunctionAction(src.ExecuteAzureFunctionAction.IsValid() ? TSharedPtr<FExecuteAzureFunctionSegmentAction>(MakeShared<FExecuteAzureFunctionSegmentAction>(*src.ExecuteAzureFunctionAction)) : nullptr),
+            ExecuteCloudScriptAction(src.ExecuteCloudScriptAction.IsValid() ? TSharedPtr<FExecuteCloudScriptSegmentAction>(MakeShared<FExecuteCloudScriptSegmentAction>(*src.ExecuteCloudScriptAction)) : nullptr),
+            GrantItemAction(src.GrantItemAction.IsValid() ? TSharedPtr<FGrantItemSegmentAction>(MakeShared<FGrantItemSegmentAction>(*src.GrantItemAction)) : nullptr),
+            GrantVirtualCurrencyAction(src.GrantVirtualCurrencyAction.IsValid() ? TSharedPtr<FGrantVirtualCurrencySegmentAction>(MakeShared<FGrantVirtualCurrencySegmentAction>(*src.GrantVirtualCurrencyAction)) : nullptr),
+            IncrementPlayerStatisticAction(src.IncrementPlayerStatisticAction.IsValid() ? TSharedPtr<FIncrementPlayerStatisticSegmentAction>(MakeShared<FIncrementPlayerStatisticSegmentAction>(*src.IncrementPlayerStatisticAction)) : nullptr),
+            PushNotificationAction(src.PushNotificationAction.IsValid() ? TSharedPtr<FPushNotificationSegmentAction>(MakeShared<FPushNotificationSegmentAction>(*src.PushNotificationAction)) : nullptr)
+            {}
+
+        FSegmentTrigger(FSegmentTrigger&& src) :
+            FPlayFabCppBaseModel(),
+            BanPlayerAction(MoveTemp(src.BanPlayerAction)),
+            DeletePlayerAction(MoveTemp(src.DeletePlayerAction)),
+            DeletePlayerStatisticAction(MoveTemp(src.DeletePlayerStatisticAction)),
+            EmailNotificationAction(MoveTemp(src.EmailNotificationAction)),
+            ExecuteAzureFunctionAction(MoveTemp(src.ExecuteAzureFunctionAction)),
+            ExecuteCloudScriptAction(MoveTemp(src.ExecuteCloudScriptAction)),
+            GrantItemAction(MoveTemp(src.GrantItemAction)),
+            GrantVirtualCurrencyAction(MoveTemp(src.GrantVirtualCurrencyAction)),
+            IncrementPlayerStatisticAction(MoveTemp(src.IncrementPlayerStatisticAction)),
+            PushNotificationAction(MoveTemp(src.PushNotificationAction))
             {}
 
+        FSegmentTrigger& operator=(const FSegmentTrigger& src) = default;
+        FSegmentTrigger& operator=(FSegmentTrigger&& src) = default;
+
         FSegmentTrigger(const TSharedPtr<FJsonObject>& obj) : FSegmentTrigger()
         {
             readFromValue(obj);
@@ -2910,7 +3963,13 @@ namespace AdminModels
         ~FSegmentTrigger();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FFirstLoginDateSegmentFilter : public PlayFab::FPlayFabCppBaseModel
@@ -2933,6 +3992,15 @@ namespace AdminModels
             LogInDate(src.LogInDate)
             {}
 
+        FFirstLoginDateSegmentFilter(FFirstLoginDateSegmentFilter&& src) :
+            FPlayFabCppBaseModel(),
+            Comparison(MoveTemp(src.Comparison)),
+            LogInDate(MoveTemp(src.LogInDate))
+            {}
+
+        FFirstLoginDateSegmentFilter& operator=(const FFirstLoginDateSegmentFilter& src) = default;
+        FFirstLoginDateSegmentFilter& operator=(FFirstLoginDateSegmentFilter&& src) = default;
+
         FFirstLoginDateSegmentFilter(const TSharedPtr<FJsonObject>& obj) : FFirstLoginDateSegmentFilter()
         {
             readFromValue(obj);
@@ -2941,7 +4009,13 @@ namespace AdminModels
         ~FFirstLoginDateSegmentFilter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FFirstLoginTimespanSegmentFilter : public PlayFab::FPlayFabCppBaseModel
@@ -2964,6 +4038,15 @@ namespace AdminModels
             DurationInMinutes(src.DurationInMinutes)
             {}
 
+        FFirstLoginTimespanSegmentFilter(FFirstLoginTimespanSegmentFilter&& src) :
+            FPlayFabCppBaseModel(),
+            Comparison(MoveTemp(src.Comparison)),
+            DurationInMinutes(MoveTemp(src.DurationInMinutes))
+            {}
+
+        FFirstLoginTimespanSegmentFilter& operator=(const FFirstLoginTimespanSegmentFilter& src) = default;
+        FFirstLoginTimespanSegmentFilter& operator=(FFirstLoginTimespanSegmentFilter&& src) = default;
+
         FFirstLoginTimespanSegmentFilter(const TSharedPtr<FJsonObject>& obj) : FFirstLoginTimespanSegmentFilter()
         {
             readFromValue(obj);
@@ -2972,7 +4055,13 @@ namespace AdminModels
         ~FFirstLoginTimespanSegmentFilter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLastLoginDateSegmentFilter : public PlayFab::FPlayFabCppBaseModel
@@ -2995,6 +4084,15 @@ namespace AdminModels
             LogInDate(src.LogInDate)
             {}
 
+        FLastLoginDateSegmentFilter(FLastLoginDateSegmentFilter&& src) :
+            FPlayFabCppBaseModel(),
+            Comparison(MoveTemp(src.Comparison)),
+            LogInDate(MoveTemp(src.LogInDate))
+            {}
+
+        FLastLoginDateSegmentFilter& operator=(const FLastLoginDateSegmentFilter& src) = default;
+        FLastLoginDateSegmentFilter& operator=(FLastLoginDateSegmentFilter&& src) = default;
+
         FLastLoginDateSegmentFilter(const TSharedPtr<FJsonObject>& obj) : FLastLoginDateSegmentFilter()
         {
             readFromValue(obj);
@@ -3003,7 +4101,13 @@ namespace AdminModels
         ~FLastLoginDateSegmentFilter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLastLoginTimespanSegmentFilter : public PlayFab::FPlayFabCppBaseModel
@@ -3026,6 +4130,15 @@ namespace AdminModels
             DurationInMinutes(src.DurationInMinutes)
             {}
 
+        FLastLoginTimespanSegmentFilter(FLastLoginTimespanSegmentFilter&& src) :
+            FPlayFabCppBaseModel(),
+            Comparison(MoveTemp(src.Comparison)),
+            DurationInMinutes(MoveTemp(src.DurationInMinutes))
+            {}
+
+        FLastLoginTimespanSegmentFilter& operator=(const FLastLoginTimespanSegmentFilter& src) = default;
+        FLastLoginTimespanSegmentFilter& operator=(FLastLoginTimespanSegmentFilter&& src) = default;
+
         FLastLoginTimespanSegmentFilter(const TSharedPtr<FJsonObject>& obj) : FLastLoginTimespanSegmentFilter()
         {
             readFromValue(obj);
@@ -3034,7 +4147,13 @@ namespace AdminModels
         ~FLastLoginTimespanSegmentFilter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum SegmentLoginIdentityProvider
@@ -3063,6 +4182,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeSegmentLoginIdentityProviderEnumJSON(SegmentLoginIdentityProvider enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeSegmentLoginIdentityProviderEnumJSON(SegmentLoginIdentityProvider enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API SegmentLoginIdentityProvider readSegmentLoginIdentityProviderFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API SegmentLoginIdentityProvider readSegmentLoginIdentityProviderFromValue(const FString& value);
 
@@ -3081,6 +4201,14 @@ namespace AdminModels
             LoginProvider(src.LoginProvider)
             {}
 
+        FLinkedUserAccountSegmentFilter(FLinkedUserAccountSegmentFilter&& src) :
+            FPlayFabCppBaseModel(),
+            LoginProvider(MoveTemp(src.LoginProvider))
+            {}
+
+        FLinkedUserAccountSegmentFilter& operator=(const FLinkedUserAccountSegmentFilter& src) = default;
+        FLinkedUserAccountSegmentFilter& operator=(FLinkedUserAccountSegmentFilter&& src) = default;
+
         FLinkedUserAccountSegmentFilter(const TSharedPtr<FJsonObject>& obj) : FLinkedUserAccountSegmentFilter()
         {
             readFromValue(obj);
@@ -3089,7 +4217,13 @@ namespace AdminModels
         ~FLinkedUserAccountSegmentFilter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkedUserAccountHasEmailSegmentFilter : public PlayFab::FPlayFabCppBaseModel
@@ -3112,6 +4246,15 @@ namespace AdminModels
             LoginProvider(src.LoginProvider)
             {}
 
+        FLinkedUserAccountHasEmailSegmentFilter(FLinkedUserAccountHasEmailSegmentFilter&& src) :
+            FPlayFabCppBaseModel(),
+            Comparison(MoveTemp(src.Comparison)),
+            LoginProvider(MoveTemp(src.LoginProvider))
+            {}
+
+        FLinkedUserAccountHasEmailSegmentFilter& operator=(const FLinkedUserAccountHasEmailSegmentFilter& src) = default;
+        FLinkedUserAccountHasEmailSegmentFilter& operator=(FLinkedUserAccountHasEmailSegmentFilter&& src) = default;
+
         FLinkedUserAccountHasEmailSegmentFilter(const TSharedPtr<FJsonObject>& obj) : FLinkedUserAccountHasEmailSegmentFilter()
         {
             readFromValue(obj);
@@ -3120,7 +4263,13 @@ namespace AdminModels
         ~FLinkedUserAccountHasEmailSegmentFilter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum SegmentCountryCode
@@ -3377,6 +4526,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeSegmentCountryCodeEnumJSON(SegmentCountryCode enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeSegmentCountryCodeEnumJSON(SegmentCountryCode enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API SegmentCountryCode readSegmentCountryCodeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API SegmentCountryCode readSegmentCountryCodeFromValue(const FString& value);
 
@@ -3395,6 +4545,14 @@ namespace AdminModels
             CountryCode(src.CountryCode)
             {}
 
+        FLocationSegmentFilter(FLocationSegmentFilter&& src) :
+            FPlayFabCppBaseModel(),
+            CountryCode(MoveTemp(src.CountryCode))
+            {}
+
+        FLocationSegmentFilter& operator=(const FLocationSegmentFilter& src) = default;
+        FLocationSegmentFilter& operator=(FLocationSegmentFilter&& src) = default;
+
         FLocationSegmentFilter(const TSharedPtr<FJsonObject>& obj) : FLocationSegmentFilter()
         {
             readFromValue(obj);
@@ -3403,7 +4561,13 @@ namespace AdminModels
         ~FLocationSegmentFilter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum SegmentPushNotificationDevicePlatform
@@ -3413,6 +4577,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeSegmentPushNotificationDevicePlatformEnumJSON(SegmentPushNotificationDevicePlatform enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeSegmentPushNotificationDevicePlatformEnumJSON(SegmentPushNotificationDevicePlatform enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API SegmentPushNotificationDevicePlatform readSegmentPushNotificationDevicePlatformFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API SegmentPushNotificationDevicePlatform readSegmentPushNotificationDevicePlatformFromValue(const FString& value);
 
@@ -3431,6 +4596,14 @@ namespace AdminModels
             PushNotificationDevicePlatform(src.PushNotificationDevicePlatform)
             {}
 
+        FPushNotificationSegmentFilter(FPushNotificationSegmentFilter&& src) :
+            FPlayFabCppBaseModel(),
+            PushNotificationDevicePlatform(MoveTemp(src.PushNotificationDevicePlatform))
+            {}
+
+        FPushNotificationSegmentFilter& operator=(const FPushNotificationSegmentFilter& src) = default;
+        FPushNotificationSegmentFilter& operator=(FPushNotificationSegmentFilter&& src) = default;
+
         FPushNotificationSegmentFilter(const TSharedPtr<FJsonObject>& obj) : FPushNotificationSegmentFilter()
         {
             readFromValue(obj);
@@ -3439,7 +4612,13 @@ namespace AdminModels
         ~FPushNotificationSegmentFilter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStatisticSegmentFilter : public PlayFab::FPlayFabCppBaseModel
@@ -3477,6 +4656,18 @@ namespace AdminModels
             Version(src.Version)
             {}
 
+        FStatisticSegmentFilter(FStatisticSegmentFilter&& src) :
+            FPlayFabCppBaseModel(),
+            Comparison(MoveTemp(src.Comparison)),
+            FilterValue(MoveTemp(src.FilterValue)),
+            Name(MoveTemp(src.Name)),
+            UseCurrentVersion(MoveTemp(src.UseCurrentVersion)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FStatisticSegmentFilter& operator=(const FStatisticSegmentFilter& src) = default;
+        FStatisticSegmentFilter& operator=(FStatisticSegmentFilter&& src) = default;
+
         FStatisticSegmentFilter(const TSharedPtr<FJsonObject>& obj) : FStatisticSegmentFilter()
         {
             readFromValue(obj);
@@ -3485,7 +4676,13 @@ namespace AdminModels
         ~FStatisticSegmentFilter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FTagSegmentFilter : public PlayFab::FPlayFabCppBaseModel
@@ -3508,6 +4705,15 @@ namespace AdminModels
             TagValue(src.TagValue)
             {}
 
+        FTagSegmentFilter(FTagSegmentFilter&& src) :
+            FPlayFabCppBaseModel(),
+            Comparison(MoveTemp(src.Comparison)),
+            TagValue(MoveTemp(src.TagValue))
+            {}
+
+        FTagSegmentFilter& operator=(const FTagSegmentFilter& src) = default;
+        FTagSegmentFilter& operator=(FTagSegmentFilter&& src) = default;
+
         FTagSegmentFilter(const TSharedPtr<FJsonObject>& obj) : FTagSegmentFilter()
         {
             readFromValue(obj);
@@ -3516,7 +4722,13 @@ namespace AdminModels
         ~FTagSegmentFilter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FTotalValueToDateInUSDSegmentFilter : public PlayFab::FPlayFabCppBaseModel
@@ -3539,6 +4751,15 @@ namespace AdminModels
             Comparison(src.Comparison)
             {}
 
+        FTotalValueToDateInUSDSegmentFilter(FTotalValueToDateInUSDSegmentFilter&& src) :
+            FPlayFabCppBaseModel(),
+            Amount(MoveTemp(src.Amount)),
+            Comparison(MoveTemp(src.Comparison))
+            {}
+
+        FTotalValueToDateInUSDSegmentFilter& operator=(const FTotalValueToDateInUSDSegmentFilter& src) = default;
+        FTotalValueToDateInUSDSegmentFilter& operator=(FTotalValueToDateInUSDSegmentFilter&& src) = default;
+
         FTotalValueToDateInUSDSegmentFilter(const TSharedPtr<FJsonObject>& obj) : FTotalValueToDateInUSDSegmentFilter()
         {
             readFromValue(obj);
@@ -3547,7 +4768,13 @@ namespace AdminModels
         ~FTotalValueToDateInUSDSegmentFilter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserOriginationSegmentFilter : public PlayFab::FPlayFabCppBaseModel
@@ -3565,6 +4792,14 @@ namespace AdminModels
             LoginProvider(src.LoginProvider)
             {}
 
+        FUserOriginationSegmentFilter(FUserOriginationSegmentFilter&& src) :
+            FPlayFabCppBaseModel(),
+            LoginProvider(MoveTemp(src.LoginProvider))
+            {}
+
+        FUserOriginationSegmentFilter& operator=(const FUserOriginationSegmentFilter& src) = default;
+        FUserOriginationSegmentFilter& operator=(FUserOriginationSegmentFilter&& src) = default;
+
         FUserOriginationSegmentFilter(const TSharedPtr<FJsonObject>& obj) : FUserOriginationSegmentFilter()
         {
             readFromValue(obj);
@@ -3573,7 +4808,13 @@ namespace AdminModels
         ~FUserOriginationSegmentFilter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum SegmentCurrency
@@ -3743,6 +4984,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeSegmentCurrencyEnumJSON(SegmentCurrency enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeSegmentCurrencyEnumJSON(SegmentCurrency enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API SegmentCurrency readSegmentCurrencyFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API SegmentCurrency readSegmentCurrencyFromValue(const FString& value);
 
@@ -3771,6 +5013,16 @@ namespace AdminModels
             Currency(src.Currency)
             {}
 
+        FValueToDateSegmentFilter(FValueToDateSegmentFilter&& src) :
+            FPlayFabCppBaseModel(),
+            Amount(MoveTemp(src.Amount)),
+            Comparison(MoveTemp(src.Comparison)),
+            Currency(MoveTemp(src.Currency))
+            {}
+
+        FValueToDateSegmentFilter& operator=(const FValueToDateSegmentFilter& src) = default;
+        FValueToDateSegmentFilter& operator=(FValueToDateSegmentFilter&& src) = default;
+
         FValueToDateSegmentFilter(const TSharedPtr<FJsonObject>& obj) : FValueToDateSegmentFilter()
         {
             readFromValue(obj);
@@ -3779,7 +5031,13 @@ namespace AdminModels
         ~FValueToDateSegmentFilter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FVirtualCurrencyBalanceSegmentFilter : public PlayFab::FPlayFabCppBaseModel
@@ -3807,6 +5065,16 @@ namespace AdminModels
             CurrencyCode(src.CurrencyCode)
             {}
 
+        FVirtualCurrencyBalanceSegmentFilter(FVirtualCurrencyBalanceSegmentFilter&& src) :
+            FPlayFabCppBaseModel(),
+            Amount(MoveTemp(src.Amount)),
+            Comparison(MoveTemp(src.Comparison)),
+            CurrencyCode(MoveTemp(src.CurrencyCode))
+            {}
+
+        FVirtualCurrencyBalanceSegmentFilter& operator=(const FVirtualCurrencyBalanceSegmentFilter& src) = default;
+        FVirtualCurrencyBalanceSegmentFilter& operator=(FVirtualCurrencyBalanceSegmentFilter&& src) = default;
+
         FVirtualCurrencyBalanceSegmentFilter(const TSharedPtr<FJsonObject>& obj) : FVirtualCurrencyBalanceSegmentFilter()
         {
             readFromValue(obj);
@@ -3815,7 +5083,13 @@ namespace AdminModels
         ~FVirtualCurrencyBalanceSegmentFilter();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSegmentAndDefinition : public PlayFab::FPlayFabCppBaseModel
@@ -3890,23 +5164,46 @@ namespace AdminModels
 
         FSegmentAndDefinition(const FSegmentAndDefinition& src) :
             FPlayFabCppBaseModel(),
-            AdCampaignFilter(src.AdCampaignFilter.IsValid() ? MakeShareable(new FAdCampaignSegmentFilter(*src.AdCampaignFilter)) : nullptr),
-            AllPlayersFilter(src.AllPlayersFilter.IsValid() ? MakeShareable(new FAllPlayersSegmentFilter(*src.AllPlayersFilter)) : nullptr),
-            FirstLoginDateFilter(src.FirstLoginDateFilter.IsValid() ? MakeShareable(new FFirstLoginDateSegmentFilter(*src.FirstLoginDateFilter)) : nullptr),
-            FirstLoginFilter(src.FirstLoginFilter.IsValid() ? MakeShareable(new FFirstLoginTimespanSegmentFilter(*src.FirstLoginFilter)) : nullptr),
-            LastLoginDateFilter(src.LastLoginDateFilter.IsValid() ? MakeShareable(new FLastLoginDateSegmentFilter(*src.LastLoginDateFilter)) : nullptr),
-            LastLoginFilter(src.LastLoginFilter.IsValid() ? MakeShareable(new FLastLoginTimespanSegmentFilter(*src.LastLoginFilter)) : nullptr),
-            LinkedUserAccountFilter(src.LinkedUserAccountFilter.IsValid() ? MakeShareable(new FLinkedUserAccountSegmentFilter(*src.LinkedUserAccountFilter)) : nullptr),
-            LinkedUserAccountHasEmailFilter(src.LinkedUserAccountHasEmailFilter.IsValid() ? MakeShareable(new FLinkedUserAccountHasEmailSegmentFilter(*src.LinkedUserAccountHasEmailFilter)) : nullptr),
-            LocationFilter(src.LocationFilter.IsValid() ? MakeShareable(new FLocationSegmentFilter(*src.LocationFilter)) : nullptr),
-            PushNotificationFilter(src.PushNotificationFilter.IsValid() ? MakeShareable(new FPushNotificationSegmentFilter(*src.PushNotificationFilter)) : nullptr),
-            StatisticFilter(src.StatisticFilter.IsValid() ? MakeShareable(new FStatisticSegmentFilter(*src.StatisticFilter)) : nullptr),
-            TagFilter(src.TagFilter.IsValid() ? MakeShareable(new FTagSegmentFilter(*src.TagFilter)) : nullptr),
-            TotalValueToDateInUSDFilter(src.TotalValueToDateInUSDFilter.IsValid() ? MakeShareable(new FTotalValueToDateInUSDSegmentFilter(*src.TotalValueToDateInUSDFilter)) : nullptr),
-            UserOriginationFilter(src.UserOriginationFilter.IsValid() ? MakeShareable(new FUserOriginationSegmentFilter(*src.UserOriginationFilter)) : nullptr),
-            ValueToDateFilter(src.ValueToDateFilter.IsValid() ? MakeShareable(new FValueToDateSegmentFilter(*src.ValueToDateFilter)) : nullptr),
-            VirtualCurrencyBalanceFilter(src.VirtualCurrencyBalanceFilter.IsValid() ? MakeShareable(new FVirtualCurrencyBalanceSegmentFilter(*src.VirtualCurrencyBalanceFilter)) : nullptr)
-            {}
+            AdCampaignFilter(src.AdCampaignFilter.IsValid() ? TSharedPtr<FAdCampaignSegmentFilter>(MakeShared<FAdCampaignSegmentFilter>(*src.AdCampaignFilter)) : nullptr),
+            AllPlayersFilter(src.AllPlayersFilter.IsValid() ? TSharedPtr<FAllPlayersSegmentFilter>(MakeShared<FAllPlayersSegmentFilter>(*src.AllPlayersFilter)) : nullptr),
+            FirstLoginDateFilter(src.FirstLoginDateFilter.IsValid() ? TSharedPtr<FFirstLoginDateSegmentFilter>(MakeShared<FFirstLoginDateSegmentFilter>(*src.FirstLoginDateFilter)) : nullptr),
+            FirstLoginFilter(src.FirstLoginFilter.IsValid() ? TSharedPtr<FFirstLoginTimespanSegmentFilter>(MakeShared<FFirstLoginTimespanSegmentFilter>(*src.FirstLoginFilter)) : nullptr),
+            LastLoginDateFilter(src.LastLoginDateFilter.IsValid() ? TSharedPtr<FLastLoginDateSegmentFilter>(MakeShared<FLastLoginDateSegmentFilter>(*src.LastLoginDateFilter)) : nullptr),
+            LastLoginFilter(src.LastLoginFilter.IsValid() ? TSharedPtr<FLastLoginTimespanSegmentFilter>(MakeShared<FLastLoginTimespanSegmentFilter>(*src.LastLoginFilter)) : nullptr),
+            LinkedUserAccountFilter(src.LinkedUserAccountFilter.IsValid() ? TSharedPtr<FLinkedUserAccountSegmentFilter>(MakeShared<FLinkedUserAccountSegmentFilter>(*src.LinkedUserAccountFilter)) : nullptr),
+            LinkedUserAccountHasEmailFilter(src.LinkedUserAccountHasEmailFilter.IsValid() ? TSharedPtr<FLinkedUserAccountHasEmailSegmentFilter>(MakeShared<FLinkedUserAccountHasEmailSegmentFilter>(*src.LinkedUserAccountHasEmailFilter)) : nullptr),
+            LocationFilter(src.LocationFilter.IsValid() ? TSharedPtr<FLocationSegmentFilter>(MakeShared<FLocationSegmentFilter>(*src.LocationFilter)) : nullptr),
+            PushNotificationFilter(src.PushNotificationFilter.IsValid() ? TSharedPtr<FPushNotificationSegmentFilter>(MakeShared<FPushNotificationSegmentFilter>(*src.PushNotificationFilter)) : nullptr),
+            StatisticFilter(src.StatisticFilter.IsValid() ? TSharedPtr<FStatisticSegmentFilter>(MakeShared<FStatisticSegmentFilter>(*src.StatisticFilter)) : nullptr),
+            TagFilter(src.TagFilter.IsValid() ? TSharedPtr<FTagSegmentFilter>(MakeShared<FTagSegmentFilter>(*src.TagFilter)) : nullptr),
+            TotalValueToDateInUSDFilter(src.TotalValueToDateInUSDFilter.IsValid() ? TSharedPtr<FTotalValueToDateInUSDSegmentFilter>(MakeShared<FTotalValueToDateInUSDSegmentFilter>(*src.TotalValueToDateInUSDFilter)) : nullptr),
+            UserOriginationFilter(src.UserOriginationFilter.IsValid() ? TSharedPtr<FUserOriginationSegmentFilter>(MakeShared<FUserOriginationSegmentFilter>(*src.UserOriginationFilter)) : nullptr),
+            ValueToDateFilter(src.ValueToDateFilter.IsValid() ? TSharedPtr<FValueToDateSegmentFilter>(MakeShared<FValueToDateSegmentFilter>(*src.ValueToDateFilter)) : nullptr),
+            VirtualCurrencyBalanceFilter(src.VirtualCurrencyBalanceFilter.IsValid() ? TSharedPtr<FVirtualCurrencyBalanceSegmentFilter>(MakeShared<FVirtualCurrencyBalanceSegmentFilter>(*src.VirtualCurrencyBalanceFilter)) : nullptr)
+            {}
+
+        FSegmentAndDefinition(FSegmentAndDefinition&& src) :
+            FPlayFabCppBaseModel(),
+            AdCampaignFilter(MoveTemp(src.AdCampaignFilter)),
+            AllPlayersFilter(MoveTemp(src.AllPlayersFilter)),
+            FirstLoginDateFilter(MoveTemp(src.FirstLoginDateFilter)),
+            FirstLoginFilter(MoveTemp(src.FirstLoginFilter)),
+            LastLoginDateFilter(MoveTemp(src.LastLoginDateFilter)),
+            LastLoginFilter(MoveTemp(src.LastLoginFilter)),
+            LinkedUserAccountFilter(MoveTemp(src.LinkedUserAccountFilter)),
+            LinkedUserAccountHasEmailFilter(MoveTemp(src.LinkedUserAccountHasEmailFilter)),
+            LocationFilter(MoveTemp(src.LocationFilter)),
+            PushNotificationFilter(MoveTemp(src.PushNotificationFilter)),
+            StatisticFilter(MoveTemp(src.StatisticFilter)),
+            TagFilter(MoveTemp(src.TagFilter)),
+            TotalValueToDateInUSDFilter(MoveTemp(src.TotalValueToDateInUSDFilter)),
+            UserOriginationFilter(MoveTemp(src.UserOriginationFilter)),
+            ValueToDateFilter(MoveTemp(src.ValueToDateFilter)),
+            VirtualCurrencyBalanceFilter(MoveTemp(src.VirtualCurrencyBalanceFilter))
+            {}
+
+        FSegmentAndDefinition& operator=(const FSegmentAndDefinition& src) = default;
+        FSegmentAndDefinition& operator=(FSegmentAndDefinition&& src) = default;
 
         FSegmentAndDefinition(const TSharedPtr<FJsonObject>& obj) : FSegmentAndDefinition()
         {
@@ -3916,7 +5213,13 @@ namespace AdminModels
         ~FSegmentAndDefinition();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSegmentOrDefinition : public PlayFab::FPlayFabCppBaseModel
@@ -3933,6 +5236,14 @@ namespace AdminModels
             SegmentAndDefinitions(src.SegmentAndDefinitions)
             {}
 
+        FSegmentOrDefinition(FSegmentOrDefinition&& src) :
+            FPlayFabCppBaseModel(),
+            SegmentAndDefinitions(MoveTemp(src.SegmentAndDefinitions))
+            {}
+
+        FSegmentOrDefinition& operator=(const FSegmentOrDefinition& src) = default;
+        FSegmentOrDefinition& operator=(FSegmentOrDefinition&& src) = default;
+
         FSegmentOrDefinition(const TSharedPtr<FJsonObject>& obj) : FSegmentOrDefinition()
         {
             readFromValue(obj);
@@ -3941,7 +5252,13 @@ namespace AdminModels
         ~FSegmentOrDefinition();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSegmentModel : public PlayFab::FPlayFabCppBaseModel
@@ -3986,6 +5303,20 @@ namespace AdminModels
             SegmentOrDefinitions(src.SegmentOrDefinitions)
             {}
 
+        FSegmentModel(FSegmentModel&& src) :
+            FPlayFabCppBaseModel(),
+            Description(MoveTemp(src.Description)),
+            EnteredSegmentActions(MoveTemp(src.EnteredSegmentActions)),
+            LastUpdateTime(MoveTemp(src.LastUpdateTime)),
+            LeftSegmentActions(MoveTemp(src.LeftSegmentActions)),
+            Name(MoveTemp(src.Name)),
+            SegmentId(MoveTemp(src.SegmentId)),
+            SegmentOrDefinitions(MoveTemp(src.SegmentOrDefinitions))
+            {}
+
+        FSegmentModel& operator=(const FSegmentModel& src) = default;
+        FSegmentModel& operator=(FSegmentModel&& src) = default;
+
         FSegmentModel(const TSharedPtr<FJsonObject>& obj) : FSegmentModel()
         {
             readFromValue(obj);
@@ -3994,7 +5325,13 @@ namespace AdminModels
         ~FSegmentModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateSegmentRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4012,6 +5349,14 @@ namespace AdminModels
             pfSegmentModel(src.pfSegmentModel)
             {}
 
+        FCreateSegmentRequest(FCreateSegmentRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            pfSegmentModel(MoveTemp(src.pfSegmentModel))
+            {}
+
+        FCreateSegmentRequest& operator=(const FCreateSegmentRequest& src) = default;
+        FCreateSegmentRequest& operator=(FCreateSegmentRequest&& src) = default;
+
         FCreateSegmentRequest(const TSharedPtr<FJsonObject>& obj) : FCreateSegmentRequest()
         {
             readFromValue(obj);
@@ -4020,7 +5365,13 @@ namespace AdminModels
         ~FCreateSegmentRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateSegmentResponse : public PlayFab::FPlayFabCppResultCommon
@@ -4043,6 +5394,15 @@ namespace AdminModels
             SegmentId(src.SegmentId)
             {}
 
+        FCreateSegmentResponse(FCreateSegmentResponse&& src) :
+            FPlayFabCppResultCommon(),
+            ErrorMessage(MoveTemp(src.ErrorMessage)),
+            SegmentId(MoveTemp(src.SegmentId))
+            {}
+
+        FCreateSegmentResponse& operator=(const FCreateSegmentResponse& src) = default;
+        FCreateSegmentResponse& operator=(FCreateSegmentResponse&& src) = default;
+
         FCreateSegmentResponse(const TSharedPtr<FJsonObject>& obj) : FCreateSegmentResponse()
         {
             readFromValue(obj);
@@ -4051,7 +5411,13 @@ namespace AdminModels
         ~FCreateSegmentResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateTaskResult : public PlayFab::FPlayFabCppResultCommon
@@ -4069,6 +5435,14 @@ namespace AdminModels
             TaskId(src.TaskId)
             {}
 
+        FCreateTaskResult(FCreateTaskResult&& src) :
+            FPlayFabCppResultCommon(),
+            TaskId(MoveTemp(src.TaskId))
+            {}
+
+        FCreateTaskResult& operator=(const FCreateTaskResult& src) = default;
+        FCreateTaskResult& operator=(FCreateTaskResult&& src) = default;
+
         FCreateTaskResult(const TSharedPtr<FJsonObject>& obj) : FCreateTaskResult()
         {
             readFromValue(obj);
@@ -4077,7 +5451,13 @@ namespace AdminModels
         ~FCreateTaskResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum Currency
@@ -4247,6 +5627,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeCurrencyEnumJSON(Currency enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeCurrencyEnumJSON(Currency enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API Currency readCurrencyFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API Currency readCurrencyFromValue(const FString& value);
 
@@ -4265,6 +5646,14 @@ namespace AdminModels
             Key(src.Key)
             {}
 
+        FDeleteContentRequest(FDeleteContentRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Key(MoveTemp(src.Key))
+            {}
+
+        FDeleteContentRequest& operator=(const FDeleteContentRequest& src) = default;
+        FDeleteContentRequest& operator=(FDeleteContentRequest&& src) = default;
+
         FDeleteContentRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteContentRequest()
         {
             readFromValue(obj);
@@ -4273,7 +5662,13 @@ namespace AdminModels
         ~FDeleteContentRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteMasterPlayerAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4296,6 +5691,15 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FDeleteMasterPlayerAccountRequest(FDeleteMasterPlayerAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            MetaData(MoveTemp(src.MetaData)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FDeleteMasterPlayerAccountRequest& operator=(const FDeleteMasterPlayerAccountRequest& src) = default;
+        FDeleteMasterPlayerAccountRequest& operator=(FDeleteMasterPlayerAccountRequest&& src) = default;
+
         FDeleteMasterPlayerAccountRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteMasterPlayerAccountRequest()
         {
             readFromValue(obj);
@@ -4304,7 +5708,13 @@ namespace AdminModels
         ~FDeleteMasterPlayerAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteMasterPlayerAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -4329,6 +5739,15 @@ namespace AdminModels
             TitleIds(src.TitleIds)
             {}
 
+        FDeleteMasterPlayerAccountResult(FDeleteMasterPlayerAccountResult&& src) :
+            FPlayFabCppResultCommon(),
+            JobReceiptId(MoveTemp(src.JobReceiptId)),
+            TitleIds(MoveTemp(src.TitleIds))
+            {}
+
+        FDeleteMasterPlayerAccountResult& operator=(const FDeleteMasterPlayerAccountResult& src) = default;
+        FDeleteMasterPlayerAccountResult& operator=(FDeleteMasterPlayerAccountResult&& src) = default;
+
         FDeleteMasterPlayerAccountResult(const TSharedPtr<FJsonObject>& obj) : FDeleteMasterPlayerAccountResult()
         {
             readFromValue(obj);
@@ -4337,7 +5756,13 @@ namespace AdminModels
         ~FDeleteMasterPlayerAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteOpenIdConnectionRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4355,6 +5780,14 @@ namespace AdminModels
             ConnectionId(src.ConnectionId)
             {}
 
+        FDeleteOpenIdConnectionRequest(FDeleteOpenIdConnectionRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ConnectionId(MoveTemp(src.ConnectionId))
+            {}
+
+        FDeleteOpenIdConnectionRequest& operator=(const FDeleteOpenIdConnectionRequest& src) = default;
+        FDeleteOpenIdConnectionRequest& operator=(FDeleteOpenIdConnectionRequest&& src) = default;
+
         FDeleteOpenIdConnectionRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteOpenIdConnectionRequest()
         {
             readFromValue(obj);
@@ -4363,7 +5796,13 @@ namespace AdminModels
         ~FDeleteOpenIdConnectionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeletePlayerRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4381,6 +5820,14 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FDeletePlayerRequest(FDeletePlayerRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FDeletePlayerRequest& operator=(const FDeletePlayerRequest& src) = default;
+        FDeletePlayerRequest& operator=(FDeletePlayerRequest&& src) = default;
+
         FDeletePlayerRequest(const TSharedPtr<FJsonObject>& obj) : FDeletePlayerRequest()
         {
             readFromValue(obj);
@@ -4389,7 +5836,13 @@ namespace AdminModels
         ~FDeletePlayerRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeletePlayerResult : public PlayFab::FPlayFabCppResultCommon
@@ -4402,6 +5855,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FDeletePlayerResult(FDeletePlayerResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FDeletePlayerResult& operator=(const FDeletePlayerResult& src) = default;
+        FDeletePlayerResult& operator=(FDeletePlayerResult&& src) = default;
+
         FDeletePlayerResult(const TSharedPtr<FJsonObject>& obj) : FDeletePlayerResult()
         {
             readFromValue(obj);
@@ -4410,7 +5870,13 @@ namespace AdminModels
         ~FDeletePlayerResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeletePlayerSharedSecretRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4428,6 +5894,14 @@ namespace AdminModels
             SecretKey(src.SecretKey)
             {}
 
+        FDeletePlayerSharedSecretRequest(FDeletePlayerSharedSecretRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            SecretKey(MoveTemp(src.SecretKey))
+            {}
+
+        FDeletePlayerSharedSecretRequest& operator=(const FDeletePlayerSharedSecretRequest& src) = default;
+        FDeletePlayerSharedSecretRequest& operator=(FDeletePlayerSharedSecretRequest&& src) = default;
+
         FDeletePlayerSharedSecretRequest(const TSharedPtr<FJsonObject>& obj) : FDeletePlayerSharedSecretRequest()
         {
             readFromValue(obj);
@@ -4436,7 +5910,13 @@ namespace AdminModels
         ~FDeletePlayerSharedSecretRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeletePlayerSharedSecretResult : public PlayFab::FPlayFabCppResultCommon
@@ -4449,6 +5929,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FDeletePlayerSharedSecretResult(FDeletePlayerSharedSecretResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FDeletePlayerSharedSecretResult& operator=(const FDeletePlayerSharedSecretResult& src) = default;
+        FDeletePlayerSharedSecretResult& operator=(FDeletePlayerSharedSecretResult&& src) = default;
+
         FDeletePlayerSharedSecretResult(const TSharedPtr<FJsonObject>& obj) : FDeletePlayerSharedSecretResult()
         {
             readFromValue(obj);
@@ -4457,7 +5944,13 @@ namespace AdminModels
         ~FDeletePlayerSharedSecretResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteSegmentRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4475,6 +5968,14 @@ namespace AdminModels
             SegmentId(src.SegmentId)
             {}
 
+        FDeleteSegmentRequest(FDeleteSegmentRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            SegmentId(MoveTemp(src.SegmentId))
+            {}
+
+        FDeleteSegmentRequest& operator=(const FDeleteSegmentRequest& src) = default;
+        FDeleteSegmentRequest& operator=(FDeleteSegmentRequest&& src) = default;
+
         FDeleteSegmentRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteSegmentRequest()
         {
             readFromValue(obj);
@@ -4483,7 +5984,13 @@ namespace AdminModels
         ~FDeleteSegmentRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteSegmentsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -4501,6 +6008,14 @@ namespace AdminModels
             ErrorMessage(src.ErrorMessage)
             {}
 
+        FDeleteSegmentsResponse(FDeleteSegmentsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            ErrorMessage(MoveTemp(src.ErrorMessage))
+            {}
+
+        FDeleteSegmentsResponse& operator=(const FDeleteSegmentsResponse& src) = default;
+        FDeleteSegmentsResponse& operator=(FDeleteSegmentsResponse&& src) = default;
+
         FDeleteSegmentsResponse(const TSharedPtr<FJsonObject>& obj) : FDeleteSegmentsResponse()
         {
             readFromValue(obj);
@@ -4509,7 +6024,13 @@ namespace AdminModels
         ~FDeleteSegmentsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteStoreRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4536,6 +6057,16 @@ namespace AdminModels
             StoreId(src.StoreId)
             {}
 
+        FDeleteStoreRequest(FDeleteStoreRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            StoreId(MoveTemp(src.StoreId))
+            {}
+
+        FDeleteStoreRequest& operator=(const FDeleteStoreRequest& src) = default;
+        FDeleteStoreRequest& operator=(FDeleteStoreRequest&& src) = default;
+
         FDeleteStoreRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteStoreRequest()
         {
             readFromValue(obj);
@@ -4544,7 +6075,13 @@ namespace AdminModels
         ~FDeleteStoreRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteStoreResult : public PlayFab::FPlayFabCppResultCommon
@@ -4557,6 +6094,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FDeleteStoreResult(FDeleteStoreResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FDeleteStoreResult& operator=(const FDeleteStoreResult& src) = default;
+        FDeleteStoreResult& operator=(FDeleteStoreResult&& src) = default;
+
         FDeleteStoreResult(const TSharedPtr<FJsonObject>& obj) : FDeleteStoreResult()
         {
             readFromValue(obj);
@@ -4565,7 +6109,13 @@ namespace AdminModels
         ~FDeleteStoreResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteTaskRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4580,9 +6130,17 @@ namespace AdminModels
 
         FDeleteTaskRequest(const FDeleteTaskRequest& src) :
             FPlayFabCppRequestCommon(),
-            Identifier(src.Identifier.IsValid() ? MakeShareable(new FNameIdentifier(*src.Identifier)) : nullptr)
+            Identifier(src.Identifier.IsValid() ? TSharedPtr<FNameIdentifier>(MakeShared<FNameIdentifier>(*src.Identifier)) : nullptr)
+            {}
+
+        FDeleteTaskRequest(FDeleteTaskRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Identifier(MoveTemp(src.Identifier))
             {}
 
+        FDeleteTaskRequest& operator=(const FDeleteTaskRequest& src) = default;
+        FDeleteTaskRequest& operator=(FDeleteTaskRequest&& src) = default;
+
         FDeleteTaskRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteTaskRequest()
         {
             readFromValue(obj);
@@ -4591,7 +6149,13 @@ namespace AdminModels
         ~FDeleteTaskRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteTitleDataOverrideRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4609,6 +6173,14 @@ namespace AdminModels
             OverrideLabel(src.OverrideLabel)
             {}
 
+        FDeleteTitleDataOverrideRequest(FDeleteTitleDataOverrideRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            OverrideLabel(MoveTemp(src.OverrideLabel))
+            {}
+
+        FDeleteTitleDataOverrideRequest& operator=(const FDeleteTitleDataOverrideRequest& src) = default;
+        FDeleteTitleDataOverrideRequest& operator=(FDeleteTitleDataOverrideRequest&& src) = default;
+
         FDeleteTitleDataOverrideRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteTitleDataOverrideRequest()
         {
             readFromValue(obj);
@@ -4617,7 +6189,13 @@ namespace AdminModels
         ~FDeleteTitleDataOverrideRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteTitleDataOverrideResult : public PlayFab::FPlayFabCppResultCommon
@@ -4630,6 +6208,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FDeleteTitleDataOverrideResult(FDeleteTitleDataOverrideResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FDeleteTitleDataOverrideResult& operator=(const FDeleteTitleDataOverrideResult& src) = default;
+        FDeleteTitleDataOverrideResult& operator=(FDeleteTitleDataOverrideResult&& src) = default;
+
         FDeleteTitleDataOverrideResult(const TSharedPtr<FJsonObject>& obj) : FDeleteTitleDataOverrideResult()
         {
             readFromValue(obj);
@@ -4638,7 +6223,13 @@ namespace AdminModels
         ~FDeleteTitleDataOverrideResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteTitleRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4651,6 +6242,13 @@ namespace AdminModels
             FPlayFabCppRequestCommon()
             {}
 
+        FDeleteTitleRequest(FDeleteTitleRequest&& src) :
+            FPlayFabCppRequestCommon()
+            {}
+
+        FDeleteTitleRequest& operator=(const FDeleteTitleRequest& src) = default;
+        FDeleteTitleRequest& operator=(FDeleteTitleRequest&& src) = default;
+
         FDeleteTitleRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteTitleRequest()
         {
             readFromValue(obj);
@@ -4659,7 +6257,13 @@ namespace AdminModels
         ~FDeleteTitleRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteTitleResult : public PlayFab::FPlayFabCppResultCommon
@@ -4672,6 +6276,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FDeleteTitleResult(FDeleteTitleResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FDeleteTitleResult& operator=(const FDeleteTitleResult& src) = default;
+        FDeleteTitleResult& operator=(FDeleteTitleResult&& src) = default;
+
         FDeleteTitleResult(const TSharedPtr<FJsonObject>& obj) : FDeleteTitleResult()
         {
             readFromValue(obj);
@@ -4680,7 +6291,13 @@ namespace AdminModels
         ~FDeleteTitleResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum EffectType
@@ -4690,6 +6307,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeEffectTypeEnumJSON(EffectType enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeEffectTypeEnumJSON(EffectType enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API EffectType readEffectTypeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API EffectType readEffectTypeFromValue(const FString& value);
 
@@ -4703,6 +6321,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FEmptyResponse(FEmptyResponse&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FEmptyResponse& operator=(const FEmptyResponse& src) = default;
+        FEmptyResponse& operator=(FEmptyResponse&& src) = default;
+
         FEmptyResponse(const TSharedPtr<FJsonObject>& obj) : FEmptyResponse()
         {
             readFromValue(obj);
@@ -4711,7 +6336,13 @@ namespace AdminModels
         ~FEmptyResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityKey : public PlayFab::FPlayFabCppBaseModel
@@ -4734,6 +6365,15 @@ namespace AdminModels
             Type(src.Type)
             {}
 
+        FEntityKey(FEntityKey&& src) :
+            FPlayFabCppBaseModel(),
+            Id(MoveTemp(src.Id)),
+            Type(MoveTemp(src.Type))
+            {}
+
+        FEntityKey& operator=(const FEntityKey& src) = default;
+        FEntityKey& operator=(FEntityKey&& src) = default;
+
         FEntityKey(const TSharedPtr<FJsonObject>& obj) : FEntityKey()
         {
             readFromValue(obj);
@@ -4742,7 +6382,13 @@ namespace AdminModels
         ~FEntityKey();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FExportMasterPlayerDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4760,6 +6406,14 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FExportMasterPlayerDataRequest(FExportMasterPlayerDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FExportMasterPlayerDataRequest& operator=(const FExportMasterPlayerDataRequest& src) = default;
+        FExportMasterPlayerDataRequest& operator=(FExportMasterPlayerDataRequest&& src) = default;
+
         FExportMasterPlayerDataRequest(const TSharedPtr<FJsonObject>& obj) : FExportMasterPlayerDataRequest()
         {
             readFromValue(obj);
@@ -4768,7 +6422,13 @@ namespace AdminModels
         ~FExportMasterPlayerDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FExportMasterPlayerDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -4789,15 +6449,29 @@ namespace AdminModels
             JobReceiptId(src.JobReceiptId)
             {}
 
-        FExportMasterPlayerDataResult(const TSharedPtr<FJsonObject>& obj) : FExportMasterPlayerDataResult()
-        {
-            readFromValue(obj);
+        FExportMasterPlayerDataResult(FExportMasterPlayerDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            JobReceiptId(MoveTemp(src.JobReceiptId))
+            {}
+
+        FExportMasterPlayerDataResult& operator=(const FExportMasterPlayerDataResult& src) = default;
+        FExportMasterPlayerDataResult& operator=(FExportMasterPlayerDataResult&& src) = default;
+
+        FExportMasterPlayerDataResult(const TSharedPtr<FJsonObject>& obj) : FExportMasterPlayerDataResult()
+        {
+            readFromValue(obj);
         }
 
         ~FExportMasterPlayerDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGameModeInfo : public PlayFab::FPlayFabCppBaseModel
@@ -4830,6 +6504,17 @@ namespace AdminModels
             StartOpen(src.StartOpen)
             {}
 
+        FGameModeInfo(FGameModeInfo&& src) :
+            FPlayFabCppBaseModel(),
+            Gamemode(MoveTemp(src.Gamemode)),
+            MaxPlayerCount(MoveTemp(src.MaxPlayerCount)),
+            MinPlayerCount(MoveTemp(src.MinPlayerCount)),
+            StartOpen(MoveTemp(src.StartOpen))
+            {}
+
+        FGameModeInfo& operator=(const FGameModeInfo& src) = default;
+        FGameModeInfo& operator=(FGameModeInfo&& src) = default;
+
         FGameModeInfo(const TSharedPtr<FJsonObject>& obj) : FGameModeInfo()
         {
             readFromValue(obj);
@@ -4838,7 +6523,13 @@ namespace AdminModels
         ~FGameModeInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetActionsOnPlayersInSegmentTaskInstanceResult : public PlayFab::FPlayFabCppResultCommon
@@ -4857,10 +6548,19 @@ namespace AdminModels
 
         FGetActionsOnPlayersInSegmentTaskInstanceResult(const FGetActionsOnPlayersInSegmentTaskInstanceResult& src) :
             FPlayFabCppResultCommon(),
-            Parameter(src.Parameter.IsValid() ? MakeShareable(new FActionsOnPlayersInSegmentTaskParameter(*src.Parameter)) : nullptr),
-            Summary(src.Summary.IsValid() ? MakeShareable(new FActionsOnPlayersInSegmentTaskSummary(*src.Summary)) : nullptr)
+            Parameter(src.Parameter.IsValid() ? TSharedPtr<FActionsOnPlayersInSegmentTaskParameter>(MakeShared<FActionsOnPlayersInSegmentTaskParameter>(*src.Parameter)) : nullptr),
+            Summary(src.Summary.IsValid() ? TSharedPtr<FActionsOnPlayersInSegmentTaskSummary>(MakeShared<FActionsOnPlayersInSegmentTaskSummary>(*src.Summary)) : nullptr)
+            {}
+
+        FGetActionsOnPlayersInSegmentTaskInstanceResult(FGetActionsOnPlayersInSegmentTaskInstanceResult&& src) :
+            FPlayFabCppResultCommon(),
+            Parameter(MoveTemp(src.Parameter)),
+            Summary(MoveTemp(src.Summary))
             {}
 
+        FGetActionsOnPlayersInSegmentTaskInstanceResult& operator=(const FGetActionsOnPlayersInSegmentTaskInstanceResult& src) = default;
+        FGetActionsOnPlayersInSegmentTaskInstanceResult& operator=(FGetActionsOnPlayersInSegmentTaskInstanceResult&& src) = default;
+
         FGetActionsOnPlayersInSegmentTaskInstanceResult(const TSharedPtr<FJsonObject>& obj) : FGetActionsOnPlayersInSegmentTaskInstanceResult()
         {
             readFromValue(obj);
@@ -4869,7 +6569,13 @@ namespace AdminModels
         ~FGetActionsOnPlayersInSegmentTaskInstanceResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetAllSegmentsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4882,6 +6588,13 @@ namespace AdminModels
             FPlayFabCppRequestCommon()
             {}
 
+        FGetAllSegmentsRequest(FGetAllSegmentsRequest&& src) :
+            FPlayFabCppRequestCommon()
+            {}
+
+        FGetAllSegmentsRequest& operator=(const FGetAllSegmentsRequest& src) = default;
+        FGetAllSegmentsRequest& operator=(FGetAllSegmentsRequest&& src) = default;
+
         FGetAllSegmentsRequest(const TSharedPtr<FJsonObject>& obj) : FGetAllSegmentsRequest()
         {
             readFromValue(obj);
@@ -4890,7 +6603,13 @@ namespace AdminModels
         ~FGetAllSegmentsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetSegmentResult : public PlayFab::FPlayFabCppBaseModel
@@ -4918,6 +6637,16 @@ namespace AdminModels
             Name(src.Name)
             {}
 
+        FGetSegmentResult(FGetSegmentResult&& src) :
+            FPlayFabCppBaseModel(),
+            ABTestParent(MoveTemp(src.ABTestParent)),
+            Id(MoveTemp(src.Id)),
+            Name(MoveTemp(src.Name))
+            {}
+
+        FGetSegmentResult& operator=(const FGetSegmentResult& src) = default;
+        FGetSegmentResult& operator=(FGetSegmentResult&& src) = default;
+
         FGetSegmentResult(const TSharedPtr<FJsonObject>& obj) : FGetSegmentResult()
         {
             readFromValue(obj);
@@ -4926,7 +6655,13 @@ namespace AdminModels
         ~FGetSegmentResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetAllSegmentsResult : public PlayFab::FPlayFabCppResultCommon
@@ -4943,6 +6678,14 @@ namespace AdminModels
             Segments(src.Segments)
             {}
 
+        FGetAllSegmentsResult(FGetAllSegmentsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Segments(MoveTemp(src.Segments))
+            {}
+
+        FGetAllSegmentsResult& operator=(const FGetAllSegmentsResult& src) = default;
+        FGetAllSegmentsResult& operator=(FGetAllSegmentsResult&& src) = default;
+
         FGetAllSegmentsResult(const TSharedPtr<FJsonObject>& obj) : FGetAllSegmentsResult()
         {
             readFromValue(obj);
@@ -4951,7 +6694,13 @@ namespace AdminModels
         ~FGetAllSegmentsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCatalogItemsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4969,6 +6718,14 @@ namespace AdminModels
             CatalogVersion(src.CatalogVersion)
             {}
 
+        FGetCatalogItemsRequest(FGetCatalogItemsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion))
+            {}
+
+        FGetCatalogItemsRequest& operator=(const FGetCatalogItemsRequest& src) = default;
+        FGetCatalogItemsRequest& operator=(FGetCatalogItemsRequest&& src) = default;
+
         FGetCatalogItemsRequest(const TSharedPtr<FJsonObject>& obj) : FGetCatalogItemsRequest()
         {
             readFromValue(obj);
@@ -4977,7 +6734,13 @@ namespace AdminModels
         ~FGetCatalogItemsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCatalogItemsResult : public PlayFab::FPlayFabCppResultCommon
@@ -4994,6 +6757,14 @@ namespace AdminModels
             Catalog(src.Catalog)
             {}
 
+        FGetCatalogItemsResult(FGetCatalogItemsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Catalog(MoveTemp(src.Catalog))
+            {}
+
+        FGetCatalogItemsResult& operator=(const FGetCatalogItemsResult& src) = default;
+        FGetCatalogItemsResult& operator=(FGetCatalogItemsResult&& src) = default;
+
         FGetCatalogItemsResult(const TSharedPtr<FJsonObject>& obj) : FGetCatalogItemsResult()
         {
             readFromValue(obj);
@@ -5002,7 +6773,13 @@ namespace AdminModels
         ~FGetCatalogItemsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCloudScriptRevisionRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5025,6 +6802,15 @@ namespace AdminModels
             Version(src.Version)
             {}
 
+        FGetCloudScriptRevisionRequest(FGetCloudScriptRevisionRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Revision(MoveTemp(src.Revision)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FGetCloudScriptRevisionRequest& operator=(const FGetCloudScriptRevisionRequest& src) = default;
+        FGetCloudScriptRevisionRequest& operator=(FGetCloudScriptRevisionRequest&& src) = default;
+
         FGetCloudScriptRevisionRequest(const TSharedPtr<FJsonObject>& obj) : FGetCloudScriptRevisionRequest()
         {
             readFromValue(obj);
@@ -5033,7 +6819,13 @@ namespace AdminModels
         ~FGetCloudScriptRevisionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCloudScriptRevisionResult : public PlayFab::FPlayFabCppResultCommon
@@ -5070,6 +6862,18 @@ namespace AdminModels
             Version(src.Version)
             {}
 
+        FGetCloudScriptRevisionResult(FGetCloudScriptRevisionResult&& src) :
+            FPlayFabCppResultCommon(),
+            CreatedAt(MoveTemp(src.CreatedAt)),
+            Files(MoveTemp(src.Files)),
+            IsPublished(MoveTemp(src.IsPublished)),
+            Revision(MoveTemp(src.Revision)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FGetCloudScriptRevisionResult& operator=(const FGetCloudScriptRevisionResult& src) = default;
+        FGetCloudScriptRevisionResult& operator=(FGetCloudScriptRevisionResult&& src) = default;
+
         FGetCloudScriptRevisionResult(const TSharedPtr<FJsonObject>& obj) : FGetCloudScriptRevisionResult()
         {
             readFromValue(obj);
@@ -5078,7 +6882,13 @@ namespace AdminModels
         ~FGetCloudScriptRevisionResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCloudScriptTaskInstanceResult : public PlayFab::FPlayFabCppResultCommon
@@ -5097,10 +6907,19 @@ namespace AdminModels
 
         FGetCloudScriptTaskInstanceResult(const FGetCloudScriptTaskInstanceResult& src) :
             FPlayFabCppResultCommon(),
-            Parameter(src.Parameter.IsValid() ? MakeShareable(new FCloudScriptTaskParameter(*src.Parameter)) : nullptr),
-            Summary(src.Summary.IsValid() ? MakeShareable(new FCloudScriptTaskSummary(*src.Summary)) : nullptr)
+            Parameter(src.Parameter.IsValid() ? TSharedPtr<FCloudScriptTaskParameter>(MakeShared<FCloudScriptTaskParameter>(*src.Parameter)) : nullptr),
+            Summary(src.Summary.IsValid() ? TSharedPtr<FCloudScriptTaskSummary>(MakeShared<FCloudScriptTaskSummary>(*src.Summary)) : nullptr)
+            {}
+
+        FGetCloudScriptTaskInstanceResult(FGetCloudScriptTaskInstanceResult&& src) :
+            FPlayFabCppResultCommon(),
+            Parameter(MoveTemp(src.Parameter)),
+            Summary(MoveTemp(src.Summary))
             {}
 
+        FGetCloudScriptTaskInstanceResult& operator=(const FGetCloudScriptTaskInstanceResult& src) = default;
+        FGetCloudScriptTaskInstanceResult& operator=(FGetCloudScriptTaskInstanceResult&& src) = default;
+
         FGetCloudScriptTaskInstanceResult(const TSharedPtr<FJsonObject>& obj) : FGetCloudScriptTaskInstanceResult()
         {
             readFromValue(obj);
@@ -5109,7 +6928,13 @@ namespace AdminModels
         ~FGetCloudScriptTaskInstanceResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCloudScriptVersionsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5122,6 +6947,13 @@ namespace AdminModels
             FPlayFabCppRequestCommon()
             {}
 
+        FGetCloudScriptVersionsRequest(FGetCloudScriptVersionsRequest&& src) :
+            FPlayFabCppRequestCommon()
+            {}
+
+        FGetCloudScriptVersionsRequest& operator=(const FGetCloudScriptVersionsRequest& src) = default;
+        FGetCloudScriptVersionsRequest& operator=(FGetCloudScriptVersionsRequest&& src) = default;
+
         FGetCloudScriptVersionsRequest(const TSharedPtr<FJsonObject>& obj) : FGetCloudScriptVersionsRequest()
         {
             readFromValue(obj);
@@ -5130,7 +6962,13 @@ namespace AdminModels
         ~FGetCloudScriptVersionsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCloudScriptVersionsResult : public PlayFab::FPlayFabCppResultCommon
@@ -5147,6 +6985,14 @@ namespace AdminModels
             Versions(src.Versions)
             {}
 
+        FGetCloudScriptVersionsResult(FGetCloudScriptVersionsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Versions(MoveTemp(src.Versions))
+            {}
+
+        FGetCloudScriptVersionsResult& operator=(const FGetCloudScriptVersionsResult& src) = default;
+        FGetCloudScriptVersionsResult& operator=(FGetCloudScriptVersionsResult&& src) = default;
+
         FGetCloudScriptVersionsResult(const TSharedPtr<FJsonObject>& obj) : FGetCloudScriptVersionsResult()
         {
             readFromValue(obj);
@@ -5155,7 +7001,13 @@ namespace AdminModels
         ~FGetCloudScriptVersionsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetContentListRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5176,6 +7028,14 @@ namespace AdminModels
             Prefix(src.Prefix)
             {}
 
+        FGetContentListRequest(FGetContentListRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Prefix(MoveTemp(src.Prefix))
+            {}
+
+        FGetContentListRequest& operator=(const FGetContentListRequest& src) = default;
+        FGetContentListRequest& operator=(FGetContentListRequest&& src) = default;
+
         FGetContentListRequest(const TSharedPtr<FJsonObject>& obj) : FGetContentListRequest()
         {
             readFromValue(obj);
@@ -5184,7 +7044,13 @@ namespace AdminModels
         ~FGetContentListRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetContentListResult : public PlayFab::FPlayFabCppResultCommon
@@ -5211,6 +7077,16 @@ namespace AdminModels
             TotalSize(src.TotalSize)
             {}
 
+        FGetContentListResult(FGetContentListResult&& src) :
+            FPlayFabCppResultCommon(),
+            Contents(MoveTemp(src.Contents)),
+            ItemCount(MoveTemp(src.ItemCount)),
+            TotalSize(MoveTemp(src.TotalSize))
+            {}
+
+        FGetContentListResult& operator=(const FGetContentListResult& src) = default;
+        FGetContentListResult& operator=(FGetContentListResult&& src) = default;
+
         FGetContentListResult(const TSharedPtr<FJsonObject>& obj) : FGetContentListResult()
         {
             readFromValue(obj);
@@ -5219,7 +7095,13 @@ namespace AdminModels
         ~FGetContentListResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetContentUploadUrlRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5245,6 +7127,15 @@ namespace AdminModels
             Key(src.Key)
             {}
 
+        FGetContentUploadUrlRequest(FGetContentUploadUrlRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ContentType(MoveTemp(src.ContentType)),
+            Key(MoveTemp(src.Key))
+            {}
+
+        FGetContentUploadUrlRequest& operator=(const FGetContentUploadUrlRequest& src) = default;
+        FGetContentUploadUrlRequest& operator=(FGetContentUploadUrlRequest&& src) = default;
+
         FGetContentUploadUrlRequest(const TSharedPtr<FJsonObject>& obj) : FGetContentUploadUrlRequest()
         {
             readFromValue(obj);
@@ -5253,7 +7144,13 @@ namespace AdminModels
         ~FGetContentUploadUrlRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetContentUploadUrlResult : public PlayFab::FPlayFabCppResultCommon
@@ -5274,6 +7171,14 @@ namespace AdminModels
             URL(src.URL)
             {}
 
+        FGetContentUploadUrlResult(FGetContentUploadUrlResult&& src) :
+            FPlayFabCppResultCommon(),
+            URL(MoveTemp(src.URL))
+            {}
+
+        FGetContentUploadUrlResult& operator=(const FGetContentUploadUrlResult& src) = default;
+        FGetContentUploadUrlResult& operator=(FGetContentUploadUrlResult&& src) = default;
+
         FGetContentUploadUrlResult(const TSharedPtr<FJsonObject>& obj) : FGetContentUploadUrlResult()
         {
             readFromValue(obj);
@@ -5282,7 +7187,13 @@ namespace AdminModels
         ~FGetContentUploadUrlResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetDataReportRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5315,6 +7226,17 @@ namespace AdminModels
             Year(src.Year)
             {}
 
+        FGetDataReportRequest(FGetDataReportRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Day(MoveTemp(src.Day)),
+            Month(MoveTemp(src.Month)),
+            ReportName(MoveTemp(src.ReportName)),
+            Year(MoveTemp(src.Year))
+            {}
+
+        FGetDataReportRequest& operator=(const FGetDataReportRequest& src) = default;
+        FGetDataReportRequest& operator=(FGetDataReportRequest&& src) = default;
+
         FGetDataReportRequest(const TSharedPtr<FJsonObject>& obj) : FGetDataReportRequest()
         {
             readFromValue(obj);
@@ -5323,7 +7245,13 @@ namespace AdminModels
         ~FGetDataReportRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetDataReportResult : public PlayFab::FPlayFabCppResultCommon
@@ -5344,6 +7272,14 @@ namespace AdminModels
             DownloadUrl(src.DownloadUrl)
             {}
 
+        FGetDataReportResult(FGetDataReportResult&& src) :
+            FPlayFabCppResultCommon(),
+            DownloadUrl(MoveTemp(src.DownloadUrl))
+            {}
+
+        FGetDataReportResult& operator=(const FGetDataReportResult& src) = default;
+        FGetDataReportResult& operator=(FGetDataReportResult&& src) = default;
+
         FGetDataReportResult(const TSharedPtr<FJsonObject>& obj) : FGetDataReportResult()
         {
             readFromValue(obj);
@@ -5352,7 +7288,13 @@ namespace AdminModels
         ~FGetDataReportResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetMatchmakerGameInfoRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5370,6 +7312,14 @@ namespace AdminModels
             LobbyId(src.LobbyId)
             {}
 
+        FGetMatchmakerGameInfoRequest(FGetMatchmakerGameInfoRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            LobbyId(MoveTemp(src.LobbyId))
+            {}
+
+        FGetMatchmakerGameInfoRequest& operator=(const FGetMatchmakerGameInfoRequest& src) = default;
+        FGetMatchmakerGameInfoRequest& operator=(FGetMatchmakerGameInfoRequest&& src) = default;
+
         FGetMatchmakerGameInfoRequest(const TSharedPtr<FJsonObject>& obj) : FGetMatchmakerGameInfoRequest()
         {
             readFromValue(obj);
@@ -5378,7 +7328,13 @@ namespace AdminModels
         ~FGetMatchmakerGameInfoRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetMatchmakerGameInfoResult : public PlayFab::FPlayFabCppResultCommon
@@ -5450,6 +7406,25 @@ namespace AdminModels
             TitleId(src.TitleId)
             {}
 
+        FGetMatchmakerGameInfoResult(FGetMatchmakerGameInfoResult&& src) :
+            FPlayFabCppResultCommon(),
+            BuildVersion(MoveTemp(src.BuildVersion)),
+            EndTime(MoveTemp(src.EndTime)),
+            LobbyId(MoveTemp(src.LobbyId)),
+            Mode(MoveTemp(src.Mode)),
+            Players(MoveTemp(src.Players)),
+            pfRegion(MoveTemp(src.pfRegion)),
+            ServerIPV4Address(MoveTemp(src.ServerIPV4Address)),
+            ServerIPV6Address(MoveTemp(src.ServerIPV6Address)),
+            ServerPort(MoveTemp(src.ServerPort)),
+            ServerPublicDNSName(MoveTemp(src.ServerPublicDNSName)),
+            StartTime(MoveTemp(src.StartTime)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FGetMatchmakerGameInfoResult& operator=(const FGetMatchmakerGameInfoResult& src) = default;
+        FGetMatchmakerGameInfoResult& operator=(FGetMatchmakerGameInfoResult&& src) = default;
+
         FGetMatchmakerGameInfoResult(const TSharedPtr<FJsonObject>& obj) : FGetMatchmakerGameInfoResult()
         {
             readFromValue(obj);
@@ -5458,7 +7433,13 @@ namespace AdminModels
         ~FGetMatchmakerGameInfoResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetMatchmakerGameModesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5476,6 +7457,14 @@ namespace AdminModels
             BuildVersion(src.BuildVersion)
             {}
 
+        FGetMatchmakerGameModesRequest(FGetMatchmakerGameModesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildVersion(MoveTemp(src.BuildVersion))
+            {}
+
+        FGetMatchmakerGameModesRequest& operator=(const FGetMatchmakerGameModesRequest& src) = default;
+        FGetMatchmakerGameModesRequest& operator=(FGetMatchmakerGameModesRequest&& src) = default;
+
         FGetMatchmakerGameModesRequest(const TSharedPtr<FJsonObject>& obj) : FGetMatchmakerGameModesRequest()
         {
             readFromValue(obj);
@@ -5484,7 +7473,13 @@ namespace AdminModels
         ~FGetMatchmakerGameModesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetMatchmakerGameModesResult : public PlayFab::FPlayFabCppResultCommon
@@ -5501,6 +7496,14 @@ namespace AdminModels
             GameModes(src.GameModes)
             {}
 
+        FGetMatchmakerGameModesResult(FGetMatchmakerGameModesResult&& src) :
+            FPlayFabCppResultCommon(),
+            GameModes(MoveTemp(src.GameModes))
+            {}
+
+        FGetMatchmakerGameModesResult& operator=(const FGetMatchmakerGameModesResult& src) = default;
+        FGetMatchmakerGameModesResult& operator=(FGetMatchmakerGameModesResult&& src) = default;
+
         FGetMatchmakerGameModesResult(const TSharedPtr<FJsonObject>& obj) : FGetMatchmakerGameModesResult()
         {
             readFromValue(obj);
@@ -5509,7 +7512,13 @@ namespace AdminModels
         ~FGetMatchmakerGameModesResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayedTitleListRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5527,6 +7536,14 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetPlayedTitleListRequest(FGetPlayedTitleListRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetPlayedTitleListRequest& operator=(const FGetPlayedTitleListRequest& src) = default;
+        FGetPlayedTitleListRequest& operator=(FGetPlayedTitleListRequest&& src) = default;
+
         FGetPlayedTitleListRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayedTitleListRequest()
         {
             readFromValue(obj);
@@ -5535,7 +7552,13 @@ namespace AdminModels
         ~FGetPlayedTitleListRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayedTitleListResult : public PlayFab::FPlayFabCppResultCommon
@@ -5552,6 +7575,14 @@ namespace AdminModels
             TitleIds(src.TitleIds)
             {}
 
+        FGetPlayedTitleListResult(FGetPlayedTitleListResult&& src) :
+            FPlayFabCppResultCommon(),
+            TitleIds(MoveTemp(src.TitleIds))
+            {}
+
+        FGetPlayedTitleListResult& operator=(const FGetPlayedTitleListResult& src) = default;
+        FGetPlayedTitleListResult& operator=(FGetPlayedTitleListResult&& src) = default;
+
         FGetPlayedTitleListResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayedTitleListResult()
         {
             readFromValue(obj);
@@ -5560,7 +7591,13 @@ namespace AdminModels
         ~FGetPlayedTitleListResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerIdFromAuthTokenRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5583,6 +7620,15 @@ namespace AdminModels
             TokenType(src.TokenType)
             {}
 
+        FGetPlayerIdFromAuthTokenRequest(FGetPlayerIdFromAuthTokenRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Token(MoveTemp(src.Token)),
+            TokenType(MoveTemp(src.TokenType))
+            {}
+
+        FGetPlayerIdFromAuthTokenRequest& operator=(const FGetPlayerIdFromAuthTokenRequest& src) = default;
+        FGetPlayerIdFromAuthTokenRequest& operator=(FGetPlayerIdFromAuthTokenRequest&& src) = default;
+
         FGetPlayerIdFromAuthTokenRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerIdFromAuthTokenRequest()
         {
             readFromValue(obj);
@@ -5591,7 +7637,13 @@ namespace AdminModels
         ~FGetPlayerIdFromAuthTokenRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerIdFromAuthTokenResult : public PlayFab::FPlayFabCppResultCommon
@@ -5609,6 +7661,14 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetPlayerIdFromAuthTokenResult(FGetPlayerIdFromAuthTokenResult&& src) :
+            FPlayFabCppResultCommon(),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetPlayerIdFromAuthTokenResult& operator=(const FGetPlayerIdFromAuthTokenResult& src) = default;
+        FGetPlayerIdFromAuthTokenResult& operator=(FGetPlayerIdFromAuthTokenResult&& src) = default;
+
         FGetPlayerIdFromAuthTokenResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerIdFromAuthTokenResult()
         {
             readFromValue(obj);
@@ -5617,7 +7677,13 @@ namespace AdminModels
         ~FGetPlayerIdFromAuthTokenResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerProfileViewConstraints : public PlayFab::FPlayFabCppBaseModel
@@ -5715,6 +7781,30 @@ namespace AdminModels
             ShowValuesToDate(src.ShowValuesToDate)
             {}
 
+        FPlayerProfileViewConstraints(FPlayerProfileViewConstraints&& src) :
+            FPlayFabCppBaseModel(),
+            ShowAvatarUrl(MoveTemp(src.ShowAvatarUrl)),
+            ShowBannedUntil(MoveTemp(src.ShowBannedUntil)),
+            ShowCampaignAttributions(MoveTemp(src.ShowCampaignAttributions)),
+            ShowContactEmailAddresses(MoveTemp(src.ShowContactEmailAddresses)),
+            ShowCreated(MoveTemp(src.ShowCreated)),
+            ShowDisplayName(MoveTemp(src.ShowDisplayName)),
+            ShowExperimentVariants(MoveTemp(src.ShowExperimentVariants)),
+            ShowLastLogin(MoveTemp(src.ShowLastLogin)),
+            ShowLinkedAccounts(MoveTemp(src.ShowLinkedAccounts)),
+            ShowLocations(MoveTemp(src.ShowLocations)),
+            ShowMemberships(MoveTemp(src.ShowMemberships)),
+            ShowOrigination(MoveTemp(src.ShowOrigination)),
+            ShowPushNotificationRegistrations(MoveTemp(src.ShowPushNotificationRegistrations)),
+            ShowStatistics(MoveTemp(src.ShowStatistics)),
+            ShowTags(MoveTemp(src.ShowTags)),
+            ShowTotalValueToDateInUsd(MoveTemp(src.ShowTotalValueToDateInUsd)),
+            ShowValuesToDate(MoveTemp(src.ShowValuesToDate))
+            {}
+
+        FPlayerProfileViewConstraints& operator=(const FPlayerProfileViewConstraints& src) = default;
+        FPlayerProfileViewConstraints& operator=(FPlayerProfileViewConstraints&& src) = default;
+
         FPlayerProfileViewConstraints(const TSharedPtr<FJsonObject>& obj) : FPlayerProfileViewConstraints()
         {
             readFromValue(obj);
@@ -5723,7 +7813,13 @@ namespace AdminModels
         ~FPlayerProfileViewConstraints();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerProfileRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5751,9 +7847,19 @@ namespace AdminModels
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
             PlayFabId(src.PlayFabId),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr)
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr)
+            {}
+
+        FGetPlayerProfileRequest(FGetPlayerProfileRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints))
             {}
 
+        FGetPlayerProfileRequest& operator=(const FGetPlayerProfileRequest& src) = default;
+        FGetPlayerProfileRequest& operator=(FGetPlayerProfileRequest&& src) = default;
+
         FGetPlayerProfileRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerProfileRequest()
         {
             readFromValue(obj);
@@ -5762,7 +7868,13 @@ namespace AdminModels
         ~FGetPlayerProfileRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum LoginIdentityProvider
@@ -5791,6 +7903,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API LoginIdentityProvider readLoginIdentityProviderFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API LoginIdentityProvider readLoginIdentityProviderFromValue(const FString& value);
 
@@ -5824,6 +7937,17 @@ namespace AdminModels
             Username(src.Username)
             {}
 
+        FLinkedPlatformAccountModel(FLinkedPlatformAccountModel&& src) :
+            FPlayFabCppBaseModel(),
+            Email(MoveTemp(src.Email)),
+            Platform(MoveTemp(src.Platform)),
+            PlatformUserId(MoveTemp(src.PlatformUserId)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FLinkedPlatformAccountModel& operator=(const FLinkedPlatformAccountModel& src) = default;
+        FLinkedPlatformAccountModel& operator=(FLinkedPlatformAccountModel&& src) = default;
+
         FLinkedPlatformAccountModel(const TSharedPtr<FJsonObject>& obj) : FLinkedPlatformAccountModel()
         {
             readFromValue(obj);
@@ -5832,7 +7956,13 @@ namespace AdminModels
         ~FLinkedPlatformAccountModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLocationModel : public PlayFab::FPlayFabCppBaseModel
@@ -5870,6 +8000,18 @@ namespace AdminModels
             Longitude(src.Longitude)
             {}
 
+        FLocationModel(FLocationModel&& src) :
+            FPlayFabCppBaseModel(),
+            City(MoveTemp(src.City)),
+            pfContinentCode(MoveTemp(src.pfContinentCode)),
+            pfCountryCode(MoveTemp(src.pfCountryCode)),
+            Latitude(MoveTemp(src.Latitude)),
+            Longitude(MoveTemp(src.Longitude))
+            {}
+
+        FLocationModel& operator=(const FLocationModel& src) = default;
+        FLocationModel& operator=(FLocationModel&& src) = default;
+
         FLocationModel(const TSharedPtr<FJsonObject>& obj) : FLocationModel()
         {
             readFromValue(obj);
@@ -5878,7 +8020,13 @@ namespace AdminModels
         ~FLocationModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum SubscriptionProviderStatus
@@ -5894,6 +8042,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API SubscriptionProviderStatus readSubscriptionProviderStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API SubscriptionProviderStatus readSubscriptionProviderStatusFromValue(const FString& value);
 
@@ -5942,6 +8091,20 @@ namespace AdminModels
             SubscriptionProvider(src.SubscriptionProvider)
             {}
 
+        FSubscriptionModel(FSubscriptionModel&& src) :
+            FPlayFabCppBaseModel(),
+            Expiration(MoveTemp(src.Expiration)),
+            InitialSubscriptionTime(MoveTemp(src.InitialSubscriptionTime)),
+            IsActive(MoveTemp(src.IsActive)),
+            Status(MoveTemp(src.Status)),
+            SubscriptionId(MoveTemp(src.SubscriptionId)),
+            SubscriptionItemId(MoveTemp(src.SubscriptionItemId)),
+            SubscriptionProvider(MoveTemp(src.SubscriptionProvider))
+            {}
+
+        FSubscriptionModel& operator=(const FSubscriptionModel& src) = default;
+        FSubscriptionModel& operator=(FSubscriptionModel&& src) = default;
+
         FSubscriptionModel(const TSharedPtr<FJsonObject>& obj) : FSubscriptionModel()
         {
             readFromValue(obj);
@@ -5950,7 +8113,13 @@ namespace AdminModels
         ~FSubscriptionModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMembershipModel : public PlayFab::FPlayFabCppBaseModel
@@ -5995,6 +8164,19 @@ namespace AdminModels
             Subscriptions(src.Subscriptions)
             {}
 
+        FMembershipModel(FMembershipModel&& src) :
+            FPlayFabCppBaseModel(),
+            IsActive(MoveTemp(src.IsActive)),
+            MembershipExpiration(MoveTemp(src.MembershipExpiration)),
+            MembershipId(MoveTemp(src.MembershipId)),
+            OverrideExpiration(MoveTemp(src.OverrideExpiration)),
+            OverrideIsSet(MoveTemp(src.OverrideIsSet)),
+            Subscriptions(MoveTemp(src.Subscriptions))
+            {}
+
+        FMembershipModel& operator=(const FMembershipModel& src) = default;
+        FMembershipModel& operator=(FMembershipModel&& src) = default;
+
         FMembershipModel(const TSharedPtr<FJsonObject>& obj) : FMembershipModel()
         {
             readFromValue(obj);
@@ -6003,7 +8185,13 @@ namespace AdminModels
         ~FMembershipModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum PushNotificationPlatform
@@ -6013,6 +8201,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API PushNotificationPlatform readPushNotificationPlatformFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API PushNotificationPlatform readPushNotificationPlatformFromValue(const FString& value);
 
@@ -6036,6 +8225,15 @@ namespace AdminModels
             Platform(src.Platform)
             {}
 
+        FPushNotificationRegistrationModel(FPushNotificationRegistrationModel&& src) :
+            FPlayFabCppBaseModel(),
+            NotificationEndpointARN(MoveTemp(src.NotificationEndpointARN)),
+            Platform(MoveTemp(src.Platform))
+            {}
+
+        FPushNotificationRegistrationModel& operator=(const FPushNotificationRegistrationModel& src) = default;
+        FPushNotificationRegistrationModel& operator=(FPushNotificationRegistrationModel&& src) = default;
+
         FPushNotificationRegistrationModel(const TSharedPtr<FJsonObject>& obj) : FPushNotificationRegistrationModel()
         {
             readFromValue(obj);
@@ -6044,7 +8242,13 @@ namespace AdminModels
         ~FPushNotificationRegistrationModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStatisticModel : public PlayFab::FPlayFabCppBaseModel
@@ -6072,6 +8276,16 @@ namespace AdminModels
             Version(src.Version)
             {}
 
+        FStatisticModel(FStatisticModel&& src) :
+            FPlayFabCppBaseModel(),
+            Name(MoveTemp(src.Name)),
+            Value(MoveTemp(src.Value)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FStatisticModel& operator=(const FStatisticModel& src) = default;
+        FStatisticModel& operator=(FStatisticModel&& src) = default;
+
         FStatisticModel(const TSharedPtr<FJsonObject>& obj) : FStatisticModel()
         {
             readFromValue(obj);
@@ -6080,7 +8294,13 @@ namespace AdminModels
         ~FStatisticModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FTagModel : public PlayFab::FPlayFabCppBaseModel
@@ -6098,6 +8318,14 @@ namespace AdminModels
             TagValue(src.TagValue)
             {}
 
+        FTagModel(FTagModel&& src) :
+            FPlayFabCppBaseModel(),
+            TagValue(MoveTemp(src.TagValue))
+            {}
+
+        FTagModel& operator=(const FTagModel& src) = default;
+        FTagModel& operator=(FTagModel&& src) = default;
+
         FTagModel(const TSharedPtr<FJsonObject>& obj) : FTagModel()
         {
             readFromValue(obj);
@@ -6106,7 +8334,13 @@ namespace AdminModels
         ~FTagModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValueToDateModel : public PlayFab::FPlayFabCppBaseModel
@@ -6140,6 +8374,16 @@ namespace AdminModels
             TotalValueAsDecimal(src.TotalValueAsDecimal)
             {}
 
+        FValueToDateModel(FValueToDateModel&& src) :
+            FPlayFabCppBaseModel(),
+            Currency(MoveTemp(src.Currency)),
+            TotalValue(MoveTemp(src.TotalValue)),
+            TotalValueAsDecimal(MoveTemp(src.TotalValueAsDecimal))
+            {}
+
+        FValueToDateModel& operator=(const FValueToDateModel& src) = default;
+        FValueToDateModel& operator=(FValueToDateModel&& src) = default;
+
         FValueToDateModel(const TSharedPtr<FJsonObject>& obj) : FValueToDateModel()
         {
             readFromValue(obj);
@@ -6148,7 +8392,13 @@ namespace AdminModels
         ~FValueToDateModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerProfileModel : public PlayFab::FPlayFabCppBaseModel
@@ -6254,6 +8504,33 @@ namespace AdminModels
             ValuesToDate(src.ValuesToDate)
             {}
 
+        FPlayerProfileModel(FPlayerProfileModel&& src) :
+            FPlayFabCppBaseModel(),
+            AdCampaignAttributions(MoveTemp(src.AdCampaignAttributions)),
+            AvatarUrl(MoveTemp(src.AvatarUrl)),
+            BannedUntil(MoveTemp(src.BannedUntil)),
+            ContactEmailAddresses(MoveTemp(src.ContactEmailAddresses)),
+            Created(MoveTemp(src.Created)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            ExperimentVariants(MoveTemp(src.ExperimentVariants)),
+            LastLogin(MoveTemp(src.LastLogin)),
+            LinkedAccounts(MoveTemp(src.LinkedAccounts)),
+            Locations(MoveTemp(src.Locations)),
+            Memberships(MoveTemp(src.Memberships)),
+            Origination(MoveTemp(src.Origination)),
+            PlayerId(MoveTemp(src.PlayerId)),
+            PublisherId(MoveTemp(src.PublisherId)),
+            PushNotificationRegistrations(MoveTemp(src.PushNotificationRegistrations)),
+            Statistics(MoveTemp(src.Statistics)),
+            Tags(MoveTemp(src.Tags)),
+            TitleId(MoveTemp(src.TitleId)),
+            TotalValueToDateInUSD(MoveTemp(src.TotalValueToDateInUSD)),
+            ValuesToDate(MoveTemp(src.ValuesToDate))
+            {}
+
+        FPlayerProfileModel& operator=(const FPlayerProfileModel& src) = default;
+        FPlayerProfileModel& operator=(FPlayerProfileModel&& src) = default;
+
         FPlayerProfileModel(const TSharedPtr<FJsonObject>& obj) : FPlayerProfileModel()
         {
             readFromValue(obj);
@@ -6262,7 +8539,13 @@ namespace AdminModels
         ~FPlayerProfileModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerProfileResult : public PlayFab::FPlayFabCppResultCommon
@@ -6280,9 +8563,17 @@ namespace AdminModels
 
         FGetPlayerProfileResult(const FGetPlayerProfileResult& src) :
             FPlayFabCppResultCommon(),
-            PlayerProfile(src.PlayerProfile.IsValid() ? MakeShareable(new FPlayerProfileModel(*src.PlayerProfile)) : nullptr)
+            PlayerProfile(src.PlayerProfile.IsValid() ? TSharedPtr<FPlayerProfileModel>(MakeShared<FPlayerProfileModel>(*src.PlayerProfile)) : nullptr)
+            {}
+
+        FGetPlayerProfileResult(FGetPlayerProfileResult&& src) :
+            FPlayFabCppResultCommon(),
+            PlayerProfile(MoveTemp(src.PlayerProfile))
             {}
 
+        FGetPlayerProfileResult& operator=(const FGetPlayerProfileResult& src) = default;
+        FGetPlayerProfileResult& operator=(FGetPlayerProfileResult&& src) = default;
+
         FGetPlayerProfileResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerProfileResult()
         {
             readFromValue(obj);
@@ -6291,7 +8582,13 @@ namespace AdminModels
         ~FGetPlayerProfileResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerSegmentsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6308,6 +8605,14 @@ namespace AdminModels
             Segments(src.Segments)
             {}
 
+        FGetPlayerSegmentsResult(FGetPlayerSegmentsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Segments(MoveTemp(src.Segments))
+            {}
+
+        FGetPlayerSegmentsResult& operator=(const FGetPlayerSegmentsResult& src) = default;
+        FGetPlayerSegmentsResult& operator=(FGetPlayerSegmentsResult&& src) = default;
+
         FGetPlayerSegmentsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerSegmentsResult()
         {
             readFromValue(obj);
@@ -6316,7 +8621,13 @@ namespace AdminModels
         ~FGetPlayerSegmentsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerSharedSecretsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6329,6 +8640,13 @@ namespace AdminModels
             FPlayFabCppRequestCommon()
             {}
 
+        FGetPlayerSharedSecretsRequest(FGetPlayerSharedSecretsRequest&& src) :
+            FPlayFabCppRequestCommon()
+            {}
+
+        FGetPlayerSharedSecretsRequest& operator=(const FGetPlayerSharedSecretsRequest& src) = default;
+        FGetPlayerSharedSecretsRequest& operator=(FGetPlayerSharedSecretsRequest&& src) = default;
+
         FGetPlayerSharedSecretsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerSharedSecretsRequest()
         {
             readFromValue(obj);
@@ -6337,7 +8655,13 @@ namespace AdminModels
         ~FGetPlayerSharedSecretsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSharedSecret : public PlayFab::FPlayFabCppBaseModel
@@ -6365,6 +8689,16 @@ namespace AdminModels
             SecretKey(src.SecretKey)
             {}
 
+        FSharedSecret(FSharedSecret&& src) :
+            FPlayFabCppBaseModel(),
+            Disabled(MoveTemp(src.Disabled)),
+            FriendlyName(MoveTemp(src.FriendlyName)),
+            SecretKey(MoveTemp(src.SecretKey))
+            {}
+
+        FSharedSecret& operator=(const FSharedSecret& src) = default;
+        FSharedSecret& operator=(FSharedSecret&& src) = default;
+
         FSharedSecret(const TSharedPtr<FJsonObject>& obj) : FSharedSecret()
         {
             readFromValue(obj);
@@ -6373,7 +8707,13 @@ namespace AdminModels
         ~FSharedSecret();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerSharedSecretsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6390,6 +8730,14 @@ namespace AdminModels
             SharedSecrets(src.SharedSecrets)
             {}
 
+        FGetPlayerSharedSecretsResult(FGetPlayerSharedSecretsResult&& src) :
+            FPlayFabCppResultCommon(),
+            SharedSecrets(MoveTemp(src.SharedSecrets))
+            {}
+
+        FGetPlayerSharedSecretsResult& operator=(const FGetPlayerSharedSecretsResult& src) = default;
+        FGetPlayerSharedSecretsResult& operator=(FGetPlayerSharedSecretsResult&& src) = default;
+
         FGetPlayerSharedSecretsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerSharedSecretsResult()
         {
             readFromValue(obj);
@@ -6398,7 +8746,13 @@ namespace AdminModels
         ~FGetPlayerSharedSecretsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayersInSegmentRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6438,6 +8792,18 @@ namespace AdminModels
             SegmentId(src.SegmentId)
             {}
 
+        FGetPlayersInSegmentRequest(FGetPlayersInSegmentRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ContinuationToken(MoveTemp(src.ContinuationToken)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            MaxBatchSize(MoveTemp(src.MaxBatchSize)),
+            SecondsToLive(MoveTemp(src.SecondsToLive)),
+            SegmentId(MoveTemp(src.SegmentId))
+            {}
+
+        FGetPlayersInSegmentRequest& operator=(const FGetPlayersInSegmentRequest& src) = default;
+        FGetPlayersInSegmentRequest& operator=(FGetPlayersInSegmentRequest&& src) = default;
+
         FGetPlayersInSegmentRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayersInSegmentRequest()
         {
             readFromValue(obj);
@@ -6446,7 +8812,13 @@ namespace AdminModels
         ~FGetPlayersInSegmentRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerLinkedAccount : public PlayFab::FPlayFabCppBaseModel
@@ -6479,6 +8851,17 @@ namespace AdminModels
             Username(src.Username)
             {}
 
+        FPlayerLinkedAccount(FPlayerLinkedAccount&& src) :
+            FPlayFabCppBaseModel(),
+            Email(MoveTemp(src.Email)),
+            Platform(MoveTemp(src.Platform)),
+            PlatformUserId(MoveTemp(src.PlatformUserId)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FPlayerLinkedAccount& operator=(const FPlayerLinkedAccount& src) = default;
+        FPlayerLinkedAccount& operator=(FPlayerLinkedAccount&& src) = default;
+
         FPlayerLinkedAccount(const TSharedPtr<FJsonObject>& obj) : FPlayerLinkedAccount()
         {
             readFromValue(obj);
@@ -6487,7 +8870,13 @@ namespace AdminModels
         ~FPlayerLinkedAccount();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerLocation : public PlayFab::FPlayFabCppBaseModel
@@ -6525,6 +8914,18 @@ namespace AdminModels
             Longitude(src.Longitude)
             {}
 
+        FPlayerLocation(FPlayerLocation&& src) :
+            FPlayFabCppBaseModel(),
+            City(MoveTemp(src.City)),
+            pfContinentCode(MoveTemp(src.pfContinentCode)),
+            pfCountryCode(MoveTemp(src.pfCountryCode)),
+            Latitude(MoveTemp(src.Latitude)),
+            Longitude(MoveTemp(src.Longitude))
+            {}
+
+        FPlayerLocation& operator=(const FPlayerLocation& src) = default;
+        FPlayerLocation& operator=(FPlayerLocation&& src) = default;
+
         FPlayerLocation(const TSharedPtr<FJsonObject>& obj) : FPlayerLocation()
         {
             readFromValue(obj);
@@ -6533,7 +8934,13 @@ namespace AdminModels
         ~FPlayerLocation();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerStatistic : public PlayFab::FPlayFabCppBaseModel
@@ -6566,6 +8973,17 @@ namespace AdminModels
             StatisticVersion(src.StatisticVersion)
             {}
 
+        FPlayerStatistic(FPlayerStatistic&& src) :
+            FPlayFabCppBaseModel(),
+            Id(MoveTemp(src.Id)),
+            Name(MoveTemp(src.Name)),
+            StatisticValue(MoveTemp(src.StatisticValue)),
+            StatisticVersion(MoveTemp(src.StatisticVersion))
+            {}
+
+        FPlayerStatistic& operator=(const FPlayerStatistic& src) = default;
+        FPlayerStatistic& operator=(FPlayerStatistic&& src) = default;
+
         FPlayerStatistic(const TSharedPtr<FJsonObject>& obj) : FPlayerStatistic()
         {
             readFromValue(obj);
@@ -6574,7 +8992,13 @@ namespace AdminModels
         ~FPlayerStatistic();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPushNotificationRegistration : public PlayFab::FPlayFabCppBaseModel
@@ -6597,6 +9021,15 @@ namespace AdminModels
             Platform(src.Platform)
             {}
 
+        FPushNotificationRegistration(FPushNotificationRegistration&& src) :
+            FPlayFabCppBaseModel(),
+            NotificationEndpointARN(MoveTemp(src.NotificationEndpointARN)),
+            Platform(MoveTemp(src.Platform))
+            {}
+
+        FPushNotificationRegistration& operator=(const FPushNotificationRegistration& src) = default;
+        FPushNotificationRegistration& operator=(FPushNotificationRegistration&& src) = default;
+
         FPushNotificationRegistration(const TSharedPtr<FJsonObject>& obj) : FPushNotificationRegistration()
         {
             readFromValue(obj);
@@ -6605,7 +9038,13 @@ namespace AdminModels
         ~FPushNotificationRegistration();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerProfile : public PlayFab::FPlayFabCppBaseModel
@@ -6712,6 +9151,34 @@ namespace AdminModels
             VirtualCurrencyBalances(src.VirtualCurrencyBalances)
             {}
 
+        FPlayerProfile(FPlayerProfile&& src) :
+            FPlayFabCppBaseModel(),
+            AdCampaignAttributions(MoveTemp(src.AdCampaignAttributions)),
+            AvatarUrl(MoveTemp(src.AvatarUrl)),
+            BannedUntil(MoveTemp(src.BannedUntil)),
+            ContactEmailAddresses(MoveTemp(src.ContactEmailAddresses)),
+            Created(MoveTemp(src.Created)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            LastLogin(MoveTemp(src.LastLogin)),
+            LinkedAccounts(MoveTemp(src.LinkedAccounts)),
+            Locations(MoveTemp(src.Locations)),
+            Origination(MoveTemp(src.Origination)),
+            PlayerExperimentVariants(MoveTemp(src.PlayerExperimentVariants)),
+            PlayerId(MoveTemp(src.PlayerId)),
+            PlayerStatistics(MoveTemp(src.PlayerStatistics)),
+            PublisherId(MoveTemp(src.PublisherId)),
+            PushNotificationRegistrations(MoveTemp(src.PushNotificationRegistrations)),
+            Statistics(MoveTemp(src.Statistics)),
+            Tags(MoveTemp(src.Tags)),
+            TitleId(MoveTemp(src.TitleId)),
+            TotalValueToDateInUSD(MoveTemp(src.TotalValueToDateInUSD)),
+            ValuesToDate(MoveTemp(src.ValuesToDate)),
+            VirtualCurrencyBalances(MoveTemp(src.VirtualCurrencyBalances))
+            {}
+
+        FPlayerProfile& operator=(const FPlayerProfile& src) = default;
+        FPlayerProfile& operator=(FPlayerProfile&& src) = default;
+
         FPlayerProfile(const TSharedPtr<FJsonObject>& obj) : FPlayerProfile()
         {
             readFromValue(obj);
@@ -6720,7 +9187,13 @@ namespace AdminModels
         ~FPlayerProfile();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayersInSegmentResult : public PlayFab::FPlayFabCppResultCommon
@@ -6747,6 +9220,16 @@ namespace AdminModels
             ProfilesInSegment(src.ProfilesInSegment)
             {}
 
+        FGetPlayersInSegmentResult(FGetPlayersInSegmentResult&& src) :
+            FPlayFabCppResultCommon(),
+            ContinuationToken(MoveTemp(src.ContinuationToken)),
+            PlayerProfiles(MoveTemp(src.PlayerProfiles)),
+            ProfilesInSegment(MoveTemp(src.ProfilesInSegment))
+            {}
+
+        FGetPlayersInSegmentResult& operator=(const FGetPlayersInSegmentResult& src) = default;
+        FGetPlayersInSegmentResult& operator=(FGetPlayersInSegmentResult&& src) = default;
+
         FGetPlayersInSegmentResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayersInSegmentResult()
         {
             readFromValue(obj);
@@ -6755,7 +9238,13 @@ namespace AdminModels
         ~FGetPlayersInSegmentResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayersSegmentsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6777,6 +9266,15 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetPlayersSegmentsRequest(FGetPlayersSegmentsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetPlayersSegmentsRequest& operator=(const FGetPlayersSegmentsRequest& src) = default;
+        FGetPlayersSegmentsRequest& operator=(FGetPlayersSegmentsRequest&& src) = default;
+
         FGetPlayersSegmentsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayersSegmentsRequest()
         {
             readFromValue(obj);
@@ -6785,7 +9283,13 @@ namespace AdminModels
         ~FGetPlayersSegmentsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerStatisticDefinitionsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6798,6 +9302,13 @@ namespace AdminModels
             FPlayFabCppRequestCommon()
             {}
 
+        FGetPlayerStatisticDefinitionsRequest(FGetPlayerStatisticDefinitionsRequest&& src) :
+            FPlayFabCppRequestCommon()
+            {}
+
+        FGetPlayerStatisticDefinitionsRequest& operator=(const FGetPlayerStatisticDefinitionsRequest& src) = default;
+        FGetPlayerStatisticDefinitionsRequest& operator=(FGetPlayerStatisticDefinitionsRequest&& src) = default;
+
         FGetPlayerStatisticDefinitionsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerStatisticDefinitionsRequest()
         {
             readFromValue(obj);
@@ -6806,7 +9317,13 @@ namespace AdminModels
         ~FGetPlayerStatisticDefinitionsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerStatisticDefinitionsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6823,7 +9340,15 @@ namespace AdminModels
             Statistics(src.Statistics)
             {}
 
-        FGetPlayerStatisticDefinitionsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerStatisticDefinitionsResult()
+        FGetPlayerStatisticDefinitionsResult(FGetPlayerStatisticDefinitionsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Statistics(MoveTemp(src.Statistics))
+            {}
+
+        FGetPlayerStatisticDefinitionsResult& operator=(const FGetPlayerStatisticDefinitionsResult& src) = default;
+        FGetPlayerStatisticDefinitionsResult& operator=(FGetPlayerStatisticDefinitionsResult&& src) = default;
+
+        FGetPlayerStatisticDefinitionsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerStatisticDefinitionsResult()
         {
             readFromValue(obj);
         }
@@ -6831,7 +9356,13 @@ namespace AdminModels
         ~FGetPlayerStatisticDefinitionsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerStatisticVersionsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6853,6 +9384,15 @@ namespace AdminModels
             StatisticName(src.StatisticName)
             {}
 
+        FGetPlayerStatisticVersionsRequest(FGetPlayerStatisticVersionsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            StatisticName(MoveTemp(src.StatisticName))
+            {}
+
+        FGetPlayerStatisticVersionsRequest& operator=(const FGetPlayerStatisticVersionsRequest& src) = default;
+        FGetPlayerStatisticVersionsRequest& operator=(FGetPlayerStatisticVersionsRequest&& src) = default;
+
         FGetPlayerStatisticVersionsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerStatisticVersionsRequest()
         {
             readFromValue(obj);
@@ -6861,7 +9401,13 @@ namespace AdminModels
         ~FGetPlayerStatisticVersionsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum StatisticVersionStatus
@@ -6874,6 +9420,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeStatisticVersionStatusEnumJSON(StatisticVersionStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeStatisticVersionStatusEnumJSON(StatisticVersionStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API StatisticVersionStatus readStatisticVersionStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API StatisticVersionStatus readStatisticVersionStatusFromValue(const FString& value);
 
@@ -6927,6 +9474,21 @@ namespace AdminModels
             Version(src.Version)
             {}
 
+        FPlayerStatisticVersion(FPlayerStatisticVersion&& src) :
+            FPlayFabCppBaseModel(),
+            ActivationTime(MoveTemp(src.ActivationTime)),
+            ArchiveDownloadUrl(MoveTemp(src.ArchiveDownloadUrl)),
+            DeactivationTime(MoveTemp(src.DeactivationTime)),
+            ScheduledActivationTime(MoveTemp(src.ScheduledActivationTime)),
+            ScheduledDeactivationTime(MoveTemp(src.ScheduledDeactivationTime)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            Status(MoveTemp(src.Status)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FPlayerStatisticVersion& operator=(const FPlayerStatisticVersion& src) = default;
+        FPlayerStatisticVersion& operator=(FPlayerStatisticVersion&& src) = default;
+
         FPlayerStatisticVersion(const TSharedPtr<FJsonObject>& obj) : FPlayerStatisticVersion()
         {
             readFromValue(obj);
@@ -6935,7 +9497,13 @@ namespace AdminModels
         ~FPlayerStatisticVersion();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerStatisticVersionsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6952,6 +9520,14 @@ namespace AdminModels
             StatisticVersions(src.StatisticVersions)
             {}
 
+        FGetPlayerStatisticVersionsResult(FGetPlayerStatisticVersionsResult&& src) :
+            FPlayFabCppResultCommon(),
+            StatisticVersions(MoveTemp(src.StatisticVersions))
+            {}
+
+        FGetPlayerStatisticVersionsResult& operator=(const FGetPlayerStatisticVersionsResult& src) = default;
+        FGetPlayerStatisticVersionsResult& operator=(FGetPlayerStatisticVersionsResult&& src) = default;
+
         FGetPlayerStatisticVersionsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerStatisticVersionsResult()
         {
             readFromValue(obj);
@@ -6960,7 +9536,13 @@ namespace AdminModels
         ~FGetPlayerStatisticVersionsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerTagsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6987,6 +9569,16 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetPlayerTagsRequest(FGetPlayerTagsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Namespace(MoveTemp(src.Namespace)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetPlayerTagsRequest& operator=(const FGetPlayerTagsRequest& src) = default;
+        FGetPlayerTagsRequest& operator=(FGetPlayerTagsRequest&& src) = default;
+
         FGetPlayerTagsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerTagsRequest()
         {
             readFromValue(obj);
@@ -6995,7 +9587,13 @@ namespace AdminModels
         ~FGetPlayerTagsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerTagsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7017,6 +9615,15 @@ namespace AdminModels
             Tags(src.Tags)
             {}
 
+        FGetPlayerTagsResult(FGetPlayerTagsResult&& src) :
+            FPlayFabCppResultCommon(),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Tags(MoveTemp(src.Tags))
+            {}
+
+        FGetPlayerTagsResult& operator=(const FGetPlayerTagsResult& src) = default;
+        FGetPlayerTagsResult& operator=(FGetPlayerTagsResult&& src) = default;
+
         FGetPlayerTagsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerTagsResult()
         {
             readFromValue(obj);
@@ -7025,7 +9632,13 @@ namespace AdminModels
         ~FGetPlayerTagsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPolicyRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7043,6 +9656,14 @@ namespace AdminModels
             PolicyName(src.PolicyName)
             {}
 
+        FGetPolicyRequest(FGetPolicyRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PolicyName(MoveTemp(src.PolicyName))
+            {}
+
+        FGetPolicyRequest& operator=(const FGetPolicyRequest& src) = default;
+        FGetPolicyRequest& operator=(FGetPolicyRequest&& src) = default;
+
         FGetPolicyRequest(const TSharedPtr<FJsonObject>& obj) : FGetPolicyRequest()
         {
             readFromValue(obj);
@@ -7051,7 +9672,13 @@ namespace AdminModels
         ~FGetPolicyRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPermissionStatement : public PlayFab::FPlayFabCppBaseModel
@@ -7090,13 +9717,26 @@ namespace AdminModels
         FPermissionStatement(const FPermissionStatement& src) :
             FPlayFabCppBaseModel(),
             Action(src.Action),
-            ApiConditions(src.ApiConditions.IsValid() ? MakeShareable(new FApiCondition(*src.ApiConditions)) : nullptr),
+            ApiConditions(src.ApiConditions.IsValid() ? TSharedPtr<FApiCondition>(MakeShared<FApiCondition>(*src.ApiConditions)) : nullptr),
             Comment(src.Comment),
             Effect(src.Effect),
             Principal(src.Principal),
             Resource(src.Resource)
             {}
 
+        FPermissionStatement(FPermissionStatement&& src) :
+            FPlayFabCppBaseModel(),
+            Action(MoveTemp(src.Action)),
+            ApiConditions(MoveTemp(src.ApiConditions)),
+            Comment(MoveTemp(src.Comment)),
+            Effect(MoveTemp(src.Effect)),
+            Principal(MoveTemp(src.Principal)),
+            Resource(MoveTemp(src.Resource))
+            {}
+
+        FPermissionStatement& operator=(const FPermissionStatement& src) = default;
+        FPermissionStatement& operator=(FPermissionStatement&& src) = default;
+
         FPermissionStatement(const TSharedPtr<FJsonObject>& obj) : FPermissionStatement()
         {
             readFromValue(obj);
@@ -7105,7 +9745,13 @@ namespace AdminModels
         ~FPermissionStatement();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPolicyResponse : public PlayFab::FPlayFabCppResultCommon
@@ -7132,6 +9778,16 @@ namespace AdminModels
             Statements(src.Statements)
             {}
 
+        FGetPolicyResponse(FGetPolicyResponse&& src) :
+            FPlayFabCppResultCommon(),
+            PolicyName(MoveTemp(src.PolicyName)),
+            PolicyVersion(MoveTemp(src.PolicyVersion)),
+            Statements(MoveTemp(src.Statements))
+            {}
+
+        FGetPolicyResponse& operator=(const FGetPolicyResponse& src) = default;
+        FGetPolicyResponse& operator=(FGetPolicyResponse&& src) = default;
+
         FGetPolicyResponse(const TSharedPtr<FJsonObject>& obj) : FGetPolicyResponse()
         {
             readFromValue(obj);
@@ -7140,7 +9796,13 @@ namespace AdminModels
         ~FGetPolicyResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPublisherDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7157,6 +9819,14 @@ namespace AdminModels
             Keys(src.Keys)
             {}
 
+        FGetPublisherDataRequest(FGetPublisherDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Keys(MoveTemp(src.Keys))
+            {}
+
+        FGetPublisherDataRequest& operator=(const FGetPublisherDataRequest& src) = default;
+        FGetPublisherDataRequest& operator=(FGetPublisherDataRequest&& src) = default;
+
         FGetPublisherDataRequest(const TSharedPtr<FJsonObject>& obj) : FGetPublisherDataRequest()
         {
             readFromValue(obj);
@@ -7165,7 +9835,13 @@ namespace AdminModels
         ~FGetPublisherDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPublisherDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -7182,6 +9858,14 @@ namespace AdminModels
             Data(src.Data)
             {}
 
+        FGetPublisherDataResult(FGetPublisherDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPublisherDataResult& operator=(const FGetPublisherDataResult& src) = default;
+        FGetPublisherDataResult& operator=(FGetPublisherDataResult&& src) = default;
+
         FGetPublisherDataResult(const TSharedPtr<FJsonObject>& obj) : FGetPublisherDataResult()
         {
             readFromValue(obj);
@@ -7190,7 +9874,13 @@ namespace AdminModels
         ~FGetPublisherDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetRandomResultTablesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7208,6 +9898,14 @@ namespace AdminModels
             CatalogVersion(src.CatalogVersion)
             {}
 
+        FGetRandomResultTablesRequest(FGetRandomResultTablesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion))
+            {}
+
+        FGetRandomResultTablesRequest& operator=(const FGetRandomResultTablesRequest& src) = default;
+        FGetRandomResultTablesRequest& operator=(FGetRandomResultTablesRequest&& src) = default;
+
         FGetRandomResultTablesRequest(const TSharedPtr<FJsonObject>& obj) : FGetRandomResultTablesRequest()
         {
             readFromValue(obj);
@@ -7216,7 +9914,13 @@ namespace AdminModels
         ~FGetRandomResultTablesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum ResultTableNodeType
@@ -7226,6 +9930,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeResultTableNodeTypeEnumJSON(ResultTableNodeType enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeResultTableNodeTypeEnumJSON(ResultTableNodeType enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API ResultTableNodeType readResultTableNodeTypeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API ResultTableNodeType readResultTableNodeTypeFromValue(const FString& value);
 
@@ -7254,6 +9959,16 @@ namespace AdminModels
             Weight(src.Weight)
             {}
 
+        FResultTableNode(FResultTableNode&& src) :
+            FPlayFabCppBaseModel(),
+            ResultItem(MoveTemp(src.ResultItem)),
+            ResultItemType(MoveTemp(src.ResultItemType)),
+            Weight(MoveTemp(src.Weight))
+            {}
+
+        FResultTableNode& operator=(const FResultTableNode& src) = default;
+        FResultTableNode& operator=(FResultTableNode&& src) = default;
+
         FResultTableNode(const TSharedPtr<FJsonObject>& obj) : FResultTableNode()
         {
             readFromValue(obj);
@@ -7262,7 +9977,13 @@ namespace AdminModels
         ~FResultTableNode();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRandomResultTableListing : public PlayFab::FPlayFabCppBaseModel
@@ -7289,6 +10010,16 @@ namespace AdminModels
             TableId(src.TableId)
             {}
 
+        FRandomResultTableListing(FRandomResultTableListing&& src) :
+            FPlayFabCppBaseModel(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            Nodes(MoveTemp(src.Nodes)),
+            TableId(MoveTemp(src.TableId))
+            {}
+
+        FRandomResultTableListing& operator=(const FRandomResultTableListing& src) = default;
+        FRandomResultTableListing& operator=(FRandomResultTableListing&& src) = default;
+
         FRandomResultTableListing(const TSharedPtr<FJsonObject>& obj) : FRandomResultTableListing()
         {
             readFromValue(obj);
@@ -7297,7 +10028,13 @@ namespace AdminModels
         ~FRandomResultTableListing();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetRandomResultTablesResult : public PlayFab::FPlayFabCppResultCommon
@@ -7314,6 +10051,14 @@ namespace AdminModels
             Tables(src.Tables)
             {}
 
+        FGetRandomResultTablesResult(FGetRandomResultTablesResult&& src) :
+            FPlayFabCppResultCommon(),
+            Tables(MoveTemp(src.Tables))
+            {}
+
+        FGetRandomResultTablesResult& operator=(const FGetRandomResultTablesResult& src) = default;
+        FGetRandomResultTablesResult& operator=(FGetRandomResultTablesResult&& src) = default;
+
         FGetRandomResultTablesResult(const TSharedPtr<FJsonObject>& obj) : FGetRandomResultTablesResult()
         {
             readFromValue(obj);
@@ -7322,7 +10067,13 @@ namespace AdminModels
         ~FGetRandomResultTablesResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetSegmentsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7339,6 +10090,14 @@ namespace AdminModels
             SegmentIds(src.SegmentIds)
             {}
 
+        FGetSegmentsRequest(FGetSegmentsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            SegmentIds(MoveTemp(src.SegmentIds))
+            {}
+
+        FGetSegmentsRequest& operator=(const FGetSegmentsRequest& src) = default;
+        FGetSegmentsRequest& operator=(FGetSegmentsRequest&& src) = default;
+
         FGetSegmentsRequest(const TSharedPtr<FJsonObject>& obj) : FGetSegmentsRequest()
         {
             readFromValue(obj);
@@ -7347,7 +10106,13 @@ namespace AdminModels
         ~FGetSegmentsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetSegmentsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -7369,6 +10134,15 @@ namespace AdminModels
             Segments(src.Segments)
             {}
 
+        FGetSegmentsResponse(FGetSegmentsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            ErrorMessage(MoveTemp(src.ErrorMessage)),
+            Segments(MoveTemp(src.Segments))
+            {}
+
+        FGetSegmentsResponse& operator=(const FGetSegmentsResponse& src) = default;
+        FGetSegmentsResponse& operator=(FGetSegmentsResponse&& src) = default;
+
         FGetSegmentsResponse(const TSharedPtr<FJsonObject>& obj) : FGetSegmentsResponse()
         {
             readFromValue(obj);
@@ -7377,7 +10151,13 @@ namespace AdminModels
         ~FGetSegmentsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetServerBuildInfoRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7395,6 +10175,14 @@ namespace AdminModels
             BuildId(src.BuildId)
             {}
 
+        FGetServerBuildInfoRequest(FGetServerBuildInfoRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildId(MoveTemp(src.BuildId))
+            {}
+
+        FGetServerBuildInfoRequest& operator=(const FGetServerBuildInfoRequest& src) = default;
+        FGetServerBuildInfoRequest& operator=(FGetServerBuildInfoRequest&& src) = default;
+
         FGetServerBuildInfoRequest(const TSharedPtr<FJsonObject>& obj) : FGetServerBuildInfoRequest()
         {
             readFromValue(obj);
@@ -7403,7 +10191,13 @@ namespace AdminModels
         ~FGetServerBuildInfoRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetServerBuildInfoResult : public PlayFab::FPlayFabCppResultCommon
@@ -7466,6 +10260,22 @@ namespace AdminModels
             TitleId(src.TitleId)
             {}
 
+        FGetServerBuildInfoResult(FGetServerBuildInfoResult&& src) :
+            FPlayFabCppResultCommon(),
+            ActiveRegions(MoveTemp(src.ActiveRegions)),
+            BuildId(MoveTemp(src.BuildId)),
+            Comment(MoveTemp(src.Comment)),
+            ErrorMessage(MoveTemp(src.ErrorMessage)),
+            MaxGamesPerHost(MoveTemp(src.MaxGamesPerHost)),
+            MinFreeGameSlots(MoveTemp(src.MinFreeGameSlots)),
+            Status(MoveTemp(src.Status)),
+            Timestamp(MoveTemp(src.Timestamp)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FGetServerBuildInfoResult& operator=(const FGetServerBuildInfoResult& src) = default;
+        FGetServerBuildInfoResult& operator=(FGetServerBuildInfoResult&& src) = default;
+
         FGetServerBuildInfoResult(const TSharedPtr<FJsonObject>& obj) : FGetServerBuildInfoResult()
         {
             readFromValue(obj);
@@ -7474,7 +10284,13 @@ namespace AdminModels
         ~FGetServerBuildInfoResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetServerBuildUploadURLRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7492,6 +10308,14 @@ namespace AdminModels
             BuildId(src.BuildId)
             {}
 
+        FGetServerBuildUploadURLRequest(FGetServerBuildUploadURLRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildId(MoveTemp(src.BuildId))
+            {}
+
+        FGetServerBuildUploadURLRequest& operator=(const FGetServerBuildUploadURLRequest& src) = default;
+        FGetServerBuildUploadURLRequest& operator=(FGetServerBuildUploadURLRequest&& src) = default;
+
         FGetServerBuildUploadURLRequest(const TSharedPtr<FJsonObject>& obj) : FGetServerBuildUploadURLRequest()
         {
             readFromValue(obj);
@@ -7500,7 +10324,13 @@ namespace AdminModels
         ~FGetServerBuildUploadURLRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetServerBuildUploadURLResult : public PlayFab::FPlayFabCppResultCommon
@@ -7518,6 +10348,14 @@ namespace AdminModels
             URL(src.URL)
             {}
 
+        FGetServerBuildUploadURLResult(FGetServerBuildUploadURLResult&& src) :
+            FPlayFabCppResultCommon(),
+            URL(MoveTemp(src.URL))
+            {}
+
+        FGetServerBuildUploadURLResult& operator=(const FGetServerBuildUploadURLResult& src) = default;
+        FGetServerBuildUploadURLResult& operator=(FGetServerBuildUploadURLResult&& src) = default;
+
         FGetServerBuildUploadURLResult(const TSharedPtr<FJsonObject>& obj) : FGetServerBuildUploadURLResult()
         {
             readFromValue(obj);
@@ -7526,7 +10364,13 @@ namespace AdminModels
         ~FGetServerBuildUploadURLResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetStoreItemsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7549,6 +10393,15 @@ namespace AdminModels
             StoreId(src.StoreId)
             {}
 
+        FGetStoreItemsRequest(FGetStoreItemsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            StoreId(MoveTemp(src.StoreId))
+            {}
+
+        FGetStoreItemsRequest& operator=(const FGetStoreItemsRequest& src) = default;
+        FGetStoreItemsRequest& operator=(FGetStoreItemsRequest&& src) = default;
+
         FGetStoreItemsRequest(const TSharedPtr<FJsonObject>& obj) : FGetStoreItemsRequest()
         {
             readFromValue(obj);
@@ -7557,7 +10410,13 @@ namespace AdminModels
         ~FGetStoreItemsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStoreMarketingModel : public PlayFab::FPlayFabCppBaseModel
@@ -7585,6 +10444,16 @@ namespace AdminModels
             Metadata(src.Metadata)
             {}
 
+        FStoreMarketingModel(FStoreMarketingModel&& src) :
+            FPlayFabCppBaseModel(),
+            Description(MoveTemp(src.Description)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            Metadata(MoveTemp(src.Metadata))
+            {}
+
+        FStoreMarketingModel& operator=(const FStoreMarketingModel& src) = default;
+        FStoreMarketingModel& operator=(FStoreMarketingModel&& src) = default;
+
         FStoreMarketingModel(const TSharedPtr<FJsonObject>& obj) : FStoreMarketingModel()
         {
             readFromValue(obj);
@@ -7593,7 +10462,13 @@ namespace AdminModels
         ~FStoreMarketingModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum SourceType
@@ -7608,6 +10483,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeSourceTypeEnumJSON(SourceType enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeSourceTypeEnumJSON(SourceType enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API SourceType readSourceTypeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API SourceType readSourceTypeFromValue(const FString& value);
 
@@ -7647,6 +10523,18 @@ namespace AdminModels
             VirtualCurrencyPrices(src.VirtualCurrencyPrices)
             {}
 
+        FStoreItem(FStoreItem&& src) :
+            FPlayFabCppBaseModel(),
+            CustomData(MoveTemp(src.CustomData)),
+            DisplayPosition(MoveTemp(src.DisplayPosition)),
+            ItemId(MoveTemp(src.ItemId)),
+            RealCurrencyPrices(MoveTemp(src.RealCurrencyPrices)),
+            VirtualCurrencyPrices(MoveTemp(src.VirtualCurrencyPrices))
+            {}
+
+        FStoreItem& operator=(const FStoreItem& src) = default;
+        FStoreItem& operator=(FStoreItem&& src) = default;
+
         FStoreItem(const TSharedPtr<FJsonObject>& obj) : FStoreItem()
         {
             readFromValue(obj);
@@ -7655,7 +10543,13 @@ namespace AdminModels
         ~FStoreItem();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetStoreItemsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7686,12 +10580,24 @@ namespace AdminModels
         FGetStoreItemsResult(const FGetStoreItemsResult& src) :
             FPlayFabCppResultCommon(),
             CatalogVersion(src.CatalogVersion),
-            MarketingData(src.MarketingData.IsValid() ? MakeShareable(new FStoreMarketingModel(*src.MarketingData)) : nullptr),
+            MarketingData(src.MarketingData.IsValid() ? TSharedPtr<FStoreMarketingModel>(MakeShared<FStoreMarketingModel>(*src.MarketingData)) : nullptr),
             Source(src.Source),
             Store(src.Store),
             StoreId(src.StoreId)
             {}
 
+        FGetStoreItemsResult(FGetStoreItemsResult&& src) :
+            FPlayFabCppResultCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            MarketingData(MoveTemp(src.MarketingData)),
+            Source(MoveTemp(src.Source)),
+            Store(MoveTemp(src.Store)),
+            StoreId(MoveTemp(src.StoreId))
+            {}
+
+        FGetStoreItemsResult& operator=(const FGetStoreItemsResult& src) = default;
+        FGetStoreItemsResult& operator=(FGetStoreItemsResult&& src) = default;
+
         FGetStoreItemsResult(const TSharedPtr<FJsonObject>& obj) : FGetStoreItemsResult()
         {
             readFromValue(obj);
@@ -7700,7 +10606,13 @@ namespace AdminModels
         ~FGetStoreItemsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTaskInstanceRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7718,6 +10630,14 @@ namespace AdminModels
             TaskInstanceId(src.TaskInstanceId)
             {}
 
+        FGetTaskInstanceRequest(FGetTaskInstanceRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            TaskInstanceId(MoveTemp(src.TaskInstanceId))
+            {}
+
+        FGetTaskInstanceRequest& operator=(const FGetTaskInstanceRequest& src) = default;
+        FGetTaskInstanceRequest& operator=(FGetTaskInstanceRequest&& src) = default;
+
         FGetTaskInstanceRequest(const TSharedPtr<FJsonObject>& obj) : FGetTaskInstanceRequest()
         {
             readFromValue(obj);
@@ -7726,7 +10646,13 @@ namespace AdminModels
         ~FGetTaskInstanceRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTaskInstancesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7759,9 +10685,20 @@ namespace AdminModels
             StartedAtRangeFrom(src.StartedAtRangeFrom),
             StartedAtRangeTo(src.StartedAtRangeTo),
             StatusFilter(src.StatusFilter),
-            TaskIdentifier(src.TaskIdentifier.IsValid() ? MakeShareable(new FNameIdentifier(*src.TaskIdentifier)) : nullptr)
+            TaskIdentifier(src.TaskIdentifier.IsValid() ? TSharedPtr<FNameIdentifier>(MakeShared<FNameIdentifier>(*src.TaskIdentifier)) : nullptr)
+            {}
+
+        FGetTaskInstancesRequest(FGetTaskInstancesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            StartedAtRangeFrom(MoveTemp(src.StartedAtRangeFrom)),
+            StartedAtRangeTo(MoveTemp(src.StartedAtRangeTo)),
+            StatusFilter(MoveTemp(src.StatusFilter)),
+            TaskIdentifier(MoveTemp(src.TaskIdentifier))
             {}
 
+        FGetTaskInstancesRequest& operator=(const FGetTaskInstancesRequest& src) = default;
+        FGetTaskInstancesRequest& operator=(FGetTaskInstancesRequest&& src) = default;
+
         FGetTaskInstancesRequest(const TSharedPtr<FJsonObject>& obj) : FGetTaskInstancesRequest()
         {
             readFromValue(obj);
@@ -7770,7 +10707,13 @@ namespace AdminModels
         ~FGetTaskInstancesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum ScheduledTaskType
@@ -7782,6 +10725,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeScheduledTaskTypeEnumJSON(ScheduledTaskType enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeScheduledTaskTypeEnumJSON(ScheduledTaskType enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API ScheduledTaskType readScheduledTaskTypeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API ScheduledTaskType readScheduledTaskTypeFromValue(const FString& value);
 
@@ -7840,11 +10784,28 @@ namespace AdminModels
             ScheduledByUserId(src.ScheduledByUserId),
             StartedAt(src.StartedAt),
             Status(src.Status),
-            TaskIdentifier(src.TaskIdentifier.IsValid() ? MakeShareable(new FNameIdentifier(*src.TaskIdentifier)) : nullptr),
+            TaskIdentifier(src.TaskIdentifier.IsValid() ? TSharedPtr<FNameIdentifier>(MakeShared<FNameIdentifier>(*src.TaskIdentifier)) : nullptr),
             TaskInstanceId(src.TaskInstanceId),
             Type(src.Type)
             {}
 
+        FTaskInstanceBasicSummary(FTaskInstanceBasicSummary&& src) :
+            FPlayFabCppBaseModel(),
+            CompletedAt(MoveTemp(src.CompletedAt)),
+            ErrorMessage(MoveTemp(src.ErrorMessage)),
+            EstimatedSecondsRemaining(MoveTemp(src.EstimatedSecondsRemaining)),
+            PercentComplete(MoveTemp(src.PercentComplete)),
+            ScheduledByUserId(MoveTemp(src.ScheduledByUserId)),
+            StartedAt(MoveTemp(src.StartedAt)),
+            Status(MoveTemp(src.Status)),
+            TaskIdentifier(MoveTemp(src.TaskIdentifier)),
+            TaskInstanceId(MoveTemp(src.TaskInstanceId)),
+            Type(MoveTemp(src.Type))
+            {}
+
+        FTaskInstanceBasicSummary& operator=(const FTaskInstanceBasicSummary& src) = default;
+        FTaskInstanceBasicSummary& operator=(FTaskInstanceBasicSummary&& src) = default;
+
         FTaskInstanceBasicSummary(const TSharedPtr<FJsonObject>& obj) : FTaskInstanceBasicSummary()
         {
             readFromValue(obj);
@@ -7853,7 +10814,13 @@ namespace AdminModels
         ~FTaskInstanceBasicSummary();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTaskInstancesResult : public PlayFab::FPlayFabCppResultCommon
@@ -7874,6 +10841,14 @@ namespace AdminModels
             Summaries(src.Summaries)
             {}
 
+        FGetTaskInstancesResult(FGetTaskInstancesResult&& src) :
+            FPlayFabCppResultCommon(),
+            Summaries(MoveTemp(src.Summaries))
+            {}
+
+        FGetTaskInstancesResult& operator=(const FGetTaskInstancesResult& src) = default;
+        FGetTaskInstancesResult& operator=(FGetTaskInstancesResult&& src) = default;
+
         FGetTaskInstancesResult(const TSharedPtr<FJsonObject>& obj) : FGetTaskInstancesResult()
         {
             readFromValue(obj);
@@ -7882,7 +10857,13 @@ namespace AdminModels
         ~FGetTaskInstancesResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTasksRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7897,9 +10878,17 @@ namespace AdminModels
 
         FGetTasksRequest(const FGetTasksRequest& src) :
             FPlayFabCppRequestCommon(),
-            Identifier(src.Identifier.IsValid() ? MakeShareable(new FNameIdentifier(*src.Identifier)) : nullptr)
+            Identifier(src.Identifier.IsValid() ? TSharedPtr<FNameIdentifier>(MakeShared<FNameIdentifier>(*src.Identifier)) : nullptr)
+            {}
+
+        FGetTasksRequest(FGetTasksRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Identifier(MoveTemp(src.Identifier))
             {}
 
+        FGetTasksRequest& operator=(const FGetTasksRequest& src) = default;
+        FGetTasksRequest& operator=(FGetTasksRequest&& src) = default;
+
         FGetTasksRequest(const TSharedPtr<FJsonObject>& obj) : FGetTasksRequest()
         {
             readFromValue(obj);
@@ -7908,7 +10897,13 @@ namespace AdminModels
         ~FGetTasksRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FScheduledTask : public PlayFab::FPlayFabCppBaseModel
@@ -7969,6 +10964,22 @@ namespace AdminModels
             Type(src.Type)
             {}
 
+        FScheduledTask(FScheduledTask&& src) :
+            FPlayFabCppBaseModel(),
+            Description(MoveTemp(src.Description)),
+            IsActive(MoveTemp(src.IsActive)),
+            LastRunTime(MoveTemp(src.LastRunTime)),
+            Name(MoveTemp(src.Name)),
+            NextRunTime(MoveTemp(src.NextRunTime)),
+            Parameter(MoveTemp(src.Parameter)),
+            Schedule(MoveTemp(src.Schedule)),
+            TaskId(MoveTemp(src.TaskId)),
+            Type(MoveTemp(src.Type))
+            {}
+
+        FScheduledTask& operator=(const FScheduledTask& src) = default;
+        FScheduledTask& operator=(FScheduledTask&& src) = default;
+
         FScheduledTask(const TSharedPtr<FJsonObject>& obj) : FScheduledTask()
         {
             readFromValue(obj);
@@ -7977,7 +10988,13 @@ namespace AdminModels
         ~FScheduledTask();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTasksResult : public PlayFab::FPlayFabCppResultCommon
@@ -7994,6 +11011,14 @@ namespace AdminModels
             Tasks(src.Tasks)
             {}
 
+        FGetTasksResult(FGetTasksResult&& src) :
+            FPlayFabCppResultCommon(),
+            Tasks(MoveTemp(src.Tasks))
+            {}
+
+        FGetTasksResult& operator=(const FGetTasksResult& src) = default;
+        FGetTasksResult& operator=(FGetTasksResult&& src) = default;
+
         FGetTasksResult(const TSharedPtr<FJsonObject>& obj) : FGetTasksResult()
         {
             readFromValue(obj);
@@ -8002,7 +11027,13 @@ namespace AdminModels
         ~FGetTasksResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8027,6 +11058,15 @@ namespace AdminModels
             OverrideLabel(src.OverrideLabel)
             {}
 
+        FGetTitleDataRequest(FGetTitleDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Keys(MoveTemp(src.Keys)),
+            OverrideLabel(MoveTemp(src.OverrideLabel))
+            {}
+
+        FGetTitleDataRequest& operator=(const FGetTitleDataRequest& src) = default;
+        FGetTitleDataRequest& operator=(FGetTitleDataRequest&& src) = default;
+
         FGetTitleDataRequest(const TSharedPtr<FJsonObject>& obj) : FGetTitleDataRequest()
         {
             readFromValue(obj);
@@ -8035,7 +11075,13 @@ namespace AdminModels
         ~FGetTitleDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -8052,6 +11098,14 @@ namespace AdminModels
             Data(src.Data)
             {}
 
+        FGetTitleDataResult(FGetTitleDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetTitleDataResult& operator=(const FGetTitleDataResult& src) = default;
+        FGetTitleDataResult& operator=(FGetTitleDataResult&& src) = default;
+
         FGetTitleDataResult(const TSharedPtr<FJsonObject>& obj) : FGetTitleDataResult()
         {
             readFromValue(obj);
@@ -8060,7 +11114,13 @@ namespace AdminModels
         ~FGetTitleDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserBansRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8078,6 +11138,14 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetUserBansRequest(FGetUserBansRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetUserBansRequest& operator=(const FGetUserBansRequest& src) = default;
+        FGetUserBansRequest& operator=(FGetUserBansRequest&& src) = default;
+
         FGetUserBansRequest(const TSharedPtr<FJsonObject>& obj) : FGetUserBansRequest()
         {
             readFromValue(obj);
@@ -8086,7 +11154,13 @@ namespace AdminModels
         ~FGetUserBansRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserBansResult : public PlayFab::FPlayFabCppResultCommon
@@ -8103,6 +11177,14 @@ namespace AdminModels
             BanData(src.BanData)
             {}
 
+        FGetUserBansResult(FGetUserBansResult&& src) :
+            FPlayFabCppResultCommon(),
+            BanData(MoveTemp(src.BanData))
+            {}
+
+        FGetUserBansResult& operator=(const FGetUserBansResult& src) = default;
+        FGetUserBansResult& operator=(FGetUserBansResult&& src) = default;
+
         FGetUserBansResult(const TSharedPtr<FJsonObject>& obj) : FGetUserBansResult()
         {
             readFromValue(obj);
@@ -8111,7 +11193,13 @@ namespace AdminModels
         ~FGetUserBansResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8141,6 +11229,16 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetUserDataRequest(FGetUserDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            IfChangedFromDataVersion(MoveTemp(src.IfChangedFromDataVersion)),
+            Keys(MoveTemp(src.Keys)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetUserDataRequest& operator=(const FGetUserDataRequest& src) = default;
+        FGetUserDataRequest& operator=(FGetUserDataRequest&& src) = default;
+
         FGetUserDataRequest(const TSharedPtr<FJsonObject>& obj) : FGetUserDataRequest()
         {
             readFromValue(obj);
@@ -8149,7 +11247,13 @@ namespace AdminModels
         ~FGetUserDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum UserDataPermission
@@ -8159,6 +11263,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeUserDataPermissionEnumJSON(UserDataPermission enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeUserDataPermissionEnumJSON(UserDataPermission enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API UserDataPermission readUserDataPermissionFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API UserDataPermission readUserDataPermissionFromValue(const FString& value);
 
@@ -8190,6 +11295,16 @@ namespace AdminModels
             Value(src.Value)
             {}
 
+        FUserDataRecord(FUserDataRecord&& src) :
+            FPlayFabCppBaseModel(),
+            LastUpdated(MoveTemp(src.LastUpdated)),
+            Permission(MoveTemp(src.Permission)),
+            Value(MoveTemp(src.Value))
+            {}
+
+        FUserDataRecord& operator=(const FUserDataRecord& src) = default;
+        FUserDataRecord& operator=(FUserDataRecord&& src) = default;
+
         FUserDataRecord(const TSharedPtr<FJsonObject>& obj) : FUserDataRecord()
         {
             readFromValue(obj);
@@ -8198,7 +11313,13 @@ namespace AdminModels
         ~FUserDataRecord();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -8228,6 +11349,16 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetUserDataResult(FGetUserDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data)),
+            DataVersion(MoveTemp(src.DataVersion)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetUserDataResult& operator=(const FGetUserDataResult& src) = default;
+        FGetUserDataResult& operator=(FGetUserDataResult&& src) = default;
+
         FGetUserDataResult(const TSharedPtr<FJsonObject>& obj) : FGetUserDataResult()
         {
             readFromValue(obj);
@@ -8236,7 +11367,13 @@ namespace AdminModels
         ~FGetUserDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserInventoryRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8258,6 +11395,15 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetUserInventoryRequest(FGetUserInventoryRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetUserInventoryRequest& operator=(const FGetUserInventoryRequest& src) = default;
+        FGetUserInventoryRequest& operator=(FGetUserInventoryRequest&& src) = default;
+
         FGetUserInventoryRequest(const TSharedPtr<FJsonObject>& obj) : FGetUserInventoryRequest()
         {
             readFromValue(obj);
@@ -8266,7 +11412,13 @@ namespace AdminModels
         ~FGetUserInventoryRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FItemInstance : public PlayFab::FPlayFabCppBaseModel
@@ -8358,6 +11510,28 @@ namespace AdminModels
             UsesIncrementedBy(src.UsesIncrementedBy)
             {}
 
+        FItemInstance(FItemInstance&& src) :
+            FPlayFabCppBaseModel(),
+            Annotation(MoveTemp(src.Annotation)),
+            BundleContents(MoveTemp(src.BundleContents)),
+            BundleParent(MoveTemp(src.BundleParent)),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomData(MoveTemp(src.CustomData)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            Expiration(MoveTemp(src.Expiration)),
+            ItemClass(MoveTemp(src.ItemClass)),
+            ItemId(MoveTemp(src.ItemId)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            PurchaseDate(MoveTemp(src.PurchaseDate)),
+            RemainingUses(MoveTemp(src.RemainingUses)),
+            UnitCurrency(MoveTemp(src.UnitCurrency)),
+            UnitPrice(MoveTemp(src.UnitPrice)),
+            UsesIncrementedBy(MoveTemp(src.UsesIncrementedBy))
+            {}
+
+        FItemInstance& operator=(const FItemInstance& src) = default;
+        FItemInstance& operator=(FItemInstance&& src) = default;
+
         FItemInstance(const TSharedPtr<FJsonObject>& obj) : FItemInstance()
         {
             readFromValue(obj);
@@ -8366,7 +11540,13 @@ namespace AdminModels
         ~FItemInstance();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FVirtualCurrencyRechargeTime : public PlayFab::FPlayFabCppBaseModel
@@ -8398,6 +11578,16 @@ namespace AdminModels
             SecondsToRecharge(src.SecondsToRecharge)
             {}
 
+        FVirtualCurrencyRechargeTime(FVirtualCurrencyRechargeTime&& src) :
+            FPlayFabCppBaseModel(),
+            RechargeMax(MoveTemp(src.RechargeMax)),
+            RechargeTime(MoveTemp(src.RechargeTime)),
+            SecondsToRecharge(MoveTemp(src.SecondsToRecharge))
+            {}
+
+        FVirtualCurrencyRechargeTime& operator=(const FVirtualCurrencyRechargeTime& src) = default;
+        FVirtualCurrencyRechargeTime& operator=(FVirtualCurrencyRechargeTime&& src) = default;
+
         FVirtualCurrencyRechargeTime(const TSharedPtr<FJsonObject>& obj) : FVirtualCurrencyRechargeTime()
         {
             readFromValue(obj);
@@ -8406,7 +11596,13 @@ namespace AdminModels
         ~FVirtualCurrencyRechargeTime();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserInventoryResult : public PlayFab::FPlayFabCppResultCommon
@@ -8436,6 +11632,17 @@ namespace AdminModels
             VirtualCurrencyRechargeTimes(src.VirtualCurrencyRechargeTimes)
             {}
 
+        FGetUserInventoryResult(FGetUserInventoryResult&& src) :
+            FPlayFabCppResultCommon(),
+            Inventory(MoveTemp(src.Inventory)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency)),
+            VirtualCurrencyRechargeTimes(MoveTemp(src.VirtualCurrencyRechargeTimes))
+            {}
+
+        FGetUserInventoryResult& operator=(const FGetUserInventoryResult& src) = default;
+        FGetUserInventoryResult& operator=(FGetUserInventoryResult&& src) = default;
+
         FGetUserInventoryResult(const TSharedPtr<FJsonObject>& obj) : FGetUserInventoryResult()
         {
             readFromValue(obj);
@@ -8444,7 +11651,13 @@ namespace AdminModels
         ~FGetUserInventoryResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGrantedItemInstance : public PlayFab::FPlayFabCppBaseModel
@@ -8551,6 +11764,31 @@ namespace AdminModels
             UsesIncrementedBy(src.UsesIncrementedBy)
             {}
 
+        FGrantedItemInstance(FGrantedItemInstance&& src) :
+            FPlayFabCppBaseModel(),
+            Annotation(MoveTemp(src.Annotation)),
+            BundleContents(MoveTemp(src.BundleContents)),
+            BundleParent(MoveTemp(src.BundleParent)),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomData(MoveTemp(src.CustomData)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            Expiration(MoveTemp(src.Expiration)),
+            ItemClass(MoveTemp(src.ItemClass)),
+            ItemId(MoveTemp(src.ItemId)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            PurchaseDate(MoveTemp(src.PurchaseDate)),
+            RemainingUses(MoveTemp(src.RemainingUses)),
+            Result(MoveTemp(src.Result)),
+            UnitCurrency(MoveTemp(src.UnitCurrency)),
+            UnitPrice(MoveTemp(src.UnitPrice)),
+            UsesIncrementedBy(MoveTemp(src.UsesIncrementedBy))
+            {}
+
+        FGrantedItemInstance& operator=(const FGrantedItemInstance& src) = default;
+        FGrantedItemInstance& operator=(FGrantedItemInstance&& src) = default;
+
         FGrantedItemInstance(const TSharedPtr<FJsonObject>& obj) : FGrantedItemInstance()
         {
             readFromValue(obj);
@@ -8559,7 +11797,13 @@ namespace AdminModels
         ~FGrantedItemInstance();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FItemGrant : public PlayFab::FPlayFabCppBaseModel
@@ -8606,6 +11850,19 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FItemGrant(FItemGrant&& src) :
+            FPlayFabCppBaseModel(),
+            Annotation(MoveTemp(src.Annotation)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            Data(MoveTemp(src.Data)),
+            ItemId(MoveTemp(src.ItemId)),
+            KeysToRemove(MoveTemp(src.KeysToRemove)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FItemGrant& operator=(const FItemGrant& src) = default;
+        FItemGrant& operator=(FItemGrant&& src) = default;
+
         FItemGrant(const TSharedPtr<FJsonObject>& obj) : FItemGrant()
         {
             readFromValue(obj);
@@ -8614,7 +11871,13 @@ namespace AdminModels
         ~FItemGrant();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGrantItemsToUsersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8640,6 +11903,16 @@ namespace AdminModels
             ItemGrants(src.ItemGrants)
             {}
 
+        FGrantItemsToUsersRequest(FGrantItemsToUsersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ItemGrants(MoveTemp(src.ItemGrants))
+            {}
+
+        FGrantItemsToUsersRequest& operator=(const FGrantItemsToUsersRequest& src) = default;
+        FGrantItemsToUsersRequest& operator=(FGrantItemsToUsersRequest&& src) = default;
+
         FGrantItemsToUsersRequest(const TSharedPtr<FJsonObject>& obj) : FGrantItemsToUsersRequest()
         {
             readFromValue(obj);
@@ -8648,7 +11921,13 @@ namespace AdminModels
         ~FGrantItemsToUsersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGrantItemsToUsersResult : public PlayFab::FPlayFabCppResultCommon
@@ -8665,6 +11944,14 @@ namespace AdminModels
             ItemGrantResults(src.ItemGrantResults)
             {}
 
+        FGrantItemsToUsersResult(FGrantItemsToUsersResult&& src) :
+            FPlayFabCppResultCommon(),
+            ItemGrantResults(MoveTemp(src.ItemGrantResults))
+            {}
+
+        FGrantItemsToUsersResult& operator=(const FGrantItemsToUsersResult& src) = default;
+        FGrantItemsToUsersResult& operator=(FGrantItemsToUsersResult&& src) = default;
+
         FGrantItemsToUsersResult(const TSharedPtr<FJsonObject>& obj) : FGrantItemsToUsersResult()
         {
             readFromValue(obj);
@@ -8673,7 +11960,13 @@ namespace AdminModels
         ~FGrantItemsToUsersResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FIncrementLimitedEditionItemAvailabilityRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8705,6 +11998,17 @@ namespace AdminModels
             ItemId(src.ItemId)
             {}
 
+        FIncrementLimitedEditionItemAvailabilityRequest(FIncrementLimitedEditionItemAvailabilityRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Amount(MoveTemp(src.Amount)),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ItemId(MoveTemp(src.ItemId))
+            {}
+
+        FIncrementLimitedEditionItemAvailabilityRequest& operator=(const FIncrementLimitedEditionItemAvailabilityRequest& src) = default;
+        FIncrementLimitedEditionItemAvailabilityRequest& operator=(FIncrementLimitedEditionItemAvailabilityRequest&& src) = default;
+
         FIncrementLimitedEditionItemAvailabilityRequest(const TSharedPtr<FJsonObject>& obj) : FIncrementLimitedEditionItemAvailabilityRequest()
         {
             readFromValue(obj);
@@ -8713,7 +12017,13 @@ namespace AdminModels
         ~FIncrementLimitedEditionItemAvailabilityRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FIncrementLimitedEditionItemAvailabilityResult : public PlayFab::FPlayFabCppResultCommon
@@ -8726,6 +12036,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FIncrementLimitedEditionItemAvailabilityResult(FIncrementLimitedEditionItemAvailabilityResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FIncrementLimitedEditionItemAvailabilityResult& operator=(const FIncrementLimitedEditionItemAvailabilityResult& src) = default;
+        FIncrementLimitedEditionItemAvailabilityResult& operator=(FIncrementLimitedEditionItemAvailabilityResult&& src) = default;
+
         FIncrementLimitedEditionItemAvailabilityResult(const TSharedPtr<FJsonObject>& obj) : FIncrementLimitedEditionItemAvailabilityResult()
         {
             readFromValue(obj);
@@ -8734,7 +12051,13 @@ namespace AdminModels
         ~FIncrementLimitedEditionItemAvailabilityResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FIncrementPlayerStatisticVersionRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8756,6 +12079,15 @@ namespace AdminModels
             StatisticName(src.StatisticName)
             {}
 
+        FIncrementPlayerStatisticVersionRequest(FIncrementPlayerStatisticVersionRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            StatisticName(MoveTemp(src.StatisticName))
+            {}
+
+        FIncrementPlayerStatisticVersionRequest& operator=(const FIncrementPlayerStatisticVersionRequest& src) = default;
+        FIncrementPlayerStatisticVersionRequest& operator=(FIncrementPlayerStatisticVersionRequest&& src) = default;
+
         FIncrementPlayerStatisticVersionRequest(const TSharedPtr<FJsonObject>& obj) : FIncrementPlayerStatisticVersionRequest()
         {
             readFromValue(obj);
@@ -8764,7 +12096,13 @@ namespace AdminModels
         ~FIncrementPlayerStatisticVersionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FIncrementPlayerStatisticVersionResult : public PlayFab::FPlayFabCppResultCommon
@@ -8779,9 +12117,17 @@ namespace AdminModels
 
         FIncrementPlayerStatisticVersionResult(const FIncrementPlayerStatisticVersionResult& src) :
             FPlayFabCppResultCommon(),
-            StatisticVersion(src.StatisticVersion.IsValid() ? MakeShareable(new FPlayerStatisticVersion(*src.StatisticVersion)) : nullptr)
+            StatisticVersion(src.StatisticVersion.IsValid() ? TSharedPtr<FPlayerStatisticVersion>(MakeShared<FPlayerStatisticVersion>(*src.StatisticVersion)) : nullptr)
+            {}
+
+        FIncrementPlayerStatisticVersionResult(FIncrementPlayerStatisticVersionResult&& src) :
+            FPlayFabCppResultCommon(),
+            StatisticVersion(MoveTemp(src.StatisticVersion))
             {}
 
+        FIncrementPlayerStatisticVersionResult& operator=(const FIncrementPlayerStatisticVersionResult& src) = default;
+        FIncrementPlayerStatisticVersionResult& operator=(FIncrementPlayerStatisticVersionResult&& src) = default;
+
         FIncrementPlayerStatisticVersionResult(const TSharedPtr<FJsonObject>& obj) : FIncrementPlayerStatisticVersionResult()
         {
             readFromValue(obj);
@@ -8790,7 +12136,13 @@ namespace AdminModels
         ~FIncrementPlayerStatisticVersionResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListBuildsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8803,6 +12155,13 @@ namespace AdminModels
             FPlayFabCppRequestCommon()
             {}
 
+        FListBuildsRequest(FListBuildsRequest&& src) :
+            FPlayFabCppRequestCommon()
+            {}
+
+        FListBuildsRequest& operator=(const FListBuildsRequest& src) = default;
+        FListBuildsRequest& operator=(FListBuildsRequest&& src) = default;
+
         FListBuildsRequest(const TSharedPtr<FJsonObject>& obj) : FListBuildsRequest()
         {
             readFromValue(obj);
@@ -8811,7 +12170,13 @@ namespace AdminModels
         ~FListBuildsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListBuildsResult : public PlayFab::FPlayFabCppResultCommon
@@ -8828,6 +12193,14 @@ namespace AdminModels
             Builds(src.Builds)
             {}
 
+        FListBuildsResult(FListBuildsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Builds(MoveTemp(src.Builds))
+            {}
+
+        FListBuildsResult& operator=(const FListBuildsResult& src) = default;
+        FListBuildsResult& operator=(FListBuildsResult&& src) = default;
+
         FListBuildsResult(const TSharedPtr<FJsonObject>& obj) : FListBuildsResult()
         {
             readFromValue(obj);
@@ -8836,7 +12209,13 @@ namespace AdminModels
         ~FListBuildsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListOpenIdConnectionRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8849,6 +12228,13 @@ namespace AdminModels
             FPlayFabCppRequestCommon()
             {}
 
+        FListOpenIdConnectionRequest(FListOpenIdConnectionRequest&& src) :
+            FPlayFabCppRequestCommon()
+            {}
+
+        FListOpenIdConnectionRequest& operator=(const FListOpenIdConnectionRequest& src) = default;
+        FListOpenIdConnectionRequest& operator=(FListOpenIdConnectionRequest&& src) = default;
+
         FListOpenIdConnectionRequest(const TSharedPtr<FJsonObject>& obj) : FListOpenIdConnectionRequest()
         {
             readFromValue(obj);
@@ -8857,7 +12243,13 @@ namespace AdminModels
         ~FListOpenIdConnectionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FOpenIdConnection : public PlayFab::FPlayFabCppBaseModel
@@ -8892,9 +12284,21 @@ namespace AdminModels
             ClientSecret(src.ClientSecret),
             ConnectionId(src.ConnectionId),
             DiscoverConfiguration(src.DiscoverConfiguration),
-            IssuerInformation(src.IssuerInformation.IsValid() ? MakeShareable(new FOpenIdIssuerInformation(*src.IssuerInformation)) : nullptr)
+            IssuerInformation(src.IssuerInformation.IsValid() ? TSharedPtr<FOpenIdIssuerInformation>(MakeShared<FOpenIdIssuerInformation>(*src.IssuerInformation)) : nullptr)
+            {}
+
+        FOpenIdConnection(FOpenIdConnection&& src) :
+            FPlayFabCppBaseModel(),
+            ClientId(MoveTemp(src.ClientId)),
+            ClientSecret(MoveTemp(src.ClientSecret)),
+            ConnectionId(MoveTemp(src.ConnectionId)),
+            DiscoverConfiguration(MoveTemp(src.DiscoverConfiguration)),
+            IssuerInformation(MoveTemp(src.IssuerInformation))
             {}
 
+        FOpenIdConnection& operator=(const FOpenIdConnection& src) = default;
+        FOpenIdConnection& operator=(FOpenIdConnection&& src) = default;
+
         FOpenIdConnection(const TSharedPtr<FJsonObject>& obj) : FOpenIdConnection()
         {
             readFromValue(obj);
@@ -8903,7 +12307,13 @@ namespace AdminModels
         ~FOpenIdConnection();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListOpenIdConnectionResponse : public PlayFab::FPlayFabCppResultCommon
@@ -8920,6 +12330,14 @@ namespace AdminModels
             Connections(src.Connections)
             {}
 
+        FListOpenIdConnectionResponse(FListOpenIdConnectionResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Connections(MoveTemp(src.Connections))
+            {}
+
+        FListOpenIdConnectionResponse& operator=(const FListOpenIdConnectionResponse& src) = default;
+        FListOpenIdConnectionResponse& operator=(FListOpenIdConnectionResponse&& src) = default;
+
         FListOpenIdConnectionResponse(const TSharedPtr<FJsonObject>& obj) : FListOpenIdConnectionResponse()
         {
             readFromValue(obj);
@@ -8928,7 +12346,13 @@ namespace AdminModels
         ~FListOpenIdConnectionResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListVirtualCurrencyTypesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8941,6 +12365,13 @@ namespace AdminModels
             FPlayFabCppRequestCommon()
             {}
 
+        FListVirtualCurrencyTypesRequest(FListVirtualCurrencyTypesRequest&& src) :
+            FPlayFabCppRequestCommon()
+            {}
+
+        FListVirtualCurrencyTypesRequest& operator=(const FListVirtualCurrencyTypesRequest& src) = default;
+        FListVirtualCurrencyTypesRequest& operator=(FListVirtualCurrencyTypesRequest&& src) = default;
+
         FListVirtualCurrencyTypesRequest(const TSharedPtr<FJsonObject>& obj) : FListVirtualCurrencyTypesRequest()
         {
             readFromValue(obj);
@@ -8949,7 +12380,13 @@ namespace AdminModels
         ~FListVirtualCurrencyTypesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListVirtualCurrencyTypesResult : public PlayFab::FPlayFabCppResultCommon
@@ -8966,6 +12403,14 @@ namespace AdminModels
             VirtualCurrencies(src.VirtualCurrencies)
             {}
 
+        FListVirtualCurrencyTypesResult(FListVirtualCurrencyTypesResult&& src) :
+            FPlayFabCppResultCommon(),
+            VirtualCurrencies(MoveTemp(src.VirtualCurrencies))
+            {}
+
+        FListVirtualCurrencyTypesResult& operator=(const FListVirtualCurrencyTypesResult& src) = default;
+        FListVirtualCurrencyTypesResult& operator=(FListVirtualCurrencyTypesResult&& src) = default;
+
         FListVirtualCurrencyTypesResult(const TSharedPtr<FJsonObject>& obj) : FListVirtualCurrencyTypesResult()
         {
             readFromValue(obj);
@@ -8974,7 +12419,13 @@ namespace AdminModels
         ~FListVirtualCurrencyTypesResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLookupUserAccountInfoRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9007,6 +12458,17 @@ namespace AdminModels
             Username(src.Username)
             {}
 
+        FLookupUserAccountInfoRequest(FLookupUserAccountInfoRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Email(MoveTemp(src.Email)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            TitleDisplayName(MoveTemp(src.TitleDisplayName)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FLookupUserAccountInfoRequest& operator=(const FLookupUserAccountInfoRequest& src) = default;
+        FLookupUserAccountInfoRequest& operator=(FLookupUserAccountInfoRequest&& src) = default;
+
         FLookupUserAccountInfoRequest(const TSharedPtr<FJsonObject>& obj) : FLookupUserAccountInfoRequest()
         {
             readFromValue(obj);
@@ -9015,7 +12477,13 @@ namespace AdminModels
         ~FLookupUserAccountInfoRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserAndroidDeviceInfo : public PlayFab::FPlayFabCppBaseModel
@@ -9033,6 +12501,14 @@ namespace AdminModels
             AndroidDeviceId(src.AndroidDeviceId)
             {}
 
+        FUserAndroidDeviceInfo(FUserAndroidDeviceInfo&& src) :
+            FPlayFabCppBaseModel(),
+            AndroidDeviceId(MoveTemp(src.AndroidDeviceId))
+            {}
+
+        FUserAndroidDeviceInfo& operator=(const FUserAndroidDeviceInfo& src) = default;
+        FUserAndroidDeviceInfo& operator=(FUserAndroidDeviceInfo&& src) = default;
+
         FUserAndroidDeviceInfo(const TSharedPtr<FJsonObject>& obj) : FUserAndroidDeviceInfo()
         {
             readFromValue(obj);
@@ -9041,7 +12517,13 @@ namespace AdminModels
         ~FUserAndroidDeviceInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserAppleIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -9059,6 +12541,14 @@ namespace AdminModels
             AppleSubjectId(src.AppleSubjectId)
             {}
 
+        FUserAppleIdInfo(FUserAppleIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            AppleSubjectId(MoveTemp(src.AppleSubjectId))
+            {}
+
+        FUserAppleIdInfo& operator=(const FUserAppleIdInfo& src) = default;
+        FUserAppleIdInfo& operator=(FUserAppleIdInfo&& src) = default;
+
         FUserAppleIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserAppleIdInfo()
         {
             readFromValue(obj);
@@ -9067,7 +12557,13 @@ namespace AdminModels
         ~FUserAppleIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserCustomIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -9085,6 +12581,14 @@ namespace AdminModels
             CustomId(src.CustomId)
             {}
 
+        FUserCustomIdInfo(FUserCustomIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            CustomId(MoveTemp(src.CustomId))
+            {}
+
+        FUserCustomIdInfo& operator=(const FUserCustomIdInfo& src) = default;
+        FUserCustomIdInfo& operator=(FUserCustomIdInfo&& src) = default;
+
         FUserCustomIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserCustomIdInfo()
         {
             readFromValue(obj);
@@ -9093,7 +12597,13 @@ namespace AdminModels
         ~FUserCustomIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserFacebookInfo : public PlayFab::FPlayFabCppBaseModel
@@ -9116,6 +12626,15 @@ namespace AdminModels
             FullName(src.FullName)
             {}
 
+        FUserFacebookInfo(FUserFacebookInfo&& src) :
+            FPlayFabCppBaseModel(),
+            FacebookId(MoveTemp(src.FacebookId)),
+            FullName(MoveTemp(src.FullName))
+            {}
+
+        FUserFacebookInfo& operator=(const FUserFacebookInfo& src) = default;
+        FUserFacebookInfo& operator=(FUserFacebookInfo&& src) = default;
+
         FUserFacebookInfo(const TSharedPtr<FJsonObject>& obj) : FUserFacebookInfo()
         {
             readFromValue(obj);
@@ -9124,7 +12643,13 @@ namespace AdminModels
         ~FUserFacebookInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserFacebookInstantGamesIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -9142,6 +12667,14 @@ namespace AdminModels
             FacebookInstantGamesId(src.FacebookInstantGamesId)
             {}
 
+        FUserFacebookInstantGamesIdInfo(FUserFacebookInstantGamesIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            FacebookInstantGamesId(MoveTemp(src.FacebookInstantGamesId))
+            {}
+
+        FUserFacebookInstantGamesIdInfo& operator=(const FUserFacebookInstantGamesIdInfo& src) = default;
+        FUserFacebookInstantGamesIdInfo& operator=(FUserFacebookInstantGamesIdInfo&& src) = default;
+
         FUserFacebookInstantGamesIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserFacebookInstantGamesIdInfo()
         {
             readFromValue(obj);
@@ -9150,7 +12683,13 @@ namespace AdminModels
         ~FUserFacebookInstantGamesIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserGameCenterInfo : public PlayFab::FPlayFabCppBaseModel
@@ -9168,6 +12707,14 @@ namespace AdminModels
             GameCenterId(src.GameCenterId)
             {}
 
+        FUserGameCenterInfo(FUserGameCenterInfo&& src) :
+            FPlayFabCppBaseModel(),
+            GameCenterId(MoveTemp(src.GameCenterId))
+            {}
+
+        FUserGameCenterInfo& operator=(const FUserGameCenterInfo& src) = default;
+        FUserGameCenterInfo& operator=(FUserGameCenterInfo&& src) = default;
+
         FUserGameCenterInfo(const TSharedPtr<FJsonObject>& obj) : FUserGameCenterInfo()
         {
             readFromValue(obj);
@@ -9176,7 +12723,13 @@ namespace AdminModels
         ~FUserGameCenterInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserGoogleInfo : public PlayFab::FPlayFabCppBaseModel
@@ -9214,6 +12767,18 @@ namespace AdminModels
             GoogleName(src.GoogleName)
             {}
 
+        FUserGoogleInfo(FUserGoogleInfo&& src) :
+            FPlayFabCppBaseModel(),
+            GoogleEmail(MoveTemp(src.GoogleEmail)),
+            GoogleGender(MoveTemp(src.GoogleGender)),
+            GoogleId(MoveTemp(src.GoogleId)),
+            GoogleLocale(MoveTemp(src.GoogleLocale)),
+            GoogleName(MoveTemp(src.GoogleName))
+            {}
+
+        FUserGoogleInfo& operator=(const FUserGoogleInfo& src) = default;
+        FUserGoogleInfo& operator=(FUserGoogleInfo&& src) = default;
+
         FUserGoogleInfo(const TSharedPtr<FJsonObject>& obj) : FUserGoogleInfo()
         {
             readFromValue(obj);
@@ -9222,7 +12787,13 @@ namespace AdminModels
         ~FUserGoogleInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserIosDeviceInfo : public PlayFab::FPlayFabCppBaseModel
@@ -9240,6 +12811,14 @@ namespace AdminModels
             IosDeviceId(src.IosDeviceId)
             {}
 
+        FUserIosDeviceInfo(FUserIosDeviceInfo&& src) :
+            FPlayFabCppBaseModel(),
+            IosDeviceId(MoveTemp(src.IosDeviceId))
+            {}
+
+        FUserIosDeviceInfo& operator=(const FUserIosDeviceInfo& src) = default;
+        FUserIosDeviceInfo& operator=(FUserIosDeviceInfo&& src) = default;
+
         FUserIosDeviceInfo(const TSharedPtr<FJsonObject>& obj) : FUserIosDeviceInfo()
         {
             readFromValue(obj);
@@ -9248,7 +12827,13 @@ namespace AdminModels
         ~FUserIosDeviceInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserKongregateInfo : public PlayFab::FPlayFabCppBaseModel
@@ -9271,6 +12856,15 @@ namespace AdminModels
             KongregateName(src.KongregateName)
             {}
 
+        FUserKongregateInfo(FUserKongregateInfo&& src) :
+            FPlayFabCppBaseModel(),
+            KongregateId(MoveTemp(src.KongregateId)),
+            KongregateName(MoveTemp(src.KongregateName))
+            {}
+
+        FUserKongregateInfo& operator=(const FUserKongregateInfo& src) = default;
+        FUserKongregateInfo& operator=(FUserKongregateInfo&& src) = default;
+
         FUserKongregateInfo(const TSharedPtr<FJsonObject>& obj) : FUserKongregateInfo()
         {
             readFromValue(obj);
@@ -9279,7 +12873,13 @@ namespace AdminModels
         ~FUserKongregateInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserNintendoSwitchAccountIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -9297,6 +12897,14 @@ namespace AdminModels
             NintendoSwitchAccountSubjectId(src.NintendoSwitchAccountSubjectId)
             {}
 
+        FUserNintendoSwitchAccountIdInfo(FUserNintendoSwitchAccountIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            NintendoSwitchAccountSubjectId(MoveTemp(src.NintendoSwitchAccountSubjectId))
+            {}
+
+        FUserNintendoSwitchAccountIdInfo& operator=(const FUserNintendoSwitchAccountIdInfo& src) = default;
+        FUserNintendoSwitchAccountIdInfo& operator=(FUserNintendoSwitchAccountIdInfo&& src) = default;
+
         FUserNintendoSwitchAccountIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserNintendoSwitchAccountIdInfo()
         {
             readFromValue(obj);
@@ -9305,7 +12913,13 @@ namespace AdminModels
         ~FUserNintendoSwitchAccountIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserNintendoSwitchDeviceIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -9323,6 +12937,14 @@ namespace AdminModels
             NintendoSwitchDeviceId(src.NintendoSwitchDeviceId)
             {}
 
+        FUserNintendoSwitchDeviceIdInfo(FUserNintendoSwitchDeviceIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            NintendoSwitchDeviceId(MoveTemp(src.NintendoSwitchDeviceId))
+            {}
+
+        FUserNintendoSwitchDeviceIdInfo& operator=(const FUserNintendoSwitchDeviceIdInfo& src) = default;
+        FUserNintendoSwitchDeviceIdInfo& operator=(FUserNintendoSwitchDeviceIdInfo&& src) = default;
+
         FUserNintendoSwitchDeviceIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserNintendoSwitchDeviceIdInfo()
         {
             readFromValue(obj);
@@ -9331,7 +12953,13 @@ namespace AdminModels
         ~FUserNintendoSwitchDeviceIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserOpenIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -9359,6 +12987,16 @@ namespace AdminModels
             Subject(src.Subject)
             {}
 
+        FUserOpenIdInfo(FUserOpenIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            ConnectionId(MoveTemp(src.ConnectionId)),
+            Issuer(MoveTemp(src.Issuer)),
+            Subject(MoveTemp(src.Subject))
+            {}
+
+        FUserOpenIdInfo& operator=(const FUserOpenIdInfo& src) = default;
+        FUserOpenIdInfo& operator=(FUserOpenIdInfo&& src) = default;
+
         FUserOpenIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserOpenIdInfo()
         {
             readFromValue(obj);
@@ -9367,7 +13005,13 @@ namespace AdminModels
         ~FUserOpenIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserPrivateAccountInfo : public PlayFab::FPlayFabCppBaseModel
@@ -9385,6 +13029,14 @@ namespace AdminModels
             Email(src.Email)
             {}
 
+        FUserPrivateAccountInfo(FUserPrivateAccountInfo&& src) :
+            FPlayFabCppBaseModel(),
+            Email(MoveTemp(src.Email))
+            {}
+
+        FUserPrivateAccountInfo& operator=(const FUserPrivateAccountInfo& src) = default;
+        FUserPrivateAccountInfo& operator=(FUserPrivateAccountInfo&& src) = default;
+
         FUserPrivateAccountInfo(const TSharedPtr<FJsonObject>& obj) : FUserPrivateAccountInfo()
         {
             readFromValue(obj);
@@ -9393,7 +13045,13 @@ namespace AdminModels
         ~FUserPrivateAccountInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserPsnInfo : public PlayFab::FPlayFabCppBaseModel
@@ -9416,6 +13074,15 @@ namespace AdminModels
             PsnOnlineId(src.PsnOnlineId)
             {}
 
+        FUserPsnInfo(FUserPsnInfo&& src) :
+            FPlayFabCppBaseModel(),
+            PsnAccountId(MoveTemp(src.PsnAccountId)),
+            PsnOnlineId(MoveTemp(src.PsnOnlineId))
+            {}
+
+        FUserPsnInfo& operator=(const FUserPsnInfo& src) = default;
+        FUserPsnInfo& operator=(FUserPsnInfo&& src) = default;
+
         FUserPsnInfo(const TSharedPtr<FJsonObject>& obj) : FUserPsnInfo()
         {
             readFromValue(obj);
@@ -9424,7 +13091,13 @@ namespace AdminModels
         ~FUserPsnInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum TitleActivationStatus
@@ -9437,6 +13110,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeTitleActivationStatusEnumJSON(TitleActivationStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeTitleActivationStatusEnumJSON(TitleActivationStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API TitleActivationStatus readTitleActivationStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API TitleActivationStatus readTitleActivationStatusFromValue(const FString& value);
 
@@ -9475,6 +13149,18 @@ namespace AdminModels
             SteamName(src.SteamName)
             {}
 
+        FUserSteamInfo(FUserSteamInfo&& src) :
+            FPlayFabCppBaseModel(),
+            SteamActivationStatus(MoveTemp(src.SteamActivationStatus)),
+            SteamCountry(MoveTemp(src.SteamCountry)),
+            SteamCurrency(MoveTemp(src.SteamCurrency)),
+            SteamId(MoveTemp(src.SteamId)),
+            SteamName(MoveTemp(src.SteamName))
+            {}
+
+        FUserSteamInfo& operator=(const FUserSteamInfo& src) = default;
+        FUserSteamInfo& operator=(FUserSteamInfo&& src) = default;
+
         FUserSteamInfo(const TSharedPtr<FJsonObject>& obj) : FUserSteamInfo()
         {
             readFromValue(obj);
@@ -9483,7 +13169,13 @@ namespace AdminModels
         ~FUserSteamInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum UserOrigination
@@ -9515,6 +13207,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeUserOriginationEnumJSON(UserOrigination enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeUserOriginationEnumJSON(UserOrigination enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API UserOrigination readUserOriginationFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API UserOrigination readUserOriginationFromValue(const FString& value);
 
@@ -9571,9 +13264,24 @@ namespace AdminModels
             isBanned(src.isBanned),
             LastLogin(src.LastLogin),
             Origination(src.Origination),
-            TitlePlayerAccount(src.TitlePlayerAccount.IsValid() ? MakeShareable(new FEntityKey(*src.TitlePlayerAccount)) : nullptr)
+            TitlePlayerAccount(src.TitlePlayerAccount.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.TitlePlayerAccount)) : nullptr)
+            {}
+
+        FUserTitleInfo(FUserTitleInfo&& src) :
+            FPlayFabCppBaseModel(),
+            AvatarUrl(MoveTemp(src.AvatarUrl)),
+            Created(MoveTemp(src.Created)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            FirstLogin(MoveTemp(src.FirstLogin)),
+            isBanned(MoveTemp(src.isBanned)),
+            LastLogin(MoveTemp(src.LastLogin)),
+            Origination(MoveTemp(src.Origination)),
+            TitlePlayerAccount(MoveTemp(src.TitlePlayerAccount))
             {}
 
+        FUserTitleInfo& operator=(const FUserTitleInfo& src) = default;
+        FUserTitleInfo& operator=(FUserTitleInfo&& src) = default;
+
         FUserTitleInfo(const TSharedPtr<FJsonObject>& obj) : FUserTitleInfo()
         {
             readFromValue(obj);
@@ -9582,7 +13290,13 @@ namespace AdminModels
         ~FUserTitleInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserTwitchInfo : public PlayFab::FPlayFabCppBaseModel
@@ -9605,6 +13319,15 @@ namespace AdminModels
             TwitchUserName(src.TwitchUserName)
             {}
 
+        FUserTwitchInfo(FUserTwitchInfo&& src) :
+            FPlayFabCppBaseModel(),
+            TwitchId(MoveTemp(src.TwitchId)),
+            TwitchUserName(MoveTemp(src.TwitchUserName))
+            {}
+
+        FUserTwitchInfo& operator=(const FUserTwitchInfo& src) = default;
+        FUserTwitchInfo& operator=(FUserTwitchInfo&& src) = default;
+
         FUserTwitchInfo(const TSharedPtr<FJsonObject>& obj) : FUserTwitchInfo()
         {
             readFromValue(obj);
@@ -9613,7 +13336,13 @@ namespace AdminModels
         ~FUserTwitchInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserWindowsHelloInfo : public PlayFab::FPlayFabCppBaseModel
@@ -9636,6 +13365,15 @@ namespace AdminModels
             WindowsHelloPublicKeyHash(src.WindowsHelloPublicKeyHash)
             {}
 
+        FUserWindowsHelloInfo(FUserWindowsHelloInfo&& src) :
+            FPlayFabCppBaseModel(),
+            WindowsHelloDeviceName(MoveTemp(src.WindowsHelloDeviceName)),
+            WindowsHelloPublicKeyHash(MoveTemp(src.WindowsHelloPublicKeyHash))
+            {}
+
+        FUserWindowsHelloInfo& operator=(const FUserWindowsHelloInfo& src) = default;
+        FUserWindowsHelloInfo& operator=(FUserWindowsHelloInfo&& src) = default;
+
         FUserWindowsHelloInfo(const TSharedPtr<FJsonObject>& obj) : FUserWindowsHelloInfo()
         {
             readFromValue(obj);
@@ -9644,7 +13382,13 @@ namespace AdminModels
         ~FUserWindowsHelloInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserXboxInfo : public PlayFab::FPlayFabCppBaseModel
@@ -9662,6 +13406,14 @@ namespace AdminModels
             XboxUserId(src.XboxUserId)
             {}
 
+        FUserXboxInfo(FUserXboxInfo&& src) :
+            FPlayFabCppBaseModel(),
+            XboxUserId(MoveTemp(src.XboxUserId))
+            {}
+
+        FUserXboxInfo& operator=(const FUserXboxInfo& src) = default;
+        FUserXboxInfo& operator=(FUserXboxInfo&& src) = default;
+
         FUserXboxInfo(const TSharedPtr<FJsonObject>& obj) : FUserXboxInfo()
         {
             readFromValue(obj);
@@ -9670,7 +13422,13 @@ namespace AdminModels
         ~FUserXboxInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserAccountInfo : public PlayFab::FPlayFabCppBaseModel
@@ -9768,30 +13526,59 @@ namespace AdminModels
 
         FUserAccountInfo(const FUserAccountInfo& src) :
             FPlayFabCppBaseModel(),
-            AndroidDeviceInfo(src.AndroidDeviceInfo.IsValid() ? MakeShareable(new FUserAndroidDeviceInfo(*src.AndroidDeviceInfo)) : nullptr),
-            AppleAccountInfo(src.AppleAccountInfo.IsValid() ? MakeShareable(new FUserAppleIdInfo(*src.AppleAccountInfo)) : nullptr),
+            AndroidDeviceInfo(src.AndroidDeviceInfo.IsValid() ? TSharedPtr<FUserAndroidDeviceInfo>(MakeShared<FUserAndroidDeviceInfo>(*src.AndroidDeviceInfo)) : nullptr),
+            AppleAccountInfo(src.AppleAccountInfo.IsValid() ? TSharedPtr<FUserAppleIdInfo>(MakeShared<FUserAppleIdInfo>(*src.AppleAccountInfo)) : nullptr),
             Created(src.Created),
-            CustomIdInfo(src.CustomIdInfo.IsValid() ? MakeShareable(new FUserCustomIdInfo(*src.CustomIdInfo)) : nullptr),
-            FacebookInfo(src.FacebookInfo.IsValid() ? MakeShareable(new FUserFacebookInfo(*src.FacebookInfo)) : nullptr),
-            FacebookInstantGamesIdInfo(src.FacebookInstantGamesIdInfo.IsValid() ? MakeShareable(new FUserFacebookInstantGamesIdInfo(*src.FacebookInstantGamesIdInfo)) : nullptr),
-            GameCenterInfo(src.GameCenterInfo.IsValid() ? MakeShareable(new FUserGameCenterInfo(*src.GameCenterInfo)) : nullptr),
-            GoogleInfo(src.GoogleInfo.IsValid() ? MakeShareable(new FUserGoogleInfo(*src.GoogleInfo)) : nullptr),
-            IosDeviceInfo(src.IosDeviceInfo.IsValid() ? MakeShareable(new FUserIosDeviceInfo(*src.IosDeviceInfo)) : nullptr),
-            KongregateInfo(src.KongregateInfo.IsValid() ? MakeShareable(new FUserKongregateInfo(*src.KongregateInfo)) : nullptr),
-            NintendoSwitchAccountInfo(src.NintendoSwitchAccountInfo.IsValid() ? MakeShareable(new FUserNintendoSwitchAccountIdInfo(*src.NintendoSwitchAccountInfo)) : nullptr),
-            NintendoSwitchDeviceIdInfo(src.NintendoSwitchDeviceIdInfo.IsValid() ? MakeShareable(new FUserNintendoSwitchDeviceIdInfo(*src.NintendoSwitchDeviceIdInfo)) : nullptr),
+            CustomIdInfo(src.CustomIdInfo.IsValid() ? TSharedPtr<FUserCustomIdInfo>(MakeShared<FUserCustomIdInfo>(*src.CustomIdInfo)) : nullptr),
+            FacebookInfo(src.FacebookInfo.IsValid() ? TSharedPtr<FUserFacebookInfo>(MakeShared<FUserFacebookInfo>(*src.FacebookInfo)) : nullptr),
+            FacebookInstantGamesIdInfo(src.FacebookInstantGamesIdInfo.IsValid() ? TSharedPtr<FUserFacebookInstantGamesIdInfo>(MakeShared<FUserFacebookInstantGamesIdInfo>(*src.FacebookInstantGamesIdInfo)) : nullptr),
+            GameCenterInfo(src.GameCenterInfo.IsValid() ? TSharedPtr<FUserGameCenterInfo>(MakeShared<FUserGameCenterInfo>(*src.GameCenterInfo)) : nullptr),
+            GoogleInfo(src.GoogleInfo.IsValid() ? TSharedPtr<FUserGoogleInfo>(MakeShared<FUserGoogleInfo>(*src.GoogleInfo)) : nullptr),
+            IosDeviceInfo(src.IosDeviceInfo.IsValid() ? TSharedPtr<FUserIosDeviceInfo>(MakeShared<FUserIosDeviceInfo>(*src.IosDeviceInfo)) : nullptr),
+            KongregateInfo(src.KongregateInfo.IsValid() ? TSharedPtr<FUserKongregateInfo>(MakeShared<FUserKongregateInfo>(*src.KongregateInfo)) : nullptr),
+            NintendoSwitchAccountInfo(src.NintendoSwitchAccountInfo.IsValid() ? TSharedPtr<FUserNintendoSwitchAccountIdInfo>(MakeShared<FUserNintendoSwitchAccountIdInfo>(*src.NintendoSwitchAccountInfo)) : nullptr),
+            NintendoSwitchDeviceIdInfo(src.NintendoSwitchDeviceIdInfo.IsValid() ? TSharedPtr<FUserNintendoSwitchDeviceIdInfo>(MakeShared<FUserNintendoSwitchDeviceIdInfo>(*src.NintendoSwitchDeviceIdInfo)) : nullptr),
             OpenIdInfo(src.OpenIdInfo),
             PlayFabId(src.PlayFabId),
-            PrivateInfo(src.PrivateInfo.IsValid() ? MakeShareable(new FUserPrivateAccountInfo(*src.PrivateInfo)) : nullptr),
-            PsnInfo(src.PsnInfo.IsValid() ? MakeShareable(new FUserPsnInfo(*src.PsnInfo)) : nullptr),
-            SteamInfo(src.SteamInfo.IsValid() ? MakeShareable(new FUserSteamInfo(*src.SteamInfo)) : nullptr),
-            TitleInfo(src.TitleInfo.IsValid() ? MakeShareable(new FUserTitleInfo(*src.TitleInfo)) : nullptr),
-            TwitchInfo(src.TwitchInfo.IsValid() ? MakeShareable(new FUserTwitchInfo(*src.TwitchInfo)) : nullptr),
+            PrivateInfo(src.PrivateInfo.IsValid() ? TSharedPtr<FUserPrivateAccountInfo>(MakeShared<FUserPrivateAccountInfo>(*src.PrivateInfo)) : nullptr),
+            PsnInfo(src.PsnInfo.IsValid() ? TSharedPtr<FUserPsnInfo>(MakeShared<FUserPsnInfo>(*src.PsnInfo)) : nullptr),
+            SteamInfo(src.SteamInfo.IsValid() ? TSharedPtr<FUserSteamInfo>(MakeShared<FUserSteamInfo>(*src.SteamInfo)) : nullptr),
+            TitleInfo(src.TitleInfo.IsValid() ? TSharedPtr<FUserTitleInfo>(MakeShared<FUserTitleInfo>(*src.TitleInfo)) : nullptr),
+            TwitchInfo(src.TwitchInfo.IsValid() ? TSharedPtr<FUserTwitchInfo>(MakeShared<FUserTwitchInfo>(*src.TwitchInfo)) : nullptr),
             Username(src.Username),
-            WindowsHelloInfo(src.WindowsHelloInfo.IsValid() ? MakeShareable(new FUserWindowsHelloInfo(*src.WindowsHelloInfo)) : nullptr),
-            XboxInfo(src.XboxInfo.IsValid() ? MakeShareable(new FUserXboxInfo(*src.XboxInfo)) : nullptr)
+            WindowsHelloInfo(src.WindowsHelloInfo.IsValid() ? TSharedPtr<FUserWindowsHelloInfo>(MakeShared<FUserWindowsHelloInfo>(*src.WindowsHelloInfo)) : nullptr),
+            XboxInfo(src.XboxInfo.IsValid() ? TSharedPtr<FUserXboxInfo>(MakeShared<FUserXboxInfo>(*src.XboxInfo)) : nullptr)
             {}
 
+        FUserAccountInfo(FUserAccountInfo&& src) :
+            FPlayFabCppBaseModel(),
+            AndroidDeviceInfo(MoveTemp(src.AndroidDeviceInfo)),
+            AppleAccountInfo(MoveTemp(src.AppleAccountInfo)),
+            Created(MoveTemp(src.Created)),
+            CustomIdInfo(MoveTemp(src.CustomIdInfo)),
+            FacebookInfo(MoveTemp(src.FacebookInfo)),
+            FacebookInstantGamesIdInfo(MoveTemp(src.FacebookInstantGamesIdInfo)),
+            GameCenterInfo(MoveTemp(src.GameCenterInfo)),
+            GoogleInfo(MoveTemp(src.GoogleInfo)),
+            IosDeviceInfo(MoveTemp(src.IosDeviceInfo)),
+            KongregateInfo(MoveTemp(src.KongregateInfo)),
+            NintendoSwitchAccountInfo(MoveTemp(src.NintendoSwitchAccountInfo)),
+            NintendoSwitchDeviceIdInfo(MoveTemp(src.NintendoSwitchDeviceIdInfo)),
+            OpenIdInfo(MoveTemp(src.OpenIdInfo)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            PrivateInfo(MoveTemp(src.PrivateInfo)),
+            PsnInfo(MoveTemp(src.PsnInfo)),
+            SteamInfo(MoveTemp(src.SteamInfo)),
+            TitleInfo(MoveTemp(src.TitleInfo)),
+            TwitchInfo(MoveTemp(src.TwitchInfo)),
+            Username(MoveTemp(src.Username)),
+            WindowsHelloInfo(MoveTemp(src.WindowsHelloInfo)),
+            XboxInfo(MoveTemp(src.XboxInfo))
+            {}
+
+        FUserAccountInfo& operator=(const FUserAccountInfo& src) = default;
+        FUserAccountInfo& operator=(FUserAccountInfo&& src) = default;
+
         FUserAccountInfo(const TSharedPtr<FJsonObject>& obj) : FUserAccountInfo()
         {
             readFromValue(obj);
@@ -9800,7 +13587,13 @@ namespace AdminModels
         ~FUserAccountInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLookupUserAccountInfoResult : public PlayFab::FPlayFabCppResultCommon
@@ -9815,9 +13608,17 @@ namespace AdminModels
 
         FLookupUserAccountInfoResult(const FLookupUserAccountInfoResult& src) :
             FPlayFabCppResultCommon(),
-            UserInfo(src.UserInfo.IsValid() ? MakeShareable(new FUserAccountInfo(*src.UserInfo)) : nullptr)
+            UserInfo(src.UserInfo.IsValid() ? TSharedPtr<FUserAccountInfo>(MakeShared<FUserAccountInfo>(*src.UserInfo)) : nullptr)
+            {}
+
+        FLookupUserAccountInfoResult(FLookupUserAccountInfoResult&& src) :
+            FPlayFabCppResultCommon(),
+            UserInfo(MoveTemp(src.UserInfo))
             {}
 
+        FLookupUserAccountInfoResult& operator=(const FLookupUserAccountInfoResult& src) = default;
+        FLookupUserAccountInfoResult& operator=(FLookupUserAccountInfoResult&& src) = default;
+
         FLookupUserAccountInfoResult(const TSharedPtr<FJsonObject>& obj) : FLookupUserAccountInfoResult()
         {
             readFromValue(obj);
@@ -9826,7 +13627,13 @@ namespace AdminModels
         ~FLookupUserAccountInfoResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FModifyMatchmakerGameModesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9848,6 +13655,15 @@ namespace AdminModels
             GameModes(src.GameModes)
             {}
 
+        FModifyMatchmakerGameModesRequest(FModifyMatchmakerGameModesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildVersion(MoveTemp(src.BuildVersion)),
+            GameModes(MoveTemp(src.GameModes))
+            {}
+
+        FModifyMatchmakerGameModesRequest& operator=(const FModifyMatchmakerGameModesRequest& src) = default;
+        FModifyMatchmakerGameModesRequest& operator=(FModifyMatchmakerGameModesRequest&& src) = default;
+
         FModifyMatchmakerGameModesRequest(const TSharedPtr<FJsonObject>& obj) : FModifyMatchmakerGameModesRequest()
         {
             readFromValue(obj);
@@ -9856,7 +13672,13 @@ namespace AdminModels
         ~FModifyMatchmakerGameModesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FModifyMatchmakerGameModesResult : public PlayFab::FPlayFabCppResultCommon
@@ -9869,6 +13691,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FModifyMatchmakerGameModesResult(FModifyMatchmakerGameModesResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FModifyMatchmakerGameModesResult& operator=(const FModifyMatchmakerGameModesResult& src) = default;
+        FModifyMatchmakerGameModesResult& operator=(FModifyMatchmakerGameModesResult&& src) = default;
+
         FModifyMatchmakerGameModesResult(const TSharedPtr<FJsonObject>& obj) : FModifyMatchmakerGameModesResult()
         {
             readFromValue(obj);
@@ -9877,7 +13706,13 @@ namespace AdminModels
         ~FModifyMatchmakerGameModesResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FModifyServerBuildRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9936,6 +13771,22 @@ namespace AdminModels
             Timestamp(src.Timestamp)
             {}
 
+        FModifyServerBuildRequest(FModifyServerBuildRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ActiveRegions(MoveTemp(src.ActiveRegions)),
+            BuildId(MoveTemp(src.BuildId)),
+            CommandLineTemplate(MoveTemp(src.CommandLineTemplate)),
+            Comment(MoveTemp(src.Comment)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ExecutablePath(MoveTemp(src.ExecutablePath)),
+            MaxGamesPerHost(MoveTemp(src.MaxGamesPerHost)),
+            MinFreeGameSlots(MoveTemp(src.MinFreeGameSlots)),
+            Timestamp(MoveTemp(src.Timestamp))
+            {}
+
+        FModifyServerBuildRequest& operator=(const FModifyServerBuildRequest& src) = default;
+        FModifyServerBuildRequest& operator=(FModifyServerBuildRequest&& src) = default;
+
         FModifyServerBuildRequest(const TSharedPtr<FJsonObject>& obj) : FModifyServerBuildRequest()
         {
             readFromValue(obj);
@@ -9944,7 +13795,13 @@ namespace AdminModels
         ~FModifyServerBuildRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FModifyServerBuildResult : public PlayFab::FPlayFabCppResultCommon
@@ -10012,6 +13869,23 @@ namespace AdminModels
             TitleId(src.TitleId)
             {}
 
+        FModifyServerBuildResult(FModifyServerBuildResult&& src) :
+            FPlayFabCppResultCommon(),
+            ActiveRegions(MoveTemp(src.ActiveRegions)),
+            BuildId(MoveTemp(src.BuildId)),
+            CommandLineTemplate(MoveTemp(src.CommandLineTemplate)),
+            Comment(MoveTemp(src.Comment)),
+            ExecutablePath(MoveTemp(src.ExecutablePath)),
+            MaxGamesPerHost(MoveTemp(src.MaxGamesPerHost)),
+            MinFreeGameSlots(MoveTemp(src.MinFreeGameSlots)),
+            Status(MoveTemp(src.Status)),
+            Timestamp(MoveTemp(src.Timestamp)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FModifyServerBuildResult& operator=(const FModifyServerBuildResult& src) = default;
+        FModifyServerBuildResult& operator=(FModifyServerBuildResult&& src) = default;
+
         FModifyServerBuildResult(const TSharedPtr<FJsonObject>& obj) : FModifyServerBuildResult()
         {
             readFromValue(obj);
@@ -10020,7 +13894,13 @@ namespace AdminModels
         ~FModifyServerBuildResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FModifyUserVirtualCurrencyResult : public PlayFab::FPlayFabCppResultCommon
@@ -10056,6 +13936,17 @@ namespace AdminModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FModifyUserVirtualCurrencyResult(FModifyUserVirtualCurrencyResult&& src) :
+            FPlayFabCppResultCommon(),
+            Balance(MoveTemp(src.Balance)),
+            BalanceChange(MoveTemp(src.BalanceChange)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FModifyUserVirtualCurrencyResult& operator=(const FModifyUserVirtualCurrencyResult& src) = default;
+        FModifyUserVirtualCurrencyResult& operator=(FModifyUserVirtualCurrencyResult&& src) = default;
+
         FModifyUserVirtualCurrencyResult(const TSharedPtr<FJsonObject>& obj) : FModifyUserVirtualCurrencyResult()
         {
             readFromValue(obj);
@@ -10064,7 +13955,13 @@ namespace AdminModels
         ~FModifyUserVirtualCurrencyResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum PushSetupPlatform
@@ -10075,6 +13972,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writePushSetupPlatformEnumJSON(PushSetupPlatform enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writePushSetupPlatformEnumJSON(PushSetupPlatform enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API PushSetupPlatform readPushSetupPlatformFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API PushSetupPlatform readPushSetupPlatformFromValue(const FString& value);
 
@@ -10097,6 +13995,15 @@ namespace AdminModels
             TableId(src.TableId)
             {}
 
+        FRandomResultTable(FRandomResultTable&& src) :
+            FPlayFabCppBaseModel(),
+            Nodes(MoveTemp(src.Nodes)),
+            TableId(MoveTemp(src.TableId))
+            {}
+
+        FRandomResultTable& operator=(const FRandomResultTable& src) = default;
+        FRandomResultTable& operator=(FRandomResultTable&& src) = default;
+
         FRandomResultTable(const TSharedPtr<FJsonObject>& obj) : FRandomResultTable()
         {
             readFromValue(obj);
@@ -10105,7 +14012,13 @@ namespace AdminModels
         ~FRandomResultTable();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRefundPurchaseRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10137,6 +14050,16 @@ namespace AdminModels
             Reason(src.Reason)
             {}
 
+        FRefundPurchaseRequest(FRefundPurchaseRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            OrderId(MoveTemp(src.OrderId)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Reason(MoveTemp(src.Reason))
+            {}
+
+        FRefundPurchaseRequest& operator=(const FRefundPurchaseRequest& src) = default;
+        FRefundPurchaseRequest& operator=(FRefundPurchaseRequest&& src) = default;
+
         FRefundPurchaseRequest(const TSharedPtr<FJsonObject>& obj) : FRefundPurchaseRequest()
         {
             readFromValue(obj);
@@ -10145,7 +14068,13 @@ namespace AdminModels
         ~FRefundPurchaseRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRefundPurchaseResponse : public PlayFab::FPlayFabCppResultCommon
@@ -10163,6 +14092,14 @@ namespace AdminModels
             PurchaseStatus(src.PurchaseStatus)
             {}
 
+        FRefundPurchaseResponse(FRefundPurchaseResponse&& src) :
+            FPlayFabCppResultCommon(),
+            PurchaseStatus(MoveTemp(src.PurchaseStatus))
+            {}
+
+        FRefundPurchaseResponse& operator=(const FRefundPurchaseResponse& src) = default;
+        FRefundPurchaseResponse& operator=(FRefundPurchaseResponse&& src) = default;
+
         FRefundPurchaseResponse(const TSharedPtr<FJsonObject>& obj) : FRefundPurchaseResponse()
         {
             readFromValue(obj);
@@ -10171,7 +14108,13 @@ namespace AdminModels
         ~FRefundPurchaseResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemovePlayerTagRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10198,6 +14141,16 @@ namespace AdminModels
             TagName(src.TagName)
             {}
 
+        FRemovePlayerTagRequest(FRemovePlayerTagRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            TagName(MoveTemp(src.TagName))
+            {}
+
+        FRemovePlayerTagRequest& operator=(const FRemovePlayerTagRequest& src) = default;
+        FRemovePlayerTagRequest& operator=(FRemovePlayerTagRequest&& src) = default;
+
         FRemovePlayerTagRequest(const TSharedPtr<FJsonObject>& obj) : FRemovePlayerTagRequest()
         {
             readFromValue(obj);
@@ -10206,7 +14159,13 @@ namespace AdminModels
         ~FRemovePlayerTagRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemovePlayerTagResult : public PlayFab::FPlayFabCppResultCommon
@@ -10219,6 +14178,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FRemovePlayerTagResult(FRemovePlayerTagResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FRemovePlayerTagResult& operator=(const FRemovePlayerTagResult& src) = default;
+        FRemovePlayerTagResult& operator=(FRemovePlayerTagResult&& src) = default;
+
         FRemovePlayerTagResult(const TSharedPtr<FJsonObject>& obj) : FRemovePlayerTagResult()
         {
             readFromValue(obj);
@@ -10227,7 +14193,13 @@ namespace AdminModels
         ~FRemovePlayerTagResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveServerBuildRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10245,6 +14217,14 @@ namespace AdminModels
             BuildId(src.BuildId)
             {}
 
+        FRemoveServerBuildRequest(FRemoveServerBuildRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildId(MoveTemp(src.BuildId))
+            {}
+
+        FRemoveServerBuildRequest& operator=(const FRemoveServerBuildRequest& src) = default;
+        FRemoveServerBuildRequest& operator=(FRemoveServerBuildRequest&& src) = default;
+
         FRemoveServerBuildRequest(const TSharedPtr<FJsonObject>& obj) : FRemoveServerBuildRequest()
         {
             readFromValue(obj);
@@ -10253,7 +14233,13 @@ namespace AdminModels
         ~FRemoveServerBuildRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveServerBuildResult : public PlayFab::FPlayFabCppResultCommon
@@ -10266,6 +14252,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FRemoveServerBuildResult(FRemoveServerBuildResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FRemoveServerBuildResult& operator=(const FRemoveServerBuildResult& src) = default;
+        FRemoveServerBuildResult& operator=(FRemoveServerBuildResult&& src) = default;
+
         FRemoveServerBuildResult(const TSharedPtr<FJsonObject>& obj) : FRemoveServerBuildResult()
         {
             readFromValue(obj);
@@ -10274,7 +14267,13 @@ namespace AdminModels
         ~FRemoveServerBuildResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveVirtualCurrencyTypesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10291,6 +14290,14 @@ namespace AdminModels
             VirtualCurrencies(src.VirtualCurrencies)
             {}
 
+        FRemoveVirtualCurrencyTypesRequest(FRemoveVirtualCurrencyTypesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            VirtualCurrencies(MoveTemp(src.VirtualCurrencies))
+            {}
+
+        FRemoveVirtualCurrencyTypesRequest& operator=(const FRemoveVirtualCurrencyTypesRequest& src) = default;
+        FRemoveVirtualCurrencyTypesRequest& operator=(FRemoveVirtualCurrencyTypesRequest&& src) = default;
+
         FRemoveVirtualCurrencyTypesRequest(const TSharedPtr<FJsonObject>& obj) : FRemoveVirtualCurrencyTypesRequest()
         {
             readFromValue(obj);
@@ -10299,7 +14306,13 @@ namespace AdminModels
         ~FRemoveVirtualCurrencyTypesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FResetCharacterStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10326,6 +14339,16 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FResetCharacterStatisticsRequest(FResetCharacterStatisticsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FResetCharacterStatisticsRequest& operator=(const FResetCharacterStatisticsRequest& src) = default;
+        FResetCharacterStatisticsRequest& operator=(FResetCharacterStatisticsRequest&& src) = default;
+
         FResetCharacterStatisticsRequest(const TSharedPtr<FJsonObject>& obj) : FResetCharacterStatisticsRequest()
         {
             readFromValue(obj);
@@ -10334,7 +14357,13 @@ namespace AdminModels
         ~FResetCharacterStatisticsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FResetCharacterStatisticsResult : public PlayFab::FPlayFabCppResultCommon
@@ -10347,6 +14376,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FResetCharacterStatisticsResult(FResetCharacterStatisticsResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FResetCharacterStatisticsResult& operator=(const FResetCharacterStatisticsResult& src) = default;
+        FResetCharacterStatisticsResult& operator=(FResetCharacterStatisticsResult&& src) = default;
+
         FResetCharacterStatisticsResult(const TSharedPtr<FJsonObject>& obj) : FResetCharacterStatisticsResult()
         {
             readFromValue(obj);
@@ -10355,7 +14391,13 @@ namespace AdminModels
         ~FResetCharacterStatisticsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FResetPasswordRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10382,6 +14424,16 @@ namespace AdminModels
             Token(src.Token)
             {}
 
+        FResetPasswordRequest(FResetPasswordRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Password(MoveTemp(src.Password)),
+            Token(MoveTemp(src.Token))
+            {}
+
+        FResetPasswordRequest& operator=(const FResetPasswordRequest& src) = default;
+        FResetPasswordRequest& operator=(FResetPasswordRequest&& src) = default;
+
         FResetPasswordRequest(const TSharedPtr<FJsonObject>& obj) : FResetPasswordRequest()
         {
             readFromValue(obj);
@@ -10390,7 +14442,13 @@ namespace AdminModels
         ~FResetPasswordRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FResetPasswordResult : public PlayFab::FPlayFabCppResultCommon
@@ -10403,6 +14461,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FResetPasswordResult(FResetPasswordResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FResetPasswordResult& operator=(const FResetPasswordResult& src) = default;
+        FResetPasswordResult& operator=(FResetPasswordResult&& src) = default;
+
         FResetPasswordResult(const TSharedPtr<FJsonObject>& obj) : FResetPasswordResult()
         {
             readFromValue(obj);
@@ -10411,7 +14476,13 @@ namespace AdminModels
         ~FResetPasswordResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FResetUserStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10433,6 +14504,15 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FResetUserStatisticsRequest(FResetUserStatisticsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FResetUserStatisticsRequest& operator=(const FResetUserStatisticsRequest& src) = default;
+        FResetUserStatisticsRequest& operator=(FResetUserStatisticsRequest&& src) = default;
+
         FResetUserStatisticsRequest(const TSharedPtr<FJsonObject>& obj) : FResetUserStatisticsRequest()
         {
             readFromValue(obj);
@@ -10441,7 +14521,13 @@ namespace AdminModels
         ~FResetUserStatisticsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FResetUserStatisticsResult : public PlayFab::FPlayFabCppResultCommon
@@ -10454,6 +14540,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FResetUserStatisticsResult(FResetUserStatisticsResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FResetUserStatisticsResult& operator=(const FResetUserStatisticsResult& src) = default;
+        FResetUserStatisticsResult& operator=(FResetUserStatisticsResult&& src) = default;
+
         FResetUserStatisticsResult(const TSharedPtr<FJsonObject>& obj) : FResetUserStatisticsResult()
         {
             readFromValue(obj);
@@ -10462,7 +14555,13 @@ namespace AdminModels
         ~FResetUserStatisticsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum ResolutionOutcome
@@ -10473,6 +14572,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeResolutionOutcomeEnumJSON(ResolutionOutcome enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeResolutionOutcomeEnumJSON(ResolutionOutcome enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API ResolutionOutcome readResolutionOutcomeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API ResolutionOutcome readResolutionOutcomeFromValue(const FString& value);
 
@@ -10513,6 +14613,17 @@ namespace AdminModels
             Reason(src.Reason)
             {}
 
+        FResolvePurchaseDisputeRequest(FResolvePurchaseDisputeRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            OrderId(MoveTemp(src.OrderId)),
+            Outcome(MoveTemp(src.Outcome)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Reason(MoveTemp(src.Reason))
+            {}
+
+        FResolvePurchaseDisputeRequest& operator=(const FResolvePurchaseDisputeRequest& src) = default;
+        FResolvePurchaseDisputeRequest& operator=(FResolvePurchaseDisputeRequest&& src) = default;
+
         FResolvePurchaseDisputeRequest(const TSharedPtr<FJsonObject>& obj) : FResolvePurchaseDisputeRequest()
         {
             readFromValue(obj);
@@ -10521,7 +14632,13 @@ namespace AdminModels
         ~FResolvePurchaseDisputeRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FResolvePurchaseDisputeResponse : public PlayFab::FPlayFabCppResultCommon
@@ -10539,6 +14656,14 @@ namespace AdminModels
             PurchaseStatus(src.PurchaseStatus)
             {}
 
+        FResolvePurchaseDisputeResponse(FResolvePurchaseDisputeResponse&& src) :
+            FPlayFabCppResultCommon(),
+            PurchaseStatus(MoveTemp(src.PurchaseStatus))
+            {}
+
+        FResolvePurchaseDisputeResponse& operator=(const FResolvePurchaseDisputeResponse& src) = default;
+        FResolvePurchaseDisputeResponse& operator=(FResolvePurchaseDisputeResponse&& src) = default;
+
         FResolvePurchaseDisputeResponse(const TSharedPtr<FJsonObject>& obj) : FResolvePurchaseDisputeResponse()
         {
             readFromValue(obj);
@@ -10547,7 +14672,13 @@ namespace AdminModels
         ~FResolvePurchaseDisputeResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeAllBansForUserRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10565,6 +14696,14 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FRevokeAllBansForUserRequest(FRevokeAllBansForUserRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FRevokeAllBansForUserRequest& operator=(const FRevokeAllBansForUserRequest& src) = default;
+        FRevokeAllBansForUserRequest& operator=(FRevokeAllBansForUserRequest&& src) = default;
+
         FRevokeAllBansForUserRequest(const TSharedPtr<FJsonObject>& obj) : FRevokeAllBansForUserRequest()
         {
             readFromValue(obj);
@@ -10573,7 +14712,13 @@ namespace AdminModels
         ~FRevokeAllBansForUserRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeAllBansForUserResult : public PlayFab::FPlayFabCppResultCommon
@@ -10590,6 +14735,14 @@ namespace AdminModels
             BanData(src.BanData)
             {}
 
+        FRevokeAllBansForUserResult(FRevokeAllBansForUserResult&& src) :
+            FPlayFabCppResultCommon(),
+            BanData(MoveTemp(src.BanData))
+            {}
+
+        FRevokeAllBansForUserResult& operator=(const FRevokeAllBansForUserResult& src) = default;
+        FRevokeAllBansForUserResult& operator=(FRevokeAllBansForUserResult&& src) = default;
+
         FRevokeAllBansForUserResult(const TSharedPtr<FJsonObject>& obj) : FRevokeAllBansForUserResult()
         {
             readFromValue(obj);
@@ -10598,7 +14751,13 @@ namespace AdminModels
         ~FRevokeAllBansForUserResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeBansRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10615,15 +14774,29 @@ namespace AdminModels
             BanIds(src.BanIds)
             {}
 
-        FRevokeBansRequest(const TSharedPtr<FJsonObject>& obj) : FRevokeBansRequest()
-        {
+        FRevokeBansRequest(FRevokeBansRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BanIds(MoveTemp(src.BanIds))
+            {}
+
+        FRevokeBansRequest& operator=(const FRevokeBansRequest& src) = default;
+        FRevokeBansRequest& operator=(FRevokeBansRequest&& src) = default;
+
+        FRevokeBansRequest(const TSharedPtr<FJsonObject>& obj) : FRevokeBansRequest()
+        {
             readFromValue(obj);
         }
 
         ~FRevokeBansRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeBansResult : public PlayFab::FPlayFabCppResultCommon
@@ -10640,6 +14813,14 @@ namespace AdminModels
             BanData(src.BanData)
             {}
 
+        FRevokeBansResult(FRevokeBansResult&& src) :
+            FPlayFabCppResultCommon(),
+            BanData(MoveTemp(src.BanData))
+            {}
+
+        FRevokeBansResult& operator=(const FRevokeBansResult& src) = default;
+        FRevokeBansResult& operator=(FRevokeBansResult&& src) = default;
+
         FRevokeBansResult(const TSharedPtr<FJsonObject>& obj) : FRevokeBansResult()
         {
             readFromValue(obj);
@@ -10648,7 +14829,13 @@ namespace AdminModels
         ~FRevokeBansResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeInventoryItem : public PlayFab::FPlayFabCppBaseModel
@@ -10676,6 +14863,16 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FRevokeInventoryItem(FRevokeInventoryItem&& src) :
+            FPlayFabCppBaseModel(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FRevokeInventoryItem& operator=(const FRevokeInventoryItem& src) = default;
+        FRevokeInventoryItem& operator=(FRevokeInventoryItem&& src) = default;
+
         FRevokeInventoryItem(const TSharedPtr<FJsonObject>& obj) : FRevokeInventoryItem()
         {
             readFromValue(obj);
@@ -10684,7 +14881,13 @@ namespace AdminModels
         ~FRevokeInventoryItem();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeInventoryItemRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10712,6 +14915,16 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FRevokeInventoryItemRequest(FRevokeInventoryItemRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FRevokeInventoryItemRequest& operator=(const FRevokeInventoryItemRequest& src) = default;
+        FRevokeInventoryItemRequest& operator=(FRevokeInventoryItemRequest&& src) = default;
+
         FRevokeInventoryItemRequest(const TSharedPtr<FJsonObject>& obj) : FRevokeInventoryItemRequest()
         {
             readFromValue(obj);
@@ -10720,7 +14933,13 @@ namespace AdminModels
         ~FRevokeInventoryItemRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeInventoryItemsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10737,6 +14956,14 @@ namespace AdminModels
             Items(src.Items)
             {}
 
+        FRevokeInventoryItemsRequest(FRevokeInventoryItemsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Items(MoveTemp(src.Items))
+            {}
+
+        FRevokeInventoryItemsRequest& operator=(const FRevokeInventoryItemsRequest& src) = default;
+        FRevokeInventoryItemsRequest& operator=(FRevokeInventoryItemsRequest&& src) = default;
+
         FRevokeInventoryItemsRequest(const TSharedPtr<FJsonObject>& obj) : FRevokeInventoryItemsRequest()
         {
             readFromValue(obj);
@@ -10745,7 +14972,13 @@ namespace AdminModels
         ~FRevokeInventoryItemsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeItemError : public PlayFab::FPlayFabCppBaseModel
@@ -10765,9 +14998,18 @@ namespace AdminModels
         FRevokeItemError(const FRevokeItemError& src) :
             FPlayFabCppBaseModel(),
             Error(src.Error),
-            Item(src.Item.IsValid() ? MakeShareable(new FRevokeInventoryItem(*src.Item)) : nullptr)
+            Item(src.Item.IsValid() ? TSharedPtr<FRevokeInventoryItem>(MakeShared<FRevokeInventoryItem>(*src.Item)) : nullptr)
+            {}
+
+        FRevokeItemError(FRevokeItemError&& src) :
+            FPlayFabCppBaseModel(),
+            Error(MoveTemp(src.Error)),
+            Item(MoveTemp(src.Item))
             {}
 
+        FRevokeItemError& operator=(const FRevokeItemError& src) = default;
+        FRevokeItemError& operator=(FRevokeItemError&& src) = default;
+
         FRevokeItemError(const TSharedPtr<FJsonObject>& obj) : FRevokeItemError()
         {
             readFromValue(obj);
@@ -10776,7 +15018,13 @@ namespace AdminModels
         ~FRevokeItemError();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeInventoryItemsResult : public PlayFab::FPlayFabCppResultCommon
@@ -10793,6 +15041,14 @@ namespace AdminModels
             Errors(src.Errors)
             {}
 
+        FRevokeInventoryItemsResult(FRevokeInventoryItemsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Errors(MoveTemp(src.Errors))
+            {}
+
+        FRevokeInventoryItemsResult& operator=(const FRevokeInventoryItemsResult& src) = default;
+        FRevokeInventoryItemsResult& operator=(FRevokeInventoryItemsResult&& src) = default;
+
         FRevokeInventoryItemsResult(const TSharedPtr<FJsonObject>& obj) : FRevokeInventoryItemsResult()
         {
             readFromValue(obj);
@@ -10801,7 +15057,13 @@ namespace AdminModels
         ~FRevokeInventoryItemsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeInventoryResult : public PlayFab::FPlayFabCppResultCommon
@@ -10814,6 +15076,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FRevokeInventoryResult(FRevokeInventoryResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FRevokeInventoryResult& operator=(const FRevokeInventoryResult& src) = default;
+        FRevokeInventoryResult& operator=(FRevokeInventoryResult&& src) = default;
+
         FRevokeInventoryResult(const TSharedPtr<FJsonObject>& obj) : FRevokeInventoryResult()
         {
             readFromValue(obj);
@@ -10822,7 +15091,13 @@ namespace AdminModels
         ~FRevokeInventoryResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRunTaskRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10841,9 +15116,18 @@ namespace AdminModels
         FRunTaskRequest(const FRunTaskRequest& src) :
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
-            Identifier(src.Identifier.IsValid() ? MakeShareable(new FNameIdentifier(*src.Identifier)) : nullptr)
+            Identifier(src.Identifier.IsValid() ? TSharedPtr<FNameIdentifier>(MakeShared<FNameIdentifier>(*src.Identifier)) : nullptr)
             {}
 
+        FRunTaskRequest(FRunTaskRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Identifier(MoveTemp(src.Identifier))
+            {}
+
+        FRunTaskRequest& operator=(const FRunTaskRequest& src) = default;
+        FRunTaskRequest& operator=(FRunTaskRequest&& src) = default;
+
         FRunTaskRequest(const TSharedPtr<FJsonObject>& obj) : FRunTaskRequest()
         {
             readFromValue(obj);
@@ -10852,7 +15136,13 @@ namespace AdminModels
         ~FRunTaskRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRunTaskResult : public PlayFab::FPlayFabCppResultCommon
@@ -10873,6 +15163,14 @@ namespace AdminModels
             TaskInstanceId(src.TaskInstanceId)
             {}
 
+        FRunTaskResult(FRunTaskResult&& src) :
+            FPlayFabCppResultCommon(),
+            TaskInstanceId(MoveTemp(src.TaskInstanceId))
+            {}
+
+        FRunTaskResult& operator=(const FRunTaskResult& src) = default;
+        FRunTaskResult& operator=(FRunTaskResult&& src) = default;
+
         FRunTaskResult(const TSharedPtr<FJsonObject>& obj) : FRunTaskResult()
         {
             readFromValue(obj);
@@ -10881,7 +15179,13 @@ namespace AdminModels
         ~FRunTaskResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSendAccountRecoveryEmailRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10908,6 +15212,16 @@ namespace AdminModels
             EmailTemplateId(src.EmailTemplateId)
             {}
 
+        FSendAccountRecoveryEmailRequest(FSendAccountRecoveryEmailRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Email(MoveTemp(src.Email)),
+            EmailTemplateId(MoveTemp(src.EmailTemplateId))
+            {}
+
+        FSendAccountRecoveryEmailRequest& operator=(const FSendAccountRecoveryEmailRequest& src) = default;
+        FSendAccountRecoveryEmailRequest& operator=(FSendAccountRecoveryEmailRequest&& src) = default;
+
         FSendAccountRecoveryEmailRequest(const TSharedPtr<FJsonObject>& obj) : FSendAccountRecoveryEmailRequest()
         {
             readFromValue(obj);
@@ -10916,7 +15230,13 @@ namespace AdminModels
         ~FSendAccountRecoveryEmailRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSendAccountRecoveryEmailResult : public PlayFab::FPlayFabCppResultCommon
@@ -10929,6 +15249,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FSendAccountRecoveryEmailResult(FSendAccountRecoveryEmailResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSendAccountRecoveryEmailResult& operator=(const FSendAccountRecoveryEmailResult& src) = default;
+        FSendAccountRecoveryEmailResult& operator=(FSendAccountRecoveryEmailResult&& src) = default;
+
         FSendAccountRecoveryEmailResult(const TSharedPtr<FJsonObject>& obj) : FSendAccountRecoveryEmailResult()
         {
             readFromValue(obj);
@@ -10937,7 +15264,13 @@ namespace AdminModels
         ~FSendAccountRecoveryEmailResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetPlayerSecretRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10960,6 +15293,15 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FSetPlayerSecretRequest(FSetPlayerSecretRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FSetPlayerSecretRequest& operator=(const FSetPlayerSecretRequest& src) = default;
+        FSetPlayerSecretRequest& operator=(FSetPlayerSecretRequest&& src) = default;
+
         FSetPlayerSecretRequest(const TSharedPtr<FJsonObject>& obj) : FSetPlayerSecretRequest()
         {
             readFromValue(obj);
@@ -10968,7 +15310,13 @@ namespace AdminModels
         ~FSetPlayerSecretRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetPlayerSecretResult : public PlayFab::FPlayFabCppResultCommon
@@ -10981,6 +15329,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FSetPlayerSecretResult(FSetPlayerSecretResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSetPlayerSecretResult& operator=(const FSetPlayerSecretResult& src) = default;
+        FSetPlayerSecretResult& operator=(FSetPlayerSecretResult&& src) = default;
+
         FSetPlayerSecretResult(const TSharedPtr<FJsonObject>& obj) : FSetPlayerSecretResult()
         {
             readFromValue(obj);
@@ -10989,7 +15344,13 @@ namespace AdminModels
         ~FSetPlayerSecretResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetPublishedRevisionRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11016,6 +15377,16 @@ namespace AdminModels
             Version(src.Version)
             {}
 
+        FSetPublishedRevisionRequest(FSetPublishedRevisionRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Revision(MoveTemp(src.Revision)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FSetPublishedRevisionRequest& operator=(const FSetPublishedRevisionRequest& src) = default;
+        FSetPublishedRevisionRequest& operator=(FSetPublishedRevisionRequest&& src) = default;
+
         FSetPublishedRevisionRequest(const TSharedPtr<FJsonObject>& obj) : FSetPublishedRevisionRequest()
         {
             readFromValue(obj);
@@ -11024,7 +15395,13 @@ namespace AdminModels
         ~FSetPublishedRevisionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetPublishedRevisionResult : public PlayFab::FPlayFabCppResultCommon
@@ -11037,6 +15414,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FSetPublishedRevisionResult(FSetPublishedRevisionResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSetPublishedRevisionResult& operator=(const FSetPublishedRevisionResult& src) = default;
+        FSetPublishedRevisionResult& operator=(FSetPublishedRevisionResult&& src) = default;
+
         FSetPublishedRevisionResult(const TSharedPtr<FJsonObject>& obj) : FSetPublishedRevisionResult()
         {
             readFromValue(obj);
@@ -11045,7 +15429,13 @@ namespace AdminModels
         ~FSetPublishedRevisionResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetPublisherDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11071,6 +15461,15 @@ namespace AdminModels
             Value(src.Value)
             {}
 
+        FSetPublisherDataRequest(FSetPublisherDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Key(MoveTemp(src.Key)),
+            Value(MoveTemp(src.Value))
+            {}
+
+        FSetPublisherDataRequest& operator=(const FSetPublisherDataRequest& src) = default;
+        FSetPublisherDataRequest& operator=(FSetPublisherDataRequest&& src) = default;
+
         FSetPublisherDataRequest(const TSharedPtr<FJsonObject>& obj) : FSetPublisherDataRequest()
         {
             readFromValue(obj);
@@ -11079,7 +15478,13 @@ namespace AdminModels
         ~FSetPublisherDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetPublisherDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -11092,6 +15497,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FSetPublisherDataResult(FSetPublisherDataResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSetPublisherDataResult& operator=(const FSetPublisherDataResult& src) = default;
+        FSetPublisherDataResult& operator=(FSetPublisherDataResult&& src) = default;
+
         FSetPublisherDataResult(const TSharedPtr<FJsonObject>& obj) : FSetPublisherDataResult()
         {
             readFromValue(obj);
@@ -11100,7 +15512,13 @@ namespace AdminModels
         ~FSetPublisherDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FTitleDataKeyValue : public PlayFab::FPlayFabCppBaseModel
@@ -11126,6 +15544,15 @@ namespace AdminModels
             Value(src.Value)
             {}
 
+        FTitleDataKeyValue(FTitleDataKeyValue&& src) :
+            FPlayFabCppBaseModel(),
+            Key(MoveTemp(src.Key)),
+            Value(MoveTemp(src.Value))
+            {}
+
+        FTitleDataKeyValue& operator=(const FTitleDataKeyValue& src) = default;
+        FTitleDataKeyValue& operator=(FTitleDataKeyValue&& src) = default;
+
         FTitleDataKeyValue(const TSharedPtr<FJsonObject>& obj) : FTitleDataKeyValue()
         {
             readFromValue(obj);
@@ -11134,7 +15561,13 @@ namespace AdminModels
         ~FTitleDataKeyValue();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetTitleDataAndOverridesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11159,6 +15592,15 @@ namespace AdminModels
             OverrideLabel(src.OverrideLabel)
             {}
 
+        FSetTitleDataAndOverridesRequest(FSetTitleDataAndOverridesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            KeyValues(MoveTemp(src.KeyValues)),
+            OverrideLabel(MoveTemp(src.OverrideLabel))
+            {}
+
+        FSetTitleDataAndOverridesRequest& operator=(const FSetTitleDataAndOverridesRequest& src) = default;
+        FSetTitleDataAndOverridesRequest& operator=(FSetTitleDataAndOverridesRequest&& src) = default;
+
         FSetTitleDataAndOverridesRequest(const TSharedPtr<FJsonObject>& obj) : FSetTitleDataAndOverridesRequest()
         {
             readFromValue(obj);
@@ -11167,7 +15609,13 @@ namespace AdminModels
         ~FSetTitleDataAndOverridesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetTitleDataAndOverridesResult : public PlayFab::FPlayFabCppResultCommon
@@ -11180,6 +15628,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FSetTitleDataAndOverridesResult(FSetTitleDataAndOverridesResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSetTitleDataAndOverridesResult& operator=(const FSetTitleDataAndOverridesResult& src) = default;
+        FSetTitleDataAndOverridesResult& operator=(FSetTitleDataAndOverridesResult&& src) = default;
+
         FSetTitleDataAndOverridesResult(const TSharedPtr<FJsonObject>& obj) : FSetTitleDataAndOverridesResult()
         {
             readFromValue(obj);
@@ -11188,7 +15643,13 @@ namespace AdminModels
         ~FSetTitleDataAndOverridesResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetTitleDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11214,6 +15675,15 @@ namespace AdminModels
             Value(src.Value)
             {}
 
+        FSetTitleDataRequest(FSetTitleDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Key(MoveTemp(src.Key)),
+            Value(MoveTemp(src.Value))
+            {}
+
+        FSetTitleDataRequest& operator=(const FSetTitleDataRequest& src) = default;
+        FSetTitleDataRequest& operator=(FSetTitleDataRequest&& src) = default;
+
         FSetTitleDataRequest(const TSharedPtr<FJsonObject>& obj) : FSetTitleDataRequest()
         {
             readFromValue(obj);
@@ -11222,7 +15692,13 @@ namespace AdminModels
         ~FSetTitleDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetTitleDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -11235,6 +15711,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FSetTitleDataResult(FSetTitleDataResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSetTitleDataResult& operator=(const FSetTitleDataResult& src) = default;
+        FSetTitleDataResult& operator=(FSetTitleDataResult&& src) = default;
+
         FSetTitleDataResult(const TSharedPtr<FJsonObject>& obj) : FSetTitleDataResult()
         {
             readFromValue(obj);
@@ -11243,7 +15726,13 @@ namespace AdminModels
         ~FSetTitleDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetupPushNotificationRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11290,6 +15779,18 @@ namespace AdminModels
             Platform(src.Platform)
             {}
 
+        FSetupPushNotificationRequest(FSetupPushNotificationRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Credential(MoveTemp(src.Credential)),
+            Key(MoveTemp(src.Key)),
+            Name(MoveTemp(src.Name)),
+            OverwriteOldARN(MoveTemp(src.OverwriteOldARN)),
+            Platform(MoveTemp(src.Platform))
+            {}
+
+        FSetupPushNotificationRequest& operator=(const FSetupPushNotificationRequest& src) = default;
+        FSetupPushNotificationRequest& operator=(FSetupPushNotificationRequest&& src) = default;
+
         FSetupPushNotificationRequest(const TSharedPtr<FJsonObject>& obj) : FSetupPushNotificationRequest()
         {
             readFromValue(obj);
@@ -11298,7 +15799,13 @@ namespace AdminModels
         ~FSetupPushNotificationRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetupPushNotificationResult : public PlayFab::FPlayFabCppResultCommon
@@ -11316,6 +15823,14 @@ namespace AdminModels
             ARN(src.ARN)
             {}
 
+        FSetupPushNotificationResult(FSetupPushNotificationResult&& src) :
+            FPlayFabCppResultCommon(),
+            ARN(MoveTemp(src.ARN))
+            {}
+
+        FSetupPushNotificationResult& operator=(const FSetupPushNotificationResult& src) = default;
+        FSetupPushNotificationResult& operator=(FSetupPushNotificationResult&& src) = default;
+
         FSetupPushNotificationResult(const TSharedPtr<FJsonObject>& obj) : FSetupPushNotificationResult()
         {
             readFromValue(obj);
@@ -11324,7 +15839,13 @@ namespace AdminModels
         ~FSetupPushNotificationResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum StatisticVersionArchivalStatus
@@ -11337,6 +15858,7 @@ namespace AdminModels
     };
 
     PLAYFABCPP_API void writeStatisticVersionArchivalStatusEnumJSON(StatisticVersionArchivalStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeStatisticVersionArchivalStatusEnumJSON(StatisticVersionArchivalStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API StatisticVersionArchivalStatus readStatisticVersionArchivalStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API StatisticVersionArchivalStatus readStatisticVersionArchivalStatusFromValue(const FString& value);
 
@@ -11369,6 +15891,17 @@ namespace AdminModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FSubtractUserVirtualCurrencyRequest(FSubtractUserVirtualCurrencyRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Amount(MoveTemp(src.Amount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FSubtractUserVirtualCurrencyRequest& operator=(const FSubtractUserVirtualCurrencyRequest& src) = default;
+        FSubtractUserVirtualCurrencyRequest& operator=(FSubtractUserVirtualCurrencyRequest&& src) = default;
+
         FSubtractUserVirtualCurrencyRequest(const TSharedPtr<FJsonObject>& obj) : FSubtractUserVirtualCurrencyRequest()
         {
             readFromValue(obj);
@@ -11377,7 +15910,13 @@ namespace AdminModels
         ~FSubtractUserVirtualCurrencyRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateBanRequest : public PlayFab::FPlayFabCppBaseModel
@@ -11425,6 +15964,20 @@ namespace AdminModels
             Reason(src.Reason)
             {}
 
+        FUpdateBanRequest(FUpdateBanRequest&& src) :
+            FPlayFabCppBaseModel(),
+            Active(MoveTemp(src.Active)),
+            BanId(MoveTemp(src.BanId)),
+            Expires(MoveTemp(src.Expires)),
+            IPAddress(MoveTemp(src.IPAddress)),
+            MACAddress(MoveTemp(src.MACAddress)),
+            Permanent(MoveTemp(src.Permanent)),
+            Reason(MoveTemp(src.Reason))
+            {}
+
+        FUpdateBanRequest& operator=(const FUpdateBanRequest& src) = default;
+        FUpdateBanRequest& operator=(FUpdateBanRequest&& src) = default;
+
         FUpdateBanRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateBanRequest()
         {
             readFromValue(obj);
@@ -11433,7 +15986,13 @@ namespace AdminModels
         ~FUpdateBanRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateBansRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11450,6 +16009,14 @@ namespace AdminModels
             Bans(src.Bans)
             {}
 
+        FUpdateBansRequest(FUpdateBansRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Bans(MoveTemp(src.Bans))
+            {}
+
+        FUpdateBansRequest& operator=(const FUpdateBansRequest& src) = default;
+        FUpdateBansRequest& operator=(FUpdateBansRequest&& src) = default;
+
         FUpdateBansRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateBansRequest()
         {
             readFromValue(obj);
@@ -11458,7 +16025,13 @@ namespace AdminModels
         ~FUpdateBansRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateBansResult : public PlayFab::FPlayFabCppResultCommon
@@ -11475,6 +16048,14 @@ namespace AdminModels
             BanData(src.BanData)
             {}
 
+        FUpdateBansResult(FUpdateBansResult&& src) :
+            FPlayFabCppResultCommon(),
+            BanData(MoveTemp(src.BanData))
+            {}
+
+        FUpdateBansResult& operator=(const FUpdateBansResult& src) = default;
+        FUpdateBansResult& operator=(FUpdateBansResult&& src) = default;
+
         FUpdateBansResult(const TSharedPtr<FJsonObject>& obj) : FUpdateBansResult()
         {
             readFromValue(obj);
@@ -11483,7 +16064,13 @@ namespace AdminModels
         ~FUpdateBansResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateCatalogItemsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11520,6 +16107,17 @@ namespace AdminModels
             SetAsDefaultCatalog(src.SetAsDefaultCatalog)
             {}
 
+        FUpdateCatalogItemsRequest(FUpdateCatalogItemsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Catalog(MoveTemp(src.Catalog)),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            SetAsDefaultCatalog(MoveTemp(src.SetAsDefaultCatalog))
+            {}
+
+        FUpdateCatalogItemsRequest& operator=(const FUpdateCatalogItemsRequest& src) = default;
+        FUpdateCatalogItemsRequest& operator=(FUpdateCatalogItemsRequest&& src) = default;
+
         FUpdateCatalogItemsRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateCatalogItemsRequest()
         {
             readFromValue(obj);
@@ -11528,7 +16126,13 @@ namespace AdminModels
         ~FUpdateCatalogItemsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateCatalogItemsResult : public PlayFab::FPlayFabCppResultCommon
@@ -11541,6 +16145,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FUpdateCatalogItemsResult(FUpdateCatalogItemsResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUpdateCatalogItemsResult& operator=(const FUpdateCatalogItemsResult& src) = default;
+        FUpdateCatalogItemsResult& operator=(FUpdateCatalogItemsResult&& src) = default;
+
         FUpdateCatalogItemsResult(const TSharedPtr<FJsonObject>& obj) : FUpdateCatalogItemsResult()
         {
             readFromValue(obj);
@@ -11549,7 +16160,13 @@ namespace AdminModels
         ~FUpdateCatalogItemsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateCloudScriptRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11580,6 +16197,17 @@ namespace AdminModels
             Publish(src.Publish)
             {}
 
+        FUpdateCloudScriptRequest(FUpdateCloudScriptRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DeveloperPlayFabId(MoveTemp(src.DeveloperPlayFabId)),
+            Files(MoveTemp(src.Files)),
+            Publish(MoveTemp(src.Publish))
+            {}
+
+        FUpdateCloudScriptRequest& operator=(const FUpdateCloudScriptRequest& src) = default;
+        FUpdateCloudScriptRequest& operator=(FUpdateCloudScriptRequest&& src) = default;
+
         FUpdateCloudScriptRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateCloudScriptRequest()
         {
             readFromValue(obj);
@@ -11588,7 +16216,13 @@ namespace AdminModels
         ~FUpdateCloudScriptRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateCloudScriptResult : public PlayFab::FPlayFabCppResultCommon
@@ -11611,6 +16245,15 @@ namespace AdminModels
             Version(src.Version)
             {}
 
+        FUpdateCloudScriptResult(FUpdateCloudScriptResult&& src) :
+            FPlayFabCppResultCommon(),
+            Revision(MoveTemp(src.Revision)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FUpdateCloudScriptResult& operator=(const FUpdateCloudScriptResult& src) = default;
+        FUpdateCloudScriptResult& operator=(FUpdateCloudScriptResult&& src) = default;
+
         FUpdateCloudScriptResult(const TSharedPtr<FJsonObject>& obj) : FUpdateCloudScriptResult()
         {
             readFromValue(obj);
@@ -11619,7 +16262,13 @@ namespace AdminModels
         ~FUpdateCloudScriptResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateOpenIdConnectionRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11654,9 +16303,21 @@ namespace AdminModels
             ClientSecret(src.ClientSecret),
             ConnectionId(src.ConnectionId),
             IssuerDiscoveryUrl(src.IssuerDiscoveryUrl),
-            IssuerInformation(src.IssuerInformation.IsValid() ? MakeShareable(new FOpenIdIssuerInformation(*src.IssuerInformation)) : nullptr)
+            IssuerInformation(src.IssuerInformation.IsValid() ? TSharedPtr<FOpenIdIssuerInformation>(MakeShared<FOpenIdIssuerInformation>(*src.IssuerInformation)) : nullptr)
             {}
 
+        FUpdateOpenIdConnectionRequest(FUpdateOpenIdConnectionRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ClientId(MoveTemp(src.ClientId)),
+            ClientSecret(MoveTemp(src.ClientSecret)),
+            ConnectionId(MoveTemp(src.ConnectionId)),
+            IssuerDiscoveryUrl(MoveTemp(src.IssuerDiscoveryUrl)),
+            IssuerInformation(MoveTemp(src.IssuerInformation))
+            {}
+
+        FUpdateOpenIdConnectionRequest& operator=(const FUpdateOpenIdConnectionRequest& src) = default;
+        FUpdateOpenIdConnectionRequest& operator=(FUpdateOpenIdConnectionRequest&& src) = default;
+
         FUpdateOpenIdConnectionRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateOpenIdConnectionRequest()
         {
             readFromValue(obj);
@@ -11665,7 +16326,13 @@ namespace AdminModels
         ~FUpdateOpenIdConnectionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdatePlayerSharedSecretRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11693,6 +16360,16 @@ namespace AdminModels
             SecretKey(src.SecretKey)
             {}
 
+        FUpdatePlayerSharedSecretRequest(FUpdatePlayerSharedSecretRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Disabled(MoveTemp(src.Disabled)),
+            FriendlyName(MoveTemp(src.FriendlyName)),
+            SecretKey(MoveTemp(src.SecretKey))
+            {}
+
+        FUpdatePlayerSharedSecretRequest& operator=(const FUpdatePlayerSharedSecretRequest& src) = default;
+        FUpdatePlayerSharedSecretRequest& operator=(FUpdatePlayerSharedSecretRequest&& src) = default;
+
         FUpdatePlayerSharedSecretRequest(const TSharedPtr<FJsonObject>& obj) : FUpdatePlayerSharedSecretRequest()
         {
             readFromValue(obj);
@@ -11701,7 +16378,13 @@ namespace AdminModels
         ~FUpdatePlayerSharedSecretRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdatePlayerSharedSecretResult : public PlayFab::FPlayFabCppResultCommon
@@ -11714,6 +16397,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FUpdatePlayerSharedSecretResult(FUpdatePlayerSharedSecretResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUpdatePlayerSharedSecretResult& operator=(const FUpdatePlayerSharedSecretResult& src) = default;
+        FUpdatePlayerSharedSecretResult& operator=(FUpdatePlayerSharedSecretResult&& src) = default;
+
         FUpdatePlayerSharedSecretResult(const TSharedPtr<FJsonObject>& obj) : FUpdatePlayerSharedSecretResult()
         {
             readFromValue(obj);
@@ -11722,7 +16412,13 @@ namespace AdminModels
         ~FUpdatePlayerSharedSecretResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdatePlayerStatisticDefinitionRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11753,6 +16449,16 @@ namespace AdminModels
             VersionChangeInterval(src.VersionChangeInterval)
             {}
 
+        FUpdatePlayerStatisticDefinitionRequest(FUpdatePlayerStatisticDefinitionRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AggregationMethod(MoveTemp(src.AggregationMethod)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            VersionChangeInterval(MoveTemp(src.VersionChangeInterval))
+            {}
+
+        FUpdatePlayerStatisticDefinitionRequest& operator=(const FUpdatePlayerStatisticDefinitionRequest& src) = default;
+        FUpdatePlayerStatisticDefinitionRequest& operator=(FUpdatePlayerStatisticDefinitionRequest&& src) = default;
+
         FUpdatePlayerStatisticDefinitionRequest(const TSharedPtr<FJsonObject>& obj) : FUpdatePlayerStatisticDefinitionRequest()
         {
             readFromValue(obj);
@@ -11761,7 +16467,13 @@ namespace AdminModels
         ~FUpdatePlayerStatisticDefinitionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdatePlayerStatisticDefinitionResult : public PlayFab::FPlayFabCppResultCommon
@@ -11776,9 +16488,17 @@ namespace AdminModels
 
         FUpdatePlayerStatisticDefinitionResult(const FUpdatePlayerStatisticDefinitionResult& src) :
             FPlayFabCppResultCommon(),
-            Statistic(src.Statistic.IsValid() ? MakeShareable(new FPlayerStatisticDefinition(*src.Statistic)) : nullptr)
+            Statistic(src.Statistic.IsValid() ? TSharedPtr<FPlayerStatisticDefinition>(MakeShared<FPlayerStatisticDefinition>(*src.Statistic)) : nullptr)
+            {}
+
+        FUpdatePlayerStatisticDefinitionResult(FUpdatePlayerStatisticDefinitionResult&& src) :
+            FPlayFabCppResultCommon(),
+            Statistic(MoveTemp(src.Statistic))
             {}
 
+        FUpdatePlayerStatisticDefinitionResult& operator=(const FUpdatePlayerStatisticDefinitionResult& src) = default;
+        FUpdatePlayerStatisticDefinitionResult& operator=(FUpdatePlayerStatisticDefinitionResult&& src) = default;
+
         FUpdatePlayerStatisticDefinitionResult(const TSharedPtr<FJsonObject>& obj) : FUpdatePlayerStatisticDefinitionResult()
         {
             readFromValue(obj);
@@ -11787,7 +16507,13 @@ namespace AdminModels
         ~FUpdatePlayerStatisticDefinitionResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdatePolicyRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11819,6 +16545,17 @@ namespace AdminModels
             Statements(src.Statements)
             {}
 
+        FUpdatePolicyRequest(FUpdatePolicyRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            OverwritePolicy(MoveTemp(src.OverwritePolicy)),
+            PolicyName(MoveTemp(src.PolicyName)),
+            PolicyVersion(MoveTemp(src.PolicyVersion)),
+            Statements(MoveTemp(src.Statements))
+            {}
+
+        FUpdatePolicyRequest& operator=(const FUpdatePolicyRequest& src) = default;
+        FUpdatePolicyRequest& operator=(FUpdatePolicyRequest&& src) = default;
+
         FUpdatePolicyRequest(const TSharedPtr<FJsonObject>& obj) : FUpdatePolicyRequest()
         {
             readFromValue(obj);
@@ -11827,7 +16564,13 @@ namespace AdminModels
         ~FUpdatePolicyRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdatePolicyResponse : public PlayFab::FPlayFabCppResultCommon
@@ -11849,6 +16592,15 @@ namespace AdminModels
             Statements(src.Statements)
             {}
 
+        FUpdatePolicyResponse(FUpdatePolicyResponse&& src) :
+            FPlayFabCppResultCommon(),
+            PolicyName(MoveTemp(src.PolicyName)),
+            Statements(MoveTemp(src.Statements))
+            {}
+
+        FUpdatePolicyResponse& operator=(const FUpdatePolicyResponse& src) = default;
+        FUpdatePolicyResponse& operator=(FUpdatePolicyResponse&& src) = default;
+
         FUpdatePolicyResponse(const TSharedPtr<FJsonObject>& obj) : FUpdatePolicyResponse()
         {
             readFromValue(obj);
@@ -11857,7 +16609,13 @@ namespace AdminModels
         ~FUpdatePolicyResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateRandomResultTablesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11886,6 +16644,16 @@ namespace AdminModels
             Tables(src.Tables)
             {}
 
+        FUpdateRandomResultTablesRequest(FUpdateRandomResultTablesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Tables(MoveTemp(src.Tables))
+            {}
+
+        FUpdateRandomResultTablesRequest& operator=(const FUpdateRandomResultTablesRequest& src) = default;
+        FUpdateRandomResultTablesRequest& operator=(FUpdateRandomResultTablesRequest&& src) = default;
+
         FUpdateRandomResultTablesRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateRandomResultTablesRequest()
         {
             readFromValue(obj);
@@ -11894,7 +16662,13 @@ namespace AdminModels
         ~FUpdateRandomResultTablesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateRandomResultTablesResult : public PlayFab::FPlayFabCppResultCommon
@@ -11907,6 +16681,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FUpdateRandomResultTablesResult(FUpdateRandomResultTablesResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUpdateRandomResultTablesResult& operator=(const FUpdateRandomResultTablesResult& src) = default;
+        FUpdateRandomResultTablesResult& operator=(FUpdateRandomResultTablesResult&& src) = default;
+
         FUpdateRandomResultTablesResult(const TSharedPtr<FJsonObject>& obj) : FUpdateRandomResultTablesResult()
         {
             readFromValue(obj);
@@ -11915,7 +16696,13 @@ namespace AdminModels
         ~FUpdateRandomResultTablesResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateSegmentRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11933,6 +16720,14 @@ namespace AdminModels
             pfSegmentModel(src.pfSegmentModel)
             {}
 
+        FUpdateSegmentRequest(FUpdateSegmentRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            pfSegmentModel(MoveTemp(src.pfSegmentModel))
+            {}
+
+        FUpdateSegmentRequest& operator=(const FUpdateSegmentRequest& src) = default;
+        FUpdateSegmentRequest& operator=(FUpdateSegmentRequest&& src) = default;
+
         FUpdateSegmentRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateSegmentRequest()
         {
             readFromValue(obj);
@@ -11941,7 +16736,13 @@ namespace AdminModels
         ~FUpdateSegmentRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateSegmentResponse : public PlayFab::FPlayFabCppResultCommon
@@ -11964,6 +16765,15 @@ namespace AdminModels
             SegmentId(src.SegmentId)
             {}
 
+        FUpdateSegmentResponse(FUpdateSegmentResponse&& src) :
+            FPlayFabCppResultCommon(),
+            ErrorMessage(MoveTemp(src.ErrorMessage)),
+            SegmentId(MoveTemp(src.SegmentId))
+            {}
+
+        FUpdateSegmentResponse& operator=(const FUpdateSegmentResponse& src) = default;
+        FUpdateSegmentResponse& operator=(FUpdateSegmentResponse&& src) = default;
+
         FUpdateSegmentResponse(const TSharedPtr<FJsonObject>& obj) : FUpdateSegmentResponse()
         {
             readFromValue(obj);
@@ -11972,7 +16782,13 @@ namespace AdminModels
         ~FUpdateSegmentResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateStoreItemsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12003,11 +16819,23 @@ namespace AdminModels
             FPlayFabCppRequestCommon(),
             CatalogVersion(src.CatalogVersion),
             CustomTags(src.CustomTags),
-            MarketingData(src.MarketingData.IsValid() ? MakeShareable(new FStoreMarketingModel(*src.MarketingData)) : nullptr),
+            MarketingData(src.MarketingData.IsValid() ? TSharedPtr<FStoreMarketingModel>(MakeShared<FStoreMarketingModel>(*src.MarketingData)) : nullptr),
             Store(src.Store),
             StoreId(src.StoreId)
             {}
 
+        FUpdateStoreItemsRequest(FUpdateStoreItemsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            MarketingData(MoveTemp(src.MarketingData)),
+            Store(MoveTemp(src.Store)),
+            StoreId(MoveTemp(src.StoreId))
+            {}
+
+        FUpdateStoreItemsRequest& operator=(const FUpdateStoreItemsRequest& src) = default;
+        FUpdateStoreItemsRequest& operator=(FUpdateStoreItemsRequest&& src) = default;
+
         FUpdateStoreItemsRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateStoreItemsRequest()
         {
             readFromValue(obj);
@@ -12016,7 +16844,13 @@ namespace AdminModels
         ~FUpdateStoreItemsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateStoreItemsResult : public PlayFab::FPlayFabCppResultCommon
@@ -12029,6 +16863,13 @@ namespace AdminModels
             FPlayFabCppResultCommon()
             {}
 
+        FUpdateStoreItemsResult(FUpdateStoreItemsResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUpdateStoreItemsResult& operator=(const FUpdateStoreItemsResult& src) = default;
+        FUpdateStoreItemsResult& operator=(FUpdateStoreItemsResult&& src) = default;
+
         FUpdateStoreItemsResult(const TSharedPtr<FJsonObject>& obj) : FUpdateStoreItemsResult()
         {
             readFromValue(obj);
@@ -12037,7 +16878,13 @@ namespace AdminModels
         ~FUpdateStoreItemsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateTaskRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12081,7 +16928,7 @@ namespace AdminModels
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
             Description(src.Description),
-            Identifier(src.Identifier.IsValid() ? MakeShareable(new FNameIdentifier(*src.Identifier)) : nullptr),
+            Identifier(src.Identifier.IsValid() ? TSharedPtr<FNameIdentifier>(MakeShared<FNameIdentifier>(*src.Identifier)) : nullptr),
             IsActive(src.IsActive),
             Name(src.Name),
             Parameter(src.Parameter),
@@ -12089,6 +16936,21 @@ namespace AdminModels
             Type(src.Type)
             {}
 
+        FUpdateTaskRequest(FUpdateTaskRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Description(MoveTemp(src.Description)),
+            Identifier(MoveTemp(src.Identifier)),
+            IsActive(MoveTemp(src.IsActive)),
+            Name(MoveTemp(src.Name)),
+            Parameter(MoveTemp(src.Parameter)),
+            Schedule(MoveTemp(src.Schedule)),
+            Type(MoveTemp(src.Type))
+            {}
+
+        FUpdateTaskRequest& operator=(const FUpdateTaskRequest& src) = default;
+        FUpdateTaskRequest& operator=(FUpdateTaskRequest&& src) = default;
+
         FUpdateTaskRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateTaskRequest()
         {
             readFromValue(obj);
@@ -12097,7 +16959,13 @@ namespace AdminModels
         ~FUpdateTaskRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateUserDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12138,6 +17006,18 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FUpdateUserDataRequest(FUpdateUserDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Data(MoveTemp(src.Data)),
+            KeysToRemove(MoveTemp(src.KeysToRemove)),
+            Permission(MoveTemp(src.Permission)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FUpdateUserDataRequest& operator=(const FUpdateUserDataRequest& src) = default;
+        FUpdateUserDataRequest& operator=(FUpdateUserDataRequest&& src) = default;
+
         FUpdateUserDataRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateUserDataRequest()
         {
             readFromValue(obj);
@@ -12146,7 +17026,13 @@ namespace AdminModels
         ~FUpdateUserDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateUserDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -12167,6 +17053,14 @@ namespace AdminModels
             DataVersion(src.DataVersion)
             {}
 
+        FUpdateUserDataResult(FUpdateUserDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            DataVersion(MoveTemp(src.DataVersion))
+            {}
+
+        FUpdateUserDataResult& operator=(const FUpdateUserDataResult& src) = default;
+        FUpdateUserDataResult& operator=(FUpdateUserDataResult&& src) = default;
+
         FUpdateUserDataResult(const TSharedPtr<FJsonObject>& obj) : FUpdateUserDataResult()
         {
             readFromValue(obj);
@@ -12175,7 +17069,13 @@ namespace AdminModels
         ~FUpdateUserDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateUserInternalDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12211,6 +17111,17 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FUpdateUserInternalDataRequest(FUpdateUserInternalDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Data(MoveTemp(src.Data)),
+            KeysToRemove(MoveTemp(src.KeysToRemove)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FUpdateUserInternalDataRequest& operator=(const FUpdateUserInternalDataRequest& src) = default;
+        FUpdateUserInternalDataRequest& operator=(FUpdateUserInternalDataRequest&& src) = default;
+
         FUpdateUserInternalDataRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateUserInternalDataRequest()
         {
             readFromValue(obj);
@@ -12219,7 +17130,13 @@ namespace AdminModels
         ~FUpdateUserInternalDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateUserTitleDisplayNameRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -12246,6 +17163,16 @@ namespace AdminModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FUpdateUserTitleDisplayNameRequest(FUpdateUserTitleDisplayNameRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FUpdateUserTitleDisplayNameRequest& operator=(const FUpdateUserTitleDisplayNameRequest& src) = default;
+        FUpdateUserTitleDisplayNameRequest& operator=(FUpdateUserTitleDisplayNameRequest&& src) = default;
+
         FUpdateUserTitleDisplayNameRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateUserTitleDisplayNameRequest()
         {
             readFromValue(obj);
@@ -12254,7 +17181,13 @@ namespace AdminModels
         ~FUpdateUserTitleDisplayNameRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateUserTitleDisplayNameResult : public PlayFab::FPlayFabCppResultCommon
@@ -12272,6 +17205,14 @@ namespace AdminModels
             DisplayName(src.DisplayName)
             {}
 
+        FUpdateUserTitleDisplayNameResult(FUpdateUserTitleDisplayNameResult&& src) :
+            FPlayFabCppResultCommon(),
+            DisplayName(MoveTemp(src.DisplayName))
+            {}
+
+        FUpdateUserTitleDisplayNameResult& operator=(const FUpdateUserTitleDisplayNameResult& src) = default;
+        FUpdateUserTitleDisplayNameResult& operator=(FUpdateUserTitleDisplayNameResult&& src) = default;
+
         FUpdateUserTitleDisplayNameResult(const TSharedPtr<FJsonObject>& obj) : FUpdateUserTitleDisplayNameResult()
         {
             readFromValue(obj);
@@ -12280,7 +17221,13 @@ namespace AdminModels
         ~FUpdateUserTitleDisplayNameResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
 }
@@ -34,6 +34,15 @@ namespace AuthenticationModels
             Type(src.Type)
             {}
 
+        FEntityKey(FEntityKey&& src) :
+            FPlayFabCppBaseModel(),
+            Id(MoveTemp(src.Id)),
+            Type(MoveTemp(src.Type))
+            {}
+
+        FEntityKey& operator=(const FEntityKey& src) = default;
+        FEntityKey& operator=(FEntityKey&& src) = default;
+
         FEntityKey(const TSharedPtr<FJsonObject>& obj) : FEntityKey()
         {
             readFromValue(obj);
@@ -42,7 +51,13 @@ namespace AuthenticationModels
         ~FEntityKey();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityLineage : public PlayFab::FPlayFabCppBaseModel
@@ -85,6 +100,19 @@ namespace AuthenticationModels
             TitlePlayerAccountId(src.TitlePlayerAccountId)
             {}
 
+        FEntityLineage(FEntityLineage&& src) :
+            FPlayFabCppBaseModel(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            GroupId(MoveTemp(src.GroupId)),
+            MasterPlayerAccountId(MoveTemp(src.MasterPlayerAccountId)),
+            NamespaceId(MoveTemp(src.NamespaceId)),
+            TitleId(MoveTemp(src.TitleId)),
+            TitlePlayerAccountId(MoveTemp(src.TitlePlayerAccountId))
+            {}
+
+        FEntityLineage& operator=(const FEntityLineage& src) = default;
+        FEntityLineage& operator=(FEntityLineage&& src) = default;
+
         FEntityLineage(const TSharedPtr<FJsonObject>& obj) : FEntityLineage()
         {
             readFromValue(obj);
@@ -93,7 +121,13 @@ namespace AuthenticationModels
         ~FEntityLineage();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetEntityTokenRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -112,9 +146,18 @@ namespace AuthenticationModels
         FGetEntityTokenRequest(const FGetEntityTokenRequest& src) :
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr)
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr)
             {}
 
+        FGetEntityTokenRequest(FGetEntityTokenRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity))
+            {}
+
+        FGetEntityTokenRequest& operator=(const FGetEntityTokenRequest& src) = default;
+        FGetEntityTokenRequest& operator=(FGetEntityTokenRequest&& src) = default;
+
         FGetEntityTokenRequest(const TSharedPtr<FJsonObject>& obj) : FGetEntityTokenRequest()
         {
             readFromValue(obj);
@@ -123,7 +166,13 @@ namespace AuthenticationModels
         ~FGetEntityTokenRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetEntityTokenResponse : public PlayFab::FPlayFabCppResultCommon
@@ -146,11 +195,21 @@ namespace AuthenticationModels
 
         FGetEntityTokenResponse(const FGetEntityTokenResponse& src) :
             FPlayFabCppResultCommon(),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             EntityToken(src.EntityToken),
             TokenExpiration(src.TokenExpiration)
             {}
 
+        FGetEntityTokenResponse(FGetEntityTokenResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Entity(MoveTemp(src.Entity)),
+            EntityToken(MoveTemp(src.EntityToken)),
+            TokenExpiration(MoveTemp(src.TokenExpiration))
+            {}
+
+        FGetEntityTokenResponse& operator=(const FGetEntityTokenResponse& src) = default;
+        FGetEntityTokenResponse& operator=(FGetEntityTokenResponse&& src) = default;
+
         FGetEntityTokenResponse(const TSharedPtr<FJsonObject>& obj) : FGetEntityTokenResponse()
         {
             readFromValue(obj);
@@ -159,7 +218,13 @@ namespace AuthenticationModels
         ~FGetEntityTokenResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum IdentifiedDeviceType
@@ -170,6 +235,7 @@ namespace AuthenticationModels
     };
 
     PLAYFABCPP_API void writeIdentifiedDeviceTypeEnumJSON(IdentifiedDeviceType enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeIdentifiedDeviceTypeEnumJSON(IdentifiedDeviceType enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API IdentifiedDeviceType readIdentifiedDeviceTypeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API IdentifiedDeviceType readIdentifiedDeviceTypeFromValue(const FString& value);
 
@@ -199,6 +265,7 @@ namespace AuthenticationModels
     };
 
     PLAYFABCPP_API void writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API LoginIdentityProvider readLoginIdentityProviderFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API LoginIdentityProvider readLoginIdentityProviderFromValue(const FString& value);
 
@@ -221,6 +288,15 @@ namespace AuthenticationModels
             EntityToken(src.EntityToken)
             {}
 
+        FValidateEntityTokenRequest(FValidateEntityTokenRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EntityToken(MoveTemp(src.EntityToken))
+            {}
+
+        FValidateEntityTokenRequest& operator=(const FValidateEntityTokenRequest& src) = default;
+        FValidateEntityTokenRequest& operator=(FValidateEntityTokenRequest&& src) = default;
+
         FValidateEntityTokenRequest(const TSharedPtr<FJsonObject>& obj) : FValidateEntityTokenRequest()
         {
             readFromValue(obj);
@@ -229,7 +305,13 @@ namespace AuthenticationModels
         ~FValidateEntityTokenRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValidateEntityTokenResponse : public PlayFab::FPlayFabCppResultCommon
@@ -256,12 +338,23 @@ namespace AuthenticationModels
 
         FValidateEntityTokenResponse(const FValidateEntityTokenResponse& src) :
             FPlayFabCppResultCommon(),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             pfIdentifiedDeviceType(src.pfIdentifiedDeviceType),
             IdentityProvider(src.IdentityProvider),
-            Lineage(src.Lineage.IsValid() ? MakeShareable(new FEntityLineage(*src.Lineage)) : nullptr)
+            Lineage(src.Lineage.IsValid() ? TSharedPtr<FEntityLineage>(MakeShared<FEntityLineage>(*src.Lineage)) : nullptr)
             {}
 
+        FValidateEntityTokenResponse(FValidateEntityTokenResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Entity(MoveTemp(src.Entity)),
+            pfIdentifiedDeviceType(MoveTemp(src.pfIdentifiedDeviceType)),
+            IdentityProvider(MoveTemp(src.IdentityProvider)),
+            Lineage(MoveTemp(src.Lineage))
+            {}
+
+        FValidateEntityTokenResponse& operator=(const FValidateEntityTokenResponse& src) = default;
+        FValidateEntityTokenResponse& operator=(FValidateEntityTokenResponse&& src) = default;
+
         FValidateEntityTokenResponse(const TSharedPtr<FJsonObject>& obj) : FValidateEntityTokenResponse()
         {
             readFromValue(obj);
@@ -270,7 +363,13 @@ namespace AuthenticationModels
         ~FValidateEntityTokenResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
 }
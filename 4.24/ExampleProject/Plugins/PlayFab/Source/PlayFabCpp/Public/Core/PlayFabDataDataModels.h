@@ -34,6 +34,15 @@ namespace DataModels
             Type(src.Type)
             {}
 
+        FEntityKey(FEntityKey&& src) :
+            FPlayFabCppBaseModel(),
+            Id(MoveTemp(src.Id)),
+            Type(MoveTemp(src.Type))
+            {}
+
+        FEntityKey& operator=(const FEntityKey& src) = default;
+        FEntityKey& operator=(FEntityKey&& src) = default;
+
         FEntityKey(const TSharedPtr<FJsonObject>& obj) : FEntityKey()
         {
             readFromValue(obj);
@@ -42,7 +51,13 @@ namespace DataModels
         ~FEntityKey();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAbortFileUploadsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -76,6 +91,17 @@ namespace DataModels
             ProfileVersion(src.ProfileVersion)
             {}
 
+        FAbortFileUploadsRequest(FAbortFileUploadsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            FileNames(MoveTemp(src.FileNames)),
+            ProfileVersion(MoveTemp(src.ProfileVersion))
+            {}
+
+        FAbortFileUploadsRequest& operator=(const FAbortFileUploadsRequest& src) = default;
+        FAbortFileUploadsRequest& operator=(FAbortFileUploadsRequest&& src) = default;
+
         FAbortFileUploadsRequest(const TSharedPtr<FJsonObject>& obj) : FAbortFileUploadsRequest()
         {
             readFromValue(obj);
@@ -84,7 +110,13 @@ namespace DataModels
         ~FAbortFileUploadsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAbortFileUploadsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -103,10 +135,19 @@ namespace DataModels
 
         FAbortFileUploadsResponse(const FAbortFileUploadsResponse& src) :
             FPlayFabCppResultCommon(),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             ProfileVersion(src.ProfileVersion)
             {}
 
+        FAbortFileUploadsResponse(FAbortFileUploadsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Entity(MoveTemp(src.Entity)),
+            ProfileVersion(MoveTemp(src.ProfileVersion))
+            {}
+
+        FAbortFileUploadsResponse& operator=(const FAbortFileUploadsResponse& src) = default;
+        FAbortFileUploadsResponse& operator=(FAbortFileUploadsResponse&& src) = default;
+
         FAbortFileUploadsResponse(const TSharedPtr<FJsonObject>& obj) : FAbortFileUploadsResponse()
         {
             readFromValue(obj);
@@ -115,7 +156,13 @@ namespace DataModels
         ~FAbortFileUploadsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteFilesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -149,6 +196,17 @@ namespace DataModels
             ProfileVersion(src.ProfileVersion)
             {}
 
+        FDeleteFilesRequest(FDeleteFilesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            FileNames(MoveTemp(src.FileNames)),
+            ProfileVersion(MoveTemp(src.ProfileVersion))
+            {}
+
+        FDeleteFilesRequest& operator=(const FDeleteFilesRequest& src) = default;
+        FDeleteFilesRequest& operator=(FDeleteFilesRequest&& src) = default;
+
         FDeleteFilesRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteFilesRequest()
         {
             readFromValue(obj);
@@ -157,7 +215,13 @@ namespace DataModels
         ~FDeleteFilesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteFilesResponse : public PlayFab::FPlayFabCppResultCommon
@@ -176,10 +240,19 @@ namespace DataModels
 
         FDeleteFilesResponse(const FDeleteFilesResponse& src) :
             FPlayFabCppResultCommon(),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             ProfileVersion(src.ProfileVersion)
             {}
 
+        FDeleteFilesResponse(FDeleteFilesResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Entity(MoveTemp(src.Entity)),
+            ProfileVersion(MoveTemp(src.ProfileVersion))
+            {}
+
+        FDeleteFilesResponse& operator=(const FDeleteFilesResponse& src) = default;
+        FDeleteFilesResponse& operator=(FDeleteFilesResponse&& src) = default;
+
         FDeleteFilesResponse(const TSharedPtr<FJsonObject>& obj) : FDeleteFilesResponse()
         {
             readFromValue(obj);
@@ -188,7 +261,13 @@ namespace DataModels
         ~FDeleteFilesResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FFinalizeFileUploadsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -219,6 +298,17 @@ namespace DataModels
             ProfileVersion(src.ProfileVersion)
             {}
 
+        FFinalizeFileUploadsRequest(FFinalizeFileUploadsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            FileNames(MoveTemp(src.FileNames)),
+            ProfileVersion(MoveTemp(src.ProfileVersion))
+            {}
+
+        FFinalizeFileUploadsRequest& operator=(const FFinalizeFileUploadsRequest& src) = default;
+        FFinalizeFileUploadsRequest& operator=(FFinalizeFileUploadsRequest&& src) = default;
+
         FFinalizeFileUploadsRequest(const TSharedPtr<FJsonObject>& obj) : FFinalizeFileUploadsRequest()
         {
             readFromValue(obj);
@@ -227,7 +317,13 @@ namespace DataModels
         ~FFinalizeFileUploadsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetFileMetadata : public PlayFab::FPlayFabCppBaseModel
@@ -265,6 +361,18 @@ namespace DataModels
             Size(src.Size)
             {}
 
+        FGetFileMetadata(FGetFileMetadata&& src) :
+            FPlayFabCppBaseModel(),
+            Checksum(MoveTemp(src.Checksum)),
+            DownloadUrl(MoveTemp(src.DownloadUrl)),
+            FileName(MoveTemp(src.FileName)),
+            LastModified(MoveTemp(src.LastModified)),
+            Size(MoveTemp(src.Size))
+            {}
+
+        FGetFileMetadata& operator=(const FGetFileMetadata& src) = default;
+        FGetFileMetadata& operator=(FGetFileMetadata&& src) = default;
+
         FGetFileMetadata(const TSharedPtr<FJsonObject>& obj) : FGetFileMetadata()
         {
             readFromValue(obj);
@@ -273,7 +381,13 @@ namespace DataModels
         ~FGetFileMetadata();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FFinalizeFileUploadsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -295,11 +409,21 @@ namespace DataModels
 
         FFinalizeFileUploadsResponse(const FFinalizeFileUploadsResponse& src) :
             FPlayFabCppResultCommon(),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             Metadata(src.Metadata),
             ProfileVersion(src.ProfileVersion)
             {}
 
+        FFinalizeFileUploadsResponse(FFinalizeFileUploadsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Entity(MoveTemp(src.Entity)),
+            Metadata(MoveTemp(src.Metadata)),
+            ProfileVersion(MoveTemp(src.ProfileVersion))
+            {}
+
+        FFinalizeFileUploadsResponse& operator=(const FFinalizeFileUploadsResponse& src) = default;
+        FFinalizeFileUploadsResponse& operator=(FFinalizeFileUploadsResponse&& src) = default;
+
         FFinalizeFileUploadsResponse(const TSharedPtr<FJsonObject>& obj) : FFinalizeFileUploadsResponse()
         {
             readFromValue(obj);
@@ -308,7 +432,13 @@ namespace DataModels
         ~FFinalizeFileUploadsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetFilesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -330,6 +460,15 @@ namespace DataModels
             Entity(src.Entity)
             {}
 
+        FGetFilesRequest(FGetFilesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity))
+            {}
+
+        FGetFilesRequest& operator=(const FGetFilesRequest& src) = default;
+        FGetFilesRequest& operator=(FGetFilesRequest&& src) = default;
+
         FGetFilesRequest(const TSharedPtr<FJsonObject>& obj) : FGetFilesRequest()
         {
             readFromValue(obj);
@@ -338,7 +477,13 @@ namespace DataModels
         ~FGetFilesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetFilesResponse : public PlayFab::FPlayFabCppResultCommon
@@ -360,11 +505,21 @@ namespace DataModels
 
         FGetFilesResponse(const FGetFilesResponse& src) :
             FPlayFabCppResultCommon(),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             Metadata(src.Metadata),
             ProfileVersion(src.ProfileVersion)
             {}
 
+        FGetFilesResponse(FGetFilesResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Entity(MoveTemp(src.Entity)),
+            Metadata(MoveTemp(src.Metadata)),
+            ProfileVersion(MoveTemp(src.ProfileVersion))
+            {}
+
+        FGetFilesResponse& operator=(const FGetFilesResponse& src) = default;
+        FGetFilesResponse& operator=(FGetFilesResponse&& src) = default;
+
         FGetFilesResponse(const TSharedPtr<FJsonObject>& obj) : FGetFilesResponse()
         {
             readFromValue(obj);
@@ -373,7 +528,13 @@ namespace DataModels
         ~FGetFilesResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetObjectsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -403,6 +564,16 @@ namespace DataModels
             EscapeObject(src.EscapeObject)
             {}
 
+        FGetObjectsRequest(FGetObjectsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            EscapeObject(MoveTemp(src.EscapeObject))
+            {}
+
+        FGetObjectsRequest& operator=(const FGetObjectsRequest& src) = default;
+        FGetObjectsRequest& operator=(FGetObjectsRequest&& src) = default;
+
         FGetObjectsRequest(const TSharedPtr<FJsonObject>& obj) : FGetObjectsRequest()
         {
             readFromValue(obj);
@@ -411,7 +582,13 @@ namespace DataModels
         ~FGetObjectsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FObjectResult : public PlayFab::FPlayFabCppBaseModel
@@ -439,6 +616,16 @@ namespace DataModels
             ObjectName(src.ObjectName)
             {}
 
+        FObjectResult(FObjectResult&& src) :
+            FPlayFabCppBaseModel(),
+            DataObject(MoveTemp(src.DataObject)),
+            EscapedDataObject(MoveTemp(src.EscapedDataObject)),
+            ObjectName(MoveTemp(src.ObjectName))
+            {}
+
+        FObjectResult& operator=(const FObjectResult& src) = default;
+        FObjectResult& operator=(FObjectResult&& src) = default;
+
         FObjectResult(const TSharedPtr<FJsonObject>& obj) : FObjectResult()
         {
             readFromValue(obj);
@@ -447,7 +634,13 @@ namespace DataModels
         ~FObjectResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetObjectsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -469,11 +662,21 @@ namespace DataModels
 
         FGetObjectsResponse(const FGetObjectsResponse& src) :
             FPlayFabCppResultCommon(),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             Objects(src.Objects),
             ProfileVersion(src.ProfileVersion)
             {}
 
+        FGetObjectsResponse(FGetObjectsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Entity(MoveTemp(src.Entity)),
+            Objects(MoveTemp(src.Objects)),
+            ProfileVersion(MoveTemp(src.ProfileVersion))
+            {}
+
+        FGetObjectsResponse& operator=(const FGetObjectsResponse& src) = default;
+        FGetObjectsResponse& operator=(FGetObjectsResponse&& src) = default;
+
         FGetObjectsResponse(const TSharedPtr<FJsonObject>& obj) : FGetObjectsResponse()
         {
             readFromValue(obj);
@@ -482,7 +685,13 @@ namespace DataModels
         ~FGetObjectsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FInitiateFileUploadMetadata : public PlayFab::FPlayFabCppBaseModel
@@ -505,6 +714,15 @@ namespace DataModels
             UploadUrl(src.UploadUrl)
             {}
 
+        FInitiateFileUploadMetadata(FInitiateFileUploadMetadata&& src) :
+            FPlayFabCppBaseModel(),
+            FileName(MoveTemp(src.FileName)),
+            UploadUrl(MoveTemp(src.UploadUrl))
+            {}
+
+        FInitiateFileUploadMetadata& operator=(const FInitiateFileUploadMetadata& src) = default;
+        FInitiateFileUploadMetadata& operator=(FInitiateFileUploadMetadata&& src) = default;
+
         FInitiateFileUploadMetadata(const TSharedPtr<FJsonObject>& obj) : FInitiateFileUploadMetadata()
         {
             readFromValue(obj);
@@ -513,7 +731,13 @@ namespace DataModels
         ~FInitiateFileUploadMetadata();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FInitiateFileUploadsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -547,6 +771,17 @@ namespace DataModels
             ProfileVersion(src.ProfileVersion)
             {}
 
+        FInitiateFileUploadsRequest(FInitiateFileUploadsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            FileNames(MoveTemp(src.FileNames)),
+            ProfileVersion(MoveTemp(src.ProfileVersion))
+            {}
+
+        FInitiateFileUploadsRequest& operator=(const FInitiateFileUploadsRequest& src) = default;
+        FInitiateFileUploadsRequest& operator=(FInitiateFileUploadsRequest&& src) = default;
+
         FInitiateFileUploadsRequest(const TSharedPtr<FJsonObject>& obj) : FInitiateFileUploadsRequest()
         {
             readFromValue(obj);
@@ -555,7 +790,13 @@ namespace DataModels
         ~FInitiateFileUploadsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FInitiateFileUploadsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -577,11 +818,21 @@ namespace DataModels
 
         FInitiateFileUploadsResponse(const FInitiateFileUploadsResponse& src) :
             FPlayFabCppResultCommon(),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             ProfileVersion(src.ProfileVersion),
             UploadDetails(src.UploadDetails)
             {}
 
+        FInitiateFileUploadsResponse(FInitiateFileUploadsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Entity(MoveTemp(src.Entity)),
+            ProfileVersion(MoveTemp(src.ProfileVersion)),
+            UploadDetails(MoveTemp(src.UploadDetails))
+            {}
+
+        FInitiateFileUploadsResponse& operator=(const FInitiateFileUploadsResponse& src) = default;
+        FInitiateFileUploadsResponse& operator=(FInitiateFileUploadsResponse&& src) = default;
+
         FInitiateFileUploadsResponse(const TSharedPtr<FJsonObject>& obj) : FInitiateFileUploadsResponse()
         {
             readFromValue(obj);
@@ -590,7 +841,13 @@ namespace DataModels
         ~FInitiateFileUploadsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum OperationTypes
@@ -602,6 +859,7 @@ namespace DataModels
     };
 
     PLAYFABCPP_API void writeOperationTypesEnumJSON(OperationTypes enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeOperationTypesEnumJSON(OperationTypes enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API OperationTypes readOperationTypesFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API OperationTypes readOperationTypesFromValue(const FString& value);
 
@@ -641,6 +899,17 @@ namespace DataModels
             ObjectName(src.ObjectName)
             {}
 
+        FSetObject(FSetObject&& src) :
+            FPlayFabCppBaseModel(),
+            DataObject(MoveTemp(src.DataObject)),
+            DeleteObject(MoveTemp(src.DeleteObject)),
+            EscapedDataObject(MoveTemp(src.EscapedDataObject)),
+            ObjectName(MoveTemp(src.ObjectName))
+            {}
+
+        FSetObject& operator=(const FSetObject& src) = default;
+        FSetObject& operator=(FSetObject&& src) = default;
+
         FSetObject(const TSharedPtr<FJsonObject>& obj) : FSetObject()
         {
             readFromValue(obj);
@@ -649,7 +918,13 @@ namespace DataModels
         ~FSetObject();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetObjectInfo : public PlayFab::FPlayFabCppBaseModel
@@ -677,6 +952,16 @@ namespace DataModels
             SetResult(src.SetResult)
             {}
 
+        FSetObjectInfo(FSetObjectInfo&& src) :
+            FPlayFabCppBaseModel(),
+            ObjectName(MoveTemp(src.ObjectName)),
+            OperationReason(MoveTemp(src.OperationReason)),
+            SetResult(MoveTemp(src.SetResult))
+            {}
+
+        FSetObjectInfo& operator=(const FSetObjectInfo& src) = default;
+        FSetObjectInfo& operator=(FSetObjectInfo&& src) = default;
+
         FSetObjectInfo(const TSharedPtr<FJsonObject>& obj) : FSetObjectInfo()
         {
             readFromValue(obj);
@@ -685,7 +970,13 @@ namespace DataModels
         ~FSetObjectInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetObjectsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -720,6 +1011,17 @@ namespace DataModels
             Objects(src.Objects)
             {}
 
+        FSetObjectsRequest(FSetObjectsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            ExpectedProfileVersion(MoveTemp(src.ExpectedProfileVersion)),
+            Objects(MoveTemp(src.Objects))
+            {}
+
+        FSetObjectsRequest& operator=(const FSetObjectsRequest& src) = default;
+        FSetObjectsRequest& operator=(FSetObjectsRequest&& src) = default;
+
         FSetObjectsRequest(const TSharedPtr<FJsonObject>& obj) : FSetObjectsRequest()
         {
             readFromValue(obj);
@@ -728,7 +1030,13 @@ namespace DataModels
         ~FSetObjectsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetObjectsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -750,6 +1058,15 @@ namespace DataModels
             SetResults(src.SetResults)
             {}
 
+        FSetObjectsResponse(FSetObjectsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            ProfileVersion(MoveTemp(src.ProfileVersion)),
+            SetResults(MoveTemp(src.SetResults))
+            {}
+
+        FSetObjectsResponse& operator=(const FSetObjectsResponse& src) = default;
+        FSetObjectsResponse& operator=(FSetObjectsResponse&& src) = default;
+
         FSetObjectsResponse(const TSharedPtr<FJsonObject>& obj) : FSetObjectsResponse()
         {
             readFromValue(obj);
@@ -758,7 +1075,13 @@ namespace DataModels
         ~FSetObjectsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
 }
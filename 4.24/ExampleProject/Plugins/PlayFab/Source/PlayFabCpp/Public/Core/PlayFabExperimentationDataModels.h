@@ -26,6 +26,7 @@ namespace ExperimentationModels
     };
 
     PLAYFABCPP_API void writeAnalysisTaskStateEnumJSON(AnalysisTaskState enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeAnalysisTaskStateEnumJSON(AnalysisTaskState enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API AnalysisTaskState readAnalysisTaskStateFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API AnalysisTaskState readAnalysisTaskStateFromValue(const FString& value);
 
@@ -53,6 +54,16 @@ namespace ExperimentationModels
             Name(src.Name)
             {}
 
+        FCreateExclusionGroupRequest(FCreateExclusionGroupRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Description(MoveTemp(src.Description)),
+            Name(MoveTemp(src.Name))
+            {}
+
+        FCreateExclusionGroupRequest& operator=(const FCreateExclusionGroupRequest& src) = default;
+        FCreateExclusionGroupRequest& operator=(FCreateExclusionGroupRequest&& src) = default;
+
         FCreateExclusionGroupRequest(const TSharedPtr<FJsonObject>& obj) : FCreateExclusionGroupRequest()
         {
             readFromValue(obj);
@@ -61,7 +72,13 @@ namespace ExperimentationModels
         ~FCreateExclusionGroupRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateExclusionGroupResult : public PlayFab::FPlayFabCppResultCommon
@@ -79,6 +96,14 @@ namespace ExperimentationModels
             ExclusionGroupId(src.ExclusionGroupId)
             {}
 
+        FCreateExclusionGroupResult(FCreateExclusionGroupResult&& src) :
+            FPlayFabCppResultCommon(),
+            ExclusionGroupId(MoveTemp(src.ExclusionGroupId))
+            {}
+
+        FCreateExclusionGroupResult& operator=(const FCreateExclusionGroupResult& src) = default;
+        FCreateExclusionGroupResult& operator=(FCreateExclusionGroupResult&& src) = default;
+
         FCreateExclusionGroupResult(const TSharedPtr<FJsonObject>& obj) : FCreateExclusionGroupResult()
         {
             readFromValue(obj);
@@ -87,7 +112,13 @@ namespace ExperimentationModels
         ~FCreateExclusionGroupResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum ExperimentType
@@ -97,6 +128,7 @@ namespace ExperimentationModels
     };
 
     PLAYFABCPP_API void writeExperimentTypeEnumJSON(ExperimentType enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeExperimentTypeEnumJSON(ExperimentType enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API ExperimentType readExperimentTypeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API ExperimentType readExperimentTypeFromValue(const FString& value);
 
@@ -120,6 +152,15 @@ namespace ExperimentationModels
             Value(src.Value)
             {}
 
+        FVariable(FVariable&& src) :
+            FPlayFabCppBaseModel(),
+            Name(MoveTemp(src.Name)),
+            Value(MoveTemp(src.Value))
+            {}
+
+        FVariable& operator=(const FVariable& src) = default;
+        FVariable& operator=(FVariable&& src) = default;
+
         FVariable(const TSharedPtr<FJsonObject>& obj) : FVariable()
         {
             readFromValue(obj);
@@ -128,7 +169,13 @@ namespace ExperimentationModels
         ~FVariable();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FVariant : public PlayFab::FPlayFabCppBaseModel
@@ -175,6 +222,20 @@ namespace ExperimentationModels
             Variables(src.Variables)
             {}
 
+        FVariant(FVariant&& src) :
+            FPlayFabCppBaseModel(),
+            Description(MoveTemp(src.Description)),
+            Id(MoveTemp(src.Id)),
+            IsControl(MoveTemp(src.IsControl)),
+            Name(MoveTemp(src.Name)),
+            TitleDataOverrideLabel(MoveTemp(src.TitleDataOverrideLabel)),
+            TrafficPercentage(MoveTemp(src.TrafficPercentage)),
+            Variables(MoveTemp(src.Variables))
+            {}
+
+        FVariant& operator=(const FVariant& src) = default;
+        FVariant& operator=(FVariant&& src) = default;
+
         FVariant(const TSharedPtr<FJsonObject>& obj) : FVariant()
         {
             readFromValue(obj);
@@ -183,7 +244,13 @@ namespace ExperimentationModels
         ~FVariant();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateExperimentRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -251,6 +318,24 @@ namespace ExperimentationModels
             Variants(src.Variants)
             {}
 
+        FCreateExperimentRequest(FCreateExperimentRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Description(MoveTemp(src.Description)),
+            EndDate(MoveTemp(src.EndDate)),
+            ExclusionGroupId(MoveTemp(src.ExclusionGroupId)),
+            ExclusionGroupTrafficAllocation(MoveTemp(src.ExclusionGroupTrafficAllocation)),
+            pfExperimentType(MoveTemp(src.pfExperimentType)),
+            Name(MoveTemp(src.Name)),
+            SegmentId(MoveTemp(src.SegmentId)),
+            StartDate(MoveTemp(src.StartDate)),
+            TitlePlayerAccountTestIds(MoveTemp(src.TitlePlayerAccountTestIds)),
+            Variants(MoveTemp(src.Variants))
+            {}
+
+        FCreateExperimentRequest& operator=(const FCreateExperimentRequest& src) = default;
+        FCreateExperimentRequest& operator=(FCreateExperimentRequest&& src) = default;
+
         FCreateExperimentRequest(const TSharedPtr<FJsonObject>& obj) : FCreateExperimentRequest()
         {
             readFromValue(obj);
@@ -259,7 +344,13 @@ namespace ExperimentationModels
         ~FCreateExperimentRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateExperimentResult : public PlayFab::FPlayFabCppResultCommon
@@ -277,6 +368,14 @@ namespace ExperimentationModels
             ExperimentId(src.ExperimentId)
             {}
 
+        FCreateExperimentResult(FCreateExperimentResult&& src) :
+            FPlayFabCppResultCommon(),
+            ExperimentId(MoveTemp(src.ExperimentId))
+            {}
+
+        FCreateExperimentResult& operator=(const FCreateExperimentResult& src) = default;
+        FCreateExperimentResult& operator=(FCreateExperimentResult&& src) = default;
+
         FCreateExperimentResult(const TSharedPtr<FJsonObject>& obj) : FCreateExperimentResult()
         {
             readFromValue(obj);
@@ -285,7 +384,13 @@ namespace ExperimentationModels
         ~FCreateExperimentResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteExclusionGroupRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -307,6 +412,15 @@ namespace ExperimentationModels
             ExclusionGroupId(src.ExclusionGroupId)
             {}
 
+        FDeleteExclusionGroupRequest(FDeleteExclusionGroupRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ExclusionGroupId(MoveTemp(src.ExclusionGroupId))
+            {}
+
+        FDeleteExclusionGroupRequest& operator=(const FDeleteExclusionGroupRequest& src) = default;
+        FDeleteExclusionGroupRequest& operator=(FDeleteExclusionGroupRequest&& src) = default;
+
         FDeleteExclusionGroupRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteExclusionGroupRequest()
         {
             readFromValue(obj);
@@ -315,7 +429,13 @@ namespace ExperimentationModels
         ~FDeleteExclusionGroupRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteExperimentRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -337,6 +457,15 @@ namespace ExperimentationModels
             ExperimentId(src.ExperimentId)
             {}
 
+        FDeleteExperimentRequest(FDeleteExperimentRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ExperimentId(MoveTemp(src.ExperimentId))
+            {}
+
+        FDeleteExperimentRequest& operator=(const FDeleteExperimentRequest& src) = default;
+        FDeleteExperimentRequest& operator=(FDeleteExperimentRequest&& src) = default;
+
         FDeleteExperimentRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteExperimentRequest()
         {
             readFromValue(obj);
@@ -345,7 +474,13 @@ namespace ExperimentationModels
         ~FDeleteExperimentRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEmptyResponse : public PlayFab::FPlayFabCppResultCommon
@@ -358,6 +493,13 @@ namespace ExperimentationModels
             FPlayFabCppResultCommon()
             {}
 
+        FEmptyResponse(FEmptyResponse&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FEmptyResponse& operator=(const FEmptyResponse& src) = default;
+        FEmptyResponse& operator=(FEmptyResponse&& src) = default;
+
         FEmptyResponse(const TSharedPtr<FJsonObject>& obj) : FEmptyResponse()
         {
             readFromValue(obj);
@@ -366,7 +508,13 @@ namespace ExperimentationModels
         ~FEmptyResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityKey : public PlayFab::FPlayFabCppBaseModel
@@ -389,6 +537,15 @@ namespace ExperimentationModels
             Type(src.Type)
             {}
 
+        FEntityKey(FEntityKey&& src) :
+            FPlayFabCppBaseModel(),
+            Id(MoveTemp(src.Id)),
+            Type(MoveTemp(src.Type))
+            {}
+
+        FEntityKey& operator=(const FEntityKey& src) = default;
+        FEntityKey& operator=(FEntityKey&& src) = default;
+
         FEntityKey(const TSharedPtr<FJsonObject>& obj) : FEntityKey()
         {
             readFromValue(obj);
@@ -397,7 +554,13 @@ namespace ExperimentationModels
         ~FEntityKey();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FExclusionGroupTrafficAllocation : public PlayFab::FPlayFabCppBaseModel
@@ -420,6 +583,15 @@ namespace ExperimentationModels
             TrafficAllocation(src.TrafficAllocation)
             {}
 
+        FExclusionGroupTrafficAllocation(FExclusionGroupTrafficAllocation&& src) :
+            FPlayFabCppBaseModel(),
+            ExperimentId(MoveTemp(src.ExperimentId)),
+            TrafficAllocation(MoveTemp(src.TrafficAllocation))
+            {}
+
+        FExclusionGroupTrafficAllocation& operator=(const FExclusionGroupTrafficAllocation& src) = default;
+        FExclusionGroupTrafficAllocation& operator=(FExclusionGroupTrafficAllocation&& src) = default;
+
         FExclusionGroupTrafficAllocation(const TSharedPtr<FJsonObject>& obj) : FExclusionGroupTrafficAllocation()
         {
             readFromValue(obj);
@@ -428,7 +600,13 @@ namespace ExperimentationModels
         ~FExclusionGroupTrafficAllocation();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum ExperimentState
@@ -440,6 +618,7 @@ namespace ExperimentationModels
     };
 
     PLAYFABCPP_API void writeExperimentStateEnumJSON(ExperimentState enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeExperimentStateEnumJSON(ExperimentState enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API ExperimentState readExperimentStateFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API ExperimentState readExperimentStateFromValue(const FString& value);
 
@@ -514,6 +693,25 @@ namespace ExperimentationModels
             Variants(src.Variants)
             {}
 
+        FExperiment(FExperiment&& src) :
+            FPlayFabCppBaseModel(),
+            Description(MoveTemp(src.Description)),
+            EndDate(MoveTemp(src.EndDate)),
+            ExclusionGroupId(MoveTemp(src.ExclusionGroupId)),
+            ExclusionGroupTrafficAllocation(MoveTemp(src.ExclusionGroupTrafficAllocation)),
+            pfExperimentType(MoveTemp(src.pfExperimentType)),
+            Id(MoveTemp(src.Id)),
+            Name(MoveTemp(src.Name)),
+            SegmentId(MoveTemp(src.SegmentId)),
+            StartDate(MoveTemp(src.StartDate)),
+            State(MoveTemp(src.State)),
+            TitlePlayerAccountTestIds(MoveTemp(src.TitlePlayerAccountTestIds)),
+            Variants(MoveTemp(src.Variants))
+            {}
+
+        FExperiment& operator=(const FExperiment& src) = default;
+        FExperiment& operator=(FExperiment&& src) = default;
+
         FExperiment(const TSharedPtr<FJsonObject>& obj) : FExperiment()
         {
             readFromValue(obj);
@@ -522,7 +720,13 @@ namespace ExperimentationModels
         ~FExperiment();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FExperimentExclusionGroup : public PlayFab::FPlayFabCppBaseModel
@@ -550,6 +754,16 @@ namespace ExperimentationModels
             Name(src.Name)
             {}
 
+        FExperimentExclusionGroup(FExperimentExclusionGroup&& src) :
+            FPlayFabCppBaseModel(),
+            Description(MoveTemp(src.Description)),
+            ExclusionGroupId(MoveTemp(src.ExclusionGroupId)),
+            Name(MoveTemp(src.Name))
+            {}
+
+        FExperimentExclusionGroup& operator=(const FExperimentExclusionGroup& src) = default;
+        FExperimentExclusionGroup& operator=(FExperimentExclusionGroup&& src) = default;
+
         FExperimentExclusionGroup(const TSharedPtr<FJsonObject>& obj) : FExperimentExclusionGroup()
         {
             readFromValue(obj);
@@ -558,7 +772,13 @@ namespace ExperimentationModels
         ~FExperimentExclusionGroup();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetExclusionGroupsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -575,6 +795,14 @@ namespace ExperimentationModels
             CustomTags(src.CustomTags)
             {}
 
+        FGetExclusionGroupsRequest(FGetExclusionGroupsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FGetExclusionGroupsRequest& operator=(const FGetExclusionGroupsRequest& src) = default;
+        FGetExclusionGroupsRequest& operator=(FGetExclusionGroupsRequest&& src) = default;
+
         FGetExclusionGroupsRequest(const TSharedPtr<FJsonObject>& obj) : FGetExclusionGroupsRequest()
         {
             readFromValue(obj);
@@ -583,7 +811,13 @@ namespace ExperimentationModels
         ~FGetExclusionGroupsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetExclusionGroupsResult : public PlayFab::FPlayFabCppResultCommon
@@ -600,6 +834,14 @@ namespace ExperimentationModels
             ExclusionGroups(src.ExclusionGroups)
             {}
 
+        FGetExclusionGroupsResult(FGetExclusionGroupsResult&& src) :
+            FPlayFabCppResultCommon(),
+            ExclusionGroups(MoveTemp(src.ExclusionGroups))
+            {}
+
+        FGetExclusionGroupsResult& operator=(const FGetExclusionGroupsResult& src) = default;
+        FGetExclusionGroupsResult& operator=(FGetExclusionGroupsResult&& src) = default;
+
         FGetExclusionGroupsResult(const TSharedPtr<FJsonObject>& obj) : FGetExclusionGroupsResult()
         {
             readFromValue(obj);
@@ -608,7 +850,13 @@ namespace ExperimentationModels
         ~FGetExclusionGroupsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetExclusionGroupTrafficRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -630,6 +878,15 @@ namespace ExperimentationModels
             ExclusionGroupId(src.ExclusionGroupId)
             {}
 
+        FGetExclusionGroupTrafficRequest(FGetExclusionGroupTrafficRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ExclusionGroupId(MoveTemp(src.ExclusionGroupId))
+            {}
+
+        FGetExclusionGroupTrafficRequest& operator=(const FGetExclusionGroupTrafficRequest& src) = default;
+        FGetExclusionGroupTrafficRequest& operator=(FGetExclusionGroupTrafficRequest&& src) = default;
+
         FGetExclusionGroupTrafficRequest(const TSharedPtr<FJsonObject>& obj) : FGetExclusionGroupTrafficRequest()
         {
             readFromValue(obj);
@@ -638,7 +895,13 @@ namespace ExperimentationModels
         ~FGetExclusionGroupTrafficRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetExclusionGroupTrafficResult : public PlayFab::FPlayFabCppResultCommon
@@ -655,6 +918,14 @@ namespace ExperimentationModels
             TrafficAllocations(src.TrafficAllocations)
             {}
 
+        FGetExclusionGroupTrafficResult(FGetExclusionGroupTrafficResult&& src) :
+            FPlayFabCppResultCommon(),
+            TrafficAllocations(MoveTemp(src.TrafficAllocations))
+            {}
+
+        FGetExclusionGroupTrafficResult& operator=(const FGetExclusionGroupTrafficResult& src) = default;
+        FGetExclusionGroupTrafficResult& operator=(FGetExclusionGroupTrafficResult&& src) = default;
+
         FGetExclusionGroupTrafficResult(const TSharedPtr<FJsonObject>& obj) : FGetExclusionGroupTrafficResult()
         {
             readFromValue(obj);
@@ -663,7 +934,13 @@ namespace ExperimentationModels
         ~FGetExclusionGroupTrafficResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetExperimentsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -680,6 +957,14 @@ namespace ExperimentationModels
             CustomTags(src.CustomTags)
             {}
 
+        FGetExperimentsRequest(FGetExperimentsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FGetExperimentsRequest& operator=(const FGetExperimentsRequest& src) = default;
+        FGetExperimentsRequest& operator=(FGetExperimentsRequest&& src) = default;
+
         FGetExperimentsRequest(const TSharedPtr<FJsonObject>& obj) : FGetExperimentsRequest()
         {
             readFromValue(obj);
@@ -688,7 +973,13 @@ namespace ExperimentationModels
         ~FGetExperimentsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetExperimentsResult : public PlayFab::FPlayFabCppResultCommon
@@ -705,6 +996,14 @@ namespace ExperimentationModels
             Experiments(src.Experiments)
             {}
 
+        FGetExperimentsResult(FGetExperimentsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Experiments(MoveTemp(src.Experiments))
+            {}
+
+        FGetExperimentsResult& operator=(const FGetExperimentsResult& src) = default;
+        FGetExperimentsResult& operator=(FGetExperimentsResult&& src) = default;
+
         FGetExperimentsResult(const TSharedPtr<FJsonObject>& obj) : FGetExperimentsResult()
         {
             readFromValue(obj);
@@ -713,7 +1012,13 @@ namespace ExperimentationModels
         ~FGetExperimentsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLatestScorecardRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -735,6 +1040,15 @@ namespace ExperimentationModels
             ExperimentId(src.ExperimentId)
             {}
 
+        FGetLatestScorecardRequest(FGetLatestScorecardRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ExperimentId(MoveTemp(src.ExperimentId))
+            {}
+
+        FGetLatestScorecardRequest& operator=(const FGetLatestScorecardRequest& src) = default;
+        FGetLatestScorecardRequest& operator=(FGetLatestScorecardRequest&& src) = default;
+
         FGetLatestScorecardRequest(const TSharedPtr<FJsonObject>& obj) : FGetLatestScorecardRequest()
         {
             readFromValue(obj);
@@ -743,7 +1057,13 @@ namespace ExperimentationModels
         ~FGetLatestScorecardRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMetricData : public PlayFab::FPlayFabCppBaseModel
@@ -821,6 +1141,26 @@ namespace ExperimentationModels
             Value(src.Value)
             {}
 
+        FMetricData(FMetricData&& src) :
+            FPlayFabCppBaseModel(),
+            ConfidenceIntervalEnd(MoveTemp(src.ConfidenceIntervalEnd)),
+            ConfidenceIntervalStart(MoveTemp(src.ConfidenceIntervalStart)),
+            DeltaAbsoluteChange(MoveTemp(src.DeltaAbsoluteChange)),
+            DeltaRelativeChange(MoveTemp(src.DeltaRelativeChange)),
+            InternalName(MoveTemp(src.InternalName)),
+            Movement(MoveTemp(src.Movement)),
+            Name(MoveTemp(src.Name)),
+            PMove(MoveTemp(src.PMove)),
+            PValue(MoveTemp(src.PValue)),
+            PValueThreshold(MoveTemp(src.PValueThreshold)),
+            StatSigLevel(MoveTemp(src.StatSigLevel)),
+            StdDev(MoveTemp(src.StdDev)),
+            Value(MoveTemp(src.Value))
+            {}
+
+        FMetricData& operator=(const FMetricData& src) = default;
+        FMetricData& operator=(FMetricData&& src) = default;
+
         FMetricData(const TSharedPtr<FJsonObject>& obj) : FMetricData()
         {
             readFromValue(obj);
@@ -829,7 +1169,13 @@ namespace ExperimentationModels
         ~FMetricData();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FScorecardDataRow : public PlayFab::FPlayFabCppBaseModel
@@ -861,6 +1207,17 @@ namespace ExperimentationModels
             VariantName(src.VariantName)
             {}
 
+        FScorecardDataRow(FScorecardDataRow&& src) :
+            FPlayFabCppBaseModel(),
+            IsControl(MoveTemp(src.IsControl)),
+            MetricDataRows(MoveTemp(src.MetricDataRows)),
+            PlayerCount(MoveTemp(src.PlayerCount)),
+            VariantName(MoveTemp(src.VariantName))
+            {}
+
+        FScorecardDataRow& operator=(const FScorecardDataRow& src) = default;
+        FScorecardDataRow& operator=(FScorecardDataRow&& src) = default;
+
         FScorecardDataRow(const TSharedPtr<FJsonObject>& obj) : FScorecardDataRow()
         {
             readFromValue(obj);
@@ -869,7 +1226,13 @@ namespace ExperimentationModels
         ~FScorecardDataRow();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FScorecard : public PlayFab::FPlayFabCppBaseModel
@@ -921,6 +1284,21 @@ namespace ExperimentationModels
             ScorecardDataRows(src.ScorecardDataRows)
             {}
 
+        FScorecard(FScorecard&& src) :
+            FPlayFabCppBaseModel(),
+            DateGenerated(MoveTemp(src.DateGenerated)),
+            Duration(MoveTemp(src.Duration)),
+            EventsProcessed(MoveTemp(src.EventsProcessed)),
+            ExperimentId(MoveTemp(src.ExperimentId)),
+            ExperimentName(MoveTemp(src.ExperimentName)),
+            LatestJobStatus(MoveTemp(src.LatestJobStatus)),
+            SampleRatioMismatch(MoveTemp(src.SampleRatioMismatch)),
+            ScorecardDataRows(MoveTemp(src.ScorecardDataRows))
+            {}
+
+        FScorecard& operator=(const FScorecard& src) = default;
+        FScorecard& operator=(FScorecard&& src) = default;
+
         FScorecard(const TSharedPtr<FJsonObject>& obj) : FScorecard()
         {
             readFromValue(obj);
@@ -929,7 +1307,13 @@ namespace ExperimentationModels
         ~FScorecard();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLatestScorecardResult : public PlayFab::FPlayFabCppResultCommon
@@ -944,9 +1328,17 @@ namespace ExperimentationModels
 
         FGetLatestScorecardResult(const FGetLatestScorecardResult& src) :
             FPlayFabCppResultCommon(),
-            pfScorecard(src.pfScorecard.IsValid() ? MakeShareable(new FScorecard(*src.pfScorecard)) : nullptr)
+            pfScorecard(src.pfScorecard.IsValid() ? TSharedPtr<FScorecard>(MakeShared<FScorecard>(*src.pfScorecard)) : nullptr)
             {}
 
+        FGetLatestScorecardResult(FGetLatestScorecardResult&& src) :
+            FPlayFabCppResultCommon(),
+            pfScorecard(MoveTemp(src.pfScorecard))
+            {}
+
+        FGetLatestScorecardResult& operator=(const FGetLatestScorecardResult& src) = default;
+        FGetLatestScorecardResult& operator=(FGetLatestScorecardResult&& src) = default;
+
         FGetLatestScorecardResult(const TSharedPtr<FJsonObject>& obj) : FGetLatestScorecardResult()
         {
             readFromValue(obj);
@@ -955,7 +1347,13 @@ namespace ExperimentationModels
         ~FGetLatestScorecardResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTreatmentAssignmentRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -974,9 +1372,18 @@ namespace ExperimentationModels
         FGetTreatmentAssignmentRequest(const FGetTreatmentAssignmentRequest& src) :
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr)
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr)
+            {}
+
+        FGetTreatmentAssignmentRequest(FGetTreatmentAssignmentRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity))
             {}
 
+        FGetTreatmentAssignmentRequest& operator=(const FGetTreatmentAssignmentRequest& src) = default;
+        FGetTreatmentAssignmentRequest& operator=(FGetTreatmentAssignmentRequest&& src) = default;
+
         FGetTreatmentAssignmentRequest(const TSharedPtr<FJsonObject>& obj) : FGetTreatmentAssignmentRequest()
         {
             readFromValue(obj);
@@ -985,7 +1392,13 @@ namespace ExperimentationModels
         ~FGetTreatmentAssignmentRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FTreatmentAssignment : public PlayFab::FPlayFabCppBaseModel
@@ -1006,6 +1419,15 @@ namespace ExperimentationModels
             Variants(src.Variants)
             {}
 
+        FTreatmentAssignment(FTreatmentAssignment&& src) :
+            FPlayFabCppBaseModel(),
+            Variables(MoveTemp(src.Variables)),
+            Variants(MoveTemp(src.Variants))
+            {}
+
+        FTreatmentAssignment& operator=(const FTreatmentAssignment& src) = default;
+        FTreatmentAssignment& operator=(FTreatmentAssignment&& src) = default;
+
         FTreatmentAssignment(const TSharedPtr<FJsonObject>& obj) : FTreatmentAssignment()
         {
             readFromValue(obj);
@@ -1014,7 +1436,13 @@ namespace ExperimentationModels
         ~FTreatmentAssignment();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTreatmentAssignmentResult : public PlayFab::FPlayFabCppResultCommon
@@ -1029,9 +1457,17 @@ namespace ExperimentationModels
 
         FGetTreatmentAssignmentResult(const FGetTreatmentAssignmentResult& src) :
             FPlayFabCppResultCommon(),
-            pfTreatmentAssignment(src.pfTreatmentAssignment.IsValid() ? MakeShareable(new FTreatmentAssignment(*src.pfTreatmentAssignment)) : nullptr)
+            pfTreatmentAssignment(src.pfTreatmentAssignment.IsValid() ? TSharedPtr<FTreatmentAssignment>(MakeShared<FTreatmentAssignment>(*src.pfTreatmentAssignment)) : nullptr)
             {}
 
+        FGetTreatmentAssignmentResult(FGetTreatmentAssignmentResult&& src) :
+            FPlayFabCppResultCommon(),
+            pfTreatmentAssignment(MoveTemp(src.pfTreatmentAssignment))
+            {}
+
+        FGetTreatmentAssignmentResult& operator=(const FGetTreatmentAssignmentResult& src) = default;
+        FGetTreatmentAssignmentResult& operator=(FGetTreatmentAssignmentResult&& src) = default;
+
         FGetTreatmentAssignmentResult(const TSharedPtr<FJsonObject>& obj) : FGetTreatmentAssignmentResult()
         {
             readFromValue(obj);
@@ -1040,7 +1476,13 @@ namespace ExperimentationModels
         ~FGetTreatmentAssignmentResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStartExperimentRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1062,6 +1504,15 @@ namespace ExperimentationModels
             ExperimentId(src.ExperimentId)
             {}
 
+        FStartExperimentRequest(FStartExperimentRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ExperimentId(MoveTemp(src.ExperimentId))
+            {}
+
+        FStartExperimentRequest& operator=(const FStartExperimentRequest& src) = default;
+        FStartExperimentRequest& operator=(FStartExperimentRequest&& src) = default;
+
         FStartExperimentRequest(const TSharedPtr<FJsonObject>& obj) : FStartExperimentRequest()
         {
             readFromValue(obj);
@@ -1070,7 +1521,13 @@ namespace ExperimentationModels
         ~FStartExperimentRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStopExperimentRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1092,6 +1549,15 @@ namespace ExperimentationModels
             ExperimentId(src.ExperimentId)
             {}
 
+        FStopExperimentRequest(FStopExperimentRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ExperimentId(MoveTemp(src.ExperimentId))
+            {}
+
+        FStopExperimentRequest& operator=(const FStopExperimentRequest& src) = default;
+        FStopExperimentRequest& operator=(FStopExperimentRequest&& src) = default;
+
         FStopExperimentRequest(const TSharedPtr<FJsonObject>& obj) : FStopExperimentRequest()
         {
             readFromValue(obj);
@@ -1100,7 +1566,13 @@ namespace ExperimentationModels
         ~FStopExperimentRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateExclusionGroupRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1132,6 +1604,17 @@ namespace ExperimentationModels
             Name(src.Name)
             {}
 
+        FUpdateExclusionGroupRequest(FUpdateExclusionGroupRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Description(MoveTemp(src.Description)),
+            ExclusionGroupId(MoveTemp(src.ExclusionGroupId)),
+            Name(MoveTemp(src.Name))
+            {}
+
+        FUpdateExclusionGroupRequest& operator=(const FUpdateExclusionGroupRequest& src) = default;
+        FUpdateExclusionGroupRequest& operator=(FUpdateExclusionGroupRequest&& src) = default;
+
         FUpdateExclusionGroupRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateExclusionGroupRequest()
         {
             readFromValue(obj);
@@ -1140,7 +1623,13 @@ namespace ExperimentationModels
         ~FUpdateExclusionGroupRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateExperimentRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1213,6 +1702,25 @@ namespace ExperimentationModels
             Variants(src.Variants)
             {}
 
+        FUpdateExperimentRequest(FUpdateExperimentRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Description(MoveTemp(src.Description)),
+            EndDate(MoveTemp(src.EndDate)),
+            ExclusionGroupId(MoveTemp(src.ExclusionGroupId)),
+            ExclusionGroupTrafficAllocation(MoveTemp(src.ExclusionGroupTrafficAllocation)),
+            pfExperimentType(MoveTemp(src.pfExperimentType)),
+            Id(MoveTemp(src.Id)),
+            Name(MoveTemp(src.Name)),
+            SegmentId(MoveTemp(src.SegmentId)),
+            StartDate(MoveTemp(src.StartDate)),
+            TitlePlayerAccountTestIds(MoveTemp(src.TitlePlayerAccountTestIds)),
+            Variants(MoveTemp(src.Variants))
+            {}
+
+        FUpdateExperimentRequest& operator=(const FUpdateExperimentRequest& src) = default;
+        FUpdateExperimentRequest& operator=(FUpdateExperimentRequest&& src) = default;
+
         FUpdateExperimentRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateExperimentRequest()
         {
             readFromValue(obj);
@@ -1221,7 +1729,13 @@ namespace ExperimentationModels
         ~FUpdateExperimentRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
 }
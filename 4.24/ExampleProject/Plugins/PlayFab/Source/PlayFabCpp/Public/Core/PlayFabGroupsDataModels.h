@@ -34,6 +34,15 @@ namespace GroupsModels
             Type(src.Type)
             {}
 
+        FEntityKey(FEntityKey&& src) :
+            FPlayFabCppBaseModel(),
+            Id(MoveTemp(src.Id)),
+            Type(MoveTemp(src.Type))
+            {}
+
+        FEntityKey& operator=(const FEntityKey& src) = default;
+        FEntityKey& operator=(FEntityKey&& src) = default;
+
         FEntityKey(const TSharedPtr<FJsonObject>& obj) : FEntityKey()
         {
             readFromValue(obj);
@@ -42,7 +51,13 @@ namespace GroupsModels
         ~FEntityKey();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAcceptGroupApplicationRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -72,6 +87,16 @@ namespace GroupsModels
             Group(src.Group)
             {}
 
+        FAcceptGroupApplicationRequest(FAcceptGroupApplicationRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            Group(MoveTemp(src.Group))
+            {}
+
+        FAcceptGroupApplicationRequest& operator=(const FAcceptGroupApplicationRequest& src) = default;
+        FAcceptGroupApplicationRequest& operator=(FAcceptGroupApplicationRequest&& src) = default;
+
         FAcceptGroupApplicationRequest(const TSharedPtr<FJsonObject>& obj) : FAcceptGroupApplicationRequest()
         {
             readFromValue(obj);
@@ -80,7 +105,13 @@ namespace GroupsModels
         ~FAcceptGroupApplicationRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAcceptGroupInvitationRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -103,10 +134,20 @@ namespace GroupsModels
         FAcceptGroupInvitationRequest(const FAcceptGroupInvitationRequest& src) :
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             Group(src.Group)
             {}
 
+        FAcceptGroupInvitationRequest(FAcceptGroupInvitationRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            Group(MoveTemp(src.Group))
+            {}
+
+        FAcceptGroupInvitationRequest& operator=(const FAcceptGroupInvitationRequest& src) = default;
+        FAcceptGroupInvitationRequest& operator=(FAcceptGroupInvitationRequest&& src) = default;
+
         FAcceptGroupInvitationRequest(const TSharedPtr<FJsonObject>& obj) : FAcceptGroupInvitationRequest()
         {
             readFromValue(obj);
@@ -115,7 +156,13 @@ namespace GroupsModels
         ~FAcceptGroupInvitationRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddMembersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -149,6 +196,17 @@ namespace GroupsModels
             RoleId(src.RoleId)
             {}
 
+        FAddMembersRequest(FAddMembersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Group(MoveTemp(src.Group)),
+            Members(MoveTemp(src.Members)),
+            RoleId(MoveTemp(src.RoleId))
+            {}
+
+        FAddMembersRequest& operator=(const FAddMembersRequest& src) = default;
+        FAddMembersRequest& operator=(FAddMembersRequest&& src) = default;
+
         FAddMembersRequest(const TSharedPtr<FJsonObject>& obj) : FAddMembersRequest()
         {
             readFromValue(obj);
@@ -157,7 +215,13 @@ namespace GroupsModels
         ~FAddMembersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FApplyToGroupRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -185,10 +249,21 @@ namespace GroupsModels
             FPlayFabCppRequestCommon(),
             AutoAcceptOutstandingInvite(src.AutoAcceptOutstandingInvite),
             CustomTags(src.CustomTags),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             Group(src.Group)
             {}
 
+        FApplyToGroupRequest(FApplyToGroupRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AutoAcceptOutstandingInvite(MoveTemp(src.AutoAcceptOutstandingInvite)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            Group(MoveTemp(src.Group))
+            {}
+
+        FApplyToGroupRequest& operator=(const FApplyToGroupRequest& src) = default;
+        FApplyToGroupRequest& operator=(FApplyToGroupRequest&& src) = default;
+
         FApplyToGroupRequest(const TSharedPtr<FJsonObject>& obj) : FApplyToGroupRequest()
         {
             readFromValue(obj);
@@ -197,7 +272,13 @@ namespace GroupsModels
         ~FApplyToGroupRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityWithLineage : public PlayFab::FPlayFabCppBaseModel
@@ -215,10 +296,19 @@ namespace GroupsModels
 
         FEntityWithLineage(const FEntityWithLineage& src) :
             FPlayFabCppBaseModel(),
-            Key(src.Key.IsValid() ? MakeShareable(new FEntityKey(*src.Key)) : nullptr),
+            Key(src.Key.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Key)) : nullptr),
             Lineage(src.Lineage)
             {}
 
+        FEntityWithLineage(FEntityWithLineage&& src) :
+            FPlayFabCppBaseModel(),
+            Key(MoveTemp(src.Key)),
+            Lineage(MoveTemp(src.Lineage))
+            {}
+
+        FEntityWithLineage& operator=(const FEntityWithLineage& src) = default;
+        FEntityWithLineage& operator=(FEntityWithLineage&& src) = default;
+
         FEntityWithLineage(const TSharedPtr<FJsonObject>& obj) : FEntityWithLineage()
         {
             readFromValue(obj);
@@ -227,7 +317,13 @@ namespace GroupsModels
         ~FEntityWithLineage();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FApplyToGroupResponse : public PlayFab::FPlayFabCppResultCommon
@@ -250,11 +346,21 @@ namespace GroupsModels
 
         FApplyToGroupResponse(const FApplyToGroupResponse& src) :
             FPlayFabCppResultCommon(),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityWithLineage(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityWithLineage>(MakeShared<FEntityWithLineage>(*src.Entity)) : nullptr),
             Expires(src.Expires),
-            Group(src.Group.IsValid() ? MakeShareable(new FEntityKey(*src.Group)) : nullptr)
+            Group(src.Group.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Group)) : nullptr)
             {}
 
+        FApplyToGroupResponse(FApplyToGroupResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Entity(MoveTemp(src.Entity)),
+            Expires(MoveTemp(src.Expires)),
+            Group(MoveTemp(src.Group))
+            {}
+
+        FApplyToGroupResponse& operator=(const FApplyToGroupResponse& src) = default;
+        FApplyToGroupResponse& operator=(FApplyToGroupResponse&& src) = default;
+
         FApplyToGroupResponse(const TSharedPtr<FJsonObject>& obj) : FApplyToGroupResponse()
         {
             readFromValue(obj);
@@ -263,7 +369,13 @@ namespace GroupsModels
         ~FApplyToGroupResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FBlockEntityRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -290,6 +402,16 @@ namespace GroupsModels
             Group(src.Group)
             {}
 
+        FBlockEntityRequest(FBlockEntityRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            Group(MoveTemp(src.Group))
+            {}
+
+        FBlockEntityRequest& operator=(const FBlockEntityRequest& src) = default;
+        FBlockEntityRequest& operator=(FBlockEntityRequest&& src) = default;
+
         FBlockEntityRequest(const TSharedPtr<FJsonObject>& obj) : FBlockEntityRequest()
         {
             readFromValue(obj);
@@ -298,7 +420,13 @@ namespace GroupsModels
         ~FBlockEntityRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FChangeMemberRoleRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -340,6 +468,18 @@ namespace GroupsModels
             OriginRoleId(src.OriginRoleId)
             {}
 
+        FChangeMemberRoleRequest(FChangeMemberRoleRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DestinationRoleId(MoveTemp(src.DestinationRoleId)),
+            Group(MoveTemp(src.Group)),
+            Members(MoveTemp(src.Members)),
+            OriginRoleId(MoveTemp(src.OriginRoleId))
+            {}
+
+        FChangeMemberRoleRequest& operator=(const FChangeMemberRoleRequest& src) = default;
+        FChangeMemberRoleRequest& operator=(FChangeMemberRoleRequest&& src) = default;
+
         FChangeMemberRoleRequest(const TSharedPtr<FJsonObject>& obj) : FChangeMemberRoleRequest()
         {
             readFromValue(obj);
@@ -348,7 +488,13 @@ namespace GroupsModels
         ~FChangeMemberRoleRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateGroupRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -371,10 +517,20 @@ namespace GroupsModels
         FCreateGroupRequest(const FCreateGroupRequest& src) :
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             GroupName(src.GroupName)
             {}
 
+        FCreateGroupRequest(FCreateGroupRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            GroupName(MoveTemp(src.GroupName))
+            {}
+
+        FCreateGroupRequest& operator=(const FCreateGroupRequest& src) = default;
+        FCreateGroupRequest& operator=(FCreateGroupRequest&& src) = default;
+
         FCreateGroupRequest(const TSharedPtr<FJsonObject>& obj) : FCreateGroupRequest()
         {
             readFromValue(obj);
@@ -383,7 +539,13 @@ namespace GroupsModels
         ~FCreateGroupRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateGroupResponse : public PlayFab::FPlayFabCppResultCommon
@@ -430,6 +592,20 @@ namespace GroupsModels
             Roles(src.Roles)
             {}
 
+        FCreateGroupResponse(FCreateGroupResponse&& src) :
+            FPlayFabCppResultCommon(),
+            AdminRoleId(MoveTemp(src.AdminRoleId)),
+            Created(MoveTemp(src.Created)),
+            Group(MoveTemp(src.Group)),
+            GroupName(MoveTemp(src.GroupName)),
+            MemberRoleId(MoveTemp(src.MemberRoleId)),
+            ProfileVersion(MoveTemp(src.ProfileVersion)),
+            Roles(MoveTemp(src.Roles))
+            {}
+
+        FCreateGroupResponse& operator=(const FCreateGroupResponse& src) = default;
+        FCreateGroupResponse& operator=(FCreateGroupResponse&& src) = default;
+
         FCreateGroupResponse(const TSharedPtr<FJsonObject>& obj) : FCreateGroupResponse()
         {
             readFromValue(obj);
@@ -438,7 +614,13 @@ namespace GroupsModels
         ~FCreateGroupResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateGroupRoleRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -476,6 +658,17 @@ namespace GroupsModels
             RoleName(src.RoleName)
             {}
 
+        FCreateGroupRoleRequest(FCreateGroupRoleRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Group(MoveTemp(src.Group)),
+            RoleId(MoveTemp(src.RoleId)),
+            RoleName(MoveTemp(src.RoleName))
+            {}
+
+        FCreateGroupRoleRequest& operator=(const FCreateGroupRoleRequest& src) = default;
+        FCreateGroupRoleRequest& operator=(FCreateGroupRoleRequest&& src) = default;
+
         FCreateGroupRoleRequest(const TSharedPtr<FJsonObject>& obj) : FCreateGroupRoleRequest()
         {
             readFromValue(obj);
@@ -484,7 +677,13 @@ namespace GroupsModels
         ~FCreateGroupRoleRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateGroupRoleResponse : public PlayFab::FPlayFabCppResultCommon
@@ -512,6 +711,16 @@ namespace GroupsModels
             RoleName(src.RoleName)
             {}
 
+        FCreateGroupRoleResponse(FCreateGroupRoleResponse&& src) :
+            FPlayFabCppResultCommon(),
+            ProfileVersion(MoveTemp(src.ProfileVersion)),
+            RoleId(MoveTemp(src.RoleId)),
+            RoleName(MoveTemp(src.RoleName))
+            {}
+
+        FCreateGroupRoleResponse& operator=(const FCreateGroupRoleResponse& src) = default;
+        FCreateGroupRoleResponse& operator=(FCreateGroupRoleResponse&& src) = default;
+
         FCreateGroupRoleResponse(const TSharedPtr<FJsonObject>& obj) : FCreateGroupRoleResponse()
         {
             readFromValue(obj);
@@ -520,7 +729,13 @@ namespace GroupsModels
         ~FCreateGroupRoleResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteGroupRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -542,6 +757,15 @@ namespace GroupsModels
             Group(src.Group)
             {}
 
+        FDeleteGroupRequest(FDeleteGroupRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Group(MoveTemp(src.Group))
+            {}
+
+        FDeleteGroupRequest& operator=(const FDeleteGroupRequest& src) = default;
+        FDeleteGroupRequest& operator=(FDeleteGroupRequest&& src) = default;
+
         FDeleteGroupRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteGroupRequest()
         {
             readFromValue(obj);
@@ -550,7 +774,13 @@ namespace GroupsModels
         ~FDeleteGroupRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteRoleRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -577,6 +807,16 @@ namespace GroupsModels
             RoleId(src.RoleId)
             {}
 
+        FDeleteRoleRequest(FDeleteRoleRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Group(MoveTemp(src.Group)),
+            RoleId(MoveTemp(src.RoleId))
+            {}
+
+        FDeleteRoleRequest& operator=(const FDeleteRoleRequest& src) = default;
+        FDeleteRoleRequest& operator=(FDeleteRoleRequest&& src) = default;
+
         FDeleteRoleRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteRoleRequest()
         {
             readFromValue(obj);
@@ -585,7 +825,13 @@ namespace GroupsModels
         ~FDeleteRoleRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEmptyResponse : public PlayFab::FPlayFabCppResultCommon
@@ -598,6 +844,13 @@ namespace GroupsModels
             FPlayFabCppResultCommon()
             {}
 
+        FEmptyResponse(FEmptyResponse&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FEmptyResponse& operator=(const FEmptyResponse& src) = default;
+        FEmptyResponse& operator=(FEmptyResponse&& src) = default;
+
         FEmptyResponse(const TSharedPtr<FJsonObject>& obj) : FEmptyResponse()
         {
             readFromValue(obj);
@@ -606,7 +859,13 @@ namespace GroupsModels
         ~FEmptyResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityMemberRole : public PlayFab::FPlayFabCppBaseModel
@@ -633,6 +892,16 @@ namespace GroupsModels
             RoleName(src.RoleName)
             {}
 
+        FEntityMemberRole(FEntityMemberRole&& src) :
+            FPlayFabCppBaseModel(),
+            Members(MoveTemp(src.Members)),
+            RoleId(MoveTemp(src.RoleId)),
+            RoleName(MoveTemp(src.RoleName))
+            {}
+
+        FEntityMemberRole& operator=(const FEntityMemberRole& src) = default;
+        FEntityMemberRole& operator=(FEntityMemberRole&& src) = default;
+
         FEntityMemberRole(const TSharedPtr<FJsonObject>& obj) : FEntityMemberRole()
         {
             readFromValue(obj);
@@ -641,7 +910,13 @@ namespace GroupsModels
         ~FEntityMemberRole();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetGroupRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -664,10 +939,20 @@ namespace GroupsModels
         FGetGroupRequest(const FGetGroupRequest& src) :
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
-            Group(src.Group.IsValid() ? MakeShareable(new FEntityKey(*src.Group)) : nullptr),
+            Group(src.Group.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Group)) : nullptr),
             GroupName(src.GroupName)
             {}
 
+        FGetGroupRequest(FGetGroupRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Group(MoveTemp(src.Group)),
+            GroupName(MoveTemp(src.GroupName))
+            {}
+
+        FGetGroupRequest& operator=(const FGetGroupRequest& src) = default;
+        FGetGroupRequest& operator=(FGetGroupRequest&& src) = default;
+
         FGetGroupRequest(const TSharedPtr<FJsonObject>& obj) : FGetGroupRequest()
         {
             readFromValue(obj);
@@ -676,7 +961,13 @@ namespace GroupsModels
         ~FGetGroupRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetGroupResponse : public PlayFab::FPlayFabCppResultCommon
@@ -723,6 +1014,20 @@ namespace GroupsModels
             Roles(src.Roles)
             {}
 
+        FGetGroupResponse(FGetGroupResponse&& src) :
+            FPlayFabCppResultCommon(),
+            AdminRoleId(MoveTemp(src.AdminRoleId)),
+            Created(MoveTemp(src.Created)),
+            Group(MoveTemp(src.Group)),
+            GroupName(MoveTemp(src.GroupName)),
+            MemberRoleId(MoveTemp(src.MemberRoleId)),
+            ProfileVersion(MoveTemp(src.ProfileVersion)),
+            Roles(MoveTemp(src.Roles))
+            {}
+
+        FGetGroupResponse& operator=(const FGetGroupResponse& src) = default;
+        FGetGroupResponse& operator=(FGetGroupResponse&& src) = default;
+
         FGetGroupResponse(const TSharedPtr<FJsonObject>& obj) : FGetGroupResponse()
         {
             readFromValue(obj);
@@ -731,7 +1036,13 @@ namespace GroupsModels
         ~FGetGroupResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGroupApplication : public PlayFab::FPlayFabCppBaseModel
@@ -754,11 +1065,21 @@ namespace GroupsModels
 
         FGroupApplication(const FGroupApplication& src) :
             FPlayFabCppBaseModel(),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityWithLineage(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityWithLineage>(MakeShared<FEntityWithLineage>(*src.Entity)) : nullptr),
             Expires(src.Expires),
-            Group(src.Group.IsValid() ? MakeShareable(new FEntityKey(*src.Group)) : nullptr)
+            Group(src.Group.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Group)) : nullptr)
+            {}
+
+        FGroupApplication(FGroupApplication&& src) :
+            FPlayFabCppBaseModel(),
+            Entity(MoveTemp(src.Entity)),
+            Expires(MoveTemp(src.Expires)),
+            Group(MoveTemp(src.Group))
             {}
 
+        FGroupApplication& operator=(const FGroupApplication& src) = default;
+        FGroupApplication& operator=(FGroupApplication&& src) = default;
+
         FGroupApplication(const TSharedPtr<FJsonObject>& obj) : FGroupApplication()
         {
             readFromValue(obj);
@@ -767,7 +1088,13 @@ namespace GroupsModels
         ~FGroupApplication();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGroupBlock : public PlayFab::FPlayFabCppBaseModel
@@ -786,10 +1113,19 @@ namespace GroupsModels
 
         FGroupBlock(const FGroupBlock& src) :
             FPlayFabCppBaseModel(),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityWithLineage(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityWithLineage>(MakeShared<FEntityWithLineage>(*src.Entity)) : nullptr),
             Group(src.Group)
             {}
 
+        FGroupBlock(FGroupBlock&& src) :
+            FPlayFabCppBaseModel(),
+            Entity(MoveTemp(src.Entity)),
+            Group(MoveTemp(src.Group))
+            {}
+
+        FGroupBlock& operator=(const FGroupBlock& src) = default;
+        FGroupBlock& operator=(FGroupBlock&& src) = default;
+
         FGroupBlock(const TSharedPtr<FJsonObject>& obj) : FGroupBlock()
         {
             readFromValue(obj);
@@ -798,7 +1134,13 @@ namespace GroupsModels
         ~FGroupBlock();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGroupInvitation : public PlayFab::FPlayFabCppBaseModel
@@ -830,12 +1172,24 @@ namespace GroupsModels
         FGroupInvitation(const FGroupInvitation& src) :
             FPlayFabCppBaseModel(),
             Expires(src.Expires),
-            Group(src.Group.IsValid() ? MakeShareable(new FEntityKey(*src.Group)) : nullptr),
-            InvitedByEntity(src.InvitedByEntity.IsValid() ? MakeShareable(new FEntityWithLineage(*src.InvitedByEntity)) : nullptr),
-            InvitedEntity(src.InvitedEntity.IsValid() ? MakeShareable(new FEntityWithLineage(*src.InvitedEntity)) : nullptr),
+            Group(src.Group.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Group)) : nullptr),
+            InvitedByEntity(src.InvitedByEntity.IsValid() ? TSharedPtr<FEntityWithLineage>(MakeShared<FEntityWithLineage>(*src.InvitedByEntity)) : nullptr),
+            InvitedEntity(src.InvitedEntity.IsValid() ? TSharedPtr<FEntityWithLineage>(MakeShared<FEntityWithLineage>(*src.InvitedEntity)) : nullptr),
             RoleId(src.RoleId)
             {}
 
+        FGroupInvitation(FGroupInvitation&& src) :
+            FPlayFabCppBaseModel(),
+            Expires(MoveTemp(src.Expires)),
+            Group(MoveTemp(src.Group)),
+            InvitedByEntity(MoveTemp(src.InvitedByEntity)),
+            InvitedEntity(MoveTemp(src.InvitedEntity)),
+            RoleId(MoveTemp(src.RoleId))
+            {}
+
+        FGroupInvitation& operator=(const FGroupInvitation& src) = default;
+        FGroupInvitation& operator=(FGroupInvitation&& src) = default;
+
         FGroupInvitation(const TSharedPtr<FJsonObject>& obj) : FGroupInvitation()
         {
             readFromValue(obj);
@@ -844,7 +1198,13 @@ namespace GroupsModels
         ~FGroupInvitation();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGroupRole : public PlayFab::FPlayFabCppBaseModel
@@ -867,6 +1227,15 @@ namespace GroupsModels
             RoleName(src.RoleName)
             {}
 
+        FGroupRole(FGroupRole&& src) :
+            FPlayFabCppBaseModel(),
+            RoleId(MoveTemp(src.RoleId)),
+            RoleName(MoveTemp(src.RoleName))
+            {}
+
+        FGroupRole& operator=(const FGroupRole& src) = default;
+        FGroupRole& operator=(FGroupRole&& src) = default;
+
         FGroupRole(const TSharedPtr<FJsonObject>& obj) : FGroupRole()
         {
             readFromValue(obj);
@@ -875,7 +1244,13 @@ namespace GroupsModels
         ~FGroupRole();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGroupWithRoles : public PlayFab::FPlayFabCppBaseModel
@@ -901,12 +1276,23 @@ namespace GroupsModels
 
         FGroupWithRoles(const FGroupWithRoles& src) :
             FPlayFabCppBaseModel(),
-            Group(src.Group.IsValid() ? MakeShareable(new FEntityKey(*src.Group)) : nullptr),
+            Group(src.Group.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Group)) : nullptr),
             GroupName(src.GroupName),
             ProfileVersion(src.ProfileVersion),
             Roles(src.Roles)
             {}
 
+        FGroupWithRoles(FGroupWithRoles&& src) :
+            FPlayFabCppBaseModel(),
+            Group(MoveTemp(src.Group)),
+            GroupName(MoveTemp(src.GroupName)),
+            ProfileVersion(MoveTemp(src.ProfileVersion)),
+            Roles(MoveTemp(src.Roles))
+            {}
+
+        FGroupWithRoles& operator=(const FGroupWithRoles& src) = default;
+        FGroupWithRoles& operator=(FGroupWithRoles&& src) = default;
+
         FGroupWithRoles(const TSharedPtr<FJsonObject>& obj) : FGroupWithRoles()
         {
             readFromValue(obj);
@@ -915,7 +1301,13 @@ namespace GroupsModels
         ~FGroupWithRoles();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FInviteToGroupRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -955,6 +1347,18 @@ namespace GroupsModels
             RoleId(src.RoleId)
             {}
 
+        FInviteToGroupRequest(FInviteToGroupRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AutoAcceptOutstandingApplication(MoveTemp(src.AutoAcceptOutstandingApplication)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            Group(MoveTemp(src.Group)),
+            RoleId(MoveTemp(src.RoleId))
+            {}
+
+        FInviteToGroupRequest& operator=(const FInviteToGroupRequest& src) = default;
+        FInviteToGroupRequest& operator=(FInviteToGroupRequest&& src) = default;
+
         FInviteToGroupRequest(const TSharedPtr<FJsonObject>& obj) : FInviteToGroupRequest()
         {
             readFromValue(obj);
@@ -963,7 +1367,13 @@ namespace GroupsModels
         ~FInviteToGroupRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FInviteToGroupResponse : public PlayFab::FPlayFabCppResultCommon
@@ -995,12 +1405,24 @@ namespace GroupsModels
         FInviteToGroupResponse(const FInviteToGroupResponse& src) :
             FPlayFabCppResultCommon(),
             Expires(src.Expires),
-            Group(src.Group.IsValid() ? MakeShareable(new FEntityKey(*src.Group)) : nullptr),
-            InvitedByEntity(src.InvitedByEntity.IsValid() ? MakeShareable(new FEntityWithLineage(*src.InvitedByEntity)) : nullptr),
-            InvitedEntity(src.InvitedEntity.IsValid() ? MakeShareable(new FEntityWithLineage(*src.InvitedEntity)) : nullptr),
+            Group(src.Group.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Group)) : nullptr),
+            InvitedByEntity(src.InvitedByEntity.IsValid() ? TSharedPtr<FEntityWithLineage>(MakeShared<FEntityWithLineage>(*src.InvitedByEntity)) : nullptr),
+            InvitedEntity(src.InvitedEntity.IsValid() ? TSharedPtr<FEntityWithLineage>(MakeShared<FEntityWithLineage>(*src.InvitedEntity)) : nullptr),
             RoleId(src.RoleId)
             {}
 
+        FInviteToGroupResponse(FInviteToGroupResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Expires(MoveTemp(src.Expires)),
+            Group(MoveTemp(src.Group)),
+            InvitedByEntity(MoveTemp(src.InvitedByEntity)),
+            InvitedEntity(MoveTemp(src.InvitedEntity)),
+            RoleId(MoveTemp(src.RoleId))
+            {}
+
+        FInviteToGroupResponse& operator=(const FInviteToGroupResponse& src) = default;
+        FInviteToGroupResponse& operator=(FInviteToGroupResponse&& src) = default;
+
         FInviteToGroupResponse(const TSharedPtr<FJsonObject>& obj) : FInviteToGroupResponse()
         {
             readFromValue(obj);
@@ -1009,7 +1431,13 @@ namespace GroupsModels
         ~FInviteToGroupResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FIsMemberRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1044,6 +1472,17 @@ namespace GroupsModels
             RoleId(src.RoleId)
             {}
 
+        FIsMemberRequest(FIsMemberRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            Group(MoveTemp(src.Group)),
+            RoleId(MoveTemp(src.RoleId))
+            {}
+
+        FIsMemberRequest& operator=(const FIsMemberRequest& src) = default;
+        FIsMemberRequest& operator=(FIsMemberRequest&& src) = default;
+
         FIsMemberRequest(const TSharedPtr<FJsonObject>& obj) : FIsMemberRequest()
         {
             readFromValue(obj);
@@ -1052,7 +1491,13 @@ namespace GroupsModels
         ~FIsMemberRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FIsMemberResponse : public PlayFab::FPlayFabCppResultCommon
@@ -1070,6 +1515,14 @@ namespace GroupsModels
             IsMember(src.IsMember)
             {}
 
+        FIsMemberResponse(FIsMemberResponse&& src) :
+            FPlayFabCppResultCommon(),
+            IsMember(MoveTemp(src.IsMember))
+            {}
+
+        FIsMemberResponse& operator=(const FIsMemberResponse& src) = default;
+        FIsMemberResponse& operator=(FIsMemberResponse&& src) = default;
+
         FIsMemberResponse(const TSharedPtr<FJsonObject>& obj) : FIsMemberResponse()
         {
             readFromValue(obj);
@@ -1078,7 +1531,13 @@ namespace GroupsModels
         ~FIsMemberResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListGroupApplicationsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1100,6 +1559,15 @@ namespace GroupsModels
             Group(src.Group)
             {}
 
+        FListGroupApplicationsRequest(FListGroupApplicationsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Group(MoveTemp(src.Group))
+            {}
+
+        FListGroupApplicationsRequest& operator=(const FListGroupApplicationsRequest& src) = default;
+        FListGroupApplicationsRequest& operator=(FListGroupApplicationsRequest&& src) = default;
+
         FListGroupApplicationsRequest(const TSharedPtr<FJsonObject>& obj) : FListGroupApplicationsRequest()
         {
             readFromValue(obj);
@@ -1108,7 +1576,13 @@ namespace GroupsModels
         ~FListGroupApplicationsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListGroupApplicationsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -1125,6 +1599,14 @@ namespace GroupsModels
             Applications(src.Applications)
             {}
 
+        FListGroupApplicationsResponse(FListGroupApplicationsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Applications(MoveTemp(src.Applications))
+            {}
+
+        FListGroupApplicationsResponse& operator=(const FListGroupApplicationsResponse& src) = default;
+        FListGroupApplicationsResponse& operator=(FListGroupApplicationsResponse&& src) = default;
+
         FListGroupApplicationsResponse(const TSharedPtr<FJsonObject>& obj) : FListGroupApplicationsResponse()
         {
             readFromValue(obj);
@@ -1133,7 +1615,13 @@ namespace GroupsModels
         ~FListGroupApplicationsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListGroupBlocksRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1155,6 +1643,15 @@ namespace GroupsModels
             Group(src.Group)
             {}
 
+        FListGroupBlocksRequest(FListGroupBlocksRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Group(MoveTemp(src.Group))
+            {}
+
+        FListGroupBlocksRequest& operator=(const FListGroupBlocksRequest& src) = default;
+        FListGroupBlocksRequest& operator=(FListGroupBlocksRequest&& src) = default;
+
         FListGroupBlocksRequest(const TSharedPtr<FJsonObject>& obj) : FListGroupBlocksRequest()
         {
             readFromValue(obj);
@@ -1163,7 +1660,13 @@ namespace GroupsModels
         ~FListGroupBlocksRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListGroupBlocksResponse : public PlayFab::FPlayFabCppResultCommon
@@ -1180,6 +1683,14 @@ namespace GroupsModels
             BlockedEntities(src.BlockedEntities)
             {}
 
+        FListGroupBlocksResponse(FListGroupBlocksResponse&& src) :
+            FPlayFabCppResultCommon(),
+            BlockedEntities(MoveTemp(src.BlockedEntities))
+            {}
+
+        FListGroupBlocksResponse& operator=(const FListGroupBlocksResponse& src) = default;
+        FListGroupBlocksResponse& operator=(FListGroupBlocksResponse&& src) = default;
+
         FListGroupBlocksResponse(const TSharedPtr<FJsonObject>& obj) : FListGroupBlocksResponse()
         {
             readFromValue(obj);
@@ -1188,7 +1699,13 @@ namespace GroupsModels
         ~FListGroupBlocksResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListGroupInvitationsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1210,6 +1727,15 @@ namespace GroupsModels
             Group(src.Group)
             {}
 
+        FListGroupInvitationsRequest(FListGroupInvitationsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Group(MoveTemp(src.Group))
+            {}
+
+        FListGroupInvitationsRequest& operator=(const FListGroupInvitationsRequest& src) = default;
+        FListGroupInvitationsRequest& operator=(FListGroupInvitationsRequest&& src) = default;
+
         FListGroupInvitationsRequest(const TSharedPtr<FJsonObject>& obj) : FListGroupInvitationsRequest()
         {
             readFromValue(obj);
@@ -1218,7 +1744,13 @@ namespace GroupsModels
         ~FListGroupInvitationsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListGroupInvitationsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -1235,6 +1767,14 @@ namespace GroupsModels
             Invitations(src.Invitations)
             {}
 
+        FListGroupInvitationsResponse(FListGroupInvitationsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Invitations(MoveTemp(src.Invitations))
+            {}
+
+        FListGroupInvitationsResponse& operator=(const FListGroupInvitationsResponse& src) = default;
+        FListGroupInvitationsResponse& operator=(FListGroupInvitationsResponse&& src) = default;
+
         FListGroupInvitationsResponse(const TSharedPtr<FJsonObject>& obj) : FListGroupInvitationsResponse()
         {
             readFromValue(obj);
@@ -1243,7 +1783,13 @@ namespace GroupsModels
         ~FListGroupInvitationsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListGroupMembersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1265,6 +1811,15 @@ namespace GroupsModels
             Group(src.Group)
             {}
 
+        FListGroupMembersRequest(FListGroupMembersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Group(MoveTemp(src.Group))
+            {}
+
+        FListGroupMembersRequest& operator=(const FListGroupMembersRequest& src) = default;
+        FListGroupMembersRequest& operator=(FListGroupMembersRequest&& src) = default;
+
         FListGroupMembersRequest(const TSharedPtr<FJsonObject>& obj) : FListGroupMembersRequest()
         {
             readFromValue(obj);
@@ -1273,7 +1828,13 @@ namespace GroupsModels
         ~FListGroupMembersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListGroupMembersResponse : public PlayFab::FPlayFabCppResultCommon
@@ -1290,6 +1851,14 @@ namespace GroupsModels
             Members(src.Members)
             {}
 
+        FListGroupMembersResponse(FListGroupMembersResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Members(MoveTemp(src.Members))
+            {}
+
+        FListGroupMembersResponse& operator=(const FListGroupMembersResponse& src) = default;
+        FListGroupMembersResponse& operator=(FListGroupMembersResponse&& src) = default;
+
         FListGroupMembersResponse(const TSharedPtr<FJsonObject>& obj) : FListGroupMembersResponse()
         {
             readFromValue(obj);
@@ -1298,7 +1867,13 @@ namespace GroupsModels
         ~FListGroupMembersResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListMembershipOpportunitiesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1317,9 +1892,18 @@ namespace GroupsModels
         FListMembershipOpportunitiesRequest(const FListMembershipOpportunitiesRequest& src) :
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr)
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr)
             {}
 
+        FListMembershipOpportunitiesRequest(FListMembershipOpportunitiesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity))
+            {}
+
+        FListMembershipOpportunitiesRequest& operator=(const FListMembershipOpportunitiesRequest& src) = default;
+        FListMembershipOpportunitiesRequest& operator=(FListMembershipOpportunitiesRequest&& src) = default;
+
         FListMembershipOpportunitiesRequest(const TSharedPtr<FJsonObject>& obj) : FListMembershipOpportunitiesRequest()
         {
             readFromValue(obj);
@@ -1328,7 +1912,13 @@ namespace GroupsModels
         ~FListMembershipOpportunitiesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListMembershipOpportunitiesResponse : public PlayFab::FPlayFabCppResultCommon
@@ -1349,6 +1939,15 @@ namespace GroupsModels
             Invitations(src.Invitations)
             {}
 
+        FListMembershipOpportunitiesResponse(FListMembershipOpportunitiesResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Applications(MoveTemp(src.Applications)),
+            Invitations(MoveTemp(src.Invitations))
+            {}
+
+        FListMembershipOpportunitiesResponse& operator=(const FListMembershipOpportunitiesResponse& src) = default;
+        FListMembershipOpportunitiesResponse& operator=(FListMembershipOpportunitiesResponse&& src) = default;
+
         FListMembershipOpportunitiesResponse(const TSharedPtr<FJsonObject>& obj) : FListMembershipOpportunitiesResponse()
         {
             readFromValue(obj);
@@ -1357,7 +1956,13 @@ namespace GroupsModels
         ~FListMembershipOpportunitiesResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListMembershipRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1376,9 +1981,18 @@ namespace GroupsModels
         FListMembershipRequest(const FListMembershipRequest& src) :
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr)
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr)
             {}
 
+        FListMembershipRequest(FListMembershipRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity))
+            {}
+
+        FListMembershipRequest& operator=(const FListMembershipRequest& src) = default;
+        FListMembershipRequest& operator=(FListMembershipRequest&& src) = default;
+
         FListMembershipRequest(const TSharedPtr<FJsonObject>& obj) : FListMembershipRequest()
         {
             readFromValue(obj);
@@ -1387,7 +2001,13 @@ namespace GroupsModels
         ~FListMembershipRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListMembershipResponse : public PlayFab::FPlayFabCppResultCommon
@@ -1404,6 +2024,14 @@ namespace GroupsModels
             Groups(src.Groups)
             {}
 
+        FListMembershipResponse(FListMembershipResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Groups(MoveTemp(src.Groups))
+            {}
+
+        FListMembershipResponse& operator=(const FListMembershipResponse& src) = default;
+        FListMembershipResponse& operator=(FListMembershipResponse&& src) = default;
+
         FListMembershipResponse(const TSharedPtr<FJsonObject>& obj) : FListMembershipResponse()
         {
             readFromValue(obj);
@@ -1412,7 +2040,13 @@ namespace GroupsModels
         ~FListMembershipResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum OperationTypes
@@ -1424,6 +2058,7 @@ namespace GroupsModels
     };
 
     PLAYFABCPP_API void writeOperationTypesEnumJSON(OperationTypes enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeOperationTypesEnumJSON(OperationTypes enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API OperationTypes readOperationTypesFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API OperationTypes readOperationTypesFromValue(const FString& value);
 
@@ -1451,6 +2086,16 @@ namespace GroupsModels
             Group(src.Group)
             {}
 
+        FRemoveGroupApplicationRequest(FRemoveGroupApplicationRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            Group(MoveTemp(src.Group))
+            {}
+
+        FRemoveGroupApplicationRequest& operator=(const FRemoveGroupApplicationRequest& src) = default;
+        FRemoveGroupApplicationRequest& operator=(FRemoveGroupApplicationRequest&& src) = default;
+
         FRemoveGroupApplicationRequest(const TSharedPtr<FJsonObject>& obj) : FRemoveGroupApplicationRequest()
         {
             readFromValue(obj);
@@ -1459,7 +2104,13 @@ namespace GroupsModels
         ~FRemoveGroupApplicationRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveGroupInvitationRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1486,6 +2137,16 @@ namespace GroupsModels
             Group(src.Group)
             {}
 
+        FRemoveGroupInvitationRequest(FRemoveGroupInvitationRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            Group(MoveTemp(src.Group))
+            {}
+
+        FRemoveGroupInvitationRequest& operator=(const FRemoveGroupInvitationRequest& src) = default;
+        FRemoveGroupInvitationRequest& operator=(FRemoveGroupInvitationRequest&& src) = default;
+
         FRemoveGroupInvitationRequest(const TSharedPtr<FJsonObject>& obj) : FRemoveGroupInvitationRequest()
         {
             readFromValue(obj);
@@ -1494,7 +2155,13 @@ namespace GroupsModels
         ~FRemoveGroupInvitationRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveMembersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1525,6 +2192,17 @@ namespace GroupsModels
             RoleId(src.RoleId)
             {}
 
+        FRemoveMembersRequest(FRemoveMembersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Group(MoveTemp(src.Group)),
+            Members(MoveTemp(src.Members)),
+            RoleId(MoveTemp(src.RoleId))
+            {}
+
+        FRemoveMembersRequest& operator=(const FRemoveMembersRequest& src) = default;
+        FRemoveMembersRequest& operator=(FRemoveMembersRequest&& src) = default;
+
         FRemoveMembersRequest(const TSharedPtr<FJsonObject>& obj) : FRemoveMembersRequest()
         {
             readFromValue(obj);
@@ -1533,7 +2211,13 @@ namespace GroupsModels
         ~FRemoveMembersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnblockEntityRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1560,6 +2244,16 @@ namespace GroupsModels
             Group(src.Group)
             {}
 
+        FUnblockEntityRequest(FUnblockEntityRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            Group(MoveTemp(src.Group))
+            {}
+
+        FUnblockEntityRequest& operator=(const FUnblockEntityRequest& src) = default;
+        FUnblockEntityRequest& operator=(FUnblockEntityRequest&& src) = default;
+
         FUnblockEntityRequest(const TSharedPtr<FJsonObject>& obj) : FUnblockEntityRequest()
         {
             readFromValue(obj);
@@ -1568,7 +2262,13 @@ namespace GroupsModels
         ~FUnblockEntityRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateGroupRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1614,6 +2314,19 @@ namespace GroupsModels
             MemberRoleId(src.MemberRoleId)
             {}
 
+        FUpdateGroupRequest(FUpdateGroupRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AdminRoleId(MoveTemp(src.AdminRoleId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ExpectedProfileVersion(MoveTemp(src.ExpectedProfileVersion)),
+            Group(MoveTemp(src.Group)),
+            GroupName(MoveTemp(src.GroupName)),
+            MemberRoleId(MoveTemp(src.MemberRoleId))
+            {}
+
+        FUpdateGroupRequest& operator=(const FUpdateGroupRequest& src) = default;
+        FUpdateGroupRequest& operator=(FUpdateGroupRequest&& src) = default;
+
         FUpdateGroupRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateGroupRequest()
         {
             readFromValue(obj);
@@ -1622,7 +2335,13 @@ namespace GroupsModels
         ~FUpdateGroupRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateGroupResponse : public PlayFab::FPlayFabCppResultCommon
@@ -1650,6 +2369,16 @@ namespace GroupsModels
             SetResult(src.SetResult)
             {}
 
+        FUpdateGroupResponse(FUpdateGroupResponse&& src) :
+            FPlayFabCppResultCommon(),
+            OperationReason(MoveTemp(src.OperationReason)),
+            ProfileVersion(MoveTemp(src.ProfileVersion)),
+            SetResult(MoveTemp(src.SetResult))
+            {}
+
+        FUpdateGroupResponse& operator=(const FUpdateGroupResponse& src) = default;
+        FUpdateGroupResponse& operator=(FUpdateGroupResponse&& src) = default;
+
         FUpdateGroupResponse(const TSharedPtr<FJsonObject>& obj) : FUpdateGroupResponse()
         {
             readFromValue(obj);
@@ -1658,7 +2387,13 @@ namespace GroupsModels
         ~FUpdateGroupResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateGroupRoleRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1699,6 +2434,18 @@ namespace GroupsModels
             RoleName(src.RoleName)
             {}
 
+        FUpdateGroupRoleRequest(FUpdateGroupRoleRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ExpectedProfileVersion(MoveTemp(src.ExpectedProfileVersion)),
+            Group(MoveTemp(src.Group)),
+            RoleId(MoveTemp(src.RoleId)),
+            RoleName(MoveTemp(src.RoleName))
+            {}
+
+        FUpdateGroupRoleRequest& operator=(const FUpdateGroupRoleRequest& src) = default;
+        FUpdateGroupRoleRequest& operator=(FUpdateGroupRoleRequest&& src) = default;
+
         FUpdateGroupRoleRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateGroupRoleRequest()
         {
             readFromValue(obj);
@@ -1707,7 +2454,13 @@ namespace GroupsModels
         ~FUpdateGroupRoleRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateGroupRoleResponse : public PlayFab::FPlayFabCppResultCommon
@@ -1735,6 +2488,16 @@ namespace GroupsModels
             SetResult(src.SetResult)
             {}
 
+        FUpdateGroupRoleResponse(FUpdateGroupRoleResponse&& src) :
+            FPlayFabCppResultCommon(),
+            OperationReason(MoveTemp(src.OperationReason)),
+            ProfileVersion(MoveTemp(src.ProfileVersion)),
+            SetResult(MoveTemp(src.SetResult))
+            {}
+
+        FUpdateGroupRoleResponse& operator=(const FUpdateGroupRoleResponse& src) = default;
+        FUpdateGroupRoleResponse& operator=(FUpdateGroupRoleResponse&& src) = default;
+
         FUpdateGroupRoleResponse(const TSharedPtr<FJsonObject>& obj) : FUpdateGroupRoleResponse()
         {
             readFromValue(obj);
@@ -1743,7 +2506,13 @@ namespace GroupsModels
         ~FUpdateGroupRoleResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
 }
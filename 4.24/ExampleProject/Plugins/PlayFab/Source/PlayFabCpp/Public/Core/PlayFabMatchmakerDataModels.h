@@ -29,6 +29,14 @@ namespace MatchmakerModels
             AuthorizationTicket(src.AuthorizationTicket)
             {}
 
+        FAuthUserRequest(FAuthUserRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AuthorizationTicket(MoveTemp(src.AuthorizationTicket))
+            {}
+
+        FAuthUserRequest& operator=(const FAuthUserRequest& src) = default;
+        FAuthUserRequest& operator=(FAuthUserRequest&& src) = default;
+
         FAuthUserRequest(const TSharedPtr<FJsonObject>& obj) : FAuthUserRequest()
         {
             readFromValue(obj);
@@ -37,7 +45,13 @@ namespace MatchmakerModels
         ~FAuthUserRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAuthUserResponse : public PlayFab::FPlayFabCppResultCommon
@@ -60,6 +74,15 @@ namespace MatchmakerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FAuthUserResponse(FAuthUserResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Authorized(MoveTemp(src.Authorized)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FAuthUserResponse& operator=(const FAuthUserResponse& src) = default;
+        FAuthUserResponse& operator=(FAuthUserResponse&& src) = default;
+
         FAuthUserResponse(const TSharedPtr<FJsonObject>& obj) : FAuthUserResponse()
         {
             readFromValue(obj);
@@ -68,7 +91,13 @@ namespace MatchmakerModels
         ~FAuthUserResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FItemInstance : public PlayFab::FPlayFabCppBaseModel
@@ -160,6 +189,28 @@ namespace MatchmakerModels
             UsesIncrementedBy(src.UsesIncrementedBy)
             {}
 
+        FItemInstance(FItemInstance&& src) :
+            FPlayFabCppBaseModel(),
+            Annotation(MoveTemp(src.Annotation)),
+            BundleContents(MoveTemp(src.BundleContents)),
+            BundleParent(MoveTemp(src.BundleParent)),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomData(MoveTemp(src.CustomData)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            Expiration(MoveTemp(src.Expiration)),
+            ItemClass(MoveTemp(src.ItemClass)),
+            ItemId(MoveTemp(src.ItemId)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            PurchaseDate(MoveTemp(src.PurchaseDate)),
+            RemainingUses(MoveTemp(src.RemainingUses)),
+            UnitCurrency(MoveTemp(src.UnitCurrency)),
+            UnitPrice(MoveTemp(src.UnitPrice)),
+            UsesIncrementedBy(MoveTemp(src.UsesIncrementedBy))
+            {}
+
+        FItemInstance& operator=(const FItemInstance& src) = default;
+        FItemInstance& operator=(FItemInstance&& src) = default;
+
         FItemInstance(const TSharedPtr<FJsonObject>& obj) : FItemInstance()
         {
             readFromValue(obj);
@@ -168,7 +219,13 @@ namespace MatchmakerModels
         ~FItemInstance();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerJoinedRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -198,6 +255,16 @@ namespace MatchmakerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FPlayerJoinedRequest(FPlayerJoinedRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            LobbyId(MoveTemp(src.LobbyId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FPlayerJoinedRequest& operator=(const FPlayerJoinedRequest& src) = default;
+        FPlayerJoinedRequest& operator=(FPlayerJoinedRequest&& src) = default;
+
         FPlayerJoinedRequest(const TSharedPtr<FJsonObject>& obj) : FPlayerJoinedRequest()
         {
             readFromValue(obj);
@@ -206,7 +273,13 @@ namespace MatchmakerModels
         ~FPlayerJoinedRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerJoinedResponse : public PlayFab::FPlayFabCppResultCommon
@@ -219,6 +292,13 @@ namespace MatchmakerModels
             FPlayFabCppResultCommon()
             {}
 
+        FPlayerJoinedResponse(FPlayerJoinedResponse&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FPlayerJoinedResponse& operator=(const FPlayerJoinedResponse& src) = default;
+        FPlayerJoinedResponse& operator=(FPlayerJoinedResponse&& src) = default;
+
         FPlayerJoinedResponse(const TSharedPtr<FJsonObject>& obj) : FPlayerJoinedResponse()
         {
             readFromValue(obj);
@@ -227,7 +307,13 @@ namespace MatchmakerModels
         ~FPlayerJoinedResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerLeftRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -257,6 +343,16 @@ namespace MatchmakerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FPlayerLeftRequest(FPlayerLeftRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            LobbyId(MoveTemp(src.LobbyId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FPlayerLeftRequest& operator=(const FPlayerLeftRequest& src) = default;
+        FPlayerLeftRequest& operator=(FPlayerLeftRequest&& src) = default;
+
         FPlayerLeftRequest(const TSharedPtr<FJsonObject>& obj) : FPlayerLeftRequest()
         {
             readFromValue(obj);
@@ -265,7 +361,13 @@ namespace MatchmakerModels
         ~FPlayerLeftRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerLeftResponse : public PlayFab::FPlayFabCppResultCommon
@@ -278,6 +380,13 @@ namespace MatchmakerModels
             FPlayFabCppResultCommon()
             {}
 
+        FPlayerLeftResponse(FPlayerLeftResponse&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FPlayerLeftResponse& operator=(const FPlayerLeftResponse& src) = default;
+        FPlayerLeftResponse& operator=(FPlayerLeftResponse&& src) = default;
+
         FPlayerLeftResponse(const TSharedPtr<FJsonObject>& obj) : FPlayerLeftResponse()
         {
             readFromValue(obj);
@@ -286,7 +395,13 @@ namespace MatchmakerModels
         ~FPlayerLeftResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum Region
@@ -301,6 +416,7 @@ namespace MatchmakerModels
     };
 
     PLAYFABCPP_API void writeRegionEnumJSON(Region enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeRegionEnumJSON(Region enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API Region readRegionFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API Region readRegionFromValue(const FString& value);
 
@@ -347,6 +463,19 @@ namespace MatchmakerModels
             pfRegion(src.pfRegion)
             {}
 
+        FStartGameRequest(FStartGameRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Build(MoveTemp(src.Build)),
+            CustomCommandLineData(MoveTemp(src.CustomCommandLineData)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ExternalMatchmakerEventEndpoint(MoveTemp(src.ExternalMatchmakerEventEndpoint)),
+            GameMode(MoveTemp(src.GameMode)),
+            pfRegion(MoveTemp(src.pfRegion))
+            {}
+
+        FStartGameRequest& operator=(const FStartGameRequest& src) = default;
+        FStartGameRequest& operator=(FStartGameRequest&& src) = default;
+
         FStartGameRequest(const TSharedPtr<FJsonObject>& obj) : FStartGameRequest()
         {
             readFromValue(obj);
@@ -355,7 +484,13 @@ namespace MatchmakerModels
         ~FStartGameRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStartGameResponse : public PlayFab::FPlayFabCppResultCommon
@@ -393,6 +528,18 @@ namespace MatchmakerModels
             ServerPublicDNSName(src.ServerPublicDNSName)
             {}
 
+        FStartGameResponse(FStartGameResponse&& src) :
+            FPlayFabCppResultCommon(),
+            GameID(MoveTemp(src.GameID)),
+            ServerIPV4Address(MoveTemp(src.ServerIPV4Address)),
+            ServerIPV6Address(MoveTemp(src.ServerIPV6Address)),
+            ServerPort(MoveTemp(src.ServerPort)),
+            ServerPublicDNSName(MoveTemp(src.ServerPublicDNSName))
+            {}
+
+        FStartGameResponse& operator=(const FStartGameResponse& src) = default;
+        FStartGameResponse& operator=(FStartGameResponse&& src) = default;
+
         FStartGameResponse(const TSharedPtr<FJsonObject>& obj) : FStartGameResponse()
         {
             readFromValue(obj);
@@ -401,7 +548,13 @@ namespace MatchmakerModels
         ~FStartGameResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserInfoRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -431,6 +584,16 @@ namespace MatchmakerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FUserInfoRequest(FUserInfoRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            MinCatalogVersion(MoveTemp(src.MinCatalogVersion)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FUserInfoRequest& operator=(const FUserInfoRequest& src) = default;
+        FUserInfoRequest& operator=(FUserInfoRequest&& src) = default;
+
         FUserInfoRequest(const TSharedPtr<FJsonObject>& obj) : FUserInfoRequest()
         {
             readFromValue(obj);
@@ -439,7 +602,13 @@ namespace MatchmakerModels
         ~FUserInfoRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FVirtualCurrencyRechargeTime : public PlayFab::FPlayFabCppBaseModel
@@ -471,6 +640,16 @@ namespace MatchmakerModels
             SecondsToRecharge(src.SecondsToRecharge)
             {}
 
+        FVirtualCurrencyRechargeTime(FVirtualCurrencyRechargeTime&& src) :
+            FPlayFabCppBaseModel(),
+            RechargeMax(MoveTemp(src.RechargeMax)),
+            RechargeTime(MoveTemp(src.RechargeTime)),
+            SecondsToRecharge(MoveTemp(src.SecondsToRecharge))
+            {}
+
+        FVirtualCurrencyRechargeTime& operator=(const FVirtualCurrencyRechargeTime& src) = default;
+        FVirtualCurrencyRechargeTime& operator=(FVirtualCurrencyRechargeTime&& src) = default;
+
         FVirtualCurrencyRechargeTime(const TSharedPtr<FJsonObject>& obj) : FVirtualCurrencyRechargeTime()
         {
             readFromValue(obj);
@@ -479,7 +658,13 @@ namespace MatchmakerModels
         ~FVirtualCurrencyRechargeTime();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserInfoResponse : public PlayFab::FPlayFabCppResultCommon
@@ -529,6 +714,21 @@ namespace MatchmakerModels
             VirtualCurrencyRechargeTimes(src.VirtualCurrencyRechargeTimes)
             {}
 
+        FUserInfoResponse(FUserInfoResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Inventory(MoveTemp(src.Inventory)),
+            IsDeveloper(MoveTemp(src.IsDeveloper)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            SteamId(MoveTemp(src.SteamId)),
+            TitleDisplayName(MoveTemp(src.TitleDisplayName)),
+            Username(MoveTemp(src.Username)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency)),
+            VirtualCurrencyRechargeTimes(MoveTemp(src.VirtualCurrencyRechargeTimes))
+            {}
+
+        FUserInfoResponse& operator=(const FUserInfoResponse& src) = default;
+        FUserInfoResponse& operator=(FUserInfoResponse&& src) = default;
+
         FUserInfoResponse(const TSharedPtr<FJsonObject>& obj) : FUserInfoResponse()
         {
             readFromValue(obj);
@@ -537,7 +737,13 @@ namespace MatchmakerModels
         ~FUserInfoResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
 }
@@ -34,6 +34,15 @@ namespace MultiplayerModels
             MountPath(src.MountPath)
             {}
 
+        FAssetReference(FAssetReference&& src) :
+            FPlayFabCppBaseModel(),
+            FileName(MoveTemp(src.FileName)),
+            MountPath(MoveTemp(src.MountPath))
+            {}
+
+        FAssetReference& operator=(const FAssetReference& src) = default;
+        FAssetReference& operator=(FAssetReference&& src) = default;
+
         FAssetReference(const TSharedPtr<FJsonObject>& obj) : FAssetReference()
         {
             readFromValue(obj);
@@ -42,7 +51,13 @@ namespace MultiplayerModels
         ~FAssetReference();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAssetReferenceParams : public PlayFab::FPlayFabCppBaseModel
@@ -65,6 +80,15 @@ namespace MultiplayerModels
             MountPath(src.MountPath)
             {}
 
+        FAssetReferenceParams(FAssetReferenceParams&& src) :
+            FPlayFabCppBaseModel(),
+            FileName(MoveTemp(src.FileName)),
+            MountPath(MoveTemp(src.MountPath))
+            {}
+
+        FAssetReferenceParams& operator=(const FAssetReferenceParams& src) = default;
+        FAssetReferenceParams& operator=(FAssetReferenceParams&& src) = default;
+
         FAssetReferenceParams(const TSharedPtr<FJsonObject>& obj) : FAssetReferenceParams()
         {
             readFromValue(obj);
@@ -73,7 +97,13 @@ namespace MultiplayerModels
         ~FAssetReferenceParams();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAssetSummary : public PlayFab::FPlayFabCppBaseModel
@@ -95,6 +125,15 @@ namespace MultiplayerModels
             Metadata(src.Metadata)
             {}
 
+        FAssetSummary(FAssetSummary&& src) :
+            FPlayFabCppBaseModel(),
+            FileName(MoveTemp(src.FileName)),
+            Metadata(MoveTemp(src.Metadata))
+            {}
+
+        FAssetSummary& operator=(const FAssetSummary& src) = default;
+        FAssetSummary& operator=(FAssetSummary&& src) = default;
+
         FAssetSummary(const TSharedPtr<FJsonObject>& obj) : FAssetSummary()
         {
             readFromValue(obj);
@@ -103,7 +142,13 @@ namespace MultiplayerModels
         ~FAssetSummary();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum AzureRegion
@@ -134,6 +179,7 @@ namespace MultiplayerModels
     };
 
     PLAYFABCPP_API void writeAzureRegionEnumJSON(AzureRegion enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeAzureRegionEnumJSON(AzureRegion enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API AzureRegion readAzureRegionFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API AzureRegion readAzureRegionFromValue(const FString& value);
 
@@ -157,6 +203,7 @@ namespace MultiplayerModels
     };
 
     PLAYFABCPP_API void writeAzureVmFamilyEnumJSON(AzureVmFamily enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeAzureVmFamilyEnumJSON(AzureVmFamily enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API AzureVmFamily readAzureVmFamilyFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API AzureVmFamily readAzureVmFamilyFromValue(const FString& value);
 
@@ -217,6 +264,7 @@ namespace MultiplayerModels
     };
 
     PLAYFABCPP_API void writeAzureVmSizeEnumJSON(AzureVmSize enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeAzureVmSizeEnumJSON(AzureVmSize enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API AzureVmSize readAzureVmSizeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API AzureVmSize readAzureVmSizeFromValue(const FString& value);
 
@@ -234,6 +282,14 @@ namespace MultiplayerModels
             BuildWeightDistribution(src.BuildWeightDistribution)
             {}
 
+        FBuildSelectionCriterion(FBuildSelectionCriterion&& src) :
+            FPlayFabCppBaseModel(),
+            BuildWeightDistribution(MoveTemp(src.BuildWeightDistribution))
+            {}
+
+        FBuildSelectionCriterion& operator=(const FBuildSelectionCriterion& src) = default;
+        FBuildSelectionCriterion& operator=(FBuildSelectionCriterion&& src) = default;
+
         FBuildSelectionCriterion(const TSharedPtr<FJsonObject>& obj) : FBuildSelectionCriterion()
         {
             readFromValue(obj);
@@ -242,7 +298,13 @@ namespace MultiplayerModels
         ~FBuildSelectionCriterion();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FBuildAliasDetailsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -269,6 +331,16 @@ namespace MultiplayerModels
             BuildSelectionCriteria(src.BuildSelectionCriteria)
             {}
 
+        FBuildAliasDetailsResponse(FBuildAliasDetailsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            AliasId(MoveTemp(src.AliasId)),
+            AliasName(MoveTemp(src.AliasName)),
+            BuildSelectionCriteria(MoveTemp(src.BuildSelectionCriteria))
+            {}
+
+        FBuildAliasDetailsResponse& operator=(const FBuildAliasDetailsResponse& src) = default;
+        FBuildAliasDetailsResponse& operator=(FBuildAliasDetailsResponse&& src) = default;
+
         FBuildAliasDetailsResponse(const TSharedPtr<FJsonObject>& obj) : FBuildAliasDetailsResponse()
         {
             readFromValue(obj);
@@ -277,7 +349,13 @@ namespace MultiplayerModels
         ~FBuildAliasDetailsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FBuildAliasParams : public PlayFab::FPlayFabCppBaseModel
@@ -295,6 +373,14 @@ namespace MultiplayerModels
             AliasId(src.AliasId)
             {}
 
+        FBuildAliasParams(FBuildAliasParams&& src) :
+            FPlayFabCppBaseModel(),
+            AliasId(MoveTemp(src.AliasId))
+            {}
+
+        FBuildAliasParams& operator=(const FBuildAliasParams& src) = default;
+        FBuildAliasParams& operator=(FBuildAliasParams&& src) = default;
+
         FBuildAliasParams(const TSharedPtr<FJsonObject>& obj) : FBuildAliasParams()
         {
             readFromValue(obj);
@@ -303,7 +389,13 @@ namespace MultiplayerModels
         ~FBuildAliasParams();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCurrentServerStats : public PlayFab::FPlayFabCppBaseModel
@@ -336,6 +428,17 @@ namespace MultiplayerModels
             Total(src.Total)
             {}
 
+        FCurrentServerStats(FCurrentServerStats&& src) :
+            FPlayFabCppBaseModel(),
+            Active(MoveTemp(src.Active)),
+            Propping(MoveTemp(src.Propping)),
+            StandingBy(MoveTemp(src.StandingBy)),
+            Total(MoveTemp(src.Total))
+            {}
+
+        FCurrentServerStats& operator=(const FCurrentServerStats& src) = default;
+        FCurrentServerStats& operator=(FCurrentServerStats&& src) = default;
+
         FCurrentServerStats(const TSharedPtr<FJsonObject>& obj) : FCurrentServerStats()
         {
             readFromValue(obj);
@@ -344,7 +447,13 @@ namespace MultiplayerModels
         ~FCurrentServerStats();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDynamicStandbyThreshold : public PlayFab::FPlayFabCppBaseModel
@@ -367,6 +476,15 @@ namespace MultiplayerModels
             TriggerThresholdPercentage(src.TriggerThresholdPercentage)
             {}
 
+        FDynamicStandbyThreshold(FDynamicStandbyThreshold&& src) :
+            FPlayFabCppBaseModel(),
+            Multiplier(MoveTemp(src.Multiplier)),
+            TriggerThresholdPercentage(MoveTemp(src.TriggerThresholdPercentage))
+            {}
+
+        FDynamicStandbyThreshold& operator=(const FDynamicStandbyThreshold& src) = default;
+        FDynamicStandbyThreshold& operator=(FDynamicStandbyThreshold&& src) = default;
+
         FDynamicStandbyThreshold(const TSharedPtr<FJsonObject>& obj) : FDynamicStandbyThreshold()
         {
             readFromValue(obj);
@@ -375,7 +493,13 @@ namespace MultiplayerModels
         ~FDynamicStandbyThreshold();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDynamicStandbySettings : public PlayFab::FPlayFabCppBaseModel
@@ -405,6 +529,16 @@ namespace MultiplayerModels
             RampDownSeconds(src.RampDownSeconds)
             {}
 
+        FDynamicStandbySettings(FDynamicStandbySettings&& src) :
+            FPlayFabCppBaseModel(),
+            DynamicFloorMultiplierThresholds(MoveTemp(src.DynamicFloorMultiplierThresholds)),
+            IsEnabled(MoveTemp(src.IsEnabled)),
+            RampDownSeconds(MoveTemp(src.RampDownSeconds))
+            {}
+
+        FDynamicStandbySettings& operator=(const FDynamicStandbySettings& src) = default;
+        FDynamicStandbySettings& operator=(FDynamicStandbySettings&& src) = default;
+
         FDynamicStandbySettings(const TSharedPtr<FJsonObject>& obj) : FDynamicStandbySettings()
         {
             readFromValue(obj);
@@ -413,7 +547,13 @@ namespace MultiplayerModels
         ~FDynamicStandbySettings();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSchedule : public PlayFab::FPlayFabCppBaseModel
@@ -459,6 +599,19 @@ namespace MultiplayerModels
             TargetStandby(src.TargetStandby)
             {}
 
+        FSchedule(FSchedule&& src) :
+            FPlayFabCppBaseModel(),
+            Description(MoveTemp(src.Description)),
+            EndTime(MoveTemp(src.EndTime)),
+            IsDisabled(MoveTemp(src.IsDisabled)),
+            IsRecurringWeekly(MoveTemp(src.IsRecurringWeekly)),
+            StartTime(MoveTemp(src.StartTime)),
+            TargetStandby(MoveTemp(src.TargetStandby))
+            {}
+
+        FSchedule& operator=(const FSchedule& src) = default;
+        FSchedule& operator=(FSchedule&& src) = default;
+
         FSchedule(const TSharedPtr<FJsonObject>& obj) : FSchedule()
         {
             readFromValue(obj);
@@ -467,7 +620,13 @@ namespace MultiplayerModels
         ~FSchedule();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FScheduledStandbySettings : public PlayFab::FPlayFabCppBaseModel
@@ -489,6 +648,15 @@ namespace MultiplayerModels
             ScheduleList(src.ScheduleList)
             {}
 
+        FScheduledStandbySettings(FScheduledStandbySettings&& src) :
+            FPlayFabCppBaseModel(),
+            IsEnabled(MoveTemp(src.IsEnabled)),
+            ScheduleList(MoveTemp(src.ScheduleList))
+            {}
+
+        FScheduledStandbySettings& operator=(const FScheduledStandbySettings& src) = default;
+        FScheduledStandbySettings& operator=(FScheduledStandbySettings&& src) = default;
+
         FScheduledStandbySettings(const TSharedPtr<FJsonObject>& obj) : FScheduledStandbySettings()
         {
             readFromValue(obj);
@@ -497,7 +665,13 @@ namespace MultiplayerModels
         ~FScheduledStandbySettings();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FBuildRegion : public PlayFab::FPlayFabCppBaseModel
@@ -539,15 +713,29 @@ namespace MultiplayerModels
 
         FBuildRegion(const FBuildRegion& src) :
             FPlayFabCppBaseModel(),
-            pfCurrentServerStats(src.pfCurrentServerStats.IsValid() ? MakeShareable(new FCurrentServerStats(*src.pfCurrentServerStats)) : nullptr),
-            pfDynamicStandbySettings(src.pfDynamicStandbySettings.IsValid() ? MakeShareable(new FDynamicStandbySettings(*src.pfDynamicStandbySettings)) : nullptr),
+            pfCurrentServerStats(src.pfCurrentServerStats.IsValid() ? TSharedPtr<FCurrentServerStats>(MakeShared<FCurrentServerStats>(*src.pfCurrentServerStats)) : nullptr),
+            pfDynamicStandbySettings(src.pfDynamicStandbySettings.IsValid() ? TSharedPtr<FDynamicStandbySettings>(MakeShared<FDynamicStandbySettings>(*src.pfDynamicStandbySettings)) : nullptr),
             MaxServers(src.MaxServers),
             Region(src.Region),
-            pfScheduledStandbySettings(src.pfScheduledStandbySettings.IsValid() ? MakeShareable(new FScheduledStandbySettings(*src.pfScheduledStandbySettings)) : nullptr),
+            pfScheduledStandbySettings(src.pfScheduledStandbySettings.IsValid() ? TSharedPtr<FScheduledStandbySettings>(MakeShared<FScheduledStandbySettings>(*src.pfScheduledStandbySettings)) : nullptr),
             StandbyServers(src.StandbyServers),
             Status(src.Status)
             {}
 
+        FBuildRegion(FBuildRegion&& src) :
+            FPlayFabCppBaseModel(),
+            pfCurrentServerStats(MoveTemp(src.pfCurrentServerStats)),
+            pfDynamicStandbySettings(MoveTemp(src.pfDynamicStandbySettings)),
+            MaxServers(MoveTemp(src.MaxServers)),
+            Region(MoveTemp(src.Region)),
+            pfScheduledStandbySettings(MoveTemp(src.pfScheduledStandbySettings)),
+            StandbyServers(MoveTemp(src.StandbyServers)),
+            Status(MoveTemp(src.Status))
+            {}
+
+        FBuildRegion& operator=(const FBuildRegion& src) = default;
+        FBuildRegion& operator=(FBuildRegion&& src) = default;
+
         FBuildRegion(const TSharedPtr<FJsonObject>& obj) : FBuildRegion()
         {
             readFromValue(obj);
@@ -556,7 +744,13 @@ namespace MultiplayerModels
         ~FBuildRegion();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FBuildRegionParams : public PlayFab::FPlayFabCppBaseModel
@@ -587,13 +781,25 @@ namespace MultiplayerModels
 
         FBuildRegionParams(const FBuildRegionParams& src) :
             FPlayFabCppBaseModel(),
-            pfDynamicStandbySettings(src.pfDynamicStandbySettings.IsValid() ? MakeShareable(new FDynamicStandbySettings(*src.pfDynamicStandbySettings)) : nullptr),
+            pfDynamicStandbySettings(src.pfDynamicStandbySettings.IsValid() ? TSharedPtr<FDynamicStandbySettings>(MakeShared<FDynamicStandbySettings>(*src.pfDynamicStandbySettings)) : nullptr),
             MaxServers(src.MaxServers),
             Region(src.Region),
-            pfScheduledStandbySettings(src.pfScheduledStandbySettings.IsValid() ? MakeShareable(new FScheduledStandbySettings(*src.pfScheduledStandbySettings)) : nullptr),
+            pfScheduledStandbySettings(src.pfScheduledStandbySettings.IsValid() ? TSharedPtr<FScheduledStandbySettings>(MakeShared<FScheduledStandbySettings>(*src.pfScheduledStandbySettings)) : nullptr),
             StandbyServers(src.StandbyServers)
             {}
 
+        FBuildRegionParams(FBuildRegionParams&& src) :
+            FPlayFabCppBaseModel(),
+            pfDynamicStandbySettings(MoveTemp(src.pfDynamicStandbySettings)),
+            MaxServers(MoveTemp(src.MaxServers)),
+            Region(MoveTemp(src.Region)),
+            pfScheduledStandbySettings(MoveTemp(src.pfScheduledStandbySettings)),
+            StandbyServers(MoveTemp(src.StandbyServers))
+            {}
+
+        FBuildRegionParams& operator=(const FBuildRegionParams& src) = default;
+        FBuildRegionParams& operator=(FBuildRegionParams&& src) = default;
+
         FBuildRegionParams(const TSharedPtr<FJsonObject>& obj) : FBuildRegionParams()
         {
             readFromValue(obj);
@@ -602,7 +808,13 @@ namespace MultiplayerModels
         ~FBuildRegionParams();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FBuildSummary : public PlayFab::FPlayFabCppBaseModel
@@ -638,6 +850,18 @@ namespace MultiplayerModels
             RegionConfigurations(src.RegionConfigurations)
             {}
 
+        FBuildSummary(FBuildSummary&& src) :
+            FPlayFabCppBaseModel(),
+            BuildId(MoveTemp(src.BuildId)),
+            BuildName(MoveTemp(src.BuildName)),
+            CreationTime(MoveTemp(src.CreationTime)),
+            Metadata(MoveTemp(src.Metadata)),
+            RegionConfigurations(MoveTemp(src.RegionConfigurations))
+            {}
+
+        FBuildSummary& operator=(const FBuildSummary& src) = default;
+        FBuildSummary& operator=(FBuildSummary&& src) = default;
+
         FBuildSummary(const TSharedPtr<FJsonObject>& obj) : FBuildSummary()
         {
             readFromValue(obj);
@@ -646,7 +870,13 @@ namespace MultiplayerModels
         ~FBuildSummary();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityKey : public PlayFab::FPlayFabCppBaseModel
@@ -669,6 +899,15 @@ namespace MultiplayerModels
             Type(src.Type)
             {}
 
+        FEntityKey(FEntityKey&& src) :
+            FPlayFabCppBaseModel(),
+            Id(MoveTemp(src.Id)),
+            Type(MoveTemp(src.Type))
+            {}
+
+        FEntityKey& operator=(const FEntityKey& src) = default;
+        FEntityKey& operator=(FEntityKey&& src) = default;
+
         FEntityKey(const TSharedPtr<FJsonObject>& obj) : FEntityKey()
         {
             readFromValue(obj);
@@ -677,7 +916,13 @@ namespace MultiplayerModels
         ~FEntityKey();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCancelAllMatchmakingTicketsForPlayerRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -700,10 +945,20 @@ namespace MultiplayerModels
         FCancelAllMatchmakingTicketsForPlayerRequest(const FCancelAllMatchmakingTicketsForPlayerRequest& src) :
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             QueueName(src.QueueName)
             {}
 
+        FCancelAllMatchmakingTicketsForPlayerRequest(FCancelAllMatchmakingTicketsForPlayerRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            QueueName(MoveTemp(src.QueueName))
+            {}
+
+        FCancelAllMatchmakingTicketsForPlayerRequest& operator=(const FCancelAllMatchmakingTicketsForPlayerRequest& src) = default;
+        FCancelAllMatchmakingTicketsForPlayerRequest& operator=(FCancelAllMatchmakingTicketsForPlayerRequest&& src) = default;
+
         FCancelAllMatchmakingTicketsForPlayerRequest(const TSharedPtr<FJsonObject>& obj) : FCancelAllMatchmakingTicketsForPlayerRequest()
         {
             readFromValue(obj);
@@ -712,7 +967,13 @@ namespace MultiplayerModels
         ~FCancelAllMatchmakingTicketsForPlayerRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCancelAllMatchmakingTicketsForPlayerResult : public PlayFab::FPlayFabCppResultCommon
@@ -725,6 +986,13 @@ namespace MultiplayerModels
             FPlayFabCppResultCommon()
             {}
 
+        FCancelAllMatchmakingTicketsForPlayerResult(FCancelAllMatchmakingTicketsForPlayerResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FCancelAllMatchmakingTicketsForPlayerResult& operator=(const FCancelAllMatchmakingTicketsForPlayerResult& src) = default;
+        FCancelAllMatchmakingTicketsForPlayerResult& operator=(FCancelAllMatchmakingTicketsForPlayerResult&& src) = default;
+
         FCancelAllMatchmakingTicketsForPlayerResult(const TSharedPtr<FJsonObject>& obj) : FCancelAllMatchmakingTicketsForPlayerResult()
         {
             readFromValue(obj);
@@ -733,7 +1001,13 @@ namespace MultiplayerModels
         ~FCancelAllMatchmakingTicketsForPlayerResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCancelAllServerBackfillTicketsForPlayerRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -760,6 +1034,16 @@ namespace MultiplayerModels
             QueueName(src.QueueName)
             {}
 
+        FCancelAllServerBackfillTicketsForPlayerRequest(FCancelAllServerBackfillTicketsForPlayerRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            QueueName(MoveTemp(src.QueueName))
+            {}
+
+        FCancelAllServerBackfillTicketsForPlayerRequest& operator=(const FCancelAllServerBackfillTicketsForPlayerRequest& src) = default;
+        FCancelAllServerBackfillTicketsForPlayerRequest& operator=(FCancelAllServerBackfillTicketsForPlayerRequest&& src) = default;
+
         FCancelAllServerBackfillTicketsForPlayerRequest(const TSharedPtr<FJsonObject>& obj) : FCancelAllServerBackfillTicketsForPlayerRequest()
         {
             readFromValue(obj);
@@ -768,7 +1052,13 @@ namespace MultiplayerModels
         ~FCancelAllServerBackfillTicketsForPlayerRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCancelAllServerBackfillTicketsForPlayerResult : public PlayFab::FPlayFabCppResultCommon
@@ -781,6 +1071,13 @@ namespace MultiplayerModels
             FPlayFabCppResultCommon()
             {}
 
+        FCancelAllServerBackfillTicketsForPlayerResult(FCancelAllServerBackfillTicketsForPlayerResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FCancelAllServerBackfillTicketsForPlayerResult& operator=(const FCancelAllServerBackfillTicketsForPlayerResult& src) = default;
+        FCancelAllServerBackfillTicketsForPlayerResult& operator=(FCancelAllServerBackfillTicketsForPlayerResult&& src) = default;
+
         FCancelAllServerBackfillTicketsForPlayerResult(const TSharedPtr<FJsonObject>& obj) : FCancelAllServerBackfillTicketsForPlayerResult()
         {
             readFromValue(obj);
@@ -789,7 +1086,13 @@ namespace MultiplayerModels
         ~FCancelAllServerBackfillTicketsForPlayerResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum CancellationReason
@@ -800,6 +1103,7 @@ namespace MultiplayerModels
     };
 
     PLAYFABCPP_API void writeCancellationReasonEnumJSON(CancellationReason enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeCancellationReasonEnumJSON(CancellationReason enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API CancellationReason readCancellationReasonFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API CancellationReason readCancellationReasonFromValue(const FString& value);
 
@@ -827,6 +1131,16 @@ namespace MultiplayerModels
             TicketId(src.TicketId)
             {}
 
+        FCancelMatchmakingTicketRequest(FCancelMatchmakingTicketRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            QueueName(MoveTemp(src.QueueName)),
+            TicketId(MoveTemp(src.TicketId))
+            {}
+
+        FCancelMatchmakingTicketRequest& operator=(const FCancelMatchmakingTicketRequest& src) = default;
+        FCancelMatchmakingTicketRequest& operator=(FCancelMatchmakingTicketRequest&& src) = default;
+
         FCancelMatchmakingTicketRequest(const TSharedPtr<FJsonObject>& obj) : FCancelMatchmakingTicketRequest()
         {
             readFromValue(obj);
@@ -835,7 +1149,13 @@ namespace MultiplayerModels
         ~FCancelMatchmakingTicketRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCancelMatchmakingTicketResult : public PlayFab::FPlayFabCppResultCommon
@@ -848,6 +1168,13 @@ namespace MultiplayerModels
             FPlayFabCppResultCommon()
             {}
 
+        FCancelMatchmakingTicketResult(FCancelMatchmakingTicketResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FCancelMatchmakingTicketResult& operator=(const FCancelMatchmakingTicketResult& src) = default;
+        FCancelMatchmakingTicketResult& operator=(FCancelMatchmakingTicketResult&& src) = default;
+
         FCancelMatchmakingTicketResult(const TSharedPtr<FJsonObject>& obj) : FCancelMatchmakingTicketResult()
         {
             readFromValue(obj);
@@ -856,7 +1183,13 @@ namespace MultiplayerModels
         ~FCancelMatchmakingTicketResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCancelServerBackfillTicketRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -883,6 +1216,16 @@ namespace MultiplayerModels
             TicketId(src.TicketId)
             {}
 
+        FCancelServerBackfillTicketRequest(FCancelServerBackfillTicketRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            QueueName(MoveTemp(src.QueueName)),
+            TicketId(MoveTemp(src.TicketId))
+            {}
+
+        FCancelServerBackfillTicketRequest& operator=(const FCancelServerBackfillTicketRequest& src) = default;
+        FCancelServerBackfillTicketRequest& operator=(FCancelServerBackfillTicketRequest&& src) = default;
+
         FCancelServerBackfillTicketRequest(const TSharedPtr<FJsonObject>& obj) : FCancelServerBackfillTicketRequest()
         {
             readFromValue(obj);
@@ -891,7 +1234,13 @@ namespace MultiplayerModels
         ~FCancelServerBackfillTicketRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCancelServerBackfillTicketResult : public PlayFab::FPlayFabCppResultCommon
@@ -904,6 +1253,13 @@ namespace MultiplayerModels
             FPlayFabCppResultCommon()
             {}
 
+        FCancelServerBackfillTicketResult(FCancelServerBackfillTicketResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FCancelServerBackfillTicketResult& operator=(const FCancelServerBackfillTicketResult& src) = default;
+        FCancelServerBackfillTicketResult& operator=(FCancelServerBackfillTicketResult&& src) = default;
+
         FCancelServerBackfillTicketResult(const TSharedPtr<FJsonObject>& obj) : FCancelServerBackfillTicketResult()
         {
             readFromValue(obj);
@@ -912,7 +1268,13 @@ namespace MultiplayerModels
         ~FCancelServerBackfillTicketResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCertificate : public PlayFab::FPlayFabCppBaseModel
@@ -943,6 +1305,16 @@ namespace MultiplayerModels
             Password(src.Password)
             {}
 
+        FCertificate(FCertificate&& src) :
+            FPlayFabCppBaseModel(),
+            Base64EncodedValue(MoveTemp(src.Base64EncodedValue)),
+            Name(MoveTemp(src.Name)),
+            Password(MoveTemp(src.Password))
+            {}
+
+        FCertificate& operator=(const FCertificate& src) = default;
+        FCertificate& operator=(FCertificate&& src) = default;
+
         FCertificate(const TSharedPtr<FJsonObject>& obj) : FCertificate()
         {
             readFromValue(obj);
@@ -951,7 +1323,13 @@ namespace MultiplayerModels
         ~FCertificate();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCertificateSummary : public PlayFab::FPlayFabCppBaseModel
@@ -974,6 +1352,15 @@ namespace MultiplayerModels
             Thumbprint(src.Thumbprint)
             {}
 
+        FCertificateSummary(FCertificateSummary&& src) :
+            FPlayFabCppBaseModel(),
+            Name(MoveTemp(src.Name)),
+            Thumbprint(MoveTemp(src.Thumbprint))
+            {}
+
+        FCertificateSummary& operator=(const FCertificateSummary& src) = default;
+        FCertificateSummary& operator=(FCertificateSummary&& src) = default;
+
         FCertificateSummary(const TSharedPtr<FJsonObject>& obj) : FCertificateSummary()
         {
             readFromValue(obj);
@@ -982,7 +1369,13 @@ namespace MultiplayerModels
         ~FCertificateSummary();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConnectedPlayer : public PlayFab::FPlayFabCppBaseModel
@@ -1000,6 +1393,14 @@ namespace MultiplayerModels
             PlayerId(src.PlayerId)
             {}
 
+        FConnectedPlayer(FConnectedPlayer&& src) :
+            FPlayFabCppBaseModel(),
+            PlayerId(MoveTemp(src.PlayerId))
+            {}
+
+        FConnectedPlayer& operator=(const FConnectedPlayer& src) = default;
+        FConnectedPlayer& operator=(FConnectedPlayer&& src) = default;
+
         FConnectedPlayer(const TSharedPtr<FJsonObject>& obj) : FConnectedPlayer()
         {
             readFromValue(obj);
@@ -1008,7 +1409,13 @@ namespace MultiplayerModels
         ~FConnectedPlayer();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum ContainerFlavor
@@ -1020,6 +1427,7 @@ namespace MultiplayerModels
     };
 
     PLAYFABCPP_API void writeContainerFlavorEnumJSON(ContainerFlavor enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeContainerFlavorEnumJSON(ContainerFlavor enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API ContainerFlavor readContainerFlavorFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API ContainerFlavor readContainerFlavorFromValue(const FString& value);
 
@@ -1043,6 +1451,15 @@ namespace MultiplayerModels
             Tag(src.Tag)
             {}
 
+        FContainerImageReference(FContainerImageReference&& src) :
+            FPlayFabCppBaseModel(),
+            ImageName(MoveTemp(src.ImageName)),
+            Tag(MoveTemp(src.Tag))
+            {}
+
+        FContainerImageReference& operator=(const FContainerImageReference& src) = default;
+        FContainerImageReference& operator=(FContainerImageReference&& src) = default;
+
         FContainerImageReference(const TSharedPtr<FJsonObject>& obj) : FContainerImageReference()
         {
             readFromValue(obj);
@@ -1051,7 +1468,13 @@ namespace MultiplayerModels
         ~FContainerImageReference();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCoreCapacity : public PlayFab::FPlayFabCppBaseModel
@@ -1084,6 +1507,17 @@ namespace MultiplayerModels
             VmFamily(src.VmFamily)
             {}
 
+        FCoreCapacity(FCoreCapacity&& src) :
+            FPlayFabCppBaseModel(),
+            Available(MoveTemp(src.Available)),
+            Region(MoveTemp(src.Region)),
+            Total(MoveTemp(src.Total)),
+            VmFamily(MoveTemp(src.VmFamily))
+            {}
+
+        FCoreCapacity& operator=(const FCoreCapacity& src) = default;
+        FCoreCapacity& operator=(FCoreCapacity&& src) = default;
+
         FCoreCapacity(const TSharedPtr<FJsonObject>& obj) : FCoreCapacity()
         {
             readFromValue(obj);
@@ -1092,7 +1526,13 @@ namespace MultiplayerModels
         ~FCoreCapacity();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCoreCapacityChange : public PlayFab::FPlayFabCppBaseModel
@@ -1120,6 +1560,16 @@ namespace MultiplayerModels
             VmFamily(src.VmFamily)
             {}
 
+        FCoreCapacityChange(FCoreCapacityChange&& src) :
+            FPlayFabCppBaseModel(),
+            NewCoreLimit(MoveTemp(src.NewCoreLimit)),
+            Region(MoveTemp(src.Region)),
+            VmFamily(MoveTemp(src.VmFamily))
+            {}
+
+        FCoreCapacityChange& operator=(const FCoreCapacityChange& src) = default;
+        FCoreCapacityChange& operator=(FCoreCapacityChange&& src) = default;
+
         FCoreCapacityChange(const TSharedPtr<FJsonObject>& obj) : FCoreCapacityChange()
         {
             readFromValue(obj);
@@ -1128,7 +1578,13 @@ namespace MultiplayerModels
         ~FCoreCapacityChange();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateBuildAliasRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1154,6 +1610,16 @@ namespace MultiplayerModels
             CustomTags(src.CustomTags)
             {}
 
+        FCreateBuildAliasRequest(FCreateBuildAliasRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AliasName(MoveTemp(src.AliasName)),
+            BuildSelectionCriteria(MoveTemp(src.BuildSelectionCriteria)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FCreateBuildAliasRequest& operator=(const FCreateBuildAliasRequest& src) = default;
+        FCreateBuildAliasRequest& operator=(FCreateBuildAliasRequest&& src) = default;
+
         FCreateBuildAliasRequest(const TSharedPtr<FJsonObject>& obj) : FCreateBuildAliasRequest()
         {
             readFromValue(obj);
@@ -1162,7 +1628,13 @@ namespace MultiplayerModels
         ~FCreateBuildAliasRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGameCertificateReferenceParams : public PlayFab::FPlayFabCppBaseModel
@@ -1192,6 +1664,15 @@ namespace MultiplayerModels
             Name(src.Name)
             {}
 
+        FGameCertificateReferenceParams(FGameCertificateReferenceParams&& src) :
+            FPlayFabCppBaseModel(),
+            GsdkAlias(MoveTemp(src.GsdkAlias)),
+            Name(MoveTemp(src.Name))
+            {}
+
+        FGameCertificateReferenceParams& operator=(const FGameCertificateReferenceParams& src) = default;
+        FGameCertificateReferenceParams& operator=(FGameCertificateReferenceParams&& src) = default;
+
         FGameCertificateReferenceParams(const TSharedPtr<FJsonObject>& obj) : FGameCertificateReferenceParams()
         {
             readFromValue(obj);
@@ -1200,7 +1681,13 @@ namespace MultiplayerModels
         ~FGameCertificateReferenceParams();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinuxInstrumentationConfiguration : public PlayFab::FPlayFabCppBaseModel
@@ -1218,6 +1705,14 @@ namespace MultiplayerModels
             IsEnabled(src.IsEnabled)
             {}
 
+        FLinuxInstrumentationConfiguration(FLinuxInstrumentationConfiguration&& src) :
+            FPlayFabCppBaseModel(),
+            IsEnabled(MoveTemp(src.IsEnabled))
+            {}
+
+        FLinuxInstrumentationConfiguration& operator=(const FLinuxInstrumentationConfiguration& src) = default;
+        FLinuxInstrumentationConfiguration& operator=(FLinuxInstrumentationConfiguration&& src) = default;
+
         FLinuxInstrumentationConfiguration(const TSharedPtr<FJsonObject>& obj) : FLinuxInstrumentationConfiguration()
         {
             readFromValue(obj);
@@ -1226,7 +1721,13 @@ namespace MultiplayerModels
         ~FLinuxInstrumentationConfiguration();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum ProtocolType
@@ -1236,6 +1737,7 @@ namespace MultiplayerModels
     };
 
     PLAYFABCPP_API void writeProtocolTypeEnumJSON(ProtocolType enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeProtocolTypeEnumJSON(ProtocolType enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API ProtocolType readProtocolTypeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API ProtocolType readProtocolTypeFromValue(const FString& value);
 
@@ -1264,6 +1766,16 @@ namespace MultiplayerModels
             Protocol(src.Protocol)
             {}
 
+        FPort(FPort&& src) :
+            FPlayFabCppBaseModel(),
+            Name(MoveTemp(src.Name)),
+            Num(MoveTemp(src.Num)),
+            Protocol(MoveTemp(src.Protocol))
+            {}
+
+        FPort& operator=(const FPort& src) = default;
+        FPort& operator=(FPort&& src) = default;
+
         FPort(const TSharedPtr<FJsonObject>& obj) : FPort()
         {
             readFromValue(obj);
@@ -1272,7 +1784,13 @@ namespace MultiplayerModels
         ~FPort();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateBuildWithCustomContainerRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1349,12 +1867,12 @@ namespace MultiplayerModels
             AreAssetsReadonly(src.AreAssetsReadonly),
             BuildName(src.BuildName),
             pfContainerFlavor(src.pfContainerFlavor),
-            pfContainerImageReference(src.pfContainerImageReference.IsValid() ? MakeShareable(new FContainerImageReference(*src.pfContainerImageReference)) : nullptr),
+            pfContainerImageReference(src.pfContainerImageReference.IsValid() ? TSharedPtr<FContainerImageReference>(MakeShared<FContainerImageReference>(*src.pfContainerImageReference)) : nullptr),
             ContainerRunCommand(src.ContainerRunCommand),
             CustomTags(src.CustomTags),
             GameAssetReferences(src.GameAssetReferences),
             GameCertificateReferences(src.GameCertificateReferences),
-            pfLinuxInstrumentationConfiguration(src.pfLinuxInstrumentationConfiguration.IsValid() ? MakeShareable(new FLinuxInstrumentationConfiguration(*src.pfLinuxInstrumentationConfiguration)) : nullptr),
+            pfLinuxInstrumentationConfiguration(src.pfLinuxInstrumentationConfiguration.IsValid() ? TSharedPtr<FLinuxInstrumentationConfiguration>(MakeShared<FLinuxInstrumentationConfiguration>(*src.pfLinuxInstrumentationConfiguration)) : nullptr),
             Metadata(src.Metadata),
             MultiplayerServerCountPerVm(src.MultiplayerServerCountPerVm),
             Ports(src.Ports),
@@ -1363,6 +1881,28 @@ namespace MultiplayerModels
             VmSize(src.VmSize)
             {}
 
+        FCreateBuildWithCustomContainerRequest(FCreateBuildWithCustomContainerRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AreAssetsReadonly(MoveTemp(src.AreAssetsReadonly)),
+            BuildName(MoveTemp(src.BuildName)),
+            pfContainerFlavor(MoveTemp(src.pfContainerFlavor)),
+            pfContainerImageReference(MoveTemp(src.pfContainerImageReference)),
+            ContainerRunCommand(MoveTemp(src.ContainerRunCommand)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            GameAssetReferences(MoveTemp(src.GameAssetReferences)),
+            GameCertificateReferences(MoveTemp(src.GameCertificateReferences)),
+            pfLinuxInstrumentationConfiguration(MoveTemp(src.pfLinuxInstrumentationConfiguration)),
+            Metadata(MoveTemp(src.Metadata)),
+            MultiplayerServerCountPerVm(MoveTemp(src.MultiplayerServerCountPerVm)),
+            Ports(MoveTemp(src.Ports)),
+            RegionConfigurations(MoveTemp(src.RegionConfigurations)),
+            UseStreamingForAssetDownloads(MoveTemp(src.UseStreamingForAssetDownloads)),
+            VmSize(MoveTemp(src.VmSize))
+            {}
+
+        FCreateBuildWithCustomContainerRequest& operator=(const FCreateBuildWithCustomContainerRequest& src) = default;
+        FCreateBuildWithCustomContainerRequest& operator=(FCreateBuildWithCustomContainerRequest&& src) = default;
+
         FCreateBuildWithCustomContainerRequest(const TSharedPtr<FJsonObject>& obj) : FCreateBuildWithCustomContainerRequest()
         {
             readFromValue(obj);
@@ -1371,7 +1911,13 @@ namespace MultiplayerModels
         ~FCreateBuildWithCustomContainerRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGameCertificateReference : public PlayFab::FPlayFabCppBaseModel
@@ -1401,6 +1947,15 @@ namespace MultiplayerModels
             Name(src.Name)
             {}
 
+        FGameCertificateReference(FGameCertificateReference&& src) :
+            FPlayFabCppBaseModel(),
+            GsdkAlias(MoveTemp(src.GsdkAlias)),
+            Name(MoveTemp(src.Name))
+            {}
+
+        FGameCertificateReference& operator=(const FGameCertificateReference& src) = default;
+        FGameCertificateReference& operator=(FGameCertificateReference&& src) = default;
+
         FGameCertificateReference(const TSharedPtr<FJsonObject>& obj) : FGameCertificateReference()
         {
             readFromValue(obj);
@@ -1409,7 +1964,13 @@ namespace MultiplayerModels
         ~FGameCertificateReference();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateBuildWithCustomContainerResponse : public PlayFab::FPlayFabCppResultCommon
@@ -1499,10 +2060,10 @@ namespace MultiplayerModels
             pfContainerFlavor(src.pfContainerFlavor),
             ContainerRunCommand(src.ContainerRunCommand),
             CreationTime(src.CreationTime),
-            CustomGameContainerImage(src.CustomGameContainerImage.IsValid() ? MakeShareable(new FContainerImageReference(*src.CustomGameContainerImage)) : nullptr),
+            CustomGameContainerImage(src.CustomGameContainerImage.IsValid() ? TSharedPtr<FContainerImageReference>(MakeShared<FContainerImageReference>(*src.CustomGameContainerImage)) : nullptr),
             GameAssetReferences(src.GameAssetReferences),
             GameCertificateReferences(src.GameCertificateReferences),
-            pfLinuxInstrumentationConfiguration(src.pfLinuxInstrumentationConfiguration.IsValid() ? MakeShareable(new FLinuxInstrumentationConfiguration(*src.pfLinuxInstrumentationConfiguration)) : nullptr),
+            pfLinuxInstrumentationConfiguration(src.pfLinuxInstrumentationConfiguration.IsValid() ? TSharedPtr<FLinuxInstrumentationConfiguration>(MakeShared<FLinuxInstrumentationConfiguration>(*src.pfLinuxInstrumentationConfiguration)) : nullptr),
             Metadata(src.Metadata),
             MultiplayerServerCountPerVm(src.MultiplayerServerCountPerVm),
             OsPlatform(src.OsPlatform),
@@ -1513,6 +2074,31 @@ namespace MultiplayerModels
             VmSize(src.VmSize)
             {}
 
+        FCreateBuildWithCustomContainerResponse(FCreateBuildWithCustomContainerResponse&& src) :
+            FPlayFabCppResultCommon(),
+            AreAssetsReadonly(MoveTemp(src.AreAssetsReadonly)),
+            BuildId(MoveTemp(src.BuildId)),
+            BuildName(MoveTemp(src.BuildName)),
+            pfContainerFlavor(MoveTemp(src.pfContainerFlavor)),
+            ContainerRunCommand(MoveTemp(src.ContainerRunCommand)),
+            CreationTime(MoveTemp(src.CreationTime)),
+            CustomGameContainerImage(MoveTemp(src.CustomGameContainerImage)),
+            GameAssetReferences(MoveTemp(src.GameAssetReferences)),
+            GameCertificateReferences(MoveTemp(src.GameCertificateReferences)),
+            pfLinuxInstrumentationConfiguration(MoveTemp(src.pfLinuxInstrumentationConfiguration)),
+            Metadata(MoveTemp(src.Metadata)),
+            MultiplayerServerCountPerVm(MoveTemp(src.MultiplayerServerCountPerVm)),
+            OsPlatform(MoveTemp(src.OsPlatform)),
+            Ports(MoveTemp(src.Ports)),
+            RegionConfigurations(MoveTemp(src.RegionConfigurations)),
+            ServerType(MoveTemp(src.ServerType)),
+            UseStreamingForAssetDownloads(MoveTemp(src.UseStreamingForAssetDownloads)),
+            VmSize(MoveTemp(src.VmSize))
+            {}
+
+        FCreateBuildWithCustomContainerResponse& operator=(const FCreateBuildWithCustomContainerResponse& src) = default;
+        FCreateBuildWithCustomContainerResponse& operator=(FCreateBuildWithCustomContainerResponse&& src) = default;
+
         FCreateBuildWithCustomContainerResponse(const TSharedPtr<FJsonObject>& obj) : FCreateBuildWithCustomContainerResponse()
         {
             readFromValue(obj);
@@ -1521,7 +2107,13 @@ namespace MultiplayerModels
         ~FCreateBuildWithCustomContainerResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FInstrumentationConfiguration : public PlayFab::FPlayFabCppBaseModel
@@ -1542,6 +2134,14 @@ namespace MultiplayerModels
             ProcessesToMonitor(src.ProcessesToMonitor)
             {}
 
+        FInstrumentationConfiguration(FInstrumentationConfiguration&& src) :
+            FPlayFabCppBaseModel(),
+            ProcessesToMonitor(MoveTemp(src.ProcessesToMonitor))
+            {}
+
+        FInstrumentationConfiguration& operator=(const FInstrumentationConfiguration& src) = default;
+        FInstrumentationConfiguration& operator=(FInstrumentationConfiguration&& src) = default;
+
         FInstrumentationConfiguration(const TSharedPtr<FJsonObject>& obj) : FInstrumentationConfiguration()
         {
             readFromValue(obj);
@@ -1550,7 +2150,13 @@ namespace MultiplayerModels
         ~FInstrumentationConfiguration();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateBuildWithManagedContainerRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1634,7 +2240,7 @@ namespace MultiplayerModels
             GameAssetReferences(src.GameAssetReferences),
             GameCertificateReferences(src.GameCertificateReferences),
             GameWorkingDirectory(src.GameWorkingDirectory),
-            pfInstrumentationConfiguration(src.pfInstrumentationConfiguration.IsValid() ? MakeShareable(new FInstrumentationConfiguration(*src.pfInstrumentationConfiguration)) : nullptr),
+            pfInstrumentationConfiguration(src.pfInstrumentationConfiguration.IsValid() ? TSharedPtr<FInstrumentationConfiguration>(MakeShared<FInstrumentationConfiguration>(*src.pfInstrumentationConfiguration)) : nullptr),
             Metadata(src.Metadata),
             MultiplayerServerCountPerVm(src.MultiplayerServerCountPerVm),
             Ports(src.Ports),
@@ -1644,6 +2250,28 @@ namespace MultiplayerModels
             VmSize(src.VmSize)
             {}
 
+        FCreateBuildWithManagedContainerRequest(FCreateBuildWithManagedContainerRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AreAssetsReadonly(MoveTemp(src.AreAssetsReadonly)),
+            BuildName(MoveTemp(src.BuildName)),
+            pfContainerFlavor(MoveTemp(src.pfContainerFlavor)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            GameAssetReferences(MoveTemp(src.GameAssetReferences)),
+            GameCertificateReferences(MoveTemp(src.GameCertificateReferences)),
+            GameWorkingDirectory(MoveTemp(src.GameWorkingDirectory)),
+            pfInstrumentationConfiguration(MoveTemp(src.pfInstrumentationConfiguration)),
+            Metadata(MoveTemp(src.Metadata)),
+            MultiplayerServerCountPerVm(MoveTemp(src.MultiplayerServerCountPerVm)),
+            Ports(MoveTemp(src.Ports)),
+            RegionConfigurations(MoveTemp(src.RegionConfigurations)),
+            StartMultiplayerServerCommand(MoveTemp(src.StartMultiplayerServerCommand)),
+            UseStreamingForAssetDownloads(MoveTemp(src.UseStreamingForAssetDownloads)),
+            VmSize(MoveTemp(src.VmSize))
+            {}
+
+        FCreateBuildWithManagedContainerRequest& operator=(const FCreateBuildWithManagedContainerRequest& src) = default;
+        FCreateBuildWithManagedContainerRequest& operator=(FCreateBuildWithManagedContainerRequest&& src) = default;
+
         FCreateBuildWithManagedContainerRequest(const TSharedPtr<FJsonObject>& obj) : FCreateBuildWithManagedContainerRequest()
         {
             readFromValue(obj);
@@ -1652,7 +2280,13 @@ namespace MultiplayerModels
         ~FCreateBuildWithManagedContainerRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateBuildWithManagedContainerResponse : public PlayFab::FPlayFabCppResultCommon
@@ -1747,7 +2381,7 @@ namespace MultiplayerModels
             GameAssetReferences(src.GameAssetReferences),
             GameCertificateReferences(src.GameCertificateReferences),
             GameWorkingDirectory(src.GameWorkingDirectory),
-            pfInstrumentationConfiguration(src.pfInstrumentationConfiguration.IsValid() ? MakeShareable(new FInstrumentationConfiguration(*src.pfInstrumentationConfiguration)) : nullptr),
+            pfInstrumentationConfiguration(src.pfInstrumentationConfiguration.IsValid() ? TSharedPtr<FInstrumentationConfiguration>(MakeShared<FInstrumentationConfiguration>(*src.pfInstrumentationConfiguration)) : nullptr),
             Metadata(src.Metadata),
             MultiplayerServerCountPerVm(src.MultiplayerServerCountPerVm),
             OsPlatform(src.OsPlatform),
@@ -1759,6 +2393,31 @@ namespace MultiplayerModels
             VmSize(src.VmSize)
             {}
 
+        FCreateBuildWithManagedContainerResponse(FCreateBuildWithManagedContainerResponse&& src) :
+            FPlayFabCppResultCommon(),
+            AreAssetsReadonly(MoveTemp(src.AreAssetsReadonly)),
+            BuildId(MoveTemp(src.BuildId)),
+            BuildName(MoveTemp(src.BuildName)),
+            pfContainerFlavor(MoveTemp(src.pfContainerFlavor)),
+            CreationTime(MoveTemp(src.CreationTime)),
+            GameAssetReferences(MoveTemp(src.GameAssetReferences)),
+            GameCertificateReferences(MoveTemp(src.GameCertificateReferences)),
+            GameWorkingDirectory(MoveTemp(src.GameWorkingDirectory)),
+            pfInstrumentationConfiguration(MoveTemp(src.pfInstrumentationConfiguration)),
+            Metadata(MoveTemp(src.Metadata)),
+            MultiplayerServerCountPerVm(MoveTemp(src.MultiplayerServerCountPerVm)),
+            OsPlatform(MoveTemp(src.OsPlatform)),
+            Ports(MoveTemp(src.Ports)),
+            RegionConfigurations(MoveTemp(src.RegionConfigurations)),
+            ServerType(MoveTemp(src.ServerType)),
+            StartMultiplayerServerCommand(MoveTemp(src.StartMultiplayerServerCommand)),
+            UseStreamingForAssetDownloads(MoveTemp(src.UseStreamingForAssetDownloads)),
+            VmSize(MoveTemp(src.VmSize))
+            {}
+
+        FCreateBuildWithManagedContainerResponse& operator=(const FCreateBuildWithManagedContainerResponse& src) = default;
+        FCreateBuildWithManagedContainerResponse& operator=(FCreateBuildWithManagedContainerResponse&& src) = default;
+
         FCreateBuildWithManagedContainerResponse(const TSharedPtr<FJsonObject>& obj) : FCreateBuildWithManagedContainerResponse()
         {
             readFromValue(obj);
@@ -1767,7 +2426,13 @@ namespace MultiplayerModels
         ~FCreateBuildWithManagedContainerResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateBuildWithProcessBasedServerRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1860,7 +2525,7 @@ namespace MultiplayerModels
             GameAssetReferences(src.GameAssetReferences),
             GameCertificateReferences(src.GameCertificateReferences),
             GameWorkingDirectory(src.GameWorkingDirectory),
-            pfInstrumentationConfiguration(src.pfInstrumentationConfiguration.IsValid() ? MakeShareable(new FInstrumentationConfiguration(*src.pfInstrumentationConfiguration)) : nullptr),
+            pfInstrumentationConfiguration(src.pfInstrumentationConfiguration.IsValid() ? TSharedPtr<FInstrumentationConfiguration>(MakeShared<FInstrumentationConfiguration>(*src.pfInstrumentationConfiguration)) : nullptr),
             IsOSPreview(src.IsOSPreview),
             Metadata(src.Metadata),
             MultiplayerServerCountPerVm(src.MultiplayerServerCountPerVm),
@@ -1872,6 +2537,29 @@ namespace MultiplayerModels
             VmSize(src.VmSize)
             {}
 
+        FCreateBuildWithProcessBasedServerRequest(FCreateBuildWithProcessBasedServerRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AreAssetsReadonly(MoveTemp(src.AreAssetsReadonly)),
+            BuildName(MoveTemp(src.BuildName)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            GameAssetReferences(MoveTemp(src.GameAssetReferences)),
+            GameCertificateReferences(MoveTemp(src.GameCertificateReferences)),
+            GameWorkingDirectory(MoveTemp(src.GameWorkingDirectory)),
+            pfInstrumentationConfiguration(MoveTemp(src.pfInstrumentationConfiguration)),
+            IsOSPreview(MoveTemp(src.IsOSPreview)),
+            Metadata(MoveTemp(src.Metadata)),
+            MultiplayerServerCountPerVm(MoveTemp(src.MultiplayerServerCountPerVm)),
+            OsPlatform(MoveTemp(src.OsPlatform)),
+            Ports(MoveTemp(src.Ports)),
+            RegionConfigurations(MoveTemp(src.RegionConfigurations)),
+            StartMultiplayerServerCommand(MoveTemp(src.StartMultiplayerServerCommand)),
+            UseStreamingForAssetDownloads(MoveTemp(src.UseStreamingForAssetDownloads)),
+            VmSize(MoveTemp(src.VmSize))
+            {}
+
+        FCreateBuildWithProcessBasedServerRequest& operator=(const FCreateBuildWithProcessBasedServerRequest& src) = default;
+        FCreateBuildWithProcessBasedServerRequest& operator=(FCreateBuildWithProcessBasedServerRequest&& src) = default;
+
         FCreateBuildWithProcessBasedServerRequest(const TSharedPtr<FJsonObject>& obj) : FCreateBuildWithProcessBasedServerRequest()
         {
             readFromValue(obj);
@@ -1880,7 +2568,13 @@ namespace MultiplayerModels
         ~FCreateBuildWithProcessBasedServerRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateBuildWithProcessBasedServerResponse : public PlayFab::FPlayFabCppResultCommon
@@ -1985,7 +2679,7 @@ namespace MultiplayerModels
             GameAssetReferences(src.GameAssetReferences),
             GameCertificateReferences(src.GameCertificateReferences),
             GameWorkingDirectory(src.GameWorkingDirectory),
-            pfInstrumentationConfiguration(src.pfInstrumentationConfiguration.IsValid() ? MakeShareable(new FInstrumentationConfiguration(*src.pfInstrumentationConfiguration)) : nullptr),
+            pfInstrumentationConfiguration(src.pfInstrumentationConfiguration.IsValid() ? TSharedPtr<FInstrumentationConfiguration>(MakeShared<FInstrumentationConfiguration>(*src.pfInstrumentationConfiguration)) : nullptr),
             IsOSPreview(src.IsOSPreview),
             Metadata(src.Metadata),
             MultiplayerServerCountPerVm(src.MultiplayerServerCountPerVm),
@@ -1998,6 +2692,32 @@ namespace MultiplayerModels
             VmSize(src.VmSize)
             {}
 
+        FCreateBuildWithProcessBasedServerResponse(FCreateBuildWithProcessBasedServerResponse&& src) :
+            FPlayFabCppResultCommon(),
+            AreAssetsReadonly(MoveTemp(src.AreAssetsReadonly)),
+            BuildId(MoveTemp(src.BuildId)),
+            BuildName(MoveTemp(src.BuildName)),
+            pfContainerFlavor(MoveTemp(src.pfContainerFlavor)),
+            CreationTime(MoveTemp(src.CreationTime)),
+            GameAssetReferences(MoveTemp(src.GameAssetReferences)),
+            GameCertificateReferences(MoveTemp(src.GameCertificateReferences)),
+            GameWorkingDirectory(MoveTemp(src.GameWorkingDirectory)),
+            pfInstrumentationConfiguration(MoveTemp(src.pfInstrumentationConfiguration)),
+            IsOSPreview(MoveTemp(src.IsOSPreview)),
+            Metadata(MoveTemp(src.Metadata)),
+            MultiplayerServerCountPerVm(MoveTemp(src.MultiplayerServerCountPerVm)),
+            OsPlatform(MoveTemp(src.OsPlatform)),
+            Ports(MoveTemp(src.Ports)),
+            RegionConfigurations(MoveTemp(src.RegionConfigurations)),
+            ServerType(MoveTemp(src.ServerType)),
+            StartMultiplayerServerCommand(MoveTemp(src.StartMultiplayerServerCommand)),
+            UseStreamingForAssetDownloads(MoveTemp(src.UseStreamingForAssetDownloads)),
+            VmSize(MoveTemp(src.VmSize))
+            {}
+
+        FCreateBuildWithProcessBasedServerResponse& operator=(const FCreateBuildWithProcessBasedServerResponse& src) = default;
+        FCreateBuildWithProcessBasedServerResponse& operator=(FCreateBuildWithProcessBasedServerResponse&& src) = default;
+
         FCreateBuildWithProcessBasedServerResponse(const TSharedPtr<FJsonObject>& obj) : FCreateBuildWithProcessBasedServerResponse()
         {
             readFromValue(obj);
@@ -2006,7 +2726,13 @@ namespace MultiplayerModels
         ~FCreateBuildWithProcessBasedServerResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMatchmakingPlayerAttributes : public PlayFab::FPlayFabCppBaseModel
@@ -2029,6 +2755,15 @@ namespace MultiplayerModels
             EscapedDataObject(src.EscapedDataObject)
             {}
 
+        FMatchmakingPlayerAttributes(FMatchmakingPlayerAttributes&& src) :
+            FPlayFabCppBaseModel(),
+            DataObject(MoveTemp(src.DataObject)),
+            EscapedDataObject(MoveTemp(src.EscapedDataObject))
+            {}
+
+        FMatchmakingPlayerAttributes& operator=(const FMatchmakingPlayerAttributes& src) = default;
+        FMatchmakingPlayerAttributes& operator=(FMatchmakingPlayerAttributes&& src) = default;
+
         FMatchmakingPlayerAttributes(const TSharedPtr<FJsonObject>& obj) : FMatchmakingPlayerAttributes()
         {
             readFromValue(obj);
@@ -2037,7 +2772,13 @@ namespace MultiplayerModels
         ~FMatchmakingPlayerAttributes();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMatchmakingPlayer : public PlayFab::FPlayFabCppBaseModel
@@ -2056,10 +2797,19 @@ namespace MultiplayerModels
 
         FMatchmakingPlayer(const FMatchmakingPlayer& src) :
             FPlayFabCppBaseModel(),
-            Attributes(src.Attributes.IsValid() ? MakeShareable(new FMatchmakingPlayerAttributes(*src.Attributes)) : nullptr),
+            Attributes(src.Attributes.IsValid() ? TSharedPtr<FMatchmakingPlayerAttributes>(MakeShared<FMatchmakingPlayerAttributes>(*src.Attributes)) : nullptr),
             Entity(src.Entity)
             {}
 
+        FMatchmakingPlayer(FMatchmakingPlayer&& src) :
+            FPlayFabCppBaseModel(),
+            Attributes(MoveTemp(src.Attributes)),
+            Entity(MoveTemp(src.Entity))
+            {}
+
+        FMatchmakingPlayer& operator=(const FMatchmakingPlayer& src) = default;
+        FMatchmakingPlayer& operator=(FMatchmakingPlayer&& src) = default;
+
         FMatchmakingPlayer(const TSharedPtr<FJsonObject>& obj) : FMatchmakingPlayer()
         {
             readFromValue(obj);
@@ -2068,7 +2818,13 @@ namespace MultiplayerModels
         ~FMatchmakingPlayer();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateMatchmakingTicketRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2104,6 +2860,18 @@ namespace MultiplayerModels
             QueueName(src.QueueName)
             {}
 
+        FCreateMatchmakingTicketRequest(FCreateMatchmakingTicketRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Creator(MoveTemp(src.Creator)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            GiveUpAfterSeconds(MoveTemp(src.GiveUpAfterSeconds)),
+            MembersToMatchWith(MoveTemp(src.MembersToMatchWith)),
+            QueueName(MoveTemp(src.QueueName))
+            {}
+
+        FCreateMatchmakingTicketRequest& operator=(const FCreateMatchmakingTicketRequest& src) = default;
+        FCreateMatchmakingTicketRequest& operator=(FCreateMatchmakingTicketRequest&& src) = default;
+
         FCreateMatchmakingTicketRequest(const TSharedPtr<FJsonObject>& obj) : FCreateMatchmakingTicketRequest()
         {
             readFromValue(obj);
@@ -2112,7 +2880,13 @@ namespace MultiplayerModels
         ~FCreateMatchmakingTicketRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateMatchmakingTicketResult : public PlayFab::FPlayFabCppResultCommon
@@ -2130,6 +2904,14 @@ namespace MultiplayerModels
             TicketId(src.TicketId)
             {}
 
+        FCreateMatchmakingTicketResult(FCreateMatchmakingTicketResult&& src) :
+            FPlayFabCppResultCommon(),
+            TicketId(MoveTemp(src.TicketId))
+            {}
+
+        FCreateMatchmakingTicketResult& operator=(const FCreateMatchmakingTicketResult& src) = default;
+        FCreateMatchmakingTicketResult& operator=(FCreateMatchmakingTicketResult&& src) = default;
+
         FCreateMatchmakingTicketResult(const TSharedPtr<FJsonObject>& obj) : FCreateMatchmakingTicketResult()
         {
             readFromValue(obj);
@@ -2138,7 +2920,13 @@ namespace MultiplayerModels
         ~FCreateMatchmakingTicketResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateRemoteUserRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2180,6 +2968,19 @@ namespace MultiplayerModels
             VmId(src.VmId)
             {}
 
+        FCreateRemoteUserRequest(FCreateRemoteUserRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildId(MoveTemp(src.BuildId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ExpirationTime(MoveTemp(src.ExpirationTime)),
+            Region(MoveTemp(src.Region)),
+            Username(MoveTemp(src.Username)),
+            VmId(MoveTemp(src.VmId))
+            {}
+
+        FCreateRemoteUserRequest& operator=(const FCreateRemoteUserRequest& src) = default;
+        FCreateRemoteUserRequest& operator=(FCreateRemoteUserRequest&& src) = default;
+
         FCreateRemoteUserRequest(const TSharedPtr<FJsonObject>& obj) : FCreateRemoteUserRequest()
         {
             readFromValue(obj);
@@ -2188,7 +2989,13 @@ namespace MultiplayerModels
         ~FCreateRemoteUserRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateRemoteUserResponse : public PlayFab::FPlayFabCppResultCommon
@@ -2216,6 +3023,16 @@ namespace MultiplayerModels
             Username(src.Username)
             {}
 
+        FCreateRemoteUserResponse(FCreateRemoteUserResponse&& src) :
+            FPlayFabCppResultCommon(),
+            ExpirationTime(MoveTemp(src.ExpirationTime)),
+            Password(MoveTemp(src.Password)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FCreateRemoteUserResponse& operator=(const FCreateRemoteUserResponse& src) = default;
+        FCreateRemoteUserResponse& operator=(FCreateRemoteUserResponse&& src) = default;
+
         FCreateRemoteUserResponse(const TSharedPtr<FJsonObject>& obj) : FCreateRemoteUserResponse()
         {
             readFromValue(obj);
@@ -2224,7 +3041,13 @@ namespace MultiplayerModels
         ~FCreateRemoteUserResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMatchmakingPlayerWithTeamAssignment : public PlayFab::FPlayFabCppBaseModel
@@ -2250,11 +3073,21 @@ namespace MultiplayerModels
 
         FMatchmakingPlayerWithTeamAssignment(const FMatchmakingPlayerWithTeamAssignment& src) :
             FPlayFabCppBaseModel(),
-            Attributes(src.Attributes.IsValid() ? MakeShareable(new FMatchmakingPlayerAttributes(*src.Attributes)) : nullptr),
+            Attributes(src.Attributes.IsValid() ? TSharedPtr<FMatchmakingPlayerAttributes>(MakeShared<FMatchmakingPlayerAttributes>(*src.Attributes)) : nullptr),
             Entity(src.Entity),
             TeamId(src.TeamId)
             {}
 
+        FMatchmakingPlayerWithTeamAssignment(FMatchmakingPlayerWithTeamAssignment&& src) :
+            FPlayFabCppBaseModel(),
+            Attributes(MoveTemp(src.Attributes)),
+            Entity(MoveTemp(src.Entity)),
+            TeamId(MoveTemp(src.TeamId))
+            {}
+
+        FMatchmakingPlayerWithTeamAssignment& operator=(const FMatchmakingPlayerWithTeamAssignment& src) = default;
+        FMatchmakingPlayerWithTeamAssignment& operator=(FMatchmakingPlayerWithTeamAssignment&& src) = default;
+
         FMatchmakingPlayerWithTeamAssignment(const TSharedPtr<FJsonObject>& obj) : FMatchmakingPlayerWithTeamAssignment()
         {
             readFromValue(obj);
@@ -2263,7 +3096,13 @@ namespace MultiplayerModels
         ~FMatchmakingPlayerWithTeamAssignment();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FServerDetails : public PlayFab::FPlayFabCppBaseModel
@@ -2295,6 +3134,17 @@ namespace MultiplayerModels
             Region(src.Region)
             {}
 
+        FServerDetails(FServerDetails&& src) :
+            FPlayFabCppBaseModel(),
+            Fqdn(MoveTemp(src.Fqdn)),
+            IPV4Address(MoveTemp(src.IPV4Address)),
+            Ports(MoveTemp(src.Ports)),
+            Region(MoveTemp(src.Region))
+            {}
+
+        FServerDetails& operator=(const FServerDetails& src) = default;
+        FServerDetails& operator=(FServerDetails&& src) = default;
+
         FServerDetails(const TSharedPtr<FJsonObject>& obj) : FServerDetails()
         {
             readFromValue(obj);
@@ -2303,7 +3153,13 @@ namespace MultiplayerModels
         ~FServerDetails();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateServerBackfillTicketRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2336,9 +3192,21 @@ namespace MultiplayerModels
             GiveUpAfterSeconds(src.GiveUpAfterSeconds),
             Members(src.Members),
             QueueName(src.QueueName),
-            pfServerDetails(src.pfServerDetails.IsValid() ? MakeShareable(new FServerDetails(*src.pfServerDetails)) : nullptr)
+            pfServerDetails(src.pfServerDetails.IsValid() ? TSharedPtr<FServerDetails>(MakeShared<FServerDetails>(*src.pfServerDetails)) : nullptr)
+            {}
+
+        FCreateServerBackfillTicketRequest(FCreateServerBackfillTicketRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            GiveUpAfterSeconds(MoveTemp(src.GiveUpAfterSeconds)),
+            Members(MoveTemp(src.Members)),
+            QueueName(MoveTemp(src.QueueName)),
+            pfServerDetails(MoveTemp(src.pfServerDetails))
             {}
 
+        FCreateServerBackfillTicketRequest& operator=(const FCreateServerBackfillTicketRequest& src) = default;
+        FCreateServerBackfillTicketRequest& operator=(FCreateServerBackfillTicketRequest&& src) = default;
+
         FCreateServerBackfillTicketRequest(const TSharedPtr<FJsonObject>& obj) : FCreateServerBackfillTicketRequest()
         {
             readFromValue(obj);
@@ -2347,7 +3215,13 @@ namespace MultiplayerModels
         ~FCreateServerBackfillTicketRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateServerBackfillTicketResult : public PlayFab::FPlayFabCppResultCommon
@@ -2365,6 +3239,14 @@ namespace MultiplayerModels
             TicketId(src.TicketId)
             {}
 
+        FCreateServerBackfillTicketResult(FCreateServerBackfillTicketResult&& src) :
+            FPlayFabCppResultCommon(),
+            TicketId(MoveTemp(src.TicketId))
+            {}
+
+        FCreateServerBackfillTicketResult& operator=(const FCreateServerBackfillTicketResult& src) = default;
+        FCreateServerBackfillTicketResult& operator=(FCreateServerBackfillTicketResult&& src) = default;
+
         FCreateServerBackfillTicketResult(const TSharedPtr<FJsonObject>& obj) : FCreateServerBackfillTicketResult()
         {
             readFromValue(obj);
@@ -2373,7 +3255,13 @@ namespace MultiplayerModels
         ~FCreateServerBackfillTicketResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateServerMatchmakingTicketRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2404,6 +3292,17 @@ namespace MultiplayerModels
             QueueName(src.QueueName)
             {}
 
+        FCreateServerMatchmakingTicketRequest(FCreateServerMatchmakingTicketRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            GiveUpAfterSeconds(MoveTemp(src.GiveUpAfterSeconds)),
+            Members(MoveTemp(src.Members)),
+            QueueName(MoveTemp(src.QueueName))
+            {}
+
+        FCreateServerMatchmakingTicketRequest& operator=(const FCreateServerMatchmakingTicketRequest& src) = default;
+        FCreateServerMatchmakingTicketRequest& operator=(FCreateServerMatchmakingTicketRequest&& src) = default;
+
         FCreateServerMatchmakingTicketRequest(const TSharedPtr<FJsonObject>& obj) : FCreateServerMatchmakingTicketRequest()
         {
             readFromValue(obj);
@@ -2412,7 +3311,13 @@ namespace MultiplayerModels
         ~FCreateServerMatchmakingTicketRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateTitleMultiplayerServersQuotaChangeRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2453,6 +3358,19 @@ namespace MultiplayerModels
             StartDate(src.StartDate)
             {}
 
+        FCreateTitleMultiplayerServersQuotaChangeRequest(FCreateTitleMultiplayerServersQuotaChangeRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ChangeDescription(MoveTemp(src.ChangeDescription)),
+            Changes(MoveTemp(src.Changes)),
+            ContactEmail(MoveTemp(src.ContactEmail)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Notes(MoveTemp(src.Notes)),
+            StartDate(MoveTemp(src.StartDate))
+            {}
+
+        FCreateTitleMultiplayerServersQuotaChangeRequest& operator=(const FCreateTitleMultiplayerServersQuotaChangeRequest& src) = default;
+        FCreateTitleMultiplayerServersQuotaChangeRequest& operator=(FCreateTitleMultiplayerServersQuotaChangeRequest&& src) = default;
+
         FCreateTitleMultiplayerServersQuotaChangeRequest(const TSharedPtr<FJsonObject>& obj) : FCreateTitleMultiplayerServersQuotaChangeRequest()
         {
             readFromValue(obj);
@@ -2461,7 +3379,13 @@ namespace MultiplayerModels
         ~FCreateTitleMultiplayerServersQuotaChangeRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateTitleMultiplayerServersQuotaChangeResponse : public PlayFab::FPlayFabCppResultCommon
@@ -2484,15 +3408,30 @@ namespace MultiplayerModels
             WasApproved(src.WasApproved)
             {}
 
-        FCreateTitleMultiplayerServersQuotaChangeResponse(const TSharedPtr<FJsonObject>& obj) : FCreateTitleMultiplayerServersQuotaChangeResponse()
-        {
-            readFromValue(obj);
+        FCreateTitleMultiplayerServersQuotaChangeResponse(FCreateTitleMultiplayerServersQuotaChangeResponse&& src) :
+            FPlayFabCppResultCommon(),
+            RequestId(MoveTemp(src.RequestId)),
+            WasApproved(MoveTemp(src.WasApproved))
+            {}
+
+        FCreateTitleMultiplayerServersQuotaChangeResponse& operator=(const FCreateTitleMultiplayerServersQuotaChangeResponse& src) = default;
+        FCreateTitleMultiplayerServersQuotaChangeResponse& operator=(FCreateTitleMultiplayerServersQuotaChangeResponse&& src) = default;
+
+        FCreateTitleMultiplayerServersQuotaChangeResponse(const TSharedPtr<FJsonObject>& obj) : FCreateTitleMultiplayerServersQuotaChangeResponse()
+        {
+            readFromValue(obj);
         }
 
         ~FCreateTitleMultiplayerServersQuotaChangeResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteAssetRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2514,6 +3453,15 @@ namespace MultiplayerModels
             FileName(src.FileName)
             {}
 
+        FDeleteAssetRequest(FDeleteAssetRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            FileName(MoveTemp(src.FileName))
+            {}
+
+        FDeleteAssetRequest& operator=(const FDeleteAssetRequest& src) = default;
+        FDeleteAssetRequest& operator=(FDeleteAssetRequest&& src) = default;
+
         FDeleteAssetRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteAssetRequest()
         {
             readFromValue(obj);
@@ -2522,7 +3470,13 @@ namespace MultiplayerModels
         ~FDeleteAssetRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteBuildAliasRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2544,6 +3498,15 @@ namespace MultiplayerModels
             CustomTags(src.CustomTags)
             {}
 
+        FDeleteBuildAliasRequest(FDeleteBuildAliasRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AliasId(MoveTemp(src.AliasId)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FDeleteBuildAliasRequest& operator=(const FDeleteBuildAliasRequest& src) = default;
+        FDeleteBuildAliasRequest& operator=(FDeleteBuildAliasRequest&& src) = default;
+
         FDeleteBuildAliasRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteBuildAliasRequest()
         {
             readFromValue(obj);
@@ -2552,7 +3515,13 @@ namespace MultiplayerModels
         ~FDeleteBuildAliasRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteBuildRegionRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2579,6 +3548,16 @@ namespace MultiplayerModels
             Region(src.Region)
             {}
 
+        FDeleteBuildRegionRequest(FDeleteBuildRegionRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildId(MoveTemp(src.BuildId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Region(MoveTemp(src.Region))
+            {}
+
+        FDeleteBuildRegionRequest& operator=(const FDeleteBuildRegionRequest& src) = default;
+        FDeleteBuildRegionRequest& operator=(FDeleteBuildRegionRequest&& src) = default;
+
         FDeleteBuildRegionRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteBuildRegionRequest()
         {
             readFromValue(obj);
@@ -2587,7 +3566,13 @@ namespace MultiplayerModels
         ~FDeleteBuildRegionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteBuildRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2609,6 +3594,15 @@ namespace MultiplayerModels
             CustomTags(src.CustomTags)
             {}
 
+        FDeleteBuildRequest(FDeleteBuildRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildId(MoveTemp(src.BuildId)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FDeleteBuildRequest& operator=(const FDeleteBuildRequest& src) = default;
+        FDeleteBuildRequest& operator=(FDeleteBuildRequest&& src) = default;
+
         FDeleteBuildRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteBuildRequest()
         {
             readFromValue(obj);
@@ -2617,7 +3611,13 @@ namespace MultiplayerModels
         ~FDeleteBuildRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteCertificateRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2639,6 +3639,15 @@ namespace MultiplayerModels
             Name(src.Name)
             {}
 
+        FDeleteCertificateRequest(FDeleteCertificateRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Name(MoveTemp(src.Name))
+            {}
+
+        FDeleteCertificateRequest& operator=(const FDeleteCertificateRequest& src) = default;
+        FDeleteCertificateRequest& operator=(FDeleteCertificateRequest&& src) = default;
+
         FDeleteCertificateRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteCertificateRequest()
         {
             readFromValue(obj);
@@ -2647,7 +3656,13 @@ namespace MultiplayerModels
         ~FDeleteCertificateRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteContainerImageRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2669,6 +3684,15 @@ namespace MultiplayerModels
             ImageName(src.ImageName)
             {}
 
+        FDeleteContainerImageRequest(FDeleteContainerImageRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ImageName(MoveTemp(src.ImageName))
+            {}
+
+        FDeleteContainerImageRequest& operator=(const FDeleteContainerImageRequest& src) = default;
+        FDeleteContainerImageRequest& operator=(FDeleteContainerImageRequest&& src) = default;
+
         FDeleteContainerImageRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteContainerImageRequest()
         {
             readFromValue(obj);
@@ -2677,7 +3701,13 @@ namespace MultiplayerModels
         ~FDeleteContainerImageRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteRemoteUserRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2714,6 +3744,18 @@ namespace MultiplayerModels
             VmId(src.VmId)
             {}
 
+        FDeleteRemoteUserRequest(FDeleteRemoteUserRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildId(MoveTemp(src.BuildId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Region(MoveTemp(src.Region)),
+            Username(MoveTemp(src.Username)),
+            VmId(MoveTemp(src.VmId))
+            {}
+
+        FDeleteRemoteUserRequest& operator=(const FDeleteRemoteUserRequest& src) = default;
+        FDeleteRemoteUserRequest& operator=(FDeleteRemoteUserRequest&& src) = default;
+
         FDeleteRemoteUserRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteRemoteUserRequest()
         {
             readFromValue(obj);
@@ -2722,7 +3764,13 @@ namespace MultiplayerModels
         ~FDeleteRemoteUserRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEmptyResponse : public PlayFab::FPlayFabCppResultCommon
@@ -2735,6 +3783,13 @@ namespace MultiplayerModels
             FPlayFabCppResultCommon()
             {}
 
+        FEmptyResponse(FEmptyResponse&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FEmptyResponse& operator=(const FEmptyResponse& src) = default;
+        FEmptyResponse& operator=(FEmptyResponse&& src) = default;
+
         FEmptyResponse(const TSharedPtr<FJsonObject>& obj) : FEmptyResponse()
         {
             readFromValue(obj);
@@ -2743,7 +3798,13 @@ namespace MultiplayerModels
         ~FEmptyResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEnableMultiplayerServersForTitleRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2760,6 +3821,14 @@ namespace MultiplayerModels
             CustomTags(src.CustomTags)
             {}
 
+        FEnableMultiplayerServersForTitleRequest(FEnableMultiplayerServersForTitleRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FEnableMultiplayerServersForTitleRequest& operator=(const FEnableMultiplayerServersForTitleRequest& src) = default;
+        FEnableMultiplayerServersForTitleRequest& operator=(FEnableMultiplayerServersForTitleRequest&& src) = default;
+
         FEnableMultiplayerServersForTitleRequest(const TSharedPtr<FJsonObject>& obj) : FEnableMultiplayerServersForTitleRequest()
         {
             readFromValue(obj);
@@ -2768,7 +3837,13 @@ namespace MultiplayerModels
         ~FEnableMultiplayerServersForTitleRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum TitleMultiplayerServerEnabledStatus
@@ -2779,6 +3854,7 @@ namespace MultiplayerModels
     };
 
     PLAYFABCPP_API void writeTitleMultiplayerServerEnabledStatusEnumJSON(TitleMultiplayerServerEnabledStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeTitleMultiplayerServerEnabledStatusEnumJSON(TitleMultiplayerServerEnabledStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API TitleMultiplayerServerEnabledStatus readTitleMultiplayerServerEnabledStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API TitleMultiplayerServerEnabledStatus readTitleMultiplayerServerEnabledStatusFromValue(const FString& value);
 
@@ -2797,6 +3873,14 @@ namespace MultiplayerModels
             Status(src.Status)
             {}
 
+        FEnableMultiplayerServersForTitleResponse(FEnableMultiplayerServersForTitleResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Status(MoveTemp(src.Status))
+            {}
+
+        FEnableMultiplayerServersForTitleResponse& operator=(const FEnableMultiplayerServersForTitleResponse& src) = default;
+        FEnableMultiplayerServersForTitleResponse& operator=(FEnableMultiplayerServersForTitleResponse&& src) = default;
+
         FEnableMultiplayerServersForTitleResponse(const TSharedPtr<FJsonObject>& obj) : FEnableMultiplayerServersForTitleResponse()
         {
             readFromValue(obj);
@@ -2805,7 +3889,13 @@ namespace MultiplayerModels
         ~FEnableMultiplayerServersForTitleResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetAssetUploadUrlRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2827,6 +3917,15 @@ namespace MultiplayerModels
             FileName(src.FileName)
             {}
 
+        FGetAssetUploadUrlRequest(FGetAssetUploadUrlRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            FileName(MoveTemp(src.FileName))
+            {}
+
+        FGetAssetUploadUrlRequest& operator=(const FGetAssetUploadUrlRequest& src) = default;
+        FGetAssetUploadUrlRequest& operator=(FGetAssetUploadUrlRequest&& src) = default;
+
         FGetAssetUploadUrlRequest(const TSharedPtr<FJsonObject>& obj) : FGetAssetUploadUrlRequest()
         {
             readFromValue(obj);
@@ -2835,7 +3934,13 @@ namespace MultiplayerModels
         ~FGetAssetUploadUrlRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetAssetUploadUrlResponse : public PlayFab::FPlayFabCppResultCommon
@@ -2858,6 +3963,15 @@ namespace MultiplayerModels
             FileName(src.FileName)
             {}
 
+        FGetAssetUploadUrlResponse(FGetAssetUploadUrlResponse&& src) :
+            FPlayFabCppResultCommon(),
+            AssetUploadUrl(MoveTemp(src.AssetUploadUrl)),
+            FileName(MoveTemp(src.FileName))
+            {}
+
+        FGetAssetUploadUrlResponse& operator=(const FGetAssetUploadUrlResponse& src) = default;
+        FGetAssetUploadUrlResponse& operator=(FGetAssetUploadUrlResponse&& src) = default;
+
         FGetAssetUploadUrlResponse(const TSharedPtr<FJsonObject>& obj) : FGetAssetUploadUrlResponse()
         {
             readFromValue(obj);
@@ -2866,7 +3980,13 @@ namespace MultiplayerModels
         ~FGetAssetUploadUrlResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetBuildAliasRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2888,6 +4008,15 @@ namespace MultiplayerModels
             CustomTags(src.CustomTags)
             {}
 
+        FGetBuildAliasRequest(FGetBuildAliasRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AliasId(MoveTemp(src.AliasId)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FGetBuildAliasRequest& operator=(const FGetBuildAliasRequest& src) = default;
+        FGetBuildAliasRequest& operator=(FGetBuildAliasRequest&& src) = default;
+
         FGetBuildAliasRequest(const TSharedPtr<FJsonObject>& obj) : FGetBuildAliasRequest()
         {
             readFromValue(obj);
@@ -2896,7 +4025,13 @@ namespace MultiplayerModels
         ~FGetBuildAliasRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetBuildRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2918,6 +4053,15 @@ namespace MultiplayerModels
             CustomTags(src.CustomTags)
             {}
 
+        FGetBuildRequest(FGetBuildRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildId(MoveTemp(src.BuildId)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FGetBuildRequest& operator=(const FGetBuildRequest& src) = default;
+        FGetBuildRequest& operator=(FGetBuildRequest&& src) = default;
+
         FGetBuildRequest(const TSharedPtr<FJsonObject>& obj) : FGetBuildRequest()
         {
             readFromValue(obj);
@@ -2926,7 +4070,13 @@ namespace MultiplayerModels
         ~FGetBuildRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetBuildResponse : public PlayFab::FPlayFabCppResultCommon
@@ -3034,10 +4184,10 @@ namespace MultiplayerModels
             pfContainerFlavor(src.pfContainerFlavor),
             ContainerRunCommand(src.ContainerRunCommand),
             CreationTime(src.CreationTime),
-            CustomGameContainerImage(src.CustomGameContainerImage.IsValid() ? MakeShareable(new FContainerImageReference(*src.CustomGameContainerImage)) : nullptr),
+            CustomGameContainerImage(src.CustomGameContainerImage.IsValid() ? TSharedPtr<FContainerImageReference>(MakeShared<FContainerImageReference>(*src.CustomGameContainerImage)) : nullptr),
             GameAssetReferences(src.GameAssetReferences),
             GameCertificateReferences(src.GameCertificateReferences),
-            pfInstrumentationConfiguration(src.pfInstrumentationConfiguration.IsValid() ? MakeShareable(new FInstrumentationConfiguration(*src.pfInstrumentationConfiguration)) : nullptr),
+            pfInstrumentationConfiguration(src.pfInstrumentationConfiguration.IsValid() ? TSharedPtr<FInstrumentationConfiguration>(MakeShared<FInstrumentationConfiguration>(*src.pfInstrumentationConfiguration)) : nullptr),
             Metadata(src.Metadata),
             MultiplayerServerCountPerVm(src.MultiplayerServerCountPerVm),
             OsPlatform(src.OsPlatform),
@@ -3049,6 +4199,33 @@ namespace MultiplayerModels
             VmSize(src.VmSize)
             {}
 
+        FGetBuildResponse(FGetBuildResponse&& src) :
+            FPlayFabCppResultCommon(),
+            AreAssetsReadonly(MoveTemp(src.AreAssetsReadonly)),
+            BuildId(MoveTemp(src.BuildId)),
+            BuildName(MoveTemp(src.BuildName)),
+            BuildStatus(MoveTemp(src.BuildStatus)),
+            pfContainerFlavor(MoveTemp(src.pfContainerFlavor)),
+            ContainerRunCommand(MoveTemp(src.ContainerRunCommand)),
+            CreationTime(MoveTemp(src.CreationTime)),
+            CustomGameContainerImage(MoveTemp(src.CustomGameContainerImage)),
+            GameAssetReferences(MoveTemp(src.GameAssetReferences)),
+            GameCertificateReferences(MoveTemp(src.GameCertificateReferences)),
+            pfInstrumentationConfiguration(MoveTemp(src.pfInstrumentationConfiguration)),
+            Metadata(MoveTemp(src.Metadata)),
+            MultiplayerServerCountPerVm(MoveTemp(src.MultiplayerServerCountPerVm)),
+            OsPlatform(MoveTemp(src.OsPlatform)),
+            Ports(MoveTemp(src.Ports)),
+            RegionConfigurations(MoveTemp(src.RegionConfigurations)),
+            ServerType(MoveTemp(src.ServerType)),
+            StartMultiplayerServerCommand(MoveTemp(src.StartMultiplayerServerCommand)),
+            UseStreamingForAssetDownloads(MoveTemp(src.UseStreamingForAssetDownloads)),
+            VmSize(MoveTemp(src.VmSize))
+            {}
+
+        FGetBuildResponse& operator=(const FGetBuildResponse& src) = default;
+        FGetBuildResponse& operator=(FGetBuildResponse&& src) = default;
+
         FGetBuildResponse(const TSharedPtr<FJsonObject>& obj) : FGetBuildResponse()
         {
             readFromValue(obj);
@@ -3057,7 +4234,13 @@ namespace MultiplayerModels
         ~FGetBuildResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetContainerRegistryCredentialsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3074,6 +4257,14 @@ namespace MultiplayerModels
             CustomTags(src.CustomTags)
             {}
 
+        FGetContainerRegistryCredentialsRequest(FGetContainerRegistryCredentialsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FGetContainerRegistryCredentialsRequest& operator=(const FGetContainerRegistryCredentialsRequest& src) = default;
+        FGetContainerRegistryCredentialsRequest& operator=(FGetContainerRegistryCredentialsRequest&& src) = default;
+
         FGetContainerRegistryCredentialsRequest(const TSharedPtr<FJsonObject>& obj) : FGetContainerRegistryCredentialsRequest()
         {
             readFromValue(obj);
@@ -3082,7 +4273,13 @@ namespace MultiplayerModels
         ~FGetContainerRegistryCredentialsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetContainerRegistryCredentialsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -3110,6 +4307,16 @@ namespace MultiplayerModels
             Username(src.Username)
             {}
 
+        FGetContainerRegistryCredentialsResponse(FGetContainerRegistryCredentialsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            DnsName(MoveTemp(src.DnsName)),
+            Password(MoveTemp(src.Password)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FGetContainerRegistryCredentialsResponse& operator=(const FGetContainerRegistryCredentialsResponse& src) = default;
+        FGetContainerRegistryCredentialsResponse& operator=(FGetContainerRegistryCredentialsResponse&& src) = default;
+
         FGetContainerRegistryCredentialsResponse(const TSharedPtr<FJsonObject>& obj) : FGetContainerRegistryCredentialsResponse()
         {
             readFromValue(obj);
@@ -3118,7 +4325,13 @@ namespace MultiplayerModels
         ~FGetContainerRegistryCredentialsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetMatchmakingTicketRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3153,6 +4366,17 @@ namespace MultiplayerModels
             TicketId(src.TicketId)
             {}
 
+        FGetMatchmakingTicketRequest(FGetMatchmakingTicketRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EscapeObject(MoveTemp(src.EscapeObject)),
+            QueueName(MoveTemp(src.QueueName)),
+            TicketId(MoveTemp(src.TicketId))
+            {}
+
+        FGetMatchmakingTicketRequest& operator=(const FGetMatchmakingTicketRequest& src) = default;
+        FGetMatchmakingTicketRequest& operator=(FGetMatchmakingTicketRequest&& src) = default;
+
         FGetMatchmakingTicketRequest(const TSharedPtr<FJsonObject>& obj) : FGetMatchmakingTicketRequest()
         {
             readFromValue(obj);
@@ -3161,7 +4385,13 @@ namespace MultiplayerModels
         ~FGetMatchmakingTicketRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetMatchmakingTicketResult : public PlayFab::FPlayFabCppResultCommon
@@ -3225,6 +4455,23 @@ namespace MultiplayerModels
             TicketId(src.TicketId)
             {}
 
+        FGetMatchmakingTicketResult(FGetMatchmakingTicketResult&& src) :
+            FPlayFabCppResultCommon(),
+            CancellationReasonString(MoveTemp(src.CancellationReasonString)),
+            Created(MoveTemp(src.Created)),
+            Creator(MoveTemp(src.Creator)),
+            GiveUpAfterSeconds(MoveTemp(src.GiveUpAfterSeconds)),
+            MatchId(MoveTemp(src.MatchId)),
+            Members(MoveTemp(src.Members)),
+            MembersToMatchWith(MoveTemp(src.MembersToMatchWith)),
+            QueueName(MoveTemp(src.QueueName)),
+            Status(MoveTemp(src.Status)),
+            TicketId(MoveTemp(src.TicketId))
+            {}
+
+        FGetMatchmakingTicketResult& operator=(const FGetMatchmakingTicketResult& src) = default;
+        FGetMatchmakingTicketResult& operator=(FGetMatchmakingTicketResult&& src) = default;
+
         FGetMatchmakingTicketResult(const TSharedPtr<FJsonObject>& obj) : FGetMatchmakingTicketResult()
         {
             readFromValue(obj);
@@ -3233,7 +4480,13 @@ namespace MultiplayerModels
         ~FGetMatchmakingTicketResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetMatchRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3273,6 +4526,18 @@ namespace MultiplayerModels
             ReturnMemberAttributes(src.ReturnMemberAttributes)
             {}
 
+        FGetMatchRequest(FGetMatchRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EscapeObject(MoveTemp(src.EscapeObject)),
+            MatchId(MoveTemp(src.MatchId)),
+            QueueName(MoveTemp(src.QueueName)),
+            ReturnMemberAttributes(MoveTemp(src.ReturnMemberAttributes))
+            {}
+
+        FGetMatchRequest& operator=(const FGetMatchRequest& src) = default;
+        FGetMatchRequest& operator=(FGetMatchRequest&& src) = default;
+
         FGetMatchRequest(const TSharedPtr<FJsonObject>& obj) : FGetMatchRequest()
         {
             readFromValue(obj);
@@ -3281,7 +4546,13 @@ namespace MultiplayerModels
         ~FGetMatchRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetMatchResult : public PlayFab::FPlayFabCppResultCommon
@@ -3312,9 +4583,20 @@ namespace MultiplayerModels
             MatchId(src.MatchId),
             Members(src.Members),
             RegionPreferences(src.RegionPreferences),
-            pfServerDetails(src.pfServerDetails.IsValid() ? MakeShareable(new FServerDetails(*src.pfServerDetails)) : nullptr)
+            pfServerDetails(src.pfServerDetails.IsValid() ? TSharedPtr<FServerDetails>(MakeShared<FServerDetails>(*src.pfServerDetails)) : nullptr)
+            {}
+
+        FGetMatchResult(FGetMatchResult&& src) :
+            FPlayFabCppResultCommon(),
+            MatchId(MoveTemp(src.MatchId)),
+            Members(MoveTemp(src.Members)),
+            RegionPreferences(MoveTemp(src.RegionPreferences)),
+            pfServerDetails(MoveTemp(src.pfServerDetails))
             {}
 
+        FGetMatchResult& operator=(const FGetMatchResult& src) = default;
+        FGetMatchResult& operator=(FGetMatchResult&& src) = default;
+
         FGetMatchResult(const TSharedPtr<FJsonObject>& obj) : FGetMatchResult()
         {
             readFromValue(obj);
@@ -3323,7 +4605,13 @@ namespace MultiplayerModels
         ~FGetMatchResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetMultiplayerServerDetailsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3358,6 +4646,17 @@ namespace MultiplayerModels
             SessionId(src.SessionId)
             {}
 
+        FGetMultiplayerServerDetailsRequest(FGetMultiplayerServerDetailsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildId(MoveTemp(src.BuildId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Region(MoveTemp(src.Region)),
+            SessionId(MoveTemp(src.SessionId))
+            {}
+
+        FGetMultiplayerServerDetailsRequest& operator=(const FGetMultiplayerServerDetailsRequest& src) = default;
+        FGetMultiplayerServerDetailsRequest& operator=(FGetMultiplayerServerDetailsRequest&& src) = default;
+
         FGetMultiplayerServerDetailsRequest(const TSharedPtr<FJsonObject>& obj) : FGetMultiplayerServerDetailsRequest()
         {
             readFromValue(obj);
@@ -3366,7 +4665,13 @@ namespace MultiplayerModels
         ~FGetMultiplayerServerDetailsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetMultiplayerServerDetailsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -3432,6 +4737,24 @@ namespace MultiplayerModels
             VmId(src.VmId)
             {}
 
+        FGetMultiplayerServerDetailsResponse(FGetMultiplayerServerDetailsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            BuildId(MoveTemp(src.BuildId)),
+            ConnectedPlayers(MoveTemp(src.ConnectedPlayers)),
+            FQDN(MoveTemp(src.FQDN)),
+            IPV4Address(MoveTemp(src.IPV4Address)),
+            LastStateTransitionTime(MoveTemp(src.LastStateTransitionTime)),
+            Ports(MoveTemp(src.Ports)),
+            Region(MoveTemp(src.Region)),
+            ServerId(MoveTemp(src.ServerId)),
+            SessionId(MoveTemp(src.SessionId)),
+            State(MoveTemp(src.State)),
+            VmId(MoveTemp(src.VmId))
+            {}
+
+        FGetMultiplayerServerDetailsResponse& operator=(const FGetMultiplayerServerDetailsResponse& src) = default;
+        FGetMultiplayerServerDetailsResponse& operator=(FGetMultiplayerServerDetailsResponse&& src) = default;
+
         FGetMultiplayerServerDetailsResponse(const TSharedPtr<FJsonObject>& obj) : FGetMultiplayerServerDetailsResponse()
         {
             readFromValue(obj);
@@ -3440,7 +4763,13 @@ namespace MultiplayerModels
         ~FGetMultiplayerServerDetailsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetMultiplayerServerLogsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3462,6 +4791,15 @@ namespace MultiplayerModels
             ServerId(src.ServerId)
             {}
 
+        FGetMultiplayerServerLogsRequest(FGetMultiplayerServerLogsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ServerId(MoveTemp(src.ServerId))
+            {}
+
+        FGetMultiplayerServerLogsRequest& operator=(const FGetMultiplayerServerLogsRequest& src) = default;
+        FGetMultiplayerServerLogsRequest& operator=(FGetMultiplayerServerLogsRequest&& src) = default;
+
         FGetMultiplayerServerLogsRequest(const TSharedPtr<FJsonObject>& obj) : FGetMultiplayerServerLogsRequest()
         {
             readFromValue(obj);
@@ -3470,7 +4808,13 @@ namespace MultiplayerModels
         ~FGetMultiplayerServerLogsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetMultiplayerServerLogsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -3488,6 +4832,14 @@ namespace MultiplayerModels
             LogDownloadUrl(src.LogDownloadUrl)
             {}
 
+        FGetMultiplayerServerLogsResponse(FGetMultiplayerServerLogsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            LogDownloadUrl(MoveTemp(src.LogDownloadUrl))
+            {}
+
+        FGetMultiplayerServerLogsResponse& operator=(const FGetMultiplayerServerLogsResponse& src) = default;
+        FGetMultiplayerServerLogsResponse& operator=(FGetMultiplayerServerLogsResponse&& src) = default;
+
         FGetMultiplayerServerLogsResponse(const TSharedPtr<FJsonObject>& obj) : FGetMultiplayerServerLogsResponse()
         {
             readFromValue(obj);
@@ -3496,7 +4848,13 @@ namespace MultiplayerModels
         ~FGetMultiplayerServerLogsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetMultiplayerSessionLogsBySessionIdRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3518,6 +4876,15 @@ namespace MultiplayerModels
             SessionId(src.SessionId)
             {}
 
+        FGetMultiplayerSessionLogsBySessionIdRequest(FGetMultiplayerSessionLogsBySessionIdRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            SessionId(MoveTemp(src.SessionId))
+            {}
+
+        FGetMultiplayerSessionLogsBySessionIdRequest& operator=(const FGetMultiplayerSessionLogsBySessionIdRequest& src) = default;
+        FGetMultiplayerSessionLogsBySessionIdRequest& operator=(FGetMultiplayerSessionLogsBySessionIdRequest&& src) = default;
+
         FGetMultiplayerSessionLogsBySessionIdRequest(const TSharedPtr<FJsonObject>& obj) : FGetMultiplayerSessionLogsBySessionIdRequest()
         {
             readFromValue(obj);
@@ -3526,7 +4893,13 @@ namespace MultiplayerModels
         ~FGetMultiplayerSessionLogsBySessionIdRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetQueueStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3548,6 +4921,15 @@ namespace MultiplayerModels
             QueueName(src.QueueName)
             {}
 
+        FGetQueueStatisticsRequest(FGetQueueStatisticsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            QueueName(MoveTemp(src.QueueName))
+            {}
+
+        FGetQueueStatisticsRequest& operator=(const FGetQueueStatisticsRequest& src) = default;
+        FGetQueueStatisticsRequest& operator=(FGetQueueStatisticsRequest&& src) = default;
+
         FGetQueueStatisticsRequest(const TSharedPtr<FJsonObject>& obj) : FGetQueueStatisticsRequest()
         {
             readFromValue(obj);
@@ -3556,7 +4938,13 @@ namespace MultiplayerModels
         ~FGetQueueStatisticsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStatistics : public PlayFab::FPlayFabCppBaseModel
@@ -3589,6 +4977,17 @@ namespace MultiplayerModels
             Percentile99(src.Percentile99)
             {}
 
+        FStatistics(FStatistics&& src) :
+            FPlayFabCppBaseModel(),
+            Average(MoveTemp(src.Average)),
+            Percentile50(MoveTemp(src.Percentile50)),
+            Percentile90(MoveTemp(src.Percentile90)),
+            Percentile99(MoveTemp(src.Percentile99))
+            {}
+
+        FStatistics& operator=(const FStatistics& src) = default;
+        FStatistics& operator=(FStatistics&& src) = default;
+
         FStatistics(const TSharedPtr<FJsonObject>& obj) : FStatistics()
         {
             readFromValue(obj);
@@ -3597,7 +4996,13 @@ namespace MultiplayerModels
         ~FStatistics();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetQueueStatisticsResult : public PlayFab::FPlayFabCppResultCommon
@@ -3617,9 +5022,18 @@ namespace MultiplayerModels
         FGetQueueStatisticsResult(const FGetQueueStatisticsResult& src) :
             FPlayFabCppResultCommon(),
             NumberOfPlayersMatching(src.NumberOfPlayersMatching),
-            TimeToMatchStatisticsInSeconds(src.TimeToMatchStatisticsInSeconds.IsValid() ? MakeShareable(new FStatistics(*src.TimeToMatchStatisticsInSeconds)) : nullptr)
+            TimeToMatchStatisticsInSeconds(src.TimeToMatchStatisticsInSeconds.IsValid() ? TSharedPtr<FStatistics>(MakeShared<FStatistics>(*src.TimeToMatchStatisticsInSeconds)) : nullptr)
             {}
 
+        FGetQueueStatisticsResult(FGetQueueStatisticsResult&& src) :
+            FPlayFabCppResultCommon(),
+            NumberOfPlayersMatching(MoveTemp(src.NumberOfPlayersMatching)),
+            TimeToMatchStatisticsInSeconds(MoveTemp(src.TimeToMatchStatisticsInSeconds))
+            {}
+
+        FGetQueueStatisticsResult& operator=(const FGetQueueStatisticsResult& src) = default;
+        FGetQueueStatisticsResult& operator=(FGetQueueStatisticsResult&& src) = default;
+
         FGetQueueStatisticsResult(const TSharedPtr<FJsonObject>& obj) : FGetQueueStatisticsResult()
         {
             readFromValue(obj);
@@ -3628,7 +5042,13 @@ namespace MultiplayerModels
         ~FGetQueueStatisticsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetRemoteLoginEndpointRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3660,6 +5080,17 @@ namespace MultiplayerModels
             VmId(src.VmId)
             {}
 
+        FGetRemoteLoginEndpointRequest(FGetRemoteLoginEndpointRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildId(MoveTemp(src.BuildId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Region(MoveTemp(src.Region)),
+            VmId(MoveTemp(src.VmId))
+            {}
+
+        FGetRemoteLoginEndpointRequest& operator=(const FGetRemoteLoginEndpointRequest& src) = default;
+        FGetRemoteLoginEndpointRequest& operator=(FGetRemoteLoginEndpointRequest&& src) = default;
+
         FGetRemoteLoginEndpointRequest(const TSharedPtr<FJsonObject>& obj) : FGetRemoteLoginEndpointRequest()
         {
             readFromValue(obj);
@@ -3668,7 +5099,13 @@ namespace MultiplayerModels
         ~FGetRemoteLoginEndpointRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetRemoteLoginEndpointResponse : public PlayFab::FPlayFabCppResultCommon
@@ -3691,6 +5128,15 @@ namespace MultiplayerModels
             Port(src.Port)
             {}
 
+        FGetRemoteLoginEndpointResponse(FGetRemoteLoginEndpointResponse&& src) :
+            FPlayFabCppResultCommon(),
+            IPV4Address(MoveTemp(src.IPV4Address)),
+            Port(MoveTemp(src.Port))
+            {}
+
+        FGetRemoteLoginEndpointResponse& operator=(const FGetRemoteLoginEndpointResponse& src) = default;
+        FGetRemoteLoginEndpointResponse& operator=(FGetRemoteLoginEndpointResponse&& src) = default;
+
         FGetRemoteLoginEndpointResponse(const TSharedPtr<FJsonObject>& obj) : FGetRemoteLoginEndpointResponse()
         {
             readFromValue(obj);
@@ -3699,7 +5145,13 @@ namespace MultiplayerModels
         ~FGetRemoteLoginEndpointResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetServerBackfillTicketRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3734,6 +5186,17 @@ namespace MultiplayerModels
             TicketId(src.TicketId)
             {}
 
+        FGetServerBackfillTicketRequest(FGetServerBackfillTicketRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EscapeObject(MoveTemp(src.EscapeObject)),
+            QueueName(MoveTemp(src.QueueName)),
+            TicketId(MoveTemp(src.TicketId))
+            {}
+
+        FGetServerBackfillTicketRequest& operator=(const FGetServerBackfillTicketRequest& src) = default;
+        FGetServerBackfillTicketRequest& operator=(FGetServerBackfillTicketRequest&& src) = default;
+
         FGetServerBackfillTicketRequest(const TSharedPtr<FJsonObject>& obj) : FGetServerBackfillTicketRequest()
         {
             readFromValue(obj);
@@ -3742,7 +5205,13 @@ namespace MultiplayerModels
         ~FGetServerBackfillTicketRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetServerBackfillTicketResult : public PlayFab::FPlayFabCppResultCommon
@@ -3799,6 +5268,22 @@ namespace MultiplayerModels
             TicketId(src.TicketId)
             {}
 
+        FGetServerBackfillTicketResult(FGetServerBackfillTicketResult&& src) :
+            FPlayFabCppResultCommon(),
+            CancellationReasonString(MoveTemp(src.CancellationReasonString)),
+            Created(MoveTemp(src.Created)),
+            GiveUpAfterSeconds(MoveTemp(src.GiveUpAfterSeconds)),
+            MatchId(MoveTemp(src.MatchId)),
+            Members(MoveTemp(src.Members)),
+            QueueName(MoveTemp(src.QueueName)),
+            pfServerDetails(MoveTemp(src.pfServerDetails)),
+            Status(MoveTemp(src.Status)),
+            TicketId(MoveTemp(src.TicketId))
+            {}
+
+        FGetServerBackfillTicketResult& operator=(const FGetServerBackfillTicketResult& src) = default;
+        FGetServerBackfillTicketResult& operator=(FGetServerBackfillTicketResult&& src) = default;
+
         FGetServerBackfillTicketResult(const TSharedPtr<FJsonObject>& obj) : FGetServerBackfillTicketResult()
         {
             readFromValue(obj);
@@ -3807,7 +5292,13 @@ namespace MultiplayerModels
         ~FGetServerBackfillTicketResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleEnabledForMultiplayerServersStatusRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3824,6 +5315,14 @@ namespace MultiplayerModels
             CustomTags(src.CustomTags)
             {}
 
+        FGetTitleEnabledForMultiplayerServersStatusRequest(FGetTitleEnabledForMultiplayerServersStatusRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FGetTitleEnabledForMultiplayerServersStatusRequest& operator=(const FGetTitleEnabledForMultiplayerServersStatusRequest& src) = default;
+        FGetTitleEnabledForMultiplayerServersStatusRequest& operator=(FGetTitleEnabledForMultiplayerServersStatusRequest&& src) = default;
+
         FGetTitleEnabledForMultiplayerServersStatusRequest(const TSharedPtr<FJsonObject>& obj) : FGetTitleEnabledForMultiplayerServersStatusRequest()
         {
             readFromValue(obj);
@@ -3832,7 +5331,13 @@ namespace MultiplayerModels
         ~FGetTitleEnabledForMultiplayerServersStatusRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleEnabledForMultiplayerServersStatusResponse : public PlayFab::FPlayFabCppResultCommon
@@ -3850,6 +5355,14 @@ namespace MultiplayerModels
             Status(src.Status)
             {}
 
+        FGetTitleEnabledForMultiplayerServersStatusResponse(FGetTitleEnabledForMultiplayerServersStatusResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Status(MoveTemp(src.Status))
+            {}
+
+        FGetTitleEnabledForMultiplayerServersStatusResponse& operator=(const FGetTitleEnabledForMultiplayerServersStatusResponse& src) = default;
+        FGetTitleEnabledForMultiplayerServersStatusResponse& operator=(FGetTitleEnabledForMultiplayerServersStatusResponse&& src) = default;
+
         FGetTitleEnabledForMultiplayerServersStatusResponse(const TSharedPtr<FJsonObject>& obj) : FGetTitleEnabledForMultiplayerServersStatusResponse()
         {
             readFromValue(obj);
@@ -3858,7 +5371,13 @@ namespace MultiplayerModels
         ~FGetTitleEnabledForMultiplayerServersStatusResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleMultiplayerServersQuotaChangeRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3880,6 +5399,15 @@ namespace MultiplayerModels
             RequestId(src.RequestId)
             {}
 
+        FGetTitleMultiplayerServersQuotaChangeRequest(FGetTitleMultiplayerServersQuotaChangeRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            RequestId(MoveTemp(src.RequestId))
+            {}
+
+        FGetTitleMultiplayerServersQuotaChangeRequest& operator=(const FGetTitleMultiplayerServersQuotaChangeRequest& src) = default;
+        FGetTitleMultiplayerServersQuotaChangeRequest& operator=(FGetTitleMultiplayerServersQuotaChangeRequest&& src) = default;
+
         FGetTitleMultiplayerServersQuotaChangeRequest(const TSharedPtr<FJsonObject>& obj) : FGetTitleMultiplayerServersQuotaChangeRequest()
         {
             readFromValue(obj);
@@ -3888,7 +5416,13 @@ namespace MultiplayerModels
         ~FGetTitleMultiplayerServersQuotaChangeRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FQuotaChange : public PlayFab::FPlayFabCppBaseModel
@@ -3935,6 +5469,20 @@ namespace MultiplayerModels
             WasApproved(src.WasApproved)
             {}
 
+        FQuotaChange(FQuotaChange&& src) :
+            FPlayFabCppBaseModel(),
+            ChangeDescription(MoveTemp(src.ChangeDescription)),
+            Changes(MoveTemp(src.Changes)),
+            IsPendingReview(MoveTemp(src.IsPendingReview)),
+            Notes(MoveTemp(src.Notes)),
+            RequestId(MoveTemp(src.RequestId)),
+            ReviewComments(MoveTemp(src.ReviewComments)),
+            WasApproved(MoveTemp(src.WasApproved))
+            {}
+
+        FQuotaChange& operator=(const FQuotaChange& src) = default;
+        FQuotaChange& operator=(FQuotaChange&& src) = default;
+
         FQuotaChange(const TSharedPtr<FJsonObject>& obj) : FQuotaChange()
         {
             readFromValue(obj);
@@ -3943,7 +5491,13 @@ namespace MultiplayerModels
         ~FQuotaChange();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleMultiplayerServersQuotaChangeResponse : public PlayFab::FPlayFabCppResultCommon
@@ -3958,9 +5512,17 @@ namespace MultiplayerModels
 
         FGetTitleMultiplayerServersQuotaChangeResponse(const FGetTitleMultiplayerServersQuotaChangeResponse& src) :
             FPlayFabCppResultCommon(),
-            Change(src.Change.IsValid() ? MakeShareable(new FQuotaChange(*src.Change)) : nullptr)
+            Change(src.Change.IsValid() ? TSharedPtr<FQuotaChange>(MakeShared<FQuotaChange>(*src.Change)) : nullptr)
             {}
 
+        FGetTitleMultiplayerServersQuotaChangeResponse(FGetTitleMultiplayerServersQuotaChangeResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Change(MoveTemp(src.Change))
+            {}
+
+        FGetTitleMultiplayerServersQuotaChangeResponse& operator=(const FGetTitleMultiplayerServersQuotaChangeResponse& src) = default;
+        FGetTitleMultiplayerServersQuotaChangeResponse& operator=(FGetTitleMultiplayerServersQuotaChangeResponse&& src) = default;
+
         FGetTitleMultiplayerServersQuotaChangeResponse(const TSharedPtr<FJsonObject>& obj) : FGetTitleMultiplayerServersQuotaChangeResponse()
         {
             readFromValue(obj);
@@ -3969,7 +5531,13 @@ namespace MultiplayerModels
         ~FGetTitleMultiplayerServersQuotaChangeResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleMultiplayerServersQuotasRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3986,6 +5554,14 @@ namespace MultiplayerModels
             CustomTags(src.CustomTags)
             {}
 
+        FGetTitleMultiplayerServersQuotasRequest(FGetTitleMultiplayerServersQuotasRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FGetTitleMultiplayerServersQuotasRequest& operator=(const FGetTitleMultiplayerServersQuotasRequest& src) = default;
+        FGetTitleMultiplayerServersQuotasRequest& operator=(FGetTitleMultiplayerServersQuotasRequest&& src) = default;
+
         FGetTitleMultiplayerServersQuotasRequest(const TSharedPtr<FJsonObject>& obj) : FGetTitleMultiplayerServersQuotasRequest()
         {
             readFromValue(obj);
@@ -3994,7 +5570,13 @@ namespace MultiplayerModels
         ~FGetTitleMultiplayerServersQuotasRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FTitleMultiplayerServersQuotas : public PlayFab::FPlayFabCppBaseModel
@@ -4011,6 +5593,14 @@ namespace MultiplayerModels
             CoreCapacities(src.CoreCapacities)
             {}
 
+        FTitleMultiplayerServersQuotas(FTitleMultiplayerServersQuotas&& src) :
+            FPlayFabCppBaseModel(),
+            CoreCapacities(MoveTemp(src.CoreCapacities))
+            {}
+
+        FTitleMultiplayerServersQuotas& operator=(const FTitleMultiplayerServersQuotas& src) = default;
+        FTitleMultiplayerServersQuotas& operator=(FTitleMultiplayerServersQuotas&& src) = default;
+
         FTitleMultiplayerServersQuotas(const TSharedPtr<FJsonObject>& obj) : FTitleMultiplayerServersQuotas()
         {
             readFromValue(obj);
@@ -4019,7 +5609,13 @@ namespace MultiplayerModels
         ~FTitleMultiplayerServersQuotas();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleMultiplayerServersQuotasResponse : public PlayFab::FPlayFabCppResultCommon
@@ -4034,9 +5630,17 @@ namespace MultiplayerModels
 
         FGetTitleMultiplayerServersQuotasResponse(const FGetTitleMultiplayerServersQuotasResponse& src) :
             FPlayFabCppResultCommon(),
-            Quotas(src.Quotas.IsValid() ? MakeShareable(new FTitleMultiplayerServersQuotas(*src.Quotas)) : nullptr)
+            Quotas(src.Quotas.IsValid() ? TSharedPtr<FTitleMultiplayerServersQuotas>(MakeShared<FTitleMultiplayerServersQuotas>(*src.Quotas)) : nullptr)
+            {}
+
+        FGetTitleMultiplayerServersQuotasResponse(FGetTitleMultiplayerServersQuotasResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Quotas(MoveTemp(src.Quotas))
             {}
 
+        FGetTitleMultiplayerServersQuotasResponse& operator=(const FGetTitleMultiplayerServersQuotasResponse& src) = default;
+        FGetTitleMultiplayerServersQuotasResponse& operator=(FGetTitleMultiplayerServersQuotasResponse&& src) = default;
+
         FGetTitleMultiplayerServersQuotasResponse(const TSharedPtr<FJsonObject>& obj) : FGetTitleMultiplayerServersQuotasResponse()
         {
             readFromValue(obj);
@@ -4045,7 +5649,13 @@ namespace MultiplayerModels
         ~FGetTitleMultiplayerServersQuotasResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FJoinMatchmakingTicketRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4077,6 +5687,17 @@ namespace MultiplayerModels
             TicketId(src.TicketId)
             {}
 
+        FJoinMatchmakingTicketRequest(FJoinMatchmakingTicketRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Member(MoveTemp(src.Member)),
+            QueueName(MoveTemp(src.QueueName)),
+            TicketId(MoveTemp(src.TicketId))
+            {}
+
+        FJoinMatchmakingTicketRequest& operator=(const FJoinMatchmakingTicketRequest& src) = default;
+        FJoinMatchmakingTicketRequest& operator=(FJoinMatchmakingTicketRequest&& src) = default;
+
         FJoinMatchmakingTicketRequest(const TSharedPtr<FJsonObject>& obj) : FJoinMatchmakingTicketRequest()
         {
             readFromValue(obj);
@@ -4085,7 +5706,13 @@ namespace MultiplayerModels
         ~FJoinMatchmakingTicketRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FJoinMatchmakingTicketResult : public PlayFab::FPlayFabCppResultCommon
@@ -4098,6 +5725,13 @@ namespace MultiplayerModels
             FPlayFabCppResultCommon()
             {}
 
+        FJoinMatchmakingTicketResult(FJoinMatchmakingTicketResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FJoinMatchmakingTicketResult& operator=(const FJoinMatchmakingTicketResult& src) = default;
+        FJoinMatchmakingTicketResult& operator=(FJoinMatchmakingTicketResult&& src) = default;
+
         FJoinMatchmakingTicketResult(const TSharedPtr<FJsonObject>& obj) : FJoinMatchmakingTicketResult()
         {
             readFromValue(obj);
@@ -4106,7 +5740,13 @@ namespace MultiplayerModels
         ~FJoinMatchmakingTicketResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListAssetSummariesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4133,6 +5773,16 @@ namespace MultiplayerModels
             SkipToken(src.SkipToken)
             {}
 
+        FListAssetSummariesRequest(FListAssetSummariesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PageSize(MoveTemp(src.PageSize)),
+            SkipToken(MoveTemp(src.SkipToken))
+            {}
+
+        FListAssetSummariesRequest& operator=(const FListAssetSummariesRequest& src) = default;
+        FListAssetSummariesRequest& operator=(FListAssetSummariesRequest&& src) = default;
+
         FListAssetSummariesRequest(const TSharedPtr<FJsonObject>& obj) : FListAssetSummariesRequest()
         {
             readFromValue(obj);
@@ -4141,7 +5791,13 @@ namespace MultiplayerModels
         ~FListAssetSummariesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListAssetSummariesResponse : public PlayFab::FPlayFabCppResultCommon
@@ -4168,6 +5824,16 @@ namespace MultiplayerModels
             SkipToken(src.SkipToken)
             {}
 
+        FListAssetSummariesResponse(FListAssetSummariesResponse&& src) :
+            FPlayFabCppResultCommon(),
+            AssetSummaries(MoveTemp(src.AssetSummaries)),
+            PageSize(MoveTemp(src.PageSize)),
+            SkipToken(MoveTemp(src.SkipToken))
+            {}
+
+        FListAssetSummariesResponse& operator=(const FListAssetSummariesResponse& src) = default;
+        FListAssetSummariesResponse& operator=(FListAssetSummariesResponse&& src) = default;
+
         FListAssetSummariesResponse(const TSharedPtr<FJsonObject>& obj) : FListAssetSummariesResponse()
         {
             readFromValue(obj);
@@ -4176,7 +5842,13 @@ namespace MultiplayerModels
         ~FListAssetSummariesResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListBuildAliasesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4203,6 +5875,16 @@ namespace MultiplayerModels
             SkipToken(src.SkipToken)
             {}
 
+        FListBuildAliasesRequest(FListBuildAliasesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PageSize(MoveTemp(src.PageSize)),
+            SkipToken(MoveTemp(src.SkipToken))
+            {}
+
+        FListBuildAliasesRequest& operator=(const FListBuildAliasesRequest& src) = default;
+        FListBuildAliasesRequest& operator=(FListBuildAliasesRequest&& src) = default;
+
         FListBuildAliasesRequest(const TSharedPtr<FJsonObject>& obj) : FListBuildAliasesRequest()
         {
             readFromValue(obj);
@@ -4211,7 +5893,13 @@ namespace MultiplayerModels
         ~FListBuildAliasesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListBuildAliasesResponse : public PlayFab::FPlayFabCppResultCommon
@@ -4238,6 +5926,16 @@ namespace MultiplayerModels
             SkipToken(src.SkipToken)
             {}
 
+        FListBuildAliasesResponse(FListBuildAliasesResponse&& src) :
+            FPlayFabCppResultCommon(),
+            BuildAliases(MoveTemp(src.BuildAliases)),
+            PageSize(MoveTemp(src.PageSize)),
+            SkipToken(MoveTemp(src.SkipToken))
+            {}
+
+        FListBuildAliasesResponse& operator=(const FListBuildAliasesResponse& src) = default;
+        FListBuildAliasesResponse& operator=(FListBuildAliasesResponse&& src) = default;
+
         FListBuildAliasesResponse(const TSharedPtr<FJsonObject>& obj) : FListBuildAliasesResponse()
         {
             readFromValue(obj);
@@ -4246,7 +5944,13 @@ namespace MultiplayerModels
         ~FListBuildAliasesResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListBuildSummariesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4273,6 +5977,16 @@ namespace MultiplayerModels
             SkipToken(src.SkipToken)
             {}
 
+        FListBuildSummariesRequest(FListBuildSummariesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PageSize(MoveTemp(src.PageSize)),
+            SkipToken(MoveTemp(src.SkipToken))
+            {}
+
+        FListBuildSummariesRequest& operator=(const FListBuildSummariesRequest& src) = default;
+        FListBuildSummariesRequest& operator=(FListBuildSummariesRequest&& src) = default;
+
         FListBuildSummariesRequest(const TSharedPtr<FJsonObject>& obj) : FListBuildSummariesRequest()
         {
             readFromValue(obj);
@@ -4281,7 +5995,13 @@ namespace MultiplayerModels
         ~FListBuildSummariesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListBuildSummariesResponse : public PlayFab::FPlayFabCppResultCommon
@@ -4308,6 +6028,16 @@ namespace MultiplayerModels
             SkipToken(src.SkipToken)
             {}
 
+        FListBuildSummariesResponse(FListBuildSummariesResponse&& src) :
+            FPlayFabCppResultCommon(),
+            BuildSummaries(MoveTemp(src.BuildSummaries)),
+            PageSize(MoveTemp(src.PageSize)),
+            SkipToken(MoveTemp(src.SkipToken))
+            {}
+
+        FListBuildSummariesResponse& operator=(const FListBuildSummariesResponse& src) = default;
+        FListBuildSummariesResponse& operator=(FListBuildSummariesResponse&& src) = default;
+
         FListBuildSummariesResponse(const TSharedPtr<FJsonObject>& obj) : FListBuildSummariesResponse()
         {
             readFromValue(obj);
@@ -4316,7 +6046,13 @@ namespace MultiplayerModels
         ~FListBuildSummariesResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListCertificateSummariesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4343,6 +6079,16 @@ namespace MultiplayerModels
             SkipToken(src.SkipToken)
             {}
 
+        FListCertificateSummariesRequest(FListCertificateSummariesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PageSize(MoveTemp(src.PageSize)),
+            SkipToken(MoveTemp(src.SkipToken))
+            {}
+
+        FListCertificateSummariesRequest& operator=(const FListCertificateSummariesRequest& src) = default;
+        FListCertificateSummariesRequest& operator=(FListCertificateSummariesRequest&& src) = default;
+
         FListCertificateSummariesRequest(const TSharedPtr<FJsonObject>& obj) : FListCertificateSummariesRequest()
         {
             readFromValue(obj);
@@ -4351,7 +6097,13 @@ namespace MultiplayerModels
         ~FListCertificateSummariesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListCertificateSummariesResponse : public PlayFab::FPlayFabCppResultCommon
@@ -4378,6 +6130,16 @@ namespace MultiplayerModels
             SkipToken(src.SkipToken)
             {}
 
+        FListCertificateSummariesResponse(FListCertificateSummariesResponse&& src) :
+            FPlayFabCppResultCommon(),
+            CertificateSummaries(MoveTemp(src.CertificateSummaries)),
+            PageSize(MoveTemp(src.PageSize)),
+            SkipToken(MoveTemp(src.SkipToken))
+            {}
+
+        FListCertificateSummariesResponse& operator=(const FListCertificateSummariesResponse& src) = default;
+        FListCertificateSummariesResponse& operator=(FListCertificateSummariesResponse&& src) = default;
+
         FListCertificateSummariesResponse(const TSharedPtr<FJsonObject>& obj) : FListCertificateSummariesResponse()
         {
             readFromValue(obj);
@@ -4386,7 +6148,13 @@ namespace MultiplayerModels
         ~FListCertificateSummariesResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListContainerImagesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4413,6 +6181,16 @@ namespace MultiplayerModels
             SkipToken(src.SkipToken)
             {}
 
+        FListContainerImagesRequest(FListContainerImagesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PageSize(MoveTemp(src.PageSize)),
+            SkipToken(MoveTemp(src.SkipToken))
+            {}
+
+        FListContainerImagesRequest& operator=(const FListContainerImagesRequest& src) = default;
+        FListContainerImagesRequest& operator=(FListContainerImagesRequest&& src) = default;
+
         FListContainerImagesRequest(const TSharedPtr<FJsonObject>& obj) : FListContainerImagesRequest()
         {
             readFromValue(obj);
@@ -4421,7 +6199,13 @@ namespace MultiplayerModels
         ~FListContainerImagesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListContainerImagesResponse : public PlayFab::FPlayFabCppResultCommon
@@ -4448,6 +6232,16 @@ namespace MultiplayerModels
             SkipToken(src.SkipToken)
             {}
 
+        FListContainerImagesResponse(FListContainerImagesResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Images(MoveTemp(src.Images)),
+            PageSize(MoveTemp(src.PageSize)),
+            SkipToken(MoveTemp(src.SkipToken))
+            {}
+
+        FListContainerImagesResponse& operator=(const FListContainerImagesResponse& src) = default;
+        FListContainerImagesResponse& operator=(FListContainerImagesResponse&& src) = default;
+
         FListContainerImagesResponse(const TSharedPtr<FJsonObject>& obj) : FListContainerImagesResponse()
         {
             readFromValue(obj);
@@ -4456,7 +6250,13 @@ namespace MultiplayerModels
         ~FListContainerImagesResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListContainerImageTagsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4478,6 +6278,15 @@ namespace MultiplayerModels
             ImageName(src.ImageName)
             {}
 
+        FListContainerImageTagsRequest(FListContainerImageTagsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ImageName(MoveTemp(src.ImageName))
+            {}
+
+        FListContainerImageTagsRequest& operator=(const FListContainerImageTagsRequest& src) = default;
+        FListContainerImageTagsRequest& operator=(FListContainerImageTagsRequest&& src) = default;
+
         FListContainerImageTagsRequest(const TSharedPtr<FJsonObject>& obj) : FListContainerImageTagsRequest()
         {
             readFromValue(obj);
@@ -4486,7 +6295,13 @@ namespace MultiplayerModels
         ~FListContainerImageTagsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListContainerImageTagsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -4503,6 +6318,14 @@ namespace MultiplayerModels
             Tags(src.Tags)
             {}
 
+        FListContainerImageTagsResponse(FListContainerImageTagsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Tags(MoveTemp(src.Tags))
+            {}
+
+        FListContainerImageTagsResponse& operator=(const FListContainerImageTagsResponse& src) = default;
+        FListContainerImageTagsResponse& operator=(FListContainerImageTagsResponse&& src) = default;
+
         FListContainerImageTagsResponse(const TSharedPtr<FJsonObject>& obj) : FListContainerImageTagsResponse()
         {
             readFromValue(obj);
@@ -4511,7 +6334,13 @@ namespace MultiplayerModels
         ~FListContainerImageTagsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListMatchmakingTicketsForPlayerRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4534,10 +6363,20 @@ namespace MultiplayerModels
         FListMatchmakingTicketsForPlayerRequest(const FListMatchmakingTicketsForPlayerRequest& src) :
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             QueueName(src.QueueName)
             {}
 
+        FListMatchmakingTicketsForPlayerRequest(FListMatchmakingTicketsForPlayerRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            QueueName(MoveTemp(src.QueueName))
+            {}
+
+        FListMatchmakingTicketsForPlayerRequest& operator=(const FListMatchmakingTicketsForPlayerRequest& src) = default;
+        FListMatchmakingTicketsForPlayerRequest& operator=(FListMatchmakingTicketsForPlayerRequest&& src) = default;
+
         FListMatchmakingTicketsForPlayerRequest(const TSharedPtr<FJsonObject>& obj) : FListMatchmakingTicketsForPlayerRequest()
         {
             readFromValue(obj);
@@ -4546,7 +6385,13 @@ namespace MultiplayerModels
         ~FListMatchmakingTicketsForPlayerRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListMatchmakingTicketsForPlayerResult : public PlayFab::FPlayFabCppResultCommon
@@ -4563,6 +6408,14 @@ namespace MultiplayerModels
             TicketIds(src.TicketIds)
             {}
 
+        FListMatchmakingTicketsForPlayerResult(FListMatchmakingTicketsForPlayerResult&& src) :
+            FPlayFabCppResultCommon(),
+            TicketIds(MoveTemp(src.TicketIds))
+            {}
+
+        FListMatchmakingTicketsForPlayerResult& operator=(const FListMatchmakingTicketsForPlayerResult& src) = default;
+        FListMatchmakingTicketsForPlayerResult& operator=(FListMatchmakingTicketsForPlayerResult&& src) = default;
+
         FListMatchmakingTicketsForPlayerResult(const TSharedPtr<FJsonObject>& obj) : FListMatchmakingTicketsForPlayerResult()
         {
             readFromValue(obj);
@@ -4571,7 +6424,13 @@ namespace MultiplayerModels
         ~FListMatchmakingTicketsForPlayerResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListMultiplayerServersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4608,6 +6467,18 @@ namespace MultiplayerModels
             SkipToken(src.SkipToken)
             {}
 
+        FListMultiplayerServersRequest(FListMultiplayerServersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildId(MoveTemp(src.BuildId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PageSize(MoveTemp(src.PageSize)),
+            Region(MoveTemp(src.Region)),
+            SkipToken(MoveTemp(src.SkipToken))
+            {}
+
+        FListMultiplayerServersRequest& operator=(const FListMultiplayerServersRequest& src) = default;
+        FListMultiplayerServersRequest& operator=(FListMultiplayerServersRequest&& src) = default;
+
         FListMultiplayerServersRequest(const TSharedPtr<FJsonObject>& obj) : FListMultiplayerServersRequest()
         {
             readFromValue(obj);
@@ -4616,7 +6487,13 @@ namespace MultiplayerModels
         ~FListMultiplayerServersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMultiplayerServerSummary : public PlayFab::FPlayFabCppBaseModel
@@ -4663,6 +6540,20 @@ namespace MultiplayerModels
             VmId(src.VmId)
             {}
 
+        FMultiplayerServerSummary(FMultiplayerServerSummary&& src) :
+            FPlayFabCppBaseModel(),
+            ConnectedPlayers(MoveTemp(src.ConnectedPlayers)),
+            LastStateTransitionTime(MoveTemp(src.LastStateTransitionTime)),
+            Region(MoveTemp(src.Region)),
+            ServerId(MoveTemp(src.ServerId)),
+            SessionId(MoveTemp(src.SessionId)),
+            State(MoveTemp(src.State)),
+            VmId(MoveTemp(src.VmId))
+            {}
+
+        FMultiplayerServerSummary& operator=(const FMultiplayerServerSummary& src) = default;
+        FMultiplayerServerSummary& operator=(FMultiplayerServerSummary&& src) = default;
+
         FMultiplayerServerSummary(const TSharedPtr<FJsonObject>& obj) : FMultiplayerServerSummary()
         {
             readFromValue(obj);
@@ -4671,7 +6562,13 @@ namespace MultiplayerModels
         ~FMultiplayerServerSummary();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListMultiplayerServersResponse : public PlayFab::FPlayFabCppResultCommon
@@ -4698,6 +6595,16 @@ namespace MultiplayerModels
             SkipToken(src.SkipToken)
             {}
 
+        FListMultiplayerServersResponse(FListMultiplayerServersResponse&& src) :
+            FPlayFabCppResultCommon(),
+            MultiplayerServerSummaries(MoveTemp(src.MultiplayerServerSummaries)),
+            PageSize(MoveTemp(src.PageSize)),
+            SkipToken(MoveTemp(src.SkipToken))
+            {}
+
+        FListMultiplayerServersResponse& operator=(const FListMultiplayerServersResponse& src) = default;
+        FListMultiplayerServersResponse& operator=(FListMultiplayerServersResponse&& src) = default;
+
         FListMultiplayerServersResponse(const TSharedPtr<FJsonObject>& obj) : FListMultiplayerServersResponse()
         {
             readFromValue(obj);
@@ -4706,7 +6613,13 @@ namespace MultiplayerModels
         ~FListMultiplayerServersResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListPartyQosServersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4723,6 +6636,14 @@ namespace MultiplayerModels
             CustomTags(src.CustomTags)
             {}
 
+        FListPartyQosServersRequest(FListPartyQosServersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FListPartyQosServersRequest& operator=(const FListPartyQosServersRequest& src) = default;
+        FListPartyQosServersRequest& operator=(FListPartyQosServersRequest&& src) = default;
+
         FListPartyQosServersRequest(const TSharedPtr<FJsonObject>& obj) : FListPartyQosServersRequest()
         {
             readFromValue(obj);
@@ -4731,7 +6652,13 @@ namespace MultiplayerModels
         ~FListPartyQosServersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FQosServer : public PlayFab::FPlayFabCppBaseModel
@@ -4754,6 +6681,15 @@ namespace MultiplayerModels
             ServerUrl(src.ServerUrl)
             {}
 
+        FQosServer(FQosServer&& src) :
+            FPlayFabCppBaseModel(),
+            Region(MoveTemp(src.Region)),
+            ServerUrl(MoveTemp(src.ServerUrl))
+            {}
+
+        FQosServer& operator=(const FQosServer& src) = default;
+        FQosServer& operator=(FQosServer&& src) = default;
+
         FQosServer(const TSharedPtr<FJsonObject>& obj) : FQosServer()
         {
             readFromValue(obj);
@@ -4762,7 +6698,13 @@ namespace MultiplayerModels
         ~FQosServer();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListPartyQosServersResponse : public PlayFab::FPlayFabCppResultCommon
@@ -4789,6 +6731,16 @@ namespace MultiplayerModels
             SkipToken(src.SkipToken)
             {}
 
+        FListPartyQosServersResponse(FListPartyQosServersResponse&& src) :
+            FPlayFabCppResultCommon(),
+            PageSize(MoveTemp(src.PageSize)),
+            QosServers(MoveTemp(src.QosServers)),
+            SkipToken(MoveTemp(src.SkipToken))
+            {}
+
+        FListPartyQosServersResponse& operator=(const FListPartyQosServersResponse& src) = default;
+        FListPartyQosServersResponse& operator=(FListPartyQosServersResponse&& src) = default;
+
         FListPartyQosServersResponse(const TSharedPtr<FJsonObject>& obj) : FListPartyQosServersResponse()
         {
             readFromValue(obj);
@@ -4797,7 +6749,13 @@ namespace MultiplayerModels
         ~FListPartyQosServersResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListQosServersForTitleRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4822,6 +6780,15 @@ namespace MultiplayerModels
             IncludeAllRegions(src.IncludeAllRegions)
             {}
 
+        FListQosServersForTitleRequest(FListQosServersForTitleRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            IncludeAllRegions(MoveTemp(src.IncludeAllRegions))
+            {}
+
+        FListQosServersForTitleRequest& operator=(const FListQosServersForTitleRequest& src) = default;
+        FListQosServersForTitleRequest& operator=(FListQosServersForTitleRequest&& src) = default;
+
         FListQosServersForTitleRequest(const TSharedPtr<FJsonObject>& obj) : FListQosServersForTitleRequest()
         {
             readFromValue(obj);
@@ -4830,7 +6797,13 @@ namespace MultiplayerModels
         ~FListQosServersForTitleRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListQosServersForTitleResponse : public PlayFab::FPlayFabCppResultCommon
@@ -4857,6 +6830,16 @@ namespace MultiplayerModels
             SkipToken(src.SkipToken)
             {}
 
+        FListQosServersForTitleResponse(FListQosServersForTitleResponse&& src) :
+            FPlayFabCppResultCommon(),
+            PageSize(MoveTemp(src.PageSize)),
+            QosServers(MoveTemp(src.QosServers)),
+            SkipToken(MoveTemp(src.SkipToken))
+            {}
+
+        FListQosServersForTitleResponse& operator=(const FListQosServersForTitleResponse& src) = default;
+        FListQosServersForTitleResponse& operator=(FListQosServersForTitleResponse&& src) = default;
+
         FListQosServersForTitleResponse(const TSharedPtr<FJsonObject>& obj) : FListQosServersForTitleResponse()
         {
             readFromValue(obj);
@@ -4865,7 +6848,13 @@ namespace MultiplayerModels
         ~FListQosServersForTitleResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListServerBackfillTicketsForPlayerRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4892,6 +6881,16 @@ namespace MultiplayerModels
             QueueName(src.QueueName)
             {}
 
+        FListServerBackfillTicketsForPlayerRequest(FListServerBackfillTicketsForPlayerRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            QueueName(MoveTemp(src.QueueName))
+            {}
+
+        FListServerBackfillTicketsForPlayerRequest& operator=(const FListServerBackfillTicketsForPlayerRequest& src) = default;
+        FListServerBackfillTicketsForPlayerRequest& operator=(FListServerBackfillTicketsForPlayerRequest&& src) = default;
+
         FListServerBackfillTicketsForPlayerRequest(const TSharedPtr<FJsonObject>& obj) : FListServerBackfillTicketsForPlayerRequest()
         {
             readFromValue(obj);
@@ -4900,7 +6899,13 @@ namespace MultiplayerModels
         ~FListServerBackfillTicketsForPlayerRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListServerBackfillTicketsForPlayerResult : public PlayFab::FPlayFabCppResultCommon
@@ -4917,6 +6922,14 @@ namespace MultiplayerModels
             TicketIds(src.TicketIds)
             {}
 
+        FListServerBackfillTicketsForPlayerResult(FListServerBackfillTicketsForPlayerResult&& src) :
+            FPlayFabCppResultCommon(),
+            TicketIds(MoveTemp(src.TicketIds))
+            {}
+
+        FListServerBackfillTicketsForPlayerResult& operator=(const FListServerBackfillTicketsForPlayerResult& src) = default;
+        FListServerBackfillTicketsForPlayerResult& operator=(FListServerBackfillTicketsForPlayerResult&& src) = default;
+
         FListServerBackfillTicketsForPlayerResult(const TSharedPtr<FJsonObject>& obj) : FListServerBackfillTicketsForPlayerResult()
         {
             readFromValue(obj);
@@ -4925,7 +6938,13 @@ namespace MultiplayerModels
         ~FListServerBackfillTicketsForPlayerResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListTitleMultiplayerServersQuotaChangesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4942,6 +6961,14 @@ namespace MultiplayerModels
             CustomTags(src.CustomTags)
             {}
 
+        FListTitleMultiplayerServersQuotaChangesRequest(FListTitleMultiplayerServersQuotaChangesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FListTitleMultiplayerServersQuotaChangesRequest& operator=(const FListTitleMultiplayerServersQuotaChangesRequest& src) = default;
+        FListTitleMultiplayerServersQuotaChangesRequest& operator=(FListTitleMultiplayerServersQuotaChangesRequest&& src) = default;
+
         FListTitleMultiplayerServersQuotaChangesRequest(const TSharedPtr<FJsonObject>& obj) : FListTitleMultiplayerServersQuotaChangesRequest()
         {
             readFromValue(obj);
@@ -4950,7 +6977,13 @@ namespace MultiplayerModels
         ~FListTitleMultiplayerServersQuotaChangesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListTitleMultiplayerServersQuotaChangesResponse : public PlayFab::FPlayFabCppResultCommon
@@ -4967,6 +7000,14 @@ namespace MultiplayerModels
             Changes(src.Changes)
             {}
 
+        FListTitleMultiplayerServersQuotaChangesResponse(FListTitleMultiplayerServersQuotaChangesResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Changes(MoveTemp(src.Changes))
+            {}
+
+        FListTitleMultiplayerServersQuotaChangesResponse& operator=(const FListTitleMultiplayerServersQuotaChangesResponse& src) = default;
+        FListTitleMultiplayerServersQuotaChangesResponse& operator=(FListTitleMultiplayerServersQuotaChangesResponse&& src) = default;
+
         FListTitleMultiplayerServersQuotaChangesResponse(const TSharedPtr<FJsonObject>& obj) : FListTitleMultiplayerServersQuotaChangesResponse()
         {
             readFromValue(obj);
@@ -4975,7 +7016,13 @@ namespace MultiplayerModels
         ~FListTitleMultiplayerServersQuotaChangesResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListVirtualMachineSummariesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5012,6 +7059,18 @@ namespace MultiplayerModels
             SkipToken(src.SkipToken)
             {}
 
+        FListVirtualMachineSummariesRequest(FListVirtualMachineSummariesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildId(MoveTemp(src.BuildId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PageSize(MoveTemp(src.PageSize)),
+            Region(MoveTemp(src.Region)),
+            SkipToken(MoveTemp(src.SkipToken))
+            {}
+
+        FListVirtualMachineSummariesRequest& operator=(const FListVirtualMachineSummariesRequest& src) = default;
+        FListVirtualMachineSummariesRequest& operator=(FListVirtualMachineSummariesRequest&& src) = default;
+
         FListVirtualMachineSummariesRequest(const TSharedPtr<FJsonObject>& obj) : FListVirtualMachineSummariesRequest()
         {
             readFromValue(obj);
@@ -5020,7 +7079,13 @@ namespace MultiplayerModels
         ~FListVirtualMachineSummariesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FVirtualMachineSummary : public PlayFab::FPlayFabCppBaseModel
@@ -5048,6 +7113,16 @@ namespace MultiplayerModels
             VmId(src.VmId)
             {}
 
+        FVirtualMachineSummary(FVirtualMachineSummary&& src) :
+            FPlayFabCppBaseModel(),
+            HealthStatus(MoveTemp(src.HealthStatus)),
+            State(MoveTemp(src.State)),
+            VmId(MoveTemp(src.VmId))
+            {}
+
+        FVirtualMachineSummary& operator=(const FVirtualMachineSummary& src) = default;
+        FVirtualMachineSummary& operator=(FVirtualMachineSummary&& src) = default;
+
         FVirtualMachineSummary(const TSharedPtr<FJsonObject>& obj) : FVirtualMachineSummary()
         {
             readFromValue(obj);
@@ -5056,7 +7131,13 @@ namespace MultiplayerModels
         ~FVirtualMachineSummary();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListVirtualMachineSummariesResponse : public PlayFab::FPlayFabCppResultCommon
@@ -5083,6 +7164,16 @@ namespace MultiplayerModels
             VirtualMachines(src.VirtualMachines)
             {}
 
+        FListVirtualMachineSummariesResponse(FListVirtualMachineSummariesResponse&& src) :
+            FPlayFabCppResultCommon(),
+            PageSize(MoveTemp(src.PageSize)),
+            SkipToken(MoveTemp(src.SkipToken)),
+            VirtualMachines(MoveTemp(src.VirtualMachines))
+            {}
+
+        FListVirtualMachineSummariesResponse& operator=(const FListVirtualMachineSummariesResponse& src) = default;
+        FListVirtualMachineSummariesResponse& operator=(FListVirtualMachineSummariesResponse&& src) = default;
+
         FListVirtualMachineSummariesResponse(const TSharedPtr<FJsonObject>& obj) : FListVirtualMachineSummariesResponse()
         {
             readFromValue(obj);
@@ -5091,7 +7182,13 @@ namespace MultiplayerModels
         ~FListVirtualMachineSummariesResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum OsPlatform
@@ -5101,6 +7198,7 @@ namespace MultiplayerModels
     };
 
     PLAYFABCPP_API void writeOsPlatformEnumJSON(OsPlatform enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeOsPlatformEnumJSON(OsPlatform enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API OsPlatform readOsPlatformFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API OsPlatform readOsPlatformFromValue(const FString& value);
 
@@ -5146,7 +7244,7 @@ namespace MultiplayerModels
 
         FRequestMultiplayerServerRequest(const FRequestMultiplayerServerRequest& src) :
             FPlayFabCppRequestCommon(),
-            pfBuildAliasParams(src.pfBuildAliasParams.IsValid() ? MakeShareable(new FBuildAliasParams(*src.pfBuildAliasParams)) : nullptr),
+            pfBuildAliasParams(src.pfBuildAliasParams.IsValid() ? TSharedPtr<FBuildAliasParams>(MakeShared<FBuildAliasParams>(*src.pfBuildAliasParams)) : nullptr),
             BuildId(src.BuildId),
             CustomTags(src.CustomTags),
             InitialPlayers(src.InitialPlayers),
@@ -5155,6 +7253,20 @@ namespace MultiplayerModels
             SessionId(src.SessionId)
             {}
 
+        FRequestMultiplayerServerRequest(FRequestMultiplayerServerRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            pfBuildAliasParams(MoveTemp(src.pfBuildAliasParams)),
+            BuildId(MoveTemp(src.BuildId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            InitialPlayers(MoveTemp(src.InitialPlayers)),
+            PreferredRegions(MoveTemp(src.PreferredRegions)),
+            SessionCookie(MoveTemp(src.SessionCookie)),
+            SessionId(MoveTemp(src.SessionId))
+            {}
+
+        FRequestMultiplayerServerRequest& operator=(const FRequestMultiplayerServerRequest& src) = default;
+        FRequestMultiplayerServerRequest& operator=(FRequestMultiplayerServerRequest&& src) = default;
+
         FRequestMultiplayerServerRequest(const TSharedPtr<FJsonObject>& obj) : FRequestMultiplayerServerRequest()
         {
             readFromValue(obj);
@@ -5163,7 +7275,13 @@ namespace MultiplayerModels
         ~FRequestMultiplayerServerRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRequestMultiplayerServerResponse : public PlayFab::FPlayFabCppResultCommon
@@ -5229,6 +7347,24 @@ namespace MultiplayerModels
             VmId(src.VmId)
             {}
 
+        FRequestMultiplayerServerResponse(FRequestMultiplayerServerResponse&& src) :
+            FPlayFabCppResultCommon(),
+            BuildId(MoveTemp(src.BuildId)),
+            ConnectedPlayers(MoveTemp(src.ConnectedPlayers)),
+            FQDN(MoveTemp(src.FQDN)),
+            IPV4Address(MoveTemp(src.IPV4Address)),
+            LastStateTransitionTime(MoveTemp(src.LastStateTransitionTime)),
+            Ports(MoveTemp(src.Ports)),
+            Region(MoveTemp(src.Region)),
+            ServerId(MoveTemp(src.ServerId)),
+            SessionId(MoveTemp(src.SessionId)),
+            State(MoveTemp(src.State)),
+            VmId(MoveTemp(src.VmId))
+            {}
+
+        FRequestMultiplayerServerResponse& operator=(const FRequestMultiplayerServerResponse& src) = default;
+        FRequestMultiplayerServerResponse& operator=(FRequestMultiplayerServerResponse&& src) = default;
+
         FRequestMultiplayerServerResponse(const TSharedPtr<FJsonObject>& obj) : FRequestMultiplayerServerResponse()
         {
             readFromValue(obj);
@@ -5237,7 +7373,13 @@ namespace MultiplayerModels
         ~FRequestMultiplayerServerResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRolloverContainerRegistryCredentialsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5254,6 +7396,14 @@ namespace MultiplayerModels
             CustomTags(src.CustomTags)
             {}
 
+        FRolloverContainerRegistryCredentialsRequest(FRolloverContainerRegistryCredentialsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FRolloverContainerRegistryCredentialsRequest& operator=(const FRolloverContainerRegistryCredentialsRequest& src) = default;
+        FRolloverContainerRegistryCredentialsRequest& operator=(FRolloverContainerRegistryCredentialsRequest&& src) = default;
+
         FRolloverContainerRegistryCredentialsRequest(const TSharedPtr<FJsonObject>& obj) : FRolloverContainerRegistryCredentialsRequest()
         {
             readFromValue(obj);
@@ -5262,7 +7412,13 @@ namespace MultiplayerModels
         ~FRolloverContainerRegistryCredentialsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRolloverContainerRegistryCredentialsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -5290,6 +7446,16 @@ namespace MultiplayerModels
             Username(src.Username)
             {}
 
+        FRolloverContainerRegistryCredentialsResponse(FRolloverContainerRegistryCredentialsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            DnsName(MoveTemp(src.DnsName)),
+            Password(MoveTemp(src.Password)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FRolloverContainerRegistryCredentialsResponse& operator=(const FRolloverContainerRegistryCredentialsResponse& src) = default;
+        FRolloverContainerRegistryCredentialsResponse& operator=(FRolloverContainerRegistryCredentialsResponse&& src) = default;
+
         FRolloverContainerRegistryCredentialsResponse(const TSharedPtr<FJsonObject>& obj) : FRolloverContainerRegistryCredentialsResponse()
         {
             readFromValue(obj);
@@ -5298,7 +7464,13 @@ namespace MultiplayerModels
         ~FRolloverContainerRegistryCredentialsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum ServerType
@@ -5308,6 +7480,7 @@ namespace MultiplayerModels
     };
 
     PLAYFABCPP_API void writeServerTypeEnumJSON(ServerType enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeServerTypeEnumJSON(ServerType enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API ServerType readServerTypeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API ServerType readServerTypeFromValue(const FString& value);
 
@@ -5340,6 +7513,17 @@ namespace MultiplayerModels
             SessionId(src.SessionId)
             {}
 
+        FShutdownMultiplayerServerRequest(FShutdownMultiplayerServerRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildId(MoveTemp(src.BuildId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Region(MoveTemp(src.Region)),
+            SessionId(MoveTemp(src.SessionId))
+            {}
+
+        FShutdownMultiplayerServerRequest& operator=(const FShutdownMultiplayerServerRequest& src) = default;
+        FShutdownMultiplayerServerRequest& operator=(FShutdownMultiplayerServerRequest&& src) = default;
+
         FShutdownMultiplayerServerRequest(const TSharedPtr<FJsonObject>& obj) : FShutdownMultiplayerServerRequest()
         {
             readFromValue(obj);
@@ -5348,7 +7532,13 @@ namespace MultiplayerModels
         ~FShutdownMultiplayerServerRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUntagContainerImageRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5375,6 +7565,16 @@ namespace MultiplayerModels
             Tag(src.Tag)
             {}
 
+        FUntagContainerImageRequest(FUntagContainerImageRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ImageName(MoveTemp(src.ImageName)),
+            Tag(MoveTemp(src.Tag))
+            {}
+
+        FUntagContainerImageRequest& operator=(const FUntagContainerImageRequest& src) = default;
+        FUntagContainerImageRequest& operator=(FUntagContainerImageRequest&& src) = default;
+
         FUntagContainerImageRequest(const TSharedPtr<FJsonObject>& obj) : FUntagContainerImageRequest()
         {
             readFromValue(obj);
@@ -5383,7 +7583,13 @@ namespace MultiplayerModels
         ~FUntagContainerImageRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateBuildAliasRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5414,6 +7620,17 @@ namespace MultiplayerModels
             CustomTags(src.CustomTags)
             {}
 
+        FUpdateBuildAliasRequest(FUpdateBuildAliasRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AliasId(MoveTemp(src.AliasId)),
+            AliasName(MoveTemp(src.AliasName)),
+            BuildSelectionCriteria(MoveTemp(src.BuildSelectionCriteria)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUpdateBuildAliasRequest& operator=(const FUpdateBuildAliasRequest& src) = default;
+        FUpdateBuildAliasRequest& operator=(FUpdateBuildAliasRequest&& src) = default;
+
         FUpdateBuildAliasRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateBuildAliasRequest()
         {
             readFromValue(obj);
@@ -5422,7 +7639,13 @@ namespace MultiplayerModels
         ~FUpdateBuildAliasRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateBuildNameRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5449,6 +7672,16 @@ namespace MultiplayerModels
             CustomTags(src.CustomTags)
             {}
 
+        FUpdateBuildNameRequest(FUpdateBuildNameRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildId(MoveTemp(src.BuildId)),
+            BuildName(MoveTemp(src.BuildName)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUpdateBuildNameRequest& operator=(const FUpdateBuildNameRequest& src) = default;
+        FUpdateBuildNameRequest& operator=(FUpdateBuildNameRequest&& src) = default;
+
         FUpdateBuildNameRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateBuildNameRequest()
         {
             readFromValue(obj);
@@ -5457,7 +7690,13 @@ namespace MultiplayerModels
         ~FUpdateBuildNameRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateBuildRegionRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5484,6 +7723,16 @@ namespace MultiplayerModels
             CustomTags(src.CustomTags)
             {}
 
+        FUpdateBuildRegionRequest(FUpdateBuildRegionRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildId(MoveTemp(src.BuildId)),
+            BuildRegion(MoveTemp(src.BuildRegion)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUpdateBuildRegionRequest& operator=(const FUpdateBuildRegionRequest& src) = default;
+        FUpdateBuildRegionRequest& operator=(FUpdateBuildRegionRequest&& src) = default;
+
         FUpdateBuildRegionRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateBuildRegionRequest()
         {
             readFromValue(obj);
@@ -5492,7 +7741,13 @@ namespace MultiplayerModels
         ~FUpdateBuildRegionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateBuildRegionsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5518,6 +7773,16 @@ namespace MultiplayerModels
             CustomTags(src.CustomTags)
             {}
 
+        FUpdateBuildRegionsRequest(FUpdateBuildRegionsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BuildId(MoveTemp(src.BuildId)),
+            BuildRegions(MoveTemp(src.BuildRegions)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FUpdateBuildRegionsRequest& operator=(const FUpdateBuildRegionsRequest& src) = default;
+        FUpdateBuildRegionsRequest& operator=(FUpdateBuildRegionsRequest&& src) = default;
+
         FUpdateBuildRegionsRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateBuildRegionsRequest()
         {
             readFromValue(obj);
@@ -5526,7 +7791,13 @@ namespace MultiplayerModels
         ~FUpdateBuildRegionsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUploadCertificateRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5548,6 +7819,15 @@ namespace MultiplayerModels
             GameCertificate(src.GameCertificate)
             {}
 
+        FUploadCertificateRequest(FUploadCertificateRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            GameCertificate(MoveTemp(src.GameCertificate))
+            {}
+
+        FUploadCertificateRequest& operator=(const FUploadCertificateRequest& src) = default;
+        FUploadCertificateRequest& operator=(FUploadCertificateRequest&& src) = default;
+
         FUploadCertificateRequest(const TSharedPtr<FJsonObject>& obj) : FUploadCertificateRequest()
         {
             readFromValue(obj);
@@ -5556,7 +7836,13 @@ namespace MultiplayerModels
         ~FUploadCertificateRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
 }
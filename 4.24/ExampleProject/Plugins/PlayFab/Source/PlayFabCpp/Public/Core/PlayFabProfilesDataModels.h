@@ -21,6 +21,7 @@ namespace ProfilesModels
     };
 
     PLAYFABCPP_API void writeEffectTypeEnumJSON(EffectType enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeEffectTypeEnumJSON(EffectType enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API EffectType readEffectTypeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API EffectType readEffectTypeFromValue(const FString& value);
 
@@ -49,6 +50,16 @@ namespace ProfilesModels
             ObjectName(src.ObjectName)
             {}
 
+        FEntityDataObject(FEntityDataObject&& src) :
+            FPlayFabCppBaseModel(),
+            DataObject(MoveTemp(src.DataObject)),
+            EscapedDataObject(MoveTemp(src.EscapedDataObject)),
+            ObjectName(MoveTemp(src.ObjectName))
+            {}
+
+        FEntityDataObject& operator=(const FEntityDataObject& src) = default;
+        FEntityDataObject& operator=(FEntityDataObject&& src) = default;
+
         FEntityDataObject(const TSharedPtr<FJsonObject>& obj) : FEntityDataObject()
         {
             readFromValue(obj);
@@ -57,7 +68,13 @@ namespace ProfilesModels
         ~FEntityDataObject();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityKey : public PlayFab::FPlayFabCppBaseModel
@@ -80,6 +97,15 @@ namespace ProfilesModels
             Type(src.Type)
             {}
 
+        FEntityKey(FEntityKey&& src) :
+            FPlayFabCppBaseModel(),
+            Id(MoveTemp(src.Id)),
+            Type(MoveTemp(src.Type))
+            {}
+
+        FEntityKey& operator=(const FEntityKey& src) = default;
+        FEntityKey& operator=(FEntityKey&& src) = default;
+
         FEntityKey(const TSharedPtr<FJsonObject>& obj) : FEntityKey()
         {
             readFromValue(obj);
@@ -88,7 +114,13 @@ namespace ProfilesModels
         ~FEntityKey();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityLineage : public PlayFab::FPlayFabCppBaseModel
@@ -131,6 +163,19 @@ namespace ProfilesModels
             TitlePlayerAccountId(src.TitlePlayerAccountId)
             {}
 
+        FEntityLineage(FEntityLineage&& src) :
+            FPlayFabCppBaseModel(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            GroupId(MoveTemp(src.GroupId)),
+            MasterPlayerAccountId(MoveTemp(src.MasterPlayerAccountId)),
+            NamespaceId(MoveTemp(src.NamespaceId)),
+            TitleId(MoveTemp(src.TitleId)),
+            TitlePlayerAccountId(MoveTemp(src.TitlePlayerAccountId))
+            {}
+
+        FEntityLineage& operator=(const FEntityLineage& src) = default;
+        FEntityLineage& operator=(FEntityLineage&& src) = default;
+
         FEntityLineage(const TSharedPtr<FJsonObject>& obj) : FEntityLineage()
         {
             readFromValue(obj);
@@ -139,7 +184,13 @@ namespace ProfilesModels
         ~FEntityLineage();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityPermissionStatement : public PlayFab::FPlayFabCppBaseModel
@@ -182,6 +233,19 @@ namespace ProfilesModels
             Resource(src.Resource)
             {}
 
+        FEntityPermissionStatement(FEntityPermissionStatement&& src) :
+            FPlayFabCppBaseModel(),
+            Action(MoveTemp(src.Action)),
+            Comment(MoveTemp(src.Comment)),
+            Condition(MoveTemp(src.Condition)),
+            Effect(MoveTemp(src.Effect)),
+            Principal(MoveTemp(src.Principal)),
+            Resource(MoveTemp(src.Resource))
+            {}
+
+        FEntityPermissionStatement& operator=(const FEntityPermissionStatement& src) = default;
+        FEntityPermissionStatement& operator=(FEntityPermissionStatement&& src) = default;
+
         FEntityPermissionStatement(const TSharedPtr<FJsonObject>& obj) : FEntityPermissionStatement()
         {
             readFromValue(obj);
@@ -190,7 +254,13 @@ namespace ProfilesModels
         ~FEntityPermissionStatement();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityProfileFileMetadata : public PlayFab::FPlayFabCppBaseModel
@@ -223,6 +293,17 @@ namespace ProfilesModels
             Size(src.Size)
             {}
 
+        FEntityProfileFileMetadata(FEntityProfileFileMetadata&& src) :
+            FPlayFabCppBaseModel(),
+            Checksum(MoveTemp(src.Checksum)),
+            FileName(MoveTemp(src.FileName)),
+            LastModified(MoveTemp(src.LastModified)),
+            Size(MoveTemp(src.Size))
+            {}
+
+        FEntityProfileFileMetadata& operator=(const FEntityProfileFileMetadata& src) = default;
+        FEntityProfileFileMetadata& operator=(FEntityProfileFileMetadata&& src) = default;
+
         FEntityProfileFileMetadata(const TSharedPtr<FJsonObject>& obj) : FEntityProfileFileMetadata()
         {
             readFromValue(obj);
@@ -231,7 +312,13 @@ namespace ProfilesModels
         ~FEntityProfileFileMetadata();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityStatisticChildValue : public PlayFab::FPlayFabCppBaseModel
@@ -259,6 +346,16 @@ namespace ProfilesModels
             Value(src.Value)
             {}
 
+        FEntityStatisticChildValue(FEntityStatisticChildValue&& src) :
+            FPlayFabCppBaseModel(),
+            ChildName(MoveTemp(src.ChildName)),
+            Metadata(MoveTemp(src.Metadata)),
+            Value(MoveTemp(src.Value))
+            {}
+
+        FEntityStatisticChildValue& operator=(const FEntityStatisticChildValue& src) = default;
+        FEntityStatisticChildValue& operator=(FEntityStatisticChildValue&& src) = default;
+
         FEntityStatisticChildValue(const TSharedPtr<FJsonObject>& obj) : FEntityStatisticChildValue()
         {
             readFromValue(obj);
@@ -267,7 +364,13 @@ namespace ProfilesModels
         ~FEntityStatisticChildValue();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityStatisticValue : public PlayFab::FPlayFabCppBaseModel
@@ -304,6 +407,18 @@ namespace ProfilesModels
             Version(src.Version)
             {}
 
+        FEntityStatisticValue(FEntityStatisticValue&& src) :
+            FPlayFabCppBaseModel(),
+            ChildStatistics(MoveTemp(src.ChildStatistics)),
+            Metadata(MoveTemp(src.Metadata)),
+            Name(MoveTemp(src.Name)),
+            Value(MoveTemp(src.Value)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FEntityStatisticValue& operator=(const FEntityStatisticValue& src) = default;
+        FEntityStatisticValue& operator=(FEntityStatisticValue&& src) = default;
+
         FEntityStatisticValue(const TSharedPtr<FJsonObject>& obj) : FEntityStatisticValue()
         {
             readFromValue(obj);
@@ -312,7 +427,13 @@ namespace ProfilesModels
         ~FEntityStatisticValue();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityProfileBody : public PlayFab::FPlayFabCppBaseModel
@@ -386,19 +507,40 @@ namespace ProfilesModels
             AvatarUrl(src.AvatarUrl),
             Created(src.Created),
             DisplayName(src.DisplayName),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             EntityChain(src.EntityChain),
             ExperimentVariants(src.ExperimentVariants),
             Files(src.Files),
             Language(src.Language),
             LeaderboardMetadata(src.LeaderboardMetadata),
-            Lineage(src.Lineage.IsValid() ? MakeShareable(new FEntityLineage(*src.Lineage)) : nullptr),
+            Lineage(src.Lineage.IsValid() ? TSharedPtr<FEntityLineage>(MakeShared<FEntityLineage>(*src.Lineage)) : nullptr),
             Objects(src.Objects),
             Permissions(src.Permissions),
             Statistics(src.Statistics),
             VersionNumber(src.VersionNumber)
             {}
 
+        FEntityProfileBody(FEntityProfileBody&& src) :
+            FPlayFabCppBaseModel(),
+            AvatarUrl(MoveTemp(src.AvatarUrl)),
+            Created(MoveTemp(src.Created)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            Entity(MoveTemp(src.Entity)),
+            EntityChain(MoveTemp(src.EntityChain)),
+            ExperimentVariants(MoveTemp(src.ExperimentVariants)),
+            Files(MoveTemp(src.Files)),
+            Language(MoveTemp(src.Language)),
+            LeaderboardMetadata(MoveTemp(src.LeaderboardMetadata)),
+            Lineage(MoveTemp(src.Lineage)),
+            Objects(MoveTemp(src.Objects)),
+            Permissions(MoveTemp(src.Permissions)),
+            Statistics(MoveTemp(src.Statistics)),
+            VersionNumber(MoveTemp(src.VersionNumber))
+            {}
+
+        FEntityProfileBody& operator=(const FEntityProfileBody& src) = default;
+        FEntityProfileBody& operator=(FEntityProfileBody&& src) = default;
+
         FEntityProfileBody(const TSharedPtr<FJsonObject>& obj) : FEntityProfileBody()
         {
             readFromValue(obj);
@@ -407,7 +549,13 @@ namespace ProfilesModels
         ~FEntityProfileBody();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetEntityProfileRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -434,9 +582,19 @@ namespace ProfilesModels
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
             DataAsObject(src.DataAsObject),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr)
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr)
             {}
 
+        FGetEntityProfileRequest(FGetEntityProfileRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DataAsObject(MoveTemp(src.DataAsObject)),
+            Entity(MoveTemp(src.Entity))
+            {}
+
+        FGetEntityProfileRequest& operator=(const FGetEntityProfileRequest& src) = default;
+        FGetEntityProfileRequest& operator=(FGetEntityProfileRequest&& src) = default;
+
         FGetEntityProfileRequest(const TSharedPtr<FJsonObject>& obj) : FGetEntityProfileRequest()
         {
             readFromValue(obj);
@@ -445,7 +603,13 @@ namespace ProfilesModels
         ~FGetEntityProfileRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetEntityProfileResponse : public PlayFab::FPlayFabCppResultCommon
@@ -460,9 +624,17 @@ namespace ProfilesModels
 
         FGetEntityProfileResponse(const FGetEntityProfileResponse& src) :
             FPlayFabCppResultCommon(),
-            Profile(src.Profile.IsValid() ? MakeShareable(new FEntityProfileBody(*src.Profile)) : nullptr)
+            Profile(src.Profile.IsValid() ? TSharedPtr<FEntityProfileBody>(MakeShared<FEntityProfileBody>(*src.Profile)) : nullptr)
             {}
 
+        FGetEntityProfileResponse(FGetEntityProfileResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Profile(MoveTemp(src.Profile))
+            {}
+
+        FGetEntityProfileResponse& operator=(const FGetEntityProfileResponse& src) = default;
+        FGetEntityProfileResponse& operator=(FGetEntityProfileResponse&& src) = default;
+
         FGetEntityProfileResponse(const TSharedPtr<FJsonObject>& obj) : FGetEntityProfileResponse()
         {
             readFromValue(obj);
@@ -471,7 +643,13 @@ namespace ProfilesModels
         ~FGetEntityProfileResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetEntityProfilesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -500,6 +678,16 @@ namespace ProfilesModels
             Entities(src.Entities)
             {}
 
+        FGetEntityProfilesRequest(FGetEntityProfilesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            DataAsObject(MoveTemp(src.DataAsObject)),
+            Entities(MoveTemp(src.Entities))
+            {}
+
+        FGetEntityProfilesRequest& operator=(const FGetEntityProfilesRequest& src) = default;
+        FGetEntityProfilesRequest& operator=(FGetEntityProfilesRequest&& src) = default;
+
         FGetEntityProfilesRequest(const TSharedPtr<FJsonObject>& obj) : FGetEntityProfilesRequest()
         {
             readFromValue(obj);
@@ -508,7 +696,13 @@ namespace ProfilesModels
         ~FGetEntityProfilesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetEntityProfilesResponse : public PlayFab::FPlayFabCppResultCommon
@@ -525,6 +719,14 @@ namespace ProfilesModels
             Profiles(src.Profiles)
             {}
 
+        FGetEntityProfilesResponse(FGetEntityProfilesResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Profiles(MoveTemp(src.Profiles))
+            {}
+
+        FGetEntityProfilesResponse& operator=(const FGetEntityProfilesResponse& src) = default;
+        FGetEntityProfilesResponse& operator=(FGetEntityProfilesResponse&& src) = default;
+
         FGetEntityProfilesResponse(const TSharedPtr<FJsonObject>& obj) : FGetEntityProfilesResponse()
         {
             readFromValue(obj);
@@ -533,7 +735,13 @@ namespace ProfilesModels
         ~FGetEntityProfilesResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetGlobalPolicyRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -550,6 +758,14 @@ namespace ProfilesModels
             CustomTags(src.CustomTags)
             {}
 
+        FGetGlobalPolicyRequest(FGetGlobalPolicyRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FGetGlobalPolicyRequest& operator=(const FGetGlobalPolicyRequest& src) = default;
+        FGetGlobalPolicyRequest& operator=(FGetGlobalPolicyRequest&& src) = default;
+
         FGetGlobalPolicyRequest(const TSharedPtr<FJsonObject>& obj) : FGetGlobalPolicyRequest()
         {
             readFromValue(obj);
@@ -558,7 +774,13 @@ namespace ProfilesModels
         ~FGetGlobalPolicyRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetGlobalPolicyResponse : public PlayFab::FPlayFabCppResultCommon
@@ -575,6 +797,14 @@ namespace ProfilesModels
             Permissions(src.Permissions)
             {}
 
+        FGetGlobalPolicyResponse(FGetGlobalPolicyResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Permissions(MoveTemp(src.Permissions))
+            {}
+
+        FGetGlobalPolicyResponse& operator=(const FGetGlobalPolicyResponse& src) = default;
+        FGetGlobalPolicyResponse& operator=(FGetGlobalPolicyResponse&& src) = default;
+
         FGetGlobalPolicyResponse(const TSharedPtr<FJsonObject>& obj) : FGetGlobalPolicyResponse()
         {
             readFromValue(obj);
@@ -583,7 +813,13 @@ namespace ProfilesModels
         ~FGetGlobalPolicyResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitlePlayersFromMasterPlayerAccountIdsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -609,6 +845,16 @@ namespace ProfilesModels
             TitleId(src.TitleId)
             {}
 
+        FGetTitlePlayersFromMasterPlayerAccountIdsRequest(FGetTitlePlayersFromMasterPlayerAccountIdsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            MasterPlayerAccountIds(MoveTemp(src.MasterPlayerAccountIds)),
+            TitleId(MoveTemp(src.TitleId))
+            {}
+
+        FGetTitlePlayersFromMasterPlayerAccountIdsRequest& operator=(const FGetTitlePlayersFromMasterPlayerAccountIdsRequest& src) = default;
+        FGetTitlePlayersFromMasterPlayerAccountIdsRequest& operator=(FGetTitlePlayersFromMasterPlayerAccountIdsRequest&& src) = default;
+
         FGetTitlePlayersFromMasterPlayerAccountIdsRequest(const TSharedPtr<FJsonObject>& obj) : FGetTitlePlayersFromMasterPlayerAccountIdsRequest()
         {
             readFromValue(obj);
@@ -617,7 +863,13 @@ namespace ProfilesModels
         ~FGetTitlePlayersFromMasterPlayerAccountIdsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitlePlayersFromMasterPlayerAccountIdsResponse : public PlayFab::FPlayFabCppResultCommon
@@ -639,6 +891,15 @@ namespace ProfilesModels
             TitlePlayerAccounts(src.TitlePlayerAccounts)
             {}
 
+        FGetTitlePlayersFromMasterPlayerAccountIdsResponse(FGetTitlePlayersFromMasterPlayerAccountIdsResponse&& src) :
+            FPlayFabCppResultCommon(),
+            TitleId(MoveTemp(src.TitleId)),
+            TitlePlayerAccounts(MoveTemp(src.TitlePlayerAccounts))
+            {}
+
+        FGetTitlePlayersFromMasterPlayerAccountIdsResponse& operator=(const FGetTitlePlayersFromMasterPlayerAccountIdsResponse& src) = default;
+        FGetTitlePlayersFromMasterPlayerAccountIdsResponse& operator=(FGetTitlePlayersFromMasterPlayerAccountIdsResponse&& src) = default;
+
         FGetTitlePlayersFromMasterPlayerAccountIdsResponse(const TSharedPtr<FJsonObject>& obj) : FGetTitlePlayersFromMasterPlayerAccountIdsResponse()
         {
             readFromValue(obj);
@@ -647,7 +908,13 @@ namespace ProfilesModels
         ~FGetTitlePlayersFromMasterPlayerAccountIdsResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum OperationTypes
@@ -659,6 +926,7 @@ namespace ProfilesModels
     };
 
     PLAYFABCPP_API void writeOperationTypesEnumJSON(OperationTypes enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeOperationTypesEnumJSON(OperationTypes enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API OperationTypes readOperationTypesFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API OperationTypes readOperationTypesFromValue(const FString& value);
 
@@ -685,6 +953,16 @@ namespace ProfilesModels
             Statements(src.Statements)
             {}
 
+        FSetEntityProfilePolicyRequest(FSetEntityProfilePolicyRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            Statements(MoveTemp(src.Statements))
+            {}
+
+        FSetEntityProfilePolicyRequest& operator=(const FSetEntityProfilePolicyRequest& src) = default;
+        FSetEntityProfilePolicyRequest& operator=(FSetEntityProfilePolicyRequest&& src) = default;
+
         FSetEntityProfilePolicyRequest(const TSharedPtr<FJsonObject>& obj) : FSetEntityProfilePolicyRequest()
         {
             readFromValue(obj);
@@ -693,7 +971,13 @@ namespace ProfilesModels
         ~FSetEntityProfilePolicyRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetEntityProfilePolicyResponse : public PlayFab::FPlayFabCppResultCommon
@@ -713,6 +997,14 @@ namespace ProfilesModels
             Permissions(src.Permissions)
             {}
 
+        FSetEntityProfilePolicyResponse(FSetEntityProfilePolicyResponse&& src) :
+            FPlayFabCppResultCommon(),
+            Permissions(MoveTemp(src.Permissions))
+            {}
+
+        FSetEntityProfilePolicyResponse& operator=(const FSetEntityProfilePolicyResponse& src) = default;
+        FSetEntityProfilePolicyResponse& operator=(FSetEntityProfilePolicyResponse&& src) = default;
+
         FSetEntityProfilePolicyResponse(const TSharedPtr<FJsonObject>& obj) : FSetEntityProfilePolicyResponse()
         {
             readFromValue(obj);
@@ -721,7 +1013,13 @@ namespace ProfilesModels
         ~FSetEntityProfilePolicyResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetGlobalPolicyRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -742,6 +1040,15 @@ namespace ProfilesModels
             Permissions(src.Permissions)
             {}
 
+        FSetGlobalPolicyRequest(FSetGlobalPolicyRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Permissions(MoveTemp(src.Permissions))
+            {}
+
+        FSetGlobalPolicyRequest& operator=(const FSetGlobalPolicyRequest& src) = default;
+        FSetGlobalPolicyRequest& operator=(FSetGlobalPolicyRequest&& src) = default;
+
         FSetGlobalPolicyRequest(const TSharedPtr<FJsonObject>& obj) : FSetGlobalPolicyRequest()
         {
             readFromValue(obj);
@@ -750,7 +1057,13 @@ namespace ProfilesModels
         ~FSetGlobalPolicyRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetGlobalPolicyResponse : public PlayFab::FPlayFabCppResultCommon
@@ -763,6 +1076,13 @@ namespace ProfilesModels
             FPlayFabCppResultCommon()
             {}
 
+        FSetGlobalPolicyResponse(FSetGlobalPolicyResponse&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSetGlobalPolicyResponse& operator=(const FSetGlobalPolicyResponse& src) = default;
+        FSetGlobalPolicyResponse& operator=(FSetGlobalPolicyResponse&& src) = default;
+
         FSetGlobalPolicyResponse(const TSharedPtr<FJsonObject>& obj) : FSetGlobalPolicyResponse()
         {
             readFromValue(obj);
@@ -771,7 +1091,13 @@ namespace ProfilesModels
         ~FSetGlobalPolicyResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetProfileLanguageRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -798,11 +1124,22 @@ namespace ProfilesModels
         FSetProfileLanguageRequest(const FSetProfileLanguageRequest& src) :
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             ExpectedVersion(src.ExpectedVersion),
             Language(src.Language)
             {}
 
+        FSetProfileLanguageRequest(FSetProfileLanguageRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            ExpectedVersion(MoveTemp(src.ExpectedVersion)),
+            Language(MoveTemp(src.Language))
+            {}
+
+        FSetProfileLanguageRequest& operator=(const FSetProfileLanguageRequest& src) = default;
+        FSetProfileLanguageRequest& operator=(FSetProfileLanguageRequest&& src) = default;
+
         FSetProfileLanguageRequest(const TSharedPtr<FJsonObject>& obj) : FSetProfileLanguageRequest()
         {
             readFromValue(obj);
@@ -811,7 +1148,13 @@ namespace ProfilesModels
         ~FSetProfileLanguageRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetProfileLanguageResponse : public PlayFab::FPlayFabCppResultCommon
@@ -834,6 +1177,15 @@ namespace ProfilesModels
             VersionNumber(src.VersionNumber)
             {}
 
+        FSetProfileLanguageResponse(FSetProfileLanguageResponse&& src) :
+            FPlayFabCppResultCommon(),
+            OperationResult(MoveTemp(src.OperationResult)),
+            VersionNumber(MoveTemp(src.VersionNumber))
+            {}
+
+        FSetProfileLanguageResponse& operator=(const FSetProfileLanguageResponse& src) = default;
+        FSetProfileLanguageResponse& operator=(FSetProfileLanguageResponse&& src) = default;
+
         FSetProfileLanguageResponse(const TSharedPtr<FJsonObject>& obj) : FSetProfileLanguageResponse()
         {
             readFromValue(obj);
@@ -842,7 +1194,13 @@ namespace ProfilesModels
         ~FSetProfileLanguageResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
 }
@@ -0,0 +1,34 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Http.h"
+
+namespace PlayFab
+{
+    /**
+     * Single-flight for read calls: identical reads that overlap share one HTTP request.
+     * Reads are identical when they go to the same url, with the same credentials and the same body.
+     * The first caller sends the request; later callers join it, and every caller's completion delegate receives its response.
+     */
+    class PLAYFABCPP_API FPlayFabRequestCoalescer
+    {
+    public:
+        /**
+         * Returns true if an identical read is already in flight, in which case OnComplete has been attached to it and HttpRequest must not be sent.
+         * Otherwise HttpRequest becomes the shared request; OutKey is set, and Complete must be called with it once the request is done.
+         */
+        static bool TryJoin(const TSharedRef<IHttpRequest>& HttpRequest, const FHttpRequestCompleteDelegate& OnComplete, FString& OutKey);
+        // Closes the request registered under Key to new callers, then runs OnComplete and the completion delegate of every caller that joined it
+        static void Complete(const FString& Key, const FHttpRequestCompleteDelegate& OnComplete, FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded);
+        // Closes the request registered under Key when it could not be sent, and fails every caller that joined it; the sender is told through its own return value
+        static void Abandon(const FString& Key, FHttpRequestPtr HttpRequest);
+
+        // Number of calls that were answered by another call's request
+        static int32 GetCoalescedCount();
+    };
+}
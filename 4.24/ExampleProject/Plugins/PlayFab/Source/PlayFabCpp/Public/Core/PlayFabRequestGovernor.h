@@ -0,0 +1,48 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Http.h"
+
+namespace PlayFab
+{
+    enum class EPlayFabRequestPriority : uint8
+    {
+        Low,
+        Normal,
+        High
+    };
+
+    /**
+     * Limits the rate and concurrency of calls to each PlayFab endpoint ("/Client/UpdatePlayerStatistics").
+     * Each endpoint has a token bucket and a maximum number of calls in flight, configured in UPlayFabRuntimeSettings.
+     * Requests over the limit wait in a priority queue instead of being sent.
+     * Throttling errors halve the endpoint's rate, which then climbs back to the configured rate as calls succeed.
+     */
+    class PLAYFABCPP_API FPlayFabRequestGovernor
+    {
+    public:
+        // Sends the request now if its endpoint allows it, otherwise queues it; returns false if sending failed, in which case its slot is freed
+        // A queued request that fails to start has its slot freed and its completion delegate run without a response
+        static bool Submit(const TSharedRef<IHttpRequest>& HttpRequest, EPlayFabRequestPriority Priority);
+        // Must be called for every submitted request that has completed, to free its slot; it does nothing for a request that holds none
+        static void OnRequestComplete(const FHttpRequestPtr& HttpRequest, bool bWasThrottled);
+        // Removes a request that is still waiting in its queue; returns false if it has already been sent
+        static bool Withdraw(const FHttpRequestPtr& HttpRequest);
+
+        // Number of requests waiting to be sent, for one endpoint or for all of them
+        static int32 GetQueuedCount(const FString& UrlPath);
+        static int32 GetQueuedCount();
+        // Current, possibly lowered, rate of an endpoint in requests per second
+        static float GetCurrentRate(const FString& UrlPath);
+
+    private:
+        // Adds the ticker that drains the queues, on the game thread
+        static void SchedulePump();
+        static bool PumpQueues(float DeltaTime);
+    };
+}
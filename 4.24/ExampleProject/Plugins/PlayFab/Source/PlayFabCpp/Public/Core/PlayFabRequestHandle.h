@@ -0,0 +1,63 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PlayFab
+{
+    // A running call that a handle can stop, implemented by the request handler
+    class IPlayFabCancellable
+    {
+    public:
+        virtual ~IPlayFabCancellable() {}
+        virtual void Cancel() = 0;
+        virtual bool IsFinished() const = 0;
+        virtual bool IsCancelled() const = 0;
+        // Set once the call's delegates have run, or are certain not to; a finished call's result may still be queued for its delegates
+        virtual bool IsDelivered() const = 0;
+        // For result handlers that run the delegates later: the call then counts as delivered only once MarkDelivered is called
+        virtual void DeferDelivery() = 0;
+        virtual void MarkDelivered() = 0;
+    };
+
+    /**
+     * Lets the caller cancel PlayFab calls, and give them a deadline shorter than the engine's HTTP timeout.
+     * The same handle can be passed to any number of calls, e.g. every call made for one level or one matchmaking attempt.
+     * Once cancelled, none of its calls runs a delegate, and calls made with it afterwards are not sent.
+     * Cancel on the game thread, where responses are dispatched, for that guarantee to hold.
+     * A default constructed handle doesn't track anything; use Create.
+     */
+    class PLAYFABCPP_API FPlayFabRequestHandle
+    {
+    public:
+        FPlayFabRequestHandle() {}
+
+        // TimeoutSeconds is the time each call gets, retries included, before it fails with a timeout error; 0 for no limit
+        static FPlayFabRequestHandle Create(float TimeoutSeconds = 0.0f);
+
+        bool IsValid() const { return State.IsValid(); }
+        void Cancel() const;
+        bool IsCancelled() const;
+        float GetTimeout() const;
+        // Number of calls made with this handle whose delegates haven't run yet
+        int32 GetPendingCount() const;
+
+        // Adds a call to the handle; returns false if the handle is already cancelled, in which case the call must not be sent
+        bool Attach(const TSharedRef<IPlayFabCancellable, ESPMode::ThreadSafe>& Call) const;
+
+    private:
+        struct FState
+        {
+            FCriticalSection Lock;
+            bool bIsCancelled = false;
+            float TimeoutSeconds = 0.0f;
+            TArray<TWeakPtr<IPlayFabCancellable, ESPMode::ThreadSafe>> Calls;
+        };
+
+        TSharedPtr<FState, ESPMode::ThreadSafe> State;
+    };
+}
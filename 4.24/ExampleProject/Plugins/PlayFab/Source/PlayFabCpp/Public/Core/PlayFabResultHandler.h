@@ -10,18 +10,175 @@
 #include "PlayFabCppBaseModel.h"
 #include "PlayFabError.h"
 #include "PlayFabSettings.h"
+#include "PlayFabRequestGovernor.h"
+#include "PlayFabRequestHandle.h"
+#include "PlayFabConnectionWarmer.h"
+#include "PlayFabLatencyTracker.h"
+#include "PlayFabCircuitBreaker.h"
+#include "PlayFabEndpointMetrics.h"
+#include "PlayFabTrace.h"
 #include "Http.h"
+#include "Containers/Ticker.h"
 
 namespace PlayFab
 {
     class PlayFabRequestHandler
     {
     private:
-        static int pendingCalls;
+        static TSharedRef<IHttpRequest> CreateRequest(const FString& fullUrl, const FString& authKey, const FString& authValue);
+        // Reads the response envelope into OutResult (may be null) or OutError; returns false if it was not a PlayFab response
+        static bool DecodeResponse(const TArray<uint8>& ResponseContent, PlayFab::FPlayFabCppBaseModel* OutResult, PlayFab::FPlayFabCppError& OutError, bool& OutDecoded);
+        static void DecodeErrorDetails(FPlayFabJsonPullReader& Reader, PlayFab::FPlayFabCppError& OutError);
+        struct FCallState;
+        // Completion handler of every attempt; retries failures the retry policy accepts, and hands anything else to the caller's delegate
+        static void OnAttemptComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, TSharedRef<FCallState, ESPMode::ThreadSafe> CallState);
+        static void ScheduleRetry(FHttpRequestPtr FailedRequest, float Delay, TSharedRef<FCallState, ESPMode::ThreadSafe> CallState);
+        static void AddTickerOnGameThread(FTickerDelegate&& Delegate, float Delay);
+        // Sends a duplicate of a read call's first attempt, if that attempt is still on the wire
+        static void SendHedge(const TSharedRef<FCallState, ESPMode::ThreadSafe>& CallState);
+        // Unsent copy of a request, with the same verb, url, headers and body
+        static TSharedRef<IHttpRequest> CopyRequest(const FHttpRequestPtr& Original);
+        static void StopAttempt(const FHttpRequestPtr& Attempt);
+        // Marks the call as done and stops its current attempt; returns false if it was already done
+        static bool FinishCall(FCallState& CallState, bool bStopAttempt);
+        // Cleans up after a request that could not be sent: frees its governor slot, fails the callers that joined it, and ends the call
+        static void AbandonCall(FCallState& CallState, const FHttpRequestPtr& HttpRequest);
+        static void CancelCall(FCallState& CallState);
+        static void TimeOutCall(const TSharedRef<FCallState, ESPMode::ThreadSafe>& CallState);
+        // Runs the caller's completion delegate, unless the call has been cancelled
+        static void DeliverToCaller(const TSharedRef<FCallState, ESPMode::ThreadSafe>& CallState, FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded);
+        // The call whose result handler is running on this thread, if it could be cancelled; null outside of DeliverToCaller
+        static TSharedPtr<IPlayFabCancellable, ESPMode::ThreadSafe> GetDeliveringCall();
+        // Reads a response body into OutResult or OutError; returns false if it was not a PlayFab response
+        static bool DecodeBody(int32 ResponseCode, const TArray<uint8>& Content, const FString& ContentEncoding, PlayFab::FPlayFabCppBaseModel& OutResult, PlayFab::FPlayFabCppError& OutError, bool& OutDecoded);
+        // bCircuitOpen for a call that was failed fast by the circuit breaker, and never sent
+        static void SetNoResponseError(PlayFab::FPlayFabCppError& OutError, bool bCircuitOpen);
+        // A completed response, copied so that it can be decoded away from the engine's HTTP objects
+        struct FResponseSnapshot;
+        static bool IsDecodingInBackground();
+        static TSharedRef<FResponseSnapshot, ESPMode::ThreadSafe> TakeSnapshot(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded);
+        static bool DecodeSnapshot(const FResponseSnapshot& Snapshot, PlayFab::FPlayFabCppBaseModel& OutResult, PlayFab::FPlayFabCppError& OutError);
+        static void DecodeInBackground(TFunction<void()>&& Work);
+        static void DispatchResult(TFunction<void()>&& Deliver, bool bRequiresGameThread);
+        // Through the completion queue if it has a budget, so that a burst of responses is spread over several frames
+        static void DispatchToGameThread(TFunction<void()>&& Deliver);
     public:
+        // Takes the work that runs a call's result delegates, and runs it wherever the game wants them, e.g. from a queue it drains itself
+        typedef TFunction<void(TFunction<void()>&&)> FResponseDispatcher;
+        // Unset by default, in which case UPlayFabRuntimeSettings::ResponseDispatch decides
+        static void SetResponseDispatcher(FResponseDispatcher Dispatcher);
+
+        // Opens connections to the title endpoint ahead of the first call; false if the title id isn't set yet
+        static bool Prewarm();
+        static FPlayFabConnectionStats GetConnectionStats();
+        // Duplicates sent for slow read calls, see UPlayFabRuntimeSettings::bEnableRequestHedging
+        static FPlayFabHedgingStats GetHedgingStats();
+        // Latency histograms and byte counts per endpoint ("/Client/GetTitleData"), see UPlayFabRuntimeSettings::bCollectEndpointMetrics
+        static bool GetEndpointMetrics(const FString& UrlPath, FPlayFabEndpointMetrics& OutMetrics);
+        static TMap<FString, FPlayFabEndpointMetrics> GetEndpointMetrics();
+
+        // Number of PlayFab calls in flight, see PlayFabCommon::FPlayFabCallCounters for per-API and per-endpoint counts
         static int GetPendingCalls();
         static TSharedRef<IHttpRequest> SendRequest(TSharedPtr<UPlayFabAPISettings> settings, const FString& urlPath, const FString& callBody, const FString& authKey, const FString& authValue);
+        static TSharedRef<IHttpRequest> SendRequest(TSharedPtr<UPlayFabAPISettings> settings, const FString& urlPath, const TArray<uint8>& callBody, const FString& authKey, const FString& authValue);
         static TSharedRef<IHttpRequest> SendFullUrlRequest(const FString& fullUrl, const FString& callBody, const FString& authKey, const FString& authValue);
+        static TSharedRef<IHttpRequest> SendFullUrlRequest(const FString& fullUrl, const TArray<uint8>& callBody, const FString& authKey, const FString& authValue);
+        // Sends a request whose completion delegate is bound, through the request governor
+        // The delegate runs once, with the final attempt, after any automatic retries
+        // It doesn't run at all if the call is cancelled through Handle; if the handle's timeout expires it runs with a timeout error
+        // Returns false only if the request could not be sent, in which case the delegate doesn't run either
+        // A call the circuit breaker turns away returns true, and its delegate runs on the next tick with PlayFabErrorCircuitOpen
+        static bool ProcessRequest(const TSharedRef<IHttpRequest>& HttpRequest, bool bIsIdempotent, EPlayFabRequestPriority Priority = EPlayFabRequestPriority::Normal, const FPlayFabRequestHandle& Handle = FPlayFabRequestHandle());
+        // Binds the result handler of an instance API; weakly if the instance is owned by a shared pointer, so that it can be destroyed with calls in flight
+        // Instances that aren't owned by a shared pointer are bound raw, and must outlive their calls
+        template <typename UserClass, typename... VarTypes>
+        static void BindInstanceResult(const TSharedRef<IHttpRequest>& HttpRequest, UserClass* Instance, void (UserClass::*Handler)(FHttpRequestPtr, FHttpResponsePtr, bool, VarTypes...), VarTypes... Vars)
+        {
+            if (Instance->DoesSharedInstanceExist())
+            {
+                HttpRequest->OnProcessRequestComplete().BindSP(Instance, Handler, Vars...);
+            }
+            else
+            {
+                HttpRequest->OnProcessRequestComplete().BindRaw(Instance, Handler, Vars...);
+            }
+        }
+        // Runs the caller's completion delegate; if its object is gone the response is dropped and the call ended here
+        static void DeliverToCaller(const FHttpRequestCompleteDelegate& OnComplete, FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded);
+        // Decodes a response into ResultType, then runs OnSuccess with it or ErrorDelegate
+        // Decoding happens on a worker if UPlayFabRuntimeSettings::bDecodeResponsesInBackground is set; the delegates run where the response dispatcher puts them
+        // bRequiresGameThread overrides the dispatcher, for calls whose OnSuccess updates credentials or creates UObjects
+        // Neither delegate runs if the call is cancelled before they would, wherever the result was waiting
+        template <typename ResultType>
+        static void DecodeAndDispatch(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, TFunction<void(ResultType&)>&& OnSuccess, const FPlayFabErrorDelegate& ErrorDelegate, bool bRequiresGameThread = false)
+        {
+            struct FDecoded
+            {
+                ResultType Result;
+                FPlayFabCppError Error;
+                bool bIsSuccess = false;
+            };
+
+            TSharedRef<FDecoded, ESPMode::ThreadSafe> Decoded = MakeShared<FDecoded, ESPMode::ThreadSafe>();
+            const FString MetricsPath = FPlayFabMetrics::GetMetricsPath(HttpRequest);
+            const uint64 TraceId = PlayFabCommon::FPlayFabTrace::GetRequestId(HttpRequest);
+            const TSharedPtr<IPlayFabCancellable, ESPMode::ThreadSafe> Call = GetDeliveringCall();
+            if (Call.IsValid())
+            {
+                Call->DeferDelivery();
+            }
+            TFunction<void()> Deliver = [Decoded, OnSuccess = MoveTemp(OnSuccess), ErrorDelegate, MetricsPath, TraceId, Call]()
+            {
+                if (Call.IsValid() && Call->IsCancelled())
+                {
+                    Call->MarkDelivered();
+                    return;
+                }
+
+                PLAYFAB_TRACE_SCOPE(Dispatch, TraceId);
+                SCOPE_CYCLE_COUNTER(STAT_PlayFabDelegates);
+                CSV_SCOPED_TIMING_STAT(PlayFab, Delegates);
+                FPlayFabMetricScope Scope(MetricsPath, EPlayFabMetricStage::Delegates);
+                if (Decoded->bIsSuccess)
+                {
+                    OnSuccess(Decoded->Result);
+                }
+                else
+                {
+                    ErrorDelegate.ExecuteIfBound(Decoded->Error);
+                }
+                if (Call.IsValid())
+                {
+                    Call->MarkDelivered();
+                }
+            };
+
+            if (!IsDecodingInBackground())
+            {
+                {
+                    PLAYFAB_TRACE_SCOPE(Decode, TraceId);
+                    SCOPE_CYCLE_COUNTER(STAT_PlayFabDecode);
+                    CSV_SCOPED_TIMING_STAT(PlayFab, Decode);
+                    FPlayFabMetricScope Scope(MetricsPath, EPlayFabMetricStage::Decode);
+                    Decoded->bIsSuccess = DecodeRequest(HttpRequest, HttpResponse, bSucceeded, Decoded->Result, Decoded->Error);
+                }
+                DispatchResult(MoveTemp(Deliver), bRequiresGameThread);
+                return;
+            }
+
+            TSharedRef<FResponseSnapshot, ESPMode::ThreadSafe> Snapshot = TakeSnapshot(HttpRequest, HttpResponse, bSucceeded);
+            DecodeInBackground([Snapshot, Decoded, Deliver = MoveTemp(Deliver), bRequiresGameThread, MetricsPath, TraceId]() mutable
+            {
+                {
+                    PLAYFAB_TRACE_SCOPE(Decode, TraceId);
+                    SCOPE_CYCLE_COUNTER(STAT_PlayFabDecode);
+                    CSV_SCOPED_TIMING_STAT(PlayFab, Decode);
+                    FPlayFabMetricScope Scope(MetricsPath, EPlayFabMetricStage::Decode);
+                    Decoded->bIsSuccess = DecodeSnapshot(*Snapshot, Decoded->Result, Decoded->Error);
+                }
+                DispatchResult(MoveTemp(Deliver), bRequiresGameThread);
+            });
+        }
         static bool DecodeRequest(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, PlayFab::FPlayFabCppBaseModel& OutResult, PlayFab::FPlayFabCppError& OutError);
         static bool DecodeError(TSharedPtr<FJsonObject> JsonObject, PlayFab::FPlayFabCppError& OutError);
     };
@@ -12,6 +12,7 @@
 
 #include "PfTestActor.generated.h"
 
+class UPlayFabCppCoreTests;
 class UPlayFabCppTests;
 class UPlayFabBlueprintTests;
 
@@ -46,6 +47,8 @@ private:
     UPROPERTY()
     FString outputSummary;
     UPROPERTY()
+    UPlayFabCppCoreTests* pCppCoreTests;
+    UPROPERTY()
     UPlayFabCppTests* pCppTests;
     UPROPERTY()
     UPlayFabBlueprintTests* pBpTests;
@@ -16,6 +16,12 @@
 #include "PlayFabEnums.h"
 #include "PlayFabCommon/Public/PlayFabAuthenticationContext.h"
 #include "PlayFabCommon/Public/PlayFabCommonUtils.h"
+#include "PlayFabCommon/Public/PlayFabCallCounters.h"
+#include "PlayFabCommon/Public/PlayFabTrace.h"
+#include "PlayFabCommon/Public/PlayFabRequestLog.h"
+#include "PlayFabObjectPool.h"
+#include "PlayFabRequestWriter.h"
+#include "Misc/ScopeExit.h"
 
 UPlayFabAdminAPI::UPlayFabAdminAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -30,7 +36,26 @@ void UPlayFabAdminAPI::SetCallAuthenticationContext(UPlayFabAuthenticationContex
 
 void UPlayFabAdminAPI::SetRequestObject(UPlayFabJsonObject* JsonObject)
 {
+    // The object replaces any body serialized before, and is serialized in Activate
     RequestJsonObj = JsonObject;
+    RequestBody.Reset();
+}
+
+void UPlayFabAdminAPI::SetRequestBody(TArray<uint8>&& Body)
+{
+    RequestBody = MoveTemp(Body);
+    RequestJsonObj = nullptr;
+}
+
+UPlayFabJsonObject* UPlayFabAdminAPI::GetRequestObject()
+{
+    if (RequestJsonObj == nullptr && RequestBody.Num() > 0)
+    {
+        // Only the few results that hand the request back to Blueprint pay for parsing it
+        RequestJsonObj = NewObject<UPlayFabJsonObject>();
+        RequestJsonObj->DecodeJson(FPlayFabRequestWriter::ToString(RequestBody));
+    }
+    return RequestJsonObj;
 }
 
 UPlayFabJsonObject* UPlayFabAdminAPI::GetResponseObject()
@@ -40,31 +65,7 @@ UPlayFabJsonObject* UPlayFabAdminAPI::GetResponseObject()
 
 FString UPlayFabAdminAPI::PercentEncode(const FString& Text)
 {
-    FString OutText = Text;
-
-    OutText = OutText.Replace(TEXT("!"), TEXT("%21"));
-    OutText = OutText.Replace(TEXT("\""), TEXT("%22"));
-    OutText = OutText.Replace(TEXT("#"), TEXT("%23"));
-    OutText = OutText.Replace(TEXT("$"), TEXT("%24"));
-    //OutText = OutText.Replace(TEXT("&"), TEXT("%26"));
-    OutText = OutText.Replace(TEXT("'"), TEXT("%27"));
-    OutText = OutText.Replace(TEXT("("), TEXT("%28"));
-    OutText = OutText.Replace(TEXT(")"), TEXT("%29"));
-    OutText = OutText.Replace(TEXT("*"), TEXT("%2A"));
-    OutText = OutText.Replace(TEXT("+"), TEXT("%2B"));
-    OutText = OutText.Replace(TEXT(","), TEXT("%2C"));
-    //OutText = OutText.Replace(TEXT("/"), TEXT("%2F"));
-    OutText = OutText.Replace(TEXT(":"), TEXT("%3A"));
-    OutText = OutText.Replace(TEXT(";"), TEXT("%3B"));
-    OutText = OutText.Replace(TEXT("="), TEXT("%3D"));
-    //OutText = OutText.Replace(TEXT("?"), TEXT("%3F"));
-    OutText = OutText.Replace(TEXT("@"), TEXT("%40"));
-    OutText = OutText.Replace(TEXT("["), TEXT("%5B"));
-    OutText = OutText.Replace(TEXT("]"), TEXT("%5D"));
-    OutText = OutText.Replace(TEXT("{"), TEXT("%7B"));
-    OutText = OutText.Replace(TEXT("}"), TEXT("%7D"));
-
-    return OutText;
+    return PlayFabCommon::PlayFabCommonUtils::PercentEncode(Text);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -82,9 +83,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::BanUsers(FAdminBanUsersRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -98,16 +97,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::BanUsers(FAdminBanUsersRequest request,
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Bans.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Bans"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Bans"), request.Bans);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObjectArray(TEXT("Bans"), request.Bans);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -125,7 +121,7 @@ void UPlayFabAdminAPI::HelperBanUsers(FPlayFabBaseModel response, UObject* custo
         FAdminBanUsersResult ResultStruct = UPlayFabAdminModelDecoder::decodeBanUsersResultResponse(response.responseData);
         OnSuccessBanUsers.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessBanUsers.Unbind();
 }
 
 /** Removes a master player account entirely from all titles and deletes all associated data */
@@ -135,9 +131,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteMasterPlayerAccount(FAdminDeleteMaster
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -151,20 +145,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteMasterPlayerAccount(FAdminDeleteMaster
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.MetaData.IsEmpty() || request.MetaData == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("MetaData"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("MetaData"), request.MetaData);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("MetaData"), request.MetaData);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -182,7 +169,7 @@ void UPlayFabAdminAPI::HelperDeleteMasterPlayerAccount(FPlayFabBaseModel respons
         FAdminDeleteMasterPlayerAccountResult ResultStruct = UPlayFabAdminModelDecoder::decodeDeleteMasterPlayerAccountResultResponse(response.responseData);
         OnSuccessDeleteMasterPlayerAccount.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteMasterPlayerAccount.Unbind();
 }
 
 /** Removes a user's player account from a title and deletes all associated data */
@@ -192,9 +179,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeletePlayer(FAdminDeletePlayerRequest reque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -208,15 +193,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeletePlayer(FAdminDeletePlayerRequest reque
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -234,7 +216,7 @@ void UPlayFabAdminAPI::HelperDeletePlayer(FPlayFabBaseModel response, UObject* c
         FAdminDeletePlayerResult ResultStruct = UPlayFabAdminModelDecoder::decodeDeletePlayerResultResponse(response.responseData);
         OnSuccessDeletePlayer.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeletePlayer.Unbind();
 }
 
 /** Permanently deletes a title and all associated configuration */
@@ -244,9 +226,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteTitle(FAdminDeleteTitleRequest request
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -260,10 +240,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteTitle(FAdminDeleteTitleRequest request
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -281,7 +262,7 @@ void UPlayFabAdminAPI::HelperDeleteTitle(FPlayFabBaseModel response, UObject* cu
         FAdminDeleteTitleResult ResultStruct = UPlayFabAdminModelDecoder::decodeDeleteTitleResultResponse(response.responseData);
         OnSuccessDeleteTitle.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteTitle.Unbind();
 }
 
 /** Exports all associated data of a master player account */
@@ -291,9 +272,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ExportMasterPlayerData(FAdminExportMasterPla
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -307,15 +286,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ExportMasterPlayerData(FAdminExportMasterPla
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -333,7 +309,7 @@ void UPlayFabAdminAPI::HelperExportMasterPlayerData(FPlayFabBaseModel response,
         FAdminExportMasterPlayerDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeExportMasterPlayerDataResultResponse(response.responseData);
         OnSuccessExportMasterPlayerData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessExportMasterPlayerData.Unbind();
 }
 
 /** Get the list of titles that the player has played */
@@ -343,9 +319,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayedTitleList(FAdminGetPlayedTitleListR
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -359,15 +333,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayedTitleList(FAdminGetPlayedTitleListR
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -385,7 +356,7 @@ void UPlayFabAdminAPI::HelperGetPlayedTitleList(FPlayFabBaseModel response, UObj
         FAdminGetPlayedTitleListResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetPlayedTitleListResultResponse(response.responseData);
         OnSuccessGetPlayedTitleList.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayedTitleList.Unbind();
 }
 
 /** Gets a player's ID from an auth token. */
@@ -395,9 +366,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerIdFromAuthToken(FAdminGetPlayerIdFr
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -411,18 +380,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerIdFromAuthToken(FAdminGetPlayerIdFr
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Token.IsEmpty() || request.Token == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Token"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Token"), request.Token);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Token"), request.Token);
     FString temp_TokenType;
     if (GetEnumValueToString<EAuthTokenType>(TEXT("EAuthTokenType"), request.TokenType, temp_TokenType))
-        OutRestJsonObj->SetStringField(TEXT("TokenType"), temp_TokenType);
+        RequestWriter.WriteString(TEXT("TokenType"), temp_TokenType);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -440,7 +406,7 @@ void UPlayFabAdminAPI::HelperGetPlayerIdFromAuthToken(FPlayFabBaseModel response
         FAdminGetPlayerIdFromAuthTokenResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetPlayerIdFromAuthTokenResultResponse(response.responseData);
         OnSuccessGetPlayerIdFromAuthToken.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerIdFromAuthToken.Unbind();
 }
 
 /** Retrieves the player's profile */
@@ -450,9 +416,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerProfile(FAdminGetPlayerProfileReque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -466,17 +430,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerProfile(FAdminGetPlayerProfileReque
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteObject(TEXT("ProfileConstraints"), request.ProfileConstraints);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -494,7 +455,7 @@ void UPlayFabAdminAPI::HelperGetPlayerProfile(FPlayFabBaseModel response, UObjec
         FAdminGetPlayerProfileResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetPlayerProfileResultResponse(response.responseData);
         OnSuccessGetPlayerProfile.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerProfile.Unbind();
 }
 
 /** Retrieves the relevant details for a specified user, based upon a match against a supplied unique identifier */
@@ -504,9 +465,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserAccountInfo(FAdminLookupUserAccountIn
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -520,30 +479,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserAccountInfo(FAdminLookupUserAccountIn
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.TitleDisplayName.IsEmpty() || request.TitleDisplayName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TitleDisplayName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TitleDisplayName"), request.TitleDisplayName);
-    }
-    if (request.Username.IsEmpty() || request.Username == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Username"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Username"), request.Username);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Email"), request.Email);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("TitleDisplayName"), request.TitleDisplayName);
+    RequestWriter.WriteStringOrNull(TEXT("Username"), request.Username);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -561,7 +505,7 @@ void UPlayFabAdminAPI::HelperGetUserAccountInfo(FPlayFabBaseModel response, UObj
         FAdminLookupUserAccountInfoResult ResultStruct = UPlayFabAdminModelDecoder::decodeLookupUserAccountInfoResultResponse(response.responseData);
         OnSuccessGetUserAccountInfo.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserAccountInfo.Unbind();
 }
 
 /** Gets all bans for a user. */
@@ -571,9 +515,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserBans(FAdminGetUserBansRequest request
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -587,15 +529,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserBans(FAdminGetUserBansRequest request
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -613,7 +552,7 @@ void UPlayFabAdminAPI::HelperGetUserBans(FPlayFabBaseModel response, UObject* cu
         FAdminGetUserBansResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetUserBansResultResponse(response.responseData);
         OnSuccessGetUserBans.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserBans.Unbind();
 }
 
 /** Reset a player's password for a given title. */
@@ -623,9 +562,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ResetPassword(FAdminResetPasswordRequest req
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -639,21 +576,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ResetPassword(FAdminResetPasswordRequest req
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Password.IsEmpty() || request.Password == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Password"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Password"), request.Password);
-    }
-    if (request.Token.IsEmpty() || request.Token == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Token"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Token"), request.Token);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Password"), request.Password);
+    RequestWriter.WriteStringOrNull(TEXT("Token"), request.Token);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -671,7 +601,7 @@ void UPlayFabAdminAPI::HelperResetPassword(FPlayFabBaseModel response, UObject*
         FAdminResetPasswordResult ResultStruct = UPlayFabAdminModelDecoder::decodeResetPasswordResultResponse(response.responseData);
         OnSuccessResetPassword.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessResetPassword.Unbind();
 }
 
 /** Revoke all active bans for a user. */
@@ -681,9 +611,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RevokeAllBansForUser(FAdminRevokeAllBansForU
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -697,15 +625,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RevokeAllBansForUser(FAdminRevokeAllBansForU
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -723,7 +648,7 @@ void UPlayFabAdminAPI::HelperRevokeAllBansForUser(FPlayFabBaseModel response, UO
         FAdminRevokeAllBansForUserResult ResultStruct = UPlayFabAdminModelDecoder::decodeRevokeAllBansForUserResultResponse(response.responseData);
         OnSuccessRevokeAllBansForUser.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRevokeAllBansForUser.Unbind();
 }
 
 /** Revoke all active bans specified with BanId. */
@@ -733,9 +658,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RevokeBans(FAdminRevokeBansRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -749,18 +672,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RevokeBans(FAdminRevokeBansRequest request,
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.BanIds.IsEmpty() || request.BanIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BanIds"));
-    } else {
-        TArray<FString> BanIdsArray;
-        FString(request.BanIds).ParseIntoArray(BanIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("BanIds"), BanIdsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("BanIds"), request.BanIds);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -778,7 +695,7 @@ void UPlayFabAdminAPI::HelperRevokeBans(FPlayFabBaseModel response, UObject* cus
         FAdminRevokeBansResult ResultStruct = UPlayFabAdminModelDecoder::decodeRevokeBansResultResponse(response.responseData);
         OnSuccessRevokeBans.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRevokeBans.Unbind();
 }
 
 /** Forces an email to be sent to the registered email address for the user's account, with a link allowing the user to change the password.If an account recovery email template ID is provided, an email using the custom email template will be used. */
@@ -788,9 +705,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SendAccountRecoveryEmail(FAdminSendAccountRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -804,21 +719,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SendAccountRecoveryEmail(FAdminSendAccountRe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    if (request.EmailTemplateId.IsEmpty() || request.EmailTemplateId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EmailTemplateId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EmailTemplateId"), request.EmailTemplateId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Email"), request.Email);
+    RequestWriter.WriteStringOrNull(TEXT("EmailTemplateId"), request.EmailTemplateId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -836,7 +744,7 @@ void UPlayFabAdminAPI::HelperSendAccountRecoveryEmail(FPlayFabBaseModel response
         FAdminSendAccountRecoveryEmailResult ResultStruct = UPlayFabAdminModelDecoder::decodeSendAccountRecoveryEmailResultResponse(response.responseData);
         OnSuccessSendAccountRecoveryEmail.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSendAccountRecoveryEmail.Unbind();
 }
 
 /** Updates information of a list of existing bans specified with Ban Ids. */
@@ -846,9 +754,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateBans(FAdminUpdateBansRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -862,15 +768,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateBans(FAdminUpdateBansRequest request,
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Bans.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Bans"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Bans"), request.Bans);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObjectArray(TEXT("Bans"), request.Bans);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -888,7 +791,7 @@ void UPlayFabAdminAPI::HelperUpdateBans(FPlayFabBaseModel response, UObject* cus
         FAdminUpdateBansResult ResultStruct = UPlayFabAdminModelDecoder::decodeUpdateBansResultResponse(response.responseData);
         OnSuccessUpdateBans.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateBans.Unbind();
 }
 
 /** Updates the title specific display name for a user */
@@ -898,9 +801,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserTitleDisplayName(FAdminUpdateUserT
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -914,21 +815,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserTitleDisplayName(FAdminUpdateUserT
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.DisplayName.IsEmpty() || request.DisplayName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DisplayName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DisplayName"), request.DisplayName);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("DisplayName"), request.DisplayName);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -946,7 +840,7 @@ void UPlayFabAdminAPI::HelperUpdateUserTitleDisplayName(FPlayFabBaseModel respon
         FAdminUpdateUserTitleDisplayNameResult ResultStruct = UPlayFabAdminModelDecoder::decodeUpdateUserTitleDisplayNameResultResponse(response.responseData);
         OnSuccessUpdateUserTitleDisplayName.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateUserTitleDisplayName.Unbind();
 }
 
 
@@ -960,9 +854,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreateOpenIdConnection(FAdminCreateOpenIdCon
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -976,32 +868,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreateOpenIdConnection(FAdminCreateOpenIdCon
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.ClientId.IsEmpty() || request.ClientId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ClientId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ClientId"), request.ClientId);
-    }
-    if (request.ClientSecret.IsEmpty() || request.ClientSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ClientSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ClientSecret"), request.ClientSecret);
-    }
-    if (request.ConnectionId.IsEmpty() || request.ConnectionId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ConnectionId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ConnectionId"), request.ConnectionId);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("IgnoreNonce"), request.IgnoreNonce);
-    if (request.IssuerDiscoveryUrl.IsEmpty() || request.IssuerDiscoveryUrl == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("IssuerDiscoveryUrl"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("IssuerDiscoveryUrl"), request.IssuerDiscoveryUrl);
-    }
-    if (request.IssuerInformation != nullptr) OutRestJsonObj->SetObjectField(TEXT("IssuerInformation"), request.IssuerInformation);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("ClientId"), request.ClientId);
+    RequestWriter.WriteStringOrNull(TEXT("ClientSecret"), request.ClientSecret);
+    RequestWriter.WriteStringOrNull(TEXT("ConnectionId"), request.ConnectionId);
+    RequestWriter.WriteBool(TEXT("IgnoreNonce"), request.IgnoreNonce);
+    RequestWriter.WriteStringOrNull(TEXT("IssuerDiscoveryUrl"), request.IssuerDiscoveryUrl);
+    RequestWriter.WriteObject(TEXT("IssuerInformation"), request.IssuerInformation);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1019,7 +896,7 @@ void UPlayFabAdminAPI::HelperCreateOpenIdConnection(FPlayFabBaseModel response,
         FAdminEmptyResponse ResultStruct = UPlayFabAdminModelDecoder::decodeEmptyResponseResponse(response.responseData);
         OnSuccessCreateOpenIdConnection.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateOpenIdConnection.Unbind();
 }
 
 /** Creates a new Player Shared Secret Key. It may take up to 5 minutes for this key to become generally available after this API returns. */
@@ -1029,9 +906,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreatePlayerSharedSecret(FAdminCreatePlayerS
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1045,15 +920,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreatePlayerSharedSecret(FAdminCreatePlayerS
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.FriendlyName.IsEmpty() || request.FriendlyName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendlyName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendlyName"), request.FriendlyName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("FriendlyName"), request.FriendlyName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1071,7 +943,7 @@ void UPlayFabAdminAPI::HelperCreatePlayerSharedSecret(FPlayFabBaseModel response
         FAdminCreatePlayerSharedSecretResult ResultStruct = UPlayFabAdminModelDecoder::decodeCreatePlayerSharedSecretResultResponse(response.responseData);
         OnSuccessCreatePlayerSharedSecret.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreatePlayerSharedSecret.Unbind();
 }
 
 /** Removes a relationship between a title and an OpenID Connect provider. */
@@ -1081,9 +953,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteOpenIdConnection(FAdminDeleteOpenIdCon
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1097,15 +967,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteOpenIdConnection(FAdminDeleteOpenIdCon
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.ConnectionId.IsEmpty() || request.ConnectionId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ConnectionId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ConnectionId"), request.ConnectionId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("ConnectionId"), request.ConnectionId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1121,10 +988,10 @@ void UPlayFabAdminAPI::HelperDeleteOpenIdConnection(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessDeleteOpenIdConnection.IsBound())
     {
         FAdminEmptyResponse ResultStruct = UPlayFabAdminModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessDeleteOpenIdConnection.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteOpenIdConnection.Unbind();
 }
 
 /** Deletes an existing Player Shared Secret Key. It may take up to 5 minutes for this delete to be reflected after this API returns. */
@@ -1134,9 +1001,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeletePlayerSharedSecret(FAdminDeletePlayerS
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1150,15 +1015,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeletePlayerSharedSecret(FAdminDeletePlayerS
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.SecretKey.IsEmpty() || request.SecretKey == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SecretKey"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SecretKey"), request.SecretKey);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("SecretKey"), request.SecretKey);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1176,7 +1038,7 @@ void UPlayFabAdminAPI::HelperDeletePlayerSharedSecret(FPlayFabBaseModel response
         FAdminDeletePlayerSharedSecretResult ResultStruct = UPlayFabAdminModelDecoder::decodeDeletePlayerSharedSecretResultResponse(response.responseData);
         OnSuccessDeletePlayerSharedSecret.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeletePlayerSharedSecret.Unbind();
 }
 
 /** Returns all Player Shared Secret Keys including disabled and expired. */
@@ -1186,9 +1048,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerSharedSecrets(FAdminGetPlayerShared
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1202,10 +1062,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerSharedSecrets(FAdminGetPlayerShared
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1223,7 +1084,7 @@ void UPlayFabAdminAPI::HelperGetPlayerSharedSecrets(FPlayFabBaseModel response,
         FAdminGetPlayerSharedSecretsResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetPlayerSharedSecretsResultResponse(response.responseData);
         OnSuccessGetPlayerSharedSecrets.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerSharedSecrets.Unbind();
 }
 
 /** Gets the requested policy. */
@@ -1233,9 +1094,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPolicy(FAdminGetPolicyRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1249,15 +1108,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPolicy(FAdminGetPolicyRequest request,
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.PolicyName.IsEmpty() || request.PolicyName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PolicyName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PolicyName"), request.PolicyName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("PolicyName"), request.PolicyName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1275,7 +1131,7 @@ void UPlayFabAdminAPI::HelperGetPolicy(FPlayFabBaseModel response, UObject* cust
         FAdminGetPolicyResponse ResultStruct = UPlayFabAdminModelDecoder::decodeGetPolicyResponseResponse(response.responseData);
         OnSuccessGetPolicy.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPolicy.Unbind();
 }
 
 /** Retrieves a list of all Open ID Connect providers registered to a title. */
@@ -1285,9 +1141,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ListOpenIdConnection(FAdminListOpenIdConnect
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1301,10 +1155,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ListOpenIdConnection(FAdminListOpenIdConnect
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1322,7 +1177,7 @@ void UPlayFabAdminAPI::HelperListOpenIdConnection(FPlayFabBaseModel response, UO
         FAdminListOpenIdConnectionResponse ResultStruct = UPlayFabAdminModelDecoder::decodeListOpenIdConnectionResponseResponse(response.responseData);
         OnSuccessListOpenIdConnection.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListOpenIdConnection.Unbind();
 }
 
 /** Sets or resets the player's secret. Player secrets are used to sign API requests. */
@@ -1332,9 +1187,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetPlayerSecret(FAdminSetPlayerSecretRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1348,20 +1201,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetPlayerSecret(FAdminSetPlayerSecretRequest
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("PlayerSecret"), request.PlayerSecret);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1379,7 +1225,7 @@ void UPlayFabAdminAPI::HelperSetPlayerSecret(FPlayFabBaseModel response, UObject
         FAdminSetPlayerSecretResult ResultStruct = UPlayFabAdminModelDecoder::decodeSetPlayerSecretResultResponse(response.responseData);
         OnSuccessSetPlayerSecret.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetPlayerSecret.Unbind();
 }
 
 /** Modifies data and credentials for an existing relationship between a title and an Open ID Connect provider */
@@ -1389,9 +1235,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateOpenIdConnection(FAdminUpdateOpenIdCon
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1405,31 +1249,16 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateOpenIdConnection(FAdminUpdateOpenIdCon
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.ClientId.IsEmpty() || request.ClientId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ClientId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ClientId"), request.ClientId);
-    }
-    if (request.ClientSecret.IsEmpty() || request.ClientSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ClientSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ClientSecret"), request.ClientSecret);
-    }
-    if (request.ConnectionId.IsEmpty() || request.ConnectionId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ConnectionId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ConnectionId"), request.ConnectionId);
-    }
-    if (request.IssuerDiscoveryUrl.IsEmpty() || request.IssuerDiscoveryUrl == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("IssuerDiscoveryUrl"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("IssuerDiscoveryUrl"), request.IssuerDiscoveryUrl);
-    }
-    if (request.IssuerInformation != nullptr) OutRestJsonObj->SetObjectField(TEXT("IssuerInformation"), request.IssuerInformation);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("ClientId"), request.ClientId);
+    RequestWriter.WriteStringOrNull(TEXT("ClientSecret"), request.ClientSecret);
+    RequestWriter.WriteStringOrNull(TEXT("ConnectionId"), request.ConnectionId);
+    RequestWriter.WriteStringOrNull(TEXT("IssuerDiscoveryUrl"), request.IssuerDiscoveryUrl);
+    RequestWriter.WriteObject(TEXT("IssuerInformation"), request.IssuerInformation);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1445,10 +1274,10 @@ void UPlayFabAdminAPI::HelperUpdateOpenIdConnection(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessUpdateOpenIdConnection.IsBound())
     {
         FAdminEmptyResponse ResultStruct = UPlayFabAdminModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateOpenIdConnection.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateOpenIdConnection.Unbind();
 }
 
 /** Updates a existing Player Shared Secret Key. It may take up to 5 minutes for this update to become generally available after this API returns. */
@@ -1458,9 +1287,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdatePlayerSharedSecret(FAdminUpdatePlayerS
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1474,21 +1301,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdatePlayerSharedSecret(FAdminUpdatePlayerS
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("Disabled"), request.Disabled);
-    if (request.FriendlyName.IsEmpty() || request.FriendlyName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendlyName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendlyName"), request.FriendlyName);
-    }
-    if (request.SecretKey.IsEmpty() || request.SecretKey == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SecretKey"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SecretKey"), request.SecretKey);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("Disabled"), request.Disabled);
+    RequestWriter.WriteStringOrNull(TEXT("FriendlyName"), request.FriendlyName);
+    RequestWriter.WriteStringOrNull(TEXT("SecretKey"), request.SecretKey);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1506,7 +1326,7 @@ void UPlayFabAdminAPI::HelperUpdatePlayerSharedSecret(FPlayFabBaseModel response
         FAdminUpdatePlayerSharedSecretResult ResultStruct = UPlayFabAdminModelDecoder::decodeUpdatePlayerSharedSecretResultResponse(response.responseData);
         OnSuccessUpdatePlayerSharedSecret.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdatePlayerSharedSecret.Unbind();
 }
 
 /** Changes a policy for a title */
@@ -1516,9 +1336,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdatePolicy(FAdminUpdatePolicyRequest reque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1532,22 +1350,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdatePolicy(FAdminUpdatePolicyRequest reque
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("OverwritePolicy"), request.OverwritePolicy);
-    if (request.PolicyName.IsEmpty() || request.PolicyName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PolicyName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PolicyName"), request.PolicyName);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("PolicyVersion"), request.PolicyVersion);
-    if (request.Statements.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Statements"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Statements"), request.Statements);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("OverwritePolicy"), request.OverwritePolicy);
+    RequestWriter.WriteStringOrNull(TEXT("PolicyName"), request.PolicyName);
+    RequestWriter.WriteNumber(TEXT("PolicyVersion"), request.PolicyVersion);
+    RequestWriter.WriteObjectArray(TEXT("Statements"), request.Statements);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1565,7 +1376,7 @@ void UPlayFabAdminAPI::HelperUpdatePolicy(FPlayFabBaseModel response, UObject* c
         FAdminUpdatePolicyResponse ResultStruct = UPlayFabAdminModelDecoder::decodeUpdatePolicyResponseResponse(response.responseData);
         OnSuccessUpdatePolicy.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdatePolicy.Unbind();
 }
 
 
@@ -1579,9 +1390,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ResetCharacterStatistics(FAdminResetCharacte
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1595,21 +1404,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ResetCharacterStatistics(FAdminResetCharacte
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1627,7 +1429,7 @@ void UPlayFabAdminAPI::HelperResetCharacterStatistics(FPlayFabBaseModel response
         FAdminResetCharacterStatisticsResult ResultStruct = UPlayFabAdminModelDecoder::decodeResetCharacterStatisticsResultResponse(response.responseData);
         OnSuccessResetCharacterStatistics.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessResetCharacterStatistics.Unbind();
 }
 
 
@@ -1641,9 +1443,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteContent(FAdminDeleteContentRequest req
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1657,15 +1457,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteContent(FAdminDeleteContentRequest req
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Key"), request.Key);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1683,7 +1480,7 @@ void UPlayFabAdminAPI::HelperDeleteContent(FPlayFabBaseModel response, UObject*
         FAdminBlankResult ResultStruct = UPlayFabAdminModelDecoder::decodeBlankResultResponse(response.responseData);
         OnSuccessDeleteContent.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteContent.Unbind();
 }
 
 /** List all contents of the title and get statistics such as size */
@@ -1693,9 +1490,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetContentList(FAdminGetContentListRequest r
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1709,15 +1504,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetContentList(FAdminGetContentListRequest r
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Prefix.IsEmpty() || request.Prefix == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Prefix"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Prefix"), request.Prefix);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Prefix"), request.Prefix);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1735,7 +1527,7 @@ void UPlayFabAdminAPI::HelperGetContentList(FPlayFabBaseModel response, UObject*
         FAdminGetContentListResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetContentListResultResponse(response.responseData);
         OnSuccessGetContentList.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetContentList.Unbind();
 }
 
 /** Retrieves the pre-signed URL for uploading a content file. A subsequent HTTP PUT to the returned URL uploads the content. Also, please be aware that the Content service is specifically PlayFab's CDN offering, for which standard CDN rates apply. */
@@ -1745,9 +1537,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetContentUploadUrl(FAdminGetContentUploadUr
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1761,20 +1551,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetContentUploadUrl(FAdminGetContentUploadUr
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.ContentType.IsEmpty() || request.ContentType == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ContentType"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ContentType"), request.ContentType);
-    }
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("ContentType"), request.ContentType);
+    RequestWriter.WriteStringOrNull(TEXT("Key"), request.Key);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1792,7 +1575,7 @@ void UPlayFabAdminAPI::HelperGetContentUploadUrl(FPlayFabBaseModel response, UOb
         FAdminGetContentUploadUrlResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetContentUploadUrlResultResponse(response.responseData);
         OnSuccessGetContentUploadUrl.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetContentUploadUrl.Unbind();
 }
 
 
@@ -1806,9 +1589,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddServerBuild(FAdminAddServerBuildRequest r
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1822,41 +1603,19 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddServerBuild(FAdminAddServerBuildRequest r
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.ActiveRegions.IsEmpty() || request.ActiveRegions == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ActiveRegions"));
-    } else {
-        TArray<FString> ActiveRegionsArray;
-        FString(request.ActiveRegions).ParseIntoArray(ActiveRegionsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("ActiveRegions"), ActiveRegionsArray);
-    }
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.CommandLineTemplate.IsEmpty() || request.CommandLineTemplate == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CommandLineTemplate"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CommandLineTemplate"), request.CommandLineTemplate);
-    }
-    if (request.Comment.IsEmpty() || request.Comment == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Comment"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Comment"), request.Comment);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ExecutablePath.IsEmpty() || request.ExecutablePath == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ExecutablePath"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ExecutablePath"), request.ExecutablePath);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxGamesPerHost"), request.MaxGamesPerHost);
-    OutRestJsonObj->SetNumberField(TEXT("MinFreeGameSlots"), request.MinFreeGameSlots);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("ActiveRegions"), request.ActiveRegions);
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
+    RequestWriter.WriteStringOrNull(TEXT("CommandLineTemplate"), request.CommandLineTemplate);
+    RequestWriter.WriteStringOrNull(TEXT("Comment"), request.Comment);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ExecutablePath"), request.ExecutablePath);
+    RequestWriter.WriteNumber(TEXT("MaxGamesPerHost"), request.MaxGamesPerHost);
+    RequestWriter.WriteNumber(TEXT("MinFreeGameSlots"), request.MinFreeGameSlots);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1874,7 +1633,7 @@ void UPlayFabAdminAPI::HelperAddServerBuild(FPlayFabBaseModel response, UObject*
         FAdminAddServerBuildResult ResultStruct = UPlayFabAdminModelDecoder::decodeAddServerBuildResultResponse(response.responseData);
         OnSuccessAddServerBuild.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddServerBuild.Unbind();
 }
 
 /** Retrieves the build details for the specified game server executable */
@@ -1884,9 +1643,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetServerBuildInfo(FAdminGetServerBuildInfoR
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1900,15 +1657,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetServerBuildInfo(FAdminGetServerBuildInfoR
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1926,7 +1680,7 @@ void UPlayFabAdminAPI::HelperGetServerBuildInfo(FPlayFabBaseModel response, UObj
         FAdminGetServerBuildInfoResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetServerBuildInfoResultResponse(response.responseData);
         OnSuccessGetServerBuildInfo.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetServerBuildInfo.Unbind();
 }
 
 /** Retrieves the pre-authorized URL for uploading a game server package containing a build (does not enable the build for use - see AddServerBuild) */
@@ -1936,9 +1690,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetServerBuildUploadUrl(FAdminGetServerBuild
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1952,15 +1704,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetServerBuildUploadUrl(FAdminGetServerBuild
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1978,7 +1727,7 @@ void UPlayFabAdminAPI::HelperGetServerBuildUploadUrl(FPlayFabBaseModel response,
         FAdminGetServerBuildUploadURLResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetServerBuildUploadURLResultResponse(response.responseData);
         OnSuccessGetServerBuildUploadUrl.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetServerBuildUploadUrl.Unbind();
 }
 
 /** Retrieves the build details for all game server executables which are currently defined for the title */
@@ -1988,9 +1737,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ListServerBuilds(FAdminListBuildsRequest req
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2004,10 +1751,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ListServerBuilds(FAdminListBuildsRequest req
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2025,7 +1773,7 @@ void UPlayFabAdminAPI::HelperListServerBuilds(FPlayFabBaseModel response, UObjec
         FAdminListBuildsResult ResultStruct = UPlayFabAdminModelDecoder::decodeListBuildsResultResponse(response.responseData);
         OnSuccessListServerBuilds.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListServerBuilds.Unbind();
 }
 
 /** Updates the build details for the specified game server executable */
@@ -2035,9 +1783,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ModifyServerBuild(FAdminModifyServerBuildReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2051,46 +1797,20 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ModifyServerBuild(FAdminModifyServerBuildReq
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.ActiveRegions.IsEmpty() || request.ActiveRegions == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ActiveRegions"));
-    } else {
-        TArray<FString> ActiveRegionsArray;
-        FString(request.ActiveRegions).ParseIntoArray(ActiveRegionsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("ActiveRegions"), ActiveRegionsArray);
-    }
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.CommandLineTemplate.IsEmpty() || request.CommandLineTemplate == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CommandLineTemplate"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CommandLineTemplate"), request.CommandLineTemplate);
-    }
-    if (request.Comment.IsEmpty() || request.Comment == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Comment"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Comment"), request.Comment);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ExecutablePath.IsEmpty() || request.ExecutablePath == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ExecutablePath"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ExecutablePath"), request.ExecutablePath);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxGamesPerHost"), request.MaxGamesPerHost);
-    OutRestJsonObj->SetNumberField(TEXT("MinFreeGameSlots"), request.MinFreeGameSlots);
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("ActiveRegions"), request.ActiveRegions);
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
+    RequestWriter.WriteStringOrNull(TEXT("CommandLineTemplate"), request.CommandLineTemplate);
+    RequestWriter.WriteStringOrNull(TEXT("Comment"), request.Comment);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ExecutablePath"), request.ExecutablePath);
+    RequestWriter.WriteNumber(TEXT("MaxGamesPerHost"), request.MaxGamesPerHost);
+    RequestWriter.WriteNumber(TEXT("MinFreeGameSlots"), request.MinFreeGameSlots);
+    RequestWriter.WriteStringOrNull(TEXT("Timestamp"), request.Timestamp);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2108,7 +1828,7 @@ void UPlayFabAdminAPI::HelperModifyServerBuild(FPlayFabBaseModel response, UObje
         FAdminModifyServerBuildResult ResultStruct = UPlayFabAdminModelDecoder::decodeModifyServerBuildResultResponse(response.responseData);
         OnSuccessModifyServerBuild.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessModifyServerBuild.Unbind();
 }
 
 /** Removes the game server executable specified from the set of those a client is permitted to request in a call to StartGame */
@@ -2118,9 +1838,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RemoveServerBuild(FAdminRemoveServerBuildReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2134,15 +1852,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RemoveServerBuild(FAdminRemoveServerBuildReq
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2160,7 +1875,7 @@ void UPlayFabAdminAPI::HelperRemoveServerBuild(FPlayFabBaseModel response, UObje
         FAdminRemoveServerBuildResult ResultStruct = UPlayFabAdminModelDecoder::decodeRemoveServerBuildResultResponse(response.responseData);
         OnSuccessRemoveServerBuild.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRemoveServerBuild.Unbind();
 }
 
 
@@ -2174,9 +1889,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetMatchmakerGameInfo(FAdminGetMatchmakerGam
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2190,15 +1903,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetMatchmakerGameInfo(FAdminGetMatchmakerGam
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("LobbyId"), request.LobbyId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2216,7 +1926,7 @@ void UPlayFabAdminAPI::HelperGetMatchmakerGameInfo(FPlayFabBaseModel response, U
         FAdminGetMatchmakerGameInfoResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetMatchmakerGameInfoResultResponse(response.responseData);
         OnSuccessGetMatchmakerGameInfo.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetMatchmakerGameInfo.Unbind();
 }
 
 /** Retrieves the details of defined game modes for the specified game server executable */
@@ -2226,9 +1936,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetMatchmakerGameModes(FAdminGetMatchmakerGa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2242,15 +1950,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetMatchmakerGameModes(FAdminGetMatchmakerGa
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildVersion.IsEmpty() || request.BuildVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildVersion"), request.BuildVersion);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildVersion"), request.BuildVersion);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2268,7 +1973,7 @@ void UPlayFabAdminAPI::HelperGetMatchmakerGameModes(FPlayFabBaseModel response,
         FAdminGetMatchmakerGameModesResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetMatchmakerGameModesResultResponse(response.responseData);
         OnSuccessGetMatchmakerGameModes.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetMatchmakerGameModes.Unbind();
 }
 
 /** Updates the game server mode details for the specified game server executable */
@@ -2278,9 +1983,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ModifyMatchmakerGameModes(FAdminModifyMatchm
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2294,20 +1997,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ModifyMatchmakerGameModes(FAdminModifyMatchm
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildVersion.IsEmpty() || request.BuildVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildVersion"), request.BuildVersion);
-    }
-    if (request.GameModes.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("GameModes"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("GameModes"), request.GameModes);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildVersion"), request.BuildVersion);
+    RequestWriter.WriteObjectArray(TEXT("GameModes"), request.GameModes);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2325,7 +2021,7 @@ void UPlayFabAdminAPI::HelperModifyMatchmakerGameModes(FPlayFabBaseModel respons
         FAdminModifyMatchmakerGameModesResult ResultStruct = UPlayFabAdminModelDecoder::decodeModifyMatchmakerGameModesResultResponse(response.responseData);
         OnSuccessModifyMatchmakerGameModes.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessModifyMatchmakerGameModes.Unbind();
 }
 
 
@@ -2339,9 +2035,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreatePlayerStatisticDefinition(FAdminCreate
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2355,22 +2049,19 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreatePlayerStatisticDefinition(FAdminCreate
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
     FString temp_AggregationMethod;
     if (GetEnumValueToString<EStatisticAggregationMethod>(TEXT("EStatisticAggregationMethod"), request.AggregationMethod, temp_AggregationMethod))
-        OutRestJsonObj->SetStringField(TEXT("AggregationMethod"), temp_AggregationMethod);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
+        RequestWriter.WriteString(TEXT("AggregationMethod"), temp_AggregationMethod);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
     FString temp_VersionChangeInterval;
     if (GetEnumValueToString<EStatisticResetIntervalOption>(TEXT("EStatisticResetIntervalOption"), request.VersionChangeInterval, temp_VersionChangeInterval))
-        OutRestJsonObj->SetStringField(TEXT("VersionChangeInterval"), temp_VersionChangeInterval);
+        RequestWriter.WriteString(TEXT("VersionChangeInterval"), temp_VersionChangeInterval);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2388,7 +2079,7 @@ void UPlayFabAdminAPI::HelperCreatePlayerStatisticDefinition(FPlayFabBaseModel r
         FAdminCreatePlayerStatisticDefinitionResult ResultStruct = UPlayFabAdminModelDecoder::decodeCreatePlayerStatisticDefinitionResultResponse(response.responseData);
         OnSuccessCreatePlayerStatisticDefinition.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreatePlayerStatisticDefinition.Unbind();
 }
 
 /** Retrieves a download URL for the requested report */
@@ -2398,9 +2089,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetDataReport(FAdminGetDataReportRequest req
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2414,18 +2103,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetDataReport(FAdminGetDataReportRequest req
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("Day"), request.Day);
-    OutRestJsonObj->SetNumberField(TEXT("Month"), request.Month);
-    if (request.ReportName.IsEmpty() || request.ReportName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReportName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReportName"), request.ReportName);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("Year"), request.Year);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("Day"), request.Day);
+    RequestWriter.WriteNumber(TEXT("Month"), request.Month);
+    RequestWriter.WriteStringOrNull(TEXT("ReportName"), request.ReportName);
+    RequestWriter.WriteNumber(TEXT("Year"), request.Year);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2443,7 +2129,7 @@ void UPlayFabAdminAPI::HelperGetDataReport(FPlayFabBaseModel response, UObject*
         FAdminGetDataReportResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetDataReportResultResponse(response.responseData);
         OnSuccessGetDataReport.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetDataReport.Unbind();
 }
 
 /** Retrieves the configuration information for all player statistics defined in the title, regardless of whether they have a reset interval. */
@@ -2453,9 +2139,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerStatisticDefinitions(FAdminGetPlaye
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2469,10 +2153,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerStatisticDefinitions(FAdminGetPlaye
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2490,7 +2175,7 @@ void UPlayFabAdminAPI::HelperGetPlayerStatisticDefinitions(FPlayFabBaseModel res
         FAdminGetPlayerStatisticDefinitionsResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetPlayerStatisticDefinitionsResultResponse(response.responseData);
         OnSuccessGetPlayerStatisticDefinitions.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerStatisticDefinitions.Unbind();
 }
 
 /** Retrieves the information on the available versions of the specified statistic. */
@@ -2500,9 +2185,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerStatisticVersions(FAdminGetPlayerSt
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2516,16 +2199,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerStatisticVersions(FAdminGetPlayerSt
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2543,7 +2223,7 @@ void UPlayFabAdminAPI::HelperGetPlayerStatisticVersions(FPlayFabBaseModel respon
         FAdminGetPlayerStatisticVersionsResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetPlayerStatisticVersionsResultResponse(response.responseData);
         OnSuccessGetPlayerStatisticVersions.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerStatisticVersions.Unbind();
 }
 
 /** Retrieves the title-specific custom data for the user which is readable and writable by the client */
@@ -2553,9 +2233,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserData(FAdminGetUserDataRequest request
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2569,24 +2247,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserData(FAdminGetUserDataRequest request
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2604,7 +2272,7 @@ void UPlayFabAdminAPI::HelperGetUserData(FPlayFabBaseModel response, UObject* cu
         FAdminGetUserDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetUserDataResultResponse(response.responseData);
         OnSuccessGetUserData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserData.Unbind();
 }
 
 /** Retrieves the title-specific custom data for the user which cannot be accessed by the client */
@@ -2614,9 +2282,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserInternalData(FAdminGetUserDataRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2630,24 +2296,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserInternalData(FAdminGetUserDataRequest
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2663,10 +2319,10 @@ void UPlayFabAdminAPI::HelperGetUserInternalData(FPlayFabBaseModel response, UOb
     else if (!error.hasError && OnSuccessGetUserInternalData.IsBound())
     {
         FAdminGetUserDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetUserInternalData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserInternalData.Unbind();
 }
 
 /** Retrieves the publisher-specific custom data for the user which is readable and writable by the client */
@@ -2676,9 +2332,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserPublisherData(FAdminGetUserDataReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2692,24 +2346,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserPublisherData(FAdminGetUserDataReques
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2725,10 +2369,10 @@ void UPlayFabAdminAPI::HelperGetUserPublisherData(FPlayFabBaseModel response, UO
     else if (!error.hasError && OnSuccessGetUserPublisherData.IsBound())
     {
         FAdminGetUserDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetUserPublisherData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserPublisherData.Unbind();
 }
 
 /** Retrieves the publisher-specific custom data for the user which cannot be accessed by the client */
@@ -2738,9 +2382,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserPublisherInternalData(FAdminGetUserDa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2754,24 +2396,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserPublisherInternalData(FAdminGetUserDa
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2787,10 +2419,10 @@ void UPlayFabAdminAPI::HelperGetUserPublisherInternalData(FPlayFabBaseModel resp
     else if (!error.hasError && OnSuccessGetUserPublisherInternalData.IsBound())
     {
         FAdminGetUserDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetUserPublisherInternalData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserPublisherInternalData.Unbind();
 }
 
 /** Retrieves the publisher-specific custom data for the user which can only be read by the client */
@@ -2800,9 +2432,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserPublisherReadOnlyData(FAdminGetUserDa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2816,24 +2446,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserPublisherReadOnlyData(FAdminGetUserDa
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2849,10 +2469,10 @@ void UPlayFabAdminAPI::HelperGetUserPublisherReadOnlyData(FPlayFabBaseModel resp
     else if (!error.hasError && OnSuccessGetUserPublisherReadOnlyData.IsBound())
     {
         FAdminGetUserDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetUserPublisherReadOnlyData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserPublisherReadOnlyData.Unbind();
 }
 
 /** Retrieves the title-specific custom data for the user which can only be read by the client */
@@ -2862,9 +2482,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserReadOnlyData(FAdminGetUserDataRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2878,24 +2496,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserReadOnlyData(FAdminGetUserDataRequest
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2911,10 +2519,10 @@ void UPlayFabAdminAPI::HelperGetUserReadOnlyData(FPlayFabBaseModel response, UOb
     else if (!error.hasError && OnSuccessGetUserReadOnlyData.IsBound())
     {
         FAdminGetUserDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetUserReadOnlyData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserReadOnlyData.Unbind();
 }
 
 /** Resets the indicated statistic, removing all player entries for it and backing up the old values. */
@@ -2924,9 +2532,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::IncrementPlayerStatisticVersion(FAdminIncrem
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2940,16 +2546,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::IncrementPlayerStatisticVersion(FAdminIncrem
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2967,7 +2570,7 @@ void UPlayFabAdminAPI::HelperIncrementPlayerStatisticVersion(FPlayFabBaseModel r
         FAdminIncrementPlayerStatisticVersionResult ResultStruct = UPlayFabAdminModelDecoder::decodeIncrementPlayerStatisticVersionResultResponse(response.responseData);
         OnSuccessIncrementPlayerStatisticVersion.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessIncrementPlayerStatisticVersion.Unbind();
 }
 
 /** Attempts to process an order refund through the original real money payment provider. */
@@ -2977,9 +2580,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RefundPurchase(FAdminRefundPurchaseRequest r
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2993,25 +2594,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RefundPurchase(FAdminRefundPurchaseRequest r
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.OrderId.IsEmpty() || request.OrderId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OrderId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OrderId"), request.OrderId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Reason.IsEmpty() || request.Reason == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Reason"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Reason"), request.Reason);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("OrderId"), request.OrderId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("Reason"), request.Reason);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3029,7 +2619,7 @@ void UPlayFabAdminAPI::HelperRefundPurchase(FPlayFabBaseModel response, UObject*
         FAdminRefundPurchaseResponse ResultStruct = UPlayFabAdminModelDecoder::decodeRefundPurchaseResponseResponse(response.responseData);
         OnSuccessRefundPurchase.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRefundPurchase.Unbind();
 }
 
 /** Completely removes all statistics for the specified user, for the current game */
@@ -3039,9 +2629,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ResetUserStatistics(FAdminResetUserStatistic
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3055,16 +2643,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ResetUserStatistics(FAdminResetUserStatistic
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3082,7 +2667,7 @@ void UPlayFabAdminAPI::HelperResetUserStatistics(FPlayFabBaseModel response, UOb
         FAdminResetUserStatisticsResult ResultStruct = UPlayFabAdminModelDecoder::decodeResetUserStatisticsResultResponse(response.responseData);
         OnSuccessResetUserStatistics.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessResetUserStatistics.Unbind();
 }
 
 /** Attempts to resolve a dispute with the original order's payment provider. */
@@ -3092,9 +2677,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ResolvePurchaseDispute(FAdminResolvePurchase
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3108,28 +2691,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ResolvePurchaseDispute(FAdminResolvePurchase
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.OrderId.IsEmpty() || request.OrderId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OrderId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OrderId"), request.OrderId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("OrderId"), request.OrderId);
     FString temp_Outcome;
     if (GetEnumValueToString<EResolutionOutcome>(TEXT("EResolutionOutcome"), request.Outcome, temp_Outcome))
-        OutRestJsonObj->SetStringField(TEXT("Outcome"), temp_Outcome);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Reason.IsEmpty() || request.Reason == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Reason"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Reason"), request.Reason);
-    }
+        RequestWriter.WriteString(TEXT("Outcome"), temp_Outcome);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("Reason"), request.Reason);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3147,7 +2719,7 @@ void UPlayFabAdminAPI::HelperResolvePurchaseDispute(FPlayFabBaseModel response,
         FAdminResolvePurchaseDisputeResponse ResultStruct = UPlayFabAdminModelDecoder::decodeResolvePurchaseDisputeResponseResponse(response.responseData);
         OnSuccessResolvePurchaseDispute.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessResolvePurchaseDispute.Unbind();
 }
 
 /** Updates a player statistic configuration for the title, optionally allowing the developer to specify a reset interval. */
@@ -3157,9 +2729,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdatePlayerStatisticDefinition(FAdminUpdate
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3173,21 +2743,18 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdatePlayerStatisticDefinition(FAdminUpdate
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
     FString temp_AggregationMethod;
     if (GetEnumValueToString<EStatisticAggregationMethod>(TEXT("EStatisticAggregationMethod"), request.AggregationMethod, temp_AggregationMethod))
-        OutRestJsonObj->SetStringField(TEXT("AggregationMethod"), temp_AggregationMethod);
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
+        RequestWriter.WriteString(TEXT("AggregationMethod"), temp_AggregationMethod);
+    RequestWriter.WriteStringOrNull(TEXT("StatisticName"), request.StatisticName);
     FString temp_VersionChangeInterval;
     if (GetEnumValueToString<EStatisticResetIntervalOption>(TEXT("EStatisticResetIntervalOption"), request.VersionChangeInterval, temp_VersionChangeInterval))
-        OutRestJsonObj->SetStringField(TEXT("VersionChangeInterval"), temp_VersionChangeInterval);
+        RequestWriter.WriteString(TEXT("VersionChangeInterval"), temp_VersionChangeInterval);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3205,7 +2772,7 @@ void UPlayFabAdminAPI::HelperUpdatePlayerStatisticDefinition(FPlayFabBaseModel r
         FAdminUpdatePlayerStatisticDefinitionResult ResultStruct = UPlayFabAdminModelDecoder::decodeUpdatePlayerStatisticDefinitionResultResponse(response.responseData);
         OnSuccessUpdatePlayerStatisticDefinition.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdatePlayerStatisticDefinition.Unbind();
 }
 
 /** Updates the title-specific custom data for the user which is readable and writable by the client */
@@ -3215,9 +2782,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserData(FAdminUpdateUserDataRequest r
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3231,28 +2796,18 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserData(FAdminUpdateUserDataRequest r
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
     FString temp_Permission;
     if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+        RequestWriter.WriteString(TEXT("Permission"), temp_Permission);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3270,7 +2825,7 @@ void UPlayFabAdminAPI::HelperUpdateUserData(FPlayFabBaseModel response, UObject*
         FAdminUpdateUserDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
         OnSuccessUpdateUserData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateUserData.Unbind();
 }
 
 /** Updates the title-specific custom data for the user which cannot be accessed by the client */
@@ -3280,9 +2835,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserInternalData(FAdminUpdateUserInter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3296,25 +2849,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserInternalData(FAdminUpdateUserInter
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3330,10 +2873,10 @@ void UPlayFabAdminAPI::HelperUpdateUserInternalData(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessUpdateUserInternalData.IsBound())
     {
         FAdminUpdateUserDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateUserInternalData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateUserInternalData.Unbind();
 }
 
 /** Updates the publisher-specific custom data for the user which is readable and writable by the client */
@@ -3343,9 +2886,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserPublisherData(FAdminUpdateUserData
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3359,28 +2900,18 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserPublisherData(FAdminUpdateUserData
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
     FString temp_Permission;
     if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+        RequestWriter.WriteString(TEXT("Permission"), temp_Permission);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3396,10 +2927,10 @@ void UPlayFabAdminAPI::HelperUpdateUserPublisherData(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessUpdateUserPublisherData.IsBound())
     {
         FAdminUpdateUserDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateUserPublisherData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateUserPublisherData.Unbind();
 }
 
 /** Updates the publisher-specific custom data for the user which cannot be accessed by the client */
@@ -3409,9 +2940,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserPublisherInternalData(FAdminUpdate
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3425,25 +2954,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserPublisherInternalData(FAdminUpdate
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3459,10 +2978,10 @@ void UPlayFabAdminAPI::HelperUpdateUserPublisherInternalData(FPlayFabBaseModel r
     else if (!error.hasError && OnSuccessUpdateUserPublisherInternalData.IsBound())
     {
         FAdminUpdateUserDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateUserPublisherInternalData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateUserPublisherInternalData.Unbind();
 }
 
 /** Updates the publisher-specific custom data for the user which can only be read by the client */
@@ -3472,9 +2991,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserPublisherReadOnlyData(FAdminUpdate
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3488,28 +3005,18 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserPublisherReadOnlyData(FAdminUpdate
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
     FString temp_Permission;
     if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+        RequestWriter.WriteString(TEXT("Permission"), temp_Permission);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3525,10 +3032,10 @@ void UPlayFabAdminAPI::HelperUpdateUserPublisherReadOnlyData(FPlayFabBaseModel r
     else if (!error.hasError && OnSuccessUpdateUserPublisherReadOnlyData.IsBound())
     {
         FAdminUpdateUserDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateUserPublisherReadOnlyData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateUserPublisherReadOnlyData.Unbind();
 }
 
 /** Updates the title-specific custom data for the user which can only be read by the client */
@@ -3538,9 +3045,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserReadOnlyData(FAdminUpdateUserDataR
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3554,28 +3059,18 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserReadOnlyData(FAdminUpdateUserDataR
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Data"), request.Data);
+    RequestWriter.WriteStringArray(TEXT("KeysToRemove"), request.KeysToRemove);
     FString temp_Permission;
     if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+        RequestWriter.WriteString(TEXT("Permission"), temp_Permission);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3591,10 +3086,10 @@ void UPlayFabAdminAPI::HelperUpdateUserReadOnlyData(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessUpdateUserReadOnlyData.IsBound())
     {
         FAdminUpdateUserDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateUserReadOnlyData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateUserReadOnlyData.Unbind();
 }
 
 
@@ -3608,9 +3103,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddUserVirtualCurrency(FAdminAddUserVirtualC
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3624,22 +3117,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddUserVirtualCurrency(FAdminAddUserVirtualC
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("Amount"), request.Amount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("VirtualCurrency"), request.VirtualCurrency);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3657,7 +3143,7 @@ void UPlayFabAdminAPI::HelperAddUserVirtualCurrency(FPlayFabBaseModel response,
         FAdminModifyUserVirtualCurrencyResult ResultStruct = UPlayFabAdminModelDecoder::decodeModifyUserVirtualCurrencyResultResponse(response.responseData);
         OnSuccessAddUserVirtualCurrency.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddUserVirtualCurrency.Unbind();
 }
 
 /** Checks the global count for the limited edition item. */
@@ -3667,9 +3153,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CheckLimitedEditionItemAvailability(FAdminCh
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3683,20 +3167,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CheckLimitedEditionItemAvailability(FAdminCh
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.ItemId.IsEmpty() || request.ItemId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemId"), request.ItemId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("ItemId"), request.ItemId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3714,7 +3191,7 @@ void UPlayFabAdminAPI::HelperCheckLimitedEditionItemAvailability(FPlayFabBaseMod
         FAdminCheckLimitedEditionItemAvailabilityResult ResultStruct = UPlayFabAdminModelDecoder::decodeCheckLimitedEditionItemAvailabilityResultResponse(response.responseData);
         OnSuccessCheckLimitedEditionItemAvailability.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCheckLimitedEditionItemAvailability.Unbind();
 }
 
 /** Retrieves the specified user's current inventory of virtual goods */
@@ -3724,9 +3201,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserInventory(FAdminGetUserInventoryReque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3740,16 +3215,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserInventory(FAdminGetUserInventoryReque
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3767,7 +3239,7 @@ void UPlayFabAdminAPI::HelperGetUserInventory(FPlayFabBaseModel response, UObjec
         FAdminGetUserInventoryResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetUserInventoryResultResponse(response.responseData);
         OnSuccessGetUserInventory.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetUserInventory.Unbind();
 }
 
 /** Adds the specified items to the specified user inventories */
@@ -3777,9 +3249,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GrantItemsToUsers(FAdminGrantItemsToUsersReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3793,21 +3263,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GrantItemsToUsers(FAdminGrantItemsToUsersReq
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ItemGrants.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemGrants"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("ItemGrants"), request.ItemGrants);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObjectArray(TEXT("ItemGrants"), request.ItemGrants);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3825,7 +3288,7 @@ void UPlayFabAdminAPI::HelperGrantItemsToUsers(FPlayFabBaseModel response, UObje
         FAdminGrantItemsToUsersResult ResultStruct = UPlayFabAdminModelDecoder::decodeGrantItemsToUsersResultResponse(response.responseData);
         OnSuccessGrantItemsToUsers.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGrantItemsToUsers.Unbind();
 }
 
 /** Increases the global count for the given scarce resource. */
@@ -3835,9 +3298,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::IncrementLimitedEditionItemAvailability(FAdm
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3851,22 +3312,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::IncrementLimitedEditionItemAvailability(FAdm
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ItemId.IsEmpty() || request.ItemId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemId"), request.ItemId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("Amount"), request.Amount);
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ItemId"), request.ItemId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3884,7 +3338,7 @@ void UPlayFabAdminAPI::HelperIncrementLimitedEditionItemAvailability(FPlayFabBas
         FAdminIncrementLimitedEditionItemAvailabilityResult ResultStruct = UPlayFabAdminModelDecoder::decodeIncrementLimitedEditionItemAvailabilityResultResponse(response.responseData);
         OnSuccessIncrementLimitedEditionItemAvailability.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessIncrementLimitedEditionItemAvailability.Unbind();
 }
 
 /** Revokes access to an item in a user's inventory */
@@ -3894,9 +3348,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RevokeInventoryItem(FAdminRevokeInventoryIte
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3910,25 +3362,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RevokeInventoryItem(FAdminRevokeInventoryIte
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CharacterId"), request.CharacterId);
+    RequestWriter.WriteStringOrNull(TEXT("ItemInstanceId"), request.ItemInstanceId);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3946,7 +3387,7 @@ void UPlayFabAdminAPI::HelperRevokeInventoryItem(FPlayFabBaseModel response, UOb
         FAdminRevokeInventoryResult ResultStruct = UPlayFabAdminModelDecoder::decodeRevokeInventoryResultResponse(response.responseData);
         OnSuccessRevokeInventoryItem.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRevokeInventoryItem.Unbind();
 }
 
 /** Revokes access for up to 25 items across multiple users and characters. */
@@ -3956,9 +3397,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RevokeInventoryItems(FAdminRevokeInventoryIt
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3972,15 +3411,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RevokeInventoryItems(FAdminRevokeInventoryIt
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Items.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Items"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Items"), request.Items);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObjectArray(TEXT("Items"), request.Items);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3998,7 +3434,7 @@ void UPlayFabAdminAPI::HelperRevokeInventoryItems(FPlayFabBaseModel response, UO
         FAdminRevokeInventoryItemsResult ResultStruct = UPlayFabAdminModelDecoder::decodeRevokeInventoryItemsResultResponse(response.responseData);
         OnSuccessRevokeInventoryItems.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRevokeInventoryItems.Unbind();
 }
 
 /** Decrements the specified virtual currency by the stated amount */
@@ -4008,9 +3444,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SubtractUserVirtualCurrency(FAdminSubtractUs
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4024,22 +3458,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SubtractUserVirtualCurrency(FAdminSubtractUs
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("Amount"), request.Amount);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("VirtualCurrency"), request.VirtualCurrency);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4055,10 +3482,10 @@ void UPlayFabAdminAPI::HelperSubtractUserVirtualCurrency(FPlayFabBaseModel respo
     else if (!error.hasError && OnSuccessSubtractUserVirtualCurrency.IsBound())
     {
         FAdminModifyUserVirtualCurrencyResult ResultStruct = UPlayFabAdminModelDecoder::decodeModifyUserVirtualCurrencyResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessSubtractUserVirtualCurrency.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSubtractUserVirtualCurrency.Unbind();
 }
 
 
@@ -4072,9 +3499,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddPlayerTag(FAdminAddPlayerTagRequest reque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4088,21 +3513,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddPlayerTag(FAdminAddPlayerTagRequest reque
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.TagName.IsEmpty() || request.TagName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TagName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TagName"), request.TagName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("TagName"), request.TagName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4120,7 +3538,7 @@ void UPlayFabAdminAPI::HelperAddPlayerTag(FPlayFabBaseModel response, UObject* c
         FAdminAddPlayerTagResult ResultStruct = UPlayFabAdminModelDecoder::decodeAddPlayerTagResultResponse(response.responseData);
         OnSuccessAddPlayerTag.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddPlayerTag.Unbind();
 }
 
 /** Retrieves an array of player segment definitions. Results from this can be used in subsequent API calls such as GetPlayersInSegment which requires a Segment ID. While segment names can change the ID for that segment will not change. */
@@ -4130,9 +3548,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetAllSegments(FAdminGetAllSegmentsRequest r
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4146,10 +3562,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetAllSegments(FAdminGetAllSegmentsRequest r
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4167,7 +3584,7 @@ void UPlayFabAdminAPI::HelperGetAllSegments(FPlayFabBaseModel response, UObject*
         FAdminGetAllSegmentsResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetAllSegmentsResultResponse(response.responseData);
         OnSuccessGetAllSegments.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetAllSegments.Unbind();
 }
 
 /** List all segments that a player currently belongs to at this moment in time. */
@@ -4177,9 +3594,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerSegments(FAdminGetPlayersSegmentsRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4193,16 +3608,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerSegments(FAdminGetPlayersSegmentsRe
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4220,7 +3632,7 @@ void UPlayFabAdminAPI::HelperGetPlayerSegments(FPlayFabBaseModel response, UObje
         FAdminGetPlayerSegmentsResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetPlayerSegmentsResultResponse(response.responseData);
         OnSuccessGetPlayerSegments.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerSegments.Unbind();
 }
 
 /** Allows for paging through all players in a given segment. This API creates a snapshot of all player profiles that match the segment definition at the time of its creation and lives through the Total Seconds to Live, refreshing its life span on each subsequent use of the Continuation Token. Profiles that change during the course of paging will not be reflected in the results. AB Test segments are currently not supported by this operation. NOTE: This API is limited to being called 30 times in one minute. You will be returned an error if you exceed this threshold. */
@@ -4230,9 +3642,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayersInSegment(FAdminGetPlayersInSegmen
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4246,23 +3656,16 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayersInSegment(FAdminGetPlayersInSegmen
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.ContinuationToken.IsEmpty() || request.ContinuationToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ContinuationToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ContinuationToken"), request.ContinuationToken);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("MaxBatchSize"), request.MaxBatchSize);
-    OutRestJsonObj->SetNumberField(TEXT("SecondsToLive"), request.SecondsToLive);
-    if (request.SegmentId.IsEmpty() || request.SegmentId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SegmentId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SegmentId"), request.SegmentId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("ContinuationToken"), request.ContinuationToken);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("MaxBatchSize"), request.MaxBatchSize);
+    RequestWriter.WriteNumber(TEXT("SecondsToLive"), request.SecondsToLive);
+    RequestWriter.WriteStringOrNull(TEXT("SegmentId"), request.SegmentId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4280,7 +3683,7 @@ void UPlayFabAdminAPI::HelperGetPlayersInSegment(FPlayFabBaseModel response, UOb
         FAdminGetPlayersInSegmentResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetPlayersInSegmentResultResponse(response.responseData);
         OnSuccessGetPlayersInSegment.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayersInSegment.Unbind();
 }
 
 /** Get all tags with a given Namespace (optional) from a player profile. */
@@ -4290,9 +3693,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerTags(FAdminGetPlayerTagsRequest req
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4306,21 +3707,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerTags(FAdminGetPlayerTagsRequest req
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Namespace.IsEmpty() || request.Namespace == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Namespace"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Namespace"), request.Namespace);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Namespace"), request.Namespace);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4338,7 +3732,7 @@ void UPlayFabAdminAPI::HelperGetPlayerTags(FPlayFabBaseModel response, UObject*
         FAdminGetPlayerTagsResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetPlayerTagsResultResponse(response.responseData);
         OnSuccessGetPlayerTags.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPlayerTags.Unbind();
 }
 
 /** Remove a given tag from a player profile. The tag's namespace is automatically generated based on the source of the tag. */
@@ -4348,9 +3742,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RemovePlayerTag(FAdminRemovePlayerTagRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4364,21 +3756,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RemovePlayerTag(FAdminRemovePlayerTagRequest
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.TagName.IsEmpty() || request.TagName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TagName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TagName"), request.TagName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("PlayFabId"), request.PlayFabId);
+    RequestWriter.WriteStringOrNull(TEXT("TagName"), request.TagName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4396,7 +3781,7 @@ void UPlayFabAdminAPI::HelperRemovePlayerTag(FPlayFabBaseModel response, UObject
         FAdminRemovePlayerTagResult ResultStruct = UPlayFabAdminModelDecoder::decodeRemovePlayerTagResultResponse(response.responseData);
         OnSuccessRemovePlayerTag.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRemovePlayerTag.Unbind();
 }
 
 
@@ -4410,9 +3795,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AbortTaskInstance(FAdminAbortTaskInstanceReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4426,16 +3809,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AbortTaskInstance(FAdminAbortTaskInstanceReq
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.TaskInstanceId.IsEmpty() || request.TaskInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TaskInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TaskInstanceId"), request.TaskInstanceId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("TaskInstanceId"), request.TaskInstanceId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4451,10 +3831,10 @@ void UPlayFabAdminAPI::HelperAbortTaskInstance(FPlayFabBaseModel response, UObje
     else if (!error.hasError && OnSuccessAbortTaskInstance.IsBound())
     {
         FAdminEmptyResponse ResultStruct = UPlayFabAdminModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessAbortTaskInstance.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAbortTaskInstance.Unbind();
 }
 
 /** Create an ActionsOnPlayersInSegment task, which iterates through all players in a segment to execute action. */
@@ -4464,9 +3844,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreateActionsOnPlayersInSegmentTask(FAdminCr
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4480,28 +3858,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreateActionsOnPlayersInSegmentTask(FAdminCr
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Description.IsEmpty() || request.Description == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Description"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Description"), request.Description);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("IsActive"), request.IsActive);
-    if (request.Name.IsEmpty() || request.Name == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Name"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Name"), request.Name);
-    }
-    if (request.Parameter != nullptr) OutRestJsonObj->SetObjectField(TEXT("Parameter"), request.Parameter);
-    if (request.Schedule.IsEmpty() || request.Schedule == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Schedule"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Schedule"), request.Schedule);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Description"), request.Description);
+    RequestWriter.WriteBool(TEXT("IsActive"), request.IsActive);
+    RequestWriter.WriteStringOrNull(TEXT("Name"), request.Name);
+    RequestWriter.WriteObject(TEXT("Parameter"), request.Parameter);
+    RequestWriter.WriteStringOrNull(TEXT("Schedule"), request.Schedule);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4519,7 +3886,7 @@ void UPlayFabAdminAPI::HelperCreateActionsOnPlayersInSegmentTask(FPlayFabBaseMod
         FAdminCreateTaskResult ResultStruct = UPlayFabAdminModelDecoder::decodeCreateTaskResultResponse(response.responseData);
         OnSuccessCreateActionsOnPlayersInSegmentTask.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateActionsOnPlayersInSegmentTask.Unbind();
 }
 
 /** Create a CloudScript task, which can run a CloudScript on a schedule. */
@@ -4529,9 +3896,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreateCloudScriptTask(FAdminCreateCloudScrip
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4545,28 +3910,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreateCloudScriptTask(FAdminCreateCloudScrip
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Description.IsEmpty() || request.Description == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Description"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Description"), request.Description);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("IsActive"), request.IsActive);
-    if (request.Name.IsEmpty() || request.Name == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Name"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Name"), request.Name);
-    }
-    if (request.Parameter != nullptr) OutRestJsonObj->SetObjectField(TEXT("Parameter"), request.Parameter);
-    if (request.Schedule.IsEmpty() || request.Schedule == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Schedule"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Schedule"), request.Schedule);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Description"), request.Description);
+    RequestWriter.WriteBool(TEXT("IsActive"), request.IsActive);
+    RequestWriter.WriteStringOrNull(TEXT("Name"), request.Name);
+    RequestWriter.WriteObject(TEXT("Parameter"), request.Parameter);
+    RequestWriter.WriteStringOrNull(TEXT("Schedule"), request.Schedule);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4582,10 +3936,10 @@ void UPlayFabAdminAPI::HelperCreateCloudScriptTask(FPlayFabBaseModel response, U
     else if (!error.hasError && OnSuccessCreateCloudScriptTask.IsBound())
     {
         FAdminCreateTaskResult ResultStruct = UPlayFabAdminModelDecoder::decodeCreateTaskResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessCreateCloudScriptTask.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateCloudScriptTask.Unbind();
 }
 
 /** Create a Insights Scheduled Scaling task, which can scale Insights Performance Units on a schedule */
@@ -4595,9 +3949,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreateInsightsScheduledScalingTask(FAdminCre
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4611,28 +3963,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreateInsightsScheduledScalingTask(FAdminCre
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Description.IsEmpty() || request.Description == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Description"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Description"), request.Description);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("IsActive"), request.IsActive);
-    if (request.Name.IsEmpty() || request.Name == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Name"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Name"), request.Name);
-    }
-    if (request.Parameter != nullptr) OutRestJsonObj->SetObjectField(TEXT("Parameter"), request.Parameter);
-    if (request.Schedule.IsEmpty() || request.Schedule == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Schedule"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Schedule"), request.Schedule);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Description"), request.Description);
+    RequestWriter.WriteBool(TEXT("IsActive"), request.IsActive);
+    RequestWriter.WriteStringOrNull(TEXT("Name"), request.Name);
+    RequestWriter.WriteObject(TEXT("Parameter"), request.Parameter);
+    RequestWriter.WriteStringOrNull(TEXT("Schedule"), request.Schedule);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4648,10 +3989,10 @@ void UPlayFabAdminAPI::HelperCreateInsightsScheduledScalingTask(FPlayFabBaseMode
     else if (!error.hasError && OnSuccessCreateInsightsScheduledScalingTask.IsBound())
     {
         FAdminCreateTaskResult ResultStruct = UPlayFabAdminModelDecoder::decodeCreateTaskResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessCreateInsightsScheduledScalingTask.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateInsightsScheduledScalingTask.Unbind();
 }
 
 /** Delete a task. */
@@ -4661,9 +4002,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteTask(FAdminDeleteTaskRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4677,11 +4016,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteTask(FAdminDeleteTaskRequest request,
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Identifier != nullptr) OutRestJsonObj->SetObjectField(TEXT("Identifier"), request.Identifier);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("Identifier"), request.Identifier);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4697,10 +4037,10 @@ void UPlayFabAdminAPI::HelperDeleteTask(FPlayFabBaseModel response, UObject* cus
     else if (!error.hasError && OnSuccessDeleteTask.IsBound())
     {
         FAdminEmptyResponse ResultStruct = UPlayFabAdminModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessDeleteTask.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteTask.Unbind();
 }
 
 /** Get information about a ActionsOnPlayersInSegment task instance. */
@@ -4710,9 +4050,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetActionsOnPlayersInSegmentTaskInstance(FAd
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4726,15 +4064,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetActionsOnPlayersInSegmentTaskInstance(FAd
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.TaskInstanceId.IsEmpty() || request.TaskInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TaskInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TaskInstanceId"), request.TaskInstanceId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("TaskInstanceId"), request.TaskInstanceId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4752,7 +4087,7 @@ void UPlayFabAdminAPI::HelperGetActionsOnPlayersInSegmentTaskInstance(FPlayFabBa
         FAdminGetActionsOnPlayersInSegmentTaskInstanceResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetActionsOnPlayersInSegmentTaskInstanceResultResponse(response.responseData);
         OnSuccessGetActionsOnPlayersInSegmentTaskInstance.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetActionsOnPlayersInSegmentTaskInstance.Unbind();
 }
 
 /** Get detail information about a CloudScript task instance. */
@@ -4762,9 +4097,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetCloudScriptTaskInstance(FAdminGetTaskInst
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4778,15 +4111,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetCloudScriptTaskInstance(FAdminGetTaskInst
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.TaskInstanceId.IsEmpty() || request.TaskInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TaskInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TaskInstanceId"), request.TaskInstanceId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("TaskInstanceId"), request.TaskInstanceId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4804,7 +4134,7 @@ void UPlayFabAdminAPI::HelperGetCloudScriptTaskInstance(FPlayFabBaseModel respon
         FAdminGetCloudScriptTaskInstanceResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetCloudScriptTaskInstanceResultResponse(response.responseData);
         OnSuccessGetCloudScriptTaskInstance.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetCloudScriptTaskInstance.Unbind();
 }
 
 /** Query for task instances by task, status, or time range. */
@@ -4814,9 +4144,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetTaskInstances(FAdminGetTaskInstancesReque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4830,24 +4158,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetTaskInstances(FAdminGetTaskInstancesReque
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.StartedAtRangeFrom.IsEmpty() || request.StartedAtRangeFrom == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StartedAtRangeFrom"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StartedAtRangeFrom"), request.StartedAtRangeFrom);
-    }
-    if (request.StartedAtRangeTo.IsEmpty() || request.StartedAtRangeTo == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StartedAtRangeTo"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StartedAtRangeTo"), request.StartedAtRangeTo);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("StartedAtRangeFrom"), request.StartedAtRangeFrom);
+    RequestWriter.WriteStringOrNull(TEXT("StartedAtRangeTo"), request.StartedAtRangeTo);
     FString temp_StatusFilter;
     if (GetEnumValueToString<ETaskInstanceStatus>(TEXT("ETaskInstanceStatus"), request.StatusFilter, temp_StatusFilter))
-        OutRestJsonObj->SetStringField(TEXT("StatusFilter"), temp_StatusFilter);
-    if (request.TaskIdentifier != nullptr) OutRestJsonObj->SetObjectField(TEXT("TaskIdentifier"), request.TaskIdentifier);
+        RequestWriter.WriteString(TEXT("StatusFilter"), temp_StatusFilter);
+    RequestWriter.WriteObject(TEXT("TaskIdentifier"), request.TaskIdentifier);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4865,7 +4186,7 @@ void UPlayFabAdminAPI::HelperGetTaskInstances(FPlayFabBaseModel response, UObjec
         FAdminGetTaskInstancesResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetTaskInstancesResultResponse(response.responseData);
         OnSuccessGetTaskInstances.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetTaskInstances.Unbind();
 }
 
 /** Get definition information on a specified task or all tasks within a title. */
@@ -4875,9 +4196,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetTasks(FAdminGetTasksRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4891,11 +4210,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetTasks(FAdminGetTasksRequest request,
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Identifier != nullptr) OutRestJsonObj->SetObjectField(TEXT("Identifier"), request.Identifier);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("Identifier"), request.Identifier);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4913,7 +4233,7 @@ void UPlayFabAdminAPI::HelperGetTasks(FPlayFabBaseModel response, UObject* custo
         FAdminGetTasksResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetTasksResultResponse(response.responseData);
         OnSuccessGetTasks.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetTasks.Unbind();
 }
 
 /** Run a task immediately regardless of its schedule. */
@@ -4923,9 +4243,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RunTask(FAdminRunTaskRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4939,12 +4257,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RunTask(FAdminRunTaskRequest request,
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Identifier != nullptr) OutRestJsonObj->SetObjectField(TEXT("Identifier"), request.Identifier);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Identifier"), request.Identifier);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -4962,7 +4281,7 @@ void UPlayFabAdminAPI::HelperRunTask(FPlayFabBaseModel response, UObject* custom
         FAdminRunTaskResult ResultStruct = UPlayFabAdminModelDecoder::decodeRunTaskResultResponse(response.responseData);
         OnSuccessRunTask.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRunTask.Unbind();
 }
 
 /** Update an existing task. */
@@ -4972,9 +4291,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateTask(FAdminUpdateTaskRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -4988,32 +4305,21 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateTask(FAdminUpdateTaskRequest request,
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Description.IsEmpty() || request.Description == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Description"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Description"), request.Description);
-    }
-    if (request.Identifier != nullptr) OutRestJsonObj->SetObjectField(TEXT("Identifier"), request.Identifier);
-    OutRestJsonObj->SetBoolField(TEXT("IsActive"), request.IsActive);
-    if (request.Name.IsEmpty() || request.Name == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Name"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Name"), request.Name);
-    }
-    if (request.Parameter != nullptr) OutRestJsonObj->SetObjectField(TEXT("Parameter"), request.Parameter);
-    if (request.Schedule.IsEmpty() || request.Schedule == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Schedule"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Schedule"), request.Schedule);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Description"), request.Description);
+    RequestWriter.WriteObject(TEXT("Identifier"), request.Identifier);
+    RequestWriter.WriteBool(TEXT("IsActive"), request.IsActive);
+    RequestWriter.WriteStringOrNull(TEXT("Name"), request.Name);
+    RequestWriter.WriteObject(TEXT("Parameter"), request.Parameter);
+    RequestWriter.WriteStringOrNull(TEXT("Schedule"), request.Schedule);
     FString temp_Type;
     if (GetEnumValueToString<EScheduledTaskType>(TEXT("EScheduledTaskType"), request.Type, temp_Type))
-        OutRestJsonObj->SetStringField(TEXT("Type"), temp_Type);
+        RequestWriter.WriteString(TEXT("Type"), temp_Type);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5029,10 +4335,10 @@ void UPlayFabAdminAPI::HelperUpdateTask(FPlayFabBaseModel response, UObject* cus
     else if (!error.hasError && OnSuccessUpdateTask.IsBound())
     {
         FAdminEmptyResponse ResultStruct = UPlayFabAdminModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateTask.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateTask.Unbind();
 }
 
 
@@ -5046,9 +4352,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreateSegment(FAdminCreateSegmentRequest req
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5062,11 +4366,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreateSegment(FAdminCreateSegmentRequest req
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.SegmentModel != nullptr) OutRestJsonObj->SetObjectField(TEXT("SegmentModel"), request.SegmentModel);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("SegmentModel"), request.SegmentModel);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5084,7 +4389,7 @@ void UPlayFabAdminAPI::HelperCreateSegment(FPlayFabBaseModel response, UObject*
         FAdminCreateSegmentResponse ResultStruct = UPlayFabAdminModelDecoder::decodeCreateSegmentResponseResponse(response.responseData);
         OnSuccessCreateSegment.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateSegment.Unbind();
 }
 
 /** Deletes an existing player segment and its associated action(s) for a title. */
@@ -5094,9 +4399,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteSegment(FAdminDeleteSegmentRequest req
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5110,15 +4413,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteSegment(FAdminDeleteSegmentRequest req
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.SegmentId.IsEmpty() || request.SegmentId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SegmentId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SegmentId"), request.SegmentId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("SegmentId"), request.SegmentId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5136,7 +4436,7 @@ void UPlayFabAdminAPI::HelperDeleteSegment(FPlayFabBaseModel response, UObject*
         FAdminDeleteSegmentsResponse ResultStruct = UPlayFabAdminModelDecoder::decodeDeleteSegmentsResponseResponse(response.responseData);
         OnSuccessDeleteSegment.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteSegment.Unbind();
 }
 
 /** Get detail information of a segment and its associated definition(s) and action(s) for a title. */
@@ -5146,9 +4446,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetSegments(FAdminGetSegmentsRequest request
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5162,18 +4460,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetSegments(FAdminGetSegmentsRequest request
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.SegmentIds.IsEmpty() || request.SegmentIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SegmentIds"));
-    } else {
-        TArray<FString> SegmentIdsArray;
-        FString(request.SegmentIds).ParseIntoArray(SegmentIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("SegmentIds"), SegmentIdsArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("SegmentIds"), request.SegmentIds);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5191,7 +4483,7 @@ void UPlayFabAdminAPI::HelperGetSegments(FPlayFabBaseModel response, UObject* cu
         FAdminGetSegmentsResponse ResultStruct = UPlayFabAdminModelDecoder::decodeGetSegmentsResponseResponse(response.responseData);
         OnSuccessGetSegments.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetSegments.Unbind();
 }
 
 /** Updates an existing player segment and its associated definition(s) and action(s) for a title. */
@@ -5201,9 +4493,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateSegment(FAdminUpdateSegmentRequest req
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5217,11 +4507,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateSegment(FAdminUpdateSegmentRequest req
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.SegmentModel != nullptr) OutRestJsonObj->SetObjectField(TEXT("SegmentModel"), request.SegmentModel);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("SegmentModel"), request.SegmentModel);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5239,7 +4530,7 @@ void UPlayFabAdminAPI::HelperUpdateSegment(FPlayFabBaseModel response, UObject*
         FAdminUpdateSegmentResponse ResultStruct = UPlayFabAdminModelDecoder::decodeUpdateSegmentResponseResponse(response.responseData);
         OnSuccessUpdateSegment.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateSegment.Unbind();
 }
 
 
@@ -5253,9 +4544,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetCloudScriptRevision(FAdminGetCloudScriptR
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5269,12 +4558,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetCloudScriptRevision(FAdminGetCloudScriptR
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("Revision"), request.Revision);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteNumber(TEXT("Revision"), request.Revision);
+    RequestWriter.WriteNumber(TEXT("Version"), request.Version);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5292,7 +4582,7 @@ void UPlayFabAdminAPI::HelperGetCloudScriptRevision(FPlayFabBaseModel response,
         FAdminGetCloudScriptRevisionResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetCloudScriptRevisionResultResponse(response.responseData);
         OnSuccessGetCloudScriptRevision.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetCloudScriptRevision.Unbind();
 }
 
 /** Lists all the current cloud script versions. For each version, information about the current published and latest revisions is also listed. */
@@ -5302,9 +4592,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetCloudScriptVersions(FAdminGetCloudScriptV
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5318,10 +4606,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetCloudScriptVersions(FAdminGetCloudScriptV
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5339,7 +4628,7 @@ void UPlayFabAdminAPI::HelperGetCloudScriptVersions(FPlayFabBaseModel response,
         FAdminGetCloudScriptVersionsResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetCloudScriptVersionsResultResponse(response.responseData);
         OnSuccessGetCloudScriptVersions.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetCloudScriptVersions.Unbind();
 }
 
 /** Sets the currently published revision of a title Cloud Script */
@@ -5349,9 +4638,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetPublishedRevision(FAdminSetPublishedRevis
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5365,13 +4652,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetPublishedRevision(FAdminSetPublishedRevis
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("Revision"), request.Revision);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("Revision"), request.Revision);
+    RequestWriter.WriteNumber(TEXT("Version"), request.Version);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5389,7 +4677,7 @@ void UPlayFabAdminAPI::HelperSetPublishedRevision(FPlayFabBaseModel response, UO
         FAdminSetPublishedRevisionResult ResultStruct = UPlayFabAdminModelDecoder::decodeSetPublishedRevisionResultResponse(response.responseData);
         OnSuccessSetPublishedRevision.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetPublishedRevision.Unbind();
 }
 
 /** Creates a new Cloud Script revision and uploads source code to it. Note that at this time, only one file should be submitted in the revision. */
@@ -5399,9 +4687,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateCloudScript(FAdminUpdateCloudScriptReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5415,22 +4701,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateCloudScript(FAdminUpdateCloudScriptReq
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.DeveloperPlayFabId.IsEmpty() || request.DeveloperPlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeveloperPlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeveloperPlayFabId"), request.DeveloperPlayFabId);
-    }
-    if (request.Files.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Files"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Files"), request.Files);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("Publish"), request.Publish);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("DeveloperPlayFabId"), request.DeveloperPlayFabId);
+    RequestWriter.WriteObjectArray(TEXT("Files"), request.Files);
+    RequestWriter.WriteBool(TEXT("Publish"), request.Publish);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5448,7 +4727,7 @@ void UPlayFabAdminAPI::HelperUpdateCloudScript(FPlayFabBaseModel response, UObje
         FAdminUpdateCloudScriptResult ResultStruct = UPlayFabAdminModelDecoder::decodeUpdateCloudScriptResultResponse(response.responseData);
         OnSuccessUpdateCloudScript.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateCloudScript.Unbind();
 }
 
 
@@ -5462,9 +4741,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetPublisherData(FAdminSetPublisherDataReque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5478,20 +4755,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetPublisherData(FAdminSetPublisherDataReque
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    if (request.Value.IsEmpty() || request.Value == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Value"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Value"), request.Value);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Key"), request.Key);
+    RequestWriter.WriteStringOrNull(TEXT("Value"), request.Value);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5509,7 +4779,7 @@ void UPlayFabAdminAPI::HelperSetPublisherData(FPlayFabBaseModel response, UObjec
         FAdminSetPublisherDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeSetPublisherDataResultResponse(response.responseData);
         OnSuccessSetPublisherData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetPublisherData.Unbind();
 }
 
 
@@ -5523,9 +4793,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddLocalizedNews(FAdminAddLocalizedNewsReque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5539,31 +4807,16 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddLocalizedNews(FAdminAddLocalizedNewsReque
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Body.IsEmpty() || request.Body == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Body"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Body"), request.Body);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Language.IsEmpty() || request.Language == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Language"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Language"), request.Language);
-    }
-    if (request.NewsId.IsEmpty() || request.NewsId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("NewsId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("NewsId"), request.NewsId);
-    }
-    if (request.Title.IsEmpty() || request.Title == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Title"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Title"), request.Title);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Body"), request.Body);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Language"), request.Language);
+    RequestWriter.WriteStringOrNull(TEXT("NewsId"), request.NewsId);
+    RequestWriter.WriteStringOrNull(TEXT("Title"), request.Title);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5581,7 +4834,7 @@ void UPlayFabAdminAPI::HelperAddLocalizedNews(FPlayFabBaseModel response, UObjec
         FAdminAddLocalizedNewsResult ResultStruct = UPlayFabAdminModelDecoder::decodeAddLocalizedNewsResultResponse(response.responseData);
         OnSuccessAddLocalizedNews.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddLocalizedNews.Unbind();
 }
 
 /** Adds a new news item to the title's news feed */
@@ -5591,9 +4844,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddNews(FAdminAddNewsRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5607,26 +4858,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddNews(FAdminAddNewsRequest request,
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Body.IsEmpty() || request.Body == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Body"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Body"), request.Body);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
-    if (request.Title.IsEmpty() || request.Title == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Title"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Title"), request.Title);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Body"), request.Body);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Timestamp"), request.Timestamp);
+    RequestWriter.WriteStringOrNull(TEXT("Title"), request.Title);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5644,7 +4884,7 @@ void UPlayFabAdminAPI::HelperAddNews(FPlayFabBaseModel response, UObject* custom
         FAdminAddNewsResult ResultStruct = UPlayFabAdminModelDecoder::decodeAddNewsResultResponse(response.responseData);
         OnSuccessAddNews.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddNews.Unbind();
 }
 
 /** Adds one or more virtual currencies to the set defined for the title. Virtual Currencies have a maximum value of 2,147,483,647 when granted to a player. Any value over that will be discarded. */
@@ -5654,9 +4894,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddVirtualCurrencyTypes(FAdminAddVirtualCurr
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5670,15 +4908,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddVirtualCurrencyTypes(FAdminAddVirtualCurr
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.VirtualCurrencies.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrencies"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("VirtualCurrencies"), request.VirtualCurrencies);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObjectArray(TEXT("VirtualCurrencies"), request.VirtualCurrencies);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5694,10 +4929,10 @@ void UPlayFabAdminAPI::HelperAddVirtualCurrencyTypes(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessAddVirtualCurrencyTypes.IsBound())
     {
         FAdminBlankResult ResultStruct = UPlayFabAdminModelDecoder::decodeBlankResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessAddVirtualCurrencyTypes.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAddVirtualCurrencyTypes.Unbind();
 }
 
 /** Deletes an existing virtual item store */
@@ -5707,9 +4942,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteStore(FAdminDeleteStoreRequest request
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5723,21 +4956,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteStore(FAdminDeleteStoreRequest request
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.StoreId.IsEmpty() || request.StoreId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StoreId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StoreId"), request.StoreId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("StoreId"), request.StoreId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5755,7 +4981,7 @@ void UPlayFabAdminAPI::HelperDeleteStore(FPlayFabBaseModel response, UObject* cu
         FAdminDeleteStoreResult ResultStruct = UPlayFabAdminModelDecoder::decodeDeleteStoreResultResponse(response.responseData);
         OnSuccessDeleteStore.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteStore.Unbind();
 }
 
 /** Deletes a specified set of title data overrides. */
@@ -5765,9 +4991,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteTitleDataOverride(FAdminDeleteTitleDat
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5781,15 +5005,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteTitleDataOverride(FAdminDeleteTitleDat
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.OverrideLabel.IsEmpty() || request.OverrideLabel == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OverrideLabel"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OverrideLabel"), request.OverrideLabel);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("OverrideLabel"), request.OverrideLabel);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5807,7 +5028,7 @@ void UPlayFabAdminAPI::HelperDeleteTitleDataOverride(FPlayFabBaseModel response,
         FAdminDeleteTitleDataOverrideResult ResultStruct = UPlayFabAdminModelDecoder::decodeDeleteTitleDataOverrideResultResponse(response.responseData);
         OnSuccessDeleteTitleDataOverride.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteTitleDataOverride.Unbind();
 }
 
 /** Retrieves the specified version of the title's catalog of virtual goods, including all defined properties */
@@ -5817,9 +5038,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetCatalogItems(FAdminGetCatalogItemsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5833,15 +5052,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetCatalogItems(FAdminGetCatalogItemsRequest
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5859,7 +5075,7 @@ void UPlayFabAdminAPI::HelperGetCatalogItems(FPlayFabBaseModel response, UObject
         FAdminGetCatalogItemsResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetCatalogItemsResultResponse(response.responseData);
         OnSuccessGetCatalogItems.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetCatalogItems.Unbind();
 }
 
 /** Retrieves the key-value store of custom publisher settings */
@@ -5869,9 +5085,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPublisherData(FAdminGetPublisherDataReque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5885,18 +5099,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPublisherData(FAdminGetPublisherDataReque
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5914,7 +5122,7 @@ void UPlayFabAdminAPI::HelperGetPublisherData(FPlayFabBaseModel response, UObjec
         FAdminGetPublisherDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetPublisherDataResultResponse(response.responseData);
         OnSuccessGetPublisherData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPublisherData.Unbind();
 }
 
 /** Retrieves the random drop table configuration for the title */
@@ -5924,9 +5132,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetRandomResultTables(FAdminGetRandomResultT
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5940,15 +5146,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetRandomResultTables(FAdminGetRandomResultT
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -5966,7 +5169,7 @@ void UPlayFabAdminAPI::HelperGetRandomResultTables(FPlayFabBaseModel response, U
         FAdminGetRandomResultTablesResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetRandomResultTablesResultResponse(response.responseData);
         OnSuccessGetRandomResultTables.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetRandomResultTables.Unbind();
 }
 
 /** Retrieves the set of items defined for the specified store, including all prices defined */
@@ -5976,9 +5179,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetStoreItems(FAdminGetStoreItemsRequest req
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -5992,20 +5193,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetStoreItems(FAdminGetStoreItemsRequest req
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.StoreId.IsEmpty() || request.StoreId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StoreId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StoreId"), request.StoreId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteStringOrNull(TEXT("StoreId"), request.StoreId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6023,7 +5217,7 @@ void UPlayFabAdminAPI::HelperGetStoreItems(FPlayFabBaseModel response, UObject*
         FAdminGetStoreItemsResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetStoreItemsResultResponse(response.responseData);
         OnSuccessGetStoreItems.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetStoreItems.Unbind();
 }
 
 /** Retrieves the key-value store of custom title settings which can be read by the client */
@@ -6033,9 +5227,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetTitleData(FAdminGetTitleDataRequest reque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6049,23 +5241,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetTitleData(FAdminGetTitleDataRequest reque
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.OverrideLabel.IsEmpty() || request.OverrideLabel == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OverrideLabel"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OverrideLabel"), request.OverrideLabel);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("OverrideLabel"), request.OverrideLabel);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6083,7 +5265,7 @@ void UPlayFabAdminAPI::HelperGetTitleData(FPlayFabBaseModel response, UObject* c
         FAdminGetTitleDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetTitleDataResultResponse(response.responseData);
         OnSuccessGetTitleData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetTitleData.Unbind();
 }
 
 /** Retrieves the key-value store of custom title settings which cannot be read by the client */
@@ -6093,9 +5275,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetTitleInternalData(FAdminGetTitleDataReque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6109,23 +5289,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetTitleInternalData(FAdminGetTitleDataReque
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.OverrideLabel.IsEmpty() || request.OverrideLabel == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OverrideLabel"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OverrideLabel"), request.OverrideLabel);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringArray(TEXT("Keys"), request.Keys);
+    RequestWriter.WriteStringOrNull(TEXT("OverrideLabel"), request.OverrideLabel);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6141,10 +5311,10 @@ void UPlayFabAdminAPI::HelperGetTitleInternalData(FPlayFabBaseModel response, UO
     else if (!error.hasError && OnSuccessGetTitleInternalData.IsBound())
     {
         FAdminGetTitleDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeGetTitleDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetTitleInternalData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetTitleInternalData.Unbind();
 }
 
 /** Retuns the list of all defined virtual currencies for the title */
@@ -6154,9 +5324,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ListVirtualCurrencyTypes(FAdminListVirtualCu
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6170,10 +5338,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ListVirtualCurrencyTypes(FAdminListVirtualCu
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6191,7 +5360,7 @@ void UPlayFabAdminAPI::HelperListVirtualCurrencyTypes(FPlayFabBaseModel response
         FAdminListVirtualCurrencyTypesResult ResultStruct = UPlayFabAdminModelDecoder::decodeListVirtualCurrencyTypesResultResponse(response.responseData);
         OnSuccessListVirtualCurrencyTypes.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListVirtualCurrencyTypes.Unbind();
 }
 
 /** Removes one or more virtual currencies from the set defined for the title. */
@@ -6201,9 +5370,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RemoveVirtualCurrencyTypes(FAdminRemoveVirtu
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6217,15 +5384,12 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RemoveVirtualCurrencyTypes(FAdminRemoveVirtu
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.VirtualCurrencies.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrencies"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("VirtualCurrencies"), request.VirtualCurrencies);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObjectArray(TEXT("VirtualCurrencies"), request.VirtualCurrencies);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6241,10 +5405,10 @@ void UPlayFabAdminAPI::HelperRemoveVirtualCurrencyTypes(FPlayFabBaseModel respon
     else if (!error.hasError && OnSuccessRemoveVirtualCurrencyTypes.IsBound())
     {
         FAdminBlankResult ResultStruct = UPlayFabAdminModelDecoder::decodeBlankResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessRemoveVirtualCurrencyTypes.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRemoveVirtualCurrencyTypes.Unbind();
 }
 
 /** Creates the catalog configuration of all virtual goods for the specified catalog version */
@@ -6254,9 +5418,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetCatalogItems(FAdminUpdateCatalogItemsRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6270,22 +5432,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetCatalogItems(FAdminUpdateCatalogItemsRequ
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Catalog.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Catalog"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Catalog"), request.Catalog);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("SetAsDefaultCatalog"), request.SetAsDefaultCatalog);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObjectArray(TEXT("Catalog"), request.Catalog);
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("SetAsDefaultCatalog"), request.SetAsDefaultCatalog);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6303,7 +5458,7 @@ void UPlayFabAdminAPI::HelperSetCatalogItems(FPlayFabBaseModel response, UObject
         FAdminUpdateCatalogItemsResult ResultStruct = UPlayFabAdminModelDecoder::decodeUpdateCatalogItemsResultResponse(response.responseData);
         OnSuccessSetCatalogItems.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetCatalogItems.Unbind();
 }
 
 /** Sets all the items in one virtual store */
@@ -6313,9 +5468,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetStoreItems(FAdminUpdateStoreItemsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6329,27 +5482,16 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetStoreItems(FAdminUpdateStoreItemsRequest
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.MarketingData != nullptr) OutRestJsonObj->SetObjectField(TEXT("MarketingData"), request.MarketingData);
-    if (request.Store.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Store"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Store"), request.Store);
-    }
-    if (request.StoreId.IsEmpty() || request.StoreId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StoreId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StoreId"), request.StoreId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("MarketingData"), request.MarketingData);
+    RequestWriter.WriteObjectArray(TEXT("Store"), request.Store);
+    RequestWriter.WriteStringOrNull(TEXT("StoreId"), request.StoreId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6367,7 +5509,7 @@ void UPlayFabAdminAPI::HelperSetStoreItems(FPlayFabBaseModel response, UObject*
         FAdminUpdateStoreItemsResult ResultStruct = UPlayFabAdminModelDecoder::decodeUpdateStoreItemsResultResponse(response.responseData);
         OnSuccessSetStoreItems.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetStoreItems.Unbind();
 }
 
 /** Creates and updates the key-value store of custom title settings which can be read by the client */
@@ -6377,9 +5519,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetTitleData(FAdminSetTitleDataRequest reque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6393,20 +5533,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetTitleData(FAdminSetTitleDataRequest reque
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    if (request.Value.IsEmpty() || request.Value == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Value"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Value"), request.Value);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Key"), request.Key);
+    RequestWriter.WriteStringOrNull(TEXT("Value"), request.Value);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6424,7 +5557,7 @@ void UPlayFabAdminAPI::HelperSetTitleData(FPlayFabBaseModel response, UObject* c
         FAdminSetTitleDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeSetTitleDataResultResponse(response.responseData);
         OnSuccessSetTitleData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetTitleData.Unbind();
 }
 
 /** Set and delete key-value pairs in a title data override instance. */
@@ -6434,9 +5567,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetTitleDataAndOverrides(FAdminSetTitleDataA
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6450,20 +5581,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetTitleDataAndOverrides(FAdminSetTitleDataA
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.KeyValues.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("KeyValues"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("KeyValues"), request.KeyValues);
-    }
-    if (request.OverrideLabel.IsEmpty() || request.OverrideLabel == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OverrideLabel"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OverrideLabel"), request.OverrideLabel);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObjectArray(TEXT("KeyValues"), request.KeyValues);
+    RequestWriter.WriteStringOrNull(TEXT("OverrideLabel"), request.OverrideLabel);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6481,7 +5605,7 @@ void UPlayFabAdminAPI::HelperSetTitleDataAndOverrides(FPlayFabBaseModel response
         FAdminSetTitleDataAndOverridesResult ResultStruct = UPlayFabAdminModelDecoder::decodeSetTitleDataAndOverridesResultResponse(response.responseData);
         OnSuccessSetTitleDataAndOverrides.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetTitleDataAndOverrides.Unbind();
 }
 
 /** Updates the key-value store of custom title settings which cannot be read by the client */
@@ -6491,9 +5615,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetTitleInternalData(FAdminSetTitleDataReque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6507,20 +5629,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetTitleInternalData(FAdminSetTitleDataReque
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    if (request.Value.IsEmpty() || request.Value == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Value"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Value"), request.Value);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Key"), request.Key);
+    RequestWriter.WriteStringOrNull(TEXT("Value"), request.Value);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6536,10 +5651,10 @@ void UPlayFabAdminAPI::HelperSetTitleInternalData(FPlayFabBaseModel response, UO
     else if (!error.hasError && OnSuccessSetTitleInternalData.IsBound())
     {
         FAdminSetTitleDataResult ResultStruct = UPlayFabAdminModelDecoder::decodeSetTitleDataResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessSetTitleInternalData.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetTitleInternalData.Unbind();
 }
 
 /** Sets the Amazon Resource Name (ARN) for iOS and Android push notifications. Documentation on the exact restrictions can be found at: http://docs.aws.amazon.com/sns/latest/api/API_CreatePlatformApplication.html. Currently, Amazon device Messaging is not supported. */
@@ -6549,9 +5664,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetupPushNotification(FAdminSetupPushNotific
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6565,29 +5678,18 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetupPushNotification(FAdminSetupPushNotific
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Credential.IsEmpty() || request.Credential == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Credential"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Credential"), request.Credential);
-    }
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    if (request.Name.IsEmpty() || request.Name == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Name"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Name"), request.Name);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("OverwriteOldARN"), request.OverwriteOldARN);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("Credential"), request.Credential);
+    RequestWriter.WriteStringOrNull(TEXT("Key"), request.Key);
+    RequestWriter.WriteStringOrNull(TEXT("Name"), request.Name);
+    RequestWriter.WriteBool(TEXT("OverwriteOldARN"), request.OverwriteOldARN);
     FString temp_Platform;
     if (GetEnumValueToString<EPushSetupPlatform>(TEXT("EPushSetupPlatform"), request.Platform, temp_Platform))
-        OutRestJsonObj->SetStringField(TEXT("Platform"), temp_Platform);
+        RequestWriter.WriteString(TEXT("Platform"), temp_Platform);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6605,7 +5707,7 @@ void UPlayFabAdminAPI::HelperSetupPushNotification(FPlayFabBaseModel response, U
         FAdminSetupPushNotificationResult ResultStruct = UPlayFabAdminModelDecoder::decodeSetupPushNotificationResultResponse(response.responseData);
         OnSuccessSetupPushNotification.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetupPushNotification.Unbind();
 }
 
 /** Updates the catalog configuration for virtual goods in the specified catalog version */
@@ -6615,9 +5717,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateCatalogItems(FAdminUpdateCatalogItemsR
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6631,22 +5731,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateCatalogItems(FAdminUpdateCatalogItemsR
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Catalog.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Catalog"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Catalog"), request.Catalog);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("SetAsDefaultCatalog"), request.SetAsDefaultCatalog);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObjectArray(TEXT("Catalog"), request.Catalog);
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("SetAsDefaultCatalog"), request.SetAsDefaultCatalog);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6662,10 +5755,10 @@ void UPlayFabAdminAPI::HelperUpdateCatalogItems(FPlayFabBaseModel response, UObj
     else if (!error.hasError && OnSuccessUpdateCatalogItems.IsBound())
     {
         FAdminUpdateCatalogItemsResult ResultStruct = UPlayFabAdminModelDecoder::decodeUpdateCatalogItemsResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateCatalogItems.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateCatalogItems.Unbind();
 }
 
 /** Updates the random drop table configuration for the title */
@@ -6675,9 +5768,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateRandomResultTables(FAdminUpdateRandomR
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6691,21 +5782,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateRandomResultTables(FAdminUpdateRandomR
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Tables.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Tables"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Tables"), request.Tables);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObjectArray(TEXT("Tables"), request.Tables);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6723,7 +5807,7 @@ void UPlayFabAdminAPI::HelperUpdateRandomResultTables(FPlayFabBaseModel response
         FAdminUpdateRandomResultTablesResult ResultStruct = UPlayFabAdminModelDecoder::decodeUpdateRandomResultTablesResultResponse(response.responseData);
         OnSuccessUpdateRandomResultTables.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateRandomResultTables.Unbind();
 }
 
 /** Updates an existing virtual item store with new or modified items */
@@ -6733,9 +5817,7 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateStoreItems(FAdminUpdateStoreItemsReque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -6749,27 +5831,16 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateStoreItems(FAdminUpdateStoreItemsReque
     manager->useSecretKey = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.MarketingData != nullptr) OutRestJsonObj->SetObjectField(TEXT("MarketingData"), request.MarketingData);
-    if (request.Store.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Store"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Store"), request.Store);
-    }
-    if (request.StoreId.IsEmpty() || request.StoreId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StoreId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StoreId"), request.StoreId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("CatalogVersion"), request.CatalogVersion);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("MarketingData"), request.MarketingData);
+    RequestWriter.WriteObjectArray(TEXT("Store"), request.Store);
+    RequestWriter.WriteStringOrNull(TEXT("StoreId"), request.StoreId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -6785,16 +5856,19 @@ void UPlayFabAdminAPI::HelperUpdateStoreItems(FPlayFabBaseModel response, UObjec
     else if (!error.hasError && OnSuccessUpdateStoreItems.IsBound())
     {
         FAdminUpdateStoreItemsResult ResultStruct = UPlayFabAdminModelDecoder::decodeUpdateStoreItemsResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateStoreItems.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateStoreItems.Unbind();
 }
 
 
 
 void UPlayFabAdminAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
+    PlayFabCommon::FPlayFabCallCounters::EndCall(Request->GetURL());
+    PLAYFAB_TRACE_END(Wait, Request);
+
     // Be sure that we have no data from previous response
     ResetResponseData();
 
@@ -6803,6 +5877,14 @@ void UPlayFabAdminAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpRe
         UE_LOG(LogPlayFab, Error, TEXT("The request object is invalid during OnProcessRequestComplete."));
         return;
     }
+
+    // The call is over however this returns; the result helpers run during the broadcast, before the proxy is cleared
+    // Only set up once the object is known to be valid, as an invalid one can't be trusted to go back to the pool
+    ON_SCOPE_EXIT
+    {
+        ReleaseToPool();
+    };
+
     if (!OnPlayFabResponse.IsBound())
     {
         UE_LOG(LogPlayFab, Error, TEXT("OnPlayFabResponse has come un-bound during OnProcessRequestComplete."));
@@ -6822,20 +5904,25 @@ void UPlayFabAdminAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpRe
         myResponse.responseError.ErrorName = "Unable to contact server";
         myResponse.responseError.ErrorMessage = "Unable to contact server";
 
+        PLAYFAB_TRACE_SCOPE(Dispatch, Request);
         OnPlayFabResponse.Broadcast(myResponse, mCustomData, false);
 
         return;
     }
 
-    // Save response data as a string
-    ResponseContent = Response->GetContentAsString();
+    {
+        PLAYFAB_TRACE_SCOPE(Decode, Request);
+
+        // Save response data as a string
+        ResponseContent = Response->GetContentAsString();
 
-    // Save response code as int32
-    ResponseCode = Response->GetResponseCode();
+        // Save response code as int32
+        ResponseCode = Response->GetResponseCode();
 
-    // Try to deserialize data to JSON
-    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-    FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+        // Try to deserialize data to JSON
+        TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
+        FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+    }
 
     // Decide whether the request was successful
     bIsValidJsonResponse = bWasSuccessful && ResponseJsonObj->GetRootObject().IsValid();
@@ -6845,7 +5932,7 @@ void UPlayFabAdminAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpRe
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
 
     // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
+    PlayFabCommon::FPlayFabRequestLog::LogResponse(Request, ResponseCode, Response->GetContent());
 
     myResponse.responseError.decodeError(ResponseJsonObj);
     myResponse.responseData = ResponseJsonObj;
@@ -6860,8 +5947,8 @@ void UPlayFabAdminAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpRe
     }
 
     // Broadcast the result event
+    PLAYFAB_TRACE_SCOPE(Dispatch, Request);
     OnPlayFabResponse.Broadcast(myResponse, mCustomData, !myResponse.responseError.hasError);
-    pfSettings->ModifyPendingCallCount(-1);
 }
 
 void UPlayFabAdminAPI::Activate()
@@ -6919,24 +6006,55 @@ void UPlayFabAdminAPI::Activate()
     for (TMap<FString, FString>::TConstIterator It(RequestHeaders); It; ++It)
         HttpRequest->SetHeader(It.Key(), It.Value());
 
-    // Serialize data to json string
-    FString OutputString;
-    TSharedRef< TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    // Requests made by the generated functions are already serialized; one set with SetRequestObject is serialized here
+    if (RequestJsonObj != nullptr && RequestBody.Num() == 0)
+    {
+        PLAYFAB_TRACE_SCOPE(Serialize, HttpRequest);
+        FMemoryWriter BodyStream(RequestBody);
+        PlayFab::JsonUtf8Writer Writer = TJsonWriterFactory<TCHAR, PlayFab::FPlayFabCondensedUtf8PrintPolicy>::Create(&BodyStream);
+        FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    }
 
     // Set Json content
-    HttpRequest->SetContentAsString(OutputString);
+    HttpRequest->SetContent(RequestBody);
 
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
+    PlayFabCommon::FPlayFabRequestLog::LogRequest(HttpRequest, RequestBody);
 
     // Bind event
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabAdminAPI::OnProcessRequestComplete);
 
     // Execute the request
-    pfSettings->ModifyPendingCallCount(1);
+    PlayFabCommon::FPlayFabCallCounters::BeginCall(RequestUrl);
+    PLAYFAB_TRACE_BEGIN(Wait, HttpRequest);
+    PLAYFAB_TRACE_SCOPE(Send, HttpRequest);
     HttpRequest->ProcessRequest();
 }
 
+void UPlayFabAdminAPI::ReleaseToPool()
+{
+    // Clear everything the next call through this proxy would otherwise inherit
+    OnPlayFabResponse.Clear();
+    OnFailure.Unbind();
+    mCustomData = nullptr;
+    CallAuthenticationContext = nullptr;
+    PlayFabRequestURL.Reset();
+    useEntityToken = false;
+    useSecretKey = false;
+    useSessionTicket = false;
+    returnsSessionTicket = false;
+    returnsEntityToken = false;
+    RequestHeaders.Reset();
+    ResponseContent.Reset();
+    ResponseCode = 0;
+    bIsValidJsonResponse = false;
+
+    // The request object is the caller's, or was handed to the caller with the result, so it isn't recycled
+    RequestBody.Reset();
+    RequestJsonObj = nullptr;
+    // The response object is kept with the proxy, and cleared when its next response arrives
+    FPlayFabObjectPool::Release(this);
+}
+
 void UPlayFabAdminAPI::ResetResponseData()
 {
     if (ResponseJsonObj != nullptr)
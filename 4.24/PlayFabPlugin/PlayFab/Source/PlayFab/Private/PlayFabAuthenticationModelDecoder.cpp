@@ -11,6 +11,7 @@
 
 #include "PlayFabAuthenticationModelDecoder.h"
 #include "PlayFabPrivate.h"
+#include "PlayFabJsonDecoder.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Authentication API Functions
@@ -31,11 +32,11 @@ FAuthenticationGetEntityTokenResponse UPlayFabAuthenticationModelDecoder::decode
 {
     // Temp ustruct
     FAuthenticationGetEntityTokenResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Entity = !(dataObj->HasField("Entity")) ? nullptr : dataObj->GetObjectField("Entity");
-    tempStruct.EntityToken = !(dataObj->HasField("EntityToken")) ? TEXT("") : dataObj->GetStringField("EntityToken");
-    tempStruct.TokenExpiration = !(dataObj->HasField("TokenExpiration")) ? TEXT("") : dataObj->GetStringField("TokenExpiration");
+    tempStruct.Entity = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Entity"));
+    tempStruct.EntityToken = FPlayFabJsonDecoder::GetString(dataObj, TEXT("EntityToken"));
+    tempStruct.TokenExpiration = FPlayFabJsonDecoder::GetString(dataObj, TEXT("TokenExpiration"));
 
     return tempStruct;
 }
@@ -44,12 +45,12 @@ FAuthenticationValidateEntityTokenResponse UPlayFabAuthenticationModelDecoder::d
 {
     // Temp ustruct
     FAuthenticationValidateEntityTokenResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Entity = !(dataObj->HasField("Entity")) ? nullptr : dataObj->GetObjectField("Entity");
-    GetEnumValueFromString<EIdentifiedDeviceType>(TEXT("EIdentifiedDeviceType"), dataObj->GetStringField("IdentifiedDeviceType"), tempStruct.IdentifiedDeviceType);
-    GetEnumValueFromString<ELoginIdentityProvider>(TEXT("ELoginIdentityProvider"), dataObj->GetStringField("IdentityProvider"), tempStruct.IdentityProvider);
-    tempStruct.Lineage = !(dataObj->HasField("Lineage")) ? nullptr : dataObj->GetObjectField("Lineage");
+    tempStruct.Entity = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Entity"));
+    GetEnumValueFromString<EIdentifiedDeviceType>(TEXT("EIdentifiedDeviceType"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("IdentifiedDeviceType")), tempStruct.IdentifiedDeviceType);
+    GetEnumValueFromString<ELoginIdentityProvider>(TEXT("ELoginIdentityProvider"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("IdentityProvider")), tempStruct.IdentityProvider);
+    tempStruct.Lineage = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Lineage"));
 
     return tempStruct;
 }
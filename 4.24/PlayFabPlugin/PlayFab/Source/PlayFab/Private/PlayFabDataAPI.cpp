@@ -16,6 +16,12 @@
 #include "PlayFabEnums.h"
 #include "PlayFabCommon/Public/PlayFabAuthenticationContext.h"
 #include "PlayFabCommon/Public/PlayFabCommonUtils.h"
+#include "PlayFabCommon/Public/PlayFabCallCounters.h"
+#include "PlayFabCommon/Public/PlayFabTrace.h"
+#include "PlayFabCommon/Public/PlayFabRequestLog.h"
+#include "PlayFabObjectPool.h"
+#include "PlayFabRequestWriter.h"
+#include "Misc/ScopeExit.h"
 
 UPlayFabDataAPI::UPlayFabDataAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -30,7 +36,26 @@ void UPlayFabDataAPI::SetCallAuthenticationContext(UPlayFabAuthenticationContext
 
 void UPlayFabDataAPI::SetRequestObject(UPlayFabJsonObject* JsonObject)
 {
+    // The object replaces any body serialized before, and is serialized in Activate
     RequestJsonObj = JsonObject;
+    RequestBody.Reset();
+}
+
+void UPlayFabDataAPI::SetRequestBody(TArray<uint8>&& Body)
+{
+    RequestBody = MoveTemp(Body);
+    RequestJsonObj = nullptr;
+}
+
+UPlayFabJsonObject* UPlayFabDataAPI::GetRequestObject()
+{
+    if (RequestJsonObj == nullptr && RequestBody.Num() > 0)
+    {
+        // Only the few results that hand the request back to Blueprint pay for parsing it
+        RequestJsonObj = NewObject<UPlayFabJsonObject>();
+        RequestJsonObj->DecodeJson(FPlayFabRequestWriter::ToString(RequestBody));
+    }
+    return RequestJsonObj;
 }
 
 UPlayFabJsonObject* UPlayFabDataAPI::GetResponseObject()
@@ -40,31 +65,7 @@ UPlayFabJsonObject* UPlayFabDataAPI::GetResponseObject()
 
 FString UPlayFabDataAPI::PercentEncode(const FString& Text)
 {
-    FString OutText = Text;
-
-    OutText = OutText.Replace(TEXT("!"), TEXT("%21"));
-    OutText = OutText.Replace(TEXT("\""), TEXT("%22"));
-    OutText = OutText.Replace(TEXT("#"), TEXT("%23"));
-    OutText = OutText.Replace(TEXT("$"), TEXT("%24"));
-    //OutText = OutText.Replace(TEXT("&"), TEXT("%26"));
-    OutText = OutText.Replace(TEXT("'"), TEXT("%27"));
-    OutText = OutText.Replace(TEXT("("), TEXT("%28"));
-    OutText = OutText.Replace(TEXT(")"), TEXT("%29"));
-    OutText = OutText.Replace(TEXT("*"), TEXT("%2A"));
-    OutText = OutText.Replace(TEXT("+"), TEXT("%2B"));
-    OutText = OutText.Replace(TEXT(","), TEXT("%2C"));
-    //OutText = OutText.Replace(TEXT("/"), TEXT("%2F"));
-    OutText = OutText.Replace(TEXT(":"), TEXT("%3A"));
-    OutText = OutText.Replace(TEXT(";"), TEXT("%3B"));
-    OutText = OutText.Replace(TEXT("="), TEXT("%3D"));
-    //OutText = OutText.Replace(TEXT("?"), TEXT("%3F"));
-    OutText = OutText.Replace(TEXT("@"), TEXT("%40"));
-    OutText = OutText.Replace(TEXT("["), TEXT("%5B"));
-    OutText = OutText.Replace(TEXT("]"), TEXT("%5D"));
-    OutText = OutText.Replace(TEXT("{"), TEXT("%7B"));
-    OutText = OutText.Replace(TEXT("}"), TEXT("%7D"));
-
-    return OutText;
+    return PlayFabCommon::PlayFabCommonUtils::PercentEncode(Text);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -82,9 +83,7 @@ UPlayFabDataAPI* UPlayFabDataAPI::AbortFileUploads(FDataAbortFileUploadsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabDataAPI* manager = NewObject<UPlayFabDataAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabDataAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabDataAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -98,21 +97,15 @@ UPlayFabDataAPI* UPlayFabDataAPI::AbortFileUploads(FDataAbortFileUploadsRequest
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    // Check to see if string is empty
-    if (request.FileNames.IsEmpty() || request.FileNames == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FileNames"));
-    } else {
-        TArray<FString> FileNamesArray;
-        FString(request.FileNames).ParseIntoArray(FileNamesArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("FileNames"), FileNamesArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("ProfileVersion"), request.ProfileVersion);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteStringArray(TEXT("FileNames"), request.FileNames);
+    RequestWriter.WriteNumber(TEXT("ProfileVersion"), request.ProfileVersion);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -130,7 +123,7 @@ void UPlayFabDataAPI::HelperAbortFileUploads(FPlayFabBaseModel response, UObject
         FDataAbortFileUploadsResponse ResultStruct = UPlayFabDataModelDecoder::decodeAbortFileUploadsResponseResponse(response.responseData);
         OnSuccessAbortFileUploads.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessAbortFileUploads.Unbind();
 }
 
 /** Delete files on an entity's profile. */
@@ -140,9 +133,7 @@ UPlayFabDataAPI* UPlayFabDataAPI::DeleteFiles(FDataDeleteFilesRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabDataAPI* manager = NewObject<UPlayFabDataAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabDataAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabDataAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -156,21 +147,15 @@ UPlayFabDataAPI* UPlayFabDataAPI::DeleteFiles(FDataDeleteFilesRequest request,
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    // Check to see if string is empty
-    if (request.FileNames.IsEmpty() || request.FileNames == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FileNames"));
-    } else {
-        TArray<FString> FileNamesArray;
-        FString(request.FileNames).ParseIntoArray(FileNamesArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("FileNames"), FileNamesArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("ProfileVersion"), request.ProfileVersion);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteStringArray(TEXT("FileNames"), request.FileNames);
+    RequestWriter.WriteNumber(TEXT("ProfileVersion"), request.ProfileVersion);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -188,7 +173,7 @@ void UPlayFabDataAPI::HelperDeleteFiles(FPlayFabBaseModel response, UObject* cus
         FDataDeleteFilesResponse ResultStruct = UPlayFabDataModelDecoder::decodeDeleteFilesResponseResponse(response.responseData);
         OnSuccessDeleteFiles.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteFiles.Unbind();
 }
 
 /** Finalize file uploads to an entity's profile. */
@@ -198,9 +183,7 @@ UPlayFabDataAPI* UPlayFabDataAPI::FinalizeFileUploads(FDataFinalizeFileUploadsRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabDataAPI* manager = NewObject<UPlayFabDataAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabDataAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabDataAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -214,21 +197,15 @@ UPlayFabDataAPI* UPlayFabDataAPI::FinalizeFileUploads(FDataFinalizeFileUploadsRe
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    // Check to see if string is empty
-    if (request.FileNames.IsEmpty() || request.FileNames == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FileNames"));
-    } else {
-        TArray<FString> FileNamesArray;
-        FString(request.FileNames).ParseIntoArray(FileNamesArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("FileNames"), FileNamesArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("ProfileVersion"), request.ProfileVersion);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteStringArray(TEXT("FileNames"), request.FileNames);
+    RequestWriter.WriteNumber(TEXT("ProfileVersion"), request.ProfileVersion);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -246,7 +223,7 @@ void UPlayFabDataAPI::HelperFinalizeFileUploads(FPlayFabBaseModel response, UObj
         FDataFinalizeFileUploadsResponse ResultStruct = UPlayFabDataModelDecoder::decodeFinalizeFileUploadsResponseResponse(response.responseData);
         OnSuccessFinalizeFileUploads.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessFinalizeFileUploads.Unbind();
 }
 
 /** Retrieves file metadata from an entity's profile. */
@@ -256,9 +233,7 @@ UPlayFabDataAPI* UPlayFabDataAPI::GetFiles(FDataGetFilesRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabDataAPI* manager = NewObject<UPlayFabDataAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabDataAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabDataAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -272,12 +247,13 @@ UPlayFabDataAPI* UPlayFabDataAPI::GetFiles(FDataGetFilesRequest request,
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -295,7 +271,7 @@ void UPlayFabDataAPI::HelperGetFiles(FPlayFabBaseModel response, UObject* custom
         FDataGetFilesResponse ResultStruct = UPlayFabDataModelDecoder::decodeGetFilesResponseResponse(response.responseData);
         OnSuccessGetFiles.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetFiles.Unbind();
 }
 
 /** Initiates file uploads to an entity's profile. */
@@ -305,9 +281,7 @@ UPlayFabDataAPI* UPlayFabDataAPI::InitiateFileUploads(FDataInitiateFileUploadsRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabDataAPI* manager = NewObject<UPlayFabDataAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabDataAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabDataAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -321,21 +295,15 @@ UPlayFabDataAPI* UPlayFabDataAPI::InitiateFileUploads(FDataInitiateFileUploadsRe
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    // Check to see if string is empty
-    if (request.FileNames.IsEmpty() || request.FileNames == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FileNames"));
-    } else {
-        TArray<FString> FileNamesArray;
-        FString(request.FileNames).ParseIntoArray(FileNamesArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("FileNames"), FileNamesArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("ProfileVersion"), request.ProfileVersion);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteStringArray(TEXT("FileNames"), request.FileNames);
+    RequestWriter.WriteNumber(TEXT("ProfileVersion"), request.ProfileVersion);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -353,7 +321,7 @@ void UPlayFabDataAPI::HelperInitiateFileUploads(FPlayFabBaseModel response, UObj
         FDataInitiateFileUploadsResponse ResultStruct = UPlayFabDataModelDecoder::decodeInitiateFileUploadsResponseResponse(response.responseData);
         OnSuccessInitiateFileUploads.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessInitiateFileUploads.Unbind();
 }
 
 
@@ -367,9 +335,7 @@ UPlayFabDataAPI* UPlayFabDataAPI::GetObjects(FDataGetObjectsRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabDataAPI* manager = NewObject<UPlayFabDataAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabDataAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabDataAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -383,13 +349,14 @@ UPlayFabDataAPI* UPlayFabDataAPI::GetObjects(FDataGetObjectsRequest request,
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    OutRestJsonObj->SetBoolField(TEXT("EscapeObject"), request.EscapeObject);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteBool(TEXT("EscapeObject"), request.EscapeObject);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -407,7 +374,7 @@ void UPlayFabDataAPI::HelperGetObjects(FPlayFabBaseModel response, UObject* cust
         FDataGetObjectsResponse ResultStruct = UPlayFabDataModelDecoder::decodeGetObjectsResponseResponse(response.responseData);
         OnSuccessGetObjects.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetObjects.Unbind();
 }
 
 /** Sets objects on an entity's profile. */
@@ -417,9 +384,7 @@ UPlayFabDataAPI* UPlayFabDataAPI::SetObjects(FDataSetObjectsRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabDataAPI* manager = NewObject<UPlayFabDataAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabDataAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabDataAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -433,18 +398,15 @@ UPlayFabDataAPI* UPlayFabDataAPI::SetObjects(FDataSetObjectsRequest request,
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    OutRestJsonObj->SetNumberField(TEXT("ExpectedProfileVersion"), request.ExpectedProfileVersion);
-    if (request.Objects.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Objects"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Objects"), request.Objects);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteNumber(TEXT("ExpectedProfileVersion"), request.ExpectedProfileVersion);
+    RequestWriter.WriteObjectArray(TEXT("Objects"), request.Objects);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -462,13 +424,16 @@ void UPlayFabDataAPI::HelperSetObjects(FPlayFabBaseModel response, UObject* cust
         FDataSetObjectsResponse ResultStruct = UPlayFabDataModelDecoder::decodeSetObjectsResponseResponse(response.responseData);
         OnSuccessSetObjects.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetObjects.Unbind();
 }
 
 
 
 void UPlayFabDataAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
+    PlayFabCommon::FPlayFabCallCounters::EndCall(Request->GetURL());
+    PLAYFAB_TRACE_END(Wait, Request);
+
     // Be sure that we have no data from previous response
     ResetResponseData();
 
@@ -477,6 +442,14 @@ void UPlayFabDataAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpRes
         UE_LOG(LogPlayFab, Error, TEXT("The request object is invalid during OnProcessRequestComplete."));
         return;
     }
+
+    // The call is over however this returns; the result helpers run during the broadcast, before the proxy is cleared
+    // Only set up once the object is known to be valid, as an invalid one can't be trusted to go back to the pool
+    ON_SCOPE_EXIT
+    {
+        ReleaseToPool();
+    };
+
     if (!OnPlayFabResponse.IsBound())
     {
         UE_LOG(LogPlayFab, Error, TEXT("OnPlayFabResponse has come un-bound during OnProcessRequestComplete."));
@@ -496,20 +469,25 @@ void UPlayFabDataAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpRes
         myResponse.responseError.ErrorName = "Unable to contact server";
         myResponse.responseError.ErrorMessage = "Unable to contact server";
 
+        PLAYFAB_TRACE_SCOPE(Dispatch, Request);
         OnPlayFabResponse.Broadcast(myResponse, mCustomData, false);
 
         return;
     }
 
-    // Save response data as a string
-    ResponseContent = Response->GetContentAsString();
+    {
+        PLAYFAB_TRACE_SCOPE(Decode, Request);
 
-    // Save response code as int32
-    ResponseCode = Response->GetResponseCode();
+        // Save response data as a string
+        ResponseContent = Response->GetContentAsString();
 
-    // Try to deserialize data to JSON
-    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-    FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+        // Save response code as int32
+        ResponseCode = Response->GetResponseCode();
+
+        // Try to deserialize data to JSON
+        TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
+        FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+    }
 
     // Decide whether the request was successful
     bIsValidJsonResponse = bWasSuccessful && ResponseJsonObj->GetRootObject().IsValid();
@@ -519,7 +497,7 @@ void UPlayFabDataAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpRes
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
 
     // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
+    PlayFabCommon::FPlayFabRequestLog::LogResponse(Request, ResponseCode, Response->GetContent());
 
     myResponse.responseError.decodeError(ResponseJsonObj);
     myResponse.responseData = ResponseJsonObj;
@@ -534,8 +512,8 @@ void UPlayFabDataAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpRes
     }
 
     // Broadcast the result event
+    PLAYFAB_TRACE_SCOPE(Dispatch, Request);
     OnPlayFabResponse.Broadcast(myResponse, mCustomData, !myResponse.responseError.hasError);
-    pfSettings->ModifyPendingCallCount(-1);
 }
 
 void UPlayFabDataAPI::Activate()
@@ -593,24 +571,55 @@ void UPlayFabDataAPI::Activate()
     for (TMap<FString, FString>::TConstIterator It(RequestHeaders); It; ++It)
         HttpRequest->SetHeader(It.Key(), It.Value());
 
-    // Serialize data to json string
-    FString OutputString;
-    TSharedRef< TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    // Requests made by the generated functions are already serialized; one set with SetRequestObject is serialized here
+    if (RequestJsonObj != nullptr && RequestBody.Num() == 0)
+    {
+        PLAYFAB_TRACE_SCOPE(Serialize, HttpRequest);
+        FMemoryWriter BodyStream(RequestBody);
+        PlayFab::JsonUtf8Writer Writer = TJsonWriterFactory<TCHAR, PlayFab::FPlayFabCondensedUtf8PrintPolicy>::Create(&BodyStream);
+        FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    }
 
     // Set Json content
-    HttpRequest->SetContentAsString(OutputString);
+    HttpRequest->SetContent(RequestBody);
 
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
+    PlayFabCommon::FPlayFabRequestLog::LogRequest(HttpRequest, RequestBody);
 
     // Bind event
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabDataAPI::OnProcessRequestComplete);
 
     // Execute the request
-    pfSettings->ModifyPendingCallCount(1);
+    PlayFabCommon::FPlayFabCallCounters::BeginCall(RequestUrl);
+    PLAYFAB_TRACE_BEGIN(Wait, HttpRequest);
+    PLAYFAB_TRACE_SCOPE(Send, HttpRequest);
     HttpRequest->ProcessRequest();
 }
 
+void UPlayFabDataAPI::ReleaseToPool()
+{
+    // Clear everything the next call through this proxy would otherwise inherit
+    OnPlayFabResponse.Clear();
+    OnFailure.Unbind();
+    mCustomData = nullptr;
+    CallAuthenticationContext = nullptr;
+    PlayFabRequestURL.Reset();
+    useEntityToken = false;
+    useSecretKey = false;
+    useSessionTicket = false;
+    returnsSessionTicket = false;
+    returnsEntityToken = false;
+    RequestHeaders.Reset();
+    ResponseContent.Reset();
+    ResponseCode = 0;
+    bIsValidJsonResponse = false;
+
+    // The request object is the caller's, or was handed to the caller with the result, so it isn't recycled
+    RequestBody.Reset();
+    RequestJsonObj = nullptr;
+    // The response object is kept with the proxy, and cleared when its next response arrives
+    FPlayFabObjectPool::Release(this);
+}
+
 void UPlayFabDataAPI::ResetResponseData()
 {
     if (ResponseJsonObj != nullptr)
@@ -16,6 +16,12 @@
 #include "PlayFabEnums.h"
 #include "PlayFabCommon/Public/PlayFabAuthenticationContext.h"
 #include "PlayFabCommon/Public/PlayFabCommonUtils.h"
+#include "PlayFabCommon/Public/PlayFabCallCounters.h"
+#include "PlayFabCommon/Public/PlayFabTrace.h"
+#include "PlayFabCommon/Public/PlayFabRequestLog.h"
+#include "PlayFabObjectPool.h"
+#include "PlayFabRequestWriter.h"
+#include "Misc/ScopeExit.h"
 
 UPlayFabExperimentationAPI::UPlayFabExperimentationAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -30,7 +36,26 @@ void UPlayFabExperimentationAPI::SetCallAuthenticationContext(UPlayFabAuthentica
 
 void UPlayFabExperimentationAPI::SetRequestObject(UPlayFabJsonObject* JsonObject)
 {
+    // The object replaces any body serialized before, and is serialized in Activate
     RequestJsonObj = JsonObject;
+    RequestBody.Reset();
+}
+
+void UPlayFabExperimentationAPI::SetRequestBody(TArray<uint8>&& Body)
+{
+    RequestBody = MoveTemp(Body);
+    RequestJsonObj = nullptr;
+}
+
+UPlayFabJsonObject* UPlayFabExperimentationAPI::GetRequestObject()
+{
+    if (RequestJsonObj == nullptr && RequestBody.Num() > 0)
+    {
+        // Only the few results that hand the request back to Blueprint pay for parsing it
+        RequestJsonObj = NewObject<UPlayFabJsonObject>();
+        RequestJsonObj->DecodeJson(FPlayFabRequestWriter::ToString(RequestBody));
+    }
+    return RequestJsonObj;
 }
 
 UPlayFabJsonObject* UPlayFabExperimentationAPI::GetResponseObject()
@@ -40,31 +65,7 @@ UPlayFabJsonObject* UPlayFabExperimentationAPI::GetResponseObject()
 
 FString UPlayFabExperimentationAPI::PercentEncode(const FString& Text)
 {
-    FString OutText = Text;
-
-    OutText = OutText.Replace(TEXT("!"), TEXT("%21"));
-    OutText = OutText.Replace(TEXT("\""), TEXT("%22"));
-    OutText = OutText.Replace(TEXT("#"), TEXT("%23"));
-    OutText = OutText.Replace(TEXT("$"), TEXT("%24"));
-    //OutText = OutText.Replace(TEXT("&"), TEXT("%26"));
-    OutText = OutText.Replace(TEXT("'"), TEXT("%27"));
-    OutText = OutText.Replace(TEXT("("), TEXT("%28"));
-    OutText = OutText.Replace(TEXT(")"), TEXT("%29"));
-    OutText = OutText.Replace(TEXT("*"), TEXT("%2A"));
-    OutText = OutText.Replace(TEXT("+"), TEXT("%2B"));
-    OutText = OutText.Replace(TEXT(","), TEXT("%2C"));
-    //OutText = OutText.Replace(TEXT("/"), TEXT("%2F"));
-    OutText = OutText.Replace(TEXT(":"), TEXT("%3A"));
-    OutText = OutText.Replace(TEXT(";"), TEXT("%3B"));
-    OutText = OutText.Replace(TEXT("="), TEXT("%3D"));
-    //OutText = OutText.Replace(TEXT("?"), TEXT("%3F"));
-    OutText = OutText.Replace(TEXT("@"), TEXT("%40"));
-    OutText = OutText.Replace(TEXT("["), TEXT("%5B"));
-    OutText = OutText.Replace(TEXT("]"), TEXT("%5D"));
-    OutText = OutText.Replace(TEXT("{"), TEXT("%7B"));
-    OutText = OutText.Replace(TEXT("}"), TEXT("%7D"));
-
-    return OutText;
+    return PlayFabCommon::PlayFabCommonUtils::PercentEncode(Text);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -82,9 +83,7 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::CreateExclusionGroup(FEx
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabExperimentationAPI* manager = NewObject<UPlayFabExperimentationAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabExperimentationAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabExperimentationAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -98,21 +97,14 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::CreateExclusionGroup(FEx
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Description.IsEmpty() || request.Description == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Description"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Description"), request.Description);
-    }
-    if (request.Name.IsEmpty() || request.Name == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Name"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Name"), request.Name);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Description"), request.Description);
+    RequestWriter.WriteStringOrNull(TEXT("Name"), request.Name);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -130,7 +122,7 @@ void UPlayFabExperimentationAPI::HelperCreateExclusionGroup(FPlayFabBaseModel re
         FExperimentationCreateExclusionGroupResult ResultStruct = UPlayFabExperimentationModelDecoder::decodeCreateExclusionGroupResultResponse(response.responseData);
         OnSuccessCreateExclusionGroup.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateExclusionGroup.Unbind();
 }
 
 /** Creates a new experiment for a title. */
@@ -140,9 +132,7 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::CreateExperiment(FExperi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabExperimentationAPI* manager = NewObject<UPlayFabExperimentationAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabExperimentationAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabExperimentationAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -156,58 +146,24 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::CreateExperiment(FExperi
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Description.IsEmpty() || request.Description == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Description"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Description"), request.Description);
-    }
-    if (request.EndDate.IsEmpty() || request.EndDate == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EndDate"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EndDate"), request.EndDate);
-    }
-    if (request.ExclusionGroupId.IsEmpty() || request.ExclusionGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ExclusionGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ExclusionGroupId"), request.ExclusionGroupId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("ExclusionGroupTrafficAllocation"), request.ExclusionGroupTrafficAllocation);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Description"), request.Description);
+    RequestWriter.WriteStringOrNull(TEXT("EndDate"), request.EndDate);
+    RequestWriter.WriteStringOrNull(TEXT("ExclusionGroupId"), request.ExclusionGroupId);
+    RequestWriter.WriteNumber(TEXT("ExclusionGroupTrafficAllocation"), request.ExclusionGroupTrafficAllocation);
     FString temp_ExperimentType;
     if (GetEnumValueToString<EExperimentType>(TEXT("EExperimentType"), request.ExperimentType, temp_ExperimentType))
-        OutRestJsonObj->SetStringField(TEXT("ExperimentType"), temp_ExperimentType);
-    if (request.Name.IsEmpty() || request.Name == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Name"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Name"), request.Name);
-    }
-    if (request.SegmentId.IsEmpty() || request.SegmentId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SegmentId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SegmentId"), request.SegmentId);
-    }
-    if (request.StartDate.IsEmpty() || request.StartDate == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StartDate"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StartDate"), request.StartDate);
-    }
-    // Check to see if string is empty
-    if (request.TitlePlayerAccountTestIds.IsEmpty() || request.TitlePlayerAccountTestIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TitlePlayerAccountTestIds"));
-    } else {
-        TArray<FString> TitlePlayerAccountTestIdsArray;
-        FString(request.TitlePlayerAccountTestIds).ParseIntoArray(TitlePlayerAccountTestIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("TitlePlayerAccountTestIds"), TitlePlayerAccountTestIdsArray);
-    }
-    if (request.Variants.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Variants"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Variants"), request.Variants);
-    }
+        RequestWriter.WriteString(TEXT("ExperimentType"), temp_ExperimentType);
+    RequestWriter.WriteStringOrNull(TEXT("Name"), request.Name);
+    RequestWriter.WriteStringOrNull(TEXT("SegmentId"), request.SegmentId);
+    RequestWriter.WriteStringOrNull(TEXT("StartDate"), request.StartDate);
+    RequestWriter.WriteStringArray(TEXT("TitlePlayerAccountTestIds"), request.TitlePlayerAccountTestIds);
+    RequestWriter.WriteObjectArray(TEXT("Variants"), request.Variants);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -225,7 +181,7 @@ void UPlayFabExperimentationAPI::HelperCreateExperiment(FPlayFabBaseModel respon
         FExperimentationCreateExperimentResult ResultStruct = UPlayFabExperimentationModelDecoder::decodeCreateExperimentResultResponse(response.responseData);
         OnSuccessCreateExperiment.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateExperiment.Unbind();
 }
 
 /** Deletes an existing exclusion group for a title. */
@@ -235,9 +191,7 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::DeleteExclusionGroup(FEx
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabExperimentationAPI* manager = NewObject<UPlayFabExperimentationAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabExperimentationAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabExperimentationAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -251,16 +205,13 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::DeleteExclusionGroup(FEx
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ExclusionGroupId.IsEmpty() || request.ExclusionGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ExclusionGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ExclusionGroupId"), request.ExclusionGroupId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ExclusionGroupId"), request.ExclusionGroupId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -278,7 +229,7 @@ void UPlayFabExperimentationAPI::HelperDeleteExclusionGroup(FPlayFabBaseModel re
         FExperimentationEmptyResponse ResultStruct = UPlayFabExperimentationModelDecoder::decodeEmptyResponseResponse(response.responseData);
         OnSuccessDeleteExclusionGroup.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteExclusionGroup.Unbind();
 }
 
 /** Deletes an existing experiment for a title. */
@@ -288,9 +239,7 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::DeleteExperiment(FExperi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabExperimentationAPI* manager = NewObject<UPlayFabExperimentationAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabExperimentationAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabExperimentationAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -304,16 +253,13 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::DeleteExperiment(FExperi
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ExperimentId.IsEmpty() || request.ExperimentId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ExperimentId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ExperimentId"), request.ExperimentId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ExperimentId"), request.ExperimentId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -329,10 +275,10 @@ void UPlayFabExperimentationAPI::HelperDeleteExperiment(FPlayFabBaseModel respon
     else if (!error.hasError && OnSuccessDeleteExperiment.IsBound())
     {
         FExperimentationEmptyResponse ResultStruct = UPlayFabExperimentationModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessDeleteExperiment.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteExperiment.Unbind();
 }
 
 /** Gets the details of all exclusion groups for a title. */
@@ -342,9 +288,7 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::GetExclusionGroups(FExpe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabExperimentationAPI* manager = NewObject<UPlayFabExperimentationAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabExperimentationAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabExperimentationAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -358,11 +302,12 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::GetExclusionGroups(FExpe
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -380,7 +325,7 @@ void UPlayFabExperimentationAPI::HelperGetExclusionGroups(FPlayFabBaseModel resp
         FExperimentationGetExclusionGroupsResult ResultStruct = UPlayFabExperimentationModelDecoder::decodeGetExclusionGroupsResultResponse(response.responseData);
         OnSuccessGetExclusionGroups.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetExclusionGroups.Unbind();
 }
 
 /** Gets the details of all exclusion groups for a title. */
@@ -390,9 +335,7 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::GetExclusionGroupTraffic
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabExperimentationAPI* manager = NewObject<UPlayFabExperimentationAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabExperimentationAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabExperimentationAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -406,16 +349,13 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::GetExclusionGroupTraffic
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ExclusionGroupId.IsEmpty() || request.ExclusionGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ExclusionGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ExclusionGroupId"), request.ExclusionGroupId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ExclusionGroupId"), request.ExclusionGroupId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -433,7 +373,7 @@ void UPlayFabExperimentationAPI::HelperGetExclusionGroupTraffic(FPlayFabBaseMode
         FExperimentationGetExclusionGroupTrafficResult ResultStruct = UPlayFabExperimentationModelDecoder::decodeGetExclusionGroupTrafficResultResponse(response.responseData);
         OnSuccessGetExclusionGroupTraffic.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetExclusionGroupTraffic.Unbind();
 }
 
 /** Gets the details of all experiments for a title. */
@@ -443,9 +383,7 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::GetExperiments(FExperime
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabExperimentationAPI* manager = NewObject<UPlayFabExperimentationAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabExperimentationAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabExperimentationAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -459,11 +397,12 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::GetExperiments(FExperime
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -481,7 +420,7 @@ void UPlayFabExperimentationAPI::HelperGetExperiments(FPlayFabBaseModel response
         FExperimentationGetExperimentsResult ResultStruct = UPlayFabExperimentationModelDecoder::decodeGetExperimentsResultResponse(response.responseData);
         OnSuccessGetExperiments.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetExperiments.Unbind();
 }
 
 /** Gets the latest scorecard of the experiment for the title. */
@@ -491,9 +430,7 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::GetLatestScorecard(FExpe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabExperimentationAPI* manager = NewObject<UPlayFabExperimentationAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabExperimentationAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabExperimentationAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -507,16 +444,13 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::GetLatestScorecard(FExpe
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ExperimentId.IsEmpty() || request.ExperimentId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ExperimentId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ExperimentId"), request.ExperimentId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ExperimentId"), request.ExperimentId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -534,7 +468,7 @@ void UPlayFabExperimentationAPI::HelperGetLatestScorecard(FPlayFabBaseModel resp
         FExperimentationGetLatestScorecardResult ResultStruct = UPlayFabExperimentationModelDecoder::decodeGetLatestScorecardResultResponse(response.responseData);
         OnSuccessGetLatestScorecard.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetLatestScorecard.Unbind();
 }
 
 /** Gets the treatment assignments for a player for every running experiment in the title. */
@@ -544,9 +478,7 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::GetTreatmentAssignment(F
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabExperimentationAPI* manager = NewObject<UPlayFabExperimentationAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabExperimentationAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabExperimentationAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -560,12 +492,13 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::GetTreatmentAssignment(F
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -583,7 +516,7 @@ void UPlayFabExperimentationAPI::HelperGetTreatmentAssignment(FPlayFabBaseModel
         FExperimentationGetTreatmentAssignmentResult ResultStruct = UPlayFabExperimentationModelDecoder::decodeGetTreatmentAssignmentResultResponse(response.responseData);
         OnSuccessGetTreatmentAssignment.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetTreatmentAssignment.Unbind();
 }
 
 /** Starts an existing experiment for a title. */
@@ -593,9 +526,7 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::StartExperiment(FExperim
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabExperimentationAPI* manager = NewObject<UPlayFabExperimentationAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabExperimentationAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabExperimentationAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -609,16 +540,13 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::StartExperiment(FExperim
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ExperimentId.IsEmpty() || request.ExperimentId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ExperimentId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ExperimentId"), request.ExperimentId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ExperimentId"), request.ExperimentId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -634,10 +562,10 @@ void UPlayFabExperimentationAPI::HelperStartExperiment(FPlayFabBaseModel respons
     else if (!error.hasError && OnSuccessStartExperiment.IsBound())
     {
         FExperimentationEmptyResponse ResultStruct = UPlayFabExperimentationModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessStartExperiment.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessStartExperiment.Unbind();
 }
 
 /** Stops an existing experiment for a title. */
@@ -647,9 +575,7 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::StopExperiment(FExperime
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabExperimentationAPI* manager = NewObject<UPlayFabExperimentationAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabExperimentationAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabExperimentationAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -663,16 +589,13 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::StopExperiment(FExperime
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ExperimentId.IsEmpty() || request.ExperimentId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ExperimentId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ExperimentId"), request.ExperimentId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ExperimentId"), request.ExperimentId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -688,10 +611,10 @@ void UPlayFabExperimentationAPI::HelperStopExperiment(FPlayFabBaseModel response
     else if (!error.hasError && OnSuccessStopExperiment.IsBound())
     {
         FExperimentationEmptyResponse ResultStruct = UPlayFabExperimentationModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessStopExperiment.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessStopExperiment.Unbind();
 }
 
 /** Updates an existing exclusion group for a title. */
@@ -701,9 +624,7 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::UpdateExclusionGroup(FEx
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabExperimentationAPI* manager = NewObject<UPlayFabExperimentationAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabExperimentationAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabExperimentationAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -717,26 +638,15 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::UpdateExclusionGroup(FEx
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Description.IsEmpty() || request.Description == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Description"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Description"), request.Description);
-    }
-    if (request.ExclusionGroupId.IsEmpty() || request.ExclusionGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ExclusionGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ExclusionGroupId"), request.ExclusionGroupId);
-    }
-    if (request.Name.IsEmpty() || request.Name == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Name"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Name"), request.Name);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Description"), request.Description);
+    RequestWriter.WriteStringOrNull(TEXT("ExclusionGroupId"), request.ExclusionGroupId);
+    RequestWriter.WriteStringOrNull(TEXT("Name"), request.Name);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -752,10 +662,10 @@ void UPlayFabExperimentationAPI::HelperUpdateExclusionGroup(FPlayFabBaseModel re
     else if (!error.hasError && OnSuccessUpdateExclusionGroup.IsBound())
     {
         FExperimentationEmptyResponse ResultStruct = UPlayFabExperimentationModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateExclusionGroup.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateExclusionGroup.Unbind();
 }
 
 /** Updates an existing experiment for a title. */
@@ -765,9 +675,7 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::UpdateExperiment(FExperi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabExperimentationAPI* manager = NewObject<UPlayFabExperimentationAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabExperimentationAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabExperimentationAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -781,63 +689,25 @@ UPlayFabExperimentationAPI* UPlayFabExperimentationAPI::UpdateExperiment(FExperi
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Description.IsEmpty() || request.Description == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Description"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Description"), request.Description);
-    }
-    if (request.EndDate.IsEmpty() || request.EndDate == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EndDate"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EndDate"), request.EndDate);
-    }
-    if (request.ExclusionGroupId.IsEmpty() || request.ExclusionGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ExclusionGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ExclusionGroupId"), request.ExclusionGroupId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("ExclusionGroupTrafficAllocation"), request.ExclusionGroupTrafficAllocation);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Description"), request.Description);
+    RequestWriter.WriteStringOrNull(TEXT("EndDate"), request.EndDate);
+    RequestWriter.WriteStringOrNull(TEXT("ExclusionGroupId"), request.ExclusionGroupId);
+    RequestWriter.WriteNumber(TEXT("ExclusionGroupTrafficAllocation"), request.ExclusionGroupTrafficAllocation);
     FString temp_ExperimentType;
     if (GetEnumValueToString<EExperimentType>(TEXT("EExperimentType"), request.ExperimentType, temp_ExperimentType))
-        OutRestJsonObj->SetStringField(TEXT("ExperimentType"), temp_ExperimentType);
-    if (request.Id.IsEmpty() || request.Id == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Id"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Id"), request.Id);
-    }
-    if (request.Name.IsEmpty() || request.Name == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Name"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Name"), request.Name);
-    }
-    if (request.SegmentId.IsEmpty() || request.SegmentId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SegmentId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SegmentId"), request.SegmentId);
-    }
-    if (request.StartDate.IsEmpty() || request.StartDate == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StartDate"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StartDate"), request.StartDate);
-    }
-    // Check to see if string is empty
-    if (request.TitlePlayerAccountTestIds.IsEmpty() || request.TitlePlayerAccountTestIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TitlePlayerAccountTestIds"));
-    } else {
-        TArray<FString> TitlePlayerAccountTestIdsArray;
-        FString(request.TitlePlayerAccountTestIds).ParseIntoArray(TitlePlayerAccountTestIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("TitlePlayerAccountTestIds"), TitlePlayerAccountTestIdsArray);
-    }
-    if (request.Variants.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Variants"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Variants"), request.Variants);
-    }
+        RequestWriter.WriteString(TEXT("ExperimentType"), temp_ExperimentType);
+    RequestWriter.WriteStringOrNull(TEXT("Id"), request.Id);
+    RequestWriter.WriteStringOrNull(TEXT("Name"), request.Name);
+    RequestWriter.WriteStringOrNull(TEXT("SegmentId"), request.SegmentId);
+    RequestWriter.WriteStringOrNull(TEXT("StartDate"), request.StartDate);
+    RequestWriter.WriteStringArray(TEXT("TitlePlayerAccountTestIds"), request.TitlePlayerAccountTestIds);
+    RequestWriter.WriteObjectArray(TEXT("Variants"), request.Variants);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -853,16 +723,19 @@ void UPlayFabExperimentationAPI::HelperUpdateExperiment(FPlayFabBaseModel respon
     else if (!error.hasError && OnSuccessUpdateExperiment.IsBound())
     {
         FExperimentationEmptyResponse ResultStruct = UPlayFabExperimentationModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateExperiment.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateExperiment.Unbind();
 }
 
 
 
 void UPlayFabExperimentationAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
+    PlayFabCommon::FPlayFabCallCounters::EndCall(Request->GetURL());
+    PLAYFAB_TRACE_END(Wait, Request);
+
     // Be sure that we have no data from previous response
     ResetResponseData();
 
@@ -871,6 +744,14 @@ void UPlayFabExperimentationAPI::OnProcessRequestComplete(FHttpRequestPtr Reques
         UE_LOG(LogPlayFab, Error, TEXT("The request object is invalid during OnProcessRequestComplete."));
         return;
     }
+
+    // The call is over however this returns; the result helpers run during the broadcast, before the proxy is cleared
+    // Only set up once the object is known to be valid, as an invalid one can't be trusted to go back to the pool
+    ON_SCOPE_EXIT
+    {
+        ReleaseToPool();
+    };
+
     if (!OnPlayFabResponse.IsBound())
     {
         UE_LOG(LogPlayFab, Error, TEXT("OnPlayFabResponse has come un-bound during OnProcessRequestComplete."));
@@ -890,20 +771,25 @@ void UPlayFabExperimentationAPI::OnProcessRequestComplete(FHttpRequestPtr Reques
         myResponse.responseError.ErrorName = "Unable to contact server";
         myResponse.responseError.ErrorMessage = "Unable to contact server";
 
+        PLAYFAB_TRACE_SCOPE(Dispatch, Request);
         OnPlayFabResponse.Broadcast(myResponse, mCustomData, false);
 
         return;
     }
 
-    // Save response data as a string
-    ResponseContent = Response->GetContentAsString();
+    {
+        PLAYFAB_TRACE_SCOPE(Decode, Request);
 
-    // Save response code as int32
-    ResponseCode = Response->GetResponseCode();
+        // Save response data as a string
+        ResponseContent = Response->GetContentAsString();
 
-    // Try to deserialize data to JSON
-    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-    FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+        // Save response code as int32
+        ResponseCode = Response->GetResponseCode();
+
+        // Try to deserialize data to JSON
+        TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
+        FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+    }
 
     // Decide whether the request was successful
     bIsValidJsonResponse = bWasSuccessful && ResponseJsonObj->GetRootObject().IsValid();
@@ -913,7 +799,7 @@ void UPlayFabExperimentationAPI::OnProcessRequestComplete(FHttpRequestPtr Reques
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
 
     // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
+    PlayFabCommon::FPlayFabRequestLog::LogResponse(Request, ResponseCode, Response->GetContent());
 
     myResponse.responseError.decodeError(ResponseJsonObj);
     myResponse.responseData = ResponseJsonObj;
@@ -928,8 +814,8 @@ void UPlayFabExperimentationAPI::OnProcessRequestComplete(FHttpRequestPtr Reques
     }
 
     // Broadcast the result event
+    PLAYFAB_TRACE_SCOPE(Dispatch, Request);
     OnPlayFabResponse.Broadcast(myResponse, mCustomData, !myResponse.responseError.hasError);
-    pfSettings->ModifyPendingCallCount(-1);
 }
 
 void UPlayFabExperimentationAPI::Activate()
@@ -987,24 +873,55 @@ void UPlayFabExperimentationAPI::Activate()
     for (TMap<FString, FString>::TConstIterator It(RequestHeaders); It; ++It)
         HttpRequest->SetHeader(It.Key(), It.Value());
 
-    // Serialize data to json string
-    FString OutputString;
-    TSharedRef< TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    // Requests made by the generated functions are already serialized; one set with SetRequestObject is serialized here
+    if (RequestJsonObj != nullptr && RequestBody.Num() == 0)
+    {
+        PLAYFAB_TRACE_SCOPE(Serialize, HttpRequest);
+        FMemoryWriter BodyStream(RequestBody);
+        PlayFab::JsonUtf8Writer Writer = TJsonWriterFactory<TCHAR, PlayFab::FPlayFabCondensedUtf8PrintPolicy>::Create(&BodyStream);
+        FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    }
 
     // Set Json content
-    HttpRequest->SetContentAsString(OutputString);
+    HttpRequest->SetContent(RequestBody);
 
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
+    PlayFabCommon::FPlayFabRequestLog::LogRequest(HttpRequest, RequestBody);
 
     // Bind event
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabExperimentationAPI::OnProcessRequestComplete);
 
     // Execute the request
-    pfSettings->ModifyPendingCallCount(1);
+    PlayFabCommon::FPlayFabCallCounters::BeginCall(RequestUrl);
+    PLAYFAB_TRACE_BEGIN(Wait, HttpRequest);
+    PLAYFAB_TRACE_SCOPE(Send, HttpRequest);
     HttpRequest->ProcessRequest();
 }
 
+void UPlayFabExperimentationAPI::ReleaseToPool()
+{
+    // Clear everything the next call through this proxy would otherwise inherit
+    OnPlayFabResponse.Clear();
+    OnFailure.Unbind();
+    mCustomData = nullptr;
+    CallAuthenticationContext = nullptr;
+    PlayFabRequestURL.Reset();
+    useEntityToken = false;
+    useSecretKey = false;
+    useSessionTicket = false;
+    returnsSessionTicket = false;
+    returnsEntityToken = false;
+    RequestHeaders.Reset();
+    ResponseContent.Reset();
+    ResponseCode = 0;
+    bIsValidJsonResponse = false;
+
+    // The request object is the caller's, or was handed to the caller with the result, so it isn't recycled
+    RequestBody.Reset();
+    RequestJsonObj = nullptr;
+    // The response object is kept with the proxy, and cleared when its next response arrives
+    FPlayFabObjectPool::Release(this);
+}
+
 void UPlayFabExperimentationAPI::ResetResponseData()
 {
     if (ResponseJsonObj != nullptr)
@@ -16,6 +16,12 @@
 #include "PlayFabEnums.h"
 #include "PlayFabCommon/Public/PlayFabAuthenticationContext.h"
 #include "PlayFabCommon/Public/PlayFabCommonUtils.h"
+#include "PlayFabCommon/Public/PlayFabCallCounters.h"
+#include "PlayFabCommon/Public/PlayFabTrace.h"
+#include "PlayFabCommon/Public/PlayFabRequestLog.h"
+#include "PlayFabObjectPool.h"
+#include "PlayFabRequestWriter.h"
+#include "Misc/ScopeExit.h"
 
 UPlayFabInsightsAPI::UPlayFabInsightsAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -30,7 +36,26 @@ void UPlayFabInsightsAPI::SetCallAuthenticationContext(UPlayFabAuthenticationCon
 
 void UPlayFabInsightsAPI::SetRequestObject(UPlayFabJsonObject* JsonObject)
 {
+    // The object replaces any body serialized before, and is serialized in Activate
     RequestJsonObj = JsonObject;
+    RequestBody.Reset();
+}
+
+void UPlayFabInsightsAPI::SetRequestBody(TArray<uint8>&& Body)
+{
+    RequestBody = MoveTemp(Body);
+    RequestJsonObj = nullptr;
+}
+
+UPlayFabJsonObject* UPlayFabInsightsAPI::GetRequestObject()
+{
+    if (RequestJsonObj == nullptr && RequestBody.Num() > 0)
+    {
+        // Only the few results that hand the request back to Blueprint pay for parsing it
+        RequestJsonObj = NewObject<UPlayFabJsonObject>();
+        RequestJsonObj->DecodeJson(FPlayFabRequestWriter::ToString(RequestBody));
+    }
+    return RequestJsonObj;
 }
 
 UPlayFabJsonObject* UPlayFabInsightsAPI::GetResponseObject()
@@ -40,31 +65,7 @@ UPlayFabJsonObject* UPlayFabInsightsAPI::GetResponseObject()
 
 FString UPlayFabInsightsAPI::PercentEncode(const FString& Text)
 {
-    FString OutText = Text;
-
-    OutText = OutText.Replace(TEXT("!"), TEXT("%21"));
-    OutText = OutText.Replace(TEXT("\""), TEXT("%22"));
-    OutText = OutText.Replace(TEXT("#"), TEXT("%23"));
-    OutText = OutText.Replace(TEXT("$"), TEXT("%24"));
-    //OutText = OutText.Replace(TEXT("&"), TEXT("%26"));
-    OutText = OutText.Replace(TEXT("'"), TEXT("%27"));
-    OutText = OutText.Replace(TEXT("("), TEXT("%28"));
-    OutText = OutText.Replace(TEXT(")"), TEXT("%29"));
-    OutText = OutText.Replace(TEXT("*"), TEXT("%2A"));
-    OutText = OutText.Replace(TEXT("+"), TEXT("%2B"));
-    OutText = OutText.Replace(TEXT(","), TEXT("%2C"));
-    //OutText = OutText.Replace(TEXT("/"), TEXT("%2F"));
-    OutText = OutText.Replace(TEXT(":"), TEXT("%3A"));
-    OutText = OutText.Replace(TEXT(";"), TEXT("%3B"));
-    OutText = OutText.Replace(TEXT("="), TEXT("%3D"));
-    //OutText = OutText.Replace(TEXT("?"), TEXT("%3F"));
-    OutText = OutText.Replace(TEXT("@"), TEXT("%40"));
-    OutText = OutText.Replace(TEXT("["), TEXT("%5B"));
-    OutText = OutText.Replace(TEXT("]"), TEXT("%5D"));
-    OutText = OutText.Replace(TEXT("{"), TEXT("%7B"));
-    OutText = OutText.Replace(TEXT("}"), TEXT("%7D"));
-
-    return OutText;
+    return PlayFabCommon::PlayFabCommonUtils::PercentEncode(Text);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -82,9 +83,7 @@ UPlayFabInsightsAPI* UPlayFabInsightsAPI::GetDetails(FInsightsInsightsEmptyReque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabInsightsAPI* manager = NewObject<UPlayFabInsightsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabInsightsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabInsightsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -98,11 +97,12 @@ UPlayFabInsightsAPI* UPlayFabInsightsAPI::GetDetails(FInsightsInsightsEmptyReque
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -120,7 +120,7 @@ void UPlayFabInsightsAPI::HelperGetDetails(FPlayFabBaseModel response, UObject*
         FInsightsInsightsGetDetailsResponse ResultStruct = UPlayFabInsightsModelDecoder::decodeInsightsGetDetailsResponseResponse(response.responseData);
         OnSuccessGetDetails.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetDetails.Unbind();
 }
 
 /** Retrieves the range of allowed values for performance and data storage retention values as well as the submeter details for each performance level. */
@@ -130,9 +130,7 @@ UPlayFabInsightsAPI* UPlayFabInsightsAPI::GetLimits(FInsightsInsightsEmptyReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabInsightsAPI* manager = NewObject<UPlayFabInsightsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabInsightsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabInsightsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -146,11 +144,12 @@ UPlayFabInsightsAPI* UPlayFabInsightsAPI::GetLimits(FInsightsInsightsEmptyReques
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -168,7 +167,7 @@ void UPlayFabInsightsAPI::HelperGetLimits(FPlayFabBaseModel response, UObject* c
         FInsightsInsightsGetLimitsResponse ResultStruct = UPlayFabInsightsModelDecoder::decodeInsightsGetLimitsResponseResponse(response.responseData);
         OnSuccessGetLimits.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetLimits.Unbind();
 }
 
 /** Gets the status of a SetPerformance or SetStorageRetention operation. */
@@ -178,9 +177,7 @@ UPlayFabInsightsAPI* UPlayFabInsightsAPI::GetOperationStatus(FInsightsInsightsGe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabInsightsAPI* manager = NewObject<UPlayFabInsightsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabInsightsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabInsightsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -194,16 +191,13 @@ UPlayFabInsightsAPI* UPlayFabInsightsAPI::GetOperationStatus(FInsightsInsightsGe
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.OperationId.IsEmpty() || request.OperationId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OperationId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OperationId"), request.OperationId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("OperationId"), request.OperationId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -221,7 +215,7 @@ void UPlayFabInsightsAPI::HelperGetOperationStatus(FPlayFabBaseModel response, U
         FInsightsInsightsGetOperationStatusResponse ResultStruct = UPlayFabInsightsModelDecoder::decodeInsightsGetOperationStatusResponseResponse(response.responseData);
         OnSuccessGetOperationStatus.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetOperationStatus.Unbind();
 }
 
 /** Gets a list of pending SetPerformance and/or SetStorageRetention operations for the title. */
@@ -231,9 +225,7 @@ UPlayFabInsightsAPI* UPlayFabInsightsAPI::GetPendingOperations(FInsightsInsights
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabInsightsAPI* manager = NewObject<UPlayFabInsightsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabInsightsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabInsightsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -247,16 +239,13 @@ UPlayFabInsightsAPI* UPlayFabInsightsAPI::GetPendingOperations(FInsightsInsights
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.OperationType.IsEmpty() || request.OperationType == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OperationType"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OperationType"), request.OperationType);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("OperationType"), request.OperationType);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -274,7 +263,7 @@ void UPlayFabInsightsAPI::HelperGetPendingOperations(FPlayFabBaseModel response,
         FInsightsInsightsGetPendingOperationsResponse ResultStruct = UPlayFabInsightsModelDecoder::decodeInsightsGetPendingOperationsResponseResponse(response.responseData);
         OnSuccessGetPendingOperations.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetPendingOperations.Unbind();
 }
 
 /** Sets the Insights performance level value for the title. */
@@ -284,9 +273,7 @@ UPlayFabInsightsAPI* UPlayFabInsightsAPI::SetPerformance(FInsightsInsightsSetPer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabInsightsAPI* manager = NewObject<UPlayFabInsightsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabInsightsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabInsightsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -300,12 +287,13 @@ UPlayFabInsightsAPI* UPlayFabInsightsAPI::SetPerformance(FInsightsInsightsSetPer
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("PerformanceLevel"), request.PerformanceLevel);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("PerformanceLevel"), request.PerformanceLevel);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -323,7 +311,7 @@ void UPlayFabInsightsAPI::HelperSetPerformance(FPlayFabBaseModel response, UObje
         FInsightsInsightsOperationResponse ResultStruct = UPlayFabInsightsModelDecoder::decodeInsightsOperationResponseResponse(response.responseData);
         OnSuccessSetPerformance.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetPerformance.Unbind();
 }
 
 /** Sets the Insights data storage retention days value for the title. */
@@ -333,9 +321,7 @@ UPlayFabInsightsAPI* UPlayFabInsightsAPI::SetStorageRetention(FInsightsInsightsS
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabInsightsAPI* manager = NewObject<UPlayFabInsightsAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabInsightsAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabInsightsAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -349,12 +335,13 @@ UPlayFabInsightsAPI* UPlayFabInsightsAPI::SetStorageRetention(FInsightsInsightsS
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("RetentionDays"), request.RetentionDays);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("RetentionDays"), request.RetentionDays);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -370,16 +357,19 @@ void UPlayFabInsightsAPI::HelperSetStorageRetention(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessSetStorageRetention.IsBound())
     {
         FInsightsInsightsOperationResponse ResultStruct = UPlayFabInsightsModelDecoder::decodeInsightsOperationResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessSetStorageRetention.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetStorageRetention.Unbind();
 }
 
 
 
 void UPlayFabInsightsAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
+    PlayFabCommon::FPlayFabCallCounters::EndCall(Request->GetURL());
+    PLAYFAB_TRACE_END(Wait, Request);
+
     // Be sure that we have no data from previous response
     ResetResponseData();
 
@@ -388,6 +378,14 @@ void UPlayFabInsightsAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHtt
         UE_LOG(LogPlayFab, Error, TEXT("The request object is invalid during OnProcessRequestComplete."));
         return;
     }
+
+    // The call is over however this returns; the result helpers run during the broadcast, before the proxy is cleared
+    // Only set up once the object is known to be valid, as an invalid one can't be trusted to go back to the pool
+    ON_SCOPE_EXIT
+    {
+        ReleaseToPool();
+    };
+
     if (!OnPlayFabResponse.IsBound())
     {
         UE_LOG(LogPlayFab, Error, TEXT("OnPlayFabResponse has come un-bound during OnProcessRequestComplete."));
@@ -407,20 +405,25 @@ void UPlayFabInsightsAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHtt
         myResponse.responseError.ErrorName = "Unable to contact server";
         myResponse.responseError.ErrorMessage = "Unable to contact server";
 
+        PLAYFAB_TRACE_SCOPE(Dispatch, Request);
         OnPlayFabResponse.Broadcast(myResponse, mCustomData, false);
 
         return;
     }
 
-    // Save response data as a string
-    ResponseContent = Response->GetContentAsString();
+    {
+        PLAYFAB_TRACE_SCOPE(Decode, Request);
+
+        // Save response data as a string
+        ResponseContent = Response->GetContentAsString();
 
-    // Save response code as int32
-    ResponseCode = Response->GetResponseCode();
+        // Save response code as int32
+        ResponseCode = Response->GetResponseCode();
 
-    // Try to deserialize data to JSON
-    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-    FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+        // Try to deserialize data to JSON
+        TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
+        FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+    }
 
     // Decide whether the request was successful
     bIsValidJsonResponse = bWasSuccessful && ResponseJsonObj->GetRootObject().IsValid();
@@ -430,7 +433,7 @@ void UPlayFabInsightsAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHtt
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
 
     // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
+    PlayFabCommon::FPlayFabRequestLog::LogResponse(Request, ResponseCode, Response->GetContent());
 
     myResponse.responseError.decodeError(ResponseJsonObj);
     myResponse.responseData = ResponseJsonObj;
@@ -445,8 +448,8 @@ void UPlayFabInsightsAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHtt
     }
 
     // Broadcast the result event
+    PLAYFAB_TRACE_SCOPE(Dispatch, Request);
     OnPlayFabResponse.Broadcast(myResponse, mCustomData, !myResponse.responseError.hasError);
-    pfSettings->ModifyPendingCallCount(-1);
 }
 
 void UPlayFabInsightsAPI::Activate()
@@ -504,24 +507,55 @@ void UPlayFabInsightsAPI::Activate()
     for (TMap<FString, FString>::TConstIterator It(RequestHeaders); It; ++It)
         HttpRequest->SetHeader(It.Key(), It.Value());
 
-    // Serialize data to json string
-    FString OutputString;
-    TSharedRef< TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    // Requests made by the generated functions are already serialized; one set with SetRequestObject is serialized here
+    if (RequestJsonObj != nullptr && RequestBody.Num() == 0)
+    {
+        PLAYFAB_TRACE_SCOPE(Serialize, HttpRequest);
+        FMemoryWriter BodyStream(RequestBody);
+        PlayFab::JsonUtf8Writer Writer = TJsonWriterFactory<TCHAR, PlayFab::FPlayFabCondensedUtf8PrintPolicy>::Create(&BodyStream);
+        FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    }
 
     // Set Json content
-    HttpRequest->SetContentAsString(OutputString);
+    HttpRequest->SetContent(RequestBody);
 
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
+    PlayFabCommon::FPlayFabRequestLog::LogRequest(HttpRequest, RequestBody);
 
     // Bind event
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabInsightsAPI::OnProcessRequestComplete);
 
     // Execute the request
-    pfSettings->ModifyPendingCallCount(1);
+    PlayFabCommon::FPlayFabCallCounters::BeginCall(RequestUrl);
+    PLAYFAB_TRACE_BEGIN(Wait, HttpRequest);
+    PLAYFAB_TRACE_SCOPE(Send, HttpRequest);
     HttpRequest->ProcessRequest();
 }
 
+void UPlayFabInsightsAPI::ReleaseToPool()
+{
+    // Clear everything the next call through this proxy would otherwise inherit
+    OnPlayFabResponse.Clear();
+    OnFailure.Unbind();
+    mCustomData = nullptr;
+    CallAuthenticationContext = nullptr;
+    PlayFabRequestURL.Reset();
+    useEntityToken = false;
+    useSecretKey = false;
+    useSessionTicket = false;
+    returnsSessionTicket = false;
+    returnsEntityToken = false;
+    RequestHeaders.Reset();
+    ResponseContent.Reset();
+    ResponseCode = 0;
+    bIsValidJsonResponse = false;
+
+    // The request object is the caller's, or was handed to the caller with the result, so it isn't recycled
+    RequestBody.Reset();
+    RequestJsonObj = nullptr;
+    // The response object is kept with the proxy, and cleared when its next response arrives
+    FPlayFabObjectPool::Release(this);
+}
+
 void UPlayFabInsightsAPI::ResetResponseData()
 {
     if (ResponseJsonObj != nullptr)
@@ -16,6 +16,12 @@
 #include "PlayFabEnums.h"
 #include "PlayFabCommon/Public/PlayFabAuthenticationContext.h"
 #include "PlayFabCommon/Public/PlayFabCommonUtils.h"
+#include "PlayFabCommon/Public/PlayFabCallCounters.h"
+#include "PlayFabCommon/Public/PlayFabTrace.h"
+#include "PlayFabCommon/Public/PlayFabRequestLog.h"
+#include "PlayFabObjectPool.h"
+#include "PlayFabRequestWriter.h"
+#include "Misc/ScopeExit.h"
 
 UPlayFabMultiplayerAPI::UPlayFabMultiplayerAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -30,7 +36,26 @@ void UPlayFabMultiplayerAPI::SetCallAuthenticationContext(UPlayFabAuthentication
 
 void UPlayFabMultiplayerAPI::SetRequestObject(UPlayFabJsonObject* JsonObject)
 {
+    // The object replaces any body serialized before, and is serialized in Activate
     RequestJsonObj = JsonObject;
+    RequestBody.Reset();
+}
+
+void UPlayFabMultiplayerAPI::SetRequestBody(TArray<uint8>&& Body)
+{
+    RequestBody = MoveTemp(Body);
+    RequestJsonObj = nullptr;
+}
+
+UPlayFabJsonObject* UPlayFabMultiplayerAPI::GetRequestObject()
+{
+    if (RequestJsonObj == nullptr && RequestBody.Num() > 0)
+    {
+        // Only the few results that hand the request back to Blueprint pay for parsing it
+        RequestJsonObj = NewObject<UPlayFabJsonObject>();
+        RequestJsonObj->DecodeJson(FPlayFabRequestWriter::ToString(RequestBody));
+    }
+    return RequestJsonObj;
 }
 
 UPlayFabJsonObject* UPlayFabMultiplayerAPI::GetResponseObject()
@@ -40,31 +65,7 @@ UPlayFabJsonObject* UPlayFabMultiplayerAPI::GetResponseObject()
 
 FString UPlayFabMultiplayerAPI::PercentEncode(const FString& Text)
 {
-    FString OutText = Text;
-
-    OutText = OutText.Replace(TEXT("!"), TEXT("%21"));
-    OutText = OutText.Replace(TEXT("\""), TEXT("%22"));
-    OutText = OutText.Replace(TEXT("#"), TEXT("%23"));
-    OutText = OutText.Replace(TEXT("$"), TEXT("%24"));
-    //OutText = OutText.Replace(TEXT("&"), TEXT("%26"));
-    OutText = OutText.Replace(TEXT("'"), TEXT("%27"));
-    OutText = OutText.Replace(TEXT("("), TEXT("%28"));
-    OutText = OutText.Replace(TEXT(")"), TEXT("%29"));
-    OutText = OutText.Replace(TEXT("*"), TEXT("%2A"));
-    OutText = OutText.Replace(TEXT("+"), TEXT("%2B"));
-    OutText = OutText.Replace(TEXT(","), TEXT("%2C"));
-    //OutText = OutText.Replace(TEXT("/"), TEXT("%2F"));
-    OutText = OutText.Replace(TEXT(":"), TEXT("%3A"));
-    OutText = OutText.Replace(TEXT(";"), TEXT("%3B"));
-    OutText = OutText.Replace(TEXT("="), TEXT("%3D"));
-    //OutText = OutText.Replace(TEXT("?"), TEXT("%3F"));
-    OutText = OutText.Replace(TEXT("@"), TEXT("%40"));
-    OutText = OutText.Replace(TEXT("["), TEXT("%5B"));
-    OutText = OutText.Replace(TEXT("]"), TEXT("%5D"));
-    OutText = OutText.Replace(TEXT("{"), TEXT("%7B"));
-    OutText = OutText.Replace(TEXT("}"), TEXT("%7D"));
-
-    return OutText;
+    return PlayFabCommon::PlayFabCommonUtils::PercentEncode(Text);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -82,9 +83,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CancelAllMatchmakingTicketsForPl
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -98,17 +97,14 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CancelAllMatchmakingTicketsForPl
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.QueueName.IsEmpty() || request.QueueName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("QueueName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("QueueName"), request.QueueName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteStringOrNull(TEXT("QueueName"), request.QueueName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -126,7 +122,7 @@ void UPlayFabMultiplayerAPI::HelperCancelAllMatchmakingTicketsForPlayer(FPlayFab
         FMultiplayerCancelAllMatchmakingTicketsForPlayerResult ResultStruct = UPlayFabMultiplayerModelDecoder::decodeCancelAllMatchmakingTicketsForPlayerResultResponse(response.responseData);
         OnSuccessCancelAllMatchmakingTicketsForPlayer.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCancelAllMatchmakingTicketsForPlayer.Unbind();
 }
 
 /** Cancel all active backfill tickets the player is a member of in a given queue. */
@@ -136,9 +132,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CancelAllServerBackfillTicketsFo
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -152,17 +146,14 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CancelAllServerBackfillTicketsFo
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.QueueName.IsEmpty() || request.QueueName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("QueueName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("QueueName"), request.QueueName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteStringOrNull(TEXT("QueueName"), request.QueueName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -180,7 +171,7 @@ void UPlayFabMultiplayerAPI::HelperCancelAllServerBackfillTicketsForPlayer(FPlay
         FMultiplayerCancelAllServerBackfillTicketsForPlayerResult ResultStruct = UPlayFabMultiplayerModelDecoder::decodeCancelAllServerBackfillTicketsForPlayerResultResponse(response.responseData);
         OnSuccessCancelAllServerBackfillTicketsForPlayer.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCancelAllServerBackfillTicketsForPlayer.Unbind();
 }
 
 /** Cancel a matchmaking ticket. */
@@ -190,9 +181,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CancelMatchmakingTicket(FMultipl
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -206,21 +195,14 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CancelMatchmakingTicket(FMultipl
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.QueueName.IsEmpty() || request.QueueName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("QueueName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("QueueName"), request.QueueName);
-    }
-    if (request.TicketId.IsEmpty() || request.TicketId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TicketId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TicketId"), request.TicketId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("QueueName"), request.QueueName);
+    RequestWriter.WriteStringOrNull(TEXT("TicketId"), request.TicketId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -238,7 +220,7 @@ void UPlayFabMultiplayerAPI::HelperCancelMatchmakingTicket(FPlayFabBaseModel res
         FMultiplayerCancelMatchmakingTicketResult ResultStruct = UPlayFabMultiplayerModelDecoder::decodeCancelMatchmakingTicketResultResponse(response.responseData);
         OnSuccessCancelMatchmakingTicket.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCancelMatchmakingTicket.Unbind();
 }
 
 /** Cancel a server backfill ticket. */
@@ -248,9 +230,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CancelServerBackfillTicket(FMult
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -264,21 +244,14 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CancelServerBackfillTicket(FMult
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.QueueName.IsEmpty() || request.QueueName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("QueueName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("QueueName"), request.QueueName);
-    }
-    if (request.TicketId.IsEmpty() || request.TicketId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TicketId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TicketId"), request.TicketId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("QueueName"), request.QueueName);
+    RequestWriter.WriteStringOrNull(TEXT("TicketId"), request.TicketId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -296,7 +269,7 @@ void UPlayFabMultiplayerAPI::HelperCancelServerBackfillTicket(FPlayFabBaseModel
         FMultiplayerCancelServerBackfillTicketResult ResultStruct = UPlayFabMultiplayerModelDecoder::decodeCancelServerBackfillTicketResultResponse(response.responseData);
         OnSuccessCancelServerBackfillTicket.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCancelServerBackfillTicket.Unbind();
 }
 
 /** Create a matchmaking ticket as a client. */
@@ -306,9 +279,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CreateMatchmakingTicket(FMultipl
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -322,23 +293,16 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CreateMatchmakingTicket(FMultipl
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.Creator != nullptr) OutRestJsonObj->SetObjectField(TEXT("Creator"), request.Creator);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("GiveUpAfterSeconds"), request.GiveUpAfterSeconds);
-    if (request.MembersToMatchWith.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("MembersToMatchWith"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("MembersToMatchWith"), request.MembersToMatchWith);
-    }
-    if (request.QueueName.IsEmpty() || request.QueueName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("QueueName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("QueueName"), request.QueueName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("Creator"), request.Creator);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("GiveUpAfterSeconds"), request.GiveUpAfterSeconds);
+    RequestWriter.WriteObjectArray(TEXT("MembersToMatchWith"), request.MembersToMatchWith);
+    RequestWriter.WriteStringOrNull(TEXT("QueueName"), request.QueueName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -356,7 +320,7 @@ void UPlayFabMultiplayerAPI::HelperCreateMatchmakingTicket(FPlayFabBaseModel res
         FMultiplayerCreateMatchmakingTicketResult ResultStruct = UPlayFabMultiplayerModelDecoder::decodeCreateMatchmakingTicketResultResponse(response.responseData);
         OnSuccessCreateMatchmakingTicket.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateMatchmakingTicket.Unbind();
 }
 
 /** Create a backfill matchmaking ticket as a server. A backfill ticket represents an ongoing game. The matchmaking service automatically starts matching the backfill ticket against other matchmaking tickets. Backfill tickets cannot match with other backfill tickets. */
@@ -366,9 +330,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CreateServerBackfillTicket(FMult
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -382,23 +344,16 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CreateServerBackfillTicket(FMult
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("GiveUpAfterSeconds"), request.GiveUpAfterSeconds);
-    if (request.Members.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Members"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Members"), request.Members);
-    }
-    if (request.QueueName.IsEmpty() || request.QueueName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("QueueName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("QueueName"), request.QueueName);
-    }
-    if (request.ServerDetails != nullptr) OutRestJsonObj->SetObjectField(TEXT("ServerDetails"), request.ServerDetails);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("GiveUpAfterSeconds"), request.GiveUpAfterSeconds);
+    RequestWriter.WriteObjectArray(TEXT("Members"), request.Members);
+    RequestWriter.WriteStringOrNull(TEXT("QueueName"), request.QueueName);
+    RequestWriter.WriteObject(TEXT("ServerDetails"), request.ServerDetails);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -416,7 +371,7 @@ void UPlayFabMultiplayerAPI::HelperCreateServerBackfillTicket(FPlayFabBaseModel
         FMultiplayerCreateServerBackfillTicketResult ResultStruct = UPlayFabMultiplayerModelDecoder::decodeCreateServerBackfillTicketResultResponse(response.responseData);
         OnSuccessCreateServerBackfillTicket.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateServerBackfillTicket.Unbind();
 }
 
 /** Create a matchmaking ticket as a server. The matchmaking service automatically starts matching the ticket against other matchmaking tickets. */
@@ -426,9 +381,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CreateServerMatchmakingTicket(FM
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -442,22 +395,15 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CreateServerMatchmakingTicket(FM
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("GiveUpAfterSeconds"), request.GiveUpAfterSeconds);
-    if (request.Members.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Members"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Members"), request.Members);
-    }
-    if (request.QueueName.IsEmpty() || request.QueueName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("QueueName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("QueueName"), request.QueueName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("GiveUpAfterSeconds"), request.GiveUpAfterSeconds);
+    RequestWriter.WriteObjectArray(TEXT("Members"), request.Members);
+    RequestWriter.WriteStringOrNull(TEXT("QueueName"), request.QueueName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -473,10 +419,10 @@ void UPlayFabMultiplayerAPI::HelperCreateServerMatchmakingTicket(FPlayFabBaseMod
     else if (!error.hasError && OnSuccessCreateServerMatchmakingTicket.IsBound())
     {
         FMultiplayerCreateMatchmakingTicketResult ResultStruct = UPlayFabMultiplayerModelDecoder::decodeCreateMatchmakingTicketResultResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessCreateServerMatchmakingTicket.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateServerMatchmakingTicket.Unbind();
 }
 
 /** Get a match. */
@@ -486,9 +432,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetMatch(FMultiplayerGetMatchReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -502,23 +446,16 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetMatch(FMultiplayerGetMatchReq
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("EscapeObject"), request.EscapeObject);
-    if (request.MatchId.IsEmpty() || request.MatchId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("MatchId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("MatchId"), request.MatchId);
-    }
-    if (request.QueueName.IsEmpty() || request.QueueName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("QueueName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("QueueName"), request.QueueName);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ReturnMemberAttributes"), request.ReturnMemberAttributes);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("EscapeObject"), request.EscapeObject);
+    RequestWriter.WriteStringOrNull(TEXT("MatchId"), request.MatchId);
+    RequestWriter.WriteStringOrNull(TEXT("QueueName"), request.QueueName);
+    RequestWriter.WriteBool(TEXT("ReturnMemberAttributes"), request.ReturnMemberAttributes);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -536,7 +473,7 @@ void UPlayFabMultiplayerAPI::HelperGetMatch(FPlayFabBaseModel response, UObject*
         FMultiplayerGetMatchResult ResultStruct = UPlayFabMultiplayerModelDecoder::decodeGetMatchResultResponse(response.responseData);
         OnSuccessGetMatch.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetMatch.Unbind();
 }
 
 /** Get a matchmaking ticket by ticket Id. */
@@ -546,9 +483,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetMatchmakingTicket(FMultiplaye
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -562,22 +497,15 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetMatchmakingTicket(FMultiplaye
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("EscapeObject"), request.EscapeObject);
-    if (request.QueueName.IsEmpty() || request.QueueName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("QueueName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("QueueName"), request.QueueName);
-    }
-    if (request.TicketId.IsEmpty() || request.TicketId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TicketId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TicketId"), request.TicketId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("EscapeObject"), request.EscapeObject);
+    RequestWriter.WriteStringOrNull(TEXT("QueueName"), request.QueueName);
+    RequestWriter.WriteStringOrNull(TEXT("TicketId"), request.TicketId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -595,7 +523,7 @@ void UPlayFabMultiplayerAPI::HelperGetMatchmakingTicket(FPlayFabBaseModel respon
         FMultiplayerGetMatchmakingTicketResult ResultStruct = UPlayFabMultiplayerModelDecoder::decodeGetMatchmakingTicketResultResponse(response.responseData);
         OnSuccessGetMatchmakingTicket.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetMatchmakingTicket.Unbind();
 }
 
 /** Get the statistics for a queue. */
@@ -605,9 +533,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetQueueStatistics(FMultiplayerG
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -621,16 +547,13 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetQueueStatistics(FMultiplayerG
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.QueueName.IsEmpty() || request.QueueName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("QueueName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("QueueName"), request.QueueName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("QueueName"), request.QueueName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -648,7 +571,7 @@ void UPlayFabMultiplayerAPI::HelperGetQueueStatistics(FPlayFabBaseModel response
         FMultiplayerGetQueueStatisticsResult ResultStruct = UPlayFabMultiplayerModelDecoder::decodeGetQueueStatisticsResultResponse(response.responseData);
         OnSuccessGetQueueStatistics.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetQueueStatistics.Unbind();
 }
 
 /** Get a matchmaking backfill ticket by ticket Id. */
@@ -658,9 +581,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetServerBackfillTicket(FMultipl
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -674,22 +595,15 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetServerBackfillTicket(FMultipl
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("EscapeObject"), request.EscapeObject);
-    if (request.QueueName.IsEmpty() || request.QueueName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("QueueName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("QueueName"), request.QueueName);
-    }
-    if (request.TicketId.IsEmpty() || request.TicketId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TicketId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TicketId"), request.TicketId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("EscapeObject"), request.EscapeObject);
+    RequestWriter.WriteStringOrNull(TEXT("QueueName"), request.QueueName);
+    RequestWriter.WriteStringOrNull(TEXT("TicketId"), request.TicketId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -707,7 +621,7 @@ void UPlayFabMultiplayerAPI::HelperGetServerBackfillTicket(FPlayFabBaseModel res
         FMultiplayerGetServerBackfillTicketResult ResultStruct = UPlayFabMultiplayerModelDecoder::decodeGetServerBackfillTicketResultResponse(response.responseData);
         OnSuccessGetServerBackfillTicket.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetServerBackfillTicket.Unbind();
 }
 
 /** Join a matchmaking ticket. */
@@ -717,9 +631,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::JoinMatchmakingTicket(FMultiplay
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -733,22 +645,15 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::JoinMatchmakingTicket(FMultiplay
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Member != nullptr) OutRestJsonObj->SetObjectField(TEXT("Member"), request.Member);
-    if (request.QueueName.IsEmpty() || request.QueueName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("QueueName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("QueueName"), request.QueueName);
-    }
-    if (request.TicketId.IsEmpty() || request.TicketId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TicketId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TicketId"), request.TicketId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Member"), request.Member);
+    RequestWriter.WriteStringOrNull(TEXT("QueueName"), request.QueueName);
+    RequestWriter.WriteStringOrNull(TEXT("TicketId"), request.TicketId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -766,7 +671,7 @@ void UPlayFabMultiplayerAPI::HelperJoinMatchmakingTicket(FPlayFabBaseModel respo
         FMultiplayerJoinMatchmakingTicketResult ResultStruct = UPlayFabMultiplayerModelDecoder::decodeJoinMatchmakingTicketResultResponse(response.responseData);
         OnSuccessJoinMatchmakingTicket.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessJoinMatchmakingTicket.Unbind();
 }
 
 /** List all matchmaking ticket Ids the user is a member of. */
@@ -776,9 +681,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListMatchmakingTicketsForPlayer(
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -792,17 +695,14 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListMatchmakingTicketsForPlayer(
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.QueueName.IsEmpty() || request.QueueName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("QueueName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("QueueName"), request.QueueName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteStringOrNull(TEXT("QueueName"), request.QueueName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -820,7 +720,7 @@ void UPlayFabMultiplayerAPI::HelperListMatchmakingTicketsForPlayer(FPlayFabBaseM
         FMultiplayerListMatchmakingTicketsForPlayerResult ResultStruct = UPlayFabMultiplayerModelDecoder::decodeListMatchmakingTicketsForPlayerResultResponse(response.responseData);
         OnSuccessListMatchmakingTicketsForPlayer.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListMatchmakingTicketsForPlayer.Unbind();
 }
 
 /** List all server backfill ticket Ids the user is a member of. */
@@ -830,9 +730,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListServerBackfillTicketsForPlay
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -846,17 +744,14 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListServerBackfillTicketsForPlay
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.QueueName.IsEmpty() || request.QueueName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("QueueName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("QueueName"), request.QueueName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteStringOrNull(TEXT("QueueName"), request.QueueName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -874,7 +769,7 @@ void UPlayFabMultiplayerAPI::HelperListServerBackfillTicketsForPlayer(FPlayFabBa
         FMultiplayerListServerBackfillTicketsForPlayerResult ResultStruct = UPlayFabMultiplayerModelDecoder::decodeListServerBackfillTicketsForPlayerResultResponse(response.responseData);
         OnSuccessListServerBackfillTicketsForPlayer.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListServerBackfillTicketsForPlayer.Unbind();
 }
 
 
@@ -892,9 +787,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CreateBuildAlias(FMultiplayerCre
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -908,21 +801,14 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CreateBuildAlias(FMultiplayerCre
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AliasName.IsEmpty() || request.AliasName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AliasName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AliasName"), request.AliasName);
-    }
-    if (request.BuildSelectionCriteria.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildSelectionCriteria"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("BuildSelectionCriteria"), request.BuildSelectionCriteria);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AliasName"), request.AliasName);
+    RequestWriter.WriteObjectArray(TEXT("BuildSelectionCriteria"), request.BuildSelectionCriteria);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -940,7 +826,7 @@ void UPlayFabMultiplayerAPI::HelperCreateBuildAlias(FPlayFabBaseModel response,
         FMultiplayerBuildAliasDetailsResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeBuildAliasDetailsResponseResponse(response.responseData);
         OnSuccessCreateBuildAlias.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateBuildAlias.Unbind();
 }
 
 /** Creates a multiplayer server build with a custom container. */
@@ -950,9 +836,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CreateBuildWithCustomContainer(F
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -966,53 +850,30 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CreateBuildWithCustomContainer(F
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("AreAssetsReadonly"), request.AreAssetsReadonly);
-    if (request.BuildName.IsEmpty() || request.BuildName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildName"), request.BuildName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("AreAssetsReadonly"), request.AreAssetsReadonly);
+    RequestWriter.WriteStringOrNull(TEXT("BuildName"), request.BuildName);
     FString temp_ContainerFlavor;
     if (GetEnumValueToString<EContainerFlavor>(TEXT("EContainerFlavor"), request.ContainerFlavor, temp_ContainerFlavor))
-        OutRestJsonObj->SetStringField(TEXT("ContainerFlavor"), temp_ContainerFlavor);
-    if (request.ContainerImageReference != nullptr) OutRestJsonObj->SetObjectField(TEXT("ContainerImageReference"), request.ContainerImageReference);
-    if (request.ContainerRunCommand.IsEmpty() || request.ContainerRunCommand == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ContainerRunCommand"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ContainerRunCommand"), request.ContainerRunCommand);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.GameAssetReferences.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("GameAssetReferences"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("GameAssetReferences"), request.GameAssetReferences);
-    }
-    if (request.GameCertificateReferences.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("GameCertificateReferences"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("GameCertificateReferences"), request.GameCertificateReferences);
-    }
-    if (request.LinuxInstrumentationConfiguration != nullptr) OutRestJsonObj->SetObjectField(TEXT("LinuxInstrumentationConfiguration"), request.LinuxInstrumentationConfiguration);
-    if (request.Metadata != nullptr) OutRestJsonObj->SetObjectField(TEXT("Metadata"), request.Metadata);
-    OutRestJsonObj->SetNumberField(TEXT("MultiplayerServerCountPerVm"), request.MultiplayerServerCountPerVm);
-    if (request.Ports.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Ports"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Ports"), request.Ports);
-    }
-    if (request.RegionConfigurations.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("RegionConfigurations"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("RegionConfigurations"), request.RegionConfigurations);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("UseStreamingForAssetDownloads"), request.UseStreamingForAssetDownloads);
+        RequestWriter.WriteString(TEXT("ContainerFlavor"), temp_ContainerFlavor);
+    RequestWriter.WriteObject(TEXT("ContainerImageReference"), request.ContainerImageReference);
+    RequestWriter.WriteStringOrNull(TEXT("ContainerRunCommand"), request.ContainerRunCommand);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObjectArray(TEXT("GameAssetReferences"), request.GameAssetReferences);
+    RequestWriter.WriteObjectArray(TEXT("GameCertificateReferences"), request.GameCertificateReferences);
+    RequestWriter.WriteObject(TEXT("LinuxInstrumentationConfiguration"), request.LinuxInstrumentationConfiguration);
+    RequestWriter.WriteObject(TEXT("Metadata"), request.Metadata);
+    RequestWriter.WriteNumber(TEXT("MultiplayerServerCountPerVm"), request.MultiplayerServerCountPerVm);
+    RequestWriter.WriteObjectArray(TEXT("Ports"), request.Ports);
+    RequestWriter.WriteObjectArray(TEXT("RegionConfigurations"), request.RegionConfigurations);
+    RequestWriter.WriteBool(TEXT("UseStreamingForAssetDownloads"), request.UseStreamingForAssetDownloads);
     FString temp_VmSize;
     if (GetEnumValueToString<EAzureVmSize>(TEXT("EAzureVmSize"), request.VmSize, temp_VmSize))
-        OutRestJsonObj->SetStringField(TEXT("VmSize"), temp_VmSize);
+        RequestWriter.WriteString(TEXT("VmSize"), temp_VmSize);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1030,7 +891,7 @@ void UPlayFabMultiplayerAPI::HelperCreateBuildWithCustomContainer(FPlayFabBaseMo
         FMultiplayerCreateBuildWithCustomContainerResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeCreateBuildWithCustomContainerResponseResponse(response.responseData);
         OnSuccessCreateBuildWithCustomContainer.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateBuildWithCustomContainer.Unbind();
 }
 
 /** Creates a multiplayer server build with a managed container. */
@@ -1040,9 +901,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CreateBuildWithManagedContainer(
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1056,57 +915,30 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CreateBuildWithManagedContainer(
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("AreAssetsReadonly"), request.AreAssetsReadonly);
-    if (request.BuildName.IsEmpty() || request.BuildName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildName"), request.BuildName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("AreAssetsReadonly"), request.AreAssetsReadonly);
+    RequestWriter.WriteStringOrNull(TEXT("BuildName"), request.BuildName);
     FString temp_ContainerFlavor;
     if (GetEnumValueToString<EContainerFlavor>(TEXT("EContainerFlavor"), request.ContainerFlavor, temp_ContainerFlavor))
-        OutRestJsonObj->SetStringField(TEXT("ContainerFlavor"), temp_ContainerFlavor);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.GameAssetReferences.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("GameAssetReferences"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("GameAssetReferences"), request.GameAssetReferences);
-    }
-    if (request.GameCertificateReferences.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("GameCertificateReferences"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("GameCertificateReferences"), request.GameCertificateReferences);
-    }
-    if (request.GameWorkingDirectory.IsEmpty() || request.GameWorkingDirectory == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameWorkingDirectory"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameWorkingDirectory"), request.GameWorkingDirectory);
-    }
-    if (request.InstrumentationConfiguration != nullptr) OutRestJsonObj->SetObjectField(TEXT("InstrumentationConfiguration"), request.InstrumentationConfiguration);
-    if (request.Metadata != nullptr) OutRestJsonObj->SetObjectField(TEXT("Metadata"), request.Metadata);
-    OutRestJsonObj->SetNumberField(TEXT("MultiplayerServerCountPerVm"), request.MultiplayerServerCountPerVm);
-    if (request.Ports.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Ports"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Ports"), request.Ports);
-    }
-    if (request.RegionConfigurations.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("RegionConfigurations"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("RegionConfigurations"), request.RegionConfigurations);
-    }
-    if (request.StartMultiplayerServerCommand.IsEmpty() || request.StartMultiplayerServerCommand == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StartMultiplayerServerCommand"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StartMultiplayerServerCommand"), request.StartMultiplayerServerCommand);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("UseStreamingForAssetDownloads"), request.UseStreamingForAssetDownloads);
+        RequestWriter.WriteString(TEXT("ContainerFlavor"), temp_ContainerFlavor);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObjectArray(TEXT("GameAssetReferences"), request.GameAssetReferences);
+    RequestWriter.WriteObjectArray(TEXT("GameCertificateReferences"), request.GameCertificateReferences);
+    RequestWriter.WriteStringOrNull(TEXT("GameWorkingDirectory"), request.GameWorkingDirectory);
+    RequestWriter.WriteObject(TEXT("InstrumentationConfiguration"), request.InstrumentationConfiguration);
+    RequestWriter.WriteObject(TEXT("Metadata"), request.Metadata);
+    RequestWriter.WriteNumber(TEXT("MultiplayerServerCountPerVm"), request.MultiplayerServerCountPerVm);
+    RequestWriter.WriteObjectArray(TEXT("Ports"), request.Ports);
+    RequestWriter.WriteObjectArray(TEXT("RegionConfigurations"), request.RegionConfigurations);
+    RequestWriter.WriteStringOrNull(TEXT("StartMultiplayerServerCommand"), request.StartMultiplayerServerCommand);
+    RequestWriter.WriteBool(TEXT("UseStreamingForAssetDownloads"), request.UseStreamingForAssetDownloads);
     FString temp_VmSize;
     if (GetEnumValueToString<EAzureVmSize>(TEXT("EAzureVmSize"), request.VmSize, temp_VmSize))
-        OutRestJsonObj->SetStringField(TEXT("VmSize"), temp_VmSize);
+        RequestWriter.WriteString(TEXT("VmSize"), temp_VmSize);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1124,7 +956,7 @@ void UPlayFabMultiplayerAPI::HelperCreateBuildWithManagedContainer(FPlayFabBaseM
         FMultiplayerCreateBuildWithManagedContainerResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeCreateBuildWithManagedContainerResponseResponse(response.responseData);
         OnSuccessCreateBuildWithManagedContainer.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateBuildWithManagedContainer.Unbind();
 }
 
 /** Creates a multiplayer server build with the server running as a process. */
@@ -1134,9 +966,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CreateBuildWithProcessBasedServe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1150,60 +980,29 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CreateBuildWithProcessBasedServe
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("AreAssetsReadonly"), request.AreAssetsReadonly);
-    if (request.BuildName.IsEmpty() || request.BuildName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildName"), request.BuildName);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.GameAssetReferences.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("GameAssetReferences"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("GameAssetReferences"), request.GameAssetReferences);
-    }
-    if (request.GameCertificateReferences.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("GameCertificateReferences"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("GameCertificateReferences"), request.GameCertificateReferences);
-    }
-    if (request.GameWorkingDirectory.IsEmpty() || request.GameWorkingDirectory == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameWorkingDirectory"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameWorkingDirectory"), request.GameWorkingDirectory);
-    }
-    if (request.InstrumentationConfiguration != nullptr) OutRestJsonObj->SetObjectField(TEXT("InstrumentationConfiguration"), request.InstrumentationConfiguration);
-    OutRestJsonObj->SetBoolField(TEXT("IsOSPreview"), request.IsOSPreview);
-    if (request.Metadata != nullptr) OutRestJsonObj->SetObjectField(TEXT("Metadata"), request.Metadata);
-    OutRestJsonObj->SetNumberField(TEXT("MultiplayerServerCountPerVm"), request.MultiplayerServerCountPerVm);
-    if (request.OsPlatform.IsEmpty() || request.OsPlatform == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OsPlatform"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OsPlatform"), request.OsPlatform);
-    }
-    if (request.Ports.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Ports"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Ports"), request.Ports);
-    }
-    if (request.RegionConfigurations.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("RegionConfigurations"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("RegionConfigurations"), request.RegionConfigurations);
-    }
-    if (request.StartMultiplayerServerCommand.IsEmpty() || request.StartMultiplayerServerCommand == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StartMultiplayerServerCommand"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StartMultiplayerServerCommand"), request.StartMultiplayerServerCommand);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("UseStreamingForAssetDownloads"), request.UseStreamingForAssetDownloads);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteBool(TEXT("AreAssetsReadonly"), request.AreAssetsReadonly);
+    RequestWriter.WriteStringOrNull(TEXT("BuildName"), request.BuildName);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObjectArray(TEXT("GameAssetReferences"), request.GameAssetReferences);
+    RequestWriter.WriteObjectArray(TEXT("GameCertificateReferences"), request.GameCertificateReferences);
+    RequestWriter.WriteStringOrNull(TEXT("GameWorkingDirectory"), request.GameWorkingDirectory);
+    RequestWriter.WriteObject(TEXT("InstrumentationConfiguration"), request.InstrumentationConfiguration);
+    RequestWriter.WriteBool(TEXT("IsOSPreview"), request.IsOSPreview);
+    RequestWriter.WriteObject(TEXT("Metadata"), request.Metadata);
+    RequestWriter.WriteNumber(TEXT("MultiplayerServerCountPerVm"), request.MultiplayerServerCountPerVm);
+    RequestWriter.WriteStringOrNull(TEXT("OsPlatform"), request.OsPlatform);
+    RequestWriter.WriteObjectArray(TEXT("Ports"), request.Ports);
+    RequestWriter.WriteObjectArray(TEXT("RegionConfigurations"), request.RegionConfigurations);
+    RequestWriter.WriteStringOrNull(TEXT("StartMultiplayerServerCommand"), request.StartMultiplayerServerCommand);
+    RequestWriter.WriteBool(TEXT("UseStreamingForAssetDownloads"), request.UseStreamingForAssetDownloads);
     FString temp_VmSize;
     if (GetEnumValueToString<EAzureVmSize>(TEXT("EAzureVmSize"), request.VmSize, temp_VmSize))
-        OutRestJsonObj->SetStringField(TEXT("VmSize"), temp_VmSize);
+        RequestWriter.WriteString(TEXT("VmSize"), temp_VmSize);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1221,7 +1020,7 @@ void UPlayFabMultiplayerAPI::HelperCreateBuildWithProcessBasedServer(FPlayFabBas
         FMultiplayerCreateBuildWithProcessBasedServerResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeCreateBuildWithProcessBasedServerResponseResponse(response.responseData);
         OnSuccessCreateBuildWithProcessBasedServer.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateBuildWithProcessBasedServer.Unbind();
 }
 
 /** Creates a remote user to log on to a VM for a multiplayer server build. */
@@ -1231,9 +1030,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CreateRemoteUser(FMultiplayerCre
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1247,36 +1044,17 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CreateRemoteUser(FMultiplayerCre
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ExpirationTime.IsEmpty() || request.ExpirationTime == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ExpirationTime"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ExpirationTime"), request.ExpirationTime);
-    }
-    if (request.Region.IsEmpty() || request.Region == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Region"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Region"), request.Region);
-    }
-    if (request.Username.IsEmpty() || request.Username == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Username"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Username"), request.Username);
-    }
-    if (request.VmId.IsEmpty() || request.VmId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VmId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VmId"), request.VmId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ExpirationTime"), request.ExpirationTime);
+    RequestWriter.WriteStringOrNull(TEXT("Region"), request.Region);
+    RequestWriter.WriteStringOrNull(TEXT("Username"), request.Username);
+    RequestWriter.WriteStringOrNull(TEXT("VmId"), request.VmId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1294,7 +1072,7 @@ void UPlayFabMultiplayerAPI::HelperCreateRemoteUser(FPlayFabBaseModel response,
         FMultiplayerCreateRemoteUserResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeCreateRemoteUserResponseResponse(response.responseData);
         OnSuccessCreateRemoteUser.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateRemoteUser.Unbind();
 }
 
 /** Creates a request to change a title's multiplayer server quotas. */
@@ -1304,9 +1082,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CreateTitleMultiplayerServersQuo
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1320,36 +1096,17 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::CreateTitleMultiplayerServersQuo
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.ChangeDescription.IsEmpty() || request.ChangeDescription == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ChangeDescription"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ChangeDescription"), request.ChangeDescription);
-    }
-    if (request.Changes.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Changes"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Changes"), request.Changes);
-    }
-    if (request.ContactEmail.IsEmpty() || request.ContactEmail == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ContactEmail"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ContactEmail"), request.ContactEmail);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Notes.IsEmpty() || request.Notes == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Notes"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Notes"), request.Notes);
-    }
-    if (request.StartDate.IsEmpty() || request.StartDate == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StartDate"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StartDate"), request.StartDate);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("ChangeDescription"), request.ChangeDescription);
+    RequestWriter.WriteObjectArray(TEXT("Changes"), request.Changes);
+    RequestWriter.WriteStringOrNull(TEXT("ContactEmail"), request.ContactEmail);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Notes"), request.Notes);
+    RequestWriter.WriteStringOrNull(TEXT("StartDate"), request.StartDate);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1367,7 +1124,7 @@ void UPlayFabMultiplayerAPI::HelperCreateTitleMultiplayerServersQuotaChange(FPla
         FMultiplayerCreateTitleMultiplayerServersQuotaChangeResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeCreateTitleMultiplayerServersQuotaChangeResponseResponse(response.responseData);
         OnSuccessCreateTitleMultiplayerServersQuotaChange.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessCreateTitleMultiplayerServersQuotaChange.Unbind();
 }
 
 /** Deletes a multiplayer server game asset for a title. */
@@ -1377,9 +1134,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::DeleteAsset(FMultiplayerDeleteAs
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1393,16 +1148,13 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::DeleteAsset(FMultiplayerDeleteAs
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.FileName.IsEmpty() || request.FileName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FileName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FileName"), request.FileName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("FileName"), request.FileName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1420,7 +1172,7 @@ void UPlayFabMultiplayerAPI::HelperDeleteAsset(FPlayFabBaseModel response, UObje
         FMultiplayerEmptyResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeEmptyResponseResponse(response.responseData);
         OnSuccessDeleteAsset.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteAsset.Unbind();
 }
 
 /** Deletes a multiplayer server build. */
@@ -1430,9 +1182,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::DeleteBuild(FMultiplayerDeleteBu
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1446,16 +1196,13 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::DeleteBuild(FMultiplayerDeleteBu
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1471,10 +1218,10 @@ void UPlayFabMultiplayerAPI::HelperDeleteBuild(FPlayFabBaseModel response, UObje
     else if (!error.hasError && OnSuccessDeleteBuild.IsBound())
     {
         FMultiplayerEmptyResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessDeleteBuild.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteBuild.Unbind();
 }
 
 /** Deletes a multiplayer server build alias. */
@@ -1484,9 +1231,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::DeleteBuildAlias(FMultiplayerDel
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1500,16 +1245,13 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::DeleteBuildAlias(FMultiplayerDel
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AliasId.IsEmpty() || request.AliasId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AliasId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AliasId"), request.AliasId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AliasId"), request.AliasId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1525,10 +1267,10 @@ void UPlayFabMultiplayerAPI::HelperDeleteBuildAlias(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessDeleteBuildAlias.IsBound())
     {
         FMultiplayerEmptyResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessDeleteBuildAlias.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteBuildAlias.Unbind();
 }
 
 /** Removes a multiplayer server build's region. */
@@ -1538,9 +1280,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::DeleteBuildRegion(FMultiplayerDe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1554,21 +1294,14 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::DeleteBuildRegion(FMultiplayerDe
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Region.IsEmpty() || request.Region == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Region"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Region"), request.Region);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Region"), request.Region);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1584,10 +1317,10 @@ void UPlayFabMultiplayerAPI::HelperDeleteBuildRegion(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessDeleteBuildRegion.IsBound())
     {
         FMultiplayerEmptyResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessDeleteBuildRegion.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteBuildRegion.Unbind();
 }
 
 /** Deletes a multiplayer server game certificate. */
@@ -1597,9 +1330,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::DeleteCertificate(FMultiplayerDe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1613,16 +1344,13 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::DeleteCertificate(FMultiplayerDe
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Name.IsEmpty() || request.Name == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Name"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Name"), request.Name);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Name"), request.Name);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1638,10 +1366,10 @@ void UPlayFabMultiplayerAPI::HelperDeleteCertificate(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessDeleteCertificate.IsBound())
     {
         FMultiplayerEmptyResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessDeleteCertificate.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteCertificate.Unbind();
 }
 
 /** Deletes a container image repository. */
@@ -1651,9 +1379,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::DeleteContainerImageRepository(F
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1667,16 +1393,13 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::DeleteContainerImageRepository(F
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ImageName.IsEmpty() || request.ImageName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ImageName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ImageName"), request.ImageName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ImageName"), request.ImageName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1692,10 +1415,10 @@ void UPlayFabMultiplayerAPI::HelperDeleteContainerImageRepository(FPlayFabBaseMo
     else if (!error.hasError && OnSuccessDeleteContainerImageRepository.IsBound())
     {
         FMultiplayerEmptyResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessDeleteContainerImageRepository.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteContainerImageRepository.Unbind();
 }
 
 /** Deletes a remote user to log on to a VM for a multiplayer server build. */
@@ -1705,9 +1428,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::DeleteRemoteUser(FMultiplayerDel
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1721,31 +1442,16 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::DeleteRemoteUser(FMultiplayerDel
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Region.IsEmpty() || request.Region == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Region"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Region"), request.Region);
-    }
-    if (request.Username.IsEmpty() || request.Username == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Username"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Username"), request.Username);
-    }
-    if (request.VmId.IsEmpty() || request.VmId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VmId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VmId"), request.VmId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Region"), request.Region);
+    RequestWriter.WriteStringOrNull(TEXT("Username"), request.Username);
+    RequestWriter.WriteStringOrNull(TEXT("VmId"), request.VmId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1761,10 +1467,10 @@ void UPlayFabMultiplayerAPI::HelperDeleteRemoteUser(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessDeleteRemoteUser.IsBound())
     {
         FMultiplayerEmptyResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessDeleteRemoteUser.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessDeleteRemoteUser.Unbind();
 }
 
 /** Enables the multiplayer server feature for a title. */
@@ -1774,9 +1480,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::EnableMultiplayerServersForTitle
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1790,11 +1494,12 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::EnableMultiplayerServersForTitle
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1812,7 +1517,7 @@ void UPlayFabMultiplayerAPI::HelperEnableMultiplayerServersForTitle(FPlayFabBase
         FMultiplayerEnableMultiplayerServersForTitleResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeEnableMultiplayerServersForTitleResponseResponse(response.responseData);
         OnSuccessEnableMultiplayerServersForTitle.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessEnableMultiplayerServersForTitle.Unbind();
 }
 
 /** Gets the URL to upload assets to. */
@@ -1822,9 +1527,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetAssetUploadUrl(FMultiplayerGe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1838,16 +1541,13 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetAssetUploadUrl(FMultiplayerGe
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.FileName.IsEmpty() || request.FileName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FileName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FileName"), request.FileName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("FileName"), request.FileName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1865,7 +1565,7 @@ void UPlayFabMultiplayerAPI::HelperGetAssetUploadUrl(FPlayFabBaseModel response,
         FMultiplayerGetAssetUploadUrlResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeGetAssetUploadUrlResponseResponse(response.responseData);
         OnSuccessGetAssetUploadUrl.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetAssetUploadUrl.Unbind();
 }
 
 /** Gets a multiplayer server build. */
@@ -1875,9 +1575,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetBuild(FMultiplayerGetBuildReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1891,16 +1589,13 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetBuild(FMultiplayerGetBuildReq
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1918,7 +1613,7 @@ void UPlayFabMultiplayerAPI::HelperGetBuild(FPlayFabBaseModel response, UObject*
         FMultiplayerGetBuildResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeGetBuildResponseResponse(response.responseData);
         OnSuccessGetBuild.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetBuild.Unbind();
 }
 
 /** Gets a multiplayer server build alias. */
@@ -1928,9 +1623,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetBuildAlias(FMultiplayerGetBui
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1944,16 +1637,13 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetBuildAlias(FMultiplayerGetBui
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AliasId.IsEmpty() || request.AliasId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AliasId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AliasId"), request.AliasId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AliasId"), request.AliasId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -1969,10 +1659,10 @@ void UPlayFabMultiplayerAPI::HelperGetBuildAlias(FPlayFabBaseModel response, UOb
     else if (!error.hasError && OnSuccessGetBuildAlias.IsBound())
     {
         FMultiplayerBuildAliasDetailsResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeBuildAliasDetailsResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetBuildAlias.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetBuildAlias.Unbind();
 }
 
 /** Gets the credentials to the container registry. */
@@ -1982,9 +1672,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetContainerRegistryCredentials(
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -1998,11 +1686,12 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetContainerRegistryCredentials(
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2020,7 +1709,7 @@ void UPlayFabMultiplayerAPI::HelperGetContainerRegistryCredentials(FPlayFabBaseM
         FMultiplayerGetContainerRegistryCredentialsResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeGetContainerRegistryCredentialsResponseResponse(response.responseData);
         OnSuccessGetContainerRegistryCredentials.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetContainerRegistryCredentials.Unbind();
 }
 
 /** Gets multiplayer server session details for a build. */
@@ -2030,9 +1719,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetMultiplayerServerDetails(FMul
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2046,26 +1733,15 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetMultiplayerServerDetails(FMul
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Region.IsEmpty() || request.Region == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Region"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Region"), request.Region);
-    }
-    if (request.SessionId.IsEmpty() || request.SessionId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SessionId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SessionId"), request.SessionId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Region"), request.Region);
+    RequestWriter.WriteStringOrNull(TEXT("SessionId"), request.SessionId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2083,7 +1759,7 @@ void UPlayFabMultiplayerAPI::HelperGetMultiplayerServerDetails(FPlayFabBaseModel
         FMultiplayerGetMultiplayerServerDetailsResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeGetMultiplayerServerDetailsResponseResponse(response.responseData);
         OnSuccessGetMultiplayerServerDetails.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetMultiplayerServerDetails.Unbind();
 }
 
 /** Gets multiplayer server logs after a server has terminated. */
@@ -2093,9 +1769,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetMultiplayerServerLogs(FMultip
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2109,16 +1783,13 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetMultiplayerServerLogs(FMultip
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ServerId.IsEmpty() || request.ServerId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ServerId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ServerId"), request.ServerId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ServerId"), request.ServerId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2136,7 +1807,7 @@ void UPlayFabMultiplayerAPI::HelperGetMultiplayerServerLogs(FPlayFabBaseModel re
         FMultiplayerGetMultiplayerServerLogsResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeGetMultiplayerServerLogsResponseResponse(response.responseData);
         OnSuccessGetMultiplayerServerLogs.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetMultiplayerServerLogs.Unbind();
 }
 
 /** Gets multiplayer server logs after a server has terminated. */
@@ -2146,9 +1817,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetMultiplayerSessionLogsBySessi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2162,16 +1831,13 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetMultiplayerSessionLogsBySessi
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.SessionId.IsEmpty() || request.SessionId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SessionId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SessionId"), request.SessionId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("SessionId"), request.SessionId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2187,10 +1853,10 @@ void UPlayFabMultiplayerAPI::HelperGetMultiplayerSessionLogsBySessionId(FPlayFab
     else if (!error.hasError && OnSuccessGetMultiplayerSessionLogsBySessionId.IsBound())
     {
         FMultiplayerGetMultiplayerServerLogsResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeGetMultiplayerServerLogsResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessGetMultiplayerSessionLogsBySessionId.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetMultiplayerSessionLogsBySessionId.Unbind();
 }
 
 /** Gets a remote login endpoint to a VM that is hosting a multiplayer server build. */
@@ -2200,9 +1866,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetRemoteLoginEndpoint(FMultipla
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2216,26 +1880,15 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetRemoteLoginEndpoint(FMultipla
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Region.IsEmpty() || request.Region == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Region"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Region"), request.Region);
-    }
-    if (request.VmId.IsEmpty() || request.VmId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VmId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VmId"), request.VmId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Region"), request.Region);
+    RequestWriter.WriteStringOrNull(TEXT("VmId"), request.VmId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2253,7 +1906,7 @@ void UPlayFabMultiplayerAPI::HelperGetRemoteLoginEndpoint(FPlayFabBaseModel resp
         FMultiplayerGetRemoteLoginEndpointResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeGetRemoteLoginEndpointResponseResponse(response.responseData);
         OnSuccessGetRemoteLoginEndpoint.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetRemoteLoginEndpoint.Unbind();
 }
 
 /** Gets the status of whether a title is enabled for the multiplayer server feature. */
@@ -2263,9 +1916,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetTitleEnabledForMultiplayerSer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2279,11 +1930,12 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetTitleEnabledForMultiplayerSer
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2301,7 +1953,7 @@ void UPlayFabMultiplayerAPI::HelperGetTitleEnabledForMultiplayerServersStatus(FP
         FMultiplayerGetTitleEnabledForMultiplayerServersStatusResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeGetTitleEnabledForMultiplayerServersStatusResponseResponse(response.responseData);
         OnSuccessGetTitleEnabledForMultiplayerServersStatus.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetTitleEnabledForMultiplayerServersStatus.Unbind();
 }
 
 /** Gets a title's server quota change request. */
@@ -2311,9 +1963,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetTitleMultiplayerServersQuotaC
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2327,16 +1977,13 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetTitleMultiplayerServersQuotaC
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.RequestId.IsEmpty() || request.RequestId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RequestId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("RequestId"), request.RequestId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("RequestId"), request.RequestId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2354,7 +2001,7 @@ void UPlayFabMultiplayerAPI::HelperGetTitleMultiplayerServersQuotaChange(FPlayFa
         FMultiplayerGetTitleMultiplayerServersQuotaChangeResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeGetTitleMultiplayerServersQuotaChangeResponseResponse(response.responseData);
         OnSuccessGetTitleMultiplayerServersQuotaChange.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetTitleMultiplayerServersQuotaChange.Unbind();
 }
 
 /** Gets the quotas for a title in relation to multiplayer servers. */
@@ -2364,9 +2011,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetTitleMultiplayerServersQuotas
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2380,11 +2025,12 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::GetTitleMultiplayerServersQuotas
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2402,7 +2048,7 @@ void UPlayFabMultiplayerAPI::HelperGetTitleMultiplayerServersQuotas(FPlayFabBase
         FMultiplayerGetTitleMultiplayerServersQuotasResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeGetTitleMultiplayerServersQuotasResponseResponse(response.responseData);
         OnSuccessGetTitleMultiplayerServersQuotas.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetTitleMultiplayerServersQuotas.Unbind();
 }
 
 /** Lists archived multiplayer server sessions for a build. */
@@ -2412,9 +2058,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListArchivedMultiplayerServers(F
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2428,27 +2072,16 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListArchivedMultiplayerServers(F
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("PageSize"), request.PageSize);
-    if (request.Region.IsEmpty() || request.Region == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Region"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Region"), request.Region);
-    }
-    if (request.SkipToken.IsEmpty() || request.SkipToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SkipToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SkipToken"), request.SkipToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("PageSize"), request.PageSize);
+    RequestWriter.WriteStringOrNull(TEXT("Region"), request.Region);
+    RequestWriter.WriteStringOrNull(TEXT("SkipToken"), request.SkipToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2466,7 +2099,7 @@ void UPlayFabMultiplayerAPI::HelperListArchivedMultiplayerServers(FPlayFabBaseMo
         FMultiplayerListMultiplayerServersResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeListMultiplayerServersResponseResponse(response.responseData);
         OnSuccessListArchivedMultiplayerServers.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListArchivedMultiplayerServers.Unbind();
 }
 
 /** Lists multiplayer server game assets for a title. */
@@ -2476,9 +2109,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListAssetSummaries(FMultiplayerL
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2492,17 +2123,14 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListAssetSummaries(FMultiplayerL
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("PageSize"), request.PageSize);
-    if (request.SkipToken.IsEmpty() || request.SkipToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SkipToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SkipToken"), request.SkipToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("PageSize"), request.PageSize);
+    RequestWriter.WriteStringOrNull(TEXT("SkipToken"), request.SkipToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2520,7 +2148,7 @@ void UPlayFabMultiplayerAPI::HelperListAssetSummaries(FPlayFabBaseModel response
         FMultiplayerListAssetSummariesResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeListAssetSummariesResponseResponse(response.responseData);
         OnSuccessListAssetSummaries.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListAssetSummaries.Unbind();
 }
 
 /** Lists details of all build aliases for a title. Accepts tokens for title and if game client access is enabled, allows game client to request list of builds with player entity token. */
@@ -2530,9 +2158,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListBuildAliases(FMultiplayerLis
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2546,17 +2172,14 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListBuildAliases(FMultiplayerLis
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("PageSize"), request.PageSize);
-    if (request.SkipToken.IsEmpty() || request.SkipToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SkipToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SkipToken"), request.SkipToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("PageSize"), request.PageSize);
+    RequestWriter.WriteStringOrNull(TEXT("SkipToken"), request.SkipToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2574,7 +2197,7 @@ void UPlayFabMultiplayerAPI::HelperListBuildAliases(FPlayFabBaseModel response,
         FMultiplayerListBuildAliasesResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeListBuildAliasesResponseResponse(response.responseData);
         OnSuccessListBuildAliases.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListBuildAliases.Unbind();
 }
 
 /** Lists summarized details of all multiplayer server builds for a title. Accepts tokens for title and if game client access is enabled, allows game client to request list of builds with player entity token. */
@@ -2584,9 +2207,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListBuildSummariesV2(FMultiplaye
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2600,17 +2221,14 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListBuildSummariesV2(FMultiplaye
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("PageSize"), request.PageSize);
-    if (request.SkipToken.IsEmpty() || request.SkipToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SkipToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SkipToken"), request.SkipToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("PageSize"), request.PageSize);
+    RequestWriter.WriteStringOrNull(TEXT("SkipToken"), request.SkipToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2628,7 +2246,7 @@ void UPlayFabMultiplayerAPI::HelperListBuildSummariesV2(FPlayFabBaseModel respon
         FMultiplayerListBuildSummariesResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeListBuildSummariesResponseResponse(response.responseData);
         OnSuccessListBuildSummariesV2.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListBuildSummariesV2.Unbind();
 }
 
 /** Lists multiplayer server game certificates for a title. */
@@ -2638,9 +2256,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListCertificateSummaries(FMultip
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2654,17 +2270,14 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListCertificateSummaries(FMultip
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("PageSize"), request.PageSize);
-    if (request.SkipToken.IsEmpty() || request.SkipToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SkipToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SkipToken"), request.SkipToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("PageSize"), request.PageSize);
+    RequestWriter.WriteStringOrNull(TEXT("SkipToken"), request.SkipToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2682,7 +2295,7 @@ void UPlayFabMultiplayerAPI::HelperListCertificateSummaries(FPlayFabBaseModel re
         FMultiplayerListCertificateSummariesResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeListCertificateSummariesResponseResponse(response.responseData);
         OnSuccessListCertificateSummaries.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListCertificateSummaries.Unbind();
 }
 
 /** Lists custom container images for a title. */
@@ -2692,9 +2305,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListContainerImages(FMultiplayer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2708,17 +2319,14 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListContainerImages(FMultiplayer
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("PageSize"), request.PageSize);
-    if (request.SkipToken.IsEmpty() || request.SkipToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SkipToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SkipToken"), request.SkipToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("PageSize"), request.PageSize);
+    RequestWriter.WriteStringOrNull(TEXT("SkipToken"), request.SkipToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2736,7 +2344,7 @@ void UPlayFabMultiplayerAPI::HelperListContainerImages(FPlayFabBaseModel respons
         FMultiplayerListContainerImagesResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeListContainerImagesResponseResponse(response.responseData);
         OnSuccessListContainerImages.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListContainerImages.Unbind();
 }
 
 /** Lists the tags for a custom container image. */
@@ -2746,9 +2354,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListContainerImageTags(FMultipla
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2762,16 +2368,13 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListContainerImageTags(FMultipla
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ImageName.IsEmpty() || request.ImageName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ImageName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ImageName"), request.ImageName);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ImageName"), request.ImageName);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2789,7 +2392,7 @@ void UPlayFabMultiplayerAPI::HelperListContainerImageTags(FPlayFabBaseModel resp
         FMultiplayerListContainerImageTagsResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeListContainerImageTagsResponseResponse(response.responseData);
         OnSuccessListContainerImageTags.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListContainerImageTags.Unbind();
 }
 
 /** Lists multiplayer server sessions for a build. */
@@ -2799,9 +2402,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListMultiplayerServers(FMultipla
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2815,27 +2416,16 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListMultiplayerServers(FMultipla
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("PageSize"), request.PageSize);
-    if (request.Region.IsEmpty() || request.Region == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Region"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Region"), request.Region);
-    }
-    if (request.SkipToken.IsEmpty() || request.SkipToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SkipToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SkipToken"), request.SkipToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("PageSize"), request.PageSize);
+    RequestWriter.WriteStringOrNull(TEXT("Region"), request.Region);
+    RequestWriter.WriteStringOrNull(TEXT("SkipToken"), request.SkipToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2851,10 +2441,10 @@ void UPlayFabMultiplayerAPI::HelperListMultiplayerServers(FPlayFabBaseModel resp
     else if (!error.hasError && OnSuccessListMultiplayerServers.IsBound())
     {
         FMultiplayerListMultiplayerServersResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeListMultiplayerServersResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessListMultiplayerServers.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListMultiplayerServers.Unbind();
 }
 
 /** Lists quality of service servers for party. */
@@ -2864,9 +2454,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListPartyQosServers(FMultiplayer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2879,11 +2467,12 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListPartyQosServers(FMultiplayer
     manager->PlayFabRequestURL = "/MultiplayerServer/ListPartyQosServers";
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2901,7 +2490,7 @@ void UPlayFabMultiplayerAPI::HelperListPartyQosServers(FPlayFabBaseModel respons
         FMultiplayerListPartyQosServersResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeListPartyQosServersResponseResponse(response.responseData);
         OnSuccessListPartyQosServers.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListPartyQosServers.Unbind();
 }
 
 /** Lists quality of service servers for the title. By default, servers are only returned for regions where a Multiplayer Servers build has been deployed. */
@@ -2911,9 +2500,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListQosServersForTitle(FMultipla
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2927,12 +2514,13 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListQosServersForTitle(FMultipla
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeAllRegions"), request.IncludeAllRegions);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("IncludeAllRegions"), request.IncludeAllRegions);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2950,7 +2538,7 @@ void UPlayFabMultiplayerAPI::HelperListQosServersForTitle(FPlayFabBaseModel resp
         FMultiplayerListQosServersForTitleResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeListQosServersForTitleResponseResponse(response.responseData);
         OnSuccessListQosServersForTitle.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListQosServersForTitle.Unbind();
 }
 
 /** List all server quota change requests for a title. */
@@ -2960,9 +2548,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListTitleMultiplayerServersQuota
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -2976,11 +2562,12 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListTitleMultiplayerServersQuota
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -2998,7 +2585,7 @@ void UPlayFabMultiplayerAPI::HelperListTitleMultiplayerServersQuotaChanges(FPlay
         FMultiplayerListTitleMultiplayerServersQuotaChangesResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeListTitleMultiplayerServersQuotaChangesResponseResponse(response.responseData);
         OnSuccessListTitleMultiplayerServersQuotaChanges.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListTitleMultiplayerServersQuotaChanges.Unbind();
 }
 
 /** Lists virtual machines for a title. */
@@ -3008,9 +2595,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListVirtualMachineSummaries(FMul
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3024,27 +2609,16 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ListVirtualMachineSummaries(FMul
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetNumberField(TEXT("PageSize"), request.PageSize);
-    if (request.Region.IsEmpty() || request.Region == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Region"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Region"), request.Region);
-    }
-    if (request.SkipToken.IsEmpty() || request.SkipToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SkipToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SkipToken"), request.SkipToken);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteNumber(TEXT("PageSize"), request.PageSize);
+    RequestWriter.WriteStringOrNull(TEXT("Region"), request.Region);
+    RequestWriter.WriteStringOrNull(TEXT("SkipToken"), request.SkipToken);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3062,7 +2636,7 @@ void UPlayFabMultiplayerAPI::HelperListVirtualMachineSummaries(FPlayFabBaseModel
         FMultiplayerListVirtualMachineSummariesResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeListVirtualMachineSummariesResponseResponse(response.responseData);
         OnSuccessListVirtualMachineSummaries.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessListVirtualMachineSummaries.Unbind();
 }
 
 /** Request a multiplayer server session. Accepts tokens for title and if game client access is enabled, allows game client to request a server with player entity token. */
@@ -3072,9 +2646,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::RequestMultiplayerServer(FMultip
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3088,43 +2660,18 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::RequestMultiplayerServer(FMultip
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildAliasParams != nullptr) OutRestJsonObj->SetObjectField(TEXT("BuildAliasParams"), request.BuildAliasParams);
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    // Check to see if string is empty
-    if (request.InitialPlayers.IsEmpty() || request.InitialPlayers == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("InitialPlayers"));
-    } else {
-        TArray<FString> InitialPlayersArray;
-        FString(request.InitialPlayers).ParseIntoArray(InitialPlayersArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("InitialPlayers"), InitialPlayersArray);
-    }
-    // Check to see if string is empty
-    if (request.PreferredRegions.IsEmpty() || request.PreferredRegions == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PreferredRegions"));
-    } else {
-        TArray<FString> PreferredRegionsArray;
-        FString(request.PreferredRegions).ParseIntoArray(PreferredRegionsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("PreferredRegions"), PreferredRegionsArray);
-    }
-    if (request.SessionCookie.IsEmpty() || request.SessionCookie == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SessionCookie"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SessionCookie"), request.SessionCookie);
-    }
-    if (request.SessionId.IsEmpty() || request.SessionId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SessionId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SessionId"), request.SessionId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("BuildAliasParams"), request.BuildAliasParams);
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringArray(TEXT("InitialPlayers"), request.InitialPlayers);
+    RequestWriter.WriteStringArray(TEXT("PreferredRegions"), request.PreferredRegions);
+    RequestWriter.WriteStringOrNull(TEXT("SessionCookie"), request.SessionCookie);
+    RequestWriter.WriteStringOrNull(TEXT("SessionId"), request.SessionId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3142,7 +2689,7 @@ void UPlayFabMultiplayerAPI::HelperRequestMultiplayerServer(FPlayFabBaseModel re
         FMultiplayerRequestMultiplayerServerResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeRequestMultiplayerServerResponseResponse(response.responseData);
         OnSuccessRequestMultiplayerServer.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRequestMultiplayerServer.Unbind();
 }
 
 /** Rolls over the credentials to the container registry. */
@@ -3152,9 +2699,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::RolloverContainerRegistryCredent
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3168,11 +2713,12 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::RolloverContainerRegistryCredent
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3190,7 +2736,7 @@ void UPlayFabMultiplayerAPI::HelperRolloverContainerRegistryCredentials(FPlayFab
         FMultiplayerRolloverContainerRegistryCredentialsResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeRolloverContainerRegistryCredentialsResponseResponse(response.responseData);
         OnSuccessRolloverContainerRegistryCredentials.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessRolloverContainerRegistryCredentials.Unbind();
 }
 
 /** Shuts down a multiplayer server session. */
@@ -3200,9 +2746,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ShutdownMultiplayerServer(FMulti
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3216,26 +2760,15 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::ShutdownMultiplayerServer(FMulti
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Region.IsEmpty() || request.Region == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Region"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Region"), request.Region);
-    }
-    if (request.SessionId.IsEmpty() || request.SessionId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SessionId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SessionId"), request.SessionId);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("Region"), request.Region);
+    RequestWriter.WriteStringOrNull(TEXT("SessionId"), request.SessionId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3251,10 +2784,10 @@ void UPlayFabMultiplayerAPI::HelperShutdownMultiplayerServer(FPlayFabBaseModel r
     else if (!error.hasError && OnSuccessShutdownMultiplayerServer.IsBound())
     {
         FMultiplayerEmptyResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessShutdownMultiplayerServer.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessShutdownMultiplayerServer.Unbind();
 }
 
 /** Untags a container image. */
@@ -3264,9 +2797,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::UntagContainerImage(FMultiplayer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3280,21 +2811,14 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::UntagContainerImage(FMultiplayer
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.ImageName.IsEmpty() || request.ImageName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ImageName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ImageName"), request.ImageName);
-    }
-    if (request.Tag.IsEmpty() || request.Tag == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Tag"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Tag"), request.Tag);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringOrNull(TEXT("ImageName"), request.ImageName);
+    RequestWriter.WriteStringOrNull(TEXT("Tag"), request.Tag);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3310,10 +2834,10 @@ void UPlayFabMultiplayerAPI::HelperUntagContainerImage(FPlayFabBaseModel respons
     else if (!error.hasError && OnSuccessUntagContainerImage.IsBound())
     {
         FMultiplayerEmptyResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUntagContainerImage.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUntagContainerImage.Unbind();
 }
 
 /** Creates a multiplayer server build alias. */
@@ -3323,9 +2847,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::UpdateBuildAlias(FMultiplayerUpd
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3339,26 +2861,15 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::UpdateBuildAlias(FMultiplayerUpd
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.AliasId.IsEmpty() || request.AliasId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AliasId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AliasId"), request.AliasId);
-    }
-    if (request.AliasName.IsEmpty() || request.AliasName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AliasName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AliasName"), request.AliasName);
-    }
-    if (request.BuildSelectionCriteria.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildSelectionCriteria"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("BuildSelectionCriteria"), request.BuildSelectionCriteria);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("AliasId"), request.AliasId);
+    RequestWriter.WriteStringOrNull(TEXT("AliasName"), request.AliasName);
+    RequestWriter.WriteObjectArray(TEXT("BuildSelectionCriteria"), request.BuildSelectionCriteria);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3374,10 +2885,10 @@ void UPlayFabMultiplayerAPI::HelperUpdateBuildAlias(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessUpdateBuildAlias.IsBound())
     {
         FMultiplayerBuildAliasDetailsResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeBuildAliasDetailsResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateBuildAlias.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateBuildAlias.Unbind();
 }
 
 /** Updates a multiplayer server build's name. */
@@ -3387,9 +2898,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::UpdateBuildName(FMultiplayerUpda
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3403,21 +2912,14 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::UpdateBuildName(FMultiplayerUpda
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.BuildName.IsEmpty() || request.BuildName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildName"), request.BuildName);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
+    RequestWriter.WriteStringOrNull(TEXT("BuildName"), request.BuildName);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3433,10 +2935,10 @@ void UPlayFabMultiplayerAPI::HelperUpdateBuildName(FPlayFabBaseModel response, U
     else if (!error.hasError && OnSuccessUpdateBuildName.IsBound())
     {
         FMultiplayerEmptyResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateBuildName.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateBuildName.Unbind();
 }
 
 /** Updates a multiplayer server build's region. If the region is not yet created, it will be created */
@@ -3446,9 +2948,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::UpdateBuildRegion(FMultiplayerUp
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3462,17 +2962,14 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::UpdateBuildRegion(FMultiplayerUp
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.BuildRegion != nullptr) OutRestJsonObj->SetObjectField(TEXT("BuildRegion"), request.BuildRegion);
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
+    RequestWriter.WriteObject(TEXT("BuildRegion"), request.BuildRegion);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3488,10 +2985,10 @@ void UPlayFabMultiplayerAPI::HelperUpdateBuildRegion(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessUpdateBuildRegion.IsBound())
     {
         FMultiplayerEmptyResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateBuildRegion.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateBuildRegion.Unbind();
 }
 
 /** Updates a multiplayer server build's regions. */
@@ -3501,9 +2998,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::UpdateBuildRegions(FMultiplayerU
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3517,21 +3012,14 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::UpdateBuildRegions(FMultiplayerU
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.BuildRegions.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildRegions"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("BuildRegions"), request.BuildRegions);
-    }
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteStringOrNull(TEXT("BuildId"), request.BuildId);
+    RequestWriter.WriteObjectArray(TEXT("BuildRegions"), request.BuildRegions);
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3547,10 +3035,10 @@ void UPlayFabMultiplayerAPI::HelperUpdateBuildRegions(FPlayFabBaseModel response
     else if (!error.hasError && OnSuccessUpdateBuildRegions.IsBound())
     {
         FMultiplayerEmptyResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUpdateBuildRegions.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUpdateBuildRegions.Unbind();
 }
 
 /** Uploads a multiplayer server game certificate. */
@@ -3560,9 +3048,7 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::UploadCertificate(FMultiplayerUp
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMultiplayerAPI* manager = NewObject<UPlayFabMultiplayerAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMultiplayerAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabMultiplayerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -3576,12 +3062,13 @@ UPlayFabMultiplayerAPI* UPlayFabMultiplayerAPI::UploadCertificate(FMultiplayerUp
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.GameCertificate != nullptr) OutRestJsonObj->SetObjectField(TEXT("GameCertificate"), request.GameCertificate);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("GameCertificate"), request.GameCertificate);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -3597,16 +3084,19 @@ void UPlayFabMultiplayerAPI::HelperUploadCertificate(FPlayFabBaseModel response,
     else if (!error.hasError && OnSuccessUploadCertificate.IsBound())
     {
         FMultiplayerEmptyResponse ResultStruct = UPlayFabMultiplayerModelDecoder::decodeEmptyResponseResponse(response.responseData);
-        ResultStruct.Request = RequestJsonObj;
+        ResultStruct.Request = GetRequestObject();
         OnSuccessUploadCertificate.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessUploadCertificate.Unbind();
 }
 
 
 
 void UPlayFabMultiplayerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
+    PlayFabCommon::FPlayFabCallCounters::EndCall(Request->GetURL());
+    PLAYFAB_TRACE_END(Wait, Request);
+
     // Be sure that we have no data from previous response
     ResetResponseData();
 
@@ -3615,6 +3105,14 @@ void UPlayFabMultiplayerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, F
         UE_LOG(LogPlayFab, Error, TEXT("The request object is invalid during OnProcessRequestComplete."));
         return;
     }
+
+    // The call is over however this returns; the result helpers run during the broadcast, before the proxy is cleared
+    // Only set up once the object is known to be valid, as an invalid one can't be trusted to go back to the pool
+    ON_SCOPE_EXIT
+    {
+        ReleaseToPool();
+    };
+
     if (!OnPlayFabResponse.IsBound())
     {
         UE_LOG(LogPlayFab, Error, TEXT("OnPlayFabResponse has come un-bound during OnProcessRequestComplete."));
@@ -3634,20 +3132,25 @@ void UPlayFabMultiplayerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, F
         myResponse.responseError.ErrorName = "Unable to contact server";
         myResponse.responseError.ErrorMessage = "Unable to contact server";
 
+        PLAYFAB_TRACE_SCOPE(Dispatch, Request);
         OnPlayFabResponse.Broadcast(myResponse, mCustomData, false);
 
         return;
     }
 
-    // Save response data as a string
-    ResponseContent = Response->GetContentAsString();
+    {
+        PLAYFAB_TRACE_SCOPE(Decode, Request);
+
+        // Save response data as a string
+        ResponseContent = Response->GetContentAsString();
 
-    // Save response code as int32
-    ResponseCode = Response->GetResponseCode();
+        // Save response code as int32
+        ResponseCode = Response->GetResponseCode();
 
-    // Try to deserialize data to JSON
-    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-    FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+        // Try to deserialize data to JSON
+        TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
+        FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+    }
 
     // Decide whether the request was successful
     bIsValidJsonResponse = bWasSuccessful && ResponseJsonObj->GetRootObject().IsValid();
@@ -3657,7 +3160,7 @@ void UPlayFabMultiplayerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, F
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
 
     // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
+    PlayFabCommon::FPlayFabRequestLog::LogResponse(Request, ResponseCode, Response->GetContent());
 
     myResponse.responseError.decodeError(ResponseJsonObj);
     myResponse.responseData = ResponseJsonObj;
@@ -3672,8 +3175,8 @@ void UPlayFabMultiplayerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, F
     }
 
     // Broadcast the result event
+    PLAYFAB_TRACE_SCOPE(Dispatch, Request);
     OnPlayFabResponse.Broadcast(myResponse, mCustomData, !myResponse.responseError.hasError);
-    pfSettings->ModifyPendingCallCount(-1);
 }
 
 void UPlayFabMultiplayerAPI::Activate()
@@ -3731,24 +3234,55 @@ void UPlayFabMultiplayerAPI::Activate()
     for (TMap<FString, FString>::TConstIterator It(RequestHeaders); It; ++It)
         HttpRequest->SetHeader(It.Key(), It.Value());
 
-    // Serialize data to json string
-    FString OutputString;
-    TSharedRef< TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    // Requests made by the generated functions are already serialized; one set with SetRequestObject is serialized here
+    if (RequestJsonObj != nullptr && RequestBody.Num() == 0)
+    {
+        PLAYFAB_TRACE_SCOPE(Serialize, HttpRequest);
+        FMemoryWriter BodyStream(RequestBody);
+        PlayFab::JsonUtf8Writer Writer = TJsonWriterFactory<TCHAR, PlayFab::FPlayFabCondensedUtf8PrintPolicy>::Create(&BodyStream);
+        FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    }
 
     // Set Json content
-    HttpRequest->SetContentAsString(OutputString);
+    HttpRequest->SetContent(RequestBody);
 
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
+    PlayFabCommon::FPlayFabRequestLog::LogRequest(HttpRequest, RequestBody);
 
     // Bind event
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabMultiplayerAPI::OnProcessRequestComplete);
 
     // Execute the request
-    pfSettings->ModifyPendingCallCount(1);
+    PlayFabCommon::FPlayFabCallCounters::BeginCall(RequestUrl);
+    PLAYFAB_TRACE_BEGIN(Wait, HttpRequest);
+    PLAYFAB_TRACE_SCOPE(Send, HttpRequest);
     HttpRequest->ProcessRequest();
 }
 
+void UPlayFabMultiplayerAPI::ReleaseToPool()
+{
+    // Clear everything the next call through this proxy would otherwise inherit
+    OnPlayFabResponse.Clear();
+    OnFailure.Unbind();
+    mCustomData = nullptr;
+    CallAuthenticationContext = nullptr;
+    PlayFabRequestURL.Reset();
+    useEntityToken = false;
+    useSecretKey = false;
+    useSessionTicket = false;
+    returnsSessionTicket = false;
+    returnsEntityToken = false;
+    RequestHeaders.Reset();
+    ResponseContent.Reset();
+    ResponseCode = 0;
+    bIsValidJsonResponse = false;
+
+    // The request object is the caller's, or was handed to the caller with the result, so it isn't recycled
+    RequestBody.Reset();
+    RequestJsonObj = nullptr;
+    // The response object is kept with the proxy, and cleared when its next response arrives
+    FPlayFabObjectPool::Release(this);
+}
+
 void UPlayFabMultiplayerAPI::ResetResponseData()
 {
     if (ResponseJsonObj != nullptr)
@@ -16,6 +16,12 @@
 #include "PlayFabEnums.h"
 #include "PlayFabCommon/Public/PlayFabAuthenticationContext.h"
 #include "PlayFabCommon/Public/PlayFabCommonUtils.h"
+#include "PlayFabCommon/Public/PlayFabCallCounters.h"
+#include "PlayFabCommon/Public/PlayFabTrace.h"
+#include "PlayFabCommon/Public/PlayFabRequestLog.h"
+#include "PlayFabObjectPool.h"
+#include "PlayFabRequestWriter.h"
+#include "Misc/ScopeExit.h"
 
 UPlayFabProfilesAPI::UPlayFabProfilesAPI(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -30,7 +36,26 @@ void UPlayFabProfilesAPI::SetCallAuthenticationContext(UPlayFabAuthenticationCon
 
 void UPlayFabProfilesAPI::SetRequestObject(UPlayFabJsonObject* JsonObject)
 {
+    // The object replaces any body serialized before, and is serialized in Activate
     RequestJsonObj = JsonObject;
+    RequestBody.Reset();
+}
+
+void UPlayFabProfilesAPI::SetRequestBody(TArray<uint8>&& Body)
+{
+    RequestBody = MoveTemp(Body);
+    RequestJsonObj = nullptr;
+}
+
+UPlayFabJsonObject* UPlayFabProfilesAPI::GetRequestObject()
+{
+    if (RequestJsonObj == nullptr && RequestBody.Num() > 0)
+    {
+        // Only the few results that hand the request back to Blueprint pay for parsing it
+        RequestJsonObj = NewObject<UPlayFabJsonObject>();
+        RequestJsonObj->DecodeJson(FPlayFabRequestWriter::ToString(RequestBody));
+    }
+    return RequestJsonObj;
 }
 
 UPlayFabJsonObject* UPlayFabProfilesAPI::GetResponseObject()
@@ -40,31 +65,7 @@ UPlayFabJsonObject* UPlayFabProfilesAPI::GetResponseObject()
 
 FString UPlayFabProfilesAPI::PercentEncode(const FString& Text)
 {
-    FString OutText = Text;
-
-    OutText = OutText.Replace(TEXT("!"), TEXT("%21"));
-    OutText = OutText.Replace(TEXT("\""), TEXT("%22"));
-    OutText = OutText.Replace(TEXT("#"), TEXT("%23"));
-    OutText = OutText.Replace(TEXT("$"), TEXT("%24"));
-    //OutText = OutText.Replace(TEXT("&"), TEXT("%26"));
-    OutText = OutText.Replace(TEXT("'"), TEXT("%27"));
-    OutText = OutText.Replace(TEXT("("), TEXT("%28"));
-    OutText = OutText.Replace(TEXT(")"), TEXT("%29"));
-    OutText = OutText.Replace(TEXT("*"), TEXT("%2A"));
-    OutText = OutText.Replace(TEXT("+"), TEXT("%2B"));
-    OutText = OutText.Replace(TEXT(","), TEXT("%2C"));
-    //OutText = OutText.Replace(TEXT("/"), TEXT("%2F"));
-    OutText = OutText.Replace(TEXT(":"), TEXT("%3A"));
-    OutText = OutText.Replace(TEXT(";"), TEXT("%3B"));
-    OutText = OutText.Replace(TEXT("="), TEXT("%3D"));
-    //OutText = OutText.Replace(TEXT("?"), TEXT("%3F"));
-    OutText = OutText.Replace(TEXT("@"), TEXT("%40"));
-    OutText = OutText.Replace(TEXT("["), TEXT("%5B"));
-    OutText = OutText.Replace(TEXT("]"), TEXT("%5D"));
-    OutText = OutText.Replace(TEXT("{"), TEXT("%7B"));
-    OutText = OutText.Replace(TEXT("}"), TEXT("%7D"));
-
-    return OutText;
+    return PlayFabCommon::PlayFabCommonUtils::PercentEncode(Text);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -82,9 +83,7 @@ UPlayFabProfilesAPI* UPlayFabProfilesAPI::GetGlobalPolicy(FProfilesGetGlobalPoli
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabProfilesAPI* manager = NewObject<UPlayFabProfilesAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabProfilesAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabProfilesAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -98,11 +97,12 @@ UPlayFabProfilesAPI* UPlayFabProfilesAPI::GetGlobalPolicy(FProfilesGetGlobalPoli
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -120,7 +120,7 @@ void UPlayFabProfilesAPI::HelperGetGlobalPolicy(FPlayFabBaseModel response, UObj
         FProfilesGetGlobalPolicyResponse ResultStruct = UPlayFabProfilesModelDecoder::decodeGetGlobalPolicyResponseResponse(response.responseData);
         OnSuccessGetGlobalPolicy.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetGlobalPolicy.Unbind();
 }
 
 /** Retrieves the entity's profile. */
@@ -130,9 +130,7 @@ UPlayFabProfilesAPI* UPlayFabProfilesAPI::GetProfile(FProfilesGetEntityProfileRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabProfilesAPI* manager = NewObject<UPlayFabProfilesAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabProfilesAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabProfilesAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -146,13 +144,14 @@ UPlayFabProfilesAPI* UPlayFabProfilesAPI::GetProfile(FProfilesGetEntityProfileRe
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("DataAsObject"), request.DataAsObject);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("DataAsObject"), request.DataAsObject);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -170,7 +169,7 @@ void UPlayFabProfilesAPI::HelperGetProfile(FPlayFabBaseModel response, UObject*
         FProfilesGetEntityProfileResponse ResultStruct = UPlayFabProfilesModelDecoder::decodeGetEntityProfileResponseResponse(response.responseData);
         OnSuccessGetProfile.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetProfile.Unbind();
 }
 
 /** Retrieves the entity's profile. */
@@ -180,9 +179,7 @@ UPlayFabProfilesAPI* UPlayFabProfilesAPI::GetProfiles(FProfilesGetEntityProfiles
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabProfilesAPI* manager = NewObject<UPlayFabProfilesAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabProfilesAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabProfilesAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -196,17 +193,14 @@ UPlayFabProfilesAPI* UPlayFabProfilesAPI::GetProfiles(FProfilesGetEntityProfiles
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    OutRestJsonObj->SetBoolField(TEXT("DataAsObject"), request.DataAsObject);
-    if (request.Entities.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Entities"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Entities"), request.Entities);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteBool(TEXT("DataAsObject"), request.DataAsObject);
+    RequestWriter.WriteObjectArray(TEXT("Entities"), request.Entities);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -224,7 +218,7 @@ void UPlayFabProfilesAPI::HelperGetProfiles(FPlayFabBaseModel response, UObject*
         FProfilesGetEntityProfilesResponse ResultStruct = UPlayFabProfilesModelDecoder::decodeGetEntityProfilesResponseResponse(response.responseData);
         OnSuccessGetProfiles.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetProfiles.Unbind();
 }
 
 /** Retrieves the title player accounts associated with the given master player account. */
@@ -234,9 +228,7 @@ UPlayFabProfilesAPI* UPlayFabProfilesAPI::GetTitlePlayersFromMasterPlayerAccount
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabProfilesAPI* manager = NewObject<UPlayFabProfilesAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabProfilesAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabProfilesAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -250,20 +242,14 @@ UPlayFabProfilesAPI* UPlayFabProfilesAPI::GetTitlePlayersFromMasterPlayerAccount
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    // Check to see if string is empty
-    if (request.MasterPlayerAccountIds.IsEmpty() || request.MasterPlayerAccountIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("MasterPlayerAccountIds"));
-    } else {
-        TArray<FString> MasterPlayerAccountIdsArray;
-        FString(request.MasterPlayerAccountIds).ParseIntoArray(MasterPlayerAccountIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("MasterPlayerAccountIds"), MasterPlayerAccountIdsArray);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteStringArray(TEXT("MasterPlayerAccountIds"), request.MasterPlayerAccountIds);
+    RequestWriter.WriteString(TEXT("TitleId"), GetDefault<UPlayFabRuntimeSettings>()->TitleId);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -281,7 +267,7 @@ void UPlayFabProfilesAPI::HelperGetTitlePlayersFromMasterPlayerAccountIds(FPlayF
         FProfilesGetTitlePlayersFromMasterPlayerAccountIdsResponse ResultStruct = UPlayFabProfilesModelDecoder::decodeGetTitlePlayersFromMasterPlayerAccountIdsResponseResponse(response.responseData);
         OnSuccessGetTitlePlayersFromMasterPlayerAccountIds.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessGetTitlePlayersFromMasterPlayerAccountIds.Unbind();
 }
 
 /** Sets the global title access policy  */
@@ -291,9 +277,7 @@ UPlayFabProfilesAPI* UPlayFabProfilesAPI::SetGlobalPolicy(FProfilesSetGlobalPoli
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabProfilesAPI* manager = NewObject<UPlayFabProfilesAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabProfilesAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabProfilesAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -307,16 +291,13 @@ UPlayFabProfilesAPI* UPlayFabProfilesAPI::SetGlobalPolicy(FProfilesSetGlobalPoli
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Permissions.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Permissions"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Permissions"), request.Permissions);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObjectArray(TEXT("Permissions"), request.Permissions);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -334,7 +315,7 @@ void UPlayFabProfilesAPI::HelperSetGlobalPolicy(FPlayFabBaseModel response, UObj
         FProfilesSetGlobalPolicyResponse ResultStruct = UPlayFabProfilesModelDecoder::decodeSetGlobalPolicyResponseResponse(response.responseData);
         OnSuccessSetGlobalPolicy.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetGlobalPolicy.Unbind();
 }
 
 /** Updates the entity's language. The precedence hierarchy for communication to the player is Title Player Account language, Master Player Account language, and then title default language if the first two aren't set or supported. */
@@ -344,9 +325,7 @@ UPlayFabProfilesAPI* UPlayFabProfilesAPI::SetProfileLanguage(FProfilesSetProfile
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabProfilesAPI* manager = NewObject<UPlayFabProfilesAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabProfilesAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabProfilesAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -360,18 +339,15 @@ UPlayFabProfilesAPI* UPlayFabProfilesAPI::SetProfileLanguage(FProfilesSetProfile
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    OutRestJsonObj->SetNumberField(TEXT("ExpectedVersion"), request.ExpectedVersion);
-    if (request.Language.IsEmpty() || request.Language == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Language"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Language"), request.Language);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteNumber(TEXT("ExpectedVersion"), request.ExpectedVersion);
+    RequestWriter.WriteStringOrNull(TEXT("Language"), request.Language);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -389,7 +365,7 @@ void UPlayFabProfilesAPI::HelperSetProfileLanguage(FPlayFabBaseModel response, U
         FProfilesSetProfileLanguageResponse ResultStruct = UPlayFabProfilesModelDecoder::decodeSetProfileLanguageResponseResponse(response.responseData);
         OnSuccessSetProfileLanguage.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetProfileLanguage.Unbind();
 }
 
 /** Sets the profiles access policy */
@@ -399,9 +375,7 @@ UPlayFabProfilesAPI* UPlayFabProfilesAPI::SetProfilePolicy(FProfilesSetEntityPro
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabProfilesAPI* manager = NewObject<UPlayFabProfilesAPI>();
-    if (manager->IsSafeForRootSet()) manager->AddToRoot();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabProfilesAPI* manager = FPlayFabObjectPool::Acquire<UPlayFabProfilesAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
@@ -415,17 +389,14 @@ UPlayFabProfilesAPI* UPlayFabProfilesAPI::SetProfilePolicy(FProfilesSetEntityPro
     manager->useEntityToken = true;
 
 
-    // Serialize all the request properties to json
-    if (request.CustomTags != nullptr) OutRestJsonObj->SetObjectField(TEXT("CustomTags"), request.CustomTags);
-    if (request.Entity != nullptr) OutRestJsonObj->SetObjectField(TEXT("Entity"), request.Entity);
-    if (request.Statements.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Statements"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Statements"), request.Statements);
-    }
+    // Serialize all the request properties straight to the request body
+    FPlayFabRequestWriter RequestWriter;
+    RequestWriter.WriteObject(TEXT("CustomTags"), request.CustomTags);
+    RequestWriter.WriteObject(TEXT("Entity"), request.Entity);
+    RequestWriter.WriteObjectArray(TEXT("Statements"), request.Statements);
 
     // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->SetRequestBody(RequestWriter.Finish());
 
     return manager;
 }
@@ -443,13 +414,16 @@ void UPlayFabProfilesAPI::HelperSetProfilePolicy(FPlayFabBaseModel response, UOb
         FProfilesSetEntityProfilePolicyResponse ResultStruct = UPlayFabProfilesModelDecoder::decodeSetEntityProfilePolicyResponseResponse(response.responseData);
         OnSuccessSetProfilePolicy.Execute(ResultStruct, mCustomData);
     }
-    this->RemoveFromRoot();
+    OnSuccessSetProfilePolicy.Unbind();
 }
 
 
 
 void UPlayFabProfilesAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
+    PlayFabCommon::FPlayFabCallCounters::EndCall(Request->GetURL());
+    PLAYFAB_TRACE_END(Wait, Request);
+
     // Be sure that we have no data from previous response
     ResetResponseData();
 
@@ -458,6 +432,14 @@ void UPlayFabProfilesAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHtt
         UE_LOG(LogPlayFab, Error, TEXT("The request object is invalid during OnProcessRequestComplete."));
         return;
     }
+
+    // The call is over however this returns; the result helpers run during the broadcast, before the proxy is cleared
+    // Only set up once the object is known to be valid, as an invalid one can't be trusted to go back to the pool
+    ON_SCOPE_EXIT
+    {
+        ReleaseToPool();
+    };
+
     if (!OnPlayFabResponse.IsBound())
     {
         UE_LOG(LogPlayFab, Error, TEXT("OnPlayFabResponse has come un-bound during OnProcessRequestComplete."));
@@ -477,20 +459,25 @@ void UPlayFabProfilesAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHtt
         myResponse.responseError.ErrorName = "Unable to contact server";
         myResponse.responseError.ErrorMessage = "Unable to contact server";
 
+        PLAYFAB_TRACE_SCOPE(Dispatch, Request);
         OnPlayFabResponse.Broadcast(myResponse, mCustomData, false);
 
         return;
     }
 
-    // Save response data as a string
-    ResponseContent = Response->GetContentAsString();
+    {
+        PLAYFAB_TRACE_SCOPE(Decode, Request);
 
-    // Save response code as int32
-    ResponseCode = Response->GetResponseCode();
+        // Save response data as a string
+        ResponseContent = Response->GetContentAsString();
 
-    // Try to deserialize data to JSON
-    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-    FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+        // Save response code as int32
+        ResponseCode = Response->GetResponseCode();
+
+        // Try to deserialize data to JSON
+        TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
+        FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
+    }
 
     // Decide whether the request was successful
     bIsValidJsonResponse = bWasSuccessful && ResponseJsonObj->GetRootObject().IsValid();
@@ -500,7 +487,7 @@ void UPlayFabProfilesAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHtt
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
 
     // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
+    PlayFabCommon::FPlayFabRequestLog::LogResponse(Request, ResponseCode, Response->GetContent());
 
     myResponse.responseError.decodeError(ResponseJsonObj);
     myResponse.responseData = ResponseJsonObj;
@@ -515,8 +502,8 @@ void UPlayFabProfilesAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHtt
     }
 
     // Broadcast the result event
+    PLAYFAB_TRACE_SCOPE(Dispatch, Request);
     OnPlayFabResponse.Broadcast(myResponse, mCustomData, !myResponse.responseError.hasError);
-    pfSettings->ModifyPendingCallCount(-1);
 }
 
 void UPlayFabProfilesAPI::Activate()
@@ -574,24 +561,55 @@ void UPlayFabProfilesAPI::Activate()
     for (TMap<FString, FString>::TConstIterator It(RequestHeaders); It; ++It)
         HttpRequest->SetHeader(It.Key(), It.Value());
 
-    // Serialize data to json string
-    FString OutputString;
-    TSharedRef< TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    // Requests made by the generated functions are already serialized; one set with SetRequestObject is serialized here
+    if (RequestJsonObj != nullptr && RequestBody.Num() == 0)
+    {
+        PLAYFAB_TRACE_SCOPE(Serialize, HttpRequest);
+        FMemoryWriter BodyStream(RequestBody);
+        PlayFab::JsonUtf8Writer Writer = TJsonWriterFactory<TCHAR, PlayFab::FPlayFabCondensedUtf8PrintPolicy>::Create(&BodyStream);
+        FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
+    }
 
     // Set Json content
-    HttpRequest->SetContentAsString(OutputString);
+    HttpRequest->SetContent(RequestBody);
 
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
+    PlayFabCommon::FPlayFabRequestLog::LogRequest(HttpRequest, RequestBody);
 
     // Bind event
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabProfilesAPI::OnProcessRequestComplete);
 
     // Execute the request
-    pfSettings->ModifyPendingCallCount(1);
+    PlayFabCommon::FPlayFabCallCounters::BeginCall(RequestUrl);
+    PLAYFAB_TRACE_BEGIN(Wait, HttpRequest);
+    PLAYFAB_TRACE_SCOPE(Send, HttpRequest);
     HttpRequest->ProcessRequest();
 }
 
+void UPlayFabProfilesAPI::ReleaseToPool()
+{
+    // Clear everything the next call through this proxy would otherwise inherit
+    OnPlayFabResponse.Clear();
+    OnFailure.Unbind();
+    mCustomData = nullptr;
+    CallAuthenticationContext = nullptr;
+    PlayFabRequestURL.Reset();
+    useEntityToken = false;
+    useSecretKey = false;
+    useSessionTicket = false;
+    returnsSessionTicket = false;
+    returnsEntityToken = false;
+    RequestHeaders.Reset();
+    ResponseContent.Reset();
+    ResponseCode = 0;
+    bIsValidJsonResponse = false;
+
+    // The request object is the caller's, or was handed to the caller with the result, so it isn't recycled
+    RequestBody.Reset();
+    RequestJsonObj = nullptr;
+    // The response object is kept with the proxy, and cleared when its next response arrives
+    FPlayFabObjectPool::Release(this);
+}
+
 void UPlayFabProfilesAPI::ResetResponseData()
 {
     if (ResponseJsonObj != nullptr)
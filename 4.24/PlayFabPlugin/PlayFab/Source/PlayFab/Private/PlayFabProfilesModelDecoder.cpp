@@ -11,6 +11,7 @@
 
 #include "PlayFabProfilesModelDecoder.h"
 #include "PlayFabPrivate.h"
+#include "PlayFabJsonDecoder.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Profiles API Functions
@@ -25,9 +26,9 @@ FProfilesGetGlobalPolicyResponse UPlayFabProfilesModelDecoder::decodeGetGlobalPo
 {
     // Temp ustruct
     FProfilesGetGlobalPolicyResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Permissions = !(dataObj->HasField("Permissions")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Permissions");
+    tempStruct.Permissions = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Permissions"));
 
     return tempStruct;
 }
@@ -36,9 +37,9 @@ FProfilesGetEntityProfileResponse UPlayFabProfilesModelDecoder::decodeGetEntityP
 {
     // Temp ustruct
     FProfilesGetEntityProfileResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Profile = !(dataObj->HasField("Profile")) ? nullptr : dataObj->GetObjectField("Profile");
+    tempStruct.Profile = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Profile"));
 
     return tempStruct;
 }
@@ -47,9 +48,9 @@ FProfilesGetEntityProfilesResponse UPlayFabProfilesModelDecoder::decodeGetEntity
 {
     // Temp ustruct
     FProfilesGetEntityProfilesResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Profiles = !(dataObj->HasField("Profiles")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Profiles");
+    tempStruct.Profiles = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Profiles"));
 
     return tempStruct;
 }
@@ -58,10 +59,10 @@ FProfilesGetTitlePlayersFromMasterPlayerAccountIdsResponse UPlayFabProfilesModel
 {
     // Temp ustruct
     FProfilesGetTitlePlayersFromMasterPlayerAccountIdsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.TitleId = !(dataObj->HasField("TitleId")) ? TEXT("") : dataObj->GetStringField("TitleId");
-    tempStruct.TitlePlayerAccounts = !(dataObj->HasField("TitlePlayerAccounts")) ? nullptr : dataObj->GetObjectField("TitlePlayerAccounts");
+    tempStruct.TitleId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("TitleId"));
+    tempStruct.TitlePlayerAccounts = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("TitlePlayerAccounts"));
 
     return tempStruct;
 }
@@ -79,10 +80,10 @@ FProfilesSetProfileLanguageResponse UPlayFabProfilesModelDecoder::decodeSetProfi
 {
     // Temp ustruct
     FProfilesSetProfileLanguageResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    GetEnumValueFromString<EOperationTypes>(TEXT("EOperationTypes"), dataObj->GetStringField("OperationResult"), tempStruct.OperationResult);
-    tempStruct.VersionNumber = !(dataObj->HasField("VersionNumber")) ? 0 : int(dataObj->GetNumberField("VersionNumber"));
+    GetEnumValueFromString<EOperationTypes>(TEXT("EOperationTypes"), FPlayFabJsonDecoder::GetString(dataObj, TEXT("OperationResult")), tempStruct.OperationResult);
+    tempStruct.VersionNumber = FPlayFabJsonDecoder::GetNumber(dataObj, TEXT("VersionNumber"));
 
     return tempStruct;
 }
@@ -91,9 +92,9 @@ FProfilesSetEntityProfilePolicyResponse UPlayFabProfilesModelDecoder::decodeSetE
 {
     // Temp ustruct
     FProfilesSetEntityProfilePolicyResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Permissions = !(dataObj->HasField("Permissions")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Permissions");
+    tempStruct.Permissions = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Permissions"));
 
     return tempStruct;
 }
@@ -7,6 +7,7 @@
 
 #include "Modules/ModuleManager.h"
 #include "PlayFabCommon.h"
+#include "PlayFabCallCounters.h"
 
 /**
 * The public interface to this module.  In most cases, this interface is only public to sibling modules
@@ -108,22 +109,15 @@ public:
         return IPlayFabCommonModuleInterface::Get().GeneratePfUrl(urlPath);
     }
 
-    inline int32 GetPendingCallCount()
+    // Number of PlayFab calls in flight, see PlayFabCommon::FPlayFabCallCounters for per-API and per-endpoint counts
+    inline int32 GetPendingCallCount() const
     {
-        int32 output;
-        pendingCallLock.Lock();
-        output = pendingCalls;
-        pendingCallLock.Unlock();
-        return output;
+        return PlayFabCommon::FPlayFabCallCounters::GetTotalStats().InFlight;
     }
+
+    UE_DEPRECATED(4.23, "Calls are counted by the SDK, see PlayFabCommon::FPlayFabCallCounters")
     inline void ModifyPendingCallCount(int32 delta)
     {
-        pendingCallLock.Lock();
-        pendingCalls += delta;
-        pendingCallLock.Unlock();
+        PlayFabCommon::FPlayFabCallCounters::ModifyTotal(delta);
     }
-
-private:
-    FCriticalSection pendingCallLock;
-    int32 pendingCalls;
 };
@@ -0,0 +1,167 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabRequestLog.h"
+#include "PlayFabCommon/Public/PlayFabRuntimeSettings.h"
+#include "PlayFabTrace.h"
+
+DEFINE_LOG_CATEGORY(LogPlayFabRequests);
+
+using namespace PlayFabCommon;
+
+namespace
+{
+    // Index of the quote that closes the string opening at Start, or the end of the text when it isn't closed
+    int32 FindStringEnd(const FString& Json, int32 Start)
+    {
+        for (int32 Index = Start + 1; Index < Json.Len(); ++Index)
+        {
+            if (Json[Index] == TEXT('\\'))
+            {
+                ++Index;
+            }
+            else if (Json[Index] == TEXT('"'))
+            {
+                return Index;
+            }
+        }
+        return Json.Len() - 1;
+    }
+
+    int32 SkipWhitespace(const FString& Json, int32 Index)
+    {
+        while (Index < Json.Len() && FChar::IsWhitespace(Json[Index]))
+        {
+            ++Index;
+        }
+        return Index;
+    }
+
+    bool IsRedacted(const TCHAR* Key, int32 KeyLen, const TArray<FString>& Fields)
+    {
+        for (const FString& Field : Fields)
+        {
+            if (Field.Len() == KeyLen && FCString::Strnicmp(*Field, Key, KeyLen) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+bool FPlayFabRequestLog::ShouldLog(const FHttpRequestPtr& Request)
+{
+#if NO_LOGGING
+    return false;
+#else
+    if (!UE_LOG_ACTIVE(LogPlayFabRequests, Verbose) || !Request.IsValid())
+    {
+        return false;
+    }
+
+    const float SampleRate = GetDefault<UPlayFabRuntimeSettings>()->RequestLogSampleRate;
+    if (SampleRate >= 1.0f)
+    {
+        return true;
+    }
+
+    // Sampled on a hash of the request id, so that a request and its response are either both logged or both skipped
+    uint64 Hash = FPlayFabTrace::GetRequestId(Request);
+    Hash ^= Hash >> 33;
+    Hash *= 0xff51afd7ed558ccdull;
+    Hash ^= Hash >> 33;
+    return (Hash % 10000) < (uint64)(SampleRate * 10000.0f);
+#endif
+}
+
+void FPlayFabRequestLog::LogRequest(const FHttpRequestPtr& Request, const TArray<uint8>& Body)
+{
+    if (!ShouldLog(Request))
+    {
+        return;
+    }
+
+    UE_LOG(LogPlayFabRequests, Verbose, TEXT("Request %llu %s: %d bytes"), FPlayFabTrace::GetRequestId(Request), *Request->GetURL(), Body.Num());
+    UE_LOG(LogPlayFabRequests, VeryVerbose, TEXT("Request %llu body: %s"), FPlayFabTrace::GetRequestId(Request), *FormatBody(Body));
+}
+
+void FPlayFabRequestLog::LogRequest(const FHttpRequestPtr& Request, const FString& Body)
+{
+    if (!ShouldLog(Request))
+    {
+        return;
+    }
+
+    FTCHARToUTF8 Utf8Body(*Body);
+    LogRequest(Request, TArray<uint8>((const uint8*)Utf8Body.Get(), Utf8Body.Length()));
+}
+
+void FPlayFabRequestLog::LogResponse(const FHttpRequestPtr& Request, int32 ResponseCode, const TArray<uint8>& Body)
+{
+    if (!ShouldLog(Request))
+    {
+        return;
+    }
+
+    UE_LOG(LogPlayFabRequests, Verbose, TEXT("Response %llu %s: %d in %.3f seconds, %d bytes"), FPlayFabTrace::GetRequestId(Request), *Request->GetURL(), ResponseCode, Request->GetElapsedTime(), Body.Num());
+    UE_LOG(LogPlayFabRequests, VeryVerbose, TEXT("Response %llu body: %s"), FPlayFabTrace::GetRequestId(Request), *FormatBody(Body));
+}
+
+FString FPlayFabRequestLog::Redact(const FString& Json)
+{
+    const TArray<FString>& Fields = GetDefault<UPlayFabRuntimeSettings>()->RequestLogRedactedFields;
+    if (Fields.Num() == 0)
+    {
+        return Json;
+    }
+
+    FString Result;
+    Result.Reserve(Json.Len());
+    int32 Index = 0;
+    while (Index < Json.Len())
+    {
+        if (Json[Index] != TEXT('"'))
+        {
+            Result.AppendChar(Json[Index++]);
+            continue;
+        }
+
+        const int32 KeyEnd = FindStringEnd(Json, Index);
+        Result.AppendChars(*Json + Index, KeyEnd - Index + 1);
+        const TCHAR* Key = *Json + Index + 1;
+        const int32 KeyLen = KeyEnd - Index - 1;
+        Index = KeyEnd + 1;
+
+        // A string followed by a colon is a field name; only string values are redacted, objects and numbers are left to be scanned
+        const int32 Colon = SkipWhitespace(Json, Index);
+        if (Colon < Json.Len() && Json[Colon] == TEXT(':') && IsRedacted(Key, KeyLen, Fields))
+        {
+            const int32 Value = SkipWhitespace(Json, Colon + 1);
+            if (Value < Json.Len() && Json[Value] == TEXT('"'))
+            {
+                Result.AppendChars(*Json + Index, Value - Index);
+                Result += TEXT("\"***\"");
+                Index = FindStringEnd(Json, Value) + 1;
+            }
+        }
+    }
+    return Result;
+}
+
+FString FPlayFabRequestLog::FormatBody(const TArray<uint8>& Body)
+{
+    // Redacted before it is cut off, so that a secret can't be logged in part
+    FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Body.GetData()), Body.Num());
+    FString Text = Redact(FString(Converter.Length(), Converter.Get()));
+
+    // Cut at the same count of characters, which never take fewer bytes
+    const int32 MaxBytes = GetDefault<UPlayFabRuntimeSettings>()->RequestLogMaxBodyBytes;
+    if (MaxBytes > 0 && Text.Len() > MaxBytes)
+    {
+        Text = FString::Printf(TEXT("%s... (%d bytes)"), *Text.Left(MaxBytes), Body.Num());
+    }
+    return Text;
+}
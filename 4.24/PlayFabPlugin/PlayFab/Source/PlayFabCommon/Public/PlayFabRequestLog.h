@@ -0,0 +1,38 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+
+// Verbose logs one line per sampled request and response, VeryVerbose adds their bodies: "log LogPlayFabRequests VeryVerbose"
+PLAYFABCOMMON_API DECLARE_LOG_CATEGORY_EXTERN(LogPlayFabRequests, Log, All);
+
+namespace PlayFabCommon
+{
+    /**
+     * Request and response logging shared by the Blueprint and C++ SDKs.
+     * Nothing is formatted unless LogPlayFabRequests is at Verbose or higher and the request falls in UPlayFabRuntimeSettings::RequestLogSampleRate.
+     * Logged bodies have the string values of RequestLogRedactedFields replaced, and are cut off after RequestLogMaxBodyBytes.
+     */
+    class PLAYFABCOMMON_API FPlayFabRequestLog
+    {
+    public:
+        // Check this before fetching a body that costs anything to produce; the Log functions check it themselves
+        static bool ShouldLog(const FHttpRequestPtr& Request);
+
+        // Bodies are the uncompressed UTF-8 json
+        static void LogRequest(const FHttpRequestPtr& Request, const TArray<uint8>& Body);
+        static void LogRequest(const FHttpRequestPtr& Request, const FString& Body);
+        static void LogResponse(const FHttpRequestPtr& Request, int32 ResponseCode, const TArray<uint8>& Body);
+
+        // Replaces the string value of every redacted field in a json document, at any depth, with "***"
+        static FString Redact(const FString& Json);
+
+    private:
+        static FString FormatBody(const TArray<uint8>& Body);
+    };
+}
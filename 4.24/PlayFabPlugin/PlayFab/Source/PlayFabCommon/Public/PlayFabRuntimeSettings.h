@@ -8,6 +8,39 @@
 #include "CoreMinimal.h"
 #include "PlayFabRuntimeSettings.generated.h"
 
+/**
+* Rate and concurrency limits applied to one PlayFab endpoint by the C++ request governor
+*/
+USTRUCT()
+struct PLAYFABCOMMON_API FPlayFabEndpointLimit
+{
+    GENERATED_BODY()
+
+    // Sustained calls per second; zero or less removes the rate limit
+    UPROPERTY(EditAnywhere, Category = Limits)
+    float RequestsPerSecond = 10.0f;
+
+    // Calls that may be sent back to back before the rate limit applies
+    UPROPERTY(EditAnywhere, Category = Limits, meta = (ClampMin = "1"))
+    int32 BurstSize = 10;
+
+    // Calls that may wait for a response at the same time; zero or less removes the limit
+    UPROPERTY(EditAnywhere, Category = Limits)
+    int32 MaxInFlight = 8;
+};
+
+/**
+* Thread on which the C++ API runs result delegates, once a response has been decoded
+*/
+UENUM()
+enum class EPlayFabResponseDispatch : uint8
+{
+    // Delegates run on the game thread
+    GameThread,
+    // Delegates run on whichever thread decoded the response; they must be safe to run off the game thread
+    AnyThread
+};
+
 /**
 * Implements the settings for the PlayFab plugin in the Unreal GUI
 * This ends up being more like "build time constants", as they can't be changed at runtime
@@ -30,4 +63,133 @@ public:
     // Secret Key, Do not add this to the clients!
     UPROPERTY(EditAnywhere, config, Category = Settings)
     FString DeveloperSecretKey;
+
+    // Retry read-only C++ calls that were throttled or failed in transit, before reporting the error to the game. Other calls are never sent twice
+    UPROPERTY(EditAnywhere, config, Category = Retries)
+    bool bEnableAutomaticRetries;
+
+    // Number of retries after the first attempt
+    UPROPERTY(EditAnywhere, config, Category = Retries, meta = (ClampMin = "0", EditCondition = "bEnableAutomaticRetries"))
+    int32 MaxRetryAttempts;
+
+    // Backoff before the first retry; it doubles with each further retry, and a random jitter is applied
+    UPROPERTY(EditAnywhere, config, Category = Retries, meta = (ClampMin = "0", EditCondition = "bEnableAutomaticRetries"))
+    float RetryBaseDelaySeconds;
+
+    // Upper bound on the backoff. Errors that ask for a longer wait than this are reported instead of retried
+    UPROPERTY(EditAnywhere, config, Category = Retries, meta = (ClampMin = "0", EditCondition = "bEnableAutomaticRetries"))
+    float RetryMaxDelaySeconds;
+
+    // Retries each title may spend per minute, so that an outage can't turn into a retry storm
+    UPROPERTY(EditAnywhere, config, Category = Retries, meta = (ClampMin = "0", EditCondition = "bEnableAutomaticRetries"))
+    int32 RetryBudgetPerMinute;
+
+    // Queue C++ calls that exceed the rate or concurrency limit of their endpoint, instead of sending them right away
+    UPROPERTY(EditAnywhere, config, Category = Throttling)
+    bool bEnableRequestGovernor;
+
+    // Limits of every endpoint that has no entry in EndpointLimits
+    UPROPERTY(EditAnywhere, config, Category = Throttling, meta = (EditCondition = "bEnableRequestGovernor"))
+    FPlayFabEndpointLimit DefaultEndpointLimit;
+
+    // Limits of specific endpoints, keyed by path, such as "/Client/UpdatePlayerStatistics"
+    UPROPERTY(EditAnywhere, config, Category = Throttling, meta = (EditCondition = "bEnableRequestGovernor"))
+    TMap<FString, FPlayFabEndpointLimit> EndpointLimits;
+
+    // Let identical C++ read calls that overlap share one request, instead of each sending their own
+    UPROPERTY(EditAnywhere, config, Category = Throttling)
+    bool bEnableRequestCoalescing;
+
+    // Gzip C++ request bodies, and ask for gzip responses
+    UPROPERTY(EditAnywhere, config, Category = Compression)
+    bool bCompressApiData;
+
+    // Request bodies smaller than this are sent uncompressed, as compressing them saves little
+    UPROPERTY(EditAnywhere, config, Category = Compression, meta = (ClampMin = "0", EditCondition = "bCompressApiData"))
+    int32 CompressionThresholdBytes;
+
+    // Largest size a gzip response may claim to decompress to; larger ones are reported as errors instead of being allocated
+    UPROPERTY(EditAnywhere, config, Category = Compression, meta = (ClampMin = "1024", EditCondition = "bCompressApiData"))
+    int32 MaxDecompressedResponseBytes;
+
+    // Decode C++ call responses on a task graph worker, so that large payloads don't hitch the thread that completed the request
+    UPROPERTY(EditAnywhere, config, Category = Decoding)
+    bool bDecodeResponsesInBackground;
+
+    // Where result delegates run once a response has been decoded; PlayFabRequestHandler::SetResponseDispatcher overrides this
+    UPROPERTY(EditAnywhere, config, Category = Decoding)
+    EPlayFabResponseDispatch ResponseDispatch;
+
+    // Time result delegates may take on the game thread each frame; the rest wait for the next frame. Zero runs them as soon as they are decoded
+    UPROPERTY(EditAnywhere, config, Category = Decoding, meta = (ClampMin = "0"))
+    float DelegateBudgetMsPerFrame;
+
+    // Open connections to the title endpoint when the module starts, so the first call doesn't pay for DNS, TCP and TLS setup
+    UPROPERTY(EditAnywhere, config, Category = Connections)
+    bool bPrewarmConnections;
+
+    // Connections opened by the warm-up; set it to the number of calls the game makes at once during startup
+    UPROPERTY(EditAnywhere, config, Category = Connections, meta = (ClampMin = "1", EditCondition = "bPrewarmConnections"))
+    int32 PrewarmConnectionCount;
+
+    // Ping warmed hosts that have been idle for half of ConnectionIdleSeconds, so their connections aren't closed
+    UPROPERTY(EditAnywhere, config, Category = Connections, meta = (EditCondition = "bPrewarmConnections"))
+    bool bKeepConnectionsAlive;
+
+    // How long an idle connection is assumed to stay open, for keep-alive pings and connection reuse stats
+    UPROPERTY(EditAnywhere, config, Category = Connections, meta = (ClampMin = "1"))
+    float ConnectionIdleSeconds;
+
+    // Send a duplicate of a slow C++ read call once it has taken longer than its endpoint's p95 latency, and use whichever answers first
+    UPROPERTY(EditAnywhere, config, Category = Hedging)
+    bool bEnableRequestHedging;
+
+    // Calls that may be hedged, by name, such as "GetTitleData"; only read calls are ever hedged, whatever this lists
+    UPROPERTY(EditAnywhere, config, Category = Hedging, meta = (EditCondition = "bEnableRequestHedging"))
+    TArray<FString> HedgedCalls;
+
+    // Shortest wait before a duplicate is sent, so that an endpoint that always answers quickly isn't sent every call twice
+    UPROPERTY(EditAnywhere, config, Category = Hedging, meta = (ClampMin = "0", EditCondition = "bEnableRequestHedging"))
+    float MinHedgeDelaySeconds;
+
+    // Fail C++ calls to an API at once while most of its recent calls are timing out or hitting server errors, instead of letting each one wait for its timeout
+    UPROPERTY(EditAnywhere, config, Category = CircuitBreaker)
+    bool bEnableCircuitBreaker;
+
+    // Share of failed calls, among the last CircuitBreakerWindowSize calls to an API, that opens its circuit
+    UPROPERTY(EditAnywhere, config, Category = CircuitBreaker, meta = (ClampMin = "0", ClampMax = "1", EditCondition = "bEnableCircuitBreaker"))
+    float CircuitBreakerFailureRate;
+
+    // Calls an API needs to have made before its failure rate is trusted
+    UPROPERTY(EditAnywhere, config, Category = CircuitBreaker, meta = (ClampMin = "1", EditCondition = "bEnableCircuitBreaker"))
+    int32 CircuitBreakerMinCalls;
+
+    // Number of most recent calls to an API whose outcomes make up its failure rate; older outcomes are forgotten
+    UPROPERTY(EditAnywhere, config, Category = CircuitBreaker, meta = (ClampMin = "1", EditCondition = "bEnableCircuitBreaker"))
+    int32 CircuitBreakerWindowSize;
+
+    // Time an open circuit fails calls fast before it lets a probe call through
+    UPROPERTY(EditAnywhere, config, Category = CircuitBreaker, meta = (ClampMin = "0", EditCondition = "bEnableCircuitBreaker"))
+    float CircuitBreakerOpenSeconds;
+
+    // Record per-endpoint latency histograms and byte counts of C++ calls, see PlayFabRequestHandler::GetEndpointMetrics
+    UPROPERTY(EditAnywhere, config, Category = Metrics)
+    bool bCollectEndpointMetrics;
+
+    // Blueprint call proxies and request json objects of each class kept for reuse once their call completes; 0 turns pooling off
+    // With pooling on, a Blueprint must not hold on to a call's proxy or request object after the call's result has been handled, as the next call may reuse it
+    UPROPERTY(EditAnywhere, config, Category = Pooling, meta = (ClampMin = "0"))
+    int32 BlueprintObjectPoolSize;
+
+    // Share of calls whose request and response are logged on LogPlayFabRequests, when that category is at Verbose or higher
+    UPROPERTY(EditAnywhere, config, Category = Logging, meta = (ClampMin = "0", ClampMax = "1"))
+    float RequestLogSampleRate;
+
+    // Logged bodies are cut off after this many bytes; 0 logs them whole
+    UPROPERTY(EditAnywhere, config, Category = Logging, meta = (ClampMin = "0"))
+    int32 RequestLogMaxBodyBytes;
+
+    // Json fields whose string values are replaced with *** in logged bodies, matched without regard to case
+    UPROPERTY(EditAnywhere, config, Category = Logging)
+    TArray<FString> RequestLogRedactedFields;
 };
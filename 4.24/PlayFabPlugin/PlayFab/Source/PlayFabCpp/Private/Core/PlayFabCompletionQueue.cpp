@@ -0,0 +1,116 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabCompletionQueue.h"
+#include "PlayFabRuntimeSettings.h"
+#include "Containers/Ticker.h"
+#include "Misc/ScopeLock.h"
+
+using namespace PlayFab;
+
+namespace
+{
+    struct FQueuedDelegate
+    {
+        TFunction<void()> Deliver;
+        double EnqueueTime;
+    };
+
+    FCriticalSection QueueLock;
+    // Delegates before Head have already run; the array is compacted at the end of each drain
+    TArray<FQueuedDelegate> Pending;
+    int32 Head = 0;
+    FPlayFabCompletionQueueStats Stats;
+    FDelegateHandle DrainHandle;
+    bool bIsRunning = false;
+}
+
+void FPlayFabCompletionQueue::Startup()
+{
+    FScopeLock Lock(&QueueLock);
+    if (!bIsRunning)
+    {
+        bIsRunning = true;
+        DrainHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FPlayFabCompletionQueue::Drain));
+    }
+}
+
+void FPlayFabCompletionQueue::Shutdown()
+{
+    FScopeLock Lock(&QueueLock);
+    if (bIsRunning)
+    {
+        bIsRunning = false;
+        FTicker::GetCoreTicker().RemoveTicker(DrainHandle);
+        DrainHandle.Reset();
+    }
+    Pending.Empty();
+    Head = 0;
+}
+
+bool FPlayFabCompletionQueue::IsEnabled()
+{
+    return bIsRunning && GetDefault<UPlayFabRuntimeSettings>()->DelegateBudgetMsPerFrame > 0.0f;
+}
+
+void FPlayFabCompletionQueue::Enqueue(TFunction<void()>&& Deliver)
+{
+    FScopeLock Lock(&QueueLock);
+    FQueuedDelegate& Queued = Pending.AddDefaulted_GetRef();
+    Queued.Deliver = MoveTemp(Deliver);
+    Queued.EnqueueTime = FPlatformTime::Seconds();
+    Stats.MaxDepth = FMath::Max(Stats.MaxDepth, Pending.Num() - Head);
+}
+
+FPlayFabCompletionQueueStats FPlayFabCompletionQueue::GetStats()
+{
+    FScopeLock Lock(&QueueLock);
+    FPlayFabCompletionQueueStats Current = Stats;
+    Current.Depth = Pending.Num() - Head;
+    Current.OldestWaitSeconds = Current.Depth > 0 ? (float)(FPlatformTime::Seconds() - Pending[Head].EnqueueTime) : 0.0f;
+    return Current;
+}
+
+bool FPlayFabCompletionQueue::Drain(float DeltaTime)
+{
+    const double Start = FPlatformTime::Seconds();
+    const double Budget = GetDefault<UPlayFabRuntimeSettings>()->DelegateBudgetMsPerFrame / 1000.0;
+    int32 Delivered = 0;
+    bool BudgetExceeded = false;
+    for (;;)
+    {
+        TFunction<void()> Deliver;
+        {
+            FScopeLock Lock(&QueueLock);
+            if (Head >= Pending.Num())
+            {
+                break;
+            }
+            Deliver = MoveTemp(Pending[Head++].Deliver);
+        }
+
+        // Delegates run outside the lock, since they may well make further calls
+        Deliver();
+        ++Delivered;
+
+        // A budget of zero, set while delegates were queued, drains everything
+        if (Budget > 0.0 && FPlatformTime::Seconds() - Start >= Budget)
+        {
+            BudgetExceeded = true;
+            break;
+        }
+    }
+
+    FScopeLock Lock(&QueueLock);
+    if (Head > 0)
+    {
+        Pending.RemoveAt(0, Head, false);
+        Head = 0;
+    }
+    BudgetExceeded = BudgetExceeded && Pending.Num() > 0;
+    Stats.DeliveredLastFrame = Delivered;
+    Stats.bBudgetExceededLastFrame = BudgetExceeded;
+    return true;
+}
@@ -0,0 +1,150 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabConnectionWarmer.h"
+#include "PlayFabRuntimeSettings.h"
+#include "PlayFabSettings.h"
+#include "Http.h"
+#include "Containers/Ticker.h"
+#include "Misc/ScopeLock.h"
+
+using namespace PlayFab;
+
+namespace
+{
+    FCriticalSection WarmerLock;
+    FPlayFabConnectionStats Stats;
+    // Platform time of the last request that completed against each host
+    TMap<FString, double> LastActivity;
+    // Hosts that have been warmed, and the url used to warm each of them
+    TMap<FString, FString> WarmedUrls;
+    FDelegateHandle KeepAliveHandle;
+
+    void SendWarmupRequest(const FString& Url)
+    {
+        const FString Host = FPlayFabConnectionWarmer::GetHost(Url);
+        const double StartTime = FPlatformTime::Seconds();
+
+        // Any response at all means the connection is open; the request isn't a PlayFab call, and isn't counted as one
+        auto HttpRequest = FHttpModule::Get().CreateRequest();
+        HttpRequest->SetVerb(TEXT("GET"));
+        HttpRequest->SetURL(Url);
+        HttpRequest->SetHeader(TEXT("X-PlayFabSDK"), PlayFabSettings::versionString);
+        HttpRequest->OnProcessRequestComplete().BindLambda([Host, StartTime](FHttpRequestPtr, FHttpResponsePtr HttpResponse, bool bSucceeded)
+        {
+            const bool Connected = bSucceeded && HttpResponse.IsValid();
+            const double Now = FPlatformTime::Seconds();
+            FScopeLock Lock(&WarmerLock);
+            if (Connected)
+            {
+                Stats.LastPrewarmSeconds = (float)(Now - StartTime);
+                LastActivity.Add(Host, Now);
+            }
+            else
+            {
+                Stats.PrewarmFailures++;
+            }
+        });
+
+        {
+            FScopeLock Lock(&WarmerLock);
+            Stats.PrewarmRequests++;
+        }
+        HttpRequest->ProcessRequest();
+    }
+}
+
+FString FPlayFabConnectionWarmer::GetHost(const FString& Url)
+{
+    const int32 SchemeEnd = Url.Find(TEXT("://"), ESearchCase::CaseSensitive);
+    const int32 HostStart = SchemeEnd != INDEX_NONE ? SchemeEnd + 3 : 0;
+    const int32 HostEnd = Url.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, HostStart);
+    return HostEnd != INDEX_NONE ? Url.Mid(HostStart, HostEnd - HostStart) : Url.Mid(HostStart);
+}
+
+void FPlayFabConnectionWarmer::Prewarm(const FString& Url, int32 ConnectionCount)
+{
+    {
+        FScopeLock Lock(&WarmerLock);
+        WarmedUrls.Add(FPlayFabConnectionWarmer::GetHost(Url), Url);
+
+        const UPlayFabRuntimeSettings* Settings = GetDefault<UPlayFabRuntimeSettings>();
+        if (Settings->bKeepConnectionsAlive && Settings->ConnectionIdleSeconds > 0.0f && !KeepAliveHandle.IsValid())
+        {
+            // Ping at half the idle timeout, so that a connection never sits idle long enough to be closed
+            KeepAliveHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FPlayFabConnectionWarmer::KeepAlive), Settings->ConnectionIdleSeconds * 0.5f);
+        }
+    }
+
+    // Requests sent together each need a connection of their own
+    for (int32 Index = 0; Index < FMath::Max(1, ConnectionCount); ++Index)
+    {
+        SendWarmupRequest(Url);
+    }
+}
+
+void FPlayFabConnectionWarmer::Shutdown()
+{
+    FScopeLock Lock(&WarmerLock);
+    if (KeepAliveHandle.IsValid())
+    {
+        FTicker::GetCoreTicker().RemoveTicker(KeepAliveHandle);
+        KeepAliveHandle.Reset();
+    }
+    WarmedUrls.Empty();
+}
+
+void FPlayFabConnectionWarmer::OnCallSent(const FString& Host)
+{
+    const double IdleSeconds = GetDefault<UPlayFabRuntimeSettings>()->ConnectionIdleSeconds;
+    const double Now = FPlatformTime::Seconds();
+    FScopeLock Lock(&WarmerLock);
+    const double* Last = LastActivity.Find(Host);
+    if (Last != nullptr && Now - *Last < IdleSeconds)
+    {
+        Stats.WarmCalls++;
+    }
+    else
+    {
+        Stats.ColdCalls++;
+    }
+}
+
+void FPlayFabConnectionWarmer::OnActivity(const FString& Host)
+{
+    const double Now = FPlatformTime::Seconds();
+    FScopeLock Lock(&WarmerLock);
+    LastActivity.Add(Host, Now);
+}
+
+FPlayFabConnectionStats FPlayFabConnectionWarmer::GetStats()
+{
+    FScopeLock Lock(&WarmerLock);
+    return Stats;
+}
+
+bool FPlayFabConnectionWarmer::KeepAlive(float DeltaTime)
+{
+    const double IdleSeconds = GetDefault<UPlayFabRuntimeSettings>()->ConnectionIdleSeconds;
+    const double Now = FPlatformTime::Seconds();
+    TArray<FString> Idle;
+    {
+        FScopeLock Lock(&WarmerLock);
+        for (const auto& Pair : WarmedUrls)
+        {
+            const double* Last = LastActivity.Find(Pair.Key);
+            if (Last == nullptr || Now - *Last >= IdleSeconds * 0.5)
+            {
+                Idle.Add(Pair.Value);
+            }
+        }
+    }
+
+    for (const FString& Url : Idle)
+    {
+        SendWarmupRequest(Url);
+    }
+    return true;
+}
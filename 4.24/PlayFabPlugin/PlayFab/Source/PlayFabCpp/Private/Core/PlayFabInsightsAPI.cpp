@@ -30,7 +30,8 @@ FString UPlayFabInsightsAPI::GetBuildIdentifier() const
 bool UPlayFabInsightsAPI::GetDetails(
     InsightsModels::FInsightsEmptyRequest& request,
     const FGetDetailsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -38,29 +39,32 @@ bool UPlayFabInsightsAPI::GetDetails(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Insights/GetDetails"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Insights/GetDetails"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsAPI::OnGetDetailsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<InsightsModels::FInsightsGetDetailsResponse>> UPlayFabInsightsAPI::GetDetailsAsync(InsightsModels::FInsightsEmptyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<InsightsModels::FInsightsGetDetailsResponse, FGetDetailsDelegate>([this, &request, &Handle](const FGetDetailsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabInsightsAPI::GetDetails(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabInsightsAPI::OnGetDetailsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetDetailsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    InsightsModels::FInsightsGetDetailsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<InsightsModels::FInsightsGetDetailsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](InsightsModels::FInsightsGetDetailsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabInsightsAPI::GetLimits(
     InsightsModels::FInsightsEmptyRequest& request,
     const FGetLimitsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -68,29 +72,32 @@ bool UPlayFabInsightsAPI::GetLimits(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Insights/GetLimits"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Insights/GetLimits"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsAPI::OnGetLimitsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<InsightsModels::FInsightsGetLimitsResponse>> UPlayFabInsightsAPI::GetLimitsAsync(InsightsModels::FInsightsEmptyRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<InsightsModels::FInsightsGetLimitsResponse, FGetLimitsDelegate>([this, &request, &Handle](const FGetLimitsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabInsightsAPI::GetLimits(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabInsightsAPI::OnGetLimitsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLimitsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    InsightsModels::FInsightsGetLimitsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<InsightsModels::FInsightsGetLimitsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](InsightsModels::FInsightsGetLimitsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabInsightsAPI::GetOperationStatus(
     InsightsModels::FInsightsGetOperationStatusRequest& request,
     const FGetOperationStatusDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -98,29 +105,32 @@ bool UPlayFabInsightsAPI::GetOperationStatus(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Insights/GetOperationStatus"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Insights/GetOperationStatus"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsAPI::OnGetOperationStatusResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<InsightsModels::FInsightsGetOperationStatusResponse>> UPlayFabInsightsAPI::GetOperationStatusAsync(InsightsModels::FInsightsGetOperationStatusRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<InsightsModels::FInsightsGetOperationStatusResponse, FGetOperationStatusDelegate>([this, &request, &Handle](const FGetOperationStatusDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabInsightsAPI::GetOperationStatus(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabInsightsAPI::OnGetOperationStatusResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetOperationStatusDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    InsightsModels::FInsightsGetOperationStatusResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<InsightsModels::FInsightsGetOperationStatusResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](InsightsModels::FInsightsGetOperationStatusResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabInsightsAPI::GetPendingOperations(
     InsightsModels::FInsightsGetPendingOperationsRequest& request,
     const FGetPendingOperationsDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -128,29 +138,32 @@ bool UPlayFabInsightsAPI::GetPendingOperations(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Insights/GetPendingOperations"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Insights/GetPendingOperations"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsAPI::OnGetPendingOperationsResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<InsightsModels::FInsightsGetPendingOperationsResponse>> UPlayFabInsightsAPI::GetPendingOperationsAsync(InsightsModels::FInsightsGetPendingOperationsRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<InsightsModels::FInsightsGetPendingOperationsResponse, FGetPendingOperationsDelegate>([this, &request, &Handle](const FGetPendingOperationsDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabInsightsAPI::GetPendingOperations(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabInsightsAPI::OnGetPendingOperationsResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetPendingOperationsDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    InsightsModels::FInsightsGetPendingOperationsResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<InsightsModels::FInsightsGetPendingOperationsResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](InsightsModels::FInsightsGetPendingOperationsResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabInsightsAPI::SetPerformance(
     InsightsModels::FInsightsSetPerformanceRequest& request,
     const FSetPerformanceDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -158,29 +171,32 @@ bool UPlayFabInsightsAPI::SetPerformance(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Insights/SetPerformance"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Insights/SetPerformance"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsAPI::OnSetPerformanceResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<InsightsModels::FInsightsOperationResponse>> UPlayFabInsightsAPI::SetPerformanceAsync(InsightsModels::FInsightsSetPerformanceRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<InsightsModels::FInsightsOperationResponse, FSetPerformanceDelegate>([this, &request, &Handle](const FSetPerformanceDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabInsightsAPI::SetPerformance(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabInsightsAPI::OnSetPerformanceResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetPerformanceDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    InsightsModels::FInsightsOperationResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<InsightsModels::FInsightsOperationResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](InsightsModels::FInsightsOperationResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabInsightsAPI::SetStorageRetention(
     InsightsModels::FInsightsSetStorageRetentionRequest& request,
     const FSetStorageRetentionDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -188,21 +204,23 @@ bool UPlayFabInsightsAPI::SetStorageRetention(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Insights/SetStorageRetention"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Insights/SetStorageRetention"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabInsightsAPI::OnSetStorageRetentionResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<InsightsModels::FInsightsOperationResponse>> UPlayFabInsightsAPI::SetStorageRetentionAsync(InsightsModels::FInsightsSetStorageRetentionRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<InsightsModels::FInsightsOperationResponse, FSetStorageRetentionDelegate>([this, &request, &Handle](const FSetStorageRetentionDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabInsightsAPI::SetStorageRetention(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabInsightsAPI::OnSetStorageRetentionResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FSetStorageRetentionDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    InsightsModels::FInsightsOperationResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<InsightsModels::FInsightsOperationResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](InsightsModels::FInsightsOperationResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
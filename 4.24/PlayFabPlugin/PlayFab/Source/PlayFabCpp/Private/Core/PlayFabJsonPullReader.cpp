@@ -0,0 +1,627 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabJsonPullReader.h"
+#include "PlayFab.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Misc/Parse.h"
+
+using namespace PlayFab;
+
+FPlayFabJsonPullReader::FPlayFabJsonPullReader(const uint8* InData, int32 InLength)
+    : Data(InData), Length(InLength), Pos(0), bHasError(false), FieldName(nullptr), FieldNameLength(0)
+{
+    // Skip the UTF-8 byte order mark, if any
+    if (Length >= 3 && Data[0] == 0xEF && Data[1] == 0xBB && Data[2] == 0xBF)
+        Pos = 3;
+}
+
+FPlayFabJsonPullReader::FPlayFabJsonPullReader(const TArray<uint8>& InData)
+    : FPlayFabJsonPullReader(InData.GetData(), InData.Num())
+{
+}
+
+bool FPlayFabJsonPullReader::SetError()
+{
+    bHasError = true;
+    Pos = Length;
+    return false;
+}
+
+void FPlayFabJsonPullReader::SkipWhitespace()
+{
+    while (Pos < Length && (Data[Pos] == ' ' || Data[Pos] == '\t' || Data[Pos] == '\r' || Data[Pos] == '\n'))
+        ++Pos;
+}
+
+bool FPlayFabJsonPullReader::PeekChar(uint8& OutChar)
+{
+    SkipWhitespace();
+    if (bHasError || Pos >= Length)
+        return SetError();
+    OutChar = Data[Pos];
+    return true;
+}
+
+bool FPlayFabJsonPullReader::PeekObjectStart()
+{
+    uint8 Char;
+    return PeekChar(Char) && Char == '{';
+}
+
+bool FPlayFabJsonPullReader::ReadObjectStart()
+{
+    uint8 Char;
+    if (!PeekChar(Char))
+        return false;
+    if (Char != '{')
+    {
+        SkipValue();
+        return false;
+    }
+    ++Pos;
+    return true;
+}
+
+bool FPlayFabJsonPullReader::NextField()
+{
+    uint8 Char;
+    if (!PeekChar(Char))
+        return false;
+    if (Char == ',')
+    {
+        ++Pos;
+        if (!PeekChar(Char))
+            return false;
+    }
+    if (Char == '}')
+    {
+        ++Pos;
+        return false;
+    }
+    if (Char != '"' || !ReadStringToken(FieldName, FieldNameLength))
+        return SetError();
+
+    // The value that follows may reuse the string scratch, so keep escaped names apart
+    if (FieldName == StringScratch.GetData())
+    {
+        Exchange(StringScratch, FieldNameScratch);
+        FieldName = FieldNameScratch.GetData();
+    }
+
+    if (!PeekChar(Char) || Char != ':')
+        return SetError();
+    ++Pos;
+    return true;
+}
+
+FString FPlayFabJsonPullReader::GetFieldName() const
+{
+    return ToFString(FieldName, FieldNameLength);
+}
+
+bool FPlayFabJsonPullReader::PeekArrayStart()
+{
+    uint8 Char;
+    return PeekChar(Char) && Char == '[';
+}
+
+bool FPlayFabJsonPullReader::ReadArrayStart()
+{
+    uint8 Char;
+    if (!PeekChar(Char))
+        return false;
+    if (Char != '[')
+    {
+        SkipValue();
+        return false;
+    }
+    ++Pos;
+    return true;
+}
+
+bool FPlayFabJsonPullReader::NextArrayItem()
+{
+    uint8 Char;
+    if (!PeekChar(Char))
+        return false;
+    if (Char == ',')
+    {
+        ++Pos;
+        if (!PeekChar(Char))
+            return false;
+    }
+    if (Char == ']')
+    {
+        ++Pos;
+        return false;
+    }
+    return true;
+}
+
+bool FPlayFabJsonPullReader::ReadNull()
+{
+    uint8 Char;
+    return PeekChar(Char) && Char == 'n' && ReadLiteral("null", 4);
+}
+
+void FPlayFabJsonPullReader::SkipValue()
+{
+    int32 Depth = 0;
+    do
+    {
+        uint8 Char;
+        if (!PeekChar(Char))
+            return;
+
+        switch (Char)
+        {
+        case '{':
+        case '[':
+            ++Depth;
+            ++Pos;
+            break;
+        case '}':
+        case ']':
+            if (--Depth < 0)
+            {
+                SetError();
+                return;
+            }
+            ++Pos;
+            break;
+        case ',':
+        case ':':
+            if (Depth == 0)
+            {
+                SetError();
+                return;
+            }
+            ++Pos;
+            break;
+        case '"':
+        {
+            const ANSICHAR* Chars;
+            int32 CharsLength;
+            ReadStringToken(Chars, CharsLength);
+            break;
+        }
+        default:
+        {
+            const int32 Start = Pos;
+            while (Pos < Length && (FCharAnsi::IsAlnum(Data[Pos]) || Data[Pos] == '-' || Data[Pos] == '+' || Data[Pos] == '.'))
+                ++Pos;
+            if (Pos == Start)
+            {
+                SetError();
+                return;
+            }
+            break;
+        }
+        }
+    } while (Depth > 0 && !bHasError);
+}
+
+bool FPlayFabJsonPullReader::ReadLiteral(const ANSICHAR* Literal, int32 LiteralLength)
+{
+    if (Pos + LiteralLength > Length || FMemory::Memcmp(Data + Pos, Literal, LiteralLength) != 0)
+        return SetError();
+    Pos += LiteralLength;
+    return true;
+}
+
+bool FPlayFabJsonPullReader::ReadStringToken(const ANSICHAR*& OutChars, int32& OutLength)
+{
+    // Strings without escape sequences are returned in place
+    const int32 Start = ++Pos;
+    while (Pos < Length)
+    {
+        const uint8 Char = Data[Pos];
+        if (Char == '"')
+        {
+            OutChars = reinterpret_cast<const ANSICHAR*>(Data + Start);
+            OutLength = Pos - Start;
+            ++Pos;
+            return true;
+        }
+        if (Char == '\\')
+            return ReadEscapedStringToken(Start, OutChars, OutLength);
+        ++Pos;
+    }
+    return SetError();
+}
+
+bool FPlayFabJsonPullReader::ReadEscapedStringToken(int32 Start, const ANSICHAR*& OutChars, int32& OutLength)
+{
+    StringScratch.Reset();
+    StringScratch.Append(reinterpret_cast<const ANSICHAR*>(Data + Start), Pos - Start);
+    while (Pos < Length)
+    {
+        const uint8 Char = Data[Pos++];
+        if (Char == '"')
+        {
+            OutChars = StringScratch.GetData();
+            OutLength = StringScratch.Num();
+            return true;
+        }
+        if (Char != '\\')
+        {
+            StringScratch.Add(static_cast<ANSICHAR>(Char));
+            continue;
+        }
+        if (Pos >= Length)
+            break;
+
+        switch (Data[Pos++])
+        {
+        case '"': StringScratch.Add('"'); break;
+        case '\\': StringScratch.Add('\\'); break;
+        case '/': StringScratch.Add('/'); break;
+        case 'b': StringScratch.Add('\b'); break;
+        case 'f': StringScratch.Add('\f'); break;
+        case 'n': StringScratch.Add('\n'); break;
+        case 'r': StringScratch.Add('\r'); break;
+        case 't': StringScratch.Add('\t'); break;
+        case 'u':
+        {
+            uint32 CodePoint;
+            if (!ReadHex4(CodePoint))
+                return false;
+            if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && Pos + 1 < Length && Data[Pos] == '\\' && Data[Pos + 1] == 'u')
+            {
+                Pos += 2;
+                uint32 LowSurrogate;
+                if (!ReadHex4(LowSurrogate))
+                    return false;
+                if (LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+                {
+                    CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+                }
+                else
+                {
+                    AppendUtf8(CodePoint);
+                    CodePoint = LowSurrogate;
+                }
+            }
+            AppendUtf8(CodePoint);
+            break;
+        }
+        default:
+            return SetError();
+        }
+    }
+    return SetError();
+}
+
+bool FPlayFabJsonPullReader::ReadHex4(uint32& OutCodePoint)
+{
+    if (Pos + 4 > Length)
+        return SetError();
+
+    OutCodePoint = 0;
+    for (int32 Idx = 0; Idx < 4; Idx++)
+    {
+        const uint8 Char = Data[Pos++];
+        if (!FCharAnsi::IsHexDigit(Char))
+            return SetError();
+        OutCodePoint = (OutCodePoint << 4) | FParse::HexDigit(Char);
+    }
+    return true;
+}
+
+void FPlayFabJsonPullReader::AppendUtf8(uint32 CodePoint)
+{
+    if (CodePoint < 0x80)
+    {
+        StringScratch.Add(static_cast<ANSICHAR>(CodePoint));
+    }
+    else if (CodePoint < 0x800)
+    {
+        StringScratch.Add(static_cast<ANSICHAR>(0xC0 | (CodePoint >> 6)));
+        StringScratch.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+    }
+    else if (CodePoint < 0x10000)
+    {
+        StringScratch.Add(static_cast<ANSICHAR>(0xE0 | (CodePoint >> 12)));
+        StringScratch.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+        StringScratch.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+    }
+    else
+    {
+        StringScratch.Add(static_cast<ANSICHAR>(0xF0 | (CodePoint >> 18)));
+        StringScratch.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 12) & 0x3F)));
+        StringScratch.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+        StringScratch.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+    }
+}
+
+bool FPlayFabJsonPullReader::ReadNumberToken(ANSICHAR (&OutBuffer)[NumberBufferSize], bool& bOutIsInteger)
+{
+    const int32 Start = Pos;
+    bOutIsInteger = true;
+    while (Pos < Length)
+    {
+        const uint8 Char = Data[Pos];
+        if (Char == '.' || Char == 'e' || Char == 'E')
+            bOutIsInteger = false;
+        else if (!FCharAnsi::IsDigit(Char) && Char != '-' && Char != '+')
+            break;
+        ++Pos;
+    }
+
+    const int32 TokenLength = Pos - Start;
+    if (TokenLength == 0 || TokenLength >= NumberBufferSize)
+        return SetError();
+    FMemory::Memcpy(OutBuffer, Data + Start, TokenLength);
+    OutBuffer[TokenLength] = '\0';
+    return true;
+}
+
+FString FPlayFabJsonPullReader::ToFString(const ANSICHAR* Chars, int32 Length)
+{
+    // Widen ASCII straight into the string's own buffer, so each string costs a single allocation
+    FString Result;
+    if (Length == 0)
+        return Result;
+
+    TArray<TCHAR>& CharArray = Result.GetCharArray();
+    CharArray.SetNumUninitialized(Length + 1);
+    TCHAR* Dest = CharArray.GetData();
+    for (int32 Idx = 0; Idx < Length; Idx++)
+    {
+        if (static_cast<uint8>(Chars[Idx]) >= 0x80)
+        {
+            FUTF8ToTCHAR Converter(Chars, Length);
+            return FString(Converter.Length(), Converter.Get());
+        }
+        Dest[Idx] = static_cast<TCHAR>(Chars[Idx]);
+    }
+    Dest[Length] = TEXT('\0');
+    return Result;
+}
+
+bool FPlayFabJsonPullReader::ReadValue(FString& OutValue)
+{
+    uint8 Char;
+    if (!PeekChar(Char))
+        return false;
+
+    const ANSICHAR* Chars;
+    int32 CharsLength;
+    if (Char == '"')
+    {
+        if (!ReadStringToken(Chars, CharsLength))
+            return false;
+        OutValue = ToFString(Chars, CharsLength);
+        return true;
+    }
+    if (Char == '-' || FCharAnsi::IsDigit(Char))
+    {
+        // Same text as FJsonValueNumber::TryGetString, e.g. 5 and 5.0 both read as "5"
+        double Number;
+        if (!ReadValue(Number))
+            return false;
+        OutValue = FString::SanitizeFloat(Number, 0);
+        return true;
+    }
+    if (Char == 't' || Char == 'f')
+    {
+        // Same text as FJsonValueBoolean::TryGetString
+        bool bValue;
+        if (!ReadValue(bValue))
+            return false;
+        OutValue = bValue ? TEXT("true") : TEXT("false");
+        return true;
+    }
+    SkipValue();
+    return false;
+}
+
+bool FPlayFabJsonPullReader::ReadValue(bool& OutValue)
+{
+    uint8 Char;
+    if (!PeekChar(Char))
+        return false;
+
+    if (Char == 't')
+    {
+        OutValue = true;
+        return ReadLiteral("true", 4);
+    }
+    if (Char == 'f')
+    {
+        OutValue = false;
+        return ReadLiteral("false", 5);
+    }
+    SkipValue();
+    return false;
+}
+
+bool FPlayFabJsonPullReader::ReadInteger(int64& OutValue)
+{
+    uint8 Char;
+    if (!PeekChar(Char))
+        return false;
+    if (Char != '-' && !FCharAnsi::IsDigit(Char))
+    {
+        SkipValue();
+        return false;
+    }
+
+    ANSICHAR Buffer[NumberBufferSize];
+    bool bIsInteger;
+    if (!ReadNumberToken(Buffer, bIsInteger))
+        return false;
+
+    if (bIsInteger)
+    {
+        OutValue = FCStringAnsi::Strtoi64(Buffer, nullptr, 10);
+    }
+    else
+    {
+        // Round the same way FJsonValue::TryGetNumber does
+        const double Number = FCStringAnsi::Atod(Buffer);
+        OutValue = static_cast<int64>(Number >= 0.0 ? Number + 0.5 : Number - 0.5);
+    }
+    return true;
+}
+
+bool FPlayFabJsonPullReader::ReadValue(int16& OutValue)
+{
+    int64 TmpValue;
+    if (!ReadInteger(TmpValue))
+        return false;
+    OutValue = static_cast<int16>(TmpValue);
+    return true;
+}
+
+bool FPlayFabJsonPullReader::ReadValue(uint16& OutValue)
+{
+    int64 TmpValue;
+    if (!ReadInteger(TmpValue))
+        return false;
+    OutValue = static_cast<uint16>(TmpValue);
+    return true;
+}
+
+bool FPlayFabJsonPullReader::ReadValue(int32& OutValue)
+{
+    int64 TmpValue;
+    if (!ReadInteger(TmpValue))
+        return false;
+    OutValue = static_cast<int32>(TmpValue);
+    return true;
+}
+
+bool FPlayFabJsonPullReader::ReadValue(uint32& OutValue)
+{
+    int64 TmpValue;
+    if (!ReadInteger(TmpValue))
+        return false;
+    OutValue = static_cast<uint32>(TmpValue);
+    return true;
+}
+
+bool FPlayFabJsonPullReader::ReadValue(int64& OutValue)
+{
+    return ReadInteger(OutValue);
+}
+
+bool FPlayFabJsonPullReader::ReadValue(uint64& OutValue)
+{
+    int64 TmpValue;
+    if (!ReadInteger(TmpValue))
+        return false;
+    OutValue = static_cast<uint64>(TmpValue);
+    return true;
+}
+
+bool FPlayFabJsonPullReader::ReadValue(float& OutValue)
+{
+    double TmpValue;
+    if (!ReadValue(TmpValue))
+        return false;
+    OutValue = static_cast<float>(TmpValue);
+    return true;
+}
+
+bool FPlayFabJsonPullReader::ReadValue(double& OutValue)
+{
+    uint8 Char;
+    if (!PeekChar(Char))
+        return false;
+    if (Char != '-' && !FCharAnsi::IsDigit(Char))
+    {
+        SkipValue();
+        return false;
+    }
+
+    ANSICHAR Buffer[NumberBufferSize];
+    bool bIsInteger;
+    if (!ReadNumberToken(Buffer, bIsInteger))
+        return false;
+
+    OutValue = FCStringAnsi::Atod(Buffer);
+    return true;
+}
+
+bool FPlayFabJsonPullReader::ReadValue(FDateTime& OutValue)
+{
+    FString DateString;
+    if (!ReadValue(DateString))
+        return false;
+
+    if (!FDateTime::ParseIso8601(*DateString, OutValue))
+    {
+        UE_LOG(LogPlayFabCpp, Error, TEXT("FPlayFabJsonPullReader - Unable to import FDateTime from Iso8601 String"));
+        return false;
+    }
+    return true;
+}
+
+TSharedPtr<FJsonValue> FPlayFabJsonPullReader::ReadJsonValue()
+{
+    return ReadJsonValue(0);
+}
+
+TSharedPtr<FJsonValue> FPlayFabJsonPullReader::ReadJsonValue(int32 Depth)
+{
+    uint8 Char;
+    if (!PeekChar(Char))
+        return MakeShared<FJsonValueNull>();
+    if ((Char == '{' || Char == '[') && Depth >= MaxJsonValueDepth)
+    {
+        SetError();
+        return MakeShared<FJsonValueNull>();
+    }
+
+    switch (Char)
+    {
+    case '{':
+    {
+        ++Pos;
+        TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+        while (NextField())
+        {
+            const FString Key = GetFieldName();
+            Object->SetField(Key, ReadJsonValue(Depth + 1));
+        }
+        return MakeShared<FJsonValueObject>(Object);
+    }
+    case '[':
+    {
+        ++Pos;
+        TArray<TSharedPtr<FJsonValue>> Items;
+        while (NextArrayItem())
+            Items.Add(ReadJsonValue(Depth + 1));
+        return MakeShared<FJsonValueArray>(Items);
+    }
+    case '"':
+    {
+        FString Value;
+        ReadValue(Value);
+        return MakeShared<FJsonValueString>(Value);
+    }
+    case 't':
+    case 'f':
+    {
+        bool Value = false;
+        ReadValue(Value);
+        return MakeShared<FJsonValueBoolean>(Value);
+    }
+    case 'n':
+    {
+        ReadNull();
+        return MakeShared<FJsonValueNull>();
+    }
+    default:
+    {
+        double Value = 0;
+        ReadValue(Value);
+        return MakeShared<FJsonValueNumber>(Value);
+    }
+    }
+}
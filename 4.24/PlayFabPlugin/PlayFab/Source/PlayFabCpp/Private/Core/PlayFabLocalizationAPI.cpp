@@ -30,7 +30,8 @@ FString UPlayFabLocalizationAPI::GetBuildIdentifier() const
 bool UPlayFabLocalizationAPI::GetLanguageList(
     LocalizationModels::FGetLanguageListRequest& request,
     const FGetLanguageListDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString entityToken = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetEntityToken() : PlayFabSettings::GetEntityToken();
     if (entityToken.Len() == 0) {
@@ -38,21 +39,23 @@ bool UPlayFabLocalizationAPI::GetLanguageList(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Locale/GetLanguageList"), request.toJSONString(), TEXT("X-EntityToken"), entityToken);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Locale/GetLanguageList"), request.toJSONUtf8(), TEXT("X-EntityToken"), entityToken);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabLocalizationAPI::OnGetLanguageListResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, true, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<LocalizationModels::FGetLanguageListResponse>> UPlayFabLocalizationAPI::GetLanguageListAsync(LocalizationModels::FGetLanguageListRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<LocalizationModels::FGetLanguageListResponse, FGetLanguageListDelegate>([this, &request, &Handle](const FGetLanguageListDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabLocalizationAPI::GetLanguageList(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabLocalizationAPI::OnGetLanguageListResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetLanguageListDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    LocalizationModels::FGetLanguageListResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<LocalizationModels::FGetLanguageListResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](LocalizationModels::FGetLanguageListResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
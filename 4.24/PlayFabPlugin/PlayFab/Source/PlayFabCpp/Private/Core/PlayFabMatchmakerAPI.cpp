@@ -30,7 +30,8 @@ FString UPlayFabMatchmakerAPI::GetBuildIdentifier() const
 bool UPlayFabMatchmakerAPI::AuthUser(
     MatchmakerModels::FAuthUserRequest& request,
     const FAuthUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -38,29 +39,32 @@ bool UPlayFabMatchmakerAPI::AuthUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Matchmaker/AuthUser"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Matchmaker/AuthUser"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMatchmakerAPI::OnAuthUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MatchmakerModels::FAuthUserResponse>> UPlayFabMatchmakerAPI::AuthUserAsync(MatchmakerModels::FAuthUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MatchmakerModels::FAuthUserResponse, FAuthUserDelegate>([this, &request, &Handle](const FAuthUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMatchmakerAPI::AuthUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMatchmakerAPI::OnAuthUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAuthUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MatchmakerModels::FAuthUserResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MatchmakerModels::FAuthUserResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MatchmakerModels::FAuthUserResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMatchmakerAPI::PlayerJoined(
     MatchmakerModels::FPlayerJoinedRequest& request,
     const FPlayerJoinedDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -68,29 +72,32 @@ bool UPlayFabMatchmakerAPI::PlayerJoined(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Matchmaker/PlayerJoined"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Matchmaker/PlayerJoined"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMatchmakerAPI::OnPlayerJoinedResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MatchmakerModels::FPlayerJoinedResponse>> UPlayFabMatchmakerAPI::PlayerJoinedAsync(MatchmakerModels::FPlayerJoinedRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MatchmakerModels::FPlayerJoinedResponse, FPlayerJoinedDelegate>([this, &request, &Handle](const FPlayerJoinedDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMatchmakerAPI::PlayerJoined(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMatchmakerAPI::OnPlayerJoinedResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPlayerJoinedDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MatchmakerModels::FPlayerJoinedResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MatchmakerModels::FPlayerJoinedResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MatchmakerModels::FPlayerJoinedResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMatchmakerAPI::PlayerLeft(
     MatchmakerModels::FPlayerLeftRequest& request,
     const FPlayerLeftDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -98,29 +105,32 @@ bool UPlayFabMatchmakerAPI::PlayerLeft(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Matchmaker/PlayerLeft"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Matchmaker/PlayerLeft"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMatchmakerAPI::OnPlayerLeftResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MatchmakerModels::FPlayerLeftResponse>> UPlayFabMatchmakerAPI::PlayerLeftAsync(MatchmakerModels::FPlayerLeftRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MatchmakerModels::FPlayerLeftResponse, FPlayerLeftDelegate>([this, &request, &Handle](const FPlayerLeftDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMatchmakerAPI::PlayerLeft(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMatchmakerAPI::OnPlayerLeftResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPlayerLeftDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MatchmakerModels::FPlayerLeftResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MatchmakerModels::FPlayerLeftResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MatchmakerModels::FPlayerLeftResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMatchmakerAPI::StartGame(
     MatchmakerModels::FStartGameRequest& request,
     const FStartGameDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -128,29 +138,32 @@ bool UPlayFabMatchmakerAPI::StartGame(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Matchmaker/StartGame"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Matchmaker/StartGame"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMatchmakerAPI::OnStartGameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MatchmakerModels::FStartGameResponse>> UPlayFabMatchmakerAPI::StartGameAsync(MatchmakerModels::FStartGameRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MatchmakerModels::FStartGameResponse, FStartGameDelegate>([this, &request, &Handle](const FStartGameDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMatchmakerAPI::StartGame(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMatchmakerAPI::OnStartGameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FStartGameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MatchmakerModels::FStartGameResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MatchmakerModels::FStartGameResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MatchmakerModels::FStartGameResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMatchmakerAPI::UserInfo(
     MatchmakerModels::FUserInfoRequest& request,
     const FUserInfoDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     FString devSecretKey = request.AuthenticationContext.IsValid() ? request.AuthenticationContext->GetDeveloperSecretKey() : GetDefault<UPlayFabRuntimeSettings>()->DeveloperSecretKey;
     if (devSecretKey.Len() == 0) {
@@ -158,21 +171,23 @@ bool UPlayFabMatchmakerAPI::UserInfo(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Matchmaker/UserInfo"), request.toJSONString(), TEXT("X-SecretKey"), devSecretKey);
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(nullptr, TEXT("/Matchmaker/UserInfo"), request.toJSONUtf8(), TEXT("X-SecretKey"), devSecretKey);
     HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMatchmakerAPI::OnUserInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MatchmakerModels::FUserInfoResponse>> UPlayFabMatchmakerAPI::UserInfoAsync(MatchmakerModels::FUserInfoRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MatchmakerModels::FUserInfoResponse, FUserInfoDelegate>([this, &request, &Handle](const FUserInfoDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMatchmakerAPI::UserInfo(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMatchmakerAPI::OnUserInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUserInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MatchmakerModels::FUserInfoResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MatchmakerModels::FUserInfoResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MatchmakerModels::FUserInfoResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
@@ -7,6 +7,7 @@
 
 #include "Core/PlayFabMatchmakerDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
+#include "Core/PlayFabJsonPullReader.h"
 
 using namespace PlayFab;
 using namespace PlayFab::MatchmakerModels;
@@ -16,7 +17,8 @@ PlayFab::MatchmakerModels::FAuthUserRequest::~FAuthUserRequest()
 
 }
 
-void PlayFab::MatchmakerModels::FAuthUserRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MatchmakerModels::FAuthUserRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -33,6 +35,16 @@ void PlayFab::MatchmakerModels::FAuthUserRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MatchmakerModels::FAuthUserRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MatchmakerModels::FAuthUserRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MatchmakerModels::FAuthUserRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -47,12 +59,39 @@ bool PlayFab::MatchmakerModels::FAuthUserRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::MatchmakerModels::FAuthUserRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AuthorizationTicket"))
+        {
+            reader.ReadValue(AuthorizationTicket);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAuthUserRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MatchmakerModels::FAuthUserResponse::~FAuthUserResponse()
 {
 
 }
 
-void PlayFab::MatchmakerModels::FAuthUserResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MatchmakerModels::FAuthUserResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -68,6 +107,16 @@ void PlayFab::MatchmakerModels::FAuthUserResponse::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MatchmakerModels::FAuthUserResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MatchmakerModels::FAuthUserResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MatchmakerModels::FAuthUserResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -89,12 +138,43 @@ bool PlayFab::MatchmakerModels::FAuthUserResponse::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::MatchmakerModels::FAuthUserResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Authorized"))
+        {
+            reader.ReadValue(Authorized);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAuthUserResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MatchmakerModels::FItemInstance::~FItemInstance()
 {
 
 }
 
-void PlayFab::MatchmakerModels::FItemInstance::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MatchmakerModels::FItemInstance::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -196,6 +276,16 @@ void PlayFab::MatchmakerModels::FItemInstance::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MatchmakerModels::FItemInstance::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MatchmakerModels::FItemInstance::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MatchmakerModels::FItemInstance::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -228,7 +318,7 @@ bool PlayFab::MatchmakerModels::FItemInstance::readFromValue(const TSharedPtr<FJ
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomDataObject)->Values); It; ++It)
         {
-            CustomData.Add(It.Key(), It.Value()->AsString());
+            CustomData.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -301,12 +391,109 @@ bool PlayFab::MatchmakerModels::FItemInstance::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::MatchmakerModels::FItemInstance::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Annotation"))
+        {
+            reader.ReadValue(Annotation);
+        }
+        else if (reader.IsField("BundleContents"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { BundleContents.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("BundleParent"))
+        {
+            reader.ReadValue(BundleParent);
+        }
+        else if (reader.IsField("CatalogVersion"))
+        {
+            reader.ReadValue(CatalogVersion);
+        }
+        else if (reader.IsField("CustomData"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomData.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("Expiration"))
+        {
+            reader.ReadValue(Expiration);
+        }
+        else if (reader.IsField("ItemClass"))
+        {
+            reader.ReadValue(ItemClass);
+        }
+        else if (reader.IsField("ItemId"))
+        {
+            reader.ReadValue(ItemId);
+        }
+        else if (reader.IsField("ItemInstanceId"))
+        {
+            reader.ReadValue(ItemInstanceId);
+        }
+        else if (reader.IsField("PurchaseDate"))
+        {
+            reader.ReadValue(PurchaseDate);
+        }
+        else if (reader.IsField("RemainingUses"))
+        {
+            reader.ReadValue(RemainingUses);
+        }
+        else if (reader.IsField("UnitCurrency"))
+        {
+            reader.ReadValue(UnitCurrency);
+        }
+        else if (reader.IsField("UnitPrice"))
+        {
+            reader.ReadValue(UnitPrice);
+        }
+        else if (reader.IsField("UsesIncrementedBy"))
+        {
+            reader.ReadValue(UsesIncrementedBy);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FItemInstance();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MatchmakerModels::FPlayerJoinedRequest::~FPlayerJoinedRequest()
 {
 
 }
 
-void PlayFab::MatchmakerModels::FPlayerJoinedRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MatchmakerModels::FPlayerJoinedRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -344,6 +531,16 @@ void PlayFab::MatchmakerModels::FPlayerJoinedRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MatchmakerModels::FPlayerJoinedRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MatchmakerModels::FPlayerJoinedRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MatchmakerModels::FPlayerJoinedRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -353,7 +550,7 @@ bool PlayFab::MatchmakerModels::FPlayerJoinedRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -374,18 +571,70 @@ bool PlayFab::MatchmakerModels::FPlayerJoinedRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::MatchmakerModels::FPlayerJoinedRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("LobbyId"))
+        {
+            reader.ReadValue(LobbyId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerJoinedRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MatchmakerModels::FPlayerJoinedResponse::~FPlayerJoinedResponse()
 {
 
 }
 
-void PlayFab::MatchmakerModels::FPlayerJoinedResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MatchmakerModels::FPlayerJoinedResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MatchmakerModels::FPlayerJoinedResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MatchmakerModels::FPlayerJoinedResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MatchmakerModels::FPlayerJoinedResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -393,12 +642,34 @@ bool PlayFab::MatchmakerModels::FPlayerJoinedResponse::readFromValue(const TShar
     return HasSucceeded;
 }
 
+bool PlayFab::MatchmakerModels::FPlayerJoinedResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerJoinedResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MatchmakerModels::FPlayerLeftRequest::~FPlayerLeftRequest()
 {
 
 }
 
-void PlayFab::MatchmakerModels::FPlayerLeftRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MatchmakerModels::FPlayerLeftRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -436,6 +707,16 @@ void PlayFab::MatchmakerModels::FPlayerLeftRequest::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MatchmakerModels::FPlayerLeftRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MatchmakerModels::FPlayerLeftRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MatchmakerModels::FPlayerLeftRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -445,7 +726,7 @@ bool PlayFab::MatchmakerModels::FPlayerLeftRequest::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -466,18 +747,70 @@ bool PlayFab::MatchmakerModels::FPlayerLeftRequest::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::MatchmakerModels::FPlayerLeftRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("LobbyId"))
+        {
+            reader.ReadValue(LobbyId);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerLeftRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MatchmakerModels::FPlayerLeftResponse::~FPlayerLeftResponse()
 {
 
 }
 
-void PlayFab::MatchmakerModels::FPlayerLeftResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MatchmakerModels::FPlayerLeftResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MatchmakerModels::FPlayerLeftResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MatchmakerModels::FPlayerLeftResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MatchmakerModels::FPlayerLeftResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -485,7 +818,29 @@ bool PlayFab::MatchmakerModels::FPlayerLeftResponse::readFromValue(const TShared
     return HasSucceeded;
 }
 
-void PlayFab::MatchmakerModels::writeRegionEnumJSON(Region enumVal, JsonWriter& writer)
+bool PlayFab::MatchmakerModels::FPlayerLeftResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPlayerLeftResponse();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeRegionEnumValue(MatchmakerModels::Region enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -500,6 +855,16 @@ void PlayFab::MatchmakerModels::writeRegionEnumJSON(Region enumVal, JsonWriter&
     }
 }
 
+void PlayFab::MatchmakerModels::writeRegionEnumJSON(Region enumVal, JsonWriter& writer)
+{
+    writeRegionEnumValue(enumVal, writer);
+}
+
+void PlayFab::MatchmakerModels::writeRegionEnumJSON(Region enumVal, JsonUtf8Writer& writer)
+{
+    writeRegionEnumValue(enumVal, writer);
+}
+
 MatchmakerModels::Region PlayFab::MatchmakerModels::readRegionFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readRegionFromValue(value.IsValid() ? value->AsString() : "");
@@ -536,7 +901,8 @@ PlayFab::MatchmakerModels::FStartGameRequest::~FStartGameRequest()
 
 }
 
-void PlayFab::MatchmakerModels::FStartGameRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MatchmakerModels::FStartGameRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -593,6 +959,16 @@ void PlayFab::MatchmakerModels::FStartGameRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MatchmakerModels::FStartGameRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MatchmakerModels::FStartGameRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MatchmakerModels::FStartGameRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -616,7 +992,7 @@ bool PlayFab::MatchmakerModels::FStartGameRequest::readFromValue(const TSharedPt
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -639,12 +1015,67 @@ bool PlayFab::MatchmakerModels::FStartGameRequest::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::MatchmakerModels::FStartGameRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Build"))
+        {
+            reader.ReadValue(Build);
+        }
+        else if (reader.IsField("CustomCommandLineData"))
+        {
+            reader.ReadValue(CustomCommandLineData);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ExternalMatchmakerEventEndpoint"))
+        {
+            reader.ReadValue(ExternalMatchmakerEventEndpoint);
+        }
+        else if (reader.IsField("GameMode"))
+        {
+            reader.ReadValue(GameMode);
+        }
+        else if (reader.IsField("Region"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfRegion = readRegionFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStartGameRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MatchmakerModels::FStartGameResponse::~FStartGameResponse()
 {
 
 }
 
-void PlayFab::MatchmakerModels::FStartGameResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MatchmakerModels::FStartGameResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -678,6 +1109,16 @@ void PlayFab::MatchmakerModels::FStartGameResponse::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MatchmakerModels::FStartGameResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MatchmakerModels::FStartGameResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MatchmakerModels::FStartGameResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -720,12 +1161,55 @@ bool PlayFab::MatchmakerModels::FStartGameResponse::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::MatchmakerModels::FStartGameResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GameID"))
+        {
+            reader.ReadValue(GameID);
+        }
+        else if (reader.IsField("ServerIPV4Address"))
+        {
+            reader.ReadValue(ServerIPV4Address);
+        }
+        else if (reader.IsField("ServerIPV6Address"))
+        {
+            reader.ReadValue(ServerIPV6Address);
+        }
+        else if (reader.IsField("ServerPort"))
+        {
+            reader.ReadValue(ServerPort);
+        }
+        else if (reader.IsField("ServerPublicDNSName"))
+        {
+            reader.ReadValue(ServerPublicDNSName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStartGameResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MatchmakerModels::FUserInfoRequest::~FUserInfoRequest()
 {
 
 }
 
-void PlayFab::MatchmakerModels::FUserInfoRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MatchmakerModels::FUserInfoRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -756,6 +1240,16 @@ void PlayFab::MatchmakerModels::FUserInfoRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MatchmakerModels::FUserInfoRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MatchmakerModels::FUserInfoRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MatchmakerModels::FUserInfoRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -765,7 +1259,7 @@ bool PlayFab::MatchmakerModels::FUserInfoRequest::readFromValue(const TSharedPtr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -786,12 +1280,54 @@ bool PlayFab::MatchmakerModels::FUserInfoRequest::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::MatchmakerModels::FUserInfoRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("MinCatalogVersion"))
+        {
+            reader.ReadValue(MinCatalogVersion);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserInfoRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MatchmakerModels::FVirtualCurrencyRechargeTime::~FVirtualCurrencyRechargeTime()
 {
 
 }
 
-void PlayFab::MatchmakerModels::FVirtualCurrencyRechargeTime::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MatchmakerModels::FVirtualCurrencyRechargeTime::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -807,6 +1343,16 @@ void PlayFab::MatchmakerModels::FVirtualCurrencyRechargeTime::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MatchmakerModels::FVirtualCurrencyRechargeTime::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MatchmakerModels::FVirtualCurrencyRechargeTime::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MatchmakerModels::FVirtualCurrencyRechargeTime::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -833,12 +1379,47 @@ bool PlayFab::MatchmakerModels::FVirtualCurrencyRechargeTime::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::MatchmakerModels::FVirtualCurrencyRechargeTime::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("RechargeMax"))
+        {
+            reader.ReadValue(RechargeMax);
+        }
+        else if (reader.IsField("RechargeTime"))
+        {
+            reader.ReadValue(RechargeTime);
+        }
+        else if (reader.IsField("SecondsToRecharge"))
+        {
+            reader.ReadValue(SecondsToRecharge);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FVirtualCurrencyRechargeTime();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MatchmakerModels::FUserInfoResponse::~FUserInfoResponse()
 {
 
 }
 
-void PlayFab::MatchmakerModels::FUserInfoResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MatchmakerModels::FUserInfoResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -903,6 +1484,16 @@ void PlayFab::MatchmakerModels::FUserInfoResponse::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MatchmakerModels::FUserInfoResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MatchmakerModels::FUserInfoResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MatchmakerModels::FUserInfoResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -911,7 +1502,7 @@ bool PlayFab::MatchmakerModels::FUserInfoResponse::readFromValue(const TSharedPt
     for (int32 Idx = 0; Idx < InventoryArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = InventoryArray[Idx];
-        Inventory.Add(FItemInstance(CurrentItem->AsObject()));
+        Inventory.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -956,7 +1547,7 @@ bool PlayFab::MatchmakerModels::FUserInfoResponse::readFromValue(const TSharedPt
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyObject)->Values); It; ++It)
         {
             int32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            VirtualCurrency.Add(It.Key(), TmpValue);
+            VirtualCurrency.Emplace(It.Key(), TmpValue);
         }
     }
 
@@ -965,10 +1556,85 @@ bool PlayFab::MatchmakerModels::FUserInfoResponse::readFromValue(const TSharedPt
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*VirtualCurrencyRechargeTimesObject)->Values); It; ++It)
         {
-            VirtualCurrencyRechargeTimes.Add(It.Key(), FVirtualCurrencyRechargeTime(It.Value()->AsObject()));
+            VirtualCurrencyRechargeTimes.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MatchmakerModels::FUserInfoResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Inventory"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Inventory[Inventory.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("IsDeveloper"))
+        {
+            reader.ReadValue(IsDeveloper);
+        }
+        else if (reader.IsField("PlayFabId"))
+        {
+            reader.ReadValue(PlayFabId);
+        }
+        else if (reader.IsField("SteamId"))
+        {
+            reader.ReadValue(SteamId);
+        }
+        else if (reader.IsField("TitleDisplayName"))
+        {
+            reader.ReadValue(TitleDisplayName);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else if (reader.IsField("VirtualCurrency"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    int32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { VirtualCurrency.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("VirtualCurrencyRechargeTimes"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { VirtualCurrencyRechargeTimes.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUserInfoResponse();
+        return false;
+    }
+    return true;
+}
+
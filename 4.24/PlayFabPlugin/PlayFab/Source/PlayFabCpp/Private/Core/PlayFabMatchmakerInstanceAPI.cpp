@@ -80,7 +80,8 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabMatchmakerInstanceAPI::GetOrCr
 bool UPlayFabMatchmakerInstanceAPI::AuthUser(
     MatchmakerModels::FAuthUserRequest& request,
     const FAuthUserDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -88,29 +89,32 @@ bool UPlayFabMatchmakerInstanceAPI::AuthUser(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Matchmaker/AuthUser"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMatchmakerInstanceAPI::OnAuthUserResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Matchmaker/AuthUser"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMatchmakerInstanceAPI::OnAuthUserResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MatchmakerModels::FAuthUserResponse>> UPlayFabMatchmakerInstanceAPI::AuthUserAsync(MatchmakerModels::FAuthUserRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MatchmakerModels::FAuthUserResponse, FAuthUserDelegate>([this, &request, &Handle](const FAuthUserDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMatchmakerInstanceAPI::AuthUser(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMatchmakerInstanceAPI::OnAuthUserResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FAuthUserDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MatchmakerModels::FAuthUserResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MatchmakerModels::FAuthUserResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MatchmakerModels::FAuthUserResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMatchmakerInstanceAPI::PlayerJoined(
     MatchmakerModels::FPlayerJoinedRequest& request,
     const FPlayerJoinedDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -118,29 +122,32 @@ bool UPlayFabMatchmakerInstanceAPI::PlayerJoined(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Matchmaker/PlayerJoined"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMatchmakerInstanceAPI::OnPlayerJoinedResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Matchmaker/PlayerJoined"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMatchmakerInstanceAPI::OnPlayerJoinedResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MatchmakerModels::FPlayerJoinedResponse>> UPlayFabMatchmakerInstanceAPI::PlayerJoinedAsync(MatchmakerModels::FPlayerJoinedRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MatchmakerModels::FPlayerJoinedResponse, FPlayerJoinedDelegate>([this, &request, &Handle](const FPlayerJoinedDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMatchmakerInstanceAPI::PlayerJoined(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMatchmakerInstanceAPI::OnPlayerJoinedResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPlayerJoinedDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MatchmakerModels::FPlayerJoinedResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MatchmakerModels::FPlayerJoinedResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MatchmakerModels::FPlayerJoinedResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMatchmakerInstanceAPI::PlayerLeft(
     MatchmakerModels::FPlayerLeftRequest& request,
     const FPlayerLeftDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -148,29 +155,32 @@ bool UPlayFabMatchmakerInstanceAPI::PlayerLeft(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Matchmaker/PlayerLeft"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMatchmakerInstanceAPI::OnPlayerLeftResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Matchmaker/PlayerLeft"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMatchmakerInstanceAPI::OnPlayerLeftResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MatchmakerModels::FPlayerLeftResponse>> UPlayFabMatchmakerInstanceAPI::PlayerLeftAsync(MatchmakerModels::FPlayerLeftRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MatchmakerModels::FPlayerLeftResponse, FPlayerLeftDelegate>([this, &request, &Handle](const FPlayerLeftDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMatchmakerInstanceAPI::PlayerLeft(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMatchmakerInstanceAPI::OnPlayerLeftResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FPlayerLeftDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MatchmakerModels::FPlayerLeftResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MatchmakerModels::FPlayerLeftResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MatchmakerModels::FPlayerLeftResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMatchmakerInstanceAPI::StartGame(
     MatchmakerModels::FStartGameRequest& request,
     const FStartGameDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -178,29 +188,32 @@ bool UPlayFabMatchmakerInstanceAPI::StartGame(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Matchmaker/StartGame"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMatchmakerInstanceAPI::OnStartGameResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Matchmaker/StartGame"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMatchmakerInstanceAPI::OnStartGameResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MatchmakerModels::FStartGameResponse>> UPlayFabMatchmakerInstanceAPI::StartGameAsync(MatchmakerModels::FStartGameRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MatchmakerModels::FStartGameResponse, FStartGameDelegate>([this, &request, &Handle](const FStartGameDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMatchmakerInstanceAPI::StartGame(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMatchmakerInstanceAPI::OnStartGameResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FStartGameDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MatchmakerModels::FStartGameResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MatchmakerModels::FStartGameResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MatchmakerModels::FStartGameResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
 
 bool UPlayFabMatchmakerInstanceAPI::UserInfo(
     MatchmakerModels::FUserInfoRequest& request,
     const FUserInfoDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if(context->GetDeveloperSecretKey().Len() == 0) {
@@ -208,21 +221,23 @@ bool UPlayFabMatchmakerInstanceAPI::UserInfo(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Matchmaker/UserInfo"), request.toJSONString(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabMatchmakerInstanceAPI::OnUserInfoResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Matchmaker/UserInfo"), request.toJSONUtf8(), TEXT("X-SecretKey"), context->GetDeveloperSecretKey());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabMatchmakerInstanceAPI::OnUserInfoResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<MatchmakerModels::FUserInfoResponse>> UPlayFabMatchmakerInstanceAPI::UserInfoAsync(MatchmakerModels::FUserInfoRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<MatchmakerModels::FUserInfoResponse, FUserInfoDelegate>([this, &request, &Handle](const FUserInfoDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabMatchmakerInstanceAPI::UserInfo(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabMatchmakerInstanceAPI::OnUserInfoResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FUserInfoDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    MatchmakerModels::FUserInfoResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<MatchmakerModels::FUserInfoResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](MatchmakerModels::FUserInfoResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
@@ -7,6 +7,7 @@
 
 #include "Core/PlayFabMultiplayerDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
+#include "Core/PlayFabJsonPullReader.h"
 
 using namespace PlayFab;
 using namespace PlayFab::MultiplayerModels;
@@ -16,7 +17,8 @@ PlayFab::MultiplayerModels::FAssetReference::~FAssetReference()
 
 }
 
-void PlayFab::MultiplayerModels::FAssetReference::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FAssetReference::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -35,6 +37,16 @@ void PlayFab::MultiplayerModels::FAssetReference::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FAssetReference::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FAssetReference::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FAssetReference::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -56,12 +68,43 @@ bool PlayFab::MultiplayerModels::FAssetReference::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FAssetReference::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FileName"))
+        {
+            reader.ReadValue(FileName);
+        }
+        else if (reader.IsField("MountPath"))
+        {
+            reader.ReadValue(MountPath);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAssetReference();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FAssetReferenceParams::~FAssetReferenceParams()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FAssetReferenceParams::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FAssetReferenceParams::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -84,6 +127,16 @@ void PlayFab::MultiplayerModels::FAssetReferenceParams::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FAssetReferenceParams::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FAssetReferenceParams::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FAssetReferenceParams::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -105,12 +158,43 @@ bool PlayFab::MultiplayerModels::FAssetReferenceParams::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FAssetReferenceParams::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FileName"))
+        {
+            reader.ReadValue(FileName);
+        }
+        else if (reader.IsField("MountPath"))
+        {
+            reader.ReadValue(MountPath);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAssetReferenceParams();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FAssetSummary::~FAssetSummary()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FAssetSummary::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FAssetSummary::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -134,6 +218,16 @@ void PlayFab::MultiplayerModels::FAssetSummary::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FAssetSummary::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FAssetSummary::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FAssetSummary::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -150,14 +244,52 @@ bool PlayFab::MultiplayerModels::FAssetSummary::readFromValue(const TSharedPtr<F
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
-            Metadata.Add(It.Key(), It.Value()->AsString());
+            Metadata.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
-void PlayFab::MultiplayerModels::writeAzureRegionEnumJSON(AzureRegion enumVal, JsonWriter& writer)
+bool PlayFab::MultiplayerModels::FAssetSummary::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("FileName"))
+        {
+            reader.ReadValue(FileName);
+        }
+        else if (reader.IsField("Metadata"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Metadata.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FAssetSummary();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeAzureRegionEnumValue(MultiplayerModels::AzureRegion enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -188,6 +320,16 @@ void PlayFab::MultiplayerModels::writeAzureRegionEnumJSON(AzureRegion enumVal, J
     }
 }
 
+void PlayFab::MultiplayerModels::writeAzureRegionEnumJSON(AzureRegion enumVal, JsonWriter& writer)
+{
+    writeAzureRegionEnumValue(enumVal, writer);
+}
+
+void PlayFab::MultiplayerModels::writeAzureRegionEnumJSON(AzureRegion enumVal, JsonUtf8Writer& writer)
+{
+    writeAzureRegionEnumValue(enumVal, writer);
+}
+
 MultiplayerModels::AzureRegion PlayFab::MultiplayerModels::readAzureRegionFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readAzureRegionFromValue(value.IsValid() ? value->AsString() : "");
@@ -235,7 +377,8 @@ MultiplayerModels::AzureRegion PlayFab::MultiplayerModels::readAzureRegionFromVa
     return AzureRegionAustraliaEast; // Basically critical fail
 }
 
-void PlayFab::MultiplayerModels::writeAzureVmFamilyEnumJSON(AzureVmFamily enumVal, JsonWriter& writer)
+template <typename WriterType>
+static void writeAzureVmFamilyEnumValue(MultiplayerModels::AzureVmFamily enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -258,6 +401,16 @@ void PlayFab::MultiplayerModels::writeAzureVmFamilyEnumJSON(AzureVmFamily enumVa
     }
 }
 
+void PlayFab::MultiplayerModels::writeAzureVmFamilyEnumJSON(AzureVmFamily enumVal, JsonWriter& writer)
+{
+    writeAzureVmFamilyEnumValue(enumVal, writer);
+}
+
+void PlayFab::MultiplayerModels::writeAzureVmFamilyEnumJSON(AzureVmFamily enumVal, JsonUtf8Writer& writer)
+{
+    writeAzureVmFamilyEnumValue(enumVal, writer);
+}
+
 MultiplayerModels::AzureVmFamily PlayFab::MultiplayerModels::readAzureVmFamilyFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readAzureVmFamilyFromValue(value.IsValid() ? value->AsString() : "");
@@ -297,7 +450,8 @@ MultiplayerModels::AzureVmFamily PlayFab::MultiplayerModels::readAzureVmFamilyFr
     return AzureVmFamilyA; // Basically critical fail
 }
 
-void PlayFab::MultiplayerModels::writeAzureVmSizeEnumJSON(AzureVmSize enumVal, JsonWriter& writer)
+template <typename WriterType>
+static void writeAzureVmSizeEnumValue(MultiplayerModels::AzureVmSize enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -357,6 +511,16 @@ void PlayFab::MultiplayerModels::writeAzureVmSizeEnumJSON(AzureVmSize enumVal, J
     }
 }
 
+void PlayFab::MultiplayerModels::writeAzureVmSizeEnumJSON(AzureVmSize enumVal, JsonWriter& writer)
+{
+    writeAzureVmSizeEnumValue(enumVal, writer);
+}
+
+void PlayFab::MultiplayerModels::writeAzureVmSizeEnumJSON(AzureVmSize enumVal, JsonUtf8Writer& writer)
+{
+    writeAzureVmSizeEnumValue(enumVal, writer);
+}
+
 MultiplayerModels::AzureVmSize PlayFab::MultiplayerModels::readAzureVmSizeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readAzureVmSizeFromValue(value.IsValid() ? value->AsString() : "");
@@ -438,7 +602,8 @@ PlayFab::MultiplayerModels::FBuildSelectionCriterion::~FBuildSelectionCriterion(
 
 }
 
-void PlayFab::MultiplayerModels::FBuildSelectionCriterion::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FBuildSelectionCriterion::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -456,6 +621,16 @@ void PlayFab::MultiplayerModels::FBuildSelectionCriterion::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FBuildSelectionCriterion::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FBuildSelectionCriterion::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FBuildSelectionCriterion::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -466,19 +641,53 @@ bool PlayFab::MultiplayerModels::FBuildSelectionCriterion::readFromValue(const T
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*BuildWeightDistributionObject)->Values); It; ++It)
         {
             uint32 TmpValue; It.Value()->TryGetNumber(TmpValue);
-            BuildWeightDistribution.Add(It.Key(), TmpValue);
+            BuildWeightDistribution.Emplace(It.Key(), TmpValue);
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FBuildSelectionCriterion::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildWeightDistribution"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    uint32 TmpValue;
+                    if (reader.ReadValue(TmpValue)) { BuildWeightDistribution.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FBuildSelectionCriterion();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FBuildAliasDetailsResponse::~FBuildAliasDetailsResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FBuildAliasDetailsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FBuildAliasDetailsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -506,6 +715,16 @@ void PlayFab::MultiplayerModels::FBuildAliasDetailsResponse::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FBuildAliasDetailsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FBuildAliasDetailsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FBuildAliasDetailsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -528,19 +747,61 @@ bool PlayFab::MultiplayerModels::FBuildAliasDetailsResponse::readFromValue(const
     for (int32 Idx = 0; Idx < BuildSelectionCriteriaArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BuildSelectionCriteriaArray[Idx];
-        BuildSelectionCriteria.Add(FBuildSelectionCriterion(CurrentItem->AsObject()));
+        BuildSelectionCriteria.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FBuildAliasDetailsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AliasId"))
+        {
+            reader.ReadValue(AliasId);
+        }
+        else if (reader.IsField("AliasName"))
+        {
+            reader.ReadValue(AliasName);
+        }
+        else if (reader.IsField("BuildSelectionCriteria"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { BuildSelectionCriteria[BuildSelectionCriteria.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FBuildAliasDetailsResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FBuildAliasParams::~FBuildAliasParams()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FBuildAliasParams::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FBuildAliasParams::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -557,6 +818,16 @@ void PlayFab::MultiplayerModels::FBuildAliasParams::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FBuildAliasParams::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FBuildAliasParams::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FBuildAliasParams::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -571,12 +842,39 @@ bool PlayFab::MultiplayerModels::FBuildAliasParams::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FBuildAliasParams::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AliasId"))
+        {
+            reader.ReadValue(AliasId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FBuildAliasParams();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCurrentServerStats::~FCurrentServerStats()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCurrentServerStats::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCurrentServerStats::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -595,6 +893,16 @@ void PlayFab::MultiplayerModels::FCurrentServerStats::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCurrentServerStats::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCurrentServerStats::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCurrentServerStats::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -630,12 +938,51 @@ bool PlayFab::MultiplayerModels::FCurrentServerStats::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCurrentServerStats::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Active"))
+        {
+            reader.ReadValue(Active);
+        }
+        else if (reader.IsField("Propping"))
+        {
+            reader.ReadValue(Propping);
+        }
+        else if (reader.IsField("StandingBy"))
+        {
+            reader.ReadValue(StandingBy);
+        }
+        else if (reader.IsField("Total"))
+        {
+            reader.ReadValue(Total);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCurrentServerStats();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FDynamicStandbyThreshold::~FDynamicStandbyThreshold()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FDynamicStandbyThreshold::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FDynamicStandbyThreshold::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -648,6 +995,16 @@ void PlayFab::MultiplayerModels::FDynamicStandbyThreshold::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FDynamicStandbyThreshold::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FDynamicStandbyThreshold::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FDynamicStandbyThreshold::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -669,12 +1026,43 @@ bool PlayFab::MultiplayerModels::FDynamicStandbyThreshold::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FDynamicStandbyThreshold::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Multiplier"))
+        {
+            reader.ReadValue(Multiplier);
+        }
+        else if (reader.IsField("TriggerThresholdPercentage"))
+        {
+            reader.ReadValue(TriggerThresholdPercentage);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDynamicStandbyThreshold();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FDynamicStandbySettings::~FDynamicStandbySettings()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FDynamicStandbySettings::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FDynamicStandbySettings::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -699,6 +1087,16 @@ void PlayFab::MultiplayerModels::FDynamicStandbySettings::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FDynamicStandbySettings::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FDynamicStandbySettings::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FDynamicStandbySettings::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -707,7 +1105,7 @@ bool PlayFab::MultiplayerModels::FDynamicStandbySettings::readFromValue(const TS
     for (int32 Idx = 0; Idx < DynamicFloorMultiplierThresholdsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = DynamicFloorMultiplierThresholdsArray[Idx];
-        DynamicFloorMultiplierThresholds.Add(FDynamicStandbyThreshold(CurrentItem->AsObject()));
+        DynamicFloorMultiplierThresholds.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -728,12 +1126,54 @@ bool PlayFab::MultiplayerModels::FDynamicStandbySettings::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FDynamicStandbySettings::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DynamicFloorMultiplierThresholds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { DynamicFloorMultiplierThresholds[DynamicFloorMultiplierThresholds.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("IsEnabled"))
+        {
+            reader.ReadValue(IsEnabled);
+        }
+        else if (reader.IsField("RampDownSeconds"))
+        {
+            reader.ReadValue(RampDownSeconds);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDynamicStandbySettings();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FSchedule::~FSchedule()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FSchedule::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FSchedule::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -761,6 +1201,16 @@ void PlayFab::MultiplayerModels::FSchedule::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FSchedule::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FSchedule::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FSchedule::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -806,14 +1256,61 @@ bool PlayFab::MultiplayerModels::FSchedule::readFromValue(const TSharedPtr<FJson
     return HasSucceeded;
 }
 
-PlayFab::MultiplayerModels::FScheduledStandbySettings::~FScheduledStandbySettings()
+bool PlayFab::MultiplayerModels::FSchedule::readFromReader(FPlayFabJsonPullReader& reader)
 {
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Description"))
+        {
+            reader.ReadValue(Description);
+        }
+        else if (reader.IsField("EndTime"))
+        {
+            reader.ReadValue(EndTime);
+        }
+        else if (reader.IsField("IsDisabled"))
+        {
+            reader.ReadValue(IsDisabled);
+        }
+        else if (reader.IsField("IsRecurringWeekly"))
+        {
+            reader.ReadValue(IsRecurringWeekly);
+        }
+        else if (reader.IsField("StartTime"))
+        {
+            reader.ReadValue(StartTime);
+        }
+        else if (reader.IsField("TargetStandby"))
+        {
+            reader.ReadValue(TargetStandby);
+        }
+        else
+            reader.SkipValue();
+    }
 
+    if (!reader.IsValid())
+    {
+        *this = FSchedule();
+        return false;
+    }
+    return true;
 }
 
-void PlayFab::MultiplayerModels::FScheduledStandbySettings::writeJSON(JsonWriter& writer) const
+PlayFab::MultiplayerModels::FScheduledStandbySettings::~FScheduledStandbySettings()
 {
-    writer->WriteObjectStart();
+
+}
+
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FScheduledStandbySettings::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
 
     writer->WriteIdentifierPrefix(TEXT("IsEnabled"));
     writer->WriteValue(IsEnabled);
@@ -830,6 +1327,16 @@ void PlayFab::MultiplayerModels::FScheduledStandbySettings::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FScheduledStandbySettings::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FScheduledStandbySettings::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FScheduledStandbySettings::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -845,13 +1352,50 @@ bool PlayFab::MultiplayerModels::FScheduledStandbySettings::readFromValue(const
     for (int32 Idx = 0; Idx < ScheduleListArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ScheduleListArray[Idx];
-        ScheduleList.Add(FSchedule(CurrentItem->AsObject()));
+        ScheduleList.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FScheduledStandbySettings::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("IsEnabled"))
+        {
+            reader.ReadValue(IsEnabled);
+        }
+        else if (reader.IsField("ScheduleList"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ScheduleList[ScheduleList.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FScheduledStandbySettings();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FBuildRegion::~FBuildRegion()
 {
     //if (CurrentServerStats != nullptr) delete CurrentServerStats;
@@ -860,7 +1404,8 @@ PlayFab::MultiplayerModels::FBuildRegion::~FBuildRegion()
 
 }
 
-void PlayFab::MultiplayerModels::FBuildRegion::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FBuildRegion::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -903,6 +1448,16 @@ void PlayFab::MultiplayerModels::FBuildRegion::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FBuildRegion::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FBuildRegion::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FBuildRegion::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -910,13 +1465,13 @@ bool PlayFab::MultiplayerModels::FBuildRegion::readFromValue(const TSharedPtr<FJ
     const TSharedPtr<FJsonValue> CurrentServerStatsValue = obj->TryGetField(TEXT("CurrentServerStats"));
     if (CurrentServerStatsValue.IsValid() && !CurrentServerStatsValue->IsNull())
     {
-        pfCurrentServerStats = MakeShareable(new FCurrentServerStats(CurrentServerStatsValue->AsObject()));
+        pfCurrentServerStats = MakeShared<FCurrentServerStats>(CurrentServerStatsValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> DynamicStandbySettingsValue = obj->TryGetField(TEXT("DynamicStandbySettings"));
     if (DynamicStandbySettingsValue.IsValid() && !DynamicStandbySettingsValue->IsNull())
     {
-        pfDynamicStandbySettings = MakeShareable(new FDynamicStandbySettings(DynamicStandbySettingsValue->AsObject()));
+        pfDynamicStandbySettings = MakeShared<FDynamicStandbySettings>(DynamicStandbySettingsValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> MaxServersValue = obj->TryGetField(TEXT("MaxServers"));
@@ -936,7 +1491,7 @@ bool PlayFab::MultiplayerModels::FBuildRegion::readFromValue(const TSharedPtr<FJ
     const TSharedPtr<FJsonValue> ScheduledStandbySettingsValue = obj->TryGetField(TEXT("ScheduledStandbySettings"));
     if (ScheduledStandbySettingsValue.IsValid() && !ScheduledStandbySettingsValue->IsNull())
     {
-        pfScheduledStandbySettings = MakeShareable(new FScheduledStandbySettings(ScheduledStandbySettingsValue->AsObject()));
+        pfScheduledStandbySettings = MakeShared<FScheduledStandbySettings>(ScheduledStandbySettingsValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> StandbyServersValue = obj->TryGetField(TEXT("StandbyServers"));
@@ -956,6 +1511,59 @@ bool PlayFab::MultiplayerModels::FBuildRegion::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FBuildRegion::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CurrentServerStats"))
+        {
+            pfCurrentServerStats = MakeShared<FCurrentServerStats>();
+            pfCurrentServerStats->readFromReader(reader);
+        }
+        else if (reader.IsField("DynamicStandbySettings"))
+        {
+            pfDynamicStandbySettings = MakeShared<FDynamicStandbySettings>();
+            pfDynamicStandbySettings->readFromReader(reader);
+        }
+        else if (reader.IsField("MaxServers"))
+        {
+            reader.ReadValue(MaxServers);
+        }
+        else if (reader.IsField("Region"))
+        {
+            reader.ReadValue(Region);
+        }
+        else if (reader.IsField("ScheduledStandbySettings"))
+        {
+            pfScheduledStandbySettings = MakeShared<FScheduledStandbySettings>();
+            pfScheduledStandbySettings->readFromReader(reader);
+        }
+        else if (reader.IsField("StandbyServers"))
+        {
+            reader.ReadValue(StandbyServers);
+        }
+        else if (reader.IsField("Status"))
+        {
+            reader.ReadValue(Status);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FBuildRegion();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FBuildRegionParams::~FBuildRegionParams()
 {
     //if (DynamicStandbySettings != nullptr) delete DynamicStandbySettings;
@@ -963,7 +1571,8 @@ PlayFab::MultiplayerModels::FBuildRegionParams::~FBuildRegionParams()
 
 }
 
-void PlayFab::MultiplayerModels::FBuildRegionParams::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FBuildRegionParams::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -998,6 +1607,16 @@ void PlayFab::MultiplayerModels::FBuildRegionParams::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FBuildRegionParams::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FBuildRegionParams::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FBuildRegionParams::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1005,7 +1624,7 @@ bool PlayFab::MultiplayerModels::FBuildRegionParams::readFromValue(const TShared
     const TSharedPtr<FJsonValue> DynamicStandbySettingsValue = obj->TryGetField(TEXT("DynamicStandbySettings"));
     if (DynamicStandbySettingsValue.IsValid() && !DynamicStandbySettingsValue->IsNull())
     {
-        pfDynamicStandbySettings = MakeShareable(new FDynamicStandbySettings(DynamicStandbySettingsValue->AsObject()));
+        pfDynamicStandbySettings = MakeShared<FDynamicStandbySettings>(DynamicStandbySettingsValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> MaxServersValue = obj->TryGetField(TEXT("MaxServers"));
@@ -1025,7 +1644,7 @@ bool PlayFab::MultiplayerModels::FBuildRegionParams::readFromValue(const TShared
     const TSharedPtr<FJsonValue> ScheduledStandbySettingsValue = obj->TryGetField(TEXT("ScheduledStandbySettings"));
     if (ScheduledStandbySettingsValue.IsValid() && !ScheduledStandbySettingsValue->IsNull())
     {
-        pfScheduledStandbySettings = MakeShareable(new FScheduledStandbySettings(ScheduledStandbySettingsValue->AsObject()));
+        pfScheduledStandbySettings = MakeShared<FScheduledStandbySettings>(ScheduledStandbySettingsValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> StandbyServersValue = obj->TryGetField(TEXT("StandbyServers"));
@@ -1038,12 +1657,57 @@ bool PlayFab::MultiplayerModels::FBuildRegionParams::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FBuildRegionParams::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DynamicStandbySettings"))
+        {
+            pfDynamicStandbySettings = MakeShared<FDynamicStandbySettings>();
+            pfDynamicStandbySettings->readFromReader(reader);
+        }
+        else if (reader.IsField("MaxServers"))
+        {
+            reader.ReadValue(MaxServers);
+        }
+        else if (reader.IsField("Region"))
+        {
+            reader.ReadValue(Region);
+        }
+        else if (reader.IsField("ScheduledStandbySettings"))
+        {
+            pfScheduledStandbySettings = MakeShared<FScheduledStandbySettings>();
+            pfScheduledStandbySettings->readFromReader(reader);
+        }
+        else if (reader.IsField("StandbyServers"))
+        {
+            reader.ReadValue(StandbyServers);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FBuildRegionParams();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FBuildSummary::~FBuildSummary()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FBuildSummary::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FBuildSummary::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1088,6 +1752,16 @@ void PlayFab::MultiplayerModels::FBuildSummary::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FBuildSummary::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FBuildSummary::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FBuildSummary::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1116,7 +1790,7 @@ bool PlayFab::MultiplayerModels::FBuildSummary::readFromValue(const TSharedPtr<F
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
-            Metadata.Add(It.Key(), It.Value()->AsString());
+            Metadata.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1124,19 +1798,76 @@ bool PlayFab::MultiplayerModels::FBuildSummary::readFromValue(const TSharedPtr<F
     for (int32 Idx = 0; Idx < RegionConfigurationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = RegionConfigurationsArray[Idx];
-        RegionConfigurations.Add(FBuildRegion(CurrentItem->AsObject()));
+        RegionConfigurations.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FBuildSummary::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("BuildName"))
+        {
+            reader.ReadValue(BuildName);
+        }
+        else if (reader.IsField("CreationTime"))
+        {
+            reader.ReadValue(CreationTime);
+        }
+        else if (reader.IsField("Metadata"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Metadata.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("RegionConfigurations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { RegionConfigurations[RegionConfigurations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FBuildSummary();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FEntityKey::~FEntityKey()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FEntityKey::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FEntityKey::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1159,6 +1890,16 @@ void PlayFab::MultiplayerModels::FEntityKey::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FEntityKey::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FEntityKey::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FEntityKey::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1180,13 +1921,44 @@ bool PlayFab::MultiplayerModels::FEntityKey::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FEntityKey::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Type"))
+        {
+            reader.ReadValue(Type);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityKey();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerRequest::~FCancelAllMatchmakingTicketsForPlayerRequest()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1220,6 +1992,16 @@ void PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerRequest::w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1229,14 +2011,14 @@ bool PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerRequest::r
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> QueueNameValue = obj->TryGetField(TEXT("QueueName"));
@@ -1249,18 +2031,71 @@ bool PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerRequest::r
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("QueueName"))
+        {
+            reader.ReadValue(QueueName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCancelAllMatchmakingTicketsForPlayerRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerResult::~FCancelAllMatchmakingTicketsForPlayerResult()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1268,12 +2103,34 @@ bool PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerResult::re
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCancelAllMatchmakingTicketsForPlayerResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCancelAllMatchmakingTicketsForPlayerResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerRequest::~FCancelAllServerBackfillTicketsForPlayerRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1304,6 +2161,16 @@ void PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerRequest
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1313,7 +2180,7 @@ bool PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerRequest
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1333,18 +2200,70 @@ bool PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerRequest
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("QueueName"))
+        {
+            reader.ReadValue(QueueName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCancelAllServerBackfillTicketsForPlayerRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerResult::~FCancelAllServerBackfillTicketsForPlayerResult()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1352,7 +2271,29 @@ bool PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerResult:
     return HasSucceeded;
 }
 
-void PlayFab::MultiplayerModels::writeCancellationReasonEnumJSON(CancellationReason enumVal, JsonWriter& writer)
+bool PlayFab::MultiplayerModels::FCancelAllServerBackfillTicketsForPlayerResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCancelAllServerBackfillTicketsForPlayerResult();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeCancellationReasonEnumValue(MultiplayerModels::CancellationReason enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -1363,6 +2304,16 @@ void PlayFab::MultiplayerModels::writeCancellationReasonEnumJSON(CancellationRea
     }
 }
 
+void PlayFab::MultiplayerModels::writeCancellationReasonEnumJSON(CancellationReason enumVal, JsonWriter& writer)
+{
+    writeCancellationReasonEnumValue(enumVal, writer);
+}
+
+void PlayFab::MultiplayerModels::writeCancellationReasonEnumJSON(CancellationReason enumVal, JsonUtf8Writer& writer)
+{
+    writeCancellationReasonEnumValue(enumVal, writer);
+}
+
 MultiplayerModels::CancellationReason PlayFab::MultiplayerModels::readCancellationReasonFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readCancellationReasonFromValue(value.IsValid() ? value->AsString() : "");
@@ -1395,7 +2346,8 @@ PlayFab::MultiplayerModels::FCancelMatchmakingTicketRequest::~FCancelMatchmaking
 
 }
 
-void PlayFab::MultiplayerModels::FCancelMatchmakingTicketRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCancelMatchmakingTicketRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1433,6 +2385,16 @@ void PlayFab::MultiplayerModels::FCancelMatchmakingTicketRequest::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCancelMatchmakingTicketRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCancelMatchmakingTicketRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCancelMatchmakingTicketRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1442,7 +2404,7 @@ bool PlayFab::MultiplayerModels::FCancelMatchmakingTicketRequest::readFromValue(
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1463,31 +2425,105 @@ bool PlayFab::MultiplayerModels::FCancelMatchmakingTicketRequest::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCancelMatchmakingTicketRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("QueueName"))
+        {
+            reader.ReadValue(QueueName);
+        }
+        else if (reader.IsField("TicketId"))
+        {
+            reader.ReadValue(TicketId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCancelMatchmakingTicketRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCancelMatchmakingTicketResult::~FCancelMatchmakingTicketResult()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCancelMatchmakingTicketResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCancelMatchmakingTicketResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
-bool PlayFab::MultiplayerModels::FCancelMatchmakingTicketResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
+void PlayFab::MultiplayerModels::FCancelMatchmakingTicketResult::writeJSON(JsonWriter& writer) const
 {
-    bool HasSucceeded = true;
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCancelMatchmakingTicketResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
+bool PlayFab::MultiplayerModels::FCancelMatchmakingTicketResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
+{
+    bool HasSucceeded = true;
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCancelMatchmakingTicketResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCancelMatchmakingTicketResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCancelServerBackfillTicketRequest::~FCancelServerBackfillTicketRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCancelServerBackfillTicketRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCancelServerBackfillTicketRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1525,6 +2561,16 @@ void PlayFab::MultiplayerModels::FCancelServerBackfillTicketRequest::writeJSON(J
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCancelServerBackfillTicketRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCancelServerBackfillTicketRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCancelServerBackfillTicketRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1534,7 +2580,7 @@ bool PlayFab::MultiplayerModels::FCancelServerBackfillTicketRequest::readFromVal
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1555,18 +2601,70 @@ bool PlayFab::MultiplayerModels::FCancelServerBackfillTicketRequest::readFromVal
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCancelServerBackfillTicketRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("QueueName"))
+        {
+            reader.ReadValue(QueueName);
+        }
+        else if (reader.IsField("TicketId"))
+        {
+            reader.ReadValue(TicketId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCancelServerBackfillTicketRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCancelServerBackfillTicketResult::~FCancelServerBackfillTicketResult()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCancelServerBackfillTicketResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCancelServerBackfillTicketResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCancelServerBackfillTicketResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCancelServerBackfillTicketResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCancelServerBackfillTicketResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1574,12 +2672,34 @@ bool PlayFab::MultiplayerModels::FCancelServerBackfillTicketResult::readFromValu
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCancelServerBackfillTicketResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCancelServerBackfillTicketResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCertificate::~FCertificate()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCertificate::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCertificate::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1612,6 +2732,16 @@ void PlayFab::MultiplayerModels::FCertificate::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCertificate::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCertificate::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCertificate::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1640,12 +2770,47 @@ bool PlayFab::MultiplayerModels::FCertificate::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCertificate::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Base64EncodedValue"))
+        {
+            reader.ReadValue(Base64EncodedValue);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("Password"))
+        {
+            reader.ReadValue(Password);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCertificate();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCertificateSummary::~FCertificateSummary()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCertificateSummary::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCertificateSummary::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1664,6 +2829,16 @@ void PlayFab::MultiplayerModels::FCertificateSummary::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCertificateSummary::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCertificateSummary::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCertificateSummary::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1685,12 +2860,43 @@ bool PlayFab::MultiplayerModels::FCertificateSummary::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCertificateSummary::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("Thumbprint"))
+        {
+            reader.ReadValue(Thumbprint);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCertificateSummary();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FConnectedPlayer::~FConnectedPlayer()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FConnectedPlayer::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FConnectedPlayer::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1703,6 +2909,16 @@ void PlayFab::MultiplayerModels::FConnectedPlayer::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FConnectedPlayer::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FConnectedPlayer::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FConnectedPlayer::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1717,7 +2933,34 @@ bool PlayFab::MultiplayerModels::FConnectedPlayer::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
-void PlayFab::MultiplayerModels::writeContainerFlavorEnumJSON(ContainerFlavor enumVal, JsonWriter& writer)
+bool PlayFab::MultiplayerModels::FConnectedPlayer::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PlayerId"))
+        {
+            reader.ReadValue(PlayerId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FConnectedPlayer();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeContainerFlavorEnumValue(MultiplayerModels::ContainerFlavor enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -1729,6 +2972,16 @@ void PlayFab::MultiplayerModels::writeContainerFlavorEnumJSON(ContainerFlavor en
     }
 }
 
+void PlayFab::MultiplayerModels::writeContainerFlavorEnumJSON(ContainerFlavor enumVal, JsonWriter& writer)
+{
+    writeContainerFlavorEnumValue(enumVal, writer);
+}
+
+void PlayFab::MultiplayerModels::writeContainerFlavorEnumJSON(ContainerFlavor enumVal, JsonUtf8Writer& writer)
+{
+    writeContainerFlavorEnumValue(enumVal, writer);
+}
+
 MultiplayerModels::ContainerFlavor PlayFab::MultiplayerModels::readContainerFlavorFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readContainerFlavorFromValue(value.IsValid() ? value->AsString() : "");
@@ -1762,7 +3015,8 @@ PlayFab::MultiplayerModels::FContainerImageReference::~FContainerImageReference(
 
 }
 
-void PlayFab::MultiplayerModels::FContainerImageReference::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FContainerImageReference::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1785,6 +3039,16 @@ void PlayFab::MultiplayerModels::FContainerImageReference::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FContainerImageReference::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FContainerImageReference::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FContainerImageReference::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1806,12 +3070,43 @@ bool PlayFab::MultiplayerModels::FContainerImageReference::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FContainerImageReference::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ImageName"))
+        {
+            reader.ReadValue(ImageName);
+        }
+        else if (reader.IsField("Tag"))
+        {
+            reader.ReadValue(Tag);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FContainerImageReference();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCoreCapacity::~FCoreCapacity()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCoreCapacity::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCoreCapacity::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1836,6 +3131,16 @@ void PlayFab::MultiplayerModels::FCoreCapacity::writeJSON(JsonWriter& writer) co
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCoreCapacity::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCoreCapacity::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCoreCapacity::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1866,12 +3171,52 @@ bool PlayFab::MultiplayerModels::FCoreCapacity::readFromValue(const TSharedPtr<F
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCoreCapacity::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Available"))
+        {
+            reader.ReadValue(Available);
+        }
+        else if (reader.IsField("Region"))
+        {
+            reader.ReadValue(Region);
+        }
+        else if (reader.IsField("Total"))
+        {
+            reader.ReadValue(Total);
+        }
+        else if (reader.IsField("VmFamily"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { VmFamily = readAzureVmFamilyFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCoreCapacity();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCoreCapacityChange::~FCoreCapacityChange()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCoreCapacityChange::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCoreCapacityChange::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1894,6 +3239,16 @@ void PlayFab::MultiplayerModels::FCoreCapacityChange::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCoreCapacityChange::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCoreCapacityChange::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCoreCapacityChange::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1917,12 +3272,48 @@ bool PlayFab::MultiplayerModels::FCoreCapacityChange::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCoreCapacityChange::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("NewCoreLimit"))
+        {
+            reader.ReadValue(NewCoreLimit);
+        }
+        else if (reader.IsField("Region"))
+        {
+            reader.ReadValue(Region);
+        }
+        else if (reader.IsField("VmFamily"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { VmFamily = readAzureVmFamilyFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCoreCapacityChange();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCreateBuildAliasRequest::~FCreateBuildAliasRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCreateBuildAliasRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCreateBuildAliasRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1959,6 +3350,16 @@ void PlayFab::MultiplayerModels::FCreateBuildAliasRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCreateBuildAliasRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCreateBuildAliasRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCreateBuildAliasRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1974,7 +3375,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildAliasRequest::readFromValue(const T
     for (int32 Idx = 0; Idx < BuildSelectionCriteriaArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BuildSelectionCriteriaArray[Idx];
-        BuildSelectionCriteria.Add(FBuildSelectionCriterion(CurrentItem->AsObject()));
+        BuildSelectionCriteria.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -1983,19 +3384,68 @@ bool PlayFab::MultiplayerModels::FCreateBuildAliasRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCreateBuildAliasRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AliasName"))
+        {
+            reader.ReadValue(AliasName);
+        }
+        else if (reader.IsField("BuildSelectionCriteria"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { BuildSelectionCriteria[BuildSelectionCriteria.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateBuildAliasRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGameCertificateReferenceParams::~FGameCertificateReferenceParams()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGameCertificateReferenceParams::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGameCertificateReferenceParams::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2022,6 +3472,16 @@ void PlayFab::MultiplayerModels::FGameCertificateReferenceParams::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGameCertificateReferenceParams::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGameCertificateReferenceParams::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGameCertificateReferenceParams::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2043,12 +3503,43 @@ bool PlayFab::MultiplayerModels::FGameCertificateReferenceParams::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGameCertificateReferenceParams::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GsdkAlias"))
+        {
+            reader.ReadValue(GsdkAlias);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGameCertificateReferenceParams();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FLinuxInstrumentationConfiguration::~FLinuxInstrumentationConfiguration()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FLinuxInstrumentationConfiguration::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FLinuxInstrumentationConfiguration::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2058,6 +3549,16 @@ void PlayFab::MultiplayerModels::FLinuxInstrumentationConfiguration::writeJSON(J
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FLinuxInstrumentationConfiguration::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FLinuxInstrumentationConfiguration::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FLinuxInstrumentationConfiguration::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2072,7 +3573,34 @@ bool PlayFab::MultiplayerModels::FLinuxInstrumentationConfiguration::readFromVal
     return HasSucceeded;
 }
 
-void PlayFab::MultiplayerModels::writeProtocolTypeEnumJSON(ProtocolType enumVal, JsonWriter& writer)
+bool PlayFab::MultiplayerModels::FLinuxInstrumentationConfiguration::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("IsEnabled"))
+        {
+            reader.ReadValue(IsEnabled);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FLinuxInstrumentationConfiguration();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeProtocolTypeEnumValue(MultiplayerModels::ProtocolType enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -2082,6 +3610,16 @@ void PlayFab::MultiplayerModels::writeProtocolTypeEnumJSON(ProtocolType enumVal,
     }
 }
 
+void PlayFab::MultiplayerModels::writeProtocolTypeEnumJSON(ProtocolType enumVal, JsonWriter& writer)
+{
+    writeProtocolTypeEnumValue(enumVal, writer);
+}
+
+void PlayFab::MultiplayerModels::writeProtocolTypeEnumJSON(ProtocolType enumVal, JsonUtf8Writer& writer)
+{
+    writeProtocolTypeEnumValue(enumVal, writer);
+}
+
 MultiplayerModels::ProtocolType PlayFab::MultiplayerModels::readProtocolTypeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readProtocolTypeFromValue(value.IsValid() ? value->AsString() : "");
@@ -2113,7 +3651,8 @@ PlayFab::MultiplayerModels::FPort::~FPort()
 
 }
 
-void PlayFab::MultiplayerModels::FPort::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FPort::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2136,6 +3675,16 @@ void PlayFab::MultiplayerModels::FPort::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FPort::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FPort::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FPort::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2159,6 +3708,41 @@ bool PlayFab::MultiplayerModels::FPort::readFromValue(const TSharedPtr<FJsonObje
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FPort::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("Num"))
+        {
+            reader.ReadValue(Num);
+        }
+        else if (reader.IsField("Protocol"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Protocol = readProtocolTypeFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FPort();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::~FCreateBuildWithCustomContainerRequest()
 {
     //if (ContainerImageReference != nullptr) delete ContainerImageReference;
@@ -2166,7 +3750,8 @@ PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::~FCreateBuil
 
 }
 
-void PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2280,6 +3865,16 @@ void PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::writeJS
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2303,7 +3898,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::readFro
     const TSharedPtr<FJsonValue> ContainerImageReferenceValue = obj->TryGetField(TEXT("ContainerImageReference"));
     if (ContainerImageReferenceValue.IsValid() && !ContainerImageReferenceValue->IsNull())
     {
-        pfContainerImageReference = MakeShareable(new FContainerImageReference(ContainerImageReferenceValue->AsObject()));
+        pfContainerImageReference = MakeShared<FContainerImageReference>(ContainerImageReferenceValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ContainerRunCommandValue = obj->TryGetField(TEXT("ContainerRunCommand"));
@@ -2318,7 +3913,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::readFro
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2326,7 +3921,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::readFro
     for (int32 Idx = 0; Idx < GameAssetReferencesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GameAssetReferencesArray[Idx];
-        GameAssetReferences.Add(FAssetReferenceParams(CurrentItem->AsObject()));
+        GameAssetReferences.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2334,14 +3929,14 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::readFro
     for (int32 Idx = 0; Idx < GameCertificateReferencesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GameCertificateReferencesArray[Idx];
-        GameCertificateReferences.Add(FGameCertificateReferenceParams(CurrentItem->AsObject()));
+        GameCertificateReferences.Emplace(CurrentItem->AsObject());
     }
 
 
     const TSharedPtr<FJsonValue> LinuxInstrumentationConfigurationValue = obj->TryGetField(TEXT("LinuxInstrumentationConfiguration"));
     if (LinuxInstrumentationConfigurationValue.IsValid() && !LinuxInstrumentationConfigurationValue->IsNull())
     {
-        pfLinuxInstrumentationConfiguration = MakeShareable(new FLinuxInstrumentationConfiguration(LinuxInstrumentationConfigurationValue->AsObject()));
+        pfLinuxInstrumentationConfiguration = MakeShared<FLinuxInstrumentationConfiguration>(LinuxInstrumentationConfigurationValue->AsObject());
     }
 
     const TSharedPtr<FJsonObject>* MetadataObject;
@@ -2349,7 +3944,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::readFro
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
-            Metadata.Add(It.Key(), It.Value()->AsString());
+            Metadata.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2364,7 +3959,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::readFro
     for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
+        Ports.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2372,7 +3967,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::readFro
     for (int32 Idx = 0; Idx < RegionConfigurationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = RegionConfigurationsArray[Idx];
-        RegionConfigurations.Add(FBuildRegionParams(CurrentItem->AsObject()));
+        RegionConfigurations.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2388,12 +3983,141 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::readFro
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AreAssetsReadonly"))
+        {
+            reader.ReadValue(AreAssetsReadonly);
+        }
+        else if (reader.IsField("BuildName"))
+        {
+            reader.ReadValue(BuildName);
+        }
+        else if (reader.IsField("ContainerFlavor"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfContainerFlavor = readContainerFlavorFromValue(TmpValue); }
+        }
+        else if (reader.IsField("ContainerImageReference"))
+        {
+            pfContainerImageReference = MakeShared<FContainerImageReference>();
+            pfContainerImageReference->readFromReader(reader);
+        }
+        else if (reader.IsField("ContainerRunCommand"))
+        {
+            reader.ReadValue(ContainerRunCommand);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("GameAssetReferences"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GameAssetReferences[GameAssetReferences.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("GameCertificateReferences"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GameCertificateReferences[GameCertificateReferences.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("LinuxInstrumentationConfiguration"))
+        {
+            pfLinuxInstrumentationConfiguration = MakeShared<FLinuxInstrumentationConfiguration>();
+            pfLinuxInstrumentationConfiguration->readFromReader(reader);
+        }
+        else if (reader.IsField("Metadata"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Metadata.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("MultiplayerServerCountPerVm"))
+        {
+            reader.ReadValue(MultiplayerServerCountPerVm);
+        }
+        else if (reader.IsField("Ports"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Ports[Ports.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("RegionConfigurations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { RegionConfigurations[RegionConfigurations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("UseStreamingForAssetDownloads"))
+        {
+            reader.ReadValue(UseStreamingForAssetDownloads);
+        }
+        else if (reader.IsField("VmSize"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { VmSize = readAzureVmSizeFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateBuildWithCustomContainerRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGameCertificateReference::~FGameCertificateReference()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGameCertificateReference::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGameCertificateReference::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2412,6 +4136,16 @@ void PlayFab::MultiplayerModels::FGameCertificateReference::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGameCertificateReference::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGameCertificateReference::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGameCertificateReference::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2433,6 +4167,36 @@ bool PlayFab::MultiplayerModels::FGameCertificateReference::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGameCertificateReference::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("GsdkAlias"))
+        {
+            reader.ReadValue(GsdkAlias);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGameCertificateReference();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerResponse::~FCreateBuildWithCustomContainerResponse()
 {
     //if (CustomGameContainerImage != nullptr) delete CustomGameContainerImage;
@@ -2440,7 +4204,8 @@ PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerResponse::~FCreateBui
 
 }
 
-void PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2569,6 +4334,16 @@ void PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerResponse::writeJ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2611,14 +4386,14 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerResponse::readFr
     const TSharedPtr<FJsonValue> CustomGameContainerImageValue = obj->TryGetField(TEXT("CustomGameContainerImage"));
     if (CustomGameContainerImageValue.IsValid() && !CustomGameContainerImageValue->IsNull())
     {
-        CustomGameContainerImage = MakeShareable(new FContainerImageReference(CustomGameContainerImageValue->AsObject()));
+        CustomGameContainerImage = MakeShared<FContainerImageReference>(CustomGameContainerImageValue->AsObject());
     }
 
     const TArray<TSharedPtr<FJsonValue>>&GameAssetReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameAssetReferences"));
     for (int32 Idx = 0; Idx < GameAssetReferencesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GameAssetReferencesArray[Idx];
-        GameAssetReferences.Add(FAssetReference(CurrentItem->AsObject()));
+        GameAssetReferences.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2626,14 +4401,14 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerResponse::readFr
     for (int32 Idx = 0; Idx < GameCertificateReferencesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GameCertificateReferencesArray[Idx];
-        GameCertificateReferences.Add(FGameCertificateReference(CurrentItem->AsObject()));
+        GameCertificateReferences.Emplace(CurrentItem->AsObject());
     }
 
 
     const TSharedPtr<FJsonValue> LinuxInstrumentationConfigurationValue = obj->TryGetField(TEXT("LinuxInstrumentationConfiguration"));
     if (LinuxInstrumentationConfigurationValue.IsValid() && !LinuxInstrumentationConfigurationValue->IsNull())
     {
-        pfLinuxInstrumentationConfiguration = MakeShareable(new FLinuxInstrumentationConfiguration(LinuxInstrumentationConfigurationValue->AsObject()));
+        pfLinuxInstrumentationConfiguration = MakeShared<FLinuxInstrumentationConfiguration>(LinuxInstrumentationConfigurationValue->AsObject());
     }
 
     const TSharedPtr<FJsonObject>* MetadataObject;
@@ -2641,7 +4416,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerResponse::readFr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
-            Metadata.Add(It.Key(), It.Value()->AsString());
+            Metadata.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2663,7 +4438,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerResponse::readFr
     for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
+        Ports.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2671,7 +4446,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerResponse::readFr
     for (int32 Idx = 0; Idx < RegionConfigurationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = RegionConfigurationsArray[Idx];
-        RegionConfigurations.Add(FBuildRegion(CurrentItem->AsObject()));
+        RegionConfigurations.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2694,12 +4469,146 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerResponse::readFr
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCreateBuildWithCustomContainerResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AreAssetsReadonly"))
+        {
+            reader.ReadValue(AreAssetsReadonly);
+        }
+        else if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("BuildName"))
+        {
+            reader.ReadValue(BuildName);
+        }
+        else if (reader.IsField("ContainerFlavor"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfContainerFlavor = readContainerFlavorFromValue(TmpValue); }
+        }
+        else if (reader.IsField("ContainerRunCommand"))
+        {
+            reader.ReadValue(ContainerRunCommand);
+        }
+        else if (reader.IsField("CreationTime"))
+        {
+            reader.ReadValue(CreationTime);
+        }
+        else if (reader.IsField("CustomGameContainerImage"))
+        {
+            CustomGameContainerImage = MakeShared<FContainerImageReference>();
+            CustomGameContainerImage->readFromReader(reader);
+        }
+        else if (reader.IsField("GameAssetReferences"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GameAssetReferences[GameAssetReferences.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("GameCertificateReferences"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GameCertificateReferences[GameCertificateReferences.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("LinuxInstrumentationConfiguration"))
+        {
+            pfLinuxInstrumentationConfiguration = MakeShared<FLinuxInstrumentationConfiguration>();
+            pfLinuxInstrumentationConfiguration->readFromReader(reader);
+        }
+        else if (reader.IsField("Metadata"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Metadata.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("MultiplayerServerCountPerVm"))
+        {
+            reader.ReadValue(MultiplayerServerCountPerVm);
+        }
+        else if (reader.IsField("OsPlatform"))
+        {
+            reader.ReadValue(OsPlatform);
+        }
+        else if (reader.IsField("Ports"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Ports[Ports.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("RegionConfigurations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { RegionConfigurations[RegionConfigurations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("ServerType"))
+        {
+            reader.ReadValue(ServerType);
+        }
+        else if (reader.IsField("UseStreamingForAssetDownloads"))
+        {
+            reader.ReadValue(UseStreamingForAssetDownloads);
+        }
+        else if (reader.IsField("VmSize"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { VmSize = readAzureVmSizeFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateBuildWithCustomContainerResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FInstrumentationConfiguration::~FInstrumentationConfiguration()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FInstrumentationConfiguration::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FInstrumentationConfiguration::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2715,6 +4624,16 @@ void PlayFab::MultiplayerModels::FInstrumentationConfiguration::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FInstrumentationConfiguration::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FInstrumentationConfiguration::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FInstrumentationConfiguration::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2724,13 +4643,47 @@ bool PlayFab::MultiplayerModels::FInstrumentationConfiguration::readFromValue(co
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FInstrumentationConfiguration::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ProcessesToMonitor"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ProcessesToMonitor.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FInstrumentationConfiguration();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::~FCreateBuildWithManagedContainerRequest()
 {
     //if (InstrumentationConfiguration != nullptr) delete InstrumentationConfiguration;
 
 }
 
-void PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -2845,6 +4798,16 @@ void PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::writeJ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -2870,7 +4833,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::readFr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2878,7 +4841,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::readFr
     for (int32 Idx = 0; Idx < GameAssetReferencesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GameAssetReferencesArray[Idx];
-        GameAssetReferences.Add(FAssetReferenceParams(CurrentItem->AsObject()));
+        GameAssetReferences.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2886,7 +4849,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::readFr
     for (int32 Idx = 0; Idx < GameCertificateReferencesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GameCertificateReferencesArray[Idx];
-        GameCertificateReferences.Add(FGameCertificateReferenceParams(CurrentItem->AsObject()));
+        GameCertificateReferences.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2900,7 +4863,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::readFr
     const TSharedPtr<FJsonValue> InstrumentationConfigurationValue = obj->TryGetField(TEXT("InstrumentationConfiguration"));
     if (InstrumentationConfigurationValue.IsValid() && !InstrumentationConfigurationValue->IsNull())
     {
-        pfInstrumentationConfiguration = MakeShareable(new FInstrumentationConfiguration(InstrumentationConfigurationValue->AsObject()));
+        pfInstrumentationConfiguration = MakeShared<FInstrumentationConfiguration>(InstrumentationConfigurationValue->AsObject());
     }
 
     const TSharedPtr<FJsonObject>* MetadataObject;
@@ -2908,7 +4871,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::readFr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
-            Metadata.Add(It.Key(), It.Value()->AsString());
+            Metadata.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -2923,7 +4886,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::readFr
     for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
+        Ports.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2931,7 +4894,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::readFr
     for (int32 Idx = 0; Idx < RegionConfigurationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = RegionConfigurationsArray[Idx];
-        RegionConfigurations.Add(FBuildRegionParams(CurrentItem->AsObject()));
+        RegionConfigurations.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -2954,13 +4917,141 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::readFr
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AreAssetsReadonly"))
+        {
+            reader.ReadValue(AreAssetsReadonly);
+        }
+        else if (reader.IsField("BuildName"))
+        {
+            reader.ReadValue(BuildName);
+        }
+        else if (reader.IsField("ContainerFlavor"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfContainerFlavor = readContainerFlavorFromValue(TmpValue); }
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("GameAssetReferences"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GameAssetReferences[GameAssetReferences.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("GameCertificateReferences"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GameCertificateReferences[GameCertificateReferences.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("GameWorkingDirectory"))
+        {
+            reader.ReadValue(GameWorkingDirectory);
+        }
+        else if (reader.IsField("InstrumentationConfiguration"))
+        {
+            pfInstrumentationConfiguration = MakeShared<FInstrumentationConfiguration>();
+            pfInstrumentationConfiguration->readFromReader(reader);
+        }
+        else if (reader.IsField("Metadata"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Metadata.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("MultiplayerServerCountPerVm"))
+        {
+            reader.ReadValue(MultiplayerServerCountPerVm);
+        }
+        else if (reader.IsField("Ports"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Ports[Ports.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("RegionConfigurations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { RegionConfigurations[RegionConfigurations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("StartMultiplayerServerCommand"))
+        {
+            reader.ReadValue(StartMultiplayerServerCommand);
+        }
+        else if (reader.IsField("UseStreamingForAssetDownloads"))
+        {
+            reader.ReadValue(UseStreamingForAssetDownloads);
+        }
+        else if (reader.IsField("VmSize"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { VmSize = readAzureVmSizeFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateBuildWithManagedContainerRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerResponse::~FCreateBuildWithManagedContainerResponse()
 {
     //if (InstrumentationConfiguration != nullptr) delete InstrumentationConfiguration;
 
 }
 
-void PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3089,6 +5180,16 @@ void PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerResponse::write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3125,7 +5226,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerResponse::readF
     for (int32 Idx = 0; Idx < GameAssetReferencesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GameAssetReferencesArray[Idx];
-        GameAssetReferences.Add(FAssetReference(CurrentItem->AsObject()));
+        GameAssetReferences.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -3133,7 +5234,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerResponse::readF
     for (int32 Idx = 0; Idx < GameCertificateReferencesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GameCertificateReferencesArray[Idx];
-        GameCertificateReferences.Add(FGameCertificateReference(CurrentItem->AsObject()));
+        GameCertificateReferences.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -3147,7 +5248,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerResponse::readF
     const TSharedPtr<FJsonValue> InstrumentationConfigurationValue = obj->TryGetField(TEXT("InstrumentationConfiguration"));
     if (InstrumentationConfigurationValue.IsValid() && !InstrumentationConfigurationValue->IsNull())
     {
-        pfInstrumentationConfiguration = MakeShareable(new FInstrumentationConfiguration(InstrumentationConfigurationValue->AsObject()));
+        pfInstrumentationConfiguration = MakeShared<FInstrumentationConfiguration>(InstrumentationConfigurationValue->AsObject());
     }
 
     const TSharedPtr<FJsonObject>* MetadataObject;
@@ -3155,7 +5256,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerResponse::readF
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
-            Metadata.Add(It.Key(), It.Value()->AsString());
+            Metadata.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -3177,7 +5278,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerResponse::readF
     for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
+        Ports.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -3185,7 +5286,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerResponse::readF
     for (int32 Idx = 0; Idx < RegionConfigurationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = RegionConfigurationsArray[Idx];
-        RegionConfigurations.Add(FBuildRegion(CurrentItem->AsObject()));
+        RegionConfigurations.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -3203,16 +5304,148 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerResponse::readF
         if (StartMultiplayerServerCommandValue->TryGetString(TmpValue)) { StartMultiplayerServerCommand = TmpValue; }
     }
 
-    const TSharedPtr<FJsonValue> UseStreamingForAssetDownloadsValue = obj->TryGetField(TEXT("UseStreamingForAssetDownloads"));
-    if (UseStreamingForAssetDownloadsValue.IsValid() && !UseStreamingForAssetDownloadsValue->IsNull())
+    const TSharedPtr<FJsonValue> UseStreamingForAssetDownloadsValue = obj->TryGetField(TEXT("UseStreamingForAssetDownloads"));
+    if (UseStreamingForAssetDownloadsValue.IsValid() && !UseStreamingForAssetDownloadsValue->IsNull())
+    {
+        bool TmpValue;
+        if (UseStreamingForAssetDownloadsValue->TryGetBool(TmpValue)) { UseStreamingForAssetDownloads = TmpValue; }
+    }
+
+    VmSize = readAzureVmSizeFromValue(obj->TryGetField(TEXT("VmSize")));
+
+    return HasSucceeded;
+}
+
+bool PlayFab::MultiplayerModels::FCreateBuildWithManagedContainerResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AreAssetsReadonly"))
+        {
+            reader.ReadValue(AreAssetsReadonly);
+        }
+        else if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("BuildName"))
+        {
+            reader.ReadValue(BuildName);
+        }
+        else if (reader.IsField("ContainerFlavor"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfContainerFlavor = readContainerFlavorFromValue(TmpValue); }
+        }
+        else if (reader.IsField("CreationTime"))
+        {
+            reader.ReadValue(CreationTime);
+        }
+        else if (reader.IsField("GameAssetReferences"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GameAssetReferences[GameAssetReferences.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("GameCertificateReferences"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GameCertificateReferences[GameCertificateReferences.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("GameWorkingDirectory"))
+        {
+            reader.ReadValue(GameWorkingDirectory);
+        }
+        else if (reader.IsField("InstrumentationConfiguration"))
+        {
+            pfInstrumentationConfiguration = MakeShared<FInstrumentationConfiguration>();
+            pfInstrumentationConfiguration->readFromReader(reader);
+        }
+        else if (reader.IsField("Metadata"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Metadata.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("MultiplayerServerCountPerVm"))
+        {
+            reader.ReadValue(MultiplayerServerCountPerVm);
+        }
+        else if (reader.IsField("OsPlatform"))
+        {
+            reader.ReadValue(OsPlatform);
+        }
+        else if (reader.IsField("Ports"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Ports[Ports.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("RegionConfigurations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { RegionConfigurations[RegionConfigurations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("ServerType"))
+        {
+            reader.ReadValue(ServerType);
+        }
+        else if (reader.IsField("StartMultiplayerServerCommand"))
+        {
+            reader.ReadValue(StartMultiplayerServerCommand);
+        }
+        else if (reader.IsField("UseStreamingForAssetDownloads"))
+        {
+            reader.ReadValue(UseStreamingForAssetDownloads);
+        }
+        else if (reader.IsField("VmSize"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { VmSize = readAzureVmSizeFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
     {
-        bool TmpValue;
-        if (UseStreamingForAssetDownloadsValue->TryGetBool(TmpValue)) { UseStreamingForAssetDownloads = TmpValue; }
+        *this = FCreateBuildWithManagedContainerResponse();
+        return false;
     }
-
-    VmSize = readAzureVmSizeFromValue(obj->TryGetField(TEXT("VmSize")));
-
-    return HasSucceeded;
+    return true;
 }
 
 PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::~FCreateBuildWithProcessBasedServerRequest()
@@ -3221,7 +5454,8 @@ PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::~FCreateB
 
 }
 
-void PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3342,6 +5576,16 @@ void PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3365,7 +5609,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::read
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -3373,7 +5617,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::read
     for (int32 Idx = 0; Idx < GameAssetReferencesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GameAssetReferencesArray[Idx];
-        GameAssetReferences.Add(FAssetReferenceParams(CurrentItem->AsObject()));
+        GameAssetReferences.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -3381,7 +5625,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::read
     for (int32 Idx = 0; Idx < GameCertificateReferencesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GameCertificateReferencesArray[Idx];
-        GameCertificateReferences.Add(FGameCertificateReferenceParams(CurrentItem->AsObject()));
+        GameCertificateReferences.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -3395,7 +5639,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::read
     const TSharedPtr<FJsonValue> InstrumentationConfigurationValue = obj->TryGetField(TEXT("InstrumentationConfiguration"));
     if (InstrumentationConfigurationValue.IsValid() && !InstrumentationConfigurationValue->IsNull())
     {
-        pfInstrumentationConfiguration = MakeShareable(new FInstrumentationConfiguration(InstrumentationConfigurationValue->AsObject()));
+        pfInstrumentationConfiguration = MakeShared<FInstrumentationConfiguration>(InstrumentationConfigurationValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> IsOSPreviewValue = obj->TryGetField(TEXT("IsOSPreview"));
@@ -3410,7 +5654,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::read
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
-            Metadata.Add(It.Key(), It.Value()->AsString());
+            Metadata.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -3432,7 +5676,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::read
     for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
+        Ports.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -3440,7 +5684,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::read
     for (int32 Idx = 0; Idx < RegionConfigurationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = RegionConfigurationsArray[Idx];
-        RegionConfigurations.Add(FBuildRegionParams(CurrentItem->AsObject()));
+        RegionConfigurations.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -3463,13 +5707,144 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::read
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AreAssetsReadonly"))
+        {
+            reader.ReadValue(AreAssetsReadonly);
+        }
+        else if (reader.IsField("BuildName"))
+        {
+            reader.ReadValue(BuildName);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("GameAssetReferences"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GameAssetReferences[GameAssetReferences.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("GameCertificateReferences"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GameCertificateReferences[GameCertificateReferences.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("GameWorkingDirectory"))
+        {
+            reader.ReadValue(GameWorkingDirectory);
+        }
+        else if (reader.IsField("InstrumentationConfiguration"))
+        {
+            pfInstrumentationConfiguration = MakeShared<FInstrumentationConfiguration>();
+            pfInstrumentationConfiguration->readFromReader(reader);
+        }
+        else if (reader.IsField("IsOSPreview"))
+        {
+            reader.ReadValue(IsOSPreview);
+        }
+        else if (reader.IsField("Metadata"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Metadata.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("MultiplayerServerCountPerVm"))
+        {
+            reader.ReadValue(MultiplayerServerCountPerVm);
+        }
+        else if (reader.IsField("OsPlatform"))
+        {
+            reader.ReadValue(OsPlatform);
+        }
+        else if (reader.IsField("Ports"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Ports[Ports.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("RegionConfigurations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { RegionConfigurations[RegionConfigurations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("StartMultiplayerServerCommand"))
+        {
+            reader.ReadValue(StartMultiplayerServerCommand);
+        }
+        else if (reader.IsField("UseStreamingForAssetDownloads"))
+        {
+            reader.ReadValue(UseStreamingForAssetDownloads);
+        }
+        else if (reader.IsField("VmSize"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { VmSize = readAzureVmSizeFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateBuildWithProcessBasedServerRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerResponse::~FCreateBuildWithProcessBasedServerResponse()
 {
     //if (InstrumentationConfiguration != nullptr) delete InstrumentationConfiguration;
 
 }
 
-void PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3604,6 +5979,16 @@ void PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerResponse::wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3640,7 +6025,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerResponse::rea
     for (int32 Idx = 0; Idx < GameAssetReferencesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GameAssetReferencesArray[Idx];
-        GameAssetReferences.Add(FAssetReference(CurrentItem->AsObject()));
+        GameAssetReferences.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -3648,7 +6033,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerResponse::rea
     for (int32 Idx = 0; Idx < GameCertificateReferencesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GameCertificateReferencesArray[Idx];
-        GameCertificateReferences.Add(FGameCertificateReference(CurrentItem->AsObject()));
+        GameCertificateReferences.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -3662,7 +6047,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerResponse::rea
     const TSharedPtr<FJsonValue> InstrumentationConfigurationValue = obj->TryGetField(TEXT("InstrumentationConfiguration"));
     if (InstrumentationConfigurationValue.IsValid() && !InstrumentationConfigurationValue->IsNull())
     {
-        pfInstrumentationConfiguration = MakeShareable(new FInstrumentationConfiguration(InstrumentationConfigurationValue->AsObject()));
+        pfInstrumentationConfiguration = MakeShared<FInstrumentationConfiguration>(InstrumentationConfigurationValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> IsOSPreviewValue = obj->TryGetField(TEXT("IsOSPreview"));
@@ -3677,7 +6062,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerResponse::rea
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
-            Metadata.Add(It.Key(), It.Value()->AsString());
+            Metadata.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -3699,7 +6084,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerResponse::rea
     for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
+        Ports.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -3707,7 +6092,7 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerResponse::rea
     for (int32 Idx = 0; Idx < RegionConfigurationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = RegionConfigurationsArray[Idx];
-        RegionConfigurations.Add(FBuildRegion(CurrentItem->AsObject()));
+        RegionConfigurations.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -3737,12 +6122,149 @@ bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerResponse::rea
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCreateBuildWithProcessBasedServerResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AreAssetsReadonly"))
+        {
+            reader.ReadValue(AreAssetsReadonly);
+        }
+        else if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("BuildName"))
+        {
+            reader.ReadValue(BuildName);
+        }
+        else if (reader.IsField("ContainerFlavor"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfContainerFlavor = readContainerFlavorFromValue(TmpValue); }
+        }
+        else if (reader.IsField("CreationTime"))
+        {
+            reader.ReadValue(CreationTime);
+        }
+        else if (reader.IsField("GameAssetReferences"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GameAssetReferences[GameAssetReferences.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("GameCertificateReferences"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GameCertificateReferences[GameCertificateReferences.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("GameWorkingDirectory"))
+        {
+            reader.ReadValue(GameWorkingDirectory);
+        }
+        else if (reader.IsField("InstrumentationConfiguration"))
+        {
+            pfInstrumentationConfiguration = MakeShared<FInstrumentationConfiguration>();
+            pfInstrumentationConfiguration->readFromReader(reader);
+        }
+        else if (reader.IsField("IsOSPreview"))
+        {
+            reader.ReadValue(IsOSPreview);
+        }
+        else if (reader.IsField("Metadata"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Metadata.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("MultiplayerServerCountPerVm"))
+        {
+            reader.ReadValue(MultiplayerServerCountPerVm);
+        }
+        else if (reader.IsField("OsPlatform"))
+        {
+            reader.ReadValue(OsPlatform);
+        }
+        else if (reader.IsField("Ports"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Ports[Ports.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("RegionConfigurations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { RegionConfigurations[RegionConfigurations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("ServerType"))
+        {
+            reader.ReadValue(ServerType);
+        }
+        else if (reader.IsField("StartMultiplayerServerCommand"))
+        {
+            reader.ReadValue(StartMultiplayerServerCommand);
+        }
+        else if (reader.IsField("UseStreamingForAssetDownloads"))
+        {
+            reader.ReadValue(UseStreamingForAssetDownloads);
+        }
+        else if (reader.IsField("VmSize"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { VmSize = readAzureVmSizeFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateBuildWithProcessBasedServerResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FMatchmakingPlayerAttributes::~FMatchmakingPlayerAttributes()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FMatchmakingPlayerAttributes::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FMatchmakingPlayerAttributes::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3761,6 +6283,16 @@ void PlayFab::MultiplayerModels::FMatchmakingPlayerAttributes::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FMatchmakingPlayerAttributes::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FMatchmakingPlayerAttributes::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FMatchmakingPlayerAttributes::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3781,13 +6313,44 @@ bool PlayFab::MultiplayerModels::FMatchmakingPlayerAttributes::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FMatchmakingPlayerAttributes::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DataObject"))
+        {
+            DataObject.readFromReader(reader);
+        }
+        else if (reader.IsField("EscapedDataObject"))
+        {
+            reader.ReadValue(EscapedDataObject);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FMatchmakingPlayerAttributes();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FMatchmakingPlayer::~FMatchmakingPlayer()
 {
     //if (Attributes != nullptr) delete Attributes;
 
 }
 
-void PlayFab::MultiplayerModels::FMatchmakingPlayer::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FMatchmakingPlayer::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3803,6 +6366,16 @@ void PlayFab::MultiplayerModels::FMatchmakingPlayer::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FMatchmakingPlayer::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FMatchmakingPlayer::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FMatchmakingPlayer::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3810,7 +6383,7 @@ bool PlayFab::MultiplayerModels::FMatchmakingPlayer::readFromValue(const TShared
     const TSharedPtr<FJsonValue> AttributesValue = obj->TryGetField(TEXT("Attributes"));
     if (AttributesValue.IsValid() && !AttributesValue->IsNull())
     {
-        Attributes = MakeShareable(new FMatchmakingPlayerAttributes(AttributesValue->AsObject()));
+        Attributes = MakeShared<FMatchmakingPlayerAttributes>(AttributesValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
@@ -3822,12 +6395,44 @@ bool PlayFab::MultiplayerModels::FMatchmakingPlayer::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FMatchmakingPlayer::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Attributes"))
+        {
+            Attributes = MakeShared<FMatchmakingPlayerAttributes>();
+            Attributes->readFromReader(reader);
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FMatchmakingPlayer();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCreateMatchmakingTicketRequest::~FCreateMatchmakingTicketRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCreateMatchmakingTicketRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCreateMatchmakingTicketRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3870,6 +6475,16 @@ void PlayFab::MultiplayerModels::FCreateMatchmakingTicketRequest::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCreateMatchmakingTicketRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCreateMatchmakingTicketRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCreateMatchmakingTicketRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3885,7 +6500,7 @@ bool PlayFab::MultiplayerModels::FCreateMatchmakingTicketRequest::readFromValue(
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -3900,7 +6515,7 @@ bool PlayFab::MultiplayerModels::FCreateMatchmakingTicketRequest::readFromValue(
     for (int32 Idx = 0; Idx < MembersToMatchWithArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = MembersToMatchWithArray[Idx];
-        MembersToMatchWith.Add(FEntityKey(CurrentItem->AsObject()));
+        MembersToMatchWith.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -3914,12 +6529,69 @@ bool PlayFab::MultiplayerModels::FCreateMatchmakingTicketRequest::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCreateMatchmakingTicketRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Creator"))
+        {
+            Creator.readFromReader(reader);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("GiveUpAfterSeconds"))
+        {
+            reader.ReadValue(GiveUpAfterSeconds);
+        }
+        else if (reader.IsField("MembersToMatchWith"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { MembersToMatchWith[MembersToMatchWith.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("QueueName"))
+        {
+            reader.ReadValue(QueueName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateMatchmakingTicketRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCreateMatchmakingTicketResult::~FCreateMatchmakingTicketResult()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCreateMatchmakingTicketResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCreateMatchmakingTicketResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -3936,6 +6608,16 @@ void PlayFab::MultiplayerModels::FCreateMatchmakingTicketResult::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCreateMatchmakingTicketResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCreateMatchmakingTicketResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCreateMatchmakingTicketResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -3950,12 +6632,39 @@ bool PlayFab::MultiplayerModels::FCreateMatchmakingTicketResult::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCreateMatchmakingTicketResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TicketId"))
+        {
+            reader.ReadValue(TicketId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateMatchmakingTicketResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCreateRemoteUserRequest::~FCreateRemoteUserRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCreateRemoteUserRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCreateRemoteUserRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4019,6 +6728,16 @@ void PlayFab::MultiplayerModels::FCreateRemoteUserRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCreateRemoteUserRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCreateRemoteUserRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCreateRemoteUserRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4035,7 +6754,7 @@ bool PlayFab::MultiplayerModels::FCreateRemoteUserRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -4058,14 +6777,67 @@ bool PlayFab::MultiplayerModels::FCreateRemoteUserRequest::readFromValue(const T
         if (UsernameValue->TryGetString(TmpValue)) { Username = TmpValue; }
     }
 
-    const TSharedPtr<FJsonValue> VmIdValue = obj->TryGetField(TEXT("VmId"));
-    if (VmIdValue.IsValid() && !VmIdValue->IsNull())
+    const TSharedPtr<FJsonValue> VmIdValue = obj->TryGetField(TEXT("VmId"));
+    if (VmIdValue.IsValid() && !VmIdValue->IsNull())
+    {
+        FString TmpValue;
+        if (VmIdValue->TryGetString(TmpValue)) { VmId = TmpValue; }
+    }
+
+    return HasSucceeded;
+}
+
+bool PlayFab::MultiplayerModels::FCreateRemoteUserRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ExpirationTime"))
+        {
+            reader.ReadValue(ExpirationTime);
+        }
+        else if (reader.IsField("Region"))
+        {
+            reader.ReadValue(Region);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else if (reader.IsField("VmId"))
+        {
+            reader.ReadValue(VmId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
     {
-        FString TmpValue;
-        if (VmIdValue->TryGetString(TmpValue)) { VmId = TmpValue; }
+        *this = FCreateRemoteUserRequest();
+        return false;
     }
-
-    return HasSucceeded;
+    return true;
 }
 
 PlayFab::MultiplayerModels::FCreateRemoteUserResponse::~FCreateRemoteUserResponse()
@@ -4073,7 +6845,8 @@ PlayFab::MultiplayerModels::FCreateRemoteUserResponse::~FCreateRemoteUserRespons
 
 }
 
-void PlayFab::MultiplayerModels::FCreateRemoteUserResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCreateRemoteUserResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4098,6 +6871,16 @@ void PlayFab::MultiplayerModels::FCreateRemoteUserResponse::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCreateRemoteUserResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCreateRemoteUserResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCreateRemoteUserResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4124,13 +6907,48 @@ bool PlayFab::MultiplayerModels::FCreateRemoteUserResponse::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCreateRemoteUserResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ExpirationTime"))
+        {
+            reader.ReadValue(ExpirationTime);
+        }
+        else if (reader.IsField("Password"))
+        {
+            reader.ReadValue(Password);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateRemoteUserResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FMatchmakingPlayerWithTeamAssignment::~FMatchmakingPlayerWithTeamAssignment()
 {
     //if (Attributes != nullptr) delete Attributes;
 
 }
 
-void PlayFab::MultiplayerModels::FMatchmakingPlayerWithTeamAssignment::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FMatchmakingPlayerWithTeamAssignment::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4152,6 +6970,16 @@ void PlayFab::MultiplayerModels::FMatchmakingPlayerWithTeamAssignment::writeJSON
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FMatchmakingPlayerWithTeamAssignment::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FMatchmakingPlayerWithTeamAssignment::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FMatchmakingPlayerWithTeamAssignment::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4159,7 +6987,7 @@ bool PlayFab::MultiplayerModels::FMatchmakingPlayerWithTeamAssignment::readFromV
     const TSharedPtr<FJsonValue> AttributesValue = obj->TryGetField(TEXT("Attributes"));
     if (AttributesValue.IsValid() && !AttributesValue->IsNull())
     {
-        Attributes = MakeShareable(new FMatchmakingPlayerAttributes(AttributesValue->AsObject()));
+        Attributes = MakeShared<FMatchmakingPlayerAttributes>(AttributesValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
@@ -4178,12 +7006,48 @@ bool PlayFab::MultiplayerModels::FMatchmakingPlayerWithTeamAssignment::readFromV
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FMatchmakingPlayerWithTeamAssignment::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Attributes"))
+        {
+            Attributes = MakeShared<FMatchmakingPlayerAttributes>();
+            Attributes->readFromReader(reader);
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("TeamId"))
+        {
+            reader.ReadValue(TeamId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FMatchmakingPlayerWithTeamAssignment();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FServerDetails::~FServerDetails()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FServerDetails::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FServerDetails::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4217,6 +7081,16 @@ void PlayFab::MultiplayerModels::FServerDetails::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FServerDetails::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FServerDetails::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FServerDetails::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4239,7 +7113,7 @@ bool PlayFab::MultiplayerModels::FServerDetails::readFromValue(const TSharedPtr<
     for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
+        Ports.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -4253,13 +7127,59 @@ bool PlayFab::MultiplayerModels::FServerDetails::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FServerDetails::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Fqdn"))
+        {
+            reader.ReadValue(Fqdn);
+        }
+        else if (reader.IsField("IPV4Address"))
+        {
+            reader.ReadValue(IPV4Address);
+        }
+        else if (reader.IsField("Ports"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Ports[Ports.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Region"))
+        {
+            reader.ReadValue(Region);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FServerDetails();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCreateServerBackfillTicketRequest::~FCreateServerBackfillTicketRequest()
 {
     //if (ServerDetails != nullptr) delete ServerDetails;
 
 }
 
-void PlayFab::MultiplayerModels::FCreateServerBackfillTicketRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCreateServerBackfillTicketRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4302,6 +7222,16 @@ void PlayFab::MultiplayerModels::FCreateServerBackfillTicketRequest::writeJSON(J
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCreateServerBackfillTicketRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCreateServerBackfillTicketRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCreateServerBackfillTicketRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4311,7 +7241,7 @@ bool PlayFab::MultiplayerModels::FCreateServerBackfillTicketRequest::readFromVal
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -4326,7 +7256,7 @@ bool PlayFab::MultiplayerModels::FCreateServerBackfillTicketRequest::readFromVal
     for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FMatchmakingPlayerWithTeamAssignment(CurrentItem->AsObject()));
+        Members.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -4340,18 +7270,76 @@ bool PlayFab::MultiplayerModels::FCreateServerBackfillTicketRequest::readFromVal
     const TSharedPtr<FJsonValue> ServerDetailsValue = obj->TryGetField(TEXT("ServerDetails"));
     if (ServerDetailsValue.IsValid() && !ServerDetailsValue->IsNull())
     {
-        pfServerDetails = MakeShareable(new FServerDetails(ServerDetailsValue->AsObject()));
+        pfServerDetails = MakeShared<FServerDetails>(ServerDetailsValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCreateServerBackfillTicketRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("GiveUpAfterSeconds"))
+        {
+            reader.ReadValue(GiveUpAfterSeconds);
+        }
+        else if (reader.IsField("Members"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Members[Members.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("QueueName"))
+        {
+            reader.ReadValue(QueueName);
+        }
+        else if (reader.IsField("ServerDetails"))
+        {
+            pfServerDetails = MakeShared<FServerDetails>();
+            pfServerDetails->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateServerBackfillTicketRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCreateServerBackfillTicketResult::~FCreateServerBackfillTicketResult()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCreateServerBackfillTicketResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCreateServerBackfillTicketResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4368,6 +7356,16 @@ void PlayFab::MultiplayerModels::FCreateServerBackfillTicketResult::writeJSON(Js
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCreateServerBackfillTicketResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCreateServerBackfillTicketResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCreateServerBackfillTicketResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4382,12 +7380,39 @@ bool PlayFab::MultiplayerModels::FCreateServerBackfillTicketResult::readFromValu
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCreateServerBackfillTicketResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TicketId"))
+        {
+            reader.ReadValue(TicketId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateServerBackfillTicketResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCreateServerMatchmakingTicketRequest::~FCreateServerMatchmakingTicketRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCreateServerMatchmakingTicketRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCreateServerMatchmakingTicketRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4424,6 +7449,16 @@ void PlayFab::MultiplayerModels::FCreateServerMatchmakingTicketRequest::writeJSO
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCreateServerMatchmakingTicketRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCreateServerMatchmakingTicketRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCreateServerMatchmakingTicketRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4433,7 +7468,7 @@ bool PlayFab::MultiplayerModels::FCreateServerMatchmakingTicketRequest::readFrom
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -4448,7 +7483,7 @@ bool PlayFab::MultiplayerModels::FCreateServerMatchmakingTicketRequest::readFrom
     for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FMatchmakingPlayer(CurrentItem->AsObject()));
+        Members.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -4462,12 +7497,65 @@ bool PlayFab::MultiplayerModels::FCreateServerMatchmakingTicketRequest::readFrom
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCreateServerMatchmakingTicketRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("GiveUpAfterSeconds"))
+        {
+            reader.ReadValue(GiveUpAfterSeconds);
+        }
+        else if (reader.IsField("Members"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Members[Members.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("QueueName"))
+        {
+            reader.ReadValue(QueueName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateServerMatchmakingTicketRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeRequest::~FCreateTitleMultiplayerServersQuotaChangeRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4515,6 +7603,16 @@ void PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeReques
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4530,7 +7628,7 @@ bool PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeReques
     for (int32 Idx = 0; Idx < ChangesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ChangesArray[Idx];
-        Changes.Add(FCoreCapacityChange(CurrentItem->AsObject()));
+        Changes.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -4546,7 +7644,7 @@ bool PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeReques
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -4565,12 +7663,73 @@ bool PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeReques
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ChangeDescription"))
+        {
+            reader.ReadValue(ChangeDescription);
+        }
+        else if (reader.IsField("Changes"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Changes[Changes.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("ContactEmail"))
+        {
+            reader.ReadValue(ContactEmail);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Notes"))
+        {
+            reader.ReadValue(Notes);
+        }
+        else if (reader.IsField("StartDate"))
+        {
+            reader.ReadValue(StartDate);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateTitleMultiplayerServersQuotaChangeRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeResponse::~FCreateTitleMultiplayerServersQuotaChangeResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4586,6 +7745,16 @@ void PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeRespon
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4607,12 +7776,43 @@ bool PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeRespon
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FCreateTitleMultiplayerServersQuotaChangeResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("RequestId"))
+        {
+            reader.ReadValue(RequestId);
+        }
+        else if (reader.IsField("WasApproved"))
+        {
+            reader.ReadValue(WasApproved);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FCreateTitleMultiplayerServersQuotaChangeResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FDeleteAssetRequest::~FDeleteAssetRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FDeleteAssetRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FDeleteAssetRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4640,6 +7840,16 @@ void PlayFab::MultiplayerModels::FDeleteAssetRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FDeleteAssetRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FDeleteAssetRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FDeleteAssetRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4649,7 +7859,7 @@ bool PlayFab::MultiplayerModels::FDeleteAssetRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -4663,12 +7873,50 @@ bool PlayFab::MultiplayerModels::FDeleteAssetRequest::readFromValue(const TShare
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FDeleteAssetRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("FileName"))
+        {
+            reader.ReadValue(FileName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteAssetRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FDeleteBuildAliasRequest::~FDeleteBuildAliasRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FDeleteBuildAliasRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FDeleteBuildAliasRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4696,6 +7944,16 @@ void PlayFab::MultiplayerModels::FDeleteBuildAliasRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FDeleteBuildAliasRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FDeleteBuildAliasRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FDeleteBuildAliasRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4707,16 +7965,53 @@ bool PlayFab::MultiplayerModels::FDeleteBuildAliasRequest::readFromValue(const T
         if (AliasIdValue->TryGetString(TmpValue)) { AliasId = TmpValue; }
     }
 
-    const TSharedPtr<FJsonObject>* CustomTagsObject;
-    if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
+    const TSharedPtr<FJsonObject>* CustomTagsObject;
+    if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
+    {
+        for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
+        {
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
+        }
+    }
+
+    return HasSucceeded;
+}
+
+bool PlayFab::MultiplayerModels::FDeleteBuildAliasRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
     {
-        for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AliasId"))
+        {
+            reader.ReadValue(AliasId);
+        }
+        else if (reader.IsField("CustomTags"))
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
         }
+        else
+            reader.SkipValue();
     }
 
-    return HasSucceeded;
+    if (!reader.IsValid())
+    {
+        *this = FDeleteBuildAliasRequest();
+        return false;
+    }
+    return true;
 }
 
 PlayFab::MultiplayerModels::FDeleteBuildRegionRequest::~FDeleteBuildRegionRequest()
@@ -4724,7 +8019,8 @@ PlayFab::MultiplayerModels::FDeleteBuildRegionRequest::~FDeleteBuildRegionReques
 
 }
 
-void PlayFab::MultiplayerModels::FDeleteBuildRegionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FDeleteBuildRegionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4762,6 +8058,16 @@ void PlayFab::MultiplayerModels::FDeleteBuildRegionRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FDeleteBuildRegionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FDeleteBuildRegionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FDeleteBuildRegionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4778,7 +8084,7 @@ bool PlayFab::MultiplayerModels::FDeleteBuildRegionRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -4792,12 +8098,54 @@ bool PlayFab::MultiplayerModels::FDeleteBuildRegionRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FDeleteBuildRegionRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Region"))
+        {
+            reader.ReadValue(Region);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteBuildRegionRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FDeleteBuildRequest::~FDeleteBuildRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FDeleteBuildRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FDeleteBuildRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4825,6 +8173,16 @@ void PlayFab::MultiplayerModels::FDeleteBuildRequest::writeJSON(JsonWriter& writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FDeleteBuildRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FDeleteBuildRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FDeleteBuildRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4841,19 +8199,57 @@ bool PlayFab::MultiplayerModels::FDeleteBuildRequest::readFromValue(const TShare
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FDeleteBuildRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteBuildRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FDeleteCertificateRequest::~FDeleteCertificateRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FDeleteCertificateRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FDeleteCertificateRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4881,6 +8277,16 @@ void PlayFab::MultiplayerModels::FDeleteCertificateRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FDeleteCertificateRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FDeleteCertificateRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FDeleteCertificateRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4890,7 +8296,7 @@ bool PlayFab::MultiplayerModels::FDeleteCertificateRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -4904,12 +8310,50 @@ bool PlayFab::MultiplayerModels::FDeleteCertificateRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FDeleteCertificateRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteCertificateRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FDeleteContainerImageRequest::~FDeleteContainerImageRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FDeleteContainerImageRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FDeleteContainerImageRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -4933,6 +8377,16 @@ void PlayFab::MultiplayerModels::FDeleteContainerImageRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FDeleteContainerImageRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FDeleteContainerImageRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FDeleteContainerImageRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -4942,7 +8396,7 @@ bool PlayFab::MultiplayerModels::FDeleteContainerImageRequest::readFromValue(con
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -4956,12 +8410,50 @@ bool PlayFab::MultiplayerModels::FDeleteContainerImageRequest::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FDeleteContainerImageRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ImageName"))
+        {
+            reader.ReadValue(ImageName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteContainerImageRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FDeleteRemoteUserRequest::~FDeleteRemoteUserRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FDeleteRemoteUserRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FDeleteRemoteUserRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5019,6 +8511,16 @@ void PlayFab::MultiplayerModels::FDeleteRemoteUserRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FDeleteRemoteUserRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FDeleteRemoteUserRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FDeleteRemoteUserRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5035,7 +8537,7 @@ bool PlayFab::MultiplayerModels::FDeleteRemoteUserRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -5063,18 +8565,78 @@ bool PlayFab::MultiplayerModels::FDeleteRemoteUserRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FDeleteRemoteUserRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Region"))
+        {
+            reader.ReadValue(Region);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else if (reader.IsField("VmId"))
+        {
+            reader.ReadValue(VmId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FDeleteRemoteUserRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FEmptyResponse::~FEmptyResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FEmptyResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FEmptyResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FEmptyResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FEmptyResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FEmptyResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5082,12 +8644,34 @@ bool PlayFab::MultiplayerModels::FEmptyResponse::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FEmptyResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEmptyResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleRequest::~FEnableMultiplayerServersForTitleRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5105,6 +8689,16 @@ void PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleRequest::write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5114,14 +8708,48 @@ bool PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleRequest::readF
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
-void PlayFab::MultiplayerModels::writeTitleMultiplayerServerEnabledStatusEnumJSON(TitleMultiplayerServerEnabledStatus enumVal, JsonWriter& writer)
+bool PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEnableMultiplayerServersForTitleRequest();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeTitleMultiplayerServerEnabledStatusEnumValue(MultiplayerModels::TitleMultiplayerServerEnabledStatus enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -5132,6 +8760,16 @@ void PlayFab::MultiplayerModels::writeTitleMultiplayerServerEnabledStatusEnumJSO
     }
 }
 
+void PlayFab::MultiplayerModels::writeTitleMultiplayerServerEnabledStatusEnumJSON(TitleMultiplayerServerEnabledStatus enumVal, JsonWriter& writer)
+{
+    writeTitleMultiplayerServerEnabledStatusEnumValue(enumVal, writer);
+}
+
+void PlayFab::MultiplayerModels::writeTitleMultiplayerServerEnabledStatusEnumJSON(TitleMultiplayerServerEnabledStatus enumVal, JsonUtf8Writer& writer)
+{
+    writeTitleMultiplayerServerEnabledStatusEnumValue(enumVal, writer);
+}
+
 MultiplayerModels::TitleMultiplayerServerEnabledStatus PlayFab::MultiplayerModels::readTitleMultiplayerServerEnabledStatusFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readTitleMultiplayerServerEnabledStatusFromValue(value.IsValid() ? value->AsString() : "");
@@ -5164,7 +8802,8 @@ PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleResponse::~FEnableM
 
 }
 
-void PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5177,6 +8816,16 @@ void PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleResponse::writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5186,12 +8835,40 @@ bool PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleResponse::read
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FEnableMultiplayerServersForTitleResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Status"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Status = readTitleMultiplayerServerEnabledStatusFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEnableMultiplayerServersForTitleResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetAssetUploadUrlRequest::~FGetAssetUploadUrlRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetAssetUploadUrlRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetAssetUploadUrlRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5219,6 +8896,16 @@ void PlayFab::MultiplayerModels::FGetAssetUploadUrlRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetAssetUploadUrlRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetAssetUploadUrlRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetAssetUploadUrlRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5228,7 +8915,7 @@ bool PlayFab::MultiplayerModels::FGetAssetUploadUrlRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -5242,12 +8929,50 @@ bool PlayFab::MultiplayerModels::FGetAssetUploadUrlRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetAssetUploadUrlRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("FileName"))
+        {
+            reader.ReadValue(FileName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetAssetUploadUrlRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetAssetUploadUrlResponse::~FGetAssetUploadUrlResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetAssetUploadUrlResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetAssetUploadUrlResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5266,6 +8991,16 @@ void PlayFab::MultiplayerModels::FGetAssetUploadUrlResponse::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetAssetUploadUrlResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetAssetUploadUrlResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetAssetUploadUrlResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5287,12 +9022,43 @@ bool PlayFab::MultiplayerModels::FGetAssetUploadUrlResponse::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetAssetUploadUrlResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AssetUploadUrl"))
+        {
+            reader.ReadValue(AssetUploadUrl);
+        }
+        else if (reader.IsField("FileName"))
+        {
+            reader.ReadValue(FileName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetAssetUploadUrlResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetBuildAliasRequest::~FGetBuildAliasRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetBuildAliasRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetBuildAliasRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5320,6 +9086,16 @@ void PlayFab::MultiplayerModels::FGetBuildAliasRequest::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetBuildAliasRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetBuildAliasRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetBuildAliasRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5331,16 +9107,53 @@ bool PlayFab::MultiplayerModels::FGetBuildAliasRequest::readFromValue(const TSha
         if (AliasIdValue->TryGetString(TmpValue)) { AliasId = TmpValue; }
     }
 
-    const TSharedPtr<FJsonObject>* CustomTagsObject;
-    if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
+    const TSharedPtr<FJsonObject>* CustomTagsObject;
+    if (obj->TryGetObjectField(TEXT("CustomTags"), CustomTagsObject))
+    {
+        for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
+        {
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
+        }
+    }
+
+    return HasSucceeded;
+}
+
+bool PlayFab::MultiplayerModels::FGetBuildAliasRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
     {
-        for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AliasId"))
+        {
+            reader.ReadValue(AliasId);
+        }
+        else if (reader.IsField("CustomTags"))
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
         }
+        else
+            reader.SkipValue();
     }
 
-    return HasSucceeded;
+    if (!reader.IsValid())
+    {
+        *this = FGetBuildAliasRequest();
+        return false;
+    }
+    return true;
 }
 
 PlayFab::MultiplayerModels::FGetBuildRequest::~FGetBuildRequest()
@@ -5348,7 +9161,8 @@ PlayFab::MultiplayerModels::FGetBuildRequest::~FGetBuildRequest()
 
 }
 
-void PlayFab::MultiplayerModels::FGetBuildRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetBuildRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5376,6 +9190,16 @@ void PlayFab::MultiplayerModels::FGetBuildRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetBuildRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetBuildRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetBuildRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5392,13 +9216,50 @@ bool PlayFab::MultiplayerModels::FGetBuildRequest::readFromValue(const TSharedPt
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetBuildRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetBuildRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetBuildResponse::~FGetBuildResponse()
 {
     //if (CustomGameContainerImage != nullptr) delete CustomGameContainerImage;
@@ -5406,7 +9267,8 @@ PlayFab::MultiplayerModels::FGetBuildResponse::~FGetBuildResponse()
 
 }
 
-void PlayFab::MultiplayerModels::FGetBuildResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetBuildResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5547,6 +9409,16 @@ void PlayFab::MultiplayerModels::FGetBuildResponse::writeJSON(JsonWriter& writer
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetBuildResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetBuildResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetBuildResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5596,14 +9468,14 @@ bool PlayFab::MultiplayerModels::FGetBuildResponse::readFromValue(const TSharedP
     const TSharedPtr<FJsonValue> CustomGameContainerImageValue = obj->TryGetField(TEXT("CustomGameContainerImage"));
     if (CustomGameContainerImageValue.IsValid() && !CustomGameContainerImageValue->IsNull())
     {
-        CustomGameContainerImage = MakeShareable(new FContainerImageReference(CustomGameContainerImageValue->AsObject()));
+        CustomGameContainerImage = MakeShared<FContainerImageReference>(CustomGameContainerImageValue->AsObject());
     }
 
     const TArray<TSharedPtr<FJsonValue>>&GameAssetReferencesArray = FPlayFabJsonHelpers::ReadArray(obj, TEXT("GameAssetReferences"));
     for (int32 Idx = 0; Idx < GameAssetReferencesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GameAssetReferencesArray[Idx];
-        GameAssetReferences.Add(FAssetReference(CurrentItem->AsObject()));
+        GameAssetReferences.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -5611,14 +9483,14 @@ bool PlayFab::MultiplayerModels::FGetBuildResponse::readFromValue(const TSharedP
     for (int32 Idx = 0; Idx < GameCertificateReferencesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = GameCertificateReferencesArray[Idx];
-        GameCertificateReferences.Add(FGameCertificateReference(CurrentItem->AsObject()));
+        GameCertificateReferences.Emplace(CurrentItem->AsObject());
     }
 
 
     const TSharedPtr<FJsonValue> InstrumentationConfigurationValue = obj->TryGetField(TEXT("InstrumentationConfiguration"));
     if (InstrumentationConfigurationValue.IsValid() && !InstrumentationConfigurationValue->IsNull())
     {
-        pfInstrumentationConfiguration = MakeShareable(new FInstrumentationConfiguration(InstrumentationConfigurationValue->AsObject()));
+        pfInstrumentationConfiguration = MakeShared<FInstrumentationConfiguration>(InstrumentationConfigurationValue->AsObject());
     }
 
     const TSharedPtr<FJsonObject>* MetadataObject;
@@ -5626,7 +9498,7 @@ bool PlayFab::MultiplayerModels::FGetBuildResponse::readFromValue(const TSharedP
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*MetadataObject)->Values); It; ++It)
         {
-            Metadata.Add(It.Key(), It.Value()->AsString());
+            Metadata.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -5648,7 +9520,7 @@ bool PlayFab::MultiplayerModels::FGetBuildResponse::readFromValue(const TSharedP
     for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
+        Ports.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -5656,7 +9528,7 @@ bool PlayFab::MultiplayerModels::FGetBuildResponse::readFromValue(const TSharedP
     for (int32 Idx = 0; Idx < RegionConfigurationsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = RegionConfigurationsArray[Idx];
-        RegionConfigurations.Add(FBuildRegion(CurrentItem->AsObject()));
+        RegionConfigurations.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -5686,12 +9558,154 @@ bool PlayFab::MultiplayerModels::FGetBuildResponse::readFromValue(const TSharedP
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetBuildResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AreAssetsReadonly"))
+        {
+            reader.ReadValue(AreAssetsReadonly);
+        }
+        else if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("BuildName"))
+        {
+            reader.ReadValue(BuildName);
+        }
+        else if (reader.IsField("BuildStatus"))
+        {
+            reader.ReadValue(BuildStatus);
+        }
+        else if (reader.IsField("ContainerFlavor"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { pfContainerFlavor = readContainerFlavorFromValue(TmpValue); }
+        }
+        else if (reader.IsField("ContainerRunCommand"))
+        {
+            reader.ReadValue(ContainerRunCommand);
+        }
+        else if (reader.IsField("CreationTime"))
+        {
+            reader.ReadValue(CreationTime);
+        }
+        else if (reader.IsField("CustomGameContainerImage"))
+        {
+            CustomGameContainerImage = MakeShared<FContainerImageReference>();
+            CustomGameContainerImage->readFromReader(reader);
+        }
+        else if (reader.IsField("GameAssetReferences"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GameAssetReferences[GameAssetReferences.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("GameCertificateReferences"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { GameCertificateReferences[GameCertificateReferences.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("InstrumentationConfiguration"))
+        {
+            pfInstrumentationConfiguration = MakeShared<FInstrumentationConfiguration>();
+            pfInstrumentationConfiguration->readFromReader(reader);
+        }
+        else if (reader.IsField("Metadata"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Metadata.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("MultiplayerServerCountPerVm"))
+        {
+            reader.ReadValue(MultiplayerServerCountPerVm);
+        }
+        else if (reader.IsField("OsPlatform"))
+        {
+            reader.ReadValue(OsPlatform);
+        }
+        else if (reader.IsField("Ports"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Ports[Ports.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("RegionConfigurations"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { RegionConfigurations[RegionConfigurations.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("ServerType"))
+        {
+            reader.ReadValue(ServerType);
+        }
+        else if (reader.IsField("StartMultiplayerServerCommand"))
+        {
+            reader.ReadValue(StartMultiplayerServerCommand);
+        }
+        else if (reader.IsField("UseStreamingForAssetDownloads"))
+        {
+            reader.ReadValue(UseStreamingForAssetDownloads);
+        }
+        else if (reader.IsField("VmSize"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { VmSize = readAzureVmSizeFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetBuildResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsRequest::~FGetContainerRegistryCredentialsRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5709,6 +9723,16 @@ void PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsRequest::writeJ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5718,19 +9742,53 @@ bool PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsRequest::readFr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetContainerRegistryCredentialsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsResponse::~FGetContainerRegistryCredentialsResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5755,6 +9813,16 @@ void PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsResponse::write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5783,12 +9851,47 @@ bool PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsResponse::readF
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetContainerRegistryCredentialsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DnsName"))
+        {
+            reader.ReadValue(DnsName);
+        }
+        else if (reader.IsField("Password"))
+        {
+            reader.ReadValue(Password);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetContainerRegistryCredentialsResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetMatchmakingTicketRequest::~FGetMatchmakingTicketRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetMatchmakingTicketRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetMatchmakingTicketRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5829,6 +9932,16 @@ void PlayFab::MultiplayerModels::FGetMatchmakingTicketRequest::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetMatchmakingTicketRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetMatchmakingTicketRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetMatchmakingTicketRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5838,7 +9951,7 @@ bool PlayFab::MultiplayerModels::FGetMatchmakingTicketRequest::readFromValue(con
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -5866,12 +9979,58 @@ bool PlayFab::MultiplayerModels::FGetMatchmakingTicketRequest::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetMatchmakingTicketRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EscapeObject"))
+        {
+            reader.ReadValue(EscapeObject);
+        }
+        else if (reader.IsField("QueueName"))
+        {
+            reader.ReadValue(QueueName);
+        }
+        else if (reader.IsField("TicketId"))
+        {
+            reader.ReadValue(TicketId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetMatchmakingTicketRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetMatchmakingTicketResult::~FGetMatchmakingTicketResult()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetMatchmakingTicketResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetMatchmakingTicketResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -5944,6 +10103,16 @@ void PlayFab::MultiplayerModels::FGetMatchmakingTicketResult::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetMatchmakingTicketResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetMatchmakingTicketResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetMatchmakingTicketResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -5984,7 +10153,7 @@ bool PlayFab::MultiplayerModels::FGetMatchmakingTicketResult::readFromValue(cons
     for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FMatchmakingPlayer(CurrentItem->AsObject()));
+        Members.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -5992,7 +10161,7 @@ bool PlayFab::MultiplayerModels::FGetMatchmakingTicketResult::readFromValue(cons
     for (int32 Idx = 0; Idx < MembersToMatchWithArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = MembersToMatchWithArray[Idx];
-        MembersToMatchWith.Add(FEntityKey(CurrentItem->AsObject()));
+        MembersToMatchWith.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6020,12 +10189,89 @@ bool PlayFab::MultiplayerModels::FGetMatchmakingTicketResult::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetMatchmakingTicketResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CancellationReasonString"))
+        {
+            reader.ReadValue(CancellationReasonString);
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("Creator"))
+        {
+            Creator.readFromReader(reader);
+        }
+        else if (reader.IsField("GiveUpAfterSeconds"))
+        {
+            reader.ReadValue(GiveUpAfterSeconds);
+        }
+        else if (reader.IsField("MatchId"))
+        {
+            reader.ReadValue(MatchId);
+        }
+        else if (reader.IsField("Members"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Members[Members.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("MembersToMatchWith"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { MembersToMatchWith[MembersToMatchWith.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("QueueName"))
+        {
+            reader.ReadValue(QueueName);
+        }
+        else if (reader.IsField("Status"))
+        {
+            reader.ReadValue(Status);
+        }
+        else if (reader.IsField("TicketId"))
+        {
+            reader.ReadValue(TicketId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetMatchmakingTicketResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetMatchRequest::~FGetMatchRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetMatchRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetMatchRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6069,6 +10315,16 @@ void PlayFab::MultiplayerModels::FGetMatchRequest::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetMatchRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetMatchRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetMatchRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6078,7 +10334,7 @@ bool PlayFab::MultiplayerModels::FGetMatchRequest::readFromValue(const TSharedPt
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -6113,13 +10369,63 @@ bool PlayFab::MultiplayerModels::FGetMatchRequest::readFromValue(const TSharedPt
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetMatchRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EscapeObject"))
+        {
+            reader.ReadValue(EscapeObject);
+        }
+        else if (reader.IsField("MatchId"))
+        {
+            reader.ReadValue(MatchId);
+        }
+        else if (reader.IsField("QueueName"))
+        {
+            reader.ReadValue(QueueName);
+        }
+        else if (reader.IsField("ReturnMemberAttributes"))
+        {
+            reader.ReadValue(ReturnMemberAttributes);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetMatchRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetMatchResult::~FGetMatchResult()
 {
     //if (ServerDetails != nullptr) delete ServerDetails;
 
 }
 
-void PlayFab::MultiplayerModels::FGetMatchResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetMatchResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6157,6 +10463,16 @@ void PlayFab::MultiplayerModels::FGetMatchResult::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetMatchResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetMatchResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetMatchResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6172,7 +10488,7 @@ bool PlayFab::MultiplayerModels::FGetMatchResult::readFromValue(const TSharedPtr
     for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FMatchmakingPlayerWithTeamAssignment(CurrentItem->AsObject()));
+        Members.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6181,10 +10497,63 @@ bool PlayFab::MultiplayerModels::FGetMatchResult::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonValue> ServerDetailsValue = obj->TryGetField(TEXT("ServerDetails"));
     if (ServerDetailsValue.IsValid() && !ServerDetailsValue->IsNull())
     {
-        pfServerDetails = MakeShareable(new FServerDetails(ServerDetailsValue->AsObject()));
+        pfServerDetails = MakeShared<FServerDetails>(ServerDetailsValue->AsObject());
+    }
+
+    return HasSucceeded;
+}
+
+bool PlayFab::MultiplayerModels::FGetMatchResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("MatchId"))
+        {
+            reader.ReadValue(MatchId);
+        }
+        else if (reader.IsField("Members"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Members[Members.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("RegionPreferences"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { RegionPreferences.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ServerDetails"))
+        {
+            pfServerDetails = MakeShared<FServerDetails>();
+            pfServerDetails->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetMatchResult();
+        return false;
     }
-
-    return HasSucceeded;
+    return true;
 }
 
 PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsRequest::~FGetMultiplayerServerDetailsRequest()
@@ -6192,7 +10561,8 @@ PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsRequest::~FGetMultiplaye
 
 }
 
-void PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6240,6 +10610,16 @@ void PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsRequest::writeJSON(
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6256,7 +10636,7 @@ bool PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsRequest::readFromVa
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -6277,12 +10657,58 @@ bool PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsRequest::readFromVa
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Region"))
+        {
+            reader.ReadValue(Region);
+        }
+        else if (reader.IsField("SessionId"))
+        {
+            reader.ReadValue(SessionId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetMultiplayerServerDetailsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsResponse::~FGetMultiplayerServerDetailsResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6361,6 +10787,16 @@ void PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsResponse::writeJSON
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6376,7 +10812,7 @@ bool PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsResponse::readFromV
     for (int32 Idx = 0; Idx < ConnectedPlayersArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ConnectedPlayersArray[Idx];
-        ConnectedPlayers.Add(FConnectedPlayer(CurrentItem->AsObject()));
+        ConnectedPlayers.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6403,7 +10839,7 @@ bool PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsResponse::readFromV
     for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
+        Ports.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -6445,12 +10881,93 @@ bool PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsResponse::readFromV
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetMultiplayerServerDetailsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("ConnectedPlayers"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ConnectedPlayers[ConnectedPlayers.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("FQDN"))
+        {
+            reader.ReadValue(FQDN);
+        }
+        else if (reader.IsField("IPV4Address"))
+        {
+            reader.ReadValue(IPV4Address);
+        }
+        else if (reader.IsField("LastStateTransitionTime"))
+        {
+            reader.ReadValue(LastStateTransitionTime);
+        }
+        else if (reader.IsField("Ports"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Ports[Ports.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Region"))
+        {
+            reader.ReadValue(Region);
+        }
+        else if (reader.IsField("ServerId"))
+        {
+            reader.ReadValue(ServerId);
+        }
+        else if (reader.IsField("SessionId"))
+        {
+            reader.ReadValue(SessionId);
+        }
+        else if (reader.IsField("State"))
+        {
+            reader.ReadValue(State);
+        }
+        else if (reader.IsField("VmId"))
+        {
+            reader.ReadValue(VmId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetMultiplayerServerDetailsResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetMultiplayerServerLogsRequest::~FGetMultiplayerServerLogsRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetMultiplayerServerLogsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetMultiplayerServerLogsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6478,6 +10995,16 @@ void PlayFab::MultiplayerModels::FGetMultiplayerServerLogsRequest::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetMultiplayerServerLogsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetMultiplayerServerLogsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetMultiplayerServerLogsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6487,7 +11014,7 @@ bool PlayFab::MultiplayerModels::FGetMultiplayerServerLogsRequest::readFromValue
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -6501,12 +11028,50 @@ bool PlayFab::MultiplayerModels::FGetMultiplayerServerLogsRequest::readFromValue
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetMultiplayerServerLogsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ServerId"))
+        {
+            reader.ReadValue(ServerId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetMultiplayerServerLogsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetMultiplayerServerLogsResponse::~FGetMultiplayerServerLogsResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetMultiplayerServerLogsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetMultiplayerServerLogsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6519,6 +11084,16 @@ void PlayFab::MultiplayerModels::FGetMultiplayerServerLogsResponse::writeJSON(Js
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetMultiplayerServerLogsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetMultiplayerServerLogsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetMultiplayerServerLogsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6533,12 +11108,39 @@ bool PlayFab::MultiplayerModels::FGetMultiplayerServerLogsResponse::readFromValu
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetMultiplayerServerLogsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("LogDownloadUrl"))
+        {
+            reader.ReadValue(LogDownloadUrl);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetMultiplayerServerLogsResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetMultiplayerSessionLogsBySessionIdRequest::~FGetMultiplayerSessionLogsBySessionIdRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetMultiplayerSessionLogsBySessionIdRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetMultiplayerSessionLogsBySessionIdRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6566,6 +11168,16 @@ void PlayFab::MultiplayerModels::FGetMultiplayerSessionLogsBySessionIdRequest::w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetMultiplayerSessionLogsBySessionIdRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetMultiplayerSessionLogsBySessionIdRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetMultiplayerSessionLogsBySessionIdRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6575,7 +11187,7 @@ bool PlayFab::MultiplayerModels::FGetMultiplayerSessionLogsBySessionIdRequest::r
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -6589,12 +11201,50 @@ bool PlayFab::MultiplayerModels::FGetMultiplayerSessionLogsBySessionIdRequest::r
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetMultiplayerSessionLogsBySessionIdRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("SessionId"))
+        {
+            reader.ReadValue(SessionId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetMultiplayerSessionLogsBySessionIdRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetQueueStatisticsRequest::~FGetQueueStatisticsRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetQueueStatisticsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetQueueStatisticsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6622,6 +11272,16 @@ void PlayFab::MultiplayerModels::FGetQueueStatisticsRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetQueueStatisticsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetQueueStatisticsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetQueueStatisticsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6631,7 +11291,7 @@ bool PlayFab::MultiplayerModels::FGetQueueStatisticsRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -6645,12 +11305,50 @@ bool PlayFab::MultiplayerModels::FGetQueueStatisticsRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetQueueStatisticsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("QueueName"))
+        {
+            reader.ReadValue(QueueName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetQueueStatisticsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FStatistics::~FStatistics()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FStatistics::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FStatistics::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6669,6 +11367,16 @@ void PlayFab::MultiplayerModels::FStatistics::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FStatistics::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FStatistics::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FStatistics::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6704,13 +11412,52 @@ bool PlayFab::MultiplayerModels::FStatistics::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FStatistics::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Average"))
+        {
+            reader.ReadValue(Average);
+        }
+        else if (reader.IsField("Percentile50"))
+        {
+            reader.ReadValue(Percentile50);
+        }
+        else if (reader.IsField("Percentile90"))
+        {
+            reader.ReadValue(Percentile90);
+        }
+        else if (reader.IsField("Percentile99"))
+        {
+            reader.ReadValue(Percentile99);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FStatistics();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetQueueStatisticsResult::~FGetQueueStatisticsResult()
 {
     //if (TimeToMatchStatisticsInSeconds != nullptr) delete TimeToMatchStatisticsInSeconds;
 
 }
 
-void PlayFab::MultiplayerModels::FGetQueueStatisticsResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetQueueStatisticsResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6729,6 +11476,16 @@ void PlayFab::MultiplayerModels::FGetQueueStatisticsResult::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetQueueStatisticsResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetQueueStatisticsResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetQueueStatisticsResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6743,18 +11500,50 @@ bool PlayFab::MultiplayerModels::FGetQueueStatisticsResult::readFromValue(const
     const TSharedPtr<FJsonValue> TimeToMatchStatisticsInSecondsValue = obj->TryGetField(TEXT("TimeToMatchStatisticsInSeconds"));
     if (TimeToMatchStatisticsInSecondsValue.IsValid() && !TimeToMatchStatisticsInSecondsValue->IsNull())
     {
-        TimeToMatchStatisticsInSeconds = MakeShareable(new FStatistics(TimeToMatchStatisticsInSecondsValue->AsObject()));
+        TimeToMatchStatisticsInSeconds = MakeShared<FStatistics>(TimeToMatchStatisticsInSecondsValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetQueueStatisticsResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("NumberOfPlayersMatching"))
+        {
+            reader.ReadValue(NumberOfPlayersMatching);
+        }
+        else if (reader.IsField("TimeToMatchStatisticsInSeconds"))
+        {
+            TimeToMatchStatisticsInSeconds = MakeShared<FStatistics>();
+            TimeToMatchStatisticsInSeconds->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetQueueStatisticsResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetRemoteLoginEndpointRequest::~FGetRemoteLoginEndpointRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetRemoteLoginEndpointRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetRemoteLoginEndpointRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6802,6 +11591,16 @@ void PlayFab::MultiplayerModels::FGetRemoteLoginEndpointRequest::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetRemoteLoginEndpointRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetRemoteLoginEndpointRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetRemoteLoginEndpointRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6818,7 +11617,7 @@ bool PlayFab::MultiplayerModels::FGetRemoteLoginEndpointRequest::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -6839,12 +11638,58 @@ bool PlayFab::MultiplayerModels::FGetRemoteLoginEndpointRequest::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetRemoteLoginEndpointRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Region"))
+        {
+            reader.ReadValue(Region);
+        }
+        else if (reader.IsField("VmId"))
+        {
+            reader.ReadValue(VmId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetRemoteLoginEndpointRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetRemoteLoginEndpointResponse::~FGetRemoteLoginEndpointResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetRemoteLoginEndpointResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetRemoteLoginEndpointResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6860,6 +11705,16 @@ void PlayFab::MultiplayerModels::FGetRemoteLoginEndpointResponse::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetRemoteLoginEndpointResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetRemoteLoginEndpointResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetRemoteLoginEndpointResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -6881,12 +11736,43 @@ bool PlayFab::MultiplayerModels::FGetRemoteLoginEndpointResponse::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetRemoteLoginEndpointResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("IPV4Address"))
+        {
+            reader.ReadValue(IPV4Address);
+        }
+        else if (reader.IsField("Port"))
+        {
+            reader.ReadValue(Port);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetRemoteLoginEndpointResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetServerBackfillTicketRequest::~FGetServerBackfillTicketRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetServerBackfillTicketRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetServerBackfillTicketRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -6924,7 +11810,17 @@ void PlayFab::MultiplayerModels::FGetServerBackfillTicketRequest::writeJSON(Json
         writer->WriteValue(TicketId);
     }
 
-    writer->WriteObjectEnd();
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::MultiplayerModels::FGetServerBackfillTicketRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetServerBackfillTicketRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::MultiplayerModels::FGetServerBackfillTicketRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -6936,7 +11832,7 @@ bool PlayFab::MultiplayerModels::FGetServerBackfillTicketRequest::readFromValue(
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -6964,12 +11860,58 @@ bool PlayFab::MultiplayerModels::FGetServerBackfillTicketRequest::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetServerBackfillTicketRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("EscapeObject"))
+        {
+            reader.ReadValue(EscapeObject);
+        }
+        else if (reader.IsField("QueueName"))
+        {
+            reader.ReadValue(QueueName);
+        }
+        else if (reader.IsField("TicketId"))
+        {
+            reader.ReadValue(TicketId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetServerBackfillTicketRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetServerBackfillTicketResult::~FGetServerBackfillTicketResult()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetServerBackfillTicketResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetServerBackfillTicketResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7033,6 +11975,16 @@ void PlayFab::MultiplayerModels::FGetServerBackfillTicketResult::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetServerBackfillTicketResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetServerBackfillTicketResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetServerBackfillTicketResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7067,7 +12019,7 @@ bool PlayFab::MultiplayerModels::FGetServerBackfillTicketResult::readFromValue(c
     for (int32 Idx = 0; Idx < MembersArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = MembersArray[Idx];
-        Members.Add(FMatchmakingPlayerWithTeamAssignment(CurrentItem->AsObject()));
+        Members.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -7101,12 +12053,78 @@ bool PlayFab::MultiplayerModels::FGetServerBackfillTicketResult::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetServerBackfillTicketResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CancellationReasonString"))
+        {
+            reader.ReadValue(CancellationReasonString);
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("GiveUpAfterSeconds"))
+        {
+            reader.ReadValue(GiveUpAfterSeconds);
+        }
+        else if (reader.IsField("MatchId"))
+        {
+            reader.ReadValue(MatchId);
+        }
+        else if (reader.IsField("Members"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Members[Members.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("QueueName"))
+        {
+            reader.ReadValue(QueueName);
+        }
+        else if (reader.IsField("ServerDetails"))
+        {
+            pfServerDetails.readFromReader(reader);
+        }
+        else if (reader.IsField("Status"))
+        {
+            reader.ReadValue(Status);
+        }
+        else if (reader.IsField("TicketId"))
+        {
+            reader.ReadValue(TicketId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetServerBackfillTicketResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusRequest::~FGetTitleEnabledForMultiplayerServersStatusRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7124,6 +12142,16 @@ void PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusRequ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7133,19 +12161,53 @@ bool PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusRequ
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitleEnabledForMultiplayerServersStatusRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusResponse::~FGetTitleEnabledForMultiplayerServersStatusResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7158,6 +12220,16 @@ void PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusResp
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7167,12 +12239,40 @@ bool PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusResp
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetTitleEnabledForMultiplayerServersStatusResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Status"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Status = readTitleMultiplayerServerEnabledStatusFromValue(TmpValue); }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitleEnabledForMultiplayerServersStatusResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeRequest::~FGetTitleMultiplayerServersQuotaChangeRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7200,6 +12300,16 @@ void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeRequest::
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7209,7 +12319,7 @@ bool PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeRequest::
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -7223,12 +12333,50 @@ bool PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeRequest::
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("RequestId"))
+        {
+            reader.ReadValue(RequestId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitleMultiplayerServersQuotaChangeRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FQuotaChange::~FQuotaChange()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FQuotaChange::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FQuotaChange::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7274,6 +12422,16 @@ void PlayFab::MultiplayerModels::FQuotaChange::writeJSON(JsonWriter& writer) con
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FQuotaChange::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FQuotaChange::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FQuotaChange::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7289,7 +12447,7 @@ bool PlayFab::MultiplayerModels::FQuotaChange::readFromValue(const TSharedPtr<FJ
     for (int32 Idx = 0; Idx < ChangesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ChangesArray[Idx];
-        Changes.Add(FCoreCapacityChange(CurrentItem->AsObject()));
+        Changes.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -7331,13 +12489,71 @@ bool PlayFab::MultiplayerModels::FQuotaChange::readFromValue(const TSharedPtr<FJ
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FQuotaChange::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ChangeDescription"))
+        {
+            reader.ReadValue(ChangeDescription);
+        }
+        else if (reader.IsField("Changes"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Changes[Changes.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("IsPendingReview"))
+        {
+            reader.ReadValue(IsPendingReview);
+        }
+        else if (reader.IsField("Notes"))
+        {
+            reader.ReadValue(Notes);
+        }
+        else if (reader.IsField("RequestId"))
+        {
+            reader.ReadValue(RequestId);
+        }
+        else if (reader.IsField("ReviewComments"))
+        {
+            reader.ReadValue(ReviewComments);
+        }
+        else if (reader.IsField("WasApproved"))
+        {
+            reader.ReadValue(WasApproved);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FQuotaChange();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeResponse::~FGetTitleMultiplayerServersQuotaChangeResponse()
 {
     //if (Change != nullptr) delete Change;
 
 }
 
-void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7350,6 +12566,16 @@ void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeResponse:
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7357,18 +12583,46 @@ bool PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeResponse:
     const TSharedPtr<FJsonValue> ChangeValue = obj->TryGetField(TEXT("Change"));
     if (ChangeValue.IsValid() && !ChangeValue->IsNull())
     {
-        Change = MakeShareable(new FQuotaChange(ChangeValue->AsObject()));
+        Change = MakeShared<FQuotaChange>(ChangeValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotaChangeResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Change"))
+        {
+            Change = MakeShared<FQuotaChange>();
+            Change->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitleMultiplayerServersQuotaChangeResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasRequest::~FGetTitleMultiplayerServersQuotasRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7386,6 +12640,16 @@ void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasRequest::write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7395,19 +12659,53 @@ bool PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasRequest::readF
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitleMultiplayerServersQuotasRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FTitleMultiplayerServersQuotas::~FTitleMultiplayerServersQuotas()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FTitleMultiplayerServersQuotas::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FTitleMultiplayerServersQuotas::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7423,6 +12721,16 @@ void PlayFab::MultiplayerModels::FTitleMultiplayerServersQuotas::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FTitleMultiplayerServersQuotas::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FTitleMultiplayerServersQuotas::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FTitleMultiplayerServersQuotas::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7431,20 +12739,54 @@ bool PlayFab::MultiplayerModels::FTitleMultiplayerServersQuotas::readFromValue(c
     for (int32 Idx = 0; Idx < CoreCapacitiesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = CoreCapacitiesArray[Idx];
-        CoreCapacities.Add(FCoreCapacity(CurrentItem->AsObject()));
+        CoreCapacities.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FTitleMultiplayerServersQuotas::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CoreCapacities"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { CoreCapacities[CoreCapacities.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FTitleMultiplayerServersQuotas();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasResponse::~FGetTitleMultiplayerServersQuotasResponse()
 {
     //if (Quotas != nullptr) delete Quotas;
 
 }
 
-void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7457,6 +12799,16 @@ void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasResponse::writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7464,18 +12816,46 @@ bool PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasResponse::read
     const TSharedPtr<FJsonValue> QuotasValue = obj->TryGetField(TEXT("Quotas"));
     if (QuotasValue.IsValid() && !QuotasValue->IsNull())
     {
-        Quotas = MakeShareable(new FTitleMultiplayerServersQuotas(QuotasValue->AsObject()));
+        Quotas = MakeShared<FTitleMultiplayerServersQuotas>(QuotasValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FGetTitleMultiplayerServersQuotasResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Quotas"))
+        {
+            Quotas = MakeShared<FTitleMultiplayerServersQuotas>();
+            Quotas->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitleMultiplayerServersQuotasResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FJoinMatchmakingTicketRequest::~FJoinMatchmakingTicketRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FJoinMatchmakingTicketRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FJoinMatchmakingTicketRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7516,6 +12896,16 @@ void PlayFab::MultiplayerModels::FJoinMatchmakingTicketRequest::writeJSON(JsonWr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FJoinMatchmakingTicketRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FJoinMatchmakingTicketRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FJoinMatchmakingTicketRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7525,7 +12915,7 @@ bool PlayFab::MultiplayerModels::FJoinMatchmakingTicketRequest::readFromValue(co
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -7542,14 +12932,59 @@ bool PlayFab::MultiplayerModels::FJoinMatchmakingTicketRequest::readFromValue(co
         if (QueueNameValue->TryGetString(TmpValue)) { QueueName = TmpValue; }
     }
 
-    const TSharedPtr<FJsonValue> TicketIdValue = obj->TryGetField(TEXT("TicketId"));
-    if (TicketIdValue.IsValid() && !TicketIdValue->IsNull())
+    const TSharedPtr<FJsonValue> TicketIdValue = obj->TryGetField(TEXT("TicketId"));
+    if (TicketIdValue.IsValid() && !TicketIdValue->IsNull())
+    {
+        FString TmpValue;
+        if (TicketIdValue->TryGetString(TmpValue)) { TicketId = TmpValue; }
+    }
+
+    return HasSucceeded;
+}
+
+bool PlayFab::MultiplayerModels::FJoinMatchmakingTicketRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Member"))
+        {
+            Member.readFromReader(reader);
+        }
+        else if (reader.IsField("QueueName"))
+        {
+            reader.ReadValue(QueueName);
+        }
+        else if (reader.IsField("TicketId"))
+        {
+            reader.ReadValue(TicketId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
     {
-        FString TmpValue;
-        if (TicketIdValue->TryGetString(TmpValue)) { TicketId = TmpValue; }
+        *this = FJoinMatchmakingTicketRequest();
+        return false;
     }
-
-    return HasSucceeded;
+    return true;
 }
 
 PlayFab::MultiplayerModels::FJoinMatchmakingTicketResult::~FJoinMatchmakingTicketResult()
@@ -7557,13 +12992,24 @@ PlayFab::MultiplayerModels::FJoinMatchmakingTicketResult::~FJoinMatchmakingTicke
 
 }
 
-void PlayFab::MultiplayerModels::FJoinMatchmakingTicketResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FJoinMatchmakingTicketResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FJoinMatchmakingTicketResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FJoinMatchmakingTicketResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FJoinMatchmakingTicketResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7571,12 +13017,34 @@ bool PlayFab::MultiplayerModels::FJoinMatchmakingTicketResult::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FJoinMatchmakingTicketResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FJoinMatchmakingTicketResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListAssetSummariesRequest::~FListAssetSummariesRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListAssetSummariesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListAssetSummariesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7606,6 +13074,16 @@ void PlayFab::MultiplayerModels::FListAssetSummariesRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListAssetSummariesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListAssetSummariesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListAssetSummariesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7615,7 +13093,7 @@ bool PlayFab::MultiplayerModels::FListAssetSummariesRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -7636,12 +13114,54 @@ bool PlayFab::MultiplayerModels::FListAssetSummariesRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListAssetSummariesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PageSize"))
+        {
+            reader.ReadValue(PageSize);
+        }
+        else if (reader.IsField("SkipToken"))
+        {
+            reader.ReadValue(SkipToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListAssetSummariesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListAssetSummariesResponse::~FListAssetSummariesResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListAssetSummariesResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListAssetSummariesResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7666,6 +13186,16 @@ void PlayFab::MultiplayerModels::FListAssetSummariesResponse::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListAssetSummariesResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListAssetSummariesResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListAssetSummariesResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7674,7 +13204,7 @@ bool PlayFab::MultiplayerModels::FListAssetSummariesResponse::readFromValue(cons
     for (int32 Idx = 0; Idx < AssetSummariesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = AssetSummariesArray[Idx];
-        AssetSummaries.Add(FAssetSummary(CurrentItem->AsObject()));
+        AssetSummaries.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -7695,12 +13225,54 @@ bool PlayFab::MultiplayerModels::FListAssetSummariesResponse::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListAssetSummariesResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AssetSummaries"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { AssetSummaries[AssetSummaries.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("PageSize"))
+        {
+            reader.ReadValue(PageSize);
+        }
+        else if (reader.IsField("SkipToken"))
+        {
+            reader.ReadValue(SkipToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListAssetSummariesResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListBuildAliasesRequest::~FListBuildAliasesRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListBuildAliasesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListBuildAliasesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7730,6 +13302,16 @@ void PlayFab::MultiplayerModels::FListBuildAliasesRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListBuildAliasesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListBuildAliasesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListBuildAliasesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7739,7 +13321,7 @@ bool PlayFab::MultiplayerModels::FListBuildAliasesRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -7760,12 +13342,54 @@ bool PlayFab::MultiplayerModels::FListBuildAliasesRequest::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListBuildAliasesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PageSize"))
+        {
+            reader.ReadValue(PageSize);
+        }
+        else if (reader.IsField("SkipToken"))
+        {
+            reader.ReadValue(SkipToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListBuildAliasesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListBuildAliasesResponse::~FListBuildAliasesResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListBuildAliasesResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListBuildAliasesResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7790,6 +13414,16 @@ void PlayFab::MultiplayerModels::FListBuildAliasesResponse::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListBuildAliasesResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListBuildAliasesResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListBuildAliasesResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7798,7 +13432,7 @@ bool PlayFab::MultiplayerModels::FListBuildAliasesResponse::readFromValue(const
     for (int32 Idx = 0; Idx < BuildAliasesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BuildAliasesArray[Idx];
-        BuildAliases.Add(FBuildAliasDetailsResponse(CurrentItem->AsObject()));
+        BuildAliases.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -7819,12 +13453,54 @@ bool PlayFab::MultiplayerModels::FListBuildAliasesResponse::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListBuildAliasesResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildAliases"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { BuildAliases[BuildAliases.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("PageSize"))
+        {
+            reader.ReadValue(PageSize);
+        }
+        else if (reader.IsField("SkipToken"))
+        {
+            reader.ReadValue(SkipToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListBuildAliasesResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListBuildSummariesRequest::~FListBuildSummariesRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListBuildSummariesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListBuildSummariesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7854,6 +13530,16 @@ void PlayFab::MultiplayerModels::FListBuildSummariesRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListBuildSummariesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListBuildSummariesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListBuildSummariesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7863,7 +13549,7 @@ bool PlayFab::MultiplayerModels::FListBuildSummariesRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -7884,12 +13570,54 @@ bool PlayFab::MultiplayerModels::FListBuildSummariesRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListBuildSummariesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PageSize"))
+        {
+            reader.ReadValue(PageSize);
+        }
+        else if (reader.IsField("SkipToken"))
+        {
+            reader.ReadValue(SkipToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListBuildSummariesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListBuildSummariesResponse::~FListBuildSummariesResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListBuildSummariesResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListBuildSummariesResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7914,6 +13642,16 @@ void PlayFab::MultiplayerModels::FListBuildSummariesResponse::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListBuildSummariesResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListBuildSummariesResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListBuildSummariesResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7922,7 +13660,7 @@ bool PlayFab::MultiplayerModels::FListBuildSummariesResponse::readFromValue(cons
     for (int32 Idx = 0; Idx < BuildSummariesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BuildSummariesArray[Idx];
-        BuildSummaries.Add(FBuildSummary(CurrentItem->AsObject()));
+        BuildSummaries.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -7943,12 +13681,54 @@ bool PlayFab::MultiplayerModels::FListBuildSummariesResponse::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListBuildSummariesResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildSummaries"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { BuildSummaries[BuildSummaries.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("PageSize"))
+        {
+            reader.ReadValue(PageSize);
+        }
+        else if (reader.IsField("SkipToken"))
+        {
+            reader.ReadValue(SkipToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListBuildSummariesResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListCertificateSummariesRequest::~FListCertificateSummariesRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListCertificateSummariesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListCertificateSummariesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -7978,6 +13758,16 @@ void PlayFab::MultiplayerModels::FListCertificateSummariesRequest::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListCertificateSummariesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListCertificateSummariesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListCertificateSummariesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -7987,7 +13777,7 @@ bool PlayFab::MultiplayerModels::FListCertificateSummariesRequest::readFromValue
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -8008,12 +13798,54 @@ bool PlayFab::MultiplayerModels::FListCertificateSummariesRequest::readFromValue
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListCertificateSummariesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PageSize"))
+        {
+            reader.ReadValue(PageSize);
+        }
+        else if (reader.IsField("SkipToken"))
+        {
+            reader.ReadValue(SkipToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListCertificateSummariesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListCertificateSummariesResponse::~FListCertificateSummariesResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListCertificateSummariesResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListCertificateSummariesResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8038,6 +13870,16 @@ void PlayFab::MultiplayerModels::FListCertificateSummariesResponse::writeJSON(Js
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListCertificateSummariesResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListCertificateSummariesResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListCertificateSummariesResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8046,7 +13888,7 @@ bool PlayFab::MultiplayerModels::FListCertificateSummariesResponse::readFromValu
     for (int32 Idx = 0; Idx < CertificateSummariesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = CertificateSummariesArray[Idx];
-        CertificateSummaries.Add(FCertificateSummary(CurrentItem->AsObject()));
+        CertificateSummaries.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -8067,12 +13909,54 @@ bool PlayFab::MultiplayerModels::FListCertificateSummariesResponse::readFromValu
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListCertificateSummariesResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CertificateSummaries"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { CertificateSummaries[CertificateSummaries.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("PageSize"))
+        {
+            reader.ReadValue(PageSize);
+        }
+        else if (reader.IsField("SkipToken"))
+        {
+            reader.ReadValue(SkipToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListCertificateSummariesResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListContainerImagesRequest::~FListContainerImagesRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListContainerImagesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListContainerImagesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8102,6 +13986,16 @@ void PlayFab::MultiplayerModels::FListContainerImagesRequest::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListContainerImagesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListContainerImagesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListContainerImagesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8111,7 +14005,7 @@ bool PlayFab::MultiplayerModels::FListContainerImagesRequest::readFromValue(cons
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -8132,12 +14026,54 @@ bool PlayFab::MultiplayerModels::FListContainerImagesRequest::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListContainerImagesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PageSize"))
+        {
+            reader.ReadValue(PageSize);
+        }
+        else if (reader.IsField("SkipToken"))
+        {
+            reader.ReadValue(SkipToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListContainerImagesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListContainerImagesResponse::~FListContainerImagesResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListContainerImagesResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListContainerImagesResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8159,7 +14095,17 @@ void PlayFab::MultiplayerModels::FListContainerImagesResponse::writeJSON(JsonWri
         writer->WriteValue(SkipToken);
     }
 
-    writer->WriteObjectEnd();
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::MultiplayerModels::FListContainerImagesResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListContainerImagesResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::MultiplayerModels::FListContainerImagesResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -8185,12 +14131,54 @@ bool PlayFab::MultiplayerModels::FListContainerImagesResponse::readFromValue(con
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListContainerImagesResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Images"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Images.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PageSize"))
+        {
+            reader.ReadValue(PageSize);
+        }
+        else if (reader.IsField("SkipToken"))
+        {
+            reader.ReadValue(SkipToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListContainerImagesResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListContainerImageTagsRequest::~FListContainerImageTagsRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListContainerImageTagsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListContainerImageTagsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8214,6 +14202,16 @@ void PlayFab::MultiplayerModels::FListContainerImageTagsRequest::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListContainerImageTagsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListContainerImageTagsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListContainerImageTagsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8223,7 +14221,7 @@ bool PlayFab::MultiplayerModels::FListContainerImageTagsRequest::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -8237,12 +14235,50 @@ bool PlayFab::MultiplayerModels::FListContainerImageTagsRequest::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListContainerImageTagsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ImageName"))
+        {
+            reader.ReadValue(ImageName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListContainerImageTagsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListContainerImageTagsResponse::~FListContainerImageTagsResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListContainerImageTagsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListContainerImageTagsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8258,6 +14294,16 @@ void PlayFab::MultiplayerModels::FListContainerImageTagsResponse::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListContainerImageTagsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListContainerImageTagsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListContainerImageTagsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8267,13 +14313,47 @@ bool PlayFab::MultiplayerModels::FListContainerImageTagsResponse::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListContainerImageTagsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Tags"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { Tags.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListContainerImageTagsResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerRequest::~FListMatchmakingTicketsForPlayerRequest()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8307,6 +14387,16 @@ void PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerRequest::writeJ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8316,14 +14406,14 @@ bool PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerRequest::readFr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> QueueNameValue = obj->TryGetField(TEXT("QueueName"));
@@ -8336,12 +14426,55 @@ bool PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerRequest::readFr
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("QueueName"))
+        {
+            reader.ReadValue(QueueName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListMatchmakingTicketsForPlayerRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerResult::~FListMatchmakingTicketsForPlayerResult()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8354,6 +14487,16 @@ void PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerResult::writeJS
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8363,12 +14506,46 @@ bool PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerResult::readFro
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListMatchmakingTicketsForPlayerResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TicketIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { TicketIds.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListMatchmakingTicketsForPlayerResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListMultiplayerServersRequest::~FListMultiplayerServersRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListMultiplayerServersRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListMultiplayerServersRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8418,6 +14595,16 @@ void PlayFab::MultiplayerModels::FListMultiplayerServersRequest::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListMultiplayerServersRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListMultiplayerServersRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListMultiplayerServersRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8434,7 +14621,7 @@ bool PlayFab::MultiplayerModels::FListMultiplayerServersRequest::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -8462,12 +14649,62 @@ bool PlayFab::MultiplayerModels::FListMultiplayerServersRequest::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListMultiplayerServersRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PageSize"))
+        {
+            reader.ReadValue(PageSize);
+        }
+        else if (reader.IsField("Region"))
+        {
+            reader.ReadValue(Region);
+        }
+        else if (reader.IsField("SkipToken"))
+        {
+            reader.ReadValue(SkipToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListMultiplayerServersRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FMultiplayerServerSummary::~FMultiplayerServerSummary()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FMultiplayerServerSummary::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FMultiplayerServerSummary::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8519,6 +14756,16 @@ void PlayFab::MultiplayerModels::FMultiplayerServerSummary::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FMultiplayerServerSummary::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FMultiplayerServerSummary::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FMultiplayerServerSummary::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8527,7 +14774,7 @@ bool PlayFab::MultiplayerModels::FMultiplayerServerSummary::readFromValue(const
     for (int32 Idx = 0; Idx < ConnectedPlayersArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ConnectedPlayersArray[Idx];
-        ConnectedPlayers.Add(FConnectedPlayer(CurrentItem->AsObject()));
+        ConnectedPlayers.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -8574,12 +14821,70 @@ bool PlayFab::MultiplayerModels::FMultiplayerServerSummary::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FMultiplayerServerSummary::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ConnectedPlayers"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ConnectedPlayers[ConnectedPlayers.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("LastStateTransitionTime"))
+        {
+            reader.ReadValue(LastStateTransitionTime);
+        }
+        else if (reader.IsField("Region"))
+        {
+            reader.ReadValue(Region);
+        }
+        else if (reader.IsField("ServerId"))
+        {
+            reader.ReadValue(ServerId);
+        }
+        else if (reader.IsField("SessionId"))
+        {
+            reader.ReadValue(SessionId);
+        }
+        else if (reader.IsField("State"))
+        {
+            reader.ReadValue(State);
+        }
+        else if (reader.IsField("VmId"))
+        {
+            reader.ReadValue(VmId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FMultiplayerServerSummary();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListMultiplayerServersResponse::~FListMultiplayerServersResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListMultiplayerServersResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListMultiplayerServersResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8604,6 +14909,16 @@ void PlayFab::MultiplayerModels::FListMultiplayerServersResponse::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListMultiplayerServersResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListMultiplayerServersResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListMultiplayerServersResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8612,7 +14927,7 @@ bool PlayFab::MultiplayerModels::FListMultiplayerServersResponse::readFromValue(
     for (int32 Idx = 0; Idx < MultiplayerServerSummariesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = MultiplayerServerSummariesArray[Idx];
-        MultiplayerServerSummaries.Add(FMultiplayerServerSummary(CurrentItem->AsObject()));
+        MultiplayerServerSummaries.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -8633,12 +14948,54 @@ bool PlayFab::MultiplayerModels::FListMultiplayerServersResponse::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListMultiplayerServersResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("MultiplayerServerSummaries"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { MultiplayerServerSummaries[MultiplayerServerSummaries.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("PageSize"))
+        {
+            reader.ReadValue(PageSize);
+        }
+        else if (reader.IsField("SkipToken"))
+        {
+            reader.ReadValue(SkipToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListMultiplayerServersResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListPartyQosServersRequest::~FListPartyQosServersRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListPartyQosServersRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListPartyQosServersRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8656,6 +15013,16 @@ void PlayFab::MultiplayerModels::FListPartyQosServersRequest::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListPartyQosServersRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListPartyQosServersRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListPartyQosServersRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8665,19 +15032,53 @@ bool PlayFab::MultiplayerModels::FListPartyQosServersRequest::readFromValue(cons
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListPartyQosServersRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListPartyQosServersRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FQosServer::~FQosServer()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FQosServer::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FQosServer::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8696,6 +15097,16 @@ void PlayFab::MultiplayerModels::FQosServer::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FQosServer::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FQosServer::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FQosServer::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8717,12 +15128,43 @@ bool PlayFab::MultiplayerModels::FQosServer::readFromValue(const TSharedPtr<FJso
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FQosServer::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Region"))
+        {
+            reader.ReadValue(Region);
+        }
+        else if (reader.IsField("ServerUrl"))
+        {
+            reader.ReadValue(ServerUrl);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FQosServer();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListPartyQosServersResponse::~FListPartyQosServersResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListPartyQosServersResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListPartyQosServersResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8747,6 +15189,16 @@ void PlayFab::MultiplayerModels::FListPartyQosServersResponse::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListPartyQosServersResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListPartyQosServersResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListPartyQosServersResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8762,7 +15214,7 @@ bool PlayFab::MultiplayerModels::FListPartyQosServersResponse::readFromValue(con
     for (int32 Idx = 0; Idx < QosServersArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = QosServersArray[Idx];
-        QosServers.Add(FQosServer(CurrentItem->AsObject()));
+        QosServers.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -8772,8 +15224,49 @@ bool PlayFab::MultiplayerModels::FListPartyQosServersResponse::readFromValue(con
         FString TmpValue;
         if (SkipTokenValue->TryGetString(TmpValue)) { SkipToken = TmpValue; }
     }
-
-    return HasSucceeded;
+
+    return HasSucceeded;
+}
+
+bool PlayFab::MultiplayerModels::FListPartyQosServersResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PageSize"))
+        {
+            reader.ReadValue(PageSize);
+        }
+        else if (reader.IsField("QosServers"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { QosServers[QosServers.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("SkipToken"))
+        {
+            reader.ReadValue(SkipToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListPartyQosServersResponse();
+        return false;
+    }
+    return true;
 }
 
 PlayFab::MultiplayerModels::FListQosServersForTitleRequest::~FListQosServersForTitleRequest()
@@ -8781,7 +15274,8 @@ PlayFab::MultiplayerModels::FListQosServersForTitleRequest::~FListQosServersForT
 
 }
 
-void PlayFab::MultiplayerModels::FListQosServersForTitleRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListQosServersForTitleRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8805,6 +15299,16 @@ void PlayFab::MultiplayerModels::FListQosServersForTitleRequest::writeJSON(JsonW
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListQosServersForTitleRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListQosServersForTitleRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListQosServersForTitleRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8814,7 +15318,7 @@ bool PlayFab::MultiplayerModels::FListQosServersForTitleRequest::readFromValue(c
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -8828,12 +15332,50 @@ bool PlayFab::MultiplayerModels::FListQosServersForTitleRequest::readFromValue(c
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListQosServersForTitleRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("IncludeAllRegions"))
+        {
+            reader.ReadValue(IncludeAllRegions);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListQosServersForTitleRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListQosServersForTitleResponse::~FListQosServersForTitleResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListQosServersForTitleResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListQosServersForTitleResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8858,6 +15400,16 @@ void PlayFab::MultiplayerModels::FListQosServersForTitleResponse::writeJSON(Json
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListQosServersForTitleResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListQosServersForTitleResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListQosServersForTitleResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8873,7 +15425,7 @@ bool PlayFab::MultiplayerModels::FListQosServersForTitleResponse::readFromValue(
     for (int32 Idx = 0; Idx < QosServersArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = QosServersArray[Idx];
-        QosServers.Add(FQosServer(CurrentItem->AsObject()));
+        QosServers.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -8887,12 +15439,54 @@ bool PlayFab::MultiplayerModels::FListQosServersForTitleResponse::readFromValue(
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListQosServersForTitleResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PageSize"))
+        {
+            reader.ReadValue(PageSize);
+        }
+        else if (reader.IsField("QosServers"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { QosServers[QosServers.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("SkipToken"))
+        {
+            reader.ReadValue(SkipToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListQosServersForTitleResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerRequest::~FListServerBackfillTicketsForPlayerRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8923,6 +15517,16 @@ void PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerRequest::wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8932,7 +15536,7 @@ bool PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerRequest::rea
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -8952,12 +15556,54 @@ bool PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerRequest::rea
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("QueueName"))
+        {
+            reader.ReadValue(QueueName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListServerBackfillTicketsForPlayerRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerResult::~FListServerBackfillTicketsForPlayerResult()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerResult::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerResult::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -8970,6 +15616,16 @@ void PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerResult::writ
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerResult::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerResult::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerResult::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -8979,12 +15635,46 @@ bool PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerResult::read
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListServerBackfillTicketsForPlayerResult::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TicketIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { TicketIds.Add(TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListServerBackfillTicketsForPlayerResult();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRequest::~FListTitleMultiplayerServersQuotaChangesRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9002,6 +15692,16 @@ void PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRequest
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9011,19 +15711,53 @@ bool PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRequest
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListTitleMultiplayerServersQuotaChangesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesResponse::~FListTitleMultiplayerServersQuotaChangesResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9039,6 +15773,16 @@ void PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRespons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9047,19 +15791,53 @@ bool PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesRespons
     for (int32 Idx = 0; Idx < ChangesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ChangesArray[Idx];
-        Changes.Add(FQuotaChange(CurrentItem->AsObject()));
+        Changes.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListTitleMultiplayerServersQuotaChangesResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Changes"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Changes[Changes.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListTitleMultiplayerServersQuotaChangesResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListVirtualMachineSummariesRequest::~FListVirtualMachineSummariesRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListVirtualMachineSummariesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListVirtualMachineSummariesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9109,6 +15887,16 @@ void PlayFab::MultiplayerModels::FListVirtualMachineSummariesRequest::writeJSON(
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListVirtualMachineSummariesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListVirtualMachineSummariesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListVirtualMachineSummariesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9125,7 +15913,7 @@ bool PlayFab::MultiplayerModels::FListVirtualMachineSummariesRequest::readFromVa
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -9153,12 +15941,62 @@ bool PlayFab::MultiplayerModels::FListVirtualMachineSummariesRequest::readFromVa
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FListVirtualMachineSummariesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PageSize"))
+        {
+            reader.ReadValue(PageSize);
+        }
+        else if (reader.IsField("Region"))
+        {
+            reader.ReadValue(Region);
+        }
+        else if (reader.IsField("SkipToken"))
+        {
+            reader.ReadValue(SkipToken);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListVirtualMachineSummariesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FVirtualMachineSummary::~FVirtualMachineSummary()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FVirtualMachineSummary::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FVirtualMachineSummary::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9183,6 +16021,16 @@ void PlayFab::MultiplayerModels::FVirtualMachineSummary::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FVirtualMachineSummary::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FVirtualMachineSummary::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FVirtualMachineSummary::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9211,12 +16059,47 @@ bool PlayFab::MultiplayerModels::FVirtualMachineSummary::readFromValue(const TSh
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FVirtualMachineSummary::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("HealthStatus"))
+        {
+            reader.ReadValue(HealthStatus);
+        }
+        else if (reader.IsField("State"))
+        {
+            reader.ReadValue(State);
+        }
+        else if (reader.IsField("VmId"))
+        {
+            reader.ReadValue(VmId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FVirtualMachineSummary();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FListVirtualMachineSummariesResponse::~FListVirtualMachineSummariesResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FListVirtualMachineSummariesResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FListVirtualMachineSummariesResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9241,6 +16124,16 @@ void PlayFab::MultiplayerModels::FListVirtualMachineSummariesResponse::writeJSON
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FListVirtualMachineSummariesResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FListVirtualMachineSummariesResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FListVirtualMachineSummariesResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9263,14 +16156,56 @@ bool PlayFab::MultiplayerModels::FListVirtualMachineSummariesResponse::readFromV
     for (int32 Idx = 0; Idx < VirtualMachinesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = VirtualMachinesArray[Idx];
-        VirtualMachines.Add(FVirtualMachineSummary(CurrentItem->AsObject()));
+        VirtualMachines.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
-void PlayFab::MultiplayerModels::writeOsPlatformEnumJSON(OsPlatform enumVal, JsonWriter& writer)
+bool PlayFab::MultiplayerModels::FListVirtualMachineSummariesResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("PageSize"))
+        {
+            reader.ReadValue(PageSize);
+        }
+        else if (reader.IsField("SkipToken"))
+        {
+            reader.ReadValue(SkipToken);
+        }
+        else if (reader.IsField("VirtualMachines"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { VirtualMachines[VirtualMachines.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FListVirtualMachineSummariesResponse();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeOsPlatformEnumValue(MultiplayerModels::OsPlatform enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -9280,6 +16215,16 @@ void PlayFab::MultiplayerModels::writeOsPlatformEnumJSON(OsPlatform enumVal, Jso
     }
 }
 
+void PlayFab::MultiplayerModels::writeOsPlatformEnumJSON(OsPlatform enumVal, JsonWriter& writer)
+{
+    writeOsPlatformEnumValue(enumVal, writer);
+}
+
+void PlayFab::MultiplayerModels::writeOsPlatformEnumJSON(OsPlatform enumVal, JsonUtf8Writer& writer)
+{
+    writeOsPlatformEnumValue(enumVal, writer);
+}
+
 MultiplayerModels::OsPlatform PlayFab::MultiplayerModels::readOsPlatformFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readOsPlatformFromValue(value.IsValid() ? value->AsString() : "");
@@ -9312,7 +16257,8 @@ PlayFab::MultiplayerModels::FRequestMultiplayerServerRequest::~FRequestMultiplay
 
 }
 
-void PlayFab::MultiplayerModels::FRequestMultiplayerServerRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FRequestMultiplayerServerRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9373,6 +16319,16 @@ void PlayFab::MultiplayerModels::FRequestMultiplayerServerRequest::writeJSON(Jso
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FRequestMultiplayerServerRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FRequestMultiplayerServerRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FRequestMultiplayerServerRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9380,7 +16336,7 @@ bool PlayFab::MultiplayerModels::FRequestMultiplayerServerRequest::readFromValue
     const TSharedPtr<FJsonValue> BuildAliasParamsValue = obj->TryGetField(TEXT("BuildAliasParams"));
     if (BuildAliasParamsValue.IsValid() && !BuildAliasParamsValue->IsNull())
     {
-        pfBuildAliasParams = MakeShareable(new FBuildAliasParams(BuildAliasParamsValue->AsObject()));
+        pfBuildAliasParams = MakeShared<FBuildAliasParams>(BuildAliasParamsValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> BuildIdValue = obj->TryGetField(TEXT("BuildId"));
@@ -9395,7 +16351,7 @@ bool PlayFab::MultiplayerModels::FRequestMultiplayerServerRequest::readFromValue
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -9420,12 +16376,85 @@ bool PlayFab::MultiplayerModels::FRequestMultiplayerServerRequest::readFromValue
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FRequestMultiplayerServerRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildAliasParams"))
+        {
+            pfBuildAliasParams = MakeShared<FBuildAliasParams>();
+            pfBuildAliasParams->readFromReader(reader);
+        }
+        else if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("InitialPlayers"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { InitialPlayers.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("PreferredRegions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { PreferredRegions.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("SessionCookie"))
+        {
+            reader.ReadValue(SessionCookie);
+        }
+        else if (reader.IsField("SessionId"))
+        {
+            reader.ReadValue(SessionId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRequestMultiplayerServerRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FRequestMultiplayerServerResponse::~FRequestMultiplayerServerResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FRequestMultiplayerServerResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FRequestMultiplayerServerResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9501,7 +16530,17 @@ void PlayFab::MultiplayerModels::FRequestMultiplayerServerResponse::writeJSON(Js
         writer->WriteValue(VmId);
     }
 
-    writer->WriteObjectEnd();
+    writer->WriteObjectEnd();
+}
+
+void PlayFab::MultiplayerModels::FRequestMultiplayerServerResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FRequestMultiplayerServerResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
 }
 
 bool PlayFab::MultiplayerModels::FRequestMultiplayerServerResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
@@ -9519,7 +16558,7 @@ bool PlayFab::MultiplayerModels::FRequestMultiplayerServerResponse::readFromValu
     for (int32 Idx = 0; Idx < ConnectedPlayersArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ConnectedPlayersArray[Idx];
-        ConnectedPlayers.Add(FConnectedPlayer(CurrentItem->AsObject()));
+        ConnectedPlayers.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -9546,7 +16585,7 @@ bool PlayFab::MultiplayerModels::FRequestMultiplayerServerResponse::readFromValu
     for (int32 Idx = 0; Idx < PortsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PortsArray[Idx];
-        Ports.Add(FPort(CurrentItem->AsObject()));
+        Ports.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -9588,12 +16627,93 @@ bool PlayFab::MultiplayerModels::FRequestMultiplayerServerResponse::readFromValu
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FRequestMultiplayerServerResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("ConnectedPlayers"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { ConnectedPlayers[ConnectedPlayers.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("FQDN"))
+        {
+            reader.ReadValue(FQDN);
+        }
+        else if (reader.IsField("IPV4Address"))
+        {
+            reader.ReadValue(IPV4Address);
+        }
+        else if (reader.IsField("LastStateTransitionTime"))
+        {
+            reader.ReadValue(LastStateTransitionTime);
+        }
+        else if (reader.IsField("Ports"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Ports[Ports.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Region"))
+        {
+            reader.ReadValue(Region);
+        }
+        else if (reader.IsField("ServerId"))
+        {
+            reader.ReadValue(ServerId);
+        }
+        else if (reader.IsField("SessionId"))
+        {
+            reader.ReadValue(SessionId);
+        }
+        else if (reader.IsField("State"))
+        {
+            reader.ReadValue(State);
+        }
+        else if (reader.IsField("VmId"))
+        {
+            reader.ReadValue(VmId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRequestMultiplayerServerResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsRequest::~FRolloverContainerRegistryCredentialsRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9611,6 +16731,16 @@ void PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsRequest::w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9620,19 +16750,53 @@ bool PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsRequest::r
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRolloverContainerRegistryCredentialsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsResponse::~FRolloverContainerRegistryCredentialsResponse()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9657,6 +16821,16 @@ void PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsResponse::
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9685,7 +16859,42 @@ bool PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsResponse::
     return HasSucceeded;
 }
 
-void PlayFab::MultiplayerModels::writeServerTypeEnumJSON(ServerType enumVal, JsonWriter& writer)
+bool PlayFab::MultiplayerModels::FRolloverContainerRegistryCredentialsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DnsName"))
+        {
+            reader.ReadValue(DnsName);
+        }
+        else if (reader.IsField("Password"))
+        {
+            reader.ReadValue(Password);
+        }
+        else if (reader.IsField("Username"))
+        {
+            reader.ReadValue(Username);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FRolloverContainerRegistryCredentialsResponse();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeServerTypeEnumValue(MultiplayerModels::ServerType enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -9695,6 +16904,16 @@ void PlayFab::MultiplayerModels::writeServerTypeEnumJSON(ServerType enumVal, Jso
     }
 }
 
+void PlayFab::MultiplayerModels::writeServerTypeEnumJSON(ServerType enumVal, JsonWriter& writer)
+{
+    writeServerTypeEnumValue(enumVal, writer);
+}
+
+void PlayFab::MultiplayerModels::writeServerTypeEnumJSON(ServerType enumVal, JsonUtf8Writer& writer)
+{
+    writeServerTypeEnumValue(enumVal, writer);
+}
+
 MultiplayerModels::ServerType PlayFab::MultiplayerModels::readServerTypeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readServerTypeFromValue(value.IsValid() ? value->AsString() : "");
@@ -9726,7 +16945,8 @@ PlayFab::MultiplayerModels::FShutdownMultiplayerServerRequest::~FShutdownMultipl
 
 }
 
-void PlayFab::MultiplayerModels::FShutdownMultiplayerServerRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FShutdownMultiplayerServerRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9774,6 +16994,16 @@ void PlayFab::MultiplayerModels::FShutdownMultiplayerServerRequest::writeJSON(Js
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FShutdownMultiplayerServerRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FShutdownMultiplayerServerRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FShutdownMultiplayerServerRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9790,7 +17020,7 @@ bool PlayFab::MultiplayerModels::FShutdownMultiplayerServerRequest::readFromValu
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -9811,12 +17041,58 @@ bool PlayFab::MultiplayerModels::FShutdownMultiplayerServerRequest::readFromValu
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FShutdownMultiplayerServerRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Region"))
+        {
+            reader.ReadValue(Region);
+        }
+        else if (reader.IsField("SessionId"))
+        {
+            reader.ReadValue(SessionId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FShutdownMultiplayerServerRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FUntagContainerImageRequest::~FUntagContainerImageRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FUntagContainerImageRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FUntagContainerImageRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9846,6 +17122,16 @@ void PlayFab::MultiplayerModels::FUntagContainerImageRequest::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FUntagContainerImageRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FUntagContainerImageRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FUntagContainerImageRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9855,7 +17141,7 @@ bool PlayFab::MultiplayerModels::FUntagContainerImageRequest::readFromValue(cons
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -9876,12 +17162,54 @@ bool PlayFab::MultiplayerModels::FUntagContainerImageRequest::readFromValue(cons
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FUntagContainerImageRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("ImageName"))
+        {
+            reader.ReadValue(ImageName);
+        }
+        else if (reader.IsField("Tag"))
+        {
+            reader.ReadValue(Tag);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUntagContainerImageRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FUpdateBuildAliasRequest::~FUpdateBuildAliasRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FUpdateBuildAliasRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FUpdateBuildAliasRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -9924,6 +17252,16 @@ void PlayFab::MultiplayerModels::FUpdateBuildAliasRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FUpdateBuildAliasRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FUpdateBuildAliasRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FUpdateBuildAliasRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -9946,7 +17284,7 @@ bool PlayFab::MultiplayerModels::FUpdateBuildAliasRequest::readFromValue(const T
     for (int32 Idx = 0; Idx < BuildSelectionCriteriaArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BuildSelectionCriteriaArray[Idx];
-        BuildSelectionCriteria.Add(FBuildSelectionCriterion(CurrentItem->AsObject()));
+        BuildSelectionCriteria.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -9955,19 +17293,72 @@ bool PlayFab::MultiplayerModels::FUpdateBuildAliasRequest::readFromValue(const T
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FUpdateBuildAliasRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AliasId"))
+        {
+            reader.ReadValue(AliasId);
+        }
+        else if (reader.IsField("AliasName"))
+        {
+            reader.ReadValue(AliasName);
+        }
+        else if (reader.IsField("BuildSelectionCriteria"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { BuildSelectionCriteria[BuildSelectionCriteria.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateBuildAliasRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FUpdateBuildNameRequest::~FUpdateBuildNameRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FUpdateBuildNameRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FUpdateBuildNameRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10005,6 +17396,16 @@ void PlayFab::MultiplayerModels::FUpdateBuildNameRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FUpdateBuildNameRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FUpdateBuildNameRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FUpdateBuildNameRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10028,19 +17429,61 @@ bool PlayFab::MultiplayerModels::FUpdateBuildNameRequest::readFromValue(const TS
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FUpdateBuildNameRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("BuildName"))
+        {
+            reader.ReadValue(BuildName);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateBuildNameRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FUpdateBuildRegionRequest::~FUpdateBuildRegionRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FUpdateBuildRegionRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FUpdateBuildRegionRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10071,6 +17514,16 @@ void PlayFab::MultiplayerModels::FUpdateBuildRegionRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FUpdateBuildRegionRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FUpdateBuildRegionRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FUpdateBuildRegionRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10093,19 +17546,61 @@ bool PlayFab::MultiplayerModels::FUpdateBuildRegionRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FUpdateBuildRegionRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("BuildRegion"))
+        {
+            BuildRegion.readFromReader(reader);
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateBuildRegionRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FUpdateBuildRegionsRequest::~FUpdateBuildRegionsRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FUpdateBuildRegionsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FUpdateBuildRegionsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10139,6 +17634,16 @@ void PlayFab::MultiplayerModels::FUpdateBuildRegionsRequest::writeJSON(JsonWrite
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FUpdateBuildRegionsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FUpdateBuildRegionsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FUpdateBuildRegionsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10154,7 +17659,7 @@ bool PlayFab::MultiplayerModels::FUpdateBuildRegionsRequest::readFromValue(const
     for (int32 Idx = 0; Idx < BuildRegionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = BuildRegionsArray[Idx];
-        BuildRegions.Add(FBuildRegionParams(CurrentItem->AsObject()));
+        BuildRegions.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -10163,19 +17668,68 @@ bool PlayFab::MultiplayerModels::FUpdateBuildRegionsRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FUpdateBuildRegionsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("BuildId"))
+        {
+            reader.ReadValue(BuildId);
+        }
+        else if (reader.IsField("BuildRegions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { BuildRegions[BuildRegions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUpdateBuildRegionsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::MultiplayerModels::FUploadCertificateRequest::~FUploadCertificateRequest()
 {
 
 }
 
-void PlayFab::MultiplayerModels::FUploadCertificateRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::MultiplayerModels::FUploadCertificateRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -10196,6 +17750,16 @@ void PlayFab::MultiplayerModels::FUploadCertificateRequest::writeJSON(JsonWriter
     writer->WriteObjectEnd();
 }
 
+void PlayFab::MultiplayerModels::FUploadCertificateRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::MultiplayerModels::FUploadCertificateRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::MultiplayerModels::FUploadCertificateRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -10205,7 +17769,7 @@ bool PlayFab::MultiplayerModels::FUploadCertificateRequest::readFromValue(const
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -10218,3 +17782,40 @@ bool PlayFab::MultiplayerModels::FUploadCertificateRequest::readFromValue(const
     return HasSucceeded;
 }
 
+bool PlayFab::MultiplayerModels::FUploadCertificateRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("GameCertificate"))
+        {
+            GameCertificate.readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FUploadCertificateRequest();
+        return false;
+    }
+    return true;
+}
+
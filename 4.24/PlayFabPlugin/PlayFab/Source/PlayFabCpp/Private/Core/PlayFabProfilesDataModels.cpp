@@ -7,11 +7,13 @@
 
 #include "Core/PlayFabProfilesDataModels.h"
 #include "Core/PlayFabJsonHelpers.h"
+#include "Core/PlayFabJsonPullReader.h"
 
 using namespace PlayFab;
 using namespace PlayFab::ProfilesModels;
 
-void PlayFab::ProfilesModels::writeEffectTypeEnumJSON(EffectType enumVal, JsonWriter& writer)
+template <typename WriterType>
+static void writeEffectTypeEnumValue(ProfilesModels::EffectType enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -21,6 +23,16 @@ void PlayFab::ProfilesModels::writeEffectTypeEnumJSON(EffectType enumVal, JsonWr
     }
 }
 
+void PlayFab::ProfilesModels::writeEffectTypeEnumJSON(EffectType enumVal, JsonWriter& writer)
+{
+    writeEffectTypeEnumValue(enumVal, writer);
+}
+
+void PlayFab::ProfilesModels::writeEffectTypeEnumJSON(EffectType enumVal, JsonUtf8Writer& writer)
+{
+    writeEffectTypeEnumValue(enumVal, writer);
+}
+
 ProfilesModels::EffectType PlayFab::ProfilesModels::readEffectTypeFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readEffectTypeFromValue(value.IsValid() ? value->AsString() : "");
@@ -52,7 +64,8 @@ PlayFab::ProfilesModels::FEntityDataObject::~FEntityDataObject()
 
 }
 
-void PlayFab::ProfilesModels::FEntityDataObject::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FEntityDataObject::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -77,6 +90,16 @@ void PlayFab::ProfilesModels::FEntityDataObject::writeJSON(JsonWriter& writer) c
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FEntityDataObject::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FEntityDataObject::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FEntityDataObject::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -104,12 +127,47 @@ bool PlayFab::ProfilesModels::FEntityDataObject::readFromValue(const TSharedPtr<
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FEntityDataObject::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("DataObject"))
+        {
+            DataObject.readFromReader(reader);
+        }
+        else if (reader.IsField("EscapedDataObject"))
+        {
+            reader.ReadValue(EscapedDataObject);
+        }
+        else if (reader.IsField("ObjectName"))
+        {
+            reader.ReadValue(ObjectName);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityDataObject();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FEntityKey::~FEntityKey()
 {
 
 }
 
-void PlayFab::ProfilesModels::FEntityKey::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FEntityKey::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -132,6 +190,16 @@ void PlayFab::ProfilesModels::FEntityKey::writeJSON(JsonWriter& writer) const
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FEntityKey::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FEntityKey::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FEntityKey::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -153,12 +221,43 @@ bool PlayFab::ProfilesModels::FEntityKey::readFromValue(const TSharedPtr<FJsonOb
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FEntityKey::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Id"))
+        {
+            reader.ReadValue(Id);
+        }
+        else if (reader.IsField("Type"))
+        {
+            reader.ReadValue(Type);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityKey();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FEntityLineage::~FEntityLineage()
 {
 
 }
 
-void PlayFab::ProfilesModels::FEntityLineage::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FEntityLineage::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -201,6 +300,16 @@ void PlayFab::ProfilesModels::FEntityLineage::writeJSON(JsonWriter& writer) cons
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FEntityLineage::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FEntityLineage::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FEntityLineage::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -250,12 +359,59 @@ bool PlayFab::ProfilesModels::FEntityLineage::readFromValue(const TSharedPtr<FJs
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FEntityLineage::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CharacterId"))
+        {
+            reader.ReadValue(CharacterId);
+        }
+        else if (reader.IsField("GroupId"))
+        {
+            reader.ReadValue(GroupId);
+        }
+        else if (reader.IsField("MasterPlayerAccountId"))
+        {
+            reader.ReadValue(MasterPlayerAccountId);
+        }
+        else if (reader.IsField("NamespaceId"))
+        {
+            reader.ReadValue(NamespaceId);
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else if (reader.IsField("TitlePlayerAccountId"))
+        {
+            reader.ReadValue(TitlePlayerAccountId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityLineage();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FEntityPermissionStatement::~FEntityPermissionStatement()
 {
 
 }
 
-void PlayFab::ProfilesModels::FEntityPermissionStatement::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FEntityPermissionStatement::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -300,6 +456,16 @@ void PlayFab::ProfilesModels::FEntityPermissionStatement::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FEntityPermissionStatement::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FEntityPermissionStatement::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FEntityPermissionStatement::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -342,12 +508,60 @@ bool PlayFab::ProfilesModels::FEntityPermissionStatement::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FEntityPermissionStatement::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Action"))
+        {
+            reader.ReadValue(Action);
+        }
+        else if (reader.IsField("Comment"))
+        {
+            reader.ReadValue(Comment);
+        }
+        else if (reader.IsField("Condition"))
+        {
+            Condition.readFromReader(reader);
+        }
+        else if (reader.IsField("Effect"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { Effect = readEffectTypeFromValue(TmpValue); }
+        }
+        else if (reader.IsField("Principal"))
+        {
+            Principal.readFromReader(reader);
+        }
+        else if (reader.IsField("Resource"))
+        {
+            reader.ReadValue(Resource);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityPermissionStatement();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FEntityProfileFileMetadata::~FEntityProfileFileMetadata()
 {
 
 }
 
-void PlayFab::ProfilesModels::FEntityProfileFileMetadata::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FEntityProfileFileMetadata::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -372,6 +586,16 @@ void PlayFab::ProfilesModels::FEntityProfileFileMetadata::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FEntityProfileFileMetadata::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FEntityProfileFileMetadata::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FEntityProfileFileMetadata::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -405,12 +629,51 @@ bool PlayFab::ProfilesModels::FEntityProfileFileMetadata::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FEntityProfileFileMetadata::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Checksum"))
+        {
+            reader.ReadValue(Checksum);
+        }
+        else if (reader.IsField("FileName"))
+        {
+            reader.ReadValue(FileName);
+        }
+        else if (reader.IsField("LastModified"))
+        {
+            reader.ReadValue(LastModified);
+        }
+        else if (reader.IsField("Size"))
+        {
+            reader.ReadValue(Size);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityProfileFileMetadata();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FEntityStatisticChildValue::~FEntityStatisticChildValue()
 {
 
 }
 
-void PlayFab::ProfilesModels::FEntityStatisticChildValue::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FEntityStatisticChildValue::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -432,6 +695,16 @@ void PlayFab::ProfilesModels::FEntityStatisticChildValue::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FEntityStatisticChildValue::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FEntityStatisticChildValue::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FEntityStatisticChildValue::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -460,12 +733,47 @@ bool PlayFab::ProfilesModels::FEntityStatisticChildValue::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FEntityStatisticChildValue::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ChildName"))
+        {
+            reader.ReadValue(ChildName);
+        }
+        else if (reader.IsField("Metadata"))
+        {
+            reader.ReadValue(Metadata);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityStatisticChildValue();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FEntityStatisticValue::~FEntityStatisticValue()
 {
 
 }
 
-void PlayFab::ProfilesModels::FEntityStatisticValue::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FEntityStatisticValue::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -504,6 +812,16 @@ void PlayFab::ProfilesModels::FEntityStatisticValue::writeJSON(JsonWriter& write
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FEntityStatisticValue::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FEntityStatisticValue::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FEntityStatisticValue::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -513,7 +831,7 @@ bool PlayFab::ProfilesModels::FEntityStatisticValue::readFromValue(const TShared
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*ChildStatisticsObject)->Values); It; ++It)
         {
-            ChildStatistics.Add(It.Key(), FEntityStatisticChildValue(It.Value()->AsObject()));
+            ChildStatistics.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -548,6 +866,55 @@ bool PlayFab::ProfilesModels::FEntityStatisticValue::readFromValue(const TShared
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FEntityStatisticValue::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("ChildStatistics"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { ChildStatistics.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Metadata"))
+        {
+            reader.ReadValue(Metadata);
+        }
+        else if (reader.IsField("Name"))
+        {
+            reader.ReadValue(Name);
+        }
+        else if (reader.IsField("Value"))
+        {
+            reader.ReadValue(Value);
+        }
+        else if (reader.IsField("Version"))
+        {
+            reader.ReadValue(Version);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityStatisticValue();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FEntityProfileBody::~FEntityProfileBody()
 {
     //if (Entity != nullptr) delete Entity;
@@ -555,7 +922,8 @@ PlayFab::ProfilesModels::FEntityProfileBody::~FEntityProfileBody()
 
 }
 
-void PlayFab::ProfilesModels::FEntityProfileBody::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FEntityProfileBody::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -661,6 +1029,16 @@ void PlayFab::ProfilesModels::FEntityProfileBody::writeJSON(JsonWriter& writer)
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FEntityProfileBody::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FEntityProfileBody::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FEntityProfileBody::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -687,7 +1065,7 @@ bool PlayFab::ProfilesModels::FEntityProfileBody::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> EntityChainValue = obj->TryGetField(TEXT("EntityChain"));
@@ -704,7 +1082,7 @@ bool PlayFab::ProfilesModels::FEntityProfileBody::readFromValue(const TSharedPtr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*FilesObject)->Values); It; ++It)
         {
-            Files.Add(It.Key(), FEntityProfileFileMetadata(It.Value()->AsObject()));
+            Files.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -725,7 +1103,7 @@ bool PlayFab::ProfilesModels::FEntityProfileBody::readFromValue(const TSharedPtr
     const TSharedPtr<FJsonValue> LineageValue = obj->TryGetField(TEXT("Lineage"));
     if (LineageValue.IsValid() && !LineageValue->IsNull())
     {
-        Lineage = MakeShareable(new FEntityLineage(LineageValue->AsObject()));
+        Lineage = MakeShared<FEntityLineage>(LineageValue->AsObject());
     }
 
     const TSharedPtr<FJsonObject>* ObjectsObject;
@@ -733,7 +1111,7 @@ bool PlayFab::ProfilesModels::FEntityProfileBody::readFromValue(const TSharedPtr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*ObjectsObject)->Values); It; ++It)
         {
-            Objects.Add(It.Key(), FEntityDataObject(It.Value()->AsObject()));
+            Objects.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -741,7 +1119,7 @@ bool PlayFab::ProfilesModels::FEntityProfileBody::readFromValue(const TSharedPtr
     for (int32 Idx = 0; Idx < PermissionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PermissionsArray[Idx];
-        Permissions.Add(FEntityPermissionStatement(CurrentItem->AsObject()));
+        Permissions.Emplace(CurrentItem->AsObject());
     }
 
 
@@ -750,7 +1128,7 @@ bool PlayFab::ProfilesModels::FEntityProfileBody::readFromValue(const TSharedPtr
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*StatisticsObject)->Values); It; ++It)
         {
-            Statistics.Add(It.Key(), FEntityStatisticValue(It.Value()->AsObject()));
+            Statistics.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
@@ -764,13 +1142,129 @@ bool PlayFab::ProfilesModels::FEntityProfileBody::readFromValue(const TSharedPtr
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FEntityProfileBody::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("AvatarUrl"))
+        {
+            reader.ReadValue(AvatarUrl);
+        }
+        else if (reader.IsField("Created"))
+        {
+            reader.ReadValue(Created);
+        }
+        else if (reader.IsField("DisplayName"))
+        {
+            reader.ReadValue(DisplayName);
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("EntityChain"))
+        {
+            reader.ReadValue(EntityChain);
+        }
+        else if (reader.IsField("ExperimentVariants"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { ExperimentVariants.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Files"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { Files.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Language"))
+        {
+            reader.ReadValue(Language);
+        }
+        else if (reader.IsField("LeaderboardMetadata"))
+        {
+            reader.ReadValue(LeaderboardMetadata);
+        }
+        else if (reader.IsField("Lineage"))
+        {
+            Lineage = MakeShared<FEntityLineage>();
+            Lineage->readFromReader(reader);
+        }
+        else if (reader.IsField("Objects"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { Objects.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Permissions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Permissions[Permissions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("Statistics"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { Statistics.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else if (reader.IsField("VersionNumber"))
+        {
+            reader.ReadValue(VersionNumber);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FEntityProfileBody();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FGetEntityProfileRequest::~FGetEntityProfileRequest()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::ProfilesModels::FGetEntityProfileRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FGetEntityProfileRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -800,6 +1294,16 @@ void PlayFab::ProfilesModels::FGetEntityProfileRequest::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FGetEntityProfileRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FGetEntityProfileRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FGetEntityProfileRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -809,7 +1313,7 @@ bool PlayFab::ProfilesModels::FGetEntityProfileRequest::readFromValue(const TSha
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -823,31 +1327,84 @@ bool PlayFab::ProfilesModels::FGetEntityProfileRequest::readFromValue(const TSha
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
-PlayFab::ProfilesModels::FGetEntityProfileResponse::~FGetEntityProfileResponse()
-{
-    //if (Profile != nullptr) delete Profile;
-
-}
-
-void PlayFab::ProfilesModels::FGetEntityProfileResponse::writeJSON(JsonWriter& writer) const
+bool PlayFab::ProfilesModels::FGetEntityProfileRequest::readFromReader(FPlayFabJsonPullReader& reader)
 {
-    writer->WriteObjectStart();
+    if (!reader.ReadObjectStart())
+        return false;
 
-    if (Profile.IsValid())
+    while (reader.NextField())
     {
-        writer->WriteIdentifierPrefix(TEXT("Profile"));
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("DataAsObject"))
+        {
+            reader.ReadValue(DataAsObject);
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetEntityProfileRequest();
+        return false;
+    }
+    return true;
+}
+
+PlayFab::ProfilesModels::FGetEntityProfileResponse::~FGetEntityProfileResponse()
+{
+    //if (Profile != nullptr) delete Profile;
+
+}
+
+template <typename WriterType>
+void PlayFab::ProfilesModels::FGetEntityProfileResponse::writeJSONObject(WriterType& writer) const
+{
+    writer->WriteObjectStart();
+
+    if (Profile.IsValid())
+    {
+        writer->WriteIdentifierPrefix(TEXT("Profile"));
         Profile->writeJSON(writer);
     }
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FGetEntityProfileResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FGetEntityProfileResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FGetEntityProfileResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -855,18 +1412,46 @@ bool PlayFab::ProfilesModels::FGetEntityProfileResponse::readFromValue(const TSh
     const TSharedPtr<FJsonValue> ProfileValue = obj->TryGetField(TEXT("Profile"));
     if (ProfileValue.IsValid() && !ProfileValue->IsNull())
     {
-        Profile = MakeShareable(new FEntityProfileBody(ProfileValue->AsObject()));
+        Profile = MakeShared<FEntityProfileBody>(ProfileValue->AsObject());
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FGetEntityProfileResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Profile"))
+        {
+            Profile = MakeShared<FEntityProfileBody>();
+            Profile->readFromReader(reader);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetEntityProfileResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FGetEntityProfilesRequest::~FGetEntityProfilesRequest()
 {
 
 }
 
-void PlayFab::ProfilesModels::FGetEntityProfilesRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FGetEntityProfilesRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -896,6 +1481,16 @@ void PlayFab::ProfilesModels::FGetEntityProfilesRequest::writeJSON(JsonWriter& w
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FGetEntityProfilesRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FGetEntityProfilesRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FGetEntityProfilesRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -905,7 +1500,7 @@ bool PlayFab::ProfilesModels::FGetEntityProfilesRequest::readFromValue(const TSh
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -920,19 +1515,68 @@ bool PlayFab::ProfilesModels::FGetEntityProfilesRequest::readFromValue(const TSh
     for (int32 Idx = 0; Idx < EntitiesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = EntitiesArray[Idx];
-        Entities.Add(FEntityKey(CurrentItem->AsObject()));
+        Entities.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FGetEntityProfilesRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("DataAsObject"))
+        {
+            reader.ReadValue(DataAsObject);
+        }
+        else if (reader.IsField("Entities"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Entities[Entities.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetEntityProfilesRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FGetEntityProfilesResponse::~FGetEntityProfilesResponse()
 {
 
 }
 
-void PlayFab::ProfilesModels::FGetEntityProfilesResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FGetEntityProfilesResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -948,6 +1592,16 @@ void PlayFab::ProfilesModels::FGetEntityProfilesResponse::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FGetEntityProfilesResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FGetEntityProfilesResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FGetEntityProfilesResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -956,19 +1610,53 @@ bool PlayFab::ProfilesModels::FGetEntityProfilesResponse::readFromValue(const TS
     for (int32 Idx = 0; Idx < ProfilesArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = ProfilesArray[Idx];
-        Profiles.Add(FEntityProfileBody(CurrentItem->AsObject()));
+        Profiles.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FGetEntityProfilesResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Profiles"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Profiles[Profiles.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetEntityProfilesResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FGetGlobalPolicyRequest::~FGetGlobalPolicyRequest()
 {
 
 }
 
-void PlayFab::ProfilesModels::FGetGlobalPolicyRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FGetGlobalPolicyRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -986,6 +1674,16 @@ void PlayFab::ProfilesModels::FGetGlobalPolicyRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FGetGlobalPolicyRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FGetGlobalPolicyRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FGetGlobalPolicyRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -995,19 +1693,53 @@ bool PlayFab::ProfilesModels::FGetGlobalPolicyRequest::readFromValue(const TShar
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FGetGlobalPolicyRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetGlobalPolicyRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FGetGlobalPolicyResponse::~FGetGlobalPolicyResponse()
 {
 
 }
 
-void PlayFab::ProfilesModels::FGetGlobalPolicyResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FGetGlobalPolicyResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1023,6 +1755,16 @@ void PlayFab::ProfilesModels::FGetGlobalPolicyResponse::writeJSON(JsonWriter& wr
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FGetGlobalPolicyResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FGetGlobalPolicyResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FGetGlobalPolicyResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1031,19 +1773,53 @@ bool PlayFab::ProfilesModels::FGetGlobalPolicyResponse::readFromValue(const TSha
     for (int32 Idx = 0; Idx < PermissionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PermissionsArray[Idx];
-        Permissions.Add(FEntityPermissionStatement(CurrentItem->AsObject()));
+        Permissions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FGetGlobalPolicyResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Permissions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Permissions[Permissions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetGlobalPolicyResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsRequest::~FGetTitlePlayersFromMasterPlayerAccountIdsRequest()
 {
 
 }
 
-void PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1073,6 +1849,16 @@ void PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsRequest:
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1082,7 +1868,7 @@ bool PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsRequest:
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1098,12 +1884,61 @@ bool PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsRequest:
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("MasterPlayerAccountIds"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { MasterPlayerAccountIds.Add(TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitlePlayersFromMasterPlayerAccountIdsRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsResponse::~FGetTitlePlayersFromMasterPlayerAccountIdsResponse()
 {
 
 }
 
-void PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1127,6 +1962,16 @@ void PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsResponse
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1143,14 +1988,52 @@ bool PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsResponse
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*TitlePlayerAccountsObject)->Values); It; ++It)
         {
-            TitlePlayerAccounts.Add(It.Key(), FEntityKey(It.Value()->AsObject()));
+            TitlePlayerAccounts.Emplace(It.Key(), It.Value()->AsObject());
         }
     }
 
     return HasSucceeded;
 }
 
-void PlayFab::ProfilesModels::writeOperationTypesEnumJSON(OperationTypes enumVal, JsonWriter& writer)
+bool PlayFab::ProfilesModels::FGetTitlePlayersFromMasterPlayerAccountIdsResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("TitleId"))
+        {
+            reader.ReadValue(TitleId);
+        }
+        else if (reader.IsField("TitlePlayerAccounts"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    if (reader.PeekObjectStart()) { TitlePlayerAccounts.Add(reader.GetFieldName()).readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FGetTitlePlayersFromMasterPlayerAccountIdsResponse();
+        return false;
+    }
+    return true;
+}
+
+template <typename WriterType>
+static void writeOperationTypesEnumValue(ProfilesModels::OperationTypes enumVal, WriterType& writer)
 {
     switch (enumVal)
     {
@@ -1162,6 +2045,16 @@ void PlayFab::ProfilesModels::writeOperationTypesEnumJSON(OperationTypes enumVal
     }
 }
 
+void PlayFab::ProfilesModels::writeOperationTypesEnumJSON(OperationTypes enumVal, JsonWriter& writer)
+{
+    writeOperationTypesEnumValue(enumVal, writer);
+}
+
+void PlayFab::ProfilesModels::writeOperationTypesEnumJSON(OperationTypes enumVal, JsonUtf8Writer& writer)
+{
+    writeOperationTypesEnumValue(enumVal, writer);
+}
+
 ProfilesModels::OperationTypes PlayFab::ProfilesModels::readOperationTypesFromValue(const TSharedPtr<FJsonValue>& value)
 {
     return readOperationTypesFromValue(value.IsValid() ? value->AsString() : "");
@@ -1195,7 +2088,8 @@ PlayFab::ProfilesModels::FSetEntityProfilePolicyRequest::~FSetEntityProfilePolic
 
 }
 
-void PlayFab::ProfilesModels::FSetEntityProfilePolicyRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FSetEntityProfilePolicyRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1225,6 +2119,16 @@ void PlayFab::ProfilesModels::FSetEntityProfilePolicyRequest::writeJSON(JsonWrit
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FSetEntityProfilePolicyRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FSetEntityProfilePolicyRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FSetEntityProfilePolicyRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1234,7 +2138,7 @@ bool PlayFab::ProfilesModels::FSetEntityProfilePolicyRequest::readFromValue(cons
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1248,19 +2152,68 @@ bool PlayFab::ProfilesModels::FSetEntityProfilePolicyRequest::readFromValue(cons
     for (int32 Idx = 0; Idx < StatementsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = StatementsArray[Idx];
-        Statements.Add(FEntityPermissionStatement(CurrentItem->AsObject()));
+        Statements.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FSetEntityProfilePolicyRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity.readFromReader(reader);
+        }
+        else if (reader.IsField("Statements"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Statements[Statements.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetEntityProfilePolicyRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FSetEntityProfilePolicyResponse::~FSetEntityProfilePolicyResponse()
 {
 
 }
 
-void PlayFab::ProfilesModels::FSetEntityProfilePolicyResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FSetEntityProfilePolicyResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1276,6 +2229,16 @@ void PlayFab::ProfilesModels::FSetEntityProfilePolicyResponse::writeJSON(JsonWri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FSetEntityProfilePolicyResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FSetEntityProfilePolicyResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FSetEntityProfilePolicyResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1284,19 +2247,53 @@ bool PlayFab::ProfilesModels::FSetEntityProfilePolicyResponse::readFromValue(con
     for (int32 Idx = 0; Idx < PermissionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PermissionsArray[Idx];
-        Permissions.Add(FEntityPermissionStatement(CurrentItem->AsObject()));
+        Permissions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FSetEntityProfilePolicyResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("Permissions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Permissions[Permissions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetEntityProfilePolicyResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FSetGlobalPolicyRequest::~FSetGlobalPolicyRequest()
 {
 
 }
 
-void PlayFab::ProfilesModels::FSetGlobalPolicyRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FSetGlobalPolicyRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1323,6 +2320,16 @@ void PlayFab::ProfilesModels::FSetGlobalPolicyRequest::writeJSON(JsonWriter& wri
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FSetGlobalPolicyRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FSetGlobalPolicyRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FSetGlobalPolicyRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1332,7 +2339,7 @@ bool PlayFab::ProfilesModels::FSetGlobalPolicyRequest::readFromValue(const TShar
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
@@ -1340,25 +2347,80 @@ bool PlayFab::ProfilesModels::FSetGlobalPolicyRequest::readFromValue(const TShar
     for (int32 Idx = 0; Idx < PermissionsArray.Num(); Idx++)
     {
         TSharedPtr<FJsonValue> CurrentItem = PermissionsArray[Idx];
-        Permissions.Add(FEntityPermissionStatement(CurrentItem->AsObject()));
+        Permissions.Emplace(CurrentItem->AsObject());
     }
 
 
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FSetGlobalPolicyRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Permissions"))
+        {
+            if (reader.ReadArrayStart())
+            {
+                while (reader.NextArrayItem())
+                {
+                    if (reader.PeekObjectStart()) { Permissions[Permissions.AddDefaulted()].readFromReader(reader); }
+                    else { reader.SkipValue(); }
+                }
+            }
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetGlobalPolicyRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FSetGlobalPolicyResponse::~FSetGlobalPolicyResponse()
 {
 
 }
 
-void PlayFab::ProfilesModels::FSetGlobalPolicyResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FSetGlobalPolicyResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FSetGlobalPolicyResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FSetGlobalPolicyResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FSetGlobalPolicyResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1366,13 +2428,35 @@ bool PlayFab::ProfilesModels::FSetGlobalPolicyResponse::readFromValue(const TSha
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FSetGlobalPolicyResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetGlobalPolicyResponse();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FSetProfileLanguageRequest::~FSetProfileLanguageRequest()
 {
     //if (Entity != nullptr) delete Entity;
 
 }
 
-void PlayFab::ProfilesModels::FSetProfileLanguageRequest::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FSetProfileLanguageRequest::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1408,6 +2492,16 @@ void PlayFab::ProfilesModels::FSetProfileLanguageRequest::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FSetProfileLanguageRequest::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FSetProfileLanguageRequest::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FSetProfileLanguageRequest::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1417,14 +2511,14 @@ bool PlayFab::ProfilesModels::FSetProfileLanguageRequest::readFromValue(const TS
     {
         for (TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator It((*CustomTagsObject)->Values); It; ++It)
         {
-            CustomTags.Add(It.Key(), It.Value()->AsString());
+            CustomTags.Emplace(It.Key(), It.Value()->AsString());
         }
     }
 
     const TSharedPtr<FJsonValue> EntityValue = obj->TryGetField(TEXT("Entity"));
     if (EntityValue.IsValid() && !EntityValue->IsNull())
     {
-        Entity = MakeShareable(new FEntityKey(EntityValue->AsObject()));
+        Entity = MakeShared<FEntityKey>(EntityValue->AsObject());
     }
 
     const TSharedPtr<FJsonValue> ExpectedVersionValue = obj->TryGetField(TEXT("ExpectedVersion"));
@@ -1444,12 +2538,59 @@ bool PlayFab::ProfilesModels::FSetProfileLanguageRequest::readFromValue(const TS
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FSetProfileLanguageRequest::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("CustomTags"))
+        {
+            if (reader.ReadObjectStart())
+            {
+                while (reader.NextField())
+                {
+                    FString TmpValue;
+                    if (reader.ReadValue(TmpValue)) { CustomTags.Add(reader.GetFieldName(), TmpValue); }
+                }
+            }
+        }
+        else if (reader.IsField("Entity"))
+        {
+            Entity = MakeShared<FEntityKey>();
+            Entity->readFromReader(reader);
+        }
+        else if (reader.IsField("ExpectedVersion"))
+        {
+            reader.ReadValue(ExpectedVersion);
+        }
+        else if (reader.IsField("Language"))
+        {
+            reader.ReadValue(Language);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetProfileLanguageRequest();
+        return false;
+    }
+    return true;
+}
+
 PlayFab::ProfilesModels::FSetProfileLanguageResponse::~FSetProfileLanguageResponse()
 {
 
 }
 
-void PlayFab::ProfilesModels::FSetProfileLanguageResponse::writeJSON(JsonWriter& writer) const
+template <typename WriterType>
+void PlayFab::ProfilesModels::FSetProfileLanguageResponse::writeJSONObject(WriterType& writer) const
 {
     writer->WriteObjectStart();
 
@@ -1468,6 +2609,16 @@ void PlayFab::ProfilesModels::FSetProfileLanguageResponse::writeJSON(JsonWriter&
     writer->WriteObjectEnd();
 }
 
+void PlayFab::ProfilesModels::FSetProfileLanguageResponse::writeJSON(JsonWriter& writer) const
+{
+    writeJSONObject(writer);
+}
+
+void PlayFab::ProfilesModels::FSetProfileLanguageResponse::writeJSON(JsonUtf8Writer& writer) const
+{
+    writeJSONObject(writer);
+}
+
 bool PlayFab::ProfilesModels::FSetProfileLanguageResponse::readFromValue(const TSharedPtr<FJsonObject>& obj)
 {
     bool HasSucceeded = true;
@@ -1484,3 +2635,34 @@ bool PlayFab::ProfilesModels::FSetProfileLanguageResponse::readFromValue(const T
     return HasSucceeded;
 }
 
+bool PlayFab::ProfilesModels::FSetProfileLanguageResponse::readFromReader(FPlayFabJsonPullReader& reader)
+{
+    if (!reader.ReadObjectStart())
+        return false;
+
+    while (reader.NextField())
+    {
+        if (reader.ReadNull())
+            continue;
+
+        if (reader.IsField("OperationResult"))
+        {
+            FString TmpValue;
+            if (reader.ReadValue(TmpValue)) { OperationResult = readOperationTypesFromValue(TmpValue); }
+        }
+        else if (reader.IsField("VersionNumber"))
+        {
+            reader.ReadValue(VersionNumber);
+        }
+        else
+            reader.SkipValue();
+    }
+
+    if (!reader.IsValid())
+    {
+        *this = FSetProfileLanguageResponse();
+        return false;
+    }
+    return true;
+}
+
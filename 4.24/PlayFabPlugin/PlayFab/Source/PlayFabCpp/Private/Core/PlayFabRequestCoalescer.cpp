@@ -0,0 +1,90 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabRequestCoalescer.h"
+#include "PlayFabRuntimeSettings.h"
+#include "PlayFabResultHandler.h"
+#include "Misc/SecureHash.h"
+#include "Misc/ScopeLock.h"
+
+using namespace PlayFab;
+
+namespace
+{
+    FCriticalSection CoalescerLock;
+    // Callers waiting on each shared request, not counting the one that sent it
+    TMap<FString, TArray<FHttpRequestCompleteDelegate>> Joiners;
+    FThreadSafeCounter CoalescedCount;
+
+    FString MakeKey(const TSharedRef<IHttpRequest>& HttpRequest)
+    {
+        // Only one of the auth headers is set on any request
+        const FString AuthIdentity = HttpRequest->GetHeader(TEXT("X-Authorization"))
+            + TEXT("|") + HttpRequest->GetHeader(TEXT("X-EntityToken"))
+            + TEXT("|") + HttpRequest->GetHeader(TEXT("X-SecretKey"));
+
+        const TArray<uint8>& Body = HttpRequest->GetContent();
+        uint8 BodyHash[20];
+        FSHA1::HashBuffer(Body.GetData(), Body.Num(), BodyHash);
+
+        return HttpRequest->GetURL() + TEXT("|") + AuthIdentity + TEXT("|") + BytesToHex(BodyHash, sizeof(BodyHash));
+    }
+}
+
+bool FPlayFabRequestCoalescer::TryJoin(const TSharedRef<IHttpRequest>& HttpRequest, const FHttpRequestCompleteDelegate& OnComplete, FString& OutKey)
+{
+    if (!GetDefault<UPlayFabRuntimeSettings>()->bEnableRequestCoalescing)
+    {
+        return false;
+    }
+
+    const FString Key = MakeKey(HttpRequest);
+    FScopeLock Lock(&CoalescerLock);
+    if (TArray<FHttpRequestCompleteDelegate>* Waiting = Joiners.Find(Key))
+    {
+        Waiting->Add(OnComplete);
+        CoalescedCount.Increment();
+        return true;
+    }
+
+    Joiners.Add(Key);
+    OutKey = Key;
+    return false;
+}
+
+void FPlayFabRequestCoalescer::Complete(const FString& Key, const FHttpRequestCompleteDelegate& OnComplete, FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded)
+{
+    // Callbacks that issue the same read again must get a fresh request, not this response
+    TArray<FHttpRequestCompleteDelegate> Waiting;
+    {
+        FScopeLock Lock(&CoalescerLock);
+        Joiners.RemoveAndCopyValue(Key, Waiting);
+    }
+
+    PlayFabRequestHandler::DeliverToCaller(OnComplete, HttpRequest, HttpResponse, bSucceeded);
+    for (const FHttpRequestCompleteDelegate& Joined : Waiting)
+    {
+        PlayFabRequestHandler::DeliverToCaller(Joined, HttpRequest, HttpResponse, bSucceeded);
+    }
+}
+
+void FPlayFabRequestCoalescer::Abandon(const FString& Key, FHttpRequestPtr HttpRequest)
+{
+    TArray<FHttpRequestCompleteDelegate> Waiting;
+    {
+        FScopeLock Lock(&CoalescerLock);
+        Joiners.RemoveAndCopyValue(Key, Waiting);
+    }
+
+    for (const FHttpRequestCompleteDelegate& Joined : Waiting)
+    {
+        PlayFabRequestHandler::DeliverToCaller(Joined, HttpRequest, nullptr, false);
+    }
+}
+
+int32 FPlayFabRequestCoalescer::GetCoalescedCount()
+{
+    return CoalescedCount.GetValue();
+}
@@ -39,6 +39,16 @@ namespace CloudScriptModels
             Platform(src.Platform)
             {}
 
+        FAdCampaignAttributionModel(FAdCampaignAttributionModel&& src) :
+            FPlayFabCppBaseModel(),
+            AttributedAt(MoveTemp(src.AttributedAt)),
+            CampaignId(MoveTemp(src.CampaignId)),
+            Platform(MoveTemp(src.Platform))
+            {}
+
+        FAdCampaignAttributionModel& operator=(const FAdCampaignAttributionModel& src) = default;
+        FAdCampaignAttributionModel& operator=(FAdCampaignAttributionModel&& src) = default;
+
         FAdCampaignAttributionModel(const TSharedPtr<FJsonObject>& obj) : FAdCampaignAttributionModel()
         {
             readFromValue(obj);
@@ -47,7 +57,13 @@ namespace CloudScriptModels
         ~FAdCampaignAttributionModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum CloudScriptRevisionOption
@@ -58,6 +74,7 @@ namespace CloudScriptModels
     };
 
     PLAYFABCPP_API void writeCloudScriptRevisionOptionEnumJSON(CloudScriptRevisionOption enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeCloudScriptRevisionOptionEnumJSON(CloudScriptRevisionOption enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API CloudScriptRevisionOption readCloudScriptRevisionOptionFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API CloudScriptRevisionOption readCloudScriptRevisionOptionFromValue(const FString& value);
 
@@ -69,6 +86,7 @@ namespace CloudScriptModels
     };
 
     PLAYFABCPP_API void writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API EmailVerificationStatus readEmailVerificationStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API EmailVerificationStatus readEmailVerificationStatusFromValue(const FString& value);
 
@@ -97,6 +115,16 @@ namespace CloudScriptModels
             VerificationStatus(src.VerificationStatus)
             {}
 
+        FContactEmailInfoModel(FContactEmailInfoModel&& src) :
+            FPlayFabCppBaseModel(),
+            EmailAddress(MoveTemp(src.EmailAddress)),
+            Name(MoveTemp(src.Name)),
+            VerificationStatus(MoveTemp(src.VerificationStatus))
+            {}
+
+        FContactEmailInfoModel& operator=(const FContactEmailInfoModel& src) = default;
+        FContactEmailInfoModel& operator=(FContactEmailInfoModel&& src) = default;
+
         FContactEmailInfoModel(const TSharedPtr<FJsonObject>& obj) : FContactEmailInfoModel()
         {
             readFromValue(obj);
@@ -105,7 +133,13 @@ namespace CloudScriptModels
         ~FContactEmailInfoModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum ContinentCode
@@ -120,6 +154,7 @@ namespace CloudScriptModels
     };
 
     PLAYFABCPP_API void writeContinentCodeEnumJSON(ContinentCode enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeContinentCodeEnumJSON(ContinentCode enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API ContinentCode readContinentCodeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API ContinentCode readContinentCodeFromValue(const FString& value);
 
@@ -377,6 +412,7 @@ namespace CloudScriptModels
     };
 
     PLAYFABCPP_API void writeCountryCodeEnumJSON(CountryCode enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeCountryCodeEnumJSON(CountryCode enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API CountryCode readCountryCodeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API CountryCode readCountryCodeFromValue(const FString& value);
 
@@ -390,6 +426,13 @@ namespace CloudScriptModels
             FPlayFabCppResultCommon()
             {}
 
+        FEmptyResult(FEmptyResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FEmptyResult& operator=(const FEmptyResult& src) = default;
+        FEmptyResult& operator=(FEmptyResult&& src) = default;
+
         FEmptyResult(const TSharedPtr<FJsonObject>& obj) : FEmptyResult()
         {
             readFromValue(obj);
@@ -398,7 +441,13 @@ namespace CloudScriptModels
         ~FEmptyResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityKey : public PlayFab::FPlayFabCppBaseModel
@@ -421,6 +470,15 @@ namespace CloudScriptModels
             Type(src.Type)
             {}
 
+        FEntityKey(FEntityKey&& src) :
+            FPlayFabCppBaseModel(),
+            Id(MoveTemp(src.Id)),
+            Type(MoveTemp(src.Type))
+            {}
+
+        FEntityKey& operator=(const FEntityKey& src) = default;
+        FEntityKey& operator=(FEntityKey&& src) = default;
+
         FEntityKey(const TSharedPtr<FJsonObject>& obj) : FEntityKey()
         {
             readFromValue(obj);
@@ -429,7 +487,13 @@ namespace CloudScriptModels
         ~FEntityKey();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FScriptExecutionError : public PlayFab::FPlayFabCppBaseModel
@@ -460,6 +524,16 @@ namespace CloudScriptModels
             StackTrace(src.StackTrace)
             {}
 
+        FScriptExecutionError(FScriptExecutionError&& src) :
+            FPlayFabCppBaseModel(),
+            Error(MoveTemp(src.Error)),
+            Message(MoveTemp(src.Message)),
+            StackTrace(MoveTemp(src.StackTrace))
+            {}
+
+        FScriptExecutionError& operator=(const FScriptExecutionError& src) = default;
+        FScriptExecutionError& operator=(FScriptExecutionError&& src) = default;
+
         FScriptExecutionError(const TSharedPtr<FJsonObject>& obj) : FScriptExecutionError()
         {
             readFromValue(obj);
@@ -468,7 +542,13 @@ namespace CloudScriptModels
         ~FScriptExecutionError();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLogStatement : public PlayFab::FPlayFabCppBaseModel
@@ -496,6 +576,16 @@ namespace CloudScriptModels
             Message(src.Message)
             {}
 
+        FLogStatement(FLogStatement&& src) :
+            FPlayFabCppBaseModel(),
+            Data(MoveTemp(src.Data)),
+            Level(MoveTemp(src.Level)),
+            Message(MoveTemp(src.Message))
+            {}
+
+        FLogStatement& operator=(const FLogStatement& src) = default;
+        FLogStatement& operator=(FLogStatement&& src) = default;
+
         FLogStatement(const TSharedPtr<FJsonObject>& obj) : FLogStatement()
         {
             readFromValue(obj);
@@ -504,7 +594,13 @@ namespace CloudScriptModels
         ~FLogStatement();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FExecuteCloudScriptResult : public PlayFab::FPlayFabCppResultCommon
@@ -573,7 +669,7 @@ namespace CloudScriptModels
         FExecuteCloudScriptResult(const FExecuteCloudScriptResult& src) :
             FPlayFabCppResultCommon(),
             APIRequestsIssued(src.APIRequestsIssued),
-            Error(src.Error.IsValid() ? MakeShareable(new FScriptExecutionError(*src.Error)) : nullptr),
+            Error(src.Error.IsValid() ? TSharedPtr<FScriptExecutionError>(MakeShared<FScriptExecutionError>(*src.Error)) : nullptr),
             ExecutionTimeSeconds(src.ExecutionTimeSeconds),
             FunctionName(src.FunctionName),
             FunctionResult(src.FunctionResult),
@@ -586,6 +682,25 @@ namespace CloudScriptModels
             Revision(src.Revision)
             {}
 
+        FExecuteCloudScriptResult(FExecuteCloudScriptResult&& src) :
+            FPlayFabCppResultCommon(),
+            APIRequestsIssued(MoveTemp(src.APIRequestsIssued)),
+            Error(MoveTemp(src.Error)),
+            ExecutionTimeSeconds(MoveTemp(src.ExecutionTimeSeconds)),
+            FunctionName(MoveTemp(src.FunctionName)),
+            FunctionResult(MoveTemp(src.FunctionResult)),
+            FunctionResultTooLarge(MoveTemp(src.FunctionResultTooLarge)),
+            HttpRequestsIssued(MoveTemp(src.HttpRequestsIssued)),
+            Logs(MoveTemp(src.Logs)),
+            LogsTooLarge(MoveTemp(src.LogsTooLarge)),
+            MemoryConsumedBytes(MoveTemp(src.MemoryConsumedBytes)),
+            ProcessorTimeSeconds(MoveTemp(src.ProcessorTimeSeconds)),
+            Revision(MoveTemp(src.Revision))
+            {}
+
+        FExecuteCloudScriptResult& operator=(const FExecuteCloudScriptResult& src) = default;
+        FExecuteCloudScriptResult& operator=(FExecuteCloudScriptResult&& src) = default;
+
         FExecuteCloudScriptResult(const TSharedPtr<FJsonObject>& obj) : FExecuteCloudScriptResult()
         {
             readFromValue(obj);
@@ -594,7 +709,13 @@ namespace CloudScriptModels
         ~FExecuteCloudScriptResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FExecuteEntityCloudScriptRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -640,7 +761,7 @@ namespace CloudScriptModels
         FExecuteEntityCloudScriptRequest(const FExecuteEntityCloudScriptRequest& src) :
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             FunctionName(src.FunctionName),
             FunctionParameter(src.FunctionParameter),
             GeneratePlayStreamEvent(src.GeneratePlayStreamEvent),
@@ -648,6 +769,20 @@ namespace CloudScriptModels
             SpecificRevision(src.SpecificRevision)
             {}
 
+        FExecuteEntityCloudScriptRequest(FExecuteEntityCloudScriptRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            FunctionName(MoveTemp(src.FunctionName)),
+            FunctionParameter(MoveTemp(src.FunctionParameter)),
+            GeneratePlayStreamEvent(MoveTemp(src.GeneratePlayStreamEvent)),
+            RevisionSelection(MoveTemp(src.RevisionSelection)),
+            SpecificRevision(MoveTemp(src.SpecificRevision))
+            {}
+
+        FExecuteEntityCloudScriptRequest& operator=(const FExecuteEntityCloudScriptRequest& src) = default;
+        FExecuteEntityCloudScriptRequest& operator=(FExecuteEntityCloudScriptRequest&& src) = default;
+
         FExecuteEntityCloudScriptRequest(const TSharedPtr<FJsonObject>& obj) : FExecuteEntityCloudScriptRequest()
         {
             readFromValue(obj);
@@ -656,7 +791,13 @@ namespace CloudScriptModels
         ~FExecuteEntityCloudScriptRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FExecuteFunctionRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -690,12 +831,24 @@ namespace CloudScriptModels
         FExecuteFunctionRequest(const FExecuteFunctionRequest& src) :
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             FunctionName(src.FunctionName),
             FunctionParameter(src.FunctionParameter),
             GeneratePlayStreamEvent(src.GeneratePlayStreamEvent)
             {}
 
+        FExecuteFunctionRequest(FExecuteFunctionRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            FunctionName(MoveTemp(src.FunctionName)),
+            FunctionParameter(MoveTemp(src.FunctionParameter)),
+            GeneratePlayStreamEvent(MoveTemp(src.GeneratePlayStreamEvent))
+            {}
+
+        FExecuteFunctionRequest& operator=(const FExecuteFunctionRequest& src) = default;
+        FExecuteFunctionRequest& operator=(FExecuteFunctionRequest&& src) = default;
+
         FExecuteFunctionRequest(const TSharedPtr<FJsonObject>& obj) : FExecuteFunctionRequest()
         {
             readFromValue(obj);
@@ -704,7 +857,13 @@ namespace CloudScriptModels
         ~FExecuteFunctionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FFunctionExecutionError : public PlayFab::FPlayFabCppBaseModel
@@ -735,6 +894,16 @@ namespace CloudScriptModels
             StackTrace(src.StackTrace)
             {}
 
+        FFunctionExecutionError(FFunctionExecutionError&& src) :
+            FPlayFabCppBaseModel(),
+            Error(MoveTemp(src.Error)),
+            Message(MoveTemp(src.Message)),
+            StackTrace(MoveTemp(src.StackTrace))
+            {}
+
+        FFunctionExecutionError& operator=(const FFunctionExecutionError& src) = default;
+        FFunctionExecutionError& operator=(FFunctionExecutionError&& src) = default;
+
         FFunctionExecutionError(const TSharedPtr<FJsonObject>& obj) : FFunctionExecutionError()
         {
             readFromValue(obj);
@@ -743,7 +912,13 @@ namespace CloudScriptModels
         ~FFunctionExecutionError();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FExecuteFunctionResult : public PlayFab::FPlayFabCppResultCommon
@@ -774,13 +949,25 @@ namespace CloudScriptModels
 
         FExecuteFunctionResult(const FExecuteFunctionResult& src) :
             FPlayFabCppResultCommon(),
-            Error(src.Error.IsValid() ? MakeShareable(new FFunctionExecutionError(*src.Error)) : nullptr),
+            Error(src.Error.IsValid() ? TSharedPtr<FFunctionExecutionError>(MakeShared<FFunctionExecutionError>(*src.Error)) : nullptr),
             ExecutionTimeMilliseconds(src.ExecutionTimeMilliseconds),
             FunctionName(src.FunctionName),
             FunctionResult(src.FunctionResult),
             FunctionResultTooLarge(src.FunctionResultTooLarge)
             {}
 
+        FExecuteFunctionResult(FExecuteFunctionResult&& src) :
+            FPlayFabCppResultCommon(),
+            Error(MoveTemp(src.Error)),
+            ExecutionTimeMilliseconds(MoveTemp(src.ExecutionTimeMilliseconds)),
+            FunctionName(MoveTemp(src.FunctionName)),
+            FunctionResult(MoveTemp(src.FunctionResult)),
+            FunctionResultTooLarge(MoveTemp(src.FunctionResultTooLarge))
+            {}
+
+        FExecuteFunctionResult& operator=(const FExecuteFunctionResult& src) = default;
+        FExecuteFunctionResult& operator=(FExecuteFunctionResult&& src) = default;
+
         FExecuteFunctionResult(const TSharedPtr<FJsonObject>& obj) : FExecuteFunctionResult()
         {
             readFromValue(obj);
@@ -789,7 +976,13 @@ namespace CloudScriptModels
         ~FExecuteFunctionResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FFunctionModel : public PlayFab::FPlayFabCppBaseModel
@@ -817,6 +1010,16 @@ namespace CloudScriptModels
             TriggerType(src.TriggerType)
             {}
 
+        FFunctionModel(FFunctionModel&& src) :
+            FPlayFabCppBaseModel(),
+            FunctionAddress(MoveTemp(src.FunctionAddress)),
+            FunctionName(MoveTemp(src.FunctionName)),
+            TriggerType(MoveTemp(src.TriggerType))
+            {}
+
+        FFunctionModel& operator=(const FFunctionModel& src) = default;
+        FFunctionModel& operator=(FFunctionModel&& src) = default;
+
         FFunctionModel(const TSharedPtr<FJsonObject>& obj) : FFunctionModel()
         {
             readFromValue(obj);
@@ -825,7 +1028,13 @@ namespace CloudScriptModels
         ~FFunctionModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FHttpFunctionModel : public PlayFab::FPlayFabCppBaseModel
@@ -848,6 +1057,15 @@ namespace CloudScriptModels
             FunctionUrl(src.FunctionUrl)
             {}
 
+        FHttpFunctionModel(FHttpFunctionModel&& src) :
+            FPlayFabCppBaseModel(),
+            FunctionName(MoveTemp(src.FunctionName)),
+            FunctionUrl(MoveTemp(src.FunctionUrl))
+            {}
+
+        FHttpFunctionModel& operator=(const FHttpFunctionModel& src) = default;
+        FHttpFunctionModel& operator=(FHttpFunctionModel&& src) = default;
+
         FHttpFunctionModel(const TSharedPtr<FJsonObject>& obj) : FHttpFunctionModel()
         {
             readFromValue(obj);
@@ -856,7 +1074,13 @@ namespace CloudScriptModels
         ~FHttpFunctionModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum LoginIdentityProvider
@@ -885,6 +1109,7 @@ namespace CloudScriptModels
     };
 
     PLAYFABCPP_API void writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API LoginIdentityProvider readLoginIdentityProviderFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API LoginIdentityProvider readLoginIdentityProviderFromValue(const FString& value);
 
@@ -918,6 +1143,17 @@ namespace CloudScriptModels
             Username(src.Username)
             {}
 
+        FLinkedPlatformAccountModel(FLinkedPlatformAccountModel&& src) :
+            FPlayFabCppBaseModel(),
+            Email(MoveTemp(src.Email)),
+            Platform(MoveTemp(src.Platform)),
+            PlatformUserId(MoveTemp(src.PlatformUserId)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FLinkedPlatformAccountModel& operator=(const FLinkedPlatformAccountModel& src) = default;
+        FLinkedPlatformAccountModel& operator=(FLinkedPlatformAccountModel&& src) = default;
+
         FLinkedPlatformAccountModel(const TSharedPtr<FJsonObject>& obj) : FLinkedPlatformAccountModel()
         {
             readFromValue(obj);
@@ -926,7 +1162,13 @@ namespace CloudScriptModels
         ~FLinkedPlatformAccountModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListFunctionsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -943,6 +1185,14 @@ namespace CloudScriptModels
             CustomTags(src.CustomTags)
             {}
 
+        FListFunctionsRequest(FListFunctionsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FListFunctionsRequest& operator=(const FListFunctionsRequest& src) = default;
+        FListFunctionsRequest& operator=(FListFunctionsRequest&& src) = default;
+
         FListFunctionsRequest(const TSharedPtr<FJsonObject>& obj) : FListFunctionsRequest()
         {
             readFromValue(obj);
@@ -951,7 +1201,13 @@ namespace CloudScriptModels
         ~FListFunctionsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListFunctionsResult : public PlayFab::FPlayFabCppResultCommon
@@ -968,6 +1224,14 @@ namespace CloudScriptModels
             Functions(src.Functions)
             {}
 
+        FListFunctionsResult(FListFunctionsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Functions(MoveTemp(src.Functions))
+            {}
+
+        FListFunctionsResult& operator=(const FListFunctionsResult& src) = default;
+        FListFunctionsResult& operator=(FListFunctionsResult&& src) = default;
+
         FListFunctionsResult(const TSharedPtr<FJsonObject>& obj) : FListFunctionsResult()
         {
             readFromValue(obj);
@@ -976,7 +1240,13 @@ namespace CloudScriptModels
         ~FListFunctionsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListHttpFunctionsResult : public PlayFab::FPlayFabCppResultCommon
@@ -993,6 +1263,14 @@ namespace CloudScriptModels
             Functions(src.Functions)
             {}
 
+        FListHttpFunctionsResult(FListHttpFunctionsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Functions(MoveTemp(src.Functions))
+            {}
+
+        FListHttpFunctionsResult& operator=(const FListHttpFunctionsResult& src) = default;
+        FListHttpFunctionsResult& operator=(FListHttpFunctionsResult&& src) = default;
+
         FListHttpFunctionsResult(const TSharedPtr<FJsonObject>& obj) : FListHttpFunctionsResult()
         {
             readFromValue(obj);
@@ -1001,7 +1279,13 @@ namespace CloudScriptModels
         ~FListHttpFunctionsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FQueuedFunctionModel : public PlayFab::FPlayFabCppBaseModel
@@ -1029,6 +1313,16 @@ namespace CloudScriptModels
             QueueName(src.QueueName)
             {}
 
+        FQueuedFunctionModel(FQueuedFunctionModel&& src) :
+            FPlayFabCppBaseModel(),
+            ConnectionString(MoveTemp(src.ConnectionString)),
+            FunctionName(MoveTemp(src.FunctionName)),
+            QueueName(MoveTemp(src.QueueName))
+            {}
+
+        FQueuedFunctionModel& operator=(const FQueuedFunctionModel& src) = default;
+        FQueuedFunctionModel& operator=(FQueuedFunctionModel&& src) = default;
+
         FQueuedFunctionModel(const TSharedPtr<FJsonObject>& obj) : FQueuedFunctionModel()
         {
             readFromValue(obj);
@@ -1037,7 +1331,13 @@ namespace CloudScriptModels
         ~FQueuedFunctionModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListQueuedFunctionsResult : public PlayFab::FPlayFabCppResultCommon
@@ -1054,6 +1354,14 @@ namespace CloudScriptModels
             Functions(src.Functions)
             {}
 
+        FListQueuedFunctionsResult(FListQueuedFunctionsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Functions(MoveTemp(src.Functions))
+            {}
+
+        FListQueuedFunctionsResult& operator=(const FListQueuedFunctionsResult& src) = default;
+        FListQueuedFunctionsResult& operator=(FListQueuedFunctionsResult&& src) = default;
+
         FListQueuedFunctionsResult(const TSharedPtr<FJsonObject>& obj) : FListQueuedFunctionsResult()
         {
             readFromValue(obj);
@@ -1062,7 +1370,13 @@ namespace CloudScriptModels
         ~FListQueuedFunctionsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLocationModel : public PlayFab::FPlayFabCppBaseModel
@@ -1100,6 +1414,18 @@ namespace CloudScriptModels
             Longitude(src.Longitude)
             {}
 
+        FLocationModel(FLocationModel&& src) :
+            FPlayFabCppBaseModel(),
+            City(MoveTemp(src.City)),
+            pfContinentCode(MoveTemp(src.pfContinentCode)),
+            pfCountryCode(MoveTemp(src.pfCountryCode)),
+            Latitude(MoveTemp(src.Latitude)),
+            Longitude(MoveTemp(src.Longitude))
+            {}
+
+        FLocationModel& operator=(const FLocationModel& src) = default;
+        FLocationModel& operator=(FLocationModel&& src) = default;
+
         FLocationModel(const TSharedPtr<FJsonObject>& obj) : FLocationModel()
         {
             readFromValue(obj);
@@ -1108,7 +1434,13 @@ namespace CloudScriptModels
         ~FLocationModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum SubscriptionProviderStatus
@@ -1124,6 +1456,7 @@ namespace CloudScriptModels
     };
 
     PLAYFABCPP_API void writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API SubscriptionProviderStatus readSubscriptionProviderStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API SubscriptionProviderStatus readSubscriptionProviderStatusFromValue(const FString& value);
 
@@ -1172,6 +1505,20 @@ namespace CloudScriptModels
             SubscriptionProvider(src.SubscriptionProvider)
             {}
 
+        FSubscriptionModel(FSubscriptionModel&& src) :
+            FPlayFabCppBaseModel(),
+            Expiration(MoveTemp(src.Expiration)),
+            InitialSubscriptionTime(MoveTemp(src.InitialSubscriptionTime)),
+            IsActive(MoveTemp(src.IsActive)),
+            Status(MoveTemp(src.Status)),
+            SubscriptionId(MoveTemp(src.SubscriptionId)),
+            SubscriptionItemId(MoveTemp(src.SubscriptionItemId)),
+            SubscriptionProvider(MoveTemp(src.SubscriptionProvider))
+            {}
+
+        FSubscriptionModel& operator=(const FSubscriptionModel& src) = default;
+        FSubscriptionModel& operator=(FSubscriptionModel&& src) = default;
+
         FSubscriptionModel(const TSharedPtr<FJsonObject>& obj) : FSubscriptionModel()
         {
             readFromValue(obj);
@@ -1180,7 +1527,13 @@ namespace CloudScriptModels
         ~FSubscriptionModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMembershipModel : public PlayFab::FPlayFabCppBaseModel
@@ -1225,6 +1578,19 @@ namespace CloudScriptModels
             Subscriptions(src.Subscriptions)
             {}
 
+        FMembershipModel(FMembershipModel&& src) :
+            FPlayFabCppBaseModel(),
+            IsActive(MoveTemp(src.IsActive)),
+            MembershipExpiration(MoveTemp(src.MembershipExpiration)),
+            MembershipId(MoveTemp(src.MembershipId)),
+            OverrideExpiration(MoveTemp(src.OverrideExpiration)),
+            OverrideIsSet(MoveTemp(src.OverrideIsSet)),
+            Subscriptions(MoveTemp(src.Subscriptions))
+            {}
+
+        FMembershipModel& operator=(const FMembershipModel& src) = default;
+        FMembershipModel& operator=(FMembershipModel&& src) = default;
+
         FMembershipModel(const TSharedPtr<FJsonObject>& obj) : FMembershipModel()
         {
             readFromValue(obj);
@@ -1233,7 +1599,13 @@ namespace CloudScriptModels
         ~FMembershipModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FNameIdentifier : public PlayFab::FPlayFabCppBaseModel
@@ -1256,6 +1628,15 @@ namespace CloudScriptModels
             Name(src.Name)
             {}
 
+        FNameIdentifier(FNameIdentifier&& src) :
+            FPlayFabCppBaseModel(),
+            Id(MoveTemp(src.Id)),
+            Name(MoveTemp(src.Name))
+            {}
+
+        FNameIdentifier& operator=(const FNameIdentifier& src) = default;
+        FNameIdentifier& operator=(FNameIdentifier&& src) = default;
+
         FNameIdentifier(const TSharedPtr<FJsonObject>& obj) : FNameIdentifier()
         {
             readFromValue(obj);
@@ -1264,7 +1645,13 @@ namespace CloudScriptModels
         ~FNameIdentifier();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum PushNotificationPlatform
@@ -1274,6 +1661,7 @@ namespace CloudScriptModels
     };
 
     PLAYFABCPP_API void writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API PushNotificationPlatform readPushNotificationPlatformFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API PushNotificationPlatform readPushNotificationPlatformFromValue(const FString& value);
 
@@ -1297,6 +1685,15 @@ namespace CloudScriptModels
             Platform(src.Platform)
             {}
 
+        FPushNotificationRegistrationModel(FPushNotificationRegistrationModel&& src) :
+            FPlayFabCppBaseModel(),
+            NotificationEndpointARN(MoveTemp(src.NotificationEndpointARN)),
+            Platform(MoveTemp(src.Platform))
+            {}
+
+        FPushNotificationRegistrationModel& operator=(const FPushNotificationRegistrationModel& src) = default;
+        FPushNotificationRegistrationModel& operator=(FPushNotificationRegistrationModel&& src) = default;
+
         FPushNotificationRegistrationModel(const TSharedPtr<FJsonObject>& obj) : FPushNotificationRegistrationModel()
         {
             readFromValue(obj);
@@ -1305,7 +1702,13 @@ namespace CloudScriptModels
         ~FPushNotificationRegistrationModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStatisticModel : public PlayFab::FPlayFabCppBaseModel
@@ -1333,6 +1736,16 @@ namespace CloudScriptModels
             Version(src.Version)
             {}
 
+        FStatisticModel(FStatisticModel&& src) :
+            FPlayFabCppBaseModel(),
+            Name(MoveTemp(src.Name)),
+            Value(MoveTemp(src.Value)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FStatisticModel& operator=(const FStatisticModel& src) = default;
+        FStatisticModel& operator=(FStatisticModel&& src) = default;
+
         FStatisticModel(const TSharedPtr<FJsonObject>& obj) : FStatisticModel()
         {
             readFromValue(obj);
@@ -1341,7 +1754,13 @@ namespace CloudScriptModels
         ~FStatisticModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FTagModel : public PlayFab::FPlayFabCppBaseModel
@@ -1359,6 +1778,14 @@ namespace CloudScriptModels
             TagValue(src.TagValue)
             {}
 
+        FTagModel(FTagModel&& src) :
+            FPlayFabCppBaseModel(),
+            TagValue(MoveTemp(src.TagValue))
+            {}
+
+        FTagModel& operator=(const FTagModel& src) = default;
+        FTagModel& operator=(FTagModel&& src) = default;
+
         FTagModel(const TSharedPtr<FJsonObject>& obj) : FTagModel()
         {
             readFromValue(obj);
@@ -1367,7 +1794,13 @@ namespace CloudScriptModels
         ~FTagModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValueToDateModel : public PlayFab::FPlayFabCppBaseModel
@@ -1401,6 +1834,16 @@ namespace CloudScriptModels
             TotalValueAsDecimal(src.TotalValueAsDecimal)
             {}
 
+        FValueToDateModel(FValueToDateModel&& src) :
+            FPlayFabCppBaseModel(),
+            Currency(MoveTemp(src.Currency)),
+            TotalValue(MoveTemp(src.TotalValue)),
+            TotalValueAsDecimal(MoveTemp(src.TotalValueAsDecimal))
+            {}
+
+        FValueToDateModel& operator=(const FValueToDateModel& src) = default;
+        FValueToDateModel& operator=(FValueToDateModel&& src) = default;
+
         FValueToDateModel(const TSharedPtr<FJsonObject>& obj) : FValueToDateModel()
         {
             readFromValue(obj);
@@ -1409,7 +1852,13 @@ namespace CloudScriptModels
         ~FValueToDateModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerProfileModel : public PlayFab::FPlayFabCppBaseModel
@@ -1515,6 +1964,33 @@ namespace CloudScriptModels
             ValuesToDate(src.ValuesToDate)
             {}
 
+        FPlayerProfileModel(FPlayerProfileModel&& src) :
+            FPlayFabCppBaseModel(),
+            AdCampaignAttributions(MoveTemp(src.AdCampaignAttributions)),
+            AvatarUrl(MoveTemp(src.AvatarUrl)),
+            BannedUntil(MoveTemp(src.BannedUntil)),
+            ContactEmailAddresses(MoveTemp(src.ContactEmailAddresses)),
+            Created(MoveTemp(src.Created)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            ExperimentVariants(MoveTemp(src.ExperimentVariants)),
+            LastLogin(MoveTemp(src.LastLogin)),
+            LinkedAccounts(MoveTemp(src.LinkedAccounts)),
+            Locations(MoveTemp(src.Locations)),
+            Memberships(MoveTemp(src.Memberships)),
+            Origination(MoveTemp(src.Origination)),
+            PlayerId(MoveTemp(src.PlayerId)),
+            PublisherId(MoveTemp(src.PublisherId)),
+            PushNotificationRegistrations(MoveTemp(src.PushNotificationRegistrations)),
+            Statistics(MoveTemp(src.Statistics)),
+            Tags(MoveTemp(src.Tags)),
+            TitleId(MoveTemp(src.TitleId)),
+            TotalValueToDateInUSD(MoveTemp(src.TotalValueToDateInUSD)),
+            ValuesToDate(MoveTemp(src.ValuesToDate))
+            {}
+
+        FPlayerProfileModel& operator=(const FPlayerProfileModel& src) = default;
+        FPlayerProfileModel& operator=(FPlayerProfileModel&& src) = default;
+
         FPlayerProfileModel(const TSharedPtr<FJsonObject>& obj) : FPlayerProfileModel()
         {
             readFromValue(obj);
@@ -1523,7 +1999,13 @@ namespace CloudScriptModels
         ~FPlayerProfileModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayStreamEventEnvelopeModel : public PlayFab::FPlayFabCppBaseModel
@@ -1566,6 +2048,19 @@ namespace CloudScriptModels
             EventSettings(src.EventSettings)
             {}
 
+        FPlayStreamEventEnvelopeModel(FPlayStreamEventEnvelopeModel&& src) :
+            FPlayFabCppBaseModel(),
+            EntityId(MoveTemp(src.EntityId)),
+            EntityType(MoveTemp(src.EntityType)),
+            EventData(MoveTemp(src.EventData)),
+            EventName(MoveTemp(src.EventName)),
+            EventNamespace(MoveTemp(src.EventNamespace)),
+            EventSettings(MoveTemp(src.EventSettings))
+            {}
+
+        FPlayStreamEventEnvelopeModel& operator=(const FPlayStreamEventEnvelopeModel& src) = default;
+        FPlayStreamEventEnvelopeModel& operator=(FPlayStreamEventEnvelopeModel&& src) = default;
+
         FPlayStreamEventEnvelopeModel(const TSharedPtr<FJsonObject>& obj) : FPlayStreamEventEnvelopeModel()
         {
             readFromValue(obj);
@@ -1574,7 +2069,13 @@ namespace CloudScriptModels
         ~FPlayStreamEventEnvelopeModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPostFunctionResultForEntityTriggeredActionRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1601,6 +2102,16 @@ namespace CloudScriptModels
             FunctionResult(src.FunctionResult)
             {}
 
+        FPostFunctionResultForEntityTriggeredActionRequest(FPostFunctionResultForEntityTriggeredActionRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            FunctionResult(MoveTemp(src.FunctionResult))
+            {}
+
+        FPostFunctionResultForEntityTriggeredActionRequest& operator=(const FPostFunctionResultForEntityTriggeredActionRequest& src) = default;
+        FPostFunctionResultForEntityTriggeredActionRequest& operator=(FPostFunctionResultForEntityTriggeredActionRequest&& src) = default;
+
         FPostFunctionResultForEntityTriggeredActionRequest(const TSharedPtr<FJsonObject>& obj) : FPostFunctionResultForEntityTriggeredActionRequest()
         {
             readFromValue(obj);
@@ -1609,7 +2120,13 @@ namespace CloudScriptModels
         ~FPostFunctionResultForEntityTriggeredActionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPostFunctionResultForFunctionExecutionRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1636,6 +2153,16 @@ namespace CloudScriptModels
             FunctionResult(src.FunctionResult)
             {}
 
+        FPostFunctionResultForFunctionExecutionRequest(FPostFunctionResultForFunctionExecutionRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            FunctionResult(MoveTemp(src.FunctionResult))
+            {}
+
+        FPostFunctionResultForFunctionExecutionRequest& operator=(const FPostFunctionResultForFunctionExecutionRequest& src) = default;
+        FPostFunctionResultForFunctionExecutionRequest& operator=(FPostFunctionResultForFunctionExecutionRequest&& src) = default;
+
         FPostFunctionResultForFunctionExecutionRequest(const TSharedPtr<FJsonObject>& obj) : FPostFunctionResultForFunctionExecutionRequest()
         {
             readFromValue(obj);
@@ -1644,7 +2171,13 @@ namespace CloudScriptModels
         ~FPostFunctionResultForFunctionExecutionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPostFunctionResultForPlayerTriggeredActionRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1675,12 +2208,24 @@ namespace CloudScriptModels
         FPostFunctionResultForPlayerTriggeredActionRequest(const FPostFunctionResultForPlayerTriggeredActionRequest& src) :
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             FunctionResult(src.FunctionResult),
             PlayerProfile(src.PlayerProfile),
-            PlayStreamEventEnvelope(src.PlayStreamEventEnvelope.IsValid() ? MakeShareable(new FPlayStreamEventEnvelopeModel(*src.PlayStreamEventEnvelope)) : nullptr)
+            PlayStreamEventEnvelope(src.PlayStreamEventEnvelope.IsValid() ? TSharedPtr<FPlayStreamEventEnvelopeModel>(MakeShared<FPlayStreamEventEnvelopeModel>(*src.PlayStreamEventEnvelope)) : nullptr)
+            {}
+
+        FPostFunctionResultForPlayerTriggeredActionRequest(FPostFunctionResultForPlayerTriggeredActionRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            FunctionResult(MoveTemp(src.FunctionResult)),
+            PlayerProfile(MoveTemp(src.PlayerProfile)),
+            PlayStreamEventEnvelope(MoveTemp(src.PlayStreamEventEnvelope))
             {}
 
+        FPostFunctionResultForPlayerTriggeredActionRequest& operator=(const FPostFunctionResultForPlayerTriggeredActionRequest& src) = default;
+        FPostFunctionResultForPlayerTriggeredActionRequest& operator=(FPostFunctionResultForPlayerTriggeredActionRequest&& src) = default;
+
         FPostFunctionResultForPlayerTriggeredActionRequest(const TSharedPtr<FJsonObject>& obj) : FPostFunctionResultForPlayerTriggeredActionRequest()
         {
             readFromValue(obj);
@@ -1689,7 +2234,13 @@ namespace CloudScriptModels
         ~FPostFunctionResultForPlayerTriggeredActionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPostFunctionResultForScheduledTaskRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1721,6 +2272,17 @@ namespace CloudScriptModels
             ScheduledTaskId(src.ScheduledTaskId)
             {}
 
+        FPostFunctionResultForScheduledTaskRequest(FPostFunctionResultForScheduledTaskRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Entity(MoveTemp(src.Entity)),
+            FunctionResult(MoveTemp(src.FunctionResult)),
+            ScheduledTaskId(MoveTemp(src.ScheduledTaskId))
+            {}
+
+        FPostFunctionResultForScheduledTaskRequest& operator=(const FPostFunctionResultForScheduledTaskRequest& src) = default;
+        FPostFunctionResultForScheduledTaskRequest& operator=(FPostFunctionResultForScheduledTaskRequest&& src) = default;
+
         FPostFunctionResultForScheduledTaskRequest(const TSharedPtr<FJsonObject>& obj) : FPostFunctionResultForScheduledTaskRequest()
         {
             readFromValue(obj);
@@ -1729,7 +2291,13 @@ namespace CloudScriptModels
         ~FPostFunctionResultForScheduledTaskRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRegisterHttpFunctionRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1756,6 +2324,16 @@ namespace CloudScriptModels
             FunctionUrl(src.FunctionUrl)
             {}
 
+        FRegisterHttpFunctionRequest(FRegisterHttpFunctionRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            FunctionName(MoveTemp(src.FunctionName)),
+            FunctionUrl(MoveTemp(src.FunctionUrl))
+            {}
+
+        FRegisterHttpFunctionRequest& operator=(const FRegisterHttpFunctionRequest& src) = default;
+        FRegisterHttpFunctionRequest& operator=(FRegisterHttpFunctionRequest&& src) = default;
+
         FRegisterHttpFunctionRequest(const TSharedPtr<FJsonObject>& obj) : FRegisterHttpFunctionRequest()
         {
             readFromValue(obj);
@@ -1764,7 +2342,13 @@ namespace CloudScriptModels
         ~FRegisterHttpFunctionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRegisterQueuedFunctionRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1796,6 +2380,17 @@ namespace CloudScriptModels
             QueueName(src.QueueName)
             {}
 
+        FRegisterQueuedFunctionRequest(FRegisterQueuedFunctionRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ConnectionString(MoveTemp(src.ConnectionString)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            FunctionName(MoveTemp(src.FunctionName)),
+            QueueName(MoveTemp(src.QueueName))
+            {}
+
+        FRegisterQueuedFunctionRequest& operator=(const FRegisterQueuedFunctionRequest& src) = default;
+        FRegisterQueuedFunctionRequest& operator=(FRegisterQueuedFunctionRequest&& src) = default;
+
         FRegisterQueuedFunctionRequest(const TSharedPtr<FJsonObject>& obj) : FRegisterQueuedFunctionRequest()
         {
             readFromValue(obj);
@@ -1804,7 +2399,13 @@ namespace CloudScriptModels
         ~FRegisterQueuedFunctionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum TriggerType
@@ -1814,6 +2415,7 @@ namespace CloudScriptModels
     };
 
     PLAYFABCPP_API void writeTriggerTypeEnumJSON(TriggerType enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeTriggerTypeEnumJSON(TriggerType enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API TriggerType readTriggerTypeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API TriggerType readTriggerTypeFromValue(const FString& value);
 
@@ -1836,6 +2438,15 @@ namespace CloudScriptModels
             FunctionName(src.FunctionName)
             {}
 
+        FUnregisterFunctionRequest(FUnregisterFunctionRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            FunctionName(MoveTemp(src.FunctionName))
+            {}
+
+        FUnregisterFunctionRequest& operator=(const FUnregisterFunctionRequest& src) = default;
+        FUnregisterFunctionRequest& operator=(FUnregisterFunctionRequest&& src) = default;
+
         FUnregisterFunctionRequest(const TSharedPtr<FJsonObject>& obj) : FUnregisterFunctionRequest()
         {
             readFromValue(obj);
@@ -1844,7 +2455,13 @@ namespace CloudScriptModels
         ~FUnregisterFunctionRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
 }
@@ -0,0 +1,50 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PlayFab
+{
+    struct FPlayFabConnectionStats
+    {
+        // Warm-up requests sent, keep-alive pings included, and how many of them got no response
+        int32 PrewarmRequests = 0;
+        int32 PrewarmFailures = 0;
+        // Duration of the last warm-up request: roughly the DNS, TCP and TLS setup the first call would otherwise have paid
+        float LastPrewarmSeconds = 0.0f;
+        // Calls sent while a connection to their host was likely still open, and calls that probably had to open one
+        int32 WarmCalls = 0;
+        int32 ColdCalls = 0;
+
+        float GetReuseRatio() const { return WarmCalls + ColdCalls > 0 ? (float)WarmCalls / (WarmCalls + ColdCalls) : 0.0f; }
+    };
+
+    /**
+     * Opens connections to the title endpoint ahead of the first call, and optionally keeps them open while the game is idle.
+     * The engine's HTTP transport keeps connections alive between requests but doesn't report on them, so warming sends a small request,
+     * and reuse is estimated from whether a host saw traffic within UPlayFabRuntimeSettings::ConnectionIdleSeconds.
+     */
+    class PLAYFABCPP_API FPlayFabConnectionWarmer
+    {
+    public:
+        // Sends ConnectionCount warm-up requests to the host of Url
+        static void Prewarm(const FString& Url, int32 ConnectionCount);
+        // Stops keep-alive pings
+        static void Shutdown();
+
+        // Called by the request handler for every call it sends, and every attempt that completes
+        static void OnCallSent(const FString& Host);
+        static void OnActivity(const FString& Host);
+        // "titleId.playfabapi.com" for any url on that host
+        static FString GetHost(const FString& Url);
+
+        static FPlayFabConnectionStats GetStats();
+
+    private:
+        static bool KeepAlive(float DeltaTime);
+    };
+}
@@ -15,9 +15,25 @@
 
 namespace PlayFab
 {
+    // Condensed print policy that encodes straight to UTF-8, so request bodies can be handed to the http request without another conversion
+    struct PLAYFABCPP_API FPlayFabCondensedUtf8PrintPolicy
+    {
+        static void WriteChar(FArchive* Stream, TCHAR Char);
+        static void WriteString(FArchive* Stream, const FString& String);
+        static void WriteLineTerminator(FArchive* Stream) {}
+        static void WriteTabs(FArchive* Stream, int32 Count) {}
+        static void WriteSpace(FArchive* Stream) {}
+        static void WriteFloat(FArchive* Stream, float Value);
+        static void WriteDouble(FArchive* Stream, double Value);
+    };
+
     typedef TSharedRef< TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR> > > JsonWriter;
+    // Writes the same condensed json as JsonWriter, as UTF-8 bytes; used to build request bodies
+    typedef TSharedRef< TJsonWriter<TCHAR, FPlayFabCondensedUtf8PrintPolicy> > JsonUtf8Writer;
     typedef TSharedRef< TJsonReader<TCHAR> > JsonReader;
 
+    class FPlayFabJsonPullReader;
+
     template <typename BoxedType>
     class PLAYFABCPP_API Boxed
     {
@@ -44,10 +60,16 @@ namespace PlayFab
     {
         virtual ~FPlayFabCppBaseModel() {}
         virtual void writeJSON(JsonWriter& Json) const = 0;
+        // Generated models write straight to UTF-8; models that only implement the overload above are converted through it
+        virtual void writeJSON(JsonUtf8Writer& Json) const;
         virtual bool readFromValue(const TSharedPtr<FJsonObject>& obj) = 0;
         virtual bool readFromValue(const TSharedPtr<FJsonValue>& value) { return false; };
+        // Fills the model straight from the token stream; models without a generated reader go through the DOM
+        // Returns false on malformed input, in which case generated models are reset to their defaults rather than left half filled
+        virtual bool readFromReader(FPlayFabJsonPullReader& reader);
 
         FString toJSONString() const;
+        TArray<uint8> toJSONUtf8() const;
     };
 
     struct PLAYFABCPP_API FPlayFabCppRequestCommon : FPlayFabCppBaseModel
@@ -106,12 +128,19 @@ namespace PlayFab
 
         ~FJsonKeeper() {}
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<class FJsonObject>& obj) override;
         bool readFromValue(const TSharedPtr<class FJsonValue>& value) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
 
         TSharedPtr<class FJsonValue> GetJsonValue() const { return JsonValue; };
+
+    private:
+        template <typename WriterType>
+        void writeJSONValue(WriterType& writer) const;
     };
 
     void writeDatetime(FDateTime datetime, JsonWriter& writer);
+    void writeDatetime(FDateTime datetime, JsonUtf8Writer& writer);
     FDateTime readDatetime(const TSharedPtr<FJsonValue>& value);
 }
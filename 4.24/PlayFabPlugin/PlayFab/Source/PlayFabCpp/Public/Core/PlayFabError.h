@@ -17,6 +17,8 @@ namespace PlayFab
         PlayFabErrorConnectionTimeout,
         PlayFabErrorConnectionRefused,
         PlayFabErrorSocketError,
+        // Not sent, because calls to its API have been failing; see FPlayFabCircuitBreaker
+        PlayFabErrorCircuitOpen,
 		PlayFabErrorSuccess = 0,
         PlayFabErrorUnkownError = 500,
         PlayFabErrorInvalidParams = 1000,
@@ -652,6 +654,8 @@ namespace PlayFab
         FString ErrorName;
         FString ErrorMessage;
         TMultiMap< FString, FString > ErrorDetails;
+        // Seconds the service asked us to wait before calling again, or zero
+        int32 RetryAfterSeconds = 0;
 
         /*
          * This converts the PlayFabError into a human readable string describing the error.
@@ -0,0 +1,188 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Templates/IntegerSequence.h"
+#include "Templates/ValueOrError.h"
+#include "Misc/ScopeLock.h"
+#include "PlayFabError.h"
+
+namespace PlayFab
+{
+    /**
+     * Outcome of an asynchronous PlayFab call: either the result model, or the error the call failed with.
+     * This is a TValueOrError; it only adds the default constructor a TFuture needs to hold it on UE4.
+     */
+    template <typename ResultType>
+    class TPlayFabResult : public TValueOrError<ResultType, FPlayFabCppError>
+    {
+        typedef TValueOrError<ResultType, FPlayFabCppError> Super;
+
+    public:
+        TPlayFabResult() : Super(MakeError()) {}
+        template <typename... ArgTypes>
+        TPlayFabResult(TValueOrError_ValueProxy<ArgTypes...>&& Proxy) : Super(MoveTemp(Proxy)) {}
+        template <typename... ArgTypes>
+        TPlayFabResult(TValueOrError_ErrorProxy<ArgTypes...>&& Proxy) : Super(MoveTemp(Proxy)) {}
+    };
+
+    /**
+     * Runs Call, which starts a PlayFab call with the success and error delegates it is given, and returns a future for its outcome.
+     * Call returns false when the request could not be sent, in which case neither delegate runs and the future resolves with an error.
+     * Every other failure, a call turned away by the circuit breaker included, comes through the error delegate.
+     */
+    template <typename ResultType, typename SuccessDelegateType, typename CallType>
+    TFuture<TPlayFabResult<ResultType>> MakePlayFabFuture(CallType&& Call)
+    {
+        struct FState
+        {
+            TPromise<TPlayFabResult<ResultType>> Promise;
+            FCriticalSection Lock;
+            bool bIsSet = false;
+
+            // The HTTP layer may report a failed send both through the return value and through the error delegate
+            void Set(TPlayFabResult<ResultType>&& Outcome)
+            {
+                FScopeLock ScopeLock(&Lock);
+                if (!bIsSet)
+                {
+                    bIsSet = true;
+                    Promise.SetValue(MoveTemp(Outcome));
+                }
+            }
+        };
+
+        TSharedRef<FState, ESPMode::ThreadSafe> State = MakeShared<FState, ESPMode::ThreadSafe>();
+        TFuture<TPlayFabResult<ResultType>> Future = State->Promise.GetFuture();
+
+        const bool Sent = Call(
+            SuccessDelegateType::CreateLambda([State](const ResultType& Result) { State->Set(MakeValue(Result)); }),
+            FPlayFabErrorDelegate::CreateLambda([State](const FPlayFabCppError& Error) { State->Set(MakeError(Error)); }));
+        if (!Sent)
+        {
+            FPlayFabCppError Error;
+            Error.HttpCode = 0;
+            Error.ErrorCode = PlayFabErrorUnknownError;
+            Error.ErrorName = Error.ErrorMessage = TEXT("The request could not be sent");
+            State->Set(MakeError(Error));
+        }
+        return Future;
+    }
+
+    /** Resolves once every future has resolved, with their values in the same order */
+    template <typename ValueType>
+    TFuture<TArray<ValueType>> WhenAll(TArray<TFuture<ValueType>> Futures)
+    {
+        struct FState
+        {
+            TPromise<TArray<ValueType>> Promise;
+            TArray<ValueType> Values;
+            int32 Remaining = 0;
+            FCriticalSection Lock;
+        };
+
+        TSharedRef<FState, ESPMode::ThreadSafe> State = MakeShared<FState, ESPMode::ThreadSafe>();
+        TFuture<TArray<ValueType>> Result = State->Promise.GetFuture();
+        if (Futures.Num() == 0)
+        {
+            State->Promise.SetValue(TArray<ValueType>());
+            return Result;
+        }
+
+        State->Values.SetNum(Futures.Num());
+        State->Remaining = Futures.Num();
+        for (int32 Index = 0; Index < Futures.Num(); ++Index)
+        {
+            Futures[Index].Next([State, Index](ValueType Value)
+            {
+                FScopeLock ScopeLock(&State->Lock);
+                State->Values[Index] = MoveTemp(Value);
+                if (--State->Remaining == 0)
+                {
+                    State->Promise.SetValue(MoveTemp(State->Values));
+                }
+            });
+        }
+        return Result;
+    }
+
+    /** Resolves with the index and value of the first future to resolve */
+    template <typename ValueType>
+    TFuture<TPair<int32, ValueType>> WhenAny(TArray<TFuture<ValueType>> Futures)
+    {
+        struct FState
+        {
+            TPromise<TPair<int32, ValueType>> Promise;
+            bool bIsSet = false;
+            FCriticalSection Lock;
+        };
+
+        check(Futures.Num() > 0);
+        TSharedRef<FState, ESPMode::ThreadSafe> State = MakeShared<FState, ESPMode::ThreadSafe>();
+        TFuture<TPair<int32, ValueType>> Result = State->Promise.GetFuture();
+        for (int32 Index = 0; Index < Futures.Num(); ++Index)
+        {
+            Futures[Index].Next([State, Index](ValueType Value)
+            {
+                FScopeLock ScopeLock(&State->Lock);
+                if (!State->bIsSet)
+                {
+                    State->bIsSet = true;
+                    State->Promise.SetValue(TPair<int32, ValueType>(Index, MoveTemp(Value)));
+                }
+            });
+        }
+        return Result;
+    }
+
+    namespace PlayFabFutureDetail
+    {
+        template <typename... ValueTypes>
+        struct TWhenAllState
+        {
+            TPromise<TTuple<ValueTypes...>> Promise;
+            TTuple<ValueTypes...> Values;
+            int32 Remaining = sizeof...(ValueTypes);
+            FCriticalSection Lock;
+        };
+
+        template <uint32 Index, typename StateType, typename ValueType>
+        void AttachWhenAll(const TSharedRef<StateType, ESPMode::ThreadSafe>& State, TFuture<ValueType>&& Future)
+        {
+            Future.Next([State](ValueType Value)
+            {
+                FScopeLock ScopeLock(&State->Lock);
+                State->Values.template Get<Index>() = MoveTemp(Value);
+                if (--State->Remaining == 0)
+                {
+                    State->Promise.SetValue(MoveTemp(State->Values));
+                }
+            });
+        }
+
+        template <typename StateType, uint32... Indices, typename... ValueTypes>
+        void AttachWhenAll(const TSharedRef<StateType, ESPMode::ThreadSafe>& State, TIntegerSequence<uint32, Indices...>, TFuture<ValueTypes>&&... Futures)
+        {
+            int32 Expand[] = { (AttachWhenAll<Indices>(State, MoveTemp(Futures)), 0)... };
+            (void)Expand;
+        }
+    }
+
+    /** Resolves once every future has resolved, for calls with different result types, e.g. WhenAll(GetPlayerCombinedInfoAsync(...), GetTitleDataAsync(...)) */
+    template <typename... ValueTypes>
+    TFuture<TTuple<ValueTypes...>> WhenAll(TFuture<ValueTypes>&&... Futures)
+    {
+        static_assert(sizeof...(ValueTypes) > 0, "WhenAll needs at least one future");
+        using FState = PlayFabFutureDetail::TWhenAllState<ValueTypes...>;
+
+        TSharedRef<FState, ESPMode::ThreadSafe> State = MakeShared<FState, ESPMode::ThreadSafe>();
+        TFuture<TTuple<ValueTypes...>> Result = State->Promise.GetFuture();
+        PlayFabFutureDetail::AttachWhenAll(State, TMakeIntegerSequence<uint32, sizeof...(ValueTypes)>(), MoveTemp(Futures)...);
+        return Result;
+    }
+}
@@ -28,6 +28,14 @@ namespace LocalizationModels
             CustomTags(src.CustomTags)
             {}
 
+        FGetLanguageListRequest(FGetLanguageListRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FGetLanguageListRequest& operator=(const FGetLanguageListRequest& src) = default;
+        FGetLanguageListRequest& operator=(FGetLanguageListRequest&& src) = default;
+
         FGetLanguageListRequest(const TSharedPtr<FJsonObject>& obj) : FGetLanguageListRequest()
         {
             readFromValue(obj);
@@ -36,7 +44,13 @@ namespace LocalizationModels
         ~FGetLanguageListRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLanguageListResponse : public PlayFab::FPlayFabCppResultCommon
@@ -53,6 +67,14 @@ namespace LocalizationModels
             LanguageList(src.LanguageList)
             {}
 
+        FGetLanguageListResponse(FGetLanguageListResponse&& src) :
+            FPlayFabCppResultCommon(),
+            LanguageList(MoveTemp(src.LanguageList))
+            {}
+
+        FGetLanguageListResponse& operator=(const FGetLanguageListResponse& src) = default;
+        FGetLanguageListResponse& operator=(FGetLanguageListResponse&& src) = default;
+
         FGetLanguageListResponse(const TSharedPtr<FJsonObject>& obj) : FGetLanguageListResponse()
         {
             readFromValue(obj);
@@ -61,7 +83,13 @@ namespace LocalizationModels
         ~FGetLanguageListResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
 }
@@ -39,6 +39,16 @@ namespace ServerModels
             Platform(src.Platform)
             {}
 
+        FAdCampaignAttribution(FAdCampaignAttribution&& src) :
+            FPlayFabCppBaseModel(),
+            AttributedAt(MoveTemp(src.AttributedAt)),
+            CampaignId(MoveTemp(src.CampaignId)),
+            Platform(MoveTemp(src.Platform))
+            {}
+
+        FAdCampaignAttribution& operator=(const FAdCampaignAttribution& src) = default;
+        FAdCampaignAttribution& operator=(FAdCampaignAttribution&& src) = default;
+
         FAdCampaignAttribution(const TSharedPtr<FJsonObject>& obj) : FAdCampaignAttribution()
         {
             readFromValue(obj);
@@ -47,7 +57,13 @@ namespace ServerModels
         ~FAdCampaignAttribution();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAdCampaignAttributionModel : public PlayFab::FPlayFabCppBaseModel
@@ -75,6 +91,16 @@ namespace ServerModels
             Platform(src.Platform)
             {}
 
+        FAdCampaignAttributionModel(FAdCampaignAttributionModel&& src) :
+            FPlayFabCppBaseModel(),
+            AttributedAt(MoveTemp(src.AttributedAt)),
+            CampaignId(MoveTemp(src.CampaignId)),
+            Platform(MoveTemp(src.Platform))
+            {}
+
+        FAdCampaignAttributionModel& operator=(const FAdCampaignAttributionModel& src) = default;
+        FAdCampaignAttributionModel& operator=(FAdCampaignAttributionModel&& src) = default;
+
         FAdCampaignAttributionModel(const TSharedPtr<FJsonObject>& obj) : FAdCampaignAttributionModel()
         {
             readFromValue(obj);
@@ -83,7 +109,13 @@ namespace ServerModels
         ~FAdCampaignAttributionModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddCharacterVirtualCurrencyRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -123,6 +155,18 @@ namespace ServerModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FAddCharacterVirtualCurrencyRequest(FAddCharacterVirtualCurrencyRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Amount(MoveTemp(src.Amount)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FAddCharacterVirtualCurrencyRequest& operator=(const FAddCharacterVirtualCurrencyRequest& src) = default;
+        FAddCharacterVirtualCurrencyRequest& operator=(FAddCharacterVirtualCurrencyRequest&& src) = default;
+
         FAddCharacterVirtualCurrencyRequest(const TSharedPtr<FJsonObject>& obj) : FAddCharacterVirtualCurrencyRequest()
         {
             readFromValue(obj);
@@ -131,7 +175,13 @@ namespace ServerModels
         ~FAddCharacterVirtualCurrencyRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddFriendRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -169,6 +219,18 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FAddFriendRequest(FAddFriendRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            FriendEmail(MoveTemp(src.FriendEmail)),
+            FriendPlayFabId(MoveTemp(src.FriendPlayFabId)),
+            FriendTitleDisplayName(MoveTemp(src.FriendTitleDisplayName)),
+            FriendUsername(MoveTemp(src.FriendUsername)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FAddFriendRequest& operator=(const FAddFriendRequest& src) = default;
+        FAddFriendRequest& operator=(FAddFriendRequest&& src) = default;
+
         FAddFriendRequest(const TSharedPtr<FJsonObject>& obj) : FAddFriendRequest()
         {
             readFromValue(obj);
@@ -177,7 +239,13 @@ namespace ServerModels
         ~FAddFriendRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGenericServiceId : public PlayFab::FPlayFabCppBaseModel
@@ -200,6 +268,15 @@ namespace ServerModels
             UserId(src.UserId)
             {}
 
+        FGenericServiceId(FGenericServiceId&& src) :
+            FPlayFabCppBaseModel(),
+            ServiceName(MoveTemp(src.ServiceName)),
+            UserId(MoveTemp(src.UserId))
+            {}
+
+        FGenericServiceId& operator=(const FGenericServiceId& src) = default;
+        FGenericServiceId& operator=(FGenericServiceId&& src) = default;
+
         FGenericServiceId(const TSharedPtr<FJsonObject>& obj) : FGenericServiceId()
         {
             readFromValue(obj);
@@ -208,7 +285,13 @@ namespace ServerModels
         ~FGenericServiceId();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddGenericIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -231,6 +314,15 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FAddGenericIDRequest(FAddGenericIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            GenericId(MoveTemp(src.GenericId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FAddGenericIDRequest& operator=(const FAddGenericIDRequest& src) = default;
+        FAddGenericIDRequest& operator=(FAddGenericIDRequest&& src) = default;
+
         FAddGenericIDRequest(const TSharedPtr<FJsonObject>& obj) : FAddGenericIDRequest()
         {
             readFromValue(obj);
@@ -239,7 +331,13 @@ namespace ServerModels
         ~FAddGenericIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddPlayerTagRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -266,6 +364,16 @@ namespace ServerModels
             TagName(src.TagName)
             {}
 
+        FAddPlayerTagRequest(FAddPlayerTagRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            TagName(MoveTemp(src.TagName))
+            {}
+
+        FAddPlayerTagRequest& operator=(const FAddPlayerTagRequest& src) = default;
+        FAddPlayerTagRequest& operator=(FAddPlayerTagRequest&& src) = default;
+
         FAddPlayerTagRequest(const TSharedPtr<FJsonObject>& obj) : FAddPlayerTagRequest()
         {
             readFromValue(obj);
@@ -274,7 +382,13 @@ namespace ServerModels
         ~FAddPlayerTagRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddPlayerTagResult : public PlayFab::FPlayFabCppResultCommon
@@ -287,6 +401,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FAddPlayerTagResult(FAddPlayerTagResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FAddPlayerTagResult& operator=(const FAddPlayerTagResult& src) = default;
+        FAddPlayerTagResult& operator=(FAddPlayerTagResult&& src) = default;
+
         FAddPlayerTagResult(const TSharedPtr<FJsonObject>& obj) : FAddPlayerTagResult()
         {
             readFromValue(obj);
@@ -295,7 +416,13 @@ namespace ServerModels
         ~FAddPlayerTagResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddSharedGroupMembersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -317,6 +444,15 @@ namespace ServerModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FAddSharedGroupMembersRequest(FAddSharedGroupMembersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabIds(MoveTemp(src.PlayFabIds)),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FAddSharedGroupMembersRequest& operator=(const FAddSharedGroupMembersRequest& src) = default;
+        FAddSharedGroupMembersRequest& operator=(FAddSharedGroupMembersRequest&& src) = default;
+
         FAddSharedGroupMembersRequest(const TSharedPtr<FJsonObject>& obj) : FAddSharedGroupMembersRequest()
         {
             readFromValue(obj);
@@ -325,7 +461,13 @@ namespace ServerModels
         ~FAddSharedGroupMembersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddSharedGroupMembersResult : public PlayFab::FPlayFabCppResultCommon
@@ -338,6 +480,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FAddSharedGroupMembersResult(FAddSharedGroupMembersResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FAddSharedGroupMembersResult& operator=(const FAddSharedGroupMembersResult& src) = default;
+        FAddSharedGroupMembersResult& operator=(FAddSharedGroupMembersResult&& src) = default;
+
         FAddSharedGroupMembersResult(const TSharedPtr<FJsonObject>& obj) : FAddSharedGroupMembersResult()
         {
             readFromValue(obj);
@@ -346,7 +495,13 @@ namespace ServerModels
         ~FAddSharedGroupMembersResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAddUserVirtualCurrencyRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -381,6 +536,17 @@ namespace ServerModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FAddUserVirtualCurrencyRequest(FAddUserVirtualCurrencyRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Amount(MoveTemp(src.Amount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FAddUserVirtualCurrencyRequest& operator=(const FAddUserVirtualCurrencyRequest& src) = default;
+        FAddUserVirtualCurrencyRequest& operator=(FAddUserVirtualCurrencyRequest&& src) = default;
+
         FAddUserVirtualCurrencyRequest(const TSharedPtr<FJsonObject>& obj) : FAddUserVirtualCurrencyRequest()
         {
             readFromValue(obj);
@@ -389,7 +555,13 @@ namespace ServerModels
         ~FAddUserVirtualCurrencyRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum PushNotificationPlatform
@@ -399,6 +571,7 @@ namespace ServerModels
     };
 
     PLAYFABCPP_API void writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writePushNotificationPlatformEnumJSON(PushNotificationPlatform enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API PushNotificationPlatform readPushNotificationPlatformFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API PushNotificationPlatform readPushNotificationPlatformFromValue(const FString& value);
 
@@ -430,6 +603,16 @@ namespace ServerModels
             Platform(src.Platform)
             {}
 
+        FAdvancedPushPlatformMsg(FAdvancedPushPlatformMsg&& src) :
+            FPlayFabCppBaseModel(),
+            GCMDataOnly(MoveTemp(src.GCMDataOnly)),
+            Json(MoveTemp(src.Json)),
+            Platform(MoveTemp(src.Platform))
+            {}
+
+        FAdvancedPushPlatformMsg& operator=(const FAdvancedPushPlatformMsg& src) = default;
+        FAdvancedPushPlatformMsg& operator=(FAdvancedPushPlatformMsg&& src) = default;
+
         FAdvancedPushPlatformMsg(const TSharedPtr<FJsonObject>& obj) : FAdvancedPushPlatformMsg()
         {
             readFromValue(obj);
@@ -438,7 +621,13 @@ namespace ServerModels
         ~FAdvancedPushPlatformMsg();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAuthenticateSessionTicketRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -456,6 +645,14 @@ namespace ServerModels
             SessionTicket(src.SessionTicket)
             {}
 
+        FAuthenticateSessionTicketRequest(FAuthenticateSessionTicketRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            SessionTicket(MoveTemp(src.SessionTicket))
+            {}
+
+        FAuthenticateSessionTicketRequest& operator=(const FAuthenticateSessionTicketRequest& src) = default;
+        FAuthenticateSessionTicketRequest& operator=(FAuthenticateSessionTicketRequest&& src) = default;
+
         FAuthenticateSessionTicketRequest(const TSharedPtr<FJsonObject>& obj) : FAuthenticateSessionTicketRequest()
         {
             readFromValue(obj);
@@ -464,7 +661,13 @@ namespace ServerModels
         ~FAuthenticateSessionTicketRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserAndroidDeviceInfo : public PlayFab::FPlayFabCppBaseModel
@@ -482,6 +685,14 @@ namespace ServerModels
             AndroidDeviceId(src.AndroidDeviceId)
             {}
 
+        FUserAndroidDeviceInfo(FUserAndroidDeviceInfo&& src) :
+            FPlayFabCppBaseModel(),
+            AndroidDeviceId(MoveTemp(src.AndroidDeviceId))
+            {}
+
+        FUserAndroidDeviceInfo& operator=(const FUserAndroidDeviceInfo& src) = default;
+        FUserAndroidDeviceInfo& operator=(FUserAndroidDeviceInfo&& src) = default;
+
         FUserAndroidDeviceInfo(const TSharedPtr<FJsonObject>& obj) : FUserAndroidDeviceInfo()
         {
             readFromValue(obj);
@@ -490,7 +701,13 @@ namespace ServerModels
         ~FUserAndroidDeviceInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserAppleIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -508,6 +725,14 @@ namespace ServerModels
             AppleSubjectId(src.AppleSubjectId)
             {}
 
+        FUserAppleIdInfo(FUserAppleIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            AppleSubjectId(MoveTemp(src.AppleSubjectId))
+            {}
+
+        FUserAppleIdInfo& operator=(const FUserAppleIdInfo& src) = default;
+        FUserAppleIdInfo& operator=(FUserAppleIdInfo&& src) = default;
+
         FUserAppleIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserAppleIdInfo()
         {
             readFromValue(obj);
@@ -516,7 +741,13 @@ namespace ServerModels
         ~FUserAppleIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserCustomIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -534,6 +765,14 @@ namespace ServerModels
             CustomId(src.CustomId)
             {}
 
+        FUserCustomIdInfo(FUserCustomIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            CustomId(MoveTemp(src.CustomId))
+            {}
+
+        FUserCustomIdInfo& operator=(const FUserCustomIdInfo& src) = default;
+        FUserCustomIdInfo& operator=(FUserCustomIdInfo&& src) = default;
+
         FUserCustomIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserCustomIdInfo()
         {
             readFromValue(obj);
@@ -542,7 +781,13 @@ namespace ServerModels
         ~FUserCustomIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserFacebookInfo : public PlayFab::FPlayFabCppBaseModel
@@ -565,6 +810,15 @@ namespace ServerModels
             FullName(src.FullName)
             {}
 
+        FUserFacebookInfo(FUserFacebookInfo&& src) :
+            FPlayFabCppBaseModel(),
+            FacebookId(MoveTemp(src.FacebookId)),
+            FullName(MoveTemp(src.FullName))
+            {}
+
+        FUserFacebookInfo& operator=(const FUserFacebookInfo& src) = default;
+        FUserFacebookInfo& operator=(FUserFacebookInfo&& src) = default;
+
         FUserFacebookInfo(const TSharedPtr<FJsonObject>& obj) : FUserFacebookInfo()
         {
             readFromValue(obj);
@@ -573,7 +827,13 @@ namespace ServerModels
         ~FUserFacebookInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserFacebookInstantGamesIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -591,6 +851,14 @@ namespace ServerModels
             FacebookInstantGamesId(src.FacebookInstantGamesId)
             {}
 
+        FUserFacebookInstantGamesIdInfo(FUserFacebookInstantGamesIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            FacebookInstantGamesId(MoveTemp(src.FacebookInstantGamesId))
+            {}
+
+        FUserFacebookInstantGamesIdInfo& operator=(const FUserFacebookInstantGamesIdInfo& src) = default;
+        FUserFacebookInstantGamesIdInfo& operator=(FUserFacebookInstantGamesIdInfo&& src) = default;
+
         FUserFacebookInstantGamesIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserFacebookInstantGamesIdInfo()
         {
             readFromValue(obj);
@@ -599,7 +867,13 @@ namespace ServerModels
         ~FUserFacebookInstantGamesIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserGameCenterInfo : public PlayFab::FPlayFabCppBaseModel
@@ -617,6 +891,14 @@ namespace ServerModels
             GameCenterId(src.GameCenterId)
             {}
 
+        FUserGameCenterInfo(FUserGameCenterInfo&& src) :
+            FPlayFabCppBaseModel(),
+            GameCenterId(MoveTemp(src.GameCenterId))
+            {}
+
+        FUserGameCenterInfo& operator=(const FUserGameCenterInfo& src) = default;
+        FUserGameCenterInfo& operator=(FUserGameCenterInfo&& src) = default;
+
         FUserGameCenterInfo(const TSharedPtr<FJsonObject>& obj) : FUserGameCenterInfo()
         {
             readFromValue(obj);
@@ -625,7 +907,13 @@ namespace ServerModels
         ~FUserGameCenterInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserGoogleInfo : public PlayFab::FPlayFabCppBaseModel
@@ -663,6 +951,18 @@ namespace ServerModels
             GoogleName(src.GoogleName)
             {}
 
+        FUserGoogleInfo(FUserGoogleInfo&& src) :
+            FPlayFabCppBaseModel(),
+            GoogleEmail(MoveTemp(src.GoogleEmail)),
+            GoogleGender(MoveTemp(src.GoogleGender)),
+            GoogleId(MoveTemp(src.GoogleId)),
+            GoogleLocale(MoveTemp(src.GoogleLocale)),
+            GoogleName(MoveTemp(src.GoogleName))
+            {}
+
+        FUserGoogleInfo& operator=(const FUserGoogleInfo& src) = default;
+        FUserGoogleInfo& operator=(FUserGoogleInfo&& src) = default;
+
         FUserGoogleInfo(const TSharedPtr<FJsonObject>& obj) : FUserGoogleInfo()
         {
             readFromValue(obj);
@@ -671,7 +971,13 @@ namespace ServerModels
         ~FUserGoogleInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserIosDeviceInfo : public PlayFab::FPlayFabCppBaseModel
@@ -689,6 +995,14 @@ namespace ServerModels
             IosDeviceId(src.IosDeviceId)
             {}
 
+        FUserIosDeviceInfo(FUserIosDeviceInfo&& src) :
+            FPlayFabCppBaseModel(),
+            IosDeviceId(MoveTemp(src.IosDeviceId))
+            {}
+
+        FUserIosDeviceInfo& operator=(const FUserIosDeviceInfo& src) = default;
+        FUserIosDeviceInfo& operator=(FUserIosDeviceInfo&& src) = default;
+
         FUserIosDeviceInfo(const TSharedPtr<FJsonObject>& obj) : FUserIosDeviceInfo()
         {
             readFromValue(obj);
@@ -697,7 +1011,13 @@ namespace ServerModels
         ~FUserIosDeviceInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserKongregateInfo : public PlayFab::FPlayFabCppBaseModel
@@ -720,6 +1040,15 @@ namespace ServerModels
             KongregateName(src.KongregateName)
             {}
 
+        FUserKongregateInfo(FUserKongregateInfo&& src) :
+            FPlayFabCppBaseModel(),
+            KongregateId(MoveTemp(src.KongregateId)),
+            KongregateName(MoveTemp(src.KongregateName))
+            {}
+
+        FUserKongregateInfo& operator=(const FUserKongregateInfo& src) = default;
+        FUserKongregateInfo& operator=(FUserKongregateInfo&& src) = default;
+
         FUserKongregateInfo(const TSharedPtr<FJsonObject>& obj) : FUserKongregateInfo()
         {
             readFromValue(obj);
@@ -728,7 +1057,13 @@ namespace ServerModels
         ~FUserKongregateInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserNintendoSwitchAccountIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -746,6 +1081,14 @@ namespace ServerModels
             NintendoSwitchAccountSubjectId(src.NintendoSwitchAccountSubjectId)
             {}
 
+        FUserNintendoSwitchAccountIdInfo(FUserNintendoSwitchAccountIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            NintendoSwitchAccountSubjectId(MoveTemp(src.NintendoSwitchAccountSubjectId))
+            {}
+
+        FUserNintendoSwitchAccountIdInfo& operator=(const FUserNintendoSwitchAccountIdInfo& src) = default;
+        FUserNintendoSwitchAccountIdInfo& operator=(FUserNintendoSwitchAccountIdInfo&& src) = default;
+
         FUserNintendoSwitchAccountIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserNintendoSwitchAccountIdInfo()
         {
             readFromValue(obj);
@@ -754,7 +1097,13 @@ namespace ServerModels
         ~FUserNintendoSwitchAccountIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserNintendoSwitchDeviceIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -772,6 +1121,14 @@ namespace ServerModels
             NintendoSwitchDeviceId(src.NintendoSwitchDeviceId)
             {}
 
+        FUserNintendoSwitchDeviceIdInfo(FUserNintendoSwitchDeviceIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            NintendoSwitchDeviceId(MoveTemp(src.NintendoSwitchDeviceId))
+            {}
+
+        FUserNintendoSwitchDeviceIdInfo& operator=(const FUserNintendoSwitchDeviceIdInfo& src) = default;
+        FUserNintendoSwitchDeviceIdInfo& operator=(FUserNintendoSwitchDeviceIdInfo&& src) = default;
+
         FUserNintendoSwitchDeviceIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserNintendoSwitchDeviceIdInfo()
         {
             readFromValue(obj);
@@ -780,7 +1137,13 @@ namespace ServerModels
         ~FUserNintendoSwitchDeviceIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserOpenIdInfo : public PlayFab::FPlayFabCppBaseModel
@@ -808,6 +1171,16 @@ namespace ServerModels
             Subject(src.Subject)
             {}
 
+        FUserOpenIdInfo(FUserOpenIdInfo&& src) :
+            FPlayFabCppBaseModel(),
+            ConnectionId(MoveTemp(src.ConnectionId)),
+            Issuer(MoveTemp(src.Issuer)),
+            Subject(MoveTemp(src.Subject))
+            {}
+
+        FUserOpenIdInfo& operator=(const FUserOpenIdInfo& src) = default;
+        FUserOpenIdInfo& operator=(FUserOpenIdInfo&& src) = default;
+
         FUserOpenIdInfo(const TSharedPtr<FJsonObject>& obj) : FUserOpenIdInfo()
         {
             readFromValue(obj);
@@ -816,7 +1189,13 @@ namespace ServerModels
         ~FUserOpenIdInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserPrivateAccountInfo : public PlayFab::FPlayFabCppBaseModel
@@ -834,6 +1213,14 @@ namespace ServerModels
             Email(src.Email)
             {}
 
+        FUserPrivateAccountInfo(FUserPrivateAccountInfo&& src) :
+            FPlayFabCppBaseModel(),
+            Email(MoveTemp(src.Email))
+            {}
+
+        FUserPrivateAccountInfo& operator=(const FUserPrivateAccountInfo& src) = default;
+        FUserPrivateAccountInfo& operator=(FUserPrivateAccountInfo&& src) = default;
+
         FUserPrivateAccountInfo(const TSharedPtr<FJsonObject>& obj) : FUserPrivateAccountInfo()
         {
             readFromValue(obj);
@@ -842,7 +1229,13 @@ namespace ServerModels
         ~FUserPrivateAccountInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserPsnInfo : public PlayFab::FPlayFabCppBaseModel
@@ -865,6 +1258,15 @@ namespace ServerModels
             PsnOnlineId(src.PsnOnlineId)
             {}
 
+        FUserPsnInfo(FUserPsnInfo&& src) :
+            FPlayFabCppBaseModel(),
+            PsnAccountId(MoveTemp(src.PsnAccountId)),
+            PsnOnlineId(MoveTemp(src.PsnOnlineId))
+            {}
+
+        FUserPsnInfo& operator=(const FUserPsnInfo& src) = default;
+        FUserPsnInfo& operator=(FUserPsnInfo&& src) = default;
+
         FUserPsnInfo(const TSharedPtr<FJsonObject>& obj) : FUserPsnInfo()
         {
             readFromValue(obj);
@@ -873,7 +1275,13 @@ namespace ServerModels
         ~FUserPsnInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum TitleActivationStatus
@@ -886,6 +1294,7 @@ namespace ServerModels
     };
 
     PLAYFABCPP_API void writeTitleActivationStatusEnumJSON(TitleActivationStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeTitleActivationStatusEnumJSON(TitleActivationStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API TitleActivationStatus readTitleActivationStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API TitleActivationStatus readTitleActivationStatusFromValue(const FString& value);
 
@@ -1056,6 +1465,7 @@ namespace ServerModels
     };
 
     PLAYFABCPP_API void writeCurrencyEnumJSON(Currency enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeCurrencyEnumJSON(Currency enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API Currency readCurrencyFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API Currency readCurrencyFromValue(const FString& value);
 
@@ -1094,6 +1504,18 @@ namespace ServerModels
             SteamName(src.SteamName)
             {}
 
+        FUserSteamInfo(FUserSteamInfo&& src) :
+            FPlayFabCppBaseModel(),
+            SteamActivationStatus(MoveTemp(src.SteamActivationStatus)),
+            SteamCountry(MoveTemp(src.SteamCountry)),
+            SteamCurrency(MoveTemp(src.SteamCurrency)),
+            SteamId(MoveTemp(src.SteamId)),
+            SteamName(MoveTemp(src.SteamName))
+            {}
+
+        FUserSteamInfo& operator=(const FUserSteamInfo& src) = default;
+        FUserSteamInfo& operator=(FUserSteamInfo&& src) = default;
+
         FUserSteamInfo(const TSharedPtr<FJsonObject>& obj) : FUserSteamInfo()
         {
             readFromValue(obj);
@@ -1102,7 +1524,13 @@ namespace ServerModels
         ~FUserSteamInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum UserOrigination
@@ -1134,6 +1562,7 @@ namespace ServerModels
     };
 
     PLAYFABCPP_API void writeUserOriginationEnumJSON(UserOrigination enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeUserOriginationEnumJSON(UserOrigination enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API UserOrigination readUserOriginationFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API UserOrigination readUserOriginationFromValue(const FString& value);
 
@@ -1157,6 +1586,15 @@ namespace ServerModels
             Type(src.Type)
             {}
 
+        FEntityKey(FEntityKey&& src) :
+            FPlayFabCppBaseModel(),
+            Id(MoveTemp(src.Id)),
+            Type(MoveTemp(src.Type))
+            {}
+
+        FEntityKey& operator=(const FEntityKey& src) = default;
+        FEntityKey& operator=(FEntityKey&& src) = default;
+
         FEntityKey(const TSharedPtr<FJsonObject>& obj) : FEntityKey()
         {
             readFromValue(obj);
@@ -1165,7 +1603,13 @@ namespace ServerModels
         ~FEntityKey();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserTitleInfo : public PlayFab::FPlayFabCppBaseModel
@@ -1221,9 +1665,24 @@ namespace ServerModels
             isBanned(src.isBanned),
             LastLogin(src.LastLogin),
             Origination(src.Origination),
-            TitlePlayerAccount(src.TitlePlayerAccount.IsValid() ? MakeShareable(new FEntityKey(*src.TitlePlayerAccount)) : nullptr)
+            TitlePlayerAccount(src.TitlePlayerAccount.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.TitlePlayerAccount)) : nullptr)
+            {}
+
+        FUserTitleInfo(FUserTitleInfo&& src) :
+            FPlayFabCppBaseModel(),
+            AvatarUrl(MoveTemp(src.AvatarUrl)),
+            Created(MoveTemp(src.Created)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            FirstLogin(MoveTemp(src.FirstLogin)),
+            isBanned(MoveTemp(src.isBanned)),
+            LastLogin(MoveTemp(src.LastLogin)),
+            Origination(MoveTemp(src.Origination)),
+            TitlePlayerAccount(MoveTemp(src.TitlePlayerAccount))
             {}
 
+        FUserTitleInfo& operator=(const FUserTitleInfo& src) = default;
+        FUserTitleInfo& operator=(FUserTitleInfo&& src) = default;
+
         FUserTitleInfo(const TSharedPtr<FJsonObject>& obj) : FUserTitleInfo()
         {
             readFromValue(obj);
@@ -1232,7 +1691,13 @@ namespace ServerModels
         ~FUserTitleInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserTwitchInfo : public PlayFab::FPlayFabCppBaseModel
@@ -1255,6 +1720,15 @@ namespace ServerModels
             TwitchUserName(src.TwitchUserName)
             {}
 
+        FUserTwitchInfo(FUserTwitchInfo&& src) :
+            FPlayFabCppBaseModel(),
+            TwitchId(MoveTemp(src.TwitchId)),
+            TwitchUserName(MoveTemp(src.TwitchUserName))
+            {}
+
+        FUserTwitchInfo& operator=(const FUserTwitchInfo& src) = default;
+        FUserTwitchInfo& operator=(FUserTwitchInfo&& src) = default;
+
         FUserTwitchInfo(const TSharedPtr<FJsonObject>& obj) : FUserTwitchInfo()
         {
             readFromValue(obj);
@@ -1263,7 +1737,13 @@ namespace ServerModels
         ~FUserTwitchInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserWindowsHelloInfo : public PlayFab::FPlayFabCppBaseModel
@@ -1286,6 +1766,15 @@ namespace ServerModels
             WindowsHelloPublicKeyHash(src.WindowsHelloPublicKeyHash)
             {}
 
+        FUserWindowsHelloInfo(FUserWindowsHelloInfo&& src) :
+            FPlayFabCppBaseModel(),
+            WindowsHelloDeviceName(MoveTemp(src.WindowsHelloDeviceName)),
+            WindowsHelloPublicKeyHash(MoveTemp(src.WindowsHelloPublicKeyHash))
+            {}
+
+        FUserWindowsHelloInfo& operator=(const FUserWindowsHelloInfo& src) = default;
+        FUserWindowsHelloInfo& operator=(FUserWindowsHelloInfo&& src) = default;
+
         FUserWindowsHelloInfo(const TSharedPtr<FJsonObject>& obj) : FUserWindowsHelloInfo()
         {
             readFromValue(obj);
@@ -1294,7 +1783,13 @@ namespace ServerModels
         ~FUserWindowsHelloInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserXboxInfo : public PlayFab::FPlayFabCppBaseModel
@@ -1312,6 +1807,14 @@ namespace ServerModels
             XboxUserId(src.XboxUserId)
             {}
 
+        FUserXboxInfo(FUserXboxInfo&& src) :
+            FPlayFabCppBaseModel(),
+            XboxUserId(MoveTemp(src.XboxUserId))
+            {}
+
+        FUserXboxInfo& operator=(const FUserXboxInfo& src) = default;
+        FUserXboxInfo& operator=(FUserXboxInfo&& src) = default;
+
         FUserXboxInfo(const TSharedPtr<FJsonObject>& obj) : FUserXboxInfo()
         {
             readFromValue(obj);
@@ -1320,7 +1823,13 @@ namespace ServerModels
         ~FUserXboxInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserAccountInfo : public PlayFab::FPlayFabCppBaseModel
@@ -1418,30 +1927,59 @@ namespace ServerModels
 
         FUserAccountInfo(const FUserAccountInfo& src) :
             FPlayFabCppBaseModel(),
-            AndroidDeviceInfo(src.AndroidDeviceInfo.IsValid() ? MakeShareable(new FUserAndroidDeviceInfo(*src.AndroidDeviceInfo)) : nullptr),
-            AppleAccountInfo(src.AppleAccountInfo.IsValid() ? MakeShareable(new FUserAppleIdInfo(*src.AppleAccountInfo)) : nullptr),
+            AndroidDeviceInfo(src.AndroidDeviceInfo.IsValid() ? TSharedPtr<FUserAndroidDeviceInfo>(MakeShared<FUserAndroidDeviceInfo>(*src.AndroidDeviceInfo)) : nullptr),
+            AppleAccountInfo(src.AppleAccountInfo.IsValid() ? TSharedPtr<FUserAppleIdInfo>(MakeShared<FUserAppleIdInfo>(*src.AppleAccountInfo)) : nullptr),
             Created(src.Created),
-            CustomIdInfo(src.CustomIdInfo.IsValid() ? MakeShareable(new FUserCustomIdInfo(*src.CustomIdInfo)) : nullptr),
-            FacebookInfo(src.FacebookInfo.IsValid() ? MakeShareable(new FUserFacebookInfo(*src.FacebookInfo)) : nullptr),
-            FacebookInstantGamesIdInfo(src.FacebookInstantGamesIdInfo.IsValid() ? MakeShareable(new FUserFacebookInstantGamesIdInfo(*src.FacebookInstantGamesIdInfo)) : nullptr),
-            GameCenterInfo(src.GameCenterInfo.IsValid() ? MakeShareable(new FUserGameCenterInfo(*src.GameCenterInfo)) : nullptr),
-            GoogleInfo(src.GoogleInfo.IsValid() ? MakeShareable(new FUserGoogleInfo(*src.GoogleInfo)) : nullptr),
-            IosDeviceInfo(src.IosDeviceInfo.IsValid() ? MakeShareable(new FUserIosDeviceInfo(*src.IosDeviceInfo)) : nullptr),
-            KongregateInfo(src.KongregateInfo.IsValid() ? MakeShareable(new FUserKongregateInfo(*src.KongregateInfo)) : nullptr),
-            NintendoSwitchAccountInfo(src.NintendoSwitchAccountInfo.IsValid() ? MakeShareable(new FUserNintendoSwitchAccountIdInfo(*src.NintendoSwitchAccountInfo)) : nullptr),
-            NintendoSwitchDeviceIdInfo(src.NintendoSwitchDeviceIdInfo.IsValid() ? MakeShareable(new FUserNintendoSwitchDeviceIdInfo(*src.NintendoSwitchDeviceIdInfo)) : nullptr),
+            CustomIdInfo(src.CustomIdInfo.IsValid() ? TSharedPtr<FUserCustomIdInfo>(MakeShared<FUserCustomIdInfo>(*src.CustomIdInfo)) : nullptr),
+            FacebookInfo(src.FacebookInfo.IsValid() ? TSharedPtr<FUserFacebookInfo>(MakeShared<FUserFacebookInfo>(*src.FacebookInfo)) : nullptr),
+            FacebookInstantGamesIdInfo(src.FacebookInstantGamesIdInfo.IsValid() ? TSharedPtr<FUserFacebookInstantGamesIdInfo>(MakeShared<FUserFacebookInstantGamesIdInfo>(*src.FacebookInstantGamesIdInfo)) : nullptr),
+            GameCenterInfo(src.GameCenterInfo.IsValid() ? TSharedPtr<FUserGameCenterInfo>(MakeShared<FUserGameCenterInfo>(*src.GameCenterInfo)) : nullptr),
+            GoogleInfo(src.GoogleInfo.IsValid() ? TSharedPtr<FUserGoogleInfo>(MakeShared<FUserGoogleInfo>(*src.GoogleInfo)) : nullptr),
+            IosDeviceInfo(src.IosDeviceInfo.IsValid() ? TSharedPtr<FUserIosDeviceInfo>(MakeShared<FUserIosDeviceInfo>(*src.IosDeviceInfo)) : nullptr),
+            KongregateInfo(src.KongregateInfo.IsValid() ? TSharedPtr<FUserKongregateInfo>(MakeShared<FUserKongregateInfo>(*src.KongregateInfo)) : nullptr),
+            NintendoSwitchAccountInfo(src.NintendoSwitchAccountInfo.IsValid() ? TSharedPtr<FUserNintendoSwitchAccountIdInfo>(MakeShared<FUserNintendoSwitchAccountIdInfo>(*src.NintendoSwitchAccountInfo)) : nullptr),
+            NintendoSwitchDeviceIdInfo(src.NintendoSwitchDeviceIdInfo.IsValid() ? TSharedPtr<FUserNintendoSwitchDeviceIdInfo>(MakeShared<FUserNintendoSwitchDeviceIdInfo>(*src.NintendoSwitchDeviceIdInfo)) : nullptr),
             OpenIdInfo(src.OpenIdInfo),
             PlayFabId(src.PlayFabId),
-            PrivateInfo(src.PrivateInfo.IsValid() ? MakeShareable(new FUserPrivateAccountInfo(*src.PrivateInfo)) : nullptr),
-            PsnInfo(src.PsnInfo.IsValid() ? MakeShareable(new FUserPsnInfo(*src.PsnInfo)) : nullptr),
-            SteamInfo(src.SteamInfo.IsValid() ? MakeShareable(new FUserSteamInfo(*src.SteamInfo)) : nullptr),
-            TitleInfo(src.TitleInfo.IsValid() ? MakeShareable(new FUserTitleInfo(*src.TitleInfo)) : nullptr),
-            TwitchInfo(src.TwitchInfo.IsValid() ? MakeShareable(new FUserTwitchInfo(*src.TwitchInfo)) : nullptr),
+            PrivateInfo(src.PrivateInfo.IsValid() ? TSharedPtr<FUserPrivateAccountInfo>(MakeShared<FUserPrivateAccountInfo>(*src.PrivateInfo)) : nullptr),
+            PsnInfo(src.PsnInfo.IsValid() ? TSharedPtr<FUserPsnInfo>(MakeShared<FUserPsnInfo>(*src.PsnInfo)) : nullptr),
+            SteamInfo(src.SteamInfo.IsValid() ? TSharedPtr<FUserSteamInfo>(MakeShared<FUserSteamInfo>(*src.SteamInfo)) : nullptr),
+            TitleInfo(src.TitleInfo.IsValid() ? TSharedPtr<FUserTitleInfo>(MakeShared<FUserTitleInfo>(*src.TitleInfo)) : nullptr),
+            TwitchInfo(src.TwitchInfo.IsValid() ? TSharedPtr<FUserTwitchInfo>(MakeShared<FUserTwitchInfo>(*src.TwitchInfo)) : nullptr),
             Username(src.Username),
-            WindowsHelloInfo(src.WindowsHelloInfo.IsValid() ? MakeShareable(new FUserWindowsHelloInfo(*src.WindowsHelloInfo)) : nullptr),
-            XboxInfo(src.XboxInfo.IsValid() ? MakeShareable(new FUserXboxInfo(*src.XboxInfo)) : nullptr)
+            WindowsHelloInfo(src.WindowsHelloInfo.IsValid() ? TSharedPtr<FUserWindowsHelloInfo>(MakeShared<FUserWindowsHelloInfo>(*src.WindowsHelloInfo)) : nullptr),
+            XboxInfo(src.XboxInfo.IsValid() ? TSharedPtr<FUserXboxInfo>(MakeShared<FUserXboxInfo>(*src.XboxInfo)) : nullptr)
             {}
 
+        FUserAccountInfo(FUserAccountInfo&& src) :
+            FPlayFabCppBaseModel(),
+            AndroidDeviceInfo(MoveTemp(src.AndroidDeviceInfo)),
+            AppleAccountInfo(MoveTemp(src.AppleAccountInfo)),
+            Created(MoveTemp(src.Created)),
+            CustomIdInfo(MoveTemp(src.CustomIdInfo)),
+            FacebookInfo(MoveTemp(src.FacebookInfo)),
+            FacebookInstantGamesIdInfo(MoveTemp(src.FacebookInstantGamesIdInfo)),
+            GameCenterInfo(MoveTemp(src.GameCenterInfo)),
+            GoogleInfo(MoveTemp(src.GoogleInfo)),
+            IosDeviceInfo(MoveTemp(src.IosDeviceInfo)),
+            KongregateInfo(MoveTemp(src.KongregateInfo)),
+            NintendoSwitchAccountInfo(MoveTemp(src.NintendoSwitchAccountInfo)),
+            NintendoSwitchDeviceIdInfo(MoveTemp(src.NintendoSwitchDeviceIdInfo)),
+            OpenIdInfo(MoveTemp(src.OpenIdInfo)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            PrivateInfo(MoveTemp(src.PrivateInfo)),
+            PsnInfo(MoveTemp(src.PsnInfo)),
+            SteamInfo(MoveTemp(src.SteamInfo)),
+            TitleInfo(MoveTemp(src.TitleInfo)),
+            TwitchInfo(MoveTemp(src.TwitchInfo)),
+            Username(MoveTemp(src.Username)),
+            WindowsHelloInfo(MoveTemp(src.WindowsHelloInfo)),
+            XboxInfo(MoveTemp(src.XboxInfo))
+            {}
+
+        FUserAccountInfo& operator=(const FUserAccountInfo& src) = default;
+        FUserAccountInfo& operator=(FUserAccountInfo&& src) = default;
+
         FUserAccountInfo(const TSharedPtr<FJsonObject>& obj) : FUserAccountInfo()
         {
             readFromValue(obj);
@@ -1450,7 +1988,13 @@ namespace ServerModels
         ~FUserAccountInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAuthenticateSessionTicketResult : public PlayFab::FPlayFabCppResultCommon
@@ -1470,9 +2014,18 @@ namespace ServerModels
         FAuthenticateSessionTicketResult(const FAuthenticateSessionTicketResult& src) :
             FPlayFabCppResultCommon(),
             IsSessionTicketExpired(src.IsSessionTicketExpired),
-            UserInfo(src.UserInfo.IsValid() ? MakeShareable(new FUserAccountInfo(*src.UserInfo)) : nullptr)
+            UserInfo(src.UserInfo.IsValid() ? TSharedPtr<FUserAccountInfo>(MakeShared<FUserAccountInfo>(*src.UserInfo)) : nullptr)
             {}
 
+        FAuthenticateSessionTicketResult(FAuthenticateSessionTicketResult&& src) :
+            FPlayFabCppResultCommon(),
+            IsSessionTicketExpired(MoveTemp(src.IsSessionTicketExpired)),
+            UserInfo(MoveTemp(src.UserInfo))
+            {}
+
+        FAuthenticateSessionTicketResult& operator=(const FAuthenticateSessionTicketResult& src) = default;
+        FAuthenticateSessionTicketResult& operator=(FAuthenticateSessionTicketResult&& src) = default;
+
         FAuthenticateSessionTicketResult(const TSharedPtr<FJsonObject>& obj) : FAuthenticateSessionTicketResult()
         {
             readFromValue(obj);
@@ -1481,7 +2034,13 @@ namespace ServerModels
         ~FAuthenticateSessionTicketResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAwardSteamAchievementItem : public PlayFab::FPlayFabCppBaseModel
@@ -1509,6 +2068,16 @@ namespace ServerModels
             Result(src.Result)
             {}
 
+        FAwardSteamAchievementItem(FAwardSteamAchievementItem&& src) :
+            FPlayFabCppBaseModel(),
+            AchievementName(MoveTemp(src.AchievementName)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Result(MoveTemp(src.Result))
+            {}
+
+        FAwardSteamAchievementItem& operator=(const FAwardSteamAchievementItem& src) = default;
+        FAwardSteamAchievementItem& operator=(FAwardSteamAchievementItem&& src) = default;
+
         FAwardSteamAchievementItem(const TSharedPtr<FJsonObject>& obj) : FAwardSteamAchievementItem()
         {
             readFromValue(obj);
@@ -1517,7 +2086,13 @@ namespace ServerModels
         ~FAwardSteamAchievementItem();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAwardSteamAchievementRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1534,6 +2109,14 @@ namespace ServerModels
             Achievements(src.Achievements)
             {}
 
+        FAwardSteamAchievementRequest(FAwardSteamAchievementRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Achievements(MoveTemp(src.Achievements))
+            {}
+
+        FAwardSteamAchievementRequest& operator=(const FAwardSteamAchievementRequest& src) = default;
+        FAwardSteamAchievementRequest& operator=(FAwardSteamAchievementRequest&& src) = default;
+
         FAwardSteamAchievementRequest(const TSharedPtr<FJsonObject>& obj) : FAwardSteamAchievementRequest()
         {
             readFromValue(obj);
@@ -1542,7 +2125,13 @@ namespace ServerModels
         ~FAwardSteamAchievementRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FAwardSteamAchievementResult : public PlayFab::FPlayFabCppResultCommon
@@ -1559,6 +2148,14 @@ namespace ServerModels
             AchievementResults(src.AchievementResults)
             {}
 
+        FAwardSteamAchievementResult(FAwardSteamAchievementResult&& src) :
+            FPlayFabCppResultCommon(),
+            AchievementResults(MoveTemp(src.AchievementResults))
+            {}
+
+        FAwardSteamAchievementResult& operator=(const FAwardSteamAchievementResult& src) = default;
+        FAwardSteamAchievementResult& operator=(FAwardSteamAchievementResult&& src) = default;
+
         FAwardSteamAchievementResult(const TSharedPtr<FJsonObject>& obj) : FAwardSteamAchievementResult()
         {
             readFromValue(obj);
@@ -1567,7 +2164,13 @@ namespace ServerModels
         ~FAwardSteamAchievementResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FBanInfo : public PlayFab::FPlayFabCppBaseModel
@@ -1620,6 +2223,21 @@ namespace ServerModels
             Reason(src.Reason)
             {}
 
+        FBanInfo(FBanInfo&& src) :
+            FPlayFabCppBaseModel(),
+            Active(MoveTemp(src.Active)),
+            BanId(MoveTemp(src.BanId)),
+            Created(MoveTemp(src.Created)),
+            Expires(MoveTemp(src.Expires)),
+            IPAddress(MoveTemp(src.IPAddress)),
+            MACAddress(MoveTemp(src.MACAddress)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Reason(MoveTemp(src.Reason))
+            {}
+
+        FBanInfo& operator=(const FBanInfo& src) = default;
+        FBanInfo& operator=(FBanInfo&& src) = default;
+
         FBanInfo(const TSharedPtr<FJsonObject>& obj) : FBanInfo()
         {
             readFromValue(obj);
@@ -1628,7 +2246,13 @@ namespace ServerModels
         ~FBanInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FBanRequest : public PlayFab::FPlayFabCppBaseModel
@@ -1666,6 +2290,18 @@ namespace ServerModels
             Reason(src.Reason)
             {}
 
+        FBanRequest(FBanRequest&& src) :
+            FPlayFabCppBaseModel(),
+            DurationInHours(MoveTemp(src.DurationInHours)),
+            IPAddress(MoveTemp(src.IPAddress)),
+            MACAddress(MoveTemp(src.MACAddress)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Reason(MoveTemp(src.Reason))
+            {}
+
+        FBanRequest& operator=(const FBanRequest& src) = default;
+        FBanRequest& operator=(FBanRequest&& src) = default;
+
         FBanRequest(const TSharedPtr<FJsonObject>& obj) : FBanRequest()
         {
             readFromValue(obj);
@@ -1674,7 +2310,13 @@ namespace ServerModels
         ~FBanRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FBanUsersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -1695,6 +2337,15 @@ namespace ServerModels
             CustomTags(src.CustomTags)
             {}
 
+        FBanUsersRequest(FBanUsersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Bans(MoveTemp(src.Bans)),
+            CustomTags(MoveTemp(src.CustomTags))
+            {}
+
+        FBanUsersRequest& operator=(const FBanUsersRequest& src) = default;
+        FBanUsersRequest& operator=(FBanUsersRequest&& src) = default;
+
         FBanUsersRequest(const TSharedPtr<FJsonObject>& obj) : FBanUsersRequest()
         {
             readFromValue(obj);
@@ -1703,7 +2354,13 @@ namespace ServerModels
         ~FBanUsersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FBanUsersResult : public PlayFab::FPlayFabCppResultCommon
@@ -1720,6 +2377,14 @@ namespace ServerModels
             BanData(src.BanData)
             {}
 
+        FBanUsersResult(FBanUsersResult&& src) :
+            FPlayFabCppResultCommon(),
+            BanData(MoveTemp(src.BanData))
+            {}
+
+        FBanUsersResult& operator=(const FBanUsersResult& src) = default;
+        FBanUsersResult& operator=(FBanUsersResult&& src) = default;
+
         FBanUsersResult(const TSharedPtr<FJsonObject>& obj) : FBanUsersResult()
         {
             readFromValue(obj);
@@ -1728,7 +2393,13 @@ namespace ServerModels
         ~FBanUsersResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCatalogItemBundleInfo : public PlayFab::FPlayFabCppBaseModel
@@ -1756,6 +2427,16 @@ namespace ServerModels
             BundledVirtualCurrencies(src.BundledVirtualCurrencies)
             {}
 
+        FCatalogItemBundleInfo(FCatalogItemBundleInfo&& src) :
+            FPlayFabCppBaseModel(),
+            BundledItems(MoveTemp(src.BundledItems)),
+            BundledResultTables(MoveTemp(src.BundledResultTables)),
+            BundledVirtualCurrencies(MoveTemp(src.BundledVirtualCurrencies))
+            {}
+
+        FCatalogItemBundleInfo& operator=(const FCatalogItemBundleInfo& src) = default;
+        FCatalogItemBundleInfo& operator=(FCatalogItemBundleInfo&& src) = default;
+
         FCatalogItemBundleInfo(const TSharedPtr<FJsonObject>& obj) : FCatalogItemBundleInfo()
         {
             readFromValue(obj);
@@ -1764,7 +2445,13 @@ namespace ServerModels
         ~FCatalogItemBundleInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCatalogItemConsumableInfo : public PlayFab::FPlayFabCppBaseModel
@@ -1799,6 +2486,16 @@ namespace ServerModels
             UsagePeriodGroup(src.UsagePeriodGroup)
             {}
 
+        FCatalogItemConsumableInfo(FCatalogItemConsumableInfo&& src) :
+            FPlayFabCppBaseModel(),
+            UsageCount(MoveTemp(src.UsageCount)),
+            UsagePeriod(MoveTemp(src.UsagePeriod)),
+            UsagePeriodGroup(MoveTemp(src.UsagePeriodGroup))
+            {}
+
+        FCatalogItemConsumableInfo& operator=(const FCatalogItemConsumableInfo& src) = default;
+        FCatalogItemConsumableInfo& operator=(FCatalogItemConsumableInfo&& src) = default;
+
         FCatalogItemConsumableInfo(const TSharedPtr<FJsonObject>& obj) : FCatalogItemConsumableInfo()
         {
             readFromValue(obj);
@@ -1807,7 +2504,13 @@ namespace ServerModels
         ~FCatalogItemConsumableInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCatalogItemContainerInfo : public PlayFab::FPlayFabCppBaseModel
@@ -1843,6 +2546,17 @@ namespace ServerModels
             VirtualCurrencyContents(src.VirtualCurrencyContents)
             {}
 
+        FCatalogItemContainerInfo(FCatalogItemContainerInfo&& src) :
+            FPlayFabCppBaseModel(),
+            ItemContents(MoveTemp(src.ItemContents)),
+            KeyItemId(MoveTemp(src.KeyItemId)),
+            ResultTableContents(MoveTemp(src.ResultTableContents)),
+            VirtualCurrencyContents(MoveTemp(src.VirtualCurrencyContents))
+            {}
+
+        FCatalogItemContainerInfo& operator=(const FCatalogItemContainerInfo& src) = default;
+        FCatalogItemContainerInfo& operator=(FCatalogItemContainerInfo&& src) = default;
+
         FCatalogItemContainerInfo(const TSharedPtr<FJsonObject>& obj) : FCatalogItemContainerInfo()
         {
             readFromValue(obj);
@@ -1851,7 +2565,13 @@ namespace ServerModels
         ~FCatalogItemContainerInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCatalogItem : public PlayFab::FPlayFabCppBaseModel
@@ -1949,11 +2669,11 @@ namespace ServerModels
 
         FCatalogItem(const FCatalogItem& src) :
             FPlayFabCppBaseModel(),
-            Bundle(src.Bundle.IsValid() ? MakeShareable(new FCatalogItemBundleInfo(*src.Bundle)) : nullptr),
+            Bundle(src.Bundle.IsValid() ? TSharedPtr<FCatalogItemBundleInfo>(MakeShared<FCatalogItemBundleInfo>(*src.Bundle)) : nullptr),
             CanBecomeCharacter(src.CanBecomeCharacter),
             CatalogVersion(src.CatalogVersion),
-            Consumable(src.Consumable.IsValid() ? MakeShareable(new FCatalogItemConsumableInfo(*src.Consumable)) : nullptr),
-            Container(src.Container.IsValid() ? MakeShareable(new FCatalogItemContainerInfo(*src.Container)) : nullptr),
+            Consumable(src.Consumable.IsValid() ? TSharedPtr<FCatalogItemConsumableInfo>(MakeShared<FCatalogItemConsumableInfo>(*src.Consumable)) : nullptr),
+            Container(src.Container.IsValid() ? TSharedPtr<FCatalogItemContainerInfo>(MakeShared<FCatalogItemContainerInfo>(*src.Container)) : nullptr),
             CustomData(src.CustomData),
             Description(src.Description),
             DisplayName(src.DisplayName),
@@ -1969,6 +2689,31 @@ namespace ServerModels
             VirtualCurrencyPrices(src.VirtualCurrencyPrices)
             {}
 
+        FCatalogItem(FCatalogItem&& src) :
+            FPlayFabCppBaseModel(),
+            Bundle(MoveTemp(src.Bundle)),
+            CanBecomeCharacter(MoveTemp(src.CanBecomeCharacter)),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            Consumable(MoveTemp(src.Consumable)),
+            Container(MoveTemp(src.Container)),
+            CustomData(MoveTemp(src.CustomData)),
+            Description(MoveTemp(src.Description)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            InitialLimitedEditionCount(MoveTemp(src.InitialLimitedEditionCount)),
+            IsLimitedEdition(MoveTemp(src.IsLimitedEdition)),
+            IsStackable(MoveTemp(src.IsStackable)),
+            IsTradable(MoveTemp(src.IsTradable)),
+            ItemClass(MoveTemp(src.ItemClass)),
+            ItemId(MoveTemp(src.ItemId)),
+            ItemImageUrl(MoveTemp(src.ItemImageUrl)),
+            RealCurrencyPrices(MoveTemp(src.RealCurrencyPrices)),
+            Tags(MoveTemp(src.Tags)),
+            VirtualCurrencyPrices(MoveTemp(src.VirtualCurrencyPrices))
+            {}
+
+        FCatalogItem& operator=(const FCatalogItem& src) = default;
+        FCatalogItem& operator=(FCatalogItem&& src) = default;
+
         FCatalogItem(const TSharedPtr<FJsonObject>& obj) : FCatalogItem()
         {
             readFromValue(obj);
@@ -1977,7 +2722,13 @@ namespace ServerModels
         ~FCatalogItem();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FItemInstance : public PlayFab::FPlayFabCppBaseModel
@@ -2069,6 +2820,28 @@ namespace ServerModels
             UsesIncrementedBy(src.UsesIncrementedBy)
             {}
 
+        FItemInstance(FItemInstance&& src) :
+            FPlayFabCppBaseModel(),
+            Annotation(MoveTemp(src.Annotation)),
+            BundleContents(MoveTemp(src.BundleContents)),
+            BundleParent(MoveTemp(src.BundleParent)),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomData(MoveTemp(src.CustomData)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            Expiration(MoveTemp(src.Expiration)),
+            ItemClass(MoveTemp(src.ItemClass)),
+            ItemId(MoveTemp(src.ItemId)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            PurchaseDate(MoveTemp(src.PurchaseDate)),
+            RemainingUses(MoveTemp(src.RemainingUses)),
+            UnitCurrency(MoveTemp(src.UnitCurrency)),
+            UnitPrice(MoveTemp(src.UnitPrice)),
+            UsesIncrementedBy(MoveTemp(src.UsesIncrementedBy))
+            {}
+
+        FItemInstance& operator=(const FItemInstance& src) = default;
+        FItemInstance& operator=(FItemInstance&& src) = default;
+
         FItemInstance(const TSharedPtr<FJsonObject>& obj) : FItemInstance()
         {
             readFromValue(obj);
@@ -2077,7 +2850,13 @@ namespace ServerModels
         ~FItemInstance();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCharacterInventory : public PlayFab::FPlayFabCppBaseModel
@@ -2099,6 +2878,15 @@ namespace ServerModels
             Inventory(src.Inventory)
             {}
 
+        FCharacterInventory(FCharacterInventory&& src) :
+            FPlayFabCppBaseModel(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            Inventory(MoveTemp(src.Inventory))
+            {}
+
+        FCharacterInventory& operator=(const FCharacterInventory& src) = default;
+        FCharacterInventory& operator=(FCharacterInventory&& src) = default;
+
         FCharacterInventory(const TSharedPtr<FJsonObject>& obj) : FCharacterInventory()
         {
             readFromValue(obj);
@@ -2107,7 +2895,13 @@ namespace ServerModels
         ~FCharacterInventory();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCharacterLeaderboardEntry : public PlayFab::FPlayFabCppBaseModel
@@ -2155,6 +2949,20 @@ namespace ServerModels
             StatValue(src.StatValue)
             {}
 
+        FCharacterLeaderboardEntry(FCharacterLeaderboardEntry&& src) :
+            FPlayFabCppBaseModel(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CharacterName(MoveTemp(src.CharacterName)),
+            CharacterType(MoveTemp(src.CharacterType)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Position(MoveTemp(src.Position)),
+            StatValue(MoveTemp(src.StatValue))
+            {}
+
+        FCharacterLeaderboardEntry& operator=(const FCharacterLeaderboardEntry& src) = default;
+        FCharacterLeaderboardEntry& operator=(FCharacterLeaderboardEntry&& src) = default;
+
         FCharacterLeaderboardEntry(const TSharedPtr<FJsonObject>& obj) : FCharacterLeaderboardEntry()
         {
             readFromValue(obj);
@@ -2163,7 +2971,13 @@ namespace ServerModels
         ~FCharacterLeaderboardEntry();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCharacterResult : public PlayFab::FPlayFabCppBaseModel
@@ -2191,6 +3005,16 @@ namespace ServerModels
             CharacterType(src.CharacterType)
             {}
 
+        FCharacterResult(FCharacterResult&& src) :
+            FPlayFabCppBaseModel(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CharacterName(MoveTemp(src.CharacterName)),
+            CharacterType(MoveTemp(src.CharacterType))
+            {}
+
+        FCharacterResult& operator=(const FCharacterResult& src) = default;
+        FCharacterResult& operator=(FCharacterResult&& src) = default;
+
         FCharacterResult(const TSharedPtr<FJsonObject>& obj) : FCharacterResult()
         {
             readFromValue(obj);
@@ -2199,7 +3023,13 @@ namespace ServerModels
         ~FCharacterResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum CloudScriptRevisionOption
@@ -2210,6 +3040,7 @@ namespace ServerModels
     };
 
     PLAYFABCPP_API void writeCloudScriptRevisionOptionEnumJSON(CloudScriptRevisionOption enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeCloudScriptRevisionOptionEnumJSON(CloudScriptRevisionOption enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API CloudScriptRevisionOption readCloudScriptRevisionOptionFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API CloudScriptRevisionOption readCloudScriptRevisionOptionFromValue(const FString& value);
 
@@ -2247,6 +3078,18 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FConsumeItemRequest(FConsumeItemRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            ConsumeCount(MoveTemp(src.ConsumeCount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FConsumeItemRequest& operator=(const FConsumeItemRequest& src) = default;
+        FConsumeItemRequest& operator=(FConsumeItemRequest&& src) = default;
+
         FConsumeItemRequest(const TSharedPtr<FJsonObject>& obj) : FConsumeItemRequest()
         {
             readFromValue(obj);
@@ -2255,7 +3098,13 @@ namespace ServerModels
         ~FConsumeItemRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FConsumeItemResult : public PlayFab::FPlayFabCppResultCommon
@@ -2278,6 +3127,15 @@ namespace ServerModels
             RemainingUses(src.RemainingUses)
             {}
 
+        FConsumeItemResult(FConsumeItemResult&& src) :
+            FPlayFabCppResultCommon(),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            RemainingUses(MoveTemp(src.RemainingUses))
+            {}
+
+        FConsumeItemResult& operator=(const FConsumeItemResult& src) = default;
+        FConsumeItemResult& operator=(FConsumeItemResult&& src) = default;
+
         FConsumeItemResult(const TSharedPtr<FJsonObject>& obj) : FConsumeItemResult()
         {
             readFromValue(obj);
@@ -2286,7 +3144,13 @@ namespace ServerModels
         ~FConsumeItemResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum EmailVerificationStatus
@@ -2297,6 +3161,7 @@ namespace ServerModels
     };
 
     PLAYFABCPP_API void writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeEmailVerificationStatusEnumJSON(EmailVerificationStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API EmailVerificationStatus readEmailVerificationStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API EmailVerificationStatus readEmailVerificationStatusFromValue(const FString& value);
 
@@ -2325,15 +3190,31 @@ namespace ServerModels
             VerificationStatus(src.VerificationStatus)
             {}
 
-        FContactEmailInfo(const TSharedPtr<FJsonObject>& obj) : FContactEmailInfo()
-        {
+        FContactEmailInfo(FContactEmailInfo&& src) :
+            FPlayFabCppBaseModel(),
+            EmailAddress(MoveTemp(src.EmailAddress)),
+            Name(MoveTemp(src.Name)),
+            VerificationStatus(MoveTemp(src.VerificationStatus))
+            {}
+
+        FContactEmailInfo& operator=(const FContactEmailInfo& src) = default;
+        FContactEmailInfo& operator=(FContactEmailInfo&& src) = default;
+
+        FContactEmailInfo(const TSharedPtr<FJsonObject>& obj) : FContactEmailInfo()
+        {
             readFromValue(obj);
         }
 
         ~FContactEmailInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FContactEmailInfoModel : public PlayFab::FPlayFabCppBaseModel
@@ -2361,6 +3242,16 @@ namespace ServerModels
             VerificationStatus(src.VerificationStatus)
             {}
 
+        FContactEmailInfoModel(FContactEmailInfoModel&& src) :
+            FPlayFabCppBaseModel(),
+            EmailAddress(MoveTemp(src.EmailAddress)),
+            Name(MoveTemp(src.Name)),
+            VerificationStatus(MoveTemp(src.VerificationStatus))
+            {}
+
+        FContactEmailInfoModel& operator=(const FContactEmailInfoModel& src) = default;
+        FContactEmailInfoModel& operator=(FContactEmailInfoModel&& src) = default;
+
         FContactEmailInfoModel(const TSharedPtr<FJsonObject>& obj) : FContactEmailInfoModel()
         {
             readFromValue(obj);
@@ -2369,7 +3260,13 @@ namespace ServerModels
         ~FContactEmailInfoModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum ContinentCode
@@ -2384,6 +3281,7 @@ namespace ServerModels
     };
 
     PLAYFABCPP_API void writeContinentCodeEnumJSON(ContinentCode enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeContinentCodeEnumJSON(ContinentCode enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API ContinentCode readContinentCodeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API ContinentCode readContinentCodeFromValue(const FString& value);
 
@@ -2641,6 +3539,7 @@ namespace ServerModels
     };
 
     PLAYFABCPP_API void writeCountryCodeEnumJSON(CountryCode enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeCountryCodeEnumJSON(CountryCode enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API CountryCode readCountryCodeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API CountryCode readCountryCodeFromValue(const FString& value);
 
@@ -2659,6 +3558,14 @@ namespace ServerModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FCreateSharedGroupRequest(FCreateSharedGroupRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FCreateSharedGroupRequest& operator=(const FCreateSharedGroupRequest& src) = default;
+        FCreateSharedGroupRequest& operator=(FCreateSharedGroupRequest&& src) = default;
+
         FCreateSharedGroupRequest(const TSharedPtr<FJsonObject>& obj) : FCreateSharedGroupRequest()
         {
             readFromValue(obj);
@@ -2667,7 +3574,13 @@ namespace ServerModels
         ~FCreateSharedGroupRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FCreateSharedGroupResult : public PlayFab::FPlayFabCppResultCommon
@@ -2685,6 +3598,14 @@ namespace ServerModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FCreateSharedGroupResult(FCreateSharedGroupResult&& src) :
+            FPlayFabCppResultCommon(),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FCreateSharedGroupResult& operator=(const FCreateSharedGroupResult& src) = default;
+        FCreateSharedGroupResult& operator=(FCreateSharedGroupResult&& src) = default;
+
         FCreateSharedGroupResult(const TSharedPtr<FJsonObject>& obj) : FCreateSharedGroupResult()
         {
             readFromValue(obj);
@@ -2693,7 +3614,13 @@ namespace ServerModels
         ~FCreateSharedGroupResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteCharacterFromUserRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2728,6 +3655,17 @@ namespace ServerModels
             SaveCharacterInventory(src.SaveCharacterInventory)
             {}
 
+        FDeleteCharacterFromUserRequest(FDeleteCharacterFromUserRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            SaveCharacterInventory(MoveTemp(src.SaveCharacterInventory))
+            {}
+
+        FDeleteCharacterFromUserRequest& operator=(const FDeleteCharacterFromUserRequest& src) = default;
+        FDeleteCharacterFromUserRequest& operator=(FDeleteCharacterFromUserRequest&& src) = default;
+
         FDeleteCharacterFromUserRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteCharacterFromUserRequest()
         {
             readFromValue(obj);
@@ -2736,7 +3674,13 @@ namespace ServerModels
         ~FDeleteCharacterFromUserRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteCharacterFromUserResult : public PlayFab::FPlayFabCppResultCommon
@@ -2749,6 +3693,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FDeleteCharacterFromUserResult(FDeleteCharacterFromUserResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FDeleteCharacterFromUserResult& operator=(const FDeleteCharacterFromUserResult& src) = default;
+        FDeleteCharacterFromUserResult& operator=(FDeleteCharacterFromUserResult&& src) = default;
+
         FDeleteCharacterFromUserResult(const TSharedPtr<FJsonObject>& obj) : FDeleteCharacterFromUserResult()
         {
             readFromValue(obj);
@@ -2757,7 +3708,13 @@ namespace ServerModels
         ~FDeleteCharacterFromUserResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeletePlayerRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2775,6 +3732,14 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FDeletePlayerRequest(FDeletePlayerRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FDeletePlayerRequest& operator=(const FDeletePlayerRequest& src) = default;
+        FDeletePlayerRequest& operator=(FDeletePlayerRequest&& src) = default;
+
         FDeletePlayerRequest(const TSharedPtr<FJsonObject>& obj) : FDeletePlayerRequest()
         {
             readFromValue(obj);
@@ -2783,7 +3748,13 @@ namespace ServerModels
         ~FDeletePlayerRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeletePlayerResult : public PlayFab::FPlayFabCppResultCommon
@@ -2796,6 +3767,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FDeletePlayerResult(FDeletePlayerResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FDeletePlayerResult& operator=(const FDeletePlayerResult& src) = default;
+        FDeletePlayerResult& operator=(FDeletePlayerResult&& src) = default;
+
         FDeletePlayerResult(const TSharedPtr<FJsonObject>& obj) : FDeletePlayerResult()
         {
             readFromValue(obj);
@@ -2804,7 +3782,13 @@ namespace ServerModels
         ~FDeletePlayerResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeletePushNotificationTemplateRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2822,6 +3806,14 @@ namespace ServerModels
             PushNotificationTemplateId(src.PushNotificationTemplateId)
             {}
 
+        FDeletePushNotificationTemplateRequest(FDeletePushNotificationTemplateRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PushNotificationTemplateId(MoveTemp(src.PushNotificationTemplateId))
+            {}
+
+        FDeletePushNotificationTemplateRequest& operator=(const FDeletePushNotificationTemplateRequest& src) = default;
+        FDeletePushNotificationTemplateRequest& operator=(FDeletePushNotificationTemplateRequest&& src) = default;
+
         FDeletePushNotificationTemplateRequest(const TSharedPtr<FJsonObject>& obj) : FDeletePushNotificationTemplateRequest()
         {
             readFromValue(obj);
@@ -2830,7 +3822,13 @@ namespace ServerModels
         ~FDeletePushNotificationTemplateRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeletePushNotificationTemplateResult : public PlayFab::FPlayFabCppResultCommon
@@ -2843,6 +3841,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FDeletePushNotificationTemplateResult(FDeletePushNotificationTemplateResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FDeletePushNotificationTemplateResult& operator=(const FDeletePushNotificationTemplateResult& src) = default;
+        FDeletePushNotificationTemplateResult& operator=(FDeletePushNotificationTemplateResult&& src) = default;
+
         FDeletePushNotificationTemplateResult(const TSharedPtr<FJsonObject>& obj) : FDeletePushNotificationTemplateResult()
         {
             readFromValue(obj);
@@ -2851,7 +3856,13 @@ namespace ServerModels
         ~FDeletePushNotificationTemplateResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeleteSharedGroupRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2869,6 +3880,14 @@ namespace ServerModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FDeleteSharedGroupRequest(FDeleteSharedGroupRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FDeleteSharedGroupRequest& operator=(const FDeleteSharedGroupRequest& src) = default;
+        FDeleteSharedGroupRequest& operator=(FDeleteSharedGroupRequest&& src) = default;
+
         FDeleteSharedGroupRequest(const TSharedPtr<FJsonObject>& obj) : FDeleteSharedGroupRequest()
         {
             readFromValue(obj);
@@ -2877,7 +3896,13 @@ namespace ServerModels
         ~FDeleteSharedGroupRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeregisterGameRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -2899,6 +3924,15 @@ namespace ServerModels
             LobbyId(src.LobbyId)
             {}
 
+        FDeregisterGameRequest(FDeregisterGameRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            LobbyId(MoveTemp(src.LobbyId))
+            {}
+
+        FDeregisterGameRequest& operator=(const FDeregisterGameRequest& src) = default;
+        FDeregisterGameRequest& operator=(FDeregisterGameRequest&& src) = default;
+
         FDeregisterGameRequest(const TSharedPtr<FJsonObject>& obj) : FDeregisterGameRequest()
         {
             readFromValue(obj);
@@ -2907,7 +3941,13 @@ namespace ServerModels
         ~FDeregisterGameRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FDeregisterGameResponse : public PlayFab::FPlayFabCppResultCommon
@@ -2920,6 +3960,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FDeregisterGameResponse(FDeregisterGameResponse&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FDeregisterGameResponse& operator=(const FDeregisterGameResponse& src) = default;
+        FDeregisterGameResponse& operator=(FDeregisterGameResponse&& src) = default;
+
         FDeregisterGameResponse(const TSharedPtr<FJsonObject>& obj) : FDeregisterGameResponse()
         {
             readFromValue(obj);
@@ -2928,7 +3975,13 @@ namespace ServerModels
         ~FDeregisterGameResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEmptyResponse : public PlayFab::FPlayFabCppResultCommon
@@ -2941,6 +3994,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FEmptyResponse(FEmptyResponse&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FEmptyResponse& operator=(const FEmptyResponse& src) = default;
+        FEmptyResponse& operator=(FEmptyResponse&& src) = default;
+
         FEmptyResponse(const TSharedPtr<FJsonObject>& obj) : FEmptyResponse()
         {
             readFromValue(obj);
@@ -2949,7 +4009,13 @@ namespace ServerModels
         ~FEmptyResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEmptyResult : public PlayFab::FPlayFabCppResultCommon
@@ -2962,6 +4028,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FEmptyResult(FEmptyResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FEmptyResult& operator=(const FEmptyResult& src) = default;
+        FEmptyResult& operator=(FEmptyResult&& src) = default;
+
         FEmptyResult(const TSharedPtr<FJsonObject>& obj) : FEmptyResult()
         {
             readFromValue(obj);
@@ -2970,7 +4043,13 @@ namespace ServerModels
         ~FEmptyResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEntityTokenResponse : public PlayFab::FPlayFabCppBaseModel
@@ -2993,11 +4072,21 @@ namespace ServerModels
 
         FEntityTokenResponse(const FEntityTokenResponse& src) :
             FPlayFabCppBaseModel(),
-            Entity(src.Entity.IsValid() ? MakeShareable(new FEntityKey(*src.Entity)) : nullptr),
+            Entity(src.Entity.IsValid() ? TSharedPtr<FEntityKey>(MakeShared<FEntityKey>(*src.Entity)) : nullptr),
             EntityToken(src.EntityToken),
             TokenExpiration(src.TokenExpiration)
             {}
 
+        FEntityTokenResponse(FEntityTokenResponse&& src) :
+            FPlayFabCppBaseModel(),
+            Entity(MoveTemp(src.Entity)),
+            EntityToken(MoveTemp(src.EntityToken)),
+            TokenExpiration(MoveTemp(src.TokenExpiration))
+            {}
+
+        FEntityTokenResponse& operator=(const FEntityTokenResponse& src) = default;
+        FEntityTokenResponse& operator=(FEntityTokenResponse&& src) = default;
+
         FEntityTokenResponse(const TSharedPtr<FJsonObject>& obj) : FEntityTokenResponse()
         {
             readFromValue(obj);
@@ -3006,7 +4095,13 @@ namespace ServerModels
         ~FEntityTokenResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEvaluateRandomResultTableRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3032,6 +4127,15 @@ namespace ServerModels
             TableId(src.TableId)
             {}
 
+        FEvaluateRandomResultTableRequest(FEvaluateRandomResultTableRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            TableId(MoveTemp(src.TableId))
+            {}
+
+        FEvaluateRandomResultTableRequest& operator=(const FEvaluateRandomResultTableRequest& src) = default;
+        FEvaluateRandomResultTableRequest& operator=(FEvaluateRandomResultTableRequest&& src) = default;
+
         FEvaluateRandomResultTableRequest(const TSharedPtr<FJsonObject>& obj) : FEvaluateRandomResultTableRequest()
         {
             readFromValue(obj);
@@ -3040,7 +4144,13 @@ namespace ServerModels
         ~FEvaluateRandomResultTableRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FEvaluateRandomResultTableResult : public PlayFab::FPlayFabCppResultCommon
@@ -3058,6 +4168,14 @@ namespace ServerModels
             ResultItemId(src.ResultItemId)
             {}
 
+        FEvaluateRandomResultTableResult(FEvaluateRandomResultTableResult&& src) :
+            FPlayFabCppResultCommon(),
+            ResultItemId(MoveTemp(src.ResultItemId))
+            {}
+
+        FEvaluateRandomResultTableResult& operator=(const FEvaluateRandomResultTableResult& src) = default;
+        FEvaluateRandomResultTableResult& operator=(FEvaluateRandomResultTableResult&& src) = default;
+
         FEvaluateRandomResultTableResult(const TSharedPtr<FJsonObject>& obj) : FEvaluateRandomResultTableResult()
         {
             readFromValue(obj);
@@ -3066,7 +4184,13 @@ namespace ServerModels
         ~FEvaluateRandomResultTableResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FScriptExecutionError : public PlayFab::FPlayFabCppBaseModel
@@ -3097,6 +4221,16 @@ namespace ServerModels
             StackTrace(src.StackTrace)
             {}
 
+        FScriptExecutionError(FScriptExecutionError&& src) :
+            FPlayFabCppBaseModel(),
+            Error(MoveTemp(src.Error)),
+            Message(MoveTemp(src.Message)),
+            StackTrace(MoveTemp(src.StackTrace))
+            {}
+
+        FScriptExecutionError& operator=(const FScriptExecutionError& src) = default;
+        FScriptExecutionError& operator=(FScriptExecutionError&& src) = default;
+
         FScriptExecutionError(const TSharedPtr<FJsonObject>& obj) : FScriptExecutionError()
         {
             readFromValue(obj);
@@ -3105,7 +4239,13 @@ namespace ServerModels
         ~FScriptExecutionError();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLogStatement : public PlayFab::FPlayFabCppBaseModel
@@ -3133,6 +4273,16 @@ namespace ServerModels
             Message(src.Message)
             {}
 
+        FLogStatement(FLogStatement&& src) :
+            FPlayFabCppBaseModel(),
+            Data(MoveTemp(src.Data)),
+            Level(MoveTemp(src.Level)),
+            Message(MoveTemp(src.Message))
+            {}
+
+        FLogStatement& operator=(const FLogStatement& src) = default;
+        FLogStatement& operator=(FLogStatement&& src) = default;
+
         FLogStatement(const TSharedPtr<FJsonObject>& obj) : FLogStatement()
         {
             readFromValue(obj);
@@ -3141,7 +4291,13 @@ namespace ServerModels
         ~FLogStatement();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FExecuteCloudScriptResult : public PlayFab::FPlayFabCppResultCommon
@@ -3210,7 +4366,7 @@ namespace ServerModels
         FExecuteCloudScriptResult(const FExecuteCloudScriptResult& src) :
             FPlayFabCppResultCommon(),
             APIRequestsIssued(src.APIRequestsIssued),
-            Error(src.Error.IsValid() ? MakeShareable(new FScriptExecutionError(*src.Error)) : nullptr),
+            Error(src.Error.IsValid() ? TSharedPtr<FScriptExecutionError>(MakeShared<FScriptExecutionError>(*src.Error)) : nullptr),
             ExecutionTimeSeconds(src.ExecutionTimeSeconds),
             FunctionName(src.FunctionName),
             FunctionResult(src.FunctionResult),
@@ -3223,6 +4379,25 @@ namespace ServerModels
             Revision(src.Revision)
             {}
 
+        FExecuteCloudScriptResult(FExecuteCloudScriptResult&& src) :
+            FPlayFabCppResultCommon(),
+            APIRequestsIssued(MoveTemp(src.APIRequestsIssued)),
+            Error(MoveTemp(src.Error)),
+            ExecutionTimeSeconds(MoveTemp(src.ExecutionTimeSeconds)),
+            FunctionName(MoveTemp(src.FunctionName)),
+            FunctionResult(MoveTemp(src.FunctionResult)),
+            FunctionResultTooLarge(MoveTemp(src.FunctionResultTooLarge)),
+            HttpRequestsIssued(MoveTemp(src.HttpRequestsIssued)),
+            Logs(MoveTemp(src.Logs)),
+            LogsTooLarge(MoveTemp(src.LogsTooLarge)),
+            MemoryConsumedBytes(MoveTemp(src.MemoryConsumedBytes)),
+            ProcessorTimeSeconds(MoveTemp(src.ProcessorTimeSeconds)),
+            Revision(MoveTemp(src.Revision))
+            {}
+
+        FExecuteCloudScriptResult& operator=(const FExecuteCloudScriptResult& src) = default;
+        FExecuteCloudScriptResult& operator=(FExecuteCloudScriptResult&& src) = default;
+
         FExecuteCloudScriptResult(const TSharedPtr<FJsonObject>& obj) : FExecuteCloudScriptResult()
         {
             readFromValue(obj);
@@ -3231,7 +4406,13 @@ namespace ServerModels
         ~FExecuteCloudScriptResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FExecuteCloudScriptServerRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3285,6 +4466,20 @@ namespace ServerModels
             SpecificRevision(src.SpecificRevision)
             {}
 
+        FExecuteCloudScriptServerRequest(FExecuteCloudScriptServerRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            FunctionName(MoveTemp(src.FunctionName)),
+            FunctionParameter(MoveTemp(src.FunctionParameter)),
+            GeneratePlayStreamEvent(MoveTemp(src.GeneratePlayStreamEvent)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            RevisionSelection(MoveTemp(src.RevisionSelection)),
+            SpecificRevision(MoveTemp(src.SpecificRevision))
+            {}
+
+        FExecuteCloudScriptServerRequest& operator=(const FExecuteCloudScriptServerRequest& src) = default;
+        FExecuteCloudScriptServerRequest& operator=(FExecuteCloudScriptServerRequest&& src) = default;
+
         FExecuteCloudScriptServerRequest(const TSharedPtr<FJsonObject>& obj) : FExecuteCloudScriptServerRequest()
         {
             readFromValue(obj);
@@ -3293,7 +4488,13 @@ namespace ServerModels
         ~FExecuteCloudScriptServerRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FFacebookInstantGamesPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -3316,6 +4517,15 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FFacebookInstantGamesPlayFabIdPair(FFacebookInstantGamesPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            FacebookInstantGamesId(MoveTemp(src.FacebookInstantGamesId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FFacebookInstantGamesPlayFabIdPair& operator=(const FFacebookInstantGamesPlayFabIdPair& src) = default;
+        FFacebookInstantGamesPlayFabIdPair& operator=(FFacebookInstantGamesPlayFabIdPair&& src) = default;
+
         FFacebookInstantGamesPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FFacebookInstantGamesPlayFabIdPair()
         {
             readFromValue(obj);
@@ -3324,7 +4534,13 @@ namespace ServerModels
         ~FFacebookInstantGamesPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FFacebookPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -3347,6 +4563,15 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FFacebookPlayFabIdPair(FFacebookPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            FacebookId(MoveTemp(src.FacebookId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FFacebookPlayFabIdPair& operator=(const FFacebookPlayFabIdPair& src) = default;
+        FFacebookPlayFabIdPair& operator=(FFacebookPlayFabIdPair&& src) = default;
+
         FFacebookPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FFacebookPlayFabIdPair()
         {
             readFromValue(obj);
@@ -3355,7 +4580,13 @@ namespace ServerModels
         ~FFacebookPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum LoginIdentityProvider
@@ -3384,6 +4615,7 @@ namespace ServerModels
     };
 
     PLAYFABCPP_API void writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeLoginIdentityProviderEnumJSON(LoginIdentityProvider enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API LoginIdentityProvider readLoginIdentityProviderFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API LoginIdentityProvider readLoginIdentityProviderFromValue(const FString& value);
 
@@ -3417,6 +4649,17 @@ namespace ServerModels
             Username(src.Username)
             {}
 
+        FLinkedPlatformAccountModel(FLinkedPlatformAccountModel&& src) :
+            FPlayFabCppBaseModel(),
+            Email(MoveTemp(src.Email)),
+            Platform(MoveTemp(src.Platform)),
+            PlatformUserId(MoveTemp(src.PlatformUserId)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FLinkedPlatformAccountModel& operator=(const FLinkedPlatformAccountModel& src) = default;
+        FLinkedPlatformAccountModel& operator=(FLinkedPlatformAccountModel&& src) = default;
+
         FLinkedPlatformAccountModel(const TSharedPtr<FJsonObject>& obj) : FLinkedPlatformAccountModel()
         {
             readFromValue(obj);
@@ -3425,7 +4668,13 @@ namespace ServerModels
         ~FLinkedPlatformAccountModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLocationModel : public PlayFab::FPlayFabCppBaseModel
@@ -3463,6 +4712,18 @@ namespace ServerModels
             Longitude(src.Longitude)
             {}
 
+        FLocationModel(FLocationModel&& src) :
+            FPlayFabCppBaseModel(),
+            City(MoveTemp(src.City)),
+            pfContinentCode(MoveTemp(src.pfContinentCode)),
+            pfCountryCode(MoveTemp(src.pfCountryCode)),
+            Latitude(MoveTemp(src.Latitude)),
+            Longitude(MoveTemp(src.Longitude))
+            {}
+
+        FLocationModel& operator=(const FLocationModel& src) = default;
+        FLocationModel& operator=(FLocationModel&& src) = default;
+
         FLocationModel(const TSharedPtr<FJsonObject>& obj) : FLocationModel()
         {
             readFromValue(obj);
@@ -3471,7 +4732,13 @@ namespace ServerModels
         ~FLocationModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum SubscriptionProviderStatus
@@ -3487,6 +4754,7 @@ namespace ServerModels
     };
 
     PLAYFABCPP_API void writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeSubscriptionProviderStatusEnumJSON(SubscriptionProviderStatus enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API SubscriptionProviderStatus readSubscriptionProviderStatusFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API SubscriptionProviderStatus readSubscriptionProviderStatusFromValue(const FString& value);
 
@@ -3535,6 +4803,20 @@ namespace ServerModels
             SubscriptionProvider(src.SubscriptionProvider)
             {}
 
+        FSubscriptionModel(FSubscriptionModel&& src) :
+            FPlayFabCppBaseModel(),
+            Expiration(MoveTemp(src.Expiration)),
+            InitialSubscriptionTime(MoveTemp(src.InitialSubscriptionTime)),
+            IsActive(MoveTemp(src.IsActive)),
+            Status(MoveTemp(src.Status)),
+            SubscriptionId(MoveTemp(src.SubscriptionId)),
+            SubscriptionItemId(MoveTemp(src.SubscriptionItemId)),
+            SubscriptionProvider(MoveTemp(src.SubscriptionProvider))
+            {}
+
+        FSubscriptionModel& operator=(const FSubscriptionModel& src) = default;
+        FSubscriptionModel& operator=(FSubscriptionModel&& src) = default;
+
         FSubscriptionModel(const TSharedPtr<FJsonObject>& obj) : FSubscriptionModel()
         {
             readFromValue(obj);
@@ -3543,7 +4825,13 @@ namespace ServerModels
         ~FSubscriptionModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMembershipModel : public PlayFab::FPlayFabCppBaseModel
@@ -3588,6 +4876,19 @@ namespace ServerModels
             Subscriptions(src.Subscriptions)
             {}
 
+        FMembershipModel(FMembershipModel&& src) :
+            FPlayFabCppBaseModel(),
+            IsActive(MoveTemp(src.IsActive)),
+            MembershipExpiration(MoveTemp(src.MembershipExpiration)),
+            MembershipId(MoveTemp(src.MembershipId)),
+            OverrideExpiration(MoveTemp(src.OverrideExpiration)),
+            OverrideIsSet(MoveTemp(src.OverrideIsSet)),
+            Subscriptions(MoveTemp(src.Subscriptions))
+            {}
+
+        FMembershipModel& operator=(const FMembershipModel& src) = default;
+        FMembershipModel& operator=(FMembershipModel&& src) = default;
+
         FMembershipModel(const TSharedPtr<FJsonObject>& obj) : FMembershipModel()
         {
             readFromValue(obj);
@@ -3596,7 +4897,13 @@ namespace ServerModels
         ~FMembershipModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPushNotificationRegistrationModel : public PlayFab::FPlayFabCppBaseModel
@@ -3619,6 +4926,15 @@ namespace ServerModels
             Platform(src.Platform)
             {}
 
+        FPushNotificationRegistrationModel(FPushNotificationRegistrationModel&& src) :
+            FPlayFabCppBaseModel(),
+            NotificationEndpointARN(MoveTemp(src.NotificationEndpointARN)),
+            Platform(MoveTemp(src.Platform))
+            {}
+
+        FPushNotificationRegistrationModel& operator=(const FPushNotificationRegistrationModel& src) = default;
+        FPushNotificationRegistrationModel& operator=(FPushNotificationRegistrationModel&& src) = default;
+
         FPushNotificationRegistrationModel(const TSharedPtr<FJsonObject>& obj) : FPushNotificationRegistrationModel()
         {
             readFromValue(obj);
@@ -3627,7 +4943,13 @@ namespace ServerModels
         ~FPushNotificationRegistrationModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStatisticModel : public PlayFab::FPlayFabCppBaseModel
@@ -3655,6 +4977,16 @@ namespace ServerModels
             Version(src.Version)
             {}
 
+        FStatisticModel(FStatisticModel&& src) :
+            FPlayFabCppBaseModel(),
+            Name(MoveTemp(src.Name)),
+            Value(MoveTemp(src.Value)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FStatisticModel& operator=(const FStatisticModel& src) = default;
+        FStatisticModel& operator=(FStatisticModel&& src) = default;
+
         FStatisticModel(const TSharedPtr<FJsonObject>& obj) : FStatisticModel()
         {
             readFromValue(obj);
@@ -3663,7 +4995,13 @@ namespace ServerModels
         ~FStatisticModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FTagModel : public PlayFab::FPlayFabCppBaseModel
@@ -3681,6 +5019,14 @@ namespace ServerModels
             TagValue(src.TagValue)
             {}
 
+        FTagModel(FTagModel&& src) :
+            FPlayFabCppBaseModel(),
+            TagValue(MoveTemp(src.TagValue))
+            {}
+
+        FTagModel& operator=(const FTagModel& src) = default;
+        FTagModel& operator=(FTagModel&& src) = default;
+
         FTagModel(const TSharedPtr<FJsonObject>& obj) : FTagModel()
         {
             readFromValue(obj);
@@ -3689,7 +5035,13 @@ namespace ServerModels
         ~FTagModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FValueToDateModel : public PlayFab::FPlayFabCppBaseModel
@@ -3723,6 +5075,16 @@ namespace ServerModels
             TotalValueAsDecimal(src.TotalValueAsDecimal)
             {}
 
+        FValueToDateModel(FValueToDateModel&& src) :
+            FPlayFabCppBaseModel(),
+            Currency(MoveTemp(src.Currency)),
+            TotalValue(MoveTemp(src.TotalValue)),
+            TotalValueAsDecimal(MoveTemp(src.TotalValueAsDecimal))
+            {}
+
+        FValueToDateModel& operator=(const FValueToDateModel& src) = default;
+        FValueToDateModel& operator=(FValueToDateModel&& src) = default;
+
         FValueToDateModel(const TSharedPtr<FJsonObject>& obj) : FValueToDateModel()
         {
             readFromValue(obj);
@@ -3731,7 +5093,13 @@ namespace ServerModels
         ~FValueToDateModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerProfileModel : public PlayFab::FPlayFabCppBaseModel
@@ -3837,6 +5205,33 @@ namespace ServerModels
             ValuesToDate(src.ValuesToDate)
             {}
 
+        FPlayerProfileModel(FPlayerProfileModel&& src) :
+            FPlayFabCppBaseModel(),
+            AdCampaignAttributions(MoveTemp(src.AdCampaignAttributions)),
+            AvatarUrl(MoveTemp(src.AvatarUrl)),
+            BannedUntil(MoveTemp(src.BannedUntil)),
+            ContactEmailAddresses(MoveTemp(src.ContactEmailAddresses)),
+            Created(MoveTemp(src.Created)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            ExperimentVariants(MoveTemp(src.ExperimentVariants)),
+            LastLogin(MoveTemp(src.LastLogin)),
+            LinkedAccounts(MoveTemp(src.LinkedAccounts)),
+            Locations(MoveTemp(src.Locations)),
+            Memberships(MoveTemp(src.Memberships)),
+            Origination(MoveTemp(src.Origination)),
+            PlayerId(MoveTemp(src.PlayerId)),
+            PublisherId(MoveTemp(src.PublisherId)),
+            PushNotificationRegistrations(MoveTemp(src.PushNotificationRegistrations)),
+            Statistics(MoveTemp(src.Statistics)),
+            Tags(MoveTemp(src.Tags)),
+            TitleId(MoveTemp(src.TitleId)),
+            TotalValueToDateInUSD(MoveTemp(src.TotalValueToDateInUSD)),
+            ValuesToDate(MoveTemp(src.ValuesToDate))
+            {}
+
+        FPlayerProfileModel& operator=(const FPlayerProfileModel& src) = default;
+        FPlayerProfileModel& operator=(FPlayerProfileModel&& src) = default;
+
         FPlayerProfileModel(const TSharedPtr<FJsonObject>& obj) : FPlayerProfileModel()
         {
             readFromValue(obj);
@@ -3845,7 +5240,13 @@ namespace ServerModels
         ~FPlayerProfileModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FFriendInfo : public PlayFab::FPlayFabCppBaseModel
@@ -3895,18 +5296,35 @@ namespace ServerModels
 
         FFriendInfo(const FFriendInfo& src) :
             FPlayFabCppBaseModel(),
-            FacebookInfo(src.FacebookInfo.IsValid() ? MakeShareable(new FUserFacebookInfo(*src.FacebookInfo)) : nullptr),
+            FacebookInfo(src.FacebookInfo.IsValid() ? TSharedPtr<FUserFacebookInfo>(MakeShared<FUserFacebookInfo>(*src.FacebookInfo)) : nullptr),
             FriendPlayFabId(src.FriendPlayFabId),
-            GameCenterInfo(src.GameCenterInfo.IsValid() ? MakeShareable(new FUserGameCenterInfo(*src.GameCenterInfo)) : nullptr),
-            Profile(src.Profile.IsValid() ? MakeShareable(new FPlayerProfileModel(*src.Profile)) : nullptr),
-            PSNInfo(src.PSNInfo.IsValid() ? MakeShareable(new FUserPsnInfo(*src.PSNInfo)) : nullptr),
-            SteamInfo(src.SteamInfo.IsValid() ? MakeShareable(new FUserSteamInfo(*src.SteamInfo)) : nullptr),
+            GameCenterInfo(src.GameCenterInfo.IsValid() ? TSharedPtr<FUserGameCenterInfo>(MakeShared<FUserGameCenterInfo>(*src.GameCenterInfo)) : nullptr),
+            Profile(src.Profile.IsValid() ? TSharedPtr<FPlayerProfileModel>(MakeShared<FPlayerProfileModel>(*src.Profile)) : nullptr),
+            PSNInfo(src.PSNInfo.IsValid() ? TSharedPtr<FUserPsnInfo>(MakeShared<FUserPsnInfo>(*src.PSNInfo)) : nullptr),
+            SteamInfo(src.SteamInfo.IsValid() ? TSharedPtr<FUserSteamInfo>(MakeShared<FUserSteamInfo>(*src.SteamInfo)) : nullptr),
             Tags(src.Tags),
             TitleDisplayName(src.TitleDisplayName),
             Username(src.Username),
-            XboxInfo(src.XboxInfo.IsValid() ? MakeShareable(new FUserXboxInfo(*src.XboxInfo)) : nullptr)
+            XboxInfo(src.XboxInfo.IsValid() ? TSharedPtr<FUserXboxInfo>(MakeShared<FUserXboxInfo>(*src.XboxInfo)) : nullptr)
+            {}
+
+        FFriendInfo(FFriendInfo&& src) :
+            FPlayFabCppBaseModel(),
+            FacebookInfo(MoveTemp(src.FacebookInfo)),
+            FriendPlayFabId(MoveTemp(src.FriendPlayFabId)),
+            GameCenterInfo(MoveTemp(src.GameCenterInfo)),
+            Profile(MoveTemp(src.Profile)),
+            PSNInfo(MoveTemp(src.PSNInfo)),
+            SteamInfo(MoveTemp(src.SteamInfo)),
+            Tags(MoveTemp(src.Tags)),
+            TitleDisplayName(MoveTemp(src.TitleDisplayName)),
+            Username(MoveTemp(src.Username)),
+            XboxInfo(MoveTemp(src.XboxInfo))
             {}
 
+        FFriendInfo& operator=(const FFriendInfo& src) = default;
+        FFriendInfo& operator=(FFriendInfo&& src) = default;
+
         FFriendInfo(const TSharedPtr<FJsonObject>& obj) : FFriendInfo()
         {
             readFromValue(obj);
@@ -3915,7 +5333,13 @@ namespace ServerModels
         ~FFriendInfo();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum GameInstanceState
@@ -3925,6 +5349,7 @@ namespace ServerModels
     };
 
     PLAYFABCPP_API void writeGameInstanceStateEnumJSON(GameInstanceState enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeGameInstanceStateEnumJSON(GameInstanceState enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API GameInstanceState readGameInstanceStateFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API GameInstanceState readGameInstanceStateFromValue(const FString& value);
 
@@ -3944,10 +5369,19 @@ namespace ServerModels
 
         FGenericPlayFabIdPair(const FGenericPlayFabIdPair& src) :
             FPlayFabCppBaseModel(),
-            GenericId(src.GenericId.IsValid() ? MakeShareable(new FGenericServiceId(*src.GenericId)) : nullptr),
+            GenericId(src.GenericId.IsValid() ? TSharedPtr<FGenericServiceId>(MakeShared<FGenericServiceId>(*src.GenericId)) : nullptr),
             PlayFabId(src.PlayFabId)
             {}
 
+        FGenericPlayFabIdPair(FGenericPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            GenericId(MoveTemp(src.GenericId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGenericPlayFabIdPair& operator=(const FGenericPlayFabIdPair& src) = default;
+        FGenericPlayFabIdPair& operator=(FGenericPlayFabIdPair&& src) = default;
+
         FGenericPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FGenericPlayFabIdPair()
         {
             readFromValue(obj);
@@ -3956,7 +5390,13 @@ namespace ServerModels
         ~FGenericPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetAllSegmentsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -3969,6 +5409,13 @@ namespace ServerModels
             FPlayFabCppRequestCommon()
             {}
 
+        FGetAllSegmentsRequest(FGetAllSegmentsRequest&& src) :
+            FPlayFabCppRequestCommon()
+            {}
+
+        FGetAllSegmentsRequest& operator=(const FGetAllSegmentsRequest& src) = default;
+        FGetAllSegmentsRequest& operator=(FGetAllSegmentsRequest&& src) = default;
+
         FGetAllSegmentsRequest(const TSharedPtr<FJsonObject>& obj) : FGetAllSegmentsRequest()
         {
             readFromValue(obj);
@@ -3977,7 +5424,13 @@ namespace ServerModels
         ~FGetAllSegmentsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetSegmentResult : public PlayFab::FPlayFabCppBaseModel
@@ -4005,6 +5458,16 @@ namespace ServerModels
             Name(src.Name)
             {}
 
+        FGetSegmentResult(FGetSegmentResult&& src) :
+            FPlayFabCppBaseModel(),
+            ABTestParent(MoveTemp(src.ABTestParent)),
+            Id(MoveTemp(src.Id)),
+            Name(MoveTemp(src.Name))
+            {}
+
+        FGetSegmentResult& operator=(const FGetSegmentResult& src) = default;
+        FGetSegmentResult& operator=(FGetSegmentResult&& src) = default;
+
         FGetSegmentResult(const TSharedPtr<FJsonObject>& obj) : FGetSegmentResult()
         {
             readFromValue(obj);
@@ -4013,7 +5476,13 @@ namespace ServerModels
         ~FGetSegmentResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetAllSegmentsResult : public PlayFab::FPlayFabCppResultCommon
@@ -4030,6 +5499,14 @@ namespace ServerModels
             Segments(src.Segments)
             {}
 
+        FGetAllSegmentsResult(FGetAllSegmentsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Segments(MoveTemp(src.Segments))
+            {}
+
+        FGetAllSegmentsResult& operator=(const FGetAllSegmentsResult& src) = default;
+        FGetAllSegmentsResult& operator=(FGetAllSegmentsResult&& src) = default;
+
         FGetAllSegmentsResult(const TSharedPtr<FJsonObject>& obj) : FGetAllSegmentsResult()
         {
             readFromValue(obj);
@@ -4038,7 +5515,13 @@ namespace ServerModels
         ~FGetAllSegmentsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCatalogItemsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4056,6 +5539,14 @@ namespace ServerModels
             CatalogVersion(src.CatalogVersion)
             {}
 
+        FGetCatalogItemsRequest(FGetCatalogItemsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion))
+            {}
+
+        FGetCatalogItemsRequest& operator=(const FGetCatalogItemsRequest& src) = default;
+        FGetCatalogItemsRequest& operator=(FGetCatalogItemsRequest&& src) = default;
+
         FGetCatalogItemsRequest(const TSharedPtr<FJsonObject>& obj) : FGetCatalogItemsRequest()
         {
             readFromValue(obj);
@@ -4064,7 +5555,13 @@ namespace ServerModels
         ~FGetCatalogItemsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCatalogItemsResult : public PlayFab::FPlayFabCppResultCommon
@@ -4081,6 +5578,14 @@ namespace ServerModels
             Catalog(src.Catalog)
             {}
 
+        FGetCatalogItemsResult(FGetCatalogItemsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Catalog(MoveTemp(src.Catalog))
+            {}
+
+        FGetCatalogItemsResult& operator=(const FGetCatalogItemsResult& src) = default;
+        FGetCatalogItemsResult& operator=(FGetCatalogItemsResult&& src) = default;
+
         FGetCatalogItemsResult(const TSharedPtr<FJsonObject>& obj) : FGetCatalogItemsResult()
         {
             readFromValue(obj);
@@ -4089,7 +5594,13 @@ namespace ServerModels
         ~FGetCatalogItemsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4124,6 +5635,17 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetCharacterDataRequest(FGetCharacterDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            IfChangedFromDataVersion(MoveTemp(src.IfChangedFromDataVersion)),
+            Keys(MoveTemp(src.Keys)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetCharacterDataRequest& operator=(const FGetCharacterDataRequest& src) = default;
+        FGetCharacterDataRequest& operator=(FGetCharacterDataRequest&& src) = default;
+
         FGetCharacterDataRequest(const TSharedPtr<FJsonObject>& obj) : FGetCharacterDataRequest()
         {
             readFromValue(obj);
@@ -4132,7 +5654,13 @@ namespace ServerModels
         ~FGetCharacterDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum UserDataPermission
@@ -4142,6 +5670,7 @@ namespace ServerModels
     };
 
     PLAYFABCPP_API void writeUserDataPermissionEnumJSON(UserDataPermission enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeUserDataPermissionEnumJSON(UserDataPermission enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API UserDataPermission readUserDataPermissionFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API UserDataPermission readUserDataPermissionFromValue(const FString& value);
 
@@ -4173,6 +5702,16 @@ namespace ServerModels
             Value(src.Value)
             {}
 
+        FUserDataRecord(FUserDataRecord&& src) :
+            FPlayFabCppBaseModel(),
+            LastUpdated(MoveTemp(src.LastUpdated)),
+            Permission(MoveTemp(src.Permission)),
+            Value(MoveTemp(src.Value))
+            {}
+
+        FUserDataRecord& operator=(const FUserDataRecord& src) = default;
+        FUserDataRecord& operator=(FUserDataRecord&& src) = default;
+
         FUserDataRecord(const TSharedPtr<FJsonObject>& obj) : FUserDataRecord()
         {
             readFromValue(obj);
@@ -4181,7 +5720,13 @@ namespace ServerModels
         ~FUserDataRecord();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -4216,6 +5761,17 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetCharacterDataResult(FGetCharacterDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            Data(MoveTemp(src.Data)),
+            DataVersion(MoveTemp(src.DataVersion)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetCharacterDataResult& operator=(const FGetCharacterDataResult& src) = default;
+        FGetCharacterDataResult& operator=(FGetCharacterDataResult&& src) = default;
+
         FGetCharacterDataResult(const TSharedPtr<FJsonObject>& obj) : FGetCharacterDataResult()
         {
             readFromValue(obj);
@@ -4224,7 +5780,13 @@ namespace ServerModels
         ~FGetCharacterDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterInventoryRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4256,6 +5818,17 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetCharacterInventoryRequest(FGetCharacterInventoryRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetCharacterInventoryRequest& operator=(const FGetCharacterInventoryRequest& src) = default;
+        FGetCharacterInventoryRequest& operator=(FGetCharacterInventoryRequest&& src) = default;
+
         FGetCharacterInventoryRequest(const TSharedPtr<FJsonObject>& obj) : FGetCharacterInventoryRequest()
         {
             readFromValue(obj);
@@ -4264,7 +5837,13 @@ namespace ServerModels
         ~FGetCharacterInventoryRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FVirtualCurrencyRechargeTime : public PlayFab::FPlayFabCppBaseModel
@@ -4296,6 +5875,16 @@ namespace ServerModels
             SecondsToRecharge(src.SecondsToRecharge)
             {}
 
+        FVirtualCurrencyRechargeTime(FVirtualCurrencyRechargeTime&& src) :
+            FPlayFabCppBaseModel(),
+            RechargeMax(MoveTemp(src.RechargeMax)),
+            RechargeTime(MoveTemp(src.RechargeTime)),
+            SecondsToRecharge(MoveTemp(src.SecondsToRecharge))
+            {}
+
+        FVirtualCurrencyRechargeTime& operator=(const FVirtualCurrencyRechargeTime& src) = default;
+        FVirtualCurrencyRechargeTime& operator=(FVirtualCurrencyRechargeTime&& src) = default;
+
         FVirtualCurrencyRechargeTime(const TSharedPtr<FJsonObject>& obj) : FVirtualCurrencyRechargeTime()
         {
             readFromValue(obj);
@@ -4304,7 +5893,13 @@ namespace ServerModels
         ~FVirtualCurrencyRechargeTime();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterInventoryResult : public PlayFab::FPlayFabCppResultCommon
@@ -4339,6 +5934,18 @@ namespace ServerModels
             VirtualCurrencyRechargeTimes(src.VirtualCurrencyRechargeTimes)
             {}
 
+        FGetCharacterInventoryResult(FGetCharacterInventoryResult&& src) :
+            FPlayFabCppResultCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            Inventory(MoveTemp(src.Inventory)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency)),
+            VirtualCurrencyRechargeTimes(MoveTemp(src.VirtualCurrencyRechargeTimes))
+            {}
+
+        FGetCharacterInventoryResult& operator=(const FGetCharacterInventoryResult& src) = default;
+        FGetCharacterInventoryResult& operator=(FGetCharacterInventoryResult&& src) = default;
+
         FGetCharacterInventoryResult(const TSharedPtr<FJsonObject>& obj) : FGetCharacterInventoryResult()
         {
             readFromValue(obj);
@@ -4347,7 +5954,13 @@ namespace ServerModels
         ~FGetCharacterInventoryResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterLeaderboardRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4380,6 +5993,17 @@ namespace ServerModels
             StatisticName(src.StatisticName)
             {}
 
+        FGetCharacterLeaderboardRequest(FGetCharacterLeaderboardRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterType(MoveTemp(src.CharacterType)),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            StartPosition(MoveTemp(src.StartPosition)),
+            StatisticName(MoveTemp(src.StatisticName))
+            {}
+
+        FGetCharacterLeaderboardRequest& operator=(const FGetCharacterLeaderboardRequest& src) = default;
+        FGetCharacterLeaderboardRequest& operator=(FGetCharacterLeaderboardRequest&& src) = default;
+
         FGetCharacterLeaderboardRequest(const TSharedPtr<FJsonObject>& obj) : FGetCharacterLeaderboardRequest()
         {
             readFromValue(obj);
@@ -4388,7 +6012,13 @@ namespace ServerModels
         ~FGetCharacterLeaderboardRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterLeaderboardResult : public PlayFab::FPlayFabCppResultCommon
@@ -4405,6 +6035,14 @@ namespace ServerModels
             Leaderboard(src.Leaderboard)
             {}
 
+        FGetCharacterLeaderboardResult(FGetCharacterLeaderboardResult&& src) :
+            FPlayFabCppResultCommon(),
+            Leaderboard(MoveTemp(src.Leaderboard))
+            {}
+
+        FGetCharacterLeaderboardResult& operator=(const FGetCharacterLeaderboardResult& src) = default;
+        FGetCharacterLeaderboardResult& operator=(FGetCharacterLeaderboardResult&& src) = default;
+
         FGetCharacterLeaderboardResult(const TSharedPtr<FJsonObject>& obj) : FGetCharacterLeaderboardResult()
         {
             readFromValue(obj);
@@ -4413,7 +6051,13 @@ namespace ServerModels
         ~FGetCharacterLeaderboardResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4436,6 +6080,15 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetCharacterStatisticsRequest(FGetCharacterStatisticsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetCharacterStatisticsRequest& operator=(const FGetCharacterStatisticsRequest& src) = default;
+        FGetCharacterStatisticsRequest& operator=(FGetCharacterStatisticsRequest&& src) = default;
+
         FGetCharacterStatisticsRequest(const TSharedPtr<FJsonObject>& obj) : FGetCharacterStatisticsRequest()
         {
             readFromValue(obj);
@@ -4444,7 +6097,13 @@ namespace ServerModels
         ~FGetCharacterStatisticsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetCharacterStatisticsResult : public PlayFab::FPlayFabCppResultCommon
@@ -4471,6 +6130,16 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetCharacterStatisticsResult(FGetCharacterStatisticsResult&& src) :
+            FPlayFabCppResultCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CharacterStatistics(MoveTemp(src.CharacterStatistics)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetCharacterStatisticsResult& operator=(const FGetCharacterStatisticsResult& src) = default;
+        FGetCharacterStatisticsResult& operator=(FGetCharacterStatisticsResult&& src) = default;
+
         FGetCharacterStatisticsResult(const TSharedPtr<FJsonObject>& obj) : FGetCharacterStatisticsResult()
         {
             readFromValue(obj);
@@ -4479,7 +6148,13 @@ namespace ServerModels
         ~FGetCharacterStatisticsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetContentDownloadUrlRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4510,6 +6185,16 @@ namespace ServerModels
             ThruCDN(src.ThruCDN)
             {}
 
+        FGetContentDownloadUrlRequest(FGetContentDownloadUrlRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            HttpMethod(MoveTemp(src.HttpMethod)),
+            Key(MoveTemp(src.Key)),
+            ThruCDN(MoveTemp(src.ThruCDN))
+            {}
+
+        FGetContentDownloadUrlRequest& operator=(const FGetContentDownloadUrlRequest& src) = default;
+        FGetContentDownloadUrlRequest& operator=(FGetContentDownloadUrlRequest&& src) = default;
+
         FGetContentDownloadUrlRequest(const TSharedPtr<FJsonObject>& obj) : FGetContentDownloadUrlRequest()
         {
             readFromValue(obj);
@@ -4518,7 +6203,13 @@ namespace ServerModels
         ~FGetContentDownloadUrlRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetContentDownloadUrlResult : public PlayFab::FPlayFabCppResultCommon
@@ -4536,15 +6227,29 @@ namespace ServerModels
             URL(src.URL)
             {}
 
-        FGetContentDownloadUrlResult(const TSharedPtr<FJsonObject>& obj) : FGetContentDownloadUrlResult()
-        {
-            readFromValue(obj);
+        FGetContentDownloadUrlResult(FGetContentDownloadUrlResult&& src) :
+            FPlayFabCppResultCommon(),
+            URL(MoveTemp(src.URL))
+            {}
+
+        FGetContentDownloadUrlResult& operator=(const FGetContentDownloadUrlResult& src) = default;
+        FGetContentDownloadUrlResult& operator=(FGetContentDownloadUrlResult&& src) = default;
+
+        FGetContentDownloadUrlResult(const TSharedPtr<FJsonObject>& obj) : FGetContentDownloadUrlResult()
+        {
+            readFromValue(obj);
         }
 
         ~FGetContentDownloadUrlResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerProfileViewConstraints : public PlayFab::FPlayFabCppBaseModel
@@ -4642,6 +6347,30 @@ namespace ServerModels
             ShowValuesToDate(src.ShowValuesToDate)
             {}
 
+        FPlayerProfileViewConstraints(FPlayerProfileViewConstraints&& src) :
+            FPlayFabCppBaseModel(),
+            ShowAvatarUrl(MoveTemp(src.ShowAvatarUrl)),
+            ShowBannedUntil(MoveTemp(src.ShowBannedUntil)),
+            ShowCampaignAttributions(MoveTemp(src.ShowCampaignAttributions)),
+            ShowContactEmailAddresses(MoveTemp(src.ShowContactEmailAddresses)),
+            ShowCreated(MoveTemp(src.ShowCreated)),
+            ShowDisplayName(MoveTemp(src.ShowDisplayName)),
+            ShowExperimentVariants(MoveTemp(src.ShowExperimentVariants)),
+            ShowLastLogin(MoveTemp(src.ShowLastLogin)),
+            ShowLinkedAccounts(MoveTemp(src.ShowLinkedAccounts)),
+            ShowLocations(MoveTemp(src.ShowLocations)),
+            ShowMemberships(MoveTemp(src.ShowMemberships)),
+            ShowOrigination(MoveTemp(src.ShowOrigination)),
+            ShowPushNotificationRegistrations(MoveTemp(src.ShowPushNotificationRegistrations)),
+            ShowStatistics(MoveTemp(src.ShowStatistics)),
+            ShowTags(MoveTemp(src.ShowTags)),
+            ShowTotalValueToDateInUsd(MoveTemp(src.ShowTotalValueToDateInUsd)),
+            ShowValuesToDate(MoveTemp(src.ShowValuesToDate))
+            {}
+
+        FPlayerProfileViewConstraints& operator=(const FPlayerProfileViewConstraints& src) = default;
+        FPlayerProfileViewConstraints& operator=(FPlayerProfileViewConstraints&& src) = default;
+
         FPlayerProfileViewConstraints(const TSharedPtr<FJsonObject>& obj) : FPlayerProfileViewConstraints()
         {
             readFromValue(obj);
@@ -4650,7 +6379,13 @@ namespace ServerModels
         ~FPlayerProfileViewConstraints();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetFriendLeaderboardRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4713,7 +6448,7 @@ namespace ServerModels
             IncludeSteamFriends(src.IncludeSteamFriends),
             MaxResultsCount(src.MaxResultsCount),
             PlayFabId(src.PlayFabId),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr),
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr),
             StartPosition(src.StartPosition),
             StatisticName(src.StatisticName),
             UseSpecificVersion(src.UseSpecificVersion),
@@ -4721,6 +6456,24 @@ namespace ServerModels
             XboxToken(src.XboxToken)
             {}
 
+        FGetFriendLeaderboardRequest(FGetFriendLeaderboardRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            IncludeFacebookFriends(MoveTemp(src.IncludeFacebookFriends)),
+            IncludeSteamFriends(MoveTemp(src.IncludeSteamFriends)),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints)),
+            StartPosition(MoveTemp(src.StartPosition)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            UseSpecificVersion(MoveTemp(src.UseSpecificVersion)),
+            Version(MoveTemp(src.Version)),
+            XboxToken(MoveTemp(src.XboxToken))
+            {}
+
+        FGetFriendLeaderboardRequest& operator=(const FGetFriendLeaderboardRequest& src) = default;
+        FGetFriendLeaderboardRequest& operator=(FGetFriendLeaderboardRequest&& src) = default;
+
         FGetFriendLeaderboardRequest(const TSharedPtr<FJsonObject>& obj) : FGetFriendLeaderboardRequest()
         {
             readFromValue(obj);
@@ -4729,7 +6482,13 @@ namespace ServerModels
         ~FGetFriendLeaderboardRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetFriendsListRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4771,10 +6530,23 @@ namespace ServerModels
             IncludeFacebookFriends(src.IncludeFacebookFriends),
             IncludeSteamFriends(src.IncludeSteamFriends),
             PlayFabId(src.PlayFabId),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr),
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr),
             XboxToken(src.XboxToken)
             {}
 
+        FGetFriendsListRequest(FGetFriendsListRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            IncludeFacebookFriends(MoveTemp(src.IncludeFacebookFriends)),
+            IncludeSteamFriends(MoveTemp(src.IncludeSteamFriends)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints)),
+            XboxToken(MoveTemp(src.XboxToken))
+            {}
+
+        FGetFriendsListRequest& operator=(const FGetFriendsListRequest& src) = default;
+        FGetFriendsListRequest& operator=(FGetFriendsListRequest&& src) = default;
+
         FGetFriendsListRequest(const TSharedPtr<FJsonObject>& obj) : FGetFriendsListRequest()
         {
             readFromValue(obj);
@@ -4783,7 +6555,13 @@ namespace ServerModels
         ~FGetFriendsListRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetFriendsListResult : public PlayFab::FPlayFabCppResultCommon
@@ -4800,6 +6578,14 @@ namespace ServerModels
             Friends(src.Friends)
             {}
 
+        FGetFriendsListResult(FGetFriendsListResult&& src) :
+            FPlayFabCppResultCommon(),
+            Friends(MoveTemp(src.Friends))
+            {}
+
+        FGetFriendsListResult& operator=(const FGetFriendsListResult& src) = default;
+        FGetFriendsListResult& operator=(FGetFriendsListResult&& src) = default;
+
         FGetFriendsListResult(const TSharedPtr<FJsonObject>& obj) : FGetFriendsListResult()
         {
             readFromValue(obj);
@@ -4808,7 +6594,13 @@ namespace ServerModels
         ~FGetFriendsListResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardAroundCharacterRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4846,6 +6638,18 @@ namespace ServerModels
             StatisticName(src.StatisticName)
             {}
 
+        FGetLeaderboardAroundCharacterRequest(FGetLeaderboardAroundCharacterRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CharacterType(MoveTemp(src.CharacterType)),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            StatisticName(MoveTemp(src.StatisticName))
+            {}
+
+        FGetLeaderboardAroundCharacterRequest& operator=(const FGetLeaderboardAroundCharacterRequest& src) = default;
+        FGetLeaderboardAroundCharacterRequest& operator=(FGetLeaderboardAroundCharacterRequest&& src) = default;
+
         FGetLeaderboardAroundCharacterRequest(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardAroundCharacterRequest()
         {
             readFromValue(obj);
@@ -4854,7 +6658,13 @@ namespace ServerModels
         ~FGetLeaderboardAroundCharacterRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardAroundCharacterResult : public PlayFab::FPlayFabCppResultCommon
@@ -4871,6 +6681,14 @@ namespace ServerModels
             Leaderboard(src.Leaderboard)
             {}
 
+        FGetLeaderboardAroundCharacterResult(FGetLeaderboardAroundCharacterResult&& src) :
+            FPlayFabCppResultCommon(),
+            Leaderboard(MoveTemp(src.Leaderboard))
+            {}
+
+        FGetLeaderboardAroundCharacterResult& operator=(const FGetLeaderboardAroundCharacterResult& src) = default;
+        FGetLeaderboardAroundCharacterResult& operator=(FGetLeaderboardAroundCharacterResult&& src) = default;
+
         FGetLeaderboardAroundCharacterResult(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardAroundCharacterResult()
         {
             readFromValue(obj);
@@ -4879,7 +6697,13 @@ namespace ServerModels
         ~FGetLeaderboardAroundCharacterResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardAroundUserRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -4924,12 +6748,26 @@ namespace ServerModels
             CustomTags(src.CustomTags),
             MaxResultsCount(src.MaxResultsCount),
             PlayFabId(src.PlayFabId),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr),
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr),
             StatisticName(src.StatisticName),
             UseSpecificVersion(src.UseSpecificVersion),
             Version(src.Version)
             {}
 
+        FGetLeaderboardAroundUserRequest(FGetLeaderboardAroundUserRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            UseSpecificVersion(MoveTemp(src.UseSpecificVersion)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FGetLeaderboardAroundUserRequest& operator=(const FGetLeaderboardAroundUserRequest& src) = default;
+        FGetLeaderboardAroundUserRequest& operator=(FGetLeaderboardAroundUserRequest&& src) = default;
+
         FGetLeaderboardAroundUserRequest(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardAroundUserRequest()
         {
             readFromValue(obj);
@@ -4938,7 +6776,13 @@ namespace ServerModels
         ~FGetLeaderboardAroundUserRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerLeaderboardEntry : public PlayFab::FPlayFabCppBaseModel
@@ -4972,10 +6816,22 @@ namespace ServerModels
             DisplayName(src.DisplayName),
             PlayFabId(src.PlayFabId),
             Position(src.Position),
-            Profile(src.Profile.IsValid() ? MakeShareable(new FPlayerProfileModel(*src.Profile)) : nullptr),
+            Profile(src.Profile.IsValid() ? TSharedPtr<FPlayerProfileModel>(MakeShared<FPlayerProfileModel>(*src.Profile)) : nullptr),
             StatValue(src.StatValue)
             {}
 
+        FPlayerLeaderboardEntry(FPlayerLeaderboardEntry&& src) :
+            FPlayFabCppBaseModel(),
+            DisplayName(MoveTemp(src.DisplayName)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Position(MoveTemp(src.Position)),
+            Profile(MoveTemp(src.Profile)),
+            StatValue(MoveTemp(src.StatValue))
+            {}
+
+        FPlayerLeaderboardEntry& operator=(const FPlayerLeaderboardEntry& src) = default;
+        FPlayerLeaderboardEntry& operator=(FPlayerLeaderboardEntry&& src) = default;
+
         FPlayerLeaderboardEntry(const TSharedPtr<FJsonObject>& obj) : FPlayerLeaderboardEntry()
         {
             readFromValue(obj);
@@ -4984,7 +6840,13 @@ namespace ServerModels
         ~FPlayerLeaderboardEntry();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardAroundUserResult : public PlayFab::FPlayFabCppResultCommon
@@ -5011,6 +6873,16 @@ namespace ServerModels
             Version(src.Version)
             {}
 
+        FGetLeaderboardAroundUserResult(FGetLeaderboardAroundUserResult&& src) :
+            FPlayFabCppResultCommon(),
+            Leaderboard(MoveTemp(src.Leaderboard)),
+            NextReset(MoveTemp(src.NextReset)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FGetLeaderboardAroundUserResult& operator=(const FGetLeaderboardAroundUserResult& src) = default;
+        FGetLeaderboardAroundUserResult& operator=(FGetLeaderboardAroundUserResult&& src) = default;
+
         FGetLeaderboardAroundUserResult(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardAroundUserResult()
         {
             readFromValue(obj);
@@ -5019,7 +6891,13 @@ namespace ServerModels
         ~FGetLeaderboardAroundUserResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardForUsersCharactersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5047,6 +6925,16 @@ namespace ServerModels
             StatisticName(src.StatisticName)
             {}
 
+        FGetLeaderboardForUsersCharactersRequest(FGetLeaderboardForUsersCharactersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            StatisticName(MoveTemp(src.StatisticName))
+            {}
+
+        FGetLeaderboardForUsersCharactersRequest& operator=(const FGetLeaderboardForUsersCharactersRequest& src) = default;
+        FGetLeaderboardForUsersCharactersRequest& operator=(FGetLeaderboardForUsersCharactersRequest&& src) = default;
+
         FGetLeaderboardForUsersCharactersRequest(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardForUsersCharactersRequest()
         {
             readFromValue(obj);
@@ -5055,7 +6943,13 @@ namespace ServerModels
         ~FGetLeaderboardForUsersCharactersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardForUsersCharactersResult : public PlayFab::FPlayFabCppResultCommon
@@ -5072,6 +6966,14 @@ namespace ServerModels
             Leaderboard(src.Leaderboard)
             {}
 
+        FGetLeaderboardForUsersCharactersResult(FGetLeaderboardForUsersCharactersResult&& src) :
+            FPlayFabCppResultCommon(),
+            Leaderboard(MoveTemp(src.Leaderboard))
+            {}
+
+        FGetLeaderboardForUsersCharactersResult& operator=(const FGetLeaderboardForUsersCharactersResult& src) = default;
+        FGetLeaderboardForUsersCharactersResult& operator=(FGetLeaderboardForUsersCharactersResult&& src) = default;
+
         FGetLeaderboardForUsersCharactersResult(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardForUsersCharactersResult()
         {
             readFromValue(obj);
@@ -5080,7 +6982,13 @@ namespace ServerModels
         ~FGetLeaderboardForUsersCharactersResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5124,13 +7032,27 @@ namespace ServerModels
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
             MaxResultsCount(src.MaxResultsCount),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr),
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr),
             StartPosition(src.StartPosition),
             StatisticName(src.StatisticName),
             UseSpecificVersion(src.UseSpecificVersion),
             Version(src.Version)
             {}
 
+        FGetLeaderboardRequest(FGetLeaderboardRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            MaxResultsCount(MoveTemp(src.MaxResultsCount)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints)),
+            StartPosition(MoveTemp(src.StartPosition)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            UseSpecificVersion(MoveTemp(src.UseSpecificVersion)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FGetLeaderboardRequest& operator=(const FGetLeaderboardRequest& src) = default;
+        FGetLeaderboardRequest& operator=(FGetLeaderboardRequest&& src) = default;
+
         FGetLeaderboardRequest(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardRequest()
         {
             readFromValue(obj);
@@ -5139,7 +7061,13 @@ namespace ServerModels
         ~FGetLeaderboardRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetLeaderboardResult : public PlayFab::FPlayFabCppResultCommon
@@ -5166,6 +7094,16 @@ namespace ServerModels
             Version(src.Version)
             {}
 
+        FGetLeaderboardResult(FGetLeaderboardResult&& src) :
+            FPlayFabCppResultCommon(),
+            Leaderboard(MoveTemp(src.Leaderboard)),
+            NextReset(MoveTemp(src.NextReset)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FGetLeaderboardResult& operator=(const FGetLeaderboardResult& src) = default;
+        FGetLeaderboardResult& operator=(FGetLeaderboardResult&& src) = default;
+
         FGetLeaderboardResult(const TSharedPtr<FJsonObject>& obj) : FGetLeaderboardResult()
         {
             readFromValue(obj);
@@ -5174,7 +7112,13 @@ namespace ServerModels
         ~FGetLeaderboardResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerCombinedInfoRequestParams : public PlayFab::FPlayFabCppBaseModel
@@ -5255,12 +7199,34 @@ namespace ServerModels
             GetUserReadOnlyData(src.GetUserReadOnlyData),
             GetUserVirtualCurrency(src.GetUserVirtualCurrency),
             PlayerStatisticNames(src.PlayerStatisticNames),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr),
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr),
             TitleDataKeys(src.TitleDataKeys),
             UserDataKeys(src.UserDataKeys),
             UserReadOnlyDataKeys(src.UserReadOnlyDataKeys)
             {}
 
+        FGetPlayerCombinedInfoRequestParams(FGetPlayerCombinedInfoRequestParams&& src) :
+            FPlayFabCppBaseModel(),
+            GetCharacterInventories(MoveTemp(src.GetCharacterInventories)),
+            GetCharacterList(MoveTemp(src.GetCharacterList)),
+            GetPlayerProfile(MoveTemp(src.GetPlayerProfile)),
+            GetPlayerStatistics(MoveTemp(src.GetPlayerStatistics)),
+            GetTitleData(MoveTemp(src.GetTitleData)),
+            GetUserAccountInfo(MoveTemp(src.GetUserAccountInfo)),
+            GetUserData(MoveTemp(src.GetUserData)),
+            GetUserInventory(MoveTemp(src.GetUserInventory)),
+            GetUserReadOnlyData(MoveTemp(src.GetUserReadOnlyData)),
+            GetUserVirtualCurrency(MoveTemp(src.GetUserVirtualCurrency)),
+            PlayerStatisticNames(MoveTemp(src.PlayerStatisticNames)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints)),
+            TitleDataKeys(MoveTemp(src.TitleDataKeys)),
+            UserDataKeys(MoveTemp(src.UserDataKeys)),
+            UserReadOnlyDataKeys(MoveTemp(src.UserReadOnlyDataKeys))
+            {}
+
+        FGetPlayerCombinedInfoRequestParams& operator=(const FGetPlayerCombinedInfoRequestParams& src) = default;
+        FGetPlayerCombinedInfoRequestParams& operator=(FGetPlayerCombinedInfoRequestParams&& src) = default;
+
         FGetPlayerCombinedInfoRequestParams(const TSharedPtr<FJsonObject>& obj) : FGetPlayerCombinedInfoRequestParams()
         {
             readFromValue(obj);
@@ -5269,7 +7235,13 @@ namespace ServerModels
         ~FGetPlayerCombinedInfoRequestParams();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerCombinedInfoRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5296,6 +7268,16 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetPlayerCombinedInfoRequest(FGetPlayerCombinedInfoRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetPlayerCombinedInfoRequest& operator=(const FGetPlayerCombinedInfoRequest& src) = default;
+        FGetPlayerCombinedInfoRequest& operator=(FGetPlayerCombinedInfoRequest&& src) = default;
+
         FGetPlayerCombinedInfoRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerCombinedInfoRequest()
         {
             readFromValue(obj);
@@ -5304,7 +7286,13 @@ namespace ServerModels
         ~FGetPlayerCombinedInfoRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStatisticValue : public PlayFab::FPlayFabCppBaseModel
@@ -5332,6 +7320,16 @@ namespace ServerModels
             Version(src.Version)
             {}
 
+        FStatisticValue(FStatisticValue&& src) :
+            FPlayFabCppBaseModel(),
+            StatisticName(MoveTemp(src.StatisticName)),
+            Value(MoveTemp(src.Value)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FStatisticValue& operator=(const FStatisticValue& src) = default;
+        FStatisticValue& operator=(FStatisticValue&& src) = default;
+
         FStatisticValue(const TSharedPtr<FJsonObject>& obj) : FStatisticValue()
         {
             readFromValue(obj);
@@ -5340,7 +7338,13 @@ namespace ServerModels
         ~FStatisticValue();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerCombinedInfoResultPayload : public PlayFab::FPlayFabCppBaseModel
@@ -5397,10 +7401,10 @@ namespace ServerModels
 
         FGetPlayerCombinedInfoResultPayload(const FGetPlayerCombinedInfoResultPayload& src) :
             FPlayFabCppBaseModel(),
-            AccountInfo(src.AccountInfo.IsValid() ? MakeShareable(new FUserAccountInfo(*src.AccountInfo)) : nullptr),
+            AccountInfo(src.AccountInfo.IsValid() ? TSharedPtr<FUserAccountInfo>(MakeShared<FUserAccountInfo>(*src.AccountInfo)) : nullptr),
             CharacterInventories(src.CharacterInventories),
             CharacterList(src.CharacterList),
-            PlayerProfile(src.PlayerProfile.IsValid() ? MakeShareable(new FPlayerProfileModel(*src.PlayerProfile)) : nullptr),
+            PlayerProfile(src.PlayerProfile.IsValid() ? TSharedPtr<FPlayerProfileModel>(MakeShared<FPlayerProfileModel>(*src.PlayerProfile)) : nullptr),
             PlayerStatistics(src.PlayerStatistics),
             TitleData(src.TitleData),
             UserData(src.UserData),
@@ -5412,6 +7416,26 @@ namespace ServerModels
             UserVirtualCurrencyRechargeTimes(src.UserVirtualCurrencyRechargeTimes)
             {}
 
+        FGetPlayerCombinedInfoResultPayload(FGetPlayerCombinedInfoResultPayload&& src) :
+            FPlayFabCppBaseModel(),
+            AccountInfo(MoveTemp(src.AccountInfo)),
+            CharacterInventories(MoveTemp(src.CharacterInventories)),
+            CharacterList(MoveTemp(src.CharacterList)),
+            PlayerProfile(MoveTemp(src.PlayerProfile)),
+            PlayerStatistics(MoveTemp(src.PlayerStatistics)),
+            TitleData(MoveTemp(src.TitleData)),
+            UserData(MoveTemp(src.UserData)),
+            UserDataVersion(MoveTemp(src.UserDataVersion)),
+            UserInventory(MoveTemp(src.UserInventory)),
+            UserReadOnlyData(MoveTemp(src.UserReadOnlyData)),
+            UserReadOnlyDataVersion(MoveTemp(src.UserReadOnlyDataVersion)),
+            UserVirtualCurrency(MoveTemp(src.UserVirtualCurrency)),
+            UserVirtualCurrencyRechargeTimes(MoveTemp(src.UserVirtualCurrencyRechargeTimes))
+            {}
+
+        FGetPlayerCombinedInfoResultPayload& operator=(const FGetPlayerCombinedInfoResultPayload& src) = default;
+        FGetPlayerCombinedInfoResultPayload& operator=(FGetPlayerCombinedInfoResultPayload&& src) = default;
+
         FGetPlayerCombinedInfoResultPayload(const TSharedPtr<FJsonObject>& obj) : FGetPlayerCombinedInfoResultPayload()
         {
             readFromValue(obj);
@@ -5420,7 +7444,13 @@ namespace ServerModels
         ~FGetPlayerCombinedInfoResultPayload();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerCombinedInfoResult : public PlayFab::FPlayFabCppResultCommon
@@ -5439,10 +7469,19 @@ namespace ServerModels
 
         FGetPlayerCombinedInfoResult(const FGetPlayerCombinedInfoResult& src) :
             FPlayFabCppResultCommon(),
-            InfoResultPayload(src.InfoResultPayload.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoResultPayload(*src.InfoResultPayload)) : nullptr),
+            InfoResultPayload(src.InfoResultPayload.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoResultPayload>(MakeShared<FGetPlayerCombinedInfoResultPayload>(*src.InfoResultPayload)) : nullptr),
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetPlayerCombinedInfoResult(FGetPlayerCombinedInfoResult&& src) :
+            FPlayFabCppResultCommon(),
+            InfoResultPayload(MoveTemp(src.InfoResultPayload)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetPlayerCombinedInfoResult& operator=(const FGetPlayerCombinedInfoResult& src) = default;
+        FGetPlayerCombinedInfoResult& operator=(FGetPlayerCombinedInfoResult&& src) = default;
+
         FGetPlayerCombinedInfoResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerCombinedInfoResult()
         {
             readFromValue(obj);
@@ -5451,7 +7490,13 @@ namespace ServerModels
         ~FGetPlayerCombinedInfoResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerProfileRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5479,9 +7524,19 @@ namespace ServerModels
             FPlayFabCppRequestCommon(),
             CustomTags(src.CustomTags),
             PlayFabId(src.PlayFabId),
-            ProfileConstraints(src.ProfileConstraints.IsValid() ? MakeShareable(new FPlayerProfileViewConstraints(*src.ProfileConstraints)) : nullptr)
+            ProfileConstraints(src.ProfileConstraints.IsValid() ? TSharedPtr<FPlayerProfileViewConstraints>(MakeShared<FPlayerProfileViewConstraints>(*src.ProfileConstraints)) : nullptr)
+            {}
+
+        FGetPlayerProfileRequest(FGetPlayerProfileRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            ProfileConstraints(MoveTemp(src.ProfileConstraints))
             {}
 
+        FGetPlayerProfileRequest& operator=(const FGetPlayerProfileRequest& src) = default;
+        FGetPlayerProfileRequest& operator=(FGetPlayerProfileRequest&& src) = default;
+
         FGetPlayerProfileRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerProfileRequest()
         {
             readFromValue(obj);
@@ -5490,7 +7545,13 @@ namespace ServerModels
         ~FGetPlayerProfileRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerProfileResult : public PlayFab::FPlayFabCppResultCommon
@@ -5508,9 +7569,17 @@ namespace ServerModels
 
         FGetPlayerProfileResult(const FGetPlayerProfileResult& src) :
             FPlayFabCppResultCommon(),
-            PlayerProfile(src.PlayerProfile.IsValid() ? MakeShareable(new FPlayerProfileModel(*src.PlayerProfile)) : nullptr)
+            PlayerProfile(src.PlayerProfile.IsValid() ? TSharedPtr<FPlayerProfileModel>(MakeShared<FPlayerProfileModel>(*src.PlayerProfile)) : nullptr)
+            {}
+
+        FGetPlayerProfileResult(FGetPlayerProfileResult&& src) :
+            FPlayFabCppResultCommon(),
+            PlayerProfile(MoveTemp(src.PlayerProfile))
             {}
 
+        FGetPlayerProfileResult& operator=(const FGetPlayerProfileResult& src) = default;
+        FGetPlayerProfileResult& operator=(FGetPlayerProfileResult&& src) = default;
+
         FGetPlayerProfileResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerProfileResult()
         {
             readFromValue(obj);
@@ -5519,7 +7588,13 @@ namespace ServerModels
         ~FGetPlayerProfileResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerSegmentsResult : public PlayFab::FPlayFabCppResultCommon
@@ -5536,6 +7611,14 @@ namespace ServerModels
             Segments(src.Segments)
             {}
 
+        FGetPlayerSegmentsResult(FGetPlayerSegmentsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Segments(MoveTemp(src.Segments))
+            {}
+
+        FGetPlayerSegmentsResult& operator=(const FGetPlayerSegmentsResult& src) = default;
+        FGetPlayerSegmentsResult& operator=(FGetPlayerSegmentsResult&& src) = default;
+
         FGetPlayerSegmentsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerSegmentsResult()
         {
             readFromValue(obj);
@@ -5544,7 +7627,13 @@ namespace ServerModels
         ~FGetPlayerSegmentsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayersInSegmentRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5584,6 +7673,18 @@ namespace ServerModels
             SegmentId(src.SegmentId)
             {}
 
+        FGetPlayersInSegmentRequest(FGetPlayersInSegmentRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ContinuationToken(MoveTemp(src.ContinuationToken)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            MaxBatchSize(MoveTemp(src.MaxBatchSize)),
+            SecondsToLive(MoveTemp(src.SecondsToLive)),
+            SegmentId(MoveTemp(src.SegmentId))
+            {}
+
+        FGetPlayersInSegmentRequest& operator=(const FGetPlayersInSegmentRequest& src) = default;
+        FGetPlayersInSegmentRequest& operator=(FGetPlayersInSegmentRequest&& src) = default;
+
         FGetPlayersInSegmentRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayersInSegmentRequest()
         {
             readFromValue(obj);
@@ -5592,7 +7693,13 @@ namespace ServerModels
         ~FGetPlayersInSegmentRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerLinkedAccount : public PlayFab::FPlayFabCppBaseModel
@@ -5625,6 +7732,17 @@ namespace ServerModels
             Username(src.Username)
             {}
 
+        FPlayerLinkedAccount(FPlayerLinkedAccount&& src) :
+            FPlayFabCppBaseModel(),
+            Email(MoveTemp(src.Email)),
+            Platform(MoveTemp(src.Platform)),
+            PlatformUserId(MoveTemp(src.PlatformUserId)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FPlayerLinkedAccount& operator=(const FPlayerLinkedAccount& src) = default;
+        FPlayerLinkedAccount& operator=(FPlayerLinkedAccount&& src) = default;
+
         FPlayerLinkedAccount(const TSharedPtr<FJsonObject>& obj) : FPlayerLinkedAccount()
         {
             readFromValue(obj);
@@ -5633,7 +7751,13 @@ namespace ServerModels
         ~FPlayerLinkedAccount();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerLocation : public PlayFab::FPlayFabCppBaseModel
@@ -5671,6 +7795,18 @@ namespace ServerModels
             Longitude(src.Longitude)
             {}
 
+        FPlayerLocation(FPlayerLocation&& src) :
+            FPlayFabCppBaseModel(),
+            City(MoveTemp(src.City)),
+            pfContinentCode(MoveTemp(src.pfContinentCode)),
+            pfCountryCode(MoveTemp(src.pfCountryCode)),
+            Latitude(MoveTemp(src.Latitude)),
+            Longitude(MoveTemp(src.Longitude))
+            {}
+
+        FPlayerLocation& operator=(const FPlayerLocation& src) = default;
+        FPlayerLocation& operator=(FPlayerLocation&& src) = default;
+
         FPlayerLocation(const TSharedPtr<FJsonObject>& obj) : FPlayerLocation()
         {
             readFromValue(obj);
@@ -5679,7 +7815,13 @@ namespace ServerModels
         ~FPlayerLocation();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerStatistic : public PlayFab::FPlayFabCppBaseModel
@@ -5712,6 +7854,17 @@ namespace ServerModels
             StatisticVersion(src.StatisticVersion)
             {}
 
+        FPlayerStatistic(FPlayerStatistic&& src) :
+            FPlayFabCppBaseModel(),
+            Id(MoveTemp(src.Id)),
+            Name(MoveTemp(src.Name)),
+            StatisticValue(MoveTemp(src.StatisticValue)),
+            StatisticVersion(MoveTemp(src.StatisticVersion))
+            {}
+
+        FPlayerStatistic& operator=(const FPlayerStatistic& src) = default;
+        FPlayerStatistic& operator=(FPlayerStatistic&& src) = default;
+
         FPlayerStatistic(const TSharedPtr<FJsonObject>& obj) : FPlayerStatistic()
         {
             readFromValue(obj);
@@ -5720,7 +7873,13 @@ namespace ServerModels
         ~FPlayerStatistic();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPushNotificationRegistration : public PlayFab::FPlayFabCppBaseModel
@@ -5743,6 +7902,15 @@ namespace ServerModels
             Platform(src.Platform)
             {}
 
+        FPushNotificationRegistration(FPushNotificationRegistration&& src) :
+            FPlayFabCppBaseModel(),
+            NotificationEndpointARN(MoveTemp(src.NotificationEndpointARN)),
+            Platform(MoveTemp(src.Platform))
+            {}
+
+        FPushNotificationRegistration& operator=(const FPushNotificationRegistration& src) = default;
+        FPushNotificationRegistration& operator=(FPushNotificationRegistration&& src) = default;
+
         FPushNotificationRegistration(const TSharedPtr<FJsonObject>& obj) : FPushNotificationRegistration()
         {
             readFromValue(obj);
@@ -5751,7 +7919,13 @@ namespace ServerModels
         ~FPushNotificationRegistration();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerProfile : public PlayFab::FPlayFabCppBaseModel
@@ -5858,6 +8032,34 @@ namespace ServerModels
             VirtualCurrencyBalances(src.VirtualCurrencyBalances)
             {}
 
+        FPlayerProfile(FPlayerProfile&& src) :
+            FPlayFabCppBaseModel(),
+            AdCampaignAttributions(MoveTemp(src.AdCampaignAttributions)),
+            AvatarUrl(MoveTemp(src.AvatarUrl)),
+            BannedUntil(MoveTemp(src.BannedUntil)),
+            ContactEmailAddresses(MoveTemp(src.ContactEmailAddresses)),
+            Created(MoveTemp(src.Created)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            LastLogin(MoveTemp(src.LastLogin)),
+            LinkedAccounts(MoveTemp(src.LinkedAccounts)),
+            Locations(MoveTemp(src.Locations)),
+            Origination(MoveTemp(src.Origination)),
+            PlayerExperimentVariants(MoveTemp(src.PlayerExperimentVariants)),
+            PlayerId(MoveTemp(src.PlayerId)),
+            PlayerStatistics(MoveTemp(src.PlayerStatistics)),
+            PublisherId(MoveTemp(src.PublisherId)),
+            PushNotificationRegistrations(MoveTemp(src.PushNotificationRegistrations)),
+            Statistics(MoveTemp(src.Statistics)),
+            Tags(MoveTemp(src.Tags)),
+            TitleId(MoveTemp(src.TitleId)),
+            TotalValueToDateInUSD(MoveTemp(src.TotalValueToDateInUSD)),
+            ValuesToDate(MoveTemp(src.ValuesToDate)),
+            VirtualCurrencyBalances(MoveTemp(src.VirtualCurrencyBalances))
+            {}
+
+        FPlayerProfile& operator=(const FPlayerProfile& src) = default;
+        FPlayerProfile& operator=(FPlayerProfile&& src) = default;
+
         FPlayerProfile(const TSharedPtr<FJsonObject>& obj) : FPlayerProfile()
         {
             readFromValue(obj);
@@ -5866,7 +8068,13 @@ namespace ServerModels
         ~FPlayerProfile();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayersInSegmentResult : public PlayFab::FPlayFabCppResultCommon
@@ -5893,6 +8101,16 @@ namespace ServerModels
             ProfilesInSegment(src.ProfilesInSegment)
             {}
 
+        FGetPlayersInSegmentResult(FGetPlayersInSegmentResult&& src) :
+            FPlayFabCppResultCommon(),
+            ContinuationToken(MoveTemp(src.ContinuationToken)),
+            PlayerProfiles(MoveTemp(src.PlayerProfiles)),
+            ProfilesInSegment(MoveTemp(src.ProfilesInSegment))
+            {}
+
+        FGetPlayersInSegmentResult& operator=(const FGetPlayersInSegmentResult& src) = default;
+        FGetPlayersInSegmentResult& operator=(FGetPlayersInSegmentResult&& src) = default;
+
         FGetPlayersInSegmentResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayersInSegmentResult()
         {
             readFromValue(obj);
@@ -5901,7 +8119,13 @@ namespace ServerModels
         ~FGetPlayersInSegmentResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayersSegmentsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5923,6 +8147,15 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetPlayersSegmentsRequest(FGetPlayersSegmentsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetPlayersSegmentsRequest& operator=(const FGetPlayersSegmentsRequest& src) = default;
+        FGetPlayersSegmentsRequest& operator=(FGetPlayersSegmentsRequest&& src) = default;
+
         FGetPlayersSegmentsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayersSegmentsRequest()
         {
             readFromValue(obj);
@@ -5931,7 +8164,13 @@ namespace ServerModels
         ~FGetPlayersSegmentsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStatisticNameVersion : public PlayFab::FPlayFabCppBaseModel
@@ -5954,6 +8193,15 @@ namespace ServerModels
             Version(src.Version)
             {}
 
+        FStatisticNameVersion(FStatisticNameVersion&& src) :
+            FPlayFabCppBaseModel(),
+            StatisticName(MoveTemp(src.StatisticName)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FStatisticNameVersion& operator=(const FStatisticNameVersion& src) = default;
+        FStatisticNameVersion& operator=(FStatisticNameVersion&& src) = default;
+
         FStatisticNameVersion(const TSharedPtr<FJsonObject>& obj) : FStatisticNameVersion()
         {
             readFromValue(obj);
@@ -5962,7 +8210,13 @@ namespace ServerModels
         ~FStatisticNameVersion();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -5995,6 +8249,17 @@ namespace ServerModels
             StatisticNameVersions(src.StatisticNameVersions)
             {}
 
+        FGetPlayerStatisticsRequest(FGetPlayerStatisticsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            StatisticNames(MoveTemp(src.StatisticNames)),
+            StatisticNameVersions(MoveTemp(src.StatisticNameVersions))
+            {}
+
+        FGetPlayerStatisticsRequest& operator=(const FGetPlayerStatisticsRequest& src) = default;
+        FGetPlayerStatisticsRequest& operator=(FGetPlayerStatisticsRequest&& src) = default;
+
         FGetPlayerStatisticsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerStatisticsRequest()
         {
             readFromValue(obj);
@@ -6003,7 +8268,13 @@ namespace ServerModels
         ~FGetPlayerStatisticsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerStatisticsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6025,6 +8296,15 @@ namespace ServerModels
             Statistics(src.Statistics)
             {}
 
+        FGetPlayerStatisticsResult(FGetPlayerStatisticsResult&& src) :
+            FPlayFabCppResultCommon(),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Statistics(MoveTemp(src.Statistics))
+            {}
+
+        FGetPlayerStatisticsResult& operator=(const FGetPlayerStatisticsResult& src) = default;
+        FGetPlayerStatisticsResult& operator=(FGetPlayerStatisticsResult&& src) = default;
+
         FGetPlayerStatisticsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerStatisticsResult()
         {
             readFromValue(obj);
@@ -6033,7 +8313,13 @@ namespace ServerModels
         ~FGetPlayerStatisticsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerStatisticVersionsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6055,6 +8341,15 @@ namespace ServerModels
             StatisticName(src.StatisticName)
             {}
 
+        FGetPlayerStatisticVersionsRequest(FGetPlayerStatisticVersionsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            StatisticName(MoveTemp(src.StatisticName))
+            {}
+
+        FGetPlayerStatisticVersionsRequest& operator=(const FGetPlayerStatisticVersionsRequest& src) = default;
+        FGetPlayerStatisticVersionsRequest& operator=(FGetPlayerStatisticVersionsRequest&& src) = default;
+
         FGetPlayerStatisticVersionsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerStatisticVersionsRequest()
         {
             readFromValue(obj);
@@ -6063,7 +8358,13 @@ namespace ServerModels
         ~FGetPlayerStatisticVersionsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPlayerStatisticVersion : public PlayFab::FPlayFabCppBaseModel
@@ -6106,6 +8407,19 @@ namespace ServerModels
             Version(src.Version)
             {}
 
+        FPlayerStatisticVersion(FPlayerStatisticVersion&& src) :
+            FPlayFabCppBaseModel(),
+            ActivationTime(MoveTemp(src.ActivationTime)),
+            DeactivationTime(MoveTemp(src.DeactivationTime)),
+            ScheduledActivationTime(MoveTemp(src.ScheduledActivationTime)),
+            ScheduledDeactivationTime(MoveTemp(src.ScheduledDeactivationTime)),
+            StatisticName(MoveTemp(src.StatisticName)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FPlayerStatisticVersion& operator=(const FPlayerStatisticVersion& src) = default;
+        FPlayerStatisticVersion& operator=(FPlayerStatisticVersion&& src) = default;
+
         FPlayerStatisticVersion(const TSharedPtr<FJsonObject>& obj) : FPlayerStatisticVersion()
         {
             readFromValue(obj);
@@ -6114,7 +8428,13 @@ namespace ServerModels
         ~FPlayerStatisticVersion();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerStatisticVersionsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6131,6 +8451,14 @@ namespace ServerModels
             StatisticVersions(src.StatisticVersions)
             {}
 
+        FGetPlayerStatisticVersionsResult(FGetPlayerStatisticVersionsResult&& src) :
+            FPlayFabCppResultCommon(),
+            StatisticVersions(MoveTemp(src.StatisticVersions))
+            {}
+
+        FGetPlayerStatisticVersionsResult& operator=(const FGetPlayerStatisticVersionsResult& src) = default;
+        FGetPlayerStatisticVersionsResult& operator=(FGetPlayerStatisticVersionsResult&& src) = default;
+
         FGetPlayerStatisticVersionsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerStatisticVersionsResult()
         {
             readFromValue(obj);
@@ -6139,7 +8467,13 @@ namespace ServerModels
         ~FGetPlayerStatisticVersionsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerTagsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6166,6 +8500,16 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetPlayerTagsRequest(FGetPlayerTagsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Namespace(MoveTemp(src.Namespace)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetPlayerTagsRequest& operator=(const FGetPlayerTagsRequest& src) = default;
+        FGetPlayerTagsRequest& operator=(FGetPlayerTagsRequest&& src) = default;
+
         FGetPlayerTagsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayerTagsRequest()
         {
             readFromValue(obj);
@@ -6174,7 +8518,13 @@ namespace ServerModels
         ~FGetPlayerTagsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayerTagsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6196,6 +8546,15 @@ namespace ServerModels
             Tags(src.Tags)
             {}
 
+        FGetPlayerTagsResult(FGetPlayerTagsResult&& src) :
+            FPlayFabCppResultCommon(),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Tags(MoveTemp(src.Tags))
+            {}
+
+        FGetPlayerTagsResult& operator=(const FGetPlayerTagsResult& src) = default;
+        FGetPlayerTagsResult& operator=(FGetPlayerTagsResult&& src) = default;
+
         FGetPlayerTagsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayerTagsResult()
         {
             readFromValue(obj);
@@ -6204,7 +8563,13 @@ namespace ServerModels
         ~FGetPlayerTagsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromFacebookIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6221,6 +8586,14 @@ namespace ServerModels
             FacebookIDs(src.FacebookIDs)
             {}
 
+        FGetPlayFabIDsFromFacebookIDsRequest(FGetPlayFabIDsFromFacebookIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            FacebookIDs(MoveTemp(src.FacebookIDs))
+            {}
+
+        FGetPlayFabIDsFromFacebookIDsRequest& operator=(const FGetPlayFabIDsFromFacebookIDsRequest& src) = default;
+        FGetPlayFabIDsFromFacebookIDsRequest& operator=(FGetPlayFabIDsFromFacebookIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromFacebookIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromFacebookIDsRequest()
         {
             readFromValue(obj);
@@ -6229,7 +8602,13 @@ namespace ServerModels
         ~FGetPlayFabIDsFromFacebookIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromFacebookIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6246,6 +8625,14 @@ namespace ServerModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromFacebookIDsResult(FGetPlayFabIDsFromFacebookIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromFacebookIDsResult& operator=(const FGetPlayFabIDsFromFacebookIDsResult& src) = default;
+        FGetPlayFabIDsFromFacebookIDsResult& operator=(FGetPlayFabIDsFromFacebookIDsResult&& src) = default;
+
         FGetPlayFabIDsFromFacebookIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromFacebookIDsResult()
         {
             readFromValue(obj);
@@ -6254,7 +8641,13 @@ namespace ServerModels
         ~FGetPlayFabIDsFromFacebookIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromFacebookInstantGamesIdsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6271,6 +8664,14 @@ namespace ServerModels
             FacebookInstantGamesIds(src.FacebookInstantGamesIds)
             {}
 
+        FGetPlayFabIDsFromFacebookInstantGamesIdsRequest(FGetPlayFabIDsFromFacebookInstantGamesIdsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            FacebookInstantGamesIds(MoveTemp(src.FacebookInstantGamesIds))
+            {}
+
+        FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& operator=(const FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& src) = default;
+        FGetPlayFabIDsFromFacebookInstantGamesIdsRequest& operator=(FGetPlayFabIDsFromFacebookInstantGamesIdsRequest&& src) = default;
+
         FGetPlayFabIDsFromFacebookInstantGamesIdsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromFacebookInstantGamesIdsRequest()
         {
             readFromValue(obj);
@@ -6279,7 +8680,13 @@ namespace ServerModels
         ~FGetPlayFabIDsFromFacebookInstantGamesIdsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromFacebookInstantGamesIdsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6296,6 +8703,14 @@ namespace ServerModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromFacebookInstantGamesIdsResult(FGetPlayFabIDsFromFacebookInstantGamesIdsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromFacebookInstantGamesIdsResult& operator=(const FGetPlayFabIDsFromFacebookInstantGamesIdsResult& src) = default;
+        FGetPlayFabIDsFromFacebookInstantGamesIdsResult& operator=(FGetPlayFabIDsFromFacebookInstantGamesIdsResult&& src) = default;
+
         FGetPlayFabIDsFromFacebookInstantGamesIdsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromFacebookInstantGamesIdsResult()
         {
             readFromValue(obj);
@@ -6304,7 +8719,13 @@ namespace ServerModels
         ~FGetPlayFabIDsFromFacebookInstantGamesIdsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromGenericIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6324,6 +8745,14 @@ namespace ServerModels
             GenericIDs(src.GenericIDs)
             {}
 
+        FGetPlayFabIDsFromGenericIDsRequest(FGetPlayFabIDsFromGenericIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            GenericIDs(MoveTemp(src.GenericIDs))
+            {}
+
+        FGetPlayFabIDsFromGenericIDsRequest& operator=(const FGetPlayFabIDsFromGenericIDsRequest& src) = default;
+        FGetPlayFabIDsFromGenericIDsRequest& operator=(FGetPlayFabIDsFromGenericIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromGenericIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromGenericIDsRequest()
         {
             readFromValue(obj);
@@ -6332,7 +8761,13 @@ namespace ServerModels
         ~FGetPlayFabIDsFromGenericIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromGenericIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6349,6 +8784,14 @@ namespace ServerModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromGenericIDsResult(FGetPlayFabIDsFromGenericIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromGenericIDsResult& operator=(const FGetPlayFabIDsFromGenericIDsResult& src) = default;
+        FGetPlayFabIDsFromGenericIDsResult& operator=(FGetPlayFabIDsFromGenericIDsResult&& src) = default;
+
         FGetPlayFabIDsFromGenericIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromGenericIDsResult()
         {
             readFromValue(obj);
@@ -6357,7 +8800,13 @@ namespace ServerModels
         ~FGetPlayFabIDsFromGenericIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6374,6 +8823,14 @@ namespace ServerModels
             NintendoSwitchDeviceIds(src.NintendoSwitchDeviceIds)
             {}
 
+        FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest(FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            NintendoSwitchDeviceIds(MoveTemp(src.NintendoSwitchDeviceIds))
+            {}
+
+        FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& operator=(const FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& src) = default;
+        FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& operator=(FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest&& src) = default;
+
         FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest()
         {
             readFromValue(obj);
@@ -6382,7 +8839,13 @@ namespace ServerModels
         ~FGetPlayFabIDsFromNintendoSwitchDeviceIdsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FNintendoSwitchPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -6405,6 +8868,15 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FNintendoSwitchPlayFabIdPair(FNintendoSwitchPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            NintendoSwitchDeviceId(MoveTemp(src.NintendoSwitchDeviceId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FNintendoSwitchPlayFabIdPair& operator=(const FNintendoSwitchPlayFabIdPair& src) = default;
+        FNintendoSwitchPlayFabIdPair& operator=(FNintendoSwitchPlayFabIdPair&& src) = default;
+
         FNintendoSwitchPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FNintendoSwitchPlayFabIdPair()
         {
             readFromValue(obj);
@@ -6413,7 +8885,13 @@ namespace ServerModels
         ~FNintendoSwitchPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6430,6 +8908,14 @@ namespace ServerModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult(FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult& operator=(const FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult& src) = default;
+        FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult& operator=(FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult&& src) = default;
+
         FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult()
         {
             readFromValue(obj);
@@ -6438,7 +8924,13 @@ namespace ServerModels
         ~FGetPlayFabIDsFromNintendoSwitchDeviceIdsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromPSNAccountIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6460,6 +8952,15 @@ namespace ServerModels
             PSNAccountIDs(src.PSNAccountIDs)
             {}
 
+        FGetPlayFabIDsFromPSNAccountIDsRequest(FGetPlayFabIDsFromPSNAccountIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            IssuerId(MoveTemp(src.IssuerId)),
+            PSNAccountIDs(MoveTemp(src.PSNAccountIDs))
+            {}
+
+        FGetPlayFabIDsFromPSNAccountIDsRequest& operator=(const FGetPlayFabIDsFromPSNAccountIDsRequest& src) = default;
+        FGetPlayFabIDsFromPSNAccountIDsRequest& operator=(FGetPlayFabIDsFromPSNAccountIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromPSNAccountIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromPSNAccountIDsRequest()
         {
             readFromValue(obj);
@@ -6468,7 +8969,13 @@ namespace ServerModels
         ~FGetPlayFabIDsFromPSNAccountIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPSNAccountPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -6491,6 +8998,15 @@ namespace ServerModels
             PSNAccountId(src.PSNAccountId)
             {}
 
+        FPSNAccountPlayFabIdPair(FPSNAccountPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            PSNAccountId(MoveTemp(src.PSNAccountId))
+            {}
+
+        FPSNAccountPlayFabIdPair& operator=(const FPSNAccountPlayFabIdPair& src) = default;
+        FPSNAccountPlayFabIdPair& operator=(FPSNAccountPlayFabIdPair&& src) = default;
+
         FPSNAccountPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FPSNAccountPlayFabIdPair()
         {
             readFromValue(obj);
@@ -6499,7 +9015,13 @@ namespace ServerModels
         ~FPSNAccountPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromPSNAccountIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6516,6 +9038,14 @@ namespace ServerModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromPSNAccountIDsResult(FGetPlayFabIDsFromPSNAccountIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromPSNAccountIDsResult& operator=(const FGetPlayFabIDsFromPSNAccountIDsResult& src) = default;
+        FGetPlayFabIDsFromPSNAccountIDsResult& operator=(FGetPlayFabIDsFromPSNAccountIDsResult&& src) = default;
+
         FGetPlayFabIDsFromPSNAccountIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromPSNAccountIDsResult()
         {
             readFromValue(obj);
@@ -6524,7 +9054,13 @@ namespace ServerModels
         ~FGetPlayFabIDsFromPSNAccountIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromSteamIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6541,6 +9077,14 @@ namespace ServerModels
             SteamStringIDs(src.SteamStringIDs)
             {}
 
+        FGetPlayFabIDsFromSteamIDsRequest(FGetPlayFabIDsFromSteamIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            SteamStringIDs(MoveTemp(src.SteamStringIDs))
+            {}
+
+        FGetPlayFabIDsFromSteamIDsRequest& operator=(const FGetPlayFabIDsFromSteamIDsRequest& src) = default;
+        FGetPlayFabIDsFromSteamIDsRequest& operator=(FGetPlayFabIDsFromSteamIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromSteamIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromSteamIDsRequest()
         {
             readFromValue(obj);
@@ -6549,7 +9093,13 @@ namespace ServerModels
         ~FGetPlayFabIDsFromSteamIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSteamPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -6572,6 +9122,15 @@ namespace ServerModels
             SteamStringId(src.SteamStringId)
             {}
 
+        FSteamPlayFabIdPair(FSteamPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            SteamStringId(MoveTemp(src.SteamStringId))
+            {}
+
+        FSteamPlayFabIdPair& operator=(const FSteamPlayFabIdPair& src) = default;
+        FSteamPlayFabIdPair& operator=(FSteamPlayFabIdPair&& src) = default;
+
         FSteamPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FSteamPlayFabIdPair()
         {
             readFromValue(obj);
@@ -6580,7 +9139,13 @@ namespace ServerModels
         ~FSteamPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromSteamIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6597,15 +9162,29 @@ namespace ServerModels
             Data(src.Data)
             {}
 
-        FGetPlayFabIDsFromSteamIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromSteamIDsResult()
-        {
-            readFromValue(obj);
+        FGetPlayFabIDsFromSteamIDsResult(FGetPlayFabIDsFromSteamIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromSteamIDsResult& operator=(const FGetPlayFabIDsFromSteamIDsResult& src) = default;
+        FGetPlayFabIDsFromSteamIDsResult& operator=(FGetPlayFabIDsFromSteamIDsResult&& src) = default;
+
+        FGetPlayFabIDsFromSteamIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromSteamIDsResult()
+        {
+            readFromValue(obj);
         }
 
         ~FGetPlayFabIDsFromSteamIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromXboxLiveIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6627,6 +9206,15 @@ namespace ServerModels
             XboxLiveAccountIDs(src.XboxLiveAccountIDs)
             {}
 
+        FGetPlayFabIDsFromXboxLiveIDsRequest(FGetPlayFabIDsFromXboxLiveIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Sandbox(MoveTemp(src.Sandbox)),
+            XboxLiveAccountIDs(MoveTemp(src.XboxLiveAccountIDs))
+            {}
+
+        FGetPlayFabIDsFromXboxLiveIDsRequest& operator=(const FGetPlayFabIDsFromXboxLiveIDsRequest& src) = default;
+        FGetPlayFabIDsFromXboxLiveIDsRequest& operator=(FGetPlayFabIDsFromXboxLiveIDsRequest&& src) = default;
+
         FGetPlayFabIDsFromXboxLiveIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromXboxLiveIDsRequest()
         {
             readFromValue(obj);
@@ -6635,7 +9223,13 @@ namespace ServerModels
         ~FGetPlayFabIDsFromXboxLiveIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FXboxLiveAccountPlayFabIdPair : public PlayFab::FPlayFabCppBaseModel
@@ -6658,6 +9252,15 @@ namespace ServerModels
             XboxLiveAccountId(src.XboxLiveAccountId)
             {}
 
+        FXboxLiveAccountPlayFabIdPair(FXboxLiveAccountPlayFabIdPair&& src) :
+            FPlayFabCppBaseModel(),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            XboxLiveAccountId(MoveTemp(src.XboxLiveAccountId))
+            {}
+
+        FXboxLiveAccountPlayFabIdPair& operator=(const FXboxLiveAccountPlayFabIdPair& src) = default;
+        FXboxLiveAccountPlayFabIdPair& operator=(FXboxLiveAccountPlayFabIdPair&& src) = default;
+
         FXboxLiveAccountPlayFabIdPair(const TSharedPtr<FJsonObject>& obj) : FXboxLiveAccountPlayFabIdPair()
         {
             readFromValue(obj);
@@ -6666,7 +9269,13 @@ namespace ServerModels
         ~FXboxLiveAccountPlayFabIdPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPlayFabIDsFromXboxLiveIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6683,6 +9292,14 @@ namespace ServerModels
             Data(src.Data)
             {}
 
+        FGetPlayFabIDsFromXboxLiveIDsResult(FGetPlayFabIDsFromXboxLiveIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPlayFabIDsFromXboxLiveIDsResult& operator=(const FGetPlayFabIDsFromXboxLiveIDsResult& src) = default;
+        FGetPlayFabIDsFromXboxLiveIDsResult& operator=(FGetPlayFabIDsFromXboxLiveIDsResult&& src) = default;
+
         FGetPlayFabIDsFromXboxLiveIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetPlayFabIDsFromXboxLiveIDsResult()
         {
             readFromValue(obj);
@@ -6691,7 +9308,13 @@ namespace ServerModels
         ~FGetPlayFabIDsFromXboxLiveIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPublisherDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6708,6 +9331,14 @@ namespace ServerModels
             Keys(src.Keys)
             {}
 
+        FGetPublisherDataRequest(FGetPublisherDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Keys(MoveTemp(src.Keys))
+            {}
+
+        FGetPublisherDataRequest& operator=(const FGetPublisherDataRequest& src) = default;
+        FGetPublisherDataRequest& operator=(FGetPublisherDataRequest&& src) = default;
+
         FGetPublisherDataRequest(const TSharedPtr<FJsonObject>& obj) : FGetPublisherDataRequest()
         {
             readFromValue(obj);
@@ -6716,7 +9347,13 @@ namespace ServerModels
         ~FGetPublisherDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetPublisherDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -6733,6 +9370,14 @@ namespace ServerModels
             Data(src.Data)
             {}
 
+        FGetPublisherDataResult(FGetPublisherDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetPublisherDataResult& operator=(const FGetPublisherDataResult& src) = default;
+        FGetPublisherDataResult& operator=(FGetPublisherDataResult&& src) = default;
+
         FGetPublisherDataResult(const TSharedPtr<FJsonObject>& obj) : FGetPublisherDataResult()
         {
             readFromValue(obj);
@@ -6741,7 +9386,13 @@ namespace ServerModels
         ~FGetPublisherDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetRandomResultTablesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6766,6 +9417,15 @@ namespace ServerModels
             TableIDs(src.TableIDs)
             {}
 
+        FGetRandomResultTablesRequest(FGetRandomResultTablesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            TableIDs(MoveTemp(src.TableIDs))
+            {}
+
+        FGetRandomResultTablesRequest& operator=(const FGetRandomResultTablesRequest& src) = default;
+        FGetRandomResultTablesRequest& operator=(FGetRandomResultTablesRequest&& src) = default;
+
         FGetRandomResultTablesRequest(const TSharedPtr<FJsonObject>& obj) : FGetRandomResultTablesRequest()
         {
             readFromValue(obj);
@@ -6774,7 +9434,13 @@ namespace ServerModels
         ~FGetRandomResultTablesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum ResultTableNodeType
@@ -6784,6 +9450,7 @@ namespace ServerModels
     };
 
     PLAYFABCPP_API void writeResultTableNodeTypeEnumJSON(ResultTableNodeType enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeResultTableNodeTypeEnumJSON(ResultTableNodeType enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API ResultTableNodeType readResultTableNodeTypeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API ResultTableNodeType readResultTableNodeTypeFromValue(const FString& value);
 
@@ -6812,6 +9479,16 @@ namespace ServerModels
             Weight(src.Weight)
             {}
 
+        FResultTableNode(FResultTableNode&& src) :
+            FPlayFabCppBaseModel(),
+            ResultItem(MoveTemp(src.ResultItem)),
+            ResultItemType(MoveTemp(src.ResultItemType)),
+            Weight(MoveTemp(src.Weight))
+            {}
+
+        FResultTableNode& operator=(const FResultTableNode& src) = default;
+        FResultTableNode& operator=(FResultTableNode&& src) = default;
+
         FResultTableNode(const TSharedPtr<FJsonObject>& obj) : FResultTableNode()
         {
             readFromValue(obj);
@@ -6820,7 +9497,13 @@ namespace ServerModels
         ~FResultTableNode();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRandomResultTableListing : public PlayFab::FPlayFabCppBaseModel
@@ -6847,6 +9530,16 @@ namespace ServerModels
             TableId(src.TableId)
             {}
 
+        FRandomResultTableListing(FRandomResultTableListing&& src) :
+            FPlayFabCppBaseModel(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            Nodes(MoveTemp(src.Nodes)),
+            TableId(MoveTemp(src.TableId))
+            {}
+
+        FRandomResultTableListing& operator=(const FRandomResultTableListing& src) = default;
+        FRandomResultTableListing& operator=(FRandomResultTableListing&& src) = default;
+
         FRandomResultTableListing(const TSharedPtr<FJsonObject>& obj) : FRandomResultTableListing()
         {
             readFromValue(obj);
@@ -6855,7 +9548,13 @@ namespace ServerModels
         ~FRandomResultTableListing();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetRandomResultTablesResult : public PlayFab::FPlayFabCppResultCommon
@@ -6872,6 +9571,14 @@ namespace ServerModels
             Tables(src.Tables)
             {}
 
+        FGetRandomResultTablesResult(FGetRandomResultTablesResult&& src) :
+            FPlayFabCppResultCommon(),
+            Tables(MoveTemp(src.Tables))
+            {}
+
+        FGetRandomResultTablesResult& operator=(const FGetRandomResultTablesResult& src) = default;
+        FGetRandomResultTablesResult& operator=(FGetRandomResultTablesResult&& src) = default;
+
         FGetRandomResultTablesResult(const TSharedPtr<FJsonObject>& obj) : FGetRandomResultTablesResult()
         {
             readFromValue(obj);
@@ -6880,7 +9587,13 @@ namespace ServerModels
         ~FGetRandomResultTablesResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetServerCustomIDsFromPlayFabIDsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6900,6 +9613,14 @@ namespace ServerModels
             PlayFabIDs(src.PlayFabIDs)
             {}
 
+        FGetServerCustomIDsFromPlayFabIDsRequest(FGetServerCustomIDsFromPlayFabIDsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabIDs(MoveTemp(src.PlayFabIDs))
+            {}
+
+        FGetServerCustomIDsFromPlayFabIDsRequest& operator=(const FGetServerCustomIDsFromPlayFabIDsRequest& src) = default;
+        FGetServerCustomIDsFromPlayFabIDsRequest& operator=(FGetServerCustomIDsFromPlayFabIDsRequest&& src) = default;
+
         FGetServerCustomIDsFromPlayFabIDsRequest(const TSharedPtr<FJsonObject>& obj) : FGetServerCustomIDsFromPlayFabIDsRequest()
         {
             readFromValue(obj);
@@ -6908,7 +9629,13 @@ namespace ServerModels
         ~FGetServerCustomIDsFromPlayFabIDsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FServerCustomIDPlayFabIDPair : public PlayFab::FPlayFabCppBaseModel
@@ -6931,6 +9658,15 @@ namespace ServerModels
             ServerCustomId(src.ServerCustomId)
             {}
 
+        FServerCustomIDPlayFabIDPair(FServerCustomIDPlayFabIDPair&& src) :
+            FPlayFabCppBaseModel(),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            ServerCustomId(MoveTemp(src.ServerCustomId))
+            {}
+
+        FServerCustomIDPlayFabIDPair& operator=(const FServerCustomIDPlayFabIDPair& src) = default;
+        FServerCustomIDPlayFabIDPair& operator=(FServerCustomIDPlayFabIDPair&& src) = default;
+
         FServerCustomIDPlayFabIDPair(const TSharedPtr<FJsonObject>& obj) : FServerCustomIDPlayFabIDPair()
         {
             readFromValue(obj);
@@ -6939,7 +9675,13 @@ namespace ServerModels
         ~FServerCustomIDPlayFabIDPair();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetServerCustomIDsFromPlayFabIDsResult : public PlayFab::FPlayFabCppResultCommon
@@ -6956,6 +9698,14 @@ namespace ServerModels
             Data(src.Data)
             {}
 
+        FGetServerCustomIDsFromPlayFabIDsResult(FGetServerCustomIDsFromPlayFabIDsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetServerCustomIDsFromPlayFabIDsResult& operator=(const FGetServerCustomIDsFromPlayFabIDsResult& src) = default;
+        FGetServerCustomIDsFromPlayFabIDsResult& operator=(FGetServerCustomIDsFromPlayFabIDsResult&& src) = default;
+
         FGetServerCustomIDsFromPlayFabIDsResult(const TSharedPtr<FJsonObject>& obj) : FGetServerCustomIDsFromPlayFabIDsResult()
         {
             readFromValue(obj);
@@ -6964,7 +9714,13 @@ namespace ServerModels
         ~FGetServerCustomIDsFromPlayFabIDsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetSharedGroupDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -6994,6 +9750,16 @@ namespace ServerModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FGetSharedGroupDataRequest(FGetSharedGroupDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            GetMembers(MoveTemp(src.GetMembers)),
+            Keys(MoveTemp(src.Keys)),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FGetSharedGroupDataRequest& operator=(const FGetSharedGroupDataRequest& src) = default;
+        FGetSharedGroupDataRequest& operator=(FGetSharedGroupDataRequest&& src) = default;
+
         FGetSharedGroupDataRequest(const TSharedPtr<FJsonObject>& obj) : FGetSharedGroupDataRequest()
         {
             readFromValue(obj);
@@ -7002,7 +9768,13 @@ namespace ServerModels
         ~FGetSharedGroupDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSharedGroupDataRecord : public PlayFab::FPlayFabCppBaseModel
@@ -7035,6 +9807,17 @@ namespace ServerModels
             Value(src.Value)
             {}
 
+        FSharedGroupDataRecord(FSharedGroupDataRecord&& src) :
+            FPlayFabCppBaseModel(),
+            LastUpdated(MoveTemp(src.LastUpdated)),
+            LastUpdatedBy(MoveTemp(src.LastUpdatedBy)),
+            Permission(MoveTemp(src.Permission)),
+            Value(MoveTemp(src.Value))
+            {}
+
+        FSharedGroupDataRecord& operator=(const FSharedGroupDataRecord& src) = default;
+        FSharedGroupDataRecord& operator=(FSharedGroupDataRecord&& src) = default;
+
         FSharedGroupDataRecord(const TSharedPtr<FJsonObject>& obj) : FSharedGroupDataRecord()
         {
             readFromValue(obj);
@@ -7043,7 +9826,13 @@ namespace ServerModels
         ~FSharedGroupDataRecord();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetSharedGroupDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -7064,6 +9853,15 @@ namespace ServerModels
             Members(src.Members)
             {}
 
+        FGetSharedGroupDataResult(FGetSharedGroupDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data)),
+            Members(MoveTemp(src.Members))
+            {}
+
+        FGetSharedGroupDataResult& operator=(const FGetSharedGroupDataResult& src) = default;
+        FGetSharedGroupDataResult& operator=(FGetSharedGroupDataResult&& src) = default;
+
         FGetSharedGroupDataResult(const TSharedPtr<FJsonObject>& obj) : FGetSharedGroupDataResult()
         {
             readFromValue(obj);
@@ -7072,7 +9870,13 @@ namespace ServerModels
         ~FGetSharedGroupDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStoreMarketingModel : public PlayFab::FPlayFabCppBaseModel
@@ -7100,6 +9904,16 @@ namespace ServerModels
             Metadata(src.Metadata)
             {}
 
+        FStoreMarketingModel(FStoreMarketingModel&& src) :
+            FPlayFabCppBaseModel(),
+            Description(MoveTemp(src.Description)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            Metadata(MoveTemp(src.Metadata))
+            {}
+
+        FStoreMarketingModel& operator=(const FStoreMarketingModel& src) = default;
+        FStoreMarketingModel& operator=(FStoreMarketingModel&& src) = default;
+
         FStoreMarketingModel(const TSharedPtr<FJsonObject>& obj) : FStoreMarketingModel()
         {
             readFromValue(obj);
@@ -7108,7 +9922,13 @@ namespace ServerModels
         ~FStoreMarketingModel();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum SourceType
@@ -7123,6 +9943,7 @@ namespace ServerModels
     };
 
     PLAYFABCPP_API void writeSourceTypeEnumJSON(SourceType enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeSourceTypeEnumJSON(SourceType enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API SourceType readSourceTypeFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API SourceType readSourceTypeFromValue(const FString& value);
 
@@ -7162,6 +9983,18 @@ namespace ServerModels
             VirtualCurrencyPrices(src.VirtualCurrencyPrices)
             {}
 
+        FStoreItem(FStoreItem&& src) :
+            FPlayFabCppBaseModel(),
+            CustomData(MoveTemp(src.CustomData)),
+            DisplayPosition(MoveTemp(src.DisplayPosition)),
+            ItemId(MoveTemp(src.ItemId)),
+            RealCurrencyPrices(MoveTemp(src.RealCurrencyPrices)),
+            VirtualCurrencyPrices(MoveTemp(src.VirtualCurrencyPrices))
+            {}
+
+        FStoreItem& operator=(const FStoreItem& src) = default;
+        FStoreItem& operator=(FStoreItem&& src) = default;
+
         FStoreItem(const TSharedPtr<FJsonObject>& obj) : FStoreItem()
         {
             readFromValue(obj);
@@ -7170,7 +10003,13 @@ namespace ServerModels
         ~FStoreItem();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetStoreItemsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7201,12 +10040,24 @@ namespace ServerModels
         FGetStoreItemsResult(const FGetStoreItemsResult& src) :
             FPlayFabCppResultCommon(),
             CatalogVersion(src.CatalogVersion),
-            MarketingData(src.MarketingData.IsValid() ? MakeShareable(new FStoreMarketingModel(*src.MarketingData)) : nullptr),
+            MarketingData(src.MarketingData.IsValid() ? TSharedPtr<FStoreMarketingModel>(MakeShared<FStoreMarketingModel>(*src.MarketingData)) : nullptr),
             Source(src.Source),
             Store(src.Store),
             StoreId(src.StoreId)
             {}
 
+        FGetStoreItemsResult(FGetStoreItemsResult&& src) :
+            FPlayFabCppResultCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            MarketingData(MoveTemp(src.MarketingData)),
+            Source(MoveTemp(src.Source)),
+            Store(MoveTemp(src.Store)),
+            StoreId(MoveTemp(src.StoreId))
+            {}
+
+        FGetStoreItemsResult& operator=(const FGetStoreItemsResult& src) = default;
+        FGetStoreItemsResult& operator=(FGetStoreItemsResult&& src) = default;
+
         FGetStoreItemsResult(const TSharedPtr<FJsonObject>& obj) : FGetStoreItemsResult()
         {
             readFromValue(obj);
@@ -7215,7 +10066,13 @@ namespace ServerModels
         ~FGetStoreItemsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetStoreItemsServerRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7250,6 +10107,17 @@ namespace ServerModels
             StoreId(src.StoreId)
             {}
 
+        FGetStoreItemsServerRequest(FGetStoreItemsServerRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            StoreId(MoveTemp(src.StoreId))
+            {}
+
+        FGetStoreItemsServerRequest& operator=(const FGetStoreItemsServerRequest& src) = default;
+        FGetStoreItemsServerRequest& operator=(FGetStoreItemsServerRequest&& src) = default;
+
         FGetStoreItemsServerRequest(const TSharedPtr<FJsonObject>& obj) : FGetStoreItemsServerRequest()
         {
             readFromValue(obj);
@@ -7258,7 +10126,13 @@ namespace ServerModels
         ~FGetStoreItemsServerRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTimeRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7271,6 +10145,13 @@ namespace ServerModels
             FPlayFabCppRequestCommon()
             {}
 
+        FGetTimeRequest(FGetTimeRequest&& src) :
+            FPlayFabCppRequestCommon()
+            {}
+
+        FGetTimeRequest& operator=(const FGetTimeRequest& src) = default;
+        FGetTimeRequest& operator=(FGetTimeRequest&& src) = default;
+
         FGetTimeRequest(const TSharedPtr<FJsonObject>& obj) : FGetTimeRequest()
         {
             readFromValue(obj);
@@ -7279,7 +10160,13 @@ namespace ServerModels
         ~FGetTimeRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTimeResult : public PlayFab::FPlayFabCppResultCommon
@@ -7297,6 +10184,14 @@ namespace ServerModels
             Time(src.Time)
             {}
 
+        FGetTimeResult(FGetTimeResult&& src) :
+            FPlayFabCppResultCommon(),
+            Time(MoveTemp(src.Time))
+            {}
+
+        FGetTimeResult& operator=(const FGetTimeResult& src) = default;
+        FGetTimeResult& operator=(FGetTimeResult&& src) = default;
+
         FGetTimeResult(const TSharedPtr<FJsonObject>& obj) : FGetTimeResult()
         {
             readFromValue(obj);
@@ -7305,7 +10200,13 @@ namespace ServerModels
         ~FGetTimeResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7330,6 +10231,15 @@ namespace ServerModels
             OverrideLabel(src.OverrideLabel)
             {}
 
+        FGetTitleDataRequest(FGetTitleDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Keys(MoveTemp(src.Keys)),
+            OverrideLabel(MoveTemp(src.OverrideLabel))
+            {}
+
+        FGetTitleDataRequest& operator=(const FGetTitleDataRequest& src) = default;
+        FGetTitleDataRequest& operator=(FGetTitleDataRequest&& src) = default;
+
         FGetTitleDataRequest(const TSharedPtr<FJsonObject>& obj) : FGetTitleDataRequest()
         {
             readFromValue(obj);
@@ -7338,7 +10248,13 @@ namespace ServerModels
         ~FGetTitleDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -7355,6 +10271,14 @@ namespace ServerModels
             Data(src.Data)
             {}
 
+        FGetTitleDataResult(FGetTitleDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data))
+            {}
+
+        FGetTitleDataResult& operator=(const FGetTitleDataResult& src) = default;
+        FGetTitleDataResult& operator=(FGetTitleDataResult&& src) = default;
+
         FGetTitleDataResult(const TSharedPtr<FJsonObject>& obj) : FGetTitleDataResult()
         {
             readFromValue(obj);
@@ -7363,7 +10287,13 @@ namespace ServerModels
         ~FGetTitleDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleNewsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7381,6 +10311,14 @@ namespace ServerModels
             Count(src.Count)
             {}
 
+        FGetTitleNewsRequest(FGetTitleNewsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Count(MoveTemp(src.Count))
+            {}
+
+        FGetTitleNewsRequest& operator=(const FGetTitleNewsRequest& src) = default;
+        FGetTitleNewsRequest& operator=(FGetTitleNewsRequest&& src) = default;
+
         FGetTitleNewsRequest(const TSharedPtr<FJsonObject>& obj) : FGetTitleNewsRequest()
         {
             readFromValue(obj);
@@ -7389,7 +10327,13 @@ namespace ServerModels
         ~FGetTitleNewsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FTitleNewsItem : public PlayFab::FPlayFabCppBaseModel
@@ -7422,6 +10366,17 @@ namespace ServerModels
             Title(src.Title)
             {}
 
+        FTitleNewsItem(FTitleNewsItem&& src) :
+            FPlayFabCppBaseModel(),
+            Body(MoveTemp(src.Body)),
+            NewsId(MoveTemp(src.NewsId)),
+            Timestamp(MoveTemp(src.Timestamp)),
+            Title(MoveTemp(src.Title))
+            {}
+
+        FTitleNewsItem& operator=(const FTitleNewsItem& src) = default;
+        FTitleNewsItem& operator=(FTitleNewsItem&& src) = default;
+
         FTitleNewsItem(const TSharedPtr<FJsonObject>& obj) : FTitleNewsItem()
         {
             readFromValue(obj);
@@ -7430,7 +10385,13 @@ namespace ServerModels
         ~FTitleNewsItem();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetTitleNewsResult : public PlayFab::FPlayFabCppResultCommon
@@ -7447,6 +10408,14 @@ namespace ServerModels
             News(src.News)
             {}
 
+        FGetTitleNewsResult(FGetTitleNewsResult&& src) :
+            FPlayFabCppResultCommon(),
+            News(MoveTemp(src.News))
+            {}
+
+        FGetTitleNewsResult& operator=(const FGetTitleNewsResult& src) = default;
+        FGetTitleNewsResult& operator=(FGetTitleNewsResult&& src) = default;
+
         FGetTitleNewsResult(const TSharedPtr<FJsonObject>& obj) : FGetTitleNewsResult()
         {
             readFromValue(obj);
@@ -7455,7 +10424,13 @@ namespace ServerModels
         ~FGetTitleNewsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserAccountInfoRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7473,6 +10448,14 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetUserAccountInfoRequest(FGetUserAccountInfoRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetUserAccountInfoRequest& operator=(const FGetUserAccountInfoRequest& src) = default;
+        FGetUserAccountInfoRequest& operator=(FGetUserAccountInfoRequest&& src) = default;
+
         FGetUserAccountInfoRequest(const TSharedPtr<FJsonObject>& obj) : FGetUserAccountInfoRequest()
         {
             readFromValue(obj);
@@ -7481,7 +10464,13 @@ namespace ServerModels
         ~FGetUserAccountInfoRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserAccountInfoResult : public PlayFab::FPlayFabCppResultCommon
@@ -7496,9 +10485,17 @@ namespace ServerModels
 
         FGetUserAccountInfoResult(const FGetUserAccountInfoResult& src) :
             FPlayFabCppResultCommon(),
-            UserInfo(src.UserInfo.IsValid() ? MakeShareable(new FUserAccountInfo(*src.UserInfo)) : nullptr)
+            UserInfo(src.UserInfo.IsValid() ? TSharedPtr<FUserAccountInfo>(MakeShared<FUserAccountInfo>(*src.UserInfo)) : nullptr)
+            {}
+
+        FGetUserAccountInfoResult(FGetUserAccountInfoResult&& src) :
+            FPlayFabCppResultCommon(),
+            UserInfo(MoveTemp(src.UserInfo))
             {}
 
+        FGetUserAccountInfoResult& operator=(const FGetUserAccountInfoResult& src) = default;
+        FGetUserAccountInfoResult& operator=(FGetUserAccountInfoResult&& src) = default;
+
         FGetUserAccountInfoResult(const TSharedPtr<FJsonObject>& obj) : FGetUserAccountInfoResult()
         {
             readFromValue(obj);
@@ -7507,7 +10504,13 @@ namespace ServerModels
         ~FGetUserAccountInfoResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserBansRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7525,6 +10528,14 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetUserBansRequest(FGetUserBansRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetUserBansRequest& operator=(const FGetUserBansRequest& src) = default;
+        FGetUserBansRequest& operator=(FGetUserBansRequest&& src) = default;
+
         FGetUserBansRequest(const TSharedPtr<FJsonObject>& obj) : FGetUserBansRequest()
         {
             readFromValue(obj);
@@ -7533,7 +10544,13 @@ namespace ServerModels
         ~FGetUserBansRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserBansResult : public PlayFab::FPlayFabCppResultCommon
@@ -7550,6 +10567,14 @@ namespace ServerModels
             BanData(src.BanData)
             {}
 
+        FGetUserBansResult(FGetUserBansResult&& src) :
+            FPlayFabCppResultCommon(),
+            BanData(MoveTemp(src.BanData))
+            {}
+
+        FGetUserBansResult& operator=(const FGetUserBansResult& src) = default;
+        FGetUserBansResult& operator=(FGetUserBansResult&& src) = default;
+
         FGetUserBansResult(const TSharedPtr<FJsonObject>& obj) : FGetUserBansResult()
         {
             readFromValue(obj);
@@ -7558,7 +10583,13 @@ namespace ServerModels
         ~FGetUserBansResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7588,6 +10619,16 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetUserDataRequest(FGetUserDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            IfChangedFromDataVersion(MoveTemp(src.IfChangedFromDataVersion)),
+            Keys(MoveTemp(src.Keys)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetUserDataRequest& operator=(const FGetUserDataRequest& src) = default;
+        FGetUserDataRequest& operator=(FGetUserDataRequest&& src) = default;
+
         FGetUserDataRequest(const TSharedPtr<FJsonObject>& obj) : FGetUserDataRequest()
         {
             readFromValue(obj);
@@ -7596,7 +10637,13 @@ namespace ServerModels
         ~FGetUserDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -7626,6 +10673,16 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetUserDataResult(FGetUserDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            Data(MoveTemp(src.Data)),
+            DataVersion(MoveTemp(src.DataVersion)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetUserDataResult& operator=(const FGetUserDataResult& src) = default;
+        FGetUserDataResult& operator=(FGetUserDataResult&& src) = default;
+
         FGetUserDataResult(const TSharedPtr<FJsonObject>& obj) : FGetUserDataResult()
         {
             readFromValue(obj);
@@ -7634,7 +10691,13 @@ namespace ServerModels
         ~FGetUserDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserInventoryRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7656,6 +10719,15 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGetUserInventoryRequest(FGetUserInventoryRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGetUserInventoryRequest& operator=(const FGetUserInventoryRequest& src) = default;
+        FGetUserInventoryRequest& operator=(FGetUserInventoryRequest&& src) = default;
+
         FGetUserInventoryRequest(const TSharedPtr<FJsonObject>& obj) : FGetUserInventoryRequest()
         {
             readFromValue(obj);
@@ -7664,7 +10736,13 @@ namespace ServerModels
         ~FGetUserInventoryRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGetUserInventoryResult : public PlayFab::FPlayFabCppResultCommon
@@ -7694,6 +10772,17 @@ namespace ServerModels
             VirtualCurrencyRechargeTimes(src.VirtualCurrencyRechargeTimes)
             {}
 
+        FGetUserInventoryResult(FGetUserInventoryResult&& src) :
+            FPlayFabCppResultCommon(),
+            Inventory(MoveTemp(src.Inventory)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency)),
+            VirtualCurrencyRechargeTimes(MoveTemp(src.VirtualCurrencyRechargeTimes))
+            {}
+
+        FGetUserInventoryResult& operator=(const FGetUserInventoryResult& src) = default;
+        FGetUserInventoryResult& operator=(FGetUserInventoryResult&& src) = default;
+
         FGetUserInventoryResult(const TSharedPtr<FJsonObject>& obj) : FGetUserInventoryResult()
         {
             readFromValue(obj);
@@ -7702,7 +10791,13 @@ namespace ServerModels
         ~FGetUserInventoryResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGrantCharacterToUserRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7734,6 +10829,17 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGrantCharacterToUserRequest(FGrantCharacterToUserRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterName(MoveTemp(src.CharacterName)),
+            CharacterType(MoveTemp(src.CharacterType)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGrantCharacterToUserRequest& operator=(const FGrantCharacterToUserRequest& src) = default;
+        FGrantCharacterToUserRequest& operator=(FGrantCharacterToUserRequest&& src) = default;
+
         FGrantCharacterToUserRequest(const TSharedPtr<FJsonObject>& obj) : FGrantCharacterToUserRequest()
         {
             readFromValue(obj);
@@ -7742,7 +10848,13 @@ namespace ServerModels
         ~FGrantCharacterToUserRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGrantCharacterToUserResult : public PlayFab::FPlayFabCppResultCommon
@@ -7760,6 +10872,14 @@ namespace ServerModels
             CharacterId(src.CharacterId)
             {}
 
+        FGrantCharacterToUserResult(FGrantCharacterToUserResult&& src) :
+            FPlayFabCppResultCommon(),
+            CharacterId(MoveTemp(src.CharacterId))
+            {}
+
+        FGrantCharacterToUserResult& operator=(const FGrantCharacterToUserResult& src) = default;
+        FGrantCharacterToUserResult& operator=(FGrantCharacterToUserResult&& src) = default;
+
         FGrantCharacterToUserResult(const TSharedPtr<FJsonObject>& obj) : FGrantCharacterToUserResult()
         {
             readFromValue(obj);
@@ -7768,7 +10888,13 @@ namespace ServerModels
         ~FGrantCharacterToUserResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGrantedItemInstance : public PlayFab::FPlayFabCppBaseModel
@@ -7875,6 +11001,31 @@ namespace ServerModels
             UsesIncrementedBy(src.UsesIncrementedBy)
             {}
 
+        FGrantedItemInstance(FGrantedItemInstance&& src) :
+            FPlayFabCppBaseModel(),
+            Annotation(MoveTemp(src.Annotation)),
+            BundleContents(MoveTemp(src.BundleContents)),
+            BundleParent(MoveTemp(src.BundleParent)),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomData(MoveTemp(src.CustomData)),
+            DisplayName(MoveTemp(src.DisplayName)),
+            Expiration(MoveTemp(src.Expiration)),
+            ItemClass(MoveTemp(src.ItemClass)),
+            ItemId(MoveTemp(src.ItemId)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            PurchaseDate(MoveTemp(src.PurchaseDate)),
+            RemainingUses(MoveTemp(src.RemainingUses)),
+            Result(MoveTemp(src.Result)),
+            UnitCurrency(MoveTemp(src.UnitCurrency)),
+            UnitPrice(MoveTemp(src.UnitPrice)),
+            UsesIncrementedBy(MoveTemp(src.UsesIncrementedBy))
+            {}
+
+        FGrantedItemInstance& operator=(const FGrantedItemInstance& src) = default;
+        FGrantedItemInstance& operator=(FGrantedItemInstance&& src) = default;
+
         FGrantedItemInstance(const TSharedPtr<FJsonObject>& obj) : FGrantedItemInstance()
         {
             readFromValue(obj);
@@ -7883,7 +11034,13 @@ namespace ServerModels
         ~FGrantedItemInstance();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGrantItemsToCharacterRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7924,6 +11081,19 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGrantItemsToCharacterRequest(FGrantItemsToCharacterRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Annotation(MoveTemp(src.Annotation)),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ItemIds(MoveTemp(src.ItemIds)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGrantItemsToCharacterRequest& operator=(const FGrantItemsToCharacterRequest& src) = default;
+        FGrantItemsToCharacterRequest& operator=(FGrantItemsToCharacterRequest&& src) = default;
+
         FGrantItemsToCharacterRequest(const TSharedPtr<FJsonObject>& obj) : FGrantItemsToCharacterRequest()
         {
             readFromValue(obj);
@@ -7932,7 +11102,13 @@ namespace ServerModels
         ~FGrantItemsToCharacterRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGrantItemsToCharacterResult : public PlayFab::FPlayFabCppResultCommon
@@ -7949,6 +11125,14 @@ namespace ServerModels
             ItemGrantResults(src.ItemGrantResults)
             {}
 
+        FGrantItemsToCharacterResult(FGrantItemsToCharacterResult&& src) :
+            FPlayFabCppResultCommon(),
+            ItemGrantResults(MoveTemp(src.ItemGrantResults))
+            {}
+
+        FGrantItemsToCharacterResult& operator=(const FGrantItemsToCharacterResult& src) = default;
+        FGrantItemsToCharacterResult& operator=(FGrantItemsToCharacterResult&& src) = default;
+
         FGrantItemsToCharacterResult(const TSharedPtr<FJsonObject>& obj) : FGrantItemsToCharacterResult()
         {
             readFromValue(obj);
@@ -7957,7 +11141,13 @@ namespace ServerModels
         ~FGrantItemsToCharacterResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGrantItemsToUserRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -7993,6 +11183,18 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FGrantItemsToUserRequest(FGrantItemsToUserRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Annotation(MoveTemp(src.Annotation)),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ItemIds(MoveTemp(src.ItemIds)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FGrantItemsToUserRequest& operator=(const FGrantItemsToUserRequest& src) = default;
+        FGrantItemsToUserRequest& operator=(FGrantItemsToUserRequest&& src) = default;
+
         FGrantItemsToUserRequest(const TSharedPtr<FJsonObject>& obj) : FGrantItemsToUserRequest()
         {
             readFromValue(obj);
@@ -8001,7 +11203,13 @@ namespace ServerModels
         ~FGrantItemsToUserRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGrantItemsToUserResult : public PlayFab::FPlayFabCppResultCommon
@@ -8018,6 +11226,14 @@ namespace ServerModels
             ItemGrantResults(src.ItemGrantResults)
             {}
 
+        FGrantItemsToUserResult(FGrantItemsToUserResult&& src) :
+            FPlayFabCppResultCommon(),
+            ItemGrantResults(MoveTemp(src.ItemGrantResults))
+            {}
+
+        FGrantItemsToUserResult& operator=(const FGrantItemsToUserResult& src) = default;
+        FGrantItemsToUserResult& operator=(FGrantItemsToUserResult&& src) = default;
+
         FGrantItemsToUserResult(const TSharedPtr<FJsonObject>& obj) : FGrantItemsToUserResult()
         {
             readFromValue(obj);
@@ -8026,7 +11242,13 @@ namespace ServerModels
         ~FGrantItemsToUserResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FItemGrant : public PlayFab::FPlayFabCppBaseModel
@@ -8073,6 +11295,19 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FItemGrant(FItemGrant&& src) :
+            FPlayFabCppBaseModel(),
+            Annotation(MoveTemp(src.Annotation)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            Data(MoveTemp(src.Data)),
+            ItemId(MoveTemp(src.ItemId)),
+            KeysToRemove(MoveTemp(src.KeysToRemove)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FItemGrant& operator=(const FItemGrant& src) = default;
+        FItemGrant& operator=(FItemGrant&& src) = default;
+
         FItemGrant(const TSharedPtr<FJsonObject>& obj) : FItemGrant()
         {
             readFromValue(obj);
@@ -8081,7 +11316,13 @@ namespace ServerModels
         ~FItemGrant();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGrantItemsToUsersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8107,6 +11348,16 @@ namespace ServerModels
             ItemGrants(src.ItemGrants)
             {}
 
+        FGrantItemsToUsersRequest(FGrantItemsToUsersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ItemGrants(MoveTemp(src.ItemGrants))
+            {}
+
+        FGrantItemsToUsersRequest& operator=(const FGrantItemsToUsersRequest& src) = default;
+        FGrantItemsToUsersRequest& operator=(FGrantItemsToUsersRequest&& src) = default;
+
         FGrantItemsToUsersRequest(const TSharedPtr<FJsonObject>& obj) : FGrantItemsToUsersRequest()
         {
             readFromValue(obj);
@@ -8115,7 +11366,13 @@ namespace ServerModels
         ~FGrantItemsToUsersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FGrantItemsToUsersResult : public PlayFab::FPlayFabCppResultCommon
@@ -8132,6 +11389,14 @@ namespace ServerModels
             ItemGrantResults(src.ItemGrantResults)
             {}
 
+        FGrantItemsToUsersResult(FGrantItemsToUsersResult&& src) :
+            FPlayFabCppResultCommon(),
+            ItemGrantResults(MoveTemp(src.ItemGrantResults))
+            {}
+
+        FGrantItemsToUsersResult& operator=(const FGrantItemsToUsersResult& src) = default;
+        FGrantItemsToUsersResult& operator=(FGrantItemsToUsersResult&& src) = default;
+
         FGrantItemsToUsersResult(const TSharedPtr<FJsonObject>& obj) : FGrantItemsToUsersResult()
         {
             readFromValue(obj);
@@ -8140,7 +11405,13 @@ namespace ServerModels
         ~FGrantItemsToUsersResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkPSNAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8182,6 +11453,19 @@ namespace ServerModels
             RedirectUri(src.RedirectUri)
             {}
 
+        FLinkPSNAccountRequest(FLinkPSNAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AuthCode(MoveTemp(src.AuthCode)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            IssuerId(MoveTemp(src.IssuerId)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            RedirectUri(MoveTemp(src.RedirectUri))
+            {}
+
+        FLinkPSNAccountRequest& operator=(const FLinkPSNAccountRequest& src) = default;
+        FLinkPSNAccountRequest& operator=(FLinkPSNAccountRequest&& src) = default;
+
         FLinkPSNAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkPSNAccountRequest()
         {
             readFromValue(obj);
@@ -8190,7 +11474,13 @@ namespace ServerModels
         ~FLinkPSNAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkPSNAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -8203,6 +11493,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkPSNAccountResult(FLinkPSNAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkPSNAccountResult& operator=(const FLinkPSNAccountResult& src) = default;
+        FLinkPSNAccountResult& operator=(FLinkPSNAccountResult&& src) = default;
+
         FLinkPSNAccountResult(const TSharedPtr<FJsonObject>& obj) : FLinkPSNAccountResult()
         {
             readFromValue(obj);
@@ -8211,7 +11508,13 @@ namespace ServerModels
         ~FLinkPSNAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkServerCustomIdRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8243,6 +11546,17 @@ namespace ServerModels
             ServerCustomId(src.ServerCustomId)
             {}
 
+        FLinkServerCustomIdRequest(FLinkServerCustomIdRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            ServerCustomId(MoveTemp(src.ServerCustomId))
+            {}
+
+        FLinkServerCustomIdRequest& operator=(const FLinkServerCustomIdRequest& src) = default;
+        FLinkServerCustomIdRequest& operator=(FLinkServerCustomIdRequest&& src) = default;
+
         FLinkServerCustomIdRequest(const TSharedPtr<FJsonObject>& obj) : FLinkServerCustomIdRequest()
         {
             readFromValue(obj);
@@ -8251,7 +11565,13 @@ namespace ServerModels
         ~FLinkServerCustomIdRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkServerCustomIdResult : public PlayFab::FPlayFabCppResultCommon
@@ -8264,6 +11584,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkServerCustomIdResult(FLinkServerCustomIdResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkServerCustomIdResult& operator=(const FLinkServerCustomIdResult& src) = default;
+        FLinkServerCustomIdResult& operator=(FLinkServerCustomIdResult&& src) = default;
+
         FLinkServerCustomIdResult(const TSharedPtr<FJsonObject>& obj) : FLinkServerCustomIdResult()
         {
             readFromValue(obj);
@@ -8272,7 +11599,13 @@ namespace ServerModels
         ~FLinkServerCustomIdResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkXboxAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8304,6 +11637,17 @@ namespace ServerModels
             XboxToken(src.XboxToken)
             {}
 
+        FLinkXboxAccountRequest(FLinkXboxAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceLink(MoveTemp(src.ForceLink)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            XboxToken(MoveTemp(src.XboxToken))
+            {}
+
+        FLinkXboxAccountRequest& operator=(const FLinkXboxAccountRequest& src) = default;
+        FLinkXboxAccountRequest& operator=(FLinkXboxAccountRequest&& src) = default;
+
         FLinkXboxAccountRequest(const TSharedPtr<FJsonObject>& obj) : FLinkXboxAccountRequest()
         {
             readFromValue(obj);
@@ -8312,7 +11656,13 @@ namespace ServerModels
         ~FLinkXboxAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLinkXboxAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -8325,6 +11675,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FLinkXboxAccountResult(FLinkXboxAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FLinkXboxAccountResult& operator=(const FLinkXboxAccountResult& src) = default;
+        FLinkXboxAccountResult& operator=(FLinkXboxAccountResult&& src) = default;
+
         FLinkXboxAccountResult(const TSharedPtr<FJsonObject>& obj) : FLinkXboxAccountResult()
         {
             readFromValue(obj);
@@ -8333,7 +11690,13 @@ namespace ServerModels
         ~FLinkXboxAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListUsersCharactersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8351,6 +11714,14 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FListUsersCharactersRequest(FListUsersCharactersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FListUsersCharactersRequest& operator=(const FListUsersCharactersRequest& src) = default;
+        FListUsersCharactersRequest& operator=(FListUsersCharactersRequest&& src) = default;
+
         FListUsersCharactersRequest(const TSharedPtr<FJsonObject>& obj) : FListUsersCharactersRequest()
         {
             readFromValue(obj);
@@ -8359,7 +11730,13 @@ namespace ServerModels
         ~FListUsersCharactersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FListUsersCharactersResult : public PlayFab::FPlayFabCppResultCommon
@@ -8376,6 +11753,14 @@ namespace ServerModels
             Characters(src.Characters)
             {}
 
+        FListUsersCharactersResult(FListUsersCharactersResult&& src) :
+            FPlayFabCppResultCommon(),
+            Characters(MoveTemp(src.Characters))
+            {}
+
+        FListUsersCharactersResult& operator=(const FListUsersCharactersResult& src) = default;
+        FListUsersCharactersResult& operator=(FListUsersCharactersResult&& src) = default;
+
         FListUsersCharactersResult(const TSharedPtr<FJsonObject>& obj) : FListUsersCharactersResult()
         {
             readFromValue(obj);
@@ -8384,7 +11769,13 @@ namespace ServerModels
         ~FListUsersCharactersResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLocalizedPushNotificationProperties : public PlayFab::FPlayFabCppBaseModel
@@ -8407,6 +11798,15 @@ namespace ServerModels
             Subject(src.Subject)
             {}
 
+        FLocalizedPushNotificationProperties(FLocalizedPushNotificationProperties&& src) :
+            FPlayFabCppBaseModel(),
+            Message(MoveTemp(src.Message)),
+            Subject(MoveTemp(src.Subject))
+            {}
+
+        FLocalizedPushNotificationProperties& operator=(const FLocalizedPushNotificationProperties& src) = default;
+        FLocalizedPushNotificationProperties& operator=(FLocalizedPushNotificationProperties&& src) = default;
+
         FLocalizedPushNotificationProperties(const TSharedPtr<FJsonObject>& obj) : FLocalizedPushNotificationProperties()
         {
             readFromValue(obj);
@@ -8415,7 +11815,13 @@ namespace ServerModels
         ~FLocalizedPushNotificationProperties();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithServerCustomIdRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8447,11 +11853,23 @@ namespace ServerModels
             FPlayFabCppRequestCommon(),
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             PlayerSecret(src.PlayerSecret),
             ServerCustomId(src.ServerCustomId)
             {}
 
+        FLoginWithServerCustomIdRequest(FLoginWithServerCustomIdRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            ServerCustomId(MoveTemp(src.ServerCustomId))
+            {}
+
+        FLoginWithServerCustomIdRequest& operator=(const FLoginWithServerCustomIdRequest& src) = default;
+        FLoginWithServerCustomIdRequest& operator=(FLoginWithServerCustomIdRequest&& src) = default;
+
         FLoginWithServerCustomIdRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithServerCustomIdRequest()
         {
             readFromValue(obj);
@@ -8460,7 +11878,13 @@ namespace ServerModels
         ~FLoginWithServerCustomIdRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithSteamIdRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8488,10 +11912,21 @@ namespace ServerModels
             FPlayFabCppRequestCommon(),
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             SteamId(src.SteamId)
             {}
 
+        FLoginWithSteamIdRequest(FLoginWithSteamIdRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            SteamId(MoveTemp(src.SteamId))
+            {}
+
+        FLoginWithSteamIdRequest& operator=(const FLoginWithSteamIdRequest& src) = default;
+        FLoginWithSteamIdRequest& operator=(FLoginWithSteamIdRequest&& src) = default;
+
         FLoginWithSteamIdRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithSteamIdRequest()
         {
             readFromValue(obj);
@@ -8500,7 +11935,13 @@ namespace ServerModels
         ~FLoginWithSteamIdRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithXboxIdRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8532,11 +11973,23 @@ namespace ServerModels
             FPlayFabCppRequestCommon(),
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             Sandbox(src.Sandbox),
             XboxId(src.XboxId)
             {}
 
+        FLoginWithXboxIdRequest(FLoginWithXboxIdRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            Sandbox(MoveTemp(src.Sandbox)),
+            XboxId(MoveTemp(src.XboxId))
+            {}
+
+        FLoginWithXboxIdRequest& operator=(const FLoginWithXboxIdRequest& src) = default;
+        FLoginWithXboxIdRequest& operator=(FLoginWithXboxIdRequest&& src) = default;
+
         FLoginWithXboxIdRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithXboxIdRequest()
         {
             readFromValue(obj);
@@ -8545,7 +11998,13 @@ namespace ServerModels
         ~FLoginWithXboxIdRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FLoginWithXboxRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8573,10 +12032,21 @@ namespace ServerModels
             FPlayFabCppRequestCommon(),
             CreateAccount(src.CreateAccount),
             CustomTags(src.CustomTags),
-            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoRequestParams(*src.InfoRequestParameters)) : nullptr),
+            InfoRequestParameters(src.InfoRequestParameters.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoRequestParams>(MakeShared<FGetPlayerCombinedInfoRequestParams>(*src.InfoRequestParameters)) : nullptr),
             XboxToken(src.XboxToken)
             {}
 
+        FLoginWithXboxRequest(FLoginWithXboxRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CreateAccount(MoveTemp(src.CreateAccount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            InfoRequestParameters(MoveTemp(src.InfoRequestParameters)),
+            XboxToken(MoveTemp(src.XboxToken))
+            {}
+
+        FLoginWithXboxRequest& operator=(const FLoginWithXboxRequest& src) = default;
+        FLoginWithXboxRequest& operator=(FLoginWithXboxRequest&& src) = default;
+
         FLoginWithXboxRequest(const TSharedPtr<FJsonObject>& obj) : FLoginWithXboxRequest()
         {
             readFromValue(obj);
@@ -8585,7 +12055,13 @@ namespace ServerModels
         ~FLoginWithXboxRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FModifyCharacterVirtualCurrencyResult : public PlayFab::FPlayFabCppResultCommon
@@ -8608,6 +12084,15 @@ namespace ServerModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FModifyCharacterVirtualCurrencyResult(FModifyCharacterVirtualCurrencyResult&& src) :
+            FPlayFabCppResultCommon(),
+            Balance(MoveTemp(src.Balance)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FModifyCharacterVirtualCurrencyResult& operator=(const FModifyCharacterVirtualCurrencyResult& src) = default;
+        FModifyCharacterVirtualCurrencyResult& operator=(FModifyCharacterVirtualCurrencyResult&& src) = default;
+
         FModifyCharacterVirtualCurrencyResult(const TSharedPtr<FJsonObject>& obj) : FModifyCharacterVirtualCurrencyResult()
         {
             readFromValue(obj);
@@ -8616,7 +12101,13 @@ namespace ServerModels
         ~FModifyCharacterVirtualCurrencyResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FModifyItemUsesRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8648,6 +12139,17 @@ namespace ServerModels
             UsesToAdd(src.UsesToAdd)
             {}
 
+        FModifyItemUsesRequest(FModifyItemUsesRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            UsesToAdd(MoveTemp(src.UsesToAdd))
+            {}
+
+        FModifyItemUsesRequest& operator=(const FModifyItemUsesRequest& src) = default;
+        FModifyItemUsesRequest& operator=(FModifyItemUsesRequest&& src) = default;
+
         FModifyItemUsesRequest(const TSharedPtr<FJsonObject>& obj) : FModifyItemUsesRequest()
         {
             readFromValue(obj);
@@ -8656,7 +12158,13 @@ namespace ServerModels
         ~FModifyItemUsesRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FModifyItemUsesResult : public PlayFab::FPlayFabCppResultCommon
@@ -8679,6 +12187,15 @@ namespace ServerModels
             RemainingUses(src.RemainingUses)
             {}
 
+        FModifyItemUsesResult(FModifyItemUsesResult&& src) :
+            FPlayFabCppResultCommon(),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            RemainingUses(MoveTemp(src.RemainingUses))
+            {}
+
+        FModifyItemUsesResult& operator=(const FModifyItemUsesResult& src) = default;
+        FModifyItemUsesResult& operator=(FModifyItemUsesResult&& src) = default;
+
         FModifyItemUsesResult(const TSharedPtr<FJsonObject>& obj) : FModifyItemUsesResult()
         {
             readFromValue(obj);
@@ -8687,7 +12204,13 @@ namespace ServerModels
         ~FModifyItemUsesResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FModifyUserVirtualCurrencyResult : public PlayFab::FPlayFabCppResultCommon
@@ -8723,6 +12246,17 @@ namespace ServerModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FModifyUserVirtualCurrencyResult(FModifyUserVirtualCurrencyResult&& src) :
+            FPlayFabCppResultCommon(),
+            Balance(MoveTemp(src.Balance)),
+            BalanceChange(MoveTemp(src.BalanceChange)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FModifyUserVirtualCurrencyResult& operator=(const FModifyUserVirtualCurrencyResult& src) = default;
+        FModifyUserVirtualCurrencyResult& operator=(FModifyUserVirtualCurrencyResult&& src) = default;
+
         FModifyUserVirtualCurrencyResult(const TSharedPtr<FJsonObject>& obj) : FModifyUserVirtualCurrencyResult()
         {
             readFromValue(obj);
@@ -8731,7 +12265,13 @@ namespace ServerModels
         ~FModifyUserVirtualCurrencyResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMoveItemToCharacterFromCharacterRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8764,6 +12304,17 @@ namespace ServerModels
             ReceivingCharacterId(src.ReceivingCharacterId)
             {}
 
+        FMoveItemToCharacterFromCharacterRequest(FMoveItemToCharacterFromCharacterRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            GivingCharacterId(MoveTemp(src.GivingCharacterId)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            ReceivingCharacterId(MoveTemp(src.ReceivingCharacterId))
+            {}
+
+        FMoveItemToCharacterFromCharacterRequest& operator=(const FMoveItemToCharacterFromCharacterRequest& src) = default;
+        FMoveItemToCharacterFromCharacterRequest& operator=(FMoveItemToCharacterFromCharacterRequest&& src) = default;
+
         FMoveItemToCharacterFromCharacterRequest(const TSharedPtr<FJsonObject>& obj) : FMoveItemToCharacterFromCharacterRequest()
         {
             readFromValue(obj);
@@ -8772,7 +12323,13 @@ namespace ServerModels
         ~FMoveItemToCharacterFromCharacterRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMoveItemToCharacterFromCharacterResult : public PlayFab::FPlayFabCppResultCommon
@@ -8785,6 +12342,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FMoveItemToCharacterFromCharacterResult(FMoveItemToCharacterFromCharacterResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FMoveItemToCharacterFromCharacterResult& operator=(const FMoveItemToCharacterFromCharacterResult& src) = default;
+        FMoveItemToCharacterFromCharacterResult& operator=(FMoveItemToCharacterFromCharacterResult&& src) = default;
+
         FMoveItemToCharacterFromCharacterResult(const TSharedPtr<FJsonObject>& obj) : FMoveItemToCharacterFromCharacterResult()
         {
             readFromValue(obj);
@@ -8793,7 +12357,13 @@ namespace ServerModels
         ~FMoveItemToCharacterFromCharacterResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMoveItemToCharacterFromUserRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8821,6 +12391,16 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FMoveItemToCharacterFromUserRequest(FMoveItemToCharacterFromUserRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FMoveItemToCharacterFromUserRequest& operator=(const FMoveItemToCharacterFromUserRequest& src) = default;
+        FMoveItemToCharacterFromUserRequest& operator=(FMoveItemToCharacterFromUserRequest&& src) = default;
+
         FMoveItemToCharacterFromUserRequest(const TSharedPtr<FJsonObject>& obj) : FMoveItemToCharacterFromUserRequest()
         {
             readFromValue(obj);
@@ -8829,7 +12409,13 @@ namespace ServerModels
         ~FMoveItemToCharacterFromUserRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMoveItemToCharacterFromUserResult : public PlayFab::FPlayFabCppResultCommon
@@ -8842,6 +12428,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FMoveItemToCharacterFromUserResult(FMoveItemToCharacterFromUserResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FMoveItemToCharacterFromUserResult& operator=(const FMoveItemToCharacterFromUserResult& src) = default;
+        FMoveItemToCharacterFromUserResult& operator=(FMoveItemToCharacterFromUserResult&& src) = default;
+
         FMoveItemToCharacterFromUserResult(const TSharedPtr<FJsonObject>& obj) : FMoveItemToCharacterFromUserResult()
         {
             readFromValue(obj);
@@ -8850,7 +12443,13 @@ namespace ServerModels
         ~FMoveItemToCharacterFromUserResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMoveItemToUserFromCharacterRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8878,6 +12477,16 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FMoveItemToUserFromCharacterRequest(FMoveItemToUserFromCharacterRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FMoveItemToUserFromCharacterRequest& operator=(const FMoveItemToUserFromCharacterRequest& src) = default;
+        FMoveItemToUserFromCharacterRequest& operator=(FMoveItemToUserFromCharacterRequest&& src) = default;
+
         FMoveItemToUserFromCharacterRequest(const TSharedPtr<FJsonObject>& obj) : FMoveItemToUserFromCharacterRequest()
         {
             readFromValue(obj);
@@ -8886,7 +12495,13 @@ namespace ServerModels
         ~FMoveItemToUserFromCharacterRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FMoveItemToUserFromCharacterResult : public PlayFab::FPlayFabCppResultCommon
@@ -8899,6 +12514,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FMoveItemToUserFromCharacterResult(FMoveItemToUserFromCharacterResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FMoveItemToUserFromCharacterResult& operator=(const FMoveItemToUserFromCharacterResult& src) = default;
+        FMoveItemToUserFromCharacterResult& operator=(FMoveItemToUserFromCharacterResult&& src) = default;
+
         FMoveItemToUserFromCharacterResult(const TSharedPtr<FJsonObject>& obj) : FMoveItemToUserFromCharacterResult()
         {
             readFromValue(obj);
@@ -8907,7 +12529,13 @@ namespace ServerModels
         ~FMoveItemToUserFromCharacterResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FNotifyMatchmakerPlayerLeftRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -8934,6 +12562,16 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FNotifyMatchmakerPlayerLeftRequest(FNotifyMatchmakerPlayerLeftRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            LobbyId(MoveTemp(src.LobbyId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FNotifyMatchmakerPlayerLeftRequest& operator=(const FNotifyMatchmakerPlayerLeftRequest& src) = default;
+        FNotifyMatchmakerPlayerLeftRequest& operator=(FNotifyMatchmakerPlayerLeftRequest&& src) = default;
+
         FNotifyMatchmakerPlayerLeftRequest(const TSharedPtr<FJsonObject>& obj) : FNotifyMatchmakerPlayerLeftRequest()
         {
             readFromValue(obj);
@@ -8942,7 +12580,13 @@ namespace ServerModels
         ~FNotifyMatchmakerPlayerLeftRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum PlayerConnectionState
@@ -8954,6 +12598,7 @@ namespace ServerModels
     };
 
     PLAYFABCPP_API void writePlayerConnectionStateEnumJSON(PlayerConnectionState enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writePlayerConnectionStateEnumJSON(PlayerConnectionState enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API PlayerConnectionState readPlayerConnectionStateFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API PlayerConnectionState readPlayerConnectionStateFromValue(const FString& value);
 
@@ -8972,6 +12617,14 @@ namespace ServerModels
             PlayerState(src.PlayerState)
             {}
 
+        FNotifyMatchmakerPlayerLeftResult(FNotifyMatchmakerPlayerLeftResult&& src) :
+            FPlayFabCppResultCommon(),
+            PlayerState(MoveTemp(src.PlayerState))
+            {}
+
+        FNotifyMatchmakerPlayerLeftResult& operator=(const FNotifyMatchmakerPlayerLeftResult& src) = default;
+        FNotifyMatchmakerPlayerLeftResult& operator=(FNotifyMatchmakerPlayerLeftResult&& src) = default;
+
         FNotifyMatchmakerPlayerLeftResult(const TSharedPtr<FJsonObject>& obj) : FNotifyMatchmakerPlayerLeftResult()
         {
             readFromValue(obj);
@@ -8980,7 +12633,13 @@ namespace ServerModels
         ~FNotifyMatchmakerPlayerLeftResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FPushNotificationPackage : public PlayFab::FPlayFabCppBaseModel
@@ -9023,6 +12682,19 @@ namespace ServerModels
             Title(src.Title)
             {}
 
+        FPushNotificationPackage(FPushNotificationPackage&& src) :
+            FPlayFabCppBaseModel(),
+            Badge(MoveTemp(src.Badge)),
+            CustomData(MoveTemp(src.CustomData)),
+            Icon(MoveTemp(src.Icon)),
+            Message(MoveTemp(src.Message)),
+            Sound(MoveTemp(src.Sound)),
+            Title(MoveTemp(src.Title))
+            {}
+
+        FPushNotificationPackage& operator=(const FPushNotificationPackage& src) = default;
+        FPushNotificationPackage& operator=(FPushNotificationPackage&& src) = default;
+
         FPushNotificationPackage(const TSharedPtr<FJsonObject>& obj) : FPushNotificationPackage()
         {
             readFromValue(obj);
@@ -9031,7 +12703,13 @@ namespace ServerModels
         ~FPushNotificationPackage();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRedeemCouponRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9068,6 +12746,18 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FRedeemCouponRequest(FRedeemCouponRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CouponCode(MoveTemp(src.CouponCode)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FRedeemCouponRequest& operator=(const FRedeemCouponRequest& src) = default;
+        FRedeemCouponRequest& operator=(FRedeemCouponRequest&& src) = default;
+
         FRedeemCouponRequest(const TSharedPtr<FJsonObject>& obj) : FRedeemCouponRequest()
         {
             readFromValue(obj);
@@ -9076,7 +12766,13 @@ namespace ServerModels
         ~FRedeemCouponRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRedeemCouponResult : public PlayFab::FPlayFabCppResultCommon
@@ -9093,6 +12789,14 @@ namespace ServerModels
             GrantedItems(src.GrantedItems)
             {}
 
+        FRedeemCouponResult(FRedeemCouponResult&& src) :
+            FPlayFabCppResultCommon(),
+            GrantedItems(MoveTemp(src.GrantedItems))
+            {}
+
+        FRedeemCouponResult& operator=(const FRedeemCouponResult& src) = default;
+        FRedeemCouponResult& operator=(FRedeemCouponResult&& src) = default;
+
         FRedeemCouponResult(const TSharedPtr<FJsonObject>& obj) : FRedeemCouponResult()
         {
             readFromValue(obj);
@@ -9101,7 +12805,13 @@ namespace ServerModels
         ~FRedeemCouponResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRedeemMatchmakerTicketRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9128,6 +12838,16 @@ namespace ServerModels
             Ticket(src.Ticket)
             {}
 
+        FRedeemMatchmakerTicketRequest(FRedeemMatchmakerTicketRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            LobbyId(MoveTemp(src.LobbyId)),
+            Ticket(MoveTemp(src.Ticket))
+            {}
+
+        FRedeemMatchmakerTicketRequest& operator=(const FRedeemMatchmakerTicketRequest& src) = default;
+        FRedeemMatchmakerTicketRequest& operator=(FRedeemMatchmakerTicketRequest&& src) = default;
+
         FRedeemMatchmakerTicketRequest(const TSharedPtr<FJsonObject>& obj) : FRedeemMatchmakerTicketRequest()
         {
             readFromValue(obj);
@@ -9136,7 +12856,13 @@ namespace ServerModels
         ~FRedeemMatchmakerTicketRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRedeemMatchmakerTicketResult : public PlayFab::FPlayFabCppResultCommon
@@ -9161,9 +12887,19 @@ namespace ServerModels
             FPlayFabCppResultCommon(),
             Error(src.Error),
             TicketIsValid(src.TicketIsValid),
-            UserInfo(src.UserInfo.IsValid() ? MakeShareable(new FUserAccountInfo(*src.UserInfo)) : nullptr)
+            UserInfo(src.UserInfo.IsValid() ? TSharedPtr<FUserAccountInfo>(MakeShared<FUserAccountInfo>(*src.UserInfo)) : nullptr)
             {}
 
+        FRedeemMatchmakerTicketResult(FRedeemMatchmakerTicketResult&& src) :
+            FPlayFabCppResultCommon(),
+            Error(MoveTemp(src.Error)),
+            TicketIsValid(MoveTemp(src.TicketIsValid)),
+            UserInfo(MoveTemp(src.UserInfo))
+            {}
+
+        FRedeemMatchmakerTicketResult& operator=(const FRedeemMatchmakerTicketResult& src) = default;
+        FRedeemMatchmakerTicketResult& operator=(FRedeemMatchmakerTicketResult&& src) = default;
+
         FRedeemMatchmakerTicketResult(const TSharedPtr<FJsonObject>& obj) : FRedeemMatchmakerTicketResult()
         {
             readFromValue(obj);
@@ -9172,7 +12908,13 @@ namespace ServerModels
         ~FRedeemMatchmakerTicketResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRefreshGameServerInstanceHeartbeatRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9190,6 +12932,14 @@ namespace ServerModels
             LobbyId(src.LobbyId)
             {}
 
+        FRefreshGameServerInstanceHeartbeatRequest(FRefreshGameServerInstanceHeartbeatRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            LobbyId(MoveTemp(src.LobbyId))
+            {}
+
+        FRefreshGameServerInstanceHeartbeatRequest& operator=(const FRefreshGameServerInstanceHeartbeatRequest& src) = default;
+        FRefreshGameServerInstanceHeartbeatRequest& operator=(FRefreshGameServerInstanceHeartbeatRequest&& src) = default;
+
         FRefreshGameServerInstanceHeartbeatRequest(const TSharedPtr<FJsonObject>& obj) : FRefreshGameServerInstanceHeartbeatRequest()
         {
             readFromValue(obj);
@@ -9198,7 +12948,13 @@ namespace ServerModels
         ~FRefreshGameServerInstanceHeartbeatRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRefreshGameServerInstanceHeartbeatResult : public PlayFab::FPlayFabCppResultCommon
@@ -9211,6 +12967,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FRefreshGameServerInstanceHeartbeatResult(FRefreshGameServerInstanceHeartbeatResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FRefreshGameServerInstanceHeartbeatResult& operator=(const FRefreshGameServerInstanceHeartbeatResult& src) = default;
+        FRefreshGameServerInstanceHeartbeatResult& operator=(FRefreshGameServerInstanceHeartbeatResult&& src) = default;
+
         FRefreshGameServerInstanceHeartbeatResult(const TSharedPtr<FJsonObject>& obj) : FRefreshGameServerInstanceHeartbeatResult()
         {
             readFromValue(obj);
@@ -9219,7 +12982,13 @@ namespace ServerModels
         ~FRefreshGameServerInstanceHeartbeatResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     enum Region
@@ -9234,6 +13003,7 @@ namespace ServerModels
     };
 
     PLAYFABCPP_API void writeRegionEnumJSON(Region enumVal, JsonWriter& writer);
+    PLAYFABCPP_API void writeRegionEnumJSON(Region enumVal, JsonUtf8Writer& writer);
     PLAYFABCPP_API Region readRegionFromValue(const TSharedPtr<FJsonValue>& value);
     PLAYFABCPP_API Region readRegionFromValue(const FString& value);
 
@@ -9301,6 +13071,23 @@ namespace ServerModels
             Tags(src.Tags)
             {}
 
+        FRegisterGameRequest(FRegisterGameRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Build(MoveTemp(src.Build)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            GameMode(MoveTemp(src.GameMode)),
+            LobbyId(MoveTemp(src.LobbyId)),
+            pfRegion(MoveTemp(src.pfRegion)),
+            ServerIPV4Address(MoveTemp(src.ServerIPV4Address)),
+            ServerIPV6Address(MoveTemp(src.ServerIPV6Address)),
+            ServerPort(MoveTemp(src.ServerPort)),
+            ServerPublicDNSName(MoveTemp(src.ServerPublicDNSName)),
+            Tags(MoveTemp(src.Tags))
+            {}
+
+        FRegisterGameRequest& operator=(const FRegisterGameRequest& src) = default;
+        FRegisterGameRequest& operator=(FRegisterGameRequest&& src) = default;
+
         FRegisterGameRequest(const TSharedPtr<FJsonObject>& obj) : FRegisterGameRequest()
         {
             readFromValue(obj);
@@ -9309,7 +13096,13 @@ namespace ServerModels
         ~FRegisterGameRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRegisterGameResponse : public PlayFab::FPlayFabCppResultCommon
@@ -9330,6 +13123,14 @@ namespace ServerModels
             LobbyId(src.LobbyId)
             {}
 
+        FRegisterGameResponse(FRegisterGameResponse&& src) :
+            FPlayFabCppResultCommon(),
+            LobbyId(MoveTemp(src.LobbyId))
+            {}
+
+        FRegisterGameResponse& operator=(const FRegisterGameResponse& src) = default;
+        FRegisterGameResponse& operator=(FRegisterGameResponse&& src) = default;
+
         FRegisterGameResponse(const TSharedPtr<FJsonObject>& obj) : FRegisterGameResponse()
         {
             readFromValue(obj);
@@ -9338,7 +13139,13 @@ namespace ServerModels
         ~FRegisterGameResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveFriendRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9361,6 +13168,15 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FRemoveFriendRequest(FRemoveFriendRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            FriendPlayFabId(MoveTemp(src.FriendPlayFabId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FRemoveFriendRequest& operator=(const FRemoveFriendRequest& src) = default;
+        FRemoveFriendRequest& operator=(FRemoveFriendRequest&& src) = default;
+
         FRemoveFriendRequest(const TSharedPtr<FJsonObject>& obj) : FRemoveFriendRequest()
         {
             readFromValue(obj);
@@ -9369,7 +13185,13 @@ namespace ServerModels
         ~FRemoveFriendRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveGenericIDRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9392,6 +13214,15 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FRemoveGenericIDRequest(FRemoveGenericIDRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            GenericId(MoveTemp(src.GenericId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FRemoveGenericIDRequest& operator=(const FRemoveGenericIDRequest& src) = default;
+        FRemoveGenericIDRequest& operator=(FRemoveGenericIDRequest&& src) = default;
+
         FRemoveGenericIDRequest(const TSharedPtr<FJsonObject>& obj) : FRemoveGenericIDRequest()
         {
             readFromValue(obj);
@@ -9400,7 +13231,13 @@ namespace ServerModels
         ~FRemoveGenericIDRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemovePlayerTagRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9427,6 +13264,16 @@ namespace ServerModels
             TagName(src.TagName)
             {}
 
+        FRemovePlayerTagRequest(FRemovePlayerTagRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            TagName(MoveTemp(src.TagName))
+            {}
+
+        FRemovePlayerTagRequest& operator=(const FRemovePlayerTagRequest& src) = default;
+        FRemovePlayerTagRequest& operator=(FRemovePlayerTagRequest&& src) = default;
+
         FRemovePlayerTagRequest(const TSharedPtr<FJsonObject>& obj) : FRemovePlayerTagRequest()
         {
             readFromValue(obj);
@@ -9435,7 +13282,13 @@ namespace ServerModels
         ~FRemovePlayerTagRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemovePlayerTagResult : public PlayFab::FPlayFabCppResultCommon
@@ -9448,6 +13301,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FRemovePlayerTagResult(FRemovePlayerTagResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FRemovePlayerTagResult& operator=(const FRemovePlayerTagResult& src) = default;
+        FRemovePlayerTagResult& operator=(FRemovePlayerTagResult&& src) = default;
+
         FRemovePlayerTagResult(const TSharedPtr<FJsonObject>& obj) : FRemovePlayerTagResult()
         {
             readFromValue(obj);
@@ -9456,7 +13316,13 @@ namespace ServerModels
         ~FRemovePlayerTagResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveSharedGroupMembersRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9478,6 +13344,15 @@ namespace ServerModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FRemoveSharedGroupMembersRequest(FRemoveSharedGroupMembersRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabIds(MoveTemp(src.PlayFabIds)),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FRemoveSharedGroupMembersRequest& operator=(const FRemoveSharedGroupMembersRequest& src) = default;
+        FRemoveSharedGroupMembersRequest& operator=(FRemoveSharedGroupMembersRequest&& src) = default;
+
         FRemoveSharedGroupMembersRequest(const TSharedPtr<FJsonObject>& obj) : FRemoveSharedGroupMembersRequest()
         {
             readFromValue(obj);
@@ -9486,7 +13361,13 @@ namespace ServerModels
         ~FRemoveSharedGroupMembersRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRemoveSharedGroupMembersResult : public PlayFab::FPlayFabCppResultCommon
@@ -9499,6 +13380,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FRemoveSharedGroupMembersResult(FRemoveSharedGroupMembersResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FRemoveSharedGroupMembersResult& operator=(const FRemoveSharedGroupMembersResult& src) = default;
+        FRemoveSharedGroupMembersResult& operator=(FRemoveSharedGroupMembersResult&& src) = default;
+
         FRemoveSharedGroupMembersResult(const TSharedPtr<FJsonObject>& obj) : FRemoveSharedGroupMembersResult()
         {
             readFromValue(obj);
@@ -9507,7 +13395,13 @@ namespace ServerModels
         ~FRemoveSharedGroupMembersResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FReportPlayerServerRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9539,6 +13433,17 @@ namespace ServerModels
             ReporterId(src.ReporterId)
             {}
 
+        FReportPlayerServerRequest(FReportPlayerServerRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Comment(MoveTemp(src.Comment)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ReporteeId(MoveTemp(src.ReporteeId)),
+            ReporterId(MoveTemp(src.ReporterId))
+            {}
+
+        FReportPlayerServerRequest& operator=(const FReportPlayerServerRequest& src) = default;
+        FReportPlayerServerRequest& operator=(FReportPlayerServerRequest&& src) = default;
+
         FReportPlayerServerRequest(const TSharedPtr<FJsonObject>& obj) : FReportPlayerServerRequest()
         {
             readFromValue(obj);
@@ -9547,7 +13452,13 @@ namespace ServerModels
         ~FReportPlayerServerRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FReportPlayerServerResult : public PlayFab::FPlayFabCppResultCommon
@@ -9565,6 +13476,14 @@ namespace ServerModels
             SubmissionsRemaining(src.SubmissionsRemaining)
             {}
 
+        FReportPlayerServerResult(FReportPlayerServerResult&& src) :
+            FPlayFabCppResultCommon(),
+            SubmissionsRemaining(MoveTemp(src.SubmissionsRemaining))
+            {}
+
+        FReportPlayerServerResult& operator=(const FReportPlayerServerResult& src) = default;
+        FReportPlayerServerResult& operator=(FReportPlayerServerResult&& src) = default;
+
         FReportPlayerServerResult(const TSharedPtr<FJsonObject>& obj) : FReportPlayerServerResult()
         {
             readFromValue(obj);
@@ -9573,7 +13492,13 @@ namespace ServerModels
         ~FReportPlayerServerResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeAllBansForUserRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9591,6 +13516,14 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FRevokeAllBansForUserRequest(FRevokeAllBansForUserRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FRevokeAllBansForUserRequest& operator=(const FRevokeAllBansForUserRequest& src) = default;
+        FRevokeAllBansForUserRequest& operator=(FRevokeAllBansForUserRequest&& src) = default;
+
         FRevokeAllBansForUserRequest(const TSharedPtr<FJsonObject>& obj) : FRevokeAllBansForUserRequest()
         {
             readFromValue(obj);
@@ -9599,7 +13532,13 @@ namespace ServerModels
         ~FRevokeAllBansForUserRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeAllBansForUserResult : public PlayFab::FPlayFabCppResultCommon
@@ -9616,6 +13555,14 @@ namespace ServerModels
             BanData(src.BanData)
             {}
 
+        FRevokeAllBansForUserResult(FRevokeAllBansForUserResult&& src) :
+            FPlayFabCppResultCommon(),
+            BanData(MoveTemp(src.BanData))
+            {}
+
+        FRevokeAllBansForUserResult& operator=(const FRevokeAllBansForUserResult& src) = default;
+        FRevokeAllBansForUserResult& operator=(FRevokeAllBansForUserResult&& src) = default;
+
         FRevokeAllBansForUserResult(const TSharedPtr<FJsonObject>& obj) : FRevokeAllBansForUserResult()
         {
             readFromValue(obj);
@@ -9624,7 +13571,13 @@ namespace ServerModels
         ~FRevokeAllBansForUserResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeBansRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9641,6 +13594,14 @@ namespace ServerModels
             BanIds(src.BanIds)
             {}
 
+        FRevokeBansRequest(FRevokeBansRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            BanIds(MoveTemp(src.BanIds))
+            {}
+
+        FRevokeBansRequest& operator=(const FRevokeBansRequest& src) = default;
+        FRevokeBansRequest& operator=(FRevokeBansRequest&& src) = default;
+
         FRevokeBansRequest(const TSharedPtr<FJsonObject>& obj) : FRevokeBansRequest()
         {
             readFromValue(obj);
@@ -9649,7 +13610,13 @@ namespace ServerModels
         ~FRevokeBansRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeBansResult : public PlayFab::FPlayFabCppResultCommon
@@ -9666,6 +13633,14 @@ namespace ServerModels
             BanData(src.BanData)
             {}
 
+        FRevokeBansResult(FRevokeBansResult&& src) :
+            FPlayFabCppResultCommon(),
+            BanData(MoveTemp(src.BanData))
+            {}
+
+        FRevokeBansResult& operator=(const FRevokeBansResult& src) = default;
+        FRevokeBansResult& operator=(FRevokeBansResult&& src) = default;
+
         FRevokeBansResult(const TSharedPtr<FJsonObject>& obj) : FRevokeBansResult()
         {
             readFromValue(obj);
@@ -9674,7 +13649,13 @@ namespace ServerModels
         ~FRevokeBansResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeInventoryItem : public PlayFab::FPlayFabCppBaseModel
@@ -9702,6 +13683,16 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FRevokeInventoryItem(FRevokeInventoryItem&& src) :
+            FPlayFabCppBaseModel(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FRevokeInventoryItem& operator=(const FRevokeInventoryItem& src) = default;
+        FRevokeInventoryItem& operator=(FRevokeInventoryItem&& src) = default;
+
         FRevokeInventoryItem(const TSharedPtr<FJsonObject>& obj) : FRevokeInventoryItem()
         {
             readFromValue(obj);
@@ -9710,7 +13701,13 @@ namespace ServerModels
         ~FRevokeInventoryItem();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeInventoryItemRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9738,6 +13735,16 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FRevokeInventoryItemRequest(FRevokeInventoryItemRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FRevokeInventoryItemRequest& operator=(const FRevokeInventoryItemRequest& src) = default;
+        FRevokeInventoryItemRequest& operator=(FRevokeInventoryItemRequest&& src) = default;
+
         FRevokeInventoryItemRequest(const TSharedPtr<FJsonObject>& obj) : FRevokeInventoryItemRequest()
         {
             readFromValue(obj);
@@ -9746,7 +13753,13 @@ namespace ServerModels
         ~FRevokeInventoryItemRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeInventoryItemsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9763,6 +13776,14 @@ namespace ServerModels
             Items(src.Items)
             {}
 
+        FRevokeInventoryItemsRequest(FRevokeInventoryItemsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Items(MoveTemp(src.Items))
+            {}
+
+        FRevokeInventoryItemsRequest& operator=(const FRevokeInventoryItemsRequest& src) = default;
+        FRevokeInventoryItemsRequest& operator=(FRevokeInventoryItemsRequest&& src) = default;
+
         FRevokeInventoryItemsRequest(const TSharedPtr<FJsonObject>& obj) : FRevokeInventoryItemsRequest()
         {
             readFromValue(obj);
@@ -9771,7 +13792,13 @@ namespace ServerModels
         ~FRevokeInventoryItemsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeItemError : public PlayFab::FPlayFabCppBaseModel
@@ -9791,9 +13818,18 @@ namespace ServerModels
         FRevokeItemError(const FRevokeItemError& src) :
             FPlayFabCppBaseModel(),
             Error(src.Error),
-            Item(src.Item.IsValid() ? MakeShareable(new FRevokeInventoryItem(*src.Item)) : nullptr)
+            Item(src.Item.IsValid() ? TSharedPtr<FRevokeInventoryItem>(MakeShared<FRevokeInventoryItem>(*src.Item)) : nullptr)
             {}
 
+        FRevokeItemError(FRevokeItemError&& src) :
+            FPlayFabCppBaseModel(),
+            Error(MoveTemp(src.Error)),
+            Item(MoveTemp(src.Item))
+            {}
+
+        FRevokeItemError& operator=(const FRevokeItemError& src) = default;
+        FRevokeItemError& operator=(FRevokeItemError&& src) = default;
+
         FRevokeItemError(const TSharedPtr<FJsonObject>& obj) : FRevokeItemError()
         {
             readFromValue(obj);
@@ -9802,7 +13838,13 @@ namespace ServerModels
         ~FRevokeItemError();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeInventoryItemsResult : public PlayFab::FPlayFabCppResultCommon
@@ -9819,6 +13861,14 @@ namespace ServerModels
             Errors(src.Errors)
             {}
 
+        FRevokeInventoryItemsResult(FRevokeInventoryItemsResult&& src) :
+            FPlayFabCppResultCommon(),
+            Errors(MoveTemp(src.Errors))
+            {}
+
+        FRevokeInventoryItemsResult& operator=(const FRevokeInventoryItemsResult& src) = default;
+        FRevokeInventoryItemsResult& operator=(FRevokeInventoryItemsResult&& src) = default;
+
         FRevokeInventoryItemsResult(const TSharedPtr<FJsonObject>& obj) : FRevokeInventoryItemsResult()
         {
             readFromValue(obj);
@@ -9827,7 +13877,13 @@ namespace ServerModels
         ~FRevokeInventoryItemsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FRevokeInventoryResult : public PlayFab::FPlayFabCppResultCommon
@@ -9840,6 +13896,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FRevokeInventoryResult(FRevokeInventoryResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FRevokeInventoryResult& operator=(const FRevokeInventoryResult& src) = default;
+        FRevokeInventoryResult& operator=(FRevokeInventoryResult&& src) = default;
+
         FRevokeInventoryResult(const TSharedPtr<FJsonObject>& obj) : FRevokeInventoryResult()
         {
             readFromValue(obj);
@@ -9848,7 +13911,13 @@ namespace ServerModels
         ~FRevokeInventoryResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSavePushNotificationTemplateRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9885,6 +13954,18 @@ namespace ServerModels
             Name(src.Name)
             {}
 
+        FSavePushNotificationTemplateRequest(FSavePushNotificationTemplateRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AndroidPayload(MoveTemp(src.AndroidPayload)),
+            Id(MoveTemp(src.Id)),
+            IOSPayload(MoveTemp(src.IOSPayload)),
+            LocalizedPushNotificationTemplates(MoveTemp(src.LocalizedPushNotificationTemplates)),
+            Name(MoveTemp(src.Name))
+            {}
+
+        FSavePushNotificationTemplateRequest& operator=(const FSavePushNotificationTemplateRequest& src) = default;
+        FSavePushNotificationTemplateRequest& operator=(FSavePushNotificationTemplateRequest&& src) = default;
+
         FSavePushNotificationTemplateRequest(const TSharedPtr<FJsonObject>& obj) : FSavePushNotificationTemplateRequest()
         {
             readFromValue(obj);
@@ -9893,7 +13974,13 @@ namespace ServerModels
         ~FSavePushNotificationTemplateRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSavePushNotificationTemplateResult : public PlayFab::FPlayFabCppResultCommon
@@ -9911,6 +13998,14 @@ namespace ServerModels
             PushNotificationTemplateId(src.PushNotificationTemplateId)
             {}
 
+        FSavePushNotificationTemplateResult(FSavePushNotificationTemplateResult&& src) :
+            FPlayFabCppResultCommon(),
+            PushNotificationTemplateId(MoveTemp(src.PushNotificationTemplateId))
+            {}
+
+        FSavePushNotificationTemplateResult& operator=(const FSavePushNotificationTemplateResult& src) = default;
+        FSavePushNotificationTemplateResult& operator=(FSavePushNotificationTemplateResult&& src) = default;
+
         FSavePushNotificationTemplateResult(const TSharedPtr<FJsonObject>& obj) : FSavePushNotificationTemplateResult()
         {
             readFromValue(obj);
@@ -9919,7 +14014,13 @@ namespace ServerModels
         ~FSavePushNotificationTemplateResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSendCustomAccountRecoveryEmailRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -9951,6 +14052,17 @@ namespace ServerModels
             Username(src.Username)
             {}
 
+        FSendCustomAccountRecoveryEmailRequest(FSendCustomAccountRecoveryEmailRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Email(MoveTemp(src.Email)),
+            EmailTemplateId(MoveTemp(src.EmailTemplateId)),
+            Username(MoveTemp(src.Username))
+            {}
+
+        FSendCustomAccountRecoveryEmailRequest& operator=(const FSendCustomAccountRecoveryEmailRequest& src) = default;
+        FSendCustomAccountRecoveryEmailRequest& operator=(FSendCustomAccountRecoveryEmailRequest&& src) = default;
+
         FSendCustomAccountRecoveryEmailRequest(const TSharedPtr<FJsonObject>& obj) : FSendCustomAccountRecoveryEmailRequest()
         {
             readFromValue(obj);
@@ -9959,7 +14071,13 @@ namespace ServerModels
         ~FSendCustomAccountRecoveryEmailRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSendCustomAccountRecoveryEmailResult : public PlayFab::FPlayFabCppResultCommon
@@ -9972,6 +14090,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FSendCustomAccountRecoveryEmailResult(FSendCustomAccountRecoveryEmailResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSendCustomAccountRecoveryEmailResult& operator=(const FSendCustomAccountRecoveryEmailResult& src) = default;
+        FSendCustomAccountRecoveryEmailResult& operator=(FSendCustomAccountRecoveryEmailResult&& src) = default;
+
         FSendCustomAccountRecoveryEmailResult(const TSharedPtr<FJsonObject>& obj) : FSendCustomAccountRecoveryEmailResult()
         {
             readFromValue(obj);
@@ -9980,7 +14105,13 @@ namespace ServerModels
         ~FSendCustomAccountRecoveryEmailResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSendEmailFromTemplateRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10007,6 +14138,16 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FSendEmailFromTemplateRequest(FSendEmailFromTemplateRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EmailTemplateId(MoveTemp(src.EmailTemplateId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FSendEmailFromTemplateRequest& operator=(const FSendEmailFromTemplateRequest& src) = default;
+        FSendEmailFromTemplateRequest& operator=(FSendEmailFromTemplateRequest&& src) = default;
+
         FSendEmailFromTemplateRequest(const TSharedPtr<FJsonObject>& obj) : FSendEmailFromTemplateRequest()
         {
             readFromValue(obj);
@@ -10015,7 +14156,13 @@ namespace ServerModels
         ~FSendEmailFromTemplateRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSendEmailFromTemplateResult : public PlayFab::FPlayFabCppResultCommon
@@ -10028,6 +14175,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FSendEmailFromTemplateResult(FSendEmailFromTemplateResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSendEmailFromTemplateResult& operator=(const FSendEmailFromTemplateResult& src) = default;
+        FSendEmailFromTemplateResult& operator=(FSendEmailFromTemplateResult&& src) = default;
+
         FSendEmailFromTemplateResult(const TSharedPtr<FJsonObject>& obj) : FSendEmailFromTemplateResult()
         {
             readFromValue(obj);
@@ -10036,7 +14190,13 @@ namespace ServerModels
         ~FSendEmailFromTemplateResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSendPushNotificationFromTemplateRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10063,6 +14223,16 @@ namespace ServerModels
             Recipient(src.Recipient)
             {}
 
+        FSendPushNotificationFromTemplateRequest(FSendPushNotificationFromTemplateRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PushNotificationTemplateId(MoveTemp(src.PushNotificationTemplateId)),
+            Recipient(MoveTemp(src.Recipient))
+            {}
+
+        FSendPushNotificationFromTemplateRequest& operator=(const FSendPushNotificationFromTemplateRequest& src) = default;
+        FSendPushNotificationFromTemplateRequest& operator=(FSendPushNotificationFromTemplateRequest&& src) = default;
+
         FSendPushNotificationFromTemplateRequest(const TSharedPtr<FJsonObject>& obj) : FSendPushNotificationFromTemplateRequest()
         {
             readFromValue(obj);
@@ -10071,7 +14241,13 @@ namespace ServerModels
         ~FSendPushNotificationFromTemplateRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSendPushNotificationRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10116,12 +14292,26 @@ namespace ServerModels
             AdvancedPlatformDelivery(src.AdvancedPlatformDelivery),
             CustomTags(src.CustomTags),
             Message(src.Message),
-            Package(src.Package.IsValid() ? MakeShareable(new FPushNotificationPackage(*src.Package)) : nullptr),
+            Package(src.Package.IsValid() ? TSharedPtr<FPushNotificationPackage>(MakeShared<FPushNotificationPackage>(*src.Package)) : nullptr),
             Recipient(src.Recipient),
             Subject(src.Subject),
             TargetPlatforms(src.TargetPlatforms)
             {}
 
+        FSendPushNotificationRequest(FSendPushNotificationRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            AdvancedPlatformDelivery(MoveTemp(src.AdvancedPlatformDelivery)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Message(MoveTemp(src.Message)),
+            Package(MoveTemp(src.Package)),
+            Recipient(MoveTemp(src.Recipient)),
+            Subject(MoveTemp(src.Subject)),
+            TargetPlatforms(MoveTemp(src.TargetPlatforms))
+            {}
+
+        FSendPushNotificationRequest& operator=(const FSendPushNotificationRequest& src) = default;
+        FSendPushNotificationRequest& operator=(FSendPushNotificationRequest&& src) = default;
+
         FSendPushNotificationRequest(const TSharedPtr<FJsonObject>& obj) : FSendPushNotificationRequest()
         {
             readFromValue(obj);
@@ -10130,7 +14320,13 @@ namespace ServerModels
         ~FSendPushNotificationRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSendPushNotificationResult : public PlayFab::FPlayFabCppResultCommon
@@ -10143,6 +14339,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FSendPushNotificationResult(FSendPushNotificationResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSendPushNotificationResult& operator=(const FSendPushNotificationResult& src) = default;
+        FSendPushNotificationResult& operator=(FSendPushNotificationResult&& src) = default;
+
         FSendPushNotificationResult(const TSharedPtr<FJsonObject>& obj) : FSendPushNotificationResult()
         {
             readFromValue(obj);
@@ -10151,7 +14354,13 @@ namespace ServerModels
         ~FSendPushNotificationResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUserSettings : public PlayFab::FPlayFabCppBaseModel
@@ -10179,6 +14388,16 @@ namespace ServerModels
             NeedsAttribution(src.NeedsAttribution)
             {}
 
+        FUserSettings(FUserSettings&& src) :
+            FPlayFabCppBaseModel(),
+            GatherDeviceInfo(MoveTemp(src.GatherDeviceInfo)),
+            GatherFocusInfo(MoveTemp(src.GatherFocusInfo)),
+            NeedsAttribution(MoveTemp(src.NeedsAttribution))
+            {}
+
+        FUserSettings& operator=(const FUserSettings& src) = default;
+        FUserSettings& operator=(FUserSettings&& src) = default;
+
         FUserSettings(const TSharedPtr<FJsonObject>& obj) : FUserSettings()
         {
             readFromValue(obj);
@@ -10187,7 +14406,13 @@ namespace ServerModels
         ~FUserSettings();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FVariable : public PlayFab::FPlayFabCppBaseModel
@@ -10210,6 +14435,15 @@ namespace ServerModels
             Value(src.Value)
             {}
 
+        FVariable(FVariable&& src) :
+            FPlayFabCppBaseModel(),
+            Name(MoveTemp(src.Name)),
+            Value(MoveTemp(src.Value))
+            {}
+
+        FVariable& operator=(const FVariable& src) = default;
+        FVariable& operator=(FVariable&& src) = default;
+
         FVariable(const TSharedPtr<FJsonObject>& obj) : FVariable()
         {
             readFromValue(obj);
@@ -10218,7 +14452,13 @@ namespace ServerModels
         ~FVariable();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FTreatmentAssignment : public PlayFab::FPlayFabCppBaseModel
@@ -10239,6 +14479,15 @@ namespace ServerModels
             Variants(src.Variants)
             {}
 
+        FTreatmentAssignment(FTreatmentAssignment&& src) :
+            FPlayFabCppBaseModel(),
+            Variables(MoveTemp(src.Variables)),
+            Variants(MoveTemp(src.Variants))
+            {}
+
+        FTreatmentAssignment& operator=(const FTreatmentAssignment& src) = default;
+        FTreatmentAssignment& operator=(FTreatmentAssignment&& src) = default;
+
         FTreatmentAssignment(const TSharedPtr<FJsonObject>& obj) : FTreatmentAssignment()
         {
             readFromValue(obj);
@@ -10247,7 +14496,13 @@ namespace ServerModels
         ~FTreatmentAssignment();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FServerLoginResult : public PlayFab::FPlayFabLoginResultCommon
@@ -10293,16 +14548,31 @@ namespace ServerModels
 
         FServerLoginResult(const FServerLoginResult& src) :
             FPlayFabLoginResultCommon(),
-            EntityToken(src.EntityToken.IsValid() ? MakeShareable(new FEntityTokenResponse(*src.EntityToken)) : nullptr),
-            InfoResultPayload(src.InfoResultPayload.IsValid() ? MakeShareable(new FGetPlayerCombinedInfoResultPayload(*src.InfoResultPayload)) : nullptr),
+            EntityToken(src.EntityToken.IsValid() ? TSharedPtr<FEntityTokenResponse>(MakeShared<FEntityTokenResponse>(*src.EntityToken)) : nullptr),
+            InfoResultPayload(src.InfoResultPayload.IsValid() ? TSharedPtr<FGetPlayerCombinedInfoResultPayload>(MakeShared<FGetPlayerCombinedInfoResultPayload>(*src.InfoResultPayload)) : nullptr),
             LastLoginTime(src.LastLoginTime),
             NewlyCreated(src.NewlyCreated),
             PlayFabId(src.PlayFabId),
             SessionTicket(src.SessionTicket),
-            SettingsForUser(src.SettingsForUser.IsValid() ? MakeShareable(new FUserSettings(*src.SettingsForUser)) : nullptr),
-            pfTreatmentAssignment(src.pfTreatmentAssignment.IsValid() ? MakeShareable(new FTreatmentAssignment(*src.pfTreatmentAssignment)) : nullptr)
+            SettingsForUser(src.SettingsForUser.IsValid() ? TSharedPtr<FUserSettings>(MakeShared<FUserSettings>(*src.SettingsForUser)) : nullptr),
+            pfTreatmentAssignment(src.pfTreatmentAssignment.IsValid() ? TSharedPtr<FTreatmentAssignment>(MakeShared<FTreatmentAssignment>(*src.pfTreatmentAssignment)) : nullptr)
+            {}
+
+        FServerLoginResult(FServerLoginResult&& src) :
+            FPlayFabLoginResultCommon(),
+            EntityToken(MoveTemp(src.EntityToken)),
+            InfoResultPayload(MoveTemp(src.InfoResultPayload)),
+            LastLoginTime(MoveTemp(src.LastLoginTime)),
+            NewlyCreated(MoveTemp(src.NewlyCreated)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            SessionTicket(MoveTemp(src.SessionTicket)),
+            SettingsForUser(MoveTemp(src.SettingsForUser)),
+            pfTreatmentAssignment(MoveTemp(src.pfTreatmentAssignment))
             {}
 
+        FServerLoginResult& operator=(const FServerLoginResult& src) = default;
+        FServerLoginResult& operator=(FServerLoginResult&& src) = default;
+
         FServerLoginResult(const TSharedPtr<FJsonObject>& obj) : FServerLoginResult()
         {
             readFromValue(obj);
@@ -10311,7 +14581,13 @@ namespace ServerModels
         ~FServerLoginResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetFriendTagsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10338,6 +14614,16 @@ namespace ServerModels
             Tags(src.Tags)
             {}
 
+        FSetFriendTagsRequest(FSetFriendTagsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            FriendPlayFabId(MoveTemp(src.FriendPlayFabId)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Tags(MoveTemp(src.Tags))
+            {}
+
+        FSetFriendTagsRequest& operator=(const FSetFriendTagsRequest& src) = default;
+        FSetFriendTagsRequest& operator=(FSetFriendTagsRequest&& src) = default;
+
         FSetFriendTagsRequest(const TSharedPtr<FJsonObject>& obj) : FSetFriendTagsRequest()
         {
             readFromValue(obj);
@@ -10346,7 +14632,13 @@ namespace ServerModels
         ~FSetFriendTagsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetGameServerInstanceDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10369,6 +14661,15 @@ namespace ServerModels
             LobbyId(src.LobbyId)
             {}
 
+        FSetGameServerInstanceDataRequest(FSetGameServerInstanceDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            GameServerData(MoveTemp(src.GameServerData)),
+            LobbyId(MoveTemp(src.LobbyId))
+            {}
+
+        FSetGameServerInstanceDataRequest& operator=(const FSetGameServerInstanceDataRequest& src) = default;
+        FSetGameServerInstanceDataRequest& operator=(FSetGameServerInstanceDataRequest&& src) = default;
+
         FSetGameServerInstanceDataRequest(const TSharedPtr<FJsonObject>& obj) : FSetGameServerInstanceDataRequest()
         {
             readFromValue(obj);
@@ -10377,7 +14678,13 @@ namespace ServerModels
         ~FSetGameServerInstanceDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetGameServerInstanceDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -10390,6 +14697,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FSetGameServerInstanceDataResult(FSetGameServerInstanceDataResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSetGameServerInstanceDataResult& operator=(const FSetGameServerInstanceDataResult& src) = default;
+        FSetGameServerInstanceDataResult& operator=(FSetGameServerInstanceDataResult&& src) = default;
+
         FSetGameServerInstanceDataResult(const TSharedPtr<FJsonObject>& obj) : FSetGameServerInstanceDataResult()
         {
             readFromValue(obj);
@@ -10398,7 +14712,13 @@ namespace ServerModels
         ~FSetGameServerInstanceDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetGameServerInstanceStateRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10421,6 +14741,15 @@ namespace ServerModels
             State(src.State)
             {}
 
+        FSetGameServerInstanceStateRequest(FSetGameServerInstanceStateRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            LobbyId(MoveTemp(src.LobbyId)),
+            State(MoveTemp(src.State))
+            {}
+
+        FSetGameServerInstanceStateRequest& operator=(const FSetGameServerInstanceStateRequest& src) = default;
+        FSetGameServerInstanceStateRequest& operator=(FSetGameServerInstanceStateRequest&& src) = default;
+
         FSetGameServerInstanceStateRequest(const TSharedPtr<FJsonObject>& obj) : FSetGameServerInstanceStateRequest()
         {
             readFromValue(obj);
@@ -10429,7 +14758,13 @@ namespace ServerModels
         ~FSetGameServerInstanceStateRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetGameServerInstanceStateResult : public PlayFab::FPlayFabCppResultCommon
@@ -10442,6 +14777,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FSetGameServerInstanceStateResult(FSetGameServerInstanceStateResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSetGameServerInstanceStateResult& operator=(const FSetGameServerInstanceStateResult& src) = default;
+        FSetGameServerInstanceStateResult& operator=(FSetGameServerInstanceStateResult&& src) = default;
+
         FSetGameServerInstanceStateResult(const TSharedPtr<FJsonObject>& obj) : FSetGameServerInstanceStateResult()
         {
             readFromValue(obj);
@@ -10450,7 +14792,13 @@ namespace ServerModels
         ~FSetGameServerInstanceStateResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetGameServerInstanceTagsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10475,6 +14823,15 @@ namespace ServerModels
             Tags(src.Tags)
             {}
 
+        FSetGameServerInstanceTagsRequest(FSetGameServerInstanceTagsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            LobbyId(MoveTemp(src.LobbyId)),
+            Tags(MoveTemp(src.Tags))
+            {}
+
+        FSetGameServerInstanceTagsRequest& operator=(const FSetGameServerInstanceTagsRequest& src) = default;
+        FSetGameServerInstanceTagsRequest& operator=(FSetGameServerInstanceTagsRequest&& src) = default;
+
         FSetGameServerInstanceTagsRequest(const TSharedPtr<FJsonObject>& obj) : FSetGameServerInstanceTagsRequest()
         {
             readFromValue(obj);
@@ -10483,7 +14840,13 @@ namespace ServerModels
         ~FSetGameServerInstanceTagsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetGameServerInstanceTagsResult : public PlayFab::FPlayFabCppResultCommon
@@ -10496,6 +14859,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FSetGameServerInstanceTagsResult(FSetGameServerInstanceTagsResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSetGameServerInstanceTagsResult& operator=(const FSetGameServerInstanceTagsResult& src) = default;
+        FSetGameServerInstanceTagsResult& operator=(FSetGameServerInstanceTagsResult&& src) = default;
+
         FSetGameServerInstanceTagsResult(const TSharedPtr<FJsonObject>& obj) : FSetGameServerInstanceTagsResult()
         {
             readFromValue(obj);
@@ -10504,7 +14874,13 @@ namespace ServerModels
         ~FSetGameServerInstanceTagsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetPlayerSecretRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10527,6 +14903,15 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FSetPlayerSecretRequest(FSetPlayerSecretRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            PlayerSecret(MoveTemp(src.PlayerSecret)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FSetPlayerSecretRequest& operator=(const FSetPlayerSecretRequest& src) = default;
+        FSetPlayerSecretRequest& operator=(FSetPlayerSecretRequest&& src) = default;
+
         FSetPlayerSecretRequest(const TSharedPtr<FJsonObject>& obj) : FSetPlayerSecretRequest()
         {
             readFromValue(obj);
@@ -10535,7 +14920,13 @@ namespace ServerModels
         ~FSetPlayerSecretRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetPlayerSecretResult : public PlayFab::FPlayFabCppResultCommon
@@ -10548,6 +14939,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FSetPlayerSecretResult(FSetPlayerSecretResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSetPlayerSecretResult& operator=(const FSetPlayerSecretResult& src) = default;
+        FSetPlayerSecretResult& operator=(FSetPlayerSecretResult&& src) = default;
+
         FSetPlayerSecretResult(const TSharedPtr<FJsonObject>& obj) : FSetPlayerSecretResult()
         {
             readFromValue(obj);
@@ -10556,7 +14954,13 @@ namespace ServerModels
         ~FSetPlayerSecretResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetPublisherDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10582,6 +14986,15 @@ namespace ServerModels
             Value(src.Value)
             {}
 
+        FSetPublisherDataRequest(FSetPublisherDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Key(MoveTemp(src.Key)),
+            Value(MoveTemp(src.Value))
+            {}
+
+        FSetPublisherDataRequest& operator=(const FSetPublisherDataRequest& src) = default;
+        FSetPublisherDataRequest& operator=(FSetPublisherDataRequest&& src) = default;
+
         FSetPublisherDataRequest(const TSharedPtr<FJsonObject>& obj) : FSetPublisherDataRequest()
         {
             readFromValue(obj);
@@ -10590,7 +15003,13 @@ namespace ServerModels
         ~FSetPublisherDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetPublisherDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -10603,6 +15022,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FSetPublisherDataResult(FSetPublisherDataResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSetPublisherDataResult& operator=(const FSetPublisherDataResult& src) = default;
+        FSetPublisherDataResult& operator=(FSetPublisherDataResult&& src) = default;
+
         FSetPublisherDataResult(const TSharedPtr<FJsonObject>& obj) : FSetPublisherDataResult()
         {
             readFromValue(obj);
@@ -10611,7 +15037,13 @@ namespace ServerModels
         ~FSetPublisherDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetTitleDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10637,6 +15069,15 @@ namespace ServerModels
             Value(src.Value)
             {}
 
+        FSetTitleDataRequest(FSetTitleDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Key(MoveTemp(src.Key)),
+            Value(MoveTemp(src.Value))
+            {}
+
+        FSetTitleDataRequest& operator=(const FSetTitleDataRequest& src) = default;
+        FSetTitleDataRequest& operator=(FSetTitleDataRequest&& src) = default;
+
         FSetTitleDataRequest(const TSharedPtr<FJsonObject>& obj) : FSetTitleDataRequest()
         {
             readFromValue(obj);
@@ -10645,7 +15086,13 @@ namespace ServerModels
         ~FSetTitleDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSetTitleDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -10658,6 +15105,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FSetTitleDataResult(FSetTitleDataResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FSetTitleDataResult& operator=(const FSetTitleDataResult& src) = default;
+        FSetTitleDataResult& operator=(FSetTitleDataResult&& src) = default;
+
         FSetTitleDataResult(const TSharedPtr<FJsonObject>& obj) : FSetTitleDataResult()
         {
             readFromValue(obj);
@@ -10666,7 +15120,13 @@ namespace ServerModels
         ~FSetTitleDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FStatisticUpdate : public PlayFab::FPlayFabCppBaseModel
@@ -10697,6 +15157,16 @@ namespace ServerModels
             Version(src.Version)
             {}
 
+        FStatisticUpdate(FStatisticUpdate&& src) :
+            FPlayFabCppBaseModel(),
+            StatisticName(MoveTemp(src.StatisticName)),
+            Value(MoveTemp(src.Value)),
+            Version(MoveTemp(src.Version))
+            {}
+
+        FStatisticUpdate& operator=(const FStatisticUpdate& src) = default;
+        FStatisticUpdate& operator=(FStatisticUpdate&& src) = default;
+
         FStatisticUpdate(const TSharedPtr<FJsonObject>& obj) : FStatisticUpdate()
         {
             readFromValue(obj);
@@ -10705,7 +15175,13 @@ namespace ServerModels
         ~FStatisticUpdate();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSubtractCharacterVirtualCurrencyRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10742,6 +15218,18 @@ namespace ServerModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FSubtractCharacterVirtualCurrencyRequest(FSubtractCharacterVirtualCurrencyRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Amount(MoveTemp(src.Amount)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FSubtractCharacterVirtualCurrencyRequest& operator=(const FSubtractCharacterVirtualCurrencyRequest& src) = default;
+        FSubtractCharacterVirtualCurrencyRequest& operator=(FSubtractCharacterVirtualCurrencyRequest&& src) = default;
+
         FSubtractCharacterVirtualCurrencyRequest(const TSharedPtr<FJsonObject>& obj) : FSubtractCharacterVirtualCurrencyRequest()
         {
             readFromValue(obj);
@@ -10750,7 +15238,13 @@ namespace ServerModels
         ~FSubtractCharacterVirtualCurrencyRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FSubtractUserVirtualCurrencyRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10782,6 +15276,17 @@ namespace ServerModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FSubtractUserVirtualCurrencyRequest(FSubtractUserVirtualCurrencyRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Amount(MoveTemp(src.Amount)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FSubtractUserVirtualCurrencyRequest& operator=(const FSubtractUserVirtualCurrencyRequest& src) = default;
+        FSubtractUserVirtualCurrencyRequest& operator=(FSubtractUserVirtualCurrencyRequest&& src) = default;
+
         FSubtractUserVirtualCurrencyRequest(const TSharedPtr<FJsonObject>& obj) : FSubtractUserVirtualCurrencyRequest()
         {
             readFromValue(obj);
@@ -10790,7 +15295,13 @@ namespace ServerModels
         ~FSubtractUserVirtualCurrencyRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkPSNAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10812,6 +15323,15 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FUnlinkPSNAccountRequest(FUnlinkPSNAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FUnlinkPSNAccountRequest& operator=(const FUnlinkPSNAccountRequest& src) = default;
+        FUnlinkPSNAccountRequest& operator=(FUnlinkPSNAccountRequest&& src) = default;
+
         FUnlinkPSNAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkPSNAccountRequest()
         {
             readFromValue(obj);
@@ -10820,7 +15340,13 @@ namespace ServerModels
         ~FUnlinkPSNAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkPSNAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -10833,6 +15359,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkPSNAccountResult(FUnlinkPSNAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkPSNAccountResult& operator=(const FUnlinkPSNAccountResult& src) = default;
+        FUnlinkPSNAccountResult& operator=(FUnlinkPSNAccountResult&& src) = default;
+
         FUnlinkPSNAccountResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkPSNAccountResult()
         {
             readFromValue(obj);
@@ -10841,7 +15374,13 @@ namespace ServerModels
         ~FUnlinkPSNAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkServerCustomIdRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10868,6 +15407,16 @@ namespace ServerModels
             ServerCustomId(src.ServerCustomId)
             {}
 
+        FUnlinkServerCustomIdRequest(FUnlinkServerCustomIdRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            ServerCustomId(MoveTemp(src.ServerCustomId))
+            {}
+
+        FUnlinkServerCustomIdRequest& operator=(const FUnlinkServerCustomIdRequest& src) = default;
+        FUnlinkServerCustomIdRequest& operator=(FUnlinkServerCustomIdRequest&& src) = default;
+
         FUnlinkServerCustomIdRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkServerCustomIdRequest()
         {
             readFromValue(obj);
@@ -10876,7 +15425,13 @@ namespace ServerModels
         ~FUnlinkServerCustomIdRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkServerCustomIdResult : public PlayFab::FPlayFabCppResultCommon
@@ -10889,6 +15444,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkServerCustomIdResult(FUnlinkServerCustomIdResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkServerCustomIdResult& operator=(const FUnlinkServerCustomIdResult& src) = default;
+        FUnlinkServerCustomIdResult& operator=(FUnlinkServerCustomIdResult&& src) = default;
+
         FUnlinkServerCustomIdResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkServerCustomIdResult()
         {
             readFromValue(obj);
@@ -10897,7 +15459,13 @@ namespace ServerModels
         ~FUnlinkServerCustomIdResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkXboxAccountRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10919,6 +15487,15 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FUnlinkXboxAccountRequest(FUnlinkXboxAccountRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FUnlinkXboxAccountRequest& operator=(const FUnlinkXboxAccountRequest& src) = default;
+        FUnlinkXboxAccountRequest& operator=(FUnlinkXboxAccountRequest&& src) = default;
+
         FUnlinkXboxAccountRequest(const TSharedPtr<FJsonObject>& obj) : FUnlinkXboxAccountRequest()
         {
             readFromValue(obj);
@@ -10927,7 +15504,13 @@ namespace ServerModels
         ~FUnlinkXboxAccountRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlinkXboxAccountResult : public PlayFab::FPlayFabCppResultCommon
@@ -10940,6 +15523,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FUnlinkXboxAccountResult(FUnlinkXboxAccountResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUnlinkXboxAccountResult& operator=(const FUnlinkXboxAccountResult& src) = default;
+        FUnlinkXboxAccountResult& operator=(FUnlinkXboxAccountResult&& src) = default;
+
         FUnlinkXboxAccountResult(const TSharedPtr<FJsonObject>& obj) : FUnlinkXboxAccountResult()
         {
             readFromValue(obj);
@@ -10948,7 +15538,13 @@ namespace ServerModels
         ~FUnlinkXboxAccountResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlockContainerInstanceRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -10996,6 +15592,19 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FUnlockContainerInstanceRequest(FUnlockContainerInstanceRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            ContainerItemInstanceId(MoveTemp(src.ContainerItemInstanceId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            KeyItemInstanceId(MoveTemp(src.KeyItemInstanceId)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FUnlockContainerInstanceRequest& operator=(const FUnlockContainerInstanceRequest& src) = default;
+        FUnlockContainerInstanceRequest& operator=(FUnlockContainerInstanceRequest&& src) = default;
+
         FUnlockContainerInstanceRequest(const TSharedPtr<FJsonObject>& obj) : FUnlockContainerInstanceRequest()
         {
             readFromValue(obj);
@@ -11004,7 +15613,13 @@ namespace ServerModels
         ~FUnlockContainerInstanceRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlockContainerItemRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11044,6 +15659,18 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FUnlockContainerItemRequest(FUnlockContainerItemRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CatalogVersion(MoveTemp(src.CatalogVersion)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            ContainerItemId(MoveTemp(src.ContainerItemId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FUnlockContainerItemRequest& operator=(const FUnlockContainerItemRequest& src) = default;
+        FUnlockContainerItemRequest& operator=(FUnlockContainerItemRequest&& src) = default;
+
         FUnlockContainerItemRequest(const TSharedPtr<FJsonObject>& obj) : FUnlockContainerItemRequest()
         {
             readFromValue(obj);
@@ -11052,7 +15679,13 @@ namespace ServerModels
         ~FUnlockContainerItemRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUnlockContainerItemResult : public PlayFab::FPlayFabCppResultCommon
@@ -11083,6 +15716,17 @@ namespace ServerModels
             VirtualCurrency(src.VirtualCurrency)
             {}
 
+        FUnlockContainerItemResult(FUnlockContainerItemResult&& src) :
+            FPlayFabCppResultCommon(),
+            GrantedItems(MoveTemp(src.GrantedItems)),
+            UnlockedItemInstanceId(MoveTemp(src.UnlockedItemInstanceId)),
+            UnlockedWithItemInstanceId(MoveTemp(src.UnlockedWithItemInstanceId)),
+            VirtualCurrency(MoveTemp(src.VirtualCurrency))
+            {}
+
+        FUnlockContainerItemResult& operator=(const FUnlockContainerItemResult& src) = default;
+        FUnlockContainerItemResult& operator=(FUnlockContainerItemResult&& src) = default;
+
         FUnlockContainerItemResult(const TSharedPtr<FJsonObject>& obj) : FUnlockContainerItemResult()
         {
             readFromValue(obj);
@@ -11091,7 +15735,13 @@ namespace ServerModels
         ~FUnlockContainerItemResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateAvatarUrlRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11114,6 +15764,15 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FUpdateAvatarUrlRequest(FUpdateAvatarUrlRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            ImageUrl(MoveTemp(src.ImageUrl)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FUpdateAvatarUrlRequest& operator=(const FUpdateAvatarUrlRequest& src) = default;
+        FUpdateAvatarUrlRequest& operator=(FUpdateAvatarUrlRequest&& src) = default;
+
         FUpdateAvatarUrlRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateAvatarUrlRequest()
         {
             readFromValue(obj);
@@ -11122,7 +15781,13 @@ namespace ServerModels
         ~FUpdateAvatarUrlRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateBanRequest : public PlayFab::FPlayFabCppBaseModel
@@ -11170,6 +15835,20 @@ namespace ServerModels
             Reason(src.Reason)
             {}
 
+        FUpdateBanRequest(FUpdateBanRequest&& src) :
+            FPlayFabCppBaseModel(),
+            Active(MoveTemp(src.Active)),
+            BanId(MoveTemp(src.BanId)),
+            Expires(MoveTemp(src.Expires)),
+            IPAddress(MoveTemp(src.IPAddress)),
+            MACAddress(MoveTemp(src.MACAddress)),
+            Permanent(MoveTemp(src.Permanent)),
+            Reason(MoveTemp(src.Reason))
+            {}
+
+        FUpdateBanRequest& operator=(const FUpdateBanRequest& src) = default;
+        FUpdateBanRequest& operator=(FUpdateBanRequest&& src) = default;
+
         FUpdateBanRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateBanRequest()
         {
             readFromValue(obj);
@@ -11178,7 +15857,13 @@ namespace ServerModels
         ~FUpdateBanRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateBansRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11195,6 +15880,14 @@ namespace ServerModels
             Bans(src.Bans)
             {}
 
+        FUpdateBansRequest(FUpdateBansRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Bans(MoveTemp(src.Bans))
+            {}
+
+        FUpdateBansRequest& operator=(const FUpdateBansRequest& src) = default;
+        FUpdateBansRequest& operator=(FUpdateBansRequest&& src) = default;
+
         FUpdateBansRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateBansRequest()
         {
             readFromValue(obj);
@@ -11203,7 +15896,13 @@ namespace ServerModels
         ~FUpdateBansRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateBansResult : public PlayFab::FPlayFabCppResultCommon
@@ -11220,6 +15919,14 @@ namespace ServerModels
             BanData(src.BanData)
             {}
 
+        FUpdateBansResult(FUpdateBansResult&& src) :
+            FPlayFabCppResultCommon(),
+            BanData(MoveTemp(src.BanData))
+            {}
+
+        FUpdateBansResult& operator=(const FUpdateBansResult& src) = default;
+        FUpdateBansResult& operator=(FUpdateBansResult&& src) = default;
+
         FUpdateBansResult(const TSharedPtr<FJsonObject>& obj) : FUpdateBansResult()
         {
             readFromValue(obj);
@@ -11228,7 +15935,13 @@ namespace ServerModels
         ~FUpdateBansResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateCharacterDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11274,6 +15987,19 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FUpdateCharacterDataRequest(FUpdateCharacterDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Data(MoveTemp(src.Data)),
+            KeysToRemove(MoveTemp(src.KeysToRemove)),
+            Permission(MoveTemp(src.Permission)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FUpdateCharacterDataRequest& operator=(const FUpdateCharacterDataRequest& src) = default;
+        FUpdateCharacterDataRequest& operator=(FUpdateCharacterDataRequest&& src) = default;
+
         FUpdateCharacterDataRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateCharacterDataRequest()
         {
             readFromValue(obj);
@@ -11282,7 +16008,13 @@ namespace ServerModels
         ~FUpdateCharacterDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateCharacterDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -11303,6 +16035,14 @@ namespace ServerModels
             DataVersion(src.DataVersion)
             {}
 
+        FUpdateCharacterDataResult(FUpdateCharacterDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            DataVersion(MoveTemp(src.DataVersion))
+            {}
+
+        FUpdateCharacterDataResult& operator=(const FUpdateCharacterDataResult& src) = default;
+        FUpdateCharacterDataResult& operator=(FUpdateCharacterDataResult&& src) = default;
+
         FUpdateCharacterDataResult(const TSharedPtr<FJsonObject>& obj) : FUpdateCharacterDataResult()
         {
             readFromValue(obj);
@@ -11311,7 +16051,13 @@ namespace ServerModels
         ~FUpdateCharacterDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateCharacterStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11342,6 +16088,17 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FUpdateCharacterStatisticsRequest(FUpdateCharacterStatisticsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CharacterStatistics(MoveTemp(src.CharacterStatistics)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FUpdateCharacterStatisticsRequest& operator=(const FUpdateCharacterStatisticsRequest& src) = default;
+        FUpdateCharacterStatisticsRequest& operator=(FUpdateCharacterStatisticsRequest&& src) = default;
+
         FUpdateCharacterStatisticsRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateCharacterStatisticsRequest()
         {
             readFromValue(obj);
@@ -11350,7 +16107,13 @@ namespace ServerModels
         ~FUpdateCharacterStatisticsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateCharacterStatisticsResult : public PlayFab::FPlayFabCppResultCommon
@@ -11363,6 +16126,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FUpdateCharacterStatisticsResult(FUpdateCharacterStatisticsResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUpdateCharacterStatisticsResult& operator=(const FUpdateCharacterStatisticsResult& src) = default;
+        FUpdateCharacterStatisticsResult& operator=(FUpdateCharacterStatisticsResult&& src) = default;
+
         FUpdateCharacterStatisticsResult(const TSharedPtr<FJsonObject>& obj) : FUpdateCharacterStatisticsResult()
         {
             readFromValue(obj);
@@ -11371,7 +16141,13 @@ namespace ServerModels
         ~FUpdateCharacterStatisticsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdatePlayerStatisticsRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11405,6 +16181,17 @@ namespace ServerModels
             Statistics(src.Statistics)
             {}
 
+        FUpdatePlayerStatisticsRequest(FUpdatePlayerStatisticsRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            ForceUpdate(MoveTemp(src.ForceUpdate)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Statistics(MoveTemp(src.Statistics))
+            {}
+
+        FUpdatePlayerStatisticsRequest& operator=(const FUpdatePlayerStatisticsRequest& src) = default;
+        FUpdatePlayerStatisticsRequest& operator=(FUpdatePlayerStatisticsRequest&& src) = default;
+
         FUpdatePlayerStatisticsRequest(const TSharedPtr<FJsonObject>& obj) : FUpdatePlayerStatisticsRequest()
         {
             readFromValue(obj);
@@ -11413,7 +16200,13 @@ namespace ServerModels
         ~FUpdatePlayerStatisticsRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdatePlayerStatisticsResult : public PlayFab::FPlayFabCppResultCommon
@@ -11426,6 +16219,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FUpdatePlayerStatisticsResult(FUpdatePlayerStatisticsResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUpdatePlayerStatisticsResult& operator=(const FUpdatePlayerStatisticsResult& src) = default;
+        FUpdatePlayerStatisticsResult& operator=(FUpdatePlayerStatisticsResult&& src) = default;
+
         FUpdatePlayerStatisticsResult(const TSharedPtr<FJsonObject>& obj) : FUpdatePlayerStatisticsResult()
         {
             readFromValue(obj);
@@ -11434,7 +16234,13 @@ namespace ServerModels
         ~FUpdatePlayerStatisticsResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateSharedGroupDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11475,6 +16281,18 @@ namespace ServerModels
             SharedGroupId(src.SharedGroupId)
             {}
 
+        FUpdateSharedGroupDataRequest(FUpdateSharedGroupDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Data(MoveTemp(src.Data)),
+            KeysToRemove(MoveTemp(src.KeysToRemove)),
+            Permission(MoveTemp(src.Permission)),
+            SharedGroupId(MoveTemp(src.SharedGroupId))
+            {}
+
+        FUpdateSharedGroupDataRequest& operator=(const FUpdateSharedGroupDataRequest& src) = default;
+        FUpdateSharedGroupDataRequest& operator=(FUpdateSharedGroupDataRequest&& src) = default;
+
         FUpdateSharedGroupDataRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateSharedGroupDataRequest()
         {
             readFromValue(obj);
@@ -11483,7 +16301,13 @@ namespace ServerModels
         ~FUpdateSharedGroupDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateSharedGroupDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -11496,6 +16320,13 @@ namespace ServerModels
             FPlayFabCppResultCommon()
             {}
 
+        FUpdateSharedGroupDataResult(FUpdateSharedGroupDataResult&& src) :
+            FPlayFabCppResultCommon()
+            {}
+
+        FUpdateSharedGroupDataResult& operator=(const FUpdateSharedGroupDataResult& src) = default;
+        FUpdateSharedGroupDataResult& operator=(FUpdateSharedGroupDataResult&& src) = default;
+
         FUpdateSharedGroupDataResult(const TSharedPtr<FJsonObject>& obj) : FUpdateSharedGroupDataResult()
         {
             readFromValue(obj);
@@ -11504,7 +16335,13 @@ namespace ServerModels
         ~FUpdateSharedGroupDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateUserDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11545,6 +16382,18 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FUpdateUserDataRequest(FUpdateUserDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Data(MoveTemp(src.Data)),
+            KeysToRemove(MoveTemp(src.KeysToRemove)),
+            Permission(MoveTemp(src.Permission)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FUpdateUserDataRequest& operator=(const FUpdateUserDataRequest& src) = default;
+        FUpdateUserDataRequest& operator=(FUpdateUserDataRequest&& src) = default;
+
         FUpdateUserDataRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateUserDataRequest()
         {
             readFromValue(obj);
@@ -11553,7 +16402,13 @@ namespace ServerModels
         ~FUpdateUserDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateUserDataResult : public PlayFab::FPlayFabCppResultCommon
@@ -11574,6 +16429,14 @@ namespace ServerModels
             DataVersion(src.DataVersion)
             {}
 
+        FUpdateUserDataResult(FUpdateUserDataResult&& src) :
+            FPlayFabCppResultCommon(),
+            DataVersion(MoveTemp(src.DataVersion))
+            {}
+
+        FUpdateUserDataResult& operator=(const FUpdateUserDataResult& src) = default;
+        FUpdateUserDataResult& operator=(FUpdateUserDataResult&& src) = default;
+
         FUpdateUserDataResult(const TSharedPtr<FJsonObject>& obj) : FUpdateUserDataResult()
         {
             readFromValue(obj);
@@ -11582,7 +16445,13 @@ namespace ServerModels
         ~FUpdateUserDataResult();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateUserInternalDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11618,6 +16487,17 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FUpdateUserInternalDataRequest(FUpdateUserInternalDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Data(MoveTemp(src.Data)),
+            KeysToRemove(MoveTemp(src.KeysToRemove)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FUpdateUserInternalDataRequest& operator=(const FUpdateUserInternalDataRequest& src) = default;
+        FUpdateUserInternalDataRequest& operator=(FUpdateUserInternalDataRequest&& src) = default;
+
         FUpdateUserInternalDataRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateUserInternalDataRequest()
         {
             readFromValue(obj);
@@ -11626,7 +16506,13 @@ namespace ServerModels
         ~FUpdateUserInternalDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FUpdateUserInventoryItemDataRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11672,6 +16558,19 @@ namespace ServerModels
             PlayFabId(src.PlayFabId)
             {}
 
+        FUpdateUserInventoryItemDataRequest(FUpdateUserInventoryItemDataRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            Data(MoveTemp(src.Data)),
+            ItemInstanceId(MoveTemp(src.ItemInstanceId)),
+            KeysToRemove(MoveTemp(src.KeysToRemove)),
+            PlayFabId(MoveTemp(src.PlayFabId))
+            {}
+
+        FUpdateUserInventoryItemDataRequest& operator=(const FUpdateUserInventoryItemDataRequest& src) = default;
+        FUpdateUserInventoryItemDataRequest& operator=(FUpdateUserInventoryItemDataRequest&& src) = default;
+
         FUpdateUserInventoryItemDataRequest(const TSharedPtr<FJsonObject>& obj) : FUpdateUserInventoryItemDataRequest()
         {
             readFromValue(obj);
@@ -11680,7 +16579,13 @@ namespace ServerModels
         ~FUpdateUserInventoryItemDataRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FWriteEventResponse : public PlayFab::FPlayFabCppResultCommon
@@ -11701,6 +16606,14 @@ namespace ServerModels
             EventId(src.EventId)
             {}
 
+        FWriteEventResponse(FWriteEventResponse&& src) :
+            FPlayFabCppResultCommon(),
+            EventId(MoveTemp(src.EventId))
+            {}
+
+        FWriteEventResponse& operator=(const FWriteEventResponse& src) = default;
+        FWriteEventResponse& operator=(FWriteEventResponse&& src) = default;
+
         FWriteEventResponse(const TSharedPtr<FJsonObject>& obj) : FWriteEventResponse()
         {
             readFromValue(obj);
@@ -11709,7 +16622,13 @@ namespace ServerModels
         ~FWriteEventResponse();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FWriteServerCharacterEventRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11753,6 +16672,19 @@ namespace ServerModels
             Timestamp(src.Timestamp)
             {}
 
+        FWriteServerCharacterEventRequest(FWriteServerCharacterEventRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Body(MoveTemp(src.Body)),
+            CharacterId(MoveTemp(src.CharacterId)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EventName(MoveTemp(src.EventName)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Timestamp(MoveTemp(src.Timestamp))
+            {}
+
+        FWriteServerCharacterEventRequest& operator=(const FWriteServerCharacterEventRequest& src) = default;
+        FWriteServerCharacterEventRequest& operator=(FWriteServerCharacterEventRequest&& src) = default;
+
         FWriteServerCharacterEventRequest(const TSharedPtr<FJsonObject>& obj) : FWriteServerCharacterEventRequest()
         {
             readFromValue(obj);
@@ -11761,7 +16693,13 @@ namespace ServerModels
         ~FWriteServerCharacterEventRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FWriteServerPlayerEventRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11800,6 +16738,18 @@ namespace ServerModels
             Timestamp(src.Timestamp)
             {}
 
+        FWriteServerPlayerEventRequest(FWriteServerPlayerEventRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Body(MoveTemp(src.Body)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EventName(MoveTemp(src.EventName)),
+            PlayFabId(MoveTemp(src.PlayFabId)),
+            Timestamp(MoveTemp(src.Timestamp))
+            {}
+
+        FWriteServerPlayerEventRequest& operator=(const FWriteServerPlayerEventRequest& src) = default;
+        FWriteServerPlayerEventRequest& operator=(FWriteServerPlayerEventRequest&& src) = default;
+
         FWriteServerPlayerEventRequest(const TSharedPtr<FJsonObject>& obj) : FWriteServerPlayerEventRequest()
         {
             readFromValue(obj);
@@ -11808,7 +16758,13 @@ namespace ServerModels
         ~FWriteServerPlayerEventRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
     struct PLAYFABCPP_API FWriteTitleEventRequest : public PlayFab::FPlayFabCppRequestCommon
@@ -11842,6 +16798,17 @@ namespace ServerModels
             Timestamp(src.Timestamp)
             {}
 
+        FWriteTitleEventRequest(FWriteTitleEventRequest&& src) :
+            FPlayFabCppRequestCommon(),
+            Body(MoveTemp(src.Body)),
+            CustomTags(MoveTemp(src.CustomTags)),
+            EventName(MoveTemp(src.EventName)),
+            Timestamp(MoveTemp(src.Timestamp))
+            {}
+
+        FWriteTitleEventRequest& operator=(const FWriteTitleEventRequest& src) = default;
+        FWriteTitleEventRequest& operator=(FWriteTitleEventRequest&& src) = default;
+
         FWriteTitleEventRequest(const TSharedPtr<FJsonObject>& obj) : FWriteTitleEventRequest()
         {
             readFromValue(obj);
@@ -11850,7 +16817,13 @@ namespace ServerModels
         ~FWriteTitleEventRequest();
 
         void writeJSON(JsonWriter& writer) const override;
+        void writeJSON(JsonUtf8Writer& writer) const override;
         bool readFromValue(const TSharedPtr<FJsonObject>& obj) override;
+        bool readFromReader(FPlayFabJsonPullReader& reader) override;
+
+    private:
+        template <typename WriterType>
+        void writeJSONObject(WriterType& writer) const;
     };
 
 }
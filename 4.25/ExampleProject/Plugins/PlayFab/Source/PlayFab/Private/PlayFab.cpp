@@ -12,6 +12,7 @@
 #include "PlayFabPrivate.h"
 #include "PlayFabJsonValue.h"
 #include "PlayFabJsonObject.h"
+#include "PlayFabObjectPool.h"
 
 
 #include "PlayFabAdminAPI.h" 
@@ -52,11 +53,13 @@ class FPlayFab : public IPlayFab
         UPlayFabLocalizationAPI::StaticClass();
         UPlayFabMultiplayerAPI::StaticClass();
         UPlayFabProfilesAPI::StaticClass();
+
+        FPlayFabObjectPool::Startup();
     }
 
     virtual void ShutdownModule() override
     {
-
+        FPlayFabObjectPool::Shutdown();
     }
 
 };
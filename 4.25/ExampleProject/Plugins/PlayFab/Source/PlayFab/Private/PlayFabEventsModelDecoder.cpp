@@ -11,6 +11,7 @@
 
 #include "PlayFabEventsModelDecoder.h"
 #include "PlayFabPrivate.h"
+#include "PlayFabJsonDecoder.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Events API Functions
@@ -25,9 +26,9 @@ FEventsWriteEventsResponse UPlayFabEventsModelDecoder::decodeWriteEventsResponse
 {
     // Temp ustruct
     FEventsWriteEventsResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.AssignedEventIds = !(dataObj->HasField("AssignedEventIds")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("AssignedEventIds"), TEXT(","));
+    tempStruct.AssignedEventIds = FPlayFabJsonDecoder::GetJoinedStringArray(dataObj, TEXT("AssignedEventIds"));
 
     return tempStruct;
 }
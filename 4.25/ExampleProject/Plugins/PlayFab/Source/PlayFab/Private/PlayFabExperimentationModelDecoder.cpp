@@ -11,6 +11,7 @@
 
 #include "PlayFabExperimentationModelDecoder.h"
 #include "PlayFabPrivate.h"
+#include "PlayFabJsonDecoder.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Experimentation API Functions
@@ -25,9 +26,9 @@ FExperimentationCreateExclusionGroupResult UPlayFabExperimentationModelDecoder::
 {
     // Temp ustruct
     FExperimentationCreateExclusionGroupResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ExclusionGroupId = !(dataObj->HasField("ExclusionGroupId")) ? TEXT("") : dataObj->GetStringField("ExclusionGroupId");
+    tempStruct.ExclusionGroupId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ExclusionGroupId"));
 
     return tempStruct;
 }
@@ -36,9 +37,9 @@ FExperimentationCreateExperimentResult UPlayFabExperimentationModelDecoder::deco
 {
     // Temp ustruct
     FExperimentationCreateExperimentResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ExperimentId = !(dataObj->HasField("ExperimentId")) ? TEXT("") : dataObj->GetStringField("ExperimentId");
+    tempStruct.ExperimentId = FPlayFabJsonDecoder::GetString(dataObj, TEXT("ExperimentId"));
 
     return tempStruct;
 }
@@ -56,9 +57,9 @@ FExperimentationGetExclusionGroupsResult UPlayFabExperimentationModelDecoder::de
 {
     // Temp ustruct
     FExperimentationGetExclusionGroupsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.ExclusionGroups = !(dataObj->HasField("ExclusionGroups")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("ExclusionGroups");
+    tempStruct.ExclusionGroups = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("ExclusionGroups"));
 
     return tempStruct;
 }
@@ -67,9 +68,9 @@ FExperimentationGetExclusionGroupTrafficResult UPlayFabExperimentationModelDecod
 {
     // Temp ustruct
     FExperimentationGetExclusionGroupTrafficResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.TrafficAllocations = !(dataObj->HasField("TrafficAllocations")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("TrafficAllocations");
+    tempStruct.TrafficAllocations = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("TrafficAllocations"));
 
     return tempStruct;
 }
@@ -78,9 +79,9 @@ FExperimentationGetExperimentsResult UPlayFabExperimentationModelDecoder::decode
 {
     // Temp ustruct
     FExperimentationGetExperimentsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Experiments = !(dataObj->HasField("Experiments")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Experiments");
+    tempStruct.Experiments = FPlayFabJsonDecoder::GetObjectArray(dataObj, TEXT("Experiments"));
 
     return tempStruct;
 }
@@ -89,9 +90,9 @@ FExperimentationGetLatestScorecardResult UPlayFabExperimentationModelDecoder::de
 {
     // Temp ustruct
     FExperimentationGetLatestScorecardResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.Scorecard = !(dataObj->HasField("Scorecard")) ? nullptr : dataObj->GetObjectField("Scorecard");
+    tempStruct.Scorecard = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("Scorecard"));
 
     return tempStruct;
 }
@@ -100,9 +101,9 @@ FExperimentationGetTreatmentAssignmentResult UPlayFabExperimentationModelDecoder
 {
     // Temp ustruct
     FExperimentationGetTreatmentAssignmentResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FJsonObject* dataObj = FPlayFabJsonDecoder::GetData(response);
 
-    tempStruct.TreatmentAssignment = !(dataObj->HasField("TreatmentAssignment")) ? nullptr : dataObj->GetObjectField("TreatmentAssignment");
+    tempStruct.TreatmentAssignment = FPlayFabJsonDecoder::GetObject(dataObj, TEXT("TreatmentAssignment"));
 
     return tempStruct;
 }
@@ -0,0 +1,146 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabRequestWriter.h"
+#include "PlayFabJsonObject.h"
+
+FPlayFabRequestWriter::FPlayFabRequestWriter()
+    : Stream(Body)
+    , Writer(TJsonWriterFactory<TCHAR, PlayFab::FPlayFabCondensedUtf8PrintPolicy>::Create(&Stream))
+{
+    Writer->WriteObjectStart();
+}
+
+void FPlayFabRequestWriter::WriteString(const TCHAR* FieldName, const FString& Value)
+{
+    Writer->WriteValue(FieldName, Value);
+}
+
+void FPlayFabRequestWriter::WriteStringOrNull(const TCHAR* FieldName, const FString& Value)
+{
+    if (Value.IsEmpty())
+    {
+        Writer->WriteNull(FieldName);
+    }
+    else
+    {
+        Writer->WriteValue(FieldName, Value);
+    }
+}
+
+void FPlayFabRequestWriter::WriteStringArray(const TCHAR* FieldName, const FString& Values)
+{
+    if (Values.IsEmpty())
+    {
+        Writer->WriteNull(FieldName);
+        return;
+    }
+
+    // Empty entries are kept, as FString::ParseIntoArray did with bCullEmpty false
+    Writer->WriteArrayStart(FieldName);
+    int32 Start = 0;
+    for (int32 Index = 0; Index <= Values.Len(); ++Index)
+    {
+        if (Index == Values.Len() || Values[Index] == TEXT(','))
+        {
+            Writer->WriteValue(Values.Mid(Start, Index - Start));
+            Start = Index + 1;
+        }
+    }
+    Writer->WriteArrayEnd();
+}
+
+void FPlayFabRequestWriter::WriteNumber(const TCHAR* FieldName, int32 Value)
+{
+    Writer->WriteValue(FieldName, Value);
+}
+
+void FPlayFabRequestWriter::WriteNumberArray(const TCHAR* FieldName, const TArray<int32>& Values)
+{
+    if (Values.Num() == 0)
+    {
+        Writer->WriteNull(FieldName);
+        return;
+    }
+
+    Writer->WriteArrayStart(FieldName);
+    for (int32 Value : Values)
+    {
+        Writer->WriteValue(Value);
+    }
+    Writer->WriteArrayEnd();
+}
+
+void FPlayFabRequestWriter::WriteBool(const TCHAR* FieldName, bool Value)
+{
+    Writer->WriteValue(FieldName, Value);
+}
+
+void FPlayFabRequestWriter::WriteBoolArray(const TCHAR* FieldName, const TArray<bool>& Values)
+{
+    if (Values.Num() == 0)
+    {
+        Writer->WriteNull(FieldName);
+        return;
+    }
+
+    Writer->WriteArrayStart(FieldName);
+    for (bool Value : Values)
+    {
+        Writer->WriteValue(Value);
+    }
+    Writer->WriteArrayEnd();
+}
+
+void FPlayFabRequestWriter::WriteObject(const TCHAR* FieldName, UPlayFabJsonObject* Value)
+{
+    if (Value != nullptr)
+    {
+        Writer->WriteIdentifierPrefix(FieldName);
+        WriteJsonObject(Value);
+    }
+}
+
+void FPlayFabRequestWriter::WriteObjectArray(const TCHAR* FieldName, const TArray<UPlayFabJsonObject*>& Values)
+{
+    if (Values.Num() == 0)
+    {
+        Writer->WriteNull(FieldName);
+        return;
+    }
+
+    Writer->WriteArrayStart(FieldName);
+    for (UPlayFabJsonObject* Value : Values)
+    {
+        WriteJsonObject(Value);
+    }
+    Writer->WriteArrayEnd();
+}
+
+TArray<uint8> FPlayFabRequestWriter::Finish()
+{
+    Writer->WriteObjectEnd();
+    Writer->Close();
+    return MoveTemp(Body);
+}
+
+FString FPlayFabRequestWriter::ToString(const TArray<uint8>& Body)
+{
+    FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Body.GetData()), Body.Num());
+    return FString(Converter.Length(), Converter.Get());
+}
+
+void FPlayFabRequestWriter::WriteJsonObject(UPlayFabJsonObject* Value)
+{
+    // Objects built in Blueprint are already a json tree, which is written as it stands
+    if (Value != nullptr && Value->GetRootObject().IsValid())
+    {
+        PlayFab::FJsonKeeper(Value->GetRootObject()).writeJSON(Writer);
+    }
+    else
+    {
+        Writer->WriteNull();
+    }
+}
@@ -0,0 +1,717 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "Tests/PlayFabCppCoreTests.h"
+
+#include "Core/PlayFabCircuitBreaker.h"
+#include "Core/PlayFabClientAPI.h"
+#include "Core/PlayFabCompression.h"
+#include "Core/PlayFabDataDataModels.h"
+#include "Core/PlayFabJsonPullReader.h"
+#include "Core/PlayFabRequestCoalescer.h"
+#include "Core/PlayFabRequestGovernor.h"
+#include "Core/PlayFabRequestHandle.h"
+#include "Core/PlayFabResultHandler.h"
+#include "Core/PlayFabRetryPolicy.h"
+#include "PlayFabCommonUtils.h"
+#include "PlayFabRequestLog.h"
+#include "PlayFabRuntimeSettings.h"
+#include "Dom/JsonObject.h"
+#include "HttpModule.h"
+#include "Misc/ScopeLock.h"
+#include "TestFramework/PlayFabTestRunner.h"
+
+namespace
+{
+    TArray<uint8> ToUtf8(const ANSICHAR* Json)
+    {
+        return TArray<uint8>(reinterpret_cast<const uint8*>(Json), FCStringAnsi::Strlen(Json));
+    }
+
+    // A read with the given body and session ticket, as the Client API would send it
+    TSharedRef<IHttpRequest> MakeReadRequest(const FString& Url, const FString& Body, const FString& SessionTicket)
+    {
+        auto HttpRequest = FHttpModule::Get().CreateRequest();
+        HttpRequest->SetURL(Url);
+        HttpRequest->SetVerb(TEXT("POST"));
+        HttpRequest->SetHeader(TEXT("X-Authorization"), SessionTicket);
+        HttpRequest->SetContentAsString(Body);
+        return HttpRequest;
+    }
+
+    // Overwrites ISIZE, the uncompressed size at the end of a gzip body
+    void SetGzipSize(TArray<uint8>& Gzip, uint32 UncompressedSize)
+    {
+        const int32 Trailer = Gzip.Num() - 4;
+        for (int32 Idx = 0; Idx < 4; Idx++)
+        {
+            Gzip[Trailer + Idx] = (UncompressedSize >> (8 * Idx)) & 0xFF;
+        }
+    }
+
+    PlayFab::FPlayFabCppError MakeCppError(int32 HttpCode, int32 ErrorCode)
+    {
+        PlayFab::FPlayFabCppError Error;
+        Error.HttpCode = HttpCode;
+        Error.ErrorCode = ErrorCode;
+        return Error;
+    }
+}
+
+void UPlayFabCppCoreTests::ClassSetUp()
+{
+
+    ClientAPI = IPlayFabModuleInterface::Get().GetClientAPI();
+
+}
+
+void UPlayFabCppCoreTests::SetUp(UPlayFabTestContext* testContext)
+{
+    CurrentTestContext = testContext;
+    FailedExpectations.Reset();
+}
+
+void UPlayFabCppCoreTests::Tick(UPlayFabTestContext* testContext)
+{
+    // The cancelled call passes once it has had time to complete without running a delegate
+    if (CancelledCallDeadline > 0.0 && FPlatformTime::Seconds() >= CancelledCallDeadline)
+    {
+        CancelledCallDeadline = 0.0;
+        Expect(CancelledCallDelegates == 0, TEXT("A delegate ran after its call was cancelled"));
+        FinishTest();
+    }
+
+    if (ReusedHandleDeadline > 0.0)
+    {
+        ReusedHandle_Tick();
+    }
+
+}
+
+void UPlayFabCppCoreTests::Expect(bool bCondition, const TCHAR* Description)
+{
+    if (!bCondition)
+    {
+        UE_LOG(LogPlayFabTests, Error, TEXT("%s: %s"), *CurrentTestContext->testName, Description);
+        FailedExpectations.Add(Description);
+    }
+}
+
+void UPlayFabCppCoreTests::FinishTest()
+{
+    if (FailedExpectations.Num() > 0)
+    {
+        CurrentTestContext->EndTest(PlayFabApiTestFinishState::FAILED, FString::Join(FailedExpectations, TEXT("; ")));
+        return;
+    }
+    CurrentTestContext->EndTest();
+}
+
+void UPlayFabCppCoreTests::JsonPullReaderRoundTrip()
+{
+    // Escapes, non-ASCII characters and a free-form object, written by a model and read back by the same model
+    const FString Text = FString::Printf(TEXT("Line\n\t\"quoted\" \\ %c%c"), (TCHAR)0x00E9, (TCHAR)0x4E16);
+    TSharedPtr<FJsonObject> Data = MakeShareable(new FJsonObject());
+    Data->SetNumberField(TEXT("Level"), 42);
+    Data->SetStringField(TEXT("Name"), Text);
+
+    PlayFab::DataModels::FSetObject Original;
+    Original.ObjectName = TEXT("Progress");
+    Original.EscapedDataObject = Text;
+    Original.DeleteObject = false;
+    Original.DataObject = Data;
+
+    const TArray<uint8> Json = Original.toJSONUtf8();
+    PlayFab::FPlayFabJsonPullReader Reader(Json);
+    PlayFab::DataModels::FSetObject Decoded;
+    Expect(Decoded.readFromReader(Reader), TEXT("The model could not be read back"));
+    Expect(Decoded.ObjectName == Original.ObjectName, TEXT("ObjectName changed"));
+    Expect(Decoded.EscapedDataObject == Text, TEXT("Escaped or non-ASCII characters changed"));
+    Expect(Decoded.DeleteObject.notNull() && !Decoded.DeleteObject, TEXT("DeleteObject changed"));
+
+    const TSharedPtr<FJsonObject>* DecodedData = nullptr;
+    Expect(Decoded.DataObject.GetJsonValue()->TryGetObject(DecodedData)
+        && (*DecodedData)->GetIntegerField(TEXT("Level")) == 42
+        && (*DecodedData)->GetStringField(TEXT("Name")) == Text, TEXT("DataObject changed"));
+
+    // Fields the reader isn't looking for are skipped whatever their shape, including brackets inside strings
+    const TArray<uint8> Document = ToUtf8("{ \"Skip\": {\"A\": [1, {\"B\": null}], \"C\": \"}]\"}, \"Count\": -7, \"Big\": 9007199254740993, \"Items\": [\"a\", \"b\"] }");
+    PlayFab::FPlayFabJsonPullReader DocumentReader(Document);
+    int32 Count = 0;
+    int64 Big = 0;
+    TArray<FString> Items;
+    Expect(DocumentReader.ReadObjectStart(), TEXT("The document is not an object"));
+    while (DocumentReader.NextField())
+    {
+        if (DocumentReader.IsField("Count"))
+        {
+            DocumentReader.ReadValue(Count);
+        }
+        else if (DocumentReader.IsField("Big"))
+        {
+            DocumentReader.ReadValue(Big);
+        }
+        else if (DocumentReader.IsField("Items") && DocumentReader.ReadArrayStart())
+        {
+            while (DocumentReader.NextArrayItem())
+            {
+                FString Item;
+                DocumentReader.ReadValue(Item);
+                Items.Add(Item);
+            }
+        }
+        else
+            DocumentReader.SkipValue();
+    }
+    Expect(DocumentReader.IsValid(), TEXT("A well-formed document was rejected"));
+    Expect(Count == -7, TEXT("Count was not read"));
+    Expect(Big == 9007199254740993ll, TEXT("A 64 bit integer lost precision"));
+    Expect(Items.Num() == 2 && Items[0] == TEXT("a") && Items[1] == TEXT("b"), TEXT("Items were not read"));
+
+    FinishTest();
+}
+
+void UPlayFabCppCoreTests::JsonPullReaderMalformedInput()
+{
+    int32 Count = 0;
+    FString Name;
+    bool bFlag = false;
+
+    // Truncated after a value
+    const TArray<uint8> Truncated = ToUtf8("{\"Count\": 1");
+    PlayFab::FPlayFabJsonPullReader TruncatedReader(Truncated);
+    TruncatedReader.ReadObjectStart();
+    TruncatedReader.NextField();
+    TruncatedReader.ReadValue(Count);
+    Expect(!TruncatedReader.NextField() && !TruncatedReader.IsValid(), TEXT("A truncated object was accepted"));
+
+    const TArray<uint8> MissingColon = ToUtf8("{\"Count\" 1}");
+    PlayFab::FPlayFabJsonPullReader MissingColonReader(MissingColon);
+    MissingColonReader.ReadObjectStart();
+    Expect(!MissingColonReader.NextField() && !MissingColonReader.IsValid(), TEXT("A field without a colon was accepted"));
+
+    const TArray<uint8> Unterminated = ToUtf8("{\"Name\": \"abc");
+    PlayFab::FPlayFabJsonPullReader UnterminatedReader(Unterminated);
+    UnterminatedReader.ReadObjectStart();
+    UnterminatedReader.NextField();
+    Expect(!UnterminatedReader.ReadValue(Name) && !UnterminatedReader.IsValid(), TEXT("An unterminated string was accepted"));
+
+    const TArray<uint8> BadEscape = ToUtf8("{\"Name\": \"\\uZZZZ\"}");
+    PlayFab::FPlayFabJsonPullReader BadEscapeReader(BadEscape);
+    BadEscapeReader.ReadObjectStart();
+    BadEscapeReader.NextField();
+    Expect(!BadEscapeReader.ReadValue(Name) && !BadEscapeReader.IsValid(), TEXT("An invalid escape sequence was accepted"));
+
+    const TArray<uint8> BadLiteral = ToUtf8("{\"Flag\": tru}");
+    PlayFab::FPlayFabJsonPullReader BadLiteralReader(BadLiteral);
+    BadLiteralReader.ReadObjectStart();
+    BadLiteralReader.NextField();
+    Expect(!BadLiteralReader.ReadValue(bFlag) && !BadLiteralReader.IsValid(), TEXT("A misspelled literal was accepted"));
+
+    const TArray<uint8> StrayBracket = ToUtf8("{\"Skip\": [1, 2]]}");
+    PlayFab::FPlayFabJsonPullReader StrayBracketReader(StrayBracket);
+    StrayBracketReader.ReadObjectStart();
+    StrayBracketReader.NextField();
+    StrayBracketReader.SkipValue();
+    StrayBracketReader.NextField();
+    Expect(!StrayBracketReader.IsValid(), TEXT("A stray bracket was accepted"));
+
+    // A value of the wrong type is skipped, and reading carries on
+    const TArray<uint8> WrongType = ToUtf8("{\"Count\": {\"Nested\": true}, \"Name\": \"abc\"}");
+    PlayFab::FPlayFabJsonPullReader WrongTypeReader(WrongType);
+    WrongTypeReader.ReadObjectStart();
+    WrongTypeReader.NextField();
+    Expect(!WrongTypeReader.ReadValue(Count), TEXT("An object was read as a number"));
+    Expect(WrongTypeReader.NextField() && WrongTypeReader.ReadValue(Name) && Name == TEXT("abc") && WrongTypeReader.IsValid(), TEXT("Reading stopped after a value of the wrong type"));
+
+    // Free-form values are read to a bounded depth, so a hostile document can't exhaust the stack
+    TArray<uint8> Shallow, Deep;
+    Shallow.Init('[', 200);
+    FMemory::Memset(Shallow.GetData() + 100, ']', 100);
+    PlayFab::FPlayFabJsonPullReader ShallowReader(Shallow);
+    ShallowReader.ReadJsonValue();
+    Expect(ShallowReader.IsValid(), TEXT("A value nested 100 levels deep was rejected"));
+
+    Deep.Init('[', 100000);
+    PlayFab::FPlayFabJsonPullReader DeepReader(Deep);
+    DeepReader.ReadJsonValue();
+    Expect(!DeepReader.IsValid(), TEXT("A value nested 100000 levels deep was accepted"));
+
+    // Once in error, every read fails, and a model reading malformed input is left empty
+    Expect(!TruncatedReader.ReadObjectStart() && !TruncatedReader.ReadValue(Name), TEXT("A reader in error went on reading"));
+
+    const TArray<uint8> TruncatedModel = ToUtf8("{\"ObjectName\": \"Progress\", \"EscapedDataObject\": \"{");
+    PlayFab::FPlayFabJsonPullReader TruncatedModelReader(TruncatedModel);
+    PlayFab::DataModels::FSetObject Decoded;
+    Expect(!Decoded.readFromReader(TruncatedModelReader), TEXT("A model was read from a truncated document"));
+    Expect(Decoded.ObjectName.IsEmpty(), TEXT("A model kept fields from a truncated document"));
+
+    // Null or mistyped items of an array of models are dropped rather than read as default models
+    const TArray<uint8> MixedItems = ToUtf8("{\"ProfileVersion\": 2, \"SetResults\": [null, {\"ObjectName\": \"Progress\"}, \"Stray\"]}");
+    PlayFab::FPlayFabJsonPullReader MixedItemsReader(MixedItems);
+    PlayFab::DataModels::FSetObjectsResponse Response;
+    Expect(Response.readFromReader(MixedItemsReader), TEXT("An array with null and mistyped items could not be read"));
+    Expect(Response.SetResults.Num() == 1 && Response.SetResults[0].ObjectName == TEXT("Progress"), TEXT("Null or mistyped items were read as models"));
+    Expect(Response.ProfileVersion == 2, TEXT("Fields around an array with null items were lost"));
+
+    FinishTest();
+}
+
+void UPlayFabCppCoreTests::RetryPolicy()
+{
+    UPlayFabRuntimeSettings* Settings = GetMutableDefault<UPlayFabRuntimeSettings>();
+    TGuardValue<bool> EnableRetries(Settings->bEnableAutomaticRetries, true);
+    TGuardValue<int32> MaxRetryAttempts(Settings->MaxRetryAttempts, 3);
+    TGuardValue<float> BaseDelay(Settings->RetryBaseDelaySeconds, 0.5f);
+    TGuardValue<float> MaxDelay(Settings->RetryMaxDelaySeconds, 4.0f);
+    TGuardValue<int32> Budget(Settings->RetryBudgetPerMinute, 100);
+
+    // Budgets are kept per title, so each run uses titles of its own
+    const FString TitleKey = FGuid::NewGuid().ToString();
+    const PlayFab::FPlayFabCppError Throttled = MakeCppError(429, PlayFab::PlayFabErrorAPIRequestLimitExceeded);
+    const PlayFab::FPlayFabCppError ServerError = MakeCppError(500, 0);
+    const PlayFab::FPlayFabCppError Timeout = MakeCppError(0, PlayFab::PlayFabErrorConnectionTimeout);
+    const PlayFab::FPlayFabCppError BadRequest = MakeCppError(400, PlayFab::PlayFabErrorInvalidParams);
+
+    Expect(PlayFab::FPlayFabRetryPolicy::IsThrottlingError(Throttled), TEXT("A 429 is not throttling"));
+    Expect(PlayFab::FPlayFabRetryPolicy::IsTransientError(ServerError) && PlayFab::FPlayFabRetryPolicy::IsTransientError(Timeout), TEXT("A server error or a timeout is not transient"));
+    Expect(!PlayFab::FPlayFabRetryPolicy::IsThrottlingError(BadRequest) && !PlayFab::FPlayFabRetryPolicy::IsTransientError(BadRequest), TEXT("A bad request would be retried"));
+
+    Expect(PlayFab::FPlayFabRetryPolicy::GetRetryDelay(BadRequest, true, 1, 0.0f, TitleKey) < 0.0f, TEXT("A bad request was retried"));
+    Expect(PlayFab::FPlayFabRetryPolicy::GetRetryDelay(ServerError, false, 1, 0.0f, TitleKey) < 0.0f, TEXT("A call that isn't idempotent was retried"));
+
+    // Full jitter below an exponential backoff: 0.5, 1, then 2 seconds
+    for (int32 RetryAttempt = 1; RetryAttempt <= 3; RetryAttempt++)
+    {
+        const float Delay = PlayFab::FPlayFabRetryPolicy::GetRetryDelay(Timeout, true, RetryAttempt, 0.0f, TitleKey);
+        Expect(Delay >= 0.0f && Delay <= 0.5f * (1 << (RetryAttempt - 1)), TEXT("A retry delay is outside its backoff"));
+    }
+    Expect(PlayFab::FPlayFabRetryPolicy::GetRetryDelay(Timeout, true, 4, 0.0f, TitleKey) < 0.0f, TEXT("A call was retried more than MaxRetryAttempts times"));
+
+    // Retry-After is a lower bound, and a wait longer than RetryMaxDelaySeconds isn't worth it
+    const float RetryAfterDelay = PlayFab::FPlayFabRetryPolicy::GetRetryDelay(Throttled, true, 1, 2.0f, TitleKey);
+    Expect(RetryAfterDelay >= 2.0f && RetryAfterDelay <= 4.0f, TEXT("Retry-After was not honoured"));
+    Expect(PlayFab::FPlayFabRetryPolicy::GetRetryDelay(Throttled, true, 1, 10.0f, TitleKey) < 0.0f, TEXT("A call was retried after a Retry-After beyond the maximum delay"));
+
+    // Once a title's budget is spent, its calls fail instead of retrying
+    {
+        TGuardValue<int32> SmallBudget(Settings->RetryBudgetPerMinute, 2);
+        const FString SmallBudgetTitleKey = FGuid::NewGuid().ToString();
+        Expect(PlayFab::FPlayFabRetryPolicy::GetRetryDelay(ServerError, true, 1, 0.0f, SmallBudgetTitleKey) >= 0.0f
+            && PlayFab::FPlayFabRetryPolicy::GetRetryDelay(ServerError, true, 1, 0.0f, SmallBudgetTitleKey) >= 0.0f, TEXT("A retry within the budget was refused"));
+        Expect(PlayFab::FPlayFabRetryPolicy::GetRetryDelay(ServerError, true, 1, 0.0f, SmallBudgetTitleKey) < 0.0f, TEXT("A retry beyond the budget was granted"));
+    }
+
+    {
+        TGuardValue<bool> DisableRetries(Settings->bEnableAutomaticRetries, false);
+        Expect(PlayFab::FPlayFabRetryPolicy::GetRetryDelay(ServerError, true, 1, 0.0f, TitleKey) < 0.0f, TEXT("A call was retried with retries disabled"));
+    }
+
+    FinishTest();
+}
+
+void UPlayFabCppCoreTests::RequestGovernor()
+{
+    // One call in flight per endpoint, and tokens to spare; the requests go to a closed local port
+    FPlayFabEndpointLimit Limit;
+    Limit.RequestsPerSecond = 100.0f;
+    Limit.BurstSize = 10;
+    Limit.MaxInFlight = 1;
+
+    // Endpoints keep the limits they first saw, so each run uses one of its own
+    const FString UrlPath = TEXT("/Test/Governor") + FGuid::NewGuid().ToString();
+    const FString Url = TEXT("https://127.0.0.1:1") + UrlPath;
+
+    UPlayFabRuntimeSettings* Settings = GetMutableDefault<UPlayFabRuntimeSettings>();
+    TGuardValue<bool> EnableGovernor(Settings->bEnableRequestGovernor, true);
+    TGuardValue<TMap<FString, FPlayFabEndpointLimit>> EndpointLimits(Settings->EndpointLimits, Settings->EndpointLimits);
+    Settings->EndpointLimits.Add(UrlPath, Limit);
+
+    // A request that can't be started frees its slot, so the next one is sent rather than queued behind it
+    // Requests without a url, which the engine refuses to start, share the endpoint with an empty path
+    Settings->EndpointLimits.Add(FString(), Limit);
+    auto Unsendable = FHttpModule::Get().CreateRequest();
+    auto NextUnsendable = FHttpModule::Get().CreateRequest();
+    Expect(!PlayFab::FPlayFabRequestGovernor::Submit(Unsendable, PlayFab::EPlayFabRequestPriority::Normal), TEXT("A request without a url was sent"));
+    Expect(!PlayFab::FPlayFabRequestGovernor::Submit(NextUnsendable, PlayFab::EPlayFabRequestPriority::Normal), TEXT("A failed send kept its slot"));
+    PlayFab::FPlayFabRequestGovernor::Withdraw(NextUnsendable);
+
+    auto First = FHttpModule::Get().CreateRequest();
+    First->SetURL(Url);
+    auto Second = FHttpModule::Get().CreateRequest();
+    Second->SetURL(Url);
+    auto Third = FHttpModule::Get().CreateRequest();
+    Third->SetURL(Url);
+
+    Expect(PlayFab::FPlayFabRequestGovernor::Submit(First, PlayFab::EPlayFabRequestPriority::Normal) && PlayFab::FPlayFabRequestGovernor::GetQueuedCount(UrlPath) == 0, TEXT("The first request was not sent"));
+    Expect(PlayFab::FPlayFabRequestGovernor::Submit(Second, PlayFab::EPlayFabRequestPriority::Normal) && PlayFab::FPlayFabRequestGovernor::GetQueuedCount(UrlPath) == 1, TEXT("A request over MaxInFlight was not queued"));
+    Expect(PlayFab::FPlayFabRequestGovernor::Withdraw(Second) && PlayFab::FPlayFabRequestGovernor::GetQueuedCount(UrlPath) == 0, TEXT("A queued request could not be withdrawn"));
+    Expect(!PlayFab::FPlayFabRequestGovernor::Withdraw(First), TEXT("A request in flight was withdrawn"));
+
+    // Completing a request frees its slot once only
+    PlayFab::FPlayFabRequestGovernor::OnRequestComplete(First, false);
+    PlayFab::FPlayFabRequestGovernor::OnRequestComplete(First, false);
+    Expect(PlayFab::FPlayFabRequestGovernor::Submit(Third, PlayFab::EPlayFabRequestPriority::Normal) && PlayFab::FPlayFabRequestGovernor::GetQueuedCount(UrlPath) == 0, TEXT("A completed request kept its slot"));
+
+    // Throttling halves the endpoint's rate
+    PlayFab::FPlayFabRequestGovernor::OnRequestComplete(Third, true);
+    Expect(FMath::IsNearlyEqual(PlayFab::FPlayFabRequestGovernor::GetCurrentRate(UrlPath), 50.0f), TEXT("Throttling did not lower the rate"));
+
+    First->CancelRequest();
+    Third->CancelRequest();
+    FinishTest();
+}
+
+void UPlayFabCppCoreTests::RequestCoalescer()
+{
+    UPlayFabRuntimeSettings* Settings = GetMutableDefault<UPlayFabRuntimeSettings>();
+    TGuardValue<bool> EnableCoalescing(Settings->bEnableRequestCoalescing, true);
+
+    const FString Url = TEXT("https://127.0.0.1:1/Test/Coalescer") + FGuid::NewGuid().ToString();
+    const FString Body = TEXT("{\"Keys\":[\"A\"]}");
+    const FString Ticket = TEXT("Ticket");
+    const int32 CoalescedBefore = PlayFab::FPlayFabRequestCoalescer::GetCoalescedCount();
+
+    // Every caller records the request and outcome it was given
+    TArray<FHttpRequestPtr> Delivered;
+    TArray<bool> Outcomes;
+    const FHttpRequestCompleteDelegate OnComplete = FHttpRequestCompleteDelegate::CreateLambda([&Delivered, &Outcomes](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded)
+    {
+        Delivered.Add(HttpRequest);
+        Outcomes.Add(bSucceeded);
+    });
+
+    FString Key, OtherKey;
+    auto Shared = MakeReadRequest(Url, Body, Ticket);
+    Expect(!PlayFab::FPlayFabRequestCoalescer::TryJoin(Shared, OnComplete, Key) && !Key.IsEmpty(), TEXT("The first read joined another"));
+    Expect(PlayFab::FPlayFabRequestCoalescer::TryJoin(MakeReadRequest(Url, Body, Ticket), OnComplete, OtherKey), TEXT("An identical read was not coalesced"));
+    Expect(PlayFab::FPlayFabRequestCoalescer::TryJoin(MakeReadRequest(Url, Body, Ticket), OnComplete, OtherKey), TEXT("A second identical read was not coalesced"));
+
+    // Reads with another body or by another player are sent on their own
+    auto OtherBody = MakeReadRequest(Url, TEXT("{\"Keys\":[\"B\"]}"), Ticket);
+    Expect(!PlayFab::FPlayFabRequestCoalescer::TryJoin(OtherBody, OnComplete, OtherKey), TEXT("A read with another body was coalesced"));
+    PlayFab::FPlayFabRequestCoalescer::Abandon(OtherKey, OtherBody);
+    auto OtherPlayer = MakeReadRequest(Url, Body, TEXT("OtherTicket"));
+    Expect(!PlayFab::FPlayFabRequestCoalescer::TryJoin(OtherPlayer, OnComplete, OtherKey), TEXT("A read by another player was coalesced"));
+    PlayFab::FPlayFabRequestCoalescer::Abandon(OtherKey, OtherPlayer);
+    Expect(Delivered.Num() == 0, TEXT("A caller was answered before the shared request completed"));
+
+    // The response goes to the sender and to both callers that joined it
+    PlayFab::FPlayFabRequestCoalescer::Complete(Key, OnComplete, Shared, nullptr, true);
+    Expect(Delivered.Num() == 3 && !Delivered.ContainsByPredicate([&Shared](const FHttpRequestPtr& HttpRequest) { return HttpRequest != Shared; }) && !Outcomes.Contains(false), TEXT("The shared response was not fanned out to every caller"));
+    Expect(PlayFab::FPlayFabRequestCoalescer::GetCoalescedCount() - CoalescedBefore == 2, TEXT("Coalesced calls were not counted"));
+
+    // A completed request is closed to new callers, which start a request of their own
+    Delivered.Reset();
+    Outcomes.Reset();
+    auto Unsent = MakeReadRequest(Url, Body, Ticket);
+    Expect(!PlayFab::FPlayFabRequestCoalescer::TryJoin(Unsent, OnComplete, Key), TEXT("A read joined a completed request"));
+    Expect(PlayFab::FPlayFabRequestCoalescer::TryJoin(MakeReadRequest(Url, Body, Ticket), OnComplete, OtherKey), TEXT("An identical read was not coalesced"));
+
+    // A request that could not be sent fails the callers that joined it, and releases its key
+    PlayFab::FPlayFabRequestCoalescer::Abandon(Key, Unsent);
+    Expect(Delivered.Num() == 1 && Outcomes.Num() == 1 && !Outcomes[0], TEXT("A caller that joined an unsent request was not failed"));
+    auto Retried = MakeReadRequest(Url, Body, Ticket);
+    Expect(!PlayFab::FPlayFabRequestCoalescer::TryJoin(Retried, OnComplete, Key), TEXT("An abandoned request kept its key"));
+    PlayFab::FPlayFabRequestCoalescer::Abandon(Key, Retried);
+
+    FinishTest();
+}
+
+void UPlayFabCppCoreTests::GzipSizeCap()
+{
+    UPlayFabRuntimeSettings* Settings = GetMutableDefault<UPlayFabRuntimeSettings>();
+    TGuardValue<bool> CompressApiData(Settings->bCompressApiData, true);
+    TGuardValue<int32> CompressionThreshold(Settings->CompressionThresholdBytes, 0);
+    TGuardValue<int32> MaxDecompressed(Settings->MaxDecompressedResponseBytes, 1024 * 1024);
+
+    // A body that compresses well, gzipped the way request bodies are
+    FString Json = TEXT("[");
+    for (int32 Idx = 0; Idx < 100; Idx++)
+    {
+        Json += TEXT("{\"Key\":\"Value\",\"Count\":1},");
+    }
+    Json += TEXT("{}]");
+    const FTCHARToUTF8 Utf8(*Json);
+    const TArray<uint8> Original(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+
+    auto HttpRequest = FHttpModule::Get().CreateRequest();
+    PlayFab::FPlayFabCompression::SetRequestBody(HttpRequest, Original);
+    const FString ContentEncoding = HttpRequest->GetHeader(TEXT("Content-Encoding"));
+    const TArray<uint8> Gzip = HttpRequest->GetContent();
+    Expect(ContentEncoding == TEXT("gzip") && Gzip.Num() < Original.Num(), TEXT("The body was not compressed"));
+
+    TArray<uint8> Scratch;
+    Expect(PlayFab::FPlayFabCompression::GetResponseBody(Gzip, ContentEncoding, Scratch) == Original, TEXT("The body did not decompress to the original"));
+    Expect(&PlayFab::FPlayFabCompression::GetResponseBody(Original, FString(), Scratch) == &Original, TEXT("A body that isn't gzip was not passed through"));
+
+    {
+        TGuardValue<int32> SmallCap(Settings->MaxDecompressedResponseBytes, Original.Num() - 1);
+        Expect(PlayFab::FPlayFabCompression::GetResponseBody(Gzip, ContentEncoding, Scratch).Num() == 0, TEXT("A body beyond MaxDecompressedResponseBytes was decompressed"));
+    }
+
+    // The size in the trailer comes from the server, and is only believed up to the best ratio deflate can reach
+    {
+        TGuardValue<int32> NoCap(Settings->MaxDecompressedResponseBytes, MAX_int32);
+        TArray<uint8> Forged = Gzip;
+        SetGzipSize(Forged, Gzip.Num() * 1032 + 1);
+        Expect(PlayFab::FPlayFabCompression::GetResponseBody(Forged, ContentEncoding, Scratch).Num() == 0, TEXT("An impossible uncompressed size was believed"));
+    }
+
+    TArray<uint8> Empty = Gzip;
+    SetGzipSize(Empty, 0);
+    Expect(PlayFab::FPlayFabCompression::GetResponseBody(Empty, ContentEncoding, Scratch).Num() == 0, TEXT("A body claiming to be empty was decompressed"));
+
+    // 0xFF starts a final block of the reserved type, which no inflater accepts
+    TArray<uint8> Corrupt = Gzip;
+    for (int32 Idx = 10; Idx < Corrupt.Num() - 8; Idx++)
+    {
+        Corrupt[Idx] = 0xFF;
+    }
+    Expect(PlayFab::FPlayFabCompression::GetResponseBody(Corrupt, ContentEncoding, Scratch).Num() == 0, TEXT("A corrupt body was decompressed"));
+
+    FinishTest();
+}
+void UPlayFabCppCoreTests::CircuitBreaker()
+{
+    UPlayFabRuntimeSettings* Settings = GetMutableDefault<UPlayFabRuntimeSettings>();
+    TGuardValue<bool> EnableCircuitBreaker(Settings->bEnableCircuitBreaker, true);
+    TGuardValue<float> FailureRate(Settings->CircuitBreakerFailureRate, 0.5f);
+    TGuardValue<int32> MinCalls(Settings->CircuitBreakerMinCalls, 4);
+    TGuardValue<int32> WindowSize(Settings->CircuitBreakerWindowSize, 10);
+    TGuardValue<float> OpenSeconds(Settings->CircuitBreakerOpenSeconds, 3600.0f);
+
+    // Circuits are kept per API family, so each run uses families of its own
+    const FString ApiName = TEXT("CircuitTest") + FGuid::NewGuid().ToString();
+    const FString Url = TEXT("https://127.0.0.1:1/") + ApiName + TEXT("/Call");
+    const FString FewCallsApiName = TEXT("CircuitTest") + FGuid::NewGuid().ToString();
+    const FString FewCallsUrl = TEXT("https://127.0.0.1:1/") + FewCallsApiName + TEXT("/Call");
+
+    // Failures below CircuitBreakerMinCalls, or below the failure rate, leave the circuit closed
+    for (int32 Idx = 0; Idx < 3; Idx++)
+    {
+        PlayFab::FPlayFabCircuitBreaker::OnResult(FewCallsUrl, true);
+    }
+    Expect(PlayFab::FPlayFabCircuitBreaker::GetState(FewCallsApiName) == PlayFab::EPlayFabCircuitState::Closed, TEXT("A circuit opened before CircuitBreakerMinCalls"));
+
+    for (int32 Idx = 0; Idx < 5; Idx++)
+    {
+        PlayFab::FPlayFabCircuitBreaker::OnResult(Url, false);
+    }
+    for (int32 Idx = 0; Idx < 4; Idx++)
+    {
+        PlayFab::FPlayFabCircuitBreaker::OnResult(Url, true);
+    }
+    Expect(PlayFab::FPlayFabCircuitBreaker::GetState(ApiName) == PlayFab::EPlayFabCircuitState::Closed, TEXT("A circuit opened below the failure rate"));
+
+    // Half of the last ten calls failed
+    PlayFab::FPlayFabCircuitBreaker::OnResult(Url, true);
+    Expect(PlayFab::FPlayFabCircuitBreaker::GetState(ApiName) == PlayFab::EPlayFabCircuitState::Open, TEXT("A circuit did not open at the failure rate"));
+
+    uint64 ProbeId = 0;
+    const int32 RejectedBefore = PlayFab::FPlayFabCircuitBreaker::GetRejectedCount();
+    Expect(!PlayFab::FPlayFabCircuitBreaker::TryAcquire(Url, ProbeId), TEXT("An open circuit let a call through"));
+    Expect(PlayFab::FPlayFabCircuitBreaker::GetRejectedCount() == RejectedBefore + 1, TEXT("A call that failed fast was not counted"));
+    Expect(PlayFab::FPlayFabCircuitBreaker::TryAcquire(FewCallsUrl, ProbeId) && ProbeId == 0, TEXT("Another API family's circuit let no call through, or made it a probe"));
+
+    // Once the open period is over, a single probe is let through; a failed probe reopens the circuit
+    Settings->CircuitBreakerOpenSeconds = 0.0f;
+    Expect(PlayFab::FPlayFabCircuitBreaker::TryAcquire(Url, ProbeId) && ProbeId != 0 && PlayFab::FPlayFabCircuitBreaker::GetState(ApiName) == PlayFab::EPlayFabCircuitState::HalfOpen, TEXT("An open circuit sent no probe after its open period"));
+    Settings->CircuitBreakerOpenSeconds = 3600.0f;
+    uint64 SecondProbeId = 0;
+    Expect(!PlayFab::FPlayFabCircuitBreaker::TryAcquire(Url, SecondProbeId), TEXT("A half-open circuit let a second call through"));
+
+    // Late outcomes of calls sent before the circuit opened leave the probe to decide
+    PlayFab::FPlayFabCircuitBreaker::OnResult(Url, false);
+    Expect(PlayFab::FPlayFabCircuitBreaker::GetState(ApiName) == PlayFab::EPlayFabCircuitState::HalfOpen, TEXT("A call that wasn't the probe closed the circuit"));
+    PlayFab::FPlayFabCircuitBreaker::OnResult(Url, true, ProbeId + 1);
+    Expect(PlayFab::FPlayFabCircuitBreaker::GetState(ApiName) == PlayFab::EPlayFabCircuitState::HalfOpen, TEXT("A call that wasn't the probe reopened the circuit"));
+
+    PlayFab::FPlayFabCircuitBreaker::OnResult(Url, true, ProbeId);
+    Expect(PlayFab::FPlayFabCircuitBreaker::GetState(ApiName) == PlayFab::EPlayFabCircuitState::Open && !PlayFab::FPlayFabCircuitBreaker::TryAcquire(Url, SecondProbeId), TEXT("A failed probe did not reopen the circuit"));
+
+    // A successful probe closes it; the earlier probe's id is no longer the probe
+    Settings->CircuitBreakerOpenSeconds = 0.0f;
+    Expect(PlayFab::FPlayFabCircuitBreaker::TryAcquire(Url, SecondProbeId) && SecondProbeId != 0 && SecondProbeId != ProbeId, TEXT("A reopened circuit sent no new probe after its open period"));
+    Settings->CircuitBreakerOpenSeconds = 3600.0f;
+    PlayFab::FPlayFabCircuitBreaker::OnResult(Url, false, ProbeId);
+    Expect(PlayFab::FPlayFabCircuitBreaker::GetState(ApiName) == PlayFab::EPlayFabCircuitState::HalfOpen, TEXT("A former probe closed the circuit"));
+    PlayFab::FPlayFabCircuitBreaker::OnResult(Url, false, SecondProbeId);
+    Expect(PlayFab::FPlayFabCircuitBreaker::GetState(ApiName) == PlayFab::EPlayFabCircuitState::Closed && PlayFab::FPlayFabCircuitBreaker::TryAcquire(Url, ProbeId) && ProbeId == 0, TEXT("A successful probe did not close the circuit"));
+
+    // A closed circuit starts counting afresh
+    PlayFab::FPlayFabCircuitBreaker::OnResult(Url, true);
+    Expect(PlayFab::FPlayFabCircuitBreaker::GetState(ApiName) == PlayFab::EPlayFabCircuitState::Closed, TEXT("A closed circuit remembered failures from before it opened"));
+
+    FinishTest();
+}
+
+void UPlayFabCppCoreTests::RequestLogRedaction()
+{
+    UPlayFabRuntimeSettings* Settings = GetMutableDefault<UPlayFabRuntimeSettings>();
+    TGuardValue<TArray<FString>> RedactedFields(Settings->RequestLogRedactedFields, { TEXT("SessionTicket"), TEXT("EntityToken"), TEXT("Password") });
+
+    // At any depth, whatever the case of the name and the spacing around the colon, escaped quotes included
+    Expect(PlayFabCommon::FPlayFabRequestLog::Redact(TEXT("{\"SessionTicket\":\"ABC-123\",\"Nested\":{\"password\" : \"hunter2\",\"Items\":[{\"EntityToken\":\"tok\\\"en\"}]},\"CustomId\":\"player\",\"Count\":5}"))
+        == TEXT("{\"SessionTicket\":\"***\",\"Nested\":{\"password\" : \"***\",\"Items\":[{\"EntityToken\":\"***\"}]},\"CustomId\":\"player\",\"Count\":5}"),
+        TEXT("A secret was not redacted, or another field was"));
+
+    // Only values are redacted; a redacted name used as a value, and a redacted field holding an object, are scanned like any other
+    Expect(PlayFabCommon::FPlayFabRequestLog::Redact(TEXT("{\"Name\":\"Password\",\"EntityToken\":{\"Password\":\"hunter2\",\"Id\":\"1\"}}"))
+        == TEXT("{\"Name\":\"Password\",\"EntityToken\":{\"Password\":\"***\",\"Id\":\"1\"}}"),
+        TEXT("A field name or an object was redacted as a value"));
+
+    // A body cut off in the middle of a secret doesn't leak its start
+    Expect(!PlayFabCommon::FPlayFabRequestLog::Redact(TEXT("{\"Password\":\"hunter")).Contains(TEXT("hunter")), TEXT("A truncated secret was logged"));
+
+    {
+        TGuardValue<TArray<FString>> NoRedactedFields(Settings->RequestLogRedactedFields, TArray<FString>());
+        Expect(PlayFabCommon::FPlayFabRequestLog::Redact(TEXT("{\"Password\":\"hunter2\"}")) == TEXT("{\"Password\":\"hunter2\"}"), TEXT("A field was redacted with no redacted fields configured"));
+    }
+
+    FinishTest();
+}
+
+void UPlayFabCppCoreTests::PercentEncoding()
+{
+    using PlayFabCommon::PlayFabCommonUtils;
+    const FString NonAscii = FString::Printf(TEXT("%c%c"), (TCHAR)0x00E9, (TCHAR)0x4E16);
+
+    // The API encoder escapes its fixed set of characters, and leaves & / ? spaces and non-ASCII characters alone
+    Expect(PlayFabCommonUtils::PercentEncode(TEXT("!\"#$'()*+,:;=@[]{}")).Equals(TEXT("%21%22%23%24%27%28%29%2A%2B%2C%3A%3B%3D%40%5B%5D%7B%7D"), ESearchCase::CaseSensitive), TEXT("The API encoder missed a character"));
+    Expect(PlayFabCommonUtils::PercentEncode(TEXT("a=b&c d/e?f")).Equals(TEXT("a%3Db&c d/e?f"), ESearchCase::CaseSensitive), TEXT("The API encoder escaped a character it should keep"));
+    Expect(PlayFabCommonUtils::PercentEncode(NonAscii).Equals(NonAscii, ESearchCase::CaseSensitive), TEXT("The API encoder escaped non-ASCII characters"));
+    Expect(PlayFabCommonUtils::PercentEncode(FString()).IsEmpty(), TEXT("The API encoder changed an empty string"));
+
+    // The query encoder keeps only RFC 3986 unreserved characters, and escapes the rest byte by byte in UTF-8
+    Expect(PlayFabCommonUtils::PercentEncodeQueryValue(TEXT("UE4-1.2_3~Sdk")).Equals(TEXT("UE4-1.2_3~Sdk"), ESearchCase::CaseSensitive), TEXT("The query encoder escaped an unreserved character"));
+    Expect(PlayFabCommonUtils::PercentEncodeQueryValue(TEXT("a b&c=d/e?f+g#%")).Equals(TEXT("a%20b%26c%3Dd%2Fe%3Ff%2Bg%23%25"), ESearchCase::CaseSensitive), TEXT("The query encoder kept a reserved character"));
+    Expect(PlayFabCommonUtils::PercentEncodeQueryValue(NonAscii).Equals(TEXT("%C3%A9%E4%B8%96"), ESearchCase::CaseSensitive), TEXT("The query encoder didn't escape non-ASCII characters as UTF-8"));
+
+    FinishTest();
+}
+
+
+
+void UPlayFabCppCoreTests::CancelledCall()
+{
+    if (ClientAPI == nullptr || !ClientAPI.IsValid())
+    {
+        CurrentTestContext->EndTest(PlayFabApiTestFinishState::SKIPPED, "Could not load the PlayFab API");
+        return;
+    }
+
+    // Whether the login fails or succeeds, neither of its delegates may run once it is cancelled
+    PlayFab::ClientModels::FLoginWithCustomIDRequest Request;
+    Request.CustomId = TEXT("CancelledCall");
+    Request.CreateAccount = false;
+
+    const PlayFab::FPlayFabRequestHandle Handle = PlayFab::FPlayFabRequestHandle::Create();
+    CancelledCallDelegates = 0;
+    Expect(ClientAPI->LoginWithCustomID(
+        Request,
+        PlayFab::UPlayFabClientAPI::FLoginWithCustomIDDelegate::CreateUObject(this, &UPlayFabCppCoreTests::CancelledCall_Success),
+        PlayFab::FPlayFabErrorDelegate::CreateUObject(this, &UPlayFabCppCoreTests::CancelledCall_Error),
+        Handle), TEXT("The call was not sent"));
+    Handle.Cancel();
+
+    // Calls made with a cancelled handle aren't sent at all
+    Expect(Handle.IsCancelled() && !ClientAPI->LoginWithCustomID(
+        Request,
+        PlayFab::UPlayFabClientAPI::FLoginWithCustomIDDelegate::CreateUObject(this, &UPlayFabCppCoreTests::CancelledCall_Success),
+        PlayFab::FPlayFabErrorDelegate::CreateUObject(this, &UPlayFabCppCoreTests::CancelledCall_Error),
+        Handle), TEXT("A call made with a cancelled handle was sent"));
+
+    // Ended by Tick
+    CancelledCallDeadline = FPlatformTime::Seconds() + 5.0;
+}
+
+void UPlayFabCppCoreTests::CancelledCall_Success(const PlayFab::ClientModels::FLoginResult& result)
+{
+    UE_LOG(LogPlayFabTests, Error, TEXT("The success delegate of a cancelled call ran"));
+    CancelledCallDelegates++;
+}
+
+void UPlayFabCppCoreTests::CancelledCall_Error(const PlayFab::FPlayFabCppError& InError)
+{
+    UE_LOG(LogPlayFabTests, Error, TEXT("The error delegate of a cancelled call ran: %s"), *InError.GenerateErrorReport());
+    CancelledCallDelegates++;
+}
+
+void UPlayFabCppCoreTests::ReusedHandle()
+{
+    if (ClientAPI == nullptr || !ClientAPI.IsValid())
+    {
+        CurrentTestContext->EndTest(PlayFabApiTestFinishState::SKIPPED, "Could not load the PlayFab API");
+        return;
+    }
+
+    // Results are held by the test, as they would be in a completion queue, until the handle has been reused and cancelled
+    PlayFab::PlayFabRequestHandler::SetResponseDispatcher([this](TFunction<void()>&& Deliver)
+    {
+        FScopeLock Lock(&HeldResultsLock);
+        HeldResults.Add(MoveTemp(Deliver));
+    });
+
+    // Its result handler has no side effects, so the result goes through the dispatcher whether the call fails or succeeds
+    PlayFab::ClientModels::FGetTitlePublicKeyRequest Request;
+    HeldResultHandle = PlayFab::FPlayFabRequestHandle::Create();
+    ReusedHandleDelegates = 0;
+    Expect(ClientAPI->GetTitlePublicKey(
+        Request,
+        PlayFab::UPlayFabClientAPI::FGetTitlePublicKeyDelegate::CreateUObject(this, &UPlayFabCppCoreTests::ReusedHandle_Success),
+        PlayFab::FPlayFabErrorDelegate::CreateUObject(this, &UPlayFabCppCoreTests::ReusedHandle_Error),
+        HeldResultHandle), TEXT("The call was not sent"));
+
+    // Ended by ReusedHandle_Tick
+    ReusedHandleDeadline = FPlatformTime::Seconds() + 10.0;
+}
+
+void UPlayFabCppCoreTests::ReusedHandle_Tick()
+{
+    TArray<TFunction<void()>> Results;
+    {
+        FScopeLock Lock(&HeldResultsLock);
+        if (HeldResults.Num() == 0 && FPlatformTime::Seconds() < ReusedHandleDeadline)
+        {
+            return;
+        }
+        Results = MoveTemp(HeldResults);
+    }
+    ReusedHandleDeadline = 0.0;
+    PlayFab::PlayFabRequestHandler::SetResponseDispatcher(nullptr);
+    Expect(Results.Num() > 0, TEXT("The call's result never reached the dispatcher"));
+
+    // The first call has finished, but its result hasn't reached its delegates, so reusing the handle must not forget it
+    Expect(HeldResultHandle.GetPendingCount() == 1, TEXT("A call whose result is held was counted as done"));
+    PlayFab::ClientModels::FGetTitlePublicKeyRequest Request;
+    Expect(ClientAPI->GetTitlePublicKey(
+        Request,
+        PlayFab::UPlayFabClientAPI::FGetTitlePublicKeyDelegate::CreateUObject(this, &UPlayFabCppCoreTests::ReusedHandle_Success),
+        PlayFab::FPlayFabErrorDelegate::CreateUObject(this, &UPlayFabCppCoreTests::ReusedHandle_Error),
+        HeldResultHandle), TEXT("The reused handle refused a call"));
+    HeldResultHandle.Cancel();
+
+    for (const TFunction<void()>& Deliver : Results)
+    {
+        Deliver();
+    }
+    Expect(ReusedHandleDelegates == 0, TEXT("A result held while its handle was reused reached its delegates after the handle was cancelled"));
+    HeldResultHandle = PlayFab::FPlayFabRequestHandle();
+    FinishTest();
+}
+
+void UPlayFabCppCoreTests::ReusedHandle_Success(const PlayFab::ClientModels::FGetTitlePublicKeyResult& result)
+{
+    UE_LOG(LogPlayFabTests, Error, TEXT("The success delegate of a cancelled call ran"));
+    ReusedHandleDelegates++;
+}
+
+void UPlayFabCppCoreTests::ReusedHandle_Error(const PlayFab::FPlayFabCppError& InError)
+{
+    UE_LOG(LogPlayFabTests, Error, TEXT("The error delegate of a cancelled call ran: %s"), *InError.GenerateErrorReport());
+    ReusedHandleDelegates++;
+}
+
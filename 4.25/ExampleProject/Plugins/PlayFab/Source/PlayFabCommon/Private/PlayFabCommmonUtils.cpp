@@ -6,9 +6,95 @@
 #include "PlayFabCommonUtils.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
+#include "PlayFabCommon.h"
+#include "HAL/IConsoleManager.h"
 
 using namespace PlayFabCommon;
 
+namespace
+{
+    // Which characters an encoder escapes; one lookup per character replaces a pass over the text per character
+    struct FPercentEncodeTable
+    {
+        bool Ascii[128];
+        bool bNonAscii;
+
+        FPercentEncodeTable(const ANSICHAR* Kept, bool bInEncodeNonAscii, bool bKeepUnlisted)
+            : bNonAscii(bInEncodeNonAscii)
+        {
+            for (int32 Index = 0; Index < 128; ++Index)
+            {
+                Ascii[Index] = !bKeepUnlisted;
+            }
+            for (const ANSICHAR* Char = Kept; *Char; ++Char)
+            {
+                Ascii[(uint8)*Char] = bKeepUnlisted;
+            }
+        }
+
+        bool ShouldEncode(TCHAR Char) const
+        {
+            return (uint32)Char < 128 ? Ascii[(uint32)Char] : bNonAscii;
+        }
+    };
+
+    // The characters listed are encoded, the rest kept
+    const FPercentEncodeTable ApiTable("!\"#$'()*+,:;=@[]{}", false, true);
+    // The characters listed are kept, the rest encoded
+    const FPercentEncodeTable QueryTable("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~", true, false);
+
+    void AppendEncodedByte(FString& Result, uint8 Byte)
+    {
+        static const TCHAR HexDigits[] = TEXT("0123456789ABCDEF");
+        Result.AppendChar(TEXT('%'));
+        Result.AppendChar(HexDigits[Byte >> 4]);
+        Result.AppendChar(HexDigits[Byte & 0xF]);
+    }
+
+    FString PercentEncodeWith(const FString& Text, const FPercentEncodeTable& Table)
+    {
+        // Most text needs no encoding at all, and is returned as it is
+        const int32 Len = Text.Len();
+        int32 First = 0;
+        while (First < Len && !Table.ShouldEncode(Text[First]))
+        {
+            ++First;
+        }
+        if (First == Len)
+        {
+            return Text;
+        }
+
+        FString Result;
+        Result.Reserve(Len + (Len - First) * 2);
+        Result.AppendChars(*Text, First);
+        for (int32 Index = First; Index < Len; ++Index)
+        {
+            const TCHAR Char = Text[Index];
+            if (!Table.ShouldEncode(Char))
+            {
+                Result.AppendChar(Char);
+            }
+            else if ((uint32)Char < 128)
+            {
+                AppendEncodedByte(Result, (uint8)Char);
+            }
+            else
+            {
+                // A UTF-16 surrogate pair is one character, and is converted together
+                const int32 Count = (Char >= 0xD800 && Char <= 0xDBFF && Index + 1 < Len) ? 2 : 1;
+                FTCHARToUTF8 Utf8(*Text + Index, Count);
+                for (int32 Byte = 0; Byte < Utf8.Length(); ++Byte)
+                {
+                    AppendEncodedByte(Result, (uint8)Utf8.Get()[Byte]);
+                }
+                Index += Count - 1;
+            }
+        }
+        return Result;
+    }
+}
+
 // GetEnvironmentVariable with 3 parameters is considered deprecated:
 // http://api.unrealengine.com/INT/API/Runtime/Core/GenericPlatform/FGenericPlatformMisc/GetEnvironmentVariable/2/index.html
 // The newer version of GetEnvironmentVariable with a single parameter broke our 4.20 plugin build for the Epic Store
@@ -73,3 +159,85 @@ FString PlayFabCommonUtils::GetLocalSettingsFileProperty(const FString& property
     FString outString;
     return jsonObject->TryGetStringField(propertyKey, outString) ? outString : FString();
 }
+
+FString PlayFabCommonUtils::PercentEncode(const FString& Text)
+{
+    return PercentEncodeWith(Text, ApiTable);
+}
+
+FString PlayFabCommonUtils::PercentEncodeQueryValue(const FString& Text)
+{
+    return PercentEncodeWith(Text, QueryTable);
+}
+
+#if !UE_BUILD_SHIPPING
+namespace
+{
+    // The chain of replacements PercentEncode was before, kept to check and time the encoder against
+    FString PercentEncodeByReplace(const FString& Text)
+    {
+        FString OutText = Text;
+        OutText = OutText.Replace(TEXT("!"), TEXT("%21"));
+        OutText = OutText.Replace(TEXT("\""), TEXT("%22"));
+        OutText = OutText.Replace(TEXT("#"), TEXT("%23"));
+        OutText = OutText.Replace(TEXT("$"), TEXT("%24"));
+        OutText = OutText.Replace(TEXT("'"), TEXT("%27"));
+        OutText = OutText.Replace(TEXT("("), TEXT("%28"));
+        OutText = OutText.Replace(TEXT(")"), TEXT("%29"));
+        OutText = OutText.Replace(TEXT("*"), TEXT("%2A"));
+        OutText = OutText.Replace(TEXT("+"), TEXT("%2B"));
+        OutText = OutText.Replace(TEXT(","), TEXT("%2C"));
+        OutText = OutText.Replace(TEXT(":"), TEXT("%3A"));
+        OutText = OutText.Replace(TEXT(";"), TEXT("%3B"));
+        OutText = OutText.Replace(TEXT("="), TEXT("%3D"));
+        OutText = OutText.Replace(TEXT("@"), TEXT("%40"));
+        OutText = OutText.Replace(TEXT("["), TEXT("%5B"));
+        OutText = OutText.Replace(TEXT("]"), TEXT("%5D"));
+        OutText = OutText.Replace(TEXT("{"), TEXT("%7B"));
+        OutText = OutText.Replace(TEXT("}"), TEXT("%7D"));
+        return OutText;
+    }
+
+    // PlayFab.BenchmarkPercentEncode [Iterations]
+    void BenchmarkPercentEncode(const TArray<FString>& Args)
+    {
+        const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+        const FString Inputs[] = {
+            TEXT("PlayerStatistics"),
+            TEXT("{\"Keys\":[\"level\",\"xp\"],\"Filter\":\"a=b;c=d\"}"),
+            FString::ChrN(256, TEXT('a')) + TEXT("[0]:{x,y}@host!"),
+        };
+
+        for (const FString& Input : Inputs)
+        {
+            if (!PercentEncodeByReplace(Input).Equals(PlayFabCommonUtils::PercentEncode(Input), ESearchCase::CaseSensitive))
+            {
+                UE_LOG(LogPlayFabCommon, Error, TEXT("PercentEncode differs from the replace chain for: %s"), *Input);
+            }
+
+            int32 Checksum = 0;
+            double Start = FPlatformTime::Seconds();
+            for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+            {
+                Checksum += PercentEncodeByReplace(Input).Len();
+            }
+            const double ReplaceSeconds = FPlatformTime::Seconds() - Start;
+
+            Start = FPlatformTime::Seconds();
+            for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+            {
+                Checksum += PlayFabCommonUtils::PercentEncode(Input).Len();
+            }
+            const double TableSeconds = FPlatformTime::Seconds() - Start;
+
+            UE_LOG(LogPlayFabCommon, Display, TEXT("PercentEncode of %d characters: replace chain %.3f us, single pass %.3f us, %.1fx (checksum %d)"),
+                Input.Len(), ReplaceSeconds * 1e6 / Iterations, TableSeconds * 1e6 / Iterations, TableSeconds > 0.0 ? ReplaceSeconds / TableSeconds : 0.0, Checksum);
+        }
+    }
+
+    FAutoConsoleCommand BenchmarkPercentEncodeCommand(
+        TEXT("PlayFab.BenchmarkPercentEncode"),
+        TEXT("Times PercentEncode against the chain of FString::Replace calls it replaced. Optional argument: iterations per input."),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkPercentEncode));
+}
+#endif
@@ -4,6 +4,7 @@
 
 
 #include "PlayFabCommonSettings.h"
+#include "PlayFabUrlCache.h"
 
 namespace PlayFabCommon
 {
@@ -17,4 +18,10 @@ namespace PlayFabCommon
     FString PlayFabCommonSettings::photonRealtimeAppId;
     FString PlayFabCommonSettings::photonTurnbasedAppId;
     FString PlayFabCommonSettings::photonChatAppId;
+
+    FString PlayFabCommonSettings::GeneratePfUrl(const FString& urlPath)
+    {
+        static FPlayFabUrlCache UrlCache;
+        return UrlCache.GetUrl(urlPath, versionString);
+    }
 }
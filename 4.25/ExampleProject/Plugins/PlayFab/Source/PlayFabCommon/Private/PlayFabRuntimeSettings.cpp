@@ -12,5 +12,37 @@ UPlayFabRuntimeSettings::UPlayFabRuntimeSettings()
     : ProductionEnvironmentURL(TEXT(".playfabapi.com"))
     , TitleId()
     , DeveloperSecretKey()
+    , bEnableAutomaticRetries(false)
+    , MaxRetryAttempts(3)
+    , RetryBaseDelaySeconds(0.5f)
+    , RetryMaxDelaySeconds(30.0f)
+    , RetryBudgetPerMinute(60)
+    , bEnableRequestGovernor(false)
+    , DefaultEndpointLimit()
+    , EndpointLimits()
+    , bEnableRequestCoalescing(false)
+    , bCompressApiData(false)
+    , CompressionThresholdBytes(1024)
+    , MaxDecompressedResponseBytes(32 * 1024 * 1024)
+    , bDecodeResponsesInBackground(false)
+    , ResponseDispatch(EPlayFabResponseDispatch::GameThread)
+    , DelegateBudgetMsPerFrame(0.0f)
+    , bPrewarmConnections(false)
+    , PrewarmConnectionCount(1)
+    , bKeepConnectionsAlive(false)
+    , ConnectionIdleSeconds(60.0f)
+    , bEnableRequestHedging(false)
+    , HedgedCalls({ TEXT("GetMatchmakingTicket"), TEXT("GetPlayerCombinedInfo"), TEXT("GetTitleData") })
+    , MinHedgeDelaySeconds(0.05f)
+    , bEnableCircuitBreaker(false)
+    , CircuitBreakerFailureRate(0.5f)
+    , CircuitBreakerMinCalls(20)
+    , CircuitBreakerWindowSize(50)
+    , CircuitBreakerOpenSeconds(15.0f)
+    , bCollectEndpointMetrics(false)
+    , BlueprintObjectPoolSize(0)
+    , RequestLogSampleRate(1.0f)
+    , RequestLogMaxBodyBytes(2048)
+    , RequestLogRedactedFields({ TEXT("SessionTicket"), TEXT("EntityToken"), TEXT("Password"), TEXT("DeveloperSecretKey"), TEXT("AccessToken"), TEXT("AuthTicket"), TEXT("IdentityToken"), TEXT("ServerAuthCode"), TEXT("PlayerSecret") })
 {
 }
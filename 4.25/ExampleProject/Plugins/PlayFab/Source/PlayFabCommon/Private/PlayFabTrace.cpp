@@ -0,0 +1,75 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabTrace.h"
+
+#if PLAYFAB_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_DEFINE(PlayFabChannel);
+
+UE_TRACE_EVENT_BEGIN(PlayFab, RequestPhaseBegin)
+    UE_TRACE_EVENT_FIELD(uint64, Cycle)
+    UE_TRACE_EVENT_FIELD(uint64, RequestId)
+    UE_TRACE_EVENT_FIELD(uint8, Phase)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(PlayFab, RequestPhaseEnd)
+    UE_TRACE_EVENT_FIELD(uint64, Cycle)
+    UE_TRACE_EVENT_FIELD(uint64, RequestId)
+    UE_TRACE_EVENT_FIELD(uint8, Phase)
+UE_TRACE_EVENT_END()
+
+#endif
+
+using namespace PlayFabCommon;
+
+bool FPlayFabTrace::IsEnabled()
+{
+#if PLAYFAB_TRACE_ENABLED
+    return UE_TRACE_CHANNELEXPR_IS_ENABLED(PlayFabChannel);
+#else
+    return false;
+#endif
+}
+
+void FPlayFabTrace::BeginPhase(EPlayFabTracePhase Phase, const FHttpRequestPtr& Request)
+{
+#if PLAYFAB_TRACE_ENABLED
+    // The url is attached to the phases that start a request's life, the others can be matched to it by id
+    if (!Request.IsValid() || (Phase != EPlayFabTracePhase::Send && Phase != EPlayFabTracePhase::Wait))
+    {
+        BeginPhase(Phase, GetRequestId(Request));
+        return;
+    }
+
+    const FString Url = Request->GetURL();
+    const uint16 UrlSize = (uint16)((Url.Len() + 1) * sizeof(TCHAR));
+    UE_TRACE_LOG(PlayFab, RequestPhaseBegin, PlayFabChannel, UrlSize)
+        << RequestPhaseBegin.Cycle(FPlatformTime::Cycles64())
+        << RequestPhaseBegin.RequestId(GetRequestId(Request))
+        << RequestPhaseBegin.Phase((uint8)Phase)
+        << RequestPhaseBegin.Attachment(*Url, UrlSize);
+#endif
+}
+
+void FPlayFabTrace::BeginPhase(EPlayFabTracePhase Phase, uint64 RequestId)
+{
+#if PLAYFAB_TRACE_ENABLED
+    UE_TRACE_LOG(PlayFab, RequestPhaseBegin, PlayFabChannel)
+        << RequestPhaseBegin.Cycle(FPlatformTime::Cycles64())
+        << RequestPhaseBegin.RequestId(RequestId)
+        << RequestPhaseBegin.Phase((uint8)Phase);
+#endif
+}
+
+void FPlayFabTrace::EndPhase(EPlayFabTracePhase Phase, uint64 RequestId)
+{
+#if PLAYFAB_TRACE_ENABLED
+    UE_TRACE_LOG(PlayFab, RequestPhaseEnd, PlayFabChannel)
+        << RequestPhaseEnd.Cycle(FPlatformTime::Cycles64())
+        << RequestPhaseEnd.RequestId(RequestId)
+        << RequestPhaseEnd.Phase((uint8)Phase);
+#endif
+}
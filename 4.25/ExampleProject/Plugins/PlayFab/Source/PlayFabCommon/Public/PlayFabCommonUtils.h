@@ -20,5 +20,10 @@ namespace PlayFabCommon
         static TSharedPtr<FJsonObject> GetLocalSettingsFileJson();
     public:
         static FString GetLocalSettingsFileProperty(const FString& propertyKey);
+
+        // Percent-encodes the reserved characters the PlayFab APIs escape in url fields, leaving & / ? and all other characters as they are
+        static FString PercentEncode(const FString& Text);
+        // Percent-encodes everything but RFC 3986 unreserved characters, non-ASCII characters as their UTF-8 bytes, for query string values
+        static FString PercentEncodeQueryValue(const FString& Text);
     };
 }
@@ -0,0 +1,113 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+
+// Trace channels came with 4.26; on older engines the macros below compile to nothing
+#if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION >= 26
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#endif
+
+#if defined(UE_TRACE_ENABLED) && UE_TRACE_ENABLED && defined(CPUPROFILERTRACE_ENABLED) && CPUPROFILERTRACE_ENABLED
+#define PLAYFAB_TRACE_ENABLED 1
+#else
+#define PLAYFAB_TRACE_ENABLED 0
+#endif
+
+#if PLAYFAB_TRACE_ENABLED
+// Record with -trace=cpu,playfab
+UE_TRACE_CHANNEL_EXTERN(PlayFabChannel, PLAYFABCOMMON_API);
+#endif
+
+namespace PlayFabCommon
+{
+    enum class EPlayFabTracePhase : uint8
+    {
+        // Writing the request body
+        Serialize,
+        // Handing the request to the HTTP module
+        Send,
+        // From sending the request until its response arrives; spans frames, so it is only recorded as begin and end events
+        Wait,
+        // Reading the response
+        Decode,
+        // Running the caller's delegates
+        Dispatch
+    };
+
+    /**
+     * Request lifecycle events on the PlayFab trace channel, for Unreal Insights.
+     * Phases that run on one thread are CPU timing spans named "PlayFab <Phase>"; every phase also logs PlayFab.RequestPhaseBegin and RequestPhaseEnd
+     * events with the request id, and the begin events of Send and Wait carry the request url.
+     */
+    class PLAYFABCOMMON_API FPlayFabTrace
+    {
+    public:
+        // Requests are identified by their address, which is unique while they are in flight
+        static uint64 GetRequestId(const FHttpRequestPtr& Request) { return (uint64)(UPTRINT)Request.Get(); }
+
+        static bool IsEnabled();
+        static void BeginPhase(EPlayFabTracePhase Phase, const FHttpRequestPtr& Request);
+        static void BeginPhase(EPlayFabTracePhase Phase, uint64 RequestId);
+        static void EndPhase(EPlayFabTracePhase Phase, uint64 RequestId);
+    };
+
+    class FPlayFabTraceScope
+    {
+    public:
+        FPlayFabTraceScope(EPlayFabTracePhase InPhase, const FHttpRequestPtr& Request)
+            : Phase(InPhase), RequestId(FPlayFabTrace::GetRequestId(Request)), bIsActive(FPlayFabTrace::IsEnabled())
+        {
+            if (bIsActive)
+            {
+                FPlayFabTrace::BeginPhase(Phase, Request);
+            }
+        }
+
+        FPlayFabTraceScope(EPlayFabTracePhase InPhase, uint64 InRequestId)
+            : Phase(InPhase), RequestId(InRequestId), bIsActive(FPlayFabTrace::IsEnabled())
+        {
+            if (bIsActive)
+            {
+                FPlayFabTrace::BeginPhase(Phase, RequestId);
+            }
+        }
+
+        ~FPlayFabTraceScope()
+        {
+            if (bIsActive)
+            {
+                FPlayFabTrace::EndPhase(Phase, RequestId);
+            }
+        }
+
+    private:
+        EPlayFabTracePhase Phase;
+        uint64 RequestId;
+        bool bIsActive;
+    };
+}
+
+#if PLAYFAB_TRACE_ENABLED
+// Request is an FHttpRequestPtr, or a request id from FPlayFabTrace::GetRequestId
+#define PLAYFAB_TRACE_SCOPE(Phase, Request) \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("PlayFab " #Phase, PlayFabChannel); \
+    PlayFabCommon::FPlayFabTraceScope PREPROCESSOR_JOIN(PlayFabTraceScope, __LINE__)(PlayFabCommon::EPlayFabTracePhase::Phase, Request)
+// A span without request, for code that runs before the request exists
+#define PLAYFAB_TRACE_CPU_SCOPE(Phase) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("PlayFab " #Phase, PlayFabChannel)
+#define PLAYFAB_TRACE_BEGIN(Phase, Request) \
+    do { if (PlayFabCommon::FPlayFabTrace::IsEnabled()) { PlayFabCommon::FPlayFabTrace::BeginPhase(PlayFabCommon::EPlayFabTracePhase::Phase, Request); } } while (0)
+#define PLAYFAB_TRACE_END(Phase, Request) \
+    do { if (PlayFabCommon::FPlayFabTrace::IsEnabled()) { PlayFabCommon::FPlayFabTrace::EndPhase(PlayFabCommon::EPlayFabTracePhase::Phase, PlayFabCommon::FPlayFabTrace::GetRequestId(Request)); } } while (0)
+#else
+#define PLAYFAB_TRACE_SCOPE(Phase, Request) (void)(Request)
+#define PLAYFAB_TRACE_CPU_SCOPE(Phase)
+#define PLAYFAB_TRACE_BEGIN(Phase, Request) do { } while (0)
+#define PLAYFAB_TRACE_END(Phase, Request) do { } while (0)
+#endif
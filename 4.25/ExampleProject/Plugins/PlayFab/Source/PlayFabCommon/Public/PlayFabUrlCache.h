@@ -0,0 +1,36 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+namespace PlayFabCommon
+{
+    /**
+     * Full urls of PlayFab endpoints, built once per url path instead of on every call.
+     * The cache checks the title id and environment url it was built from on each lookup, and rebuilds itself when they change,
+     * so settings assigned at runtime take effect on the next call.
+     */
+    class PLAYFABCOMMON_API FPlayFabUrlCache
+    {
+    public:
+        // "https://" + TitleId + ProductionEnvironmentURL + urlPath + "?sdk=" + sdkVersion (percent-encoded), or without the title id if the environment url has a scheme
+        FString GetUrl(const FString& urlPath, const FString& sdkVersion);
+
+    private:
+        // Call with Lock held
+        bool IsCurrent(const FString& TitleId, const FString& ProductionEnvironmentURL, const FString& sdkVersion) const;
+
+        FRWLock Lock;
+        FString CachedTitleId;
+        FString CachedProductionEnvironmentURL;
+        FString CachedSdkVersion;
+        FString Prefix;
+        FString Suffix;
+        TMap<FString, FString> Urls;
+    };
+}
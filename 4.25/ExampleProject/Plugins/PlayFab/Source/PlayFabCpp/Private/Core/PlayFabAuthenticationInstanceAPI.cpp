@@ -80,7 +80,8 @@ TSharedPtr<UPlayFabAuthenticationContext> UPlayFabAuthenticationInstanceAPI::Get
 bool UPlayFabAuthenticationInstanceAPI::GetEntityToken(
     AuthenticationModels::FGetEntityTokenRequest& request,
     const FGetEntityTokenDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     FString authKey; FString authValue;
@@ -97,31 +98,37 @@ bool UPlayFabAuthenticationInstanceAPI::GetEntityToken(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Authentication/GetEntityToken"), request.toJSONString(), authKey, authValue);
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAuthenticationInstanceAPI::OnGetEntityTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Authentication/GetEntityToken"), request.toJSONUtf8(), authKey, authValue);
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAuthenticationInstanceAPI::OnGetEntityTokenResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::High, Handle);
+}
+
+TFuture<TPlayFabResult<AuthenticationModels::FGetEntityTokenResponse>> UPlayFabAuthenticationInstanceAPI::GetEntityTokenAsync(AuthenticationModels::FGetEntityTokenRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AuthenticationModels::FGetEntityTokenResponse, FGetEntityTokenDelegate>([this, &request, &Handle](const FGetEntityTokenDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAuthenticationInstanceAPI::GetEntityToken(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAuthenticationInstanceAPI::OnGetEntityTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FGetEntityTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AuthenticationModels::FGetEntityTokenResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    TSharedPtr<UPlayFabAuthenticationInstanceAPI> Self;
+    if (DoesSharedInstanceExist())
+        Self = AsShared();
+    PlayFabRequestHandler::DecodeAndDispatch<AuthenticationModels::FGetEntityTokenResponse>(HttpRequest, HttpResponse, bSucceeded, [this, Self, SuccessDelegate](AuthenticationModels::FGetEntityTokenResponse& outResult)
     {
         if (outResult.EntityToken.Len() > 0)
             GetOrCreateAuthenticationContext()->SetEntityToken(outResult.EntityToken);
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate, true);
 }
 
 bool UPlayFabAuthenticationInstanceAPI::ValidateEntityToken(
     AuthenticationModels::FValidateEntityTokenRequest& request,
     const FValidateEntityTokenDelegate& SuccessDelegate,
-    const FPlayFabErrorDelegate& ErrorDelegate)
+    const FPlayFabErrorDelegate& ErrorDelegate,
+    const FPlayFabRequestHandle& Handle)
 {
     TSharedPtr<UPlayFabAuthenticationContext> context = request.AuthenticationContext.IsValid() ? request.AuthenticationContext : GetOrCreateAuthenticationContext();
     if (context->GetEntityToken().Len() == 0) {
@@ -129,21 +136,23 @@ bool UPlayFabAuthenticationInstanceAPI::ValidateEntityToken(
     }
 
 
-    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Authentication/ValidateEntityToken"), request.toJSONString(), TEXT("X-EntityToken"), context->GetEntityToken());
-    HttpRequest->OnProcessRequestComplete().BindRaw(this, &UPlayFabAuthenticationInstanceAPI::OnValidateEntityTokenResult, SuccessDelegate, ErrorDelegate);
-    return HttpRequest->ProcessRequest();
+    auto HttpRequest = PlayFabRequestHandler::SendRequest(this->settings, TEXT("/Authentication/ValidateEntityToken"), request.toJSONUtf8(), TEXT("X-EntityToken"), context->GetEntityToken());
+    PlayFabRequestHandler::BindInstanceResult(HttpRequest, this, &UPlayFabAuthenticationInstanceAPI::OnValidateEntityTokenResult, SuccessDelegate, ErrorDelegate);
+    return PlayFabRequestHandler::ProcessRequest(HttpRequest, false, EPlayFabRequestPriority::Normal, Handle);
+}
+
+TFuture<TPlayFabResult<AuthenticationModels::FValidateEntityTokenResponse>> UPlayFabAuthenticationInstanceAPI::ValidateEntityTokenAsync(AuthenticationModels::FValidateEntityTokenRequest& request, const FPlayFabRequestHandle& Handle)
+{
+    return MakePlayFabFuture<AuthenticationModels::FValidateEntityTokenResponse, FValidateEntityTokenDelegate>([this, &request, &Handle](const FValidateEntityTokenDelegate& SuccessDelegate, const FPlayFabErrorDelegate& ErrorDelegate)
+    {
+        return UPlayFabAuthenticationInstanceAPI::ValidateEntityToken(request, SuccessDelegate, ErrorDelegate, Handle);
+    });
 }
 
 void UPlayFabAuthenticationInstanceAPI::OnValidateEntityTokenResult(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FValidateEntityTokenDelegate SuccessDelegate, FPlayFabErrorDelegate ErrorDelegate)
 {
-    AuthenticationModels::FValidateEntityTokenResponse outResult;
-    FPlayFabCppError errorResult;
-    if (PlayFabRequestHandler::DecodeRequest(HttpRequest, HttpResponse, bSucceeded, outResult, errorResult))
+    PlayFabRequestHandler::DecodeAndDispatch<AuthenticationModels::FValidateEntityTokenResponse>(HttpRequest, HttpResponse, bSucceeded, [SuccessDelegate](AuthenticationModels::FValidateEntityTokenResponse& outResult)
     {
         SuccessDelegate.ExecuteIfBound(outResult);
-    }
-    else
-    {
-        ErrorDelegate.ExecuteIfBound(errorResult);
-    }
+    }, ErrorDelegate);
 }
@@ -0,0 +1,153 @@
+//////////////////////////////////////////////////////
+// Copyright (C) Microsoft. 2018. All rights reserved.
+//////////////////////////////////////////////////////
+
+
+#include "PlayFabCircuitBreaker.h"
+#include "PlayFabCallCounters.h"
+#include "PlayFabRuntimeSettings.h"
+#include "PlayFab.h"
+#include "Misc/ScopeLock.h"
+
+using namespace PlayFab;
+
+namespace
+{
+    struct FCircuit
+    {
+        EPlayFabCircuitState State = EPlayFabCircuitState::Closed;
+        // Ring of the latest outcomes, true for a failure; Next is where the next one goes
+        TArray<bool> Outcomes;
+        int32 Next = 0;
+        int32 Failures = 0;
+        // Platform time at which the circuit opened, or at which the half-open probe was sent
+        double StateTime = 0.0;
+        // Id TryAcquire gave the half-open probe, 0 while none is out
+        uint64 ProbeId = 0;
+
+        void Close()
+        {
+            State = EPlayFabCircuitState::Closed;
+            Outcomes.Reset();
+            Next = 0;
+            Failures = 0;
+            ProbeId = 0;
+        }
+
+        void Open(double Now)
+        {
+            State = EPlayFabCircuitState::Open;
+            StateTime = Now;
+            ProbeId = 0;
+        }
+    };
+
+    FCriticalSection CircuitLock;
+    TMap<FString, FCircuit> Circuits;
+    int32 RejectedCount = 0;
+    uint64 NextProbeId = 1;
+
+    FString GetApiName(const FString& RequestUrl)
+    {
+        FString UrlPath, ApiName;
+        PlayFabCommon::FPlayFabCallCounters::ParseRequestUrl(RequestUrl, UrlPath, ApiName);
+        return ApiName;
+    }
+}
+
+bool FPlayFabCircuitBreaker::TryAcquire(const FString& RequestUrl, uint64& OutProbeId)
+{
+    OutProbeId = 0;
+    const UPlayFabRuntimeSettings* Settings = GetDefault<UPlayFabRuntimeSettings>();
+    if (!Settings->bEnableCircuitBreaker)
+    {
+        return true;
+    }
+
+    const FString ApiName = GetApiName(RequestUrl);
+    const double Now = FPlatformTime::Seconds();
+    FScopeLock Lock(&CircuitLock);
+    FCircuit* Circuit = Circuits.Find(ApiName);
+    if (Circuit == nullptr || Circuit->State == EPlayFabCircuitState::Closed)
+    {
+        return true;
+    }
+
+    // A probe that was cancelled never reports back, so one that has been out for a whole open period is given up on
+    const bool ProbeAllowed = Circuit->State == EPlayFabCircuitState::Open
+        ? Now - Circuit->StateTime >= Settings->CircuitBreakerOpenSeconds
+        : Circuit->ProbeId == 0 || Now - Circuit->StateTime >= Settings->CircuitBreakerOpenSeconds;
+    if (ProbeAllowed)
+    {
+        Circuit->State = EPlayFabCircuitState::HalfOpen;
+        Circuit->StateTime = Now;
+        Circuit->ProbeId = NextProbeId++;
+        OutProbeId = Circuit->ProbeId;
+        return true;
+    }
+
+    RejectedCount++;
+    return false;
+}
+
+void FPlayFabCircuitBreaker::OnResult(const FString& RequestUrl, bool bFailed, uint64 ProbeId)
+{
+    const UPlayFabRuntimeSettings* Settings = GetDefault<UPlayFabRuntimeSettings>();
+    if (!Settings->bEnableCircuitBreaker)
+    {
+        return;
+    }
+
+    const FString ApiName = GetApiName(RequestUrl);
+    const double Now = FPlatformTime::Seconds();
+    FScopeLock Lock(&CircuitLock);
+    FCircuit& Circuit = Circuits.FindOrAdd(ApiName);
+    if (ProbeId != 0 && ProbeId == Circuit.ProbeId)
+    {
+        if (bFailed)
+        {
+            Circuit.Open(Now);
+            UE_LOG(LogPlayFabCpp, Warning, TEXT("PlayFab %s API circuit probe failed, failing calls fast for another %.0f seconds"), *ApiName, Settings->CircuitBreakerOpenSeconds);
+        }
+        else
+        {
+            Circuit.Close();
+            UE_LOG(LogPlayFabCpp, Log, TEXT("PlayFab %s API circuit closed"), *ApiName);
+        }
+        return;
+    }
+
+    const int32 WindowSize = FMath::Max(1, Settings->CircuitBreakerWindowSize);
+    if (Circuit.Outcomes.Num() < WindowSize)
+    {
+        Circuit.Outcomes.Add(bFailed);
+    }
+    else
+    {
+        Circuit.Failures -= Circuit.Outcomes[Circuit.Next] ? 1 : 0;
+        Circuit.Outcomes[Circuit.Next] = bFailed;
+    }
+    Circuit.Next = (Circuit.Next + 1) % WindowSize;
+    Circuit.Failures += bFailed ? 1 : 0;
+
+    // A call sent before the circuit opened may report while it is open or half-open; its outcome is counted, but changes nothing
+    const int32 Calls = Circuit.Outcomes.Num();
+    if (Circuit.State == EPlayFabCircuitState::Closed && bFailed && Calls >= Settings->CircuitBreakerMinCalls && Circuit.Failures >= Settings->CircuitBreakerFailureRate * Calls)
+    {
+        Circuit.Open(Now);
+        UE_LOG(LogPlayFabCpp, Warning, TEXT("PlayFab %s API circuit opened after %d of %d calls failed"), *ApiName, Circuit.Failures, Calls);
+    }
+}
+
+EPlayFabCircuitState FPlayFabCircuitBreaker::GetState(const FString& ApiName)
+{
+    FScopeLock Lock(&CircuitLock);
+    const FCircuit* Circuit = Circuits.Find(ApiName);
+    return Circuit != nullptr ? Circuit->State : EPlayFabCircuitState::Closed;
+}
+
+int32 FPlayFabCircuitBreaker::GetRejectedCount()
+{
+    FScopeLock Lock(&CircuitLock);
+    return RejectedCount;
+}